@@ -0,0 +1,679 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "batch.hpp"
+#include "disassembler.hpp"
+#include "fingerprint_db.hpp"
+#include "signature_db.hpp"
+#include "statistics.hpp"
+#include "symbol_table.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if path has .rom extension (case insensitive)
+//! \param path Path
+//! \return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+is_rom_file (const fs::path& path)
+{
+  std::string ext = path.extension ().string ();
+  std::transform (ext.begin (), ext.end (), ext.begin (), ::tolower);
+
+  return ext == ".rom";
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get unique output stems, one for each ROM
+//! \param roms ROM file paths
+//! \return Output stems (file names without extension)
+//!
+//! ROMs with the same stem (e.g. dirA/game.rom and dirB/game.ROM) get a
+//! numeric suffix (game, game-2, ...), so their outputs do not overwrite
+//! each other. Stems are compared case insensitively, for case insensitive
+//! file systems.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::vector <std::string>
+get_output_stems (const std::vector <std::string>& roms)
+{
+  std::vector <std::string> stems;
+  std::unordered_set <std::string> used;
+
+  for (const auto& rom : roms)
+    {
+      const std::string base = fs::path (rom).stem ().string ();
+      std::string stem = base;
+
+      for (unsigned int i = 2;;i++)
+        {
+          std::string key = stem;
+          std::transform (key.begin (), key.end (), key.begin (), ::tolower);
+
+          if (used.insert (key).second)
+            break;
+
+          stem = base + '-' + std::to_string (i);
+        }
+
+      stems.push_back (stem);
+    }
+
+  return stems;
+}
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Batch implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class batch::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl () = default;
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set ROM start address
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_start_address (addr_type addr)
+  {
+    start_addr_ = addr;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set execution address (0 = cartridge default)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_exec_address (addr_type addr)
+  {
+    exec_addr_ = addr;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Add code entry point, used for every ROM
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  add_entry_point (addr_type addr)
+  {
+    entry_points_.push_back (addr);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load .def file into shared definitions
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_def (const std::string& path)
+  {
+    defs_.load_def (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load built-in machine profile into shared definitions
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_profile (const std::string& name)
+  {
+    defs_.load_profile (name);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load routine fingerprint file into shared database
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_fingerprints (const std::string& path)
+  {
+    fingerprints_.load (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load code signature file into shared database
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_signatures (const std::string& path)
+  {
+    signatures_.load (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Add ROM file
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  add_rom (const std::string& path)
+  {
+    roms_.push_back (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set output directory
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_output_dir (const std::string& path)
+  {
+    output_dir_ = path;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set analysis cache directory (empty = no cache)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_cache_dir (const std::string& path)
+  {
+    cache_dir_ = path;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set number of worker threads (0 = number of cores)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_jobs (unsigned int jobs)
+  {
+    jobs_ = jobs;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set whether hardware counters are read for each phase
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_perf_counters (bool flag)
+  {
+    perf_counters_ = flag;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of ROM files queued
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  get_rom_count () const
+  {
+    return roms_.size ();
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get statistics, merged from all ROMs processed
+  //! \param stats Statistics, phase times and counters added to
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  get_statistics (statistics& stats) const
+  {
+    stats.merge (stats_);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void add_source (const std::string&);
+  void add_output_format (const std::string&);
+  std::size_t run ();
+
+private:
+  void worker ();
+  void process_rom (const std::string&, const std::string&, statistics&, const perf_counters&) const;
+
+  //! \brief ROM start address
+  addr_type start_addr_ = 0x4000;
+
+  //! \brief Execution address (0 = cartridge default)
+  addr_type exec_addr_ = 0;
+
+  //! \brief Additional entry points
+  std::vector <addr_type> entry_points_;
+
+  //! \brief Shared definitions, loaded once for all ROMs
+  symbol_table defs_;
+
+  //! \brief Shared routine fingerprints, loaded once for all ROMs
+  fingerprint_db fingerprints_;
+
+  //! \brief Shared code signatures, loaded once for all ROMs
+  signature_db signatures_;
+
+  //! \brief ROM files
+  std::vector <std::string> roms_;
+
+  //! \brief Output stems, one for each ROM
+  std::vector <std::string> stems_;
+
+  //! \brief Output formats (file extensions)
+  std::vector <std::string> formats_;
+
+  //! \brief Output directory
+  std::string output_dir_ = ".";
+
+  //! \brief Analysis cache directory
+  std::string cache_dir_;
+
+  //! \brief Number of worker threads
+  unsigned int jobs_ = 0;
+
+  //! \brief Read hardware counters for each phase
+  bool perf_counters_ = false;
+
+  //! \brief Next ROM to be processed
+  std::atomic <std::size_t> next_ = 0;
+
+  //! \brief Number of failed ROMs
+  std::atomic <std::size_t> failures_ = 0;
+
+  //! \brief Mutex protecting std::cerr
+  std::mutex log_mutex_;
+
+  //! \brief Statistics, merged from all ROMs
+  statistics stats_;
+
+  //! \brief Mutex protecting stats_
+  std::mutex stats_mutex_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add ROM source
+//! \param path Either a directory (all .rom files) or a manifest file
+//!
+//! Manifest files contain one ROM path per line. Blank lines and lines
+//! starting with '#' are ignored. Relative paths are relative to the
+//! manifest file directory.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::impl::add_source (const std::string& path)
+{
+  if (fs::is_directory (path))
+    {
+      std::vector <std::string> roms;
+
+      for (const auto& entry : fs::directory_iterator (path))
+        {
+          if (entry.is_regular_file () && is_rom_file (entry.path ()))
+            roms.push_back (entry.path ().string ());
+        }
+
+      std::sort (roms.begin (), roms.end ());
+      roms_.insert (roms_.end (), roms.begin (), roms.end ());
+    }
+
+  else
+    {
+      std::ifstream in (path);
+      if (!in)
+        throw std::runtime_error ("Cannot open manifest file: " + path);
+
+      const fs::path base = fs::path (path).parent_path ();
+      std::string line;
+
+      while (std::getline (in, line))
+        {
+          const auto first = line.find_first_not_of ("\t ");
+          const auto last = line.find_last_not_of ("\r\n\t ");
+
+          if (first == std::string::npos || line[first] == '#')
+            continue;
+
+          fs::path rom = line.substr (first, last - first + 1);
+
+          if (rom.is_relative ())
+            rom = base / rom;
+
+          roms_.push_back (rom.string ());
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add output format
+//! \param fmt Either an extension (asm) or a file name (x.asm)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::impl::add_output_format (const std::string& fmt)
+{
+  auto pos = fmt.rfind ('.');
+
+  if (pos == std::string::npos)
+    formats_.push_back (fmt);
+
+  else
+    formats_.push_back (fmt.substr (pos + 1));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Disassemble all ROMs
+//! \return Number of ROMs that failed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+batch::impl::run ()
+{
+  if (formats_.empty ())
+    formats_.push_back ("asm");
+
+  fs::create_directories (output_dir_);
+
+  stems_ = get_output_stems (roms_);
+
+  for (std::size_t i = 0;i < roms_.size ();i++)
+    {
+      if (stems_[i] != fs::path (roms_[i]).stem ().string ())
+        std::cerr << "Warning: " << roms_[i] << ": output name already used, writing " << stems_[i] << " instead\n";
+    }
+
+  unsigned int jobs = jobs_ ? jobs_ : std::thread::hardware_concurrency ();
+  jobs = std::max (1u, std::min <unsigned int> (jobs, roms_.size ()));
+
+  next_ = 0;
+  failures_ = 0;
+
+  std::vector <std::thread> workers;
+
+  for (unsigned int i = 0;i < jobs;i++)
+    workers.emplace_back (&impl::worker, this);
+
+  for (auto& t : workers)
+    t.join ();
+
+  return failures_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Worker thread loop
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::impl::worker ()
+{
+  std::size_t i;
+  perf_counters counters;
+
+  if (perf_counters_)
+    counters.open ();
+
+  while ((i = next_++) < roms_.size ())
+    {
+      try
+        {
+          statistics stats;
+          process_rom (roms_[i], stems_[i], stats, counters);
+
+          std::lock_guard <std::mutex> lock (stats_mutex_);
+          stats_.merge (stats);
+        }
+      catch (const std::exception& e)
+        {
+          ++failures_;
+          std::lock_guard <std::mutex> lock (log_mutex_);
+          std::cerr << "Error: " << roms_[i] << ": " << e.what () << '\n';
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Disassemble one ROM, generating all output formats
+//! \param path ROM file path
+//! \param stem Output file name, without extension
+//! \param stats Statistics, phase times and counters added to
+//! \param counters Worker thread hardware counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::impl::process_rom (const std::string& path, const std::string& stem, statistics& stats, const perf_counters& counters) const
+{
+  set_trace_rom (path);
+  trace_span span ("batch::process_rom");
+
+  disassembler disasm;
+  disasm.set_definitions (defs_);
+  disasm.set_fingerprints (fingerprints_);
+  disasm.set_signatures (signatures_);
+  disasm.set_cache_dir (cache_dir_);
+
+  {
+    phase_timer timer (stats, "load_rom", &counters);
+    disasm.load_rom (path, start_addr_);
+  }
+
+  if (exec_addr_)
+    disasm.set_exec_address (exec_addr_);
+
+  for (auto addr : entry_points_)
+    disasm.add_entry_point (addr);
+
+  {
+    phase_timer timer (stats, "navigate", &counters);
+    disasm.navigate ();
+  }
+
+  const fs::path output = fs::path (output_dir_) / stem;
+
+  std::vector <std::string> paths;
+
+  for (const auto& fmt : formats_)
+    paths.push_back (output.string () + '.' + fmt);
+
+  {
+    phase_timer timer (stats, "generate", &counters);
+    disasm.generate (paths);
+  }
+
+  disasm.get_statistics (stats);
+  stats.roms++;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+batch::batch ()
+  : impl_ (std::make_shared <impl> ())
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set ROM start address
+//! \param addr Address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::set_start_address (addr_type addr)
+{
+  impl_->set_start_address (addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set execution address
+//! \param addr Address (0 = cartridge default)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::set_exec_address (addr_type addr)
+{
+  impl_->set_exec_address (addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add code entry point
+//! \param addr Address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::add_entry_point (addr_type addr)
+{
+  impl_->add_entry_point (addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load .def file, shared by all ROMs
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::load_def (const std::string& path)
+{
+  impl_->load_def (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load built-in machine profile, shared by all ROMs
+//! \param name Profile name (msx1, msx2, msx2+, turbor)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::load_profile (const std::string& name)
+{
+  impl_->load_profile (name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load routine fingerprint file, shared by all ROMs
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::load_fingerprints (const std::string& path)
+{
+  impl_->load_fingerprints (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load code signature file, shared by all ROMs
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::load_signatures (const std::string& path)
+{
+  impl_->load_signatures (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add ROM source (directory or manifest file)
+//! \param path Path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::add_source (const std::string& path)
+{
+  impl_->add_source (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add ROM file
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::add_rom (const std::string& path)
+{
+  impl_->add_rom (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add output format
+//! \param fmt Format extension (e.g. asm, lst)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::add_output_format (const std::string& fmt)
+{
+  impl_->add_output_format (fmt);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set analysis cache directory
+//! \param path Directory path (empty = no cache)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::set_cache_dir (const std::string& path)
+{
+  impl_->set_cache_dir (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set output directory
+//! \param path Directory path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::set_output_dir (const std::string& path)
+{
+  impl_->set_output_dir (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set number of worker threads
+//! \param jobs Number of threads (0 = number of cores)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::set_jobs (unsigned int jobs)
+{
+  impl_->set_jobs (jobs);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set whether hardware counters are read for each phase
+//! \param flag true/false
+//!
+//! Each worker thread opens its own counters, which also count the render
+//! threads it starts. Unavailable counters are silently skipped.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::set_perf_counters (bool flag)
+{
+  impl_->set_perf_counters (flag);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of ROM files queued
+//! \return Number of ROM files
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+batch::get_rom_count () const
+{
+  return impl_->get_rom_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get statistics, merged from all ROMs processed
+//! \param stats Statistics, phase times and counters added to
+//!
+//! Phase times are summed over all worker threads.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+batch::get_statistics (statistics& stats) const
+{
+  impl_->get_statistics (stats);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Disassemble all ROMs
+//! \return Number of ROMs that failed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+batch::run ()
+{
+  return impl_->run ();
+}
+
+} // namespace msxdasm
@@ -0,0 +1,83 @@
+#ifndef MSXDASM_BATCH_HPP
+#define MSXDASM_BATCH_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "statistics.hpp"
+#include <cstdint>
+#include <string>
+#include <memory>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Batch class, to disassemble many ROMs on a worker pool
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class batch
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using addr_type = std::uint16_t;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  batch ();
+  batch (const batch&) = default;
+  batch (batch&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  batch& operator= (const batch&) = default;
+  batch& operator= (batch&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void set_start_address (addr_type);
+  void set_exec_address (addr_type);
+  void add_entry_point (addr_type);
+  void load_def (const std::string&);
+  void load_profile (const std::string&);
+  void load_fingerprints (const std::string&);
+  void load_signatures (const std::string&);
+  void add_source (const std::string&);
+  void add_rom (const std::string&);
+  void add_output_format (const std::string&);
+  void set_output_dir (const std::string&);
+  void set_cache_dir (const std::string&);
+  void set_jobs (unsigned int);
+  void set_perf_counters (bool);
+  std::size_t get_rom_count () const;
+  void get_statistics (statistics&) const;
+  std::size_t run ();
+
+private:
+  //! \brief Forward declaration
+  class impl;
+
+  //! \brief Smart pointer to implementation instance
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_BATCH_HPP
@@ -0,0 +1,377 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "cartridge.hpp"
+#include "disassembler.hpp"
+#include "navigator.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+//! \brief ROM start address
+static constexpr std::uint16_t ROM_START = 0x4000;
+
+//! \brief ROM size in bytes (32K cartridge)
+static constexpr std::size_t ROM_SIZE = 0x8000;
+
+//! \brief Code entry point, after cartridge header
+static constexpr std::uint16_t ROM_EXEC = ROM_START + 0x10;
+
+//! \brief Decoded sizes sink, so decoding is not optimized away
+static volatile std::uint32_t decode_sink = 0;
+
+//! \brief Straight-line opcodes (no control flow), with their sizes
+static constexpr std::uint8_t LINEAR_OPCODES[][2] =
+{
+  {0x00, 1}, {0x04, 1}, {0x05, 1}, {0x0c, 1}, {0x23, 1}, {0x2b, 1},
+  {0x41, 1}, {0x4a, 1}, {0x53, 1}, {0x5c, 1}, {0x7e, 1}, {0x77, 1},
+  {0x80, 1}, {0x91, 1}, {0xa2, 1}, {0xb3, 1}, {0xaf, 1}, {0xbe, 1},
+  {0x06, 2}, {0x0e, 2}, {0x3e, 2}, {0xc6, 2}, {0xe6, 2}, {0xfe, 2},
+  {0x01, 3}, {0x11, 3}, {0x21, 3}, {0x32, 3}, {0x3a, 3}, {0x22, 3}
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Deterministic pseudo-random generator (xorshift64)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class random_generator
+{
+public:
+  explicit random_generator (std::uint64_t seed)
+    : state_ (seed)
+  {
+  }
+
+  std::uint32_t
+  next (std::uint32_t n)
+  {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 7;
+    state_ ^= state_ << 17;
+    return static_cast <std::uint32_t> (state_ % n);
+  }
+
+private:
+  std::uint64_t state_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Synthetic ROM image
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct rom_image
+{
+  std::vector <std::uint8_t> data = std::vector <std::uint8_t> (ROM_SIZE, 0);
+  std::size_t pos = ROM_EXEC - ROM_START;
+
+  void
+  put (std::uint8_t v)
+  {
+    data[pos++] = v;
+  }
+
+  void
+  put_word (std::uint16_t v)
+  {
+    put (v & 0xff);
+    put (v >> 8);
+  }
+
+  std::uint16_t
+  addr () const
+  {
+    return static_cast <std::uint16_t> (ROM_START + pos);
+  }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate dense code: straight-line instructions, ending in ret
+//! \param rom ROM image
+//! \param rng Random generator
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+generate_dense_code (rom_image& rom, random_generator& rng)
+{
+  while (rom.pos < ROM_SIZE - 4)
+    {
+      const auto *op = LINEAR_OPCODES[rng.next (std::size (LINEAR_OPCODES))];
+      rom.put (op[0]);
+
+      for (int i = 1;i < op[1];i++)
+        rom.put (rng.next (256));
+    }
+
+  rom.put (0xc9);                       // ret
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate branch-heavy code: 3-byte instructions, half of them
+//! conditional jumps and calls to other instructions
+//! \param rom ROM image
+//! \param rng Random generator
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+generate_branch_code (rom_image& rom, random_generator& rng)
+{
+  static constexpr std::uint8_t BRANCHES[] = {0xc2, 0xca, 0xd2, 0xda, 0xc4, 0xcc, 0xd4, 0xdc};
+  const std::uint32_t count = (ROM_SIZE - rom.pos - 4) / 3;
+
+  for (std::uint32_t i = 0;i < count;i++)
+    {
+      if (rng.next (2))
+        {
+          rom.put (BRANCHES[rng.next (std::size (BRANCHES))]);
+          rom.put_word (static_cast <std::uint16_t> (ROM_EXEC + rng.next (count) * 3));
+        }
+
+      else
+        {
+          rom.put (0x21);               // ld hl,nn
+          rom.put_word (rng.next (0x10000));
+        }
+    }
+
+  rom.put (0xc9);                       // ret
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate pure data: a single ret followed by random bytes
+//! \param rom ROM image
+//! \param rng Random generator
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+generate_data (rom_image& rom, random_generator& rng)
+{
+  rom.put (0xc9);                       // ret
+
+  while (rom.pos < ROM_SIZE)
+    rom.put (rng.next (256));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate jump-table-heavy code: blocks calling a swtcha style
+//! dispatcher, each followed by a table of handlers
+//! \param rom ROM image
+//! \param rng Random generator
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+generate_jump_tables (rom_image& rom, random_generator& rng)
+{
+  // jp over dispatcher
+  const std::uint16_t dispatcher = rom.addr () + 3;
+  rom.put (0xc3);
+  rom.put_word (dispatcher + 7);
+
+  // dispatcher: add a,a; pop hl; call ret_stub; jp (hl); ret_stub: ret
+  rom.put (0x87);
+  rom.put (0xe1);
+  rom.put (0xcd);
+  rom.put_word (dispatcher + 6);
+  rom.put (0xe9);
+  rom.put (0xc9);
+
+  while (true)
+    {
+      const std::uint32_t handlers = 2 + rng.next (15);
+      const std::size_t block_size = 3 + handlers * 2 + 3 + (handlers - 1);
+
+      if (rom.pos + block_size + 1 > ROM_SIZE)
+        break;
+
+      const std::uint16_t table_end = rom.addr () + 3 + handlers * 2;
+      const std::uint16_t next_block = table_end + 3 + (handlers - 1);
+
+      rom.put (0xcd);                   // call dispatcher
+      rom.put_word (dispatcher);
+
+      for (std::uint32_t i = 0;i < handlers;i++)
+        rom.put_word (i ? table_end + 2 + i : table_end);
+
+      rom.put (0xc3);                   // first handler: jp next_block
+      rom.put_word (next_block);
+
+      for (std::uint32_t i = 1;i < handlers;i++)
+        rom.put (0xc9);                 // other handlers: ret
+    }
+
+  rom.put (0xc9);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Write synthetic ROM file
+//! \param path File path
+//! \param kind ROM kind
+//! \param seed Random seed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+write_rom (const std::string& path, const std::string& kind, std::uint64_t seed)
+{
+  rom_image rom;
+  random_generator rng (seed);
+
+  rom.data[0] = 'A';
+  rom.data[1] = 'B';
+  rom.data[2] = ROM_EXEC & 0xff;
+  rom.data[3] = ROM_EXEC >> 8;
+
+  if (kind == "dense")
+    generate_dense_code (rom, rng);
+
+  else if (kind == "branch")
+    generate_branch_code (rom, rng);
+
+  else if (kind == "data")
+    generate_data (rom, rng);
+
+  else
+    generate_jump_tables (rom, rng);
+
+  std::ofstream fp (path, std::ios::binary);
+  fp.write (reinterpret_cast <const char *> (rom.data.data ()), rom.data.size ());
+
+  if (!fp)
+    throw std::runtime_error ("Failed to write " + path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run function repeatedly, for at least a given time
+//! \param f Function, returning amount of work done (instructions, bytes)
+//! \param min_seconds Minimum run time
+//! \return Work done per second
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static double
+measure (const std::function <std::uint64_t ()>& f, double min_seconds)
+{
+  using clock = std::chrono::steady_clock;
+
+  f ();                                 // warm up
+
+  std::uint64_t work = 0;
+  const auto start = clock::now ();
+  std::chrono::duration <double> elapsed {0};
+
+  do
+    {
+      work += f ();
+      elapsed = clock::now () - start;
+    }
+  while (elapsed.count () < min_seconds);
+
+  return work / elapsed.count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Show benchmark result
+//! \param name Benchmark name
+//! \param kind ROM kind
+//! \param value Rate
+//! \param unit Rate unit
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+show_result (const std::string& name, const std::string& kind, double value, const std::string& unit)
+{
+  std::cout << std::left << std::setw (12) << name
+            << std::setw (8) << kind
+            << std::right << std::fixed << std::setprecision (2) << std::setw (12) << value
+            << ' ' << unit << std::endl;
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+//!
+//! Use: msxdasm_bench [seconds per benchmark]
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main (int argc, char **argv)
+{
+  const double min_seconds = argc > 1 ? std::atof (argv[1]) : 0.5;
+  const fs::path dir = fs::temp_directory_path () / ("msxdasm_bench." + std::to_string (getpid ()));
+  fs::create_directories (dir);
+
+  for (const std::string kind : {"dense", "branch", "data", "table"})
+    {
+      const std::string rom_path = (dir / (kind + ".rom")).string ();
+      write_rom (rom_path, kind, 0x9e3779b97f4a7c15ULL);
+
+      msxdasm::cartridge cart;
+      cart.load_rom (rom_path, ROM_START);
+
+      const std::uint32_t start_addr = cart.get_start_address ();
+      const std::uint32_t end_addr = cart.get_end_address ();
+
+      // decoding: one instruction at every address
+      msxdasm::navigator nav;
+      nav.navigate (cart);
+
+      auto decode_rate = measure ([&] ()
+        {
+          std::uint32_t sizes = 0;
+
+          for (std::uint32_t pc = start_addr;pc <= end_addr;pc++)
+            sizes += nav.decode (pc).size;
+
+          decode_sink = sizes;
+          return std::uint64_t (end_addr - start_addr + 1);
+        }, min_seconds);
+
+      show_result ("decode", kind, decode_rate / 1e6, "M insn/s");
+
+      // navigation
+      auto navigate_rate = measure ([&] ()
+        {
+          msxdasm::navigator n;
+          n.navigate (cart);
+          return std::uint64_t (end_addr - start_addr + 1);
+        }, min_seconds);
+
+      show_result ("navigate", kind, navigate_rate / 1e6, "MB/s");
+
+      // rendering, one output format at a time
+      msxdasm::disassembler disasm;
+      disasm.load_rom (rom_path, ROM_START);
+      disasm.navigate ();
+
+      for (const std::string format : {"asm", "lst"})
+        {
+          const std::string out_path = (dir / ("out." + format)).string ();
+
+          auto render_rate = measure ([&] ()
+            {
+              disasm.generate (out_path);
+              return std::uint64_t (fs::file_size (out_path));
+            }, min_seconds);
+
+          show_result ("render." + format, kind, render_rate / 1e6, "MB/s");
+        }
+    }
+
+  fs::remove_all (dir);
+}
@@ -16,10 +16,15 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "cartridge.hpp"
+#include "trace.hpp"
 #include <array>
+#include <cerrno>
 #include <cstring>
 #include <stdexcept>
 
+#include <fcntl.h>
+#include <unistd.h>
+
 namespace msxdasm
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -88,12 +93,24 @@ public:
       return mem_[pc];
   }
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get memory data
+  //! \return Pointer to memory image, indexed by address
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const std::uint8_t *
+  get_data () const
+  {
+      return mem_.data ();
+  }
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   std::uint16_t get_word (addr_type) const;
   addr_type get_offset (addr_type) const;
   void load_rom (const std::string&, addr_type);
+  void load_rom (int, addr_type);
+  void load_rom (const std::uint8_t *, std::size_t, addr_type);
 
 private:
   //! \brief Start address
@@ -156,21 +173,69 @@ cartridge::impl::get_offset (addr_type addr) const
 void
 cartridge::impl::load_rom (const std::string& path, addr_type addr)
 {
-  // Read file
-  FILE *fp = fopen (path.c_str (), "rb");
-  if (!fp)
+  int fd = ::open (path.c_str (), O_RDONLY);
+  if (fd == -1)
     throw std::runtime_error (strerror (errno));
 
+  try
+    {
+      load_rom (fd, addr);
+    }
+  catch (const std::exception&)
+    {
+      ::close (fd);
+      throw;
+    }
+
+  ::close (fd);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load ROM data from file descriptor (e.g. a pipe) into memory
+//! \param fd File descriptor, read until end of file
+//! \param addr Start address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+cartridge::impl::load_rom (int fd, addr_type addr)
+{
+  // Read data
   std::array <std::uint8_t, 0x10000> mem;
-  auto siz = fread (mem.data (), 1, 0x10000, fp);
-  fclose (fp);
+  std::size_t siz = 0;
+
+  while (siz < mem.size ())
+    {
+      auto count = ::read (fd, mem.data () + siz, mem.size () - siz);
+
+      if (count == -1 && errno == EINTR)
+        continue;
+
+      if (count == -1)
+        throw std::runtime_error (strerror (errno));
 
+      if (count == 0)
+        break;
+
+      siz += count;
+    }
+
+  load_rom (mem.data (), siz, addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load ROM data from memory
+//! \param data ROM data
+//! \param siz Size in bytes
+//! \param addr Start address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+cartridge::impl::load_rom (const std::uint8_t *data, std::size_t siz, addr_type addr)
+{
   // Check for data overflow
-  if (static_cast <std::uint32_t> (addr) + static_cast <std::uint32_t> (siz) > 0xffff)
+  if (static_cast <std::uint32_t> (addr) + siz > 0xffff)
     throw std::runtime_error ("Memory overflow reading .rom file");
 
   // Set data
-  std::copy (mem.begin (), mem.begin () + siz, mem_.data () + addr);
+  std::copy (data, data + siz, mem_.data () + addr);
 
   addr_start_ = addr;
   addr_end_   = addr + siz - 1;
@@ -232,6 +297,16 @@ cartridge::get_byte (addr_type pc) const
   return impl_->get_byte (pc);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get memory data
+//! \return Pointer to memory image, indexed by address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const std::uint8_t *
+cartridge::get_data () const
+{
+  return impl_->get_data ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get word value from memory
 //! \param pc Memory pos
@@ -260,7 +335,28 @@ cartridge::get_offset (addr_type pc) const
 void
 cartridge::load_rom (const std::string& path, addr_type addr)
 {
+  trace_span span ("cartridge::load_rom");
   impl_->load_rom (path, addr);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load ROM data from file descriptor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+cartridge::load_rom (int fd, addr_type addr)
+{
+  trace_span span ("cartridge::load_rom");
+  impl_->load_rom (fd, addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load ROM data from memory
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+cartridge::load_rom (const std::uint8_t *data, std::size_t siz, addr_type addr)
+{
+  trace_span span ("cartridge::load_rom");
+  impl_->load_rom (data, siz, addr);
+}
+
 } // namespace msxdasm
\ No newline at end of file
@@ -18,6 +18,7 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -56,9 +57,12 @@ public:
   addr_type get_exec_address () const;
   void set_exec_address (addr_type);
   std::uint8_t get_byte (addr_type) const;
+  const std::uint8_t *get_data () const;
   std::uint16_t get_word (addr_type) const;
   addr_type get_offset (addr_type) const;
   void load_rom (const std::string&, addr_type);
+  void load_rom (int, addr_type);
+  void load_rom (const std::uint8_t *, std::size_t, addr_type);
 
 private:
   //! \brief Forward declaration
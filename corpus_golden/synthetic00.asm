@@ -0,0 +1,2072 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	2dh,61h,68h,67h,beh,6ah,d9h,87h
+			db	6fh,1eh,83h,84h
+
+start:						; execution starting point
+			rst	30h
+			ld	(hl),88h
+			ld	c,b
+			sub	d
+			add	a,b
+			ld	l,h
+			or	d
+			ld	l,h
+			ld	e,d
+			add	hl,hl
+			adc	a,a
+			dec	l
+			ld	c,(hl)
+			rst	30h
+			ld	c,d
+			xor	h
+			jp	(hl)
+			db	19h,bbh,99h,f3h,66h,eeh,e0h,bch
+			db	97h,d5h,d9h,c9h,57h,0ch,f0h,eeh
+			db	0fh,36h,87h,3fh,93h,f4h,dch,05h
+			db	b6h,b2h,cfh,c5h,aeh,d0h,74h,b2h
+			db	b3h,62h,6bh,1bh,06h,d3h,20h,23h
+			db	a3h,38h,c1h,52h,23h,9eh,fah,dfh
+			db	55h,0fh,c3h,72h,aeh,d1h,5ah,68h
+			db	2fh,14h,b8h,e3h,1bh,45h,07h,94h
+			db	39h,0fh,edh,2ch,adh,9bh,35h,72h
+			db	03h,97h,4dh,bfh,7fh,3bh,62h,6dh
+			db	34h,c0h,9ah,fbh,a7h,f8h,b8h,1eh
+			db	b5h,bch,09h,30h,d7h,56h,dfh,34h
+			db	06h,eeh,a7h,f7h,74h,6dh,c9h,bbh
+			db	a3h,95h,e2h,41h,00h,b8h,c7h,c6h
+			db	11h,77h,f7h,c5h,d2h,edh,47h,f0h
+			db	97h,f3h,7ch,88h,c5h,8ah,3ch,7ch
+			db	2eh,61h,11h,11h,d3h,12h,deh,75h
+			db	1ch,ceh,cfh,cbh,68h,41h,49h,cah
+			db	6fh,46h,9eh,1fh,afh,50h,8ch,d7h
+			db	9dh,fbh,c1h,7bh,48h,62h,46h,74h
+			db	e8h,edh,c5h,99h,2ch,ffh,c6h,9bh
+			db	c8h,f5h,bch,c5h,10h,eeh,c6h,08h
+			db	a4h,c5h,b9h,29h,68h,a6h,6ah,7ch
+			db	efh,0dh,27h,adh,23h,f2h,83h,d4h
+			db	dah,c8h,e2h,84h,a2h,2eh,c3h,27h
+			db	d5h,c8h,3fh,a5h,fah,7fh,7ch,9ah
+			db	6dh,43h,55h,c3h,54h,c3h,81h,8fh
+			db	53h,99h,e8h,7ch,f8h,c4h,9ah,f6h
+			db	a1h,12h,c7h,46h,85h,50h,1bh,6ch
+			db	b7h,ddh,ddh,8ah,66h,e5h,70h,b0h
+			db	4fh,1fh,76h,0eh,40h,3fh,80h,c9h
+			db	dah,01h,4eh,68h,6ah,e6h,a1h,7ah
+			db	4bh,fdh,80h,e7h,14h,d1h,28h,3bh
+			db	6ch,ceh,ddh,bdh,d2h,a1h,51h,6dh
+			db	bah,1dh,d3h,7ch,95h,23h,4ah,59h
+			db	0dh,2ah,1ah,32h,98h,e6h,5fh,8ah
+			db	19h,53h,bfh,efh,7bh,47h,23h,82h
+			db	93h,0bh,b6h,3dh,43h,efh,54h,55h
+			db	d8h,59h,a6h,21h,8eh,64h,03h,7ch
+			db	e3h,deh,efh,20h,e6h,9fh,16h,5fh
+			db	aah,95h,94h,98h,a7h,f2h,9bh,4ch
+			db	5fh,e3h,61h,03h,54h,05h,53h,bch
+			db	67h,bfh,fbh,81h,ceh,2eh,b1h,26h
+			db	47h,3ch,5eh,bch,64h,afh,b5h,b5h
+			db	a9h,8eh,4dh,d3h,89h,2ch,63h,52h
+			db	01h,42h,8ah,1fh,8eh,d8h,c3h,07h
+			db	15h,1eh,7fh,feh,f8h,36h,50h,aah
+			db	64h,bbh,edh,dfh,ach,8ch,53h,cch
+			db	9ah,f6h,4eh,e9h,6ch,57h,6eh,26h
+			db	96h,68h,1dh,25h,94h,14h,1fh,8bh
+			db	eah,b8h,a2h,41h,20h,ceh,7ah,ech
+			db	ddh,00h,f7h,9fh,34h,64h,0eh,44h
+			db	6dh,f0h,87h,ffh,62h,13h,56h,bbh
+			db	6eh,37h,e0h,5eh,78h,c0h,03h,edh
+			db	13h,55h,d9h,1bh,6fh,20h,a1h,31h
+			db	f4h,23h,51h,edh,d2h,37h,a4h,45h
+			db	43h,81h,27h,1ah,82h,d8h,1ah,deh
+			db	f2h,4dh,5eh,46h,28h,d4h,e3h,96h
+			db	c2h,aeh,8dh,90h,cfh,edh,56h,1dh
+			db	bch,feh,0eh,9eh,4ch,52h,5dh,e0h
+			db	a9h,e1h,1ch,d4h,f1h,87h,b3h,5bh
+			db	8eh,1eh,3ch,a8h,dah,06h,75h,d1h
+			db	d1h,dfh,c7h,35h,72h,71h,4ah,59h
+			db	0bh,afh,33h,58h,10h,82h,2ah,53h
+			db	74h,7ch,deh,90h,0eh,e9h,94h,58h
+			db	48h,77h,ebh,73h,6fh,15h,9fh,edh
+			db	bah,ffh,3ch,5eh,8eh,a2h,d3h,03h
+			db	c7h,bfh,39h,e3h,07h,e2h,77h,43h
+			db	2ah,42h,1bh,66h,bah,7fh,ceh,20h
+			db	f5h,8ch,0ch,b3h,66h,73h,e5h,aeh
+			db	a2h,bfh,7fh,c1h,68h,1bh,ddh,25h
+			db	a6h,57h,45h,efh,03h,3bh,deh,70h
+			db	cfh,cfh,38h,18h,c0h,1eh,88h,d1h
+			db	9eh,e0h,84h,b7h,b4h,05h,1dh,76h
+			db	efh,68h,d8h,b2h,5fh,a7h,62h,c6h
+			db	d6h,f7h,76h,dah,5bh,d5h,4eh,7dh
+			db	96h,83h,4ah,d6h,7eh,b1h,8bh,5bh
+			db	16h,bbh,3ah,8fh,ceh,9ah,abh,4eh
+			db	40h,46h,79h,64h,fch,b5h,f9h,9ch
+			db	bch,71h,aah,deh,6bh,26h,10h,9ah
+			db	b7h,ech,e5h,23h,0ah,3ah,68h,79h
+			db	90h,74h,59h,02h,bch,36h,0fh,35h
+			db	9ch,e2h,ceh,03h,e5h,a7h,24h,15h
+			db	2dh,3ch,b5h,f0h,8fh,c8h,bdh,69h
+			db	5ah,70h,b8h,15h,d2h,7dh,a4h,b8h
+			db	2ch,d8h,eeh,06h,f7h,5ch,58h,75h
+			db	22h,e1h,bfh,3fh,82h,e3h,15h,16h
+			db	e3h,b7h,2bh,7fh,aeh,4bh,c6h,92h
+			db	39h,71h,95h,47h,f1h,68h,a4h,7ah
+			db	d7h,8fh,6ah,b8h,98h,dfh,90h,7fh
+			db	46h,81h,52h,69h,99h,e3h,e2h,d9h
+			db	0bh,bdh,9eh,20h,68h,b1h,c3h,0fh
+			db	1dh,b3h,95h,0dh,c8h,14h,22h,65h
+			db	e1h,f7h,2eh,c6h,a9h,cdh,4ah,41h
+			db	dah,05h,9ah,09h,1ah,0ah,e8h,24h
+			db	41h,dfh,80h,82h,d1h,dbh,e2h,71h
+			db	8fh,6bh,57h,d9h,ffh,cch,e4h,dbh
+			db	35h,6ah,cbh,84h,17h,aah,cah,46h
+			db	0ch,10h,b4h,c8h,98h,56h,4ch,f9h
+			db	91h,6fh,37h,c3h,ddh,63h,feh,3dh
+			db	3dh,d9h,99h,33h,4dh,75h,a2h,cbh
+			db	74h,fdh,f3h,34h,9ah,b4h,15h,9ah
+			db	cdh,4ch,6ah,37h,05h,6ch,89h,2ch
+			db	31h,c1h,e1h,9eh,c5h,aah,b1h,31h
+			db	42h,e3h,2ch,b0h,e1h,98h,83h,bah
+			db	31h,8dh,dch,71h,b0h,b7h,18h,a0h
+			db	84h,d4h,3dh,fah,bdh,ffh,22h,56h
+			db	76h,a0h,28h,cch,61h,08h,44h,c0h
+			db	f7h,86h,3eh,21h,29h,07h,8dh,e0h
+			db	62h,b9h,cch,f4h,c6h,d8h,deh,42h
+			db	92h,0eh,6dh,32h,38h,1dh,e2h,16h
+			db	81h,a5h,82h,65h,d0h,7ch,64h,67h
+			db	95h,70h,a4h,09h,e5h,76h,49h,ebh
+			db	52h,ceh,0eh,60h,51h,fch,87h,0ah
+			db	d4h,57h,20h,95h,35h,51h,78h,18h
+			db	ceh,23h,4dh,24h,31h,96h,4dh,32h
+			db	bfh,96h,69h,56h,66h,45h,fdh,86h
+			db	1ch,7dh,c2h,82h,d2h,b8h,9ah,1ah
+			db	33h,37h,29h,00h,31h,c4h,c6h,31h
+			db	dch,aeh,ceh,21h,60h,0ch,54h,b3h
+			db	64h,69h,edh,72h,f2h,adh,7dh,29h
+			db	88h,07h,52h,58h,f0h,aeh,2ch,29h
+			db	98h,80h,13h,bah,14h,17h,5eh,29h
+			db	c3h,59h,c3h,c2h,b4h,c0h,3bh,15h
+			db	c3h,8dh,7ah,61h,96h,b3h,3ah,36h
+			db	5eh,37h,25h,51h,aeh,43h,1ch,30h
+			db	6bh,08h,55h,edh,f8h,49h,c0h,d0h
+			db	c4h,4ch,a9h,d7h,f4h,f0h,d4h,70h
+			db	4bh,15h,f2h,70h,d4h,7ch,47h,a4h
+			db	a1h,f7h,2fh,e4h,08h,f8h,63h,87h
+			db	a3h,75h,2fh,53h,0ch,69h,59h,8eh
+			db	84h,12h,77h,cfh,17h,6dh,16h,84h
+			db	63h,19h,4ch,7ch,8ch,27h,a2h,aah
+			db	f5h,54h,1ah,a4h,e5h,b6h,46h,f1h
+			db	b1h,5ch,e5h,02h,89h,5ch,b7h,30h
+			db	dch,59h,cfh,4bh,93h,16h,3dh,4eh
+			db	a1h,4ah,b4h,79h,64h,fah,70h,86h
+			db	cdh,6ch,60h,d6h,5ah,e5h,78h,96h
+			db	20h,68h,f6h,d2h,3bh,3ah,b7h,4bh
+			db	6eh,34h,0eh,2fh,b8h,a3h,39h,d5h
+			db	8ch,e5h,1ah,42h,83h,6eh,3ah,24h
+			db	d2h,21h,7dh,8ch,6fh,fdh,bah,10h
+			db	4ch,91h,d1h,0eh,afh,64h,6bh,8bh
+			db	02h,5dh,9ah,37h,a0h,f4h,d1h,15h
+			db	50h,53h,9eh,4fh,98h,8dh,cfh,2ch
+			db	11h,70h,24h,a3h,01h,a0h,e4h,6ah
+			db	d3h,76h,fah,40h,39h,9eh,2dh,65h
+			db	05h,a4h,0dh,d9h,4fh,e1h,51h,44h
+			db	a6h,a5h,ebh,6bh,f0h,d3h,b1h,a9h
+			db	c0h,dfh,46h,d5h,3eh,d8h,e6h,48h
+			db	66h,88h,8ah,b3h,d5h,eah,80h,fdh
+			db	8eh,a2h,f7h,b3h,02h,e3h,49h,bah
+			db	78h,7ch,c6h,feh,7fh,91h,0fh,6fh
+			db	9fh,87h,8ah,bch,eeh,6ah,59h,ebh
+			db	ffh,15h,4bh,11h,45h,aeh,13h,b8h
+			db	9dh,1ah,3eh,edh,09h,91h,ebh,a0h
+			db	54h,b4h,41h,6ah,edh,60h,05h,a1h
+			db	53h,b6h,34h,9fh,6dh,8ch,95h,c8h
+			db	d0h,51h,95h,27h,80h,57h,16h,8ah
+			db	22h,01h,fah,e8h,c3h,2dh,17h,7eh
+			db	66h,c6h,9ah,a8h,f3h,5ch,55h,47h
+			db	86h,53h,25h,e5h,3eh,38h,ddh,2fh
+			db	aah,65h,a9h,15h,17h,92h,31h,5fh
+			db	91h,1bh,13h,cah,f2h,26h,85h,85h
+			db	64h,f6h,8ah,b3h,3eh,ffh,9ch,65h
+			db	e3h,83h,b5h,f8h,36h,89h,26h,52h
+			db	19h,c1h,7dh,62h,84h,e4h,1ch,46h
+			db	ebh,6ah,deh,a8h,4eh,54h,64h,54h
+			db	79h,8ch,f8h,2bh,d3h,b1h,ceh,a6h
+			db	b6h,50h,6ah,afh,47h,cfh,c4h,ddh
+			db	d8h,81h,ebh,54h,19h,f2h,92h,ebh
+			db	55h,eeh,7eh,4dh,48h,83h,68h,bbh
+			db	45h,eah,dbh,14h,7ch,1ch,6dh,a2h
+			db	04h,fah,29h,d2h,55h,e8h,2eh,1ah
+			db	45h,60h,b1h,81h,27h,adh,c8h,12h
+			db	cah,51h,c5h,26h,07h,08h,cbh,b6h
+			db	b5h,5ah,92h,8eh,9ch,55h,d7h,44h
+			db	19h,c0h,b7h,4dh,46h,10h,26h,9ch
+			db	bfh,b4h,cdh,dbh,cch,9eh,a9h,b7h
+			db	a4h,6ah,4ch,87h,beh,07h,b6h,21h
+			db	ach,c2h,06h,4eh,42h,a8h,9fh,72h
+			db	87h,0eh,71h,85h,bch,90h,f6h,6fh
+			db	a2h,90h,9bh,6bh,98h,feh,9dh,1fh
+			db	06h,a0h,60h,b4h,84h,69h,b1h,93h
+			db	99h,46h,fdh,b6h,e2h,20h,47h,64h
+			db	64h,2bh,38h,f5h,48h,61h,cdh,c1h
+			db	2bh,48h,4eh,feh,41h,e9h,cdh,ddh
+			db	29h,1ah,89h,16h,b9h,29h,0ah,57h
+			db	94h,c9h,4ch,5fh,c3h,0fh,68h,18h
+			db	89h,10h,2ah,d0h,c4h,77h,67h,0bh
+			db	22h,eah,4ch,55h,76h,73h,abh,5ah
+			db	16h,4fh,5bh,86h,87h,d5h,4eh,e6h
+			db	9ch,e7h,d8h,e3h,e0h,4ch,40h,0fh
+			db	55h,d3h,40h,6eh,97h,4fh,6dh,28h
+			db	36h,deh,3ch,70h,d5h,12h,12h,e7h
+			db	4ah,31h,2eh,a7h,f0h,d2h,43h,56h
+			db	40h,f2h,32h,5ah,c3h,feh,5ch,f0h
+			db	dch,f5h,7fh,08h,5fh,1ah,adh,bdh
+			db	6dh,e7h,3ah,52h,dbh,f0h,4fh,6fh
+			db	77h,e9h,0ch,25h,c5h,89h,43h,ddh
+			db	c5h,f4h,e2h,68h,46h,bbh,0bh,62h
+			db	e3h,40h,41h,dbh,b0h,94h,8dh,2fh
+			db	03h,03h,3ch,8ah,edh,efh,cch,a6h
+			db	2eh,0dh,7dh,04h,98h,b4h,c8h,13h
+			db	19h,28h,f3h,b5h,19h,4eh,e9h,49h
+			db	aah,71h,e9h,b3h,d5h,47h,e6h,22h
+			db	66h,35h,23h,eah,86h,eeh,4fh,30h
+			db	eah,4bh,4ch,47h,e8h,b2h,d2h,beh
+			db	abh,1bh,6fh,eah,65h,19h,62h,a3h
+			db	93h,6bh,a4h,27h,19h,f1h,afh,e2h
+			db	3bh,66h,36h,ceh,b3h,56h,9ah,d0h
+			db	9ah,2fh,d3h,35h,11h,03h,e8h,90h
+			db	ech,a7h,1dh,7ah,6dh,8fh,d9h,c8h
+			db	69h,76h,31h,35h,8eh,4fh,26h,7ah
+			db	a6h,07h,25h,afh,0fh,8ch,74h,beh
+			db	6fh,06h,5bh,e1h,5ah,15h,28h,c2h
+			db	e0h,4eh,b8h,24h,20h,98h,25h,30h
+			db	c9h,27h,60h,a0h,c8h,e7h,cbh,0ch
+			db	17h,5eh,75h,23h,46h,1dh,30h,0fh
+			db	13h,a7h,96h,fch,efh,22h,d6h,64h
+			db	09h,e9h,90h,e3h,84h,e3h,b9h,89h
+			db	5ah,6dh,9dh,74h,fah,8fh,40h,97h
+			db	50h,20h,5fh,92h,5bh,3ch,abh,03h
+			db	d0h,aeh,4fh,42h,70h,beh,91h,d4h
+			db	68h,54h,0ch,2ch,f3h,e7h,e4h,39h
+			db	81h,dah,7ah,48h,dfh,f7h,84h,d3h
+			db	c0h,94h,bbh,5fh,b7h,aeh,9bh,fch
+			db	cdh,0fh,b8h,e3h,25h,06h,81h,8dh
+			db	bbh,d6h,b2h,ech,b5h,84h,ffh,adh
+			db	11h,90h,44h,8eh,9bh,99h,bfh,5ah
+			db	1dh,65h,34h,c4h,47h,5ch,71h,c9h
+			db	a1h,fbh,fdh,01h,c8h,97h,76h,c3h
+			db	0fh,c4h,b5h,71h,92h,2dh,35h,66h
+			db	cah,50h,eeh,11h,a2h,e9h,13h,bdh
+			db	b6h,0ah,b8h,7fh,efh,b0h,d5h,13h
+			db	79h,8fh,49h,c2h,b9h,6ch,22h,97h
+			db	f7h,e7h,16h,44h,cch,93h,45h,abh
+			db	1bh,44h,15h,6ah,aah,c1h,30h,97h
+			db	26h,9dh,37h,72h,3bh,1bh,ddh,17h
+			db	54h,4ah,adh,9bh,37h,5eh,a2h,a2h
+			db	ach,90h,98h,2ch,9dh,c2h,0eh,8ah
+			db	14h,8eh,f2h,55h,53h,e2h,a0h,aah
+			db	79h,58h,8eh,b4h,c0h,2eh,97h,c2h
+			db	59h,36h,01h,37h,fbh,68h,86h,c1h
+			db	56h,02h,eeh,d2h,e8h,f6h,75h,a0h
+			db	39h,18h,75h,a0h,20h,66h,51h,a0h
+			db	a2h,b8h,efh,fbh,f2h,18h,03h,13h
+			db	dbh,5ch,19h,69h,85h,7ah,3fh,4ch
+			db	f4h,73h,82h,2fh,24h,f9h,01h,7fh
+			db	93h,11h,c7h,abh,dbh,f1h,4bh,a5h
+			db	f2h,c2h,6ah,39h,28h,09h,6fh,72h
+			db	d7h,04h,aeh,59h,9bh,59h,2dh,a2h
+			db	ddh,d8h,c3h,2bh,11h,18h,c1h,c4h
+			db	b2h,74h,03h,12h,3eh,ech,b9h,c1h
+			db	feh,fah,dbh,3fh,ebh,72h,d3h,a2h
+			db	61h,f6h,65h,c3h,3fh,96h,a2h,1fh
+			db	bah,0ch,c2h,9ch,2fh,3bh,d9h,7fh
+			db	e4h,c8h,9dh,f1h,14h,36h,a8h,4eh
+			db	0bh,01h,dch,92h,3eh,91h,a2h,82h
+			db	6bh,dfh,d5h,2dh,cdh,2bh,4fh,48h
+			db	f3h,2dh,ach,e8h,01h,75h,5bh,feh
+			db	90h,70h,33h,fbh,9ch,e4h,15h,2ah
+			db	f7h,ddh,03h,9dh,9ch,f7h,5ch,77h
+			db	03h,bdh,53h,ffh,ach,94h,c7h,7bh
+			db	48h,2fh,8fh,e7h,cch,23h,dbh,07h
+			db	b0h,a2h,cah,08h,b6h,52h,29h,66h
+			db	64h,f8h,b3h,0dh,6dh,81h,6bh,a3h
+			db	91h,70h,97h,f9h,93h,cch,43h,77h
+			db	f5h,dah,2fh,1bh,0dh,d9h,25h,9ah
+			db	9bh,fch,e4h,7fh,33h,cch,cah,9eh
+			db	58h,84h,ach,58h,71h,74h,41h,28h
+			db	1ch,89h,42h,73h,5ah,00h,e3h,37h
+			db	e8h,4dh,32h,a7h,88h,62h,0dh,0eh
+			db	07h,16h,c4h,06h,a8h,f2h,25h,21h
+			db	76h,31h,f2h,7ah,1bh,6ch,ebh,2eh
+			db	a5h,87h,6fh,a7h,cdh,fch,b9h,dbh
+			db	15h,56h,65h,2dh,d9h,b8h,97h,e0h
+			db	58h,f9h,a3h,72h,4eh,57h,b7h,b6h
+			db	b0h,1eh,f8h,b5h,81h,e5h,22h,5ch
+			db	ddh,6ah,1fh,73h,5ah,aah,e9h,6ah
+			db	3ch,67h,d4h,1fh,54h,aah,dah,0fh
+			db	4bh,dah,5ch,f7h,67h,b9h,f2h,39h
+			db	ech,9bh,b5h,3dh,94h,9eh,d9h,38h
+			db	66h,52h,b4h,1ah,8eh,48h,6ch,63h
+			db	feh,17h,a9h,32h,36h,78h,dbh,05h
+			db	b2h,aeh,53h,7eh,9eh,18h,75h,efh
+			db	78h,6fh,fch,43h,fah,64h,e1h,1fh
+			db	8eh,cfh,6dh,f0h,0dh,96h,d1h,8fh
+			db	c9h,24h,94h,9bh,4eh,8ch,d9h,20h
+			db	e9h,38h,5eh,40h,59h,31h,a6h,78h
+			db	4ah,71h,81h,6bh,97h,07h,8ah,21h
+			db	56h,50h,fch,d9h,b4h,6bh,86h,c7h
+			db	39h,08h,eah,69h,f4h,72h,45h,25h
+			db	7ah,e6h,17h,eah,f5h,ebh,64h,7fh
+			db	86h,85h,b0h,51h,52h,7fh,a7h,13h
+			db	a6h,a3h,d0h,22h,4ch,98h,2ah,23h
+			db	67h,d6h,7dh,f6h,33h,bch,18h,cch
+			db	11h,89h,07h,bfh,25h,b7h,30h,39h
+			db	cbh,0bh,9bh,b0h,36h,bbh,59h,ach
+			db	15h,75h,8dh,c3h,83h,c9h,ffh,50h
+			db	8ah,00h,a0h,d5h,90h,3bh,8bh,2fh
+			db	61h,a4h,4fh,24h,9ch,8bh,2fh,19h
+			db	53h,19h,5fh,11h,55h,1eh,3ch,82h
+			db	3dh,3ah,1eh,75h,e8h,1ch,05h,18h
+			db	b9h,fah,cch,d7h,a7h,15h,fah,02h
+			db	6ah,7eh,64h,ceh,cbh,0fh,17h,6dh
+			db	81h,82h,e6h,31h,62h,01h,deh,2ah
+			db	30h,ebh,73h,18h,5fh,4dh,b2h,32h
+			db	16h,7bh,cfh,67h,4bh,a8h,38h,50h
+			db	03h,36h,90h,54h,8dh,75h,bah,edh
+			db	e3h,e8h,afh,1dh,bch,cdh,fah,9dh
+			db	d2h,16h,c9h,0ah,37h,09h,a9h,ffh
+			db	53h,25h,4fh,6bh,8eh,9eh,62h,b9h
+			db	fdh,afh,deh,5dh,f1h,e1h,28h,05h
+			db	61h,01h,b9h,15h,ffh,0ah,77h,c2h
+			db	9ah,13h,d3h,f4h,b4h,e4h,86h,51h
+			db	65h,f0h,65h,31h,96h,80h,a9h,42h
+			db	b3h,94h,b7h,1eh,24h,a2h,3bh,0dh
+			db	5ch,4ch,64h,efh,e8h,7ch,a7h,04h
+			db	cah,beh,f4h,d4h,18h,98h,3eh,2fh
+			db	b0h,a7h,3bh,21h,eeh,b3h,8fh,10h
+			db	b8h,c4h,eah,c3h,7ch,3ch,f5h,74h
+			db	82h,f0h,32h,96h,89h,80h,51h,33h
+			db	c3h,74h,8dh,28h,25h,bbh,a2h,74h
+			db	29h,d1h,21h,d0h,cdh,c5h,f4h,f5h
+			db	97h,cfh,3ch,79h,c9h,39h,43h,82h
+			db	19h,dfh,53h,bfh,4ch,38h,84h,0ch
+			db	41h,a3h,adh,abh,9bh,35h,feh,00h
+			db	c1h,b6h,cch,bfh,e3h,93h,1eh,c2h
+			db	1ch,fdh,9dh,45h,92h,cbh,d6h,18h
+			db	0eh,30h,08h,56h,c4h,d9h,cfh,c6h
+			db	9dh,d7h,94h,d4h,19h,88h,ebh,e7h
+			db	ffh,b0h,3eh,81h,7dh,50h,f8h,48h
+			db	f4h,80h,11h,b2h,8dh,f7h,38h,1ch
+			db	25h,f1h,bch,47h,a4h,fah,9eh,8eh
+			db	c4h,e8h,65h,78h,cfh,efh,6bh,ffh
+			db	d0h,e1h,f0h,84h,96h,86h,5eh,5dh
+			db	37h,eeh,97h,15h,5ch,63h,39h,bah
+			db	9eh,c8h,41h,ach,5bh,beh,95h,05h
+			db	f0h,9fh,75h,24h,7ah,19h,11h,d4h
+			db	1ah,bdh,8bh,1eh,a6h,02h,8ah,7eh
+			db	8bh,42h,1ah,1ch,8eh,a0h,54h,e5h
+			db	cdh,4fh,59h,e3h,14h,5dh,69h,0dh
+			db	1ch,cfh,23h,efh,66h,ffh,3eh,f3h
+			db	7ch,a9h,4eh,5fh,e1h,d0h,afh,e3h
+			db	57h,62h,25h,23h,60h,7dh,f7h,20h
+			db	e8h,afh,4ah,d9h,0bh,cdh,50h,3ch
+			db	4ch,3bh,e1h,8ah,a8h,56h,e0h,29h
+			db	ffh,e5h,97h,5eh,20h,69h,a0h,b9h
+			db	f2h,46h,20h,2dh,b8h,ceh,95h,a1h
+			db	c5h,37h,98h,7ah,07h,f9h,a9h,4eh
+			db	fch,59h,c3h,f7h,04h,aah,cfh,6ch
+			db	28h,cfh,c2h,33h,b6h,f1h,a8h,46h
+			db	55h,0bh,b2h,26h,eah,e4h,d0h,fch
+			db	8fh,2fh,d2h,efh,61h,50h,c2h,7ah
+			db	4ch,5eh,e8h,b9h,1ch,23h,deh,67h
+			db	5ch,78h,a9h,91h,36h,05h,84h,4fh
+			db	6bh,52h,42h,b9h,d5h,bdh,e1h,bah
+			db	37h,69h,14h,cdh,d2h,19h,9fh,86h
+			db	94h,53h,ebh,f8h,f8h,cbh,c4h,68h
+			db	05h,2fh,1fh,76h,05h,2fh,ffh,adh
+			db	96h,ffh,24h,48h,d0h,52h,2dh,54h
+			db	22h,bfh,5eh,8eh,6ah,cch,6dh,8eh
+			db	06h,16h,04h,23h,adh,1bh,66h,61h
+			db	5fh,4ch,abh,52h,eeh,f4h,bdh,55h
+			db	72h,3ah,b2h,10h,64h,05h,2ah,d5h
+			db	69h,3fh,d5h,8bh,a1h,3fh,3bh,e3h
+			db	5bh,87h,72h,1ah,bdh,15h,d4h,d6h
+			db	2ch,dfh,c2h,ebh,0bh,9dh,4bh,37h
+			db	7dh,05h,24h,9bh,97h,07h,25h,64h
+			db	35h,56h,38h,e1h,a1h,e5h,97h,66h
+			db	44h,f4h,e6h,96h,bdh,6ch,c8h,a9h
+			db	26h,98h,91h,0bh,b0h,e9h,25h,83h
+			db	33h,bdh,39h,c2h,4fh,67h,44h,0ch
+			db	3eh,abh,15h,46h,b3h,f3h,93h,49h
+			db	d5h,9fh,e6h,93h,4fh,bfh,87h,1bh
+			db	97h,c3h,6eh,70h,9bh,aah,51h,45h
+			db	a0h,2ch,43h,0ch,97h,c6h,91h,a9h
+			db	2eh,f9h,51h,09h,9bh,d9h,70h,a1h
+			db	40h,97h,b0h,edh,fdh,63h,a1h,5ah
+			db	31h,f1h,27h,74h,76h,e7h,95h,63h
+			db	fbh,13h,18h,e2h,61h,65h,81h,b8h
+			db	7eh,eah,9bh,32h,12h,e3h,80h,31h
+			db	eeh,27h,d1h,bdh,f1h,fah,b0h,9fh
+			db	30h,ach,a2h,91h,54h,56h,24h,b6h
+			db	80h,c3h,30h,7ah,79h,5ah,30h,50h
+			db	2bh,35h,d5h,33h,aah,82h,e8h,cch
+			db	7eh,73h,33h,96h,bdh,64h,2fh,ceh
+			db	55h,f3h,3bh,06h,c0h,1bh,49h,e2h
+			db	cch,9dh,bah,59h,6ah,7eh,8bh,f4h
+			db	dah,c8h,71h,3ch,96h,13h,a7h,c8h
+			db	fdh,0ch,f2h,80h,a7h,7dh,13h,c9h
+			db	0bh,02h,3dh,2dh,93h,edh,ebh,f2h
+			db	28h,4eh,75h,96h,a0h,60h,2ah,96h
+			db	82h,f9h,afh,adh,9fh,cah,3bh,36h
+			db	28h,cch,26h,73h,d5h,73h,afh,eeh
+			db	28h,77h,ceh,80h,5ch,01h,79h,f4h
+			db	eeh,48h,2fh,23h,c4h,aeh,7dh,13h
+			db	93h,37h,95h,69h,90h,7ah,58h,14h
+			db	39h,74h,2dh,08h,8ah,e5h,c5h,c3h
+			db	c5h,2bh,3ah,9eh,60h,2fh,c8h,aeh
+			db	69h,30h,2fh,a3h,e2h,24h,73h,7fh
+			db	dah,1ch,9fh,47h,d4h,4ch,56h,bdh
+			db	0ah,a6h,0ch,c7h,84h,bfh,1eh,92h
+			db	95h,fah,6ah,d1h,f8h,76h,6ch,54h
+			db	abh,75h,ebh,25h,91h,99h,10h,b4h
+			db	3ch,85h,7ah,32h,efh,92h,46h,79h
+			db	8dh,14h,0dh,f6h,36h,33h,46h,30h
+			db	45h,d7h,adh,11h,ddh,f4h,48h,c0h
+			db	a8h,2bh,90h,fdh,f8h,98h,16h,a4h
+			db	83h,98h,3ah,73h,43h,adh,0eh,0ah
+			db	12h,39h,b1h,9bh,54h,84h,09h,9fh
+			db	6fh,c9h,aeh,38h,80h,47h,3ch,ebh
+			db	ebh,99h,b3h,a9h,2eh,01h,67h,f0h
+			db	5eh,c6h,e0h,34h,ach,f0h,94h,3bh
+			db	cah,07h,5dh,2fh,abh,f0h,50h,9bh
+			db	d1h,12h,4bh,93h,2ah,b1h,d4h,0ch
+			db	f6h,afh,d0h,5fh,dch,a8h,3ch,7bh
+			db	56h,b0h,29h,d5h,64h,f3h,5eh,75h
+			db	cdh,1eh,dfh,e5h,c2h,dfh,4eh,95h
+			db	0fh,02h,9fh,01h,08h,c3h,f3h,b2h
+			db	50h,b1h,59h,92h,19h,adh,27h,40h
+			db	88h,06h,23h,5bh,75h,40h,7fh,c1h
+			db	69h,d8h,62h,e5h,99h,1fh,59h,40h
+			db	a3h,60h,46h,aah,57h,34h,9dh,03h
+			db	f7h,b8h,69h,ech,a8h,5fh,cdh,3fh
+			db	30h,76h,fdh,d2h,7fh,27h,4eh,60h
+			db	50h,4ah,bah,efh,c3h,10h,cbh,2eh
+			db	68h,9ah,ddh,9fh,14h,6dh,50h,65h
+			db	3dh,83h,d2h,eeh,dah,e2h,bch,1dh
+			db	74h,5eh,18h,4bh,5bh,81h,71h,5ch
+			db	bbh,b8h,17h,71h,18h,afh,17h,90h
+			db	3bh,15h,c4h,0bh,e7h,43h,36h,50h
+			db	71h,41h,e8h,f9h,a6h,d1h,c5h,3ch
+			db	64h,2eh,17h,32h,88h,04h,20h,3dh
+			db	59h,5bh,58h,6dh,c5h,25h,eah,31h
+			db	e4h,f0h,fch,37h,c7h,06h,68h,e9h
+			db	5fh,19h,2fh,04h,6eh,dch,bfh,64h
+			db	f2h,e6h,4eh,65h,e3h,c5h,1ah,6fh
+			db	2ch,7eh,fah,16h,d7h,b7h,dah,feh
+			db	d2h,c3h,25h,15h,dfh,fch,38h,a0h
+			db	eah,afh,a5h,3bh,63h,e3h,e0h,41h
+			db	15h,c0h,46h,3fh,fbh,7fh,d1h,b7h
+			db	30h,6bh,27h,46h,61h,edh,d0h,98h
+			db	2bh,8bh,ebh,30h,88h,b7h,d0h,94h
+			db	62h,6fh,3bh,23h,e0h,4dh,79h,40h
+			db	beh,7fh,e5h,16h,0fh,53h,7ah,cdh
+			db	dbh,5eh,b7h,f9h,57h,c5h,62h,f9h
+			db	28h,7fh,01h,5fh,f9h,7ch,ddh,54h
+			db	57h,73h,beh,f5h,5dh,80h,7fh,e9h
+			db	a4h,05h,6bh,66h,29h,eeh,8dh,fdh
+			db	37h,85h,9eh,13h,e4h,35h,f7h,04h
+			db	64h,5fh,9ah,31h,ceh,77h,e0h,99h
+			db	0fh,1dh,a9h,20h,c7h,a3h,c5h,a7h
+			db	b5h,cdh,b9h,63h,a7h,61h,e6h,94h
+			db	6ah,deh,e6h,0dh,d3h,f5h,ddh,d5h
+			db	37h,fch,fch,fch,8dh,35h,32h,7bh
+			db	dfh,cch,7ah,dbh,b1h,d0h,b5h,e1h
+			db	8ch,35h,95h,e2h,c2h,3ch,60h,88h
+			db	3ch,b8h,36h,60h,63h,04h,51h,c2h
+			db	4dh,65h,9eh,c4h,25h,59h,84h,43h
+			db	efh,aeh,6bh,dah,7dh,46h,10h,3eh
+			db	deh,f1h,68h,feh,77h,51h,a5h,d7h
+			db	30h,b2h,7fh,45h,8ch,2ch,8bh,36h
+			db	07h,55h,2ch,f8h,a9h,33h,16h,92h
+			db	57h,3ah,9eh,5eh,7ah,1dh,34h,84h
+			db	2ch,b8h,4dh,eeh,71h,91h,d6h,7ah
+			db	f4h,a6h,e7h,b6h,95h,25h,67h,e1h
+			db	f9h,d5h,7ah,e9h,75h,b1h,18h,5ch
+			db	ffh,adh,09h,3eh,63h,e3h,0eh,88h
+			db	24h,97h,b0h,2dh,dfh,dah,a7h,1fh
+			db	6ah,d9h,2ch,22h,77h,14h,d1h,f3h
+			db	7dh,8dh,b2h,22h,aeh,73h,a9h,5fh
+			db	19h,c4h,f9h,70h,25h,67h,d9h,e1h
+			db	87h,11h,5ah,0bh,f9h,03h,5eh,1dh
+			db	f4h,5eh,6dh,d1h,1bh,57h,7bh,a2h
+			db	41h,8dh,e5h,e6h,f0h,89h,04h,4eh
+			db	beh,47h,91h,7ah,30h,55h,cbh,fdh
+			db	a1h,7ah,cch,86h,b1h,12h,e4h,12h
+			db	d0h,48h,18h,89h,b7h,d2h,cfh,25h
+			db	b7h,82h,6fh,1bh,f2h,9dh,bbh,7eh
+			db	8fh,88h,40h,8eh,afh,4ch,8bh,17h
+			db	9dh,36h,6dh,27h,cch,4eh,66h,5eh
+			db	90h,5bh,84h,d5h,b9h,45h,89h,08h
+			db	45h,efh,46h,a4h,a1h,44h,d5h,f5h
+			db	ech,30h,7ch,64h,b8h,06h,29h,5ah
+			db	42h,15h,49h,20h,3ch,2bh,bdh,adh
+			db	19h,26h,6dh,0ah,f8h,14h,22h,f2h
+			db	02h,86h,c9h,eah,70h,a0h,81h,45h
+			db	afh,b4h,ebh,83h,c1h,adh,e0h,eeh
+			db	0ch,3ah,21h,47h,d4h,7bh,d3h,3ch
+			db	f9h,73h,7bh,71h,4dh,38h,89h,edh
+			db	08h,3ch,45h,11h,9bh,e4h,25h,59h
+			db	a0h,a0h,64h,60h,b0h,dah,7ah,85h
+			db	06h,5bh,7ah,bch,7eh,55h,72h,8eh
+			db	18h,4ah,83h,55h,16h,86h,e4h,3fh
+			db	33h,b4h,6bh,dch,f6h,21h,67h,26h
+			db	41h,d9h,04h,beh,f3h,76h,5eh,71h
+			db	feh,30h,9bh,37h,80h,1ah,2bh,95h
+			db	7ch,90h,3dh,09h,0eh,e8h,ceh,f3h
+			db	eah,eah,97h,68h,ffh,55h,04h,7eh
+			db	54h,3fh,e7h,96h,23h,40h,4eh,a7h
+			db	d8h,89h,01h,f3h,b6h,08h,d7h,62h
+			db	3eh,32h,48h,84h,2dh,e3h,bah,bdh
+			db	50h,ffh,49h,3bh,b8h,fah,48h,a0h
+			db	03h,fbh,73h,22h,2ah,71h,3fh,d1h
+			db	ebh,43h,8bh,77h,27h,29h,67h,32h
+			db	1dh,34h,d2h,c0h,40h,29h,c0h,95h
+			db	afh,e7h,5dh,64h,74h,e4h,76h,b4h
+			db	06h,fbh,02h,eeh,b4h,b4h,d5h,dbh
+			db	d4h,78h,ach,b4h,36h,74h,22h,dfh
+			db	89h,7fh,8eh,59h,5dh,e8h,5ah,36h
+			db	74h,a3h,d5h,0bh,51h,ceh,5ch,cdh
+			db	dbh,4eh,98h,a7h,01h,b4h,a9h,e1h
+			db	43h,51h,d4h,cfh,32h,10h,cbh,83h
+			db	a9h,ffh,f8h,e6h,c6h,93h,3fh,a6h
+			db	66h,3ch,a5h,93h,e6h,7ah,d4h,17h
+			db	edh,fah,e8h,88h,f9h,8eh,5bh,b9h
+			db	f3h,9ah,4ah,68h,9ch,5ah,f5h,49h
+			db	2fh,3eh,1ch,72h,b5h,25h,64h,5ch
+			db	b4h,00h,0ch,51h,01h,bch,31h,45h
+			db	a0h,bch,1bh,14h,e9h,3dh,97h,9ch
+			db	c4h,9bh,a0h,5ch,57h,a1h,03h,3ch
+			db	5eh,27h,feh,43h,c9h,10h,f0h,a4h
+			db	5fh,d9h,86h,b6h,ebh,dch,3fh,77h
+			db	03h,cfh,d9h,50h,62h,2ch,83h,11h
+			db	76h,84h,40h,aah,37h,d5h,83h,04h
+			db	45h,0eh,72h,70h,c1h,60h,9fh,87h
+			db	c1h,02h,31h,80h,4bh,dfh,1ah,a8h
+			db	a6h,28h,9dh,cbh,73h,50h,bbh,2eh
+			db	4ch,1ah,9ch,72h,f8h,ffh,d6h,69h
+			db	8ch,a1h,17h,36h,88h,a9h,ceh,f7h
+			db	02h,4eh,50h,a6h,2eh,c8h,f8h,2bh
+			db	d1h,ceh,d3h,ebh,e3h,48h,08h,38h
+			db	00h,3fh,9dh,4eh,2ah,8bh,e6h,80h
+			db	4ch,dah,c9h,36h,2eh,80h,5eh,92h
+			db	d7h,92h,7ah,88h,a4h,a3h,40h,ddh
+			db	8ah,9eh,b9h,6ah,e6h,2fh,7dh,3ch
+			db	79h,bch,06h,a3h,d1h,9dh,a2h,fdh
+			db	a4h,e0h,64h,10h,b5h,96h,e0h,06h
+			db	f2h,1fh,47h,b7h,b9h,7eh,91h,80h
+			db	e1h,23h,e4h,25h,89h,d1h,48h,f5h
+			db	4ah,71h,33h,beh,b5h,b8h,eah,74h
+			db	ech,9ah,78h,97h,59h,31h,81h,30h
+			db	efh,abh,b2h,c5h,7eh,84h,40h,edh
+			db	44h,29h,a6h,c6h,d6h,b8h,3bh,14h
+			db	a2h,91h,3dh,f4h,12h,34h,cbh,aah
+			db	b8h,d0h,94h,8dh,2ah,95h,10h,5fh
+			db	68h,c6h,99h,c5h,35h,c4h,f3h,48h
+			db	50h,b2h,2ch,d4h,48h,f7h,a6h,12h
+			db	e2h,cbh,43h,eah,96h,44h,aeh,26h
+			db	3ch,f5h,9eh,36h,08h,deh,7ah,6eh
+			db	8ch,49h,4ch,f2h,2dh,50h,5ah,f2h
+			db	b0h,55h,c2h,edh,b7h,dbh,8bh,cbh
+			db	cfh,6bh,dfh,22h,14h,dch,3dh,f5h
+			db	efh,15h,e5h,8ah,feh,feh,aah,49h
+			db	36h,22h,91h,c3h,7eh,cdh,a2h,bfh
+			db	a4h,e6h,9fh,1fh,e3h,cah,dah,68h
+			db	3ch,b7h,87h,64h,b7h,80h,44h,e0h
+			db	b2h,45h,89h,f2h,78h,bch,81h,36h
+			db	7ch,5ah,41h,30h,94h,4eh,d6h,9ch
+			db	69h,f7h,e9h,66h,5eh,54h,fdh,c8h
+			db	b1h,a3h,11h,b1h,90h,c3h,91h,1eh
+			db	30h,f8h,ddh,e9h,34h,1fh,5ah,3eh
+			db	52h,bfh,3eh,a9h,08h,1dh,f1h,84h
+			db	d8h,a3h,08h,b5h,6eh,cch,47h,72h
+			db	8eh,f1h,1dh,cbh,d7h,6fh,4fh,4fh
+			db	61h,63h,50h,abh,4ch,02h,6ah,c0h
+			db	68h,6ah,d1h,b1h,19h,77h,d4h,88h
+			db	04h,58h,a7h,4eh,6dh,81h,beh,38h
+			db	6bh,62h,30h,f6h,deh,d0h,1ch,14h
+			db	2ch,42h,c0h,62h,cdh,65h,39h,2fh
+			db	dah,e2h,beh,19h,14h,2dh,a0h,0bh
+			db	0eh,73h,0eh,3bh,a2h,46h,9bh,f8h
+			db	8ah,c4h,f1h,dch,07h,1ah,97h,4ah
+			db	c1h,3fh,9bh,c5h,cfh,b0h,75h,08h
+			db	c1h,1bh,bdh,0bh,fch,f1h,45h,98h
+			db	94h,44h,92h,04h,d2h,ffh,38h,75h
+			db	28h,46h,bah,07h,84h,84h,f2h,dfh
+			db	b0h,eah,dbh,51h,32h,0ah,21h,65h
+			db	20h,91h,e3h,26h,99h,88h,50h,56h
+			db	29h,6bh,84h,fah,61h,00h,c7h,00h
+			db	70h,9fh,23h,4ah,5dh,a1h,41h,f1h
+			db	b1h,12h,39h,1fh,1ah,ach,06h,e5h
+			db	74h,23h,07h,24h,edh,4fh,4ch,43h
+			db	aah,1fh,d3h,60h,e9h,14h,0bh,cah
+			db	dbh,e7h,56h,a8h,4ch,bdh,5ch,edh
+			db	a4h,90h,46h,37h,42h,deh,56h,29h
+			db	9dh,74h,a7h,f5h,46h,cfh,1bh,65h
+			db	cfh,a1h,2ch,2fh,6bh,5dh,feh,60h
+			db	e8h,c3h,a9h,b4h,d7h,c9h,b4h,3eh
+			db	dfh,6fh,80h,fah,bdh,a3h,c2h,52h
+			db	edh,97h,a1h,fbh,ceh,cch,5bh,7fh
+			db	b8h,1eh,dfh,1fh,abh,dch,5dh,83h
+			db	f6h,a6h,2fh,48h,f3h,10h,9fh,92h
+			db	7fh,e1h,d5h,4bh,6eh,bbh,e7h,a8h
+			db	cdh,e5h,feh,46h,93h,71h,cbh,80h
+			db	afh,83h,2dh,f9h,e3h,6eh,ddh,5bh
+			db	9ch,6bh,78h,35h,fch,20h,a7h,45h
+			db	cah,4ah,46h,04h,ach,a6h,78h,6fh
+			db	98h,73h,b3h,abh,84h,21h,1dh,dfh
+			db	dch,0dh,55h,2bh,23h,b2h,27h,26h
+			db	cbh,f7h,b3h,22h,bbh,20h,66h,82h
+			db	f4h,2ch,7ah,24h,cah,92h,cfh,94h
+			db	9eh,9eh,f8h,49h,12h,08h,41h,78h
+			db	9bh,3ah,c7h,b8h,f8h,7dh,d8h,f5h
+			db	4ah,5ch,84h,3fh,aah,7fh,e2h,4ah
+			db	d6h,9dh,43h,4dh,92h,04h,86h,50h
+			db	14h,0bh,71h,7ah,3ah,b0h,a1h,fah
+			db	6ah,68h,c6h,10h,45h,9ch,deh,07h
+			db	86h,f5h,1ah,cfh,6bh,d8h,9eh,14h
+			db	d6h,f2h,b2h,09h,e3h,87h,fdh,fbh
+			db	9dh,a7h,b7h,54h,82h,6bh,24h,89h
+			db	dch,72h,bah,0dh,0ah,87h,4bh,f1h
+			db	a4h,feh,11h,bbh,a5h,80h,c4h,b1h
+			db	95h,b6h,26h,a9h,22h,78h,67h,19h
+			db	4bh,1eh,beh,5ch,1fh,87h,16h,9bh
+			db	7eh,65h,48h,14h,c3h,37h,04h,97h
+			db	79h,94h,94h,43h,d0h,43h,a6h,43h
+			db	ffh,a7h,51h,c8h,43h,4bh,f3h,17h
+			db	10h,22h,cdh,97h,1dh,01h,dfh,cch
+			db	9ah,7ah,c5h,e9h,6ch,69h,6eh,70h
+			db	edh,95h,dch,edh,3dh,e0h,45h,a0h
+			db	06h,19h,77h,dah,79h,2fh,c6h,a5h
+			db	a3h,05h,60h,f0h,6ah,72h,c9h,07h
+			db	75h,04h,e1h,68h,35h,80h,58h,4eh
+			db	1bh,6dh,ddh,c2h,37h,49h,e6h,0ch
+			db	a4h,61h,b6h,66h,2ah,84h,bch,52h
+			db	7ch,1dh,68h,f9h,edh,96h,fdh,8eh
+			db	74h,4fh,5fh,e9h,d5h,60h,56h,e3h
+			db	62h,eah,a6h,9ah,ffh,0eh,78h,a1h
+			db	edh,8ch,95h,7dh,e2h,c0h,0ch,43h
+			db	46h,36h,d6h,4dh,23h,bdh,3ah,30h
+			db	f0h,feh,bfh,fah,5ch,95h,82h,a0h
+			db	50h,bfh,1dh,e8h,86h,3fh,b2h,5eh
+			db	0fh,87h,d5h,c9h,d9h,37h,8bh,25h
+			db	76h,c5h,65h,dah,dfh,e6h,05h,9ch
+			db	65h,69h,c1h,bah,a1h,b1h,94h,d5h
+			db	39h,a8h,59h,c1h,72h,b1h,e8h,3eh
+			db	38h,abh,efh,83h,46h,fch,bdh,25h
+			db	f8h,2dh,c9h,a9h,80h,62h,20h,06h
+			db	aah,09h,53h,37h,36h,a4h,b3h,6dh
+			db	1ah,33h,0eh,d5h,aah,e9h,2fh,d1h
+			db	fdh,65h,b8h,3ah,4ch,66h,64h,c5h
+			db	13h,3ah,6dh,5ah,05h,26h,a1h,18h
+			db	13h,ffh,c3h,e3h,8fh,72h,26h,3ch
+			db	e7h,1ch,d6h,b6h,7eh,65h,0ah,beh
+			db	09h,f1h,5ah,dfh,46h,56h,e2h,88h
+			db	1dh,e5h,d9h,ddh,ddh,1dh,7dh,14h
+			db	59h,1ch,16h,42h,87h,24h,a3h,7ch
+			db	9bh,e2h,d6h,61h,beh,bah,c6h,d2h
+			db	66h,fbh,e5h,7ch,d8h,e2h,b0h,6bh
+			db	06h,46h,b3h,95h,95h,ach,b5h,97h
+			db	57h,7fh,1bh,02h,b5h,dbh,3eh,e7h
+			db	1eh,b9h,f6h,1fh,d3h,44h,afh,86h
+			db	c5h,3dh,16h,2dh,b8h,61h,d2h,dfh
+			db	55h,9bh,e1h,88h,09h,feh,1ch,81h
+			db	e6h,a0h,9eh,2ch,34h,4ah,d6h,62h
+			db	0bh,91h,5ch,ddh,48h,18h,43h,91h
+			db	ffh,abh,6ch,42h,98h,75h,7fh,87h
+			db	20h,03h,7fh,2bh,7ah,a5h,16h,a9h
+			db	f7h,ebh,48h,3ch,3ah,00h,0ch,aeh
+			db	ddh,e1h,1fh,31h,6bh,9ch,8dh,4dh
+			db	1fh,2ch,f5h,35h,72h,efh,cch,d8h
+			db	4eh,17h,85h,deh,d5h,e2h,a2h,19h
+			db	02h,11h,fbh,7ch,efh,40h,96h,c9h
+			db	05h,e5h,7bh,04h,8dh,9ch,94h,eeh
+			db	dah,e6h,33h,2ah,aah,68h,2eh,06h
+			db	80h,8fh,75h,03h,5fh,45h,1ch,53h
+			db	a9h,b1h,83h,39h,c8h,6eh,10h,43h
+			db	3bh,0ch,c4h,1bh,e1h,a8h,83h,a0h
+			db	65h,17h,07h,9fh,f1h,9eh,f7h,f9h
+			db	d7h,3ch,8eh,01h,b9h,e6h,e9h,8bh
+			db	bbh,5ah,d2h,a3h,aah,11h,17h,3ah
+			db	0fh,74h,eeh,52h,99h,e2h,75h,a3h
+			db	b4h,0ah,0eh,b9h,47h,12h,22h,f7h
+			db	e3h,3ah,e0h,87h,b2h,47h,6dh,46h
+			db	7bh,fch,f9h,f7h,6ch,2bh,0ch,7ch
+			db	70h,19h,a0h,b8h,3bh,92h,c2h,77h
+			db	5fh,7dh,55h,d4h,35h,14h,80h,e0h
+			db	6bh,49h,92h,bah,5ch,82h,9dh,edh
+			db	47h,4ch,dbh,c9h,57h,ebh,32h,43h
+			db	a8h,b0h,5ah,adh,45h,4ah,beh,30h
+			db	26h,f8h,6ch,a6h,bdh,59h,9dh,8dh
+			db	c7h,6ch,67h,d0h,7bh,1ch,0eh,10h
+			db	ceh,fch,40h,ddh,89h,92h,4bh,cah
+			db	16h,80h,c1h,4ch,4fh,88h,41h,2fh
+			db	64h,1dh,65h,6ch,9eh,f2h,33h,49h
+			db	03h,e0h,b9h,cfh,ffh,87h,5ah,00h
+			db	c0h,7bh,ech,99h,e1h,cah,beh,47h
+			db	32h,bah,b9h,93h,c1h,76h,f2h,9ch
+			db	9fh,59h,5dh,2ah,92h,f1h,62h,84h
+			db	27h,4ch,d3h,b4h,47h,26h,6eh,8ch
+			db	9dh,7bh,dch,11h,3bh,e5h,36h,feh
+			db	9eh,08h,57h,2ah,3bh,43h,bbh,82h
+			db	f9h,82h,2eh,9ch,aah,98h,1eh,34h
+			db	8eh,51h,07h,6fh,4bh,29h,94h,9eh
+			db	1ah,d7h,dbh,afh,bdh,61h,30h,fbh
+			db	4bh,5fh,dbh,37h,aeh,2dh,71h,1bh
+			db	81h,a1h,dch,29h,3bh,bfh,5dh,00h
+			db	f2h,54h,bfh,14h,7bh,43h,f2h,fbh
+			db	2ch,ddh,d0h,24h,8bh,5ch,71h,e5h
+			db	dbh,07h,5bh,95h,c7h,3ch,edh,d8h
+			db	65h,fbh,a0h,67h,3ch,2dh,15h,24h
+			db	feh,85h,d0h,3dh,8ah,7ch,adh,ebh
+			db	54h,d6h,73h,4ch,04h,26h,3ah,78h
+			db	5eh,d5h,31h,9eh,97h,f4h,e0h,35h
+			db	dch,7fh,70h,67h,4dh,27h,2ah,4fh
+			db	6bh,cfh,b5h,2ah,bfh,cbh,74h,64h
+			db	92h,18h,4ah,26h,35h,8ch,cfh,7dh
+			db	96h,00h,3bh,18h,7eh,79h,1fh,6fh
+			db	1ah,94h,62h,14h,19h,02h,9dh,41h
+			db	0bh,3ch,9fh,adh,80h,23h,6ah,71h
+			db	7fh,dah,aah,38h,e6h,3ch,09h,f1h
+			db	48h,eeh,eah,30h,ffh,4bh,07h,a9h
+			db	8dh,d0h,5bh,f6h,50h,dfh,dah,bah
+			db	04h,60h,1dh,e1h,55h,6bh,70h,57h
+			db	c6h,3ch,51h,94h,79h,21h,f9h,79h
+			db	53h,f9h,62h,ceh,cch,20h,a7h,28h
+			db	c5h,52h,7dh,ddh,a4h,c9h,adh,a5h
+			db	0fh,eah,aeh,d3h,aah,fah,13h,f0h
+			db	f0h,d6h,24h,9ah,53h,27h,f7h,0dh
+			db	62h,c8h,83h,83h,93h,4ah,a8h,bbh
+			db	cch,fch,73h,b2h,dbh,f0h,48h,ceh
+			db	67h,a6h,81h,02h,f2h,3dh,aah,62h
+			db	f0h,bah,f6h,89h,c0h,aeh,07h,9ah
+			db	06h,99h,c4h,15h,72h,89h,bdh,88h
+			db	fbh,8bh,1ch,c0h,8ah,44h,b2h,26h
+			db	55h,b0h,35h,72h,42h,aah,76h,e9h
+			db	0ch,94h,dah,5bh,01h,9ch,8fh,4dh
+			db	0bh,d1h,d6h,92h,bdh,f6h,8dh,dch
+			db	4fh,f4h,65h,22h,b0h,30h,c6h,57h
+			db	f1h,8fh,35h,28h,7ch,dah,e4h,c3h
+			db	29h,11h,42h,76h,c2h,0bh,34h,d2h
+			db	81h,f7h,21h,eeh,afh,8eh,2ah,6ch
+			db	00h,2dh,73h,f2h,96h,bdh,80h,86h
+			db	f1h,c6h,4eh,3eh,60h,4dh,2eh,f7h
+			db	f6h,bah,85h,59h,2bh,3fh,ddh,cbh
+			db	89h,f2h,85h,08h,14h,efh,d4h,cdh
+			db	b5h,42h,5ah,06h,7fh,3ah,b8h,38h
+			db	b5h,28h,6bh,81h,96h,73h,f6h,6dh
+			db	3ah,58h,eeh,f0h,18h,84h,a6h,2eh
+			db	7ah,10h,53h,1bh,8dh,74h,40h,1fh
+			db	93h,e2h,0bh,35h,46h,b0h,5fh,8bh
+			db	2ah,23h,86h,adh,ach,e7h,c5h,00h
+			db	aeh,15h,c0h,5ch,12h,78h,53h,a4h
+			db	f6h,06h,bch,7fh,feh,48h,69h,06h
+			db	b8h,60h,e0h,8fh,34h,55h,03h,2eh
+			db	c6h,04h,f8h,fdh,40h,34h,4fh,0dh
+			db	b3h,49h,0ch,73h,22h,2ah,00h,cfh
+			db	01h,8ah,9ah,32h,75h,fdh,5bh,09h
+			db	99h,b3h,ebh,8eh,6eh,32h,04h,beh
+			db	79h,07h,bfh,48h,2dh,aeh,58h,6bh
+			db	1eh,2eh,7fh,03h,00h,42h,99h,67h
+			db	b6h,48h,4eh,c6h,6fh,6bh,0fh,21h
+			db	a4h,2ah,55h,abh,1bh,aeh,a1h,d7h
+			db	31h,82h,09h,17h,26h,22h,91h,3bh
+			db	5ah,30h,29h,04h,c0h,0dh,67h,ddh
+			db	b6h,b4h,68h,61h,c4h,54h,54h,90h
+			db	7fh,29h,e7h,f9h,0dh,ffh,f4h,ech
+			db	03h,c3h,0eh,b5h,dfh,b4h,a2h,a9h
+			db	76h,01h,0fh,dah,c7h,67h,10h,cch
+			db	e7h,32h,4fh,29h,6ch,8eh,5eh,88h
+			db	5eh,72h,5eh,feh,96h,c9h,b6h,ach
+			db	36h,b7h,c1h,e7h,b3h,58h,51h,5ch
+			db	e5h,b3h,0bh,dbh,f4h,2ch,eeh,cbh
+			db	6eh,00h,1ah,0dh,7bh,1bh,cbh,46h
+			db	5eh,81h,60h,64h,abh,a5h,d8h,8ch
+			db	1ch,36h,abh,e3h,cbh,9fh,b2h,e6h
+			db	0bh,77h,adh,31h,67h,14h,bch,b9h
+			db	a9h,cbh,b2h,afh,9ch,e7h,d0h,c2h
+			db	6dh,1ah,a1h,40h,96h,6eh,21h,5ah
+			db	4fh,e6h,15h,7dh,42h,b2h,b8h,7eh
+			db	1eh,9ah,20h,19h,80h,82h,82h,37h
+			db	b9h,76h,7ch,cbh,18h,a8h,c4h,c5h
+			db	a3h,86h,15h,a4h,fdh,efh,25h,6fh
+			db	62h,85h,1eh,8eh,8dh,61h,e4h,cah
+			db	1dh,2eh,48h,8dh,9dh,a0h,ach,0ch
+			db	9bh,6fh,28h,1dh,82h,efh,4ah,19h
+			db	a8h,41h,9ah,97h,26h,66h,09h,0bh
+			db	39h,5fh,37h,9ch,22h,99h,7ch,b5h
+			db	8eh,33h,66h,4fh,fah,cah,45h,70h
+			db	39h,f9h,5bh,f9h,7eh,14h,b9h,25h
+			db	e2h,9ah,6eh,45h,adh,10h,dfh,69h
+			db	c6h,69h,32h,54h,29h,37h,ddh,53h
+			db	c1h,48h,20h,68h,e8h,54h,51h,05h
+			db	ddh,d3h,40h,46h,c6h,2ah,1dh,6ch
+			db	0bh,ach,e2h,8ah,36h,10h,dfh,5fh
+			db	ffh,e9h,c1h,f6h,c0h,7ah,54h,32h
+			db	49h,4fh,24h,dch,12h,2ah,95h,22h
+			db	9ch,51h,34h,63h,d2h,b2h,11h,7ch
+			db	c4h,39h,7fh,0eh,71h,64h,5ch,c6h
+			db	39h,d6h,1ch,4dh,a0h,27h,20h,0fh
+			db	fdh,7fh,5dh,5fh,fdh,e1h,6fh,eah
+			db	01h,ach,8ah,35h,18h,7eh,f2h,1eh
+			db	96h,0dh,31h,d6h,cah,88h,a9h,0ah
+			db	58h,6bh,37h,50h,29h,beh,30h,ceh
+			db	b8h,79h,a0h,bfh,04h,d3h,c6h,06h
+			db	bbh,ffh,f2h,b9h,0bh,7bh,83h,59h
+			db	9fh,9eh,a2h,83h,6ch,ceh,c1h,85h
+			db	19h,adh,9ah,cdh,53h,10h,15h,0eh
+			db	9fh,9ah,89h,12h,5ch,a7h,d0h,afh
+			db	55h,6fh,a3h,b0h,02h,6eh,64h,24h
+			db	8dh,9ch,0eh,dfh,b3h,87h,7eh,42h
+			db	35h,6eh,4ch,6ch,77h,0bh,a4h,57h
+			db	cch,a7h,92h,41h,e4h,e0h,7fh,d7h
+			db	c8h,3ch,1ch,a0h,aah,60h,31h,b3h
+			db	dfh,6ah,b4h,c8h,edh,feh,27h,2bh
+			db	8ah,abh,09h,51h,ebh,3bh,74h,f3h
+			db	adh,81h,1fh,0ch,f4h,d3h,6ch,f0h
+			db	2dh,f2h,6bh,4dh,67h,67h,e4h,78h
+			db	f1h,87h,4eh,72h,e1h,ceh,70h,85h
+			db	ffh,f7h,e4h,08h,53h,0dh,c5h,d1h
+			db	81h,1dh,53h,c3h,1eh,63h,50h,b9h
+			db	24h,d3h,a6h,20h,84h,31h,35h,deh
+			db	55h,e2h,bfh,46h,89h,85h,f6h,7dh
+			db	14h,86h,94h,deh,1fh,dbh,b6h,1bh
+			db	17h,5ch,44h,07h,a8h,03h,96h,a6h
+			db	56h,91h,3bh,00h,35h,b1h,19h,f9h
+			db	6bh,aeh,cdh,80h,eah,53h,54h,0bh
+			db	14h,83h,88h,20h,37h,8fh,c7h,bdh
+			db	adh,d0h,1eh,f2h,a6h,7ah,70h,9eh
+			db	3bh,1ch,57h,41h,99h,31h,d7h,61h
+			db	dfh,58h,55h,0fh,1bh,3eh,9fh,60h
+			db	fah,55h,8ch,2fh,67h,32h,ceh,93h
+			db	cah,51h,4ah,8fh,e4h,7dh,13h,8fh
+			db	7fh,f2h,ddh,72h,56h,1eh,07h,7fh
+			db	98h,43h,14h,dbh,73h,63h,48h,dah
+			db	cah,bfh,adh,adh,36h,34h,53h,f4h
+			db	8dh,b7h,e8h,2eh,f0h,ach,7dh,c3h
+			db	91h,d2h,01h,25h,98h,78h,01h,9bh
+			db	2ch,34h,d5h,c3h,feh,38h,c7h,61h
+			db	60h,b8h,ddh,28h,06h,15h,31h,21h
+			db	edh,ddh,b6h,4fh,dah,f8h,a3h,bdh
+			db	e0h,0ah,f8h,0ch,3bh,9ah,95h,19h
+			db	3dh,ebh,39h,3ch,19h,aeh,67h,81h
+			db	f1h,8dh,54h,a3h,26h,aah,03h,f1h
+			db	a6h,b8h,04h,ach,67h,22h,33h,25h
+			db	33h,75h,83h,25h,58h,3ch,1ah,73h
+			db	e0h,1fh,ebh,67h,81h,fbh,65h,05h
+			db	82h,8ah,3bh,25h,3eh,cfh,8ah,98h
+			db	bfh,98h,11h,dfh,cch,15h,ceh,e4h
+			db	45h,1eh,0ch,72h,adh,18h,b0h,73h
+			db	b2h,edh,dfh,2eh,77h,5eh,f8h,a8h
+			db	dbh,88h,a5h,2ch,43h,90h,1ch,fbh
+			db	f9h,93h,ach,71h,47h,23h,feh,54h
+			db	53h,00h,55h,0bh,e0h,72h,5ch,42h
+			db	c2h,e5h,4bh,5dh,a1h,3dh,30h,90h
+			db	f2h,73h,f2h,ddh,4fh,7bh,4eh,d1h
+			db	6fh,dfh,feh,41h,76h,48h,cfh,e1h
+			db	49h,e8h,deh,7bh,f4h,c7h,83h,45h
+			db	0bh,13h,0ah,66h,68h,29h,78h,f9h
+			db	bbh,9ah,00h,b3h,9fh,5dh,63h,a0h
+			db	efh,8eh,72h,4ah,10h,30h,1fh,36h
+			db	b9h,4ch,76h,d9h,29h,90h,69h,3eh
+			db	e8h,ach,d2h,7ch,b1h,49h,04h,24h
+			db	a4h,d7h,44h,8dh,78h,5fh,5fh,d1h
+			db	fbh,ach,a0h,dfh,12h,14h,9ch,4bh
+			db	03h,82h,04h,62h,fah,27h,dbh,12h
+			db	37h,0bh,9fh,39h,beh,4ah,d8h,c6h
+			db	97h,10h,fdh,bah,84h,99h,8eh,8dh
+			db	c6h,bch,30h,9dh,a0h,cah,03h,81h
+			db	bch,f5h,ddh,33h,bbh,ach,cbh,84h
+			db	12h,96h,73h,b1h,34h,cdh,24h,3bh
+			db	07h,a7h,71h,eah,62h,2bh,d5h,a5h
+			db	61h,35h,77h,abh,6ah,74h,51h,6bh
+			db	d9h,4dh,4bh,46h,9ah,c8h,07h,68h
+			db	deh,7fh,8dh,0bh,c5h,37h,02h,49h
+			db	e7h,5dh,75h,c9h,03h,06h,cch,a5h
+			db	96h,58h,a4h,d0h,eah,a5h,9ah,afh
+			db	58h,0eh,beh,32h,5ch,d8h,a4h,1fh
+			db	a2h,98h,1fh,4ah,07h,1fh,01h,eah
+			db	a5h,c5h,7dh,b3h,90h,84h,02h,52h
+			db	29h,f0h,4eh,46h,b2h,49h,63h,07h
+			db	89h,00h,23h,e0h,20h,10h,35h,fah
+			db	33h,20h,d7h,97h,e3h,4eh,37h,b4h
+			db	82h,a2h,d3h,d0h,ach,91h,1fh,15h
+			db	33h,f7h,beh,38h,43h,8fh,aah,b0h
+			db	4bh,4ch,efh,c6h,46h,80h,9ch,06h
+			db	91h,6ch,4ch,9bh,62h,fdh,5dh,fbh
+			db	afh,4dh,e9h,5bh,f1h,80h,16h,03h
+			db	07h,94h,aah,d5h,f5h,f6h,d3h,0dh
+			db	67h,f3h,88h,85h,48h,1fh,e7h,b2h
+			db	81h,c8h,d2h,1dh,5ah,2bh,8ah,45h
+			db	d9h,6ch,47h,71h,2eh,31h,e0h,f7h
+			db	b8h,03h,9eh,ach,64h,68h,bch,50h
+			db	4bh,40h,f1h,fbh,f6h,3eh,08h,2eh
+			db	25h,52h,8fh,6fh,04h,99h,14h,07h
+			db	5ah,a6h,06h,40h,50h,60h,2ah,29h
+			db	f7h,cbh,b0h,51h,d1h,14h,1ah,94h
+			db	89h,7bh,93h,7dh,a1h,a3h,34h,0ah
+			db	42h,2bh,a5h,28h,4eh,08h,6eh,f1h
+			db	d6h,77h,1dh,87h,9ah,b8h,3ch,2ch
+			db	50h,a4h,4bh,fah,41h,c7h,d3h,4ah
+			db	51h,07h,99h,87h,11h,f5h,12h,11h
+			db	3eh,2dh,f5h,4ah,2ch,25h,e7h,b7h
+			db	d5h,2dh,4bh,24h,82h,dfh,deh,79h
+			db	43h,55h,04h,feh,46h,f7h,7ah,20h
+			db	88h,bah,81h,e1h,eah,36h,38h,efh
+			db	dch,d0h,e4h,0ch,c3h,5bh,23h,d6h
+			db	14h,25h,1eh,9dh,dch,62h,f8h,33h
+			db	0ch,67h,eeh,08h,e9h,e9h,2bh,67h
+			db	65h,23h,94h,f4h,91h,f1h,abh,b3h
+			db	67h,f2h,53h,d0h,dch,d8h,48h,98h
+			db	36h,08h,05h,98h,0bh,b6h,2ch,a3h
+			db	b0h,45h,5bh,d5h,a8h,58h,c2h,6fh
+			db	a2h,67h,a2h,52h,53h,bah,abh,97h
+			db	22h,46h,e9h,e1h,70h,9fh,9dh,aah
+			db	19h,6eh,7dh,d0h,6ch,c1h,98h,91h
+			db	a2h,66h,7ch,35h,99h,61h,23h,d2h
+			db	dch,c9h,8bh,1ah,33h,eah,c6h,1dh
+			db	83h,afh,3eh,76h,28h,dch,bdh,f8h
+			db	35h,a0h,20h,04h,13h,2fh,70h,d7h
+			db	99h,56h,efh,beh,53h,1fh,a4h,7fh
+			db	e9h,07h,a8h,9ch,c5h,c6h,90h,98h
+			db	eah,0fh,7ah,adh,8fh,46h,e4h,42h
+			db	26h,48h,8dh,7ch,48h,91h,3ch,5ah
+			db	a2h,5dh,dbh,aah,92h,6ch,c6h,c2h
+			db	6fh,5eh,08h,37h,00h,82h,84h,e7h
+			db	1ah,b4h,d5h,0ah,bfh,f1h,e1h,b3h
+			db	38h,41h,6eh,ebh,b3h,7dh,c2h,d5h
+			db	7ah,e1h,4dh,f6h,5bh,d7h,98h,25h
+			db	c5h,e0h,d6h,d7h,dbh,99h,b8h,e2h
+			db	58h,8ch,d4h,a9h,79h,6bh,36h,0fh
+			db	0ah,2dh,feh,d3h,a3h,4ah,09h,75h
+			db	e4h,a1h,6ch,cdh,dah,9dh,20h,13h
+			db	95h,34h,0ah,1eh,32h,6ch,56h,e3h
+			db	6fh,bch,bdh,6eh,c0h,6bh,41h,98h
+			db	d7h,98h,f0h,1ch,96h,b2h,61h,91h
+			db	88h,73h,15h,0eh,20h,53h,b4h,70h
+			db	11h,06h,6fh,36h,60h,27h,14h,c4h
+			db	fch,d4h,dfh,00h,a6h,4dh,75h,edh
+			db	edh,fch,59h,59h,aeh,53h,ebh,7ch
+			db	8ch,0eh,fbh,49h,b1h,a5h,f3h,73h
+			db	f1h,8bh,f8h,afh,a2h,aeh,d2h,90h
+			db	1dh,0bh,e3h,74h,22h,b2h,6ch,97h
+			db	32h,bdh,7fh,b1h,35h,11h,0eh,71h
+			db	1fh,fbh,23h,fah,2bh,9fh,0eh,81h
+			db	b5h,0ah,60h,03h,8ch,13h,f0h,feh
+			db	b2h,e0h,6bh,a2h,c2h,3ah,30h,83h
+			db	55h,2dh,dfh,1ch,f0h,0eh,82h,7ch
+			db	aah,fdh,7ch,04h,f9h,18h,72h,78h
+			db	95h,57h,19h,49h,37h,26h,56h,a4h
+			db	86h,52h,5dh,02h,a4h,81h,3eh,23h
+			db	aeh,6ah,99h,7ch,afh,72h,55h,3dh
+			db	beh,e3h,29h,74h,33h,10h,eah,0dh
+			db	5fh,8dh,0fh,f7h,e1h,0fh,3eh,edh
+			db	2fh,6fh,83h,15h,dfh,ach,8ch,bah
+			db	f3h,45h,08h,d0h,8fh,97h,33h,0bh
+			db	7ch,20h,22h,4dh,f5h,fbh,93h,60h
+			db	62h,36h,eeh,08h,2bh,17h,c7h,9bh
+			db	61h,d8h,8ah,bfh,cch,14h,bch,99h
+			db	a0h,5ch,16h,3fh,68h,5bh,6ah,4eh
+			db	c2h,b8h,6fh,83h,79h,93h,c5h,d6h
+			db	bah,4eh,9dh,c4h,33h,6bh,35h,5ch
+			db	1ch,beh,fah,45h,69h,a4h,30h,c2h
+			db	6ch,01h,26h,a6h,a1h,23h,2eh,ach
+			db	61h,15h,b9h,f2h,66h,73h,34h,01h
+			db	55h,7bh,07h,68h,d2h,c3h,7ah,0eh
+			db	d4h,59h,beh,00h,9ah,e5h,7dh,88h
+			db	90h,f8h,6eh,33h,edh,f7h,99h,d3h
+			db	34h,a8h,75h,c7h,5eh,b0h,24h,7dh
+			db	24h,adh,d3h,e3h,dfh,9ah,08h,31h
+			db	51h,ebh,8ch,e1h,2eh,abh,c7h,5ah
+			db	99h,62h,1fh,19h,d3h,e5h,66h,ebh
+			db	d2h,b6h,0dh,c4h,d1h,d2h,16h,d3h
+			db	ffh,0fh,2bh,fah,65h,50h,18h,49h
+			db	93h,a3h,57h,9bh,47h,27h,ddh,42h
+			db	85h,2bh,d4h,47h,e4h,adh,d3h,5ah
+			db	a6h,74h,b8h,1dh,72h,7ch,11h,04h
+			db	02h,59h,29h,6bh,d8h,3eh,e0h,f1h
+			db	bfh,cch,4ah,88h,08h,a0h,40h,53h
+			db	91h,f6h,21h,58h,e5h,8dh,69h,d4h
+			db	32h,edh,b4h,72h,a9h,9fh,a4h,8dh
+			db	bah,25h,c3h,51h,7ch,bfh,59h,f5h
+			db	e2h,e7h,3dh,deh,c8h,beh,5fh,d1h
+			db	52h,b3h,feh,eeh,dfh,c5h,21h,c4h
+			db	5fh,2ah,99h,9dh,fbh,fbh,65h,98h
+			db	3ah,9fh,dch,bch,d6h,3dh,61h,46h
+			db	e0h,81h,76h,c9h,11h,48h,c4h,23h
+			db	bfh,c7h,b5h,ebh,5dh,08h,35h,99h
+			db	cch,79h,77h,c7h,5eh,88h,9bh,6ah
+			db	dfh,f4h,7ch,d1h,34h,6fh,b4h,2eh
+			db	35h,5eh,6bh,eeh,d2h,deh,e2h,c8h
+			db	24h,39h,19h,35h,bfh,9eh,a3h,0dh
+			db	e3h,f6h,4fh,e6h,5ch,e3h,feh,01h
+			db	abh,99h,d1h,42h,97h,c7h,cfh,ebh
+			db	b4h,8ah,2ah,71h,93h,55h,5bh,2bh
+			db	f9h,03h,3fh,48h,60h,66h,30h,bdh
+			db	5eh,5eh,66h,deh,8dh,12h,34h,5eh
+			db	4ch,58h,54h,a8h,1dh,7dh,9bh,3eh
+			db	30h,bfh,6eh,73h,26h,85h,e8h,71h
+			db	89h,5dh,90h,29h,bdh,d3h,a6h,f9h
+			db	a9h,c5h,b4h,4eh,31h,22h,00h,9ah
+			db	dfh,6dh,59h,bch,d8h,94h,32h,b5h
+			db	01h,b8h,8fh,99h,62h,77h,17h,d4h
+			db	71h,d3h,eah,0ch,5dh,30h,27h,bfh
+			db	e2h,ebh,42h,62h,0ch,e2h,15h,54h
+			db	8ch,f9h,efh,efh,1ch,b9h,8dh,56h
+			db	4eh,65h,e3h,58h,65h,40h,b9h,b9h
+			db	a7h,67h,03h,27h,53h,beh,beh,46h
+			db	9ch,c6h,9fh,2bh,f9h,8eh,b7h,e7h
+			db	31h,41h,18h,c8h,9ah,93h,0bh,c7h
+			db	26h,a2h,72h,a0h,07h,83h,dbh,4dh
+			db	b9h,d6h,cch,d8h,7fh,c3h,06h,5fh
+			db	8eh,55h,1eh,d0h,2ch,d4h,35h,1fh
+			db	80h,cah,2ah,a7h,71h,05h,9dh,69h
+			db	9eh,c2h,b3h,bah,3eh,f4h,d0h,bch
+			db	47h,6bh,efh,eah,92h,75h,99h,15h
+			db	68h,a6h,69h,e0h,95h,70h,07h,42h
+			db	f6h,a1h,0fh,81h,a0h,59h,62h,dfh
+			db	69h,07h,7eh,49h,33h,d9h,93h,2eh
+			db	fbh,c4h,08h,37h,a9h,f6h,4ah,4dh
+			db	9ah,83h,3eh,bah,52h,76h,28h,0fh
+			db	a1h,4ah,4bh,39h,e1h,edh,8fh,3dh
+			db	46h,eah,0bh,a8h,9ah,74h,50h,eah
+			db	06h,5dh,4eh,37h,36h,bah,57h,5bh
+			db	d1h,01h,deh,42h,76h,6fh,33h,37h
+			db	7eh,5ah,bbh,5eh,c6h,3fh,23h,f4h
+			db	e8h,a8h,c6h,c1h,1dh,8dh,cch,03h
+			db	80h,7fh,ceh,25h,d2h,53h,3ah,b1h
+			db	b4h,ffh,b8h,54h,6fh,67h,33h,58h
+			db	b6h,77h,47h,e9h,c3h,e5h,efh,02h
+			db	25h,20h,50h,63h,0bh,f7h,9bh,8ch
+			db	1eh,fah,e4h,0ch,4eh,f7h,1ch,e0h
+			db	9ch,ech,8ah,1fh,80h,9dh,1fh,41h
+			db	5fh,23h,b6h,7ch,10h,29h,28h,09h
+			db	0eh,1eh,9ch,11h,59h,f7h,45h,80h
+			db	a3h,76h,0fh,33h,58h,c9h,12h,55h
+			db	39h,91h,e9h,cch,8bh,d7h,0bh,88h
+			db	5eh,6ah,7eh,35h,5fh,b6h,aeh,2dh
+			db	b4h,04h,cah,96h,aeh,7fh,22h,c9h
+			db	69h,b8h,c3h,b5h,c2h,73h,36h,78h
+			db	53h,68h,90h,37h,a1h,43h,37h,a8h
+			db	59h,5fh,c9h,36h,ebh,8ah,28h,f2h
+			db	66h,dfh,60h,35h,53h,97h,3dh,bfh
+			db	85h,1ch,20h,9ch,c7h,8bh,bfh,46h
+			db	f4h,b1h,d5h,69h,cch,72h,11h,16h
+			db	cbh,cdh,24h,41h,6eh,19h,15h,fbh
+			db	ffh,b8h,e3h,cah,cbh,70h,05h,d6h
+			db	20h,ebh,06h,e3h,b9h,52h,4bh,36h
+			db	a8h,12h,44h,b5h,55h,36h,2ch,00h
+			db	74h,c1h,86h,88h,e6h,43h,91h,91h
+			db	02h,98h,66h,26h,4ch,0fh,abh,6eh
+			db	9fh,95h,1bh,53h,d8h,03h,65h,fdh
+			db	dah,afh,e6h,e3h,9fh,31h,0ah,29h
+			db	64h,21h,6eh,b9h,4ch,1fh,fdh,54h
+			db	0ah,cbh,1bh,88h,33h,cbh,40h,00h
+			db	42h,89h,c4h,98h,32h,31h,65h,f8h
+			db	01h,10h,b0h,7bh,bah,1bh,51h,22h
+			db	c6h,e0h,7ch,dfh,8ch,82h,b9h,02h
+			db	1ah,52h,8bh,9fh,65h,dah,72h,d9h
+			db	a5h,04h,0fh,35h,4eh,0eh,46h,33h
+			db	69h,52h,d2h,ebh,f8h,a8h,a8h,2fh
+			db	4ch,84h,5ah,bdh,79h,15h,c3h,a4h
+			db	39h,6ch,59h,d7h,56h,9ch,4ah,72h
+			db	85h,33h,c8h,43h,8ch,3ah,beh,8bh
+			db	13h,20h,8ch,67h,fdh,dbh,3bh,40h
+			db	76h,e5h,6eh,7ch,8ah,d5h,dbh,c5h
+			db	7bh,85h,bdh,f1h,99h,fah,7ah,f7h
+			db	70h,c1h,92h,a1h,93h,2dh,1bh,6eh
+			db	a6h,87h,bah,88h,8ch,f0h,cdh,d6h
+			db	29h,20h,cah,edh,efh,91h,d3h,27h
+			db	50h,a6h,3eh,72h,4ah,feh,36h,28h
+			db	aeh,aah,0fh,13h,35h,56h,37h,ceh
+			db	56h,19h,cbh,a6h,f7h,1fh,4fh,91h
+			db	abh,aeh,62h,70h,98h,a5h,4ah,55h
+			db	82h,e1h,dch,73h,f8h,1dh,53h,67h
+			db	bch,91h,e8h,5ch,08h,96h,e6h,84h
+			db	28h,70h,e8h,fbh,2eh,f8h,67h,76h
+			db	bdh,ceh,11h,5bh,c3h,9fh,dch,f4h
+			db	4bh,30h,d0h,4eh,beh,e3h,3dh,25h
+			db	e8h,49h,21h,03h,7dh,a5h,9dh,3ch
+			db	f5h,b5h,58h,2ah,42h,e1h,65h,61h
+			db	63h,eah,1fh,2eh,4ch,cch,3fh,c9h
+			db	4bh,eeh,27h,a9h,ddh,1ch,2ch,6fh
+			db	1ch,f9h,60h,e4h,fdh,53h,25h,14h
+			db	ebh,35h,9dh,1bh,54h,2ah,40h,27h
+			db	46h,b8h,6eh,24h,b0h,0dh,7ah,93h
+			db	a6h,8ah,abh,c5h,ceh,7ch,4ch,ach
+			db	10h,06h,28h,32h,f9h,5eh,67h,c7h
+			db	67h,7dh,95h,fbh,68h,b2h,f6h,73h
+			db	28h,8ch,a1h,7ch,aeh,34h,e1h,ach
+			db	6fh,96h,8fh,1ah,0eh,b6h,76h,69h
+			db	10h,69h,eah,91h,3fh,56h,7fh,d9h
+			db	49h,12h,48h,d1h,b6h,84h,97h,beh
+			db	cch,5dh,48h,05h,21h,16h,28h,9ch
+			db	cch,92h,c8h,aeh,f1h,f2h,a6h,15h
+			db	ebh,beh,f1h,b0h,46h,bbh,a5h,19h
+			db	2ch,85h,7ah,a9h,d3h,78h,03h,a5h
+			db	37h,a9h,ech,aeh,5fh,61h,0bh,94h
+			db	50h,83h,a0h,deh,2ch,ffh,2bh,41h
+			db	7dh,3ch,75h,55h,ddh,7dh,e5h,a3h
+			db	6fh,eah,87h,70h,c1h,f7h,32h,98h
+			db	01h,86h,5eh,43h,8bh,dbh,c8h,10h
+			db	94h,5dh,0eh,3fh,c9h,cah,40h,06h
+			db	8fh,fdh,e3h,88h,eah,47h,48h,a4h
+			db	efh,9ah,4fh,54h,7dh,07h,adh,9eh
+			db	2eh,f9h,e9h,86h,e6h,09h,9bh,0dh
+			db	2eh,62h,13h,8bh,adh,51h,d0h,c7h
+			db	e3h,4eh,0fh,23h,93h,5eh,e6h,77h
+			db	fdh,fch,9bh,1ch,8fh,a5h,deh,1eh
+			db	84h,a4h,10h,21h,8bh,c0h,e6h,11h
+			db	a7h,e5h,15h,48h,9ah,3eh,69h,cdh
+			db	8dh,38h,1eh,79h,fbh,40h,44h,56h
+			db	98h,1dh,d6h,f3h,cbh,74h,59h,bch
+			db	73h,75h,4eh,2ch,3dh,62h,3eh,beh
+			db	84h,cbh,69h,a7h,0ch,0ch,60h,50h
+			db	87h,f6h,6bh,ach,a2h,a6h,b3h,86h
+			db	d7h,49h,8eh,e7h,aah,44h,37h,7ah
+			db	79h,0ah,65h,26h,f9h,43h,12h,81h
+			db	62h,37h,92h,94h,12h,1eh,83h,edh
+			db	cah,ceh,ebh,11h,ebh,34h,d2h,5dh
+			db	8dh,afh,5fh,e1h,feh,ddh,b9h,58h
+			db	21h,9ch,20h,2dh,e8h,52h,6ch,5dh
+			db	4eh,bbh,30h,68h,53h,0eh,d2h,92h
+			db	d3h,adh,03h,03h,efh,28h,1ah,fah
+			db	d3h,deh,6bh,40h,b0h,99h,f0h,80h
+			db	92h,91h,4fh,0eh,81h,18h,9ah,5eh
+			db	e4h,a8h,39h,9eh,3ah,f5h,26h,97h
+			db	48h,33h,46h,afh,eah,0dh,44h,3dh
+			db	60h,bdh,deh,6dh,9ah,d8h,6eh,9ch
+			db	b2h,1ch,7eh,d2h,2ah,55h,4fh,01h
+			db	d3h,9bh,8fh,bch,e8h,14h,1dh,9eh
+			db	74h,5bh,1ch,60h,81h,cfh,eah,83h
+			db	f2h,8eh,28h,53h,80h,97h,05h,57h
+			db	b2h,44h,c0h,53h,79h,50h,1ch,b8h
+			db	01h,32h,44h,b9h,a2h,24h,8ah,5ah
+			db	49h,49h,7ch,a6h,5ah,aeh,ebh,f8h
+			db	59h,cbh,e9h,02h,ebh,7eh,f9h,8fh
+			db	dah,7ch,afh,94h,9dh,a2h,97h,7dh
+			db	f9h,0ah,ffh,6dh,40h,5ch,fdh,93h
+			db	37h,49h,3ah,68h,2ah,0ch,16h,c6h
+			db	ffh,c9h,dbh,1bh,5fh,6bh,7fh,64h
+			db	d3h,08h,ach,43h,5dh,6dh,b9h,a8h
+			db	aah,afh,a4h,31h,23h,84h,d2h,e2h
+			db	61h,d7h,1ah,a0h,29h,2fh,56h,4bh
+			db	b8h,b1h,ffh,69h,81h,7fh,46h,f3h
+			db	6eh,8ah,32h,7fh,22h,06h,9ah,b1h
+			db	37h,b9h,d7h,74h,78h,1fh,19h,55h
+			db	ddh,48h,4fh,15h,81h,eah,31h,7bh
+			db	21h,a9h,03h,9ah,a3h,89h,19h,16h
+			db	8dh,ach,12h,45h,f6h,a4h,5ch,8dh
+			db	85h,15h,41h,08h,7dh,ceh,6ah,5eh
+			db	dfh,7ah,61h,ach,32h,37h,d4h,e4h
+			db	41h,2fh,b9h,54h,efh,31h,efh,e5h
+			db	d1h,4eh,b5h,e5h,1fh,cfh,73h,3ah
+			db	bah,d8h,79h,14h,25h,c4h,31h,4fh
+			db	2ch,f9h,5ah,e0h,ebh,6eh,b3h,0dh
+			db	06h,c3h,a3h,46h,e6h,bah,bdh,3dh
+			db	22h,28h,67h,f4h,d3h,8eh,4fh,dah
+			db	f6h,6fh,f3h,71h,39h,7eh,dch,cch
+			db	3ch,76h,31h,6ah,56h,2bh,27h,d6h
+			db	57h,aah,c9h,bah,b9h,e2h,55h,2fh
+			db	21h,dfh,22h,fdh,9ch,10h,30h,57h
+			db	a3h,85h,ech,91h,6ah,64h,ebh,13h
+			db	72h,5bh,9dh,9dh,7eh,c2h,e9h,a5h
+			db	e5h,45h,03h,28h,38h,adh,36h,dbh
+			db	00h,d4h,80h,06h,78h,5ah,57h,74h
+			db	e2h,9eh,31h,ceh,ech,d2h,4eh,edh
+			db	4ch,77h,e4h,e5h,dch,6dh,96h,7eh
+			db	82h,bfh,cch,6dh,8dh,cch,39h,d4h
+			db	1fh,b7h,fah,47h,c7h,5fh,80h,5ch
+			db	c9h,e2h,3fh,0fh,00h,32h,17h,17h
+			db	beh,e4h,91h,9fh,a4h,ceh,b3h,dch
+			db	08h,1ah,08h,b8h,99h,2fh,1ah,87h
+			db	feh,11h,02h,27h,7fh,a6h,b6h,dfh
+			db	a5h,6ch,66h,73h,c7h,7eh,c2h,2bh
+			db	a3h,4eh,d5h,60h,1eh,b5h,75h,c8h
+			db	9ah,e0h,35h,7ch,f7h,eeh,3dh,72h
+			db	47h,4dh,71h,68h,a0h,c2h,ach,cch
+			db	6ah,17h,42h,4ah,f1h,8eh,a3h,cdh
+			db	0bh,82h,a3h,d4h,92h,a0h,a9h,f0h
+			db	fch,4eh,0ch,38h,62h,35h,ffh,18h
+			db	1ch,75h,c6h,f2h,2dh,59h,aah,c2h
+			db	45h,e2h,42h,92h,73h,28h,61h,6eh
+			db	eeh,30h,7dh,54h,f0h,6ch,c6h,4fh
+			db	7ch,e8h,67h,7ch,e5h,81h,41h,57h
+			db	98h,b7h,fah,d3h,34h,d3h,68h,ceh
+			db	60h,74h,dch,cfh,d4h,97h,7dh,3bh
+			db	26h,3eh,4ah,edh,dfh,4ch,d1h,20h
+			db	57h,d7h,aeh,77h,6dh,44h,abh,0eh
+			db	7ch,89h,04h,3bh,09h,56h,1ch,21h
+			db	5ah,53h,27h,c3h,70h,dfh,f6h,c9h
+			db	79h,64h,0ch,7bh,09h,c7h,deh,f5h
+			db	18h,52h,e7h,a3h,34h,30h,5eh,58h
+			db	e7h,2ch,06h,5eh,a2h,b5h,f7h,35h
+			db	d7h,22h,a9h,3bh,a2h,e8h,26h,cch
+			db	deh,4ch,e7h,c1h,5eh,76h,24h,9fh
+			db	32h,7bh,01h,63h,9ch,57h,dch,99h
+			db	23h,98h,02h,deh,aeh,64h,d3h,30h
+			db	06h,77h,7ah,2eh,77h,77h,4ch,81h
+			db	06h,f9h,beh,6dh,0dh,a1h,d0h,90h
+			db	e7h,6fh,eah,d4h,0dh,60h,c1h,36h
+			db	54h,f6h,27h,ffh,e9h,64h,63h,abh
+			db	edh,a3h,a1h,32h,83h,a7h,ebh,44h
+			db	f3h,a5h,deh,f5h,e7h,0fh,d8h,fah
+			db	aah,c8h,82h,b2h,b9h,1ah,02h,a5h
+			db	bdh,b7h,dfh,4dh,0ah,2dh,58h,dch
+			db	29h,a0h,c2h,17h,e1h,d8h,b7h,8dh
+			db	78h,9bh,b4h,0ch,15h,59h,50h,2eh
+			db	c6h,a6h,beh,32h,42h,47h,38h,edh
+			db	f5h,a3h,3ch,9ah,95h,2dh,abh,57h
+			db	04h,cch,83h,fdh,f2h,89h,abh,76h
+			db	85h,58h,12h,e6h,9bh,0eh,64h,97h
+			db	01h,3eh,50h,9dh,cah,afh,4ch,e6h
+			db	8ch,18h,10h,37h,72h,e3h,62h,79h
+			db	88h,82h,08h,33h,eeh,e6h,67h,45h
+			db	abh,abh,8ah,deh,b2h,45h,8bh,d3h
+			db	a0h,3fh,f2h,79h,96h,ech,6fh,09h
+			db	1bh,cfh,e2h,32h,11h,78h,70h,c9h
+			db	7dh,fdh,00h,98h,26h,39h,10h,96h
+			db	8bh,50h,13h,86h,56h,86h,d2h,08h
+			db	cfh,d4h,1fh,07h,1dh,f4h,34h,12h
+			db	c9h,e8h,dfh,a9h,60h,1ah,dch,49h
+			db	1eh,c4h,b0h,69h,f9h,41h,d3h,09h
+			db	2ah,15h,6dh,b6h,45h,48h,85h,dch
+			db	98h,cah,d5h,5eh,5eh,19h,47h,65h
+			db	94h,0bh,2fh,0dh,16h,f6h,62h,9ah
+			db	1fh,3ch,29h,54h,bfh,f5h,cah,5eh
+			db	b0h,07h,69h,0bh,57h,34h,44h,98h
+			db	bbh,e0h,a2h,71h,69h,59h,d1h,ech
+			db	91h,4dh,20h,ceh,9fh,e5h,28h,97h
+			db	b8h,d7h,32h,56h,e9h,a3h,98h,14h
+			db	32h,d8h,5dh,a2h,32h,51h,b0h,90h
+			db	12h,2fh,70h,0dh,fdh,46h,bfh,2ah
+			db	b2h,13h,48h,c5h,1fh,e7h,aah,0dh
+			db	f4h,e4h,80h,87h,c7h,18h,0ah,c4h
+			db	29h,37h,39h,27h,13h,47h,ddh,3dh
+			db	a7h,5ch,51h,f5h,eeh,94h,92h,71h
+			db	96h,78h,beh,4bh,1ah,2ah,01h,66h
+			db	27h,b3h,48h,19h,0ah,cfh,44h,34h
+			db	2ah,70h,29h,89h,f3h,cah,6dh,a2h
+			db	74h,36h,70h,21h,99h,92h,12h,74h
+			db	eah,76h,89h,74h,81h,f5h,f3h,20h
+			db	97h,33h,32h,6ah,a7h,6ch,a2h,bbh
+			db	ach,5ch,33h,cfh,4eh,6bh,e4h,64h
+			db	f9h,34h,a2h,b9h,d6h,8ah,f2h,1eh
+			db	37h,64h,04h,bdh,19h,bah,09h,28h
+			db	32h,b7h,a0h,65h,a4h,01h,f7h,f1h
+			db	12h,a7h,04h,93h,95h,f1h,20h,9eh
+			db	b5h,d4h,b8h,5ah,f9h,00h,33h,22h
+			db	85h,6bh,6eh,02h,7bh,6dh,cch,6ch
+			db	26h,5dh,16h,3ah,2fh,9eh,deh,4dh
+			db	0dh,a8h,0bh,21h,f9h,4dh,d6h,f0h
+			db	f1h,70h,8ah,7fh,8dh,dbh,47h,73h
+			db	8eh,ddh,3fh,b3h,b5h,35h,ffh,64h
+			db	d2h,3fh,89h,85h,c6h,ech,00h,bbh
+			db	b0h,1ah,afh,2eh,a4h,edh,41h,91h
+			db	f2h,69h,46h,ddh,29h,f6h,10h,ach
+			db	10h,65h,6fh,efh,79h,c7h,dbh,cfh
+			db	52h,18h,4ch,84h,64h,16h,90h,43h
+			db	21h,6eh,68h,7eh,0fh,fch,40h,76h
+			db	6eh,2fh,a0h,52h,74h,67h,80h,a0h
+			db	93h,51h,b5h,c9h,88h,ach,ech,39h
+			db	8dh,2ch,d1h,2bh,1ah,a3h,66h,ddh
+			db	b3h,00h,2fh,65h,a9h,a9h,b3h,e5h
+			db	99h,03h,e1h,37h,77h,59h,0ah,bbh
+			db	b9h,48h,5dh,71h,05h,0dh,f8h,e2h
+			db	29h,36h,aeh,04h,c1h,ddh,9dh,d9h
+			db	a5h,9fh,3fh,4ah,83h,12h,80h,99h
+			db	bah,91h,0eh,3ah,b3h,77h,94h,f3h
+			db	3bh,feh,50h,81h,cdh,74h,bah,22h
+			db	5bh,43h,08h,adh,cdh,9ch,51h,2dh
+			db	6eh,a3h,0ah,f0h,34h,3eh,dfh,e4h
+			db	f4h,2eh,11h,20h,14h,9ch,9bh,77h
+			db	8ah,90h,cfh,7ch,81h,efh,82h,70h
+			db	83h,9ah,8dh,afh,52h,8bh,f4h,02h
+			db	1ah,03h,4bh,43h,42h,85h,6dh,33h
+			db	a7h,87h,44h,35h,3dh,c5h,4dh,0ah
+			db	e5h,adh,07h,8ah,5dh,f2h,40h,53h
+			db	51h,9bh,efh,5dh,e6h,b1h,4ah,05h
+			db	d5h,50h,5ch,4bh,60h,bch,f6h,34h
+			db	35h,83h,bah,a9h,edh,f3h,0eh,99h
+			db	57h,38h,c0h,26h,cfh,e5h,bdh,9ch
+			db	16h,cfh,04h,04h,26h,53h,b6h,8bh
+			db	72h,49h,a8h,eeh,42h,5ch,7fh,86h
+			db	31h,0ah,53h,d1h,c7h,90h,9dh,7dh
+			db	e5h,52h,a1h,39h,97h,08h,9fh,2ah
+			db	01h,71h,d5h,76h,e7h,beh,27h,6ch
+			db	70h,2ch,55h,5fh,cbh,d7h,5bh,45h
+			db	4eh,a2h,f4h,22h,ach,b3h,7fh,a5h
+			db	26h,ffh,f2h,5dh,eah,0bh,43h,59h
+			db	11h,b2h,05h,37h,b8h,f8h,06h,9ah
+			db	61h,d8h,c4h,21h,3eh,d5h,41h,45h
+			db	4eh,bch,1eh,00h,d6h,93h,7eh,b6h
+			db	a8h,b1h,a2h,95h,8dh,a8h,dfh,1eh
+			db	51h,ebh,2fh,4dh,7dh,60h,77h,16h
+			db	e6h,22h,aah,02h,21h,c9h,dah,28h
+			db	96h,93h,d5h,6fh,a0h,85h,e6h,dah
+			db	a5h,a6h,ech,2fh,39h,61h,c8h,beh
+			db	93h,95h,bch,adh,c6h,55h,20h,ddh
+			db	88h,20h,50h,e4h,f7h,9dh,63h,5fh
+			db	6fh,13h,10h,b4h,aeh,76h,4ah,74h
+			db	d6h,5dh,a4h,46h,beh,2ah,44h,0bh
+			db	8ah,bdh,99h,03h,15h,eeh,8bh,c8h
+			db	a1h,93h,f3h,4bh,e5h,56h,bch,98h
+			db	f1h,48h,65h,85h,f5h,fbh,9ah,5fh
+			db	ffh,42h,50h,5ch,3ch,0ch,62h,45h
+			db	79h,a8h,beh,c9h,f1h,04h,87h,20h
+			db	29h,40h,94h,84h,23h,33h,43h,0ch
+			db	e4h,d9h,47h,62h,6ch,b1h,cdh,91h
+			db	e3h,2ah,7fh,68h,efh,35h,d8h,82h
+			db	24h,35h,d0h,5ch,dfh,05h,3ah,72h
+			db	c6h,0dh,f0h,e9h,9fh,53h,beh,d1h
+			db	cbh,62h,28h,0dh,eah,c8h,6dh,a2h
+			db	06h,6dh,39h,72h,43h,2bh,59h,dah
+			db	bch,ebh,3fh,74h,89h,d4h,65h,d4h
+			db	bah,11h,eah,66h,2eh,b9h,51h,e7h
+			db	2ah,8ch,3ch,27h,85h,f4h,f5h,2bh
+			db	fbh,45h,ffh,deh,3eh,36h,ffh,d7h
+			db	c8h,8bh,90h,b8h,82h,b9h,feh,f3h
+			db	86h,46h,04h,eeh,c9h,94h,4dh,20h
+			db	86h,d8h,fah,00h,f8h,08h,c6h,4ch
+			db	17h,6dh,f8h,f6h,e8h,76h,feh,bah
+			db	3eh,2eh,7ch,92h,d0h,4ah,14h,84h
+			db	45h,91h,99h,bch,2eh,6bh,e6h,9ch
+			db	73h,3ch,1bh,3ah,24h,beh,cbh,9eh
+			db	82h,56h,fch,4ch,8ch,81h,35h,51h
+			db	1eh,3bh,12h,6fh,82h,50h,abh,59h
+			db	e9h,dfh,4bh,0fh,5fh,5ah,7ch,27h
+			db	aeh,97h,34h,f5h,91h,17h,b9h,eah
+			db	64h,a0h,77h,b1h,05h,f1h,26h,81h
+			db	4ch,54h,b0h,10h,17h,e4h,87h,e1h
+			db	49h,42h,03h,36h,20h,d0h,2dh,f7h
+			db	b2h,f2h,e9h,07h,ach,0eh,44h,c1h
+			db	38h,2fh,c5h,c5h,52h,96h,a9h,deh
+			db	edh,beh,7fh,aah,bbh,01h,37h,2ah
+			db	4bh,40h,5dh,08h,fbh,86h,80h,dch
+			db	6ch,dbh,c0h,26h,cah,3ah,54h,6eh
+			db	4dh,e6h,25h,8ch,18h,fdh,b9h,1fh
+			db	f8h,2fh,43h,3fh,e8h,2ah,edh,16h
+			db	62h,0fh,6ah,cbh,5ch,a8h,3ch,65h
+			db	33h,6ah,c7h,24h,b7h,d0h,a3h,e8h
+			db	38h,9eh,61h,29h,3ah,6ah,73h,7ch
+			db	37h,aeh,dch,d7h,00h,f8h,cah,e1h
+			db	bdh,42h,e5h,1dh,7eh,ddh,99h,cbh
+			db	94h,32h,8bh,c4h,ebh,0bh,fch,7bh
+			db	1dh,ach,7ch,86h,48h,f1h,3ah,7ah
+			db	68h,5eh,10h,03h,66h,07h,bdh,fdh
+			db	37h,aah,0eh,cah,61h,99h,f0h,1dh
+			db	f7h,65h,60h,0bh,f1h,87h,dbh,eeh
+			db	aeh,67h,cch,0dh,06h,99h,e8h,06h
+			db	09h,48h,b6h,ebh,77h,27h,42h,fah
+			db	edh,26h,5dh,53h,39h,e6h,f3h,1fh
+			db	b9h,e2h,bbh,94h,52h,5eh,cdh,e0h
+			db	f3h,28h,a7h,3ah,7ah,9bh,bbh,82h
+			db	19h,2eh,16h,7ch,44h,98h,80h,b2h
+			db	24h,15h,efh,4ah,9eh,47h,22h,cah
+			db	40h,84h,d6h,a6h,4eh,22h,c9h,75h
+			db	eeh,47h,02h,eeh,78h,15h,b7h,a2h
+			db	b1h,c7h,c7h,d8h,2ch,0ch,e1h,05h
+			db	59h,11h,cch,bfh,49h,5fh,b7h,9bh
+			db	52h,00h,4dh,e9h,d2h,71h,37h,f6h
+			db	74h,98h,ceh,78h,5ch,18h,d8h,42h
+			db	dbh,d9h,e3h,9ch,b7h,ddh,f1h,4dh
+			db	8bh,8ah,91h,cfh,98h,cch,84h,abh
+			db	c4h,d3h,73h,55h,7ah,aeh,e8h,fah
+			db	2fh,5ah,cah,35h,f1h,dfh,aeh,83h
+			db	75h,5ah,83h,66h,e0h,9fh,d1h,18h
+			db	5fh,0eh,15h,f2h,04h,b5h,5eh,0ah
+			db	bbh,62h,d6h,b3h,0bh,0ah,ffh,ach
+			db	14h,93h,7fh,22h,4ch,45h,07h,87h
+			db	d4h,c1h,7fh,eah,93h,09h,51h,7ch
+			db	77h,24h,7dh,f0h,61h,74h,39h,32h
+			db	fah,dch,afh,7fh,a2h,ceh,20h,52h
+			db	a1h,a4h,92h,61h,82h,11h,9bh,06h
+			db	8ch,dah,dah,5dh,37h,7ch,eeh,61h
+			db	11h,0eh,58h,74h,f6h,42h,1bh,fch
+			db	26h,f3h,14h,68h,f1h,9bh,08h,e1h
+			db	ebh,d0h,5fh,fch,80h,e1h,efh,53h
+			db	2eh,f0h,c4h,6eh,3ah,94h,ach,d8h
+			db	23h,e9h,76h,c5h,d5h,49h,0dh,6fh
+			db	c6h,f4h,b7h,59h,b9h,3eh,ech,edh
+			db	17h,2fh,81h,18h,0ch,24h,4ah,51h
+			db	24h,a8h,a7h,25h,b2h,8dh,e4h,feh
+			db	51h,44h,b0h,e8h,9ch,bch,10h,efh
+			db	19h,4ch,d9h,47h,e9h,81h,85h,07h
+			db	43h,a3h,39h,7fh,b8h,c2h,4dh,4ah
+			db	44h,71h,53h,ddh,a9h,beh,b0h,d9h
+			db	01h,c9h,3ch,94h,a1h,6ch,47h,22h
+			db	c1h,8fh,66h,eah,66h,a2h,4fh,c1h
+			db	65h,91h,71h,33h,7dh,65h,73h,79h
+			db	0dh,4ch,37h,3eh,57h,08h,22h,88h
+			db	ech,77h,a9h,6bh,89h,74h,59h,2ah
+			db	afh,57h,4dh,18h,54h,0ah,ech,5eh
+			db	9bh,cfh,c1h,d8h,22h,f1h,18h,e7h
+			db	d9h,30h,f8h,f9h,f1h,99h,46h,e4h
+			db	07h,f7h,cdh,55h,6eh,77h,f6h,efh
+			db	deh,28h,15h,beh,c5h,29h,36h,a5h
+			db	ddh,71h,44h,57h,08h,a0h,3ah,48h
+			db	55h,ffh,c5h,34h,e1h,1fh,37h,dbh
+			db	1ch,3ch,dch,5dh,e6h,8ah,98h,1eh
+			db	a2h,dbh,76h,3ah,4fh,37h,7ah,5ah
+			db	96h,d5h,6fh,78h,80h,3fh,9eh,68h
+			db	68h,b4h,e5h,c0h,afh,29h,0eh,7dh
+			db	02h,b1h,a8h,46h,efh,c2h,a0h,63h
+			db	26h,bah,35h,99h,5bh,63h,7dh,4ch
+			db	9dh,94h,41h,ddh,3ch,13h,dch,77h
+			db	19h,61h,6ch,46h,22h,6bh,42h,34h
+			db	34h,2bh,02h,97h,6dh,86h,5ah,67h
+			db	22h,29h,6eh,5ah,01h,64h,15h,38h
+			db	95h,edh,26h,9fh,2ah,fdh,33h,00h
+			db	5ch,6dh,4ch,0eh,4ah,dch,ebh,9dh
+			db	8ah,4bh,feh,30h,e7h,0eh,a7h,8fh
+			db	40h,0dh,6ah,12h,f7h,1dh,fdh,20h
+			db	39h,12h,e6h,82h,b5h,89h,9ah,b2h
+			db	2dh,0ch,0dh,a4h,86h,c3h,6bh,d6h
+			db	fbh,34h,38h,f9h,20h,fdh,edh,63h
+			db	58h,f8h,bbh,97h,51h,50h,d6h,8bh
+			db	67h,e2h,0eh,71h,62h,31h,42h,20h
+			db	5fh,5bh,f6h,04h,91h,fah,5dh,f5h
+			db	dfh,90h,4dh,42h,d2h,f2h,a5h,3dh
+			db	a4h,d1h,0ch,e5h,d2h,0dh,a2h,88h
+			db	34h,cbh,d7h,6dh,b3h,f3h,b5h,f6h
+			db	d0h,15h,d8h,c9h,f0h,e1h,b6h,d2h
+			db	59h,fch,dfh,edh,5ch,06h,c3h,fdh
+			db	83h,8ah,09h,f1h,cch,1ah,f7h,e8h
+			db	02h,b3h,60h,84h,b5h,dch,0ch,dah
+			db	d2h,5ah,f6h,05h,51h,44h,e2h,83h
+			db	52h,8ah,89h,71h,b8h,45h,0bh,4ah
+			db	1bh,6eh,61h,6bh,26h,d9h,8bh,51h
+			db	e9h,c4h,24h,d8h,f6h,36h,ech,aeh
+			db	55h,92h,8eh,8eh,ech,29h,deh,66h
+			db	e8h,67h,12h,10h,b9h,fbh,9bh,20h
+			db	90h,d4h,87h,e7h,a0h,23h,fch,55h
+			db	edh,41h,55h,aeh,cbh,29h,86h,68h
+			db	9ch,11h,3eh,91h,afh,4fh,09h,5ah
+			db	99h,9ah,56h,23h,5fh,a4h,b6h,80h
+			db	67h,5ah,47h,47h,a5h,40h,98h,8bh
+			db	dch,8dh,16h,32h,4eh,7fh,58h,86h
+			db	61h,68h,bdh,87h,8dh,b2h,a0h,60h
+			db	17h,6ah,26h,f0h,eah,04h,5eh,c1h
+			db	3ah,81h,9bh,fdh,04h,8dh,3ch,83h
+			db	e9h,0eh,8ah,25h,36h,f6h,abh,b1h
+			db	c5h,b7h,5eh,71h,2eh,f6h,97h,9bh
+			db	27h,0bh,04h,63h,9ah,51h,1ah,4dh
+			db	c8h,d4h,8ch,fch,f4h,d5h,a5h,b0h
+			db	4bh,24h,ceh,6fh,7dh,19h,a4h,46h
+			db	4dh,a5h,b6h,57h,9fh,bch,1ah,b6h
+			db	6dh,a8h,48h,23h,35h,19h,d9h,f2h
+			db	cbh,bdh,63h,5dh,e6h,d9h,f9h,18h
+			db	afh,d6h,87h,1bh,38h,b2h,6dh,73h
+			db	d1h,aah,5ch,e0h,46h,b3h,34h,a2h
+			db	85h,33h,27h,ach,35h,03h,47h,c4h
+			db	f5h,5bh,e8h,72h,e6h,20h,fbh,e2h
+			db	6bh,90h,92h,cch,81h,a9h,20h,6dh
+			db	b3h,f3h,fch,d3h,66h,73h,e4h,50h
+			db	22h,9eh,c0h,28h,b1h,b1h,d3h,44h
+			db	a9h,2fh,8fh,efh,95h,20h,41h,f0h
+			db	74h,d7h,f3h,4eh,33h,e4h,a4h,d3h
+			db	a2h,74h,8bh,1bh,e2h,4fh,dch,fch
+			db	bch,8ch,78h,67h,17h,68h,88h,f5h
+			db	a9h,7dh,34h,3ah,f9h,8bh,90h,e3h
+			db	81h,5dh,30h,aeh,6fh,58h,41h,8eh
+			db	14h,c6h,7dh,beh,80h,53h,c9h,85h
+			db	d1h,cfh,c5h,a6h,cbh,f8h,90h,56h
+			db	c9h,e6h,28h,13h,4eh,54h,f1h,25h
+			db	91h,27h,5bh,8fh,19h,57h,44h,cch
+			db	87h,b2h,84h,15h,59h,68h,6fh,20h
+			db	69h,bfh,49h,8ah,67h,a8h,a1h,67h
+			db	7fh,8bh,89h,3bh,66h,a3h,bch,fdh
+			db	a4h,10h,34h,b1h,97h,81h,a1h,50h
+			db	99h,61h,85h,7ah,35h,2dh,9eh,f6h
+			db	c7h,f3h,26h,68h,4eh,90h,89h,a3h
+			db	b9h,f0h,38h,cbh,c5h,8bh,01h,73h
+			db	d3h,edh,48h,65h,5ah,10h,cfh,94h
+			db	91h,ebh,93h,7bh,4fh,38h,cfh,7eh
+			db	2bh,05h,72h,81h,6eh,d5h,c6h,5bh
+			db	46h,dch,35h,39h,32h,96h,73h,a8h
+			db	d0h,3ah,64h,d1h,77h,00h,7ah,17h
+			db	05h,07h,1ch,44h,7fh,c5h,b4h,d3h
+			db	51h,bah,60h,f6h,11h,cbh,38h,8ch
+			db	a5h,04h,a7h,75h,21h,dbh,beh,2ah
+			db	35h,95h,46h,8dh,06h,cfh,41h,f6h
+			db	90h,eah,e9h,a3h,17h,fch,09h,36h
+			db	aeh,8ah,55h,deh,14h,09h,31h,31h
+			db	6bh,9ch,4dh,c5h,e2h,14h,fch,c2h
+			db	0ah,65h,02h,b9h,f3h,1ah,64h,efh
+			db	3ah,54h,b5h,82h,a7h,42h,0ah,fbh
+			db	25h,70h,97h,2bh,2fh,aeh,d0h,ach
+			db	e9h,dah,d5h,bdh,11h,6fh,9bh,feh
+			db	ddh,c1h,12h,60h,90h,9bh,e5h,f7h
+			db	d8h,12h,87h,e1h,97h,deh,73h,4eh
+			db	b3h,93h,c8h,b1h,d1h,c0h,27h,fbh
+			db	3eh,20h,60h,b2h,c0h,a3h,63h,1eh
+			db	0ah,42h,31h,5fh,9ch,93h,5bh,83h
+			db	75h,a1h,03h,6ch,5eh,0ch,3fh,a8h
+			db	7dh,aah,00h,28h,a7h,32h,a9h,f7h
+			db	45h,29h,26h,abh,60h,b4h,dbh,a9h
+			db	0eh,42h,97h,48h,33h,45h,e4h,ach
+			db	1bh,c5h,0ah,30h,c4h,90h,f0h,6ch
+			db	d7h,70h,7ah,5fh,e1h,34h,d1h,b0h
+			db	52h,66h,f8h,9dh,7ch,00h,c8h,b5h
+			db	8ch,46h,73h,8ah,c1h,33h,04h,00h
+			db	06h,ffh,52h,c1h,cfh,7eh,75h,a9h
+			db	1ah,e3h,92h,9eh,c5h,b7h,19h,4ch
+			db	05h,dah,2eh,8fh,80h,80h,66h,61h
+			db	d7h,65h,94h,1eh,88h,7ah,11h,a5h
+			db	4eh,81h,72h,14h,2dh,fch,8dh,c5h
+			db	19h,72h,4bh,ceh,8eh,44h,62h,68h
+			db	50h,bbh,91h,6ch,deh,2ah,12h,5dh
+			db	13h,86h,4ch,40h,6eh,40h,29h,b7h
+			db	e6h,67h,23h,d2h,cfh,f2h,ffh,eeh
+			db	c4h,a2h,9ah,aeh,d1h,76h,34h,b3h
+			db	68h,13h,c2h,9ah,18h,74h,9fh,e5h
+			db	2fh,70h,fah,51h,4ah,9eh,f0h,73h
+			db	aah,aeh,beh,b8h,a1h,65h,ffh,c5h
+			db	46h,b7h,1ch,68h,bbh,a6h,afh,ddh
+			db	eeh,10h,94h,84h,f6h,04h,9eh,92h
+			db	b4h,03h,d3h,44h,ddh,aah,2ah,66h
+			db	00h,e2h,a4h,01h,29h,05h,b9h,52h
+			db	bbh,cch,f8h,78h,f5h,dfh,fah,d5h
+			db	9dh,6fh,e8h,4eh,beh,15h,c7h,01h
+			db	f0h,c0h,ebh,b3h,79h,63h,90h,cfh
+			db	adh,3eh,13h,1eh,64h,59h,3fh,f0h
+			db	e4h,c1h,96h,34h,7ch,b0h,a6h,38h
+			db	24h,39h,32h,beh,e2h,2eh,abh,66h
+			db	59h,28h,58h,9dh,76h,9ah,0eh,dfh
+			db	7dh,bbh,2ah,b8h,4ah,bch,04h,ebh
+			db	a6h,b0h,d1h,fdh,34h,12h,d3h,0dh
+			db	66h,24h,a6h,03h,2fh,24h,40h,e2h
+			db	d4h,c9h,1dh,6ah,62h,0fh,afh,6ah
+			db	78h,bfh,79h,edh,51h,4bh,aeh,9dh
+			db	30h,7bh,9dh,f8h,67h,f4h,18h,1fh
+			db	74h,43h,48h,40h,cbh,1ah,ceh,d5h
+			db	c1h,36h,dfh,d5h,bdh,64h,d8h,c8h
+			db	d8h,dfh,9dh,2ah,84h,4bh,9eh,d3h
+			db	8bh,8ch,88h,43h,f1h,f1h,24h,28h
+			db	4ah,22h,e1h,7dh,5eh,7ch,c8h,b2h
+			db	93h,61h,76h,bbh,afh,cfh,0fh,aah
+			db	42h,ebh,5ch,58h,2fh,6bh,efh,88h
+			db	12h,dah,39h,a2h,d5h,eeh,7ch,6bh
+			db	8bh,6ah,80h,5ch,deh,b4h,4dh,19h
+			db	bch,39h,72h,bbh,f7h,bfh,2eh,d7h
+			db	0eh,4eh,4fh,4dh,a8h,c1h,e4h,bah
+			db	8fh,b5h,04h,48h,4fh,15h,8bh,32h
+			db	cfh,0fh,a9h,ceh,60h,e9h,dch,95h
+			db	82h,c9h,d1h,54h,d0h,e7h,2ch,12h
+			db	96h,01h,2bh,b6h,7bh,58h,03h,c9h
+			db	64h,e5h,80h,e4h,1eh,d3h,50h,6ah
+			db	93h,3eh,b5h,86h,6bh,82h,89h,61h
+			db	81h,24h,96h,ebh,b4h,11h,dbh,74h
+			db	fch,40h,3dh,12h,1ch,cfh,f4h,38h
+			db	b0h,0bh,bbh,11h,72h,88h,38h,0ah
+			db	7fh,73h,e7h,e1h,e4h,3dh,edh,24h
+			db	72h,64h,fch,28h,f6h,2fh,94h,cdh
+			db	02h,01h,c9h,29h,01h,7fh,26h,25h
+			db	ddh,94h,5dh,1dh,3fh,bfh,37h,e6h
+			db	7ch,58h,e9h,34h,a7h,56h,2dh,67h
+			db	0bh,80h,71h,11h,80h,39h,71h,64h
+			db	25h,22h,4ch,4ch,69h,82h,2eh,80h
+			db	fbh,12h,36h,afh,8bh,8fh,36h,62h
+			db	2fh,f4h,f8h,beh,c8h,3bh,97h,92h
+			db	fdh,47h,1dh,55h,ceh,74h,f4h,52h
+			db	9fh,00h,0dh,f0h,7eh,48h,43h,42h
+			db	5bh,56h,12h,15h,d1h,64h,97h,a1h
+			db	86h,26h,a0h,fch,a8h,ech,70h,abh
+			db	43h,9dh,bfh,63h,78h,18h,79h,76h
+			db	9dh,33h,32h,2dh,93h,1ah,6bh,5fh
+			db	aah,74h,bdh,6fh,bah,f1h,b1h,7dh
+			db	a6h,a3h,09h,2dh,33h,3fh,77h,d8h
+			db	75h,dbh,adh,d1h,01h,16h,01h,feh
+			db	82h,a2h,03h,c8h,53h,26h,45h,a7h
+			db	dch,7bh,6fh,d1h,4ch,53h,6ch,9ch
+			db	6ah,03h,28h,ach,a5h,59h,a6h,73h
+			db	7eh,d9h,f9h,1fh,55h,d4h,f3h,82h
+			db	4bh,ddh,6ch,98h,83h,b6h,51h,ffh
+			db	b3h,1dh,d4h,67h,bfh,53h,c8h,02h
+			db	a2h,08h,6ah,fch,e7h,f8h,80h,3ch
+			db	81h,aeh,b3h,82h,85h,4ch,52h,b7h
+			db	30h,c1h,92h,7eh,8dh,74h,e6h,ddh
+			db	09h,97h,90h,ffh,a9h,8eh,eah,7ch
+			db	5fh,65h,ach,adh,92h,3eh,ffh,3fh
+			db	cch,39h,4bh,4ch,62h,51h,e6h,f1h
+			db	c0h,68h,ech,aah,dah,3bh,efh,5eh
+			db	0dh,d3h,bbh,ach,2dh,f3h,49h,7ah
+			db	d8h,ceh,1fh,69h,3eh,e9h,2ah,5ah
+			db	73h,40h,88h,41h,c7h,b1h,0ah,f9h
+			db	7ah,87h,7ch,f7h,1fh,5ch,e4h,16h
+			db	bdh,19h,aeh,95h,c7h,8dh,bah,56h
+			db	cdh,80h,01h,f3h,f4h,19h,56h,deh
+			db	7eh,91h,b8h,65h,3ah,d5h,5ah,70h
+			db	9bh,3ah,5ch,63h,00h,0ah,f7h,1ah
+			db	e0h,9fh,b9h,92h,63h,2ah,aah,4eh
+			db	64h,8bh,81h,2ah,63h,3eh,d2h,d1h
+			db	f4h,2ch,ebh,bah,6fh,a0h,76h,0dh
+			db	48h,0ch,f6h,e6h,e6h,88h,9ah,c2h
+			db	b2h,4fh,13h,70h,45h,62h,43h,03h
+			db	83h,f6h,98h,b5h,06h,15h,c1h,d8h
+			db	adh,b1h,f9h,7eh,45h,adh,b3h,f8h
+			db	5ah,cah,e5h,46h,d7h,ebh,4ch,53h
+			db	81h,53h,6dh,5eh,49h,95h,53h,1fh
+			db	26h,f7h,41h,0bh,2fh,b4h,51h,50h
+			db	adh,90h,ech,e9h,a1h,04h,3ch,e7h
+			db	cfh,cah,08h,adh,5bh,26h,08h,cch
+			db	d7h,b5h,65h,83h,93h,feh,49h,35h
+			db	d4h,2ch,e7h,beh,07h,bfh,f8h,6eh
+			db	2eh,c2h,4ah,94h,19h,6ch,edh,b4h
+			db	14h,2ah,02h,9bh,24h,2eh,fah,87h
+			db	f4h,48h,c5h,39h,74h,7dh,c7h,c6h
+			db	40h,43h,c2h,99h,90h,15h,81h,19h
+			db	0bh,60h,43h,04h,3ch,b8h,f0h,39h
+			db	1ch,b6h,93h,f0h,d2h,cch,02h,27h
+			db	79h,bch,7ch,10h,96h,78h,f8h,74h
+			db	fbh,3dh,94h,6eh,9ah,88h,d3h,9fh
+			db	83h,f0h,63h,5ah,f2h,30h,44h,cah
+			db	b3h,c3h,97h,b3h,bch,10h,77h,06h
+			db	1dh,abh,11h,20h,2fh,83h,0eh,c8h
+			db	40h,22h,21h,a7h,33h,a4h,45h,36h
+			db	2dh,4eh,4fh,86h,59h,5ah,28h,3eh
+			db	70h,adh,5dh,26h,6eh,85h,69h,89h
+			db	21h,17h,8fh,d1h,d1h,80h,b4h,8ah
+			db	8ah,4ch,ddh,ebh,b6h,25h,6bh,6ch
+			db	35h,abh,0dh,1bh,aah,40h,24h,c1h
+			db	57h,dch,65h,24h,62h,e8h,5eh,75h
+			db	4eh,b2h,84h,5eh,94h,2bh,7eh,83h
+			db	95h,b8h,d9h,1bh,ffh,4ch,4bh,22h
+			db	42h,f2h,21h,33h,16h,12h,2dh,28h
+			db	46h,b9h,f3h,d8h,89h,0bh,dah,a6h
+			db	64h,c0h,4bh,c2h,80h,cbh,29h,cdh
+			db	42h,cch,23h,17h,6ch,44h,7ah,23h
+			db	6bh,49h,37h,cah,a1h,c9h,1ah,94h
+			db	1ch,d8h,11h,7eh,8ah,10h,18h,edh
+			db	82h,4ch,a0h,f3h,01h,24h,efh,69h
+			db	8ch,48h,e1h,cch,65h,4ch,bah,1eh
+			db	dch,21h,89h,ach,bch,b6h,d2h,efh
+			db	3dh,eeh,5eh,83h,5eh,9bh,7bh,ceh
+			db	c2h,0eh,ddh,4eh,61h,f3h,f5h,cah
+			db	ach,31h,fah,7eh,ddh,a3h,0ch,f6h
+			db	99h,afh,49h,8dh,8bh,aeh,1ah,fdh
+			db	30h,f7h,00h,5bh,83h,fch,19h,16h
+			db	cah,23h,39h,50h,20h,fch,a2h,bah
+			db	50h,7dh,5dh,48h,80h,dbh,62h,60h
+			db	16h,47h,3dh,71h,54h,3bh,92h,fbh
+			db	c8h,7eh,68h,bdh,64h,f9h,75h,11h
+			db	cah,c4h,80h,adh,cbh,bch,ach,c5h
+			db	c4h,58h,e9h,52h,14h,50h,92h,93h
+			db	dbh,8dh,3bh,20h,d6h,adh,8ch,4ah
+			db	52h,73h,27h,6dh,b9h,8fh,d1h,06h
+			db	1dh,3eh,b0h,eah,40h,22h,e7h,bbh
+			db	18h,64h,3eh,bfh,30h,24h,bdh,a1h
+			db	aeh,4eh,99h,c2h,4fh,f9h,38h,d7h
+			db	c8h,11h,abh,5ch,ffh,eeh,6fh,98h
+			db	1ah,8ah,48h,e3h,3dh,31h,3ah,c0h
+			db	11h,62h,9bh,25h,57h,b4h,edh,9ah
+			db	53h,25h,7bh,a6h,89h,75h,b1h,8ch
+			db	43h,5fh,95h,32h,a5h,dbh,75h,fbh
+			db	beh,50h,2ch,8fh,6fh,c9h,d4h,03h
+			db	42h,00h,9dh,1ch,cfh,f0h,d4h,e9h
+			db	6ah,fdh,61h,4ah,11h,35h,c0h,4bh
+			db	0eh,a9h,65h,3dh,15h,f5h,7eh,eah
+			db	23h,a2h,c0h,9bh,dfh,26h,d3h,bfh
+			db	82h,72h,ddh,eeh,dfh,64h,eeh,2fh
+			db	7dh,67h,cah,5ah,1eh,a5h,00h,50h
+			db	12h,4dh,4eh,41h,7bh,81h,6ch,fdh
+			db	65h,83h,1ah,f0h,38h,e5h,8eh,edh
+			db	fch,16h,c9h,8dh,4ah,b8h,f5h,9ah
+			db	cfh,cch,44h,49h,12h,67h,95h,f5h
+			db	dbh,52h,85h,c3h,bdh,04h,6ah,21h
+			db	e4h,69h,a0h,9ch,57h,dbh,50h,0dh
+			db	69h,7eh,09h,1ch,bah,67h,1dh,71h
+			db	59h,11h,19h,8bh,b7h,64h,c6h,29h
+			db	69h,31h,0fh,09h,c4h,b8h,f6h,44h
+			db	0eh,fch,29h,f8h,2bh,f7h,13h,91h
+			db	a7h,6ah,6eh,3fh,a8h,edh,02h,d8h
+			db	18h,68h,eah,4dh,80h,b0h,41h,34h
+			db	9fh,aah,29h,efh,f7h,ebh,bdh,07h
+			db	c4h,d5h,2dh,d1h,b6h,aah,56h,72h
+			db	52h,aah,3bh,edh,26h,0fh,f2h,c4h
+			db	c1h,b4h,42h,1eh,5dh,bah,31h,03h
+			db	82h,59h,3ch,02h,c1h,b0h,b7h,c5h
+			db	98h,4eh,85h,0bh,3ah,bch,6fh,3ah
+			db	44h,6bh,c6h,41h,bbh,1eh,c9h,dah
+			db	91h,78h,58h,0dh,6eh,28h,74h,15h
+			db	3eh,03h,91h,92h,01h,31h,e1h,68h
+			db	7fh,a2h,33h,abh,48h,8ah,24h,34h
+			db	6dh,99h,28h,2dh,d4h,63h,94h,cbh
+			db	1eh,2dh,d5h,a1h,94h,18h,38h,29h
+			db	55h,cbh,a0h,37h,18h,e7h,08h,4ah
+			db	d0h,24h,1dh,01h,98h,43h,99h,73h
+			db	69h,18h,6ch,f8h,57h,62h,4dh,51h
+			db	33h,92h,c7h,5dh,38h,03h,29h,75h
+			db	91h,0eh,2fh,f8h,18h,aeh,5ah,a9h
+			db	47h,30h,ebh,98h,61h,f9h,26h,ech
+			db	ebh,7ah,f4h,d6h,64h,98h,6bh,afh
+			db	9dh,9ah,58h,80h,e2h,0dh,dah,48h
+			db	82h,36h,77h,92h,84h,5dh,cch,3eh
+			db	74h,88h,cbh,0fh,66h,beh,6dh,c4h
+			db	66h,51h,fch,8ch,23h,d9h,5fh,cdh
+			db	b1h,c9h,1dh,e8h,69h,f5h,3bh,e7h
+			db	14h,1fh,a4h,60h,87h,8ah,dbh,29h
+			db	04h,96h,f6h,80h,b8h,4fh,93h,dbh
+			db	c6h,0dh,dbh,9eh,b0h,14h,eah,4bh
+			db	9ch,dch,fch,42h,b2h,27h,e0h,bah
+			db	38h,d4h,96h,e6h,82h,96h,05h,96h
+			db	3dh,f0h,28h,c0h,d4h,08h,5dh,fch
+			db	41h,49h,1ch,1dh,08h,46h,ceh,52h
+			db	f0h,bfh,6fh,ebh,b8h,7fh,8fh,a5h
+			db	abh,b1h,6ch,d4h,deh,3fh,41h,51h
+			db	3fh,f8h,04h,c6h,56h,c2h,89h,f8h
+			db	90h,13h,91h,1eh,a6h,44h,65h,3bh
+			db	bah,ach,27h,ffh,f3h,8eh,a0h,1ah
+			db	9ah,0eh,cch,d0h,8dh,66h,55h,56h
+			db	2bh,e7h,3dh,5eh,fdh,d4h,79h,95h
+			db	cah,a2h,0ah,c3h,ffh,d0h,62h,7ch
+			db	66h,7fh,fch,17h,1bh,a7h,98h,b2h
+			db	5bh,26h,f3h,e4h,cfh,84h,7eh,1fh
+			db	25h,98h,32h,e2h,39h,6fh,deh,8ch
+			db	c4h,35h,c9h,0ah,b7h,87h,3ch,4ah
+			db	25h,2bh,35h,09h,a9h,dch,29h,47h
+			db	a5h,b0h,48h,d3h,00h,4bh,6bh,62h
+			db	93h,31h,09h,e6h,2dh,2fh,79h,2fh
+			db	edh,6ah,f7h,8ah,e5h,32h,ffh,16h
+			db	e7h,ebh,d9h,55h,75h,f7h,e9h,adh
+			db	13h,01h,16h,89h,63h,34h,86h,2eh
+			db	ebh,12h,26h,6ch,d9h,6bh,aah,01h
+			db	beh,4bh,66h,ddh,75h,4fh,0ch,dbh
+			db	6ch,7ch,c5h,5ah,42h,61h,44h,06h
+			db	9bh,94h,beh,7fh,28h,85h,e6h,19h
+			db	beh,17h,79h,85h,cbh,3bh,e7h,f1h
+			db	18h,1eh,b7h,27h,a2h,aeh,d9h,d9h
+			db	22h,7ch,bch,b0h,b7h,98h,d9h,6eh
+			db	72h,eah,65h,9dh,f7h,56h,4ch,3dh
+			db	e8h,c2h,6dh,88h,d1h,60h,b0h,8dh
+			db	77h,3ch,ech,9ch,3ch,60h,b9h,48h
+			db	72h,83h,10h,fdh,cah,77h,d5h,40h
+			db	9ch,f8h,fah,6ah,54h,61h,76h,b2h
+			db	16h,73h,0fh,1fh,d8h,b7h,1dh,51h
+			db	ech,edh,dah,3dh,9dh,95h,32h,1dh
+			db	d4h,81h,3fh,5fh,f7h,b9h,62h,d1h
+			db	31h,29h,c6h,12h,b8h,7eh,70h,f8h
+			db	5bh,88h,63h,5ch,c7h,b4h,4fh,74h
+			db	e6h,56h,87h,52h,a9h,e4h,5ch,23h
+			db	62h,53h,46h,e2h,c8h,62h,47h,d6h
+			db	5ah,2ch,e9h,e9h,f6h,d0h,0dh,dah
+			db	c4h,77h,63h,cch,3ah,2ch,a8h,b0h
+			db	1ch,1fh,3ah,b4h,4ah,fch,42h,88h
+			db	dch,6eh,f5h,8eh,d0h,88h,ceh,e0h
+			db	bah,abh,a8h,05h,b1h,b1h,6dh,81h
+			db	9bh,27h,05h,bbh,b1h,d8h,9ah,aah
+			db	47h,3dh,2dh,bbh,04h,bch,34h,bbh
+			db	1fh,78h,93h,13h,77h,47h,0ch,d8h
+			db	87h,14h,5dh,18h,45h,17h,b5h,e1h
+			db	05h,d9h,b2h,bdh,67h,efh,a0h,1eh
+			db	54h,76h,2ah,5ch,1ch,17h,30h,54h
+			db	0eh,21h,c3h,cbh,d0h,06h,e8h,cdh
+			db	02h,fah,e6h,98h,90h,f2h,69h,95h
+			db	67h,7ah,ddh,c5h,fch,10h,5ch,04h
+			db	33h,40h,4bh,e6h,edh,afh,40h,1eh
+			db	3ch,28h,7ch,e7h,33h,0eh,d7h,d4h
+			db	cdh,26h,cch,ceh,b6h,4eh,e3h,cah
+			db	64h,90h,a6h,2ah,82h,66h,2bh,b3h
+			db	3dh,3eh,3ah,dch,40h,eah,9eh,c2h
+			db	feh,78h,cah,f4h,d7h,84h,73h,26h
+			db	bbh,39h,79h,ffh,3fh,28h,f7h,31h
+			db	33h,d6h,9fh,6dh,78h,0ah,e4h,7dh
+			db	21h,a0h,8bh,b9h,0ah,92h,24h,39h
+			db	bch,06h,80h,4ch,a5h,83h,8ch,eeh
+			db	05h,8fh,f1h,bfh,94h,6ah,8ch,9bh
+			db	0bh,bdh,1dh,3eh,aah,c7h,29h,57h
+			db	e4h,d6h,05h,2dh,7ah,47h,28h,f8h
+			db	b3h,5ah,50h,fch,59h,84h,a6h,63h
+			db	4dh,e2h,67h,39h,c8h,eah,c3h,1ah
+			db	37h,89h,19h,37h,8eh,3ch,a5h,5dh
+			db	1ah,8dh,ach,12h,33h,aah,adh,74h
+			db	80h,83h,c1h,ech,b8h,e6h,c9h,efh
+			db	95h,efh,48h,20h,82h,c3h,4eh,c4h
+			db	43h,eeh,a5h,ech,6ch,f6h,ddh,6ah
+			db	37h,b2h,11h,b7h,05h,0ch,73h,42h
+			db	94h,43h,38h,6fh,7fh,66h,23h,2eh
+			db	c1h,17h,58h,7dh,aah,d1h,5fh,43h
+			db	fdh,63h,b0h,f8h,5dh,f3h,95h,03h
+			db	f4h,c6h,8dh,43h,a6h,1dh,64h,e7h
+			db	78h,40h,32h,cah,0eh,28h,6dh,06h
+			db	ebh,d2h,37h,64h,36h,55h,69h,c1h
+			db	5eh,95h,7ah,03h,58h,72h,25h,74h
+			db	a9h,7bh,ffh,43h,fbh,a4h,78h,efh
+			db	3ah,f1h,c2h,92h,92h,46h,f1h,ceh
+			db	1dh,90h,9bh,4eh,d5h,feh,b3h,76h
+			db	b7h,e2h,65h,09h,80h,6bh,29h,3eh
+			db	60h,c7h,f6h,1ch,feh,73h,81h,71h
+			db	12h,6ch,57h,6eh,2eh,3eh,24h,fbh
+			db	d0h,88h,9fh,b5h,28h,6dh,6eh,fah
+			db	abh,35h,f3h,fah,8ch,a1h,b5h,84h
+			db	ech,77h,65h,3dh,b8h,f3h,55h,81h
+			db	d7h,3bh,74h,2bh,fch,f5h,deh,9dh
+			db	8eh,c7h,7ch,30h,2ch,aeh,7eh,2ch
+			db	0fh,38h,6dh,9eh,ach,50h,82h,90h
+			db	aeh,81h,abh,31h,11h,fah,1eh,3fh
+			db	efh,66h,74h,60h,d3h,e8h,adh,e6h
+			db	74h,ddh,75h,5ah,08h,4fh,b3h,a2h
+			db	fbh,3ah,24h,c3h,2dh,41h,e3h,04h
+			db	0fh,8ch,c0h,37h,70h,f3h,10h,95h
+			db	c9h,4bh,66h,deh,0ch,20h,8fh,abh
+			db	0ch,31h,4bh,a6h,1bh,e6h,61h,0ah
+			db	cah,dbh,b9h,c6h,54h,25h,b8h,e3h
+			db	bdh,53h,a5h,e6h,fbh,3ch,4fh,05h
+			db	f3h,1ch,91h,61h,fdh,19h,f0h,1bh
+			db	5fh,bah,0dh,69h,d3h,89h,39h,c6h
+			db	d7h,54h,15h,a8h,fbh,2dh,3dh,a5h
+			db	54h,65h,39h,18h,54h,7dh,deh,63h
+			db	fbh,61h,dbh,d7h,4ch,8fh,f3h,80h
+			db	7eh,49h,d8h,8ah,8ah,6fh,b3h,36h
+			db	71h,f9h,dfh,30h,e9h,4ch,9ah,a7h
+			db	dbh,0bh,cfh,bah,97h,7ch,78h,9fh
+			db	4bh,17h,38h,84h,8eh,b6h,93h,29h
+			db	6ch,81h,ceh,b0h,8ch,e1h,19h,4eh
+			db	e7h,bah,ebh,10h,2ch,aah,85h,bch
+			db	8fh,12h,34h,0ah,a2h,cdh,34h,94h
+			db	1eh,cch,cch,16h,03h,0dh,bah,6eh
+			db	57h,70h,dbh,00h,4ch,3eh,3ch,35h
+			db	9ah,d8h,1fh,83h,34h,cah,c9h,6fh
+			db	57h,19h,c8h,c2h,26h,a4h,91h,9ch
+			db	37h,d8h,18h,b7h,07h,9bh,28h,03h
+			db	d1h,26h,e3h,6ch,86h,22h,6bh,ceh
+			db	1eh,efh,fbh,e7h,e6h,56h,b4h,0eh
+			db	bdh,c8h,ddh,61h,49h,bfh,67h,0dh
+			db	64h,8ah,23h,0ah,68h,d7h,84h,6ch
+			db	b5h,dah,42h,cfh,c6h,d0h,09h,bch
+			db	0fh,0eh,8eh,b6h,89h,22h,91h,6fh
+			db	09h,f7h,22h,82h,edh,09h,b4h,24h
+			db	c8h,c1h,0eh,6fh,6fh,49h,03h,79h
+			db	33h,50h,e3h,4ch,deh,c7h,74h,b4h
+			db	5fh,93h,12h,2eh,fbh,ddh,71h,aeh
+			db	f9h,00h,dch,23h,f6h,3fh,a9h,58h
+			db	84h,1ch,20h,02h,0ch,82h,f9h,9fh
+			db	41h,bdh,5fh,b7h,e0h,c4h,c4h,eeh
+			db	22h,68h,72h,e3h,a5h,87h,95h,5fh
+			db	44h,9eh,d9h,0eh,43h,15h,83h,d5h
+			db	c5h,85h,feh,ceh,5fh,94h,f8h,87h
+			db	d1h,95h,c4h,9ch,56h,d1h,edh,19h
+			db	c4h,d1h,1eh,50h,d4h,ebh,5ch,20h
+			db	90h,6dh,39h,f9h,e7h,5dh,99h,62h
+			db	65h,efh,66h,b7h,fch,abh,32h,a4h
+			db	e0h,41h,a9h,f8h,cdh,5dh,88h,4ch
+			db	c7h,b1h,edh,a6h,f9h,24h,bfh,f1h
+			db	25h,7bh,8eh,b1h,dah,19h,2fh,b8h
+			db	2fh,a9h,64h,58h,23h,87h,a5h,52h
+			db	27h,50h,77h,cch,6eh,0bh,3bh,dfh
+			db	f9h,a0h,95h,46h,7ah,7ch,77h,05h
+			db	2dh,73h,42h,9fh,fch,1dh,ffh,68h
+			db	b3h,f8h,b2h,e8h,d4h,68h,37h,b1h
+			db	3fh,dch,85h,a6h,04h,89h,9dh,afh
+			db	ech,ech,d7h,30h,c7h,1dh,aah,dfh
+			db	7bh,99h,bfh,7eh,7fh,37h,22h,b2h
+			db	5bh,8ah,8bh,63h,ebh,95h,40h,74h
+			db	08h,c3h,b4h,82h,5eh,edh,2ah,14h
+			db	bah,4dh,53h,f5h,40h,17h,80h,afh
+			db	4dh,97h,4bh,bfh,25h,b9h,71h,13h
+			db	14h,94h,d6h,2fh,4ch,16h,d4h,45h
+			db	5bh,6fh,2ch,84h,6bh,65h,c0h,e0h
+			db	66h,9ah,39h,99h,61h,21h,80h,0fh
+			db	76h,1ah,d5h,2ah,81h,96h,6dh,42h
+			db	00h,03h,b2h,8ch,6ch,56h,19h,bfh
+			db	36h,f5h,0ch,7ch,b1h,14h,bdh,53h
+			db	ceh,e0h,75h,81h,fdh,01h,5ah,d9h
+			db	1eh,efh,4fh,04h,17h,aeh,1eh,49h
+			db	b8h,aeh,f2h,3bh,c1h,88h,0eh,aeh
+			db	9eh,2dh,3fh,abh,aah,e2h,c5h,bdh
+			db	07h,a3h,04h,87h,10h,6bh,b0h,85h
+			db	80h,e6h,30h,8dh,c2h,b9h,16h,c3h
+			db	7bh,9ah,cch,17h,a0h,0ah,9ch,5ah
+			db	2ch,a9h,75h,8ah,61h,9ah,26h,8dh
+			db	90h,3ah,54h,bfh,e4h,30h,c0h,3ah
+			db	55h,08h,8ah,c8h,01h,b6h,f6h,8bh
+			db	48h,b2h,75h,6fh,3ch,cch,8eh,5ah
+			db	e8h,f6h,edh,73h,2ah,31h,afh,f8h
+			db	2eh,f5h,dbh,26h,c4h,68h,87h,30h
+			db	64h,b1h,52h,bch,0ch,05h,75h,42h
+			db	3fh,16h,39h,05h,69h,7fh,ech,9ah
+			db	15h,bfh,61h,07h,f1h,d4h,5eh,ddh
+			db	d7h,54h,9eh,d6h,07h,deh,93h,01h
+			db	ceh,93h,bfh,fah,e3h,73h,44h,aeh
+			db	32h,3fh,d3h,c0h,4bh,3fh,63h,07h
+			db	5eh,1ch,01h,c5h,6eh,b6h,2bh,49h
+			db	e4h,3fh,f3h,fdh,08h,4ch,bbh,36h
+			db	2ch,f8h,5bh,f6h,73h,12h,bch,e8h
+			db	c3h,47h,02h,05h,3fh,ceh,12h,e6h
+			db	01h,02h,6bh,55h,4dh,f7h,83h,14h
+			db	70h,84h,eah,65h,c8h,41h,efh,b2h
+			db	feh,b0h,48h,75h,55h,49h,57h,06h
+			db	31h,22h,b9h,77h,d0h,98h,62h,fah
+			db	95h,d3h,42h,9fh,e5h,38h,97h,dbh
+			db	51h,e9h,87h,a1h,b9h,dch,35h,65h
+			db	a6h,a6h,d2h,eah,e8h,e8h,bch,83h
+			db	95h,deh,0ah,b7h,75h,96h,2fh,97h
+			db	8fh,14h,bfh,1ah,d0h,7eh,edh,a0h
+			db	08h,b2h,1ah,c5h,58h,11h,cbh,fdh
+			db	79h,f0h,fah,bfh,b7h,55h,dfh,12h
+			db	75h,8ah,fah,dbh,bfh,70h,81h,c0h
+			db	72h,1eh,21h,bdh,5ah,5ch,b3h,96h
+			db	72h,f3h,81h,0ch,5bh,39h,e5h,e2h
+			db	cah,70h,7bh,41h,1fh,a6h,7dh,d3h
+			db	11h,02h,3ah,8ch,8bh,f0h,9fh,fah
+			db	2fh,2dh,9bh,30h,18h,13h,f7h,41h
+			db	b0h,bfh,75h,79h,30h,fbh,c4h,47h
+			db	8bh,d1h,74h,82h,b3h,f0h,05h,90h
+			db	18h,f7h,aeh,5eh,f4h,8eh,cbh,40h
+			db	11h,ceh,f9h,f2h,98h,8ah,39h,27h
+			db	87h,43h,9dh,abh,8ch,c3h,8fh,d4h
+			db	62h,a1h,efh,39h,9fh,8dh,d7h,0dh
+			db	e3h,e2h,b6h,2ah,0ch,39h,afh,d4h
+			db	dfh,98h,6bh,6ah,a1h,b9h,63h,92h
+			db	bch,bah,d1h,12h,7fh,a5h,bch,abh
+			db	41h,bdh,c3h,b1h,e0h,b1h,98h,c8h
+			db	dch,bah,dfh,b4h,01h,c9h,38h,78h
+			db	f9h,beh,62h,02h,09h,08h,84h,6fh
+			db	2ch,40h,ffh,84h,99h,6eh,18h,6dh
+			db	ech,a1h,1eh,fah,f1h,71h,8dh,17h
+			db	28h,77h,edh,29h,52h,b6h,26h,a1h
+			db	dfh,03h,03h,27h,85h,79h,51h,67h
+			db	50h,d5h,83h,0bh,a6h,51h,2fh,eeh
+			db	bbh,b7h,71h,57h,c7h,14h,a8h,8fh
+			db	7fh,5ah,fah,05h,66h,26h,98h,82h
+			db	f1h,62h,0ah,ceh,6bh,9fh,32h,a2h
+			db	46h,7ah,10h,01h,bbh,d3h,9ch,92h
+			db	37h,a8h,93h,6bh,c1h,55h,97h,ffh
+			db	75h,1bh,e8h,d3h,9dh,44h,80h,2dh
+			db	1fh,7dh,a1h,d5h,53h,40h,0eh,4dh
+			db	ffh,a1h,22h,17h,85h,d4h,49h,25h
+			db	92h,11h,9ah,a4h,19h,d7h,84h,32h
+			db	ceh,e6h,eeh,dbh,7eh,d4h,69h,76h
+			db	12h,55h,98h,e9h,6fh,02h,59h,9dh
+			db	4dh,8dh,3ch,69h,f7h,d6h,30h,24h
+			db	dch,53h,1eh,98h,0ch,aah,1bh,22h
+			db	49h,4ah,c9h,c3h,20h,d8h,7fh,21h
+			db	abh,34h,e9h,cfh,08h,5dh,8ah,cah
+			db	d4h,5ch,41h,8fh,b0h,bfh,8eh,abh
+			db	59h,ach,e4h,0dh,53h,66h,aeh,beh
+			db	a0h,57h,94h,44h,f3h,63h,55h,dch
+			db	01h,12h,8ah,6fh,3ah,82h,a0h,bch
+			db	30h,25h,6eh,5bh,ceh,c1h,4dh,fdh
+			db	fah,a3h,71h,3ch,86h,dfh,c6h,0dh
+			db	98h,09h,11h,f7h,71h,07h,89h,03h
+			db	efh,52h,a5h,67h,d9h,62h,beh,0fh
+			db	20h,04h,37h,b2h,3bh,a1h,70h,6fh
+			db	9fh,88h,1ah,d6h,6bh,50h,5ch,d7h
+			db	b9h,d2h,45h,d1h,a7h,2fh,7fh,43h
+			db	10h,32h,f6h,e6h,b9h,2ch,f9h,27h
+			db	e9h,7dh,0bh,e7h,fah,dah,31h,c1h
+			db	e4h,beh,dbh,0fh,a6h,1ah,0fh,f9h
+			db	6ah,62h,a7h,80h,eeh,8bh,a8h,85h
+			db	dfh,e2h,8bh,25h,e5h,70h,13h,2dh
+			db	bch,79h,a4h,53h,9eh,3fh,23h,d4h
+			db	3eh,3bh,e3h,5bh,39h,52h,c9h,3eh
+			db	dch,adh,46h,eeh,84h,66h,b9h,65h
+			db	b3h,c6h,11h,4eh,82h,55h,2ah,53h
+			db	d1h,cbh,03h,87h,1ch,a8h,67h,d9h
+			db	45h,cah,15h,b1h,67h,fbh,65h,e4h
+			db	06h,b6h,edh,e1h,64h,adh,46h,2bh
+			db	99h,a3h,76h,01h,91h,a0h,9dh,ach
+			db	3fh,5ch,e0h,abh,fah,c8h,cah,7dh
+			db	c9h,d9h,8eh,91h,2ch,23h,14h,3fh
+			db	efh,53h,53h,2ah,feh,e7h,12h,a2h
+			db	23h,12h,fch,b6h,7fh,feh,05h,50h
+			db	01h,44h,24h,dbh,f4h,4ah,1ch,8eh
+			db	14h,a9h,33h,d8h,3bh,72h,dah,03h
+			db	56h,4ah,6bh,e5h,cah,bdh,cah,4dh
+			db	5fh,58h,33h,3fh,f7h,abh,2ah,1bh
+			db	41h,22h,d1h,99h,31h,98h,f2h,24h
+			db	f2h,e8h,d8h,27h,70h,68h,75h,07h
+			db	a9h,46h,85h,0fh,0ah,87h,f4h,2eh
+			db	55h,fah,beh,64h,40h,a4h,26h,a7h
+			db	75h,d5h,79h,5fh,f6h,e7h,3ah,2dh
+			db	0dh,57h,dfh,92h,20h,85h,02h,72h
+			db	d2h,23h,aah,98h,7ch,78h,61h,ebh
+			db	5ah,5dh,3fh,2ah,a5h,1ch,75h,8eh
+			db	6ah,09h,23h,73h,c3h,94h,beh,cah
+			db	d6h,8eh,03h,c3h,cbh,73h,3dh,19h
+			db	4bh,a0h,01h,65h,bfh,1fh,5dh,a6h
+			db	b1h,67h,46h,a2h,6ah,7ah,8bh,d6h
+			db	03h,cbh,81h,a2h,b8h,e2h,2eh,99h
+			db	9ah,36h,1fh,9dh,ddh,7eh,a8h,4ah
+			db	6ah,0dh,0eh,5fh,1eh,4bh,c6h,4dh
+			db	78h,f3h,3eh,1fh,f7h,4ah,ach,ebh
+			db	9bh,ddh,29h,5eh,58h,34h,6ch,f3h
+			db	72h,5ch,b4h,27h,dfh,3bh,e4h,2eh
+			db	96h,88h,c7h,4eh,4dh,1bh,02h,30h
+			db	c0h,36h,54h,f3h,87h,d7h,77h,c4h
+			db	c8h,27h,45h,84h,b5h,42h,d5h,72h
+			db	c6h,47h,16h,13h,b4h,9dh,02h,d6h
+			db	feh,a3h,57h,4ch,80h,12h,76h,cah
+			db	36h,2dh,a6h,1fh,47h,abh,55h,66h
+			db	87h,50h,56h,03h,5fh,cdh,a0h,3ah
+			db	afh,20h,56h,70h,0ch,d4h,c9h,a8h
+			db	97h,3dh,53h,43h,72h,c7h,77h,10h
+			db	c6h,3fh,cbh,ebh,55h,d3h,50h,edh
+			db	f0h,eah,edh,1dh,cbh,37h,23h,67h
+			db	d9h,adh,9ch,19h,00h,12h,80h,0bh
+			db	deh,99h,57h,e2h,14h,13h,f7h,05h
+			db	ffh,1ch,84h,a9h,a7h,f5h,5eh,21h
+			db	58h,20h,70h,d9h,5ah,66h,21h,cch
+			db	ech,dah,35h,3fh,b3h,1dh,a5h,b5h
+			db	e0h,1fh,55h,a0h,7ah,40h,58h,a4h
+			db	efh,43h,6ah,05h,35h,75h,39h,14h
+			db	f3h,8fh,4eh,41h,71h,58h,d1h,55h
+			db	64h,b8h,c9h,56h,94h,b8h,cbh,a3h
+			db	99h,02h,2ah,91h,bch,2ah,c0h,7eh
+			db	9bh,26h,38h,d8h,a8h,2fh,08h,7ah
+			db	e0h,edh,2bh,c3h,19h,63h,62h,a5h
+			db	3bh,38h,aeh,06h,2dh,c7h,6ah,d3h
+			db	e8h,9dh,aeh,77h,41h,30h,d9h,62h
+			db	32h,b1h,4fh,09h,d9h,23h,6ah,64h
+			db	c7h,2dh,ach,c9h,a8h,c9h,45h,78h
+			db	92h,4ah,c1h,1ah,f3h,79h,f2h,65h
+			db	59h,94h,a0h,28h,75h,b0h,adh,43h
+			db	d2h,22h,90h,cfh,b4h,d6h,dbh,78h
+			db	d8h,cch,9eh,f5h,0ch,5dh,deh,63h
+			db	4ah,c9h,92h,00h,8fh,d3h,94h,f7h
+			db	0ch,88h,41h,f3h,a9h,24h,9ah,18h
+			db	b8h,3dh,2dh,d8h,45h,60h,40h,ach
+			db	67h,f3h,49h,1fh,f5h,b0h,c0h,d8h
+			db	29h,81h,73h,ffh,5ch,42h,aah,d1h
+			db	11h,21h,4ch,d8h,69h,5eh,05h,9ah
+			db	9ch,a0h,76h,c1h,d4h,80h,38h,8eh
+			db	72h,35h,5dh,7eh,0dh,0bh,05h,21h
+			db	a7h,55h,7dh,e8h,46h,53h,81h,67h
+			db	7ah,f6h,73h,26h,77h,3dh,beh,a2h
+			db	d6h,e2h,40h,5bh,14h,0fh,bch,5fh
+			db	e4h,24h,5eh,7ah,c6h,58h,8ch,deh
+			db	8eh,31h,9bh,2ch,11h,a3h,10h,aeh
+			db	99h,6fh,31h,00h,01h,e5h,4ch,cch
+			db	c9h,eeh,f3h,00h,b4h,fah,14h,2ah
+			db	e3h,b3h,98h,a1h,e8h,b8h,a8h,06h
+			db	51h,2ah,3dh,a8h,f5h,7eh,8eh,9bh
+			db	f5h,f8h,cfh,f2h,70h,89h,03h,a5h
+			db	7bh,deh,73h,09h,b8h,4bh,54h,5ah
+			db	54h,a8h,04h,29h,beh,eah,50h,63h
+			db	5ch,ech,48h,90h,51h,89h,98h,f1h
+			db	8ah,16h,73h,56h,deh,6dh,71h,04h
+			db	43h,aeh,93h,7ch,15h,b2h,8ah,2ah
+			db	eah,26h,d0h,c7h,cdh,ffh,57h,57h
+			db	aeh,2bh,3dh,b3h,7ah,1ch,9dh,b9h
+			db	36h,eah,e1h,e4h,52h,bbh,bfh,06h
+			db	0eh,c5h,b2h,1dh,dbh,83h,4eh,fah
+			db	0fh,0ah,89h,38h,45h,d9h,0dh,09h
+			db	5fh,2ah,f0h,bdh,64h,edh,79h,2eh
+			db	47h,c5h,ceh,93h,d0h,2fh,8bh,5bh
+			db	a6h,e0h,f8h,34h,73h,ddh,27h,54h
+			db	9fh,4dh,37h,c4h,41h,b9h,f4h,ach
+			db	6fh,44h,c1h,18h,abh,8fh,f3h,00h
+			db	5ah,f9h,b0h,7fh,c4h,b8h,c5h,a9h
+			db	78h,b5h,79h,c7h,a3h,27h
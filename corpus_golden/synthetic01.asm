@@ -0,0 +1,19035 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	12h,aeh,a7h,deh,4eh,d9h,78h,57h
+			db	8fh,b3h,b5h,78h
+
+start:						; execution starting point
+			dec	l
+			ret	c
+			inc	b
+			and	e
+			call	po,L2426
+			ld	h,e
+			ld	b,e
+			jp	pe,L7ff2
+			call	po,L5ce7
+			or	1dh
+			nop (2x) *
+			rla
+			ld	(hl),h
+			sub	b
+			ret	nz
+			rla
+			ld	l,l
+			djnz	L3ffe
+			ld	(hl),c
+			ld	e,a
+			inc	(hl)
+			ld	h,1dh
+			add	hl,hl
+			ld	d,a
+			ex	de,hl
+			jp	p,L1d75
+			rst	30h
+			ex	(sp),hl
+			xor	c
+			jr	c,L3ff1
+			ld	d,b
+			or	b
+			dec	d
+			ld	a,b
+			or	b
+			and	h
+			pop	bc
+			cp	d
+			ld	e,b
+			ret	nz
+			inc	sp
+			adc	a,a
+			or	d
+			ld	b,(hl)
+			ld	d,a9h
+			ld	h,e
+			ld	a,b
+			xor	e
+			ld	c,l
+			ret	po
+			xor	(hl)
+			ret	pe
+			ld	l,h
+			ld	c,h
+			ld	e,86h
+			exx
+			ret
+			db	45h,32h,10h,a3h,c5h,03h,2bh,d3h
+			db	5eh,39h,46h,a1h,0eh,62h,30h,10h
+			db	e6h,aeh,cbh,c0h,b7h,34h,c1h,92h
+			db	c7h,07h,6ah,9ch,5fh,efh,00h,40h
+			db	2fh,c8h,f6h,48h,64h,24h,adh,f5h
+			db	64h,9dh,7dh,7dh,71h,b8h,08h,76h
+			db	37h,d7h,30h,36h,2fh,76h,8ah,c1h
+			db	45h,fdh,4eh,1fh,b0h,46h,e2h,78h
+			db	57h,81h,ebh,e1h,96h,f0h,9eh,4ah
+			db	fah,f1h,dbh,7dh,beh,0fh,e0h,55h
+			db	34h,00h,60h,76h,aeh,5ch,76h,00h
+			db	b0h,85h,49h,5ah,06h,64h,d3h,fch
+			db	6bh,59h,b2h,c8h,f1h,39h,86h,adh
+			db	9fh,74h,4eh,b1h,64h,a4h,8eh,7fh
+			db	8eh,7fh,9fh,fdh,cfh,94h,6bh,96h
+			db	2dh,4ah,44h,cfh,14h,4ah,37h,7ch
+			db	1eh,c3h,edh,7eh,e6h,5fh,30h,68h
+			db	33h,82h,c6h,e7h,b2h,b5h,08h,1fh
+			db	19h,42h,c4h,aah,01h,47h,c4h,7eh
+			db	42h,59h,35h
+			rlca
+			ld	d,d
+			rst	10h
+			ld	(bc),a
+			xor	a
+			inc	h
+			call	nc,Lcaac
+			dec	d
+			ld	c,b
+			rst	10h
+			xor	c
+			ld	c,h
+			or	h
+			adc	a,l
+			sub	l
+			add	a,31h
+			jp	z,L7fae
+			dec	c
+			ld	a,h
+			ld	(hl),d
+			pop	ix
+			ld	a,(de)
+			dec	l
+			ret	m
+			or	b
+			rrc	a
+			ld	a,a
+			ld	c,l
+			sub	c
+			ld	c,b
+			call	L758c
+			dec	a
+			and	h
+			ld	d,l
+			ld	hl,4dc8h
+			ld	hl,(1fb9h)
+			jp	(hl)
+			db	e1h,08h,15h,d0h,dah,59h,82h,56h
+			db	beh,62h,70h,13h,f8h,cdh,4bh,abh
+			db	d5h,7fh,f3h,60h,29h,15h,e6h,f7h
+			db	26h,f0h,60h,d5h,42h,82h,99h,77h
+			db	42h,44h,a5h,8dh,d1h,a7h
+			and	l
+			halt
+			ld	d,e
+			ld	l,afh
+			cp	c
+			inc	b
+			and	l
+			dec	h
+			ld	e,e
+			inc	c
+			ld	l,h
+			cp	e
+			ld	(hl),c
+			or	h
+			nop (2x) *
+			jp	m,Lb6db
+			inc	sp
+			jr	c,L40f2
+			and	a
+			ld	c,a
+			ld	a,d
+			ld	e,e
+			djnz	L410f
+			add	a,l
+			jp	nc,L89a3
+			ld	b,31h
+			cpl
+			call	po,L3561
+			sbc	a,c
+			add	hl,sp
+			rl	l
+			inc	d
+			add	a,h
+			bit	6,c
+			dec	bc
+			call	m,L7d56
+			ld	(hl),e
+			ld	e,(hl)
+			ld	d,c
+			ld	de,bddeh
+			adc	a,94h
+			inc	(hl)
+			ld	(fa10h),hl
+			xor	b
+			in	l,(c)
+			jp	pe,L060c
+			ld	e,d
+			sbc	a,h
+			ld	b,(hl)
+			jp	pe,Lf704
+			adc	a,35h
+			rst	10h
+			pop	bc
+			add	hl,de
+			jr	c,L4120
+			call	m,L3507
+			ld	h,b
+			pop	hl
+			ld	b,(hl)
+			ld	d,b
+			jp	po,Lb1b9
+			ld	a,c
+			ld	d,a
+			and	d
+			sub	h
+			adc	a,e
+			dec	a
+			ld	e,(hl)
+			ret	nz
+			ret	m
+			jr	c,L414a
+			ret	nz
+			dec	l
+			add	hl,de
+			inc	h
+			ex	af,af'
+			ld	(hl),d
+			or	a
+			pop	af
+			inc	c
+			ld	(hl),d
+			pop	de
+			ret	po
+			ld	d,(hl)
+			or	a
+			sbc	a,23h
+			add	a,e
+			dec	d
+			ld	sp,hl
+			adc	a,l
+			daa
+			inc	(hl)
+			add	hl,bc
+			ld	a,c
+			ld	b,c
+			dec	c
+			ld	d,e
+			ld	hl,(f687h)
+			and	(hl)
+			jp	po,Lc6ad
+			jp	(hl)
+			db	68h,50h,5ah,ffh,a9h,9bh,39h,78h
+			db	4ch,72h,1fh,1eh,ach,07h,91h,43h
+			db	80h,a4h,73h,4dh,80h,52h,c9h,28h
+			db	3dh,28h,09h,18h,a8h,63h,d7h,e0h
+			call	nc,La0f2
+			sbc	a,(hl)
+			sbc	a,b
+			ld	a,d
+			ld	b,92h
+			adc	a,h
+			ld	h,e
+			rst	38h
+			sub	d
+			ld	e,b
+			rst	30h
+			ld	b,(hl)
+			dec	c
+			or	(hl)
+			inc	d
+			cp	(hl)
+			call	c,L8d51
+			sub	1fh
+			ld	hl,eca4h
+			sbc	a,d
+			ld	de,60fah
+			ld	a,d
+			adc	a,h
+			add	a,d
+			call	p,L65bf
+			ret	p
+			nop
+			ld	l,c
+			sbc	a,a
+			ret	m
+			jp	pe,L6e5f
+			and	e
+			or	(hl)
+			xor	(hl)
+			ld	h,h
+			ld	a,(bc31h)
+			ld	l,d
+			push	hl
+			xor	(hl)
+			add	a,b
+			ld	e,e
+			ld	l,l
+			rst	08h
+			cp	c
+			sbc	a,h
+			ld	l,l
+			adc	a,(hl)
+			xor	cch
+			ld	(de),a
+			ld	(hl),c
+			di
+			ld	c,beh
+			call	po,L9c79
+			inc	e
+			inc	bc
+			ld	(hl),c
+			ld	d,a
+			ld	(hl),c
+			ld	h,efh
+			ex	af,af'
+			rst	00h
+			dec	bc
+			ld	(hl),d
+			ld	d,b
+			or	b
+			inc	bc
+			ld	b,b
+			add	hl,bc
+			inc	a
+			ccf
+			ld	(de),a
+			ld	h,(hl)
+			res	7,h
+			rst	30h
+			ld	c,d
+			scf
+			sub	b
+			ld	e,b
+			call	c,Lf231
+			ld	sp,9aedh
+			adc	a,h
+			ld	c,d
+			nop (2x) *
+			bit	2,h
+			ld	h,d
+			add	a,h
+			call	po,L859f
+			ld	b,c
+			ld	l,c
+			cp	l
+			ld	d,b
+			and	3dh
+			sbc	a,(hl)
+			sub	d
+			call	m,Ld336
+			add	hl,bc
+			ld	(890ch),a
+			ld	a,h
+			adc	a,e
+			add	hl,sp
+			in	a,(4bh)
+			scf
+			ld	b,c
+			sbc	a,b
+			call	p,L13c2
+			ld	(hl),a
+			call	L5b9d
+			ld	(hl),e
+			ld	a,a
+			adc	a,e
+			rst	28h
+			ld	l,b
+			jr	z,L42d6
+			ld	l,e
+			add	a,c8h
+			inc	l
+			push	af
+			ld	h,(hl)
+			ld	l,h
+			ld	b,a
+			ld	(47bah),hl
+			adc	a,c
+			ld	b,b
+			ld	h,(hl)
+			ld	a,a
+			ei
+			ld	a,l
+			or	h
+			adc	a,b
+			ld	b,e
+			ld	sp,a14ah
+			rst	38h
+			and	(hl)
+			ld	l,e
+			ld	a,(3aafh)
+			ld	(5f14h),a
+			sub	e
+			dec	a
+			ld	(de),a
+			ld	a,(cb8eh)
+			ld	l,eah
+			ld	a,(bc)
+			and	2ch
+			ret	nc
+			out	(ceh),a
+			ld	l,b
+			ld	d,d
+			jr	nz,L42f0
+			ld	c,c
+			push	bc
+			sub	a
+			out	(fah),a
+			halt
+			push	bc
+			ld	d,d
+			push	af
+			ld	b,d
+			ld	h,a
+			sub	h
+			ld	e,(hl)
+			ld	l,c
+			inc	c
+			sbc	a,c
+			halt
+			ld	a,h
+			ld	b,(hl)
+			ld	(hl),d
+			xor	l
+			sub	e
+			call	m,L8ec3
+			or	h
+			ld	a,b
+			call	nc,L822b
+			jr	z,L432e
+			add	a,a
+			add	a,b3h
+			ex	(sp),hl
+			ld	a,c
+			pop	de
+			pop	hl
+			add	a,h
+			inc	l
+			or	a
+			add	a,h
+			and	c
+			ld	b,l
+			ld	h,d
+			ld	c,c
+			ld	a,c
+			jp	z,L0f09
+			inc	h
+			sbc	a,e
+			pop	de
+			ld	a,e
+			add	a,h
+			res	6,c
+			ld	h,a
+			ld	(L58a0),hl
+			cp	a
+			sub	aah
+			ld	l,84h
+			ld	c,b
+			adc	a,(hl)
+			ld	sp,1823h
+			push	de
+			ld	l,d
+			ld	d,h
+			or	3bh
+			push	bc
+			ld	l,e
+			ld	h,d
+			ld	a,(bc)
+			rst	20h
+			or	b
+			ld	l,l
+			ld	l,d
+			ld	b,b
+			ret	m
+			ld	c,h
+			call	L34d5
+			ld	e,ixl *
+			inc	c
+			ret	m
+			sub	b
+			sbc	a,2ah
+			ld	h,c
+			ret
+			db	55h,c8h,9eh
+			cp	e
+			sub	h
+			rst	30h
+			cp	e
+			daa
+			jp	Lee19
+			nop
+			sbc	a,99h
+			ld	a,a
+			sub	(hl)
+			or	(hl)
+			xor	b
+			ld	(fb7ah),a
+			ld	(hl),d5h
+			ld	c,(hl)
+			ld	hl,(5ef4h)
+			ex	(sp),hl
+			sbc	a,c
+			ld	h,e
+			ld	e,e
+			jr	L42ec
+			db	18h,6ch,29h,d8h,3dh,15h,08h,d7h
+			db	34h,97h,05h,54h,e2h,44h,f7h,4eh
+			db	a1h,cch,c6h,91h,12h,cbh,91h,ech
+			db	42h,bah,a2h,c3h,21h,98h
+			adc	a,b
+			ld	h,l
+			ld	a,57h
+			cp	h
+			ex	(sp),hl
+			ld	e,e
+			add	a,b
+			ret	po
+			and	l
+			dec	c
+			rst	20h
+			call	m,Ladce
+			ld	l,a
+			ld	h,a
+			ld	(7fb7h),hl
+			add	hl,hl
+			inc	c
+			ret	c
+			sbc	a,(hl)
+			jp	p,L9345
+			ld	d,c
+			sbc	a,d
+			ld	e,2fh
+			ld	c,d
+			ccf
+			nop (2x) *
+			and	7fh
+			and	30h
+			ld	h,(hl)
+			out	(3ah),a
+			inc	sp
+			jp	nc,L5f9e
+			ld	a,(bc)
+			or	c
+			or	l
+			ld	h,l
+			sbc	a,h
+			out	(c),b
+			add	hl,bc
+			ld	a,(c783h)
+			ld	(hl),00h
+			ret	pe
+			ld	d,b
+			dec	d
+			dec	hl
+			or	d
+			ld	(hl),l
+			ld	b,h
+			ld	h,c
+			dec	sp
+			ret	z
+			ld	c,b
+			inc	d
+			jp	(hl)
+			db	53h,53h
+			ld	a,b
+			ld	e,e
+			ld	c,a
+			ld	l,e
+			ld	c,c
+			sub	h
+			dec	hl
+			ld	a,(hl)
+			ld	d,b
+			dec	hl
+			xor	b
+			xor	d
+			rst	38h
+			or	b
+			ld	l,a
+			cp	0ah
+			ccf
+			ex	(sp),hl
+			add	a,(hl)
+			sbc	a,9ah
+			dec	l
+			add	a,e
+			out	(25h),a
+			exx
+			add	a,h
+			out	(0bh),a
+			ld	hl,(68dch)
+			call	m,L7f35
+			rla
+			ld	d,l
+			jp	c,L290a
+			dec	a
+			rst	30h
+			adc	a,adh
+			ld	(ff69h),a
+			ex	(sp),hl
+			ld	h,d
+			ld	c,h
+			add	hl,hl
+			sub	(hl)
+			ret	nz
+			call	pe,L0d3f
+			ld	b,h
+			call	L59f7
+			pop	de
+			adc	a,d
+			set	2,d
+			and	(hl)
+			sub	h
+			sbc	a,59h
+			inc	a
+			ld	h,b
+			sub	c
+			or	c
+			jr	nz,L43f5
+			ld	c,a
+			pop	bc
+			dec	c
+			jp	nz,Lba29
+			ld	c,(hl)
+			and	d
+			jp	L8a21
+			db	bah,c3h,aah,80h,4bh,03h,e9h,3dh
+			db	ddh,30h,cah,b3h,17h,fdh,ceh,f2h
+			db	8ah,bbh,fdh,78h,7ch,cfh,81h,b5h
+			db	afh,12h,c2h,20h,18h,5eh,dch,34h
+			db	29h,cdh,63h,ddh,43h,d4h,46h,f1h
+			db	85h,02h,d4h,a2h,bch,f4h,c5h,47h
+			db	f3h,97h,53h,48h,b8h
+			ret	pe
+			ld	c,e
+			dec	c
+			ld	e,c
+			xor	h
+			ld	sp,hl
+			inc	b
+			ld	e,e
+			xor	(hl)
+			exx
+			ld	a,(bc)
+			xor	a
+			ld	(hl),b
+			jp	pe,L856b
+			sbc	a,(hl)
+			cp	c
+			cp	d
+			jp	c,L0286
+			rst	38h
+			scf
+			or	l
+			ld	a,h
+			ld	b,l
+			ld	d,h
+			add	a,c
+			rlca
+			ld	d,a
+			jr	nz,L443c
+			xor	h
+			inc	hl
+			push	af
+			rrca
+			ld	l,e
+			jp	nc,L6f31
+			ld	b,h
+			ld	c,86h
+			ld	b,(hl)
+			cp	c
+			ld	(hl),l
+			ld	a,2dh
+			sub	e
+			ld	l,a
+			ld	d,e
+			adc	a,l
+			rra
+			ret	pe
+			jp	z,Lb714
+			ld	d,5eh
+			add	a,c
+			ld	(a58dh),hl
+			jp	nc,L782c
+			inc	d
+			jp	nz,Led88
+			jr	c,L448e
+			rst	00h
+			rst	10h
+			inc	h
+			adc	a,a
+			dec	bc
+			ld	d,(hl)
+			ld	(hl),a
+			jp	L97ed
+			db	50h,9ch,feh,e9h
+			ld	b,h
+			ld	h,(hl)
+			ld	e,d
+			add	a,d
+			ld	d,c
+			dec	sp
+			ld	h,b
+			dec	e
+			ld	de,0a22h
+			inc	c
+			di
+			dec	h
+			jp	nc,L8f5f
+			and	b
+			pop	af
+			ld	e,l
+			adc	a,c
+			dec	hl
+			ld	(hl),h
+			out	(9dh),a
+			nop (2x) *
+			ld	c,a3h
+			pop	bc
+			adc	a,l
+			jr	c,L44da
+			ret
+			db	79h,52h,36h,95h,63h,24h,77h,94h
+			db	18h,9bh,bah,30h,a8h,deh,f9h,d4h
+			call	m,Lc2d9
+			dec	bc
+			rra
+			ld	a,e
+			and	b
+			cp	a
+			ld	hl,(cc5dh)
+			ld	h,ebh
+			jr	nz,L44f6
+			ld	b,c
+			adc	a,e7h
+			and	ech
+			ld	c,a
+			push	bc
+			rra
+			adc	a,(hl)
+			ld	a,(bc)
+			ld	l,l
+			sub	h
+			inc	bc
+			rst	18h
+			adc	a,l
+			jp	La875
+			db	57h,57h,5bh,76h,84h,97h,b3h,b3h
+			db	0eh,feh,27h,63h,76h,11h,61h,c8h
+			db	19h,e0h,53h,c4h,2ch,abh
+			ret	nc
+			call	nc,L3a2e
+			add	a,28h
+			add	a,c
+			sbc	a,d9h
+			xor	e
+			jp	nc,L9740
+			inc	l
+			ld	d,a
+			ld	a,l
+			add	a,h
+			ld	l,l
+			ld	c,(hl)
+			adc	a,b
+			ld	l,a
+			ld	c,b3h
+			ld	de,1850h
+			call	Lf317
+			call	L94b3
+			ld	c,c
+			jp	z,L7e41
+			ld	b,73h
+			ld	h,e
+			call	c,L61ad
+			rla
+			rrca
+			cp	e
+			ex	af,af'
+			set	5,b
+			and	e
+			add	a,a
+			rra
+			cp	(hl)
+			dec	ixl *
+			and	efh
+			rst	00h
+			inc	a
+			sbc	a,d
+			add	a,b
+			ld	(de),a
+			ld	(hl),d
+			ld	e,a
+			ex	af,af'
+			ld	a,d
+			scf
+			cpl
+			sbc	a,h
+			ld	c,h
+			ret	m
+			nop (2x) *
+			ld	d,b
+			sbc	a,d
+			jr	L4515
+			db	f3h,01h,67h,d2h,29h,d8h,62h,38h
+			db	9eh,4fh,d7h,cfh,3bh,14h,8fh,16h
+			db	3bh,c5h,aah,5ah,40h,49h,7ah,c0h
+			db	b3h,93h,53h,0bh,cbh,d4h,13h,0bh
+			db	e9h,6ah,a7h,73h,2bh,15h,5bh,63h
+			db	2ch,7bh,a5h,68h,23h,56h,dah,16h
+			db	bfh,abh,2ch,33h,f5h,26h,2bh,79h
+			db	94h,05h,79h,02h,8dh,67h,32h,90h
+			db	ddh,d5h,70h,50h,63h,a5h,48h,dch
+			db	74h,e6h,21h,a7h,0bh,aeh,2eh,32h
+			db	f8h,2ch,9eh,55h,15h,f6h,52h
+			cp	a
+			ret	nc
+			sbc	a,l
+			jp	(hl)
+			db	8fh,40h,7eh,29h,3dh,60h,ach,e7h
+			db	7eh
+			nop (2x) *
+			adc	a,h
+			ld	b,l
+			rl	c
+			ld	c,h
+			push	bc
+			adc	a,a
+			or	a
+			sub	(hl)
+			add	a,d
+			ld	d,a
+			ret
+			db	a1h,d9h,78h,4bh,a8h,73h,35h,83h
+			db	2ch,85h,73h,3fh,07h,51h,14h,a4h
+			db	b1h,fdh,16h,e7h,36h,75h,f3h,b1h
+			db	cbh,5eh,eeh,ffh,54h,a9h,63h,54h
+			db	b7h,1eh,6ch,40h,10h,5dh,02h,7fh
+			db	e2h,d7h,b8h,f8h,7fh,71h,c4h,23h
+			db	d6h,6eh,a0h,3eh,3dh,03h,bch,32h
+			db	5ah,a9h,8bh
+			ld	c,b
+			ld	h,h
+			xor	d
+			xor	b
+			ld	e,l
+			ld	e,(hl)
+			dec	e
+			ld	e,b
+			cpl
+			cpl
+			ret	nc
+			adc	a,e
+			and	(hl)
+			inc	a
+			ld	e,(hl)
+			rst	08h
+			inc	b
+			ld	(hl),b
+			adc	a,h
+			ld	sp,254bh
+			adc	a,e
+			inc	l
+			add	a,h
+			jr	z,L45f7
+			jp	po,L0b3d
+			ld	(hl),c
+			djnz	L4599
+			halt
+			xor	c
+			call	z,Lde6b
+			ld	a,r
+			out	(a4h),a
+			sbc	a,56h
+			jp	p,L6ec5
+			cp	(hl)
+			and	h
+			sub	(hl)
+			cpl
+			jr	L4675
+			db	a4h,56h,4bh,60h,44h,4ah,81h,72h
+			db	d5h,8fh,2dh,a9h,99h,e5h,79h,a3h
+			db	fch,aeh,e9h,5fh,54h,56h,bfh,f3h
+			db	09h,65h,39h,f1h,09h,75h,b7h,e1h
+			db	08h,f6h,6bh,31h,43h,42h,97h,94h
+			db	36h,63h,b6h,5fh,e5h,48h,06h,beh
+			db	5ch,79h,9bh,41h,e0h,3ah,fdh,cbh
+			db	f5h,cah,84h
+			inc	c
+			jp	m,L8925
+			di
+			out	(e2h),a
+			ld	b,c
+			and	a
+			rst	28h
+			ret	m
+			inc	b
+			ld	a,h
+			rst	08h
+			ld	a,(5f58h)
+			ld	d,a
+			dec	c
+			call	c,L97ca
+			pop	de
+			jp	L110e
+			db	b4h,35h,9ah,07h,7ah,70h,c8h,17h
+			db	8fh,5ah,24h,aeh,cch,99h,b5h,b4h
+			db	4fh,60h,92h,b0h,34h,4ah,c6h,5eh
+			db	f4h,8ah,6dh,b2h,cch,98h,04h,f2h
+			db	07h,feh,62h,c4h,d2h,26h,7fh,a9h
+			db	85h,b5h,84h,ach,c7h,90h,17h,b5h
+			db	d5h,13h,eeh,2eh,75h,0ah,11h,75h
+			db	ebh,bah,28h,21h,74h,4ch,54h,2ch
+			db	43h,e1h
+			add	a,93h
+			add	a,d
+			call	nz,Le205
+			jp	pe,L0a5b
+			sbc	a,18h
+			rst	10h
+			ret	c
+			adc	a,c
+			rst	10h
+			or	e
+			ld	b,e
+			ld	c,(hl)
+			ld	l,e
+			or	3bh
+			jp	z,Le489
+			ld	h,e
+			add	a,a8h
+			ld	b,44h
+			ld	ixh,e *
+			cp	b
+			add	a,d
+			adc	a,c
+			halt
+			ld	c,e
+			ld	sp,20fah
+			or	deh
+			ex	af,af'
+			ld	(4a3eh),a
+			ld	d,e
+			ret	c
+			nop (2x) *
+			nop
+			sbc	a,c
+			jr	z,L4739
+			ld	h,b
+			add	a,c
+			sbc	a,a
+			nop (2x) *
+			exx
+			ret	nc
+			or	e
+			sub	c
+			ld	a,(1fc5h)
+			adc	a,l
+			and	(hl)
+			ret	z
+			adc	a,e3h
+			or	h
+			and	e
+			dec	h
+			out	(01h),a
+			call	nc,L9bb9
+			ccf
+			ld	c,l
+			ld	(de),a
+			ld	l,a
+			dec	de
+			add	a,b1h
+			adc	a,d
+			ret
+			db	40h,2bh,f5h,d0h,85h,1ah,11h,c5h
+			halt
+			ld	e,l
+			or	l
+			dec	(hl)
+			ld	b,b
+			ld	a,e
+			sbc	a,a
+			ld	(hl),c
+			push	hl
+			ret	pe
+			nop (2x) *
+			ld	c,3ch
+			inc	de
+			rst	30h
+			rst	28h
+			ret	z
+			ld	e,c
+			sub	a
+			ex	(sp),hl
+			ret	c
+			ld	(hl),a
+			or	(hl)
+			pop	hl
+			call	z,L4e90
+			sbc	a,5eh
+			rra
+			ld	e,b
+			push	hl
+			dec	a
+			ld	c,h
+			jp	nc,L7e06
+			sub	e
+			jp	L3566
+			db	27h
+			call	p,L4776
+			ld	d,02h
+			ld	l,h
+			ld	l,d
+			jp	m,L6504
+			ret	nc
+			ld	d,(hl)
+			sbc	a,(hl)
+			cp	e
+			ld	l,a
+			jp	z,L756c
+			rst	28h
+			inc	hl
+			sub	l
+			ld	d,d
+			jr	z,L473e
+			ld	b,l
+			ld	(ix + 09h),d
+			dec	sp
+			cp	31h
+			ld	a,d
+			sbc	a,l
+			dec	b
+			and	(hl)
+			add	a,d
+			ret
+			db	1ch,7ch,8eh,29h,a5h,52h,8eh,82h
+			db	16h,59h,8ch,85h,1eh,dah,ech
+			ld	d,02h
+			add	hl,hl
+			rst	28h
+			dec	b
+			ld	(hl),h
+			ld	(de),a
+			ld	a,a
+			sub	h
+			sub	e
+			ld	sp,hl
+			or	c
+			jp	p,L05de
+			ld	(hl),l
+			ld	de,b028h
+			dec	a
+			sbc	a,c8h
+			adc	a,(hl)
+			dec	de
+			push	de
+			ld	(hl),b
+			ld	e,d
+			ld	e,a
+			dec	a
+			ret	po
+			ld	l,b
+			or	h
+			ret	pe
+			adc	a,d
+			jp	pe,Leea7
+			add	a,l
+			ld	sp,hl
+			ld	b,5dh
+			ld	d,b
+			ld	l,a
+			ld	e,f5h
+			dec	h
+			ld	c,(hl)
+			dec	bc
+			cp	h
+			xor	(hl)
+			push	af
+			ld	a,(bc)
+			ld	h,c
+			or	b
+			rst	20h
+			ld	hl,(6649h)
+			sbc	a,b
+			add	a,78h
+			or	l
+			or	e
+			dec	a
+			ld	(0af7h),a
+			ld	sp,ix
+			and	h
+			jp	L3ddc
+			db	cfh,54h,b2h,9ch,2fh,54h,80h,5ah
+			db	feh,0ah,63h,64h,5dh,79h,e8h,86h
+			db	cch,4fh,78h,ddh,6fh,a5h,27h,7bh
+			db	e5h,99h,a5h,85h,a2h,59h,bah,41h
+			db	3eh,3ch,5dh,22h,8ah,44h,a1h,39h
+			db	9dh,97h,cbh,c7h,8ch,8dh,ach,bch
+			db	0eh,3bh,85h,ebh,58h,1bh,edh,f8h
+			db	5fh,64h,a3h,4dh,54h,d8h,33h,8bh
+			db	5dh,18h
+			cp	b
+			ld	(5737h),a
+			jr	z,L4839
+			add	hl,de
+			ld	d,23h
+			nop (2x) *
+			ret	pe
+			ld	(hl),63h
+			dec	b
+			add	hl,bc
+			dec	e
+			or	c
+			ld	a,(88b4h)
+			dec	(hl)
+			inc	sp
+			sub	b
+			cp	h
+			and	c
+			dec	l
+			ld	h,e
+			ld	h,7eh
+			adc	a,l
+			ld	a,h
+			ld	(hl),b
+			and	e
+			jr	z,L4882
+			and	h
+			ld	(hl),c
+			cpl
+			add	a,c
+			ld	(de),a
+			sub	(hl)
+			ld	b,b
+			ccf
+			pop	af
+			ld	(bc),a
+			and	(hl)
+			dec	(hl)
+			ld	l,l
+			nop
+			nop
+			add	a,b
+			ld	l,(hl)
+			ld	a,(hl)
+			ld	l,b
+			jr	nz,L4855
+			dec	h
+			im	0/1 *
+			ld	h,e
+			jp	L93b0
+			db	d9h,25h,97h,5bh,3ch,bbh,88h,1bh
+			db	65h,6ah,e8h,1eh,f2h
+			dec	(hl)
+			push	de
+			sub	h
+			jp	p,Ld8c7
+			sbc	a,e
+			ld	b,(hl)
+			and	e
+			cp	a1h
+			or	d
+			ld	l,(hl)
+			ld	e,b
+			dec	d
+			ld	d,l
+			scf
+			adc	a,b
+			adc	a,e
+			dec	l
+			ld	h,h
+			out	(50h),a
+			adc	a,d
+			adc	a,c
+			ret	m
+			sub	d
+			add	a,b
+			cp	d
+			dec	c
+			jr	c,L4811
+			adc	a,e
+			ret	nc
+			or	d
+			ld	e,h
+			adc	a,ech
+			ld	b,(hl)
+			ld	d,b
+			ld	(hl),a
+			djnz	L4811
+			cpl
+			rst	28h
+			and	b
+			dec	(hl)
+			jp	nc,Lb719
+			add	a,b
+			ld	e,(hl)
+			ld	d,d
+			ld	l,l
+			inc	sp
+			ld	(hl),e
+			cp	2bh
+			adc	a,l
+			xor	(hl)
+			rst	18h
+			dec	sp
+			and	(hl)
+			call	c,L44d1
+			sub	c
+			xor	a
+			dec	sp
+			sbc	a,70h
+			cpl
+			sub	d
+			add	a,d
+			ld	(hl),e
+			inc	bc
+			ld	b,(hl)
+			nop
+			jp	pe,L0a33
+			or	a
+			sbc	a,l
+			jp	nc,L9a5e
+			ld	b,e
+			call	nz,Ld101
+			ld	l,b
+			push	de
+			ccf
+			dec	b
+			sub	e
+			xor	b
+			ld	a,(de)
+			ld	h,c
+			ld	c,c
+			ld	a,b
+			inc	a
+			ld	b,b
+			inc	d
+			ld	(bc),a
+			cpl
+			inc	b
+			ld	e,b
+			adc	a,17h
+			jp	pe,L12cd
+			ld	h,(hl)
+			ret	m
+			sub	b
+			add	a,d
+			ld	a,(a98eh)
+			ld	e,a
+			pop	af
+			di
+			dec	(hl)
+			exx
+			call	z,Lbf46
+			ld	d,l
+			sub	b
+			ld	a,(bc)
+			xor	a
+			ld	(hl),h
+			xor	dah
+			inc	h
+			and	00h
+			ld	h,h
+			ld	b,c
+			ret	p
+			rst	30h
+			sub	l
+			and	e
+			add	hl,de
+			call	L38e0
+			ld	e,l
+			jp	nz,L09fd
+			halt
+			adc	a,d
+			sbc	a,d
+			or	l
+			and	b
+			cpl
+			ld	bc,a1d4h
+			dec	h
+			ld	b,h
+			dec	d
+			dec	b
+			pop	af
+			inc	hl
+			add	a,e
+			di
+			add	a,a
+			ld	c,l
+			daa
+			ld	c,9fh
+			pop	de
+			ld	c,h
+			rla
+			jp	nz,Ld7b2
+			rst	20h
+			ld	a,l
+			ld	a,a
+			rst	18h
+			ld	e,f0h
+			adc	a,h
+			rst	38h
+			ld	hl,(fed2h)
+			ld	hl,eaf6h
+			ld	d,b
+			ld	l,d
+			dec	b
+			add	a,bch
+			ld	h,c
+			ld	(hl),e
+			ld	c,b
+			rrca
+			sbc	a,(hl)
+			inc	e
+			ld	c,(hl)
+			dec	de
+			ld	b,l
+			ld	(de),a
+			rra
+			sbc	a,d
+			ei
+			sub	l
+			ld	b,h
+			ld	l,l
+			call	po,L1535
+			ld	e,e
+			pop	de
+			sbc	a,(hl)
+			sub	b9h
+			ld	a,(hl)
+			inc	hl
+			cp	e
+			ret	c
+			add	hl,sp
+			sub	e
+			djnz	L498a
+			ld	d,(hl)
+			add	a,c
+			sub	l
+			cp	e
+			or	(hl)
+			ld	b,c
+			sbc	a,(hl)
+			ld	e,l
+			jr	nc,L4955
+			ld	e,c
+			inc	d
+			sbc	a,c
+			xor	e
+			or	57h
+			ld	e,b
+			cpl
+			cp	4fh
+			jp	po,Lfecb
+			ld	(hl),c
+			sub	h
+			jr	z,L496f
+			ld	b,3ch
+			adc	a,a
+			inc	b
+			sub	l
+			add	hl,sp
+			sub	l
+			jp	nc,L05e7
+			daa
+			inc	d
+			rl	l
+			adc	a,(hl)
+			nop (2x) *
+			cp	h
+			ld	c,(hl)
+			xor	c
+			add	a,l
+			nop
+			add	a,a
+			pop	bc
+			ret	c
+			ld	d,h
+			adc	a,d
+			dec	a
+			add	a,e
+			ret	pe
+			sub	h
+			sbc	a,(hl)
+			ld	(hl),b
+			and	a
+			dec	sp
+			and	d
+			ld	l,l
+			sub	l
+			jr	nc,L49c4
+			rst	08h
+			or	(hl)
+			sbc	a,e
+			ld	h,e
+			push	de
+			call	L8254
+			ld	e,c
+			ld	a,h
+			and	(hl)
+			ld	h,d
+			sbc	a,c
+			ld	e,b
+			call	m,L9246
+			and	h
+			rst	18h
+			cp	a
+			add	hl,bc
+			ld	a,c
+			call	nc,L60b5
+			rst	00h
+			inc	(hl)
+			inc	c
+			ld	(hl),l
+			ld	a,(de)
+			rst	28h
+			ld	l,c
+			dec	(hl)
+			inc	de
+			cp	b2h
+			dec	e
+			cp	e
+			and	d
+			ret
+			db	9bh,20h,46h,41h,deh,9ch,3fh,4fh
+			db	bah,55h,8eh,79h,7dh,d8h,96h,d9h
+			db	cbh,8bh,51h,61h,6ch,49h,48h,f7h
+			db	a8h,37h,7eh
+			xor	h
+			ld	l,c
+			ld	b,78h
+			or	c
+			rst	00h
+			ld	d,e
+			dec	sp
+			ld	l,h
+			scf
+			ld	sp,3724h
+			ld	l,a
+			ld	h,(hl)
+			call	nc,L816f
+			sbc	a,e
+			or	a
+			ld	a,h
+			jp	pe,Lf167
+			adc	a,b
+			call	z,L4eeb
+			xor	a
+			nop
+			ld	c,l
+			out	(64h),a
+			add	hl,de
+			ccf
+			ld	l,c
+			call	z,L1559
+			inc	de
+			ld	e,e
+			ret	m
+			dec	d
+			ld	(hl),b
+			nop (2x) *
+			rst	28h
+			add	a,h
+			adc	a,e
+			ld	(hl),feh
+			push	hl
+			ld	l,e
+			dec	sp
+			ld	b,b
+			jp	pe,Lf0bd
+			and	b
+			ld	l,l
+			cp	h
+			ret	m
+			ld	c,l
+			ld	de,bb13h
+			call	L9d3f
+			inc	a
+			ld	b,a
+			nop
+			ld	(de),a
+			rla
+			sub	b
+			xor	h
+			inc	b
+			ld	c,(hl)
+			dec	de
+			ld	h,(hl)
+			ld	e,e
+			call	m,La18f
+			ld	b,(hl)
+			jp	(hl)
+			db	31h,01h,cbh,9ah,c3h,72h,0ch
+			or	c
+			adc	a,l
+			nop (2x) *
+			sbc	a,a
+			ld	a,1fh
+			ld	(hl),e
+			rla
+			out	(31h),a
+			and	2eh
+			jp	z,Lb7fb
+			ld	(hl),02h
+			or	d
+			inc	sp
+			ld	l,a
+			jp	L5e50
+			db	c2h,8ch,07h,70h,60h,71h,68h,4eh
+			db	2ah,beh,81h,35h,abh,a4h,9ch,23h
+			db	6eh,36h,24h,f4h,93h,b9h,87h,2ah
+			db	56h,2fh,bbh,08h,17h,d4h,58h,f6h
+			db	6dh,9ch,b1h,18h,6fh,c2h,98h,57h
+			db	efh,1eh,f5h,d7h,4fh,86h,0bh,9dh
+			db	60h,f6h,b2h,d9h,bch
+			ret	po
+			scf
+			ld	c,c
+			ld	c,b
+			ld	a,d
+			ret	nc
+			ld	b,l
+			ex	af,af'
+			ld	l,(hl)
+			ld	a,h
+			jr	z,L4a22
+			or	(hl)
+			ld	c,b
+			ld	hl,b584h
+			and	l
+			jp	nc,L9067
+			sub	a
+			ld	a,l
+			adc	a,a
+			ld	a,(de)
+			dec	a
+			ret	p
+			ld	a,a
+			inc	de
+			ld	d,e
+			add	a,d
+			ld	h,a
+			adc	a,b
+			add	a,e
+			xor	h
+			ld	a,3ch
+			jr	nz,L4a0b
+			ld	(hl),b
+			ld	e,d
+			dec	hl
+			nop (2x) *
+			or	c
+			ld	h,(hl)
+			dec	l
+			inc	hl
+			ld	b,d
+			nop
+			ret	c
+			ld	l,d
+			xor	h
+			inc	bc
+			xor	b
+			ld	d,f9h
+			dec	h
+			djnz	L4a61
+			cp	a
+			ld	c,l
+			rst	10h
+			ret	z
+			ret	c
+			jp	p,Lc5cd
+			halt
+			ret	pe
+			in	a,(cah)
+			ld	e,(hl)
+			ex	af,af'
+			ld	sp,hl
+			adc	a,(hl)
+			and	h
+			pop	de
+			ld	c,a
+			add	a,a
+			dec	sp
+			ret
+			db	cbh,8fh,e1h,60h,21h,1dh,04h,09h
+			db	edh,a0h,38h,d3h,9eh,f0h,52h,c9h
+			db	95h,bch,c6h,eah,80h,95h,42h,82h
+			db	c9h,4bh,a6h,47h,01h,97h,b2h,11h
+			rlca
+			inc	bc
+			ld	b,a
+			ld	a,h
+			pop	af
+			ccf
+			ld	(hl),c
+			ld	(hl),c
+			or	b
+			sub	h
+			cpl
+			ld	a,l
+			dec	de
+			ld	e,b
+			rlca
+			inc	l
+			rst	30h
+			inc	sp
+			sub	c
+			dec	hl
+			sbc	a,a
+			inc	hl
+			ld	(hl),c
+			ld	a,91h
+			dec	b
+			adc	a,l
+			ld	a,(e041h)
+			inc	c
+			and	d
+			and	(hl)
+			or	l
+			add	hl,bc
+			sub	e
+			cp	b
+			sub	h
+			and	b
+			adc	a,deh
+			exx
+			add	hl,de
+			ld	e,c
+			push	hl
+			ld	a,e
+			ld	b,h
+			in	a,(46h)
+			ld	h,e
+			ld	bc,c34ah
+			ld	sp,65f6h
+			ld	(hl),e
+			ld	bc,a397h
+			rlca
+			ld	c,h
+			ld	c,l
+			dec	l
+			sub	74h
+			ld	c,afh
+			rlca
+			ret
+			db	5bh,cdh,98h,ebh,45h,5fh,8dh,66h
+			db	16h,50h,42h,4fh,cah,d1h,bdh,c5h
+			db	02h,6dh,27h,d8h,8ch,5ch,02h,6dh
+			db	27h,68h,ceh
+			ld	sp,hl
+			ret	z
+			ld	h,a
+			dec	bc
+			adc	a,d
+			inc	d
+			ld	b,a
+			dec	l
+			dec	e
+			ld	e,a
+			ld	a,(6a7ch)
+			di
+			ld	a,b
+			ld	c,b
+			rst	10h
+			sbc	a,c
+			ld	a,(8147h)
+			jp	z,L8711
+			rlca
+			add	a,d
+			ret	nc
+			cp	b
+			dec	h
+			or	b
+			pop	hl
+			call	z,Ld864
+			ld	d,d6h
+			add	a,l
+			rra
+			ccf
+			ld	l,a
+			cp	c
+			out	(e3h),a
+			or	b
+			inc	b
+			halt
+			ret	nz
+			halt
+			or	h
+			rst	10h
+			daa
+			ld	l,a
+			scf
+			ld	b,(hl)
+			call	p,Lcb05
+			rla
+			ld	(cb83h),hl
+			ld	d,a
+			sbc	a,l
+			cp	a
+			jr	nz,L4b78
+			ld	e,e
+			or	e
+			ret	pe
+			ld	d,a
+			ex	de,hl
+			rst	28h
+			ld	h,d
+			in	a,(b6h)
+			dec	a
+			push	hl
+			ld	de,9501h
+			adc	a,e
+			and	h
+			sbc	a,(hl)
+			and	d
+			dec	e
+			ld	c,b
+			dec	bc
+			add	a,a
+			ld	(8d03h),a
+			dec	d
+			jp	z,L396c
+			ld	b,0dh
+			xor	l
+			rst	10h
+			call	po,Lf1db
+			sub	1ah
+			inc	(hl)
+			cpl
+			xor	b
+			jp	pe,L0eb2
+			sub	c
+			rst	30h
+			rrca
+			ld	d,(hl)
+			cp	a
+			ld	a,(c6a8h)
+			ld	(hl),h
+			ld	l,13h
+			ld	sp,hl
+			ei
+			jr	nc,L4b6c
+			add	a,45h
+			inc	a
+			cp	h
+			jr	L4bf1
+			db	f4h,07h,68h,10h,6fh,32h,d6h,e7h
+			db	2dh,02h,6bh,a0h,38h,01h,38h,e0h
+			db	22h,26h,57h,57h,0ch,8bh,2ch,18h
+			db	e3h,fch,9ch,a3h,8dh,5fh,f3h,d0h
+			db	ffh,84h,8fh,45h,0fh,3fh,17h,5bh
+			db	c7h,afh,76h,ffh,54h
+			ld	(hl),c
+			ld	b,c
+			ld	a,c
+			ld	b,e
+			ld	l,f1h
+			add	a,b6h
+			sub	69h
+			adc	a,l
+			xor	(hl)
+			ld	(hl),c8h
+			jp	L623c
+			db	fah,04h,d4h,1dh,e6h,07h,69h,6fh
+			db	dfh,52h,41h,6ch,4ch,b2h,d6h,41h
+			db	11h,77h,fbh,55h,c7h,1ah,07h,6dh
+			db	60h,f8h,70h,58h,00h,c3h,bbh,ach
+			db	bbh,e1h,9fh,c3h,85h,03h,6ah,62h
+			db	22h,edh,6ah,e1h,8dh,81h,75h,3ch
+			db	f4h,d9h,0dh
+			ex	de,hl
+			add	a,b
+			cp	(hl)
+			inc	(hl)
+			add	a,e
+			pop	bc
+			dec	c
+			and	l
+			jp	nc,L9959
+			scf
+			or	e
+			cp	b
+			sbc	a,b
+			adc	a,e
+			ld	l,b
+			ld	b,e
+			jr	nz,L4be3
+			ld	(hl),h
+			ld	e,c
+			ld	a,(hl)
+			cp	e
+			rrca
+			xor	(hl)
+			ld	e,a
+			add	a,b
+			in	a,(25h)
+			sub	d
+			ld	de,d844h
+			ld	c,d
+			jp	pe,L5414
+			adc	a,(hl)
+			jr	z,L4c42
+			and	a
+			ld	h,d
+			ld	a,b
+			ld	d,a
+			jp	pe,Lb70e
+			add	hl,hl
+			sbc	a,(hl)
+			ld	(hl),c
+			ld	(996ch),a
+			ex	de,hl
+			nop (2x) *
+			ld	d,h
+			inc	l
+			ld	(hl),d
+			rst	10h
+			jp	c,Lb4eb
+			ret	z
+			add	a,b
+			ld	h,(hl)
+			pop	de
+			sbc	a,h
+			call	p,L95ff
+			di
+			call	nc,Lb87d
+			ld	(hl),b
+			inc	c
+			sub	h
+			ld	b,e
+			dec	l
+			ld	b,d
+			push	af
+			ld	c,b
+			ld	c,l
+			cp	d
+			pop	af
+			rlca
+			ld	a,a
+			cp	06h
+			inc	hl
+			ld	h,l
+			cp	e
+			sbc	a,8eh
+			ld	a,h
+			sub	l
+			add	a,h
+			out	(9eh),a
+			ld	c,(hl)
+			halt
+			sub	(hl)
+			ld	c,h
+			dec	(hl)
+			ret	nc
+			or	(hl)
+			rrca
+			sub	6dh
+			pop	af
+			adc	a,a
+			ld	l,b
+			sbc	a,d
+			jp	m,Lb5dc
+			add	a,d
+			sub	c
+			cp	d
+			ld	d,e
+			add	a,l
+			sub	l
+			pop	de
+			ret	m
+			jp	z,L25bf
+			add	a,(hl)
+			push	hl
+			add	hl,bc
+			ld	a,b
+			and	h
+			xor	88h
+			jp	m,L0ae2
+			dec	de
+			ld	sp,hl
+			ld	(bc),a
+			add	a,b
+			xor	d
+			inc	a
+			ld	(bc),a
+			ld	l,a
+			add	a,c
+			pop	af
+			sub	(hl)
+			ret	nz
+			cp	e
+			call	nc,L7fa0
+			dec	d
+			call	po,Lf5dc
+			ld	h,b
+			ld	b,h
+			ld	a,(0152h)
+			and	c
+			jp	c,L0947
+			ld	e,b
+			ld	e,l
+			rlca
+			push	de
+			ei
+			ld	c,(hl)
+			or	4ah
+			pop	af
+			add	hl,hl
+			cp	45h
+			dec	sp
+			ld	de,86f2h
+			and	a
+			add	hl,sp
+			dec	hl
+			dec	l
+			and	69h
+			ld	(9284h),hl
+			ld	l,h
+			ld	c,e
+			ld	c,a
+			sbc	a,6fh
+			sra	d
+			ld	e,e
+			rst	38h
+			ret	z
+			ld	d,d
+			ld	b,c
+			ld	h,d
+			call	L25f8
+			djnz	L4cc3
+			sub	h
+			ld	c,a
+			ld	a,20h
+			xor	h
+			scf
+			ld	a,b
+			ld	a,(bc)
+			ld	(hl),e
+			cp	h
+			call	z,L1400
+			xor	c
+			ld	bc,e4b0h
+			cp	l
+			adc	a,d
+			cp	23h
+			adc	a,l
+			inc	bc
+			ld	l,(hl)
+			ld	de,a29fh
+			ld	(hl),f7h
+			ld	e,d9h
+			dec	hl
+			sub	84h
+			and	a
+			jp	L8052
+			ld	d,e
+			push	af
+			call	pe,L4eab
+			ld	c,l
+			xor	d
+			halt
+			jr	z,L4d72
+			ld	(hl),36h
+			ret	c
+			ld	b,a
+			ex	af,af'
+			call	z,L5255
+			sub	c
+			ld	l,h
+			and	c
+			call	nz,Lfe2d
+			ld	c,e
+			ex	de,hl
+			cp	l
+			sub	h
+			sub	(hl)
+			sbc	a,h
+			call	po,La745
+			ld	e,l
+			ld	a,b
+			pop	af
+			and	(hl)
+			rst	20h
+			jp	po,L4d34
+			ld	l,b
+			ld	d,b
+			xor	l
+			ld	a,e
+			inc	sp
+			jp	p,L5b9d
+			ld	sp,hl
+			xor	d
+			xor	b
+			adc	a,e
+			nop (2x) *
+			ld	h,l
+			dec	b
+			ld	h,d
+			nop (2x) *
+			rst	00h
+			jp	p,L9cc2
+			ld	(hl),b
+			ld	b,d
+			ld	bc,d0f8h
+			inc	d
+			nop (2x) *
+			call	z,L3fc9
+			ld	a,(b181h)
+			ld	c,b
+			ret	nc
+			sub	d
+			ld	(hl),c
+			sbc	a,(hl)
+			ld	c,e
+			sbc	a,d
+			jp	(hl)
+			db	f2h,6ah,cbh,9ch,81h,d0h,c4h,41h
+			db	bdh,eeh,f2h,63h,ddh,34h,51h,46h
+			db	64h,b9h,26h,28h,eah,0ah,6bh
+			ld	e,a
+			pop	de
+			ld	b,78h
+			ld	(hl),b
+			ret	m
+			inc	bc
+			ld	a,8bh
+			ld	h,l
+			sub	(hl)
+			jp	p,L7034
+			dec	(hl)
+			ld	d,l
+			ld	e,l
+			xor	e
+			ld	c,c
+			dec	h
+			ld	h,e
+			adc	a,8ch
+			add	a,b
+			ld	d,b
+			ld	e,e
+			ld	(hl),a
+			ld	l,(hl)
+			nop (2x) *
+			dec	b
+			ld	e,c
+			call	c,L2bd8
+			ld	(hl),e
+			ld	d,h
+			add	a,h
+			add	hl,hl
+			cp	25h
+			ld	l,l
+			ld	b,e
+			pop	bc
+			push	bc
+			inc	l
+			adc	a,c
+			call	po,L1268
+			ld	d,(hl)
+			ld	d,e
+			and	d
+			call	c,Leb65
+			ld	l,e2h
+			jp	Lb8e2
+			db	43h,48h,99h,3eh,24h,3fh,adh,35h
+			db	54h
+			jp	po,L05c8
+			ld	h,b
+			call	nz,Lfa7a
+			inc	hl
+			ret	po
+			ld	c,(hl)
+			jp	nz,La460
+			add	a,h
+			ex	af,af'
+			inc	bc
+			exx
+			dec	bc
+			dec	d
+			ld	d,l
+			ret
+			db	7ah,c5h,84h,5ch,80h,bch,60h,9dh
+			db	59h,53h,e9h,4dh,9dh,26h,88h,7fh
+			db	46h,48h,96h,48h,32h,6eh,a6h,4dh
+			db	7ch,4eh,2ah,c3h,2eh,cfh,20h,e7h
+			db	79h,b3h,37h,50h,54h,ach,7eh,1ah
+			db	4dh,1bh,11h,03h,98h,2ah,4fh,1fh
+			db	84h,3bh,03h,86h,e4h,5bh,95h,0ah
+			db	a3h,d8h,46h,b7h,bah,66h,9ah,71h
+			db	deh,8ah,62h,0eh,85h,d5h,bfh,d2h
+			db	83h,39h,83h,25h,d7h,7ah,8fh,11h
+			db	01h,6bh,61h,beh,29h,04h,9bh,1fh
+			db	3bh,54h,7fh,38h,ebh,08h,55h,a2h
+			db	f8h,1ch,aah,39h,d3h,2bh
+			and	h
+			or	d
+			jp	m,L1cd1
+			inc	h
+			ex	de,hl
+			ret	c
+			and	(hl)
+			pop	af
+			ld	h,b
+			ret	pe
+			ld	e,h
+			or	l
+			set	6,c
+			ld	a,(de)
+			inc	bc
+			ld	(de),a
+			sub	h
+			xor	(hl)
+			ret	z
+			ld	d,(hl)
+			ret	p
+			pop	bc
+			inc	(hl)
+			dec	d
+			adc	a,c
+			dec	a
+			add	a,a
+			ld	(hl),l
+			ld	l,e
+			ld	(de),a
+			jp	p,Ldffb
+			adc	a,82h
+			add	hl,hl
+			cp	d
+			sbc	a,e
+			jp	m,L140b
+			ex	(sp),hl
+			xor	l
+			djnz	L4e5b
+			dec	a
+			ld	e,b
+			exx
+			or	c
+			adc	a,l
+			ld	(hl),32h
+			and	h
+			sbc	a,d
+			di
+			rst	38h
+			inc	b
+			ld	b,d
+			dec	h
+			or	e
+			or	c
+			call	c,Ld97f
+			rla
+			rrca
+			ld	h,c
+			xor	l
+			add	hl,bc
+			pop	bc
+			ld	a,a
+			add	a,(hl)
+			jp	po,Lee2b
+			adc	a,d
+			jp	pe,L6ad2
+			dec	h
+			cp	l
+			call	po,L0faa
+			rla
+			halt
+			dec	c
+			and	d
+			inc	a
+			out	(9bh),a
+			in	a,(f5h)
+			cp	b
+			xor	(hl)
+			dec	de
+			ld	h,d
+			add	a,b
+			jp	m,Lf158
+			ld	(hl),b
+			or	d
+			call	c,L6a77
+			jp	p,L94ea
+			add	a,a
+			ld	b,a
+			and	b
+			dec	b
+			ld	b,l
+			ret	nc
+			inc	hl
+			nop (2x) *
+			cp	b
+			and	a
+			ccf
+			ld	d,d
+			and	c
+			cp	d
+			sbc	a,h
+			ld	h,d
+			adc	a,d
+			ld	e,e
+			add	hl,hl
+			dec	de
+			rst	08h
+			ld	l,b5h
+			inc	a
+			ld	h,d5h
+			ld	a,(hl)
+			ld	c,09h
+			rst	30h
+			and	c
+			ld	d,(hl)
+			add	hl,sp
+			add	a,(hl)
+			add	a,a
+			ld	e,l
+			or	h
+			ex	de,hl
+			or	e
+			ld	d,h
+			jp	(hl)
+			db	a3h,27h,12h,bch,79h,86h
+			ld	a,(de)
+			and	e
+			ld	l,a
+			ld	c,d
+			ld	a,b
+			push	hl
+			sbc	a,c
+			adc	a,d
+			sbc	a,h
+			call	p,Lc434
+			ex	de,hl
+			add	hl,de
+			dec	hl
+			ret	m
+			rlca
+			scf
+			pop	bc
+			ld	h,a
+			ld	(bf49h),a
+			ld	c,05h
+			ld	l,l
+			dec	bc
+			ret	pe
+			ex	de,hl
+			ret	pe
+			or	a
+			ld	(hl),e
+			pop	hl
+			jp	nc,L8e53
+			jp	nc,Lb04d
+			add	a,d
+			dec	c
+			out	(69h),a
+			push	hl
+			inc	sp
+			ld	bc,99d7h
+			jr	nz,L4ef6
+			ld	(de),a
+			ret	z
+			or	b
+			ld	e,(hl)
+			ld	a,(de)
+			ld	(hl),d
+			push	bc
+			adc	a,(hl)
+			ccf
+			dec	bc
+			exx
+			ld	(hl),b
+			ld	d,a
+			ld	b,a
+			inc	a
+			ld	d,d
+			sbc	a,(hl)
+			ld	(bc),a
+			ex	de,hl
+			ld	bc,ff8fh
+			cp	c
+			ex	af,af'
+			ld	b,b
+			and	(hl)
+			rla
+			ld	l,87h
+			jp	c,L0d74
+			ret
+			db	52h,77h,9dh,06h,01h,3ch,60h,afh
+			db	27h,9ch,59h,17h,d1h,eah
+			ld	b,d
+			ex	de,hl
+			ld	h,l
+			ld	b,e
+			sub	a
+			ld	(de),a
+			djnz	L4f50
+			call	nz,L48a7
+			call	L7f2c
+			adc	a,h
+			push	de
+			dec	h
+			djnz	L4ee3
+			ld	(hl),d
+			rst	18h
+			or	d
+			ld	(hl),c
+			rst	28h
+			ld	(hl),a
+			jp	L295b
+			add	a,a
+			cpl
+			ld	(hl),d
+			ld	c,d
+			djnz	L4f5e
+			call	nc,Lf405
+			ld	b,l
+			ld	c,l
+			ld	b,b
+			ld	(hl),c
+			ld	a,(3c47h)
+			ret	c
+			ret
+			db	1ah,a7h,3dh,2fh,89h,42h,5ah,29h
+			db	08h,59h,1fh,6fh
+			ld	h,e
+			sub	bch
+			ld	(hl),b
+			di
+			push	bc
+			inc	hl
+			ld	a,c
+			sbc	a,d
+			xor	(hl)
+			out	(b7h),a
+			ld	hl,(c97ch)
+			ld	a,c
+			add	hl,hl
+			ld	(hl),c
+			ret	p
+			sub	h
+			inc	b
+			ret	z
+			and	ech
+			ret	nz
+			add	hl,sp
+			ld	hl,(69e1h)
+			call	c,Le6d6
+			inc	b
+			call	L49b9
+			push	bc
+			ld	h,a
+			or	b
+			cp	(hl)
+			ld	a,a
+			adc	a,13h
+			sub	b
+			ld	b,d
+			ld	(hl),21h
+			dec	d
+			sbc	a,h
+			ld	a,(hl)
+			ld	h,3fh
+			jp	m,L1fc8
+			nop (2x) *
+			xor	a
+			ld	d,f1h
+			ld	e,d
+			ld	l,e
+			ld	(hl),e
+			add	hl,hl
+			ei
+			add	a,a0h
+			ld	(hl),a
+			pop	hl
+			ld	b,b
+			ld	d,h
+			rst	38h
+			ld	e,a
+			ld	a,b
+			or	h
+			or	e
+			sub	1fh
+			adc	a,h
+			cp	b
+			jr	c,L4f63
+			and	h
+			ex	af,af'
+			ld	l,l
+			jp	pe,L3297
+			ld	l,d
+			ex	af,af'
+			sub	(hl)
+			ld	a,h
+			add	a,d
+			ld	a,a
+			pop	bc
+			and	d
+			jp	p,L6a37
+			and	b
+			ld	sp,9e3dh
+			adc	a,a
+			and	e
+			ld	c,c
+			sbc	a,b
+			and	a
+			ld	e,l
+			inc	de
+			ld	l,e
+			ret	pe
+			ld	a,(786eh)
+			add	a,d
+			ld	b,h
+			ld	a,h
+			jr	L4fd1
+			db	beh,37h,a6h,7bh,abh,1bh,c9h,72h
+			db	9fh,9ch,c9h,cfh,35h,a5h,2ch,bfh
+			db	17h,b3h,a9h,58h,11h,dfh,4dh,f2h
+			db	97h,fah,fah,d0h,63h,6fh
+			inc	(hl)
+			ld	c,b
+			or	l
+			sub	h
+			adc	a,e2h
+			call	nz,L554d
+			xor	b
+			ld	h,l
+			ld	e,(hl)
+			inc	c
+			ld	(hl),b
+			ld	h,b
+			ret	pe
+			call	z,Le996
+			ld	l,l
+			dec	a
+			ld	(hl),abh
+			ld	b,e
+			jp	po,L260c
+			ld	a,(f0b4h)
+			adc	a,l
+			xor	c
+			ld	(hl),l
+			nop (2x) *
+			ld	bc,8c43h
+			ld	h,h
+			ld	l,e
+			jp	c,Ld0a4
+			ld	h,b
+			sub	e
+			call	z,L1ccf
+			bit	4,h
+			xor	d
+			dec	e
+			ld	c,c
+			dec	l
+			add	a,c
+			ld	h,(hl)
+			ld	b,l
+			inc	hl
+			daa
+			ld	a,b
+			cp	e
+			ld	e,8ch
+			call	pe,L9c82
+			xor	d
+			ret	z
+			and	b
+			ld	h,d
+			sub	l
+			ld	b,b
+			ld	a,b
+			add	a,l
+			ld	b,a
+			and	e
+			ld	a,7fh
+			ret	nz
+			dec	h
+			and	l
+			adc	a,l
+			sbc	a,b
+			adc	a,e
+			ld	h,(hl)
+			ld	(b443h),hl
+			and	h
+			in	a,(8fh)
+			ld	l,c
+			ld	d,d
+			sub	h
+			ld	a,h
+			ld	(hl),b
+			sbc	a,l
+			rst	00h
+			call	pe,Lc8d2
+			sub	e
+			ld	hl,(801ch)
+			ld	b,l
+			add	hl,hl
+			ld	h,b
+			add	a,(hl)
+			sbc	a,e
+			ld	a,(1edch)
+			ld	a,(hl)
+			ld	d,h
+			jp	(hl)
+			db	f5h,b3h,05h,bbh,5ch,15h,00h,45h
+			db	65h,31h,0dh,e3h,c5h,7ch,2ch,aeh
+			db	38h,8ah,3fh,b1h,68h,0ch,a3h,8ch
+			db	99h,95h,abh,adh,82h,4bh,f5h,afh
+			db	67h,8bh,91h,68h,71h,81h,6ah,5eh
+			db	06h,deh,09h,beh,62h,03h,08h,43h
+			db	81h,dbh,36h,2ch,5fh,a3h,86h,cbh
+			db	8bh,08h,4fh,fbh,bfh,89h,23h,48h
+			db	e5h,3ah,f5h,2eh,69h,f2h,05h,e2h
+			db	74h,7fh,58h,03h,62h,81h,7dh,39h
+			db	65h,71h,aah,53h,aeh,9eh,79h,fdh
+			db	78h,51h,e9h
+			ld	c,a
+			ld	b,(hl)
+			and	h
+			sbc	a,d
+			sub	67h
+			ld	(hl),b
+			and	e
+			adc	a,d
+			cp	a
+			ld	d,b
+			ld	h,b
+			call	Lb830
+			ret	z
+			dec	e
+			or	(hl)
+			cpl
+			ld	(ix + c7h),h
+			call	p,Lf19d
+			add	hl,sp
+			inc	a
+			xor	b
+			add	a,d
+			adc	a,d
+			ld	(hl),9bh
+			sub	h
+			adc	a,d
+			jr	z,L5115
+			ret	nz
+			add	a,a
+			add	hl,hl
+			call	Lf4d5
+			ld	(758ah),hl
+			jp	po,L1922
+			and	6ah
+			and	e
+			ld	hl,74c0h
+			jr	c,L5185
+			rra
+			jr	z,L519c
+			sbc	a,b
+			or	b
+			call	po,L13a7
+			dec	d
+			ld	d,a
+			ld	c,e6h
+			ld	de,00d9h
+			jp	nz,Lc04e
+			dec	e
+			add	hl,bc
+			inc	a
+			ret	nc
+			inc	sp
+			ld	e,9ah
+			jp	nz,L25f4
+			ld	l,a
+			ld	b,d
+			and	(hl)
+			rst	38h
+			dec	c
+			out	(f3h),a
+			add	a,(hl)
+			ld	h,l
+			ld	sp,4a70h
+			cp	(hl)
+			ld	d,41h
+			ld	l,d
+			sbc	a,a
+			cp	(hl)
+			or	(hl)
+			xor	h
+			ld	d,e
+			cp	b
+			dec	e
+			and	c
+			inc	a
+			dec	bc
+			xor	(hl)
+			cp	b
+			ld	h,a4h
+			inc	c
+			jp	pe,Lbaa6
+			jp	nc,Le4c5
+			ld	h,41h
+			ld	l,e
+			inc	de
+			ld	e,h
+			ld	c,d
+			cp	(hl)
+			call	pe,Lbbe3
+			ret
+			db	8fh,cdh,ffh,e3h,5bh,dah,68h,17h
+			db	e6h
+			ld	c,l
+			and	d
+			ld	b,e
+			cp	e
+			sub	(hl)
+			rlca
+			ld	a,h
+			and	e
+			ld	c,h
+			ld	e,l
+			ld	a,(hl)
+			inc	e
+			ld	sp,964dh
+			srl	d
+			ld	h,e
+			cp	c
+			adc	a,85h
+			sbc	a,c
+			xor	(hl)
+			sub	a
+			ld	l,h
+			inc	d
+			inc	b
+			and	a
+			sbc	a,a
+			ld	e,d
+			ld	d,l
+			dec	(hl)
+			rrca
+			add	hl,de
+			ld	a,e
+			ld	l,b
+			dec	c
+			ld	(bc),a
+			inc	h
+			inc	a
+			rst	20h
+			dec	bc
+			add	a,l
+			xor	(hl)
+			inc	d
+			ld	de,9d54h
+			ld	c,h
+			ld	l,e
+			ld	a,e
+			ld	h,h
+			inc	d
+			ld	b,(hl)
+			add	a,d
+			ld	h,b
+			dec	sp
+			ret	nc
+			ld	l,d
+			xor	b
+			adc	a,e
+			pop	af
+			ld	b,h
+			ld	bc,8f59h
+			ld	c,e
+			and	b
+			ld	(5ac5h),hl
+			dec	c
+			add	a,d
+			adc	a,c
+			and	l
+			call	p,L77b9
+			ld	d,l
+			cpl
+			sbc	a,a
+			sub	h
+			ld	(25a9h),a
+			inc	e
+			ld	e,c
+			cp	c
+			ld	b,e
+			dec	b
+			sbc	a,(hl)
+			ld	a,(f5bch)
+			add	hl,hl
+			adc	a,c
+			call	p,Lde82
+			dec	h
+			adc	a,h
+			cp	l
+			ld	h,d
+			rst	38h
+			or	d
+			or	b
+			ld	e,e
+			inc	bc
+			ld	a,(bc)
+			ld	h,c
+			rst	00h
+			rst	00h
+			ret	i *
+			ld	d,(hl)
+			ret	po
+			ld	(hl),3ch
+			rra
+			ret	p
+			ret	m
+			ld	b,(hl)
+			ret	c
+			or	e
+			ld	e,(hl)
+			ld	(hl),a
+			ex	de,hl
+			push	af
+			xor	h
+			cp	c
+			pop	af
+			inc	(hl)
+			adc	a,a
+			ret	nz
+			or	l
+			adc	a,a
+			call	po,Ledd5
+			call	nz,Lfd86
+			ld	l,l
+			ld	hl,0796h
+			ld	c,a3h
+			sbc	a,e
+			di
+			push	bc
+			pop	hl
+			dec	sp
+			jp	pe,L0d49
+			ld	h,e
+			and	d
+			or	8ah
+			pop	de
+			push	af
+			or	d
+			rst	08h
+			ld	b,54h
+			jp	m,L59fb
+			dec	hl
+			ld	a,(de)
+			dec	h
+			cp	b
+			ld	d,d
+			ret	nz
+			ld	d,b
+			pop	bc
+			call	pe,La4dc
+			call	c,L43c2
+			dec	d
+			rst	38h
+			or	l
+			ld	l,b
+			ld	(hl),a
+			jr	nc,L51e7
+			ld	h,b9h
+			call	nz,L397b
+			ld	b,b
+			ld	(hl),a
+			ld	d,l
+			add	hl,hl
+			inc	l
+			ld	a,b
+			ld	e,a
+			di
+			ld	bc,87beh
+			inc	a
+			push	bc
+			ld	a,l
+			ret	pe
+			and	b
+			ld	e,(hl)
+			ld	(a5dah),hl
+			rst	38h
+			ld	de,9961h
+			ld	(hl),c
+			nop (2x) *
+			dec	d
+			ld	h,b
+			and	(hl)
+			call	pe,L5286
+			ld	hl,a991h
+			adc	a,c
+			and	l
+			ld	l,l
+			inc	de
+			ret	m
+			ld	d,(hl)
+			inc	hl
+			ld	h,h
+			cpl
+			xor	h
+			sub	(hl)
+			ld	a,(bc)
+			or	l
+			and	d
+			call	z,L8e5e
+			ld	l,h
+			xor	dfh
+			nop (2x) *
+			adc	a,b
+			ld	h,l
+			cpl
+			inc	e
+			cp	1ch
+			rst	10h
+			ret	p
+			add	a,a
+			jp	pe,L6820
+			dec	l
+			sub	e
+			adc	a,c
+			cp	b
+			djnz	L52e1
+			add	hl,bc
+			call	c,Lb60d
+			ld	c,h
+			call	c,L3750
+			jp	nz,L4ad2
+			rst	30h
+			cp	(hl)
+			ld	(hl),h
+			add	a,(hl)
+			rst	38h
+			rst	08h
+			xor	d
+			rst	28h
+			ld	(hl),32h
+			res	7,(hl)
+			adc	a,h
+			sub	h
+			ld	a,h
+			jp	pe,L1533
+			cp	c
+			adc	a,c
+			ex	(sp),hl
+			ld	d,c
+			jp	pe,L8f3e
+			ld	l,e
+			ld	sp,hl
+			ret	m
+			rlca
+			ld	(hl),b
+			ld	d,e6h
+			ld	(hl),e
+			sbc	a,e
+			jp	z,Lbda4
+			ld	hl,(e7deh)
+			add	hl,de
+			cp	d
+			dec	c
+			pop	hl
+			ld	(c240h),hl
+			ld	de,c6abh
+			xor	b
+			pop	af
+			djnz	L5336
+			adc	a,b
+			ld	b,c
+			inc	de
+			dec	b
+			ld	d,(hl)
+			and	d
+			ld	b,a
+			cp	d
+			inc	l
+			push	af
+			adc	a,d
+			call	L74da
+			ld	c,a
+			call	po,L495a
+			or	b
+			jr	c,L52a7
+			ld	e,e
+			push	hl
+			ld	de,1860h
+			cp	h
+			rst	18h
+			and	85h
+			ld	d,h
+			add	a,c
+			ld	hl,(501dh)
+			cp	h
+			ld	(de),a
+			ld	b,e
+			ld	e,c
+			dec	(hl)
+			inc	h
+			ld	a,h
+			ld	hl,5e1ch
+			ld	c,a
+			ld	(de),a
+			ld	l,e
+			ld	c,h
+			ld	(8bd4h),hl
+			jp	(hl)
+			db	bch,c3h,abh,c5h,40h,f8h,4eh,82h
+			db	d9h,05h,f1h,cch,5eh,bah,cbh,a7h
+			db	e3h,b5h,1eh,ddh,00h,fdh,6eh,68h
+			db	11h,98h,f4h,eah,82h,13h,ech,c2h
+			db	35h,6ah,c5h,dch,25h,abh,5bh,d2h
+			db	3ah,64h,45h,55h,e7h,e1h,9bh,8fh
+			db	63h,05h,bdh,b5h,35h,f9h,14h
+			ld	l,(hl)
+			pop	de
+			ld	b,(hl)
+			ld	c,d
+			and	d
+			jp	nc,L7e1c
+			ld	l,c
+			add	hl,hl
+			ret	p
+			ret	c
+			ex	af,af'
+			sub	h
+			add	hl,de
+			push	de
+			xor	b
+			ld	h,h
+			ld	a,l
+			sub	a
+			and	c
+			rst	08h
+			add	hl,hl
+			dec	d
+			xor	h
+			or	b
+			jr	nz,L53a8
+			dec	bc
+			or	b
+			ld	(de),a
+			inc	hl
+			ld	b,d
+			xor	l
+			cp	cch
+			ld	c,c
+			ld	(hl),c
+			ld	(5ec8h),hl
+			inc	h
+			dec	c
+			ld	c,c
+			ld	a,e
+			xor	h
+			ld	l,a8h
+			and	e
+			ld	c,(hl)
+			ld	a,(hl)
+			sub	efh
+			ld	e,b
+			ld	(2d8dh),hl
+			nop (2x) *
+			and	a
+			ld	c,e5h
+			call	m,L7e17
+			nop (2x) *
+			rst	28h
+			ld	(hl),d
+			in	a,(63h)
+			sub	d1h
+			rrca
+			ld	e,e
+			xor	d
+			dec	a
+			ld	d,c
+			cpl
+			ld	c,a
+			dec	hl
+			or	l
+			ei
+			push	af
+			ld	a,l
+			ld	h,h
+			jp	Lbc0b
+			db	38h,3ah,0fh,01h
+			dec	c
+			ld	(c402h),a
+			xor	b
+			ld	l,a
+			scf
+			ld	l,d
+			jp	z,L03e8
+			ld	e,c
+			ld	c,h
+			ret	po
+			ret	po
+			sbc	a,e
+			dec	(hl)
+			ld	c,a
+			cp	d
+			ld	d,l
+			ccf
+			rst	30h
+			sbc	a,h
+			ld	b,(hl)
+			ld	l,c
+			ld	h,l
+			inc	de
+			ld	(de),a
+			ld	b,b
+			or	(hl)
+			ld	e,d
+			ret	p
+			ld	(hl),l
+			ld	l,c
+			inc	c
+			add	a,l
+			inc	d
+			and	b
+			or	52h
+			ld	h,c
+			dec	h
+			cpl
+			xor	l
+			res	1,e
+			daa
+			ld	d,c
+			adc	a,c
+			jp	po,L2d5d
+			ex	(sp),hl
+			ld	d,(hl)
+			adc	a,h
+			nop
+			add	a,l
+			call	c,L6911
+			jp	p,L2efa
+			dec	(hl)
+			djnz	L53ad
+			sbc	a,0ch
+			ret	z
+			dec	sp
+			sbc	a,7dh
+			ld	sp,39e6h
+			ld	c,e
+			adc	a,l
+			ld	(de),a
+			djnz	L53da
+			nop
+			or	d
+			di
+			ld	c,e
+			pop	de
+			inc	a
+			ld	(hl),h
+			ld	e,d
+			ld	(hl),1ch
+			scf
+			and	l
+			and	a
+			add	a,f1h
+			jr	c,L53f5
+			ld	(ce90h),a
+			ld	e,a6h
+			ld	b,c
+			sub	c
+			cp	h
+			inc	b
+			ld	b,h
+			adc	a,l
+			ld	d,(hl)
+			and	l
+			add	a,b
+			ld	b,b
+			dec	(hl)
+			ld	d,e
+			ld	h,(hl)
+			ld	d,b8h
+			push	bc
+			and	b
+			or	(hl)
+			sbc	a,l
+			rlca
+			push	hl
+			jp	(hl)
+			db	71h,30h,e5h,b4h,56h,22h,1fh,ddh
+			db	85h,8ch,5ah
+			ld	a,(8d01h)
+			ei
+			adc	a,c8h
+			dec	(hl)
+			ld	b,d
+			jp	(hl)
+			db	3fh,cah
+			ld	l,l
+			ld	b,h
+			ld	e,(hl)
+			ld	c,c
+			adc	a,(hl)
+			inc	b
+			sub	d
+			ld	a,b
+			add	a,b
+			dec	a
+			jp	(hl)
+			db	5dh,7ah,76h,62h,1fh,4ah,79h,7ah
+			db	abh,6ch,84h,56h,7ah,40h,65h,95h
+			db	d0h,44h,1ch,77h,bbh,c9h,f2h,44h
+			db	b0h,a8h,92h,17h,a8h,36h,d6h,e3h
+			db	46h,18h,cch,2eh,43h,37h,59h,31h
+			db	48h,31h,c3h,74h,deh,61h,f5h,86h
+			db	89h,6ah
+			ld	(hl),h
+			ld	de,d036h
+			jr	z,L53e2
+			and	ixh *
+			and	22h
+			call	po,L9347
+			ld	a,(hl)
+			ld	a,h
+			cp	a
+			dec	b
+			nop (2x) *
+			push	hl
+			ld	(hl),c
+			ld	a,(de)
+			ld	l,e
+			dec	a
+			sub	a
+			ld	a,h
+			dec	(hl)
+			ld	d,e
+			and	e
+			ld	c,h
+			adc	a,b
+			call	nz,Lc6ac
+			or	c
+			dec	d
+			inc	de
+			sub	b
+			call	nz,L1b47
+			sub	l
+			jp	(hl)
+			db	9eh,bdh,b9h,e3h,2ch,f7h,66h,73h
+			db	deh,f5h,96h,1bh,c3h,50h,14h,86h
+			db	eeh,32h,75h,65h,4bh,09h,3ah,0eh
+			call	m,L6c11
+			ld	l,a
+			rst	08h
+			di
+			dec	bc
+			or	a
+			xor	h
+			pop	bc
+			call	nz,L3bb7
+			sub	l
+			ld	h,d
+			ld	d,(hl)
+			dec	sp
+			jp	z,L28db
+			halt
+			ld	d,h
+			ld	e,d
+			jp	m,L5c65
+			ld	c,c
+			add	a,c
+			sub	a
+			ld	a,c
+			ret	po
+			pop	de
+			and	a
+			inc	sp
+			ld	hl,(d84fh)
+			ld	c,a
+			ret	z
+			ld	e,d
+			rst	08h
+			xor	(hl)
+			ret	nc
+			jp	m,Ledba
+			jr	z,L5544
+			ld	h,b4h
+			ld	a,l
+			and	d
+			ld	a,(hl)
+			jr	c,L54a2
+			and	d
+			ld	a,h
+			ld	l,h
+			sbc	a,a
+			ex	af,af'
+			ld	de,aa40h
+			sbc	a,ffh
+			ld	(hl),e
+			rst	18h
+			ld	l,e
+			ld	a,1ch
+			ld	b,(hl)
+			adc	a,(hl)
+			ret	p
+			rst	30h
+			ld	b,e
+			push	de
+			or	fah
+			or	a
+			ld	(hl),h
+			inc	hl
+			ld	d,(hl)
+			nop (2x) *
+			nop (2x) *
+			cp	e
+			sbc	a,c
+			inc	h
+			ld	e,c
+			add	hl,sp
+			ld	d,32h
+			ld	d,e
+			cpl
+			call	Lf98a
+			or	a
+			rst	30h
+			ld	d,4dh
+			ld	hl,(33ddh)
+			dec	d
+			ld	l,e
+			ld	b,d
+			nop (2x) *
+			ld	c,c
+			ld	(hl),b
+			xor	e
+			sbc	a,e
+			ld	c,l
+			ld	e,a
+			sub	e
+			ld	l,c
+			dec	c
+			ld	c,d
+			ld	e,b
+			ld	d,c
+			inc	(hl)
+			ld	l,b
+			jp	L388f
+			db	eah,6eh,cbh,70h,b6h,41h,edh,13h
+			db	bbh,bdh,dah,7ch,f4h,5bh,53h,8eh
+			db	60h,8eh,a6h,a7h,93h,64h,2eh,45h
+			db	18h,e6h,d4h,9fh,00h,a6h,72h,77h
+			db	a2h,20h,c9h,84h,81h,b4h,09h,a5h
+			db	d0h
+			ret	m
+			ret	m
+			rst	00h
+			or	h
+			ld	b,d
+			ld	(hl),b
+			sub	d
+			cp	d
+			xor	b
+			cp	b
+			scf
+			ld	a,l
+			inc	sp
+			xor	l
+			sbc	a,e
+			add	hl,hl
+			ld	h,c
+			rst	28h
+			or	l
+			sub	h
+			sub	l
+			ld	a,(de)
+			inc	sp
+			ld	sp,08abh
+			cpl
+			nop (2x) *
+			ld	l,d
+			and	b
+			inc	sp
+			ld	(ec9ch),a
+			ld	l,a
+			ld	a,c
+			daa
+			call	po,L06e5
+			xor	84h
+			and	(hl)
+			add	hl,sp
+			ld	e,d
+			ld	c,e
+			dec	a
+			ld	c,a
+			and	dch
+			adc	a,a
+			or	h
+			jp	m,L3bf8
+			and	e
+			ld	l,(hl)
+			adc	a,d
+			ld	a,d
+			ld	c,e
+			or	(hl)
+			ret	p
+			ld	d,a
+			ld	a,e
+			dec	a
+			ld	(a424h),hl
+			inc	de
+			ld	(337bh),hl
+			adc	a,a
+			adc	a,l
+			jr	nz,L55c1
+			ld	e,e
+			jp	(hl)
+			db	c9h,ebh,aah,a3h,e8h,b2h,03h,64h
+			db	7eh,dah,1ah,85h,f3h,13h,46h,f2h
+			db	dbh,70h,d1h,60h,98h,cfh,7bh,dfh
+			db	cfh,04h,d6h,66h,b8h,9ah,2eh,64h
+			db	e3h,04h,8dh,31h,2bh,98h,55h,45h
+			db	b9h,c1h,79h,a1h,08h,4ch
+			jr	nc,L558a
+			ld	(hl),b
+			and	e
+			and	l
+			call	pe,L4c87
+			sub	b
+			ld	h,h
+			add	hl,sp
+			rst	38h
+			cp	c
+			ld	b,l
+			call	m,Lea26
+			ret	p
+			or	e5h
+			ld	h,b
+			adc	a,d
+			ld	d,c
+			sub	d
+			dec	b
+			cp	c
+			inc	c
+			inc	e
+			pop	de
+			dec	b
+			ld	a,h
+			ret	nz
+			ret	nc
+			ld	e,(hl)
+			jp	m,L0db2
+			ld	d,h
+			ld	b,h
+			xor	a
+			ccf
+			cpl
+			dec	a
+			sub	c
+			call	p,L322f
+			adc	a,d
+			jp	p,L304a
+			ld	(hl),c
+			ld	a,b
+			or	a
+			ld	(7810h),hl
+			jp	z,L7b6c
+			xor	a
+			ld	c,h
+			sub	b
+			ld	(hl),c
+			jp	z,Ldbc6
+			ld	c,a
+			adc	a,a
+			djnz	L5630
+			add	a,(hl)
+			ld	sp,d5d9h
+			pop	af
+			xor	h
+			ld	(hl),l
+			add	a,h
+			jr	nz,L55cd
+			add	a,(hl)
+			add	a,a
+			inc	c
+			djnz	L5628
+			ret
+			db	2dh,21h,b4h,aah,e3h,c2h,f4h,72h
+			db	c2h,b8h
+			add	a,d
+			call	c,Lc80b
+			ld	h,1ch
+			dec	c
+			ccf
+			ld	(hl),a
+			ld	h,89h
+			push	bc
+			ld	sp,hl
+			rlca
+			inc	c
+			cp	e
+			sub	l
+			ld	h,d
+			cp	a
+			adc	a,79h
+			rra
+			ret	m
+			rla
+			ld	e,a1h
+			ld	c,h
+			ld	l,l
+			ld	d,b
+			rst	18h
+			sub	h
+			dec	de
+			rst	20h
+			pop	af
+			ld	c,d
+			jr	z,L55ff
+			pop	hl
+			ld	b,e
+			ld	d,a
+			ld	c,h
+			ld	l,b
+			inc	sp
+			or	h
+			ld	a,c
+			ld	a,b
+			cp	d
+			ld	c,c
+			and	(hl)
+			ld	(hl),a
+			add	hl,de
+			ld	a,d
+			inc	hl
+			sub	e
+			sbc	a,l
+			ld	(bc),a
+			ld	a,(bc)
+			ex	af,af'
+			set	2,h
+			ld	c,b
+			ld	b,3ch
+			inc	bc
+			ld	de,fd0ch
+			ld	(5636h),a
+			ld	c,b
+			ld	h,d
+			ret	p
+			ld	l,l
+			di
+			ld	h,d
+			or	l
+			sub	h
+			ret	m
+			inc	bc
+			inc	sp
+			ld	d,l
+			ld	e,h
+			push	bc
+			jr	c,L5615
+			jp	L46f8
+			db	f5h,bdh,45h,69h,1eh,a7h,76h,39h
+			db	65h,c9h,16h,f4h,0eh,8ah,4ah,54h
+			db	6dh,90h,cah,f0h,72h,12h,2eh,59h
+			db	38h,d2h,f5h,0ah,f8h,66h,d5h,b6h
+			db	52h,01h,b1h,96h,aah,62h,16h,b4h
+			db	06h,4dh,8dh,d6h,22h,b5h,d2h,83h
+			db	70h,5bh,79h,2ch,eah,82h,efh,98h
+			db	62h,d8h,feh,67h,1ah
+			or	b
+			or	l
+			rst	28h
+			exx
+			ld	a,d
+			push	bc
+			or	c
+			cp	l
+			call	p,L618b
+			xor	h
+			ld	c,58h
+			adc	a,(hl)
+			ld	l,e
+			xor	l
+			dec	h
+			ld	d,(hl)
+			inc	b
+			xor	(hl)
+			adc	a,h
+			call	p,L3a4c
+			rst	30h
+			call	pe,L7777
+			add	a,(hl)
+			sub	(hl)
+			sbc	a,e
+			sbc	a,b
+			ret	po
+			rst	00h
+			sub	cch
+			pop	hl
+			xor	(hl)
+			inc	h
+			ex	af,af'
+			ld	c,a
+			ld	c,h
+			ld	(bc),a
+			inc	e
+			ld	d,l
+			rst	30h
+			ld	h,a
+			and	54h
+			nop (2x) *
+			ld	(hl),c
+			xor	c
+			ld	b,c
+			rst	38h
+			sbc	a,8fh
+			cp	c
+			ld	h,l
+			sbc	a,e
+			xor	h
+			add	hl,de
+			bit	2,b
+			jp	Ld727
+			db	84h,3fh,51h,32h,70h,32h,abh,04h
+			db	31h,32h,1bh,edh,3bh,53h
+			jr	c,L5786
+			ld	h,h
+			inc	bc
+			jp	pe,Lc8b7
+			ret
+			db	4dh,9dh,a3h,85h,0bh
+			jp	po,Le602
+			or	b
+			dec	c
+			ld	a,(de)
+			push	hl
+			jr	nz,L56eb
+			rst	00h
+			ret	z
+			ld	(hl),l
+			ld	a,d
+			ld	c,h
+			ld	(hl),h
+			inc	l
+			ld	c,c
+			ld	h,a5h
+			ret	nz
+			add	a,e
+			xor	h
+			ld	a,(30d6h)
+			ld	l,c
+			ld	e,c
+			pop	af
+			add	a,h
+			cpl
+			ld	a,(e455h)
+			ld	hl,17cfh
+			cp	d
+			xor	(hl)
+			ld	h,l
+			ld	b,(hl)
+			ccf
+			ex	(sp),hl
+			dec	de
+			add	a,c
+			jp	c,L93b0
+			ld	e,e
+			call	pe,Lbe3d
+			ld	c,(hl)
+			ex	de,hl
+			or	d
+			adc	a,00h
+			ld	h,e
+			adc	a,e
+			ld	h,e
+			nop
+			pop	af
+			ld	(bc),a
+			jr	nz,L576d
+			rla
+			ld	h,b
+			ld	h,a
+			or	a
+			ld	a,l
+			ld	(2dedh),a
+			pop	af
+			adc	a,a
+			ld	a,(de)
+			ld	d,(hl)
+			jp	nc,L1f1e
+			ld	c,e
+			ld	b,d
+			sbc	a,h
+			adc	a,b
+			pop	bc
+			xor	d
+			inc	c
+			ld	b,a
+			or	b
+			ld	a,(de)
+			xor	29h
+			jr	nc,L570a
+			and	(hl)
+			adc	a,b
+			add	a,e
+			ld	h,(hl)
+			push	af
+			sbc	a,68h
+			sub	c
+			adc	a,a
+			inc	c
+			ld	e,a
+			ret	nz
+			adc	a,d
+			inc	de
+			ld	h,d
+			pop	de
+			jp	p,Laae2
+			ld	l,8fh
+			ld	(hl),c8h
+			inc	d
+			ex	de,hl
+			jp	m,Lf9a6
+			sub	h
+			jr	c,L5752
+			xor	ach
+			ld	h,e
+			add	hl,de
+			cp	b
+			adc	a,b
+			add	a,l
+			xor	b
+			ld	c,c
+			cp	57h
+			jp	L5c15
+			db	bah,15h,aeh,e2h,d3h,90h,f8h,dch
+			db	d4h,c6h,09h,9fh,a1h,4ah,7ah,15h
+			db	98h,85h,97h,f2h,6bh,03h,6dh,94h
+			db	09h,f7h,35h,33h,f0h,2ah,2fh,b3h
+			db	dbh,8fh,01h,d7h,c0h,ceh,56h,c0h
+			db	82h,b1h,efh,3dh,1ch,19h,74h,7ch
+			db	cfh,00h,7ch,54h,05h
+			out	(a1h),a
+			jp	c,L80d3
+			inc	l
+			ld	a,a
+			ld	a,(hl)
+			ld	l,05h
+			ret	p
+			dec	(hl)
+			out	(2eh),a
+			jr	c,L576b
+			ld	a,60h
+			ld	c,h
+			ld	a,(hl)
+			ld	(hl),h
+			or	c
+			rst	20h
+			res	5,e
+			add	hl,hl
+			ld	(663dh),hl
+			and	(hl)
+			call	Ldf02
+			ld	b,d
+			cp	l
+			ld	h,c
+			sbc	a,d
+			ld	c,c
+			ld	b,a
+			call	nc,L2b8e
+			ld	a,c
+			ld	a,(bc)
+			djnz	L586b
+			ret	p
+			sub	l
+			and	b
+			ld	h,(hl)
+			ret	nc
+			ld	c,cah
+			ld	hl,a925h
+			inc	e
+			ret	c
+			cp	(hl)
+			ld	d,l
+			jp	po,Le6b7
+			ld	h,b
+			sbc	a,e
+			jp	po,L63d4
+			ld	e,c
+			ex	de,hl
+			pop	hl
+			di
+			adc	a,h
+			ld	b,b
+			ex	af,af'
+			pop	de
+			jp	z,L8ed8
+			ld	(hl),0eh
+			ret	po
+			jp	c,L8b28
+			call	z,Lf052
+			rst	10h
+			add	a,b
+			sbc	a,h
+			sbc	a,(hl)
+			ld	a,23h
+			ld	e,a4h
+			ld	a,(8387h)
+			ld	h,(hl)
+			ld	d,h
+			and	h
+			inc	hl
+			sub	b
+			ex	de,hl
+			adc	a,a
+			ld	d,5bh
+			sub	(hl)
+			rst	38h
+			ld	b,l
+			add	hl,bc
+			ret	pe
+			sub	66h
+			pop	de
+			inc	bc
+			inc	h
+			ret	z
+			sub	e
+			cp	d
+			sbc	a,h
+			ret
+			db	bch,a4h,1eh,b6h,59h,a9h,71h,20h
+			db	56h,e2h,53h,7ch,eeh,d1h,5dh,eah
+			db	cfh,cah,90h,50h,47h,48h,8ch,42h
+			db	d3h,9ch
+			nop (2x) *
+			nop
+			add	a,l
+			cp	c
+			rst	18h
+			ld	l,l
+			ret	p
+			call	pe,L8cd3
+			ld	a,c
+			ld	c,c
+			ld	b,b
+			xor	93h
+			ld	h,(hl)
+			sub	e
+			ld	d,02h
+			sub	(hl)
+			dec	l
+			jr	L58a0
+			db	d5h,0ch,e2h,4dh
+			call	c,Leb0c
+			add	a,c
+			ld	l,l
+			ld	hl,b382h
+			inc	c
+			ld	(hl),e
+			sbc	a,(hl)
+			add	a,e
+			add	a,(hl)
+			ld	l,d2h
+			ld	(hl),b
+			ld	(hl),36h
+			ld	h,d
+			sub	e
+			sub	73h
+			or	e
+			ld	hl,793ah
+			add	a,b
+			ret
+			db	ech,36h,d5h,28h,d0h,bfh,0ah,03h
+			db	e8h,ffh,8bh,0fh,30h,23h,4ch,9dh
+			db	83h,cfh,79h,a0h,9bh,8ch,f3h,c5h
+			db	69h,07h,53h,f2h,d3h,15h,d7h,36h
+			db	d9h
+			ld	c,b
+			call	m,L7648
+			push	hl
+			ld	d,a
+			ld	b,l
+			dec	(hl)
+			adc	a,(hl)
+			ld	e,b
+			ld	l,c
+			cpl
+			or	a
+			ret	nc
+			add	a,(hl)
+			inc	a
+			ld	h,(hl)
+			sub	h
+			inc	(hl)
+			inc	b
+			dec	a
+			add	hl,hl
+			xor	b
+			sub	c
+			ld	de,4dd6h
+			add	a,64h
+			sbc	a,e
+			cp	c
+			cp	a
+			xor	8eh
+			ld	(hl),a
+			call	p,L7b7c
+			push	af
+			ld	b,e
+			add	a,c
+			ld	a,h
+			ld	e,a
+			sub	e
+			and	a
+			call	c,L2276
+			ld	a,h
+			push	bc
+			ld	(hl),59h
+			ld	(hl),h
+			call	pe,L66b4
+			xor	b
+			dec	sp
+			add	a,e
+			jp	L55f0
+			db	f6h,b9h,02h,a3h,63h,5dh,21h,32h
+			db	26h,17h,82h,33h,75h,c7h,61h,deh
+			db	b2h,f7h,01h,0bh,3dh,a5h,2fh,5ch
+			db	81h,b6h,0bh,f5h,dfh,b5h,15h,abh
+			db	3ch,39h,79h,5bh,29h,7fh,26h
+			ld	c,(hl)
+			add	hl,bc
+			ret	nc
+			call	m,L39bd
+			rst	18h
+			ld	(hl),c
+			jp	po,L59fd
+			dec	h
+			call	z,Lb46f
+			ld	l,b
+			or	c
+			rst	20h
+			rst	38h
+			sub	(hl)
+			inc	de
+			jp	c,L84a6
+			rst	38h
+			cp	h
+			ld	a,l
+			ld	(bc),a
+			ld	c,(hl)
+			ret	m
+			ld	(bc),a
+			ld	a,3fh
+			ld	c,d
+			ret	nc
+			djnz	L597a
+			dec	h
+			ret
+			db	fbh,d3h,66h,c6h,e9h,8fh,0dh,80h
+			db	bfh,25h,e0h,41h
+			inc	l
+			jp	po,L5e9f
+			call	p,L2a6c
+			ld	e,e
+			jr	nz,L5936
+			jp	nc,L7f07
+			call	m,Lc3a4
+			inc	sp
+			jp	po,Lb958
+			ld	d,h
+			ld	l,(hl)
+			and	b
+			ret	nc
+			add	a,b
+			or	c
+			ld	b,e7h
+			add	hl,bc
+			cp	a
+			ld	h,d
+			ld	l,b
+			ld	(9cffh),a
+			dec	c
+			out	(39h),a
+			cp	b
+			ld	b,l
+			xor	15h
+			ld	c,c
+			call	p,L9374
+			ld	a,(bc)
+			or	b
+			and	d
+			ld	c,29h
+			exx
+			rst	38h
+			add	a,l
+			ld	b,c
+			ld	e,c
+			ld	a,(hl)
+			jr	c,L595b
+			dec	sp
+			call	Lc3c8
+			pop	bc
+			dec	h
+			ld	h,h
+			ld	b,a
+			ld	l,h
+			ld	a,(de)
+			jp	Lbbdb
+			db	52h,dah,83h,9fh,f2h
+			jr	nz,L597e
+			sub	d
+			add	hl,bc
+			cp	l
+			jr	L59ba
+			db	2dh,92h,ech,82h,1fh,3dh,9dh,f0h
+			db	5bh,59h,e8h
+			and	l
+			ld	d,a
+			xor	b
+			jp	(hl)
+			db	74h,aeh,22h,8fh,56h,b6h,efh,e9h
+			db	04h,6bh,d9h,adh,52h,fdh,e4h,a9h
+			db	04h,24h,3ch,44h,36h,4eh,e4h,27h
+			db	78h,c2h,69h,1bh,9fh,9fh,c8h,9bh
+			db	5ah,b9h,48h,20h,01h,4ch,76h,43h
+			db	48h,1dh
+			ld	b,e
+			di
+			ld	(hl),c
+			call	L871b
+			ld	(aeceh),a
+			jr	L59e9
+			db	abh,6fh,a7h,27h
+			and	dah
+			ld	c,l
+			rrca
+			ld	c,e
+			pop	af
+			inc	e
+			and	(hl)
+			rst	28h
+			sbc	a,94h
+			pop	hl
+			ld	a,(bc)
+			sub	d
+			ld	(hl),12h
+			ld	h,l
+			rla
+			ld	c,b
+			ld	d,c
+			or	h
+			xor	d
+			ld	h,l
+			ret	po
+			xor	b
+			inc	a
+			xor	d
+			ld	a,b5h
+			cpl
+			inc	l
+			ld	c,l
+			inc	(hl)
+			rla
+			call	c,L1ef9
+			ld	l,d
+			ld	a,l
+			ld	(f953h),hl
+			adc	a,h
+			ld	c,h
+			push	bc
+			jp	po,Lf940
+			ld	h,l
+			djnz	L5a58
+			ld	e,d
+			push	de
+			xor	c
+			adc	a,b
+			rst	20h
+			push	af
+			ld	(ix + f2h),b
+			and	50h
+			ld	d,(hl)
+			sub	l
+			and	fbh
+			pop	af
+			sub	b
+			sub	a
+			inc	b
+			inc	h
+			ex	af,af'
+			ex	de,hl
+			inc	de
+			ld	a,e
+			ld	sp,8d8dh
+			sub	e
+			jp	(hl)
+			db	d2h,62h,8ah,47h,11h,87h,85h,21h
+			db	dah,05h,72h,9ah,42h,74h,73h,c5h
+			db	1fh
+			ld	d,f8h
+			jp	m,L52d2
+			ld	c,(hl)
+			ld	c,d
+			sub	09h
+			call	nz,Ldc34
+			dec	bc
+			ld	c,d
+			ld	l,b
+			ld	a,(de)
+			ld	l,l
+			rst	18h
+			ld	e,c
+			exx
+			ld	c,b
+			push	af
+			ld	b,(hl)
+			ld	b,b
+			ld	de,fb49h
+			ld	sp,hl
+			jr	c,L5ad4
+			ld	l,e
+			add	a,h
+			inc	sp
+			cpl
+			ld	l,42h
+			or	c
+			ld	d,(hl)
+			ld	a,l
+			ld	h,b
+			cp	l
+			scf
+			ex	(sp),hl
+			ld	a,h
+			dec	e
+			sbc	a,h
+			ld	(hl),a
+			jr	z,L5acc
+			and	e
+			xor	b
+			jr	z,L5a3e
+			dec	(hl)
+			ld	a,h
+			dec	hl
+			cp	b
+			rst	20h
+			or	l
+			ld	e,c6h
+			or	a
+			inc	(hl)
+			and	c
+			ld	h,(hl)
+			inc	h
+			pop	hl
+			ld	a,f6h
+			ld	c,d
+			sbc	a,b
+			neg *
+			xor	d
+			cp	b
+			ld	c,e
+			ld	b,b
+			ld	a,b
+			inc	de
+			ld	h,e
+			sbc	a,h
+			ld	e,a
+			jp	pe,Laa97
+			adc	a,a
+			rla
+			adc	a,e
+			inc	c
+			ld	h,(hl)
+			ld	l,4ah
+			ld	a,e
+			ld	b,a
+			ld	l,c7h
+			inc	e
+			call	c,Lf292
+			ld	h,(hl)
+			sub	a
+			ld	l,h
+			rst	18h
+			ret	po
+			nop (2x) *
+			sub	e6h
+			rlca
+			cp	l
+			ld	e,b
+			dec	b
+			ld	(bc),a
+			ld	ixh,ixh *
+			nop (2x) *
+			sbc	a,d
+			ld	a,d
+			scf
+			call	m,Lc771
+			ld	(hl),d
+			jp	L088a
+			db	3bh,dah,fch,19h,92h,ffh,0eh,6ah
+			db	1dh,1ch,9ah,4fh,e7h,46h,00h,15h
+			db	99h,86h,1fh,74h,b4h,edh,74h,22h
+			db	0eh,66h,dah,63h,cfh,d6h,84h,8ah
+			db	02h,5ah,ach,65h,8bh,4eh,4ch,04h
+			db	ebh,98h,3bh,4ah,74h,4ah,9bh,aeh
+			db	0dh,ebh,7ah,2ch,14h,eah,80h,bfh
+			db	3fh,4ch,65h,4dh,1fh,13h,9fh,a7h
+			db	48h,dch,2ah,03h,57h,84h,b4h,00h
+			db	6ch,11h,a4h,6ah,e1h,fdh,2ch,3ah
+			db	ddh,c7h,6ah,64h
+			sbc	a,e
+			adc	a,a
+			nop
+			call	z,L7b5b
+			adc	a,l
+			sbc	a,(hl)
+			call	nz,L57ef
+			jr	nz,L5b5c
+			call	po,L8579
+			ret	m
+			sub	c
+			push	af
+			or	(hl)
+			ld	l,d
+			inc	e
+			ld	(hl),06h
+			call	nc,Le89c
+			call	nc,L33c4
+			ld	b,9eh
+			call	c,La8ca
+			ld	e,00h
+			add	a,a
+			jr	z,L5b2b
+			ld	d,h
+			adc	hl,bc
+			ret	m
+			adc	a,b
+			rst	08h
+			ld	b,l
+			or	e
+			sub	c
+			ld	d,70h
+			ld	d,h
+			and	c
+			ld	l,a
+			jp	m,L2237
+			rst	30h
+			ld	a,68h
+			jr	nc,L5b53
+			ld	a,c
+			cpl
+			inc	d
+			ld	e,e
+			inc	de
+			exx
+			add	a,a
+			dec	c
+			sbc	a,l
+			and	c
+			xor	d
+			rst	28h
+			inc	de
+			ret	z
+			and	c
+			ld	c,(hl)
+			add	a,h
+			or	(hl)
+			nop (2x) *
+			jp	po,La512
+			ret	nz
+			call	z,L2ede
+			push	de
+			halt
+			call	po,L9059
+			add	a,h
+			and	b
+			ld	b,h
+			ld	a,(5a7ah)
+			ld	b,e
+			ld	b,a
+			ld	d,e
+			xor	d
+			ld	de,27fch
+			jp	(hl)
+			db	00h,a9h
+			ret	c
+			or	b
+			ld	a,d
+			ld	bc,8fc8h
+			inc	sp
+			adc	a,(hl)
+			ld	a,h
+			add	hl,hl
+			or	(hl)
+			ld	e,d
+			sbc	a,l
+			xor	e
+			add	a,l
+			sbc	a,b
+			dec	h
+			xor	c
+			ld	b,(hl)
+			call	nc,L6caf
+			sbc	a,(hl)
+			add	a,e
+			cp	h
+			ld	a,(de)
+			rst	18h
+			sub	(hl)
+			ld	a,(hl)
+			cp	f1h
+			jr	nc,L5b59
+			halt
+			ld	h,c
+			di
+			pop	hl
+			ld	(hl),h
+			rst	30h
+			sub	(hl)
+			ld	b,h
+			ld	e,d
+			call	z,L795e
+			cp	e
+			call	nc,Ld822
+			ld	d,h
+			rst	00h
+			and	h
+			adc	a,c
+			ld	e,e
+			ld	l,(hl)
+			cp	l
+			call	po,L5bb3
+			ld	d,d
+			sbc	a,(hl)
+			ld	c,h
+			sbc	a,c
+			ld	(hl),h
+			jp	po,L9fe7
+			res	4,d
+			add	a,d
+			jp	po,L2dfd
+			ld	e,a
+			ld	(bc),a
+			ret	pe
+			rlca
+			sub	e
+			sub	a
+			and	b
+			ld	c,(hl)
+			ret	nz
+			ld	b,e
+			adc	a,e
+			call	z,L758c
+			inc	(hl)
+			dec	c
+			ld	b,l
+			ld	b,l
+			rst	08h
+			and	l
+			cp	b
+			jp	L0ff6
+			db	5ah,f2h,a6h
+			add	a,d
+			ld	bc,c3abh
+			ld	l,a
+			and	(hl)
+			ld	(5e95h),a
+			sub	cch
+			ld	a,e
+			pop	hl
+			jr	nz,L5b98
+			inc	sp
+			cpl
+			inc	a
+			sub	e
+			dec	bc
+			ld	e,b
+			jr	nz,L5c22
+			cp	c
+			sub	d
+			sub	b6h
+			jp	nz,Lf7e6
+			rla
+			or	2eh
+			di
+			push	bc
+			ld	a,e
+			and	c
+			sbc	a,a
+			ld	h,l
+			ret	c
+			dec	(hl)
+			ld	hl,(4d41h)
+			call	c,L6c98
+			out	(b2h),a
+			nop (2x) *
+			pop	de
+			sbc	a,b
+			push	af
+			ld	a,c
+			ld	l,d
+			ld	l,e
+			inc	bc
+			pop	de
+			add	a,h
+			nop (2x) *
+			ld	a,(bc)
+			nop (2x) *
+			sbc	a,e
+			ld	l,l
+			ld	b,(hl)
+			ret
+			db	cfh,9ch,d2h,68h,eah,48h,c1h,65h
+			db	23h,deh,d9h,51h,8bh,58h,9ah,31h
+			db	5dh,e3h,edh,e0h,8ah,6bh,49h,15h
+			db	a8h,08h,42h,63h,f5h,14h,dbh,80h
+			db	bfh,e0h,ffh,53h,f3h,37h,08h
+			di
+			nop (2x) *
+			and	b
+			out	(94h),a
+			jp	(hl)
+			db	ffh,d1h,3dh,d3h,c2h,1eh,afh,09h
+			db	abh,23h,dch,6bh,1bh,00h,f7h,61h
+			db	08h,57h,3ch,aah,65h,3ch,09h,a4h
+			db	60h,a6h,53h,71h,3eh,91h,86h,2ch
+			db	f5h,a5h,cdh,e3h,b5h,d2h,c9h,d6h
+			db	5eh,e9h,1fh,f9h,abh,2fh,06h,3fh
+			db	7fh,75h,3eh,28h,34h,14h,cdh,ach
+			db	c9h,a8h,1bh,24h,fah,6bh,d1h,9ch
+			db	aeh,a8h,f0h,3fh,90h,f1h,bdh,03h
+			db	e5h,25h,feh,84h,0dh,82h,c9h,1fh
+			db	cch,6fh,5eh,cch,e9h,d0h,64h,dfh
+			db	7bh,97h,c6h,2bh,f0h,d2h,fbh,80h
+			db	f1h,52h,25h,f8h,47h,88h,24h,36h
+			cp	b
+			rst	00h
+			ld	h,d
+			rrca
+			ld	a,83h
+			sbc	a,(hl)
+			ld	a,d
+			rst	30h
+			sub	b
+			ld	d,d
+			jp	pe,L1139
+			ld	(d54eh),a
+			ccf
+			ret	p
+			rla
+			jr	z,L5d06
+			ret	pe
+			ld	h,c7h
+			ret	m
+			ei
+			dec	d
+			cp	c
+			and	b
+			ld	d,h
+			ld	e,bah
+			adc	a,d
+			pop	hl
+			or	h
+			xor	c
+			add	a,h
+			ex	af,af'
+			inc	b
+			and	l
+			ret
+			db	6fh,4fh,fah,73h,87h,6bh,0ch,66h
+			db	4fh
+			sub	e
+			add	a,59h
+			sbc	a,c
+			and	c
+			inc	d
+			add	a,c
+			jp	c,L8877
+			ld	b,(hl)
+			xor	e
+			add	a,e
+			ld	d,d
+			ld	c,b6h
+			call	p,L0860
+			dec	c
+			ld	b,a
+			ld	e,cch
+			jp	p,L01ba
+			ld	l,c
+			jp	p,Lbe17
+			inc	de
+			dec	a
+			add	hl,hl
+			or	a
+			rlca
+			ld	c,c
+			dec	a
+			sub	l
+			ld	h,(hl)
+			call	L4a15
+			ld	(hl),d
+			inc	hl
+			sub	e
+			add	a,b
+			jp	pe,L171e
+			cp	a
+			and	e
+			add	a,b
+			dec	h
+			ld	sp,hl
+			add	a,l
+			inc	hl
+			ld	(hl),e
+			adc	a,b
+			in	c,(c)
+			add	a,h
+			out	(6dh),a
+			push	af
+			ld	b,c
+			and	4ah
+			ld	h,c
+			dec	hl
+			call	po,L5231
+			xor	(hl)
+			inc	sp
+			ld	d,c7h
+			sbc	a,c
+			call	nc,Ld916
+			adc	a,(hl)
+			ld	(hl),b
+			jp	(hl)
+			db	86h,a7h,1eh,87h,0eh,2ch,b7h,82h
+			db	3dh,5eh,58h,e3h,d7h,b9h,b1h,83h
+			db	7fh,9bh,f5h,20h,41h,a2h,46h,ach
+			db	fch,abh,2eh,97h,17h,a1h,c7h,64h
+			db	32h,5bh,1bh,07h,79h,66h,f3h,c5h
+			db	bfh,91h,2ah,57h,31h,89h,5ah,f8h
+			db	84h,5eh,9bh,5ah,89h,dah,bfh,e9h
+			db	01h,6eh,8fh,62h,57h,56h,d8h,4fh
+			db	5ch,a9h,5ah,89h,30h,97h,a6h,2ah
+			db	b5h,22h,3bh,ffh,38h,eeh,b5h,b1h
+			db	6dh,96h,afh,b5h,04h,05h,bah,e0h
+			db	f4h,f6h,61h,12h,24h,47h,cbh,b4h
+			db	ddh,6fh,0dh,45h,57h,81h,55h,e0h
+			db	09h,e5h,4ch,5bh,64h,afh,e4h,33h
+			db	0fh,72h,bch,a4h,1dh,d3h,12h,27h
+			db	2eh,84h,0ch,55h,50h,d8h,2bh,66h
+			db	d4h,82h,3ah,cfh,d7h,78h,f1h,a8h
+			db	e8h,84h,bch,c5h,f8h,92h,bdh,f1h
+			db	48h,f1h,0ah,82h,bfh,19h,9bh,dah
+			db	08h,a5h,a1h,fah,34h,1eh,eah,6ah
+			db	04h,85h,05h,7fh,f9h,42h,d9h,59h
+			db	9fh,5ah,5ah,81h,d8h,cdh,84h,36h
+			db	19h,cah,c2h,86h,e6h,2fh,41h,74h
+			db	fah,9bh,41h,f8h,bfh,1fh,e6h,d3h
+			db	61h,14h,a1h,c0h,79h,56h,a6h,b4h
+			db	43h,23h,46h,13h,40h
+			ld	e,d
+			ld	b,(hl)
+			call	L5717
+			call	pe,L3544
+			inc	h
+			dec	(hl)
+			inc	bc
+			ld	d,l
+			adc	a,l
+			sub	bfh
+			in	a,(dbh)
+			ld	a,e
+			ret	pe
+			add	a,h
+			dec	hl
+			ld	hl,(204dh)
+			jr	z,L5e4b
+			ld	d,c
+			add	a,e
+			ld	(ab9dh),hl
+			ret	z
+			daa
+			and	e
+			ld	a,e
+			or	c
+			adc	a,d
+			rlca
+			ld	d,a
+			ld	d,e
+			cp	b
+			ld	a,(hl)
+			cp	b
+			halt
+			xor	(hl)
+			add	a,c
+			ld	b,d
+			ld	c,(hl)
+			ld	e,h
+			sub	07h
+			ld	d,a
+			jp	m,Led90
+			inc	h
+			call	m,L1ad1
+			ld	b,d
+			call	nc,L6f35
+			push	af
+			ld	(bc),a
+			dec	sp
+			ex	(sp),hl
+			pop	de
+			inc	a
+			ld	hl,(7b58h)
+			ld	(hl),h
+			sub	(hl)
+			ret	po
+			ld	l,e
+			ld	(f51dh),a
+			ld	(hl),c
+			ld	h,a
+			nop (2x) *
+			ld	b,3ch
+			ld	d,a3h
+			add	a,cah
+			xor	h
+			ld	(bc),a
+			jp	po,Lf347
+			call	po,Lcb05
+			ld	(hl),d
+			ld	c,91h
+			sub	e
+			sub	h
+			push	de
+			dec	b
+			ld	(hl),ffh
+			or	a
+			dec	sp
+			cp	d
+			call	nc,Lecab
+			djnz	L5e26
+			ld	b,d
+			ld	b,d
+			ld	sp,df76h
+			dec	d
+			ex	af,af'
+			dec	b
+			ex	(sp),hl
+			rst	28h
+			ld	e,90h
+			inc	hl
+			ld	h,d
+			push	bc
+			ld	h,43h
+			inc	a
+			ld	h,49h
+			ld	l,c
+			ld	h,e
+			adc	a,6bh
+			call	c,L10d7
+			dec	a
+			ld	c,e
+			ld	h,c
+			ld	b,(hl)
+			di
+			and	b
+			or	c
+			ei
+			ret	nz
+			ld	c,(iy + 49h)
+			sub	l
+			dec	hl
+			ld	l,b
+			ld	e,a
+			call	c,L4cae
+			rst	28h
+			call	p,L276f
+			rra
+			or	b
+			jp	nz,Le1bb
+			ex	af,af'
+			dec	h
+			ld	b,(hl)
+			ld	h,c
+			ld	d,7fh
+			add	a,a
+			xor	d
+			ex	de,hl
+			add	a,h
+			xor	b
+			inc	c
+			sub	a8h
+			xor	h
+			ld	h,h
+			sbc	a,h
+			dec	sp
+			and	(hl)
+			jr	c,L5e77
+			ld	a,b
+			djnz	L5ec6
+			nop (2x) *
+			xor	b
+			ld	h,(hl)
+			jp	po,Ldffb
+			ld	e,d
+			ld	bc,a7aeh
+			jr	L5ea8
+			db	7fh,1bh,25h,00h,f4h,75h,5ch,6eh
+			db	0ch,95h,b0h,0bh,51h,33h,c3h,5eh
+			db	d9h,4eh,cdh,49h,7ch,57h,9ch,1ch
+			db	76h,f3h,3ah,e0h,d5h,12h,6ah,2dh
+			db	a9h,72h,43h,1dh,26h,41h,c5h,4ah
+			db	cbh,fdh,1eh,88h,30h,c2h,8eh,bbh
+			db	3eh,26h,a4h
+			push	bc
+			ld	(hl),d
+			cp	e
+			ld	h,c
+			ld	l,c
+			ld	d,e
+			add	a,(hl)
+			ret	z
+			dec	h
+			call	L8534
+			ld	c,b
+			ld	hl,(312bh)
+			adc	a,h
+			ld	l,c
+			adc	a,h
+			ld	(de),a
+			ld	c,a
+			or	1ah
+			pop	af
+			ld	sp,hl
+			inc	sp
+			ld	a,(3754h)
+			sbc	a,c
+			or	(hl)
+			sbc	a,l
+			ld	e,b
+			ld	b,e
+			push	af
+			di
+			jp	pe,L2c9d
+			add	a,84h
+			inc	de
+			ld	l,l
+			dec	b
+			ld	(dfdch),hl
+			ld	h,b
+			dec	l
+			add	a,d
+			ld	a,h
+			ld	c,b
+			sub	b
+			call	L86fc
+			ld	a,(bc)
+			dec	b
+			ld	b,(hl)
+			ld	d,l
+			ld	b,e
+			ld	l,b
+			ld	b,l
+			sub	58h
+			nop
+			ld	(bc),a
+			ld	(0e38h),a
+			rra
+			ld	(de),a
+			push	hl
+			and	d
+			ld	l,b7h
+			xor	e
+			sbc	a,c
+			ret
+			db	0ah,33h,96h,b0h,fbh,2fh,7fh,f9h
+			db	3bh,b4h,f9h,14h,fbh,e5h,84h
+			ret	nz
+			ld	(hl),a
+			jr	nc,L5f34
+			cp	(hl)
+			sbc	a,2fh
+			dec	h
+			inc	bc
+			ex	af,af'
+			ld	e,h
+			ret	c
+			jp	c,Ld16b
+			jp	(hl)
+			db	f2h,3dh,0eh,a2h,6dh,d1h,76h,93h
+			db	ffh,34h,98h
+			ld	d,e
+			and	e
+			ld	a,d
+			ld	a,e
+			cp	l
+			inc	de
+			sub	efh
+			push	hl
+			and	c
+			dec	b
+			sub	06h
+			add	a,d
+			inc	c
+			ld	(de),a
+			add	iy,de
+			dec	sp
+			ret	pe
+			inc	e
+			inc	(hl)
+			rst	38h
+			ld	d,e
+			call	nz,L65c6
+			and	h
+			xor	h
+			call	pe,L563c
+			ret	c
+			sub	e
+			ld	e,(hl)
+			ld	l,b
+			add	hl,hl
+			dec	sp
+			rst	18h
+			sub	b
+			xor	a
+			ld	l,d
+			rst	00h
+			ld	a,(bc)
+			ld	a,(hl)
+			ex	de,hl
+			and	a
+			cp	e
+			nop (2x) *
+			ld	e,d
+			call	po,Lee3f
+			ld	a,b
+			call	p,L4861
+			jp	m,L0b24
+			add	a,a
+			sbc	a,b
+			pop	bc
+			sbc	a,26h
+			sbc	a,d
+			xor	a
+			ld	a,l
+			in	a,(94h)
+			xor	e
+			ld	c,e
+			call	pe,Laf78
+			rst	20h
+			xor	b
+			sub	60h
+			ld	(hl),d
+			nop (2x) *
+			inc	de
+			ld	h,e
+			ld	bc,60c3h
+			pop	de
+			cp	a
+			jp	(hl)
+			db	bfh,4fh,88h,75h,f1h,0dh,12h,dah
+			db	14h,91h,6ah,e1h,bdh,d2h,a2h,cfh
+			db	3fh,aah,aah,f2h,a9h,ffh,e5h,c8h
+			db	62h,71h,d5h,63h,46h,b3h,dfh,5ch
+			db	39h,f3h,4dh,08h,85h,36h,6fh,f1h
+			db	7bh,4eh,efh,ffh,cfh,85h,bbh,e4h
+			db	58h,1ah,e1h,dch,29h,21h,41h,58h
+			db	73h,b6h,ech,aah,71h,02h,c0h,43h
+			db	25h
+			ld	l,c
+			ld	d,a
+			ld	hl,(6395h)
+			and	b
+			ld	e,(hl)
+			jp	nz,Le48c
+			sub	a
+			ld	c,l
+			ld	e,c
+			ld	l,h
+			and	d
+			ld	c,a
+			add	hl,hl
+			ld	a,(bc)
+			push	de
+			add	a,c
+			adc	a,l
+			jr	c,L60a2
+			inc	b
+			rlca
+			ld	sp,d20bh
+			ld	e,c
+			ld	b,h
+			add	a,h
+			ei
+			ld	b,e
+			call	p,L5974
+			or	e
+			ld	l,(hl)
+			dec	l
+			xor	b
+			jr	L6038
+			ld	sp,hl
+			rlca
+			add	hl,de
+			ld	e,h
+			add	a,l
+			add	a,d
+			ld	l,b
+			ld	h,d
+			ld	(bc),a
+			sbc	a,d
+			inc	l
+			xor	e6h
+			rra
+			cpl
+			ld	(de),a
+			or	b
+			ld	de,9616h
+			halt
+			sbc	a,d
+			ret	z
+			ld	h,adh
+			call	c,L9420
+			ld	h,c
+			add	a,c
+			ld	d,a
+			ld	hl,(c1c7h)
+			daa
+			ret	nz
+			cp	h
+			ld	a,b
+			ld	a,c
+			adc	a,d
+			ld	l,b
+			sub	c
+			and	d
+			ld	b,d
+			ld	b,e
+			and	b
+			scf
+			and	h
+			jp	pe,L9b21
+			push	hl
+			cpl
+			sbc	a,adh
+			cp	30h
+			cp	d
+			djnz	L60cc
+			cp	c
+			adc	a,a
+			cp	e
+			adc	a,l
+			inc	de
+			jp	z,L7366
+			adc	a,a
+			and	e
+			cp	a
+			push	hl
+			cp	c
+			add	hl,bc
+			ld	(L4ca4),hl
+			inc	a
+			xor	h
+			out	(0ah),a
+			and	d
+			cp	c
+			ld	e,a
+			ld	h,d
+			ld	l,abh
+			sub	(hl)
+			adc	a,c
+			ret	nz
+			ld	c,35h
+			ld	(a88ah),hl
+			ld	l,a
+			ld	d,(hl)
+			ret	pe
+			and	9dh
+			dec	h
+			nop (2x) *
+			or	(hl)
+			inc	sp
+			cp	a
+			sbc	a,e
+			ld	d,(hl)
+			ld	d,(hl)
+			and	a
+			or	a
+			ld	h,d
+			ld	d,e
+			push	bc
+			ld	(81e1h),a
+			add	hl,bc
+			jp	c,La9ec
+			inc	de
+			inc	(hl)
+			jp	nc,Lde77
+			ld	d,l
+			djnz	L6128
+			and	(hl)
+			dec	b
+			ld	(e978h),sp
+			adc	a,h
+			xor	(hl)
+			nop
+			ld	c,l
+			cp	l
+			ret	nz
+			jp	pe,L0039
+			jr	nc,L6140
+			ld	d,l
+			ld	h,b
+			ld	l,a
+			ld	e,(hl)
+			ret	p
+			adc	a,h
+			ld	h,c
+			ret	nc
+			ld	e,(hl)
+			pop	af
+			jp	po,L15b6
+			or	6ch
+			ret	p
+			nop
+			sub	l
+			ld	(hl),e
+			ld	d,d
+			ld	ixh,ixh *
+			cp	c
+			ld	b,h
+			ld	(hl),h
+			rrca
+			ld	(hl),b
+			ld	(hl),d
+			rlca
+			and	d
+			jr	z,L6189
+			dec	(hl)
+			and	a
+			ret	p
+			jp	c,Lb0f2
+			and	a
+			ret	m
+			ld	(a68bh),hl
+			cp	e
+			xor	(hl)
+			daa
+			xor	d
+			ld	de,fd95h
+			ld	c,(hl)
+			ld	c,(ix + ceh)
+			and	a
+			dec	de
+			ld	c,(hl)
+			ld	b,b
+			add	a,99h
+			ld	b,0ah
+			di
+			push	bc
+			ld	e,h
+			ld	de,ad5eh
+			ld	e,(hl)
+			ld	l,c
+			ld	a,(hl)
+			cp	79h
+			ld	e,c
+			ld	e,d
+			jr	z,L60ed
+			inc	c
+			ld	e,l
+			ld	(hl),l
+			xor	h
+			sub	b
+			cp	h
+			ld	a,b6h
+			or	d
+			cp	h
+			xor	e
+			ld	l,41h
+			ld	h,l
+			sbc	a,55h
+			sub	48h
+			ld	d,(hl)
+			adc	a,e
+			ld	c,a
+			ld	b,d
+			ex	de,hl
+			push	hl
+			ld	d,c
+			cp	l
+			ret	nz
+			xor	a
+			inc	h
+			ret	nz
+			add	hl,bc
+			ld	b,(hl)
+			sub	l
+			dec	h
+			halt
+			ld	(408fh),a
+			call	L8a80
+			call	m,La964
+			pop	hl
+			ld	d,a
+			ld	(hl),d
+			rla
+			add	a,e
+			dec	(hl)
+			sbc	a,a
+			jp	p,L8e5d
+			cp	b
+			ex	de,hl
+			ld	l,a
+			xor	e
+			call	c,Lc622
+			call	nc,Lad36
+			rst	38h
+			ld	b,c0h
+			ret	z
+			ld	l,l
+			cp	a
+			jr	z,L6130
+			ld	a,c
+			ld	e,e
+			add	a,h
+			pop	bc
+			ld	de,4140h
+			ld	(hl),b
+			sbc	a,e
+			adc	a,a
+			ld	b,d
+			ld	l,a5h
+			ld	ix,7e49h
+			push	bc
+			jr	L61f6
+			db	1dh,a8h,7bh,78h,bbh,17h,b9h,62h
+			db	e6h,a6h,7ah,f6h,abh,f3h,b4h,a0h
+			ld	l,e
+			ld	(bc),a
+			ld	h,h
+			ld	l,d
+			adc	a,b
+			or	e
+			dec	l
+			xor	(hl)
+			inc	a
+			rlca
+			jp	pe,L9048
+			or	7dh
+			dec	d
+			cpl
+			dec	(hl)
+			inc	e
+			ld	a,e
+			ld	a,2bh
+			ld	e,b
+			add	hl,bc
+			inc	b
+			rst	18h
+			jp	nc,L9379
+			dec	bc
+			cp	c
+			ld	h,c
+			cp	c
+			or	h
+			call	nc,Le7ff
+			call	nc,L9f43
+			ld	d,b
+			jp	po,Led05
+			rst	00h
+			rst	38h
+			jp	p,L3e00
+			ld	(de),a
+			ld	a,h
+			rst	20h
+			dec	e
+			ld	d,e
+			add	hl,hl
+			cp	84h
+			dec	hl
+			ld	l,e
+			ld	d,b9h
+			sbc	a,(hl)
+			ld	a,l
+			ld	h,e
+			ld	(hl),h
+			jr	nz,L6252
+			jp	L7e4c
+			db	93h,b9h,c7h
+			ld	h,h
+			inc	c
+			cp	c
+			and	a
+			rrca
+			pop	de
+			sub	a
+			rlca
+			adc	a,a
+			jp	pe,La97b
+			sbc	a,8dh
+			jp	nz,L67a4
+			nop (2x) *
+			ei
+			ld	e,e
+			call	p,Lc63c
+			add	hl,bc
+			ld	h,h
+			ret	m
+			xor	l
+			adc	a,d
+			ld	d,36h
+			ld	b,l
+			dec	b
+			cp	e
+			ret	nc
+			ld	d,d
+			ld	l,(hl)
+			ld	c,e
+			adc	a,8fh
+			ld	(aea8h),a
+			jp	m,L2ba0
+			ld	a,a
+			dec	e
+			sbc	a,d
+			ld	c,b
+			ld	c,d
+			ret	p
+			ld	l,d
+			sbc	a,e
+			cp	c
+			jr	nc,L61dd
+			rst	20h
+			rst	28h
+			ld	c,l
+			ld	b,a
+			inc	hl
+			push	af
+			add	a,h
+			ld	a,b
+			add	hl,bc
+			cp	h
+			ld	l,l
+			ex	(sp),hl
+			add	a,d
+			ret	p
+			ld	e,e
+			rst	30h
+			dec	l
+			nop
+			adc	a,a
+			ex	(sp),hl
+			sub	f7h
+			push	af
+			ld	a,h
+			ld	l,d
+			or	a
+			jp	po,L3577
+			rrca
+			jp	(hl)
+			db	84h,8bh,2ah,63h
+			pop	de
+			ld	d,e
+			jp	po,Lfb7c
+			ld	b,b
+			add	a,(hl)
+			rst	28h
+			ld	a,(hl)
+			jp	c,L0f82
+			cp	e
+			ld	h,e
+			inc	(hl)
+			ld	d,h
+			dec	b
+			ld	l,c
+			rlca
+			and	a
+			ld	l,b
+			dec	a
+			ld	c,l
+			adc	a,f4h
+			sbc	a,l
+			jp	po,L5677
+			ld	b,e
+			dec	h
+			ld	h,c
+			ld	a,a
+			ld	(hl),c
+			jp	nz,Ld8fb
+			and	(hl)
+			ld	(hl),h
+			adc	a,b
+			jr	nc,L62da
+			call	pe,L5928
+			ld	a,h
+			adc	a,(hl)
+			add	a,h
+			inc	l
+			ld	c,h
+			inc	(hl)
+			sub	h
+			adc	a,8eh
+			sbc	a,(hl)
+			ld	h,c
+			sbc	a,e
+			ld	(29f0h),a
+			call	po,Lcb2d
+			ld	c,b
+			jp	po,L7503
+			or	e
+			cp	(hl)
+			pop	af
+			ld	b,l
+			jr	z,L626c
+			ex	(sp),hl
+			in	a,(8ah)
+			ld	h,b
+			jp	p,Lda1f
+			ld	e,b
+			ld	h,(hl)
+			push	af
+			ld	a,(de)
+			add	a,h
+			and	h
+			rst	08h
+			cp	b
+			pop	de
+			ld	a,b
+			ld	a,a
+			jr	c,L62db
+			ld	e,70h
+			and	l
+			add	a,a
+			daa
+			ex	af,af'
+			cp	d
+			or	a
+			rra
+			xor	b
+			ld	e,a
+			ret
+			db	9eh,c5h,e9h,ebh,0eh,68h,a9h,deh
+			db	35h,20h,c8h,bbh,efh,b9h,0bh,5ch
+			db	ech,93h,06h,66h,14h,ffh,41h,cah
+			db	70h,d5h,81h,44h,0dh,77h,eah
+			cp	d
+			xor	a
+			ld	a,l
+			cpl
+			sbc	a,c
+			ld	l,d
+			ld	l,e
+			sbc	a,b
+			sub	e
+			sbc	a,(hl)
+			sub	b
+			dec	hl
+			dec	sp
+			nop (2x) *
+			ld	d,b
+			ld	d,l
+			add	a,d
+			jr	z,L6332
+			jp	p,Lbc7a
+			xor	d
+			ld	(hl),b
+			xor	c
+			dec	e
+			jr	nc,L6292
+			or	(hl)
+			ld	d,e
+			and	h
+			ld	a,a
+			in	a,(7ah)
+			call	c,L8798
+			or	c
+			ld	l,(hl)
+			ld	h,(hl)
+			inc	l
+			dec	b
+			or	l
+			pop	bc
+			ld	hl,(863ah)
+			ld	a,d
+			ld	h,h
+			cp	h
+			ret	m
+			ld	b,h
+			add	a,h
+			ld	sp,3285h
+			ld	sp,f36dh
+			ld	d,e
+			ld	l,13h
+			ld	hl,(cfd6h)
+			di
+			ld	d,h
+			ret	i *
+			adc	a,a
+			call	m,Laa48
+			ld	l,a
+			add	a,a
+			add	a,c
+			ld	b,b
+			cp	h
+			ld	b,h
+			ret	pe
+			add	hl,de
+			inc	e
+			and	e
+			ld	b,d
+			add	a,43h
+			ld	c,d
+			ld	e,l
+			or	h
+			ld	d,h
+			ret	nz
+			jp	po,L33bb
+			ld	l,a
+			ld	d,c
+			and	53h
+			di
+			ret	c
+			ld	e,c
+			ld	l,abh
+			ld	h,(hl)
+			pop	bc
+			adc	a,(hl)
+			ld	b,c
+			add	a,b
+			add	a,a
+			ld	h,c
+			adc	a,l
+			or	b
+			adc	a,d
+			and	c
+			ld	d,2ch
+			sbc	a,(hl)
+			ld	e,b
+			ld	a,e
+			ld	a,b
+			ld	l,l
+			push	de
+			call	m,Lec0d
+			ld	l,b
+			ld	c,h
+			or	b
+			ld	d,a
+			dec	l
+			sbc	a,e
+			adc	a,a
+			ld	h,e
+			xor	b1h
+			out	(ech),a
+			ld	(hl),c
+			inc	bc
+			rrca
+			ld	a,e2h
+			in	a,(cah)
+			ret	z
+			call	nc,L57de
+			ld	c,c
+			ld	d,(hl)
+			dec	l
+			rst	30h
+			ld	l,d
+			ld	c,l
+			ld	(hl),a
+			ld	l,b
+			and	h
+			ld	(bc),a
+			ld	h,(hl)
+			and	l
+			or	l
+			cp	d
+			ld	h,h
+			ld	h,a
+			or	c
+			inc	bc
+			sub	(hl)
+			rst	10h
+			ld	c,h
+			or	c
+			inc	sp
+			jr	nc,L63fd
+			ld	d,c
+			ld	(hl),b
+			ld	b,e
+			ld	h,l
+			ld	d,c
+			call	nz,L4524
+			inc	e
+			ld	h,d
+			inc	de
+			ld	e,a
+			dec	(hl)
+			add	a,e
+			ld	e,d
+			ld	h,a
+			adc	a,b
+			call	pe,L578c
+			ld	a,c
+			ld	(hl),h
+			dec	sp
+			rlca
+			and	e
+			or	d
+			call	z,La7e8
+			and	a
+			and	ixl *
+			jp	p,L9050
+			add	hl,de
+			or	a
+			ld	a,(077dh)
+			ld	l,(hl)
+			ld	(84bdh),a
+			adc	a,h
+			add	a,d
+			sbc	a,e
+			inc	e
+			ld	h,e
+			nop (2x) *
+			jr	c,L63c9
+			ld	c,h
+			ld	a,(de)
+			ld	h,h
+			or	h
+			and	b
+			ld	h,l
+			rst	30h
+			ld	a,d
+			ld	(hl),l
+			cp	e
+			jr	z,L6406
+			ld	d,e7h
+			ld	a,(hl)
+			or	l
+			ld	b,d
+			cpl
+			exx
+			pop	af
+			pop	de
+			sbc	a,b
+			sbc	a,h
+			xor	65h
+			ret	nz
+			jp	m,L7886
+			ld	h,e
+			push	bc
+			xor	l
+			pop	de
+			or	99h
+			adc	a,h
+			sub	e
+			ld	(hl),a
+			ld	b,d
+			ld	e,a
+			sbc	a,b
+			jp	po,L7e43
+			or	e
+			sbc	a,d
+			dec	hl
+			ld	e,(hl)
+			ld	e,l
+			dec	a
+			ld	a,a
+			ld	l,(hl)
+			rlca
+			djnz	L639d
+			cp	a
+			rra
+			ld	b,c
+			ld	h,6ch
+			inc	l
+			and	87h
+			ld	h,e
+			xor	e
+			xor	b
+			sub	b
+			add	a,(hl)
+			xor	a
+			ld	b,l
+			ret	pe
+			jp	nc,L9ee6
+			cp	b
+			call	m,L43ad
+			cp	(hl)
+			inc	b
+			call	m,L57d6
+			ld	b,(hl)
+			dec	sp
+			sub	48h
+			ld	e,d
+			ld	e,b
+			ld	e,(hl)
+			inc	de
+			dec	d
+			and	l
+			ld	sp,hl
+			or	e
+			ld	a,d
+			ld	l,h
+			ret
+			db	7eh,1ah,9dh,b3h,10h,a7h,42h,a7h
+			db	fch,21h,2dh,00h,43h,4fh,abh,b5h
+			db	44h,09h,c3h,7eh,a7h,22h,6ah,5eh
+			db	9bh,aah,86h,7fh,18h,8bh,e2h,bah
+			db	b1h,b6h,feh,e5h
+			ld	hl,4e1fh
+			add	a,b
+			ld	c,7ch
+			ld	e,a
+			ld	a,d
+			push	af
+			ld	b,h
+			ld	b,c
+			inc	h
+			djnz	L64ab
+			ld	e,d
+			adc	a,d
+			ld	e,a
+			xor	c
+			nop (2x) *
+			nop (2x) *
+			push	de
+			push	af
+			ld	a,h
+			cp	h
+			call	m,L216f
+			sbc	a,d
+			ld	b,b
+			ld	c,d
+			ld	e,h
+			inc	l
+			dec	e
+			xor	d
+			inc	e
+			ld	bc,072ah
+			jp	z,Lf9f7
+			adc	a,e
+			rst	18h
+			ret
+			db	6ah,d7h,11h,5dh,04h,68h,3fh,8dh
+			db	adh,bfh,b2h,95h,02h,04h,7bh,afh
+			db	d2h,b8h,28h,ffh,51h
+			ret
+			db	57h,b5h,4ch,e2h,2bh,69h,47h,59h
+			db	48h,fch,27h,fah,4fh,90h,c5h,bch
+			db	71h,ceh,33h,aah,72h,16h,b2h,0bh
+			db	e7h,d7h,deh,43h,18h,f9h,6ah,0dh
+			db	62h
+			daa
+			ld	l,e
+			exx
+			sub	l
+			ld	hl,(c732h)
+			ld	h,a
+			cp	l
+			ld	e,(hl)
+			ld	hl,(0f2eh)
+			dec	l
+			add	a,a
+			adc	a,b
+			add	a,7ch
+			rst	38h
+			inc	de
+			cp	a
+			sub	b1h
+			inc	d
+			dec	hl
+			ld	e,e
+			call	nz,Laabe
+			cp	e
+			or	d
+			and	a
+			ld	d,d
+			cp	b
+			ccf
+			and	(hl)
+			dec	b
+			ld	(hl),c
+			djnz	L6509
+			sbc	a,h
+			ld	(hl),b
+			call	c,La09f
+			ld	bc,c5f0h
+			ld	(hl),a
+			ld	a,h
+			ld	a,h
+			ld	a,i
+			dec	hl
+			ld	a,(3fa7h)
+			ret	m
+			add	a,h
+			ld	(8a83h),a
+			cp	e
+			pop	bc
+			sub	c7h
+			out	(a8h),a
+			ld	a,l
+			or	b
+			and	h
+			call	m,Ld411
+			push	de
+			sub	c
+			call	nz,L6a5f
+			or	d
+			rst	28h
+			xor	d
+			dec	b
+			ld	h,c
+			ld	a,b
+			ld	e,a
+			ld	d,e
+			ld	h,b
+			inc	c
+			ld	h,e
+			ex	de,hl
+			ld	c,b
+			ld	b,e
+			ld	a,(hl)
+			add	hl,de
+			ld	d,b
+			xor	l
+			ld	b,6fh
+			ld	d,l
+			ld	hl,dde1h
+			add	hl,bc
+			dec	b
+			and	d
+			ld	c,(hl)
+			rst	30h
+			add	a,a
+			pop	bc
+			ret	z
+			ld	(5d4fh),hl
+			and	h
+			rla
+			ld	h,(hl)
+			sub	h
+			jr	nz,L64b1
+			dec	bc
+			xor	11h
+			ld	a,b
+			ld	h,h
+			ld	a,e
+			jr	nz,L64a5
+			ret	po
+			or	c
+			ei
+			ld	d,l
+			jp	nz,L67b4
+			ld	e,b
+			dec	sp
+			or	(hl)
+			and	a
+			or	e
+			inc	e
+			call	m,L1123
+			push	bc
+			ccf
+			or	e
+			ret	pe
+			call	c,L865a
+			ret
+			db	2eh,46h,9dh,71h,d4h,9eh,6eh,6ah
+			db	00h,26h,d3h,dbh,cch,f3h,e5h,e5h
+			db	cbh,09h,2fh,1fh,19h,ddh,90h
+			dec	l
+			add	hl,de
+			ex	(sp),hl
+			ld	e,c
+			dec	b
+			ld	d,h
+			xor	b
+			adc	a,h
+			call	pe,L465f
+			rrca
+			xor	h
+			ld	d,e
+			ld	d,l
+			ex	af,af'
+			or	45h
+			dec	b
+			ld	(0de5h),hl
+			or	a6h
+			ld	c,a
+			ld	a,d
+			sbc	a,33h
+			jp	m,Lb0b8
+			adc	a,d2h
+			ld	a,d
+			ld	l,l
+			ld	a,a
+			add	a,5eh
+			jr	nc,L6554
+			ld	e,(hl)
+			call	z,L501c
+			jp	pe,L771b
+			dec	de
+			ld	l,b
+			ld	d,a
+			or	e
+			sbc	a,b7h
+			and	h
+			sub	03h
+			nop
+			ld	(4dc9h),hl
+			jr	nz,L6598
+			ld	h,h
+			cp	a
+			ld	sp,hl
+			ld	d,b
+			ld	c,(hl)
+			or	c
+			or	a
+			ld	hl,(e1f1h)
+			cp	(hl)
+			ld	sp,hl
+			inc	sp
+			di
+			adc	a,c
+			ld	a,(b960h)
+			rst	30h
+			ret	nz
+			rlca
+			add	a,b
+			ld	c,h
+			rst	00h
+			ld	c,l
+			ld	a,e
+			adc	a,d
+			ld	sp,b2b0h
+			ld	h,b
+			exx
+			sbc	a,b
+			ex	de,hl
+			ld	e,e
+			add	a,b
+			ret	z
+			rst	38h
+			add	a,a
+			ld	d,(hl)
+			call	p,L5937
+			ld	c,c
+			sub	e
+			adc	a,l
+			add	a,a
+			ld	hl,97ach
+			sbc	a,a9h
+			rrca
+			ld	e,b
+			adc	a,b
+			add	hl,bc
+			ld	sp,hl
+			xor	b
+			dec	(hl)
+			ld	c,l
+			sub	e
+			xor	e
+			inc	bc
+			sbc	a,d
+			nop (2x) *
+			ld	c,b
+			ld	b,(hl)
+			add	hl,bc
+			ld	(de),a
+			ld	d,l
+			sbc	a,c
+			ld	bc,7f43h
+			cp	(hl)
+			inc	de
+			ld	e,l
+			ld	e,c
+			ret	p
+			ret	z
+			jr	c,L663f
+			ld	l,d
+			ld	l,a
+			ld	a,a
+			xor	(hl)
+			adc	a,25h
+			ld	c,l
+			call	m,L2f64
+			add	hl,de
+			add	hl,hl
+			ld	h,l
+			ex	(sp),hl
+			scf
+			sub	l
+			rlca
+			add	hl,bc
+			pop	de
+			sbc	a,(hl)
+			pop	af
+			ld	e,h
+			ei
+			dec	c
+			inc	(hl)
+			jp	c,L3bd1
+			ld	a,(bc)
+			rra
+			nop (2x) *
+			dec	l
+			ld	a,l
+			ld	e,(hl)
+			inc	d
+			ld	a,h
+			or	e
+			jp	m,Laf34
+			rra
+			ld	b,a
+			dec	sp
+			inc	de
+			xor	l
+			ld	a,(hl)
+			ld	(hl),c
+			jp	z,Ld997
+			ex	(sp),hl
+			rst	30h
+			cp	c
+			rlca
+			ld	d,c
+			push	de
+			ld	d,d
+			ld	c,l
+			jr	c,L666f
+			ld	c,bch
+			call	m,L2bb9
+			nop
+			inc	c
+			or	(hl)
+			and	l
+			dec	de
+			ld	h,b
+			jp	m,L4d8c
+			jp	p,Lc85d
+			sbc	a,l
+			call	nc,Lf2ec
+			adc	a,d
+			cp	(hl)
+			ld	l,d
+			jp	c,L75a3
+			jp	(hl)
+			db	75h,b8h
+			inc	bc
+			ld	a,h
+			sbc	a,6dh
+			ld	l,(hl)
+			add	a,d
+			sub	(hl)
+			ld	a,(hl)
+			ccf
+			add	a,(hl)
+			call	c,L35c6
+			ld	c,d
+			pop	de
+			dec	(hl)
+			sbc	a,3bh
+			daa
+			cp	e
+			ld	h,(hl)
+			add	a,a0h
+			and	l
+			push	bc
+			ld	e,f2h
+			ld	c,e
+			ld	l,78h
+			ld	d,(hl)
+			rra
+			ld	a,c
+			rst	10h
+			ret	po
+			adc	a,d
+			inc	de
+			sbc	a,(hl)
+			or	l
+			ld	d,h
+			inc	bc
+			sbc	a,a
+			jp	po,L8f4f
+			ld	a,l
+			scf
+			ld	h,h
+			adc	a,e
+			ld	d,c
+			ld	hl,8aaah
+			nop (2x) *
+			jr	nc,L6610
+			rst	08h
+			ld	(hl),b
+			ld	h,l
+			add	a,a
+			ld	l,e
+			ld	(hl),d
+			ld	a,d
+			pop	de
+			ld	l,d
+			ccf
+			dec	de
+			dec	b
+			add	a,l
+			ld	e,72h
+			add	a,h
+			add	a,e
+			ld	c,l
+			sub	a
+			ld	d,l
+			adc	a,h
+			dec	l
+			ld	e,l
+			inc	h
+			ei
+			ld	d,54h
+			ld	a,h
+			jp	z,L9c5e
+			di
+			ld	a,c
+			jp	pe,L84e0
+			ret	c
+			inc	c
+			xor	b
+			jp	po,Lfdd0
+			ret	nz
+			jp	c,L5616
+			ret	z
+			ld	d,a
+			dec	(hl)
+			ld	c,h
+			add	a,a
+			inc	ix
+			ld	b,l
+			and	d
+			ld	h,l
+			ld	hl,(ce8bh)
+			xor	d
+			jp	(hl)
+			out	(8fh),a
+			and	(hl)
+			ld	(hl),7fh
+			rst	08h
+			jp	po,L70e7
+			rst	30h
+			jp	p,La673
+			inc	d
+			ld	(be54h),a
+			ld	l,l
+			or	l
+			ld	(eb57h),a
+			dec	a
+			ld	(hl),d
+			ld	l,e
+			ld	b,6ah
+			ld	l,fdh
+			jp	c,Ld964
+			ld	d,l
+			rst	18h
+			ld	d,b
+			jp	c,Ld94d
+			ld	l,a
+			xor	c
+			ld	c,e
+			ld	b,l
+			ld	d,c
+			jp	c,L5b52
+			ld	h,d
+			ld	(hl),e
+			add	a,c
+			xor	a
+			rlca
+			adc	a,d
+			xor	(hl)
+			cp	(hl)
+			ld	a,b9h
+			sbc	a,(hl)
+			dec	d
+			adc	a,(hl)
+			add	a,(hl)
+			ld	b,c
+			ld	c,c
+			ld	c,d
+			dec	e
+			inc	sp
+			inc	sp
+			dec	a
+			ld	h,h
+			in	a,(84h)
+			ld	d,l
+			adc	a,l
+			pop	de
+			xor	(hl)
+			and	8eh
+			ei
+			ld	c,h
+			call	nc,L56b8
+			jp	nc,Lc3d5
+			cp	e
+			dec	sp
+			ld	(hl),d
+			ld	l,h
+			ld	hl,(54ech)
+			ld	c,7dh
+			halt
+			ld	h,d
+			or	h
+			ld	hl,6617h
+			call	po,Lf171
+			djnz	L674b
+			inc	b
+			adc	a,a
+			rlca
+			adc	a,d
+			ex	(sp),hl
+			ld	h,b
+			call	m,L0c00
+			rst	00h
+			call	nc,L7ec6
+			ld	e,4fh
+			jr	L671b
+			db	0fh,60h,7bh,ddh,c0h,40h,8fh,5fh
+			db	93h,8bh,27h,c0h,14h,84h,24h,f6h
+			db	2dh,94h,30h,56h,54h,9fh,08h,ebh
+			db	d0h,cch,40h,a2h,f5h,1bh
+			and	c
+			and	e
+			ld	(de),a
+			inc	de
+			halt
+			ld	l,e
+			ld	a,31h
+			jp	Le57b
+			db	5bh,91h,a5h,52h,e4h,b5h,87h
+			ld	a,(bc)
+			adc	a,h
+			inc	d
+			or	l
+			inc	e
+			adc	a,a
+			add	a,h
+			sbc	a,(hl)
+			scf
+			dec	l
+			rst	18h
+			jp	m,L6ae9
+			ret	m
+			sbc	a,e
+			ccf
+			or	h
+			push	bc
+			ld	a,e
+			ld	(hl),a4h
+			dec	de
+			ld	h,d
+			rrca
+			ld	(hl),e
+			sub	dah
+			jp	nz,L5b4c
+			rla
+			cp	c
+			jr	c,L6719
+			ld	l,l
+			sbc	a,h
+			dec	c
+			ld	e,h
+			nop (2x) *
+			ld	a,(de)
+			ex	(sp),hl
+			ld	(hl),d
+			ex	de,hl
+			sbc	a,b
+			ld	(hl),b
+			inc	a
+			pop	bc
+			dec	h
+			add	hl,bc
+			ld	a,(4ae6h)
+			inc	(hl)
+			ld	e,h
+			ld	c,a
+			sbc	a,h
+			jp	pe,L706b
+			jp	po,L5332
+			ld	(hl),a
+			ld	(hl),d
+			sub	a
+			ld	(hl),d5h
+			halt
+			inc	h
+			add	hl,bc
+			add	a,e
+			ld	(hl),d
+			ld	a,(3079h)
+			and	d
+			call	z,Ld439
+			push	de
+			ld	sp,5581h
+			daa
+			ld	l,h
+			ld	e,(hl)
+			jp	m,L9922
+			ret	po
+			xor	bdh
+			inc	l
+			and	b
+			sbc	a,l
+			ex	(sp),hl
+			ld	(hl),0eh
+			or	h
+			jp	p,L260f
+			ld	l,b
+			cp	d
+			ld	h,(hl)
+			and	a
+			ld	c,c
+			ld	hl,(6a06h)
+			ld	l,a
+			ld	hl,3240h
+			ld	a,e
+			and	b
+			ld	c,l
+			dec	a
+			ex	af,af'
+			or	l
+			sub	e
+			ld	a,l
+			inc	l
+			ld	b,a
+			sbc	a,c
+			ld	e,l
+			inc	e
+			call	z,L5417
+			call	p,Lf43d
+			add	hl,sp
+			ld	d,e
+			push	de
+			ld	l,ebh
+			adc	a,b
+			ld	d,e
+			ld	b,b
+			ld	a,95h
+			sbc	a,(hl)
+			ret	nc
+			ld	a,88h
+			jr	L6821
+			db	57h,beh,55h,dfh,c2h,c6h,37h,6ah
+			db	d9h,3eh,27h,7dh,6fh,42h,e4h,6ch
+			db	9ch,ech,14h
+			sbc	a,a
+			ld	c,h
+			adc	a,d0h
+			rst	20h
+			call	m,L352a
+			ld	de,7346h
+			ld	b,(hl)
+			add	hl,de
+			adc	a,c
+			ld	a,(de)
+			push	de
+			jp	pe,L45a6
+			ld	a,b
+			inc	b
+			sub	c
+			ld	(hl),h
+			sbc	a,a
+			call	m,L9726
+			rst	18h
+			ld	(12b3h),a
+			ld	hl,17b2h
+			sub	e
+			ret	po
+			inc	de
+			jr	nz,L680b
+			ld	a,(hl)
+			dec	bc
+			inc	hl
+			sub	c
+			ld	l,h
+			adc	a,b
+			ld	c,d
+			ld	e,b
+			sub	0eh
+			xor	e
+			sub	c
+			ld	b,c
+			push	af
+			and	c2h
+			ld	e,a
+			add	a,c8h
+			ld	de,3886h
+			ld	h,c
+			adc	a,b
+			call	nz,L475b
+			jp	p,Laf69
+			ld	b,c
+			ld	e,l
+			ei
+			jp	nc,L6760
+			or	d
+			ei
+			call	nc,L044b
+			ld	l,c
+			ld	d,a
+			ld	e,4dh
+			call	po,Laf71
+			or	e
+			ld	a,(de)
+			dec	d
+			jp	nz,Le92c
+			ld	c,c
+			dec	(hl)
+			ld	(hl),b
+			out	(1eh),a
+			jp	nz,L5aba
+			ld	h,a
+			out	(7bh),a
+			xor	c
+			sbc	a,c
+			sbc	a,l
+			ld	(bc),a
+			ld	a,(de)
+			or	l
+			ccf
+			call	pe,Lc413
+			dec	h
+			ld	l,b
+			jp	L7707
+			db	c4h,47h,eeh,72h,a3h,84h,c1h,ach
+			db	01h,edh,f0h,b2h,3bh,edh,bfh,6bh
+			db	80h,5bh,1eh
+			di
+			rlca
+			add	a,(hl)
+			jr	L68ad
+			db	67h,17h,27h,7fh,c2h,25h,a0h,47h
+			db	87h,e6h,44h,05h,84h,c5h,beh,9ch
+			db	bdh,01h,13h,37h,63h,b3h,f4h
+			ld	a,(de)
+			ld	(a6bbh),a
+			sub	c
+			nop (2x) *
+			and	c
+			ret	pe
+			and	h
+			ld	e,e
+			dec	de
+			exx
+			ld	b,45h
+			ld	h,a
+			add	hl,bc
+			cpl
+			ld	c,d
+			and	b
+			ld	hl,(4d85h)
+			adc	a,64h
+			inc	(hl)
+			or	a
+			cp	e
+			ld	a,h
+			rst	08h
+			dec	a
+			ld	h,h
+			ld	h,l
+			ld	e,l
+			ex	de,hl
+			ld	h,l
+			ret
+			db	10h,b6h,79h,86h,59h,07h,f3h,b6h
+			db	d3h,c6h,38h,9ah,bbh,2bh,7fh,9ch
+			db	10h,82h,97h,eah,2dh,fbh,05h,efh
+			db	f2h,8dh,b2h,abh,6fh,aeh,e2h,5ah
+			db	aeh,3ah,73h,e4h,80h,97h,0dh,73h
+			db	86h,6ah,9bh,48h,38h,e7h,32h,d1h
+			db	2ch,70h,24h,efh,1ch,38h,2ah,6fh
+			db	06h,14h,56h,26h,8eh,4bh,d0h
+			jp	z,L9116
+			dec	iyh *
+			add	hl,hl
+			ld	(hl),a
+			dec	de
+			ret	nc
+			ld	d,(hl)
+			ld	b,e
+			rrca
+			jr	z,L6932
+			ld	a,(bc)
+			ld	l,e
+			out	(0bh),a
+			ld	c,e
+			ld	bc,172fh
+			ld	l,e
+			ld	l,a
+			nop (2x) *
+			ld	b,d
+			halt
+			ld	c,e
+			or	a
+			ld	b,a
+			ld	(hl),d
+			dec	(hl)
+			ld	h,fdh
+			djnz	L6977
+			sbc	a,h
+			adc	a,b
+			nop (2x) *
+			ex	de,hl
+			cp	cah
+			call	nc,Lcfa8
+			ld	c,d
+			adc	a,e
+			cp	a
+			jr	z,L694f
+			ret
+			db	2bh,c6h,69h,51h,20h,25h,30h,8eh
+			db	fdh,53h
+			ld	d,a
+			ld	e,(hl)
+			dec	(hl)
+			dec	de
+			ld	e,h
+			inc	c
+			jr	z,L69d2
+			ld	a,e
+			xor	b
+			dec	e
+			push	af
+			xor	h
+			ld	d,h
+			add	hl,bc
+			cp	l
+			inc	d
+			rrca
+			ld	a,l
+			or	a
+			or	d
+			pop	af
+			or	a
+			ld	l,a
+			inc	bc
+			add	a,b
+			ld	(c2b4h),a
+			jp	nz,Lcc17
+			ld	h,45h
+			rst	30h
+			cp	b0h
+			ld	(hl),l
+			inc	b
+			ld	b,d
+			ld	a,e
+			adc	a,l
+			xor	2bh
+			ld	a,h
+			jp	pe,L57ed
+			dec	d
+			rla
+			call	po,L312c
+			jr	L6980
+			db	e2h,3fh,e4h,f1h,1ch,bch,afh,91h
+			db	05h,52h,a1h,5ch,e0h,14h,b2h
+			ret	nc
+			dec	b
+			or	(hl)
+			sbc	a,l
+			add	hl,de
+			dec	l
+			dec	hl
+			push	bc
+			adc	a,e
+			dec	h
+			xor	c
+			ld	e,3ah
+			ex	de,hl
+			sub	l
+			ld	bc,0c6eh
+			ld	c,h
+			sub	e6h
+			ld	l,l
+			dec	bc
+			xor	c
+			ld	e,e
+			rra
+			ld	e,(hl)
+			ld	(bc),a
+			inc	de
+			jp	po,Lf1ca
+			dec	sp
+			daa
+			or	2dh
+			nop
+			jp	L371e
+			db	ech
+			adc	a,e
+			sbc	a,46h
+			ld	a,e
+			ld	iyh,e *
+			inc	bc
+			dec	b
+			rra
+			or	a
+			sbc	a,h
+			ld	(hl),h
+			inc	c
+			ex	de,hl
+			djnz	L69c0
+			and	d
+			cp	e
+			add	hl,hl
+			adc	a,a
+			rst	30h
+			add	a,h
+			xor	(hl)
+			ld	c,9ah
+			sub	a
+			ld	b,3ah
+			pop	af
+			jp	m,L4822
+			cp	81h
+			pop	hl
+			ld	c,l
+			inc	de
+			add	a,a
+			and	(hl)
+			ld	c,(hl)
+			sub	e
+			nop (2x) *
+			ret	nc
+			dec	de
+			dec	e
+			ld	b,(hl)
+			ld	h,e
+			rra
+			ld	b,l
+			call	c,L8e75
+			sbc	a,e
+			cp	a
+			adc	a,(hl)
+			jp	m,La40f
+			ld	e,h
+			ld	e,e
+			call	c,Lf077
+			inc	e
+			cp	l
+			cp	l
+			adc	a,l
+			ccf
+			pop	bc
+			adc	a,e
+			ld	h,c
+			and	l
+			and	e
+			ret	po
+			ld	(hl),c
+			and	d
+			or	c
+			ld	a,h
+			ld	l,e
+			or	b
+			xor	(hl)
+			rst	20h
+			ld	l,l
+			and	(hl)
+			sub	l
+			daa
+			dec	hl
+			add	hl,bc
+			ld	sp,hl
+			ex	de,hl
+			jr	nz,L6a4b
+			pop	hl
+			ld	h,h
+			ld	e,b
+			add	hl,bc
+			ld	a,33h
+			cp	d
+			inc	hl
+			dec	h
+			ld	b,d
+			ld	de,11c7h
+			ld	d,(hl)
+			ret	po
+			pop	hl
+			and	a
+			inc	(hl)
+			ei
+			push	af
+			ld	e,d
+			ld	a,(hl)
+			jr	nc,L69d0
+			push	de
+			ret	nz
+			sub	(hl)
+			ld	b,c
+			rst	20h
+			ld	a,(hl)
+			xor	b
+			add	a,(hl)
+			add	hl,de
+			ld	h,b
+			ld	a,76h
+			adc	a,18h
+			pop	hl
+			cp	50h
+			ld	e,c
+			ld	a,ach
+			cp	d
+			xor	a
+			add	a,e
+			daa
+			and	(hl)
+			rlca
+			cp	d
+			inc	e
+			call	m,L7612
+			or	d
+			ld	h,b
+			xor	c
+			di
+			add	a,b
+			add	a,c
+			ld	e,2eh
+			ld	(hl),65h
+			or	iyl *
+			ccf
+			cp	(hl)
+			ld	a,(hl)
+			ei
+			call	m,L6064
+			inc	hl
+			ld	e,b
+			inc	e
+			dec	b
+			add	hl,sp
+			add	a,h
+			pop	hl
+			ld	c,l
+			ld	l,d
+			cp	l
+			cp	h
+			rst	08h
+			nop
+			ld	bc,6b0ah
+			ld	c,(hl)
+			and	l
+			or	a
+			jp	m,L2032
+			ex	de,hl
+			call	nz,L6068
+			rst	08h
+			ld	sp,1077h
+			sub	(hl)
+			ld	l,e
+			ld	hl,(4065h)
+			rst	00h
+			call	Ldc07
+			ld	c,a
+			out	(e8h),a
+			inc	sp
+			xor	a
+			jr	L6aa8
+			db	28h,beh,a5h,c5h,e7h,09h,b3h,f8h
+			db	9ah,6ah,40h,f3h,3fh,afh,dbh,cbh
+			db	d8h,1ah,99h,9bh,2ah,dch
+			ld	h,c
+			ld	l,86h
+			ret	po
+			sub	c
+			ld	e,h
+			rrca
+			ret	c
+			pop	hl
+			ret	po
+			and	e9h
+			ccf
+			inc	b
+			or	h
+			ld	l,d
+			ld	a,d
+			ld	e,d
+			jp	nz,L4c79
+			jp	c,Lab43
+			sbc	a,h
+			cp	(hl)
+			dec	hl
+			push	af
+			ex	(sp),hl
+			sub	c
+			rla
+			ld	(hl),c
+			jr	nc,L6ad0
+			jp	po,L6e07
+			ret	c
+			ld	b,a
+			pop	af
+			or	a
+			pop	hl
+			cp	c
+			cp	b
+			jr	L6a5c
+			db	ceh,bah,9dh,aeh,e8h,74h,1ah,9eh
+			db	20h,19h,3ah,e2h,61h,beh,41h,78h
+			db	87h,ceh,aah
+			ld	e,h
+			sub	fbh
+			inc	l
+			ret	po
+			ld	a,b
+			jr	nz,L6b52
+			inc	h
+			ld	a,f2h
+			sub	adh
+			ret	pe
+			cp	l
+			cp	e
+			ld	b,c
+			pop	hl
+			ld	l,e
+			inc	d
+			ld	a,(1537h)
+			exx
+			ret	c
+			cp	h
+			ld	d,d
+			call	po,L720c
+			cp	l
+			ld	a,(bc)
+			ld	l,c
+			ld	c,c
+			or	91h
+			sbc	a,h
+			adc	a,d9h
+			ld	d,e
+			or	(hl)
+			ld	a,l
+			inc	(hl)
+			ld	e,c
+			inc	d
+			inc	(hl)
+			or	d
+			push	hl
+			dec	l
+			ld	a,b
+			add	a,e
+			ld	(hl),h
+			and	d
+			jp	p,L0006
+			pop	de
+			sub	l
+			inc	de
+			ld	l,d
+			ld	e,l
+			call	po,Lcff9
+			ld	(bc),a
+			exx
+			ret	m
+			adc	a,a
+			inc	c
+			adc	a,1ah
+			cp	c
+			adc	a,d
+			dec	h
+			call	m,Ldabf
+			inc	h
+			cpl
+			ld	e,d
+			ld	d,l
+			sub	(hl)
+			sbc	a,h
+			bit	0,l
+			or	(hl)
+			xor	c
+			ld	d,e
+			jr	L6bb2
+			db	4ah,40h,f9h,12h,14h,95h,19h,eah
+			db	04h,b3h,ach,1fh,49h,69h,0ah
+			ld	(hl),37h
+			dec	hl
+			ld	(hl),99h
+			rst	30h
+			ret	pe
+			jr	c,L6b57
+			xor	e
+			rr	l
+			ld	b,d
+			sub	e
+			ld	a,b
+			inc	de
+			ld	h,h
+			jr	L6ba4
+			db	15h,69h,f6h,67h,53h,79h,78h,7dh
+			db	c2h,93h,a9h,6dh,45h,ceh,2fh,38h
+			db	a7h,6dh,6ah,e0h,28h,9bh,b5h,53h
+			db	10h,3bh,cfh,12h,bah,bah,11h,81h
+			db	bbh,e6h,8eh,b7h,0dh,e5h,a2h,42h
+			db	57h,c9h,cch,d5h,22h,afh,afh,73h
+			db	68h,7eh,73h,5ah,54h,3bh,68h,06h
+			db	92h,e5h,3ch,d7h,aeh,23h,69h
+			ld	b,c
+			add	a,l
+			inc	c
+			rst	20h
+			add	hl,bc
+			rst	38h
+			call	c,La356
+			call	m,L8865
+			or	(hl)
+			ld	c,46h
+			and	h
+			and	h
+			ld	h,a
+			nop (2x) *
+			sbc	a,d
+			or	l
+			or	l
+			xor	(hl)
+			ld	b,a
+			ld	(de),a
+			ld	c,c
+			ld	(bc),a
+			adc	a,l
+			inc	d
+			ret	z
+			and	c
+			jr	c,L6bf2
+			ld	d,b
+			adc	a,cch
+			ld	c,a
+			add	a,a
+			xor	(hl)
+			ld	d,02h
+			jr	c,L6baa
+			jr	nz,L6c06
+			ret
+			db	7eh,c0h,27h,1dh,e3h,78h,d7h,03h
+			db	b1h,dfh,93h,f8h,6bh,65h,b2h,1ch
+			db	20h,1fh,42h,d4h,9bh,59h,feh,1fh
+			db	fch,feh
+			ld	b,a
+			jr	c,L6c13
+			sub	d
+			ld	c,a
+			and	l
+			sub	8eh
+			inc	b
+			ld	h,l
+			push	af
+			ld	a,l
+			ld	(hl),h
+			rst	00h
+			xor	c
+			nop (2x) *
+			ld	d,b
+			cp	c
+			inc	sp
+			adc	a,b
+			dec	a
+			add	a,67h
+			ex	de,hl
+			bit	4,b
+			dec	(hl)
+			ld	d,38h
+			ld	h,a
+			or	a
+			ld	e,08h
+			ld	c,d
+			inc	e
+			ld	(1399h),a
+			jp	nz,L4993
+			jp	m,L33b9
+			rst	38h
+			ld	b,h
+			ex	de,hl
+			jp	z,L9e45
+			ld	l,(hl)
+			rst	28h
+			rrca
+			ld	b,h
+			ld	l,c
+			out	(b1h),a
+			ld	d,7ch
+			ld	l,8bh
+			pop	bc
+			xor	h
+			ld	a,(de)
+			ld	d,(hl)
+			ld	b,a
+			ld	(hl),l
+			sbc	a,(hl)
+			or	e
+			sub	d
+			and	b
+			ld	(bc),a
+			add	hl,hl
+			ld	e,29h
+			and	a
+			ld	a,l
+			dec	bc
+			sub	a
+			and	h
+			dec	l
+			ex	(sp),hl
+			jp	po,L8bfa
+			adc	a,c8h
+			inc	d
+			or	h
+			rst	00h
+			inc	d
+			xor	b
+			inc	b
+			ld	h,b
+			in	a,(a7h)
+			ld	(hl),4bh
+			inc	(hl)
+			inc	hl
+			inc	d
+			ld	e,l
+			ld	(hl),a
+			dec	c
+			jr	nz,L6c4d
+			rst	20h
+			ret
+			db	ebh,5bh,85h,b5h,4dh,83h,14h,4ah
+			db	24h,6fh,e8h,9eh,ddh,edh,1ah,0eh
+			db	35h,46h,fch,3bh,b5h,21h,0eh,6ch
+			db	55h,08h,5dh,feh,d7h,f7h,25h,0bh
+			db	53h,6dh,a5h,e2h,1dh
+			ld	b,d
+			inc	d
+			ex	(sp),hl
+			ld	(bc),a
+			call	po,L3ad9
+			jp	(hl)
+			db	cch,5eh,b3h,0fh,f6h,eah,dch,76h
+			db	55h,bch,23h,a5h,07h,a9h,8ch,c7h
+			db	5eh,76h,3ah
+			ld	l,d
+			ld	sp,77fah
+			rst	10h
+			dec	sp
+			cp	a
+			add	a,b
+			sub	d
+			rst	38h
+			rla
+			xor	d
+			ld	d,l
+			ld	e,e
+			ld	h,l
+			adc	a,b3h
+			sbc	a,l
+			inc	de
+			cp	(hl)
+			call	L0a14
+			xor	c
+			ld	e,e
+			jp	c,La5f7
+			call	nz,Lc716
+			dec	de
+			sub	d
+			scf
+			ld	(hl),a
+			adc	a,b
+			call	pe,Labd6
+			and	c
+			ld	bc,6dd5h
+			ld	hl,f160h
+			sbc	a,f9h
+			cpl
+			ld	(hl),a
+			ld	d,h
+			ret	nz
+			pop	bc
+			ld	e,(hl)
+			halt
+			ret	nz
+			inc	de
+			in	a,(8fh)
+			rst	20h
+			call	m,L70ba
+			dec	de
+			ret	nz
+			adc	a,h
+			jp	p,L4fc4
+			xor	e
+			or	a
+			ld	a,c6h
+			add	a,l
+			nop (2x) *
+			sbc	a,d
+			ld	(hl),l
+			dec	e
+			inc	h
+			pop	hl
+			inc	c
+			ld	d,l
+			ld	h,h
+			ld	(hl),b
+			and	0ah
+			xor	(hl)
+			pop	af
+			ld	d,l
+			rst	20h
+			ex	de,hl
+			jp	c,L39aa
+			ld	a,e
+			ld	a,e
+			ld	a,(bc)
+			add	hl,bc
+			inc	a
+			rlca
+			ei
+			adc	a,b
+			call	po,Le4cb
+			rst	20h
+			adc	a,e
+			out	(c3h),a
+			rst	20h
+			ld	d,h
+			xor	(hl)
+			ld	b,a
+			cp	b
+			jp	(hl)
+			db	3eh,05h,cfh,15h,c8h,15h,87h,1bh
+			db	ceh,a0h,13h,ffh,bdh,7eh,69h,09h
+			db	c3h,64h,26h,e7h,a9h,80h,19h,e2h
+			db	22h,2ch,a2h,78h,cdh,5dh,c3h,f7h
+			db	a7h,56h,7fh,4dh,69h,5eh,8ah,c0h
+			db	2bh,bch,e7h,39h
+			and	(hl)
+			jp	po,L6e86
+			ei
+			ret	p
+			add	a,a
+			adc	a,d
+			ld	(hl),b
+			ld	a,e
+			adc	a,l
+			adc	a,b
+			dec	e
+			ld	c,l
+			ld	h,c
+			push	bc
+			adc	a,d
+			add	a,l
+			pop	hl
+			ld	b,h
+			ld	e,c
+			and	a
+			pop	hl
+			jp	nc,Lb0f2
+			ret	m
+			call	pe,Lda94
+			ld	e,c
+			ld	c,c
+			ld	hl,(4490h)
+			daa
+			rst	38h
+			call	c,Lcd73
+			ld	e,e
+			or	e
+			cp	c
+			dec	c
+			add	a,02h
+			ex	(sp),hl
+			ret	po
+			sbc	a,(hl)
+			ld	(hl),c
+			ret	nc
+			dec	de
+			add	a,a
+			ld	(hl),d
+			add	hl,de
+			ld	(hl),b
+			inc	b
+			ld	a,a
+			ld	d,c
+			ld	a,(2906h)
+			nop
+			ld	c,d
+			adc	a,l
+			or	(hl)
+			ld	h,53h
+			adc	a,(hl)
+			jr	L6d94
+			db	8bh,9ah,1bh,1dh,7dh,cbh,80h,69h
+			db	66h,7eh,a2h,00h,0eh,a5h,54h,c4h
+			db	dfh,d2h,38h,c5h,53h,a9h
+			ld	b,h
+			sbc	a,l
+			ret	nc
+			sub	h
+			sub	a
+			sbc	a,c
+			sbc	a,a3h
+			ld	(hl),9bh
+			rst	30h
+			ld	l,l
+			ld	l,a
+			call	z,L51fe
+			ld	b,(hl)
+			adc	a,e
+			add	hl,sp
+			ld	l,ach
+			add	hl,sp
+			jp	p,Ld4e2
+			jp	m,L7125
+			ld	l,l
+			ret	c
+			ld	c,b
+			ld	a,b
+			call	pe,Lb27c
+			rst	30h
+			or	c
+			dec	d
+			nop (2x) *
+			or	c
+			inc	h
+			sbc	a,31h
+			sub	h
+			or	h
+			call	c,L78c5
+			ld	b,c
+			ld	c,d
+			jr	nz,L6ddd
+			ld	c,d
+			push	af
+			rlca
+			ld	b,h
+			xor	b
+			ld	hl,17e0h
+			cp	l
+			inc	bc
+			inc	hl
+			jp	pe,L3ed3
+			ld	b,a
+			ld	sp,08a7h
+			dec	h
+			jr	nc,L6d69
+			ex	de,hl
+			ld	h,d
+			call	m,L2f19
+			sub	a
+			jp	nz,L2469
+			ret	z
+			ld	l,e
+			ld	d,d
+			scf
+			pop	hl
+			add	a,d
+			ld	(hl),5eh
+			or	h
+			out	(25h),a
+			inc	hl
+			sub	e
+			dec	de
+			nop (2x) *
+			ret	p
+			ld	b,h
+			ld	h,(hl)
+			xor	a
+			ld	b,(hl)
+			dec	b
+			push	hl
+			ld	h,e
+			inc	l
+			and	deh
+			dec	(hl)
+			ret
+			db	a3h,56h,09h,1fh
+			cp	c
+			adc	a,ebh
+			ld	l,d
+			rst	38h
+			sub	c
+			dec	e
+			rst	38h
+			xor	e
+			ld	e,d
+			sbc	a,h
+			and	(hl)
+			ld	(hl),e
+			ld	h,(hl)
+			ret	pe
+			ld	(a168h),a
+			rst	00h
+			sub	l
+			jp	pe,L069e
+			ld	b,a
+			sbc	a,e
+			ret	po
+			jp	nc,La9c0
+			ld	b,h
+			ld	e,b
+			and	a
+			sbc	a,b
+			ld	b,h
+			ld	d,deh
+			add	hl,sp
+			xor	a
+			inc	l
+			sub	d
+			rst	30h
+			sbc	a,b
+			and	l
+			jp	p,L35f6
+			and	h
+			ld	a,l
+			inc	h
+			sub	b
+			ld	c,h
+			ld	sp,cbd6h
+			ld	a,(de)
+			ld	(hl),a
+			xor	(hl)
+			ld	b,c
+			ld	l,a
+			ld	l,e
+			sub	l
+			adc	a,l
+			add	a,a
+			or	a
+			jp	(hl)
+			db	c2h,44h,f4h
+			ex	(sp),hl
+			xor	e
+			ld	l,e3h
+			nop (2x) *
+			ld	l,d
+			ret	c
+			ld	a,(903ch)
+			ld	h,e
+			ld	a,h
+			ld	b,d
+			rst	38h
+			add	hl,sp
+			ld	c,1bh
+			add	a,l
+			ld	c,c
+			inc	d
+			or	l
+			sbc	a,31h
+			halt
+			and	c
+			sub	d
+			ld	c,l
+			xor	h
+			and	d
+			ccf
+			ld	b,d
+			ld	h,d
+			adc	a,b
+			ld	c,31h
+			ld	(hl),a
+			dec	a
+			ld	c,l
+			sbc	a,d
+			call	nc,L796f
+			or	b
+			ld	hl,(481fh)
+			ret
+			db	06h,c1h,ffh,3ch,e2h,f5h,b1h,62h
+			db	02h,fch,65h
+			push	bc
+			add	a,h
+			ld	(de),a
+			cp	d
+			dec	d
+			rra
+			cpl
+			call	nc,Leeaf
+			sbc	a,b
+			ld	h,b
+			ld	b,a
+			pop	bc
+			sbc	a,d
+			inc	b
+			dec	c
+			ld	h,d
+			ld	h,e
+			ld	a,(a2ffh)
+			ex	de,hl
+			dec	b
+			ld	a,efh
+			dec	(hl)
+			ld	h,(hl)
+			add	hl,bc
+			pop	bc
+			or	l
+			ld	de,5c62h
+			add	hl,sp
+			rla
+			rla
+			ld	c,e
+			add	hl,bc
+			xor	(hl)
+			or	h
+			inc	l
+			xor	e
+			inc	hl
+			dec	l
+			ld	a,d
+			cp	l
+			ld	l,c
+			ld	d,b
+			and	h
+			inc	de
+			ld	a,l
+			di
+			sub	e
+			ld	c,h
+			ld	hl,92edh
+			ld	e,(hl)
+			in	a,(28h)
+			ld	b,a
+			nop (2x) *
+			inc	a
+			ld	l,e
+			xor	(hl)
+			ei
+			add	a,98h
+			djnz	L6ef6
+			halt
+			xor	d
+			dec	c
+			ld	l,e
+			ld	d,d
+			dec	hl
+			ld	a,d
+			ld	a,c
+			adc	a,(hl)
+			push	de
+			ld	c,a
+			ld	a,(de)
+			exx
+			sub	b
+			dec	d
+			call	nz,Lc41b
+			ld	de,5400h
+			ld	d,l
+			xor	e
+			ld	b,a
+			ld	a,d
+			scf
+			ld	l,l
+			jp	po,L9014
+			ld	a,6ch
+			ld	(hl),d
+			jp	z,Lc71f
+			adc	a,c
+			rst	38h
+			ld	a,(e593h)
+			rla
+			jr	c,L6ea0
+			and	c
+			call	z,Lf0bb
+			set	1,b
+			jp	L6fd7
+			db	5fh,8fh,6dh,4dh,dah,68h,f2h,9bh
+			db	ach,1dh,38h,28h,05h,f4h,98h,54h
+			db	3fh,adh,91h,74h,9ah,3eh,a3h,61h
+			db	f2h,36h,5dh,e5h,02h,1bh,a3h,26h
+			db	b9h,0ch,19h,cah,13h,c3h,afh,4ch
+			db	b2h,80h,86h,9fh,5bh,cfh
+			ld	h,a
+			ld	(hl),c
+			ld	e,h
+			sbc	a,e
+			ld	l,d
+			ld	b,a
+			inc	e
+			cp	1bh
+			or	d
+			xor	c
+			call	Lda4a
+			jp	c,Ld6c8
+			ld	b,h
+			add	a,e
+			halt
+			rst	08h
+			ld	(1c93h),a
+			cp	d
+			ld	b,h
+			di
+			jp	nc,Le4be
+			pop	de
+			ld	(bc),a
+			cp	e
+			sub	d
+			ld	a,(hl)
+			add	hl,hl
+			ld	hl,4b0bh
+			jr	L6f80
+			db	7eh,09h,d7h,e2h,6bh,46h,a5h,ech
+			db	9ah,59h,59h,75h,8ah,39h,e3h,3bh
+			db	8dh,0eh,69h,f4h,1fh,36h,8bh,5eh
+			db	4bh,7ch,3ah,bah,54h,d9h,dbh,11h
+			db	ddh,9eh,0ch,0eh,0ah,47h
+			sbc	a,l
+			adc	a,(hl)
+			inc	b
+			ret	z
+			and	d
+			add	hl,bc
+			ld	c,d
+			rra
+			ld	b,h
+			ld	sp,a881h
+			ld	c,a
+			ld	e,e
+			adc	a,l
+			sbc	a,c
+			add	hl,bc
+			or	d
+			ld	l,e
+			call	z,L73a9
+			ld	e,c
+			pop	bc
+			or	e
+			ld	a,03h
+			adc	a,(hl)
+			ld	a,(bc)
+			inc	(hl)
+			or	h
+			xor	c
+			pop	af
+			ld	e,h
+			ld	e,l
+			ret	i *
+			sub	e
+			pop	bc
+			inc	b
+			dec	d
+			rst	28h
+			pop	af
+			add	hl,bc
+			nop (2x) *
+			in	a,(00h)
+			rst	38h
+			ld	(hl),h
+			call	z,L5bfc
+			ret	nc
+			rst	00h
+			ld	d,b
+			or	d
+			push	af
+			im	0
+			add	hl,de
+			or	6ah
+			xor	b
+			ld	a,e
+			ret	m
+			sub	e
+			ld	b,h
+			ld	l,(hl)
+			sub	(hl)
+			ld	c,e
+			pop	de
+			ld	b,c
+			dec	sp
+			sub	b
+			dec	d
+			and	d5h
+			rrca
+			xor	l
+			ret
+			call	p,L1886
+			and	d1h
+			halt
+			rst	38h
+			ld	e,b
+			ld	h,(hl)
+			sbc	a,e
+			rst	18h
+			rst	08h
+			cp	fbh
+			ld	a,d
+			ld	h,(hl)
+			ld	sp,0d1fh
+			pop	bc
+			ld	a,d
+			or	d
+			ld	d,b
+			sub	e
+			rl	a
+			sbc	a,c
+			ld	e,h
+			cp	h
+			dec	a
+			jp	nz,L7d09
+			ret
+			db	53h,43h,6fh,7eh,8bh,44h,6ch,7ch
+			db	9fh,e9h,c6h,09h,1ah,bah,43h,ach
+			db	30h,4bh,7eh,d5h,5bh,c7h,f4h,f5h
+			db	38h,9eh,c9h,35h,40h,32h,1fh,88h
+			db	89h,afh,f0h,b8h,14h,86h,6bh,33h
+			db	23h,74h,b4h,a1h,38h,a4h,0ah,66h
+			db	2ah,58h,18h,42h,8fh,01h,91h,99h
+			db	bdh,45h,a0h,c3h
+			xor	(hl)
+			ld	d,b
+			adc	a,e
+			add	hl,sp
+			jp	nc,L0d33
+			ld	l,c
+			call	pe,Le1ef
+			ld	(hl),e
+			ld	l,(hl)
+			or	d
+			or	(hl)
+			ld	a,9eh
+			ld	d,c
+			ld	e,l
+			rst	20h
+			ld	c,h
+			ld	h,e
+			sub	l
+			ld	a,(de)
+			inc	e
+			ret	nz
+			ld	h,l
+			add	a,b
+			add	a,c
+			and	l
+			dec	hl
+			sub	d
+			sub	a
+			rlca
+			sbc	a,l
+			cp	a
+			call	La048
+			ld	c,b
+			call	c,Lcdb9
+			call	nz,Ld3be
+			dec	(hl)
+			and	l
+			jr	L702e
+			db	79h,42h,a5h,14h,d7h,40h,56h,afh
+			db	37h,b6h,8bh
+			ld	c,efh
+			inc	b
+			ld	(hl),c2h
+			inc	de
+			ld	c,a
+			ld	a,h
+			adc	a,d
+			ret	po
+			rst	20h
+			ld	l,e
+			ld	c,l
+			sub	e
+			or	c
+			ld	e,c
+			adc	a,h
+			dec	sp
+			ld	l,h
+			ld	(hl),b
+			inc	c
+			halt
+			ex	af,af'
+			ret	z
+			ld	c,f2h
+			ld	l,c5h
+			call	p,L360d
+			or	c
+			xor	d
+			rlca
+			dec	d
+			ei
+			rrca
+			scf
+			ld	c,b
+			ld	hl,d388h
+			ret
+			db	45h,fbh,bch,99h,6bh,eah,87h,00h
+			db	edh,37h,6fh,f2h,9bh,86h,56h,03h
+			db	23h,65h,c3h,6ch,16h
+			sbc	a,b
+			ld	(bc),a
+			sbc	a,b
+			ld	d,b
+			ex	af,af'
+			inc	e
+			inc	sp
+			dec	b
+			or	d
+			ld	h,b
+			call	Ld06f
+			rst	30h
+			jr	z,L7071
+			and	b
+			call	z,L8fe7
+			ccf
+			pop	af
+			push	bc
+			ret
+			db	63h,a4h,96h,67h
+			ld	e,h
+			ld	d,(hl)
+			ld	e,h
+			ld	(hl),88h
+			ld	h,a
+			jr	L70eb
+			db	c8h,3bh,40h,39h,4dh,f7h,24h,e0h
+			dec	d
+			add	a,e
+			ret	p
+			ld	(hl),c
+			ld	c,h
+			halt
+			sbc	a,d
+			bit	0,h
+			xor	2eh
+			call	nc,L280e
+			ld	d,h
+			add	hl,bc
+			push	de
+			or	b4h
+			push	hl
+			scf
+			ex	af,af'
+			or	l
+			ld	b,f0h
+			add	a,l
+			and	c
+			ld	a,d
+			ld	l,d
+			jp	nc,Leb0e
+			adc	a,h
+			daa
+			xor	d
+			xor	(hl)
+			dec	c
+			jr	c,L710a
+			ld	h,e
+			ei
+			and	d
+			add	a,(hl)
+			jr	c,L70d7
+			ld	(bc),a
+			inc	a
+			ld	e,(hl)
+			ld	h,l
+			call	m,L7215
+			out	(a7h),a
+			call	po,L3502
+			ld	hl,(f7c4h)
+			call	c,L8281
+			ld	e,e
+			ld	c,l
+			inc	e
+			sbc	a,e
+			sub	b6h
+			add	hl,bc
+			dec	sp
+			ld	a,d
+			ld	(hl),h
+			ld	l,c
+			jp	(hl)
+			db	c1h,0fh,22h
+			jr	nz,L712c
+			or	a
+			jr	L712e
+			db	f5h,c3h
+			and	e
+			add	a,e
+			inc	(hl)
+			ret	p
+			inc	h
+			ex	(sp),hl
+			ld	l,d
+			ld	d,3eh
+			ld	l,a
+			ld	(bc),a
+			and	b
+			ld	(hl),h
+			rst	10h
+			call	p,L4a63
+			rst	18h
+			or	b
+			ld	hl,(9273h)
+			ld	e,a
+			call	p,L1dc7
+			cp	e
+			rra
+			sub	e
+			ld	e,l
+			ld	e,l
+			sub	l
+			jr	nz,L7101
+			sub	a
+			or	d
+			sub	a
+			jp	nc,L6dee
+			ld	h,h
+			ld	b,c
+			call	p,Lf62c
+			cp	d
+			add	hl,hl
+			or	d
+			scf
+			dec	hl
+			ld	b,d
+			ld	a,(de)
+			ld	hl,e96bh
+			ld	l,e
+			ccf
+			ld	h,d
+			inc	(hl)
+			ld	b,c
+			jp	L6d62
+			db	26h,3ah,0fh,61h,5eh,26h,4ah,b9h
+			db	bdh,a8h,25h,11h,24h,a2h,beh,1ah
+			db	45h,10h,7eh,ebh,8bh,8ah,9ch,1ah
+			db	a7h,a5h,44h,cch,d2h,8bh,ddh,66h
+			db	29h,64h,81h,18h,43h,d8h,adh,9ch
+			db	3ch,39h,c4h,28h,f3h,dfh,efh,70h
+			db	8bh,edh,a7h,74h,4eh,ebh,b8h,8fh
+			db	0dh,abh,43h,59h,4eh,aeh,edh,bfh
+			db	05h,55h,e6h,c1h,44h,5fh,55h,77h
+			db	a7h,b2h,0bh,59h,00h,58h,1ah,a3h
+			db	99h,a8h,01h,f3h,0bh,6ch,20h,05h
+			db	99h,8fh,96h,6eh,57h,7ch,d8h,e8h
+			db	80h,beh,66h,09h,aeh,4dh,46h,b6h
+			db	f9h,12h,edh,60h,6ah,83h,f2h,a5h
+			db	98h,47h,cah,7ah,2ch,26h,e6h,d0h
+			db	cfh,fdh,7ch,26h,6dh,75h,b1h,a6h
+			db	37h,5ch,3fh,e1h,d8h,6ah
+			and	h
+			inc	d
+			ld	l,l
+			rst	10h
+			ret	nz
+			xor	e
+			ld	c,b
+			jr	nz,L7235
+			sla	h
+			ld	c,62h
+			push	bc
+			dec	de
+			rla
+			inc	e
+			nop
+			ld	sp,cf0fh
+			ld	de,714bh
+			sub	c
+			ld	d,c7h
+			ld	hl,(c9f4h)
+			and	h
+			ld	l,20h
+			rst	00h
+			or	h
+			call	m,L1960
+			sbc	a,e
+			dec	b
+			ex	af,af'
+			cp	c
+			add	a,a
+			ex	de,hl
+			xor	h
+			call	nc,L3584
+			or	53h
+			dec	sp
+			ret
+			db	7bh,3eh,d3h,76h,beh,5eh,89h,0dh
+			db	5ch,0dh,3dh,8eh,ceh,76h,32h,9ah
+			ret	m
+			xor	d
+			nop
+			and	3eh
+			ld	l,l
+			ret	c
+			ld	(hl),c
+			ld	a,a
+			rst	28h
+			dec	c
+			sub	d
+			ld	h,a
+			ld	d,b
+			ld	l,d
+			ret
+			db	dch,9bh,33h,87h,34h,32h,b1h,bbh
+			db	a4h,5ah,10h,4ah,03h,98h,ech,edh
+			db	21h,4fh,95h,15h,a9h,bfh,0ch,2bh
+			db	e3h,25h,1bh,52h,0ch,12h,12h,bah
+			db	1ah,d9h,b2h,1ah,b2h,9ch,56h,bdh
+			db	87h,0ch,83h,b9h,a4h,ach,4ch,9ah
+			db	a4h,65h,24h,9bh,19h,6fh,d3h,a8h
+			db	e2h,56h,fch,c9h,63h,3fh,17h,f9h
+			db	07h,72h,97h,fbh,6bh,55h,f9h,41h
+			db	ceh,deh,d6h,1bh,ffh,7ah,a3h,56h
+			db	39h,33h,b7h,15h,3eh,92h,ech,6ch
+			db	82h,91h,fdh,c4h,5fh,9ah,6eh,23h
+			db	b8h,e7h,eeh,ach,cch,28h,54h,beh
+			db	c7h,92h,e1h,6fh,c4h,5fh,c4h,64h
+			db	f6h,5ah,abh,aah,c6h,82h,91h,35h
+			db	e9h,ach,58h,54h,8ah,59h,6eh,ebh
+			db	e5h,95h,b0h,1eh,b9h,feh,89h,7dh
+			db	a9h,47h,00h,bbh,b3h,21h,d9h,88h
+			db	3fh,5bh,31h,d5h,58h,20h,07h,4ch
+			db	c4h,0dh,dch,d7h,86h,4eh,09h,05h
+			db	83h,89h,fah,bah
+			ld	d,a
+			sub	a
+			call	pe,L3a42
+			dec	(hl)
+			cp	d
+			xor	c
+			ld	h,e
+			inc	de
+			and	a
+			call	nc,Lb869
+			xor	h
+			push	de
+			nop (2x) *
+			sbc	a,a
+			xor	a
+			rrca
+			call	p,L604c
+			call	z,L4f86
+			call	nz,L8dc9
+			jp	po,Lf981
+			scf
+			ld	d,e
+			ret
+			db	e8h,14h,b6h,6dh,37h,70h,d3h,1bh
+			db	b9h,c9h,3fh,c6h,d4h,ddh,8bh,78h
+			db	58h,d7h,88h,c4h
+			or	d
+			ld	(0ac1h),hl
+			jr	z,L72e9
+			adc	a,e
+			ld	b,h
+			ld	l,b
+			ld	sp,c858h
+			adc	a,(hl)
+			or	e
+			or	h
+			adc	a,(hl)
+			sub	d
+			sbc	a,d
+			di
+			ld	(hl),a
+			ld	b,d
+			rst	20h
+			cp	l
+			ld	h,(hl)
+			ld	c,a
+			jp	nc,L8af7
+			sbc	a,h
+			inc	d
+			ld	l,e
+			ld	l,e
+			ld	h,a
+			jp	po,L4292
+			rst	18h
+			ld	c,l
+			jp	c,L5eca
+			add	hl,sp
+			ld	e,6ch
+			exx
+			pop	af
+			ld	e,b
+			rst	00h
+			or	c
+			cp	h
+			ld	c,c
+			ex	de,hl
+			ld	(hl),e
+			dec	a
+			and	h
+			ld	d,b
+			ld	(2833h),hl
+			adc	a,c
+			inc	e
+			and	(hl)
+			ld	d,b
+			scf
+			ld	c,b
+			dec	e
+			ld	b,l
+			dec	bc
+			ld	b,d
+			cp	a
+			ld	l,h
+			ld	(hl),14h
+			rla
+			inc	hl
+			call	z,L32d6
+			call	nc,L1baf
+			daa
+			and	h
+			dec	d
+			ld	d,d
+			ld	c,d
+			xor	e
+			jp	(hl)
+			db	32h,9bh,9bh,36h,fbh,a7h,71h,b4h
+			db	62h,e9h,76h,bdh,4bh,f9h,84h,a2h
+			db	edh,20h,d0h,e9h,a9h,e7h,20h,2fh
+			db	a0h,f1h,beh,50h,d9h,20h,9eh,2fh
+			db	bah,38h,61h,5ah,38h,41h,4ah,b4h
+			db	3ah,a9h,4eh,35h,c6h,d7h,c0h,92h
+			db	39h
+			ld	a,(bc)
+			ld	l,d
+			or	b
+			cp	b
+			ld	e,h
+			ld	h,l
+			ld	d,e
+			ld	b,b
+			dec	sp
+			or	c
+			ld	h,cbh
+			ld	d,h
+			ld	(hl),h
+			sub	d4h
+			inc	h
+			jp	c,Lcb11
+			inc	a
+			ld	h,d
+			ld	a,(hl)
+			xor	b
+			jr	nz,L73e8
+			dec	(hl)
+			add	hl,sp
+			ld	d,(hl)
+			ret
+			db	47h,2eh,c6h,6ah,1ah,76h,5bh,07h
+			db	a4h,f8h,96h,77h,90h,83h,a5h,48h
+			db	04h,a3h,8bh,40h,01h,b9h,15h,0ah
+			db	cch,37h,07h,06h,cfh,eah,56h,53h
+			db	20h
+			sbc	a,d
+			ld	(hl),h
+			add	a,b
+			call	c,L9f22
+			ld	c,a
+			ret	m
+			ret
+			db	89h,87h,09h,5bh,40h,6ch,9eh,38h
+			db	f4h,9fh,1fh,24h,cfh,edh,a3h,ach
+			db	46h,69h,c2h,b2h,e1h,dah,58h,93h
+			db	d8h,08h,21h,c2h,7eh,c0h,1bh,e4h
+			db	08h,06h,26h,87h,49h,97h,15h,73h
+			db	20h,71h,beh,0bh,43h,87h,5bh,2eh
+			db	34h,5bh,6bh,adh,bdh,e6h,b6h,e6h
+			db	91h,5ah,bbh,87h,bah,dch,cfh,7dh
+			db	d5h,8dh,c4h,8dh,ceh,11h,a5h,52h
+			db	70h,33h,47h,a8h,aah,9eh,7eh,97h
+			db	6ch,8eh,d0h,e4h,82h,07h,7ah,12h
+			db	53h,3fh,d8h,ech,5ah,fch,a2h
+			rlca
+			ld	c,76h
+			ld	h,c
+			ld	a,d
+			ld	a,(bc)
+			ld	b,(ix + 89h)
+			cp	e
+			ld	d,l
+			sbc	a,a
+			inc	bc
+			call	po,L90e9
+			dec	(hl)
+			ld	a,(de)
+			sub	(hl)
+			ld	b,a
+			adc	a,h
+			inc	h
+			sbc	a,(hl)
+			ret	po
+			dec	d
+			sbc	a,e
+			ld	a,e
+			out	(64h),a
+			ret	z
+			ld	sp,6114h
+			or	e
+			cp	l
+			ld	a,8fh
+			ld	b,c
+			cp	e
+			add	a,a
+			halt
+			add	hl,sp
+			inc	sp
+			ld	b,c
+			sbc	a,c
+			ld	d,d
+			ei
+			jp	p,L3b72
+			inc	hl
+			ld	a,l
+			rrca
+			ret	nc
+			ret	pe
+			cpl
+			rlca
+			ld	(hl),h
+			ld	c,(hl)
+			cp	9fh
+			ld	a,l
+			inc	de
+			or	c
+			ld	l,(hl)
+			rra
+			jp	(hl)
+			db	e0h,6ch,92h,71h,46h,20h,44h,73h
+			db	e2h,83h,94h,f0h,9ch,32h,89h,41h
+			db	22h,a9h,77h,ddh,57h,dah,1fh,f1h
+			db	e9h,edh,e2h,6ch,e9h,f1h,20h,d5h
+			db	fdh,beh,b6h,ech,b7h,5dh,deh,d9h
+			db	7bh,79h,bdh,9dh,d0h,d6h,5ch,a0h
+			db	feh,3dh,02h,edh,deh,f3h,cah,b1h
+			db	6eh,6eh,36h,a1h,adh,c6h,3bh,56h
+			db	76h,82h,96h,2dh,46h,33h
+			add	hl,sp
+			adc	a,a
+			pop	af
+			call	p,Lab74
+			ld	c,d
+			inc	l
+			ld	c,3ch
+			xor	d
+			dec	d
+			sub	b
+			and	h
+			dec	c
+			xor	l
+			add	hl,bc
+			xor	d
+			sub	(hl)
+			sub	c
+			sbc	a,h
+			cp	e
+			push	de
+			ld	d,e
+			inc	sp
+			adc	a,e
+			ld	b,a
+			nop (2x) *
+			jr	c,L74d9
+			ld	c,ech
+			dec	sp
+			ld	(hl),c
+			ld	(hl),e
+			pop	af
+			pop	bc
+			in	a,(ebh)
+			scf
+			ld	a,a
+			sub	d
+			out	(75h),a
+			jp	p,L5421
+			xor	e
+			jp	Le1d0
+			db	b2h,c6h,9fh,e5h,63h,9ch,5eh,4ch
+			db	84h,2ch,54h,69h,fdh,b8h,83h,40h
+			db	edh,aah,50h,37h,ddh,53h,3dh,cch
+			db	02h,01h,74h,0ah,8bh,ebh,5fh,78h
+			db	0dh,57h,05h,c6h,83h,ach,58h,e6h
+			db	57h,38h,21h,50h,78h,f1h,c8h,aah
+			db	9ah,3ch,e9h,25h,17h,58h,09h,bbh
+			ld	a,l
+			ld	a,e
+			adc	a,95h
+			ret	m
+			sbc	a,c
+			ccf
+			ld	b,l
+			ld	e,h
+			ld	c,c
+			rst	38h
+			adc	a,d
+			sbc	a,(hl)
+			rst	08h
+			ld	l,b
+			adc	a,a
+			inc	a
+			ld	(hl),h
+			ld	l,a
+			rst	38h
+			ld	d,b
+			ret	nc
+			jr	nc,L74e3
+			ld	h,h
+			xor	e
+			ret	z
+			ld	(hl),b
+			inc	d
+			call	L9a44
+			ld	l,b
+			dec	l
+			xor	l
+			or	(hl)
+			ret	po
+			halt
+			ld	e,c
+			call	m,L096b
+			ld	h,b
+			rst	28h
+			di
+			sbc	a,l
+			adc	a,(hl)
+			push	bc
+			dec	de
+			call	nz,L00a1
+			jr	z,L75a2
+			cp	a
+			call	L9eb7
+			sub	d
+			cp	a
+			cp	68h
+			dec	b
+			ld	sp,hl
+			ld	h,7eh
+			ld	c,c
+			dec	e
+			or	73h
+			sub	b
+			ld	b,h
+			ld	l,h
+			rst	20h
+			sub	a
+			add	hl,de
+			rra
+			ld	a,(bc)
+			adc	a,a
+			and	b
+			or	b
+			ld	e,c
+			call	po,Ld231
+			rrca
+			ld	l,(hl)
+			adc	a,(hl)
+			add	a,(hl)
+			cp	e
+			rrca
+			pop	bc
+			and	e
+			ld	c,d
+			ret	p
+			ret	z
+			call	nz,Lbbb9
+			call	po,Le0ec
+			and	b
+			ld	h,e
+			cp	l
+			inc	b
+			sbc	a,a
+			inc	sp
+			pop	de
+			ld	(hl),a
+			ld	e,c
+			adc	a,b
+			add	a,d
+			xor	94h
+			add	a,d
+			ret	po
+			ld	c,(hl)
+			add	hl,bc
+			or	h
+			ld	h,e
+			and	l
+			ret	nz
+			ld	e,b
+			cp	h
+			jp	(hl)
+			db	eah,56h,5dh,d4h,2bh,bbh,76h,60h
+			db	87h,41h,75h,c8h,8fh,4eh,c9h,8dh
+			db	d5h,a7h,c0h,04h,84h,07h,ddh,30h
+			db	4dh,61h,14h,cbh,cbh,74h,4bh,b5h
+			db	22h,ech,38h,c5h,4bh,07h,38h,60h
+			db	92h,e0h,e7h,a9h,8dh,c6h,d3h,1ah
+			db	68h,38h,64h,74h,01h,f9h,24h,0ch
+			db	6bh,d1h,5ah,f7h,00h,e1h,36h,61h
+			db	93h,78h,7ch,66h,26h,deh,fah,e8h
+			db	45h,92h,e9h,fbh,bdh,67h,b5h,b3h
+			call	p,La5d5
+			ld	e,e
+			ld	b,c
+			rla
+			ld	c,h
+			and	c
+			add	hl,de
+			ld	(de),a
+			ld	b,11h
+			jp	p,L9651
+			ret	po
+			cp	c
+			ld	c,a
+			ret	po
+			ld	d,59h
+			adc	a,c
+			call	c,L3558
+			ld	a,a
+			jp	c,L8adb
+			push	de
+			dec	c
+			cp	l
+			sub	c
+			scf
+			ccf
+			halt
+			add	hl,bc
+			jp	po,Lecf6
+			ld	h,a
+			jp	pe,L2e5e
+			ld	a,a
+			ld	b,31h
+			inc	de
+			ret	pe
+			di
+			rst	38h
+			call	po,L8479
+			cp	h
+			xor	b
+			call	c,L7774
+			ld	c,h
+			cp	b
+			ld	a,d
+			ld	b,e
+			adc	a,c
+			jr	nz,L7653
+			inc	sp
+			ld	de,3946h
+			add	a,a
+			ld	b,l
+			adc	a,e
+			in	a,(f9h)
+			ld	h,(hl)
+			dec	d
+			dec	e
+			cpl
+			sub	d7h
+			exx
+			and	l
+			sub	c
+			jp	L88f4
+			db	88h,efh,94h,2ah,ach,cfh,c7h,33h
+			db	f0h,50h,13h,32h,e7h,f9h,50h,48h
+			db	72h,cfh,4eh,22h,85h,b4h,5fh
+			inc	h
+			rr	(hl)
+			call	po,L91cb
+			xor	aeh
+			dec	l
+			inc	hl
+			xor	l
+			add	hl,sp
+			sub	a
+			and	d
+			ld	(36b9h),hl
+			rst	30h
+			djnz	L76b3
+			push	hl
+			add	hl,hl
+			ld	a,a
+			call	c,Le212
+			or	h
+			jr	nc,L76c3
+			add	a,l
+			rlca
+			ld	l,a
+			sbc	a,(hl)
+			ld	b,12h
+			jr	nz,L7655
+			ld	h,c
+			ld	l,b
+			sbc	a,h
+			dec	d
+			call	nz,L1fde
+			sbc	a,b
+			ex	af,af'
+			inc	h
+			xor	a
+			ld	d,a
+			ld	(hl),b
+			ld	l,b
+			ld	de,1da3h
+			xor	e
+			sbc	a,(hl)
+			ret	z
+			xor	e4h
+			ld	c,c
+			ld	d,a
+			call	c,L345a
+			rst	10h
+			ld	a,l
+			rlca
+			ld	d,(hl)
+			xor	a
+			and	h
+			ld	c,b
+			sub	d
+			pop	af
+			ld	d,h
+			or	h
+			call	c,L9b82
+			inc	b
+			ld	(hl),c
+			ex	af,af'
+			rst	18h
+			inc	(hl)
+			ld	(hl),b
+			ld	e,b
+			djnz	L7682
+			jr	z,L7680
+			ret	c
+			rst	28h
+			ld	h,c
+			ex	(sp),hl
+			ret
+			db	b5h,c9h,02h
+			cp	h
+			dec	de
+			pop	af
+			ld	e,a
+			ld	b,(hl)
+			adc	a,b
+			ld	(de),a
+			adc	a,d
+			dec	sp
+			ld	(28b9h),hl
+			cp	h
+			ld	l,(hl)
+			pop	af
+			ld	e,25h
+			ld	l,h
+			xor	c1h
+			djnz	L76e8
+			or	c
+			ld	a,b
+			push	bc
+			ld	e,c
+			adc	a,c
+			ld	e,7bh
+			rst	00h
+			dec	d
+			ld	d,d
+			and	b
+			ld	b,c
+			or	e
+			ld	a,(bc)
+			and	0eh
+			ld	bc,36f9h
+			or	c
+			xor	d
+			add	a,c
+			nop (2x) *
+			ld	d,d
+			ld	b,(hl)
+			ld	hl,(4cf1h)
+			pop	af
+			and	b
+			add	a,c
+			jp	p,L623f
+			dec	hl
+			dec	d
+			ex	(sp),hl
+			inc	a
+			ld	l,l
+			nop
+			ld	c,l
+			cp	b
+			ld	(L666f),a
+			and	h
+			ld	c,c
+			ld	h,l
+			add	hl,de
+			sbc	a,a
+			inc	d
+			ld	c,l
+			xor	(hl)
+			ld	h,h
+			call	nc,L70c7
+			sub	c
+			xor	b
+			ret	z
+			ld	sp,hl
+			ret	z
+			dec	a
+			ld	h,c
+			adc	a,4bh
+			ex	de,hl
+			ld	c,e
+			in	a,(17h)
+			inc	c
+			or	c
+			jp	po,L1865
+			dec	l
+			ld	e,d
+			ret	z
+			and	c
+			ld	l,b
+			sub	a
+			push	af
+			ld	d,d
+			ld	a,e
+			daa
+			rst	20h
+			or	d
+			and	b
+			jr	nc,L76e1
+			and	l
+			ld	sp,07c5h
+			in	b,(c)
+			nop (2x) *
+			adc	a,d7h
+			rla
+			ld	a,(2a1dh)
+			jp	c,L0d1b
+			ld	c,3dh
+			nop (2x) *
+			and	a2h
+			exx
+			cp	(hl)
+			rrca
+			add	a,b
+			in	a,(4fh)
+			or	l
+			ld	c,d
+			ld	a,b
+			ld	(hl),e5h
+			push	de
+			ld	e,l
+			ld	d,e
+			dec	b
+			jr	nc,L77eb
+			adc	a,l
+			add	a,c
+			ld	e,b
+			ret	pe
+			ret	pe
+			add	a,b
+			ld	d,d
+			sbc	a,a
+			jp	po,Ldc3e
+			ld	c,07h
+			inc	e
+			daa
+			ld	h,e
+			ld	e,d
+			rst	18h
+			ld	h,d
+			dec	hl
+			adc	a,d
+			ld	(hl),e
+			sbc	a,b
+			ld	l,a
+			jr	c,L77b3
+			ld	d,b
+			cp	a
+			sbc	a,(hl)
+			and	d
+			ld	b,b
+			set	6,c
+			sbc	a,a
+			xor	b
+			ld	(hl),h
+			push	hl
+			nop
+			push	bc
+			or	h
+			ld	a,l
+			sbc	a,c
+			ld	b,h
+			ld	a,e
+			ld	b,a
+			and	l
+			pop	de
+			ld	(hl),l
+			ld	a,(b95ah)
+			rl	b
+			ld	e,c
+			inc	d
+			sub	d
+			rra
+			add	hl,de
+			and	c
+			call	m,Lc7e5
+			ld	c,c
+			cp	e
+			or	h
+			ld	a,h
+			ld	c,d
+			sub	c
+			nop
+			add	hl,hl
+			or	(hl)
+			ld	(hl),h
+			ret	pe
+			ld	h,h
+			inc	e
+			ld	(hl),c
+			ld	(79b9h),a
+			add	a,b
+			ret
+			db	ebh,3ah,c8h,47h
+			ret	po
+			jp	c,Lf2e4
+			jr	nz,L7831
+			ld	h,d
+			call	nz,L7633
+			add	hl,sp
+			push	hl
+			ld	(hl),e
+			ld	h,b
+			rst	38h
+			cp	a
+			ld	hl,(967dh)
+			or	03h
+			ld	e,e
+			sub	a
+			adc	a,fdh
+			cpl
+			inc	e
+			pop	de
+			add	a,d5h
+			call	c,Lea2a
+			set	3,e
+			ld	e,a3h
+			rrca
+			ld	l,6dh
+			or	h
+			ld	l,c
+			ld	a,(647bh)
+			dec	l
+			ld	c,h
+			ld	a,h
+			halt
+			sbc	a,a
+			add	hl,de
+			ld	d,h
+			sub	d
+			inc	a
+			ex	af,af'
+			nop (2x) *
+			ld	(bc),a
+			inc	a
+			xor	e
+			sbc	a,a
+			dec	d
+			sub	d
+			ld	d,c
+			sub	cbh
+			add	a,e
+			jp	(hl)
+			db	43h,8bh,e6h,1fh,2ah,e7h,c8h,91h
+			db	ffh,dbh,83h,e9h,fch,fch,6eh,61h
+			db	32h,98h,0fh,0dh,f7h,0dh,5dh,41h
+			db	deh,02h,7eh
+			ld	b,d
+			in	a,(d2h)
+			ld	c,h
+			out	(ddh),a
+			exx
+			add	a,a
+			inc	(hl)
+			sbc	a,0bh
+			ld	c,b
+			ld	h,61h
+			pop	bc
+			or	c
+			ld	c,l
+			ld	l,a
+			ld	b,c
+			ld	a,b
+			ld	a,h
+			jp	nc,Leb1b
+			dec	l
+			ld	h,b
+			ld	d,a
+			and	h
+			ld	h,c
+			ld	e,29h
+			add	hl,sp
+			ld	de,b3bfh
+			ld	(ff61h),a
+			jp	m,L4826
+			jp	c,L957e
+			inc	bc
+			sbc	a,h
+			sub	b
+			push	bc
+			inc	e
+			adc	a,e
+			or	b6h
+			ld	a,f6h
+			ld	b,d
+			inc	l
+			rlca
+			dec	a
+			ld	l,b
+			sbc	hl,hl
+			rlca
+			or	b
+			add	a,c
+			jr	nz,L78ed
+			adc	a,(ix + 31h)
+			ld	a,(bc)
+			rra
+			ld	b,h
+			dec	d
+			ld	d,h
+			ld	l,d
+			adc	a,(hl)
+			ld	hl,704ch
+			ld	e,h
+			ld	h,e
+			ld	(bc),a
+			nop (2x) *
+			or	d
+			ld	de,aa48h
+			ret	z
+			ld	(97f7h),ix
+			ld	h,89h
+			jp	(hl)
+			db	d8h,17h,5ah,84h,71h,e5h,3dh,eah
+			db	87h,41h,e6h,f4h,66h,43h,85h,c5h
+			db	8fh,09h,63h,0ch,6bh,60h,93h,28h
+			db	6ah,35h,89h,3eh,04h,8eh,04h,2ch
+			db	c9h,07h,b1h,03h,3dh,cbh,49h,63h
+			db	c3h,15h,c6h,3eh,e9h,f3h,deh,41h
+			db	e2h,dah,c7h,d8h,84h,07h,56h,3bh
+			db	fbh,32h
+			ld	d,h
+			ld	b,d
+			exx
+			jr	nz,L7871
+			dec	l
+			ld	a,e
+			jp	p,Lf572
+			pop	bc
+			nop
+			jr	z,L78f9
+			ld	hl,(9941h)
+			scf
+			dec	a
+			halt
+			sbc	a,b
+			sbc	a,35h
+			ld	sp,iy
+			ld	l,a
+			jp	nc,L33bb
+			sbc	a,b
+			call	nz,L6a15
+			call	m,L7f67
+			ld	h,e
+			cpl
+			ld	b,h
+			scf
+			ld	c,a
+			ld	(3ddbh),a
+			or	a
+			ret	pe
+			jp	(hl)
+			db	a3h,07h
+			ld	b,h
+			and	(hl)
+			jp	nc,L1864
+			jp	m,L7aba
+			xor	d
+			sub	9ah
+			sub	d
+			xor	h
+			dec	l
+			ld	(hl),d
+			push	af
+			ld	h,b
+			inc	hl
+			inc	sp
+			ld	e,c
+			push	bc
+			inc	d
+			pop	bc
+			ld	de,ddadh
+			ld	a,h
+			ld	(hl),c
+			dec	c
+			daa
+			call	m,Lac39
+			ld	(hl),l
+			jp	Lcd1c
+			db	b8h,9bh,3bh,bah,29h,d0h,c1h,7ch
+			db	9eh,d4h,f4h,2bh,84h,61h,95h,58h
+			db	46h,0bh,b2h,86h,5fh,55h,34h,f6h
+			db	a6h,9dh,23h,6eh,95h,97h,72h,d7h
+			db	48h,1fh,8eh,33h,deh,52h,7fh,66h
+			db	b7h,eah,2ah,d1h,c8h,5ch,17h,25h
+			db	7dh,9fh,4eh,7ch,e3h,deh,0ah,b2h
+			db	f3h,7eh,98h,c7h,d6h,cdh,e6h,e1h
+			db	f5h,a0h,96h
+			in	a,(e7h)
+			add	a,d
+			call	nz,Lb713
+			call	pe,L6c07
+			call	m,Ld085
+			djnz	L79b5
+			ld	e,c
+			ld	d,h
+			pop	bc
+			ld	(hl),42h
+			ret	z
+			pop	de
+			rra
+			cp	c9h
+			ld	sp,8c77h
+			inc	d
+			ld	h,l
+			inc	de
+			ei
+			ld	l,f2h
+			sub	h
+			push	hl
+			jp	c,Ld6d4
+			adc	a,h
+			inc	sp
+			halt
+			sub	e
+			add	a,e
+			or	a
+			sbc	a,6ah
+			ld	e,d
+			ld	c,(hl)
+			xor	h
+			ld	b,b
+			dec	b
+			daa
+			ld	h,(hl)
+			adc	a,h
+			ccf
+			xor	a
+			ld	a,l
+			sbc	a,a
+			rst	00h
+			sub	e
+			add	hl,bc
+			inc	h
+			call	nc,Lde73
+			ld	c,(hl)
+			and	d
+			sub	c
+			xor	d
+			jr	c,L798a
+			rst	30h
+			cp	d
+			sbc	a,e
+			sub	h
+			sbc	a,(hl)
+			xor	(hl)
+			ld	h,(hl)
+			cp	l
+			rst	30h
+			ld	h,a
+			cp	d
+			ccf
+			ld	h,(hl)
+			add	a,d
+			scf
+			ld	b,(hl)
+			ld	l,d
+			xor	l
+			inc	e
+			ld	d,d
+			ld	a,d
+			sbc	a,a
+			di
+			xor	c
+			adc	a,(hl)
+			push	bc
+			ret	pe
+			dec	c
+			call	po,Lbc04
+			adc	a,a
+			ld	e,d
+			ld	d,e
+			ret	p
+			ld	b,c
+			ld	h,e
+			inc	(hl)
+			ld	(hl),d
+			call	m,Lf2ff
+			jp	nc,L9ee7
+			dec	l
+			ld	d,l
+			ret	p
+			add	hl,sp
+			ex	de,hl
+			cp	l
+			sbc	a,e
+			ld	h,33h
+			ld	b,a
+			rst	10h
+			ld	l,h
+			call	L416b
+			call	m,Ld87c
+			and	d
+			call	m,L8a68
+			and	l
+			ld	l,h
+			or	e
+			ld	l,b
+			ld	hl,(b05ch)
+			and	b
+			dec	sp
+			push	hl
+			ld	(hl),a
+			ld	a,h
+			jp	(hl)
+			db	f3h,b6h,94h,edh,b6h,0fh,71h,8ah
+			db	08h,e8h,0ch,a2h,a2h,92h,b8h,d1h
+			db	04h,fah,f5h,39h,cbh,23h,8ch,89h
+			db	64h,70h,b2h,9ah,e6h,36h,e8h,7dh
+			db	84h,10h,5eh,c0h,9eh,3dh,b1h,12h
+			db	3ch,79h,1bh,48h,81h,30h,afh,13h
+			db	bah,42h,ffh,87h,20h,cah,48h,afh
+			db	29h,dah,76h,57h,c7h,d9h,25h,88h
+			db	58h,a5h,efh,16h,b7h,ddh,0eh,03h
+			db	fch,73h,61h,1fh,46h,e6h,94h,fch
+			db	58h,1bh,efh,85h,beh,c8h,dfh,a4h
+			db	1ch,00h,4dh,80h,e4h,93h,ddh,38h
+			db	b8h,90h,6eh,6fh,60h,afh,e6h,afh
+			db	76h,35h,23h,92h,adh,fah,e6h,fch
+			db	b3h,67h,0bh,47h,6eh,92h,cdh,9bh
+			db	c1h,32h,a6h,efh,48h,fdh,12h,6ch
+			db	13h,6ah,b7h,3ch,9dh,68h,e0h,9bh
+			db	dch,6ah,54h,6ah,5ch,39h,5bh,2dh
+			db	b1h,c7h,94h,47h,70h,5dh,b8h,dfh
+			db	30h,a4h,5bh,c1h,49h,47h,02h,51h
+			db	9dh,78h,e1h,82h,91h,30h,beh,77h
+			db	ebh,60h,0fh,f2h,f2h,5bh,b8h,67h
+			db	c6h,65h,feh,59h,77h,beh,2fh,3bh
+			db	0dh,97h,f8h,ach,27h,06h,6eh,05h
+			db	e8h,24h,d5h,02h,bfh
+			adc	a,9bh
+			ld	(hl),e1h
+			jp	p,L0583
+			ld	d,b
+			and	c
+			ret	m
+			or	h
+			ld	b,bdh
+			ld	a,(de)
+			ld	d,a
+			ld	a,55h
+			add	a,e
+			xor	(hl)
+			srl	e
+			dec	l
+			ld	(hl),b4h
+			ret
+			db	47h,93h,2eh,04h,a6h,09h,79h,0dh
+			db	3ah,92h,36h,b1h,e3h,11h,09h,fdh
+			db	ffh,3dh,94h,f6h,adh,aah,96h,1eh
+			db	fdh,a4h,f2h,14h,b4h,28h,ebh,0bh
+			db	53h,2fh,e8h,7ch,e3h,bah,46h,01h
+			db	8bh,e6h,64h,5eh,e4h,fbh,d7h,e4h
+			db	24h,83h,8dh,00h,89h,aeh,15h,8dh
+			db	71h,90h,03h,b9h,21h,dah,9eh,5fh
+			db	9fh,e3h,41h,33h,1eh,e5h,9fh,6eh
+			db	e4h,25h,05h,deh,a0h,6bh,7bh,e6h
+			db	9dh,9fh,9fh,19h,b7h,0dh,bch,48h
+			db	f2h,7fh,aah,9dh,48h,afh,a9h,4fh
+			db	07h,77h,1ah,04h
+			ld	(28e1h),hl
+			ld	a,(bc)
+			ld	e,d
+			sbc	a,5ah
+			dec	sp
+			adc	a,38h
+			call	nc,L69be
+			ld	d,h
+			adc	a,h
+			ld	(hl),a
+			or	b
+			and	c
+			jp	nz,L3f24
+			ld	l,l
+			ld	d,d
+			djnz	L7b39
+			adc	a,h
+			ld	h,b
+			sbc	a,a
+			jp	c,L0a4c
+			xor	d
+			sbc	a,e
+			cpl
+			ccf
+			ld	d,a
+			jp	nc,Lc17b
+			jp	z,Lafdf
+			cpl
+			ld	h,l
+			dec	l
+			or	d
+			inc	h
+			ld	h,(hl)
+			cpl
+			halt
+			adc	a,d
+			inc	de
+			dec	bc
+			rla
+			ld	(c129h),hl
+			cp	c
+			sbc	a,a
+			add	iy,iy
+			ld	a,l
+			ld	c,(hl)
+			ld	bc,b722h
+			inc	b
+			ld	c,c
+			ld	h,d
+			ld	(bc),a
+			ld	(hl),l
+			adc	a,h
+			ld	l,3fh
+			ld	e,d
+			jp	p,L4d20
+			jp	(hl)
+			db	ebh,95h,00h,2ch,5ah,e4h,14h,38h
+			db	f8h,e2h,0eh,27h,38h,5fh,6ah,60h
+			db	a1h,cah,6fh,ach,6bh,79h,dah,fch
+			db	f5h,8fh,92h,e0h,eah,f8h,fdh,d3h
+			db	f9h,fch,66h,deh,a4h,4ch,13h,c2h
+			db	37h,86h,25h,ebh,99h,72h,52h,b3h
+			db	f8h,5ch,52h,5dh,72h,0ch,49h,46h
+			db	53h,04h,9dh,81h,f7h,f8h,6dh,52h
+			db	a3h,feh,efh,ffh,e1h,6ah,16h,38h
+			db	f9h,f8h,23h,fch,04h,bbh,16h,74h
+			db	1eh,a6h,fah,9fh
+			ld	a,a
+			add	a,(hl)
+			ld	d,h
+			sbc	a,(hl)
+			ld	hl,(6d27h)
+			push	af
+			jp	pe,Lff06
+			cp	(hl)
+			ld	(hl),b
+			ld	(hl),c
+			ld	a,b
+			ld	b,c
+			adc	a,d
+			or	b5h
+			sbc	a,c
+			ld	a,(0f10h)
+			rrca
+			ld	l,l
+			or	b
+			adc	a,d
+			ret	c
+			ld	d,e
+			ld	b,b
+			ld	b,h
+			cp	e
+			inc	c
+			ld	e,h
+			exx
+			add	a,35h
+			ld	(hl),h
+			add	hl,bc
+			rst	10h
+			ld	(hl),b
+			ld	b,l
+			rst	38h
+			daa
+			out	(4ch),a
+			sub	l
+			push	af
+			ld	a,l
+			sub	59h
+			and	c
+			ld	c,l
+			halt
+			ld	b,d
+			ld	h,e
+			ex	de,hl
+			add	hl,de
+			ld	b,(hl)
+			and	57h
+			ld	a,(hl)
+			ld	d,d
+			ld	(hl),e
+			adc	a,aeh
+			daa
+			ld	a,e
+			or	h
+			ld	(d1ddh),hl
+			or	3dh
+			adc	a,b
+			ret	pe
+			and	(hl)
+			ld	b,b
+			djnz	L7bf9
+			ld	a,c
+			and	e
+			ld	b,ixl *
+			ld	(hl),a
+			cp	h
+			xor	c
+			dec	bc
+			ld	(c4c8h),hl
+			cp	c
+			ld	(L2422),hl
+			ld	sp,hl
+			jp	nc,Lec58
+			ld	c,d
+			ld	d,(hl)
+			ld	(hl),c
+			ld	de,0c12h
+			rst	30h
+			halt
+			ld	a,h
+			sub	e
+			xor	c
+			adc	a,d
+			ld	h,a
+			add	a,a
+			inc	e
+			rst	10h
+			xor	(hl)
+			nop (2x) *
+			ret	po
+			ld	d,l
+			call	c,L7eb0
+			djnz	L7c9c
+			sbc	a,c
+			ld	h,b2h
+			sub	b
+			jp	p,Le811
+			jp	Ld9f8
+			db	fch,b6h,09h,4ch,85h,61h,9bh,27h
+			db	70h,efh,56h,2fh,89h,b7h,c9h,abh
+			db	57h,63h,f4h,7ch,bbh,e0h,c5h,3ch
+			db	89h,22h,b7h,88h,ebh,7eh,8ch,1bh
+			db	d8h,62h,99h,cch,89h,65h,7eh,9bh
+			db	92h,e4h,89h,5ah,4fh,b3h,27h,dbh
+			db	c8h,cch,3eh,8ch,8bh,85h,80h,aeh
+			db	4dh,cfh,86h
+			ld	d,b
+			ld	a,d
+			ld	h,(hl)
+			ld	c,a
+			cp	b
+			daa
+			sbc	a,(hl)
+			dec	a
+			ld	b,l
+			ld	h,e
+			rst	00h
+			sub	(hl)
+			ld	(hl),d
+			ret	c
+			ld	e,d
+			rst	10h
+			jp	z,L32d8
+			ld	e,d
+			dec	d
+			inc	hl
+			xor	a
+			add	a,h
+			ld	(hl),c
+			ld	(07cdh),hl
+			sbc	a,h
+			push	hl
+			adc	a,b
+			dec	bc
+			add	hl,bc
+			xor	b
+			sbc	a,e
+			inc	sp
+			dec	h
+			ld	d,c
+			ret	c
+			nop (2x) *
+			ld	b,d
+			ld	l,b
+			ld	l,a
+			dec	b
+			sub	a
+			in	a,(b7h)
+			dec	h
+			cp	h
+			jr	z,L7cd0
+			ccf
+			adc	a,l
+			jp	m,Le735
+			ld	d,3ah
+			ld	a,46h
+			ld	l,l
+			ld	e,d
+			inc	b
+			push	de
+			pop	hl
+			pop	hl
+			ld	d,h
+			add	a,c
+			sub	c
+			scf
+			bit	5,l
+			ld	b,l
+			sbc	a,a
+			ld	d,l
+			ld	b,b
+			sbc	a,h
+			ld	(hl),d
+			rst	38h
+			or	a
+			and	l
+			jp	(hl)
+			db	c5h,a3h,90h,e8h,80h,4dh,31h,25h
+			db	e3h,38h,9dh,deh,46h,e7h,f5h,98h
+			db	60h,6fh,1dh,e0h,0fh,77h,12h,a2h
+			db	7dh,d8h,cah
+			inc	h
+			ld	e,e
+			ld	e,h
+			and	h
+			ei
+			call	nz,Ld6a8
+			add	a,h
+			xor	c
+			or	c
+			jp	po,L0678
+			sbc	a,e
+			adc	a,(hl)
+			ld	l,(hl)
+			add	a,(hl)
+			jp	z,L4b77
+			push	de
+			sbc	a,h
+			ex	de,hl
+			ld	a,(de)
+			ld	a,b
+			inc	sp
+			dec	bc
+			dec	a
+			adc	a,h
+			sbc	a,l
+			sub	(hl)
+			dec	c
+			ld	(hl),d
+			sbc	a,d
+			cp	(hl)
+			sbc	a,(hl)
+			rst	28h
+			jp	nz,Lfb61
+			and	28h
+			dec	b
+			dec	bc
+			ld	l,(hl)
+			ld	h,e8h
+			call	Ld87e
+			ld	e,d
+			ei
+			ld	c,d
+			or	(hl)
+			push	af
+			adc	a,c
+			ld	(hl),h
+			ld	d,b
+			rra
+			inc	(hl)
+			inc	c
+			inc	l
+			nop (2x) *
+			ld	d,e
+			ld	b,c
+			cpl
+			ld	c,h
+			or	d
+			ex	af,af'
+			ld	(hl),b
+			or	(hl)
+			ld	(de),a
+			ld	c,09h
+			adc	a,d
+			ex	de,hl
+			rst	18h
+			in	a,(83h)
+			call	nz,L3010
+			sub	c
+			add	a,e
+			add	hl,sp
+			inc	(hl)
+			ret	z
+			ex	af,af'
+			or	d
+			ex	(sp),hl
+			nop (2x) *
+			sbc	a,h
+			ld	b,l
+			dec	de
+			sub	e
+			dec	de
+			adc	a,b
+			sbc	a,c
+			or	l
+			ld	h,l
+			ld	hl,6a41h
+			djnz	L7d4b
+			jr	L7d49
+			db	04h,d9h,00h,3ch,1ch,ceh,b5h,26h
+			db	30h,6ch,e5h,4fh,afh,9bh,5fh,9fh
+			db	fdh,5fh,40h,35h,b7h,c3h,d3h,31h
+			db	02h,c8h,41h,48h,7fh,ddh,f5h,91h
+			db	03h,c2h,4ch,83h,69h,eah,a3h,21h
+			db	2eh,76h,d4h,bah,0ah,1fh,08h,88h
+			db	ach,05h,2dh,1ah,54h,bch,ech,cfh
+			db	d0h,b5h,29h,dfh,8eh,f0h,f6h,3ah
+			db	8ch,31h,b2h,5eh,8eh,50h,5dh,a7h
+			db	beh,54h,15h,59h,52h,41h,c3h,30h
+			db	56h,f9h,3bh,5dh,45h,66h,86h,11h
+			db	d7h,75h,adh
+			rst	38h
+			nop
+			rst	08h
+			ld	a,d
+			jp	po,L5995
+			and	e
+			ld	e,a
+			call	pe,Ledb5
+			ld	e,c
+			ld	c,d
+			ld	l,14h
+			add	hl,sp
+			rst	20h
+			ld	l,d
+			push	hl
+			ld	h,b
+			xor	a
+			ret	p
+			and	l
+			pop	hl
+			sub	(hl)
+			cp	b
+			ld	d,l
+			sub	(hl)
+			ld	d,(hl)
+			dec	de
+			and	h
+			push	hl
+			or	h
+			push	af
+			ld	a,b
+			or	(hl)
+			sbc	a,h
+			ld	(hl),e
+			call	c,L28ff
+			and	c
+			call	Le27a
+			adc	a,h
+			and	22h
+			scf
+			adc	a,a
+			ld	l,h
+			ld	b,e
+			ld	(hl),h
+			push	hl
+			ld	a,a
+			inc	hl
+			add	hl,bc
+			ccf
+			and	h
+			ld	d,h
+			xor	(hl)
+			ld	c,b
+			ret	c
+			inc	a
+			or	c
+			ccf
+			rst	38h
+			ld	h,dbh
+			rst	18h
+			ret	nc
+			inc	(hl)
+			or	d
+			ld	a,l
+			ld	b,c
+			inc	c
+			adc	a,h
+			cp	l
+			push	de
+			or	l
+			ld	l,b9h
+			ld	a,(bc)
+			dec	c
+			ld	d,d
+			rst	18h
+			sbc	a,e
+			dec	bc
+			or	e
+			ld	sp,hl
+			ex	de,hl
+			ld	d,e
+			sub	(hl)
+			cpl
+			ex	de,hl
+			ld	e,b
+			ld	sp,hl
+			ld	d,a
+			sbc	a,e
+			jr	c,L7e0f
+			xor	e
+			ld	(hl),l
+			add	hl,bc
+			call	nz,L8864
+			ld	c,c
+			sub	d
+			ld	a,(hl)
+			xor	d
+			call	m,L538d
+			ld	c,b
+			ld	(hl),d
+			ld	(hl),1ah
+			jp	pe,Lde47
+			jp	z,L550c
+			or	(hl)
+			ld	e,b
+			ld	l,e5h
+			inc	l
+			exx
+			rst	08h
+			ld	e,l
+			call	nz,Lf649
+			ld	de,5ff0h
+			dec	d
+			ld	sp,hl
+			call	z,L7125
+			ld	e,d
+			ld	h,e
+			add	a,(hl)
+			or	e
+			jr	c,L7e19
+			add	hl,sp
+			ld	e,7ch
+			dec	a
+			dec	h
+			ld	l,h
+			jr	L7e7b
+			db	d1h,bbh,aah,8bh,44h,e8h,88h,b0h
+			ld	b,d
+			ex	de,hl
+			sub	a
+			ld	(bc),a
+			sub	d
+			push	de
+			xor	h
+			ld	(hl),l
+			ld	(hl),l
+			ex	de,hl
+			jr	nc,L7edd
+			add	hl,de
+			pop	de
+			sub	ffh
+			rst	10h
+			add	a,b7h
+			nop (2x) *
+			adc	a,c
+			ld	h,c
+			jp	c,L97ac
+			ld	(bc),a
+			inc	bc
+			call	nc,L1f7a
+			xor	l
+			add	a,c
+			ld	bc,8326h
+			ld	(de),a
+			and	a9h
+			jp	Lee19
+			db	f6h,e6h,c0h,ceh,99h,a8h,edh,85h
+			db	93h,fah,71h,11h,79h,66h,89h
+			ld	c,e
+			ccf
+			sbc	a,1bh
+			dec	hl
+			rrca
+			rst	08h
+			sbc	a,(hl)
+			call	pe,L4437
+			rst	20h
+			inc	sp
+			ld	a,c
+			or	c
+			sbc	a,7ch
+			ld	l,d
+			ld	c,b
+			ld	e,b
+			add	a,f1h
+			jp	p,Lf086
+			ld	(hl),l
+			and	(hl)
+			ld	(hl),b
+			ld	d,04h
+			ld	e,(hl)
+			ld	d,d
+			rst	10h
+			rst	10h
+			ld	b,d
+			ld	e,b
+			inc	e
+			sub	(hl)
+			adc	a,h
+			add	a,b
+			ex	de,hl
+			adc	a,c
+			dec	b
+			ld	d,b
+			ld	h,l
+			call	nz,L5e86
+			ld	l,(hl)
+			sbc	a,e
+			sub	c
+			ld	l,e
+			ld	(hl),a
+			dec	h
+			ld	a,c
+			sbc	a,a
+			adc	a,e
+			and	l
+			sbc	a,a
+			out	(1bh),a
+			jp	m,L6573
+			nop
+			ld	e,e
+			ex	de,hl
+			add	a,e
+			jp	po,L0e3e
+			add	hl,bc
+			xor	0ch
+			call	c,L76ef
+			ld	h,b
+			nop (2x) *
+			ld	c,d
+			ld	h,h
+			sub	d
+			ld	e,33h
+			add	a,e
+			ret	p
+			push	de
+			jp	(hl)
+			db	bbh,1eh,feh,6dh,33h,b1h,23h,afh
+			db	11h,a2h,e4h
+			ld	e,e
+			ld	a,a
+			sbc	a,a
+			xor	c2h
+			ld	d,(hl)
+			di
+			ret
+			db	85h,0ah,9fh,03h,afh,60h,18h,3eh
+			db	78h,72h,3dh,b2h,00h,a6h,6bh,6eh
+			ld	(hl),a
+			ret	po
+			and	c
+			xor	a
+			add	hl,de
+			dec	(hl)
+			sub	(hl)
+			add	a,e
+			rst	18h
+			ld	a,(hl)
+			rst	08h
+			jr	z,L7f91
+			jp	m,L7eda
+			rst	08h
+			jr	L7f42
+			db	33h,9dh,9ch
+			ld	bc,3ce0h
+			inc	(hl)
+			dec	de
+			call	z,L6fd0
+			jp	nc,L6664
+			add	a,(hl)
+			ld	d,3ch
+			ld	b,(hl)
+			jr	nz,L7efc
+			ret
+			db	dfh,85h,0bh,d3h,e3h,6eh
+			add	hl,sp
+			jp	po,Ldb9c
+			jp	z,L8843
+			ret
+			db	4dh,0dh,ebh,e3h,c3h
+			ld	(hl),l
+			adc	a,b
+			add	hl,bc
+			sbc	a,(hl)
+			exx
+			ret	po
+			ld	d,e
+			ld	a,l
+			rst	30h
+			add	a,d
+			inc	a
+			ld	l,h
+			ret	c
+			ld	h,b
+			or	e
+			sub	44h
+			ld	a,b
+			jp	z,L8e98
+			sbc	a,bah
+			ld	c,b
+			jr	nz,L7f14
+			add	a,(hl)
+			ld	a,a
+			exx
+			rst	08h
+			ret	nz
+			sbc	a,(hl)
+			dec	(hl)
+			ld	d,b
+			inc	e
+			sbc	a,c
+			ld	(bc),a
+			cpl
+			add	a,d
+			ld	d,h
+			sbc	a,l
+			rlca
+			call	c,L1d50
+			in	a,(8bh)
+			rra
+			jp	z,Lce83
+			nop (2x) *
+			ld	c,d
+			and	d
+			ld	c,l
+			halt
+			dec	c
+			cp	b
+			or	e
+			adc	a,b
+			adc	a,e
+			dec	bc
+			in	a,(98h)
+			or	b
+			cp	(hl)
+			jp	pe,L5892
+			add	a,h
+			ld	d,b
+			rst	08h
+			ld	e,c
+			dec	e
+			ld	b,a
+			sbc	a,l
+			xor	(hl)
+			sbc	a,a
+			xor	l
+			add	hl,de
+			dec	de
+			xor	h
+			ld	b,(hl)
+			ld	h,b
+			ld	(ix + f4h),c
+			pop	hl
+			ld	d,e
+			ld	c,09h
+			ld	b,c1h
+			sub	29h
+			ld	l,l
+			and	e
+			nop
+			dec	c
+			rst	00h
+			ld	(hl),7bh
+			rst	18h
+			xor	c
+			cpdr
+			exx
+			exx
+			sbc	a,c
+			exx
+			djnz	L7f92
+			rst	08h
+			add	a,(hl)
+			adc	a,e
+			cp	(hl)
+			ret	pe
+			xor	b
+			exx
+			ld	e,h
+			pop	de
+			call	p,L0e3c
+			ld	e,d
+			ld	e,e
+			jp	c,L9fd5
+			or	(hl)
+			adc	a,a
+			ld	d,h
+			jp	nz,L6891
+			ret	p
+			xor	d
+			adc	a,d
+			ret	pe
+			ld	l,e
+			jr	nc,L801b
+			adc	a,h
+			or	d
+			cp	c
+			ld	c,b
+			sub	a
+			xor	c
+			ret	pe
+			sub	d
+			ret	p
+			adc	a,b
+			adc	a,b
+			rrc	(hl)
+			ret	p
+			ld	b,a
+			rlca
+			sub	a
+			dec	b
+			pop	af
+			ld	(hl),c
+			inc	de
+			ld	e,(hl)
+			ld	e,b
+			dec	h
+			adc	a,d
+			jp	m,L34a3
+			ld	h,d
+			xor	b
+			ret	nz
+			sub	a
+			ld	d,h
+			ld	d,b
+			halt
+			ld	e,c
+			add	hl,bc
+			rrca
+			ret	nc
+			cp	(hl)
+			sub	d
+			sub	a
+			call	c,L8c4b
+			cp	e
+			jp	nc,L73ed
+			sbc	a,e
+			inc	sp
+			ret	m
+			call	m,Ld19c
+			jp	(hl)
+			db	0dh,ffh,9ch,87h,85h,41h,f1h,fah
+			db	8ch,7dh,6ah,8ch,2fh,4fh,d7h,98h
+			db	3bh,3eh,e5h,26h,8fh,dbh,dfh,53h
+			db	a7h,94h,03h,24h,25h,b3h,38h,30h
+			db	1dh,61h,6ch,54h,c2h
+			cp	e
+			ld	c,b
+			ld	(hl),8dh
+			inc	d
+			cp	(hl)
+			ld	l,b
+			jp	po,L2fa8
+			pop	af
+			pop	bc
+			pop	hl
+			jp	nc,L33a6
+			ld	(hl),9ch
+			cp	l
+			and	l
+			ld	bc,7de2h
+			rlca
+			sub	e
+			inc	sp
+			sub	h
+			ld	l,e
+			ld	b,b
+			xor	l
+			ld	c,a
+			ret	m
+			ret	z
+			daa
+			jp	z,L13b2
+			rst	20h
+			rra
+			cp	l
+			ret	pe
+			ret	m
+			exx
+			and	b
+			push	af
+			ld	b,e
+			adc	a,a
+			sub	e
+			ld	h,a
+			ld	h,(hl)
+			ld	(bc),a
+			ld	c,d
+			sbc	a,d
+			cp	b
+			jp	(hl)
+			db	c8h,eeh,e0h,55h,beh,72h,3ch,f1h
+			db	d3h,93h,85h,72h,59h,c1h,92h,1ah
+			db	a9h,72h,50h,2eh,44h,2ah,f6h,bah
+			db	b8h,f2h,d4h
+			ld	(hl),h
+			inc	de
+			ld	l,d
+			dec	h
+			inc	b
+			sub	c
+			ld	a,b
+			out	(c),(hl)
+			rst	18h
+			adc	a,e
+			adc	a,c
+			sub	(hl)
+			add	a,c
+			ld	b,a
+			and	d
+			ret	z
+			nop (2x) *
+			rlca
+			and	e
+			ret
+			db	fdh,e7h
+			xor	h
+			add	a,b
+			call	m,L345d
+			call	c,Le660
+			dec	c
+			or	a
+			and	h
+			sub	f0h
+			jp	c,L6807
+			sbc	a,e
+			rst	00h
+			rst	08h
+			ld	a,e
+			jp	L7b37
+			db	53h
+			dec	bc
+			cp	9bh
+			ld	(hl),a
+			or	(hl)
+			rst	18h
+			ex	de,hl
+			ld	(hl),c
+			sub	l
+			ld	(bc),a
+			jp	nz,Ld478
+			in	a,(01h)
+			adc	a,b
+			ld	e,01h
+			sub	b
+			inc	c
+			sbc	a,c
+			add	hl,bc
+			inc	l
+			add	a,d
+			ld	h,c
+			dec	de
+			ld	e,e
+			ex	de,hl
+			inc	sp
+			and	l
+			ld	l,h
+			jr	nc,L80a4
+			ld	a,(bc)
+			ld	(bc),a
+			inc	bc
+			or	h
+			rra
+			ld	h,b
+			ld	a,(hl)
+			or	d
+			ld	(hl),a
+			dec	l
+			ld	h,l
+			sbc	a,l
+			adc	a,h
+			ld	sp,bba6h
+			dec	d
+			inc	d
+			or	b
+			ld	(hl),d
+			or	c
+			jp	c,L0ee4
+			ld	(hl),e
+			ld	b,e
+			cp	54h
+			ld	d,l
+			add	a,c
+			xor	h
+			cp	76h
+			ld	l,d
+			dec	h
+			ld	h,l
+			ld	c,d
+			add	hl,hl
+			or	21h
+			rst	30h
+			ld	b,e
+			ret	po
+			ld	a,d
+			add	a,e
+			nop (2x) *
+			ld	h,d3h
+			ld	e,e
+			add	a,e
+			sub	h
+			ld	l,h
+			add	hl,hl
+			add	a,e
+			ld	c,e
+			adc	a,a
+			push	de
+			push	af
+			or	73h
+			ld	(hl),e
+			call	po,L49db
+			add	a,(hl)
+			or	e
+			ld	d,d
+			ld	l,d
+			xor	a
+			ld	l,b
+			ld	e,c
+			sub	a
+			ld	(hl),63h
+			sbc	a,d
+			inc	sp
+			call	p,L4fde
+			xor	l
+			ld	a,28h
+			adc	a,f0h
+			sbc	a,e
+			ld	d,e
+			ld	a,h
+			ld	a,(hl)
+			ld	(hl),e
+			inc	sp
+			sbc	a,h
+			ld	hl,5a1fh
+			inc	h
+			ld	sp,8a80h
+			ld	e,a
+			dec	hl
+			sbc	a,a
+			jp	m,L213a
+			ld	(hl),l
+			ld	e,h
+			jr	L8131
+			db	4eh,aah,afh,0bh,d7h,e2h,7ah,86h
+			db	deh,3ch
+			and	eeh
+			jp	(hl)
+			db	5ah
+			inc	l
+			nop (2x) *
+			dec	de
+			and	a
+			or	l
+			ld	(hl),dbh
+			jr	nz,L815d
+			and	e
+			ld	(4254h),hl
+			ld	de,d205h
+			cp	b
+			ld	b,(hl)
+			inc	b
+			ld	h,(hl)
+			dec	d
+			inc	de
+			ld	sp,hl
+			dec	bc
+			add	hl,sp
+			ex	af,af'
+			add	hl,bc
+			adc	a,d
+			xor	d
+			ld	d,a
+			ld	h,(hl)
+			ld	b,l
+			ex	af,af'
+			jr	nc,L81e3
+			xor	a
+			ld	a,h
+			ld	e,b
+			xor	(hl)
+			or	d
+			sbc	a,e
+			ld	a,(hl)
+			xor	e
+			ld	e,d
+			and	d
+			sbc	a,l
+			daa
+			ld	h,(hl)
+			di
+			jr	nz,L820e
+			jp	m,L851f
+			ld	(hl),e
+			add	a,h
+			ld	bc,e606h
+			ld	b,e
+			ld	e,b
+			ld	a,a
+			nop
+			ld	h,d
+			adc	a,d
+			ld	c,b
+			or	d
+			call	nz,Ld399
+			ld	(bc),a
+			rst	18h
+			inc	sp
+			daa
+			dec	l
+			sub	l
+			ccf
+			ld	h,(hl)
+			cp	e
+			pop	af
+			scf
+			ld	e,d
+			dec	h
+			xor	c
+			ld	a,94h
+			or	b
+			ld	l,c
+			ld	h,a
+			ret	m
+			pop	de
+			ex	de,hl
+			xor	b
+			sub	19h
+			ret
+			db	fah,83h,2ah,88h,1eh,b2h,beh,7dh
+			db	87h,04h,31h,26h,f9h,6fh,0fh,f0h
+			db	19h,87h,7dh,8bh
+			sub	(hl)
+			ret	nc
+			jr	nc,L81c5
+			ld	e,5bh
+			adc	a,d8h
+			ld	hl,(d165h)
+			or	a3h
+			jr	c,L8221
+			rla
+			ld	h,l
+			xor	b
+			call	m,L482a
+			sbc	a,a
+			dec	c
+			ret	m
+			add	a,h
+			ld	d,d
+			xor	h
+			call	pe,Ld790
+			ld	b,34h
+			ld	e,a
+			nop (2x) *
+			ld	a,(bc)
+			add	a,e
+			ret	z
+			ret	m
+			dec	h
+			ld	d,61h
+			ld	l,a
+			adc	a,e
+			ld	(hl),e
+			daa
+			cp	a
+			call	c,L4801
+			dec	b
+			inc	a
+			add	a,e
+			inc	de
+			ld	h,h
+			or	d
+			add	a,d
+			xor	(hl)
+			ld	b,a
+			ret	c
+			ld	de,3d27h
+			dec	l
+			ld	c,(hl)
+			pop	af
+			sbc	a,d
+			cp	b
+			jp	z,L8683
+			jp	pe,Lac35
+			ld	h,l
+			ld	b,(hl)
+			ld	(ecdch),a
+			ld	d,(hl)
+			add	a,b
+			ccf
+			ld	c,(hl)
+			ld	a,h
+			ld	b,l
+			jp	z,L8c83
+			call	Ld284
+			inc	b
+			add	a,(hl)
+			ret	nz
+			ld	(hl),a
+			jp	(hl)
+			db	bch,76h,4bh,aah,fdh,44h,2ah,c5h
+			db	0bh,59h,30h,98h,87h,dbh,57h,57h
+			db	5ch
+			ld	a,c
+			ld	a,l
+			nop
+			add	a,d3h
+			adc	a,e
+			ld	d,e
+			ld	e,(hl)
+			ld	de,1bafh
+			ld	b,l
+			adc	a,c
+			ld	a,c
+			call	c,Le953
+			and	b
+			add	a,d
+			add	a,c
+			or	(hl)
+			ld	(hl),c
+			dec	de
+			ld	a,e
+			ld	l,l
+			and	b
+			ld	e,a
+			call	nc,Lb9b9
+			ld	c,l
+			ld	e,d
+			ld	a,(hl)
+			ld	bc,86afh
+			ex	af,af'
+			ld	(hl),e
+			djnz	L82c1
+			xor	(hl)
+			rst	20h
+			ld	b,l
+			ld	h,b
+			and	78h
+			dec	hl
+			ld	(hl),e6h
+			and	62h
+			daa
+			ld	d,(hl)
+			ld	a,e
+			ld	(hl),l
+			pop	hl
+			ld	a,c
+			or	d
+			halt
+			cp	(hl)
+			call	pe,L212a
+			ld	e,h
+			inc	b
+			ld	c,h
+			add	hl,bc
+			ld	bc,6a90h
+			ld	l,b
+			ei
+			add	hl,bc
+			push	de
+			jp	(hl)
+			db	d2h,c3h,77h,d1h,fch,37h,26h,0fh
+			db	09h,60h,c1h,1eh,42h,3ch,72h,01h
+			db	6ah,12h,feh,85h,bch,01h,ebh,24h
+			db	51h,36h,e6h,2ch,89h,20h,f4h,7ah
+			db	9ah,0fh
+			ld	h,a
+			inc	l
+			ld	b,h
+			ld	b,b
+			ld	(hl),b
+			sub	(hl)
+			ld	(hl),l
+			xor	a
+			ld	bc,ca70h
+			ld	h,c
+			ld	(26beh),a
+			dec	c
+			or	1ah
+			ex	de,hl
+			add	hl,sp
+			ret	nz
+			ld	(de),a
+			sbc	a,l
+			and	c
+			rla
+			ex	af,af'
+			adc	a,e
+			sbc	a,15h
+			ld	l,(hl)
+			nop
+			dec	hl
+			call	c,L6ed9
+			and	h
+			ld	e,(hl)
+			ld	h,(hl)
+			cp	h
+			push	af
+			jp	Lb43f
+			db	1dh,6eh,f1h,a6h,f7h,17h,78h,c7h
+			db	d9h,c5h,7fh,29h,4bh,8ch,65h,07h
+			db	b5h,c4h,55h,e2h,c5h,65h,b4h,91h
+			db	e4h,82h,c4h,79h,f7h,9ah,80h,b8h
+			db	32h,72h,afh,c2h,66h,73h,54h,76h
+			db	7dh,87h,89h,7dh,3eh,a8h,33h,26h
+			db	7fh,7fh,09h,36h,80h,aeh
+			ex	(sp),hl
+			or	l
+			add	a,(hl)
+			ret	c
+			ex	de,hl
+			ld	(hl),c
+			dec	h
+			daa
+			ret	nz
+			rst	00h
+			push	bc
+			sub	b
+			ld	b,l
+			ret
+			db	3ah,6bh,ceh,09h,9ch,38h,cbh,20h
+			db	6bh,6dh,8eh,4ah,d7h,18h,79h,5bh
+			db	37h,66h,36h,cch,e6h,50h,c7h,b1h
+			db	c9h,0dh,39h,62h,2bh,fdh,76h,6fh
+			db	59h,a5h,c4h,8dh,75h,99h,77h,09h
+			db	43h,45h,6bh,55h,b9h,dfh,f5h,a0h
+			db	e2h,12h,57h,a5h,f6h,b5h,cah,bch
+			db	24h,23h,a5h,39h,8ch,5ch,77h,7ch
+			db	cdh,92h,a5h,81h,eah,84h,4dh,cah
+			db	abh,e6h,86h,d6h,0ah,eah,7eh,5ch
+			db	83h,27h,8ch,5dh,12h,cbh,1dh,eah
+			db	e6h,81h,79h,bah,4ah,7ah,d4h,abh
+			db	b2h,adh,c3h,cbh,60h,14h,0fh,f2h
+			db	11h,c5h,14h,a8h,cch,f0h,e5h,e9h
+			db	8ch,71h,61h,33h,aeh,c9h,fdh,0ah
+			db	43h,05h,79h,14h,aeh,65h,15h,9ah
+			db	f7h,b3h,efh,76h,65h,46h,29h,6dh
+			db	b0h,d2h,8eh,8fh,ffh,07h,75h,61h
+			db	f8h,aeh,c4h,74h,2fh,8fh,e3h,87h
+			db	26h,51h,58h,e2h,cfh,1ah,cfh,14h
+			db	7bh,d5h,95h,30h,9fh,86h,3ch,c3h
+			db	8eh,f0h,84h,9ah,d9h
+			rrca
+			ld	d,h
+			and	feh
+			xor	a
+			add	a,b
+			and	c
+			jp	L30aa
+			db	88h,37h,a0h,7bh,12h,1fh,65h,a1h
+			db	2bh,dbh,f9h,3bh,54h,33h,deh,1fh
+			db	a2h,ceh,06h,62h,c8h,50h,fbh,1eh
+			db	00h,a6h,2dh,4fh,2ch,17h,2bh,b7h
+			db	b1h,75h,2fh,29h,7dh,dfh,85h,b9h
+			db	d9h,1dh,90h,adh,adh,98h,7fh,aah
+			db	86h,a9h,a4h,27h,2ah,8fh,8fh,90h
+			db	70h,43h,38h,a2h,24h,8eh,83h,aah
+			db	c7h,a0h,05h,afh,e7h,1bh,ach,d9h
+			db	4dh,44h,99h,b7h,bbh,1eh,a4h,f8h
+			db	c0h,a6h,ech,7bh,bch,dfh,e2h,1fh
+			db	75h,d1h,02h,53h,32h,92h,15h,54h
+			db	4ch,c8h,2bh,f8h,1bh,5dh,94h,67h
+			db	a3h,31h,dah,3eh,53h,c7h,39h,b0h
+			db	69h,4ah,31h,bbh,1bh,5eh,25h,1ch
+			db	e2h,53h,4ah,d4h,25h,c7h,c5h,32h
+			db	64h,0eh,bbh,3ch,43h,09h,62h,b9h
+			db	05h,f7h,3bh,9eh,cfh,36h,5ch,e9h
+			db	00h,cfh
+			ld	b,e
+			cp	a
+			and	d
+			ld	(de),a
+			and	c
+			cp	88h
+			xor	b
+			rst	20h
+			adc	a,c1h
+			sbc	a,a
+			cp	l
+			or	e
+			exx
+			ld	b,a
+			sbc	a,0bh
+			ld	c,c
+			ld	e,49h
+			push	af
+			ld	c,47h
+			sbc	a,b
+			ld	l,(hl)
+			add	hl,sp
+			ld	(hl),dfh
+			adc	a,h
+			cp	b
+			ld	e,c
+			ld	a,(hl)
+			ld	e,a
+			dec	bc
+			ld	c,b
+			or	f0h
+			ccf
+			ld	h,h
+			sbc	a,b
+			inc	bc
+			or	l
+			ld	l,h
+			call	z,L5ebe
+			sub	bdh
+			rrca
+			ld	e,h
+			add	a,l
+			ld	h,l
+			cp	5ch
+			ld	d,c
+			dec	bc
+			or	e
+			cp	e2h
+			cp	l
+			ret	p
+			ei
+			ld	d,h
+			ccf
+			cpl
+			cp	34h
+			ld	a,d
+			call	Ldf9c
+			ld	c,d
+			xor	l
+			sub	l
+			pop	de
+			ld	h,(hl)
+			ret	po
+			ld	(d08bh),hl
+			cp	cfh
+			rlca
+			jp	po,L56cb
+			sub	26h
+			ld	hl,(de33h)
+			ld	bc,bf54h
+			ld	e,d
+			adc	a,(hl)
+			add	a,l
+			adc	a,l
+			rst	08h
+			ld	e,h
+			or	92h
+			ld	(4bf6h),a
+			adc	a,e
+			rst	08h
+			out	(97h),a
+			add	hl,de
+			and	e4h
+			ld	c,d
+			inc	h
+			ld	h,e
+			sbc	a,e9h
+			ld	c,c
+			jp	pe,Lbb60
+			rst	38h
+			cp	(hl)
+			sub	e
+			push	bc
+			sbc	a,(hl)
+			ld	h,e
+			sub	e
+			xor	a
+			push	af
+			sub	c
+			ld	h,d
+			jp	L426a
+			db	5ch,22h,53h,7bh,60h,9ch,fch,d0h
+			db	e3h,a7h,e8h,7eh,f3h,b5h,0fh,53h
+			db	0eh,4bh,17h,c7h,6eh,22h,e7h,41h
+			db	4bh,08h,60h,9ch,afh
+			sbc	a,b
+			cp	c
+			ld	d,l
+			jp	nz,Lc90a
+			jp	nz,Lc593
+			ei
+			ld	(hl),e
+			ld	h,d
+			jr	c,L8552
+			ld	a,(hl)
+			dec	hl
+			add	a,(hl)
+			ld	c,b
+			ld	(hl),c
+			ld	hl,(6c3ah)
+			inc	c
+			ld	a,(2dd9h)
+			inc	e
+			add	a,cch
+			ld	d,(hl)
+			ld	d,c
+			ld	(de),a
+			dec	l
+			inc	sp
+			ld	d,a
+			inc	c
+			daa
+			sbc	a,d
+			inc	hl
+			cpl
+			ld	b,b
+			rst	38h
+			ld	h,(hl)
+			ld	b,a
+			rst	00h
+			dec	a
+			ld	(8e84h),a
+			ld	(bc),a
+			ld	a,e
+			dec	(hl)
+			pop	hl
+			ret	m
+			ld	d,0bh
+			ld	b,1dh
+			ld	de,79e3h
+			in	a,(f4h)
+			ld	a,c
+			add	hl,sp
+			ld	d,e
+			call	po,L00f1
+			in	a,(6eh)
+			call	nz,L6c3f
+			adc	a,a
+			add	a,c
+			ccf
+			ld	b,62h
+			ld	c,l
+			ld	l,e
+			and	a
+			inc	sp
+			ld	a,h
+			ld	d,b3h
+			inc	hl
+			and	a
+			ex	af,af'
+			call	z,L164f
+			jr	nz,L8575
+			xor	b
+			ld	d,51h
+			ld	(hl),b
+			pop	af
+			ld	d,(hl)
+			jp	po,Ld7e0
+			ld	a,c
+			daa
+			sbc	a,a
+			ld	l,09h
+			or	(hl)
+			ld	e,b
+			call	c,L85a8
+			nop (2x) *
+			or	(hl)
+			push	bc
+			jr	nc,L852c
+			daa
+			ld	l,l
+			dec	hl
+			ld	hl,1fa5h
+			or	h
+			xor	e
+			ld	l,c
+			jp	c,Lc847
+			ex	af,af'
+			adc	a,b
+			jp	po,L290d
+			sub	f6h
+			call	po,L5ad6
+			xor	c
+			and	d
+			ld	c,c
+			call	nz,L851e
+			ld	d,c
+			jp	pe,L5738
+			sbc	a,d
+			push	hl
+			adc	a,c
+			ld	e,d
+			jp	m,L8944
+			cp	d
+			nop (2x) *
+			call	p,L85df
+			ld	l,e
+			sub	b
+			dec	d
+			ld	b,d
+			or	75h
+			ld	b,d
+			xor	a
+			ld	l,c
+			ld	h,(hl)
+			ld	c,b
+			set	2,b
+			add	a,h
+			ld	a,b
+			rra
+			ld	(hl),a
+			nop (2x) *
+			ld	d,2dh
+			dec	a
+			ld	a,h
+			inc	a
+			cp	e
+			nop
+			ex	af,af'
+			ld	h,c
+			call	L7fba
+			ld	d,(hl)
+			xor	(hl)
+			ld	h,c
+			dec	hl
+			rlca
+			add	a,l
+			ret	po
+			add	a,d
+			ld	d,a
+			ex	af,af'
+			ld	sp,a072h
+			ld	h,d
+			ld	a,d
+			ld	d,l
+			dec	c
+			ret	p
+			sub	l
+			jp	po,L6b27
+			and	h
+			ld	d,a
+			ld	h,(hl)
+			ld	(hl),l
+			ld	e,e
+			add	a,d
+			dec	hl
+			ld	(1af7h),a
+			sub	(hl)
+			cpl
+			rst	08h
+			ld	a,b
+			jp	po,Lc0d5
+			cpl
+			or	c
+			ex	(sp),hl
+			adc	a,5bh
+			ex	de,hl
+			rst	08h
+			ret	po
+			add	a,3ah
+			add	a,44h
+			add	hl,de
+			ld	b,d6h
+			jp	Le4d3
+			db	feh,cch,54h,78h,cfh,52h,48h,dbh
+			db	41h,c6h,2dh,77h,34h,6ah,2eh,86h
+			db	44h,fch,85h,a0h,b4h,f7h,a4h,a3h
+			db	ech,6dh,cdh,62h,d5h,15h,cfh,dah
+			db	cch,fdh,53h,13h,f2h,e7h,88h,35h
+			db	3dh,04h,59h,ech,aeh,d5h,40h,f7h
+			dec	b
+			out	(08h),a
+			add	a,(hl)
+			ld	a,h
+			inc	bc
+			cp	e4h
+			xor	h
+			ld	a,c
+			and	c
+			and	e
+			xor	03h
+			pop	de
+			or	l
+			or	l
+			ld	d,l
+			ld	e,h
+			and	52h
+			ld	(hl),e
+			pop	bc
+			or	(hl)
+			dec	c
+			ret	pe
+			ld	sp,caa1h
+			ld	bc,a746h
+			ld	l,c
+			call	pe,Lb2bf
+			ld	l,e
+			ret	p
+			ld	b,l
+			call	pe,L708b
+			ld	de,200ah
+			rst	38h
+			inc	h
+			xor	(hl)
+			rla
+			ld	a,d
+			inc	hl
+			ld	d,h
+			call	m,L1549
+			ld	de,f2a1h
+			ld	(hl),h
+			ld	c,h
+			jr	c,L86d8
+			add	a,c
+			ret	z
+			ld	b,(hl)
+			ld	e,9ah
+			ld	(hl),l
+			ld	bc,0ad0h
+			ret	c
+			cp	d
+			call	m,L30af
+			push	af
+			ld	b,h
+			ld	d,d
+			ld	l,(hl)
+			ld	a,l
+			sub	97h
+			ld	(hl),b
+			inc	h
+			rst	00h
+			sbc	a,0bh
+			ret	pe
+			jp	nc,L71f1
+			ld	c,c
+			ld	d,e
+			ret	nz
+			or	f6h
+			halt
+			ld	d,a
+			ld	a,l
+			jp	nc,L9a42
+			sub	a
+			ld	h,c
+			cp	d
+			call	c,Lf43e
+			ld	a,(de)
+			nop (2x) *
+			ld	(f051h),a
+			ld	(bc),a
+			out	(94h),a
+			ld	c,b
+			add	a,e
+			pop	hl
+			jr	c,L8648
+			sub	l
+			ld	l,5eh
+			add	a,h
+			or	h
+			djnz	L8693
+			ld	l,d
+			jr	c,L86e1
+			jp	z,La012
+			sbc	a,b
+			adc	a,b8h
+			ex	(sp),hl
+			inc	d
+			ld	l,d
+			cp	(hl)
+			ld	(hl),d
+			add	a,h
+			add	a,e
+			jr	z,L873a
+			ex	af,af'
+			ld	d,a
+			ld	b,h
+			add	a,(hl)
+			ld	h,h
+			sbc	a,h
+			ld	(bc),a
+			sbc	a,(hl)
+			ld	l,(hl)
+			ld	hl,7863h
+			ld	l,h
+			sub	3ch
+			inc	bc
+			xor	e
+			ld	h,c
+			ld	e,a
+			inc	d
+			ld	d,58h
+			xor	ach
+			rlca
+			jp	Lcf1c
+			db	cdh,b4h,22h,8dh,7eh
+			ld	e,a
+			call	pe,L5177
+			adc	a,a
+			adc	a,l
+			ld	(6fc3h),hl
+			set	3,(iy + 82)
+			ld	b,(hl)
+			ld	l,(hl)
+			xor	d
+			ld	b,l
+			dec	l
+			ld	(hl),b
+			ld	a,c
+			ld	c,c
+			inc	a
+			nop (2x) *
+			di
+			ld	a,h
+			nop
+			call	z,L8a76
+			inc	e
+			jp	Ladb2
+			db	9ch,4dh,1bh,51h,d4h,c1h
+			add	a,h
+			ld	e,c
+			ld	e,h
+			ld	c,b
+			sub	(hl)
+			dec	sp
+			rst	20h
+			ld	e,b
+			ld	d,a
+			or	c
+			inc	hl
+			and	d
+			ret	m
+			ld	a,a
+			and	l
+			and	e
+			sub	d
+			nop (2x) *
+			xor	a
+			or	56h
+			rst	00h
+			ld	e,(hl)
+			out	(e4h),a
+			dec	b
+			ld	a,(bc)
+			ld	a,(de)
+			adc	a,d
+			ld	l,e
+			dec	e
+			add	a,e
+			ld	h,e
+			or	l
+			ld	(hl),h
+			adc	a,d
+			cp	b
+			daa
+			dec	c
+			cp	e
+			ld	a,b
+			ld	h,(hl)
+			cp	c
+			sbc	a,d
+			ld	a,(bc)
+			ld	c,b
+			neg *
+			ld	e,h
+			ld	a,(bc)
+			sbc	a,e
+			ld	e,49h
+			im	1 *
+			xor	b
+			inc	l
+			add	a,d
+			ld	b,l
+			sub	b
+			add	a,(hl)
+			ld	sp,hl
+			ld	a,h
+			inc	h
+			call	po,L39a7
+			ld	d,66h
+			inc	l
+			dec	h
+			ld	hl,(809ch)
+			jp	(hl)
+			db	7ch,56h,63h,40h,13h,d9h,c8h,69h
+			db	51h,09h,43h,cch,1eh,ffh,e9h,c7h
+			db	bdh,55h,eeh,a3h,64h,1ah,cfh,02h
+			db	ach,c9h,94h,59h,5ah,3eh,5dh,94h
+			db	a4h,1ah,60h,c0h,adh,c0h,b5h,3ah
+			db	f5h,25h
+			ld	hl,(L410f)
+			jp	L08b5
+			db	62h,42h,d8h,54h,4eh,1eh,5ah,59h
+			db	ech,6ch,6bh,3ch,40h,6ah,38h,e9h
+			db	71h,95h,bah,ffh,e0h,edh,f5h,62h
+			db	0bh,4ch,31h,a5h,11h,f7h,31h,f7h
+			db	eah,3ah,0ch,07h,f0h,56h,d7h,66h
+			db	59h,5fh,7dh,b3h,66h,97h,edh,0bh
+			db	02h,8ah,3fh,5eh,6ah,f4h,55h,c5h
+			db	cbh,18h,fbh,71h,e1h,13h,f4h,2eh
+			db	68h,0ah,26h,91h,c6h,f6h,ddh,51h
+			db	74h,d5h,48h,e5h,78h,b4h,d3h,68h
+			db	87h,c6h,b9h,2eh,d5h,59h,b3h,6dh
+			db	62h,cbh,9ah,ech
+			ld	d,a
+			ld	l,a
+			dec	h
+			sub	c
+			ld	d,b
+			sbc	a,a
+			dec	sp
+			pop	af
+			jp	L7168
+			dec	l
+			ld	(hl),e
+			ld	l,c3h
+			ld	(hl),9fh
+			ld	d,e
+			and	e
+			ld	h,c
+			and	b
+			add	a,63h
+			ld	a,b
+			ld	c,l
+			xor	36h
+			ld	a,(hl)
+			jp	p,L3066
+			nop
+			call	nc,Lcb6b
+			xor	e
+			ld	b,a
+			or	(hl)
+			ei
+			pop	de
+			ret	nz
+			add	a,b
+			xor	a
+			push	bc
+			xor	(hl)
+			ld	c,h
+			xor	l
+			add	hl,de
+			push	af
+			cp	h
+			ld	a,abh
+			ld	(9f37h),a
+			dec	(hl)
+			add	a,a
+			ld	d,l
+			jp	c,L6bec
+			sub	(hl)
+			dec	b
+			add	a,a
+			cp	e
+			sbc	a,b
+			add	a,l
+			ld	bc,b3d1h
+			call	p,L0682
+			dec	a
+			ld	hl,a436h
+			ld	de,f5e3h
+			ld	h,91h
+			ld	c,(hl)
+			ret	z
+			ld	h,l
+			inc	b
+			set	5,b
+			rla
+			rst	28h
+			jr	z,L8803
+			ld	(hl),l
+			dec	de
+			inc	hl
+			ld	hl,(acbah)
+			ld	bc,16f4h
+			dec	h
+			ld	l,e
+			di
+			ex	(sp),hl
+			ld	a,b
+			ld	d,h
+			dec	sp
+			cp	b
+			ld	l,dah
+			push	af
+			inc	a
+			adc	a,e
+			or	e
+			ld	e,d
+			call	p,Lb9f4
+			dec	sp
+			dec	de
+			di
+			ld	l,l
+			ld	l,l
+			ld	sp,2b8eh
+			xor	(hl)
+			bit	3,a
+			dec	sp
+			sbc	a,h
+			jr	c,L8883
+			xor	b
+			ld	h,74h
+			jp	m,L4ca4
+			ret	p
+			adc	a,h
+			and	(hl)
+			sub	l
+			or	d
+			ld	l,l
+			sub	l
+			pop	de
+			push	bc
+			jp	L1d25
+			db	77h,aah,d0h,31h,e9h,4eh,6dh,06h
+			db	4eh,c4h,b8h,52h,f5h,0dh,e1h,cdh
+			db	cfh,d5h,4ch,1ch,6eh,28h,9ch,86h
+			db	94h,58h,6dh,89h,91h,b3h,b3h,f5h
+			db	8ah,8dh,0bh,24h,c7h,2fh,5eh,fbh
+			db	92h,c6h,8fh,31h,a6h,18h,0bh,12h
+			db	16h,8bh,e5h,94h,7ah,47h,22h,8dh
+			db	cah,0ch,bah,3eh,a6h,e7h,02h,92h
+			db	f6h,18h,03h,76h,edh,02h,e8h,02h
+			db	a2h,d4h,13h,16h,1eh,d0h,ddh,5eh
+			db	3ch,62h,69h,f6h,76h,6bh,28h,deh
+			db	74h,40h,f8h,5fh,54h,1dh,15h,7bh
+			jp	c,L0a6c
+			ld	e,d
+			call	po,L69ed
+			rst	38h
+			or	l
+			ld	e,b
+			and	e
+			push	hl
+			inc	bc
+			or	b
+			ld	a,d
+			exx
+			ld	a,(de)
+			or	c
+			sbc	a,e
+			dec	hl
+			rla
+			add	a,e
+			ld	l,69h
+			cp	a
+			dec	bc
+			jp	nc,L2bb0
+			jp	z,L660a
+			push	af
+			sub	h
+			exx
+			ld	de,79f2h
+			ld	b,d
+			ld	(3976h),a
+			adc	a,l
+			ld	d,b
+			ret	nz
+			nop (2x) *
+			add	a,e
+			ld	b,d
+			rla
+			ld	l,h
+			call	po,La222
+			ld	b,47h
+			and	74h
+			rst	30h
+			sub	c
+			ld	d,c
+			out	(70h),a
+			nop
+			ld	c,(hl)
+			jp	po,L84a6
+			ld	d,(hl)
+			sbc	a,l
+			jr	L88f2
+			db	15h,deh,81h,ach,d0h,94h,8fh,2ch
+			db	6dh,73h,67h
+			dec	bc
+			and	c
+			ret	nc
+			inc	(hl)
+			ccf
+			dec	l
+			ld	(hl),l
+			ei
+			pop	af
+			inc	d
+			dec	bc
+			ld	d,b
+			adc	a,h
+			ld	e,h
+			exx
+			ld	h,l
+			inc	d
+			ld	d,h
+			ld	a,b
+			inc	a
+			call	p,L57f9
+			add	a,e
+			pop	bc
+			and	l
+			nop
+			ld	b,(hl)
+			ld	d,c
+			dec	h
+			xor	d
+			dec	l
+			ld	l,39h
+			ld	e,(hl)
+			adc	a,b
+			pop	af
+			add	a,h
+			inc	l
+			push	bc
+			ld	h,(hl)
+			sbc	a,e
+			dec	(hl)
+			ld	l,(hl)
+			call	z,Le087
+			djnz	L896b
+			ld	c,b4h
+			sbc	a,l
+			or	b
+			ld	h,d
+			sbc	a,h
+			call	nz,L506d
+			and	h
+			sub	a
+			ld	d,c
+			ld	l,l
+			ld	l,d
+			sub	l
+			or	b
+			call	p,L50ea
+			sbc	a,a
+			call	p,L5f25
+			xor	e
+			ld	b,b
+			cp	c
+			ld	e,l
+			inc	c
+			ld	l,a
+			rst	18h
+			adc	a,c
+			ld	a,(d2c1h)
+			ld	h,(hl)
+			push	de
+			add	a,ach
+			jp	Led35
+			db	13h,38h,71h,4fh,6ch
+			ld	sp,hl
+			rst	30h
+			ld	a,(hl)
+			ld	(hl),l
+			sub	e
+			ld	(hl),a
+			ld	hl,(0845h)
+			xor	e
+			rst	00h
+			cp	2ch
+			ld	c,(hl)
+			inc	l
+			ld	h,ach
+			dec	a
+			dec	hl
+			jp	nz,L3929
+			inc	hl
+			call	nc,L38e2
+			ld	l,(hl)
+			scf
+			ld	d,a
+			or	c
+			ld	sp,hl
+			inc	d
+			rst	08h
+			inc	e
+			add	a,h
+			jp	(hl)
+			db	76h,1ch,e8h,d7h,cah,a5h,dbh,a5h
+			db	4eh,27h,a5h,62h,fdh,7eh,93h,e6h
+			db	a9h,cfh,6ch,02h,33h,6eh,38h,4fh
+			db	66h,72h,e1h,c2h,fbh,a7h,93h,d1h
+			db	dch,e8h,feh,aeh,a5h,aah,08h,6ah
+			db	2ch,c8h,2ah,90h,80h,10h,22h,41h
+			db	01h,e3h,09h,e9h,a8h,9eh,d7h,6bh
+			db	3eh,23h,6dh,b6h,34h,87h,8fh,bbh
+			db	3dh,0dh,d0h
+			ld	d,d
+			ld	b,72h
+			ld	b,h
+			dec	b
+			ld	a,c
+			ld	c,b
+			ld	(e18fh),a
+			xor	a
+			rrca
+			adc	a,d
+			ld	c,h
+			adc	a,d
+			di
+			ex	de,hl
+			add	hl,bc
+			ld	(e48bh),a
+			cp	a
+			ld	c,e
+			rst	08h
+			call	p,Ldb0a
+			ld	a,dch
+			inc	e
+			ld	e,a
+			or	e
+			ex	af,af'
+			ret	nc
+			sbc	a,d
+			di
+			dec	(hl)
+			adc	a,(hl)
+			jp	z,Lc94f
+			xor	(hl)
+			ld	a,l
+			ld	h,b
+			dec	sp
+			ld	h,3ch
+			ld	(hl),h
+			rst	18h
+			rla
+			inc	d
+			ex	de,hl
+			and	l
+			call	po,Lf43c
+			jp	po,L368a
+			adc	a,c
+			jp	nz,L991a
+			push	de
+			di
+			push	af
+			ld	(08d8h),a
+			cp	b
+			dec	e
+			scf
+			xor	c
+			ld	(hl),e
+			ei
+			jp	nc,L7dd1
+			or	h
+			ret	nz
+			ld	l,e
+			adc	a,a
+			sub	l
+			adc	a,h
+			ld	h,e
+			ld	de,415ch
+			halt
+			or	(hl)
+			adc	a,d
+			jp	nc,L6586
+			ld	a,(de)
+			dec	l
+			ld	c,h
+			ld	a,h
+			ld	l,c
+			ld	l,b
+			add	a,d
+			call	p,L652c
+			xor	98h
+			and	a
+			djnz	L8a0a
+			cp	b
+			ld	a,(hl)
+			jp	L2e0a
+			db	66h,51h,ebh,d9h
+			jp	L857c
+			db	75h,42h,7dh,10h,4fh,5fh,3bh,8eh
+			db	beh,2ah,c7h,a5h,a2h,cfh,fah,86h
+			db	eah,88h,74h,cbh,80h,53h,fch,bbh
+			db	3ch,14h,92h,9bh,33h,beh,b4h,5ah
+			db	b0h,6bh,f3h,8bh,0fh,deh,a2h,61h
+			db	90h,48h,83h,d4h,1bh,33h,8ch,82h
+			db	72h,e8h,06h,9eh,9fh,15h,d4h,4bh
+			db	dah,10h,25h,b5h,7ah,05h,18h,3ah
+			db	81h,2ah,52h,4ah,2eh,b9h,48h,75h
+			db	91h,96h,f9h,e1h,79h,64h,4dh,2dh
+			db	d3h,ffh,ffh,f7h,d6h,17h,c8h,b7h
+			rst	38h
+			rst	38h
+			xor	e
+			ld	d,h
+			ld	l,d
+			sbc	a,l
+			ld	d,d
+			dec	b
+			sbc	a,l
+			ld	(af58h),hl
+			call	m,L29c3
+			ld	d,h
+			xor	c
+			add	a,e
+			ld	c,45h
+			ret	c
+			adc	a,c
+			call	z,L7451
+			ld	e,h
+			ld	bc,e686h
+			call	po,L8da0
+			ld	(hl),d
+			pop	de
+			ld	c,l
+			dec	h
+			ld	e,c
+			dec	de
+			jp	L6841
+			db	a8h,58h,12h,42h,05h,03h,05h,edh
+			db	42h,c0h,3eh,94h,f7h,dbh,c9h,54h
+			db	76h,3ch,10h,03h,a7h,35h,87h,beh
+			db	68h,39h,05h,cfh,9bh,b5h,24h,64h
+			db	0dh,b0h,b4h,20h
+			ld	(hl),c
+			ld	c,e
+			adc	a,c
+			or	c
+			ld	a,11h
+			ld	a,(fda0h)
+			cp	(hl)
+			call	po,L3c13
+			sub	(hl)
+			inc	c
+			cp	d
+			nop
+			add	hl,sp
+			dec	a
+			ld	(3c07h),hl
+			nop (2x) *
+			call	po,L4eb3
+			ld	de,677eh
+			ld	d,b
+			nop (2x) *
+			cp	a
+			dec	e
+			ld	b,d
+			ld	h,e
+			jp	p,Lee23
+			push	de
+			halt
+			adc	a,9ah
+			ret
+			db	d7h,86h,48h,1eh,16h,7bh,fch,7bh
+			db	fdh,5ah,cdh,f8h,e6h,98h,1ah,96h
+			db	7dh,11h,a0h,c1h,c8h,82h,93h,3dh
+			sub	(hl)
+			ex	af,af'
+			or	beh
+			ld	a,(hl)
+			dec	d
+			inc	a
+			jp	po,L136f
+			jp	nz,L5661
+			xor	b
+			sub	c
+			ld	(hl),h
+			inc	bc
+			dec	h
+			dec	c
+			sbc	a,b
+			ld	(hl),d
+			call	nz,Lcae5
+			dec	de
+			ld	e,a
+			inc	de
+			ld	d,(hl)
+			dec	bc
+			ret	pe
+			nop (2x) *
+			ld	d,d
+			dec	bc
+			push	af
+			inc	e
+			ld	b,c
+			dec	de
+			xor	(hl)
+			jp	c,Le0c9
+			ret	m
+			ld	e,e
+			dec	c
+			dec	d
+			ret	z
+			ld	b,l
+			or	e
+			ld	(de),a
+			ld	d,h
+			or	h
+			scf
+			sbc	a,(hl)
+			ret
+			db	32h,48h,2eh,b3h,14h,efh,82h,d0h
+			db	34h,d4h,30h,d6h,53h,b0h,96h,03h
+			db	3eh,a3h,e7h,dfh,efh,f6h,d3h,bah
+			db	fbh
+			ld	c,l
+			add	a,h
+			ld	l,h
+			or	bdh
+			ld	h,21h
+			ld	c,l
+			adc	a,(hl)
+			ld	(hl),l
+			ld	(de),a
+			sub	a
+			xor	l
+			ld	d,a
+			ld	c,l
+			jp	m,L4718
+			pop	bc
+			ld	c,l
+			ld	a,(bc)
+			add	a,eeh
+			add	a,a
+			ld	d,deh
+			ex	(sp),hl
+			xor	d
+			call	z,L19e7
+			and	a
+			inc	c
+			ld	(hl),h
+			rst	08h
+			ld	e,h
+			add	a,9ch
+			ld	(bc),a
+			cp	l
+			push	hl
+			call	po,Lc38f
+			jr	nz,L8b7c
+			ld	a,(hl)
+			ld	l,c
+			dec	l
+			ret
+			db	9fh,56h,32h,4dh,46h,81h,d4h,ceh
+			db	9ch,cch,a7h,0fh,e6h
+			ld	a,91h
+			ld	h,b
+			jp	pe,L6b11
+			inc	h
+			ccf
+			sbc	a,h
+			sbc	a,a
+			ld	(6e09h),hl
+			push	de
+			and	a
+			xor	a
+			ld	h,(hl)
+			ld	e,(hl)
+			sub	d
+			jp	po,Lc0f8
+			push	bc
+			add	a,c
+			ld	d,e
+			ld	e,a
+			ld	c,b
+			jr	nz,L8bbb
+			cp	c
+			and	(hl)
+			xor	5ch
+			call	Laa32
+			ld	a,(de)
+			cp	e
+			jr	nc,L8c65
+			sub	e
+			sub	e
+			inc	hl
+			pop	bc
+			di
+			ld	a,(hl)
+			ret	nz
+			inc	c
+			dec	e
+			daa
+			jp	(hl)
+			db	20h,93h,79h,31h,91h,0dh,ceh,10h
+			db	01h,c7h,22h,d3h,e0h,53h,b2h,12h
+			db	34h,e1h,f3h,60h,09h,99h,56h,40h
+			db	a5h,97h,a5h,67h,49h,7eh
+			push	hl
+			ld	a,a
+			cp	h
+			ld	(a371h),a
+			rra
+			inc	b
+			sub	(hl)
+			ret
+			db	d9h,b3h,fdh,c6h,7eh,5bh,0eh,d1h
+			db	9eh,9ch,deh,e5h,c0h,c6h,a2h,10h
+			cp	e
+			nop (2x) *
+			or	8fh
+			and	h
+			ld	hl,386eh
+			sbc	a,a
+			ld	h,a
+			daa
+			cp	f4h
+			nop (2x) *
+			daa
+			sbc	a,l
+			ret
+			db	01h,8bh,24h,76h,fbh,51h,ech,99h
+			db	30h,d2h,b4h,0eh,eah
+			ld	a,a
+			and	(hl)
+			ld	a,5ah
+			rst	08h
+			halt
+			and	e
+			jr	L8ce7
+			db	bch,36h,60h,26h,44h,35h,4fh,8eh
+			db	06h,11h,64h,1dh,80h,f6h,b2h,9ah
+			db	ceh,29h,a4h,5dh,a6h,a7h,40h,33h
+			db	80h,c3h,43h,2ch,06h,b0h,cfh,c6h
+			db	bbh,15h,c5h,5eh,88h,86h,27h,79h
+			db	c6h,dah,9fh,c3h,47h,67h,edh,0ch
+			db	03h,1fh,1dh,fbh,a2h,0fh,23h,d5h
+			db	adh,6bh,2bh,e0h,4eh,a8h,58h,cah
+			db	f9h,b4h,b0h,e6h,77h,3bh,57h
+			adc	a,(hl)
+			add	a,(hl)
+			ld	l,d
+			ld	l,c
+			rra
+			ld	de,4363h
+			dec	de
+			push	de
+			sbc	a,(hl)
+			call	L1ba2
+			cp	a
+			ld	a,(de)
+			ld	e,(hl)
+			or	c
+			ld	h,d
+			ld	h,e
+			ld	(hl),e
+			ld	c,(hl)
+			ld	d,l
+			or	(hl)
+			xor	e
+			ld	e,l
+			add	a,l
+			cp	l
+			rra
+			sbc	a,(hl)
+			djnz	L8c87
+			ld	(de),a
+			ld	l,c
+			sbc	a,h
+			ld	a,a
+			rst	08h
+			adc	a,l
+			in	a,(f1h)
+			di
+			xor	h
+			call	nc,Ld227
+			rla
+			rst	10h
+			ret	nz
+			or	h
+			ld	c,e
+			ld	c,d
+			ld	c,l
+			dec	de
+			jp	L229f
+			db	9fh,0dh,6eh,71h,f4h,e6h,e5h,64h
+			db	37h,54h,c0h,0fh,dbh
+			ret	z
+			call	m,L1f46
+			rst	08h
+			sbc	a,d
+			ret	p
+			jr	L8d4d
+			db	5ah,2fh,ach,d9h,c4h,9eh,a9h,0ch
+			db	9fh,dch,dfh,b4h,a0h,a2h,49h,8ah
+			db	67h,10h,6ch,f2h,ebh,62h,6ch,dch
+			db	17h,33h,f0h,55h,19h,4fh,15h,0eh
+			db	4fh,ffh,87h,3fh,9ch,59h,d6h,feh
+			db	c8h,46h,9bh,b7h
+			inc	d
+			jr	L8cfa
+			db	61h
+			rla
+			ld	h,c
+			ld	b,c
+			add	a,(hl)
+			ld	h,l
+			adc	a,h
+			adc	a,b
+			rst	00h
+			rlca
+			ex	af,af'
+			sbc	a,h
+			ret	nz
+			ld	c,l
+			and	b
+			ld	a,(hl)
+			ld	l,1ch
+			ld	sp,e5ceh
+			rra
+			push	de
+			or	b
+			in	a,(4bh)
+			ld	e,h
+			ld	a,(2230h)
+			xor	e
+			inc	a
+			rst	18h
+			ld	b,d
+			rst	38h
+			ld	a,h
+			rla
+			ret
+			db	76h,b2h,aah,09h,fbh,f2h,34h,1dh
+			db	deh,93h,c3h,fdh,63h,2fh,f3h,51h
+			db	0ah,79h,0bh,5eh,6ah,60h,6ch,11h
+			db	efh,ach,1eh,58h,69h,8ch,96h,6bh
+			db	1eh,0ah,edh,6eh
+			and	h
+			ld	a,l
+			xor	e
+			jp	pe,L5f83
+			ld	c,e
+			call	nc,L2da1
+			rst	20h
+			dec	hl
+			push	bc
+			inc	hl
+			dec	b
+			ret	po
+			or	a
+			ld	c,00h
+			sbc	a,h
+			call	La980
+			ld	(a0d5h),a
+			xor	a
+			ld	h,32h
+			ld	c,d
+			ret	p
+			ld	l,b
+			ei
+			jp	m,L1efb
+			ret	pe
+			inc	d
+			inc	d
+			ld	b,h
+			jp	m,Lb9d7
+			dec	de
+			jp	(hl)
+			db	dch,09h
+			and	b
+			sub	l
+			ret	nc
+			ld	d,b
+			ld	a,l
+			ld	h,e
+			inc	e
+			ret	c
+			ccf
+			sbc	a,c
+			and	(hl)
+			in	a,(2bh)
+			ld	l,1fh
+			cp	60h
+			ld	l,(hl)
+			scf
+			jp	z,Lb82c
+			ld	d,c
+			cp	h
+			inc	a
+			dec	e
+			cpl
+			sub	e
+			add	hl,hl
+			rst	20h
+			adc	a,41h
+			ld	a,l
+			call	po,L50ff
+			jr	nz,L8dbb
+			out	(39h),a
+			ld	(06b6h),hl
+			sub	e
+			adc	a,f4h
+			ld	h,c1h
+			or	h
+			sbc	a,69h
+			sub	d
+			jr	z,L8da8
+			inc	c
+			sub	c
+			ld	l,c
+			add	hl,hl
+			ret	p
+			call	po,L5755
+			ld	de,c72bh
+			sub	e
+			rlca
+			ld	d,h
+			ld	a,(5dd1h)
+			ld	a,(ix + 0ah)
+			pop	bc
+			add	a,e
+			inc	de
+			sub	a4h
+			sbc	a,65h
+			inc	e
+			ld	d,e
+			ld	a,a
+			jr	L8e07
+			db	0ch,43h,f0h,51h,4dh,2ah,71h,e6h
+			db	6fh,c7h,97h
+			cp	l
+			ld	e,e
+			xor	c
+			add	a,a
+			ld	l,a
+			sub	d
+			add	ix,bc
+			call	Ldd7d
+			and	h
+			ld	(hl),e
+			adc	a,(hl)
+			dec	c
+			ex	de,hl
+			xor	b
+			pop	hl
+			ld	(hl),c
+			ret	p
+			ld	a,e
+			add	hl,bc
+			ld	l,c
+			inc	sp
+			adc	a,e
+			ld	c,e
+			call	m,Ladeb
+			call	pe,L70b4
+			ld	h,h
+			xor	c
+			ld	b,(hl)
+			adc	a,edh
+			dec	hl
+			ld	h,e
+			nop (2x) *
+			dec	l
+			and	e
+			rrca
+			rst	18h
+			nop (2x) *
+			ld	a,h
+			dec	c
+			ld	a,37h
+			ld	sp,4f95h
+			ld	e,e
+			jp	po,L0366
+			ld	e,b
+			inc	b
+			ld	e,d
+			and	e
+			or	1eh
+			jp	L4e58
+			db	1ch,feh,e7h,d5h,90h,49h,07h,ebh
+			call	z,L6a18
+			add	hl,bc
+			add	a,c
+			ld	hl,658dh
+			ld	(hl),a
+			dec	de
+			dec	hl
+			ld	(hl),h
+			ld	d,e
+			rst	28h
+			ld	l,e
+			inc	(hl)
+			add	a,a
+			sbc	a,d
+			ld	(bc),a
+			and	d
+			adc	a,(hl)
+			ld	l,64h
+			ld	(hl),l
+			ld	h,a
+			ld	a,(5dadh)
+			ld	a,53h
+			ld	h,aah
+			xor	h
+			daa
+			add	hl,bc
+			pop	hl
+			ld	(2b2fh),hl
+			and	c
+			sub	(hl)
+			ld	bc,f8ech
+			rst	10h
+			dec	sp
+			cpl
+			add	a,h
+			dec	l
+			rlca
+			ld	(hl),e
+			adc	a,h
+			xor	1bh
+			add	a,74h
+			ld	e,b
+			ld	b,d
+			rst	20h
+			ret	nz
+			ld	l,c
+			or	c
+			ld	a,(de)
+			dec	e
+			dec	hl
+			ld	c,(hl)
+			push	bc
+			ld	(hl),c6h
+			jp	nz,L235a
+			ld	d,(hl)
+			jp	pe,L549f
+			ld	b,h
+			sbc	a,7ch
+			rst	38h
+			xor	l
+			ret	nz
+			ld	(hl),c
+			ld	c,87h
+			xor	b
+			rst	18h
+			sbc	a,(hl)
+			or	e
+			sub	(hl)
+			sbc	a,l
+			xor	b
+			xor	l
+			inc	bc
+			or	d
+			sub	(hl)
+			dec	d
+			ld	h,(hl)
+			rrca
+			xor	(hl)
+			ld	(hl),b
+			sbc	a,c
+			ret	c
+			add	hl,hl
+			ld	a,c
+			or	e
+			ld	d,e4h
+			ld	h,l
+			ld	b,c
+			push	af
+			ld	b,(hl)
+			add	a,l
+			adc	a,h
+			ld	b,c
+			in	a,(beh)
+			ld	(hl),a
+			cp	(hl)
+			pop	de
+			ld	l,(hl)
+			nop
+			sub	d
+			sbc	a,06h
+			or	b
+			add	a,d
+			dec	hl
+			dec	sp
+			dec	a
+			ld	e,b
+			jp	p,L732b
+			ld	l,l
+			ret
+			db	8bh,7ch,9fh,19h,4ah,6dh,24h,0fh
+			db	fch,e1h,a1h,4eh,b8h,a6h,2ah,26h
+			db	0ah,55h,d5h,6eh,f8h,eeh
+			ld	e,e
+			ld	c,a
+			ret	z
+			or	d
+			jp	m,Lcd22
+			ld	l,d
+			sbc	a,h
+			inc	c
+			sbc	a,(hl)
+			ex	af,af'
+			cp	d
+			ld	(hl),e
+			ld	l,b
+			dec	hl
+			rlca
+			cp	c9h
+			ld	(hl),e
+			jp	p,Lab7d
+			cp	3fh
+			ld	h,c
+			call	nc,L7bda
+			ret	z
+			cp	e
+			nop (2x) *
+			ld	e,l
+			add	a,l
+			ld	hl,(0bcdh)
+			dec	c
+			scf
+			rlca
+			ld	h,d
+			rst	18h
+			add	a,a
+			pop	af
+			or	e
+			ld	(hl),a
+			adc	a,e
+			dec	sp
+			ld	hl,(7431h)
+			jp	p,L4742
+			or	d
+			rra
+			ld	d,a
+			ld	c,95h
+			call	z,L9c8d
+			ld	d,a
+			dec	bc
+			dec	sp
+			inc	(hl)
+			ld	(hl),e
+			rst	00h
+			halt
+			dec	b
+			call	p,L6630
+			cp	h
+			ld	(hl),90h
+			cp	c
+			ld	l,36h
+			ld	(hl),86h
+			ret	z
+			ld	b,c
+			ld	a,h
+			and	7ah
+			inc	c
+			jp	m,L5fa4
+			ld	c,61h
+			ld	hl,(cb88h)
+			ld	(de),a
+			ld	hl,f448h
+			sbc	a,a
+			ld	h,16h
+			xor	(hl)
+			xor	(hl)
+			cp	(hl)
+			ld	l,a7h
+			sub	c
+			sbc	a,a
+			nop
+			ld	h,(hl)
+			call	nc,Laff0
+			adc	a,e
+			ld	c,d
+			dec	(hl)
+			jr	L8f13
+			db	a9h,0fh,41h,38h,76h,9ch,3dh,4ah
+			db	bch,f2h,a3h,d7h,16h,8fh,7ah,afh
+			db	11h,6ch
+			ld	c,b
+			and	l
+			sbc	a,e
+			ld	a,cdh
+			ld	b,h
+			cpl
+			ld	c,c
+			ld	(hl),a
+			inc	c
+			rra
+			ld	e,b
+			sub	a
+			sub	e
+			jp	z,L9e24
+			ld	de,f85ch
+			ld	h,d
+			or	a
+			ld	(hl),c
+			ld	d,d
+			and	l
+			ld	de,fd8eh
+			sub	b2h
+			and	d
+			dec	c
+			ret	po
+			adc	a,d
+			add	a,e
+			add	a,b
+			call	m,L6061
+			ld	h,a
+			adc	a,d
+			ld	a,(bc)
+			adc	a,a
+			ld	sp,hl
+			inc	b
+			ld	(hl),e
+			inc	sp
+			call	po,Lda83
+			sub	b
+			and	(hl)
+			ld	e,h
+			cp	c
+			dec	(hl)
+			nop (2x) *
+			rst	10h
+			ld	h,d
+			out	(3bh),a
+			ld	(hl),c
+			adc	a,a
+			exx
+			call	m,Lcdfe
+			ld	a,(hl)
+			exx
+			and	e
+			ld	(hl),7dh
+			ld	b,c
+			ret	z
+			cp	a
+			inc	l
+			exx
+			ret	pe
+			ld	d,a
+			adc	a,d
+			adc	a,a
+			ld	e,c
+			sbc	a,l
+			ld	e,a
+			dec	b
+			ld	h,d
+			ld	e,d
+			ret	p
+			ld	b,(hl)
+			ld	l,d
+			ret	nc
+			inc	de
+			rst	00h
+			dec	l
+			dec	de
+			sub	(hl)
+			ld	d,h
+			ld	(hl),b
+			and	h
+			jp	m,L67a1
+			sub	(hl)
+			ld	a,d
+			rst	28h
+			ld	d,a
+			pop	bc
+			dec	c
+			ld	d,h
+			adc	a,b
+			ld	sp,8708h
+			rst	28h
+			xor	e
+			cpl
+			inc	a
+			ld	h,c
+			cpl
+			sub	09h
+			ld	d,h
+			ld	a,d
+			ld	c,c
+			jp	nc,L4050
+			daa
+			ld	c,b
+			adc	a,h
+			ld	(hl),ech
+			djnz	L8fee
+			cp	(hl)
+			ld	l,h
+			inc	de
+			rrca
+			cp	b
+			ld	l,b
+			jp	m,L4c27
+			rst	08h
+			ret
+			db	92h,5bh,52h,70h,a8h,59h,91h,a2h
+			db	0ch,c2h,abh,86h,51h,5ch,bdh,9ch
+			db	4dh,dch,a8h,a4h,26h,e4h,96h,22h
+			db	4bh,7bh,fah
+			add	hl,sp
+			jr	nc,L9086
+			sub	b
+			sbc	a,b
+			ld	b,e
+			call	p,L1281
+			ex	de,hl
+			call	po,L70ab
+			adc	a,e
+			and	a
+			ld	hl,e144h
+			xor	l
+			cpl
+			ld	b,h
+			inc	d
+			ld	a,(hl)
+			add	a,d
+			cp	c
+			cp	(hl)
+			ld	a,b
+			ld	(de),a
+			or	c
+			ld	e,feh
+			sub	h
+			sbc	a,(hl)
+			or	e
+			ld	(hl),e7h
+			di
+			xor	c
+			ret
+			db	b9h,7fh,98h,d7h,a2h,f3h,1bh,4dh
+			db	d8h,05h,3fh,91h,1ah,e4h,5fh,beh
+			db	43h,7ch,f3h,b0h,6bh,a0h,eah
+			call	m,L96d3
+			ex	af,af'
+			add	a,c
+			adc	a,b
+			jr	c,L90c3
+			ld	a,h
+			inc	bc
+			dec	l
+			cp	h
+			sub	b
+			or	a
+			rl	c
+			pop	af
+			ld	b,b
+			in	a,(c1h)
+			and	h
+			sub	d
+			ld	(bc),a
+			ld	a,(1a90h)
+			ld	e,fbh
+			ld	c,c
+			add	a,(hl)
+			cp	h
+			sbc	a,l
+			xor	(hl)
+			call	L6ece
+			sub	(hl)
+			push	hl
+			ld	e,b
+			ld	(hl),c
+			ld	(hl),d
+			ld	e,(hl)
+			ld	(hl),d
+			add	a,c
+			ld	(d1e7h),a
+			and	c
+			adc	a,l
+			nop (2x) *
+			rst	18h
+			xor	h
+			ld	b,d
+			ld	a,(hl)
+			jr	nc,L90fd
+			adc	a,(hl)
+			cp	d
+			xor	(hl)
+			pop	af
+			sbc	a,a
+			ld	h,(hl)
+			or	e
+			ret	pe
+			inc	e
+			ld	h,e
+			add	a,b
+			rst	18h
+			ld	b,h
+			sbc	a,(hl)
+			add	a,(hl)
+			sub	h
+			adc	a,7dh
+			push	de
+			ld	h,b
+			sbc	a,h
+			rst	10h
+			rlca
+			and	(hl)
+			ld	bc,849eh
+			ld	hl,8351h
+			ccf
+			adc	a,d
+			rst	08h
+			cp	e
+			ld	a,d
+			ld	(hl),h
+			jr	z,L90e8
+			ld	d,l
+			ret	nz
+			cp	b
+			dec	(hl)
+			ld	e,c
+			or	c
+			ld	(hl),c
+			inc	d
+			rst	00h
+			ld	(hl),h
+			xor	d
+			sub	(ix + 93h)
+			in	a,(78h)
+			call	L2278
+			rst	18h
+			ld	e,d
+			ld	d,d
+			rlca
+			pop	de
+			rst	00h
+			ld	a,b
+			adc	a,c
+			jr	nz,L9119
+			ld	b,0bh
+			ld	a,b
+			dec	d
+			ld	a,c
+			dec	l
+			ld	c,b
+			ld	h,a
+			adc	a,e
+			ld	l,d
+			dec	l
+			ld	hl,23b4h
+			ld	c,b6h
+			dec	a
+			or	07h
+			exx
+			sbc	a,d
+			add	a,l
+			dec	bc
+			ld	a,22h
+			ld	e,e
+			xor	h
+			rst	18h
+			sub	(hl)
+			inc	c
+			ld	(bc),a
+			inc	l
+			inc	d
+			ld	(bc),a
+			cp	8eh
+			ei
+			pop	bc
+			daa
+			add	a,c
+			ld	b,h
+			dec	e
+			or	l
+			add	a,e
+			cp	e
+			dec	bc
+			ret
+			db	00h,b7h,47h,52h,cah,9ch,53h,64h
+			db	5bh,5eh,82h,68h,24h,28h,71h,4bh
+			db	91h,9eh,0fh,31h,d0h,cch,53h,0ah
+			db	c7h,93h,43h,bdh,a0h,ceh,0bh,62h
+			db	f0h,feh,e7h,8ah,93h,7ah,43h,74h
+			db	65h,05h,12h,dbh,57h,bdh,d5h,1bh
+			db	e7h,0bh,6dh,8fh,23h,c8h,b0h,5eh
+			db	9ah,6ch,b3h,94h,9eh,d4h,01h,52h
+			db	7dh,6ah,06h,83h,bdh,9eh,e6h,08h
+			db	0fh,4fh,49h,98h,f8h,51h,12h,1dh
+			db	aah,72h,e4h,99h,8bh,d7h,d0h,c4h
+			db	23h,3fh,32h,0dh,d2h,43h,e2h,54h
+			db	a4h,85h,b6h,adh,09h,e5h,08h,edh
+			db	eah,13h,e0h,57h,ceh,11h,ceh,abh
+			db	65h,4ch,ech,0bh,53h,24h,53h,aeh
+			db	75h,78h,53h,44h,17h,bah,09h,b2h
+			db	52h,2bh,9eh,e2h,d8h,85h,fbh,d7h
+			db	69h,6ch,f0h,cbh,3eh,2fh,f7h,a8h
+			db	aeh,2dh,fbh,94h,56h,55h,19h,05h
+			db	e2h,dah,1dh
+			rla
+			sbc	a,l
+			ld	l,h
+			xor	e
+			inc	(hl)
+			ld	(hl),c
+			xor	h
+			ld	d,0ch
+			ld	h,d
+			call	p,Ldcf8
+			dec	c
+			ld	(hl),c
+			ld	l,a
+			and	d
+			ld	(a4feh),a
+			out	(99h),a
+			add	hl,bc
+			ld	c,l
+			ld	a,l
+			cp	(hl)
+			jp	L30df
+			db	54h,aeh,34h,74h,9fh,97h,65h,6ah
+			db	a9h,74h,6bh,bah,81h,2bh,3fh,beh
+			db	7dh,f7h,b9h,a6h,5fh,85h,d8h,f6h
+			db	08h,a2h,ddh,d1h,10h,e2h,43h,35h
+			db	1ch,70h,86h,34h,eeh,6fh,fch,28h
+			db	f6h,ebh,2eh,89h,e8h,ceh,ech,47h
+			db	26h,bah,f4h,fdh,58h,06h,a2h,6eh
+			db	8dh,3fh,0eh,8eh,3ch,3ch,31h,12h
+			db	49h,99h,73h,65h,f0h,6dh,d4h,93h
+			db	2fh,c5h,5ch,bah,0ch,46h,5ah,dbh
+			db	68h,9dh,feh,0fh,bch,b9h,84h,71h
+			db	f9h,0eh,89h,09h,4bh,b2h
+			ld	c,a
+			sub	h
+			in	a,(9bh)
+			ld	h,b
+			ld	l,b
+			sbc	a,10h
+			nop (2x) *
+			add	a,e
+			rst	18h
+			and	h
+			ld	(hl),a
+			sbc	a,h
+			ld	a,d
+			rst	28h
+			ld	(hl),c
+			ld	h,1ah
+			exx
+			sub	b
+			ld	c,l
+			call	m,L8e2a
+			ld	e,a
+			push	af
+			adc	a,e
+			jr	L9253
+			db	73h,fch,b1h,b3h,48h,e2h,adh,14h
+			db	adh,e2h,73h,a4h,96h,39h,f4h,00h
+			db	8eh,1dh,b3h,e7h,aeh,89h,6eh,98h
+			db	19h,7bh,40h,6bh,28h,0bh,b2h,c2h
+			db	31h,73h,6ah,37h,feh,fbh,64h,30h
+			db	4ch,86h,0bh,38h,76h,a9h,43h,efh
+			db	1fh,53h,aeh,3fh,4bh,83h,d4h,77h
+			db	bfh,0ah,7fh,d5h,b1h,68h,5eh,4bh
+			db	eeh,adh,5ch,4dh,adh,c7h,d9h,ceh
+			db	72h,a1h,08h,0bh,0dh,cch,84h,d8h
+			db	d7h,41h,b6h,48h,c3h,90h,54h,8ah
+			db	c9h,f2h,58h,79h,38h,9dh,69h,6eh
+			db	8ch,49h,12h,87h,01h,0fh,8ah,53h
+			db	cbh,8dh,5eh
+			ld	c,h
+			and	a
+			ld	b,a
+			jp	(hl)
+			db	a3h,f1h,6ah,d7h,79h,46h,d5h,59h
+			db	4fh,56h,b2h,44h,34h,eah,66h,12h
+			db	82h,43h,b8h,e6h,91h,6ch,f3h,5dh
+			db	10h,a4h,2ah,4ch,bch,9bh,20h,43h
+			db	bbh,cfh,85h,14h,77h,7ah,6bh,d3h
+			db	d2h,cdh,ach,4dh,28h,69h,d0h,56h
+			db	35h,f8h,10h,b5h,78h,0fh,6dh
+			exx
+			nop (2x) *
+			ld	e,b
+			ld	d,c
+			rst	00h
+			rst	08h
+			nop
+			xor	e
+			ld	c,l
+			ld	sp,90d1h
+			ld	(hl),d
+			ld	d,h
+			or	e
+			cp	h
+			ld	b,l
+			jp	po,L4ad3
+			ld	(hl),c
+			jr	L939d
+			db	9dh,6eh,a8h,b9h,bbh,90h,6ch,e7h
+			db	28h,b1h,1fh,61h,cfh,41h,edh,8fh
+			db	cch,6dh,06h,63h,ebh,22h,ach,2bh
+			db	2bh,69h,02h,a6h,f5h,bfh,61h,5bh
+			db	46h,58h,d6h,92h
+			xor	d
+			out	(37h),a
+			ld	a,h
+			jp	nc,L1229
+			ld	d,c
+			ld	b,b
+			add	hl,hl
+			ld	c,b
+			ld	a,(hl)
+			ld	a,h
+			ex	af,af'
+			ld	c,a
+			sub	a
+			ccf
+			adc	a,l
+			pop	hl
+			ld	bc,bea3h
+			or	d
+			ld	l,dah
+			pop	af
+			sbc	hl,bc
+			adc	a,h
+			ld	l,80h
+			cp	97h
+			dec	d
+			dec	l
+			jr	L930a
+			db	0ch,9ah,1fh,63h,41h,61h,bch,bch
+			db	eah,37h
+			ret	po
+			ld	a,e
+			adc	a,e9h
+			ld	b,(hl)
+			ld	c,(hl)
+			call	p,L6442
+			sub	a
+			inc	d
+			ld	a,(hl)
+			ld	c,ddh
+			ld	e,h
+			cp	a
+			ex	de,hl
+			ld	d,a3h
+			sbc	a,b
+			dec	(hl)
+			dec	h
+			ld	b,c
+			ld	(75f2h),hl
+			inc	h
+			ld	e,d
+			sub	c0h
+			cp	d
+			and	a
+			pop	bc
+			ld	(bc),a
+			and	e
+			rst	00h
+			ld	(444bh),hl
+			ld	(hl),e
+			dec	c
+			jp	z,L7320
+			jr	nz,L93c4
+			xor	e
+			ld	a,a
+			xor	b
+			sub	d
+			ld	e,l
+			call	m,Ld9ec
+			ld	d,c
+			ld	a,5eh
+			jp	m,L9e21
+			ld	b,fch
+			adc	a,c
+			ld	b,a
+			jp	po,L982a
+			ld	h,e
+			pop	hl
+			daa
+			ld	e,b
+			sbc	a,b7h
+			ld	d,h
+			xor	h
+			rst	30h
+			and	h
+			rlca
+			ret	nc
+			ld	c,b
+			dec	bc
+			ld	d,b
+			dec	d
+			jp	z,Lcf8a
+			call	p,L3bad
+			or	c
+			ld	c,e
+			or	l
+			ret	nz
+			ld	c,c
+			or	l
+			push	af
+			ld	a,(2822h)
+			xor	feh
+			ex	de,hl
+			call	po,L1033
+			jr	c,L93e2
+			ret	z
+			dec	de
+			ld	b,d
+			inc	b
+			ld	h,e
+			ld	c,d
+			sub	a
+			rst	20h
+			add	a,h
+			ld	(hl),c
+			ld	c,c
+			dec	bc
+			add	hl,sp
+			cp	a
+			jp	(hl)
+			db	f2h,56h,58h,d5h,f1h,2fh,45h,97h
+			db	7ah,16h,97h,f9h,67h,fbh,46h,96h
+			db	06h,bch,97h,49h,31h,58h,02h,bdh
+			db	86h,2fh,c3h,00h,36h,15h,78h,91h
+			db	40h,0dh,63h,f8h,9ch,deh,f2h,46h
+			db	a7h,39h,b2h,07h,7ah,85h,5fh,d9h
+			db	95h,61h
+			inc	d
+			sbc	a,(hl)
+			rst	10h
+			ld	c,a
+			and	e
+			ld	sp,9a2ch
+			ld	d,h
+			sub	h
+			pop	hl
+			sbc	a,b
+			ld	bc,3bffh
+			ld	sp,9c0ah
+			inc	(hl)
+			call	z,L3f04
+			ld	(hl),b
+			ld	(de),a
+			ret	nz
+			jr	nc,L94a5
+			add	a,64h
+			sub	d3h
+			rst	08h
+			add	a,b
+			rst	28h
+			inc	sp
+			ld	h,d
+			ld	(bc),a
+			or	(hl)
+			res	1,a
+			ld	a,(bc)
+			sub	d
+			inc	de
+			rla
+			jp	nz,L1c92
+			and	2ah
+			ld	b,40h
+			jp	(hl)
+			db	a6h,d6h,36h,8ch,28h,f7h,a5h,9fh
+			db	c5h,1dh,25h,6dh,17h,7bh,a4h,0eh
+			db	8eh,6dh,54h,dch,5eh,1ch,c0h,edh
+			db	81h,47h
+			ld	a,(fba7h)
+			cp	e
+			or	h
+			ld	(hl),d
+			rst	18h
+			dec	(hl)
+			jp	m,Lf5ca
+			adc	a,d
+			jr	nz,L9488
+			ld	c,c
+			cp	1bh
+			dec	(hl)
+			rla
+			ld	c,h
+			ld	c,(hl)
+			ld	c,e
+			ret	z
+			inc	h
+			adc	a,h
+			ld	d,85h
+			add	a,fah
+			and	a
+			or	l
+			inc	c
+			or	e
+			call	L4ba4
+			ld	c,28h
+			ld	h,h
+			or	(hl)
+			ld	a,h
+			and	e
+			ld	a,l
+			ld	a,c
+			dec	hl
+			dec	e
+			dec	hl
+			dec	sp
+			xor	e
+			ld	l,a
+			ld	h,b
+			dec	(hl)
+			cp	(hl)
+			inc	h
+			ld	h,c
+			ld	b,(hl)
+			jr	nc,L948f
+			cp	d
+			ld	h,e
+			call	L3e85
+			djnz	L9439
+			call	nz,L3491
+			ex	(sp),hl
+			jp	pe,L7f5a
+			call	L0bd4
+			call	Lb6db
+			ld	l,a
+			ld	l,b
+			and	(hl)
+			rst	30h
+			sbc	a,l
+			rst	18h
+			dec	h
+			rst	18h
+			jp	p,L9656
+			call	p,Lea71
+			ld	a,(hl)
+			rrca
+			inc	h
+			ld	l,b
+			xor	4ah
+			sub	(hl)
+			daa
+			and	h
+			bit	2,c
+			dec	sp
+			adc	a,e
+			ld	(hl),l
+			ld	a,d
+			rla
+			rlca
+			call	L240b
+			ld	d,d
+			add	hl,bc
+			ld	(hl),d
+			sub	d
+			pop	hl
+			ld	d,d
+			dec	e
+			pop	de
+			call	z,L0461
+			ret	z
+			ld	l,a
+			and	b
+			adc	a,(hl)
+			ld	de,1d54h
+			ld	d,h
+			ld	b,cfh
+			ld	a,(30dah)
+			xor	b
+			sbc	a,80h
+			cp	c
+			ld	(hl),e
+			call	pe,L1015
+			rst	18h
+			xor	l
+			ld	h,l
+			ld	a,a
+			ld	b,d
+			ld	e,e
+			and	a
+			sbc	a,b
+			sub	(hl)
+			ld	d,b
+			ld	sp,9078h
+			and	h
+			nop (2x) *
+			dec	(hl)
+			and	b
+			ld	l,h
+			inc	d
+			jp	nc,L9a44
+			inc	a
+			or	e
+			ld	(hl),b
+			and	l
+			add	a,d
+			or	d
+			ld	l,b
+			sub	c
+			ld	b,b
+			ld	b,b
+			ld	l,d
+			ld	a,l
+			adc	a,l
+			ld	(hl),e0h
+			sub	(hl)
+			ld	e,b
+			rst	10h
+			call	c,Lcc8a
+			cp	d
+			sbc	a,b
+			ld	h,(hl)
+			and	e
+			halt
+			ld	de,3698h
+			rst	20h
+			adc	a,e3h
+			ld	(1f62h),a
+			ld	d,h
+			ld	e,l
+			ld	d,h
+			jp	z,L8d18
+			daa
+			jp	c,La467
+			ld	(bc),a
+			ld	h,h
+			sbc	a,b
+			sbc	a,h
+			ld	l,d
+			jp	nz,L1952
+			cp	c
+			ret	p
+			and	a
+			sub	l
+			dec	d
+			ex	af,af'
+			ld	c,l
+			ld	e,a
+			ld	(hl),h
+			ld	c,f3h
+			dec	d
+			cp	(hl)
+			ld	b,h
+			sub	a
+			xor	(hl)
+			ret	i *
+			scf
+			sbc	a,b
+			cp	d
+			rst	20h
+			ld	h,c
+			ld	d,d
+			ex	(sp),hl
+			ld	e,e
+			ld	l,e
+			xor	h
+			xor	b
+			adc	a,84h
+			adc	a,l
+			pop	bc
+			dec	bc
+			inc	l
+			ld	e,9ah
+			ld	a,l
+			ld	b,a
+			nop
+			sbc	a,b
+			and	h
+			sbc	a,e
+			rst	00h
+			ld	h,d
+			cp	l
+			halt
+			ld	h,a
+			ld	a,c
+			ld	(hl),d
+			jr	nz,L95bc
+			ld	sp,hl
+			adc	a,08h
+			and	a
+			ld	e,h
+			dec	d
+			sbc	a,54h
+			ld	c,c
+			ld	a,h
+			ld	a,08h
+			add	a,(hl)
+			jp	pe,L323b
+			xor	l
+			or	c
+			inc	e
+			inc	bc
+			sbc	a,d
+			dec	sp
+			add	hl,hl
+			rst	10h
+			add	a,l
+			ld	l,a
+			rst	30h
+			sbc	a,b
+			rst	28h
+			ld	c,c
+			daa
+			ld	l,d
+			ld	c,d
+			ld	h,b
+			call	pe,L5fbe
+			add	hl,sp
+			call	Lb5f5
+			ld	b,b4h
+			call	L4450
+			add	a,ixh *
+			ret	m
+			rst	20h
+			add	a,l
+			add	hl,de
+			ld	a,c
+			xor	a
+			ld	c,c
+			call	pe,L8f52
+			pop	af
+			ret	pe
+			di
+			push	af
+			ld	b,c
+			ld	l,h
+			cp	36h
+			ld	h,h
+			ld	e,h
+			dec	l
+			ld	e,d
+			ld	(hl),e
+			jp	p,Lab0e
+			ld	(bc),a
+			ld	d,c
+			and	b
+			cp	h
+			rst	08h
+			ld	bc,572ah
+			ex	de,hl
+			ld	a,d
+			ld	a,(hl)
+			call	c,Lf5a5
+			dec	d
+			ld	sp,b6e4h
+			ld	c,l
+			sub	b
+			ld	(de),a
+			inc	sp
+			rst	18h
+			xor	c
+			ret	m
+			ld	h,d
+			rst	38h
+			rst	30h
+			adc	a,e
+			dec	c
+			cp	0ch
+			sub	b
+			ld	(de),a
+			inc	c
+			call	nc,L332a
+			and	l
+			adc	a,b
+			ld	a,c
+			cp	a
+			xor	b
+			cp	82h
+			inc	a
+			rst	18h
+			sbc	a,6fh
+			inc	de
+			rst	30h
+			pop	bc
+			dec	l
+			ei
+			jr	nc,L95db
+			ld	l,a
+			dec	de
+			or	c
+			ld	l,h
+			or	l
+			ld	l,49h
+			sub	e
+			sub	l
+			add	hl,bc
+			inc	h
+			add	hl,sp
+			sbc	a,c
+			out	(5dh),a
+			ld	a,d
+			sbc	a,ddh
+			ld	(hl),c
+			in	a,(2dh)
+			ld	(bc),a
+			ld	h,a
+			ld	b,c
+			ld	(hl),l
+			ld	b,l
+			res	5,a
+			ld	a,a
+			sub	(hl)
+			or	b
+			cp	c
+			dec	c
+			ret	z
+			rst	30h
+			dec	h
+			and	b
+			ld	b,d
+			ld	h,d
+			ld	a,e
+			ld	d,c
+			rla
+			rst	00h
+			add	hl,bc
+			ld	hl,(3683h)
+			nop
+			ld	(cae6h),hl
+			and	12h
+			ld	(hl),h
+			nop (2x) *
+			ld	d,l
+			ret	po
+			and	a
+			add	a,a
+			xor	b
+			ld	a,aeh
+			ld	(b97ch),hl
+			rst	20h
+			add	a,02h
+			in	a,(aeh)
+			jr	L9650
+			db	11h,f2h,74h,d1h,63h,d9h,d9h
+			call	nz,L3cd9
+			ld	e,(hl)
+			sbc	a,d
+			sub	b
+			inc	d
+			ld	l,c
+			jr	nc,L96c4
+			or	h
+			jp	p,L848f
+			adc	a,l
+			exx
+			pop	de
+			inc	b
+			inc	hl
+			adc	a,48h
+			adc	a,e
+			pop	af
+			ld	b,(hl)
+			in	a,(a5h)
+			call	nz,L555e
+			ld	b,b
+			cp	e
+			cp	l
+			rst	10h
+			add	a,a
+			inc	d
+			dec	e
+			ld	(de),a
+			out	(3ah),a
+			adc	a,d
+			ld	(de),a
+			and	l
+			add	hl,hl
+			rst	08h
+			jr	nc,L96a1
+			sbc	a,c
+			xor	a
+			ld	e,30h
+			ld	l,b
+			inc	hl
+			add	hl,de
+			dec	l
+			ld	(hl),b
+			ld	e,c5h
+			dec	bc
+			jp	po,L7d38
+			rst	08h
+			ld	a,c
+			rla
+			add	a,l
+			rst	08h
+			ld	l,l
+			jp	c,L9aa9
+			ld	a,c
+			ld	c,b
+			xor	a
+			sub	dfh
+			inc	h
+			xor	e
+			ld	a,e
+			inc	c
+			inc	l
+			jp	p,L1ef7
+			add	a,a
+			and	e
+			pop	bc
+			cp	(hl)
+			ld	e,c
+			ld	bc,460eh
+			inc	bc
+			call	pe,L2cb7
+			or	(hl)
+			sub	e3h
+			ret
+			db	f9h,cah,04h,29h,66h,ach,c1h,f1h
+			db	eeh,6ch,50h,e5h,96h,ech,83h,9bh
+			db	71h
+			dec	(hl)
+			rst	10h
+			ld	c,c
+			cp	ebh
+			jp	po,L4163
+			ld	h,c
+			ei
+			ld	c,c
+			sub	e
+			and	b8h
+			sbc	a,e
+			rst	10h
+			or	b
+			ld	c,(hl)
+			adc	a,h
+			ld	h,e
+			add	a,a
+			or	(hl)
+			ld	l,l
+			add	a,c
+			ld	l,l
+			ld	(hl),h
+			ld	l,b
+			ld	a,(hl)
+			adc	a,e
+			ld	(hl),3dh
+			rst	28h
+			sbc	a,l
+			inc	d
+			ld	a,(de)
+			ld	h,e1h
+			jp	(hl)
+			db	21h,24h,e3h,7fh,93h,b9h,deh,55h
+			db	c0h,deh,b3h,5bh,99h,53h,48h,0fh
+			db	cdh
+			ld	a,e
+			rst	00h
+			ret	z
+			jp	L2824
+			db	27h,dah,feh,64h,51h,2fh,1eh,79h
+			db	31h,51h,a0h,8fh,c7h,63h,5eh,9ch
+			db	b4h,27h,0eh,01h,9fh,cch,efh,1eh
+			db	a2h,29h,39h,fah,2ah,37h,a5h,17h
+			db	5eh,21h,58h,09h,45h
+			ld	c,l
+			adc	a,e
+			sub	c
+			ld	l,a
+			call	pe,Laa6f
+			ld	d,d
+			sbc	a,91h
+			adc	a,(hl)
+			jr	nz,L9772
+			inc	b
+			or	b
+			rla
+			cp	a
+			and	h
+			pop	de
+			ld	(hl),l
+			ld	e,c
+			scf
+			rst	00h
+			ld	hl,(a142h)
+			ret	m
+			dec	sp
+			ret	p
+			dec	(hl)
+			ld	(hl),l
+			cp	d
+			xor	(hl)
+			adc	a,c
+			ccf
+			ret	nc
+			sbc	a,c
+			jp	pe,L24af
+			ld	c,b
+			jp	nz,L2b68
+			ld	h,a
+			cp	ddh
+			jp	po,L1740
+			ld	c,d
+			ld	e,34h
+			call	po,Lfdb0
+			ret	m
+			cp	a
+			ld	l,a
+			ld	c,l
+			rlca
+			sbc	a,e
+			jp	m,La86e
+			jr	c,L96fb
+			jp	L3217
+			db	9fh,ffh,2ah,afh,49h,9bh
+			add	hl,sp
+			ld	e,h
+			ld	c,h
+			ld	h,5dh
+			xor	l
+			in	a,(e0h)
+			rrca
+			ld	d,(hl)
+			push	af
+			nop (2x) *
+			ld	c,d
+			ld	a,l
+			ex	de,hl
+			ld	h,l
+			dec	de
+			or	a
+			sbc	a,e
+			ld	e,l
+			and	cfh
+			pop	de
+			add	a,l
+			jp	p,L6e4b
+			ld	h,(hl)
+			or	a
+			adc	a,d
+			xor	b
+			jr	c,L972a
+			pop	bc
+			call	pe,La529
+			ld	a,e
+			and	7eh
+			inc	e
+			ld	hl,9b3ch
+			ld	hl,1ab2h
+			rra
+			ret	z
+			dec	(hl)
+			dec	hl
+			ld	c,e
+			inc	e
+			dec	(hl)
+			cp	h
+			adc	a,14h
+			ld	b,l
+			ex	af,af'
+			ld	e,(hl)
+			and	b
+			cp	(hl)
+			ei
+			ld	(bc),a
+			ld	h,b
+			xor	fch
+			push	hl
+			ld	l,l
+			call	L524a
+			sub	d
+			ex	af,af'
+			ld	c,a
+			ld	l,h
+			sub	l
+			nop (2x) *
+			call	pe,Lb179
+			xor	(hl)
+			call	c,L383c
+			add	a,53h
+			adc	a,h
+			add	a,(hl)
+			nop (2x) *
+			call	nz,L9efa
+			add	a,(hl)
+			dec	(hl)
+			rlca
+			ld	b,b
+			rra
+			xor	e
+			jr	z,L9772
+			ld	e,d
+			ld	c,h
+			dec	hl
+			ccf
+			dec	c
+			jp	pe,L3767
+			sub	h
+			ld	h,d
+			ex	de,hl
+			or	(hl)
+			inc	a
+			ld	a,l
+			xor	b
+			ld	a,(ix + 2ch)
+			adc	a,b
+			daa
+			ld	b,b
+			sbc	a,e
+			ld	(hl),a
+			sbc	a,(hl)
+			ld	(hl),a
+			ret	m
+			ld	a,b
+			push	de
+			ld	b,d
+			add	a,(hl)
+			or	h
+			nop
+			or	e
+			jr	nc,L97c1
+			ld	c,a
+			or	c
+			ret	nc
+			ld	c,h
+			adc	a,h
+			cp	a
+			pop	de
+			and	h
+			ld	l,d
+			sub	l
+			nop (2x) *
+			ld	b,a
+			call	c,L82e8
+			ld	e,c
+			xor	d
+			dec	de
+			ld	a,a
+			ld	hl,(77cfh)
+			ld	(hl),c
+			ld	(hl),l
+			rst	08h
+			ld	c,(hl)
+			add	a,b
+			sbc	a,d
+			jp	z,L45ef
+			ld	c,08h
+			ld	a,(bc)
+			ld	b,e
+			rst	18h
+			ld	e,l
+			and	d
+			jp	m,L025a
+			jr	nz,L97b9
+			xor	l
+			sbc	a,21h
+			ld	h,c
+			inc	bc
+			xor	(hl)
+			rla
+			ld	c,d
+			dec	hl
+			dec	e
+			pop	af
+			rst	38h
+			ld	(hl),d
+			ld	h,f1h
+			ld	h,(hl)
+			ld	e,b
+			dec	b
+			jr	z,L9827
+			jp	p,Lf4a2
+			ld	c,c
+			and	d
+			ld	b,h
+			inc	de
+			ld	sp,e575h
+			ld	b,e
+			or	d
+			dec	sp
+			rst	28h
+			rst	00h
+			ld	a,(ed1eh)
+			ld	de,27ddh
+			dec	c
+			dec	h
+			ld	c,b
+			cp	(hl)
+			rla
+			jr	nc,L981d
+			ret	pe
+			ld	d,d
+			ld	l,(hl)
+			xor	b
+			ld	d,b
+			ld	(6e24h),hl
+			rra
+			add	a,(hl)
+			ld	a,l
+			sbc	a,d
+			dec	l
+			ld	a,(de)
+			call	m,L215b
+			or	c
+			xor	8dh
+			sbc	a,c
+			call	p,L2388
+			adc	a,c
+			rst	00h
+			push	bc
+			jr	c,L983e
+			adc	a,e
+			ld	a,h
+			halt
+			sub	d
+			ret	i *
+			ld	a,(bc)
+			ld	b,d
+			dec	b
+			pop	hl
+			ld	l,l
+			ld	l,h
+			ld	e,a
+			ld	(hl),l
+			ld	a,l
+			xor	l
+			ld	d,l
+			rlca
+			ld	h,e
+			ld	d,b
+			or	h
+			sub	(hl)
+			xor	c
+			ld	d,d
+			ld	sp,f9f9h
+			jp	nc,L68cf
+			ld	e,l
+			xor	(hl)
+			ret	nc
+			xor	b
+			cp	l
+			jr	c,L9853
+			and	h
+			adc	a,c
+			dec	c
+			ld	(hl),h
+			jp	c,Lf663
+			or	b
+			ld	(bc),a
+			xor	a
+			ld	e,a6h
+			inc	de
+			jp	p,Lb54e
+			inc	a
+			pop	af
+			ld	d,a5h
+			pop	af
+			rlc	h
+			ld	d,l
+			ld	b,41h
+			push	de
+			or	a
+			cp	(hl)
+			ld	a,l
+			ld	a,l
+			jr	nz,L98c1
+			ld	a,(de)
+			ld	b,a
+			and	c
+			call	c,La96d
+			ld	e,l
+			ld	(de),a
+			inc	b
+			ld	e,d
+			cp	e
+			or	h
+			sub	l
+			push	hl
+			ld	(de),a
+			inc	sp
+			adc	a,h
+			ld	hl,(c7c2h)
+			ld	l,l
+			ld	b,d
+			xor	(hl)
+			ld	h,b
+			ld	sp,hl
+			ld	(hl),e
+			ld	b,(hl)
+			ld	c,a
+			ld	b,h
+			jr	nc,L989c
+			call	nc,Lad64
+			ld	(7103h),a
+			ret	p
+			ld	c,h
+			sub	e
+			pop	hl
+			and	(hl)
+			jp	nz,L9576
+			cpl
+			ld	l,d
+			or	e
+			xor	d
+			rla
+			ex	(sp),hl
+			sbc	a,c
+			ld	a,c
+			ld	e,a4h
+			ld	l,c
+			rst	30h
+			add	a,(hl)
+			cp	h
+			ret	pe
+			in	a,(67h)
+			ld	a,d
+			jp	L3ff6
+			db	48h,d4h,51h,56h,3dh,bch,cdh,eeh
+			db	b5h,75h,13h,99h,90h,f5h,55h
+			call	c,Lf145
+			jp	nc,L3159
+			ccf
+			dec	(hl)
+			rst	28h
+			sub	c
+			rst	18h
+			ret	po
+			sbc	a,h
+			ld	(hl),b
+			add	a,b
+			dec	e
+			jr	z,L994d
+			add	hl,de
+			ld	c,b
+			ld	(hl),88h
+			ld	a,(hl)
+			dec	l
+			jr	L990a
+			db	58h,33h,d0h,64h,17h,7bh,91h,06h
+			db	dfh,afh,b0h,35h,f8h,9ch,e3h,aah
+			db	6bh,ceh,5dh,3eh,71h,5bh,33h,40h
+			db	bbh,f8h,9dh,ddh,81h,20h,9eh,79h
+			db	edh,95h,66h,0bh,50h,44h,93h,8ch
+			db	0ah
+			ld	l,d
+			cp	b
+			dec	e
+			xor	deh
+			xor	a
+			ret	po
+			push	de
+			add	a,(hl)
+			ld	e,e
+			xor	49h
+			ld	h,e
+			ld	e,h
+			sub	a
+			inc	h
+			ld	a,d
+			inc	d
+			add	a,l
+			ld	(hl),l
+			inc	de
+			cpl
+			jp	z,Le845
+			ld	b,b
+			ld	b,(hl)
+			xor	l
+			jr	c,L98f5
+			ld	(ef65h),hl
+			jp	c,Lf14a
+			ret	nz
+			jp	nz,L03a4
+			ld	(hl),b
+			sub	l
+			dec	l
+			add	a,e
+			adc	a,a
+			inc	bc
+			and	h
+			jp	nz,L2968
+			or	d
+			jp	pe,Lf947
+			ld	a,e
+			dec	de
+			ld	(bc),a
+			ret	pe
+			inc	bc
+			inc	(hl)
+			inc	de
+			dec	bc
+			ret	pe
+			adc	a,01h
+			ld	d,(hl)
+			halt
+			push	af
+			ld	h,d
+			ld	c,a
+			ld	(hl),a
+			xor	e
+			rst	10h
+			cp	h
+			ld	c,(hl)
+			inc	l
+			ld	(hl),d
+			jp	p,Le06b
+			add	hl,hl
+			jr	nc,L9971
+			ex	de,hl
+			ld	b,c
+			adc	a,b
+			ex	de,hl
+			call	z,Lc7e6
+			ld	hl,fbbch
+			and	c
+			cp	d
+			ld	l,h
+			halt
+			adc	a,d
+			xor	e
+			add	a,e
+			push	hl
+			call	c,Ldbdf
+			add	hl,de
+			or	b
+			ret	m
+			ld	d,e
+			ld	h,c
+			in	a,(84h)
+			sbc	a,c
+			adc	a,a
+			ld	a,a
+			ld	c,91h
+			call	z,Lc25b
+			cp	c
+			ld	b,(hl)
+			call	p,L4338
+			xor	d
+			djnz	L9a27
+			ld	l,l
+			ld	a,(bc)
+			or	e
+			jr	z,L99e3
+			call	c,L6a21
+			sub	a
+			and	l
+			dec	b
+			call	po,Le689
+			ld	bc,05dfh
+			halt
+			ld	h,e
+			scf
+			out	(9fh),a
+			or	l
+			ld	sp,d059h
+			jr	nc,L9a58
+			ld	e,c
+			or	d
+			call	pe,Lc7fd
+			xor	b
+			ld	a,b
+			ld	a,(b95bh)
+			sub	l
+			rrca
+			ld	(hl),l
+			and	(hl)
+			sub	(hl)
+			jp	nz,L9d20
+			and	h
+			rst	38h
+			rst	20h
+			ret	pe
+			add	hl,bc
+			ld	d,(hl)
+			ld	l,a
+			sbc	a,c
+			ld	(b97ch),a
+			inc	c
+			push	hl
+			inc	bc
+			call	pe,Lfc8b
+			ld	l,d
+			add	a,b
+			call	c,Ld279
+			ld	(5f2ah),a
+			ld	c,b
+			ret	nz
+			inc	(hl)
+			call	nc,Lfd8e
+			jp	pe,Lfe85
+			ld	b,b
+			call	m,La673
+			add	a,e
+			ld	sp,hl
+			jp	p,Lc35d
+			add	a,d
+			sub	cah
+			ld	(48a1h),hl
+			ld	d,a
+			ld	l,h
+			add	a,a
+			add	a,c
+			push	de
+			xor	c
+			ld	a,e
+			ld	h,d
+			ld	c,d
+			xor	(hl)
+			jp	nz,Lbcce
+			cp	l
+			ex	af,af'
+			call	p,L28da
+			dec	a
+			jr	c,L9aa1
+			inc	(hl)
+			ret	c
+			cp	d
+			ld	(hl),b
+			and	b
+			ret	z
+			ld	c,d
+			ld	l,h
+			dec	hl
+			and	d
+			ld	l,a
+			ret	z
+			add	a,(hl)
+			cpl
+			sbc	a,e
+			ld	e,c
+			call	L21ec
+			cp	9bh
+			add	a,h
+			dec	sp
+			inc	hl
+			ld	a,c
+			ld	c,e
+			ld	(hl),l
+			ld	(hl),d
+			ld	a,e
+			ld	c,(hl)
+			sbc	a,h
+			ld	h,l
+			ld	(de),a
+			sbc	a,l
+			cp	(hl)
+			sbc	a,l
+			xor	(hl)
+			sub	l
+			adc	a,c
+			ld	b,c
+			jp	pe,L4828
+			add	a,l
+			ld	h,e
+			pop	af
+			ld	(hl),a
+			or	d
+			ld	l,e
+			ld	a,c
+			ret	po
+			ld	b,e
+			push	bc
+			halt
+			xor	a
+			ret	pe
+			jp	po,La650
+			ld	l,d
+			call	nz,L97d5
+			ret	m
+			or	51h
+			ex	af,af'
+			ld	(ba04h),hl
+			scf
+			add	a,b
+			adc	a,d
+			sbc	a,dbh
+			ld	d,b
+			inc	b
+			inc	hl
+			ld	(hl),b
+			ld	a,h
+			daa
+			ld	e,18h
+			ld	b,h
+			add	hl,hl
+			ld	c,l
+			rst	20h
+			ld	bc,93d1h
+			jr	L9a34
+			db	62h,45h,d4h,21h,80h
+			xor	a
+			sbc	a,a
+			or	(hl)
+			ret	po
+			add	a,28h
+			add	a,e
+			jp	p,L63ec
+			ld	d,h
+			call	pe,Lf793
+			adc	a,c
+			ld	b,(hl)
+			ld	c,e
+			ld	b,h
+			add	a,(hl)
+			ld	d,(iy + 31h)
+			ld	(hl),b
+			ld	c,l
+			pop	de
+			ld	sp,hl
+			push	bc
+			ld	d,(hl)
+			call	z,L0cc7
+			daa
+			adc	a,e
+			inc	l
+			jp	z,L38d0
+			ld	h,d
+			ex	de,hl
+			ld	c,l
+			adc	a,d
+			di
+			sub	a
+			or	l
+			inc	h
+			dec	de
+			xor	0fh
+			ld	a,(hl)
+			dec	e
+			ld	c,h
+			add	a,a
+			ld	b,l
+			or	(hl)
+			xor	l
+			pop	af
+			ld	a,d
+			ld	a,l
+			or	(hl)
+			dec	a
+			dec	b
+			adc	a,c
+			inc	hl
+			ld	l,a
+			jp	z,L5e9d
+			ld	d,13h
+			ld	(hl),aah
+			sub	b
+			rst	10h
+			cp	a
+			or	(hl)
+			sub	(hl)
+			sbc	a,a
+			and	(hl)
+			ld	d,e
+			sub	e
+			ld	e,(hl)
+			or	39h
+			xor	c
+			add	a,h
+			jp	nz,L9e35
+			add	a,h
+			ld	c,b
+			adc	a,a
+			ld	l,(hl)
+			ld	d,b
+			inc	l
+			jr	nc,L9ae4
+			ret	c
+			im	0 *
+			sub	a9h
+			ld	c,b
+			ld	d,h
+			ld	hl,561bh
+			and	h
+			jp	m,L0903
+			or	e
+			adc	a,(hl)
+			cp	e
+			ld	b,43h
+			ld	l,h
+			ld	a,(de)
+			ld	c,h
+			di
+			call	m,L2fc6
+			ld	h,h
+			xor	a
+			and	e
+			inc	b
+			rst	10h
+			sbc	a,h
+			jr	c,L9b5b
+			sub	a
+			dec	c
+			ccf
+			ld	l,a
+			dec	sp
+			ei
+			ld	b,b
+			dec	e
+			djnz	L9b9b
+			add	a,c
+			sub	l
+			ld	sp,afbch
+			ld	a,(hl)
+			ld	hl,(ae12h)
+			push	bc
+			ld	e,d
+			ld	(hl),b
+			jp	nc,Lfabf
+			cp	(hl)
+			ld	h,(hl)
+			ld	e,a
+			sub	h
+			sub	(hl)
+			di
+			inc	h
+			ld	a,d
+			ld	d,h
+			ld	b,a
+			call	po,Le817
+			ld	d,h
+			sub	d
+			sub	e
+			cp	e
+			ld	e,e
+			sbc	a,(hl)
+			push	de
+			ld	e,cfh
+			ld	c,b
+			inc	bc
+			rrca
+			adc	a,a
+			and	c
+			call	m,La2fc
+			ld	e,d
+			or	h
+			ld	l,h
+			and	c
+			dec	h
+			ld	(hl),l
+			xor	(hl)
+			inc	e
+			sub	h
+			in	a,(c1h)
+			add	hl,de
+			cp	l
+			jp	pe,L85aa
+			jr	z,L9b3f
+			ld	a,e
+			ld	l,h
+			ret	nc
+			pop	de
+			jp	m,L7d20
+			add	a,b
+			rst	00h
+			add	a,l
+			ret	pe
+			ret	m
+			cp	h
+			ld	h,l
+			dec	(hl)
+			call	nz,L710f
+			ld	e,c
+			nop (2x) *
+			or	e
+			ret	m
+			ld	e,l
+			rst	38h
+			jp	m,Lc010
+			ld	(hl),l
+			pop	hl
+			rrca
+			ld	c,l
+			ld	b,d
+			rst	38h
+			ret	p
+			nop (2x) *
+			add	a,d
+			ld	b,c
+			ld	d,68h
+			sbc	a,d
+			sbc	a,e
+			ld	l,h
+			ld	(hl),h
+			adc	a,e
+			ld	l,(hl)
+			sbc	a,(hl)
+			ld	l,d
+			ret	c
+			ld	a,(de)
+			and	b
+			ld	l,e
+			ld	e,(hl)
+			jp	nz,L30b0
+			dec	h
+			ld	(hl),a
+			ld	c,ixl *
+			ld	c,a
+			ld	a,b
+			sbc	a,a
+			dec	l
+			jr	nc,L9ba8
+			add	a,e6h
+			ei
+			cp	f4h
+			inc	(hl)
+			add	a,l
+			ld	(bc),a
+			rst	38h
+			inc	hl
+			inc	hl
+			dec	a
+			xor	e
+			ld	b,h
+			jr	nc,L9bfc
+			and	d
+			jp	z,L8c12
+			rst	00h
+			cp	d
+			dec	sp
+			sbc	a,h
+			and	a
+			and	h
+			ld	a,(hl)
+			ld	d,(hl)
+			ld	d,h
+			adc	a,d
+			cp	7eh
+			dec	de
+			ld	(hl),c
+			ld	a,(fb99h)
+			inc	(hl)
+			ld	l,d
+			ld	h,l
+			ld	h,7bh
+			daa
+			ld	b,h
+			ld	(d391h),a
+			add	hl,de
+			ld	h,d
+			ccf
+			sub	34h
+			or	a
+			rst	38h
+			res	6,(hl)
+			inc	h
+			di
+			inc	a
+			ld	c,e
+			ld	h,(hl)
+			ld	c,(hl)
+			bit	1,l
+			jr	nz,L9bab
+			or	(hl)
+			and	(hl)
+			cp	a
+			and	l
+			ld	e,b
+			ld	hl,e01ch
+			rst	10h
+			ld	a,(hl)
+			ld	d,e
+			ld	e,c
+			call	z,L0393
+			adc	a,l
+			ld	h,c
+			ld	(bc),a
+			sub	c
+			ld	(hl),c
+			add	a,(hl)
+			add	hl,hl
+			ld	c,h
+			inc	h
+			push	hl
+			add	a,h
+			rst	00h
+			adc	a,d8h
+			sub	(hl)
+			ld	a,e
+			cp	c
+			jp	p,Lc1a2
+			ld	a,h
+			cp	b
+			jr	nc,L9c08
+			adc	a,c
+			ex	af,af'
+			ld	e,h
+			ld	c,d
+			ret	z
+			rra
+			ld	d,7dh
+			sbc	a,l
+			add	hl,bc
+			in	a,(c2h)
+			xor	(hl)
+			pop	bc
+			nop
+			dec	sp
+			nop
+			dec	e
+			call	po,L4c2d
+			pop	af
+			inc	c
+			ld	c,h
+			push	af
+			di
+			inc	c
+			ld	l,d
+			inc	bc
+			rst	00h
+			ex	de,hl
+			rst	20h
+			inc	bc
+			ld	l,l
+			adc	a,a
+			ld	l,a
+			dec	d
+			rst	10h
+			or	h
+			add	a,a
+			xor	e
+			push	bc
+			ld	(hl),h
+			or	c
+			adc	a,e
+			xor	e
+			ld	h,l
+			dec	c
+			or	h
+			sbc	a,(hl)
+			ld	(e574h),a
+			ld	h,c
+			inc	(hl)
+			jp	(hl)
+			db	edh,e2h,98h,f8h,bdh,00h,2eh,5ch
+			db	21h,0bh,ebh,14h,71h,29h,f5h,57h
+			ld	(ix + f4h),e
+			dec	d
+			ld	(hl),c
+			xor	e
+			ld	e,a
+			exx
+			ld	d,e
+			ld	a,b
+			xor	e
+			add	a,d
+			ld	(b4fbh),hl
+			ld	b,c
+			jr	L9c97
+			db	a3h,58h,88h,0fh,92h,5ah,d1h,9bh
+			db	1dh
+			ld	b,e
+			jp	z,L9bfd
+			ld	(hl),33h
+			ld	a,a
+			ld	e,a
+			sbc	a,b
+			ld	d,e
+			ld	l,b
+			ex	af,af'
+			and	b
+			call	nz,Ld55b
+			adc	a,h
+			call	po,L28ef
+			adc	a,d
+			ld	h,c
+			ret	z
+			add	hl,sp
+			cp	(hl)
+			jp	z,L6c7d
+			ld	(bc),a
+			ld	h,b
+			ld	h,h
+			ld	sp,eecfh
+			call	pe,L7595
+			add	hl,sp
+			cp	a
+			adc	a,b
+			inc	de
+			ld	l,e
+			xor	d
+			jp	L0f5e
+			db	9fh,8dh,abh,7eh,4ch,2ch,4eh,91h
+			db	96h,b4h,78h,1eh,a4h,a7h,70h,28h
+			db	26h,53h,cdh
+			ld	b,66h
+			ld	d,d
+			ld	c,b
+			sub	c
+			ret	nc
+			jp	(hl)
+			db	27h
+			rst	30h
+			or	e
+			nop
+			sbc	a,c
+			add	hl,bc
+			dec	l
+			ld	b,(hl)
+			jp	po,Lef2c
+			cp	b
+			ld	c,l
+			and	ixl *
+			di
+			inc	a
+			ld	d,d
+			add	hl,de
+			jp	L8d9a
+			db	47h,7eh,3ch,8dh,66h,73h,0ch,f5h
+			db	c1h,85h,91h,a8h,9fh,bbh,0dh,b8h
+			db	3ah,9ch,78h,48h,68h,53h,c7h,c7h
+			db	59h,79h,0bh,25h,94h,ffh,48h,89h
+			db	6eh,48h,65h,d8h,05h,4ah,e5h,f6h
+			db	4eh,7bh,81h,e3h,a0h,e8h,72h,1ah
+			db	51h,92h,a1h,76h,94h,b0h,79h,deh
+			db	11h,b9h,17h,31h,28h,88h,75h,f7h
+			db	39h
+			ld	l,e
+			ld	h,a
+			dec	c
+			ld	d,c
+			adc	a,e
+			ld	h,a
+			add	a,l
+			cp	(hl)
+			ld	a,a
+			cp	69h
+			adc	a,(hl)
+			or	(hl)
+			jp	m,Lbcb0
+			ret	po
+			ld	d,b
+			sbc	a,c
+			cp	c
+			xor	l
+			ld	e,c
+			pop	hl
+			rst	38h
+			call	pe,L0da4
+			xor	ddh
+			add	a,c
+			ld	sp,d76fh
+			ld	l,h
+			rla
+			nop (2x) *
+			dec	hl
+			dec	hl
+			ld	l,(hl)
+			or	l
+			dec	hl
+			rst	10h
+			dec	sp
+			adc	a,l
+			ld	de,01d9h
+			ld	a,b
+			ld	a,(de)
+			sbc	a,d
+			daa
+			cp	b
+			or	bfh
+			or	d
+			sub	h
+			ld	c,h
+			add	a,l
+			ld	l,d
+			cp	b
+			halt
+			ld	sp,hl
+			sub	c
+			add	hl,hl
+			cp	00h
+			ld	(hl),d
+			call	p,L83dd
+			cp	b
+			ld	b,b
+			cp	a
+			ld	h,(hl)
+			ld	a,(bc)
+			or	93h
+			jp	c,L99ab
+			scf
+			push	bc
+			inc	bc
+			ld	bc,333dh
+			dec	h
+			inc	sp
+			ld	a,e
+			or	e
+			in	a,(56h)
+			or	77h
+			dec	de
+			ex	de,hl
+			nop (2x) *
+			call	po,Lc59e
+			ex	af,af'
+			xor	d
+			ld	c,l
+			ld	l,(hl)
+			jp	(hl)
+			db	24h,5ch,01h,2eh,2bh,29h,b3h,36h
+			db	46h,6dh,ceh,b4h,e6h,8ch,53h,36h
+			db	31h,b0h,20h,03h,feh,5bh,34h,1fh
+			db	7ch,68h,a8h,aeh,c4h,69h,89h,16h
+			db	85h,37h,e3h,39h,f1h,a6h,bch,ddh
+			db	c1h,96h,ebh,36h,dfh,feh,0ah,c9h
+			db	39h,a3h,4dh,a5h,6eh,bbh,6dh,22h
+			db	72h,6ah,b8h,23h,07h,75h,3fh,0bh
+			db	c5h,52h,50h,9ah,f6h,97h,94h,adh
+			db	26h,42h,d8h,6fh,d1h,04h,ech,0eh
+			db	03h,c0h,39h,72h,91h,b8h,edh,31h
+			db	8dh,64h,7bh,bdh,17h,f1h,37h,13h
+			db	50h,cah,b6h,d7h,3dh,70h,a4h,ach
+			db	62h,eeh,51h,47h,bfh,4ch,f5h,4dh
+			db	c2h,75h,b6h,56h,b0h,12h,cdh,bfh
+			db	eeh,85h,64h,91h,c9h,38h,d4h,c3h
+			db	02h,4ch,43h,07h,20h,cdh,efh,09h
+			db	28h,98h,c2h,43h,b7h,38h,89h,7dh
+			db	97h,3dh,32h,07h,8dh,c1h,7dh,afh
+			db	54h,45h,77h,93h,8eh,48h
+			and	(hl)
+			ld	a,d
+			jp	po,L541f
+			cp	(hl)
+			ret	z
+			rla
+			xor	(hl)
+			ld	(bc),a
+			ld	d,(hl)
+			sub	a
+			jp	m,L23c1
+			ld	e,d
+			ld	a,e
+			xor	c
+			ld	l,(hl)
+			jr	z,L9e5f
+			call	nc,L5e3e
+			ld	b,b
+			ld	b,e
+			sub	c
+			add	hl,hl
+			dec	de
+			sbc	a,c
+			ret	nc
+			ld	h,h
+			ld	l,(hl)
+			ld	(hl),a
+			ld	(hl),h
+			ld	d,05h
+			ld	e,l
+			ld	de,e0ffh
+			rrca
+			dec	h
+			dec	e
+			pop	bc
+			add	a,d9h
+			ld	a,(de)
+			and	a
+			or	(hl)
+			dec	(hl)
+			dec	e
+			pop	af
+			ld	a,(de)
+			pop	hl
+			dec	b
+			ld	e,8eh
+			ld	sp,hl
+			adc	a,e
+			ld	b,h
+			jp	p,Lae52
+			add	a,(hl)
+			ld	d,b
+			jp	Lf632
+			db	b8h,39h,b3h,2eh,79h,31h,04h,98h
+			db	24h,46h,efh,0bh,d4h,b1h,cfh,4eh
+			db	35h,99h,0fh,99h,66h,a7h,87h,7ch
+			db	1bh,67h,18h,99h,67h,80h,c3h,f3h
+			db	1eh,74h,00h,ebh,cdh,4fh,2fh,02h
+			db	d7h,44h,63h,92h,11h,2bh,4ah,0eh
+			db	63h,bbh,03h,6bh,cah,cbh,ebh,c6h
+			db	cdh,49h,e3h,f5h,efh,c0h,2ch,a7h
+			db	39h,f5h,59h,1eh,edh,42h,72h,f1h
+			db	5ch,d1h,f4h,9bh,7fh,66h,83h,98h
+			db	4ah
+			add	a,b
+			jp	(hl)
+			db	8bh,b8h,82h,a9h,fah,2bh,50h,1ch
+			db	9ah,ceh,11h,24h,0ah,5ah,5ah,19h
+			db	9bh,82h,38h,8ch,e5h,7ch,5ah,f6h
+			db	61h,8dh,ffh,38h,cah,dch,24h,77h
+			db	0fh,a1h
+			inc	bc
+			and	a
+			ld	l,6ch
+			adc	a,c
+			rst	18h
+			sub	a
+			ex	af,af'
+			call	c,L43ac
+			call	nc,Ldcd5
+			ld	a,2dh
+			sbc	a,a
+			daa
+			ld	a,a
+			or	e
+			push	hl
+			di
+			or	(hl)
+			sbc	a,h
+			or	(hl)
+			out	(19h),a
+			adc	a,(hl)
+			ret	p
+			or	h
+			ld	h,9fh
+			ld	d,13h
+			in	a,(c9h)
+			ld	e,d
+			ld	bc,3f21h
+			or	l
+			ld	l,b
+			rst	38h
+			inc	(hl)
+			and	b
+			ret
+			db	8bh,21h,05h,1dh,60h,08h,66h,33h
+			db	3ah,f7h,c8h,58h,e6h,4ch,56h,0ch
+			db	beh,a2h,1ah,b2h,20h,0eh,18h,b5h
+			db	27h
+			rla
+			ld	e,(hl)
+			ld	b,(hl)
+			rrca
+			add	a,d
+			jp	nc,L6d37
+			jr	nc,L9edb
+			dec	h
+			inc	b
+			and	l
+			ld	a,(bc)
+			ld	b,h
+			xor	(hl)
+			or	d
+			ld	h,a
+			ld	l,a
+			xor	(hl)
+			sbc	a,c
+			sbc	a,fah
+			ld	d,d
+			add	a,e
+			add	a,a
+			ld	d,h
+			ret	c
+			ld	hl,2c48h
+			ld	sp,a112h
+			cp	c
+			jr	nz,L9f24
+			ld	l,h
+			push	hl
+			ei
+			inc	c
+			xor	(hl)
+			rla
+			xor	l
+			adc	a,e
+			and	d
+			or	(hl)
+			inc	de
+			ld	a,40h
+			ld	(hl),a
+			ld	h,b
+			rra
+			ld	a,l
+			ret
+			db	c4h,0fh,50h,ebh,84h,06h,76h,12h
+			db	56h,97h,94h,4bh,74h,09h,11h,4ah
+			db	9ch,90h,bbh,00h,cdh,78h,5fh,31h
+			db	2dh,11h,20h,2eh,7eh,ebh,c9h,51h
+			db	03h,22h,28h,a4h,eah,9ah,dfh,c1h
+			db	1ah,ach,adh,6bh,55h,53h,2eh,e4h
+			db	cdh,c1h,a2h,2ch,d0h,62h,5fh,30h
+			db	87h,03h,bbh,4dh,b3h,dah,b9h,9dh
+			db	bbh,6dh,6ah,a1h,d2h,ddh,c1h,68h
+			db	1fh,49h,46h,08h,dfh,5ah,62h,52h
+			db	d9h
+			ld	e,e
+			dec	a
+			add	a,l
+			sub	b
+			xor	h
+			ld	c,e
+			xor	a
+			ret	pe
+			pop	hl
+			ld	h,h
+			ld	b,43h
+			ld	d,d
+			or	l
+			ld	(de),a
+			ld	d,b
+			jp	(hl)
+			db	4ah,99h,d8h,1ch,f3h,70h,c5h,bfh
+			db	6ah,73h,a3h,4ah,b3h,5fh,dah,09h
+			db	75h,10h,41h,b2h,1dh,3eh,d9h,e4h
+			db	abh,f0h
+			ld	d,e
+			ld	d,d
+			cpl
+			ret	nc
+			call	z,L2422
+			xor	08h
+			ld	(hl),c
+			ld	c,e3h
+			call	z,L0c0b
+			rst	10h
+			sub	a
+			ld	a,6fh
+			inc	e
+			sub	a
+			ld	a,d
+			ld	b,a
+			push	af
+			ld	hl,(cc35h)
+			ld	e,b
+			dec	d
+			or	(hl)
+			ld	d,e
+			rst	08h
+			ld	d,b
+			add	a,h
+			rst	10h
+			halt
+			dec	(hl)
+			ld	(hl),a
+			dec	sp
+			ld	(hl),26h
+			ld	(hl),a
+			ld	a,h
+			ld	h,h
+			set	4,(hl)
+			ld	l,(hl)
+			cp	l
+			ld	(hl),bbh
+			inc	sp
+			scf
+			adc	a,c
+			or	l
+			rla
+			ret	p
+			ld	a,(hl)
+			adc	a,l
+			ld	(c279h),hl
+			ld	l,l
+			dec	d
+			ld	e,c
+			sub	b
+			add	a,c
+			cp	l
+			cp	e
+			ld	sp,hl
+			xor	28h
+			or	(iy + 98h)
+			ld	(3fbeh),a
+			ld	(hl),e
+			jp	po,L7544
+			jp	pe,Lf8ea
+			inc	h
+			adc	a,(hl)
+			jp	L16e9
+			db	4fh,8dh,eah,6eh,56h,d0h,8eh,6bh
+			db	50h,efh,c3h,32h,89h,81h,8dh,90h
+			db	1dh,f5h,fah,05h,a5h,92h,8eh,12h
+			db	90h,88h
+			add	a,b
+			xor	(hl)
+			ld	e,d
+			ld	a,c6h
+			in	a,(42h)
+			ld	l,d
+			ld	b,c
+			ld	c,a
+			jp	nc,L39bb
+			rst	18h
+			add	a,d
+			jr	La062
+			db	0fh,f7h,6eh,7bh,60h,e7h,d9h,54h
+			db	6ch
+			ld	e,c
+			dec	e
+			add	a,c
+			ld	h,e
+			ld	b,c
+			push	hl
+			call	pe,L1a1b
+			jp	c,L2d1c
+			ld	(hl),h
+			dec	b
+			call	p,L8e52
+			cp	l
+			ret	c
+			and	h
+			di
+			ld	l,e
+			call	nz,L7b46
+			adc	a,a
+			and	(hl)
+			ld	d,b
+			dec	bc
+			rst	30h
+			dec	sp
+			and	(hl)
+			xor	a
+			jr	nz,La0c2
+			sbc	a,82h
+			ld	l,a
+			adc	a,d
+			jp	po,L59e8
+			ld	sp,f09eh
+			dec	b
+			ld	h,b
+			ld	d,d
+			ld	l,c
+			ld	h,e
+			ld	(hl),c
+			add	a,l
+			ld	c,d
+			inc	c
+			jp	pe,L6995
+			jp	L9f2a
+			db	99h
+			ld	(hl),b
+			ld	e,d
+			and	h
+			or	h
+			add	hl,bc
+			ld	c,(hl)
+			pop	bc
+			inc	bc
+			ld	b,h
+			pop	de
+			inc	a
+			ld	d,a
+			ld	sp,8d4ch
+			or	l
+			ld	e,d
+			rst	28h
+			adc	a,d3h
+			call	nc,L8948
+			ret	m
+			inc	b
+			push	bc
+			ld	c,b
+			dec	h
+			inc	a
+			and	l
+			or	71h
+			sub	h
+			add	a,d
+			inc	c
+			or	c
+			adc	a,b
+			ret	z
+			sbc	a,d
+			and	e
+			sbc	a,b
+			push	hl
+			sbc	a,b
+			ld	e,05h
+			and	l
+			push	af
+			ld	e,c
+			call	nz,L6583
+			ld	d,c
+			ret	c
+			ret	p
+			ld	b,cbh
+			ld	b,c
+			ld	a,(hl)
+			jr	La0c9
+			db	04h,8ch,b7h,4ah,12h,6dh,8eh,cah
+			db	29h,36h,17h,a9h,3eh,5eh,4bh,18h
+			db	79h,14h,00h
+			rla
+			ld	e,b
+			pop	hl
+			or	a
+			di
+			cp	h
+			sbc	a,e
+			ld	a,b
+			ld	h,(hl)
+			jr	nc,La0ee
+			rst	20h
+			adc	a,a
+			ld	c,b
+			ld	a,l
+			rla
+			sbc	a,l
+			add	a,5ch
+			pop	hl
+			ld	e,l
+			call	nc,L6b3a
+			ld	a,c
+			ex	(sp),hl
+			ld	b,e5h
+			jp	pe,L0877
+			ld	l,c
+			call	z,L315c
+			dec	hl
+			and	l
+			call	nc,L29a7
+			inc	l
+			rra
+			ld	e,h
+			scf
+			sbc	a,b
+			nop (2x) *
+			dec	b
+			ld	(bc),a
+			set	3,b
+			ld	d,h
+			ccf
+			add	a,l
+			ld	d,(hl)
+			dec	bc
+			ld	h,59h
+			rst	08h
+			dec	e
+			xor	d
+			ei
+			jp	z,Laa41
+			ld	e,e
+			adc	a,c
+			or	c
+			add	a,l
+			sbc	a,d
+			ld	(hl),a
+			cp	b
+			rrca
+			jr	z,La13c
+			call	pe,Le337
+			sub	e
+			ld	c,c
+			ld	c,d
+			adc	a,c
+			ld	(hl),c
+			ld	b,h
+			jr	nz,La16a
+			sub	e
+			ld	c,c
+			adc	a,c
+			adc	a,h
+			dec	hl
+			and	h
+			ld	a,(bc)
+			sub	c
+			ld	l,b
+			ld	h,5ah
+			daa
+			rst	10h
+			sbc	a,d
+			sbc	a,(hl)
+			ld	h,c
+			sub	d
+			inc	b
+			ld	hl,(f413h)
+			cp	h
+			ld	a,c7h
+			ld	c,d
+			call	Le7b1
+			ld	(hl),e
+			ld	l,a
+			xor	a
+			ld	d,c
+			or	h
+			jp	po,L2e6e
+			adc	a,(hl)
+			ld	h,d
+			or	15h
+			sbc	a,l
+			or	c
+			dec	e
+			ld	c,h
+			ret	nz
+			ei
+			ld	e,e
+			dec	de
+			ld	b,d
+			cp	d
+			ld	(1aadh),hl
+			ld	a,(de)
+			dec	sp
+			ld	a,h
+			jr	z,La1f5
+			inc	de
+			inc	a
+			dec	b
+			adc	a,29h
+			or	(hl)
+			add	hl,sp
+			ld	h,c
+			ld	(hl),c
+			ld	h,e
+			inc	d
+			and	b
+			ld	c,l
+			adc	a,h
+			sbc	a,h
+			inc	d
+			jp	z,L0543
+			cp	e
+			ret	pe
+			scf
+			adc	a,l
+			or	(hl)
+			jr	nz,La1f5
+			lddr
+			add	a,l
+			ld	c,c
+			ld	(hl),d
+			ld	h,(hl)
+			ld	(de),a
+			inc	bc
+			nop (2x) *
+			adc	a,e
+			ld	e,b
+			sub	a9h
+			exx
+			ld	l,67h
+			sub	a6h
+			add	hl,hl
+			ld	h,h
+			dec	a
+			or	b
+			xor	c
+			jp	Lb311
+			db	63h,30h,b4h,cch,c7h,18h,b6h,5ch
+			db	f7h,e0h,4ch,ffh,d4h,72h,68h,83h
+			db	a8h,a9h,6ch,4ah,43h,2eh,82h,dch
+			db	a5h,6fh,bch,f4h,76h,24h,44h,70h
+			db	90h,cdh,b7h,2ah,afh,39h,86h,e9h
+			db	0eh,8bh,88h,30h,3dh,21h,90h,d7h
+			db	1fh,c8h,8ch,15h,65h,e9h,bdh,33h
+			db	70h,8ah,43h,b1h,46h,ach,15h,30h
+			db	52h,bbh,bdh,e4h
+			rst	10h
+			ex	af,af'
+			ld	hl,(74c9h)
+			add	a,e
+			xor	h
+			push	de
+			ld	l,d
+			ld	d,d
+			ld	hl,(404fh)
+			ret	c
+			ld	h,d
+			daa
+			ld	(hl),l
+			ld	b,a
+			inc	e
+			xor	e
+			rst	38h
+			cp	h
+			ld	a,(de)
+			sub	l
+			or	d
+			adc	a,e
+			ex	(sp),hl
+			ld	l,6ch
+			add	hl,hl
+			inc	a
+			dec	a
+			ret	m
+			sbc	a,a
+			ld	d,84h
+			exx
+			ld	a,h
+			or	e
+			sbc	a,b
+			ld	(hl),e
+			rst	20h
+			ld	b,d
+			xor	l
+			cp	43h
+			dec	(hl)
+			or	h
+			or	c
+			sbc	a,h
+			xor	h
+			sub	a6h
+			ld	a,h
+			call	p,L1ebb
+			ld	l,a
+			ld	l,77h
+			ld	l,c
+			ld	b,e
+			adc	a,c
+			add	a,d
+			xor	a
+			adc	a,a
+			ld	b,(hl)
+			ld	d,h
+			ld	(hl),1fh
+			ld	de,f9deh
+			rst	28h
+			cp	l
+			or	a
+			ei
+			dec	hl
+			sub	(hl)
+			push	hl
+			ld	c,c
+			cp	dch
+			push	hl
+			ret	p
+			ld	e,l
+			dec	d
+			rst	10h
+			ld	(hl),a
+			djnz	La272
+			ld	h,h
+			jr	nz,La256
+			ld	c,d
+			ld	(c433h),hl
+			ld	(hl),e
+			and	d
+			call	po,L9cba
+			and	a
+			ld	a,d
+			ex	af,af'
+			ld	d,l
+			call	m,L46bb
+			ld	b,bdh
+			add	hl,bc
+			ld	bc,65e6h
+			adc	a,(hl)
+			ld	h,c
+			ld	d,l
+			call	po,Ld249
+			ld	l,e
+			ld	a,h
+			xor	h
+			push	af
+			ld	l,e
+			ld	b,l
+			add	a,a
+			ld	e,b
+			sub	a
+			adc	a,a
+			call	p,L6b2b
+			sub	b
+			dec	b
+			push	af
+			jp	p,L284b
+			ret	nc
+			or	e
+			jp	nz,Lc87f
+			ld	e,c
+			adc	a,l
+			add	hl,sp
+			dec	de
+			and	c
+			ld	h,a
+			add	a,l
+			jp	po,L02a4
+			ex	(sp),hl
+			adc	a,l
+			ret	z
+			inc	(hl)
+			dec	b
+			dec	(hl)
+			ld	l,a6h
+			ld	sp,8235h
+			ld	c,h
+			cpl
+			ret
+			db	40h,a3h,89h,d4h,afh,ebh,beh,7ch
+			db	04h,06h,97h,a0h,27h,dfh,45h,2ah
+			db	72h,ach,9bh,3bh,8eh,c9h,34h,f7h
+			db	d5h,b0h,e4h,4bh,26h,28h,abh,c1h
+			db	c5h,05h,d0h,5bh,7ch,c3h,04h,edh
+			db	f8h,36h,5dh,5ah,2eh,06h,4ch,57h
+			db	dfh,00h,71h,7fh,20h,1dh,cbh,3dh
+			db	32h,07h,98h,68h,97h,f3h,edh,81h
+			db	97h,7fh,39h,a0h,26h,2ah,59h,0eh
+			db	61h,40h,82h,d3h,6ch,73h,cdh,d4h
+			db	02h,1bh,5bh,99h,d2h,dch,49h,60h
+			db	29h,62h,beh
+			xor	90h
+			ld	c,c
+			adc	a,e
+			ex	af,af'
+			ld	b,h
+			cp	c
+			adc	a,a
+			cp	c
+			adc	a,c
+			and	(hl)
+			ld	d,(hl)
+			cp	a
+			ld	(hl),d
+			ld	l,(hl)
+			rla
+			jp	pe,L821f
+			ld	e,h
+			adc	a,b
+			ld	a,a
+			ld	(hl),a
+			adc	a,a
+			ld	l,d
+			scf
+			ex	(sp),hl
+			inc	h
+			add	hl,hl
+			djnz	La333
+			ld	(hl),e
+			cp	l
+			xor	l
+			ld	h,b
+			xor	d
+			and	e
+			ld	hl,(50a6h)
+			ld	c,l
+			sub	l
+			rst	28h
+			ld	c,bdh
+			and	l
+			xor	68h
+			ld	(hl),e
+			out	(a4h),a
+			halt
+			ld	b,h
+			ld	(ec66h),a
+			and	c
+			ld	c,e
+			jp	po,Lc22f
+			ld	c,e
+			ret	po
+			add	a,b
+			ld	a,e
+			adc	a,(hl)
+			add	a,h
+			dec	hl
+			dec	de
+			dec	hl
+			cp	c
+			add	a,a
+			dec	bc
+			rrca
+			ld	a,(hl)
+			halt
+			ld	e,(hl)
+			in	a,(43h)
+			sub	l
+			add	a,a
+			cp	(hl)
+			xor	a
+			sbc	a,(hl)
+			inc	bc
+			xor	(hl)
+			inc	h
+			ld	a,h
+			and	l
+			and	l
+			ld	d,a
+			add	a,d
+			xor	e
+			ld	d,d
+			and	a
+			ld	l,c
+			rst	00h
+			cp	b
+			ld	(hl),l
+			ld	(1d15h),a
+			adc	a,e
+			sbc	a,h
+			ld	de,9f78h
+			xor	c
+			ld	l,a
+			ret	z
+			ld	(hl),c
+			ld	l,h
+			ld	l,1fh
+			add	a,c
+			ld	c,8bh
+			and	d
+			ld	a,(bc)
+			ccf
+			and	b
+			cp	(hl)
+			inc	a
+			jp	L955b
+			db	f0h,eeh,09h,f3h,f3h,c3h,17h,4eh
+			db	fah,12h,5fh,81h,a9h,8fh,6ch,89h
+			db	24h,c7h,15h,70h
+			ld	(hl),a
+			ld	bc,9946h
+			push	af
+			ld	c,b
+			out	(8dh),a
+			ld	d,b
+			ld	h,a
+			add	a,e
+			ex	(sp),hl
+			cp	(hl)
+			ld	(hl),a
+			add	a,l
+			and	c
+			ld	e,b
+			ld	e,(hl)
+			ld	hl,fba0h
+			pop	af
+			ld	b,e
+			ld	(hl),cch
+			adc	a,b
+			inc	sp
+			inc	de
+			adc	a,h
+			inc	l
+			cp	h
+			adc	a,b
+			rst	20h
+			inc	l
+			jr	nc,La3db
+			ld	l,b1h
+			ld	h,b
+			add	a,f3h
+			or	d
+			sub	h
+			ld	l,l
+			or	e
+			adc	a,a
+			ld	a,d
+			exx
+			ld	c,b
+			or	d
+			cp	d
+			cp	h
+			rla
+			sbc	a,c
+			ld	c,(hl)
+			ld	(hl),h
+			ld	b,(hl)
+			and	(hl)
+			call	nc,L95cc
+			ret	z
+			xor	l
+			ld	a,h
+			pop	de
+			ret	c
+			call	p,Lf00a
+			sub	h
+			ld	c,c
+			nop
+			or	a
+			jp	z,L03fd
+			adc	a,a
+			ld	c,a
+			nop (2x) *
+			add	a,9ch
+			ld	bc,e4cch
+			jr	nc,La43e
+			rst	30h
+			rst	00h
+			dec	bc
+			inc	d
+			ld	(hl),c
+			pop	de
+			adc	a,95h
+			rst	18h
+			ld	h,d
+			ld	d,(hl)
+			ret	pe
+			ld	l,b
+			ld	b,e
+			jr	La38c
+			db	fbh,38h,d2h,66h,40h,b9h,36h,d0h
+			db	04h,1bh,30h,27h,f5h,b7h,48h,27h
+			db	f5h,aah,e6h,04h,18h,cch
+			bit	2,d
+			sub	e
+			inc	sp
+			ld	d,h
+			ld	e,a
+			ld	(hl),e
+			adc	a,b9h
+			ld	a,b
+			jp	z,L4f4c
+			ld	b,b
+			ld	a,(bc)
+			ld	(7114h),a
+			pop	hl
+			and	0bh
+			sbc	a,h
+			halt
+			jr	z,La3c8
+			inc	l
+			dec	b
+			ld	c,b
+			dec	bc
+			push	af
+			ret	nz
+			inc	de
+			nop (2x) *
+			xor	d
+			jp	m,L6535
+			jp	L6483
+			db	66h,ddh,bbh,81h
+			ld	de,d9b5h
+			cp	a
+			cp	a
+			and	c
+			ld	bc,36d4h
+			jp	nz,L2bc0
+			adc	a,a
+			sub	c
+			cp	a
+			or	70h
+			ld	(61f3h),a
+			sbc	a,h
+			ccf
+			ld	d,88h
+			rst	28h
+			inc	h
+			and	d
+			or	d
+			call	z,L141f
+			ret	nc
+			di
+			ret	nz
+			pop	af
+			jr	c,La435
+			add	hl,hl
+			ld	l,e
+			halt
+			jp	c,L2ef7
+			ld	e,a
+			dec	b
+			jp	L29fa
+			db	05h,a3h
+			ld	d,0fh
+			dec	sp
+			sub	c
+			cp	h
+			ld	a,l
+			ld	e,b
+			ld	d,e
+			jp	m,Lcb49
+			xor	b
+			ld	b,b
+			add	hl,bc
+			xor	h
+			rla
+			or	c
+			inc	bc
+			ex	(sp),hl
+			sub	d
+			ccf
+			rst	20h
+			ld	l,e
+			ld	(a852h),a
+			sub	b
+			jp	nc,L7129
+			cp	c
+			jr	nz,La4c4
+			adc	a,a
+			push	de
+			add	a,c
+			add	hl,de
+			jp	m,L210d
+			exx
+			sbc	a,l
+			and	c
+			inc	(hl)
+			call	p,L0866
+			dec	(hl)
+			ld	h,e
+			ld	l,l
+			inc	hl
+			jr	nc,La487
+			ld	(de),a
+			nop (2x) *
+			push	af
+			ld	c,c
+			xor	l
+			xor	l
+			ld	a,h
+			ld	sp,c7beh
+			sub	b
+			ld	de,4fdbh
+			ld	(de),a
+			and	b
+			ld	(hl),h
+			jr	c,La4c9
+			ld	a,c
+			rla
+			ld	hl,(b642h)
+			call	nc,L3fea
+			ret	z
+			push	bc
+			in	a,(6eh)
+			rla
+			sbc	a,a
+			adc	a,(hl)
+			jp	z,Lb4d0
+			ld	a,h
+			cp	b
+			ld	d,l
+			ld	e,d
+			ex	de,hl
+			sub	c
+			inc	sp
+			ld	d,d
+			pop	de
+			ld	b,b
+			rst	18h
+			ld	d,c
+			inc	bc
+			scf
+			ld	a,d
+			call	z,L481c
+			cp	e
+			jp	p,Lb629
+			ld	a,a
+			ld	h,b
+			ld	b,b
+			dec	(hl)
+			sub	d
+			ld	l,a
+			ld	(hl),b
+			and	c9h
+			rst	30h
+			ld	h,e
+			ld	c,e
+			sub	l
+			ld	e,l
+			rst	20h
+			ld	h,e
+			inc	(hl)
+			adc	a,79h
+			or	c
+			sbc	a,d
+			ld	a,h
+			halt
+			ret	pe
+			ld	d,e
+			ld	bc,7428h
+			or	a
+			ld	c,l
+			push	de
+			inc	sp
+			nop (2x) *
+			call	nz,Le997
+			or	c
+			inc	(hl)
+			ld	(hl),b
+			pop	de
+			or	d0h
+			jp	pe,L5a61
+			push	de
+			ld	c,b
+			cp	(hl)
+			ld	l,c
+			ld	bc,4dadh
+			ld	d,b
+			jp	L92cf
+			db	8dh,5fh,b8h
+			res	3,l
+			dec	hl
+			sbc	a,d
+			add	hl,bc
+			ld	l,b
+			sub	c
+			xor	l
+			halt
+			ld	h,e
+			ld	a,(hl)
+			cp	h
+			dec	e
+			dec	(hl)
+			xor	c
+			dec	l
+			jr	nz,La55a
+			and	d
+			ld	b,a
+			ld	d,cch
+			ld	a,d
+			jr	nc,La55d
+			ld	l,cch
+			or	l
+			inc	b
+			cpl
+			ld	e,e
+			ld	hl,7054h
+			jr	La596
+			db	a0h,03h,71h,3bh,10h,03h,ebh,78h
+			db	cah,8fh,a7h,16h,00h,01h,efh,a8h
+			db	ebh,33h,ffh,4ah,6fh,38h,55h,85h
+			db	02h,06h,83h,c0h,6eh,42h,bch,ffh
+			db	dah,ach,afh,84h
+			add	a,(hl)
+			inc	c
+			ld	l,b
+			ld	e,b
+			sbc	a,(hl)
+			jp	Lb364
+			db	7ch,62h,48h,76h,01h,56h,83h,a7h
+			db	ebh,41h,f3h,d2h,28h,3fh,f9h,d3h
+			db	4eh,16h,e0h,cdh,38h,1bh,c3h,6ah
+			db	99h,2ah,f5h,6ah,47h,aah,79h,95h
+			db	d9h,50h,45h,0fh,7ah,afh,65h,14h
+			db	ddh,58h,94h,6ch,f3h,98h,0eh,bdh
+			db	2ch,5ah,5eh,35h
+			sbc	a,b
+			or	c
+			sbc	a,l
+			dec	h
+			ret	z
+			ret	nz
+			sub	a
+			dec	b
+			dec	bc
+			ld	b,(hl)
+			ret	nz
+			ld	(hl),a
+			sub	h
+			xor	h
+			ld	l,88h
+			push	af
+			add	a,l
+			ld	(bc),a
+			ld	e,e
+			ret	p
+			rst	28h
+			sbc	a,e7h
+			ld	(hl),d
+			rst	28h
+			ld	h,b
+			ld	b,(hl)
+			inc	e
+			inc	b
+			inc	l
+			inc	de
+			add	a,d
+			ret	po
+			call	nc,L0f1d
+			rst	20h
+			jr	La5c8
+			db	52h,10h,96h,04h,e7h,15h,83h,1eh
+			db	36h,63h
+			sbc	a,h
+			inc	a
+			call	z,L58c3
+			jp	pe,L1c99
+			rst	08h
+			jr	c,La61e
+			call	po,L2ab3
+			ld	b,d
+			and	(hl)
+			jr	nz,La55a
+			ld	e,a
+			ld	h,(hl)
+			adc	a,d
+			dec	h
+			add	a,h
+			ld	b,ebh
+			pop	de
+			ex	de,hl
+			call	pe,L620e
+			and	h
+			or	a
+			cp	b
+			rrca
+			and	a
+			ld	l,h
+			ld	e,d
+			ld	c,(hl)
+			dec	c
+			cp	e
+			cp	c5h
+			call	L5249
+			rst	18h
+			ld	(hl),c
+			ld	e,c
+			ld	c,(hl)
+			sbc	a,c
+			push	de
+			or	l
+			jr	La62d
+			db	07h,56h,8fh,5eh,65h,27h,62h,f3h
+			db	02h,bbh,f4h,c9h,87h,22h,e6h,e5h
+			db	f5h,49h,f9h,7dh,bfh,eeh,47h,3ch
+			db	2ah,b4h,c5h,2ah,92h,edh,74h,6ah
+			rst	28h
+			sbc	a,49h
+			jr	La5f4
+			db	f6h,2ah,a0h,81h,7ah,35h,0dh,61h
+			db	6bh,5ah
+			ld	e,a
+			ld	l,l
+			and	b
+			ld	h,a
+			ld	e,(hl)
+			adc	a,b
+			ld	b,e
+			scf
+			inc	c
+			ld	a,h
+			rst	18h
+			bit	1,e
+			jr	La6af
+			db	a3h,d2h,2fh,f5h,09h,80h,15h,9dh
+			db	7bh,c1h,42h,c9h,e7h,fbh,a2h,dbh
+			db	a8h,d9h,0eh,32h
+			ld	l,a
+			ld	a,b
+			ld	e,h
+			ex	af,af'
+			inc	(hl)
+			rst	38h
+			sbc	a,c
+			exx
+			cp	a
+			dec	e
+			cpl
+			ld	(hl),85h
+			sub	a
+			jp	z,L280c
+			dec	h
+			cp	l
+			ex	de,hl
+			xor	c
+			ret	nz
+			dec	(hl)
+			ld	b,84h
+			ld	a,b
+			sbc	a,l
+			call	L1b3b
+			xor	c
+			add	hl,de
+			sub	b
+			ld	a,a
+			or	c
+			inc	sp
+			adc	a,a
+			ld	c,l
+			dec	e
+			adc	a,h
+			and	l
+			ld	h,e
+			ld	l,5fh
+			jp	p,L1459
+			add	a,b
+			ld	l,l
+			ld	c,d
+			ld	(40dch),a
+			push	de
+			or	e
+			inc	(hl)
+			ld	(hl),b
+			add	a,d
+			ret	z
+			di
+			ld	hl,(271ch)
+			and	a
+			ld	c,h
+			xor	c
+			sbc	a,(hl)
+			ccf
+			xor	e
+			djnz	La6e0
+			sbc	a,a4h
+			ld	e,99h
+			ld	l,d
+			jr	z,La6a4
+			adc	a,l
+			add	a,4dh
+			jp	(hl)
+			db	d1h,f3h
+			sbc	a,h
+			rst	08h
+			ld	l,e
+			dec	e
+			ld	h,d
+			jr	nc,La71f
+			ld	d,h
+			ld	a,(bc)
+			add	a,e
+			and	d
+			push	de
+			dec	b
+			dec	h
+			ld	(hl),h
+			rst	10h
+			dec	de
+			ei
+			sbc	a,a
+			sbc	a,a
+			ld	(hl),e
+			rst	38h
+			ret	po
+			xor	a
+			xor	c
+			ld	d,a
+			dec	b
+			add	hl,de
+			ld	d,a
+			ret	nz
+			ld	a,c
+			ld	b,e
+			pop	hl
+			rla
+			rst	38h
+			pop	de
+			call	po,Lc716
+			add	a,h
+			sbc	a,(hl)
+			dec	(hl)
+			jp	L4e4c
+			db	b7h,9dh,49h,68h,b5h,0eh,2bh,f8h
+			db	8bh,eah,03h,a8h,a4h,68h,38h
+			call	m,Lf3b5
+			and	e
+			add	a,b
+			xor	c
+			dec	de
+			inc	h
+			ld	c,(hl)
+			push	af
+			sub	d
+			sub	a
+			inc	a
+			add	hl,de
+			sbc	a,a
+			ld	h,e
+			sub	a
+			ld	a,l
+			sbc	a,h
+			ld	d,(hl)
+			ld	e,l
+			ld	l,d
+			sbc	a,c
+			pop	bc
+			xor	l
+			cp	(hl)
+			adc	a,b
+			adc	a,e
+			or	e
+			ld	b,h
+			rst	18h
+			ld	b,b
+			inc	(hl)
+			inc	h
+			inc	b
+			sbc	a,d
+			ld	d,a
+			call	nz,L82c7
+			xor	h
+			sub	d
+			ld	(hl),e
+			ld	b,c
+			ld	c,(hl)
+			ld	a,l
+			halt
+			ex	(sp),hl
+			daa
+			ld	d,c
+			cp	a
+			sub	dch
+			ld	d,c
+			in	a,(b7h)
+			cp	a
+			sbc	a,e
+			sbc	a,d
+			sbc	a,l
+			ld	(945fh),hl
+			ld	a,(hl)
+			rst	00h
+			cp	h
+			xor	c
+			rra
+			ld	d,b
+			rst	18h
+			ld	b,h
+			jp	pe,L393a
+			jr	c,La775
+			ld	(hl),b
+			and	l
+			ld	(hl),l
+			and	b
+			jp	z,L8b2b
+			add	a,b
+			jp	nz,L044f
+			nop (2x) *
+			add	a,b
+			ld	hl,c73ah
+			xor	l
+			xor	(hl)
+			ld	c,h
+			or	09h
+			ld	b,b
+			or	a
+			jp	po,L5374
+			ld	(f3a9h),hl
+			adc	a,a
+			pop	af
+			daa
+			inc	e
+			ld	b,e1h
+			ld	b,(hl)
+			ld	l,c
+			or	(hl)
+			sub	d
+			ld	l,a
+			jr	nz,La7af
+			jp	p,Lb332
+			ld	(bc),a
+			ld	b,d
+			djnz	La7a0
+			ld	a,d
+			ld	h,56h
+			ld	e,d
+			ld	a,l
+			ret	p
+			rst	38h
+			rra
+			add	hl,sp
+			ret	m
+			sbc	a,(hl)
+			or	(hl)
+			ld	l,c
+			sbc	a,d
+			adc	a,d
+			ld	l,e
+			add	hl,hl
+			dec	c
+			adc	a,5bh
+			adc	a,h
+			ret	nc
+			adc	a,a
+			ld	a,c
+			ld	a,e
+			di
+			ld	h,h
+			dec	de
+			ld	c,d
+			or	eeh
+			adc	a,h
+			pop	hl
+			ld	e,l
+			sub	b9h
+			sbc	a,e
+			ld	e,h
+			ld	c,a
+			out	(fdh),a
+			xor	44h
+			cp	l
+			call	m,L87fa
+			ex	(sp),hl
+			call	m,L7ee1
+			sbc	a,h
+			daa
+			and	l
+			ld	bc,6b5ah
+			rrca
+			add	a,c
+			xor	e
+			or	29h
+			ccf
+			jp	po,Ld329
+			add	a,(hl)
+			or	c
+			ld	h,c
+			add	hl,bc
+			ret	z
+			ld	l,a
+			and	l
+			ld	d,l
+			or	b
+			ret	nz
+			inc	b
+			ret	pe
+			sub	d
+			call	z,Lc610
+			add	hl,sp
+			ld	c,(hl)
+			xor	(hl)
+			sub	h
+			or	h
+			rst	10h
+			in	a,(5eh)
+			jp	pe,L77da
+			sub	c
+			ld	c,c
+			ld	(hl),h
+			or	e
+			or	(hl)
+			ret	pe
+			ld	a,(252ah)
+			ld	c,l
+			add	hl,bc
+			ret	p
+			inc	(hl)
+			ld	(hl),b
+			xor	b
+			ret	m
+			ld	c,b
+			sub	c
+			ld	a,(bc)
+			pop	af
+			jp	nz,L4e86
+			ret	p
+			dec	e
+			adc	a,d
+			rst	10h
+			ld	h,e
+			ld	(bc),a
+			xor	l
+			call	z,L0ce7
+			adc	a,b
+			add	a,(hl)
+			and	(hl)
+			push	bc
+			ld	(bc),a
+			ld	(bc),a
+			add	a,e
+			ld	(hl),a
+			add	a,b
+			ld	(hl),h
+			dec	c
+			ld	a,b
+			push	de
+			ld	b,l
+			adc	a,(hl)
+			rst	08h
+			ld	d,b
+			ld	d,c
+			ld	e,l
+			inc	l
+			dec	a
+			ld	(bc),a
+			ex	de,hl
+			inc	e
+			dec	d
+			ld	a,(de)
+			ld	l,(hl)
+			ld	l,e
+			djnz	La83d
+			ld	l,c
+			and	e
+			scf
+			ld	h,d
+			and	a
+			add	a,b
+			xor	b
+			ld	c,c
+			cp	(hl)
+			or	e
+			or	(hl)
+			ld	d,bfh
+			adc	a,e
+			ld	d,e
+			call	pe,Lf870
+			or	d
+			rst	18h
+			ld	c,c
+			ret	m
+			jr	nc,La7a2
+			ld	b,f7h
+			rst	00h
+			ld	h,h
+			out	(19h),a
+			inc	h
+			ld	(bc),a
+			and	d
+			adc	a,l
+			call	c,Lacd2
+			pop	bc
+			jp	p,Lafb0
+			dec	l
+			dec	hl
+			sub	d
+			adc	a,h
+			call	nc,L388f
+			ld	a,e
+			jp	pe,L64b8
+			ld	e,b
+			sbc	a,b
+			ld	b,a
+			ld	sp,hl
+			call	p,L0dec
+			dec	de
+			xor	h
+			ret	c
+			ld	d,(hl)
+			sub	c
+			nop
+			call	pe,Lcda3
+			dec	l
+			and	(hl)
+			or	c
+			cpl
+			ld	a,l
+			or	b
+			ret	m
+			ld	d,b
+			ld	(hl),l
+			ld	de,07b2h
+			dec	hl
+			jp	nz,L330a
+			sub	d
+			xor	h
+			ld	a,h
+			inc	bc
+			sub	3dh
+			ld	(de),a
+			ld	h,a
+			ld	h,l
+			ld	e,c
+			ld	(hl),l
+			ld	c,c
+			sbc	a,b
+			ld	c,b
+			ld	(hl),h
+			ld	bc,32d1h
+			add	a,d
+			add	a,b
+			ld	c,b
+			add	a,d
+			or	l
+			rst	30h
+			ld	c,h
+			or	h
+			xor	c
+			adc	a,c
+			ld	sp,hl
+			dec	a
+			sub	b
+			xor	h
+			ld	(7941h),hl
+			call	pe,L6641
+			ld	a,d
+			ld	h,(hl)
+			ld	e,(hl)
+			ld	b,d
+			ld	a,b
+			ret	p
+			inc	(hl)
+			ld	d,(hl)
+			rst	10h
+			ld	d,h
+			call	nz,L570b
+			ld	e,a
+			inc	a
+			add	a,e
+			rla
+			adc	a,b
+			ld	c,c
+			and	h
+			ld	l,c
+			ret	c
+			jp	m,Lce67
+			ld	(d500h),a
+			inc	e
+			dec	(hl)
+			ret	po
+			ret	po
+			ld	e,b
+			add	hl,de
+			ld	d,h
+			dec	b
+			call	pe,Lbbb4
+			xor	e
+			xor	b
+			ld	l,l
+			ld	(hl),a
+			dec	(hl)
+			ccf
+			ld	h,e
+			ld	e,(hl)
+			ld	b,c
+			add	a,e
+			ld	b,l
+			or	l
+			add	hl,bc
+			ld	c,(hl)
+			adc	a,a
+			ld	l,a
+			rst	08h
+			ld	d,88h
+			ld	a,(97dfh)
+			dec	e
+			jr	La90d
+			db	9bh,f6h,08h,f1h,00h,d6h,e9h,b2h
+			db	deh,74h,84h,90h,deh,ech,ebh,9eh
+			db	ddh,6ah,51h,63h,09h,4dh,fch
+			ld	l,(hl)
+			ld	(hl),c
+			nop (2x) *
+			ld	d,bch
+			ld	sp,72dfh
+			rlca
+			inc	e
+			inc	d
+			ld	a,(de)
+			or	2dh
+			jr	La92c
+			db	8eh,eah,c2h,fbh,6bh,99h,65h,97h
+			db	5eh,29h,12h,17h,19h,32h,83h,e1h
+			db	58h,dch,32h,68h,88h,9dh,62h,f1h
+			db	b2h,6bh,e7h,3bh,35h,fah,dah,b1h
+			db	b3h,c6h,2eh,54h,d8h,33h,26h,3dh
+			db	28h,e1h,cdh,5ch,cah,08h,44h,1ch
+			db	c7h,03h
+			sub	e
+			sbc	a,(hl)
+			ld	e,h
+			and	(hl)
+			ld	a,b
+			call	c,L361c
+			jp	z,Lfc2f
+			ex	de,hl
+			add	a,h
+			rst	30h
+			jp	c,Le6a5
+			jp	pe,L5507
+			xor	c
+			ld	d,l
+			cpl
+			in	a,(c4h)
+			and	h
+			ld	(11f8h),hl
+			ld	h,d
+			ld	(hl),a
+			inc	hl
+			jp	pe,L1933
+			ld	sp,hl
+			ld	e,h
+			ld	d,d
+			cp	c
+			sbc	a,a
+			push	af
+			push	de
+			rra
+			ld	a,(hl)
+			ld	c,a
+			ld	(hl),e
+			or	a
+			ld	(hl),d
+			ld	bc,d1f9h
+			ld	(hl),e
+			xor	9fh
+			sbc	a,e
+			ld	a,c3h
+			dec	a
+			ld	(hl),c
+			ld	c,b
+			ld	(hl),l
+			ld	h,(hl)
+			ld	d,h
+			ret	nz
+			inc	b
+			rlca
+			rst	08h
+			jp	m,Lcf55
+			sub	l
+			add	hl,bc
+			inc	e
+			ld	a,(12ceh)
+			ld	a,14h
+			ret	z
+			jp	nz,Lf311
+			ld	l,l
+			add	hl,de
+			ld	b,a
+			ld	d,(hl)
+			ld	d,e
+			sbc	a,c
+			or	d
+			ld	l,l
+			and	94h
+			sub	a
+			add	hl,hl
+			dec	d
+			add	a,a
+			rst	38h
+			xor	7ah
+			adc	a,24h
+			or	c
+			sub	b
+			ld	l,b
+			cp	a7h
+			ld	(hl),c
+			ld	c,d
+			ld	c,l
+			inc	sp
+			ld	(hl),c
+			ret	po
+			jp	c,L6e21
+			dec	c
+			dec	bc
+			ld	h,(hl)
+			call	L9570
+			ld	a,h
+			adc	a,(hl)
+			nop
+			rst	28h
+			ld	l,c
+			ld	hl,9409h
+			ld	c,e
+			and	h
+			ld	(hl),c
+			call	p,La55f
+			add	a,20h
+			xor	d
+			push	hl
+			ld	(hl),e
+			xor	b
+			ld	a,b3h
+			jp	nc,Lf238
+			add	a,a
+			or	c0h
+			call	c,Lb2f9
+			ex	de,hl
+			jp	m,La837
+			djnz	La9fc
+			and	e
+			jp	z,L59bc
+			ei
+			rst	30h
+			jp	m,L77cd
+			ld	b,a
+			ld	d,a
+			di
+			sbc	a,a
+			sub	5dh
+			cp	l
+			ld	c,c
+			add	hl,de
+			inc	sp
+			and	c
+			add	a,e
+			and	(hl)
+			dec	d
+			inc	c
+			ld	(hl),l
+			add	a,a
+			ld	d,b
+			inc	bc
+			ld	d,d
+			dec	b
+			ld	h,47h
+			sbc	a,(hl)
+			xor	a
+			sub	(hl)
+			out	(cah),a
+			ld	hl,(La86e)
+			adc	a,l
+			add	a,l
+			inc	de
+			ld	c,c
+			ld	(hl),b
+			ld	c,d
+			ld	h,71h
+			jp	nc,L2c38
+			rst	00h
+			ld	h,c
+			out	(c7h),a
+			adc	a,c
+			ld	sp,3457h
+			jp	po,Ldb0b
+			call	pe,Lc65c
+			ld	h,dah
+			ld	(hl),h
+			push	af
+			ld	h,d
+			ld	hl,f121h
+			jr	c,La9bc
+			ret	m
+			ld	(hl),e
+			ret	z
+			add	a,l
+			pop	af
+			ld	a,(L03fd)
+			inc	e
+			ld	h,a4h
+			or	b
+			dec	bc
+			ld	h,h
+			di
+			jp	nz,L14a0
+			ld	e,e
+			push	hl
+			jr	La9d4
+			db	0eh,fbh,6ch,42h,39h,67h,f2h,52h
+			db	adh,a8h,f7h,05h,d2h,fbh,8ch,0eh
+			db	b6h,27h,1dh,10h,c9h,73h,57h,a9h
+			db	d1h,6eh,cdh,73h,0ah,26h,16h,63h
+			db	63h,7ah,0eh,0ah,20h,b9h
+			jp	pe,Ldb33
+			rst	30h
+			inc	e
+			add	a,e
+			ld	e,h
+			inc	de
+			cpl
+			ld	iyh,d *
+			sub	b
+			ex	(sp),hl
+			adc	a,l
+			ld	h,c
+			call	nc,L5557
+			ld	e,(hl)
+			add	a,b
+			adc	a,c
+			call	po,L747c
+			ld	d,25h
+			ei
+			dec	d
+			jp	nc,Ld4be
+			adc	a,c
+			cp	iyh *
+			ccf
+			ld	c,l
+			sbc	a,(hl)
+			push	de
+			ld	(b1feh),a
+			ei
+			cp	61h
+			ld	l,b9h
+			inc	bc
+			ld	a,(hl)
+			dec	de
+			ld	e,a
+			jr	Laaad
+			db	e4h,d3h,fbh,8ah,8ch,1fh,3ch,77h
+			db	6eh
+			res	4,e
+			or	h
+			ld	(hl),a
+			ret
+			db	46h,44h,f6h,cfh,36h,feh,4fh,a6h
+			db	eeh,aeh,3bh,99h,c5h,31h,08h,63h
+			db	34h,2eh,8ch,49h,a0h,52h,bdh,90h
+			db	98h,1dh,97h,3eh,8fh,80h,c2h,86h
+			db	77h,4bh,28h
+			ld	(hl),l
+			ld	a,b
+			cp	(hl)
+			or	h
+			push	de
+			ld	b,l
+			ld	e,a
+			ld	e,d
+			in	a,(c7h)
+			dec	h
+			ld	l,3ch
+			jp	po,L703d
+			ld	hl,(f7b5h)
+			ld	l,d
+			ld	a,h
+			or	38h
+			sub	l
+			ld	(hl),ach
+			ld	l,l
+			ld	b,l
+			sub	d
+			ld	d,c
+			ld	d,h
+			add	a,b
+			ld	a,d
+			jr	c,Laa3e
+			ld	b,b
+			jr	nc,Laa3f
+			ld	a,a
+			ld	c,d
+			ld	(cedbh),hl
+			xor	(hl)
+			adc	a,b
+			sbc	a,a
+			call	po,La194
+			rrca
+			rst	08h
+			rlca
+			rst	28h
+			rlca
+			ld	e,(hl)
+			sub	iyh *
+			sbc	a,l
+			ld	a,(de)
+			ld	d,l
+			ld	h,d
+			rst	00h
+			ld	l,h
+			inc	bc
+			sub	e
+			ld	h,d
+			adc	a,e
+			add	a,d
+			ld	h,c
+			jp	z,La44e
+			ccf
+			jp	m,Ld12a
+			call	m,Ldc7a
+			add	hl,sp
+			adc	a,l
+			halt
+			ld	(hl),l
+			ld	b,c
+			ld	a,(dd06h)
+			ld	b,e1h
+			and	a3h
+			ld	c,c
+			ld	a,23h
+			or	42h
+			inc	bc
+			call	po,L57fb
+			ld	c,e
+			sub	b
+			push	bc
+			xor	l
+			adc	a,e
+			add	a,a
+			ld	l,a
+			inc	hl
+			djnz	Lab5e
+			or	a
+			ld	c,(hl)
+			sbc	a,a
+			cp	d
+			ld	h,f8h
+			push	bc
+			add	hl,hl
+			rst	20h
+			out	(30h),a
+			add	a,a
+			ld	e,h
+			inc	sp
+			jp	p,Lee66
+			ld	e,h
+			cp	c
+			ld	l,(hl)
+			ld	a,(de)
+			xor	(hl)
+			rrca
+			or	h
+			jr	z,Lab47
+			call	pe,L0a90
+			add	hl,bc
+			call	c,La0b1
+			ld	sp,1713h
+			sbc	a,a
+			ld	(hl),a
+			pop	bc
+			ld	h,(hl)
+			nop
+			or	a
+			ld	h,b
+			ld	d,(hl)
+			call	po,Le743
+			pop	bc
+			jr	c,Laafa
+			ld	h,d
+			jr	nz,Lab64
+			ld	b,d
+			ld	l,(hl)
+			sbc	a,(hl)
+			ld	c,e
+			dec	l
+			ld	h,e
+			ld	c,d
+			dec	h
+			add	hl,sp
+			dec	h
+			call	p,L711c
+			ld	a,d
+			ld	l,e
+			call	nc,L764d
+			ccf
+			call	c,Le24c
+			ld	l,eeh
+			jp	nc,L2d44
+			jp	m,Le68a
+			cp	c
+			ld	(hl),c
+			and	e
+			call	p,L02df
+			cpl
+			xor	c
+			xor	d
+			rst	10h
+			ld	(1270h),hl
+			jp	nc,Lbd0b
+			ld	l,71h
+			call	Lac1d
+			ld	d,d
+			adc	a,d
+			ret	p
+			ld	(bc),a
+			ld	l,a9h
+			or	a
+			dec	b
+			add	a,b
+			add	hl,bc
+			and	(hl)
+			ccf
+			ld	(hl),38h
+			sbc	a,b
+			ld	(hl),e
+			jp	m,L98aa
+			ld	a,(bc)
+			call	p,Lfaf2
+			and	a
+			ld	e,(hl)
+			rra
+			and	l
+			ld	h,d1h
+			add	hl,de
+			ld	a,(8614h)
+			ld	a,h
+			ld	(debch),hl
+			and	b
+			ex	(sp),hl
+			add	hl,sp
+			and	a
+			dec	e
+			rlca
+			pop	hl
+			adc	a,d
+			and	b
+			rrca
+			push	hl
+			ld	a,e
+			ld	l,a
+			cp	e
+			ld	d,d
+			daa
+			ld	a,5fh
+			nop (2x) *
+			and	d
+			dec	de
+			inc	d
+			ld	(hl),a
+			ld	l,a
+			cp	a
+			ld	l,b
+			sbc	a,e
+			ret
+			db	72h,10h,adh,71h,53h,afh,e9h,34h
+			db	d1h,7bh,feh,7bh,ffh,18h,85h,edh
+			db	68h,18h,03h,e9h,1fh,b8h,45h,b3h
+			db	4fh,78h,34h,aeh,cah,52h,feh,83h
+			db	29h,86h,d6h,d9h,73h,41h,ach,efh
+			or	c
+			ld	c,a
+			dec	d
+			halt
+			ld	c,l
+			jr	nc,Lab82
+			sub	c
+			ld	(hl),l
+			call	c,L946e
+			ld	(hl),e
+			sbc	a,b
+			dec	c
+			rrca
+			ld	a,(bc)
+			call	nc,La48a
+			and	e
+			ld	b,(hl)
+			ld	h,a
+			inc	bc
+			cp	l
+			ld	h,a
+			dec	(hl)
+			ld	l,43h
+			add	a,11h
+			ld	e,c
+			call	po,L5bd0
+			daa
+			ld	e,b
+			jr	Lab99
+			db	edh,5ah,e8h,b7h,cfh,51h,51h,77h
+			db	83h,3bh,9ah,d9h,45h,94h,11h,80h
+			db	cdh,17h,0fh,f8h,afh,16h,69h,adh
+			db	6ah,f0h,67h,a8h,23h,beh,d8h,9bh
+			ex	(sp),hl
+			ld	a,(hl)
+			push	bc
+			ld	c,(hl)
+			adc	a,(hl)
+			ld	hl,(66f3h)
+			ld	c,l
+			call	L29f9
+			dec	h
+			ld	h,e
+			pop	bc
+			push	af
+			jp	z,L884c
+			and	h
+			inc	h
+			pop	af
+			call	pe,Lcd94
+			ld	d,a
+			add	a,d7h
+			inc	a
+			ld	h,l
+			dec	b
+			ld	c,a
+			adc	a,l
+			ld	b,e
+			and	d
+			inc	sp
+			add	a,f9h
+			rst	30h
+			ld	c,a
+			ld	a,d
+			or	l
+			pop	de
+			call	po,Le874
+			daa
+			xor	h
+			ld	a,(bc)
+			call	nz,L2fda
+			ld	bc,67a8h
+			cp	h
+			dec	(hl)
+			inc	h
+			ret	m
+			sbc	a,c1h
+			scf
+			nop
+			adc	a,h
+			and	a6h
+			ld	h,b
+			ld	h,c
+			rst	30h
+			rst	08h
+			adc	a,e
+			ld	a,h
+			sub	h
+			daa
+			sbc	a,a
+			adc	a,c
+			jp	c,L018f
+			ld	l,(hl)
+			and	e
+			inc	e
+			xor	c
+			or	(hl)
+			ld	hl,(c494h)
+			ld	a,a
+			dec	sp
+			or	h
+			sub	c
+			res	0,(hl)
+			or	a
+			ld	b,11h
+			ld	c,b
+			add	hl,bc
+			ret	pe
+			sbc	a,a
+			and	l
+			sub	d
+			call	m,L1b0d
+			dec	de
+			cp	h
+			and	98h
+			inc	b
+			ret	nc
+			or	c
+			ld	h,a
+			ld	l,6fh
+			halt
+			rst	38h
+			exx
+			ex	(sp),hl
+			ld	iyh,d *
+			ld	l,e
+			cp	10h
+			ld	(bc),a
+			inc	l
+			ld	e,c
+			adc	a,d
+			adc	a,2dh
+			ld	l,d
+			pop	bc
+			ld	e,a
+			ld	(hl),a
+			di
+			rst	30h
+			ld	d,d
+			call	p,Lec55
+			ld	de,8651h
+			and	h
+			adc	a,a
+			ld	ix,d9a5h
+			xor	a
+			ld	l,(hl)
+			ld	a,d0h
+			sbc	a,d3h
+			or	l
+			ld	a,a
+			ld	b,b
+			call	z,Lfcb3
+			ex	de,hl
+			sub	d
+			or	97h
+			ld	c,b
+			ld	e,a
+			call	po,Lb079
+			ret
+			db	f5h,7eh,0bh,a2h,06h,cah,0dh,d2h
+			db	4fh,17h
+			sbc	a,9dh
+			ld	h,h
+			ld	h,l
+			rra
+			cp	b
+			ld	d,h
+			rst	00h
+			cp	d9h
+			ld	hl,5b30h
+			sbc	a,a
+			or	(hl)
+			and	d
+			and	e
+			ld	h,d
+			jr	c,Lac7f
+			ld	a,(bc)
+			call	pe,L59a8
+			ld	a,d
+			ld	b,fdh
+			cp	b
+			cp	d
+			dec	l
+			push	de
+			ld	sp,823ch
+			sbc	a,b
+			ret	c
+			call	Lf0e5
+			xor	b
+			xor	c
+			ld	h,a
+			inc	hl
+			ld	d,(hl)
+			ld	sp,b64dh
+			sub	h
+			add	a,h
+			add	a,e
+			ld	a,(de)
+			pop	de
+			rrca
+			ld	b,h
+			ld	c,a
+			add	hl,hl
+			sub	c
+			dec	de
+			call	Ld47d
+			or	a
+			push	af
+			and	h
+			sub	a
+			sbc	a,b
+			ld	b,c
+			add	a,a
+			ld	a,(de)
+			ld	d,e
+			adc	a,b7h
+			ld	(hl),e
+			ret	po
+			ld	c,e
+			ret	nz
+			ld	(hl),d
+			ld	c,e
+			xor	b
+			add	hl,de
+			cp	b
+			dec	l
+			dec	d
+			ld	c,99h
+			xor	b
+			ld	hl,1891h
+			cp	(hl)
+			jp	p,L5c08
+			and	c
+			xor	a
+			ld	a,(bc)
+			call	nc,L8859
+			inc	h
+			sub	l
+			ld	b,h
+			cp	b
+			ld	bc,1199h
+			ld	a,e
+			pop	bc
+			scf
+			cp	bfh
+			ld	e,(hl)
+			ld	sp,hl
+			xor	61h
+			djnz	Lad6f
+			nop
+			ld	e,18h
+			and	l
+			add	a,l
+			in	a,(23h)
+			ld	l,l
+			ld	l,h
+			sub	b
+			adc	a,b
+			dec	h
+			call	m,Lf36a
+			ret	c
+			sbc	a,h
+			ld	h,f9h
+			or	h
+			call	c,Lc32f
+			xor	c
+			ld	sp,hl
+			ld	(hl),l
+			adc	a,c
+			cp	b
+			jp	(hl)
+			rst	08h
+			sub	4ch
+			dec	sp
+			xor	a
+			sub	2dh
+			sbc	a,d
+			jp	nz,Lc980
+			sbc	a,d
+			rst	18h
+			rst	30h
+			rst	00h
+			ld	c,c
+			ld	(bc),a
+			jp	m,La457
+			ex	de,hl
+			xor	h
+			inc	h
+			or	c
+			ld	l,e
+			inc	de
+			ld	l,h
+			ld	h,(hl)
+			ld	b,b
+			sbc	a,a
+			jr	c,Lad6b
+			rst	30h
+			djnz	Lad96
+			rra
+			inc	a
+			rst	00h
+			or	(hl)
+			add	a,a
+			or	49h
+			ld	l,c
+			ld	l,d
+			push	hl
+			adc	a,b
+			inc	de
+			dec	b
+			sub	b
+			jp	m,L229f
+			ld	c,e
+			ex	af,af'
+			inc	l
+			call	nc,L5275
+			add	a,(hl)
+			inc	de
+			ld	l,a
+			ei
+			ld	l,l
+			inc	h
+			ret	c
+			rst	38h
+			jp	m,L091f
+			ld	a,(de)
+			jp	nc,L76bd
+			ld	a,d
+			sbc	a,l
+			sbc	a,(hl)
+			ld	l,(hl)
+			and	(hl)
+			ld	(hl),d
+			sra	e
+			ex	af,af'
+			ld	b,c
+			in	a,(dch)
+			rst	20h
+			inc	(hl)
+			ld	(hl),c
+			ld	b,a
+			sub	a
+			add	hl,bc
+			add	a,d
+			xor	l
+			add	hl,sp
+			ld	a,(bc)
+			add	a,e
+			ld	(3471h),a
+			rlca
+			inc	c
+			inc	l
+			ld	l,c
+			push	af
+			jp	z,Lb69d
+			add	hl,bc
+			sub	l
+			ld	b,h
+			ex	de,hl
+			adc	a,h
+			daa
+			ret	nz
+			push	bc
+			add	a,5fh
+			add	a,a
+			xor	50h
+			sub	a
+			rrca
+			xor	(hl)
+			ld	(hl),a
+			ld	b,l
+			ld	h,a
+			add	hl,sp
+			push	bc
+			ld	l,h
+			cp	b
+			call	pe,Le86b
+			ld	l,b
+			ret
+			and	(hl)
+			sbc	a,e
+			cp	f1h
+			call	pe,L8723
+			rla
+			ccf
+			pop	de
+			dec	a
+			call	p,L4c82
+			ret	z
+			sub	c
+			ld	l,a
+			ex	de,hl
+			and	d
+			add	a,b
+			ld	b,a
+			daa
+			ld	l,d
+			jp	p,Lea00
+			rla
+			dec	l
+			sbc	a,b
+			ld	h,c
+			jr	nc,Lae7a
+			ld	h,d
+			add	a,c
+			and	h
+			ei
+			im	0/1 *
+			add	a,e
+			add	a,c
+			and	b
+			ld	d,a
+			jp	z,L7eb1
+			inc	a
+			adc	a,(hl)
+			call	Lcb05
+			sbc	a,e
+			ret	m
+			or	c
+			or	(hl)
+			cp	e
+			xor	b
+			call	z,Lf2ec
+			ld	h,e
+			ld	l,b
+			adc	a,h
+			add	hl,sp
+			ret	z
+			dec	a
+			set	1,c
+			ld	d,h
+			ld	d,2eh
+			ld	a,a
+			jp	p,La98a
+			ld	d,5ah
+			sbc	a,a4h
+			halt
+			sub	(hl)
+			ret
+			db	cch,4ch,26h
+			or	e
+			add	a,l
+			ld	b,l
+			inc	b
+			xor	h
+			bit	3,(hl)
+			in	a,(4ah)
+			dec	b
+			ld	d,b
+			ld	(hl),b
+			ld	h,a
+			ex	de,hl
+			ex	af,af'
+			ld	d,(hl)
+			ld	(hl),96h
+			sub	l
+			xor	e
+			or	c
+			ld	e,h
+			ld	a,b
+			ld	e,h
+			inc	(hl)
+			sbc	a,b9h
+			or	e
+			djnz	Lae6c
+			adc	a,4dh
+			and	d
+			ld	(hl),b
+			jr	nc,Lae24
+			ei
+			ld	b,a
+			scf
+			ld	l,(hl)
+			dec	d
+			ld	(hl),1ch
+			ld	(hl),a
+			ret	p
+			ld	a,d
+			ret	pe
+			rst	28h
+			ld	l,(hl)
+			and	(hl)
+			ret	m
+			ld	(hl),c
+			jr	Laeb5
+			db	9ah,4ah,24h,adh,23h
+			ld	sp,hl
+			jp	p,L48df
+			ld	d,(hl)
+			call	po,La712
+			scf
+			nop (2x) *
+			pop	bc
+			di
+			add	a,a
+			sbc	a,2dh
+			jp	m,Le904
+			add	a,a
+			ld	a,e
+			push	af
+			push	bc
+			ld	e,b
+			nop (2x) *
+			ld	d,a
+			ld	a,b
+			ld	b,b
+			ld	d,l
+			or	a
+			and	4eh
+			nop
+			ld	(134ch),a
+			srl	a
+			dec	l
+			jp	p,L90cd
+			sub	d
+			inc	l
+			inc	b
+			ld	(hl),l
+			ex	(sp),hl
+			sbc	a,a
+			ld	h,e
+			ret	m
+			jr	c,Lae3f
+			out	(73h),a
+			add	a,c
+			add	a,d
+			scf
+			ld	(hl),b
+			ld	l,c
+			xor	a
+			ld	a,h
+			ld	a,3eh
+			inc	hl
+			ld	b,b
+			ld	a,e
+			ld	b,e
+			ld	a,l
+			rlc	a
+			ld	(hl),l
+			call	po,Lb709
+			call	m,Ld17c
+			inc	d
+			dec	h
+			ld	(87c7h),a
+			add	hl,sp
+			add	a,h
+			adc	a,h
+			daa
+			ld	(hl),b
+			ld	(hl),d
+			inc	b
+			xor	b
+			ld	e,a
+			add	a,c
+			jr	nz,Lae7e
+			and	b
+			ld	e,h
+			sbc	a,b
+			or	l
+			push	bc
+			adc	a,(hl)
+			ld	l,45h
+			sub	h
+			add	a,05h
+			sub	d
+			inc	b
+			inc	e
+			ld	b,cch
+			dec	c
+			ccf
+			ld	hl,45e1h
+			adc	a,c
+			and	a
+			pop	af
+			xor	(hl)
+			sbc	a,b
+			and	l
+			exx
+			add	a,c8h
+			di
+			ld	c,h
+			call	nz,L5366
+			jr	Laef6
+			db	3eh,14h,0eh,b3h,cah,62h,44h,6ch
+			db	5fh,8ch,94h,42h,83h,57h,4fh,abh
+			db	1bh,0ch,c8h,5dh,d3h,78h,fdh,47h
+			db	24h,16h,39h,d2h,e5h,43h,20h,4ah
+			db	00h,05h,05h,bdh,b8h,7ch,cah,6ch
+			db	15h,7ch,ffh,86h,85h,0bh,67h,c2h
+			db	00h,58h,3bh,fbh,0bh,4ch,c9h,dch
+			ld	l,b
+			ld	h,b
+			and	(hl)
+			adc	a,(hl)
+			or	(hl)
+			xor	dch
+			call	c,L13e7
+			ld	e,c
+			ld	(de),a
+			ld	h,a
+			ld	sp,ae28h
+			and	d
+			add	hl,sp
+			or	e
+			dec	hl
+			ld	a,l
+			xor	c
+			or	e
+			ld	hl,(249dh)
+			ld	(hl),c
+			sub	l
+			add	a,(hl)
+			ld	c,l
+			ld	l,a
+			xor	3fh
+			inc	d
+			ld	d,e
+			cp	h
+			rst	20h
+			ld	de,6fc0h
+			ld	c,(hl)
+			ld	d,(hl)
+			ld	b,e
+			sub	d
+			inc	sp
+			dec	de
+			add	hl,sp
+			ld	l,(hl)
+			ld	h,e
+			ld	h,b
+			sub	d
+			or	(hl)
+			ld	b,h
+			or	b
+			add	hl,bc
+			jp	pe,L4b33
+			ld	hl,(b83ah)
+			jr	nc,Laf5e
+			adc	a,d
+			inc	de
+			ld	a,l
+			daa
+			ld	d,58h
+			rlca
+			ld	h,(hl)
+			inc	c
+			ld	e,a
+			jp	c,L0dff
+			jp	(hl)
+			db	f2h,64h,39h,60h,07h,98h,4dh,c0h
+			db	48h,d3h,31h,9eh,33h,a0h,9ah,fdh
+			db	dfh,88h,d8h,2fh,35h,35h,bch,9bh
+			db	a4h,82h,b8h,5eh,fbh,eah,60h,dah
+			db	11h,abh,9dh,5ah,8ah,2ch,62h,00h
+			db	0ch,c4h,6eh,87h,8eh,95h,49h
+			add	hl,bc
+			ld	h,b
+			sbc	a,e
+			jp	c,Lc809
+			jp	pe,Laee1
+			ld	(hl),c
+			call	po,La845
+			ld	e,b
+			djnz	Lb026
+			jp	p,L3a10
+			and	b
+			adc	a,(hl)
+			ld	d,a
+			inc	de
+			in	a,(a0h)
+			jr	c,Lb01b
+			jp	p,L0b88
+			exx
+			or	h
+			call	z,Lcc3b
+			ld	l,b
+			or	b
+			cp	(hl)
+			ld	hl,a1fdh
+			ld	a,c
+			or	h
+			sub	c
+			cp	e
+			rst	28h
+			ex	de,hl
+			ld	a,d
+			ld	(hl),e
+			add	a,h
+			ret	nz
+			and	(hl)
+			add	a,l
+			ld	sp,c333h
+			ld	l,h
+			ld	h,c
+			call	c,L89b6
+			adc	a,c
+			ld	hl,(3531h)
+			ld	l,(hl)
+			ld	d,l
+			dec	e
+			ld	hl,(e97ch)
+			or	h
+			ld	e,d
+			ld	h,l
+			ld	a,(de)
+			nop (2x) *
+			push	bc
+			ret	nc
+			ld	d,b
+			add	a,h
+			cp	b
+			xor	e
+			ld	e,a
+			cp	h
+			dec	e
+			sbc	a,c
+			or	d
+			jr	nc,Lb04c
+			cp	58h
+			add	a,(hl)
+			ld	sp,b034h
+			call	nc,L1a98
+			ccf
+			sbc	a,d
+			add	a,l
+			sbc	a,(hl)
+			ld	h,h
+			dec	sp
+			ld	(hl),d
+			and	l
+			ret	c
+			or	l
+			dec	h
+			in	a,(64h)
+			ld	e,h
+			di
+			xor	l
+			and	(hl)
+			sub	(hl)
+			ld	d,(hl)
+			nop
+			add	hl,hl
+			ld	d,a
+			dec	h
+			xor	b
+			ld	a,h
+			ret	m
+			call	p,Ldb0a
+			jp	po,Lf9b0
+			ld	e,c
+			xor	e
+			ld	d,d
+			add	hl,de
+			ld	(6773h),hl
+			ld	l,l
+			ld	e,(hl)
+			nop
+			rst	08h
+			djnz	Lb033
+			ld	h,a
+			or	h
+			ld	d,l
+			rst	20h
+			ld	b,d
+			jp	m,L7161
+			inc	c
+			ld	a,(bc)
+			and	a
+			add	a,b
+			and	97h
+			ld	(hl),d
+			ld	b,l
+			ld	e,c
+			sbc	a,c
+			ld	e,c
+			rst	00h
+			ld	(c9feh),a
+			xor	d1h
+			call	po,L5047
+			inc	bc
+			call	Lf081
+			ld	de,981eh
+			jp	pe,Lbeb3
+			ld	d,c
+			and	21h
+			adc	a,(hl)
+			nop (2x) *
+			or	(hl)
+			add	a,2bh
+			ld	(bc),a
+			add	a,(hl)
+			dec	d
+			ld	c,(hl)
+			inc	h
+			ld	sp,hl
+			sbc	a,h
+			or	(hl)
+			out	(bdh),a
+			cp	d
+			inc	hl
+			dec	bc
+			dec	e
+			rra
+			ld	(hl),a
+			ld	e,(hl)
+			ld	b,a
+			ld	a,e
+			out	(d4h),a
+			adc	a,l
+			ld	(bc),a
+			or	c
+			cpl
+			inc	e
+			cp	a
+			jp	c,L80bb
+			djnz	Lb0e1
+			ld	d,l
+			ld	e,a
+			rlca
+			pop	af
+			ld	d,c
+			add	hl,sp
+			or	e
+			ld	c,l
+			dec	bc
+			cp	b
+			xor	a
+			ret	po
+			inc	(hl)
+			inc	h
+			sbc	a,l
+			ld	d,(hl)
+			ld	b,4ah
+			ld	a,(bc)
+			djnz	Lb064
+			sbc	a,99h
+			and	63h
+			add	a,b
+			ld	d,d
+			cp	56h
+			sbc	a,d
+			ld	a,b
+			inc	de
+			add	hl,sp
+			ld	l,c
+			djnz	Lb070
+			ld	(hl),e
+			and	l
+			ld	h,c
+			call	po,L7e77
+			ld	b,c
+			ld	a,h
+			jr	c,Lb086
+			add	a,d
+			sbc	a,(hl)
+			ld	a,c
+			sbc	a,d
+			ld	b,l
+			nop
+			or	h
+			ld	(bc),a
+			inc	a
+			di
+			ld	e,c
+			sbc	a,d
+			adc	a,e
+			and	0ah
+			jp	c,L4ba9
+			ei
+			sub	e
+			dec	b
+			ccf
+			ld	c,88h
+			rst	20h
+			ld	d,h
+			im	2 *
+			ld	h,(hl)
+			jr	c,Lb0cb
+			pop	af
+			inc	a
+			call	po,L81bc
+			sbc	a,e
+			push	de
+			or	(hl)
+			add	a,h
+			inc	bc
+			sbc	a,d
+			ld	h,d
+			and	c
+			xor	a
+			dec	e
+			dec	de
+			push	af
+			or	h
+			ld	l,a
+			ld	h,c
+			sbc	a,(hl)
+			or	(hl)
+			jp	c,L41f4
+			ld	b,l
+			ret	pe
+			rst	18h
+			inc	sp
+			nop (2x) *
+			nop
+			ld	(hl),c
+			ld	(ad03h),a
+			sbc	a,48h
+			ld	h,e
+			cp	l
+			and	d
+			jp	(hl)
+			db	e2h,0ch,85h,64h,a3h,aah,efh,b5h
+			db	21h,5eh,c0h,86h,90h,bah,aeh,86h
+			db	39h,8bh,89h,c8h,2eh,6bh,b5h,7ah
+			db	27h,3bh,69h,e7h,01h,cdh,efh,d2h
+			db	3fh,53h,20h,15h,b6h,c1h,1dh,5eh
+			db	fdh,1ch,d8h,16h,b9h,33h,06h,33h
+			db	11h,33h,40h,e9h,c8h,c5h,2bh,31h
+			db	11h,5dh,76h,1dh,66h,ceh,b7h,d4h
+			db	8fh,57h,d4h,6fh,29h,8eh,d2h,0dh
+			db	4ch,4fh,5fh,1ah,00h,52h,4fh,8dh
+			db	aah,4dh,b9h,6bh,bch,d1h,2ch,40h
+			db	3ah,06h,27h,f8h,1ah,2ch,87h,80h
+			db	f3h,ffh,ech,a3h,98h,63h,46h,8bh
+			db	2ah,38h,bdh,85h,f7h,e8h,49h,0eh
+			db	98h,a3h,fah,9fh,b7h
+			inc	de
+			ld	d,c
+			ld	c,b
+			add	a,l
+			adc	a,c
+			rra
+			jp	c,L48ef
+			sbc	a,e
+			ld	d,a
+			sub	(hl)
+			inc	h
+			ld	l,h
+			inc	d
+			ld	e,l
+			ld	(05c2h),a
+			ld	h,(hl)
+			ex	de,hl
+			ld	b,a
+			rla
+			ld	e,a
+			ld	e,b
+			pop	af
+			ld	h,d
+			ld	(hl),e
+			cp	l
+			cp	l
+			ld	d,a
+			ld	hl,(e4c6h)
+			ld	a,l
+			jp	nc,L04c4
+			jp	c,Lec04
+			add	a,b
+			cp	92h
+			nop
+			and	b
+			inc	de
+			call	nc,L1b92
+			sbc	a,l
+			ld	a,d
+			ld	c,c
+			ld	e,d
+			ld	(hl),d
+			ei
+			jp	po,L0583
+			ld	a,(bc)
+			ld	c,e
+			and	(hl)
+			ld	(hl),h
+			and	h
+			add	hl,bc
+			adc	a,h
+			sub	e
+			ld	d,e
+			ld	a,(37d5h)
+			pop	hl
+			adc	a,l
+			sub	e
+			sbc	a,b
+			jp	z,L3a5e
+			dec	a
+			ld	(hl),d
+			inc	c
+			call	nz,L7344
+			xor	b
+			dec	bc
+			add	a,(hl)
+			add	a,a
+			dec	hl
+			add	a,h
+			ld	b,9ah
+			rst	00h
+			ld	e,c
+			ld	d,h
+			cp	h
+			call	po,L81f3
+			sll	d
+			ld	a,h
+			add	a,3ah
+			dec	l
+			ld	a,c
+			dec	bc
+			ld	c,04h
+			or	f2h
+			or	d
+			ld	c,d
+			and	c
+			exx
+			sbc	a,c
+			jr	z,Lb211
+			ld	b,d
+			dec	de
+			sub	c
+			rrca
+			rst	08h
+			dec	sp
+			jp	nc,Lb439
+			ld	a,(bc)
+			ret	z
+			add	hl,de
+			ld	(40b9h),hl
+			and	h
+			ld	h,a
+			ld	d,l
+			rlca
+			ccf
+			jp	L9d18
+			db	11h,72h,09h,eah,e5h,0eh,5ch,0dh
+			db	8dh,ach,eah
+			jp	pe,Le816
+			cp	e
+			jp	L8b6b
+			db	e2h,bbh,04h,91h,ffh,08h,3dh,c9h
+			db	3dh,46h,bbh,c5h,aah,0ch,32h,2fh
+			db	92h,40h,30h,8ah,e1h,46h,b5h,83h
+			db	beh,a6h,90h,b1h,05h,64h,f9h,5dh
+			db	b0h,bbh,c4h,24h,d2h,23h,7ah,bfh
+			db	90h,78h,7dh,05h,b3h,d6h,abh,55h
+			db	cah,bah,29h,46h,05h,08h,d1h,fbh
+			db	dfh,71h,c1h,e9h,6eh,a3h,1dh,21h
+			db	cfh,51h,52h,a3h,c4h,d0h,d6h,abh
+			db	58h,b3h,93h,f2h,e2h,15h,b9h,91h
+			db	4bh,eeh,99h,21h,20h,9bh,bah,d2h
+			db	10h,d7h,0fh,3ch,b1h,b2h,48h,15h
+			db	c3h,76h,1bh,53h
+			sbc	a,l
+			or	c
+			call	nz,L263b
+			cp	b
+			inc	hl
+			dec	l
+			add	a,(hl)
+			or	a
+			jp	m,L816b
+			out	(4fh),a
+			ld	e,h
+			set	1,(ix + 250)
+			sub	d
+			ld	(hl),a
+			cp	h
+			ld	h,(hl)
+			xor	e5h
+			and	1fh
+			call	p,L8119
+			out	(bch),a
+			jp	nc,Ld9ab
+			cp	(hl)
+			ret	z
+			cp	e
+			rra
+			ccf
+			sbc	a,45h
+			rra
+			ld	l,l
+			and	(hl)
+			sub	c
+			xor	d
+			ld	(hl),a
+			sub	b
+			add	hl,hl
+			adc	a,f3h
+			xor	3dh
+			in	a,(32h)
+			and	a
+			cp	l
+			rst	38h
+			dec	e
+			ld	h,a
+			in	a,(8eh)
+			ld	(hl),h
+			inc	sp
+			ld	d,h
+			inc	e
+			jp	(hl)
+			db	81h,d3h,18h,35h,2fh,e0h,1ah,ceh
+			db	15h,d1h
+			ld	h,a
+			dec	(hl)
+			ld	h,e
+			ld	hl,34dah
+			or	(hl)
+			or	e
+			rst	08h
+			ld	c,e
+			ld	bc,ee5bh
+			and	adh
+			and	47h
+			ld	c,a
+			ld	(de),a
+			ld	a,c
+			jp	(hl)
+			db	49h,58h,0fh,51h,44h,f2h,7bh,69h
+			db	aeh,f2h,a5h,0eh,0ah,afh,27h,b5h
+			db	47h,25h,9bh,cdh,61h,3fh,fah,8fh
+			db	25h
+			ld	c,b
+			ld	b,a
+			ret	pe
+			and	l
+			adc	a,(hl)
+			sub	e
+			push	bc
+			ld	(hl),h
+			ret	pe
+			or	c
+			call	m,Lb4e4
+			cp	a
+			ld	e,17h
+			ret	p
+			ld	h,l
+			djnz	Lb340
+			inc	bc
+			ld	h,c
+			add	a,h
+			ld	e,d
+			jr	c,Lb2a0
+			push	hl
+			jr	nc,Lb30a
+			ret	po
+			ld	(3026h),hl
+			ld	d,c
+			push	de
+			inc	h
+			ld	d,(hl)
+			ret	pe
+			add	hl,hl
+			ld	d,h
+			ld	a,b
+			ld	d,a
+			or	b
+			inc	(hl)
+			sbc	a,b
+			ld	h,l
+			call	m,L7450
+			ld	l,h
+			cp	b
+			ld	e,b
+			add	a,c
+			or	a
+			ld	e,a
+			sbc	a,c
+			ld	(hl),h
+			ld	(hl),c
+			ld	a,(bc)
+			sbc	a,e
+			ld	l,e
+			jp	c,L0372
+			ld	b,e
+			ld	e,b
+			jp	pe,L15a6
+			ld	a,d
+			djnz	Lb2cb
+			in	a,(62h)
+			ld	a,a
+			ld	e,a
+			ld	a,(bc)
+			cp	h
+			call	pe,L1c7b
+			or	h
+			rst	00h
+			ld	h,e8h
+			ld	c,c
+			ret	nz
+			and	5ch
+			cp	l
+			and	(hl)
+			ld	l,(hl)
+			ret
+			db	21h,45h,69h,23h,89h,a0h,d6h,76h
+			db	efh,90h,b4h,dbh,3ah,32h
+			dec	l
+			rst	38h
+			dec	l
+			ld	l,(hl)
+			adc	a,a
+			dec	(hl)
+			adc	a,(hl)
+			ld	a,(de)
+			ld	c,c
+			cp	l
+			jr	c,Lb3ad
+			dec	l
+			ld	d,l
+			xor	d
+			jp	po,Lf214
+			jp	pe,Lf039
+			add	a,(hl)
+			xor	e0h
+			sbc	a,h
+			ld	a,e
+			ld	l,b
+			rst	18h
+			jp	po,L484d
+			and	8eh
+			jp	p,La013
+			ex	de,hl
+			nop
+			sbc	a,(hl)
+			rrca
+			ld	e,80h
+			ld	b,e
+			rst	20h
+			ret	nz
+			dec	e
+			inc	e
+			dec	c
+			ld	h,d
+			dec	hl
+			ld	c,d
+			xor	l
+			ld	b,h
+			xor	98h
+			cpl
+			ret	m
+			adc	a,b
+			ld	a,e3h
+			sub	h
+			ld	(hl),l
+			call	pe,L037e
+			ld	l,h
+			dec	de
+			ld	l,e
+			ld	l,e
+			sub	e
+			ld	b,h
+			rst	18h
+			ld	(hl),a
+			ld	b,(hl)
+			sbc	a,c
+			call	p,Lcddc
+			ld	(61dch),a
+			ld	d,c
+			ld	(hl),e
+			ld	h,d
+			ld	l,60h
+			or	a
+			add	a,h
+			dec	a
+			dec	hl
+			ret	nc
+			adc	a,l
+			ld	l,e
+			jr	nz,Lb381
+			ld	c,l
+			ld	hl,51f0h
+			nop
+			ld	l,c
+			ld	(de),a
+			ld	a,e
+			di
+			inc	hl
+			adc	a,c
+			dec	d
+			call	m,Lfe3c
+			sbc	a,a2h
+			add	a,90h
+			ld	c,c
+			push	de
+			ld	l,e
+			scf
+			add	hl,de
+			push	de
+			ret	p
+			ld	a,b
+			jp	nc,L691e
+			inc	a
+			cp	d
+			sub	c
+			in	a,(d1h)
+			ld	b,b
+			sbc	a,h
+			ret	nc
+			and	a
+			or	a
+			and	a
+			dec	hl
+			dec	de
+			ld	d,a
+			nop
+			ld	a,b
+			inc	l
+			sbc	a,a
+			or	d
+			ld	h,l
+			call	po,Le5a8
+			ld	a,b
+			adc	a,(hl)
+			ret	nz
+			ld	e,a
+			inc	h
+			and	5ah
+			add	a,(hl)
+			ld	e,44h
+			and	e
+			ld	h,h
+			inc	b
+			ld	a,d
+			ret	nc
+			ld	(hl),fch
+			ex	(sp),hl
+			set	1,d
+			ld	(hl),e2h
+			call	p,L2b0a
+			ld	(hl),l
+			ld	h,a
+			cpl
+			or	d
+			ld	c,e
+			ld	a,a
+			and	h
+			and	10h
+			ld	c,b
+			ld	b,(hl)
+			jp	nz,Lf26f
+			and	l
+			ret	p
+			ld	e,l
+			dec	a
+			rst	10h
+			inc	(hl)
+			jp	nz,L03a8
+			dec	(hl)
+			jr	nc,Lb3f6
+			call	m,Lcf6b
+			jp	nc,Lda7b
+			ld	c,a
+			push	af
+			jr	c,Lb487
+			pop	hl
+			ld	b,5dh
+			dec	hl
+			ld	(2ce0h),hl
+			cp	d
+			or	h
+			cp	e
+			dec	c
+			rst	38h
+			adc	a,65h
+			ret	m
+			and	d
+			ld	(hl),h
+			xor	l
+			rst	28h
+			sub	l
+			inc	l
+			ld	sp,8842h
+			set	0,(hl)
+			ld	e,c
+			ret	c
+			or	l
+			dec	sp
+			ld	l,a
+			adc	a,l
+			rst	28h
+			sbc	a,(hl)
+			ld	(bc),a
+			dec	l
+			jp	p,La050
+			nop
+			ld	hl,c723h
+			ret	c
+			add	a,c
+			and	61h
+			nop (2x) *
+			ld	a,b
+			dec	a
+			ld	l,d
+			jr	c,Lb4c2
+			dec	(hl)
+			jp	m,La634
+			add	hl,bc
+			ld	b,b
+			sbc	a,h
+			jp	nc,L4fc7
+			rst	08h
+			xor	e
+			ccf
+			inc	d
+			ld	b,h
+			ld	a,l
+			call	nc,Ld66f
+			and	(hl)
+			xor	h
+			sub	h
+			ld	hl,(c8f7h)
+			ld	h,c
+			ret	p
+			ex	de,hl
+			cp	b
+			ld	l,h
+			pop	de
+			or	a5h
+			and	a
+			xor	b
+			sub	04h
+			push	af
+			call	c,Lcefc
+			ld	a,e
+			rra
+			pop	af
+			sub	l
+			adc	a,b
+			dec	e
+			daa
+			cp	e
+			rst	30h
+			ld	hl,e40bh
+			ld	(4902h),hl
+			ld	(hl),d
+			ld	l,c
+			call	po,Lb78d
+			add	a,c
+			ld	(de),a
+			adc	a,c
+			ld	(hl),d
+			daa
+			ld	e,e
+			ld	a,b
+			push	af
+			or	b
+			sub	h
+			ld	l,e3h
+			add	hl,hl
+			ld	b,h
+			cp	d
+			ex	(sp),hl
+			or	e
+			ld	l,(hl)
+			sub	h
+			ld	a,d
+			sub	e
+			ld	(bc),a
+			pop	de
+			xor	a
+			sub	(hl)
+			ret
+			sub	(hl)
+			ld	e,(hl)
+			ccf
+			ld	e,(hl)
+			dec	l
+			cp	(hl)
+			ret
+			db	02h,06h,42h,06h,36h,9ch,9bh,eah
+			ld	a,(hl)
+			add	a,e
+			sub	c
+			ld	(hl),h
+			nop (2x) *
+			ld	d,d
+			ld	a,d
+			ld	d,c
+			dec	hl
+			ld	h,d
+			or	a
+			ld	e,d
+			ld	l,b
+			jr	Lb516
+			db	39h,58h,28h,96h,93h
+			call	nz,L5cd3
+			ld	l,d
+			ld	(hl),c
+			and	c
+			and	c
+			dec	b
+			xor	24h
+			jr	z,Lb4a9
+			ld	e,b
+			ld	(hl),a3h
+			djnz	Lb4c1
+			inc	h
+			ld	a,(bc)
+			adc	a,a
+			ld	hl,4d90h
+			dec	a
+			ld	d,l
+			inc	de
+			bit	2,d
+			and	l
+			ld	h,e
+			ei
+			ld	e,(hl)
+			add	hl,de
+			adc	a,d
+			cpl
+			ld	d,b
+			rla
+			ld	l,ebh
+			ld	e,e
+			rst	18h
+			and	e
+			ex	(sp),hl
+			xor	c
+			ld	h,d
+			inc	c
+			jr	nc,Lb4f2
+			ld	d,b
+			ld	hl,(f9c3h)
+			and	a
+			ld	d,a
+			xor	c
+			add	a,b
+			jp	p,Laae7
+			or	16h
+			sub	a
+			di
+			dec	c
+			ex	de,hl
+			ld	hl,c6b2h
+			ld	c,d
+			ld	c,(hl)
+			inc	a
+			rst	00h
+			sbc	a,l
+			adc	a,d
+			ld	d,h
+			daa
+			xor	l
+			ld	b,(hl)
+			ld	l,a
+			call	nc,La408
+			add	hl,bc
+			sbc	a,46h
+			ld	h,d
+			ld	c,h
+			ld	h,b
+			call	nc,Le72f
+			ld	(hl),d
+			ld	(hl),a
+			jr	c,Lb4c3
+			ret	p
+			ld	c,l
+			rla
+			inc	de
+			sub	h
+			ld	a,h
+			ld	l,h
+			inc	e
+			sbc	a,b
+			adc	a,c
+			ld	h,l
+			call	m,L81cb
+			ld	e,l
+			ld	l,c
+			adc	a,(hl)
+			ei
+			ld	a,(ab21h)
+			ld	(hl),e
+			and	(hl)
+			ld	h,d
+			ld	l,(hl)
+			ld	hl,(07ceh)
+			rst	38h
+			and	b
+			ld	c,b
+			ld	c,h
+			ld	a,d
+			xor	d
+			ld	(hl),b
+			rst	38h
+			xor	b
+			xor	cbh
+			pop	hl
+			ld	e,a
+			or	h
+			cp	d
+			ld	(ae8ch),a
+			ld	b,34h
+			pop	de
+			ld	(hl),e
+			ret	nc
+			pop	de
+			ld	e,d
+			or	b
+			sbc	a,(hl)
+			ld	h,c
+			cpl
+			rst	00h
+			ld	e,b
+			cp	5bh
+			sub	afh
+			and	h
+			in	a,(06h)
+			ld	h,a
+			ld	h,d
+			jp	z,L5886
+			ld	c,d1h
+			ld	(hl),c
+			scf
+			ld	l,46h
+			ld	d,e
+			ld	e,c
+			ld	a,d
+			add	a,c
+			pop	hl
+			sbc	a,(hl)
+			ld	a,(hl)
+			ld	b,l
+			rst	38h
+			inc	sp
+			ld	l,a
+			sub	d
+			ld	sp,hl
+			cp	c
+			ld	b,e
+			ccf
+			push	bc
+			cp	e
+			ld	e,c
+			ld	b,94h
+			pop	af
+			ld	c,l
+			halt
+			add	a,d
+			ld	e,(hl)
+			sub	c
+			call	Le7f4
+			ld	d,h
+			pop	de
+			call	L1b41
+			ld	d,e
+			ld	e,(hl)
+			dec	h
+			ld	b,c
+			and	h
+			push	af
+			dec	b
+			inc	h
+			add	a,(hl)
+			ld	a,d
+			add	hl,hl
+			xor	d
+			ex	af,af'
+			ld	d,e
+			pop	bc
+			push	af
+			ld	l,a
+			sub	d
+			ld	l,a3h
+			adc	a,(hl)
+			sub	l
+			sbc	a,a
+			ld	h,l
+			cp	e
+			halt
+			ld	(hl),h
+			ld	c,d
+			call	z,L497a
+			inc	a
+			ex	de,hl
+			call	c,L07f9
+			nop
+			scf
+			xor	l
+			ld	h,c
+			xor	e
+			ld	ixl,e8h
+			inc	(hl)
+			call	L6a91
+			add	hl,sp
+			ld	h,l
+			inc	bc
+			rst	10h
+			xor	fch
+			add	a,h
+			and	l
+			ld	h,e
+			ld	e,e
+			adc	a,a
+			sbc	a,c
+			inc	(hl)
+			cp	b
+			in	a,(00h)
+			jp	(hl)
+			db	04h
+			rst	00h
+			ld	c,(hl)
+			ld	(hl),e
+			rst	30h
+			ret	pe
+			ld	(hl),b
+			ret	nc
+			cp	d
+			call	p,Lbd45
+			rst	18h
+			cp	c
+			exx
+			ld	l,b
+			ld	a,d
+			ld	hl,(3308h)
+			dec	a
+			xor	c
+			ld	e,e
+			call	m,L109d
+			dec	d
+			ld	a,e
+			or	d
+			ret	nc
+			ld	c,e
+			ld	(de),a
+			jr	nc,Lb640
+			ld	h,l
+			ld	a,(hl)
+			add	a,l
+			ld	(bc),a
+			add	a,a
+			ret	m
+			adc	a,l
+			ld	(hl),feh
+			ld	b,d
+			ld	c,h
+			dec	hl
+			jp	nz,Lab24
+			ld	(hl),h
+			ld	(hl),b
+			ld	a,b
+			ld	a,l
+			inc	e
+			sub	l
+			sub	92h
+			jr	z,Lb5ed
+			sub	d
+			ld	a,b
+			ld	e,h
+			or	(hl)
+			ld	e,h
+			ex	af,af'
+			ld	h,3fh
+			ld	b,(hl)
+			ld	h,e
+			or	(hl)
+			or	e
+			ld	b,(hl)
+			ret
+			db	62h,61h,8fh
+			ld	a,(bc)
+			jp	nc,L08d5
+			sub	b
+			ld	sp,hl
+			sub	d
+			xor	bbh
+			inc	hl
+			ld	a,h
+			ld	(hl),d
+			ld	c,(hl)
+			or	h
+			nop (2x) *
+			ld	e,e0h
+			ccf
+			call	Lc4f5
+			ld	e,a
+			ld	d,b
+			call	nz,L5945
+			ld	l,l
+			ld	b,l
+			ld	c,d
+			ld	c,l
+			res	6,b
+			ld	h,c
+			ld	h,e
+			and	e
+			sub	l
+			inc	l
+			and	d
+			ld	h,d
+			ld	h,h
+			jp	(hl)
+			db	d5h,31h,2fh,50h,80h,b7h,8dh,0bh
+			db	d6h,08h,38h,4bh,8eh,bch,60h,93h
+			db	4fh,d2h,8fh,f0h,13h,fch,23h,63h
+			db	bch
+			call	p,Ld966
+			adc	a,b
+			dec	de
+			ld	(hl),c
+			and	d
+			inc	sp
+			cp	(hl)
+			ret	c
+			ld	a,(de)
+			rl	c
+			cp	c
+			ld	d,l
+			call	c,L5878
+			ld	d,e
+			jp	m,L1d51
+			ld	c,a
+			call	c,L8322
+			sbc	a,h
+			ld	h,b
+			ld	a,d
+			sbc	a,3eh
+			inc	(hl)
+			cp	5eh
+			or	a
+			ld	(hl),b9h
+			inc	b
+			and	e
+			bit	4,(hl)
+			ld	b,d
+			nop
+			and	a
+			ld	b,e
+			ld	(hl),e
+			nop
+			xor	e
+			xor	a
+			ld	c,h
+			jp	Ld59c
+			db	2ah,35h,99h,0ah,00h,f5h,42h,85h
+			db	a5h,fbh,c7h,dah,7dh,b7h,e6h,f8h
+			db	c2h,9ah,ceh,05h,3ch,23h,19h,e7h
+			db	1ch,31h,eah,9dh,42h,b6h,8eh,b7h
+			db	85h,ebh,fch,fbh
+			ld	d,l
+			xor	ebh
+			or	a
+			adc	a,c
+			jr	z,Lb696
+			pop	hl
+			ld	c,e
+			rst	10h
+			xor	d
+			out	(d3h),a
+			jr	nz,Lb760
+			ret	c
+			ld	c,a
+			inc	b
+			jp	po,Le382
+			sbc	a,b
+			and	e
+			sbc	a,e
+			or	(hl)
+			rst	38h
+			ld	bc,8798h
+			inc	c
+			ld	b,h
+			add	a,e
+			adc	a,c
+			cp	bch
+			scf
+			ld	e,(hl)
+			rla
+			ret	z
+			sub	b
+			ld	(hl),d
+			cp	e
+			ld	a,c
+			or	d
+			ld	a,ceh
+			ret	nc
+			ld	a,b1h
+			ld	b,h
+			add	hl,sp
+			and	b
+			dec	hl
+			or	d
+			ld	(hl),l
+			in	a,(02h)
+			call	p,L60fc
+			ld	b,e
+			ld	a,(hl)
+			ld	b,h
+			add	a,c
+			ld	(hl),d
+			ld	c,d
+			ld	(hl),b
+			add	a,(hl)
+			adc	a,d
+			ld	h,h
+			push	de
+			sbc	a,c
+			call	c,L69df
+			cp	e
+			sub	e
+			ld	(bc),a
+			cp	b
+			nop (2x) *
+			ld	a,e
+			or	l
+			sbc	a,(hl)
+			dec	bc
+			in	a,(b5h)
+			ld	b,h
+			call	pe,Ld9fc
+			ret	po
+			jp	Lda5f
+			db	ffh,55h,b2h,49h,08h,b1h,dah,36h
+			db	18h,edh,7ah,1dh,d1h,5eh,7ah,70h
+			db	69h,f6h,93h,a7h,f7h
+			ret	po
+			or	l
+			ld	c,b
+			in	a,(f9h)
+			xor	l
+			cp	0ah
+			sbc	a,d
+			call	m,L49cc
+			rra
+			add	a,d
+			ld	e,d
+			inc	hl
+			or	93h
+			inc	bc
+			ld	c,e
+			dec	sp
+			ld	b,6fh
+			ld	(hl),80h
+			dec	hl
+			ld	b,b3h
+			ld	hl,cb61h
+			cp	a
+			ld	l,e
+			pop	bc
+			rla
+			out	(1dh),a
+			ld	hl,f481h
+			sbc	a,l
+			ld	(hl),l
+			ld	(hl),d3h
+			ld	(hl),h
+			ld	a,e
+			ld	h,(hl)
+			push	bc
+			dec	e
+			adc	a,c
+			ld	b,(hl)
+			ld	e,d
+			rra
+			or	l
+			jr	c,Lb74e
+			sub	c
+			call	p,Lf532
+			di
+			add	hl,de
+			nop
+			dec	c
+			ld	(02ebh),hl
+			sbc	a,02h
+			xor	h
+			ld	d,85h
+			ld	h,e
+			or	(hl)
+			sbc	a,l
+			ccf
+			call	L4dd1
+			ld	b,c
+			ld	b,(hl)
+			adc	a,b
+			sbc	a,a
+			add	hl,hl
+			add	a,a
+			ex	(sp),hl
+			cp	d
+			push	hl
+			sbc	a,d
+			adc	a,c
+			ld	a,(7d9ah)
+			ld	sp,hl
+			dec	(hl)
+			or	b
+			rst	08h
+			ld	h,d
+			ld	c,(hl)
+			ld	c,h
+			adc	a,h
+			ld	h,(hl)
+			ld	sp,e1dah
+			cpl
+			rst	38h
+			inc	h
+			ld	a,1eh
+			or	h
+			add	a,l
+			cp	c
+			ld	c,(hl)
+			sbc	a,h
+			push	af
+			or	c
+			sbc	a,e
+			ld	(hl),c
+			add	a,c
+			or	e
+			jp	p,L2595
+			xor	l
+			ld	l,(hl)
+			inc	sp
+			adc	a,(hl)
+			call	nz,L2bb6
+			inc	h
+			ld	c,b
+			ret	nc
+			rst	20h
+			add	a,h
+			inc	h
+			add	hl,bc
+			dec	a
+			xor	h
+			ld	d,e
+			ld	(5bdeh),a
+			inc	sp
+			cp	b
+			inc	b
+			ld	b,b
+			ld	a,(bc)
+			sub	c
+			ld	e,l
+			ld	h,d
+			jr	Lb7e3
+			db	dfh,76h,22h,c4h,98h,2bh,0eh,7ch
+			db	a6h,61h,3fh,b0h,dah,f4h,afh,3bh
+			db	45h,cdh,ach
+			and	c
+			rst	10h
+			jp	L675d
+			db	35h,d0h,5bh,7ah,25h,aeh,4bh,5fh
+			db	efh,04h,80h,9fh,22h,18h,44h,37h
+			db	91h,d2h,9dh,dah,e5h,6eh,2ch,e7h
+			db	d7h,e9h,abh,e8h,66h,79h,9ch,a8h
+			db	beh,74h,4dh,81h,a0h,78h,cbh,4bh
+			db	8fh,0ch,48h,80h
+			jp	Lcb21
+			db	50h
+			ld	h,a
+			ld	c,(hl)
+			jp	p,Lb853
+			ld	hl,8ab0h
+			nop (2x) *
+			push	de
+			add	a,b
+			sbc	a,e
+			dec	hl
+			cpl
+			ld	(hl),d
+			dec	e
+			nop (2x) *
+			or	e
+			or	c
+			adc	a,21h
+			cpl
+			dec	de
+			add	a,b
+			xor	e
+			or	(hl)
+			rst	00h
+			adc	a,(hl)
+			ld	d,a
+			rla
+			rst	38h
+			nop
+			inc	c
+			add	a,(hl)
+			ld	e,l
+			adc	a,c
+			ret
+			db	afh,71h,43h,43h,7ch,bch,61h,f5h
+			db	06h,4bh,c9h,33h,f7h,21h,e7h,5fh
+			db	73h,cfh,ach,e8h
+			di
+			call	L30d3
+			ld	h,46h
+			ld	(hl),69h
+			ld	c,b
+			rst	08h
+			add	hl,bc
+			sbc	a,b
+			and	a
+			ld	h,c
+			sbc	a,l
+			xor	l
+			exx
+			indr
+			ld	d,e
+			ld	(hl),a
+			ld	l,d
+			adc	a,c
+			in	a,(2ah)
+			dec	c
+			sbc	a,b
+			push	de
+			ei
+			dec	(hl)
+			jp	(hl)
+			db	2ch,46h,cbh,5ah,b2h,bdh,6bh,46h
+			db	78h,78h,b2h,f6h,b6h,8eh,d4h,74h
+			db	4dh,bch,a6h,edh,0ah,63h,92h,0ch
+			db	54h,15h,b3h,ebh,bdh,8ch,5ah,40h
+			db	35h,70h,42h,64h,8ch,3bh,9eh,73h
+			db	6ah,87h,e4h,05h,beh,47h,7bh,fah
+			db	37h,7bh,7ah,5bh,fah,b2h,61h,87h
+			db	c5h,02h,53h,72h,06h,a7h,81h,f8h
+			db	74h,9ch,f3h,e2h,8dh,53h,d7h,c7h
+			db	57h,5ah,56h,d9h,c6h,55h,edh,2fh
+			db	00h
+			add	hl,bc
+			and	l
+			dec	hl
+			ret	z
+			call	pe,L0ed1
+			cp	fdh
+			adc	a,(hl)
+			ret
+			db	2eh,f6h,c9h,29h,70h,ech,61h,c8h
+			db	68h,63h,2fh,ech,a4h
+			ret
+			db	b6h,16h,ech,4fh,edh,efh,66h,99h
+			db	6dh,5fh,50h,2eh,5fh,47h,8dh,c7h
+			db	4eh,b6h,e5h,23h,7fh,33h,aah,64h
+			db	aeh,deh,13h,fah,48h,adh,dch,19h
+			db	41h,f0h,b7h,a4h,4ch,4ch,87h,3ch
+			db	31h,d8h,0bh,73h,d7h,8ch,dfh,c6h
+			db	a6h,28h,62h,fah,3bh,7dh,9eh,d2h
+			db	57h,b5h,a0h,1eh,25h,f5h,64h,06h
+			db	d7h,2eh,ddh,9ah,96h,b8h,3ch,b5h
+			db	66h
+			inc	a
+			adc	a,h
+			jp	p,L075f
+			ld	c,d
+			add	a,e
+			ld	e,h
+			pop	hl
+			rrca
+			and	c
+			djnz	Lb8d9
+			rra
+			add	a,(hl)
+			ei
+			pop	de
+			and	c
+			dec	de
+			adc	a,h
+			add	a,c
+			ld	h,l
+			add	a,a
+			ld	a,(de)
+			ld	c,l
+			ld	(bc),a
+			dec	e
+			jr	nz,Lb9c2
+			dec	l
+			jr	c,Lb8f1
+			dec	e
+			or	c
+			ld	b,l
+			or	a
+			rla
+			inc	a
+			ld	d,b
+			xor	96h
+			rrca
+			ld	b,e
+			xor	d
+			ld	(1c53h),hl
+			cp	a
+			jp	nc,L67bd
+			ld	a,l
+			ld	e,l
+			cp	b
+			push	hl
+			ld	a,b
+			xor	94h
+			ld	h,h
+			dec	(hl)
+			call	L9774
+			rst	28h
+			ld	(hl),18h
+			pop	hl
+			inc	bc
+			ei
+			ld	hl,8bfeh
+			call	nc,L182a
+			ld	d,a1h
+			ret	po
+			jp	po,Ldc9f
+			inc	bc
+			rst	00h
+			rlca
+			ld	(cb0ah),a
+			nop
+			cp	3ch
+			ld	e,(hl)
+			ld	(hl),e
+			dec	bc
+			ld	c,h
+			ld	e,l
+			ld	a,l
+			dec	hl
+			sub	e
+			ld	l,h
+			ld	h,h
+			ld	e,e
+			rst	30h
+			call	z,L0a3e
+			ld	l,a
+			and	d
+			ex	af,af'
+			add	a,h
+			pop	de
+			adc	a,h
+			jr	nz,Lb97f
+			or	b
+			ex	(sp),hl
+			sbc	a,l
+			ld	a,l
+			sub	73h
+			add	a,60h
+			pop	af
+			or	h
+			jp	p,Lb42b
+			ret	z
+			ex	(sp),hl
+			ld	a,d
+			jr	nc,Lb9e2
+			ld	h,h
+			or	(hl)
+			or	(hl)
+			add	a,b
+			push	de
+			ld	sp,6a4ah
+			ld	c,e
+			nop
+			dec	d
+			ld	b,b
+			ld	e,e
+			add	a,l
+			adc	a,h
+			xor	h
+			ld	c,c
+			ld	(hl),a
+			ld	(hl),92h
+			or	b
+			ld	c,d
+			ld	sp,e370h
+			ei
+			rst	00h
+			pop	hl
+			ld	d,d
+			call	nz,L5faa
+			ld	l,7ah
+			ex	de,hl
+			jp	nc,L5622
+			ld	(bc),a
+			inc	hl
+			ret	c
+			ld	e,(hl)
+			sbc	a,h
+			ld	a,h
+			adc	a,b
+			ld	c,h
+			ld	c,c
+			ld	c,l
+			rst	20h
+			add	hl,bc
+			jp	c,La26a
+			ld	de,294ah
+			xor	a
+			djnz	Lb9f0
+			adc	a,d
+			ex	(sp),hl
+			cp	5ch
+			pop	hl
+			add	hl,de
+			sbc	a,h
+			ld	e,c
+			dec	e
+			ld	c,b
+			rst	10h
+			ld	a,(hl)
+			xor	d
+			sbc	a,l
+			inc	b
+			ld	d,d
+			ld	(hl),l
+			rst	08h
+			inc	d
+			ld	(hl),d
+			ld	h,d
+			ld	d,l
+			adc	a,c
+			inc	bc
+			jp	L44bf
+			db	19h,28h,77h,5bh,93h,4fh,a5h,2eh
+			db	a1h,c6h,45h,6fh,bch,19h,0ah,f6h
+			db	33h,c7h,83h,f4h,c0h
+			ld	d,l
+			ld	bc,e30eh
+			ld	e,d
+			rrca
+			jp	po,Lc41a
+			ld	h,h
+			ld	h,e
+			out	(afh),a
+			adc	a,l
+			ld	a,66h
+			sbc	a,e
+			pop	af
+			ld	(de),a
+			ld	e,(hl)
+			jp	z,L9c3a
+			or	a
+			ret	c
+			ld	l,01h
+			ld	(hl),h
+			add	a,h
+			call	p,Lbab5
+			ld	c,(hl)
+			di
+			and	a
+			cp	a
+			sub	e
+			ld	a,d7h
+			dec	d
+			ld	c,d
+			sub	c
+			sub	b
+			dec	de
+			cp	d
+			rlca
+			ld	h,h
+			jp	nc,L5331
+			dec	d
+			jp	pe,La7c3
+			or	h
+			ld	(hl),l
+			rst	38h
+			ld	b,d
+			ld	c,a
+			scf
+			xor	87h
+			ld	(hl),b
+			ld	a,d
+			ld	a,(898bh)
+			xor	c
+			dec	e
+			or	5ah
+			ld	h,e
+			ld	a,(hl)
+			ld	(iy + 5eh),a
+			jp	p,L08f9
+			ld	d,h
+			ld	e,l
+			cp	h
+			adc	a,d
+			dec	de
+			jr	Lbae5
+			db	b7h,7bh,60h,22h,21h,56h,07h,43h
+			db	27h,26h,29h,28h,feh,81h,06h,0dh
+			db	2ch,6bh,dbh,ebh,86h,95h,c6h,39h
+			db	f8h,3ch,2ch,0eh,69h,1fh,e6h,f5h
+			db	16h,52h,a5h,41h,b6h,01h,1ch
+			sbc	a,a
+			ld	h,l
+			call	nc,L1fca
+			push	hl
+			ld	a,(bc)
+			inc	(hl)
+			ret	p
+			sbc	a,l
+			ld	l,c
+			add	a,a
+			or	h
+			ret	m
+			or	l
+			jr	Lbac7
+			db	1bh,1ch,bdh,93h,a2h,6eh,d9h,50h
+			db	22h,34h,6dh,44h,a4h,45h,62h,cfh
+			jp	Lc088
+			db	bbh,06h,c1h,88h,48h,ceh,aeh,66h
+			db	45h,e9h,a6h,8ah,3dh,c8h,1bh,42h
+			db	a8h,0bh,43h,e3h,fah,8eh,4eh,56h
+			db	8eh,d6h
+			nop (2x) *
+			call	nz,L4363
+			xor	c
+			ld	e,b
+			call	p,L8180
+			ld	e,l
+			ld	a,e
+			add	a,e
+			or	l
+			sub	27h
+			inc	l
+			sub	56h
+			ld	(hl),c
+			ld	a,d
+			ld	h,l
+			out	(70h),a
+			add	hl,hl
+			ld	(hl),e
+			ret	nz
+			dec	a
+			ret	po
+			pop	hl
+			ld	e,c
+			ld	b,h
+			djnz	Lbb26
+			ld	h,e
+			ld	a,l
+			adc	a,l
+			cpl
+			ld	(hl),b
+			ld	b,(hl)
+			cpl
+			ld	a,h
+			add	a,(hl)
+			call	p,L4327
+			and	b
+			ld	de,4f77h
+			adc	a,a
+			rst	08h
+			nop
+			call	m,L63b5
+			ret
+			db	4ch,46h,79h,1ch,5fh,68h,85h,80h
+			db	b1h,79h
+			ret	z
+			ld	de,67e5h
+			pop	bc
+			dec	d
+			ld	d,l
+			jp	m,L4a7f
+			out	(85h),a
+			pop	af
+			call	po,L187e
+			ld	e,a
+			or	l
+			jp	z,Lb682
+			adc	a,l
+			xor	l
+			cp	l
+			rst	20h
+			sbc	a,a
+			sub	b
+			ld	b,b
+			pop	bc
+			jp	m,L22f8
+			adc	a,e
+			or	e
+			pop	hl
+			and	e
+			ld	e,l
+			ld	e,e
+			or	e
+			ld	a,(hl)
+			rlca
+			dec	bc
+			jr	nc,Lbb2a
+			jr	z,Lbae4
+			ret	m
+			and	a
+			xor	e
+			adc	a,d
+			ld	c,(hl)
+			jr	nz,Lbb53
+			ld	a,c
+			ex	de,hl
+			cp	b
+			and	(hl)
+			ld	b,d
+			ld	l,24h
+			di
+			inc	l
+			ld	h,(hl)
+			call	m,Lda5e
+			call	nz,L0f77
+			inc	hl
+			add	a,a
+			xor	b
+			add	a,b
+			dec	h
+			jp	nz,Lab7f
+			ld	d,d
+			ld	bc,46bbh
+			cp	(hl)
+			ld	a,0ah
+			ld	c,h
+			ld	h,c
+			ld	h,c
+			sub	b
+			ld	h,77h
+			and	39h
+			jp	L10d4
+			db	1bh,42h,08h,f7h,6ch,95h,cah,38h
+			db	80h,59h,3dh,7fh,38h,55h,1ah,fah
+			db	47h,dfh,7ch,1ah,5ah
+			ld	c,e
+			dec	(hl)
+			cp	l
+			adc	a,(hl)
+			and	a
+			pop	de
+			ld	l,d
+			ld	b,82h
+			pop	af
+			ld	(hl),c
+			sub	(hl)
+			ld	e,c
+			ret	p
+			ld	a,l
+			sbc	a,(hl)
+			inc	hl
+			jp	pe,L0bdb
+			ld	h,d
+			ld	h,e
+			and	d
+			ld	(hl),e
+			ld	a,d
+			ld	e,l
+			sub	h
+			nop
+			djnz	Lbb9a
+			ld	b,h
+			call	pe,L4c93
+			add	a,5bh
+			rla
+			ld	d,e
+			ld	(hl),c
+			ld	e,e
+			cp	e
+			ld	b,(hl)
+			xor	e
+			inc	hl
+			sub	h
+			and	(hl)
+			call	nc,L545c
+			or	b
+			inc	d
+			ret	nc
+			ld	e,l
+			rst	30h
+			rst	18h
+			push	de
+			xor	(hl)
+			cp	d
+			ld	c,l
+			call	m,L3f86
+			adc	a,e
+			adc	a,(hl)
+			ex	af,af'
+			ld	d,c
+			pop	bc
+			cp	b
+			ld	b,b
+			xor	c
+			ld	a,(hl)
+			pop	bc
+			cp	cah
+			daa
+			ld	c,c
+			ld	a,b
+			rst	10h
+			xor	d6h
+			add	a,c
+			ret	nc
+			xor	b
+			adc	a,h
+			jr	nc,Lbbee
+			xor	c
+			and	c
+			add	a,b
+			sbc	a,(hl)
+			nop (2x) *
+			xor	96h
+			bit	1,e
+			sbc	a,d
+			nop (2x) *
+			add	a,e
+			ld	l,e
+			ld	l,08h
+			jp	c,L01f6
+			ld	a,l
+			and	c
+			or	(hl)
+			cp	l
+			ld	a,h
+			jp	Lfeee
+			db	dfh
+			ld	hl,56e0h
+			ld	b,(hl)
+			ld	l,h
+			cp	d
+			ex	(sp),hl
+			ld	c,c
+			rla
+			cp	c9h
+			ld	h,03h
+			xor	c
+			inc	l
+			and	d
+			ld	d,e
+			ld	e,e
+			rra
+			inc	b
+			ld	l,b
+			ld	h,b
+			call	Ldc78
+			sub	h
+			call	nc,Lf234
+			and	e
+			ld	d,c
+			dec	b
+			add	hl,hl
+			ld	(hl),c
+			ld	e,e
+			call	nz,L7740
+			rst	28h
+			rst	18h
+			and	(hl)
+			ld	a,h
+			sbc	a,c
+			ld	a,d
+			rst	00h
+			ld	sp,201ah
+			jp	nc,Lc1df
+			jp	nc,L343f
+			ld	b,l
+			add	a,b
+			ld	(9fd3h),a
+			ld	l,h
+			sbc	a,(hl)
+			add	a,d
+			adc	a,d
+			di
+			ret	pe
+			add	hl,hl
+			sbc	a,a
+			dec	(hl)
+			rlca
+			ld	a,(de)
+			sub	(hl)
+			and	e
+			push	hl
+			jp	p,L4f66
+			cp	d
+			ld	l,aah
+			xor	c
+			ld	l,h
+			jp	p,L6e40
+			adc	a,d
+			or	l
+			xor	b
+			jp	p,Lb93b
+			ret
+			db	05h,43h,4eh,cdh,dbh,e8h,20h,d9h
+			db	19h,0ch,abh,69h,c5h,90h,d4h,87h
+			db	0eh,fah,20h,53h
+			ret	z
+			rla
+			ld	hl,5815h
+			xor	(hl)
+			ld	e,c
+			xor	a
+			ld	d,69h
+			add	a,(hl)
+			ld	b,l
+			ld	d,c
+			ld	l,2bh
+			ld	a,(hl)
+			ld	l,h
+			call	z,L0902
+			add	a,d
+			ld	c,(hl)
+			jp	z,L9faa
+			pop	hl
+			dec	l
+			dec	sp
+			halt
+			pop	af
+			ld	e,l
+			ex	af,af'
+			sub	a
+			nop (2x) *
+			ex	de,hl
+			ld	l,e
+			ret	pe
+			xor	l
+			jp	c,La1fd
+			rst	28h
+			call	po,Lc51d
+			ld	d,43h
+			jp	(hl)
+			db	e3h,f7h,f8h,14h,b8h,e7h
+			jr	nc,Lbcb0
+			ld	(hl),a
+			ld	(hl),b
+			rst	08h
+			jr	z,Lbce2
+			inc	c
+			or	e
+			ld	e,b
+			push	af
+			ld	h,h
+			rla
+			add	a,l
+			rst	28h
+			dec	sp
+			ld	h,l
+			xor	e
+			sub	d
+			ld	b,d
+			dec	b
+			or	d
+			and	h
+			rst	28h
+			scf
+			add	hl,bc
+			inc	d
+			ret	po
+			ld	a,ixh *
+			xor	b
+			inc	h
+			ld	a,d
+			ld	l,l
+			ret	z
+			ret	po
+			cp	l
+			jp	(hl)
+			db	87h,a4h,6dh,ach,5dh,00h,6ah,30h
+			db	8ch,41h,51h,e5h
+			ld	l,c
+			ex	af,af'
+			add	a,(hl)
+			sub	d
+			ld	bc,5f13h
+			push	bc
+			scf
+			or	a
+			ld	hl,(eb84h)
+			ld	l,(hl)
+			ret
+			db	22h,25h,a2h,aah,a0h,c5h,86h,fbh
+			db	18h,a2h,a7h,0eh,e2h,26h,71h,beh
+			db	0dh,fbh,67h,75h,15h,2ch,7ch,36h
+			db	f4h,50h
+			ret	pe
+			ld	e,l
+			add	hl,hl
+			ld	h,a
+			call	nz,L9832
+			sub	(hl)
+			ld	e,h
+			xor	ddh
+			adc	a,12h
+			cp	c
+			ld	(hl),a3h
+			ld	sp,hl
+			cp	l
+			push	hl
+			xor	d
+			dec	b
+			or	(hl)
+			inc	h
+			rst	38h
+			rst	00h
+			jr	c,Lbcd2
+			add	a,l
+			ld	b,c
+			xor	h
+			xor	b
+			ld	a,h
+			ld	bc,fecfh
+			ld	a,e
+			adc	a,b
+			ex	af,af'
+			halt
+			ld	c,c8h
+			ld	(hl),l
+			ld	b,d
+			inc	b
+			rst	20h
+			sbc	a,d
+			ld	e,(hl)
+			inc	e
+			inc	b
+			ld	d,c
+			nop (2x) *
+			call	m,L8f9d
+			ld	c,dfh
+			inc	l
+			ld	c,f1h
+			rlca
+			ld	e,a
+			ret	p
+			inc	e
+			ld	d,b
+			or	b
+			ld	(2cbah),a
+			ld	a,h
+			inc	bc
+			adc	a,(hl)
+			ld	iyl,e *
+			ld	d,a
+			sub	b
+			daa
+			add	a,l
+			djnz	Lbd56
+			ld	l,e
+			ld	c,0dh
+			ld	l,b
+			ex	(sp),hl
+			and	l
+			jp	nc,L79bf
+			xor	b
+			jr	nz,Lbd51
+			xor	e
+			pop	bc
+			jp	c,L1251
+			ldd
+			or	d
+			ld	c,d
+			inc	bc
+			dec	h
+			or	c
+			jr	nc,Lbd56
+			rst	28h
+			ld	h,c
+			ret	z
+			inc	c
+			and	a
+			cp	a
+			nop (2x) *
+			sub	l
+			and	a
+			dec	l
+			xor	a
+			add	a,a
+			ld	sp,hl
+			dec	bc
+			add	a,05h
+			and	a
+			ld	d,d
+			di
+			ld	(hl),e
+			cpl
+			ld	h,(hl)
+			xor	b
+			adc	a,d
+			cpl
+			jp	p,L120e
+			inc	a
+			call	pe,L1a24
+			sbc	a,41h
+			ld	a,b
+			ld	(9c5bh),hl
+			adc	a,l
+			inc	(hl)
+			inc	b
+			jr	c,Lbd34
+			and	h
+			ld	e,d
+			sub	h
+			rst	28h
+			or	h
+			ret	p
+			dec	h
+			sub	d
+			and	(hl)
+			dec	hl
+			ld	h,h
+			ld	e,d
+			ld	l,b
+			rrca
+			ld	a,c
+			jp	L110e
+			db	bbh,36h,62h,52h,72h,19h,a6h,6bh
+			db	20h,f5h,85h,75h,dah,1ah,52h,89h
+			db	62h,fch,3bh,3ah,39h,b4h,fch,9dh
+			db	d9h,34h,52h,ebh,23h,c3h,54h,27h
+			db	32h,5dh,c8h,86h,0ah,19h,66h,32h
+			db	4eh,79h,69h,e2h,37h,ddh,43h,06h
+			db	7bh,7fh,60h,e9h,5eh,7ch,c3h,f7h
+			db	c4h,b5h,33h,d9h,e6h,50h,98h,bfh
+			db	bdh,bfh,4dh,67h,62h,f4h,2ch,11h
+			db	3fh,42h,2fh,6fh,26h,09h,07h,9eh
+			db	2fh,fbh,f9h,e6h,34h,b7h,a0h,24h
+			db	7eh,62h,d1h,deh,cah,cbh,85h,cbh
+			db	0dh,5ah,a7h,68h,dbh
+			ld	d,e
+			dec	sp
+			ccf
+			ld	hl,9670h
+			and	c
+			push	af
+			ld	(hl),e
+			ld	b,c
+			ld	e,c
+			dec	(hl)
+			adc	a,c
+			ld	c,(hl)
+			in	a,(2ch)
+			pop	af
+			ld	e,b
+			ccf
+			ld	l,l
+			ld	d,h
+			adc	a,h
+			call	nz,L9450
+			ld	d,(hl)
+			ret	po
+			add	hl,bc
+			ld	b,3dh
+			dec	bc
+			jp	(hl)
+			db	6bh,2ch,48h,7fh,6bh,05h
+			rst	30h
+			ld	h,a
+			ld	e,h
+			and	a
+			jp	m,La2fa
+			ld	c,b
+			jp	c,L677e
+			inc	bc
+			rra
+			ld	c,c
+			cp	h
+			pop	hl
+			ld	d,c
+			cp	7ah
+			ld	(bc),a
+			cp	h
+			sub	b
+			call	Lefce
+			ld	(hl),c
+			ld	(hl),a
+			ex	(sp),hl
+			ld	(hl),b
+			jr	Lbe19
+			db	bfh,75h,79h,ach,f0h,ffh,e7h,f8h
+			db	38h,3dh,dbh,89h,fch,35h,03h,8dh
+			db	dbh,14h,e9h,8dh,3dh,18h,fah,10h
+			db	e4h,2ch,dch,5bh,a6h,66h,dbh,81h
+			db	d2h,cdh,eah,3ch,e7h,86h,d5h,f6h
+			db	bfh,78h,2bh,0ah,d8h,e9h,f0h,bfh
+			db	adh,41h,41h,01h,fah,3bh,b1h,9eh
+			db	1eh,a1h,bah,b2h,ceh,08h,52h,70h
+			db	35h,03h,a8h,21h,8dh,57h,1dh,71h
+			db	dfh,0eh,19h,9bh,09h,d5h,dch,44h
+			db	39h,82h,01h,6fh,ddh,92h,e6h
+			adc	a,e
+			sbc	a,h
+			adc	a,c
+			adc	a,c
+			ld	d,a
+			ld	l,e5h
+			add	a,h
+			or	ceh
+			jp	pe,Lcb25
+			ld	hl,(2b11h)
+			ld	h,d
+			dec	d
+			cp	e
+			ld	e,c
+			adc	a,b
+			xor	e
+			in	a,(d1h)
+			ld	h,h
+			ld	b,7ch
+			ld	c,(hl)
+			xor	a0h
+			xor	d
+			ld	b,b
+			sub	b
+			di
+			jp	nc,L0942
+			xor	a
+			ret	p
+			ld	h,c
+			ld	a,09h
+			halt
+			and	d
+			out	(b2h),a
+			adc	a,c
+			inc	hl
+			ld	l,67h
+			cp	3ch
+			ret	pe
+			ld	c,(hl)
+			dec	e
+			ccf
+			rst	08h
+			add	hl,de
+			ld	e,e
+			ld	a,a
+			add	a,c
+			sub	l
+			jp	pe,L3b52
+			and	h
+			jp	(hl)
+			db	dah,25h,2fh,32h,0bh,9dh,e8h,19h
+			db	ebh,77h,3ch,69h,97h,b0h,6fh,03h
+			db	7fh,41h,53h,ebh,57h,1fh,bfh,75h
+			db	77h,8fh,f4h,88h,47h,2dh,30h,e0h
+			db	9dh,65h,edh,dfh,7eh,dfh,08h,84h
+			db	04h,8ch,2ah,51h,62h,75h,90h,64h
+			db	18h,0ah,9fh,85h,2fh,0eh,fah,15h
+			db	97h,f5h,c4h,16h,41h,2ah,6ch,abh
+			db	eah,eeh,beh,e2h,ffh,c2h,66h,81h
+			db	7ah,b6h,10h,30h,a5h,42h,5bh,42h
+			inc	b
+			add	hl,hl
+			rst	18h
+			cp	d
+			ret	nz
+			ld	b,h
+			ex	de,hl
+			ret	m
+			ld	c,e
+			ld	c,a
+			ret	nc
+			di
+			jp	nz,L4aae
+			and	e
+			or	(hl)
+			sbc	a,d
+			ld	c,47h
+			and	b
+			ld	e,e
+			ld	c,a
+			rst	30h
+			dec	sp
+			sub	h
+			ei
+			ld	(hl),e
+			ld	c,l
+			and	d
+			sub	(hl)
+			ld	c,l
+			jp	L6157
+			db	aah,60h,67h,c6h,92h,d9h,0bh,efh
+			db	28h,8fh,a7h,f1h,0dh,91h,76h,a4h
+			db	86h,4dh,a0h,48h,76h,44h,c2h,a7h
+			db	d3h,d4h,08h,9eh,7dh,6ch,0bh,e0h
+			db	37h,87h,05h,57h,3ah,4ch,2ah,1ch
+			db	68h,56h,87h,55h,38h,70h,66h,aeh
+			db	6dh,0fh,56h,2ah,5dh,89h,99h,09h
+			db	3bh,eeh,c9h,c4h,bch,c2h,58h,ddh
+			db	adh,3bh,4eh,11h,b1h,02h,5bh,0eh
+			db	c2h,96h,23h,0dh,1fh,8eh,27h,a0h
+			db	3fh,5dh,9ah,78h,13h,2eh,56h,31h
+			db	bbh,04h,09h,3ch,84h,59h,f5h,0bh
+			db	60h,5dh,c1h,7ah,13h,97h,5bh,5dh
+			db	e4h,d4h,fah,7eh,e7h,8dh,1fh,e4h
+			db	79h,50h,a9h,c1h,26h,f4h,55h,e5h
+			db	d3h,cbh,7ah,6dh,8fh,0ah,e3h,31h
+			db	30h,5dh,5bh,5fh,bdh,b2h,73h,e7h
+			db	9fh,b3h,1ch,19h,35h,54h,46h,7bh
+			db	5ch,45h,d5h,5ch,25h,f4h,92h
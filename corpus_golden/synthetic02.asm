@@ -0,0 +1,2158 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	adh,4dh,05h,9ch,fdh,0fh,4eh,31h
+			db	96h,5fh,bch,1ch
+
+start:						; execution starting point
+			xor	b
+			ld	e,(hl)
+			ld	b,h
+			ex	de,hl
+			ld	c,l
+			and	h
+			nop
+			sbc	a,c
+			inc	hl
+			jr	L4067
+			db	08h,54h,01h,fch,a0h,91h,b5h,03h
+			db	94h,fah,a3h,ebh,dah,40h,d1h,13h
+			db	cfh,8fh,7dh,a8h,a0h,00h,37h,2bh
+			db	93h,28h,12h,62h,e3h,c6h,5ah,4bh
+			db	cbh,aeh,08h,26h,02h,94h,f8h,6ah
+			db	30h,d1h,29h,39h,bdh,90h,c6h,6eh
+			db	c5h,bah,a6h,efh,cdh,f7h,39h,9dh
+			db	f4h,42h,9ch,aeh,cdh,aeh,9bh,46h
+			db	4dh,63h,59h,23h,27h,d3h,70h,bfh
+			db	80h,40h,22h,d2h
+			and	d
+			nop (2x) *
+			cp	c
+			dec	sp
+			ld	(de),a
+			ld	l,b
+			ld	b,18h
+			and	h
+			di
+			dec	bc
+			adc	a,h
+			add	a,h
+			inc	hl
+			sub	b
+			xor	b
+			ld	a,d
+			inc	h
+			cpl
+			cp	l
+			adc	a,d
+			or	(hl)
+			ld	a,48h
+			add	a,e
+			ld	d,b
+			ex	de,hl
+			scf
+			ld	h,e
+			ld	(hl),a
+			add	a,d
+			ld	l,e
+			sbc	a,a
+			add	a,h
+			push	af
+			cp	13h
+			inc	b
+			ld	c,e
+			rst	38h
+			add	a,(hl)
+			call	po,Lb6a2
+			sub	e
+			ld	bc,8922h
+			and	(hl)
+			scf
+			ld	d,c
+			ld	e,c
+			and	60h
+			ld	b,h
+			sbc	a,h
+			sub	c
+			ld	h,b
+			ld	c,e
+			exx
+			ld	e,c
+			cp	l
+			ld	a,c
+			and	cdh
+			sbc	a,cdh
+			di
+			rra
+			ld	l,e
+			jp	po,L4ce8
+			ld	l,(hl)
+			sub	d
+			ld	a,c
+			ld	b,e
+			ld	(hl),a
+			and	b
+			sbc	a,b
+			push	hl
+			call	p,L3146
+			xor	c
+			ld	b,h
+			nop (2x) *
+			ld	e,d
+			push	bc
+			cp	c
+			ld	(hl),h
+			sub	62h
+			jr	nc,L4086
+			add	hl,bc
+			cp	(hl)
+			jp	pe,Lf80e
+			ld	e,(hl)
+			ld	c,d3h
+			nop (2x) *
+			xor	e
+			jp	Le4cf
+			db	d8h,beh,f5h,4eh,59h,44h,56h,4dh
+			db	00h,dfh,55h,4bh,61h,e6h,17h,ceh
+			db	b9h,84h,e4h,79h,a7h,1ah,1bh,65h
+			db	92h,7bh,dch,85h,54h,cbh,bfh,9fh
+			db	89h,81h,2ch,93h,a0h,ceh,69h,8eh
+			db	8eh,e9h,6dh,5bh,04h,efh,20h,5fh
+			db	75h,c2h,deh,75h,c3h,08h,15h,24h
+			db	63h,ech,8ah,75h,52h,f5h,41h,cbh
+			db	37h,7ch,41h,94h,4eh,bfh,08h,4ch
+			db	8bh,22h,3ch,d4h,dbh,6bh,34h,7dh
+			db	6eh,56h,5fh,5eh,1ch,66h,33h,78h
+			db	2fh,40h,f7h,a3h,e0h,48h,9eh,bdh
+			db	7dh,32h,d9h,3bh,abh,3ch,d0h,83h
+			db	43h,6bh,5eh,bbh,8ah,7ah,7eh,c0h
+			db	dah,f2h,12h,a9h,14h,dbh,65h,a7h
+			db	c1h,9eh,cfh,07h,b6h,90h,7ch,b1h
+			db	ech,59h,40h,7ch,17h,ceh,5bh,48h
+			db	fbh,1fh,11h,7eh,99h,f6h,09h,09h
+			db	d6h,35h,5dh,43h,ffh,7fh,91h,99h
+			db	53h,e0h,b5h,b8h,67h,b6h,b6h,8eh
+			db	2eh,27h,5bh,7ah,e6h,86h,07h,e8h
+			db	f2h,08h,feh,feh,ffh,e9h,4bh,7dh
+			db	b7h,a0h,6bh,93h,0ch,08h,9eh,43h
+			db	19h,b6h,04h,39h,d6h,d6h,53h,93h
+			db	6ah,f2h,a8h,fbh,aeh,1ch,09h,8fh
+			db	03h,bah,09h,fdh,e8h,59h,8bh,2dh
+			db	89h,b6h,cah,bch,5eh,9dh,08h,23h
+			db	91h,e9h,a8h,b3h,ddh,cfh,04h,64h
+			db	1dh,80h,1ch,37h,33h,59h,41h,57h
+			db	d3h,c6h,dah,d3h,63h,16h,ffh,36h
+			db	44h,a7h,dbh,d0h,1ch,bah,54h,0ah
+			db	c2h,7eh,0ch,05h,8dh,f5h,5eh,dfh
+			db	dah,e0h,2eh,59h,1fh,4ah,deh,19h
+			db	fdh,bfh,24h,86h,00h,23h,70h,43h
+			db	dbh,11h,37h,1fh,12h,a6h,b1h,8ch
+			db	e4h,d9h,f1h,85h,8eh,08h,aeh,5fh
+			db	42h,7bh,d2h,6bh,f3h,54h,73h,e9h
+			db	a8h,f1h,25h,78h,69h,9ch,8dh,81h
+			db	67h,a7h,4fh,00h,41h,22h,17h,58h
+			db	f4h,3eh,c0h,32h,72h,ddh,a0h,a3h
+			db	45h,e4h,84h,d5h,57h,99h,5bh,4eh
+			db	61h,28h,aeh,74h,d9h,9ah,70h,f6h
+			db	c2h,b0h,d1h,c6h,fdh,c1h,e9h,dfh
+			db	2fh,9ch,3ch,4ah,5fh,dah,0fh,2ch
+			db	aeh,d1h,b1h,0bh,f2h,08h,f4h,d7h
+			db	f2h,a2h,eeh,0dh,29h,83h,50h,c0h
+			db	fch,97h,46h,08h,73h,b7h,0bh,e1h
+			db	05h,74h,92h,65h,43h,b9h,2ch,a2h
+			db	77h,43h,f9h,7fh,e9h,89h,e2h,e8h
+			db	7fh,f8h,96h,8ah,a8h,b8h,50h,10h
+			db	0eh,97h,6dh,4ch,c8h,feh,07h,79h
+			db	ceh,39h,d7h,2bh,4eh,a8h,02h,73h
+			db	77h,51h,96h,25h,b9h,e3h,b8h,1ch
+			db	f6h,28h,83h,66h,2ah,afh,d4h,73h
+			db	bdh,8fh,2fh,3dh,29h,0dh,42h,8fh
+			db	dch,9dh,4fh,dbh,15h,4dh,26h,c5h
+			db	d3h,78h,84h,d6h,62h,16h,41h,60h
+			db	01h,dfh,6eh,3fh,60h,14h,a2h,c8h
+			db	dfh,b8h,80h,cdh,b2h,03h,06h,cbh
+			db	09h,a4h,e5h,11h,12h,5bh,bfh,6bh
+			db	1ch,e0h,93h,94h,f4h,11h,5dh,b3h
+			db	65h,c8h,71h,d4h,84h,68h,73h,d9h
+			db	18h,20h,5fh,47h,40h,aeh,c5h,00h
+			db	d3h,7eh,adh,2fh,8bh,09h,23h,09h
+			db	f2h,7ah,edh,25h,5bh,3eh,24h,33h
+			db	24h,d9h,2fh,53h,87h,90h,a8h,5ah
+			db	22h,a7h,afh,b0h,81h,6bh,a1h,5ah
+			db	c0h,5ch,90h,65h,bbh,43h,d9h,1ah
+			db	a0h,dah,48h,5fh,9eh,f5h,0eh,d2h
+			db	2fh,e1h,46h,adh,d4h,27h,a0h,27h
+			db	6bh,bch,bch,d9h,6fh,42h,edh,e7h
+			db	42h,3ah,0dh,2ah,32h,57h,1fh,f3h
+			db	d0h,5ah,6ah,22h,19h,f6h,dfh,ffh
+			db	eah,f4h,60h,72h,c3h,d6h,8fh,cah
+			db	d4h,a4h,d2h,aah,cdh,50h,a0h,6fh
+			db	07h,8ch,c0h,9ch,91h,c5h,cdh,bdh
+			db	b4h,59h,dch,b4h,2fh,03h,17h,a2h
+			db	0ah,e3h,85h,adh,c8h,ebh,e6h,93h
+			db	27h,3eh,ech,b4h,afh,e7h,b0h,5dh
+			db	50h,98h,b8h,9eh,e8h,04h,0dh,0dh
+			db	76h,52h,47h,10h,f5h,fdh,bbh,9ah
+			db	c8h,47h,b5h,3bh,98h,87h,1dh,08h
+			db	ddh,8dh,a5h,76h,d4h,0fh,92h,7bh
+			db	1ch,edh,bfh,45h,25h,69h,a7h,24h
+			db	7eh,4ah,74h,e3h,d3h,83h,b9h,a3h
+			db	81h,b1h,41h,19h,0ch,2fh,2fh,b6h
+			db	07h,6ch,7ch,cbh,f8h,c7h,93h,6fh
+			db	1fh,76h,f6h,40h,35h,f1h,efh,54h
+			db	6ah,21h,d6h,3ch,afh,27h,1ah,6dh
+			db	15h,37h,99h,d6h,ffh,02h,b5h,c0h
+			db	7fh,9ah,7ah,e9h,8fh,63h,27h,48h
+			db	59h,bfh,c0h,d5h,17h,6ch,e6h,7eh
+			db	6fh,feh,69h,aah,5bh,71h,23h,1eh
+			db	3fh,c5h,3dh,3dh,fah,9dh,0ch,8dh
+			db	84h,fbh,85h,8dh,1bh,18h,58h,98h
+			db	83h,d1h,1dh,32h,e0h,25h,c0h,5fh
+			db	17h,0ah,a9h,68h,71h,6dh,29h,47h
+			db	d2h,06h,7dh,dfh,78h,53h,c2h,9ah
+			db	f7h,c3h,08h,72h,8dh,73h,6bh,ffh
+			db	8bh,a3h,3bh,5ch,9ah,ach,00h,eeh
+			db	3ah,82h,b2h,f5h,9eh,32h,bah,33h
+			db	9eh,6ah,6ah,22h,5ch,51h,c1h,12h
+			db	eeh,ach,e0h,97h,1dh,3ch,e3h,b6h
+			db	20h,afh,32h,20h,75h,17h,18h,82h
+			db	33h,2fh,c6h,4bh,8dh,abh,61h,e3h
+			db	5ah,45h,2dh,d7h,34h,0ah,58h,1fh
+			db	bdh,e8h,adh,2eh,1dh,37h,b2h,dch
+			db	e5h,51h,71h,89h,c0h,d6h,d5h,15h
+			db	d3h,25h,1bh,f1h,2fh,6dh,f1h,14h
+			db	b8h,1fh,c3h,d9h,1bh,c1h,ach,e5h
+			db	e1h,5dh,fdh,03h,44h,63h,bfh,a9h
+			db	92h,cfh,3dh,dbh,d3h,1ah,74h,c6h
+			db	68h,3eh,03h,0eh,a3h,f3h,ebh,e3h
+			db	b5h,2ch,eeh,feh,3ah,86h,14h,11h
+			db	ffh,bbh,feh,deh,09h,0bh,4ah,fah
+			db	eah,c5h,26h,6eh,5ch,dch,b4h,4eh
+			db	48h,86h,43h,c3h,d9h,9fh,63h,53h
+			db	9ah,2bh,16h,ech,67h,67h,6dh,4bh
+			db	bfh,1ch,98h,2eh,eeh,58h,b6h,3eh
+			db	38h,f9h,3ch,10h,cdh,00h,8dh,f6h
+			db	62h,7eh,dbh,2bh,09h,cch,35h,cfh
+			db	b3h,dfh,15h,b2h,e1h,25h,87h,06h
+			db	ebh,85h,50h,c6h,f5h,d2h,14h,41h
+			db	aah,58h,ach,3ah,0fh,93h,dbh,2bh
+			db	42h,dfh,b4h,d5h,11h,19h,c8h,32h
+			db	29h,07h,fdh,76h,88h,15h,6fh,70h
+			db	c4h,46h,b8h,48h,deh,20h,90h,f4h
+			db	52h,54h,23h,4fh,f2h,c7h,f3h,0bh
+			db	49h,fbh,b2h,9dh,c9h,82h,62h,8ah
+			db	45h,e3h,32h,fch,bdh,93h,77h,e9h
+			db	57h,adh,adh,e3h,5dh,cdh,a0h,bah
+			db	90h,a4h,90h,4dh,fch,a8h,0bh,d2h
+			db	0ah,64h,6eh,35h,8ah,d5h,17h,33h
+			db	f4h,36h,48h,d9h,0fh,edh,78h,23h
+			db	35h,3eh,f0h,2bh,b4h,cch,c7h,86h
+			db	23h,9dh,a4h,e4h,fdh,94h,3eh,f3h
+			db	9ch,96h,17h,1eh,11h,4bh,8fh,54h
+			db	49h,54h,6eh,11h,35h,63h,23h,45h
+			db	d2h,a1h,22h,86h,d0h,ech,13h,8eh
+			db	1dh,ceh,cfh,5fh,09h,85h,f9h,3ah
+			db	2ch,6ah,feh,beh,7ch,63h,3fh,bah
+			db	c5h,ceh,22h,52h,b9h,9dh,55h,1eh
+			db	6dh,1ch,d0h,c4h,2eh,e1h,cah,1ch
+			db	4dh,a7h,c9h,62h,e1h,e5h,9fh,66h
+			db	15h,77h,79h,92h,4ch,cch,75h,ach
+			db	d5h,dah,30h,41h,a7h,03h,45h,61h
+			db	53h,bdh,19h,66h,87h,33h,84h,dbh
+			db	66h,aeh,6ah,9dh,6fh,80h,0ah,4fh
+			db	bbh,a1h,4fh,59h,b3h,5fh,e3h,4fh
+			db	09h,14h,6bh,9ah,7bh,0ch,36h,e4h
+			db	03h,90h,0fh,c4h,21h,91h,b1h,c0h
+			db	34h,e5h,4ch,efh,b9h,2ah,aah,51h
+			db	44h,82h,ebh,e2h,4bh,4ch,a8h,fdh
+			db	3ah,bbh,98h,19h,08h,dah,b8h,77h
+			db	04h,a7h,ech,47h,8ch,dah,79h,6bh
+			db	52h,f9h,16h,b9h,00h,78h,0dh,1ah
+			db	65h,5dh,c3h,a1h,31h,cah,3dh,d8h
+			db	b3h,e7h,efh,58h,01h,59h,b2h,3bh
+			db	cch,80h,b4h,8bh,6bh,b1h,edh,2eh
+			db	bfh,c1h,e5h,d0h,e4h,b3h,7fh,7fh
+			db	2fh,97h,e5h,0ah,1ch,bbh,c1h,5ch
+			db	5dh,b1h,0dh,14h,2eh,c3h,5bh,0eh
+			db	69h,f1h,c0h,fah,2ch,17h,19h,f9h
+			db	02h,20h,fdh,2eh,59h,48h,7ch,73h
+			db	abh,c7h,81h,f7h,3bh,5fh,dch,82h
+			db	5dh,fdh,8ah,53h,81h,f2h,04h,74h
+			db	77h,7eh,a5h,8ah,a1h,e2h,b4h,dbh
+			db	3ch,4ch,66h,45h,38h,a8h,d6h,c8h
+			db	beh,0bh,39h,d5h,1fh,f2h,e1h,36h
+			db	a6h,28h,b2h,e1h,a0h,56h,f7h,81h
+			db	b8h,09h,4dh,ech,66h,ebh,4fh,0bh
+			db	c6h,c5h,27h,57h,f3h,c0h,f5h,1ah
+			db	d4h,ech,04h,ceh,0ch,0ah,00h,6fh
+			db	68h,05h,fbh,6ch,6eh,c7h,0ah,bbh
+			db	81h,03h,42h,d6h,f1h,99h,43h,7bh
+			db	8ch,72h,d9h,33h,74h,c3h,fah,29h
+			db	bbh,5ch,91h,bch,b6h,e2h,f3h,27h
+			db	03h,dbh,adh,35h,5dh,75h,1eh,aah
+			db	aah,7ch,0ah,4ah,7ch,deh,0dh,65h
+			db	b0h,17h,75h,d9h,d2h,f6h,11h,90h
+			db	4ch,1ah,51h,c7h,1ah,51h,63h,b1h
+			db	10h,feh,0dh,5bh,abh,eah,1ah,b6h
+			db	94h,efh,51h,53h,5fh,63h,d4h,dah
+			db	5dh,4ch,44h,8ch,a1h,beh,aah,39h
+			db	aah,98h,ebh,7ch,d9h,a7h,2dh,b3h
+			db	26h,66h,00h,01h,7dh,20h,c5h,49h
+			db	89h,9eh,53h,31h,09h,47h,66h,28h
+			db	25h,edh,bfh,d0h,89h,76h,41h,13h
+			db	dfh,cfh,5fh,53h,b7h,09h,e1h,beh
+			db	fdh,afh,30h,bbh,5ch,cch,2bh,6bh
+			db	4fh,18h,5dh,b8h,71h,74h,94h,7eh
+			db	ebh,7ah,17h,ech,59h,b9h,cfh,a4h
+			db	e4h,2ch,90h,b2h,ebh,ddh,93h,c7h
+			db	4ch,f0h,23h,41h,35h,48h,dah,74h
+			db	c5h,fbh,9bh,a0h,ech,a5h,37h,68h
+			db	32h,14h,8bh,b2h,e1h,c8h,e5h,3fh
+			db	e3h,64h,46h,a3h,63h,f6h,d6h,d0h
+			db	c3h,9bh,9dh,1ah,67h,a9h,48h,4bh
+			db	b8h,01h,1ch,f1h,e7h,b4h,d5h,c1h
+			db	5fh,eeh,13h,46h,abh,12h,a8h,b3h
+			db	ffh,fbh,d9h,21h,8ch,b9h,12h,9bh
+			db	a7h,7fh,97h,7fh,3eh,65h,8dh,f2h
+			db	70h,91h,88h,99h,2fh,e9h,cbh,8eh
+			db	3fh,e2h,1fh,e1h,bdh,20h,1bh,c2h
+			db	ebh,71h,6fh,f5h,e7h,dfh,e8h,eeh
+			db	feh,a5h,4eh,51h,73h,4ah,b1h,30h
+			db	44h,78h,04h,6dh,84h,23h,60h,1ch
+			db	e8h,22h,7eh,b6h,d5h,00h,34h,82h
+			db	b4h,fbh,efh,90h,2bh,ech,a1h,89h
+			db	bah,bah,f2h,07h,6ah,e8h,a0h,99h
+			db	a0h,46h,ech,79h,27h,54h,bdh,a0h
+			db	1dh,efh,ceh,d7h,b0h,2ah,5ch,abh
+			db	32h,b7h,50h,b6h,76h,30h,39h,dah
+			db	05h,06h,a5h,24h,2ch,ach,c9h,6eh
+			db	3bh,edh,b1h,14h,fah,7ch,ddh,1ch
+			db	3ch,e1h,78h,04h,c9h,c2h,ffh,80h
+			db	d1h,7ch,f1h,42h,f4h,33h,89h,d0h
+			db	efh,6ah,cdh,48h,00h,0ah,aeh,70h
+			db	77h,04h,2eh,91h,46h,99h,1ch,0ch
+			db	35h,4ah,e5h,89h,6dh,8eh,efh,1ch
+			db	94h,4eh,d2h,35h,4ch,fch,1eh,3eh
+			db	34h,4dh,36h,2fh,cdh,ddh,2bh,4eh
+			db	8bh,aeh,d8h,e8h,4ch,06h,c8h,c1h
+			db	02h,2ah,98h,d4h,8bh,39h,e6h,6bh
+			db	f0h,04h,a2h,82h,a5h,33h,02h,c7h
+			db	0fh,e3h,fdh,25h,35h,32h,dah,cdh
+			db	c6h,59h,5ah,89h,5bh,69h,feh,5eh
+			db	f6h,a6h,1dh,c3h,d7h,c4h,0eh,b7h
+			db	8bh,86h,efh,25h,5bh,66h,12h,ebh
+			db	2ah,ddh,38h,48h,b9h,4bh,40h,c7h
+			db	90h,b4h,e1h,a9h,3ah,37h,adh,21h
+			db	cfh,19h,a2h,75h,08h,8ah,d2h,74h
+			db	9ah,2ch,20h,b4h,f5h,8ch,4ch,c7h
+			db	94h,43h,91h,d1h,85h,cbh,ach,89h
+			db	2fh,eah,b8h,77h,cfh,a0h,9dh,e1h
+			db	99h,c1h,f3h,d3h,2fh,b2h,8fh,ech
+			db	64h,82h,8ah,d7h,6bh,9ah,40h,e7h
+			db	bah,d5h,4dh,e7h,ffh,09h,bah,44h
+			db	7dh,a4h,98h,54h,f7h,93h,4dh,b1h
+			db	56h,ech,7fh,76h,50h,abh,44h,76h
+			db	6ah,1ch,b0h,85h,88h,0fh,bdh,6fh
+			db	3bh,bbh,b8h,55h,19h,c5h,adh,8dh
+			db	36h,bch,8dh,d7h,5fh,c8h,5dh,06h
+			db	2bh,86h,a1h,c6h,58h,30h,65h,42h
+			db	e1h,38h,97h,c5h,9dh,b0h,ffh,0ch
+			db	a8h,94h,1ah,61h,7ch,a4h,cah,0ch
+			db	eah,45h,a4h,f8h,ceh,e5h,9fh,27h
+			db	78h,dfh,7dh,4ch,6ah,d3h,fah,fbh
+			db	96h,ffh,ddh,23h,ach,48h,73h,29h
+			db	ceh,6dh,78h,17h,d6h,9ch,f2h,03h
+			db	01h,65h,f3h,18h,02h,f2h,82h,c4h
+			db	cch,b6h,cfh,06h,b2h,afh,74h,cdh
+			db	47h,54h,81h,03h,7ch,08h,00h,b2h
+			db	8fh,d8h,5ch,08h,77h,a1h,eah,54h
+			db	dbh,8eh,2ah,b5h,61h,89h,4ch,16h
+			db	f8h,1ah,b3h,16h,c4h,41h,84h,2bh
+			db	a5h,1dh,68h,f0h,1dh,d5h,4bh,8ah
+			db	00h,94h,94h,50h,5bh,3fh,c9h,1ch
+			db	88h,a0h,a2h,02h,d6h,8ah,87h,2bh
+			db	3ah,9dh,5dh,5fh,37h,abh,6bh,e6h
+			db	3bh,fah,88h,83h,05h,33h,63h,e1h
+			db	74h,51h,f6h,edh,ebh,1dh,9ah,3dh
+			db	b0h,2ah,f6h,dch,c4h,61h,c3h,cbh
+			db	49h,a3h,f4h,b7h,30h,c0h,f7h,00h
+			db	f3h,3ch,88h,20h,26h,59h,80h,0ah
+			db	1fh,a6h,4bh,efh,8ch,c9h,86h,c0h
+			db	bah,f3h,4bh,76h,c0h,a1h,57h,d9h
+			db	bbh,2ch,80h,a7h,54h,1eh,ffh,41h
+			db	51h,61h,ceh,5fh,d3h,74h,c3h,05h
+			db	75h,64h,87h,9dh,64h,79h,bch,eeh
+			db	eah,71h,85h,cah,e8h,74h,b7h,88h
+			db	dfh,d4h,68h,48h,21h,b7h,c4h,c8h
+			db	28h,32h,d9h,6ah,6ah,58h,9eh,41h
+			db	c5h,fch,d6h,e3h,9dh,3eh,2dh,25h
+			db	ceh,feh,28h,23h,16h,09h,8ch,55h
+			db	a0h,71h,aah,d2h,0bh,85h,55h,c9h
+			db	1fh,8ch,5bh,57h,29h,92h,5dh,5bh
+			db	9ch,fdh,20h,5dh,efh,6eh,04h,b9h
+			db	f0h,8fh,45h,87h,43h,e1h,aah,0fh
+			db	7eh,51h,abh,78h,d9h,e6h,9bh,f8h
+			db	61h,3ah,05h,c7h,a3h,4bh,90h,19h
+			db	49h,f8h,73h,42h,f8h,b7h,bbh,1eh
+			db	45h,a6h,0ch,52h,c8h,0bh,38h,0fh
+			db	f3h,01h,b2h,f4h,aeh,b4h,44h,abh
+			db	38h,a2h,90h,86h,49h,8ah,ebh,b2h
+			db	2ch,35h,cbh,8ch,30h,77h,2dh,82h
+			db	21h,e1h,7bh,5fh,62h,d6h,f2h,63h
+			db	6bh,6fh,66h,21h,63h,76h,e9h,85h
+			db	d4h,59h,adh,0fh,09h,11h,98h,17h
+			db	7ah,a5h,ebh,33h,74h,fdh,76h,48h
+			db	51h,c2h,80h,6dh,bdh,fch,02h,b0h
+			db	54h,80h,30h,61h,04h,f6h,ddh,07h
+			db	a1h,e5h,7ch,40h,4ah,0dh,e0h,17h
+			db	a3h,65h,1fh,23h,c1h,6fh,d2h,49h
+			db	f4h,3fh,01h,54h,8ah,01h,46h,7bh
+			db	44h,b0h,34h,91h,b2h,64h,06h,e3h
+			db	83h,dah,00h,cbh,d2h,a0h,e7h,f1h
+			db	60h,2eh,9fh,82h,39h,fdh,44h,68h
+			db	cbh,78h,c7h,8ch,d8h,8ch,c7h,2bh
+			db	28h,21h,54h,d5h,bch,e6h,5ah,d1h
+			db	74h,e7h,dch,5bh,feh,76h,74h,e8h
+			db	c6h,c9h,e0h,1ah,58h,79h,a5h,09h
+			db	42h,7fh,0fh,dch,25h,c5h,2ch,cdh
+			db	fbh,dfh,a4h,17h,34h,14h,89h,bch
+			db	20h,20h,ech,43h,99h,34h,ddh,f3h
+			db	9ah,75h,cbh,deh,80h,5ah,17h,d8h
+			db	9eh,8fh,14h,32h,82h,9fh,64h,a1h
+			db	cah,bah,72h,a8h,8ch,36h,8eh,47h
+			db	60h,e4h,6eh,0eh,02h,0bh,74h,0ch
+			db	4dh,9dh,f4h,95h,2ah,4bh,6bh,2eh
+			db	b4h,98h,f1h,63h,81h,92h,92h,0bh
+			db	c1h,96h,b0h,3eh,94h,38h,4fh,7dh
+			db	08h,edh,92h,e2h,adh,e2h,0bh,8fh
+			db	adh,e9h,58h,c1h,b3h,5fh,e9h,18h
+			db	21h,90h,62h,b2h,d2h,0dh,b9h,b7h
+			db	89h,1dh,ceh,aah,65h,deh,99h,09h
+			db	d6h,5fh,2dh,93h,4fh,56h,3fh,f0h
+			db	a5h,7ah,ach,e6h,eeh,1eh,76h,afh
+			db	c8h,ech,d3h,9fh,afh,62h,0ch,39h
+			db	52h,65h,55h,50h,80h,0ch,22h,2fh
+			db	37h,feh,2bh,45h,01h,7fh,41h,a2h
+			db	19h,f2h,f4h,48h,93h,7eh,9eh,6bh
+			db	66h,feh,1ah,f1h,6ah,3dh,e4h,51h
+			db	e6h,0eh,beh,ebh,5eh,f7h,6bh,efh
+			db	cah,3bh,5bh,0ch,75h,9fh,33h,bbh
+			db	d7h,ffh,d3h,aeh,b8h,8bh,f2h,26h
+			db	5fh,41h,9dh,5ch,00h,13h,d2h,94h
+			db	ddh,b0h,b0h,f4h,5ah,51h,a9h,47h
+			db	16h,13h,ach,8fh,8ch,4dh,35h,aeh
+			db	20h,8fh,8bh,afh,6fh,08h,8bh,81h
+			db	f3h,c6h,b0h,46h,a9h,7dh,5eh,15h
+			db	34h,6bh,46h,81h,c3h,d7h,3bh,06h
+			db	22h,67h,c6h,efh,39h,78h,87h,d6h
+			db	04h,91h,42h,0ch,bfh,2ah,8ah,0bh
+			db	80h,8dh,7ah,20h,8ah,dbh,9ch,93h
+			db	c0h,a2h,1bh,65h,01h,77h,2bh,f2h
+			db	e2h,24h,8eh,6bh,a6h,77h,f5h,e2h
+			db	edh,a8h,7bh,2ch,06h,dbh,f2h,96h
+			db	51h,cch,2ah,e1h,35h,cbh,68h,d3h
+			db	6eh,97h,c1h,62h,62h,3ch,7dh,68h
+			db	a3h,59h,f7h,f8h,e1h,72h,dah,f4h
+			db	3eh,f4h,b5h,cah,d4h,1bh,a4h,a9h
+			db	d7h,a7h,84h,1dh,63h,82h,7dh,46h
+			db	27h,47h,17h,95h,73h,aah,00h,fdh
+			db	9dh,90h,b0h,77h,dfh,06h,aeh,60h
+			db	7eh,fah,99h,b7h,7ah,fch,a9h,07h
+			db	a1h,1eh,dbh,9ah,c9h,9ch,19h,8bh
+			db	6ch,ffh,69h,f0h,80h,ceh,f6h,8ah
+			db	beh,00h,62h,2eh,dbh,40h,7ch,ebh
+			db	1fh,05h,c7h,e5h,32h,0bh,9fh,5eh
+			db	25h,ach,93h,63h,05h,1ch,4eh,09h
+			db	e4h,f9h,5fh,a1h,01h,a7h,f9h,aeh
+			db	6fh,55h,0ch,7fh,8bh,efh,77h,5ah
+			db	fbh,d9h,1ah,1ah,f7h,3ah,b0h,45h
+			db	66h,56h,c4h,dch,37h,98h,09h,c5h
+			db	48h,75h,3dh,cch,37h,c0h,b6h,74h
+			db	8eh,04h,a8h,74h,38h,3dh,10h,5dh
+			db	d6h,ebh,abh,01h,50h,34h,f1h,63h
+			db	e3h,26h,51h,27h,07h,45h,00h,8fh
+			db	52h,a9h,aah,f0h,33h,0fh,02h,25h
+			db	91h,1eh,a0h,67h,1dh,9fh,ffh,a4h
+			db	dbh,83h,56h,c2h,b0h,d9h,fbh,d3h
+			db	5fh,bbh,abh,e5h,bfh,4eh,f3h,2dh
+			db	89h,61h,ech,73h,9ah,7eh,0ah,e0h
+			db	4eh,4ah,27h,81h,eah,79h,14h,cdh
+			db	66h,42h,4fh,9dh,66h,7dh,36h,4eh
+			db	e4h,92h,b7h,51h,f2h,f0h,f0h,6ch
+			db	abh,99h,4eh,e1h,74h,74h,d0h,08h
+			db	53h,52h,03h,2bh,44h,f0h,03h,4dh
+			db	69h,c0h,82h,06h,d4h,6bh,80h,f3h
+			db	19h,4dh,91h,dah,22h,ffh,d3h,35h
+			db	9dh,1dh,14h,dfh,dch,eeh,ech,5fh
+			db	54h,dah,e9h,f4h,44h,2ch,0eh,25h
+			db	feh,eeh,13h,c4h,e4h,1ah,67h,44h
+			db	81h,feh,06h,1ch,70h,c6h,5ch,58h
+			db	3fh,49h,5ah,6eh,52h,f1h,4bh,93h
+			db	01h,1bh,e4h,1ah,ach,e8h,f7h,c2h
+			db	6ch,95h,edh,6ah,3dh,75h,aeh,57h
+			db	c4h,00h,b9h,f7h,93h,b7h,b5h,7dh
+			db	0dh,cch,f4h,5bh,05h,8dh,c9h,b5h
+			db	38h,37h,cdh,80h,71h,04h,4ah,ach
+			db	24h,2ah,19h,48h,46h,cah,52h,03h
+			db	06h,6eh,0ch,0bh,49h,50h,21h,aeh
+			db	dah,25h,fch,c9h,07h,cah,61h,fch
+			db	80h,0fh,cbh,2fh,28h,0ch,28h,4bh
+			db	cbh,b5h,73h,90h,99h,88h,aeh,5ch
+			db	b6h,2eh,a6h,f7h
+			adc	a,e
+			and	h
+			ret	po
+			daa
+			adc	a,4bh
+			dec	h
+			ret	po
+			res	0,h
+			rrca
+			add	a,b
+			add	hl,sp
+			ld	e,b
+			ex	(sp),hl
+			ld	h,e
+			inc	a
+			nop (2x) *
+			and	c
+			ld	d,e
+			adc	a,a
+			jp	(hl)
+			db	1dh,83h,a6h,66h,20h,cbh,62h,27h
+			db	83h,b8h,9bh,96h,f3h,beh,d3h,fbh
+			db	59h,62h,e5h,0bh,2eh,25h,19h,cfh
+			db	bbh,90h,a4h,8ch,08h,52h,0ch,62h
+			db	b6h,e0h,13h,d0h,cdh,d1h,f5h,f7h
+			db	22h,18h,1dh,dch,d4h,99h,05h,e1h
+			db	cfh,e7h,2ah,79h,b8h,55h,2bh,30h
+			db	08h,05h,72h,c0h,2eh,2eh,b1h,77h
+			db	23h,bah,04h,40h,efh,cah,59h,81h
+			db	73h,5bh,3eh,35h,24h,d5h,e2h,88h
+			db	43h,40h,62h,8ch,50h,f3h,98h,dch
+			db	87h,9ch,12h,3dh,4fh,b9h,3dh,20h
+			db	08h,97h,c0h,bah,ebh,c4h,02h,02h
+			db	f6h,60h,6dh,b8h,eah,51h,5dh,f7h
+			db	59h,eeh,ach,f8h,5dh,8ch,bah,83h
+			db	27h,49h,c5h,08h,8eh,72h,40h,14h
+			db	e9h,a2h,82h,aah,01h,7fh,bdh,98h
+			db	1eh,05h,40h,4ah,0fh,02h,c7h,4ch
+			db	84h,68h,21h,f1h,efh,8fh,dfh,c4h
+			db	d2h,2eh,4fh,9dh,dah,1dh,86h,0fh
+			db	21h,c0h,bbh,12h,22h,5fh,c3h,60h
+			db	71h,3bh,61h,a6h,cah,21h,5eh,b2h
+			db	beh,1bh,bbh,8bh,8dh,42h,1fh,0ah
+			db	efh,d6h,f5h,59h,8dh,85h,0eh,7ah
+			db	5fh,01h,6bh,ffh,75h,c8h,44h,f2h
+			db	75h,12h,e1h,6bh,4bh,fch,0bh,68h
+			db	eeh,e3h,4eh,68h,53h,41h,46h,feh
+			db	00h,ddh,b5h,c2h,11h,98h,4eh,bah
+			db	c1h,28h,41h,04h,cfh,99h,a2h,31h
+			db	1bh,6eh,21h,e3h,7bh,31h,56h,65h
+			db	04h,50h,13h,4dh,40h,61h,f5h,cah
+			db	7fh,37h,43h,fbh,6bh,eeh,f7h,25h
+			db	22h,dch,29h,40h,88h,51h,6ah,67h
+			db	bbh,16h,6eh,98h,abh,ech,feh,12h
+			db	33h,d1h,00h,31h,5dh,33h,1eh,89h
+			db	99h,a4h,33h,78h,96h,dch,72h,5eh
+			db	00h,40h,7eh,51h,beh,cfh,d9h,9ch
+			db	a6h,1bh,7eh,1fh,f8h,93h,e0h,e0h
+			db	e3h,f7h,85h,08h,3ch,90h,11h,f8h
+			db	3ah,6bh,a6h,abh,7ch,31h,a1h,9ah
+			db	21h,bdh,bfh,5ch,d7h,05h,6ah,09h
+			db	cdh,3ch,73h,ffh,01h,67h,d4h,e2h
+			db	02h,b1h,d8h,48h,44h,e7h,bfh,08h
+			db	52h,a7h,50h,4bh,8ch,aeh,f9h,ffh
+			db	4bh,0bh,44h,ebh,48h,4dh,09h,a0h
+			db	49h,3fh,ceh,1dh,a1h,88h,a7h,84h
+			db	6bh,eah,f0h,9eh,e3h,35h,f1h,ddh
+			db	68h,f8h,7eh,f2h,b8h,34h,a7h,18h
+			db	b9h,02h,80h,52h,12h,46h,06h,04h
+			db	feh,dbh,aah,f2h,b8h,79h,6eh,61h
+			db	36h,deh,19h,d3h,d4h,8dh,c1h,ceh
+			db	42h,58h,1bh,9fh,47h,a7h,73h,02h
+			db	b4h,84h,a4h,32h,38h,b6h,83h,49h
+			db	eah,afh,c5h,34h,66h,8dh,5bh,33h
+			db	e6h,e9h,38h,04h,c1h,17h,e2h,b3h
+			db	a0h,b8h,3dh,a3h,f6h,ebh,45h,e6h
+			db	bdh,9dh,beh,ddh,17h,3ah,3dh,73h
+			db	f6h,0eh,b5h,22h,96h,57h,66h,cbh
+			db	aeh,c3h,7dh,6bh,2ah,e5h,f9h,38h
+			db	63h,68h,1ah,eah,deh,fah,c3h,e0h
+			db	8fh,68h,97h,e3h,71h,c0h,d1h,e3h
+			db	05h,d4h,05h,1eh,5dh,e4h,70h,7ah
+			db	7bh,c0h,07h,bah,74h,beh,12h,c4h
+			db	03h,3fh,7ah,1dh,37h,60h,42h,ech
+			db	dbh,3dh,05h,b6h,dfh,30h,44h,94h
+			db	73h,c9h,fbh,9fh,17h,04h,bfh,04h
+			db	28h,45h,02h,d0h,e4h,dfh,cah,efh
+			db	19h,87h,48h,efh,ceh,59h,11h,19h
+			db	99h,48h,d2h,cbh,9bh,3ah,6ch,c7h
+			db	5eh,f3h,08h,58h,18h,d8h,21h,5bh
+			db	57h,cah,66h,fah,00h,5ch,d7h,b8h
+			db	e4h,64h,14h,a9h,29h,40h,c1h,52h
+			db	e6h,c9h,adh,5ch,98h,a7h,b3h,d6h
+			db	c5h,efh,95h,81h,5ch,6eh,b4h,8fh
+			db	37h,74h,68h,11h,ach,f3h,9bh,9dh
+			db	50h,1eh,c0h,18h,d2h,06h,88h,c6h
+			db	8eh,fbh,26h,29h,22h,6dh,68h,5eh
+			db	f5h,03h,d1h,9ah,49h,5dh,d6h,a7h
+			db	f8h,f3h,59h,24h,42h,c4h,81h,16h
+			db	91h,b7h,eeh,90h,f1h,1fh,dch,4dh
+			db	42h,fbh,e6h,e5h,09h,a7h,1ch,5dh
+			db	38h,20h,cah,8fh,7bh,87h,b5h,33h
+			db	a4h,b4h,17h,8ch,20h,56h,22h,2dh
+			db	0fh,47h,afh,b3h,31h,15h,27h,c4h
+			db	72h,02h,21h,13h,cah,37h,4bh,a5h
+			db	6ah,a8h,b8h,24h,a5h,f8h,11h,2ah
+			db	c5h,5dh,9dh,83h,29h,53h,95h,72h
+			db	d3h,b9h,f8h,e3h,43h,17h,eeh,52h
+			db	39h,3fh,dfh,69h,c0h,b3h,7ch,cah
+			db	5dh,69h,e4h,81h,2bh,19h,ddh,f4h
+			db	d6h,bah,80h,ddh,e1h,c7h,17h,dbh
+			db	5bh,c6h,9fh,8ah,70h,8bh,1bh,29h
+			db	fdh,76h,63h,10h,55h,bbh,15h,c0h
+			db	5dh,aeh,26h,d3h,4ah,beh,ffh,3ah
+			db	d5h,6ah,87h,36h,96h,9dh,f3h,75h
+			db	6ch,50h,55h,22h,c1h,55h,69h,2bh
+			db	8dh,5ch,c3h,0ch,0fh,5bh,84h,68h
+			db	dbh,91h,87h,3eh,09h,17h,a1h,d7h
+			db	a1h,eeh,00h,09h,05h,2ch,cah,05h
+			db	aah,6dh,96h,c3h,cch,7eh,12h,c4h
+			db	86h,73h,79h,61h,e3h,bfh,99h,1dh
+			db	e5h,95h,59h,3bh,d8h,38h,e7h,25h
+			db	bbh,46h,c7h,7ah,9ah,95h,5bh,40h
+			db	90h,adh,0dh,b6h,8bh,51h,77h,38h
+			db	92h,7eh,6fh,0ah,b5h,72h,afh,fdh
+			db	5ch,e1h,e1h,25h,26h,06h,e3h,1ah
+			db	23h,adh,20h,76h,f9h,55h,72h,1fh
+			db	1ch,1fh,31h,2dh,84h,cah,d7h,9ch
+			db	0fh,ddh,9ah,eah,70h,52h,39h,79h
+			db	3ch,45h,30h,ebh,e4h,eah,b2h,dbh
+			db	c2h,d5h,c6h,43h,69h,24h,adh,07h
+			db	f0h,25h,1eh,cch,70h,bdh,dah,9dh
+			db	d3h,82h,77h,44h,7dh,e4h,96h,13h
+			db	b3h,cbh,0fh,65h,7ah,beh,62h,8eh
+			db	9fh,b3h,8eh,01h,ffh,65h,1fh,f8h
+			db	5ah,6ch,78h,87h,77h,90h,64h,9dh
+			db	54h,a7h,81h,74h,c8h,87h,ebh,89h
+			db	26h,32h,40h,8fh,67h,d6h,91h,70h
+			db	23h,f1h,68h,d4h,53h,bdh,0fh,0ch
+			db	dfh,23h,e0h,39h,7ch,a7h,1dh,88h
+			db	4fh,d8h,cdh,77h,89h,6ah,05h,9ch
+			db	a1h,14h,fdh,3eh,edh,a5h,beh,08h
+			db	34h,4ch,97h,f0h,42h,63h,2ah,19h
+			db	f6h,7bh,d9h,33h,1ah,15h,38h,4ah
+			db	9fh,e2h,78h,56h,d0h,feh,6fh,d3h
+			db	18h,dbh,76h,f7h,c4h,7dh,68h,d4h
+			db	7ah,3ah,a4h,f1h,f7h,d1h,6ah,a2h
+			db	2bh,05h,9bh,15h,adh,19h,15h,5ch
+			db	30h,91h,03h,7bh,21h,dbh,d0h,b5h
+			db	22h,68h,eeh,74h,aah,b6h,eeh,3ah
+			db	a7h,f6h,b8h,42h,47h,f1h,fdh,f4h
+			db	2ch,abh,1bh,7fh,d2h,c2h,19h,dfh
+			db	a8h,f5h,80h,d2h,39h,cch,a9h,6eh
+			db	80h,89h,4fh,49h,ddh,f8h,08h,80h
+			db	9ch,66h,56h,dfh,64h,70h,e3h,bbh
+			db	eeh,3fh,76h,59h,fch,47h,80h,e9h
+			db	cbh,1ch,14h,3ah,8ch,59h,14h,2fh
+			db	deh,51h,d8h,55h,18h,37h,51h,4eh
+			db	86h,feh,e3h,ceh,1ch,d7h,e1h,8ah
+			db	6bh,3fh,05h,c3h,a4h,56h,1eh,aeh
+			db	cbh,7ah,4ah,38h,e0h,f7h,85h,0ch
+			db	deh,26h,92h,b2h,3fh,32h,b0h,e1h
+			db	cdh,87h,eeh,a3h,6eh,42h,2ah,feh
+			db	c0h,c4h,f0h,a2h,89h,afh,53h,8ah
+			db	67h,62h,dfh,eeh,c0h,c7h,c1h,8bh
+			db	edh,5bh,8fh,d1h,43h,d0h,89h,a8h
+			db	86h,f1h,a6h,22h,44h,a1h,04h,b2h
+			db	50h,08h,86h,1fh,6fh,8ch,c2h,d9h
+			db	09h,7bh,b2h,d1h,28h,8fh,29h,deh
+			db	a0h,8fh,70h,adh,f8h,e5h,b1h,a5h
+			db	c9h,43h,b2h,5ah,86h,ceh,50h,24h
+			db	68h,d8h,cfh,07h,abh,aah,b3h,e1h
+			db	88h,79h,dch,0fh,b6h,9bh,bch,51h
+			db	3ah,5ch,bfh,72h,82h,0eh,03h,76h
+			db	abh,91h,1ah,02h,6fh,e5h,2fh,a0h
+			db	cch,dbh,cbh,3bh,68h,2fh,d1h,a3h
+			db	82h,e3h,87h,19h,b5h,80h,06h,98h
+			db	33h,35h,17h,e8h,6bh,ffh,73h,5dh
+			db	53h,09h,06h,aeh,0ah,feh,97h,55h
+			db	beh,70h,f9h,83h,69h,15h,39h,2eh
+			db	12h,10h,5bh,2ah,5ah,35h,7dh,edh
+			db	f8h,16h,e1h,89h,13h,dah,bdh,47h
+			db	a8h,42h,88h,9ah,8ch,64h,37h,81h
+			db	38h,c9h,f6h,05h,dfh,96h,44h,8bh
+			db	20h,93h,b2h,49h,22h,1ah,33h,ddh
+			db	c4h,d9h,dbh,edh,afh,19h,8ah,b7h
+			db	8ah,bfh,ach,16h,9bh,24h,61h,ebh
+			db	aeh,73h,2ah,4bh,e0h,45h,6ah,14h
+			db	87h,20h,d2h,96h,47h,9fh,2ah,aeh
+			db	d5h,69h,70h,afh,22h,39h,a5h,24h
+			db	16h,a2h,9ch,4fh,72h,65h,01h,85h
+			db	6eh,7bh,8ah,ach,d6h,84h,6eh,80h
+			db	3ah,e6h,73h,a0h,4bh,c8h,f6h,52h
+			db	79h,9bh,1ch,14h,a2h,e9h,d2h,a3h
+			db	c4h,49h,1ch,90h,29h,feh,3fh,29h
+			db	34h,11h,ach,a0h,11h,f6h,00h,03h
+			db	51h,4fh,44h,aah,b7h,6bh,76h,2ch
+			db	88h,b3h,93h,f8h,f7h,a9h,55h,3bh
+			db	bah,5bh,04h,31h,b6h,86h,47h,89h
+			db	e4h,6dh,5dh,49h,6ch,c0h,dbh,8eh
+			db	76h,38h,f5h,25h,8fh,83h,22h,22h
+			db	95h,74h,0fh,b9h,cah,30h,6fh,61h
+			db	70h,adh,1fh,80h,eeh,61h,dch,0eh
+			db	fah,4bh,7bh,bdh,f8h,f3h,55h,59h
+			db	1fh,86h,e3h,8dh,a8h,e2h,fah,abh
+			db	ddh,a0h,f9h,02h,46h,97h,c9h,5fh
+			db	6ch,12h,aah,bah,1ch,6eh,deh,22h
+			db	83h,90h,16h,f7h,49h,9dh,5eh,c6h
+			db	15h,e3h,dbh,d1h,6fh,fdh,44h,3fh
+			db	a4h,63h,18h,e6h,7eh,5fh,edh,3ch
+			db	58h,81h,dch,44h,6fh,d7h,c8h,ffh
+			db	48h,f8h,c3h,0ah,c3h,97h,90h,ebh
+			db	efh,65h,17h,40h,08h,deh,8dh,30h
+			db	f2h,6dh,4dh,d1h,b6h,0dh,08h,98h
+			db	93h,9ch,92h,2eh,a0h,4ah,7eh,60h
+			db	52h,0ah,72h,e8h,a7h,fbh,52h,45h
+			db	2bh,75h,2ah,d8h,17h,53h,b4h,5ch
+			db	13h,09h,c5h,a2h,52h,fdh,6bh,a5h
+			db	60h,9fh,0bh,30h,6ch,60h,95h,f0h
+			db	2eh,ddh,9bh,5bh,cch,7ah,41h,57h
+			db	e3h,b6h,fah,c3h,3ah,32h,8eh,70h
+			db	11h,bdh,0bh,67h,f1h,40h,a6h,63h
+			db	cah,c8h,7bh,e6h,0fh,c0h,42h,17h
+			db	deh,ebh,c6h,5dh,18h,9bh,42h,f8h
+			db	a3h,dbh,79h,b1h,a3h,0fh,d0h,d9h
+			db	1eh,31h,cdh,ddh,6dh,36h,98h,dbh
+			db	3eh,f6h,62h,24h,b4h,ceh,7dh,a0h
+			db	1ch,6bh,f1h,73h,2ah,62h,1ch,d4h
+			db	fah,f8h,80h,76h,b6h,f4h,f9h,95h
+			db	32h,a9h,86h,2dh,bdh,b1h,53h,22h
+			db	d0h,96h,9bh,84h,77h,c1h,cdh,dch
+			db	25h,feh,6bh,76h,6dh,b3h,5bh,31h
+			db	feh,9fh,68h,76h,1eh,58h,13h,1ah
+			db	0eh,d8h,e1h,4ah,7bh,40h,d4h,e4h
+			db	eeh,dah,8dh,06h,85h,b8h,c6h,09h
+			db	d2h,d8h,07h,f6h,9eh,50h,7eh,e4h
+			db	ceh,c2h,95h,38h,57h,3ah,40h,4dh
+			db	b9h,1dh,81h,28h,a1h,b6h,85h,a6h
+			db	70h,92h,6eh,b4h,b0h,ffh,82h,5dh
+			db	2eh,afh,f1h,81h,4bh,08h,5ah,65h
+			db	73h,38h,0fh,70h,d6h,09h,cdh,62h
+			db	b5h,32h,e6h,46h,12h,bfh,29h,f3h
+			db	12h,f3h,32h,77h,b5h,2bh,3bh,85h
+			db	c7h,feh,d6h,76h,ceh,2eh,fch,d6h
+			db	f8h,26h,a8h,40h,a2h,8bh,feh,1eh
+			db	5ch,7eh,57h,1eh,cdh,36h,e4h,b7h
+			db	8eh,f3h,88h,0ah,17h,83h,99h,0dh
+			db	5ah,0bh,2ah,52h,1ch,25h,6dh,51h
+			db	f4h,f3h,a5h,37h,feh,d6h,b5h,4dh
+			db	dah,7fh,52h,a6h,e6h,84h,22h,33h
+			db	73h,34h,dfh,41h,6fh,deh,3ch,b0h
+			db	42h,2fh,72h,7dh,3fh,8fh,3eh,bch
+			db	04h,69h,bch,44h,b3h,e4h,55h,96h
+			db	99h,4bh,47h,dch,90h,ech,17h,10h
+			db	5ah,f1h,42h,3dh,0bh,1bh,9ch,dah
+			db	b2h,f3h,09h,edh,e9h,dah,b1h,d3h
+			db	6dh,7fh,0ch,cfh,c3h,64h,28h,3fh
+			db	f1h,30h,03h,5ch,22h,edh,cbh,dch
+			db	7bh,edh,d4h,1bh,c1h,e1h,4bh,b3h
+			db	48h,cbh,aeh,cfh,8fh,d5h,ebh,75h
+			db	edh,27h,61h,41h,75h,19h,6bh,b1h
+			db	25h,79h,c9h,20h,1fh,3ch,eeh,9eh
+			db	75h,7bh,beh,3eh,0dh,dah,24h,7fh
+			db	56h,99h,00h,13h,f7h,4dh,77h,01h
+			db	78h,b1h,82h,6dh,f6h,e4h,bch,deh
+			db	29h,6ah,68h,aeh,6fh,9fh,0ah,76h
+			db	f6h,d9h,31h,34h,3fh,4ch,8ah,52h
+			db	c2h,dch,deh,4ch,0ah,51h,eah,21h
+			db	2eh,a0h,0ah,bch,0dh,c0h,c7h,dch
+			db	18h,f5h,beh,c3h,03h,8eh,98h,eeh
+			db	34h,bdh,35h,04h,a6h,31h,ach,3bh
+			db	25h,08h,2ch,0eh,39h,27h,63h,5bh
+			db	cfh,d1h,17h,30h,8ah,c8h,39h,9fh
+			db	64h,9bh,4ch,64h,0eh,0bh,cfh,7dh
+			db	93h,e6h,84h,bch,c0h,b3h,f3h,a5h
+			db	9ch,1fh,39h,d8h,a1h,a2h,9ah,8ch
+			db	efh,3bh,78h,79h,29h,d1h,99h,84h
+			db	34h,73h,a1h,4fh,d1h,90h,59h,40h
+			db	3dh,9eh,5eh,28h,21h,41h,43h,60h
+			db	76h,cdh,01h,45h,bfh,a3h,c8h,bfh
+			db	80h,85h,25h,9fh,29h,83h,63h,5ah
+			db	1fh,8fh,5bh,8dh,13h,63h,25h,82h
+			db	b0h,7ah,94h,10h,25h,b9h,ech,44h
+			db	d2h,d4h,beh,aah,fbh,a7h,18h,75h
+			db	1ah,1ah,42h,eah,1ah,47h,7eh,6eh
+			db	e4h,44h,adh,92h,5dh,dch,d3h,dch
+			db	16h,1fh,42h,3bh,aeh,04h,81h,6bh
+			db	d7h,fbh,4bh,20h,d1h,adh,b8h,85h
+			db	5dh,4bh,9eh,1ah,6dh,3ah,4dh,17h
+			db	c4h,ffh,b4h,61h,88h,dah,41h,90h
+			db	e5h,8eh,0fh,44h,cdh,b7h,87h,36h
+			db	ech,b5h,57h,13h,cch,a7h,e6h,07h
+			db	c3h,a4h,31h,3ch,f2h,cbh,23h,c4h
+			db	6eh,07h,ebh,a5h,e9h,89h,78h,58h
+			db	e5h,7fh,19h,64h,67h,feh,f7h,f7h
+			db	82h,d8h,adh,1ah,0dh,75h,cah,4fh
+			db	f6h,40h,f3h,3fh,06h,71h,b8h,24h
+			db	04h,4eh,8fh,11h,d4h,d5h,94h,0bh
+			db	73h,83h,e0h,f6h,cch,68h,3eh,04h
+			db	f2h,96h,38h,edh,0ch,ddh,13h,f0h
+			db	f0h,bfh,b6h,65h,4dh,11h,7ah,0bh
+			db	dah,8ch,e5h,21h,81h,47h,cfh,0ch
+			db	6bh,25h,18h,69h,99h,17h,78h,99h
+			db	4fh,4ch,bbh,a9h,8fh,0fh,eah,66h
+			db	c4h,59h,eah,1ch,24h,8bh,06h,67h
+			db	f7h,19h,79h,36h,7fh,6fh,a4h,02h
+			db	fdh,8ah,7ch,93h,3dh,76h,96h,99h
+			db	54h,0eh,50h,43h,dfh,fdh,a4h,16h
+			db	d6h,beh,98h,83h,a0h,cdh,bdh,c2h
+			db	2eh,15h,85h,b0h,10h,c5h,92h,14h
+			db	29h,b0h,5eh,42h,deh,81h,cbh,3ch
+			db	46h,98h,47h,10h,08h,25h,6ah,10h
+			db	fah,60h,1ch,ddh,84h,1dh,81h,f7h
+			db	c8h,c3h,8bh,e8h,b9h,b8h,e4h,deh
+			db	99h,b4h,9ch,c0h,9ah,f2h,86h,bch
+			db	20h,4eh,dah,0dh,dah,89h,b9h,9fh
+			db	4dh,ebh,aah,73h,adh,31h,b7h,dah
+			db	03h,e5h,cfh,4dh,4ah,1eh,2dh,b7h
+			db	01h,4bh,e6h,05h,adh,5ah,95h,e5h
+			db	6eh,fch,8eh,c4h,6dh,f4h,ach,fah
+			db	47h,3ch,46h,54h,95h,d6h,9dh,fdh
+			db	b1h,59h,2eh,92h,10h,c0h,31h,ebh
+			db	10h,d0h,d6h,d7h,ech,d7h,4bh,0dh
+			db	e6h,84h,0eh,cbh,b8h,aeh,49h,60h
+			db	f8h,5dh,03h,3eh,77h,b6h,21h,cfh
+			db	cbh,8dh,feh,1dh,55h,8dh,bbh,d5h
+			db	0dh,8ah,3ah,56h,d6h,d5h,84h,f5h
+			db	ech,bch,7ch,90h,4ah,72h,43h,7ah
+			db	2ah,bfh,d1h,bdh,cfh,45h,14h,2dh
+			db	98h,ach,cch,a8h,f5h,7dh,d1h,6dh
+			db	c8h,75h,33h,94h,0eh,57h,b5h,a8h
+			db	26h,58h,20h,87h,96h,efh,56h,57h
+			db	7eh,07h,2ah,a9h,b6h,73h,29h,62h
+			db	aah,3ah,c4h,c2h,9dh,b9h,d4h,92h
+			db	bbh,f3h,c7h,aeh,8dh,94h,0fh,b5h
+			db	50h,83h,5ch,85h,c3h,2ch,7bh,cfh
+			db	b4h,cah,bfh,f7h,49h,cfh,36h,f3h
+			db	b6h,c7h,22h,a0h,c2h,abh,a1h,2fh
+			db	3fh,beh,00h,4dh,27h,73h,0bh,82h
+			db	02h,0ah,bbh,49h,5eh,13h,65h,4ah
+			db	fch,53h,dfh,e6h,ddh,a9h,45h,bch
+			db	a7h,c6h,59h,5ah,a1h,e7h,aeh,d2h
+			db	efh,96h,3ch,6ah,00h,28h,08h,dch
+			db	81h,65h,ech,03h,0eh,6eh,4ch,5bh
+			db	d2h,ebh,d6h,31h,f7h,94h,0dh,91h
+			db	a8h,8bh,0ah,23h,99h,d0h,dah,4ah
+			db	4dh,60h,1fh,b6h,40h,ffh,41h,dch
+			db	81h,cfh,fbh,0fh,2fh,8fh,d9h,45h
+			db	46h,05h,92h,37h,97h,4dh,8bh,60h
+			db	c9h,fah,96h,d1h,66h,27h,18h,79h
+			db	bdh,16h,4ah,b9h,07h,2ah,77h,dbh
+			db	f7h,3bh,1dh,4fh,53h,c3h,eeh,2eh
+			db	8eh,75h,86h,c2h,b9h,fbh,c4h,0bh
+			db	eeh,aah,72h,26h,17h,aah,9eh,88h
+			db	64h,21h,0bh,a7h,cbh,b9h,92h,13h
+			db	b9h,36h,61h,fah,82h,ddh,51h,1bh
+			db	58h,78h,e8h,00h,edh,e7h,10h,c9h
+			db	a0h,51h,4eh,74h,44h,29h,97h,bch
+			db	56h,27h,ech,bbh,2fh,c5h,e7h,21h
+			db	62h,edh,1ch,eah,d7h,08h,adh,0fh
+			db	90h,3ah,6fh,d4h,fah,9dh,44h,6ah
+			db	86h,25h,57h,8fh,f9h,11h,16h,7ch
+			db	f8h,cdh,8bh,f8h,7dh,efh,ffh,e5h
+			db	22h,a4h,20h,21h,9bh,30h,3fh,74h
+			db	c5h,1bh,0eh,86h,91h,e7h,59h,81h
+			db	87h,7fh,a9h,7ah,a7h,81h,ceh,7bh
+			db	e0h,3eh,f6h,a4h,29h,2ah,78h,72h
+			db	1fh,49h,cdh,f9h,d2h,0dh,93h,6ah
+			db	b6h,17h,6eh,b9h,eah,d3h,60h,93h
+			db	a9h,40h,f6h,ech,b3h,bbh,91h,96h
+			db	d8h,54h,1fh,d7h,97h,2bh,3dh,b0h
+			db	67h,efh,56h,e0h,f8h,30h,d6h,f3h
+			db	54h,cah,e0h,52h,aah,28h,55h,e8h
+			db	8dh,c3h,0eh,5ah,0fh,86h,bch,2eh
+			db	47h,b6h,e4h,50h,27h,d9h,90h,65h
+			db	c7h,6bh,80h,b9h,e8h,46h,b5h,33h
+			db	c0h,fbh,9fh,dah,e7h,9bh,5fh,2fh
+			db	cbh,a3h,76h,b1h,90h,32h,08h,6ch
+			db	48h,3dh,cah,88h,aeh,2ah,58h,e0h
+			db	deh,ech,edh,e3h,6fh,19h,0fh,f8h
+			db	5ah,e7h,1bh,0ah,1fh,80h,53h,4dh
+			db	06h,c6h,b8h,50h,62h,f0h,d6h,6bh
+			db	a1h,27h,26h,ddh,3eh,67h,79h,90h
+			db	11h,67h,8ah,0ch,c5h,abh,39h,8fh
+			db	d3h,4dh,deh,35h,ech,4fh,6ch,eah
+			db	26h,d1h,6eh,deh,90h,40h,58h,9dh
+			db	d5h,d5h,a3h,e7h,e4h,88h,26h,3ch
+			db	bah,3dh,1eh,33h,57h,93h,f9h,6fh
+			db	6fh,a3h,76h,88h,c9h,aah,95h,dbh
+			db	93h,56h,2eh,61h,8bh,37h,f6h,46h
+			db	cdh,19h,71h,afh,b9h,22h,a2h,1ah
+			db	52h,b9h,69h,a6h,7eh,15h,0bh,b6h
+			db	4ch,12h,a7h,d5h,fdh,5bh,1ah,7fh
+			db	a6h,dfh,30h,a6h,42h,a1h,8bh,15h
+			db	2ch,1ch,e6h,a5h,30h,a3h,82h,e8h
+			db	0eh,5eh,03h,07h,91h,a7h,3ch,eah
+			db	60h,d6h,dfh,77h,96h,c0h,44h,b4h
+			db	04h,dbh,68h,51h,49h,4bh,30h,12h
+			db	94h,09h,c4h,00h,35h,17h,92h,adh
+			db	ach,e3h,16h,83h,33h,7bh,23h,7fh
+			db	90h,30h,e4h,85h,45h,bbh,6eh,59h
+			db	1ch,52h,cah,c3h,34h,49h,44h,02h
+			db	ach,54h,61h,b9h,2bh,f4h,7ch,7fh
+			db	1dh,59h,61h,a5h,25h,08h,e0h,e5h
+			db	83h,bdh,38h,a8h,1fh,2fh,3ah,edh
+			db	41h,f1h,edh,cah,75h,31h,56h,eah
+			db	8ah,a1h,8bh,0dh,5ah,75h,61h,31h
+			db	3ah,6eh,feh,2eh,b1h,46h,91h,62h
+			db	19h,5dh,d6h,cfh,e3h,9dh,4dh,9bh
+			db	1ah,64h,05h,d7h,5ah,a3h,75h,3dh
+			db	61h,95h,16h,eeh,79h,79h,d3h,f2h
+			db	eah,1ch,4dh,fdh,5ch,3ah,b7h,37h
+			db	56h,2ah,b1h,97h,59h,49h,62h,d6h
+			db	aeh,ceh,65h,cfh,18h,fah,06h,0ch
+			db	e4h,a6h,e4h,92h,d5h,1bh,efh,b9h
+			db	7eh,aeh,c0h,1bh,feh,38h,a7h,a4h
+			db	b0h,22h,cfh,39h,8eh,3ch,46h,fch
+			db	9eh,fah,0fh,69h,a7h,3dh,1dh,21h
+			db	ceh,f6h,38h,04h,bbh,81h,91h,16h
+			db	94h,fdh,89h,0ch,edh,c6h,d0h,a4h
+			db	48h,ddh,44h,dch,e3h,f5h,e1h,80h
+			db	64h,aah,4bh,02h,84h,30h,9ah,bch
+			db	72h,85h,4fh,f4h,25h,ebh,f2h,94h
+			db	10h,c5h,06h,31h,c1h,93h,78h,02h
+			db	8ah,e1h,61h,7dh,3dh,c3h,96h,28h
+			db	cah,e7h,9ah,2fh,96h,9bh,f4h,76h
+			db	e5h,98h,feh,e2h,6bh,60h,14h,0eh
+			db	feh,c0h,afh,98h,8ch,eah,3dh,56h
+			db	c6h,fbh,dch,afh,e1h,fah,e2h,feh
+			db	afh,c5h,86h,77h,63h,0ch,39h,28h
+			db	15h,c3h,e9h,f3h,6dh,05h,39h,1fh
+			db	f5h,65h,85h,6fh,67h,83h,84h,a2h
+			db	c1h,e7h,ddh,80h,f2h,6ah,5dh,8dh
+			db	e2h,c6h,a7h,40h,e8h,fbh,73h,37h
+			db	68h,54h,3ch,26h,30h,c0h,52h,50h
+			db	cdh,3dh,efh,a6h,20h,bch,b9h,a7h
+			db	f2h,47h,f3h,76h,3bh,e4h,60h,a1h
+			db	4bh,a1h,9dh,3ah,2dh,a8h,cch,53h
+			db	b9h,e5h,31h,58h,13h,08h,60h,2ah
+			db	5fh,68h,84h,0fh,70h,6fh,44h,9fh
+			db	7bh,36h,24h,6bh,4dh,23h,01h,afh
+			db	07h,62h,cah,2ch,7ch,edh,edh,cch
+			db	8dh,7eh,50h,f4h,d3h,cbh,54h,20h
+			db	0fh,16h,a8h,bah,67h,6eh,f8h,e6h
+			db	46h,bfh,5fh,5ah,94h,a8h,e9h,66h
+			db	66h,5ah,9bh,80h,c1h,b1h,8dh,fdh
+			db	a6h,77h,9ch,6eh,2fh,8dh,4ah,05h
+			db	4eh,48h,7fh,46h,80h,a4h,3ah,f6h
+			db	99h,d7h,5ah,42h,83h,c7h,82h,5bh
+			db	71h,c6h,57h,6ah,03h,fbh,d8h,a5h
+			db	6ch,86h,9dh,efh,3bh,59h,83h,2ah
+			db	c3h,7eh,ddh,9bh,6fh,d5h,2dh,17h
+			db	aeh,b7h,78h,5dh,2ch,efh,60h,c0h
+			db	ddh,1ch,f0h,f2h,49h,5ah,34h,46h
+			db	60h,10h,c5h,ach,4bh,34h,53h,7ch
+			db	4ah,1bh,9fh,3ch,26h,10h,70h,61h
+			db	38h,bdh,63h,b8h,67h,88h,c6h,f5h
+			db	69h,9eh,ach,ceh,e1h,02h,d7h,f7h
+			db	61h,47h,74h,34h,34h,cdh,b9h,fbh
+			db	72h,bbh,3ch,0dh,e4h,93h,d4h,73h
+			db	a0h,89h,bfh,efh,bbh,b0h,1ch,19h
+			db	f1h,04h,f7h,e6h,79h,7bh,a1h,f1h
+			db	cah,7fh,6eh,08h,78h,4fh,e4h,e6h
+			db	01h,25h,9bh,04h,bch,c7h,97h,79h
+			db	3dh,c4h,d4h,41h,19h,9ch,05h,e0h
+			db	76h,92h,feh,88h,0dh,08h,edh,10h
+			db	c5h,6dh,26h,0dh,96h,5fh,36h,b3h
+			db	a8h,30h,aeh,12h,ach,4ah,32h,7dh
+			db	cah,29h,c4h,0fh,69h,45h,d0h,02h
+			db	1ch,30h,85h,ceh,c7h,edh,05h,c8h
+			db	8bh,d7h,6eh,b1h,e4h,f5h,64h,0fh
+			db	c1h,c7h,13h,47h,e2h,e9h,95h,c4h
+			db	16h,8dh,c0h,5dh,e3h,16h,66h,03h
+			db	6eh,fch,53h,61h,34h,95h,3dh,87h
+			db	8dh,d9h,6dh,92h,5ah,5dh,c3h,2ch
+			db	3dh,08h,90h,91h,8bh,63h,a2h,f8h
+			db	67h,17h,64h,61h,97h,aah,81h,2dh
+			db	6bh,62h,2dh,82h,fdh,17h,ffh,23h
+			db	b1h,53h,55h,75h,3ah,51h,65h,c2h
+			db	30h,7eh,16h,89h,83h,b0h,7eh,35h
+			db	92h,0fh,dch,6bh,62h,d2h,d9h,5fh
+			db	d9h,b9h,1dh,53h,e4h,4ah,fah,68h
+			db	53h,d8h,00h,23h,44h,0fh,e3h,08h
+			db	6ah,63h,f6h,6dh,a8h,cdh,d6h,3bh
+			db	86h,9ch,68h,37h,87h,1ah,ach,61h
+			db	75h,4ah,85h,41h,27h,efh,92h,edh
+			db	17h,93h,4ch,92h,14h,40h,ech,05h
+			db	ech,bch,adh,fdh,8ch,ddh,13h,43h
+			db	f4h,6bh,deh,14h,66h,71h,6bh,cbh
+			db	d2h,bah,dah,7ch,3ch,a5h,85h,0bh
+			db	aeh,34h,a5h,1dh,3eh,50h,79h,74h
+			db	c0h,deh,0fh,4eh,78h,dbh,b1h,1fh
+			db	37h,51h,bfh,cch,40h,b3h,57h,bfh
+			db	9ah,5bh,30h,25h,56h,4ch,ffh,f0h
+			db	fdh,39h,85h,42h,3bh,dfh,9bh,07h
+			db	a8h,adh,98h,08h,a4h,25h,8eh,10h
+			db	5ah,37h,e6h,53h,cch,00h,85h,40h
+			db	12h,fch,b0h,fch,55h,d3h,dah,32h
+			db	3dh,5dh,83h,c9h,8ch,85h,99h,69h
+			db	54h,b1h,94h,2bh,1ch,29h,e7h,5bh
+			db	67h,aah,9ch,abh,07h,76h,b0h,4ah
+			db	3ah,4bh,dch,88h,5fh,2fh,71h,b1h
+			db	39h,99h,a3h,d7h,2dh,24h,95h,96h
+			db	c1h,57h,54h,04h,a5h,76h,f4h,92h
+			db	eeh,00h,9fh,c8h,afh,03h,70h,22h
+			db	96h,3dh,b7h,c3h,67h,f5h,18h,adh
+			db	e4h,12h,74h,14h,8ah,8dh,dch,4ch
+			db	2ch,8ah,54h,ach,c7h,62h,e3h,a0h
+			db	34h,35h,e7h,30h,78h,b8h,d2h,e1h
+			db	d4h,a7h,c0h,aah,84h,34h,70h,37h
+			db	50h,7ah,abh,fah,0ah,d2h,98h,5bh
+			db	ach,2eh,26h,8dh,a9h,2eh,d1h,3dh
+			db	ebh,52h,0bh,b1h,bbh,0dh,48h,21h
+			db	77h,deh,81h,9dh,f7h,dbh,23h,49h
+			db	7ah,ebh,56h,a1h,f7h,02h,75h,bdh
+			db	6dh,b8h,e9h,1bh,78h,bdh,9dh,99h
+			db	a3h,22h,e4h,dbh,3fh,5ch,3dh,23h
+			db	8ch,0eh,7ch,9ah,d9h,7fh,f0h,a3h
+			db	18h,47h,85h,bah,25h,3eh,3bh,e8h
+			db	c8h,ach,49h,87h,fch,dbh,abh,9eh
+			db	adh,30h,13h,d3h,8ch,a7h,b3h,89h
+			db	08h,17h,57h,5ch,0eh,59h,69h,f8h
+			db	43h,09h,0eh,5ah,8ch,3dh,07h,26h
+			db	f2h,2fh,f9h,b6h,24h,e9h,00h,63h
+			db	71h,ddh,63h,c3h,85h,ach,99h,59h
+			db	cah,abh,03h,6ch,c8h,4bh,04h,5eh
+			db	cah,80h,a0h,d3h,9fh,cbh,67h,69h
+			db	20h,14h,f4h,a4h,78h,f4h,d9h,9fh
+			db	39h,96h,f5h,57h,76h,67h,3eh,18h
+			db	50h,b8h,ach,dbh,18h,3bh,33h,f8h
+			db	d7h,98h,c9h,d7h,8ch,5ch,16h,5dh
+			db	66h,0ch,e2h,25h,70h,1ch,eah,92h
+			db	80h,b8h,3fh,8bh,9ah,c0h,4ch,35h
+			db	46h,57h,ddh,49h,97h,0ah,9fh,35h
+			db	0ch,32h,c6h,3eh,84h,8eh,87h,eeh
+			db	e1h,edh,70h,15h,fah,60h,2dh,b8h
+			db	0ah,a1h,bdh,c0h,feh,60h,ddh,a7h
+			db	9ch,2dh,8eh,58h,07h,35h,b5h,31h
+			db	c8h,9dh,b4h,a3h,eeh,5eh,b1h,5dh
+			db	c7h,0eh,0ah,abh,d3h,b1h,cch,ech
+			db	90h,6fh,55h,43h,a1h,2fh,14h,6bh
+			db	59h,7eh,d0h,d2h,c7h,f3h,38h,3ch
+			db	c4h,6dh,73h,c8h,ebh,eah,75h,01h
+			db	46h,a4h,b3h,cah,7dh,8ah,ceh,d7h
+			db	81h,e0h,55h,1dh,0dh,20h,28h,47h
+			db	53h,5eh,16h,a6h,ffh,41h,9fh,4bh
+			db	c5h,12h,f8h,71h,64h,d9h,23h,c7h
+			db	beh,28h,09h,56h,49h,afh,bfh,3eh
+			db	80h,c8h,c7h,f3h,0bh,d9h,5dh,ddh
+			db	4ch,adh,1fh,98h,5ah,4ch,00h,d7h
+			db	deh,0fh,2ch,d9h,37h,6dh,c5h,afh
+			db	a1h,12h,3bh,f9h,66h,fch,07h,1ah
+			db	46h,f4h,95h,35h,c7h,92h,f2h,3eh
+			db	e6h,a3h,ach,f5h,b0h,25h,f1h,fah
+			db	eeh,aah,d0h,07h,8ch,00h,41h,a2h
+			db	feh,2bh,efh,f1h,0bh,37h,93h,54h
+			db	6dh,89h,d7h,f6h,8bh,dbh,f8h,7fh
+			db	23h,ddh,9ah,46h,c4h,69h,90h,0ch
+			db	dfh,94h,81h,30h,f3h,2ch,12h,3bh
+			db	56h,adh,b4h,dfh,dah,60h,efh,9eh
+			db	bah,cdh,a3h,30h,28h,2ah,6fh,bdh
+			db	14h,8dh,bfh,16h,94h,e7h,56h,e0h
+			db	87h,c5h,13h,22h,4ch,efh,b7h,8dh
+			db	6ah,d6h,40h,e6h,d7h,a7h,2dh,c5h
+			db	11h,e8h,3fh,cdh,00h,4ch,29h,8fh
+			db	59h,0eh,c7h,1eh,58h,b5h,5bh,d4h
+			db	5dh,e7h,b3h,73h,d0h,9eh,97h,fch
+			db	85h,48h,23h,95h,62h,ach,07h,e1h
+			db	5dh,98h,75h,a6h,37h,1ch,efh,5ah
+			db	c1h,7ch,1eh,01h,08h,75h,69h,22h
+			db	41h,f0h,1bh,efh,cdh,1bh,59h,61h
+			db	d3h,cfh,b8h,2dh,fbh,0dh,67h,feh
+			db	b7h,3dh,4eh,73h,dbh,3eh,42h,97h
+			db	ffh,ech,24h,c6h,83h,32h,0eh,09h
+			db	27h,c0h,f5h,c8h,cdh,94h,4bh,04h
+			db	d0h,a5h,29h,fbh,dfh,44h,11h,88h
+			db	5ch,07h,ceh,95h,e4h,4dh,26h,08h
+			db	aah,e7h,16h,a1h,64h,61h,30h,51h
+			db	b9h,f1h,c6h,49h,60h,a4h,31h,ddh
+			db	b4h,c7h,79h,fch,07h,7ah,3dh,4ah
+			db	1ch,afh,1ah,67h,3ch,65h,11h,dfh
+			db	2bh,30h,95h,25h,1ah,60h,d5h,ceh
+			db	9ch,10h,0ah,19h,07h,c4h,22h,5bh
+			db	8ch,15h,00h,4ch,b3h,57h,b3h,39h
+			db	3ch,f5h,76h,60h,61h,beh,81h,8dh
+			db	08h,39h,9fh,60h,e2h,39h,fch,3bh
+			db	4ch,12h,bch,9ah,16h,b4h,b2h,50h
+			db	40h,81h,7ah,c4h,2ch,13h,b3h,99h
+			db	07h,a8h,99h,85h,fch,8bh,28h,36h
+			db	6fh,9ch,32h,f8h,a5h,fbh,bbh,3fh
+			db	c8h,fch,f4h,e7h,efh,78h,7ch,15h
+			db	87h,adh,3ch,bah,f7h,b2h,36h,7fh
+			db	69h,feh,24h,a1h,f3h,c5h,0ah,f4h
+			db	6ch,0dh,afh,c2h,89h,2dh,edh,c6h
+			db	bch,83h,77h,0ah,34h,2ah,63h,aeh
+			db	41h,3ch,64h,dch,c4h,50h,83h,61h
+			db	cfh,53h,91h,43h,17h,38h,0bh,9ch
+			db	18h,2bh,10h,10h,a8h,72h,dfh,aah
+			db	a8h,0bh,73h,bch,46h,cch,93h,4dh
+			db	81h,2eh,56h,31h,adh,b1h,d6h,18h
+			db	16h,9ch,1bh,7bh,f8h,51h,bdh,78h
+			db	ach,47h,f1h,6ch,30h,a2h,44h,9dh
+			db	e9h,e9h,20h,66h,f5h,f3h,ceh,9bh
+			db	ddh,beh,1eh,b0h,45h,edh,6fh,d5h
+			db	cbh,5ah,8eh,cfh,e5h,c9h,6bh,e6h
+			db	53h,33h,c4h,7ah,64h,15h,6fh,27h
+			db	fch,d6h,0eh,0ch,60h,16h,72h,63h
+			db	f1h,fdh,26h,a7h,6dh,80h,f4h,1bh
+			db	76h,a3h,97h,afh,a2h,39h,cdh,97h
+			db	cch,4ah,6bh,63h,79h,b9h,58h,19h
+			db	59h,5bh,8eh,0fh,95h,eeh,17h,e9h
+			db	4dh,fdh,4ah,b5h,63h,dfh,15h,f1h
+			db	39h,afh,d3h,c8h,f5h,2ch,6ah,ddh
+			db	05h,eeh,a3h,c0h,72h,21h,d5h,13h
+			db	5dh,adh,97h,14h,aah,dbh,7ah,ach
+			db	09h,36h,15h,d6h,e2h,a4h,20h,56h
+			db	a1h,8ah,44h,60h,32h,aeh,ffh,f8h
+			db	f3h,cdh,07h,1dh,37h,33h,95h,18h
+			db	ddh,16h,cch,dbh,4eh,2bh,96h,e9h
+			db	fbh,e1h,9eh,c8h,81h,ach,efh,0dh
+			db	9ah,00h,58h,11h,b9h,5bh,0ch,49h
+			db	96h,99h,93h,86h,fbh,41h,bch,e1h
+			db	80h,68h,edh,9ch,eah,d5h,78h,81h
+			db	08h,cah,8bh,82h,05h,2eh,6fh,a5h
+			db	fdh,bdh,03h,8ch,3fh,18h,27h,b7h
+			db	02h,e1h,bbh,0fh,bah,76h,c7h,bbh
+			db	14h,d8h,64h,d7h,a6h,06h,bfh,e7h
+			db	60h,74h,b7h,5ah,02h,deh,6bh,1fh
+			db	c4h,d6h,24h,14h,79h,0ah,06h,ffh
+			db	51h,4bh,4bh,dch,29h,c9h,70h,deh
+			db	84h,32h,85h,9ah,8fh,3fh,7dh,68h
+			db	29h,2ch,0ch,deh,c8h,a8h,b7h,8eh
+			db	7ah,52h,8ah,59h,6eh,17h,48h,99h
+			db	55h,99h,eeh,f7h,45h,b7h,19h,b2h
+			db	02h,82h,19h,f1h,18h,ach,90h,f5h
+			db	9ah,01h,6ch,e2h,a5h,04h,c1h,8dh
+			db	7ah,ffh,81h,93h,afh,d4h,7dh,44h
+			db	deh,e0h,e7h,22h,ffh,c9h,84h,fah
+			db	6fh,9bh,f3h,1ah,d5h,c6h,0eh,2ah
+			db	11h,11h,f2h,47h,9ah,fch,6fh,70h
+			db	0bh,96h,76h,f6h,deh,5fh,7fh,9ch
+			db	dah,2bh,7fh,9ch,6dh,e4h,ech,5fh
+			db	66h,64h,bdh,a9h,bbh,42h,85h,2dh
+			db	bah,52h,04h,edh,8eh,23h,b8h,8fh
+			db	f9h,20h,90h,dfh,d8h,83h,38h,3ch
+			db	18h,6dh,4eh,08h,80h,54h,63h,0bh
+			db	dah,94h,37h,8dh,2fh,01h,c7h,0ch
+			db	fbh,4eh,2ch,1bh,27h,cch,3bh,b2h
+			db	f7h,5bh,fah,69h,22h,1eh,6dh,26h
+			db	d0h,45h,36h,d6h,22h,07h,09h,ech
+			db	4ah,76h,28h,52h,e9h,8bh,4bh,92h
+			db	f7h,d5h,8fh,40h,5bh,2ch,66h,a5h
+			db	8ch,7bh,7bh,e3h,4eh,feh,1bh,f2h
+			db	c8h,f1h,78h,16h,b1h,3eh,c5h,3bh
+			db	5ch,6eh,2fh,6bh,43h,18h,e8h,b3h
+			db	e2h,f8h,9ch,ddh,b4h,d0h,50h,4bh
+			db	0dh,9fh,a8h,b4h,b7h,67h,86h,38h
+			db	6fh,f6h,9ch,76h,7ch,37h,9ch,01h
+			db	0ah,3bh,63h,60h,b1h,8fh,47h,79h
+			db	7fh,cah,2bh,bah,ceh,fbh,2fh,17h
+			db	39h,7fh,3eh,c6h,cch,4eh,6ch,f7h
+			db	11h,1dh,a0h,11h,ebh,49h,8fh,17h
+			db	a7h,53h,8ch,12h,efh,86h,77h,a9h
+			db	b5h,74h,c9h,0eh,9ch,d9h,fbh,cdh
+			db	82h,07h,60h,1dh,5fh,b7h,edh,b6h
+			db	36h,adh,5eh,6bh,78h,7eh,35h,5dh
+			db	0ah,e1h,d7h,79h,4ch,c5h,10h,6ah
+			db	1dh,e8h,d9h,bch,b8h,b3h,8ah,aah
+			db	a2h,35h,11h,21h,03h,89h,ach,9dh
+			db	7ah,c9h,b7h,a7h,66h,7ah,06h,f9h
+			db	4ch,fbh,5dh,74h,98h,b4h,cch,4ah
+			db	fbh,31h,6ah,bdh,a7h,d5h,18h,8bh
+			db	f1h,b8h,e2h,eeh,85h,dch,e3h,5ch
+			db	4ah,0fh,81h,dbh,3ch,ffh,1dh,43h
+			db	56h,e0h,69h,61h,a5h,50h,a5h,2bh
+			db	92h,17h,1bh,87h,17h,bbh,bdh,a7h
+			db	8fh,37h,d5h,6ch,70h,01h,c1h,0fh
+			db	d5h,8dh,5fh,82h,e0h,4eh,8ch,68h
+			db	f4h,ceh,9eh,24h,a8h,9bh,83h,53h
+			db	8dh,d8h,51h,07h,83h,79h,48h,20h
+			db	25h,20h,e2h,7fh,eeh,2ah,e1h,78h
+			db	b6h,a9h,16h,52h,7eh,cfh,52h,3dh
+			db	52h,12h,8fh,38h,c2h,2fh,c7h,95h
+			db	1fh,77h,9ah,ffh,c3h,81h,2bh,77h
+			db	85h,22h,d0h,0ah,cbh,76h,12h,4ah
+			db	95h,65h,fbh,2ah,a5h,ech,68h,49h
+			db	34h,aah,70h,6eh,edh,4dh,45h,69h
+			db	41h,66h,d1h,e5h,60h,a0h,a8h,75h
+			db	9eh,0ch,68h,a4h,b9h,c7h,d7h,adh
+			db	b5h,4ch,72h,eah,e6h,08h,0fh,c8h
+			db	b0h,84h,84h,b6h,27h,16h,e5h,54h
+			db	9ah,77h,61h,f0h,44h,5bh,6fh,d2h
+			db	83h,3fh,c2h,3dh,cbh,97h,c0h,f8h
+			db	f9h,6ah,fah,67h,20h,dfh,beh,feh
+			db	3eh,beh,9ah,0bh,3eh,c7h,76h,c3h
+			db	06h,f9h,64h,dah,6fh,efh,b3h,f3h
+			db	1eh,47h,a6h,98h,72h,b3h,9ch,9dh
+			db	06h,60h,c3h,06h,cch,34h,bdh,01h
+			db	45h,56h,98h,2ch,1dh,dch,93h,d7h
+			db	4ch,40h,85h,6eh,9ch,92h,7eh,7bh
+			db	f4h,76h,f8h,8ah,9bh,f8h,00h,53h
+			db	78h,65h,69h,aeh,9ah,beh,edh,9bh
+			db	b9h,76h,d6h,dah,fch,ach,d1h,88h
+			db	77h,b7h,53h,deh,5ah,43h,8ah,f2h
+			db	11h,cfh,a8h,c6h,6ah,3ch,11h,2bh
+			db	d3h,1eh,32h,ddh,8ch,48h,00h,c0h
+			db	cbh,17h,2ch,e4h,8ch,60h,8fh,52h
+			db	04h,c5h,8fh,86h,01h,c8h,c7h,3ch
+			db	53h,c4h,62h,f9h,3fh,50h,28h,71h
+			db	71h,86h,e5h,ddh,82h,27h,60h,8ch
+			db	e6h,a4h,47h,5eh,05h,eah,4fh,72h
+			db	b7h,4ch,d0h,d8h,5eh,75h,d8h,59h
+			db	a9h,fdh,cah,cdh,94h,dah,e8h,a4h
+			db	8fh,18h,c9h,3bh,40h,4ah,dfh,9eh
+			db	79h,67h,76h,9bh,e1h,a7h,bah,cdh
+			db	68h,f2h,f2h,7fh,d8h,f9h,85h,e0h
+			db	5ah,a6h,67h,c0h,bfh,62h,15h,18h
+			db	a5h,afh,f1h,19h,8eh,72h,32h,76h
+			db	a3h,fch,bdh,e4h,57h,44h,22h,3bh
+			db	f6h,f9h,23h,beh,41h,05h,5dh,5eh
+			db	b3h,58h,5ch,33h,76h,89h,27h,95h
+			db	93h,49h,d5h,b8h,38h,1fh,4bh,04h
+			db	3ch,c6h,e3h,66h,7ah,46h,c8h,2eh
+			db	6fh,e4h,67h,f2h,88h,e0h,4bh,5eh
+			db	2ah,b7h,e6h,6ch,a0h,21h,cah,6dh
+			db	a8h,e4h,efh,c1h,83h,8ch,39h,dch
+			db	bah,ebh,30h,7ah,4ch,d1h,dch,4ch
+			db	c9h,94h,49h,04h,49h,e0h,6fh,80h
+			db	48h,48h,e5h,0bh,99h,30h,71h,75h
+			db	dch,7fh,cbh,a7h,69h,2eh,12h,e0h
+			db	42h,25h,f6h,42h,01h,b6h,32h,91h
+			db	e7h,f9h,3ah,71h,c7h,c9h,d5h,9fh
+			db	84h,5eh,adh,c2h,e6h,81h,61h,ech
+			db	2dh,aeh,39h,58h,c4h,c3h,06h,98h
+			db	cah,d3h,d4h,1eh,32h,16h,ech,c8h
+			db	8ah,4ch,abh,38h,efh,2bh,81h,9bh
+			db	60h,b1h,1fh,49h,c9h,74h,30h,b7h
+			db	c4h,dah,0bh,76h,32h,4bh,9ch,68h
+			db	48h,77h,27h,7dh,34h,b7h,63h,efh
+			db	1ah,ach,22h,72h,96h,24h,d6h,84h
+			db	67h,07h,d7h,b4h,4eh,18h,91h,f1h
+			db	4dh,c8h,0bh,c6h,33h,e8h,c3h,85h
+			db	92h,e1h,b3h,92h,c8h,a4h,11h,41h
+			db	78h,21h,46h,dch,54h,21h,ddh,65h
+			db	25h,abh,6ah,61h,47h,7eh,f8h,71h
+			db	d5h,22h,e7h,e6h,08h,a2h,d7h,d4h
+			db	71h,16h,cah,2eh,98h,6fh,adh,beh
+			db	adh,6bh,85h,81h,58h,86h,a0h,cah
+			db	5bh,a5h,15h,7fh,6ah,b1h,adh,0dh
+			db	61h,74h,13h,15h,e1h,2fh,07h,feh
+			db	3eh,98h,deh,83h,98h,53h,26h,51h
+			db	48h,5eh,03h,1dh,66h,6ah,a7h,d4h
+			db	06h,36h,cfh,40h,cah,04h,f4h,9dh
+			db	3ch,28h,a7h,fbh,4fh,4eh,1ah,f8h
+			db	33h,0eh,dfh,6ch,80h,b0h,5ah,c9h
+			db	0ah,79h,0fh,76h,3eh,bbh,cch,05h
+			db	16h,afh,05h,b3h,01h,edh,e5h,50h
+			db	bch,b4h,69h,6bh,a4h,50h,f7h,a7h
+			db	dch,39h,1fh,7dh,3bh,32h,59h,19h
+			db	b2h,c1h,1fh,e0h,cbh,f6h,f8h,03h
+			db	88h,4fh,1ah,7fh,b0h,c9h,66h,ffh
+			db	78h,89h,08h,1eh,abh,56h,35h,8dh
+			db	38h,81h,4ah,8dh,bah,cah,29h,c3h
+			db	b5h,3ch,7eh,57h,bah,e0h,adh,58h
+			db	09h,50h,1ah,2dh,0dh,cdh,ffh,5ch
+			db	2dh,18h,ebh,78h,09h,7fh,1ah,d7h
+			db	83h,57h,62h,99h,33h,abh,52h,a5h
+			db	3fh,83h,08h,b5h,02h,3ch,c5h,49h
+			db	a0h,c7h,65h,deh,c2h,fch,11h,1bh
+			db	31h,e8h,51h,61h,13h,4eh,c4h,dfh
+			db	27h,fah,60h,6eh,3dh,a7h,ceh,2bh
+			db	87h,d4h,4ah,efh,26h,93h,f6h,ddh
+			db	7eh,adh,cfh,e3h,9ch,63h,95h,1dh
+			db	aah,31h,bfh,80h,a4h,bbh,b5h,71h
+			db	44h,fch,6bh,1bh,e0h,bah,3fh,e1h
+			db	c5h,b2h,59h,30h,cfh,ach,72h,6ch
+			db	5fh,0fh,04h,29h,22h,85h,93h,f4h
+			db	59h,98h,dfh,f8h,72h,89h,f9h,33h
+			db	74h,cfh,20h,3fh,1eh,c4h,05h,53h
+			db	b5h,2bh,10h,7ch,c5h,57h,e2h,66h
+			db	96h,ddh,efh,6eh,46h,f1h,31h,41h
+			db	c4h,b5h,95h,08h,18h,50h,d4h,7fh
+			db	08h,efh,35h,9dh,a5h,f3h,ddh,00h
+			db	57h,f4h,e4h,4dh,eah,62h,e5h,4bh
+			db	75h,2eh,84h,d1h,9ah,1dh,53h,75h
+			db	02h,b5h,39h,11h,f7h,c8h,e2h,23h
+			db	77h,22h,9eh,f6h,beh,03h,a4h,5dh
+			db	dbh,fbh,a8h,3dh,52h,87h,42h,d5h
+			db	30h,8dh,77h,34h,82h,28h,f5h,40h
+			db	75h,00h,0dh,81h,0bh,3eh,a8h,29h
+			db	77h,12h,06h,4ch,25h,deh,0ch,fdh
+			db	a6h,ebh,41h,0eh,41h,d1h,00h,09h
+			db	67h,b7h,44h,37h,8ah,bch,5ch,b6h
+			db	c0h,ach,0eh,6eh,e7h,e2h,42h,54h
+			db	22h,aah,3fh,90h,3ah,6bh,90h,35h
+			db	1ch,c2h,d8h,dah,9ch,cfh,feh,31h
+			db	a8h,5fh,f7h,0ch,0dh,4ah,47h,36h
+			db	c3h,c4h,4ch,73h,8fh,d0h,65h,3ch
+			db	a7h,81h,50h,61h,55h,87h,b6h,e3h
+			db	f8h,89h,41h,f1h,9ah,9fh,aah,c5h
+			db	28h,87h,abh,52h,a5h,9fh,9ah,e8h
+			db	b8h,eeh,55h,f6h,c4h,99h,8ch,2ch
+			db	9ch,77h,1fh,5dh,0eh,09h,0dh,73h
+			db	4fh,18h,08h,79h,91h,8ah,f6h,52h
+			db	feh,efh,c3h,25h,33h,1eh,58h,12h
+			db	2bh,18h,9dh,1dh,40h,19h,cah,e2h
+			db	1bh,4eh,55h,ech,89h,82h,9bh,c4h
+			db	20h,fbh,ceh,52h,e9h,77h,07h,3bh
+			db	02h,86h,b5h,1fh,82h,fdh,d8h,7bh
+			db	80h,bfh,61h,b4h,d3h,83h,4dh,a2h
+			db	3dh,b3h,0ah,07h,d5h,15h,16h,eeh
+			db	1dh,bdh,aeh,bdh,31h,4dh,b1h,dfh
+			db	a4h,cdh,e6h,f6h,4fh,43h,69h,2fh
+			db	04h,78h,b5h,79h,b9h,ebh,1bh,f2h
+			db	5eh,d8h,36h,18h,c1h,7ch,0eh,4ah
+			db	42h,c0h,bch,e3h,5dh,b4h,15h,2eh
+			db	83h,6ah,65h,13h,b5h,45h,72h,adh
+			db	9fh,f2h,c0h,e9h,c2h,a0h,4eh,1bh
+			db	d9h,4ah,d6h,bah,94h,b8h,4eh,5dh
+			db	03h,05h,e3h,6fh,11h,d2h,cah,a9h
+			db	2ah,89h,97h,85h,70h,8fh,c4h,d4h
+			db	11h,a1h,c1h,3fh,8fh,87h,ceh,aeh
+			db	2fh,adh,d3h,10h,4bh,9fh,18h,2fh
+			db	89h,d1h,a0h,64h,9ah,4bh,c8h,21h
+			db	42h,0dh,fbh,71h,b6h,d5h,3fh,cdh
+			db	d6h,57h,4fh,1ch,eeh,b4h,58h,b2h
+			db	53h,99h,02h,1ch,32h,cch,30h,6ch
+			db	5fh,d9h,72h,f6h,66h,afh,3dh,56h
+			db	93h,f2h,7dh,c9h,e0h,9ah,5ch,f5h
+			db	59h,e0h,6bh,d6h,38h,bah,0ch,76h
+			db	34h,44h,81h,a9h,1fh,39h,6dh,beh
+			db	10h,4ah,31h,84h,35h,4eh,abh,efh
+			db	10h,30h,3bh,06h,94h,92h,56h,9eh
+			db	49h,51h,5fh,beh,efh,6ah,15h,73h
+			db	e0h,1ah,39h,7bh,b0h,ceh,37h,73h
+			db	72h,8fh,13h,fah,11h,47h,d2h,c5h
+			db	2dh,4bh,2ch,1eh,32h,c7h,89h,e5h
+			db	3ah,0fh,75h,f9h,dch,58h,ech,d6h
+			db	2bh,0bh,67h,dah,08h,59h,2fh,c3h
+			db	42h,fbh,cah,b2h,1ah,1eh,50h,40h
+			db	17h,8bh,f5h,cfh,4ch,50h,9ch,cbh
+			db	8ah,dah,98h,3ch,42h,6ch,d3h,13h
+			db	9ah,f0h,ech,62h,79h,8ch,cch,36h
+			db	c7h,beh,4ch,a0h,cdh,42h,f9h,7bh
+			db	f1h,f5h,a3h,33h,ebh,4bh,8fh,1fh
+			db	d6h,32h,cch,b6h,7bh,b3h,d4h,b1h
+			db	b0h,fdh,81h,45h,cfh,96h,45h,a5h
+			db	1bh,42h,cbh,02h,80h,65h,a4h,59h
+			db	47h,fdh,65h,2dh,d1h,70h,c2h,e9h
+			db	3fh,2ch,19h,66h,f7h,5ah,3bh,ebh
+			db	89h,02h,eah,eah,d2h,34h,b0h,55h
+			db	f6h,5eh,0bh,09h,0dh,9fh,35h,fdh
+			db	66h,44h,efh,a0h,e0h,72h,5ch,bah
+			db	adh,32h,d7h,e1h,93h,69h,fch,e1h
+			db	c4h,e0h,90h,b3h,d3h,c9h,60h,99h
+			db	79h,b8h,34h,4ch,6ah,c8h,89h,cbh
+			db	1fh,81h,bfh,09h,0dh,fch,4bh,3bh
+			db	95h,afh,39h,56h,bah,3eh,14h,e0h
+			db	34h,d8h,1dh,d7h,e3h,03h,bdh,f9h
+			db	83h,cfh,9fh,6eh,4ch,76h,ebh,96h
+			db	35h,f1h,4eh,cbh,6dh,94h,23h,95h
+			db	a4h,bbh,3bh,d9h,cbh,1ch,9bh,06h
+			db	c1h,2ah,0dh,a2h,a4h,87h,cfh,cah
+			db	fdh,4bh,45h,6ah,25h,1dh,2fh,d0h
+			db	41h,33h,c1h,0bh,56h,3eh,ebh,7ch
+			db	0fh,20h,30h,2bh,cah,cdh,82h,ceh
+			db	6eh,f6h,9dh,e0h,7dh,42h,57h,a6h
+			db	98h,85h,3ah,29h,0bh,4ah,46h,52h
+			db	d8h,dbh,f6h,7dh,3dh,c9h,b1h,96h
+			db	61h,b7h,c6h,04h,dfh,2bh,e0h,24h
+			db	cfh,29h,94h,8eh,dbh,10h,33h,cfh
+			db	c5h,98h,fch,60h,f8h,b6h,5dh,ech
+			db	83h,c3h,36h,d6h,54h,54h,37h,b8h
+			db	44h,06h,b2h,35h,a4h,25h,b8h,82h
+			db	9dh,e6h,1dh,f0h,d5h,39h,3ah,b6h
+			db	d6h,b6h,64h,4ch,79h,e5h,71h,e6h
+			db	39h,7bh,3fh,d2h,e5h,a0h,d0h,a6h
+			db	1dh,9eh,60h,05h,73h,cch,24h,e6h
+			db	beh,05h,68h,07h,6ah,feh,b6h,aah
+			db	80h,f5h,1dh,c6h,9dh,9ah,f6h,c6h
+			db	d5h,3dh,63h,44h,c5h,36h,86h,9fh
+			db	bbh,6fh,29h,15h,84h,98h,d4h,e5h
+			db	61h,8ch,b7h,aah,66h,62h,88h,c0h
+			db	fdh,cah,1eh,a9h,35h,ceh,49h,54h
+			db	53h,7dh,81h,dbh,6ah,ddh,62h,11h
+			db	79h,63h,ddh,7bh,b3h,85h,e0h,54h
+			db	05h,1bh,dah,3ah,90h,a4h,28h,20h
+			db	36h,f8h,dbh,26h,3dh,96h,5ah,0dh
+			db	feh,92h,91h,1dh,27h,beh,a5h,cbh
+			db	27h,a4h,35h,c4h,66h,e5h,6ch,ddh
+			db	dfh,64h,15h,fah,abh,84h,f5h,62h
+			db	55h,b4h,abh,b7h,92h,2ah,6dh,02h
+			db	8fh,e1h,79h,47h,49h,56h,cah,24h
+			db	cah,f7h,75h,a8h,3ah,d7h,e2h,f0h
+			db	69h,9fh,fbh,1fh,85h,50h,a3h,7ch
+			db	87h,64h,99h,80h,39h,deh,e9h,4fh
+			db	dch,ffh,6eh,3fh,5bh,7ch,fah,2fh
+			db	35h,14h,e1h,e7h,ech,8ah,32h,90h
+			db	29h,72h,28h,3ah,51h,32h,83h,28h
+			db	bah,85h,50h,1eh,4ah,beh,a3h,06h
+			db	f1h,d4h,93h,d9h,4ch,bfh,8ah,94h
+			db	eeh,e7h,75h,2fh,28h,cch,44h,38h
+			db	7dh,27h,1bh,abh,9dh,ebh,02h,c4h
+			db	b6h,b5h,d1h,f3h,54h,2fh,b9h,edh
+			db	75h,19h,e2h,b5h,fah,94h,a7h,15h
+			db	6dh,dah,d2h,43h,3fh,48h,c4h,c8h
+			db	47h,eah,bdh,a8h,1fh,d6h,2ah,4fh
+			db	20h,75h,ech,d7h,60h,11h,95h,07h
+			db	d2h,5dh,64h,90h,deh,c5h,80h,f7h
+			db	29h,0fh,00h,aah,97h,56h,78h,cdh
+			db	beh,b4h,aeh,04h,f1h,95h,f4h,6fh
+			db	41h,16h,26h,78h,17h,96h,06h,11h
+			db	eah,94h,15h,92h,a7h,00h,c8h,93h
+			db	0dh,84h,9eh,4dh,09h,9bh,08h,ach
+			db	b0h,e4h,46h,10h,f0h,b0h,c2h,8dh
+			db	e5h,d2h,cdh,b8h,d2h,f9h,1dh,79h
+			db	06h,b3h,29h,4ch,c1h,e4h,77h,a4h
+			db	61h,27h,7bh,cch,b0h,d9h,81h,e5h
+			db	c3h,26h,d8h,f3h,ech,50h,81h,07h
+			db	b3h,92h,c7h,96h,28h,a0h,63h,98h
+			db	18h,d1h,23h,9eh,64h,53h,adh,31h
+			db	a0h,b1h,97h,e8h,cah,4fh,34h,b4h
+			db	cah,34h,01h,37h,2ah,cfh,d6h,b9h
+			db	b2h,72h,3dh,d6h,37h,47h,9ah,67h
+			db	5ah,83h,99h,88h,dah,94h,6fh,deh
+			db	0ch,80h,14h,35h,7eh,5dh,b4h,e6h
+			db	6ah,21h,63h,adh,7fh,76h,87h,33h
+			db	54h,70h,80h,6ch,7ah,f1h,34h,96h
+			db	fbh,22h,e4h,efh,96h,6ah,57h,07h
+			db	63h,adh,05h,3eh,84h,13h,edh,fdh
+			db	cch,ceh,48h,35h,4dh,52h,04h,05h
+			db	a8h,11h,45h,c3h,07h,d3h,74h,6fh
+			db	82h,ach,a4h,58h,1fh,5fh,c1h,e2h
+			db	4bh,6fh,1fh,cbh,0bh,c4h,d5h,c3h
+			db	72h,2ah,10h,e0h,81h,54h,36h,44h
+			db	3fh,a7h,48h,dch,a6h,2fh,d4h,1ch
+			db	26h,e7h,34h,e6h,50h,81h,60h,22h
+			db	2ah,15h,37h,e1h,45h,4dh,96h,9eh
+			db	69h,7bh,1dh,5dh,70h,41h,63h,eeh
+			db	66h,94h,1ah,feh,9dh,c8h,58h,07h
+			db	07h,30h,f9h,5bh,4ah,a8h,1eh,25h
+			db	e0h,bch,c0h,6ah,54h,8eh,c1h,38h
+			db	bbh,cah,84h,fah,4bh,6fh,d3h,a6h
+			db	3ah,c7h,18h,b3h,27h,85h,eah,0ch
+			db	79h,71h,30h,39h,2bh,60h,a5h,82h
+			db	dfh,1dh,17h,8dh,5ah,6ah,c5h,81h
+			db	c0h,35h,11h,58h,08h,0ch,13h,d0h
+			db	fch,4bh,d1h,93h,f6h,ceh,deh,19h
+			db	1eh,bfh,a0h,8dh,23h,20h,f9h,aah
+			db	c3h,9ah,6ah,74h,7bh,09h,11h,abh
+			db	ebh,7bh,2ah,86h,92h,c9h,deh,1bh
+			db	c7h,02h,c7h,c1h,cfh,ceh,d5h,06h
+			db	69h,4dh,57h,b6h,2fh,90h,07h,36h
+			db	51h,17h,47h,6ah,c2h,62h,ach,09h
+			db	bbh,a8h,39h,7bh,28h,23h,d6h,6eh
+			db	71h,e2h,beh,b9h,ach,92h,5ch,25h
+			db	dbh,83h,b2h,25h,33h,44h,90h,abh
+			db	04h,4eh,64h,d5h,c6h,dbh,a2h,b9h
+			db	c6h,88h,32h,36h,edh,29h,e8h,eah
+			db	4bh,00h,66h,81h,49h,8ah,e8h,f5h
+			db	a1h,13h,55h,a4h,b4h,c6h,1eh,02h
+			db	52h,32h,5eh,a4h,fch,40h,75h,1dh
+			db	c3h,67h,1eh,16h,a1h,7bh,54h,a0h
+			db	58h,8ah,7eh,c6h,1bh,68h,26h,e9h
+			db	52h,01h,a1h,14h,96h,d0h,77h,f7h
+			db	f8h,f1h,54h,40h,adh,37h,dch,96h
+			db	28h,d6h,a2h,96h,63h,bdh,99h,5bh
+			db	abh,a6h,61h,13h,e2h,09h,62h,c7h
+			db	1ah,31h,96h,c2h,e4h,7fh,beh,f5h
+			db	6dh,9ah,27h,2dh,40h,d1h,50h,67h
+			db	44h,cfh,dfh,79h,53h,fch,8ah,c2h
+			db	26h,f2h,d0h,70h,6ch,aah,b4h,3bh
+			db	71h,10h,c2h,ddh,c1h,19h,ddh,dbh
+			db	3eh,7ch,25h,16h,55h,1eh,3fh,2ah
+			db	22h,f5h,95h,9fh,96h,9dh,99h,6bh
+			db	b5h,26h,31h,13h,70h,bah,b7h,d2h
+			db	abh,10h,c4h,27h,c9h,2eh,5eh,d8h
+			db	7fh,41h,39h,79h,36h,01h,50h,9dh
+			db	7eh,03h,92h,46h,f6h,8bh,6dh,83h
+			db	4bh,01h,d8h,bfh,c7h,c2h,26h,d2h
+			db	d2h,53h,aah,07h,e3h,f2h,14h,7bh
+			db	4dh,2dh,89h,24h,bch,f0h,1eh,10h
+			db	6bh,c8h,51h,5bh,50h,39h,14h,c3h
+			db	f9h,6eh,01h,2dh,64h,1ch,5dh,98h
+			db	4bh,1ch,15h,5ah,31h,bfh,33h,fbh
+			db	7eh,3eh,cbh,32h,1dh,77h,f3h,c5h
+			db	08h,a7h,08h,feh,66h,91h,d4h,afh
+			db	efh,53h,45h,a3h,bdh,dah,2fh,b2h
+			db	98h,a6h,b7h,59h,49h,19h,1ch,8dh
+			db	cdh,17h,d5h,f3h,43h,6eh,c9h,21h
+			db	47h,12h,1ch,d1h,41h,b2h,77h,31h
+			db	73h,56h,04h,b4h,20h,9bh,9bh,30h
+			db	47h,79h,46h,8ah,79h,b0h,afh,98h
+			db	1fh,7eh,b6h,54h,35h,c4h,28h,25h
+			db	12h,0eh,0fh,beh,48h,a0h,a7h,20h
+			db	fdh,92h,40h,11h,8ch,06h,0eh,b4h
+			db	a9h,cah,2eh,13h,68h,adh,93h,efh
+			db	68h,8dh,27h,87h,f6h,00h,1bh,95h
+			db	eah,7bh,a6h,f7h,fch,d0h,e7h,5ch
+			db	e2h,8ah,cbh,55h,31h,8bh,e6h,46h
+			db	d1h,5eh,57h,3ch,33h,72h,98h,51h
+			db	f2h,71h,e5h,4dh,e5h,11h,1fh,95h
+			db	0bh,a8h,50h,0ah,beh,08h,62h,6eh
+			db	22h,0dh,66h,7ch,36h,c1h,d8h,82h
+			db	51h,24h,d5h,95h,34h,e2h,0fh,20h
+			db	45h,76h,93h,76h,39h,c8h,8ah,49h
+			db	bdh,3fh,98h,82h,c2h,5ah,91h,67h
+			db	83h,8ah,76h,ebh,9dh,f6h,80h,32h
+			db	75h,31h,a4h,0dh,56h,0bh,b6h,8fh
+			db	04h,d3h,26h,a0h,e6h,11h,1fh,83h
+			db	09h,a4h,9eh,4dh,eah,91h,3eh,a2h
+			db	74h,fch,f6h,5fh,bdh,88h,71h,fah
+			db	32h,83h,66h,45h,a2h,16h,39h,8ch
+			db	bbh,91h,6eh,74h,2bh,0bh,adh,c2h
+			db	e2h,45h,31h,85h,4ch,ebh,7ah,13h
+			db	06h,17h,2fh,85h,c3h,c9h,07h,23h
+			db	deh,bah,c3h,59h,efh,7fh,17h,41h
+			db	99h,31h,34h,28h,a5h,5ah,92h,96h
+			db	5bh,18h,6dh,1fh,58h,76h,b5h,dfh
+			db	74h,f6h,3bh,61h,a0h,abh,6dh,7ah
+			db	dfh,5eh,eah,5bh,a2h,aah,19h,97h
+			db	f2h,91h,2ch,a8h,5eh,2bh,47h,08h
+			db	1ah,60h,48h,95h,90h,33h,ech,ceh
+			db	6ch,8bh,edh,fah,dbh,b4h,74h,0bh
+			db	63h,5fh,a5h,63h,bch,0ch,eeh,82h
+			db	bdh,c6h,a5h,5bh,3dh,23h,57h,aeh
+			db	52h,13h,75h,dfh,24h,15h,cch,a4h
+			db	61h,35h,38h,53h,fah,8eh,74h,15h
+			db	82h,29h,25h,18h,94h,67h,27h,35h
+			db	78h,b8h,51h,b2h,11h,d9h,ceh,e7h
+			db	41h,ebh,29h,5fh,51h,8dh,8dh,cfh
+			db	f8h,21h,95h,e9h,69h,4eh,c6h,45h
+			db	0fh,b4h,e7h,95h,cch,03h,55h,05h
+			db	21h,94h,29h,deh,43h,44h,39h,0bh
+			db	e7h,b9h,7ah,73h,a9h,9ah,37h,c0h
+			db	70h,7ch,f6h,1fh,afh,45h,b3h,6fh
+			db	9bh,b5h,55h,25h,bah,04h,43h,bah
+			db	dah,37h,bch,5eh,4dh,eeh,c3h,3fh
+			db	a6h,ceh,e9h,85h,82h,24h,81h,36h
+			db	a1h,3eh,30h,31h,34h,fbh,5dh,93h
+			db	cfh,02h,4fh,89h,cah,adh,83h,56h
+			db	13h,2ch,cfh,99h,a6h,d7h,0dh,ffh
+			db	7bh,e3h,09h,04h,44h,75h,8ah,16h
+			db	16h,dch,71h,eah,dfh,71h,bdh,83h
+			db	47h,ech,a5h,e5h,50h,8eh,55h,30h
+			db	25h,74h,adh,f2h,edh,54h,bch,d4h
+			db	eah,9ah,65h,a6h,b7h,84h,05h,ddh
+			db	4eh,02h,e1h,feh,cch,68h,2ah,26h
+			db	3ah,e4h,21h,e9h,92h,d8h,fah,fch
+			db	51h,c4h,beh,2fh,5ch,82h,fdh,bfh
+			db	1ah,b0h,04h,c1h,eah,19h,26h,6ah
+			db	29h,23h,d5h,58h,98h,74h,5fh,12h
+			db	1eh,c0h,e7h,90h,5ch,30h,16h,21h
+			db	c9h,cdh,1ah,c5h,47h,e1h,f7h,ffh
+			db	16h,fbh,91h,8ch,74h,01h,9ch,8bh
+			db	07h,8ch,abh,abh,55h,bdh,11h,53h
+			db	f7h,cbh,dfh,e7h,7ah,24h,f5h,7ah
+			db	65h,25h,0dh,78h,89h,ebh,60h,c0h
+			db	4fh,eeh,82h,3bh,41h,73h,9ch,34h
+			db	f5h,a4h,9ch,02h,bch,71h,e4h,c0h
+			db	0eh,53h,24h,5ah,eah,3ch,d4h,b0h
+			db	dch,8eh,24h,9dh,b1h,ach,04h,57h
+			db	05h,6ch,28h,f7h,61h,e1h,31h,8fh
+			db	44h,0fh,69h,13h,f8h,4fh,bah,beh
+			db	bch,0dh,35h,6ch,0ch,b5h,6dh,a1h
+			db	4eh,ceh,7dh,a7h,80h,0eh,eeh,bbh
+			db	bah,87h,f4h,04h,88h,f4h,7ch,f9h
+			db	9bh,01h,7ch,7bh,83h,c7h,00h,37h
+			db	92h,14h,a9h,04h,30h,3eh,e8h,25h
+			db	2eh,79h,b5h,c1h,f8h,9bh,52h,b8h
+			db	f7h,fch,d7h,98h,bbh,c5h,88h,a1h
+			db	0fh,6eh,91h,6dh,53h,7fh,42h,34h
+			db	74h,70h,edh,63h,ffh,e8h,b8h,8fh
+			db	67h,32h,0eh,57h,c8h,38h,f3h,feh
+			db	22h,8ah,ddh,93h,d4h,2dh,46h,0ch
+			db	01h,08h,d1h,46h,06h,e2h,feh,8ah
+			db	d5h,3bh,83h,b5h,9bh,60h,fch,44h
+			db	feh,67h,48h,75h,c0h,ddh,a5h,86h
+			db	02h,c6h,beh,8dh,c5h,4bh,47h,c7h
+			db	c6h,27h,e6h,dch,9ah,beh,bah,60h
+			db	e9h,eeh,94h,9dh,85h,52h,42h,6ch
+			db	63h,0dh,b4h,2fh,1bh,28h,43h,d4h
+			db	bdh,feh,d1h,b8h,dch,81h,c0h,dch
+			db	9ch,e9h,97h,7fh,6ch,27h,49h,00h
+			db	65h,17h,9dh,50h,25h,f4h,a3h,d2h
+			db	5eh,6ch,53h,1bh,9bh,25h,7dh,0fh
+			db	aah,fdh,9ah,adh,f3h,b6h,4ch,e8h
+			db	65h,3ch,7bh,3ch,55h,9fh,c5h,27h
+			db	91h,65h,68h,69h,1bh,3ch,edh,2bh
+			db	19h,cdh,6bh,d7h,d9h,55h,54h,53h
+			db	48h,4eh,a0h,7ch,7dh,5eh,7eh,6fh
+			db	a1h,f5h,dbh,d1h,ebh,0ch,cdh,4ch
+			db	4ch,cfh,63h,13h,44h,a5h,eeh,cfh
+			db	beh,deh,6bh,5bh,fbh,a3h,64h,2ah
+			db	01h,8ah,d9h,38h,fch,8ch,4eh,93h
+			db	68h,3ch,f7h,ceh,a1h,d9h,dfh,39h
+			db	50h,10h,bdh,b7h,3ch,67h,d8h,48h
+			db	8ch,6ah,61h,ebh,dbh,9dh,4eh,d6h
+			db	1bh,a1h,7ah,23h,7ch,23h,34h,03h
+			db	37h,c1h,39h,7dh,81h,ech,cah,9eh
+			db	23h,1dh,52h,72h,c2h,3fh,f4h,a5h
+			db	8fh,96h,b1h,41h,0bh,b1h,40h,6eh
+			db	a0h,7fh,48h,67h,ddh,55h,65h,92h
+			db	e0h,96h,77h,9ah,d9h,8fh,b1h,67h
+			db	59h,efh,54h,abh,e6h,d0h,b7h,ffh
+			db	eeh,d0h,60h,41h,d0h,22h,65h,5fh
+			db	2fh,d6h,23h,5dh,23h,bfh,59h,aeh
+			db	d3h,c0h,c3h,e6h,31h,6bh,d8h,6ah
+			db	75h,b3h,4fh,00h,aah,e2h,aeh,60h
+			db	5bh,51h,6eh,00h,18h,6fh,8dh,7ah
+			db	8dh,ach,52h,a1h,97h,b1h,aah,04h
+			db	40h,2fh,2ch,c0h,20h,e5h,79h,7eh
+			db	08h,ceh,30h,79h,9ch,4ah,afh,39h
+			db	c7h,d6h,d0h,fdh,d6h,a6h,ech,05h
+			db	e1h,7bh,8dh,39h,5ch,ddh,c3h,abh
+			db	b6h,2ch,9ch,5eh,18h,00h,40h,7ch
+			db	a0h,81h,dfh,2eh,c9h,c1h,d1h,79h
+			db	7eh,8bh,49h,b1h,bch,dah,adh,0ah
+			db	69h,87h,9ch,e9h,4fh,30h,53h,0ch
+			db	7dh,1ah,85h,20h,8eh,e2h,92h,1ah
+			db	33h,93h,73h,90h,6ch,d5h,4dh,25h
+			db	b2h,45h,96h,23h,d7h,c7h,40h,77h
+			db	5ah,11h,15h,d6h,e5h,0dh,d1h,8ah
+			db	a3h,06h,89h,28h,f1h,9dh,97h,dah
+			db	a3h,71h,63h,6bh,f2h,55h,74h,87h
+			db	1ah,6bh,bdh,03h,28h,49h,c9h,8fh
+			db	a3h,93h,4eh,d6h,18h,2eh,a8h,53h
+			db	37h,b5h,03h,18h,32h,4ch,4dh,eeh
+			db	6dh,04h,41h,16h,87h,74h,deh,56h
+			db	a7h,5fh,1fh,92h,91h,1eh,fch,8fh
+			db	65h,80h,56h,9bh,9fh,d7h,5dh,17h
+			db	47h,d5h,2bh,edh,bch,a2h,40h,07h
+			db	b5h,a0h,5ah,e2h,d4h,38h,4ah,d2h
+			db	4dh,0ah,1ch,0eh,c0h,f7h,cch,01h
+			db	f0h,2eh,40h,efh,84h,e5h,50h,a9h
+			db	a6h,6dh,6ch,6dh,a8h,44h,6ah,39h
+			db	52h,32h,31h,eeh,99h,47h,c5h,bbh
+			db	f5h,fdh,53h,a6h,42h,2ah,01h,c1h
+			db	f1h,feh,dfh,7bh,83h,08h,77h,a6h
+			db	1dh,93h,8eh,67h,07h,56h,09h,f3h
+			db	70h,77h,a3h,fah,94h,c9h,95h,ebh
+			db	d2h,55h,24h,78h,81h,5dh,eeh,a0h
+			db	c5h,0ch,deh,53h,e2h,54h,68h,cfh
+			db	5eh,6eh,38h,b7h,51h,75h,23h,37h
+			db	05h,7dh,5fh,9ah,20h,03h,93h,a9h
+			db	ech,67h,51h,d4h,40h,8ch,06h,f5h
+			db	92h,dch,13h,bdh,6eh,2dh,72h,1eh
+			db	40h,00h,1ah,9bh,a8h,9ah,85h,c1h
+			db	b4h,70h,30h,4bh,56h,8ah,29h,e5h
+			db	83h,fbh,e8h,feh,d3h,23h,c7h,02h
+			db	7eh,1eh,16h,afh,0eh,14h,20h,14h
+			db	b8h,22h,e3h,7dh,9eh,0ah,e2h,4ah
+			db	51h,a9h,13h,4bh,22h,79h,a2h,abh
+			db	dch,71h,fch,3eh,78h,9ah,93h,1ch
+			db	a9h,c4h,46h,2ah,0dh,ebh,96h,69h
+			db	6eh,2dh,cbh,a0h,ech,33h,67h,beh
+			db	3dh,16h,8dh,f0h,10h,b4h,65h,d1h
+			db	59h,c8h,19h,afh,32h,abh,14h,27h
+			db	e7h,73h,65h,85h,e1h,26h,ebh,45h
+			db	67h,04h,27h,21h,fch,b4h,31h,67h
+			db	5fh,6dh,67h,68h,76h,eeh,ffh,dfh
+			db	b1h,f5h,76h,a7h,40h,bfh,00h,7fh
+			db	e9h,91h,72h,f5h,bah,e6h,21h,8ah
+			db	feh,92h,cdh,5eh,59h,0ah,1ch,4fh
+			db	31h,e1h,2ah,3fh,afh,87h,08h,65h
+			db	93h,79h,27h,25h,29h,8dh,0dh,4bh
+			db	d8h,2ah,65h,35h,f6h,29h,e5h,f0h
+			db	6ch,88h,a6h,22h,12h,dfh,e0h,dfh
+			db	29h,33h,45h,85h,75h,4ah,c6h,f4h
+			db	59h,dfh,dfh,adh,dch,e5h,85h,1dh
+			db	b6h,b2h,6dh,f8h,f2h,82h,fah,99h
+			db	8dh,3ch,40h,a2h,e4h,7fh,8eh,34h
+			db	2eh,85h,94h,39h,c1h,b1h,8eh,f0h
+			db	2ch,8dh,74h,84h,48h,0dh,4ah,55h
+			db	8fh,f1h,83h,afh,bbh,7dh,5fh,fah
+			db	71h,75h,8bh,c6h,0dh,1bh,92h,4bh
+			db	6fh,efh,ach,05h,0bh,59h,75h,7eh
+			db	6dh,69h,61h,b6h,45h,88h,ach,b8h
+			db	06h,e2h,eeh,d2h,63h,dbh,80h,e6h
+			db	40h,03h,2ah,29h,71h,a1h,ddh,59h
+			db	3bh,a3h,65h,a5h,0eh,47h,c4h,59h
+			db	64h,d9h,74h,31h,3eh,92h,e2h,91h
+			db	d1h,42h,68h,09h,27h,eeh,9dh,fbh
+			db	98h,87h,b2h,10h,42h,8ah,63h,12h
+			db	6bh,98h,67h,e2h,87h,52h,3dh,72h
+			db	11h,c9h,3ch,29h,63h,21h,20h,2ah
+			db	a4h,cfh,0ah,2fh,21h,5ah,4ch,e3h
+			db	49h,31h,5eh,9ah,62h,7eh,7ch,75h
+			db	a9h,b1h,5bh,1ah,46h,88h,bbh,38h
+			db	62h,76h,adh,eah,deh,b9h,0fh,d5h
+			db	07h,cdh,afh,09h,24h,b3h,f1h,38h
+			db	78h,cfh,fbh,10h,d0h,21h,58h,f5h
+			db	24h,e6h,cfh,fdh,e0h,7eh,1eh,91h
+			db	e0h,c5h,f1h,24h,d2h,80h,65h,28h
+			db	7fh,afh,0ah,02h,a0h,f2h,60h,27h
+			db	feh,79h,40h,1eh,91h,63h,6ch,8ch
+			db	46h,8bh,05h,cah,1eh,bdh,e9h,c8h
+			db	70h,b2h,71h,0bh,97h,8bh,4ah,cah
+			db	feh,37h,4fh,c3h,39h,f1h,d8h,2dh
+			db	18h,52h,07h,38h,67h,2fh,a1h,76h
+			db	ffh,50h,23h,f0h,3eh,45h,73h,5fh
+			db	58h,f6h,33h,36h,3ch,37h,6eh,60h
+			db	b9h,78h,86h,e2h,1ah,77h,14h,0ah
+			db	5eh,2ch,1eh,b3h,eeh,29h,97h,b8h
+			db	dfh,4ch,b0h,e9h,5ah,49h,c3h,89h
+			db	b5h,46h,e5h,1fh,c8h,dbh,04h,cah
+			db	ddh,f6h,f4h,cdh,73h,ach,fch,00h
+			db	c0h,99h,6eh,eeh,38h,f0h,6ah,f4h
+			db	d1h,00h,d6h,e6h,2eh,89h,e6h,97h
+			db	b0h,cbh,28h,b8h,81h,adh,f0h,70h
+			db	24h,b6h,a8h,5ah,cfh,2dh,4eh,29h
+			db	c8h,47h,6eh,46h,fch,68h,61h,4eh
+			db	bfh,b7h,38h,61h,a6h,f4h,3ah,36h
+			db	e3h,a7h,bch,f6h,a3h,bbh,cbh,42h
+			db	f8h,47h,50h,50h,a0h,fdh,b9h,88h
+			db	a1h,2ah,46h,69h,31h,48h,25h,6eh
+			db	47h,67h,82h,beh,09h,22h,99h,3bh
+			db	25h,1dh,0dh,02h,f4h,6ch,9bh,0bh
+			db	58h,54h,aeh,79h,86h,31h,03h,e7h
+			db	9ah,ceh,f5h,ech,1bh,b7h,f4h,2bh
+			db	cbh,1bh,b9h,22h,1eh,c4h,b8h,30h
+			db	73h,7ch,dah,0ah,30h,abh,32h,9fh
+			db	38h,a4h,5eh,4dh,45h,b8h,9fh,ddh
+			db	53h,ach,c2h,76h,89h,14h,78h,85h
+			db	e2h,60h,dah,3bh,c8h,b9h,f9h,72h
+			db	9ch,3dh,8fh,f6h,e3h,56h,81h,42h
+			db	01h,44h,71h,e7h,24h,c0h,0fh,d6h
+			db	edh,22h,d7h,4bh,d1h,11h,24h,99h
+			db	63h,d6h,55h,49h,64h,60h,d0h,16h
+			db	25h,d9h,d6h,1ah,aeh,8bh,73h,a7h
+			db	bch,8bh,7ch,b9h,45h,11h,f0h,66h
+			db	46h,82h,deh,e6h,83h,a1h,c1h,f0h
+			db	bch,9bh,3ah,ddh,8ch,16h,6bh,b5h
+			db	c7h,37h,dch,16h,6ah,99h,afh,01h
+			db	06h,4ch,18h,dch,a2h,14h,72h,4ch
+			db	fch,06h,26h,09h,beh,f2h,e0h,2ah
+			db	0ah,1ch,80h,16h,a2h,72h,08h,b8h
+			db	c3h,c0h,47h,b0h,98h,0ch,eeh,72h
+			db	c6h,c3h,72h,2eh,e4h,b6h,91h,8bh
+			db	c5h,98h,fbh,14h,7ah,f7h,e4h,29h
+			db	31h,89h,adh,53h,6fh,97h,46h,ech
+			db	16h,88h,2bh,bdh,a1h,64h,4eh,e5h
+			db	d3h,0ch,eeh,05h,3fh,45h,70h,afh
+			db	51h,43h,2fh,eeh,d4h,b5h,50h,f6h
+			db	8ch,22h,96h,72h,9eh,8fh,54h,e6h
+			db	b2h,84h,48h,4ch,43h,f0h,42h,cah
+			db	a2h,09h,88h,96h,0eh,32h,f8h,03h
+			db	6eh,5ch,cfh,d9h,abh,2fh,29h,35h
+			db	f0h,e5h,9ah,fah,68h,ech,59h,f2h
+			db	83h,fah,a8h,f5h,28h,afh,04h,5bh
+			db	38h,f9h,abh,07h,c8h,9ah,6bh,23h
+			db	95h,9dh,6eh,e3h,ddh,4ah,dbh,cbh
+			db	43h,9fh,a9h,0dh,97h,75h,7ah,04h
+			db	f6h,a2h,fah,a1h,8ch,91h,92h,03h
+			db	50h,41h,d0h,07h,dbh,b9h,87h,dfh
+			db	6dh,1ch,81h,ebh,7fh,0eh,54h,23h
+			db	99h,3ch,f9h,62h,96h,61h,b3h,fbh
+			db	0ah,44h,fdh,c6h,01h,5eh,f6h,95h
+			db	e6h,f0h,7ch,10h,5bh,41h,8eh,27h
+			db	8bh,4eh,4fh,0eh,51h,6dh,9eh,30h
+			db	98h,9eh,2fh,d8h,32h,9ch,4fh,00h
+			db	86h,91h,b3h,5eh,f4h,ebh,1dh,6ah
+			db	97h,a1h,85h,69h,5ah,78h,68h,94h
+			db	99h,1ch,e2h,ech,92h,4ah,afh,85h
+			db	6ch,9dh,c8h,0dh,59h,0bh,e1h,5ch
+			db	73h,87h,83h,a1h,78h,c3h,f3h,12h
+			db	e5h,e4h,4fh,c9h,75h,e1h,68h,6ch
+			db	2bh,68h,13h,c2h,edh,feh,09h,deh
+			db	08h,97h,bch,12h,f0h,23h,4eh,3bh
+			db	55h,71h,edh,4eh,8ch,2ch,5bh,bfh
+			db	d1h,fah,2eh,58h,1bh,c9h,f8h,84h
+			db	73h,aeh,24h,0ch,0fh,96h,9fh,e4h
+			db	c0h,4bh,0eh,a0h,7bh,43h,38h,6dh
+			db	95h,9ah,03h,a0h,28h,ffh,e2h,31h
+			db	13h,8ah,19h,65h,52h,87h,c5h,aah
+			db	86h,47h,d8h,72h,d4h,37h,d3h,2dh
+			db	2bh,4fh,b0h,6ch,abh,fch,06h,19h
+			db	d3h,81h,3bh,1ah,beh,c5h,30h,d4h
+			db	75h,20h,c0h,c2h,34h,28h,bch,b6h
+			db	3ah,0eh,10h,f0h,4ch,b2h,8bh,0fh
+			db	c3h,e4h,98h,d4h,57h,4ch,b3h,2ah
+			db	49h,95h,fbh,efh,d1h,f0h,e2h,70h
+			db	4dh,6fh,78h,93h,4dh,31h,1dh,1bh
+			db	22h,7dh,a8h,afh,7bh,4bh,6eh,88h
+			db	c8h,e1h,e7h,a4h,3eh,51h,51h,a8h
+			db	e2h,95h,e1h,bah,48h,1eh,cbh,e3h
+			db	4bh,22h,4ch,82h,aah,79h,e4h,22h
+			db	ffh,07h,0eh,39h,6bh,3ah,7ah,00h
+			db	76h,0dh,4ah,e4h,0fh,25h,edh,feh
+			db	40h,8bh,cch,ech,c1h,85h,f7h,2eh
+			db	33h,66h,96h,92h,83h,eeh,82h,10h
+			db	f7h,d1h,b1h,dfh,6fh,55h,6ah,09h
+			db	a3h,dch,64h,8bh,f0h,94h,80h,9eh
+			db	36h,beh,40h,e8h,3dh,65h,75h,2eh
+			db	ach,61h,57h,20h,67h,eeh,f8h,85h
+			db	00h,8fh,8eh,44h,19h,cch,73h,97h
+			db	13h,a7h,3ah,f5h,24h,90h,3bh,87h
+			db	73h,ddh,beh,32h,50h,f4h,87h,8dh
+			db	03h,0ch,4ch,5ah,85h,a6h,e8h,d0h
+			db	23h,e6h,66h,22h,1ch,2eh,81h,5eh
+			db	f2h,37h,abh,b2h,c3h,eah,c1h,6fh
+			db	4eh,c2h,a4h,e1h,bfh,78h,ach,66h
+			db	3bh,23h,9ch,2eh,66h,87h,9ch,96h
+			db	6eh,4bh,a1h,72h,58h,dbh,26h,05h
+			db	9eh,2fh,61h,1dh,f8h,b7h,ceh,aah
+			db	1dh,24h,ffh,6ch,36h,d5h,abh,cbh
+			db	a4h,b0h,8ch,a5h,b0h,44h,4dh,bch
+			db	bbh,46h,a6h,dfh,cch,8eh,d6h,ach
+			db	8ch,2ah,c3h,40h,70h,92h,25h,95h
+			db	31h,3bh,87h,f6h,cch,52h,cfh,f5h
+			db	42h,54h,17h,88h,e6h,9ah,93h,dch
+			db	a7h,4ch,26h,d2h,7ch,52h,f6h,04h
+			db	3bh,57h,b9h,9ch,ebh,32h,f7h,39h
+			db	58h,7bh,8ah,62h,feh,06h,38h,64h
+			db	31h,38h,7eh,7eh,97h,81h,61h,0fh
+			db	58h,6bh,e6h,16h,deh,69h,1dh,2bh
+			db	e3h,cbh,33h,19h,33h,80h,d8h,7dh
+			db	9fh,97h,aah,11h,17h,4bh,54h,e5h
+			db	7eh,4eh,86h,b7h,dfh,fbh,c4h,59h
+			db	7fh,22h,45h,7dh,5eh,c7h,4bh,55h
+			db	e1h,0ch,77h,48h,3bh,2eh,41h,7eh
+			db	dch,40h,d8h,76h,efh,37h,e0h,bfh
+			db	1bh,4bh,bbh,00h,d8h,78h,eeh,57h
+			db	dah,4ch,59h,3ah,c3h,a7h,7bh,92h
+			db	8dh,32h,4dh,7ch,58h,2ch,d3h,9ah
+			db	76h,ffh,16h,b1h,abh,c1h,6bh,a9h
+			db	cfh,41h,81h,50h,28h,31h,f9h,4eh
+			db	91h,92h,adh,4fh,42h,02h,68h,69h
+			db	2ch,24h,3fh,ceh,c0h,b6h,afh,a1h
+			db	a0h,3dh,e8h,04h,ffh,e7h,5fh,8ah
+			db	f1h,f9h,f6h,f8h,4bh,45h,48h,bdh
+			db	aeh,e4h,d6h,55h,4ah,71h,4ch,aah
+			db	85h,4eh,47h,63h,f1h,89h,8dh,e4h
+			db	98h,8ch,9ch,c7h,2dh,6ch,72h,37h
+			db	46h,5eh,6dh,ceh,95h,4ch,e0h,e9h
+			db	43h,17h,84h,59h,72h,bch,9bh,c0h
+			db	e8h,75h,9ah,9ah,7bh,75h,c7h,b8h
+			db	27h,40h,80h,1ch,51h,d5h,93h,4ch
+			db	f7h,a8h,a4h,dfh,42h,eeh,22h,90h
+			db	71h,eeh,13h,76h,48h,c3h,9dh,04h
+			db	93h,a7h,61h,19h,4dh,c6h,ach,6fh
+			db	71h,99h,bfh,ebh,51h,fch,71h,d9h
+			db	c1h,42h,e2h,e3h,52h,01h,4ch,eah
+			db	04h,6eh,51h,7ch,5eh,d3h,96h,ceh
+			db	fdh,3dh,ebh,8bh,3eh,edh,3dh,02h
+			db	31h,aeh,35h,37h,4fh,7dh,66h,7eh
+			db	7ah,06h,3dh,d8h,7dh,e3h,90h,a7h
+			db	1dh,59h,fah,81h,98h,45h,fch,06h
+			db	13h,37h,6ch,c9h,fah,7dh,66h,19h
+			db	3dh,aah,feh,25h,7bh,f7h,a5h,e3h
+			db	a5h,4bh,3dh,e7h,60h,84h,90h,bch
+			db	05h,efh,aeh,8ch,02h,15h,bdh,dch
+			db	a6h,fah,9dh,d7h,e0h,ebh,ach,efh
+			db	7fh,adh,1dh,98h,50h,44h,79h,3ch
+			db	61h,4ch,0ch,afh,a0h,7bh,35h,9ch
+			db	60h,9eh,7dh,b4h,edh,abh,f8h,97h
+			db	e7h,6ch,f8h,9fh,46h,99h,0dh,5dh
+			db	b1h,bbh,eeh,80h,d5h,d5h,c9h,7ah
+			db	04h,8dh,d9h,36h,84h,6ah,9fh,c4h
+			db	3fh,23h,31h,cfh,cbh,85h,e5h,b8h
+			db	0ah,cdh,dah,32h,21h,feh,22h,9ah
+			db	4eh,80h,4fh,73h,c5h,55h,fah,3bh
+			db	1ah,b7h,e4h,4ch,90h,33h,f5h,35h
+			db	dfh,11h,18h,4ah,ebh,f8h,8bh,98h
+			db	a3h,6ah,f1h,a2h,8eh,5dh,d9h,c2h
+			db	abh,e1h,1ch,04h,14h,afh,55h,06h
+			db	d8h,d6h,ech,40h,90h,0eh,80h,f4h
+			db	21h,a9h,c6h,82h,92h,b9h,10h,1fh
+			db	79h,6ah,16h,94h,35h,d1h,62h,fah
+			db	14h,53h,e4h,edh,c4h,49h,02h,9eh
+			db	3bh,e0h,a7h,4ah,cch,09h,bch,aah
+			db	97h,c5h,54h,62h,8ah,56h,23h,24h
+			db	cfh,d9h,26h,58h,b8h,7ch,50h,84h
+			db	34h,14h,47h,86h,d6h,a4h,1dh,66h
+			db	f2h,89h,4bh,ach,70h,e5h,9bh,e2h
+			db	0eh,01h,a2h,0ch,a4h,f5h,18h,4eh
+			db	a2h,cah,2bh,ddh,75h,e2h,06h,ceh
+			db	cah,3bh,04h,75h,9eh,6ah,17h,d6h
+			db	65h,82h,b9h,3eh,16h,a4h,07h,8ch
+			db	76h,9ah,a8h,d9h,d4h,b0h,cah,d9h
+			db	41h,b3h,3fh,fch,39h,c6h,eeh,4eh
+			db	cah,aah,11h,92h,93h,9fh,1ch,fbh
+			db	93h,6eh,70h,29h,efh,dah,4ch,d2h
+			db	b4h,c4h,37h,d3h,24h,feh,09h,55h
+			db	41h,39h,5bh,44h,2ah,66h,29h,70h
+			db	d7h,24h,53h,c1h,49h,b0h,39h,1ah
+			db	1dh,94h,efh,bfh,42h,6bh,22h,23h
+			db	9bh,1bh,e7h,12h,cdh,2ch,b2h,deh
+			db	9eh,60h,afh,2eh,1fh,beh,8dh,a8h
+			db	cah,2fh,09h,a0h,eeh,b0h,d1h,e5h
+			db	94h,b8h,edh,43h,70h,01h,c9h,aeh
+			db	86h,dbh,85h,99h,a0h,11h,b5h,b2h
+			db	e2h,bdh,e0h,07h,d9h,b1h,2bh,67h
+			db	27h,cch,03h,11h,5fh,20h,8dh,beh
+			db	dfh,dbh,85h,d4h,42h,15h,73h,72h
+			db	41h,d9h,72h,8eh,c7h,e7h,f3h,8eh
+			db	69h,24h,f0h,15h,d7h,8fh,70h,edh
+			db	d8h,f0h,6dh,6ch,7fh,4dh,7eh,0ah
+			db	4eh,65h,94h,00h,95h,d9h,67h,f3h
+			db	30h,afh,13h,c2h,60h,35h,65h,dfh
+			db	7bh,09h,3ah,d4h,97h,aah,a2h,7fh
+			db	fah,fdh,42h,f2h,b5h,bah,6eh,84h
+			db	b4h,8fh,f4h,48h,ach,82h,c6h,bfh
+			db	dah,f4h,a8h,a5h,2ch,4fh,83h,fdh
+			db	36h,4fh,1ch,d3h,f1h,b3h,11h,57h
+			db	b9h,49h,d5h,deh,aah,cdh,f9h,b9h
+			db	bfh,74h,b9h,adh,d0h,fch,9dh,fbh
+			db	b8h,8ch,cbh,48h,2dh,f6h,d7h,92h
+			db	1dh,9bh,79h,d3h,24h,f2h,efh,a3h
+			db	b4h,8ch,43h,07h,76h,eeh,8dh,7bh
+			db	1bh,61h,6fh,eeh,a9h,c8h,10h,8ch
+			db	b5h,feh,85h,04h,9bh,dah,52h,1bh
+			db	e4h,0dh,0fh,10h,92h,10h,08h,4dh
+			db	13h,4bh,13h,00h,5ch,93h,53h,1ch
+			db	49h,59h,77h,b7h,5dh,eah,dbh,bah
+			db	f5h,75h,bfh,d7h,3eh,e3h,07h,cdh
+			db	3ah,24h,fbh,e4h,8dh,3ah,d4h,0ch
+			db	b1h,3ah,94h,c4h,d0h,3bh,afh,83h
+			db	16h,59h,36h,72h,23h,58h,e2h,68h
+			db	f0h,84h,3eh,9ah,46h,04h,15h,00h
+			db	34h,ceh,b7h,cah,ebh,b5h,63h,3eh
+			db	4ah,edh,6eh,57h,9dh,f7h,31h,a5h
+			db	d0h,74h,d1h,97h,f0h,60h,5ch,b1h
+			db	ffh,b1h,d0h,20h,3fh,99h,18h,8fh
+			db	3ah,b5h,52h,e6h,c2h,ebh,f9h,fdh
+			db	26h,d7h,f6h,e7h,50h,66h,85h,9eh
+			db	57h,b6h,a3h,92h,a6h,76h,a7h,e7h
+			db	2fh,1fh,e2h,35h,9fh,b7h,5bh,97h
+			db	01h,25h,90h,22h,74h,c3h,6fh,95h
+			db	88h,dah,57h,11h,e9h,05h,a6h,54h
+			db	50h,d0h,c6h,07h,c0h,29h,91h,ceh
+			db	10h,e3h,2eh,fch,b2h,87h,1ah,5bh
+			db	49h,4eh,d3h,9bh,0ch,61h,72h,75h
+			db	45h,aeh,70h,d6h,34h,6ch,fah,fbh
+			db	ffh,11h,52h,5ah,d9h,ffh,76h,d8h
+			db	ebh,83h,94h,5dh,8ah,83h,d1h,e8h
+			db	91h,2ah,46h,0fh,96h,14h,24h,50h
+			db	e8h,c3h,84h,28h,91h,2ah,87h,8bh
+			db	d0h,2ah,ech,d6h,56h,51h,08h,f6h
+			db	aeh,2dh,25h,beh,b0h,d5h,d1h,07h
+			db	2ah,83h,9dh,a1h,27h,87h,a2h,c9h
+			db	7ch,7fh,09h,e6h,19h,d7h,36h,5ch
+			db	34h,bfh,44h,55h,b7h,d7h,8bh,27h
+			db	0eh,4dh,35h,6eh,d9h,8ch,0bh,38h
+			db	04h,c7h,70h,dbh,05h,08h,4ah,bch
+			db	dch,fbh,88h,31h,34h,f7h,6fh,33h
+			db	7dh,e7h,67h,00h,ceh,01h,06h,fah
+			db	3dh,c4h,72h,bfh,a3h,26h,d8h,03h
+			db	75h,8bh,4ah,40h,e8h,89h,9dh,5ah
+			db	00h,fch,fah,60h,21h,d8h,eah,9fh
+			db	d8h,78h,86h,adh,f7h,4ch,49h,c3h
+			db	8ah,bch,f9h,43h,0eh,8fh,57h,9fh
+			db	20h,2eh,78h,abh,b3h,c8h,7eh,05h
+			db	f4h,a0h,58h,43h,4dh,95h,b7h,03h
+			db	90h,f6h,2ch,66h,97h,b9h,ech,47h
+			db	36h,81h,47h,cfh,dch,62h,75h,fdh
+			db	ech,83h,f6h,72h,bfh,32h,4fh,cch
+			db	35h,79h,0bh,3dh,afh,57h,8dh,7bh
+			db	d6h,a0h,f0h,efh,deh,77h,ceh,82h
+			db	9eh,f6h,b4h,49h,67h,cch,13h,01h
+			db	beh,97h,57h,c3h,00h,92h,e8h,5ah
+			db	15h,3bh,88h,beh,29h,afh,9ah,abh
+			db	cch,f7h,61h,71h,81h,2ah,58h,22h
+			db	f6h,6dh,bdh,65h,0ch,f0h,cfh,26h
+			db	40h,57h,e0h,e1h,73h,3dh,e0h,53h
+			db	38h,6bh,f2h,8ch,f0h,4bh,07h,5bh
+			db	99h,1dh,aeh,b9h,d4h,dbh,93h,79h
+			db	2eh,c8h,d7h,99h,44h,43h,9ch,dbh
+			db	52h,efh,4ah,65h,b1h,62h,feh,4dh
+			db	cfh,d0h,74h,dah,e7h,32h,18h,5dh
+			db	6ah,b6h,0dh,62h,88h,14h,fah,d5h
+			db	47h,bbh,3eh,65h,bbh,32h,eah,22h
+			db	c1h,32h,69h,b3h,39h,79h,5fh,b5h
+			db	4eh,c3h,b8h,4dh,f0h,9eh,f6h,ech
+			db	6ah,e7h,c8h,63h,b6h,cch,0bh,4dh
+			db	c3h,e9h,d8h,b9h,23h,10h,91h,59h
+			db	98h,e0h,25h,03h,26h,4eh,80h,70h
+			db	95h,ffh,35h,52h,bah,53h,22h,69h
+			db	34h,07h,46h,27h,9ch,bch,54h,08h
+			db	13h,76h,6fh,51h,57h,6eh,64h,ebh
+			db	c8h,6ch,4ah,6bh,11h,12h,b7h,82h
+			db	b4h,59h,1dh,92h,c9h,61h,b1h,e6h
+			db	f9h,b1h,16h,abh,99h,27h,d5h,a1h
+			db	a0h,c3h,a8h,60h,bah,20h,1ch,bah
+			db	1ah,d1h,8bh,24h,85h,ebh,bbh,05h
+			db	e9h,40h,6ch,a5h,75h,42h,40h,f2h
+			db	b0h,61h,3bh,b0h,3fh,dch,6bh,09h
+			db	56h,f9h,d5h,65h,44h,6ch,33h,66h
+			db	85h,26h,a3h,bah,8eh,45h,98h,c0h
+			db	a1h,35h,31h,72h,b9h,d4h,2eh,72h
+			db	13h,c0h,d0h,7ch,04h,5fh,29h,2ch
+			db	c4h,5dh,56h,c1h,deh,c2h,47h,afh
+			db	dch,deh,aeh,1ah,bfh,deh,97h,2eh
+			db	bdh,63h,efh,5ah,eah,2ah,90h,70h
+			db	47h,f7h,c3h,1fh,ddh,f3h,cah,37h
+			db	79h,e1h,5ah,e9h,16h,63h,5eh,b2h
+			db	39h,89h,d9h,87h,8eh,52h,08h,ddh
+			db	e1h,c8h,7bh,75h,8ah,d9h,d5h,c5h
+			db	8fh,36h,5ah,abh,97h,bbh,24h,bbh
+			db	39h,06h,b5h,dbh,23h,6eh,23h,c6h
+			db	91h,7bh,7bh,30h,efh,38h,feh,ddh
+			db	28h,b7h,c8h,70h,0dh,4ch,0ch,ffh
+			db	3fh,f9h,8fh,59h,3ah,ffh,c3h,f5h
+			db	abh,bbh,77h,9dh,cfh,89h,c0h,ach
+			db	d5h,e6h,d5h,85h,7fh,d2h,28h,1eh
+			db	fbh,fch,7ah,62h,e1h,29h,13h,18h
+			db	93h,e4h,d1h,3fh,b9h,fbh,ebh,3eh
+			db	3fh,49h,3eh,f5h,27h,96h,09h,79h
+			db	27h,46h,56h,1dh,32h,01h,cch,6eh
+			db	14h,22h,c1h,66h,85h,1ah,b4h,88h
+			db	3eh,64h,4bh,ddh,95h,e6h,29h,f8h
+			db	97h,cch,4ch,f5h,f7h,3ch,7ch,59h
+			db	51h,6dh,bch,33h,94h,e6h,9ah,ach
+			db	95h,b7h,92h,21h,68h,5eh,50h,38h
+			db	2bh,aah,c4h,beh,d8h,4ch,b5h,cbh
+			db	42h,2ah,b2h,15h,5dh,e1h,c0h,52h
+			db	5ch,69h,03h,51h,c0h,c9h,a6h,1eh
+			db	ffh,a0h,f1h,c8h,14h,6fh,a4h,b0h
+			db	beh,26h,2fh,a0h,bbh,5fh,c3h,10h
+			db	41h,15h,52h,59h,20h,e9h,62h,55h
+			db	74h,98h,98h,bdh,04h,deh,a7h,a6h
+			db	57h,b6h,89h,b5h,c8h,05h,73h,64h
+			db	abh,cbh,d7h,3dh,6ch,6fh,a8h,5bh
+			db	dfh,14h,59h,fch,41h,25h,6dh,7fh
+			db	9ah,2eh,fdh,89h,ech,3ah,f7h,2ah
+			db	cah,97h,f4h,54h,5dh,0bh,10h,76h
+			db	fch,53h,ebh,b3h,8bh,d8h,2dh,51h
+			db	e2h,e6h,8fh,d2h,f1h,9dh,ech,d3h
+			db	7dh,9ah,48h,69h,d5h,b4h,2ch,12h
+			db	68h,93h,13h,d1h,cch,48h,3ah,e9h
+			db	3eh,33h,e3h,aeh,27h,4fh,63h,f0h
+			db	81h,afh,bdh,0fh,8ah,89h,5ah,cfh
+			db	9dh,b4h,19h,14h,33h,04h,d7h,30h
+			db	66h,4fh,67h,e0h,84h,66h,7fh,50h
+			db	d2h,11h,38h,ebh,21h,f3h,cch,02h
+			db	eah,0ah,a8h,c8h,9ch,69h,3ch,97h
+			db	69h,43h,d4h,98h,3dh,a9h,6bh,f4h
+			db	a4h,68h,96h,a1h,bch,a7h,97h,67h
+			db	66h,56h,7fh,64h,7eh,ffh,abh,37h
+			db	66h,01h,a8h,63h,7ah,75h,3eh,9ah
+			db	ffh,fdh,aah,c0h,c1h,1ch,69h,4ah
+			db	79h,85h,90h,7ah,e0h,2fh,1eh,55h
+			db	e3h,3ah,b1h,55h,80h,0ah,b9h,0bh
+			db	76h,30h,15h,51h,88h,aah,24h,5eh
+			db	6fh,f6h,00h,7fh,b3h,cfh,0fh,a8h
+			db	87h,8bh,7ch,50h,eeh,19h,8dh,d3h
+			db	f6h,68h,02h,4fh,53h,0dh,79h,c8h
+			db	f3h,e6h,3dh,d5h,10h,b3h,62h,5dh
+			db	cdh,11h,7dh,64h,c7h,b3h,46h,71h
+			db	7fh,6fh,7ah,9fh,eeh,9bh,abh,efh
+			db	33h,99h,cah,7eh,8eh,87h,94h,30h
+			db	95h,46h,b9h,54h,c5h,9fh,38h,4ch
+			db	1fh,88h,70h,47h,bfh,8bh,89h,edh
+			db	19h,f1h,16h,6ch,bch,3eh,fah,97h
+			db	82h,c3h,3ah,54h,e4h,2ah,5ch,cbh
+			db	1ch,8bh,54h,77h,90h,f1h,a6h,13h
+			db	e1h,14h,dbh,d1h,ebh,dfh,0ah,3eh
+			db	01h,e9h,d1h,e8h,53h,0ch,deh,cdh
+			db	e8h,bdh,a7h,9bh,9eh,15h,92h,72h
+			db	edh,9dh,05h,2bh,44h,d7h,18h,cbh
+			db	58h,3ah,6fh,e8h,85h,92h,e2h,06h
+			db	91h,7eh,5fh,07h,e9h,86h,81h,13h
+			db	8eh,9ah,ddh,59h,79h,09h,a4h,6ch
+			db	86h,33h,79h,11h,10h,69h,88h,60h
+			db	4ch,28h,2ch,b0h,deh,6ch,0fh,c5h
+			db	2bh,fch,21h,d8h,4fh,91h,9ch,afh
+			db	bdh,6eh,f7h,08h,00h,50h,e4h,13h
+			db	7bh,0eh,5fh,c2h,3eh,81h,28h,51h
+			db	afh,c2h,94h,4ch,06h,65h,cbh,55h
+			db	9ch,72h,97h,43h,f2h,21h,87h,92h
+			db	cah,80h,83h,1eh,0ch,f6h,e5h,89h
+			db	f7h,39h,82h,5ah,9dh,14h,2fh,c3h
+			db	8dh,99h,8ch,5dh,c0h,5eh,a4h,3fh
+			db	27h,d9h,75h,39h,efh,5eh,2bh,b7h
+			db	27h,7ch,f2h,bch,3fh,2dh,55h,24h
+			db	31h,f5h,c9h,dah,bfh,89h,e6h,27h
+			db	05h,abh,98h,aah,f7h,dch,cch,20h
+			db	51h,e5h,3ch,5dh,3fh,52h,fdh,c9h
+			db	52h,f3h,5dh,e2h,e8h,8eh,82h,20h
+			db	20h,52h,76h,04h,03h,65h,01h,0eh
+			db	03h,95h,0bh,52h,5bh,e8h,93h,19h
+			db	8dh,66h,f2h,4bh,cch,3ch,89h,6eh
+			db	05h,9ah,b2h,68h,e1h,9bh,32h,aeh
+			db	cfh,d0h,efh,9bh,72h,62h,fbh,7ah
+			db	3fh,f4h,d1h,a8h,55h,61h,64h,adh
+			db	e6h,53h,7dh,2eh,1fh,eeh,5bh,7ch
+			db	72h,59h,58h,3dh,bah,78h,95h,15h
+			db	e7h,eeh,3bh,c8h,4ch,b7h,fah,bbh
+			db	87h,30h,f6h,55h,d9h,cfh,63h,61h
+			db	63h,5eh,83h,42h,1dh,cah,70h,0ch
+			db	60h,ddh,c9h,63h,6ah,c2h,d8h,97h
+			db	e0h,67h,06h,5fh,29h,56h,1dh,a0h
+			db	91h,56h,87h,87h,e1h,2eh,01h,30h
+			db	b9h,05h,62h,33h,35h,22h,48h,17h
+			db	f5h,17h,b3h,5ah,d1h,5bh,38h,6fh
+			db	65h,5ah,91h,5eh,c0h,dfh,96h,94h
+			db	d7h,6bh,61h,10h,3eh,5bh,6ch,9ch
+			db	1bh,f5h,a7h,8ah,ceh,2dh,c9h,b8h
+			db	3ch,33h,f4h,c5h,7fh,23h,55h,a1h
+			db	77h,15h,ebh,feh,84h,99h,91h,96h
+			db	c1h,9ah,9dh,18h,8eh,4dh,76h,54h
+			db	2ah,93h,0bh,bfh,5bh,26h,15h,3ch
+			db	51h,10h,fdh,42h,cfh,41h,2ch,d4h
+			db	70h,ceh,dah,07h,f4h,e5h,bdh,cbh
+			db	2ch,09h,1fh,7ah,21h,c1h,7bh,eeh
+			db	0eh,b8h,69h,4fh,29h,a0h,6eh,b6h
+			db	01h,94h,d4h,24h,73h,4bh,c6h,21h
+			db	d1h,0ah,56h,0dh,60h,67h,57h,41h
+			db	40h,f0h,c8h,adh,dbh,b0h,f3h,4dh
+			db	41h,23h,04h,0ch,fbh,63h,2bh,e3h
+			db	c2h,04h,78h,b2h,a4h,72h,ffh,27h
+			db	9ah,edh,19h,1dh,a9h,6fh,67h,46h
+			db	87h,93h,57h,0eh,34h,c4h,0eh,89h
+			db	4ah,83h,34h,b4h,0fh,51h,ach,a3h
+			db	4ah,edh,65h,d3h,f6h,80h,35h,9ah
+			db	93h,c4h,fdh,3ch,90h,1ah,f1h,bch
+			db	5fh,f1h,1ah,56h,cbh,4ah,5ah,29h
+			db	25h,26h,51h,e8h,2ch,99h,aeh,7bh
+			db	1dh,09h,c6h,14h,f6h,b2h,80h,d7h
+			db	cch,b1h,78h,87h,21h,21h,eah,fch
+			db	16h,86h,95h,ddh,cdh,e7h,e1h,9ah
+			db	f8h,9ah,04h,0dh,f7h,3dh,e5h,59h
+			db	2eh,5ch,8fh,4ah,6fh,80h,0ch,7bh
+			db	a6h,07h,07h,07h,e4h,e6h,6fh,eeh
+			db	66h,c4h,38h,eeh,9eh,09h,97h,aah
+			db	4dh,c3h,32h,8bh,dbh,17h,6fh,a8h
+			db	51h,a3h,dbh,0ah,71h,f7h,5ah,f2h
+			db	97h,19h,6fh,5ah,fbh,5ch,d1h,cfh
+			db	73h,79h,a0h,9dh,65h,6ch,92h,bdh
+			db	28h,fbh,37h,1dh,88h,b2h,93h,1eh
+			db	51h,94h,75h,c6h,66h,0dh,56h,46h
+			db	cch,cch,f9h,13h,0ah,45h,cah,b4h
+			db	6fh,f6h,e9h,24h,93h,c0h,c7h,32h
+			db	86h,24h,a2h,a3h,59h,8dh,bfh,51h
+			db	22h,03h,a3h,2ch,a4h,e2h,17h,cdh
+			db	ffh,44h,75h,49h,72h,8ah,2eh,b8h
+			db	d8h,d9h,44h,3fh,75h,0ah,10h,a3h
+			db	68h,f8h,4ah,a1h,37h,a0h,03h,d8h
+			db	11h,2fh,2fh,2ch,78h,52h,ddh,18h
+			db	e1h,4dh,12h,16h,a3h,c6h,9bh,f2h
+			db	8fh,cah,96h,74h,cdh,ach,bfh,aeh
+			db	a2h,9bh,77h,8ch,bbh,ech,41h,e3h
+			db	1bh,49h,f8h,68h,87h,f3h,1bh,97h
+			db	98h,f9h,8ah,83h,66h,bch,0ah,ach
+			db	35h,36h,b5h,2ch,77h,31h,edh,02h
+			db	deh,19h,56h,66h,13h,e5h,edh,9fh
+			db	95h,3ch,77h,04h,eeh,0fh,46h,05h
+			db	76h,b9h,10h,11h,f0h,7fh,c7h,3ch
+			db	86h,ffh,01h,14h,3dh,b4h,c7h,fch
+			db	08h,1ch,ceh,53h,46h,43h,69h,90h
+			db	e9h,79h,1ch,c4h,29h,3dh,a3h,e7h
+			db	73h,adh,2ch,beh,04h,fah,97h,59h
+			db	2eh,29h
@@ -0,0 +1,4111 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	8eh,b4h,62h,66h,08h,84h,14h,c1h
+			db	76h,35h,8bh,24h
+
+start:						; execution starting point
+			add	hl,hl
+			ld	a,h
+			halt
+			xor	(hl)
+			rst	00h
+			ex	de,hl
+			jp	L33de
+			db	3ah,3ch,bfh,6ch,5ch,57h,45h,b0h
+			db	71h,17h,3ch,b0h,a7h,6fh,91h,f6h
+			db	8bh,b8h,70h,08h,96h,21h,a7h,87h
+			db	8ch,58h,51h,3eh,13h,deh,6bh,98h
+			db	4eh,1dh,50h,a5h,8ch,39h,f4h,a9h
+			db	4dh,c8h,c0h,53h,1dh,6bh,ffh,5eh
+			db	b5h,e8h,3bh,83h,f8h,fdh,5fh,e4h
+			db	bfh,5ah,40h,56h,91h,25h,abh,f8h
+			db	14h,83h,83h,71h,d3h,40h,ffh,e7h
+			db	31h,16h,18h,cbh,8bh,75h,2fh,3ah
+			db	28h,ebh,73h,24h,6ch,f1h,86h,26h
+			db	f6h,99h,f4h,95h,a1h,76h,c5h,cch
+			db	ach,22h,88h,54h,ach,89h,64h,c4h
+			db	2ch,03h,70h,d4h,56h,92h,07h,aah
+			db	65h,b8h,c8h,3eh,1eh,28h,22h,5ah
+			db	41h,a3h,57h,88h,3bh,66h,64h,26h
+			db	21h,8bh,c5h,17h,08h,4eh,95h,ebh
+			db	b1h,e8h,e8h,a3h,0ch,0fh,b4h,63h
+			db	3dh,a8h,00h,96h,79h,f0h,e9h,beh
+			db	07h,85h,7dh,fah,24h,f1h,f3h,8bh
+			db	bfh,8dh,14h,1eh,91h,12h,81h,c6h
+			db	b0h,40h,c9h,9fh,d3h,bbh,25h,beh
+			db	a0h,29h,6eh,f6h,c5h,fch,33h,4bh
+			db	b4h,a8h,f6h,28h,28h,cah,40h,72h
+			db	93h,abh,71h,2bh,a5h,efh,1dh,02h
+			db	fah,a0h,f9h,aeh,cch,7ah,d7h,34h
+			db	0ch,b4h,38h,92h,a9h,3bh,f4h,7bh
+			db	dfh,bch,88h,f2h,6bh,7dh,dah,e4h
+			db	41h,0dh,59h,59h,edh,e1h,c2h,92h
+			db	7dh,42h,89h,cbh,f8h,89h,c2h,b8h
+			db	67h,7dh,01h,dbh,6dh,80h,6ch,b0h
+			db	56h,9fh,a1h,96h,95h,17h,1bh,86h
+			db	c0h,e2h,f1h,69h,c9h,e6h,f7h,91h
+			db	c8h,eeh,e2h,13h,3ah,8ch,99h,4eh
+			db	39h,10h,49h,dah,b9h,0eh,b1h,44h
+			db	97h,0eh,88h,89h,48h,cfh,06h,58h
+			db	3bh,efh,cbh,6dh,b5h,f6h,91h,cfh
+			db	aeh,b3h,aah,cch,d7h,9fh,a4h,ech
+			db	c9h,adh,feh,dbh,c7h,84h,fbh,94h
+			db	84h,6bh,ach,36h,fdh,37h,52h,03h
+			db	07h,feh,94h,62h,4bh,3fh,3bh,d6h
+			db	8bh,26h,f2h,07h,71h,99h,d2h,c3h
+			db	cah,77h,20h,dah,2bh,5dh,b9h,e1h
+			db	fdh,fch,5dh,09h,7fh,06h,44h,88h
+			db	09h,a3h,60h,52h,2bh,8bh,d2h,cdh
+			db	e6h,71h,5ah,f4h,c4h,5ah,efh,17h
+			db	0ch,81h,14h,8ch,37h,cfh,2eh,dbh
+			db	bbh,42h,38h,57h,97h,17h,3dh,f8h
+			db	4fh,18h,4ah,00h,15h,2ah,d9h,86h
+			db	a7h,c3h,42h,7ah,eah,2ah,bbh,90h
+			db	6dh,4eh,8fh,e1h,61h,98h,cdh,22h
+			db	7dh,12h,bch,fbh,94h,a7h,16h,c2h
+			db	12h,39h,2bh,4fh,aeh,4ch,e7h,cfh
+			db	eeh,15h,82h,46h,91h,40h,29h,3dh
+			db	8fh,ebh,07h,c6h,52h,8ch,1eh,42h
+			db	a9h,b9h,a1h,3ah,0dh,cfh,e1h,91h
+			db	afh,87h,e5h,31h,c3h,e0h,8bh,6fh
+			db	1fh,92h,70h,a1h,04h,5eh,6eh,21h
+			db	b2h,6eh,a4h,16h,5ah,17h,15h,f0h
+			db	30h,dch,7ah,aah,f6h,74h,50h,7ch
+			db	cdh,67h,eah,8dh,d6h,69h,d7h,79h
+			db	00h,73h,f1h,86h,06h,c6h,7ch,6ch
+			db	79h,35h,70h,c5h,68h,46h,21h,36h
+			db	83h,d7h,54h,04h,76h,c0h,03h,ebh
+			db	08h,00h,dbh,cfh,00h,25h,45h,29h
+			db	28h,68h,32h,eeh,91h,57h,82h,7eh
+			db	deh,9bh,e1h,1dh,56h,e8h,cdh,21h
+			db	94h,d8h,1ch,41h,c1h,03h,20h,c6h
+			db	a6h,d5h,9dh,64h,8ah,41h,4ch,e2h
+			db	b2h,02h,c3h,53h,4eh,22h,14h,04h
+			db	41h,aeh,47h,09h,c1h,bdh,46h,50h
+			db	ffh,eeh,08h,12h,f3h,26h,07h,80h
+			db	e0h,97h,0ch,bbh,efh,a3h,26h,4bh
+			db	6eh,bch,27h,83h,58h,06h,f6h,87h
+			db	89h,57h,52h,5dh,c3h,9eh,35h,37h
+			db	34h,22h,32h,ffh,fah,b4h,d8h,7eh
+			db	15h,59h,4dh,78h,45h,31h,b6h,cfh
+			db	48h,77h,b8h,3fh,ebh,1dh,85h,2ah
+			db	80h,ech,17h,5bh,0eh,29h,30h,efh
+			db	3bh,fdh,dch,47h,cfh,98h,03h,92h
+			db	a1h,91h,c2h,9ah,58h,cfh,34h,afh
+			db	deh,17h,b4h,45h,7fh,cbh,c3h,52h
+			db	b7h,6bh,03h,8ah,28h,a4h,c6h,59h
+			db	e8h,bbh,f2h,7ch,44h,9dh,25h,94h
+			db	bbh,65h,38h,8ah,2ah,28h,60h,74h
+			db	5dh,62h,6fh,d6h,e6h,97h,efh,99h
+			db	97h,b2h,b4h,2ch,afh,6ch,43h,08h
+			db	b9h,a3h,8ch,deh,e4h,1ch,d2h,b7h
+			db	a7h,56h,93h,45h,36h,26h,d9h,d9h
+			db	f6h,c7h,e6h,7eh,edh,d1h,d9h,eah
+			db	4ah,38h,44h,edh,c0h,89h,88h,27h
+			db	e0h,15h,f0h,29h,12h,f1h,cfh,f3h
+			db	05h,25h,cch,aah,65h,f8h,74h,fdh
+			db	aeh,02h,25h,1ah,dbh,d6h,b8h,3ah
+			db	99h,19h,ech,cch,cfh,e6h,73h,e4h
+			db	bch,e4h,33h,93h,dfh,3ah,a9h,01h
+			db	1dh,76h,0eh,f2h,52h,cbh,74h,5eh
+			db	4ch,19h,7dh,ceh,17h,4dh,5ch,5ah
+			db	cah,9eh,22h,76h,aah,e2h,00h,a4h
+			db	78h,52h,8fh,07h,4bh,eah,53h,36h
+			db	e7h,9ch,fdh,28h,b3h,3dh,17h,28h
+			db	d5h,27h,b5h,b4h,ach,43h,c6h,37h
+			db	05h,1ch,79h,c1h,61h,8ah,9bh,93h
+			db	8fh,64h,b4h,cah,fch,19h,d7h,d1h
+			db	7bh,1eh,0ch,8fh,dch,87h,61h,66h
+			db	bbh,aeh,92h,d9h,0ah,9ah,3ah,0dh
+			db	d0h,12h,e3h,8dh,95h,51h,0fh,24h
+			db	4dh,45h,49h,eah,96h,6fh,4bh,71h
+			db	88h,0ah,98h,88h,1bh,a7h,a9h,71h
+			db	33h,69h,eah,97h,e0h,19h,beh,80h
+			db	78h,d8h,00h,bdh,0ch,25h,ddh,95h
+			db	4fh,7ch,f1h,c4h,4ah,dch,d9h,1fh
+			db	00h,b6h,43h,c7h,a5h,2fh,24h,00h
+			db	afh,19h,00h,9dh,80h,9ch,4fh,3ch
+			db	75h,7fh,05h,06h,6fh,dbh,b7h,1eh
+			db	a7h,0bh,52h,5ch,6bh,6ah,31h,6bh
+			db	96h,78h,d6h,8bh,31h,0ch,deh,08h
+			db	0ah,2fh,0ah,36h,15h,8fh,2bh,58h
+			db	48h,8eh,45h,cch,05h,10h,4ch,24h
+			db	40h,d6h,7dh,61h,ffh,a0h,68h,17h
+			db	a2h,dfh,81h,b9h,c5h,3fh,5bh,aah
+			db	89h,92h,61h,04h,7bh,0dh,ach,11h
+			db	6eh,bbh,96h,e6h,e5h,66h,43h,c2h
+			db	43h,8ch,d1h,ech,11h,bah,97h,f2h
+			db	d3h,d4h,0ah,8ah,35h,92h,4bh,ebh
+			db	a8h,dah,6bh,9ch,cdh,dch,c2h,4bh
+			db	6bh,36h,cch,1bh,66h,20h,e2h,a7h
+			db	64h,42h,9dh,07h,dah,70h,44h,73h
+			db	e2h,f0h,9ch,87h,edh,58h,9ch,2ch
+			db	abh,6fh,0ah,8fh,73h,69h,33h,9bh
+			db	e4h,04h,c7h,04h,65h,c8h,e2h,dfh
+			db	1eh,83h,5fh,e8h,0ch,8ah,08h,00h
+			db	a3h,23h,35h,5dh,d8h,80h,2ch,1ah
+			db	68h,1eh,67h,8fh,c4h,a7h,7dh,a1h
+			db	f2h,a6h,beh,7bh,9fh,c3h,18h,e3h
+			db	08h,e9h,d0h,76h,37h,03h,edh,deh
+			db	a8h,a1h,ffh,24h,71h,eah,11h,93h
+			db	41h,0ah,b6h,07h,efh,c0h,e1h,8dh
+			db	39h,54h,9bh,60h,deh,0eh,56h,b7h
+			db	77h,22h,60h,34h,81h,5eh,5eh,9dh
+			db	6eh,b6h,d6h,e4h,a6h,71h,55h,46h
+			db	c6h,e8h,72h,f3h,3dh,cfh,05h,94h
+			db	e9h,c2h,94h,d5h,31h,d5h,ffh,9ah
+			db	26h,89h,feh,44h,8dh,7eh,a8h,93h
+			db	65h,67h,88h,a6h,3dh,54h,42h,4bh
+			db	ech,aah,7ch,3ch,85h,bfh,b2h,16h
+			db	88h,c5h,ach,87h,aeh,57h,bbh,cah
+			db	70h,84h,78h,97h,e9h,27h,02h,66h
+			db	67h,f5h,08h,57h,78h,78h,b0h,5fh
+			db	deh,68h,30h,82h,e5h,17h,7ah,c5h
+			db	17h,c0h,5eh,04h,2ah,2ch,2dh,33h
+			db	22h,93h,d0h,2bh,feh,bah,65h,34h
+			db	5bh,d6h,35h,1eh,7dh,e2h,93h,10h
+			db	aah,04h,00h,4ah,36h,b8h,78h,93h
+			db	09h,e8h,2ch,11h,46h,f9h,bdh,79h
+			db	d5h,19h,a5h,b7h,34h,2fh,4bh,adh
+			db	39h,e5h,2fh,88h,a7h,e5h,9bh,5bh
+			db	67h,fah,bch,21h,e6h,76h,ddh,a8h
+			db	d4h,27h,ech,9eh,83h,cch,0dh,61h
+			db	deh,d3h,1dh,bch,63h,d8h,cdh,c2h
+			db	8fh,59h,1ch,bdh,ech,02h,4dh,00h
+			db	b3h,69h,64h,f2h,6bh,ffh,30h,c1h
+			db	52h,e9h,fbh,42h,b9h,0ah,cbh,46h
+			db	97h,76h,c0h,98h,d6h,1dh,d9h,a2h
+			db	bbh,2ch,05h,fdh,5ch,47h,4ah,1dh
+			db	9ah,aah,aeh,42h,9eh,3dh,73h,5ch
+			db	c5h,41h,6bh,c8h,dbh,95h,93h,aeh
+			db	53h,6dh,01h,7ch,c7h,7eh,4bh,38h
+			db	7ch,ffh,6dh,bah,c1h,16h,6bh,59h
+			db	29h,f0h,54h,74h,3eh,f7h,0fh,20h
+			db	13h,dch,17h,89h,0ah,b5h,8fh,50h
+			db	12h,64h,edh,38h,10h,3bh,17h,c3h
+			db	25h,1bh,bfh,80h,c6h,88h,8dh,c7h
+			db	44h,82h,4ah,f0h,5ah,90h,34h,9ch
+			db	9ch,41h,18h,a5h,4fh,8fh,bbh,3ah
+			db	d8h,f0h,10h,69h,dah,aah,dch,9eh
+			db	01h,46h,e8h,5ch,a0h,98h,2bh,8fh
+			db	72h,7bh,efh,aah,d9h,b3h,38h,f6h
+			db	10h,9ah,9eh,a4h,bdh,cch,8eh,e9h
+			db	6fh,ffh,e9h,d4h,92h,d2h,a8h,cch
+			db	06h,adh,56h,e7h,2bh,c2h,63h,fah
+			db	66h,f7h,12h,99h,12h,84h,98h,cah
+			db	25h,98h,30h,4bh,b8h,eeh,65h,1dh
+			db	24h,3ah,0bh,b6h,dch,23h,a3h,cah
+			db	eeh,fdh,80h,81h,e0h,f7h,4bh,ceh
+			db	08h,1ch,c8h,72h,b4h,f3h,5fh,d0h
+			db	38h,21h,68h,13h,d2h,b9h,fah,bch
+			db	6dh,04h,20h,4bh,d2h,0dh,efh,f8h
+			db	4fh,31h,fdh,54h,23h,e9h,a4h,1bh
+			db	47h,98h,37h,c6h,2dh,34h,9ch,27h
+			db	fah,65h,13h,a4h,10h,69h,3dh,78h
+			db	f9h,29h,d2h,d6h,a7h,79h,20h,44h
+			db	62h,86h,e1h,dbh,55h,a8h,69h,47h
+			db	b0h,46h,41h,53h,58h,51h,0eh,0bh
+			db	a1h,65h,beh,b4h,22h,1eh,98h,c2h
+			db	e6h,f6h,08h,29h,0ah,b9h,eeh,1fh
+			db	88h,41h,82h,d1h,12h,41h,14h,31h
+			db	17h,e8h,4fh,07h,21h,efh,34h,33h
+			db	e5h,deh,51h,a1h,ach,dah,b5h,c4h
+			db	08h,20h,85h,9dh,f1h,bch,85h,03h
+			db	b3h,79h,92h,adh,45h,c5h,dbh,ddh
+			db	46h,68h,a9h,d2h,63h,14h,57h,c4h
+			db	e5h,92h,44h,24h,99h,51h,5ch,d6h
+			db	22h,3bh,10h,bah,0bh,0bh,10h,fdh
+			db	efh,99h,79h,d0h,29h,95h,45h,e4h
+			db	4ch,25h,afh,a7h,3fh,4eh,2bh,86h
+			db	9dh,36h,d6h,5bh,d3h,0bh,08h,ceh
+			db	48h,36h,d6h,62h,67h,82h,c1h,8bh
+			db	f5h,96h,94h,13h,f1h,08h,cfh,51h
+			db	3eh,b6h,66h,36h,f9h,21h,f9h,02h
+			db	6dh,d6h,bfh,90h,5bh,beh,52h,09h
+			db	7ch,9dh,aeh,a3h,d5h,0ch,dbh,bdh
+			db	d3h,81h,fch,cch,1fh,beh,58h,67h
+			db	63h,f2h,52h,d9h,c7h,4dh,33h,31h
+			db	22h,3ch,7ah,4dh,b1h,d4h,31h,76h
+			db	08h,d5h,51h,eeh,9dh,c2h,3dh,92h
+			db	29h,ddh,3eh,d5h,0ah,9dh,cah,52h
+			db	b9h,f7h,a4h,30h,e1h,0ch,d3h,4fh
+			db	17h,93h,20h,6bh,46h,deh,c0h,2eh
+			db	c1h,06h,d2h,6eh,edh,4eh,edh,34h
+			db	26h,64h,48h,07h,dah,f2h,64h,8bh
+			db	bch,cah,d1h,b7h,24h,a2h,9eh,9bh
+			db	e9h,1fh,28h,5dh,71h,28h,b6h,96h
+			db	6eh,87h,34h,6eh,d8h,e7h,c9h,86h
+			db	dch,e5h,7ah,64h,a9h,c8h,16h,03h
+			db	c8h,bfh,c9h,76h,89h,d9h,17h,3dh
+			db	29h,e7h,84h,23h,dch,65h,c3h,06h
+			db	c3h,4ch,75h,3fh,8bh,2fh,35h,04h
+			db	47h,69h,c8h,9bh,f1h,16h,b6h,e1h
+			db	70h,55h,b4h,2eh,efh,6ch,fdh,d3h
+			db	dfh,88h,71h,5ah,1ah,d6h,9eh,32h
+			db	eeh,71h,f4h,a9h,e3h,63h,e7h,9eh
+			db	d9h,fah,57h,4bh,7dh,2fh,69h,9ah
+			db	31h,beh,62h,15h,3ah,76h,0dh,22h
+			db	65h,adh,42h,f4h,6fh,85h,2dh,6eh
+			db	d7h,fah,82h,8fh,26h,a9h,17h,28h
+			db	3fh,70h,53h,26h,61h,0dh,a8h,6dh
+			db	53h,36h,ech,44h,98h,82h,d3h,b2h
+			db	d7h,6bh,06h,4bh,11h,2ah,44h,c8h
+			db	b0h,fch,11h,7dh,51h,c7h,ach,d0h
+			db	f0h,a8h,6bh,09h,d7h,01h,a7h,9bh
+			db	63h,3fh,4dh,0ch,efh,61h,9ch,30h
+			db	20h,e6h,a2h,38h,58h,f0h,fch,33h
+			db	b5h,12h,f2h,81h,7bh,2dh,e6h,c1h
+			db	86h,9ah,05h,beh,86h,45h,dbh,ceh
+			db	93h,36h,f8h,45h,11h,32h,47h,b8h
+			db	d8h,25h,07h,75h,c4h,e3h,58h,7ch
+			db	a4h,deh,e6h,25h,2eh,e4h,d9h,80h
+			db	44h,cbh,4dh,c1h,61h,5ch,cfh,5eh
+			db	9fh,76h,7fh,33h,96h,a7h,4bh,9ah
+			db	76h,eah,beh,dch,a2h,1bh,f8h,21h
+			db	51h,f0h,23h,cfh,15h,adh,81h,03h
+			db	92h,91h,1ch,94h,b3h,c2h,50h,02h
+			db	d1h,5fh,76h,c4h,c7h,55h,abh,8dh
+			db	6bh,d1h,1bh,a5h,e1h,eeh,6bh,69h
+			db	93h,51h,ech,73h,08h,05h,bbh,e2h
+			db	2bh,77h,76h,14h,58h,2dh,aah,4bh
+			db	3ah,25h,b4h,34h,49h,4ch,1dh,91h
+			db	dbh,fah,dbh,d0h,5ch,36h,b5h,98h
+			db	2dh,f7h,f3h,bfh,e2h,21h,20h,4ch
+			db	dch,e8h,7bh,a2h,90h,3ch,2ch,99h
+			db	89h,fah,2ah,9eh,4ch,e2h,08h,12h
+			db	e1h,45h,78h,19h,37h,cah,70h,2bh
+			db	e5h,0ah,25h,2fh,dch,b3h,afh,46h
+			db	79h,73h,9eh,1ch,8fh,17h,53h,7bh
+			db	95h,9eh,28h,bah,4ch,a5h,33h,34h
+			db	07h,61h,07h,a6h,06h,55h,4eh,60h
+			db	71h,ech,17h,94h,40h,09h,1ch,4eh
+			db	51h,e4h,5dh,72h,96h,14h,36h,f5h
+			db	40h,34h,a6h,efh,b5h,d3h,dah,f8h
+			db	58h,79h,deh,efh,f6h,b8h,10h,08h
+			db	14h,0fh,ebh,47h,f8h,13h,e1h,85h
+			db	7fh,dah,aah,c4h,0ah,5eh,3eh,feh
+			db	a8h,52h,3fh,08h,beh,fah,bah,62h
+			db	dah,34h,36h,c8h,44h,2ch,38h,9dh
+			db	d8h,bbh,38h,8fh,35h,01h,6eh,7ch
+			db	8eh,d4h,28h,29h,65h,b0h,d3h,72h
+			db	9bh,6fh,a0h,bdh,65h,2fh,c9h,55h
+			db	8dh,08h,eeh,66h,67h,59h,beh,45h
+			db	cbh,71h,adh,28h,81h,87h,9eh,e1h
+			db	e6h,31h,cfh,b4h,3ah,4ch,7ah,b9h
+			db	a8h,01h,79h,dch,3bh,e0h,61h,8fh
+			db	37h,2ah,45h,1ah,b0h,15h,ceh,97h
+			db	7ch,23h,00h,dah,90h,0fh,86h,76h
+			db	0bh,69h,3dh,69h,86h,90h,b1h,95h
+			db	7dh,c6h,adh,34h,95h,60h,32h,4bh
+			db	78h,aah,2bh,6eh,3ch,7dh,08h,3fh
+			db	e7h,99h,95h,1ah,d5h,43h,1ah,8ah
+			db	62h,45h,a1h,f3h,7eh,0bh,c8h,27h
+			db	01h,e9h,35h,87h,44h,e0h,7dh,b5h
+			db	d0h,bfh,d8h,45h,8dh,74h,03h,35h
+			db	90h,a1h,cdh,00h,9fh,1fh,46h,b4h
+			db	04h,cbh,b9h,6ah,08h,06h,41h,bfh
+			db	15h,a1h,0dh,48h,6bh,88h,54h,e6h
+			db	c9h,c0h,c2h,98h,06h,10h,fbh,beh
+			db	83h,42h,14h,71h,f7h,d2h,f5h,f5h
+			db	b3h,aah,77h,f2h,a2h,74h,2dh,1dh
+			db	9bh,ddh,97h,09h,03h,feh,97h,62h
+			db	f8h,22h,d9h,fch,27h,1ah,edh,22h
+			db	f4h,a1h,85h,95h,6ah,b2h,e8h,ach
+			db	f2h,66h,16h,59h,87h,49h,42h,63h
+			db	54h,a7h,ddh,28h,c4h,74h,46h,f1h
+			db	59h,ech,77h,d6h,b3h,53h,4ch,5bh
+			db	33h,bbh,38h,0eh,d8h,c3h,19h,b0h
+			db	a7h,2dh,14h,bch,78h,d3h,1bh,62h
+			db	a2h,53h,3eh,4fh,36h,e5h,b9h,f3h
+			db	b7h,06h,00h,a8h,14h,bch,1ch,16h
+			db	3ch,5ah,8dh,fdh,17h,18h,d0h,1fh
+			db	b4h,fdh,5ah,35h,d4h,b6h,b6h,0eh
+			db	31h,1bh,99h,47h,48h,4fh,a4h,4dh
+			db	15h,6bh,05h,65h,39h,65h,2ch,ffh
+			db	90h,2fh,a1h,42h,99h,9eh,75h,7bh
+			db	1ah,57h,05h,15h,66h,4bh,3fh,8dh
+			db	46h,8ah,06h,87h,11h,48h,edh,f7h
+			db	9ah,e9h,15h,37h,0fh,4eh,53h,32h
+			db	86h,6fh,ceh,43h,cfh,57h,abh,a9h
+			db	93h,e4h,18h,4ah,24h,63h,b5h,8ch
+			db	ebh,76h,39h,6fh,d9h,70h,bch,c0h
+			db	e2h,dah,1fh,09h,63h,0bh,60h,d2h
+			db	62h,dbh,2ch,50h,a3h,72h,29h,6bh
+			db	fch,b1h,5eh,e4h,42h,34h,6bh,beh
+			db	2dh,60h,3eh,a3h,11h,a6h,57h,4fh
+			db	b4h,a9h,6bh,42h,6fh,afh,05h,45h
+			db	b8h,f9h,6fh,7fh,e9h,e4h,48h,f2h
+			db	f4h,f8h,41h,d3h,26h,3ah,12h,30h
+			db	85h,3bh,eeh,71h,46h,bch,8fh,5ch
+			db	e4h,6eh,afh,34h,f2h,b4h,16h,bah
+			db	a3h,0eh,0dh,73h,61h,53h,7dh,49h
+			db	31h,b7h,6bh,66h,2dh,79h,9fh,95h
+			db	41h,91h,a7h,46h,e4h,96h,9ch,b7h
+			db	ffh,f5h,3fh,55h,0ch,55h,04h,1ah
+			db	1eh,e6h,60h,05h,32h,46h,a6h,ddh
+			db	7eh,6fh,13h,eah,8dh,a7h,73h,1ch
+			db	11h,50h,40h,f3h,63h,59h,22h,71h
+			db	93h,cfh,56h,46h,6ch,46h,62h,adh
+			db	35h,fch,f8h,14h,dfh,2fh,86h,cch
+			db	44h,35h,a5h,7dh,64h,32h,6dh,45h
+			db	f2h,23h,12h,13h,14h,3dh,fbh,08h
+			db	97h,73h,94h,8ah,e0h,ach,94h,ech
+			db	0bh,56h,b3h,a5h,98h,2dh,9bh,97h
+			db	3bh,4eh,f4h,93h,1eh,25h,47h,87h
+			db	05h,a6h,a4h,9dh,d3h,a5h,d4h,e1h
+			db	7ah,dbh,16h,13h,45h,43h,0dh,fbh
+			db	48h,5eh,6bh,94h,ech,2eh,00h,94h
+			db	9dh,74h,e3h,07h,cbh,96h,7dh,b6h
+			db	1bh,59h,4eh,9eh,7ah,9ah,8ch,3ch
+			db	bfh,cch,b4h,f1h,4ch,adh,36h,b8h
+			db	a3h,a5h,92h,8eh,08h,95h,36h,dbh
+			db	7ch,c5h,e5h,5ch,c9h,1fh,37h,88h
+			db	9ch,a1h,6bh,edh,45h,72h,51h,5fh
+			db	adh,52h,6ah,7ch,40h,aeh,81h,6fh
+			db	41h,c2h,b3h,e7h,7dh,5ch,4dh,4bh
+			db	a5h,f4h,f2h,79h,7fh,77h,05h,cch
+			db	8ch,1bh,edh,e5h,9ch,60h,cah,88h
+			db	23h,1ch,dch,32h,67h,2ah,c0h,8dh
+			db	86h,9ah,aeh,72h,d1h,39h,f0h,00h
+			db	0ah,d3h,7ah,2bh,8bh,9dh,11h,08h
+			db	10h,28h,c3h,a1h,8fh,72h,e6h,d1h
+			db	f7h,c2h,a7h,47h,b9h,38h,aeh,6bh
+			db	2fh,78h,16h,e6h,64h,3fh,2fh,19h
+			db	7dh,39h,64h,d3h,2eh,cdh,6eh,b5h
+			db	76h,9ah,60h,bah,a0h,68h,69h,adh
+			db	66h,16h,8bh,09h,eeh,bbh,3dh,54h
+			db	eeh,7fh,66h,00h,62h,69h,b8h,55h
+			db	34h,89h,87h,5eh,23h,80h,91h,f0h
+			db	e7h,3eh,0bh,bch,96h,7fh,e1h,59h
+			db	cah,89h,43h,36h,c2h,c6h,51h,a1h
+			db	c9h,38h,0eh,05h,fdh,92h,3fh,fbh
+			db	a5h,b3h,87h,27h,e3h,96h,43h,87h
+			db	80h,c9h,c5h,20h,01h,3ch,d1h,38h
+			db	71h,5ah,73h,adh,24h,b5h,39h,e4h
+			db	86h,4dh,dfh,37h,8fh,7dh,efh,06h
+			db	5bh,e3h,dah,8ah,07h,f5h,e7h,6dh
+			db	29h,28h,1dh,e3h,39h,4ch,d5h,a3h
+			db	16h,c4h,5eh,e1h,70h,cdh,9ah,e5h
+			db	1bh,78h,d2h,88h,00h,49h,1ah,10h
+			db	55h,c1h,f0h,0ah,6fh,01h,4ch,06h
+			db	11h,3ch,1ch,97h,bbh,c7h,9ah,28h
+			db	81h,0fh,2bh,40h,71h,e4h,15h,f7h
+			db	05h,43h,c0h,00h,26h,5ch,76h,49h
+			db	12h,dch,7ah,d5h,cbh,c9h,57h,1eh
+			db	9ch,6fh,4ch,56h,ddh,96h,a5h,10h
+			db	36h,59h,1ah,c9h,58h,54h,94h,a7h
+			db	d5h,1ah,25h,bbh,f2h,b5h,3ch,bch
+			db	2dh,16h,7eh,8ch,34h,e5h,57h,67h
+			db	8dh,cdh,9ah,99h,bbh,ceh,62h,77h
+			db	a2h,a8h,e2h,d0h,d8h,59h,d0h,17h
+			db	28h,1ah,46h,59h,10h,ddh,cfh,25h
+			db	eeh,f8h,3eh,55h,61h,11h,30h,57h
+			db	b1h,16h,2fh,ach,e8h,bfh,3ah,d1h
+			db	1fh,f5h,fch,75h,a3h,a5h,d0h,18h
+			db	aah,91h,71h,68h,16h,9ah,1ch,79h
+			db	d0h,e9h,d1h,8dh,dah,41h,08h,14h
+			db	e2h,34h,e4h,3bh,e4h,b7h,8ch,60h
+			db	c5h,45h,64h,aah,fbh,53h,26h,9ah
+			db	c1h,c1h,36h,d0h,49h,96h,d1h,40h
+			db	f9h,6ah,34h,b3h,8eh,3ch,76h,05h
+			db	ffh,efh,35h,bch,1ch,d3h,05h,c3h
+			db	bbh,19h,59h,4fh,8bh,d8h,edh,e1h
+			db	2fh,30h,34h,79h,e5h,4fh,afh,14h
+			db	42h,3ah,63h,55h,1bh,2eh,f4h,7fh
+			db	cbh,44h,d5h,c8h,73h,80h,57h,bch
+			db	6eh,a8h,ddh,70h,b7h,f7h,87h,8eh
+			db	11h,4ch,00h,9fh,81h,eeh,94h,56h
+			db	e2h,1fh,aeh,1ch,5ah,6ah,6dh,42h
+			db	4eh,cfh,23h,62h,41h,dah,edh,25h
+			db	b7h,6ah,ddh,dbh,83h,60h,96h,ach
+			db	beh,2bh,f8h,24h,c7h,09h,a3h,0eh
+			db	c6h,ebh,b1h,b7h,2fh,76h,1eh,d3h
+			db	6ah,d2h,75h,1bh,cbh,42h,6eh,c5h
+			db	c3h,d6h,52h,a3h,e3h,2eh,e1h,e5h
+			db	92h,fch,42h,7eh,77h,4dh,78h,5ch
+			db	4ch,63h,2ah,14h,d9h,8dh,a7h,1eh
+			db	6ch,e7h,18h,84h,ffh,52h,9bh,4dh
+			db	ffh,7ah,bfh,49h,38h,8bh,19h,e5h
+			db	14h,59h,d3h,f6h,76h,37h,b7h,32h
+			db	d2h,49h,dah,52h,cfh,ffh,3fh,83h
+			db	8eh,8dh,34h,51h,27h,f2h,4fh,42h
+			db	51h,23h,36h,aeh,aah,c3h,83h,8dh
+			db	0bh,84h,a5h,edh,f2h,dfh,07h,07h
+			db	22h,5dh,e4h,83h,04h,07h,c1h,30h
+			db	8ah,f3h,9ah,c9h,d7h,29h,1ch,75h
+			db	13h,17h,8ah,d9h,f7h,05h,14h,49h
+			db	97h,e9h,55h,c5h,b4h,37h,b4h,d9h
+			db	2dh,5ch,5dh,2ch,11h,b9h,8ch,2eh
+			db	a7h,e9h,d9h,63h,a9h,66h,4bh,3dh
+			db	cdh,e6h,80h,03h,33h,abh,95h,6eh
+			db	20h,81h,82h,40h,edh,93h,abh,75h
+			db	21h,5ch,26h,03h,dah,b8h,6ah,60h
+			db	eeh,8fh,11h,85h,b7h,3fh,e8h,99h
+			db	55h,e0h,b4h,56h,4eh,6eh,cah,8eh
+			db	97h,16h,b3h,72h,abh,a6h,cah,deh
+			db	83h,28h,72h,76h,07h,adh,8dh,86h
+			db	fah,8ch,d2h,49h,b7h,1bh,5eh,5eh
+			db	beh,f9h,aeh,9eh,ddh,b9h,08h,e5h
+			db	1dh,9eh,08h,d9h,80h,41h,4dh,b2h
+			db	40h,b2h,60h,e7h,fbh,c4h,2dh,b9h
+			db	b8h,76h,2ch,b9h,b3h,9eh,0eh,ffh
+			db	37h,a9h,0eh,eeh,99h,d3h,44h,36h
+			db	44h,70h,46h,0bh,33h,5fh,3dh,ddh
+			db	f8h,e6h,73h,0eh,05h,6dh,16h,d8h
+			db	5ah,d7h,51h,03h,53h,deh,4ah,d7h
+			db	e3h,e1h,40h,66h,85h,e9h,74h,2fh
+			db	fbh,bch,75h,14h,fbh,40h,d0h,6fh
+			db	32h,f8h,fah,10h,82h,78h,3bh,2bh
+			db	b6h,5ch,0fh,02h,a7h,e1h,0bh,05h
+			db	04h,11h,a7h,a2h,bbh,92h,2ah,05h
+			db	70h,7dh,b5h,8eh,43h,d1h,48h,c5h
+			db	4ah,28h,e1h,3ch,87h,55h,e6h,39h
+			db	f0h,85h,fdh,f4h,f4h,c9h,94h,98h
+			db	a9h,2fh,a6h,84h,47h,40h,01h,3ah
+			db	06h,3dh,01h,0bh,6ah,62h,58h,37h
+			db	51h,71h,beh,0bh,b5h,e7h,09h,0dh
+			db	c8h,b0h,e9h,feh,01h,52h,97h,a2h
+			db	7ch,1ah,ech,f0h,1ch,0dh,2ch,2bh
+			db	aah,c6h,7ch,36h,26h,1ah,56h,40h
+			db	e9h,8bh,c4h,a2h,31h,66h,17h,8bh
+			db	18h,efh,cfh,79h,f3h,10h,d0h,46h
+			db	24h,1ah,e1h,9bh,18h,6dh,8ah,73h
+			db	cdh,b4h,b0h,0fh,47h,1ah,7ch,6fh
+			db	78h,e6h,58h,5ch,03h,f5h,4ah,ceh
+			db	f4h,beh,a7h,a8h,07h,83h,25h,e0h
+			db	98h,a4h,a8h,c4h,0eh,cfh,35h,78h
+			db	38h,bdh,e9h,42h,8eh,aeh,33h,a7h
+			db	00h,00h,e2h,dfh,e4h,aeh,b6h,79h
+			db	20h,e7h,79h,9eh,abh,0ah,7ah,b6h
+			db	a9h,25h,00h,10h,0eh,39h,6dh,c7h
+			db	d1h,0fh,e0h,e4h,9ch,cfh,5ch,6ch
+			db	04h,d3h,fbh,e6h,cdh,83h,a6h,afh
+			db	08h,47h,0ch,deh,84h,ceh,0ah,c9h
+			db	edh,4bh,71h,3fh,cdh,17h,f1h,94h
+			db	c1h,e7h,ech,66h,88h,09h,2bh,9dh
+			db	15h,e6h,d6h,a4h,1eh,bah,06h,feh
+			db	e9h,d4h,c3h,f9h,a7h,58h,69h,a6h
+			db	07h,14h,65h,48h,a4h,5dh,d3h,5ch
+			db	e5h,2bh,9bh,bah,77h,a1h,19h,68h
+			db	91h,d4h,c3h,7bh,cfh,77h,d9h,dfh
+			db	a1h,47h,25h,a1h,18h,70h,4dh,a5h
+			db	85h,5fh,a6h,31h,a3h,1eh,3bh,c0h
+			db	76h,96h,afh,01h,76h,5dh,a3h,eah
+			db	93h,94h,c9h,bfh,70h,9ah,d6h,6eh
+			db	35h,94h,3dh,b3h,cah,e6h,b6h,30h
+			db	b2h,a6h,c0h,e0h,cfh,6bh,3fh,fdh
+			db	4fh,36h,4fh,99h,d2h,14h,38h,f7h
+			db	b1h,3dh,98h,3ch,d5h,5ah,d4h,e1h
+			db	9bh,04h,28h,4bh,78h,27h,cfh,86h
+			db	8dh,60h,6ah,f7h,28h,2ah,e3h,78h
+			db	a2h,2dh,d9h,70h,3dh,f5h,b3h,58h
+			db	bdh,aah,76h,fbh,5dh,83h,24h,05h
+			db	83h,3fh,28h,fah,18h,59h,aeh,f3h
+			db	c1h,13h,d1h,16h,b3h,d7h,4dh,8ch
+			db	c4h,bah,1ch,04h,2bh,ebh,52h,fbh
+			db	fah,ach,03h,44h,50h,8fh,73h,2ah
+			db	36h,6ah,1ch,81h,bdh,b4h,b6h,69h
+			db	d0h,27h,2bh,1dh,9ah,0ah,feh,ebh
+			db	01h,87h,d7h,94h,67h,e9h,63h,13h
+			db	adh,77h,b5h,a6h,74h,08h,e1h,71h
+			db	63h,81h,cch,38h,2fh,67h,5fh,98h
+			db	0ch,d0h,03h,78h,1eh,41h,95h,5ah
+			db	70h,d4h,eah,e8h,cch,15h,46h,44h
+			db	a2h,dfh,a5h,cbh,03h,b4h,53h,d7h
+			db	efh,5ah,8ah,ffh,43h,d5h,45h,5ch
+			db	b8h,c5h,f1h,17h,b9h,c5h,a4h,a8h
+			db	dfh,f9h,c8h,71h,19h,25h,11h,50h
+			db	82h,fch,aah,4ah,54h,edh,7ch,64h
+			db	b8h,9ch,e2h,34h,0ch,5bh,08h,5ch
+			db	fdh,1fh,49h,ebh,c0h,3fh,f5h,eeh
+			db	dah,53h,e5h,c8h,d3h,4fh,44h,a8h
+			db	adh,dbh,d4h,84h,12h,57h,43h,38h
+			db	63h,2eh,69h,a8h,dbh,62h,4fh,eeh
+			db	53h,4fh,7dh,93h,d7h,23h,91h,9bh
+			db	05h,c8h,68h,e2h,35h,b3h,1dh,42h
+			db	83h,52h,6dh,9eh,c5h,d3h,46h,7fh
+			db	00h,e2h,78h,c8h,7dh,bch,dbh,45h
+			db	72h,99h,48h,09h,dah,70h,c6h,cdh
+			db	bfh,e4h,64h,edh,d6h,e3h,a6h,1dh
+			db	9fh,dfh,7fh,65h,f0h,d3h,5dh,ach
+			db	c2h,93h,29h,7eh,05h,7bh,8ch,06h
+			db	d7h,77h,e7h,b9h,aah,9bh,55h,92h
+			db	fah,0dh,a7h,2ah,57h,5dh,b7h,05h
+			db	75h,b6h,d9h,4ch,bdh,08h,a6h,29h
+			db	bbh,9ch,7ah,2dh,42h,9dh,f0h,8dh
+			db	7eh,22h,d7h,80h,76h,16h,6eh,51h
+			db	2fh,b6h,74h,45h,bdh,7fh,afh,22h
+			db	74h,bbh,1dh,98h,71h,c6h,9eh,0fh
+			db	81h,d3h,bah,68h,b2h,f3h,30h,b4h
+			db	d0h,1bh,b2h,18h,0dh,4eh,71h,edh
+			db	f8h,8fh,10h,14h,2ch,3eh,2fh,76h
+			db	c1h,08h,71h,63h,f9h,90h,9dh,20h
+			db	95h,95h,16h,89h,78h,17h,20h,fch
+			db	b4h,fbh,33h,e9h,8ch,38h,1eh,d6h
+			db	c6h,ceh,cah,e7h,59h,c0h,f6h,6ch
+			db	d5h,73h,82h,f2h,2fh,6eh,98h,e6h
+			db	32h,ffh,09h,1bh,b6h,57h,1ah,3ch
+			db	36h,b8h,fbh,c4h,08h,b7h,c7h,f0h
+			db	35h,2dh,19h,c7h,b4h,51h,5bh,d1h
+			db	0fh,d6h,40h,f0h,0ch,51h,aeh,78h
+			db	51h,1fh,46h,8bh,5bh,56h,d9h,0dh
+			db	88h,5fh,ach,f9h,b4h,e4h,69h,8ch
+			db	33h,2bh,22h,42h,19h,8dh,ceh,8dh
+			db	3ah,12h,76h,7ch,c9h,3dh,79h,02h
+			db	0eh,b5h,dfh,51h,88h,02h,bah,1bh
+			db	96h,a8h,cfh,31h,27h,55h,0ah,c4h
+			db	e1h,cdh,d0h,2bh,78h,00h,15h,19h
+			db	63h,62h,7bh,7eh,f3h,a7h,36h,35h
+			db	06h,e6h,b7h,4ah,0ah,c3h,cah,32h
+			db	edh,14h,a9h,c5h,d3h,d5h,9eh,7bh
+			db	b6h,12h,69h,93h,edh,cbh,23h,deh
+			db	cbh,49h,adh,6dh,94h,deh,f9h,fch
+			db	b3h,68h,f1h,8bh,59h,f4h,69h,10h
+			db	3dh,83h,04h,18h,beh,75h,c8h,6dh
+			db	72h,a3h,4bh,2dh,6eh,f0h,f0h,bch
+			db	e5h,f1h,9ah,05h,3ch,2ah,e2h,10h
+			db	0bh,4bh,00h,c7h,52h,ebh,f1h,b9h
+			db	b2h,1fh,a1h,e9h,bah,69h,c1h,81h
+			db	05h,ach,99h,55h,ach,76h,7dh,bah
+			db	b4h,7ch,afh,36h,75h,66h,71h,81h
+			db	53h,9eh,0fh,e3h,6fh,c3h,02h,d3h
+			db	02h,3eh,beh,c0h,b8h,76h,b0h,cfh
+			db	44h,e6h,e5h,bbh,68h,78h,44h,3fh
+			db	c6h,1bh,05h,f1h,77h,c9h,c0h,1ah
+			db	efh,d1h,35h,13h,20h,7ch,7bh,50h
+			db	4bh,66h,9dh,41h,8fh,4ah,68h,0ch
+			db	0eh,fdh,84h,19h,91h,deh,f2h,89h
+			db	f9h,9ch,80h,44h,1bh,74h,4ah,e5h
+			db	78h,2fh,ceh,46h,9eh,b1h,d5h,a3h
+			db	fdh,f5h,c6h,93h,5fh,f9h,cdh,3ch
+			db	42h,cah,0dh,4ch,2fh,d9h,8ch,16h
+			db	fdh,73h,dah,38h,b9h,f5h,41h,f2h
+			db	4ch,ddh,e1h,41h,38h,eah,8dh,fdh
+			db	d6h,0bh,1dh,d3h,41h,31h,17h,2fh
+			db	8ch,d3h,deh,64h,bch,4bh,45h,69h
+			db	e6h,b5h,01h,24h,bch,adh,56h,87h
+			db	64h,deh,ach,4dh,8fh,85h,93h,2bh
+			db	75h,14h,79h,eah,4eh,37h,d9h,c0h
+			db	81h,edh,11h,bdh,c6h,8bh,71h,07h
+			db	78h,d7h,5ah,0dh,17h,4dh,2dh,e1h
+			db	96h,68h,d7h,95h,b4h,4ah,50h,52h
+			db	77h,0dh,90h,d5h,0fh,5fh,32h,81h
+			db	28h,98h,dfh,35h,5bh,a8h,e7h,e7h
+			db	92h,5fh,21h,b6h,a0h,fch,adh,b4h
+			db	71h,33h,02h,22h,38h,88h,32h,e1h
+			db	07h,edh,6dh,14h,3ah,73h,02h,88h
+			db	f2h,67h,84h,d0h,d3h,6ch,68h,d6h
+			db	64h,e6h,58h,c1h,b9h,88h,31h,bdh
+			db	23h,3fh,2bh,9eh,f7h,d9h,94h,28h
+			db	9fh,e4h,5ch,9dh,ebh,f0h,dah,bfh
+			db	c7h,86h,00h,a1h,14h,10h,17h,9eh
+			db	9ch,8dh,5dh,27h,b5h,e9h,a3h,bdh
+			db	adh,edh,4ah,36h,b2h,00h,b8h,4dh
+			db	28h,64h,cfh,e8h,24h,f5h,2ah,3bh
+			db	46h,63h,8dh,75h,d9h,67h,edh,3dh
+			db	f9h,9eh,8fh,9fh,76h,9eh,79h,afh
+			db	8eh,cch,23h,c0h,bbh,59h,3dh,e0h
+			db	15h,f7h,00h,1fh,d8h,1fh,8ch,b7h
+			db	1bh,b1h,03h,75h,f7h,ech,75h,ech
+			db	d0h,91h,fdh,dbh,e6h,f8h,73h,62h
+			db	54h,98h,9fh,25h,8ch,f6h,27h,95h
+			db	84h,dbh,82h,e9h,c6h,8bh,cdh,90h
+			db	a3h,f7h,10h,24h,47h,8ch,c5h,a3h
+			db	b2h,12h,57h,7bh,65h,45h,bbh,2fh
+			db	38h,48h,4ah,37h,82h,2ah,e5h,8ah
+			db	18h,fbh,beh,08h,f6h,b3h,38h,eah
+			db	21h,45h,abh,17h,d3h,7dh,64h,97h
+			db	dch,e8h,8dh,50h,9ch,61h,02h,28h
+			db	91h,66h,9fh,a2h,3bh,46h,96h,aeh
+			db	98h,13h,d9h,00h,c1h,a5h,52h,1fh
+			db	ach,d3h,52h,07h,4fh,80h,2ah,ech
+			db	abh,aeh,16h,21h,b2h,4ch,05h,2bh
+			db	3ch,c3h,bdh,11h,c3h,96h,68h,3eh
+			db	8dh,76h,f7h,51h,d8h,72h,59h,abh
+			db	57h,92h,0fh,0ah,24h,07h,64h,4bh
+			db	37h,3bh,94h,98h,76h,4bh,bfh,c3h
+			db	53h,5bh,9bh,06h,86h,aah,41h,85h
+			db	bch,96h,aeh,c2h,6bh,f0h,abh,8eh
+			db	3bh,d1h,beh,f3h,adh,13h,86h,00h
+			db	eah,23h,f5h,e5h,ach,38h,fbh,e1h
+			db	4ch,66h,bfh,51h,83h,a0h,71h,67h
+			db	84h,65h,32h,b7h,b6h,c9h,72h,ebh
+			db	b6h,c3h,d7h,feh,6ah,9dh,d9h,0ah
+			db	f2h,25h,81h,28h,3ah,4dh,8dh,76h
+			db	1fh,40h,9fh,2dh,97h,13h,47h,8fh
+			db	eah,8ah,93h,dbh,c6h,bdh,9dh,dbh
+			db	e5h,36h,b6h,04h,c1h,1fh,a0h,52h
+			db	6dh,ech,aah,06h,92h,05h,00h,03h
+			db	6dh,7dh,7ch,e1h,08h,1eh,68h,c7h
+			db	51h,53h,96h,adh,dfh,5eh,10h,69h
+			db	93h,c9h,89h,d6h,dch,03h,17h,7dh
+			db	10h,14h,19h,66h,11h,63h,fbh,beh
+			db	edh,f2h,7fh,0ch,aah,70h,5fh,c3h
+			db	7eh,eeh,5bh,e8h,e3h,76h,96h,cfh
+			db	eah,cdh,13h,62h,cbh,ceh,abh,95h
+			db	e9h,bch,c0h,d7h,deh,2bh,eeh,f5h
+			db	a9h,dah,b3h,05h,3ah,d6h,e9h,46h
+			db	41h,c8h,d6h,63h,67h,8bh,24h,69h
+			db	f5h,21h,02h,aah,cch,f1h,e7h,4dh
+			db	5ch,2ch,9fh,53h,a7h,02h,f1h,59h
+			db	06h,9ah,a4h,64h,9ah,76h,87h,e9h
+			db	a3h,cfh,36h,feh,deh,b4h,7fh,ffh
+			db	eah,72h,3ah,d0h,adh,9bh,97h,04h
+			db	b9h,2dh,69h,e3h,d1h,8ch,c8h,46h
+			db	fah,4ah,d0h,bah,c8h,71h,e2h,34h
+			db	19h,dbh,65h,95h,0ah,d8h,21h,3fh
+			db	dbh,0dh,51h,a1h,b6h,39h,88h,28h
+			db	75h,79h,45h,59h,45h,14h,abh,6dh
+			db	dah,44h,61h,51h,adh,03h,89h,25h
+			db	e3h,9eh,5bh,d6h,1fh,69h,e7h,d0h
+			db	feh,e7h,0eh,8dh,19h,a2h,1fh,1eh
+			db	5ch,48h,3eh,81h,45h,87h,cbh,9ch
+			db	b9h,f0h,67h,09h,19h,a2h,64h,deh
+			db	8ah,9ah,00h,93h,90h,bdh,8ch,1eh
+			db	12h,32h,73h,40h,f9h,8ch,dah,d5h
+			db	0ah,10h,c0h,f8h,35h,62h,17h,2dh
+			db	b1h,08h,2ah,dah,c4h,7ch,03h,33h
+			db	ffh,dch,18h,19h,3dh,43h,1fh,05h
+			db	aah,03h,0ch,c3h,c7h,adh,62h,15h
+			db	36h,8ah,33h,eeh,fbh,32h,aeh,78h
+			db	31h,92h,7fh,d5h,40h,d3h,20h,3dh
+			db	52h,e1h,6fh,09h,20h,ddh,c7h,8ah
+			db	62h,fbh,c7h,92h,52h,e0h,93h,a0h
+			db	1bh,2ch,46h,bdh,0eh,32h,2bh,69h
+			db	32h,0ah,1bh,4fh,9eh,71h,8ah,95h
+			db	6fh,99h,22h,5fh,75h,b6h,c8h,e5h
+			db	93h,cfh,a6h,64h,25h,91h,fch,8ah
+			db	24h,45h,d1h,f7h,19h,72h,22h,4bh
+			db	74h,04h,9fh,ebh,bdh,69h,07h,42h
+			db	08h,fbh,a1h,81h,4fh,5eh,6ah,06h
+			db	cch,afh,62h,c1h,74h,50h,c8h,2ch
+			db	8eh,04h,40h,afh,68h,f6h,35h,56h
+			db	5ch,49h,92h,ech,29h,f5h,76h,d7h
+			db	eeh,2ch,32h,e0h,1eh,43h,fdh,f3h
+			db	25h,d5h,8eh,dfh,d5h,44h,1ah,8ah
+			db	cfh,70h,4fh,afh,24h,75h,90h,06h
+			db	59h,90h,40h,dbh,6fh,22h,14h,76h
+			db	27h,b1h,cah,18h,9fh,37h,1ch,edh
+			db	ech,a6h,42h,c5h,e1h,99h,f5h,a5h
+			db	13h,1ch,2bh,c3h,e9h,98h,97h,0bh
+			db	ddh,7dh,24h,34h,e3h,beh,7bh,7fh
+			db	edh,f5h,72h,1bh,17h,92h,d0h,56h
+			db	8eh,20h,37h,d9h,91h,c7h,5ch,33h
+			db	8bh,58h,84h,bfh,55h,45h,15h,3eh
+			db	5bh,5ch,71h,86h,5ch,b5h,30h,1bh
+			db	3dh,92h,9dh,57h,8eh,0bh,4ah,f0h
+			db	d0h,bdh,4ch,e7h,02h,2ch,17h,dah
+			db	3ch,09h,23h,a0h,f0h,75h,a8h,7ah
+			db	aeh,ebh,4fh,c2h,81h,d1h,d8h,16h
+			db	ach,c1h,d1h,deh,cfh,f2h,99h,b8h
+			db	f7h,20h,6ah,89h,1ch,4dh,b1h,16h
+			db	14h,ech,03h,4eh,e1h,3ch,c2h,ddh
+			db	55h,d9h,0bh,63h,c7h,9bh,0dh,87h
+			db	85h,81h,3ch,6bh,25h,6fh,34h,c9h
+			db	58h,9ch,b7h,13h,6ah,f9h,cah,cdh
+			db	06h,feh,60h,fah,45h,dah,4fh,4ah
+			db	1dh,73h,3ah,e8h,75h,67h,3ch,12h
+			db	27h,e8h,c8h,efh,7bh,52h,83h,b7h
+			db	2fh,6eh,e6h,49h,5dh,39h,6bh,b9h
+			db	3dh,ceh,a1h,17h,75h,a9h,90h,74h
+			db	f0h,72h,49h,77h,85h,e0h,14h,e3h
+			db	8eh,13h,fch,b3h,2eh,1eh,0fh,deh
+			db	c7h,92h,b7h,b7h,1bh,4ch,0ah,a0h
+			db	20h,29h,91h,15h,02h,02h,11h,c4h
+			db	a4h,38h,00h,c2h,7bh,30h,44h,d7h
+			db	97h,86h,21h,72h,20h,11h,bah,80h
+			db	15h,0dh,3dh,d8h,20h,d5h,24h,77h
+			db	94h,eah,bbh,dbh,49h,b4h,02h,7eh
+			db	ebh,07h,6fh,04h,6ch,c2h,d0h,31h
+			db	07h,0fh,6fh,96h,3ch,94h,54h,86h
+			db	31h,dah,9fh,18h,4eh,68h,dch,c7h
+			db	38h,2fh,cbh,a5h,e8h,e0h,92h,38h
+			db	52h,2ch,09h,d5h,24h,78h,16h,70h
+			db	42h,d5h,95h,28h,f7h,f3h,04h,e9h
+			db	c7h,e2h,5fh,c0h,3ah,61h,62h,85h
+			db	a1h,1eh,7ah,fdh,00h,3eh,79h,c2h
+			db	62h,05h,21h,9eh,16h,16h,f3h,fch
+			db	60h,48h,9fh,c8h,76h,beh,54h,14h
+			db	1fh,6fh,cfh,d1h,86h,bch,04h,a3h
+			db	98h,e4h,61h,a6h,e5h,83h,59h,bdh
+			db	46h,f2h,98h,00h,c1h,09h,eah,5bh
+			db	73h,6dh,b1h,30h,f3h,5fh,d1h,9bh
+			db	02h,42h,84h,2ch,18h,7ah,d1h,6ch
+			db	84h,e5h,a3h,47h,19h,0bh,4dh,a3h
+			db	d1h,8dh,ceh,5eh,9bh,10h,04h,77h
+			db	92h,69h,63h,b8h,74h,4dh,3ch,18h
+			db	fdh,ceh,e5h,44h,29h,f0h,edh,6bh
+			db	6fh,08h,61h,97h,65h,b2h,bbh,1ch
+			db	05h,a5h,e2h,79h,9ah,26h,bch,f3h
+			db	b6h,feh,e5h,70h,01h,65h,67h,16h
+			db	55h,81h,9ah,89h,64h,1ah,adh,15h
+			db	1bh,12h,dch,beh,4eh,18h,37h,cfh
+			db	b9h,00h,51h,48h,22h,a6h,70h,72h
+			db	dah,15h,e9h,e1h,92h,69h,62h,42h
+			db	4ch,d2h,76h,dbh,1dh,44h,37h,cch
+			db	0eh,83h,d5h,33h,69h,80h,beh,7eh
+			db	19h,16h,ech,aeh,5dh,87h,51h,bdh
+			db	31h,a9h,53h,2bh,1fh,f1h,aah,feh
+			db	70h,47h,63h,d9h,28h,a2h,96h,dbh
+			db	aeh,58h,17h,38h,5bh,4ch,99h,4bh
+			db	4eh,17h,e2h,8fh,46h,72h,19h,38h
+			db	3ah,42h,63h,23h,0bh,61h,e8h,7fh
+			db	9dh,6eh,38h,a8h,efh,6bh,edh,b8h
+			db	61h,a1h,ech,e0h,d4h,60h,7ah,24h
+			db	1fh,01h,1fh,e1h,2dh,5ch,cch,d6h
+			db	b5h,fdh,00h,34h,16h,d5h,3eh,67h
+			db	b9h,19h,47h,16h,8bh,3fh,2ch,ddh
+			db	d2h,84h,efh,27h,a6h,64h,36h,33h
+			db	d2h,3ah,2bh,5ah,38h,f6h,19h,9bh
+			db	bfh,03h,9ch,7dh,32h,7dh,49h,afh
+			db	fah,65h,dch,33h,33h,bdh,e7h,0ch
+			db	e3h,6ch,bbh,55h,50h,42h,b0h,f0h
+			db	aeh,78h,1ah,7eh,aeh,22h,58h,eeh
+			db	bch,81h,ebh,eeh,d9h,fah,3dh,e2h
+			db	76h,9ch,cch,4ch,d7h,3fh,a7h,41h
+			db	c9h,6bh,34h,9eh,61h,30h,f4h,a9h
+			db	8ch,83h,47h,06h,07h,55h,83h,c8h
+			db	e7h,2ah,01h,e1h,a9h,12h,1ah,b9h
+			db	46h,1eh,22h,86h,2bh,8eh,c5h,b4h
+			db	36h,afh,beh,33h,8ah,b1h,d4h,16h
+			db	ffh,29h,b5h,0eh,8dh,06h,16h,07h
+			db	0ah,c1h,51h,57h,06h,08h,a4h,a4h
+			db	80h,88h,f2h,bfh,91h,a4h,42h,82h
+			db	6bh,45h,e3h,7bh,beh,57h,98h,3bh
+			db	12h,beh,24h,84h,7ch,18h,20h,fch
+			db	cch,f0h,a1h,abh,abh,1dh,4bh,68h
+			db	86h,97h,a0h,3ah,c0h,eah,1fh,d7h
+			db	7ch,92h,8fh,7ah,74h,eah,efh,5ah
+			db	14h,e0h,6dh,7ch,bfh,1dh,f8h,2ch
+			db	b0h,c1h,31h,36h,edh,2eh,35h,b6h
+			db	5fh,37h,50h,adh,9ah,69h,e7h,9fh
+			db	07h,b7h,a5h,37h,e7h,54h,28h,7ah
+			db	f6h,6bh,28h,d6h,77h,d5h,23h,17h
+			db	6ch,e1h,d1h,15h,1dh,3dh,9dh,01h
+			db	5fh,57h,bch,61h,79h,e1h,80h,bbh
+			db	3eh,bbh,4fh,56h,6bh,e9h,20h,afh
+			db	5eh,1ah,2ah,40h,ceh,48h,19h,e7h
+			db	34h,70h,92h,deh,c2h,9dh,b3h,deh
+			db	04h,43h,bbh,b6h,42h,6ch,3ah,17h
+			db	37h,76h,24h,11h,e5h,74h,ach,08h
+			db	afh,e7h,6ah,98h,15h,05h,26h,26h
+			db	95h,07h,73h,f4h,66h,f5h,a9h,e7h
+			db	85h,4ah,86h,55h,09h,eeh,fbh,35h
+			db	46h,d3h,20h,bfh,deh,49h,24h,39h
+			db	d4h,76h,65h,54h,a1h,a7h,a1h,14h
+			db	7dh,afh,10h,57h,f5h,03h,11h,14h
+			db	51h,96h,fah,f7h,e7h,0dh,76h,cdh
+			db	03h,17h,54h,6dh,48h,35h,62h,1ch
+			db	fch,00h,6dh,43h,9ch,57h,6bh,cfh
+			db	6dh,d8h,24h,bah,31h,5dh,84h,6bh
+			db	b8h,56h,36h,90h,fch,eah,7eh,c1h
+			db	a5h,9dh,ceh,c9h,3bh,85h,bah,89h
+			db	5eh,1ch,98h,2fh,20h,15h,72h,b4h
+			db	efh,e3h,c2h,09h,62h,4eh,56h,cfh
+			db	e2h,24h,57h,19h,beh,1dh,76h,47h
+			db	d5h,87h,49h,d9h,89h,32h,a7h,2dh
+			db	c4h,29h,f8h,8ch,73h,94h,99h,bch
+			db	cbh,bbh,29h,3ah,1ah,38h,8bh,1fh
+			db	d4h,24h,57h,15h,47h,c2h,76h,7dh
+			db	fdh,54h,deh,46h,39h,39h,61h,a3h
+			db	08h,7eh,2bh,b7h,ech,65h,a6h,82h
+			db	8dh,73h,c6h,fdh,87h,50h,03h,6dh
+			db	88h,ebh,8bh,90h,f3h,e5h,82h,67h
+			db	b3h,b0h,a3h,21h,b9h,c1h,d8h,10h
+			db	55h,97h,a2h,d9h,aah,10h,9eh,9bh
+			db	90h,25h,a1h,f3h,80h,cbh,2fh,60h
+			db	42h,60h,88h,75h,16h,19h,41h,d6h
+			db	28h,cah,bdh,ffh,7bh,aeh,f2h,aeh
+			db	e4h,17h,26h,87h,a8h,c6h,a3h,69h
+			db	d2h,bah,88h,26h,63h,d8h,91h,8dh
+			db	3ah,f6h,33h,a7h,e1h,b5h,8dh,29h
+			db	a2h,edh,22h,5eh,1ah,edh,cdh,1ah
+			db	0ch,a6h,0ch,eah,59h,f8h,5dh,5dh
+			db	2ah,7bh,7bh,f6h,bbh,7ch,b1h,4ch
+			db	35h,bdh,39h,a5h,d1h,9dh,16h,ddh
+			db	09h,49h,1eh,c4h,65h,0eh,17h,44h
+			db	5eh,70h,8ch,74h,72h,07h,81h,ech
+			db	07h,20h,d8h,eah,a1h,a0h,26h,3eh
+			db	1eh,e5h,7ah,08h,43h,38h,9bh,6eh
+			db	1bh,88h,aeh,fch,d8h,85h,a1h,c3h
+			db	3ch,40h,bfh,11h,5ch,88h,fdh,1ah
+			db	52h,9dh,dch,bch,ffh,18h,cah,3dh
+			db	49h,1bh,4fh,17h,d3h,a3h,58h,b2h
+			db	eah,3ah,b0h,f6h,67h,29h,bbh,49h
+			db	72h,f4h,4fh,03h,41h,91h,dch,eeh
+			db	0bh,61h,01h,35h,9fh,3dh,e7h,afh
+			db	94h,7ah,ach,d1h,c7h,a3h,37h,d8h
+			db	bah,deh,74h,0bh,c2h,0bh,8ah,ech
+			db	34h,57h,9ch,cch,3eh,6bh,e7h,4ch
+			db	38h,abh,8dh,f6h,efh,cah,18h,eah
+			db	bch,aah,bah,0dh,86h,d9h,e3h,8bh
+			db	ddh,22h,d1h,96h,2ch,f7h,67h,7bh
+			db	49h,66h,0ah,50h,23h,e9h,40h,20h
+			db	96h,d3h,07h,b8h,24h,ach,2fh,4ch
+			db	61h,a3h,d6h,91h,95h,86h,a8h,57h
+			db	b7h,8fh,b1h,80h,01h,4ch,64h,69h
+			db	08h,76h,4ch,b5h,cbh,aeh,78h,dah
+			db	98h,2ah,10h,99h,c0h,b2h,b9h,16h
+			db	d7h,cch,05h,95h,eeh,0eh,7dh,e9h
+			db	cfh,8bh,03h,6bh,a3h,f6h,afh,54h
+			db	95h,a6h,b3h,78h,bdh,39h,dah,4eh
+			db	aah,f6h,7bh,4dh,fah,28h,50h,e7h
+			db	15h,ech,e2h,15h,bdh,e2h,9eh,bch
+			db	0eh,ffh,f8h,23h,e0h,14h,09h,b0h
+			db	2fh,7dh,61h,eah,ech,efh,d3h,88h
+			db	2eh,12h,d1h,1ch,b9h,3bh,74h,39h
+			db	eah,54h,a2h,53h,7fh,95h,7dh,f0h
+			db	40h,58h,7eh,0bh,0ch,b8h,5eh,54h
+			db	d6h,d3h,3bh,61h,f9h,4fh,58h,03h
+			db	d8h,abh,a2h,bah,b1h,ebh,f6h,71h
+			db	78h,63h,7dh,f5h,66h,a8h,26h,b5h
+			db	66h,8dh,19h,efh,6ch,dfh,1fh,36h
+			db	6ch,a0h,5bh,c7h,7ch,bfh,68h,70h
+			db	f6h,f9h,6fh,65h,e3h,a9h,e0h,d4h
+			db	19h,28h,3eh,0eh,33h,ebh,0bh,17h
+			db	1dh,32h,2dh,c2h,a8h,abh,65h,fch
+			db	ech,bbh,c4h,0ah,7ah,61h,05h,58h
+			db	32h,ffh,c9h,edh,50h,64h,0dh,0eh
+			db	9ch,06h,54h,3fh,adh,45h,b4h,b2h
+			db	a4h,16h,bah,01h,fch,d4h,9ah,8ah
+			db	d9h,9ah,19h,aeh,1fh,8dh,06h,fah
+			db	89h,35h,5bh,e5h,b3h,72h,3dh,b2h
+			db	dah,75h,aah,27h,ddh,3ah,bah,2ah
+			db	62h,67h,48h,40h,8fh,48h,12h,eeh
+			db	feh,0ch,7ch,88h,b1h,32h,d3h,05h
+			db	99h,aeh,18h,b6h,bdh,2bh,53h,f8h
+			db	95h,63h,0bh,e3h,53h,3dh,f8h,09h
+			db	46h,94h,bbh,e9h,c9h,95h,e7h,cbh
+			db	b0h,ech,4bh,ach,22h,92h,92h,92h
+			db	fbh,5fh,1ah,6fh,09h,23h,beh,25h
+			db	d8h,9ah,09h,b6h,25h,49h,2ch,f9h
+			db	90h,83h,17h,74h,2ah,5fh,bbh,ffh
+			db	1ah,76h,5ch,41h,1dh,39h,52h,78h
+			db	a3h,e0h,aeh,d1h,c7h,e7h,31h,8fh
+			db	f0h,b0h,bfh,c2h,39h,87h,18h,f4h
+			db	5fh,40h,94h,20h,e2h,adh,79h,9ch
+			db	4ah,1eh,06h,49h,4dh,2bh,f5h,edh
+			db	06h,eah,39h,5dh,b1h,dbh,dfh,84h
+			db	92h,87h,4eh,d6h,e5h,09h,28h,42h
+			db	d8h,d1h,1ah,e1h,f9h,fah,18h,70h
+			db	bdh,dbh,56h,04h,6ch,edh,2fh,1dh
+			db	91h,f7h,5eh,cdh,f4h,cbh,b5h,2ah
+			db	b8h,f4h,1ch,52h,a5h,0ah,23h,4fh
+			db	e4h,76h,40h,d3h,98h,38h,57h,7ch
+			db	f9h,97h,beh,6dh,e4h,9eh,1dh,ach
+			db	63h,dah,12h,eah,cdh,18h,79h,6eh
+			db	5dh,32h,12h,56h,d8h,6fh,8ch,3ah
+			db	95h,97h,4bh,97h,dfh,c0h,dch,a2h
+			db	d3h,49h,49h,1bh,70h,65h,8ah,37h
+			db	ceh,87h,14h,eeh,62h,d4h,32h,d1h
+			db	5ch,bch,79h,00h,85h,35h,ech,37h
+			db	b1h,2dh,e1h,1dh,c5h,f0h,14h,37h
+			db	36h,c9h,fch,76h,aeh,fbh,eeh,eah
+			db	aeh,36h,d2h,c9h,4ch,67h,33h,2bh
+			db	fch,f2h,cah,2bh,f5h,51h,14h,e1h
+			db	0fh,ffh,90h,eah,51h,5dh,2eh,5dh
+			db	f2h,d1h,7ch,73h,53h,bbh,dfh,ceh
+			db	8eh,36h,37h,38h,d5h,89h,a1h,d4h
+			db	ddh,93h,90h,f9h,d5h,5dh,feh,9ch
+			db	2dh,e8h,a8h,c1h,f2h,5ah,67h,71h
+			db	76h,dfh,69h,8ch,73h,0eh,9dh,28h
+			db	8ch,cfh,77h,9fh,3fh,07h,24h,63h
+			db	fdh,1eh,f5h,44h,c4h,ebh,1dh,57h
+			db	55h,7bh,3eh,15h,c9h,18h,d7h,5fh
+			db	60h,e1h,d8h,eah,5eh,bdh,8bh,ffh
+			db	e9h,adh,f5h,12h,21h,bbh,beh,eeh
+			db	6bh,a6h,e0h,20h,6eh,12h,64h,dch
+			db	a2h,0eh,bdh,04h,d5h,52h,d0h,6bh
+			db	9eh,64h,f5h,1fh,ffh,f5h,90h,bah
+			db	69h,05h,e3h,45h,72h,38h,3ch,34h
+			db	12h,6eh,0bh,bbh,a4h,29h,c8h,82h
+			db	06h,2eh,87h,6dh,e5h,52h,07h,fch
+			db	58h,c4h,bbh,68h,8ah,4ch,a1h,33h
+			db	31h,5dh,ceh,aah,36h,11h,13h,5eh
+			db	e8h,4ch,96h,ffh,86h,2ah,39h,65h
+			db	33h,d3h,6ah,cfh,24h,f5h,4bh,85h
+			db	f0h,50h,83h,2eh,85h,0fh,66h,eeh
+			db	56h,a6h,cfh,d7h,c7h,ceh,26h,12h
+			db	4eh,fdh,afh,32h,76h,c2h,5eh,6eh
+			db	a2h,1ch,5ch,7dh,95h,d3h,f3h,3fh
+			db	3fh,06h,12h,f7h,fah,58h,3eh,5dh
+			db	f8h,e3h,5fh,e3h,beh,3dh,05h,c4h
+			db	1dh,aeh,f3h,7bh,a8h,23h,aeh,13h
+			db	68h,07h,16h,dbh,05h,7ch,c9h,29h
+			db	c0h,01h,8bh,c5h,d7h,74h,edh,a0h
+			db	e7h,ach,87h,32h,f5h,9bh,6ah,3eh
+			db	74h,aeh,8bh,9fh,9bh,e9h,07h,81h
+			db	17h,67h,77h,96h,69h,05h,34h,a5h
+			db	3bh,2ah,e8h,a4h,02h,52h,6eh,f2h
+			db	6ch,43h,71h,b7h,6bh,a4h,dfh,23h
+			db	22h,5dh,b6h,bbh,0ah,5bh,05h,8eh
+			db	81h,99h,3ch,2eh,5ch,0fh,40h,39h
+			db	c4h,80h,9fh,66h,40h,d0h,76h,60h
+			db	84h,76h,5ah,86h,6eh,f2h,9fh,26h
+			db	60h,b6h,f7h,9ch,99h,9ah,10h,c6h
+			db	61h,b7h,c1h,53h,2bh,edh,5ch,9fh
+			db	f7h,c0h,3fh,ffh,25h,e2h,beh,2ch
+			db	72h,6eh,eeh,9fh,07h,e8h,78h,94h
+			db	d9h,b8h,16h,5eh,d2h,72h,5ah,7ch
+			db	9ah,17h,43h,f7h,5ch,83h,a3h,b7h
+			db	d5h,72h,89h,58h,beh,01h,72h,a5h
+			db	0dh,72h,a9h,25h,c4h,3fh,cdh,7bh
+			db	79h,aah,9eh,bch,7fh,ach,43h,d4h
+			db	26h,abh,66h,36h,a6h,9bh,6fh,a1h
+			db	4fh,31h,8ch,89h,eeh,99h,24h,08h
+			db	f1h,63h,3bh,beh,b6h,feh,eah,7ah
+			db	2ch,6eh,16h,64h,1dh,d0h,adh,feh
+			db	8bh,9bh,d9h,adh,bch,44h,dch,32h
+			db	01h,ach,3dh,97h,feh,bfh,87h,b2h
+			db	0fh,0dh,18h,3fh,2dh,3bh,b1h,81h
+			db	75h,11h,6ch,97h,18h,a6h,2bh,38h
+			db	31h,e0h,11h,ech,6dh,0dh,d0h,09h
+			db	e2h,26h,e5h,85h,11h,c8h,82h,6bh
+			db	4bh,d7h,4dh,33h,48h,d0h,93h,46h
+			db	80h,d6h,cah,26h,83h,fah,9ch,a8h
+			db	cah,e5h,edh,a4h,4eh,cfh,96h,ach
+			db	03h,bdh,4fh,f2h,6ch,08h,1fh,01h
+			db	cdh,47h,3fh,e4h,f8h,7ah,07h,0ah
+			db	e4h,57h,d8h,89h,edh,3dh,00h,c6h
+			db	1ch,80h,40h,d2h,0fh,b1h,8fh,feh
+			db	beh,47h,feh,36h,20h,69h,49h,41h
+			db	86h,ech,ddh,71h,35h,68h,55h,6ch
+			db	48h,7ah,3bh,8eh,b9h,6dh,90h,d9h
+			db	98h,d3h,47h,5ah,8eh,a3h,53h,edh
+			db	14h,8eh,fbh,20h,80h,6dh,cah,fah
+			db	d3h,e7h,44h,18h,36h,13h,deh,84h
+			db	1ah,b1h,ffh,8ah,e5h,1fh,16h,61h
+			db	08h,7ah,06h,7ah,5fh,2dh,4bh,a9h
+			db	90h,fbh,20h,9fh,a9h,6fh,54h,51h
+			db	98h,bbh,2bh,33h,48h,91h,10h,beh
+			db	2ah,ceh,3ch,cfh,b2h,37h,81h,c2h
+			db	99h,0eh,05h,f7h,bah,c5h,79h,cah
+			db	d6h,7ah,82h,d2h,9ch,beh,cfh,0ch
+			db	cfh,cch,cah,beh,95h,c0h,74h,a7h
+			db	94h,34h,65h,fch,a8h,afh,0eh,66h
+			db	3ah,9ch,4fh,8ch,0ch,2ch,fah,54h
+			db	82h,9ch,4bh,5bh,2eh,a8h,e6h,52h
+			db	8bh,c6h,20h,25h,8fh,09h,d9h,02h
+			db	dch,30h,02h,47h,fdh,6fh,53h,2eh
+			db	e4h,21h,62h,d3h,cah,01h,f0h,40h
+			db	33h,77h,08h,0bh,7ch,bbh,fbh,4ah
+			db	49h,40h,b8h,dbh,f6h,27h,a9h,19h
+			db	24h,37h,1fh,f8h,77h,bch,e4h,f3h
+			db	64h,a2h,c4h,c8h,9ah,72h,70h,77h
+			db	62h,44h,f8h,76h,80h,3ch,74h,ddh
+			db	49h,62h,86h,89h,efh,f8h,21h,c1h
+			db	bbh,9fh,ech,6bh,d5h,9ch,a1h,88h
+			db	18h,d3h,01h,66h,a3h,4ch,1ch,42h
+			db	aeh,9bh,bdh,d9h,fdh,d0h,4eh,87h
+			db	17h,c5h,e3h,74h,3eh,a2h,d7h,6dh
+			db	d0h,1bh,f5h,f5h,58h,57h,d3h,4dh
+			db	93h,0eh,35h,64h,f3h,3eh,76h,dfh
+			db	9eh,4bh,8ch,63h,74h,a5h,09h,1fh
+			db	5fh,f2h,bbh,5ah,b0h,deh,bah,56h
+			db	68h,ffh,a5h,62h,6ah,e0h,13h,ech
+			db	19h,a1h,43h,94h,75h,55h,beh,ebh
+			db	74h,40h,6bh,adh,30h,84h,5eh,5ch
+			db	7bh,63h,0dh,3eh,6ah,a5h,c9h,06h
+			db	e2h,15h,c8h,5ah,dfh,6bh,f7h,62h
+			db	09h,b3h,c4h,8ah,d5h,6ah,eeh,24h
+			db	97h,4eh,34h,a1h,66h,14h,b9h,5bh
+			db	39h,42h,a2h,bfh,39h,41h,3ch,c3h
+			db	2eh,b2h,f9h,deh,1dh,8bh,beh,c1h
+			db	62h,b8h,7ch,0fh,f1h,adh,15h,deh
+			db	ceh,5fh,46h,adh,0eh,c4h,f8h,b3h
+			db	abh,f7h,61h,98h,31h,81h,c0h,2fh
+			db	2fh,80h,eeh,aah,2eh,73h,9ch,cfh
+			db	ach,fbh,12h,86h,85h,a4h,81h,8dh
+			db	d2h,5eh,80h,78h,fah,58h,0eh,3fh
+			db	dah,03h,16h,34h,a6h,93h,26h,94h
+			db	24h,8bh,a7h,aeh,e6h,f9h,e8h,76h
+			db	90h,eah,c8h,a9h,e6h,a1h,28h,2ch
+			db	d5h,6dh,8ch,e9h,92h,e1h,3dh,c3h
+			db	35h,56h,59h,5fh,a6h,bfh,cbh,abh
+			db	a8h,5fh,ceh,1bh,cch,5bh,8bh,d9h
+			db	a1h,90h,a0h,52h,b2h,3eh,06h,81h
+			db	46h,06h,c5h,e2h,04h,eah,a1h,7dh
+			db	65h,d8h,4dh,10h,3dh,e1h,9bh,2ah
+			db	86h,2dh,b5h,5fh,7ah,cfh,39h,68h
+			db	93h,18h,96h,beh,bfh,1ah,37h,08h
+			db	49h,9bh,7dh,52h,c8h,0dh,79h,5bh
+			db	65h,02h,cdh,94h,1eh,7ah,63h,13h
+			db	3dh,0eh,6ah,11h,81h,9eh,2ch,33h
+			db	6ah,06h,35h,18h,21h,7ch,25h,79h
+			db	9eh,2ch,0ah,fbh,c0h,76h,9ah,17h
+			db	87h,43h,43h,57h,57h,22h,a3h,17h
+			db	05h,67h,a3h,5fh,73h,9eh,e3h,a4h
+			db	efh,44h,9eh,a5h,b0h,7bh,98h,f0h
+			db	0dh,06h,b0h,88h,29h,2bh,1bh,fch
+			db	70h,62h,32h,1eh,dch,b2h,1ch,6fh
+			db	16h,e1h,ech,03h,84h,76h,d7h,0fh
+			db	6ch,60h,a4h,7eh,feh,2ah,3eh,03h
+			db	8dh,ach,d4h,46h,8eh,20h,12h,61h
+			db	7bh,f6h,ffh,c9h,dfh,0dh,6bh,25h
+			db	c1h,2ah,c3h,45h,b9h,42h,f1h,0dh
+			db	d0h,2ah,66h,8eh,90h,20h,5ch,27h
+			db	57h,28h,6eh,15h,ffh,88h,9dh,39h
+			db	66h,84h,28h,5bh,98h,2ch,ffh,cbh
+			db	2fh,64h,a1h,e9h,58h,b9h,4eh,39h
+			db	6dh,a0h,ebh,a0h,d2h,09h,65h,5ah
+			db	bfh,41h,bah,38h,31h,9fh,18h,3ah
+			db	d3h,29h,9ch,65h,f4h,76h,37h,43h
+			db	4dh,a9h,a1h,99h,f2h,88h,16h,d3h
+			db	b0h,e9h,2ch,bah,30h,04h,eeh,f0h
+			db	88h,82h,3ch,68h,9ah,61h,edh,bdh
+			db	b4h,a9h,83h,c0h,7dh,06h,94h,c3h
+			db	2ah,9ah,85h,3ah,e9h,ebh,fah,6ch
+			db	f1h,1bh,12h,06h,a1h,44h,18h,6bh
+			db	7eh,fdh,a4h,48h,b1h,bbh,61h,19h
+			db	c3h,23h,fch,4dh,07h,9fh,60h,27h
+			db	12h,7fh,04h,33h,98h,e4h,31h,81h
+			db	e3h,d4h,6ch,96h,ddh,deh,a4h,46h
+			db	2bh,0ah,05h,43h,10h,6ah,9fh,33h
+			db	86h,d9h,76h,2eh,f9h,fbh,e8h,56h
+			db	56h,6dh,cfh,e2h,d4h,7ah,f1h,5eh
+			db	b7h,e8h,9ch,f3h,3eh,f2h,dah,b9h
+			db	dah,35h,7eh,d9h,4fh,f9h,28h,35h
+			db	d9h,a9h,56h,37h,3bh,0ch,9ah,25h
+			db	ebh,e0h,c5h,b8h,4ah,06h,51h,28h
+			db	33h,92h,5ch,8ah,bch,45h,5dh,77h
+			db	f6h,a5h,54h,36h,f3h,ddh,e2h,56h
+			db	32h,e2h,d0h,aah,ddh,c6h,c0h,a7h
+			db	e4h,93h,7bh,d5h,f2h,a5h,93h,dbh
+			db	f4h,80h,a8h,90h,59h,abh,ddh,d1h
+			db	73h,d5h,96h,81h,1ah,14h,d3h,6bh
+			db	a4h,a2h,cbh,c6h,97h,1bh,e8h,89h
+			db	d4h,21h,e0h,efh,37h,75h,33h,14h
+			db	81h,60h,80h,8ah,09h,15h,15h,6fh
+			db	4ch,42h,9bh,74h,33h,30h,1ch,c1h
+			db	38h,91h,62h,c2h,c3h,35h,b5h,f7h
+			db	d8h,2ch,4bh,93h,2eh,2dh,85h,73h
+			db	a2h,a4h,cbh,7eh,ech,89h,8bh,f7h
+			db	d8h,34h,edh,39h,16h,bbh,1fh,b3h
+			db	29h,c7h,efh,19h,eeh,3ah,4bh,bfh
+			db	7dh,20h,51h,90h,87h,8ch,ach,1ch
+			db	deh,6ah,8fh,92h,3bh,c3h,46h,91h
+			db	dbh,9ah,24h,bah,f0h,4ch,75h,19h
+			db	96h,80h,2eh,2eh,99h,89h,86h,63h
+			db	32h,a3h,0ah,83h,2dh,43h,bfh,ebh
+			db	b3h,a6h,0dh,72h,3fh,e4h,00h,5fh
+			db	cah,d2h,35h,a7h,beh,40h,08h,e7h
+			db	05h,08h,cch,b6h,2dh,58h,41h,7ah
+			db	bdh,64h,9ch,58h,42h,eah,3ch,cch
+			db	a3h,6dh,93h,2fh,a4h,98h,29h,48h
+			db	0eh,1bh,7ah,5fh,0bh,19h,38h,84h
+			db	74h,cdh,18h,5fh,60h,1eh,4dh,bfh
+			db	dah,07h,46h,8eh,f3h,fbh,b1h,32h
+			db	8bh,58h,5eh,0bh,08h,a7h,18h,5ch
+			db	0eh,81h,f4h,f5h,4ch,bdh,70h,c1h
+			db	40h,08h,bbh,c5h,8fh,13h,17h,13h
+			db	fah,8dh,3dh,27h,95h,afh,5ch,03h
+			db	3eh,27h,a4h,b8h,f5h,bch,e7h,c6h
+			db	f2h,03h,36h,d6h,f6h,e6h,6ah,69h
+			db	68h,bfh,27h,22h,c1h,77h,f6h,31h
+			db	87h,d8h,92h,15h,81h,30h,d0h,9ah
+			db	87h,04h,19h,aah,f7h,4ch,24h,57h
+			db	51h,0ah,0dh,02h,34h,9dh,67h,1eh
+			db	4fh,feh,3ch,61h,58h,9fh,2fh,0dh
+			db	20h,04h,12h,e3h,8bh,7bh,ffh,9fh
+			db	ceh,35h,21h,28h,2fh,2bh,d3h,7ah
+			db	f3h,3ah,c6h,89h,fbh,30h,dbh,8eh
+			db	48h,9fh,61h,1bh,95h,32h,36h,75h
+			db	6eh,4bh,bdh,81h,f0h,26h,2fh,2ah
+			db	63h,d5h,d3h,0ah,6fh,7fh,4bh,abh
+			db	f1h,44h,dch,84h,e1h,32h,bah,71h
+			db	eeh,fdh,c7h,cah,e6h,cah,9bh,bah
+			db	d3h,d5h,61h,48h,4fh,48h,85h,1eh
+			db	2ah,bfh,79h,fch,04h,61h,1eh,09h
+			db	b5h,70h,83h,d2h,3dh,f8h,45h,7ah
+			db	1ah,e5h,afh,b2h,59h,32h,d8h,45h
+			db	90h,8fh,6eh,78h,a3h,67h,60h,33h
+			db	62h,f5h,f9h,83h,2eh,f1h,cbh,8ch
+			db	5dh,1bh,60h,fbh,82h,d8h,71h,64h
+			db	07h,61h,bch,15h,92h,2dh,36h,2bh
+			db	67h,a6h,adh,f4h,a9h,65h,01h,38h
+			db	57h,92h,65h,94h,6fh,31h,d7h,6eh
+			db	cah,56h,2dh,e0h,ech,a5h,5fh,c5h
+			db	8ch,05h,d0h,f9h,36h,f8h,69h,04h
+			db	99h,a6h,09h,ceh,9ch,b0h,aeh,ebh
+			db	7ch,e5h,64h,23h,55h,37h,00h,ddh
+			db	edh,04h,04h,b2h,deh,0bh,00h,adh
+			db	bah,72h,ebh,3ch,b5h,44h,21h,deh
+			db	b7h,cdh,2eh,97h,2eh,94h,51h,7fh
+			db	64h,f2h,72h,11h,40h,e7h,20h,30h
+			db	48h,25h,bfh,3eh,7dh,bfh,a6h,07h
+			db	77h,24h,c3h,57h,d4h,01h,07h,bfh
+			db	dbh,c4h,a8h,87h,06h,6ch,13h,32h
+			db	b8h,ach,39h,4ch,78h,50h,16h,69h
+			db	dbh,41h,d7h,5ah,6eh,61h,76h,25h
+			db	46h,d7h,02h,adh,9ah,91h,30h,8bh
+			db	3eh,86h,7ch,36h,dah,ebh,8dh,4dh
+			db	0ch,dah,dch,0fh,b3h,72h,a2h,60h
+			db	46h,75h,4ah,79h,49h,55h,57h,15h
+			db	b4h,ach,9ah,06h,c0h,5fh,4fh,1fh
+			db	81h,85h,d5h,e5h,b2h,bfh,a0h,b1h
+			db	85h,6ch,dch,99h,e5h,cch,dbh,89h
+			db	b0h,19h,78h,0fh,73h,3fh,5dh,5ah
+			db	2eh,67h,fdh,e8h,8dh,44h,a3h,78h
+			db	a8h,7dh,dfh,2ch,6ch,90h,83h,1dh
+			db	a6h,01h,73h,c4h,58h,5bh,16h,e1h
+			db	7ah,c3h,b9h,19h,1ah,9dh,f2h,f3h
+			db	27h,a2h,bfh,cdh,18h,a9h,21h,73h
+			db	88h,f2h,f9h,fbh,e8h,89h,ddh,ech
+			db	4bh,dbh,6ch,0bh,d0h,7bh,31h,60h
+			db	afh,74h,82h,65h,98h,8ah,e5h,71h
+			db	adh,d6h,98h,b0h,3eh,21h,6fh,73h
+			db	72h,adh,5ch,5bh,21h,15h,d9h,09h
+			db	f7h,03h,85h,e0h,ech,fbh,64h,82h
+			db	63h,c9h,9eh,8bh,2ch,8ah,99h,c7h
+			db	6dh,70h,d9h,c0h,e2h,70h,a3h,dch
+			db	3bh,17h,12h,9ah,29h,eeh,ceh,bfh
+			db	fbh,24h,a6h,31h,2eh,56h,d4h,cbh
+			db	bbh,01h,24h,2eh,6ch,b8h,23h,b6h
+			db	64h,82h,cfh,e0h,d9h,48h,dfh,0eh
+			db	9eh,cfh,55h,63h,e9h,63h,eah,b6h
+			db	f8h,38h,56h,07h,42h,d8h,84h,99h
+			db	08h,67h,32h,2ch,4fh,2ch,d5h,efh
+			db	16h,b5h,28h,64h,50h,c7h,8ah,b3h
+			db	1ah,2ah,67h,0bh,6bh,9bh,c0h,0ah
+			db	e8h,9bh,8ah,08h,5fh,6ch,eeh,f1h
+			db	48h,feh,c2h,02h,7dh,0fh,0bh,abh
+			db	68h,40h,62h,edh,93h,86h,68h,1dh
+			db	ceh,afh,fbh,f8h,71h,dch,c8h,b9h
+			db	c9h,efh,a4h,42h,c3h,b4h,17h,00h
+			db	a3h,bah,f3h,03h,47h,5ah,67h,6dh
+			db	39h,b9h,8eh,dbh,2eh,bch,46h,ffh
+			db	98h,49h,18h,ceh,dfh,2bh,31h,72h
+			db	e5h,44h,aeh,32h,d9h,7dh,d1h,90h
+			db	d7h,fch,feh,94h,74h,06h,6ch,efh
+			db	5ah,e5h,5dh,dah,a8h,aah,14h,ceh
+			db	3ah,32h,cdh,66h,e2h,66h,7fh,16h
+			db	63h,43h,11h,9bh,a7h,5fh,bch,8fh
+			db	62h,06h,21h,04h,9ah,12h,dch,2dh
+			db	9bh,95h,fch,78h,5ah,cch,3bh,36h
+			db	bdh,01h,a6h,36h,14h,43h,0fh,4bh
+			db	9bh,81h,aah,93h,c7h,25h,ffh,eeh
+			db	f7h,2ah,0ah,5ah,5fh,92h,5bh,d4h
+			db	b1h,c8h,8fh,bfh,ceh,8eh,e4h,c7h
+			db	61h,7ah,a0h,cdh,06h,cch,ebh,09h
+			db	a3h,abh,21h,46h,38h,12h,feh,4bh
+			db	b3h,04h,49h,94h,bbh,74h,b0h,63h
+			db	f1h,b4h,2fh,ddh,13h,19h,f8h,5dh
+			db	64h,4dh,09h,92h,7bh,1ch,7ah,9bh
+			db	bfh,8dh,a2h,42h,bbh,68h,c0h,c6h
+			db	59h,d6h,78h,b9h,13h,29h,c8h,16h
+			db	c5h,1eh,edh,94h,a1h,26h,d1h,4bh
+			db	85h,94h,9bh,70h,4ch,d5h,f7h,e8h
+			db	4ah,83h,53h,d7h,81h,51h,60h,71h
+			db	41h,e9h,18h,91h,0fh,54h,39h,40h
+			db	bah,c5h,dfh,b0h,cdh,0ch,36h,9fh
+			db	b7h,1fh,38h,3ch,43h,91h,88h,84h
+			db	2ch,d4h,76h,18h,9bh,d7h,2ch,eah
+			db	97h,4ch,6bh,56h,60h,34h,31h,b2h
+			db	01h,e0h,63h,2ch,e0h,f2h,40h,ach
+			db	e2h,69h,b9h,8bh,dbh,b2h,20h,2eh
+			db	a6h,a4h,eeh,4eh,37h,72h,e7h,11h
+			db	6fh,dfh,13h,ach,e9h,aah,e5h,7ch
+			db	c9h,e0h,30h,69h,04h,e1h,44h,f7h
+			db	1ah,7dh,40h,38h,f2h,bdh,fah,88h
+			db	a9h,66h,12h,47h,2dh,cfh,f7h,adh
+			db	94h,15h,ech,78h,91h,ceh,d6h,1ah
+			db	a1h,61h,42h,12h,31h,5bh,5bh,4fh
+			db	6eh,03h,4eh,9eh,d7h,3dh,69h,8ah
+			db	41h,c2h,1bh,aeh,07h,79h,25h,bch
+			db	a6h,cbh,93h,9bh,0bh,4ah,7bh,1bh
+			db	11h,0bh,e3h,f8h,83h,38h,07h,a8h
+			db	22h,93h,e5h,43h,d6h,ach,30h,8ch
+			db	a8h,fdh,29h,5ch,33h,24h,1bh,c4h
+			db	e4h,18h,f0h,97h,30h,6ch,f0h,cfh
+			db	24h,4fh,1eh,9dh,3ah,27h,04h,7ch
+			db	0eh,8ah,a6h,3eh,17h,18h,b1h,9ah
+			db	c0h,58h,b7h,20h,cfh,69h,d4h,a8h
+			db	23h,8fh,cdh,17h,93h,b2h,5dh,2ch
+			db	23h,37h,e3h,f9h,81h,1ch,3fh,53h
+			db	2ch,a0h,abh,36h,f2h,42h,75h,a4h
+			db	31h,c7h,efh,10h,36h,40h,79h,72h
+			db	31h,d4h,3eh,efh,5eh,34h,08h,70h
+			db	e5h,26h,1dh,f5h,f1h,7ch,c3h,01h
+			db	f8h,01h,d3h,f7h,c4h,bdh,50h,3eh
+			db	17h,28h,d7h,02h,33h,8bh,8ch,70h
+			db	0ch,b7h,66h,9fh,78h,08h,88h,6bh
+			db	66h,5bh,67h,ddh,e0h,b0h,a3h,d6h
+			db	b3h,97h,a1h,11h,cbh,1ah,8dh,08h
+			db	36h,d1h,4fh,b7h,cdh,63h,4dh,37h
+			db	a0h,9ah,1dh,d0h,b7h,32h,82h,13h
+			db	43h,99h,c9h,86h,bbh,9ah,5dh,2eh
+			db	17h,1ch,79h,07h,52h,7ch,16h,d2h
+			db	14h,feh,15h,e1h,3dh,72h,ffh,07h
+			db	80h,69h,4fh,16h,deh,cfh,17h,0ch
+			db	cch,90h,46h,63h,39h,91h,cbh,44h
+			db	bdh,d7h,bch,16h,d3h,2ch,ach,0ah
+			db	d8h,d5h,6bh,5ah,b1h,5dh,a1h,0fh
+			db	56h,d3h,2ch,0ch,62h,b2h,cch,9ah
+			db	c0h,6bh,e1h,78h,f6h,81h,ebh,17h
+			db	ach,8dh,50h,26h,06h,68h,74h,51h
+			db	30h,2ah,9ah,2ah,54h,79h,d4h,03h
+			db	b0h,40h,6eh,fch,b4h,92h,8bh,67h
+			db	cch,ebh,f7h,89h,d6h,1dh,a4h,78h
+			db	edh,afh,4bh,45h,f2h,5ch,00h,e4h
+			db	a6h,bah,feh,06h,cbh,dah,68h,42h
+			db	abh,2bh,30h,b4h,4ah,9eh,6ah,fch
+			db	aeh,14h,feh,2eh,13h,b8h,dfh,f3h
+			db	f7h,14h,9bh,42h,8ah,0eh,60h,06h
+			db	6ah,b0h,48h,23h,eeh,e6h,f3h,d3h
+			db	d5h,16h,d3h,39h,97h,a2h,7eh,c2h
+			db	77h,5ah,63h,8ah,19h,46h,bch,1ah
+			db	79h,bah,59h,fbh,44h,8bh,bbh,d1h
+			db	72h,ach,bdh,fah,f9h,c4h,58h,dfh
+			db	e8h,f0h,0ch,52h,cah,3ah,aah,65h
+			db	58h,22h,b0h,2fh,83h,4ah,12h,bfh
+			db	79h,b8h,4dh,5dh,65h,07h,c3h,18h
+			db	bch,09h,0bh,c6h,f8h,10h,85h,3ch
+			db	b2h,dbh,d4h,64h,82h,96h,47h,1ch
+			db	b5h,7fh,8ch,05h,8ch,33h,76h,c6h
+			db	0eh,d5h,bch,1ah,96h,5fh,bdh,18h
+			db	d6h,1dh,f0h,1fh,24h,52h,81h,0bh
+			db	b0h,04h,49h,53h,25h,e8h,78h,78h
+			db	90h,59h,10h,a5h,29h,ebh,03h,02h
+			db	c2h,77h,82h,fah,e4h,d6h,32h,56h
+			db	27h,46h,3fh,6dh,83h,e5h,58h,ffh
+			db	00h,7fh,97h,45h,afh,f2h,6ch,cdh
+			db	78h,85h,afh,90h,b5h,a2h,4fh,d5h
+			db	cch,efh,a3h,5eh,bdh,b9h,eah,e0h
+			db	87h,44h,01h,73h,68h,d2h,3ah,ach
+			db	33h,cdh,0ch,fbh,fdh,3bh,abh,57h
+			db	ddh,c3h,aah,66h,f6h,21h,d6h,33h
+			db	7dh,40h,b1h,bch,02h,f3h,beh,d6h
+			db	86h,f3h,f7h,ebh,77h,bdh,2dh,5fh
+			db	96h,6dh,8ch,00h,60h,3dh,3ah,0ah
+			db	98h,dbh,54h,6ch,f0h,d9h,4ah,32h
+			db	bch,fdh,07h,5ah,87h,f2h,88h,3fh
+			db	14h,0ah,5ah,04h,75h,7ah,f7h,10h
+			db	34h,54h,79h,31h,6dh,adh,49h,44h
+			db	6bh,c2h,0ch,cbh,a0h,30h,10h,a6h
+			db	b8h,87h,dch,b7h,1fh,34h,afh,d3h
+			db	c9h,4eh,58h,31h,30h,3bh,75h,27h
+			db	a7h,3eh,f6h,17h,a9h,81h,14h,74h
+			db	70h,a4h,b4h,45h,9dh,e5h,7ch,94h
+			db	54h,0dh,b5h,4bh,02h,8dh,3fh,1bh
+			db	76h,0ah,08h,c9h,92h,02h,07h,7eh
+			db	06h,22h,a9h,58h,29h,8eh,39h,63h
+			db	43h,4eh,9dh,21h,b5h,f5h,64h,93h
+			db	1ah,36h,89h,9bh,3ah,96h,7bh,1fh
+			db	aah,49h,11h,52h,9fh,0bh,76h,1bh
+			db	aah,7fh,89h,4ch,6fh,99h,cfh,cfh
+			db	59h,a9h,c7h,b2h,e6h,ffh,4ah,beh
+			db	d5h,7ah,2ah,05h,3fh,5ch,61h,90h
+			db	9bh,69h,3ah,aah,c9h,d1h,6ah,b3h
+			db	09h,b6h,d8h,feh,90h,77h,56h,0ch
+			db	bch,adh,aeh,86h,1dh,67h,07h,f9h
+			db	72h,8dh,9ch,a0h,20h,0ah,76h,71h
+			db	8bh,a2h,27h,7eh,ddh,b8h,03h,53h
+			db	62h,a5h,1fh,67h,49h,80h,a6h,f2h
+			db	45h,cbh,96h,c5h,33h,28h,02h,8ah
+			db	86h,d7h,51h,e8h,95h,71h,9fh,5ah
+			db	01h,94h,6fh,47h,0eh,beh,0ah,3ah
+			db	04h,b8h,4dh,78h,35h,37h,1fh,cah
+			db	cfh,e7h,63h,23h,5eh,e0h,64h,3bh
+			db	6dh,16h,7fh,adh,68h,a1h,3bh,93h
+			db	8fh,80h,07h,33h,01h,97h,f7h,8fh
+			db	cbh,5eh,36h,d1h,56h,69h,f7h,60h
+			db	03h,25h,f6h,85h,2bh,28h,abh,41h
+			db	16h,8dh,19h,eeh,f1h,8bh,9bh,15h
+			db	04h,f5h,24h,1ch,dbh,51h,7ah,75h
+			db	bah,a0h,fch,14h,89h,b8h,87h,e0h
+			db	72h,57h,39h,62h,ach,c4h,f5h,45h
+			db	16h,29h,77h,dbh,b6h,5fh,2bh,9ch
+			db	b6h,cfh,b9h,34h,dfh,30h,30h,d2h
+			db	e8h,58h,dfh,ach,d6h,a8h,2dh,edh
+			db	89h,c7h,d9h,0bh,1dh,e0h,74h,75h
+			db	53h,69h,1ch,bbh,7fh,9ch,d0h,01h
+			db	c1h,c8h,14h,51h,b3h,3fh,f0h,a4h
+			db	dch,3dh,bah,adh,78h,d2h,e5h,bbh
+			db	52h,72h,9ah,8dh,f4h,06h,a0h,38h
+			db	23h,fdh,19h,b8h,e1h,04h,23h,feh
+			db	a0h,10h,aah,34h,ddh,eeh,a3h,21h
+			db	20h,8fh,6dh,0eh,a2h,c0h,51h,91h
+			db	dch,8bh,d6h,66h,5ch,7fh,61h,6ch
+			db	27h,52h,ceh,1bh,7eh,28h,15h,e7h
+			db	7ah,a3h,40h,4eh,d4h,bah,86h,2eh
+			db	d6h,d4h,e9h,07h,17h,cbh,aeh,7bh
+			db	a6h,ceh,cah,b7h,80h,f0h,76h,39h
+			db	b5h,0eh,11h,42h,d6h,5ah,89h,beh
+			db	15h,15h,4ch,f0h,cdh,54h,26h,cch
+			db	56h,59h,02h,81h,d1h,99h,c8h,c7h
+			db	aah,26h,57h,aah,0bh,aah,98h,d1h
+			db	38h,9fh,4fh,bfh,e5h,eeh,bah,38h
+			db	99h,8fh,15h,12h,e5h,60h,91h,14h
+			db	31h,47h,97h,37h,89h,2ch,56h,fah
+			db	40h,4ch,2fh,f4h,16h,a1h,3dh,d6h
+			db	b4h,3bh,40h,d8h,51h,d7h,06h,b9h
+			db	49h,09h,cah,69h,38h,28h,75h,e5h
+			db	adh,80h,19h,deh,b2h,62h,96h,5bh
+			db	9fh,75h,02h,70h,0dh,5ah,06h,67h
+			db	60h,44h,a1h,eah,d6h,35h,d4h,09h
+			db	a9h,69h,d0h,3eh,feh,03h,aeh,54h
+			db	6dh,cch,13h,75h,87h,55h,b6h,6bh
+			db	11h,d1h,9eh,90h,3ch,77h,24h,9dh
+			db	2fh,c4h,0ah,9ah,1eh,7dh,71h,23h
+			db	e6h,4bh,1fh,aah,73h,9bh,f7h,63h
+			db	64h,3ch,9dh,7dh,22h,07h,1dh,d0h
+			db	6ch,53h,8ch,aeh,d3h,91h,c6h,f8h
+			db	70h,edh,dbh,36h,26h,c5h,a5h,f3h
+			db	40h,07h,80h,96h,b8h,03h,dah,3fh
+			db	1eh,b7h,49h,13h,75h,cah,2bh,d2h
+			db	50h,53h,77h,cdh,30h,d7h,d1h,1bh
+			db	2dh,0dh,e1h,0eh,f7h,50h,2bh,7dh
+			db	f4h,62h,dah,d7h,85h,42h,92h,c9h
+			db	1ch,55h,64h,56h,feh,23h,4bh,18h
+			db	e4h,9dh,82h,97h,48h,f5h,bdh,3fh
+			db	1ch,2dh,78h,5ch,5dh,3dh,f8h,3bh
+			db	8ah,99h,cah,fdh,beh,1bh,a1h,a3h
+			db	2fh,1eh,a3h,3dh,eah,09h,04h,1bh
+			db	56h,22h,38h,0fh,deh,02h,deh,8bh
+			db	2fh,f3h,b4h,c3h,57h,f2h,a8h,0ch
+			db	1ah,b6h,54h,10h,28h,dbh,97h,efh
+			db	edh,29h,a6h,6ah,0bh,23h,cbh,fah
+			db	dah,c5h,e0h,b1h,c6h,3bh,a5h,b3h
+			db	d4h,1ch,7bh,7bh,53h,35h,4dh,83h
+			db	a3h,51h,b0h,f3h,67h,6bh,46h,8ch
+			db	32h,41h,53h,f2h,1ch,f4h,67h,58h
+			db	6fh,57h,feh,b1h,85h,c9h,22h,97h
+			db	b7h,1dh,cfh,81h,35h,89h,dbh,64h
+			db	56h,a1h,77h,cah,ddh,53h,fah,6dh
+			db	adh,71h,a9h,f8h,98h,e7h,d0h,29h
+			db	95h,05h,79h,53h,29h,e3h,0dh,e8h
+			db	39h,64h,d7h,49h,b3h,10h,1fh,47h
+			db	0eh,29h,4bh,5eh,08h,23h,dah,83h
+			db	b0h,a3h,b9h,fah,a4h,b5h,e7h,fch
+			db	c6h,bdh,50h,55h,71h,aeh,7ah,f6h
+			db	d5h,a3h,49h,55h,c7h,37h,25h,90h
+			db	79h,06h,fch,b3h,dch,76h,35h,adh
+			db	b3h,9fh,59h,e9h,f1h,64h,76h,c7h
+			db	8eh,a3h,d1h,0ch,39h,bch,2bh,87h
+			db	c7h,efh,78h,bch,78h,c9h,ceh,5ch
+			db	81h,e5h,1eh,f8h,13h,41h,28h,9bh
+			db	54h,84h,adh,07h,a3h,d5h,0ah,7ch
+			db	07h,06h,c0h,11h,42h,96h,cch,76h
+			db	91h,eeh,09h,26h,06h,68h,90h,ech
+			db	5bh,3ah,fah,83h,d7h,31h,b9h,fch
+			db	05h,24h,ffh,6ah,c2h,1bh,fah,3ah
+			db	d9h,1fh,89h,e7h,70h,25h,49h,b4h
+			db	c1h,7eh,d1h,9bh,b3h,84h,17h,97h
+			db	d4h,09h,a6h,73h,aah,8ah,f8h,d4h
+			db	96h,65h,20h,cbh,20h,c7h,46h,fbh
+			db	18h,6dh,24h,bbh,c4h,a2h,6fh,d5h
+			db	f0h,91h,45h,dfh,ddh,22h,b2h,d5h
+			db	52h,beh,c6h,adh,e5h,4dh,79h,54h
+			db	7bh,9fh,e9h,e0h,66h,9dh,36h,30h
+			db	49h,08h,6ah,9dh,03h,9fh,22h,ceh
+			db	d4h,41h,e2h,53h,16h,a4h,42h,a9h
+			db	bbh,48h,2fh,b3h,cah,dch,dah,a2h
+			db	1bh,74h,f2h,35h,38h,3ah,57h,a9h
+			db	31h,2eh,a4h,11h,61h,50h,02h,01h
+			db	f2h,c3h,9eh,ebh,a5h,fbh,d4h,7fh
+			db	15h,56h,60h,a3h,28h,8eh,f5h,78h
+			db	9ah,3dh,82h,92h,fbh,a4h,b4h,96h
+			db	46h,06h,cch,38h,34h,bfh,ffh,1ch
+			db	96h,bfh,54h,45h,02h,88h,90h,63h
+			db	34h,31h,38h,c9h,e3h,82h,25h,93h
+			db	c5h,03h,54h,35h,32h,aeh,40h,e2h
+			db	d5h,18h,61h,7eh,a3h,aeh,e2h,22h
+			db	1dh,05h,1eh,b9h,76h,d9h,ceh,b4h
+			db	c9h,b3h,bbh,d4h,c7h,f5h,6ah,36h
+			db	52h,5dh,3bh,90h,21h,6bh,f0h,66h
+			db	c7h,68h,eah,89h,49h,00h,91h,c0h
+			db	25h,dfh,6dh,37h,5dh,23h,57h,92h
+			db	76h,84h,42h,3ah,73h,8bh,69h,6dh
+			db	9eh,adh,bch,b3h,70h,65h,77h,ech
+			db	dbh,2eh,b3h,24h,a3h,63h,5eh,5fh
+			db	2dh,c6h,d6h,31h,8fh,49h,1fh,d6h
+			db	e7h,9bh,dah,35h,c9h,9fh,49h,34h
+			db	fbh,b4h,27h,50h,9ch,0ch,bfh,c1h
+			db	efh,32h,27h,cch,cah,08h,afh,93h
+			db	61h,43h,bfh,7fh,bch,19h,8ah,b3h
+			db	deh,c0h,90h,19h,90h,72h,2bh,c1h
+			db	3ah,36h,31h,f5h,42h,c8h,57h,eeh
+			db	1fh,cah,0fh,94h,43h,1fh,d0h,21h
+			db	e0h,05h,0eh,8ch,68h,e9h,23h,41h
+			db	5fh,c1h,23h,bbh,31h,88h,ceh,c1h
+			db	eah,2ch,22h,46h,08h,b2h,0ch,d4h
+			db	8ch,7ah,adh,69h,cdh,80h,89h,70h
+			db	09h,07h,3bh,ffh,a1h,e0h,80h,b1h
+			db	5dh,09h,8ch,3dh,d3h,99h,c2h,bch
+			db	0fh,30h,5eh,afh,14h,bbh,a2h,ddh
+			db	83h,09h,dch,9fh,d6h,87h,a2h,3bh
+			db	3eh,0fh,7ch,7eh,8ch,abh,2ch,06h
+			db	a6h,74h,f2h,bch,c7h,9eh,5eh,1fh
+			db	cch,24h,c5h,8bh,e1h,58h,f1h,49h
+			db	efh,92h,39h,14h,eeh,cdh,ddh,1eh
+			db	dch,d5h,35h,6ah,bbh,6ah,89h,48h
+			db	06h,07h,d3h,40h,29h,f1h,c7h,75h
+			db	cbh,eeh,44h,70h,f8h,dah,8bh,2ah
+			db	83h,34h,19h,43h,77h,98h,26h,bch
+			db	7eh,56h,bdh,71h,25h,3ah,4bh,4fh
+			db	5ch,84h,24h,c1h,08h,72h,87h,b7h
+			db	aah,05h,3bh,1ah,e5h,84h,65h,f0h
+			db	c6h,a4h,c5h,6eh,15h,7fh,2dh,a8h
+			db	feh,afh,83h,68h,48h,66h,9bh,9eh
+			db	08h,93h,cah,7eh,73h,9ah,24h,abh
+			db	2bh,edh,e3h,61h,17h,0eh,cdh,4fh
+			db	5dh,cch,c6h,5ch,b8h,f3h,6ah,9fh
+			db	9ah,edh,e6h,56h,b2h,fbh,95h,19h
+			db	b9h,9bh,b2h,e3h,cbh,c8h,05h,54h
+			db	1fh,b2h,b2h,edh,bdh,f1h,ach,0bh
+			db	d2h,92h,8ah,f2h,8eh,62h,63h,96h
+			db	4ch,66h,36h,00h,71h,e1h,13h,99h
+			db	7dh,e8h,f4h,54h,6dh,dbh,c1h,87h
+			db	efh,5fh,99h,24h,07h,c6h,5fh,63h
+			db	80h,70h,05h,16h,54h,b1h,70h,a2h
+			db	19h,61h,17h,f8h,aah,bch,dah,f8h
+			db	d3h,27h,68h,7ch,7ah,c3h,2eh,0ch
+			db	62h,68h,70h,84h,33h,34h,c4h,71h
+			db	b9h,73h,39h,3ah,78h,14h,8ch,3eh
+			db	a5h,1ch,d8h,a1h,8ah,18h,b3h,7dh
+			db	e6h,b7h,ddh,6dh,7ch,62h,aeh,fdh
+			db	62h,3bh,eeh,cch,06h,feh,5eh,3eh
+			db	cbh,20h,73h,feh,88h,1dh,b7h,2ch
+			db	4ch,b8h,a1h,41h,5bh,b0h,aah,e1h
+			db	5ah,44h,20h,8fh,0dh,c7h,93h,97h
+			db	85h,e2h,dah,68h,12h,e7h,aeh,a2h
+			db	48h,47h,20h,17h,f3h,7fh,5fh,f9h
+			db	57h,5dh,18h,bdh,36h,06h,bbh,15h
+			db	58h,d1h,55h,67h,e9h,cch,07h,11h
+			db	0fh,0fh,e8h,a6h,56h,e1h,e6h,25h
+			db	9fh,87h,ech,02h,deh,d8h,a8h,6ah
+			db	ceh,dah,afh,b0h,fbh,deh,e6h,25h
+			db	b6h,f6h,95h,12h,a6h,c1h,6ah,d1h
+			db	53h,f3h,99h,32h,f6h,38h,3ch,40h
+			db	e7h,0ah,fbh,4ch,dah,a7h,2dh,34h
+			db	3dh,e8h,74h,8eh,06h,c4h,05h,62h
+			db	81h,6bh,61h,48h,fdh,61h,9dh,3eh
+			db	73h,0bh,bfh,eeh,3fh,77h,19h,a0h
+			db	c6h,7eh,b5h,d7h,c1h,dah,04h,19h
+			db	b5h,42h,8bh,8bh,e8h,ebh,a1h,7dh
+			db	cbh,19h,15h,4dh,80h,d3h,e3h,d5h
+			db	abh,57h,c0h,99h,c2h,e9h,27h,9bh
+			db	eeh,75h,30h,53h,99h,a3h,bah,bbh
+			db	09h,2ah,65h,cfh,20h,d7h,47h,29h
+			db	6dh,4dh,d4h,4ah,5dh,59h,08h,72h
+			db	e6h,81h,84h,13h,92h,57h,04h,cah
+			db	23h,b7h,91h,aah,65h,97h,33h,0ch
+			db	79h,84h,13h,4fh,c5h,05h,dbh,2dh
+			db	fah,70h,a7h,54h,56h,3ch,dah,52h
+			db	e6h,6ah,c8h,d4h,b1h,10h,c8h,feh
+			db	8eh,23h,13h,a8h,4eh,3ah,2dh,cdh
+			db	c7h,f5h,b0h,7ah,a5h,f3h,34h,85h
+			db	39h,ach,a3h,94h,47h,0eh,ffh,01h
+			db	5fh,a2h,32h,77h,dbh,b9h,a8h,d0h
+			db	c1h,25h,c4h,3ah,a7h,f8h,15h,c8h
+			db	7bh,2bh,ech,edh,5bh,b7h,cah,81h
+			db	2fh,c9h,dbh,95h,3ch,eah,d8h,b0h
+			db	9ah,e8h,dbh,fch,79h,9bh,efh,86h
+			db	95h,b1h,b8h,e2h,55h,1eh,14h,41h
+			db	74h,fbh,bbh,f3h,83h,1bh,f7h,cfh
+			db	18h,a7h,69h,09h,5dh,04h,a4h,efh
+			db	bch,a8h,87h,11h,46h,9bh,f8h,7eh
+			db	d4h,96h,85h,d7h,9dh,b4h,74h,97h
+			db	41h,51h,31h,beh,41h,03h,7fh,80h
+			db	2ah,b5h,82h,cbh,58h,bch,61h,75h
+			db	e4h,cch,e7h,ebh,53h,58h,e8h,91h
+			db	63h,e7h,75h,37h,d4h,05h,69h,09h
+			db	ech,51h,67h,c2h,61h,7ah,aeh,1eh
+			db	d9h,cfh,69h,13h,c4h,7fh,18h,21h
+			db	f2h,cch,ech,1dh,7bh,1eh,e9h,3fh
+			db	c2h,d2h,ech,52h,42h,ach,12h,c2h
+			db	f8h,bdh,01h,ffh,88h,5bh,52h,5ah
+			db	8ch,15h,45h,6ch,3fh,c8h,f9h,50h
+			db	6ah,13h,7ah,61h,70h,95h,2fh,4eh
+			db	87h,b0h,59h,6ch,b9h,cdh,feh,65h
+			db	9eh,ddh,55h,4fh,56h,3ah,eah,8ch
+			db	efh,ffh,c6h,7eh,edh,3ah,d9h,0ah
+			db	b6h,2bh,fbh,bdh,56h,72h,1ch,57h
+			db	3dh,f0h,86h,edh,08h,5dh,70h,81h
+			db	ebh,9dh,dfh,b1h,88h,d4h,79h,2ah
+			db	e9h,49h,f8h,4ch,37h,cah,adh,72h
+			db	e5h,31h,ceh,b3h,35h,cdh,42h,5bh
+			db	91h,e8h,d6h,1ah,ach,05h,14h,6eh
+			db	f6h,52h,4ah,b7h,d8h,6dh,74h,0bh
+			db	fch,fdh,d4h,c2h,f1h,96h,d4h,12h
+			db	5bh,c1h,d4h,90h,d3h,3eh,12h,aah
+			db	2dh,b9h,2eh,a3h,0eh,f5h,f0h,2ah
+			db	8dh,cbh,17h,91h,29h,80h,dch,c7h
+			db	c9h,8bh,a4h,36h,e6h,00h,8dh,28h
+			db	a8h,f8h,49h,8ah,d1h,d8h,2bh,5ah
+			db	dah,d2h,02h,85h,61h,0ch,73h,a8h
+			db	c1h,37h,6bh,05h,feh,5fh,0eh,ebh
+			db	ddh,81h,dah,56h,dfh,44h,f5h,c4h
+			db	eah,1fh,ach,beh,f5h,3ch,cbh,61h
+			db	edh,6ch,47h,b2h,77h,fch,e7h,c4h
+			db	dfh,cah,61h,62h,9eh,d9h,52h,6eh
+			db	aeh,7eh,7ch,f7h,70h,bah,f2h,c1h
+			db	3dh,aeh,0eh,86h,77h,fbh,61h,d6h
+			db	24h,54h,d0h,2bh,15h,83h,e8h,3dh
+			db	84h,78h,ddh,fch,10h,4eh,4dh,ech
+			db	34h,5bh,33h,8ch,d0h,81h,ddh,04h
+			db	d0h,11h,51h,08h,3dh,88h,4fh,abh
+			db	40h,01h,51h,04h,53h,10h,cbh,f5h
+			db	09h,0fh,0eh,2fh,25h,2bh,72h,92h
+			db	d9h,3ah,fch,05h,10h,4dh,d1h,abh
+			db	29h,9fh,92h,78h,0eh,8dh,a0h,afh
+			db	58h,4ah,8ah,82h,20h,7ch,f3h,46h
+			db	3ah,98h,dch,f9h,b6h,b2h,27h,c1h
+			db	0dh,27h,7ah,c8h,48h,fch,9fh,f0h
+			db	dfh,8ah,feh,7ah,eah,d1h,00h,73h
+			db	f6h,1ch,57h,28h,2fh,2bh,2dh,d9h
+			db	d0h,abh,cdh,1eh,31h,4dh,a0h,29h
+			db	1bh,b3h,25h,aeh,32h,1dh,99h,11h
+			db	19h,ceh,13h,4eh,f2h,b0h,81h,91h
+			db	6ch,22h,4ah,3ch,7dh,93h,b0h,5dh
+			db	77h,0ah,34h,79h,d8h,edh,21h,5bh
+			db	55h,12h,d0h,89h,1ch,cfh,f6h,e0h
+			db	adh,6ah,01h,02h,e5h,edh,5eh,f3h
+			db	dah,78h,ffh,b2h,bah,9ah,cah,4dh
+			db	d8h,92h,c1h,feh,56h,4fh,12h,0eh
+			db	7bh,83h,ffh,e9h,fch,fah,cch,beh
+			db	65h,d3h,62h,80h,eah,2dh,6fh,80h
+			db	69h,1eh,f0h,e2h,5ah,93h,ddh,fch
+			db	6dh,70h,86h,5ah,f0h,36h,32h,bfh
+			db	36h,e5h,25h,66h,a4h,a1h,03h,ffh
+			db	cbh,a9h,cah,d4h,bfh,83h,21h,06h
+			db	16h,b3h,eeh,b3h,f4h,5dh,2ah,1ah
+			db	8ch,b4h,4dh,73h,6dh,12h,90h,37h
+			db	b8h,a9h,13h,20h,47h,98h,aah,c4h
+			db	51h,feh,2ch,43h,4fh,d3h,d9h,d9h
+			db	ach,26h,7ch,36h,a7h,bfh,bah,fch
+			db	deh,61h,3ch,f9h,0bh,c0h,6ch,d6h
+			db	28h,4fh,7eh,75h,e1h,fah,dah,ebh
+			db	b8h,60h,7fh,b8h,9fh,04h,7ch,a2h
+			db	4eh,02h,04h,8fh,4bh,85h,14h,1ch
+			db	57h,a0h,09h,09h,6eh,abh,21h,99h
+			db	ach,0bh,adh,d9h,4eh,99h,03h,f3h
+			db	2eh,67h,abh,9eh,09h,7eh,16h,07h
+			db	29h,c4h,f8h,4bh,beh,adh,f2h,72h
+			db	eah,fah,70h,01h,c5h,4eh,aeh,1fh
+			db	62h,9bh,a3h,beh,68h,f5h,65h,57h
+			db	08h,65h,47h,7eh,20h,c0h,7eh,efh
+			db	07h,37h,dah,54h,7ah,34h,64h,5fh
+			db	68h,46h,18h,72h,1ch,92h,efh,86h
+			db	71h,a5h,56h,81h,54h,47h,3ch,b2h
+			db	b0h,56h,6eh,aah,38h,0ch,cdh,73h
+			db	9ah,fch,22h,5ch,7ch,65h,b0h,54h
+			db	8fh,1ch,36h,9ah,9eh,e3h,38h,57h
+			db	c2h,2fh,fbh,51h,92h,89h,f5h,9eh
+			db	fah,10h,10h,7dh,a1h,75h,8fh,5ah
+			db	85h,58h,98h,43h,5dh,41h,adh,4ch
+			db	efh,40h,7ch,32h,a4h,95h,ddh,7dh
+			db	4dh,62h,a6h,74h,55h,70h,cfh,88h
+			db	c6h,c8h,64h,43h,76h,69h,c2h,a1h
+			db	40h,ach,77h,efh,8bh,80h,81h,81h
+			db	e4h,64h,66h,4eh,d9h,c2h,7ch,d5h
+			db	88h,04h,48h,54h,07h,e2h,bbh,16h
+			db	4ah,e3h,a6h,9ah,b9h,ddh,e0h,f1h
+			db	49h,62h,96h,3fh,c0h,2ch,8ah,28h
+			db	aah,61h,1eh,7eh,03h,45h,73h,03h
+			db	afh,bfh,61h,2fh,0ch,23h,b0h,0bh
+			db	a7h,43h,c1h,91h,b2h,8ch,05h,efh
+			db	a4h,09h,cah,69h,2eh,b0h,74h,c5h
+			db	5eh,75h,a0h,57h,60h,dah,adh,13h
+			db	1bh,c4h,05h,87h,92h,5ch,52h,e0h
+			db	84h,c2h,31h,03h,aeh,3bh,d8h,28h
+			db	0ch,07h,06h,63h,4dh,29h,adh,b2h
+			db	0eh,16h,bah,a6h,ceh,e9h,17h,82h
+			db	42h,2eh,48h,a6h,c7h,8bh,5bh,1bh
+			db	98h,efh,d8h,3dh,bbh,3dh,d7h,33h
+			db	e9h,e5h,1fh,58h,e1h,fbh,d2h,90h
+			db	8ah,97h,f5h,5fh,10h,c4h,9dh,56h
+			db	70h,16h,feh,e3h,f0h,2fh,26h,8ch
+			db	98h,b2h,45h,1bh,98h,02h,fah,feh
+			db	adh,08h,f0h,a4h,abh,6ch,34h,82h
+			db	11h,ceh,06h,8dh,37h,4ah,7eh,36h
+			db	08h,71h,edh,5ah,10h,dbh,58h,51h
+			db	89h,b4h,2ah,c7h,20h,53h,01h,8fh
+			db	59h,8dh,68h,0dh,c0h,69h,98h,a0h
+			db	c4h,34h,1fh,4ch,e8h,21h,f2h,89h
+			db	17h,5bh,1dh,9dh,03h,6fh,f3h,6eh
+			db	5ah,96h,2ch,37h,c3h,f6h,1bh,0fh
+			db	9eh,5fh,2ch,dbh,f3h,aah,21h,e5h
+			db	02h,7dh,90h,32h,a5h,d0h,feh,f1h
+			db	d3h,17h,95h,b5h,a9h,fbh,06h,08h
+			db	01h,b2h,3dh,4bh,07h,ebh,aeh,23h
+			db	06h,e2h,74h,d0h,01h,a0h,dfh,b8h
+			db	03h,16h,30h,f5h,6dh,56h,2dh,e0h
+			db	a7h,62h,47h,eeh,b7h,83h,5eh,2eh
+			db	25h,95h,d1h,e6h,bch,0ch,8eh,9dh
+			db	b1h,0dh,8fh,25h,ffh,71h,93h,13h
+			db	41h,a9h,9ah,3fh,1dh,97h,d6h,d2h
+			db	81h,24h,a7h,f2h,11h,beh,16h,ebh
+			db	ddh,ddh,37h,4fh,d8h,3bh,53h,deh
+			db	cfh,aah,a0h,23h,0eh,e2h,adh,f4h
+			db	59h,d6h,0bh,b3h,fbh,89h,fbh,2eh
+			db	78h,73h,06h,89h,82h,f0h,d4h,5ah
+			db	80h,5fh,80h,ffh,37h,36h,a8h,b4h
+			db	05h,63h,f7h,1ch,7dh,5eh,b1h,d2h
+			db	0ah,d5h,6ah,aeh,bch,43h,e4h,1bh
+			db	c2h,38h,42h,fbh,86h,b7h,f3h,83h
+			db	44h,f2h,c6h,d4h,40h,d5h,02h,1eh
+			db	0dh,03h,a5h,35h,32h,8ch,0bh,7dh
+			db	d3h,8dh,4ch,a6h,3eh,6dh,dbh,1ah
+			db	1ah,f4h,f7h,ddh,56h,e0h,63h,bfh
+			db	5bh,90h,b3h,02h,e8h,02h,8bh,c7h
+			db	c8h,a4h,36h,6eh,95h,96h,90h,80h
+			db	fah,23h,85h,41h,00h,56h,47h,cdh
+			db	4fh,f8h,d2h,52h,bch,3bh,1ch,e2h
+			db	b7h,0eh,66h,04h,b8h,cdh,cfh,f3h
+			db	1dh,4ch,7dh,d9h,cch,3eh,82h,d2h
+			db	cah,64h,71h,beh,96h,39h,f7h,bdh
+			db	fbh,95h,1ah,5ch,cch,f6h,afh,8ah
+			db	30h,bbh,17h,b0h,0dh,5ah,3fh,85h
+			db	ddh,3dh,50h,d1h,8dh,56h,b7h,c1h
+			db	2dh,e3h,15h,7eh,a5h,eeh,2eh,56h
+			db	18h,f8h,cbh,04h,d6h,8dh,f6h,18h
+			db	5ch,b9h,d6h,1ah,dbh,f0h,e0h,ffh
+			db	0dh,bdh,edh,adh,6ah,bfh,ech,d7h
+			db	08h,c1h,21h,3bh,60h,08h,bdh,59h
+			db	f8h,a3h,e2h,3eh,c1h,35h,cah,7dh
+			db	cdh,f3h,feh,57h,56h,1dh,36h,2fh
+			db	aah,88h,6dh,a7h,d2h,5ah,ach,82h
+			db	5bh,ddh,a2h,f2h,b9h,0ah,edh,15h
+			db	87h,b3h,8ah,10h,3ch,dch,3ah,dch
+			db	c8h,3ch,89h,0ch,a5h,21h,96h,0fh
+			db	24h,9ch,f8h,45h,47h,8fh,c9h,45h
+			db	e6h,5dh,80h,57h,55h,08h,bdh,4ch
+			db	28h,92h,64h,2ah,8eh,d7h,ach,08h
+			db	34h,81h,8fh,b6h,29h,b8h,dbh,77h
+			db	70h,0ch,b2h,b1h,0ch,beh,1ah,0bh
+			db	a8h,41h,d5h,69h,a7h,2bh,51h,4bh
+			db	35h,34h,d4h,2ah,b8h,c7h,d4h,c6h
+			db	70h,30h,e3h,13h,17h,ach,9dh,c3h
+			db	95h,3ah,36h,8bh,1bh,36h,5dh,bah
+			db	d4h,52h,c5h,25h,15h,b4h,18h,4eh
+			db	60h,07h,edh,03h,58h,84h,30h,beh
+			db	c8h,85h,ebh,82h,dbh,9ch,13h,ceh
+			db	62h,82h,e2h,d5h,3bh,b0h,09h,c2h
+			db	43h,1ah,97h,d3h,19h,2eh,27h,8fh
+			db	e5h,7bh,a5h,92h,a8h,32h,9ah,1fh
+			db	92h,41h,b8h,8ch,adh,76h,b3h,4bh
+			db	adh,bah,01h,f5h,6ah,3eh,a7h,f6h
+			db	32h,70h,5bh,f2h,6ah,53h,aeh,f2h
+			db	2bh,dfh,f4h,dfh,17h,72h,47h,e7h
+			db	b6h,64h,19h,3fh,c3h,3fh,82h,f9h
+			db	ceh,f3h,89h,9dh,1bh,3ch,58h,4ch
+			db	9ch,beh,d2h,dah,58h,f8h,f3h,c0h
+			db	65h,23h,11h,c9h,55h,bfh,30h,95h
+			db	71h,65h,1fh,03h,9bh,60h,2bh,d5h
+			db	9ah,b0h,6dh,33h,2ch,07h,f8h,7bh
+			db	60h,cch,67h,dah,41h,e0h,57h,95h
+			db	fbh,09h,9dh,72h,87h,2ah,5fh,d3h
+			db	e0h,0fh,3fh,e5h,abh,84h,8eh,e8h
+			db	c0h,61h,91h,06h,76h,37h,54h,02h
+			db	ddh,75h,bdh,ebh,d3h,4bh,38h,c2h
+			db	c5h,2ch,dbh,7ch,45h,fch,25h,0dh
+			db	18h,32h,18h,1eh,89h,38h,73h,9ah
+			db	efh,16h,53h,59h,74h,c2h,f2h,53h
+			db	24h,24h,94h,a2h,f7h,dch,13h,67h
+			db	f0h,7dh,a8h,e7h,5eh,a0h,ceh,efh
+			db	7bh,3fh,76h,c9h,4bh,5ch,39h,47h
+			db	cbh,0eh,82h,0eh,f8h,21h,f0h,87h
+			db	02h,28h,0ah,88h,f9h,b9h,e2h,88h
+			db	98h,64h,1dh,69h,1fh,fdh,aeh,53h
+			db	a6h,f5h,43h,2dh,58h,96h,f5h,4ah
+			db	a7h,9dh,94h,87h,50h,0bh,27h,1ah
+			db	d8h,6dh,6ah,d0h,14h,30h,e3h,7dh
+			db	92h,49h,45h,07h,54h,f3h,d2h,09h
+			db	e1h,54h,3ah,90h,f7h,06h,f7h,73h
+			db	8eh,0fh,39h,e1h,cch,adh,24h,cch
+			db	2ch,c2h,3ch,d2h,32h,89h,d7h,06h
+			db	5fh,f8h,1fh,36h,90h,2ch,a6h,aah
+			db	aah,67h,21h,bch,63h,8eh,66h,aeh
+			db	07h,72h,9bh,8fh,39h,32h,80h,c2h
+			db	2ah,bdh,18h,22h,f9h,92h,f2h,52h
+			db	f1h,c7h,94h,65h,d5h,5bh,e1h,8bh
+			db	62h,0dh,4fh,5bh,a5h,93h,67h,7fh
+			db	bch,65h,9ah,38h,71h,90h,a3h,04h
+			db	8ch,69h,33h,b4h,3bh,c4h,b3h,a2h
+			db	c1h,26h,d5h,d1h,44h,b9h,d6h,d2h
+			db	1eh,1ah,31h,dah,bch,13h,01h,68h
+			db	cah,0eh,34h,4bh,06h,c0h,89h,bah
+			db	b9h,1eh,86h,08h,67h,4ch,fah,6fh
+			db	4fh,60h,f3h,fch,b4h,26h,5ah,37h
+			db	d6h,edh,41h,12h,f0h,2dh,c4h,98h
+			db	29h,4ah,feh,93h,dch,ceh,4ah,92h
+			db	b1h,fbh,adh,d4h,65h,4ch,94h,7bh
+			db	29h,42h,e3h,87h,72h,26h,26h,20h
+			db	deh,35h,f6h,07h,20h,32h,d1h,02h
+			db	2bh,9fh,a1h,37h,7bh,62h,eah,d8h
+			db	7bh,f1h,a0h,68h,56h,60h,bah,8dh
+			db	02h,09h,9fh,deh,b1h,0fh,c3h,39h
+			db	b2h,d4h,abh,59h,d3h,1ah,a1h,1ch
+			db	fch,d9h,14h,a7h,3eh,29h,3ch,84h
+			db	bdh,37h,57h,10h,cah,10h,7eh,65h
+			db	4dh,cfh,53h,cbh,88h,bch,d7h,fdh
+			db	b8h,3fh,7ah,b7h,d6h,49h,3dh,edh
+			db	94h,72h,00h,a0h,c4h,3eh,efh,01h
+			db	c5h,2bh,39h,95h,92h,64h,a1h,6bh
+			db	c8h,c6h,8fh,95h,10h,61h,11h,adh
+			db	1dh,2ch,75h,0ah,8dh,52h,17h,32h
+			db	17h,32h,9dh,b4h,04h,beh,b1h,7fh
+			db	0ch,6bh,c3h,93h,9bh,fdh,cch,c7h
+			db	71h,b5h,fdh,2dh,89h,78h,21h,80h
+			db	0dh,f9h,a0h,48h,36h,03h,8fh,efh
+			db	38h,deh,18h,bbh,22h,07h,ceh,9ah
+			db	d2h,87h,70h,98h,89h,1eh,1fh,aah
+			db	55h,75h,4bh,18h,f4h,92h,33h,39h
+			db	eeh,19h,7eh,ddh,5bh,f4h,e9h,30h
+			db	c4h,14h,51h,57h,b7h,15h,a3h,02h
+			db	08h,d3h,15h,deh,27h,6ch,84h,07h
+			db	41h,b6h,c8h,bfh,8dh,e5h,b2h,2ch
+			db	cbh,eeh,5ah,01h,6eh,abh,ebh,59h
+			db	ebh,24h,f3h,77h,85h,feh,08h,73h
+			db	68h,b4h,e9h,cch,f2h,55h,98h,83h
+			db	14h,31h,41h,efh,7dh,7eh,25h,2dh
+			db	80h,95h,36h,4fh,0eh,3dh,b7h,e1h
+			db	c5h,90h,14h,ach,b5h,f9h,bah,5bh
+			db	31h,8dh,34h,a2h,cdh,6eh,08h,7fh
+			db	0dh,1eh,e8h,40h,98h,1fh,69h,0fh
+			db	36h,02h,10h,8ah,78h,9ch,f2h,13h
+			db	fch,20h,96h,44h,f2h,85h,51h,2bh
+			db	57h,83h,feh,08h,a3h,cbh,54h,ach
+			db	47h,cfh,f8h,05h,9ah,36h,bah,25h
+			db	d9h,c9h,64h,25h,40h,b4h,fbh,deh
+			db	cdh,88h,8dh,0bh,7ah,dch,30h,13h
+			db	0bh,28h,dbh,49h,bch,05h,d8h,93h
+			db	3eh,9ah,a3h,62h,b1h,6fh,c3h,9ah
+			db	20h,7eh,5ch,e1h,04h,b3h,41h,5fh
+			db	8fh,20h,dch,1ch,20h,09h,54h,63h
+			db	d8h,f2h,fah,07h,26h,88h,e6h,e5h
+			db	3ah,29h,dah,16h,13h,60h,d2h,6bh
+			db	28h,f9h,d4h,28h,f4h,a4h,86h,30h
+			db	3fh,46h,93h,8ch,9bh,89h,72h,65h
+			db	5eh,bbh,a3h,ddh,8ch,05h,49h,d7h
+			db	6ah,bch,0dh,a3h,cdh,6ah,1eh,2ah
+			db	6ah,edh,abh,a1h,34h,c2h,8fh,76h
+			db	55h,41h,85h,9ah,fbh,79h,b1h,88h
+			db	c8h,b8h,67h,ach,72h,55h,7fh,c9h
+			db	a0h,c7h,30h,7eh,9eh,fbh,5ah,42h
+			db	81h,e8h,64h,b8h,dch,7ah,cfh,7dh
+			db	17h,deh,cbh,17h,6dh,f1h,6eh,4ch
+			db	78h,7ah,3ah,1fh,0bh,b9h,f0h,50h
+			db	82h,16h,48h,a5h,51h,3bh,f1h,81h
+			db	bch,52h,feh,a2h,62h,30h,ddh,50h
+			db	d4h,12h,38h,53h,fch,00h,aeh,fbh
+			db	aah,c0h,2ch,10h,82h,cdh,35h,c2h
+			db	b7h,edh,44h,7ch,52h,a8h,cdh,b5h
+			db	a4h,f0h,34h,c8h,3fh,66h,41h,32h
+			db	d7h,6ah,46h,f4h,ech,9fh,61h,56h
+			db	ebh,3bh,d6h,f0h,1ah,49h,79h,efh
+			db	2fh,18h,15h,5ah,dah,79h,50h,4ah
+			db	9bh,0fh,61h,d6h,0dh,10h,89h,7ah
+			db	cbh,cfh,bah,51h,18h,8dh,10h,ceh
+			db	34h,5ah,18h,feh,8eh,55h,a4h,66h
+			db	61h,9fh,68h,84h,36h,2dh,9bh,b2h
+			db	30h,24h,e1h,56h,32h,c5h,26h,d7h
+			db	00h,98h,88h,57h,1ch,2eh,43h,65h
+			db	ceh,d9h,d8h,93h,0ah,20h,feh,56h
+			db	01h,bah,fah,73h,fah,7fh,f9h,54h
+			db	a5h,80h,2ch,60h,4fh,5ch,3eh,cfh
+			db	e6h,1bh,42h,e1h,90h,98h,40h,02h
+			db	16h,4ch,a4h,77h,82h,f0h,e4h,9bh
+			db	ach,49h,f1h,86h,d4h,1dh,01h,61h
+			db	b1h,dbh,d3h,3eh,37h,3bh,e5h,29h
+			db	22h,6ah,2fh,ebh,72h,c2h,6fh,cch
+			db	b2h,3fh,43h,25h,ebh,0dh,f0h,3dh
+			db	52h,31h,6dh,4ah,dah,b5h,d8h,0ch
+			db	d4h,46h,a9h,cfh,8eh,18h,2fh,aah
+			db	d4h,b6h,56h,8fh,9bh,31h,0ah,00h
+			db	1dh,efh,e4h,efh,a2h,10h,49h,e6h
+			db	0fh,e2h,d0h,50h,06h,b2h,64h,f0h
+			db	ddh,83h,7ah,40h,8eh,92h,06h,fbh
+			db	f7h,8bh,d7h,b3h,52h,f9h,c3h,57h
+			db	87h,f5h,27h,2ah,ddh,aah,a2h,15h
+			db	3ah,c6h,d9h,b7h,57h,f2h,f7h,31h
+			db	8ah,40h,dch,0ah,55h,45h,00h,60h
+			db	6dh,a5h,eeh,d2h,d9h,deh,9eh,c3h
+			db	ach,cch,40h,1dh,91h,61h,70h,6bh
+			db	fbh,34h,c5h,bbh,9ah,f8h,e1h,bah
+			db	77h,e1h,71h,17h,d0h,62h,afh,edh
+			db	98h,15h,b6h,dbh,84h,d9h,ffh,5ah
+			db	efh,9ch,c2h,79h,fdh,e3h,c5h,8bh
+			db	f6h,38h,bfh,4eh,28h,39h,e8h,d6h
+			db	c7h,69h,f1h,32h,7ah,88h,85h,71h
+			db	dbh,abh,62h,bbh,adh,6fh,95h,2dh
+			db	6ah,7fh,46h,90h,8bh,b4h,b5h,55h
+			db	fch,67h,86h,e3h,cch,c5h,ach,c2h
+			db	d1h,a2h,77h,d1h,cah,b1h,dbh,cch
+			db	c3h,49h,28h,19h,81h,3dh,5ch,62h
+			db	97h,dbh,6eh,71h,e3h,67h,83h,d9h
+			db	edh,3dh,07h,afh,21h,2dh,95h,86h
+			db	a4h,47h,50h,a6h,a8h,ceh,f0h,28h
+			db	c9h,59h,59h,8ch,31h,9fh,f7h,54h
+			db	eah,e7h,43h,e7h,1dh,11h,68h,08h
+			db	16h,f1h,e9h,d9h,0ah,7fh,9ah,ach
+			db	71h,6dh,0ah,e1h,5ah,1dh,c8h,83h
+			db	47h,ebh,f7h,d2h,7dh,64h,52h,fdh
+			db	d3h,7ah,8eh,07h,9bh,93h,a5h,c8h
+			db	c0h,f9h,85h,87h,33h,ech,d1h,7fh
+			db	75h,95h,bdh,03h,7eh,5ah,44h,31h
+			db	6ah,c6h,a7h,abh,76h,c6h,adh,23h
+			db	92h,b5h,62h,b2h,85h,dch,95h,95h
+			db	bch,bch,7dh,5eh,beh,3eh,4ah,21h
+			db	c7h,c6h,e4h,5bh,2fh,02h,66h,82h
+			db	b0h,40h,27h,edh,e1h,cdh,24h,93h
+			db	fdh,2ch,a8h,21h,ech,4ch,88h,03h
+			db	59h,8fh,d5h,64h,e3h,b7h,a8h,42h
+			db	a1h,a4h,51h,f6h,8eh,a9h,0fh,85h
+			db	69h,c5h,10h,b2h,99h,9eh,f6h,a3h
+			db	f7h,1bh,d5h,15h,92h,10h,bch,67h
+			db	a3h,42h,90h,6eh,e1h,e8h,4dh,41h
+			db	a8h,2eh,c3h,f0h,97h,3bh,5bh,e3h
+			db	93h,a9h,c9h,60h,b9h,b5h,b8h,fbh
+			db	e4h,86h,c5h,09h,4ch,4eh,a6h,33h
+			db	b3h,d1h,21h,65h,9ah,90h,04h,86h
+			db	cbh,04h,f5h,7bh,80h,8bh,ffh,55h
+			db	62h,d3h,2dh,b4h,f0h,efh,c1h,23h
+			db	18h,9fh,73h,9eh,35h,77h,74h,7ch
+			db	96h,61h,8eh,7dh,efh,f2h,98h,44h
+			db	7eh,7dh,2ah,24h,a6h,e1h,82h,cfh
+			db	6ah,15h,bbh,c7h,06h,39h,65h,9eh
+			db	96h,d4h,55h,49h,2bh,23h,6dh,0ah
+			db	61h,a5h,04h,10h,43h,8dh,7ah,74h
+			db	42h,7bh,f2h,28h,5eh,6bh,d4h,5ch
+			db	feh,d2h,75h,86h,e4h,e9h,12h,d5h
+			db	88h,7bh,83h,89h,86h,9ch,5ch,f4h
+			db	68h,94h,f6h,cbh,cbh,7fh,34h,33h
+			db	79h,dch,d0h,0eh,afh,80h,96h,36h
+			db	8ch,a4h,32h,8bh,81h,efh,eeh,b2h
+			db	94h,14h,33h,6eh,beh,67h,aeh,69h
+			db	3ch,bdh,8bh,40h,14h,5eh,2dh,8bh
+			db	0ah,d7h,6fh,2fh,43h,77h,ach,22h
+			db	3ch,c2h,d2h,45h,9eh,8bh,7ah,e6h
+			db	d6h,60h,2fh,b4h,7ah,ebh,deh,2dh
+			db	4eh,e0h,1bh,cbh,2eh,53h,65h,47h
+			db	77h,58h,78h,95h,d8h,f6h,fbh,89h
+			db	5eh,b7h,3ch,aah,05h,21h,fdh,92h
+			db	95h,1eh,edh,25h,a6h,9eh,adh,3eh
+			db	abh,35h,43h,3dh,97h,41h,53h,c8h
+			db	91h,d6h,c5h,7ch,68h,19h,10h,b5h
+			db	6bh,42h,e7h,29h,d4h,79h,5ah,55h
+			db	2bh,09h,f7h,82h,71h,2ch,20h,a0h
+			db	75h,b6h,bah,9dh,82h,d3h,abh,7eh
+			db	39h,77h,27h,eah,2fh,a3h,61h,18h
+			db	aeh,e4h,60h,dbh,a0h,c2h,62h,a2h
+			db	a9h,f0h,dah,30h,33h,0bh,76h,efh
+			db	58h,15h,08h,61h,94h,4eh,70h,aah
+			db	67h,96h,c8h,b5h,30h,6ch,3fh,85h
+			db	eeh,44h,0fh,e0h,b6h,2ch,2ah,66h
+			db	3bh,2fh,e0h,6dh,7ah,4fh,5dh,8dh
+			db	fch,11h,81h,44h,a8h,b3h,55h,59h
+			db	9ah,c6h,2eh,f0h,73h,01h,91h,3eh
+			db	74h,cdh,70h,9fh,48h,27h,8dh,69h
+			db	25h,11h,f1h,4bh,11h,3fh,aeh,8fh
+			db	21h,2fh,92h,3ch,b3h,e6h,80h,deh
+			db	9bh,bdh,93h,3fh,0eh,c7h,54h,e2h
+			db	bbh,6eh,3eh,feh,80h,e8h,d7h,b6h
+			db	82h,1dh,8dh,8dh,0fh,58h,d7h,94h
+			db	1fh,6dh,81h,7ah,c0h,98h,82h,b0h
+			db	afh,01h,f3h,41h,5ah,4fh,e0h,14h
+			db	c6h,6bh,51h,a8h,43h,27h,c4h,1eh
+			db	01h,c7h,a4h,11h,c4h,97h,92h,6eh
+			db	5eh,b2h,adh,f7h,a6h,e0h,c3h,9fh
+			db	cfh,70h,e9h,e9h,d9h,c8h,08h,15h
+			db	f7h,f1h,a9h,75h,5fh,80h,f2h,91h
+			db	f4h,94h,6ch,9ch,1fh,23h,b6h,d1h
+			db	93h,a6h,00h,35h,3ah,c1h,ech,82h
+			db	6dh,48h,eeh,04h,deh,a9h,9dh,75h
+			db	92h,2ch,b6h,c3h,32h,5bh,1ah,d8h
+			db	5fh,22h,e4h,71h,7fh,68h,eah,ach
+			db	49h,71h,58h,c5h,1fh,47h,c8h,bch
+			db	32h,aah,39h,dah,07h,deh,11h,83h
+			db	86h,e1h,bbh,eah,2dh,b8h,5ch,15h
+			db	ebh,c4h,c8h,49h,aah,efh,a3h,afh
+			db	b0h,4ch,38h,bah,d4h,f2h,bfh,cch
+			db	c1h,ddh,85h,edh,50h,0ah,74h,bah
+			db	efh,2ah,adh,82h,90h,f2h,43h,a2h
+			db	44h,c0h,85h,8dh,90h,11h,95h,e2h
+			db	75h,eah,d1h,85h,a5h,a2h,25h,b7h
+			db	75h,cch,22h,5dh,2ch,26h,c6h,65h
+			db	7ch,e0h,deh,4fh,3dh,93h,8ch,3ch
+			db	2fh,60h,eeh,36h,56h,bdh,e1h,21h
+			db	96h,c9h,99h,ach,5bh,85h,f8h,61h
+			db	78h,6ah,26h,8ch,93h,61h,dfh,43h
+			db	99h,08h,77h,14h,a1h,0fh,1ch,00h
+			db	d6h,0ah,0bh,cbh,95h,fch,f2h,b8h
+			db	9bh,e3h,2fh,b4h,5dh,78h,46h,8dh
+			db	12h,1ah,b6h,6eh,0ah,c7h,f6h,bbh
+			db	37h,2fh,33h,e1h,24h,02h,83h,adh
+			db	02h,cch,04h,f7h,11h,9eh,03h,13h
+			db	41h,c8h,8fh,8fh,8bh,a4h,0eh,e1h
+			db	2bh,20h,0dh,feh,9eh,bdh,24h,dbh
+			db	c6h,adh,46h,95h,f5h,6dh,85h,53h
+			db	14h,fch,5dh,3ch,4eh,15h,6bh,46h
+			db	60h,60h,39h,e6h,a8h,d1h,5ah,96h
+			db	07h,b0h,d1h,abh,36h,a5h,e0h,ffh
+			db	4dh,fbh,fah,d1h,03h,a1h,63h,73h
+			db	8ch,cdh,3fh,dbh,dbh,b4h,a3h,dbh
+			db	dbh,25h,9fh,d5h,9ch,6ah,31h,bch
+			db	2bh,c5h,6bh,29h,c6h,22h,98h,ceh
+			db	bdh,87h,d7h,80h,2fh,ach,65h,88h
+			db	93h,91h,beh,4dh,8bh,30h,bfh,c2h
+			db	deh,9eh,e4h,83h,5ch,55h,80h,70h
+			db	eeh,dbh,ddh,10h,c5h,f0h,e0h,42h
+			db	78h,aeh,ffh,09h,dch,a9h,8fh,e4h
+			db	86h,d2h,52h,29h,b3h,16h,17h,39h
+			db	ech,4dh,76h,35h,6dh,04h,11h,85h
+			db	c3h,5bh,23h,5ah,a9h,7eh,b9h,21h
+			db	0ah,78h,04h,d7h,a8h,0dh,6dh,9fh
+			db	12h,55h,92h,55h,f0h,b3h,c5h,9fh
+			db	41h,0ah,a9h,88h,a2h,31h,17h,73h
+			db	edh,58h,b0h,e1h,dbh,a3h,feh,85h
+			db	6fh,06h,27h,d7h,e8h,15h,76h,91h
+			db	9ah,93h,5dh,30h,4fh,e1h,c6h,f2h
+			db	7bh,c0h,76h,b1h,27h,f1h,38h,e2h
+			db	31h,04h,6eh,1bh,15h,00h,9bh,43h
+			db	c6h,70h,e8h,64h,34h,84h,bah,2fh
+			db	98h,bbh,29h,6bh,1ah,b4h,c9h,04h
+			db	49h,90h,c4h,b1h,7fh,beh,5ah,deh
+			db	e0h,67h,d1h,3eh,8dh,57h,17h,3dh
+			db	9dh,f6h,38h,29h,14h,08h,5eh,beh
+			db	1ah,34h,48h,12h,34h,b1h,34h,cch
+			db	63h,b1h,c3h,b9h,9fh,01h,f4h,46h
+			db	fah,e9h,8eh,b2h,24h,97h,b5h,bdh
+			db	39h,cah,68h,a2h,ffh,bdh,4fh,e5h
+			db	06h,75h,60h,31h,73h,e2h,79h,e9h
+			db	3dh,ech,81h,d9h,4ch,60h,31h,02h
+			db	99h,c9h,b1h,30h,a1h,e9h,b9h,c6h
+			db	c0h,52h,feh,c5h,4ch,a5h,eah,d4h
+			db	1bh,83h,e8h,eeh,abh,24h,90h,abh
+			db	cbh,2bh,6fh,7eh,01h,d7h,08h,cah
+			db	3eh,dfh,21h,bah,39h,49h,abh,c0h
+			db	c3h,fbh,25h,6fh,36h,83h,85h,d0h
+			db	e7h,8ch,31h,cch,2eh,7ch,09h,b3h
+			db	0eh,79h,b7h,01h,34h,e2h,d2h,bch
+			db	79h,37h,45h,04h,8bh,f0h,64h,39h
+			db	09h,02h,9fh,55h,3fh,f8h,0bh,afh
+			db	ddh,38h,75h,05h,c3h,bfh,07h,e5h
+			db	03h,a4h,9eh,a5h,eeh,6eh,ebh,f8h
+			db	44h,b7h,04h,05h,07h,2ah,00h,8ch
+			db	94h,52h,10h,0ah,9eh,2fh,a1h,ddh
+			db	52h,c5h,d7h,c0h,2dh,b7h,edh,03h
+			db	15h,ceh,bah,88h,1eh,7ch,33h,b4h
+			db	bch,eeh,a4h,0dh,b1h,d9h,0ch,3ah
+			db	08h,7ch,fbh,58h,eah,f4h,29h,dbh
+			db	15h,81h,d7h,bch,b9h,b9h,d7h,69h
+			db	4ah,fdh,0ch,1bh,22h,1bh,c8h,ech
+			db	66h,9eh,20h,f7h,83h,cfh,3ch,9ch
+			db	96h,d4h,beh,c9h,7ch,29h,0fh,b0h
+			db	bah,d3h,22h,33h,9eh,3ah,6fh,31h
+			db	03h,5ch,f5h,6fh,99h,20h,ffh,83h
+			db	e9h,40h,92h,57h,feh,07h,10h,61h
+			db	5dh,67h,1ah,a5h,84h,82h,f5h,12h
+			db	c3h,cbh,c5h,14h,bbh,11h,50h,72h
+			db	9ch,5ah,2bh,06h,cdh,7dh,3fh,2eh
+			db	b7h,f6h,37h,22h,1ah,8bh,8ah,3bh
+			db	51h,d5h,80h,8ch,a3h,f7h,63h,34h
+			db	05h,a0h,29h,42h,cah,30h,32h,1ch
+			db	7dh,82h,8fh,29h,14h,68h,5eh,02h
+			db	beh,b9h,f5h,88h,a6h,88h,1bh,f1h
+			db	54h,23h,d6h,a8h,00h,6dh,bfh,3ch
+			db	d6h,15h,85h,c8h,cah,deh,46h,71h
+			db	51h,fdh,bfh,f0h,2dh,c3h,22h,12h
+			db	54h,82h,8ch,dbh,c9h,c9h,91h,14h
+			db	c0h,e5h,23h,f5h,28h,82h,90h,46h
+			db	20h,75h,b9h,f4h,77h,6fh,c4h,eah
+			db	5ah,e1h,64h,38h,f3h,76h,62h,88h
+			db	cbh,f3h,2bh,93h,abh,39h,71h,a9h
+			db	b8h,62h,63h,4eh,5dh,a2h,31h,96h
+			db	33h,94h,c4h,78h,4fh,2eh,c9h,7dh
+			db	d8h,e1h,6dh,d8h,fch,a5h,f7h,f1h
+			db	6bh,02h,99h,23h,aah,a9h,f1h,bch
+			db	7fh,04h,b2h,15h,e4h,2eh,a9h,0eh
+			db	5ah,cdh,9bh,7ah,f1h,bbh,8dh,98h
+			db	10h,13h,8fh,32h,fdh,69h,bbh,1eh
+			db	75h,62h,b0h,19h,89h,3ah,dbh,9fh
+			db	54h,81h,65h,6dh,45h,2ah,a6h,45h
+			db	66h,bbh,24h,9bh,36h,2dh,f0h,65h
+			db	9dh,92h,35h,f1h,0fh,c8h,6eh,bdh
+			db	7ah,24h,67h,0eh,45h,fbh,60h,45h
+			db	53h,2ch,b8h,f2h,8ch,53h,67h,59h
+			db	32h,fah,a8h,d3h,96h,ebh,7ch,34h
+			db	efh,40h,c6h,77h,b8h,83h,9fh,b8h
+			db	81h,f1h,c5h,2eh,55h,d2h,5ah,eah
+			db	2ch,bah,36h,77h,d3h,5bh,3ch,e8h
+			db	ebh,13h,abh,d7h,2ch,cfh,5eh,7fh
+			db	3eh,44h,54h,d0h,d7h,e0h,56h,77h
+			db	fch,9ch,b7h,b3h,16h,49h,31h,9ch
+			db	95h,a8h,aah,f0h,3fh,8dh,4fh,2ch
+			db	f1h,f2h,87h,8ah,4fh,36h,dbh,b2h
+			db	e4h,81h,b6h,84h,05h,9bh,dch,89h
+			db	55h,f8h,18h,c5h,f9h,2eh,12h,bah
+			db	92h,81h,54h,7dh,dfh,7ah,1dh,98h
+			db	cbh,cbh,aeh,34h,9ch,0fh,00h,abh
+			db	d1h,1bh,1dh,1dh,5ah,57h,ffh,cch
+			db	b3h,3dh,b8h,77h,68h,24h,20h,37h
+			db	e4h,abh,4fh,05h,fah,e1h,c9h,25h
+			db	97h,21h,14h,79h,71h,fah,c3h,46h
+			db	40h,b0h,5ch,48h,64h,06h,dah,80h
+			db	57h,45h,09h,1ch,bah,bdh,3bh,cch
+			db	a7h,f5h,cch,62h,e4h,7ah,02h,64h
+			db	56h,b9h,9bh,81h,03h,c0h,34h,05h
+			db	68h,9fh,74h,a3h,06h,3eh,30h,24h
+			db	08h,dah,49h,09h,77h,c4h,a4h,dfh
+			db	6ch,2bh,39h,d3h,89h,49h,61h,57h
+			db	f8h,0dh,ceh,4fh,a7h,43h,86h,53h
+			db	41h,51h,0ah,48h,53h,edh,92h,9bh
+			db	d0h,dch,0dh,5ah,36h,3fh,abh,e8h
+			db	e3h,c1h,22h,9dh,3ch,56h,edh,7bh
+			db	10h,b0h,6ch,77h,23h,88h,90h,b8h
+			db	95h,6ch,85h,a1h,cah,2ah,7dh,9ah
+			db	a2h,d0h,c3h,abh,e6h,06h,8ah,64h
+			db	46h,b3h,fch,26h,9ch,b6h,f6h,4ch
+			db	3bh,5ah,54h,5bh,bch,c0h,f3h,74h
+			db	4eh,c9h,62h,9dh,38h,8eh,d3h,f7h
+			db	8ah,38h,3fh,c6h,44h,26h,afh,98h
+			db	b2h,dfh,1eh,f5h,88h,89h,1bh,b7h
+			db	40h,b9h,0fh,70h,b6h,ceh,46h,aeh
+			db	dah,4bh,06h,f3h,e8h,1ah,bbh,8eh
+			db	d0h,5fh,73h,3eh,a1h,dbh,b5h,23h
+			db	14h,16h,c5h,7bh,b9h,eeh,42h,54h
+			db	d8h,57h,7bh,fbh,19h,8dh,ddh,c7h
+			db	21h,45h,b4h,e3h,6bh,4fh,f3h,d0h
+			db	02h,31h,d0h,74h,4ah,fch,1dh,25h
+			db	13h,49h,fah,e1h,10h,b8h,1ch,99h
+			db	6fh,8ch,aah,21h,5fh,88h,5ah,81h
+			db	e4h,95h,e7h,98h,3eh,a7h,07h,b4h
+			db	e6h,65h,9eh,2fh,52h,33h,a1h,79h
+			db	07h,9eh,9fh,f5h,a7h,51h,4fh,f3h
+			db	4bh,d7h,63h,cdh,37h,01h,93h,0bh
+			db	1eh,a3h,f8h,64h,6eh,afh,dbh,5fh
+			db	e4h,02h,a3h,9eh,efh,fah,5eh,2ah
+			db	99h,8ch,4ch,1fh,e8h,cch,73h,ddh
+			db	31h,68h,d8h,65h,10h,b8h,beh,c6h
+			db	94h,32h,2bh,18h,64h,ech,92h,60h
+			db	f2h,37h,73h,06h,c8h,49h,2eh,52h
+			db	8eh,b7h,21h,84h,33h,efh,c5h,9fh
+			db	79h,a6h,ddh,dch,1eh,52h,8ch,b5h
+			db	74h,3fh,95h,8dh,60h,4fh,7dh,75h
+			db	57h,9dh,20h,1fh,a4h,e8h,f3h,c5h
+			db	2ah,f2h,3fh,fch,30h,42h,38h,3dh
+			db	88h,ebh,e7h,abh,10h,76h,42h,5fh
+			db	89h,ffh,7fh,44h,0ah,a2h,20h,f7h
+			db	73h,73h,b5h,c0h,85h,9dh,15h,9bh
+			db	97h,23h,5fh,0eh,4eh,4eh,28h,b6h
+			db	00h,13h,4dh,94h,c0h,55h,95h,1eh
+			db	19h,d2h,b3h,d5h,e5h,4dh,cah,0dh
+			db	59h,b4h,92h,b8h,adh,c9h,c1h,d2h
+			db	c0h,d3h,7eh,56h,cah,24h,e0h,98h
+			db	3ah,cdh,16h,41h,58h,54h,37h,6bh
+			db	4ch,2dh,e7h,99h,4fh,3ch,5ch,26h
+			db	fdh,bfh,aah,95h,d4h,f2h,bch,e7h
+			db	67h,12h,86h,61h,6dh,9bh,efh,0fh
+			db	36h,efh,ech,13h,a0h,6bh,b1h,2eh
+			db	e5h,68h,08h,1bh,9fh,30h,25h,ffh
+			db	46h,a0h,45h,bfh,02h,23h,0fh,c9h
+			db	90h,cch,9ah,43h,2ch,46h,d7h,7ah
+			db	f7h,75h,44h,b2h,37h,28h,b1h,7ah
+			db	a9h,92h,73h,14h,dch,46h,68h,cdh
+			db	5dh,c1h,9eh,5dh,abh,89h,2ah,beh
+			db	89h,23h,2fh,dbh,72h,9fh,f9h,8ch
+			db	f3h,bah,8ah,d6h,e7h,76h,16h,ech
+			db	0eh,aeh,b9h,10h,32h,d5h,33h,26h
+			db	92h,32h,5fh,22h,10h,a0h,bfh,dbh
+			db	8fh,c8h,f0h,62h,91h,87h,a9h,b7h
+			db	0fh,71h,59h,74h,ddh,a0h,88h,84h
+			db	b0h,14h,5bh,beh,b7h,f6h,3ah,e7h
+			db	e5h,4ah,c2h,40h,07h,5bh,cfh,76h
+			db	a4h,5eh,98h,a8h,5dh,5dh,b1h,b0h
+			db	2ah,cbh,d0h,e2h,19h,eah,30h,8fh
+			db	48h,f6h,08h,abh,4dh,53h,6ch,58h
+			db	c1h,12h,d8h,d2h,1bh,f4h,44h,bch
+			db	f0h,67h,38h,89h,d4h,74h,b7h,5ch
+			db	1ah,b0h,70h,85h,11h,76h,2eh,4ch
+			db	f9h,b3h,bfh,94h,78h,d2h,31h,afh
+			db	a2h,c2h,0bh,20h,78h,84h,83h,92h
+			db	4ah,40h,6eh,b2h,44h,03h,d2h,54h
+			db	c6h,cbh,17h,b6h,5eh,dbh,41h,0ah
+			db	bfh,5ch,15h,72h,78h,cah,7ah,dfh
+			db	a0h,34h,6bh,ebh,1fh,1dh,30h,f5h
+			db	16h,c1h,71h,d8h,21h,76h,78h,21h
+			db	7ah,8ah,20h,05h,64h,6fh,4fh,0ch
+			db	cah,b5h,e0h,45h,06h,46h,9ch,7dh
+			db	8dh,6eh,efh,06h,a6h,d2h,e6h,08h
+			db	83h,a7h,29h,8dh,a5h,14h,81h,08h
+			db	69h,34h,b1h,84h,bbh,06h,68h,9eh
+			db	d7h,08h,a2h,3ah,4ch,48h,4fh,3fh
+			db	d2h,c4h,adh,e8h,cfh,f3h,f1h,74h
+			db	4eh,03h,70h,b6h,95h,35h,aeh,beh
+			db	feh,ebh,b8h,c3h,6ch,7bh,e1h,8ah
+			db	c0h,31h,aah,6bh,e8h,79h,29h,82h
+			db	97h,4ch,98h,92h,e5h,18h,97h,69h
+			db	f5h,b3h,f4h,74h,fbh,6fh,04h,c3h
+			db	85h,6fh,afh,61h,2ch,d1h,73h,57h
+			db	09h,6eh,feh,3eh,17h,22h,afh,b9h
+			db	70h,14h,d9h,52h,d0h,8dh,7ch,6bh
+			db	40h,d0h,86h,89h,9bh,adh,4ah,13h
+			db	cdh,aeh,e4h,d7h,c1h,11h,3ch,a9h
+			db	62h,b5h,d5h,95h,dfh,99h,98h,0bh
+			db	a6h,3bh,7fh,56h,e1h,aeh,15h,7ch
+			db	9dh,8ch,b7h,74h,8dh,47h,a8h,c3h
+			db	0ch,53h,b2h,34h,e2h,0dh,f1h,b0h
+			db	8bh,f1h,7ah,8bh,48h,f3h,4eh,bah
+			db	b7h,ebh,b9h,f3h,e5h,59h,0fh,b8h
+			db	dah,b2h,f5h,b5h,05h,4dh,44h,3dh
+			db	8ah,06h,24h,fdh,ceh,11h,f8h,c1h
+			db	19h,80h,23h,01h,0ah,73h,6ch,9eh
+			db	5eh,a6h,ach,70h,01h,42h,c0h,dfh
+			db	42h,33h,fah,f2h,67h,aah,9ch,2fh
+			db	beh,e9h,62h,56h,f3h,28h,48h,34h
+			db	88h,a1h,f4h,7bh,c0h,e0h,eeh,7dh
+			db	8eh,d1h,ebh,cfh,93h,d6h,23h,ebh
+			db	c4h,2bh,1bh,32h,e5h,1dh,54h,89h
+			db	ach,e3h,f7h,46h,e3h,4ah,eeh,a3h
+			db	cah,56h,6ah,63h,82h,9ah,bch,a2h
+			db	8ah,20h,75h,91h,50h,bbh,09h,84h
+			db	08h,d0h,41h,55h,1dh,f7h,40h,99h
+			db	65h,50h,38h,4ch,88h,d4h,25h,22h
+			db	f3h,c3h,51h,55h,38h,15h,35h,2fh
+			db	06h,53h,9fh,ech,c8h,65h,6fh,6fh
+			db	fdh,c4h,a8h,e8h,19h,ebh,f1h,5ch
+			db	8dh,36h,dah,57h,c5h,02h,01h,aah
+			db	b2h,f7h,83h,aah,a2h,9dh,33h,1ch
+			db	9bh,d0h,a9h,8eh,0ah,70h,d1h,88h
+			db	00h,9ah,eeh,80h,d7h,64h,80h,0bh
+			db	2eh,69h,b9h,0bh,0eh,87h,53h,4eh
+			db	ach,11h,66h,bbh,f9h,c4h,78h,8ch
+			db	dbh,2fh,50h,d6h,2ah,4bh,5fh,09h
+			db	d9h,4ah,bbh,1bh,76h,7ah,54h,4dh
+			db	7bh,e7h,01h,93h,35h,6eh,bbh,e3h
+			db	ebh,02h,67h,d6h,9fh,abh,8ch,bfh
+			db	26h,e7h,b8h,38h,0fh,73h,6bh,90h
+			db	30h,90h,adh,8dh,bfh,51h,9eh,97h
+			db	9dh,ach,24h,d4h,01h,b8h,70h,abh
+			db	39h,2ah,a3h,a7h,bch,e7h,a9h,98h
+			db	8dh,aah,48h,e4h,cah,3bh,f1h,a4h
+			db	8ch,67h,c9h,67h,a0h,dbh,1bh,95h
+			db	f1h,64h,06h,70h,88h,30h,6ch,85h
+			db	1ah,e5h,81h,46h,0bh,49h,5ah,1ah
+			db	2ch,bfh,60h,8fh,c0h,0fh,6ah,5bh
+			db	7ah,d2h,57h,51h,46h,a6h,66h,deh
+			db	8ah,49h,69h,feh,a3h,39h,e8h,91h
+			db	aah,09h,a0h,a0h,7bh,b7h,c8h,a2h
+			db	1ch,d8h,66h,9ch,70h,50h,24h,dah
+			db	e8h,1bh,a3h,d8h,35h,d5h,a4h,35h
+			db	96h,61h,b1h,b1h,15h,94h,f5h,67h
+			db	7eh,c9h,1ah,81h,32h,61h,31h,edh
+			db	ceh,dah,fdh,b2h,bfh,8dh,7eh,13h
+			db	d2h,64h,fch,bbh,25h,3bh,f8h,4dh
+			db	54h,dfh,e8h,52h,fch,51h,93h,7eh
+			db	47h,beh,0ch,d6h,b1h,2eh,dfh,14h
+			db	6dh,43h,04h,76h,2fh,84h,cdh,16h
+			db	bch,7eh,b3h,75h,8fh,68h,32h,54h
+			db	40h,24h,46h,7dh,c2h,bch,feh,42h
+			db	feh,ddh,90h,56h,77h,69h,60h,56h
+			db	47h,2bh,4dh,c5h,ffh,f1h,7ch,2bh
+			db	6eh,1ch,c9h,cch,95h,0fh,d0h,74h
+			db	8bh,86h,27h,21h,c0h,98h,7eh,52h
+			db	11h,3eh,6dh,45h,c4h,0ah,fch,22h
+			db	e1h,5bh,6eh,8eh,0dh,48h,09h,e3h
+			db	1eh,9eh,86h,71h,2bh,afh,23h,1ah
+			db	a5h,33h,b2h,0ch,67h,8bh,83h,bdh
+			db	54h,39h,74h,e1h,feh,0dh,77h,62h
+			db	87h,94h,20h,9fh,7ch,27h,34h,20h
+			db	31h,18h,0fh,afh,9fh,bch,82h,39h
+			db	6ch,2bh,44h,fdh,63h,f3h,52h,15h
+			db	46h,4ch,aah,18h,99h,90h,e7h,a9h
+			db	fah,5ah,f6h,b4h,e3h,c1h,72h,3bh
+			db	7bh,75h,abh,69h,8ch,49h,e1h,75h
+			db	6fh,7dh,8bh,deh,99h,1bh,31h,8ah
+			db	8bh,58h,e7h,4ah,bbh,0dh,84h,f9h
+			db	11h,51h,c7h,23h,06h,56h,09h,b6h
+			db	50h,8bh,ech,b7h,96h,a2h,c5h,e4h
+			db	bdh,01h,cbh,f0h,8ah,53h,deh,05h
+			db	3ah,2ch,b3h,8eh,1dh,feh,1bh,75h
+			db	e6h,93h,80h,73h,fbh,28h,f3h,c5h
+			db	07h,b4h,71h,f4h,18h,c6h,29h,bah
+			db	60h,9bh,39h,7ah,e9h,b0h,ach,75h
+			db	09h,b6h,2ah,d2h,c1h,15h,17h,2eh
+			db	6eh,a1h,a4h,bah,88h,10h,d3h,ffh
+			db	21h,90h,f0h,80h,5dh,f8h,44h,69h
+			db	f5h,17h,61h,29h,a4h,63h,a7h,87h
+			db	48h,02h,a8h,c0h,09h,afh,b5h,35h
+			db	bdh,9dh,92h,4bh,3fh,85h,05h,e3h
+			db	e6h,0ah,52h,20h,7fh,3bh,7ch,56h
+			db	4dh,4dh,d9h,aeh,6eh,14h,78h,25h
+			db	ech,a9h,b9h,b2h,c2h,33h,f6h,01h
+			db	abh,c4h,20h,cah,ach,74h,b9h,d3h
+			db	ech,5dh,dah,e5h,cfh,2eh,efh,d4h
+			db	4fh,dch,efh,7dh,bah,9bh,35h,9bh
+			db	49h,c7h,e6h,8ch,7ch,19h,42h,4eh
+			db	39h,deh,b8h,fah,5eh,ech,a3h,4bh
+			db	f2h,7fh,ceh,d2h,70h,68h,14h,8bh
+			db	4bh,0eh,02h,7bh,63h,07h,3fh,bdh
+			db	f8h,bdh,20h,adh,35h,64h,f2h,97h
+			db	d2h,34h,2ah,15h,c1h,f8h,d7h,34h
+			db	94h,01h,17h,f9h,65h,5ch,e4h,6ah
+			db	39h,d2h,87h,d1h,d3h,b4h,0fh,f8h
+			db	aah,07h,7eh,8eh,2fh,56h,14h,67h
+			db	cdh,5ch,4dh,ach,49h,54h,dch,f1h
+			db	5fh,46h,aeh,16h,5bh,dah,27h,00h
+			db	9dh,1dh,93h,f2h,99h,8fh,5eh,b2h
+			db	b8h,33h,02h,3eh,12h,7ah,8dh,0dh
+			db	3ch,87h,9ch,ech,22h,85h,0bh,f2h
+			db	3eh,87h,6ah,e0h,5ch,ebh,c4h,aeh
+			db	94h,22h,bbh,01h,50h,6ch,24h,d2h
+			db	87h,11h,34h,0bh,72h,b0h,71h,a2h
+			db	58h,6ch,dfh,05h,aah,6bh,34h,70h
+			db	6dh,3eh,5dh,91h,76h,42h,22h,eeh
+			db	bbh,69h,f1h,b7h,02h,04h,81h,4fh
+			db	7ah,c4h,9eh,55h,9dh,87h,1ah,9ch
+			db	9fh,87h,6ch,0dh,27h,77h,f7h,3fh
+			db	0dh,cbh,15h,71h,45h,a3h,40h,24h
+			db	cdh,24h,adh,deh,8eh,05h,64h,cah
+			db	28h,69h,13h,c6h,54h,a3h,45h,c6h
+			db	8bh,fdh,4fh,d6h,c8h,81h,a1h,d7h
+			db	3eh,4bh,18h,37h,9ch,b8h,adh,cch
+			db	24h,deh,42h,80h,e0h,70h,5fh,2ch
+			db	6eh,0dh,d1h,1bh,ffh,bfh,89h,10h
+			db	bch,1fh,31h,02h,50h,05h,dch,23h
+			db	25h,97h,b1h,56h,dch,dfh,4eh,f6h
+			db	d5h,6ch,c4h,f9h,edh,91h,96h,afh
+			db	24h,3fh,91h,36h,26h,e8h,c1h,d3h
+			db	6ah,8bh,eah,0dh,b5h,0fh,e2h,1eh
+			db	7ah,37h,bch,5fh,23h,dbh,59h,fah
+			db	f4h,d3h,83h,c5h,ddh,68h,62h,c6h
+			db	46h,78h,12h,14h,4ah,5dh,e5h,e7h
+			db	41h,e6h,e4h,03h,d8h,c8h,e9h,edh
+			db	d1h,55h,25h,68h,f2h,80h,9eh,a8h
+			db	2eh,0bh,feh,60h,ebh,18h,84h,68h
+			db	16h,90h,99h,a5h,28h,10h,0ah,6ch
+			db	2dh,9dh,abh,9fh,27h,dah,f9h,edh
+			db	96h,e6h,18h,6bh,0dh,3ch,55h,75h
+			db	67h,edh,fch,6eh,f7h,48h,0ch,a5h
+			db	28h,c0h,e2h,ceh,35h,5bh,4fh,77h
+			db	2dh,e8h,2dh,83h,aah,02h,54h,ech
+			db	d9h,b1h,67h,f4h,f7h,0eh,5fh,edh
+			db	ddh,9bh,62h,d6h,5bh,5eh,37h,5ch
+			db	0eh,a9h,a7h,7ah,0bh,59h,46h,e8h
+			db	fbh,04h,44h,aah,a7h,fdh,7eh,ech
+			db	3fh,dbh,c9h,e4h,2fh,cbh,1ch,21h
+			db	94h,c5h,0ah,9ch,d2h,b1h,31h,61h
+			db	0fh,29h,6fh,05h,18h,0dh,e5h,11h
+			db	a1h,d4h,27h,87h,2ah,21h,a2h,70h
+			db	bah,dbh,b2h,00h,14h,40h,d4h,d4h
+			db	58h,36h,c7h,c3h,2bh,f9h,d5h,6dh
+			db	7ah,f5h,85h,2fh,5dh,5dh,0fh,edh
+			db	23h,1fh,85h,cch,d6h,29h,75h,13h
+			db	77h,1dh,b6h,61h,87h,e9h,5ah,b7h
+			db	51h,f8h,66h,f2h,49h,f9h,4ch,4ch
+			db	87h,79h,25h,99h,83h,02h,b0h,72h
+			db	dfh,43h,2ch,ech,60h,34h,a5h,51h
+			db	ech,1dh,e8h,35h,4fh,54h,43h,58h
+			db	0eh,20h,ddh,42h,d6h,85h,a5h,78h
+			db	93h,b9h,39h,02h,fdh,ddh,75h,d6h
+			db	2eh,9eh,44h,75h,8ah,1dh,2ah,e7h
+			db	fdh,84h,1ch,30h,81h,51h,83h,45h
+			db	3fh,90h,bbh,71h,65h,69h,38h,aah
+			db	b7h,05h,c2h,48h,05h,87h,b3h,5ah
+			db	3eh,83h,f4h,6ah,24h,6dh,0ch,5bh
+			db	88h,62h,51h,6eh,21h,ddh,6ah,89h
+			db	2bh,89h,f4h,8ch,f0h,d0h,29h,d5h
+			db	6ah,70h,81h,28h,cbh,e8h,fah,a3h
+			db	22h,47h,c3h,58h,7eh,1eh,ebh,2dh
+			db	9dh,3ch,01h,24h,35h,32h,fch,63h
+			db	43h,82h,7fh,64h,22h,03h,aeh,68h
+			db	9fh,7eh,10h,46h,d3h,1ah,2bh,0ch
+			db	d7h,f9h,0fh,c3h,0bh,4dh,1bh,e6h
+			db	55h,04h,dfh,e7h,8ch,a5h,94h,a1h
+			db	43h,61h,adh,e8h,6ch,83h,78h,fdh
+			db	23h,dah,8eh,68h,0eh,41h,cfh,32h
+			db	69h,b9h,20h,d6h,92h,ffh,69h,90h
+			db	09h,adh,ebh,04h,3ah,b6h,e2h,50h
+			db	b1h,06h,7dh,40h,cdh,46h,2ch,adh
+			db	23h,59h,99h,bah,f9h,27h,cbh,4fh
+			db	30h,4fh,97h,84h,b3h,2bh,f1h,c3h
+			db	41h,feh,d8h,b8h,13h,a8h,f3h,b7h
+			db	26h,8ah,deh,53h,02h,a1h,96h,efh
+			db	66h,61h,a7h,41h,70h,0ch,4dh,25h
+			db	57h,82h,cfh,cdh,e7h,c3h,b1h,0dh
+			db	4dh,4bh,cch,50h,33h,7fh,40h,0ah
+			db	4ch,90h,ffh,bbh,69h,58h,71h,52h
+			db	bah,29h,d7h,e5h,02h,cdh,24h,c3h
+			db	e7h,02h,1eh,45h,bfh,44h,b8h,c6h
+			db	13h,b9h,12h,6ah,e0h,efh,47h,e5h
+			db	06h,9bh,ffh,9ah,ech,0dh,62h,abh
+			db	47h,78h,cah,a0h,3eh,adh,34h,02h
+			db	89h,3dh,24h,7bh,36h,d3h,1dh,75h
+			db	a5h,b9h,31h,6fh,f1h,cch,32h,a7h
+			db	fdh,54h,beh,4fh,53h,28h,39h,39h
+			db	40h,d8h,3ah,3eh,64h,aah,65h,cah
+			db	a1h,e6h,7ah,d1h,06h,1dh,d9h,afh
+			db	5bh,a3h,a8h,efh,d7h,6fh,45h,dbh
+			db	a0h,f8h,ech,67h,c6h,4fh,89h,57h
+			db	2eh,ech,76h,6ch,bah,8eh,08h,a3h
+			db	b1h,87h,0eh,6fh,4dh,15h,33h,bbh
+			db	a6h,1fh,12h,73h,b1h,60h,23h,3ch
+			db	bch,ebh,8dh,e2h,a3h,1ch,a4h,a2h
+			db	adh,6eh,cah,afh,a4h,53h,c2h,75h
+			db	3dh,02h,34h,2ah,2bh,49h,a0h,c4h
+			db	f9h,ddh,20h,65h,75h,e7h,5ch,74h
+			db	67h,41h,7ah,0fh,27h,b8h,0ch,0dh
+			db	dch,14h,5ah,5fh,93h,6dh,fdh,76h
+			db	33h,35h,1dh,96h,11h,88h,3eh,70h
+			db	98h,9eh,97h,f0h,1bh,6ch,9fh,d5h
+			db	a3h,22h,38h,85h,0fh,3ah,8eh,dfh
+			db	9ch,46h,65h,68h,c2h,10h,2ah,19h
+			db	6bh,00h,d5h,e2h,10h,95h,feh,3ah
+			db	01h,a6h,c0h,51h,b3h,47h,7dh,eeh
+			db	93h,99h,8ah,80h,d3h,73h,04h,54h
+			db	47h,84h,14h,ddh,37h,f4h,9fh,d1h
+			db	82h,fah,2bh,20h,82h,88h,d5h,6fh
+			db	2dh,8ch,93h,48h,13h,c9h,f3h,a3h
+			db	72h,a9h,b3h,70h,75h,80h,70h,10h
+			db	e6h,dfh,09h,06h,c4h,8eh,afh,74h
+			db	37h,a5h,a2h,e8h,e9h,56h,39h,27h
+			db	b0h,15h,71h,91h,f0h,a1h,cdh,17h
+			db	07h,27h,1fh,f4h,5dh,64h,e4h,33h
+			db	3fh,f9h,bch,1bh,60h,b9h,ddh,5fh
+			db	f4h,20h,5eh,6fh,88h,99h,73h,c5h
+			db	bfh,4dh,82h,cfh,fch,d5h,f7h,5bh
+			db	b8h,30h,f2h,02h,aah,0fh,d1h,46h
+			db	b8h,d9h,59h,fdh,35h,4bh,abh,c7h
+			db	98h,53h,16h,aah,9fh,b8h,22h,01h
+			db	a1h,17h,60h,f7h,50h,5ah,37h,d9h
+			db	d5h,41h,13h,0bh,d1h,34h,c1h,f4h
+			db	37h,0ch,34h,d8h,a3h,21h,97h,b6h
+			db	d2h,97h,c4h,9fh,62h,fah,13h,d4h
+			db	edh,43h,0dh,fbh,efh,f6h,96h,97h
+			db	47h,f3h,16h,1ch,e6h,7ah,d3h,d8h
+			db	5ch,dah,11h,53h,cfh,12h,ach,1eh
+			db	b5h,f9h,5eh,ddh,74h,adh,4dh,53h
+			db	1ch,f4h,86h,cdh,5fh,c8h,f1h,7ch
+			db	fah,5dh,2eh,01h,45h,a5h,8ch,0dh
+			db	5eh,aah,53h,bah,e5h,55h,30h,d9h
+			db	0ah,1dh,74h,97h,18h,b1h,42h,7bh
+			db	82h,c9h,75h,a7h,36h,ebh,2bh,a1h
+			db	aeh,28h,bbh,91h,d9h,4eh,b3h,efh
+			db	45h,6ah,4dh,beh,a1h,f7h,dbh,cdh
+			db	79h,1ch,dbh,aah,7ch,ffh,ebh,1eh
+			db	39h,6dh,15h,91h,3fh,f8h,21h,29h
+			db	53h,23h,35h,adh,3ah,c2h,b7h,d7h
+			db	1eh,46h,b9h,22h,bfh,60h,f3h,86h
+			db	97h,d8h,9ch,72h,29h,4bh,fdh,8ah
+			db	7eh,3dh,4dh,41h,4fh,c8h,62h,98h
+			db	2bh,c8h,92h,74h,19h,4ch,68h,dbh
+			db	84h,d7h,18h,dch,e4h,75h,2ch,1ah
+			db	dfh,ceh,9fh,afh,03h,47h,84h,59h
+			db	beh,ach,8bh,5fh,48h,80h,0eh,52h
+			db	53h,11h,98h,e0h,f4h,f9h,05h,f6h
+			db	dch,6ch,c5h,cah,88h,b7h,2ah,32h
+			db	adh,44h,d2h,2fh,9ch,30h,e3h,77h
+			db	71h,dah,91h,65h,3bh,7eh,75h,06h
+			db	66h,f4h,13h,bch,06h,15h,afh,22h
+			db	a3h,65h,14h,b5h,cfh,6dh,27h,5eh
+			db	b9h,4fh,54h,02h,1bh,e7h,c9h,f9h
+			db	81h,40h,25h,edh,64h,f7h,4dh,35h
+			db	f5h,61h,e1h,35h,16h,52h,0dh,69h
+			db	43h,81h,f1h,03h,83h,98h,b1h,24h
+			db	98h,dfh,73h,6ch,72h,5ah,5eh,55h
+			db	3ah,dbh,51h,3ah,1eh,dah,13h,1dh
+			db	e8h,06h,5ch,14h,cbh,f2h,c3h,edh
+			db	5fh,34h,96h,0ah,fdh,c5h,eeh,c6h
+			db	89h,5eh,67h,72h,2dh,38h,f5h,d6h
+			db	29h,51h,0eh,61h,fah,cch,90h,42h
+			db	89h,edh,e7h,72h,e4h,5fh,fch,58h
+			db	73h,d7h,70h,60h,bfh,7eh,dch,a5h
+			db	cah,e0h,45h,0bh,d2h,c8h,a4h,73h
+			db	05h,e9h,13h,b6h,d4h,2dh,5fh,22h
+			db	54h,67h,b3h,03h,94h,07h,98h,efh
+			db	4bh,ach,a7h,7ch,60h,01h,80h,6bh
+			db	0dh,d5h,bch,6fh,ceh,ebh,0ch,54h
+			db	16h,85h,57h,eah,c5h,44h,dbh,79h
+			db	80h,3ch,5ch,0fh,f9h,dfh,c1h,e5h
+			db	5dh,91h,a3h,eeh,d1h,2eh,dch,27h
+			db	e2h,7ah,48h,afh,a8h,3fh,7bh,a0h
+			db	08h,4ah,14h,d8h,d4h,6ch,c9h,ffh
+			db	4bh,cfh,7ch,cdh,d1h,cdh,3ah,d0h
+			db	91h,84h,8ah,50h,efh,c0h,b0h,f3h
+			db	f5h,b8h,9dh,5ah,03h,4fh,5dh,e4h
+			db	6ch,bah,ddh,fah,62h,8eh,62h,98h
+			db	f1h,d4h,44h,07h,00h,04h,7ch,9dh
+			db	beh,05h,0ch,09h,39h,44h,21h,1bh
+			db	44h,50h,67h,83h,6dh,33h,aah,30h
+			db	22h,ddh,4ch,55h,0fh,5bh,d7h,1ch
+			db	e2h,feh,65h,f4h,d3h,d6h,42h,b1h
+			db	a5h,edh,28h,22h,deh,d7h,cah,05h
+			db	0bh,75h,f2h,4eh,76h,b1h,f7h,9dh
+			db	1eh,54h,f2h,9ah,f0h,61h,0ch,c4h
+			db	73h,02h,01h,a5h,dch,5dh,38h,02h
+			db	eeh,97h,2ah,b5h,6fh,1dh,b0h,ebh
+			db	3ah,30h,9bh,9bh,a4h,15h,bdh,94h
+			db	c6h,75h,28h,ceh,09h,f5h,1eh,1dh
+			db	81h,a2h,19h,b6h,39h,b1h,edh,c6h
+			db	5ch,43h,39h,c7h,7fh,2bh,6ch,79h
+			db	0ch,d3h,a5h,1eh,f0h,68h,54h,07h
+			db	1dh,ceh,d3h,65h,18h,a0h,81h,f3h
+			db	9dh,9ch,fbh,ech,d3h,5dh,44h,92h
+			db	3dh,23h,88h,f9h,abh,59h,8ch,6eh
+			db	dah,a8h,3fh,6eh,deh,5ch,e7h,85h
+			db	78h,55h,a3h,99h,9ah,51h,f0h,8eh
+			db	2ah,c5h,a6h,e2h,c6h,c4h,4dh,d7h
+			db	f1h,7dh,3ah,35h,d3h,39h,a5h,24h
+			db	46h,5eh,43h,6ch,94h,a4h,cch,51h
+			db	dfh,72h,99h,bbh,f1h,ffh,e0h,65h
+			db	f0h,69h,62h,95h,b6h,4eh,a3h,7dh
+			db	e9h,25h,dbh,15h,98h,7ch,21h,c7h
+			db	4ch,30h,bbh,ddh,15h,58h,34h,a4h
+			db	b7h,32h,53h,68h,7eh,f7h,f8h,4eh
+			db	edh,efh,fbh,26h,89h,deh,45h,edh
+			db	d6h,96h,35h,09h,d4h,8ah,06h,efh
+			db	48h,ddh,10h,3fh,8dh,96h,0ah,a4h
+			db	cfh,12h,46h,aeh,f6h,03h,8ah,3eh
+			db	13h,f2h,e0h,16h,7ch,16h,efh,92h
+			db	e0h,36h,3bh,07h,36h,2dh,a5h,81h
+			db	90h,9bh,72h,74h,0eh,f3h,54h,65h
+			db	19h,98h,2bh,c9h,b5h,20h,52h,62h
+			db	8eh,70h,0ch,4eh,82h,eah,c1h,67h
+			db	e7h,21h,55h,39h,f0h,bch,ebh,10h
+			db	f1h,03h,80h,f2h,12h,ddh,69h,f8h
+			db	fbh,54h,19h,d6h,a1h,a1h,ech,bch
+			db	90h,6ah,41h,9ch,3ch,66h,4bh,a2h
+			db	d0h,33h,83h,8ah,b0h,70h,62h,32h
+			db	2dh,93h,f4h,8ch,46h,54h,a5h,aah
+			db	02h,22h,f1h,82h,99h,b7h,5ah,58h
+			db	bah,62h,c1h,8dh,11h,17h,d3h,3eh
+			db	f9h,b1h,c6h,b5h,7ch,94h,adh,47h
+			db	2bh,d7h,e3h,23h,4bh,c9h,dfh,f0h
+			db	edh,91h,ech,29h,47h,dbh,b0h,84h
+			db	34h,9ah,cch,beh,c7h,24h,3fh,edh
+			db	27h,02h,5bh,b7h,96h,f7h,f4h,93h
+			db	e3h,0eh,53h,46h,e7h,b3h,7dh,cbh
+			db	e3h,66h,ebh,c7h,4eh,02h,50h,50h
+			db	c5h,2ch,dbh,16h,3fh,e1h,73h,73h
+			db	c1h,b3h,40h,10h,05h,27h,10h,b0h
+			db	bdh,2bh,f2h,3eh,8fh,86h,a5h,fbh
+			db	23h,ffh,9ah,02h,c3h,bfh,aeh,6ah
+			db	0fh,8ch,fdh,e2h,e4h,beh,d0h,75h
+			db	7fh,0dh,13h,bfh,6fh,f5h,d7h,95h
+			db	c4h,87h,c3h,21h,82h,9dh,5fh,0dh
+			db	95h,e6h,d7h,50h,2fh,e9h,bch,bdh
+			db	e6h,7ch,b9h,33h,deh,d5h,bah,43h
+			db	18h,b1h,c7h,08h,f5h,e8h,44h,a0h
+			db	3bh,edh,1eh,d1h,e3h,9ch,79h,74h
+			db	b7h,3bh,c6h,ceh,32h,98h,c9h,58h
+			db	a5h,28h,38h,36h,62h,d7h,2bh,bah
+			db	dfh,56h,a4h,d0h,6fh,d6h,bah,90h
+			db	ceh,92h,a3h,dah,f2h,90h,b6h,47h
+			db	5bh,13h,35h,7bh,63h,74h,0fh,32h
+			db	f6h,f9h,b7h,64h,c1h,c9h,8eh,ddh
+			db	f4h,d2h,c5h,d0h,9fh,23h,f8h,d9h
+			db	62h,b3h,f9h,fdh,8fh,79h,1dh,0fh
+			db	2eh,69h,85h,7fh,20h,98h,51h,f4h
+			db	48h,79h,edh,a9h,b2h,c5h,b4h,beh
+			db	d0h,0dh,c5h,8eh,c2h,5eh,c8h,27h
+			db	60h,26h,20h,e2h,45h,f0h,abh,88h
+			db	b2h,b0h,5ah,72h,a4h,b5h,d7h,aah
+			db	25h,cfh,23h,42h,31h,6eh,7dh,adh
+			db	47h,dfh,bah,ddh,c9h,eeh,bdh,78h
+			db	62h,9dh,43h,e4h,efh,e5h,5bh,d4h
+			db	e6h,4ah,3bh,37h,15h,adh,66h,24h
+			db	c3h,1ch,6fh,32h,b2h,8ch,26h,51h
+			db	1fh,99h,3fh,e3h,63h,1fh,1ah,55h
+			db	1eh,04h,5bh,37h,a3h,dch,8fh,2bh
+			db	49h,12h,e8h,22h,1ah,37h,72h,ach
+			db	66h,dch,13h,f0h,aah,2eh,c6h,99h
+			db	97h,74h,a3h,f2h,4eh,74h,bch,2ah
+			db	dch,fch,8fh,dbh,d9h,4ch,c3h,98h
+			db	3fh,75h,d0h,27h,1fh,7ch,7ch,22h
+			db	72h,0dh,64h,62h,79h,ach,10h,08h
+			db	67h,d0h,4dh,34h,99h,bfh,13h,b2h
+			db	d9h,f6h,aeh,41h,3ch,60h,92h,fbh
+			db	ceh,afh,25h,b6h,93h,60h,a5h,d4h
+			db	f2h,1ch,97h,e1h,68h,3fh,3ah,aeh
+			db	3eh,e3h,58h,f4h,abh,ceh,03h,b8h
+			db	ffh,b4h,0ch,2fh,87h,a6h,3ch,24h
+			db	8ch,0bh,08h,29h,56h,0ch,a4h,f2h
+			db	cch,10h,13h,bbh,98h,7dh,a7h,89h
+			db	5bh,d6h,76h,ebh,e8h,4bh,95h,beh
+			db	14h,54h,54h,88h,f3h,c8h,98h,6ch
+			db	d0h,63h,78h,25h,e6h,39h,2dh,37h
+			db	c9h,12h,29h,1ch,5ch,62h,9bh,20h
+			db	4ch,f2h,d7h,61h,c1h,b5h,e5h,a7h
+			db	9eh,b1h,2ch,64h,fch,f4h,b0h,b0h
+			db	26h,4ch,3dh,2bh,e2h,b0h,15h,4ah
+			db	a5h,8eh,4ah,5eh,5eh,f5h,93h,7ch
+			db	3bh,46h,51h,ddh,ddh,15h,73h,97h
+			db	88h,e2h,42h,beh,f3h,d9h,99h,b8h
+			db	e6h,8fh,2eh,62h,47h,02h,72h,11h
+			db	d4h,19h,d5h,b3h,51h,2fh,f4h,95h
+			db	02h,ddh,02h,2dh,88h,7dh,88h,93h
+			db	57h,e6h,23h,c7h,e5h,62h,32h,94h
+			db	ffh,17h,35h,ech,b9h,0eh,b4h,b3h
+			db	a1h,0eh,20h,7dh,81h,cch,b7h,abh
+			db	d4h,17h,c0h,cah,edh,38h,cdh,65h
+			db	8bh,e4h,0dh,b8h,86h,9fh,c1h,f7h
+			db	7ah,28h,a2h,00h,fah,37h,22h,46h
+			db	07h,22h,53h,efh,d1h,11h,7ch,bch
+			db	6fh,8ch,2ch,a1h,5ah,3bh,36h,a8h
+			db	6eh,deh,36h,11h,9fh,5ah,bbh,24h
+			db	81h,c2h,79h,75h,abh,dfh,f3h,73h
+			db	14h,7eh,e2h,f8h,34h,37h,cfh,7eh
+			db	7bh,c8h,d1h,24h,34h,27h,a2h,c6h
+			db	cfh,28h,94h,07h,4dh,56h,83h,08h
+			db	a3h,08h,bah,2bh,8ch,1fh,9eh,a2h
+			db	b3h,7eh,1bh,d3h,4ch,92h,38h,a4h
+			db	3bh,d7h,70h,57h,f1h,6bh,12h,0ch
+			db	54h,2eh,99h,44h,3dh,32h,49h,04h
+			db	b3h,cfh,a9h,35h,a7h,82h,11h,7bh
+			db	39h,55h,60h,adh,9bh,64h,46h,f5h
+			db	70h,6fh,f3h,96h,6ch,7bh,22h,bch
+			db	b0h,33h,c2h,98h,b0h,deh,b0h,8ch
+			db	d1h,f8h,e9h,91h,3ah,d9h,42h,6bh
+			db	eah,04h,16h,e2h,3bh,6dh,cch,f5h
+			db	b8h,b9h,eeh,b6h,4ah,f9h,8dh,11h
+			db	13h,92h,6bh,29h,74h,48h,17h,70h
+			db	40h,e7h,eeh,6fh,00h,36h,d3h,b3h
+			db	4ch,50h,f1h,80h,eah,b8h,29h,e9h
+			db	d7h,17h,ffh,d4h,ach,b5h,17h,9dh
+			db	69h,fbh,5dh,e8h,03h,12h,07h,2ah
+			db	e3h,f9h,cah,b1h,19h,8bh,e3h,20h
+			db	ddh,69h,64h,3dh,e5h,d1h,f4h,1ch
+			db	c7h,2dh,98h,56h,ach,bah,90h,eeh
+			db	39h,52h,c0h,a0h,a8h,cfh,b4h,34h
+			db	9fh,e8h,d8h,54h,3ch,41h,53h,63h
+			db	f1h,ech,14h,b4h,a0h,c5h,06h,60h
+			db	8ah,66h,a7h,c1h,2ah,3dh,e4h,bdh
+			db	a8h,23h,d9h,e8h,08h,afh,b6h,6eh
+			db	71h,afh,eeh,0eh,a2h,e9h,03h,7ch
+			db	c2h,bch,d3h,72h,24h,47h,dah,23h
+			db	a7h,b8h,54h,43h,03h,fah,78h,d2h
+			db	80h,e5h,28h,a8h,fdh,e1h,22h,9fh
+			db	6dh,4fh,2bh,a1h,d8h,4ch,a3h,cbh
+			db	c1h,69h,f4h,59h,7ah,3dh,40h,80h
+			db	cdh,4fh,dch,5bh,a3h,cch,a1h,b5h
+			db	63h,4ah,6ch,a1h,75h,68h,15h,6eh
+			db	3fh,19h,07h,dch,8fh,64h,d1h,a4h
+			db	bch,62h,c8h,ebh,2fh,c3h,9bh,47h
+			db	19h,fah,11h,46h,2fh,c4h,efh,61h
+			db	56h,efh,31h,50h,c7h,29h,c0h,79h
+			db	dfh,e5h,bfh,32h,51h,10h,cfh,5bh
+			db	9ch,ech,d0h,6eh,aeh,21h,46h,04h
+			db	9fh,a5h,10h,ebh,30h,e9h,93h,fch
+			db	3eh,45h,eeh,f7h,71h,e5h,00h,fbh
+			db	73h,c2h,93h,a5h,eeh,35h,bfh,d1h
+			db	7ah,8eh,3eh,e6h,56h,8bh,dah,38h
+			db	21h,9dh,21h,d5h,9fh,3dh,80h,d9h
+			db	31h,25h,8ch,49h,5dh,46h,f1h,ceh
+			db	e8h,5eh,71h,ffh,f6h,54h,f4h,f3h
+			db	7ch,dah,10h,9eh,95h,55h,a2h,3eh
+			db	d1h,3ah,19h,6eh,61h,4ah,48h,39h
+			db	30h,e6h,29h,24h,c7h,b2h,79h,7dh
+			db	33h,5ch,08h,82h,11h,02h,0ah,00h
+			db	0eh,55h,deh,9dh,88h,82h,15h,08h
+			db	25h,c6h,5bh,48h,29h,54h,f1h,fah
+			db	07h,b7h,5bh,44h,eah,a0h,fbh,e1h
+			db	05h,44h,adh,9dh,a8h,feh,e9h,0dh
+			db	3bh,d3h,91h,f0h,cah,41h,26h,28h
+			db	41h,c3h,05h,20h,9fh,dbh,ffh,02h
+			db	e4h,12h,deh,d9h,fdh,deh,b9h,e2h
+			db	5bh,2ch,e9h,37h,5ah,cah,abh,c0h
+			db	abh,d9h,98h,43h,64h,e5h,61h,b4h
+			db	89h,4fh,67h,15h,cdh,f5h,34h,22h
+			db	f6h,a4h,31h,45h,e0h,47h,0ch,aah
+			db	79h,cbh,30h,15h,8ah,c8h,13h,48h
+			db	c8h,d8h,54h,28h,deh,bah,21h,4ch
+			db	b1h,eah,d7h,21h,92h,67h,68h,d2h
+			db	4bh,58h,ceh,e5h,47h,b1h,f0h,84h
+			db	73h,fdh,b4h,32h,afh,18h,a8h,56h
+			db	22h,b7h,7eh,b8h,e4h,a3h,dfh,b2h
+			db	1dh,8ah,08h,eah,27h,30h,54h,eah
+			db	05h,3ah,a5h,b1h,65h,a2h,c2h,c7h
+			db	aah,d8h,33h,dfh,e9h,a5h,a3h,e2h
+			db	e4h,c8h,b2h,fah,fch,a8h,4ah,b6h
+			db	f8h,b6h,82h,f7h,d2h,c2h,ddh,30h
+			db	40h,fch,62h,4fh,1bh,4fh,a5h,e4h
+			db	e4h,c3h,7ch,6ah,3dh,a5h,69h,a3h
+			db	16h,abh,58h,22h,53h,a8h,2bh,1eh
+			db	04h,82h,ceh,9bh,b5h,b5h,5eh,beh
+			db	1bh,07h,81h,72h,4ah,13h,e3h,c4h
+			db	6fh,86h,6dh,e5h,98h,d6h,11h,75h
+			db	37h,47h,0dh,a4h,78h,05h,eeh,7ah
+			db	d2h,88h,44h,d3h,46h,3dh,86h,c6h
+			db	fbh,9dh,2ch,b4h,75h,25h,f5h,24h
+			db	b3h,2ch,a3h,d1h,1dh,f7h,90h,34h
+			db	29h,6dh,89h,8eh,1fh,0dh,b7h,65h
+			db	53h,b5h,c1h,33h,3ch,edh,11h,59h
+			db	32h,6fh,7fh,edh,3dh,e5h,95h,3bh
+			db	93h,c0h,bdh,1ah,e3h,06h,05h,e9h
+			db	d7h,97h,b0h,dfh,92h,17h,adh,18h
+			db	abh,60h,b4h,63h,62h,4ah,7eh,2bh
+			db	7bh,0ch,50h,46h,2ah,dfh,38h,3fh
+			db	11h,f4h,07h,c9h,5fh,50h,80h,8fh
+			db	3ah,84h,a6h,35h,8dh,64h,95h,1bh
+			db	7dh,54h,27h,7bh,0ch,5ah,12h,9ah
+			db	5eh,e4h,43h,ffh,fdh,d8h,e0h,45h
+			db	6eh,a0h,a7h,e2h,f7h,46h,ebh,efh
+			db	a0h,8ah,ech,b2h,2eh,fah,eah,06h
+			db	e9h,8bh,8eh,5ah,a3h,efh,10h,cah
+			db	24h,e8h,ffh,77h,70h,09h,20h,60h
+			db	45h,2ch,4dh,16h,a3h,dah,a0h,64h
+			db	dfh,0eh,a2h,4ah,e5h,5eh,c1h,60h
+			db	aah,cfh,67h,efh,59h,68h,d5h,02h
+			db	c7h,8dh,e5h,c7h,6ch,5bh,3eh,f2h
+			db	72h,98h,5bh,34h,3dh,bfh,18h,25h
+			db	25h,51h,dch,41h,dbh,e0h,02h,40h
+			db	78h,93h,78h,00h,4ah,3eh,7fh,cch
+			db	6ah,02h,dfh,0fh,b9h,aah,c0h,e2h
+			db	68h,edh,cah,e1h,60h,00h,39h,2bh
+			db	13h,66h,c6h,6fh,f4h,72h,a2h,eah
+			db	a1h,dch,3ch,a3h,47h,1ch,82h,97h
+			db	62h,33h,a4h,b1h,72h,1ah,90h,a4h
+			db	85h,fbh,a3h,3dh,74h,f8h,4dh,18h
+			db	12h,02h,d4h,77h,14h,e8h,8bh,30h
+			db	13h,dah,20h,aah,76h,8dh,0ch,d1h
+			db	06h,89h,64h,43h,1fh,35h,d1h,5ch
+			db	95h,c8h,cfh,50h,24h,5bh,08h,43h
+			db	60h,d2h,ddh,19h,78h,c7h,4eh,e1h
+			db	e3h,9ah,70h,bdh,66h,7ah,67h,e8h
+			db	70h,77h,75h,8ch,6eh,50h,48h,cfh
+			db	ebh,9dh,f1h,f4h,bfh,4fh,dfh,e6h
+			db	4dh,dfh,ach,ddh,54h,a4h,53h,3bh
+			db	c3h,deh,8fh,b6h,bbh,22h,4ch,c6h
+			db	6eh,7fh,03h,25h,d3h,59h,bdh,23h
+			db	3ch,2ah,3fh,30h,c1h,cah,2dh,b0h
+			db	efh,62h,f4h,e1h,f2h,cch,80h,c0h
+			db	98h,8bh,53h,7fh,beh,a5h,87h,16h
+			db	12h,d5h,ffh,86h,f3h,5eh,8ch,aah
+			db	7fh,46h,45h,08h,94h,66h,26h,cfh
+			db	45h,abh,f0h,19h,6fh,35h,7ah,0dh
+			db	beh,a8h,b4h,a9h,c2h,dch,6ah,45h
+			db	c3h,bah,ddh,73h,e3h,b2h,29h,4dh
+			db	c9h,41h,9dh,d0h,a4h,64h,4eh,edh
+			db	deh,dch,66h,b7h,65h,55h,0ah,66h
+			db	32h,deh,39h,30h,e1h,9dh,6ah,e4h
+			db	35h,7fh,23h,90h,b4h,f4h,12h,0eh
+			db	b7h,c7h,2ah,75h,ech,eah,83h,8eh
+			db	6fh,6dh,04h,f2h,12h,74h,31h,9fh
+			db	f1h,46h,9eh,82h,77h,1ch,30h,ceh
+			db	50h,6dh,a1h,65h,1ch,e3h,6ah,c2h
+			db	8ch,8fh,56h,a8h,3ah,e2h,fch,92h
+			db	0ah,b8h,68h,80h,b3h,71h,b5h,fdh
+			db	ffh,ffh,71h,2ch,bdh,1fh,f8h,23h
+			db	8ah,27h,84h,d1h,bdh,e1h,03h,13h
+			db	32h,66h,beh,83h,89h,78h,96h,99h
+			db	c2h,29h,8dh,96h,adh,4ch,dah,45h
+			db	99h,29h,04h,6ch,5ah,4dh,10h,c9h
+			db	72h,d7h,d3h,bbh,56h,04h,9bh,e8h
+			db	26h,e1h,5fh,71h,b3h,98h,e9h,e8h
+			db	b9h,5fh,c4h,19h,63h,7ah,3dh,43h
+			db	aeh,2fh,2ah,16h,2eh,fch,79h,ech
+			db	feh,92h,34h,85h,25h,3bh,27h,cfh
+			db	1fh,41h,f8h,29h,15h,ebh,49h,42h
+			db	9fh,dfh,e6h,d5h,21h,f6h,d8h,18h
+			db	dfh,3eh,4ah,b5h,36h,3dh,47h,0ah
+			db	20h,9eh,f5h,81h,60h,afh,bdh,e3h
+			db	c9h,ech,dch,00h,8fh,9eh,dfh,51h
+			db	6dh,07h,a8h,60h,3ch,cfh,08h,85h
+			db	5bh,f8h,c3h,a5h,29h,bdh,87h,0ch
+			db	61h,25h,1bh,65h,e7h,11h,abh,70h
+			db	cbh,57h,3ah,3fh,eah,44h,13h,1dh
+			db	a3h,29h,02h,eeh,d9h,b5h,0ch,62h
+			db	43h,ach,d1h,5bh,32h,04h,51h,f9h
+			db	56h,ech,3ch,28h,b1h,beh,f9h,3eh
+			db	8ah,7dh,aah,47h,f3h,6fh,6eh,b4h
+			db	f2h,dch,0ah,67h,dch,62h,52h,4ch
+			db	dbh,89h,06h,63h,d8h,14h,40h,7bh
+			db	e9h,28h,3fh,20h,deh,ceh,9eh,a8h
+			db	97h,61h,8eh,f8h,94h,aeh,c2h,dah
+			db	28h,80h,d9h,87h,c6h,3ah,13h,75h
+			db	0fh,a7h,24h,30h,b9h,4fh,70h,3dh
+			db	4dh,0ch,cbh,e3h,5bh,76h,8fh,24h
+			db	eah,3dh,23h,d3h,7fh,4ah,bbh,d5h
+			db	53h,14h,34h,7eh,d8h,aah,9dh,10h
+			db	8bh,43h,d6h,69h,2ah,7ch,d2h,67h
+			db	b5h,80h,73h,7ch,40h,01h,65h,98h
+			db	aeh,0ch,55h,ebh,ddh,02h,31h,06h
+			db	3eh,35h,26h,beh,4bh,b2h,21h,13h
+			db	5ch,1fh,59h,c4h,d7h,1bh,4dh,c7h
+			db	62h,6bh,42h,cch,66h,43h,60h,e0h
+			db	a5h,8dh,0fh,cbh,cfh,8eh,fdh,47h
+			db	c9h,4dh,4ah,adh,94h,0ah,8ah,38h
+			db	16h,47h,ech,fch,06h,c1h,1dh,29h
+			db	a9h,e5h,13h,b7h,f0h,c3h,aeh,4ch
+			db	afh,06h,11h,3ah,77h,28h,bch,00h
+			db	3eh,55h,87h,11h,88h,a6h,48h,9eh
+			db	7bh,96h,d6h,0fh,fah,1dh,abh,e7h
+			db	1dh,7bh,c4h,e4h,e7h,05h,deh,90h
+			db	fbh,bdh,a6h,96h,bbh,55h,90h,4ah
+			db	69h,d6h,c0h,48h,36h,ceh,c5h,bah
+			db	42h,66h,f9h,a4h,24h,3fh,11h,7eh
+			db	efh,7bh,02h,55h,e4h,c4h,11h,48h
+			db	3fh,30h,f4h,9ah,65h,20h,c7h,26h
+			db	48h,6fh,69h,c0h,05h,ech,f2h,74h
+			db	a5h,9ah,59h,35h,cfh,f9h,46h,bdh
+			db	78h,9eh,c7h,a0h,02h,fbh,d9h,c3h
+			db	2eh,5eh,20h,a1h,37h,76h,0ch,6ch
+			db	82h,e1h,68h,38h,03h,1eh,e1h,adh
+			db	10h,31h,30h,0eh,dch,aeh,54h,e9h
+			db	9eh,4bh,b8h,92h,aah,87h,1eh,69h
+			db	53h,34h,29h,a0h,82h,40h,fbh,d9h
+			db	13h,f7h,ach,e9h,a9h,1fh,6dh,b4h
+			db	58h,b8h,62h,70h,e0h,a2h,1ch,28h
+			db	46h,36h,8bh,a7h,77h,20h,47h,bah
+			db	a1h,3fh,cbh,d1h,3dh,4ch,51h,fbh
+			db	d3h,e6h,c4h,d3h,2eh,99h,a4h,abh
+			db	54h,74h,1ch,83h,78h,79h,62h,7ch
+			db	4eh,b9h,0fh,94h,62h,dah,49h,4dh
+			db	20h,48h,a9h,7bh,f7h,59h,1dh,f5h
+			db	0fh,5eh,efh,00h,83h,bah,bdh,8eh
+			db	6fh,c4h,1ch,54h,bfh,2bh,dfh,00h
+			db	bfh,9ah,e0h,b3h,efh,81h,7dh,14h
+			db	1dh,3bh,cah,bdh,3ch,7ch,01h,10h
+			db	84h,46h,27h,4bh,bch,54h,38h,5fh
+			db	42h,25h,17h,4ch,feh,8ch,94h,61h
+			db	bah,f5h,1eh,b9h,91h,45h,93h,5ah
+			db	a9h,92h,21h,e6h,81h,b2h,17h,52h
+			db	bdh,c9h,cah,9bh,4fh,1fh,6ah,6eh
+			db	62h,88h,a7h,05h,b3h,47h,93h,01h
+			db	9dh,51h,bbh,8fh,ffh,7eh,5bh,37h
+			db	6fh,0fh,ddh,40h,95h,57h,e3h,59h
+			db	abh,20h,7ah,56h,3eh,2fh,49h,51h
+			db	15h,19h,deh,29h,34h,99h,b3h,07h
+			db	cah,27h,98h,b2h,58h,95h,24h,ebh
+			db	d8h,89h,3bh,29h,85h,c1h,26h,ach
+			db	06h,32h,66h,56h,c3h,93h,d4h,cdh
+			db	dah,17h,71h,45h,87h,07h,2ah,31h
+			db	60h,91h,f6h,fch,1ch,13h,2eh,fdh
+			db	41h,bah,fah,21h,8ah,96h,67h,f2h
+			db	6dh,55h,b4h,ffh,55h,a1h,4dh,f2h
+			db	27h,31h,20h,dbh,c4h,90h,6eh,7eh
+			db	bch,d5h,86h,e7h,33h,d1h,24h,68h
+			db	f3h,cdh,eeh,6ch,f2h,2dh,5bh,abh
+			db	02h,c1h,04h,0dh,41h,65h,dch,7eh
+			db	99h,b2h,e7h,31h,49h,4ch,bch,96h
+			db	aah,b1h,d0h,5eh,6ch,3ch,52h,ech
+			db	0ch,50h,24h,26h,2ch,61h,07h,08h
+			db	83h,e0h,8fh,dch,fbh,95h,96h,4eh
+			db	3dh,5ch,5ah,97h,2fh,fah,98h,d8h
+			db	51h,a0h,b3h,e1h,7eh,eah,99h,ffh
+			db	4ah,81h,67h,44h,1dh,22h,19h,05h
+			db	51h,abh,bbh,b6h,1ch,c1h,44h,6eh
+			db	b3h,82h,3fh,6ah,92h,a7h,36h,57h
+			db	6eh,23h,3fh,c0h,90h,abh,2ch,72h
+			db	c1h,fbh,41h,33h,23h,6fh,f8h,5fh
+			db	43h,17h,49h,17h,e6h,35h,f3h,9ah
+			db	2fh,7ch,70h,46h,edh,ffh,8ch,6ah
+			db	01h,84h,1ch,4fh,49h,11h,0dh,7bh
+			db	b4h,18h,27h,d1h,e5h,f0h,9ah,d5h
+			db	6ah,43h,7ch,0dh,3dh,34h,2ch,19h
+			db	b1h,7ah,e0h,58h,42h,b1h,fbh,0ch
+			db	38h,32h,51h,1fh,bbh,43h,b9h,41h
+			db	35h,24h,2eh,9dh,adh,44h,4fh,c1h
+			db	0fh,a3h,26h,0dh,afh,52h,0ch,19h
+			db	10h,f8h,2eh,aah,88h,6bh,04h,33h
+			db	0ch,d2h,3dh,e4h,cbh,19h,15h,15h
+			db	39h,52h,22h,08h,d6h,90h,3bh,80h
+			db	8eh,26h,94h,b5h,8fh,70h,f3h,eeh
+			db	5ch,3ah,71h,a2h,f8h,74h,afh,a0h
+			db	5bh,3ah,24h,4dh,e4h,29h,19h,77h
+			db	2fh,66h,08h,69h,8bh,5dh,4eh,7eh
+			db	a3h,50h,10h,b5h,bfh,a9h,e6h,4eh
+			db	43h,c1h,6dh,eeh,0ch,beh,efh,dch
+			db	1ch,94h,16h,05h,92h,d6h,c6h,1dh
+			db	ddh,1bh,25h,3ah,eah,48h,5ch,16h
+			db	17h,75h,53h,bdh,f9h,55h,fch,a5h
+			db	d9h,b0h,b6h,14h,f1h,8dh,edh,96h
+			db	98h,77h,98h,4bh,75h,54h,2ah,fch
+			db	7ch,feh,1ah,beh,90h,53h,78h,7bh
+			db	5eh,95h,d6h,09h,fbh,b9h,42h,adh
+			db	cfh,09h,e1h,2ah,31h,cdh,7eh,66h
+			db	24h,21h,8eh,98h,3ah,c6h,65h,1bh
+			db	1fh,2ch,46h,8bh,e2h,d3h,19h,fdh
+			db	e3h,1bh,ceh,c6h,1fh,a9h,4bh,d9h
+			db	a0h,14h,2ah,64h,82h,96h,cfh,3fh
+			db	66h,bdh,25h,93h,e7h,23h,22h,3eh
+			db	5dh,ffh,c5h,e4h,5bh,fah,11h,96h
+			db	0fh,83h,6fh,1bh,f2h,bch,56h,dbh
+			db	68h,67h,1ah,1bh,6eh,a2h,94h,c6h
+			db	a6h,19h,21h,36h,38h,59h,bbh,04h
+			db	c6h,7ch,7bh,17h,5eh,deh,3ch,12h
+			db	91h,fdh,bdh,fbh,c1h,e8h,27h,13h
+			db	3bh,bbh,91h,20h,76h,66h,0dh,f6h
+			db	5fh,dbh,cdh,10h,87h,ech,22h,37h
+			db	2dh,1ch,bdh,e7h,69h,77h,48h,adh
+			db	25h,c9h,4ah,20h,e4h,8dh,01h,a4h
+			db	47h,aah,b7h,c4h,d7h,afh,63h,71h
+			db	1ch,81h,37h,86h,81h,60h,2bh,07h
+			db	88h,31h,a8h,21h,17h,dfh,1fh,a0h
+			db	9ah,86h,2ch,62h,16h,d7h,75h,d6h
+			db	3ah,e4h,81h,b8h,13h,01h,b5h,35h
+			db	89h,37h,1bh,a3h,7eh,23h,56h,a6h
+			db	d8h,c0h,f9h,4fh,57h,f6h,a8h,58h
+			db	0ch,f1h,9ch,00h,d5h,bdh,b6h,ech
+			db	42h,f9h,94h,86h,25h,0eh,c1h,fch
+			db	2ch,64h,c0h,1ch,86h,0fh,aah,f9h
+			db	23h,b9h,62h,02h,10h,b3h,81h,aeh
+			db	3ah,98h,1dh,87h,77h,38h,4dh,07h
+			db	aeh,52h,79h,98h,a0h,5eh,86h,dfh
+			db	b4h,75h,d4h,f3h,91h,5bh,c1h,83h
+			db	19h,0ch,1bh,54h,b4h,82h,3bh,55h
+			db	0ch,2ch,51h,4dh,b8h,2eh,51h,87h
+			db	35h,31h,08h,1fh,81h,46h,18h,83h
+			db	d8h,56h,84h,35h,e2h,78h,1dh,bah
+			db	f7h,d4h,6fh,d2h,9dh,f1h,31h,87h
+			db	35h,dfh,65h,b1h,1ah,87h,dah,c4h
+			db	10h,50h,e4h,a0h,69h,21h,a4h,34h
+			db	ceh,3eh,7bh,55h,45h,92h,b5h,36h
+			db	dbh,d8h,70h,57h,e3h,35h,6ch,58h
+			db	68h,ebh,fch,6fh,c0h,41h,bbh,2fh
+			db	f3h,d3h,93h,31h,45h,e6h,46h,21h
+			db	f5h,09h,45h,dah,edh,05h,5bh,d9h
+			db	e2h,2dh,beh,a5h,2ah,c7h,4ah,ffh
+			db	70h,7dh,90h,96h,a4h,b3h,05h,d1h
+			db	98h,d9h,cch,a2h,82h,32h,8dh,feh
+			db	efh,2ah,3fh,99h,cdh,a4h,ceh,c6h
+			db	1ch,d8h,c1h,62h,abh,82h,bbh,c2h
+			db	86h,43h,bch,e4h,6fh,aeh,cfh,d5h
+			db	d9h,87h,58h,7dh,15h,34h,cfh,fah
+			db	e0h,a9h,19h,e2h,fdh,dbh,a9h,95h
+			db	67h,ach,06h,e7h,7bh,f7h,82h,c2h
+			db	d3h,03h,5bh,1eh,8bh,75h,28h,78h
+			db	b9h,40h,f1h,0eh,34h,9dh,5eh,7ch
+			db	b1h,00h,7eh,cdh,e8h,d2h,eah,a6h
+			db	09h,ech,73h,6ch,6dh,1dh,58h,0ch
+			db	54h,bch,40h,d1h,3dh,52h,14h,d5h
+			db	dbh,eeh,35h,c3h,89h,6fh,85h,87h
+			db	c6h,dfh,9fh,75h,3ah,3ch,58h,a4h
+			db	25h,31h,69h,9ah,61h,87h,64h,a8h
+			db	0ch,83h,20h,f5h,91h,06h,e0h,31h
+			db	78h,45h,2fh,e2h,16h,a9h,07h,cch
+			db	06h,38h,9ah,2eh,44h,1dh,20h,30h
+			db	70h,46h,77h,23h,d8h,28h,e2h,e9h
+			db	bfh,4bh,2ah,e5h,47h,75h,cfh,32h
+			db	f8h,27h,0ah,13h,a6h,aeh,cdh,7ah
+			db	e1h,30h,a7h,11h,bfh,62h,59h,84h
+			db	c9h,18h,bah,33h,e6h,07h,abh,e4h
+			db	e6h,b8h,0dh,9fh,77h,82h,59h,e8h
+			db	16h,96h,08h,8eh,48h,bbh,6eh,66h
+			db	71h,f4h,a6h,0ch,bbh,c9h,ceh,feh
+			db	8fh,c8h,c2h,e5h,3eh,2ah,02h,2bh
+			db	21h,5eh,cbh,84h,f5h,b2h,6ch,c5h
+			db	5ah,fch,0eh,f3h,1ch,ach,7fh,dah
+			db	01h,52h,83h,36h,d7h,45h,6ah,bah
+			db	a2h,e4h,43h,29h,deh,82h,8fh,27h
+			db	2fh,ceh,37h,60h,25h,6fh,76h,1ah
+			db	d9h,ech,89h,80h,cdh,24h,c2h,80h
+			db	4bh,37h,c3h,bbh,f4h,17h,03h,6ch
+			db	53h,76h,b1h,e7h,60h,03h,04h,7ah
+			db	81h,2ch,3dh,93h,71h,e4h,b9h,29h
+			db	fbh,f9h,8ch,6bh,65h,d3h,44h,bch
+			db	08h,9ah,82h,d2h,08h,39h,67h,07h
+			db	5bh,43h,c2h,beh,95h,32h,6dh,0ah
+			db	44h,b9h,0ch,d9h,dfh,cbh,34h,b8h
+			db	0dh,1bh,8ah,49h,4eh,44h,00h,45h
+			db	16h,4ch,a7h,32h,c7h,f0h,b4h,deh
+			db	7eh,a2h,62h,40h,4bh,89h,bah,24h
+			db	3dh,f3h,3ch,bfh,50h,26h,a1h,59h
+			db	9eh,f5h,0ah,d4h,29h,3dh,efh,eeh
+			db	ffh,3dh,bah,22h,b7h,61h,b7h,36h
+			db	17h,5ch,07h,80h,35h,70h,1bh,9ch
+			db	63h,47h,f6h,56h,4ah,c2h,33h,50h
+			db	68h,41h,a2h,fbh,6fh,0ah,44h,0ah
+			db	c7h,30h,4dh,75h,dbh,69h,4eh,53h
+			db	e4h,3ch,0dh,54h,7eh,eeh,cbh,29h
+			db	09h,f8h,91h,cbh,4ah,fbh,11h,11h
+			db	95h,2dh,90h,58h,23h,58h,06h,4eh
+			db	e9h,84h,22h,57h,29h,33h,54h,90h
+			db	58h,49h,48h,6dh,2ah,e6h,33h,4fh
+			db	9fh,3eh,e8h,81h,05h,64h,8fh,16h
+			db	d2h,deh,3bh,9bh,38h,c5h,54h,dah
+			db	16h,29h,33h,39h,bfh,deh,83h,b6h
+			db	20h,55h,88h,dfh,dbh,8bh,ach,b6h
+			db	2bh,2dh,31h,19h,d9h,11h,e6h,1dh
+			db	7bh,b9h,78h,f2h,98h,0ah,e8h,b1h
+			db	cbh,61h,9eh,74h,c6h,a4h,01h,c7h
+			db	15h,f3h,2bh,a7h,91h,93h,e8h,3eh
+			db	6ah,81h,77h,92h,f4h,82h,57h,4dh
+			db	a2h,73h,0ah,9ch,51h,6ah,3bh,36h
+			db	3eh,6ah,43h,72h,62h,34h,e9h,68h
+			db	b4h,41h,64h,adh,09h,31h,cch,5bh
+			db	50h,64h,cfh,ffh,f9h,bah,70h,c2h
+			db	e7h,61h,16h,6ch,b1h,9bh,17h,21h
+			db	15h,9ch,c1h,34h,c3h,b3h,18h,bch
+			db	ddh,65h,a5h,5dh,2fh,3ah,a5h,02h
+			db	77h,f5h,eah,aah,bdh,01h,f8h,50h
+			db	5dh,4eh,cah,dbh,b3h,7ah,06h,5dh
+			db	d3h,98h,d8h,aah,ach,32h,64h,d9h
+			db	ceh,fdh,dah,c1h,36h,efh,dch,bah
+			db	06h,84h,3ch,54h,4ah,23h,e1h,c5h
+			db	efh,65h,b3h,6eh,eah,a8h,4ah,63h
+			db	5ah,07h,c2h,73h,18h,deh,d4h,b1h
+			db	97h,deh,87h,80h,26h,2eh,8bh,e3h
+			db	19h,3ch,a7h,0dh,d2h,5dh,06h,37h
+			db	b4h,e8h,4ch,efh,9eh,22h,7dh,feh
+			db	b3h,c5h,4ah,ffh,28h,78h,cfh,6ah
+			db	23h,42h,deh,93h,9ch,20h,0eh,a6h
+			db	9ah,3dh,b9h,a1h,34h,17h,5ch,b1h
+			db	96h,4dh,e5h,98h,3fh,03h,c7h,22h
+			db	d4h,adh,33h,23h,d4h,8fh,d4h,55h
+			db	e3h,92h,3eh,5bh,9dh,3fh,e3h,22h
+			db	ech,21h,6fh,6eh,67h,32h,f0h,f1h
+			db	a9h,adh,f7h,1ah,d2h,63h,a3h,1fh
+			db	9bh,44h,9bh,61h,83h,09h,d5h,65h
+			db	7ch,9fh,55h,c4h,85h,a5h,74h,47h
+			db	30h,84h,a8h,e9h,2dh,c6h,87h,18h
+			db	75h,8fh,81h,d6h,fch,4dh,07h,33h
+			db	6dh,7eh,a9h,d4h,fbh,78h,fdh,c0h
+			db	f9h,cbh,d8h,8eh,3ah,42h,08h,3dh
+			db	31h,09h,51h,d9h,58h,e3h,a9h,3bh
+			db	13h,16h,03h,d6h,35h,a0h,aah,e0h
+			db	20h,fbh,6fh,b1h,81h,ebh,f0h,e3h
+			db	bdh,39h,80h,2ah,22h,2dh,26h,ffh
+			db	e6h,d7h,f2h,30h,3dh,5bh,e8h,89h
+			db	64h,9ch,20h,0eh,1eh,a0h,dah,c4h
+			db	c8h,dah,a1h,cah,8ch,fdh,5bh,66h
+			db	33h,fdh,a6h,20h,34h,46h,ffh,91h
+			db	28h,c5h,f3h,e8h,04h,ceh,c0h,7ah
+			db	10h,dfh,13h,e6h,7ah,3dh,15h,c9h
+			db	82h,69h,51h,69h,9ah,7eh,2bh,72h
+			db	1dh,32h,41h,63h,b2h,f7h,14h,10h
+			db	15h,bah,d4h,1fh,11h,7ch,3dh,f9h
+			db	e0h,3dh,45h,b9h,50h,2ch,b2h,97h
+			db	81h,82h,10h,43h,2dh,20h,4ah,4dh
+			db	f5h,f9h,e9h,0dh,cah,73h,48h,e5h
+			db	4ah,cfh,46h,0eh,dch,b4h,dch,eah
+			db	88h,d8h,ach,a3h,16h,dfh,47h,beh
+			db	01h,cch,21h,16h,7bh,96h,c3h,6fh
+			db	24h,fch,afh,77h,1ah,47h,33h,fch
+			db	d1h,50h,28h,efh,1dh,79h,a1h,0fh
+			db	dah,dah,20h,81h,14h,44h,a4h,2ah
+			db	ech,b2h,93h,e6h,0eh,5bh,d7h,47h
+			db	c2h,1eh,e3h,b9h,c9h,d7h,b5h,5fh
+			db	6ah,75h,16h,34h,6dh,5ah,b1h,ach
+			db	17h,12h,3bh,19h,6ch,2fh,11h,86h
+			db	9eh,7fh,a7h,39h,7eh,cah,9dh,04h
+			db	8bh,e2h,56h,58h,c1h,b3h,81h,22h
+			db	71h,cch,81h,6fh,a0h,0bh,16h,7bh
+			db	a6h,6ch,13h,9eh,d5h,b3h,49h,42h
+			db	47h,f9h,14h,77h,e1h,00h,75h,69h
+			db	2bh,d5h,a1h,beh,08h,38h,e3h,67h
+			db	d1h,dch,e7h,e6h,53h,26h,73h,e6h
+			db	06h,7ah,8dh,04h,afh,36h,67h,eah
+			db	c4h,97h,a4h,7ch,92h,53h,91h,b9h
+			db	a3h,31h,b9h,ffh,76h,21h,55h,dah
+			db	66h,2dh,5eh,0ch,b6h,55h,59h,aah
+			db	95h,fbh,aeh,03h,e4h,6bh,95h,43h
+			db	8fh,4ah,81h,67h,8fh,0dh,a6h,45h
+			db	bfh,b8h,dbh,d6h,6ch,bfh,e3h,f1h
+			db	81h,2fh,65h,64h,54h,7ch,f7h,f0h
+			db	5bh,cch,01h,27h,71h,fah,a0h,7ch
+			db	80h,b1h,91h,2bh,ech,32h,34h,e7h
+			db	80h,12h,16h,c0h,94h,42h,64h,17h
+			db	a7h,56h,67h,3dh,b9h,dah,85h,5ah
+			db	9fh,26h,e9h,cfh,15h,5bh,e5h,5eh
+			db	9ah,aeh,0ch,28h,3eh,93h,94h,fah
+			db	24h,a2h,36h,3bh,54h,27h,76h,73h
+			db	dbh,f6h,69h,c6h,80h,6dh,c2h,2fh
+			db	74h,0dh,65h,33h,02h,58h,d8h,06h
+			db	61h,5fh,18h,26h,48h,10h,b9h,09h
+			db	27h,1ch,04h,14h,bfh,5ah,2eh,7bh
+			db	72h,62h,20h,cdh,c7h,8bh,27h,dbh
+			db	80h,48h,d4h,63h,64h,c8h,23h,c3h
+			db	31h,edh,35h,c2h,d8h,46h,b5h,afh
+			db	0bh,66h,86h,38h,16h,aah,62h,efh
+			db	f4h,5dh,9eh,bdh,48h,efh,05h,dbh
+			db	8ah,a3h,41h,43h,cch,a9h,a5h,c0h
+			db	45h,bch,48h,8dh,97h,e3h,6bh,fdh
+			db	10h,01h,c5h,40h,2eh,bdh,3bh,bbh
+			db	d5h,ach,c0h,38h,e2h,1dh,37h,e8h
+			db	c4h,95h,eeh,6ch,9dh,b3h,32h,05h
+			db	0dh,97h,19h,f1h,0ah,c1h,39h,bbh
+			db	cch,e0h,65h,0fh,25h,bch,45h,7fh
+			db	3dh,6ch,20h,23h,86h,68h,eeh,4ah
+			db	beh,a2h,beh,6bh,88h,4fh,4eh,beh
+			db	15h,7ch,13h,99h,7fh,7dh,e3h,b8h
+			db	46h,50h,cch,f9h,4fh,29h,fdh,ddh
+			db	43h,d6h,2dh,35h,66h,e9h,2bh,0ch
+			db	c9h,b1h,a6h,84h,e0h,9dh,58h,4fh
+			db	45h,37h,b5h,59h,13h,4fh,a7h,c0h
+			db	c7h,7ah,48h,dah,bbh,12h,0ah,60h
+			db	edh,12h,2eh,e7h,69h,95h,7eh,59h
+			db	11h,18h,b8h,4bh,84h,b4h,d8h,61h
+			db	afh,b2h,f6h,b2h,22h,77h,0ch,2ah
+			db	fbh,bdh,42h,6fh,cdh,87h,d6h,18h
+			db	9bh,a6h,65h,0bh,87h,bfh,86h,f7h
+			db	68h,c4h,d7h,bbh,e4h,94h,f4h,d5h
+			db	d1h,66h,92h,beh,25h,7bh,f7h,38h
+			db	61h,42h,cah,46h,62h,17h,48h,d2h
+			db	16h,44h,75h,05h,e5h,adh,edh,feh
+			db	05h,0bh,beh,13h,bch,96h,7ah,25h
+			db	88h,88h,edh,19h,63h,bbh,2bh,16h
+			db	32h,4bh,aah,ceh,6dh,ddh,3ch,57h
+			db	2fh,86h,53h,9bh,7eh,0fh,51h,f4h
+			db	86h,e5h,f3h,c2h,72h,b7h,54h,88h
+			db	96h,dch,eah,7ch,6fh,14h,0fh,5ch
+			db	fdh,41h,94h,d3h,fah,1ch,73h,e2h
+			db	8eh,57h,0ch,6ah,06h,2dh,89h,d5h
+			db	d5h,51h,b2h,adh,84h,1ch,99h,c6h
+			db	36h,71h,9eh,dfh,64h,18h,37h,0eh
+			db	1fh,3ah,aah,f7h,30h,93h,30h,9ch
+			db	4fh,25h,ach,84h,f2h,64h,aah,cah
+			db	73h,38h,5ch,75h,c4h,a0h,7fh,dfh
+			db	edh,06h,51h,efh,fch,c3h,a7h,c9h
+			db	a5h,12h,9ch,4ch,4dh,47h,adh,a9h
+			db	d3h,54h,c4h,abh,c2h,55h,2bh,a2h
+			db	a3h,f5h,cfh,42h,71h,a4h,e9h,b1h
+			db	40h,aeh,a7h,67h,d8h,bfh,46h,6bh
+			db	8ch,7fh,5ch,4bh,cch,c9h,37h,ach
+			db	7eh,00h,d6h,41h,9dh,12h,dfh,6ch
+			db	86h,a0h,4ah,8ah,1bh,f3h,b3h,bch
+			db	0eh,ceh,24h,53h,e9h,07h,afh,24h
+			db	feh,b6h,4eh,50h,8eh,96h,fch,b7h
+			db	13h,dfh,f4h,d4h,fah,59h,97h,41h
+			db	7dh,fdh,7eh,8eh,1bh,71h,b0h,61h
+			db	06h,a1h,9eh,02h,20h,e9h,0dh,d4h
+			db	5eh,9bh,d7h,1fh,7eh,88h,d7h,5fh
+			db	8eh,7fh,51h,90h,89h,a3h,dah,aeh
+			db	61h,94h,23h,64h,7bh,b2h,50h,2ah
+			db	a4h,55h,30h,4ah,4bh,b9h,24h,b8h
+			db	73h,a6h,fch,8dh,31h,9eh,26h,5dh
+			db	8bh,1eh,5ch,f0h,bch,71h,dah,89h
+			db	8bh,02h,32h,15h,f6h,25h,47h,a8h
+			db	c2h,36h,d6h,1eh,40h,95h,25h,58h
+			db	b4h,bfh,55h,29h,a1h,afh,90h,3eh
+			db	78h,b1h,30h,7ch,abh,e9h,02h,fah
+			db	e2h,50h,75h,63h,18h,69h,b9h,ech
+			db	32h,fbh,f8h,f6h,39h,b7h,a4h,1bh
+			db	84h,d0h,bah,99h,26h,c2h,b6h,7ah
+			db	6ah,31h,12h,c4h,76h,97h,6eh,66h
+			db	0eh,04h,c0h,9eh,38h,17h,a9h,b3h
+			db	e0h,cah,67h,9dh,0dh,36h,bah,7bh
+			db	90h,3ah,dbh,61h,ach,90h,74h,90h
+			db	1dh,09h,43h,34h,b7h,24h,d3h,3dh
+			db	13h,fbh,e7h,35h,75h,f4h,4ah,bah
+			db	3dh,80h,12h,ffh,e1h,dfh,68h,abh
+			db	31h,7ah,cbh,25h,bdh,6fh,afh,8dh
+			db	55h,65h,b6h,e3h,1eh,4ch,20h,b9h
+			db	2fh,b5h,97h,11h,c3h,17h,59h,61h
+			db	7dh,07h,22h,cdh,28h,b5h,cdh,34h
+			db	9eh,e7h,2bh,9ah,2ch,a1h,ffh,8ah
+			db	a0h,40h,19h,77h,cfh,49h,a0h,9ah
+			db	23h,1ah,ceh,bdh,42h,b1h,01h,ach
+			db	4ah,0bh,c9h,39h,53h,48h,9eh,7ah
+			db	efh,98h,41h,d2h,3ah,fdh,8fh,f9h
+			db	b1h,b4h,38h,e8h,9ah,3ah,eeh,26h
+			db	5dh,b2h,b9h,55h,1fh,21h,84h,8dh
+			db	b9h,fbh,bfh,95h,deh,73h,71h,18h
+			db	69h,c3h,5eh,6bh,95h,7eh,2fh,f5h
+			db	5eh,2eh,08h,77h,b4h,0ah,99h,c2h
+			db	1ch,d5h,32h,33h,82h,0eh,16h,6ch
+			db	84h,81h,dbh,a6h,2dh,bdh,76h,8dh
+			db	7eh,3dh,04h,a6h,35h,d3h,c9h,ceh
+			db	ffh,deh,f4h,2bh,dfh,46h,78h,24h
+			db	6fh,02h,ech,83h,09h,ech,82h,d0h
+			db	dbh,5ch,f3h,55h,72h,97h,c3h,2ch
+			db	ffh,61h,33h,29h,efh,15h,84h,65h
+			db	c6h,2eh,d2h,4ch,5dh,2bh,11h,2ah
+			db	1fh,39h,cdh,69h,30h,dch,6ah,27h
+			db	68h,30h,eeh,48h,30h,6eh,99h,ffh
+			db	29h,2ah,0ch,3bh,79h,6dh,b2h,2bh
+			db	0eh,21h,3fh,9bh,50h,4ah,a8h,6dh
+			db	1ch,f1h,feh,85h,e0h,00h,b7h,d7h
+			db	06h,e4h,70h,4eh,ffh,55h,04h,46h
+			db	01h,0eh,08h,65h,ffh,5bh,24h,d5h
+			db	4fh,01h,8ch,0fh,49h,64h,4bh,7ah
+			db	e3h,c6h,02h,06h,3eh,d3h,e7h,09h
+			db	bdh,b7h,cch,7ah,8bh,83h,2ch,d3h
+			db	71h,90h,afh,42h,97h,53h,4bh,dch
+			db	25h,ach,05h,dfh,bch,5eh,27h,2ch
+			db	c3h,f5h,61h,96h,26h,8bh,c5h,ach
+			db	0fh,fbh,56h,d6h,6eh,b7h,c0h,75h
+			db	6ah,46h,d6h,0ah,68h,4bh,c1h,5bh
+			db	d6h,70h,3fh,02h,afh,7ch,7ch,b4h
+			db	c4h,88h,ceh,abh,32h,eah,bfh,2eh
+			db	82h,ceh,64h,fbh,1dh,70h,feh,95h
+			db	afh,84h,e8h,4bh,94h,b9h,2bh,d5h
+			db	fch,66h,4fh,40h,e9h,21h,0dh,16h
+			db	b2h,c6h,8dh,d3h,2ch,23h,52h,c7h
+			db	6eh,dbh,98h,edh,9ah,17h,26h,7ah
+			db	65h,4fh,ceh,72h,62h,2bh,7fh,01h
+			db	89h,9ch,efh,80h,c3h,4ah,cbh,43h
+			db	2bh,b7h,6dh,abh,fbh,2eh,dah,bch
+			db	d4h,c0h,37h,beh,b3h,41h,63h,58h
+			db	4dh,b2h,beh,36h,8ch,aeh,74h,35h
+			db	51h,f1h,6eh,bbh,f4h,f3h,0eh,20h
+			db	0bh,dfh,82h,50h,83h,3bh,7fh,deh
+			db	1bh,dch,b4h,0ah,83h,58h,edh,94h
+			db	b1h,9fh,1ch,17h,65h,94h,7dh,bah
+			db	95h,8bh,6dh,1bh,19h,c9h,07h,dbh
+			db	43h,49h,58h,47h,ffh,37h,06h,70h
+			db	90h,02h,0ah,67h,aeh,84h,9ah,4bh
+			db	1ah,c7h,01h,2fh,9bh,5eh,bch,bah
+			db	d8h,10h,cfh,b8h,8eh,14h,d5h,6dh
+			db	19h,c0h,f3h,dch,48h,a8h,d6h,3fh
+			db	c2h,e4h,09h,b8h,63h,03h,12h,9eh
+			db	00h,dfh,1fh,f4h,dah,6bh,53h,bah
+			db	deh,82h,32h,09h,b8h,f8h,d4h,5ch
+			db	49h,04h,bch,57h,eah,b7h,b9h,d0h
+			db	3eh,3dh,d8h,15h,56h,f6h,f2h,e0h
+			db	d9h,d4h,eah,25h,38h,9bh,8fh,7bh
+			db	e0h,02h,fbh,0bh,f8h,c8h,3fh,4eh
+			db	0ah,16h,05h,b4h,d6h,ach,d3h,0fh
+			db	7fh,4fh,96h,74h,f6h,91h,f3h,a5h
+			db	f8h,6bh,16h,50h,0fh,7dh,44h,67h
+			db	0dh,e4h,7ch,78h,4dh,3eh,71h,45h
+			db	30h,c3h,35h,a7h,4dh,1bh,42h,e8h
+			db	76h,93h,fbh,25h,b6h,ech,f7h,7ch
+			db	9ah,b0h,7ah,beh,dbh,e8h,06h,91h
+			db	0eh,30h,42h,83h,a3h,a7h,89h,8fh
+			db	c5h,13h,c9h,f6h,55h,1eh,18h,c5h
+			db	34h,7dh,e5h,81h,79h,94h,58h,46h
+			db	05h,f0h,0dh,28h,bch,80h,1bh,4bh
+			db	01h,96h,4bh,02h,a9h,edh,3fh,51h
+			db	39h,beh,30h,2ch,d5h,2eh,7fh,2bh
+			db	73h,9bh,76h,71h,79h,88h,59h,92h
+			db	0ch,feh,fdh,44h,8fh,2dh,17h,d1h
+			db	2ch,b5h,4eh,e5h,6fh,80h,16h,27h
+			db	0bh,7ah,97h,64h,60h,dch,2eh,f6h
+			db	08h,b3h,a3h,27h,97h,f8h,58h,c5h
+			db	82h,49h,4dh,c8h,e3h,6ah,22h,1ah
+			db	fdh,79h,0eh,ffh,7fh,27h,2ah,83h
+			db	82h,42h,68h,48h,48h,ffh,a6h,80h
+			db	ach,a9h,00h,ach,92h,bch,d0h,a8h
+			db	5dh,0dh,84h,45h,9dh,deh,4ch,ddh
+			db	85h,43h,4ch,72h,9dh,80h,aah,ebh
+			db	b8h,44h,dah,0bh,deh,2dh,92h,09h
+			db	45h,4bh,99h,abh,ffh,d4h,7fh,8ah
+			db	bdh,0ah,e9h,22h,95h,21h,7dh,cdh
+			db	cah,b7h,ceh,d9h,d9h,53h,3fh,e2h
+			db	73h,6eh,25h,26h,04h,c3h,30h,cfh
+			db	d0h,7eh,b3h,98h,87h,10h,10h,4dh
+			db	2bh,3bh,2eh,5ah,d6h,d6h,51h,3bh
+			db	b3h,96h,55h,09h,62h,41h,65h,bch
+			db	25h,d6h,a2h,c3h,b1h,68h,27h,ceh
+			db	eah,b6h,f5h,1fh,bfh,12h,b9h,feh
+			db	e7h,40h,3eh,0bh,74h,d0h,e3h,88h
+			db	60h,69h,3ch,82h,c1h,efh,9dh,3ah
+			db	2ch,a7h,18h,17h,9fh,beh,21h,89h
+			db	a3h,bdh,5fh,58h,dfh,c3h,5ah,c5h
+			db	abh,a4h,b7h,58h,b2h,f3h,9bh,24h
+			db	c3h,edh,bbh,18h,ach,ebh,29h,50h
+			db	c3h,90h,c8h,52h,ebh,14h,69h,68h
+			db	b6h,0bh,f8h,18h,b9h,48h,53h,ceh
+			db	afh,4ch,67h,22h,5bh,5dh,89h,68h
+			db	16h,cbh,c4h,48h,1bh,2dh,dfh,59h
+			db	21h,20h,3ch,5dh,4dh,4dh,3dh,06h
+			db	d7h,27h,7dh,75h,4dh,17h,0eh,28h
+			db	cah,edh,8bh,7fh,49h,8ah,f8h,7ah
+			db	8ch,a9h,17h,10h,5ch,8ah,8bh,d4h
+			db	4fh,57h,f1h,4fh,c4h,88h,5ah,d3h
+			db	44h,a7h,61h,99h,04h,deh,18h,26h
+			db	67h,2eh,d2h,0dh,bch,a5h,78h,82h
+			db	01h,19h,aah,2bh,42h,91h,5dh,efh
+			db	0fh,5dh,ebh,81h,39h,68h,b6h,47h
+			db	b6h,6fh,3bh,3bh,1ah,91h,f6h,f8h
+			db	91h,8ch,f1h,54h,f4h,6dh,68h,8fh
+			db	cbh,93h,74h,d2h,abh,f4h,88h,03h
+			db	79h,d9h,33h,65h,a4h,5fh,d4h,36h
+			db	3ah,9dh,c0h,11h,07h,78h,9fh,61h
+			db	c3h,bah,eeh,f2h,4ah,fah,b5h,27h
+			db	01h,cdh,22h,5fh,c8h,5fh,edh,5bh
+			db	8eh,d5h,72h,5bh,9dh,54h,46h,e9h
+			db	b2h,39h,a1h,74h,6fh,b4h,b7h,35h
+			db	8ch,11h,01h,18h,9ah,0bh,fah,f1h
+			db	7fh,98h,4ch,a5h,bbh,bbh,59h,9ah
+			db	70h,aah,2eh,7fh,54h,a0h,b2h,a3h
+			db	3eh,69h,b9h,78h,43h,a3h,66h,95h
+			db	f7h,a5h,d2h,b9h,3dh,a4h,9ch,e5h
+			db	bah,5bh,e7h,b2h,d2h,83h,46h,bbh
+			db	30h,abh,1ch,71h,2dh,adh,05h,53h
+			db	45h,40h,4ah,a4h,e4h,22h,b8h,7ah
+			db	52h,8eh,49h,a1h,aeh,eah,63h,0fh
+			db	3bh,4fh,2ah,e8h,cch,b7h,f3h,5ch
+			db	e0h,9eh,7eh,41h,b7h,b2h,32h,8ch
+			db	c2h,0ah,84h,8fh,37h,36h,f4h,26h
+			db	d0h,4ch,98h,fbh,51h,0eh,a7h,17h
+			db	1fh,10h,17h,d0h,24h,9dh,f1h,59h
+			db	53h,89h,30h,d5h,3bh,03h,70h,3dh
+			db	48h,ebh,78h,bbh,efh,dch,7bh,aah
+			db	42h,80h,75h,3fh,04h,55h,04h,4eh
+			db	e9h,91h,e0h,a5h,66h,b4h,67h,ebh
+			db	59h,7fh,55h,f6h,40h,48h,94h,30h
+			db	adh,ebh,e2h,e9h,c2h,85h,0dh,28h
+			db	37h,25h,a6h,57h,86h,1fh,aeh,edh
+			db	8ch,4ch,73h,2ch,2dh,f6h,1ch,08h
+			db	76h,2fh,9ah,b3h,f2h,03h,50h,31h
+			db	e6h,d8h,e7h,feh,90h,cah,60h,2bh
+			db	5ch,59h,ffh,bbh,67h,22h,8ah,80h
+			db	58h,7ch,8bh,d1h,d4h,3ch,eeh,dfh
+			db	4fh,bch,68h,c9h,42h,80h,fch,65h
+			db	66h,55h,fdh,1dh,c3h,bch,74h,a2h
+			db	30h,8ch,9bh,53h,82h,6dh,86h,44h
+			db	9ch,78h,c2h,36h,bdh,45h,8fh,08h
+			db	8eh,9eh,d9h,f2h,ffh,a3h,d2h,fah
+			db	32h,b1h,63h,d4h,92h,9dh,a3h,5fh
+			db	99h,65h,d6h,9ah,a9h,4dh,20h,beh
+			db	b8h,d6h,89h,24h,aah,b9h,f4h,f3h
+			db	a1h,5dh,58h,c1h,bah,f7h,7eh,fbh
+			db	59h,98h,24h,c0h,ech,bch,63h,dfh
+			db	7fh,46h,d5h,9ch,69h,94h,f4h,f2h
+			db	1ah,57h,7dh,31h,3bh,89h,c5h,38h
+			db	6dh,14h,71h,efh,a1h,55h,88h,04h
+			db	95h,7ah,f5h,54h,e7h,1ah,eah,5ah
+			db	9ah,77h,51h,15h,cah,9ch,94h,dbh
+			db	dch,c4h,14h,cah,41h,19h,69h,46h
+			db	49h,86h,37h,29h,4fh,87h,3ah,b7h
+			db	70h,48h,5fh,7bh,1ah,29h,7fh,23h
+			db	9bh,fch,f5h,88h,48h,ffh,79h,2ch
+			db	0ch,4bh,f5h,06h,c7h,beh,dbh,6eh
+			db	dbh,7eh,3dh,9ch,a3h,3fh,f6h,2bh
+			db	0fh,d4h,11h,63h,81h,12h,23h,d6h
+			db	ceh,0fh,7ch,2ch,10h,7bh,d7h,e4h
+			db	9bh,e1h,e9h,4dh,14h,52h,23h,1ch
+			db	dfh,02h,98h,ffh,33h,6dh,55h,13h
+			db	0dh,d0h,8dh,19h,35h,95h,15h,01h
+			db	0ah,81h,1dh,99h,e2h,87h,00h,3dh
+			db	71h,2dh,71h,56h,afh,14h,53h,d4h
+			db	0bh,a2h,5ah,b5h,efh,35h,eeh,84h
+			db	51h,7eh,e9h,05h,13h,dbh,b3h,fah
+			db	60h,66h,e7h,4eh,c7h,6fh,6bh,abh
+			db	9bh,77h,36h,30h,ddh,3ch,76h,f7h
+			db	7ah,51h,92h,83h,85h,93h,c9h,1eh
+			db	69h,50h,8ah,9eh,53h,a0h,bah,f6h
+			db	bfh,fah,16h,62h,c2h,f2h,a0h,f1h
+			db	0eh,83h,71h,f0h,34h,31h,51h,74h
+			db	c4h,74h,45h,bah,05h,b1h,47h,5bh
+			db	1eh,79h,4bh,a9h,3eh,73h,81h,a0h
+			db	dah,90h,83h,27h,56h,edh,24h,59h
+			db	11h,04h,17h,e6h,84h,a6h,85h,fbh
+			db	73h,7dh,cch,49h,a6h,05h,90h,c8h
+			db	61h,7ah,01h,9eh,1bh,42h,a9h,a3h
+			db	a3h,8eh,61h,30h,d1h,45h,d3h,45h
+			db	c9h,8dh,2fh,c2h,13h,e1h,07h,17h
+			db	e5h,fah,e9h,16h,6bh,11h,c0h,deh
+			db	27h,3bh,6ch,d1h,44h,5eh,5bh,76h
+			db	9ah,96h,56h,e5h,fah,fbh,7eh,e3h
+			db	a2h,cch,d9h,1ch,b7h,aah,b6h,bfh
+			db	e2h,7eh,e4h,8fh,1ah,a2h,01h,aah
+			db	cdh,fah,1eh,d5h,22h,fbh,5ah,38h
+			db	0ah,e1h,4ch,d7h,4ch,1eh,aeh,e9h
+			db	f1h,d7h,7ch,3fh,0ch,3bh,5bh,2dh
+			db	1fh,30h,13h,81h,fdh,b6h,12h,8ch
+			db	29h,ddh,58h,0bh,5bh,b3h,7bh,97h
+			db	9eh,4ah,fah,f7h,5eh,1ah,69h,f8h
+			db	32h,78h,9fh,5eh,c3h,08h,4fh,1bh
+			db	fbh,fdh,3ch,e7h,3eh,a5h,37h,afh
+			db	20h,99h,f6h,3ch,b0h,c0h,bdh,57h
+			db	14h,c5h,2ah,f1h,0ch,13h,64h,deh
+			db	43h,d3h,efh,9bh,34h,80h,a7h,d9h
+			db	f6h,1ah,1fh,8ah,7bh,cch,cch,ceh
+			db	06h,d8h,09h,efh,bch,fbh,b0h,dfh
+			db	beh,ebh,cah,75h,26h,a1h,8ch,77h
+			db	92h,f8h,92h,a5h,49h,f1h,01h,09h
+			db	51h,4bh,cfh,8bh,39h,8bh,87h,47h
+			db	c0h,f9h,05h,3eh,66h,2fh,2bh,dah
+			db	7eh,88h,37h,ceh,64h,1dh,b8h,14h
+			db	69h,d5h,fbh,84h,c1h,b3h,a6h,3bh
+			db	1ch,33h,59h,14h,29h,aah,3bh,7ah
+			db	cch,53h,16h,bch,e5h,95h,efh,06h
+			db	efh,7ah,cch,10h,89h,3ch,06h,b9h
+			db	36h,c1h,5dh,d3h,5ch,d5h,5ch,4ch
+			db	98h,53h,58h,e8h,8bh,67h,94h,55h
+			db	6dh,24h,07h,8eh,68h,6eh,c1h,1bh
+			db	8dh,d4h,c6h,87h,49h,68h,d3h,87h
+			db	9ch,bbh,30h,b9h,d0h,1ah,85h,4ch
+			db	60h,aah,90h,59h,6bh,5dh,7ah,7bh
+			db	23h,06h,5dh,c1h,3eh,aah,14h,2ch
+			db	f9h,5fh,90h,98h,beh,dch,24h,b9h
+			db	9bh,c1h,05h,3ch,71h,eah,0fh,29h
+			db	76h,1eh,10h,34h,6fh,c3h,b9h,e7h
+			db	70h,90h,0ah,e2h,8bh,02h,adh,36h
+			db	5eh,14h,68h,19h,7ah,ech,c6h,7fh
+			db	02h,65h,97h,a4h,77h,2fh,33h,d6h
+			db	bdh,16h,1ah,15h,0ah,93h,cdh,8ah
+			db	cch,1fh,fah,0dh,21h,5dh,5bh,40h
+			db	1ch,81h,e1h,92h,e7h,c0h,eeh,31h
+			db	1ah,b1h,1dh,41h,feh,20h,4fh,8ch
+			db	82h,5eh,57h,0dh,efh,b6h,7dh,5fh
+			db	a4h,9eh,cdh,a6h,abh,43h,60h,e6h
+			db	ffh,6ah,0ch,1bh,a9h,4dh,97h,41h
+			db	68h,0fh,9ah,a8h,66h,9fh,95h,c4h
+			db	28h,cah,25h,2bh,92h,b1h,afh,71h
+			db	4fh,6ah,17h,35h,f0h,29h,3ch,d7h
+			db	e7h,8dh,bfh,f2h,48h,93h,1bh,ddh
+			db	3eh,83h,7bh,05h,3eh,81h,45h,79h
+			db	29h,0eh,16h,bah,ebh,6bh,43h,2fh
+			db	99h,e0h,d3h,4ah,bfh,b9h,3fh,f6h
+			db	7fh,d5h,5ch,cdh,58h,17h,b9h,2eh
+			db	02h,f0h,0bh,12h,abh,56h,afh,6ah
+			db	73h,5ah,11h,7ah,a6h,3bh,eeh,7ah
+			db	6ch,23h,15h,72h,22h,a8h,4eh,e5h
+			db	4dh,21h,0dh,dch,54h,c9h,c9h,42h
+			db	44h,a6h,11h,30h,8eh,c1h,23h,5dh
+			db	31h,2ch,afh,82h,58h,edh,aah,d0h
+			db	57h,b8h,98h,4bh,c5h,88h,6dh,c9h
+			db	d2h,d5h,96h,cfh,6ah,64h,bdh,c4h
+			db	27h,bdh,89h,05h,e8h,98h,37h,f2h
+			db	c8h,0ch,c7h,68h,12h,42h,9fh,a7h
+			db	21h,feh,b2h,04h,1dh,36h,31h,b3h
+			db	65h,83h,0ch,88h,bdh,0eh,bdh,5dh
+			db	d9h,dah,d3h,61h,68h,ceh,bch,c7h
+			db	5ah,04h,abh,97h,15h,8ah,dah,32h
+			db	3eh,a1h,59h,c8h,9fh,a9h,82h,c3h
+			db	fch,e5h,2ch,c0h,5ah,74h,e5h,87h
+			db	4ch,adh,27h,a2h,b0h,efh,51h,0bh
+			db	eah,b9h,91h,bbh,12h,9eh,01h,a1h
+			db	81h,28h,1dh,dfh,15h,fch,b6h,98h
+			db	d5h,f7h,8dh,9bh,94h,a9h,5bh,94h
+			db	7ah,d0h,10h,52h,2eh,a1h,d7h,d4h
+			db	cfh,4ah,cah,08h,f6h,41h,62h,02h
+			db	f7h,deh,d9h,16h,d3h,8ch,fdh,02h
+			db	2dh,f2h,23h,90h,48h,a1h,65h,e7h
+			db	e3h,fdh,f0h,3ah,a5h,beh,73h,82h
+			db	72h,65h,56h,14h,80h,6eh,29h,38h
+			db	e7h,15h,cch,40h,85h,f1h,73h,b8h
+			db	8eh,f9h,a5h,c8h,91h,40h,64h,fch
+			db	94h,bah,83h,78h,8bh,a8h,26h,7bh
+			db	a0h,f9h,edh,7ch,66h,c5h,b9h,a5h
+			db	7ah,98h,d1h,8ah,2ah,b4h,73h,9bh
+			db	adh,abh,0ah,0fh,41h,74h,69h,a8h
+			db	58h,07h,6fh,68h,3fh,01h,c1h,bah
+			db	51h,e6h,81h,deh,47h,35h,d3h,bch
+			db	a4h,f2h,18h,99h,79h,bfh,00h,40h
+			db	e8h,35h,10h,81h,71h,7eh,beh,72h
+			db	34h,2bh,41h,76h,15h,94h,6ah,c6h
+			db	90h,60h,33h,5ch,c1h,66h,e8h,a6h
+			db	deh,96h,0bh,f9h,8ah,89h,09h,83h
+			db	f9h,3dh,50h,2ch,34h,7dh,80h,37h
+			db	5dh,2bh,85h,ebh,8dh,87h,feh,36h
+			db	c6h,36h,beh,66h,6ch,c4h,29h,06h
+			db	dah,17h,0eh,b6h,7fh,9fh,34h,a6h
+			db	3fh,38h,31h,82h,cbh,3bh,6fh,d0h
+			db	54h,31h,c2h,ach,deh,b8h,7fh,dch
+			db	ceh,beh,3eh,e5h,7ch,05h,75h,05h
+			db	75h,d1h,28h,00h,4dh,7fh,fdh,89h
+			db	2ah,e7h,40h,dch,ceh,f8h,bfh,3eh
+			db	b6h,d1h,34h,45h,e1h,f5h,68h,6dh
+			db	c0h,b7h,8ch,77h,d0h,5ah,9eh,afh
+			db	9eh,25h,05h,39h,c2h,1dh,f6h,62h
+			db	54h,5dh,99h,ddh,23h,54h,c8h,ffh
+			db	92h,2ah,7bh,a2h,7dh,d8h,19h,d3h
+			db	6ah,57h,f9h,9bh,5eh,9ah,4ah,5ch
+			db	6eh,e1h,2fh,45h,12h,ddh,abh,ech
+			db	50h,37h,5fh,3fh,0ah,b2h,88h,35h
+			db	58h,f7h,81h,63h,3eh,94h,7eh,71h
+			db	10h,82h,2eh,f3h,17h,2eh,3dh,67h
+			db	b2h,54h,96h,24h,f2h,8ch,dbh,ebh
+			db	d0h,37h,a9h,afh,eeh,3ch,8dh,3ah
+			db	84h,1fh,58h,cch,74h,41h,d7h,e2h
+			db	69h,83h,21h,c5h,66h,32h,b6h,21h
+			db	cah,2eh,f0h,43h,6fh,9fh,16h,bah
+			db	d3h,32h,5ch,cah,c7h,d8h,91h,24h
+			db	56h,60h,9bh,bbh,33h,38h,10h,82h
+			db	87h,deh,e7h,25h,8dh,e0h,35h,87h
+			db	18h,6dh,2dh,d1h,c3h,69h,12h,5bh
+			db	c7h,6bh,28h,ffh,cbh,f2h,59h,4ch
+			db	21h,cah,b3h,00h,0eh,aeh,0bh,efh
+			db	9bh,3dh,eah,f2h,88h,d4h,5ah,2fh
+			db	08h,10h,c5h,6ch,38h,91h,ech,33h
+			db	a3h,4dh,ach,8fh,8eh,3ch,1bh,84h
+			db	1ch,6ah,adh,c0h,73h,93h,05h,edh
+			db	7eh,14h,dfh,55h,e4h,51h,ech,71h
+			db	72h,adh,bdh,21h,03h,45h,29h,a3h
+			db	0dh,0ch,beh,9eh,65h,e4h,c0h,c9h
+			db	55h,e7h,17h,42h,8ah,ffh,6bh,4ah
+			db	3ah,80h,4bh,10h,ddh,79h,7ch,a5h
+			db	40h,43h,3dh,4ch,01h,70h,08h,31h
+			db	e7h,54h,25h,3fh,d1h,adh,9dh,3dh
+			db	0ah,15h,bah,34h,cah,edh,f7h,a4h
+			db	fbh,57h,55h,d1h,6bh,49h,45h,4ah
+			db	24h,cfh,72h,8dh,f2h,9ch,01h,f9h
+			db	f3h,e3h,a2h,20h,79h,28h,0ah,79h
+			db	c8h,46h,4dh,9dh,a1h,76h,08h,f8h
+			db	31h,85h,4fh,0bh,91h,5bh,f9h,cdh
+			db	7ah,6eh,2ch,aah,08h,efh,6eh,62h
+			db	63h,4ah,34h,46h,8ah,2fh,50h,39h
+			db	f2h,58h,65h,a9h,fbh,64h,66h,ebh
+			db	f1h,c2h,13h,2fh,b1h,d0h,3ch,5ah
+			db	0ah,90h,01h,59h,aah,63h,d1h,60h
+			db	8bh,fch,3ch,57h,a4h,5fh,e6h,2eh
+			db	18h,64h,7bh,13h,9ch,85h,3ch,35h
+			db	85h,afh,44h,9ch,e0h,d0h,34h,beh
+			db	d2h,c3h,7dh,14h,80h,21h,6bh,5fh
+			db	b9h,8ch,69h,20h,a3h,ffh,feh,54h
+			db	6ch,c3h,18h,4bh,52h,75h,dbh,d1h
+			db	70h,6eh,22h,b1h,7eh,17h,b3h,bbh
+			db	b5h,68h,e0h,a5h,51h,ceh,aeh,0dh
+			db	c2h,1dh,9eh,29h,9eh,0ch,35h,97h
+			db	31h,7ch,58h,62h,e9h,4bh,28h,30h
+			db	8dh,dbh,05h,76h,7fh,42h,f6h,94h
+			db	fbh,70h,8fh,6fh,f0h,03h,32h,ach
+			db	a6h,4eh,8eh,55h,e8h,f6h,9dh,f4h
+			db	1ah,c7h,c2h,08h,fdh,75h,56h,82h
+			db	6eh,71h,52h,21h,68h,b8h,03h,05h
+			db	b5h,05h,41h,31h,c6h,b6h,b1h,1ah
+			db	b7h,0fh,62h,69h,c1h,e4h,a2h,cfh
+			db	0bh,bah,7fh,47h,87h,96h,fah,ebh
+			db	d6h,68h,0fh,edh,d8h,5dh,99h,e2h
+			db	1ch,7eh,8dh,37h,beh,ach,b1h,2ah
+			db	02h,29h,5eh,49h,8ah,17h,aah,9fh
+			db	30h,90h,f2h,68h,40h,2ah,f9h,57h
+			db	b6h,dbh,17h,d5h,6bh,6fh,60h,9eh
+			db	26h,9ch,3bh,1dh,80h,39h,66h,8dh
+			db	69h,bch,bch,efh,31h,3ch,fah,e2h
+			db	31h,f6h,cbh,87h,fch,cdh,1eh,e8h
+			db	4ch,f6h,03h,69h,dch,19h,9ah,67h
+			db	55h,f1h,0bh,94h,50h,6fh,21h,5eh
+			db	03h,a9h,e7h,50h,f0h,77h,afh,76h
+			db	c9h,46h,68h,d8h,24h,7eh,fdh,50h
+			db	eeh,67h,f6h,18h,67h,58h,f6h,d4h
+			db	c8h,f6h,4fh,5fh,08h,66h,adh,28h
+			db	3dh,aeh,02h,a8h,1ah,1fh,43h,19h
+			db	14h,50h,c9h,0bh,b3h,07h,c2h,85h
+			db	0bh,4ah,9fh,cdh,41h,20h,60h,35h
+			db	c1h,bdh,15h,35h,c3h,4dh,a2h,0eh
+			db	67h,a4h,0dh,ceh,4fh,88h,7ah,1fh
+			db	06h,a6h,c9h,85h,5bh,e8h,d3h,4eh
+			db	83h,cch,7eh,afh,92h,3fh,94h,90h
+			db	47h,c2h,71h,f8h,e7h,ceh,23h,11h
+			db	2eh,ddh,3eh,15h,3ah,09h,e1h,4dh
+			db	5ch,0dh,d8h,e2h,2ch,1ch,28h,c0h
+			db	a0h,d6h,eeh,e4h,b6h,e6h,64h,c7h
+			db	a0h,04h,0dh,abh,03h,36h,74h,cah
+			db	01h,e1h,c3h,27h,94h,11h,f6h,b7h
+			db	2ch,d0h,34h,6eh,91h,b1h,aeh,e2h
+			db	28h,f8h,25h,efh,00h,fdh,b9h,47h
+			db	58h,62h,a6h,12h,cah,99h,44h,6bh
+			db	50h,f8h,d2h,fch,62h,81h,c7h,adh
+			db	a0h,0ch,a2h,fch,30h,aeh,57h,10h
+			db	21h,9ah,00h,cbh,34h,a5h,e8h,38h
+			db	3dh,d9h,fbh,fbh,49h,1fh,5eh,0ch
+			db	48h,f3h,9ch,66h,24h,19h,56h,33h
+			db	8bh,abh,b5h,dbh,b1h,3eh,35h,37h
+			db	d9h,6eh,c0h,49h,beh,c7h,7ah,e6h
+			db	b5h,27h,84h,e4h,37h,c8h,83h,0bh
+			db	39h,2ch,a1h,06h,cfh,75h,51h,95h
+			db	d5h,54h,71h,51h,e1h,ceh,ach,59h
+			db	11h,83h,d7h,c1h,15h,6eh,bch,e6h
+			db	0dh,80h,c7h,6ah,66h,68h,e2h,65h
+			db	cdh,cch,e7h,23h,71h,38h,45h,bdh
+			db	ceh,6ch,afh,09h,29h,fbh,40h,aah
+			db	2eh,3ah,61h,fbh,aah,00h,b7h,12h
+			db	c2h,a7h,11h,54h,29h,02h,cch,4dh
+			db	a0h,bah,3ch,a7h,9fh,b7h,28h,55h
+			db	bch,a8h,87h,ddh,c2h,07h,97h,f1h
+			db	beh,19h,4bh,6eh,6fh,4ch,02h,36h
+			db	d2h,afh,9bh,02h,30h,b4h,deh,ebh
+			db	14h,5fh,0eh,58h,44h,ceh,76h,e4h
+			db	d3h,9eh,e2h,fdh,05h,2ah,97h,42h
+			db	a2h,92h,64h,d1h,20h,32h,f0h,7fh
+			db	99h,32h,fdh,e9h,cbh,35h,1fh,d6h
+			db	9dh,79h,75h,43h,9bh,cch,a8h,76h
+			db	adh,30h,a6h,d4h,d0h,45h,30h,56h
+			db	5dh,5dh,11h,ech,99h,d4h,53h,3eh
+			db	44h,4dh,a8h,e7h,88h,ddh,44h,e4h
+			db	d1h,ddh,5dh,10h,18h,97h,95h,fbh
+			db	0dh,89h,45h,8ch,5dh,c9h,59h,0dh
+			db	1dh,88h,1dh,05h,e1h,8fh,73h,31h
+			db	aeh,40h,5fh,e1h,32h,6fh,bfh,82h
+			db	b0h,d4h,47h,94h,d9h,01h,f7h,7eh
+			db	13h,3ah,36h,ceh,bch,80h,abh,b7h
+			db	39h,abh,94h,c8h,8dh,f3h,f2h,e7h
+			db	c2h,82h,87h,20h,5ah,f3h,5ah,35h
+			db	03h,c1h,4eh,97h,e9h,7dh,dch,dbh
+			db	c2h,8eh,bah,d9h,8eh,e6h,88h,e2h
+			db	46h,69h,e7h,dfh,87h,6fh,1bh,1ch
+			db	29h,cfh,e0h,0ch,0ah,14h,f7h,05h
+			db	b5h,8fh,2ch,c1h,f6h,b0h,cbh,cbh
+			db	02h,eeh,c7h,9bh,d0h,56h,e9h,21h
+			db	7dh,1dh,45h,f1h,1fh,efh,edh,28h
+			db	fah,bdh,75h,e5h,45h,87h,86h,64h
+			db	e2h,93h,beh,0eh,9fh,51h,84h,a2h
+			db	ddh,cch,29h,84h,0dh,fah,c0h,9dh
+			db	e0h,adh,66h,56h,a4h,5dh,6ch,52h
+			db	7ah,f4h,fah,beh,d4h,2ch,38h,f6h
+			db	c4h,95h,3ah,3ch,53h,4ch,cbh,88h
+			db	06h,d4h,e6h,24h,d0h,31h,49h,7fh
+			db	12h,72h,3dh,c1h,fbh,beh,67h,a3h
+			db	87h,51h,5ch,2ch,d2h,bfh,69h,55h
+			db	95h,1fh,8eh,76h,3dh,71h,a5h,77h
+			db	bfh,fbh,0fh,4ah,f3h,26h,0eh,8ah
+			db	5eh,cah,90h,4dh,29h,46h,70h,6dh
+			db	22h,e9h,07h,6bh,7bh,81h,e0h,65h
+			db	1eh,d9h,f1h,bfh,38h,f3h,bah,4dh
+			db	b6h,2dh,44h,3eh,9eh,06h,37h,1ch
+			db	46h,9bh,b2h,8eh,81h,f8h,3bh,a8h
+			db	b9h,e7h,99h,2ch,a3h,5dh,5dh,57h
+			db	67h,d9h,e4h,2fh,f5h,16h,bah,28h
+			db	d4h,a3h,96h,32h,37h,38h,4bh,0fh
+			db	e8h,03h,9ah,87h,2ah,a9h,63h,a8h
+			db	7ch,c6h,9ah,afh,78h,fch,d8h,cbh
+			db	92h,6fh,14h,beh,06h,68h,87h,8fh
+			db	7ah,6ch,aeh,a5h,b9h,5ah,36h,1ch
+			db	b7h,a4h,61h,c6h,d7h,adh,43h,fah
+			db	b9h,d5h,05h,73h,93h,5eh,1fh,61h
+			db	d6h,9fh,2fh,29h,9dh,0dh,e2h,36h
+			db	86h,b2h,9dh,82h,b8h,a7h,02h,9fh
+			db	05h,8eh,86h,82h,54h,dch,52h,0fh
+			db	23h,23h,85h,fah,79h,fah,dfh,d7h
+			db	17h,c8h,9ah,fch,5bh,3fh,80h,3ch
+			db	2dh,99h,8fh,d1h,cah,55h,6bh,64h
+			db	c4h,64h,56h,ebh,11h,7dh,60h,cbh
+			db	73h,7dh,13h,38h,a7h,adh,42h,46h
+			db	3eh,36h,69h,4ah,bfh,e4h,d4h,7dh
+			db	28h,13h,f9h,06h,15h,08h,30h,d4h
+			db	36h,5eh,7ah,00h,75h,d8h,64h,56h
+			db	07h,2fh,afh,d3h,abh,6ah,a1h,53h
+			db	c4h,d9h,e1h,0ah,58h,69h,e1h,8ah
+			db	f4h,6ah,edh,b8h,7fh,fah,aah,7dh
+			db	d5h,fbh,84h,32h,69h,f3h,a4h,6eh
+			db	55h,fch,9ah,1dh,84h,dah,35h,2dh
+			db	9bh,e0h,eah,c8h,5ah,9fh,62h,f9h
+			db	1fh,52h,17h,95h,97h,0ah,27h,70h
+			db	67h,18h,36h,cch,3ch,45h,3eh,fch
+			db	cbh,17h,dbh,57h,2ah,b3h,11h,6fh
+			db	81h,05h,8dh,ech,76h,00h,f6h,2bh
+			db	7eh,4bh,6fh,15h,a3h,31h,f9h,c8h
+			db	f8h,cbh,e8h,afh,02h,67h,c6h,20h
+			db	0dh,a1h,2dh,deh,13h,07h,65h,b9h
+			db	88h,e6h,55h,c7h,54h,21h,e4h,41h
+			db	0dh,56h,87h,40h,96h,ech,aeh,64h
+			db	b1h,4bh,ffh,d3h,15h,0bh,92h,20h
+			db	cdh,22h,68h,aah,1bh,5ch,ebh,24h
+			db	2ah,feh,fdh,02h,d4h,2eh,d0h,ffh
+			db	3eh,51h,41h,4fh,98h,61h,6eh,16h
+			db	8bh,fbh,d5h,ebh,64h,90h,16h,13h
+			db	0dh,a8h,1ah,9fh,66h,74h,bbh,fbh
+			db	8eh,22h,b3h,27h,64h,10h,6dh,c6h
+			db	bdh,29h,9eh,d7h,32h,a7h,3ch,02h
+			db	e6h,c9h,e3h,e5h,37h,62h,e8h,3ch
+			db	f3h,8bh,04h,49h,9ch,88h,91h,05h
+			db	43h,6fh,fbh,1eh,95h,99h,23h,cdh
+			db	39h,07h,80h,47h,60h,24h,72h,39h
+			db	4ch,d8h,d3h,f6h,dbh,36h,a2h,9ch
+			db	6dh,d1h,abh,fch,0ch,25h,41h,d4h
+			db	a0h,0dh,a8h,6dh,5ch,01h,50h,61h
+			db	24h,0ch,2dh,65h,bbh,3bh,14h,c4h
+			db	3fh,aeh,45h,0bh,84h,23h,1dh,80h
+			db	58h,66h,2bh,c2h,44h,5dh,f8h,5bh
+			db	cdh,cdh,95h,2fh,e8h,dch,74h,10h
+			db	a4h,a2h,77h,b6h,d7h,bah,58h,63h
+			db	2ah,cfh,0fh,10h,b9h,0bh,bch,0ah
+			db	7ch,64h,ech,77h,9ah,37h,b2h,02h
+			db	bbh,abh,f5h,22h,a8h,6bh,54h,0dh
+			db	69h,0ch,deh,c4h,b0h,36h,1ah,63h
+			db	3dh,f5h,a3h,5eh,beh,72h,38h,bbh
+			db	d9h,c9h,7ah,fbh,2dh,11h,a7h,8ch
+			db	3fh,49h,18h,8ah,7dh,c5h,62h,4bh
+			db	0ch,15h,09h,b1h,50h,d0h,1bh,24h
+			db	83h,e0h,07h,3ch,f0h,70h,27h,74h
+			db	52h,06h,84h,26h,5eh,93h,b5h,5ch
+			db	31h,42h,0fh,3dh,78h,44h,ceh,0fh
+			db	0ah,89h,2ah,aah,1ah,23h,4dh,11h
+			db	22h,66h,3eh,30h,b0h,34h,38h,87h
+			db	97h,20h,82h,18h,d2h,1fh,98h,cch
+			db	1ah,20h,16h,9ch,a9h,98h,ach,dbh
+			db	4bh,8bh,fah,39h,34h,afh,43h,f3h
+			db	a8h,b3h,3fh,07h,76h,4eh,31h,c4h
+			db	eah,f6h,e5h,eah,c9h,09h,67h,06h
+			db	71h,9ah,1ch,deh,79h,f9h,8dh,73h
+			db	c0h,16h,ddh,97h,c0h,c5h,9eh,37h
+			db	21h,37h,0ah,bbh,ffh,14h,3ch,c6h
+			db	98h,00h,90h,32h,4ch,cfh,86h,50h
+			db	56h,2ch,ddh,1ah,c8h,e2h,4dh,f7h
+			db	80h,73h,16h,c5h,46h,99h,c9h,38h
+			db	b8h,e7h,05h,25h,6bh,8ch,47h,a6h
+			db	46h,2dh,38h,fdh,2ah,77h,75h,64h
+			db	51h,a0h,99h,2ah,31h,cdh,beh,41h
+			db	8dh,38h,a5h,ech,47h,21h,80h,9ah
+			db	05h,c1h,f0h,d5h,7eh,09h,a4h,30h
+			db	edh,fah,4dh,f0h,c1h,3fh,75h,adh
+			db	05h,51h,b1h,8eh,d5h,b7h,22h,2bh
+			db	85h,bdh,ceh,f2h,c0h,cah,96h,25h
+			db	c6h,8ah,c7h,7ch,7fh,1ch,47h,3ah
+			db	24h,adh,dch,dbh,48h,d4h,ffh,7bh
+			db	9dh,06h,38h,63h,f3h,4eh,39h,8ch
+			db	99h,9ch,a0h,a2h,76h,4fh,3ch,dch
+			db	44h,ach,b2h,d5h,8fh,44h,83h,2bh
+			db	89h,03h,aah,9fh,62h,cah,f5h,69h
+			db	26h,e2h,85h,81h,41h,89h,bch,27h
+			db	75h,97h,c4h,6dh,23h,06h,b1h,deh
+			db	28h,1bh,95h,94h,8eh,2ch,d1h,21h
+			db	c3h,45h,5ch,b4h,96h,e8h,41h,66h
+			db	82h,08h,44h,19h,d6h,e3h,07h,dbh
+			db	fah,b0h,73h,83h,a1h,41h,53h,13h
+			db	d0h,6ah,38h,dah,d6h,9ch,52h,3dh
+			db	96h,83h,2ah,34h,00h,d2h,68h,4fh
+			db	98h,08h,6ah,31h,c2h,3eh,44h,02h
+			db	2bh,68h,c8h,d1h,71h,55h,e0h,b1h
+			db	d0h,2eh,f0h,7eh,f2h,5ch,dah,e7h
+			db	4ah,d8h,8eh,fdh,b1h,52h,11h,96h
+			db	9fh,b1h,fdh,aeh,b9h,0bh,33h,0bh
+			db	b0h,66h,2dh,ceh,81h,fdh,a8h,1bh
+			db	0dh,3eh,f0h,42h,42h,1dh,09h,b2h
+			db	45h,0dh,a2h,cfh,cdh,6ch,55h,fdh
+			db	3fh,fbh,3dh,5ch,8eh,b2h,1fh,4dh
+			db	62h,a4h,30h,76h,53h,9dh,e2h,0ah
+			db	aah,71h,06h,62h,aeh,63h,5ah,d0h
+			db	b9h,29h,82h,d1h,03h,9ah,98h,d8h
+			db	32h,86h,56h,b2h,a9h,bdh,4ch,d6h
+			db	bdh,1ch,50h,01h,59h,7eh,57h,02h
+			db	01h,ech,fbh,2eh,27h,92h,f1h,eah
+			db	5dh,65h,2ah,7fh,a5h,78h,2ah,fbh
+			db	ceh,97h,58h,0ch,e4h,08h,9ah,62h
+			db	60h,1dh,c0h,c7h,5ah,a0h,28h,a3h
+			db	e0h,72h,8ch,82h,7fh,e4h,c3h,a2h
+			db	c5h,a4h,08h,17h,d9h,6fh,ffh,4fh
+			db	83h,f4h,a6h,ddh,c2h,6ah,94h,57h
+			db	03h,a3h,73h,beh,f7h,e4h,6ch,a3h
+			db	82h,5ah,35h,17h,ebh,2eh,c1h,ech
+			db	c4h,dfh,84h,ceh,c0h,c8h,89h,78h
+			db	e8h,a7h,9dh,00h,3eh,72h,dch,ffh
+			db	3bh,95h,feh,abh,afh,fch,e6h,2ah
+			db	bdh,b3h,04h,f6h,d6h,3dh,c3h,7eh
+			db	49h,4ah,a3h,3dh,dfh,c0h,8bh,b6h
+			db	c8h,17h,56h,1eh,4ah,4ch,07h,1ah
+			db	47h,c9h,31h,b1h,74h,c5h,38h,aah
+			db	e1h,10h,3fh,8ah,38h,a5h,e9h,b2h
+			db	96h,52h,59h,57h,51h,e3h,e8h,29h
+			db	3fh,9fh,aah,64h,6ch,c4h,32h,35h
+			db	f6h,55h,ceh,96h,35h,b4h,11h,deh
+			db	34h,b4h,50h,84h,c7h,2dh,f2h,55h
+			db	c4h,7ch,9ah,f2h,c9h,16h,deh,d1h
+			db	a7h,8bh,82h,fbh,8dh,9fh,51h,c2h
+			db	f7h,76h,dfh,06h,68h,adh,43h,1bh
+			db	b6h,ceh,a6h,65h,28h,51h,d3h,f6h
+			db	3ah,c7h,64h,9eh,49h,04h,e1h,9bh
+			db	b0h,24h,0ah,87h,d2h,96h,dbh,5bh
+			db	58h,0dh,7ch,78h,7ah,cbh,37h,edh
+			db	94h,c1h,d6h,06h,a7h,74h,dbh,ffh
+			db	67h,9ah,1eh,bch,bfh,15h,fbh,abh
+			db	12h,50h,8bh,9ch,fch,16h,55h,f1h
+			db	54h,dch,1ah,13h,feh,84h,0dh,2eh
+			db	07h,3ch,93h,80h,36h,8fh,9ch,7ah
+			db	a8h,afh,a6h,74h,99h,5bh,77h,3ch
+			db	55h,93h,bdh,d7h,ebh,12h,14h,a6h
+			db	cbh,61h,e2h,5ah,11h,11h,00h,f9h
+			db	9dh,69h,edh,02h,f9h,9dh,4bh,7ah
+			db	97h,eah,4ah,08h,bfh,dch,75h,6ah
+			db	bdh,9bh,e1h,26h,c3h,98h,73h,3bh
+			db	0fh,76h,87h,9ah,61h,e8h,8dh,bch
+			db	e3h,3fh,f4h,1ah,5eh,09h,a2h,26h
+			db	4bh,67h,31h,dfh,2ah,c6h,bch,7eh
+			db	40h,f0h,d7h,44h,e3h,a2h,40h,f5h
+			db	48h,3eh,adh,5ch,65h,deh,79h,c9h
+			db	f3h,b5h,5ah,76h,76h,dah,70h,65h
+			db	27h,1eh,d2h,eah,89h,3ch,ceh,eah
+			db	9dh,0ch,81h,50h,08h,29h,80h,89h
+			db	12h,6fh,feh,68h,f7h,b3h,ech,7eh
+			db	f5h,e3h,5ch,cdh,fch,8bh,7ah,6ah
+			db	1bh,a2h,adh,a9h,49h,32h,57h,e9h
+			db	4eh,2ah,6ah,2dh,f5h,40h,07h,fah
+			db	b9h,7eh,86h,83h,ceh,8eh,b1h,eeh
+			db	85h,f5h,d4h,92h,41h,29h,d0h,50h
+			db	4bh,17h,6ah,e4h,25h,05h,dbh,0ah
+			db	3ch,6dh,58h,21h,edh,a7h,5dh,2ah
+			db	b5h,8ch,e9h,5bh,82h,ffh,b6h,64h
+			db	65h,f5h,ebh,e7h,afh,cfh,eah,f5h
+			db	79h,eah,a7h,11h,b3h,b2h,fch,b0h
+			db	04h,61h,13h,8dh,dah,dfh,97h,10h
+			db	98h,91h,1eh,56h,20h,dah,f1h,29h
+			db	e9h,83h,82h,e7h,0bh,80h,73h,09h
+			db	32h,cah,c8h,d0h,86h,7ch,fdh,a1h
+			db	2fh,0fh,e3h,7ah,65h,8ah,bah,12h
+			db	2bh,7ah,dfh,73h,98h,8fh,11h,c0h
+			db	11h,e2h,cah,36h,e6h,02h,b1h,9ch
+			db	c7h,54h,90h,6dh,6fh,1bh,05h,00h
+			db	e7h,d1h,3fh,deh,35h,54h,b6h,c2h
+			db	bch,2dh,a0h,96h,8bh,a1h,40h,f0h
+			db	d7h,27h,b8h,06h,cdh,b1h,c3h,c9h
+			db	1fh,0ah,edh,4ah,ech,7ch,dbh,ddh
+			db	0ch,fch,eeh,56h,a6h,7bh,a0h,75h
+			db	8bh,52h,f3h,15h,f5h,a8h,42h,99h
+			db	b8h,90h,92h,abh,e3h,f7h,2dh,4fh
+			db	a9h,dch,70h,46h,a5h,05h,0ch,9dh
+			db	e7h,83h,cdh,cbh,94h,cch,09h,33h
+			db	3ch,d7h,4bh,17h,95h,03h,5fh,f3h
+			db	abh,cah,e8h,b3h,d6h,aeh,52h,54h
+			db	afh,dah,7eh,18h,09h,92h,d8h,31h
+			db	dfh,58h,14h,36h,28h,02h,26h,5eh
+			db	4ch,55h,64h,c2h,51h,adh,06h,cch
+			db	34h,c2h,d0h,dfh,44h,98h,4bh,dfh
+			db	c3h,abh,f5h,d6h,fdh,30h,a2h,a9h
+			db	fch,5dh,51h,45h,23h,e6h,3eh,80h
+			db	d2h,99h,b5h,e3h,ffh,98h,8eh,9fh
+			db	55h,1eh,8ch,dch,e8h,e8h,c1h,39h
+			db	96h,d7h,b7h,cdh,09h,70h,d5h,ddh
+			db	cfh,82h,4eh,09h,1fh,41h,8bh,b8h
+			db	2eh,52h,36h,52h,b2h,a9h,f8h,adh
+			db	99h,68h,d5h,eeh,24h,e7h,f9h,cdh
+			db	8ch,cfh,d7h,fdh,15h,09h,75h,cdh
+			db	cfh,09h,ebh,4fh,a6h,e5h,93h,6dh
+			db	19h,c3h,4eh,9bh,8ah,5eh,11h,62h
+			db	ffh,2fh,33h,85h,22h,8bh,eeh,9eh
+			db	18h,2bh,86h,d8h,4eh,25h,81h,43h
+			db	23h,c3h,52h,e2h,01h,0ah,89h,34h
+			db	6dh,52h,20h,31h,c5h,d8h,d5h,2eh
+			db	19h,c0h,89h,50h,beh,2ch,b5h,6eh
+			db	73h,00h,75h,1fh,89h,25h,1ch,9eh
+			db	93h,88h,d5h,b0h,26h,30h,00h,fah
+			db	f2h,02h,17h,adh,a8h,14h,a1h,64h
+			db	a4h,e4h,93h,54h,7bh,d7h,90h,00h
+			db	63h,3ah,d0h,e8h,c7h,d2h,08h,d5h
+			db	e2h,69h,5eh,17h,27h,a4h,15h,81h
+			db	1ah,86h,e0h,63h,01h,64h,8bh,beh
+			db	d2h,60h,04h,92h,49h,d2h,f7h,41h
+			db	85h,abh,18h,afh,0eh,d9h,fbh,17h
+			db	76h,d1h,93h,13h,bah,d0h,2ch,9fh
+			db	afh,7dh,23h,e5h,e0h,c4h,83h,c7h
+			db	ddh,00h,84h,4ch,2fh,3eh,b6h,7ch
+			db	57h,b2h,a8h,41h,4bh,cah,2ch,6bh
+			db	d3h,45h,1ah,05h,afh,94h,72h,dfh
+			db	f7h,82h,4ch,0dh,56h,88h,79h,a5h
+			db	93h,5dh,9eh,35h,d9h,f5h,5ch,41h
+			db	c9h,d4h,14h,2eh,a4h,4bh,96h,34h
+			db	d4h,02h,50h,89h,e9h,4ch,b2h,c4h
+			db	48h,45h,ceh,40h,7ah,00h,6ah,19h
+			db	1bh,41h,53h,d2h,2bh,32h,82h,5fh
+			db	4fh,60h,d0h,49h,1bh,bfh,aeh,2ah
+			db	0ah,86h,fch,81h,2fh,14h,fah,69h
+			db	d6h,d7h,fah,f9h,08h,cdh,96h,abh
+			db	cah,d4h,89h,44h,1ah,70h,7ch,7bh
+			db	a4h,19h,ffh,87h,efh,04h,c7h,21h
+			db	14h,8fh,74h,01h,19h,bbh,e8h,25h
+			db	b1h,d7h,5ah,25h,72h,2dh,84h,b0h
+			db	92h,83h,8ch,24h,42h,a0h,b1h,32h
+			db	e9h,0ch,2dh,77h,6dh,35h,30h,b4h
+			db	2fh,b9h,9eh,abh,53h,58h,51h,71h
+			db	a4h,f8h,35h,53h,e9h,65h,cdh,48h
+			db	28h,15h,60h,e5h,a1h,0eh,58h,60h
+			db	f9h,fah,38h,8dh,63h,60h,a1h,afh
+			db	b8h,fbh,48h,4dh,c3h,10h,23h,f0h
+			db	7bh,39h,16h,4fh,5dh,2ah,8bh,0bh
+			db	3eh,97h,32h,71h,6ch,2fh,3dh,3dh
+			db	4dh,79h,b5h,56h,1ah,0dh,1eh,11h
+			db	86h,d9h,51h,19h,2ch,64h,35h,e9h
+			db	0fh,8dh,f6h,89h,a1h,8eh,e8h,3fh
+			db	2eh,26h,95h,4ch,73h,5ch,cch,aeh
+			db	5eh,22h,a0h,bah,abh,3eh,b4h,aah
+			db	20h,02h,09h,21h,4dh,1eh,62h,2bh
+			db	6fh,09h,72h,98h,b8h,66h,bbh,4ch
+			db	89h,1dh,e8h,ddh,5eh,a1h,cch,9dh
+			db	08h,fdh,78h,d7h,c0h,9ah,29h,3ah
+			db	3dh,2eh,9ah,d9h,e3h,66h,66h,d6h
+			db	80h,40h,1fh,a5h,1ch,ebh,e8h,f0h
+			db	abh,d3h,72h,5ah,8ch,ffh,19h,afh
+			db	abh,18h,a2h,22h,31h,6ah,d7h,edh
+			db	2ch,88h,17h,b5h,6eh,03h,a4h,23h
+			db	40h,17h,d0h,85h,ech,4ah,8ch,d2h
+			db	b0h,94h,c9h,56h,bch,78h,7eh,e8h
+			db	04h,5bh,c4h,19h,4fh,e1h,c8h,b5h
+			db	57h,32h,2ch,94h,d1h,77h,e7h,29h
+			db	87h,24h,7ch,67h,9dh,8bh,5eh,75h
+			db	edh,37h,cbh,eeh,fbh,b8h,ach,73h
+			db	5ah,23h,aeh,f0h,2eh,5eh,8fh,a9h
+			db	68h,3bh,fch,28h,2fh,cdh,34h,2dh
+			db	71h,88h,59h,95h,02h,63h,f7h,a5h
+			db	8ah,afh,35h,e7h,1bh,12h,69h,63h
+			db	5dh,91h,6ah,d4h,b1h,9fh,dbh,e8h
+			db	18h,34h,dch,5bh,29h,18h,d4h,3ch
+			db	39h,29h,7dh,cch,dch,1dh,40h,84h
+			db	8eh,82h,1ch,00h,efh,1fh,b9h,02h
+			db	ebh,4dh,2fh,57h,e9h,68h,6bh,4dh
+			db	91h,15h,dbh,deh,91h,c0h,c1h,95h
+			db	b2h,4bh,58h,4fh,e5h,42h,5dh,f5h
+			db	3fh,6eh,e2h,b9h,aeh,56h,2ch,fah
+			db	76h,6bh,b6h,6eh,16h,84h,f2h,34h
+			db	3fh,9bh,2dh,ebh,f7h,0bh,abh,bfh
+			db	5fh,44h,73h,66h,82h,71h,63h,f7h
+			db	dfh,20h,97h,45h,2ch,04h,8eh,2eh
+			db	56h,8ah,4fh,ceh,1ch,c3h,00h,b8h
+			db	6eh,17h,bch,a3h,c1h,cah,31h,81h
+			db	2bh,ffh,00h,07h,22h,64h,b5h,78h
+			db	a2h,46h,c2h,0fh,60h,a4h,84h,6eh
+			db	35h,68h,53h,1ah,49h,f5h,deh,d3h
+			db	87h,edh,0fh,72h,f1h,4fh,83h,dch
+			db	82h,e9h,02h,3eh,86h,42h,9bh,1bh
+			db	feh,19h,2eh,72h,a7h,96h,f6h,1ah
+			db	dch,dbh,1eh,e6h,79h,9ch,3eh,bch
+			db	7fh,e2h,f6h,19h,b1h,4dh,48h,9eh
+			db	94h,0eh,53h,63h,c3h,28h,fdh,80h
+			db	30h,58h,75h,80h,eah,05h,0bh,fah
+			db	44h,6dh,55h,9eh,19h,50h,98h,92h
+			db	f8h,15h,79h,54h,2ch,d3h,0fh,46h
+			db	1dh,2ch,73h,83h,cch,3ch,8eh,68h
+			db	e6h,cah,2eh,cfh,37h,a2h,b0h,f3h
+			db	46h,06h,0bh,7fh,5fh,5bh,37h,74h
+			db	78h,32h,1ch,cbh,36h,78h,9eh,d8h
+			db	b1h,8dh,31h,04h,bah,f2h,f6h,d6h
+			db	0dh,7dh,12h,f7h,d2h,94h,6eh,ech
+			db	dch,fdh,20h,28h,2bh,b3h,30h,71h
+			db	3ah,83h,8bh,9eh,bch,c2h,99h,73h
+			db	f4h,44h,e5h,1ch,4fh,95h,92h,35h
+			db	8bh,b9h,4dh,dch,57h,84h,24h,03h
+			db	92h,d1h,15h,f4h,53h,36h,99h,9ah
+			db	80h,d1h,25h,5fh,12h,d3h,1bh,35h
+			db	b6h,39h,eah,40h,23h,bfh,e2h,93h
+			db	d6h,9ch,61h,89h,e2h,16h,80h,f1h
+			db	ebh,7ah,d1h,39h,17h,74h,c1h,5ah
+			db	60h,68h,54h,d4h,82h,86h,afh,d8h
+			db	85h,0bh,20h,3bh,83h,41h,60h,aah
+			db	b1h,15h,73h,b4h,06h,5ah,a3h,7bh
+			db	44h,bah,d3h,04h,8dh,b2h,e7h,a8h
+			db	1ah,a6h,5eh,40h,22h,a3h,0ah,6eh
+			db	2dh,adh,36h,79h,55h,0dh,45h,7ch
+			db	e5h,62h,b1h,b3h,70h,fbh,2bh,83h
+			db	aeh,7ch,58h,e7h,fbh,4ah,23h,81h
+			db	55h,37h,afh,c0h,d5h,d2h,24h,c9h
+			db	71h,97h,cah,9bh,07h,22h,6bh,a0h
+			db	e6h,90h,a0h,a5h,98h,c9h,54h,36h
+			db	47h,deh,fch,14h,00h,22h,cah,64h
+			db	84h,57h,38h,77h,29h,ebh,6dh,32h
+			db	9ah,4ah,a6h,dbh,d2h,ddh,efh,98h
+			db	e7h,67h,a8h,21h,ebh,a9h,39h,a0h
+			db	a4h,c9h,bfh,03h,75h,cch,27h,16h
+			db	6fh,02h,3eh,98h,ach,38h,95h,56h
+			db	e8h,29h,5fh,53h,aah,0ch,b6h,93h
+			db	a4h,6fh,49h,5eh,18h,0eh,16h,bch
+			db	a7h,cah,3eh,82h,54h,9eh,fbh,92h
+			db	46h,48h,5dh,b1h,edh,b5h,2eh,6eh
+			db	34h,8ch,4ch,58h,6ah,66h,aah,87h
+			db	6bh,ebh,4fh,fdh,33h,44h,40h,9ch
+			db	69h,f7h,d3h,ceh,10h,d1h,e1h,28h
+			db	30h,f4h,04h,bbh,edh,a3h,e9h,ech
+			db	41h,f8h,09h,b6h,c9h,58h,29h,83h
+			db	0bh,c4h,b9h,a9h,66h,bch,c1h,77h
+			db	8ch,a6h,7ch,62h,ebh,59h,4eh,c0h
+			db	e9h,bdh,41h,23h,87h,92h,68h,d3h
+			db	2bh,4fh,9ch,02h,87h,d9h,efh,efh
+			db	c7h,6ah,80h,56h,d1h,7ch,50h,4eh
+			db	feh,cdh,85h,95h,91h,00h,bch,b2h
+			db	7eh,a1h,46h,64h,74h,2eh,c3h,62h
+			db	03h,feh,7fh,66h,96h,d1h,80h,41h
+			db	78h,dfh,e1h,4fh,9bh,25h,65h,f8h
+			db	cah,26h,8eh,fah,59h,23h,c8h,7eh
+			db	f1h,6ch,92h,d6h,12h,90h,3fh,68h
+			db	cch,c0h,bdh,8ah,82h,62h,a8h,a4h
+			db	f1h,0ch,70h,a1h,b5h,89h,f4h,20h
+			db	48h,b7h,88h,5bh,16h,1ch,6eh,deh
+			db	0fh,c4h,6dh,8dh,feh,08h,1ch,17h
+			db	d0h,07h,7ch,50h,3ah,f2h,55h,6eh
+			db	47h,d1h,3bh,68h,3fh,48h,66h,2fh
+			db	45h,65h,85h,83h,2eh,89h,fdh,35h
+			db	77h,dah,f3h,beh,11h,b1h,2eh,c8h
+			db	aeh,e2h,f9h,b6h,08h,3fh,e1h,02h
+			db	42h,0bh,41h,ebh,71h,3eh,3ch,6ah
+			db	b3h,f4h,32h,76h,67h,c9h,21h,08h
+			db	04h,29h,a7h,c6h,60h,b0h,d8h,65h
+			db	0fh,c6h,4dh,41h,fah,f8h,bbh,c6h
+			db	b3h,ebh,36h,dah,e4h,b6h,2fh,f4h
+			db	02h,98h,27h,e9h,d8h,79h,80h,d1h
+			db	cdh,4ah,05h,e1h,42h,41h,64h,4eh
+			db	48h,05h,a5h,37h,4bh,bah,6ch,06h
+			db	72h,94h,0ch,b5h,0eh,d0h,79h,d2h
+			db	4ah,1ch,43h,64h,24h,16h,d5h,54h
+			db	c1h,7dh,37h,42h,24h,4fh,80h,aeh
+			db	b3h,95h,79h,beh,10h,88h,feh,c1h
+			db	15h,40h,0dh,b6h,84h,ddh,fch,53h
+			db	86h,53h,c9h,7eh,c3h,ach,33h,15h
+			db	fbh,5ch,c1h,99h,d0h,08h,50h,ech
+			db	a1h,b4h,48h,35h,6ch,60h,23h,5ch
+			db	7fh,a7h,79h,96h,23h,f1h,f0h,3dh
+			db	aeh,94h,61h,63h,e3h,45h,e0h,c3h
+			db	abh,b1h,dbh,e5h,48h,81h,e5h,6bh
+			db	6ch,54h,99h,e2h,12h,68h,c3h,8ah
+			db	30h,05h,2dh,b5h,96h,fah,deh,e1h
+			db	53h,3bh,bch,65h,c9h,5ah,ffh,89h
+			db	39h,4bh,83h,30h,33h,46h,78h,2ch
+			db	f0h,47h,62h,f1h,f0h,a2h,96h,9ah
+			db	c9h,edh,6dh,b1h,18h,43h,3ch,bah
+			db	24h,14h,e5h,afh,91h,7ch,1ah,c1h
+			db	3bh,39h,ceh,65h,7dh,dch,5dh,3ah
+			db	eeh,72h,e0h,10h,82h,39h,6ah,53h
+			db	56h,23h,76h,a0h,31h,38h,93h,d0h
+			db	96h,8ch,beh,fdh,32h,feh,3ch,00h
+			db	f0h,42h,cch,98h,44h,f8h,13h,7bh
+			db	bch,4dh,2ch,d8h,b5h,87h,b1h,b4h
+			db	64h,deh,d6h,e6h,80h,a4h,f4h,3bh
+			db	b1h,efh,43h,d1h,82h,aah,5fh,feh
+			db	b2h,c0h,7ch,e7h,78h,32h,bdh,09h
+			db	17h,3eh,72h,14h,06h,b9h,edh,02h
+			db	6fh,b5h,2ah,6eh,e3h,8ah,fch,e1h
+			db	feh,97h,c9h,e8h,bbh,21h,f1h,2ch
+			db	10h,c5h,26h,c8h,2dh,50h,43h,e0h
+			db	89h,56h,0eh,32h,98h,c2h,b7h,f3h
+			db	ceh,d5h,49h,0fh,f8h,04h,cah,94h
+			db	8ah,b6h,ebh,7fh,70h,57h,c6h,33h
+			db	2ch,2ah,bch,6bh,8fh,9ch,dch,2fh
+			db	cdh,8dh,04h,51h,18h,bah,34h,75h
+			db	4eh,ech,96h,1fh,84h,18h,76h,d3h
+			db	d5h,c0h,23h,bfh,c6h,74h,9fh,5ah
+			db	eah,94h,7dh,7dh,1dh,3eh,76h,f8h
+			db	17h,cbh,c9h,8eh,50h,00h,8dh,4eh
+			db	6ch,6fh,8dh,fah,abh,bdh,20h,83h
+			db	0ah,39h,48h,ach,9ah,89h,6bh,90h
+			db	18h,8ah,24h,cdh,6bh,c8h,cch,61h
+			db	0eh,80h,75h,21h,e4h,22h,dbh,dch
+			db	48h,bdh,81h,53h,c5h,d7h,10h,43h
+			db	6fh,c4h,c8h,22h,fch,30h,6ch,02h
+			db	d6h,8ah,87h,1dh,bdh,08h,79h,3bh
+			db	cbh,9eh,22h,bch,61h,78h,71h,91h
+			db	aeh,5ch,0ah,cdh,bbh,dch,c0h,b4h
+			db	3ch,53h,eeh,e3h,9ah,f3h,cfh,89h
+			db	6bh,b6h,d7h,6dh,77h,21h,3dh,21h
+			db	f9h,d8h,35h,3bh,ddh,c5h,34h,fch
+			db	07h,3ch,49h,78h,abh,70h,e9h,22h
+			db	abh,aah,2ah,f6h,e4h,dch,dfh,a2h
+			db	d2h,0bh,05h,4ch,a7h,5dh,d3h,c0h
+			db	e9h,cah,deh,61h,a6h,30h,9fh,9ch
+			db	c0h,3eh,0ah,14h,aah,47h,54h,cch
+			db	51h,20h,06h,bbh,dch,e2h,a3h,72h
+			db	37h,fch,beh,74h,ebh,9dh,3ah,a4h
+			db	3eh,aeh,8eh,51h,bbh,e8h,85h,fch
+			db	d8h,e8h,83h,d0h,0ah,90h,50h,b9h
+			db	fdh,a7h,3fh,a6h,4fh,a4h,06h,7fh
+			db	65h,2fh,dbh,f5h,13h,32h,c5h,35h
+			db	06h,39h,0bh,23h,62h,53h,6dh,3bh
+			db	b9h,f7h,cah,38h,eah,d3h,82h,2ah
+			db	56h,aah,6ch,7ch,a7h,0ch,7fh,90h
+			db	72h,62h,5dh,5ch,aah,5fh,ebh,d2h
+			db	11h,5dh,40h,60h,43h,6dh,46h,f6h
+			db	f6h,beh,75h,bbh,b9h,0fh,74h,a3h
+			db	45h,19h,74h,71h,3ah,23h,ach,dch
+			db	1dh,eah,25h,1ch,d6h,44h,44h,aah
+			db	74h,79h,24h,fbh,efh,3eh,d9h,c6h
+			db	eah,62h,75h,eeh,a3h,15h,38h,f3h
+			db	bfh,5eh,e2h,b9h,28h,0ch,d4h,25h
+			db	fah,35h,2bh,80h,b4h,2eh,c3h,9bh
+			db	22h,61h,44h,efh,a5h,e2h,2fh,d2h
+			db	64h,53h,86h,eeh,fbh,e5h,7fh,61h
+			db	7dh,8fh,7ah,71h,cbh,abh,d8h,9dh
+			db	01h,8ah,80h,8fh,11h,afh,ffh,87h
+			db	82h,09h,7fh,60h,b4h,81h,b4h,09h
+			db	94h,a1h,9bh,adh,4bh,c4h,35h,45h
+			db	23h,78h,53h,f6h,a2h,81h,bch,99h
+			db	60h,7eh,deh,bch,a1h,58h,aeh,32h
+			db	43h,12h,5dh,f4h,d8h,cdh,27h,3ch
+			db	20h,c3h,8dh,d7h,61h,e1h,8bh,c2h
+			db	b0h,d6h,b1h,8eh,0dh,a0h,61h,6ch
+			db	0eh,50h,b2h,e4h,2bh,d2h,d7h,24h
+			db	48h,27h,4fh,31h,87h,70h,6bh,dfh
+			db	f6h,e2h,ffh,72h,d6h,02h,f6h,2eh
+			db	31h,e9h,dfh,83h,89h,48h,c1h,4ah
+			db	19h,d5h,86h,8fh,b6h,37h,d7h,56h
+			db	c9h,11h,a8h,71h,1ch,a5h,c6h,22h
+			db	d4h,fch,17h,79h,2ch,4ah,dch,94h
+			db	65h,2fh,b0h,27h,c7h,abh,9ch,a7h
+			db	7ch,f4h,fch,b2h,97h,e5h,91h,b6h
+			db	27h,15h,afh,d5h,dfh,f9h,34h,cah
+			db	f6h,eah,76h,ceh,f1h,ach,34h,f1h
+			db	cah,ebh,62h,54h,2bh,4fh,09h,5fh
+			db	85h,eeh,45h,e1h,9ah,e9h,f5h,36h
+			db	26h,47h,b1h,beh,49h,b9h,61h,fah
+			db	1ah,00h,5eh,79h,e4h,29h,4ah,b3h
+			db	61h,d1h,9fh,aah,46h,b4h,44h,f3h
+			db	f2h,f8h,f9h,5eh,3bh,8bh,7dh,c0h
+			db	e4h,52h,9ah,ddh,7bh,16h,60h,1ch
+			db	d8h,54h,d7h,bfh,2fh,ddh,8ch,04h
+			db	e0h,d2h,b5h,4bh,b0h,bah,e8h,04h
+			db	a8h,7bh,eeh,f8h,efh,09h,48h,c7h
+			db	3ch,19h,d9h,45h,cch,76h,0ch,8ch
+			db	0dh,92h,32h,bdh,72h,eeh,94h,b6h
+			db	d9h,b5h,81h,f4h,9ah,90h,7dh,9dh
+			db	7fh,61h,93h,0fh,11h,c3h,7bh,6ch
+			db	6ch,0bh,2ch,3ch,3eh,86h,bdh,95h
+			db	7ch,c3h,4fh,c3h,67h,80h,38h,c6h
+			db	67h,c7h,eeh,30h,d5h,57h,71h,41h
+			db	b8h,9bh,67h,44h,60h,78h,76h,5bh
+			db	32h,04h,99h,6fh,66h,c2h,edh,9eh
+			db	26h,36h,e5h,18h,9ch,70h,4eh,b2h
+			db	e9h,96h,bfh,42h,6dh,25h,cdh,b8h
+			db	e9h,30h,e1h,3ah,fdh,f7h,26h,c2h
+			db	1ah,09h,d5h,a9h,7bh,34h,2eh,d9h
+			db	25h,3eh,10h,2eh,a3h,65h,bbh,2ch
+			db	05h,73h,88h,36h,c7h,b3h,39h,69h
+			db	28h,dch,45h,f4h,2bh,62h,7fh,0ah
+			db	b7h,52h,e0h,4bh,bdh,bbh,b7h,beh
+			db	89h,6eh,a3h,b7h,5fh,a4h,22h,0ch
+			db	79h,e7h,e8h,cch,57h,1fh,19h,0dh
+			db	e5h,46h,cbh,87h,5bh,a0h,94h,c6h
+			db	2eh,09h,c1h,b5h,8ah,b1h,b5h,c7h
+			db	2eh,2ah,6dh,11h,f8h,7ch,abh,1ah
+			db	b3h,e0h,59h,7fh,a8h,5dh,57h,fdh
+			db	c6h,8ah,a3h,d1h,a3h,c6h,6dh,fch
+			db	92h,08h,9fh,58h,abh,32h,96h,48h
+			db	9fh,fch,1eh,4ch,40h,b0h,38h,adh
+			db	eeh,c6h,edh,70h,3fh,9ah,45h,cch
+			db	e6h,7fh,03h,1ah,6fh,87h,1fh,23h
+			db	88h,0bh,ddh,22h,b8h,6bh,bah,c0h
+			db	36h,60h,84h,6fh,54h,56h,86h,15h
+			db	96h,2dh,1dh,19h,c7h,13h,47h,15h
+			db	e0h,63h,9dh,e8h,ach,8bh,b4h,8fh
+			db	97h,38h,22h,deh,aah,e9h,83h,e4h
+			db	ceh,b8h,89h,beh,e9h,38h,8dh,75h
+			db	56h,3fh,d4h,7dh,a0h,d4h,9eh,d1h
+			db	bdh,76h,f7h,26h,feh,9eh,92h,dfh
+			db	45h,beh,73h,3ch,9eh,cah,ffh,38h
+			db	8ch,cch,f6h,97h,4eh,13h,b2h,4ah
+			db	8eh,3fh,fah,96h,3ch,83h,5eh,93h
+			db	e8h,deh,10h,57h,60h,27h,61h,b3h
+			db	28h,83h,9ah,c7h,3dh,41h,32h,07h
+			db	89h,dbh,e8h,ffh,91h,5dh,0fh,f8h
+			db	27h,43h,2fh,34h,f4h,e7h,b1h,73h
+			db	f5h,b3h,0ah,f0h,0eh,8ah,59h,0fh
+			db	b6h,08h,59h,bdh,66h,cbh,49h,12h
+			db	86h,9fh,6fh,2dh,ach,f3h,4ch,71h
+			db	90h,23h,b2h,cfh,7dh,21h,d1h,74h
+			db	0bh,feh,b9h,14h,79h,03h,66h,dfh
+			db	b2h,dah,71h,08h,bah,97h,27h,7ah
+			db	99h,86h,69h,4fh,08h,40h,75h,91h
+			db	a2h,56h,c6h,42h,cfh,01h,8dh,87h
+			db	7bh,c4h,98h,67h,17h,3eh,dch,beh
+			db	f1h,79h,22h,53h,0dh,79h,ach,05h
+			db	fah,37h,3bh,22h,2ch,9bh,14h,fbh
+			db	a4h,b4h,22h,3ah,4fh,fch,b2h,41h
+			db	97h,62h,cfh,93h,8ch,9eh,33h,e1h
+			db	8fh,49h,adh,6bh,fch,bch,e3h,bah
+			db	6fh,ebh,2bh,03h,0dh,18h,5ah,08h
+			db	7bh,abh,28h,deh,3dh,6ch,1ch,49h
+			db	fdh,c6h,0dh,41h,9dh,1dh,45h,26h
+			db	86h,37h,2eh,b8h,5dh,72h,b6h,82h
+			db	27h,69h,61h,90h,e7h,61h,47h,91h
+			db	73h,4ah,46h,fch,d3h,e2h,ebh,02h
+			db	aah,4eh,4ch,a1h,5fh,96h,8ah,b7h
+			db	abh,18h,a0h,a8h,d8h,efh,e9h,cfh
+			db	49h,6eh,b8h,d1h,42h,54h,77h,15h
+			db	adh,90h,25h,77h,70h,63h,03h,40h
+			db	70h,48h,2ch,36h,e6h,beh,51h,fch
+			db	21h,b6h,e3h,a4h,afh,3dh,70h,ceh
+			db	33h,bfh,feh,4ah,ech,33h,34h,c7h
+			db	65h,14h,d4h,3eh,dfh,a3h,6ah,76h
+			db	c0h,0dh,90h,47h,cdh,cah,28h,22h
+			db	5fh,3fh,4ch,69h,8eh,b9h,1fh,beh
+			db	6ah,f9h,fch,dch,d9h,51h,e6h,f9h
+			db	20h,5dh,57h,e5h,12h,71h,46h,3eh
+			db	ddh,a5h,deh,11h,f0h,3dh,c3h,54h
+			db	6ah,e1h,9ah,1dh,65h,47h,24h,1dh
+			db	b7h,15h,34h,77h,78h,b9h,72h,4ch
+			db	bch,b6h,9eh,28h,8eh,edh,f2h,48h
+			db	fdh,fah,6dh,94h,cbh,3bh,2ah,86h
+			db	25h,25h,fah,a9h,99h,e2h,95h,e4h
+			db	46h,63h,8bh,b6h,6fh,30h,1bh,04h
+			db	a3h,a3h,06h,c3h,10h,0dh,ebh,35h
+			db	f9h,02h,3ah,4bh,eah,e7h,4eh,36h
+			db	1bh,32h,bch,9bh,0fh,d3h,09h,49h
+			db	1ch,a8h,85h,1ah,38h,f9h,79h,3ah
+			db	b2h,80h,fbh,d2h,2bh,e6h,e7h,22h
+			db	0bh,a8h,82h,09h,15h,4fh,e2h,e5h
+			db	6eh,2eh,34h,f3h,86h,c8h,adh,0eh
+			db	12h,b4h,62h,65h,84h,a1h,42h,50h
+			db	a3h,5ch,96h,99h,64h,86h,59h,ffh
+			db	d3h,98h,4bh,b2h,cch,a5h,71h,3eh
+			db	5fh,a2h,60h,85h,75h,f3h,89h,46h
+			db	2bh,6eh,84h,66h,a1h,96h,5ah,2eh
+			db	99h,13h,3dh,ceh,b9h,c2h,40h,fdh
+			db	0ch,08h,27h,10h,d3h,7bh,f6h,3dh
+			db	b6h,03h,5ah,30h,dah,05h,49h,a3h
+			db	14h,7ah,dch,7ch,79h,91h,1ah
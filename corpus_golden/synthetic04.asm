@@ -0,0 +1,2114 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	b4h,bch,b9h,aeh,d3h,42h,65h,19h
+			db	f5h,9bh,60h,7bh
+
+start:						; execution starting point
+			pop	af
+			jp	c,Lac2a
+			add	hl,de
+			call	m,L01d4
+			and	(hl)
+			ld	hl,(32abh)
+			jr	z,L3fab
+			ld	d,e
+			ld	h,d
+			ld	a,h
+			halt
+			ld	(hl),l
+			ld	b,a
+			inc	d
+			call	c,Ld89a
+			rst	38h
+			cp	4ch
+			call	pe,Lca93
+			dec	(hl)
+			xor	e
+			ld	a,(bc)
+			ld	b,d
+			ld	l,d
+			or	(hl)
+			ld	l,e
+			ld	l,ddh
+			ld	e,b
+			adc	a,a
+			jp	m,L8cb7
+			rla
+			jp	nc,L73bd
+			rst	00h
+			ex	af,af'
+			ret
+			db	80h,9bh,d5h,90h,fah,0ah,99h,5dh
+			db	0eh,c2h,beh,08h,5ah,cah,74h,6fh
+			db	43h,e5h,ddh,2ah,1ah,10h,6fh,1bh
+			db	a3h,63h,61h,95h,07h,09h,aeh,6eh
+			db	adh,8fh,a6h,94h,32h,15h,c3h,bdh
+			db	a6h,63h,cah,97h,46h,00h,55h,09h
+			db	d0h,b6h,9dh,6ch,4fh,7bh,e5h,8ah
+			db	45h,5ch,a1h,0ch,71h,43h,30h,9bh
+			db	adh,d9h,9ah,e0h,bah,9dh,e9h,d7h
+			db	f6h,83h,25h,c5h,73h,8eh,a8h,8ah
+			db	7eh,c9h,25h,69h,7bh,27h,fdh,80h
+			db	d8h,4dh,deh,bbh,b9h,66h,51h,24h
+			db	1dh,0fh,22h,d9h,a4h,efh,1ah,c1h
+			db	42h,fdh,1eh,61h,59h,e4h,09h,9ah
+			db	c9h,4fh,abh,f4h,e5h,56h,85h,9fh
+			db	8fh,ach,5ah,67h,3fh,beh,f9h,28h
+			db	59h,aah,e1h,53h,d0h,cbh,54h,c9h
+			db	4ch,11h,27h,36h,1dh,40h,b2h,48h
+			db	50h,47h,67h,0bh,f2h,19h,5bh,84h
+			db	a7h,e0h,92h,26h,4ah,75h,a4h,dbh
+			db	b5h,c8h,23h,5bh,efh,c4h,81h,28h
+			db	f1h,dfh,6fh,86h,67h,d3h,b5h,8ch
+			db	10h,cfh,d5h,feh,a3h,41h,88h,03h
+			db	e5h,bbh,33h,02h,34h,8fh,34h,17h
+			db	e2h,05h,dah,fdh,35h,2eh,d7h,78h
+			db	03h,0ah,27h,3bh,12h,f8h,5fh,44h
+			db	33h,d7h,a6h,3ch,c9h,59h,b6h,bbh
+			db	99h,eeh,4eh,21h,71h,d5h,1ch,d3h
+			db	10h,e8h,6fh,52h,ech,3fh,00h,fdh
+			db	d0h,34h,40h,b2h,55h,fbh,88h,2bh
+			db	03h,bfh,f8h,7bh,5eh,38h,0dh,83h
+			db	f4h,64h,bch,feh,8dh,d9h,27h,eeh
+			db	9ah,5dh,a9h,98h,7ah,50h,9fh,9dh
+			db	f9h,efh,8fh,3ah,24h,b2h,d9h,90h
+			db	7dh,4fh,c4h,c2h,6eh,99h,39h,42h
+			db	1dh,51h,c2h,ceh,30h,89h,fbh,2ch
+			db	cch,e1h,4fh,c5h,a7h,1ch,4dh,41h
+			db	8ah,71h,a0h,4bh,80h,05h,4dh,c7h
+			db	20h,0ah,68h,d3h,38h,b2h,2ch,36h
+			db	adh,05h,09h,13h,4fh,6ch,c6h,33h
+			db	5eh,9ah,dfh,95h,e0h,17h,0ch,b6h
+			db	a1h,a4h,59h,9fh,cbh,cfh,6ah,a7h
+			db	92h,3ch,1ah,bch,e8h,52h,f5h,a8h
+			db	6fh,7ch,dbh,04h,04h,beh,73h,39h
+			db	a1h,a2h,1eh,65h,35h,8bh,1bh,28h
+			db	a5h,8ch,eeh,60h,e3h,cah,3fh,8ch
+			db	cah,bah,ach,fch,d9h,d0h,0fh,f3h
+			db	50h,73h,0ah,3ah,20h,d8h,ach,37h
+			db	9ah,1fh,1ch,fah,e3h,76h,6dh,d2h
+			db	b7h,64h,52h,cbh,85h,03h,03h,44h
+			db	e0h,56h,82h,24h,1ch,eeh,18h,51h
+			db	33h,f9h,49h,36h,88h,afh,b8h,c8h
+			db	98h,edh,9bh,90h,80h,f2h,c7h,1ah
+			db	33h,4eh,6bh,4eh,d9h,b7h,21h,d6h
+			db	d5h,5ah,26h,6ah,e6h,94h,6fh,94h
+			db	17h,d5h,1eh,44h,c7h,eeh,f3h,44h
+			db	74h,24h,12h,48h,66h,d0h,cdh,7bh
+			db	68h,bbh,3dh,cdh,22h,71h,28h,cdh
+			db	8dh,06h,4ah,f2h,94h,deh,95h,3dh
+			db	5ch,80h,48h,9dh,efh,61h,30h,5bh
+			db	50h,f5h,8eh,03h,9ch,39h,13h,13h
+			db	82h,00h,6ch,dch,4fh,40h,1fh,53h
+			db	74h,9eh,d0h,2ch,c1h,d3h,eah,76h
+			db	27h,d8h,07h,b0h,60h,f0h,d2h,5fh
+			db	1ch,f6h,56h,8ah,f2h,5ch,cfh,60h
+			db	b8h,e3h,e2h,41h,bch,7bh,d1h,6dh
+			db	ach,ebh,38h,97h,4dh,c1h,c0h,2dh
+			db	8bh,b7h,ceh,03h,6dh,96h,2eh,29h
+			db	53h,4bh,95h,2eh,6ah,69h,aeh,bch
+			db	96h,e0h,d1h,b7h,22h,b1h,0eh,cbh
+			db	46h,edh,78h,f0h,a7h,90h,88h,6eh
+			db	93h,79h,30h,8eh,64h,4ch,feh,9ah
+			db	a9h,0eh,cah,b3h,f6h,59h,04h,85h
+			db	c2h,39h,67h,40h,4eh,4dh,9ch,00h
+			db	cdh,5bh,dbh,e1h,e0h,7ah,26h,53h
+			db	ffh,cch,4ah,3ah,46h,cbh,6ch,0ch
+			db	e1h,9ch,6dh,d8h,45h,8ch,b4h,29h
+			db	c9h,97h,d1h,36h,a3h,58h,d3h,81h
+			db	87h,55h,21h,a4h,24h,8dh,4fh,e7h
+			db	79h,2ah,bah,7fh,7ch,3dh,e4h,7ah
+			db	7ah,efh,f7h,47h,43h,96h,83h,c8h
+			db	23h,16h,51h,d6h,01h,f9h,b5h,74h
+			db	44h,3bh,b5h,72h,d5h,3eh,3ah,edh
+			db	bah,85h,b7h,1bh,1ch,51h,e8h,7ch
+			db	e7h,59h,4ch,e1h,34h,0dh,dch,aah
+			db	09h,e0h,e9h,ffh,3bh,bfh,b8h,67h
+			db	d2h,04h,9eh,7eh,1ch,cdh,68h,1bh
+			db	d9h,bch,cfh,7ch,1ch,86h,b5h,87h
+			db	50h,a4h,aah,83h,31h,b0h,47h,2bh
+			db	beh,01h,b8h,19h,4fh,f1h,94h,fdh
+			db	33h,b1h,7ch,ddh,3fh,7eh,e5h,c5h
+			db	71h,25h,5ch,d5h,c0h,04h,d5h,52h
+			db	2fh,9ch,ech,6ch,65h,84h,1eh,a8h
+			db	dah,ffh,16h,8bh,1ah,33h,dbh,48h
+			db	a6h,38h,30h,8fh,e9h,61h,63h,2fh
+			db	dfh,2bh,63h,36h,3dh,26h,6ch,2dh
+			db	9ch,8dh,9dh,63h,fch,e9h,a9h,fah
+			db	c5h,c2h,76h,ffh,40h,6ah,edh,11h
+			db	6dh,4ch,f2h,24h,53h,03h,77h,d3h
+			db	f6h,c1h,77h,9fh,24h,b9h,64h,4eh
+			db	42h,feh,aah,30h,57h,31h,06h,f3h
+			db	9ah,59h,52h,75h,6eh,c2h,fch,66h
+			db	97h,beh,68h,5bh,2bh,c7h,87h,cbh
+			db	c8h,17h,78h,f5h,ach,c6h,60h,71h
+			db	2ch,57h,3ch,98h,adh,92h,50h,4ah
+			db	14h,fdh,4fh,20h,f5h,75h,90h,62h
+			db	d9h,a4h,33h,07h,21h,e9h,95h,23h
+			db	f4h,feh,76h,63h,3dh,deh,6ah,91h
+			db	25h,85h,0fh,26h,7ch,4ch,c2h,54h
+			db	24h,8eh,67h,73h,23h,1eh,8ch,f1h
+			db	d2h,e3h,58h,04h,29h,b2h,f8h,3dh
+			db	b1h,49h,86h,aeh,20h,05h,eeh,88h
+			db	36h,92h,64h,d1h,79h,6bh,c1h,9ch
+			db	0eh,16h,fdh,c9h,4fh,adh,f1h,02h
+			db	74h,99h,9fh,b6h,e4h,30h,bch,85h
+			db	15h,33h,bdh,ffh,cdh,bdh,0ch,57h
+			db	dbh,22h,b2h,cbh,92h,89h,27h,04h
+			db	12h,64h,1ch,f2h,b5h,7ch,56h,d4h
+			db	43h,d3h,ffh,2ch,ffh,e1h,5fh,ddh
+			db	36h,c3h,8ah,70h,04h,f0h,fah,d0h
+			db	d3h,5bh,65h,e4h,61h,2ch,35h,48h
+			db	dch,02h,ech,6ah,08h,f3h,11h,4eh
+			db	a0h,29h,73h,bch,41h,26h,09h,93h
+			db	21h,3ch,23h,75h,13h,14h,8fh,b5h
+			db	82h,dfh,7fh,66h,c1h,83h,d9h,16h
+			db	63h,c5h,2dh,7dh,a1h,1ah,58h,26h
+			db	48h,d9h,5ch,0bh,53h,71h,6dh,f8h
+			db	fdh,fbh,e5h,e7h,53h,47h,e2h,90h
+			db	54h,fdh,b1h,0bh,a2h,feh,62h,95h
+			db	08h,70h,0dh,60h,ech,e5h,80h,afh
+			db	30h,43h,eeh,5ch,43h,aah,f3h,6ch
+			db	0fh,beh,cdh,ebh,97h,5fh,10h,94h
+			db	75h,c9h,a1h,8ah,35h,d6h,45h,e1h
+			db	59h,e1h,dch,3dh,8fh,62h,b2h,8bh
+			db	d5h,a5h,21h,23h,4eh,8dh,4ch,95h
+			db	20h,6dh,dah,53h,98h,9fh,b3h,f0h
+			db	9bh,e5h,7eh,a0h,d9h,94h,bch,f1h
+			db	cdh,7dh,aah,aah,89h,65h,88h,c1h
+			db	08h,f7h,25h,eeh,71h,2ch,8ch,34h
+			db	69h,24h,8dh,9bh,aeh,8ch,fdh,96h
+			db	6dh,01h,49h,e3h,f6h,c0h,dch,c4h
+			db	08h,b1h,89h,23h,60h,72h,a5h,c6h
+			db	9dh,34h,bah,6dh,a7h,72h,1ch,bdh
+			db	0ch,34h,88h,2bh,4ch,0ch,d7h,61h
+			db	d6h,56h,18h,62h,9eh,fch,e4h,7dh
+			db	e6h,39h,7fh,ddh,84h,ach,34h,e2h
+			db	7fh,e6h,38h,4fh,cch,13h,8fh,f6h
+			db	56h,7ch,60h,4ah,4ch,79h,69h,0bh
+			db	f8h,6dh,4eh,80h,5eh,e5h,83h,32h
+			db	17h,5ah,91h,01h,a9h,8ch,e1h,a4h
+			db	ddh,a4h,12h,76h,b4h,45h,eeh,52h
+			db	98h,8bh,4ah,17h,9fh,f9h,04h,36h
+			db	4fh,f3h,94h,25h,cfh,12h,f5h,5fh
+			db	93h,4dh,aeh,88h,6dh,d6h,9ah,f5h
+			db	9bh,3ch,a1h,16h,98h,22h,d5h,62h
+			db	c7h,5ah,6bh,53h,aeh,e8h,69h,aeh
+			db	a1h,dah,d3h,b5h,0fh,6bh,92h,d7h
+			db	8ch,e6h,aah,deh,bdh,07h,07h,b4h
+			db	c3h,bfh,cdh,bbh,5ch,8ch,89h,75h
+			db	abh,4ch,31h,2dh,d9h,61h,9ah,bah
+			db	0bh,59h,1fh,1bh,8ch,6dh,ach,dah
+			db	51h,21h,57h,56h,1bh,9eh,d7h,56h
+			db	fch,84h,c5h,98h,aah,35h,16h,d4h
+			db	7ah,25h,56h,9fh,26h,24h,64h,9bh
+			db	96h,dch,60h,64h,d1h,fdh,f2h,ffh
+			db	ech,c0h,35h,f8h,b5h,fbh,6dh,0ch
+			db	c9h,4dh,f0h,03h,b6h,fbh,74h,50h
+			db	2fh,7eh,bch,d4h,8ah,65h,ceh,01h
+			db	b7h,3bh,ech,0eh,05h,d7h,bfh,dah
+			db	2dh,a1h,a1h,25h,f0h,6fh,38h,a6h
+			db	d7h,e2h,63h,a5h,b5h,1ch,27h,29h
+			db	bdh,1ah,e2h,3ch,4eh,6ch,4dh,3ch
+			db	93h,76h,86h,90h,d1h,72h,44h,a5h
+			db	1fh,f5h,b9h,6ch,20h,5bh,5ch,4bh
+			db	29h,83h,55h,8eh,98h,5ah,c3h,90h
+			db	36h,cbh,80h,56h,9dh,a7h,feh,abh
+			db	a5h,d9h,dch,73h,83h,14h,28h,fdh
+			db	adh,60h,c0h,6fh,13h,edh,6fh,11h
+			db	f1h,1dh,9ch,56h,c5h,c9h,40h,cdh
+			db	8ch,c3h,f4h,f4h,f1h,e4h,49h,5eh
+			db	72h,b5h,88h,46h,b7h,35h,54h,9ah
+			db	10h,ceh,8bh,17h,09h,6ch,89h,8eh
+			db	0ah,feh,02h,96h,62h,e8h,58h,77h
+			db	9bh,b4h,1fh,38h,9bh,c8h,86h,c2h
+			db	dah,98h,32h,f4h,2eh,e9h,69h,ffh
+			db	beh,c1h,1dh,b9h,f0h,a5h,88h,e0h
+			db	67h,f3h,c7h,83h,36h,bdh,91h,56h
+			db	7bh,e7h,c5h,c4h,bbh,b9h,3dh,06h
+			db	58h,bah,f8h,51h,7bh,11h,76h,11h
+			db	1dh,ebh,a6h,5fh,c5h,e6h,e1h,abh
+			db	2eh,b0h,d0h,c5h,b9h,2dh,c3h,bfh
+			db	4ah,75h,fbh,eeh,09h,c3h,19h,64h
+			db	02h,e2h,f7h,e1h,75h,e3h,a7h,c5h
+			db	32h,5fh,bbh,7ah,9ah,b5h,62h,27h
+			db	5ch,0ch,67h,f3h,dfh,67h,e6h,a8h
+			db	70h,19h,55h,27h,eah,20h,78h,12h
+			db	51h,b5h,fbh,1fh,33h,39h,40h,90h
+			db	0fh,45h,67h,f4h,a0h,71h,42h,dch
+			db	a4h,63h,d2h,fch,a2h,66h,f4h,3dh
+			db	2bh,71h,c3h,88h,66h,fch,45h,73h
+			db	1ah,66h,9bh,edh,10h,e2h,46h,90h
+			db	25h,6bh,5bh,f6h,40h,a3h,35h,7bh
+			db	c8h,54h,05h,1fh,8dh,d8h,ebh,8dh
+			db	efh,e0h,74h,96h,6bh,23h,89h,f7h
+			db	aah,fah,45h,51h,79h,86h,95h,c0h
+			db	e2h,d6h,83h,cdh,fah,9eh,80h,07h
+			db	b1h,e1h,52h,beh,57h,20h,32h,80h
+			db	28h,e0h,3fh,b0h,44h,08h,58h,bdh
+			db	45h,61h,1bh,e1h,b4h,0bh,ffh,d2h
+			db	81h,63h,69h,f5h,c1h,4eh,0ch,88h
+			db	40h,adh,79h,88h,aeh,3dh,84h,aah
+			db	6ch,46h,59h,cah,92h,02h,31h,cch
+			db	70h,b2h,40h,24h,e4h,0ch,d0h,d0h
+			db	d8h,d3h,66h,27h,fch,00h,a8h,6ch
+			db	cdh,fdh,28h,c0h,8ch,a7h,0bh,e2h
+			db	54h,9ah,76h,fch,5ah,80h,47h,63h
+			db	0dh,8ch,b0h,65h,bah,8ch,beh,34h
+			db	80h,4ch,41h,cah,a0h,f5h,51h,8ah
+			db	a4h,c1h,16h,a7h,55h,12h,44h,17h
+			db	6bh,62h,eeh,a2h,bch,94h,20h,f6h
+			db	b2h,79h,71h,27h,d3h,93h,6fh,a7h
+			db	f0h,f1h,b1h,9fh,3fh,b0h,8ah,1ch
+			db	aah,1ch,edh,88h,eeh,88h,06h,7bh
+			db	4bh,5fh,e0h,ffh,a6h,23h,35h,1ch
+			db	d1h,72h,b5h,c4h,18h,c9h,8fh,32h
+			db	0bh,eah,46h,33h,fdh,4ah,5dh,67h
+			db	3ch,a3h,2dh,f4h,7ch,26h,b7h,6bh
+			db	87h,afh,a3h,a4h,31h,dah,18h,53h
+			db	64h,71h,c5h,42h,34h,35h,55h,6eh
+			db	57h,23h,1dh,1bh,5bh,36h,7eh,81h
+			db	00h,abh,24h,00h,d4h,42h,efh,30h
+			db	40h,1ah,57h,63h,2dh,58h,13h,b4h
+			db	30h,e1h,6ch,e5h,bbh,9ah,f4h,b7h
+			db	25h,feh,2eh,55h,24h,dfh,ffh,a5h
+			db	39h,dbh,71h,bch,e1h,eeh,40h,f4h
+			db	a5h,5dh,49h,ffh,29h,5ah,3ch,e2h
+			db	7eh,73h,3ch,28h,6bh,62h,82h,0dh
+			db	e4h,1eh,c5h,5ah,f3h,67h,24h,8ah
+			db	58h,ebh,56h,bch,6eh,8ch,d3h,5ah
+			db	5ch,c9h,cdh,d0h,3dh,6eh,74h,b8h
+			db	a7h,37h,5eh,6ah,bah,73h,fdh,7ch
+			db	fbh,e1h,41h,fbh,32h,7bh,4eh,d9h
+			db	ach,a8h,91h,8eh,93h,5ch,63h,05h
+			db	dch,68h,1eh,d9h,41h,5ah,fah,bfh
+			db	3eh,b1h,afh,49h,08h,adh,60h,dah
+			db	efh,99h,d2h,89h,0fh,9eh,83h,45h
+			db	f6h,49h,6bh,67h,53h,03h,59h,f4h
+			db	7ch,81h,26h,1bh,60h,beh,79h,7ah
+			db	c5h,40h,90h,76h,4fh,83h,c6h,bah
+			db	dch,97h,7ah,b0h,49h,75h,3ah,a4h
+			db	92h,91h,2fh,c5h,f4h,95h,e4h,dah
+			db	bdh,0ch,72h,7dh,49h,6fh,78h,c9h
+			db	35h,7fh,a0h,3fh,e1h,d7h,8ah,30h
+			db	9ch,2dh,f8h,17h,e9h,55h,e9h,70h
+			db	d9h,dfh,4fh,c9h,5dh,ebh,c8h,21h
+			db	cah,efh,52h,4eh,0fh,dbh,38h,94h
+			db	5bh,2ah,10h,fbh,65h,b2h,a7h,02h
+			db	58h,9bh,2ah,26h,66h,07h,80h,a8h
+			db	e9h,9bh,bbh,33h,a4h,e4h,5ah,96h
+			db	c0h,6fh,f9h,41h,1eh,45h,88h,9eh
+			db	a3h,62h,f7h,37h,01h,c8h,7dh,3dh
+			db	2eh,38h,dah,e6h,03h,9fh,41h,ebh
+			db	2ah,86h,9eh,5ah,6fh,adh,28h,dah
+			db	6ah,48h,afh,a0h,4bh,42h,4dh,08h
+			db	5fh,19h,30h,bch,5dh,64h,52h,22h
+			db	c9h,0dh,8fh,67h,86h,c5h,f0h,b6h
+			db	5dh,46h,e1h,77h,a1h,49h,e4h,02h
+			db	fah,1bh,79h,a0h,98h,36h,b2h,13h
+			db	8bh,36h,3ah,82h,11h,cfh,40h,39h
+			db	b9h,d0h,a7h,60h,d2h,e6h,abh,c2h
+			db	abh,10h,6bh,fch,e9h,95h,60h,80h
+			db	69h,45h,e8h,27h,c2h,7ch,07h,7ah
+			db	0eh,82h,dah,dfh,40h,80h,7fh,58h
+			db	2ch,6fh,40h,97h,75h,00h,34h,72h
+			db	66h,09h,54h,4eh,cch,e9h,7eh,c7h
+			db	e5h,55h,b8h,54h,fbh,f0h,cah,c6h
+			db	d2h,99h,b8h,d7h,84h,63h,04h,87h
+			db	8eh,7fh,e6h,48h,08h,97h,0bh,35h
+			db	2eh,2eh,dah,4ah,7dh,60h,8bh,6eh
+			db	53h,b9h,88h,a1h,cch,e7h,70h,d1h
+			db	48h,8eh,6fh,5dh,fbh,9eh,eah,beh
+			db	a7h,46h,4fh,3bh,9eh,79h,2ch,c2h
+			db	d0h,75h,82h,1bh,2eh,86h,f9h,40h
+			db	79h,3bh,7ch,4bh,39h,6eh,dch,66h
+			db	2ah,06h,61h,26h,9dh,aah,f0h,0bh
+			db	b3h,29h,72h,3fh,48h,50h,a7h,69h
+			db	3ah,7bh,2bh,d6h,69h,b7h,b2h,31h
+			db	96h,bdh,81h,42h,46h,c1h,62h,90h
+			db	fbh,5fh,88h,bfh,b2h,32h,28h,a7h
+			db	96h,23h,40h,84h,00h,1dh,1ch,0bh
+			db	9ch,a2h,2dh,2dh,eah,a2h,3bh,38h
+			db	99h,5ch,efh,72h,37h,b3h,7eh,22h
+			db	91h,11h,5bh,f2h,93h,24h,9eh,f9h
+			db	5fh,d1h,18h,26h,40h,2ch,cch,cfh
+			db	15h,cfh,bah,9eh,adh,8bh,c3h,1ch
+			db	9ah,b7h,4fh,59h,c5h,d8h,7bh,6bh
+			db	b2h,7bh,93h,1bh,79h,35h,b0h,8ch
+			db	03h,ach,f1h,a3h,33h,d8h,f1h,09h
+			db	b8h,e4h,21h,7ah,4fh,cfh,bbh,a8h
+			db	8ah,34h,6ch,e1h,00h,95h,f5h,ffh
+			db	c0h,3dh,cfh,80h,a1h,6bh,38h,87h
+			db	a4h,95h,c9h,0dh,c7h,f0h,b6h,59h
+			db	abh,6eh,a5h,9bh,43h,80h,14h,a3h
+			db	0ch,95h,3fh,a3h,deh,5eh,78h,4dh
+			db	07h,2dh,12h,e7h,66h,8ah,51h,7bh
+			db	4dh,b1h,b0h,63h,44h,efh,d2h,53h
+			db	24h,06h,efh,21h,65h,18h,2dh,f2h
+			db	40h,33h,fdh,25h,c7h,88h,5ch,e0h
+			db	82h,41h,c4h,04h,b6h,31h,40h,a5h
+			db	6bh,eeh,6bh,02h,40h,cfh,03h,90h
+			db	82h,4ch,19h,8bh,87h,5ah,3dh,61h
+			db	84h,c3h,e4h,14h,dbh,d3h,d7h,81h
+			db	b9h,17h,32h,e4h,cfh,dfh,4fh,05h
+			db	cdh,fah,90h,dfh,62h,dch,cdh,21h
+			db	32h,dah,adh,c9h,5fh,89h,fch,09h
+			db	63h,58h,62h,6eh,9eh,c2h,27h,36h
+			db	e6h,29h,3ch,d3h,c1h,16h,2bh,20h
+			db	f4h,6ah,94h,0ch,43h,11h,3bh,dah
+			db	a4h,40h,90h,e9h,deh,8ah,73h,7dh
+			db	90h,deh,36h,e7h,63h,6dh,4dh,4fh
+			db	ebh,2ah,77h,7ah,23h,21h,47h,bbh
+			db	3ch,deh,a3h,69h,3ch,aeh,06h,a3h
+			db	63h,31h,5dh,c8h,05h,69h,ffh,29h
+			db	32h,38h,7eh,8fh,dch,54h,99h,53h
+			db	2ah,90h,6fh,e5h,d4h,aah,e8h,dbh
+			db	5eh,01h,bfh,58h,6dh,3ah,bbh,39h
+			db	28h,30h,93h,b4h,5bh,a0h,2eh,bah
+			db	60h,c0h,24h,a7h,44h,33h,abh,35h
+			db	82h,c1h,e9h,ddh,b6h,f1h,f3h,bbh
+			db	60h,38h,10h,1eh,23h,4ah,47h,ceh
+			db	57h,2bh,eah,6bh,53h,ceh,78h,88h
+			db	9bh,85h,11h,86h,cah,77h,b4h,42h
+			db	81h,14h,cah,72h,27h,c4h,e0h,5ah
+			db	0eh,f5h,beh,68h,2fh,fah,f1h,35h
+			db	cah,e8h,57h,65h,2eh,b9h,39h,aah
+			db	0bh,7bh,e1h,1eh,f2h,2dh,c2h,1bh
+			db	f8h,6fh,3dh,4ch,b1h,b2h,dfh,07h
+			db	9ah,56h,fbh,17h,05h,a2h,83h,51h
+			db	4bh,cbh,71h,84h,c7h,4ch,10h,8bh
+			db	1dh,7eh,edh,5dh,1bh,92h,f0h,53h
+			db	97h,f1h,cfh,7ah,62h,eah,dbh,cbh
+			db	2fh,bah,74h,f0h,54h,bch,7fh,e7h
+			db	cfh,65h,e1h,7eh,0eh,0ch,5dh,e2h
+			db	b2h,d9h,53h,afh,bdh,4fh,25h,5bh
+			db	64h,42h,a4h,80h,a5h,e4h,bdh,e5h
+			db	adh,e2h,eah,d0h,dbh,5fh,58h,14h
+			db	abh,55h,8ah,a1h,cfh,c5h,90h,8ch
+			db	b3h,0dh,b0h,65h,a2h,7eh,b0h,5bh
+			db	f9h,29h,d9h,a6h,29h,dbh,cdh,05h
+			db	6dh,22h,84h,8ch,32h,c1h,aeh,00h
+			db	62h,abh,48h,64h,a4h,b0h,e2h,f4h
+			db	c7h,10h,bdh,52h,f1h,efh,20h,95h
+			db	11h,0bh,7dh,10h,6ch,1eh,d8h,beh
+			db	d0h,3ch,e9h,98h,eeh,c1h,fdh,29h
+			db	63h,65h,bdh,ach,f2h,14h,a3h,54h
+			db	81h,22h,cfh,2fh,35h,e1h,15h,9bh
+			db	27h,1ch,e8h,11h,05h,afh,d4h,46h
+			db	5eh,6bh,48h,6eh,35h,5bh,b0h,fah
+			db	43h,4eh,01h,ech,19h,1eh,85h,19h
+			db	fah,c3h,c9h,70h,97h,e9h,ffh,0dh
+			db	1ch,53h,edh,37h,00h,9fh,43h,c2h
+			db	45h,47h,95h,5fh,50h,65h,99h,bch
+			db	73h,e3h,08h,03h,86h,72h,84h,7eh
+			db	dch,4dh,84h,18h,56h,3fh,ach,92h
+			db	95h,a7h,92h,cch,69h,0ch,16h,f3h
+			db	50h,c3h,15h,37h,31h,2dh,9ah,34h
+			db	fah,fah,1dh,33h,27h,b9h,2bh,8eh
+			db	99h,32h,c6h,99h,86h,6eh,67h,25h
+			db	adh,92h,21h,72h,80h,4fh,77h,8bh
+			db	6ah,66h,95h,73h,6ch,fah,8ch,6fh
+			db	99h,fah,81h,39h,dch,35h,41h,97h
+			db	17h,d3h,67h,eah,a4h,62h,62h,b4h
+			db	52h,fdh,3fh,10h,23h,dch,6fh,c1h
+			db	b2h,f3h,34h,0bh,85h,7fh,eah,76h
+			db	b1h,fah,a2h,c7h,29h,feh,8ch,48h
+			db	7dh,6ah,9ah,7eh,75h,d6h,cah,c8h
+			db	07h,1eh,10h,6fh,3bh,94h,f5h,ddh
+			db	d3h,74h,57h,04h,b7h,77h,7bh,4eh
+			db	e4h,b9h,7ch,19h,c4h,0bh,5fh,96h
+			db	74h,07h,2fh,1bh,cfh,99h,9ah,80h
+			db	20h,f6h,adh,88h,53h,27h,48h,97h
+			db	bfh,c0h,88h,43h,3ah,b0h,d9h,91h
+			db	cdh,9ch,7bh,85h,40h,e3h,56h,b3h
+			db	64h,70h,63h,55h,75h,2dh,49h,57h
+			db	1eh,46h,dah,96h,08h,feh,dfh,c8h
+			db	74h,61h,89h,a5h,91h,cbh,57h,dfh
+			db	67h,00h,7bh,53h,8ch,86h,fbh,b7h
+			db	2fh,afh,3bh,2ah,8fh,b0h,3fh,afh
+			db	01h,7ch,82h,fbh,70h,4eh,f8h,3fh
+			db	71h,33h,afh,00h,5eh,28h,b1h,5dh
+			db	f7h,a1h,4bh,25h,2dh,a3h,02h,e3h
+			db	90h,a2h,89h,5ch,bfh,11h,eeh,c1h
+			db	57h,dch,8fh,23h,9ch,ddh,78h,54h
+			db	bdh,b5h,29h,a6h,b6h,58h,1eh,1ch
+			db	9ah,45h,36h,99h,60h,cch,ebh,a6h
+			db	58h,f6h,d2h,90h,58h,1dh,43h,1dh
+			db	40h,e4h,6dh,88h,44h,5ch,6fh,05h
+			db	5bh,d7h,49h,b2h,3eh,deh,9ah,5bh
+			db	6dh,8ch,47h,beh,23h,61h,04h,b0h
+			db	9bh,3fh,32h,00h,05h,53h,57h,37h
+			db	bfh,7fh,b3h,7fh,3bh,06h,5bh,eah
+			db	04h,f2h,93h,7ch,24h,abh,e3h,dfh
+			db	66h,64h,f0h,0ch,d6h,d3h,49h,5eh
+			db	9fh,f2h,4eh,02h,2ah,f4h,dbh,83h
+			db	8dh,edh,ach,72h,09h,7eh,04h,78h
+			db	76h,a0h,71h,93h,7ch,59h,37h,51h
+			db	cdh,4eh,d1h,41h,34h,4ah,36h,a5h
+			db	68h,14h,0ch,71h,45h,3dh,55h,0dh
+			db	6ah,27h,6ch,e0h,67h,69h,67h,14h
+			db	6ah,d0h,c2h,8dh,39h,d1h,5eh,12h
+			db	57h,e7h,b5h,58h,a4h,0eh,d0h,43h
+			db	05h,4ah,c4h,b3h,c3h,6ch,feh,40h
+			db	63h,e0h,a8h,dch,26h,09h,3bh,73h
+			db	f3h,d3h,62h,0bh,6bh,1eh,22h,38h
+			db	dfh,fah,8eh,bfh,53h,43h,71h,36h
+			db	ebh,9bh,b2h,adh,4bh,52h,13h,8dh
+			db	dch,c2h,55h,41h,aeh,14h,64h,b0h
+			db	ech,38h,afh,59h,79h,eeh,6bh,0ah
+			db	c7h,e0h,27h,f3h,e1h,e0h,2dh,adh
+			db	cfh,44h,b2h,dfh,80h,10h,bbh,c9h
+			db	efh,4bh,81h,a4h,10h,91h,9dh,74h
+			db	18h,61h,26h,0dh,4ch,27h,ddh,61h
+			db	82h,30h,ebh,6dh,1eh,52h,49h,0fh
+			db	a7h,52h,ech,50h,45h,e3h,0bh,fch
+			db	52h,32h,0ch,68h,abh,aeh,45h,7bh
+			db	cfh,a1h,efh,edh,54h,aah,59h,efh
+			db	71h,abh,09h,13h,36h,a4h,62h,35h
+			db	e5h,62h,7ah,58h,d2h,89h,bch,54h
+			db	f6h,2bh,ddh,eah,4ch,edh,3dh,16h
+			db	75h,56h,22h,30h,a0h,3dh,b8h,43h
+			db	95h,24h,96h,85h,4fh,35h,c5h,a8h
+			db	09h,deh,26h,5fh,0ah,b9h,d8h,44h
+			db	d2h,b6h,88h,4ch,9bh,49h,3ah,84h
+			db	8bh,67h,4ah,4eh,8dh,b5h,c0h,8dh
+			db	beh,2ch,1eh,cah,9dh,50h,aeh,e7h
+			db	10h,4ah,0fh,61h,90h,27h,7ah,42h
+			db	54h,d6h,76h,d3h,85h,23h,1bh,d1h
+			db	4dh,d7h,e3h,deh,b0h,cch,66h,81h
+			db	a7h,04h,08h,7dh,7ah,93h,a9h,86h
+			db	20h,dah,98h,f3h,feh,37h,6dh,e0h
+			db	6ah,03h,4eh,81h,03h,6bh,c3h,8ah
+			db	4bh,c6h,b2h,c2h,4ch,d0h,1dh,30h
+			db	49h,8eh,67h,85h,d2h,4fh,72h,aeh
+			db	4dh,d6h,96h,c1h,92h,5bh,a3h,4ch
+			db	7eh,e8h,b1h,1bh,c8h,77h,ebh,a8h
+			db	aeh,0bh,5ch,b2h,feh,9bh,f6h,4fh
+			db	8bh,50h,dch,20h,d7h,a2h,dch,19h
+			db	35h,38h,6ch,fdh,20h,f2h,7dh,35h
+			db	cah,49h,07h,7dh,c6h,28h,71h,a3h
+			db	abh,84h,39h,2eh,8ch,4ch,89h,c2h
+			db	40h,06h,b2h,4dh,a1h,ddh,a0h,70h
+			db	ebh,06h,95h,81h,9ah,26h,f8h,bdh
+			db	65h,a5h,c6h,8ah,37h,7ch,5bh,ffh
+			db	6dh,6dh,02h,3fh,25h,dbh,a7h,84h
+			db	3eh,31h,26h,f1h,adh,31h,5eh,0dh
+			db	bdh,17h,05h,5eh,5eh,23h,21h,a4h
+			db	cah,f7h,35h,f7h,f7h,13h,b5h,98h
+			db	deh,7ch,3fh,c7h,dfh,42h,6eh,4bh
+			db	aah,cch,bfh,d8h,26h,dah,f8h,42h
+			db	a1h,6bh,35h,ddh,04h,dch,0bh,a3h
+			db	fch,6ah,84h,85h,31h,e9h,fdh,16h
+			db	07h,f1h,b5h,deh,bdh,a5h,41h,88h
+			db	16h,b4h,6ah,a0h,53h,c1h,c0h,89h
+			db	f4h,07h,4bh,b4h,82h,f1h,2fh,31h
+			db	cch,6ah,c9h,68h,95h,35h,c9h,e9h
+			db	bdh,fah,edh,abh,d7h,3bh,6ch,41h
+			db	57h,9ch,83h,68h,08h,e7h,3ch,5eh
+			db	e2h,26h,feh,9ch,68h,6eh,bdh,b0h
+			db	8eh,99h,ach,e0h,f2h,99h,ffh,c2h
+			db	fah,69h,0eh,f8h,b3h,60h,81h,e2h
+			db	34h,c3h,8ah,c9h,33h,90h,3eh,e9h
+			db	c7h,0dh,1eh,1ah,80h,f0h,feh,6ch
+			db	60h,28h,3ah,49h,16h,beh,5eh,4ah
+			db	f7h,c0h,cfh,81h,53h,06h,1dh,09h
+			db	60h,bfh,02h,6ah,5ch,4dh,17h,b5h
+			db	3bh,35h,b3h,a7h,56h,68h,fbh,d4h
+			db	dfh,88h,00h,25h,35h,b1h,a5h,53h
+			db	28h,cch,b5h,d0h,73h,33h,7ah,a9h
+			db	21h,4ah,61h,02h,14h,9bh,f1h,a2h
+			db	deh,c5h,a3h,3ah,a0h,20h,72h,a5h
+			db	4fh,2eh,56h,64h,deh,d1h,c2h,8bh
+			db	3ah,cfh,deh,44h,fch,3eh,7ch,c0h
+			db	25h,94h,bdh,fbh,2fh,a3h,45h,b7h
+			db	a7h,cdh,3fh,59h,20h,cbh,b5h,d4h
+			db	6fh,4eh,b1h,feh,67h,efh,6fh,4fh
+			db	45h,b1h,1bh,a2h,44h,23h,4ah,c0h
+			db	03h,49h,5eh,1ch,d5h,03h,9ah,d3h
+			db	19h,79h,34h,7ah,3fh,38h,03h,93h
+			db	15h,bch,31h,33h,28h,35h,c5h,3ah
+			db	c9h,f8h,66h,80h,30h,f6h,a6h,b7h
+			db	71h,d9h,13h,a2h,06h,beh,28h,b6h
+			db	83h,e7h,6bh,c3h,cdh,1bh,9ch,1ch
+			db	8dh,0eh,f6h,a3h,03h,94h,89h,27h
+			db	3dh,7dh,7ch,73h,e7h,d9h,40h,3ah
+			db	f6h,78h,3dh,48h,01h,4dh,97h,88h
+			db	08h,0eh,e0h,d6h,d8h,a4h,2eh,7eh
+			db	3dh,77h,29h,2eh,0ah,f9h,72h,fah
+			db	86h,79h,2dh,dch,2ah,f9h,22h,a9h
+			db	4fh,b5h,76h,f7h,07h,5ah,cdh,59h
+			db	6fh,adh,36h,18h,f0h,e0h,46h,4bh
+			db	56h,61h,56h,53h,b8h,87h,8eh,9bh
+			db	1dh,a6h,96h,ddh,d0h,69h,7bh,ddh
+			db	cfh,f0h,6dh,51h,81h,31h,3ah,b8h
+			db	1bh,d0h,06h,3ah,c9h,e0h,88h,84h
+			db	69h,77h,42h,f3h,f4h,15h,ceh,eeh
+			db	c5h,b8h,9dh,b3h,93h,a5h,b0h,e1h
+			db	68h,cfh,a3h,33h,61h,42h,85h,b9h
+			db	a9h,88h,4dh,93h,14h,c1h,aah,7ah
+			db	19h,f2h,11h,03h,99h,18h,3ah,06h
+			db	8fh,c9h,68h,34h,8fh,9fh,01h,65h
+			db	48h,4bh,21h,9dh,ebh,70h,4ah,fbh
+			db	b1h,b1h,fdh,1bh,7eh,beh,ech,53h
+			db	a3h,fch,0fh,c9h,b1h,24h,77h,2dh
+			db	e8h,cch,09h,d2h,78h,0fh,92h,41h
+			db	a1h,83h,fch,1ch,c7h,08h,55h,59h
+			db	95h,62h,04h,30h,8dh,90h,3eh,e5h
+			db	cfh,38h,1dh,f2h,7ah,42h,b6h,deh
+			db	1ch,95h,a0h,efh,56h,dch,8eh,08h
+			db	9ch,1eh,e1h,a7h,4dh,61h,44h,b6h
+			db	58h,46h,35h,03h,15h,9bh,bbh,e7h
+			db	88h,50h,cdh,0ah,82h,46h,59h,95h
+			db	6bh,bdh,8eh,b9h,d7h,9bh,81h,14h
+			db	23h,14h,f2h,84h,cch,86h,ach,03h
+			db	eeh,6eh,73h,cbh,5ah,24h,eah,34h
+			db	eeh,9bh,53h,11h,11h,47h,d6h,6bh
+			db	31h,8ch,d7h,cfh,e5h,56h,c9h,4ch
+			db	cah,87h,d8h,60h,26h,c1h,e2h,1eh
+			db	16h,7dh,5dh,96h,3eh,b4h,11h,a3h
+			db	a3h,58h,69h,f2h,98h,e8h,5dh,25h
+			db	78h,9ah,23h,c8h,7ah,8ch,26h,56h
+			db	5bh,81h,e6h,cbh,d4h,47h,6ch,85h
+			db	2dh,4ah,91h,27h,d8h,dfh,09h,10h
+			db	3fh,b9h,82h,88h,90h,c4h,70h,f3h
+			db	46h,98h,02h,b1h,ffh,a0h,14h,75h
+			db	9eh,beh,cch,e8h,f0h,f5h,29h,16h
+			db	7ch,40h,33h,f6h,a5h,eah,03h,c1h
+			db	d6h,83h,59h,d9h,b4h,4eh,dah,8eh
+			db	5dh,65h,58h,bfh,53h,7eh,0ch,6ch
+			db	48h,0bh,54h,d3h,bbh,c5h,6ah,37h
+			db	9ah,3ah,37h,97h,35h,dah,79h,10h
+			db	89h,ceh,32h,54h,74h,3ch,fah,7bh
+			db	9bh,13h,23h,53h,beh,51h,8fh,86h
+			db	53h,47h,34h,a8h,20h,b8h,88h,51h
+			db	a4h,ceh,24h,cah,49h,0fh,eeh,46h
+			db	01h,ech,3eh,28h,75h,04h,5bh,bch
+			db	efh,d6h,cbh,d4h,6ah,4fh,6bh,e5h
+			db	4ch,c4h,d8h,74h,f5h,13h,9dh,efh
+			db	b2h,76h,d8h,b0h,86h,bfh,09h,66h
+			db	bch,fah,3fh,bdh,40h,73h,02h,25h
+			db	55h,20h,ceh,50h,4ah,e9h,abh,c8h
+			db	8ch,11h,6fh,beh,35h,b9h,b7h,a1h
+			db	3dh,a9h,01h,5fh,97h,d5h,f6h,d7h
+			db	5eh,11h,e0h,aah,a8h,94h,3ah,02h
+			db	d5h,37h,b0h,78h,ach,01h,c9h,d1h
+			db	f4h,0ah,02h,e5h,8bh,dch,29h,55h
+			db	0ah,55h,88h,4ah,c5h,b9h,a8h,b9h
+			db	48h,20h,4fh,aeh,1eh,f1h,b5h,40h
+			db	45h,4eh,e7h,87h,7bh,0bh,04h,35h
+			db	3dh,6eh,2eh,82h,e4h,e1h,14h,9fh
+			db	d7h,efh,53h,eeh,98h,1eh,19h,57h
+			db	3fh,b7h,f6h,63h,dch,7dh,71h,91h
+			db	0dh,cfh,91h,50h,35h,82h,31h,39h
+			db	0dh,38h,84h,55h,f5h,aeh,b6h,e5h
+			db	b0h,1bh,f9h,d3h,6ah,7dh,34h,edh
+			db	4ch,dbh,cch,89h,e8h,d6h,6ah,62h
+			db	93h,43h,bbh,c9h,b4h,beh,6dh,04h
+			db	2ah,b9h,3eh,0ch,a3h,1eh,12h,87h
+			db	b9h,d6h,44h,a5h,48h,c4h,19h,37h
+			db	97h,c6h,edh,9dh,2ch,90h,67h,82h
+			db	f3h,bbh,35h,63h,a3h,cch,01h,6dh
+			db	16h,4ch,5ah,d6h,50h,19h,d0h,48h
+			db	79h,73h,5ch,00h,25h,7fh,b3h,8ch
+			db	21h,d4h,2dh,42h,c6h,6fh,0ch,57h
+			db	96h,65h,b4h,a4h,3ch,bdh,e4h,9eh
+			db	efh,afh,81h,40h,18h,69h,b7h,1bh
+			db	c3h,01h,beh,e7h,e4h,2dh,c9h,3bh
+			db	c9h,b8h,1eh,aeh,3dh,47h,b1h,d4h
+			db	7eh,fch,28h,3fh,eeh,0ah,7ah,9ah
+			db	c3h,32h,fah,bbh,f9h,79h,d3h,cah
+			db	e2h,7ch,b3h,69h,e2h,b4h,abh,e6h
+			db	92h,f4h,1ah,d6h,67h,54h,3eh,a6h
+			db	f7h,10h,20h,adh,cdh,22h,d3h,d9h
+			db	c4h,cdh,2fh,a7h,78h,9dh,99h,8dh
+			db	7bh,77h,85h,9ah,49h,e9h,cfh,2dh
+			db	42h,5eh,6eh,57h,9dh,c1h,5ch,ffh
+			db	78h,a9h,5fh,88h,e8h,5ah,f8h,afh
+			db	0ch,c4h,49h,c8h,72h,50h,9eh,a3h
+			db	28h,9dh,c0h,d3h,bfh,51h,f8h,68h
+			db	48h,76h,1ah,05h,4bh,0ch,2fh,21h
+			db	d6h,a6h,48h,97h,e2h,08h,5ch,e0h
+			db	12h,01h,cah,98h,38h,40h,17h,a3h
+			db	55h,b0h,b6h,00h,0dh,44h,b5h,77h
+			db	a1h,77h,16h,3ch,beh,b0h,2ah,0bh
+			db	82h,f9h,4dh,61h,0bh,69h,58h,18h
+			db	a7h,6eh,82h,39h,58h,e4h,e5h,2bh
+			db	66h,88h,b3h,feh,f1h,71h,19h,36h
+			db	b4h,0ch,0ch,59h,65h,b4h,dch,a7h
+			db	80h,30h,82h,83h,47h,01h,79h,5bh
+			db	a5h,21h,59h,84h,38h,fch,feh,70h
+			db	59h,a5h,30h,e9h,8dh,ech,5fh,3eh
+			db	aeh,8dh,c6h,d0h,cbh,b9h,2ch,c1h
+			db	a6h,60h,d5h,deh,ddh,eeh,02h,b8h
+			db	c1h,37h,73h,b1h,48h,a8h,57h,58h
+			db	43h,b0h,b8h,52h,d0h,d9h,2eh,6ch
+			db	bdh,83h,24h,d8h,abh,a7h,c4h,98h
+			db	bah,7bh,93h,27h,08h,25h,66h,0fh
+			db	f4h,bch,04h,44h,e6h,a0h,8eh,dfh
+			db	feh,84h,d5h,00h,a8h,9bh,e0h,aah
+			db	89h,74h,9ch,fbh,78h,06h,f0h,93h
+			db	69h,5fh,adh,adh,02h,13h,e0h,75h
+			db	0ah,1ch,deh,5fh,1ch,69h,d2h,e0h
+			db	64h,99h,a5h,f3h,b4h,48h,17h,27h
+			db	78h,25h,29h,80h,f5h,edh,13h,e8h
+			db	9ah,fah,25h,6ch,f8h,dfh,4ch,22h
+			db	3fh,ech,52h,8dh,fbh,a3h,18h,abh
+			db	b7h,0fh,8eh,9ch,eah,8eh,50h,70h
+			db	c0h,f7h,55h,62h,cbh,e4h,bbh,2ah
+			db	5dh,6bh,55h,afh,73h,feh,eah,b8h
+			db	92h,11h,bbh,f4h,17h,8dh,eeh,75h
+			db	39h,09h,12h,44h,21h,e4h,6bh,01h
+			db	81h,28h,70h,4fh,2dh,cfh,0ah,e3h
+			db	bfh,2ah,94h,03h,a1h,c2h,1dh,8ah
+			db	a4h,36h,73h,3bh,1fh,c2h,a1h,1eh
+			db	1dh,4eh,9ch,e4h,94h,02h,95h,c4h
+			db	e2h,73h,59h,a3h,f1h,ddh,15h,71h
+			db	1fh,ddh,3ah,adh,d4h,80h,81h,4fh
+			db	1bh,3bh,85h,58h,81h,2eh,d7h,c0h
+			db	cfh,ffh,e8h,dch,58h,b8h,d5h,e6h
+			db	d9h,5ch,f7h,9eh,a1h,90h,e7h,b4h
+			db	90h,5fh,03h,46h,03h,9bh,7dh,6eh
+			db	3eh,3ch,1eh,d5h,41h,20h,74h,49h
+			db	5bh,87h,2ch,c3h,72h,8ch,aeh,c9h
+			db	01h,d0h,d1h,f6h,d9h,0dh,9ah,3dh
+			db	8eh,5ch,0ah,16h,14h,71h,6ch,1dh
+			db	3ch,52h,1ah,2eh,ddh,0ch,d1h,84h
+			db	69h,9ah,28h,74h,5ch,8dh,1ah,ffh
+			db	36h,b0h,49h,cdh,d6h,aah,9fh,55h
+			db	60h,f4h,dch,e8h,93h,37h,e4h,31h
+			db	1bh,26h,36h,0bh,34h,5ah,b5h,56h
+			db	03h,0bh,7ch,bbh,20h,44h,cah,d8h
+			db	9eh,65h,0bh,1fh,d7h,e5h,b6h,b0h
+			db	03h,6dh,10h,5ch,fbh,8fh,12h,43h
+			db	51h,f5h,37h,12h,63h,22h,d9h,00h
+			db	bdh,19h,29h,44h,34h,b3h,f3h,b1h
+			db	2ah,f6h,4ch,d4h,9ch,b1h,39h,c8h
+			db	b6h,3dh,cch,38h,4eh,73h,8fh,75h
+			db	c8h,0eh,abh,3eh,74h,88h,53h,f9h
+			db	fah,edh,eah,b3h,79h,b9h,ach,b5h
+			db	1eh,f3h,d9h,51h,a2h,06h,a4h,85h
+			db	7ah,3bh,7bh,0dh,14h,3bh,1dh,55h
+			db	5ah,a5h,15h,9fh,bch,2ch,eah,55h
+			db	c9h,41h,eeh,f5h,70h,e4h,f7h,86h
+			db	91h,b4h,c1h,d9h,68h,06h,71h,99h
+			db	65h,08h,e9h,e7h,b2h,7ah,c2h,64h
+			db	19h,d0h,ebh,60h,25h,3eh,a9h,18h
+			db	7bh,f5h,15h,a8h,65h,5ah,1ch,89h
+			db	78h,f8h,bah,12h,61h,c5h,aah,6ch
+			db	24h,08h,feh,c1h,e5h,feh,83h,eah
+			db	07h,a8h,b0h,74h,b1h,edh,20h,bah
+			db	b9h,99h,bah,39h,21h,d5h,24h,8bh
+			db	62h,28h,33h,d5h,beh,e5h,70h,13h
+			db	40h,a2h,c4h,a2h,80h,c7h,c3h,e5h
+			db	bfh,08h,78h,41h,e6h,16h,01h,e6h
+			db	22h,0dh,8bh,0ch,9ah,56h,0bh,26h
+			db	3eh,7bh,66h,fah,0bh,2dh,c6h,a1h
+			db	57h,8eh,f5h,6fh,3ch,30h,3bh,65h
+			db	e0h,61h,c3h,66h,c6h,6fh,87h,4dh
+			db	7eh,cbh,11h,b3h,0fh,97h,a3h,a3h
+			db	6ch,52h,32h,2fh,e9h,3ch,64h,d8h
+			db	75h,96h,9ch,1bh,03h,b8h,9ah,b9h
+			db	d6h,b6h,2dh,deh,2ch,e0h,dbh,c5h
+			db	32h,69h,dbh,1fh,86h,9dh,f2h,a0h
+			db	c2h,e7h,c1h,5ah,cfh,93h,efh,9dh
+			db	57h,f1h,fbh,53h,4dh,ceh,d3h,68h
+			db	d5h,e5h,42h,5ah,0fh,93h,aah,53h
+			db	cah,f6h,72h,83h,ceh,b6h,6dh,a8h
+			db	eeh,06h,b6h,3dh,f5h,e9h,3ch,b5h
+			db	72h,fah,12h,19h,6fh,40h,54h,d8h
+			db	5bh,90h,fch,aah,fah,2fh,bbh,c5h
+			db	d5h,0bh,32h,14h,0ch,0bh,c1h,41h
+			db	7eh,16h,87h,92h,49h,2ch,6ch,14h
+			db	03h,8eh,edh,14h,94h,8ah,d3h,65h
+			db	0ah,50h,89h,12h,b0h,d9h,7dh,11h
+			db	05h,45h,fah,21h,81h,9ah,a2h,1eh
+			db	f4h,56h,80h,b2h,ffh,c4h,c0h,14h
+			db	bdh,9ah,62h,e0h,8ah,5fh,4fh,3dh
+			db	7eh,a0h,8ah,16h,57h,87h,39h,90h
+			db	6eh,8dh,e4h,02h,5eh,7bh,4dh,12h
+			db	13h,89h,8ch,26h,86h,ceh,5ch,ffh
+			db	dch,84h,1fh,8ah,9dh,74h,9eh,20h
+			db	04h,90h,57h,dbh,52h,d8h,84h,19h
+			db	c9h,0ah,c3h,41h,61h,15h,8ah,99h
+			db	b1h,23h,9ch,06h,d6h,6bh,2fh,88h
+			db	a1h,b5h,7dh,57h,f4h,f1h,deh,53h
+			db	e1h,f4h,dfh,a7h,eeh,e4h,e4h,bah
+			db	77h,dah,f6h,c0h,76h,0ah,04h,dbh
+			db	68h,68h,f3h,53h,68h,39h,29h,50h
+			db	d6h,d8h,ceh,ech,6bh,a3h,b3h,75h
+			db	5fh,81h,e4h,0ah,b7h,c1h,a5h,e1h
+			db	c8h,b1h,d3h,b1h,f7h,96h,e9h,abh
+			db	07h,35h,d9h,d9h,23h,43h,bbh,a1h
+			db	5bh,53h,15h,52h,33h,0bh,f0h,a7h
+			db	18h,5bh,c2h,48h,7fh,6ah,95h,b2h
+			db	dah,30h,60h,d5h,cah,44h,f4h,adh
+			db	17h,64h,8bh,20h,d2h,3fh,bdh,70h
+			db	1ch,e1h,37h,c5h,f7h,3fh,19h,10h
+			db	c4h,feh,5fh,0dh,7ah,45h,43h,a2h
+			db	73h,22h,9fh,eah,a5h,11h,b3h,bah
+			db	f0h,abh,8fh,0ah,0ah,00h,64h,84h
+			db	fbh,a2h,b0h,d6h,78h,2fh,0bh,1ch
+			db	3ch,b8h,09h,5eh,2ah,6ch,3eh,d2h
+			db	8ah,70h,78h,73h,d8h,ceh,5ah,b0h
+			db	b7h,ceh,6ah,23h,2bh,94h,b7h,b4h
+			db	99h,afh,deh,2bh,15h,cdh,ddh,8ch
+			db	e7h,61h,4ch,6ch,f9h,e5h,20h,a8h
+			db	38h,59h,99h,c7h,4ch,0bh,07h,0ah
+			db	beh,abh,cch,b2h,84h,4eh,c5h,41h
+			db	14h,90h,5ah,53h,3dh,0dh,f5h,72h
+			db	31h,5dh,66h,a6h,02h,cah,6ah,c7h
+			db	d6h,9fh,a7h,fbh,b9h,08h,7ah,beh
+			db	ach,52h,5ah,0eh,49h,cbh,f7h,0bh
+			db	7bh,f3h,62h,cbh,afh,02h,f1h,d1h
+			db	c0h,4dh,48h,2dh,b2h,0dh,26h,5dh
+			db	bbh,36h,31h,b1h,e1h,cah,c6h,e4h
+			db	ech,04h,8ch,a2h,2bh,66h,2fh,e9h
+			db	46h,91h,5eh,c0h,06h,d5h,65h,f4h
+			db	93h,76h,b3h,3fh,bdh,88h,5ch,cdh
+			db	feh,edh,10h,58h,a3h,deh,35h,51h
+			db	6bh,90h,c8h,c3h,70h,1eh,72h,99h
+			db	2eh,00h,60h,3ah,d1h,dfh,e0h,29h
+			db	12h,57h,84h,29h,81h,22h,83h,dch
+			db	39h,6dh,c8h,7ch,7ch,95h,0dh,d7h
+			db	b7h,dbh,f2h,97h,15h,11h,dbh,adh
+			db	d7h,eeh,37h,38h,5eh,d1h,28h,e2h
+			db	24h,60h,59h,1eh,a9h,cah,1eh,38h
+			db	48h,d9h,61h,d7h,78h,ceh,2eh,8ah
+			db	95h,86h,56h,f1h,3ch,26h,ffh,dfh
+			db	25h,dbh,95h,d7h,f6h,d8h,4ah,f4h
+			db	dch,a4h,1eh,57h,d3h,c7h,fch,03h
+			db	03h,40h,a4h,70h,90h,7eh,e0h,7fh
+			db	70h,e8h,74h,69h,66h,cch,e6h,3eh
+			db	9dh,bch,ech,b3h,f8h,c2h,2bh,48h
+			db	b0h,71h,80h,cdh,93h,76h,5ch,d0h
+			db	4ch,f2h,bbh,6ch,2bh,d7h,23h,d5h
+			db	0eh,aeh,26h,e9h,34h,0eh,bch,68h
+			db	23h,b0h,10h,62h,b1h,9ah,c1h,f4h
+			db	a3h,c8h,6ah,3fh,e5h,2ah,9fh,9eh
+			db	32h,83h,ceh,30h,83h,d2h,e1h,32h
+			db	56h,e9h,31h,deh,35h,2eh,96h,50h
+			db	ffh,dfh,5dh,80h,eeh,8fh,77h,eeh
+			db	bah,e6h,7ch,4ah,99h,2ch,fbh,e0h
+			db	62h,35h,78h,96h,25h,77h,a2h,1ah
+			db	86h,1dh,fdh,9ch,1dh,34h,53h,f1h
+			db	7ah,72h,7dh,31h,99h,25h,28h,36h
+			db	55h,22h,7dh,f0h,5eh,f8h,71h,16h
+			db	8ch,47h,b0h,35h,2dh,61h,28h,deh
+			db	8bh,c8h,f5h,deh,d7h,fch,feh,aah
+			db	ddh,d4h,d2h,10h,e7h,70h,f9h,b4h
+			db	4fh,d2h,11h,b7h,0ah,eah,a9h,2dh
+			db	80h,66h,6bh,23h,a1h,97h,57h,43h
+			db	01h,aeh,42h,b9h,03h,a9h,f0h,e5h
+			db	c1h,a2h,f0h,8ah,6ch,6dh,c2h,88h
+			db	09h,b9h,f7h,93h,b9h,88h,32h,c4h
+			db	5bh,aeh,33h,3bh,72h,1ah,3eh,7fh
+			db	8ah,37h,c8h,0ah,81h,25h,78h,6eh
+			db	2bh,73h,1dh,dch,05h,b1h,81h,8eh
+			db	a5h,d1h,e4h,fah,e9h,36h,40h,8ah
+			db	dbh,e3h,59h,21h,a0h,dfh,85h,91h
+			db	48h,69h,55h,52h,05h,7ch,86h,c0h
+			db	51h,f7h,4fh,36h,f8h,a0h,6bh,1ah
+			db	bbh,7dh,04h,cah,28h,ach,23h,27h
+			db	86h,cch,24h,56h,02h,63h,07h,95h
+			db	6ah,57h,68h,7ah,30h,7bh,41h,b3h
+			db	54h,6fh,d2h,9ch,dch,ffh,aeh,ffh
+			db	5dh,65h,d2h,c5h,b2h,07h,6eh,d3h
+			db	edh,62h,20h,18h,81h,51h,61h,51h
+			db	aeh,92h,a0h,45h,dah,f2h,84h,65h
+			db	01h,f4h,bfh,a1h,6bh,f3h,dbh,0eh
+			db	eah,4bh,5eh,69h,f7h,60h,28h,1bh
+			db	5fh,7bh,64h,f5h,94h,f0h,8dh,0eh
+			db	92h,aah,40h,47h,b9h,f8h,c3h,4ch
+			db	ffh,f3h,40h,a5h,3eh,56h,18h,95h
+			db	6dh,e8h,30h,c6h,c9h,adh,abh,3ch
+			db	36h,84h,0fh,80h,89h,86h,0fh,5fh
+			db	46h,9bh,19h,07h,69h,bah,58h,17h
+			db	00h,96h,8bh,b3h,c6h,20h,8fh,59h
+			db	16h,dah,5ah,c5h,99h,6eh,17h,36h
+			db	c0h,d2h,6ah,b2h,a0h,33h,7bh,b9h
+			db	75h,dbh,dch,2bh,7fh,fbh,5ah,74h
+			db	5fh,43h,2bh,03h,6fh,4ah,0fh,e4h
+			db	94h,84h,16h,14h,a8h,3eh,10h,98h
+			db	17h,62h,25h,05h,17h,f3h,beh,b5h
+			db	b8h,d3h,ceh,feh,76h,40h,24h,05h
+			db	1dh,c1h,a5h,c0h,9ah,54h,16h,feh
+			db	edh,a9h,8eh,b1h,93h,ddh,ech,c4h
+			db	2dh,9eh,25h,adh,ceh,b1h,dch,feh
+			db	1dh,cdh,0ah,ddh,1ch,8dh,00h,9ch
+			db	33h,89h,0bh,d4h,88h,3eh,c2h,d0h
+			db	cfh,08h,2fh,beh,33h,48h,31h,cbh
+			db	06h,ceh,f1h,abh,3eh,2eh,adh,61h
+			db	fch,42h,46h,05h,61h,71h,f6h,87h
+			db	56h,c0h,5eh,6bh,a6h,dch,46h,35h
+			db	efh,a9h,39h,70h,b6h,c9h,06h,9eh
+			db	bah,d4h,3ch,17h,a7h,41h,6ah,c8h
+			db	6ch,ffh,f4h,5bh,4fh,e7h,41h,bdh
+			db	cdh,64h,11h,a3h,beh,2dh,83h,47h
+			db	81h,6bh,fbh,bdh,53h,e4h,14h,7dh
+			db	bfh,d0h,d7h,5bh,1ah,30h,a8h,e0h
+			db	b2h,bfh,b4h,a0h,2eh,e4h,02h,beh
+			db	e0h,00h,16h,45h,62h,0bh,c8h,06h
+			db	4fh,edh,b4h,65h,66h,c9h,89h,b0h
+			db	d3h,4fh,67h,e8h,cch,92h,6fh,aeh
+			db	78h,41h,0bh,edh,28h,1ah,06h,e6h
+			db	05h,30h,96h,6fh,e8h,b3h,38h,54h
+			db	cfh,a5h,fdh,42h,b1h,19h,1ch,84h
+			db	43h,f9h,3bh,abh,34h,a9h,f4h,11h
+			db	5fh,76h,21h,4dh,95h,c4h,50h,88h
+			db	ech,5ah,ddh,83h,4ch,00h,6ah,b5h
+			db	f6h,14h,e4h,5eh,31h,cdh,e1h,d4h
+			db	f0h,27h,dbh,44h,77h,73h,c7h,25h
+			db	5bh,7eh,06h,b3h,e9h,31h,45h,e6h
+			db	b1h,0ah,05h,93h,30h,3bh,e6h,c1h
+			db	deh,a9h,4bh,63h,34h,f4h,a3h,06h
+			db	38h,7bh,f8h,77h,5eh,4ch,d9h,01h
+			db	01h,35h,e0h,59h,85h,8bh,b7h,6ch
+			db	beh,1eh,44h,92h,7fh,06h,cfh,40h
+			db	5ah,e0h,aah,44h,d6h,80h,e9h,3fh
+			db	1ch,8ch,c9h,b5h,45h,deh,8eh,8ch
+			db	ceh,03h,e1h,4ah,46h,67h,6fh,b5h
+			db	a0h,14h,d1h,94h,e7h,bfh,a4h,d5h
+			db	4fh,bfh,97h,86h,b3h,ddh,1ch,f6h
+			db	dah,8fh,cdh,36h,d3h,72h,7bh,01h
+			db	62h,8bh,f0h,ebh,deh,94h,81h,74h
+			db	5fh,8dh,c0h,4eh,18h,57h,52h,ach
+			db	36h,48h,ceh,f9h,49h,e1h,f7h,7eh
+			db	2bh,a3h,f8h,18h,16h,e0h,57h,1fh
+			db	fdh,adh,25h,1ch,edh,b3h,18h,94h
+			db	48h,20h,98h,02h,a4h,f8h,41h,beh
+			db	82h,9dh,84h,82h,57h,29h,35h,05h
+			db	fdh,d1h,b0h,2bh,62h,2fh,f8h,83h
+			db	cdh,1bh,69h,c6h,84h,a2h,1ch,c2h
+			db	f7h,b1h,4fh,c3h,e3h,b7h,a7h,adh
+			db	dch,83h,dbh,3eh,1dh,00h,17h,bdh
+			db	2eh,0fh,b9h,6ah,aah,7fh,c2h,09h
+			db	a9h,06h,09h,b5h,e4h,ceh,93h,a6h
+			db	31h,53h,81h,e1h,80h,c9h,86h,beh
+			db	c9h,87h,3ah,f4h,3eh,72h,27h,c3h
+			db	bbh,08h,2ch,72h,90h,1dh,5ch,bah
+			db	cdh,d3h,a2h,f7h,e4h,80h,fbh,70h
+			db	5eh,84h,1dh,11h,e9h,91h,20h,5ah
+			db	feh,74h,3ah,33h,98h,5eh,38h,7eh
+			db	c0h,2ah,d4h,81h,37h,bdh,1eh,07h
+			db	e5h,b4h,bah,ceh,4ah,bfh,97h,c4h
+			db	98h,beh,16h,37h,8ch,d0h,1bh,35h
+			db	e9h,0ah,3bh,52h,33h,dbh,0bh,a2h
+			db	3ch,0bh,06h,63h,4fh,bch,7ah,a0h
+			db	7dh,47h,a1h,73h,83h,0ah,cdh,61h
+			db	54h,6eh,a2h,abh,9bh,52h,fah,b2h
+			db	2ah,85h,c4h,1dh,7ah,f4h,aah,a1h
+			db	f4h,1ah,d7h,b7h,bch,e8h,3fh,34h
+			db	4ch,d4h,03h,66h,00h,6ch,e6h,e6h
+			db	a0h,28h,bbh,d0h,80h,71h,12h,0eh
+			db	e1h,8bh,50h,e2h,e7h,9ch,f2h,7dh
+			db	c3h,a2h,28h,00h,feh,27h,69h,2fh
+			db	3dh,ffh,05h,cdh,d1h,c4h,33h,a7h
+			db	31h,d7h,17h,c8h,50h,4fh,f3h,afh
+			db	cdh,8fh,9ch,56h,24h,cbh,4eh,36h
+			db	78h,63h,3ah,7dh,5eh,ceh,37h,01h
+			db	22h,e7h,9fh,2ah,cfh,54h,f0h,ddh
+			db	ach,1fh,d6h,61h,2bh,5fh,a1h,47h
+			db	fah,7eh,99h,e5h,afh,13h,65h,0ch
+			db	9ch,a8h,b3h,80h,96h,9fh,30h,7eh
+			db	eeh,55h,7eh,e1h,d7h,cdh,91h,ebh
+			db	53h,d6h,43h,3fh,29h,98h,f5h,49h
+			db	72h,20h,e7h,11h,37h,23h,9dh,a5h
+			db	25h,a2h,4ah,67h,e1h,80h,79h,b0h
+			db	dah,75h,cah,95h,8bh,bfh,e4h,dah
+			db	7fh,5eh,f4h,afh,94h,e1h,08h,ddh
+			db	3ah,3ah,f3h,c0h,48h,7fh,13h,ddh
+			db	5ch,a9h,3ch,16h,f5h,25h,b3h,d1h
+			db	ach,40h,87h,a5h,9dh,14h,cdh,d7h
+			db	92h,74h,ebh,6eh,10h,06h,98h,1fh
+			db	1eh,50h,e3h,69h,ceh,bah,b4h,7eh
+			db	6bh,a6h,adh,18h,86h,c9h,c7h,5ch
+			db	4dh,bah,bah,46h,04h,dch,f7h,d2h
+			db	5dh,24h,41h,b1h,a2h,72h,fbh,c5h
+			db	20h,63h,e6h,c3h,60h,72h,24h,2eh
+			db	79h,a5h,eeh,eeh,60h,c3h,4ch,a9h
+			db	ffh,16h,eeh,f6h,1eh,6ch,5ch,94h
+			db	5ah,d0h,74h,50h,f6h,97h,a5h,7ah
+			db	a4h,8eh,2bh,a9h,8dh,6eh,1dh,dfh
+			db	a2h,c2h,0bh,43h,d2h,30h,16h,d0h
+			db	2bh,6eh,1ch,95h,2ah,25h,c4h,42h
+			db	16h,98h,7bh,5fh,cch,dah,37h,06h
+			db	51h,98h,7fh,70h,a3h,7dh,21h,66h
+			db	cch,b2h,a9h,84h,c6h,81h,c6h,d2h
+			db	c2h,5fh,78h,87h,fah,eeh,11h,88h
+			db	c8h,2ah,23h,adh,7bh,8ch,bah,51h
+			db	b2h,b8h,ech,9fh,beh,48h,64h,0ah
+			db	78h,89h,81h,14h,56h,bah,a4h,c0h
+			db	98h,30h,dbh,32h,a9h,a8h,75h,7bh
+			db	83h,6dh,86h,56h,e4h,f9h,25h,f9h
+			db	25h,1ah,d0h,cbh,c2h,83h,dbh,47h
+			db	8fh,b9h,11h,edh,fbh,0bh,56h,68h
+			db	23h,96h,e6h,05h,5bh,89h,9fh,05h
+			db	10h,e8h,d1h,c7h,ach,02h,8eh,e7h
+			db	eeh,12h,d2h,ach,25h,d0h,45h,59h
+			db	cfh,7ah,83h,47h,e2h,feh,63h,73h
+			db	f8h,3eh,0dh,e2h,68h,82h,8eh,d8h
+			db	76h,8fh,a4h,73h,dfh,d4h,71h,e5h
+			db	ech,f9h,8ah,8ah,19h,e6h,a3h,13h
+			db	20h,d9h,b3h,84h,1bh,61h,00h,00h
+			db	90h,24h,abh,87h,01h,fdh,94h,c9h
+			db	7ah,9fh,f0h,70h,f4h,ddh,a9h,e5h
+			db	69h,5ch,55h,96h,7dh,0bh,65h,eah
+			db	9ch,5dh,01h,62h,59h,59h,4ah,1fh
+			db	f8h,fdh,f8h,61h,09h,fbh,46h,f2h
+			db	61h,a1h,e0h,9dh,6fh,aah,39h,02h
+			db	3eh,b3h,a9h,6dh,d2h,d0h,f3h,d1h
+			db	9ch,fah,d6h,f3h,d0h,a4h,58h,beh
+			db	40h,dfh,dch,9dh,e9h,abh,abh,38h
+			db	e6h,d3h,a1h,02h,c9h,23h,aah,7ah
+			db	51h,60h,7eh,8eh,e7h,1bh,f8h,96h
+			db	00h,96h,33h,bbh,0ch,f6h,5fh,47h
+			db	1ah,71h,c8h,d7h,4ah,d4h,01h,64h
+			db	b4h,9eh,47h,0bh,ddh,4ah,5ch,36h
+			db	4dh,9ch,2eh,63h,2ah,17h,c8h,96h
+			db	e9h,c5h,08h,e7h,aah,b5h,2ch,25h
+			db	41h,4ah,a9h,74h,63h,ech,86h,61h
+			db	d0h,91h,73h,d3h,bch,9dh,f7h,e3h
+			db	1ch,88h,ech,2dh,92h,c4h,3eh,e3h
+			db	4bh,2fh,94h,cdh,10h,63h,d8h,ffh
+			db	96h,90h,06h,17h,3bh,0ch,12h,54h
+			db	53h,a5h,39h,18h,deh,90h,02h,b7h
+			db	0eh,5bh,e2h,bch,85h,46h,dbh,f0h
+			db	26h,e3h,d1h,c1h,63h,c4h,49h,48h
+			db	5dh,b0h,94h,d7h,eah,62h,1ch,18h
+			db	e7h,c4h,11h,3ah,d9h,f7h,14h,b2h
+			db	00h,0ch,4eh,63h,56h,e3h,7eh,06h
+			db	2bh,6ah,4dh,a9h,b7h,98h,e1h,cdh
+			db	39h,bfh,3dh,45h,e3h,cdh,fah,20h
+			db	f0h,e5h,3ah,78h,bdh,89h,d0h,f3h
+			db	b3h,e2h,c8h,95h,9bh,c4h,e8h,51h
+			db	9eh,bfh,e0h,fbh,edh,69h,8ah,9eh
+			db	e0h,7eh,69h,a5h,83h,5fh,49h,88h
+			db	cdh,64h,6eh,c8h,12h,b2h,49h,bah
+			db	8ah,68h,22h,78h,beh,5eh,87h,5bh
+			db	36h,89h,a3h,0fh,70h,71h,bch,22h
+			db	c0h,39h,22h,b4h,60h,feh,d9h,d7h
+			db	5eh,e0h,cbh,5dh,6eh,20h,12h,8fh
+			db	1bh,6fh,78h,dbh,77h,f4h,a2h,44h
+			db	adh,7fh,bfh,64h,54h,1ah,b3h,5ch
+			db	29h,e1h,63h,cah,a8h,86h,08h,85h
+			db	d5h,89h,8bh,6eh,70h,fdh,c7h,01h
+			db	4eh,0bh,09h,8ch,13h,adh,bch,abh
+			db	1bh,eeh,e9h,54h,05h,edh,beh,deh
+			db	6ch,f4h,08h,dbh,aah,6eh,79h,68h
+			db	f8h,05h,dah,5bh,0fh,1bh,a5h,67h
+			db	e7h,d1h,94h,35h,4fh,75h,7fh,3eh
+			db	d0h,04h,dfh,11h,89h,84h,b2h,fbh
+			db	7dh,b7h,e8h,aah,17h,ceh,9ch,f1h
+			db	f4h,4ah,9fh,e2h,24h,10h,91h,afh
+			db	37h,efh,f9h,20h,b0h,ddh,12h,07h
+			db	7dh,ach,73h,34h,f8h,2ch,00h,c6h
+			db	e7h,6eh,87h,32h,02h,d8h,efh,57h
+			db	22h,b5h,bfh,1bh,b2h,96h,d4h,5dh
+			db	fch,7ah,5fh,53h,46h,03h,21h,44h
+			db	e5h,fch,40h,1ah,70h,66h,d8h,98h
+			db	58h,6eh,f0h,46h,a0h,98h,15h,e3h
+			db	e6h,4eh,4fh,b4h,69h,a4h,b7h,c9h
+			db	7eh,64h,7eh,f5h,aeh,adh,57h,88h
+			db	47h,fch,6eh,6eh,1fh,d5h,8ah,b4h
+			db	22h,cbh,feh,fch,1ah,62h,86h,3bh
+			db	79h,4bh,97h,aah,56h,33h,f2h,83h
+			db	dfh,33h,00h,a7h,e1h,07h,b2h,44h
+			db	ceh,03h,83h,e7h,bfh,bdh,88h,8dh
+			db	27h,beh,78h,93h,99h,3dh,0ah,23h
+			db	94h,53h,92h,69h,d9h,d3h,22h,54h
+			db	a8h,cch,0fh,9ch,afh,34h,63h,4dh
+			db	c4h,61h,13h,afh,cch,bch,f6h,e5h
+			db	d9h,bah,5ch,f2h,8dh,c1h,1eh,54h
+			db	beh,8dh,b9h,78h,92h,ceh,b4h,69h
+			db	9dh,14h,95h,8eh,eeh,c0h,a4h,48h
+			db	d3h,34h,cbh,beh,b7h,15h,88h,73h
+			db	27h,ffh,41h,cah,7bh,e8h,31h,bch
+			db	5eh,8dh,84h,c6h,bah,aeh,f6h,75h
+			db	91h,c0h,06h,ach,8eh,13h,e3h,80h
+			db	15h,82h,dah,1fh,54h,0bh,ddh,35h
+			db	3bh,28h,d9h,b6h,19h,1ch,9bh,b6h
+			db	5bh,7ch,18h,5dh,adh,ddh,dch,b7h
+			db	dfh,82h,c7h,39h,58h,55h,8dh,d9h
+			db	19h,25h,71h,b6h,43h,51h,76h,52h
+			db	50h,8dh,58h,a7h,45h,a2h,fdh,a4h
+			db	1eh,4fh,22h,4eh,60h,64h,4dh,3ah
+			db	2eh,b9h,77h,92h,3fh,c8h,dch,e6h
+			db	9ah,f0h,9ch,ddh,63h,4dh,09h,4dh
+			db	57h,31h,c7h,6eh,34h,27h,60h,2dh
+			db	e0h,3dh,31h,10h,0bh,f4h,81h,94h
+			db	76h,f8h,8fh,13h,7ch,b2h,07h,b1h
+			db	21h,28h,a8h,85h,05h,06h,72h,03h
+			db	9bh,53h,0fh,a5h,07h,8dh,1dh,a0h
+			db	79h,76h,42h,4fh,1bh,73h,8dh,25h
+			db	bfh,65h,91h,d4h,ceh,1fh,1bh,f9h
+			db	9bh,6fh,12h,18h,64h,fbh,3bh,74h
+			db	a5h,8eh,abh,5bh,e2h,45h,c3h,04h
+			db	d2h,d4h,f0h,17h,6dh,43h,c2h,e6h
+			db	feh,81h,7eh,85h,2ah,c8h,38h,ach
+			db	f0h,35h,b1h,1ch,22h,c6h,65h,06h
+			db	17h,30h,35h,9fh,74h,c7h,32h,72h
+			db	a9h,5bh,3bh,8bh,abh,f8h,f4h,56h
+			db	19h,71h,3fh,a5h,8eh,1bh,30h,85h
+			db	4eh,9ch,0dh,97h,efh,56h,d2h,c5h
+			db	60h,16h,f1h,44h,12h,6ah,c9h,29h
+			db	afh,52h,6ch,e6h,b3h,71h,d1h,c6h
+			db	17h,64h,3ch,4bh,cah,cdh,78h,29h
+			db	6fh,c4h,2ah,88h,f1h,19h,f6h,4dh
+			db	6fh,07h,6fh,e7h,4fh,00h,41h,1fh
+			db	d3h,a7h,deh,8ah,5eh,d7h,d5h,19h
+			db	2fh,86h,09h,78h,08h,d2h,28h,8eh
+			db	27h,d3h,02h,7bh,39h,8dh,01h,12h
+			db	6eh,6bh,cah,5ch,fdh,4fh,69h,0ch
+			db	2ch,56h,b6h,50h,e9h,cdh,71h,3dh
+			db	c6h,16h,24h,5ah,a7h,88h,3fh,77h
+			db	9dh,3fh,aeh,1eh,32h,78h,5ah,bbh
+			db	69h,cbh,a7h,93h,6ch,72h,b9h,fch
+			db	c0h,dfh,3ch,06h,60h,ach,6dh,bbh
+			db	e9h,33h,fbh,c1h,20h,0dh,64h,2fh
+			db	73h,32h,52h,b1h,a0h,34h,4ch,a4h
+			db	85h,0ch,2ch,ffh,afh,6eh,16h,f0h
+			db	30h,5bh,2bh,1fh,82h,1ah,9ah,8dh
+			db	fah,a8h,9dh,8fh,a6h,98h,62h,38h
+			db	a9h,67h,1dh,61h,08h,dch,6eh,3fh
+			db	d8h,3ah,f1h,b4h,80h,75h,00h,9bh
+			db	ach,efh,26h,49h,2dh,43h,8eh,25h
+			db	22h,1fh,7eh,c8h,36h,68h,64h,34h
+			db	1fh,4ah,c1h,3fh,66h,dch,84h,70h
+			db	18h,e8h,f4h,0ch,9fh,e8h,24h,fbh
+			db	e3h,49h,f6h,55h,eeh,12h,1fh,10h
+			db	a9h,deh,6ch,34h,23h,72h,0ah,61h
+			db	84h,87h,21h,f8h,07h,f9h,d6h,61h
+			db	5ah,a0h,e9h,8dh,3bh,03h,24h,c7h
+			db	0ah,f5h,79h,50h,a2h,b0h,5fh,01h
+			db	27h,75h,4bh,25h,7eh,30h,79h,dbh
+			db	b7h,ach,92h,9ch,e5h,29h,a1h,e0h
+			db	ffh,96h,3fh,6ah,7ch,e7h,09h,88h
+			db	efh,2fh,01h,2bh,06h,59h,8fh,a1h
+			db	dbh,88h,98h,2bh,cdh,1ah,deh,34h
+			db	22h,5ah,d5h,26h,50h,68h,56h,d9h
+			db	80h,9bh,37h,e6h,e7h,1ch,6dh,dch
+			db	21h,7ah,1bh,8eh,55h,19h,46h,07h
+			db	afh,19h,97h,f3h,6ah,e6h,ebh,ffh
+			db	feh,bdh,25h,18h,6bh,dch,36h,94h
+			db	06h,0fh,a3h,b4h,96h,d8h,5bh,b5h
+			db	58h,38h,c6h,afh,0fh,3dh,0fh,adh
+			db	a5h,45h,b2h,79h,12h,00h,92h,d0h
+			db	d0h,76h,e1h,59h,b1h,2bh,0ch,33h
+			db	e3h,a4h,a4h,75h,82h,f2h,71h,d6h
+			db	4eh,1bh,2eh,f9h,5ch,8eh,f0h,2ch
+			db	20h,9ch,07h,17h,fah,2ch,38h,4fh
+			db	38h,5bh,3ah,21h,05h,17h,7ah,50h
+			db	65h,c8h,60h,76h,12h,29h,a7h,7ah
+			db	ceh,07h,aah,b6h,43h,99h,81h,30h
+			db	94h,3ah,74h,2fh,0bh,bah,ceh,2ch
+			db	06h,e2h,aah,eah,44h,c5h,21h,a0h
+			db	c8h,0bh,74h,4ch,cbh,0ah,e7h,b0h
+			db	b3h,b3h,abh,dbh,8ah,ech,65h,18h
+			db	d1h,6fh,04h,10h,99h,74h,afh,3fh
+			db	90h,61h,95h,15h,75h,b4h,85h,c2h
+			db	36h,b1h,2fh,ech,0eh,d6h,2bh,9bh
+			db	85h,0bh,18h,2fh,cfh,dfh,e7h,fch
+			db	20h,92h,25h,2fh,d0h,6ah,6ch,52h
+			db	4bh,b7h,50h,81h,58h,6fh,5bh,31h
+			db	e5h,92h,74h,e3h,5bh,cbh,3bh,24h
+			db	c3h,23h,74h,45h,82h,d0h,0ah,41h
+			db	b2h,b9h,4ah,11h,1eh,3eh,d9h,28h
+			db	a5h,66h,cbh,ech,63h,37h,71h,2bh
+			db	57h,b7h,39h,78h,73h,5ch,1eh,c3h
+			db	5ch,91h,80h,52h,7fh,f0h,12h,61h
+			db	76h,76h,1ah,69h,abh,9eh,31h,49h
+			db	28h,a7h,77h,95h,fch,65h,20h,5bh
+			db	f5h,7eh,d1h,9bh,15h,ebh,d1h,44h
+			db	deh,e5h,13h,a9h,f3h,7bh,0bh,39h
+			db	4dh,fdh,e7h,3dh,48h,78h,e2h,fdh
+			db	6dh,8eh,b2h,bdh,03h,41h,66h,5dh
+			db	01h,74h,2dh,35h,20h,9fh,a4h,c9h
+			db	67h,66h,1ch,03h,71h,b6h,b3h,6dh
+			db	03h,67h,16h,0dh,62h,85h,e1h,0fh
+			db	eah,4dh,77h,feh,7ah,82h,17h,f6h
+			db	d7h,aeh,cbh,4fh,0fh,13h,dfh,26h
+			db	2ch,43h,67h,e5h,79h,58h,91h,07h
+			db	03h,2dh,58h,b1h,bah,5ah,41h,79h
+			db	c6h,05h,6eh,94h,f5h,b7h,06h,f5h
+			db	13h,ddh,3ch,c6h,90h,5ch,deh,33h
+			db	3ah,c2h,c9h,cfh,06h,28h,d2h,a0h
+			db	d6h,c5h,9ah,27h,eeh,4bh,89h,9ah
+			db	9ah,efh,02h,b6h,43h,deh,89h,12h
+			db	87h,21h,cch,bfh,e8h,5bh,2ah,cch
+			db	7ch,1ch,a3h,21h,4ch,73h,dbh,e3h
+			db	84h,29h,9eh,32h,1bh,9ah,11h,e1h
+			db	e5h,71h,2fh,dah,60h,5ah,24h,c1h
+			db	beh,72h,a8h,7ah,39h,9eh,3eh,13h
+			db	b5h,67h,79h,3bh,0dh,a0h,16h,d0h
+			db	a8h,12h,2eh,81h,5ah,34h,5eh,c0h
+			db	e4h,46h,27h,dfh,eeh,3fh,bah,74h
+			db	04h,2ah,a0h,4eh,89h,0eh,62h,8dh
+			db	7fh,0ch,abh,28h,16h,50h,77h,abh
+			db	84h,1fh,7ah,ech,f7h,b5h,39h,40h
+			db	feh,3ah,9dh,d8h,a2h,72h,67h,76h
+			db	20h,0bh,78h,56h,45h,05h,3eh,45h
+			db	e5h,74h,cdh,b1h,60h,bbh,79h,9ah
+			db	ebh,ceh,8ch,02h,bch,c5h,4fh,36h
+			db	a6h,32h,6eh,fbh,f6h,84h,9bh,0dh
+			db	18h,69h,2fh,28h,16h,b4h,77h,46h
+			db	3fh,95h,c2h,e1h,50h,2bh,3eh,ech
+			db	80h,bdh,dfh,23h,4ch,8dh,f3h,59h
+			db	ebh,f0h,f3h,7ah,83h,70h,0fh,d2h
+			db	e4h,42h,2eh,7ch,82h,6fh,19h,bdh
+			db	cah,7dh,9dh,f3h,c4h,dah,aeh,d2h
+			db	61h,57h,5ch,6dh,c2h,ech,7ch,38h
+			db	a8h,d7h,3eh,dbh,b4h,d3h,b0h,f9h
+			db	f3h,63h,62h,d9h,a7h,94h,9bh,1dh
+			db	55h,a5h,49h,06h,24h,8ch,27h,cch
+			db	10h,36h,69h,3fh,00h,61h,dbh,6ah
+			db	f8h,98h,feh,bbh,86h,e3h,d9h,fah
+			db	46h,55h,10h,93h,83h,70h,4eh,12h
+			db	4ch,5ah,0dh,fdh,42h,0ah,86h,feh
+			db	aeh,cdh,ffh,a6h,3ah,d7h,fah,77h
+			db	8fh,b3h,fch,a0h,54h,26h,60h,9dh
+			db	a5h,29h,aah,5eh,49h,b7h,50h,0bh
+			db	81h,ceh,c9h,a8h,cfh,c8h,d2h,aah
+			db	b5h,57h,95h,75h,f0h,50h,43h,9dh
+			db	66h,94h,1dh,3fh,adh,57h,59h,26h
+			db	61h,e0h,1dh,71h,12h,96h,feh,4dh
+			db	5dh,0dh,3ch,e0h,edh,b6h,7ch,09h
+			db	1ch,20h,47h,1ch,77h,d3h,b6h,79h
+			db	3fh,04h,1eh,b1h,26h,0fh,9fh,d0h
+			db	fdh,fah,f9h,56h,01h,5fh,44h,4dh
+			db	18h,5eh,bfh,71h,7fh,8fh,9fh,c4h
+			db	54h,38h,75h,e8h,16h,d1h,c5h,6ch
+			db	43h,c5h,63h,d8h,3ch,2eh,22h,aeh
+			db	84h,c9h,59h,f9h,82h,ddh,4bh,99h
+			db	feh,aeh,59h,40h,e3h,6ch,2eh,65h
+			db	39h,7bh,5eh,4bh,c6h,2eh,6dh,15h
+			db	d7h,14h,a7h,30h,43h,3eh,39h,b8h
+			db	1dh,f2h,6ah,01h,9dh,d5h,79h,0dh
+			db	6bh,8ah,68h,d1h,22h,17h,d0h,e9h
+			db	70h,d5h,f0h,ceh,7ah,b3h,dah,b8h
+			db	04h,e4h,3eh,8dh,46h,94h,0bh,dah
+			db	e3h,5fh,1bh,f1h,13h,43h,8dh,7ah
+			db	d8h,a9h,25h,7dh,0fh,5ch,6ch,a3h
+			db	bah,a4h,16h,b0h,b2h,55h,58h,d1h
+			db	7eh,fbh,65h,8ch,7ch,dah,70h,beh
+			db	4ch,3ah,24h,80h,63h,d8h,afh,d4h
+			db	5ah,d2h,31h,05h,23h,31h,8ah,0dh
+			db	2ah,01h,e0h,3ah,dch,09h,b9h,b9h
+			db	86h,c9h,6dh,f8h,06h,b7h,7ch,86h
+			db	73h,e4h,28h,d2h,71h,3dh,dah,adh
+			db	e5h,fbh,63h,02h,08h,82h,2bh,cch
+			db	81h,27h,60h,4dh,46h,43h,39h,f4h
+			db	b4h,18h,f4h,88h,68h,c7h,aeh,e4h
+			db	98h,96h,0eh,b8h,99h,fbh,98h,f4h
+			db	75h,15h,45h,68h,f0h,0ah,0fh,ffh
+			db	5ch,6dh,72h,2bh,d9h,53h,03h,6fh
+			db	b0h,76h,4fh,1eh,67h,75h,46h,90h
+			db	7bh,31h,f5h,fdh,cfh,b5h,65h,6bh
+			db	f8h,81h,2eh,d0h,cdh,b8h,46h,3ch
+			db	d7h,f4h,bah,39h,97h,d5h,1fh,97h
+			db	10h,d1h,5bh,99h,cbh,4bh,33h,b5h
+			db	17h,0bh,6ah,adh,9ch,40h,3fh,c6h
+			db	3ah,fbh,8dh,b0h,efh,fbh,1ah,d6h
+			db	dfh,dbh,5eh,88h,91h,c7h,89h,2bh
+			db	54h,8bh,76h,ebh,48h,22h,13h,4bh
+			db	04h,72h,29h,41h,f3h,76h,83h,48h
+			db	8eh,70h,01h,15h,27h,6fh,11h,99h
+			db	cdh,68h,b1h,fbh,abh,bfh,48h,82h
+			db	02h,55h,d9h,35h,51h,e0h,a1h,f0h
+			db	89h,f5h,fch,cfh,35h,58h,44h,1dh
+			db	80h,f5h,37h,4ah,fah,55h,a6h,bfh
+			db	feh,deh,7bh,2bh,27h,8ch,43h,26h
+			db	ach,bbh,c4h,feh,7fh,0bh,d0h,6dh
+			db	68h,1fh,44h,0ah,05h,97h,6eh,80h
+			db	e5h,78h,5ah,3eh,08h,24h,64h,0dh
+			db	40h,d6h,d4h,8ah,25h,cch,b8h,cdh
+			db	17h,d2h,b7h,15h,b5h,c2h,62h,6ah
+			db	3ch,00h,76h,49h,98h,27h,2eh,c3h
+			db	00h,dbh,b4h,c4h,7ah,9ch,34h,92h
+			db	95h,79h,3dh,3eh,7ah,23h,11h,f1h
+			db	1ch,e1h,42h,19h,94h,74h,0ch,2bh
+			db	3bh,b4h,b8h,9eh,9ah,9dh,88h,4fh
+			db	49h,4fh,65h,47h,7ah,ceh,b1h,1ch
+			db	f7h,b7h,44h,cbh,72h,b9h,8bh,04h
+			db	aah,bdh,59h,b1h,92h,84h,25h,a7h
+			db	15h,19h,21h,12h,b8h,51h,3fh,11h
+			db	a7h,c1h,09h,7eh,bah,f2h,10h,00h
+			db	a1h,79h,21h,eah,32h,9ch,d8h,9bh
+			db	cch,a0h,27h,efh,34h,3fh,06h,d7h
+			db	c7h,09h,06h,2eh,67h,80h,01h,05h
+			db	3bh,0fh,4ch,1dh,b1h,00h,f5h,8dh
+			db	c6h,9bh,aah,f8h,d1h,30h,a8h,88h
+			db	09h,6dh,8bh,5eh,9bh,2dh,cfh,a5h
+			db	03h,71h,9dh,21h,23h,d1h,d7h,1eh
+			db	cch,4fh,e3h,05h,8ch,c9h,aeh,6bh
+			db	f0h,19h,11h,82h,48h,afh,60h,34h
+			db	49h,afh,04h,73h,0ch,8ah,28h,aeh
+			db	2eh,3ah,b3h,ach,edh,2ah,5ch,c3h
+			db	16h,c5h,32h,3eh,8eh,f2h,c2h,0eh
+			db	00h,89h,48h,19h,09h,dah,42h,51h
+			db	15h,54h,e4h,e5h,0bh,87h,47h,00h
+			db	f1h,03h,5bh,a0h,feh,59h,48h,aah
+			db	21h,c3h,71h,26h,e0h,77h,feh,b4h
+			db	62h,3ah,bfh,afh,1eh,ech,fdh,06h
+			db	2ah,20h,3fh,e8h,70h,c3h,88h,f9h
+			db	39h,98h,37h,9bh,04h,feh,19h,dah
+			db	9dh,d0h,d2h,66h,78h,bfh,ech,50h
+			db	d7h,cbh,8fh,ffh,c0h,46h,80h,efh
+			db	d7h,43h,16h,90h,2eh,c0h,aeh,41h
+			db	01h,96h,65h,45h,00h,9dh,24h,86h
+			db	9fh,f9h,4ah,cch,d6h,84h,78h,65h
+			db	44h,3ch,c7h,13h,04h,36h,04h,60h
+			db	a4h,96h,92h,4ah,0fh,b9h,2ch,b8h
+			db	53h,9dh,e8h,86h,12h,d1h,4bh,f8h
+			db	c6h,4ch,eeh,3eh,8fh,d7h,63h,5ch
+			db	f1h,27h,a8h,81h,46h,85h,04h,93h
+			db	44h,3fh,ceh,d3h,0ah,d2h,01h,c1h
+			db	4dh,5dh,b2h,ebh,c3h,f5h,70h,27h
+			db	27h,87h,70h,bah,44h,dch,a2h,e9h
+			db	95h,68h,feh,e0h,5eh,2dh,b6h,61h
+			db	d5h,f2h,c2h,57h,fdh,e8h,c9h,9bh
+			db	88h,dah,cfh,98h,1dh,5ah,e6h,20h
+			db	fah,23h,72h,18h,abh,33h,4ah,05h
+			db	9eh,60h,b3h,93h,fdh,e3h,63h,0eh
+			db	31h,2bh,b2h,b3h,ddh,d8h,f6h,4fh
+			db	f2h,d7h,b5h,08h,58h,87h,03h,f2h
+			db	cfh,14h,44h,35h,35h,c6h,87h,7fh
+			db	b1h,0ch,bbh,2ah,77h,7ah,f0h,bbh
+			db	69h,f1h,e3h,deh,a4h,b5h,bdh,25h
+			db	02h,88h,21h,f3h,bfh,60h,adh,98h
+			db	d3h,92h,8eh,8bh,6bh,4bh,4dh,deh
+			db	c7h,19h,cch,a8h,92h,05h,7ah,13h
+			db	dfh,b0h,02h,02h,d5h,fdh,9eh,aeh
+			db	c2h,94h,74h,6fh,dch,02h,f0h,b9h
+			db	e4h,aeh,bbh,40h,f2h,28h,61h,9bh
+			db	aeh,efh,cfh,14h,e7h,4dh,c7h,7ah
+			db	ceh,27h,bch,73h,62h,e1h,d1h,6fh
+			db	c1h,4dh,48h,8ch,d0h,88h,f0h,b9h
+			db	77h,bfh,6ah,d5h,d5h,0fh,42h,3fh
+			db	67h,31h,5ch,d0h,8bh,65h,e8h,97h
+			db	41h,abh,a6h,8dh,b2h,94h,42h,0fh
+			db	45h,74h,e4h,73h,99h,feh,07h,c8h
+			db	5fh,4dh,aah,59h,80h,b0h,e5h,21h
+			db	e7h,05h,53h,adh,1fh,02h,beh,7bh
+			db	1ch,6ah,d1h,72h,a9h,76h,89h,52h
+			db	2fh,23h,e9h,b8h,72h,75h,ech,e9h
+			db	c8h,21h,8ah,1dh,0fh,b4h,17h,e3h
+			db	d7h,a2h,6ah,e5h,1eh,21h,adh,f3h
+			db	3ah,79h,95h,6fh,ebh,cah,d1h,f3h
+			db	7ah,94h,7bh,71h,7fh,89h,bah,76h
+			db	d1h,7fh,b7h,99h,eah,bfh,79h,8bh
+			db	4ch,17h,15h,32h,94h,3ah,bah,f0h
+			db	1ch,e6h,44h,d7h,20h,7ch,f1h,5fh
+			db	94h,3dh,9dh,fdh,6fh,12h,b4h,b2h
+			db	cch,efh,ech,5ah,7dh,a3h,d3h,05h
+			db	23h,a1h,8fh,b0h,c2h,b6h,e7h,5bh
+			db	3ch,36h,feh,b4h,e2h,3bh,7ah,a2h
+			db	14h,feh,26h,90h,96h,8bh,85h,d4h
+			db	67h,1dh,5ch,feh,9ch,66h,a4h,9fh
+			db	a2h,8fh,f8h,4dh,bfh,fbh,1dh,dfh
+			db	1eh,6ch,d6h,0dh,aeh,7ch,4dh,edh
+			db	a8h,7ah,3fh,a1h,1fh,79h,8dh,c3h
+			db	f4h,a0h,24h,cch,a5h,3fh,d3h,b9h
+			db	8ah,21h,9dh,c8h,5ah,cch,a8h,b2h
+			db	83h,46h,a2h,1eh,66h,49h,51h,1fh
+			db	61h,5fh,58h,4ah,a8h,29h,14h,0dh
+			db	b6h,2ah,c8h,81h,49h,56h,5ah,0dh
+			db	f5h,6fh,bah,fah,3eh,1dh,17h,64h
+			db	07h,4fh,50h,76h,d1h,c6h,d5h,c9h
+			db	b0h,18h,3ah,43h,cdh,f6h,e4h,4bh
+			db	78h,76h,d5h,1ch,4ch,1ch,29h,04h
+			db	41h,45h,c7h,c0h,27h,fah,d7h,30h
+			db	38h,43h,f3h,74h,c7h,a7h,68h,a0h
+			db	66h,a3h,31h,7dh,e7h,c4h,1dh,72h
+			db	c7h,23h,1bh,c0h,95h,e7h,37h,d6h
+			db	20h,89h,97h,e0h,05h,17h,d7h,69h
+			db	46h,7ch,8fh,18h,2ah,5eh,f1h,e5h
+			db	1fh,80h,f9h,6fh,55h,58h,cch,85h
+			db	5ch,b4h,1dh,cfh,40h,23h,93h,15h
+			db	4bh,d9h,eah,cfh,bfh,9ah,fbh,31h
+			db	7ah,42h,50h,36h,1dh,aah,a9h,6bh
+			db	b2h,b4h,8bh,3fh,75h,d0h,08h,51h
+			db	91h,24h,e1h,78h,25h,2fh,bah,d4h
+			db	9fh,6bh,5ch,21h,07h,f3h,45h,0ah
+			db	39h,51h,bah,12h,c1h,80h,79h,94h
+			db	09h,cbh,72h,bdh,21h,22h,19h,ddh
+			db	84h,6ah,8eh,94h,5eh,f1h,ech,cbh
+			db	ech,b0h,06h,55h,c4h,aah,d9h,05h
+			db	aeh,c2h,c7h,2dh,ech,71h,18h,b5h
+			db	e3h,e9h,6ch,fch,1ch,45h,7ah,0ah
+			db	00h,1bh,59h,53h,e5h,1ch,07h,34h
+			db	7eh,78h,d4h,69h,aah,e0h,36h,42h
+			db	d5h,01h,eah,d1h,54h,5dh,78h,f9h
+			db	07h,1eh,a0h,91h,77h,1eh,7dh,49h
+			db	d2h,a9h,f4h,c8h,e2h,c8h,b9h,5ch
+			db	e6h,a7h,43h,63h,6dh,deh,8bh,74h
+			db	2bh,56h,b6h,7dh,3dh,7ah,8fh,f0h
+			db	56h,58h,1dh,13h,afh,f7h,a9h,55h
+			db	adh,55h,03h,97h,cch,a3h,39h,97h
+			db	ach,11h,76h,f8h,1ah,5dh,87h,2dh
+			db	26h,5ah,38h,56h,00h,ech,bch,a6h
+			db	e5h,9bh,33h,9bh,9dh,39h,87h,f0h
+			db	37h,0bh,cfh,ech,ebh,0bh,33h,07h
+			db	b4h,4ah,45h,bdh,b1h,f1h,73h,b3h
+			db	d7h,bfh,90h,f2h,aeh,cbh,0bh,b1h
+			db	84h,12h,5dh,26h,ach,6ch,4eh,dah
+			db	45h,4eh,bah,85h,94h,a2h,d6h,2eh
+			db	58h,1dh,97h,09h,72h,2fh,55h,fdh
+			db	b1h,8bh,72h,cdh,bah,34h,13h,99h
+			db	55h,7bh,d2h,76h,bah,5ah,68h,71h
+			db	edh,fch,5eh,07h,04h,e4h,d0h,54h
+			db	00h,56h,72h,19h,48h,90h,06h,2fh
+			db	f5h,6fh,5dh,5eh,32h,05h,7ch,e7h
+			db	36h,88h,ach,ffh,6fh,1eh,56h,dbh
+			db	43h,2fh,07h,ebh,67h,18h,4fh,edh
+			db	42h,e5h,c7h,2ah,26h,b7h,e7h,46h
+			db	4eh,adh,c7h,cdh,e2h,25h,b7h,14h
+			db	eah,7fh,4ah,e2h,64h,50h,36h,42h
+			db	6eh,b1h,e2h,6ch,62h,0ch,3ah,4eh
+			db	f5h,7dh,c7h,bbh,30h,3fh,95h,6ch
+			db	dfh,05h,74h,edh,1dh,d9h,26h,7ch
+			db	e7h,c1h,54h,49h,e2h,b5h,57h,1dh
+			db	b4h,77h,5bh,c8h,f3h,ebh,d2h,e5h
+			db	18h,38h,24h,14h,2bh,80h,97h,c8h
+			db	c8h,0ch,3ah,5bh,81h,93h,41h,c3h
+			db	79h,63h,99h,4eh,feh,e9h,8fh,46h
+			db	8fh,07h,a8h,75h,15h,b9h,7eh,fch
+			db	4ch,81h,e1h,32h,d5h,6fh,5eh,65h
+			db	d1h,1ah,0dh,79h,3dh,25h,b7h,66h
+			db	25h,edh,f1h,1bh,eeh,a3h,b3h,59h
+			db	3ch,bah,15h,deh,c6h,73h,b7h,ach
+			db	19h,9fh,19h,76h,d8h,5ah,86h,cch
+			db	bfh,72h,47h,23h,01h,e7h,02h,e5h
+			db	5dh,d6h,9fh,30h,5ch,75h,67h,9dh
+			db	f6h,bbh,f5h,29h,23h,08h,a1h,b5h
+			db	3ah,2ch,dbh,ceh,cah,f3h,6dh,53h
+			db	59h,dch,55h,1ch,d1h,97h,11h,f9h
+			db	fch,fch,93h,7ch,deh,cbh,81h,71h
+			db	40h,a4h,d8h,01h,adh,80h,c4h,3bh
+			db	02h,16h,04h,1bh,bch,7fh,5ah,5fh
+			db	0dh,e5h,1ch,7ch,0bh,5fh,2fh,66h
+			db	a3h,cbh,a9h,0ch,fah,63h,3ch,c8h
+			db	e3h,49h,9dh,10h,16h,3dh,eeh,63h
+			db	3dh,a5h,d6h,5eh,70h,cch,4eh,d0h
+			db	bfh,53h,70h,22h,11h,83h,6bh,58h
+			db	34h,3ah,b2h,6bh,d1h,4dh,c5h,61h
+			db	01h,d0h,49h,84h,20h,e9h,e3h,18h
+			db	2bh,f6h,20h,0ah,ceh,6eh,f7h,29h
+			db	ech,d6h,79h,58h,eah,c6h,15h,0bh
+			db	62h,3ch,f9h,f6h,aah,81h,93h,abh
+			db	06h,2eh,66h,98h,13h,0dh,90h,a0h
+			db	6ah,46h,52h,f4h,e9h,a8h,78h,1ch
+			db	42h,e4h,09h,48h,60h,60h,29h,95h
+			db	27h,98h,abh,69h,dah,1ch,49h,0ch
+			db	b8h,80h,f3h,b0h,46h,32h,2eh,9fh
+			db	66h,3eh,bbh,0eh,c1h,3fh,0dh,ebh
+			db	27h,0ah,c9h,57h,f3h,dfh,f6h,25h
+			db	9ah,69h,a0h,48h,3ch,79h,79h,60h
+			db	67h,0bh,35h,8ah,99h,a1h,bdh,76h
+			db	24h,4ah,6ch,b4h,09h,9bh,8eh,e6h
+			db	a6h,c9h,55h,71h,9dh,2bh,b9h,fah
+			db	0dh,aeh,1eh,28h,15h,28h,0ch,e2h
+			db	b4h,fah,01h,27h,49h,4eh,f8h,14h
+			db	d9h,5eh,7eh,55h,b5h,a1h,37h,3fh
+			db	88h,04h,36h,a1h,8eh,aah,d7h,a2h
+			db	3bh,90h,dbh,57h,78h,f2h,6bh,80h
+			db	a8h,98h,d5h,a9h,60h,c1h,efh,e3h
+			db	97h,aeh,1eh,d1h,aeh,81h,95h,b8h
+			db	82h,d9h,a4h,87h,20h,bch,cch,aah
+			db	b9h,afh,61h,6ch,09h,f7h,28h,70h
+			db	11h,d4h,5dh,19h,f3h,03h,4fh,3fh
+			db	6fh,92h,f9h,10h,9ah,4ah,c1h,d5h
+			db	7ch,6eh,d2h,81h,cah,eah,23h,f5h
+			db	03h,36h,15h,9ch,70h,c2h,c3h,9fh
+			db	1eh,5bh,0fh,b1h,e2h,35h,54h,1ah
+			db	e6h,d6h,4ah,7dh,1fh,e7h,d3h,4bh
+			db	3ah,63h,b7h,cdh,1ah,c1h,3bh,9bh
+			db	99h,d5h,c9h,1eh,16h,49h,32h,84h
+			db	4dh,60h,a3h,62h,b2h,16h,e5h,4bh
+			db	36h,cdh,b0h,d5h,b3h,2dh,4fh,f7h
+			db	25h,e8h,49h,19h,fbh,91h,57h,c4h
+			db	fch,2eh,e8h,adh,50h,4fh,11h,71h
+			db	23h,5dh,2eh,45h,4fh,6ah,81h,75h
+			db	ddh,d3h,18h,e7h,f2h,eeh,24h,71h
+			db	51h,cch,5bh,80h,c6h,9ch,19h,a7h
+			db	3eh,1eh,abh,f3h,e7h,11h,7eh,e6h
+			db	d3h,26h,c6h,c0h,b8h,72h,f1h,76h
+			db	adh,89h,0fh,d6h,eah,81h,4eh,99h
+			db	20h,9ah,bdh,bbh,0ch,3dh,aeh,5fh
+			db	60h,3bh,81h,d3h,98h,8bh,f4h,9fh
+			db	5dh,5fh,e5h,25h,1bh,41h,8eh,ceh
+			db	2eh,f2h,06h,92h,5ch,3ah,39h,edh
+			db	7ch,a4h,81h,41h,3eh,feh,f3h,3fh
+			db	b8h,91h,21h,d5h,feh,b0h,79h,2eh
+			db	39h,21h,4fh,62h,01h,31h,24h,2bh
+			db	3eh,9bh,64h,88h,8ah,39h,3eh,10h
+			db	77h,26h,e9h,60h,14h,62h,c7h,5fh
+			db	54h,57h,e9h,4bh,79h,f6h,aeh,d9h
+			db	c6h,56h,00h,e7h,61h,ebh,f0h,08h
+			db	ach,e3h,b3h,4ch,adh,53h,02h,a8h
+			db	00h,fah,5bh,feh,85h,e3h,23h,feh
+			db	52h,afh,05h,c0h,60h,40h,fdh,71h
+			db	e7h,d4h,deh,47h,d5h,a3h,aah,f2h
+			db	6fh,50h,7eh,f1h,5fh,52h,74h,4ch
+			db	79h,01h,c6h,15h,2ah,4ah,bdh,edh
+			db	69h,01h,60h,50h,deh,42h,b7h,90h
+			db	36h,cfh,b0h,4ch,91h,19h,bah,08h
+			db	56h,dbh,39h,22h,bch,54h,a5h,e2h
+			db	a9h,22h,f4h,04h,2eh,eah,b8h,6eh
+			db	09h,cah,b9h,d6h,16h,dfh,2ah,c3h
+			db	fbh,e8h,31h,72h,6dh,20h,34h,75h
+			db	0bh,12h,ceh,47h,07h,beh,4ch,e9h
+			db	ddh,b3h,d7h,80h,9ah,d3h,a4h,5fh
+			db	29h,89h,e0h,90h,e2h,89h,69h,2eh
+			db	87h,07h,d7h,e1h,dbh,8ch,72h,33h
+			db	54h,a4h,efh,20h,b6h,31h,28h,42h
+			db	31h,6ah,23h,b4h,e2h,cdh,6bh,1eh
+			db	bbh,48h,4ah,07h,2ah,e5h,62h,fbh
+			db	11h,32h,5ah,9ah,56h,d3h,0bh,36h
+			db	3eh,77h,28h,13h,30h,51h,5fh,f6h
+			db	1ah,01h,b2h,5fh,ffh,71h,94h,8fh
+			db	a6h,0bh,6fh,f8h,b7h,8dh,fdh,63h
+			db	17h,65h,8ch,42h,7bh,f5h,cbh,cah
+			db	60h,16h,d5h,9ch,5ch,7fh,87h,73h
+			db	f0h,1ch,8ah,11h,9ch,73h,2fh,9fh
+			db	4bh,5dh,22h,d9h,50h,12h,d5h,5ch
+			db	30h,1eh,87h,3ah,4eh,86h,4fh,6fh
+			db	b1h,16h,c2h,b1h,45h,abh,80h,e7h
+			db	85h,71h,4ah,e3h,6dh,04h,a4h,94h
+			db	44h,4bh,9eh,fah,b4h,5fh,32h,5ah
+			db	a4h,b9h,cbh,8fh,d3h,fah,e8h,bdh
+			db	89h,f8h,e1h,69h,f7h,00h,34h,3ah
+			db	66h,99h,ach,a3h,36h,59h,11h,21h
+			db	65h,7eh,2ch,cch,1ah,cfh,3ch,d5h
+			db	cah,fch,fdh,49h,edh,abh,efh,24h
+			db	e1h,36h,56h,4eh,10h,b6h,30h,2eh
+			db	05h,36h,55h,e1h,01h,23h,3bh,29h
+			db	e4h,55h,d0h,0eh,4eh,7eh,11h,3dh
+			db	dfh,3ch,3bh,f9h,37h,aah,0ah,7ch
+			db	41h,31h,e3h,53h,eah,97h,3fh,64h
+			db	f5h,a1h,2bh,dbh,1eh,92h,01h,fbh
+			db	30h,2eh,0ch,f6h,03h,ach,09h,02h
+			db	0bh,87h,fdh,53h,4fh,91h,63h,5ch
+			db	d8h,e9h,4dh,4eh,22h,c3h,c6h,5eh
+			db	f5h,09h,8fh,d2h,bdh,4eh,43h,6eh
+			db	6eh,2eh,aah,eeh,96h,62h,5eh,2eh
+			db	b6h,a4h,02h,bah,54h,b2h,69h,31h
+			db	99h,f6h,07h,34h,57h,a2h,8ch,38h
+			db	f9h,1dh,30h,09h,b9h,54h,feh,d8h
+			db	ceh,ceh,f9h,18h,fch,0ch,feh,22h
+			db	65h,97h,14h,a1h,49h,d7h,81h,f6h
+			db	16h,fbh,dah,0eh,38h,1dh,81h,5eh
+			db	7fh,e0h,a1h,c9h,bch,7fh,26h,02h
+			db	25h,cah,bdh,8ah,b9h,01h,c6h,8bh
+			db	e3h,0ah,c6h,56h,ebh,35h,55h,9bh
+			db	b6h,92h,3ch,ech,83h,35h,19h,b1h
+			db	edh,27h,cbh,7dh,c2h,77h,f8h,90h
+			db	eeh,4eh,92h,f9h,57h,e2h,0dh,6eh
+			db	0fh,22h,d8h,23h,66h,5dh,6bh,34h
+			db	3ah,a1h,8bh,04h,f6h,9ch,8eh,62h
+			db	26h,41h,d2h,0fh,7bh,71h,f0h,c1h
+			db	9ch,efh,e9h,74h,72h,25h,e2h,8dh
+			db	67h,96h,1bh,57h,51h,a3h,7bh,b0h
+			db	a6h,ebh,f2h,57h,89h,f2h,beh,f2h
+			db	6bh,b2h,c4h,4eh,4ch,69h,e6h,46h
+			db	c8h,4eh,cbh,e6h,72h,9fh,0ah,3ch
+			db	e6h,c5h,43h,85h,1dh,6ch,62h,54h
+			db	b0h,33h,ceh,b5h,e9h,24h,57h,17h
+			db	deh,e6h,47h,deh,68h,f5h,22h,ceh
+			db	16h,8fh,2dh,f1h,d6h,40h,33h,b1h
+			db	02h,a9h,c6h,f4h,30h,ffh,78h,43h
+			db	bch,74h,adh,9ah,42h,4dh,11h,b5h
+			db	18h,41h,aah,20h,b2h,c1h,1ch,91h
+			db	c1h,79h,7eh,99h,adh,b6h,e5h,46h
+			db	9ch,7eh,95h,83h,d5h,d7h,c5h,13h
+			db	b9h,0ch,a5h,fbh,55h,9ch,98h,68h
+			db	ebh,0ch,01h,6fh,5eh,31h,cbh,ddh
+			db	63h,f4h,69h,c2h,b2h,44h,e7h,dch
+			db	08h,b0h,25h,03h,40h,81h,9fh,33h
+			db	a4h,20h,90h,03h,d8h,25h,91h,3eh
+			db	66h,a6h,c8h,a4h,82h,64h,49h,4dh
+			db	c9h,bdh,e8h,74h,89h,0ah,cfh,60h
+			db	c3h,2ah,dah,bfh,46h,15h,07h,b7h
+			db	36h,e8h,ebh,28h,00h,a5h,deh,b6h
+			db	d8h,03h,61h,b7h,7bh,20h,dch,f6h
+			db	16h,12h,5fh,d3h,4dh,14h,78h,edh
+			db	50h,39h,4fh,beh,2ah,3dh,87h,03h
+			db	ach,83h,6eh,aah,58h,fch,1eh,4ch
+			db	dfh,9bh,8eh,62h,64h,5ch,6fh,2ah
+			db	aeh,abh,cfh,a6h,18h,11h,32h,d1h
+			db	6ah,d8h,88h,58h,57h,6fh,23h,e4h
+			db	fdh,80h,e4h,f7h,f3h,5bh,f1h,3ah
+			db	4ah,84h,b3h,f7h,68h,01h,16h,a6h
+			db	bdh,5fh,dch,d3h,cch,5bh,67h,fdh
+			db	43h,00h,0eh,12h,e4h,ebh,e8h,afh
+			db	b3h,5eh,f3h,f8h,8dh,87h,31h,9bh
+			db	92h,61h,0bh,4dh,5dh,04h,c9h,f5h
+			db	11h,a0h,beh,17h,7fh,77h,d6h,a2h
+			db	92h,ech,b5h,bch,ddh,75h,8ch,10h
+			db	bch,3ah,61h,6dh,48h,f8h,86h,78h
+			db	fch,ebh,a4h,ach,b7h,afh,69h,95h
+			db	d1h,9ah,33h,feh,a9h,49h,42h,57h
+			db	b1h,efh,d8h,bch,89h,83h,64h,57h
+			db	8fh,00h,7bh,99h,1fh,eeh,dbh,25h
+			db	f0h,e4h,02h,56h,b9h,e6h,4eh,d4h
+			db	12h,4fh,0bh,eah,96h,77h,b8h,aeh
+			db	e4h,6bh,11h,02h,64h,77h,31h,a0h
+			db	b8h,1fh,c0h,86h,92h,16h,8ah,22h
+			db	37h,0eh,6fh,f0h,99h,2ah,8bh,18h
+			db	3fh,e9h,96h,35h,c9h,dah,a0h,07h
+			db	efh,85h,4fh,70h,f0h,4dh,b8h,aeh
+			db	75h,79h,16h,90h,5fh,6bh,e7h,e7h
+			db	f3h,3ch,52h,f1h,6eh,d5h,f5h,6ch
+			db	5fh,79h,71h,c0h,53h,cfh,4dh,cbh
+			db	b5h,7bh,a4h,7eh,56h,f2h,b1h,0bh
+			db	92h,a6h,77h,61h,90h,45h,98h,e9h
+			db	c0h,7fh,86h,34h,52h,2ch,80h,e1h
+			db	66h,33h,1dh,45h,76h,75h,cah,dch
+			db	25h,36h,afh,d8h,cbh,c4h,c9h,d8h
+			db	95h,9ch,fbh,6dh,cah,afh,83h,aeh
+			db	aah,aeh,bah,a2h,f7h,e6h,f0h,7fh
+			db	c0h,48h,ceh,51h,28h,adh,e1h,b4h
+			db	a5h,e3h,d7h,1ah,ach,e7h,4eh,b1h
+			db	efh,f0h,a7h,4eh,a6h,6fh,8eh,44h
+			db	1dh,a9h,2ch,e9h,e5h,53h,87h,b4h
+			db	73h,d6h,b2h,73h,ffh,edh,d1h,09h
+			db	feh,31h,bdh,c3h,41h,3ah,d5h,e1h
+			db	bch,20h,a4h,d7h,08h,70h,dbh,90h
+			db	c8h,7bh,04h,88h,3fh,28h,8dh,dch
+			db	d3h,ddh,cfh,57h,08h,fah,87h,1fh
+			db	93h,c4h,44h,2ch,b2h,43h,0eh,b1h
+			db	f2h,29h,a2h,68h,edh,4eh,0bh,f1h
+			db	dah,6bh,56h,9fh,47h,beh,57h,a3h
+			db	93h,44h,c8h,c0h,6dh,afh,42h,74h
+			db	60h,e1h,77h,76h,a8h,4eh,3dh,0ch
+			db	04h,53h,16h,f4h,93h,00h,8fh,55h
+			db	55h,5fh,c5h,f5h,e5h,5bh,4bh,2dh
+			db	11h,99h,cdh,9eh,78h,2ah,80h,d5h
+			db	cfh,9eh,68h,e6h,1dh,0bh,fah,2ch
+			db	a3h,7dh,02h,3bh,4bh,99h,bbh,bfh
+			db	44h,d2h,e4h,52h,afh,0eh,72h,3bh
+			db	beh,94h,50h,2bh,70h,4eh,96h,92h
+			db	b6h,50h,79h,b7h,53h,6bh,ech,b0h
+			db	feh,31h,cfh,d0h,21h,7eh,21h,a3h
+			db	dbh,0bh,30h,dah,3eh,bch,60h,3dh
+			db	17h,13h,a4h,f0h,21h,13h,18h,dah
+			db	43h,5bh,02h,f5h,9bh,e8h,a0h,c5h
+			db	05h,23h,aeh,1eh,f0h,92h,c0h,12h
+			db	d9h,6eh,fdh,e1h,05h,02h,d4h,a3h
+			db	7ch,d8h,2ah,41h,cah,4bh,2bh,c5h
+			db	fah,a5h,cch,9fh,deh,bdh,f9h,a1h
+			db	5ch,56h,b0h,a8h,3ch,00h,e4h,d6h
+			db	70h,d3h,9ch,81h,12h,0ah,a8h,23h
+			db	72h,48h,16h,b7h,a5h,ach,0ch,dah
+			db	a6h,e8h,82h,53h,dch,fdh,a6h,adh
+			db	3ch,3bh,2ah,68h,dfh,86h,51h,94h
+			db	16h,09h,00h,1bh,9fh,f8h,16h,98h
+			db	bbh,8bh,9ah,3fh,f0h,f8h,0ch,48h
+			db	f0h,2eh,44h,f0h,68h,05h,e5h,49h
+			db	aah,79h,65h,1eh,45h,b9h,f0h,33h
+			db	2fh,4ch,49h,b5h,1ch,06h,08h,c4h
+			db	f7h,c9h,73h,2fh,c0h,1eh,35h,88h
+			db	82h,62h,8dh,a3h,63h,e4h,d3h,91h
+			db	a5h,b9h,fch,adh,48h,bbh,a8h,ceh
+			db	44h,7dh,b4h,14h,62h,66h,5fh,c5h
+			db	85h,95h,a0h,efh,a2h,4dh,a3h,4ch
+			db	7dh,2dh,85h,6ah,8eh,c9h,c6h,41h
+			db	00h,61h,ach,32h,4eh,34h,0ah,c5h
+			db	ech,0ah,33h,83h,eeh,9ch,c5h,27h
+			db	7dh,59h,02h,dbh,4eh,41h,2bh,4bh
+			db	41h,a6h,23h,f9h,7fh,36h,59h,f1h
+			db	61h,ach,d1h,c3h,66h,b4h,a6h,1ch
+			db	56h,75h,61h,e5h,1fh,0fh,bch,a9h
+			db	40h,b7h,54h,0bh,96h,f5h,f6h,54h
+			db	ach,12h,7ch,d0h,19h,06h,80h,e6h
+			db	9dh,c4h,7ch,35h,25h,36h,6ch,42h
+			db	6dh,73h,efh,49h,33h,5ah,53h,e1h
+			db	aeh,81h,d7h,7dh,f0h,32h,54h,2ch
+			db	0bh,cbh,03h,9ch,bah,ffh,21h,b7h
+			db	deh,1bh,93h,ech,3ch,3eh,06h,00h
+			db	3dh,2ch,95h,56h,36h,98h,cbh,74h
+			db	9fh,13h,6bh,cfh,91h,eeh,33h,bch
+			db	b6h,19h,5eh,23h,93h,7eh,76h,72h
+			db	bch,84h,77h,34h,6ch,b3h,54h,2bh
+			db	4ch,aeh,45h,09h,40h,ach,13h,bah
+			db	69h,55h,65h,68h,b6h,68h,8ah,f5h
+			db	8dh,d9h,48h,56h,7ah,9dh,3eh,cfh
+			db	6bh,97h,c3h,02h,14h,dbh,afh,95h
+			db	18h,f5h,50h,0ah,2ch,a9h,6dh,1eh
+			db	a6h,bfh,eah,d4h,c9h,2bh,b1h,feh
+			db	01h,2fh,4fh,02h,57h,27h,c9h,c3h
+			db	deh,12h,ach,cfh,85h,92h,aeh,77h
+			db	57h,7eh,22h,21h,b2h,f2h,b1h,15h
+			db	ffh,d2h,5bh,70h,80h,40h,aeh,fch
+			db	c1h,46h,c4h,01h,f4h,94h,f6h,a1h
+			db	d3h,87h,08h,8dh,a8h,e3h,40h,33h
+			db	4dh,a1h,95h,8ch,46h,6eh,4ah,25h
+			db	20h,3eh,41h,c9h,ach,4dh,cbh,c5h
+			db	2bh,9ch,bch,8fh,8ah,c6h,03h,7fh
+			db	7dh,eah,deh,03h,61h,79h,a3h,b3h
+			db	a7h,9ah,93h,22h,71h,32h,4eh,32h
+			db	5eh,efh,58h,90h,52h,25h,75h,a2h
+			db	f0h,3bh,02h,fdh,0eh,95h,f8h,8ah
+			db	dbh,18h,ebh,61h,f3h,7bh,75h,eeh
+			db	e3h,c6h,17h,00h,bbh,e3h,0dh,60h
+			db	92h,0ch,08h,55h,44h,fdh,afh,cfh
+			db	d0h,2bh,bah,cdh,deh,38h,e2h,21h
+			db	a5h,33h,ddh,85h,d9h,68h,b1h,98h
+			db	80h,6ch,65h,96h,f2h,a4h,72h,ebh
+			db	55h,d0h,7bh,8fh,0bh,96h,ebh,18h
+			db	f2h,24h,ebh,69h,74h,e8h,dah,bch
+			db	d1h,97h,12h,8dh,f2h,31h,7ch,1fh
+			db	8ch,fah,7bh,3fh,b5h,9fh,55h,a1h
+			db	02h,90h,10h,19h,96h,d2h,67h,8bh
+			db	0ch,c2h,f8h,f6h,30h,95h,f5h,2ah
+			db	7ch,beh,3eh,61h,9fh,19h,b7h,8ch
+			db	73h,cch,4eh,afh,c0h,b7h,3dh,a8h
+			db	a6h,42h,93h,83h,4dh,4ch,89h,00h
+			db	54h,bch,b0h,b9h,d8h,bfh,65h,09h
+			db	87h,35h,81h,f8h,d7h,5ch,d3h,41h
+			db	10h,02h,cch,b8h,12h,18h,73h,2bh
+			db	43h,9ah,47h,92h,b0h,9bh,e1h,3eh
+			db	9eh,85h,21h,6eh,f0h,06h,c1h,92h
+			db	f5h,b9h,7fh,a2h,36h,a1h,08h,a5h
+			db	3bh,ech,2ah,93h,67h,78h,4ah,fbh
+			db	07h,80h,08h,6fh,50h,dbh,55h,dah
+			db	32h,80h,3ah,e7h,10h,b3h,48h,b3h
+			db	59h,cbh,2ch,f1h,52h,5dh,22h,13h
+			db	adh,43h,5fh,82h,1fh,feh,6ch,c2h
+			db	3fh,b1h,49h,e5h,4fh,b0h,04h,edh
+			db	14h,bch,b1h,07h,9eh,68h,65h,eeh
+			db	65h,6fh,efh,7fh,55h,8bh,cbh,7ah
+			db	63h,95h,f7h,15h,4bh,8bh,10h,6fh
+			db	83h,a6h,3fh,34h,95h,f5h,96h,3bh
+			db	c5h,a1h,3bh,77h,02h,78h,6ah,77h
+			db	2bh,4dh,ebh,09h,c8h,68h,11h,12h
+			db	62h,ach,1dh,6ah,97h,8fh,f4h,03h
+			db	fbh,f6h,cch,b4h,8ch,f7h,77h,28h
+			db	8bh,dah,b3h,a0h,b7h,3fh,fbh,85h
+			db	ceh,03h,dbh,20h,c6h,7eh,93h,90h
+			db	0bh,4dh
+			sbc	a,d
+			ld	l,h
+			ld	a,d
+			call	z,Lfa56
+			ld	(0159h),a
+			sbc	a,l
+			cp	94h
+			inc	(hl)
+			add	a,h
+			add	a,e
+			and	(hl)
+			ld	b,d
+			call	nc,L04a4
+			adc	a,c
+			ld	l,c
+			ld	e,c
+			ld	sp,hl
+			xor	e
+			ld	(bc),a
+			ld	(hl),b
+			ld	c,l
+			add	hl,bc
+			xor	0fh
+			or	h
+			and	d
+			ld	(de),a
+			xor	a5h
+			ld	e,d
+			sbc	a,h
+			ld	h,a
+			ret	p
+			add	a,c
+			ret	nc
+			ret
+			db	46h,a3h,16h,99h,80h,41h,7bh,ech
+			db	0dh,26h,2ah,dfh,9dh,dch,3bh,77h
+			db	5dh,d3h,a1h,08h,12h,96h,9eh,8dh
+			db	2eh,42h,63h,1fh,6dh,efh,4ch,cdh
+			db	46h,0ah,8ch,8dh,90h,11h,8fh,aeh
+			db	d3h,9ah,0bh,64h,25h,54h,1fh,10h
+			db	c4h,8ah,b0h,c8h,ceh,4eh,2fh,b6h
+			db	2dh,2bh,01h,07h,4fh,81h,b9h,6ah
+			db	aah,1ah,39h,fah,01h,28h,24h,a3h
+			db	29h,70h,d2h,fah,8ch,f7h,58h,deh
+			db	3eh,32h,d0h,10h,04h,98h,28h,3ah
+			db	aah,b6h,f2h,efh,d3h,3fh,50h,7bh
+			db	3ch,0ah,c3h,96h,fbh,a6h,97h,62h
+			db	9dh,11h,30h,4dh,1bh,adh,d9h,2ch
+			db	1ah,5ah,2dh,24h,aeh,2bh,19h,cah
+			db	d2h,cah,f7h,d3h,e5h,85h,b1h,18h
+			db	37h,cah,41h,0bh,97h,98h,41h,06h
+			db	64h,a5h,dfh,20h,44h,a8h,15h,8fh
+			db	7bh,bfh,53h,3fh,c4h,87h,beh,f7h
+			db	b8h,61h,6ah,30h,d6h,0bh,cah,3eh
+			db	c2h,abh,31h,30h,75h,ebh,08h,d9h
+			db	a9h,63h,f5h,9dh,0ah,8ah,3eh,9ch
+			db	8fh,1dh,c1h,9fh,94h,aah,32h,c0h
+			db	edh,9fh,1fh,c3h,c9h,80h,5fh,bah
+			db	9eh,34h,95h,d2h,8fh,3eh,c9h,16h
+			db	87h,b2h,42h,3bh,43h,aeh,51h,fah
+			db	61h,65h,71h,ech,37h,b6h,6dh,49h
+			db	58h,64h,91h,bch,79h,55h,e4h,d3h
+			db	aah,adh,29h,a9h,32h,51h,24h,72h
+			db	d6h,a2h,73h,87h,1bh,c1h,fah,42h
+			db	46h,cch,a2h,aah,beh,45h,98h,b7h
+			db	a7h,cah,17h,bdh,9ah,a4h,91h,d0h
+			db	2dh,fbh,29h,33h,80h,f1h,dch,36h
+			db	26h,53h,b9h,73h,86h,b1h,8dh,71h
+			db	ddh,37h,e7h,1ch,89h,78h,35h,94h
+			db	78h,8fh,f6h,67h,c0h,bdh,13h,1bh
+			db	5eh,afh,4bh,24h,45h,beh,e0h,b3h
+			db	b5h,97h,cch,6fh,f5h,37h,b9h,93h
+			db	38h,32h,80h,77h,d4h,7eh,f9h,ffh
+			db	49h,20h,11h,d2h,d4h,44h,5dh,79h
+			db	85h,dbh,4ah,fah,6bh,53h,afh,a6h
+			db	b7h,3fh,2eh,7dh,bdh,48h,10h,62h
+			db	f9h,1ah,7fh,fbh,44h,4ah,cfh,61h
+			db	60h,c8h,3dh,a9h,abh,44h,57h,80h
+			db	fdh,8bh,ech,a5h,4fh,32h,eeh,dbh
+			db	89h,5bh,79h,4fh,83h,37h,feh,74h
+			db	c5h,9ch,a1h,71h,dah,0fh,ech,85h
+			db	8ah,95h,e5h,a4h,deh,02h,b2h,00h
+			db	63h,b8h,a5h,fbh,50h,44h,74h,bah
+			db	59h,67h,e9h,9ch,c7h,21h,44h,cfh
+			db	1ch,b3h,3bh,ebh,bch,15h,8dh,24h
+			db	92h,01h,b6h,9eh,4ah,99h,19h,ceh
+			db	96h,40h,a9h,5dh,d8h,e3h,5eh,80h
+			db	48h,14h,35h,c2h,afh,d8h,5ch,ffh
+			db	e5h,c7h,eah,fch,edh,e2h,cah,3dh
+			db	aah,dch,13h,aeh,c6h,d1h,47h,93h
+			db	24h,2ah,6ch,64h,f5h,c1h,4dh,69h
+			db	40h,02h,39h,66h,2ah,43h,f4h,6fh
+			db	c6h,a6h,28h,24h,c5h,ceh,f5h,7ch
+			db	a7h,38h,57h,d2h,17h,aah,a3h,2fh
+			db	75h,13h,cch,a5h,99h,15h,31h,d3h
+			db	6bh,ffh,dfh,b3h,dch,1eh,98h,4dh
+			db	a4h,80h,c1h,1ah,f3h,deh,b1h,4dh
+			db	6ah,ffh,8fh,eeh,16h,7ch,32h,34h
+			db	7ch,54h,a0h,f3h,04h,26h,2bh,f7h
+			db	8ah,1fh,85h,48h,6bh,7bh,58h,a6h
+			db	61h,16h,64h,71h,f6h,cfh,75h,8dh
+			db	f7h,05h,c5h,bah,98h,c9h,ebh,b5h
+			db	07h,e1h,0eh,6bh,5ch,fdh,1eh,e4h
+			db	83h,32h,41h,98h,8ah,7eh,34h,20h
+			db	9ch,58h,85h,74h,1ch,e4h,7dh,d8h
+			db	6ch,11h,4eh,d5h,37h,ach,bah,50h
+			db	c7h,2dh,fah,51h,7ah,e9h,6ah,f3h
+			db	3ch,99h,c0h,8dh,96h,a5h,02h,dbh
+			db	4dh,5fh,15h,e8h,c1h,9dh,80h,b6h
+			db	02h,1bh,4ah,f0h,77h,a7h,51h,9eh
+			db	0dh,adh,80h,0eh,b3h,e1h,f1h,abh
+			db	80h,58h,1bh,afh,78h,d8h,83h,b7h
+			db	67h,36h,a1h,1fh,b1h,42h,50h,5fh
+			db	61h,ebh,a6h,e0h,ffh,49h,f3h,3bh
+			db	d4h,ddh,cah,2eh,79h,e8h,aah,d7h
+			db	f7h,b6h,c5h,30h,f6h,aah,cfh,20h
+			db	eeh,a6h,15h,53h,38h,72h,33h,c3h
+			db	b2h,08h,8fh,2bh,06h,f9h,11h,9eh
+			db	0fh,deh,66h,b0h,2eh,a8h,5ch,97h
+			db	d3h,3ah,88h,2ch,2dh,b8h,d0h,41h
+			db	a5h,d2h,7ah,dah,f8h,34h,bdh,2ah
+			db	20h,c5h,77h,e9h,d2h,30h,74h,1bh
+			db	24h,17h,2fh,beh,3bh,88h,0dh,d6h
+			db	e5h,e9h,eeh,87h,49h,abh,eeh,6fh
+			db	b4h,28h,78h,22h,82h,1bh,b1h,87h
+			db	66h,6bh,b1h,4fh,dfh,7dh,1bh,dbh
+			db	bbh,d2h,dch,b9h,44h,f8h,9fh,d1h
+			db	f6h,2ah,adh,50h,9dh,eah,afh,87h
+			db	a4h,5ch,bbh,90h,8ch,12h,7dh,2bh
+			db	46h,82h,01h,55h,deh,b8h,a8h,53h
+			db	f9h,1dh,25h,5fh,7ah,7fh,85h,16h
+			db	86h,eeh,d5h,98h,eeh,8dh,48h,aah
+			db	7fh,d0h,d8h,23h,7dh,94h,f1h,4ah
+			db	e4h,4eh,abh,30h,79h,b6h,beh,97h
+			db	adh,1ah,ceh,f9h,c2h,0bh,54h,3eh
+			db	74h,69h,eeh,fah,14h,9fh,a3h,e5h
+			db	26h,38h,d6h,29h,8dh,dch,25h,48h
+			db	48h,22h,c6h,7ch,8eh,cah,7bh,dah
+			db	d1h,fch,c3h,7bh,1bh,06h,62h,6ah
+			db	32h,d3h,5ah,85h,f9h,a0h,72h,b5h
+			db	12h,dfh,b5h,0dh,bdh,bdh,13h,80h
+			db	f8h,aeh,a9h,efh,15h,4bh,09h,8fh
+			db	7dh,23h,88h,b2h,07h,8fh,c7h,d8h
+			db	84h,19h,9eh,5ch,f1h,45h,ffh,76h
+			db	72h,7eh,bfh,85h,47h,b9h,3ch,f7h
+			db	2ah,a4h,eah,76h,0ch,91h,edh,e5h
+			db	28h,e9h,a5h,38h,23h,74h,22h,dah
+			db	89h,e2h,94h,3ah,71h,3ch,89h,aeh
+			db	5fh,97h,4ch,60h,08h,a8h,18h,c1h
+			db	7ah,2fh,4ah,b5h,8ah,97h,7ah,8bh
+			db	e6h,31h,86h,65h,08h,9ch,48h,8dh
+			db	7ah,c4h,e1h,deh,3ch,14h,edh,93h
+			db	1ah,c6h,ech,2dh,feh,ebh,c0h,9ah
+			db	3ah,68h,63h,55h,d8h,52h,19h,4bh
+			db	70h,fdh,5bh,34h,a5h,1fh,81h,3ah
+			db	e5h,f4h,dah,bah,d9h,aah,b6h,3fh
+			db	21h,a3h,0eh,09h,a0h,98h,f8h,70h
+			db	dfh,4fh,7eh,9bh,25h,9dh,abh,51h
+			db	a6h,bfh,37h,63h,2fh,05h,30h,edh
+			db	6ah,ach,09h,5bh,52h,66h,d9h,a5h
+			db	e5h,a5h,fdh,e7h,25h,b3h,33h,44h
+			db	e3h,b6h,b7h,4fh,cbh,a7h,8ch,eah
+			db	05h,96h,3ch,7ah,73h,ffh,9fh,4ah
+			db	f9h,05h,47h,a6h,6fh,9ah,d9h,a3h
+			db	29h,10h,72h,62h,a9h,b3h,20h,0bh
+			db	ceh,88h,48h,c4h,78h,05h,59h,e4h
+			db	20h,76h,e6h,18h,87h,cbh,92h,e3h
+			db	60h,79h,84h,20h,9ch,8bh,1dh,9dh
+			db	83h,aeh,02h,16h,f8h,42h,54h,3eh
+			db	94h,1ah,4ah,35h,31h,8ah,8fh,96h
+			db	85h,6dh,b7h,3ah,7ch,8bh,86h,5dh
+			db	4ch,43h,92h,3bh,a2h,15h,5ch,8dh
+			db	eeh,37h,d9h,d9h,38h,d3h,0ah,61h
+			db	8fh,c2h,ceh,e8h,dfh,6bh,2bh,0ah
+			db	13h,bfh,62h,b2h,56h,17h,97h,85h
+			db	4ch,16h,2fh,8ch,d8h,24h,8fh,02h
+			db	1bh,03h,40h,8dh,8ah,beh,c6h,a4h
+			db	24h,00h,70h,09h,37h,c8h,c5h,1bh
+			db	dbh,96h,8fh,7dh,f5h,b0h,85h,71h
+			db	c2h,afh,f0h,beh,e6h,36h,b8h,b7h
+			db	14h,04h,8dh,26h,29h,c2h,03h,c7h
+			db	8bh,98h,0ah,2bh,6fh,8bh,52h,44h
+			db	59h,b2h,38h,15h,c6h,04h,9fh,04h
+			db	09h,19h,28h,0eh,0ch,a7h,88h,50h
+			db	86h,2bh,17h,6fh,4fh,60h,e0h,e4h
+			db	15h,4ch,d6h,ffh,8fh,c0h,98h,0bh
+			db	45h,6dh,56h,3ah,f2h,10h,5ch,7ch
+			db	9eh,4eh,6eh,3ah,bah,50h,22h,84h
+			db	9eh,b8h,76h,cdh,f4h,dfh,21h,1ch
+			db	a9h,a2h,03h,8eh,d5h,08h,ffh,8ah
+			db	c9h,8bh,74h,70h,73h,57h,07h,5eh
+			db	fah,07h,57h,70h,b2h,deh,77h,21h
+			db	26h,81h,f0h,81h,dch,00h,13h,88h
+			db	a8h,b9h,10h,46h,b4h,0fh,a4h,99h
+			db	0bh,e2h,9dh,72h,04h,f6h,f7h,b4h
+			db	41h,e0h,beh,5ah,b3h,ech,47h,71h
+			db	d8h,61h,8eh,93h,28h,69h,ceh,b1h
+			db	99h,3eh,0eh,05h,edh,e8h,3dh,edh
+			db	20h,6bh,eeh,17h,7eh,30h,3bh,3ah
+			db	46h,86h,0bh,c9h,6ah,b8h,c1h,b1h
+			db	c4h,a6h,d9h,a6h,b9h,4dh,87h,a3h
+			db	93h,6bh,88h,0dh,2ch,9bh,7bh,b9h
+			db	66h,d3h,4eh,f6h,20h,00h,44h,cah
+			db	96h,f5h,0eh,eah,79h,91h,59h,99h
+			db	c6h,a2h,bdh,b7h,6ah,37h,67h,25h
+			db	1eh,87h,deh,8fh,59h,97h,a4h,3eh
+			db	41h,c5h,dfh,d0h,05h,02h,2ch,71h
+			db	4eh,61h,1fh,f7h,a1h,26h,d0h,f7h
+			db	44h,02h,3fh,7eh,99h,7dh,84h,edh
+			db	06h,01h,8ah,8eh,9ch,aah,5fh,21h
+			db	79h,f4h,2dh,9eh,efh,9eh,13h,eah
+			db	5ch,5bh,ceh,bah,f3h,f9h,b5h,93h
+			db	61h,d9h,b2h,0ah,dbh,6ah,7ah,8ch
+			db	27h,16h,5ah,01h,9ch,1bh,18h,dfh
+			db	68h,8bh,48h,bah,33h,2dh,f1h,9fh
+			db	f9h,eah,e4h,b2h,abh,04h,0ch,38h
+			db	1ah,5ah,5ch,2eh,29h,c7h,beh,3dh
+			db	a5h,e2h,6dh,7ch,7ah,9ah,19h,fah
+			db	4eh,03h,a6h,0ch,dfh,5ah,44h,3ah
+			db	f5h,b5h,fch,a6h,dbh,0fh,09h,fbh
+			db	a2h,7eh,a5h,97h,f1h,c1h,48h,afh
+			db	3bh,3dh,fch,e6h,09h,b8h,79h,8bh
+			db	6fh,fbh,9ch,14h,e4h,50h,a9h,adh
+			db	8bh,ddh,aeh,45h,7ch,f3h,82h,e8h
+			db	c8h,e1h,fdh,f9h,edh,a8h,84h,4fh
+			db	3ah,35h,1bh,00h,26h,6dh,f2h,e6h
+			db	f2h,3fh,aah,49h,0ah,18h,94h,d1h
+			db	09h,fdh,74h,27h,f9h,3ah,6fh,69h
+			db	d8h,56h,96h,c0h,4ch,47h,2ch,33h
+			db	eeh,4ah,9dh,54h,29h,91h,34h,d2h
+			db	f1h,ddh,7dh,08h,9ah,6ah,aah,38h
+			db	56h,a1h,eah,07h,10h,6dh,0ah,b0h
+			db	2bh,e1h,5eh,23h,66h,55h,a9h,11h
+			db	dfh,deh,e9h,b6h,73h,52h,58h,70h
+			db	23h,23h,5eh,ddh,3dh,c1h,46h,43h
+			db	15h,71h,3dh,81h,9ah,d3h,05h,a1h
+			db	31h,ech,6ah,07h,bah,3dh,c9h,a1h
+			db	6bh,50h,8ah,08h,62h,78h,b7h,73h
+			db	44h,8ah,e9h,12h,56h,f1h,e0h,75h
+			db	99h,65h,63h,c1h,59h,98h,6fh,24h
+			db	6eh,46h,27h,67h,aah,f1h,a4h,97h
+			db	a2h,39h,4ch,74h,3bh,5dh,d7h,e8h
+			db	50h,f9h,fch,7ah,84h,afh,cah,18h
+			db	edh,3ah,4bh,73h,d8h,6dh,efh,6ah
+			db	b5h,4ch,10h,18h,36h,20h,a9h,86h
+			db	b8h,10h,beh,d5h,c6h,dch,c3h,33h
+			db	2bh,cfh,1fh,26h,6bh,abh,ffh,7ch
+			db	23h,5eh,f3h,20h,47h,1dh,90h,28h
+			db	95h,89h,0bh,56h,38h,2dh,a8h,d0h
+			db	aeh,1ch,77h,4bh,9ah,c4h,ddh,22h
+			db	55h,62h,a7h,88h,3bh,a9h,c1h,b3h
+			db	b1h,26h,62h,d9h,64h,66h,aeh,00h
+			db	f7h,22h,98h,c9h,86h,8ah,83h,bdh
+			db	e4h,a4h,86h,83h,5ah,c4h,8dh,92h
+			db	8ch,0ah,ddh,abh,4fh,93h,7dh,3bh
+			db	38h,b8h,77h,18h,83h,d9h,dfh,e7h
+			db	a8h,b5h,5dh,22h,bfh,b5h,c1h,15h
+			db	2bh,28h,a4h,29h,01h,b8h,1ch,10h
+			db	a2h,6dh,f2h,9fh,48h,39h,d8h,8ch
+			db	57h,58h,6ch,62h,2bh,92h,5eh,6bh
+			db	00h,25h,2ch,2dh,7eh,03h,deh,deh
+			db	0eh,e4h,1bh,c0h,60h,5eh,2ah,69h
+			db	5eh,eeh,72h,40h,0fh,8dh,4bh,5ch
+			db	a0h,d4h,a7h,18h,20h,f0h,fdh,0eh
+			db	08h,4eh,c8h,86h,99h,ddh,27h,c8h
+			db	bfh,e9h,fch,60h,35h,a5h,0ch,6ah
+			db	77h,eeh,53h,08h,f5h,89h,cah,54h
+			db	69h,1dh,a9h,0ch,1eh,b8h,52h,f2h
+			db	beh,dch,3bh,b1h,1bh,9ch,07h,39h
+			db	51h,73h,d4h,b0h,c2h,25h,cfh,cah
+			db	30h,71h,cah,a5h,50h,9bh,b8h,5ch
+			db	36h,6fh,a3h,e8h,bch,95h,adh,15h
+			db	94h,e1h,cdh,1fh,29h,3ah,9dh,7ch
+			db	f0h,11h,9bh,0ch,c8h,0bh,51h,adh
+			db	abh,5ah,82h,a2h,e5h,ffh,e3h,74h
+			db	11h,b2h,d8h,a0h,c3h,c1h,a7h,6ah
+			db	2dh,12h,43h,06h,ach,1fh,f7h,d5h
+			db	37h,6fh,9ah,a8h,89h,aeh,2eh,c2h
+			db	56h,88h,0bh,9ah,47h,32h,c9h,50h
+			db	a1h,2ah,84h,07h,aah,33h,8fh,48h
+			db	7dh,90h,ddh,9fh,2bh,bch,47h,5ch
+			db	22h,10h,ach,5dh,98h,b3h,42h,4bh
+			db	c9h,25h,93h,b6h,93h,53h,dah,27h
+			db	76h,cch,cbh,47h,93h,97h,21h,72h
+			db	83h,43h,04h,19h,7bh,1fh,3dh,22h
+			db	f5h,d2h,78h,94h,e8h,50h,73h,8eh
+			db	afh,18h,66h,19h,3eh,51h,d1h,37h
+			db	36h,c7h,c8h,eeh,b7h,e0h,53h,98h
+			db	3dh,0ch,0ch,bch,69h,02h,9bh,9ah
+			db	fbh,22h,a4h,16h,c7h,07h,7ah,c4h
+			db	c2h,2bh,47h,edh,1ch,b5h,9eh,24h
+			db	a0h,8bh,5bh,74h,9dh,41h,fdh,58h
+			db	eeh,eeh,45h,12h,fah,73h,d9h,28h
+			db	9ah,3fh,c3h,63h,9ch,b5h,36h,a3h
+			db	f8h,ach,86h,e8h,d8h,e5h,62h,cfh
+			db	f1h,1ch,95h,f6h,dbh,51h,d2h,ach
+			db	f4h,20h,98h,30h,e9h,9dh,14h,18h
+			db	96h,b2h,cdh,f4h,29h,2fh,abh,84h
+			db	1eh,9dh,22h,16h,81h,18h,6dh,e1h
+			db	a1h,7bh,f3h,00h,f5h,81h,63h,24h
+			db	2bh,3ch,b4h,bch,bbh,8fh,d6h,4fh
+			db	34h,edh,70h,dah,4fh,0fh,8bh,0fh
+			db	5ah,a2h,9dh,71h,1fh,58h,42h,18h
+			db	37h,cbh,63h,c5h,9ch,1dh,2bh,89h
+			db	77h,2dh,d3h,01h,a0h,f3h,dch,c7h
+			db	eeh,04h,25h,67h,d3h,1ah,86h,56h
+			db	5eh,89h,2fh,80h,f0h,aeh,c6h,89h
+			db	fch,5eh,52h,15h,bah,02h,ach,bdh
+			db	d1h,92h,70h,1eh,0fh,62h,d3h,b1h
+			db	84h,77h,55h,3eh,d1h,94h,f4h,2ah
+			db	3dh,6eh,2bh,93h,56h,5fh,75h,1fh
+			db	eah,99h,b2h,a2h,f3h,5ch,f5h,a5h
+			db	4ah,c5h,35h,bah,dch,9ch,6bh,95h
+			db	beh,c3h,14h,32h,c5h,18h,57h,cbh
+			db	88h,9dh,89h,90h,fch,a2h,19h,a4h
+			db	1fh,9eh,36h,d7h,91h,12h,7fh,a3h
+			db	70h,0eh,d4h,a6h,0ch,f6h,adh,efh
+			db	4fh,7ch,a6h,cah,0ch,ech,63h,c0h
+			db	20h,fbh,91h,d5h,25h,cfh,04h,9fh
+			db	9ch,7bh,2ch,67h,76h,5ah,06h,46h
+			db	c4h,4ah,c0h,38h,3dh,61h,d1h,86h
+			db	2ch,47h,8fh,c6h,ebh,0eh,b6h,ceh
+			db	34h,45h,56h,5ch,abh,29h,d6h,a6h
+			db	2ah,56h,27h,30h,bfh,c6h,86h,8bh
+			db	07h,51h,7dh,6bh,f6h,35h,a2h,89h
+			db	e4h,84h,b5h,06h,55h,82h,42h,05h
+			db	5fh,57h,1eh,2bh,6eh,b9h,8ch,57h
+			db	bfh,1dh,20h,5dh,17h,40h,e8h,49h
+			db	12h,afh,0fh,2dh,37h,27h,9ah,4bh
+			db	1ch,a9h,d7h,79h,1ch,a5h,3ah,95h
+			db	fdh,a3h,5fh,97h,e1h,f0h,0fh,bch
+			db	c6h,ffh,28h,34h,1ch,2ch,1dh,a7h
+			db	63h,31h,22h,6eh,e9h,14h,bdh,c5h
+			db	7ah,e1h,83h,44h,4dh,a6h,22h,36h
+			db	8ch,3dh,d4h,9ch,19h,57h,48h,28h
+			db	d1h,53h,f6h,08h,4eh,40h,eah,91h
+			db	17h,01h,d9h,f8h,76h,6ah,73h,93h
+			db	6bh,deh,20h,54h,b3h,93h,c2h,64h
+			db	3fh,3eh,4eh,95h,ebh,1fh,a9h,ach
+			db	bbh,7ah,24h,ddh,24h,9ch,edh,edh
+			db	04h,37h,9bh,93h,35h,42h,1dh,67h
+			db	35h,2ch,4ch,0dh,0ah,36h,abh,19h
+			db	23h,8dh,ebh,36h,28h,ech,2bh,fch
+			db	f6h,8eh,4fh,ach,d1h,b4h,11h,56h
+			db	76h,32h,37h,b3h,0fh,76h,69h,56h
+			db	b3h,4bh,aah,cbh,8eh,fbh,f8h,8bh
+			db	47h,ceh,0bh,95h,5fh,b6h,c9h,bdh
+			db	c3h,40h,6ch,9ah,9bh,fch,d7h,41h
+			db	99h,ddh,4fh,1ch,04h,95h,56h,84h
+			db	a8h,0ah,a7h,9eh,5fh,fah,eah,a7h
+			db	c1h,d1h,fdh,bch,40h,33h,05h,60h
+			db	f3h,ceh,cdh,31h,c0h,dch,6eh,82h
+			db	3dh,cch,ach,f6h,ebh,aeh,4ah,27h
+			db	a7h,75h,1eh,15h,98h,35h,6bh,04h
+			db	32h,a8h,8fh,16h,cbh,dah,7dh,fbh
+			db	6bh,dch,edh,68h,48h,b5h,bbh,96h
+			db	51h,74h,40h,9dh,b6h,9bh,4ch,33h
+			db	6dh,b1h,b5h,74h,73h,f4h,89h,c6h
+			db	47h,7eh,21h,5ah,19h,0ch,28h,24h
+			db	b3h,39h,28h,4bh,f7h,d0h,40h,c4h
+			db	a4h,80h,93h,bah,2eh,dfh,dbh,c2h
+			db	79h,14h,fdh,d3h,5ah,70h,11h,f7h
+			db	60h,e5h,08h,34h,29h,45h,b1h,2eh
+			db	2ah,08h,f6h,f8h,6bh,b8h,e2h,86h
+			db	a1h,72h,55h,e5h,64h,b6h,8ah,42h
+			db	23h,b8h,aeh,e7h,c3h,15h,d1h,f6h
+			db	73h,5ch,37h,5ch,23h,98h,4eh,21h
+			db	eah,84h,32h,83h,b0h,d3h,fdh,7fh
+			db	b9h,36h,1dh,6dh,a4h,d5h,8eh,c9h
+			db	5bh,dbh,63h,38h,62h,19h,44h,2dh
+			db	30h,68h,d5h,37h,b1h,49h,5bh,4bh
+			db	68h,73h,b8h,41h,65h,16h,80h,3bh
+			db	deh,71h,32h,ddh,8ch,1fh,1eh,c0h
+			db	efh,78h,cch,79h,30h,43h,54h,efh
+			db	10h,a3h,f5h,62h,91h,01h,a2h,f1h
+			db	7bh,9ah,7eh,6fh,56h,c4h,fdh,77h
+			db	d1h,d5h,84h,52h,c4h,1fh,81h,99h
+			db	94h,eah,bch,e8h,80h,d9h,6ah,fdh
+			db	bfh,0eh,4ch,e3h,60h,e6h,8bh,20h
+			db	2bh,49h,c5h,e6h,b0h,00h,7dh,95h
+			db	0eh,a0h,48h,cah,5eh,84h,83h,95h
+			db	4fh,02h,eah,d4h,b4h,6eh,33h,8eh
+			db	50h,03h,27h,62h,7ah,c4h,69h,51h
+			db	29h,5dh,4ah,59h,ach,29h,66h,4dh
+			db	cdh,c6h,f7h,43h,07h,1ah,41h,15h
+			db	5ah,84h,f0h,bbh,87h,6fh,0bh,c2h
+			db	e4h,35h,b2h,03h,7ch,adh,6ah,e0h
+			db	e3h,cfh,aeh,4dh,4eh,e1h,f1h,08h
+			db	dfh,4ah,12h,efh,89h,3eh,cdh,56h
+			db	69h,8ah,40h,d7h,a8h,72h,88h,54h
+			db	cch,7fh,a5h,f6h,4ah,2bh,6ah,48h
+			db	4ch,e3h,bdh,03h,eeh,28h,f6h,94h
+			db	beh,ech,bbh,7dh,68h,9fh,b6h,a4h
+			db	ceh,6ah,0ah,4ch,87h,6ah,16h,08h
+			db	0ah,21h,58h,6fh,afh,69h,c0h,63h
+			db	a8h,94h,26h,97h,77h,37h,88h,8dh
+			db	dbh,06h,2bh,22h,47h,e7h,6fh,75h
+			db	41h,02h,deh,88h,f6h,6eh,77h,edh
+			db	9bh,3dh,0ah,96h,d2h,7eh,71h,abh
+			db	50h,5dh,44h,eeh,31h,0fh,77h,c2h
+			db	35h,9bh,9eh,08h,70h,62h,7dh,19h
+			db	dch,9eh,0fh,0eh,c4h,bch,95h,e4h
+			db	01h,a1h,9eh,4eh,a6h,cdh,2bh,0eh
+			db	c2h,13h,26h,4ah,f4h,b9h,22h,e4h
+			db	26h,43h,26h,feh,1ah,deh,c5h,36h
+			db	91h,6ah,d0h,4dh,13h,59h,59h,17h
+			db	61h,74h,98h,2bh,2ah,76h,72h,c6h
+			db	ebh,d9h,4eh,40h,56h,b9h,46h,beh
+			db	4ah,2eh,0fh,e7h,aeh,75h,d0h,09h
+			db	8fh,53h,c7h,fah,f9h,05h,c8h,c8h
+			db	8eh,02h,7dh,a5h,dfh,1ch,f4h,26h
+			db	78h,7eh,ebh,89h,56h,7ah,7bh,26h
+			db	09h,53h,89h,38h,cah,7dh,0dh,3eh
+			db	67h,dfh,f3h,a2h,69h,d3h,2bh,f3h
+			db	5bh,7bh,32h,8eh,32h,d4h,9eh,dah
+			db	b3h,efh,8bh,26h,e5h,91h,49h,deh
+			db	86h,41h,8eh,84h,5ah,ddh,e3h,9fh
+			db	80h,d2h,96h,c0h,ach,ebh,1fh,aah
+			db	20h,a3h,b4h,76h,65h,1fh,fch,bfh
+			db	6fh,89h,25h,6bh,d0h,b5h,3bh,36h
+			db	b5h,d3h,c5h,0fh,95h,4ch,92h,4ch
@@ -0,0 +1,19106 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	bdh,15h,10h,33h,94h,26h,1fh,9fh
+			db	9fh,edh,73h,25h
+
+start:						; execution starting point
+			add	hl,hl
+			inc	e
+			push	de
+			dec	(hl)
+			xor	h
+			inc	hl
+			and	14h
+			ld	h,b
+			ld	(hl),9bh
+			ld	(hl),e
+			ret	z
+			inc	b
+			ld	l,l
+			inc	sp
+			cp	(hl)
+			sub	a
+			ret	po
+			xor	(hl)
+			ld	(hl),a
+			ld	(hl),b
+			or	e
+			ld	c,e
+			ld	e,d
+			djnz	L40a1
+			jr	L4048
+			db	61h,d1h,3ah,5ah,98h,e7h,5ch,e6h
+			db	8ah,b8h,b7h,c6h,00h,e9h,b8h,ceh
+			db	d7h,77h,fah,66h,eeh,cch,05h,4dh
+			db	8bh,f2h,aeh
+			sub	a
+			dec	d
+			inc	e
+			jp	m,L2e31
+			sub	d
+			add	a,(hl)
+			pop	hl
+			ld	ixh,d *
+			or	d
+			ld	hl,(63ach)
+			ld	e,a
+			ld	bc,6b65h
+			ret	m
+			adc	a,l
+			add	hl,sp
+			call	p,Lbbd9
+			dec	sp
+			exx
+			adc	a,a2h
+			scf
+			ld	c,9eh
+			call	nc,L32f7
+			and	b
+			push	hl
+			adc	a,h
+			or	e
+			ld	a,h
+			jp	c,Lb09b
+			xor	f9h
+			dec	hl
+			ld	c,l
+			and	e
+			ret	nz
+			push	hl
+			inc	c
+			ld	a,(de)
+			add	hl,bc
+			ret	nz
+			call	L2b6b
+			xor	d
+			cp	a
+			and	b
+			ld	b,b
+			ld	b,c
+			dec	hl
+			and	(hl)
+			sbc	a,ach
+			ld	h,a
+			nop (2x) *
+			jp	L2eb2
+			db	52h,a4h,a6h,2ch,22h,84h,30h,7ah
+			db	b9h,54h,74h,e3h,fah,cdh,6ch,2bh
+			db	37h,b4h
+			ret	c
+			ei
+			xor	l
+			call	nz,Lc6bc
+			and	d
+			call	pe,L9c09
+			ei
+			ld	h,h
+			sub	h
+			push	bc
+			rst	28h
+			dec	(hl)
+			sbc	a,a
+			ld	d,d
+			ld	a,(de)
+			or	fbh
+			jr	nc,L4072
+			xor	a
+			add	hl,sp
+			ld	sp,ff2ch
+			adc	a,b
+			sub	a
+			sbc	a,a
+			dec	sp
+			pop	af
+			xor	h
+			add	a,13h
+			nop (2x) *
+			and	a
+			ld	a,(hl)
+			ld	l,b
+			nop (2x) *
+			add	a,(hl)
+			ld	b,e
+			call	nz,Lc501
+			or	a
+			ret	p
+			ret	p
+			ld	l,38h
+			cp	b
+			ld	(hl),l
+			ret	m
+			and	a
+			ld	l,a
+			ld	l,a
+			jp	z,L82e0
+			sub	c
+			ret	c
+			adc	a,d
+			sub	l
+			ld	l,c7h
+			jr	nc,L40ae
+			ex	de,hl
+			ld	d,b
+			rla
+			dec	b
+			xor	d
+			ld	c,l
+			inc	de
+			rrca
+			rst	38h
+			in	a,(b7h)
+			adc	a,e
+			add	a,(hl)
+			ld	(b0afh),a
+			rst	38h
+			inc	b
+			rlca
+			cp	l
+			ret	m
+			add	hl,de
+			xor	b
+			ld	(hl),e
+			ld	sp,hl
+			ld	(hl),c
+			inc	bc
+			ld	l,a
+			dec	(hl)
+			ld	c,h
+			call	c,Lc008
+			and	l
+			ccf
+			rst	30h
+			or	d
+			sbc	a,b
+			jp	nz,Lfd30
+			ei
+			jr	L40fd
+			db	0ch,aeh,a7h,cfh,72h,ddh,73h,c9h
+			db	beh,50h,c3h,0ch,1fh,07h,e7h,7ah
+			db	7ch,12h,eeh,8ch,c1h,57h,dch,52h
+			db	b4h,60h,a2h,13h,a4h,5fh,57h,93h
+			db	2eh,63h,67h,c9h,39h,dbh,00h,12h
+			db	9ah,7ch,0fh,d0h,07h,1bh,2bh,4fh
+			db	18h,aah,56h,cdh,cfh,ach,ddh,11h
+			db	4bh,79h,dbh,04h,03h,58h,a7h,85h
+			db	25h,97h,14h,88h,35h,b4h,30h,04h
+			db	edh,35h,68h,6ah,89h,b7h,74h,06h
+			db	66h,76h,48h,36h,99h,2dh,dfh,4fh
+			db	3fh,8dh,8ch,09h,b1h,67h,12h,fah
+			db	abh,16h,04h,46h,a6h,0ah,37h,76h
+			db	c0h,e2h,dfh,53h,70h,0dh,73h,55h
+			db	a1h,f6h,25h,7ch
+			dec	d
+			cp	a
+			inc	c
+			rst	10h
+			ld	hl,(782ch)
+			ld	(068eh),hl
+			call	nc,L57c4
+			ex	(sp),hl
+			ld	l,a
+			cp	5ah
+			ld	h,b
+			ret	po
+			dec	hl
+			ret	z
+			call	po,Lc944
+			ld	d,h
+			or	(hl)
+			sbc	a,(hl)
+			add	a,l
+			inc	l
+			nop
+			ld	a,(4031h)
+			pop	hl
+			ld	a,0dh
+			add	a,h
+			or	h
+			add	a,a6h
+			ld	hl,ba94h
+			cp	c
+			rlca
+			ld	a,(f8f4h)
+			ld	(cee3h),hl
+			or	d
+			ld	(hl),h
+			ld	(hl),b
+			ld	e,l
+			ld	e,d
+			inc	bc
+			ld	l,l
+			cpd
+			add	a,05h
+			ei
+			dec	sp
+			ld	h,d
+			ld	l,e
+			ret	nz
+			ld	c,b
+			xor	b
+			ld	(e302h),hl
+			ld	a,48h
+			ld	l,h
+			call	L89ea
+			ld	h,c
+			ld	e,a
+			push	hl
+			and	c
+			add	a,(hl)
+			sub	h
+			ld	(hl),e
+			ld	d,b0h
+			dec	a
+			ld	b,b
+			ld	a,(hl)
+			jr	c,L41f1
+			rra
+			inc	b
+			ld	bc,cea4h
+			jr	z,L4238
+			sbc	a,h
+			jp	(hl)
+			db	30h,83h,f6h,3eh,2ah,cfh
+			ld	l,h
+			call	nz,L33f9
+			ld	(hl),c
+			ld	c,a
+			ld	h,d
+			or	14h
+			ld	c,(hl)
+			exx
+			adc	a,e
+			inc	de
+			adc	a,l
+			xor	f8h
+			cp	(hl)
+			sbc	a,e
+			cpl
+			exx
+			ld	d,a
+			ld	l,l
+			cp	c
+			call	z,L37a3
+			ld	a,h
+			dec	a
+			dec	a
+			xor	b
+			daa
+			ld	a,9fh
+			inc	de
+			sub	(hl)
+			ld	(hl),h
+			ld	a,d
+			call	pe,L87a3
+			xor	h
+			ld	h,a
+			add	a,7bh
+			rst	20h
+			ld	d,e
+			ld	(hl),b8h
+			ld	e,l
+			cp	b
+			pop	hl
+			ld	h,l
+			xor	2dh
+			dec	h
+			push	hl
+			jr	nz,L41ea
+			add	a,a
+			ld	c,41h
+			or	b
+			sbc	a,l
+			ld	a,d
+			sub	l
+			rst	28h
+			or	(hl)
+			cp	l
+			ld	c,d
+			xor	e
+			ld	e,d
+			pop	bc
+			inc	e
+			add	a,c
+			or	h
+			sub	6fh
+			call	nc,L2c29
+			dec	h
+			inc	sp
+			dec	(hl)
+			jp	z,L1b35
+			dec	sp
+			ld	h,d
+			jp	nz,L8a14
+			ld	e,b
+			adc	a,b
+			ld	sp,6177h
+			jp	p,L27f6
+			add	a,a
+			res	4,l
+			cp	c
+			add	a,27h
+			rst	28h
+			inc	sp
+			ex	de,hl
+			ld	a,b
+			ld	e,a
+			jp	(hl)
+			db	6bh,00h,5ah,cfh,44h,41h,7eh,dah
+			db	93h,9bh,a2h,e0h,00h,65h,19h,15h
+			db	3bh,ffh,20h,f6h,8bh,8eh,31h,cch
+			db	fdh,b9h,b2h,feh,3ah,8dh,87h,50h
+			db	84h,aeh,0dh,10h,0dh,6eh,42h,70h
+			db	f4h,70h,aah,3ch,02h,5dh,67h,cch
+			db	86h,bch,4bh,3dh,38h,b7h,79h,2ch
+			db	8ah,c4h,cch,ffh,24h,b4h,31h,b3h
+			db	f4h,54h,7ch,fdh,bbh,30h,5ch,28h
+			db	e5h,aah,efh,abh,52h,98h,52h,4ah
+			db	abh,7ah,73h,b6h,8fh,6bh,0ah,78h
+			db	51h,63h,f7h,bbh,d0h,a9h,9dh,06h
+			db	0eh,81h,9fh,b5h,86h,d1h,b8h,f1h
+			db	ebh,0eh,92h,feh,cfh,8dh,3bh,b1h
+			db	a3h,d7h,59h,15h,12h,25h,bfh,98h
+			db	82h,94h,1ch,c8h,19h,fbh,34h,49h
+			db	25h,a3h,b7h,e9h,5fh,48h,80h,76h
+			db	4dh,d2h,8fh,00h,66h,d6h,51h,7dh
+			db	a2h,2ch,d7h,23h,7bh,79h,f3h,3dh
+			db	72h,6dh,37h,6fh,7bh,43h,2ch,f5h
+			db	8bh,e8h,69h,82h,0ah,1ah,3bh,44h
+			db	f8h,73h,f4h,90h,1bh,02h,49h,f9h
+			db	e6h,1fh
+			xor	c
+			ld	e,h
+			ld	b,h
+			or	l
+			inc	l
+			inc	e
+			or	a
+			or	c
+			add	hl,sp
+			adc	a,l
+			adc	a,d
+			cp	a
+			jr	c,L4312
+			or	e
+			add	hl,sp
+			inc	b
+			dec	(hl)
+			rst	00h
+			or	b
+			rrca
+			ld	hl,96eeh
+			add	a,e
+			add	a,a
+			ld	b,e
+			sbc	a,a
+			and	b
+			or	e
+			cp	l
+			ld	e,dah
+			and	(hl)
+			and	e
+			ld	c,85h
+			or	l
+			ld	a,l
+			rlca
+			or	d
+			ld	(hl),c
+			call	p,Lacb0
+			and	(hl)
+			adc	a,d
+			ld	a,d
+			ld	c,(hl)
+			ld	de,895ah
+			inc	l
+			ld	sp,hl
+			and	a
+			ld	l,b
+			ld	d,(hl)
+			ret	pe
+			or	d
+			ld	h,c
+			ld	b,c
+			sbc	a,(hl)
+			add	a,e
+			ld	e,(iy + f8h)
+			xor	a
+			ld	l,d
+			ret
+			db	dfh,d0h,98h,f2h,f1h,a1h,0eh,3dh
+			db	08h,9bh,f4h,5ah,9dh,68h,8ch,ach
+			db	55h,9ah,95h,6ah,27h,98h,cdh,ebh
+			db	c0h,a7h,2bh,81h,b0h,e3h,9ah,a9h
+			db	d6h,e8h,c0h,86h,7bh,69h,f1h,91h
+			db	53h,9ch,20h,85h,7ch,32h,39h,c1h
+			db	e4h,b2h,08h,53h,57h,82h,11h,72h
+			db	65h,42h,45h,80h,1bh,e4h,bch,ceh
+			db	10h,6dh,fdh,30h,a4h,3ah,77h,09h
+			db	21h,a2h,f3h,93h,cdh,08h,6ch,d6h
+			db	41h,0ah,46h,08h,0fh,47h,ffh,dfh
+			db	deh,53h,fbh,f5h,62h,11h,9ch,a5h
+			db	50h,b3h,35h,fch,45h,98h,3eh,7eh
+			db	b2h,33h,ebh,5eh,27h,b3h,5fh,ddh
+			db	b4h,ddh,c7h,27h,9bh,9ah,d2h,7bh
+			db	21h,61h,67h,e9h
+			call	po,L648d
+			xor	(hl)
+			dec	(hl)
+			ld	sp,48cbh
+			sub	c
+			ld	a,(bc)
+			ld	a,h
+			add	hl,bc
+			ex	af,af'
+			add	a,f9h
+			ld	d,29h
+			call	z,L3c9a
+			dec	c
+			ld	b,b
+			xor	d
+			ret	nc
+			jr	nz,L4436
+			jr	z,L43df
+			adc	a,c
+			add	a,b
+			or	c
+			out	(90h),a
+			ld	(de),a
+			rst	00h
+			adc	a,a
+			dec	a
+			ld	e,a
+			and	a
+			ld	h,e
+			adc	a,c
+			ld	a,e
+			xor	l
+			sub	e
+			and	b
+			add	a,e
+			and	(hl)
+			ld	a,c1h
+			cp	52h
+			call	nc,Leea5
+			ld	h,d
+			ld	c,(hl)
+			ld	bc,25ach
+			ld	h,e
+			out	(04h),a
+			dec	b
+			cp	(hl)
+			ld	(hl),c
+			ld	l,l
+			cp	e
+			ld	e,l
+			call	nz,L50fa
+			adc	a,(hl)
+			ld	b,h
+			ld	d,b
+			dec	sp
+			inc	bc
+			ret	z
+			ld	e,e0h
+			rrca
+			ret	nz
+			dec	b
+			ei
+			halt
+			ld	a,26h
+			or	b
+			ld	(7f38h),a
+			ld	d,a
+			ld	l,c
+			and	b
+			jr	c,L43e3
+			ld	(93b9h),a
+			and	h
+			sub	(hl)
+			pop	af
+			inc	e
+			ld	e,c
+			inc	(hl)
+			ld	h,d
+			sub	l
+			djnz	L4483
+			call	pe,L43d3
+			rst	10h
+			jp	L5378
+			db	33h,14h,2bh,49h,9eh,7fh,17h,c6h
+			db	47h,21h,fah,5ch,9bh,2bh,a5h,77h
+			db	eeh,7fh,b5h,04h,89h,feh,d2h,f6h
+			db	9ah,deh,f1h,0fh,49h,fdh,7fh,37h
+			db	a6h,a4h,f4h,79h,4fh,b1h,0eh,f9h
+			db	8ch,25h,81h,c3h,13h,11h,4fh,5fh
+			db	cdh,18h,67h,58h,2fh,00h,0fh,29h
+			db	17h,64h,1eh,e9h,a9h
+			call	nz,Ldf89
+			jp	c,Le459
+			or	l
+			dec	bc
+			call	pe,Lf436
+			rla
+			dec	sp
+			rst	30h
+			out	(deh),a
+			sub	(hl)
+			ld	d,a
+			jp	p,L3acd
+			jp	pe,L4f00
+			ld	(hl),d
+			ld	c,h
+			ld	(hl),9fh
+			ld	h,a
+			jp	po,Le85b
+			cp	c
+			ld	a,(hl)
+			ld	a,(hl)
+			out	(30h),a
+			cpl
+			add	hl,sp
+			push	hl
+			ld	a,01h
+			or	l
+			ld	e,b
+			ld	d,h
+			adc	a,a
+			or	l
+			or	h
+			dec	e
+			ld	b,d
+			sbc	a,d
+			ret	po
+			ld	(5953h),hl
+			ccf
+			ld	h,h
+			call	nc,Lba87
+			ld	(hl),l
+			add	a,a
+			jr	L4537
+			db	22h,25h,21h,ffh,82h,cch,15h,9dh
+			db	66h,89h,18h,a4h,80h,6dh,9ah,0eh
+			db	93h,91h,84h,bfh,55h,d9h,a1h,46h
+			db	44h,57h,69h,8eh,7dh,7eh,1bh,3eh
+			db	23h,53h,4ch,bdh,86h
+			sub	b
+			ld	h,h
+			ld	a,(hl)
+			inc	sp
+			xor	h
+			or	h
+			call	po,L5908
+			add	hl,de
+			rst	00h
+			pop	hl
+			inc	b
+			add	a,l
+			rra
+			add	a,l
+			ld	b,c
+			add	a,d
+			ld	l,h
+			call	p,L946f
+			ld	d,b
+			ld	(hl),h
+			ld	b,l
+			ld	h,e
+			dec	h
+			ld	(hl),c
+			sub	l
+			cpl
+			and	e
+			ld	d,(hl)
+			jp	nc,Lc0a2
+			ex	(sp),hl
+			and	e
+			add	a,l
+			ld	c,d
+			and	a
+			nop (2x) *
+			ld	sp,hl
+			xor	e
+			rst	20h
+			jp	L5a48
+			db	3dh,2ch,c0h,5fh,7eh,d1h,1ch,d4h
+			db	95h,00h,94h,40h,3ch,57h,beh,bdh
+			ld	l,b
+			cp	h
+			adc	a,b
+			rra
+			ret	nz
+			inc	sp
+			sub	d
+			cp	a
+			and	d
+			jp	z,La958
+			inc	a
+			cp	b
+			adc	a,(hl)
+			sub	(hl)
+			sub	h
+			or	h
+			call	p,Lb57c
+			and	31h
+			ld	(hl),a
+			adc	a,h
+			adc	a,b
+			dec	sp
+			daa
+			rra
+			res	7,d
+			rst	10h
+			sub	a
+			call	pe,L9c13
+			rla
+			ld	d,c
+			ld	hl,b7a8h
+			nop (2x) *
+			inc	sp
+			add	hl,bc
+			rst	18h
+			adc	a,b
+			ld	b,e
+			inc	c
+			xor	l
+			dec	de
+			rlca
+			ld	e,h
+			dec	b
+			or	d8h
+			ld	de,ca01h
+			sbc	a,a
+			ld	a,(bc)
+			push	bc
+			ld	a,(4098h)
+			rrc	h
+			ld	bc,c4d8h
+			pop	bc
+			ld	h,l
+			ld	l,b
+			pop	de
+			ld	c,b
+			ld	e,b
+			ld	(hl),2bh
+			ld	l,d
+			ld	h,b
+			rst	20h
+			ld	c,h
+			or	c
+			and	(hl)
+			ld	h,e
+			ld	c,c
+			adc	a,(hl)
+			ld	h,08h
+			or	h
+			ld	b,c
+			ld	(hl),a
+			add	hl,hl
+			push	af
+			and	l
+			ret	po
+			rra
+			xor	(hl)
+			xor	a
+			adc	a,(hl)
+			ld	d,7dh
+			ld	l,(hl)
+			sbc	a,(hl)
+			dec	de
+			ex	af,af'
+			xor	l
+			adc	a,a
+			sub	b
+			call	pe,Le10d
+			jp	pe,Ld449
+			add	a,h
+			pop	de
+			ret
+			ld	c,9ch
+			ld	d,a
+			daa
+			ld	h,a
+			rst	10h
+			xor	d
+			ld	e,(ix + 41h)
+			ld	b,h
+			ld	e,a
+			call	c,L4cf9
+			ld	h,b
+			ld	c,l
+			ld	c,c
+			call	c,Lc2ec
+			rst	30h
+			sbc	a,d
+			rst	28h
+			ld	sp,hl
+			ld	e,b
+			sub	h
+			or	l
+			call	m,L3fdc
+			ld	e,b
+			adc	a,l
+			sub	a
+			ret	nc
+			ld	(bc),a
+			ld	b,19h
+			rst	38h
+			sbc	a,b
+			ld	e,h
+			call	m,L36b7
+			exx
+			adc	a,d
+			inc	e
+			ld	b,(hl)
+			ld	c,l
+			ld	l,e
+			ld	d,c
+			pop	hl
+			ccf
+			rrca
+			sbc	a,a
+			sbc	a,c
+			sbc	a,c
+			ex	af,af'
+			ld	c,b
+			ld	c,e
+			ld	a,(bc)
+			ld	h,c
+			or	(hl)
+			djnz	L45b1
+			ld	h,(hl)
+			ld	c,a
+			sbc	a,h
+			ld	l,e
+			sub	b
+			dec	hl
+			inc	sp
+			ld	a,h
+			ld	(hl),l
+			call	m,Lb4d6
+			dec	l
+			cpl
+			cp	c
+			or	l
+			sub	c
+			jp	m,Lcc5e
+			ret	p
+			sbc	a,a
+			ld	de,73a9h
+			ld	h,(hl)
+			ld	c,l
+			add	a,d
+			ld	d,c
+			ld	h,d1h
+			ld	d,a
+			ld	h,(hl)
+			ld	c,(hl)
+			ld	c,l
+			ld	a,a
+			cp	c
+			add	a,20h
+			in	a,(47h)
+			cpl
+			adc	a,h
+			sbc	a,a
+			call	c,L0643
+			dec	sp
+			exx
+			add	a,c
+			rla
+			ld	a,(de)
+			sub	b
+			sub	h
+			rra
+			rst	10h
+			and	h
+			or	a
+			sbc	a,a
+			ld	c,b
+			rst	10h
+			ld	e,d
+			ld	(hl),c
+			halt
+			ld	bc,1321h
+			ld	a,l
+			ld	l,(hl)
+			call	z,La980
+			adc	a,c
+			ld	(hl),h
+			ld	(hl),l
+			ld	d,22h
+			jp	m,L8666
+			or	b
+			adc	a,17h
+			push	de
+			or	h
+			xor	e1h
+			cp	l
+			rst	20h
+			inc	e
+			nop (2x) *
+			ld	a,a
+			sub	h
+			rst	18h
+			ld	c,b
+			daa
+			and	b
+			ld	d,d
+			xor	d
+			dec	e
+			and	l
+			xor	a
+			ret	z
+			add	a,c
+			push	bc
+			jp	c,L1c15
+			ld	h,c
+			ld	bc,d7a2h
+			ld	d,(hl)
+			or	b
+			ld	b,b
+			jp	(hl)
+			db	23h,9dh,48h,70h,41h,55h,33h,51h
+			db	68h,30h,bch,3eh,beh
+			ld	a,(bc)
+			ld	a,h
+			add	a,c
+			ld	h,b
+			xor	l
+			ld	c,h
+			rst	08h
+			or	h
+			or	l
+			rr	l
+			ld	(hl),b
+			add	hl,de
+			push	bc
+			ld	e,20h
+			adc	a,(hl)
+			inc	hl
+			ld	l,d
+			ret	pe
+			ld	(hl),b
+			ld	(hl),e
+			ld	h,(hl)
+			sbc	a,(hl)
+			ld	b,l
+			or	e
+			ld	a,(bc)
+			inc	(hl)
+			push	af
+			xor	e
+			ld	h,b
+			ld	l,a
+			adc	a,d
+			call	Lebde
+			sbc	a,d
+			ret	z
+			ld	a,a
+			ld	(3591h),hl
+			jp	m,L26a5
+			rst	28h
+			ld	e,h
+			ei
+			push	af
+			ld	(de),a
+			add	a,h
+			add	hl,sp
+			ld	h,l
+			cp	h
+			dec	hl
+			inc	de
+			sbc	a,(hl)
+			xor	h
+			ret	c
+			rst	20h
+			jp	m,L643a
+			and	77h
+			ld	b,a
+			and	b
+			sub	h
+			ld	l,b3h
+			inc	e
+			add	a,d
+			jr	nc,L46e3
+			ld	l,76h
+			dec	bc
+			daa
+			cp	a
+			ld	(hl),h
+			ld	h,d
+			ret	m
+			cp	e
+			and	l
+			ld	l,(hl)
+			or	a
+			ld	b,e
+			exx
+			add	hl,bc
+			dec	b
+			ld	h,f3h
+			and	74h
+			inc	d
+			ret	nz
+			dec	c
+			ld	e,c
+			ld	e,c
+			push	bc
+			ex	af,af'
+			ld	d,b
+			xor	(hl)
+			call	m,Lc498
+			add	hl,hl
+			ld	b,c
+			add	a,e
+			ld	h,c
+			add	a,24h
+			res	5,l
+			scf
+			inc	de
+			ld	a,a
+			ld	d,(hl)
+			ld	a,b
+			jp	m,L554e
+			and	(hl)
+			ld	a,(1090h)
+			halt
+			ld	h,f8h
+			add	a,b
+			ld	c,c
+			ld	d,(hl)
+			ld	a,6fh
+			ld	l,l
+			ld	l,b
+			ld	b,c
+			ld	b,h
+			call	m,L2dc1
+			ld	(hl),a
+			inc	bc
+			sub	h
+			inc	hl
+			rst	30h
+			adc	a,b
+			ld	a,(2c6ch)
+			ld	c,c
+			inc	sp
+			ld	l,l
+			ld	h,a
+			call	m,L6d1d
+			sub	a
+			cp	b
+			sbc	a,h
+			ld	b,c
+			ld	b,(hl)
+			or	l
+			rst	20h
+			ld	sp,hl
+			inc	a
+			ld	d,c
+			xor	b
+			ld	de,74d6h
+			jp	c,Lfa9f
+			jp	(hl)
+			db	36h,4dh
+			and	l
+			xor	h
+			add	a,e
+			sub	c
+			ld	e,e
+			ld	d,d
+			ld	c,b
+			inc	e
+			inc	h
+			ld	c,06h
+			ld	h,d
+			ld	a,(de)
+			sbc	a,(hl)
+			ld	b,(hl)
+			cp	b
+			ld	d,d
+			sbc	a,e
+			ld	b,l
+			ld	e,a
+			rst	08h
+			push	hl
+			jp	c,L27c7
+			ld	a,c
+			ld	h,l
+			jp	z,L4218
+			and	l
+			ld	a,(de)
+			add	hl,de
+			cpl
+			ld	c,c
+			ld	c,83h
+			call	nc,L9e37
+			inc	b
+			call	pe,L09a1
+			exx
+			ld	(hl),a
+			sub	c
+			add	a,(hl)
+			ld	b,d
+			ld	a,c
+			call	po,L6082
+			jp	c,L8322
+			ld	d,h
+			cp	l
+			ld	a,(3206h)
+			xor	c
+			sub	e
+			ex	af,af'
+			call	c,L4528
+			jp	po,L9c37
+			ld	c,cfh
+			nop
+			ld	c,d
+			jr	L4763
+			db	a7h,79h,5eh,aah,eah
+			cp	9ah
+			ld	(hl),b
+			jp	(hl)
+			db	a4h,b9h,78h,93h,06h,67h,d1h,0dh
+			db	33h,47h,a1h,24h,6ah,7dh,f7h,d5h
+			db	d7h,36h,3ch,97h,7bh,fch,adh,7dh
+			db	5fh,63h,82h,43h,e5h,9fh,a7h,fdh
+			db	0eh,65h,7eh,c7h,e5h,a7h,52h,bch
+			db	d2h,13h,64h,30h,04h,aeh,76h,d2h
+			db	25h,20h,b4h,91h,e4h,dch,94h,10h
+			db	42h,94h,2eh,42h,2dh,46h
+			pop	bc
+			ld	(hl),d
+			rst	00h
+			ld	b,h
+			ld	sp,6bb8h
+			ret	pe
+			ld	sp,hl
+			call	m,L5d9e
+			ld	c,d
+			cp	40h
+			ld	h,d
+			ld	l,30h
+			sub	l
+			add	a,h
+			ld	d,b
+			ld	hl,5bfah
+			adc	a,l
+			sbc	a,33h
+			xor	a
+			ld	a,c
+			dec	l
+			scf
+			ld	sp,hl
+			ld	c,e
+			cp	h
+			pop	de
+			djnz	L483c
+			ld	e,e
+			call	po,L6266
+			push	hl
+			ld	e,h
+			add	a,h
+			add	a,(hl)
+			ld	h,d
+			rst	28h
+			and	d
+			add	a,c
+			ld	(hl),e
+			di
+			ld	(hl),abh
+			ld	b,a
+			jp	pe,L6c72
+			ld	(Lb1e6),hl
+			add	a,d
+			call	Lec88
+			ld	(hl),b
+			cp	(hl)
+			pop	bc
+			out	(deh),a
+			push	hl
+			inc	a
+			ld	(hl),a
+			push	de
+			sub	(hl)
+			ld	h,a
+			add	a,a
+			pop	af
+			ld	c,(hl)
+			ret	p
+			adc	a,b
+			ld	c,fbh
+			ld	sp,hl
+			jp	nc,L0731
+			inc	a
+			halt
+			adc	a,e
+			ccf
+			ex	af,af'
+			and	c
+			ret	po
+			jp	Ldc9a
+			db	f9h,eeh,50h,f3h,87h,59h,f9h,02h
+			db	51h,e2h,d0h,ddh,99h,70h,70h,2fh
+			db	1bh,bbh,96h,97h,abh,f4h,3ch,7eh
+			db	73h,c3h,02h,93h,b7h,40h,d9h,68h
+			db	8ch,a6h,d7h,20h,0bh,41h,04h,96h
+			db	2bh,dch,7ch,77h,c5h,31h,d3h,52h
+			db	05h,43h,34h,65h,0ah,37h,aeh
+			ld	h,h
+			call	Lf855
+			dec	h
+			call	nz,L816c
+			ret	pe
+			ld	b,(hl)
+			ld	hl,5ed2h
+			dec	b
+			rlca
+			ld	l,e
+			ld	a,c7h
+			inc	bc
+			jp	(hl)
+			db	2fh,25h,79h,02h,ffh,3ah,9fh,1ah
+			db	d2h,d1h,f4h,44h,62h,fdh,80h,52h
+			db	6fh,51h,60h,3bh,66h,3ch,2bh,c8h
+			db	0ch,25h,57h,eeh,25h,38h,f9h,b5h
+			db	75h,98h,b4h,5bh,b2h,cfh,f1h,93h
+			db	66h,e8h
+			ld	h,b
+			sra	(hl)
+			or	b
+			ld	l,d
+			ld	b,c
+			ld	d,a
+			sbc	a,c
+			ld	(46beh),hl
+			ld	a,(hl)
+			sbc	a,l
+			ld	e,e
+			ld	a,(hl)
+			ret	nz
+			and	l
+			ld	e,a
+			jr	L48de
+			db	8dh,93h
+			ld	b,e
+			or	l
+			ld	(hl),a
+			pop	hl
+			ld	a,l
+			add	a,f8h
+			cp	b
+			ret	p
+			ld	l,c
+			ld	l,b
+			ld	(hl),a
+			adc	a,b
+			sub	h
+			sbc	a,l
+			ld	a,h
+			adc	a,a
+			or	d
+			pop	de
+			ex	de,hl
+			ld	c,63h
+			ld	l,(hl)
+			ld	c,d
+			nop (2x) *
+			jr	L48a9
+			db	ddh,30h,57h,7bh,e4h,b6h,bbh,b7h
+			rra
+			add	hl,bc
+			add	a,67h
+			ld	d,a
+			ld	a,h
+			jr	z,L487a
+			nop
+			xor	(hl)
+			ld	h,c
+			rst	38h
+			add	hl,bc
+			or	c
+			ccf
+			and	h
+			sbc	a,a0h
+			ld	e,(hl)
+			and	a
+			add	a,b
+			xor	d
+			rla
+			ld	bc,6544h
+			push	af
+			inc	hl
+			add	a,a
+			ld	d,(hl)
+			or	a
+			push	af
+			ld	b,l
+			sub	b
+			jr	z,L48b3
+			ld	c,l
+			jp	po,L8202
+			ex	(sp),hl
+			rst	38h
+			and	e
+			ld	hl,(8f5ah)
+			and	(hl)
+			inc	a
+			ld	bc,4c31h
+			ld	h,(hl)
+			ld	d,e
+			cp	(hl)
+			xor	(hl)
+			dec	l
+			ld	(de),a
+			cp	c
+			ld	(hl),d
+			and	70h
+			cp	(hl)
+			sub	h
+			inc	de
+			ld	(hl),e
+			jr	L48d2
+			db	34h,2eh,aah,1ch,4ah,89h,4dh,dch
+			db	c1h,80h,9ch,5dh,67h,64h,72h,f2h
+			db	ddh,53h,9dh,cbh,96h,f2h,f2h,a3h
+			db	3fh,3ch,17h,75h,95h,b2h,88h,44h
+			db	03h,a6h,c0h,74h,65h,23h,a3h,09h
+			db	91h,d4h,02h,35h,edh,a2h,63h,54h
+			db	3bh,ach,39h,5ch,12h,c2h,9eh,7eh
+			db	c9h,f4h,0eh,47h,8ch,1fh,c8h,12h
+			db	ech,94h,cah,4fh,14h,bch,e0h,2eh
+			db	6ch,94h,c8h,d2h,b1h,a5h,62h,eeh
+			db	24h,bdh,4ah,00h,eah,34h,1fh,6eh
+			db	76h,b6h,d3h,b6h,83h,a4h,a5h,73h
+			db	5fh,54h,8fh,adh,abh,aah,06h,5ch
+			db	deh,dah,bah,63h,e9h,32h,cch,40h
+			db	deh,2bh,61h,21h,a2h,07h,5eh,01h
+			db	43h,aeh,ffh,b2h,9bh,c3h,5eh,4ch
+			db	5bh,a9h,adh,e4h,2dh,85h,a2h,69h
+			db	d9h,5fh,53h,e4h,25h,23h,03h,33h
+			db	c7h,04h,35h,f7h,36h,eah,93h,f4h
+			db	5eh,e5h,96h,f3h,74h,f8h,bch,e8h
+			db	d7h,e5h,53h,cch,d5h,b9h,3fh,f5h
+			db	06h,b1h,bah,f4h,93h,afh,37h,e8h
+			db	72h,20h,d7h,17h,4bh,0bh,deh,58h
+			db	87h,b7h,96h,ech,96h,0eh,36h,3bh
+			db	94h,0ah,35h,eeh,63h,d0h,bch,7fh
+			db	e3h,c3h,59h,87h,d6h,47h
+			ld	hl,(fb23h)
+			ld	d,l
+			ld	h,a
+			ld	l,l
+			call	L543e
+			sub	c
+			rrca
+			ld	d,a
+			sub	d
+			dec	a
+			dec	(hl)
+			and	d
+			add	a,b
+			ld	a,(de)
+			ld	b,e
+			out	(cch),a
+			dec	hl
+			ld	b,h
+			pop	bc
+			jr	c,L4a07
+			jp	m,Lb9cb
+			adc	a,a
+			rst	18h
+			ld	c,h
+			ld	e,6ch
+			ld	c,c
+			ld	h,l
+			ld	b,e
+			ex	de,hl
+			ld	sp,e603h
+			ld	a,f9h
+			ld	h,e
+			or	c
+			exx
+			ld	b,b
+			ld	h,b
+			ld	h,l
+			add	a,h
+			ld	l,b
+			ld	e,c
+			xor	b
+			rst	38h
+			ld	(hl),19h
+			xor	l
+			pop	hl
+			jp	nz,L3e64
+			inc	bc
+			ld	c,a
+			ld	a,l
+			adc	a,l
+			jp	nz,L9b17
+			ld	l,c
+			ret	po
+			jp	m,Lfd1e
+			jr	c,L49ef
+			ld	h,d
+			sub	c
+			ld	d,(hl)
+			and	c
+			ld	l,c
+			sub	d
+			ld	l,d
+			or	77h
+			ld	b,b
+			rrca
+			ld	(37d9h),a
+			and	l
+			ld	c,18h
+			ret	c
+			call	nc,Lb263
+			adc	a,h
+			ld	a,(bc)
+			add	a,e
+			ld	d,34h
+			call	nz,Lb48b
+			ld	e,l
+			ret	m
+			dec	d
+			jp	p,Lff96
+			pop	de
+			jr	z,L49d3
+			ld	h,c
+			rst	30h
+			dec	h
+			sub	(hl)
+			ld	l,l
+			jr	L4a69
+			db	b9h,05h,7ah,a4h,b8h,58h,54h,13h
+			db	f8h,7dh,c3h,59h,ebh,6dh,f5h,42h
+			db	1ch,24h,a1h,ceh,51h,42h,c1h,c1h
+			db	bdh,e7h,93h,d0h,41h,36h,8ch,1eh
+			db	88h,1bh,a1h,edh,15h,68h,85h,2ah
+			db	68h,d1h,86h,13h,aah
+			xor	c
+			call	z,L2f91
+			ld	h,h
+			add	a,l
+			ld	b,e
+			jp	m,L1495
+			sub	e
+			inc	b
+			add	hl,sp
+			adc	a,l
+			ld	b,b
+			cp	c
+			jr	nc,L4ad1
+			ld	bc,1886h
+			jp	nc,Ld0b6
+			ld	l,b1h
+			pop	bc
+			ld	h,(hl)
+			dec	b
+			ld	d,(hl)
+			call	c,L34f8
+			dec	e
+			ex	(sp),hl
+			ld	d,a
+			inc	d
+			xor	l
+			ld	e,(hl)
+			ld	(hl),l
+			ld	e,e
+			ld	bc,2afdh
+			ld	l,d
+			inc	(hl)
+			ret	c
+			cp	d
+			rst	30h
+			ld	h,b
+			and	l
+			cp	(hl)
+			ld	a,a
+			jp	z,L46cb
+			in	a,(9fh)
+			sub	d
+			sbc	a,d
+			ld	h,(hl)
+			ld	b,d
+			or	d
+			dec	l
+			call	po,L759d
+			sbc	a,d
+			inc	b
+			dec	c
+			inc	c
+			ld	c,d
+			ld	(hl),h
+			dec	hl
+			and	d
+			xor	a
+			sbc	a,l
+			rst	28h
+			add	a,h
+			ld	l,(hl)
+			ld	l,l
+			ld	h,e
+			and	d
+			adc	a,e
+			cp	c
+			jp	z,L369d
+			ret	pe
+			ld	hl,fe4fh
+			add	a,a
+			ld	(hl),h
+			ret	nc
+			call	z,L8973
+			ld	e,h
+			add	a,c
+			rst	28h
+			ld	hl,04e0h
+			or	(hl)
+			inc	d
+			call	pe,Lccfb
+			ret	nc
+			ld	a,73h
+			ld	de,13b1h
+			jp	pe,Lbc37
+			ld	h,a
+			ld	(hl),d
+			and	(hl)
+			jr	z,L4b0e
+			ld	hl,(3322h)
+			and	(hl)
+			ld	sp,82c7h
+			add	a,l
+			add	a,l
+			ld	l,a
+			jp	c,Ladcf
+			ld	a,c
+			inc	sp
+			adc	a,(hl)
+			xor	a
+			and	e
+			ld	h,(hl)
+			jp	pe,L3722
+			ld	d,5ch
+			or	e
+			ld	a,(bc)
+			ld	e,(hl)
+			ld	l,b
+			jp	c,L2194
+			rst	08h
+			ld	d,e
+			cp	c
+			add	a,b
+			adc	a,a
+			or	(hl)
+			ld	hl,cf39h
+			ret	z
+			inc	bc
+			ld	h,d
+			add	a,l
+			ld	hl,35e4h
+			and	e
+			ex	(sp),hl
+			ld	(hl),b
+			xor	1ah
+			rra
+			ld	a,(75d3h)
+			dec	(hl)
+			jp	(hl)
+			db	dbh,fch,84h,51h,7eh,7eh,2ah,52h
+			db	32h,cbh,21h,1eh,39h,06h,3bh,b4h
+			db	90h,deh,b1h,ddh,80h,3ah
+			ld	e,l
+			ret	nc
+			or	a
+			add	a,d
+			rst	20h
+			inc	a
+			rst	18h
+			jp	nz,L8cfb
+			jp	m,L8d4a
+			cp	d
+			ld	a,(de)
+			pop	hl
+			rst	18h
+			sbc	a,a
+			or	b
+			or	c
+			jr	c,L4afc
+			ld	c,c
+			sub	b
+			add	a,l
+			adc	a,(hl)
+			ld	sp,hl
+			push	hl
+			sub	h
+			ex	de,hl
+			sbc	a,l
+			inc	a
+			add	a,(hl)
+			add	a,l
+			xor	e
+			ld	l,c
+			dec	c
+			rla
+			ld	h,c
+			ld	a,d
+			or	d
+			ld	sp,170fh
+			add	hl,hl
+			sbc	a,b
+			nop
+			jp	nz,Lb024
+			xor	h
+			ld	e,b
+			ld	a,a
+			call	c,L1fce
+			jp	(hl)
+			db	62h,e8h,69h,4bh,30h,b2h,b0h,e9h
+			db	dah,c4h,49h,08h,78h,45h,adh,35h
+			db	a1h,9bh,f1h,59h,7fh,bch,e1h,84h
+			db	51h,b1h,cdh,92h,aah,f6h,dbh,adh
+			db	70h,bch,dbh,53h,29h,66h,19h,89h
+			db	f1h,50h,19h,62h,3eh,e2h,97h,b8h
+			db	2bh,65h,d2h,63h,67h,5dh,e9h,92h
+			db	18h,1dh,d5h,44h,0fh,b4h,01h,1bh
+			db	73h,8eh,23h,71h,a6h,28h,d4h,2dh
+			db	91h,aah,bdh,9dh,52h,c0h,b9h,77h
+			db	c7h,b0h,7ch,a1h,62h,5ch,c9h,ffh
+			or	l
+			ld	de,cc7fh
+			and	(hl)
+			dec	c
+			ld	e,c
+			add	hl,hl
+			dec	a
+			ld	d,e
+			jp	(hl)
+			db	0dh,50h,fah,eah,28h,e6h,ach,e5h
+			db	36h,ffh,5bh,22h,79h,30h,16h,63h
+			db	15h,f7h,f9h,b5h,e6h,74h,2dh,61h
+			db	27h,4fh,5ah,adh,4ch,c5h,75h,95h
+			db	93h,00h,e8h,9ch,00h,ebh,83h,a2h
+			db	22h,54h,b1h,dch,82h,80h,dfh,93h
+			db	4ch,bch,bdh,e6h,e8h,4dh,feh,cdh
+			db	eah,40h,43h,2ch,5bh,49h,43h,04h
+			db	c7h,feh,52h,4ah,52h,61h,ddh,96h
+			db	14h,25h,c2h,ebh,25h,62h,f1h,e9h
+			db	92h,ceh,9bh
+			rlca
+			ld	d,l
+			ld	d,c
+			ld	a,h
+			adc	a,20h
+			and	d
+			dec	bc
+			call	pe,L5a1c
+			ld	l,c
+			sub	d
+			scf
+			xor	a
+			add	a,a
+			and	b
+			call	m,Lcae5
+			call	nc,L556f
+			ld	b,c
+			ld	h,b
+			and	b
+			and	c
+			jp	(hl)
+			db	fch,9ch,28h,a1h,29h,f3h,74h,24h
+			db	6eh,7ch,a8h,e5h,8eh,d1h,6eh,d0h
+			db	34h,57h,c6h,62h,d9h,3ch,edh,7fh
+			db	d4h,bbh,46h,7ah,ech,24h,8fh,79h
+			db	cch,7bh,4bh,d9h,cah,8eh,85h,abh
+			db	2dh,42h,82h,bdh,10h,89h,89h,eah
+			db	b3h,73h,9dh,16h,6ch,f7h,80h,d3h
+			db	5eh,33h,47h,0ch,1dh,9ah,88h,19h
+			db	a8h,33h,dah,9eh,7ch,b5h,4fh,3ch
+			db	feh,d8h,90h,cch,7fh,edh,58h,5dh
+			db	edh,12h,9eh,92h,60h,7dh,14h,40h
+			db	a9h,16h,8bh,bah,46h,84h,65h,9eh
+			db	3ch,eeh,a7h,67h,8ch,3bh,0ah,4eh
+			db	ceh,18h,bbh,96h,deh,a5h,d7h,0bh
+			db	abh,dfh,82h,aah,1fh,10h,dch,95h
+			db	7dh,c3h,5bh,1ah,9ch,dch,f2h,cfh
+			db	ffh,68h,3ah,4bh,9dh,f9h,91h,90h
+			db	fdh,eeh,b7h
+			ld	h,e
+			sbc	a,(hl)
+			dec	d
+			and	d
+			ld	d,b
+			inc	c
+			rst	10h
+			ld	h,h
+			dec	hl
+			rst	08h
+			dec	(hl)
+			sub	l
+			ld	(hl),h
+			ld	a,(hl)
+			cp	e
+			or	e
+			ld	c,l
+			and	b
+			ret
+			db	e2h,b8h,48h,e8h,3fh,c3h,70h,60h
+			db	f6h,feh,fah,03h,b4h,57h
+			inc	e
+			jr	nz,L4cd1
+			xor	d
+			ld	a,e
+			adc	a,b
+			ld	h,(hl)
+			ld	b,b
+			dec	a
+			ld	(hl),7bh
+			sbc	a,f3h
+			call	m,L6ca8
+			cpl
+			ld	(hl),a
+			rrca
+			ld	b,b
+			ret	pe
+			pop	hl
+			nop (2x) *
+			di
+			ld	a,h
+			ld	c,(hl)
+			exx
+			add	hl,hl
+			ld	(hl),b
+			adc	a,l
+			inc	h
+			ld	d,c
+			ld	(hl),01h
+			ld	(hl),e
+			ld	e,d
+			rra
+			sub	b
+			ld	e,h
+			or	h
+			ld	d,(hl)
+			add	ix,sp
+			dec	(hl)
+			djnz	L4d6b
+			cp	2dh
+			ld	l,a
+			adc	a,h
+			rst	08h
+			ld	hl,2486h
+			jr	nz,L4d13
+			ccf
+			ld	(0874h),hl
+			and	d
+			ld	l,h
+			inc	c
+			ld	a,e
+			rra
+			adc	a,e
+			ld	e,l
+			push	de
+			ld	l,b
+			inc	d
+			or	b
+			ret	m
+			cp	c
+			add	hl,sp
+			rst	18h
+			ld	a,(c819h)
+			ld	sp,a1d3h
+			ld	e,(hl)
+			ld	a,(7c85h)
+			ld	d,b
+			ld	(hl),a
+			jr	nz,L4d5b
+			ld	l,a
+			sbc	a,h
+			dec	b
+			ex	af,af'
+			or	b
+			ld	l,c
+			ex	(sp),hl
+			halt
+			ret	nc
+			sub	c
+			dec	de
+			or	b
+			call	nc,L4b34
+			cp	l
+			jp	z,L34b7
+			rst	10h
+			or	a4h
+			ld	a,b
+			cp	h
+			ld	(hl),c
+			jp	po,L1c98
+			ld	a,c
+			jp	nz,Le38f
+			add	hl,de
+			sbc	a,57h
+			ld	b,a
+			inc	de
+			ld	d,c
+			dec	sp
+			jr	nc,L4d91
+			ld	e,a
+			ld	d,d
+			call	po,L3516
+			adc	a,b
+			ld	l,b
+			ld	a,e
+			add	hl,hl
+			inc	a
+			and	96h
+			ld	(hl),d
+			rlca
+			sbc	a,e
+			ret	p
+			res	4,d
+			ld	b,b
+			dec	d
+			ld	(hl),b
+			ld	c,b
+			ld	e,d
+			jp	po,L3840
+			ret	z
+			rst	20h
+			inc	l
+			ld	c,d
+			ld	a,(de)
+			and	a
+			or	l
+			and	a
+			ld	c,c9h
+			in	a,(41h)
+			cp	e
+			ret	nz
+			ret	nc
+			or	(hl)
+			ld	c,8bh
+			bit	2,a
+			ei
+			jp	pe,L5df2
+			add	hl,de
+			ld	h,(hl)
+			call	m,L6c67
+			dec	de
+			or	(hl)
+			ret	m
+			ret	pe
+			dec	a
+			ld	l,c
+			xor	b
+			ld	e,d
+			call	pe,L8cd2
+			dec	hl
+			ret	p
+			rst	18h
+			ld	a,e
+			cpl
+			sbc	a,l
+			or	l
+			add	a,ach
+			ld	(hl),l
+			jp	L5880
+			db	64h,97h,fbh,07h,dfh,22h,8dh,57h
+			db	6fh,a4h,dbh,41h,e6h,c0h,1ah,98h
+			db	2ah,f9h,98h,7eh,48h,afh,28h,9bh
+			db	4eh,3fh,11h,5ch,6bh,d9h,ach,edh
+			db	a2h,e9h,a6h,a3h,b1h,62h,c8h,e0h
+			db	51h,a8h,61h,01h,f0h,e3h,dah,60h
+			db	03h,10h,49h,85h,69h,c8h,fah,50h
+			db	f6h
+			pop	de
+			ld	h,a
+			sub	e
+			daa
+			ld	l,(hl)
+			xor	d
+			ld	b,(iy + 5bh)
+			xor	a
+			xor	d
+			ld	h,bah
+			nop (2x) *
+			pop	bc
+			inc	b
+			ld	b,l
+			or	b
+			ld	d,a
+			sub	b
+			ld	c,h
+			ret	z
+			adc	a,c
+			add	hl,de
+			cp	cch
+			rst	30h
+			ld	c,h
+			ld	a,b
+			inc	l
+			cp	(hl)
+			pop	af
+			rst	20h
+			di
+			or	(hl)
+			call	z,L19e4
+			ret	nc
+			ld	(hl),b
+			jr	z,L4e20
+			add	a,l
+			ret	z
+			in	a,(7dh)
+			ld	b,a
+			ld	(hl),h
+			sub	a
+			inc	b
+			ld	a,(b59dh)
+			ld	c,a
+			sub	(hl)
+			ei
+			inc	bc
+			ret	z
+			or	b8h
+			ld	a,(bc)
+			ld	a,d
+			add	a,h
+			call	p,L660d
+			jp	(hl)
+			db	dbh,b5h,10h,42h,a6h,a7h,08h,b6h
+			db	ach,92h,dah,77h,2dh,c7h,2bh,01h
+			db	55h,b8h,9eh,ech,c3h,fbh,d8h,6ah
+			db	deh,9ah,08h,e4h,ach,64h,60h,b9h
+			db	10h,22h,b5h,f0h,3dh,abh,7eh,e1h
+			db	dbh,f7h,27h,76h,6bh,aeh,dbh,aeh
+			db	bah,05h,d6h,4eh,a7h,b2h,35h,a6h
+			db	fbh,feh,25h,0bh,1ch,55h
+			jp	z,L3114
+			ld	b,b
+			ret	c
+			sub	a
+			sbc	a,h
+			ld	h,l
+			ld	e,c
+			ld	a,(hl)
+			jr	nc,L4ebd
+			ld	a,(bc)
+			ld	a,(de)
+			and	a
+			bit	3,l
+			add	a,(hl)
+			rra
+			ld	l,a
+			ex	(sp),hl
+			inc	e
+			ld	c,a
+			jr	nc,L4ec9
+			ld	e,c
+			sbc	a,e
+			ex	de,hl
+			or	b
+			ld	h,e
+			jr	c,L4e1d
+			ld	a,(de)
+			jr	L4e77
+			db	66h,0fh,46h,8eh,a8h,b9h,ech,39h
+			db	62h,66h,06h,d0h,75h,81h,9dh,ach
+			db	cfh,3eh,1fh,07h,e0h,c2h,06h,cah
+			db	90h,2fh,d1h,50h,b2h,f9h,90h,6fh
+			db	4bh,23h,89h
+			or	a
+			ret	c
+			ld	(de),a
+			add	hl,hl
+			add	a,a
+			ld	e,h
+			add	a,b
+			call	po,Lce66
+			daa
+			call	z,Ld2ed
+			ld	d,2ah
+			add	a,62h
+			add	hl,bc
+			adc	a,d
+			or	a
+			sbc	a,b
+			ld	e,(hl)
+			ret	pe
+			jp	p,L85be
+			ld	e,d
+			or	e0h
+			ld	c,e
+			ld	(hl),d
+			ld	c,h
+			ld	a,9ch
+			ld	h,e
+			jp	c,L0759
+			ld	sp,hl
+			dec	b
+			ld	e,c
+			call	nc,La283
+			dec	b
+			call	po,L4a12
+			adc	a,(hl)
+			push	bc
+			cp	l
+			call	po,Ldab1
+			add	a,d
+			ld	l,b
+			push	af
+			ld	h,b
+			add	a,b
+			ccf
+			cp	d
+			ld	hl,c177h
+			rla
+			cp	8ah
+			ld	e,c
+			ld	(Lba9a),a
+			xor	2ah
+			sub	40h
+			ld	a,d
+			ld	b,a
+			rst	10h
+			ld	h,c
+			ld	c,h
+			sub	l
+			ld	e,7eh
+			inc	(hl)
+			ld	b,e
+			add	a,h
+			sbc	a,c
+			xor	a
+			rst	28h
+			jp	nc,L173e
+			ld	l,a6h
+			dec	a
+			ld	c,c
+			cp	e
+			out	(61h),a
+			rra
+			jp	(hl)
+			db	f7h,28h,47h,4ch,c2h,8fh,f4h,ddh
+			db	42h,f8h,85h,79h,adh,bfh,25h,a9h
+			db	35h,e9h,2bh,f1h,6ch,73h,4ch,eeh
+			db	f4h,88h,41h,61h,37h,39h,d9h,fbh
+			db	bbh,9bh,8dh,1dh,8ah,8fh,0dh,cch
+			db	a3h,8ch,56h,28h,d5h,00h,a2h,3ah
+			db	89h,beh
+			or	h
+			ld	a,b
+			sbc	a,a
+			jp	m,Lfdb0
+			ret	p
+			inc	e
+			ccf
+			ld	(hl),a
+			call	nz,Lab08
+			add	a,a
+			sbc	a,d0h
+			ld	a,l
+			ld	c,h
+			or	d
+			ld	e,b
+			ld	d,c
+			ld	e,c
+			ld	sp,445fh
+			ret	n
+			xor	(hl)
+			and	(hl)
+			ld	e,c
+			rst	38h
+			ld	e,5dh
+			rst	00h
+			add	a,d
+			or	a
+			jp	nz,Le2c2
+			ld	a,l
+			ld	e,b
+			ld	d,d
+			add	a,l
+			ld	a,l
+			push	hl
+			ld	a,b
+			ld	l,l
+			ld	d,a
+			ld	a,e2h
+			ld	a,(hl)
+			inc	d
+			pop	bc
+			inc	c
+			ld	l,c
+			ld	h,c
+			jp	c,L0011
+			scf
+			add	a,d
+			and	00h
+			ld	b,d
+			dec	sp
+			ld	a,l
+			ld	d,e
+			ld	a,(b696h)
+			ld	e,(hl)
+			nop
+			xor	h
+			cp	l
+			ld	c,a
+			in	a,(bdh)
+			xor	(hl)
+			and	c
+			adc	a,e
+			scf
+			ld	e,d
+			ret
+			db	14h,e6h,6ah,97h,2fh,bah,74h,0bh
+			db	3dh,e4h,b5h,e2h,23h,94h,b1h
+			ld	d,a
+			ld	a,fdh
+			ld	b,a
+			ld	d,(hl)
+			call	z,L4d2a
+			nop
+			pop	af
+			add	hl,hl
+			rra
+			and	h
+			ld	e,(hl)
+			ld	a,a
+			cp	(hl)
+			ld	c,(hl)
+			ld	de,cc25h
+			and	a
+			ld	a,e
+			and	(hl)
+			jp	La931
+			db	e1h,02h,88h,afh
+			ld	e,b
+			ld	h,h
+			sbc	a,h
+			ld	a,d0h
+			sub	e
+			out	(37h),a
+			adc	a,d
+			add	a,d
+			ld	h,h
+			ld	h,h
+			and	e
+			adc	a,7dh
+			dec	c
+			rlca
+			xor	(hl)
+			ld	c,l
+			ld	b,c
+			ret	c
+			and	a
+			ld	b,e
+			push	hl
+			ld	b,d
+			push	hl
+			call	c,Lf8de
+			ld	l,h
+			rst	18h
+			push	bc
+			sbc	a,71h
+			ld	d,62h
+			inc	e
+			or	(hl)
+			add	a,a9h
+			add	a,a
+			ld	l,(hl)
+			inc	a
+			ld	(hl),h
+			set	6,a
+			rst	28h
+			ld	a,h
+			pop	bc
+			sub	d
+			sub	h
+			ld	a,b
+			ex	(sp),hl
+			sub	e
+			ld	a,a
+			ld	(hl),h
+			sbc	a,e
+			xor	d
+			inc	hl
+			jp	z,L7934
+			sbc	a,d
+			ld	b,a
+			ld	c,c
+			ld	h,(hl)
+			ld	e,c
+			rra
+			jp	po,L8d02
+			and	d
+			adc	a,h
+			push	hl
+			sbc	a,l
+			sub	c
+			sub	a
+			cp	b
+			rst	20h
+			jr	L4ff0
+			db	0bh,30h,5fh,9eh,c7h,39h,efh,7ch
+			db	c7h,c5h,49h,18h,b7h,1fh,6eh,e3h
+			db	e5h,7eh,0ah,13h,b9h,9dh,ffh,ffh
+			db	7dh,82h,0eh,d2h,43h,e8h,14h,e2h
+			db	1bh,23h,27h,f6h,c9h,70h
+			and	b
+			add	hl,sp
+			and	d
+			ld	d,4dh
+			ld	(de),a
+			inc	e
+			rst	30h
+			jp	L59b0
+			db	ebh,01h,80h,2ah,7ch,1eh,41h,01h
+			db	47h,79h,eeh,e4h,12h,e0h,2eh,8eh
+			db	eeh,7eh,79h,83h,50h,4ch,89h,46h
+			db	20h,76h,d1h,4ch,6eh,6dh,97h,08h
+			db	96h,83h,ech,cah,b6h,4dh,77h,8eh
+			db	0dh,94h,9dh,19h,e6h,f3h,7fh,0bh
+			db	6bh,8dh,f2h,30h,44h,37h,07h,adh
+			db	18h,cch,69h,e7h,d2h,cbh,17h,00h
+			db	09h,36h,0eh,ach,9bh,e0h,22h,3ah
+			db	55h,f5h,92h,20h,cfh,9eh,14h,a8h
+			db	d0h,64h,0bh,11h,cch,1fh,62h,eeh
+			db	c7h,1ch,90h,97h,c2h,efh,e8h,a4h
+			db	c9h,c1h,8ch,8ch,0ch,cah,e6h,3ch
+			db	1eh,50h,e4h,91h,23h,13h,fdh,b7h
+			db	65h,97h,96h,c6h,4ch,f4h,1fh,38h
+			db	9bh,46h,1bh,95h,c8h,feh,65h,40h
+			db	2fh,b6h,adh,81h,32h,43h,71h,5ah
+			db	42h,83h,4ch,5ah,c5h,0eh,f5h,dch
+			db	8ah,1fh,c1h,8eh,2dh,c0h,c7h,22h
+			db	d6h,7ch,01h,79h,5ch,74h,e6h,3ch
+			db	f3h,64h,97h
+			ld	h,a
+			ld	h,h
+			ei
+			push	af
+			pop	af
+			ld	(hl),e
+			ld	(7dbdh),hl
+			inc	b
+			or	(hl)
+			call	nz,L67ad
+			sbc	a,d
+			cpl
+			jp	m,Le80c
+			ld	a,l
+			ld	(hl),b
+			inc	h
+			ld	a,(bc)
+			add	a,(hl)
+			inc	e
+			sbc	a,(hl)
+			dec	e
+			djnz	L512f
+			sbc	a,(hl)
+			ld	d,d
+			ld	(85d3h),hl
+			add	a,h
+			sbc	a,dbh
+			and	c
+			sub	e
+			cp	fbh
+			sub	h
+			ld	(82e3h),hl
+			ret	z
+			or	h
+			inc	b
+			adc	a,a
+			cp	b
+			ld	h,b
+			ld	e,l
+			ld	l,d
+			ld	a,a
+			jp	z,L664b
+			ld	e,e
+			halt
+			ld	a,h
+			add	a,a
+			dec	bc
+			call	c,L341b
+			ld	b,b
+			cp	d
+			sub	a
+			rra
+			daa
+			ret	po
+			ld	l,11h
+			djnz	L517c
+			ld	(hl),c
+			ld	(hl),d
+			ld	h,b
+			sbc	a,l
+			ld	bc,68feh
+			pop	de
+			ld	d,a
+			ret
+			db	27h,10h,67h,62h,64h,94h,edh,0ah
+			db	9ah,99h,86h,a7h,7ah,1eh,3fh,5eh
+			db	5ch,f2h,82h,5dh,0ah,afh,6ch,c0h
+			db	61h,88h,ach,e9h
+			ld	(hl),d
+			ret	z
+			sbc	a,e
+			inc	hl
+			ld	h,e
+			sbc	a,c
+			exx
+			call	nc,L71f1
+			pop	af
+			ex	(sp),hl
+			sub	c
+			ld	l,h
+			ld	l,h
+			and	c
+			ld	(hl),b
+			jr	c,L513c
+			dec	a
+			add	hl,hl
+			call	po,Lfdb6
+			jr	c,L51ea
+			pop	af
+			halt
+			ld	de,9769h
+			ld	c,c
+			dec	(hl)
+			ld	(hl),l
+			inc	hl
+			ret	pe
+			scf
+			sub	a
+			inc	sp
+			ld	a,(2badh)
+			ld	(ix + 82h),a
+			ld	(de),a
+			or	(hl)
+			dec	a
+			ld	e,eeh
+			xor	a
+			ld	h,e
+			dec	bc
+			push	bc
+			ld	(hl),h
+			ex	de,hl
+			ld	a,(6f5fh)
+			dec	d
+			inc	de
+			and	d
+			ld	h,a6h
+			ld	a,e
+			ret	pe
+			sbc	a,c
+			jp	nc,L6be4
+			ld	a,b
+			ld	c,d
+			adc	a,a
+			ret	nc
+			sub	9eh
+			rst	28h
+			ld	sp,hl
+			ld	e,c
+			cp	l
+			add	a,l
+			dec	l
+			ld	l,l
+			ld	sp,7c99h
+			inc	bc
+			ld	a,(hl)
+			ret	c
+			jp	z,L6890
+			ld	d,(hl)
+			ld	l,c
+			ld	d,b
+			ld	b,c
+			ld	(hl),c
+			inc	(hl)
+			or	d
+			jr	c,L51ee
+			cpl
+			ld	c,(hl)
+			dec	bc
+			or	d
+			cp	(hl)
+			ld	a,a
+			ld	h,d
+			rst	10h
+			ex	af,af'
+			sub	a
+			xor	d
+			ld	sp,3ce2h
+			cp	(hl)
+			cp	e
+			out	(73h),a
+			inc	(hl)
+			pop	de
+			sbc	a,l
+			and	2eh
+			add	a,a
+			or	b
+			ld	l,l
+			rst	20h
+			and	a
+			and	60h
+			sbc	a,c
+			or	(hl)
+			add	hl,hl
+			ret	c
+			rst	18h
+			sub	h
+			ld	a,d
+			or	l
+			exx
+			add	hl,de
+			ld	(de),a
+			ld	(hl),c
+			add	a,b
+			or	d
+			dec	l
+			pop	hl
+			ld	l,h
+			ld	e,l
+			jp	nc,L25ce
+			sbc	a,b
+			or	a
+			or	e
+			ld	h,e
+			rst	10h
+			rst	30h
+			ld	a,h
+			and	c
+			ld	d,l
+			rst	20h
+			ld	h,a
+			call	nz,L810e
+			ld	a,c
+			or	l
+			inc	h
+			in	a,(87h)
+			ld	hl,(e631h)
+			ld	e,h
+			ei
+			dec	h
+			ld	a,(hl)
+			or	e
+			add	a,(hl)
+			adc	a,b
+			add	a,b
+			or	h
+			call	L663b
+			ld	b,b
+			ld	b,c
+			ld	(hl),h
+			cp	(hl)
+			ld	e,d
+			inc	c
+			ld	hl,(L9bae)
+			ld	c,45h
+			rst	38h
+			ld	(hl),b
+			xor	b
+			rrca
+			dec	b
+			xor	c
+			ld	a,(4b11h)
+			rst	38h
+			jp	m,L39d8
+			inc	l
+			ld	(hl),l
+			dec	l
+			ret	pe
+			dec	d
+			ld	e,65h
+			ld	h,e
+			bit	7,d
+			ld	(6cd6h),hl
+			inc	hl
+			ld	d,c
+			pop	de
+			cpl
+			dec	de
+			ld	c,d
+			ld	c,(hl)
+			scf
+			ret	m
+			inc	hl
+			nop (2x) *
+			ret	pe
+			pop	bc
+			ret	nc
+			adc	a,e
+			jp	p,L1b94
+			adc	a,(hl)
+			ld	a,d
+			rst	08h
+			ld	l,99h
+			call	nc,L1fc0
+			ld	(hl),h
+			ld	a,(bc)
+			ld	e,c
+			or	(hl)
+			or	c
+			adc	a,(hl)
+			sub	a
+			adc	a,c
+			add	a,l
+			rst	28h
+			inc	h
+			ld	d,l
+			ld	h,l
+			sub	e
+			ld	(hl),l
+			ld	(hl),l
+			and	d
+			ld	e,65h
+			ld	l,c
+			sub	09h
+			sbc	a,f3h
+			and	35h
+			ld	b,e
+			or	c
+			inc	de
+			push	bc
+			ld	b,99h
+			ld	a,(de)
+			xor	h
+			ld	a,b
+			inc	d
+			rra
+			ld	e,e
+			rst	20h
+			or	b
+			push	bc
+			inc	(hl)
+			cpl
+			ld	(bc),a
+			sub	l
+			nop (2x) *
+			rst	10h
+			jr	nc,L52ad
+			xor	d
+			jp	p,L6b7d
+			sub	(hl)
+			rst	28h
+			ld	b,e
+			ld	b,(hl)
+			sub	b
+			xor	5eh
+			ld	a,a
+			and	(hl)
+			im	2
+			cp	d
+			sub	b
+			ret	nc
+			adc	a,b
+			call	L3c92
+			push	de
+			ex	de,hl
+			ld	a,(d44bh)
+			sbc	a,a
+			ld	hl,8f86h
+			ld	b,d
+			push	af
+			ld	(de),a
+			push	hl
+			jp	m,L1d7d
+			inc	a
+			add	a,h
+			cp	h
+			ld	d,2ch
+			rst	08h
+			or	e
+			ld	h,l
+			daa
+			dec	(hl)
+			in	a,(45h)
+			jp	nz,Lbc26
+			dec	a
+			rst	10h
+			call	nz,Lae32
+			and	e
+			adc	a,l
+			sbc	a,h
+			ld	b,bah
+			rst	10h
+			add	a,h
+			ld	a,(de)
+			jp	p,L0a8c
+			jp	L4496
+			db	8fh,ech,c8h,fah,7fh,3eh,6bh,e1h
+			db	7dh,48h,71h,77h,efh,5bh,33h,3eh
+			db	83h,58h,24h,bbh,5ch,d8h,64h,73h
+			db	f8h,77h,93h,54h,e0h,c4h,03h,6ch
+			db	0bh,5fh,12h,c7h,08h,6fh,cfh,72h
+			db	44h,87h,e0h,f2h,30h,60h,59h,dbh
+			db	efh,49h,68h,77h,42h,39h,bfh,eeh
+			db	05h,1eh,6dh,40h,2bh,53h,3dh,e0h
+			db	3fh,2dh,07h,78h,90h,c3h,21h,e1h
+			db	c1h,89h,01h,7eh,cfh,2bh,23h,95h
+			db	00h,a9h,eeh,41h,62h,1ah,7fh,4eh
+			db	67h,d8h,15h,23h,51h,23h,7fh,9eh
+			db	4eh,48h,88h,4eh,2dh,0dh,eah,87h
+			db	98h,69h,eeh,57h,8ah,27h,eah,abh
+			db	deh,b9h,fdh,08h,8eh,96h,0ch,bdh
+			db	08h,b2h,f1h,26h,57h,e1h,38h,87h
+			db	38h,9bh,01h,a7h,8bh,cbh,6bh,d2h
+			db	5eh,33h,c1h,bah
+			ld	b,h
+			inc	de
+			ld	e,l
+			call	m,L96cd
+			call	Lf2cc
+			ex	af,af'
+			dec	c
+			ld	l,95h
+			call	z,Ldad4
+			and	(hl)
+			cp	(hl)
+			ld	b,e
+			jp	pe,L0a6f
+			ld	e,d
+			ld	a,(bc)
+			sub	a
+			ld	c,c
+			jp	nc,L4d89
+			jr	nz,L53fe
+			rst	38h
+			rra
+			or	(hl)
+			call	m,L6554
+			ld	d,c
+			ld	l,h
+			and	h
+			ld	d,c
+			call	nc,Lbe87
+			ld	e,bch
+			ld	l,b
+			ld	b,b
+			ld	a,(hl)
+			ld	b,l
+			add	ix,ix
+			jp	(hl)
+			db	03h,0ch,6ah,06h,eeh,34h,63h,e9h
+			db	a4h
+			call	z,L1e86
+			adc	a,a
+			ld	(hl),05h
+			ld	h,d
+			ld	e,a
+			and	(hl)
+			ld	e,44h
+			ld	c,c
+			ld	a,18h
+			xor	a
+			ld	c,b
+			sbc	a,(hl)
+			inc	de
+			add	a,h
+			ld	a,b
+			ret	m
+			xor	d
+			push	de
+			di
+			jp	(hl)
+			db	67h,64h,a5h,fch,c7h,9dh,d9h,8fh
+			db	03h,24h,feh,f9h,95h,adh,46h,39h
+			db	97h,5eh,a9h,4dh,2ch,e3h,43h,3bh
+			db	f0h,e5h,f1h,99h,34h,90h,48h,19h
+			db	12h,ach,f4h,3ah,31h,33h,d6h,5bh
+			db	2eh,75h,4dh,b1h,32h,1ah,fah,9fh
+			db	14h,f0h,7fh,ddh,36h,eeh,bfh,82h
+			db	61h,1dh,97h,19h,2fh
+			ld	(de),a
+			jp	po,L419c
+			ld	l,77h
+			in	a,(cch)
+			adc	a,b
+			ld	(3530h),hl
+			ld	h,b
+			jr	nc,L53a8
+			ret	pe
+			ld	a,a
+			rrca
+			cp	l
+			ld	b,e
+			cpl
+			ret	po
+			jp	pe,L69bc
+			add	a,c
+			ret	m
+			sub	l
+			inc	a
+			add	a,7eh
+			sub	b3h
+			in	a,(b4h)
+			xor	b
+			cpl
+			ld	d,e
+			xor	e
+			ret
+			db	40h,55h,8ch,abh,64h,abh,bch,c1h
+			db	33h,97h,96h,87h,a9h,50h,05h,1dh
+			db	b9h,bdh,08h,a7h,dch,01h,43h,d7h
+			inc	h
+			cp	h
+			jp	nc,Le876
+			ex	af,af'
+			xor	c
+			cp	a
+			rst	08h
+			or	c
+			jp	m,L2240
+			rst	30h
+			sub	h
+			or	h
+			sub	c
+			ld	(hl),c
+			ld	(d61eh),a
+			jp	Le609
+			db	b6h,fah,2eh,36h,9bh,88h,f0h
+			jr	nz,L5479
+			or	l
+			ld	b,l
+			adc	a,b
+			sub	(hl)
+			sbc	a,h
+			sbc	a,(hl)
+			dec	h
+			jr	L5492
+			db	8ah,abh,8fh,20h,aah,51h,b3h,85h
+			db	bch,16h,00h,92h,c0h,20h
+			ld	d,e
+			cp	c
+			ld	l,h
+			ld	c,b6h
+			ret	z
+			cp	d
+			or	(hl)
+			or	a
+			adc	a,l
+			dec	bc
+			rra
+			dec	c
+			push	bc
+			call	nz,L29e1
+			and	07h
+			and	b
+			rrca
+			or	e
+			push	af
+			ret	m
+			adc	a,d
+			ld	b,h
+			ld	h,c
+			inc	hl
+			rra
+			dec	e
+			ld	c,b
+			ld	e,24h
+			nop (2x) *
+			and	d
+			out	(72h),a
+			jp	p,L15f9
+			dec	hl
+			call	nc,Lcd02
+			ld	b,a
+			ld	d,f2h
+			cp	a
+			ld	e,57h
+			or	d
+			or	(hl)
+			call	p,L5fb7
+			ld	c,c
+			inc	c
+			jp	nz,La36a
+			or	20h
+			ld	a,d
+			halt
+			ld	a,b
+			xor	e
+			jp	nz,L3889
+			ret	nc
+			ld	c,(hl)
+			inc	de
+			ld	(hl),h
+			djnz	L5521
+			ld	b,4eh
+			add	a,d0h
+			jp	pe,Le74d
+			sub	h
+			inc	h
+			sbc	a,89h
+			ld	hl,2005h
+			xor	(hl)
+			in	a,(ceh)
+			sub	5eh
+			sbc	a,b
+			call	nc,L5ec1
+			ld	d,e
+			jr	L5505
+			db	0ah,6bh,7ah,1eh,6ah,d2h,66h,81h
+			db	fch,7bh,f2h,e9h,d5h,72h,7eh,66h
+			db	bbh,3dh,e1h,8ah
+			adc	a,a
+			jp	pe,L3a16
+			ld	sp,hl
+			ld	l,h
+			or	c
+			add	a,ach
+			dec	de
+			ccf
+			sub	b
+			add	a,b
+			inc	h
+			ld	(hl),a
+			inc	e
+			ld	c,a
+			ld	(hl),a
+			dec	de
+			dec	d
+			ld	c,l
+			ld	b,h
+			adc	a,f5h
+			halt
+			ld	(hl),b
+			ld	e,c0h
+			and	a
+			add	hl,hl
+			ld	(hl),b
+			dec	bc
+			call	Lc1a2
+			sbc	a,b
+			in	a,(cch)
+			inc	d
+			ld	a,c
+			djnz	L5571
+			ld	(dd84h),a
+			ld	l,l
+			pop	af
+			set	6,(hl)
+			scf
+			rst	18h
+			cp	e
+			ld	l,a
+			ld	c,c
+			jp	nc,L46e7
+			rra
+			ld	h,c
+			add	hl,hl
+			ld	e,l
+			rst	10h
+			cp	a
+			sll	l
+			and	c
+			cp	d
+			ld	(36e3h),a
+			dec	h
+			inc	a
+			rlca
+			push	af
+			ld	(hl),d
+			inc	e
+			call	c,L6275
+			ld	e,h
+			cp	(hl)
+			ld	(hl),c
+			add	a,e
+			call	L0898
+			inc	d
+			ld	l,d
+			ld	(de),a
+			call	p,L957d
+			inc	h
+			rst	20h
+			and	b
+			ld	a,b
+			xor	e
+			or	l
+			inc	(hl)
+			scf
+			rla
+			call	po,Lfda0
+			ret	c
+			adc	a,d
+			sbc	a,a
+			ld	e,c
+			inc	a
+			ret	z
+			xor	(hl)
+			djnz	L5527
+			add	hl,bc
+			ld	a,a
+			ret	po
+			dec	e
+			add	a,l
+			pop	af
+			scf
+			jp	po,Lda6f
+			call	pe,L8dd2
+			ld	hl,9a94h
+			ld	h,d
+			jr	L55e1
+			db	80h,cdh,56h,98h,83h,ffh,c7h,62h
+			db	56h,74h,cah,8ch,dbh
+			add	a,h
+			jr	c,L5598
+			call	m,L16e7
+			sbc	a,b
+			inc	l
+			ld	a,(f31fh)
+			sub	e
+			ld	(hl),l
+			ld	(hl),c
+			ld	l,e
+			jp	z,L16a8
+			ld	d,d
+			add	a,b
+			ld	h,(hl)
+			ld	e,c
+			sub	c
+			and	(hl)
+			call	nc,L8e4c
+			ld	h,(hl)
+			sbc	a,h
+			ld	e,a
+			ld	e,e
+			ld	(de),a
+			or	a
+			sbc	a,55h
+			ld	l,e
+			adc	a,c
+			ld	a,(de)
+			call	m,La62d
+			pop	bc
+			inc	hl
+			out	(c),l
+			ld	b,a
+			cp	b
+			ld	h,d
+			ld	l,h
+			add	a,h
+			add	a,e4h
+			or	a
+			ld	a,(de)
+			ld	(de),a
+			add	hl,hl
+			ld	(hl),h
+			dec	l
+			ret	z
+			jr	nz,L562f
+			ei
+			and	b7h
+			rst	18h
+			add	a,l
+			or	c
+			ld	l,a
+			cp	d
+			and	a
+			or	d
+			and	l
+			sbc	a,l
+			xor	l
+			ld	a,h
+			add	a,b
+			ret	po
+			jp	p,L80e3
+			and	a
+			add	a,e
+			call	po,La9bd
+			ld	(hl),l
+			ld	bc,3c32h
+			cp	c
+			cp	c
+			ld	a,e
+			halt
+			ld	(hl),l
+			ld	c,h
+			inc	de
+			jr	L5661
+			db	33h,d6h,6ch,05h,a8h,eah,00h,a9h
+			db	b1h,9ch,f2h,e4h
+			inc	h
+			ld	hl,(be2bh)
+			ld	(hl),c
+			rst	18h
+			ld	d,a
+			or	a
+			jr	z,L55dd
+			ld	(hl),d
+			rst	08h
+			jp	L9df1
+			db	5bh,cfh,d0h,3ah,2dh,67h,6dh,54h
+			db	d8h,c1h,36h,b0h,c4h,52h,2bh,33h
+			db	b8h,85h,5eh,a1h,ebh,09h,e9h,18h
+			db	51h,7ah,9eh,e2h,ffh,d3h,c2h,86h
+			db	f2h,eeh,3ch,a8h,a1h,78h,17h,79h
+			db	89h,c8h,dfh,fch,44h,d5h,7ch,60h
+			db	afh,c0h
+			ccf
+			jr	z,L55ee
+			ld	a,(bc)
+			adc	a,a
+			ld	c,b
+			ld	c,85h
+			ret	nc
+			ld	d,e
+			ret	m
+			ld	l,a
+			ld	a,d
+			dec	l
+			ld	b,d
+			cp	d
+			add	a,d
+			inc	(hl)
+			adc	a,a
+			push	bc
+			ld	(hl),c
+			xor	c
+			inc	bc
+			ld	d,b
+			or	a
+			ld	d,d
+			jp	p,L47a5
+			ld	l,a
+			adc	a,c
+			ld	d,l
+			pop	hl
+			ld	a,(de)
+			call	nc,L6d46
+			ld	b,h
+			xor	c
+			ccf
+			ret	m
+			rla
+			sbc	a,a
+			add	a,l
+			ld	h,b
+			sub	ach
+			adc	a,c
+			ld	(hl),b
+			sbc	a,d
+			jp	z,L3fca
+			ei
+			adc	a,a
+			adc	a,c
+			ret	pe
+			ld	(hl),73h
+			xor	l
+			sub	h
+			ld	d,d
+			inc	de
+			ld	h,beh
+			sbc	a,a
+			inc	de
+			ld	h,5ch
+			ld	b,(hl)
+			ld	d,d
+			ret	pe
+			ret	m
+			ld	b,(iy + eeh)
+			jp	p,Lb428
+			dec	c
+			rst	08h
+			jp	nc,L92df
+			di
+			jp	po,L01af
+			or	h
+			ld	sp,3231h
+			call	c,L9e85
+			ld	c,8dh
+			ret	pe
+			sbc	a,03h
+			and	(hl)
+			add	a,e
+			ld	e,h
+			ld	l,b
+			call	p,L1433
+			cp	d
+			ld	h,(hl)
+			call	nc,Le026
+			ld	h,c
+			ld	(hl),d
+			ld	d,b
+			ld	a,b
+			nop
+			call	pe,Lc8f0
+			sbc	a,d
+			sub	d
+			ld	(de),a
+			jr	z,L56ae
+			jp	nc,L2aea
+			or	d
+			and	e
+			xor	d
+			exx
+			ld	c,l
+			add	a,(hl)
+			ld	(hl),a
+			ld	b,a
+			ld	c,8fh
+			add	a,42h
+			push	de
+			ex	af,af'
+			rrca
+			jr	L5727
+			db	7bh,edh,b5h,d4h,e9h,71h,57h,3ch
+			db	88h,79h,44h,b3h,bch,64h
+			cp	a
+			adc	a,(hl)
+			ld	de,edebh
+			dec	(hl)
+			ld	(b3cfh),hl
+			dec	b
+			ld	l,a
+			ld	sp,debbh
+			dec	l
+			nop (2x) *
+			or	c
+			halt
+			xor	l
+			rst	30h
+			ccf
+			and	h
+			ld	hl,(698eh)
+			inc	c
+			halt
+			add	hl,bc
+			jp	(hl)
+			db	b3h,53h,1ch,c4h,8ah,d8h,87h,a9h
+			db	32h,2eh,0ah,7ch,e3h,1ah,cah,36h
+			db	44h,c1h,adh
+			and	e
+			pop	af
+			add	a,72h
+			pop	de
+			add	a,b
+			cp	(hl)
+			adc	a,a
+			ld	c,c
+			ld	a,(de)
+			sub	d
+			cp	l
+			inc	b
+			ld	hl,(33dah)
+			dec	c
+			sub	c
+			sub	d
+			push	af
+			ld	(hl),h
+			push	hl
+			sub	e
+			jp	pe,Le322
+			ld	a,d
+			dec	hl
+			adc	a,b
+			cp	(hl)
+			ld	l,d
+			ld	de,f95bh
+			dec	de
+			ld	bc,126ah
+			nop (2x) *
+			ccf
+			ld	l,49h
+			ld	(hl),c
+			ld	hl,a4d8h
+			ld	d,l
+			call	nz,L8dad
+			ld	(bc),a
+			ret	nc
+			ld	hl,73c6h
+			ld	c,b
+			jp	nc,Lbbd8
+			inc	(hl)
+			ld	d,l
+			inc	bc
+			ld	d,c
+			adc	a,(hl)
+			ld	sp,hl
+			add	a,c
+			sbc	a,l
+			ld	h,l
+			exx
+			ld	a,(bc)
+			call	m,L6e27
+			nop (2x) *
+			sbc	a,(hl)
+			ld	c,5ch
+			call	p,L5236
+			sbc	a,a
+			ld	c,(hl)
+			nop
+			ld	a,h
+			dec	a
+			ld	e,a
+			push	hl
+			ld	l,b
+			add	a,74h
+			ld	e,(hl)
+			sbc	a,(hl)
+			sbc	a,a
+			adc	a,e4h
+			rlca
+			sub	7ah
+			call	nc,L9703
+			ld	(hl),b
+			xor	a
+			ld	c,e
+			jp	nc,L4fb7
+			dec	l
+			inc	(hl)
+			ld	bc,9a49h
+			adc	a,h
+			ld	sp,hl
+			jr	z,L5780
+			adc	a,c
+			sbc	a,b
+			cp	c
+			ld	a,fch
+			rst	08h
+			ld	b,h
+			cp	b
+			sub	e
+			or	e
+			rst	20h
+			ld	b,l
+			adc	a,h
+			ld	b,e
+			rst	10h
+			inc	h
+			ld	(hl),d
+			jr	nz,L57df
+			sub	c
+			xor	l
+			jr	z,L5797
+			sbc	a,l
+			pop	de
+			ld	a,d
+			sub	(hl)
+			jp	m,L02f6
+			add	a,e
+			dec	de
+			rst	08h
+			ld	h,d
+			ld	a,(de)
+			inc	de
+			ld	(hl),h
+			add	a,b
+			and	a
+			call	nc,L3eb7
+			pop	hl
+			ld	l,a
+			inc	a
+			call	po,Lb82c
+			add	a,e
+			ld	e,a
+			call	pe,Lce59
+			call	c,L2175
+			xor	d
+			ld	d,d
+			ld	sp,hl
+			and	c
+			add	hl,bc
+			ret	nc
+			ld	c,e
+			inc	c
+			sbc	a,a
+			cp	e
+			in	a,(fah)
+			and	l
+			cpl
+			djnz	L5764
+			add	hl,bc
+			cp	e
+			inc	l
+			ld	h,b
+			ld	h,a
+			daa
+			xor	e
+			cp	d
+			cp	(hl)
+			ld	l,e
+			ld	c,aah
+			cp	(hl)
+			ld	c,l
+			and	8ch
+			ex	af,af'
+			xor	c
+			ld	(hl),b
+			or	e
+			add	a,51h
+			add	a,h
+			push	bc
+			add	a,c
+			jp	nz,L8e2e
+			ld	c,h
+			add	hl,sp
+			sbc	a,a
+			call	m,L345a
+			and	a
+			ld	(f7deh),a
+			cp	c
+			dec	hl
+			xor	h
+			sbc	a,e
+			rlca
+			add	a,c
+			jr	L57aa
+			db	92h,58h,b1h,86h,99h,61h,b5h
+			rst	30h
+			ld	a,(de)
+			and	h
+			jp	c,Lc33d
+			ld	b,(hl)
+			ld	d,c
+			inc	d
+			adc	a,bdh
+			call	c,L462b
+			ld	(de),a
+			ld	h,h
+			add	a,b
+			rlca
+			ld	e,(hl)
+			ld	d,l
+			ccf
+			ld	c,d
+			dec	d
+			add	a,aah
+			adc	a,b
+			in	a,(81h)
+			call	z,L5e20
+			ld	sp,hl
+			rst	38h
+			ld	c,a
+			ld	b,l
+			cpl
+			ld	hl,011fh
+			adc	a,c
+			dec	c
+			xor	(hl)
+			ld	c,a
+			ld	(bc),a
+			adc	a,d
+			dec	bc
+			ld	c,a
+			ret	pe
+			ret	m
+			ld	c,c
+			xor	eah
+			add	a,d
+			ld	c,c
+			ld	(hl),e
+			sbc	a,e
+			ld	e,d
+			ret	nz
+			adc	a,(hl)
+			ld	d,d
+			and	a
+			ld	b,(hl)
+			or	c
+			dec	b
+			sbc	a,0bh
+			and	c
+			sbc	a,c
+			ei
+			ld	l,c
+			ld	d,e
+			add	hl,bc
+			rst	38h
+			ld	b,(hl)
+			ld	a,28h
+			inc	sp
+			dec	c
+			ret	z
+			ld	sp,d8c8h
+			sub	l
+			adc	a,b
+			ld	e,l
+			ret	nc
+			ret	pe
+			daa
+			call	c,Lf1a5
+			add	hl,bc
+			rst	38h
+			and	c
+			add	a,l
+			ld	c,a
+			ld	l,e
+			ld	l,(hl)
+			ld	c,f3h
+			ld	d,e
+			ld	d,b
+			add	a,l
+			xor	c
+			ld	a,e
+			sub	abh
+			ld	(efcdh),hl
+			inc	de
+			dec	c
+			inc	d
+			ld	l,d
+			ld	e,c
+			pop	af
+			ld	h,d
+			in	a,(8ah)
+			call	pe,Le8e0
+			adc	a,(hl)
+			in	a,(c2h)
+			ld	l,(hl)
+			add	hl,sp
+			or	d
+			sbc	a,a
+			and	c
+			and	c
+			call	nc,L9e0e
+			or	a
+			adc	a,(hl)
+			ld	e,4ch
+			add	a,08h
+			ld	(hl),e
+			ld	e,l
+			add	hl,sp
+			ld	d,l
+			rst	30h
+			ld	(hl),d
+			sbc	a,d
+			inc	bc
+			ld	de,a23dh
+			ld	d,d
+			ld	a,(hl)
+			ld	l,b
+			ld	c,d
+			add	a,d
+			ret
+			db	94h
+			ld	c,l
+			ex	af,af'
+			adc	a,l
+			ld	e,c
+			dec	bc
+			call	nc,L67d0
+			jp	(hl)
+			db	f0h,e5h,01h,65h,55h,01h,88h,96h
+			db	b7h,c2h,84h,3fh,a8h,4eh,80h,afh
+			db	9ch,e1h,feh,57h,e0h,a7h,48h,95h
+			db	dch,79h,afh,4bh
+			sbc	a,d
+			call	m,L5c67
+			add	hl,de
+			ld	h,8fh
+			daa
+			add	hl,bc
+			ld	sp,366bh
+			ld	(hl),e
+			nop (2x) *
+			adc	a,a
+			pop	hl
+			or	a
+			scf
+			sbc	a,a
+			add	hl,de
+			xor	d
+			ld	e,d2h
+			sub	f2h
+			rlca
+			ld	l,d
+			ld	e,h
+			xor	a
+			sub	b
+			or	e
+			ld	l,c
+			ld	b,a
+			ld	h,c
+			inc	d
+			ret	po
+			add	hl,sp
+			ld	e,d
+			adc	a,d
+			add	a,b
+			xor	h
+			ld	a,28h
+			ex	af,af'
+			sub	c
+			add	a,b
+			xor	(hl)
+			adc	a,5fh
+			jp	pe,Laf3c
+			add	a,a
+			ld	d,l
+			ld	a,a2h
+			jr	nz,L5894
+			ld	e,(hl)
+			jr	z,L588f
+			ld	d,d
+			ld	b,94h
+			rst	18h
+			or	b
+			cp	e
+			cp	e
+			ld	a,2bh
+			ld	e,h
+			add	a,h
+			rst	30h
+			ld	(hl),h
+			ld	(hl),c
+			ld	hl,(2791h)
+			ld	b,00h
+			sbc	a,38h
+			sbc	a,a3h
+			ld	l,a2h
+			push	bc
+			ld	b,e
+			push	bc
+			ld	e,h
+			jp	nc,L9309
+			dec	l
+			sub	h
+			ld	c,c
+			pop	af
+			ld	hl,(b1a7h)
+			out	(06h),a
+			sbc	a,d
+			ld	h,l
+			inc	c
+			or	4bh
+			out	(7bh),a
+			ld	(de),a
+			and	h
+			dec	bc
+			daa
+			ld	l,(hl)
+			and	e
+			ld	l,(hl)
+			cp	h
+			nop (2x) *
+			ret	c
+			adc	a,e
+			ld	e,d
+			sub	e
+			sub	h
+			cpl
+			inc	e
+			inc	hl
+			jp	z,L5dd9
+			ld	(hl),l
+			in	a,(20h)
+			or	(hl)
+			inc	sp
+			inc	sp
+			ld	d,b
+			ld	b,l
+			inc	b
+			rra
+			ld	b,l
+			ld	c,l
+			and	a
+			rrca
+			call	L1c71
+			jr	nc,L595b
+			sub	e
+			dec	b
+			sbc	a,b
+			call	nz,La839
+			adc	a,h
+			ld	a,l
+			ld	b,bfh
+			adc	a,2fh
+			add	hl,de
+			ret	pe
+			dec	c
+			call	pe,L344d
+			inc	c
+			jp	nc,La78e
+			or	d
+			and	h
+			dec	de
+			ld	b,(hl)
+			xor	d
+			ret
+			db	96h,fbh,7ah,f0h,cah,1bh,e5h,3bh
+			db	cbh,7bh,26h,41h,a0h,8dh
+			ex	af,af'
+			xor	e
+			adc	a,h
+			ld	a,e
+			ld	l,b
+			ret	nc
+			ld	e,h
+			dec	a
+			rla
+			jr	nz,L5959
+			or	h
+			ld	c,b
+			ex	(sp),hl
+			rst	00h
+			ld	d,h
+			ld	d,a
+			jp	m,Lbf76
+			ld	b,ebh
+			rst	00h
+			push	hl
+			ld	l,b
+			call	m,L3188
+			rla
+			ld	(hl),h
+			ld	(hl),l
+			ld	e,c
+			dec	hl
+			sub	e
+			sub	b
+			ld	c,c
+			jp	nz,L8bae
+			ld	b,e
+			sub	c
+			sbc	a,b
+			dec	b
+			jr	nc,L59d6
+			ld	d,l
+			dec	b
+			cpl
+			cp	b
+			di
+			ld	a,c
+			ld	(hl),29h
+			ld	hl,(70b9h)
+			jr	nz,L59a2
+			add	hl,sp
+			ld	h,(hl)
+			dec	d
+			ld	e,e
+			and	c
+			dec	a
+			call	L6311
+			jp	c,Ld9a3
+			ld	hl,(c95bh)
+			and	c
+			ld	(de),a
+			rst	28h
+			push	af
+			cpl
+			daa
+			adc	a,d
+			sub	(hl)
+			nop
+			ld	e,(hl)
+			sbc	a,(hl)
+			ld	e,7ch
+			ret	nc
+			scf
+			jr	nz,L598b
+			dec	b
+			ld	h,edh
+			dec	a
+			ld	a,e
+			ld	(hl),9fh
+			ld	h,0ah
+			add	a,e
+			ld	a,b
+			xor	ffh
+			or	a
+			ei
+			djnz	L5962
+			add	hl,bc
+			inc	h
+			ld	a,e
+			ld	c,h
+			ret	c
+			add	hl,hl
+			ld	e,(hl)
+			ld	e,l
+			ld	(hl),d
+			jp	p,L97cf
+			push	de
+			rst	08h
+			xor	d
+			ld	c,l
+			pop	af
+			ex	(sp),hl
+			rst	00h
+			ld	a,h
+			dec	e
+			ld	e,e
+			sub	c
+			ld	a,h
+			add	hl,sp
+			halt
+			ld	c,e
+			ld	b,b
+			ld	sp,99a9h
+			jr	z,L5981
+			ld	(hl),e
+			adc	a,a
+			ret	nz
+			inc	d
+			ld	h,e
+			ld	a,(bc)
+			sub	l
+			ld	e,e
+			adc	a,c
+			ld	c,b
+			ld	e,l
+			rst	08h
+			rst	28h
+			ld	l,d
+			dec	(hl)
+			ld	(54c0h),hl
+			ld	a,a
+			add	a,d
+			inc	hl
+			add	a,b
+			adc	a,e
+			call	z,Le09f
+			dec	l
+			or	h
+			and	d
+			or	b
+			jp	Leeb0
+			db	94h,3fh,0fh,e8h,e9h,75h,85h,7dh
+			db	2ah,90h,c5h,24h,71h,c6h,d3h,3bh
+			db	88h,70h,04h,23h,28h,97h,0eh,4ah
+			db	8ah,4fh,24h,5ah,42h,a6h,86h,29h
+			db	02h,e6h,43h,21h,5fh,e7h,4eh,fah
+			db	c6h
+			dec	l
+			or	l
+			inc	bc
+			sbc	a,fah
+			call	c,Lacf4
+			and	l
+			daa
+			sbc	a,l
+			pop	de
+			ld	a,b
+			ld	l,l
+			ld	b,h
+			rst	18h
+			sbc	a,e
+			ld	(hl),69h
+			rst	10h
+			inc	hl
+			and	(hl)
+			or	(hl)
+			ex	af,af'
+			inc	l
+			ld	(hl),h
+			ld	h,l
+			ld	(hl),0eh
+			ld	h,(hl)
+			or	c
+			ld	b,b
+			call	pe,L46ee
+			inc	de
+			or	aeh
+			ld	b,47h
+			ccf
+			ld	e,(hl)
+			ld	b,85h
+			nop (2x) *
+			rra
+			inc	de
+			add	a,c
+			dec	(hl)
+			nop
+			ret	z
+			inc	h
+			ret	nc
+			ld	a,e
+			inc	l
+			nop
+			add	a,l
+			and	d
+			and	b
+			cp	d
+			or	c
+			di
+			ld	e,b
+			adc	a,h
+			xor	d
+			ld	a,(hl)
+			ld	c,a
+			inc	h
+			rrca
+			ld	b,l
+			sbc	a,c
+			ld	d,e
+			ld	l,a
+			ld	c,a
+			add	hl,bc
+			adc	a,h
+			rst	38h
+			rst	10h
+			ld	l,h
+			xor	02h
+			ld	e,93h
+			ld	h,c
+			sub	(hl)
+			inc	l
+			xor	a
+			out	(ech),a
+			ld	h,d
+			call	po,Lf519
+			rst	00h
+			inc	e
+			inc	hl
+			cp	l
+			sub	d
+			add	a,7eh
+			cp	l
+			ld	a,e
+			inc	a
+			ld	d,b
+			call	z,Lfa84
+			ret	m
+			halt
+			sub	d
+			add	a,c
+			rst	08h
+			out	(e1h),a
+			jr	c,L5ad0
+			call	pe,Le2ee
+			rra
+			add	hl,bc
+			ld	b,h
+			ld	c,a
+			sbc	a,l
+			ld	h,c
+			dec	l
+			halt
+			ld	d,d
+			and	h
+			sbc	a,c
+			nop (2x) *
+			exx
+			pop	hl
+			ld	b,l
+			ld	a,h
+			call	p,L1206
+			ret	nz
+			ld	h,e
+			ret	c
+			ld	c,h
+			ld	a,e
+			and	d
+			rst	10h
+			ret	p
+			and	a
+			ld	b,06h
+			ld	d,b
+			ld	e,ebh
+			and	(hl)
+			cpl
+			exx
+			sub	c
+			ld	c,a
+			di
+			add	a,e
+			scf
+			sub	e
+			ld	c,9ah
+			ld	a,l
+			dec	hl
+			ld	(hl),h
+			xor	9fh
+			ld	c,(hl)
+			ld	d,c
+			jp	nz,L6832
+			ld	e,h
+			ld	a,(a15eh)
+			ld	a,a
+			add	hl,sp
+			ld	h,d
+			call	nz,L65e7
+			rst	18h
+			ret	po
+			add	a,d
+			ld	h,e
+			jp	c,L60a9
+			ret	m
+			ld	sp,hl
+			ld	c,e8h
+			and	e
+			call	nc,Lae5f
+			adc	a,c
+			ld	e,l
+			ld	(hl),a
+			daa
+			cp	h
+			ld	sp,hl
+			nop
+			call	nc,La8c1
+			di
+			ld	e,a
+			add	a,b
+			and	l
+			ld	b,ddh
+			pop	bc
+			ld	c,ech
+			jp	c,L46fe
+			ld	(bc),a
+			sbc	a,h
+			ld	(hl),e
+			inc	l
+			rst	08h
+			ld	a,a
+			call	z,L0f2c
+			jr	c,L5b60
+			ld	(hl),b
+			pop	de
+			sub	h
+			ld	e,c
+			ld	c,a
+			ld	a,b
+			ld	(hl),12h
+			ld	d,a
+			inc	de
+			di
+			ld	a,l
+			nop (2x) *
+			adc	a,b
+			adc	a,e
+			ret	pe
+			cp	c
+			cp	87h
+			rst	38h
+			di
+			sbc	a,d
+			and	d
+			ld	h,c
+			cp	c
+			jp	z,L90d9
+			ld	bc,75f2h
+			inc	l
+			ld	b,h
+			add	a,c
+			ld	e,d
+			and	h
+			ex	de,hl
+			ld	bc,f23eh
+			add	hl,hl
+			ld	l,36h
+			ld	e,d
+			ld	a,h
+			ld	d,h
+			ld	(de),a
+			adc	a,e
+			ld	b,e
+			cp	l
+			ret	z
+			jr	z,L5bc4
+			ld	c,45h
+			call	pe,L4fd5
+			inc	de
+			inc	c
+			sub	a
+			xor	l
+			ld	de,1e3dh
+			add	a,l
+			ld	h,a
+			adc	a,42h
+			call	m,L7799
+			ld	c,ceh
+			ret	nz
+			sbc	a,l
+			ld	d,c
+			ld	d,c
+			add	a,a
+			cp	45h
+			cp	d
+			ret	m
+			adc	a,b
+			ld	l,e
+			or	e
+			ld	a,h
+			add	hl,hl
+			dec	c
+			add	a,h
+			pop	bc
+			cp	d
+			inc	l
+			inc	h
+			ld	a,c
+			sub	52h
+			and	h
+			ld	h,(hl)
+			and	(hl)
+			xor	(hl)
+			ld	b,b
+			ld	(hl),l
+			ld	h,c
+			adc	a,b
+			out	(38h),a
+			ld	a,51h
+			rla
+			ld	b,h
+			add	a,l
+			add	a,e
+			ld	a,f4h
+			jr	L5b81
+			db	87h,0eh,58h,3fh,a0h,23h,c0h,8ch
+			db	fdh,c9h,4dh,25h,14h,09h,6ah,7dh
+			db	e8h,d5h,15h,62h,55h,6eh,cch,d0h
+			db	cfh,93h,a0h,b7h,e5h,aeh,ach
+			ex	af,af'
+			call	nc,Lffd9
+			rst	18h
+			ld	c,e
+			or	b
+			dec	bc
+			and	d
+			ld	sp,hl
+			jp	L5ab7
+			db	d4h,feh,72h,bfh,b4h,19h,01h,fbh
+			db	7dh,dch,23h,cdh,84h,53h,61h,5ah
+			db	33h,51h,e7h,21h,f8h,afh,0ch,2bh
+			db	e6h,23h,3bh,e1h,6ah,4ch,09h,57h
+			db	46h,74h,90h,4dh,beh,5bh,8ah,33h
+			db	34h,98h,14h,31h,7ch,9dh,09h,31h
+			db	aeh,93h,87h,7fh,7fh,02h,f2h,83h
+			db	23h,f2h,03h,75h,e2h,9ch,e8h,32h
+			db	2ah,b0h,96h,b6h,70h,e0h,e6h,21h
+			db	d0h,12h,0bh,4fh
+			push	af
+			xor	h
+			ld	c,h
+			ret	pe
+			in	a,(3fh)
+			sbc	a,b
+			ld	(hl),2fh
+			xor	h
+			halt
+			ld	b,h
+			sub	(hl)
+			dec	l
+			ld	d,l
+			ld	a,l
+			rst	18h
+			ld	l,d
+			dec	(hl)
+			ld	c,(hl)
+			sub	c
+			dec	bc
+			ld	b,l
+			ld	h,d
+			ret	po
+			sbc	a,b
+			ld	(hl),e
+			adc	a,d
+			jp	L4c2d
+			db	e1h,59h,0ah,58h,cbh,5eh,79h,d9h
+			db	02h,ffh,36h,2eh,0dh,e7h,afh,32h
+			db	63h,dbh,f0h,72h,64h,4eh
+			ld	a,c
+			ld	h,e
+			rra
+			xor	d
+			call	po,Lf378
+			ld	hl,af93h
+			ld	(hl),d
+			ld	d,e0h
+			xor	(hl)
+			ld	b,e
+			ld	h,e
+			dec	a
+			cpl
+			and	h
+			dec	l
+			sub	h
+			push	bc
+			adc	a,l
+			ld	h,h
+			dec	bc
+			ld	b,l
+			adc	a,l
+			call	m,L4e8b
+			call	nz,Le9e4
+			ld	b,7dh
+			ld	(hl),e
+			add	a,e
+			ld	de,0cach
+			xor	l
+			and	f2h
+			dec	(hl)
+			ld	h,d
+			and	22h
+			inc	bc
+			adc	a,a
+			ret	pe
+			inc	c
+			or	b
+			ld	b,l
+			and	78h
+			ld	d,c
+			cp	l
+			ld	h,c
+			ld	d,d
+			ld	c,a
+			ld	(hl),d
+			ld	sp,hl
+			ld	d,6ah
+			jp	po,Le578
+			ret
+			db	2ah,28h
+			cp	(hl)
+			or	c
+			cp	b
+			sub	c
+			sub	l
+			ld	hl,(9793h)
+			ret	nc
+			ret	z
+			jr	c,L5ce7
+			ld	c,d
+			adc	a,9ch
+			add	a,l
+			ld	a,l
+			ld	e,b
+			ld	(hl),a
+			cp	h
+			jr	L5c52
+			db	06h,c1h,56h,c4h,22h,77h,25h,56h
+			db	c1h,7bh,5bh,86h,4dh,4fh,15h,27h
+			db	c9h,b8h,50h,20h,2eh,c1h,e7h,6ch
+			db	fch,7ah,8ah,09h,81h,e6h,f8h,03h
+			db	20h,9eh,7ch
+			sub	b
+			adc	a,c
+			cp	c
+			adc	a,33h
+			nop (2x) *
+			ccf
+			and	l
+			or	a
+			add	a,d
+			and	2ah
+			ld	d,l
+			inc	sp
+			ld	d,b5h
+			jp	m,L472f
+			inc	l
+			ld	h,b
+			inc	(hl)
+			ld	l,b
+			ld	(hl),h
+			dec	b
+			add	hl,bc
+			ret	nc
+			ld	de,26a5h
+			ret	c
+			ld	c,l
+			ret	pe
+			and	l
+			ld	(hl),l
+			ret	p
+			daa
+			jp	z,L0945
+			dec	(hl)
+			ld	b,h
+			cp	l
+			add	a,a
+			exx
+			jp	nz,L9ef3
+			add	a,e
+			dec	l
+			adc	a,e
+			sbc	a,e
+			rlca
+			sub	h
+			and	1dh
+			adc	a,b
+			or	l
+			sub	c
+			ld	b,b
+			rst	20h
+			jp	z,L49c4
+			add	a,l
+			ld	d,h
+			in	a,(d7h)
+			dec	l
+			sub	a
+			ld	l,d
+			sbc	a,(hl)
+			ex	(sp),hl
+			ld	a,(bc)
+			dec	hl
+			daa
+			ld	(hl),c
+			dec	e
+			ld	d,(hl)
+			call	L87eb
+			dec	l
+			jr	L5ce1
+			db	bdh,4ah,6eh,30h,6eh,f6h,bbh,88h
+			db	90h,b3h
+			ld	h,d
+			adc	a,l
+			rst	28h
+			inc	c
+			ret	m
+			and	h
+			ld	b,a
+			rlca
+			rst	08h
+			in	a,(54h)
+			sub	c
+			sbc	a,3ch
+			jp	p,L9011
+			add	hl,de
+			ld	e,(hl)
+			add	hl,hl
+			or	85h
+			ld	de,ad75h
+			cpl
+			ret	c
+			adc	a,l
+			ld	sp,hl
+			add	a,f9h
+			ld	l,l
+			ld	h,c
+			dec	l
+			ld	(hl),l
+			ld	(bc),a
+			and	l
+			sbc	a,a
+			jp	po,L483e
+			and	c
+			rst	18h
+			and	b
+			jp	c,L68c3
+			ld	(de),a
+			cp	e
+			sbc	a,c
+			rst	30h
+			sbc	a,e
+			pop	hl
+			dec	sp
+			and	a
+			add	a,a
+			ld	e,70h
+			sub	f3h
+			call	z,L824d
+			ld	h,bfh
+			or	(hl)
+			pop	de
+			out	(5fh),a
+			ld	d,a
+			dec	l
+			ld	c,c
+			ld	d,h
+			dec	h
+			ld	e,l
+			sub	(hl)
+			add	a,(hl)
+			or	ech
+			ld	e,h
+			ld	(de),a
+			or	b
+			ld	b,e
+			ld	l,b
+			adc	a,63h
+			ld	h,e
+			or	l
+			or	c
+			ld	b,ddh
+			xor	e
+			jr	nc,L5d90
+			sbc	a,a
+			sbc	a,a
+			or	b
+			sbc	a,(hl)
+			ld	l,d
+			ld	l,l
+			adc	a,d
+			ld	l,h
+			ld	hl,4f6fh
+			ret	pe
+			call	L3a12
+			rlca
+			ld	e,h
+			rrca
+			jp	nc,L3e94
+			push	hl
+			ld	(hl),d
+			ret	p
+			ld	l,h
+			ld	h,h
+			adc	a,d
+			dec	l
+			xor	d
+			inc	bc
+			adc	a,h
+			sbc	a,l
+			ld	b,e
+			jp	m,Ld8c2
+			ld	a,a
+			sbc	a,d
+			ld	(hl),e
+			add	hl,bc
+			ld	(hl),b
+			ld	(bc),a
+			inc	c
+			or	a
+			ret	nc
+			ld	(de),a
+			xor	l
+			dec	c
+			ld	a,l
+			ld	e,c
+			ld	(hl),d
+			ld	c,(hl)
+			jp	L44e8
+			db	d1h,8ah,96h
+			ld	h,h
+			add	a,(hl)
+			and	l
+			dec	hl
+			call	c,L8b3b
+			rst	00h
+			sbc	a,(hl)
+			nop
+			ret	p
+			ld	l,l
+			ld	b,c
+			ld	c,l
+			jr	L5db9
+			db	86h
+			ld	e,87h
+			and	e
+			jr	L5de1
+			db	2bh,0eh,5dh
+			ld	c,a
+			ld	h,c
+			xor	l
+			inc	(hl)
+			inc	hl
+			out	(30h),a
+			ld	e,l
+			or	a
+			ld	c,(hl)
+			ld	e,e
+			cp	h
+			ld	(hl),e
+			rrca
+			ccf
+			pop	hl
+			add	a,l
+			cp	c
+			adc	a,h
+			ld	d,b
+			nop (2x) *
+			jp	z,La510
+			ld	a,(206fh)
+			add	a,c
+			sbc	a,b
+			ld	a,a6h
+			sbc	a,(hl)
+			jp	c,L336b
+			ld	c,c
+			cp	3dh
+			sbc	a,b
+			jr	c,L5e41
+			sbc	a,c
+			rra
+			scf
+			adc	a,c
+			cp	b
+			ld	sp,6106h
+			nop (2x) *
+			ret	po
+			ld	h,h
+			ld	c,e
+			cp	e
+			ld	e,h
+			add	a,e
+			add	hl,hl
+			ld	sp,hl
+			jr	nc,L5e82
+			ld	(hl),24h
+			adc	a,41h
+			res	2,a
+			or	d
+			rst	10h
+			inc	de
+			inc	e
+			adc	a,l
+			ld	c,(hl)
+			or	b
+			xor	c
+			cp	a
+			ld	l,c
+			sub	a
+			set	1,b
+			sbc	a,d
+			ld	b,c
+			ld	(42abh),a
+			ld	d,h
+			sub	bbh
+			ld	h,e
+			jp	(hl)
+			db	b6h,6fh,26h,3fh
+			ld	a,l
+			sbc	a,h
+			di
+			ld	d,b
+			and	b
+			ld	b,a
+			ld	l,d
+			ld	hl,a00ah
+			call	pe,Lc185
+			ret	nz
+			rst	28h
+			dec	a
+			ld	l,(hl)
+			inc	e
+			ld	b,d
+			push	de
+			add	a,b
+			and	1ch
+			ld	c,b
+			ld	e,d
+			ret	nz
+			pop	bc
+			ld	iyh,e *
+			ld	(hl),e
+			cp	d
+			sub	e
+			sub	l
+			ld	b,b
+			cp	h
+			ld	h,l
+			sbc	a,d
+			ld	c,a
+			ld	c,(hl)
+			ld	l,c
+			adc	a,l
+			sbc	a,b
+			ld	a,a
+			ld	l,a
+			xor	l
+			ld	(hl),d
+			exx
+			xor	c
+			pop	de
+			ld	a,a
+			jp	(hl)
+			db	f9h,2bh,21h,f1h,52h,92h,e9h,5ah
+			db	fdh,57h,f8h,31h,cch,04h,62h,46h
+			sub	l
+			out	(d5h),a
+			or	d
+			ld	h,h
+			ccf
+			call	nc,Lc8d9
+			sbc	a,h
+			ld	a,a
+			adc	a,e
+			ex	(sp),hl
+			ld	e,(hl)
+			ld	a,79h
+			add	a,h
+			ld	h,(hl)
+			ld	b,32h
+			ld	h,l
+			call	p,L536a
+			ccf
+			dec	h
+			ld	d,d
+			ld	c,d
+			or	51h
+			ld	hl,c574h
+			add	a,e
+			cp	a
+			cp	b
+			ret	c
+			xor	58h
+			ret	m
+			rst	10h
+			ld	h,c
+			ld	b,h
+			or	c
+			ld	c,(hl)
+			adc	a,a
+			ld	h,(hl)
+			add	a,e
+			ld	h,b
+			ld	e,e
+			inc	hl
+			inc	l
+			djnz	L5ead
+			inc	e
+			cp	a
+			ret	c
+			jr	c,L5ec2
+			ld	bc,1dd2h
+			call	m,Lff0d
+			ld	a,(hl)
+			ld	d,c
+			scf
+			ld	(bc),a
+			ld	a,c
+			and	c
+			ld	bc,e0f4h
+			ld	d,e
+			jp	nz,Lec55
+			xor	l
+			rla
+			ld	e,d
+			jp	pe,L99ff
+			ld	a,b
+			and	e
+			in	a,(eah)
+			adc	a,27h
+			and	e
+			and	b
+			cp	d
+			add	hl,hl
+			sra	h
+			jp	po,L8dbf
+			out	(13h),a
+			ld	c,e
+			sbc	a,c
+			and	e
+			ld	(hl),c
+			dec	e
+			ld	b,h
+			ld	(hl),c
+			exx
+			ld	e,c
+			inc	b
+			daa
+			ld	h,c
+			dec	l
+			ld	a,(bc)
+			ret	c
+			ld	l,l
+			ld	l,a
+			and	l
+			cp	b
+			xor	l
+			ld	h,b
+			exx
+			dec	a
+			or	e
+			dec	a
+			cp	d2h
+			call	z,L4ed1
+			ld	c,e
+			inc	l
+			ld	b,b
+			adc	a,h
+			pop	bc
+			inc	c
+			sub	e
+			di
+			sbc	a,h
+			adc	a,l
+			adc	a,l
+			ld	l,65h
+			ret	nc
+			sbc	a,h
+			ld	l,l
+			dec	(hl)
+			inc	sp
+			inc	h
+			cp	h
+			adc	a,b
+			ld	e,d
+			cp	a
+			inc	hl
+			sub	2bh
+			ld	a,b
+			daa
+			ld	(de),a
+			and	a
+			add	a,a
+			ld	l,c
+			jr	z,L5f45
+			cp	d
+			jr	z,L5edf
+			call	nz,Le5e1
+			ld	e,c
+			ld	(hl),a
+			ld	sp,hl
+			ld	l,e
+			ld	h,ebh
+			ld	b,l
+			rlca
+			cp	a
+			push	bc
+			nop (2x) *
+			ld	a,c
+			rst	38h
+			inc	hl
+			ld	l,d
+			nop (2x) *
+			xor	b
+			ld	c,d
+			add	a,c
+			xor	b
+			rlca
+			ld	sp,800dh
+			sub	b
+			ld	c,f4h
+			sub	h
+			ld	e,4bh
+			ld	d,38h
+			dec	a
+			rst	38h
+			and	d
+			jp	pe,L0de8
+			ret	p
+			ld	d,(hl)
+			cpl
+			xor	e
+			ld	(4e46h),hl
+			ld	d,e
+			adc	a,d
+			xor	l
+			ld	b,l
+			xor	b
+			rrca
+			jr	L5f97
+			db	69h,a1h,69h,1fh,cdh,6fh,aeh,bch
+			db	6bh,77h,44h,b5h,31h,7ch,9dh,0ch
+			db	7ch,13h,f6h,90h,0eh,eah,b8h
+			and	c
+			jp	pe,L315e
+			ld	b,(hl)
+			rst	00h
+			ld	l,e
+			ld	(bc),a
+			ld	c,3dh
+			ld	l,d
+			sbc	a,d
+			nop
+			dec	h
+			dec	bc
+			ccf
+			call	m,Lee06
+			ld	d,h
+			ld	l,(hl)
+			call	L7c3c
+			rla
+			sub	(hl)
+			ld	bc,7c7ah
+			or	3dh
+			ld	sp,hl
+			pop	hl
+			ret	pe
+			rrca
+			ld	d,l
+			jr	z,L5fb7
+			ex	(sp),hl
+			sbc	a,b
+			ld	c,d
+			nop (2x) *
+			ld	(5ad5h),a
+			jp	po,L82d4
+			inc	bc
+			rst	38h
+			cp	d
+			ld	b,c
+			ld	d,h
+			ret
+			db	62h,93h,25h,b4h,fbh
+			rst	38h
+			ld	(hl),e
+			xor	(hl)
+			dec	sp
+			ld	c,aeh
+			push	de
+			ld	d,(hl)
+			pop	hl
+			exx
+			and	(hl)
+			daa
+			ld	d,h
+			ld	h,l
+			ld	c,d
+			add	a,e
+			and	l
+			or	b
+			adc	a,c
+			out	(f5h),a
+			ld	a,l
+			rst	30h
+			ld	(hl),b
+			ld	l,aah
+			adc	a,c
+			ld	c,d
+			ld	(hl),b
+			sll	e
+			dec	bc
+			ld	(hl),e
+			ld	sp,hl
+			in	a,(e9h)
+			sbc	a,l
+			add	a,a
+			push	hl
+			ld	c,a
+			rst	20h
+			dec	hl
+			cp	l
+			ld	a,e
+			cp	c
+			ld	c,43h
+			rst	10h
+			rst	30h
+			ld	d,d
+			or	h
+			or	d
+			call	p,L0ddd
+			ld	a,(hl)
+			add	a,c
+			jp	p,L6aed
+			cp	d
+			ld	h,c
+			inc	(hl)
+			ld	l,a
+			xor	d
+			scf
+			nop (2x) *
+			jp	pe,Lfc48
+			scf
+			dec	sp
+			rst	28h
+			sbc	a,c
+			inc	(hl)
+			and	c
+			ld	a,b
+			sbc	a,c
+			ld	d,(hl)
+			ld	(hl),l
+			sbc	a,(hl)
+			xor	h
+			jp	z,L2bda
+			rrca
+			ld	a,49h
+			bit	4,c
+			jp	z,L1cde
+			inc	(hl)
+			ld	(7a0ch),hl
+			sbc	a,e
+			call	nc,L0258
+			jr	nc,L606b
+			ld	e,b
+			ld	b,b
+			sub	c
+			ret	nz
+			nop (2x) *
+			ld	l,h
+			cp	d
+			ld	bc,22b5h
+			rrca
+			ld	(hl),d
+			call	nc,L3717
+			jp	c,Le292
+			add	a,d
+			ld	a,d
+			ld	c,a
+			ld	l,d
+			ret	po
+			ld	(hl),e
+			jr	nz,L5fd4
+			and	33h
+			ex	de,hl
+			ld	b,1ch
+			ld	e,5bh
+			and	l
+			and	b
+			out	(a8h),a
+			jp	nc,L8e8b
+			exx
+			ld	d,d
+			xor	(hl)
+			xor	l
+			push	de
+			and	e
+			daa
+			nop
+			ld	a,d
+			cp	d
+			ei
+			ld	a,(de)
+			ld	b,d
+			dec	hl
+			call	po,Ld826
+			xor	9bh
+			ld	c,l
+			ld	c,e
+			sbc	a,d
+			rst	20h
+			sbc	a,l
+			scf
+			ld	c,c
+			ld	hl,f451h
+			ld	d,l
+			ccf
+			ld	a,e
+			jr	c,L6008
+			daa
+			ld	a,b
+			ei
+			jp	(hl)
+			db	c6h,e9h,81h,f7h,69h,2bh,40h,c1h
+			db	05h,6fh,25h,83h,7fh,a5h,d7h,3dh
+			db	62h,cah,32h,fah
+			sbc	a,c
+			neg *
+			ld	(de),a
+			ld	a,(hl)
+			ld	a,h
+			ld	l,6dh
+			sbc	a,h
+			ld	h,h
+			or	b
+			adc	a,b
+			adc	a,d
+			xor	efh
+			call	c,L1bc8
+			inc	e
+			cp	c
+			add	a,b
+			jp	p,L6811
+			sbc	a,l
+			ld	(bc),a
+			ld	h,(hl)
+			rst	38h
+			jr	L608f
+			db	7bh,84h,6bh,21h,40h
+			ld	hl,bda5h
+			dec	bc
+			sbc	a,a
+			or	l
+			call	m,L3cdb
+			add	a,d
+			cp	bdh
+			scf
+			add	a,d
+			jp	m,Lf5b2
+			ld	(bc),a
+			call	Lbe49
+			push	de
+			ld	(de),a
+			dec	h
+			call	pe,L60de
+			add	a,c
+			call	z,L4ceb
+			ld	e,d
+			ld	d,a
+			ld	c,(hl)
+			rst	10h
+			dec	sp
+			dec	c
+			and	d
+			inc	h
+			call	po,Lb006
+			ret	m
+			pop	af
+			rst	00h
+			ld	b,(hl)
+			ld	d,d
+			inc	h
+			out	(f3h),a
+			sub	c
+			sub	e
+			ld	c,h
+			ld	(hl),h
+			ld	d,d
+			jp	m,Ld1fd
+			jp	nz,Lb279
+			xor	c
+			ld	hl,a018h
+			ld	d,h
+			ld	(hl),d
+			adc	a,7ah
+			sbc	a,(hl)
+			rst	10h
+			dec	hl
+			ld	l,l
+			add	hl,de
+			ld	(ix + e1h),d
+			push	af
+			ld	c,c
+			jr	c,L608c
+			xor	(hl)
+			xor	a
+			cp	a
+			nop
+			ret	m
+			ld	e,a
+			add	a,c
+			add	a,l
+			ld	hl,19d2h
+			add	a,a
+			ld	hl,90cfh
+			call	nz,L22a7
+			ld	de,3812h
+			or	e
+			ld	a,(de)
+			rrca
+			or	l
+			ld	e,b
+			ld	h,l
+			xor	c
+			add	a,c2h
+			cp	(hl)
+			dec	bc
+			inc	(hl)
+			ld	b,(hl)
+			adc	a,(hl)
+			and	a
+			jr	nz,L60a5
+			ld	(hl),h
+			jr	nz,L6140
+			ld	a,l
+			ld	h,c
+			sbc	a,d
+			inc	e
+			dec	a
+			ld	d,h
+			jp	nz,L57b0
+			ld	a,b
+			ld	a,a
+			cp	c
+			ccf
+			ex	(sp),hl
+			djnz	L6126
+			dec	l
+			or	b
+			and	(hl)
+			ld	(de),a
+			ld	c,d
+			ld	b,c
+			ld	d,c
+			rst	38h
+			jp	z,Lc300
+			ld	l,a
+			ld	hl,(7684h)
+			ld	(hl),d
+			cp	55h
+			exx
+			daa
+			ld	a,(hl)
+			jp	nz,Lcf5f
+			ld	(bc),a
+			and	l
+			ld	sp,hl
+			xor	b
+			ld	bc,ca84h
+			sbc	a,d
+			ld	l,c
+			cp	l
+			ld	a,(de)
+			ld	c,c
+			pop	af
+			sla	b
+			or	b
+			and	b
+			adc	a,l
+			ld	d,l
+			inc	h
+			or	d
+			ld	b,e
+			jp	nc,Lb96f
+			ld	l,d
+			dec	c
+			dec	h
+			add	hl,sp
+			ld	a,05h
+			ld	e,l
+			ld	sp,283bh
+			exx
+			ex	de,hl
+			inc	a
+			ld	h,49h
+			dec	b
+			add	a,h
+			ld	(bc),a
+			sbc	a,h
+			ld	e,d
+			exx
+			ld	c,l
+			ld	b,l
+			inc	l
+			jp	m,L2448
+			pop	hl
+			cp	l
+			ld	a,d
+			inc	c
+			nop
+			jp	(hl)
+			db	41h,20h,a9h,9eh,3ch,06h,a5h,c6h
+			db	2dh,7ch,09h,02h,67h,9ah,f6h,21h
+			db	1dh,e2h
+			nop (2x) *
+			cp	b
+			ld	c,d
+			or	l
+			call	c,L516c
+			ld	e,l
+			add	a,e
+			ld	l,e
+			ccf
+			and	d
+			cp	a3h
+			rla
+			dec	l
+			inc	h
+			ld	l,4dh
+			jr	c,L620f
+			or	e
+			jr	z,L6217
+			ret	p
+			jr	c,L614d
+			ld	c,h
+			and	h
+			ex	af,af'
+			ld	l,(hl)
+			inc	d
+			inc	(hl)
+			ld	(4eb4h),bc
+			ld	(hl),e3h
+			ld	b,h
+			add	a,a
+			ld	b,a
+			dec	d
+			ld	b,b
+			sub	e
+			ld	d,e
+			ld	c,d
+			ld	(db35h),hl
+			ld	d,l
+			ld	d,d
+			ld	l,b
+			ld	e,c
+			ret	pe
+			pop	bc
+			ld	h,l
+			rst	18h
+			ld	h,a
+			inc	sp
+			call	L27b0
+			ld	b,c
+			cp	e
+			ret	nz
+			add	a,(hl)
+			ld	a,c
+			ld	d,b
+			daa
+			or	a
+			dec	de
+			dec	a
+			ld	a,92h
+			di
+			cp	2ah
+			inc	d
+			ld	sp,hl
+			jr	L61fa
+			db	36h,43h,6fh,91h,23h,bfh,37h,fdh
+			db	75h,0dh,a5h,3fh,20h,21h,13h,50h
+			db	7dh,14h,0eh,3ah,a1h
+			ld	hl,(0d0dh)
+			jr	L6235
+			db	efh,01h,eah,19h,25h,5ch,f5h,0eh
+			db	c4h,feh,b8h,24h,93h,31h,97h,beh
+			ld	h,h
+			cp	l
+			or	h
+			ld	h,a
+			ld	de,9b79h
+			add	a,c
+			xor	d
+			or	a
+			dec	a
+			and	d
+			ld	a,(de)
+			dec	de
+			ld	e,l
+			and	l
+			or	b
+			cp	a
+			ld	l,l
+			call	z,Lc1dd
+			sub	d
+			jp	nc,L174d
+			ld	d,d
+			ld	l,c
+			ld	d,(hl)
+			di
+			pop	bc
+			ld	l,c
+			ld	b,b
+			ld	d,beh
+			sub	(hl)
+			ld	h,e8h
+			adc	a,d
+			ld	l,c
+			add	a,a
+			rst	10h
+			and	21h
+			ld	h,e
+			sub	e
+			jr	z,L62b4
+			ret	z
+			sbc	a,(hl)
+			xor	b
+			nop (2x) *
+			ld	a,(bc)
+			dec	hl
+			adc	a,a
+			inc	c
+			and	l
+			sbc	a,h
+			dec	a
+			dec	e
+			ld	e,c
+			call	nc,Lf161
+			djnz	L624f
+			ld	d,b
+			ld	d,e
+			ret	m
+			sub	h
+			ld	c,b
+			ld	h,l
+			ld	(hl),a
+			ld	l,c
+			sub	d
+			ld	a,4fh
+			ld	e,d
+			inc	sp
+			inc	bc
+			dec	hl
+			ld	c,d
+			ld	d,d
+			dec	bc
+			inc	h
+			add	a,d
+			ei
+			adc	a,a
+			dec	h
+			push	af
+			ld	e,a
+			ld	a,l
+			ld	l,a
+			xor	ach
+			cp	e
+			add	hl,de
+			ld	l,(hl)
+			ld	a,(de)
+			dec	(hl)
+			ld	e,h
+			ld	sp,79a8h
+			ld	(hl),a
+			adc	a,d
+			xor	b
+			sbc	a,e
+			ret	nc
+			adc	a,(hl)
+			ld	b,b
+			ld	a,a
+			or	b
+			dec	(hl)
+			xor	a
+			ccf
+			cp	(hl)
+			ld	(de),a
+			rlca
+			ld	b,e
+			jp	p,L0672
+			jr	nz,L6291
+			ld	h,a
+			cp	a
+			ld	e,a
+			jp	(hl)
+			db	02h
+			sub	c
+			ld	(56b5h),a
+			push	bc
+			add	a,h
+			ld	e,d
+			nop (2x) *
+			cp	d
+			ld	sp,a3ddh
+			ld	c,c
+			ld	c,b
+			jp	nz,L2200
+			nop
+			ld	l,h
+			ld	b,c
+			dec	sp
+			ld	d,h
+			ld	a,b
+			ld	e,b
+			adc	a,c
+			ld	b,d
+			rrca
+			and	c
+			ld	e,l
+			ld	a,a
+			ld	d,c
+			ex	af,af'
+			ld	(de),a
+			or	(hl)
+			adc	a,b
+			ld	d,d
+			and	d
+			ld	a,5bh
+			inc	e
+			ld	d,l
+			ld	d,e
+			call	nc,Lce48
+			ld	l,c
+			ld	l,l
+			ld	a,c
+			ld	a,03h
+			ld	e,l
+			ld	e,(hl)
+			xor	d
+			out	(50h),a
+			ret	m
+			or	b
+			di
+			sbc	a,d
+			rlca
+			add	a,b
+			add	a,a
+			ret	c
+			ld	e,l
+			ld	h,e
+			ld	(hl),70h
+			ld	a,h
+			ld	d,53h
+			call	nc,L5580
+			adc	a,c
+			cp	l
+			ld	h,d
+			jp	p,Ld3b3
+			ld	l,d
+			ld	l,l
+			ld	a,c
+			xor	b
+			daa
+			dec	b
+			inc	de
+			add	a,l
+			ld	b,d
+			jp	(hl)
+			db	bdh,47h
+			rst	10h
+			ret	nz
+			and	c
+			ld	l,a
+			or	h
+			sbc	a,l
+			adc	a,d
+			jp	L795d
+			db	e5h,2ch,a2h,c4h,cdh,79h,33h,28h
+			db	c2h,d1h,88h,a3h,7dh,45h,01h,7ah
+			db	8ch,b0h,89h,a3h,9ch,bch,6fh
+			xor	(hl)
+			pop	de
+			ld	b,d
+			ld	(1bcfh),a
+			call	z,La015
+			ld	l,b
+			call	p,L67f1
+			sbc	a,e
+			ld	d,e
+			ld	l,d
+			jr	nc,L62c5
+			or	l
+			and	d
+			or	84h
+			cp	a
+			ld	h,h
+			call	p,L5d8f
+			ld	c,d
+			cp	l
+			ld	hl,(6e03h)
+			pop	bc
+			ret	nc
+			set	3,c
+			inc	sp
+			scf
+			dec	e
+			cp	(hl)
+			sub	l
+			xor	c
+			sub	d
+			ld	(hl),a
+			ld	(hl),f1h
+			ret	nc
+			cp	e
+			ld	h,d
+			ret	c
+			dec	sp
+			ld	hl,(b947h)
+			ld	h,c
+			ld	(bc),a
+			nop
+			add	a,b
+			adc	a,(hl)
+			cpl
+			ret	m
+			nop (2x) *
+			ld	b,h
+			add	a,(hl)
+			ld	h,d
+			jp	c,L5e3f
+			ld	h,b
+			pop	hl
+			scf
+			jp	po,Lc598
+			inc	sp
+			ld	b,c
+			ld	l,l
+			dec	(hl)
+			ld	a,h
+			cp	l
+			xor	l
+			ld	e,l
+			add	a,l
+			jr	c,L62ec
+			inc	a
+			nop (2x) *
+			adc	a,c
+			sbc	a,a
+			ld	e,c
+			add	a,(hl)
+			daa
+			ret	z
+			ld	a,(hl)
+			add	a,e
+			ld	c,0fh
+			rst	38h
+			dec	b
+			call	po,L3dd7
+			add	a,e
+			adc	a,b
+			xor	e
+			sub	h
+			rst	18h
+			and	c
+			jp	nz,Lb5fe
+			inc	e
+			ld	c,e
+			add	a,30h
+			ei
+			or	h
+			inc	h
+			sub	e
+			ld	b,64h
+			ld	b,e
+			inc	bc
+			dec	sp
+			pop	bc
+			and	l
+			inc	bc
+			or	e
+			ret	z
+			dec	a
+			cp	h
+			ld	sp,f297h
+			add	hl,hl
+			inc	(hl)
+			ld	d,a
+			ld	de,d52bh
+			inc	de
+			add	a,b
+			ld	d,(hl)
+			cp	d
+			ld	b,c
+			inc	sp
+			sbc	a,f8h
+			or	b
+			rra
+			ret	po
+			ld	l,l
+			ld	d,b
+			sub	l
+			and	c9h
+			sub	e
+			sub	h
+			cp	a
+			nop (2x) *
+			ld	e,(hl)
+			push	hl
+			sub	a
+			rra
+			cp	b
+			ld	l,(hl)
+			inc	d
+			ld	a,h
+			rst	38h
+			add	a,d1h
+			ld	hl,(3407h)
+			call	pe,L39e7
+			ld	h,e
+			add	a,d
+			ld	e,c
+			ld	l,d
+			ld	e,(hl)
+			ld	l,h
+			cp	e
+			ld	(hl),b
+			ld	h,c
+			ld	(hl),c
+			ld	l,e
+			xor	l
+			inc	b
+			ld	d,e5h
+			ld	d,h
+			adc	a,74h
+			cp	d
+			nop (2x) *
+			ld	hl,(408ch)
+			ld	c,(hl)
+			ld	(hl),a
+			ld	e,3dh
+			rst	28h
+			ld	(c899h),hl
+			nop (2x) *
+			ex	af,af'
+			call	nz,L65a6
+			cp	e
+			jp	pe,L6466
+			dec	c
+			dec	(hl)
+			ret	m
+			ld	a,h
+			ld	d,e
+			call	z,L60db
+			ld	l,h
+			add	a,l
+			and	h
+			call	po,Lc102
+			sub	e
+			pop	af
+			rst	30h
+			scf
+			cp	a
+			jr	nc,L646e
+			xor	(hl)
+			rst	38h
+			ld	(hl),b
+			ld	de,f7e9h
+			ld	e,c
+			jp	nz,Ldbb4
+			push	af
+			rra
+			ld	d,d
+			add	hl,hl
+			sub	e
+			adc	a,c
+			rst	18h
+			call	z,L5f7b
+			call	nc,Lb797
+			ret	pe
+			jp	nc,L4afe
+			dec	bc
+			ld	a,8ah
+			dec	c
+			sub	f7h
+			add	a,h
+			cp	b
+			push	bc
+			add	a,c
+			dec	(hl)
+			sub	6ah
+			or	f3h
+			ld	d,(hl)
+			or	b
+			jp	(hl)
+			db	ceh,15h,8fh,79h
+			ld	(hl),d
+			ld	(hl),b
+			sub	11h
+			dec	c
+			jr	nc,L6444
+			ld	b,h
+			and	a
+			or	h
+			sub	d
+			ld	d,a
+			or	81h
+			ld	l,a
+			ld	c,6fh
+			ld	b,92h
+			sub	b
+			ret	nz
+			inc	l
+			ld	e,e
+			cpl
+			or	d
+			ld	b,a
+			push	af
+			or	a
+			ld	l,a
+			add	hl,hl
+			sbc	a,l
+			add	hl,bc
+			call	m,La032
+			ld	e,ach
+			ret	z
+			out	(e2h),a
+			and	b
+			add	a,d
+			sub	l
+			jr	z,L6430
+			or	a
+			pop	de
+			ld	b,c
+			ret	pe
+			out	(76h),a
+			xor	c
+			xor	l
+			call	pe,L1c86
+			call	c,L6401
+			ld	e,e
+			add	a,d
+			jr	c,L64e9
+			add	hl,hl
+			ei
+			adc	a,(hl)
+			ld	a,a
+			add	a,d
+			or	h
+			sub	b
+			ld	(hl),l
+			ret	c
+			add	a,b
+			rst	00h
+			jp	L24bf
+			db	9eh,9ah,27h,a6h,27h,66h,7ch,40h
+			db	c9h,47h,9ah
+			inc	hl
+			inc	e
+			and	b
+			add	a,(hl)
+			ld	(hl),22h
+			ld	l,(hl)
+			jr	z,L6444
+			ld	e,b
+			ld	h,a
+			and	(hl)
+			nop (2x) *
+			ld	d,b
+			cp	(hl)
+			sbc	a,h
+			rst	00h
+			ld	c,a
+			call	po,Le683
+			ld	(2e29h),a
+			ld	l,e
+			nop (2x) *
+			rst	28h
+			adc	a,b
+			ld	c,l
+			cp	c
+			sub	c
+			xor	(hl)
+			out	(f8h),a
+			ret	po
+			call	z,L3e55
+			ld	c,b
+			adc	a,h
+			ld	l,(hl)
+			ld	h,l
+			sub	h
+			add	a,(hl)
+			cp	a
+			and	32h
+			adc	a,e
+			jp	L725a
+			db	9eh,e6h,7bh,6ch,2dh,50h,43h,4eh
+			db	7ch,45h,deh,cch,aeh,88h,5fh,2fh
+			db	abh,e5h,e5h,04h,8ah,8dh
+			or	50h
+			ld	d,d
+			sub	l
+			dec	b
+			sub	l
+			or	(hl)
+			ld	sp,hl
+			ei
+			adc	a,h
+			ld	l,h
+			adc	a,l
+			or	a
+			push	af
+			adc	a,d
+			sub	e
+			and	b
+			ld	(hl),a
+			add	a,h
+			pop	de
+			and	b
+			cp	f7h
+			add	a,a
+			ld	d,d
+			pop	bc
+			ld	b,b
+			or	d
+			ld	a,h
+			sub	d
+			adc	a,h
+			xor	l
+			jp	z,L1107
+			jp	po,L0931
+			ret	nz
+			cp	(hl)
+			xor	l
+			ld	l,(hl)
+			ld	b,h
+			ld	h,c
+			ld	a,(7521h)
+			jr	nc,L6564
+			push	de
+			add	a,d
+			jp	c,Lfd81
+			sub	c7h
+			ld	(hl),d
+			sub	d
+			ld	d,h
+			ld	a,(hl)
+			dec	a
+			ld	(hl),d
+			call	nc,Ld6a3
+			inc	sp
+			ret	c
+			ret	z
+			adc	a,(hl)
+			rra
+			cp	(hl)
+			dec	l
+			or	d
+			rst	20h
+			call	z,Labbc
+			sub	d
+			dec	e
+			jp	c,L2952
+			inc	bc
+			rst	30h
+			dec	l
+			ld	(1623h),hl
+			dec	hl
+			sub	l
+			cp	d
+			ei
+			pop	af
+			or	e
+			push	bc
+			ld	a,ceh
+			call	po,Le764
+			ld	(hl),d
+			ld	a,(bc)
+			cp	c
+			call	c,Lc4e1
+			cp	c
+			sbc	a,2ah
+			ld	b,h
+			and	e1h
+			jp	p,L694e
+			xor	a
+			ld	(f574h),a
+			add	hl,de
+			ld	(bc),a
+			ld	h,b
+			cpl
+			sbc	a,e
+			jp	c,Lba41
+			ld	(8823h),hl
+			ld	h,b
+			dec	e
+			exx
+			cp	d
+			add	a,h
+			ld	(hl),l
+			ld	h,e
+			ld	a,c
+			adc	a,e
+			ld	(bc),a
+			add	hl,bc
+			cp	63h
+			inc	sp
+			add	a,h
+			ld	a,l
+			ex	af,af'
+			add	a,c
+			xor	a
+			ld	e,c
+			ld	b,h
+			jr	z,L65db
+			ld	l,d
+			dec	b
+			ld	d,e
+			ld	e,h
+			pop	hl
+			inc	h
+			call	c,L2e5b
+			exx
+			ld	a,(bc)
+			inc	l
+			rla
+			inc	hl
+			dec	de
+			dec	(hl)
+			adc	a,c
+			nop (2x) *
+			inc	bc
+			adc	a,a
+			ret	m
+			or	d
+			jp	m,Lde14
+			xor	d
+			rlca
+			xor	37h
+			jp	nc,L9777
+			ld	h,a
+			ld	sp,0f7fh
+			ld	l,h
+			ld	d,c
+			cp	a
+			daa
+			ld	c,b
+			xor	b
+			xor	a
+			ex	af,af'
+			sub	b
+			ret
+			db	88h,e9h,afh,26h,cfh,4ah,c4h,5dh
+			db	17h,76h,e7h
+			dec	h
+			rrca
+			in	a,(71h)
+			add	hl,sp
+			sbc	a,l
+			ld	a,c
+			and	h
+			ld	l,h
+			xor	b
+			add	hl,de
+			ld	a,b
+			push	de
+			ld	b,c
+			ld	a,l
+			cp	d
+			ld	a,b
+			adc	a,a5h
+			or	d
+			ld	d,(hl)
+			and	d
+			and	b
+			cp	e
+			ld	b,l
+			cp	1dh
+			inc	d
+			rst	18h
+			add	a,l
+			ld	c,h
+			ld	iyh,e *
+			ld	(bc),a
+			sbc	a,a
+			cpl
+			ret
+			db	68h,89h,9bh,9fh,94h,59h,73h,3eh
+			db	fbh,87h,e1h,e3h,a5h,f1h,36h,06h
+			db	50h,34h,0dh
+			sbc	a,a
+			cp	c
+			rst	20h
+			ex	af,af'
+			ld	l,(hl)
+			rlca
+			pop	de
+			ld	b,c
+			jp	c,Le30a
+			add	a,01h
+			pop	af
+			cp	d
+			ret	nc
+			cp	c
+			ld	(hl),c
+			and	b
+			add	hl,bc
+			ld	c,(hl)
+			ld	d,a
+			dec	c
+			ld	a,c
+			ld	e,d
+			add	hl,bc
+			sbc	a,(hl)
+			ld	b,c
+			dec	a
+			ret	m
+			add	a,l
+			ld	de,90aah
+			ld	e,2eh
+			ld	a,e
+			nop (2x) *
+			inc	sp
+			or	e
+			jr	z,L6607
+			ld	a,43h
+			sub	a
+			jp	c,Lcbfd
+			ret	pe
+			pop	hl
+			ld	l,c
+			or	32h
+			ld	l,77h
+			rst	38h
+			and	(hl)
+			adc	a,l
+			ld	e,6ah
+			sbc	a,37h
+			push	hl
+			jr	c,L65a3
+			and	h
+			cp	e
+			or	5ch
+			call	Lccb8
+			jr	nz,L65c5
+			rra
+			add	a,7ah
+			rst	18h
+			ld	h,h
+			ld	(1315h),a
+			push	af
+			ex	af,af'
+			xor	b
+			ld	a,(0c5ch)
+			jp	m,L64ec
+			add	a,h
+			xor	h
+			call	pe,Lb497
+			inc	a
+			add	a,b
+			adc	a,l
+			cp	b
+			xor	a
+			ld	b,l
+			ld	a,(hl)
+			and	e
+			rst	20h
+			sub	bfh
+			or	c
+			ld	(6f6eh),hl
+			xor	d
+			ld	a,d
+			dec	(hl)
+			ret	nz
+			jp	m,L846a
+			or	a
+			ld	h,a8h
+			ret	c
+			adc	a,d
+			jr	L663d
+			ret	po
+			ex	af,af'
+			jp	c,L1db6
+			jp	L06c4
+			db	cbh,3ah,c8h,26h,cdh,ffh,08h,dah
+			db	6eh,b1h,97h,38h,f0h,adh
+			ld	bc,7c7ah
+			set	7,a
+			add	a,c
+			ld	d,a
+			ld	b,b
+			or	d
+			sub	d
+			ld	d,2eh
+			ld	e,d
+			add	hl,de
+			and	c
+			rst	28h
+			ld	c,b
+			rst	20h
+			ld	h,h
+			dec	de
+			push	hl
+			sbc	a,(hl)
+			sbc	a,(hl)
+			ld	b,e
+			inc	l
+			ld	h,b
+			ld	b,l
+			adc	a,1eh
+			jp	po,L3593
+			sub	b
+			jp	c,L05e1
+			sub	l
+			adc	a,h
+			dec	hl
+			ld	a,(bc)
+			call	nc,Lc2dc
+			sbc	a,l
+			ld	h,5fh
+			ld	l,a
+			jp	c,Lf6b0
+			jp	pe,Ldefe
+			dec	bc
+			adc	a,a
+			or	b
+			rst	28h
+			ccf
+			ld	a,(dbbfh)
+			add	a,37h
+			ld	b,d
+			sub	a
+			dec	d
+			ld	d,03h
+			or	c
+			rst	10h
+			ld	a,c
+			cp	l
+			jr	L6658
+			db	a9h,afh,feh,d9h,beh,32h,8ch,cah
+			db	a5h,37h,33h,9dh,b6h,70h,9dh,62h
+			db	dah,2ah,c0h,6fh,96h,00h,c3h,d8h
+			db	a1h,1fh,b5h,41h,c8h,3bh,aah,edh
+			db	bdh,cfh,f3h,efh,02h,bfh,c4h,d4h
+			db	00h,60h,a5h,d0h,90h,a3h,9ch,53h
+			db	13h,04h,26h,b6h,c7h,7ah,32h,c7h
+			db	d5h,ebh,c7h,d9h,3ch,bbh,29h,33h
+			db	5bh,c8h,22h,74h,78h,09h,03h,34h
+			db	2ah,28h,b2h,95h,a0h,d0h,f3h,72h
+			db	39h,14h,03h,73h,17h,64h,88h,72h
+			db	36h,cch,cch,b3h,c9h,36h,2ch,85h
+			db	d2h,8ah,20h,63h,f3h,d3h,2ah,e9h
+			db	6fh,6bh,04h,16h,4eh,28h,dch,b9h
+			db	f5h,02h,39h,1ch,92h,9eh,8ch,86h
+			db	f9h,d3h,abh,ach,7ch,92h,4ch,a5h
+			db	49h,bch,12h,12h,24h,10h,89h,65h
+			db	1ch,45h,3bh,6fh,cfh,20h,15h,52h
+			db	0eh,0dh,f7h,bdh,52h,06h,0dh,84h
+			db	49h,71h,09h,afh,98h,04h,30h,75h
+			db	6dh,a2h,f1h,a3h,a2h,4bh,78h,cfh
+			db	aeh,d8h,aah,c8h,1ah,efh,d7h,e2h
+			db	1dh,74h,21h,1bh,e4h,a8h,45h,85h
+			db	04h,5dh,08h,c3h,dfh,65h,0dh,46h
+			db	0fh,d1h,88h,1fh,eah,16h,86h,ebh
+			db	8fh,58h,00h,83h,61h,f5h,07h,c9h
+			db	f4h,cch,47h,6bh,6fh,c3h,3ch,ech
+			db	8ah,7bh,c7h,3dh,65h,86h,44h,45h
+			db	84h,71h,3dh,0fh,23h,f5h,4bh,c7h
+			db	b0h,63h
+			ld	c,(hl)
+			dec	c
+			jp	p,Lca5b
+			ret	nz
+			add	ix,de
+			ld	b,e
+			add	a,(hl)
+			jr	L67ce
+			cpl
+			ld	d,c
+			add	a,c
+			ld	de,819ah
+			inc	a
+			nop
+			ret
+			db	94h,eah,6ah,dch,71h,a4h,d5h,6ch
+			db	7fh,61h,d3h,2eh,beh,dbh,eeh,c8h
+			db	9dh,f0h,c8h,2ch,ech,a8h,d8h
+			ld	h,(hl)
+			ld	l,b
+			xor	(hl)
+			res	1,c
+			ld	b,98h
+			ret	m
+			adc	a,l
+			ex	af,af'
+			jp	nz,L0ec7
+			cp	l
+			ld	bc,f6e6h
+			call	Lbe33
+			in	a,(a3h)
+			cp	b
+			ld	d,b
+			add	a,(hl)
+			ld	d,d
+			ld	(hl),b
+			jr	nz,L6835
+			rst	08h
+			ld	h,e
+			rst	18h
+			sub	b
+			ld	l,h
+			jp	pe,L58c8
+			ld	d,ebh
+			sbc	a,a
+			jr	L67a2
+			db	c0h,7bh,b7h,0ch,34h,41h,c6h,73h
+			db	0eh,cch,23h,07h,bdh,c9h,93h,e5h
+			db	e6h,89h,60h,b3h,27h,b3h,65h,81h
+			db	f8h
+			call	m,Ledb5
+			jp	nc,Le9d6
+			set	4,d
+			push	af
+			inc	bc
+			ld	e,d
+			jp	m,Lfab2
+			pop	bc
+			add	hl,de
+			rst	30h
+			inc	(hl)
+			inc	d
+			sub	d
+			halt
+			sub	e
+			pop	bc
+			ld	d,b
+			call	nc,L39c2
+			ret	nc
+			sub	l
+			ret	c
+			and	d
+			ld	d,a
+			ld	hl,61a6h
+			inc	a
+			ld	l,c
+			cp	h
+			cp	iyl *
+			ld	(8827h),a
+			ld	l,b
+			adc	a,a
+			or	44h
+			inc	de
+			ld	hl,(b85dh)
+			ld	e,l
+			rst	38h
+			xor	h
+			ld	b,(hl)
+			ld	l,b
+			xor	b
+			ld	(hl),d
+			rlca
+			ld	(6ab0h),a
+			ld	(hl),b
+			add	a,d
+			ld	e,c
+			push	hl
+			ld	e,d
+			add	hl,sp
+			ld	h,b
+			jp	p,Le350
+			xor	(hl)
+			ld	l,h
+			rst	28h
+			and	l
+			ld	c,(hl)
+			xor	h
+			ld	c,a
+			add	hl,de
+			sub	l
+			rst	30h
+			or	(hl)
+			ret	nz
+			jr	z,L6878
+			adc	a,h
+			ld	(hl),b
+			xor	b
+			ld	c,c
+			add	a,a
+			rla
+			ld	a,(de)
+			sbc	a,(hl)
+			call	p,L1b87
+			rst	20h
+			ld	l,(hl)
+			pop	hl
+			add	a,h
+			ld	a,l
+			and	d
+			ld	h,a
+			ld	e,l
+			jp	po,L8cac
+			and	d
+			ld	(de),a
+			ld	e,c
+			ld	a,(hl)
+			ld	hl,b544h
+			ld	l,b
+			scf
+			xor	(hl)
+			xor	e
+			out	(3ch),a
+			exx
+			ld	a,e
+			ret	pe
+			ld	h,b
+			ld	(hl),e
+			rst	10h
+			add	a,4ah
+			ld	d,h
+			adc	a,53h
+			ld	e,86h
+			ld	a,(bb06h)
+			call	m,Lafed
+			dec	(hl)
+			cp	aah
+			exx
+			rst	28h
+			call	po,L1757
+			nop
+			dec	e
+			jp	c,L7e30
+			ld	(de),a
+			jp	(hl)
+			db	c7h,90h,89h,98h,69h,f5h,cbh,3eh
+			db	64h,3bh,8bh,a5h,16h,c4h,80h,09h
+			db	c0h,aah,2ah,cbh,50h,78h,ech
+			ld	a,(hl)
+			and	b
+			ld	b,d
+			ld	d,c
+			ld	h,h
+			ld	l,b
+			ld	b,c
+			jp	z,L8187
+			ld	l,b
+			ld	d,(hl)
+			ld	b,e
+			and	l
+			ld	a,a
+			jp	c,Lde8c
+			ld	h,a
+			adc	a,e
+			ld	h,c
+			or	31h
+			rst	38h
+			rra
+			xor	d
+			sub	a
+			pop	hl
+			dec	a
+			or	(hl)
+			rst	20h
+			and	d
+			inc	b
+			ccf
+			cp	a
+			djnz	L6940
+			ld	d,e
+			djnz	L6932
+			dec	e
+			sub	(hl)
+			rst	08h
+			daa
+			jp	z,L7d76
+			ld	d,l
+			adc	a,b
+			xor	71h
+			dec	b
+			ld	e,l
+			add	a,a
+			jp	p,L5c98
+			ret	c
+			ret	m
+			nop (2x) *
+			rst	18h
+			jp	p,L0e1f
+			inc	b
+			ld	l,a
+			ld	e,(hl)
+			jr	nz,L688d
+			adc	a,l
+			ld	sp,0037h
+			sub	a
+			push	hl
+			out	(a8h),a
+			cp	l
+			add	hl,sp
+			sbc	a,c
+			sub	d
+			ld	d,4ah
+			jr	L68cb
+			db	f2h,14h,b4h,bah,25h,36h,d1h,86h
+			db	beh,99h,73h,7ah,cah,2eh,88h,6ah
+			db	50h,32h,f2h,45h,1eh,14h,2dh,84h
+			db	5ah,41h
+			ld	e,bah
+			rlca
+			or	b
+			sub	e
+			ld	b,(hl)
+			out	(82h),a
+			ld	e,e
+			rst	10h
+			dec	sp
+			ld	a,a
+			ld	d,e
+			call	z,L074b
+			ld	a,l
+			adc	a,b
+			add	a,27h
+			ret	nc
+			or	e
+			cp	d
+			push	de
+			dec	de
+			ld	(bc),a
+			ld	c,l
+			cp	a
+			ld	(hl),l
+			ld	l,h
+			djnz	L694d
+			call	z,Lf697
+			or	b
+			ld	c,h
+			inc	bc
+			ld	(hl),a
+			adc	a,a
+			rst	20h
+			ld	d,b
+			xor	b
+			ld	b,d
+			and	h
+			ld	c,(hl)
+			add	a,a
+			sub	cfh
+			ld	hl,(3e1dh)
+			rst	20h
+			adc	a,c
+			xor	5ch
+			exx
+			dec	e
+			ld	a,e
+			or	d
+			add	a,h
+			ld	c,c
+			push	de
+			pop	hl
+			ld	(hl),a
+			ld	a,(hl)
+			jp	pe,L4661
+			add	hl,hl
+			cp	l
+			ld	a,c
+			and	d
+			ret	m
+			cpl
+			ld	(hl),88h
+			ld	h,e
+			and	(hl)
+			xor	a
+			and	b
+			ld	c,(hl)
+			adc	a,f3h
+			xor	71h
+			cp	d
+			ld	(hl),e
+			inc	b
+			nop (2x) *
+			ld	(hl),c
+			ld	d,(hl)
+			ld	e,e
+			adc	a,e
+			call	La911
+			cp	72h
+			sub	d
+			ret	c
+			adc	a,l
+			xor	(hl)
+			and	d
+			ld	d,l
+			rst	00h
+			add	a,(hl)
+			ld	h,h
+			ld	a,b
+			ld	b,h
+			sub	d
+			ld	(hl),05h
+			jr	c,L69a0
+			jp	nz,L5cfb
+			ld	a,a
+			dec	sp
+			ld	d,d
+			ld	d,e
+			ld	d,c
+			adc	a,h
+			dec	bc
+			ei
+			rst	00h
+			jp	nc,L93cb
+			dec	a
+			rst	28h
+			add	a,(hl)
+			jp	po,L17d5
+			sub	e
+			add	a,(hl)
+			cp	e
+			ld	sp,hl
+			call	pe,L040f
+			ld	c,b
+			and	h
+			ld	(28c4h),hl
+			inc	b
+			rst	18h
+			cp	(hl)
+			ld	l,(hl)
+			ld	e,c
+			call	nz,L7647
+			xor	e
+			ccf
+			ld	(iy + cbh),h
+			jp	(hl)
+			db	72h,a0h,60h,3ah,0fh,01h,fch,7bh
+			db	3ah,0ch
+			adc	a,l
+			sub	h
+			sub	c
+			call	m,Lba2b
+			ld	a,a
+			call	nc,L1137
+			ld	c,(hl)
+			ld	b,d
+			adc	a,6fh
+			and	c
+			ld	(hl),d
+			adc	a,66h
+			ld	a,a
+			dec	bc
+			or	a
+			ret	nz
+			dec	l
+			dec	a
+			jp	p,Lcf94
+			ret
+			db	f2h,1dh,94h,a6h,b2h
+			cp	b
+			dec	d
+			sbc	a,c
+			call	nz,Lfe3c
+			ld	c,(hl)
+			ld	d,l
+			sbc	a,a
+			xor	l
+			inc	e
+			rrca
+			ld	d,e
+			adc	a,l
+			jr	nz,L6a62
+			sub	(hl)
+			add	a,a
+			rst	28h
+			ld	a,(de)
+			sub	b
+			adc	a,l
+			sub	l
+			rrca
+			rst	08h
+			sbc	a,l
+			ld	(269eh),a
+			adc	a,c
+			ret	po
+			jp	nz,L60bf
+			ret	p
+			add	a,a
+			sub	(hl)
+			ld	l,b
+			sub	l
+			dec	l
+			cp	a
+			ld	e,h
+			ld	(74d3h),hl
+			ld	a,a
+			ld	a,b
+			dec	(hl)
+			ld	hl,(93f0h)
+			call	pe,L56ff
+			ld	a,b
+			ld	(hl),a
+			adc	a,c
+			ld	a,a
+			rst	20h
+			adc	a,h
+			ex	af,af'
+			cpl
+			sbc	a,c
+			ld	a,e
+			jp	z,L7c5c
+			dec	b
+			ld	de,027eh
+			ld	(hl),c
+			inc	h
+			ld	c,e
+			cp	h
+			ld	de,6fceh
+			rst	08h
+			adc	a,c
+			dec	c
+			and	h
+			add	a,c
+			jr	c,L69f2
+			ld	hl,bd84h
+			ld	h,d
+			sub	c
+			and	(hl)
+			ld	a,d
+			inc	sp
+			jr	nc,L6a5b
+			jp	nz,Lc304
+			add	a,l
+			ld	hl,5dd9h
+			ld	(hl),l
+			jp	nz,L1705
+			pop	de
+			and	29h
+			dec	hl
+			ret	po
+			rrca
+			rla
+			jr	z,L6a97
+			inc	e
+			and	l
+			ld	b,b
+			add	hl,sp
+			sbc	a,e
+			jp	Lb96c
+			db	ech,5fh,fbh,20h,bch,a1h,9dh,03h
+			db	a2h,1fh,d5h,7fh,dfh,deh,ffh,16h
+			db	03h,8fh,dch,53h,b6h,64h,62h,4dh
+			db	b0h,9bh,d8h,82h
+			ld	(hl),l
+			add	a,l
+			xor	d
+			inc	(hl)
+			adc	a,a
+			xor	(hl)
+			sbc	a,l
+			dec	(hl)
+			ld	h,a
+			rst	38h
+			or	l
+			ld	b,l
+			ld	h,l
+			cp	h
+			ld	e,e
+			ld	(3962h),a
+			nop (2x) *
+			nop (2x) *
+			ld	a,(bc)
+			xor	c
+			sub	e3h
+			sub	e
+			ld	h,l
+			nop (2x) *
+			ld	a,bfh
+			ret	c
+			or	c
+			sub	h
+			call	c,L3e0e
+			ld	(hl),c
+			ld	(hl),a
+			sbc	a,e
+			jr	c,L6ab6
+			ld	l,c
+			ld	(de),a
+			ld	h,a
+			ld	b,d
+			dec	c
+			adc	a,l
+			ld	a,2dh
+			ld	(4893h),a
+			rst	08h
+			ld	d,e
+			ld	l,b
+			ld	hl,5140h
+			ld	b,(hl)
+			rra
+			ld	c,h
+			and	a
+			cp	h
+			or	a
+			or	c
+			and	b
+			and	69h
+			jr	L6b15
+			db	79h,97h,0ah,8ah,33h,61h,77h,9dh
+			db	48h,53h,71h,3ch,fch,fdh,dfh,a3h
+			ld	b,b
+			in	a,(80h)
+			add	a,a
+			ld	e,(hl)
+			xor	b
+			ld	sp,hl
+			ld	l,a6h
+			rlca
+			rra
+			inc	d
+			adc	a,c
+			add	hl,hl
+			dec	h
+			ld	e,(hl)
+			ld	b,cdh
+			ret	nc
+			call	nc,L4f55
+			sbc	a,e
+			rst	10h
+			ld	(hl),a
+			jp	nc,L9acb
+			ld	l,c
+			ccf
+			ld	h,b
+			dec	bc
+			ld	l,h
+			ld	d,d
+			ld	e,l
+			call	c,L924f
+			ret
+			db	09h
+			jp	nc,Le1b8
+			jp	L3fd8
+			db	cdh,54h,b1h,47h,7ah,8fh,cch,f6h
+			db	d2h,4ch,adh,ffh,9eh,00h,c7h,97h
+			db	31h,a0h,a0h,32h,1ah,63h,69h,c2h
+			db	d5h,bfh,1ah,adh,c2h,49h,30h,7dh
+			db	b9h,4fh,19h,77h,b4h,15h,10h,68h
+			db	57h,92h,afh,06h,1ah,18h,6fh,06h
+			db	ach,57h,c9h,14h,f1h,72h,5dh,69h
+			db	0ch,91h,b4h,d7h,d3h,c5h,7fh,8ah
+			db	bch,9fh,40h,adh,1fh,0bh,c3h
+			add	a,(hl)
+			ld	l,l
+			ld	b,(hl)
+			add	a,(hl)
+			inc	b
+			ld	l,(hl)
+			dec	d
+			rst	10h
+			ld	b,a
+			jp	L16ec
+			db	e5h,e7h,94h,1dh,ceh,58h,6ah,c6h
+			db	85h,62h,cdh,75h,2fh,e2h,3dh
+			ld	l,36h
+			inc	h
+			ld	l,b
+			push	hl
+			inc	e
+			ld	(hl),h
+			dec	(hl)
+			ex	af,af'
+			ld	d,49h
+			ld	sp,9ce1h
+			sbc	a,c
+			and	l
+			call	z,Ld38f
+			ld	a,a
+			ld	a,(bc)
+			inc	de
+			add	a,c
+			di
+			xor	d
+			inc	hl
+			dec	de
+			ret	c
+			sub	h
+			cp	(hl)
+			add	hl,hl
+			nop
+			dec	a
+			ld	e,b
+			rst	08h
+			adc	a,c
+			add	a,70h
+			adc	a,d
+			inc	e
+			ld	a,c
+			sbc	a,d
+			pop	hl
+			xor	l
+			or	h
+			ld	c,3ah
+			dec	a
+			ld	b,c
+			ld	b,(hl)
+			inc	a
+			or	d
+			ld	b,3eh
+			ld	b,a5h
+			add	a,d
+			ld	c,c
+			ld	a,d
+			and	(hl)
+			inc	(hl)
+			ld	de,bf5bh
+			ld	de,7807h
+			add	a,a
+			ld	(hl),h
+			cp	a
+			dec	d
+			ret	pe
+			ld	c,d
+			add	hl,hl
+			jp	pe,L9d04
+			sub	c
+			ld	c,(hl)
+			ret	pe
+			inc	(hl)
+			ld	sp,7c44h
+			cp	b
+			jr	z,L6b62
+			ld	h,a
+			dec	de
+			rst	30h
+			sbc	a,h
+			cp	h
+			or	h
+			add	a,l
+			ld	a,(bc)
+			and	h
+			and	l
+			call	L24f9
+			sbc	a,e
+			sub	c
+			xor	l
+			sub	c
+			sbc	a,c
+			inc	sp
+			ld	a,(fddfh)
+			ld	d,a
+			ld	c,a
+			ld	a,(de)
+			xor	e
+			cp	a
+			cp	e
+			res	2,a
+			ret	m
+			ld	(hl),e
+			sub	l
+			dec	b
+			ld	(hl),d
+			ld	h,d
+			cp	h
+			jp	p,Ld3ef
+			cp	b
+			jp	pe,L4313
+			rla
+			ld	(hl),e
+			inc	de
+			ld	(bc),a
+			jp	nz,Ld74b
+			ld	(hl),c
+			or	(hl)
+			scf
+			ret
+			db	58h,60h,7eh,a5h,25h,bfh,10h,f7h
+			db	0fh,29h,ceh,e1h,78h,98h,edh,1ah
+			db	7eh,11h,6ch,b4h,fah,1ch,afh,c1h
+			db	85h,59h,ffh,e3h,f3h,5ah,69h,94h
+			db	5fh,c8h,aeh,97h,65h,99h,c5h,2dh
+			db	21h,fah,3fh,1bh,b3h,0fh,58h,50h
+			db	7fh,35h,89h,c6h,dfh,b2h,42h,c3h
+			db	fah,52h,3eh,beh,e9h,0eh,41h,5bh
+			db	49h,05h,4dh,12h,e7h,fah,2bh,71h
+			db	c9h,99h,3dh,ffh,1dh,00h,48h,b0h
+			db	c9h,71h,ebh,cch,a1h,b2h,7ch,dbh
+			db	38h,48h,19h,f1h
+			and	h
+			ld	c,h
+			ld	b,l
+			ld	h,b
+			ld	e,d
+			ld	a,c
+			push	af
+			jr	z,L6cdc
+			ld	a,(bc)
+			ld	(hl),h
+			and	e
+			ld	(bc),a
+			ret	pe
+			dec	de
+			dec	hl
+			dec	de
+			ld	c,a
+			xor	e
+			exx
+			ld	b,e
+			sbc	a,c
+			add	a,e
+			ld	d,l
+			jr	nc,L6cc8
+			add	a,c
+			ret
+			db	81h,49h,77h,80h,45h,aah,d6h,c6h
+			db	3eh,1ah,ffh,61h,b2h,9ah,e9h,d3h
+			db	81h,f8h,49h,b6h,26h,79h,bbh,75h
+			db	7eh,30h,ach,97h,bah,13h,d1h,fah
+			db	4ch,a1h,4dh,37h,7fh
+			ld	h,e
+			ld	sp,hl
+			cp	e
+			xor	a
+			dec	a
+			ld	sp,hl
+			ld	(hl),a
+			ld	d,e
+			cp	deh
+			call	nc,L152c
+			xor	(hl)
+			ld	l,e
+			call	nz,Le62e
+			call	m,Lccd4
+			adc	a,c
+			rst	18h
+			ld	d,e
+			jr	nz,L6cbd
+			call	m,Lf55e
+			call	po,Ldd64
+			adc	a,e
+			dec	b
+			ld	d,d
+			ret	po
+			ld	a,h
+			dec	bc
+			cp	e
+			ld	e,l
+			ld	c,l
+			rst	08h
+			ld	a,l
+			ld	a,75h
+			ld	d,h
+			ld	sp,bf04h
+			adc	a,47h
+			ld	a,e
+			sub	h
+			cp	e
+			ld	b,e
+			ld	d,d
+			ld	h,b
+			ld	(0566h),hl
+			adc	a,l
+			inc	bc
+			call	p,L6144
+			ld	e,b
+			dec	h
+			rst	20h
+			cp	h
+			ld	hl,55b5h
+			ld	l,(hl)
+			inc	(hl)
+			djnz	L6ce6
+			jr	z,L6d42
+			sub	d
+			xor	b
+			adc	a,a
+			ld	sp,hl
+			rst	18h
+			ld	b,b
+			push	af
+			ld	a,c
+			sbc	a,d
+			ld	b,(hl)
+			sub	c
+			or	(hl)
+			ld	b,a
+			rra
+			ld	(hl),e
+			ld	h,d
+			xor	(hl)
+			push	hl
+			ld	(de),a
+			jp	pe,Lb13f
+			ld	h,(hl)
+			sub	d
+			ld	h,23h
+			ld	l,84h
+			sub	l
+			ret
+			db	cah,8ah,46h,c9h,94h,36h,2fh,14h
+			db	6dh
+			rla
+			cp	(hl)
+			nop
+			ld	(hl),c
+			pop	af
+			inc	bc
+			ld	b,e
+			ld	b,93h
+			call	nc,L270b
+			xor	b6h
+			sub	l
+			and	h
+			cpl
+			ld	h,e
+			ld	e,l
+			ld	h,h
+			dec	b
+			ld	a,e
+			ld	a,l
+			ld	l,a
+			ld	e,f2h
+			and	l
+			ld	b,h
+			dec	d
+			sbc	a,d
+			sbc	a,e
+			ld	bc,d539h
+			dec	de
+			inc	d
+			nop (2x) *
+			jr	nc,L6d7b
+			ei
+			sbc	a,c
+			xor	b
+			ld	b,d
+			ld	(hl),a
+			add	hl,hl
+			inc	h
+			pop	de
+			out	(e3h),a
+			ld	e,a
+			dec	h
+			add	a,e
+			sbc	a,d
+			jp	pe,L21be
+			ld	e,(hl)
+			ld	(hl),l
+			dec	hl
+			ld	(bc),a
+			add	a,a
+			or	c
+			ld	a,e
+			xor	e
+			and	c
+			add	hl,hl
+			sbc	a,a
+			ld	a,d
+			jr	nc,L6d8d
+			add	a,(hl)
+			ld	hl,f337h
+			xor	a
+			ld	c,c
+			rst	08h
+			daa
+			inc	(hl)
+			xor	d
+			ld	l,e
+			ld	e,c
+			rst	08h
+			ld	c,d
+			jr	nc,L6d35
+			dec	l
+			add	a,a
+			sub	(hl)
+			cp	(hl)
+			ld	b,d
+			dec	bc
+			add	a,97h
+			ld	a,(bc)
+			jp	pe,Lf579
+			ld	h,a
+			sbc	a,l
+			ld	d,l
+			ld	l,b
+			jr	z,L6d76
+			adc	a,a
+			push	hl
+			ld	h,36h
+			inc	h
+			ld	l,d
+			add	a,e
+			sub	h
+			ld	bc,bbd0h
+			nop (2x) *
+			cp	b
+			ld	(97d5h),a
+			ld	c,h
+			sub	l
+			rst	38h
+			jp	nz,L8f01
+			dec	(hl)
+			and	e
+			jp	po,L393c
+			ld	l,e
+			cp	(hl)
+			dec	bc
+			ld	(hl),b
+			ld	b,a
+			ld	b,a
+			daa
+			sub	b
+			ld	a,d
+			and	c
+			ld	(hl),4bh
+			ld	(de),a
+			sbc	a,c
+			ld	d,h
+			inc	bc
+			ld	c,5bh
+			di
+			ld	e,(hl)
+			ld	c,l
+			ld	(0bfdh),a
+			jp	nz,L6318
+			ld	(hl),d
+			cp	3ah
+			ld	c,f5h
+			ld	l,l
+			ret	po
+			ld	h,c
+			ld	b,h
+			ret	z
+			sub	(hl)
+			add	a,c
+			sbc	a,(hl)
+			dec	b
+			xor	c
+			adc	a,(hl)
+			ld	l,2eh
+			ld	d,b
+			or	e
+			ld	b,d
+			jr	L6e4b
+			db	35h,53h,76h,3ah,61h,a7h,bch,cdh
+			db	45h,bbh,66h,32h,0dh,bdh,ebh,6ah
+			db	81h,86h,4ah,bah,0eh,37h,3eh,dah
+			db	91h,b7h,92h,dfh,76h,e2h,9bh,01h
+			db	33h,6dh,41h,91h,e7h,aeh,53h,b6h
+			db	b8h,52h,1ch,f3h,56h,47h,11h,58h
+			db	fdh,00h,47h,29h,30h,ech,2dh,53h
+			db	76h,00h,30h,37h,afh,c5h,a3h,7ch
+			db	38h,1eh,d7h,0dh,cah,ebh,35h,2dh
+			db	a3h,c4h,f0h,34h,49h,ffh,66h,0eh
+			db	3ch,90h,aeh,15h
+			ld	hl,1aebh
+			jp	pe,L580a
+			or	b
+			xor	a
+			ret	p
+			cp	c
+			or	e
+			sbc	a,79h
+			ret	po
+			ld	h,l
+			bit	4,b
+			or	(hl)
+			call	po,L0f80
+			ld	h,l
+			ld	a,e
+			ld	l,e
+			ld	a,c
+			and	14h
+			ld	e,d
+			ld	l,(hl)
+			ld	c,l
+			ld	e,a
+			ld	c,h
+			inc	l
+			rst	30h
+			ld	h,d
+			ld	e,h
+			dec	bc
+			ld	l,b
+			ld	h,b
+			ld	b,e
+			sub	c
+			ld	bc,3dedh
+			call	nc,L545d
+			ld	e,f0h
+			dec	h
+			halt
+			ld	b,b
+			jr	z,L6e3b
+			ccf
+			pop	hl
+			ex	de,hl
+			rlca
+			jr	nc,L6e9e
+			inc	l
+			add	hl,de
+			add	a,e
+			call	L9e8a
+			rst	08h
+			call	L3bb1
+			cp	b
+			dec	c
+			ld	(de),a
+			or	c
+			ex	(sp),hl
+			or	b
+			sbc	a,(hl)
+			dec	(hl)
+			xor	b
+			and	a
+			sub	b
+			call	m,L7eec
+			ld	c,d
+			nop (2x) *
+			add	a,a
+			call	nz,La479
+			ld	c,a
+			jp	z,L9230
+			rst	30h
+			sbc	a,afh
+			jp	c,L43f5
+			add	a,h
+			ld	h,(hl)
+			ld	l,a
+			cpl
+			ld	(hl),c5h
+			and	(hl)
+			ret	po
+			jr	c,L6e9a
+			push	hl
+			add	a,b
+			push	af
+			di
+			pop	hl
+			dec	d
+			xor	e
+			or	(hl)
+			set	7,c
+			bit	1,b
+			adc	a,bch
+			ld	a,(bc)
+			ld	b,h
+			ret	m
+			push	de
+			ld	h,e
+			ld	h,h
+			dec	de
+			xor	h
+			ld	a,e
+			or	e
+			ld	h,l
+			ret	nc
+			ld	h,h
+			adc	a,e
+			sbc	a,(ix + e8h)
+			dec	l
+			sbc	a,(hl)
+			ld	e,d
+			dec	c
+			ld	c,36h
+			exx
+			ld	a,d
+			ld	c,c
+			inc	l
+			ld	a,(bc)
+			ld	(efdch),a
+			ld	a,(hl)
+			sub	43h
+			add	hl,bc
+			ret	p
+			cpl
+			jp	(hl)
+			db	14h,68h,8dh,0fh,cbh,28h,a6h,eeh
+			db	abh,02h,f3h,16h,d2h,30h,39h,c7h
+			db	2ch,97h,9ch,30h,33h,54h,e9h,3ah
+			db	a4h,9ch,0eh,f9h,02h,d6h,6fh,89h
+			db	b5h
+			ld	bc,fa2dh
+			pop	af
+			ret	m
+			dec	d
+			jp	po,L1780
+			ld	(2d0ch),hl
+			add	a,ach
+			or	c
+			ld	b,l
+			cp	h
+			sub	a0h
+			or	b
+			ld	c,h
+			ld	a,d
+			ld	b,02h
+			ld	a,b
+			ld	c,e
+			rst	08h
+			sub	d
+			ld	b,d
+			call	m,L0270
+			ld	d,35h
+			and	abh
+			jp	pe,Lae98
+			ld	l,l
+			jp	m,Lde88
+			add	a,b
+			call	po,L666f
+			adc	a,d
+			xor	l
+			ex	af,af'
+			inc	b
+			ld	b,e
+			or	h
+			inc	a
+			inc	de
+			and	a
+			ld	hl,(5590h)
+			rlca
+			add	a,d
+			xor	d
+			sbc	a,a
+			ld	c,h
+			inc	d
+			rst	10h
+			jp	z,L9468
+			ld	c,d
+			ld	d,b
+			dec	l
+			dec	c
+			ld	(hl),aeh
+			daa
+			ld	a,(bc)
+			call	L14f7
+			ld	b,e
+			pop	de
+			sbc	a,(hl)
+			ld	d,b
+			dec	b
+			inc	(hl)
+			dec	d
+			call	pe,La971
+			ex	af,af'
+			xor	a
+			rst	38h
+			or	b7h
+			ccf
+			cp	e
+			halt
+			jp	(hl)
+			db	e4h,8ch,d1h,1dh,1dh,77h,c2h,06h
+			db	7dh,82h,4eh,89h,76h,74h,e3h,3fh
+			db	f9h,86h,e9h,56h,c2h,8bh,f1h,edh
+			db	bbh,84h,d5h,cfh,feh,93h,3fh,86h
+			db	f5h,55h,ddh,fah,b2h,d9h,edh,08h
+			db	50h,96h,23h,f8h,18h,94h,e2h,8ch
+			db	f1h,6eh,9bh,5ah,21h,46h,d7h,00h
+			db	95h,2dh,52h,c3h,cdh,0dh,75h,98h
+			db	28h,5ah,f7h,67h,8eh,7ch,bdh,19h
+			db	d1h,d2h,adh,21h,81h,aeh,8bh,a8h
+			db	6eh,78h,e8h,05h,b7h,5ch,93h,59h
+			db	a5h,b6h,61h,53h,c3h,efh,d8h,00h
+			db	fch,12h,01h,5bh,91h,8bh,e7h,beh
+			db	99h,45h,1ch,3eh,73h,6fh,78h,bbh
+			db	b7h,16h,c2h,f4h,e7h,48h,1dh,5fh
+			db	f8h,4ah,85h,dfh,7eh,f8h,79h,50h
+			db	59h,6ah,a9h,83h,78h,1dh,82h,a0h
+			db	25h,bdh,b8h,28h,32h,04h,dbh,4fh
+			db	86h,f8h,63h,5ah,2fh,3ch,c4h,7dh
+			db	adh,e2h,38h,a5h,91h,64h,04h,a1h
+			db	14h,5fh,73h,c1h,34h,49h,e6h,b3h
+			db	a9h,c7h,e3h,7ch,48h,70h,95h,8dh
+			db	2fh,3fh,5bh,87h,4ch,43h,56h,65h
+			db	19h,a0h,e1h,7eh,59h,bah,6eh,78h
+			db	30h,a1h,89h,66h,58h,aah,7dh,9eh
+			db	a2h,1dh,bch,79h,f7h,a2h,79h,fch
+			db	beh,e7h,dbh,81h,02h,bfh,58h,3fh
+			db	d4h,74h,2fh,dfh,5dh,7eh,24h,04h
+			db	7bh,7ch,afh,99h,5fh,8ch,3eh,16h
+			db	ach,50h,a2h,3ch,cch,9ah,d4h,2bh
+			db	f4h,cah,49h,51h,3ch,20h,f2h,e2h
+			db	25h,c7h,85h,23h,20h,f1h,a3h,04h
+			db	53h,4ah,8eh,23h,cbh,57h,1fh,bbh
+			db	7ch,dch,3fh,78h,fdh,cfh,50h,90h
+			db	08h,abh,34h,70h,b9h,29h,f3h,95h
+			db	fdh,7dh,a1h,08h,bdh,6bh,8ch,85h
+			db	8eh,21h,38h,c0h,31h,0eh,c8h,76h
+			db	30h,e2h,4fh,45h,efh,d3h,3ch,efh
+			db	cbh,4fh,e3h,a8h,09h,00h,99h,19h
+			db	83h,4eh,88h,2dh,0dh,d5h,63h,3bh
+			db	e4h,23h,36h,a4h,3ch,d3h,5ah,36h
+			db	8bh,03h,2eh,66h,e1h,41h,78h,40h
+			db	20h,1ch,a3h,2fh,9fh,03h,7fh,38h
+			db	33h,64h,21h,e1h,52h,c3h,05h,97h
+			db	f7h,f0h,5bh,27h,a2h,37h,c3h,34h
+			db	65h,45h,bch,59h,deh,48h,8ch,76h
+			db	e0h,2fh,e5h,f4h,9dh,3bh,85h,49h
+			db	2fh,cch,ebh,5ch,cah,b9h,efh,a8h
+			db	64h,25h,0ch,f9h,edh,20h,dfh,33h
+			db	42h,6fh,79h,8eh,71h,85h,8dh,b5h
+			db	46h,1ah,29h,f7h,fch,1ch,8ah,3ah
+			db	40h,90h,28h,1fh,e2h,8dh,40h,16h
+			db	99h,d9h,dch,e9h,a3h,a2h,dch
+			ld	h,b
+			add	hl,bc
+			or	2ah
+			ld	e,c
+			ld	a,65h
+			or	c
+			ld	c,b
+			xor	d
+			add	a,28h
+			jp	z,Lda37
+			ret	z
+			ld	d,a
+			ld	(bc),a
+			ld	b,(hl)
+			ex	(sp),hl
+			and	d
+			cp	b
+			ld	(hl),e
+			ld	a,b
+			ld	d,h
+			set	1,d
+			jp	m,L8373
+			ld	l,h
+			inc	a
+			xor	h
+			jp	m,Lfafd
+			dec	a
+			or	h
+			scf
+			ld	(hl),c
+			sub	(hl)
+			push	hl
+			cp	d
+			ld	a,l
+			cp	(hl)
+			jp	z,L46fd
+			ld	(6087h),a
+			and	h
+			xor	a
+			rst	08h
+			push	bc
+			xor	c
+			ld	(de),a
+			ld	c,b
+			cp	l
+			adc	a,e
+			ld	l,a
+			sub	(hl)
+			and	c
+			and	e
+			inc	bc
+			ex	de,hl
+			or	a
+			cp	b
+			nop
+			or	a
+			jr	nc,L70f5
+			call	p,L94a3
+			ld	hl,93aeh
+			ld	a,c
+			add	a,(hl)
+			ld	e,h
+			ld	d,(hl)
+			and	l
+			ld	a,a
+			ld	hl,(4d73h)
+			add	hl,hl
+			rla
+			ld	a,d
+			ld	c,l
+			sub	c
+			ld	e,c
+			adc	a,d
+			ld	e,b
+			call	nz,L8417
+			ld	a,l
+			ld	l,l
+			or	c
+			add	a,(hl)
+			ld	l,l
+			or	d
+			rra
+			ret	i *
+			cp	h
+			add	hl,bc
+			ld	c,c
+			ld	h,a
+			ld	(ff15h),hl
+			ld	c,b
+			adc	a,c
+			ld	e,d
+			sbc	a,d
+			ld	a,c
+			dec	b
+			dec	a
+			inc	(hl)
+			rst	38h
+			ld	h,l
+			ex	af,af'
+			ret	c
+			or	d
+			ld	hl,f54ch
+			rst	18h
+			ld	b,(hl)
+			or	l
+			push	de
+			ld	h,e0h
+			adc	a,74h
+			ld	l,d
+			ld	e,b
+			ld	h,l
+			ld	(538fh),a
+			call	pe,L6a00
+			adc	a,c
+			add	hl,hl
+			add	a,(hl)
+			and	h
+			in	a,(50h)
+			rst	28h
+			call	nz,L8f99
+			rst	00h
+			cp	l
+			jp	nz,L3b2e
+			push	af
+			ret	m
+			rst	00h
+			ld	b,l
+			ld	d,d
+			adc	a,1ch
+			and	(hl)
+			ld	a,(hl)
+			inc	a
+			ld	e,d
+			xor	d9h
+			or	(hl)
+			dec	sp
+			jr	z,L71dc
+			exx
+			rst	20h
+			ld	(bc),a
+			halt
+			or	d
+			ld	e,e
+			ld	e,d
+			jp	po,L172d
+			ld	h,h
+			call	c,Lb7af
+			ld	c,a
+			and	h
+			cp	l
+			ld	l,h
+			rla
+			ld	h,b
+			sub	e
+			sub	c
+			or	a
+			sbc	a,b
+			ld	(hl),d
+			ld	bc,32ech
+			inc	e
+			ld	(hl),b
+			or	l
+			ret	nz
+			nop
+			sub	h
+			sbc	a,80h
+			ld	h,h
+			ld	a,h
+			ld	d,d
+			ld	c,a
+			or	h
+			sbc	a,l
+			call	po,Le65d
+			ld	b,l
+			or	b
+			ld	d,c
+			ld	a,17h
+			ld	a,(hl)
+			ld	b,c
+			push	de
+			sbc	a,c
+			ld	hl,(ab76h)
+			out	(7ah),a
+			rst	30h
+			adc	a,l
+			ld	a,(hl)
+			and	h
+			rrca
+			inc	a
+			ld	(bc),a
+			ld	d,b
+			ld	sp,e13ch
+			ld	h,h
+			exx
+			ld	e,d
+			adc	a,86h
+			ld	b,h
+			dec	l
+			ld	d,c4h
+			cp	c
+			add	a,(hl)
+			jr	nz,L725d
+			push	de
+			call	c,La4a5
+			ld	h,96h
+			cp	f1h
+			ret	pe
+			sub	d
+			ld	(hl),d7h
+			sub	d
+			ld	h,b
+			add	a,(hl)
+			sub	h
+			set	4,e
+			call	nc,La193
+			ld	b,(hl)
+			ld	a,3bh
+			jp	po,L1046
+			jr	nz,L7250
+			jp	po,Ld3df
+			sub	h
+			add	hl,sp
+			ld	a,c
+			ld	l,b1h
+			inc	h
+			ld	h,d
+			rst	30h
+			inc	c
+			ld	c,c
+			rl	e
+			jr	nc,L7286
+			or	e
+			cp	l
+			ld	(hl),c
+			ld	h,b
+			cp	b
+			ld	e,e
+			rst	28h
+			ld	h,l
+			add	hl,bc
+			ld	b,b
+			ld	h,e
+			ret	p
+			or	e
+			add	hl,hl
+			dec	c
+			and	(hl)
+			jp	z,Lbf38
+			and	a
+			sbc	a,d
+			add	a,h
+			or	(hl)
+			ld	a,a
+			sbc	a,(hl)
+			ld	e,l
+			pop	de
+			push	bc
+			ld	d,b
+			adc	a,51h
+			ld	a,(b530h)
+			add	a,d
+			jr	L71e5
+			db	7dh,82h
+			add	a,d
+			ret	po
+			cp	l
+			sbc	a,h
+			dec	(hl)
+			ret	pe
+			ld	bc,a211h
+			sub	88h
+			ld	h,h
+			ld	b,(hl)
+			ld	a,l
+			xor	b
+			ld	c,0fh
+			and	h
+			ld	l,b
+			ld	b,d
+			push	de
+			ld	l,d
+			ld	e,a
+			inc	de
+			call	pe,L1ca7
+			ld	a,b
+			and	b
+			ex	de,hl
+			ld	h,04h
+			ld	l,a
+			jr	c,L7214
+			sub	b
+			rrca
+			pop	hl
+			ld	(bc),a
+			jr	nz,L7239
+			ld	de,14cfh
+			ld	(hl),e
+			add	hl,de
+			ld	e,c
+			inc	(hl)
+			ret	nc
+			add	a,b
+			jp	c,La1a9
+			jr	c,L72a9
+			call	c,L3341
+			ld	l,a
+			xor	(hl)
+			cp	94h
+			and	f1h
+			ld	e,c
+			di
+			inc	h
+			ret	z
+			in	a,(ech)
+			pop	bc
+			pop	hl
+			adc	a,e
+			ld	b,a
+			sbc	a,b
+			pop	af
+			jp	m,Lfe3e
+			sbc	a,b
+			nop
+			adc	a,h
+			out	(bfh),a
+			cp	l
+			sub	(hl)
+			di
+			ld	(bc),a
+			add	a,l
+			ld	h,e
+			cp	h
+			ld	(hl),h
+			ld	b,52h
+			adc	a,b
+			rla
+			rst	18h
+			ld	h,d
+			inc	a
+			or	(hl)
+			ld	l,(hl)
+			di
+			sub	a
+			ld	b,a
+			ld	e,l
+			xor	h
+			ret	nz
+			ld	a,a
+			sub	l
+			ld	e,l
+			rst	00h
+			nop
+			ld	(bc),a
+			inc	h
+			sbc	a,h
+			ld	a,a
+			rst	28h
+			ret	p
+			add	hl,de
+			ld	h,b
+			adc	a,l
+			dec	hl
+			ld	a,b
+			call	po,L84a7
+			ccf
+			ld	c,b
+			ret	z
+			rlca
+			sbc	a,c
+			ld	l,(hl)
+			jp	pe,L8239
+			push	bc
+			xor	(hl)
+			ld	(bc),a
+			ld	a,d
+			ld	c,e
+			ld	a,(de)
+			ld	(hl),c
+			ld	a,d
+			pop	bc
+			pop	de
+			ld	(49b0h),hl
+			add	a,(hl)
+			push	bc
+			inc	h
+			jp	nc,Lebec
+			sub	h
+			dec	l
+			ld	(de),a
+			ld	(hl),e
+			ret	m
+			push	de
+			ld	a,d
+			add	hl,de
+			ld	hl,303bh
+			jp	z,L73f5
+			add	hl,hl
+			sub	c
+			ret	p
+			ld	b,e
+			and	b
+			add	a,d
+			add	a,l
+			ld	h,1dh
+			and	b
+			ld	bc,1ab4h
+			call	nc,L729e
+			jp	m,L7284
+			call	pe,L1cfc
+			inc	sp
+			ld	e,l
+			ld	b,d
+			inc	(hl)
+			ld	b,l
+			jp	(hl)
+			db	21h,55h,d1h,9ah,eeh,53h,88h,f5h
+			db	58h,55h,21h,e3h,4ch,8dh,e6h,8eh
+			db	84h,13h,9eh,5ah,38h,5bh,11h,a3h
+			db	20h,b3h,f1h,83h,dah,a4h,34h
+			ld	c,d
+			xor	(hl)
+			or	l
+			add	hl,de
+			exx
+			cp	h
+			ld	l,ech
+			ld	d,e
+			cp	c
+			pop	de
+			ld	l,a
+			ld	e,b
+			ld	a,h
+			ld	sp,1673h
+			ld	e,e
+			ld	c,e
+			adc	a,a
+			or	a
+			di
+			ld	b,d
+			or	e
+			dec	(hl)
+			inc	l
+			ld	c,e
+			pop	hl
+			ret	nc
+			ld	d,80h
+			jr	L72da
+			db	96h,94h,41h,05h,cch,63h,62h,8fh
+			db	a9h,d2h
+			ld	b,l
+			call	pe,L6d7a
+			inc	bc
+			ex	de,hl
+			ld	a,66h
+			ld	e,h
+			ld	d,c
+			call	pe,L4efd
+			ret	p
+			halt
+			sbc	a,b
+			ld	d,l
+			ld	(hl),h
+			cp	e
+			inc	d
+			ld	(hl),8dh
+			jp	L879b
+			db	51h,dfh,beh,a3h,e3h,03h,d6h,8bh
+			db	f8h,b9h,01h,efh,36h,02h,abh,ffh
+			db	b8h,5fh,10h,64h,c9h,cfh,e9h,b8h
+			db	6dh,e1h,3eh,a1h,7dh,85h,28h,8bh
+			db	f6h,81h,cch,49h,f5h,a8h,3eh,92h
+			db	77h,e7h,b2h,88h,76h,2ah,72h,dfh
+			db	dbh,79h,c5h,ebh,35h,34h,0ah,53h
+			db	f1h,51h,68h,63h
+			adc	a,b
+			ld	e,c
+			ld	h,e
+			sub	d
+			and	d
+			ld	h,l
+			xor	b
+			push	bc
+			ld	h,b
+			inc	de
+			or	h
+			ld	c,d
+			ld	d,l
+			add	a,c
+			sub	c
+			ld	b,h
+			or	a
+			dec	sp
+			sub	c
+			ld	c,a
+			sub	l
+			ld	(de),a
+			adc	a,bbh
+			out	(0fh),a
+			ld	l,a
+			sbc	a,d
+			ld	l,b
+			cp	l
+			add	iy,de
+			add	a,l
+			ld	a,(hl)
+			jp	nz,Lecc7
+			out	(c6h),a
+			ld	h,c
+			jr	nz,L73ba
+			ld	h,e
+			add	hl,sp
+			ld	a,(bc)
+			sub	l
+			ld	h,efh
+			ld	l,05h
+			xor	b
+			ld	l,b
+			ld	d,13h
+			pop	af
+			ld	c,b
+			ld	a,d
+			inc	a
+			ld	b,b
+			ld	b,e
+			ld	e,c
+			add	a,l
+			xor	l
+			dec	d
+			jp	pe,L94e2
+			adc	a,h
+			inc	b
+			ld	bc,c302h
+			sbc	a,9eh
+			ld	(hl),c
+			ld	a,c
+			ld	l,d
+			ld	b,h
+			ld	a,c
+			and	d
+			adc	a,b
+			ld	h,c
+			add	a,a
+			ld	c,a
+			dec	h
+			call	nc,L9e9f
+			ld	(hl),b
+			jp	nc,L1c6f
+			ld	b,h
+			jp	pe,Lb888
+			xor	b
+			call	nc,L0e3b
+			sub	c
+			daa
+			daa
+			ex	af,af'
+			ld	d,d
+			cp	a
+			rst	38h
+			adc	a,a
+			ld	l,a
+			ld	e,a
+			jp	c,Ld13a
+			sbc	a,h
+			cp	l
+			ld	(d7e7h),a
+			sub	(hl)
+			ld	(hl),a
+			jr	nz,L7420
+			ei
+			ld	(hl),h
+			sbc	a,h
+			adc	a,89h
+			and	43h
+			ld	h,e
+			ld	l,d
+			ex	(sp),hl
+			ld	b,d
+			jr	L741d
+			db	a7h,42h,e2h,feh,1bh,5fh,80h,aah
+			db	46h,8fh,77h,eah,8ch,f9h,f6h,cah
+			db	bfh,37h,21h,88h,28h,47h,95h,8eh
+			db	f0h,c4h,a3h,cfh,deh,1bh,4ah,6ah
+			db	42h,69h,31h,85h,bch,a9h,55h,06h
+			db	5dh,d6h,b2h,26h,d0h,2eh,c2h,19h
+			db	35h,f9h,14h,f1h,8fh
+			inc	h
+			ld	hl,0405h
+			dec	h
+			ex	af,af'
+			cp	c
+			jp	m,La3f7
+			and	e
+			ld	h,e
+			ld	a,e
+			or	(hl)
+			ex	de,hl
+			jp	(hl)
+			db	d1h,d2h,c7h,d1h,adh,bfh,a8h,64h
+			db	17h,9ah,a5h,6dh,65h,adh,cah,48h
+			db	77h,c2h,78h,afh,c5h,8dh,c6h
+			inc	l
+			rst	30h
+			ld	h,l
+			inc	e
+			dec	c
+			ld	b,l
+			inc	sp
+			add	a,b
+			rst	08h
+			push	de
+			ld	(hl),l
+			rra
+			and	c
+			ld	(hl),d
+			exx
+			add	hl,hl
+			ld	d,a
+			ccf
+			ld	d,d
+			add	hl,sp
+			add	a,b
+			ret	nz
+			ld	sp,722bh
+			sub	a
+			sub	a
+			ld	e,e
+			ld	e,d
+			sub	l
+			ld	b,h
+			ret
+			db	03h,00h,5ah,bdh,36h,5fh,7ah
+			ld	(hl),8fh
+			ld	a,h
+			ret	nz
+			dec	b
+			cp	e9h
+			xor	b
+			and	b
+			ld	(hl),b
+			sub	h
+			pop	hl
+			and	e1h
+			jp	z,Le2a7
+			push	hl
+			ld	b,d
+			and	d
+			dec	e
+			rla
+			or	h
+			sbc	a,b
+			sub	b
+			rrca
+			cp	26h
+			and	h
+			dec	e
+			sub	d
+			rst	28h
+			or	l
+			ld	a,(91ffh)
+			exx
+			dec	bc
+			ret	po
+			halt
+			ld	sp,hl
+			push	bc
+			ld	c,(hl)
+			ret	nc
+			call	c,L1684
+			ld	e,e
+			ld	h,c
+			call	L5647
+			sbc	a,b
+			jr	nc,L7496
+			ld	b,efh
+			ld	hl,(86d4h)
+			call	po,Ldfe3
+			ld	l,c
+			rrca
+			sbc	a,e
+			sub	51h
+			pop	de
+			ret	nc
+			ld	a,b
+			inc	de
+			ld	(hl),e
+			ld	a,(9c73h)
+			cp	(hl)
+			inc	h
+			ld	h,d
+			xor	l
+			rra
+			sbc	a,e
+			in	a,(7fh)
+			ld	e,c
+			ld	a,(bc)
+			or	b
+			ld	(bc),a
+			call	m,L098a
+			and	b
+			or	e
+			nop
+			ex	de,hl
+			ld	h,a
+			jr	nc,L7508
+			and	b
+			ld	b,d
+			and	h
+			rst	08h
+			ld	b,b
+			cpl
+			inc	b
+			rst	08h
+			adc	a,(hl)
+			rst	38h
+			ld	b,h
+			sbc	a,c
+			ld	a,b
+			jp	pe,L3116
+			ld	a,a
+			jp	nz,Le03d
+			ld	c,e
+			dec	b
+			sub	h
+			adc	a,b
+			ret	c
+			daa
+			ld	d,(hl)
+			ld	c,a
+			ex	af,af'
+			ld	d,h
+			ld	c,e
+			inc	sp
+			ld	e,l
+			ld	h,l
+			jp	pe,L029c
+			jr	c,L74d7
+			cp	c
+			jp	c,L2ee6
+			push	de
+			adc	a,e
+			jp	po,Ld7d9
+			sbc	a,21h
+			add	a,c
+			ld	(hl),a
+			ld	a,b
+			ld	e,h
+			jp	p,Lecc5
+			dec	sp
+			inc	hl
+			ret	nc
+			or	b
+			jr	nz,L7594
+			ld	d,e
+			halt
+			ld	(hl),h
+			ld	(hl),h
+			ld	b,d6h
+			sbc	a,60h
+			ld	e,d
+			halt
+			ld	c,a
+			cp	d
+			xor	e
+			sbc	a,h
+			ld	a,(hl)
+			or	e
+			ld	b,c
+			cp	a
+			and	a
+			inc	h
+			push	hl
+			adc	a,a
+			exx
+			ld	c,e
+			ld	a,l
+			dec	e
+			adc	a,b
+			sub	e
+			ld	e,l
+			dec	b
+			rra
+			di
+			ld	d,c
+			cp	c
+			ld	d,ffh
+			inc	a
+			scf
+			rst	18h
+			xor	h
+			ld	e,c
+			ex	de,hl
+			ld	(hl),d
+			ld	d,e
+			ex	(sp),hl
+			jp	z,L0d93
+			ld	d,l
+			pop	hl
+			xor	d
+			ld	a,l
+			ld	a,e8h
+			cp	b
+			adc	a,b
+			ld	hl,b36eh
+			ld	(17b2h),a
+			cp	a
+			sbc	a,(hl)
+			ld	b,e
+			jp	z,Ladda
+			di
+			ret	nz
+			jp	c,Ldda1
+			dec	e
+			adc	a,44h
+			ld	e,e
+			ld	(hl),e
+			sub	2bh
+			ld	a,c
+			add	hl,de
+			ld	b,a
+			ld	l,(hl)
+			or	d
+			sbc	a,31h
+			rst	00h
+			adc	a,e
+			add	a,(hl)
+			ld	b,9eh
+			jp	pe,L7b51
+			jp	z,L9663
+			ret	nc
+			add	a,6bh
+			ld	a,h
+			ld	h,b
+			ld	h,c
+			add	hl,de
+			ld	l,(hl)
+			inc	d
+			xor	h
+			ld	c,b
+			ld	h,b
+			jp	z,L6314
+			ld	a,a
+			exx
+			or	l
+			pop	af
+			sub	h
+			ld	h,a
+			ret	m
+			ld	d,e
+			push	bc
+			sbc	a,h
+			ret	z
+			pop	bc
+			pop	hl
+			ld	(c465h),hl
+			jr	L75ed
+			db	68h,b9h,b9h,6ch,f6h,09h,6ch,64h
+			db	23h
+			add	a,h
+			out	(d2h),a
+			ld	h,(hl)
+			ret	pe
+			or	a
+			ld	l,a
+			ex	(sp),hl
+			ld	a,d
+			inc	(hl)
+			call	pe,Lc0d6
+			ld	l,l
+			ld	l,c
+			jp	nc,L460c
+			ld	e,a
+			ret	nc
+			ld	hl,(f6b3h)
+			call	c,L39e6
+			adc	a,b
+			jr	nz,L75ea
+			or	e
+			add	a,3ah
+			nop (2x) *
+			ld	d,b
+			ld	l,(hl)
+			dec	de
+			cp	b
+			adc	a,a
+			pop	af
+			or	02h
+			ld	a,(bc)
+			ld	e,l
+			ld	b,03h
+			ld	b,h
+			sub	d
+			ld	c,c
+			and	l
+			and	b
+			cp	a
+			or	e
+			rst	08h
+			ret	nc
+			adc	a,b
+			ld	de,0572h
+			ld	b,f2h
+			ex	de,hl
+			ld	l,d
+			ld	d,d
+			ld	a,6eh
+			rrca
+			ld	(hl),l
+			or	d
+			ret	p
+			ld	bc,cf74h
+			sub	b
+			ld	e,l
+			ld	b,a
+			ld	c,(hl)
+			rla
+			inc	l
+			jr	c,L75f1
+			ld	h,b
+			ld	e,l
+			ld	a,44h
+			ld	b,h
+			ld	d,d
+			cpl
+			pop	de
+			ld	l,h
+			ld	sp,4e57h
+			ld	b,h
+			nop (2x) *
+			ld	b,l
+			ld	d,h
+			or	a
+			adc	a,c
+			djnz	L76b7
+			nop (2x) *
+			ld	sp,hl
+			cp	b
+			call	Lc53e
+			ld	l,b
+			ld	a,c
+			call	pe,Lf882
+			ld	c,c
+			xor	a
+			ld	(hl),l
+			ld	de,18afh
+			ld	a,c
+			ld	c,h
+			sbc	a,b
+			ld	sp,a3d1h
+			or	(hl)
+			sub	18h
+			call	pe,Le749
+			add	hl,sp
+			and	d
+			ret	nz
+			or	fbh
+			exx
+			add	a,(hl)
+			ret	nc
+			ld	c,c3h
+			ld	c,b
+			dec	d
+			ld	h,c
+			add	a,21h
+			ret	m
+			and	(hl)
+			and	h
+			add	a,55h
+			and	79h
+			ccf
+			xor	l
+			adc	a,l
+			rst	08h
+			call	p,L9996
+			and	e
+			ld	c,h
+			ld	a,b
+			dec	c
+			push	bc
+			inc	sp
+			rra
+			ex	af,af'
+			nop
+			adc	a,b
+			sub	a
+			cp	e
+			ld	a,h
+			rst	20h
+			sub	d
+			or	(hl)
+			sub	(hl)
+			ret	nz
+			ex	de,hl
+			ld	b,a
+			inc	(hl)
+			ld	l,b
+			ld	h,9ch
+			ld	sp,f4ceh
+			and	e
+			ld	e,(hl)
+			out	(99h),a
+			ld	(hl),e
+			ld	(hl),l
+			sbc	a,a
+			ex	(sp),hl
+			ld	b,b
+			ld	l,a
+			cp	h
+			rrca
+			or	(hl)
+			call	L746f
+			sub	a
+			ld	d,l
+			cp	(hl)
+			inc	c
+			add	a,a
+			sbc	a,a
+			jp	nz,L74de
+			ld	h,e
+			nop
+			ld	l,h
+			ret	nz
+			ld	c,h
+			jr	nz,L76dc
+			or	e6h
+			ex	af,af'
+			in	a,(a0h)
+			rst	18h
+			ld	d,b
+			rst	08h
+			dec	e
+			add	a,35h
+			rst	28h
+			nop
+			sbc	a,c
+			ld	(hl),a
+			ld	a,(bc)
+			ld	d,(hl)
+			or	(hl)
+			sbc	a,h
+			or	a
+			dec	sp
+			ld	a,feh
+			or	c3h
+			cp	e
+			ld	(hl),97h
+			ld	d,fah
+			ld	l,b
+			ex	af,af'
+			ld	a,e
+			xor	h
+			add	a,h
+			add	a,(hl)
+			ld	(hl),l
+			add	a,a
+			ld	e,a
+			rrca
+			cpl
+			ld	(hl),l
+			ld	e,d
+			ld	b,(hl)
+			ld	a,c
+			daa
+			ld	h,e
+			sbc	a,b
+			add	a,90h
+			ld	h,d
+			or	(hl)
+			rra
+			rst	30h
+			add	a,a
+			cp	a
+			ld	d,d
+			add	hl,de
+			res	3,(hl)
+			dec	de
+			call	nz,L4cca
+			and	e
+			call	m,Lfb56
+			ld	d,l
+			ld	(de),a
+			ld	h,e
+			inc	bc
+			adc	a,l
+			ld	b,e
+			or	d
+			inc	hl
+			ld	(hl),0eh
+			add	a,fah
+			push	af
+			or	h
+			inc	hl
+			rrca
+			and	c
+			ld	e,l
+			add	a,d
+			daa
+			ld	d,c
+			ld	(de),a
+			ld	bc,6b25h
+			ld	b,a
+			inc	b
+			add	a,57h
+			ld	(hl),bah
+			inc	d
+			and	d
+			xor	e
+			ld	e,c7h
+			cp	a
+			add	a,h
+			ld	e,d
+			add	a,d7h
+			ld	c,a
+			adc	a,l
+			and	d
+			ld	d,h
+			pop	de
+			xor	f5h
+			ld	b,e
+			ld	a,l
+			ld	c,b
+			or	5dh
+			sub	h
+			ret	z
+			ld	a,(de)
+			ei
+			call	nz,L6d44
+			jp	Le74d
+			db	5fh,7ah,e8h,01h,cfh,29h,bah,52h
+			db	adh,06h,beh,13h,f4h,46h,b4h,20h
+			db	87h,30h,87h,14h,a1h,f9h,afh,a1h
+			db	2eh,ceh,adh,e5h,1eh,d3h,37h,d5h
+			db	79h,10h,29h,4ah,23h,70h,a8h,35h
+			db	06h,68h,00h,6ch,40h,40h,ech,99h
+			db	84h,5eh,adh,0bh,aeh,b7h,1ah,c4h
+			db	28h,8dh,cch,83h,33h,02h,27h,03h
+			db	7fh,d5h,18h,07h,82h,dah,42h,28h
+			db	92h,82h,3fh,ech,74h,7ch,2eh,afh
+			db	ffh
+			ld	h,a
+			dec	b
+			jp	po,L6d46
+			ld	h,a
+			jp	m,L2fc6
+			ld	l,e
+			ld	l,b
+			ld	b,h
+			inc	a
+			res	4,l
+			scf
+			ld	b,(hl)
+			ld	b,(hl)
+			or	a
+			sub	h
+			jp	m,La37f
+			nop (2x) *
+			ret	nz
+			ld	a,(bc)
+			ld	h,e
+			rst	30h
+			or	a
+			ld	(a732h),a
+			ld	d,b
+			or	d
+			halt
+			ex	de,hl
+			halt
+			ret	po
+			cp	h
+			ld	c,(hl)
+			and	b
+			ld	c,l
+			nop (2x) *
+			sbc	a,b
+			nop (2x) *
+			rst	00h
+			and	(hl)
+			dec	d
+			dec	l
+			or	08h
+			ld	d,a
+			ld	l,a
+			dec	e
+			sub	a
+			ld	(7a4fh),a
+			ld	l,a
+			ret	pe
+			add	a,c
+			rst	20h
+			ld	l,l
+			and	(hl)
+			add	a,b1h
+			rrca
+			add	a,e
+			call	nz,L3cf5
+			ld	(hl),a
+			ld	c,(hl)
+			sub	d
+			ld	b,a
+			and	h
+			pop	bc
+			or	76h
+			ld	de,52bbh
+			ld	l,b3h
+			cp	83h
+			ld	c,l
+			ccf
+			sub	d
+			jr	nz,L7850
+			add	hl,de
+			ld	a,c
+			ld	b,c
+			dec	d
+			call	L766e
+			ld	a,l
+			ld	a,b
+			inc	(hl)
+			sbc	a,c
+			ret	p
+			add	a,l
+			ld	d,7bh
+			dec	(hl)
+			ld	h,2ch
+			pop	bc
+			ret	pe
+			nop (2x) *
+			sbc	a,d
+			ld	c,h
+			sbc	a,b
+			ld	c,d
+			daa
+			cp	b7h
+			add	hl,hl
+			ret	pe
+			sbc	a,b
+			ld	h,a
+			adc	a,b
+			inc	h
+			jp	z,Lceec
+			ld	e,(hl)
+			ld	d,4ah
+			inc	c
+			add	a,b
+			ld	(L9f67),a
+			ld	a,(hl)
+			ld	h,l
+			sbc	a,h
+			ld	l,b
+			adc	a,c
+			rst	30h
+			xor	d
+			dec	d
+			nop (2x) *
+			jp	nz,L177f
+			ld	e,b
+			rst	00h
+			inc	a
+			ld	(hl),c
+			ld	l,a
+			xor	c
+			ld	a,a
+			ld	h,b
+			xor	d
+			sbc	a,h
+			ld	e,l
+			jr	z,L788f
+			ld	h,d
+			inc	b
+			ld	e,c
+			ld	(hl),c
+			ld	e,d
+			dec	d
+			ld	b,b
+			ld	d,e
+			ret	po
+			exx
+			in	a,(66h)
+			dec	e
+			ret	nc
+			cpl
+			ld	l,a
+			sub	b
+			add	a,36h
+			ld	c,c
+			ld	a,b
+			ex	(sp),hl
+			ld	a,(bc)
+			ld	d,f8h
+			ld	h,l
+			ex	af,af'
+			ld	h,c
+			inc	b
+			sub	c
+			adc	a,l
+			ld	c,l
+			add	iy,bc
+			xor	c
+			rst	20h
+			ld	b,a
+			ld	h,c
+			sbc	a,h
+			jr	nc,L783f
+			ld	de,1518h
+			ld	(931bh),a
+			ccf
+			ret	z
+			ld	sp,f184h
+			ld	d,l
+			xor	a
+			cp	e
+			daa
+			ld	h,(hl)
+			push	af
+			sbc	a,(hl)
+			inc	hl
+			di
+			ld	c,h
+			dec	de
+			sub	(hl)
+			ld	e,cch
+			inc	b
+			ld	(hl),d
+			push	hl
+			jr	L78d6
+			db	0dh,54h,c5h,55h,3dh,d1h,b5h,6ch
+			db	9dh,00h,efh,bdh
+			rrca
+			call	pe,L5a5c
+			ret	nc
+			dec	sp
+			jp	m,L3138
+			ld	h,d
+			ld	de,7533h
+			jr	nz,L78a9
+			add	hl,de
+			ld	c,a
+			add	a,e
+			ld	h,a
+			sub	e
+			adc	a,h
+			cp	h
+			adc	a,a
+			ld	l,h
+			ld	a,(de)
+			ld	b,d
+			ld	(hl),e
+			sub	c8h
+			ex	af,af'
+			push	bc
+			ret	z
+			ld	d,c
+			call	m,Lfa95
+			or	25h
+			out	(0fh),a
+			add	a,c
+			call	c,Laef8
+			ret	m
+			pop	bc
+			cp	(ix + b2h)
+			add	a,c
+			ld	h,l
+			ret
+			db	6ah,3bh,f8h,dah,a6h,7fh,18h,69h
+			db	e8h,c0h,86h,1fh,cbh,9dh,73h,23h
+			db	e4h,2eh,67h
+			out	(ffh),a
+			ld	de,cbbeh
+			pop	hl
+			ld	bc,87a8h
+			ld	b,(hl)
+			ld	(hl),a
+			sbc	a,(hl)
+			and	a3h
+			ld	b,c
+			ld	(hl),c
+			ei
+			sub	h
+			cp	h
+			di
+			ld	sp,hl
+			in	a,(55h)
+			ld	a,b
+			add	a,20h
+			cp	e
+			or	5eh
+			ret	pe
+			pop	de
+			inc	c
+			and	e
+			call	m,La995
+			ld	b,d
+			ex	de,hl
+			xor	c
+			or	h
+			cpl
+			add	a,b
+			rst	10h
+			ld	(hl),a5h
+			cpl
+			rst	20h
+			ld	c,h
+			ld	a,h
+			adc	a,e
+			xor	l
+			and	e9h
+			sub	h
+			ld	a,(hl)
+			and	e
+			in	a,(71h)
+			add	a,a
+			ld	hl,(7f89h)
+			inc	de
+			add	a,a
+			ld	(hl),b
+			exx
+			ld	h,d
+			xor	e
+			push	de
+			ld	e,l
+			pop	af
+			rst	18h
+			exx
+			sbc	a,e
+			and	c
+			call	pe,Lce14
+			dec	d
+			ld	d,h
+			xor	a
+			cp	e
+			xor	b3h
+			xor	c
+			ei
+			ld	sp,fb62h
+			xor	b
+			ld	e,(hl)
+			or	d
+			ld	(4448h),hl
+			jp	z,L7cde
+			jr	nc,L790a
+			ld	a,c
+			ld	(hl),a
+			ld	c,l
+			jr	nz,L7949
+			cp	h
+			ld	b,b
+			ld	b,b
+			call	L5dbb
+			ld	(bc),a
+			dec	b
+			jr	nc,L78e9
+			rst	30h
+			cp	a
+			ret	pe
+			ld	l,a2h
+			ld	a,(5e51h)
+			and	e
+			ret	m
+			jr	z,L7997
+			ld	hl,(606fh)
+			ld	a,h
+			ccf
+			and	l
+			ld	c,b
+			pop	bc
+			xor	c
+			add	a,e
+			cp	c
+			ld	hl,(3d3bh)
+			ld	e,ech
+			dec	de
+			cp	c
+			daa
+			nop (2x) *
+			call	c,L6275
+			ld	l,h
+			ld	d,e
+			inc	b
+			ld	(94c5h),a
+			ld	d,b
+			rrc	h
+			dec	c
+			ret	po
+			and	h
+			xor	l
+			ld	e,a
+			sbc	a,a
+			ld	b,a
+			and	(hl)
+			adc	a,d
+			dec	a
+			nop (2x) *
+			ld	e,b
+			out	(9ah),a
+			jp	L740b
+			db	d6h,c2h,6ah,bfh,ech,45h,18h,b1h
+			db	8ah,19h
+			ld	h,(hl)
+			ld	h,(hl)
+			and	e
+			call	pe,L8d0a
+			ld	(c023h),hl
+			daa
+			set	1,(hl)
+			ld	(hl),d
+			ld	b,(hl)
+			or	l
+			or	a
+			djnz	L7992
+			ld	l,f8h
+			ld	bc,d718h
+			call	L2a8b
+			rst	28h
+			rla
+			push	de
+			call	nc,L58b4
+			add	hl,bc
+			jp	(hl)
+			db	d8h,9ah,56h,5bh,80h,a8h,e8h,5bh
+			db	eeh,e0h,c2h,afh,04h,cch,d9h,65h
+			db	37h,68h,85h,65h,77h,54h,0fh,86h
+			db	dch,d4h,cbh,e0h,43h,dfh,49h,23h
+			db	16h,52h,0eh,26h,d9h,95h,abh,18h
+			db	46h,71h,73h,51h,eah,50h,16h,28h
+			db	a9h,65h,27h,7fh,a6h,dch,75h,2fh
+			db	29h,6ah,9ch,83h,84h,c7h,f3h,cbh
+			db	b9h,a7h,ach,abh,a1h,fch,79h,5ch
+			ld	l,a
+			or	a
+			ld	a,l
+			rst	10h
+			ld	(de),a
+			sbc	a,e
+			ld	e,b
+			ld	h,bdh
+			dec	b
+			rst	28h
+			ex	(sp),hl
+			ld	hl,(10e4h)
+			ld	l,d
+			ld	d,e
+			ex	(sp),hl
+			jp	pe,Lc417
+			add	a,d
+			xor	e
+			adc	a,b
+			ld	a,d
+			and	l
+			ld	c,b
+			ld	(hl),d
+			jp	L9886
+			db	e9h,e3h,39h,9bh,9eh,c3h,d7h,7dh
+			db	a8h,8eh,f2h,41h,e1h,4ah,85h,32h
+			db	2fh,22h,b9h,adh,e4h,19h,a3h,21h
+			db	f7h,04h,bch,b6h,89h,7dh,35h,31h
+			db	c5h,66h,55h,5bh,bfh,29h,b0h,65h
+			db	22h,a8h,fah,28h,3ch,58h,c6h,16h
+			db	dfh,15h,e6h,a2h,18h,06h,8ah,2eh
+			db	7ch,78h,a8h,8ah,ebh,17h,bah,afh
+			db	00h,13h,f2h,e5h,cfh,bdh,ceh,67h
+			sub	c
+			ld	l,c
+			adc	a,h
+			ld	c,b
+			xor	c
+			call	c,L4644
+			adc	a,(hl)
+			jp	nz,L4743
+			ld	(hl),d
+			ei
+			rst	18h
+			inc	d
+			dec	c
+			add	a,c
+			or	c
+			jp	pe,L459e
+			pop	bc
+			add	hl,de
+			ld	(hl),a
+			ld	l,(hl)
+			ld	h,e
+			or	a
+			dec	bc
+			ret	po
+			sub	(hl)
+			cp	l
+			ld	d,l
+			or	e
+			ld	e,c
+			ld	(hl),c
+			ld	h,d
+			ld	b,c
+			ld	h,e
+			ld	(de),a
+			pop	hl
+			add	hl,hl
+			ret	pe
+			ret	pe
+			and	h
+			ld	d,c
+			ld	b,b
+			and	0ah
+			ld	l,e
+			add	a,a
+			ld	h,d
+			xor	d
+			ld	h,d
+			jr	nc,L7adb
+			rlca
+			and	e
+			jr	z,L7b0a
+			ld	c,65h
+			ld	a,c
+			daa
+			ret
+			db	1fh,e2h,19h,e0h,03h,51h,4bh,aeh
+			db	d5h,d7h,b9h,d8h,73h,59h
+			ld	e,h
+			sub	l
+			and	75h
+			sbc	a,e
+			call	po,L0d6f
+			ld	h,h
+			ld	l,c
+			ex	af,af'
+			ld	(hl),c
+			sll	l
+			sub	e
+			rst	08h
+			and	d
+			xor	a
+			rst	30h
+			ld	e,d
+			add	a,d
+			adc	a,d
+			jr	L7b30
+			db	86h,d1h,e1h,29h,28h,abh,a0h,e7h
+			db	a2h,9fh,57h,96h,d1h,afh,6eh,e1h
+			db	d4h
+			ld	b,(hl)
+			inc	a
+			push	bc
+			or	c
+			ld	l,e
+			ld	l,c
+			add	hl,de
+			ld	l,0bh
+			rlca
+			ex	de,hl
+			dec	a
+			dec	a
+			jp	Lb7f2
+			db	5eh,58h,a0h,d4h,cbh,3dh,9fh
+			sub	d
+			ld	c,b
+			ld	c,e
+			ld	h,l
+			rrca
+			sub	c
+			jp	L94dc
+			db	abh,98h,61h,46h,f2h,6fh,6bh,71h
+			db	94h,34h
+			ld	b,d
+			ld	d,h
+			push	hl
+			sub	l
+			add	a,a
+			jr	c,L7ab2
+			cp	c
+			call	L099d
+			ei
+			ld	h,(hl)
+			cpl
+			sbc	a,(hl)
+			ld	e,h
+			ld	hl,966ah
+			cp	c
+			xor	e
+			ld	sp,830ch
+			inc	de
+			ld	bc,42b6h
+			ld	c,b
+			ret	p
+			or	d
+			push	af
+			add	a,b
+			ld	d,b
+			ld	l,h
+			cp	a
+			ld	l,e
+			daa
+			ld	e,e
+			ld	d,e
+			pop	af
+			jp	(hl)
+			db	1dh
+			rra
+			or	l
+			ld	c,l
+			ld	sp,hl
+			ld	d,2dh
+			or	73h
+			push	af
+			ld	(a8dah),hl
+			or	d
+			add	a,c3h
+			adc	a,(hl)
+			adc	a,b
+			inc	de
+			and	h
+			nop
+			or	d
+			ld	l,a
+			ld	c,l
+			ld	(de),a
+			pop	af
+			jr	c,L7b73
+			jp	m,Ld0e9
+			ld	h,l
+			ld	a,(fe3ah)
+			or	60h
+			inc	b
+			ret	nz
+			ld	c,e
+			ret
+			db	77h,13h,6bh,55h,3eh,79h,6fh,f7h
+			db	e8h,8ch,37h,a7h,7dh,4ch,fch,86h
+			db	57h,a4h,b6h,2ch,fdh,27h,0ch,65h
+			db	9fh,b7h,4eh
+			or	c
+			ld	h,b
+			or	c
+			ret	nz
+			sbc	a,c
+			jr	c,L7b8a
+			ld	l,8eh
+			ld	c,(hl)
+			sub	(hl)
+			ld	c,e
+			rst	28h
+			ld	c,d
+			pop	de
+			jp	z,L2a09
+			ld	b,a
+			sbc	a,h
+			dec	a
+			ld	b,(hl)
+			adc	a,h
+			ex	de,hl
+			jp	m,L5c1d
+			xor	b
+			or	(hl)
+			ret	pe
+			ld	b,30h
+			dec	a
+			call	po,Lb2d0
+			ld	sp,hl
+			add	a,e
+			jp	(hl)
+			db	2ch,62h,92h,c7h,69h,9ch,54h,a0h
+			db	d0h,32h,bdh,0fh,cfh,fbh,6eh,4dh
+			db	bdh,15h,70h,7dh,aah,7ch,d7h,b5h
+			db	4dh,79h,82h,f9h,e1h,7eh,e3h,d6h
+			db	a0h,cbh,69h,83h,edh,d8h,1ah,f8h
+			db	7ah,39h,c3h,82h,25h,ceh,cbh,72h
+			db	6dh,78h,dfh,72h,bbh,81h,47h
+			xor	a
+			xor	6dh
+			inc	de
+			nop (2x) *
+			out	(00h),a
+			exx
+			add	a,h
+			cpl
+			ei
+			ld	hl,(206ch)
+			ld	h,e5h
+			in	a,(1fh)
+			ret
+			db	e4h,abh,a3h,1dh,32h,4fh,37h,08h
+			db	5fh,31h,0dh,11h,b8h,98h,cdh,68h
+			db	e8h,c3h,27h,adh,78h,8fh,64h,09h
+			db	42h,e8h,d4h,cfh,efh,18h,d8h,4fh
+			db	99h,e9h,8eh,86h,18h,e0h,55h,c3h
+			db	27h,98h,dch,a2h,05h
+			ld	b,b
+			dec	(hl)
+			ld	(de),a
+			ld	b,h
+			ex	(sp),hl
+			inc	h
+			rst	00h
+			ld	c,e
+			rlca
+			xor	b
+			ret
+			db	2dh,21h,85h,a4h,c8h,d4h
+			dec	hl
+			call	nc,L72a6
+			sub	(hl)
+			ld	d,c
+			adc	a,h
+			jp	m,L5dc1
+			ld	c,e
+			inc	hl
+			rst	30h
+			push	de
+			cpl
+			and	c
+			rst	20h
+			and	(hl)
+			ld	h,b
+			ld	a,(de)
+			cp	h
+			nop (2x) *
+			or	b
+			ld	a,b
+			pop	de
+			and	c
+			dec	l
+			ld	d,c
+			ret	nc
+			add	a,l
+			ld	b,78h
+			rst	28h
+			ld	d,c
+			ld	h,e
+			add	a,d
+			ld	a,(bc)
+			ld	h,e
+			pop	de
+			inc	l
+			sbc	a,a
+			dec	e
+			ld	h,a
+			rst	10h
+			jp	m,L8d11
+			ld	(hl),b
+			add	a,b
+			or	e
+			sub	(hl)
+			ld	h,fch
+			add	hl,de
+			add	a,h
+			add	a,h
+			pop	hl
+			add	hl,bc
+			ld	l,l
+			ld	e,h
+			xor	l
+			inc	c
+			jp	po,Lec35
+			ld	c,h
+			push	hl
+			add	a,h
+			ld	hl,(e9f6h)
+			nop (2x) *
+			add	a,b
+			rst	30h
+			ld	d,76h
+			cp	a
+			rst	08h
+			sbc	a,a
+			ld	c,(hl)
+			sub	a
+			rst	00h
+			adc	a,c
+			scf
+			sbc	a,h
+			ld	sp,hl
+			cp	a
+			ld	h,e
+			ld	d,3bh
+			inc	sp
+			nop (2x) *
+			inc	a
+			ld	h,b
+			jp	(hl)
+			db	02h
+			djnz	L7c11
+			add	a,(hl)
+			or	h
+			ld	a,b
+			rlca
+			cp	c
+			or	48h
+			ld	(de),a
+			daa
+			ld	h,c5h
+			dec	hl
+			rst	10h
+			cp	d
+			rst	18h
+			call	nz,L66a2
+			or	f0h
+			cp	h
+			and	a
+			rla
+			ld	e,d
+			ld	l,a
+			or	e
+			sub	h
+			ld	c,d
+			sub	d
+			or	e
+			ld	h,l
+			halt
+			add	a,b
+			add	a,l
+			adc	a,a
+			cp	(hl)
+			sub	d
+			sbc	a,h
+			ld	e,2ah
+			ld	c,a
+			rlca
+			ld	a,l
+			inc	sp
+			ld	d,(hl)
+			jp	po,L62da
+			ld	l,c
+			ld	c,a
+			add	hl,hl
+			pop	de
+			xor	d
+			ld	b,d
+			inc	(hl)
+			sub	e
+			rst	18h
+			ld	d,d
+			adc	a,(hl)
+			cp	e
+			jr	c,L7c56
+			ld	c,(hl)
+			ex	de,hl
+			adc	a,e
+			xor	(hl)
+			inc	sp
+			sub	b
+			rst	30h
+			call	L795f
+			ld	(hl),35h
+			ld	sp,b625h
+			ld	a,(bc)
+			ld	h,h
+			ld	(bc),a
+			ld	c,e
+			call	pe,L860b
+			ld	c,b
+			jp	nz,Lf306
+			and	e
+			ld	b,c
+			nop (2x) *
+			pop	hl
+			rla
+			xor	c
+			ld	(hl),d
+			ld	(hl),12h
+			sbc	a,c1h
+			sub	(hl)
+			cp	a
+			ld	e,(hl)
+			ld	a,(de)
+			ret	p
+			xor	(hl)
+			adc	a,h
+			pop	bc
+			ld	c,c
+			and	a
+			ld	b,a
+			push	af
+			cp	l
+			ld	a,b
+			adc	a,a
+			ld	e,b
+			jp	m,Ld5a8
+			inc	b
+			dec	c
+			call	m,La0a5
+			sub	e
+			ld	e,l
+			or	81h
+			out	(2ah),a
+			ei
+			di
+			sub	c
+			nop (2x) *
+			and	c
+			ld	e,c
+			ld	a,36h
+			sub	l
+			ld	c,l
+			sbc	a,c
+			ccf
+			ld	sp,hl
+			ret	c
+			ld	b,h
+			ld	(bc),a
+			nop
+			sub	e
+			call	pe,L526f
+			dec	a
+			ld	hl,f0a9h
+			ld	d,d
+			add	hl,de
+			ld	e,l
+			add	a,h
+			ld	d,h
+			ld	a,(de)
+			inc	bc
+			ld	h,c
+			dec	e
+			cp	e
+			or	(hl)
+			add	hl,bc
+			sbc	a,e
+			ld	d,c
+			ld	l,(hl)
+			adc	a,a
+			dec	e
+			adc	a,8dh
+			ld	l,h
+			adc	a,b
+			ld	(hl),c
+			halt
+			ld	e,d
+			di
+			sbc	a,d
+			push	de
+			ld	e,a
+			ld	a,9fh
+			ld	d,d
+			rst	08h
+			ld	d,h
+			ld	a,(de)
+			sbc	a,c
+			xor	d
+			cp	a
+			or	h
+			exx
+			ld	e,l
+			sbc	a,b
+			or	b5h
+			dec	a
+			ei
+			dec	bc
+			dec	l
+			ld	b,c
+			ld	c,a
+			rrca
+			ex	de,hl
+			xor	h
+			call	p,L886f
+			cp	h
+			ld	l,5fh
+			ld	e,c
+			jp	m,L31f7
+			sbc	a,b
+			ld	e,a
+			xor	d
+			ld	hl,(2d23h)
+			xor	e
+			ld	(hl),b
+			ld	e,(hl)
+			ld	l,70h
+			ld	l,h
+			ccf
+			adc	a,d
+			jr	z,L7d2a
+			ret	p
+			xor	d
+			ld	d,c
+			and	(hl)
+			add	a,(hl)
+			jp	nc,Le008
+			call	z,L6d25
+			or	a
+			ld	b,b
+			inc	bc
+			ld	(hl),c
+			pop	hl
+			jp	z,Lb853
+			call	pe,Lb3b1
+			ld	sp,a11ch
+			ld	a,3eh
+			ld	sp,1beah
+			jr	z,L7db6
+			ld	a,h
+			exx
+			ld	b,l
+			call	Ld707
+			ld	b,(hl)
+			push	hl
+			nop
+			out	(c),c
+			nop
+			dec	l
+			adc	a,l
+			ld	d,14h
+			ex	(sp),hl
+			push	hl
+			cp	b
+			ld	d,83h
+			xor	e
+			ld	bc,962bh
+			call	pe,L8a0a
+			cp	h
+			ld	a,c
+			jr	z,L7dd7
+			di
+			xor	h
+			rst	38h
+			or	d
+			ld	a,(dd1bh)
+			ld	l,a
+			ld	h,d
+			sub	(hl)
+			call	po,Lac27
+			call	nz,Lc14e
+			ld	a,(hl)
+			and	d
+			rst	20h
+			ld	c,l
+			rlca
+			ld	c,e
+			rra
+			cp	h
+			adc	a,(hl)
+			call	nc,L730c
+			jr	nc,L7d4e
+			ld	l,(hl)
+			ld	(hl),d
+			ld	a,l
+			ld	d,e
+			ld	l,d
+			in	a,(ach)
+			ret	nc
+			add	hl,bc
+			ld	h,a
+			jp	(hl)
+			db	9ah
+			sbc	a,d
+			rra
+			or	64h
+			ld	(hl),eah
+			ld	(hl),25h
+			add	hl,bc
+			nop
+			sub	e
+			ret	pe
+			add	a,a
+			ld	sp,hl
+			ld	e,01h
+			or	h
+			sbc	a,d
+			sbc	a,h
+			adc	a,a
+			and	b
+			rla
+			dec	b
+			cp	d
+			ld	(7e2fh),hl
+			ex	de,hl
+			ld	h,(hl)
+			call	pe,L144c
+			push	bc
+			cp	d
+			xor	e
+			or	l
+			and	l
+			ret	c
+			add	hl,hl
+			ld	(hl),d
+			and	(hl)
+			and	e
+			push	hl
+			and	h
+			call	p,Lf840
+			dec	c
+			dec	de
+			add	a,h
+			cpl
+			call	p,Lada8
+			ld	a,b
+			ld	c,d
+			ret	c
+			sub	c
+			ld	a,b
+			ld	(hl),d
+			add	a,b
+			ld	d,e
+			ld	sp,1bffh
+			rst	30h
+			ld	c,(hl)
+			ld	c,e
+			ld	h,4dh
+			rlca
+			ld	a,(hl)
+			add	hl,sp
+			ld	a,e1h
+			rra
+			call	c,Lc320
+			ld	d,b
+			xor	l
+			call	po,L201e
+			ld	e,a
+			dec	l
+			ret	c
+			and	l
+			add	a,b
+			call	m,Lc31c
+			cpl
+			ld	c,h
+			inc	b
+			ld	h,cdh
+			ld	c,h
+			ld	e,(hl)
+			sub	13h
+			dec	h
+			ei
+			ld	c,a
+			ld	a,(hl)
+			ret	m
+			jp	nc,L78c0
+			and	b
+			and	a
+			inc	l
+			dec	h
+			ld	hl,ce94h
+			sub	4bh
+			ld	(hl),a
+			sbc	a,e
+			ld	c,(hl)
+			dec	e
+			and	a
+			ld	de,00eah
+			call	p,L7dc9
+			sub	b
+			adc	a,c
+			daa
+			jp	pe,Ld783
+			ld	h,d
+			add	hl,bc
+			sub	e
+			jr	c,L7e9a
+			rst	18h
+			adc	a,(hl)
+			ld	c,c
+			adc	a,l
+			call	nz,L61cb
+			xor	h
+			rst	30h
+			ld	c,h
+			or	84h
+			ld	d,e
+			nop
+			pop	bc
+			sbc	a,e
+			in	a,(a8h)
+			di
+			jp	nz,L126d
+			sub	d
+			ld	a,(de)
+			cp	e
+			xor	(hl)
+			pop	de
+			ld	sp,hl
+			jp	po,L1066
+			rst	18h
+			xor	ech
+			rst	28h
+			exx
+			ld	a,d
+			sbc	a,(hl)
+			jr	nc,L7ef5
+			ld	l,a
+			nop (2x) *
+			ld	c,d
+			xor	e
+			jr	c,L7e1a
+			ld	(hl),d
+			sub	d
+			inc	hl
+			ld	a,a
+			ld	e,b
+			ld	e,d
+			inc	b
+			ld	e,c
+			xor	b
+			jp	nc,Lffc2
+			ld	b,c
+			pop	de
+			ld	d,b
+			cp	b
+			and	(hl)
+			and	66h
+			add	a,b
+			halt
+			inc	h
+			sbc	a,e
+			ld	(hl),e
+			inc	sp
+			sbc	a,l
+			ld	c,b
+			rst	08h
+			ld	a,l
+			add	a,h
+			cp	45h
+			daa
+			and	c
+			jp	nz,L5c20
+			or	e
+			ld	l,c
+			inc	c
+			cpl
+			push	af
+			or	h
+			add	hl,de
+			adc	a,l
+			adc	a,h
+			rst	08h
+			ld	(de),a
+			dec	bc
+			rst	30h
+			call	nc,L4df5
+			rla
+			cp	b4h
+			sbc	a,b
+			ld	e,a
+			and	e
+			cp	c
+			pop	bc
+			cp	a
+			call	nz,Lbbf9
+			rst	30h
+			halt
+			jp	nz,Le8a5
+			ld	l,l
+			sub	c
+			ld	l,(hl)
+			dec	l
+			ex	(sp),hl
+			push	hl
+			call	nc,Lb132
+			halt
+			xor	d
+			ret	pe
+			ret	nc
+			ld	c,b
+			add	a,e5h
+			or	77h
+			and	c
+			add	a,c
+			scf
+			rst	08h
+			add	hl,sp
+			sbc	a,l
+			ld	h,(hl)
+			inc	hl
+			call	p,L13c9
+			ld	h,l
+			ld	e,h
+			xor	c
+			or	d
+			jp	(hl)
+			db	f8h,3eh,b6h,bdh,4ah,39h,eah,dfh
+			db	6eh,9ch,f6h,58h,bfh,f3h,33h,c5h
+			db	c6h,17h,15h,35h,6ch,abh,b4h,82h
+			db	97h,f5h,3ch,1bh,0ch,e6h,4dh,57h
+			db	19h,38h,03h,91h,ebh,28h,c0h,16h
+			db	d9h,0eh,e6h,96h,ebh,8dh,a3h,15h
+			db	d9h,41h,b2h,2ch,3ch,14h,00h,95h
+			db	50h,70h,16h,0ah,31h,91h,90h,a2h
+			db	5dh,52h,41h,b7h,6dh,e7h,e9h,92h
+			db	b7h,e4h,37h,14h,66h,f3h,57h,feh
+			db	b2h,bdh,8eh
+			ld	h,l
+			scf
+			or	d
+			sbc	a,c
+			cp	b
+			adc	a,d
+			ld	b,d
+			rst	00h
+			dec	de
+			ld	(hl),d
+			inc	c
+			inc	l
+			ld	e,h
+			ld	d,l
+			cp	d
+			ld	d,d
+			or	c
+			ld	l,70h
+			rst	10h
+			inc	de
+			ld	h,e
+			ld	bc,d292h
+			or	c
+			ld	a,(de)
+			ld	e,b
+			ld	c,(hl)
+			and	e
+			ld	a,d
+			cp	h
+			inc	l
+			call	c,L04cb
+			dec	d
+			sub	(hl)
+			adc	a,c
+			ld	a,(de)
+			ld	(hl),c
+			call	po,Le459
+			pop	hl
+			ld	h,54h
+			ld	e,b
+			ret	z
+			rra
+			ld	b,l
+			adc	a,a
+			ld	h,l
+			pop	bc
+			ld	b,e
+			ret	z
+			ld	l,b
+			pop	hl
+			add	a,e
+			jp	m,Lacae
+			ld	h,b
+			ld	a,c
+			add	a,c
+			and	l
+			djnz	L7fa8
+			ld	h,l
+			push	af
+			xor	(hl)
+			xor	d
+			and	l
+			call	c,Lbc5f
+			jr	c,L8011
+			xor	h
+			ex	af,af'
+			jp	pe,L66b7
+			and	l
+			pop	hl
+			cp	h
+			ld	a,l
+			inc	h
+			pop	de
+			ld	l,(hl)
+			ccf
+			rrca
+			ld	d,(hl)
+			and	d
+			or	l
+			rrca
+			ld	h,b
+			xor	c
+			or	a
+			ld	c,c
+			ld	a,c
+			ld	(hl),l
+			sbc	a,l
+			or	(hl)
+			out	(46h),a
+			ld	a,d
+			dec	(hl)
+			cp	h
+			ld	h,c8h
+			ld	l,e
+			ld	d,l
+			rst	30h
+			dec	b
+			and	l
+			rst	20h
+			ld	sp,cd7dh
+			ld	c,d
+			and	h
+			ld	b,l
+			jr	nz,L8010
+			inc	h
+			call	p,L06dc
+			ld	h,l
+			ret
+			db	e9h,22h,99h,0bh,fdh,74h,c5h,73h
+			db	7fh,e5h,e3h,feh,feh,31h,afh,ech
+			db	c0h,8fh,c3h,79h,adh,fch,37h,1bh
+			db	56h,7dh,f9h,bdh,ach,73h,d6h,44h
+			db	d3h,4ah,19h,f4h,8ch,76h,abh,a4h
+			db	4bh,dbh,fch
+			sub	c
+			or	d
+			ld	c,87h
+			call	L93f1
+			add	a,b
+			scf
+			xor	l
+			exx
+			sbc	a,d
+			ret	z
+			dec	de
+			ld	a,(hl)
+			xor	h
+			ld	h,(hl)
+			add	a,d
+			call	nz,Le967
+			ld	e,d8h
+			jr	z,L7fa3
+			xor	h
+			or	c
+			add	a,(hl)
+			ret	pe
+			in	a,(5dh)
+			xor	d
+			cp	d
+			sbc	a,h
+			bit	6,h
+			xor	e
+			sub	d
+			ld	l,b
+			adc	a,a
+			push	af
+			push	de
+			ld	hl,d4d2h
+			xor	d
+			call	Lafab
+			ld	(2774h),hl
+			inc	d
+			dec	a
+			nop (2x) *
+			jp	pe,L922e
+			ld	b,c
+			ld	e,d
+			sub	d
+			ld	h,l
+			ld	e,e
+			cp	a5h
+			sbc	a,l
+			rst	08h
+			rst	38h
+			call	m,L38a5
+			inc	bc
+			ld	h,e
+			cp	l
+			ld	(hl),c
+			inc	de
+			add	a,c
+			add	a,d
+			ld	c,h
+			ld	h,l
+			rra
+			ld	a,(bc)
+			adc	a,a
+			push	af
+			jp	z,L8c0a
+			ld	a,(de)
+			ld	(hl),a
+			cpl
+			jp	po,L0a7f
+			scf
+			daa
+			add	hl,sp
+			ld	a,83h
+			add	a,e
+			ld	a,h
+			or	c
+			jp	z,L59d2
+			ld	e,(hl)
+			jp	po,Lfec0
+			ld	l,(hl)
+			sbc	a,l
+			rst	08h
+			rrca
+			add	hl,sp
+			ld	b,b6h
+			sbc	a,(hl)
+			ld	e,d
+			xor	b
+			ld	h,l
+			djnz	L8080
+			rla
+			sbc	a,a
+			ret	p
+			ld	l,e
+			ld	h,a
+			ret	c
+			xor	e
+			adc	a,e
+			ld	d,h
+			add	a,c
+			ld	a,e7h
+			bit	0,(hl)
+			xor	a
+			djnz	L80d6
+			xor	cbh
+			inc	(hl)
+			res	7,(hl)
+			call	c,L516b
+			jr	nc,L80f8
+			ld	a,d
+			ret	c
+			sub	l
+			ld	l,l
+			ld	h,d
+			sub	e
+			sub	l
+			adc	a,e
+			ld	e,h
+			cp	c
+			and	c
+			ld	l,e
+			cp	a
+			ld	a,c
+			ld	(hl),e
+			ld	a,(de)
+			cp	h
+			adc	a,h
+			and	e
+			inc	hl
+			inc	a
+			ret	c
+			ld	(de),a
+			out	(eah),a
+			pop	hl
+			cp	l
+			scf
+			ld	(bc),a
+			ld	e,b
+			rst	00h
+			ld	d,d
+			ld	e,l
+			ld	d,b
+			or	30h
+			push	de
+			ld	c,a
+			ld	l,b
+			ret	po
+			sbc	a,(hl)
+			and	(hl)
+			ld	a,e
+			push	bc
+			and	c
+			or	(hl)
+			ld	b,b
+			cp	e
+			ld	c,2dh
+			inc	bc
+			rst	30h
+			rlca
+			inc	(hl)
+			sub	a
+			rst	00h
+			and	33h
+			ret	c
+			ld	b,b
+			xor	h
+			pop	hl
+			add	a,e
+			ld	b,l
+			pop	de
+			ld	l,e
+			or	c
+			ld	h,b
+			xor	b
+			jp	nc,Le1b8
+			ld	e,h
+			ld	h,43h
+			sub	a
+			jp	(hl)
+			db	9ch,f5h,dfh,2bh,79h,2fh,25h
+			ld	l,c
+			in	a,(18h)
+			sbc	a,l
+			sub	l
+			dec	a
+			jp	po,Ld78c
+			inc	h
+			pop	bc
+			dec	l
+			ld	e,c
+			jr	z,L815c
+			sub	a
+			ld	b,l
+			ld	a,c
+			and	d
+			ret	nc
+			dec	e
+			xor	59h
+			dec	d
+			ld	b,l
+			inc	e
+			ret	po
+			ld	b,d
+			ld	b,b
+			or	h
+			exx
+			add	hl,hl
+			ld	e,e
+			sbc	a,l
+			cpl
+			dec	d
+			ld	h,l
+			dec	a
+			ld	l,h
+			xor	b
+			exx
+			jr	c,L80a8
+			nop (2x) *
+			jp	m,Le550
+			ld	d,l
+			add	a,(hl)
+			ld	l,l
+			xor	eah
+			inc	d
+			ld	h,5fh
+			and	l
+			ld	h,a
+			ld	(de),a
+			ld	c,(hl)
+			xor	d
+			adc	a,a
+			xor	a
+			inc	a
+			ld	b,(hl)
+			cp	l
+			ld	d,h
+			cp	l
+			cp	l
+			inc	bc
+			ld	l,d
+			ld	a,l
+			sbc	a,8dh
+			xor	(hl)
+			cp	b
+			push	de
+			dec	(hl)
+			inc	bc
+			jr	nc,L81a6
+			ret	m
+			nop (2x) *
+			di
+			or	a
+			daa
+			di
+			ld	(17e4h),hl
+			sub	l
+			scf
+			jr	nc,L8150
+			adc	a,d
+			ld	d,h
+			dec	(hl)
+			ret	nc
+			sub	l
+			and	l
+			jp	po,La560
+			adc	a,h
+			rst	18h
+			sbc	a,d
+			ld	h,c
+			ld	a,b
+			adc	a,a
+			and	h
+			rst	28h
+			ld	e,c
+			ld	l,h
+			and	b
+			ld	l,(hl)
+			sub	(hl)
+			ld	(hl),a
+			jp	pe,L9897
+			ret
+			cp	h
+			xor	a
+			call	p,Lec1f
+			ld	(hl),l
+			ld	d,c
+			inc	hl
+			ld	de,2b3eh
+			jp	po,La864
+			inc	d
+			inc	de
+			ld	c,58h
+			ld	a,a
+			dec	(hl)
+			inc	hl
+			ld	c,15h
+			xor	a
+			ld	d,a
+			ld	(hl),d
+			rst	10h
+			rra
+			sbc	a,d
+			ld	(hl),e
+			inc	hl
+			add	a,c
+			ld	b,h
+			rst	30h
+			inc	b
+			inc	h
+			ret	nz
+			dec	c
+			jr	nz,L81a3
+			sbc	a,b
+			inc	a
+			jr	nz,L81c3
+			ld	d,l
+			ret	nc
+			ret	c
+			dec	(hl)
+			sub	a
+			ld	(hl),b
+			xor	c
+			ld	l,a
+			ld	c,86h
+			sub	c
+			ld	(bc),a
+			ld	h,(hl)
+			adc	a,a
+			ld	d,e
+			sub	a
+			ld	bc,4ecfh
+			inc	e
+			ld	a,h
+			rra
+			jp	pe,L5252
+			ld	d,(hl)
+			and	cdh
+			add	a,c
+			or	b
+			exx
+			jr	nc,L8144
+			adc	a,b
+			dec	h
+			ld	a,a
+			jp	(hl)
+			db	81h,19h,48h,9eh,82h,adh,ech,78h
+			db	81h,18h,03h,aeh,6eh,57h,c8h,c2h
+			db	1ah,18h,88h,32h,99h,68h
+			dec	l
+			ini
+			cp	h
+			ld	a,l
+			ld	e,d
+			ld	b,92h
+			exx
+			ld	b,c
+			adc	a,a
+			sub	a
+			sbc	a,l
+			adc	a,l
+			xor	e
+			pop	de
+			or	a
+			add	a,d
+			cp	(iy + 53h)
+			call	pe,La3f4
+			jp	po,L52cd
+			cp	(hl)
+			ld	e,d
+			pop	de
+			adc	a,(hl)
+			dec	sp
+			inc	a
+			ld	(hl),b
+			jr	c,L8208
+			ld	a,a
+			ret	nc
+			push	hl
+			cp	b
+			ld	c,(hl)
+			or	b
+			rst	38h
+			jp	po,L7291
+			xor	(hl)
+			ld	b,(hl)
+			call	m,L904d
+			ld	h,d3h
+			jp	nz,Lb592
+			adc	a,d
+			call	pe,L0406
+			ld	c,(hl)
+			inc	b
+			rra
+			res	4,a
+			ld	c,c
+			cp	ceh
+			cp	a
+			push	bc
+			dec	h
+			call	c,L9f1b
+			jr	nz,L8250
+			rlca
+			pop	hl
+			cp	d
+			and	b
+			and	9ch
+			ld	l,b
+			ld	(hl),7ch
+			ld	c,d
+			ld	h,(hl)
+			ld	b,a
+			ld	d,l
+			ld	d,63h
+			sub	7dh
+			ret	p
+			ld	e,3ah
+			ld	l,d
+			rst	08h
+			ld	l,b
+			rst	38h
+			inc	bc
+			adc	a,e
+			ret	z
+			ld	e,a
+			jp	(hl)
+			db	8ch,5ch,a3h,9bh,41h,83h,64h,0ah
+			db	73h,1eh,72h,36h,01h
+			add	hl,hl
+			ld	(hl),c
+			ei
+			xor	h
+			ld	a,(cc5bh)
+			ld	c,(hl)
+			ld	a,c
+			or	d
+			cp	c
+			nop
+			ld	d,a
+			dec	de
+			ld	a,(98f6h)
+			dec	c
+			sub	e
+			jr	nc,L8253
+			ld	h,(hl)
+			cpl
+			ld	c,e
+			inc	(hl)
+			ld	d,l
+			cp	(hl)
+			pop	hl
+			ld	a,(1c9eh)
+			ld	(hl),e
+			sbc	a,9fh
+			rst	10h
+			ld	e,h
+			in	a,(7ah)
+			ld	c,h
+			rra
+			xor	c
+			ex	af,af'
+			ld	c,h
+			ld	c,l
+			ld	c,a
+			ld	a,h
+			dec	d
+			or	(hl)
+			or	9bh
+			cp	(hl)
+			ld	d,(hl)
+			ld	l,e
+			jp	p,L0198
+			ld	a,(de)
+			xor	b
+			djnz	L82cc
+			ld	(4c37h),a
+			and	c
+			add	a,b
+			ld	h,46h
+			ld	l,l
+			inc	hl
+			ld	h,d
+			ld	c,a
+			dec	c
+			ld	a,(hl)
+			add	a,h
+			rla
+			dec	de
+			dec	bc
+			ld	b,e
+			and	h
+			sub	(hl)
+			sub	h
+			jp	nc,Lac36
+			pop	af
+			ld	d,88h
+			ld	(bc),a
+			ld	de,0166h
+			add	a,l
+			add	a,e
+			xor	l
+			nop (2x) *
+			add	a,e
+			ld	a,l
+			ld	l,c
+			ld	c,l
+			ld	h,(hl)
+			cp	d
+			or	l
+			ld	c,h
+			add	a,a
+			dec	bc
+			ld	c,h
+			push	af
+			adc	a,e
+			push	hl
+			rrca
+			add	hl,bc
+			ld	c,c
+			adc	a,c
+			add	a,l
+			ex	de,hl
+			dec	l
+			inc	sp
+			ld	e,(hl)
+			and	c
+			ld	h,l
+			cpi
+			ld	h,e
+			rlca
+			adc	a,55h
+			ld	h,42h
+			jp	c,La232
+			or	d
+			ld	a,c
+			and	l
+			ld	l,0fh
+			scf
+			jr	nc,L82ec
+			or	e
+			djnz	L82fe
+			add	a,e9h
+			xor	l
+			sbc	a,b
+			ld	d,a
+			ld	e,b
+			sbc	a,c
+			ld	b,a
+			or	(hl)
+			ld	(hl),a
+			ld	e,l
+			jp	z,L221c
+			ret	nz
+			ld	a,e
+			adc	a,h
+			rla
+			call	p,L1e1c
+			nop
+			or	e
+			ld	(hl),l
+			ccf
+			jp	nc,Leb5f
+			rst	00h
+			and	d
+			ld	a,b
+			sub	c
+			xor	b
+			jr	nc,L8312
+			cp	c
+			cp	c
+			halt
+			push	de
+			ret	m
+			sub	a
+			dec	(hl)
+			xor	c
+			ld	c,a
+			ld	a,c
+			sbc	a,31h
+			ld	d,d
+			ld	hl,(4eafh)
+			pop	af
+			and	d
+			push	af
+			ld	e,d
+			sbc	a,b
+			inc	h
+			xor	h
+			sbc	a,a
+			xor	(hl)
+			or	28h
+			inc	b
+			sub	b
+			rst	00h
+			and	h
+			ld	c,a
+			jp	z,Lb6ba
+			ld	hl,(998bh)
+			ld	h,l
+			ld	e,a
+			or	deh
+			sub	(hl)
+			daa
+			ld	d,a
+			add	hl,sp
+			cp	l
+			ld	a,b
+			adc	a,(hl)
+			add	hl,sp
+			halt
+			ld	b,b
+			ld	c,b
+			pop	af
+			call	c,La109
+			dec	e
+			xor	e
+			call	m,Le654
+			ld	l,a
+			ld	b,l
+			cp	b
+			out	(b8h),a
+			sbc	a,a
+			ld	hl,3f21h
+			dec	b
+			or	c
+			add	a,b
+			push	de
+			ld	h,(hl)
+			ld	(hl),d
+			ret	c
+			sbc	a,b
+			ld	l,e
+			nop
+			ld	l,h
+			xor	b6h
+			xor	d
+			and	e
+			ld	h,(hl)
+			cp	a
+			res	5,a
+			ld	sp,6each
+			ld	l,b
+			ld	c,(hl)
+			or	(hl)
+			inc	a
+			push	de
+			sbc	a,b
+			jp	nz,L3cee
+			sbc	a,d
+			adc	a,(hl)
+			ld	c,e
+			ld	b,d
+			ld	d,51h
+			and	(hl)
+			or	h
+			call	nz,L3c6a
+			ld	de,ab39h
+			sbc	a,8ah
+			and	d
+			ld	hl,2a03h
+			cp	l
+			jp	po,L55ca
+			ld	h,a
+			ld	c,e
+			rst	20h
+			ld	d,(hl)
+			jp	(hl)
+			db	cbh,3fh
+			scf
+			sub	l
+			ld	bc,659eh
+			jr	z,L8371
+			sbc	a,l
+			jp	po,La91f
+			ld	e,l
+			ld	c,9bh
+			ld	l,l
+			add	a,(hl)
+			ld	h,l
+			dec	d
+			ld	c,a
+			ld	b,b
+			nop
+			jr	z,L836f
+			ld	d,b
+			inc	h
+			adc	a,d
+			adc	a,(hl)
+			adc	a,a
+			or	l
+			jp	nz,L99a9
+			call	p,L807a
+			ld	c,3ah
+			jr	L83a6
+			db	8ch,d1h,85h,49h,c0h,3bh,2bh,27h
+			db	a0h
+			nop (2x) *
+			ld	b,b
+			jp	pe,L595e
+			ld	c,(hl)
+			or	e
+			dec	h
+			ret
+			db	26h,e6h,0ah,04h,88h,c6h,9ah,0dh
+			db	9ah,7dh,0ah,74h,a0h,eeh,31h,10h
+			db	ddh,44h,b7h,a7h,fdh,65h,cfh,eeh
+			db	3ah,0dh,45h,35h,f9h,1eh,7eh,14h
+			db	87h,03h,aah,7ch,b7h
+			ld	d,e
+			sbc	a,(hl)
+			ld	l,d
+			ld	h,c
+			sub	c
+			ret
+			db	94h,6bh,0eh,8bh,b7h,36h,82h,91h
+			db	c0h,9eh,ffh,feh,8eh,68h,e3h,deh
+			db	d9h,1ah,f5h,65h,bch,e5h,5ah,83h
+			db	beh,8dh,e6h,9ch,5eh,4bh,68h,b5h
+			db	81h,25h,36h,26h,ebh,52h,6dh,82h
+			db	f1h,c2h,b5h,a5h,4bh,3bh,7fh,7ah
+			db	68h,d6h,2ch,27h,abh,ddh,ddh,88h
+			db	2eh,05h,e9h,4fh,e2h,97h,b9h,fch
+			db	eah,99h,00h,1ch
+			dec	bc
+			ex	(sp),hl
+			inc	d
+			ld	h,c
+			sbc	a,e
+			ld	l,h
+			ld	b,a
+			ld	d,e4h
+			ld	h,d
+			ld	e,h
+			and	a
+			inc	(hl)
+			add	a,e7h
+			dec	sp
+			halt
+			adc	a,e
+			ld	a,c
+			and	a
+			xor	a
+			ld	b,h
+			ld	l,h
+			ld	c,e
+			xor	c
+			push	af
+			ret	po
+			dec	sp
+			ex	de,hl
+			ld	l,b
+			xor	20h
+			xor	55h
+			sub	(hl)
+			ex	de,hl
+			ret	nz
+			adc	a,(hl)
+			ld	hl,(7fafh)
+			cp	e
+			adc	a,c
+			sbc	a,cah
+			sub	l
+			and	2ch
+			cp	(hl)
+			sub	c
+			push	af
+			ld	(hl),h
+			ld	h,e
+			ld	h,e
+			or	h
+			cp	c
+			jp	pe,L23c2
+			jp	Lecd8
+			db	b2h,42h,96h,33h,0ch,f1h,0fh,92h
+			db	6fh,7fh,adh,18h,ebh,30h,7bh,f5h
+			db	02h,0dh,97h,3dh,42h
+			ret
+			db	3eh,89h,ech,1eh,9eh,4fh,73h,e1h
+			db	f5h,67h,f8h,73h,67h,19h,33h,8dh
+			db	24h,b9h,d4h,63h,43h,19h,e7h,e9h
+			db	e8h,d9h,e7h,4fh,5ch,11h,aah,17h
+			db	4bh,8bh,3ah,a7h,bfh,7fh,f8h,83h
+			db	5dh,cch,ebh,dah,09h,16h,20h,f0h
+			db	34h,dah
+			ret	pe
+			ld	sp,hl
+			inc	sp
+			call	c,L8d10
+			ld	a,l
+			in	a,(dah)
+			sub	cfh
+			sla	b
+			rra
+			ld	e,c
+			pop	hl
+			ld	a,(4315h)
+			dec	l
+			call	nz,L2448
+			in	a,(5eh)
+			ld	a,c
+			call	c,L37aa
+			dec	sp
+			ld	sp,hl
+			ld	(hl),a
+			jp	po,Lb0d0
+			add	a,h
+			adc	a,d
+			ld	bc,eab4h
+			sub	c
+			exx
+			or	l
+			ld	(bc),a
+			push	af
+			ld	b,h
+			sub	l
+			adc	a,l
+			inc	h
+			ld	d,b
+			and	d
+			dec	hl
+			ld	c,63h
+			sbc	a,0ch
+			inc	bc
+			rla
+			ret	z
+			ld	b,h
+			ret	z
+			add	a,a
+			push	bc
+			jr	z,L84be
+			sbc	a,l
+			djnz	L849d
+			ld	d,l
+			sbc	a,d
+			cp	l
+			or	(hl)
+			ld	b,h
+			ld	sp,2dedh
+			add	hl,hl
+			rst	38h
+			push	de
+			jr	z,L854e
+			sub	a
+			add	a,d
+			inc	bc
+			or	e
+			sub	l
+			ld	d,h
+			ld	a,(bc)
+			ld	hl,6198h
+			add	hl,bc
+			push	de
+			and	b
+			xor	l
+			ld	l,h
+			ld	sp,b324h
+			dec	e
+			ld	l,c
+			inc	(hl)
+			or	a
+			jp	c,Le5e1
+			xor	e9h
+			sub	l
+			cp	a
+			ld	bc,b0f6h
+			sub	(hl)
+			ld	h,c
+			ld	b,h
+			adc	a,e
+			add	a,h
+			jr	z,L854d
+			rra
+			call	nz,L78b1
+			djnz	L84a9
+			add	a,c
+			ld	d,b
+			ld	(bc),a
+			ret	nz
+			rst	18h
+			ld	a,a
+			ld	d,a
+			exx
+			sub	d
+			ld	e,l
+			xor	eeh
+			add	a,e
+			ld	e,c
+			ld	c,h
+			ret	nz
+			or	h
+			ld	e,l
+			ld	(bc),a
+			ld	c,d
+			add	a,l
+			sbc	a,e
+			pop	hl
+			dec	e
+			ld	(hl),h
+			call	m,L4620
+			ld	hl,(de20h)
+			inc	sp
+			ld	a,(bc)
+			jp	p,Ld9c5
+			ld	(hl),b
+			ld	(hl),a
+			ld	de,9b60h
+			ret
+			db	79h,92h,c1h,1dh,31h,16h,b8h,59h
+			dec	a
+			inc	sp
+			ld	hl,f25eh
+			ret
+			db	cfh,30h
+			pop	bc
+			sub	a
+			dec	b
+			push	bc
+			cpl
+			cp	b
+			ld	h,a
+			and	e
+			sub	(hl)
+			add	a,e
+			call	m,L7b05
+			inc	d
+			ld	bc,f3b7h
+			sbc	a,96h
+			ld	c,a
+			sub	l
+			ld	d,(hl)
+			add	a,f1h
+			ld	e,c
+			inc	(hl)
+			jp	pe,L1d0e
+			rla
+			or	(hl)
+			ld	l,d
+			daa
+			djnz	L85f4
+			push	de
+			inc	c
+			out	(91h),a
+			ld	d,b3h
+			ld	e,68h
+			scf
+			jp	(hl)
+			db	c9h,3bh,e5h,4ch,e6h,6bh,16h,5eh
+			db	02h,fch,cbh,46h,b1h,9dh,93h,9eh
+			db	03h,fah,21h,d2h,d5h,2ah
+			ld	(hl),e
+			ld	h,c
+			ld	e,e
+			dec	de
+			cp	d
+			or	h
+			pop	af
+			and	l
+			inc	h
+			add	a,d
+			jp	po,L9704
+			add	a,d
+			jp	m,Lc676
+			call	po,L055f
+			add	a,b
+			ld	b,(hl)
+			dec	c
+			inc	a
+			ld	d,c
+			adc	a,d
+			cp	e
+			ld	l,e
+			exx
+			and	e
+			ld	(hl),e
+			ld	(ix + 28h),l
+			or	h
+			add	a,d
+			exx
+			ld	h,2eh
+			ld	c,l
+			ld	a,c
+			ld	e,d
+			ld	l,c
+			ld	e,d
+			rst	08h
+			add	a,h
+			ld	a,e
+			add	a,b
+			rst	38h
+			ld	e,b
+			sub	b
+			adc	a,(hl)
+			ld	l,l
+			dec	hl
+			out	(c5h),a
+			ld	(b19dh),hl
+			adc	a,c
+			xor	c
+			ld	c,b
+			ret	pe
+			xor	l
+			dec	l
+			add	a,d
+			ret	m
+			jr	c,L85c3
+			ret	m
+			cp	h
+			dec	l
+			call	z,L57da
+			djnz	L85ca
+			ld	a,e
+			ret	c
+			cp	93h
+			ld	d,(hl)
+			jr	z,L8598
+			ld	(hl),h
+			cp	c
+			sbc	a,l
+			ld	c,c
+			dec	h
+			ret	po
+			ld	(hl),d
+			rla
+			dec	c
+			or	c
+			xor	d
+			add	a,b
+			rra
+			pop	hl
+			ld	h,d3h
+			ret	po
+			nop (2x) *
+			ld	d,e
+			ld	(hl),b
+			adc	a,h
+			ld	h,(hl)
+			ld	h,h
+			dec	a
+			jp	po,L5a9e
+			inc	a
+			dec	c
+			jr	L863f
+			ld	b,b
+			ld	ixl,b *
+			ld	d,c
+			dec	(hl)
+			ld	sp,hl
+			ld	b,h
+			ret	z
+			ret	pe
+			ld	e,l
+			dec	d
+			ld	hl,7b53h
+			ld	h,e
+			inc	a
+			adc	a,(hl)
+			and	a
+			cp	l
+			rst	28h
+			ld	a,l
+			dec	d
+			dec	e
+			ld	e,e
+			ld	d,l
+			and	d
+			ld	sp,fa0ah
+			halt
+			ld	d,h
+			and	4dh
+			sub	b
+			ld	h,h
+			inc	sp
+			ccf
+			sbc	a,d
+			ld	h,e
+			inc	(hl)
+			inc	d
+			sub	a
+			cp	d
+			push	bc
+			push	de
+			scf
+			jp	pe,L2bd9
+			ld	b,a
+			xor	e
+			ld	hl,(93d8h)
+			ld	h,40h
+			jr	nc,L8603
+			cp	(hl)
+			ld	e,b
+			ei
+			sub	a
+			sub	c
+			ld	(hl),c5h
+			nop
+			cpl
+			sub	c
+			ret	po
+			sbc	a,b
+			and	l
+			ld	e,e
+			ld	b,l
+			halt
+			sbc	a,e1h
+			ld	d,d
+			call	po,L7ffa
+			and	b
+			pop	de
+			rst	38h
+			or	47h
+			ld	b,l
+			sub	d
+			ei
+			or	b
+			rst	20h
+			push	de
+			or	l
+			call	nc,L0be6
+			set	2,d
+			xor	b
+			dec	d
+			ld	h,d
+			ccf
+			jp	po,L37a4
+			jp	nz,La0ea
+			inc	bc
+			ld	a,(hl)
+			ld	l,7fh
+			ld	sp,7fbeh
+			jp	p,L3816
+			in	a,(a6h)
+			and	l
+			di
+			call	po,L2028
+			xor	d
+			ld	a,a
+			ld	c,d
+			sub	b
+			sub	a2h
+			add	a,a
+			ld	d,b
+			ld	e,b
+			exx
+			ld	l,(hl)
+			inc	(hl)
+			rlca
+			dec	sp
+			xor	23h
+			add	a,(hl)
+			sbc	a,l
+			cp	(hl)
+			and	a
+			rst	08h
+			ld	h,e
+			dec	d
+			ld	a,(bc)
+			ld	(de),a
+			and	d
+			push	de
+			and	d
+			ld	h,b
+			add	a,a
+			sbc	a,b
+			ld	d,f7h
+			ret	c
+			xor	l
+			jp	z,L8a5b
+			inc	sp
+			adc	a,a
+			adc	a,l
+			ld	e,h
+			add	hl,sp
+			exx
+			ld	h,(hl)
+			ld	(hl),a
+			ld	h,h
+			ld	d,d
+			ld	(hl),e
+			halt
+			ld	l,d
+			ld	h,l
+			rst	28h
+			ld	(8b47h),hl
+			jr	nz,L868d
+			or	(hl)
+			ld	h,(hl)
+			ld	h,a
+			ld	b,b
+			jp	m,Lc391
+			or	c
+			add	a,d
+			or	h
+			dec	hl
+			ld	(bc),a
+			push	af
+			ld	e,b
+			call	m,Lb241
+			inc	sp
+			rrca
+			and	a
+			ld	h,50h
+			xor	d
+			ld	a,(de)
+			dec	h
+			pop	hl
+			ld	(hl),0ah
+			add	a,a
+			rlca
+			ex	(sp),hl
+			and	d1h
+			ld	(hl),h
+			ld	c,b
+			jp	p,Lc268
+			push	hl
+			cp	e
+			add	a,(hl)
+			call	po,Lafee
+			rst	20h
+			dec	a
+			ld	b,(hl)
+			ret	po
+			xor	e
+			add	a,l
+			inc	l
+			ld	l,d
+			or	c
+			di
+			add	a,a
+			ld	a,ech
+			sbc	a,a
+			add	a,h
+			add	a,l
+			jp	nz,L615d
+			sbc	a,d
+			ld	b,l
+			or	d
+			di
+			ret	p
+			ld	a,bch
+			ld	d,c
+			ld	l,(hl)
+			ld	h,h
+			and	e
+			and	dch
+			ld	(hl),d
+			ld	e,b
+			pop	hl
+			ccf
+			rst	10h
+			add	hl,hl
+			ld	b,l
+			ld	(hl),69h
+			sbc	a,c
+			inc	de
+			ld	c,(hl)
+			ld	h,a
+			ret	nc
+			ccf
+			sub	h
+			ld	l,e
+			ld	(bc),a
+			xor	d
+			ld	l,(hl)
+			ld	a,c
+			xor	e7h
+			xor	c
+			pop	bc
+			cp	62h
+			or	h
+			ld	l,h
+			and	e
+			dec	d
+			ld	(hl),28h
+			ld	h,a
+			add	a,a
+			cp	d
+			scf
+			cp	l
+			ld	c,e
+			ld	h,c
+			add	a,d
+			inc	d
+			ld	e,e
+			adc	a,69h
+			ld	d,9eh
+			or	a
+			cp	h
+			adc	a,l
+			ld	d,(hl)
+			cp	c
+			ld	e,h
+			add	a,d
+			sbc	a,h
+			ld	hl,(e9feh)
+			ld	(7a75h),a
+			ld	c,l
+			push	af
+			adc	a,e
+			nop (2x) *
+			ld	a,(hl)
+			cp	h
+			exx
+			ld	c,h
+			ld	a,(de)
+			nop
+			ld	sp,hl
+			ld	e,d
+			ld	a,(hl)
+			sbc	a,d
+			ld	c,(hl)
+			di
+			add	hl,sp
+			rst	28h
+			or	(hl)
+			sbc	a,(hl)
+			out	(7ah),a
+			pop	hl
+			ld	d,c
+			and	e
+			add	hl,hl
+			inc	a
+			inc	b
+			ld	e,h
+			ld	e,b
+			ld	hl,(c2a8h)
+			dec	hl
+			adc	a,c
+			cp	e
+			inc	l
+			ret	p
+			dec	bc
+			pop	af
+			ret	po
+			daa
+			or	c
+			rla
+			ld	d,c
+			ld	(hl),l
+			ld	b,d
+			ld	e,a
+			pop	de
+			xor	(hl)
+			ld	b,h
+			sbc	a,h
+			cp	e
+			ld	h,h
+			jp	c,Lba15
+			sbc	a,a
+			or	3fh
+			daa
+			dec	e
+			sbc	a,b
+			ld	a,(de)
+			or	a
+			jp	(hl)
+			db	57h,76h,71h,dch,81h,4eh,74h,75h
+			db	40h,5ah,26h,79h,0fh,72h
+			ld	a,l
+			ld	e,6dh
+			ld	h,c
+			ld	(hl),c
+			sbc	a,b
+			or	b
+			add	a,l
+			in	a,(2eh)
+			ld	a,(de)
+			adc	a,(hl)
+			inc	bc
+			ld	d,d
+			inc	de
+			and	l
+			sub	l
+			rst	30h
+			jr	L87b2
+			db	2ah,1fh,03h
+			halt
+			and	c
+			xor	a
+			ld	c,e
+			sbc	a,c
+			nop (2x) *
+			adc	a,c
+			sub	a
+			xor	e
+			ld	a,b
+			or	deh
+			ld	a,(bc)
+			ld	a,a
+			ld	d,ceh
+			ld	de,9ad4h
+			ld	e,(hl)
+			or	l
+			ld	d,a
+			or	e
+			ld	a,c
+			dec	bc
+			jp	po,Lffbc
+			and	c
+			push	hl
+			add	hl,de
+			dec	l
+			cp	h
+			cp	(hl)
+			dec	d
+			xor	a
+			add	a,a
+			ld	de,9eadh
+			ld	(hl),l
+			xor	(hl)
+			jr	z,L87e4
+			ld	a,b9h
+			sub	e
+			dec	b
+			jp	nz,Lf16a
+			adc	a,(hl)
+			ret	nc
+			rla
+			ld	d,c
+			dec	(hl)
+			rla
+			ld	(hl),e
+			dec	c
+			ld	e,d
+			sbc	a,8fh
+			and	c
+			djnz	L87b5
+			ld	a,e
+			rst	00h
+			sbc	a,c
+			dec	hl
+			ld	h,a9h
+			add	hl,hl
+			halt
+			ret	c
+			ret	m
+			ld	e,d
+			jr	L87bf
+			db	c1h,59h,2fh,80h,14h,42h,6eh,41h
+			db	64h,6dh,1ah,62h,c9h,32h,78h,1ch
+			db	7bh,c6h,03h,afh,8ch,96h,e4h,89h
+			db	aah,65h,d2h,e5h,a4h,aeh,26h,bfh
+			db	5fh,85h,18h,27h,58h,2dh,cfh,11h
+			db	b2h,8bh,ffh,59h,c7h,03h,1bh,6ch
+			db	35h,b4h,1ah,8fh,a4h,b2h,20h,c9h
+			db	8ch,0dh,05h,52h,a1h,5ah,45h,7eh
+			db	20h,7dh,b1h,9fh,0eh,abh,9dh,93h
+			db	44h,ddh,16h,98h,91h,ech,50h,54h
+			db	feh,34h,cdh,39h,73h,a3h,9bh,f3h
+			db	e8h,85h,68h,42h,e8h,13h,5dh,c2h
+			db	54h,9bh,15h,4eh,aah,3eh,82h,edh
+			db	96h,26h,11h,0ch,2fh,e1h
+			pop	hl
+			ld	a,h
+			ld	bc,dd96h
+			rst	20h
+			ld	l,a
+			ld	h,c
+			rra
+			add	hl,hl
+			jp	(hl)
+			db	06h,cch,5bh,35h,a6h,f0h
+			ld	b,e
+			dec	l
+			adc	a,c
+			inc	(hl)
+			add	a,h
+			ld	a,(04cdh)
+			ld	(de),a
+			ld	b,c
+			dec	c
+			inc	e
+			ld	l,a
+			add	a,8fh
+			xor	b
+			ld	h,h
+			ld	c,04h
+			or	d
+			ld	e,(hl)
+			ld	a,bbh
+			ld	b,h
+			ld	c,b
+			ld	a,c
+			rst	38h
+			ld	(1b40h),hl
+			ld	(hl),a
+			ld	d,a
+			xor	e
+			ret	m
+			set	5,c
+			djnz	L8880
+			add	hl,sp
+			dec	hl
+			sub	h
+			or	d
+			and	(hl)
+			and	h
+			adc	a,a
+			add	a,l
+			sub	0fh
+			halt
+			ld	d,d
+			or	b
+			adc	a,d
+			add	a,b
+			ret	c
+			rst	30h
+			ld	l,a
+			ld	l,e
+			add	a,c
+			ret	m
+			ret	nz
+			ret	po
+			ld	a,1eh
+			djnz	L88da
+			inc	bc
+			ld	e,c
+			inc	bc
+			nop
+			ld	sp,hl
+			pop	de
+			sub	(hl)
+			inc	c
+			ld	a,h
+			ld	a,c
+			add	a,b
+			inc	(hl)
+			ld	l,b
+			ld	h,b
+			add	a,a
+			xor	l
+			ld	e,b
+			ld	d,e
+			ld	h,b
+			ret	p
+			ld	b,d
+			add	a,l
+			ld	d,a
+			dec	c
+			dec	d
+			rst	20h
+			and	c
+			inc	sp
+			pop	hl
+			call	p,Le674
+			ret	m
+			ld	(hl),h
+			jp	c,Lc29c
+			and	e
+			sbc	a,(hl)
+			ld	(hl),c
+			ret	po
+			add	hl,de
+			ld	e,(hl)
+			ld	b,l
+			ld	b,h
+			ld	(hl),a
+			adc	a,l
+			dec	l
+			ld	d,b
+			ld	d,l
+			cp	(hl)
+			ret	p
+			xor	e
+			ld	l,9bh
+			ld	l,h
+			exx
+			inc	b
+			or	b
+			cp	l
+			ld	(hl),d
+			dec	l
+			dec	h
+			ld	a,d
+			xor	1ah
+			add	a,e
+			ld	de,b097h
+			add	hl,de
+			ld	b,b
+			ld	d,d
+			ld	c,h
+			ld	c,b
+			sbc	a,h
+			push	hl
+			ret	m
+			jp	c,L1fa2
+			ld	a,(hl)
+			ld	a,b
+			dec	d
+			dec	hl
+			inc	e
+			ld	(hl),c
+			adc	a,ech
+			add	a,73h
+			or	b
+			and	h
+			ld	l,b
+			ld	hl,(29b6h)
+			ld	b,h
+			push	de
+			rra
+			nop (2x) *
+			ld	bc,3486h
+			ld	d,b
+			dec	sp
+			ld	(hl),e
+			ld	c,b
+			halt
+			adc	a,c
+			dec	d
+			ld	d,b
+			sbc	a,(hl)
+			xor	a
+			exx
+			dec	c
+			ld	a,h
+			inc	bc
+			ld	h,(hl)
+			adc	a,c
+			ret	pe
+			add	a,a
+			ret	c
+			ld	a,d
+			jp	nc,L5912
+			ld	(hl),e
+			pop	de
+			inc	c
+			ld	l,e
+			ld	hl,f50dh
+			or	a
+			ld	(hl),h
+			add	a,a
+			add	a,d
+			ld	d,d
+			ld	b,(hl)
+			ld	(hl),h
+			sub	e
+			ld	h,l
+			xor	b
+			adc	a,a
+			in	a,(e8h)
+			ld	c,d
+			ld	b,a
+			rrca
+			ld	l,a
+			ld	(55c3h),a
+			xor	d
+			ld	h,c
+			ld	e,a
+			ld	a,d
+			adc	a,l
+			ld	b,(hl)
+			jp	Ld944
+			db	94h,3ch,eeh,7ch,d4h,9ch,13h,cah
+			db	4fh,cbh,b4h,46h,bch,f7h,b2h
+			cpl
+			add	a,d
+			ld	c,b
+			jp	p,La258
+			di
+			ld	(hl),c
+			ld	l,(hl)
+			ld	c,h
+			sbc	a,b
+			ld	(hl),d
+			dec	h
+			inc	c
+			sbc	a,l
+			and	h
+			rlca
+			ld	d,b
+			ld	a,a
+			jp	po,L3055
+			ld	hl,114bh
+			adc	a,(hl)
+			ld	b,iyl *
+			and	(hl)
+			jp	pe,L51ec
+			ld	a,d
+			and	e
+			ex	de,hl
+			or	(hl)
+			ld	h,d
+			halt
+			sbc	a,a9h
+			ld	d,f0h
+			ld	l,c
+			ret	c
+			ld	e,c
+			ld	h,b
+			ret	c
+			ex	(sp),hl
+			ei
+			rl	d
+			ld	e,a2h
+			ld	h,l
+			ld	e,b
+			add	hl,sp
+			adc	a,c
+			inc	hl
+			and	a
+			call	m,L60f4
+			push	bc
+			push	de
+			sub	e
+			ld	h,c
+			cpl
+			xor	l
+			add	hl,hl
+			rst	00h
+			and	c
+			dec	bc
+			daa
+			ld	e,e
+			and	e
+			jr	c,L898c
+			add	a,b0h
+			ccf
+			jp	p,L2f84
+			add	a,e
+			sbc	a,d2h
+			pop	de
+			jp	c,Leaac
+			cp	abh
+			ld	h,(hl)
+			ld	(hl),h
+			sub	a0h
+			ld	e,b
+			xor	a
+			inc	sp
+			ld	a,a
+			ret	pe
+			ld	l,l
+			dec	b
+			ld	(hl),c
+			and	c
+			ld	a,(15afh)
+			ld	l,ceh
+			nop (2x) *
+			jp	c,L31ff
+			ld	a,d
+			ld	(hl),a
+			inc	hl
+			dec	sp
+			add	hl,de
+			inc	de
+			inc	sp
+			ld	a,c
+			ld	a,a
+			ld	c,c
+			di
+			add	a,c
+			ld	c,6ah
+			ld	d,(hl)
+			ld	l,a
+			ld	b,a
+			ld	e,e
+			add	hl,sp
+			or	c
+			ld	h,e9h
+			ld	b,d
+			and	c
+			cp	e
+			ld	b,c
+			jr	L8a5a
+			db	aeh,41h,a0h,45h,c3h,16h,01h,3eh
+			rst	18h
+			ld	c,a
+			jp	nc,La317
+			rlca
+			ld	hl,a614h
+			ld	h,d
+			ld	h,(hl)
+			ld	d,(hl)
+			xor	(hl)
+			ld	(hl),a
+			sub	h
+			xor	d8h
+			and	h
+			nop
+			ld	h,c
+			ld	e,e
+			sub	(hl)
+			ret	nz
+			ld	l,h
+			ld	h,d
+			in	a,(46h)
+			add	a,d
+			ld	a,(de)
+			call	c,L29af
+			ld	b,l
+			ld	sp,hl
+			ld	sp,hl
+			ld	a,d
+			ld	a,a
+			adc	a,b
+			ld	(hl),l
+			add	a,c
+			ret	nz
+			push	hl
+			ret	pe
+			and	h
+			push	af
+			sub	l
+			jr	nz,L89df
+			add	a,b8h
+			ld	c,(hl)
+			halt
+			ld	c,a
+			jr	c,L89ee
+			or	l
+			dec	l
+			ld	e,l
+			adc	a,e
+			cpl
+			cp	(hl)
+			inc	hl
+			inc	b
+			adc	a,9fh
+			ret	c
+			inc	sp
+			daa
+			ld	d,h
+			ld	c,a
+			sbc	a,(hl)
+			sbc	a,a9h
+			sbc	a,a
+			and	l
+			ld	l,a
+			and	b
+			ld	a,d
+			ld	d,h
+			xor	b
+			ld	c,c
+			pop	hl
+			inc	a
+			ld	h,c
+			pop	hl
+			ld	c,b
+			ld	a,a
+			and	l
+			xor	17h
+			and	l
+			inc	de
+			rst	00h
+			or	d
+			adc	a,b
+			add	hl,hl
+			inc	l
+			call	Leeee
+			add	a,c
+			ex	af,af'
+			inc	de
+			ret	p
+			sub	e
+			xor	h
+			sbc	a,e
+			add	a,d
+			ld	hl,2cb4h
+			ld	hl,(8e34h)
+			and	d
+			in	a,(9eh)
+			rst	30h
+			ld	(de),a
+			adc	a,b
+			add	a,a
+			inc	l
+			ld	(2df2h),hl
+			jp	z,L4e20
+			add	hl,hl
+			ld	(40b8h),a
+			ld	de,c180h
+			ccf
+			ld	a,d
+			add	a,c
+			ld	d,h
+			ld	e,h
+			inc	hl
+			rst	28h
+			ld	a,l
+			ld	sp,c869h
+			adc	a,(hl)
+			ld	a,a
+			dec	c
+			ret	z
+			adc	a,(hl)
+			ld	d,e
+			ret	po
+			ld	b,a
+			ld	d,d
+			ret	nz
+			add	a,b
+			ld	e,a
+			ld	d,(hl)
+			ret
+			db	8eh,6bh,f2h,bch,beh,e6h,4bh,21h
+			db	c8h,d9h,e0h,29h,a7h,7dh,e7h,44h
+			db	1fh,07h,d7h,11h,9ah,e2h,f4h,35h
+			db	f7h,50h,35h,d0h,e6h,77h,95h,18h
+			db	3ah,23h,27h,8bh,e7h,06h,b3h,eah
+			db	b5h,c7h,4bh,46h,76h,b9h,4bh,6dh
+			db	97h,28h,c5h,82h,a9h,c7h,b8h,8ch
+			db	68h,cbh,f3h,d8h,62h,4ch,5ch,2dh
+			db	52h,7ah,f1h,1ah,d9h,61h,99h,50h
+			db	69h,78h,d3h,40h,b3h,2eh,7bh,59h
+			db	e5h,b5h,f2h,1ah,38h,aah,33h,dch
+			db	8fh,80h,b6h,bbh,22h,c5h,d2h,dfh
+			db	8bh,1ch,16h,86h,1ah,ebh,2fh,74h
+			db	c3h,95h,f6h,ceh,aah,70h,47h,9ah
+			db	abh,9dh,a7h,8bh,b8h,04h,3dh,c5h
+			db	59h,b7h,8ch,c6h,d5h,fch,6ah,e8h
+			db	2ch,a1h,e3h,65h,d6h,eeh,23h,7fh
+			db	45h,00h,92h,9ah,3eh,b0h,8eh,c1h
+			db	35h
+			and	h
+			ld	a,a
+			and	ech
+			ld	a,(hl)
+			ei
+			sbc	a,h
+			ld	a,d
+			rlca
+			sbc	a,l
+			add	a,(hl)
+			inc	hl
+			jp	m,L820d
+			ld	(hl),b
+			dec	d
+			ld	e,b
+			add	hl,hl
+			rst	28h
+			ld	d,e
+			ld	c,b
+			dec	b
+			ld	(bc),a
+			rst	18h
+			call	po,L4250
+			dec	h
+			xor	d
+			cp	1bh
+			sub	e
+			cp	e
+			call	pe,L2bdb
+			ld	d,d
+			inc	h
+			sub	c
+			ld	e,l
+			sbc	a,b
+			inc	sp
+			rrca
+			ld	h,7ch
+			ld	(hl),a
+			ld	l,b
+			rst	18h
+			adc	a,c
+			ld	(hl),l
+			ret	c
+			push	de
+			ld	h,b
+			jp	po,Lbce4
+			ld	l,a
+			adc	a,a
+			cp	(hl)
+			ld	(bc),a
+			sub	c
+			call	z,Lfc11
+			ld	(hl),d5h
+			and	2ch
+			ld	h,a
+			ld	d,l
+			ret	pe
+			add	a,f4h
+			ei
+			ccf
+			ld	d,c
+			add	hl,hl
+			ld	a,d
+			xor	h
+			ld	a,a
+			ex	(sp),hl
+			jp	m,L83cd
+			ld	a,l
+			and	(hl)
+			ld	d,bdh
+			pop	af
+			ld	b,h
+			ld	c,l
+			push	hl
+			ld	e,c
+			and	b
+			call	z,L9785
+			ld	(hl),b
+			halt
+			xor	e
+			inc	d
+			ld	d,c
+			ld	e,l
+			out	(dbh),a
+			jr	nc,L8c0f
+			rst	30h
+			ld	b,(hl)
+			ld	(hl),l
+			adc	a,b
+			add	a,d
+			call	nc,L65a8
+			rst	30h
+			or	b
+			rst	30h
+			rst	30h
+			ld	h,l
+			rst	28h
+			cp	(hl)
+			jr	L8be4
+			db	7ch,7bh,40h,90h,d8h,74h,19h,f9h
+			db	9eh
+			rlca
+			ld	sp,dd06h
+			add	a,l
+			djnz	L8bea
+			push	hl
+			adc	a,h
+			jr	z,L8c32
+			ld	a,e
+			sbc	a,(hl)
+			ld	b,a
+			jr	nc,L8b8d
+			push	bc
+			jp	nc,Lcc9c
+			ld	b,5bh
+			call	po,L2ffd
+			ld	h,82h
+			ld	l,(hl)
+			nop (2x) *
+			and	d
+			inc	(hl)
+			ld	d,a
+			adc	a,(hl)
+			add	a,e
+			ld	a,b
+			ld	e,(hl)
+			ld	h,b
+			adc	a,b
+			ld	c,e
+			and	a
+			dec	hl
+			ld	b,d
+			ei
+			pop	de
+			rst	18h
+			ld	h,c
+			ret
+			db	d6h,cah,e6h,eah,fch,12h,edh,48h
+			db	0eh,fch,9bh,66h,ebh,79h,21h,dch
+			db	5ch,c7h,bfh,4ch,7eh,89h,3dh,89h
+			db	1bh
+			adc	a,(hl)
+			inc	a
+			ld	e,c
+			cp	e
+			rst	08h
+			ld	h,24h
+			adc	a,09h
+			jr	c,L8bc1
+			call	pe,Ld8f1
+			call	p,L8673
+			exx
+			ld	b,e
+			dec	hl
+			xor	a
+			call	z,Lfdc1
+			jp	p,L9435
+			add	a,h
+			djnz	L8bb3
+			or	e
+			rst	38h
+			and	b
+			ld	e,f6h
+			and	a
+			jp	z,Lded8
+			sbc	a,h
+			dec	de
+			push	bc
+			adc	a,c
+			sbc	a,(hl)
+			adc	a,l
+			or	b
+			ld	e,a
+			and	a8h
+			adc	a,6eh
+			xor	b4h
+			sub	l
+			xor	l
+			ld	h,h
+			halt
+			jr	c,L8c87
+			adc	a,c
+			ld	h,h
+			or	l
+			ld	h,d
+			ld	c,d
+			ld	a,c
+			ld	(de),a
+			ex	(sp),hl
+			sbc	a,64h
+			add	a,c
+			and	d
+			ld	(hl),l
+			jr	nz,L8c93
+			add	a,h
+			ld	l,(ix + 74h)
+			ld	l,h
+			bit	5,a
+			inc	de
+			or	l
+			adc	a,e
+			sub	a
+			ld	(de),a
+			ld	c,b
+			ld	c,a
+			daa
+			halt
+			dec	de
+			sbc	a,c
+			ld	(hl),c
+			cp	h
+			sbc	a,d
+			rla
+			dec	h
+			ld	e,d
+			add	a,c
+			ex	af,af'
+			ld	a,c
+			rst	00h
+			and	b
+			call	z,L4d1a
+			add	hl,bc
+			call	pe,Ldd51
+			ld	b,(hl)
+			ret	pe
+			ld	(iy + f7h),c
+			jp	z,L5972
+			ld	bc,45a3h
+			ld	b,e
+			call	c,L96b1
+			ret	m
+			daa
+			sbc	a,d
+			ret	nz
+			ld	a,d
+			in	a,(ach)
+			ld	d,14h
+			and	a
+			set	4,h
+			ld	(hl),d
+			ld	a,09h
+			ld	d,h
+			ld	a,b8h
+			inc	b
+			sbc	a,l
+			cp	c
+			ld	h,d
+			inc	a
+			ret	m
+			add	a,d
+			ld	c,a
+			xor	45h
+			ret	z
+			ld	c,(hl)
+			ld	e,(hl)
+			and	e
+			call	c,L6cd5
+			push	hl
+			dec	a
+			ld	(hl),l
+			ld	d,a
+			ex	de,hl
+			dec	b
+			ex	(sp),hl
+			cp	b
+			call	m,L1807
+			ld	d,e
+			jr	nz,L8c65
+			jp	(hl)
+			db	ddh,64h,3dh,e9h,86h,eah,1fh,7ah
+			db	fch,c6h,75h,dfh,0dh,2eh,e4h,58h
+			db	dfh,4bh,83h,9fh,7ch,05h,8ah,a0h
+			db	beh
+			xor	a
+			and	b
+			ret
+			db	afh,74h,b1h,76h,2bh,beh,f9h,c7h
+			db	85h,09h,7ch,65h,ebh,2ah,5bh,1ah
+			db	58h,83h,64h,06h,85h,3fh,1ch,57h
+			db	27h,f6h,b2h,29h,18h,06h,4fh,e2h
+			db	d6h,6ah,50h,b3h,8fh,f2h
+			rst	28h
+			di
+			ret	po
+			xor	e
+			sub	(hl)
+			or	(hl)
+			add	hl,sp
+			call	L1296
+			or	e
+			ld	a,(hl)
+			ex	de,hl
+			ret
+			db	f0h
+			push	af
+			inc	h
+			ld	h,a
+			sbc	a,a
+			jp	nc,L9000
+			or	l
+			and	c
+			inc	hl
+			in	a,(55h)
+			ex	de,hl
+			jp	Lfdae
+			db	f7h,57h,04h,e9h,7eh,9fh,53h,52h
+			db	26h,a2h,42h,04h,39h,f4h,37h,3eh
+			db	68h,36h,9ah,27h,9eh,0ah,82h,08h
+			db	21h,cch,e4h,eeh,71h,58h,bfh,15h
+			db	93h,8fh,91h,70h,49h,d3h,cah,63h
+			db	1bh,09h,4eh,02h,c6h,7eh,a0h,0fh
+			ld	iyl,iyl *
+			call	Lab4f
+			ld	(hl),h
+			ret	p
+			rst	28h
+			push	hl
+			jp	z,L312a
+			ld	d,c
+			ld	(hl),c
+			nop (2x) *
+			jp	pe,L849e
+			xor	c
+			dec	a
+			daa
+			ld	a,45h
+			ld	c,58h
+			ex	af,af'
+			ld	a,e8h
+			sbc	a,h
+			ld	(hl),a
+			pop	af
+			cp	a
+			ld	e,c
+			sbc	a,d
+			or	h
+			sbc	a,a
+			xor	e
+			or	a
+			and	(hl)
+			and	(hl)
+			and	b
+			ld	c,c
+			and	19h
+			adc	a,d
+			ld	d,a
+			inc	a
+			inc	h
+			dec	(hl)
+			ld	sp,hl
+			exx
+			and	a
+			sbc	a,l
+			ld	d,c
+			ld	a,(34b9h)
+			sbc	a,c
+			ld	c,c
+			add	a,e
+			dec	(hl)
+			ld	de,0e31h
+			ld	(hl),c
+			ld	a,(de)
+			dec	h
+			push	de
+			push	bc
+			ld	d,l
+			or	b
+			dec	hl
+			and	b
+			call	nc,L619c
+			or	a
+			pop	bc
+			ld	h,b
+			cp	a
+			sub	h
+			or	(hl)
+			ld	a,(hl)
+			ld	e,b
+			ld	a,(9bd8h)
+			call	po,L0e37
+			add	hl,hl
+			or	a3h
+			daa
+			adc	a,b
+			ret	m
+			rrca
+			sub	h
+			dec	sp
+			cp	d
+			add	a,l
+			ld	c,e
+			inc	(hl)
+			ld	c,e
+			ld	sp,5067h
+			dec	e
+			jr	c,L8dc1
+			jr	c,L8dd3
+			ld	l,c
+			rla
+			ld	hl,d4a8h
+			ld	d,(hl)
+			and	l
+			ld	c,(hl)
+			ld	l,l
+			inc	sp
+			sbc	a,c
+			xor	(hl)
+			ld	l,a
+			or	98h
+			rla
+			ex	af,af'
+			ld	h,h
+			inc	l
+			ld	l,e
+			rla
+			ld	e,l
+			ld	d,c
+			xor	76h
+			adc	a,b
+			cp	h
+			ld	b,l
+			sub	e
+			dec	a
+			ld	b,(hl)
+			adc	a,(hl)
+			ld	a,d
+			ld	de,5c77h
+			ld	c,a
+			ld	e,h
+			call	m,L7c22
+			sub	d
+			ld	l,h
+			sub	l
+			add	hl,de
+			inc	bc
+			ld	c,86h
+			adc	a,a
+			ret	p
+			jp	nz,L3152
+			jp	pe,L8da6
+			ld	b,d
+			sub	c
+			ld	h,c
+			jp	nc,L7c82
+			or	e
+			add	hl,sp
+			exx
+			ret
+			db	78h,28h,02h,5bh,61h,1ch,28h,cch
+			db	3bh,f7h,7dh,0bh,38h,d8h,6bh,f9h
+			db	02h,c0h,b3h,05h,9ch,10h,67h,72h
+			db	21h,b3h,cch,e0h,64h,a4h,5ch,c6h
+			db	b9h,7ch,bbh,7ah,80h,d9h,9eh,0ah
+			db	49h,1ch,b2h,58h,c9h,b2h,51h,45h
+			db	97h
+			ld	l,b
+			sub	b
+			jp	pe,L7f4c
+			ld	d,a
+			rrca
+			rst	10h
+			inc	(hl)
+			and	h
+			add	a,b
+			ld	(hl),b
+			inc	l
+			ld	(hl),0eh
+			ex	de,hl
+			in	a,(cch)
+			inc	sp
+			ld	l,e
+			jp	po,L2e09
+			ex	af,af'
+			ld	a,b
+			nop
+			ld	de,1c09h
+			cp	e
+			ld	(6469h),hl
+			rra
+			rra
+			dec	a
+			and	a
+			rrca
+			add	a,l
+			cp	d
+			ld	c,c
+			ld	(hl),d
+			ld	e,c
+			exx
+			rla
+			sbc	a,c3h
+			or	c
+			ld	a,l
+			ld	(hl),b
+			inc	e
+			ld	b,c
+			scf
+			ld	d,h
+			dec	b
+			dec	sp
+			inc	de
+			scf
+			ld	(hl),e
+			sub	d
+			ld	e,l
+			cp	d
+			ld	(hl),h
+			rra
+			call	z,L627a
+			or	c
+			ld	a,l
+			rrca
+			rst	08h
+			rst	28h
+			ld	h,a
+			rla
+			call	m,Le8d2
+			cp	(hl)
+			sub	iyl *
+			inc	c
+			sbc	a,d
+			xor	c
+			jp	p,L7d6f
+			cp	e
+			out	(9eh),a
+			dec	e
+			ret	po
+			or	b
+			add	a,58h
+			ld	a,h
+			or	c
+			ld	c,(hl)
+			cp	a
+			or	l
+			jp	nz,Lcf6f
+			ld	h,b
+			sbc	a,e
+			ld	a,(de)
+			inc	c
+			rst	00h
+			jr	c,L8e90
+			and	d
+			ld	h,a
+			sub	d
+			sub	h
+			call	pe,L5eb5
+			ld	b,l
+			nop (2x) *
+			dec	bc
+			dec	hl
+			ld	(hl),a
+			ld	h,e
+			add	a,c
+			ld	c,l
+			sbc	a,a
+			jp	z,L8899
+			djnz	L8f18
+			and	b
+			xor	c
+			halt
+			jp	nc,Lcf0b
+			rst	38h
+			ld	(bc),a
+			ei
+			or	b
+			ex	de,hl
+			call	nz,Lb037
+			sbc	a,(hl)
+			dec	e
+			ld	sp,17f2h
+			cp	h
+			ld	a,(de)
+			sub	b
+			ld	(hl),05h
+			ld	e,80h
+			cpl
+			jp	c,Ld531
+			dec	bc
+			ld	e,b
+			djnz	L8eee
+			sub	d
+			inc	bc
+			adc	a,e
+			ret	pe
+			pop	de
+			dec	de
+			and	h
+			sub	l
+			nop (2x) *
+			jp	nc,L3958
+			xor	e
+			dec	c
+			add	a,l
+			ld	d,e
+			sub	c
+			ld	c,b
+			jr	z,L8e8e
+			ld	e,e
+			ld	(hl),a
+			or	(hl)
+			jp	po,L5f97
+			sub	e
+			ld	a,(6d8bh)
+			inc	c
+			xor	d
+			ld	l,e
+			call	c,Lfe2d
+			jr	c,L8f08
+			ld	l,(hl)
+			call	c,Lb281
+			nop (2x) *
+			ld	l,c
+			add	a,e
+			ld	c,b
+			add	hl,bc
+			ex	(sp),hl
+			add	hl,hl
+			ld	a,(de)
+			ld	l,00h
+			sub	c
+			ret	nc
+			call	p,L460c
+			ld	(hl),d
+			in	a,(71h)
+			call	z,L2f29
+			cp	5eh
+			push	de
+			ld	b,(hl)
+			dec	sp
+			xor	e
+			ld	b,(hl)
+			sbc	a,6ch
+			ld	sp,hl
+			jp	nz,L6a18
+			ret	pe
+			pop	de
+			inc	h
+			di
+			ret
+			db	aah,14h,2ch,64h,87h,dbh,d5h,29h
+			db	55h,dah,46h,19h,a0h,30h,29h,71h
+			db	17h,abh,16h,54h,95h,a4h,d3h,f8h
+			db	cdh,61h,6fh,e7h,a6h,0ch,9bh,05h
+			db	ffh,25h,6bh,72h,b8h,b3h,e2h,ach
+			db	0bh,9eh,6eh,3bh,f2h,14h,4ah,57h
+			db	73h,88h,33h,20h,1eh,ebh,52h,89h
+			db	e6h,20h,59h,30h,b1h,a3h,aeh,35h
+			db	25h,10h,4bh,fah,70h,aah,41h,79h
+			db	ach,a5h,92h,f1h,94h,fah,5fh,f2h
+			db	14h,30h,87h,31h,1ch,2ch,42h,34h
+			db	dch,30h,dfh,31h,86h,ceh,0fh,1eh
+			db	73h,84h,bah,bbh,fah,e7h,c8h,6eh
+			db	30h,62h,9dh,99h,8ch,89h,3ch,69h
+			db	22h,b3h,63h,57h,efh
+			ld	(bc),a
+			xor	c
+			rst	00h
+			ld	d,8ah
+			adc	a,h
+			sbc	a,c
+			sub	(hl)
+			jp	p,Lc09c
+			ld	b,e
+			ld	b,d
+			jp	po,Lc245
+			call	z,Ldd80
+			ex	(sp),hl
+			ld	c,h
+			call	nz,L598d
+			ld	(0c4dh),hl
+			ld	(hl),h
+			sub	l
+			in	a,(f4h)
+			inc	c
+			pop	bc
+			ret
+			db	16h,67h,29h,76h,a2h,5dh,d2h,60h
+			db	54h,0fh,f1h,5fh,67h,21h,54h,97h
+			db	68h,72h,6ah,6bh,dbh,09h,9dh,8bh
+			db	c9h,e8h,d3h,27h,6eh,5dh,d3h,50h
+			db	dbh,02h,3fh,96h,91h,f8h,14h,32h
+			db	8ah,6ch,0eh,56h,73h,eeh,58h,3bh
+			jp	(hl)
+			db	43h,c0h,ffh,67h,b4h,a6h,65h,98h
+			db	19h,e7h,27h,50h,2eh,85h,d8h,47h
+			db	07h,47h,c1h,71h
+			cp	9fh
+			rst	30h
+			inc	b
+			ex	(sp),hl
+			or	e
+			ld	d,a
+			dec	a
+			call	Lacc8
+			rst	38h
+			inc	h
+			ld	h,h
+			ld	e,bfh
+			inc	sp
+			ld	a,a
+			ld	c,c
+			ld	a,(hl)
+			jr	nc,L8feb
+			ld	l,a
+			and	l
+			adc	a,d
+			call	nz,Leaed
+			xor	31h
+			or	(hl)
+			add	a,a9h
+			ld	c,a
+			ld	e,d
+			or	e
+			jr	L9068
+			db	6eh,54h,12h,6eh,54h,0dh,b7h,d0h
+			db	8ch,83h,e7h,52h,c0h,56h,c3h,73h
+			db	7bh,33h,aeh,01h,32h,f3h,27h,24h
+			db	70h,0ah,eeh,fbh,83h,e8h,fbh,fbh
+			db	86h,13h,04h,33h,8ah,e6h,a2h
+			add	hl,bc
+			ld	l,d
+			xor	l
+			or	e
+			ld	hl,4653h
+			jp	m,L21af
+			ld	(de),a
+			daa
+			ld	h,c
+			adc	a,a
+			pop	af
+			call	L2ad4
+			ld	sp,hl
+			or	d
+			djnz	L90cd
+			ld	c,l
+			sbc	a,b
+			dec	l
+			or	c
+			call	nz,L99ee
+			call	pe,Lfc49
+			call	c,L8de7
+			rst	28h
+			ld	e,d
+			ld	h,a
+			ex	(sp),hl
+			cp	(hl)
+			jp	Lc7a5
+			db	f0h,60h,7fh,0bh,cfh,f4h,cah,83h
+			db	44h,57h,05h,37h,7dh,ffh,82h,b9h
+			db	16h,adh,d9h,85h,5ah,6bh,e0h,6bh
+			db	2ah,72h,16h,37h,27h,1ah
+			or	c
+			inc	hl
+			ld	d,b
+			rst	20h
+			or	h
+			ld	d,a
+			add	hl,sp
+			jp	nz,L40e5
+			ld	d,63h
+			ld	(bc),a
+			sub	c
+			ld	(hl),c
+			ld	c,(hl)
+			jp	po,L645f
+			ld	l,e5h
+			ld	c,e
+			rst	18h
+			ld	h,d
+			ld	e,(hl)
+			add	a,h
+			xor	6ah
+			inc	h
+			ld	h,b
+			ld	(hl),01h
+			ret	po
+			dec	b
+			adc	a,d
+			add	a,b
+			cp	h
+			halt
+			sbc	a,a
+			ld	l,l
+			adc	a,l
+			ld	(7e70h),a
+			ld	a,h
+			inc	de
+			dec	sp
+			ld	h,(hl)
+			ret	c
+			inc	hl
+			inc	de
+			sbc	a,e
+			ret	nc
+			ld	c,h
+			and	d
+			ld	d,(hl)
+			adc	a,d
+			ld	(de),a
+			add	a,c
+			call	z,L9cf2
+			di
+			sbc	a,h
+			ld	c,h
+			rst	10h
+			rst	00h
+			pop	hl
+			rst	10h
+			ld	d,b
+			ld	a,(de)
+			ld	(hl),l
+			djnz	L9096
+			sbc	a,b
+			ld	e,e1h
+			ld	(hl),b
+			in	a,(9fh)
+			add	a,d
+			sbc	a,a
+			xor	e
+			sbc	a,d
+			push	af
+			or	h
+			add	a,b
+			ld	h,e
+			push	af
+			inc	hl
+			call	m,L4c23
+			ld	h,l
+			add	a,b
+			ret	nc
+			ld	l,(hl)
+			dec	hl
+			ret	po
+			ld	h,c
+			sub	e
+			call	p,Lc393
+			add	hl,de
+			call	c,L01d8
+			inc	c
+			call	m,L79aa
+			ld	h,d
+			ld	e,c
+			inc	a
+			ld	c,l
+			ld	a,h
+			dec	hl
+			and	h
+			and	d
+			halt
+			jp	pe,Ldb1f
+			call	nc,L0996
+			ld	(hl),c
+			rst	10h
+			ret	nz
+			or	e
+			ld	bc,f21fh
+			rst	18h
+			ld	c,e
+			ld	h,c
+			ld	e,a
+			jp	nz,Ld100
+			ex	af,af'
+			rla
+			ld	h,a
+			ccf
+			inc	hl
+			adc	a,a
+			ld	hl,(0c0eh)
+			inc	d
+			jp	p,Laaa1
+			ld	(bc),a
+			ld	l,a
+			jp	m,L97db
+			jp	nz,Led26
+			cp	(hl)
+			or	c
+			add	hl,bc
+			xor	h
+			ret	p
+			ld	(hl),e
+			inc	hl
+			ld	(de),a
+			rst	30h
+			dec	ixh *
+			adc	a,h
+			ld	(fa00h),hl
+			inc	d
+			ld	e,l
+			dec	de
+			ld	c,(hl)
+			sbc	a,d
+			cp	4ch
+			or	58h
+			sub	h
+			ld	e,(hl)
+			ret	m
+			add	hl,bc
+			ret
+			db	a0h,b6h,a6h,77h,b9h,86h,6fh,bah
+			db	e4h,d1h,2ch,aeh,eah,50h,9ah,0ah
+			db	fdh,26h,21h,48h,18h,c7h,b9h,43h
+			db	3fh,53h,2ah,c6h,16h,4fh,dbh,abh
+			db	7fh,48h,a2h,afh,83h,f4h,3eh,2dh
+			db	d1h,6ah,84h,26h,6dh,21h,ech,d4h
+			db	eeh,4ah,36h,25h,b6h,9bh,2ch,e7h
+			db	8ah,39h,20h,30h,e1h,5eh,0dh,73h
+			db	56h,1fh,4eh,c0h,8bh,20h,4bh,3ah
+			db	e5h,4ch,c9h,85h,aeh,b9h,7ch,55h
+			db	b1h,35h,29h,13h,aeh,32h,9ah,f9h
+			db	a2h,edh,4eh,d6h,bdh,f9h,c5h,6bh
+			db	76h,99h,ffh,60h,67h,0ah,c8h,6ah
+			db	d6h,35h,56h,3ah,21h,34h,c6h,77h
+			db	39h,d1h,9ch,fah,07h,2dh,31h,15h
+			db	30h,89h,00h,7ch,48h,97h,8bh,83h
+			db	feh,11h,e5h,d9h,9bh,ddh,cch,3eh
+			db	87h,99h,dfh,27h,e4h,63h,06h,36h
+			db	55h,ech,d6h,49h,1eh,efh,4ah,08h
+			db	42h,3bh,98h,f4h,a1h,28h,7eh,09h
+			db	61h,1bh,b8h,32h,e5h,c5h,3bh,97h
+			db	f8h,63h,b6h,c7h,4dh,b3h,61h,d3h
+			db	dah,cbh,beh,7ch,4ch,18h,8eh,79h
+			db	6eh,2eh,fah,69h,a9h,cfh,8eh,57h
+			db	cfh,2ah,d0h,86h,dfh,eeh,51h,a1h
+			db	9fh,80h,b2h,eah,4ah,70h,a8h,6eh
+			db	d1h,c1h,3bh,86h,b4h,49h,c0h,f1h
+			db	0ch
+			xor	e
+			dec	l
+			inc	b
+			djnz	L9237
+			ld	sp,hl
+			dec	d
+			jr	c,L92b4
+			ld	(hl),a
+			ld	sp,f09bh
+			ld	e,d
+			cp	(hl)
+			add	a,(hl)
+			cp	l
+			call	nz,L8d66
+			ld	hl,(bc4ah)
+			push	hl
+			dec	h
+			ex	af,af'
+			ld	a,(39e8h)
+			xor	e
+			inc	de
+			dec	l
+			adc	a,b
+			cp	a
+			ld	b,l
+			ld	l,d
+			and	d
+			ld	(hl),h
+			cp	b
+			rst	28h
+			ld	a,(9530h)
+			ld	l,c
+			ld	b,a
+			ld	h,c
+			ld	a,h
+			ld	a,(0818h)
+			ld	d,l
+			and	e
+			in	a,(f8h)
+			or	b
+			sub	d
+			jr	z,L925c
+			adc	a,c
+			ld	l,h
+			ret	nz
+			cp	c
+			ld	e,25h
+			ld	a,a
+			ld	h,a3h
+			scf
+			scf
+			ld	h,c
+			ld	l,(hl)
+			ld	h,d
+			ld	sp,8661h
+			ld	e,e
+			adc	a,c
+			call	po,L3872
+			ld	h,c
+			pop	hl
+			ld	d,(hl)
+			inc	(hl)
+			add	a,b
+			ld	a,d
+			ld	h,5ch
+			pop	de
+			add	a,h
+			jp	pe,L5dc8
+			ld	l,b
+			or	7dh
+			add	hl,hl
+			call	z,Lbc8d
+			ld	l,d6h
+			ld	(hl),h
+			ld	hl,(Lcf94)
+			and	h
+			out	(79h),a
+			pop	bc
+			inc	l
+			sub	h
+			cp	e
+			call	pe,L8022
+			jp	po,L383e
+			inc	hl
+			ld	d,h
+			ld	a,(hl)
+			sbc	a,a
+			add	hl,bc
+			nop (2x) *
+			ret	c
+			ld	a,(bc)
+			pop	hl
+			call	pe,La19a
+			dec	d
+			ld	l,b
+			dec	hl
+			ld	de,e7efh
+			or	d
+			ld	c,e
+			pop	bc
+			rst	28h
+			inc	l
+			add	a,a
+			inc	h
+			sbc	a,51h
+			ld	a,(hl)
+			ld	e,d
+			ld	d,a
+			rrca
+			ld	e,a
+			ld	e,b
+			rst	00h
+			ld	e,l
+			jr	nz,L925e
+			ld	l,d
+			or	l
+			in	a,(7ch)
+			dec	a
+			ld	e,l
+			dec	h
+			ld	a,(af8dh)
+			rst	30h
+			or	h
+			ret	m
+			sbc	a,a
+			ld	e,h
+			ld	h,c
+			dec	hl
+			sub	b
+			pop	bc
+			dec	h
+			sub	d
+			and	91h
+			or	c2h
+			ld	(hl),d
+			dec	(hl)
+			or	c
+			ret	pe
+			dec	h
+			ld	l,(hl)
+			add	hl,de
+			ld	h,h
+			ld	hl,20a2h
+			ld	l,h
+			ld	sp,69dfh
+			inc	c
+			or	e
+			jr	c,L929b
+			ld	hl,c423h
+			rst	30h
+			ld	b,c
+			ld	a,c
+			cpl
+			ld	l,c
+			jr	c,L92ee
+			ret	nc
+			inc	h
+			ld	l,b
+			ld	(L9cf2),a
+			bit	5,l
+			and	h
+			ld	l,d
+			xor	(hl)
+			ld	(hl),l
+			or	d
+			pop	af
+			ld	d,b
+			inc	de
+			rrca
+			ld	(hl),l
+			call	pe,Lc42b
+			cpl
+			inc	h
+			and	b
+			ld	d,(hl)
+			ld	(9092h),a
+			add	hl,sp
+			adc	a,b
+			ld	b,l
+			ld	h,e
+			sbc	a,h
+			xor	a
+			sub	h
+			rla
+			adc	a,a
+			ld	bc,e13bh
+			ld	(de),a
+			scf
+			rrca
+			xor	a
+			rlca
+			and	e
+			ld	d,d
+			inc	(hl)
+			ld	a,c
+			add	hl,sp
+			ld	b,a
+			xor	l
+			dec	e
+			xor	l
+			ex	de,hl
+			dec	bc
+			add	a,c
+			and	h
+			jp	m,L7e62
+			ld	(hl),l
+			xor	c
+			or	a
+			ld	h,e
+			inc	sp
+			pop	af
+			rlca
+			and	b
+			ld	hl,(3b56h)
+			inc	h
+			inc	d
+			rst	18h
+			ld	sp,8db7h
+			inc	l
+			cp	e
+			push	hl
+			add	hl,bc
+			xor	a
+			add	hl,de
+			sbc	a,l
+			ld	l,(hl)
+			jr	nc,L93a6
+			ld	h,d
+			ld	l,c3h
+			daa
+			ld	c,l
+			ld	(hl),c
+			add	a,a8h
+			ld	c,b
+			rst	00h
+			jp	(hl)
+			db	53h,88h,02h,9bh
+			add	a,e
+			rst	28h
+			add	a,e
+			ret	po
+			ret	z
+			exx
+			jp	po,L00a1
+			cp	b
+			ld	a,e
+			ld	(hl),a
+			sbc	a,(hl)
+			ld	h,(hl)
+			ld	a,(hl)
+			cp	e
+			cp	e
+			sbc	a,b
+			scf
+			cp	l
+			di
+			ld	(hl),a
+			ccf
+			ld	(hl),h
+			ld	h,b
+			sbc	a,a
+			ld	(hl),afh
+			inc	a
+			dec	l
+			dec	de
+			or	h
+			rst	28h
+			ld	d,c
+			halt
+			cp	(hl)
+			ld	e,b
+			pop	bc
+			xor	l
+			rrca
+			ld	e,h
+			call	p,L62ce
+			and	37h
+			cp	(hl)
+			dec	(hl)
+			push	af
+			dec	hl
+			ld	h,bah
+			cp	h
+			cp	l
+			ld	l,(hl)
+			push	hl
+			sbc	a,a
+			ld	b,d
+			ld	h,d
+			ld	h,h
+			rst	38h
+			ld	bc,c4dfh
+			and	e
+			xor	4ch
+			jr	L9423
+			db	b5h,23h,67h,9ch,f4h,5fh,91h,c4h
+			db	18h,dah,5ch,0ch,28h,7ch,c9h,c5h
+			db	1bh,93h,adh,0dh
+			dec	(hl)
+			jr	nz,L9367
+			ld	(hl),h
+			and	b
+			and	b
+			add	a,c
+			dec	bc
+			cp	d
+			cp	c
+			sbc	a,h
+			and	(hl)
+			inc	b
+			ld	hl,(29fbh)
+			sbc	a,l
+			inc	h
+			ld	a,(de)
+			inc	h
+			adc	a,h
+			rst	28h
+			xor	19h
+			ld	d,e
+			ld	c,l
+			push	af
+			jp	p,L4fba
+			dec	bc
+			ld	c,dbh
+			ld	h,a
+			ld	h,c
+			ld	e,b
+			jp	z,Lba01
+			ld	hl,(5ce5h)
+			and	l
+			adc	a,h
+			jr	z,L93e3
+			ld	e,b
+			or	dfh
+			ld	e,l
+			ld	e,l
+			pop	de
+			add	a,l
+			inc	(hl)
+			sbc	a,d
+			ld	(cabfh),hl
+			in	a,(0fh)
+			ld	d,fbh
+			ld	l,c
+			ld	bc,9866h
+			ld	d,69h
+			ld	e,4fh
+			sub	l
+			or	c
+			xor	c
+			adc	a,b
+			xor	(hl)
+			ld	l,a
+			di
+			ld	sp,hl
+			and	b
+			rst	20h
+			ld	b,d
+			push	de
+			ld	a,c
+			ld	c,b
+			inc	h
+			inc	h
+			xor	b
+			ld	a,c
+			ret	z
+			sll	l
+			ld	h,e
+			ld	c,e
+			sub	a
+			sub	h
+			add	hl,bc
+			add	a,h
+			push	bc
+			ld	(hl),d
+			nop
+			ld	e,a
+			ld	d,(hl)
+			nop (2x) *
+			ret	p
+			ld	c,(hl)
+			add	hl,bc
+			sbc	a,l
+			inc	e
+			or	(hl)
+			rst	08h
+			ret	po
+			xor	h
+			ld	a,(de)
+			add	hl,bc
+			rst	38h
+			ld	(dda0h),a
+			pop	af
+			ld	(hl),a
+			ex	af,af'
+			xor	a
+			ld	c,d
+			ld	l,h
+			ld	(bc),a
+			and	b
+			ld	a,(de)
+			ld	e,b
+			ld	a,b
+			jr	nz,L9458
+			ld	c,43h
+			push	de
+			call	nc,L5476
+			xor	l
+			ld	b,d
+			ld	l,a
+			ld	e,f6h
+			ld	d,d
+			ld	e,l
+			adc	a,(hl)
+			ld	hl,30d5h
+			pop	de
+			and	c
+			ld	l,9eh
+			daa
+			ld	e,e
+			ld	b,a
+			ld	l,(hl)
+			ld	l,11h
+			ld	(hl),c
+			call	z,L0b8c
+			sub	d
+			sub	l
+			pop	bc
+			jp	nc,L01dc
+			adc	a,25h
+			or	3dh
+			add	a,a
+			and	h
+			xor	d
+			ld	e,l
+			ld	h,e
+			ld	(7a58h),a
+			ld	b,b
+			call	p,L21b1
+			ld	a,88h
+			add	hl,de
+			adc	a,c
+			ld	e,d
+			dec	l
+			ld	bc,e59dh
+			ld	d,l
+			jp	z,L6193
+			cpdr
+			ld	(d105h),hl
+			ld	b,75h
+			add	a,a7h
+			ret	z
+			adc	a,a2h
+			push	hl
+			add	a,c
+			pop	de
+			sbc	a,c
+			sub	h
+			ret	p
+			xor	e
+			ld	a,h
+			ld	l,1bh
+			ld	e,h
+			call	po,L3089
+			ld	h,(hl)
+			ld	l,l
+			nop (2x) *
+			inc	e
+			xor	(hl)
+			rla
+			ret	c
+			ld	d,l
+			cp	a
+			inc	hl
+			ld	a,d
+			inc	c
+			add	a,a
+			ld	h,c
+			ret
+			db	33h,d2h,60h,d0h,32h,a4h,4eh,10h
+			db	5eh,1dh,97h,9fh,76h,9ch,24h,ebh
+			db	28h,9ch
+			jp	(hl)
+			db	75h,b4h,e6h,7eh,c2h,42h,4fh,2eh
+			db	5ch,44h,f5h,f7h,3ah,8ah,83h,1fh
+			db	76h,e5h,d0h,12h,57h,e5h,0dh,4ah
+			db	66h,0dh,89h
+			jr	nc,L94c0
+			adc	a,a
+			ld	a,(6e06h)
+			ret	c
+			ld	a,l
+			rst	28h
+			pop	hl
+			and	d
+			sbc	a,(hl)
+			jp	nz,L092d
+			ld	d,e
+			pop	bc
+			jp	nc,L827a
+			ld	h,c
+			inc	l
+			ret	m
+			ld	l,h
+			djnz	L9546
+			ld	c,a
+			ret	p
+			ld	d,d
+			cp	b
+			ld	h,cfh
+			ld	l,b
+			ld	b,b
+			cp	(hl)
+			dec	h
+			ret	nc
+			xor	a
+			ld	d,42h
+			sbc	a,04h
+			ld	hl,98c7h
+			halt
+			call	m,Le60a
+			or	41h
+			in	a,(81h)
+			jp	La8cc
+			db	2dh,bch,4ch,e2h,01h,08h,1dh,11h
+			db	dah,a6h,01h,a8h,2bh,43h,c3h,fch
+			db	2ch,22h,56h,b4h,8ch,62h,23h,78h
+			db	e9h,b2h,a4h,beh,55h,d5h,9dh,38h
+			db	7ch,b3h,ceh,48h,0bh,6fh,63h,45h
+			db	8fh,95h,efh,e5h,f8h,92h,04h,31h
+			db	36h,c2h
+			pop	de
+			xor	h
+			inc	bc
+			ret	nz
+			ld	de,1960h
+			jp	po,L9469
+			or	d
+			call	m,L00f0
+			inc	de
+			inc	h
+			xor	e
+			and	d
+			in	a,(1fh)
+			xor	c
+			and	h
+			adc	a,8ch
+			jr	L959a
+			db	15h,d9h,03h,25h,92h,f3h,25h,34h
+			db	71h,f1h,31h,adh,8dh,5eh,a3h,1eh
+			db	33h,82h,68h,62h,89h,f5h,b2h,8bh
+			db	bdh,0bh,71h,39h,a5h
+			ld	(bc),a
+			add	a,c
+			ld	h,(hl)
+			or	c
+			rst	30h
+			cp	h
+			cp	e
+			ld	c,l
+			and	a
+			inc	a
+			rst	38h
+			adc	a,(hl)
+			ld	d,b
+			sub	a3h
+			dec	bc
+			jp	m,Le959
+			sbc	a,e
+			sub	c
+			add	hl,hl
+			ld	a,(de)
+			call	p,L1c77
+			adc	a,(hl)
+			xor	d
+			ld	a,(hl)
+			or	a
+			ld	e,a
+			rst	20h
+			push	bc
+			ld	d,(hl)
+			ld	hl,a8c7h
+			push	af
+			ld	d,bdh
+			or	d
+			and	69h
+			and	c
+			sub	b
+			ld	d,l
+			ld	(hl),44h
+			jp	p,L8903
+			ret
+			db	bdh,0ah,98h,fdh,7fh,2ch,3ch,2ah
+			db	f2h,aah,76h,d5h,70h,5bh,f8h,68h
+			db	d1h,26h,60h,d4h,feh,0ah,5dh,cch
+			db	6eh,54h,d5h,f2h,4bh,c8h,94h,f3h
+			db	34h,85h,c0h,9ah,93h,88h,36h,4eh
+			db	c6h,2ah,69h,cfh,9ah,48h,0eh,38h
+			db	f4h,4bh,61h,a3h,a4h,f8h,f4h,30h
+			db	a4h,34h,b8h,b1h,20h,c4h,16h,45h
+			db	dah,d8h,80h,33h,6bh,3bh,30h,f5h
+			db	2eh,4fh,8ch,c8h,05h,f9h,5ah,32h
+			db	9ah,f5h,69h,a6h,0dh,45h,11h,fch
+			db	d9h,fbh,f1h,3fh,97h,98h,06h,ceh
+			db	13h,63h,01h,69h,a6h,bah,72h,eah
+			db	18h,95h,b3h,e6h,d8h,7fh,6ah,a3h
+			db	c6h,d8h,3ah,2eh,78h,71h,d7h,5ch
+			db	c0h,dfh,64h,7bh,bah,b1h,68h,02h
+			db	11h,10h,d6h,78h,f8h,67h,eeh,59h
+			db	c0h,fch,33h,61h,e7h,c7h,3ah,64h
+			db	30h,0fh,d4h,89h,6bh,8bh,32h,f1h
+			dec	(hl)
+			ld	(hl),a
+			sub	(hl)
+			ld	(hl),a
+			or	l
+			ld	d,d
+			dec	l
+			sbc	a,l
+			xor	e
+			pop	af
+			ret	p
+			pop	de
+			ld	a,e
+			inc	de
+			rrca
+			rst	18h
+			ld	h,h
+			rst	28h
+			ld	a,b
+			dec	de
+			ret	z
+			ld	e,e
+			sbc	a,(hl)
+			ld	a,(hl)
+			pop	bc
+			or	d
+			rra
+			call	nc,L3234
+			ret	p
+			inc	(hl)
+			ld	a,69h
+			cpl
+			inc	l
+			ld	sp,hl
+			sub	l
+			ld	a,c
+			inc	d
+			ld	(hl),l
+			ld	e,e
+			pop	af
+			dec	sp
+			ld	e,a
+			ld	h,a
+			sbc	a,(hl)
+			ld	l,l
+			add	a,a
+			sbc	a,ixh *
+			ld	a,d3h
+			nop (2x) *
+			ld	d,a
+			nop
+			inc	sp
+			cp	bfh
+			or	a
+			in	a,(a5h)
+			sbc	a,e
+			ld	e,h
+			or	h
+			ld	c,f3h
+			ld	e,d
+			and	(hl)
+			nop (2x) *
+			add	a,b
+			ld	e,b
+			sbc	a,c
+			sbc	a,e
+			ld	d,c
+			push	de
+			ld	(de),a
+			ld	c,e
+			ld	c,d
+			ld	e,7dh
+			ret	nz
+			adc	a,e
+			jp	z,L005b
+			inc	b
+			ld	d,b
+			and	(hl)
+			ccf
+			rla
+			call	nc,L5b85
+			ret
+			db	6fh,a5h,2ah,d3h,68h,84h,b4h,fah
+			ld	(hl),c
+			ld	a,b
+			push	af
+			or	e
+			ld	e,b
+			ld	l,b
+			xor	99h
+			ld	(hl),edh
+			call	nc,L4cd6
+			ld	l,d8h
+			ld	b,(hl)
+			ld	l,(hl)
+			ld	(hl),d
+			xor	l
+			ld	e,a
+			ld	d,4ch
+			jr	nc,L9649
+			sub	a
+			ld	c,c
+			inc	b
+			and	e
+			ld	c,h
+			rst	18h
+			and	l
+			ld	sp,hl
+			ld	e,d
+			rst	38h
+			bit	2,d
+			ld	d,(hl)
+			or	d
+			ld	c,h
+			ld	b,e
+			xor	l
+			call	nc,Le7b2
+			and	e
+			jr	c,L971d
+			rst	28h
+			ld	h,e
+			jp	pe,L16cc
+			inc	l
+			jp	nz,Le2a2
+			ex	af,af'
+			adc	a,l
+			ld	c,b
+			cpl
+			ld	h,l
+			and	a
+			ld	l,e
+			pop	af
+			rst	00h
+			add	a,(hl)
+			or	d
+			rst	18h
+			cp	l
+			call	po,La96d
+			ld	c,c
+			pop	de
+			sub	9dh
+			ld	l,a
+			ld	a,(hl)
+			inc	h
+			pop	bc
+			ld	l,h
+			or	b
+			adc	a,a
+			jp	p,L28fa
+			ld	e,(hl)
+			inc	d
+			jp	po,L225b
+			ex	de,hl
+			ld	e,h
+			dec	c
+			dec	b
+			xor	(hl)
+			ld	a,66h
+			sbc	a,l
+			sub	d
+			jp	(hl)
+			db	deh,66h,d3h,60h,5fh,feh,8fh
+			pop	bc
+			cp	h
+			sub	(hl)
+			ld	b,l
+			and	d
+			inc	b
+			ld	e,c
+			inc	h
+			ld	c,l
+			and	h
+			ld	e,h
+			add	a,(hl)
+			ld	(ff34h),hl
+			inc	a
+			ld	b,(hl)
+			rst	08h
+			sbc	a,3ah
+			ld	a,(dccfh)
+			ld	b,b
+			sbc	a,d
+			jp	c,Lb18b
+			ld	bc,2291h
+			jr	nc,L9736
+			ld	ixl,ixh *
+			ld	d,a
+			and	e
+			ret	p
+			jp	p,L2d58
+			ld	l,h
+			and	l
+			ld	(hl),b
+			inc	sp
+			cp	(hl)
+			add	a,a
+			sbc	a,5bh
+			push	hl
+			ld	a,l
+			or	l
+			jp	(hl)
+			db	1dh,88h,93h,46h,7fh,f3h,27h,43h
+			db	c0h,b2h,27h,16h,7dh,9ch,29h,25h
+			db	fah,98h,ach,07h,32h,20h,adh,a0h
+			db	1ch,f1h,72h,62h,d6h,59h,e8h,b9h
+			db	a0h,39h,1ah,b1h,9dh
+			add	a,h
+			add	hl,sp
+			ld	a,l
+			inc	l
+			ld	b,58h
+			ld	h,c
+			jp	pe,Lf809
+			rst	00h
+			djnz	L9722
+			nop (2x) *
+			cp	e
+			ld	a,d
+			dec	h
+			ex	(sp),hl
+			ld	hl,(f2fdh)
+			ex	af,af'
+			add	a,a
+			call	nc,L6447
+			pop	hl
+			and	h
+			ld	b,e
+			xor	b
+			ret	z
+			ccf
+			ld	e,h
+			xor	(hl)
+			or	l
+			or	a
+			jp	nc,L94e7
+			add	hl,hl
+			ld	h,a
+			sbc	a,d
+			add	a,e
+			and	e
+			inc	sp
+			ex	de,hl
+			ld	c,b
+			rst	28h
+			ld	h,d
+			or	h
+			sbc	a,(hl)
+			dec	de
+			ld	c,b
+			jp	(hl)
+			db	1dh,28h,b1h,4eh,dfh,58h,ddh,ebh
+			db	bdh,ach,a1h,ffh,deh,d8h,13h,5ah
+			db	f6h,53h,4dh,4eh,2dh,b2h
+			ld	e,l
+			and	d
+			dec	c
+			ld	b,(hl)
+			ld	a,c
+			push	de
+			and	(hl)
+			jp	c,L9240
+			or	e
+			ld	h,4ah
+			add	a,b
+			ld	de,7668h
+			ld	bc,0eabh
+			ld	h,l
+			ld	e,a
+			ld	e,40h
+			ld	l,(hl)
+			ld	bc,c71fh
+			ld	(hl),67h
+			call	z,L735e
+			ld	e,b
+			ld	a,e
+			rst	10h
+			dec	(hl)
+			push	de
+			adc	a,(hl)
+			exx
+			cp	a5h
+			or	l
+			ld	a,(hl)
+			dec	e
+			ld	a,(bc)
+			inc	a
+			sbc	a,a
+			and	c
+			jr	L983a
+			and	l
+			ret
+			db	5dh,b8h,94h,3ch,83h,78h,3fh,ffh
+			db	d2h,68h,91h,1dh,5ch,68h,34h,08h
+			db	84h,8ch,39h,deh,41h,67h,cah,77h
+			db	48h,a1h,53h,0bh,7ch,1ch,88h,41h
+			db	c9h,c4h,e2h,81h,5bh,89h,1ah,55h
+			db	65h,abh,14h,10h,51h,01h,8fh,40h
+			db	74h,c7h,d0h,f8h,12h,c4h,1fh,c6h
+			db	e2h,6fh,50h,88h,0eh,0bh,b6h,58h
+			db	65h,62h
+			ld	(4135h),a
+			ld	e,e
+			ld	bc,303ch
+			cp	h
+			cpl
+			ld	(hl),a1h
+			rra
+			ld	d,l
+			ccf
+			dec	hl
+			dec	(hl)
+			cp	c
+			ld	e,a
+			ld	e,h
+			and	c
+			add	hl,bc
+			adc	a,(hl)
+			dec	de
+			rst	10h
+			rlca
+			ld	(hl),c
+			ld	l,b
+			ld	(hl),b
+			or	c
+			ld	h,e
+			rst	20h
+			cpl
+			ld	(hl),h
+			ld	b,a
+			rst	30h
+			call	po,L1c67
+			dec	bc
+			add	a,h
+			adc	a,e
+			cp	(hl)
+			ld	c,b
+			and	a
+			ld	h,c
+			sub	h
+			ld	h,ach
+			ld	(hl),c
+			sbc	a,d
+			ld	a,b
+			add	a,d
+			ld	d,d
+			ld	e,e
+			ei
+			ret	po
+			add	a,e
+			or	l
+			dec	de
+			ex	(sp),hl
+			jp	p,Lc93c
+			dec	bc
+			and	f1h
+			ld	h,l
+			ld	a,b
+			dec	b
+			jr	nz,L9862
+			adc	a,l
+			ld	hl,c4cfh
+			sub	c
+			ld	l,d
+			xor	h
+			ld	a,e
+			or	92h
+			res	0,d
+			jp	nz,L1fa2
+			dec	hl
+			add	hl,de
+			ld	h,c
+			and	l
+			inc	de
+			ld	a,h
+			add	a,b
+			jp	m,L7c6a
+			jp	nc,Ldf58
+			and	d
+			ld	b,d
+			inc	sp
+			sbc	a,e
+			call	pe,Ld7e4
+			ld	d,l
+			ld	d,d
+			out	(29h),a
+			inc	l
+			ld	b,a
+			or	h
+			inc	(hl)
+			ld	a,h
+			rla
+			ld	l,c
+			and	c
+			ld	bc,5083h
+			or	l
+			ld	a,l
+			ld	(hl),a
+			ld	d,b
+			ld	h,h
+			nop (2x) *
+			ld	b,a
+			ld	sp,hl
+			ld	sp,hl
+			dec	(hl)
+			and	c
+			ld	b,e
+			ld	b,e
+			rla
+			dec	c
+			jr	z,L98e3
+			rst	10h
+			call	nz,Lc70f
+			dec	(hl)
+			rst	18h
+			or	(hl)
+			call	m,Leb2e
+			pop	af
+			ld	(hl),a
+			ld	(bc),a
+			add	hl,de
+			jp	nc,L90d3
+			sbc	a,06h
+			out	(4fh),a
+			ld	h,c
+			ld	a,l
+			ret	z
+			inc	h
+			inc	d
+			inc	d
+			ld	b,a0h
+			ld	h,c
+			nop
+			ld	(hl),d
+			dec	l
+			adc	a,d
+			call	nz,Le075
+			ld	d,deh
+			ld	h,l
+			ld	e,a
+			ld	e,l
+			ld	l,e
+			adc	a,b
+			xor	a
+			ld	d,c
+			add	a,a
+			xor	c
+			rla
+			adc	a,b
+			ld	d,e
+			jp	pe,L97c3
+			rlca
+			adc	a,a
+			inc	h
+			inc	d
+			ex	de,hl
+			ld	(hl),h
+			add	a,d
+			ld	b,d
+			sbc	a,h
+			adc	a,d
+			and	a
+			dec	hl
+			ld	de,b1b4h
+			call	po,L1e72
+			ld	h,b
+			adc	a,a
+			call	pe,L6543
+			dec	d
+			ccf
+			scf
+			sbc	a,h
+			ld	l,a
+			jp	p,L8ecb
+			ld	d,d
+			ld	h,2fh
+			jp	nc,L630d
+			ld	b,h
+			jp	(hl)
+			db	c2h,86h,94h,5ah,75h,a2h,3ah,41h
+			db	16h,2eh,dfh,d4h,05h,0ch,fah,73h
+			db	e6h,77h,3ah,74h,5ch,a8h,adh,5ah
+			db	c9h,d8h,edh,f2h,e9h,53h,afh,5ah
+			db	39h,6dh,b5h,55h,d0h,cfh,8dh,2bh
+			db	a7h,1ah,adh,55h,7ch,3fh
+			and	l
+			sbc	a,c
+			add	a,ceh
+			ld	h,a
+			ld	hl,5bfbh
+			ld	e,(hl)
+			sbc	a,55h
+			ld	d,e
+			ld	d,b
+			or	d
+			inc	sp
+			pop	af
+			ld	e,(hl)
+			ld	l,(hl)
+			or	a
+			halt
+			and	h
+			call	nc,L6ac8
+			rst	10h
+			ld	(bc),a
+			ld	l,d
+			ld	d,27h
+			sub	b
+			add	hl,hl
+			dec	d
+			ld	d,c
+			call	pe,L7e2e
+			call	z,L4328
+			and	c
+			ld	b,e
+			add	a,d
+			or	b
+			ld	e,c
+			xor	l
+			sbc	a,(hl)
+			ld	b,(hl)
+			sbc	a,d
+			ld	c,a
+			and	b
+			jr	L99e4
+			db	b3h,35h,0ah,37h,4ah,10h,8fh,31h
+			db	12h,9ah,39h,d1h,73h,b8h,b1h,82h
+			db	e5h,0fh,38h
+			and	(hl)
+			call	z,Lbe99
+			ld	(hl),e
+			in	a,(d4h)
+			ld	e,76h
+			cp	l
+			jp	nc,Lf82e
+			ld	hl,68e9h
+			ld	e,h
+			cp	a
+			sbc	a,b
+			adc	a,b
+			ld	(hl),d
+			cp	l
+			jp	z,L7f90
+			ld	a,(53c5h)
+			ret	m
+			add	a,l
+			or	c
+			call	m,Ld137
+			ld	b,l
+			xor	l
+			rst	20h
+			ld	a,c
+			sub	d
+			ld	(hl),h
+			sbc	a,c
+			jp	c,L4b46
+			or	l
+			ld	(hl),l
+			jp	pe,L683b
+			add	a,63h
+			jp	p,Ld5c3
+			inc	bc
+			dec	h
+			ld	h,c
+			ld	b,(hl)
+			ret	nc
+			dec	a
+			ld	d,b
+			ld	a,b
+			ld	h,e
+			ld	e,a
+			dec	de
+			ld	a,(de)
+			rst	28h
+			ex	de,hl
+			ld	(f39ah),a
+			ld	c,d
+			ret	m
+			inc	hl
+			cp	a
+			ex	de,hl
+			inc	sp
+			pop	hl
+			ld	(hl),e
+			cp	d
+			ret	nc
+			ret	nc
+			ld	(bc),a
+			add	a,c
+			adc	a,c
+			cpl
+			ld	a,e
+			ld	(bc),a
+			add	a,35h
+			ld	h,h
+			cp	l
+			ret	m
+			sbc	a,d
+			cp	c
+			ld	(hl),b
+			adc	a,a
+			ld	(4808h),a
+			ex	de,hl
+			exx
+			nop (2x) *
+			ld	hl,90afh
+			cp	a
+			ld	b,a
+			cp	dbh
+			xor	b
+			xor	(hl)
+			ld	bc,753bh
+			djnz	L9a57
+			xor	c
+			xor	e
+			ld	(hl),h
+			ld	b,d
+			sub	h
+			inc	de
+			pop	de
+			ld	l,h
+			ld	c,d
+			ld	(de),a
+			rst	00h
+			ex	de,hl
+			ld	c,(hl)
+			scf
+			ld	h,b
+			inc	a
+			call	m,L8282
+			call	Lf662
+			sbc	a,h
+			jr	L9a29
+			db	7dh,f6h,21h,66h
+			rst	00h
+			sub	81h
+			adc	a,c
+			add	a,b
+			ld	e,e
+			ld	d,b
+			add	a,c
+			cp	a4h
+			ld	a,e
+			ld	c,b
+			ret	pe
+			cp	c
+			and	e
+			cp	b
+			ld	c,a4h
+			sub	b
+			or	a
+			exx
+			ld	b,l
+			add	hl,bc
+			ld	d,c
+			jr	nz,L99dd
+			sub	e
+			rst	10h
+			add	hl,sp
+			add	a,(hl)
+			jp	Lb81a
+			db	aeh,3dh,7eh,2fh,18h,26h,93h,a4h
+			db	03h,9ah,e2h,74h,6dh
+			sbc	a,h
+			ld	c,b
+			inc	de
+			ld	(hl),e
+			sbc	a,49h
+			add	a,h
+			ret
+			db	42h,04h,c2h,61h,84h,30h,cah,83h
+			db	abh,a9h,88h,66h,c9h,49h,cdh,5dh
+			db	dah,38h,adh,0ch,21h,5bh,00h,b0h
+			db	feh,eah,f8h,f1h,06h,94h,71h,02h
+			db	e7h,1eh,74h,1ah,32h,1ch,a5h,d6h
+			db	1eh,c2h,dfh,82h,c6h,74h,39h,b7h
+			db	33h,27h,80h,1bh,e5h,f9h,58h,97h
+			db	43h,87h,b8h,12h,fch,98h,89h,97h
+			db	37h,b2h,0bh,25h,ebh,dch,13h,89h
+			db	58h,02h,c5h,2bh,75h,48h,b2h,50h
+			db	a6h,a4h,aeh,cch,b6h,2ch,4ah,f9h
+			db	49h,c4h,59h,c8h,7dh,85h,15h,23h
+			db	7eh,b7h,c8h,e8h,adh,57h,f8h,c0h
+			db	12h,c6h,c9h,10h
+			add	a,b
+			rra
+			rra
+			ld	b,h
+			di
+			ld	d,h
+			dec	d
+			dec	(hl)
+			adc	a,e
+			ld	e,66h
+			or	l
+			add	a,d
+			ld	b,d
+			sub	b
+			sub	d
+			call	L3b6e
+			nop
+			ret
+			db	f6h,e1h,38h,d6h,1ch,19h,c2h,23h
+			db	bch,cdh,f9h,d9h,0eh,91h,39h,4bh
+			db	0fh,20h,dah,bfh,cch,3eh,0eh,74h
+			db	32h,09h,f5h,77h,f6h,e3h,85h,b4h
+			db	8fh,70h
+			ld	h,l
+			ld	h,h
+			djnz	L9b0f
+			adc	a,h
+			nop (2x) *
+			ex	de,hl
+			pop	de
+			exx
+			adc	a,b
+			ld	(hl),b
+			ld	c,h
+			ld	l,28h
+			add	a,(hl)
+			and	l
+			ld	l,d
+			ld	l,h
+			jp	Leb87
+			ld	e,b6h
+			ld	d,d
+			ld	a,e
+			call	pe,L450e
+			ld	b,c
+			xor	h
+			ret	po
+			cp	2ch
+			im	0
+			add	a,l
+			ld	d,l
+			add	a,a
+			ld	(7d95h),a
+			ld	b,b
+			rst	30h
+			rlca
+			sub	d
+			adc	a,18h
+			ld	(hl),c
+			ld	(hl),l
+			and	l
+			dec	de
+			ld	d,c
+			ld	hl,(e0a3h)
+			sub	c
+			ld	l,h
+			jp	nc,L1387
+			inc	hl
+			ld	e,(hl)
+			ret	p
+			cp	l
+			add	a,l
+			or	d
+			jp	pe,L102e
+			xor	(hl)
+			ld	e,(hl)
+			rst	30h
+			rrca
+			add	a,d
+			pop	af
+			ret	nc
+			ld	hl,1f59h
+			sub	d
+			ld	d,b
+			ret	z
+			or	(hl)
+			ld	h,c
+			ld	d,(hl)
+			or	a
+			adc	a,a
+			nop
+			ccf
+			ld	(hl),d
+			sub	d
+			inc	a
+			call	pe,L6db5
+			djnz	L9b02
+			jp	z,L65ee
+			daa
+			ld	d,h
+			or	d
+			add	a,b
+			nop
+			nop
+			or	b
+			ret	po
+			or	ddh
+			ld	sp,hl
+			rst	00h
+			call	z,L870c
+			ld	hl,c620h
+			ld	l,a
+			ld	(a53ch),a
+			sub	d
+			cp	a
+			ld	e,97h
+			di
+			add	hl,sp
+			daa
+			ld	e,e
+			inc	a
+			jr	L9bd9
+			db	3ah,d7h,f4h,3bh,c5h,38h,87h
+			adc	a,a
+			jp	c,Lc6f6
+			or	d
+			push	af
+			inc	l
+			ld	d,a
+			inc	b
+			inc	b
+			pop	af
+			ld	c,d
+			adc	a,a
+			rla
+			out	(d9h),a
+			ld	d,(hl)
+			xor	b
+			and	a
+			ld	a,c
+			di
+			ld	e,d
+			add	hl,sp
+			push	hl
+			jp	Lb191
+			db	69h,14h,bfh,feh
+			ld	l,h
+			call	nc,L6eeb
+			or	a
+			ld	b,h
+			ccf
+			or	e
+			ld	e,a
+			adc	a,a
+			or	h
+			ld	a,l
+			ld	b,(hl)
+			rst	20h
+			and	l
+			ld	d,d
+			ld	de,6710h
+			dec	hl
+			ld	a,c
+			inc	c
+			sbc	a,d
+			ld	e,c
+			ld	a,(de)
+			jp	po,L366f
+			dec	l
+			xor	c
+			xor	b
+			ld	c,c
+			ld	d,48h
+			or	(hl)
+			pop	hl
+			call	po,Ledfd
+			dec	h
+			add	a,c
+			ld	hl,7bb9h
+			ld	h,38h
+			jr	L9b73
+			db	84h,ech,b3h,c7h,77h,13h,bbh,a6h
+			db	24h,59h,a6h,f4h,93h,29h,16h,d1h
+			db	6fh,9bh,18h,88h,bdh,95h,01h,e3h
+			db	b9h,71h,58h,27h,f6h,3ch,cch,82h
+			db	58h,d5h,b2h,fch,52h,57h,afh,60h
+			db	21h,a5h,55h
+			ld	h,a
+			adc	a,c
+			xor	d
+			add	a,h
+			add	hl,hl
+			jp	pe,L3153
+			inc	c
+			adc	a,e
+			ld	d,a
+			add	a,(hl)
+			add	a,(hl)
+			ld	a,d
+			jp	po,L90bc
+			ld	a,88h
+			ei
+			cp	b
+			nop
+			ld	b,(hl)
+			sub	(hl)
+			ld	l,h
+			jp	z,Laf6e
+			dec	d
+			ld	(hl),8eh
+			dec	c
+			ld	hl,(9ec1h)
+			adc	a,d
+			dec	de
+			ld	e,b
+			ld	e,91h
+			or	b
+			or	(hl)
+			adc	a,e
+			rst	10h
+			sbc	a,b
+			pop	bc
+			ld	d,d
+			add	hl,bc
+			dec	h
+			ld	b,b
+			xor	d
+			inc	a
+			ld	d,e
+			cpl
+			xor	b
+			call	po,L6ba6
+			ld	c,d
+			or	e
+			ld	b,a
+			jp	c,Lc002
+			or	h
+			or	h
+			ret	p
+			add	a,h
+			jp	nz,L1b22
+			ld	de,3dd1h
+			sbc	a,l
+			rr	l
+			ret	nc
+			push	bc
+			ld	e,l
+			inc	c
+			ld	d,h
+			ld	h,h
+			sbc	a,b
+			or	b
+			add	a,h
+			add	a,b
+			adc	a,2ah
+			inc	c
+			and	(hl)
+			ld	a,d
+			di
+			ld	a,c
+			ld	(hl),d
+			ld	(de),a
+			cp	h
+			adc	a,a
+			ld	d,a
+			ret	m
+			ld	a,(85dah)
+			call	po,Lf672
+			xor	a
+			ld	b,h
+			cp	(hl)
+			xor	h
+			ld	hl,6d40h
+			ld	l,a1h
+			ld	c,l
+			cp	l
+			xor	(hl)
+			add	a,l
+			adc	a,l
+			ld	a,(hl)
+			ld	(hl),ech
+			jp	nz,La3d1
+			sbc	a,d
+			add	hl,sp
+			dec	b
+			add	a,l
+			ld	a,b
+			jp	p,Lcddc
+			ld	e,(hl)
+			cpl
+			and	h
+			inc	e
+			sub	l
+			ret	z
+			ld	a,c
+			cp	h
+			ld	(hl),2bh
+			ld	(hl),h
+			ld	l,a
+			ld	d,l
+			xor	a
+			ld	e,d4h
+			daa
+			or	72h
+			jp	m,L8a8c
+			nop (2x) *
+			nop
+			sbc	a,d
+			ld	e,d
+			sbc	a,6eh
+			ld	de,593bh
+			ld	l,c
+			cp	h
+			halt
+			sbc	a,b
+			ld	(hl),b
+			rrc	e
+			adc	a,e
+			xor	h
+			sub	c
+			add	a,h
+			ld	a,e
+			ld	d,c
+			add	hl,hl
+			in	a,(bfh)
+			call	p,Lbfa8
+			adc	a,d
+			ld	b,e
+			dec	h
+			cp	d
+			rst	10h
+			inc	b
+			ld	c,c
+			ld	(bc),a
+			ld	a,e
+			pop	af
+			and	h
+			ld	a,e
+			ld	e,a
+			or	beh
+			call	m,Lbd76
+			jp	z,Lb552
+			pop	hl
+			ld	l,(hl)
+			sbc	a,a
+			in	a,(ceh)
+			adc	a,26h
+			ld	hl,(963ah)
+			sub	d
+			dec	(hl)
+			add	a,d
+			rst	08h
+			push	hl
+			and	h
+			ld	d,l
+			ld	c,d
+			jr	nc,L9d06
+			ld	h,b
+			rst	30h
+			cp	(hl)
+			adc	a,h
+			add	a,e
+			call	z,L0c31
+			and	d
+			ret	c
+			ret	nc
+			ld	d,l
+			ld	b,e0h
+			ld	h,d
+			pop	bc
+			ret	pe
+			ld	(de),a
+			dec	de
+			ld	l,e
+			ld	l,e
+			xor	c
+			or	cdh
+			jp	nc,L64d1
+			or	h
+			ld	l,e
+			ld	l,l
+			ld	e,e
+			ld	h,h
+			sub	a
+			call	nz,L9ec2
+			call	pe,L337a
+			cp	l
+			sub	(hl)
+			dec	b
+			dec	h
+			ld	b,h
+			ld	c,a
+			ld	d,(hl)
+			dec	e
+			cp	c
+			ret	p
+			ld	(1d4fh),a
+			cp	b2h
+			ld	b,(hl)
+			xor	l
+			ex	(sp),hl
+			ld	c,12h
+			add	a,e
+			jp	c,L4186
+			ld	d,30h
+			dec	l
+			ld	h,b
+			ld	l,l
+			rst	30h
+			or	l
+			ld	a,h
+			call	po,L5b10
+			ld	b,d
+			dec	hl
+			add	hl,de
+			call	m,Lf08a
+			ld	e,l
+			sub	d
+			rst	20h
+			rst	20h
+			sub	b
+			rlca
+			jp	c,L239b
+			ld	l,b
+			ld	e,e
+			ld	a,(de)
+			ld	e,3bh
+			or	e
+			add	a,d
+			sub	a
+			ld	a,(hl)
+			adc	a,h
+			dec	h
+			sbc	a,6ah
+			adc	a,c
+			sbc	a,c
+			ld	b,8ch
+			or	b
+			ld	(ce75h),hl
+			call	p,La83f
+			ld	(hl),e
+			ld	l,a
+			or	d
+			jp	nc,Ldd39
+			pop	bc
+			ld	h,b
+			rrca
+			add	hl,bc
+			ld	c,a
+			ld	a,d
+			ld	c,(hl)
+			or	a
+			ld	(48afh),hl
+			call	nc,L6efb
+			ld	c,e
+			and	h
+			nop (2x) *
+			jr	c,L9cfa
+			ld	h,d
+			ld	(hl),a
+			ld	b,d
+			dec	b
+			cp	c
+			sub	(hl)
+			sub	11h
+			ld	d,h
+			ld	(hl),71h
+			jr	L9dd9
+			db	19h,c3h,75h,ceh,f8h,1dh,f1h,94h
+			db	41h,73h,37h,6dh,1ch,63h,e9h,46h
+			db	47h,73h,60h,f0h,56h,27h,88h,aeh
+			db	0bh,56h,ffh,c2h,70h,5bh,85h,0dh
+			db	c1h,36h,97h,73h,0fh,b9h,1fh,f4h
+			db	01h,9bh,26h,0ch,fdh,a4h,fah,45h
+			db	e0h,ebh,45h,5ch,bah,86h,e7h,8dh
+			db	c7h
+			jr	c,L9dcc
+			ld	d,e
+			ld	b,b
+			ld	(de),a
+			rrca
+			inc	a
+			ld	(hl),94h
+			adc	a,(hl)
+			cpl
+			rst	38h
+			or	l
+			pop	de
+			rst	38h
+			ld	e,e
+			jp	nc,Lbad9
+			in	a,(3bh)
+			jp	nc,L3382
+			call	p,L0979
+			sub	(hl)
+			sub	d
+			inc	c
+			ld	b,d
+			inc	c
+			xor	(hl)
+			call	L69df
+			push	bc
+			add	a,a
+			ld	(hl),l
+			jp	m,Lf1e9
+			ld	l,d
+			sbc	a,a
+			call	z,L2492
+			ld	l,e
+			ccf
+			sub	a
+			add	a,(hl)
+			rra
+			inc	l
+			cp	e
+			ld	e,a
+			jp	nz,Lc500
+			or	e0h
+			nop (2x) *
+			jp	p,L77b8
+			adc	a,h
+			jp	nz,Lacd4
+			ld	b,l
+			ld	a,(bc)
+			or	c
+			ld	c,e
+			call	nz,L93c0
+			jr	c,L9dc4
+			xor	a
+			dec	sp
+			ld	(hl),2fh
+			adc	a,0bh
+			ld	e,d
+			rst	10h
+			ld	c,l
+			ld	d,d
+			inc	d
+			inc	h
+			sbc	a,e
+			nop (2x) *
+			cp	h
+			xor	h
+			jr	nz,L9dfa
+			and	h
+			call	nz,L8a00
+			pop	de
+			sbc	a,d
+			ld	c,c
+			ld	c,(hl)
+			djnz	L9dbb
+			xor	b6h
+			res	7,d
+			sub	(hl)
+			ld	b,h
+			ld	a,e
+			dec	a
+			ld	d,a
+			or	(hl)
+			add	hl,bc
+			ld	a,a
+			xor	e
+			ld	l,(hl)
+			ld	a,e
+			xor	d
+			rrc	e
+			adc	a,b
+			and	0bh
+			ld	a,(89ffh)
+			cp	h
+			ld	d,d
+			jp	c,L89d4
+			adc	a,(hl)
+			exx
+			ld	a,b
+			ld	e,l
+			cp	d
+			dec	e
+			add	a,l
+			ld	e,e
+			or	l
+			ld	l,d
+			xor	b
+			pop	hl
+			ld	h,e
+			call	p,Lc9f7
+			ld	a,l
+			rla
+			sub	b
+			ld	l,d
+			rst	18h
+			ld	b,27h
+			add	a,(hl)
+			ld	a,c2h
+			add	a,e
+			adc	a,a
+			cp	(hl)
+			ld	a,(a8f6h)
+			jp	nc,Ld836
+			ld	d,c
+			call	m,Lba3a
+			ld	b,d
+			and	h
+			ld	h,d
+			ld	(hl),c
+			dec	h
+			and	c
+			ld	(hl),e
+			ld	h,c4h
+			ld	b,h
+			rst	20h
+			ld	a,c
+			ld	d,e8h
+			cp	59h
+			call	pe,L388c
+			ret	c
+			cpl
+			ld	c,a
+			ret	m
+			and	b
+			ex	de,hl
+			call	L0227
+			inc	d
+			dec	bc
+			ld	c,e
+			rst	10h
+			cp	c
+			out	(c6h),a
+			ld	d,(hl)
+			ld	l,e
+			call	z,L3c7f
+			sub	(hl)
+			ld	a,d
+			dec	bc
+			ld	c,a
+			dec	a
+			ld	(hl),c
+			add	a,h
+			sub	(hl)
+			dec	h
+			sub	b
+			inc	l
+			call	c,L48d9
+			jp	m,La6df
+			ld	(hl),d6h
+			ld	e,b
+			inc	de
+			ld	h,(hl)
+			ld	(hl),h
+			rst	20h
+			inc	d
+			add	a,e
+			jp	(hl)
+			db	53h,4bh,2bh,a1h,19h,3bh,3dh,1fh
+			db	32h,d5h,8bh,a7h,19h,b5h,a8h,e2h
+			db	80h,f7h,5ch,11h,90h,0eh
+			ld	l,h
+			jr	L9e6a
+			db	d8h,f3h,7dh,adh,19h,3fh,adh,afh
+			db	30h,37h,c3h,b0h,10h,72h,e2h,c9h
+			db	ddh,59h,4bh,9ch,c7h,79h,56h,cch
+			db	38h,25h,bah,09h,00h,beh,cbh,7fh
+			db	77h,e2h,fbh,1fh,1dh,f2h,4eh,86h
+			db	3bh,1dh,0bh,32h,88h,28h
+			push	bc
+			xor	(hl)
+			jr	z,L9f6f
+			sub	e
+			ld	l,h
+			dec	(hl)
+			ld	h,d
+			jp	(hl)
+			db	36h,8bh,27h,f4h,e7h,9dh,c6h,6ch
+			db	5bh,f4h,05h,d5h,0fh,cah,f1h,c1h
+			db	f5h,afh,c4h,e6h,6ah,adh,68h,03h
+			db	2dh,8ah,fah,dfh,c5h,60h,04h
+			add	a,l
+			ld	b,c
+			sbc	a,d
+			cp	(hl)
+			ld	h,c
+			sub	e
+			ret	z
+			in	a,(80h)
+			sbc	a,c
+			ld	b,(hl)
+			nop
+			ld	h,(hl)
+			ld	l,0bh
+			ld	a,(de)
+			pop	hl
+			ld	(hl),2eh
+			inc	h
+			ld	(hl),a2h
+			cp	e
+			sbc	a,(hl)
+			dec	d
+			xor	l
+			ld	(hl),a
+			nop (2x) *
+			and	a
+			pop	af
+			ld	c,c
+			and	a
+			and	e
+			nop (2x) *
+			xor	a0h
+			ld	e,(hl)
+			jr	L9fa6
+			db	96h,aah,f1h,20h,dbh,6dh,2fh,51h
+			db	28h,e7h,6ch,68h,6dh,b1h,c5h,a6h
+			db	64h,37h,15h,66h,4fh,69h,7eh,24h
+			db	6eh,c8h,b0h,07h,87h,ach,65h,33h
+			db	9eh,62h,9eh
+			ex	(sp),hl
+			inc	de
+			ld	d,c
+			ret	z
+			ld	d,l
+			ld	d,c
+			and	b
+			ld	c,h
+			sbc	a,b
+			ccf
+			ex	(sp),hl
+			ld	l,a
+			dec	b
+			or	e
+			ld	l,e
+			inc	de
+			ld	(hl),86h
+			call	nz,L3c7b
+			ex	(sp),hl
+			rst	10h
+			add	a,e
+			ld	c,d
+			ld	(hl),f7h
+			ret	po
+			ld	d,h
+			ret
+			db	8ah,08h,95h,feh,c6h,8ch,4bh
+			rst	10h
+			add	a,c
+			ld	a,(de)
+			ld	(hl),b
+			ld	a,a
+			adc	a,(hl)
+			ld	(bc),a
+			dec	e
+			ld	l,l
+			sbc	a,h
+			adc	a,e
+			and	l
+			ld	(hl),l
+			ld	b,d
+			dec	(hl)
+			jr	z,L9f26
+			daa
+			or	(hl)
+			ld	(e54ch),hl
+			ld	b,a
+			ld	l,dbh
+			ld	c,d
+			djnz	L9f8c
+			dec	sp
+			add	a,h
+			sbc	a,d
+			and	(hl)
+			call	L98d3
+			inc	de
+			rla
+			ret	pe
+			call	c,Laee6
+			ld	e,a9h
+			ld	bc,1dcbh
+			adc	a,l
+			daa
+			ld	(de),a
+			di
+			cp	d
+			ex	af,af'
+			ld	(hl),80h
+			adc	a,b
+			djnz	L9f67
+			ld	e,b
+			sub	l
+			push	bc
+			call	nc,L728c
+			ei
+			ld	a,b
+			jr	c,La014
+			sub	a
+			adc	a,97h
+			ld	(hl),d
+			cp	b
+			ld	c,c
+			sub	e
+			pop	hl
+			ld	b,l
+			xor	l
+			xor	d
+			ld	h,d
+			or	h
+			cpl
+			sub	d
+			and	l
+			jp	(hl)
+			db	43h,bfh,06h,57h,f0h,1eh,7dh,29h
+			db	fah,cfh,9dh,32h,95h,bbh,79h,92h
+			db	32h,39h,0bh,82h,5bh,2eh,78h,4ch
+			db	a1h,beh,e4h,3bh,2ch,53h,aah,10h
+			db	3bh,9ch,9eh,53h,1ch,b2h,fbh,a6h
+			db	abh,42h,dfh,44h,97h,13h,fbh,0ah
+			sub	a
+			jp	nc,Lc51b
+			jp	z,L6db3
+			xor	h
+			jr	nc,La070
+			jr	nc,L9fb0
+			inc	h
+			inc	l
+			ld	(hl),81h
+			ld	c,a
+			add	hl,de
+			ld	c,b
+			adc	a,c
+			ld	e,l
+			ld	(0143h),a
+			ld	l,94h
+			dec	h
+			inc	bc
+			and	d
+			ld	e,h
+			sbc	a,d
+			xor	e
+			and	(hl)
+			call	z,L5cd1
+			ex	(sp),hl
+			or	77h
+			ret	po
+			halt
+			ei
+			ld	b,b
+			add	a,h
+			xor	2eh
+			jr	nc,La010
+			sub	e
+			cp	c
+			ld	d,h
+			or	a
+			adc	a,b2h
+			ld	e,a
+			jp	pe,L37f4
+			sbc	a,d
+			call	p,L2c3e
+			jp	m,L6bfd
+			xor	c
+			ld	l,h
+			or	87h
+			pop	hl
+			cp	e
+			add	a,(hl)
+			sub	c
+			pop	af
+			sbc	a,h
+			ld	(La964),hl
+			push	af
+			daa
+			ld	a,l
+			ld	a,l
+			cp	(hl)
+			cpl
+			cp	(hl)
+			ld	d,(hl)
+			or	e
+			push	bc
+			inc	c
+			jp	po,L9005
+			ld	a,h
+			add	a,d
+			sbc	a,39h
+			ld	a,(40dfh)
+			scf
+			ld	(hl),c
+			ld	(hl),c
+			dec	e
+			jr	nc,La025
+			ld	(hl),c3h
+			call	nc,Lb45b
+			sbc	a,a
+			ld	d,d
+			push	af
+			dec	bc
+			rst	18h
+			ld	d,b
+			rrca
+			ld	(hl),h
+			ld	d,c
+			exx
+			xor	d
+			ld	c,bch
+			inc	e
+			ld	c,l
+			ret	z
+			jp	nz,L6bf9
+			call	nc,L5016
+			adc	a,b
+			call	po,L504c
+			adc	a,c
+			and	l
+			ld	d,a
+			pop	af
+			call	m,Lf71f
+			sbc	a,(hl)
+			ld	(hl),b
+			or	ffh
+			call	nc,Lea79
+			djnz	La101
+			dec	l
+			adc	a,e
+			call	c,La806
+			or	(hl)
+			ld	e,c
+			ld	e,h
+			nop (2x) *
+			call	po,L93eb
+			inc	e
+			ccf
+			or	l
+			adc	a,l
+			ld	b,c
+			ld	b,d
+			add	a,(hl)
+			ld	e,a
+			ld	b,c
+			rra
+			push	hl
+			jr	nz,La0c1
+			ld	l,a
+			or	l
+			ld	h,74h
+			rst	08h
+			ld	e,(hl)
+			inc	d
+			sub	e
+			add	a,d
+			adc	a,l
+			inc	d
+			ld	e,h
+			adc	a,d
+			and	b
+			ld	a,(bc)
+			dec	a
+			ld	e,c
+			or	h
+			adc	a,h
+			ld	h,c
+			ld	bc,5929h
+			cp	d
+			ld	h,b
+			push	iy
+			ld	a,(bc)
+			ld	(hl),b
+			call	po,L56e6
+			cp	h
+			jr	nc,La0e7
+			ld	b,c
+			jr	nz,La0b9
+			jp	po,Lf1fb
+			call	pe,La2c8
+			sub	b
+			jr	nc,La0b7
+			ld	c,c
+			ld	h,98h
+			and	h
+			ld	l,e
+			inc	l
+			sbc	a,c
+			inc	sp
+			ld	b,c
+			ld	(b954h),a
+			sub	c
+			cp	l
+			rrca
+			sub	c
+			ld	d,d
+			ld	d,d
+			ld	h,(hl)
+			ld	(62b7h),hl
+			dec	d
+			daa
+			dec	h
+			adc	a,l
+			add	a,l
+			call	po,L86ba
+			ld	e,(hl)
+			call	nc,L6234
+			rst	08h
+			sub	l
+			and	c
+			xor	ebh
+			im	0
+			inc	bc
+			ld	a,e
+			dec	d
+			ld	a,b
+			ld	b,(hl)
+			ld	c,h
+			cp	c1h
+			ld	l,(hl)
+			ld	e,a
+			ld	e,e
+			call	L7333
+			ld	h,a
+			add	a,l
+			ld	c,c
+			xor	d
+			cp	d6h
+			rrca
+			ld	a,a
+			ld	hl,5202h
+			call	p,L46d9
+			add	a,e
+			ret	c
+			xor	l
+			sub	e
+			add	a,c
+			ld	b,b
+			jr	c,La14f
+			ld	(hl),76h
+			ld	h,(hl)
+			ld	l,c
+			xor	d
+			jr	z,La193
+			ex	de,hl
+			sbc	a,(hl)
+			push	de
+			ld	a,h
+			cp	(hl)
+			ld	c,e9h
+			rlca
+			ld	l,d
+			cp	e7h
+			cp	b
+			ld	a,(bc)
+			ld	bc,4987h
+			jp	po,L3144
+			ld	l,l
+			cp	h
+			inc	c
+			call	nc,Lb31e
+			rst	08h
+			ld	b,c
+			rst	10h
+			cp	d
+			dec	l
+			rrca
+			sbc	a,(hl)
+			adc	a,l
+			add	a,l
+			ld	e,87h
+			call	pe,L1485
+			ld	l,a
+			ld	b,e
+			dec	e
+			pop	de
+			dec	de
+			ld	hl,(fa41h)
+			adc	a,(hl)
+			xor	c
+			cp	l
+			ret	z
+			ld	b,(hl)
+			scf
+			rst	30h
+			ld	(hl),l
+			cp	a
+			adc	a,b
+			ld	d,h
+			pop	af
+			rrca
+			ld	c,d
+			ld	(hl),h
+			jp	po,La6f6
+			call	nz,La960
+			di
+			ld	(hl),d
+			ld	e,d
+			ld	(hl),c
+			exx
+			and	c
+			xor	a
+			and	b
+			sbc	a,e
+			xor	l
+			add	a,l
+			adc	a,9ch
+			adc	a,c
+			ld	l,d
+			rst	28h
+			add	a,d
+			rst	10h
+			ld	l,0ah
+			halt
+			cp	h
+			ld	b,c
+			ld	h,l
+			ld	h,h
+			jp	pe,L6548
+			ld	e,e
+			adc	a,(hl)
+			sbc	a,b
+			call	c,Lee6e
+			sbc	a,d
+			dec	hl
+			rst	08h
+			rla
+			add	hl,de
+			ld	d,h
+			ld	a,e
+			ld	e,e
+			ld	e,(hl)
+			call	m,Laabc
+			dec	sp
+			jp	p,Lb630
+			ld	a,a
+			ld	e,l
+			and	(hl)
+			ei
+			ld	e,e
+			out	(72h),a
+			sbc	a,(hl)
+			inc	l
+			rst	38h
+			rla
+			call	m,L9bae
+			inc	l
+			ld	e,(hl)
+			rlca
+			ld	(hl),c
+			out	(82h),a
+			add	a,(hl)
+			ld	(cb71h),a
+			ld	(hl),a
+			cp	b
+			ld	h,a
+			inc	hl
+			or	cbh
+			ld	b,a
+			sub	b
+			jr	c,La1d4
+			add	a,(hl)
+			rrca
+			ret	m
+			sub	92h
+			and	d
+			rst	30h
+			ld	(hl),d
+			dec	bc
+			call	c,L74bd
+			adc	a,h
+			ld	b,(hl)
+			ccf
+			inc	d
+			daa
+			sub	(hl)
+			inc	c
+			ld	(de),a
+			rst	08h
+			cp	d
+			ret	nc
+			add	hl,de
+			push	bc
+			ld	a,(bc)
+			jp	po,Lf495
+			and	c
+			and	b
+			dec	b
+			ld	h,b
+			scf
+			add	a,c
+			dec	e
+			cp	h
+			or	l
+			ld	(hl),e
+			adc	a,a
+			cp	d
+			and	l
+			ret	c
+			cp	a
+			ld	a,cch
+			push	de
+			call	nz,L3435
+			or	d1h
+			jr	nc,La28e
+			inc	de
+			dec	c
+			ld	(bc),a
+			ret	pe
+			ld	d,l
+			ld	b,b
+			ld	b,(hl)
+			ld	d,c
+			ld	e,(hl)
+			inc	bc
+			ld	de,a84ah
+			jp	Lc4ff
+			db	33h,6ch,5ch,75h,0dh,53h,9eh,82h
+			db	bah,87h,70h,46h,7dh,71h,17h,feh
+			ld	h,e
+			and	l
+			ld	c,h
+			ret	pe
+			ld	h,b
+			jp	po,Lea73
+			inc	h
+			add	a,e
+			ld	sp,2ff5h
+			add	a,a
+			rla
+			add	a,b
+			ld	e,e3h
+			cp	b
+			inc	a
+			ld	hl,3c9eh
+			jp	Lce11
+			db	21h,ddh,34h,f4h,89h,51h,a2h,93h
+			db	b9h,6ch,3dh,09h
+			xor	c
+			rst	10h
+			inc	b
+			ld	b,e
+			inc	h
+			ld	b,97h
+			add	a,h
+			dec	e
+			xor	a
+			ld	a,b
+			add	a,d
+			jr	La1fe
+			db	e9h,b1h,e1h,62h,c7h
+			ld	sp,hl
+			rra
+			pop	af
+			ld	l,(hl)
+			ld	b,b
+			add	a,l
+			ld	a,b
+			inc	bc
+			rst	18h
+			ld	d,c
+			rst	20h
+			ld	(hl),b
+			and	h
+			xor	(hl)
+			xor	(hl)
+			call	Le644
+			jp	po,L0320
+			xor	a
+			add	hl,bc
+			sbc	a,d
+			ld	b,a
+			sub	e
+			adc	a,c3h
+			rrca
+			ret	p
+			ld	d,l
+			dec	d
+			inc	sp
+			xor	h
+			sbc	a,c
+			jp	m,L3ccc
+			ret	nc
+			xor	d
+			ld	e,b
+			ld	(hl),ebh
+			inc	d
+			ld	c,l
+			ld	b,c
+			ld	b,h
+			ld	sp,hl
+			adc	a,1fh
+			ld	de,8a67h
+			nop (2x) *
+			call	pe,Ldc17
+			xor	a
+			push	de
+			and	c5h
+			sub	a
+			dec	(hl)
+			sub	a
+			sub	d1h
+			ld	sp,8800h
+			jp	(hl)
+			db	cah,4bh,b4h,75h,a7h,cah,72h,31h
+			db	1eh,f2h,78h,a2h,6eh,d1h,26h,61h
+			db	85h,ech,fch,74h,f6h,deh
+			or	a
+			ld	l,(hl)
+			add	hl,hl
+			ld	d,ddh
+			ld	c,b
+			call	c,L244c
+			cp	c
+			srl	e
+			add	a,c
+			rst	28h
+			ld	d,b
+			sbc	a,a
+			inc	l
+			nop
+			ld	c,h
+			ld	h,d
+			sbc	a,l
+			ccf
+			call	nc,L13c5
+			and	h
+			ld	e,h
+			nop (2x) *
+			jp	m,L2523
+			adc	a,d
+			or	l
+			xor	e
+			dec	b
+			jr	c,La333
+			sbc	a,e
+			and	(hl)
+			xor	45h
+			adc	a,c
+			cp	c
+			ld	l,e
+			inc	sp
+			ld	a,(bc)
+			ld	(hl),a
+			and	h
+			sub	h
+			jp	c,L3a73
+			jp	(hl)
+			db	f3h,36h,ebh,dah,15h,7ch,93h,d5h
+			db	c2h,8ch,bah
+			ld	l,d
+			sub	d
+			ld	b,a
+			ret	nz
+			add	a,b
+			dec	c
+			ld	l,c
+			halt
+			add	hl,hl
+			inc	hl
+			xor	(hl)
+			or	d
+			dec	a
+			call	pe,Lcfd2
+			ld	d,d4h
+			jr	La308
+			db	7bh,f3h,aeh,54h,54h,a8h,5ah,69h
+			db	8fh,c5h,9dh,adh,05h,5bh,fdh,02h
+			db	feh,51h,cdh,43h,bdh,0dh,92h
+			adc	a,b
+			exx
+			ld	d,l
+			pop	af
+			or	(hl)
+			dec	a
+			halt
+			rlca
+			and	d
+			jp	L38bb
+			db	9eh,1bh,dfh,78h,d4h,cbh,deh,48h
+			db	0eh,67h,31h,7ch,a1h,14h,6eh,f0h
+			db	9ch,fbh,cah,f9h,37h,f7h,48h,1fh
+			dec	d
+			ld	d,c
+			nop (2x) *
+			add	a,92h
+			ld	e,a
+			ld	h,(hl)
+			rst	18h
+			exx
+			ld	e,a6h
+			jr	nc,La35d
+			ld	d,l
+			ld	d,b
+			jp	pe,L1cef
+			rst	10h
+			ld	a,l
+			dec	h
+			adc	a,c
+			ld	a,h
+			call	c,L45bb
+			adc	a,h
+			ld	l,l
+			ld	sp,1b01h
+			or	h
+			dec	c
+			ex	(sp),hl
+			ld	b,h
+			cp	l
+			ret	nc
+			ld	d,(hl)
+			ld	b,b
+			ld	a,d
+			ret	nz
+			inc	b
+			sub	c
+			rlca
+			rst	00h
+			add	hl,hl
+			dec	d
+			sub	c
+			ld	hl,d62eh
+			and	a
+			inc	(hl)
+			ld	l,h
+			ld	c,h
+			ex	de,hl
+			ld	a,c
+			dec	hl
+			add	a,c
+			inc	l
+			and	d
+			ld	d,d
+			dec	a
+			sbc	a,c
+			cp	l
+			xor	h
+			pop	de
+			ld	(2782h),a
+			ld	(hl),b
+			ex	af,af'
+			pop	bc
+			inc	a
+			dec	h
+			xor	53h
+			adc	a,c
+			dec	a
+			jp	z,L1205
+			add	a,96h
+			adc	a,h
+			ld	a,(hl)
+			ld	c,5ch
+			cp	h
+			jp	nc,L6167
+			ld	c,b
+			ex	(sp),hl
+			ld	l,a
+			xor	(hl)
+			xor	(hl)
+			call	nc,L0d14
+			call	m,L45f5
+			ld	a,02h
+			ld	h,69h
+			ld	l,d
+			cp	c
+			sbc	a,b
+			ld	d,h
+			add	a,e
+			add	a,(hl)
+			out	(92h),a
+			rst	10h
+			ld	d,l
+			and	l
+			xor	h
+			jp	nc,L0147
+			inc	h
+			ld	h,d
+			ld	e,e
+			ret
+			db	e4h,70h,beh,f1h,edh,59h,beh,90h
+			db	0ah,a7h,fdh,7fh,14h,68h,beh,fah
+			db	f9h,54h,f1h,b4h,6dh,95h,26h,b4h
+			db	2eh,dch,7eh,bfh,08h,61h,10h
+			ld	d,d
+			jp	m,L2169
+			ld	h,c
+			ld	hl,e829h
+			jp	L4da7
+			db	3ch,e9h,8eh,8dh,34h,75h,abh,27h
+			db	fch,3ch,4fh,0ch,44h,07h,9dh,64h
+			db	39h,4bh,47h,30h,b7h,97h,36h,65h
+			db	07h,c7h,a1h,63h,d7h,5dh,6fh,b7h
+			db	48h,a2h,dah,53h,a1h,5bh,24h,11h
+			db	bch,10h,46h,15h,4eh,9bh,9bh,b2h
+			db	83h,41h,5dh,53h,87h,2eh,dch,d5h
+			db	72h,12h,a0h,fbh,d1h,a4h,1eh,c5h
+			db	a3h,7eh,87h,65h,5dh,3fh,d1h,9ch
+			db	edh,55h,0fh,a6h,d6h,6ah,28h,a9h
+			db	6ch,1ah,40h,a1h,c3h,f6h,6bh,b0h
+			db	bah,4dh,4bh,60h,3ah,87h,90h,2ch
+			db	b8h,0ch,87h,3fh,cfh,d0h
+			rst	18h
+			halt
+			xor	l
+			ret	po
+			ld	e,b
+			or	c
+			ld	c,l
+			ret	p
+			sub	a
+			pop	af
+			ld	l,36h
+			add	a,b
+			ld	e,a
+			cp	(hl)
+			ld	a,(hl)
+			ld	a,(hl)
+			ld	sp,hl
+			sub	h
+			ld	(hl),h
+			add	a,l
+			adc	a,l
+			sub	c
+			djnz	La4cf
+			inc	h
+			ret	nz
+			sbc	a,c
+			jp	p,L994f
+			or	b
+			ret	z
+			ld	sp,8501h
+			add	a,c
+			sub	l
+			call	nc,L7959
+			dec	b
+			ld	(hl),a
+			ld	l,b
+			ld	e,50h
+			ld	b,a3h
+			add	a,51h
+			xor	l
+			ld	d,h
+			sbc	a,e
+			ld	de,0012h
+			adc	a,(hl)
+			ld	e,(hl)
+			set	7,h
+			inc	sp
+			in	a,(6eh)
+			ld	a,(de)
+			sub	e
+			ld	(hl),c
+			or	(hl)
+			sbc	a,25h
+			ld	c,b
+			xor	h
+			ld	(hl),e
+			ld	e,(hl)
+			ld	hl,(5568h)
+			dec	de
+			sub	h
+			in	a,(e6h)
+			or	c
+			ld	d,31h
+			rlca
+			ld	c,e
+			cp	e
+			adc	a,c
+			rst	28h
+			ld	c,24h
+			ld	b,e
+			pop	de
+			call	c,Le403
+			call	nc,Lf12e
+			rra
+			ld	h,(hl)
+			out	(b5h),a
+			ld	h,d
+			xor	6dh
+			adc	a,(hl)
+			rst	10h
+			jp	po,L0d2f
+			ld	bc,735bh
+			dec	c
+			ld	a,c
+			ld	(hl),c
+			ld	h,3fh
+			ld	(hl),e
+			rst	38h
+			nop (2x) *
+			or	c
+			set	0,a
+			jp	(hl)
+			db	3dh,bbh,70h,4eh,c0h,8bh,b3h,ebh
+			db	77h,e6h,1ah,38h,46h,59h,cch,1bh
+			db	9fh,a4h,b5h,f7h,00h,cch,4dh,d6h
+			db	57h,34h,64h,90h,ddh,63h,68h,89h
+			db	d7h,8ah,afh,ceh,30h,fdh,55h,7bh
+			db	efh,80h,73h,fah,65h,b4h
+			or	l
+			adc	a,69h
+			add	a,b7h
+			jp	(hl)
+			db	d9h,b6h,37h,c2h,bah,a3h,e4h,8bh
+			db	d5h,5fh,6ch,12h,63h,65h,c3h,d3h
+			db	c8h,79h,50h,e6h,7fh,a0h,e9h,b1h
+			db	77h,c3h,34h,51h,84h,17h,f7h,c7h
+			db	b7h,8eh,e9h,11h,3dh,b6h,6fh,90h
+			db	fbh,15h,05h,a1h,8eh,e7h,fah,76h
+			db	b2h,0ch,10h,bfh,34h,08h,0fh,84h
+			db	ceh,47h,85h,f9h,02h,d8h,eah,afh
+			db	8dh,81h,a0h,02h,f4h,4ah,c0h,40h
+			db	5bh,82h
+			ld	d,l
+			call	m,L81ff
+			ld	a,e
+			ld	e,e
+			adc	a,(hl)
+			ld	de,013dh
+			or	h
+			add	a,a
+			jp	nc,Led9a
+			ld	d,a
+			add	a,c
+			ld	e,c
+			nop
+			ld	h,b
+			ld	(hl),d
+			xor	b
+			rst	28h
+			sub	c
+			ld	e,l
+			cpl
+			ld	d,b
+			or	d
+			ld	d,a
+			dec	c
+			ld	l,b
+			dec	b
+			jp	nz,L86b7
+			xor	c
+			ld	l,c
+			ld	c,e
+			inc	d
+			or	96h
+			ld	l,l
+			call	c,L729d
+			ld	b,d
+			dec	l
+			ld	e,(hl)
+			inc	a
+			dec	a
+			sbc	a,l
+			and	l
+			ld	d,92h
+			ld	h,b
+			ld	d,7dh
+			cp	a
+			jr	La613
+			db	7eh,b7h,2fh,f0h,01h,a3h,b6h,6ah
+			db	6eh,68h,58h,c0h,6eh,76h,23h,3ah
+			db	8eh,f1h,8dh,72h,39h,58h,e3h,8ch
+			db	25h,b0h,06h,a7h,89h,1fh,43h,b9h
+			db	c2h,28h,13h,cch,3dh,46h,a6h,07h
+			db	f4h,abh,1fh,8ah,06h,79h,e6h,e1h
+			db	cbh,ffh,9bh,79h,06h,deh,37h,59h
+			db	e8h,29h,27h,56h,c6h,72h,64h,0fh
+			db	75h,83h,bbh,f1h,9ch,4bh,66h,b1h
+			db	28h,84h,88h,98h,2eh,3ch,3fh,8ah
+			db	55h,5dh,76h,b8h,fch,23h,27h,feh
+			db	84h,9ch,f6h,cbh,11h,5ah,c5h,46h
+			db	6dh,ceh,0eh,3eh,fbh,93h,ach,b5h
+			db	f1h,76h,18h,edh,a9h,23h,b7h,deh
+			db	98h,2bh,67h,4eh,beh,edh,5eh
+			dec	b
+			adc	a,d
+			adc	a,d
+			ld	(29eah),hl
+			cp	96h
+			and	a
+			ld	(hl),l
+			ld	l,d
+			ld	d,e
+			and	e
+			xor	d
+			set	7,l
+			inc	(hl)
+			ld	hl,(8bffh)
+			inc	c
+			xor	e
+			inc	sp
+			ld	(29cch),a
+			inc	h
+			rst	28h
+			jp	p,L8c8b
+			ld	b,c
+			add	a,l
+			xor	d0h
+			dec	hl
+			call	nc,L79fc
+			sub	h
+			dec	d
+			ld	(hl),00h
+			cp	fch
+			dec	bc
+			ld	(hl),b
+			ld	e,0fh
+			ld	a,h
+			exx
+			sbc	a,a
+			sub	l
+			ld	e,c
+			sbc	a,d
+			ld	b,a
+			sub	c
+			ret	po
+			inc	(hl)
+			scf
+			ld	d,cdh
+			jp	p,Lb4ab
+			ld	(hl),b
+			ld	e,0ch
+			ld	l,e
+			jp	nz,L9249
+			cp	(hl)
+			ret
+			db	36h,94h,5dh,7ch,20h,d4h,93h,35h
+			db	1eh,dfh,7eh,ffh,e7h,2ah,4eh,27h
+			db	89h,aeh,ebh,cfh,efh,55h,4ah,75h
+			db	a4h,a5h,1ch,6bh,8eh,33h,37h,d2h
+			db	8fh,2ch,73h,77h,8bh,28h,ech,cah
+			db	26h,2fh,abh,5ch,37h,56h,79h,21h
+			db	37h,b9h,11h,6fh,7ch,cdh,3fh,1bh
+			db	c1h,2dh,8ah,7bh,d5h,9bh,9ah,c4h
+			db	a6h,51h,0fh,10h,33h,e4h,81h,8eh
+			db	0ch,6fh,94h,36h,bfh,e8h,fch,52h
+			db	78h,b3h,fbh,00h,7dh,62h,a7h,90h
+			db	3ah,28h,80h,2eh,d0h,7ah,1dh,e2h
+			db	32h,8bh,7eh,2ah,dah,d7h,7ch,cah
+			db	45h,f9h,46h,9fh,81h,90h,03h,04h
+			db	9ah,84h,23h,9bh,b4h,90h,c2h,84h
+			db	9ah,76h,90h,eeh,e8h
+			ret	c
+			sub	1ch
+			call	L2cbf
+			dec	d
+			sub	feh
+			inc	bc
+			ei
+			call	L8bd3
+			djnz	La70e
+			add	a,h
+			ret	m
+			or	c
+			ex	af,af'
+			call	z,Lb6ca
+			ld	sp,hl
+			adc	a,b
+			ei
+			ld	c,l
+			inc	d
+			adc	a,a
+			ld	a,h
+			cp	d
+			and	c
+			ld	l,a
+			and	b
+			jp	pe,L68d4
+			ld	(c57ch),hl
+			ld	e,c1h
+			ld	h,a
+			call	c,Lad7f
+			sbc	a,h
+			ld	e,h
+			cp	c
+			daa
+			add	a,b8h
+			ld	l,e
+			ld	hl,(L7420)
+			or	c
+			sub	(hl)
+			rra
+			add	a,a
+			inc	(hl)
+			ld	b,b
+			inc	a
+			call	c,La7bc
+			or	c
+			nop
+			xor	d
+			add	a,d
+			inc	bc
+			ld	a,b
+			ld	(780dh),hl
+			ld	(hl),b0h
+			and	(hl)
+			xor	c
+			and	22h
+			ld	h,f0h
+			jp	pe,Lb4fa
+			rst	08h
+			ld	(hl),h
+			ld	e,d
+			and	h
+			inc	e
+			ld	h,d
+			and	c
+			sub	a
+			push	af
+			sub	b
+			sbc	a,h
+			ret	nz
+			push	hl
+			ld	d,(hl)
+			ret	p
+			ld	d,l
+			rst	30h
+			sub	cah
+			nop
+			add	a,h
+			add	hl,de
+			rst	20h
+			pop	bc
+			inc	c
+			ld	a,b
+			rst	28h
+			sub	0eh
+			ld	(hl),a
+			add	a,c
+			ld	(hl),h
+			xor	l
+			xor	e
+			inc	sp
+			inc	hl
+			ld	e,h
+			sub	l
+			pop	hl
+			add	a,h
+			adc	a,c
+			ld	b,1fh
+			and	e
+			add	a,e
+			ld	(bc),a
+			pop	hl
+			jr	nc,La6fc
+			sbc	a,l
+			inc	c
+			ld	(2b64h),hl
+			ld	d,l
+			ld	e,a
+			ccf
+			ld	b,e
+			ld	c,8eh
+			rrca
+			ld	c,e
+			ld	bc,9d9fh
+			cp	b
+			rst	10h
+			add	hl,sp
+			add	hl,bc
+			inc	h
+			dec	b
+			sbc	a,e
+			res	7,d
+			ret	m
+			or	b
+			ld	de,55c5h
+			jp	nz,L38d2
+			ld	b,05h
+			ld	e,(hl)
+			xor	l
+			sbc	a,a
+			ld	e,(hl)
+			exx
+			cp	h
+			ld	l,l
+			nop (2x) *
+			djnz	La7ce
+			add	a,l
+			add	hl,bc
+			jp	z,L5c71
+			cp	d
+			ex	de,hl
+			cp	(hl)
+			or	d5h
+			ld	(89f0h),a
+			rla
+			ld	h,a
+			ld	a,e
+			ld	l,b
+			inc	(hl)
+			add	a,a
+			ld	e,h
+			dec	sp
+			rst	30h
+			ld	l,c
+			ret
+			db	12h,b1h,00h,97h,eah,7ah,09h,a9h
+			db	e8h,7dh,08h,72h,e5h,00h,70h,73h
+			db	03h,aeh,81h,2bh,2dh,0dh
+			adc	a,e
+			dec	bc
+			adc	a,b
+			jr	c,La77d
+			ld	c,b
+			adc	a,65h
+			ld	h,83h
+			inc	b
+			ld	b,d
+			ld	d,c
+			rlca
+			ccf
+			ld	a,f0h
+			jr	nc,La79c
+			ld	e,2dh
+			ld	b,cah
+			scf
+			xor	(hl)
+			dec	c
+			cp	c
+			add	a,e
+			cp	(hl)
+			ld	e,h
+			ld	c,b
+			or	c
+			and	b
+			adc	a,d
+			or	ech
+			pop	af
+			sbc	a,e
+			ld	b,d
+			ld	(hl),c
+			ld	(hl),l
+			ex	af,af'
+			rrca
+			inc	e
+			bit	0,a
+			sbc	a,h
+			ld	de,cfdah
+			ld	(hl),l
+			push	hl
+			ld	(bc),a
+			ld	d,e
+			cp	(hl)
+			jp	m,L2bd8
+			or	c
+			dec	h
+			or	c
+			ld	l,(hl)
+			add	a,l
+			xor	(hl)
+			jp	p,L6434
+			ld	a,(de)
+			rst	38h
+			cp	a
+			djnz	La865
+			ld	c,e
+			exx
+			jp	(hl)
+			db	58h,cdh,74h,f5h,4ah,f9h,aah,27h
+			db	20h,adh,9dh,8ch,78h,d5h,7ah,28h
+			db	fch,0ch,c8h,d6h,61h,65h,a0h,4fh
+			db	1bh,ddh,f1h,2ch,a8h,63h,fbh,90h
+			db	38h,32h,c5h,34h,b6h,cah,77h,55h
+			db	68h,d9h,1dh,f3h,0ch,a5h,f8h,cah
+			db	35h,59h
+			sub	c
+			inc	c
+			ld	b,3ah
+			jr	nc,La841
+			cp	l
+			ld	l,b
+			rst	30h
+			inc	a
+			or	d
+			ld	a,a7h
+			xor	l
+			ld	b,l
+			xor	b
+			add	a,f3h
+			add	hl,bc
+			daa
+			ld	l,h
+			or	l
+			push	hl
+			exx
+			add	hl,sp
+			call	po,L1802
+			di
+			or	a
+			call	c,L0c43
+			inc	d
+			rst	28h
+			or	b
+			ld	h,b
+			ld	d,e
+			ei
+			adc	a,d
+			sbc	a,a
+			cp	h
+			inc	(hl)
+			add	hl,sp
+			call	p,Ld5a0
+			push	de
+			call	nz,Lda16
+			or	h
+			call	pe,L3339
+			cp	c
+			sbc	a,l
+			inc	d
+			inc	e
+			ld	e,(hl)
+			out	(6dh),a
+			add	a,d
+			jp	L5a97
+			db	d4h,70h,d0h,9dh,08h,49h,d3h,76h
+			db	cdh,9fh,25h,5bh,cdh,d3h,8ah,b9h
+			db	1ah,87h,e4h,5ah,b4h,96h,48h,93h
+			db	b2h,f8h,71h,f9h,58h,cdh,f7h,62h
+			db	e9h,f2h,62h,75h,b9h,31h,a4h,ebh
+			db	c5h,efh,49h,63h,17h,3ch,0fh,4ah
+			db	83h,e6h,e2h,50h,a2h,a2h,22h,8fh
+			db	e1h,4ch,92h,72h,0bh,f5h,b9h,a4h
+			db	7ch,8ch,c4h,4ah,7fh,29h
+			adc	a,b
+			dec	de
+			ld	c,a
+			ld	d,66h
+			ld	bc,654eh
+			add	hl,sp
+			ld	(hl),l
+			call	m,Lf91e
+			or	h
+			or	h
+			ld	c,h
+			ld	(bc),a
+			ld	(de),a
+			sbc	a,59h
+			ld	e,(hl)
+			sbc	a,d
+			dec	hl
+			add	hl,sp
+			inc	a
+			ld	l,(hl)
+			ld	h,b
+			ld	c,h
+			ld	c,l
+			ld	de,8e5dh
+			add	a,(hl)
+			rst	08h
+			ld	a,(de)
+			or	e
+			call	nz,L4acd
+			adc	a,e
+			ld	(de),a
+			call	p,L23f6
+			adc	a,l
+			ld	l,c
+			and	d
+			ld	e,h
+			adc	a,c
+			sbc	a,d
+			sbc	a,e6h
+			sub	a
+			add	a,a
+			inc	a
+			push	bc
+			or	d
+			adc	a,b
+			sbc	a,c5h
+			and	(hl)
+			cpl
+			sbc	a,d5h
+			and	l
+			ld	a,c
+			ex	(sp),hl
+			adc	a,d
+			ld	(hl),b
+			cp	a
+			call	po,L751a
+			ld	e,d
+			rst	18h
+			sbc	a,e
+			ld	b,b
+			cp	c
+			out	(07h),a
+			ld	b,f7h
+			call	po,L47ea
+			ld	hl,2691h
+			sub	a
+			ld	hl,1b47h
+			jr	nz,La964
+			jp	m,Ladfd
+			jr	nc,La8d4
+			ld	b,h
+			ld	h,l
+			ld	e,l
+			add	a,22h
+			ld	(hl),b
+			ld	d,e
+			call	nc,L0c07
+			sub	(hl)
+			ld	e,e
+			add	a,e
+			dec	bc
+			ld	e,c
+			halt
+			add	a,d
+			sbc	a,c
+			ex	de,hl
+			pop	de
+			ld	l,d
+			djnz	La968
+			ret	m
+			or	b
+			rlca
+			ccf
+			ld	d,fbh
+			sub	h
+			ld	(c053h),hl
+			ld	d,d
+			ex	de,hl
+			sbc	a,h
+			or	a
+			inc	l
+			add	hl,de
+			pop	de
+			dec	c
+			ld	c,d
+			ret
+			db	efh,cfh,b6h,72h,e6h,c7h,4ah,37h
+			db	2ch
+			sbc	a,e
+			ld	(6e30h),a
+			push	de
+			ld	(bc),a
+			ld	(hl),b
+			dec	sp
+			inc	(hl)
+			or	c
+			cp	h
+			nop
+			halt
+			ex	(sp),hl
+			add	a,h
+			add	a,a
+			ld	h,e2h
+			ret	p
+			ld	d,(hl)
+			call	z,L0ba2
+			ld	l,e
+			add	a,d
+			rst	38h
+			sbc	a,03h
+			sub	d
+			sub	e5h
+			ld	b,b
+			sub	e
+			rla
+			xor	b
+			jr	nc,La947
+			or	h
+			add	a,b
+			ccf
+			ld	d,b
+			ret	nz
+			ld	l,d
+			ld	h,c
+			sub	h
+			inc	c
+			sbc	a,d
+			ld	(hl),b
+			inc	de
+			inc	sp
+			sbc	a,e
+			ld	(hl),c
+			ld	e,e
+			rlca
+			ret	pe
+			push	bc
+			ret	nc
+			ex	de,hl
+			sub	29h
+			inc	l
+			ld	a,(de)
+			rst	20h
+			sbc	a,d
+			call	z,Ld060
+			ld	e,e
+			ld	e,b
+			jr	c,La9a8
+			or	d
+			ld	d,a
+			sub	h
+			ld	e,(hl)
+			add	a,b
+			exx
+			rst	20h
+			ld	d,e
+			jp	c,Le142
+			ret	p
+			add	hl,hl
+			ld	bc,a8c7h
+			jp	c,Lbb4e
+			jp	z,L12c2
+			rst	28h
+			ld	sp,15c2h
+			ret	nc
+			cpi
+			cp	h
+			add	a,e
+			ld	e,l
+			xor	c
+			sub	b
+			ld	(hl),c
+			ld	d,3bh
+			add	a,29h
+			rrca
+			ld	l,e
+			ld	h,h
+			ld	h,a4h
+			ret	nz
+			ld	(hl),l
+			xor	c
+			add	a,h
+			sub	c
+			ld	(c7a1h),a
+			call	pe,L57f1
+			xor	(hl)
+			dec	e
+			dec	h
+			scf
+			ld	l,h
+			add	a,15h
+			add	a,l
+			rlca
+			ld	d,l
+			ld	a,c
+			rst	28h
+			jr	Laa12
+			db	1fh,b3h,72h,88h,e6h,eeh,88h,b3h
+			db	0dh,e0h,a6h,cah,19h,20h,beh,50h
+			db	26h,96h,1bh,bbh,27h,fbh,18h,a6h
+			db	d2h,9ch,afh,0dh,72h,c4h,43h,d5h
+			db	2ah,2eh,2ah,e8h,1dh,7ah,b2h,71h
+			db	60h,4bh,dfh,9fh,b2h,b1h
+			ld	h,a
+			inc	h
+			sub	(hl)
+			add	hl,de
+			cp	b
+			or	a
+			adc	a,38h
+			push	hl
+			ld	a,(3db8h)
+			dec	d
+			ld	(de),a
+			ld	hl,929ah
+			daa
+			and	h
+			rst	00h
+			sbc	a,c
+			jp	c,L3768
+			in	a,(c5h)
+			sbc	a,e
+			or	h
+			ld	e,h
+			adc	a,(hl)
+			ld	b,h
+			or	d
+			jp	z,L1b74
+			jp	po,Le59d
+			rst	00h
+			ld	e,c
+			ld	h,b
+			ld	d,l
+			add	a,b
+			cpl
+			adc	a,a
+			ld	(bc),a
+			daa
+			ld	b,(hl)
+			and	05h
+			ld	c,c
+			ld	l,e9h
+			ld	d,c
+			ld	hl,9b53h
+			dec	l
+			jp	po,Lbd03
+			xor	h
+			ld	l,d
+			dec	(hl)
+			ld	a,(de)
+			inc	bc
+			ld	d,e
+			ld	hl,c25ah
+			rlca
+			di
+			call	po,La357
+			ld	c,l
+			and	(hl)
+			call	p,L9ace
+			cp	h
+			dec	c
+			ld	h,b
+			pop	de
+			rst	20h
+			ld	b,(hl)
+			ret	pe
+			jp	nz,L98f5
+			ld	(hl),edh
+			ex	af,af'
+			inc	(hl)
+			ccf
+			ld	a,(de)
+			and	d
+			ld	(hl),bah
+			add	a,e
+			scf
+			ld	d,l
+			xor	l
+			halt
+			di
+			ld	c,b
+			dec	a
+			jr	nz,Laaac
+			cp	d
+			ld	a,(bc)
+			jp	Lda9d
+			db	5fh,d8h,dch,2dh,70h,65h,5ch,e9h
+			db	1ch,a8h
+			adc	a,e0h
+			call	c,La029
+			ld	a,c
+			ld	a,(bc)
+			ld	b,h
+			jp	nz,L0c2b
+			sub	1ah
+			dec	hl
+			dec	a
+			ld	e,(hl)
+			add	a,(hl)
+			xor	b
+			ld	(hl),e
+			sbc	a,h
+			sbc	a,7eh
+			sbc	a,72h
+			ld	h,c
+			in	a,(5fh)
+			or	(hl)
+			ld	b,h
+			add	hl,bc
+			add	hl,sp
+			cpl
+			ld	sp,hl
+			cp	d
+			ld	c,a
+			xor	a
+			cp	2eh
+			ld	e,(hl)
+			dec	e
+			jp	c,L58c2
+			ld	a,h
+			adc	a,c
+			adc	a,(hl)
+			ld	b,(hl)
+			ld	c,l
+			adc	a,d
+			ld	sp,c00ch
+			ld	c,d
+			ld	h,l
+			xor	(hl)
+			adc	a,b
+			or	b
+			ld	b,b
+			pop	af
+			sbc	a,2dh
+			call	p,L0851
+			dec	bc
+			dec	a
+			ld	hl,fdcbh
+			ld	e,b
+			ld	b,b
+			ld	de,b494h
+			ex	af,af'
+			ret	pe
+			ld	c,d
+			call	z,Lfe22
+			rst	08h
+			sbc	a,a
+			jp	c,Le88b
+			ret	pe
+			ld	d,d
+			cpl
+			or	dch
+			call	nc,Leacf
+			nop
+			add	a,h
+			jr	Laac3
+			db	c0h,54h,fdh,edh,f4h,d7h,c8h,aeh
+			db	27h,02h,c6h,85h,20h,07h,e5h,77h
+			db	73h,b7h,3bh,29h,57h,02h,feh,43h
+			db	50h
+			push	hl
+			jr	nz,Lab60
+			jr	nz,Lab35
+			ld	h,e
+			pop	af
+			xor	d
+			ld	b,d
+			sub	a
+			inc	hl
+			ld	(c22fh),a
+			ld	(hl),e
+			ld	d,h
+			ld	l,e
+			or	22h
+			inc	l
+			ld	a,e
+			jr	nz,Lab51
+			rst	10h
+			ld	b,3eh
+			rst	30h
+			ld	d,b
+			call	pe,L10bd
+			ret	c
+			ld	a,h
+			ld	d,e
+			dec	h
+			rra
+			nop (2x) *
+			ld	(2014h),hl
+			xor	26h
+			ld	l,c
+			dec	a
+			ld	d,d
+			sub	e
+			sub	c
+			ld	b,b
+			ld	b,d
+			ld	e,40h
+			jp	z,L6f02
+			ld	b,l
+			ld	l,c
+			ld	bc,47f6h
+			inc	sp
+			jr	nc,Lab28
+			sub	l
+			ld	d,c
+			jp	nz,L8ba3
+			push	hl
+			ld	e,(hl)
+			xor	l
+			ld	a,(de)
+			jp	po,L12eb
+			pop	de
+			or	(hl)
+			sbc	a,(hl)
+			ret	po
+			ld	a,a
+			ld	c,l
+			or	d
+			push	de
+			ret
+			db	a9h,c1h,c3h,8bh
+			sbc	a,e
+			sbc	a,d
+			ld	c,h
+			inc	b
+			ld	a,(de)
+			sbc	a,(hl)
+			ccf
+			pop	de
+			ret	nc
+			add	a,c
+			rst	20h
+			ld	(hl),l
+			nop (2x) *
+			inc	de
+			ld	h,(hl)
+			ld	b,l
+			rlca
+			xor	h
+			ld	c,l
+			and	b
+			sbc	a,c
+			adc	a,a
+			ld	l,(hl)
+			ret	m
+			rst	08h
+			ld	a,(a818h)
+			or	a
+			ld	h,h
+			inc	c
+			or	5dh
+			ld	(hl),a
+			jp	c,Lcf9b
+			ld	hl,186ch
+			ld	b,l
+			ret	m
+			halt
+			dec	d
+			sbc	a,a
+			adc	a,e
+			adc	a,c
+			ld	e,b
+			ld	c,h
+			inc	de
+			ld	l,h
+			out	(28h),a
+			jp	nc,L803e
+			ld	h,l
+			ld	e,b
+			dec	bc
+			cp	a
+			ret	z
+			jp	c,L8e88
+			ld	d,d
+			ld	d,l
+			ld	l,b
+			call	m,L2682
+			call	z,L9b8f
+			ld	l,d
+			sub	c
+			and	cch
+			cpl
+			ld	a,b
+			daa
+			im	2 *
+			ld	a,c
+			ld	b,b
+			ld	l,a
+			sbc	a,l
+			sbc	a,e
+			ld	(d11eh),hl
+			rst	08h
+			ld	e,d
+			rlca
+			jr	Labf6
+			db	8fh,e6h,97h,dfh,14h,1fh
+			ld	h,bdh
+			jr	nc,Lab66
+			add	a,e
+			ld	e,c
+			ld	(f2abh),bc
+			ld	(hl),h
+			rst	10h
+			ld	c,d
+			cp	c
+			add	a,c
+			rst	18h
+			dec	sp
+			rst	28h
+			ld	d,h
+			ld	e,(hl)
+			pop	af
+			push	de
+			inc	(hl)
+			inc	hl
+			ld	h,l
+			adc	a,b
+			sbc	a,c
+			ld	h,c6h
+			ld	(hl),l
+			sbc	a,(hl)
+			cp	(hl)
+			ld	d,c
+			dec	a
+			and	b
+			and	a
+			jr	z,Labd7
+			adc	a,b
+			sbc	a,e
+			inc	bc
+			ld	d,l
+			ld	(hl),36h
+			cp	h
+			and	d
+			rst	38h
+			ld	l,h
+			nop (2x) *
+			ld	c,d
+			xor	h
+			cp	d
+			or	(hl)
+			nop (2x) *
+			adc	a,c
+			cp	l
+			xor	a
+			dec	h
+			and	a
+			adc	a,(hl)
+			jr	nc,Labfa
+			ld	e,l
+			rla
+			jp	p,L04db
+			inc	c
+			ld	h,b
+			inc	c
+			ld	h,a
+			jp	pe,L5483
+			dec	hl
+			xor	dah
+			ei
+			jp	(hl)
+			db	85h,f1h,55h,0eh,bah,a7h,62h,07h
+			db	0bh,efh,5eh,93h,dah,04h,54h,1fh
+			add	a,(hl)
+			jr	nz,Labc6
+			ld	a,feh
+			ld	b,b
+			ld	e,e
+			ld	(hl),l
+			inc	bc
+			ld	b,c
+			ld	d,d
+			dec	e
+			ret	pe
+			sbc	a,h
+			rst	28h
+			ccf
+			ld	c,e
+			ld	h,a
+			rst	20h
+			and	a
+			xor	a
+			ld	(hl),a
+			ld	a,iyl *
+			cp	a
+			ld	h,e
+			and	l
+			xor	a
+			rst	38h
+			ld	l,d
+			ret
+			db	fbh,56h,15h,bah,8eh,0bh,98h,34h
+			db	36h,bch,eah,f7h,dfh,06h,79h,08h
+			db	8ch,49h,e8h,0fh,c7h,b8h,c1h,50h
+			db	9dh,54h,d8h,67h,cbh,36h,71h,e1h
+			db	d0h,b9h,6fh,8fh,16h,a5h,d7h,e4h
+			db	c5h,10h,e1h,f7h,28h,f1h,aah,0ch
+			db	d6h,87h,6dh,c9h,0ah,6eh,8ah,28h
+			db	2dh,79h,0eh,8fh,f7h,f2h,34h,68h
+			db	08h,dfh,45h,62h,21h,cdh,0dh,beh
+			db	29h,f4h,f6h,f9h,ech,f6h,54h,75h
+			db	e4h,d6h,d1h,07h,70h,4bh,76h,01h
+			db	60h,45h,28h,fch,74h,abh,02h,7ah
+			db	f6h,59h,66h,81h,b8h,0bh,eeh,d9h
+			call	nc,Ldeff
+			dec	e
+			sbc	a,a
+			pop	hl
+			dec	(hl)
+			xor	66h
+			add	a,c
+			ld	e,l
+			ld	sp,hl
+			nop (2x) *
+			sbc	a,b
+			or	l
+			ret	nc
+			sub	d
+			jr	nz,Lacc4
+			sub	(hl)
+			di
+			and	b
+			ld	e,e
+			xor	44h
+			ret	po
+			dec	e
+			rst	00h
+			rra
+			ex	(sp),hl
+			call	pe,L7418
+			ld	e,h
+			and	b
+			sub	c
+			ld	h,e
+			sbc	a,dbh
+			call	nz,L15d1
+			sub	e
+			ld	h,d
+			cp	ixl *
+			ex	af,af'
+			ld	c,(hl)
+			halt
+			or	d
+			add	a,l
+			ld	(hl),9bh
+			inc	e
+			ld	l,a1h
+			ld	sp,hl
+			add	a,5ch
+			ld	b,86h
+			and	a
+			dec	sp
+			jr	nc,Lad28
+			adc	a,l
+			ld	(hl),a
+			ret	p
+			add	a,fch
+			inc	(hl)
+			ld	e,d
+			call	po,Ledf1
+			ld	sp,f13bh
+			in	a,(66h)
+			ld	(hl),a
+			ld	c,c
+			adc	a,b0h
+			out	(76h),a
+			ld	h,h
+			ld	h,c
+			ld	l,d
+			ld	(de),a
+			jp	p,L5d16
+			inc	de
+			ld	h,a
+			and	h
+			ld	l,(hl)
+			add	hl,de
+			call	pe,La9bf
+			dec	(hl)
+			ret	po
+			ld	(hl),b
+			sub	l
+			ret	p
+			add	a,7ah
+			ld	l,(hl)
+			ld	h,a
+			jp	(hl)
+			db	8ch,b7h,d6h,9bh,c3h,87h,7bh,a2h
+			db	48h,49h,6eh
+			ld	c,e
+			ret	p
+			scf
+			ret	pe
+			ld	e,d
+			ld	(hl),d
+			xor	d
+			sub	a
+			nop (2x) *
+			sub	c
+			ld	b,d
+			inc	b
+			dec	de
+			sbc	a,(hl)
+			dec	a
+			ld	e,b
+			sbc	a,c
+			jp	m,L359c
+			adc	a,c
+			ld	a,4dh
+			ld	c,d
+			jr	Lad4f
+			db	38h,c5h,1ch,e4h,58h,cdh,e1h,7ch
+			db	82h,77h,10h,58h
+			daa
+			add	hl,de
+			out	(77h),a
+			ld	d,a
+			ld	bc,c856h
+			ld	c,l
+			djnz	Lad09
+			and	h
+			ld	a,l
+			ret	po
+			rla
+			ld	b,l
+			ld	a,(6605h)
+			cp	d
+			ld	a,h
+			add	a,f2h
+			inc	h
+			ld	(hl),l
+			or	c
+			call	p,L1c6a
+			and	b
+			ld	c,l
+			cp	a
+			ld	c,d
+			ld	h,l
+			cp	e
+			xor	c
+			rst	20h
+			ld	h,(hl)
+			jp	L7a63
+			db	20h,20h,27h,f0h,e2h,9fh,25h
+			ld	a,b
+			cp	l
+			ld	e,e
+			sub	d
+			sub	c
+			ld	b,l
+			ld	b,e
+			ld	h,h
+			ret
+			db	06h,8fh,44h,d8h,98h,feh
+			ld	d,c
+			and	9dh
+			inc	l
+			call	nz,L9126
+			jp	po,L742d
+			add	a,(hl)
+			ld	(hl),l
+			or	58h
+			and	b
+			ld	l,a
+			ld	l,c
+			ld	d,c
+			call	po,Lb6a2
+			or	84h
+			ld	h,l
+			ld	a,deh
+			ld	d,e
+			xor	a
+			ld	c,c
+			ld	l,h
+			ld	c,h
+			ld	d,a
+			ex	af,af'
+			ld	d,l
+			cp	h
+			xor	h
+			ld	c,l
+			ld	b,85h
+			ld	d,l
+			scf
+			dec	c
+			add	a,bch
+			out	(e2h),a
+			ld	a,l
+			dec	hl
+			and	l
+			ld	c,(hl)
+			ld	c,(hl)
+			jp	pe,L359d
+			add	a,e
+			ld	e,c
+			or	a
+			ld	de,af12h
+			ld	b,(hl)
+			dec	a
+			djnz	Laddb
+			ld	d,e
+			and	49h
+			ld	de,c8b0h
+			call	m,L33c5
+			dec	hl
+			ret	nz
+			ld	h,b
+			ld	sp,982bh
+			ld	hl,9dddh
+			cp	l
+			sub	b
+			ret	m
+			ld	a,(de)
+			ld	b,l
+			ret	z
+			ld	a,l
+			ret
+			db	04h,40h,63h,99h,83h,1eh,e6h,51h
+			db	25h,c6h,98h,9ah,4ch,96h,58h,84h
+			db	d6h,6ch,35h,f2h,2eh
+			ld	d,(hl)
+			rst	38h
+			and	b
+			adc	a,a
+			xor	(hl)
+			ld	l,b
+			xor	d
+			ld	(hl),c
+			adc	a,e
+			and	e
+			ld	e,(hl)
+			daa
+			pop	af
+			ret
+			db	8ah,79h,14h,3ah,1dh,a6h,71h,e4h
+			db	72h,afh,d5h,a0h,6eh,3ah,b4h,8fh
+			db	17h,88h,ddh,24h,16h,8fh,18h,d6h
+			db	aah,f1h,98h,2bh,5dh,71h,27h,6fh
+			db	b3h,89h,85h,bah,45h,27h,75h
+			ld	(0375h),hl
+			ld	b,c
+			exx
+			sub	l
+			sub	h
+			ld	d,l
+			sbc	a,e
+			nop (2x) *
+			ld	b,c
+			res	0,(hl)
+			ret	c
+			out	(9fh),a
+			and	c
+			dec	l
+			ei
+			add	hl,de
+			dec	a
+			pop	hl
+			ld	a,a
+			ret	c
+			xor	h
+			nop
+			add	a,57h
+			ld	h,h
+			ret	pe
+			add	a,d
+			inc	a
+			nop
+			inc	sp
+			ld	d,a
+			ld	l,l
+			ld	d,d
+			ld	e,c
+			push	bc
+			ld	h,d
+			inc	hl
+			jr	nc,Laeb5
+			call	nz,Laa8e
+			push	bc
+			ld	l,d
+			rst	10h
+			ld	(hl),h
+			ld	(hl),a
+			rst	38h
+			ld	c,23h
+			ld	a,c
+			cp	h
+			ld	hl,(4369h)
+			rst	18h
+			ld	a,(a213h)
+			sbc	a,c
+			ld	de,4b3dh
+			ld	a,b
+			sbc	a,b
+			xor	(hl)
+			jp	(hl)
+			db	e6h
+			cp	d
+			ld	(hl),h
+			cpl
+			dec	bc
+			and	d
+			sub	d
+			sbc	a,(hl)
+			ld	de,16f5h
+			rst	00h
+			jp	z,L96f8
+			add	hl,sp
+			sub	l
+			ld	e,a
+			ld	l,b
+			ld	h,(hl)
+			cp	l
+			ld	l,e
+			cp	c
+			ld	l,l
+			add	iy,sp
+			ret	nz
+			add	a,e
+			djnz	Lae5c
+			add	a,l
+			or	l
+			ld	c,ixl *
+			rst	38h
+			ld	e,h
+			ld	c,d
+			rst	10h
+			jr	z,Laebd
+			dec	e
+			ld	d,c
+			sbc	a,c
+			jr	Laeb9
+			db	2ah,bdh,33h,feh,1bh,dch,50h,31h
+			db	4dh,37h,f5h,61h,4bh,11h,f4h
+			inc	b
+			ld	c,a
+			ld	e,c
+			ld	b,l
+			ld	h,(hl)
+			ld	h,c
+			cp	b
+			dec	bc
+			cpl
+			ret	m
+			xor	(hl)
+			push	hl
+			cp	(hl)
+			push	de
+			ld	a,(hl)
+			sub	l
+			pop	de
+			and	c
+			adc	a,c
+			add	a,d
+			and	b
+			add	hl,bc
+			sbc	a,e
+			rst	30h
+			jp	c,L0e8a
+			jp	L3c21
+			db	d9h,beh,ebh,69h,b1h,0bh,f7h,55h
+			db	ech,1ch,dbh,ddh,93h,3ch,68h,23h
+			db	41h,1ch,9dh
+			sub	(hl)
+			ex	af,af'
+			ld	h,h
+			nop
+			jp	po,L88ae
+			jr	nz,Laf3c
+			and	a
+			call	L0817
+			call	nz,L5892
+			and	d
+			add	hl,hl
+			ld	a,l
+			dec	d
+			sbc	a,a
+			ld	(hl),a
+			ld	a,h
+			or	(hl)
+			or	(hl)
+			ld	a,a
+			xor	c
+			jp	pe,L21d7
+			dec	l
+			ld	(hl),c2h
+			ld	e,e
+			out	(cah),a
+			inc	h
+			ld	e,e
+			ld	(2dffh),hl
+			ld	(hl),c
+			dec	e
+			ld	d,a
+			exx
+			ld	d,c3h
+			xor	h
+			push	bc
+			sub	c
+			cp	l
+			add	a,c
+			or	h
+			adc	a,afh
+			inc	(hl)
+			jp	m,L5207
+			ld	c,ceh
+			ld	(bc),a
+			inc	b
+			adc	a,e
+			dec	e
+			xor	(hl)
+			inc	d
+			ld	(hl),b
+			ld	a,a
+			adc	a,d
+			ld	d,(hl)
+			ld	a,(2a11h)
+			daa
+			ld	c,h
+			exx
+			ld	a,l
+			xor	a2h
+			xor	h
+			ld	d,ebh
+			ld	b,a
+			pop	bc
+			ld	d,l
+			jp	nz,Le592
+			rst	20h
+			xor	e
+			rst	20h
+			rla
+			adc	a,iyh *
+			jr	c,Laf7a
+			ret	nz
+			ld	a,(hl)
+			cp	(hl)
+			ld	c,h
+			ld	l,12h
+			call	pe,L6977
+			or	h
+			and	(hl)
+			ld	h,l
+			and	e
+			ret	pe
+			jp	p,Leb10
+			ld	c,b
+			ld	(bc),a
+			rst	30h
+			jp	z,Lffa0
+			jp	p,L1e55
+			cp	b
+			ld	h,a
+			jp	m,L8c53
+			or	2ch
+			ld	(bc),a
+			ld	b,d
+			sub	l
+			ld	a,b
+			or	bdh
+			ld	h,l
+			sub	b
+			ld	l,(hl)
+			call	m,L3cd9
+			ld	d,d
+			or	e
+			ld	c,b
+			or	03h
+			sbc	a,a
+			ld	c,h
+			jp	z,L839f
+			pop	bc
+			ret	nc
+			inc	l
+			jp	p,L8df2
+			xor	(hl)
+			ld	(hl),e
+			ld	(hl),d2h
+			ld	(a475h),hl
+			ld	d,5eh
+			or	b
+			ld	b,e
+			ld	h,e
+			sbc	a,b
+			ld	c,d
+			nop
+			or	a
+			and	a
+			xor	(hl)
+			ei
+			and	cah
+			or	09h
+			sub	a
+			ld	e,e
+			ld	h,h
+			adc	a,d
+			ld	h,l
+			call	m,L1486
+			ld	(hl),e
+			pop	de
+			ld	e,4eh
+			and	h
+			and	01h
+			ld	d,c
+			ld	a,78h
+			xor	e
+			ld	h,h
+			pop	af
+			inc	a
+			jr	Laf4e
+			db	20h,00h,b8h,6dh,0eh,6eh,86h,ddh
+			db	efh,aeh,12h,56h,cch,58h,f8h,2ah
+			db	45h,72h,c9h,67h,deh,ebh,ffh,7fh
+			db	1ch,70h,67h,76h,f7h,c0h,7fh,0dh
+			db	56h,80h,39h,78h,35h,32h,c7h,cbh
+			db	f5h,12h,76h,95h,39h,7fh,f6h,b9h
+			db	5eh,8ah,57h,73h,cfh,98h,ffh,44h
+			db	61h,3ch
+			inc	(hl)
+			xor	d
+			ccf
+			nop (2x) *
+			adc	a,b
+			ld	hl,(8512h)
+			dec	(hl)
+			ret	c
+			jp	z,L5753
+			ld	d,e
+			ld	b,h
+			ld	(hl),abh
+			dec	hl
+			ld	h,c7h
+			ld	d,a
+			add	a,(hl)
+			ld	l,d
+			pop	af
+			ld	c,c
+			jp	nc,Lc36f
+			inc	hl
+			call	m,Lcac5
+			sub	2eh
+			adc	a,e
+			dec	de
+			ld	sp,hl
+			ld	h,04h
+			dec	e
+			ld	a,a
+			or	(hl)
+			adc	a,h
+			cp	e
+			call	po,Lc1bf
+			sub	d
+			xor	h
+			ld	e,(hl)
+			add	hl,de
+			dec	a
+			push	bc
+			ret	z
+			inc	de
+			ei
+			nop
+			inc	de
+			sub	e
+			ld	(hl),l
+			cp	a
+			ld	d,d
+			or	b
+			call	z,Lf651
+			ld	l,b
+			ld	e,c
+			ld	sp,hl
+			ret	m
+			jp	p,L0a26
+			adc	a,b
+			ld	h,e
+			or	b
+			daa
+			ld	b,e
+			ld	b,l
+			ld	sp,hl
+			jr	nc,Lb05c
+			add	a,(hl)
+			or	l
+			ld	b,(hl)
+			ld	a,(hl)
+			cp	e
+			cp	b
+			exx
+			ld	l,c
+			inc	h
+			ld	(hl),e
+			and	b
+			and	b
+			cp	d
+			pop	de
+			ret	po
+			rst	18h
+			ld	d,b
+			ld	a,b
+			dec	h
+			pop	bc
+			adc	a,l
+			ei
+			ret	z
+			ld	e,a
+			ld	b,e
+			ld	(iy + d2h),l
+			ld	a,c
+			ei
+			ld	d,28h
+			jp	nc,Le7b4
+			jp	po,L36e0
+			ld	l,h
+			ld	h,a
+			inc	sp
+			ex	(sp),hl
+			jr	Lb044
+			db	47h,1ch,56h,efh,bah,b9h,adh,59h
+			db	c5h,a2h,98h,03h,5eh,00h,95h,56h
+			db	8fh,7fh,cbh,d3h,e4h,a8h,7fh,5fh
+			db	73h,d4h,31h,67h,61h,11h,e4h,6bh
+			db	64h,38h,14h,a1h,5bh,e8h,70h,42h
+			db	99h,27h,a2h,12h,e1h,20h,21h
+			jp	pe,L4748
+			ld	a,(hl)
+			or	b
+			and	9ah
+			sub	37h
+			sbc	a,c
+			inc	bc
+			ld	e,cch
+			dec	b
+			ld	d,b
+			ld	e,e
+			cp	l
+			cp	98h
+			xor	d
+			xor	d
+			dec	h
+			ld	e,l
+			dec	sp
+			jr	c,Lb065
+			call	pe,L4712
+			add	a,l
+			ld	(hl),l
+			adc	a,(hl)
+			in	a,(dfh)
+			jr	z,Lb09e
+			ld	a,(hl)
+			ld	b,(hl)
+			ld	b,e
+			ld	h,c
+			call	z,Le076
+			rst	08h
+			ld	c,(hl)
+			ld	l,e
+			ld	(hl),c
+			ei
+			ld	l,a
+			ld	l,(hl)
+			ret	m
+			cp	h
+			ld	a,(9061h)
+			inc	bc
+			dec	l
+			adc	a,b
+			jp	po,L615f
+			cp	9bh
+			cp	l
+			inc	hl
+			rst	28h
+			jp	z,L3929
+			jp	nc,Lbd5e
+			or	b
+			inc	hl
+			ex	af,af'
+			ld	h,51h
+			inc	de
+			call	p,Ld74c
+			ld	d,d
+			nop (2x) *
+			ld	sp,08dch
+			ld	(35bdh),hl
+			ret	nc
+			ld	(bc),a
+			ld	c,c
+			jr	c,Lb102
+			ld	c,(hl)
+			jp	nc,L4614
+			ld	b,d
+			ld	l,d
+			ld	h,a
+			ld	d,e
+			adc	a,e
+			rst	28h
+			ld	h,h
+			ld	e,c
+			ret	z
+			inc	c
+			call	p,L7cf9
+			pop	hl
+			add	a,c
+			ld	b,c
+			ld	d,b
+			cp	b
+			inc	hl
+			sbc	a,e
+			and	(hl)
+			or	h
+			adc	a,d
+			and	h
+			sbc	a,h
+			ld	sp,hl
+			ld	h,d
+			pop	hl
+			sbc	a,c
+			dec	h
+			xor	a
+			sub	l
+			in	a,(68h)
+			sbc	a,h
+			xor	b
+			cp	d
+			dec	hl
+			ld	h,c
+			sub	(hl)
+			sub	a
+			ld	e,e
+			jr	c,Lb122
+			ld	l,e
+			and	e
+			inc	de
+			adc	a,ceh
+			ld	h,e
+			ld	hl,45e5h
+			nop (2x) *
+			pop	de
+			ld	b,64h
+			dec	d
+			ld	a,dfh
+			sbc	a,l
+			ld	b,b
+			out	(a2h),a
+			jp	po,La1aa
+			ret	pe
+			inc	c
+			ld	e,c
+			rst	00h
+			ld	e,d
+			ld	c,19h
+			or	a
+			ld	h,e
+			rst	18h
+			ld	c,(hl)
+			sub	a
+			push	bc
+			adc	a,a
+			and	cah
+			inc	b
+			ld	a,c
+			ld	a,a
+			ld	h,b
+			and	e
+			or	70h
+			ld	l,e
+			pop	de
+			cp	b
+			jp	po,L3df6
+			ld	hl,(34e8h)
+			ld	e,h
+			adc	a,8eh
+			adc	a,b
+			inc	hl
+			sbc	a,c
+			xor	6ah
+			push	hl
+			dec	bc
+			ld	h,e
+			ccf
+			xor	d
+			and	h
+			nop
+			pop	hl
+			ld	d,c
+			rst	08h
+			inc	sp
+			ld	hl,(b056h)
+			ld	hl,(5782h)
+			sbc	a,d
+			nop (2x) *
+			ld	e,d
+			jp	c,L40d7
+			halt
+			rrca
+			and	08h
+			or	84h
+			in	a,(6ah)
+			rst	10h
+			nop (2x) *
+			cp	b
+			xor	d
+			pop	af
+			ld	d,b
+			ld	b,c
+			add	hl,de
+			ld	(hl),l
+			cp	l
+			jr	c,Lb1e6
+			ld	d,(hl)
+			ld	d,a
+			adc	a,e
+			sbc	a,07h
+			jp	L22fe
+			db	9eh,56h,c9h,e8h,4eh,feh,5eh,27h
+			db	4eh,71h,88h,61h,deh,0ch,27h,43h
+			db	43h,9eh,07h,13h,6dh,92h,a1h,38h
+			db	35h,4fh,86h,44h,71h,ddh,ceh,78h
+			db	91h,87h,e9h,8dh,aeh,85h,bbh,82h
+			db	b4h,b8h,a4h,d0h,c7h,cbh,5fh,edh
+			db	3ah,b1h,39h,9dh,b0h,70h,d5h,2ah
+			db	6ch,eeh,d5h,2dh,22h,77h,f9h,51h
+			db	ebh,efh,eah,a7h,a9h,97h,66h,8eh
+			db	67h,09h
+			sbc	a,(hl)
+			ex	(sp),hl
+			inc	a
+			ld	bc,373eh
+			add	a,l
+			call	z,L55ab
+			dec	sp
+			ld	e,a
+			dec	bc
+			or	c
+			ret	pe
+			ret	pe
+			ld	h,c
+			pop	de
+			jp	nz,L554b
+			cpl
+			ld	b,a
+			dec	bc
+			adc	a,c
+			ld	d,a
+			jp	c,Leb41
+			jp	L6efd
+			db	deh,39h,a2h,9dh,22h,28h,a9h,8eh
+			db	afh,f3h,afh,11h,60h,7dh,7fh,24h
+			db	9eh,34h,51h,75h,98h,a5h,98h,bfh
+			db	edh,36h,2eh,c1h,b5h,e7h,bfh,36h
+			db	cbh,41h,1bh,88h,e8h,6ah,43h,3dh
+			db	92h,99h,93h,d8h,fdh,56h,0eh,f8h
+			db	80h,b0h,eeh,4fh,b9h,80h,4dh,cdh
+			db	6ah,28h,10h
+			ret	nz
+			push	bc
+			pop	af
+			call	z,L2a5b
+			ld	h,1ch
+			ld	b,a
+			add	a,l
+			ld	d,h
+			cp	l
+			adc	a,b
+			adc	a,72h
+			xor	d
+			ld	e,e
+			cp	(hl)
+			ld	hl,(0909h)
+			call	nz,L0e26
+			rst	00h
+			ld	h,e
+			add	a,d
+			inc	hl
+			add	a,(hl)
+			adc	a,b
+			rrca
+			xor	e
+			xor	b
+			call	nz,Lae7a
+			inc	d
+			xor	d1h
+			xor	l
+			ret	nc
+			or	c
+			add	a,51h
+			nop (2x) *
+			call	z,Lcba1
+			dec	d
+			and	e
+			ld	d,b
+			jr	nz,Lb263
+			jr	nz,Lb277
+			sll	c
+			ld	b,7ah
+			ccf
+			ld	l,a
+			inc	hl
+			ld	e,(hl)
+			jr	Lb2a0
+			db	5eh,30h,d6h,16h,e4h,42h,a9h,02h
+			db	75h,8dh,5eh,4bh,9eh,36h,09h,aeh
+			db	d0h,3ch,75h,c5h,dah,a4h,77h,4ah
+			db	b5h,3ah,85h,1dh,9dh,40h
+			ld	d,c
+			dec	(hl)
+			inc	de
+			xor	90h
+			sub	a
+			ld	b,(hl)
+			halt
+			sub	e
+			and	c
+			rla
+			ld	a,5bh
+			call	pe,L8bd1
+			ld	e,e
+			pop	bc
+			ld	l,h
+			rst	10h
+			ld	hl,cbc5h
+			ret	c
+			or	e
+			jp	po,L4890
+			sub	e
+			cp	(hl)
+			jp	c,L60ed
+			call	p,L8e95
+			sub	e
+			sbc	a,d
+			ld	d,h
+			ld	a,h
+			ret	pe
+			exx
+			ld	de,3ff5h
+			adc	a,l
+			inc	(hl)
+			add	hl,de
+			call	m,L0505
+			ld	e,e
+			ld	e,e
+			out	(88h),a
+			rra
+			jr	Lb2c8
+			db	35h,d0h,25h,bch,abh,76h,f2h,cfh
+			db	abh,fdh,9ah,89h,5ah,45h,30h,11h
+			db	b3h,6fh,b4h,0dh,6dh,18h,8eh,32h
+			db	d1h,30h,34h,73h,8bh,efh,3bh,0ch
+			db	fah,bah,03h,5bh,15h,7bh,16h,8ah
+			db	7bh,18h,65h,a3h,86h,47h,00h,16h
+			db	79h,e1h,0dh,95h,44h,64h,17h,7bh
+			db	8dh,6fh,03h,f1h,47h,76h,58h,9dh
+			db	b8h,d4h,e5h,0bh
+			rra
+			add	hl,sp
+			push	bc
+			dec	hl
+			jp	c,L666e
+			rst	00h
+			ld	h,89h
+			and	b
+			rrca
+			ld	de,32f4h
+			ret	po
+			push	bc
+			ld	h,c
+			sbc	a,ceh
+			jp	L73b3
+			db	c3h,64h,0fh,0ch,a2h,ach,fdh,a3h
+			db	b8h,3eh,02h,dch,adh,f5h,c8h,d4h
+			db	1eh,2ch,b3h,50h,91h,53h,70h,b0h
+			db	c9h,9bh,37h,86h,d8h,31h,0fh,69h
+			db	64h,30h,bch,60h,4fh,a9h,f8h,62h
+			db	60h,8eh,7dh,4ch,06h,21h,2eh,f8h
+			db	e5h,6ah,6ch,17h,b9h,52h,d2h,14h
+			db	35h,efh,f1h,f8h,8dh,b6h,68h,d5h
+			db	3bh,2ch,0bh,a6h,6bh,e5h,09h,bfh
+			db	a4h,3eh,dch,ebh,73h,6eh,8dh,c0h
+			db	ech,30h,aah,03h,e3h,72h,d8h,3ah
+			db	cdh,f6h,abh,9ah,c4h,c7h,cch,4bh
+			db	6bh,dah
+			ld	a,(31e7h)
+			ld	l,b
+			jr	z,Lb3d7
+			add	a,a
+			rst	00h
+			dec	c
+			ld	(hl),l
+			xor	a
+			sub	9fh
+			ld	e,h
+			ret
+			db	4bh,b2h,fch,81h,0ch,e0h,07h,10h
+			db	d8h,8ah,d3h
+			add	a,(hl)
+			adc	a,b
+			ld	c,d
+			ld	h,b
+			out	(dah),a
+			ld	h,l
+			cp	a
+			ld	d,(hl)
+			ld	h,(hl)
+			jr	c,Lb3bc
+			inc	de
+			ld	l,b
+			ld	b,l
+			dec	a
+			ld	(hl),l
+			or	c
+			ld	c,(hl)
+			ld	a,b
+			ld	d,h
+			jr	z,Lb397
+			pop	hl
+			dec	de
+			rst	10h
+			inc	l
+			xor	a
+			adc	a,(hl)
+			ld	l,c
+			ld	c,b
+			ld	(hl),d
+			call	po,L930f
+			call	nc,Le2cb
+			ld	c,d
+			sub	h
+			ld	c,71h
+			ld	a,d
+			ld	(e8e4h),a
+			jp	m,Le63e
+			add	a,a
+			xor	b
+			ld	d,74h
+			xor	d
+			ld	e,a
+			add	hl,bc
+			inc	hl
+			adc	a,d
+			dec	sp
+			ld	h,(hl)
+			add	hl,de
+			xor	(hl)
+			cp	l
+			out	(f5h),a
+			in	a,(53h)
+			ld	(hl),6fh
+			ld	sp,hl
+			ld	a,c
+			cp	b
+			cp	5dh
+			ld	h,12h
+			ld	d,(hl)
+			jp	p,L45ec
+			out	(a4h),a
+			sub	h
+			rst	30h
+			cp	c
+			ld	h,f4h
+			ld	hl,(394ah)
+			ld	b,c
+			jr	c,Lb43f
+			ret
+			db	82h,96h,0fh,10h,7bh,92h,e8h,e4h
+			db	f2h,65h,7bh,32h,ceh,06h,f5h,a3h
+			db	94h,5eh,6eh,f5h,16h,b8h,94h,81h
+			db	e2h
+			cp	b
+			ld	d,a
+			ld	a,a
+			add	a,d
+			ld	hl,a390h
+			adc	a,h
+			ld	b,b
+			ld	b,l
+			adc	a,(hl)
+			ld	b,l
+			ld	c,l
+			ld	(507fh),a
+			xor	(hl)
+			ld	a,(hl)
+			xor	d
+			rst	38h
+			ld	c,d
+			rst	00h
+			ret	nc
+			and	d
+			adc	a,h
+			add	a,d
+			ld	(de),a
+			sub	d
+			ld	l,fch
+			rst	28h
+			and	d
+			call	m,Lf116
+			sbc	a,d
+			pop	de
+			sbc	a,(hl)
+			adc	a,b
+			ld	l,a
+			call	m,La26b
+			xor	a
+			sbc	a,a
+			ld	e,a
+			jp	po,L54ef
+			ld	c,a
+			rra
+			call	pe,L89b4
+			ld	h,e
+			nop (2x) *
+			dec	bc
+			djnz	Lb3f4
+			sub	b
+			dec	d
+			push	bc
+			or	28h
+			sub	d
+			or	l
+			ld	b,c
+			ld	l,f8h
+			and	d
+			add	hl,hl
+			ld	e,e
+			sbc	a,(hl)
+			inc	l
+			push	bc
+			and	l
+			ld	c,l
+			jp	(hl)
+			db	d7h,2ch,89h,9dh,09h,a1h,70h,5ch
+			db	1ch,63h,5eh,06h,ceh,ech,12h,8dh
+			db	54h,6bh,8fh,9ch,30h
+			ret	po
+			dec	h
+			rst	08h
+			cp	d
+			inc	h
+			dec	de
+			add	a,a
+			ex	(sp),hl
+			cp	h
+			dec	a
+			ccf
+			ld	d,a
+			ld	e,c
+			add	hl,hl
+			adc	a,a
+			daa
+			ld	a,(hl)
+			sub	(hl)
+			sbc	a,e
+			add	a,h
+			ld	l,e
+			xor	e
+			ld	bc,cce5h
+			ld	a,(b780h)
+			ld	a,(20fch)
+			inc	e
+			ld	a,a
+			rst	30h
+			ld	l,c
+			ld	d,l
+			ld	l,d
+			ld	l,a
+			ld	a,c
+			ld	e,(hl)
+			rst	10h
+			ld	e,a
+			ld	hl,(48eah)
+			ld	(hl),c
+			and	a
+			jp	pe,Ld9fa
+			ld	c,b
+			in	a,(19h)
+			jr	c,Lb4af
+			add	a,b
+			ld	c,l
+			cp	a
+			add	a,(hl)
+			ld	l,c
+			ld	a,(de)
+			call	po,L4bc5
+			ld	a,a
+			dec	c
+			ld	(9b6ah),hl
+			call	c,L9c87
+			ld	h,h
+			and	e
+			xor	a
+			ld	c,(hl)
+			and	l
+			add	a,a
+			rst	00h
+			or	(hl)
+			and	c
+			ld	d,b
+			rst	00h
+			jp	m,Le6d2
+			cp	c
+			ld	(hl),a
+			call	c,L162d
+			nop (2x) *
+			xor	e
+			ld	d,l
+			out	(abh),a
+			ld	c,l
+			rst	38h
+			adc	a,h
+			inc	sp
+			in	a,(f8h)
+			add	a,b
+			rst	08h
+			ex	de,hl
+			call	m,L5490
+			ld	b,b
+			add	hl,bc
+			cp	b
+			add	a,a
+			xor	h
+			dec	h
+			sbc	a,h
+			and	l
+			adc	a,b
+			sub	e
+			rst	00h
+			ld	l,d
+			sbc	a,l
+			ld	l,d
+			jp	c,L910b
+			jr	Lb546
+			db	6eh,3dh,11h,34h,d0h,70h,60h,d2h
+			db	19h,64h,51h,1eh,99h,73h,aah,c8h
+			db	9bh,2ah,c6h,85h,f1h,87h,52h,e0h
+			db	e8h,d0h,3fh,e4h,c5h,2ch,6ah,cch
+			db	76h,79h,a0h,19h,72h,a1h,50h,d0h
+			db	41h,8eh,20h,dch,a8h,96h,4eh,a6h
+			db	afh,90h,d4h,efh,e1h,57h,0dh,07h
+			db	f9h,24h,c1h,d4h
+			nop
+			or	d
+			adc	a,b
+			sub	l
+			ld	h,c
+			inc	l
+			xor	b
+			inc	hl
+			cp	l
+			ld	h,l
+			ret	pe
+			exx
+			ret	c
+			jr	z,Lb4e2
+			daa
+			jp	p,La083
+			ld	b,h
+			call	nc,Le60c
+			rlca
+			or	h
+			push	bc
+			add	a,(hl)
+			ld	a,h
+			dec	b
+			xor	d
+			ld	b,c
+			call	z,L1610
+			rst	28h
+			ld	c,beh
+			ld	(hl),l
+			ld	(de),a
+			ld	a,(hl)
+			ret	po
+			inc	bc
+			ei
+			ld	(a9c5h),hl
+			sub	h
+			jr	nz,Lb5f5
+			adc	a,h
+			rst	00h
+			ld	(de),a
+			ld	e,l
+			inc	hl
+			ld	c,h
+			and	l
+			sbc	a,d
+			ld	h,d
+			add	a,l
+			ld	l,2ah
+			ld	(a579h),a
+			sbc	a,e
+			adc	a,e
+			ld	d,c
+			ld	l,54h
+			adc	a,a
+			sub	9ch
+			ld	a,h
+			call	z,Le505
+			exx
+			add	a,a
+			sub	l
+			cp	b
+			ld	b,b
+			ld	h,a
+			ei
+			ld	d,c
+			sub	h
+			and	l
+			inc	de
+			ld	d,(iy + 11h)
+			ld	e,8ch
+			ld	e,b
+			adc	a,l
+			ld	l,a
+			adc	a,h
+			ld	c,d
+			inc	bc
+			rst	18h
+			dec	(hl)
+			inc	hl
+			ld	(hl),l
+			call	z,Lb0e3
+			ld	h,b
+			xor	l
+			and	e
+			inc	h
+			adc	a,(hl)
+			ld	a,e
+			add	hl,hl
+			sbc	a,b
+			or	e
+			call	c,Lbbc1
+			ld	h,h
+			ld	d,h
+			ld	c,h
+			and	c
+			ld	l,8eh
+			rst	00h
+			push	af
+			add	a,l
+			ld	e,e
+			ld	a,a
+			ex	de,hl
+			inc	sp
+			or	c
+			inc	de
+			or	a
+			ld	(hl),a
+			xor	45h
+			ld	(hl),h
+			nop (2x) *
+			ld	sp,bb9ah
+			push	af
+			ld	(24d6h),a
+			dec	de
+			sub	c
+			add	a,c
+			and	adh
+			pop	af
+			ld	(hl),b
+			rlca
+			ld	h,e
+			jp	pe,L5881
+			rst	28h
+			call	m,Lea7b
+			ld	b,l
+			or	b
+			dec	d
+			inc	(hl)
+			and	d
+			add	hl,hl
+			cp	(hl)
+			sbc	a,e
+			set	2,(hl)
+			ld	b,a
+			dec	b
+			cp	e
+			jp	nc,Lc311
+			ld	hl,9f62h
+			nop (2x) *
+			ld	a,(hl)
+			inc	hl
+			call	z,L2ab5
+			ret	c
+			ld	b,h
+			push	af
+			sbc	a,e
+			sub	b
+			sbc	a,c1h
+			sub	e
+			xor	18h
+			jp	nc,L97f6
+			rst	30h
+			adc	a,d
+			ld	a,h
+			add	a,e
+			xor	c
+			rra
+			adc	a,e
+			sub	d
+			ld	l,(hl)
+			and	l
+			ld	(hl),c
+			ld	b,c
+			jp	Ldaea
+			db	c5h,09h,70h,f0h,d6h,aah,a7h,f1h
+			db	79h,81h,cdh,d8h,f5h,37h,d3h,36h
+			db	5bh,3dh
+			and	c
+			ld	b,(hl)
+			push	hl
+			ld	e,a
+			rra
+			jr	z,Lb692
+			cp	a
+			ld	d,cbh
+			ld	(hl),e
+			ld	(de),a
+			add	hl,bc
+			scf
+			sbc	a,e
+			call	nz,Ld018
+			ld	l,d
+			daa
+			adc	a,c
+			sub	a
+			dec	e
+			ld	(hl),d
+			rlca
+			bit	0,(iy + 16)
+			inc	hl
+			or	34h
+			jp	Lfd23
+			db	bch,fah,04h,dch,afh,d5h,d0h,86h
+			db	85h,b5h,bdh,7fh,29h,ach,23h,93h
+			db	28h,47h,67h,f4h,ebh,80h,bah,e7h
+			db	8eh,80h,61h,38h,08h,8dh,80h,9fh
+			db	c3h,33h,00h,9bh,4ah,03h,4dh,1dh
+			db	88h,9dh,8dh,95h,36h,b6h,00h,25h
+			db	36h,0fh,b6h,7ah,6ch,cfh,aeh,abh
+			db	89h,9ch,44h,9fh,f3h,e8h,c4h
+			adc	a,(hl)
+			cp	c
+			rst	38h
+			ld	b,h
+			inc	d
+			ld	l,l
+			or	e
+			jp	(hl)
+			db	eeh,1ah,7fh,31h,7eh,54h,a9h,f5h
+			nop (2x) *
+			ld	c,d
+			inc	h
+			rst	08h
+			nop (2x) *
+			ld	c,e
+			and	b
+			ld	c,(hl)
+			ld	l,d
+			adc	a,c
+			and	l
+			inc	c
+			ld	l,d
+			ld	(5f70h),a
+			rst	20h
+			inc	h
+			nop (2x) *
+			dec	bc
+			or	b
+			call	po,La757
+			adc	a,b
+			ld	h,e
+			ld	a,d
+			ld	e,l
+			cpl
+			xor	l
+			or	b
+			sub	b
+			ld	a,b
+			ld	d,2bh
+			ld	e,(hl)
+			inc	hl
+			cp	b
+			jp	m,L3349
+			ld	d,h
+			dec	b
+			ld	c,a
+			nop (2x) *
+			rst	10h
+			ld	a,b
+			or	h
+			jp	c,Lc287
+			ld	a,l
+			ret	pe
+			inc	l
+			nop
+			ex	de,hl
+			dec	h
+			scf
+			add	a,(hl)
+			ld	a,h
+			ld	c,b
+			add	a,d
+			jp	L567d
+			db	cfh,d5h,08h,07h,65h,14h,35h,d2h
+			db	57h,2fh,01h,71h,9fh,b9h,0bh,09h
+			db	29h,b2h,a3h,f2h,e9h,17h,ceh,8dh
+			db	83h,17h,27h,ebh,69h,b6h,89h,95h
+			db	cbh,57h,afh,03h,4ah,50h,71h,52h
+			db	1dh,a1h,38h,98h,0fh,7ah,f4h,c1h
+			db	84h,46h,69h,5ch,2eh,5dh,49h,3ah
+			db	82h,8ah,fdh,4fh,74h,7dh
+			adc	a,c
+			ld	e,e
+			ld	h,(hl)
+			ld	a,(bc)
+			xor	c
+			ld	a,d
+			ld	e,e
+			or	l
+			ld	(hl),l
+			jp	c,L3f2e
+			ld	b,d
+			add	a,a
+			ld	(bc),a
+			ld	d,l
+			or	a
+			xor	l
+			jp	p,Lb5da
+			ld	d,d
+			and	(hl)
+			ret	nc
+			ld	d,h
+			out	(4fh),a
+			ld	e,l
+			ld	e,b
+			ld	b,e
+			and	d
+			inc	c
+			ret	z
+			and	e
+			ld	hl,(7edah)
+			jr	Lb73e
+			db	13h,f5h,ech,a3h,2eh,26h,2dh,01h
+			db	18h,62h,7ah,2ch,a1h,69h,47h,f8h
+			db	2bh,4dh,80h,04h,ebh,61h,32h,40h
+			db	8fh,d2h,d9h,cah,c3h,6ah,a0h,02h
+			db	4fh,8ch,44h,78h,79h,fah,4fh,87h
+			db	8fh,35h,36h,c4h,abh,c1h,c1h,56h
+			db	fah,f6h,ceh,92h,74h,fdh,1eh,20h
+			db	2fh,3ah,dah,1eh,cdh,3ch,40h,6ah
+			db	0ch,55h,43h,cfh,36h
+			or	h
+			or	(hl)
+			call	c,L16ac
+			ld	(L40e5),a
+			call	z,Ld6cb
+			ld	(hl),c
+			jp	m,Le917
+			sub	b
+			push	bc
+			ld	(hl),d
+			djnz	Lb722
+			rst	30h
+			ld	(hl),d
+			ret	z
+			rst	38h
+			djnz	Lb78e
+			dec	d
+			ld	e,h
+			inc	l
+			ld	a,(de)
+			ld	e,(hl)
+			add	a,(hl)
+			call	nz,La46a
+			ld	b,c
+			or	(hl)
+			add	a,b
+			xor	(hl)
+			inc	sp
+			ld	l,b
+			ld	a,a
+			ld	b,l
+			ld	de,6283h
+			ld	d,81h
+			inc	sp
+			ld	a,(hl)
+			push	de
+			call	nz,L7e0a
+			ld	e,(hl)
+			ld	d,d
+			ld	d,b
+			call	p,L3eeb
+			nop (2x) *
+			and	(hl)
+			nop (2x) *
+			ld	c,b
+			or	d8h
+			cp	a
+			xor	a
+			dec	h
+			add	a,(hl)
+			ld	h,e
+			ld	h,l
+			adc	a,d
+			and	l
+			ld	b,a
+			xor	h
+			dec	de
+			ret	pe
+			ld	a,l
+			rla
+			ld	e,(hl)
+			ld	l,e9h
+			sbc	a,h
+			and	h
+			rst	10h
+			ld	h,l
+			daa
+			nop (2x) *
+			jr	nz,Lb79d
+			xor	(hl)
+			rra
+			sbc	a,a
+			adc	a,b
+			ld	c,h
+			sbc	a,d
+			add	hl,de
+			ld	a,(bc)
+			or	d
+			ld	hl,(0ed0h)
+			set	5,d
+			ld	d,a
+			ld	b,h
+			xor	65h
+			ld	(hl),c
+			nop (2x) *
+			dec	bc
+			ex	(sp),hl
+			add	hl,hl
+			ld	l,b
+			ld	h,c
+			nop (2x) *
+			ex	de,hl
+			adc	a,e
+			jp	p,Le9f0
+			sub	(hl)
+			nop (2x) *
+			ld	b,c
+			ld	e,d
+			ld	hl,132ah
+			ld	l,e
+			call	po,L8f16
+			inc	d
+			ld	b,l
+			ld	b,(hl)
+			inc	de
+			ex	de,hl
+			sub	c
+			and	(hl)
+			djnz	Lb806
+			jp	po,L0f78
+			bit	3,h
+			jp	po,L7274
+			add	a,e
+			ret	pe
+			ld	bc,33e7h
+			dec	(hl)
+			ld	a,(e99dh)
+			ld	d,a
+			ld	(hl),h
+			ld	(hl),e
+			xor	18h
+			inc	a
+			xor	e
+			ld	ixl,c4h
+			ld	sp,iy
+			ld	(e1ffh),a
+			jp	(hl)
+			db	cdh,f1h,07h,fah,71h,11h,6ch,3bh
+			db	a1h,3bh,13h,33h,4fh,49h,12h,65h
+			db	08h,e1h,47h
+			adc	a,e
+			ld	b,c
+			inc	b
+			dec	de
+			ld	d,b
+			jp	c,Ld612
+			ld	hl,ebf7h
+			ld	(hl),d
+			xor	d
+			dec	(hl)
+			ld	(6088h),a
+			ld	e,e
+			sub	c
+			ld	(hl),e
+			jp	nc,Ld5bd
+			ld	d,b
+			sbc	a,bch
+			di
+			add	a,a
+			ld	b,c3h
+			jp	p,L179b
+			ld	a,(6f3ch)
+			sbc	a,l
+			add	a,(hl)
+			ld	sp,hl
+			add	a,h
+			jp	m,Lebaf
+			adc	a,l
+			ld	l,h
+			ld	l,b
+			ld	b,h
+			nop (2x) *
+			dec	d
+			add	a,d
+			ld	(e518h),hl
+			ld	l,h
+			add	hl,sp
+			ld	c,e
+			rst	00h
+			ld	d,(hl)
+			ld	c,d
+			call	m,L7af2
+			ex	(sp),hl
+			sbc	a,e
+			ld	a,b
+			xor	l
+			rst	30h
+			cp	b
+			or	c
+			ld	a,c
+			cp	c9h
+			and	65h
+			dec	e
+			sub	ceh
+			xor	d
+			and	c
+			call	m,L340e
+			jp	c,Ldf15
+			add	a,l
+			ld	b,d
+			sub	9bh
+			pop	af
+			halt
+			ld	(hl),c
+			inc	l
+			sbc	a,c
+			ld	l,h
+			sub	a
+			ld	c,l
+			add	hl,sp
+			jp	m,L7ffe
+			push	af
+			rst	28h
+			sbc	a,h
+			xor	h
+			dec	l
+			sbc	a,c
+			ld	h,b
+			ld	bc,3958h
+			or	e
+			inc	c
+			rst	10h
+			adc	a,e
+			add	a,e
+			or	b
+			ld	b,d
+			add	hl,sp
+			add	hl,de
+			ret	nz
+			ld	sp,hl
+			call	z,L9238
+			sub	(hl)
+			cp	h
+			add	hl,bc
+			jp	z,L0d73
+			adc	a,e
+			rlca
+			dec	b
+			out	(ffh),a
+			sbc	a,(hl)
+			rst	18h
+			ld	l,a
+			ld	c,b
+			or	d
+			ld	b,l
+			add	hl,hl
+			and	d
+			adc	a,b
+			adc	a,(hl)
+			xor	d
+			xor	(hl)
+			call	pe,Ldb95
+			pop	bc
+			cp	39h
+			ret	po
+			ld	c,l
+			push	de
+			ld	b,e
+			inc	h
+			ld	l,h
+			inc	d
+			dec	sp
+			add	hl,hl
+			and	d
+			ld	a,(68c0h)
+			ld	e,e
+			jr	z,Lb8fd
+			inc	h
+			jp	pe,Le3da
+			ld	a,c
+			ld	c,c
+			adc	a,e
+			nop (2x) *
+			rst	10h
+			inc	e
+			ld	a,(de)
+			ld	de,90abh
+			call	c,L47a8
+			ld	c,l
+			ld	h,c
+			call	pe,Ld7ad
+			ld	a,b
+			ret	m
+			or	e
+			inc	iyh *
+			ld	c,d
+			ld	e,e
+			ret	c
+			ld	(hl),a
+			ret	z
+			dec	e
+			adc	a,a
+			inc	a
+			ld	e,l
+			adc	a,a
+			sbc	a,l
+			xor	e
+			ld	(hl),l
+			or	b
+			sub	e
+			dec	l
+			adc	a,h
+			ld	(hl),43h
+			ld	sp,hl
+			ret	z
+			ld	h,a
+			or	l
+			dec	de
+			ld	c,h
+			ld	a,d
+			ld	(hl),c
+			xor	f2h
+			cp	l
+			rst	28h
+			push	af
+			ld	a,e
+			ld	h,d2h
+			xor	b
+			xor	c
+			adc	a,d
+			ld	h,h
+			add	a,b
+			cpl
+			adc	a,43h
+			add	a,e
+			adc	a,c
+			jp	nz,Lc7b7
+			ld	(hl),6ah
+			ret	nz
+			sbc	a,l
+			or	d
+			rst	28h
+			and	b
+			jp	m,L9c2c
+			ld	e,c
+			and	d
+			dec	h
+			adc	a,d
+			exx
+			inc	l
+			call	pe,L668a
+			ld	e,(hl)
+			ld	h,c
+			jp	pe,L5d30
+			ccf
+			ret	nc
+			ld	b,e1h
+			rlca
+			sub	e
+			ld	h,h
+			ld	e,d8h
+			and	b
+			ret	c
+			inc	a
+			or	e
+			call	m,Lbf89
+			ret	nc
+			ld	a,(de)
+			jp	po,Ld32e
+			xor	e
+			ld	b,(hl)
+			add	a,d
+			push	de
+			ld	l,e
+			rra
+			adc	a,l
+			add	hl,de
+			or	cah
+			ld	a,b
+			inc	d
+			sbc	a,e
+			inc	e
+			jp	(hl)
+			db	6ch,45h,bfh,89h,f9h,cdh,84h,0ah
+			db	37h,aah,e4h,eah,c8h,48h,66h,80h
+			db	a6h,37h,b1h,bdh,dbh,54h,0bh,f1h
+			db	36h,d8h,6eh,79h,05h,16h,8eh,57h
+			db	beh,40h,8ah,edh,31h,c1h,4ah,61h
+			db	04h,ech,85h,dbh,c8h,42h,dbh,f2h
+			db	35h,74h,98h,63h,03h,16h,2eh,61h
+			db	0fh,ceh,4ah,47h,8dh,05h,00h,b3h
+			db	bfh,28h,feh,9eh,3ah,99h,18h
+			ld	h,(hl)
+			add	a,17h
+			ld	e,a
+			ld	h,a8h
+			ld	b,d
+			add	a,c
+			ex	(sp),hl
+			add	a,d
+			set	3,l
+			dec	e
+			daa
+			sbc	a,d
+			ld	sp,e705h
+			adc	a,b
+			halt
+			call	po,Lf692
+			out	(13h),a
+			cp	c
+			ld	d,b
+			ld	a,(8577h)
+			ld	b,e
+			ld	sp,8da5h
+			dec	d
+			ld	d,e
+			dec	a
+			ld	sp,fe1bh
+			ld	(hl),b
+			rst	38h
+			ex	af,af'
+			ld	c,a
+			ld	a,(de)
+			ld	(hl),l
+			ld	a,e
+			rlca
+			call	po,L9dea
+			ld	l,d
+			ld	b,l
+			add	hl,hl
+			ld	a,4ah
+			sbc	a,12h
+			add	a,d
+			cp	4bh
+			ld	h,l
+			ld	(hl),l
+			sbc	a,d
+			halt
+			pop	bc
+			ld	h,h
+			call	L9335
+			ld	b,h
+			and	(hl)
+			ld	a,c
+			dec	a
+			call	m,L2650
+			ld	d,b
+			ld	e,l
+			ld	a,e
+			cp	e
+			rst	38h
+			dec	bc
+			ld	(4e79h),hl
+			ld	l,a
+			ld	l,e
+			ld	(de),a
+			cp	06h
+			ld	b,l
+			ld	l,l
+			or	e
+			ld	c,(hl)
+			xor	cch
+			ld	d,l
+			ld	c,l
+			inc	l
+			ld	a,e
+			ld	d,92h
+			add	hl,hl
+			sub	(hl)
+			sbc	a,b3h
+			out	(83h),a
+			call	pe,L3c3d
+			inc	sp
+			rla
+			jp	po,L2878
+			ld	(bc),a
+			or	(hl)
+			and	b
+			xor	b
+			sub	(hl)
+			ld	a,e
+			out	(41h),a
+			and	l
+			ld	b,b
+			ret
+			db	dfh,f0h,71h,19h,d8h,72h,c3h,7dh
+			db	c8h,beh,2bh,ddh,aah,72h,4bh,04h
+			db	cch,68h,e3h,e2h,d4h,1ah,2bh,c1h
+			db	87h,d2h,14h,d5h,ebh,94h,02h,51h
+			db	fdh,30h,07h,c1h,52h,dfh,8bh,aah
+			db	91h,2bh,a2h,57h,f5h,18h,71h,d1h
+			db	0ah,83h,5ch,38h,f1h,0bh,0eh,00h
+			db	3ch,2ah,37h,24h
+			rst	10h
+			ld	(hl),h
+			add	a,10h
+			ld	a,(057ah)
+			ld	(hl),h
+			ld	a,h
+			inc	h
+			ld	de,a907h
+			or	7dh
+			jr	z,Lba9a
+			ret	c
+			ld	h,d
+			ld	d,b
+			inc	b
+			push	de
+			halt
+			ex	af,af'
+			ld	d,h
+			set	6,h
+			rst	18h
+			xor	(hl)
+			inc	e
+			ld	d,e
+			ld	de,7781h
+			ret	nc
+			ret	nz
+			ld	b,18h
+			push	af
+			call	c,Le054
+			ld	sp,hl
+			ld	a,b
+			ret	c
+			cp	l
+			and	c
+			call	L8a42
+			adc	a,(hl)
+			rst	00h
+			adc	a,a
+			add	hl,sp
+			call	po,L8441
+			ret	nz
+			ld	c,b
+			sbc	a,c5h
+			rst	10h
+			rst	18h
+			call	po,Lfe03
+			ld	a,d
+			ld	(hl),a
+			call	m,Lbe73
+			inc	sp
+			ld	h,e
+			sbc	a,h
+			call	c,L78dd
+			sbc	a,l
+			sbc	a,h
+			ret	p
+			pop	de
+			add	hl,sp
+			ld	e,l
+			adc	a,h
+			xor	b
+			ld	h,h
+			cp	l
+			ret	nc
+			call	c,L15bc
+			call	po,L16e7
+			sbc	a,e
+			cpl
+			ld	e,b
+			rst	20h
+			sub	b
+			ld	b,a
+			add	hl,bc
+			or	c
+			ret	c
+			ld	bc,ac8fh
+			ld	e,b
+			ld	(hl),fbh
+			call	po,L81e1
+			jr	Lbaaf
+			db	63h,f5h,7bh,8eh,12h,89h,f0h,f2h
+			db	abh,14h,2eh,57h,e5h,25h,c0h,feh
+			db	a0h,b8h,99h,0fh,15h,95h,73h,05h
+			db	1ah,32h,f8h,8ch,e3h,6eh,2fh,a8h
+			db	dfh,dch,bch,ach,53h,c0h,f8h,5ch
+			db	02h,52h,47h,9bh,95h,c1h,13h,3fh
+			db	06h,73h,c3h,54h,50h,03h,36h,61h
+			db	9ah,51h,b4h,9eh,28h,41h,f7h,14h
+			db	9bh,19h,31h,63h,dah,08h,89h,28h
+			db	f2h,79h,22h,2bh,d5h,39h,37h,65h
+			db	c6h,51h,30h,ach,30h
+			ld	(hl),d
+			ld	b,e
+			ld	a,a
+			adc	a,a
+			adc	a,c
+			ld	(de),a
+			ld	d,d
+			adc	a,b
+			ld	b,l
+			and	b
+			or	e
+			jp	(hl)
+			db	86h,cdh,2dh,a2h,dbh,7eh,c2h,0ch
+			db	1dh,6eh,28h,9ch,64h,2bh,87h,f3h
+			db	a5h,e4h,b5h,f7h,fch,8eh,afh,a8h
+			db	03h,43h,66h,8bh,b2h,05h,0ch,41h
+			db	a3h,a3h,c2h,57h,c6h,83h,b0h,23h
+			db	ddh,d4h,83h,20h,fch,f2h,41h,88h
+			db	01h,9fh,e8h,afh,54h,cch,eeh,b9h
+			db	e0h,91h,00h,e7h,b8h,ceh,e4h,b4h
+			db	ech,99h,9dh,62h,bbh,eah,aah,c4h
+			db	f9h,b5h,4eh,cfh,3fh,3bh,51h,2ch
+			db	fdh,4ch,e7h,9dh,97h,d4h,07h,8dh
+			db	75h,0ah,1ch,62h,1ch,8eh,f5h,86h
+			db	c2h,3ah,3eh,1dh,d5h,9ah,25h
+			ld	b,h
+			add	hl,hl
+			add	hl,hl
+			dec	c
+			ld	bc,7074h
+			ld	d,11h
+			ld	c,d
+			ld	l,l
+			ld	a,h
+			ld	b,b
+			add	a,d
+			ld	d,(hl)
+			push	af
+			ld	(hl),b
+			adc	a,a
+			ex	(sp),hl
+			ld	d,a6h
+			pop	bc
+			or	b
+			jr	nc,Lbc34
+			add	a,b
+			sub	d
+			ld	b,d
+			rst	18h
+			inc	sp
+			ld	a,l
+			ld	hl,(7cd2h)
+			nop (2x) *
+			and	a
+			ld	(hl),b
+			ld	d,a
+			inc	a
+			ld	h,b
+			call	Ldf5b
+			rlca
+			ld	a,(de)
+			or	8ch
+			cp	c
+			inc	de
+			ld	sp,c638h
+			ld	sp,hl
+			sub	h
+			ld	(ff34h),hl
+			ld	l,h
+			sbc	a,l
+			halt
+			add	hl,hl
+			ld	hl,(8df5h)
+			adc	a,(hl)
+			ld	c,b
+			jp	p,L7b92
+			nop (2x) *
+			rra
+			scf
+			dec	sp
+			or	h
+			ld	a,l
+			ld	b,a
+			push	de
+			cp	l
+			inc	h
+			ld	l,7eh
+			cp	h
+			ret	c
+			add	a,d3h
+			ld	a,(hl)
+			cp	a
+			ld	c,d
+			sbc	a,a
+			ret	nc
+			jp	m,L6e82
+			ld	h,b
+			rst	20h
+			adc	a,h
+			ld	b,e
+			ld	(hl),6eh
+			out	(19h),a
+			or	h
+			cp	d
+			ld	a,ebh
+			ret	c
+			ret	z
+			ld	hl,d730h
+			ret	nz
+			ld	h,b
+			ld	(hl),c
+			ld	b,e
+			dec	l
+			adc	a,e
+			ld	h,(hl)
+			jp	nz,L7111
+			or	dah
+			add	hl,bc
+			call	p,L75ae
+			ld	h,(hl)
+			ld	sp,(5d58h)
+			ld	b,l
+			ld	h,(hl)
+			ld	l,(hl)
+			rst	30h
+			jp	nz,L56ce
+			ld	(hl),d
+			call	L0055
+			and	e
+			jp	m,L2dbe
+			inc	c
+			jp	z,Ld5a0
+			jr	c,Lbc6a
+			adc	a,b
+			ld	e,d
+			ld	(de),a
+			cp	b
+			ld	b,e
+			ld	e,a
+			nop (2x) *
+			call	z,Lf06f
+			adc	a,(hl)
+			sub	(hl)
+			ret
+			db	32h,a9h,4fh
+			ld	de,5ce4h
+			ld	a,(hl)
+			dec	e
+			call	m,Le7c3
+			jp	(hl)
+			db	74h,b2h,96h,2bh,7bh,feh,70h,feh
+			db	8ah,fah,b1h,45h,8fh,b0h,a6h,3dh
+			db	11h,1dh,85h,4ch,9dh,bbh,9ah,2fh
+			db	d3h,98h
+			ld	l,(hl)
+			sub	a
+			rrca
+			push	hl
+			add	a,e
+			jp	L3a49
+			db	82h,14h,f0h,ebh,d1h,42h,25h,97h
+			db	26h,b7h,53h,2eh,b7h,a7h,71h,14h
+			db	58h,cbh,beh,80h,9dh,3dh,dbh,71h
+			db	e9h,6eh,c1h,2fh,ebh,3ah,7ch,c3h
+			db	2ah,06h,a0h,b2h,75h,76h,7ah,38h
+			db	9ch,1fh,3dh,fbh,6bh,aah,82h,95h
+			db	5fh,68h,8eh,e5h,b0h,5bh,4ch,d3h
+			db	7eh,92h,afh,26h,d7h,deh,10h,17h
+			db	0dh,beh,afh,7ch,a3h,b0h,45h,60h
+			db	f8h,fah,70h,4ch,05h,eah,fch
+			ld	a,65h
+			rst	10h
+			ld	l,h
+			sbc	a,d
+			call	L1abb
+			ld	a,h
+			ld	d,a
+			dec	a
+			push	af
+			ld	b,h
+			exx
+			xor	d
+			jp	c,L322e
+			inc	l
+			pop	af
+			or	e
+			and	a
+			ld	hl,(f728h)
+			and	l
+			inc	de
+			ld	(hl),d
+			jp	p,L6488
+			xor	c
+			push	hl
+			dec	h
+			xor	35h
+			ld	e,d
+			and	l
+			inc	a
+			ld	b,(hl)
+			sbc	a,h
+			ld	d,h
+			push	af
+			xor	(hl)
+			or	45h
+			inc	c
+			push	de
+			cp	(hl)
+			cp	a
+			ld	l,e
+			xor	(hl)
+			sbc	a,l
+			sub	e
+			ld	d,b
+			ld	h,l
+			ld	e,c
+			inc	b
+			ld	b,59h
+			call	c,Lcf3d
+			or	a
+			dec	bc
+			di
+			cp	b
+			or	d
+			add	a,e
+			ld	c,h
+			or	h
+			inc	e
+			ld	d,(hl)
+			ld	a,d
+			ld	l,l
+			inc	b
+			push	bc
+			or	b
+			or	e
+			or	c
+			ld	a,b
+			pop	af
+			ld	a,a
+			add	a,e
+			xor	h
+			ld	(hl),l
+			ld	e,d
+			jp	L0ef5
+			db	b3h,ddh,3fh,89h,bch,82h,a4h,07h
+			db	a5h,bch,1dh,36h,35h,6bh,e8h,d0h
+			db	dah,fah,a7h,6bh,deh,6dh,5eh,fbh
+			db	73h,d5h,6ch,76h,0ah,41h,8ah,deh
+			adc	a,(hl)
+			ld	(hl),2dh
+			cp	5eh
+			ld	a,h
+			ld	l,l
+			or	a
+			adc	a,a
+			ld	a,c
+			ex	de,hl
+			cp	b
+			sbc	a,b
+			pop	bc
+			ld	h,a
+			rst	00h
+			ld	d,h
+			inc	hl
+			ld	d,7ch
+			cp	d
+			cp	c
+			ld	h,e
+			or	h
+			ld	a,(bc)
+			rst	08h
+			inc	hl
+			dec	a
+			dec	b
+			cp	l
+			ld	l,(hl)
+			rra
+			ld	a,a
+			pop	hl
+			ld	(hl),h
+			ld	(hl),b
+			sbc	a,h
+			add	a,(hl)
+			jp	z,L4d08
+			adc	a,a
+			ld	h,c
+			inc	de
+			ret	po
+			ld	hl,9d81h
+			or	e
+			rst	08h
+			add	a,c
+			adc	a,e
+			rlca
+			ld	h,c
+			pop	bc
+			nop (2x) *
+			nop
+			sub	(hl)
+			dec	(hl)
+			cp	e
+			ld	c,h
+			ld	a,18h
+			inc	b
+			call	pe,L80e5
+			xor	(hl)
+			adc	a,a
+			add	hl,hl
+			xor	a
+			ld	sp,hl
+			ld	(bc),a
+			ld	a,(de)
+			ret	nc
+			sbc	a,l
+			adc	a,c
+			adc	a,3dh
+			ld	b,(hl)
+			ld	e,l
+			cp	l
+			sub	l
+			ld	a,l
+			sbc	a,d
+			inc	de
+			ret	z
+			ld	(bc),a
+			out	(b0h),a
+			inc	h
+			sbc	a,d
+			push	hl
+			call	nz,Lc70c
+			and	(hl)
+			push	af
+			sub	bah
+			rst	20h
+			push	hl
+			ld	(hl),h
+			ex	(sp),hl
+			ld	d,h
+			ld	e,l
+			ex	af,af'
+			ld	c,l
+			ret	po
+			pop	de
+			ld	e,(hl)
+			ret	nc
+			ld	a,e
+			call	pe,L8555
+			ld	b,a
+			jr	Lbe11
+			db	41h,fch,b1h,d0h,27h,5bh,8fh,a9h
+			db	8fh,b6h,12h,e4h,abh,32h,63h,c7h
+			db	d1h,14h,bdh,4fh,7dh,c7h,f1h,dah
+			db	72h,c3h,0dh,15h,deh,edh,59h,b3h
+			db	b0h,c6h,42h,d5h,34h,22h,ceh,dfh
+			db	efh,68h,ceh,08h,4eh,89h,f4h,c2h
+			db	b6h,38h,8bh,60h,18h,7eh,ebh,96h
+			db	c1h,6eh
+			ld	b,(hl)
+			ld	hl,(8e6eh)
+			cp	l
+			add	a,b
+			sbc	a,e
+			ld	b,b
+			sbc	a,eeh
+			dec	de
+			ld	e,e
+			and	d
+			out	(bbh),a
+			jr	z,Lbe10
+			ld	b,(hl)
+			ld	b,c
+			dec	hl
+			or	d
+			ld	l,d
+			dec	de
+			call	z,L4e89
+			ret	p
+			ld	sp,4cb6h
+			adc	a,8ah
+			jp	pe,Ldee2
+			add	hl,sp
+			sub	b
+			xor	l
+			ld	d,c
+			ld	e,(hl)
+			and	d
+			add	a,b
+			adc	a,l
+			ret
+			db	f2h,63h,2ch,17h,89h,e8h,36h,2ch
+			db	dfh,e4h,49h,a3h,66h
+			dec	d
+			rst	38h
+			cpl
+			ld	a,(488ah)
+			ld	d,l
+			ld	l,l
+			rst	30h
+			jr	Lbe86
+			db	c2h,49h,39h,b9h,58h,f6h,d1h,bbh
+			db	9ch,b5h,4ch,fah,60h,69h,21h,5bh
+			db	4ch,10h,b8h,01h,24h,31h,61h,d7h
+			db	88h,61h,e0h,ach,f8h,2ch,abh
+			rst	38h
+			jr	z,Lbe81
+			rst	00h
+			or	a
+			and	47h
+			ld	d,7ah
+			inc	de
+			inc	h
+			ld	b,b
+			add	hl,sp
+			add	a,(hl)
+			ld	c,h
+			or	d
+			ld	a,a
+			rst	38h
+			ld	b,b
+			ret
+			ld	d,9fh
+			push	hl
+			and	b
+			ld	d,l
+			xor	(hl)
+			jp	c,Lc3c5
+			add	hl,sp
+			ld	l,fah
+			or	b
+			cp	c
+			ld	a,e
+			ld	h,l
+			add	a,(hl)
+			sbc	a,a
+			adc	a,h
+			ld	h,(hl)
+			inc	e
+			add	a,e
+			ld	(de),a
+			rrca
+			ld	sp,hl
+			call	nz,L203f
+			cp	h
+			or	h
+			adc	a,e
+			adc	a,l
+			adc	a,e2h
+			xor	c
+			add	a,a
+			and	c
+			dec	sp
+			and	b
+			ld	h,a
+			dec	bc
+			ld	(hl),77h
+			ld	c,c5h
+			adc	a,h
+			cp	a
+			ld	d,h
+			ld	e,a
+			ld	h,43h
+			ld	sp,hl
+			rst	10h
+			sub	05h
+			rst	28h
+			ld	c,h
+			add	a,l
+			add	a,(hl)
+			out	(15h),a
+			ld	c,b
+			sbc	a,e
+			ld	sp,hl
+			sbc	a,a
+			ld	(hl),c
+			adc	a,a
+			sbc	a,l
+			push	af
+			or	d
+			or	h
+			ld	h,b
+			add	a,e
+			dec	l
+			ld	l,b
+			ld	(hl),h
+			ld	(hl),d
+			xor	h
+			sbc	a,h
+			add	hl,sp
+			ld	a,a
+			ld	h,b
+			ccf
+			rla
+			sbc	a,b
+			sub	c
+			jr	c,Lbf52
+			dec	l
+			ld	b,e4h
+			push	bc
+			inc	bc
+			ld	l,l
+			ld	b,(hl)
+			ld	e,d
+			ld	d,d3h
+			dec	sp
+			or	c
+			dec	e
+			ld	h,b
+			cp	a
+			sub	d
+			call	c,L2e2a
+			add	a,e
+			in	a,(21h)
+			ld	a,h
+			or	88h
+			sub	e
+			ld	b,9fh
+			in	a,(dfh)
+			add	a,c
+			jr	c,Lbf2d
+			or	a
+			sbc	a,h
+			ld	c,d
+			ld	e,d
+			di
+			jp	pe,L2d9c
+			ei
+			ret
+			db	1bh,37h,1dh,b5h,69h,a5h,3fh,bdh
+			db	ach,8fh,35h,a2h,96h,bfh,09h,c7h
+			db	6eh,24h,f7h,5ch,f9h,c0h,4fh,51h
+			db	c3h,e5h,bch,e7h,d9h,60h,26h,7ah
+			db	54h,c9h,d3h
+			adc	a,b
+			ld	d,c
+			jp	z,L2514
+			jp	po,Lad8e
+			ld	h,d
+			call	p,Lcfbd
+			ld	(hl),h
+			call	z,Lef16
+			ld	c,(hl)
+			ld	(7ca8h),a
+			jp	po,L2e63
+			ret
+			db	91h,93h,d0h,34h,88h,2eh,74h,b9h
+			db	3ah,beh,0ch,f8h,1bh
+			add	hl,de
+			ld	b,l
+			adc	a,l
+			cp	a
+			ld	(115ch),hl
+			ld	e,l
+			ld	b,35h
+			ld	h,c
+			cp	32h
+			ld	h,a
+			dec	sp
+			add	a,a
+			ld	c,d
+			call	m,La465
+			and	b7h
+			ld	h,d
+			add	a,a
+			adc	a,(hl)
+			ld	c,d
+			add	a,(hl)
+			ld	d,a
+			ld	a,b
+			dec	(hl)
+			inc	bc
+			ld	h,b
+			inc	b
+			jp	nc,L9f26
+			adc	a,a
+			ld	e,b
+			ld	l,(hl)
+			pop	af
+			ld	b,(hl)
+			or	7ah
+			ld	(b167h),hl
+			ld	sp,hl
+			jp	m,L7994
+			add	a,h
+			and	a
+			inc	a
+			ld	h,3bh
+			call	po,L28e9
+			ld	(b6b6h),hl
+			call	p,Ladfe
+			dec	sp
+			push	hl
+			xor	e
+			cp	78h
+			or	(hl)
+			ld	b,(hl)
+			xor	d
+			sub	d
+			ld	d,b
+			sbc	a,h
+			jr	c,Lbf41
+			ld	d,c
+			ld	(7637h),a
+			ld	h,e
+			inc	hl
+			xor	(hl)
+			sbc	a,a
+			xor	c8h
+			sbc	a,b
+			ret
+			db	c8h,23h,aeh,84h,bah,70h,b3h,14h
+			db	8dh,c0h,97h,24h,8dh,26h,37h,4dh
+			db	0bh,32h,30h,46h,09h,e7h,e5h,fbh
+			db	4fh,7fh,82h,e4h,09h,6bh,83h,40h
+			db	e6h,7ah,4bh,66h,85h,d2h,6bh,a0h
+			db	aah,4ah,adh,f1h,eah,ffh,abh,78h
+			db	c1h,aah,46h,b9h,5ah,f9h,3eh,12h
+			db	fbh,f7h,3dh,a1h,45h,14h,3bh,d7h
+			db	64h,7eh,a2h,50h,7dh,29h,4ch,0eh
+			db	d3h,5dh,cah,abh,10h,bdh,87h,fah
+			db	e8h,32h,c0h,bch,bbh
@@ -0,0 +1,7435 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	59h,fch,2dh,a7h,2fh,4ch,6bh,b4h
+			db	abh,e2h,4ch,26h
+
+start:						; execution starting point
+			ret	z
+			ld	e,e
+			cp	c
+			inc	h
+			ld	e,l
+			ld	c,a
+			ld	l,7bh
+			cp	a
+			inc	bc
+			add	hl,hl
+			ld	l,c
+			ld	d,l
+			ld	a,(hl)
+			adc	a,h
+			xor	e
+			djnz	L4045
+			djnz	L3ff7
+			sub	l
+			ld	d,e
+			in	a,(e9h)
+			ld	c,a
+			dec	c
+			add	hl,sp
+			ld	(hl),h
+			ld	l,d
+			ld	a,8ah
+			adc	a,c
+			sbc	a,a
+			ld	(hl),b
+			ld	h,b
+			dec	a
+			jp	m,L3a23
+			inc	e
+			push	af
+			ld	e,e
+			ld	hl,3637h
+			ld	l,(hl)
+			jp	pe,L4572
+			push	af
+			ld	(hl),b
+			dec	l
+			inc	hl
+			ld	c,c
+			ld	b,e
+			inc	a
+			ld	(hl),b
+			ccf
+			or	96h
+			add	hl,hl
+			sbc	a,(hl)
+			cp	(hl)
+			call	c,L7d58
+			ret	p
+			ld	(d295h),hl
+			cp	h
+			and	c
+			xor	b
+			ld	a,(hl)
+			ld	l,(hl)
+			ld	b,c
+			ret	nc
+			xor	1eh
+			ret
+			db	88h,b4h,d5h,7ah
+			ld	a,h
+			ld	a,h
+			inc	de
+			ld	e,a
+			ld	c,b
+			or	h
+			push	de
+			ld	l,beh
+			xor	h
+			sbc	a,d
+			exx
+			ld	a,r
+			ld	c,97h
+			ret	c
+			jp	L97b1
+			inc	(hl)
+			sub	d
+			inc	b
+			ld	b,dch
+			ld	e,b
+			jp	L4913
+			db	3dh,28h,03h,5eh,39h,c2h,73h,b5h
+			db	45h,d0h,e7h,e9h,2dh
+			sbc	a,e9h
+			inc	sp
+			ld	h,l
+			and	d3h
+			ld	(hl),e4h
+			ld	e,c
+			ld	e,b
+			inc	bc
+			sbc	a,d
+			ld	a,l
+			call	po,L8093
+			sbc	a,l
+			jp	L6296
+			db	4fh,86h,8ah,30h,08h,73h,3eh,46h
+			db	d8h,a4h,68h,a9h,52h,e3h,d2h,38h
+			db	45h,74h,b8h,5ch,c8h
+			ret	z
+			or	(hl)
+			and	a
+			ld	h,b
+			ld	d,c
+			sbc	a,l
+			ld	l,a
+			dec	b
+			inc	sp
+			ld	e,c
+			ld	e,(hl)
+			ex	af,af'
+			ex	de,hl
+			jp	Lf179
+			db	77h,a8h,0fh,15h,97h,0dh,c4h,dfh
+			db	53h,ffh,c0h,29h,50h,eeh,4bh,abh
+			db	95h,9dh,72h,cdh,c9h,17h,28h,91h
+			db	28h,fch,f4h,fah,8ch,a1h,b0h,37h
+			db	f6h,90h,7ah,bfh,31h,4eh,61h,17h
+			db	ebh,4fh,63h,2bh,0eh,dch,75h,6eh
+			db	39h,a9h,afh,93h,90h
+			call	p,L9c5d
+			push	hl
+			ld	c,d
+			and	05h
+			ld	hl,(5b95h)
+			sbc	a,(hl)
+			ld	c,h
+			sbc	a,e
+			ld	a,c
+			add	hl,bc
+			and	(hl)
+			jr	z,L40b7
+			sbc	a,6eh
+			jp	p,L0e9a
+			ld	(hl),8fh
+			xor	3dh
+			call	po,Le4d4
+			adc	a,c
+			call	c,L2877
+			sbc	a,h
+			ld	(hl),h
+			ld	e,b
+			rst	30h
+			jp	c,L4ece
+			ld	c,e
+			ld	(hl),b
+			ret	po
+			adc	a,l
+			ld	e,c
+			rst	38h
+			rst	08h
+			daa
+			ld	(a854h),hl
+			ret	p
+			ld	(b65ah),a
+			call	po,L244e
+			call	p,Ld168
+			call	nc,Lde0c
+			daa
+			ret	nz
+			ld	h,b
+			call	nz,Ladc9
+			push	de
+			add	a,l
+			inc	de
+			adc	a,e
+			ld	a,95h
+			ld	h,d
+			in	a,(e3h)
+			add	hl,hl
+			ld	a,33h
+			jr	nc,L41b6
+			ld	hl,11cfh
+			ccf
+			adc	a,b
+			xor	a
+			ld	e,l
+			ld	c,l
+			call	nc,Ld7f5
+			di
+			add	a,l
+			ld	d,e
+			and	h
+			jr	nz,L4173
+			ld	h,(hl)
+			push	hl
+			ld	e,l
+			call	p,L96ee
+			cp	h
+			and	l
+			or	a
+			ld	h,h
+			rla
+			xor	d
+			ld	b,(hl)
+			and	b
+			ccf
+			xor	b
+			ld	l,c
+			ld	d,b
+			xor	l
+			jp	po,L269d
+			ret	m
+			ld	d,5ch
+			ld	sp,86d5h
+			cp	l
+			and	a
+			jp	nz,Ld0ba
+			cp	h
+			ld	c,l
+			rrca
+			ld	e,l
+			push	af
+			sbc	a,l
+			ld	(hl),h
+			ret	p
+			inc	l
+			nop (2x) *
+			jp	L7eba
+			db	66h,b2h,23h,41h,b0h,b5h,16h,f0h
+			db	b3h,2ah,52h,50h,f9h,d6h,fbh,f1h
+			db	77h,2eh,f3h,2ah,b7h,a2h,9ch,17h
+			db	2ah,72h,d0h,dbh,a4h,bdh,0ch
+			ex	af,af'
+			ld	(e102h),hl
+			ld	h,e
+			xor	a
+			cp	a
+			jr	c,L416c
+			ei
+			add	a,ddh
+			ld	a,d
+			and	d
+			jr	nz,L422c
+			sub	c
+			or	82h
+			jr	c,L415f
+			add	hl,de
+			ld	d,e
+			ld	l,d
+			jr	nc,L41af
+			jp	nc,Ldd6e
+			sub	c
+			ld	c,d
+			ld	b,a
+			ld	h,4ch
+			inc	hl
+			ld	l,b
+			jp	nz,L6894
+			ld	l,d
+			xor	h
+			add	hl,de
+			scf
+			ld	d,d
+			add	a,e3h
+			ld	(49a1h),a
+			sbc	a,h
+			jp	nc,Lac2f
+			cp	(hl)
+			ld	(hl),c
+			rra
+			add	a,l
+			cp	97h
+			ld	(hl),l
+			ld	(67fah),hl
+			inc	a
+			ld	(hl),l
+			sbc	a,b
+			xor	e
+			ld	b,11h
+			ret	nc
+			rst	08h
+			inc	d
+			ld	de,97bfh
+			ld	a,13h
+			jp	(hl)
+			db	49h,a0h,1fh,56h,33h,11h,21h,00h
+			db	5fh,01h,0ch,6ah,fbh,70h,0ah,95h
+			db	11h,12h,b1h,2ah,10h,24h,afh,eah
+			db	46h,7ch,3eh,51h,74h,31h,2dh,42h
+			db	1ah,a7h,c8h,46h,afh,cah,a4h,0eh
+			db	85h,b1h,a9h,56h,54h,a7h,dbh
+			add	hl,hl
+			ex	de,hl
+			sub	7fh
+			ld	e,c
+			or	d
+			add	hl,bc
+			sub	c
+			jp	c,L54c3
+			rrc	b
+			sub	b
+			xor	d
+			add	a,a
+			add	a,c
+			ret	nz
+			jr	L41c0
+			db	7bh,eah,8ch,28h,90h,b5h,9eh,7fh
+			db	beh,e7h,bah
+			add	a,h
+			ld	e,a
+			ex	de,hl
+			ld	(c294h),a
+			sub	l
+			and	c
+			ld	l,b
+			sbc	a,a1h
+			and	a
+			cp	d
+			ld	d,h
+			sub	c2h
+			adc	a,a
+			adc	a,l
+			ld	h,c
+			ld	c,(hl)
+			adc	a,l
+			ld	(hl),h
+			ex	(sp),hl
+			ld	(hl),h
+			and	c
+			xor	ebh
+			ld	e,c
+			ex	af,af'
+			ld	l,d
+			call	nz,Lbeb4
+			ld	h,d
+			ld	e,e
+			ld	a,h
+			djnz	L42b2
+			inc	b
+			adc	a,h
+			sub	cbh
+			or	89h
+			jr	nz,L424e
+			sbc	a,iyh *
+			jr	c,L42ed
+			jp	nc,L8cb6
+			jp	p,L4cd6
+			rst	38h
+			dec	l
+			inc	hl
+			adc	a,b
+			ld	(hl),66h
+			ld	a,(4d09h)
+			ld	d,c
+			ld	h,a
+			ld	d,h
+			and	l
+			inc	bc
+			dec	bc
+			add	a,l
+			dec	d
+			ld	(hl),e
+			sub	b
+			in	a,(92h)
+			add	a,a
+			jr	nz,L4299
+			ld	a,75h
+			ex	(sp),hl
+			ld	l,a
+			sbc	a,d
+			call	pe,Lbac5
+			daa
+			cp	h
+			call	m,L2c72
+			ret	m
+			ld	h,b
+			ld	a,b
+			jp	pe,L74d7
+			ld	h,a
+			jp	p,Lde16
+			dec	l
+			djnz	L42f4
+			sub	(hl)
+			or	l
+			or	c
+			dec	hl
+			ld	(db1ch),a
+			ld	l,(hl)
+			ld	e,a
+			sbc	a,a
+			ld	sp,afa9h
+			or	(hl)
+			call	c,L6d2d
+			and	e
+			adc	a,e
+			xor	c
+			adc	a,a
+			inc	(hl)
+			dec	(hl)
+			jp	z,L3ff4
+			add	a,ddh
+			ld	a,(bc)
+			ld	b,e
+			sbc	a,e
+			sbc	a,d
+			cp	d
+			inc	d
+			ld	c,l
+			ret	po
+			add	hl,de
+			ld	d,9eh
+			inc	l
+			rst	18h
+			jp	nc,L0b93
+			cp	e
+			cp	(hl)
+			sub	b
+			sbc	a,c
+			and	11h
+			pop	hl
+			xor	39h
+			ld	d,b
+			ld	h,d
+			rlca
+			sub	e
+			add	a,a
+			ld	hl,(cf2eh)
+			cp	l
+			dec	h
+			and	d
+			sbc	a,a
+			ld	e,d
+			ld	sp,hl
+			ld	d,17h
+			ld	h,f5h
+			push	de
+			rrca
+			ld	d,c
+			adc	a,c5h
+			ld	l,c
+			inc	b
+			ld	e,a
+			pop	bc
+			rla
+			rra
+			rrc	d
+			jp	z,L1be9
+			jp	pe,L5c47
+			ld	a,b
+			sbc	a,77h
+			inc	a
+			ld	(8998h),hl
+			inc	a
+			and	d
+			ld	c,h
+			push	af
+			adc	a,(hl)
+			adc	a,l
+			sub	h
+			ld	(hl),a
+			ld	l,h
+			cp	h
+			ld	e,(hl)
+			rst	20h
+			dec	de
+			sbc	a,l
+			ld	b,c
+			ex	af,af'
+			ld	h,h
+			sbc	a,(hl)
+			or	a
+			or	b7h
+			ret	c
+			cp	d
+			ld	d,b
+			rst	10h
+			ret	pe
+			ld	h,h
+			ld	l,b
+			ex	de,hl
+			dec	de
+			push	hl
+			xor	71h
+			add	a,l
+			rra
+			scf
+			ld	e,d
+			sub	e
+			cp	e
+			and	a
+			jp	Le4cc
+			db	95h,44h,08h,a3h,bah,a1h,d3h,a4h
+			db	2dh,88h,c6h,4ch,2bh,25h,87h,0eh
+			db	cfh,c1h,0dh,2ah,28h,e9h,8bh,38h
+			db	ach,28h,84h,6fh,1ah,96h,44h,d0h
+			db	04h,30h,e6h,3bh,c3h,1dh,edh,bdh
+			db	eeh,87h,0dh,b1h,90h,c6h,8dh,81h
+			db	93h,a4h,93h,38h,1eh,cdh,c0h,78h
+			db	3eh,d1h,c1h,7ch,28h,12h,e9h,26h
+			db	7eh,a3h,fdh,d3h,25h,bah,0ah,1dh
+			db	e6h,6ah,dfh,29h,fbh,29h,cbh,2eh
+			db	b8h,dbh,adh,2dh,10h,f0h,1fh,44h
+			db	5ah,a5h,85h,70h,70h,d4h,88h,76h
+			db	f5h,e2h,d8h,8ah,2ch,68h,e6h,7ah
+			db	5eh,97h,9eh,35h,cbh,a5h,b1h,79h
+			db	8bh,c2h,a1h
+			ex	de,hl
+			add	a,l
+			sub	a
+			inc	(hl)
+			adc	a,(hl)
+			ld	l,d
+			dec	de
+			ld	c,56h
+			ld	d,23h
+			sbc	a,a
+			ld	c,(hl)
+			jp	nc,L1cd1
+			dec	de
+			jp	c,Lee87
+			add	hl,de
+			ret	p
+			ld	d,(hl)
+			jp	p,L1662
+			di
+			jp	m,Ld671
+			ld	e,l
+			or	b
+			ex	(sp),hl
+			push	hl
+			xor	d8h
+			add	a,(hl)
+			xor	d
+			sub	h
+			ld	h,(hl)
+			jr	nc,L4409
+			rst	28h
+			ld	c,a
+			exx
+			cp	e
+			add	a,b
+			nop (2x) *
+			push	bc
+			add	a,e
+			xor	e
+			call	m,L566c
+			sub	b
+			rst	00h
+			sub	c
+			ld	e,c
+			ld	c,l
+			push	bc
+			ld	sp,ff87h
+			cp	h
+			ld	h,d
+			dec	a
+			ld	e,a
+			sub	a
+			ld	b,f1h
+			ld	(hl),h
+			ld	e,b
+			ld	l,(hl)
+			add	a,c
+			ld	(hl),e
+			add	hl,hl
+			jp	m,Lb305
+			ld	h,b
+			adc	a,b
+			ld	e,e1h
+			add	a,h
+			in	a,(c6h)
+			push	bc
+			xor	l
+			ld	h,l
+			ex	(sp),hl
+			jp	(hl)
+			db	e0h,c0h,d6h,97h,b1h,87h,5dh,25h
+			db	41h,13h,43h,d9h,34h,66h,adh,7eh
+			db	efh,5ah,aeh,89h,76h,31h,77h,a7h
+			db	85h,9bh,a3h,52h,c3h,64h,33h,bch
+			db	0dh,8eh,1dh,a6h,0bh,05h,f2h,9bh
+			db	55h,89h,e3h,f6h,efh,00h,25h,75h
+			db	20h,32h,a4h,80h,5eh,88h,68h
+			ld	l,l
+			and	h
+			ld	b,h
+			ld	h,b8h
+			ld	c,e
+			jp	nz,Ld7fa
+			ld	a,l
+			ld	e,b
+			jp	p,L64b3
+			or	c
+			ld	h,l
+			ret	nc
+			xor	c
+			call	pe,La33d
+			cp	a
+			ld	h,a
+			dec	(hl)
+			halt
+			nop
+			dec	a
+			or	c
+			sbc	a,(hl)
+			ld	b,l
+			ld	h,b
+			ret	nc
+			ld	hl,(4a8eh)
+			ld	l,e
+			sbc	a,(hl)
+			rst	10h
+			sub	b
+			rst	30h
+			pop	af
+			pop	bc
+			rst	00h
+			ld	l,b
+			rst	20h
+			dec	bc
+			sbc	a,a
+			sbc	a,l
+			rst	20h
+			jp	nc,L9860
+			pop	hl
+			rst	18h
+			or	c
+			add	a,d
+			dec	b
+			jp	nz,Lc0c5
+			adc	a,d
+			ld	h,e
+			sub	d
+			and	h
+			ld	a,b
+			sbc	a,(hl)
+			and	b
+			ld	b,h
+			ld	c,e
+			ld	b,h
+			or	c
+			add	hl,sp
+			cp	h
+			add	a,l
+			ld	(hl),h
+			sbc	a,3ah
+			ex	af,af'
+			cp	c
+			add	a,l
+			inc	bc
+			pop	bc
+			ret	c
+			and	h
+			ret	p
+			sbc	a,d
+			scf
+			xor	e
+			ld	a,e
+			adc	a,e
+			ex	(sp),hl
+			adc	a,e
+			dec	h
+			ret	nz
+			rst	30h
+			jp	(hl)
+			db	1ah,77h,e1h,4dh,dbh,8dh,c4h,4fh
+			db	c3h,1eh
+			adc	a,26h
+			ret	z
+			rst	20h
+			jp	(hl)
+			db	98h,e6h,d2h,feh,81h,58h,f4h,64h
+			ld	e,26h
+			inc	sp
+			and	e
+			rlca
+			ld	c,e
+			ld	l,b
+			ld	b,h
+			ld	a,(hl)
+			ld	h,c
+			ld	d,c
+			ld	e,22h
+			add	hl,bc
+			ld	(hl),b
+			push	bc
+			jp	pe,Ld2c1
+			jp	po,Leefa
+			ld	sp,70c3h
+			adc	a,a
+			ld	d,h
+			xor	d
+			adc	a,d
+			dec	hl
+			exx
+			ld	a,b
+			daa
+			ret	m
+			jp	L9c1b
+			db	bah,5dh,e6h,50h,47h,43h,77h,9dh
+			db	e2h,bdh,c2h,eah,29h,21h,57h,35h
+			db	deh,83h,b9h,c2h,d5h,11h,49h,6bh
+			db	beh,c5h,7dh,0ch,beh,b0h,15h,53h
+			db	9bh,99h,8ch,9eh,02h,cah,55h,adh
+			db	e9h,60h,83h,29h,e0h,45h,e1h,9ah
+			db	20h,b2h,fdh,69h,b9h,4fh,c2h,2bh
+			db	81h,5dh,97h,4dh,5dh,77h,3fh,f2h
+			db	42h,07h,50h,e0h,30h,b1h,5ch,a9h
+			db	e0h,c4h,eah,9eh,f2h,90h,73h,37h
+			db	f4h,9bh,2bh,a5h,aeh,bah,a0h,14h
+			db	1dh,bfh,78h,f7h,ech,f2h,aeh,f7h
+			db	e0h,1ch,29h,37h,8dh,a3h,21h,02h
+			db	d0h,37h,ebh,e4h,9eh,d1h,56h,73h
+			db	5ah,77h,31h,7dh,7eh,7ah,79h,90h
+			db	f8h,eeh,6ah,bch,7ch,dah,dfh,c9h
+			db	75h,c7h,f8h,60h,afh,f7h,36h,70h
+			db	16h,02h,c7h,06h,e4h,82h,6fh
+			ld	(de),a
+			rrca
+			ld	l,h
+			rst	18h
+			nop (2x) *
+			ex	de,hl
+			inc	c
+			add	a,b
+			dec	bc
+			inc	b
+			xor	l
+			xor	d
+			cp	h
+			ret	z
+			inc	e
+			ld	c,cah
+			ld	d,d4h
+			or	c
+			jp	z,Ldb49
+			ld	de,d3d8h
+			ld	b,c
+			ld	de,0fa0h
+			call	m,Lda35
+			cp	l
+			ld	c,d
+			ld	c,h
+			call	m,L8461
+			inc	hl
+			ret	nz
+			ld	a,a
+			rst	30h
+			push	hl
+			ld	b,(hl)
+			ld	a,(c2b3h)
+			ld	bc,b658h
+			ld	sp,e9c3h
+			ld	b,04h
+			or	e
+			ld	h,64h
+			ret	z
+			exx
+			xor	b
+			ld	c,e
+			add	a,b
+			jp	m,Lf53f
+			jr	nz,L45bd
+			sub	(hl)
+			inc	sp
+			ld	a,(bc)
+			ld	l,82h
+			ld	b,a
+			add	a,d
+			cpl
+			add	hl,hl
+			inc	de
+			ld	h,b7h
+			ld	e,d
+			add	hl,hl
+			add	a,c
+			sbc	a,h
+			ld	c,h
+			inc	(hl)
+			jr	L462b
+			db	b6h,88h,3eh,48h,00h,99h,b3h,f1h
+			db	2dh,25h,b5h,91h,b1h,64h,efh,2ah
+			db	e0h,21h,bdh,a4h,a5h,9ch,60h,7ch
+			db	92h,9fh,7ch,6fh,4ah,5fh,04h,d8h
+			db	a6h,71h,d1h,d7h,52h,c3h,3ah,f9h
+			db	95h,60h,9fh,b1h,c7h,54h,21h,3fh
+			db	15h,90h,46h,1fh,91h,93h,1ch,74h
+			db	d7h,4bh,bfh,efh,9ah,7dh,5eh,7ch
+			db	c2h,48h,d3h,68h,2dh,12h,54h,25h
+			db	e7h,a8h,12h,9fh,c2h,f5h,3bh,89h
+			db	02h,2bh
+			adc	a,73h
+			add	a,l
+			jp	L606d
+			pop	af
+			xor	d
+			ld	h,a6h
+			ld	(hl),l
+			ld	sp,8960h
+			add	a,c
+			sbc	a,e
+			ld	(58bdh),a
+			xor	d
+			sub	h
+			sub	c
+			rst	18h
+			call	nz,Ldb9c
+			ld	c,c
+			ret	po
+			ld	a,b
+			sub	l
+			ld	c,c
+			call	nz,L8473
+			ld	l,a
+			ld	d,d
+			ld	a,(hl)
+			rst	30h
+			ld	sp,9bc6h
+			xor	e
+			di
+			in	a,(82h)
+			or	a
+			sbc	a,a
+			jr	nc,L4623
+			xor	a
+			call	nz,L2917
+			sbc	a,h
+			ld	c,l
+			ld	d,e
+			ld	c,l
+			ld	(hl),e
+			sbc	a,b
+			inc	b
+			ld	l,l
+			add	hl,de
+			inc	l
+			and	c
+			ld	l,(hl)
+			pop	de
+			jp	c,L7f1c
+			nop (2x) *
+			ld	a,e
+			ld	a,(de)
+			ld	c,(hl)
+			ld	b,(hl)
+			rst	00h
+			inc	e
+			add	a,e
+			ret	c
+			ret
+			db	9fh,82h,ebh,10h,31h,15h,8dh,50h
+			db	5fh,54h,08h,66h,0dh,49h,51h,c7h
+			db	d9h,bah,67h,72h,2bh,c2h,cbh,d0h
+			db	53h,83h,5eh,d7h,52h,13h,a0h,38h
+			db	8bh,4eh,7eh,1dh,23h,a3h,1dh,47h
+			db	52h,34h,f6h,2ch,9fh,fah,abh,ddh
+			db	b9h,72h,f9h,20h,d5h,c4h,9ch,aeh
+			db	4ah,8fh
+			sbc	a,c
+			ret	pe
+			djnz	L46f0
+			sbc	a,b
+			and	d
+			ret	po
+			sub	e
+			xor	25h
+			ret	m
+			ld	d,h
+			scf
+			jp	z,L02c4
+			di
+			rlca
+			add	hl,sp
+			pop	de
+			sbc	a,a
+			cp	e
+			xor	d
+			in	a,(57h)
+			ld	a,(f066h)
+			sbc	a,l
+			nop (2x) *
+			ld	a,a
+			ld	e,h
+			cp	b
+			ret	po
+			cp	b
+			inc	hl
+			ret	nz
+			jp	c,L7540
+			dec	c
+			ld	d,h
+			add	hl,hl
+			ld	sp,77fch
+			inc	b
+			daa
+			dec	h
+			and	c
+			and	d
+			pop	af
+			sbc	a,l
+			xor	h
+			pop	af
+			add	a,a8h
+			sub	b
+			nop (2x) *
+			jr	L46a6
+			db	0ah,34h,01h
+			push	hl
+			daa
+			adc	a,b
+			dec	h
+			or	c
+			ld	(hl),d
+			ld	c,e
+			adc	a,(hl)
+			or	b
+			nop (2x) *
+			push	bc
+			adc	a,(hl)
+			call	c,L8cd9
+			rra
+			ld	(hl),h
+			dec	b
+			or	(hl)
+			ld	(c128h),hl
+			pop	hl
+			xor	(hl)
+			dec	de
+			ld	(de),a
+			ld	e,l
+			sbc	a,b
+			or	a
+			ld	l,d
+			ld	a,b3h
+			rst	28h
+			pop	bc
+			and	e
+			pop	hl
+			ld	(hl),42h
+			ld	d,a
+			and	c
+			add	a,l
+			cp	(hl)
+			and	h
+			ld	d,d
+			ld	(hl),d
+			sub	h
+			call	nz,L776d
+			pop	af
+			sbc	a,a
+			ld	l,h
+			ld	(hl),d
+			rst	30h
+			ld	b,c3h
+			inc	(hl)
+			and	79h
+			sub	a
+			ld	c,d
+			and	c
+			xor	10h
+			ld	hl,(7bb0h)
+			rst	28h
+			jp	nz,L9a95
+			add	a,a
+			ld	a,e
+			sbc	a,c2h
+			ei
+			cp	c
+			jr	c,L46bf
+			inc	d
+			ld	d,d
+			and	(hl)
+			ld	b,l
+			ld	a,c
+			adc	a,edh
+			ld	b,(hl)
+			xor	d
+			sbc	a,h
+			call	m,L46e7
+			add	hl,de
+			sub	iyl *
+			adc	a,c
+			dec	d
+			ld	c,h
+			ld	a,e
+			ld	c,d
+			ld	c,l
+			ld	a,l
+			ld	d,d
+			add	hl,hl
+			ld	b,e
+			exx
+			ld	b,a
+			ld	e,d
+			or	c
+			xor	(hl)
+			cp	c
+			xor	l
+			ld	hl,(f00ch)
+			cpl
+			or	e
+			and	e
+			add	a,c
+			jr	nz,L4754
+			jp	m,L7f6e
+			xor	b
+			ld	(8a09h),hl
+			ld	b,h
+			sub	e
+			add	a,(hl)
+			ld	d,a6h
+			inc	bc
+			call	pe,L0296
+			ld	l,a
+			cp	h
+			rst	20h
+			ld	h,e
+			and	(hl)
+			jr	c,L471a
+			and	c
+			ld	e,l
+			xor	d
+			rla
+			and	l
+			ld	d,a
+			jp	(hl)
+			db	6eh,02h,53h,2eh,72h,6fh,7bh,69h
+			db	dbh,76h,f5h,b0h,2bh,9fh,7fh,87h
+			db	02h,c7h,55h,b4h,18h,d9h,a9h,0ch
+			db	36h,cch,78h,7ch,77h,f3h,7ch,dbh
+			db	a1h,92h,1dh,9ch,92h,4ah,ech,ffh
+			db	e7h,97h,fdh,5ch,9eh,56h,41h,bfh
+			db	7fh,bbh,29h,9dh,59h,53h,c0h,43h
+			db	d2h,d2h,b5h,46h,07h,56h,11h,2ah
+			db	e6h,95h,feh,1ah,fch,eeh,28h,b0h
+			db	b5h,dfh,6bh,01h,b0h,81h,63h,07h
+			db	18h,c3h,0ch,e8h,39h,3ch,8dh,00h
+			db	65h,9eh,c1h,84h,88h,44h,67h,adh
+			db	44h,11h,8fh,2ch,45h,8ah,57h,eah
+			db	83h,73h,25h,8ch,a7h,5bh,86h,82h
+			db	1fh,5ah,4fh,0eh,edh,17h,65h,53h
+			db	c8h,23h,f7h,3bh,ech,bfh,aeh,78h
+			db	3fh,72h,40h,25h,7ch,e8h,c2h
+			ret
+			db	cch,a9h,97h,33h,98h,11h,f3h,71h
+			db	a0h,66h
+			ld	e,e
+			adc	a,d
+			add	a,a
+			adc	a,(hl)
+			ld	(hl),h
+			push	de
+			di
+			inc	hl
+			rr	b
+			cp	l
+			rst	10h
+			ret
+			db	2fh,a6h,9ch,6ch,16h,dch,5bh,d7h
+			db	86h,81h,f3h,91h,a1h,3bh,d1h,93h
+			db	0dh,1ah,d1h,03h,18h,04h,42h,97h
+			db	11h,03h,ceh,b3h,62h,3ah,4fh,7fh
+			db	70h,6ch,00h,26h,4eh,f7h,cfh,25h
+			db	75h,70h,d2h,02h,48h,52h,1dh,4eh
+			db	f1h,50h,08h,3dh,1dh,eah,78h,7fh
+			db	8ch,92h,08h,38h,f7h,60h,bbh,23h
+			db	f2h,0dh,45h,56h,aeh,eeh,1bh,88h
+			db	0ch,b6h,1fh,a9h,1ah,48h,66h,1bh
+			db	28h,5eh,abh,12h,26h,26h,92h,63h
+			db	ech,b3h,d7h,45h,0ch,c0h,8ah,89h
+			db	39h,21h,5ah,89h,bch,96h,11h,51h
+			db	9ch,aeh,53h,b8h,59h,55h,55h,b6h
+			db	02h,ach,4dh,51h,68h,f4h,d2h,d1h
+			db	18h,81h,9dh,0ah,ach,7dh,20h,09h
+			db	02h,4ch,39h,09h,21h,70h,aah,56h
+			db	d9h,c9h,d6h,20h,9fh,e4h,aeh,11h
+			db	e1h,abh,98h,63h,eeh,10h,f5h,35h
+			db	39h,c7h,f6h,59h,a9h,d6h,a8h,b9h
+			db	15h,0ch,b3h,12h,a2h,a3h,7fh,33h
+			db	ffh,35h,94h,69h,22h,f6h,e6h,bch
+			db	71h,57h,7eh,f5h,6ch,d1h,86h,bah
+			db	cfh,08h,47h,b1h,01h,adh,63h,16h
+			db	deh,41h,b4h,1fh,8fh,8fh,2eh,89h
+			db	d1h,04h,5ch,77h,adh,63h,6dh,8dh
+			db	a1h,00h,b2h,23h,50h,2ch,0ah,ffh
+			db	66h,bch,66h,d7h,f6h,13h,f5h,e7h
+			db	2ah,dch,49h,a4h,11h,6dh,45h,83h
+			db	e6h,c3h,ddh,c5h,34h,62h,34h,dah
+			db	8dh,d7h,48h,b5h,c0h
+			ld	d,a
+			dec	b
+			push	af
+			or	c
+			ld	e,e
+			cp	l
+			ret
+			db	7ah,afh,dah,3bh,05h,2ah,ebh,91h
+			db	5dh
+			cp	a
+			rrca
+			jp	c,L6636
+			ld	d,(hl)
+			ret	c
+			sub	(hl)
+			ld	c,e
+			ld	(hl),c
+			ld	d,c
+			ld	e,a
+			xor	c
+			di
+			or	h
+			inc	(hl)
+			sub	bfh
+			sbc	a,h
+			sub	b
+			call	pe,Lb254
+			dec	l
+			cp	l
+			ld	b,35h
+			cp	l
+			ret	c
+			add	a,d
+			jp	p,L72f7
+			ld	l,(hl)
+			call	po,L4946
+			adc	a,a
+			ret	nz
+			dec	b
+			add	a,d
+			call	nz,L4b1c
+			push	bc
+			ld	d,l
+			ret	po
+			and	e
+			inc	e
+			ld	e,h
+			ld	e,h
+			ld	d,d
+			cp	h
+			ld	e,h
+			dec	c
+			push	af
+			ld	a,l
+			ex	de,hl
+			ld	e,d
+			ld	d,b
+			inc	d
+			ld	e,b
+			ld	a,a
+			sbc	a,e
+			ld	(hl),l
+			rlca
+			sbc	a,a
+			ld	e,c
+			ld	(bc),a
+			ret	pe
+			sub	c
+			ld	sp,hl
+			call	pe,Lbcfa
+			ld	b,e
+			dec	de
+			nop (2x) *
+			ld	a,(bc)
+			call	nc,Lb250
+			rst	38h
+			cp	d
+			ld	a,(hl)
+			and	c
+			or	e
+			rra
+			ld	h,c
+			dec	de
+			cp	l
+			inc	hl
+			xor	d
+			dec	de
+			dec	e
+			nop
+			jp	(hl)
+			db	25h,2dh,f0h,32h,35h,19h,aah,47h
+			db	d7h,73h,4ah,bdh,40h,c4h,4ah,deh
+			db	ceh,c2h,4eh,a2h,8ch,22h,62h,f3h
+			db	3bh,49h,9ah,f8h,a1h,c2h,0fh,f9h
+			db	55h,bfh,a5h,c8h,09h,ffh,15h,88h
+			db	abh,a1h,bbh,07h,3eh,d7h,48h,6ah
+			db	a7h,87h,22h,a6h,5fh,53h,fah,1dh
+			db	f0h,07h,c8h,b5h,b6h,8ch,72h,0eh
+			db	c3h,d8h,c9h,ech,bdh,3fh,7fh,6bh
+			db	cdh,4eh,36h,95h,33h
+			ld	a,l
+			or	c
+			ld	e,b
+			daa
+			ld	a,(de)
+			exx
+			ld	d,e
+			rrca
+			cp	l
+			sub	l
+			or	d
+			or	e
+			ld	c,e
+			add	a,c
+			djnz	L4a44
+			ld	l,10h
+			ld	c,a
+			sub	a
+			add	a,b
+			ret	pe
+			ld	a,c
+			xor	a
+			pop	hl
+			ld	a,8fh
+			ld	bc,de38h
+			sub	d
+			ld	b,h
+			inc	e
+			sbc	a,d
+			ld	d,(hl)
+			ld	(de),a
+			add	a,c
+			ex	af,af'
+			sbc	a,e
+			adc	a,9fh
+			cp	l
+			call	pe,L9d1a
+			cp	e
+			and	h
+			ex	af,af'
+			add	a,e
+			call	m,L2db9
+			ld	a,cch
+			ld	(hl),a9h
+			nop
+			push	hl
+			ld	a,(d62ch)
+			inc	bc
+			ld	c,d
+			halt
+			ld	b,a
+			or	d
+			ld	b,e
+			push	af
+			cp	d
+			ld	(hl),c
+			ld	c,h
+			ld	sp,7d7bh
+			sub	(hl)
+			rst	18h
+			ld	c,c
+			add	hl,hl
+			inc	de
+			ex	af,af'
+			and	(hl)
+			dec	(hl)
+			or	c
+			add	a,h
+			ld	l,b
+			adc	a,l
+			add	hl,de
+			ld	d,h
+			ld	sp,211dh
+			and	1fh
+			ld	l,b
+			jp	c,Laddb
+			ld	a,(bc)
+			ld	b,b
+			ld	d,e
+			ld	a,c
+			ld	h,d
+			ld	(hl),l
+			rst	20h
+			rst	28h
+			sbc	a,d
+			xor	40h
+			dec	a
+			ld	(hl),l
+			or	a
+			add	a,(hl)
+			ld	(f3c5h),a
+			ld	d,l
+			ld	c,h
+			ret	pe
+			jp	p,L97f8
+			adc	a,b
+			adc	a,d
+			ld	l,b
+			add	a,e
+			ld	d,e
+			and	c
+			xor	c5h
+			sbc	a,a
+			ld	h,a
+			out	(79h),a
+			ld	d,0eh
+			pop	hl
+			inc	bc
+			in	a,(6dh)
+			scf
+			inc	(hl)
+			ld	b,l
+			xor	0dh
+			ld	h,c
+			ld	bc,d632h
+			ex	de,hl
+			or	(ix + 1fh)
+			pop	bc
+			ld	h,b
+			ld	(bc),a
+			ld	e,(hl)
+			ld	l,d
+			add	a,b
+			inc	e
+			push	bc
+			ld	l,a
+			add	a,l
+			or	3ch
+			ret	m
+			inc	e
+			inc	a
+			ld	c,9bh
+			add	a,(hl)
+			sub	c
+			sub	e
+			ld	h,a
+			inc	h
+			rrca
+			inc	b
+			ld	d,l
+			di
+			ld	b,beh
+			rst	08h
+			ld	(d7e6h),a
+			sub	7ch
+			ld	e,a
+			ld	a,(c8a9h)
+			ld	e,b
+			ld	e,l
+			sub	(hl)
+			ld	l,8bh
+			pop	bc
+			adc	a,c
+			inc	de
+			pop	de
+			jp	p,L7066
+			add	a,e
+			call	c,L8499
+			ret	nz
+			dec	l
+			nop (2x) *
+			jp	nz,Lc283
+			ex	(sp),hl
+			ld	l,c
+			adc	a,e
+			ld	e,e
+			or	a
+			sbc	a,(hl)
+			ld	h,c
+			sbc	a,e
+			ld	l,d
+			ld	a,e
+			push	hl
+			ld	l,c
+			ld	e,a
+			jp	p,L0aca
+			pop	hl
+			jp	p,La830
+			ld	a,e
+			in	a,(7eh)
+			add	a,(hl)
+			ld	d,h
+			jp	nc,L266a
+			xor	a
+			add	hl,sp
+			rlca
+			adc	a,d
+			ld	h,a
+			sbc	a,e
+			cp	l
+			cp	b
+			and	a
+			inc	l
+			adc	a,0fh
+			jp	L77fd
+			db	13h,c6h,33h,f0h,35h,ach,d7h,a5h
+			db	1ah,b2h,0fh,32h,63h,ech,4fh,2bh
+			db	3ch,97h,aeh,c0h,23h,c3h,e0h,2fh
+			db	58h,3ah,06h,33h,b3h,fbh,34h,1bh
+			db	68h,03h,79h,64h,bbh,56h,ech,d3h
+			db	14h,fbh,f2h,13h,d7h,01h,79h,07h
+			db	78h,62h,2bh,adh,efh,a9h,9bh,d7h
+			db	d2h,ffh,a9h,e2h,49h,67h,8ah,05h
+			db	fch,7eh,18h,66h,0ch,eah,8bh,90h
+			db	0bh,81h,ach,55h
+			or	e
+			call	c,L6d2c
+			cp	b
+			sbc	a,h
+			rst	28h
+			sub	b
+			scf
+			ld	h,h
+			and	d
+			ret	pe
+			or	e
+			ld	h,b
+			cp	e
+			and	d
+			and	e
+			add	a,l
+			xor	h
+			ld	d,ixh *
+			add	hl,de
+			pop	bc
+			and	d
+			sub	a
+			call	z,L064a
+			sub	h
+			or	95h
+			ld	(aef8h),a
+			ld	b,h
+			ld	c,c
+			sub	abh
+			sbc	a,d
+			xor	(hl)
+			and	e
+			and	c
+			add	hl,hl
+			ld	d,d
+			ex	(sp),hl
+			ret	c
+			sub	e
+			jp	m,L1ee9
+			ld	l,a
+			ld	l,d
+			dec	(hl)
+			ld	sp,cf5eh
+			ld	(hl),a
+			or	c
+			add	a,18h
+			ld	e,e
+			cp	c
+			nop (2x) *
+			cp	b
+			cp	d
+			rra
+			jp	L4236
+			db	65h,34h,beh,9ch,83h,b5h,0bh,94h
+			db	b4h,aeh,a1h,3dh,0ah,bch,ech,aah
+			db	d0h,2ah,e0h,8fh,11h,a4h,05h,27h
+			db	90h,e2h,77h,b2h,73h,32h,7dh,b7h
+			db	8ah,bbh,b2h,dfh
+			inc	bc
+			ld	(f19ah),a
+			ld	a,b
+			rst	00h
+			and	(hl)
+			rrca
+			jr	nz,L4b90
+			ld	d,e
+			cp	7eh
+			add	a,d
+			rst	28h
+			ld	c,l
+			adc	a,h
+			add	a,b
+			adc	a,d0h
+			ld	l,d
+			ld	l,a
+			nop (2x) *
+			ret	pe
+			rrca
+			ld	a,a
+			or	h
+			ld	a,cdh
+			and	c
+			ex	(sp),hl
+			ld	c,h
+			dec	l
+			sbc	a,b
+			ld	d,e
+			jp	c,L1dba
+			ld	a,d
+			xor	d
+			sub	a
+			ld	a,(1bf4h)
+			cp	a
+			call	nc,Lf0e8
+			dec	h
+			sub	e
+			exx
+			ex	de,hl
+			cp	l
+			jr	nc,L4b42
+			inc	l
+			ld	b,a
+			jp	c,L8582
+			ld	e,3eh
+			ret	m
+			adc	a,c
+			ld	(hl),c
+			ld	d,a
+			inc	c
+			ld	d,l
+			xor	(hl)
+			ld	l,d
+			add	hl,de
+			dec	de
+			call	m,Lb4a9
+			push	hl
+			ld	d,a
+			ld	b,d
+			ld	l,h
+			inc	sp
+			nop (2x) *
+			add	a,c
+			exx
+			jp	(hl)
+			db	4eh,bch,3bh,a3h,17h,6ch,c2h,1ah
+			db	dbh,f7h,42h,e7h,b4h,24h,26h,f8h
+			db	c8h,b2h,90h,50h,c7h,f6h,dah,22h
+			db	a1h,7fh,c3h,5fh,ech,b0h,35h,e9h
+			db	9dh,b4h,b7h,54h,0ch,75h
+			call	po,L30f1
+			ld	d,c
+			and	5dh
+			nop (2x) *
+			jp	m,L6049
+			push	bc
+			ld	b,3bh
+			and	7fh
+			ld	e,b
+			add	a,3bh
+			and	c
+			ld	d,50h
+			call	z,L1782
+			and	d
+			in	a,(98h)
+			ld	h,b
+			jp	po,L693f
+			ld	b,c
+			add	a,h
+			ld	a,e
+			dec	hl
+			ld	h,a
+			sub	h
+			ld	b,d
+			ld	b,6fh
+			ld	b,a8h
+			res	2,d
+			sub	(hl)
+			ld	l,5ah
+			dec	b
+			ld	h,a
+			rlca
+			ld	a,h
+			inc	d
+			adc	a,h
+			sub	e
+			rrca
+			ld	a,a
+			sub	b
+			or	h
+			and	b
+			ld	sp,hl
+			jp	pe,L23c2
+			ld	l,a
+			ld	sp,hl
+			jp	L6557
+			db	d2h,8dh,d3h,02h,78h,d3h,38h,08h
+			db	8dh,b3h,96h,94h,53h,05h,63h,81h
+			db	b1h,c5h,ach,c9h,afh,36h,b2h,b1h
+			db	e8h,afh,56h,72h,04h,81h,83h,e8h
+			db	5ah,ddh,dbh,ddh,96h,31h,74h,79h
+			db	fbh,3ah,37h,f6h,0fh,aeh,11h,25h
+			db	6dh,efh
+			rla
+			add	a,c
+			adc	a,e
+			xor	e
+			and	c4h
+			ld	l,d
+			inc	sp
+			ld	d,d
+			djnz	L4cee
+			ld	l,e
+			dec	h
+			dec	c
+			inc	a
+			xor	a
+			jp	z,L2c2f
+			rst	28h
+			ld	d,b
+			ld	a,(bc)
+			jp	p,Lb453
+			sub	d
+			add	a,d
+			or	63h
+			jr	z,L4c29
+			dec	de
+			sbc	a,e
+			ld	e,a
+			ld	l,08h
+			call	nc,Le3c9
+			ld	h,e
+			add	a,l
+			ld	b,l
+			xor	h
+			xor	h
+			sbc	a,fch
+			ld	h,d
+			ld	(hl),l
+			ld	c,e
+			cp	l
+			and	0ah
+			ld	c,c
+			add	hl,de
+			rrca
+			ld	b,c
+			ld	c,e
+			inc	b
+			ld	l,a
+			ex	af,af'
+			adc	a,2ch
+			cp	c
+			djnz	L4c76
+			adc	a,a
+			ld	c,d
+			cp	l
+			push	hl
+			add	a,e
+			call	z,Lfbe9
+			ld	b,b
+			dec	hl
+			adc	a,h
+			xor	(hl)
+			xor	b
+			ld	e,c
+			ld	e,b
+			ld	l,d
+			ld	de,bdd6h
+			ld	(bc),a
+			sub	a
+			push	bc
+			push	de
+			ld	l,e
+			sbc	a,a
+			ld	e,h
+			ld	a,(hl)
+			rst	10h
+			cpl
+			ld	(hl),c
+			add	hl,sp
+			jr	nc,L4c8d
+			xor	b
+			ld	d,e
+			rla
+			inc	c
+			xor	c
+			ld	c,2bh
+			out	(0eh),a
+			rst	10h
+			rst	28h
+			adc	a,b
+			or	h
+			ld	a,(hl)
+			cp	e
+			nop (2x) *
+			ld	e,b
+			xor	b
+			jp	po,La27b
+			ret	po
+			call	nz,Lb3b2
+			call	nz,La8cd
+			sub	b
+			ld	de,9b31h
+			ld	c,h
+			ld	b,e
+			cp	h
+			ld	b,e
+			and	e
+			ld	bc,ffabh
+			xor	l
+			add	a,f3h
+			ld	h,e
+			cp	a
+			pop	bc
+			dec	b
+			set	0,a
+			add	a,b
+			and	e
+			ld	h,6ah
+			call	c,La05e
+			ccf
+			jp	nc,L385f
+			nop
+			call	pe,L40fc
+			pop	de
+			add	hl,sp
+			or	b
+			ld	d,(hl)
+			sub	l
+			adc	a,l
+			halt
+			sub	b
+			jp	p,L4447
+			rst	08h
+			sbc	a,l
+			rst	18h
+			rra
+			ld	h,e
+			xor	(hl)
+			ld	b,(hl)
+			or	c
+			xor	c
+			ld	hl,06c1h
+			ld	a,h
+			inc	h
+			add	hl,hl
+			ret	po
+			jp	nz,L4598
+			halt
+			inc	de
+			nop
+			ld	c,h
+			cp	8eh
+			add	a,c
+			ld	h,e
+			neg *
+			push	de
+			daa
+			jp	L4c00
+			db	2ah,0ah,a9h,63h,b8h,4ah,0dh,64h
+			db	f6h,6ch,43h,f9h,dah,5eh,a3h,d1h
+			db	06h,81h,12h,7ch,37h,a2h,f3h,28h
+			db	87h,bah,e6h,12h,4eh,6eh,f1h,0ah
+			db	8ch,31h,39h,b5h,dch,2bh,91h,94h
+			db	2ch,7fh,5dh,a8h,09h,f5h,01h,72h
+			db	73h,d6h,2fh,66h,00h,3dh,f2h,0dh
+			db	96h,f0h,adh,e0h,00h,42h,8ch,a7h
+			db	fdh,d0h,d4h,7dh,d4h,c0h,38h,7fh
+			db	dfh,30h,85h,e7h,b4h,73h,b3h,f5h
+			db	08h,3dh,9ah,98h,cbh,dfh,41h,17h
+			db	49h,fdh,fbh,c0h,fdh,aah,3fh,46h
+			db	bfh,bah,f0h,2eh,17h,f8h,f4h,a1h
+			db	ddh,51h,11h,c9h,e5h,66h,97h,f3h
+			db	4ch,edh,edh,dah,beh,7bh,bch,98h
+			db	cch,8ch,aah,5ah,39h,f3h,f3h
+			rst	38h
+			ld	(hl),l
+			dec	(hl)
+			ld	l,d
+			ld	e,(hl)
+			ld	(hl),h
+			add	a,(hl)
+			ld	hl,3e5fh
+			dec	(hl)
+			ld	e,e
+			dec	e
+			cp	b
+			adc	a,e
+			adc	a,b
+			ld	hl,(c8d5h)
+			ret	nc
+			and	e
+			cp	e
+			ld	h,e
+			ld	hl,(c898h)
+			ld	l,d
+			ld	b,e
+			ld	e,b
+			ld	e,l
+			ld	d,a
+			ld	h,b
+			cpl
+			ld	l,95h
+			add	hl,bc
+			inc	d
+			sbc	a,(hl)
+			sub	b
+			ld	c,e
+			ld	a,a
+			ld	d,(hl)
+			ld	e,h
+			ld	(hl),49h
+			dec	bc
+			ld	(hl),l
+			add	a,l
+			ld	l,b
+			sbc	a,h
+			and	54h
+			add	a,b
+			ld	d,0ah
+			adc	a,d
+			sbc	a,d
+			ret	m
+			ld	(hl),a
+			ld	e,l
+			ld	h,e
+			jp	nc,L4078
+			ld	b,l
+			call	z,L64b7
+			di
+			ld	e,c
+			cp	c
+			ret	nz
+			ld	sp,hl
+			rst	30h
+			or	h
+			inc	c
+			sbc	a,e
+			ld	h,a
+			sbc	a,d
+			ld	h,b
+			ld	l,h
+			inc	e
+			ret	nc
+			ret	z
+			ret	m
+			ld	e,c
+			sbc	a,h
+			cp	h
+			ld	b,h
+			inc	de
+			ld	d,e
+			and	e
+			ld	a,(bc)
+			ld	a,e
+			add	a,e
+			inc	b
+			cp	h
+			inc	de
+			ld	c,a
+			ld	e,c
+			ld	a,e
+			call	nz,L3d70
+			inc	e
+			jp	m,Lf9f4
+			rst	10h
+			ret	po
+			ld	a,(8296h)
+			ld	l,d
+			ld	e,b
+			inc	de
+			cp	(hl)
+			or	h
+			sub	b
+			rst	00h
+			inc	bc
+			inc	h
+			ld	a,a
+			jr	nc,L4e6e
+			ret	pe
+			ret	m
+			ld	e,l
+			cpl
+			add	hl,bc
+			jp	z,Ld851
+			ld	c,e
+			ex	(sp),hl
+			ret	nz
+			and	d
+			cpl
+			ld	(hl),l
+			daa
+			dec	b
+			add	hl,bc
+			adc	a,l
+			ld	(de),a
+			add	a,a
+			jp	z,L2d0e
+			nop
+			ld	h,e
+			sub	c
+			ex	de,hl
+			ret	nz
+			ld	l,l
+			nop
+			jp	(hl)
+			db	2ah,f7h,36h,46h,aeh,0fh
+			call	L461d
+			sbc	a,16h
+			sub	l
+			ld	(hl),b
+			rst	08h
+			or	e
+			dec	sp
+			jp	m,L1992
+			ld	(hl),b
+			add	a,l
+			jp	L0ca0
+			db	4eh,69h,3ch,5ch,c1h,87h,49h,b1h
+			db	7dh,a5h,88h,d2h,00h,feh,8bh,a1h
+			db	7dh,99h,5ah,6bh,16h,96h,69h,95h
+			db	2fh,28h,28h,bfh,c5h,5bh,3eh,f4h
+			db	2ah,43h,f3h,41h,d3h,72h,c1h,eeh
+			db	23h,3bh,43h,08h,03h,22h,66h,91h
+			db	63h,b3h,cdh,73h,9ch,2bh,bbh,98h
+			db	a6h,1eh,23h,6dh,95h,b1h,dfh,73h
+			db	76h,2eh,beh,39h,d6h,17h,a6h,d1h
+			db	c1h,06h,70h,91h,aeh,14h,2bh,46h
+			db	37h,03h,4dh,11h,80h,73h
+			ld	sp,hl
+			pop	de
+			jr	c,L4e66
+			dec	de
+			sbc	a,(hl)
+			and	(hl)
+			ld	(bc),a
+			ld	hl,7095h
+			in	a,(77h)
+			sbc	a,d
+			dec	de
+			ld	b,e
+			and	d
+			ld	b,d
+			ld	c,(hl)
+			rla
+			ld	h,b
+			ld	(hl),dfh
+			sub	a
+			rst	00h
+			dec	hl
+			jp	nc,L5a22
+			sbc	a,h
+			adc	a,fbh
+			and	e
+			ld	hl,(e6e1h)
+			add	a,c
+			adc	a,e
+			add	hl,de
+			in	a,(80h)
+			rst	28h
+			ret	nz
+			and	b
+			ld	(hl),e
+			and	b5h
+			jp	nz,L5542
+			ex	(sp),hl
+			ld	a,e
+			cp	a
+			pop	de
+			rst	20h
+			ld	h,d
+			and	b2h
+			ld	a,d
+			nop
+			ld	(hl),c
+			call	p,L3ef7
+			ld	l,h
+			inc	de
+			call	pe,L8b81
+			ld	(hl),h
+			inc	b
+			ccf
+			ld	a,d
+			add	a,h
+			ld	d,01h
+			ld	a,a
+			dec	bc
+			add	a,l
+			pop	bc
+			or	a
+			ld	d,c
+			rst	28h
+			jr	nc,L4eec
+			res	2,e
+			ei
+			dec	a
+			ld	(hl),d
+			add	a,l
+			rst	28h
+			djnz	L4f8e
+			bit	3,e
+			or	d
+			push	de
+			ld	a,a
+			jr	nc,L4f21
+			cpl
+			halt
+			inc	l
+			xor	(hl)
+			inc	h
+			ld	d,b
+			rst	30h
+			di
+			cpl
+			ld	a,c
+			nop
+			rst	28h
+			nop (2x) *
+			pop	hl
+			ld	a,b
+			dec	de
+			ld	h,d
+			ex	(sp),hl
+			inc	a
+			sub	c
+			ld	l,l
+			cp	a
+			di
+			ld	sp,ea0dh
+			sbc	a,h
+			and	bfh
+			or	c
+			ld	l,a
+			add	a,h
+			call	m,L3e1d
+			rst	28h
+			cp	a
+			ld	bc,f595h
+			dec	d
+			ld	l,c
+			or	h
+			rra
+			ld	e,e2h
+			xor	l
+			halt
+			ld	a,69h
+			or	c
+			ld	(hl),d
+			ld	c,(hl)
+			ld	d,d
+			xor	b
+			ld	(hl),b
+			push	de
+			ld	a,(hl)
+			inc	(hl)
+			ld	(hl),l
+			ld	e,a
+			ld	(hl),b
+			sbc	a,(hl)
+			add	a,(hl)
+			res	0,l
+			rla
+			nop
+			or	l
+			ld	l,c
+			ld	b,d
+			rst	30h
+			rst	38h
+			cp	d
+			ld	hl,5a03h
+			ld	l,b
+			ld	c,h
+			or	h
+			ld	d,24h
+			rst	18h
+			adc	a,f2h
+			ld	d,c
+			sub	l
+			ret	nc
+			ccf
+			add	a,64h
+			daa
+			ex	(sp),hl
+			ld	c,e
+			ccf
+			ld	a,e
+			ld	a,c
+			ld	b,c
+			cpl
+			ex	af,af'
+			sub	c
+			jp	(hl)
+			db	ebh,84h,efh,93h,e0h,75h,d5h,5fh
+			db	3bh,0ah,b3h,55h,09h,a0h,b7h,62h
+			db	0dh,80h,f3h,eeh,85h,fah,46h,eah
+			db	87h,fbh,41h,5ah,4ah,0fh,61h,8fh
+			db	2fh,c0h,18h,d4h,1fh,4bh,0dh,41h
+			db	dah,5ah,7bh,f0h,2fh,6dh,c1h,62h
+			db	69h,30h,94h,f8h,10h,8ah,02h,ach
+			db	08h,1ah,a1h,aeh,88h,d7h,1fh,09h
+			db	aah,76h,0bh,85h,7ch,bah,2eh,35h
+			db	e1h,b3h,b5h,93h,74h,95h,3ch,0bh
+			db	c0h,81h,b7h,42h,f3h,54h,02h,46h
+			db	d0h,4fh,e9h,d3h,37h,8ah,e3h,5ch
+			db	afh,c1h,28h,82h,f3h,aah,52h,9ch
+			db	a1h,70h,76h,3ah,ffh,0fh,a8h,99h
+			db	81h,64h,d5h,06h,d4h,cbh,1ah,6dh
+			db	9eh,5ah,53h,82h,f2h,eeh,0ah,37h
+			db	92h,7dh,a6h,ach,3fh,c9h,38h,29h
+			db	6fh,1ch,4dh,fdh,1ah,3dh,49h,a3h
+			db	7fh,31h,47h,7ch,96h,f3h,3ch,f9h
+			db	5ah,fbh,21h,d5h,eah,a2h,57h,12h
+			db	14h,18h,dbh,cfh,61h,e5h,2fh,94h
+			db	59h,c0h,91h,16h,d2h,f4h,8ch,f8h
+			db	f0h,81h,bbh,46h,b5h,1dh,13h,11h
+			db	dah,b8h,8ch,e9h,c1h,13h,a0h,62h
+			db	bfh,0fh,bfh,02h,34h,fbh,1fh,09h
+			db	07h,f6h,3ah,13h,2ah,deh,fdh,86h
+			db	a8h,c9h,a0h,83h,b9h,1dh,cbh,47h
+			db	16h,b5h,39h,bfh,96h,4fh,c8h,57h
+			db	aeh,d7h,2ch,8fh,47h,6ch,c1h,6ah
+			db	14h,b7h,13h,b9h,f2h,d9h,a7h,81h
+			db	05h,98h,b2h,6ah,eah,96h,38h,78h
+			db	2ch,b5h,65h,0ch,bah,28h,25h,1dh
+			db	deh,b0h,97h,ceh,bah,8dh,cah,32h
+			db	deh,d8h,1ah,1bh,b2h,00h,62h,d5h
+			db	c2h,deh,71h,24h,3dh,9dh,7ch,1fh
+			db	b2h,d3h,39h,55h,51h,7ch,b2h,89h
+			db	0bh,6eh,6ah,6eh,33h,65h,6fh,37h
+			db	4dh,46h,a9h,eah,1ch,e7h,27h,8ah
+			db	03h,63h,57h,7eh,3ch,70h,68h,ffh
+			db	0ch,16h,5ch,3fh,24h,28h,36h,bdh
+			db	f9h,2ah,1ch,22h,90h,ddh,8ah,aah
+			db	c2h,9fh,dbh,c2h,e1h,65h,8dh,a1h
+			db	a9h,07h,72h,8bh,7eh,f9h,66h,78h
+			db	fah,11h,f6h,2bh,43h,7fh,91h,2eh
+			db	72h,9ah,70h,8fh,16h,1fh,17h,2eh
+			db	03h,b0h,17h,b3h,edh,81h,c0h,ceh
+			db	c8h,14h,cah,6ah,2dh,89h,38h,48h
+			db	0ah,f3h,cch,edh,6ah,8ch,e3h,5ah
+			db	02h,68h,f3h,fbh,73h,90h,78h,52h
+			db	80h,47h,2ah,86h,ddh,84h,89h,71h
+			db	cdh,8ah,67h,23h,47h,1ah,b8h,1ah
+			db	bfh,dbh,39h,f1h,95h,beh,30h,49h
+			db	13h,2fh,a1h,66h,b6h,4eh,bch,9eh
+			db	72h,59h,52h,75h,d9h,f2h,08h,09h
+			db	d4h,4ah
+			and	b
+			ld	b,b
+			add	a,h
+			ld	hl,(c96ah)
+			ld	c,a
+			ret	p
+			sub	b
+			scf
+			push	de
+			rrca
+			sbc	a,7fh
+			ld	ixl,e *
+			ld	a,e
+			ld	(hl),6dh
+			ex	af,af'
+			ld	c,c
+			dec	a
+			or	e
+			ld	e,b
+			call	c,L3a66
+			jp	nz,L6f20
+			ld	a,a
+			sbc	a,a
+			or	e
+			adc	a,a
+			and	l
+			ld	c,c
+			sub	h
+			add	a,e
+			ld	b,e
+			ld	h,c
+			cp	a
+			add	hl,de
+			ld	a,e4h
+			ret	z
+			add	a,l
+			and	l
+			dec	sp
+			sub	e
+			cp	45h
+			bit	1,h
+			inc	c
+			or	cdh
+			and	b
+			inc	a
+			ld	l,h
+			sbc	a,b
+			rst	18h
+			rst	38h
+			add	a,(hl)
+			ld	de,8f9ah
+			add	a,e
+			cp	h
+			ld	c,d
+			or	d
+			in	a,(83h)
+			ld	d,h
+			call	p,Lc845
+			sbc	a,l
+			dec	e
+			ld	h,e
+			add	a,a
+			dec	l
+			jp	pe,Lb575
+			push	hl
+			rrca
+			ld	(hl),b
+			push	bc
+			rst	08h
+			cpl
+			and	b
+			ld	e,72h
+			exx
+			halt
+			ld	h,b
+			dec	bc
+			or	02h
+			rlca
+			ret	pe
+			and	b
+			ld	h,h
+			ld	l,h
+			xor	(hl)
+			and	h
+			ret	z
+			add	a,b2h
+			dec	de
+			xor	a
+			ld	h,b
+			or	(hl)
+			call	pe,Le575
+			ld	(de),a
+			ld	c,d
+			ld	h,c
+			ld	h,b
+			ld	h,a
+			ld	h,d
+			ld	d,d4h
+			jr	L5230
+			db	e6h,44h,11h,39h,63h,4eh,eah,e2h
+			db	5eh,35h,5eh,8ah,99h,e7h,3ah,cah
+			db	2ch,71h,a5h,33h,34h,13h,dah,c5h
+			db	ddh,e7h,69h,d2h,ceh,88h,36h,f9h
+			db	c2h,0bh,6bh,2bh,72h,6ch,9bh,e9h
+			db	2eh,44h,7ch,83h,5dh,ebh,7fh,03h
+			db	bfh,fdh,2ch,6ah,bfh,c5h,56h,03h
+			db	bch,1dh,d7h,d3h,f2h,e7h,6fh,2ch
+			db	1ch,0ah,39h,87h,96h,a7h,9ah,41h
+			db	2fh,74h,cch,e4h,18h,e9h,cfh,46h
+			db	38h,a8h,bbh,30h,a5h,96h,cfh,79h
+			db	77h,9ch,74h,c4h,49h,87h,ebh,30h
+			db	4eh,11h,26h,44h,38h,c7h
+			rla
+			xor	a
+			rrca
+			jr	z,L5270
+			sbc	a,(hl)
+			ld	a,(hl)
+			adc	a,(hl)
+			set	5,a
+			or	d
+			xor	l
+			ld	l,e
+			sub	h
+			rst	10h
+			ld	a,dah
+			and	e
+			jp	m,L90a4
+			ei
+			ld	l,h
+			adc	a,b
+			sub	04h
+			jr	nz,L52b8
+			sub	c
+			call	L6dc1
+			ld	e,c
+			inc	bc
+			and	2dh
+			xor	(hl)
+			adc	a,a
+			exx
+			ld	d,d
+			or	b6h
+			ld	hl,f965h
+			ret	p
+			ld	a,1fh
+			ld	b,e6h
+			add	a,b
+			add	a,e
+			ret	pe
+			or	e
+			and	a
+			di
+			ld	l,c4h
+			ld	c,h
+			halt
+			or	c
+			jr	nc,L5267
+			sub	l
+			dec	de
+			sub	a
+			cp	l
+			jp	pe,L5a36
+			scf
+			add	hl,hl
+			ccf
+			ld	sp,9318h
+			adc	a,(hl)
+			xor	h
+			call	nc,Lc3d8
+			ld	d,a
+			di
+			xor	e
+			adc	a,d
+			jr	nc,L526c
+			ld	bc,70f9h
+			add	hl,de
+			ld	c,(hl)
+			jp	z,L4a94
+			jr	c,L52b8
+			ld	c,d
+			ld	h,e
+			call	nz,Led4a
+			pop	bc
+			push	de
+			ei
+			and	a
+			ret	po
+			or	h
+			jr	c,L52fe
+			sub	c
+			add	a,e
+			ret	po
+			xor	h
+			ccf
+			pop	de
+			ld	e,adh
+			nop (2x) *
+			inc	(hl)
+			ld	(hl),l
+			call	po,L54ea
+			ccf
+			rst	18h
+			rlc	h
+			dec	e
+			ld	c,d
+			and	h
+			ld	a,(9f39h)
+			ld	b,e2h
+			xor	l
+			ld	h,b
+			ld	c,b
+			add	a,a
+			xor	b
+			or	l
+			ret	p
+			ld	(5f9fh),a
+			ld	l,a
+			push	af
+			ld	b,40h
+			jr	nc,L5274
+			ld	(hl),e
+			rst	10h
+			ld	a,h
+			ld	d,l
+			nop (2x) *
+			or	b
+			xor	a
+			sbc	a,h
+			pop	af
+			dec	h
+			ld	sp,hl
+			push	bc
+			ld	(hl),e
+			nop
+			ret	m
+			dec	(hl)
+			ld	b,96h
+			rla
+			cp	h
+			inc	bc
+			or	e
+			pop	hl
+			inc	bc
+			inc	sp
+			jr	z,L534f
+			ld	bc,3b56h
+			rrca
+			dec	bc
+			ld	e,d
+			ld	e,b
+			xor	b
+			ld	e,3dh
+			ld	d,e
+			ld	b,b
+			and	h
+			ei
+			ld	e,(hl)
+			ld	(de),a
+			ex	(sp),hl
+			jp	m,L3157
+			ret	po
+			jp	pe,L5c6e
+			and	a
+			add	hl,hl
+			ld	(de),a
+			inc	(hl)
+			ld	l,h
+			inc	c
+			ld	l,81h
+			adc	a,e
+			dec	de
+			ld	(hl),h
+			in	a,(e8h)
+			jr	c,L5388
+			sub	d
+			dec	sp
+			ret	z
+			add	a,c
+			add	hl,hl
+			dec	b
+			ld	d,e
+			inc	d
+			ld	l,e6h
+			ld	e,l
+			nop (2x) *
+			ld	(hl),c
+			and	a
+			ld	b,d
+			dec	b
+			call	c,L43b4
+			jp	pe,L131a
+			or	d
+			cpl
+			ret
+			db	45h,b1h,4bh,b6h,33h,d5h,b0h,45h
+			db	c0h,cdh,89h,21h,3eh,06h,8ch,56h
+			db	72h,a3h,79h,dbh,b1h,ach,8ah,f2h
+			db	35h,17h,d8h,e5h,62h,27h,0eh,c4h
+			db	70h,e4h,67h,d9h,c8h,56h,40h,c2h
+			db	82h
+			cp	(hl)
+			ld	(hl),a
+			or	b
+			sbc	a,(hl)
+			ld	d,e
+			rst	18h
+			ld	h,b
+			sub	c
+			xor	e
+			ld	(bc),a
+			xor	c
+			ld	e,e
+			ld	a,(hl)
+			jp	z,Ldcda
+			rst	20h
+			sbc	a,c
+			and	c
+			inc	e
+			dec	b
+			inc	(hl)
+			cp	(hl)
+			call	L207b
+			ld	(hl),a
+			add	hl,bc
+			ld	a,b
+			ld	a,h
+			ld	a,(bc)
+			ld	c,b
+			ld	c,a
+			nop (2x) *
+			dec	h
+			inc	a
+			sub	d6h
+			sub	0eh
+			jp	po,La639
+			dec	de
+			xor	h
+			ccf
+			or	e
+			ret	z
+			ld	a,(de)
+			adc	a,29h
+			inc	e
+			dec	b
+			inc	c
+			res	1,c
+			ld	l,e
+			call	nc,Lb170
+			sbc	a,h
+			jp	(hl)
+			db	a5h,83h,beh,b0h,e4h,2ch,58h,f6h
+			db	00h,efh,64h,6fh,00h,8fh,ceh,01h
+			db	82h,54h,0fh,f7h,0bh,27h,7dh,b7h
+			db	79h,2eh,9bh,92h,41h,8bh,33h,adh
+			db	dah,92h,2eh,f2h,98h,9eh,c5h,6ah
+			db	43h,cdh,6ah,f1h,37h,84h,28h,fbh
+			db	d7h,72h,5ah,62h,79h,d3h,83h,e4h
+			db	42h,e9h,3fh,10h,21h,94h,c9h,69h
+			db	9ah,58h,c3h,07h,0fh,d1h,c8h,9ah
+			db	47h,18h,a2h,8dh,12h,46h,06h,42h
+			db	b4h,62h,4ch,4ah,73h,d3h,d0h,23h
+			db	b5h,edh,6fh,0dh,a6h,37h,cfh,d9h
+			db	24h,8ah,c5h,11h,3eh,54h,8ah,bfh
+			db	31h,6ch,2bh,13h,86h,34h,79h,8bh
+			db	73h,83h,85h,98h,34h,b7h,c0h,cdh
+			db	ffh,cfh,1eh,f1h,9ah,2ch,74h,6ch
+			db	0ah,97h,07h,56h,7fh,56h,c4h,0dh
+			db	afh,47h,a0h,8fh,7dh,f1h,fdh,45h
+			db	35h,86h,b5h,67h,5bh,0fh,89h,ach
+			db	98h,bbh,ceh,02h,63h,05h,87h,4dh
+			db	70h,71h,0bh,02h,cah,ffh,11h,54h
+			db	9bh,cbh,77h,20h,d3h,9ch,72h,a2h
+			db	07h,09h,8dh,42h,0ch,fah,48h,51h
+			db	21h,60h,a7h,5ch,8dh,aah,f4h,62h
+			db	d6h,76h,27h,80h,ddh,d9h,e3h,75h
+			db	0bh,84h,f4h,9ch,24h,1ch,9eh,51h
+			db	9ah,97h,42h,01h,39h,59h,d1h,09h
+			db	55h,94h,c9h,afh,66h,16h,eah,90h
+			db	06h,81h,24h,0bh,0dh,fdh,a0h,94h
+			db	28h,32h,a4h,3eh,28h
+			ld	b,c
+			push	bc
+			ccf
+			call	nc,L09b7
+			ld	(hl),h
+			push	hl
+			ld	e,h
+			ret	p
+			ld	h,e
+			ld	(fd50h),hl
+			inc	c
+			cp	(hl)
+			inc	d
+			push	af
+			inc	c
+			ld	a,(b72ch)
+			ld	l,h
+			rra
+			ret	p
+			ld	a,h
+			or	54h
+			dec	b
+			ld	l,l
+			ret	po
+			or	(hl)
+			ld	h,a
+			jp	po,Le8fc
+			ld	d,e
+			ld	d,d
+			ld	(a360h),a
+			ld	h,l
+			add	a,(hl)
+			ld	c,e
+			rst	20h
+			sbc	a,h
+			inc	a
+			ld	h,c
+			ld	h,b
+			ld	b,a
+			rra
+			sub	(hl)
+			sbc	a,83h
+			ld	c,a
+			ld	l,h
+			ld	(de),a
+			and	c
+			ld	c,b
+			rst	08h
+			ld	l,b
+			dec	h
+			jp	z,L8364
+			or	e
+			ld	h,b
+			ld	l,h
+			inc	hl
+			or	e
+			ld	e,l
+			sbc	a,e
+			rst	00h
+			rst	08h
+			dec	sp
+			ld	l,l
+			jr	c,L547b
+			rst	30h
+			ld	e,a
+			ld	d,c
+			ld	bc,e4cdh
+			add	a,l
+			add	a,d
+			ex	(sp),hl
+			jp	po,L1159
+			sbc	a,d
+			and	(hl)
+			ld	a,c
+			ld	d,d
+			add	a,a
+			inc	(hl)
+			ld	l,b
+			and	e
+			push	af
+			jp	(hl)
+			db	bdh,07h,35h,85h,ebh,f0h,83h,15h
+			db	71h,ech,81h
+			adc	a,c
+			ld	c,d
+			xor	61h
+			ld	b,c
+			or	b
+			ld	h,h
+			ret	p
+			ld	l,(hl)
+			rst	18h
+			di
+			cpl
+			ld	e,a
+			jp	p,L7359
+			ei
+			jp	m,L9ebc
+			jr	nc,L54ec
+			ret
+			db	45h,cah,e6h,f3h,ech,1ch,50h,2eh
+			db	5eh,b5h,ech,d5h,5dh,61h,adh,56h
+			db	bfh,3fh,53h,e0h,72h,c0h,a9h,f3h
+			db	3bh,05h,03h,83h,0fh,90h,c5h,d7h
+			db	20h,edh,d8h,e3h,3ch,f7h,2dh,90h
+			db	f7h,49h,9dh,2dh,c0h,dfh,2ah,dfh
+			db	ach,46h,d6h,f8h,c0h,32h,aah,24h
+			db	82h,40h,29h,4fh,69h,8eh,a1h,43h
+			db	32h
+			ld	e,l
+			exx
+			ld	c,b
+			ld	b,c
+			call	z,L6317
+			dec	hl
+			inc	(hl)
+			ld	a,(bc)
+			push	hl
+			ld	b,e
+			and	b
+			ret	c
+			and	h
+			cp	a
+			inc	c
+			or	75h
+			ld	l,a
+			add	hl,bc
+			ld	de,62ffh
+			xor	b
+			nop (2x) *
+			ret	nc
+			sbc	a,a
+			dec	de
+			or	l
+			ret	nz
+			inc	c
+			in	e,(c)
+			add	a,a
+			and	c
+			ld	a,h
+			or	e
+			ld	b,a
+			ld	(hl),dch
+			rst	00h
+			inc	bc
+			ld	h,93h
+			ld	l,d
+			ld	l,l
+			and	c
+			ld	h,e
+			ex	af,af'
+			inc	b
+			xor	l
+			adc	a,l
+			sbc	a,(hl)
+			and	d
+			pop	de
+			ld	d,d
+			cp	d
+			ret	p
+			call	z,L7a77
+			di
+			rla
+			ld	b,h
+			rst	18h
+			sub	c
+			ld	hl,624fh
+			ld	h,l
+			dec	bc
+			ld	c,(hl)
+			inc	sp
+			xor	h
+			jp	L7814
+			db	72h,77h,93h,adh,7fh,f7h,eeh,b8h
+			db	8ch,43h,2fh,87h,d4h,63h,99h,80h
+			db	39h,10h,c8h,94h,e1h,fah,e6h,37h
+			db	bfh,0ah,f4h,deh,c4h,28h,13h,6ch
+			db	93h,2eh,b9h,76h,fch,02h,69h,96h
+			db	b9h,31h,6eh,08h,62h,59h,5ch,b8h
+			db	ddh,0ch,57h,eeh,cah,9eh,95h,80h
+			db	f9h,feh,e6h,f7h,a4h,26h,1ch,93h
+			db	bfh,afh,e6h,b0h,65h,b4h,e1h,98h
+			db	82h,d7h,44h,e0h,f4h,e7h,1dh,bfh
+			db	7eh,deh,a4h,4eh,f1h,62h,91h,87h
+			db	87h,b4h,86h,dah,e5h,9ch,69h,a5h
+			db	77h,c1h,4ch,35h,ebh,15h,5dh,77h
+			db	bah,e0h,d2h,f0h,10h,97h,4ah,a2h
+			db	88h,7ah,fbh,81h,d1h,5bh,a4h,a0h
+			db	51h,2fh,82h,85h,c2h,96h,81h,6eh
+			db	3bh,6ch,65h,95h,cbh,beh,a1h,feh
+			db	92h,23h,38h,30h,44h,e5h,e1h,5bh
+			db	c5h,91h,c3h,3fh,d7h,4dh,58h,4eh
+			db	f0h,ebh,d2h,8ah,44h,76h,c3h,eah
+			db	2dh,cah,bdh,26h,8ch,79h,01h,feh
+			db	e2h,50h,b0h,61h,8bh,d8h,28h,f5h
+			db	d2h,8dh,d3h,c0h,42h,42h,0dh,88h
+			db	2bh,44h,d0h,edh,dbh,23h,9bh,2ah
+			db	b1h,6dh,4dh,d4h,f7h,44h,a5h,a5h
+			db	80h,d3h,efh,d5h,eeh,fch,b2h,56h
+			db	4eh,3eh,3ah,f8h,0dh,75h,cch,0dh
+			db	83h,97h,8fh,bfh
+			sbc	a,a
+			cp	edh
+			inc	hl
+			inc	d
+			pop	af
+			ret	pe
+			cpl
+			ld	h,(hl)
+			sbc	a,b
+			ret	pe
+			rst	38h
+			rst	38h
+			ld	c,26h
+			inc	b
+			sbc	a,d
+			ld	a,a
+			sbc	a,l
+			rlca
+			ret	po
+			dec	c
+			pop	af
+			cp	l
+			call	po,Lc412
+			ld	(hl),a
+			add	a,d
+			ld	a,(de)
+			sub	d
+			cp	d
+			rst	20h
+			dec	a
+			ld	(hl),7fh
+			xor	91h
+			jp	pe,Lbf96
+			jr	L56cf
+			db	a3h,6bh,19h,8ch,a6h,cbh,f4h,43h
+			db	60h,d8h,b8h,3eh,25h,d9h,0ch,3ah
+			db	44h,95h,49h,c2h,f9h,d2h,00h,b1h
+			db	ech,68h,b3h,57h,81h,bbh,9ah,0bh
+			db	82h,28h,c6h,00h,eah,9bh,f4h,62h
+			db	8ah,c9h,5eh,75h,01h,3ah,28h,2eh
+			db	12h,01h,f1h,78h,c2h,e3h,f4h,f0h
+			sub	b
+			ld	c,d
+			sbc	a,e
+			ld	c,24h
+			add	hl,hl
+			ld	sp,hl
+			ld	b,d
+			ld	bc,1ab6h
+			ld	(hl),a
+			call	z,L6c76
+			jr	c,L571b
+			or	c
+			dec	c
+			dec	l
+			ex	(sp),hl
+			and	89h
+			inc	l
+			or	e
+			call	z,Lfe14
+			ld	hl,b9d5h
+			ld	b,l
+			ld	a,e
+			cp	d
+			ld	hl,(46c8h)
+			ld	a,d
+			adc	a,h
+			ld	(hl),h
+			and	c
+			or	9fh
+			ld	(hl),h
+			ld	h,(hl)
+			dec	ix
+			or	h
+			rst	30h
+			jp	c,L3ad4
+			jp	z,Lfb49
+			jp	c,L56d3
+			xor	e
+			sbc	a,(hl)
+			and	6eh
+			dec	c
+			ld	de,92d9h
+			ld	e,l
+			ld	e,l
+			add	a,b
+			ld	b,f5h
+			and	c
+			or	h
+			ld	e,(hl)
+			and	h
+			and	3fh
+			call	z,L4806
+			ld	a,l
+			daa
+			push	hl
+			add	a,a
+			ld	(hl),l
+			jp	nc,L6d54
+			and	13h
+			ld	hl,abbfh
+			exx
+			inc	bc
+			jr	L574e
+			db	9bh,abh,15h,97h,20h,33h,13h,5bh
+			db	5dh,4bh,87h,cch,12h,ebh,deh,0ah
+			db	4bh,b5h,0fh,58h,4ch,02h,fah,4eh
+			db	68h,c0h,f4h,2bh,23h,b5h
+			ld	a,(hl)
+			exx
+			ld	e,75h
+			ld	hl,ebd2h
+			ret	nc
+			call	Lc934
+			ld	c,d
+			ret
+			db	94h,97h,11h,14h,e3h,68h,5fh,4bh
+			db	3dh,5bh,ceh,c8h,eah,76h,21h,a0h
+			db	c1h,a9h,2dh,fah,f5h,47h,32h,a8h
+			db	b3h,feh,44h,cdh,15h,82h,65h,83h
+			db	dch,5eh,0eh,77h,abh,23h,dfh,b8h
+			db	16h,9fh,5fh,9bh,a8h,44h,d3h,89h
+			db	92h,e7h,f2h,cch,dch,eeh,17h,a5h
+			db	d2h,28h,1ch,fah,bah,d0h,56h,37h
+			db	7bh,d8h,d4h,9eh,f7h,3bh,51h
+			xor	c
+			add	a,a
+			ld	l,l
+			add	a,c
+			ld	e,c
+			ld	d,a
+			ld	b,d
+			or	d
+			xor	h
+			ld	(c5dch),hl
+			ld	(01cbh),hl
+			dec	b
+			ld	d,a
+			xor	h
+			rst	10h
+			pop	hl
+			ld	e,l
+			ld	a,ebh
+			add	hl,hl
+			add	hl,sp
+			jp	c,L9043
+			ld	(9e00h),hl
+			inc	de
+			add	hl,de
+			cp	b
+			ret	nc
+			push	af
+			ld	(de),a
+			cp	b
+			ld	a,c
+			ld	a,(hl)
+			inc	a
+			add	hl,de
+			sbc	a,b
+			ld	e,e
+			inc	e
+			call	pe,Lb565
+			ld	e,e3h
+			rst	20h
+			ld	c,(hl)
+			add	a,h
+			rrca
+			ld	l,l
+			jp	m,L5db3
+			ld	e,d
+			and	b
+			ld	e,b
+			inc	(hl)
+			inc	h
+			rst	10h
+			inc	c
+			ld	(1d70h),hl
+			ei
+			ld	c,c
+			xor	(hl)
+			ld	(hl),h
+			xor	c
+			ld	(hl),b
+			ld	(hl),d
+			ei
+			dec	a
+			dec	(hl)
+			dec	e
+			or	h
+			inc	h
+			rst	30h
+			ld	l,e
+			pop	hl
+			add	hl,sp
+			ld	(2762h),hl
+			and	(hl)
+			djnz	L57f0
+			ld	a,(de)
+			rlca
+			ld	a,e
+			ld	d,a
+			ld	hl,(9ea8h)
+			ld	d,2bh
+			ld	c,e
+			xor	a
+			inc	d
+			adc	a,h
+			inc	l
+			or	d
+			ex	(sp),hl
+			inc	c
+			and	h
+			and	a
+			add	hl,de
+			adc	a,c
+			xor	a
+			xor	e
+			add	a,d
+			ld	b,l
+			inc	hl
+			ret	nc
+			and	c
+			ei
+			sbc	a,e
+			ld	(hl),a
+			ld	d,a
+			ld	(hl),e
+			and	a
+			ld	b,e
+			ld	(hl),b
+			ld	b,1ah
+			inc	bc
+			and	e
+			ld	d,a
+			inc	bc
+			cp	(hl)
+			or	(hl)
+			add	a,e
+			sub	h
+			di
+			adc	a,h
+			cp	d
+			ld	a,(hl)
+			ld	d,d
+			xor	a
+			pop	hl
+			sub	l
+			pop	de
+			ld	a,e9h
+			call	p,L0085
+			cp	e
+			inc	de
+			ld	l,h
+			cp	b
+			ld	(hl),c
+			call	m,L4a30
+			add	a,0dh
+			jp	c,L52a2
+			push	hl
+			sbc	a,c
+			add	hl,bc
+			add	a,a
+			cp	b
+			cp	(hl)
+			ret	m
+			sbc	a,2ah
+			sub	l
+			add	a,l
+			ld	l,(hl)
+			call	po,L3a3a
+			ld	b,h
+			and	h
+			xor	d
+			or	e
+			adc	a,83h
+			pop	hl
+			ld	b,b
+			ret
+			db	9bh,6bh,7eh,80h,5dh,82h,9dh,03h
+			db	bch,20h,cdh,1dh,feh,5eh,afh,fbh
+			db	48h,b1h,ach,51h,e8h,bch,ach,f8h
+			db	07h,c7h,79h,06h,20h,19h,97h,e3h
+			db	a2h,d1h,93h,bdh,24h,c6h,deh,97h
+			db	e9h,03h,3ah,80h,cch,41h,cch,e6h
+			db	80h,16h,3eh,c4h,0ch,7bh,78h,6bh
+			db	e4h,5eh,d8h,e3h,02h,ech,31h,cch
+			db	c2h,bdh,0fh,7dh,8fh,29h,cbh,00h
+			db	74h,d7h,9bh,d6h,e4h,73h,efh,7eh
+			db	03h,b1h,72h,9eh,6ah,d8h,dfh,ddh
+			db	01h,e6h,0ch,74h,33h,e6h,e7h,d4h
+			db	45h,a6h,5dh,99h,35h,d5h,7ah,75h
+			db	f5h,47h,f4h,10h,ech,24h,13h,45h
+			db	35h,4bh,b3h,c7h,9fh,3ch,b6h,03h
+			db	68h,83h,bfh,92h,86h,7eh,cdh,40h
+			db	57h,ffh,92h,7ah,80h,a5h,2ch,37h
+			db	bah,b1h,94h,a6h,cdh,42h,1dh,9ch
+			db	a2h,abh,6eh,70h,2dh,cah,13h,89h
+			db	bah,0bh,51h,d3h,1dh,5fh,b7h,c0h
+			db	8dh,83h,68h,7ch,10h,05h,0fh,e4h
+			db	53h,ddh,54h,f9h,dah,65h,6ah,f3h
+			db	94h,dfh,46h,d2h,c8h,03h,89h,38h
+			db	6eh,e8h,d7h,a1h,e6h,22h,b1h,c7h
+			db	d8h,fch,74h,44h,d9h,52h,1dh,6bh
+			db	ffh,dfh,12h,08h,33h,feh,a0h,79h
+			db	75h,ddh,f8h,90h,10h,91h,ebh,a9h
+			db	55h,86h,76h,2ch,8eh,00h,4ah,6ch
+			db	50h,d5h,e4h,48h,3fh,aeh,63h,8dh
+			db	c8h,66h,a6h,fbh,75h,9dh,9fh,fch
+			db	b9h,02h,39h,5bh,3fh,a2h,35h,4eh
+			db	a0h,39h,bfh,91h,0fh,c5h,43h,dah
+			db	78h,c2h,89h,fah,04h,2bh,55h,62h
+			db	7ah,aah,b4h,36h,8ch,34h,60h,96h
+			db	94h,35h,29h,dah,99h,a2h,79h,dah
+			db	8fh,82h,83h,bch,d3h,6fh,34h,cbh
+			db	f2h,c2h,05h,4dh,78h,54h,73h,84h
+			db	24h,d2h,87h,52h,36h,12h,e8h,14h
+			db	e4h,afh,03h,4bh,cah,14h,28h,29h
+			db	7ah,27h,b0h,6bh,cdh,ebh,cch,e6h
+			db	d6h,5fh,3ah,01h,ffh,adh,7ch,02h
+			db	05h,42h,c8h,b7h,c9h,efh,41h,dfh
+			db	32h,13h,18h,bdh,aeh,b7h,1bh,cfh
+			db	c3h,b7h,48h,19h,fah,b6h,29h,14h
+			db	0fh,6fh,07h,9bh,afh,1ah,d8h,32h
+			db	29h,65h,52h,b5h,2eh,74h,17h,49h
+			db	98h,64h,41h,b6h,39h,ach,2bh,adh
+			db	09h,b9h,15h,82h,efh,47h,c9h,d2h
+			db	2eh,47h,52h,95h,81h,bbh,48h,4bh
+			db	adh,34h,b3h,b8h,bbh,0eh,f0h,cdh
+			db	eah,11h,e8h,96h,d3h,afh,34h,79h
+			db	03h,20h,21h,efh,7dh,89h,a0h,b5h
+			db	01h,36h,17h,70h,79h,e0h,cdh,c8h
+			db	67h,ach,f5h,2bh,7ch,90h,07h,8fh
+			db	8bh,13h,4eh,10h,d4h,2eh,e9h,ech
+			db	99h,bch,b2h,ddh,04h,a0h,0bh,17h
+			db	56h,a4h,c7h,eah
+			ld	e,a
+			ld	d,b
+			call	p,L65a5
+			ld	hl,846dh
+			call	nc,Le5f9
+			call	nz,L119b
+			add	hl,sp
+			ld	(2203h),hl
+			dec	e
+			jp	nz,L1a7b
+			ld	d,64h
+			or	b
+			sub	a
+			ld	h,aah
+			adc	a,b
+			and	l
+			cp	h
+			ld	d,h
+			ld	(bc),a
+			ld	h,7ch
+			ld	sp,hl
+			jr	L5a8c
+			db	11h,a2h,34h,11h,77h,edh,96h,2bh
+			db	01h,86h,49h,84h,1dh,3dh,4dh,feh
+			db	84h,99h,c0h,65h,2fh,1eh,4fh,42h
+			db	11h,85h,20h,37h,d4h,11h,36h,28h
+			db	7dh,9fh,cah,7dh,26h,4ah,27h,47h
+			db	93h,f5h,29h,ebh,3dh,6bh,3ch,dah
+			db	fah,f3h,68h,4dh,4bh,71h,02h,7bh
+			db	0ch,38h,37h,00h,69h,19h,f4h,23h
+			db	65h,84h,b2h,5fh
+			or	b
+			ld	h,e
+			jp	p,L9333
+			sbc	a,d
+			dec	(hl)
+			xor	e
+			ret	nz
+			ld	l,l
+			ld	a,h
+			inc	(hl)
+			jp	p,L1c69
+			jp	pe,L44b1
+			pop	bc
+			ret	nc
+			cp	b
+			jp	c,L68ac
+			ld	b,l
+			dec	(hl)
+			xor	a
+			call	c,L4182
+			out	(94h),a
+			jr	c,L5a9c
+			ld	e,l
+			pop	af
+			adc	a,e
+			dec	de
+			sbc	a,b
+			ld	hl,(58aah)
+			call	nc,L847b
+			or	h
+			inc	de
+			scf
+			ld	a,(hl)
+			in	a,(19h)
+			ret	nc
+			ld	d,a
+			call	Lb8aa
+			adc	a,(hl)
+			pop	hl
+			cp	a
+			di
+			or	l
+			adc	a,h
+			call	nc,L4b86
+			sub	d
+			call	nz,L44be
+			ld	b,d
+			rst	30h
+			cp	b
+			dec	hl
+			dec	d
+			sub	e
+			add	a,a
+			ret	nc
+			ld	d,c
+			add	a,d
+			scf
+			ld	l,9dh
+			ld	b,(hl)
+			sub	a
+			halt
+			jp	po,L514c
+			sbc	a,d
+			ld	c,e
+			call	z,La61d
+			ld	h,b
+			add	hl,hl
+			jp	po,Lfecd
+			ccf
+			pop	bc
+			ret	p
+			ld	a,d
+			ld	(hl),h
+			ret
+			db	62h,71h,70h,dfh,cfh,4eh,49h,34h
+			db	34h,abh,bch,e3h,73h,afh,12h,03h
+			db	a3h,03h,5fh,adh,f1h,0fh,cdh,a7h
+			db	70h,48h,3ah,4dh,06h,e8h,72h,67h
+			db	dah,31h,6bh,37h,beh,87h,9ch,9ah
+			db	6dh,0dh,4ch,74h,c8h,2eh,bah,cah
+			db	b6h,99h,26h,05h,92h,d5h,d1h,75h
+			db	d9h,dbh,22h,c4h,6eh,98h,10h,69h
+			db	65h,68h,1ch,61h,92h,84h,f4h,fah
+			db	dbh,90h,a9h,11h,b3h,2dh,91h,86h
+			db	cdh,58h,13h,fdh,57h,18h,d3h,84h
+			db	e1h,b5h,b9h,c9h,79h,21h,93h,ech
+			db	4eh,64h,37h,96h,6dh,d4h,cfh,e8h
+			db	36h,06h,ach,ceh,92h,4dh,fbh,a8h
+			db	24h,95h,5ch,31h,2ah,fch,89h,6bh
+			db	b3h
+			ld	d,dbh
+			ld	a,h
+			ld	c,b
+			or	(hl)
+			and	b
+			or	(hl)
+			adc	a,a
+			ld	(hl),c
+			call	nc,L7b8a
+			rla
+			sbc	a,e
+			call	nc,Lce9c
+			sbc	a,l
+			rst	28h
+			add	a,h
+			halt
+			ld	d,d
+			adc	a,a
+			and	(hl)
+			sbc	a,(hl)
+			xor	d
+			dec	l
+			call	Lf164
+			sbc	a,(hl)
+			ld	b,0fh
+			di
+			ld	a,(8fd2h)
+			and	e
+			xor	d
+			sbc	a,h
+			ld	d,l
+			rst	10h
+			dec	e
+			rlca
+			jr	nc,L5bbc
+			jp	z,Le65f
+			sub	c
+			ld	e,h
+			ld	(hl),l
+			ret	nc
+			ld	b,l
+			ld	h,c
+			sll	h
+			ld	c,h
+			adc	a,a
+			push	bc
+			ld	a,(bc)
+			ld	a,h
+			and	(hl)
+			inc	h
+			nop
+			sub	c
+			ld	a,(54bch)
+			ld	a,(441bh)
+			dec	a
+			cp	l
+			xor	e
+			sub	b
+			ld	b,c
+			ret	c
+			ld	(9b9ch),hl
+			jp	pe,L2758
+			rst	20h
+			ld	l,e
+			push	bc
+			ld	l,d
+			inc	de
+			ccf
+			call	po,Lec3f
+			cp	a0h
+			sub	b
+			call	nc,L8c70
+			rst	30h
+			call	nz,Lb0a4
+			inc	hl
+			push	af
+			ld	a,7eh
+			xor	b
+			ret	nz
+			or	b
+			ld	sp,d749h
+			exx
+			inc	c
+			ld	b,(hl)
+			rra
+			ld	c,b
+			ld	l,(hl)
+			ld	b,c
+			ld	a,a
+			ret	p
+			jr	nz,L5bf9
+			call	po,L2964
+			dec	l
+			sub	c6h
+			ld	h,(hl)
+			rst	08h
+			jp	(hl)
+			db	17h,42h,31h,9dh,b1h,cch,53h
+			ld	d,d
+			ret	po
+			ld	b,b
+			ld	(hl),b
+			inc	bc
+			ld	d,d
+			or	c
+			jp	po,L6439
+			and	l
+			dec	l
+			xor	e
+			ld	c,d
+			jr	nc,L5b91
+			or	c
+			adc	a,c
+			inc	b
+			jr	nz,L5b99
+			nop
+			ld	c,h
+			call	nc,L3dbe
+			or	l
+			dec	c
+			and	(hl)
+			sub	iyh *
+			dec	l
+			ld	(hl),b
+			dec	bc
+			dec	(hl)
+			ld	d,l
+			jp	pe,L0632
+			nop
+			ld	(bc),a
+			ld	a,l
+			add	a,h
+			sub	a
+			add	a,l
+			cp	l
+			add	hl,bc
+			and	e
+			xor	e
+			call	nz,L7da0
+			ld	bc,ecfeh
+			ld	bc,bc70h
+			sub	(hl)
+			ld	e,l
+			dec	e
+			ld	d,b
+			ld	a,11h
+			dec	b
+			add	a,h
+			xor	b
+			sbc	a,a
+			ld	b,e
+			xor	c
+			adc	a,c
+			add	a,l
+			add	a,(hl)
+			sbc	a,l
+			sub	2bh
+			ld	b,h
+			dec	h
+			ld	d,l
+			sbc	a,b
+			xor	e
+			sub	d
+			rst	28h
+			ld	c,a
+			ld	a,(de)
+			ld	c,c
+			ld	a,e
+			inc	d
+			daa
+			call	nz,Le6be
+			jr	nc,L5c30
+			ld	b,c
+			sbc	a,(hl)
+			ld	bc,11cfh
+			jp	L9f22
+			db	d7h,38h,8ch,57h,12h,e7h,a1h,1ah
+			db	04h,10h,b1h,9ch,50h,91h,98h
+			jp	pe,Laca3
+			call	nz,Lb788
+			add	a,c
+			ld	e,c
+			call	z,Lf9d1
+			ld	e,l
+			xor	b
+			add	hl,bc
+			call	p,Lfd91
+			or	d
+			ld	(hl),h
+			and	(hl)
+			call	nz,L91a2
+			add	a,(hl)
+			dec	sp
+			ld	c,h
+			ld	d,e
+			and	c
+			dec	sp
+			pop	bc
+			cp	h
+			or	b
+			dec	hl
+			cp	93h
+			xor	e
+			rst	00h
+			xor	l
+			ld	c,e
+			ld	h,ech
+			ld	b,b
+			ld	l,d
+			or	a
+			or	e
+			ccf
+			ld	d,iyh *
+			ld	(hl),c
+			ex	de,hl
+			cpl
+			add	a,c
+			rst	08h
+			ld	h,l
+			jr	nc,L5c56
+			jr	z,L5c43
+			add	a,93h
+			ld	a,c
+			cpl
+			and	b
+			ld	h,(hl)
+			ld	l,l
+			ld	l,a
+			adc	a,a
+			ld	h,fch
+			ld	c,d7h
+			jp	z,L2b53
+			dec	e
+			ld	b,b
+			ld	c,a
+			ld	(bc),a
+			ld	(hl),d7h
+			jp	z,L15e3
+			add	hl,hl
+			ld	(hl),27h
+			ex	af,af'
+			cp	c
+			push	af
+			djnz	L5d2b
+			rst	08h
+			add	a,h
+			call	Lf13f
+			call	pe,Lf03a
+			dec	bc
+			ld	sp,3f36h
+			ld	l,e
+			ld	h,b
+			sbc	a,b
+			jr	nz,L5ce2
+			xor	e
+			ld	c,d
+			and	(hl)
+			add	hl,hl
+			ld	(bc),a
+			and	e
+			ld	sp,hl
+			ld	c,l
+			add	a,(hl)
+			ld	h,l
+			call	nc,La1a1
+			cp	c
+			sbc	a,a
+			dec	e
+			cp	e
+			jp	nc,L8547
+			sbc	a,l
+			ld	e,d
+			call	c,L408e
+			ld	a,h
+			rst	08h
+			sbc	a,a
+			sbc	a,d
+			sbc	a,d
+			call	z,Ld438
+			ld	a,l
+			or	d
+			ld	e,b
+			nop (2x) *
+			sbc	a,a
+			dec	hl
+			push	af
+			inc	c
+			adc	a,c
+			ld	h,h
+			ld	l,l
+			ld	l,d
+			xor	l
+			ld	e,e
+			and	d
+			nop
+			ld	c,74h
+			ld	a,c
+			adc	a,91h
+			add	a,c
+			inc	sp
+			jr	z,L5ceb
+			ld	a,(bc)
+			ld	e,h
+			ex	(sp),hl
+			cp	h
+			ld	l,d
+			ld	d,d7h
+			add	a,b
+			xor	66h
+			ld	bc,b7a1h
+			ld	h,(hl)
+			ld	(hl),e
+			ld	(hl),h
+			sub	e4h
+			ld	c,l
+			add	a,c
+			sub	h
+			inc	(hl)
+			add	a,h
+			inc	e
+			rlca
+			dec	bc
+			ld	e,l
+			ld	c,h
+			cp	b
+			ld	(hl),b
+			ld	l,d
+			push	bc
+			ld	a,d
+			sub	a
+			sbc	a,l
+			ld	h,h
+			dec	de
+			adc	a,e
+			jr	nz,L5d48
+			ret	m
+			ld	a,c
+			ld	bc,3485h
+			add	a,h
+			ld	hl,a77fh
+			ld	d,c
+			sbc	a,l
+			exx
+			pop	af
+			ld	c,b
+			ld	e,h
+			ld	bc,3640h
+			xor	d
+			ld	a,(bc)
+			ei
+			sbc	a,b
+			ret	po
+			pop	bc
+			sbc	a,e
+			adc	a,56h
+			ex	de,hl
+			add	a,d
+			ld	l,h
+			ld	(hl),d
+			ld	c,h
+			sbc	a,l
+			ld	de,e946h
+			xor	(hl)
+			dec	d
+			rst	08h
+			ld	a,(hl)
+			ld	a,(hl)
+			pop	de
+			adc	a,l
+			sbc	a,d
+			ld	h,c
+			jp	(hl)
+			db	32h,6ch,aah,dbh,aeh,ffh,d8h,cfh
+			db	52h,ech,52h,14h,cah,28h,6fh,cah
+			db	e9h,9eh,9ch,ebh,a5h,2bh,59h,71h
+			db	6ch,15h,8dh,f0h,1dh,80h,29h,d9h
+			db	e1h,4eh,c2h,43h,39h,83h,84h,5dh
+			db	a0h,adh,bdh,a0h,7bh,3ah,89h,2ah
+			db	17h,a9h,cch,e3h,04h,d5h,72h,3ah
+			db	ech,d1h,65h,b0h,30h,2dh,e6h,f3h
+			db	e4h,15h,04h,4fh,f1h,8ch,a1h,e0h
+			db	fah
+			ld	d,(hl)
+			add	a,l
+			rst	18h
+			sbc	a,80h
+			ld	a,(a16ah)
+			scf
+			ld	hl,f680h
+			jp	nc,Lbac1
+			ld	(hl),l
+			add	a,e
+			ld	a,e
+			inc	h
+			ld	(bc),a
+			ld	a,h
+			ld	e,l
+			ld	e,d
+			ld	de,b700h
+			jp	nc,L0f7a
+			rst	08h
+			inc	bc
+			ld	de,9e43h
+			ld	(hl),c
+			adc	a,c
+			ld	e,e
+			ld	b,e
+			and	(hl)
+			rst	18h
+			sbc	a,b
+			ld	l,31h
+			ld	sp,hl
+			sbc	a,5eh
+			add	a,h
+			add	a,d
+			ld	l,c
+			sbc	a,(hl)
+			ld	b,d
+			rst	30h
+			dec	sp
+			ld	b,a
+			cp	h
+			ld	a,(de)
+			ret
+			db	cbh,beh,6ah,50h,73h,13h,f1h,e9h
+			db	fdh,e0h,c5h,cah,b5h,51h,08h,51h
+			db	fbh,b3h,54h,5ch,6fh,43h,f0h,94h
+			db	31h,cfh,19h,56h,c8h,5eh,c0h,15h
+			db	42h,1dh,cdh,a9h,dfh,9eh,a0h,4ah
+			db	b2h,b4h,a9h,d9h,0bh,93h,78h,9ch
+			db	84h,0ch,78h,93h,2eh,92h,d1h,90h
+			db	0fh,b6h,f8h,d2h,46h,fch,79h,90h
+			db	0eh,9ah,fdh,73h,61h,99h,12h,46h
+			db	05h,70h,57h,10h,0fh,39h,18h,0dh
+			db	7eh,e2h,26h,6ah,2ch,e1h,41h,1ch
+			db	7bh,88h,02h,73h,78h,f6h,1ah,50h
+			db	85h,4fh,88h,a5h,30h,13h,57h,8bh
+			db	33h,bfh,79h,eah,38h,0dh,71h,26h
+			db	95h,53h,7bh,1ch,11h,8ch,cfh,b8h
+			db	1ah,75h,d9h,a3h,ceh,f5h,7fh,03h
+			db	94h,f9h,bch,b4h,3fh,3ah,53h,95h
+			db	a6h,a3h,0dh,d8h,24h,42h,08h,d9h
+			db	51h,4dh,41h,57h,5ch,52h,6bh,e1h
+			db	0ch,18h,6dh,d6h,93h,55h,46h,06h
+			db	aeh,f9h,6ch,65h,deh,59h,13h,c4h
+			db	dah,19h,28h,cfh,2bh,ech,feh,a1h
+			db	d7h,66h,3bh,03h,a7h,79h,40h,00h
+			db	0fh,c9h,a5h,cdh,99h,4ah,cah,3bh
+			db	28h,d2h,1ch,25h,c7h,b7h,38h,77h
+			db	78h,76h,7dh,42h,83h,28h,a1h,bbh
+			db	92h,7bh,6bh,2fh,b3h,beh,c0h,03h
+			db	b4h,3ch,e1h,27h,6dh,6ch,abh,3ch
+			db	abh,38h,ddh,fch,b6h,71h,9fh,42h
+			db	cbh,b2h,5fh,55h,b6h,dfh,f2h,07h
+			db	37h,2ch,28h,78h,38h,73h,7eh,79h
+			db	1bh,66h,8ah,d3h,74h,4ch,f8h,d6h
+			db	a9h,47h,57h,2bh,a6h,57h,3ah,31h
+			db	45h,5bh,d1h,4bh,4ah,0bh,78h,5ch
+			db	cdh,f4h,86h,bbh,2ah,11h,3eh,35h
+			db	93h,a8h,37h,15h,cah,c9h,17h,e2h
+			db	3ah,96h,64h,fdh,25h,16h,60h,b3h
+			db	0ah,6eh,f7h,a3h,f1h,efh,25h,e6h
+			db	52h,bbh,06h,ceh,0bh,5bh,c8h,d3h
+			db	2fh,78h,c4h,ceh,0ch,55h,5ah,22h
+			db	e4h,20h,3ch,e6h,14h,54h,f5h,18h
+			db	20h,f4h,92h,64h,9eh,0ah,63h,b2h
+			db	bdh,36h,77h,8ah,b8h,92h,cbh,b1h
+			db	bfh,a6h,edh,57h,84h,7dh,85h,34h
+			db	a1h,3eh,a4h,43h,d0h,d2h,1bh,e7h
+			db	0ah,60h,2dh,2eh,69h,42h,7ah,50h
+			db	3ah,4fh,b6h,59h,7ah,a2h,d6h,d5h
+			db	ceh,2ch,c0h,83h,f2h,3bh,c8h,a4h
+			db	d9h,a7h,64h,09h,d0h,efh,ceh,11h
+			db	dfh,efh,8ah,2dh,46h,13h,b5h,cfh
+			db	5ch,7bh,16h,ach,16h,2dh,c1h,0eh
+			db	54h,ech,0ah,b2h,77h,97h,f3h,30h
+			db	c0h,26h,02h,d5h,aah,4ch,63h,86h
+			db	aah,6eh,85h,f3h,59h,38h,13h,47h
+			db	cdh,e7h,39h,fah,46h,e4h,b8h,1eh
+			db	5ah,62h,c6h,06h,10h,deh,74h,3dh
+			db	49h,9dh,b7h,1eh,a7h,0eh,adh,64h
+			db	c4h,4eh,26h,3bh,e7h,4fh,9eh,e5h
+			db	fdh,43h,55h,8dh,efh,cdh,9eh,4ah
+			db	ebh,dfh,a0h,4dh,45h,18h,cbh,9eh
+			db	36h,76h,54h,c2h,3ah,3ch,52h,09h
+			db	76h,ebh,84h,91h,d6h,73h,0bh,08h
+			db	53h,69h,19h,e8h,05h,2ch,58h,f1h
+			db	2eh,76h,e8h,dbh,5ch,88h,03h,11h
+			db	48h,e4h,76h,00h,b4h,f3h,6ah,07h
+			db	1eh,96h,10h,0eh,57h,e1h,f8h,c0h
+			db	aah,6fh,63h,74h,73h,adh,75h,6ah
+			db	05h,ech,aah,3bh,0dh,37h,69h,9ah
+			db	51h,99h,69h,82h,1dh,3dh,96h,83h
+			db	24h,33h,c5h,f1h,36h,4ch,b1h,55h
+			db	dah,edh,0fh,bfh,e0h,18h,53h,2dh
+			db	0eh,87h,deh,c9h,ebh,1fh,33h,08h
+			db	2bh,69h,b2h,e5h,22h,53h,65h,9bh
+			db	b9h,b0h,7ch,e4h,39h,b4h,e6h,45h
+			db	8eh,1dh,87h,83h,bah,68h,b1h,a4h
+			db	fbh,29h,beh,42h,3eh
+			sbc	a,h
+			ld	e,a
+			rst	30h
+			inc	c
+			ld	l,l
+			ld	a,(e900h)
+			xor	b
+			add	a,e
+			ld	c,l
+			dec	bc
+			adc	a,l
+			ld	sp,8ed0h
+			dec	c
+			adc	a,c
+			inc	sp
+			ld	h,fdh
+			or	77h
+			ld	b,e
+			in	a,(20h)
+			adc	a,d
+			rst	18h
+			ret	nc
+			jr	nc,L60c8
+			ld	a,l
+			ld	a,a
+			ret	pe
+			dec	de
+			dec	e
+			inc	l
+			dec	c
+			inc	d
+			ld	b,l
+			cp	h
+			rla
+			jr	z,L60bb
+			ld	c,l
+			cp	b
+			jp	L4923
+			db	b7h,0ah,07h,beh,1eh,f0h,57h,9fh
+			db	0eh,2fh,59h,21h,aah,ebh,03h,20h
+			db	45h,3ah,7bh,b2h,29h,f6h,5bh,67h
+			db	53h,01h,e3h,31h,62h,1ch,e3h,6fh
+			db	65h,04h,d5h,cch,82h,21h,3bh,32h
+			db	deh,f9h,deh,ddh,85h,03h,a2h,a7h
+			db	77h,90h,e1h,2eh,64h,c6h,3ah,9ch
+			db	1bh,76h,74h,03h,57h,b6h,f8h,90h
+			db	fah
+			rst	08h
+			ld	(bc),a
+			ld	l,h
+			xor	d
+			dec	hl
+			ld	sp,c83dh
+			ret	pe
+			xor	e
+			di
+			ld	e,b
+			or	b
+			ld	(023bh),hl
+			di
+			ccf
+			call	po,Lf7c7
+			inc	hl
+			ld	d,h
+			rlca
+			jr	nc,L60e9
+			jp	z,Lb986
+			add	a,d
+			and	c
+			xor	a
+			ld	l,b3h
+			ld	l,d
+			ld	(hl),l
+			ex	af,af'
+			sbc	a,a
+			dec	a
+			ld	a,(bc)
+			call	p,L00cd
+			xor	h
+			ld	e,e
+			jp	nc,Lc84c
+			ld	(bc),a
+			exx
+			ld	a,44h
+			nop (2x) *
+			xor	b
+			pop	de
+			push	hl
+			xor	(hl)
+			inc	hl
+			ld	c,l
+			ld	b,e
+			dec	b
+			scf
+			rla
+			ld	d,h
+			exx
+			sbc	a,a
+			dec	d
+			halt
+			in	a,(a1h)
+			jp	p,La7d6
+			adc	a,(hl)
+			call	c,L7d18
+			add	a,b
+			pop	bc
+			xor	08h
+			sbc	a,h
+			or	e
+			and	b
+			ld	b,d
+			inc	bc
+			ld	a,(dda4h)
+			and	(hl)
+			cp	(hl)
+			or	c
+			ld	h,a
+			and	b
+			ld	a,a
+			jp	po,L10a5
+			ld	d,a
+			rst	28h
+			xor	c
+			pop	hl
+			sub	a
+			and	l
+			ld	d,b
+			ret	p
+			rst	38h
+			or	l
+			ld	c,(hl)
+			inc	c
+			ld	c,d
+			or	h
+			ld	(hl),a
+			cp	l
+			ld	sp,hl
+			sbc	a,d
+			ld	(hl),h
+			rst	18h
+			ld	h,(hl)
+			ld	b,c
+			ld	h,(hl)
+			sbc	a,17h
+			adc	a,cdh
+			rst	08h
+			call	nz,Lad14
+			ld	hl,(1d47h)
+			call	pe,L70c5
+			ld	l,l
+			pop	bc
+			sub	h
+			cp	c
+			and	57h
+			add	a,feh
+			ld	l,h
+			ld	e,a
+			pop	af
+			ld	b,e
+			jr	nz,L61c8
+			rrca
+			ld	e,e
+			pop	af
+			cp	l
+			and	e
+			nop (2x) *
+			or	e2h
+			pop	de
+			dec	de
+			ld	de,e32bh
+			ld	b,c
+			ld	b,80h
+			sbc	a,c
+			ld	(a84ah),hl
+			ld	c,l
+			ld	b,c
+			dec	a
+			rst	28h
+			or	a3h
+			djnz	L60fc
+			ld	a,b
+			sub	(hl)
+			xor	(hl)
+			ld	d,a
+			add	hl,de
+			ld	a,h
+			ld	l,0dh
+			jr	L60fc
+			db	45h,0ch,3dh,01h,39h,49h,cch,50h
+			db	aeh,10h,b6h,29h,37h,6fh,b6h,6eh
+			db	71h,c3h,eeh,cch,8fh,68h,7ch,e7h
+			db	e0h,b7h,90h,0ch,69h,1fh,98h,94h
+			db	0fh,94h,88h,16h,96h,1bh,d1h,1ch
+			db	e2h,74h,8fh,3eh,c8h,43h,85h,c5h
+			db	9bh,deh,d1h,c7h,e3h,65h,16h,94h
+			db	a7h,46h,e1h,74h,12h,96h,edh,c7h
+			db	27h,2bh,6ah,4eh,4ch,cch,12h,84h
+			db	7eh,61h,74h,54h,98h,efh,dbh,6ch
+			db	1fh
+			jr	z,L614c
+			ld	c,(hl)
+			inc	(hl)
+			rla
+			ld	a,d
+			inc	bc
+			ld	c,a
+			and	4ch
+			add	a,l
+			ld	l,a
+			sbc	a,d
+			jp	(hl)
+			db	eah,3bh,edh,0dh,88h,54h,98h,55h
+			db	c4h,01h,0fh,31h,68h,b6h,98h,fah
+			db	ddh,9fh,cah,f4h,efh,adh,53h,efh
+			db	0ah,7ch,62h,7ah,64h,e5h,a5h,aah
+			db	65h,d5h,32h,14h,81h,5bh,6eh,b7h
+			db	bah,48h,3ch,32h,38h,3ah,cbh,c3h
+			db	5fh,15h,16h,2eh,e9h,70h,9ch,6ah
+			db	fah,5eh,53h,6bh,5bh,25h,a3h,9eh
+			db	c2h,cch,97h,6fh,67h,91h,b5h,9ch
+			db	0ch,84h,a3h,3fh,91h,cah,08h,d9h
+			db	9bh,cfh,9ah,32h,50h,80h,88h,8bh
+			db	05h,92h,71h,36h,15h,24h,5ah,48h
+			db	17h,45h,a4h,cdh,6eh,d6h,f3h,34h
+			db	15h,c3h,a3h,dah,84h,61h,40h,29h
+			db	47h,4fh,69h,cah,57h,9ch,cch,f8h
+			db	2ch,60h,e8h,2ch,96h,39h,63h,65h
+			db	0ah,d6h,26h,92h,a6h,eah,8fh,f9h
+			db	c3h,c6h,b6h,62h,6ch,69h,70h,d9h
+			db	9dh,96h,a2h,b7h,29h,d3h,abh,0ah
+			db	92h,68h,86h,7bh,eeh,d4h,07h,0dh
+			db	e7h,77h,33h,19h,c3h,e7h,41h,cdh
+			db	a2h,24h,16h,25h,7dh,82h,c7h,3bh
+			db	1fh,1fh,65h,e8h,94h,46h,f9h,8ah
+			db	b0h,eeh,54h,0ah,0dh,ddh,80h,e8h
+			ei
+			ld	a,c
+			sbc	a,cah
+			ret	c
+			rst	38h
+			cp	c
+			ret	nz
+			ld	b,l
+			sub	f6h
+			inc	h
+			sbc	a,h
+			add	a,feh
+			ld	a,(de)
+			inc	d
+			ld	a,b
+			ld	l,c
+			add	a,(hl)
+			xor	h
+			and	1ch
+			djnz	L62d8
+			ld	e,e
+			cp	c
+			sub	h
+			sbc	a,9eh
+			adc	a,a
+			ld	c,(hl)
+			dec	hl
+			ld	a,b
+			call	c,L4811
+			ld	a,h
+			ld	(de),a
+			sub	b
+			or	2bh
+			cp	l
+			ld	d,(hl)
+			ld	(hl),e
+			or	b
+			ld	a,l
+			inc	a
+			cp	b
+			dec	sp
+			ld	h,e
+			rst	10h
+			ld	h,b
+			dec	l
+			ld	d,e
+			ld	a,9ah
+			adc	a,c
+			cpl
+			xor	d
+			rra
+			or	l
+			rla
+			nop
+			exx
+			xor	h
+			dec	c
+			xor	c
+			dec	h
+			ld	(hl),a
+			ld	b,c
+			or	b
+			and	c
+			ld	c,e
+			rlca
+			dec	d
+			cp	e
+			pop	af
+			dec	sp
+			cp	a
+			ld	a,e
+			ld	b,h
+			djnz	L62a0
+			ld	l,a
+			ld	e,l
+			ld	e,c
+			adc	a,h
+			or	77h
+			daa
+			dec	sp
+			ld	(hl),97h
+			ld	bc,0ea6h
+			and	93h
+			sbc	a,(hl)
+			push	af
+			rst	20h
+			ld	(de),a
+			ld	de,a5dbh
+			sub	l
+			jr	L631e
+			db	8ah,40h,2bh,46h,50h,9fh,bdh,afh
+			db	81h,9eh,45h,34h,b5h,1dh,f2h,46h
+			db	4eh,bdh,f5h,91h
+			inc	bc
+			ld	a,h
+			ld	a,e
+			cp	b
+			ld	a,c
+			ld	(hl),d
+			call	m,L9b37
+			ld	e,h
+			di
+			add	a,(hl)
+			sub	b
+			ld	d,l
+			inc	l
+			xor	bbh
+			ld	e,05h
+			ex	(sp),hl
+			call	pe,Ld0b5
+			xor	d
+			ld	c,a
+			xor	l
+			xor	c
+			xor	(hl)
+			inc	e
+			ld	c,d3h
+			ld	e,(hl)
+			ld	b,39h
+			ld	h,dfh
+			and	d
+			adc	a,c
+			ld	l,ddh
+			inc	l
+			ret
+			db	0ah,ebh,1bh,26h,6dh,0bh,49h,6ch
+			db	bah,a1h,49h,5ch,ech,4dh,5eh,7ah
+			db	99h,c7h,d8h,96h,18h,04h,dbh,f9h
+			db	19h,4dh,53h,19h,6fh,4fh,9ah,bch
+			db	34h,4fh,4eh,05h,d3h,ddh,f1h,c4h
+			db	07h,cah,9fh,ach,fbh,0ch,a8h,0dh
+			db	b4h,55h,f6h,41h,d2h,bfh,2ch,5ah
+			db	d0h,e1h,58h,05h,cch,65h,b9h,6fh
+			db	3dh,1fh,0fh,97h,a9h,80h,2ch,3ch
+			db	20h,c9h,9fh,e6h,f4h,ach,77h,08h
+			db	41h,deh,ffh,afh,d9h,4ah,eah,40h
+			db	3bh,cbh,a2h,8ah,14h,4fh,04h,c1h
+			db	bdh,32h,f4h,cdh,adh,61h,12h,7fh
+			db	23h,e8h,66h,03h,80h,4dh,8eh,53h
+			db	4ch,15h,c1h,94h,30h,b7h,afh,02h
+			db	87h,d6h,4bh,9eh,7fh,56h,99h,2fh
+			db	c4h,43h,b6h,e9h,0ah,78h,5dh,78h
+			db	d3h,d7h,feh,e6h,cah,37h,78h,0bh
+			db	9fh,7bh,2ch,7eh,e1h,09h,99h,2ch
+			db	38h,8fh,e0h,61h,65h
+			or	d
+			ld	(hl),d
+			sbc	a,(hl)
+			or	h
+			ld	a,d
+			ld	e,(hl)
+			ld	a,(d054h)
+			ld	a,a
+			dec	l
+			dec	hl
+			inc	de
+			ld	c,h
+			inc	b
+			jp	nz,Lce0b
+			ld	b,1dh
+			inc	(hl)
+			cp	a
+			jp	pe,Ledfc
+			dec	e
+			add	a,b
+			and	a
+			ld	hl,(d25ah)
+			ei
+			sub	l
+			and	b
+			inc	sp
+			call	z,Lf9a2
+			or	(hl)
+			ld	h,a
+			sbc	a,d
+			ld	a,b
+			jr	L63ea
+			db	ebh,cdh,08h,29h,62h,eeh,59h,3ch
+			db	8dh,9eh,1ch,1ah,93h,78h,09h,c4h
+			db	8eh,d9h,bfh,cdh,47h,0dh,79h,4bh
+			db	dfh,65h,26h,6bh,77h,46h,c2h,bdh
+			db	d2h,c2h,7ah,52h,bfh,f7h,29h,87h
+			db	8dh,0bh,b3h,fch,a1h,ach,9dh
+			ld	e,e
+			or	a
+			inc	b
+			bit	0,c
+			nop (2x) *
+			ld	(bc),a
+			ld	(hl),b
+			nop (2x) *
+			ex	de,hl
+			add	hl,hl
+			sub	d
+			inc	hl
+			cp	d
+			dec	h
+			ld	sp,f1c3h
+			adc	a,e8h
+			ld	h,h
+			cp	c
+			ld	h,b
+			ld	a,l
+			jr	nc,L6490
+			ld	b,e
+			xor	a
+			adc	a,c
+			xor	7dh
+			ld	sp,hl
+			pop	bc
+			inc	bc
+			inc	(hl)
+			and	a
+			ld	h,h
+			adc	a,b
+			ld	e,e
+			ld	d,d
+			ei
+			pop	de
+			and	(hl)
+			dec	c
+			cpl
+			and	a
+			inc	c
+			ld	b,e
+			ld	l,b
+			di
+			sub	l
+			cp	a
+			ret	nc
+			ld	d,(hl)
+			or	b
+			pop	de
+			xor	e
+			sub	b
+			ld	a,b
+			cp	d
+			ld	h,e
+			and	06h
+			xor	(hl)
+			adc	a,c
+			add	hl,bc
+			ld	e,a
+			add	hl,sp
+			cp	l
+			ld	a,a5h
+			rst	30h
+			ld	b,e
+			cp	d
+			xor	(hl)
+			rst	20h
+			ld	bc,6ff8h
+			ld	e,(hl)
+			rst	10h
+			dec	bc
+			cp	a
+			call	m,L649c
+			ld	d,a
+			ld	l,l
+			ld	h,b
+			jp	nc,Lc8d8
+			ld	e,a
+			ld	a,c
+			xor	(hl)
+			ccf
+			ex	af,af'
+			add	a,(hl)
+			ld	h,e
+			jr	nz,L6439
+			ld	b,bfh
+			ld	d,a
+			call	pe,L6b09
+			ld	c,(hl)
+			daa
+			ld	c,(hl)
+			rst	38h
+			ld	(iy + 6ah),h
+			jp	Lda89
+			db	c9h,1bh,b8h,83h,bah
+			ld	a,c
+			ld	a,(hl)
+			ld	e,a
+			ld	sp,hl
+			sub	a
+			push	af
+			ld	(bc),a
+			add	a,d
+			nop (2x) *
+			ld	c,c
+			add	a,h
+			ld	b,l
+			ei
+			ld	h,l
+			ld	hl,(c53dh)
+			inc	e
+			sub	h
+			ex	af,af'
+			or	b
+			rst	18h
+			add	a,(hl)
+			cp	23h
+			ld	(hl),d
+			and	d
+			inc	sp
+			dec	bc
+			adc	a,e
+			nop
+			ld	a,e
+			ld	h,(hl)
+			inc	c
+			ld	c,d
+			ld	b,c
+			ld	e,b
+			ld	d,(hl)
+			sbc	a,c
+			ld	b,(hl)
+			add	a,(hl)
+			jp	m,Laf64
+			dec	e
+			ld	e,h
+			exx
+			ld	l,ffh
+			and	48h
+			adc	a,c
+			ld	h,83h
+			ld	l,(hl)
+			inc	(hl)
+			inc	l
+			inc	(hl)
+			ex	de,hl
+			ld	(hl),d
+			ld	a,0bh
+			call	pe,L3b5d
+			jp	pe,L7c11
+			ld	(hl),d
+			xor	c0h
+			xor	l
+			res	2,(hl)
+			add	hl,hl
+			xor	8bh
+			add	a,d
+			jp	po,Ld342
+			sub	l
+			dec	b
+			ld	l,28h
+			ld	(hl),c
+			ld	c,b
+			and	a
+			ret	nz
+			jp	(hl)
+			db	1eh,41h,c0h,27h,01h,87h,77h,2eh
+			db	e1h,e7h,b6h,97h,bah,52h,87h,b8h
+			db	78h,17h,2dh,2eh,6dh,fdh,26h,e9h
+			db	0eh,cdh,86h,c6h,aah,86h,2bh,09h
+			db	d9h,c9h,d7h,44h,4eh,28h,c9h,b5h
+			db	47h,15h,84h,2fh,31h,efh,95h,efh
+			db	cch,5fh,68h,62h,17h,d6h,c6h,85h
+			db	39h,28h,fdh,bch,97h,21h,57h,f0h
+			db	84h,23h,87h,cbh,fbh,1eh,81h,16h
+			db	7dh,e9h
+			xor	e
+			cp	l
+			ld	(f16fh),a
+			sbc	a,b
+			ld	a,d
+			add	a,0fh
+			ld	a,l
+			ld	c,b
+			cp	l
+			ret	po
+			ld	e,h
+			adc	a,a
+			or	d
+			sbc	a,c
+			ld	h,l
+			jr	nz,L655e
+			and	l
+			sbc	a,(hl)
+			ex	de,hl
+			push	af
+			sbc	a,h
+			and	b
+			ld	e,a
+			di
+			ld	e,c
+			ld	d,(hl)
+			ld	(hl),e
+			ld	c,c
+			ld	d,l
+			adc	a,c
+			or	d
+			ld	b,h
+			adc	a,a
+			dec	sp
+			and	(hl)
+			call	z,L31e8
+			sbc	a,b
+			ld	c,(hl)
+			dec	d
+			dec	sp
+			sbc	a,a
+			adc	a,d
+			inc	h
+			rlca
+			ld	(hl),d
+			cpl
+			ret	p
+			halt
+			inc	l
+			adc	a,c
+			ld	h,e
+			dec	l
+			scf
+			xor	d
+			ret	p
+			dec	e
+			cp	c
+			adc	a,b
+			ld	c,a
+			ld	h,b
+			sub	c
+			rst	08h
+			ld	a,(hl)
+			ld	d,b
+			nop (2x) *
+			or	a
+			rra
+			pop	de
+			sbc	a,a
+			dec	(hl)
+			ld	e,e
+			dec	iyl *
+			ld	e,a
+			push	hl
+			ld	e,b
+			ld	c,l
+			and	l
+			dec	h
+			pop	de
+			pop	hl
+			adc	a,c
+			or	09h
+			rst	08h
+			dec	sp
+			cp	d
+			ld	b,c
+			ld	(hl),d
+			sub	e
+			jr	nz,L656f
+			inc	d
+			adc	a,efh
+			dec	e
+			xor	h
+			ld	l,(hl)
+			dec	l
+			ld	l,5fh
+			or	c
+			ld	a,l
+			sbc	a,(hl)
+			inc	b
+			call	nc,L7bde
+			ld	e,a
+			ld	e,e
+			inc	(hl)
+			ex	af,af'
+			ld	(bc),a
+			ld	hl,4d77h
+			adc	a,d
+			sbc	a,(hl)
+			cp	9dh
+			inc	d
+			dec	c
+			jp	c,L1a2b
+			push	bc
+			ld	d,l
+			or	h
+			ld	sp,ac5dh
+			dec	(hl)
+			or	(hl)
+			sll	h
+			sub	c
+			ld	c,l
+			rst	28h
+			add	a,h
+			ld	e,b
+			sbc	a,a
+			ld	a,b
+			jr	c,L665d
+			cp	e
+			rst	18h
+			ld	h,c
+			inc	a
+			scf
+			and	(hl)
+			add	a,h
+			ld	c,a
+			jr	nz,L657d
+			ld	c,l
+			add	a,b
+			call	pe,L9547
+			ld	b,b
+			ld	(bc),a
+			ld	b,c
+			or	(hl)
+			xor	c
+			or	l
+			sub	0bh
+			scf
+			or	h
+			ccf
+			rst	20h
+			inc	h
+			or	l
+			rra
+			ld	l,cah
+			ld	(hl),b
+			call	L5c30
+			ld	d,b
+			inc	b
+			rst	20h
+			ld	c,e
+			adc	a,c
+			dec	a
+			or	(hl)
+			dec	sp
+			sub	b
+			cpl
+			cp	c
+			ex	de,hl
+			ld	(hl),b
+			rra
+			ld	b,b
+			ld	l,l
+			ld	h,(hl)
+			ld	b,c
+			jp	L4745
+			db	e4h,f7h,fah,01h,19h,d2h,17h,adh
+			db	10h,11h,e8h,d9h,4ch,beh,8fh,d7h
+			ld	b,c
+			add	a,l
+			ld	c,a
+			ld	l,l
+			adc	a,l
+			pop	hl
+			rst	10h
+			sbc	a,a
+			ld	d,(hl)
+			ld	b,l
+			cp	e
+			ld	sp,hl
+			add	a,h
+			sub	(hl)
+			dec	h
+			inc	b
+			jp	po,Lbd57
+			cp	b
+			sub	43h
+			ld	b,d
+			ld	l,(hl)
+			and	d
+			ld	l,c
+			dec	a
+			sbc	a,h
+			jr	L6691
+			db	84h,a5h,32h,d3h,7dh,62h,bah,b4h
+			db	e7h
+			nop
+			ld	b,a
+			nop (2x) *
+			ld	a,b
+			sub	c
+			xor	(hl)
+			ld	(hl),a
+			ld	a,(hl)
+			adc	a,e
+			rst	00h
+			dec	h
+			ld	b,a
+			ld	e,h
+			ld	c,(hl)
+			dec	bc
+			ld	a,a
+			ld	(4c50h),hl
+			jp	c,L0107
+			ld	a,(hl)
+			or	e
+			halt
+			jr	nz,L66f4
+			ld	h,b7h
+			dec	de
+			jr	nc,L6614
+			call	m,L29ef
+			ex	de,hl
+			dec	(hl)
+			ld	c,a
+			or	l
+			exx
+			jp	nc,Ld7f3
+			daa
+			ld	(hl),c
+			jp	L3891
+			db	7ch,86h,b3h
+			jp	nc,L4dc4
+			exx
+			rst	08h
+			sbc	a,a
+			ld	l,c
+			ld	d,h
+			ld	l,d
+			call	z,L2c02
+			or	c
+			or	h
+			cp	9ch
+			adc	a,e
+			and	6fh
+			ld	c,(hl)
+			adc	a,e
+			push	bc
+			sbc	a,l
+			ld	l,c
+			or	e
+			add	a,e
+			jp	z,L0ee0
+			adc	a,a
+			sbc	a,a
+			dec	(hl)
+			call	z,Lf57b
+			add	a,c
+			jp	p,L49d1
+			and	c
+			ld	b,h
+			call	nz,Lbe15
+			daa
+			add	hl,sp
+			sbc	a,e
+			and	a
+			rla
+			inc	c
+			call	c,L89b8
+			dec	(hl)
+			ld	e,c
+			sub	a
+			ld	(de),a
+			rst	00h
+			add	a,b
+			exx
+			nop
+			ld	b,e
+			rst	10h
+			djnz	L669d
+			ei
+			inc	de
+			rst	00h
+			or	l
+			ret	z
+			ei
+			inc	d
+			pop	de
+			dec	b
+			rst	30h
+			ld	de,9895h
+			adc	a,b
+			ld	(hl),d
+			add	a,a
+			sub	c
+			add	a,h
+			ld	h,h
+			add	hl,de
+			adc	a,2ch
+			and	h
+			add	a,c
+			and	c
+			call	c,L2b01
+			ld	e,a
+			call	nz,L18bc
+			sbc	a,a
+			sub	l
+			ld	l,e
+			adc	a,d
+			add	a,a
+			ld	a,l
+			out	(a5h),a
+			adc	a,a
+			ld	h,a0h
+			ld	d,h
+			add	a,b
+			ld	b,e
+			call	Lfd34
+			res	5,l
+			sub	l
+			sbc	a,a
+			ld	l,e
+			ld	l,d
+			scf
+			ld	e,c
+			dec	e
+			ld	d,c
+			cp	d
+			or	h
+			dec	de
+			inc	bc
+			ccf
+			or	(hl)
+			xor	28h
+			ld	c,5bh
+			ld	(hl),d
+			push	af
+			add	a,b
+			pop	af
+			cp	b
+			ld	de,6290h
+			pop	af
+			xor	7ch
+			inc	c
+			ld	b,0fh
+			cp	b
+			ld	(hl),e9h
+			add	hl,hl
+			sub	l
+			pop	bc
+			sbc	a,34h
+			or	b
+			ld	a,l
+			add	a,e
+			inc	bc
+			ld	(de),a
+			cp	l
+			or	l
+			sbc	a,a
+			ld	d,a
+			add	a,d
+			inc	hl
+			ld	h,d
+			bit	5,d
+			add	a,d2h
+			ret	p
+			ld	b,d
+			dec	d
+			sbc	a,c
+			ld	c,c
+			ld	a,16h
+			ld	d,(hl)
+			cp	d
+			adc	a,5ch
+			sub	h
+			inc	(hl)
+			dec	d
+			adc	a,b
+			ld	sp,hl
+			call	m,L49e4
+			daa
+			rlca
+			inc	(hl)
+			sub	a
+			ld	c,a
+			sub	9ah
+			ld	(hl),d
+			ld	a,32h
+			sbc	a,a
+			sub	h
+			and	d
+			ld	e,eeh
+			nop (2x) *
+			inc	bc
+			jp	z,L6e47
+			jp	nc,Lf36f
+			ld	h,(hl)
+			and	a
+			ld	d,l
+			sub	l
+			ld	b,l
+			xor	b
+			ld	c,b
+			rlca
+			ld	h,l
+			ld	e,a
+			add	a,7bh
+			adc	a,46h
+			ld	(hl),d
+			ld	l,b
+			cp	h
+			ld	a,9dh
+			ld	l,e
+			or	a
+			ld	l,d
+			call	nc,Lda23
+			call	nc,Led6b
+			inc	c
+			ret	pe
+			rst	10h
+			or	b
+			ld	(hl),d
+			dec	h
+			ld	(hl),a
+			sbc	a,h
+			ld	a,l
+			rra
+			ld	d,l
+			sub	a
+			xor	a
+			ld	l,a2h
+			ld	l,(hl)
+			ld	(bc),a
+			sbc	a,h
+			ld	l,63h
+			ld	e,(hl)
+			ld	d,h
+			xor	a
+			push	de
+			pop	de
+			and	ixh *
+			or	64h
+			dec	bc
+			inc	sp
+			dec	sp
+			xor	c
+			ld	b,a
+			add	hl,sp
+			dec	hl
+			ld	a,h
+			sub	afh
+			sbc	a,d
+			pop	de
+			ld	e,l
+			adc	a,a
+			push	af
+			and	74h
+			ld	a,h
+			sub	6bh
+			ld	c,6ch
+			rst	28h
+			dec	hl
+			jp	p,Lb5b9
+			ld	de,9aeeh
+			rst	10h
+			sub	e
+			ld	a,d
+			or	a
+			pop	bc
+			or	d
+			or	a
+			ld	d,a
+			or	bah
+			jr	nc,L6778
+			ei
+			call	pe,Laafa
+			ld	b,(hl)
+			ld	bc,c0bfh
+			ld	l,a
+			and	e6h
+			jp	nz,L08a1
+			and	e
+			and	(hl)
+			jr	L6816
+			db	61h,3ch,98h,c1h,3fh,19h,0ah,1eh
+			db	76h,28h,6eh,62h,6ch,e3h,1eh,ddh
+			db	31h,deh,7eh,4dh,91h,28h,d1h,53h
+			db	f3h,ebh,e5h,32h,dfh,33h,99h,b3h
+			db	3ch,83h,5ch,a5h,a1h,20h,7bh,62h
+			db	11h,47h,f9h,92h,41h,87h,7eh,ebh
+			db	4fh,b9h,28h,c7h,1ch,0fh,f8h,e2h
+			db	39h,eah
+			ld	b,c
+			xor	(hl)
+			jp	(hl)
+			db	b9h,e1h,59h,48h,f7h,d1h,7ch,12h
+			db	1fh,5dh,e3h,e5h,cfh,91h,09h,7bh
+			db	00h,6ch,3dh,f0h,08h,deh,bfh,82h
+			db	dch,bbh,f1h,24h,7dh,2ah,48h,c7h
+			db	bbh,93h,94h,f2h,06h,2dh,13h,8dh
+			db	16h,27h,5fh,3ah,7fh,0ah,48h,f4h
+			db	3eh,1bh,0eh,91h,e8h,80h,3eh,1bh
+			db	16h,11h,aeh,90h,4bh,b3h,dbh,abh
+			db	98h,27h,88h,e4h,64h,22h,65h,58h
+			db	a2h,8dh,abh,f8h,c1h,58h,3ah,20h
+			db	94h,d1h,57h,6fh,40h
+			rlca
+			ld	h,d
+			daa
+			ld	b,l
+			or	h
+			add	a,e
+			sbc	a,h
+			cp	(hl)
+			or	b
+			ld	bc,3f73h
+			add	a,a7h
+			inc	e
+			ret	z
+			ld	(8acah),hl
+			rst	10h
+			jp	pe,L6bf6
+			sbc	a,a8h
+			ld	h,89h
+			add	a,96h
+			call	p,L9c21
+			ld	e,(hl)
+			ld	(hl),c
+			ld	h,c
+			ret	p
+			ld	d,l
+			ld	a,(de)
+			rla
+			ret	pe
+			rst	28h
+			ld	(hl),a
+			xor	43h
+			or	(hl)
+			ld	c,e
+			call	z,L6ddb
+			inc	e
+			ret	m
+			ld	(cd6fh),hl
+			rst	20h
+			ld	c,a
+			ld	h,c
+			or	h
+			cp	e
+			add	a,b
+			ret	nz
+			inc	de
+			scf
+			sub	h
+			push	hl
+			ld	l,d
+			ld	(hl),d
+			out	(e0h),a
+			ld	(hl),e
+			jr	nc,L68cc
+			cp	(hl)
+			ld	(hl),e
+			ld	(de),a
+			adc	a,e
+			cp	a
+			inc	b
+			ld	(bc),a
+			rst	20h
+			dec	bc
+			sbc	a,d
+			rst	18h
+			dec	(hl)
+			pop	hl
+			nop (2x) *
+			cpl
+			ld	de,a6d7h
+			adc	a,e
+			adc	a,d
+			ld	b,c
+			sbc	a,c
+			dec	b
+			ld	l,d
+			ld	l,d
+			sbc	a,e
+			ld	l,d4h
+			ret	nz
+			dec	c
+			ld	(de),a
+			and	d
+			ld	h,d
+			call	p,Ld782
+			cp	h
+			sbc	a,23h
+			sbc	a,h
+			ex	de,hl
+			ld	e,l
+			adc	a,e
+			ld	b,a
+			push	hl
+			ld	b,(hl)
+			ld	a,l
+			call	nz,L8605
+			inc	(hl)
+			xor	a
+			ld	de,5c26h
+			add	a,b
+			inc	a
+			add	hl,de
+			ld	(hl),e
+			ld	(hl),c
+			inc	bc
+			jp	p,L2122
+			dec	(hl)
+			sbc	a,d
+			xor	e
+			add	a,l
+			ld	bc,8e1eh
+			sbc	a,a
+			and	a
+			add	a,a
+			sub	a
+			ld	c,c
+			rlca
+			inc	e
+			call	nc,Lbf68
+			ld	(hl),c
+			nop (2x) *
+			dec	de
+			rla
+			push	af
+			ld	b,e
+			sbc	a,e
+			ex	af,af'
+			ld	a,c
+			ld	c,b
+			rst	20h
+			and	b
+			sbc	a,(hl)
+			or	0fh
+			call	m,L8d6a
+			ld	hl,17e1h
+			inc	(hl)
+			jp	nz,Le246
+			add	a,d
+			ld	l,a
+			add	a,e
+			cp	a
+			inc	h
+			ld	c,l
+			jp	po,L698f
+			dec	c
+			ret	po
+			jr	nz,L68ae
+			ld	d,h
+			ld	c,b
+			ld	e,e
+			or	e
+			ld	l,cbh
+			ld	c,a
+			jr	z,L68da
+			ret	nc
+			sbc	a,h
+			ld	a,h
+			jr	z,L6989
+			sub	(hl)
+			and	h
+			ld	h,c
+			pop	de
+			ld	l,d
+			add	a,76h
+			ld	a,e
+			ld	a,(de)
+			push	de
+			inc	bc
+			ld	bc,654eh
+			add	a,e
+			and	85h
+			add	hl,de
+			ex	(sp),hl
+			ld	a,(de)
+			push	af
+			jp	po,L63de
+			xor	fah
+			ld	c,l
+			ld	a,2bh
+			ld	l,c
+			ld	h,d
+			ld	a,(hl)
+			sbc	a,e
+			or	h
+			inc	d
+			rst	10h
+			ld	(de),a
+			sub	h
+			adc	a,b
+			and	a5h
+			cp	b
+			add	hl,sp
+			ld	(hl),c
+			xor	l
+			ld	l,a
+			in	a,(edh)
+			in	a,(33h)
+			sub	(hl)
+			dec	hl
+			ld	c,c
+			ex	de,hl
+			rst	38h
+			and	b
+			xor	b
+			cp	c
+			ret	p
+			add	a,(hl)
+			ret	pe
+			ld	sp,6b12h
+			ld	e,(hl)
+			ld	l,c
+			ld	c,(hl)
+			jp	m,La291
+			inc	l
+			ld	d,b
+			ld	c,d
+			add	a,(hl)
+			ld	l,96h
+			rlca
+			ld	l,d
+			ld	de,ca79h
+			ld	l,b
+			or	a
+			ld	c,b
+			sbc	a,e
+			inc	de
+			inc	hl
+			ld	sp,hl
+			dec	e
+			ld	d,8dh
+			sbc	a,c5h
+			ld	(hl),b
+			rst	18h
+			push	bc
+			cp	b
+			ld	d,b
+			ld	a,c
+			sbc	a,h
+			ld	b,c
+			ld	h,c
+			push	af
+			push	de
+			jp	z,Lcff4
+			adc	a,l
+			ld	h,l
+			inc	a
+			or	l
+			ld	h,a
+			ret	nc
+			ret
+			db	ach,1ch,41h,62h,89h,48h,c0h,24h
+			db	c4h,aeh,39h,69h,c3h,bah,3ch,88h
+			db	2ah,29h,39h,9ah,d9h,04h,7eh,25h
+			db	f5h,0ch,ffh,42h,5bh,a6h,4bh,15h
+			db	03h,abh,24h,eeh,5bh,51h,9ah,eah
+			db	5fh,45h,2fh,67h,18h,92h,cbh,6eh
+			db	b3h,1fh,6ah,4bh,82h,87h,58h,82h
+			db	7dh,7bh,7ch,1eh,4bh,cfh,77h,d1h
+			db	ech,66h,72h,4ah,c5h,6fh,bch,07h
+			db	8ch,30h,ach,04h,dch,02h,21h,35h
+			db	93h,02h,2eh,7bh,90h,71h,03h,21h
+			db	32h,cbh,25h,33h,99h,a5h,2ch,13h
+			db	f9h,f1h,62h,1fh,bdh,2ah,cbh,49h
+			db	19h,69h,c2h,e8h,46h,c4h,ffh,01h
+			db	f8h,68h,63h,20h,5bh,55h,fch,1ch
+			db	41h,5bh,2fh,17h,a0h,54h,e1h,0dh
+			db	29h,2eh,e1h,a1h,98h,d3h,a8h,38h
+			db	c4h,35h,20h,90h,18h,66h,85h,00h
+			db	5fh,8ah,47h,4eh,28h,5ch,a0h,59h
+			db	76h,fbh,96h,48h,44h,6ch,26h,ffh
+			db	e0h,90h,39h,c8h,e2h,0bh,0dh,fbh
+			db	2ch,fbh,11h,74h,e2h,9fh,b8h,43h
+			db	9ch,e8h,e2h,f9h,47h,6fh,36h,2ch
+			db	01h,73h,ddh,5ch,29h,36h,2ah,0eh
+			db	02h,dch,2eh,b0h,5ch,7ah,28h,87h
+			db	53h,37h,c0h,88h,f9h,05h,1dh,69h
+			db	a5h,41h,01h,65h,93h,cfh,4fh,27h
+			db	4eh,49h,4ch,1fh,22h,5bh,69h,9fh
+			db	78h,4dh,91h,3dh,cah,d6h,43h,1ch
+			db	d2h,deh,51h,b6h,4bh,aeh,6ah,c2h
+			db	beh,d8h,a3h,f0h,62h,54h,0bh,fah
+			db	06h,bfh,feh,ceh,bah,c0h,85h,5dh
+			db	30h,10h,e3h,41h,dfh,e2h,a3h,aah
+			db	9dh,33h,a7h,5dh,9dh,98h,fdh,a2h
+			db	1eh,30h,55h,a9h,5fh,90h,6fh,7eh
+			db	5fh,07h,1dh,4ch,45h,6dh,4ah,84h
+			db	07h,2ah,36h,41h,06h,f3h,83h,cdh
+			db	a9h,0bh,a4h,1fh,bch,e8h,a0h,bdh
+			db	91h,70h,89h,c1h,0dh,3ah,b1h,86h
+			db	9ah,66h,c6h,d8h,55h,fbh,e8h,ach
+			db	43h,dch,25h,51h,c0h,21h,4fh,87h
+			db	89h,54h,a3h,00h,19h,60h,1bh,19h
+			db	fah,d2h,1ah,d9h,e6h,1fh,ffh,46h
+			db	f4h,e8h,d5h,85h
+			jp	Lb4e7
+			db	33h,8ch,6bh,39h,61h,9bh,4bh,5ch
+			db	01h,81h,e0h,7ah,e2h,19h,3ch,52h
+			db	b1h,5ch,f5h,29h,feh,26h,79h,0ah
+			db	deh,bch,9dh,61h,b5h,42h,d9h,adh
+			db	d0h,93h,85h,c8h,15h,8dh,b8h,78h
+			db	c3h,16h,3dh,f9h,e6h,dah,46h,92h
+			db	2ch,42h,3dh,36h,81h,aah,61h,6bh
+			db	f7h,cdh,adh,c6h,40h,cdh,27h,02h
+			db	cfh,36h,f0h,93h,ebh,0ah,e0h,ceh
+			db	75h,05h,a8h,74h,cdh,c1h,5ah,93h
+			db	19h,9ch,47h,95h,ddh,fdh,d1h,e0h
+			db	69h,bch,64h,85h,c9h,e0h,35h,3dh
+			db	12h,69h,cah,06h,41h,fdh,25h,2dh
+			db	07h,5bh,b1h,c4h,c6h,07h,86h,45h
+			db	7dh,43h,b4h,d8h,17h,beh,f8h,a6h
+			db	16h,93h,1bh,c8h,b4h,9ch,04h,fbh
+			db	b6h,46h,fch,64h,f4h,c9h,cah,58h
+			db	cbh,70h,0ch,0ah,cah,e3h,32h,41h
+			db	cah,29h,32h,3ah,e4h,1dh,1dh,e6h
+			db	eeh,68h,0dh,72h,e6h,55h,ebh,d4h
+			db	9ah,84h,46h,5eh,d7h,aeh,f3h,73h
+			db	99h,26h,07h,9ch,ebh,7dh,f6h,84h
+			db	15h,86h,29h,1eh,c1h,f6h,e6h,b5h
+			db	bdh,d7h,9ah,e8h,6eh,6fh,c8h,69h
+			db	e7h,eeh,c6h,d3h,2eh,dbh,c6h,ddh
+			db	cfh,80h,a5h,79h,7bh,4bh,e4h,ceh
+			db	f9h,cdh,0dh,a5h,f0h,b2h,87h,17h
+			db	b1h,c7h,36h,71h,71h,07h,8eh,a6h
+			db	bfh,dbh,18h,0bh,91h,72h,ddh,d3h
+			db	a4h,f8h
+			ld	b,l
+			dec	b
+			ld	l,(hl)
+			ld	c,l
+			pop	hl
+			and	b
+			ld	l,a
+			call	z,Ld190
+			add	a,(hl)
+			sub	h
+			add	a,h
+			ld	b,42h
+			xor	d
+			sbc	a,l
+			xor	b
+			ld	h,c
+			ld	b,d
+			and	(hl)
+			sbc	a,l
+			ld	c,a
+			and	l
+			ld	c,d
+			ld	e,l
+			cp	adh
+			ld	l,l
+			ret	p
+			ld	l,l
+			add	a,e
+			ret	pe
+			or	h
+			ld	c,c
+			ld	b,b
+			call	z,L8596
+			or	d7h
+			dec	c
+			push	af
+			ld	a,a
+			ex	(sp),hl
+			add	hl,hl
+			adc	a,e
+			or	d
+			cp	d
+			jr	L6c03
+			db	6fh,47h,94h,a8h,3bh,f3h,e5h,7ch
+			db	49h,ech,44h,3eh,87h,43h,93h,d0h
+			db	d6h,76h,5ch,7eh,c0h,b0h,9ah,18h
+			db	0fh,67h,80h,6dh,76h,fbh,a6h,c9h
+			db	f2h,04h,62h,35h,ach,0ch,63h,e7h
+			db	d1h,f0h,99h,2dh,52h,f0h,80h,f2h
+			db	9fh,64h,d3h,6ch,fbh,5dh,3fh,cfh
+			db	a5h,b4h,a3h,d5h,e8h,efh,18h,e8h
+			db	79h,cah,02h,66h,b0h,6dh,c2h,22h
+			db	b5h,e4h,7dh,55h,c5h
+			ld	h,l
+			sub	l
+			ld	d,c
+			jp	L0a7c
+			db	65h,0bh,56h,e1h,65h,1bh,84h,ddh
+			db	95h,00h,d6h,66h,e4h,28h,1bh,30h
+			db	00h,52h,22h,4ch,afh,97h,57h,e7h
+			db	d5h,a1h,70h,51h,e9h,4ch,43h,08h
+			db	edh,85h,c2h,23h,ebh,36h,bah,33h
+			db	dah,c8h,f8h,30h,d7h,a6h,bdh,c0h
+			db	49h,36h,15h,71h,a3h,44h,e7h,c7h
+			db	55h,3bh,a0h,cbh,dfh,92h,3ah,f4h
+			db	d2h,6eh,b6h,e1h,5dh,02h,2ah,35h
+			db	d1h,57h,49h,52h,92h,a8h,b5h,ddh
+			db	2fh,71h,59h,f0h,8eh,2ch,c0h,e7h
+			db	90h,cdh,ach,01h,a2h,3fh,97h,18h
+			db	f4h,12h,eah,fbh,00h,59h,fdh,1ah
+			db	16h,10h,f0h,54h,e5h,b2h,2ch,9ah
+			db	52h,a3h,80h,e8h,c8h,c2h,62h,c8h
+			db	49h,7ah,1bh,e1h,7eh,06h,9dh,70h
+			db	49h,c8h,f9h,7ch,72h,04h,a5h,0eh
+			db	c6h,c8h,f4h,05h,1dh,0ch,58h,96h
+			db	f9h,94h,bbh,3dh,e2h,50h,1dh,0ah
+			db	2eh,f9h,60h,57h,b3h,4bh,1ch,a2h
+			db	a5h,81h,16h,03h,d2h,84h,e1h,24h
+			db	3dh,f2h,98h,c9h,8fh,b6h,33h,a9h
+			ld	(hl),b
+			call	z,L7a55
+			and	l
+			sub	b
+			ld	c,e
+			adc	a,c
+			ld	h,(hl)
+			ld	l,a
+			cp	h
+			sbc	a,b
+			or	h
+			and	(hl)
+			adc	a,(hl)
+			ld	c,e
+			xor	a
+			xor	e
+			ld	h,h
+			ld	c,a
+			ld	(hl),b
+			ld	(hl),66h
+			ld	a,d
+			sub	d
+			adc	a,l
+			ld	l,feh
+			ret	nc
+			ld	b,(hl)
+			djnz	L6da1
+			ld	c,a
+			jp	c,L8d76
+			ld	e,d
+			ld	l,(hl)
+			add	hl,hl
+			add	a,e
+			inc	l
+			add	a,c
+			inc	a
+			dec	bc
+			sub	d
+			dec	l
+			call	pe,L35cb
+			ccf
+			ld	l,d
+			ld	(de),a
+			dec	sp
+			djnz	L6d78
+			ld	l,l
+			ld	l,a
+			and	4fh
+			ld	l,d
+			ex	de,hl
+			ld	d,e
+			ret	nc
+			ld	d,d
+			or	a
+			and	d
+			xor	c
+			rla
+			ld	(hl),d
+			or	h
+			ld	(hl),h
+			and	(hl)
+			ld	d,b
+			rst	18h
+			sbc	a,b
+			out	(70h),a
+			ld	c,h
+			ld	a,l
+			ld	l,d
+			sbc	a,b
+			dec	hl
+			jp	z,Lf9c3
+			push	hl
+			ld	(hl),b
+			ret	po
+			ret	nc
+			ld	b,c
+			call	pe,Ld4ca
+			ld	(5e43h),hl
+			daa
+			rra
+			cp	d
+			scf
+			call	c,L0ffe
+			ld	b,a
+			ld	a,(hl)
+			pop	bc
+			ret	nz
+			inc	de
+			ld	(hl),89h
+			ld	l,(hl)
+			inc	(hl)
+			ld	e,(hl)
+			jp	(hl)
+			db	39h,46h,26h
+			ld	l,b
+			add	a,e
+			ld	c,e
+			ld	l,b
+			dec	(hl)
+			jr	z,L6e0a
+			push	bc
+			dec	d
+			xor	h
+			ret	po
+			xor	c
+			djnz	L6dbd
+			or	b
+			adc	a,b
+			ld	a,(hl)
+			cp	d
+			xor	a
+			sbc	a,adh
+			jp	p,L8e40
+			ld	e,b
+			sub	e
+			ld	(hl),c
+			rst	20h
+			cp	c
+			pop	hl
+			ld	b,b
+			ld	l,c9h
+			jp	z,L29e1
+			jr	z,L6e27
+			ld	e,e
+			exx
+			ld	(bc),a
+			dec	e
+			ld	e,a
+			ld	c,e
+			dec	(hl)
+			ld	(hl),dch
+			adc	a,a
+			dec	e
+			and	h
+			adc	a,c
+			and	e
+			ld	(hl),h
+			add	hl,sp
+			inc	l
+			ld	l,h
+			ld	hl,2209h
+			ret	p
+			ld	c,(hl)
+			call	z,L5382
+			sbc	a,h
+			jr	z,L6d86
+			ld	d,d
+			call	m,L040f
+			ld	(bc),a
+			and	e
+			ld	(hl),l
+			ld	c,a
+			pop	hl
+			add	hl,hl
+			ld	h,d
+			ld	c,d
+			inc	d
+			ccf
+			dec	e
+			jp	po,Lf837
+			call	nc,L7253
+			jp	pe,Le087
+			call	L88c6
+			ld	l,7ah
+			ret	z
+			ret	pe
+			add	a,5dh
+			sbc	a,5dh
+			dec	(hl)
+			cp	a
+			or	(hl)
+			daa
+			or	c
+			dec	h
+			ld	de,3ec2h
+			adc	a,b
+			nop (2x) *
+			adc	a,a9h
+			or	e
+			or	e
+			cp	a
+			push	de
+			add	hl,sp
+			dec	(hl)
+			ld	b,07h
+			and	b
+			inc	l
+			ld	d,h
+			dec	e
+			add	a,a
+			ld	d,e
+			ld	(hl),28h
+			call	pe,L29e6
+			in	a,(68h)
+			add	hl,hl
+			ld	(hl),e
+			ld	l,c
+			ld	d,l
+			xor	a
+			jp	z,L1a1c
+			xor	c
+			rst	00h
+			dec	c
+			and	h
+			ret
+			db	f2h,83h,38h,edh,0ah,d7h,23h,28h
+			db	59h,65h,d9h,6ch,8eh,c1h,d1h,0ch
+			or	l
+			in	a,(4eh)
+			add	a,82h
+			ld	c,d0h
+			dec	c
+			call	pe,Laff5
+			ld	b,d
+			adc	a,d
+			ld	d,c
+			call	nc,L8350
+			call	L5bfb
+			add	a,a
+			push	af
+			ret	nc
+			xor	l
+			dec	hl
+			ld	a,d
+			call	z,Lb0b2
+			add	a,e
+			pop	bc
+			jp	po,Lbe47
+			ld	sp,9433h
+			rst	18h
+			rst	10h
+			xor	c
+			ld	d,a
+			ld	c,d2h
+			add	a,l
+			ld	e,c
+			inc	h
+			dec	b
+			ld	h,b
+			sub	31h
+			ld	(hl),c
+			ld	e,d
+			ld	e,d
+			sub	l
+			daa
+			jp	z,Ld869
+			ld	b,c
+			cp	b
+			ld	c,b
+			sub	l
+			ld	(f080h),a
+			ld	h,e
+			ld	c,l
+			cp	d
+			add	a,(hl)
+			call	L3f0a
+			call	po,L266b
+			add	a,l
+			jp	p,La128
+			dec	(hl)
+			dec	b
+			pop	af
+			ld	d,e
+			ld	c,e
+			inc	d
+			cp	a
+			rlca
+			sbc	a,(hl)
+			ret	pe
+			and	h
+			ld	c,a
+			dec	hl
+			adc	a,c6h
+			ld	(hl),b
+			cp	b
+			inc	sp
+			add	a,(hl)
+			ei
+			dec	a
+			cp	b
+			ld	h,l
+			adc	a,a
+			in	e,(c)
+			ld	d,(hl)
+			jp	p,L82c7
+			dec	hl
+			and	4bh
+			adc	a,a
+			ld	h,a
+			adc	a,e
+			rst	20h
+			ld	b,h
+			ld	l,l
+			jp	L3b6c
+			db	29h,41h,7ch,22h,deh,bdh,21h,f1h
+			inc	b
+			ld	l,e
+			ld	e,d
+			and	d
+			add	a,d
+			ld	a,l
+			rst	20h
+			push	af
+			and	h
+			adc	a,c
+			nop
+			xor	a
+			sbc	a,h
+			djnz	L6ea2
+			ex	(sp),hl
+			ld	(4343h),a
+			cp	b
+			sbc	a,d
+			nop (2x) *
+			push	af
+			ld	l,a1h
+			ld	h,a
+			ld	d,l
+			ld	a,b
+			ret	c
+			cp	c
+			ld	a,a
+			djnz	L6ecc
+			ld	d,a
+			ld	a,h
+			ld	b,b
+			ld	l,a
+			call	p,Lae50
+			ret	nz
+			ld	h,h
+			ld	b,h
+			ex	de,hl
+			cp	h
+			dec	(hl)
+			jr	L6f14
+			db	41h,8eh,59h,fbh,e5h,6fh,ceh,a9h
+			db	24h,91h,fdh,90h,a9h,34h,5dh,e1h
+			db	78h,71h,58h,0dh,d3h,b2h,62h,00h
+			db	3bh,60h,d6h
+			and	c7h
+			sbc	a,a
+			ld	h,a
+			ld	(hl),c
+			cp	b
+			nop (2x) *
+			ld	(hl),c
+			rst	20h
+			ld	e,e
+			ld	d,e
+			ld	a,(ea48h)
+			call	nz,Lbcdd
+			sub	b
+			inc	c
+			sbc	a,l
+			xor	87h
+			inc	de
+			ld	c,h
+			jp	m,L140d
+			jp	L4d19
+			db	73h,b3h,e1h,97h,5dh,80h,72h,05h
+			db	3fh,4eh,3ch,70h,8fh,beh,43h,84h
+			db	23h,c2h,fdh,a9h,28h,01h,38h,5ah
+			db	b7h,b7h,76h,c4h,2ah,53h,2ch,7bh
+			db	c1h,59h,f7h,92h,58h,1bh,6ah,68h
+			db	7fh,efh,58h,50h,90h,77h,8ch,89h
+			db	06h,4bh,a1h,47h,8eh,d3h,fah,84h
+			db	23h,dah,b2h,7eh,81h,f6h,40h,93h
+			db	a0h,05h,5ch,f6h,d6h,64h,9dh,66h
+			db	deh,39h,c3h,f6h,10h,45h,6bh,02h
+			db	35h,f1h,e3h,06h,45h,94h,68h,fah
+			db	b5h,cbh,6eh,b4h,f7h,45h,ebh,21h
+			db	61h,16h,75h,34h,f1h,99h,46h,10h
+			db	aeh,61h,7fh,8ch,f9h,dch,fbh,cah
+			db	c7h,cch,4ch,2eh,cbh,70h,35h,a4h
+			db	13h,76h,f2h,3ah,6bh,90h,e4h,d1h
+			db	57h,2eh,4fh,d4h,52h,abh,f5h,08h
+			db	8fh,2bh,3eh,05h,9eh,93h,93h,6bh
+			db	e0h,12h,beh,b7h,a6h,98h,29h,7eh
+			db	c8h,37h,a9h,3bh,c7h,3dh,95h,29h
+			db	ddh,22h,32h,dbh,a4h,d3h,46h,9bh
+			db	cfh,08h,9bh,c5h,15h,66h,5ch,41h
+			db	ceh,6bh,2bh,0dh,1ch,9ah,1dh,efh
+			db	09h,a8h,a0h,eah,66h,afh,4ch,1fh
+			db	6ch,64h,00h,57h,31h,8ah,c3h,a0h
+			db	56h,1eh,75h,1bh,33h,5fh,20h,9ch
+			db	d7h,36h,f1h,08h,85h,66h,f9h,e6h
+			db	e3h,adh,77h,3fh,6dh,64h,66h,76h
+			db	eah,70h,70h,dah,06h,f0h,98h,f0h
+			db	9ah,34h,07h,deh,66h,14h,7fh,2fh
+			db	46h,68h,1ch,42h,1ch,60h,34h,a1h
+			db	8ah,bah,a9h,a1h,cdh,fch,83h,6ah
+			db	cdh,49h,eeh,4ah,92h,90h,5ah,b0h
+			db	49h,04h,bbh,9bh,35h,78h,70h,fah
+			db	a1h,27h,d8h,08h,8dh,84h,d3h,2dh
+			db	b5h,96h,f0h,e3h,38h,b6h,bah,2dh
+			db	f7h,14h,42h,37h,40h,bfh,bch,ffh
+			db	00h,85h,99h,4dh,31h,8eh,c5h,cah
+			db	cfh,6dh,d8h
+			ld	a,(bc)
+			rst	28h
+			xor	b
+			ld	c,e
+			sbc	a,h
+			cp	b
+			and	h
+			sub	c
+			call	nc,Lf247
+			dec	bc
+			ex	de,hl
+			add	a,(hl)
+			call	pe,Lb0b0
+			inc	(hl)
+			ld	(hl),e
+			cp	(hl)
+			or	a
+			ret	p
+			or	06h
+			or	b
+			ld	h,b
+			push	af
+			ld	(bc),a
+			rst	08h
+			ld	c,b
+			sub	h
+			jp	nz,L686e
+			ld	b,98h
+			cp	d
+			ld	(hl),h
+			jp	z,Lbbd5
+			sub	a
+			djnz	L710e
+			ld	h,a
+			sub	e
+			ld	b,e
+			call	pe,Lbb1c
+			ret	p
+			call	p,Lbd0e
+			ld	b,e
+			cp	a
+			sub	c
+			and	(hl)
+			ld	hl,(d1cdh)
+			xor	55h
+			inc	a
+			ld	h,b
+			ld	e,e
+			ld	l,(hl)
+			ld	a,d
+			jp	nz,L2d48
+			ret	pe
+			or	d
+			adc	a,b
+			ld	e,b
+			ld	hl,(e929h)
+			and	d
+			inc	c
+			cpl
+			sub	h
+			nop (2x) *
+			ld	h,l
+			out	(8fh),a
+			jp	z,Lda21
+			rst	08h
+			rst	20h
+			ld	a,d
+			sbc	a,l
+			ld	hl,43edh
+			ex	(sp),hl
+			ld	(hl),c
+			ld	h,c
+			add	a,(hl)
+			sbc	a,c
+			xor	b
+			ld	c,(hl)
+			push	af
+			ld	a,(hl)
+			xor	6fh
+			ld	a,c
+			exx
+			ret	nz
+			ld	(hl),d
+			rst	00h
+			sub	c
+			sub	a
+			halt
+			ld	a,l
+			ld	h,b
+			ld	d,h
+			rlca
+			cp	e
+			nop
+			inc	(hl)
+			rrca
+			ld	sp,hl
+			dec	(hl)
+			inc	b
+			add	hl,bc
+			rst	20h
+			sub	d
+			inc	e
+			or	l
+			ld	l,b
+			ld	b,b
+			ld	b,a
+			jr	nc,L7150
+			ld	(hl),a
+			nop (2x) *
+			ld	b,e
+			ld	c,c
+			add	a,a
+			ld	a,(de)
+			push	af
+			call	L57a2
+			ld	h,e
+			ld	h,a
+			rst	18h
+			adc	a,d
+			adc	a,d
+			ld	a,(hl)
+			sbc	a,d
+			ld	c,l
+			ret	p
+			ld	a,(hl)
+			ld	e,b
+			adc	a,b
+			ex	de,hl
+			adc	a,l
+			xor	a
+			nop (2x) *
+			sbc	a,c
+			daa
+			daa
+			jp	(hl)
+			db	24h
+			inc	(hl)
+			out	(38h),a
+			push	bc
+			call	c,L3f93
+			dec	de
+			jr	z,L70fb
+			call	po,L1ca3
+			ld	b,h
+			ld	e,c
+			sub	l
+			out	(c),(hl)
+			ld	l,b
+			sbc	a,l
+			ex	(sp),hl
+			add	a,l
+			rrca
+			ld	b,h
+			inc	a
+			ld	a,a
+			push	de
+			dec	(hl)
+			ld	e,b
+			ld	b,c
+			ld	b,l
+			ei
+			inc	bc
+			ld	h,b
+			sbc	a,d5h
+			pop	af
+			or	h
+			inc	c
+			ld	a,b
+			res	4,(hl)
+			ld	(hl),a
+			ld	h,c
+			ld	e,(hl)
+			or	h
+			jp	pe,Le41c
+			sbc	a,e
+			ld	d,h
+			dec	l
+			dec	hl
+			or	fch
+			ex	(sp),hl
+			xor	h
+			ret	pe
+			ld	a,e
+			inc	d
+			dec	a
+			dec	e
+			sbc	a,a
+			ld	(hl),l
+			dec	c
+			xor	b
+			ld	a,(de)
+			adc	a,l
+			pop	bc
+			adc	a,62h
+			exx
+			bit	3,b
+			ld	c,(hl)
+			ld	a,d
+			or	12h
+			ld	a,e
+			ld	a,7fh
+			cp	e
+			cp	b
+			cp	b
+			call	p,L046a
+			ld	b,8ah
+			or	d
+			xor	a
+			add	hl,hl
+			and	22h
+			ret	nc
+			inc	hl
+			ld	a,e
+			ld	h,l
+			add	hl,hl
+			sbc	a,a
+			xor	e6h
+			scf
+			sbc	a,d
+			cp	e
+			jr	L71bc
+			db	25h,22h,26h,b2h,23h,8bh,75h,00h
+			db	52h,d5h,82h,1fh,77h,fch,f4h,72h
+			db	cdh,f6h,6fh,dch,95h,95h,8bh,22h
+			db	d1h,aeh,75h,bbh,56h,d1h,98h,89h
+			db	0bh,82h,7ch,5bh,8ch,beh,10h,66h
+			db	80h,85h,9bh,c8h,11h,92h,4fh,c8h
+			db	91h,30h,e5h,cch,c5h,4dh,09h,8fh
+			db	c0h,77h,98h,e4h,1dh,21h,f3h,0ch
+			db	e0h,89h,68h
+			add	a,d5h
+			ld	l,a
+			jp	po,L7609
+			ld	e,l
+			ld	de,(c85ch)
+			dec	c
+			ld	d,deh
+			sub	(hl)
+			ld	a,(de)
+			xor	h
+			ld	(hl),e
+			ld	d,a
+			jr	nz,L724d
+			ld	a,d
+			nop
+			call	pe,L2211
+			inc	(hl)
+			sbc	a,h
+			cp	a
+			jp	nc,L5b6d
+			ld	d,l
+			adc	a,b
+			ld	b,b
+			sub	b
+			jp	p,L3871
+			ex	(sp),hl
+			xor	a
+			dec	d
+			call	nz,L776f
+			inc	sp
+			xor	c
+			ld	e,h
+			ld	d,e
+			ex	af,af'
+			xor	h
+			ld	e,a
+			nop (2x) *
+			ld	a,b
+			or	a
+			di
+			ld	b,84h
+			ld	bc,8e62h
+			inc	sp
+			ld	b,c
+			sbc	a,l
+			ld	a,(hl)
+			or	d
+			ld	b,l
+			dec	de
+			sbc	a,a
+			ld	d,(hl)
+			cp	e
+			ld	b,e
+			ld	(hl),d
+			dec	h
+			inc	e
+			cp	(hl)
+			and	98h
+			sbc	a,l
+			or	d
+			ld	l,c
+			ret	p
+			ld	hl,9a44h
+			ld	e,09h
+			adc	a,c
+			call	c,Leb71
+			ld	b,h
+			ld	h,a
+			or	b
+			or	a
+			cp	a
+			djnz	L7269
+			ret	z
+			call	z,Ld807
+			rst	10h
+			ld	e,b
+			ex	de,hl
+			or	(hl)
+			pop	hl
+			call	p,L9e11
+			ld	b,h
+			sub	e
+			ld	e,b
+			rst	08h
+			dec	de
+			ld	b,l
+			ld	hl,3d83h
+			ld	b,a
+			call	c,L7227
+			ld	d,a
+			ld	e,cah
+			inc	d
+			rst	28h
+			rra
+			ld	b,l
+			ld	b,h
+			ret	p
+			push	de
+			xor	b
+			ret	c
+			ld	h,a
+			sub	(hl)
+			ei
+			inc	d
+			ld	l,c
+			ei
+			ld	b,a
+			and	e
+			or	c
+			dec	l
+			nop
+			ld	c,h
+			or	l
+			ld	h,bdh
+			ld	h,a
+			ld	l,c
+			sub	(hl)
+			ret	c
+			ld	(hl),c
+			add	hl,hl
+			ld	h,d
+			xor	e
+			ld	h,c
+			out	(65h),a
+			ld	d,a
+			cp	b
+			jp	po,Ldbd1
+			inc	bc
+			jr	nz,L7285
+			inc	de
+			ld	a,(hl)
+			dec	h
+			ld	a,(0331h)
+			ld	c,d
+			ld	de,3f6ch
+			dec	e
+			dec	hl
+			ld	b,c
+			in	a,(4ah)
+			inc	hl
+			rst	18h
+			pop	af
+			jr	L721c
+			db	8bh
+			ld	(hl),b
+			sbc	a,l
+			and	(hl)
+			cp	l
+			ret	m
+			adc	a,b
+			ld	l,e
+			ld	c,(hl)
+			inc	c
+			bit	3,b
+			ld	c,50h
+			jr	nc,L7280
+			ret	nz
+			ld	e,e
+			rst	18h
+			ld	a,e
+			and	(hl)
+			ret	z
+			ld	a,c
+			push	hl
+			ld	b,a
+			ld	h,c
+			and	h
+			djnz	L7272
+			inc	bc
+			daa
+			ret	c
+			push	bc
+			ret	nc
+			ld	e,c
+			ld	b,a
+			ld	l,h
+			ret	po
+			ld	b,a
+			ld	b,h
+			sbc	a,(hl)
+			jp	z,L7beb
+			ld	h,c
+			dec	sp
+			ld	e,c
+			cp	b
+			call	p,Lec19
+			or	(hl)
+			call	p,La111
+			xor	(hl)
+			ld	c,a
+			sub	b
+			adc	a,d
+			ld	b,b
+			ld	e,l
+			ld	a,d
+			adc	a,l
+			add	hl,de
+			ld	d,d
+			exx
+			ld	b,c
+			inc	de
+			call	nc,Lb8a4
+			cp	c
+			or	b
+			add	a,(hl)
+			jr	L7305
+			db	14h,6ah,fbh,c1h,65h,39h,f1h,26h
+			db	8eh,22h,73h,86h,0dh,c3h,6eh,edh
+			db	a0h,42h,32h,4ch,5eh,b6h,6eh,06h
+			db	3ch
+			cp	l
+			ld	a,h
+			sbc	a,c
+			ld	h,c
+			inc	(hl)
+			xor	l
+			ld	e,(hl)
+			nop
+			dec	h
+			add	a,39h
+			call	nc,Lef16
+			adc	a,e
+			or	35h
+			ld	h,e
+			ld	a,h
+			rst	00h
+			sbc	a,a
+			push	hl
+			dec	h
+			and	(hl)
+			rst	30h
+			or	(hl)
+			and	d
+			ld	e,d
+			ld	c,(hl)
+			adc	a,c
+			ld	(hl),d
+			call	L4335
+			cp	(hl)
+			jr	nz,L7367
+			inc	d
+			rst	38h
+			dec	(hl)
+			rst	28h
+			add	hl,de
+			rlca
+			xor	h
+			adc	a,h
+			jr	nc,L72df
+			cp	a
+			ex	af,af'
+			ld	a,(bc)
+			ld	a,e
+			adc	a,81h
+			nop
+			or	a
+			adc	a,a
+			or	89h
+			ld	a,f4h
+			sub	h
+			or	(hl)
+			jr	c,L7300
+			rst	28h
+			ld	a,(de)
+			and	l
+			ld	h,e
+			di
+			sbc	a,c
+			rst	00h
+			ld	e,e
+			dec	hl
+			add	hl,bc
+			ret	po
+			jr	nz,L72b8
+			ret	p
+			ld	h,c
+			or	d
+			add	a,a
+			ld	c,l
+			ret	pe
+			ret	nz
+			jr	nc,L7365
+			daa
+			sbc	a,84h
+			dec	bc
+			add	a,b
+			nop (2x) *
+			ret	m
+			ret	c
+			pop	hl
+			ld	(bc),a
+			or	d
+			ld	c,a
+			ld	e,l
+			add	hl,sp
+			jr	z,L72ff
+			ld	l,h
+			ld	b,h
+			ld	h,(hl)
+			rst	20h
+			rrca
+			ld	e,a
+			rst	18h
+			ld	h,a
+			ei
+			ld	h,b
+			daa
+			jp	z,L56f9
+			ld	l,e
+			sbc	a,b
+			and	d
+			push	af
+			and	l
+			inc	l
+			ld	b,4ch
+			jp	m,L585c
+			ld	a,02h
+			ld	a,h
+			or	b
+			ld	l,b
+			cpl
+			sub	h
+			pop	de
+			xor	l
+			ld	c,h
+			halt
+			ld	e,e
+			rst	08h
+			ld	a,b
+			sbc	a,h
+			ld	l,h
+			ld	(L60c8),hl
+			ld	b,a
+			inc	bc
+			rst	20h
+			dec	e
+			ld	d,(hl)
+			sbc	a,l
+			pop	de
+			pop	hl
+			ld	a,(hl)
+			ret
+			db	f2h,d4h,b2h,36h,48h,65h,6dh,8eh
+			db	34h,41h,a8h,d7h,49h,82h,9ah,21h
+			db	7fh,62h,a0h,14h,14h,e5h,44h,8ch
+			db	5ah,f6h,fch,8eh,93h,5ch,35h,74h
+			db	d0h,1dh,bah,dfh,65h,39h,beh,a2h
+			db	2bh,01h,15h,33h,b5h,bfh,c8h,9bh
+			db	27h,11h,a1h,91h,79h,efh,00h,10h
+			db	f2h,15h,15h,41h,a7h,c6h,46h,3ah
+			db	7eh,2eh,bdh,43h,e0h,29h,dfh,b0h
+			db	28h,b8h,17h,65h,afh,a9h,9bh,cch
+			db	14h,1bh,beh,f3h,dch,4bh,feh,9ch
+			db	f5h,1ch,1dh,e0h,93h,27h,8ah,3ah
+			db	4eh,b3h,07h,5ch,7bh,deh,fch,b8h
+			db	75h,96h,9dh,57h,c8h,e1h,77h,2bh
+			db	b3h,35h,ffh,65h,79h,93h,cfh,90h
+			db	17h,cbh,1dh,26h,78h,64h,beh,54h
+			db	b2h,27h,c0h,c8h,b2h,08h,adh,94h
+			db	deh,21h,75h,f8h,a9h,e4h,62h,f7h
+			db	26h,78h,ceh,04h,5dh,c4h,4dh,c9h
+			db	4eh,e3h,25h,7eh,1eh,4ch,7fh,4dh
+			db	feh,7ah,1bh,ech,56h,90h,96h,8ah
+			db	9ah,8bh,b9h,e1h,ffh,09h,b2h,72h
+			db	b9h,3eh,b6h,5ah,01h,8fh,5ch,eeh
+			db	f2h,9fh,ebh,3dh,c5h,6fh,54h,d3h
+			db	cbh,64h,78h,87h,98h,b5h,3bh,4bh
+			db	74h,eeh,adh,1ah,71h,5eh,1ah,8fh
+			db	5ch,4ah,b8h,51h,3fh,5dh,03h,aah
+			db	9dh,bah,1ah,75h,a1h,17h,3fh,c6h
+			db	6dh,adh,e2h,79h,4eh,65h,82h,2dh
+			db	60h,36h,abh,23h,75h,fah,64h,70h
+			db	e0h,dbh,c4h,c2h,63h,c5h,58h,5dh
+			db	12h,58h,2ah,f2h,e9h,c1h,64h,7dh
+			db	60h,d9h,12h,c7h,48h,d4h,6fh,dbh
+			db	e6h,80h,a4h,f6h,e2h,edh,09h,9bh
+			db	1ch,74h,52h,b7h,1eh,76h,08h,40h
+			db	47h,e9h,62h,57h,c0h,8dh,b3h,78h
+			db	bbh,48h,9dh,8ah,67h,83h,f7h,8eh
+			db	8fh,15h,7fh,e8h,cbh,d3h,f5h,1eh
+			db	7fh,16h,6ch,47h,67h,1ch,9fh,feh
+			db	1fh,e8h,48h,6ch,01h,b9h,aah,78h
+			db	a4h,70h,24h,20h,84h,bdh,bdh,99h
+			db	e6h,82h,47h,c0h,7fh,11h,01h,8fh
+			db	06h,c5h,dah,33h,1ah,13h,dbh,96h
+			db	b9h,bdh,9ah,7fh
+			inc	(hl)
+			pop	hl
+			ld	l,b
+			ld	a,b
+			ld	h,c
+			dec	sp
+			or	e
+			dec	d
+			or	(hl)
+			dec	c
+			ld	(de),a
+			add	hl,hl
+			dec	(hl)
+			ld	h,l
+			ei
+			ret	m
+			ld	(bc),a
+			ex	(sp),hl
+			jp	nz,Lead1
+			push	de
+			ld	hl,5507h
+			sbc	a,h
+			ld	h,b
+			and	l
+			ld	e,c
+			xor	e
+			dec	e
+			call	nz,L407a
+			ld	b,85h
+			ld	a,c
+			ld	hl,1d0bh
+			and	b
+			cp	d
+			sub	c
+			inc	c
+			ret	c
+			adc	a,e
+			ld	a,a
+			set	2,(hl)
+			ret	p
+			sub	e
+			inc	a
+			jp	p,L7d18
+			cp	b
+			rst	10h
+			sub	08h
+			jr	c,L74f3
+			ld	b,b
+			ld	h,a
+			ld	b,e
+			ld	a,l
+			dec	c
+			ld	c,b
+			add	a,l
+			call	nz,Ld3c6
+			push	iy
+			ld	l,c
+			ld	(hl),d
+			sub	h
+			sub	d
+			jp	p,L1260
+			di
+			or	e
+			jp	c,L2fd3
+			di
+			ld	a,h
+			res	1,d
+			jp	c,Lb1e2
+			ld	(b211h),hl
+			ld	(bc),a
+			ld	b,(hl)
+			nop (2x) *
+			ld	b,(hl)
+			dec	(hl)
+			call	m,L86b6
+			add	a,d
+			and	b
+			ld	hl,(fa68h)
+			jp	m,Lf66d
+			or	h
+			sub	l
+			ld	(hl),a
+			push	af
+			rst	08h
+			jp	nz,L6797
+			ld	d,c
+			or	a
+			call	c,L8284
+			jp	Le80a
+			db	9dh,6fh,73h,50h,85h,f5h,11h,efh
+			db	88h,4dh,fbh,59h,a1h,9ah,7ah,cfh
+			db	e3h,9bh,46h,aah,2fh,bch,77h,b9h
+			db	0fh,22h,beh,deh,e0h,5ch,0ch,22h
+			db	85h,28h,adh,06h,64h,bdh,9ah,fdh
+			db	afh,02h,a6h,ffh,78h,19h,76h,37h
+			db	8eh,dch,3bh,44h,4fh,06h,b1h,53h
+			db	e8h,08h,43h,fdh,cah,ceh,2ch,18h
+			db	94h,7ch
+			xor	l
+			ld	hl,3829h
+			ld	h,e
+			ld	d,b
+			ld	c,c
+			ld	(hl),c
+			ld	d,(hl)
+			pop	bc
+			add	hl,bc
+			and	4fh
+			jp	p,La270
+			ld	l,l
+			ret	m
+			scf
+			cp	b
+			ld	e,b
+			ld	h,d
+			cp	a
+			ld	h,l
+			pop	iy
+			cp	(hl)
+			jp	c,L0c4c
+			ld	bc,c714h
+			rst	20h
+			or	e
+			dec	bc
+			ld	c,b
+			push	de
+			call	nz,L8a63
+			rla
+			add	hl,bc
+			ld	(hl),c
+			sbc	a,(hl)
+			inc	a
+			daa
+			ld	sp,hl
+			call	c,Lf095
+			dec	c
+			jp	po,L3cf2
+			ld	c,e
+			ccf
+			ld	a,e
+			jp	pe,Ld3cf
+			add	a,b
+			or	c
+			ei
+			and	e
+			ld	c,(hl)
+			push	de
+			ld	b,l
+			and	a
+			ld	b,b
+			ld	e,71h
+			push	af
+			daa
+			jp	nz,L6136
+			ld	e,c
+			ld	l,d
+			jp	c,L2ca3
+			ld	e,88h
+			neg *
+			xor	79h
+			ld	l,a
+			ld	l,00h
+			sub	b
+			ld	b,h
+			rst	20h
+			scf
+			jr	nz,L760a
+			adc	a,b
+			ld	d,l
+			ret	m
+			ld	h,9bh
+			xor	feh
+			ld	a,(bc)
+			sbc	a,l
+			inc	d
+			ld	h,c
+			sub	a
+			adc	a,b
+			or	l
+			ld	(hl),l
+			ld	e,l
+			ex	af,af'
+			call	z,L2751
+			ld	(de),a
+			ld	c,b
+			rla
+			jp	c,L0dbf
+			di
+			jr	c,L75e8
+			ld	h,h
+			ccf
+			ld	b,h
+			ld	h,l
+			sbc	a,h
+			jr	nz,L75f4
+			ld	sp,512ah
+			ret	p
+			ld	h,b
+			ld	d,b
+			call	nz,L6ec8
+			ld	b,(hl)
+			ld	(023ah),a
+			dec	b
+			and	(hl)
+			ld	d,(hl)
+			ld	de,836ah
+			and	l
+			ld	d,5ch
+			rra
+			xor	b
+			nop (2x) *
+			ex	(sp),hl
+			push	hl
+			and	e
+			inc	sp
+			and	a6h
+			or	aah
+			jp	p,Ledb0
+			ld	d,7dh
+			or	e
+			ld	l,b
+			ex	(sp),hl
+			ld	de,ba00h
+			adc	a,a
+			push	hl
+			dec	(hl)
+			jp	po,L5570
+			or	a1h
+			ld	e,(hl)
+			ld	l,b
+			adc	a,e
+			jp	L2ef9
+			db	afh,e0h,e0h,11h,47h,68h,3bh,ebh
+			db	60h,b9h,f4h,29h,9fh,67h,e1h,c4h
+			db	68h,fah,dbh,a5h,dbh,dah,94h,edh
+			db	25h,f2h,ech,a1h,27h,49h,b3h,56h
+			db	82h,6dh,d4h,69h,63h,a0h,72h,05h
+			db	7fh,bah,d4h,e4h,18h,7eh,b5h,fdh
+			db	11h,6ah,dbh,99h,e2h,e8h,e3h,09h
+			db	87h,e6h,a6h,49h,69h,01h,56h,65h
+			db	1ah,d0h,f7h,d1h,96h,20h,50h,b7h
+			db	ach,35h,87h,46h,77h,35h,1bh,39h
+			db	dah,50h,b4h,04h,72h,f1h,95h,c7h
+			db	01h,ceh,c6h,65h,32h,d3h,d2h,5ch
+			db	f8h,d6h,a7h,a8h,1ch,0dh,b3h,21h
+			db	3eh,08h,17h,1dh,dbh,d5h,50h,ceh
+			db	17h,28h,21h,23h,16h,4bh,a3h,9eh
+			db	75h,e5h,aeh,9fh,b4h,b7h,7dh,a9h
+			db	b4h,24h,3bh,53h,32h,8fh,f3h,efh
+			db	2ch,dfh,37h,a8h,32h,d7h,59h,b8h
+			db	55h,a6h,fdh,ebh,f7h,05h,50h,4ch
+			db	9bh,47h,6eh,24h,59h,22h,40h,b4h
+			db	71h,a0h,d2h,9ch,4fh,64h,d7h,5eh
+			db	69h,1eh,52h,27h,02h,6dh,97h,88h
+			db	e6h,afh,6eh,e4h,51h,2dh,58h,f8h
+			db	50h,0dh,02h,97h,60h,cch,26h,02h
+			db	90h,b2h,9ch,c8h,15h,a4h,14h,79h
+			db	d4h,81h,dbh,edh,a8h,94h,cfh,d7h
+			db	59h,dfh,14h,71h,39h,a8h,18h,fah
+			db	33h,06h,11h,b2h,afh,a4h,69h,77h
+			db	aeh,dfh,6eh,90h,57h,9bh,c0h,43h
+			db	92h,21h,7eh,35h,12h,09h,bdh,e5h
+			db	4dh,35h,d6h,81h,fah,98h,8bh,e8h
+			ld	(hl),d
+			ld	b,05h
+			ld	a,(6ba3h)
+			push	de
+			ld	l,b
+			ld	e,e
+			adc	a,a1h
+			ld	c,d
+			add	a,e
+			push	de
+			inc	h
+			call	L2dff
+			sbc	a,c
+			ld	(hl),h
+			ld	(6642h),a
+			ret	pe
+			or	a
+			xor	d
+			inc	de
+			ld	b,c
+			ld	h,(hl)
+			nop
+			rst	30h
+			ld	h,d
+			rst	38h
+			call	L0433
+			push	de
+			and	52h
+			inc	e
+			dec	hl
+			ld	d,h
+			cp	e
+			ld	c,h
+			scf
+			rla
+			ld	e,(hl)
+			ld	l,e
+			ld	d,8ch
+			ld	a,d
+			inc	(hl)
+			ld	(92dfh),hl
+			ld	d,e
+			sub	(hl)
+			cp	c0h
+			sbc	a,b
+			ret	c
+			ld	a,h
+			ld	b,c
+			ld	sp,hl
+			and	a
+			sub	29h
+			adc	a,e
+			djnz	L7751
+			sub	00h
+			jp	z,L6d3b
+			halt
+			ld	(bc),a
+			rst	20h
+			ld	h,a
+			dec	l
+			rst	18h
+			sbc	a,d
+			ld	c,(hl)
+			add	a,fdh
+			ld	hl,884eh
+			ld	d,b
+			ret	nc
+			and	b
+			ret	p
+			ld	b,8fh
+			rst	38h
+			ld	(hl),c
+			ld	d,(hl)
+			jr	nz,L77dc
+			ld	(hl),h
+			or	l
+			rrca
+			add	hl,de
+			jr	nc,L77f6
+			ld	l,9dh
+			sub	e
+			adc	a,b
+			ld	h,e
+			add	a,b0h
+			add	a,a
+			or	b
+			ld	l,27h
+			ld	h,a
+			ld	a,e
+			jp	m,L763d
+			cp	b
+			cp	e
+			call	po,Lab57
+			add	a,b
+			ld	hl,(34e0h)
+			sbc	a,h
+			and	c
+			ld	l,e
+			or	a
+			ld	b,h
+			ld	h,b
+			rst	30h
+			cp	d
+			scf
+			rra
+			ld	d,h
+			exx
+			dec	(hl)
+			sbc	a,l
+			call	p,Lc581
+			jp	po,La448
+			ret	c
+			cp	e
+			rlca
+			inc	(hl)
+			ld	b,h
+			inc	e
+			ld	b,c
+			ld	bc,791ch
+			ld	e,h
+			cp	c
+			ld	(hl),d
+			cp	e
+			cp	h
+			dec	a
+			inc	h
+			rst	30h
+			sbc	a,b
+			ld	d,h
+			rst	10h
+			pop	bc
+			and	h
+			ex	(sp),hl
+			ld	(hl),h
+			add	a,c
+			and	a
+			ld	(hl),72h
+			inc	h
+			ld	l,b
+			cp	(hl)
+			xor	e
+			ld	(hl),e
+			inc	h
+			inc	l
+			cp	08h
+			cp	d
+			jp	nc,L0069
+			and	d
+			ld	b,l
+			ld	l,(hl)
+			cp	b
+			djnz	L785f
+			adc	a,(hl)
+			ld	l,e
+			or	c
+			ld	h,l
+			ld	d,l
+			ld	a,a
+			push	hl
+			inc	c
+			pop	de
+			rst	08h
+			xor	e
+			ex	af,af'
+			adc	a,e
+			sub	c
+			ex	de,hl
+			adc	a,h
+			ld	b,13h
+			ld	(hl),b
+			ld	c,a7h
+			add	hl,de
+			inc	c
+			xor	e
+			dec	a
+			rra
+			and	a
+			dec	h
+			ld	e,4ah
+			pop	hl
+			ld	l,a
+			ld	l,a
+			call	m,L0530
+			and	1ah
+			ld	e,35h
+			jp	z,Lf1ed
+			ld	h,a
+			ld	d,h
+			call	nc,Lac9b
+			sbc	a,h
+			jp	L195d
+			db	78h,fah,96h,85h,eah,6ch,78h,c6h
+			db	91h,66h,94h,3fh,02h,b6h,60h,12h
+			db	64h,58h,34h,81h
+			sbc	a,c
+			and	h
+			ld	l,d
+			sub	d
+			sbc	a,a
+			sub	e
+			ex	(sp),hl
+			adc	a,e
+			nop (2x) *
+			and	b
+			call	m,L4c06
+			nop (2x) *
+			ld	c,a
+			cp	d
+			ret	nz
+			in	a,(efh)
+			sub	c
+			ld	d,e
+			nop (2x) *
+			xor	b
+			cp	a
+			ld	a,l
+			ld	hl,7aaah
+			ld	a,c
+			ld	l,c0h
+			pop	hl
+			ld	(hl),h
+			add	hl,bc
+			adc	a,c
+			jp	m,L1f97
+			jp	(hl)
+			db	b8h,57h,dch,d9h,3bh,1ch,fdh,f7h
+			db	46h,3bh,96h,1fh,f8h,85h,feh,c7h
+			db	4dh,edh,70h,8ah,15h,02h,25h,a1h
+			db	5eh,95h,13h,76h,33h,d5h,d9h,7bh
+			db	4bh,13h,a2h,77h,d7h,7ah,3eh,2ch
+			db	72h,ebh,17h,8ch,bdh,83h,d8h,b1h
+			db	99h,6eh,edh,7bh,28h,8eh,5ch,2ah
+			db	34h,0bh,82h,77h,0eh,87h,33h,a9h
+			db	28h,ebh,0bh,77h,6eh,c4h,06h,ceh
+			db	f5h,a9h,67h,edh,e6h,02h,adh,02h
+			db	5dh,62h,d6h,8ch,bfh,04h,27h,23h
+			db	dfh,e1h,12h,d1h,c8h,a5h,55h,cdh
+			db	cch,f9h,38h,1ch,0dh,b9h,89h,50h
+			db	88h,78h,96h,76h,90h,d3h,89h,cah
+			db	91h,46h,c0h,48h,fdh,4ah,4fh,c6h
+			db	79h,90h,2ah,eah,d8h,6ah,26h,7ah
+			db	65h,9fh,47h,4eh,90h,0eh,25h,33h
+			db	3eh,83h,efh,6eh,0eh,08h,afh,4fh
+			db	4fh,f2h,c2h,66h,76h,4eh,0ah,06h
+			db	3dh,71h,feh,77h,86h,e0h,5dh,cdh
+			db	e7h,c8h,95h,0dh,d1h,6ch,84h,56h
+			db	9bh,8fh,f4h,c2h,56h,c1h,34h,5eh
+			db	b4h,9eh,36h,53h,9eh,17h,c0h,feh
+			db	c2h,c2h,cbh,81h,2ch,51h,2ch,24h
+			db	08h,80h,49h,fch,1bh,5eh,56h,f5h
+			db	4bh,f3h,fdh,c0h,22h,cfh,edh,29h
+			db	e8h,b6h,a3h,66h,93h,34h,9fh,59h
+			db	ffh,c8h,06h,a6h,79h,abh,f7h,3eh
+			db	ech,5ch,e1h,66h,f7h,a1h,34h,94h
+			db	81h,d9h,89h,10h,f2h,1ch,cdh,a4h
+			db	77h,b7h,92h,1eh,74h,dah,dah,8ah
+			db	24h,0fh,f6h,6dh,9fh,fch,73h,e8h
+			db	2ch,6eh,deh,afh,ceh,beh,7bh,8dh
+			db	94h,ffh,d2h,c3h,3dh,d4h,cfh,41h
+			db	cch,0ch,5eh,69h,46h,58h,44h,55h
+			db	3ah,1ch,2ch,91h,a8h,eeh,b7h,31h
+			db	c3h,c6h,39h,afh,f9h,13h,f8h,9eh
+			db	32h,8eh,6eh,62h,e7h,4ch,f0h,bch
+			db	42h,86h,e6h,ach,25h,afh,d5h,a4h
+			db	eah,c9h,52h,5bh,00h,3dh,e5h,c8h
+			db	43h,8dh,40h,97h,24h,efh,4fh,a0h
+			db	13h,deh,63h,86h,a7h,76h,b2h,cbh
+			db	d6h,f7h,69h,82h,7ah,75h,bdh,68h
+			db	38h,60h,56h,02h,f4h,1dh,7bh,b6h
+			db	61h,d8h,b2h,8eh,4dh,65h,12h,91h
+			db	67h,deh,c1h,eah,10h,f5h,70h,2fh
+			db	7eh,d1h,a7h,9fh,90h,3bh,22h,dah
+			db	7dh,c9h,3dh,03h,98h,a6h,33h,82h
+			db	6bh,cah,14h,0fh,9eh,a3h,99h,09h
+			db	d2h,1bh,e7h,d1h,62h,2bh,36h,0bh
+			db	60h,deh,a6h,61h,01h,2ch,1eh,8ch
+			db	32h,7fh,31h,eah,01h,6ch,03h,7ch
+			db	1ah,06h,3bh,c6h,03h,00h,3dh,feh
+			db	7ch,36h,b6h,11h,47h,4eh,c7h,a5h
+			db	cdh,afh,a3h,ddh,9eh,50h,2dh,cdh
+			db	76h,8ah,ech,42h,05h,42h,bbh,35h
+			db	cch,dah,86h,f9h,55h,14h,58h,5fh
+			db	56h,68h,62h,d1h,55h,78h,08h
+			jp	L7d77
+			db	c6h,75h,f9h,32h,b7h,dbh,39h,a6h
+			db	71h,b4h,a1h,94h,beh,b8h,54h,2ch
+			db	35h,cfh,8fh,9fh,dbh,e4h,25h,8bh
+			db	32h,6dh,46h,32h,ech,25h,b8h
+			ld	h,7dh
+			ld	(hl),h
+			ld	a,e
+			and	h
+			cpl
+			ld	e,(hl)
+			and	h
+			ld	hl,(b980h)
+			ld	sp,hl
+			ld	d,e
+			add	a,c
+			dec	c
+			ld	(de),a
+			ret	p
+			xor	d
+			adc	a,e
+			dec	b
+			ld	l,0ah
+			djnz	L7afe
+			ld	h,c
+			ld	e,l
+			or	d
+			jp	nz,L0e80
+			ld	b,l
+			ld	b,e
+			ld	a,h
+			ld	l,a
+			sub	d
+			jp	nc,L72b2
+			ld	(hl),2eh
+			pop	hl
+			ld	b,l
+			add	hl,hl
+			or	l
+			adc	a,e
+			sub	e
+			jp	p,L4064
+			rrca
+			sbc	a,e
+			rst	08h
+			nop (2x) *
+			and	c
+			inc	b
+			call	z,Lc518
+			dec	d
+			ret	z
+			ld	b,9ch
+			sbc	a,e
+			ld	(hl),c
+			push	bc
+			ld	c,b
+			ex	de,hl
+			ld	e,h
+			add	a,h
+			rst	10h
+			dec	c
+			sbc	a,c
+			adc	a,l
+			ld	a,l
+			adc	a,c
+			ld	(bc),a
+			ld	b,b
+			ld	d,b
+			ei
+			pop	de
+			or	(hl)
+			sbc	a,e
+			inc	h
+			ld	d,b
+			add	a,l
+			or	h
+			adc	a,(hl)
+			ld	e,l
+			call	z,L05ac
+			add	a,c
+			inc	(hl)
+			in	a,(71h)
+			pop	hl
+			ld	de,c056h
+			ld	(hl),h
+			ld	e,h
+			ld	(de),a
+			dec	e
+			sbc	a,h
+			ld	l,(hl)
+			add	a,e
+			add	a,c
+			cp	c
+			inc	de
+			ld	b,e
+			daa
+			or	e
+			jp	m,Lb996
+			xor	c
+			ld	(bc),a
+			sbc	a,b
+			ld	(hl),d
+			inc	a
+			ld	a,h
+			call	p,L6443
+			ld	c,43h
+			ld	d,c
+			and	a
+			inc	de
+			ld	h,h
+			dec	e
+			ld	l,d
+			ld	e,c
+			dec	hl
+			push	de
+			halt
+			xor	e
+			adc	a,b1h
+			call	nc,L8264
+			or	e
+			or	h
+			cp	e
+			or	h
+			ld	a,c
+			adc	a,h
+			ld	e,c
+			ld	b,e
+			ld	e,h
+			cp	l
+			cp	d
+			ld	b,h
+			ld	e,(hl)
+			ld	l,b
+			ld	d,h
+			adc	a,l
+			sbc	a,f6h
+			inc	a
+			ld	c,e
+			sub	h
+			ld	l,(hl)
+			call	nc,L7860
+			push	af
+			and	e
+			and	e
+			djnz	L7ae4
+			ld	sp,hl
+			ld	b,(hl)
+			ld	e,c
+			dec	sp
+			add	a,(hl)
+			ld	a,e
+			ei
+			inc	h
+			xor	l
+			add	a,3ch
+			ld	hl,605bh
+			ld	(hl),e
+			ld	sp,78b6h
+			ld	l,d
+			ld	a,h
+			adc	a,d
+			rst	20h
+			add	a,(hl)
+			jp	m,Lf25d
+			ld	(de),a
+			call	nc,L0418
+			call	c,Lb969
+			jr	c,L7af5
+			add	hl,hl
+			or	e
+			xor	c
+			in	a,(9dh)
+			ld	e,e
+			add	a,c
+			rst	08h
+			add	a,b
+			ld	(hl),l
+			ld	sp,dabdh
+			call	m,Le623
+			ld	l,l
+			ret	pe
+			ld	e,e
+			dec	(hl)
+			ld	h,a
+			ld	e,c
+			or	e
+			jr	L7b55
+			db	ebh,57h,c0h,dch,5bh,2eh,c7h,9ah
+			db	1eh,94h,e0h,6bh,6dh,c0h,ffh,2eh
+			db	70h,d8h,54h,a7h,dah,80h,e9h,0bh
+			db	4eh,7fh,c6h,74h,59h,a5h,aah,2dh
+			db	f0h,22h,3eh,00h,d6h,92h,5ch,27h
+			db	d9h,77h,f9h
+			ld	d,d
+			call	nz,L39e3
+			push	af
+			inc	sp
+			add	hl,bc
+			ld	d,d
+			ld	d,d
+			and	l
+			adc	a,(hl)
+			add	hl,sp
+			ret	nz
+			jp	m,Le7e0
+			and	d
+			ld	(hl),94h
+			ld	b,c
+			ld	e,h
+			inc	(hl)
+			xor	a
+			ld	bc,8aa2h
+			ld	l,l
+			dec	(hl)
+			jp	z,Lc55c
+			adc	a,e
+			rrca
+			ld	sp,hl
+			ccf
+			ld	b,l
+			xor	c
+			ld	d,b
+			jp	L42e3
+			db	e4h,a8h,56h,f6h,3bh,0dh,37h,7eh
+			db	f5h,17h,59h,87h,34h,5bh,83h,28h
+			db	07h,64h,7bh,d4h,ech,8fh,e5h,f6h
+			db	cbh,3dh,9eh,c0h,53h,6bh,0fh,c4h
+			db	99h,bfh,79h,e2h,89h,99h,71h,4bh
+			db	31h,6eh,beh
+			pop	af
+			jp	c,L00b7
+			call	c,L4958
+			ld	h,(hl)
+			jr	nc,L7ba2
+			scf
+			exx
+			ld	hl,(429dh)
+			ld	d,(hl)
+			inc	de
+			rst	30h
+			ld	c,a
+			pop	bc
+			ex	de,hl
+			inc	h
+			ld	l,b
+			sub	l
+			jp	Lb427
+			db	6eh,11h,72h,aeh,6fh,03h,8ah,a4h
+			db	73h,21h,81h,93h,47h,b6h,6ch,6bh
+			db	ach,1dh,f1h,09h,4ah,13h,c0h,94h
+			sbc	a,b
+			jp	nz,L7b2e
+			ret	pe
+			or	c
+			ld	h,2fh
+			call	nz,L1f70
+			ld	a,(de)
+			or	h
+			inc	a
+			ld	a,d
+			inc	c
+			dec	bc
+			sbc	a,l
+			ret	nc
+			nop
+			sub	(hl)
+			add	a,h
+			ld	c,c
+			dec	h
+			inc	(hl)
+			call	nz,L0c2c
+			inc	a
+			and	l
+			ld	b,e
+			ld	b,95h
+			ld	l,l
+			ld	d,b
+			and	d
+			inc	(hl)
+			cp	c
+			inc	d
+			call	po,L2f58
+			sub	d
+			sbc	a,d
+			ld	a,(bc)
+			ld	l,e
+			cp	(hl)
+			or	(hl)
+			cp	e
+			rst	28h
+			ret	pe
+			pop	hl
+			sbc	a,c
+			or	h
+			rst	00h
+			inc	sp
+			add	a,d
+			ld	l,c
+			xor	d
+			ld	d,d
+			ld	bc,93ffh
+			add	a,b4h
+			ld	(hl),d
+			cp	h
+			add	hl,hl
+			or	e
+			dec	h
+			dec	e
+			nop
+			dec	de
+			adc	a,l
+			ld	sp,81eah
+			ld	(hl),c
+			ld	c,34h
+			ld	b,e
+			ld	(hl),h
+			or	8ah
+			xor	h
+			rrca
+			and	c
+			rla
+			or	c
+			ld	(bc),a
+			xor	a
+			call	pe,L3bca
+			xor	a
+			jp	(hl)
+			db	5bh,0eh,2bh,07h,3fh,c2h,a0h,6dh
+			db	ebh,c8h,0fh,c2h,4ah,78h,5bh,fdh
+			db	05h,92h,f9h,62h,81h,c9h,f5h,95h
+			db	30h,96h,21h,c7h,76h,11h,ach,f8h
+			db	a9h,ech,63h,95h,b1h,f5h,2eh,cdh
+			db	b7h,71h,7eh,39h,a0h,c8h,dch,19h
+			db	4bh,cbh,06h,64h,45h,3fh,67h,79h
+			db	9fh,dfh,43h,01h,c2h,9dh,02h,c8h
+			db	0dh,15h,4dh,45h,edh,88h,85h,0bh
+			db	a0h,d4h,04h,ceh,53h,99h,83h,63h
+			db	cch,93h,76h,e6h,beh,2bh,26h,cch
+			db	cdh,d0h,76h,6ch,a2h,12h,fch,7eh
+			db	73h,33h,ddh,a1h,4bh,55h,88h,04h
+			db	9bh,05h,d4h,afh,56h,13h,abh,b1h
+			db	adh,85h,23h,85h,22h,16h,f6h,3eh
+			db	c1h,47h,0fh,88h,18h,e7h,f4h,23h
+			db	edh,62h,65h,6ch,54h,58h,15h,3dh
+			db	68h,b9h,53h,5ah,22h,46h,92h,a7h
+			db	63h,afh,11h,52h,5bh,b9h,93h,50h
+			db	4ah,4ch,f9h,c1h,0ch,89h,60h,cbh
+			db	aah,36h,43h,53h,94h,e5h,cah
+			rst	00h
+			add	a,b
+			push	af
+			dec	sp
+			ld	sp,hl
+			pop	bc
+			ld	l,72h
+			jp	po,La4fd
+			push	de
+			xor	d
+			ex	af,af'
+			ld	h,a
+			ld	a,d
+			cp	dch
+			call	z,L424b
+			and	h
+			ld	e,d
+			ld	c,16h
+			inc	b
+			ex	af,af'
+			cpl
+			rst	18h
+			ld	(hl),h
+			jr	L7daa
+			db	61h,24h,1ch,cah,c5h,d0h,30h,16h
+			db	1dh,b7h,2ch,40h,40h,14h
+			sbc	a,h
+			and	(hl)
+			ld	e,h
+			sub	d
+			and	a
+			ld	a,46h
+			rla
+			or	a
+			inc	de
+			ld	d,a
+			ld	c,c
+			jp	nc,L8d4e
+			ld	b,3dh
+			and	e
+			and	d
+			adc	a,h
+			add	a,e
+			ld	b,iyh *
+			ld	b,e
+			or	e
+			ld	sp,hl
+			rst	20h
+			dec	de
+			ld	a,(hl)
+			rst	00h
+			ld	d,40h
+			ld	a,a
+			and	e
+			ld	(hl),a
+			ld	l,(hl)
+			inc	sp
+			push	af
+			ld	(hl),c
+			cp	l
+			jp	z,Lbe25
+			rlca
+			jp	(hl)
+			db	b9h,e7h,1eh,a0h
+			sbc	a,c
+			ld	l,h
+			ld	h,c
+			res	7,b
+			sbc	a,e
+			ret	pe
+			ld	l,(hl)
+			dec	b
+			call	nc,L98a5
+			dec	bc
+			call	nz,Ld564
+			sub	l
+			inc	bc
+			jp	nz,Le9af
+			nop (2x) *
+			call	z,L29f4
+			ld	b,c
+			sub	d
+			dec	b
+			inc	sp
+			ld	a,(6ba7h)
+			ld	h,(hl)
+			jr	L7d46
+			db	0bh,c0h,22h,c8h,14h,51h
+			dec	h
+			dec	h
+			ex	af,af'
+			and	h
+			ld	c,h
+			out	(e2h),a
+			adc	a,b
+			jp	Lec87
+			sbc	a,c
+			ld	(hl),l
+			ld	hl,(573dh)
+			add	hl,bc
+			ld	h,d
+			jp	pe,L845c
+			inc	(hl)
+			inc	sp
+			ld	b,a
+			xor	b
+			nop (2x) *
+			rrca
+			push	de
+			adc	a,(hl)
+			dec	sp
+			cp	l
+			call	pe,Lfba5
+			inc	d
+			ret	nc
+			pop	af
+			sub	d
+			cp	99h
+			and	d
+			sub	94h
+			adc	a,l
+			exx
+			sub	62h
+			ld	(fc8eh),hl
+			and	b
+			jp	nz,L3348
+			ld	a,h
+			ld	l,b
+			ld	a,24h
+			xor	d8h
+			jp	p,L066a
+			ld	l,(hl)
+			inc	(hl)
+			push	de
+			ld	b,a
+			jp	nz,Ld183
+			inc	c
+			nop (2x) *
+			ret	nc
+			cp	c
+			cp	h
+			ld	b,(hl)
+			and	(hl)
+			inc	(hl)
+			ld	a,l
+			ret	c
+			ld	a,(bc)
+			ld	l,h
+			ld	b,c
+			inc	a
+			ld	a,e
+			ld	l,l
+			sub	a
+			ld	l,e
+			dec	bc
+			sbc	a,b
+			sbc	a,56h
+			dec	sp
+			add	a,(hl)
+			add	hl,de
+			ld	d,b
+			jr	z,L7de1
+			inc	e
+			call	nz,L281d
+			jp	p,L0629
+			ld	c,97h
+			xor	h
+			ld	(a61bh),a
+			ld	c,a
+			sub	b
+			ld	a,h
+			adc	a,b
+			adc	a,l
+			dec	a
+			ld	a,l
+			rst	20h
+			add	a,c
+			ld	b,d
+			xor	a
+			adc	a,c
+			rst	18h
+			ld	(de),a
+			jp	z,L25bc
+			ld	e,e
+			ret
+			db	81h,8dh,dch,3bh,f7h,68h,9fh,b6h
+			db	5bh,47h,e4h,b3h,e3h,f8h,cah,edh
+			db	f9h,35h,a8h,2ch,10h,60h,19h,dch
+			db	e0h,61h,b8h,62h,3eh,87h,85h,bbh
+			db	dch,a3h,50h,2fh,38h,c0h,e6h,a6h
+			db	74h,57h,53h,1ch,6dh,02h,d7h,ddh
+			db	edh,5bh,f7h,9fh,31h,33h,26h,a5h
+			db	d1h,8eh,51h,5ah,fah,c3h,8fh,64h
+			db	76h,9dh,eah,0dh,37h,b5h,88h,5ah
+			db	34h,03h,d1h,c2h,21h,1ah,83h,b2h
+			db	b0h,26h,73h,32h,75h,d1h,b2h,eah
+			db	42h,3eh,84h,69h,75h,7dh,3ch,4eh
+			db	c1h,9ah,33h,7eh,c9h,9ah,ach,88h
+			db	79h,a1h,efh,19h,d0h,3ch,76h,7fh
+			db	08h,23h,73h,deh,61h,b3h,e3h,20h
+			db	f0h,e6h,a2h,87h,01h,44h,4eh,76h
+			db	fdh,e6h,11h,f6h,cah,5eh,cfh,b4h
+			db	7ah,6ch,18h,9ah,73h,28h,eah,1ah
+			db	68h,a2h,b3h,dch,b2h,8ch,d4h,01h
+			add	a,2eh
+			sbc	a,h
+			ld	a,d
+			ld	c,ceh
+			ld	d,17h
+			xor	(hl)
+			ld	h,(hl)
+			add	a,h
+			ld	h,h
+			ld	a,a
+			cp	l
+			jp	(hl)
+			db	d2h,2dh,85h,6eh,dch,4bh,3dh,d2h
+			db	0ah,c9h,53h,e4h,f9h,fbh,8ch,84h
+			db	08h,17h,68h,25h,8ah,67h,77h,d9h
+			db	d3h,68h,42h,1ah,a4h,41h,b7h,40h
+			db	37h,09h,fdh,12h,ceh,36h,2eh,5ah
+			db	a9h,bbh,d4h,97h,82h,f2h,47h,32h
+			db	59h,f2h,69h,d5h,07h,25h,beh,fdh
+			db	98h,eah,42h,92h,92h,c1h,4dh,06h
+			db	54h,24h,57h,5bh,53h,74h,32h,f9h
+			db	18h,b1h,ech,7ch,07h,56h,8dh,30h
+			db	a5h,47h,f2h
+			adc	a,h
+			ld	c,a
+			rst	38h
+			inc	(hl)
+			sub	(hl)
+			adc	a,h
+			and	e
+			cp	h
+			and	d
+			or	e
+			cp	h
+			dec	bc
+			jp	L4f23
+			db	12h,79h,45h,d5h,e7h,b0h,59h,c4h
+			db	a7h,bch,2dh,0ah,2bh,0fh,e0h,e9h
+			db	6dh,b5h,4ch,75h,6fh,d2h,ddh,b8h
+			db	7fh,9eh,04h,a4h,55h,1bh,2ah,f7h
+			db	a2h,dch,bah,d7h,74h,2ch,ceh,72h
+			db	4ah,f3h,fch,1fh,89h,52h,88h,12h
+			db	20h,93h,f8h,5bh,a5h,3ch,cbh,ebh
+			db	c3h,cbh,f5h,e1h,2fh,07h,2eh,30h
+			db	60h,4fh,7fh
+			rst	38h
+			ld	a,b
+			ld	e,l
+			inc	de
+			ld	a,(9087h)
+			jp	pe,L0904
+			ret	z
+			adc	a,d
+			cpl
+			ld	(hl),e
+			adc	a,e
+			ld	h,d
+			jp	m,L92f6
+			or	l
+			ret	nc
+			xor	l
+			sub	d
+			or	h
+			ld	e,(hl)
+			xor	b
+			ld	h,h
+			add	a,e
+			cp	h
+			halt
+			jp	m,La14a
+			cpl
+			sub	d
+			sub	c
+			ld	d,c
+			halt
+			inc	bc
+			dec	a
+			call	m,Lbbc6
+			sub	e
+			ld	h,h
+			ld	b,h
+			ld	e,e
+			call	nc,L86c0
+			ld	l,75h
+			ld	(3774h),a
+			xor	a
+			or	(hl)
+			ld	c,25h
+			ld	l,dfh
+			inc	l
+			xor	(hl)
+			ld	(hl),d
+			pop	de
+			call	po,L8f63
+			ld	b,a
+			ld	l,d
+			inc	b
+			ld	c,a
+			scf
+			ld	bc,04dch
+			or	64h
+			ld	(fef2h),a
+			adc	a,(hl)
+			rst	28h
+			ld	a,ceh
+			inc	a
+			ei
+			xor	h
+			and	d
+			ret	po
+			ld	h,d
+			pop	de
+			call	z,L9117
+			xor	(hl)
+			ld	de,b424h
+			jp	c,L5c21
+			ret	nc
+			and	a
+			add	a,bbh
+			exx
+			jp	z,L090f
+			ld	b,l
+			ld	e,h
+			ei
+			ld	sp,f138h
+			ld	d,(hl)
+			call	L727b
+			ret	nz
+			ld	a,(de)
+			add	a,c
+			xor	l
+			jp	c,L0676
+			ei
+			sbc	a,c
+			ld	a,d
+			adc	a,b
+			xor	h
+			add	a,81h
+			ld	b,b
+			ld	c,54h
+			jp	m,L36ce
+			add	a,(hl)
+			dec	l
+			call	po,L1707
+			call	nc,L0000
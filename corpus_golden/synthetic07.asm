@@ -0,0 +1,18431 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	7bh,2ch,72h,72h,8ah,30h,b0h,29h
+			db	2eh,78h,abh,3fh
+
+start:						; execution starting point
+			adc	a,(hl)
+			rst	08h
+			rst	28h
+			sub	c
+			jr	nc,L3fff
+			pop	hl
+			add	a,c
+			ld	a,l
+			sub	9ah
+			ld	(9179h),a
+			ld	b,50h
+			ld	l,d
+			xor	(hl)
+			ld	d,(hl)
+			dec	l
+			inc	hl
+			jp	pe,L9c9a
+			dec	(hl)
+			ld	e,39h
+			inc	l
+			ex	af,af'
+			ld	(hl),cdh
+			ld	e,e
+			or	d
+			dec	(hl)
+			ld	d,d
+			ld	l,h
+			sbc	a,a2h
+			or	b
+			ret
+			db	4eh,63h,7ah,bdh,b5h,8bh,2ah,9dh
+			jr	c,L4090
+			sbc	a,(hl)
+			rlca
+			adc	a,l
+			or	a
+			ld	hl,(61d6h)
+			ld	e,(hl)
+			pop	bc
+			call	p,L4f68
+			daa
+			ld	sp,b567h
+			add	a,a
+			and	h
+			ld	d,c
+			ld	b,d
+			in	a,(7bh)
+			ld	h,c
+			xor	l
+			ret
+			db	f3h,2ch,03h,dah,dah,7bh,65h,7ch
+			db	00h,09h,22h,82h,44h,f0h,e7h,6bh
+			db	98h,30h,a1h,c9h,8dh,22h,23h,3bh
+			db	32h,adh,98h,dfh,97h,55h,28h,c2h
+			db	a9h,63h,2fh,35h,59h,9dh,d8h,adh
+			db	17h,69h,c8h
+			ld	h,a
+			in	a,(01h)
+			ld	(hl),h
+			or	(hl)
+			rst	08h
+			cp	c
+			ld	d,d
+			ld	d,h
+			add	hl,hl
+			ld	e,l
+			ld	a,(de)
+			rrca
+			ld	e,l
+			ld	c,h
+			ld	c,e
+			dec	(hl)
+			sub	e8h
+			ld	d,(hl)
+			ld	c,d
+			dec	e
+			xor	a
+			adc	a,c
+			and	e
+			xor	d
+			xor	a
+			sbc	a,b
+			djnz	L4086
+			xor	22h
+			ex	(sp),hl
+			sub	35h
+			xor	e
+			ld	a,(719fh)
+			inc	e
+			or	l
+			pop	hl
+			pop	hl
+			ld	d,c
+			rst	08h
+			add	a,e
+			exx
+			jp	nz,Ld9b7
+			ld	e,(hl)
+			pop	bc
+			ld	a,l
+			sbc	a,a
+			cp	b
+			nop (2x) *
+			inc	sp
+			ld	a,(961eh)
+			cp	b
+			dec	l
+			rst	20h
+			and	e
+			xor	d
+			add	a,(hl)
+			jr	L40bf
+			db	7bh,a0h,57h,61h,57h,c7h,28h,72h
+			db	87h,b7h,b8h,b2h,39h,c1h,3dh,32h
+			db	29h,16h,29h,31h,36h,4fh,fdh,e9h
+			db	24h,f1h,f6h,8bh,90h,0dh,81h,5eh
+			db	a6h,bch,34h,b8h,9eh,0ch,6fh,95h
+			db	27h,93h,29h,e8h,52h,4eh,f7h,6ah
+			db	d9h,9bh,6ah,e0h,58h,07h,ceh,3fh
+			db	5fh,97h,1eh,33h,8bh,d6h,52h,5dh
+			db	4dh,19h,1eh,97h,cah,96h,7bh,f1h
+			db	c4h,33h,9bh,97h,07h,36h,99h,d4h
+			db	52h,37h,a1h,4ah,3fh,efh,94h,abh
+			db	c8h
+			jp	L81f8
+			db	28h,fah,d8h,d3h,07h,2bh,81h,00h
+			db	2bh,e6h,8ch,86h,5eh,0ch,6dh,beh
+			db	e8h,8dh,3bh,d9h,39h,deh,36h,64h
+			db	97h,0ch,0fh,ffh,0ah,2bh,14h,b5h
+			sbc	a,(hl)
+			rst	10h
+			cp	b
+			ld	d,d
+			push	de
+			rst	28h
+			ld	a,a
+			pop	de
+			add	hl,sp
+			ld	h,09h
+			dec	sp
+			ld	e,e
+			nop (2x) *
+			cp	c
+			ld	h,c
+			rst	18h
+			inc	bc
+			rst	08h
+			ld	l,a
+			jr	L41d0
+			db	b1h,95h,5eh,e2h
+			push	af
+			or	b
+			cp	93h
+			ld	a,e
+			ld	h,l
+			inc	sp
+			push	de
+			dec	h
+			ld	h,a
+			ld	d,d
+			cp	(hl)
+			xor	b
+			ld	a,e
+			djnz	L4146
+			ld	l,(hl)
+			jp	nc,L2c42
+			jp	m,L3ba1
+			cpl
+			ld	c,e
+			ret	m
+			ret	z
+			ld	a,e
+			res	4,(hl)
+			ld	a,d
+			ld	a,h
+			ld	e,d4h
+			rst	20h
+			ld	c,d
+			ld	e,b
+			and	(hl)
+			adc	a,a
+			ld	c,bch
+			jp	(hl)
+			db	d8h,1ah,19h,86h,a6h,0ch,54h
+			ret	p
+			xor	d5h
+			cp	h
+			ld	c,b
+			cpl
+			rst	18h
+			ld	hl,2273h
+			sbc	a,a
+			add	a,h
+			rra
+			rra
+			inc	bc
+			ld	h,d
+			add	a,d
+			call	L6125
+			inc	a
+			and	d
+			di
+			ret	nz
+			call	po,L5ffd
+			or	a
+			inc	e
+			sub	l
+			inc	b
+			ld	c,h
+			ld	l,(hl)
+			ld	l,1ah
+			jp	m,Ld4aa
+			ld	c,c
+			ld	l,(hl)
+			push	af
+			add	a,l
+			or	(hl)
+			ei
+			cpl
+			or	b
+			ld	de,6434h
+			ld	h,c
+			add	a,h
+			ld	e,0ah
+			ld	h,d
+			sub	d
+			adc	a,h
+			ld	e,h
+			inc	c
+			sub	c
+			ld	(de),a
+			adc	a,a
+			ret	nz
+			add	a,h
+			and	a
+			or	9eh
+			ld	h,c
+			daa
+			ld	c,e
+			inc	b
+			add	hl,de
+			cp	b
+			inc	a
+			add	a,e
+			ld	(bc),a
+			adc	a,l
+			jp	z,Ld7cd
+			ld	d,d
+			jp	Le5bd
+			db	cah,8fh,50h,00h,5dh,d1h,ddh,92h
+			db	88h,14h,d5h,01h,d0h,81h,5dh,82h
+			db	cbh,77h,b3h,0eh,cah,49h,13h,57h
+			db	88h,39h,15h,b0h,4dh,09h,67h,43h
+			db	6ch,6ch,8dh,7bh,bch,20h,2bh,7fh
+			db	0fh,1dh,44h,02h,f8h,72h,3fh,e7h
+			db	53h,fch,99h,59h,06h,9ch,50h,6ch
+			db	7dh,a5h,cfh,2ch,c8h,0bh,69h,88h
+			db	14h,feh,87h,01h,95h,a6h
+			call	m,L01b2
+			ld	b,a
+			djnz	L41bf
+			ld	b,e
+			cp	l
+			add	a,(hl)
+			ld	l,b
+			sub	l
+			sub	l
+			nop (2x) *
+			ld	b,c
+			sbc	a,51h
+			ld	h,(hl)
+			dec	e
+			ret	z
+			and	(hl)
+			ld	a,l
+			adc	a,a
+			sbc	a,cfh
+			adc	a,d
+			inc	sp
+			nop (2x) *
+			jp	c,Lcd84
+			ld	sp,hl
+			ld	d,a
+			add	a,c
+			ret	pe
+			cp	c
+			adc	a,e
+			push	bc
+			ret	nz
+			dec	(hl)
+			ld	e,d
+			ld	(2385h),a
+			ld	l,d
+			adc	a,(hl)
+			dec	sp
+			ld	d,e
+			xor	c
+			ld	l,b
+			jp	c,L5c35
+			inc	b
+			ld	a,(bc)
+			or	e
+			ld	hl,8d28h
+			ld	h,a
+			xor	d
+			dec	e
+			rst	38h
+			sub	e
+			call	z,La160
+			sub	d
+			dec	a
+			ld	(bc),a
+			jp	(hl)
+			ld	h,d
+			ld	h,c
+			add	a,a
+			ld	b,h
+			ld	d,b
+			ret	nz
+			sbc	a,e
+			inc	de
+			ld	l,b
+			jp	c,L96cb
+			jr	nz,L42cd
+			ex	de,hl
+			ld	e,h
+			ld	h,b
+			ld	c,e
+			ld	c,a
+			ld	h,c
+			ld	l,h
+			ret	z
+			ret	nc
+			ld	a,e
+			call	pe,Lbe47
+			ld	(hl),h
+			or	e
+			xor	d
+			cp	d
+			ld	b,d
+			xor	l
+			and	h
+			call	nz,L54e2
+			ld	hl,7dc6h
+			halt
+			cp	e
+			jp	nc,L2512
+			and	4eh
+			jr	c,L4271
+			xor	h
+			xor	d
+			ld	e,(hl)
+			ld	d,e
+			dec	bc
+			ld	l,d
+			ld	sp,c4d7h
+			adc	a,b
+			add	a,d
+			ld	d,e
+			ld	d,b
+			inc	l
+			and	b
+			xor	e
+			ld	d,33h
+			ld	d,d
+			ld	hl,(1206h)
+			and	d
+			ret	nc
+			rst	30h
+			ld	d,e
+			ld	d,h
+			ret	po
+			pop	hl
+			ld	(de),a
+			jr	nc,L4311
+			sub	a
+			ld	(hl),b
+			rst	30h
+			nop (2x) *
+			ld	b,e
+			set	0,h
+			ld	b,l
+			sbc	a,(hl)
+			ld	b,(hl)
+			ld	d,a
+			sbc	a,c
+			rst	18h
+			ld	(hl),c
+			nop
+			inc	h
+			inc	h
+			sub	d
+			ld	c,l
+			ld	(bc),a
+			ld	(3b6ch),hl
+			inc	b
+			push	hl
+			ld	a,a
+			or	a
+			ld	a,h
+			adc	a,l
+			rst	00h
+			cp	(hl)
+			xor	98h
+			and	d
+			jr	z,L4364
+			ld	b,d
+			jp	pe,L1288
+			ld	e,c
+			and	d
+			add	a,h
+			ld	b,l
+			adc	a,e
+			adc	a,c
+			xor	d
+			nop (2x) *
+			ld	d,e
+			nop (2x) *
+			ld	a,(910ah)
+			ld	d,e
+			ret	po
+			ld	e,b
+			rrca
+			cp	4eh
+			pop	bc
+			ld	c,h
+			call	pe,L8875
+			pop	de
+			or	f5h
+			bit	2,h
+			daa
+			djnz	L4342
+			ex	de,hl
+			ld	hl,2b0dh
+			ret	m
+			or	9dh
+			sub	2bh
+			ld	e,b
+			adc	a,l
+			or	l
+			ld	d,c
+			ld	c,a
+			adc	a,h
+			xor	l
+			pop	bc
+			adc	a,l
+			ld	(hl),c
+			ret	z
+			ld	h,(hl)
+			ccf
+			ld	h,d
+			jr	L439e
+			db	20h,ach,22h,83h,b6h,70h,aah,17h
+			db	bch,b0h,e6h,44h,72h,14h,17h,d3h
+			db	cch,f9h,85h,4eh,5ch,c2h,93h,53h
+			db	a5h,2bh,c0h,87h,76h,abh
+			or	d
+			adc	a,l
+			ccf
+			xor	a
+			ld	d,82h
+			add	hl,sp
+			sbc	a,l
+			adc	a,c
+			ld	(hl),b
+			ld	h,e
+			ld	(hl),b
+			ld	(bc),a
+			inc	c
+			or	l
+			xor	h
+			ld	l,d
+			ld	c,(hl)
+			ld	d,a
+			add	a,c
+			ld	h,b
+			ld	a,d
+			ld	h,c
+			dec	bc
+			or	(hl)
+			sbc	a,e
+			outd
+			or	b
+			and	c
+			add	hl,de
+			ld	(bc),a
+			add	hl,bc
+			sub	(hl)
+			adc	a,c
+			rst	20h
+			add	a,a
+			ret	p
+			cp	20h
+			ld	a,l
+			ex	de,hl
+			ret	nz
+			ld	e,c
+			or	a
+			ld	a,h
+			jr	nc,L4387
+			ex	de,hl
+			nop (2x) *
+			ld	b,a
+			inc	d
+			exx
+			ld	l,b
+			sub	a
+			inc	bc
+			rst	00h
+			ex	af,af'
+			ld	c,d
+			xor	(hl)
+			ld	b,d
+			cpl
+			exx
+			ld	e,a
+			ld	a,l
+			and	l
+			dec	hl
+			adc	a,(hl)
+			add	hl,hl
+			xor	e
+			or	(hl)
+			call	nz,Ld72a
+			call	z,L1786
+			and	l
+			ei
+			dec	hl
+			ld	(bc),a
+			ld	b,h
+			call	nc,L39f8
+			ld	a,(de)
+			dec	(hl)
+			ld	l,h
+			dec	e
+			ld	d,a
+			and	h
+			and	l
+			call	z,L525f
+			set	0,e
+			ld	d,d
+			jp	m,L33ab
+			ld	l,a
+			cp	h
+			sbc	a,c
+			cp	(hl)
+			ld	a,27h
+			ld	d,h
+			dec	l
+			pop	af
+			sbc	a,a
+			rst	18h
+			in	a,(a1h)
+			ld	b,l
+			or	h
+			ld	(hl),a
+			ld	a,a
+			ld	hl,84a0h
+			ld	h,h
+			ld	h,a
+			add	a,b
+			push	af
+			ld	e,(hl)
+			adc	a,d
+			call	nc,L4dbc
+			inc	de
+			ret	nz
+			or	b
+			ld	l,h
+			jp	z,L3713
+			ld	l,a
+			sub	c
+			cp	d
+			ld	e,(hl)
+			ld	b,c
+			adc	a,(hl)
+			sbc	a,c
+			ld	b,c
+			jp	c,Lf1f8
+			sub	l
+			rra
+			and	(hl)
+			ld	(1baah),a
+			ld	(hl),e
+			xor	b
+			ld	d,d
+			call	z,L387a
+			and	b
+			ld	e,d
+			jp	po,L5921
+			jp	m,Le97a
+			call	m,Lb4b2
+			rst	18h
+			ld	e,h
+			xor	b
+			add	hl,bc
+			ld	e,e
+			jp	pe,Lc49c
+			ld	l,e
+			ccf
+			push	de
+			cp	l
+			cp	95h
+			and	e
+			cp	e
+			ld	l,88h
+			ret	m
+			ld	hl,(9c40h)
+			call	po,Lf84a
+			jp	L0c4a
+			db	fdh,f2h,d8h,76h,1ah,a3h
+			rst	20h
+			ret	z
+			di
+			ret
+			db	98h,d1h,42h,87h,a1h,2fh,85h,66h
+			db	bbh,62h,61h,6ch,b2h,3dh,c6h,75h
+			db	e6h,2eh,a8h,dah,1fh,39h,76h,13h
+			db	9bh,78h,58h,69h,cdh,28h,52h,09h
+			db	feh,dah,2ah,f4h,d0h,f1h,cdh,75h
+			db	10h,e6h,bfh,c2h,20h,60h,ddh,23h
+			db	26h,97h,28h,0ah,e8h,bbh,5ch,bah
+			db	23h,68h,a7h,bdh,d0h,84h,47h,fah
+			db	58h,bfh,ceh,bch,55h,20h,d2h,aah
+			db	73h,9fh
+			ld	d,c
+			inc	a
+			inc	a
+			add	a,l
+			inc	c
+			sub	c
+			ld	b,c
+			pop	af
+			ld	d,a
+			dec	de
+			jp	Le11f
+			db	94h,02h,2dh,52h,09h,83h,14h,ceh
+			db	34h,d1h,05h,8ah,cfh,ach,d2h,0dh
+			db	7ah
+			xor	c
+			pop	de
+			sub	a
+			rst	00h
+			ld	h,c
+			ld	l,5ah
+			rst	18h
+			xor	e
+			ld	l,(hl)
+			sub	e
+			ld	e,c
+			djnz	L44c0
+			and	d
+			ld	l,e
+			add	a,e
+			adc	a,1eh
+			or	e
+			and	(hl)
+			nop
+			jr	nz,L44ce
+			ld	(hl),c
+			rst	00h
+			ret	pe
+			daa
+			inc	h
+			ld	(hl),a
+			ld	d,(hl)
+			inc	l
+			jr	z,L44c5
+			xor	c
+			xor	e
+			ex	de,hl
+			inc	b
+			djnz	L451a
+			ld	b,b
+			or	d
+			dec	sp
+			ld	e,e
+			ret
+			db	67h,cfh,03h,12h,31h,76h,d6h,e9h
+			db	c8h,0bh,81h,6ah,cfh,30h,79h,ach
+			db	e0h,a2h,4dh,75h,1eh,7ch,7ch,5ch
+			ld	(hl),b
+			sub	ech
+			ld	a,h
+			ld	l,c
+			xor	e
+			ld	a,b
+			or	a
+			xor	h
+			ret	c
+			cpl
+			ld	(hl),b
+			call	pe,La9cd
+			or	c
+			and	l
+			ret	z
+			halt
+			cp	d
+			ld	a,c
+			ld	c,l
+			inc	e
+			push	de
+			ld	b,b
+			ld	b,c
+			ld	c,h
+			dec	sp
+			ld	h,d
+			ld	(9c24h),a
+			dec	de
+			call	Lad69
+			ld	l,c
+			add	a,e
+			add	a,(hl)
+			dec	hl
+			sbc	a,e
+			halt
+			xor	h
+			ld	d,b
+			and	c
+			ld	e,e
+			and	14h
+			rst	18h
+			jp	nz,L6f8d
+			cp	(hl)
+			add	a,e
+			djnz	L4485
+			ret	z
+			ld	h,c
+			jr	z,L44a0
+			add	a,08h
+			ld	a,50h
+			inc	a
+			add	a,10h
+			sbc	a,h
+			dec	d
+			xor	a
+			ld	l,b
+			ld	l,d
+			inc	b
+			ret	p
+			adc	a,h
+			ld	de,c0b6h
+			nop (2x) *
+			halt
+			di
+			cp	e0h
+			ld	a,l
+			call	m,L350a
+			jp	nz,L87e9
+			and	23h
+			inc	sp
+			bit	1,h
+			or	e
+			ex	de,hl
+			inc	d
+			ld	c,h
+			ld	(22b1h),hl
+			ret	pe
+			call	c,Lf57e
+			adc	a,e
+			scf
+			bit	4,l
+			ld	l,d
+			and	d
+			ld	(hl),l
+			pop	hl
+			ld	b,(hl)
+			xor	l
+			ret	m
+			ld	b,d
+			inc	de
+			ld	a,l
+			rrca
+			ld	a,51h
+			ld	d,(hl)
+			sub	c2h
+			res	5,l
+			dec	hl
+			sub	b
+			ld	bc,7398h
+			ld	(hl),c
+			rst	30h
+			inc	l
+			cpl
+			scf
+			ld	b,(hl)
+			add	hl,sp
+			jp	L4948
+			db	4eh,3bh,98h,a2h,d4h,e5h,c0h,f7h
+			db	62h,73h,3ah,4bh,45h,a7h,8dh,bdh
+			db	38h,a0h,beh,78h
+			ld	a,e
+			rst	18h
+			ld	l,a
+			and	a
+			ret	p
+			or	a
+			rst	28h
+			nop (2x) *
+			pop	de
+			and	d
+			ld	h,a
+			ld	b,c
+			inc	sp
+			add	a,31h
+			ld	a,(hl)
+			and	(hl)
+			inc	b
+			in	a,(88h)
+			xor	1dh
+			ld	(5423h),hl
+			add	a,e
+			jr	c,L454b
+			ld	(bc),a
+			in	a,(4ch)
+			ld	(de),a
+			push	hl
+			sub	h
+			ld	d,a
+			jp	nc,L4d4e
+			push	af
+			cpl
+			dec	e
+			or	d
+			and	a
+			ld	h,a
+			adc	a,c
+			ld	hl,(c183h)
+			ld	bc,6550h
+			add	a,(hl)
+			ld	l,d
+			pop	de
+			xor	adh
+			pop	af
+			cp	h
+			xor	(hl)
+			jr	L458f
+			db	90h,68h,d1h,dfh,ebh,ceh,ddh,07h
+			db	62h,83h,bdh,34h,f1h,1ch,bfh,d5h
+			db	39h,92h,9fh,55h,87h,bch,f4h,edh
+			db	86h,3dh,a4h,8bh,a8h,02h,28h,36h
+			db	76h,67h,1ah,c3h,11h,c9h,d0h,54h
+			db	f5h,00h,07h,78h,e6h,15h,80h,eah
+			db	4dh,40h,7dh,99h,72h,f9h,5eh,a9h
+			db	deh,28h,d2h,c4h,40h,0fh,2ch,0dh
+			db	80h,7ah,dfh
+			ld	d,a
+			ld	a,c
+			or	a
+			or	56h
+			ex	(sp),hl
+			ld	c,l
+			ex	de,hl
+			ld	d,55h
+			dec	de
+			ld	d,(hl)
+			ld	a,c
+			adc	a,c
+			sbc	a,b
+			inc	b
+			dec	a
+			ld	h,b
+			ld	e,e
+			sub	e
+			cp	e
+			add	a,64h
+			ld	(784eh),a
+			call	z,Lbe2b
+			ld	hl,(8a78h)
+			ld	h,h
+			dec	c
+			call	m,La90a
+			cp	c
+			ld	a,a
+			ld	c,l
+			or	a
+			ld	d,l
+			ret	m
+			ld	de,f5c3h
+			jp	c,Laa68
+			call	p,Ldec0
+			ccf
+			add	a,e
+			cp	e
+			ld	h,l
+			adc	a,l
+			ld	l,a
+			adc	a,h
+			and	a
+			sbc	a,l
+			or	e
+			ret
+			db	e7h,4ah,aeh,43h,68h,bch,bdh,61h
+			db	e7h,78h,67h,edh,e6h,04h,16h,d8h
+			db	f5h,f4h,59h,06h,10h,34h,52h,17h
+			db	9fh,0ah,0ch,32h,4eh,53h,bbh,35h
+			db	aeh,2ch,f7h,2fh,dch
+			ld	d,l
+			call	po,L0689
+			dec	e
+			ret	z
+			ret	pe
+			add	hl,sp
+			xor	d8h
+			cp	b
+			ld	sp,hl
+			sub	d
+			add	a,e
+			ld	(hl),c
+			jp	c,L674b
+			ld	(hl),e
+			sub	l
+			ld	d,c
+			daa
+			push	bc
+			ld	a,h
+			ld	b,(hl)
+			ld	c,b
+			or	l
+			daa
+			cp	h
+			pop	hl
+			ld	de,e499h
+			xor	d
+			jp	L2bb7
+			db	f4h,07h,c8h,46h,3ah,b7h,34h,fch
+			db	6fh,5ch,62h,31h,aeh,e5h,89h,30h
+			db	06h,edh,23h,0eh,91h,abh,44h,3dh
+			db	7bh,1ch,34h,85h,27h,74h,edh,5bh
+			db	06h,e7h,c3h,cdh,2dh,74h,0ah,e3h
+			db	07h,84h,76h,7eh,6ah,cch,cch,33h
+			db	8dh,30h
+			ld	l,(hl)
+			ei
+			jp	(hl)
+			db	34h,c7h,c1h,1dh,e3h,b7h,5ch,fdh
+			db	feh,a4h,b9h,69h
+			ld	b,a
+			or	a
+			xor	(hl)
+			inc	c
+			sub	(hl)
+			ld	l,e
+			cp	d
+			ld	(0857h),hl
+			and	l
+			cp	h
+			ld	b,c
+			ld	c,b
+			adc	a,79h
+			ld	b,b
+			ld	a,d
+			add	hl,hl
+			pop	af
+			xor	e
+			add	a,a
+			ld	e,a
+			dec	bc
+			add	a,c
+			ld	h,74h
+			adc	a,e
+			cp	l
+			sub	h
+			sub	d
+			sbc	a,e
+			out	(38h),a
+			rst	38h
+			or	l
+			ld	(hl),c
+			ld	h,c
+			jp	z,Le5e5
+			out	(fah),a
+			dec	bc
+			or	d
+			ld	h,e
+			ld	sp,05cdh
+			jp	L4b77
+			db	aeh,e5h,71h,80h,75h,f9h,eeh,34h
+			db	afh,e7h,f6h,41h,60h,79h,feh,59h
+			db	dah,f6h,beh,b4h,7ch
+			ld	c,(hl)
+			ld	c,c
+			ret	pe
+			sub	l
+			jp	nc,L21a0
+			dec	e
+			ld	a,l
+			or	h
+			add	a,b
+			rst	18h
+			dec	sp
+			call	z,L6994
+			inc	h
+			and	c
+			adc	a,e
+			ld	h,e
+			or	b
+			call	po,L8147
+			cp	a
+			rla
+			ld	l,a
+			inc	hl
+			rra
+			ld	h,h
+			xor	e
+			add	hl,hl
+			inc	(hl)
+			ld	(hl),33h
+			dec	(hl)
+			ld	h,h
+			inc	a
+			and	h
+			ld	(hl),h
+			or	l
+			res	3,e
+			adc	a,l
+			or	c
+			jr	c,L4722
+			ld	l,l
+			res	0,e
+			ld	d,e
+			ld	d,4dh
+			di
+			djnz	L46f6
+			sub	c
+			dec	a
+			ld	a,a
+			cp	99h
+			ld	d,(hl)
+			inc	bc
+			ld	b,c
+			ld	e,a
+			rla
+			ld	de,6401h
+			jp	m,L3dca
+			and	h
+			ld	sp,390fh
+			ld	e,e
+			scf
+			ld	(hl),e
+			ld	a,(hl)
+			call	po,Le31f
+			sub	e
+			call	pe,Lc0bd
+			ld	b,l
+			ld	a,(bc)
+			ex	de,hl
+			jp	nc,L2678
+			nop
+			ld	e,h
+			rst	10h
+			call	pe,Ld198
+			inc	c
+			halt
+			ld	a,d
+			dec	sp
+			pop	bc
+			ld	b,(hl)
+			adc	a,l
+			adc	a,a
+			ld	bc,42f2h
+			ld	c,d
+			ld	hl,fb81h
+			ret	m
+			sub	h
+			ld	c,d
+			nop (2x) *
+			and	b
+			add	a,l
+			and	d
+			xor	b
+			adc	a,c
+			ret	m
+			and	a
+			ld	d,d
+			dec	c
+			jr	c,L474d
+			call	m,Ld29c
+			dec	d
+			ld	hl,bed3h
+			ld	h,b
+			add	a,d
+			rrca
+			jp	p,L26d2
+			ld	l,(hl)
+			inc	d
+			add	a,62h
+			ld	h,e
+			rst	08h
+			pop	af
+			rra
+			rst	10h
+			bit	7,l
+			ld	(hl),c
+			inc	e
+			ld	l,(hl)
+			inc	hl
+			ld	c,b
+			sub	d
+			ret	nz
+			or	(hl)
+			dec	c
+			pop	de
+			ld	bc,be55h
+			jr	z,L4734
+			xor	b
+			ld	d,l
+			or	e
+			dec	de
+			ld	l,c
+			rlca
+			adc	a,l
+			ex	(sp),hl
+			dec	hl
+			cp	h
+			ld	(hl),d
+			ld	d,e
+			ld	c,b
+			add	a,b
+			ld	sp,0b12h
+			rlca
+			or	b
+			jp	(hl)
+			db	edh,b3h,bdh,efh,13h,3fh,c1h
+			jp	z,L5d8f
+			cp	e
+			add	a,(hl)
+			ld	d,e
+			ret
+			db	fbh,ddh,edh,dbh,2bh,f1h,aeh,a6h
+			db	a7h,6ah,87h,7fh,03h
+			ld	(hl),h
+			sub	b
+			and	(hl)
+			rra
+			ld	b,15h
+			inc	e
+			ld	d,c
+			ld	c,h
+			sub	e
+			cp	e
+			cp	d
+			di
+			ld	e,h
+			jp	c,L21ad
+			cp	h
+			djnz	L47fb
+			adc	a,(hl)
+			inc	a
+			di
+			daa
+			adc	a,e
+			call	c,Lb5b3
+			ret	po
+			or	l
+			ld	e,b
+			rst	30h
+			rla
+			out	(29h),a
+			rlca
+			and	d7h
+			xor	c
+			ld	l,h
+			ei
+			ld	b,a
+			ld	d,e
+			and	c
+			xor	d
+			call	z,Lee44
+			ld	l,a
+			sub	h
+			call	z,Lfcc0
+			ld	e,l
+			ld	a,d
+			adc	a,l
+			dec	e
+			ld	h,l
+			call	po,Ldb83
+			ld	(de),a
+			pop	hl
+			ret	p
+			add	a,d
+			rlca
+			cpl
+			ld	l,b
+			cp	d
+			and	a
+			ld	a,(c5cah)
+			ld	b,1dh
+			add	hl,sp
+			add	a,l
+			ld	d,26h
+			ld	a,(bc)
+			add	a,(hl)
+			ld	a,(7286h)
+			rrca
+			call	pe,L2b8b
+			cp	e
+			and	h
+			ld	l,c
+			inc	a
+			ld	(hl),e
+			or	d
+			di
+			inc	e
+			ret	z
+			ld	a,h
+			cp	e
+			ret	c
+			ld	e,(hl)
+			sbc	a,l
+			inc	hl
+			xor	d
+			sub	e
+			jp	z,Lea59
+			call	m,L3440
+			ld	(hl),a
+			adc	a,e
+			inc	de
+			push	hl
+			call	po,Laf86
+			or	d
+			ld	l,e
+			ld	c,a
+			ld	h,d
+			inc	d
+			ld	c,a
+			inc	(hl)
+			ld	d,h
+			ld	d,a
+			adc	a,c
+			ld	(hl),c
+			dec	l
+			or	h
+			adc	a,h
+			ld	(hl),a
+			ld	a,(de)
+			cp	a
+			ld	(hl),h
+			adc	a,a
+			ld	de,2192h
+			rst	00h
+			jp	(hl)
+			db	fdh,b7h,75h,48h,9ah,24h,15h,2bh
+			db	7dh,eeh,f5h,b4h,49h,1dh
+			dec	hl
+			rrca
+			ld	a,(0702h)
+			ld	d,b
+			sbc	a,d
+			inc	b
+			and	d
+			rst	00h
+			rst	38h
+			cp	c
+			ld	c,h
+			rst	00h
+			jp	c,Lb66d
+			or	a
+			push	bc
+			rla
+			call	p,Lfb8e
+			ld	l,(hl)
+			ld	d,d
+			and	h
+			ld	b,c
+			jp	L6f0a
+			db	0bh,50h,9dh,95h,d7h,edh,ffh,2bh
+			db	d2h,1fh,dch,1bh,cdh,05h,95h,85h
+			db	b5h,c6h,aah,6ch,b5h,01h,f7h,6dh
+			db	87h,5ch,b7h,0ch,3eh,b3h,ach,2dh
+			db	39h,cbh,0dh,4bh
+			rst	10h
+			call	po,Lb626
+			sub	(hl)
+			jp	c,L98ee
+			dec	bc
+			and	c
+			ld	a,(hl)
+			dec	l
+			ld	h,a
+			jp	pe,Lfdd2
+			ld	c,d
+			dec	hl
+			ld	a,a
+			sub	a
+			out	(f0h),a
+			ld	b,h
+			add	a,c
+			ld	(hl),b
+			dec	a
+			or	e
+			ld	l,l
+			jp	nc,L544d
+			xor	a
+			ex	de,hl
+			ld	l,e
+			inc	sp
+			dec	l
+			ld	a,(de)
+			adc	a,d
+			ld	l,b
+			jr	L48b2
+			db	84h,a5h,bfh,75h,ddh,43h,0eh,2ah
+			db	95h,5ah,6bh,47h,4ch,73h
+			ld	d,a
+			and	a
+			rst	08h
+			ld	b,e
+			rst	08h
+			cpl
+			ld	l,e
+			inc	e
+			rst	20h
+			add	a,d
+			halt
+			ld	(de),a
+			jr	nz,L493c
+			or	l
+			or	(hl)
+			ld	l,(hl)
+			jp	pe,L9509
+			ld	b,h
+			xor	c
+			and	l
+			ld	b,d
+			sbc	a,b
+			or	l
+			ld	e,l
+			ld	c,a
+			push	af
+			inc	l
+			inc	sp
+			xor	l
+			ld	h,l
+			add	hl,bc
+			jp	m,L8124
+			jp	pe,La1a5
+			ld	e,l
+			sub	b
+			cp	e
+			ld	c,h
+			ld	c,b
+			and	(hl)
+			call	m,Lb87c
+			nop
+			rst	00h
+			ret	nz
+			or	b
+			pop	bc
+			ex	af,af'
+			and	a
+			sbc	a,e
+			sub	c
+			or	d
+			adc	a,h
+			halt
+			ld	(hl),b6h
+			add	hl,bc
+			ld	a,d
+			call	pe,Lb0bf
+			ld	b,e
+			cp	d
+			ld	a,c
+			ld	a,(hl)
+			rra
+			djnz	L48e2
+			ld	e,e
+			ld	h,a
+			ld	e,e
+			inc	bc
+			push	bc
+			ld	c,c
+			inc	hl
+			ld	d,(hl)
+			ccf
+			ld	l,a
+			halt
+			ld	(hl),l
+			ld	d,d
+			cp	a
+			cpl
+			dec	b
+			or	a
+			jp	(hl)
+			db	11h,77h,74h,cch,39h,5dh
+			di
+			ld	(hl),h
+			ld	c,h
+			ld	(bc),a
+			sbc	a,c
+			ld	d,(hl)
+			or	l
+			jp	m,L211b
+			call	m,L5f6b
+			add	hl,bc
+			cp	a4h
+			jp	z,Ldde7
+			ld	c,35h
+			rst	18h
+			or	c
+			nop
+			sbc	a,h
+			adc	a,h
+			cp	c
+			ld	c,(hl)
+			ld	b,l
+			res	3,h
+			ld	b,c
+			ld	d,h
+			jp	po,L4cc9
+			ld	b,b2h
+			dec	e
+			sub	a
+			ld	c,b
+			ld	e,b
+			ret	po
+			xor	c
+			xor	c
+			ret	pe
+			rst	18h
+			xor	a
+			inc	c
+			rst	30h
+			ld	hl,(63b4h)
+			ld	(hl),d
+			djnz	L49b0
+			ld	e,(hl)
+			ld	h,h
+			jp	nz,L6b48
+			add	hl,sp
+			ld	h,l
+			ei
+			dec	a
+			ld	a,a
+			cp	(ix + 63h)
+			ld	e,c
+			xor	h
+			jp	z,L4edd
+			dec	a
+			add	a,d
+			inc	h
+			ld	a,b
+			call	p,L776d
+			jp	po,L415a
+			or	h
+			ld	c,d
+			ld	d,ddh
+			rlca
+			ld	a,d
+			inc	b
+			ei
+			ld	d,c
+			ld	l,a
+			ld	b,h
+			pop	bc
+			ei
+			ret	m
+			ld	d,e
+			adc	a,f4h
+			ld	b,h
+			ld	(hl),7bh
+			rlca
+			ex	(sp),hl
+			adc	a,(hl)
+			and	a
+			ld	d,8eh
+			or	b3h
+			cp	d
+			sbc	a,l
+			inc	b
+			push	de
+			daa
+			xor	ixh *
+			add	a,(hl)
+			call	p,L7be6
+			and	b
+			ret	pe
+			jp	z,L376e
+			ld	d,h
+			ld	e,c
+			add	a,c
+			jp	nz,L0236
+			ld	d,b
+			ex	(sp),hl
+			or	a
+			cp	e
+			ld	e,l
+			push	hl
+			ld	b,b
+			rst	18h
+			adc	a,a
+			ld	sp,1c68h
+			add	a,(hl)
+			and	a
+			call	p,L3abf
+			and	b
+			add	a,a
+			add	a,c
+			ld	(9caeh),hl
+			ex	(sp),hl
+			dec	h
+			ld	d,a
+			ld	l,9fh
+			ld	a,h
+			ld	c,d
+			adc	a,d
+			dec	sp
+			jp	po,Le71a
+			ld	a,07h
+			jr	nz,L49dd
+			ld	b,(hl)
+			dec	e
+			or	e
+			ld	(de),a
+			ret	c
+			sbc	a,d
+			rra
+			ld	b,h
+			ret	pe
+			adc	a,(hl)
+			cpl
+			and	72h
+			jr	nc,L49d7
+			ld	(hl),e
+			inc	de
+			rst	28h
+			cp	b
+			ld	(hl),c9h
+			inc	h
+			and	a
+			sbc	a,67h
+			or	h
+			or	a
+			ld	h,c
+			jp	p,L8e28
+			exx
+			exx
+			nop (2x) *
+			sbc	a,d
+			ret	p
+			ret	m
+			rst	38h
+			or	a
+			ld	(hl),d
+			ld	(hl),d
+			inc	hl
+			ld	l,e
+			ld	b,a
+			adc	a,7eh
+			add	a,a
+			or	b
+			ex	(sp),hl
+			cp	e
+			cp	a
+			inc	(hl)
+			add	hl,sp
+			pop	af
+			ld	e,l
+			or	d9h
+			ld	(hl),h
+			rst	28h
+			ld	(hl),l
+			ld	e,c
+			ld	b,l
+			ld	(cf25h),hl
+			call	c,L6945
+			jp	L04d6
+			db	31h,10h,26h,d4h,25h,1bh,f9h,ebh
+			db	23h,81h,c7h,fah,b8h,72h,96h,7ch
+			db	feh,22h,cfh,bbh
+			dec	h
+			call	po,L43c4
+			inc	d
+			and	h
+			ccf
+			sbc	a,a
+			or	a
+			ret	m
+			adc	a,h
+			sub	e
+			ld	(hl),d
+			ld	d,b
+			ld	l,d
+			ld	a,e
+			sub	a
+			and	h
+			ld	l,c6h
+			sub	(hl)
+			ld	(hl),bfh
+			cp	b
+			jr	nz,L4aa3
+			or	a
+			add	a,b
+			add	a,a
+			ld	l,(hl)
+			jp	(hl)
+			db	92h,97h,82h,c9h
+			and	e
+			adc	a,e
+			ld	(hl),l
+			ld	a,(bc)
+			adc	a,a
+			ld	h,h
+			out	(68h),a
+			ld	(d4e8h),hl
+			ld	e,e
+			ld	sp,f18bh
+			ld	(hl),d
+			dec	c
+			ld	b,c
+			ld	(hl),c
+			halt
+			in	a,(3bh)
+			dec	d
+			jp	m,Lec29
+			xor	l
+			ccf
+			or	e
+			inc	e
+			ret
+			db	a1h,92h,8bh,73h,0bh,d6h,91h,b3h
+			db	97h,95h,94h,9fh,3dh,15h,54h,8fh
+			db	46h,ech,cfh,f7h
+			inc	de
+			nop
+			scf
+			push	de
+			ld	(bc),a
+			call	c,Ld76d
+			jp	nz,Lf8cc
+			ld	l,(hl)
+			rst	08h
+			dec	bc
+			add	a,53h
+			cp	cbh
+			ld	c,(hl)
+			ld	(hl),l
+			ld	l,a
+			dec	(hl)
+			ld	d,l
+			ld	l,e
+			ld	(hl),21h
+			ld	c,(hl)
+			dec	sp
+			jp	p,L797a
+			ret	pe
+			ld	l,(hl)
+			rrca
+			cp	d
+			ld	l,f5h
+			call	nz,Lf523
+			or	68h
+			xor	e
+			ld	e,b
+			ld	d,c
+			xor	l
+			pop	hl
+			ld	e,h
+			ld	a,e
+			dec	e
+			and	f6h
+			ld	d,l
+			ld	l,(hl)
+			ld	c,63h
+			ld	e,a
+			cp	d
+			call	nc,Lc47a
+			ld	e,l
+			rst	30h
+			jp	po,La234
+			ld	e,d
+			ld	e,b
+			ld	h,(hl)
+			and	(hl)
+			rst	38h
+			ld	h,c
+			or	c
+			sub	c
+			dec	h
+			ld	d,(hl)
+			adc	a,(hl)
+			ld	sp,hl
+			jr	L4b65
+			db	23h,f7h,81h,81h,c4h
+			call	c,L6d91
+			and	b
+			nop (2x) *
+			rst	18h
+			ld	l,a
+			ex	de,hl
+			sbc	a,e
+			ld	(de),a
+			inc	h
+			ld	b,e
+			ld	(hl),l
+			ld	c,79h
+			ld	e,e
+			ld	e,h
+			adc	a,l
+			ld	l,(hl)
+			inc	(hl)
+			sbc	a,h
+			ld	a,l
+			dec	c
+			ld	a,c
+			ld	a,(bc)
+			ld	c,e
+			inc	a
+			ld	a,(de)
+			ld	b,e
+			and	a
+			or	h
+			sub	h
+			ret	nz
+			ld	hl,(7e69h)
+			ld	b,b
+			jr	nc,L4aaa
+			sub	(hl)
+			sbc	a,b
+			sbc	a,(hl)
+			ld	a,a
+			add	a,b
+			call	L6864
+			ld	(hl),02h
+			add	a,d
+			ld	e,a
+			ld	hl,(e5c5h)
+			ld	c,l
+			jr	c,L4ab7
+			or	l
+			rst	28h
+			call	po,Lb508
+			dec	de
+			ld	c,d
+			ld	h,(hl)
+			or	e
+			xor	(hl)
+			ld	a,(886bh)
+			call	pe,L9ebd
+			sub	b
+			sub	l
+			ld	sp,hl
+			rra
+			di
+			ld	(5fc4h),hl
+			add	a,l
+			ld	e,(hl)
+			ld	d,ddh
+			ld	e,d
+			di
+			ld	e,b1h
+			xor	c
+			or	(hl)
+			ld	de,9e08h
+			ld	a,(hl)
+			xor	a
+			nop (2x) *
+			adc	a,d
+			xor	b
+			sub	d
+			ld	e,d
+			and	b
+			ld	b,(hl)
+			and	e
+			ld	d,l
+			sub	d
+			ld	bc,bdc5h
+			ld	(3935h),a
+			xor	a5h
+			ld	c,l
+			ld	l,3bh
+			ld	b,bbh
+			cp	l
+			daa
+			and	9ah
+			out	(a6h),a
+			sbc	a,b
+			ld	c,1eh
+			or	f5h
+			ld	c,b
+			xor	l
+			rst	08h
+			ld	(de),a
+			ld	e,l
+			xor	d
+			add	a,c
+			ld	l,e
+			jp	z,L058e
+			cp	f0h
+			ld	(hl),a
+			and	d
+			add	a,c
+			ld	c,e
+			inc	hl
+			jp	L0119
+			db	e4h,c0h,dah,55h,81h,6dh,82h,0ch
+			db	33h,e2h,1fh,a5h,3dh,c1h,7ah,9ah
+			db	d6h,7dh,abh,39h,50h,abh,bdh,2ch
+			db	62h,65h,7eh,35h,7eh,2fh,50h,f3h
+			db	6fh,cch,45h,24h,72h,8eh,18h,eeh
+			db	61h,c3h,a3h,fch,d1h,22h,41h,b3h
+			db	38h,6ch,b6h,1eh,0bh,8bh
+			sbc	a,a
+			jp	z,L43de
+			ei
+			ld	l,c
+			adc	a,f3h
+			exx
+			dec	b
+			ld	l,b
+			dec	de
+			call	pe,Lb869
+			ld	e,c
+			sub	e
+			ccf
+			xor	b
+			ld	(hl),c
+			add	a,d
+			add	hl,sp
+			sub	l
+			sub	(hl)
+			pop	bc
+			sub	e
+			or	b
+			inc	hl
+			out	(fdh),a
+			ld	h,c
+			inc	d
+			adc	a,c
+			ex	af,af'
+			ld	h,l
+			ret	m
+			ld	(hl),b
+			cp	c
+			pop	hl
+			sbc	a,l
+			ld	b,b
+			ld	h,b
+			ld	e,b
+			ld	bc,1489h
+			sub	e
+			ld	(b04bh),a
+			ld	h,d
+			adc	a,h
+			rla
+			rst	38h
+			pop	de
+			add	a,(hl)
+			rla
+			ld	h,d
+			ld	h,b
+			ld	d,h
+			sbc	a,(hl)
+			ld	d,(hl)
+			cpl
+			rrca
+			jp	nz,La05f
+			or	h
+			add	a,a
+			push	af
+			inc	d
+			jp	nz,Lb709
+			ld	l,e
+			or	(hl)
+			ld	c,l
+			rlca
+			jp	p,L2d8e
+			sbc	a,c
+			rl	e
+			ret	c
+			rst	30h
+			ld	h,42h
+			xor	b
+			ld	d,(hl)
+			adc	a,d
+			pop	de
+			ld	b,a
+			ld	b,l
+			ld	l,2dh
+			inc	e
+			ld	a,c
+			rst	08h
+			call	nz,Le35c
+			ld	a,(de)
+			dec	h
+			jp	(hl)
+			db	56h,b3h,a8h,9dh,60h,fah,a9h,0ch
+			db	38h,50h,bch,98h,0ch,fch
+			or	e
+			ld	a,b
+			ld	h,d
+			sbc	a,(hl)
+			inc	b
+			jp	(hl)
+			db	68h,45h,f6h,1ah,a5h,7ah,76h,dfh
+			db	41h,7dh,e4h,19h,96h,81h
+			rst	00h
+			xor	h
+			ld	b,b
+			nop (2x) *
+			call	nc,L3c30
+			cp	(hl)
+			ld	l,l
+			rst	18h
+			inc	e
+			ld	h,h
+			inc	(hl)
+			or	b
+			inc	sp
+			xor	l
+			add	hl,bc
+			ld	c,c
+			call	pe,L44f4
+			ld	h,b
+			ld	a,l
+			xor	a
+			and	a
+			ld	b,d
+			ld	e,e
+			add	a,h
+			or	d
+			call	c,L28c8
+			ld	d,(hl)
+			dec	d
+			scf
+			dec	de
+			nop (2x) *
+			and	e
+			ld	c,e
+			inc	bc
+			cp	b0h
+			jp	po,Lca4f
+			dec	e
+			or	l
+			adc	a,c
+			ret	pe
+			rra
+			or	d
+			ld	a,(5188h)
+			and	h
+			ld	l,d
+			ld	c,(hl)
+			ld	l,e
+			ld	h,(hl)
+			in	a,(82h)
+			and	fdh
+			dec	a
+			ld	a,12h
+			out	(14h),a
+			ld	h,(hl)
+			ld	h,d
+			jp	z,L06aa
+			ld	a,(de)
+			and	e
+			ld	e,(hl)
+			ld	c,b
+			rst	08h
+			ld	l,e
+			adc	a,e
+			ld	h,e
+			ld	h,h
+			ld	d,a
+			ld	(hl),b
+			adc	a,c
+			ld	h,c2h
+			call	nc,L963c
+			add	a,h
+			inc	sp
+			ex	de,hl
+			ld	l,e
+			add	a,e1h
+			ld	(4badh),a
+			inc	c
+			ld	e,cah
+			jr	nz,L4cb8
+			pop	af
+			rla
+			jp	Lb11d
+			db	c9h,85h,54h,bdh,6ah,25h,f0h,d0h
+			db	48h
+			cp	e
+			add	hl,hl
+			jr	nc,L4c77
+			dec	c
+			jp	po,La26e
+			ld	d,h
+			nop (2x) *
+			inc	a
+			ld	e,e
+			inc	b
+			or	h
+			ld	c,b
+			inc	(hl)
+			and	a
+			cp	ach
+			ld	h,e
+			adc	a,d
+			set	3,(hl)
+			jr	nc,L4c8b
+			add	a,l
+			jp	p,Lf12f
+			xor	l
+			add	a,b
+			call	Lb041
+			ret	nc
+			jp	p,L3bc3
+			sub	d
+			ld	a,h
+			ld	b,e
+			ld	l,b
+			cp	d
+			ld	l,h
+			jp	nc,Ldcde
+			sbc	a,l
+			rst	28h
+			scf
+			ld	h,(hl)
+			dec	hl
+			rra
+			cp	e
+			ld	c,d
+			inc	a
+			sbc	a,e
+			cp	a
+			ld	b,(hl)
+			inc	b
+			sub	b
+			sbc	a,e
+			add	hl,hl
+			inc	b
+			jp	po,L212c
+			ccf
+			ld	(hl),e
+			sub	a
+			ret	nz
+			rlca
+			ccf
+			ld	de,5849h
+			ld	l,l
+			rst	10h
+			ld	b,(hl)
+			di
+			sub	b
+			cp	l
+			and	d
+			sbc	a,a
+			dec	d
+			call	pe,L2508
+			adc	a,h
+			ld	e,b
+			ex	(sp),hl
+			inc	e
+			sbc	a,h
+			jp	(hl)
+			db	63h,e9h,9eh,b0h,5bh,cch,f1h,ech
+			db	a6h,19h,36h,83h,c2h,cch,3dh,61h
+			db	31h,41h,87h,93h,20h,48h,83h,36h
+			db	8ch,f1h,a1h,49h,d6h,a7h,bbh,9bh
+			db	a1h,f3h,2ch,b9h,0fh,7dh,14h
+			inc	sp
+			or	b1h
+			and	b
+			adc	a,a
+			dec	b
+			ld	b,b
+			ld	(hl),l
+			ld	a,d
+			or	h
+			ld	c,96h
+			ld	a,b
+			ld	e,c
+			inc	b
+			ld	(bc),a
+			jr	z,L4cfe
+			inc	l
+			cp	l
+			exx
+			call	p,La425
+			ld	h,e
+			sub	e
+			ld	sp,hl
+			ld	d,l
+			ret	p
+			ld	c,h
+			ret	pe
+			ld	e,l
+			sbc	a,65h
+			rlca
+			adc	a,d
+			ret	pe
+			push	de
+			xor	c
+			ld	l,h
+			ret	p
+			ld	(de),a
+			rst	30h
+			ld	(hl),h
+			cp	h
+			pop	bc
+			add	a,l
+			ld	(hl),e
+			or	e
+			ld	e,h
+			inc	h
+			adc	a,(hl)
+			nop
+			sub	d
+			inc	bc
+			xor	94h
+			push	hl
+			call	z,L22d2
+			call	pe,L00f1
+			inc	e
+			and	d
+			dec	a
+			inc	e
+			xor	a
+			ld	d,l
+			ld	l,d
+			inc	h
+			jp	nz,L492a
+			ex	(sp),hl
+			and	l
+			add	hl,hl
+			call	c,L41c4
+			ld	c,(hl)
+			nop (2x) *
+			sub	a
+			ex	de,hl
+			add	hl,sp
+			ex	af,af'
+			ld	c,31h
+			rst	18h
+			di
+			sbc	a,b
+			ld	a,6bh
+			ld	c,49h
+			dec	e
+			or	47h
+			inc	sp
+			ld	l,h
+			ld	b,(hl)
+			or	b
+			sbc	a,d
+			push	bc
+			jp	nz,L8813
+			push	hl
+			or	(hl)
+			xor	c
+			inc	bc
+			cp	h
+			or	b
+			ld	c,d
+			ld	(hl),l
+			add	a,04h
+			ld	h,l
+			jr	nc,L4d90
+			sub	b
+			rst	38h
+			dec	a
+			ret	po
+			add	hl,sp
+			or	(hl)
+			or	h
+			ld	a,l
+			ret	p
+			inc	hl
+			inc	h
+			rlca
+			and	(hl)
+			ret	pe
+			sub	e
+			rla
+			ld	d,c
+			inc	bc
+			or	a
+			ld	d,e2h
+			ld	d,c
+			or	e
+			ld	b,l
+			rst	08h
+			ld	e,c
+			call	m,Le7fa
+			jp	pe,L56de
+			ret	c
+			ld	c,(hl)
+			sub	b
+			call	pe,L5585
+			ld	bc,3bebh
+			ld	c,h
+			nop
+			daa
+			ld	h,d
+			push	af
+			and	5ah
+			cp	64h
+			rst	20h
+			sub	h
+			ld	d,(hl)
+			adc	a,a
+			cp	e
+			ld	b,e
+			jp	po,Leeb2
+			dec	b
+			rst	28h
+			dec	b
+			ld	(hl),a
+			adc	a,c
+			cp	h
+			jp	nc,Lfe63
+			jp	po,Le5bd
+			dec	a
+			xor	(hl)
+			add	a,e
+			dec	l
+			scf
+			ld	b,d
+			add	a,h
+			call	po,Lb47f
+			ld	e,a
+			add	a,c
+			sbc	a,23h
+			ld	a,a
+			ld	d,l
+			ld	(hl),d
+			dec	hl
+			ld	c,e
+			or	d
+			ld	(998bh),hl
+			ret	p
+			ld	hl,(f810h)
+			inc	bc
+			add	a,e
+			ld	h,c
+			ld	h,l
+			dec	a
+			inc	e
+			ld	b,l
+			dec	(hl)
+			call	z,L09c1
+			sbc	a,h
+			adc	a,l
+			nop (2x) *
+			jp	Lb97a
+			db	cah,28h,d9h,f9h,7ch,f5h,58h,68h
+			db	dch,afh,97h,c6h,4ch,dah
+			ld	b,(hl)
+			ex	af,af'
+			ld	h,e
+			or	e
+			inc	l
+			adc	a,a
+			inc	a
+			call	p,Lcb7e
+			ld	(hl),h
+			ld	sp,8a16h
+			ld	(37eah),a
+			jr	z,L4eb5
+			add	hl,hl
+			rst	20h
+			ld	hl,55e2h
+			and	(hl)
+			and	c
+			xor	l
+			cp	a
+			rst	38h
+			ld	(de),a
+			sub	b
+			jp	m,Ld8ce
+			ex	(sp),hl
+			call	L12d3
+			ld	a,(hl)
+			ld	c,a
+			ret	p
+			ret	m
+			call	m,La0dc
+			ld	a,e
+			exx
+			adc	a,a
+			adc	a,91h
+			adc	a,(hl)
+			rra
+			ld	a,a
+			ld	d,h
+			ld	a,(6d89h)
+			add	hl,bc
+			or	1dh
+			inc	hl
+			ld	e,c
+			ld	a,(de)
+			ld	b,h
+			ld	b,a
+			ld	b,h
+			pop	de
+			call	c,L7f5a
+			or	d
+			sub	a
+			jp	po,L7ade
+			ld	(hl),a
+			ld	b,c
+			jp	p,L3246
+			ld	(65a2h),a
+			ld	d,a
+			sll	c
+			sub	(hl)
+			dec	a
+			ld	e,b
+			call	pe,Ld636
+			jp	m,Lb539
+			adc	a,bch
+			call	L82bc
+			rla
+			in	a,(31h)
+			scf
+			adc	a,a
+			dec	sp
+			sbc	a,(hl)
+			ld	h,e
+			call	L8488
+			ld	(cd2dh),a
+			ld	e,l
+			jp	m,L1bf2
+			sbc	a,b
+			ld	h,d
+			ld	(bc),a
+			rra
+			ld	d,(hl)
+			exx
+			ld	(hl),d
+			ld	(d519h),hl
+			ld	a,l
+			djnz	L4ec7
+			ld	(hl),c
+			nop
+			dec	a
+			inc	h
+			ld	e,72h
+			and	d
+			ld	a,l
+			inc	sp
+			rst	10h
+			jp	nc,L06ab
+			sbc	a,d
+			ld	a,h
+			ld	h,l
+			ld	a,(hl)
+			dec	l
+			adc	a,b
+			dec	l
+			ld	(de),a
+			inc	(hl)
+			ld	b,a
+			and	l
+			sub	d
+			ld	h,l
+			add	hl,sp
+			ret	po
+			call	L3274
+			cp	bdh
+			jp	(hl)
+			db	1dh,ddh,feh,9ah,5bh,8eh,f8h,d1h
+			db	4ch,51h,1ah,47h,d0h,17h,e0h,ceh
+			db	c4h,76h,37h,15h,e2h,0ch,aah,f5h
+			db	12h,95h,72h,75h,8eh,2fh,f4h,f1h
+			db	1bh,23h,64h,bfh,08h,c3h,9dh,f1h
+			db	70h,b1h,f9h,cah,ach,41h,9bh,8fh
+			db	edh,77h,ffh,56h,b6h,65h,88h,01h
+			db	54h,45h,40h,6bh,74h,89h,a7h,2dh
+			db	dfh,92h,e6h,afh,c7h,68h,92h,2bh
+			db	28h,2dh,09h,b0h,00h,adh,c7h,57h
+			db	b6h,e0h,94h,10h,b6h,12h,88h,6ah
+			db	c7h,1bh,eeh,c6h,ceh,d2h
+			ld	e,h
+			ld	b,(hl)
+			rlca
+			add	a,a
+			jr	L4f8c
+			db	96h,afh,b0h,d3h,ceh,aah,04h
+			pop	hl
+			rlca
+			jp	nz,L8201
+			sub	(hl)
+			jp	pe,Lca7d
+			sbc	a,h
+			ld	sp,hl
+			cp	e
+			or	d
+			or	c
+			jr	z,L4f4c
+			ld	b,4bh
+			daa
+			rst	00h
+			add	hl,bc
+			ex	af,af'
+			ld	h,c
+			ld	h,a
+			ld	b,(hl)
+			dec	c
+			inc	b
+			call	p,L7440
+			ret	z
+			jp	p,L391f
+			ld	(hl),h
+			ld	(de),a
+			ld	b,l
+			jp	p,L6c2c
+			ex	de,hl
+			ld	b,b
+			sbc	a,c
+			dec	c
+			ld	a,(c5b7h)
+			call	po,L9869
+			sub	07h
+			or	c
+			ld	c,01h
+			xor	h
+			ld	sp,d0d5h
+			ld	e,h
+			res	2,c
+			ret	pe
+			adc	a,(hl)
+			ld	a,i
+			ld	(hl),b
+			out	(62h),a
+			ei
+			call	pe,Lf5ee
+			ld	l,d
+			ld	d,h
+			sbc	a,h
+			di
+			ld	l,e
+			cp	f0h
+			rra
+			call	nc,L9e53
+			or	e
+			sub	(hl)
+			ld	(c87ch),hl
+			ld	e,h
+			inc	de
+			adc	a,72h
+			dec	(hl)
+			jr	z,L4f59
+			ld	b,h
+			sub	l
+			inc	l
+			adc	a,b
+			ld	(hl),b
+			ld	b,c
+			sbc	a,c
+			ld	e,e
+			cp	(hl)
+			ld	l,h
+			dec	d
+			add	a,c
+			push	hl
+			add	a,bbh
+			jp	p,Lbbbe
+			add	a,c6h
+			rst	20h
+			sub	l
+			inc	d
+			and	e
+			ld	h,(hl)
+			inc	c
+			ld	c,1ah
+			cpl
+			ld	l,c
+			sub	c
+			sub	bfh
+			or	l
+			sbc	a,h
+			ld	e,c
+			rra
+			ld	a,1ch
+			rst	18h
+			sub	b
+			ld	l,e
+			ld	c,(hl)
+			inc	d
+			ld	d,adh
+			inc	b
+			ld	a,h
+			ld	b,a
+			ld	e,d
+			ld	d,a
+			pop	hl
+			out	(d9h),a
+			jp	nc,Le176
+			or	83h
+			ret	p
+			ld	c,cch
+			jp	pe,L2699
+			out	(3eh),a
+			add	a,d
+			jp	p,L6c12
+			ld	h,l
+			dec	a
+			call	Lbc3f
+			ld	l,b
+			jr	z,L5045
+			xor	d
+			adc	a,c
+			ld	c,d
+			inc	l
+			sbc	a,l
+			ld	a,deh
+			ld	bc,9f67h
+			pop	hl
+			inc	b
+			ld	e,e
+			ld	a,e
+			call	z,L972c
+			ld	h,(hl)
+			add	a,b
+			rst	20h
+			pop	hl
+			ld	h,(hl)
+			jp	c,Lfe8a
+			dec	c
+			ld	a,(bc)
+			ld	h,a
+			sub	e
+			add	a,c
+			ld	(hl),70h
+			xor	d
+			jp	nc,L0c7f
+			add	a,l
+			dec	c
+			and	c
+			ld	e,b
+			and	c
+			sub	(hl)
+			rlca
+			xor	(hl)
+			sub	b
+			inc	l
+			ret	nc
+			ld	a,(hl)
+			inc	de
+			sbc	a,d
+			ld	d,98h
+			call	pe,L5c4c
+			jr	nz,L4fe0
+			ld	l,e
+			adc	a,a
+			ret	c
+			ld	a,h
+			inc	b
+			ld	(hl),h
+			sbc	a,d
+			cp	h
+			dec	e
+			rst	20h
+			or	h
+			ld	(4719h),a
+			pop	hl
+			and	l
+			cp	l
+			ld	a,a6h
+			dec	bc
+			cp	94h
+			cpl
+			ld	a,c
+			sub	l
+			jp	p,L3d40
+			ld	e,l
+			ld	(hl),h
+			inc	de
+			dec	bc
+			ex	af,af'
+			ret	m
+			call	nz,L92f6
+			ex	af,af'
+			call	pe,Led6b
+			sub	h
+			ld	b,d
+			ld	hl,(df2fh)
+			add	a,f6h
+			add	a,d
+			inc	sp
+			call	m,L85ce
+			inc	e
+			ld	h,a
+			ld	c,d
+			ld	(de),a
+			djnz	L50ec
+			daa
+			out	(79h),a
+			call	po,Lde5f
+			ld	c,b
+			ld	b,l
+			ld	(hl),h
+			add	a,b
+			adc	a,c
+			ld	l,b
+			ld	b,c
+			sub	e
+			and	e
+			sbc	a,h
+			jp	m,L36e7
+			dec	a
+			ld	c,c
+			ld	c,h
+			ld	(hl),l
+			ld	b,(hl)
+			dec	b
+			rst	10h
+			sbc	a,h
+			dec	e
+			djnz	L50ff
+			ld	e,l
+			ex	(sp),hl
+			jp	p,L27ab
+			add	a,a
+			inc	l
+			ld	c,04h
+			nop (2x) *
+			cp	7fh
+			rrca
+			ld	a,e
+			and	b
+			jr	c,L510b
+			jp	(hl)
+			db	13h,d5h,13h,40h,c1h,1ah,d5h,2ch
+			db	c0h,9eh,e2h,17h,08h,20h,04h,65h
+			db	43h,8bh,f9h,8eh,08h,f7h,ceh,4ah
+			db	68h,a3h,efh,dfh,f0h,6eh,38h,71h
+			db	48h,eah,6fh,e7h,beh,08h,dbh
+			add	a,f4h
+			ld	a,h
+			ret	p
+			ld	d,(hl)
+			inc	e
+			and	b
+			inc	(hl)
+			ld	b,b
+			rst	18h
+			halt
+			sub	l
+			ld	h,e
+			ld	sp,bea4h
+			and	d
+			ld	h,d
+			call	z,L3651
+			call	nz,L2f66
+			ld	(hl),a
+			add	hl,hl
+			ld	b,d
+			ld	e,(hl)
+			xor	d
+			ld	d,d
+			and	l
+			ret	po
+			xor	e
+			ld	d,d
+			or	h
+			ld	a,d
+			ld	(bc),a
+			sbc	a,4bh
+			ld	sp,hl
+			ld	l,e
+			ld	a,b
+			rlca
+			rst	00h
+			cpl
+			ret	p
+			ld	b,a
+			ld	e,6ah
+			ld	b,c
+			inc	h
+			ld	b,b
+			ld	l,e
+			and	b
+			jp	z,L6347
+			inc	d
+			ld	(bc),a
+			rlca
+			inc	b
+			jr	z,L5093
+			push	af
+			jp	p,Lad85
+			ld	e,b
+			dec	(ix + b0h)
+			rst	38h
+			and	a
+			call	c,Le57b
+			inc	sp
+			xor	c
+			ld	e,20h
+			di
+			pop	de
+			ld	d,a
+			adc	a,l
+			ld	c,d
+			sub	c
+			ld	a,(de)
+			ld	l,17h
+			djnz	L5111
+			ld	l,b
+			xor	(hl)
+			rst	18h
+			ld	c,c
+			sbc	a,l
+			ld	hl,e204h
+			ld	a,a
+			ld	a,(bc)
+			call	po,Lc768
+			xor	l
+			ld	d,a
+			push	de
+			call	nc,L6fab
+			ld	b,c
+			inc	bc
+			jr	z,L50d4
+			dec	c
+			ld	d,l
+			ld	(hl),l
+			ld	d,(hl)
+			ld	h,b
+			and	c
+			sub	e
+			ld	c,b
+			call	z,Le6d5
+			ret	p
+			pop	hl
+			inc	hl
+			ld	hl,(29d8h)
+			ret	c
+			ld	(hl),b
+			bit	4,(hl)
+			ld	de,c639h
+			rst	38h
+			ld	e,l
+			ld	a,d
+			or	h
+			adc	a,b
+			pop	bc
+			ret	z
+			ld	e,b
+			and	b
+			ld	l,a
+			rst	38h
+			ld	h,h
+			dec	b
+			ld	(bc),a
+			dec	l
+			jp	nz,L0d18
+			ld	b,e
+			nop
+			adc	a,b
+			ld	e,d
+			inc	(hl)
+			ret
+			db	7fh,08h,e7h,c7h,44h,9ah,5fh,2dh
+			db	0eh,19h,f0h,4dh,7ch,3bh,20h,f1h
+			db	8ch,94h,bch,36h,37h,75h,5eh,99h
+			db	d9h,a9h,80h,7dh,35h,80h,15h,58h
+			db	00h,72h,e5h,7eh,34h,65h,dbh,b9h
+			db	1ah,14h,88h,ddh,6fh,f6h,66h,7fh
+			db	59h,5fh,2ch
+			dec	d
+			ccf
+			xor	b
+			di
+			call	pe,L6797
+			ld	hl,(L09b9)
+			jp	nz,L5f71
+			dec	e
+			rst	10h
+			ld	(hl),b
+			ld	e,(hl)
+			ld	l,d9h
+			ld	a,e
+			ld	c,(hl)
+			xor	l
+			or	l
+			sbc	a,e
+			rst	00h
+			sub	4ah
+			cp	l
+			adc	a,(hl)
+			pop	af
+			jp	(hl)
+			db	e4h,dfh,39h,65h,2ah,9eh,75h,8bh
+			db	0eh,43h,81h,c1h,57h,bfh,a4h,11h
+			db	53h,95h,e5h,03h,92h,60h,ceh,57h
+			db	c9h,a6h,1ch,9ah,e7h,c0h,f3h,f5h
+			db	adh,3bh,60h,d0h,2eh,c0h,c3h,3ch
+			db	86h,31h,68h,26h,55h,0bh,f5h,20h
+			db	e9h,53h,abh,29h,49h,efh,51h,0ch
+			db	43h,c3h,bah
+			call	Lca2f
+			ld	e,h
+			add	hl,hl
+			ld	(hl),d
+			ld	sp,73d5h
+			or	e
+			ld	a,(hl)
+			ld	a,l
+			call	L68a4
+			inc	b
+			push	af
+			ld	e,e
+			dec	sp
+			or	h
+			ld	b,d
+			cpl
+			or	a
+			ld	h,b6h
+			in	a,(5eh)
+			add	a,d
+			xor	l
+			ld	h,a
+			rst	00h
+			adc	a,a
+			jp	nz,L53af
+			call	c,L1d15
+			ld	d,c
+			ld	b,h
+			jr	c,L5235
+			ld	d,(hl)
+			ld	c,e
+			ld	(hl),l
+			xor	d
+			dec	h
+			add	a,c7h
+			ld	e,d
+			rra
+			ld	h,d
+			ld	a,(bc)
+			ld	l,e
+			pop	bc
+			call	nz,L6f23
+			inc	(iy + f1h)
+			ld	(hl),b
+			ld	e,d
+			ld	(865dh),a
+			sbc	a,e
+			or	d
+			or	e
+			call	z,Lcec5
+			ld	h,49h
+			rlca
+			jp	nz,L73aa
+			ld	(hl),b
+			ld	e,e
+			halt
+			add	a,a
+			xor	(hl)
+			ld	sp,hl
+			inc	de
+			add	a,b
+			ld	c,d
+			ld	e,(hl)
+			add	a,h
+			out	(82h),a
+			add	a,a
+			ret
+			db	ebh,14h,7ah,b1h,30h,9fh,2fh,49h
+			ld	(hl),l
+			ld	l,l
+			ld	a,(de)
+			jr	L52a7
+			db	86h,06h,88h,7bh,f0h
+			ld	e,b
+			ld	a,(ed7ch)
+			dec	h
+			or	e
+			rlca
+			di
+			ld	h,(hl)
+			sub	a2h
+			ld	b,3dh
+			inc	c
+			ld	e,b
+			add	a,l
+			ld	c,(hl)
+			ld	bc,cb27h
+			ld	l,b
+			ld	(hl),c
+			adc	a,h
+			ld	c,aeh
+			inc	sp
+			ld	h,b
+			ld	hl,0a79h
+			dec	sp
+			ld	a,b
+			ld	hl,f423h
+			inc	b
+			jr	nc,L5218
+			ld	b,l
+			push	hl
+			or	e
+			ld	a,l
+			nop (2x) *
+			adc	a,c
+			ld	h,c
+			ret	pe
+			ld	c,a
+			dec	hl
+			out	(1bh),a
+			sbc	a,c
+			ld	(hl),h
+			sbc	a,b6h
+			pop	bc
+			ld	l,a
+			ld	d,a0h
+			rst	30h
+			ld	e,cfh
+			dec	h
+			jr	c,L52a4
+			ret	pe
+			rrca
+			sbc	a,c
+			rst	20h
+			or	a
+			inc	de
+			ld	c,d
+			ld	h,58h
+			pop	de
+			add	hl,de
+			dec	b
+			add	a,e
+			jp	(hl)
+			db	2eh,4fh,ceh,abh,f2h,a6h,fdh,fch
+			db	a7h,5bh,e6h,dbh,a1h,41h,aah,2ch
+			db	c0h,01h,d5h,8dh,94h,61h,c3h,22h
+			db	50h,cfh,ddh,02h,60h,47h,44h,bch
+			db	dbh,a5h,3eh,58h,e5h,a3h,10h,dch
+			db	29h,68h,1fh,29h,55h,6bh,a6h,d3h
+			db	afh,a0h,d7h,b5h,55h,aah,5ah,8eh
+			db	80h,3dh,bch,cch,47h,50h,9dh,a8h
+			db	09h,feh,ach,abh,7bh,afh,c6h,0eh
+			db	d1h,57h,5eh,44h,9ah,32h,f8h,a8h
+			db	37h,87h,c4h,6dh,10h,4fh,97h,efh
+			db	feh,dbh,b3h,bfh,e8h,1fh,2bh,93h
+			db	9ah,cbh,aeh,b2h,93h,cbh,49h,d0h
+			db	30h,e9h,ebh,8ah,91h,beh,39h,c5h
+			db	36h,3ah,0fh,d5h,adh,b9h,34h,98h
+			db	ceh,6ch,bdh,b6h,b7h,cbh,57h,a0h
+			db	9fh,92h,2fh,94h,beh,6bh,d0h,e5h
+			db	85h,85h,24h,40h,72h,b4h,d0h,edh
+			db	d2h,f6h,a7h,57h,5bh,ach,dah,7dh
+			db	e0h,68h,8bh,c8h,a8h,e4h,93h,ach
+			db	ech,a6h,a2h,5ah,efh,60h,efh,fdh
+			db	67h
+			ld	a,(hl)
+			call	Lfc18
+			ld	(hl),c
+			inc	sp
+			sbc	a,c
+			ld	a,b
+			ld	b,(hl)
+			xor	c
+			sub	a
+			ld	e,c
+			call	c,Lf1da
+			and	50h
+			ld	h,l
+			ret	i *
+			call	nz,L9fcf
+			ld	b,l
+			ld	a,l
+			exx
+			sub	h
+			sub	38h
+			ld	e,(hl)
+			or	a
+			ld	b,d
+			inc	bc
+			ld	b,a
+			add	a,(hl)
+			ld	e,c
+			rst	18h
+			and	l
+			adc	a,e
+			add	hl,bc
+			dec	a
+			inc	bc
+			jp	pe,L0bec
+			xor	ebh
+			in	a,(85h)
+			ld	l,52h
+			add	a,l
+			add	hl,de
+			ret	po
+			sbc	a,e
+			inc	hl
+			dec	sp
+			jp	nc,Led3d
+			add	a,53h
+			ld	d,b
+			add	a,a
+			add	a,c
+			ld	a,e7h
+			ld	d,(hl)
+			sub	(hl)
+			ld	c,28h
+			ld	h,(hl)
+			ld	(hl),d
+			dec	sp
+			adc	a,l
+			ld	h,(hl)
+			jr	c,L5381
+			adc	a,(hl)
+			ret	p
+			dec	bc
+			xor	h
+			ld	h,h
+			bit	2,(hl)
+			ld	(bc),a
+			ei
+			sbc	a,l
+			rst	00h
+			ret	p
+			dec	b
+			rlca
+			xor	b
+			ld	hl,(e501h)
+			push	hl
+			rlca
+			call	nc,L30b9
+			ld	b,a
+			ld	d,b
+			ld	h,(hl)
+			inc	d
+			di
+			ld	a,d
+			add	a,b
+			or	b
+			nop
+			dec	hl
+			adc	a,h
+			rst	18h
+			ld	(hl),b
+			adc	a,l
+			ret
+			db	b8h,09h,9bh,30h,89h,2ah,bbh,4dh
+			db	e0h,3ch,cdh,71h,35h,c1h,cah,72h
+			db	3ch,56h,64h,a5h,3dh,85h,5bh,25h
+			db	64h,2ch,78h,a9h,9dh,6ch,98h,dfh
+			db	06h,81h,f6h,00h,31h,4eh,43h,bdh
+			db	d1h,eah,f4h,31h,3bh,45h,31h,20h
+			db	40h,2fh,f1h,c8h,92h,f8h,c3h,fah
+			db	32h,abh
+			ld	e,08h
+			djnz	L5440
+			cp	l
+			add	a,h
+			or	c
+			sub	d
+			pop	hl
+			jp	c,L7246
+			ld	a,c
+			xor	c
+			adc	a,b
+			ld	(hl),f1h
+			and	l
+			ld	h,(hl)
+			or	43h
+			add	hl,bc
+			or	4fh
+			adc	a,b
+			call	p,L2ea5
+			adc	a,c
+			ret	pe
+			halt
+			rst	38h
+			ld	c,(hl)
+			ret	z
+			ret	m
+			ld	c,e
+			and	e
+			xor	d
+			ld	h,d
+			adc	a,c
+			ld	d,(hl)
+			adc	a,a
+			push	bc
+			adc	a,d
+			ld	de,98f5h
+			ld	e,l
+			or	b
+			xor	d5h
+			add	a,(hl)
+			add	a,e
+			cp	(hl)
+			ld	(de),a
+			adc	a,c
+			or	l
+			djnz	L5486
+			rst	10h
+			ret	c
+			sbc	a,h
+			inc	h
+			adc	a,d
+			ld	c,d
+			add	a,a
+			or	c
+			jp	po,Le033
+			ld	(hl),h
+			ld	l,a
+			ld	a,c
+			ld	b,b
+			nop
+			ld	d,b
+			adc	a,c
+			dec	bc
+			dec	a
+			ld	l,b
+			xor	5dh
+			jr	nz,L5437
+			sbc	a,c
+			dec	b
+			ld	h,d
+			rst	28h
+			push	hl
+			ld	a,b
+			ld	a,(bc)
+			or	(hl)
+			jr	c,L54e0
+			rst	10h
+			ld	h,h
+			and	c
+			call	nc,L6216
+			call	L97f6
+			ld	de,1e22h
+			ld	h,a
+			rla
+			ld	c,e
+			and	h
+			ld	l,e
+			cp	h
+			push	af
+			add	hl,sp
+			ld	b,(hl)
+			or	l
+			ld	a,a
+			nop (2x) *
+			ccf
+			ld	h,d
+			or	h
+			ld	a,c
+			ld	b,l
+			call	c,L4b22
+			and	(hl)
+			ld	l,(hl)
+			inc	h
+			cp	l
+			xor	d
+			nop
+			adc	a,e
+			rst	30h
+			or	l
+			ld	a,(bc)
+			jp	(hl)
+			db	27h,04h,eeh,2fh,30h,a4h,bfh,b1h
+			db	89h,99h,94h,9fh,32h,feh,22h,45h
+			db	a4h,2bh,fdh,2ch,9ah,d7h,04h,5bh
+			db	4dh,a4h,9bh,b7h,c5h,cfh,73h,c3h
+			db	3ch,27h,cah,e0h,e3h,86h,fah,9ch
+			db	3dh,87h,4bh,eah,07h,b5h,2fh,65h
+			db	feh,73h,b5h,40h,0bh,c9h,24h,d0h
+			db	c3h,71h,9dh,83h,66h,52h,8ch,b8h
+			dec	d
+			xor	(hl)
+			and	d
+			ret	p
+			ld	(823eh),a
+			ld	b,a
+			di
+			ld	b,(hl)
+			ld	l,a
+			ld	l,e
+			jr	L5476
+			db	f7h,e9h,01h,a5h,b2h,dch
+			ld	sp,5cbfh
+			adc	a,a
+			add	a,b
+			cpl
+			ret
+			db	5dh,c8h,f2h,67h,e1h,f1h,efh,41h
+			db	03h,21h,77h,fdh,53h,5bh,ddh,cbh
+			db	58h,c1h,1bh,40h,deh,00h,21h,07h
+			db	8bh,77h,52h,24h,bfh,05h,f2h,d8h
+			db	d6h,79h
+			add	hl,bc
+			ld	h,(hl)
+			add	a,d
+			dec	e
+			ld	l,e
+			jp	po,L13ba
+			rst	00h
+			rst	18h
+			rrca
+			inc	c
+			ld	a,h
+			ld	a,e
+			ret	pe
+			or	c
+			or	d
+			cp	b
+			cp	e
+			inc	h
+			jp	p,L469e
+			ld	c,f3h
+			sub	e
+			ld	a,d1h
+			halt
+			ld	a,l
+			ld	h,a
+			ld	d,l
+			ld	e,c
+			pop	bc
+			call	pe,L0f90
+			ret	z
+			inc	a
+			and	e
+			ld	e,d
+			ld	(de),a
+			ld	(hl),l
+			inc	(hl)
+			pop	bc
+			add	hl,bc
+			cp	dbh
+			nop (2x) *
+			ld	e,31h
+			dec	bc
+			call	po,Lde9c
+			push	de
+			ld	l,(hl)
+			or	h
+			or	l
+			add	a,c
+			ld	e,l
+			ld	(hl),h
+			dec	sp
+			ld	e,a
+			ld	h,h
+			dec	hl
+			ei
+			cp	a8h
+			and	d
+			jr	L55e0
+			db	36h
+			jp	nz,L4c70
+			ld	e,b
+			jr	z,L54f4
+			ld	c,e
+			inc	a
+			ld	b,e
+			dec	a
+			ld	(hl),c
+			ret	m
+			ld	h,a
+			ld	a,b
+			scf
+			ld	hl,263bh
+			call	po,L4786
+			dec	h
+			ld	e,d
+			ld	l,h
+			inc	e
+			xor	h
+			ld	hl,4446h
+			ex	(sp),hl
+			ld	a,(bc)
+			call	nz,L36ec
+			ld	l,d
+			call	m,Lf6b1
+			ret	p
+			adc	a,(hl)
+			ld	(hl),l
+			ld	d,b
+			ld	c,e
+			ld	e,h
+			adc	a,l
+			xor	c
+			ld	l,h
+			ld	d,(hl)
+			call	nc,Lc416
+			cp	e
+			sub	a
+			or	h
+			nop (2x) *
+			cpl
+			ld	d,33h
+			ld	h,4ah
+			inc	b
+			inc	e
+			xor	(hl)
+			dec	e
+			inc	h
+			ld	(a92ch),a
+			jr	L5567
+			db	b9h,60h,3dh,4dh,afh,e3h
+			ld	a,(hl)
+			sbc	a,d
+			cp	(hl)
+			xor	8ch
+			ret
+			db	a2h,cch,28h,76h,eah,9eh,7dh,e2h
+			db	3ah,dah,78h,6eh,5eh,bch,40h,ffh
+			db	95h,46h,d9h,40h,cfh,eah,37h,88h
+			db	40h,9fh,adh,b7h,4ch,4bh,7ch,afh
+			db	6eh,7dh,eeh,c3h,4eh,03h,33h
+			sub	(hl)
+			ld	a,(de)
+			or	(hl)
+			ld	(hl),l
+			or	c
+			ld	hl,c1a1h
+			ret	z
+			ld	a,e
+			cp	(hl)
+			inc	(hl)
+			cp	a
+			ld	(bc),a
+			push	bc
+			ld	(hl),d
+			push	af
+			call	Lce72
+			and	a
+			push	af
+			cp	l
+			ld	e,a
+			and	c
+			ld	sp,cfb9h
+			ld	b,c
+			push	de
+			ld	d,64h
+			ccf
+			sub	(hl)
+			call	pe,Lec73
+			jp	p,L8473
+			ld	d,h
+			ld	h,e
+			call	po,L4bc6
+			adc	a,d
+			adc	a,e5h
+			cp	c
+			cp	d
+			ld	b,l
+			ld	(hl),a
+			nop (2x) *
+			call	L7dd0
+			adc	a,a
+			ld	sp,hl
+			or	h
+			adc	a,c
+			dec	a
+			add	a,77h
+			cp	b
+			scf
+			jp	m,L98c5
+			ex	(sp),hl
+			ld	l,b
+			cp	09h
+			exx
+			ld	sp,hl
+			ret	z
+			push	bc
+			ld	bc,1adch
+			add	hl,bc
+			dec	l
+			rlca
+			or	1bh
+			push	bc
+			ld	e,f7h
+			rst	08h
+			add	hl,hl
+			call	nz,L7bc8
+			cp	d
+			ld	a,c
+			call	p,Lee2f
+			inc	e
+			sbc	a,35h
+			and	(hl)
+			rrca
+			jr	nz,L569d
+			ret	z
+			ld	(hl),b
+			and	d
+			ld	hl,6e2bh
+			ld	c,h
+			ld	a,(4f3ch)
+			ld	(hl),e
+			call	p,L7b47
+			ld	b,a
+			jr	c,L56bd
+			ld	(de),a
+			sbc	a,b
+			rst	30h
+			ld	a,h
+			push	bc
+			di
+			ld	b,c
+			jp	p,L943c
+			ld	sp,ec87h
+			adc	a,l
+			cp	b
+			and	a
+			sbc	a,cbh
+			ld	b,l
+			djnz	L565a
+			ld	a,e
+			ld	h,b
+			xor	e
+			di
+			and	(hl)
+			sbc	a,c
+			rst	30h
+			cp	a
+			call	z,L709b
+			ld	d,c
+			ld	c,a
+			ld	(hl),b
+			add	a,(hl)
+			xor	9fh
+			cp	d
+			jp	m,L1630
+			ret	po
+			ld	e,l
+			sbc	a,97h
+			inc	e
+			and	d
+			dec	c
+			adc	a,c
+			push	af
+			ld	b,(hl)
+			jr	z,L5681
+			ld	(7b6dh),hl
+			ret	pe
+			ld	(hl),d
+			ld	a,(bc)
+			ret	nz
+			ld	h,e
+			ld	(de),a
+			ld	a,30h
+			ld	e,b
+			and	(hl)
+			cp	c
+			ld	c,l
+			adc	a,e
+			inc	l
+			call	c,L2d41
+			inc	l
+			call	pe,L53d8
+			ld	hl,8a9bh
+			exx
+			nop (2x) *
+			sub	a0h
+			ld	(c008h),hl
+			add	a,d
+			ld	h,a
+			ld	a,d
+			ld	l,l
+			ld	b,l
+			inc	sp
+			push	de
+			ld	c,b
+			add	hl,de
+			ld	l,a
+			ld	a,h
+			add	a,6fh
+			cp	d
+			dec	de
+			adc	a,e
+			or	c
+			add	a,a5h
+			ld	c,l
+			rst	30h
+			inc	sp
+			and	a
+			ret	p
+			inc	d
+			xor	33h
+			sub	l
+			and	c
+			call	nc,Lb9de
+			rst	30h
+			ld	h,e
+			rrca
+			adc	a,l
+			and	d
+			ld	l,b
+			ld	e,e
+			ld	e,h
+			ld	e,c
+			xor	(hl)
+			scf
+			cp	d
+			or	l
+			push	bc
+			ld	b,(hl)
+			ret	p
+			add	a,b
+			ld	e,a6h
+			jp	pe,Laed9
+			add	a,(hl)
+			cp	c
+			sub	b
+			ld	d,e
+			ld	h,d
+			jp	nc,Lbf17
+			ex	de,hl
+			or	l
+			inc	d
+			inc	de
+			nop
+			set	7,e
+			ld	b,e
+			ld	sp,hl
+			ld	b,3eh
+			ld	d,b
+			ld	a,b
+			jp	po,L1630
+			jr	c,L572e
+			ld	(hl),a
+			cp	l
+			add	a,e
+			cp	b
+			xor	d
+			ld	(hl),h
+			add	a,a1h
+			jr	L56af
+			db	adh,39h,abh
+			ex	de,hl
+			ld	c,e
+			cp	c
+			dec	h
+			or	h
+			and	b
+			call	p,Ld782
+			cp	(hl)
+			dec	hl
+			ld	e,a
+			in	a,(38h)
+			ld	d,c5h
+			add	hl,sp
+			ld	(hl),h
+			and	a
+			ld	h,b
+			dec	h
+			call	L8370
+			pop	hl
+			inc	(hl)
+			or	a
+			sbc	a,(hl)
+			ei
+			or	(hl)
+			ld	e,b
+			ld	(hl),a
+			ld	h,15h
+			ld	d,l
+			ld	d,h
+			ld	c,8dh
+			jr	z,L56e5
+			rla
+			cp	e
+			jr	L56fc
+			db	f5h,fbh
+			ld	(hl),a
+			sbc	a,l
+			add	a,a
+			sbc	a,h
+			inc	a
+			cp	a
+			ld	h,d
+			rst	10h
+			adc	a,b
+			ld	c,a
+			ld	d,c
+			xor	b
+			inc	de
+			call	nc,La588
+			xor	c
+			ld	c,b
+			adc	a,c7h
+			ld	e,h
+			ld	a,l
+			or	l
+			and	c
+			or	h
+			ld	sp,c00bh
+			out	(92h),a
+			ld	e,c
+			ld	bc,6c26h
+			add	a,a
+			ld	l,l
+			inc	b
+			rra
+			ld	d,d
+			ld	c,e
+			ld	b,e5h
+			rlca
+			sub	l
+			ld	(hl),afh
+			rst	00h
+			add	a,e
+			adc	a,b9h
+			ld	hl,20d3h
+			or	h
+			ld	h,b
+			di
+			adc	a,e6h
+			sbc	a,d
+			ld	d,h
+			xor	(hl)
+			sbc	a,h
+			pop	bc
+			ld	c,h
+			ld	(hl),a8h
+			ld	(hl),c
+			ld	a,h
+			call	m,L0ec0
+			ld	c,h
+			add	a,h
+			sbc	a,c
+			dec	d
+			add	a,21h
+			ld	de,a9b4h
+			sbc	a,59h
+			cp	(hl)
+			sbc	a,a
+			ld	a,(1aeeh)
+			cp	d
+			ld	l,h
+			inc	c
+			ld	a,b
+			inc	c
+			ld	(hl),b
+			cp	l
+			ret	c
+			ld	a,(hl)
+			ld	e,c
+			inc	hl
+			rst	38h
+			inc	hl
+			ccf
+			inc	l
+			dec	sp
+			ld	l,d
+			cpl
+			add	a,d
+			ld	b,a
+			or	2ah
+			xor	e
+			sbc	a,(hl)
+			or	b
+			ld	e,c
+			rst	28h
+			nop (2x) *
+			inc	b
+			call	nz,Lf9a8
+			jp	(hl)
+			db	42h,6bh,05h,f3h,6bh
+			ld	l,e
+			call	m,L4c7d
+			add	a,a
+			dec	bc
+			jp	nc,L9b51
+			add	hl,hl
+			pop	de
+			ret	p
+			or	03h
+			add	a,a
+			rst	30h
+			sbc	a,d
+			ld	e,h
+			ret	nz
+			dec	c
+			ld	sp,85cfh
+			pop	de
+			cp	a
+			ld	(de),a
+			ld	e,a
+			ret	z
+			rst	38h
+			push	bc
+			adc	a,(hl)
+			jp	z,La593
+			dec	d
+			ld	c,a
+			daa
+			halt
+			jr	L57d1
+			db	b3h,98h,3fh
+			ld	h,l
+			ld	d,l
+			sbc	a,l
+			djnz	L5864
+			ld	a,b
+			ld	(hl),d
+			ret
+			db	93h,2bh,7fh,63h,1ah,2ah,08h,53h
+			db	39h,34h,dfh,e8h,a2h,33h,73h,2ch
+			db	21h,20h,f4h,8bh,beh,eeh,b6h,69h
+			db	1fh,b9h,44h,a9h,91h,aah,08h,d2h
+			db	2eh,b1h,30h,a8h,b8h,23h,3eh,37h
+			db	8fh,b4h,71h,41h,d9h,c9h,c3h,b2h
+			db	bah,9ch,aeh,41h,62h,3bh,11h,45h
+			db	9ah,ebh,ebh,fch,bfh,a0h,b8h,6fh
+			db	b9h,72h,24h,2ah,c3h,d0h,e2h,29h
+			db	3bh,d9h,c3h,e1h,16h,73h,ffh,88h
+			db	d1h,abh,4dh,d2h,6bh,b3h,feh,9dh
+			db	a9h,d2h,dfh,c6h,65h
+			xor	c7h
+			xor	l
+			ld	l,a
+			ex	de,hl
+			ld	l,h
+			otdr
+			rlca
+			add	a,c
+			and	l
+			jp	La497
+			db	7ah,82h,c4h,10h,5bh,ach,dfh,b9h
+			db	34h,e5h,bah
+			ld	b,a
+			push	de
+			add	a,4fh
+			ld	b,h
+			ld	c,b
+			and	b
+			ld	l,b
+			and	l
+			ld	c,d
+			rst	20h
+			ret	nz
+			dec	bc
+			add	a,(hl)
+			call	nc,Lb416
+			ld	h,c
+			add	a,c
+			or	b
+			ld	b,8fh
+			exx
+			sub	e
+			add	hl,sp
+			add	hl,de
+			sub	a
+			inc	hl
+			call	z,L90cf
+			cp	(hl)
+			dec	e
+			or	a
+			ld	(hl),d
+			and	a
+			add	a,c
+			ld	l,c
+			ld	(hl),l
+			rst	00h
+			jr	z,L584b
+			or	d
+			add	a,l
+			sbc	a,b9h
+			ret	nc
+			rst	08h
+			ret	c
+			ex	(sp),hl
+			jp	nz,L1911
+			rst	00h
+			ld	l,d
+			or	c
+			jr	L58e2
+			db	16h,ebh,beh,99h,64h,cdh,b8h,f4h
+			db	7eh,c1h,84h,dfh,2fh,36h,deh,89h
+			db	0bh,0dh,7ah,08h,8bh,8eh,eah,b8h
+			db	cfh,67h
+			and	e
+			djnz	L5931
+			ld	b,c
+			ld	de,f3d1h
+			halt
+			add	a,2fh
+			sbc	a,l
+			sbc	a,l
+			sbc	a,a
+			ld	b,b
+			add	hl,hl
+			jp	z,Ldf7d
+			ld	h,e
+			xor	l
+			call	nc,L926b
+			ld	e,b
+			pop	bc
+			cp	a
+			nop
+			ld	(hl),b
+			ld	b,e
+			adc	a,h
+			add	a,e
+			cpl
+			ld	l,e
+			sub	l
+			or	c
+			sub	h
+			in	a,(b9h)
+			ld	c,e
+			dec	e
+			sbc	a,a
+			and	9fh
+			sbc	a,a
+			ld	(bc),a
+			sub	d
+			rst	20h
+			ld	d,b
+			ld	b,l
+			jp	nc,L0c68
+			pop	hl
+			ld	d,3fh
+			call	nc,Lf67c
+			ld	a,(de)
+			rst	08h
+			dec	hl
+			dec	sp
+			jp	m,L1384
+			ld	iyl,iyh *
+			ld	e,c
+			jr	nz,L58b8
+			ld	(hl),a5h
+			pop	hl
+			or	39h
+			sbc	a,a
+			ld	(hl),a
+			or	l
+			nop (2x) *
+			ld	d,c
+			dec	d
+			scf
+			di
+			inc	hl
+			ld	c,e
+			rrca
+			ld	e,a
+			rlca
+			ex	af,af'
+			ei
+			ld	a,03h
+			cp	l
+			inc	l
+			ld	l,fdh
+			ld	a,h
+			and	a
+			ld	(5e4eh),hl
+			add	a,e
+			ld	h,e
+			add	a,40h
+			ld	d,ebh
+			push	af
+			ld	de,f00eh
+			ret	z
+			ld	b,(hl)
+			ld	(hl),d
+			rst	10h
+			ex	af,af'
+			add	hl,de
+			pop	hl
+			ret	z
+			ld	b,c
+			add	a,l
+			nop
+			ld	e,e
+			cp	b
+			jr	c,L5941
+			cp	d
+			ld	e,e
+			dec	c
+			ld	d,d4h
+			ld	hl,06c2h
+			sub	(hl)
+			daa
+			sub	d
+			sub	e
+			xor	e
+			rrca
+			ld	c,a
+			ld	a,a
+			inc	de
+			jp	po,L9fc1
+			pop	de
+			rlca
+			add	a,c6h
+			add	a,a
+			ld	e,33h
+			inc	h
+			jp	nz,L3d64
+			jp	pe,L2fc3
+			cpl
+			sub	l
+			ld	d,l
+			and	a
+			ret
+			db	96h,13h,eah,fah,a3h,ech,f8h,3eh
+			db	3ah,61h,85h,d5h,0dh,65h,bfh,01h
+			db	7ch,28h,45h,7ah,5ch,cah,32h,d6h
+			db	71h,e3h,6ah,eeh,16h,70h,a8h,7ch
+			db	78h,eah,12h,06h,eah,4dh
+			dec	h
+			ld	l,d
+			jr	nc,L5999
+			jp	z,L4e83
+			dec	hl
+			or	b
+			ld	b,a
+			dec	sp
+			sub	(hl)
+			rst	38h
+			ld	hl,(744ah)
+			push	de
+			ld	h,e
+			or	d
+			adc	a,(hl)
+			and	(hl)
+			sbc	a,e
+			add	a,e
+			jr	L59eb
+			db	ech,c0h,9ch,48h,d6h,46h,b2h,0dh
+			db	06h,8eh,48h,29h,ech,90h,4bh,9ah
+			db	80h,90h,11h,cah,23h,a6h,bdh,9fh
+			call	p,Lc614
+			ret	c
+			add	a,d
+			ld	c,c
+			call	nz,L14a8
+			dec	e
+			and	e
+			pop	af
+			xor	(hl)
+			xor	b
+			or	e
+			nop
+			and	h
+			inc	h
+			ld	b,d
+			jr	z,L594a
+			inc	e
+			xor	c
+			jp	nc,Lf6c3
+			ld	h,b
+			ld	e,c
+			and	d
+			pop	hl
+			ret	m
+			or	b
+			rst	38h
+			ld	b,4eh
+			dec	c
+			dec	b
+			cp	c
+			ld	e,l
+			call	m,L536b
+			add	a,b
+			ld	b,h
+			jp	nz,Lfd01
+			ld	c,l
+			sub	(hl)
+			ld	h,b
+			jp	nz,L1783
+			adc	a,h
+			inc	bc
+			inc	a
+			ld	b,l
+			ld	e,h
+			xor	d
+			ld	d,b
+			cp	(hl)
+			ex	(sp),hl
+			pop	de
+			dec	a
+			jr	L5984
+			db	4ch,31h,f6h,4ch,4eh,96h,cch,a0h
+			db	9dh,afh,4ah,cbh,45h,d6h,77h,b2h
+			db	e3h,3eh,aeh,16h,a8h,c3h,17h,a3h
+			db	fbh,3dh,35h,74h,8ah,9dh,3eh,96h
+			db	98h,50h,d3h,49h,93h,2ah,d9h,d9h
+			db	9bh,36h,ach,dfh,a4h,e2h,ech,4bh
+			db	2ah,d1h,eeh,0eh,90h,f5h,01h,ffh
+			db	48h,3ch,b7h,feh,8ch,73h,80h,97h
+			db	d2h,81h,90h,71h
+			add	hl,hl
+			adc	a,a
+			inc	a
+			ld	sp,hl
+			ret
+			db	3bh,e9h,ceh,eeh,8ch,18h,40h,6ah
+			db	b0h,ddh,15h,52h,eah,1ah,78h,21h
+			db	d0h,79h,48h
+			ld	e,1eh
+			xor	c
+			rrca
+			add	hl,bc
+			rla
+			adc	a,h
+			sbc	a,d7h
+			sbc	a,b
+			ld	(hl),h
+			dec	l
+			inc	(hl)
+			ld	d,h
+			ld	l,d
+			ld	b,a
+			ld	hl,43a8h
+			add	a,a
+			or	c
+			ld	l,d3h
+			ld	l,d
+			or	l
+			or	(hl)
+			add	a,43h
+			sub	l
+			ld	b,e
+			sbc	a,c
+			pop	bc
+			xor	2ch
+			cp	(hl)
+			ld	b,e
+			sbc	a,a
+			dec	sp
+			push	de
+			rst	08h
+			xor	b
+			call	La0d1
+			rst	30h
+			jp	p,L3b5b
+			jp	po,Lc6b6
+			ret	z
+			ld	b,c4h
+			sub	h
+			ld	e,e
+			xor	fch
+			ld	d,(hl)
+			ld	a,(hl)
+			inc	bc
+			sub	(hl)
+			sbc	a,e
+			add	a,(hl)
+			ld	e,c
+			ld	a,02h
+			out	(8ch),a
+			ld	l,c
+			ld	c,b
+			ld	c,e
+			inc	a
+			cp	c
+			ld	b,e
+			ret	po
+			rst	18h
+			sub	2dh
+			ret	nc
+			ld	l,(hl)
+			scf
+			push	hl
+			and	d
+			ld	b,a
+			ld	b,(hl)
+			ld	(hl),l
+			sub	e
+			cp	l
+			ld	d,30h
+			nop (2x) *
+			ex	de,hl
+			cp	l
+			ld	l,(hl)
+			rlca
+			sbc	a,l
+			sbc	a,e
+			cp	b
+			xor	59h
+			out	(42h),a
+			ex	af,af'
+			or	04h
+			jr	z,L5b37
+			and	h
+			ld	d,c
+			add	hl,sp
+			ld	h,c
+			rst	28h
+			call	c,L6e80
+			inc	(hl)
+			adc	a,(hl)
+			ld	c,h
+			dec	l
+			ld	c,a
+			ld	b,h
+			ret	m
+			ld	a,l
+			ld	e,b
+			ld	b,a
+			jp	po,L8a2b
+			or	l
+			pop	bc
+			ld	d,c
+			rlca
+			call	c,Lae7c
+			ld	e,h
+			daa
+			xor	c
+			dec	d
+			dec	c
+			ld	sp,hl
+			cp	e
+			jp	z,L3dae
+			ld	a,l
+			rst	30h
+			ret	m
+			djnz	L5b04
+			call	nz,L1fb5
+			jr	z,L5b04
+			adc	a,c
+			sbc	a,b
+			dec	(hl)
+			ld	(hl),c
+			adc	a,(hl)
+			inc	d
+			dec	b
+			sub	l
+			cp	d
+			pop	af
+			ret	pe
+			sub	e
+			ld	h,e
+			or	(hl)
+			ld	l,c
+			ex	(sp),hl
+			daa
+			sub	d
+			ld	a,(4cdbh)
+			ld	h,b
+			ld	c,b
+			adc	a,l
+			cp	d
+			ex	af,af'
+			ret	m
+			ld	h,l
+			add	a,e
+			ld	c,d
+			ld	a,c
+			xor	b
+			ld	e,79h
+			pop	de
+			ex	de,hl
+			or	a
+			jp	z,L91d9
+			adc	a,d
+			ld	l,c
+			ld	e,a
+			add	hl,bc
+			adc	a,e
+			ld	(hl),c
+			scf
+			dec	l
+			ld	a,h
+			exx
+			ld	a,b
+			rst	08h
+			inc	c
+			sub	l
+			ld	(bc),a
+			scf
+			ex	(sp),hl
+			xor	b
+			ld	e,e
+			xor	d
+			ld	c,33h
+			or	c
+			or	b
+			add	hl,hl
+			ld	l,l
+			rst	30h
+			dec	d
+			scf
+			ld	a,49h
+			push	af
+			ld	b,dbh
+			nop (2x) *
+			add	a,a
+			sub	b
+			or	d
+			ld	e,(hl)
+			xor	h
+			inc	c
+			ret	p
+			sub	h
+			ld	e,h
+			ld	h,d
+			ex	de,hl
+			and	b
+			ld	c,c
+			outi
+			ld	h,b
+			ld	h,(hl)
+			ret	c
+			nop
+			rlca
+			xor	l
+			ld	a,a
+			dec	de
+			xor	l
+			xor	b
+			ld	l,b
+			or	3ah
+			ld	l,66h
+			or	fch
+			ld	b,b
+			xor	(hl)
+			ld	b,e
+			or	c5h
+			push	bc
+			ld	a,(hl)
+			ret	nc
+			ld	e,e
+			xor	b
+			ld	l,h
+			xor	l
+			sub	e
+			jp	(hl)
+			db	cfh,9fh,c4h,19h,e0h,d1h,3fh,f7h
+			db	eeh,88h,08h,3dh,a1h,40h,07h,0ah
+			db	68h,0dh,2ch,99h,47h,09h,3bh,f2h
+			db	53h,cbh,c7h,fbh,d4h,abh,23h,69h
+			db	c0h,d6h,40h
+			and	a
+			and	l
+			dec	hl
+			rla
+			and	c
+			or	b
+			djnz	L5b37
+			rst	30h
+			dec	e
+			or	b
+			sub	b
+			halt
+			ld	a,e
+			sub	h
+			rst	38h
+			ld	l,b
+			push	af
+			sub	d
+			jr	nc,L5bb9
+			ld	(hl),b
+			ld	b,e
+			ld	hl,df8ch
+			ld	de,99c1h
+			add	a,(hl)
+			ld	h,h
+			or	(hl)
+			ld	d,(hl)
+			ld	c,a
+			inc	c
+			ld	e,e
+			ld	b,a
+			ld	de,2f8dh
+			rlca
+			cp	c2h
+			or	l
+			djnz	L5bf2
+			nop
+			sbc	a,h
+			ld	de,5c2ah
+			ld	a,h
+			jp	nz,Lcb1d
+			ld	a,(Leb83)
+			ccf
+			add	hl,hl
+			jp	m,Le5d8
+			ld	c,d
+			dec	d
+			ccf
+			or	d
+			ret	p
+			cpl
+			ld	d,c
+			ld	e,e
+			ex	de,hl
+			inc	(hl)
+			cp	d
+			ld	(hl),b
+			and	e
+			ld	l,c
+			add	hl,sp
+			dec	l
+			adc	a,b
+			cp	(hl)
+			sbc	a,e
+			ld	h,c
+			dec	l
+			ld	h,h
+			adc	a,4ch
+			ld	a,c
+			ex	af,af'
+			ld	h,e
+			adc	a,d
+			out	(f0h),a
+			sub	b
+			and	b
+			sbc	a,h
+			jr	z,L5b98
+			inc	bc
+			or	e
+			add	a,d8h
+			xor	l
+			ld	e,e
+			adc	a,(hl)
+			cpl
+			ld	b,l
+			and	c
+			ret	m
+			add	a,h
+			rrca
+			ld	c,a
+			ld	l,a
+			dec	h
+			call	p,L250b
+			add	a,d
+			xor	40h
+			ld	e,e
+			rst	08h
+			xor	c
+			dec	d
+			ld	c,(hl)
+			jp	nc,La9f5
+			ld	(2a48h),a
+			or	h
+			di
+			ld	d,e
+			ld	a,h
+			and	a
+			ld	l,e2h
+			cp	d
+			or	l
+			rst	30h
+			dec	de
+			ld	a,(8aaah)
+			jp	(hl)
+			db	26h,93h,0ah,48h,9bh,f3h,43h,61h
+			db	aeh,b1h,ffh,aeh,7dh,9dh,65h,b2h
+			db	64h,28h,4ch,45h,13h,7ah,e8h,31h
+			sbc	a,b
+			add	a,d
+			dec	hl
+			sbc	a,(hl)
+			and	e
+			dec	e
+			ld	b,b
+			ex	de,hl
+			rst	38h
+			jp	c,L8232
+			exx
+			ret	c
+			add	hl,hl
+			jp	po,L317a
+			sbc	a,l
+			or	h
+			ld	d,h
+			ld	e,l
+			ccf
+			inc	c
+			xor	h
+			jp	m,L020d
+			xor	a
+			push	de
+			ld	a,a
+			ld	l,b
+			jp	nc,Le779
+			inc	h
+			push	hl
+			and	l
+			cp	h
+			and	a
+			jp	pe,Lfd46
+			daa
+			xor	h
+			in	a,(86h)
+			xor	e
+			ld	l,h
+			inc	h
+			daa
+			rlca
+			ccf
+			call	po,L1160
+			ld	c,(hl)
+			ld	b,d
+			add	hl,bc
+			cp	d8h
+			jp	z,Lf66c
+			inc	a
+			ld	h,b
+			ld	a,l
+			jp	L1517
+			db	96h,e1h,4bh,95h,d9h,08h,b3h,d9h
+			db	cbh,89h,54h,21h,85h,02h,34h,24h
+			db	a7h,77h,f9h,5bh,9eh,07h,a1h
+			add	hl,sp
+			ret	nc
+			inc	bc
+			sub	a
+			ld	e,(hl)
+			ld	sp,hl
+			dec	l
+			ld	d,h
+			sub	b
+			ld	hl,5f50h
+			dec	c
+			and	d
+			dec	e
+			add	hl,de
+			or	l
+			add	hl,de
+			xor	h
+			ld	c,d
+			ld	(b459h),a
+			xor	h
+			inc	c
+			sbc	a,b
+			ex	(sp),hl
+			add	hl,de
+			push	bc
+			jp	c,Lcbef
+			dec	l
+			dec	d
+			add	a,e
+			ret	nc
+			bit	4,c
+			dec	l
+			pop	bc
+			ld	h,f5h
+			nop
+			inc	l
+			ld	e,88h
+			ld	d,e
+			ld	l,a
+			jp	pe,L5273
+			adc	a,b
+			ld	d,h
+			ld	a,d
+			inc	bc
+			djnz	L5d22
+			sub	c
+			cp	3fh
+			ret	nz
+			ld	b,l
+			sub	e
+			ret	p
+			ld	(603dh),hl
+			ld	a,c
+			ld	h,(hl)
+			adc	a,c
+			add	a,c
+			ld	a,d
+			rst	28h
+			ld	(hl),l
+			ld	a,h
+			ld	a,(d6d9h)
+			add	a,(hl)
+			jp	L817b
+			db	3eh,13h,f0h,2fh,71h,1dh,69h,c7h
+			db	5eh,1fh,9bh,2bh,e7h,dbh,42h,8eh
+			db	38h
+			ld	de,c3f1h
+			sub	d
+			rst	10h
+			or	f7h
+			cp	c
+			or	e
+			ex	af,af'
+			and	e
+			sub	(hl)
+			ld	a,(de)
+			ld	l,b
+			add	hl,hl
+			jp	nz,L7e05
+			ld	(hl),b
+			add	a,a
+			ld	l,(hl)
+			ld	h,b
+			or	a
+			ld	h,90h
+			jp	c,L5b8b
+			inc	(hl)
+			ld	c,b
+			sub	e
+			or	c
+			ccf
+			dec	hl
+			jr	c,L5d21
+			dec	e
+			ld	a,b
+			xor	a
+			pop	bc
+			cp	l
+			cp	l
+			add	hl,de
+			cp	h
+			jp	m,Ld130
+			dec	a
+			or	b
+			halt
+			xor	d
+			adc	a,81h
+			and	l
+			nop (2x) *
+			sub	b
+			ld	bc,b641h
+			inc	e
+			ld	e,h
+			xor	(hl)
+			add	a,b
+			sub	b
+			add	a,(hl)
+			ld	b,c
+			push	bc
+			ld	bc,756fh
+			xor	b
+			ld	(hl),h
+			ld	b,d
+			ld	d,h
+			inc	b
+			add	a,d
+			cp	h
+			rra
+			ccf
+			inc	d
+			ld	c,(hl)
+			ld	b,h
+			ld	h,b
+			pop	bc
+			ld	b,d
+			ld	h,h
+			ld	(hl),a
+			ld	d,l
+			pop	de
+			adc	a,h
+			sub	l
+			ld	l,e
+			ld	e,e
+			jp	m,L213c
+			and	c
+			inc	h
+			dec	de
+			push	bc
+			ld	a,c
+			rst	18h
+			or	68h
+			jp	Lb2a8
+			db	d0h,5bh,80h,e4h,16h,0ah,d9h,9ch
+			db	a3h,52h,ddh,16h,feh,82h,11h
+			di
+			ld	(hl),a
+			jp	Ldf3f
+			db	a6h,00h,d0h,95h,a0h,0ah,4bh,81h
+			db	bdh,91h,00h,3bh,a7h,3fh,c2h,62h
+			db	51h,f5h,e3h,6dh,d3h,84h,eah,a2h
+			db	51h,4bh,ddh
+			ld	(hl),d
+			cp	e
+			and	h
+			xor	h
+			or	c
+			ld	sp,hl
+			ld	h,d
+			ld	(9d19h),a
+			sub	(hl)
+			ld	(de),a
+			and	l
+			ld	h,b
+			ld	b,b
+			ld	l,a
+			jp	c,L6809
+			ld	(hl),e
+			dec	l
+			ret	nz
+			ld	(1afch),hl
+			rst	00h
+			ld	c,a
+			or	e
+			out	(1ch),a
+			ld	d,e
+			ld	h,h
+			and	c
+			nop
+			rst	20h
+			ret	pe
+			exx
+			ld	d,h
+			sub	d
+			ret	m
+			ld	l,d
+			ld	de,75e8h
+			ld	a,(hl)
+			jp	nz,L5613
+			add	a,eeh
+			ld	l,c
+			sbc	a,a
+			ld	(hl),c
+			dec	l
+			ld	d,c
+			set	3,e
+			jr	c,L5d6f
+			cp	6dh
+			sub	e
+			or	h
+			ld	c,c
+			or	a
+			call	c,L0f63
+			add	a,h
+			and	80h
+			sub	h
+			xor	51h
+			jp	m,L098d
+			or	l
+			cp	l
+			sbc	a,a
+			ld	e,(hl)
+			push	de
+			ld	b,9ch
+			jp	nc,L32d1
+			dec	h
+			inc	h
+			add	hl,hl
+			call	z,L3ff2
+			and	(hl)
+			rst	10h
+			sub	a
+			jp	nz,L57bb
+			and	b
+			adc	a,(hl)
+			halt
+			sbc	a,c
+			exx
+			ld	a,e
+			adc	a,71h
+			ld	h,e
+			ld	e,e
+			or	a
+			ret	c
+			and	a
+			adc	a,h
+			ld	h,87h
+			and	h
+			ld	d,d
+			xor	d
+			jp	po,L6976
+			rst	00h
+			jp	p,L78b1
+			inc	c
+			sub	(hl)
+			ld	h,d
+			ld	a,e4h
+			ld	a,b
+			cp	h
+			ld	h,d
+			dec	de
+			ld	d,l
+			dec	c
+			adc	a,h
+			call	m,L445d
+			cp	c
+			rst	20h
+			ld	c,h
+			di
+			ex	af,af'
+			ld	a,d
+			ld	c,d
+			out	(0ch),a
+			push	bc
+			call	pe,L9709
+			xor	c
+			ld	c,d
+			ld	a,h
+			xor	e
+			inc	hl
+			ld	a,2ch
+			ld	l,(hl)
+			add	a,h
+			ret	z
+			add	a,(hl)
+			sub	h
+			ret	po
+			rst	28h
+			ld	e,(hl)
+			ld	c,h
+			push	af
+			ld	a,e1h
+			pop	hl
+			add	a,b
+			ld	e,l
+			call	z,Lfd11
+			inc	hl
+			ld	d,d
+			ld	b,a
+			add	a,(hl)
+			call	z,L5fd8
+			rst	00h
+			inc	c
+			rst	28h
+			and	a
+			sbc	a,b
+			ret
+			db	b1h,59h,54h,7ah,fbh,74h,cbh,32h
+			db	94h,88h,bch,f6h,e4h,d0h,5fh,23h
+			db	36h,50h
+			ld	d,d0h
+			sbc	a,b
+			or	03h
+			ld	a,c
+			or	b
+			ld	(bb9ah),a
+			call	p,L4123
+			rst	18h
+			call	nz,L65fe
+			dec	hl
+			xor	l
+			ld	e,e
+			xor	d
+			push	de
+			ld	(de),a
+			sub	h
+			and	a
+			adc	a,b
+			ld	(hl),a
+			add	hl,de
+			exx
+			ld	l,e
+			ld	c,l
+			ld	a,7ch
+			ld	a,b
+			ld	d,e
+			ld	b,b
+			sub	h
+			and	h
+			rst	28h
+			xor	b
+			adc	a,(hl)
+			ld	l,d
+			sbc	a,b
+			jr	c,L5e9a
+			ld	a,d
+			scf
+			or	a
+			ld	ixh,c *
+			and	a
+			or	l
+			cp	77h
+			inc	c
+			ld	c,e
+			ccf
+			djnz	L5ef2
+			ld	e,h
+			ld	a,h
+			add	a,8fh
+			rst	38h
+			ld	e,dbh
+			pop	bc
+			halt
+			dec	c
+			ret	p
+			pop	af
+			ld	h,e
+			pop	hl
+			rst	08h
+			rst	30h
+			ld	sp,hl
+			cp	l
+			add	a,c
+			jp	nz,L370c
+			ld	b,f6h
+			ld	sp,201ah
+			cp	b
+			inc	l
+			or	c
+			sbc	a,c
+			and	h
+			ld	a,b
+			ret	po
+			ld	d,a
+			and	e
+			call	nz,L22b0
+			ld	c,c
+			ld	a,e
+			pop	de
+			ld	d,d
+			rst	10h
+			ld	(hl),e
+			ld	a,d
+			djnz	L5e9e
+			ld	(hl),b
+			ret	pe
+			inc	h
+			sub	e
+			ld	(719ch),a
+			inc	hl
+			inc	d
+			ret	c
+			ld	a,d
+			rst	08h
+			sbc	a,b
+			sbc	a,l
+			cp	d
+			ld	h,a
+			dec	h
+			jr	nz,L5f55
+			rst	30h
+			or	b
+			res	3,h
+			jp	L8a6c
+			db	e6h,24h
+			ld	hl,9141h
+			add	hl,sp
+			sbc	a,a
+			call	c,L9311
+			rst	08h
+			ld	sp,hl
+			dec	de
+			sbc	a,e
+			add	a,l
+			add	a,c
+			jp	(hl)
+			db	7fh,f9h,aah,ddh,3dh,b6h,13h,30h
+			db	f8h,34h,24h,edh,fch,9fh,48h,d3h
+			db	e4h,b6h,c7h,cch,06h,b6h,6eh,3dh
+			db	d6h,8bh,c2h,51h,1eh,a0h,12h,8dh
+			db	b5h,1ch,f6h,c5h,55h,9ch,b9h,71h
+			db	51h,86h,08h,b2h,70h,fbh,cdh,f6h
+			db	cah,56h,57h,7ah,fah,aeh,9ch,36h
+			db	4dh,b1h,55h,6bh,c6h,72h,77h,2bh
+			db	2fh,97h,43h,99h,8ah,54h,a1h,b8h
+			db	a7h,1ch,84h,b7h,c4h,72h,6eh,fbh
+			db	9ch,a5h,ach,2ch,4eh,1fh,03h,6ah
+			db	0fh,c2h,8eh,98h,44h,f0h,1ch
+			halt
+			ld	a,e
+			ld	b,a
+			rst	08h
+			ld	b,(hl)
+			call	po,Lba48
+			xor	c
+			dec	bc
+			ret	m
+			sub	b
+			add	a,l
+			add	hl,hl
+			sbc	a,(hl)
+			cp	l
+			jp	m,Lb945
+			ld	d,(hl)
+			add	a,b
+			rst	38h
+			cp	c
+			rst	28h
+			ex	af,af'
+			or	(hl)
+			inc	c
+			dec	l
+			add	hl,sp
+			ld	h,a
+			and	d
+			cp	a3h
+			inc	de
+			add	a,c
+			and	29h
+			jp	po,L53ab
+			ld	c,(hl)
+			add	a,e
+			or	c
+			ld	(hl),c
+			inc	sp
+			add	a,l
+			and	c
+			sub	a
+			rrca
+			inc	de
+			add	a,b
+			jp	po,L093a
+			jp	m,L7c61
+			sbc	a,l
+			ld	l,c
+			ld	c,d
+			adc	a,c
+			ld	(43f5h),hl
+			ld	e,h
+			ld	e,d
+			dec	e
+			add	a,b
+			call	po,L75f3
+			jp	z,L363e
+			ret	nc
+			jp	pe,Lfcb1
+			sub	l
+			ex	af,af'
+			jp	z,L3038
+			sub	b
+			call	po,L25a8
+			dec	l
+			xor	a
+			ld	l,c
+			add	a,b
+			add	a,(hl)
+			adc	a,d
+			ret	po
+			add	a,c
+			pop	hl
+			in	a,(8ah)
+			and	e
+			ld	sp,hl
+			inc	d
+			ret	z
+			ld	l,c
+			sub	b
+			ld	h,a
+			ld	l,b
+			ld	l,e
+			jr	c,L5f98
+			ret	nz
+			push	hl
+			ld	d,b
+			xor	e
+			add	a,a
+			call	po,L102b
+			ld	l,(hl)
+			and	e
+			inc	bc
+			ret	nc
+			sub	d
+			ld	h,a
+			ld	(hl),d
+			ld	(8752h),a
+			ld	e,(hl)
+			sub	l
+			ld	(hl),l
+			sbc	a,c
+			adc	a,6bh
+			inc	b
+			ld	l,b
+			rlca
+			ld	b,d
+			ld	b,c
+			ld	h,h
+			ld	c,(hl)
+			or	d
+			sbc	a,(hl)
+			ld	bc,a6efh
+			ld	h,0ch
+			and	c
+			and	l
+			di
+			dec	c
+			ld	(34b0h),a
+			add	a,l
+			sbc	a,(hl)
+			adc	a,l
+			inc	hl
+			add	hl,hl
+			cp	l
+			sub	e
+			ld	(hl),b
+			ld	hl,4a24h
+			rlca
+			jp	L8324
+			db	56h,bdh,32h,82h,1bh,f9h,35h,72h
+			db	2ah,ach,cbh,b1h,95h,7ah,48h,d5h
+			db	86h,5ch,d6h,4bh,01h,1fh,4bh,c0h
+			db	7eh,3dh,c2h,e7h,a8h,37h,88h,f3h
+			db	a7h,57h,05h,5eh,87h,f5h,d2h,b5h
+			db	4dh,5bh
+			and	d
+			ex	(sp),hl
+			adc	a,a
+			ld	d,c
+			ld	b,c
+			dec	de
+			ld	sp,e4c6h
+			sbc	a,b
+			cp	c
+			ld	d,a
+			ex	af,af'
+			call	nz,L62fe
+			sbc	a,b
+			ld	(de),a
+			ccf
+			inc	l
+			add	a,b
+			add	a,c
+			ld	a,c
+			ret	nc
+			and	c
+			inc	a
+			ld	hl,(5408h)
+			add	a,e3h
+			rlca
+			sub	c
+			sub	93h
+			sub	c
+			xor	e
+			add	a,c3h
+			ex	de,hl
+			add	hl,hl
+			xor	b
+			ret	m
+			ex	de,hl
+			ld	d,0ah
+			add	a,a
+			pop	af
+			xor	a
+			inc	h
+			ld	a,d
+			or	c
+			ld	l,c
+			ld	a,h
+			add	hl,hl
+			ld	a,d
+			and	c
+			ld	a,b
+			sub	b
+			sub	d
+			ld	d,e
+			ld	h,25h
+			add	hl,hl
+			sub	a
+			ld	hl,ec56h
+			ld	c,e
+			ld	e,e
+			ld	d,e
+			ld	c,beh
+			ld	b,a
+			or	(hl)
+			djnz	L60ba
+			add	a,e
+			sbc	a,c
+			adc	a,a
+			adc	a,c
+			sbc	a,a
+			ld	(hl),34h
+			ld	b,a
+			add	a,e
+			and	h
+			ld	(5818h),a
+			xor	(hl)
+			ld	l,(hl)
+			ld	h,95h
+			ld	h,e
+			ret	p
+			ret
+			db	e1h,d0h,58h,7eh,5dh,e7h,a5h,33h
+			db	e6h,61h,39h,eeh,98h,05h,9eh,e8h
+			db	fbh,b3h,65h,c6h,45h,b2h,bdh,2bh
+			db	bdh,c8h,d6h,1dh,81h,bfh,03h,7ah
+			db	28h,f2h,a1h,76h,3fh,87h,aeh,0ah
+			db	5eh,75h,12h,bah,a2h,a6h,26h,5ch
+			db	8eh
+			sbc	a,l
+			and	62h
+			nop (2x) *
+			ccf
+			ld	a,(9881h)
+			inc	l
+			ld	e,a
+			ld	l,e
+			cp	b
+			call	p,L4272
+			add	a,e
+			ld	(bc),a
+			sub	e
+			call	c,L12f9
+			call	p,L2792
+			jp	p,Lfb9a
+			djnz	L60c6
+			rst	38h
+			jp	(hl)
+			db	2eh,36h,94h,91h,0eh,3fh,5ch,f8h
+			db	fah,6dh,9eh,9bh,a9h,7dh,63h,f3h
+			ld	h,b
+			xor	a
+			ld	e,a
+			ld	(hl),c
+			call	z,L7172
+			sbc	a,b
+			ld	l,h
+			ld	a,e
+			add	a,d
+			xor	d
+			cp	d0h
+			cp	l
+			adc	a,e
+			ld	b,7bh
+			ld	l,a
+			adc	a,15h
+			inc	a
+			ld	d,(hl)
+			sub	c
+			ret	po
+			cp	a
+			dec	(hl)
+			sub	h
+			ld	(hl),deh
+			ld	(hl),b
+			add	a,a
+			ld	l,b
+			cp	50h
+			ld	e,d
+			or	l
+			add	hl,sp
+			ld	b,e
+			ld	l,c
+			ld	h,c
+			add	a,c
+			inc	a
+			ld	de,900bh
+			rlca
+			or	l
+			call	p,Lbf05
+			xor	h
+			add	a,h
+			ld	l,(hl)
+			jp	nc,Lcbef
+			rrca
+			ret	p
+			cp	b
+			set	6,b
+			ld	b,e
+			sbc	a,(hl)
+			push	bc
+			dec	sp
+			rst	38h
+			sub	(hl)
+			call	z,L3e1f
+			ret	z
+			djnz	L60e9
+			jp	L88cb
+			db	f9h,c2h,22h,50h,9ch,00h,54h,8eh
+			db	7ch,29h,bdh,1fh,6ch,1ah,f7h,46h
+			db	deh,17h,f5h,48h,e1h,e5h,45h,fbh
+			db	9bh,c3h,1fh,92h,7dh,f2h,deh,15h
+			db	64h,52h,91h,b9h,c2h,49h,f8h,44h
+			db	8eh,a7h,a7h,5ah,1eh,0fh,cfh,d8h
+			db	f7h,39h,2eh,8bh,94h,98h,5eh,98h
+			db	c6h,f6h,5ch,6eh,fch,5ah,dch,c9h
+			db	b4h,d8h,80h,f1h,d3h,1ch,ebh,78h
+			db	21h,e7h,55h,b0h,83h,07h,2ah,5dh
+			db	4ch,64h,c3h,a0h,54h,d7h,b0h,57h
+			db	efh,4bh,c2h,19h
+			jp	(hl)
+			db	cdh,f9h,10h,92h,95h,73h,f2h,c3h
+			db	7bh,b8h,19h,95h,f4h,09h,58h,fdh
+			db	5dh,21h,02h,89h,55h,53h,77h,d4h
+			db	04h,7ah,cch,54h,1dh,60h,d6h,70h
+			db	9ah,d1h,fch,18h,51h,bbh,19h,66h
+			db	86h,b1h,11h,bah,c0h,b0h,74h,6dh
+			db	59h,dch,57h,2ah,0dh,5eh,c2h,5ch
+			db	f3h,80h,f4h,e7h,01h,03h,dch,a5h
+			db	25h,03h,d3h,46h,dch,b3h,64h,56h
+			db	74h,32h,43h,c0h,d7h,c0h,c0h,7bh
+			db	96h,3ah,eeh,e5h,f4h,14h,adh,27h
+			db	dch,01h,1fh,94h,d4h,77h,3eh,cfh
+			db	09h,70h,deh,0eh,e8h,e1h,8bh,6bh
+			db	eeh,b9h,ach,f7h,deh,98h,92h,1fh
+			inc	(hl)
+			inc	b
+			sbc	a,h
+			jp	m,Lde37
+			ld	(hl),cch
+			inc	hl
+			ld	(hl),a
+			sub	c
+			jr	nz,L6203
+			or	01h
+			jp	m,L7a6f
+			sbc	a,h
+			sub	a
+			ld	a,(de)
+			sbc	a,(hl)
+			ld	a,b
+			ld	h,c
+			cp	c
+			ld	l,l
+			ld	a,e
+			ld	b,b
+			call	m,Lac82
+			ld	(hl),l
+			inc	sp
+			ld	a,(hl)
+			nop
+			ex	de,hl
+			adc	a,l
+			ld	(hl),a
+			ld	a,d8h
+			ld	h,a
+			ld	(hl),e
+			dec	bc
+			call	Lf660
+			or	b1h
+			daa
+			adc	a,l
+			ld	a,d
+			ld	b,b
+			ld	e,d
+			cp	a
+			call	p,L6aaf
+			dec	c
+			ld	(hl),l
+			di
+			dec	e
+			ld	h,c
+			ld	h,94h
+			ld	de,6bb4h
+			or	6eh
+			ld	c,l
+			cp	l
+			and	(hl)
+			ld	d,h
+			add	a,e
+			and	(hl)
+			add	a,b
+			ld	b,a
+			ld	b,h
+			ret	nc
+			ld	bc,2876h
+			adc	a,b
+			ld	(bc),a
+			and	a
+			add	a,bdh
+			jp	pe,L6ec4
+			dec	a
+			dec	sp
+			ccf
+			call	po,L57e7
+			ld	h,(hl)
+			rst	08h
+			ld	de,d506h
+			ld	b,c
+			ld	hl,(5b68h)
+			sbc	a,d
+			ld	a,(17d1h)
+			add	hl,sp
+			ld	a,l
+			ret	po
+			exx
+			and	l
+			ld	(bc),a
+			ld	l,e
+			ld	(hl),b
+			ld	d,84h
+			ld	c,b
+			pop	de
+			add	a,h
+			adc	a,a
+			ld	h,(hl)
+			sbc	a,c
+			ld	d,a
+			ld	(hl),l
+			cp	c
+			sub	c
+			pop	hl
+			add	hl,bc
+			dec	a
+			jp	p,L5473
+			or	(hl)
+			nop
+			ld	l,h
+			ld	h,a
+			inc	d
+			adc	a,(hl)
+			and	a3h
+			inc	hl
+			ld	b,(hl)
+			xor	b
+			ld	c,d1h
+			pop	hl
+			ld	h,l
+			ld	(hl),c
+			adc	a,h
+			and	c
+			dec	c
+			ld	e,dah
+			sub	(hl)
+			ld	(bc),a
+			dec	(hl)
+			ld	(hl),b
+			add	hl,bc
+			ld	a,(bc)
+			ld	(hl),a
+			rst	28h
+			ld	e,l
+			or	h
+			sbc	a,e
+			cp	l
+			xor	(hl)
+			add	a,(hl)
+			ld	h,b
+			rrca
+			xor	d
+			adc	a,41h
+			di
+			pop	de
+			ld	(bc),a
+			ld	sp,c381h
+			xor	l
+			ld	a,d
+			ld	e,d
+			sub	a
+			call	nz,L8e5a
+			ld	a,(hl)
+			push	de
+			ld	hl,(a789h)
+			ld	a,a
+			jr	L6257
+			db	deh,a3h,adh,e6h,24h,b4h,16h,96h
+			db	40h,b6h,dch,afh,28h,c5h,80h,3dh
+			db	70h,d9h,61h,3fh,d0h,a3h,2fh,f5h
+			db	c0h,fah,afh,48h,70h,49h,4ah,99h
+			db	15h,a3h,feh,cdh,e3h,65h,0fh,86h
+			db	aah,b7h,1eh,ach,1eh,4bh,58h,1bh
+			db	13h,d7h,17h,83h,96h,34h,85h
+			ex	de,hl
+			out	(65h),a
+			ld	a,e
+			rst	10h
+			call	Lf641
+			ld	b,a
+			push	af
+			in	a,(39h)
+			ld	c,h
+			or	b
+			adc	a,(hl)
+			ld	a,14h
+			ret	c
+			ld	hl,97f1h
+			add	a,e
+			and	1bh
+			jp	po,L4763
+			ld	h,l
+			adc	a,e
+			ld	d,d
+			sbc	a,(hl)
+			sub	b
+			ld	l,l
+			add	a,h
+			or	b
+			ld	l,a
+			or	e
+			sbc	a,e
+			sbc	a,(hl)
+			and	a
+			ld	l,(hl)
+			sbc	a,(hl)
+			ld	e,d
+			pop	de
+			and	e
+			ld	d,(hl)
+			ld	l,e
+			ld	e,d
+			cp	e
+			dec	de
+			adc	a,h
+			ld	h,e
+			add	a,h
+			ld	b,c
+			ld	d,l
+			jp	c,Lfd3b
+			inc	(hl)
+			ld	sp,hl
+			sub	l
+			xor	e
+			ld	c,b
+			inc	h
+			ld	b,(hl)
+			ld	hl,(2cceh)
+			ld	d,(hl)
+			jp	m,L62c4
+			sub	a
+			call	z,Lc8a3
+			xor	e
+			rst	20h
+			rla
+			rrca
+			ld	b,(hl)
+			inc	d
+			sbc	a,l
+			adc	a,(hl)
+			scf
+			ld	h,h
+			call	c,Lb23f
+			ld	bc,e8c3h
+			ld	h,e
+			rrca
+			ld	l,b
+			sbc	a,c
+			cpl
+			dec	sp
+			jr	nz,L6390
+			exx
+			ret	p
+			ld	a,(de)
+			inc	bc
+			inc	a
+			ld	(e882h),hl
+			jr	L63e5
+			db	76h,16h,24h,fdh,1bh,dch,81h,9ah
+			db	bbh,3bh,d7h,ddh,00h,24h,32h,16h
+			db	34h,6eh,f6h,dbh,a2h,aeh,11h,5bh
+			db	a3h,e6h,e3h,b1h,ddh,91h,afh,ffh
+			db	beh,52h,1eh,cdh
+			ld	b,d
+			or	c
+			ld	d,cah
+			ld	e,e
+			adc	a,h
+			sbc	a,e
+			add	a,l
+			inc	a
+			or	c
+			nop
+			cp	c
+			xor	(hl)
+			jp	p,L2096
+			ld	(iy + a3h),b
+			call	L7552
+			ld	e,f2h
+			nop (2x) *
+			inc	b
+			rst	00h
+			ld	b,b
+			ld	b,c
+			sub	(hl)
+			xor	(hl)
+			sbc	a,a
+			ld	c,a
+			sbc	a,c
+			sbc	a,c
+			jr	nz,L6406
+			ld	c,(hl)
+			inc	bc
+			rst	38h
+			xor	c
+			sub	d
+			dec	sp
+			ld	b,a
+			ld	l,h
+			ld	(hl),h
+			ld	a,c
+			adc	a,(hl)
+			cp	ebh
+			adc	a,a
+			jp	pe,Lb83f
+			ld	d,l
+			ld	(632ah),a
+			ld	(hl),d
+			ld	l,47h
+			ld	a,f9h
+			pop	hl
+			xor	e4h
+			adc	a,(hl)
+			inc	hl
+			and	l
+			ld	(hl),d
+			ret	po
+			dec	bc
+			inc	a
+			sbc	a,a
+			ld	b,c
+			ld	e,c
+			ld	(de),a
+			inc	a
+			ld	b,a
+			scf
+			ld	a,(de)
+			ld	a,f3h
+			ld	c,h
+			inc	b
+			cpl
+			pop	hl
+			or	d0h
+			scf
+			cp	l
+			ld	a,(hl)
+			ld	d,e
+			rst	20h
+			rra
+			call	c,L1242
+			jp	m,L9bda
+			add	a,d
+			or	c
+			jp	(hl)
+			db	f3h,03h,a3h,b3h,b6h,31h,03h,a3h
+			db	86h,fch,3eh,1eh,7ch,59h
+			rlc	d
+			add	a,e
+			jp	L7934
+			db	fah,0fh,d8h,1ch,9bh,dah,88h,57h
+			db	89h,5ch,78h,47h,cdh,12h,3bh,ebh
+			db	3fh,4ah,edh,4dh,60h,2ch,19h,88h
+			db	dfh,7eh,9ah,7bh,c2h,1fh,5eh,e1h
+			db	b5h,43h,8ch,92h,10h,86h,cfh,53h
+			db	41h,f5h,f8h,39h,25h,1dh,71h,41h
+			db	2bh,62h,71h
+			ld	c,c
+			ld	l,e
+			ld	b,b
+			sub	5dh
+			or	a
+			sbc	a,a
+			ld	h,c
+			and	(hl)
+			ex	de,hl
+			call	p,L746c
+			sub	8bh
+			ld	l,eeh
+			rst	20h
+			or	e
+			add	a,d
+			dec	d
+			and	h
+			ld	d,9fh
+			add	hl,hl
+			ld	bc,8422h
+			adc	a,a
+			ld	(ix + 7eh),b
+			ret	m
+			ld	h,h
+			ret	z
+			or	(hl)
+			adc	a,77h
+			inc	bc
+			ld	(hl),l
+			ret	pe
+			ld	b,e
+			out	(d4h),a
+			ld	e,0ah
+			inc	a
+			ld	a,l
+			halt
+			sbc	a,h
+			ld	b,d
+			ld	b,c
+			ld	a,9ah
+			ld	a,c
+			call	nz,Lc754
+			ld	e,a
+			rst	28h
+			ld	l,h
+			ld	(hl),h
+			ld	h,41h
+			ld	b,e
+			ld	(hl),l
+			sbc	a,l
+			ld	a,c
+			dec	(hl)
+			dec	d
+			sbc	a,h
+			ld	h,c
+			and	b
+			ld	b,(hl)
+			call	m,L1088
+			or	b
+			ld	l,a
+			ld	(hl),h
+			rst	00h
+			ret	c
+			ld	(hl),a
+			ex	de,hl
+			out	(e4h),a
+			or	c2h
+			inc	l
+			ld	a,(bc)
+			call	nz,L1d31
+			inc	sp
+			ld	h,e
+			ld	c,(hl)
+			pop	af
+			ld	a,(ebdbh)
+			ld	h,b
+			call	m,L4fd7
+			ei
+			ret	nc
+			ld	l,h
+			pop	de
+			ret	c
+			ld	b,1bh
+			cp	c
+			ld	c,l
+			ld	de,0a24h
+			xor	e
+			sub	b
+			ld	h,c
+			pop	af
+			jp	p,L03e3
+			cp	c
+			ld	b,l
+			ld	b,e
+			ret	pe
+			and	b
+			sub	l
+			xor	b
+			or	15h
+			rlca
+			ld	b,(hl)
+			call	m,L7667
+			or	c
+			and	eeh
+			jp	pe,L001e
+			ccf
+			sbc	a,e
+			jr	nz,L649e
+			rst	38h
+			ld	d,l
+			ld	de,a06fh
+			ld	(hl),b
+			ld	e,(hl)
+			push	bc
+			ld	(hl),a
+			or	l
+			adc	a,d
+			push	af
+			ld	(d08dh),a
+			ld	a,(hl)
+			dec	c
+			ld	h,(hl)
+			ld	(bc),a
+			jp	z,L2602
+			or	e
+			out	(07h),a
+			ld	e,(hl)
+			or	e
+			ld	(hl),e
+			ld	c,e
+			ld	a,(bc)
+			ld	c,a
+			and	b
+			ld	e,8eh
+			ld	c,43h
+			ld	(21f4h),hl
+			dec	e
+			ld	b,l
+			jp	c,L07ec
+			ld	a,(5435h)
+			halt
+			ld	b,a
+			ld	b,d
+			dec	a
+			ret	p
+			xor	h
+			ld	h,83h
+			jp	(hl)
+			db	b4h,d4h,74h,c1h,92h,fah,f4h,d1h
+			db	82h,11h,feh,0eh,bch,85h,1fh,4eh
+			db	52h,39h,23h,bah,fbh,07h,cah,08h
+			db	8ch,48h,4bh,52h,56h,e9h,11h,f4h
+			db	a7h,95h,24h,23h,feh,5fh,0eh,c2h
+			db	1fh,e1h,d2h,04h,92h,2dh,54h,1eh
+			db	d0h,45h,c3h,7ch,aah,a1h,8dh,53h
+			db	08h,30h,99h,0ah,f4h,17h,33h,f9h
+			db	17h,03h,63h,7ah,dah,f8h,8ah,c4h
+			db	46h,6ch,69h,e5h,1ah,f4h,d3h,0ch
+			db	77h,a0h,64h,d4h,b5h,0ch,d2h,2ah
+			db	abh,5ah,14h,eeh,8dh,07h,b0h,19h
+			db	17h,37h,8dh,12h,f2h,a1h,51h,cdh
+			db	a1h,3bh,71h,b0h,81h,cch,ceh,50h
+			db	c4h,20h,4bh,49h,33h,95h,6bh,a4h
+			db	1ah,e9h,9eh,fch,eah,e0h,eeh,2ah
+			db	40h,61h,71h,39h,5bh,54h,18h,c6h
+			db	c2h,92h,afh,b4h,59h,b8h,cfh,22h
+			db	93h,a4h,d7h,bdh,b8h,cbh,c6h,85h
+			db	cfh,3dh,beh,ddh,08h,8dh,36h,6fh
+			db	45h,8eh,cfh,7bh,f0h,4ch,74h,4eh
+			db	47h,ceh,5bh,f8h,69h,92h,ddh,78h
+			db	1fh,b2h,d2h,afh,d7h,87h,69h,d7h
+			db	b5h,83h,57h,9ah,68h,4dh,12h,74h
+			db	41h,75h,16h,7bh,b5h,61h,aah,4eh
+			db	91h,09h,bfh,eah,52h,e6h,a1h,13h
+			ret	pe
+			xor	a
+			jp	(hl)
+			db	01h,92h,25h,73h,c2h,7ch,bch,5ch
+			db	e1h,69h,f1h,b4h,16h,eah,73h,feh
+			db	a1h,56h,d7h,1dh,31h
+			rst	00h
+			jr	c,L65da
+			ld	a,(de)
+			call	nc,Lf1f6
+			ld	a,h
+			ret	pe
+			cp	c2h
+			ld	hl,(346ch)
+			ld	sp,859bh
+			dec	c
+			inc	b
+			inc	e
+			add	a,39h
+			add	a,(hl)
+			rst	30h
+			sbc	a,b
+			jp	L42f2
+			db	05h,c4h,78h,0ah,67h,b8h,ach,9dh
+			db	beh,d8h,a1h,bdh,44h,2ch,9ah,28h
+			db	d9h,eeh,59h,9dh,c4h,70h,83h,0bh
+			db	0eh,a3h,a1h,17h,39h,b3h,a6h,23h
+			db	b0h,5bh,67h,e6h,a9h,9bh,dah,4fh
+			db	c5h,65h,0fh,67h,8ah,20h,7fh,70h
+			db	9dh,3eh,b0h,8ch,dch,63h,36h,14h
+			db	b2h,54h,29h,b0h,70h,b0h,a9h,97h
+			db	7ah,61h,61h,97h,c0h,46h,75h,b2h
+			db	89h,a3h,a1h,96h,adh,f4h,67h,d8h
+			db	97h,5eh,ech,b5h,13h,b5h,bah,a1h
+			db	15h,0ch,3fh,a7h,d6h,aah,e7h,b1h
+			db	80h,97h,40h,54h,47h,bbh,9dh,8ch
+			db	e3h,93h,e9h,5ah,b8h,18h,87h,b2h
+			db	b6h,66h,63h,49h,03h,c6h,adh,3ch
+			db	deh,cfh,28h,28h,bdh,6bh,cdh,60h
+			db	55h,8dh,f4h,5ch,3ch,afh,1bh,efh
+			db	0ah,aah,66h,dch,cfh,13h,26h,d6h
+			db	5dh,20h,9bh,bah,fbh,dah,f5h,c7h
+			db	fdh,91h,70h,65h,19h,1ah,48h,d9h
+			db	f2h,6eh,16h,4fh,e8h,53h,3ah,77h
+			db	a3h,adh
+			inc	hl
+			ld	d,f5h
+			push	de
+			ld	(hl),e
+			dec	sp
+			di
+			dec	hl
+			sub	e
+			ld	h,e
+			cp	a
+			scf
+			exx
+			ld	d,d
+			sbc	a,c8h
+			call	po,Le316
+			add	a,h
+			ex	de,hl
+			cp	e
+			dec	sp
+			ld	l,a
+			ld	a,(bc)
+			xor	d
+			jp	(hl)
+			db	a6h,fdh,06h,ech,77h,fah,f4h,c2h
+			db	a5h,6fh,bfh,20h,ffh,cah,a5h,dch
+			db	e3h,efh,f3h,ffh,a0h,f3h,57h,e3h
+			db	35h,f7h,d6h,f1h,3bh,0ch,3bh,abh
+			db	38h,95h,6ch,edh,d7h,9fh,44h,e7h
+			db	e7h,e8h,fah,dbh,c3h,07h,c0h,f4h
+			db	29h,dch,3dh,27h,27h,40h,31h,16h
+			db	dah,3eh,94h,77h,9dh,7eh,5bh,79h
+			db	36h,8fh,d7h,1fh,fah,a9h,c8h,b0h
+			db	16h,69h,46h,f5h,38h,74h,4ch,90h
+			db	6bh
+			add	a,a
+			ld	c,85h
+			ld	a,d
+			xor	d
+			sub	c
+			cp	f5h
+			ld	h,(hl)
+			ld	c,(hl)
+			ld	d,e
+			add	hl,sp
+			add	a,d
+			jp	Lfdc0
+			db	95h,7eh,f3h,16h,07h,43h,c3h,55h
+			db	7bh,25h,82h,9bh,ebh,5ah,4ch,bch
+			db	7ah,5bh,5fh,a8h,a6h,58h,5ah
+			xor	l
+			ld	a,(bc)
+			xor	77h
+			ret	p
+			or	a
+			and	c
+			or	c
+			ld	h,e
+			ld	l,62h
+			cp	b
+			sub	b
+			ld	a,(hl)
+			nop (2x) *
+			ld	e,e
+			ld	sp,hl
+			jp	nz,L4bd9
+			di
+			ld	(bc),a
+			jr	nz,L67da
+			ld	l,l
+			ld	(hl),5ch
+			or	h
+			add	a,d
+			add	a,e
+			add	a,b
+			cp	l
+			rst	00h
+			ld	l,d
+			ld	h,c
+			or	h
+			jp	po,Lcdc4
+			ex	af,af'
+			ld	d,d
+			rst	00h
+			add	hl,de
+			adc	a,e
+			ld	a,a
+			jp	L8040
+			db	43h
+			push	de
+			djnz	L67a8
+			ex	af,af'
+			ld	bc,04b1h
+			ld	(55c2h),hl
+			call	p,L7ca1
+			ld	a,b
+			ld	l,c
+			sub	d
+			ld	a,b
+			cp	9dh
+			jp	nc,Lbd88
+			add	a,l
+			ld	de,dbcah
+			ld	de,7e83h
+			ld	c,e
+			cp	b
+			ld	d,l
+			ret	c
+			dec	sp
+			sbc	a,e
+			ld	bc,391ch
+			ld	h,c
+			cp	(hl)
+			call	c,L5012
+			sub	e
+			ex	de,hl
+			rst	00h
+			jr	c,L67a0
+			jr	L6765
+			db	ach,10h,5bh,a9h,51h,37h,40h,14h
+			db	a6h,6dh,bah,8fh,2dh,18h,6fh,36h
+			db	ach,1fh,03h,34h,cbh,d2h,b6h,39h
+			db	feh,88h,adh,a9h,a4h,6ah,02h
+			rra
+			ret	nz
+			ld	h,h
+			jr	nz,L6817
+			push	bc
+			or	c
+			rst	18h
+			and	c
+			ld	c,7ah
+			cp	a
+			ld	h,b
+			jp	nz,Ld5bc
+			cp	06h
+			ld	d,d
+			or	d
+			or	a
+			add	a,h
+			and	2bh
+			add	a,e
+			sub	d
+			ld	d,(hl)
+			dec	h
+			add	hl,bc
+			add	a,l
+			add	a,b
+			jr	c,L67a1
+			add	a,b
+			ld	a,(de)
+			jp	L1fdf
+			db	92h,ebh,04h,3fh,44h,edh,65h,c3h
+			db	33h,8fh,72h,72h,d2h,74h,62h,55h
+			db	18h,cfh,54h,c4h,c9h,78h
+			ld	d,b
+			sbc	a,a
+			sbc	a,(hl)
+			ld	d,b
+			add	hl,sp
+			ld	l,b3h
+			cp	h
+			ld	(hl),c
+			ret	p
+			xor	03h
+			xor	(hl)
+			cp	l
+			add	a,d
+			xor	c
+			and	e
+			ld	sp,hl
+			or	c
+			ld	b,h
+			and	h
+			and	a
+			ld	l,c
+			rra
+			xor	(hl)
+			ld	(de),a
+			ld	l,h
+			add	a,(hl)
+			adc	a,d
+			sub	e
+			di
+			ld	c,d
+			ret	p
+			ld	l,b
+			rst	08h
+			daa
+			add	a,b
+			xor	57h
+			and	b
+			ccf
+			ld	sp,9513h
+			dec	h
+			ld	b,l
+			ret	po
+			ld	b,d
+			call	po,La22b
+			and	b
+			sbc	a,b
+			add	a,(hl)
+			and	e
+			exx
+			pop	af
+			ld	l,a
+			jp	pe,L6af6
+			ld	(hl),12h
+			nop (2x) *
+			ld	sp,f775h
+			ld	a,e
+			ld	d,l
+			ld	(hl),b
+			ld	b,(hl)
+			jp	p,La3bd
+			add	a,b
+			inc	h
+			xor	c6h
+			dec	b
+			sbc	a,e
+			jp	po,L9e01
+			ld	e,b
+			ld	e,c
+			rst	38h
+			ld	a,e
+			ld	l,l
+			sbc	a,h
+			inc	de
+			ld	de,58c0h
+			ld	e,b
+			ld	a,(de)
+			ld	a,h
+			ld	(353dh),a
+			ld	e,c
+			ld	e,a
+			ret	p
+			add	a,e
+			ld	h,h
+			ld	d,dbh
+			add	hl,de
+			ld	l,d
+			and	a
+			jp	(hl)
+			db	3fh,72h,9ch,80h,ech,7dh,7fh,8fh
+			db	29h,cbh,6ch,82h,a5h,f6h,51h,8dh
+			db	66h,e6h,93h,28h,f9h,16h,7ah,25h
+			db	deh,05h,07h,4bh,f6h,b5h,1eh,58h
+			db	c8h
+			sbc	a,e
+			call	pe,L17e4
+			add	a,d4h
+			inc	e
+			ld	(hl),bfh
+			ret	nc
+			ld	e,d
+			rra
+			sub	e
+			jp	nz,L1df9
+			ld	d,b
+			call	z,L9816
+			ret
+			db	81h,1bh,80h,eeh,9eh,2bh,d2h,8fh
+			db	44h,afh,bfh,80h,adh,d9h,76h,00h
+			db	0ah,abh,c0h,00h,61h,0dh,bfh,54h
+			db	53h,80h,7dh,0ch,06h,66h,80h,61h
+			db	81h
+			ld	a,e
+			cp	e6h
+			dec	de
+			ld	a,(hl)
+			and	0dh
+			inc	bc
+			jp	L23a4
+			db	6bh,5dh,dch,c3h,51h,5ch,9eh,60h
+			db	a9h,a0h,deh,80h,a5h,1bh,fbh,09h
+			db	f6h,37h,28h,55h,15h,90h,93h,a2h
+			db	19h,40h,0ch,3dh,bch,4fh,7dh,92h
+			db	b4h,63h,f1h,7eh,1bh,7bh,4bh,61h
+			db	afh,cbh,20h,b9h,dbh,64h,56h,66h
+			db	57h,9bh,cdh,20h,73h,23h,24h,67h
+			db	efh,6dh,dbh,dch,88h,a3h,12h,b8h
+			db	37h,fbh,74h,ddh,a6h,e4h,81h,feh
+			db	e2h,d2h,90h,6ah,f7h,d3h,c2h,edh
+			db	06h,c1h,7ch,76h,3fh,dbh,b4h,1ch
+			db	cbh,8ch,ceh,11h,8dh,dfh,c1h,36h
+			db	8bh,eah,6eh,8ah,abh,87h,69h,f7h
+			db	0fh,fbh,28h,22h
+			cp	b
+			inc	bc
+			ld	d,h
+			ld	h,c
+			and	b
+			call	z,L34cf
+			ld	e,d
+			ld	(bc),a
+			push	hl
+			xor	a
+			ld	e,h
+			and	h
+			ld	l,b
+			jr	z,L69c7
+			add	a,b
+			pop	bc
+			ld	hl,(2844h)
+			xor	a
+			call	L0344
+			or	a
+			jr	L699a
+			db	f8h,74h,fch,0ah,b9h,01h,bah,76h
+			db	5bh,66h,5ah,c8h,a3h,4ch,20h,60h
+			db	c2h,56h,66h,8dh
+			rrca
+			ld	c,a
+			push	de
+			xor	b
+			bit	6,d
+			or	d
+			cp	a
+			ret	po
+			dec	bc
+			rrca
+			add	a,b
+			scf
+			rra
+			ld	e,b
+			dec	sp
+			or	h
+			cp	l
+			rst	08h
+			ld	d,b
+			ld	c,a
+			add	a,(hl)
+			rst	38h
+			ccf
+			ld	l,(hl)
+			ld	b,(hl)
+			rrca
+			scf
+			call	m,L4d65
+			cp	(hl)
+			and	b
+			call	pe,L97df
+			ex	(sp),hl
+			ld	(hl),f7h
+			rla
+			or	l
+			xor	e
+			dec	sp
+			or	b
+			inc	e
+			ld	a,(c468h)
+			call	pe,L9b33
+			ld	l,b
+			or	(hl)
+			add	a,e
+			daa
+			add	hl,de
+			inc	de
+			ld	h,e2h
+			ld	a,(add8h)
+			ld	(hl),h
+			pop	af
+			ld	a,h
+			rst	18h
+			add	a,h
+			call	nz,L00cb
+			ret	pe
+			nop (2x) *
+			nop
+			ld	hl,f068h
+			jr	L6a36
+			db	1ah,b1h,1dh
+			cp	d
+			inc	(hl)
+			rla
+			ld	d,d
+			ld	(hl),l
+			push	hl
+			jp	nc,L3f2f
+			ld	h,e
+			ld	c,b
+			ld	b,(hl)
+			adc	a,l
+			nop (2x) *
+			ld	d,a
+			ld	h,09h
+			sub	c
+			ld	b,l
+			inc	sp
+			and	h
+			ld	(13a1h),hl
+			rst	28h
+			add	a,d
+			xor	a
+			sub	c
+			jr	c,L69fb
+			call	p,L29b5
+			ld	l,h
+			xor	e
+			ret	c
+			adc	a,c
+			add	a,(hl)
+			xor	h
+			xor	e
+			ld	hl,(2fa1h)
+			in	a,(e1h)
+			jr	c,L69f3
+			ld	(hl),e
+			ld	c,b
+			ld	c,c
+			ld	(bc),a
+			and	h
+			and	d
+			ld	c,l
+			ld	a,l
+			rst	38h
+			ld	d,b
+			inc	de
+			jp	(hl)
+			db	bdh,f8h,f3h,30h,56h,04h,4ch,afh
+			db	bah,30h,a6h,4dh,4bh,b8h,bbh,06h
+			db	afh,c2h,6eh,41h,4bh,4eh,a7h,52h
+			db	78h,ech,72h,81h,f7h,05h,bbh,8eh
+			db	15h,85h,61h,58h,a5h,5dh,a9h,76h
+			db	c6h,d0h,69h,63h,81h,ach,dch,10h
+			db	36h,a5h,8ch,16h
+			ld	(hl),c
+			add	a,h
+			jp	z,Lc526
+			ret	z
+			inc	c
+			ld	l,(hl)
+			ld	h,d7h
+			adc	a,a8h
+			rst	38h
+			jp	L5be1
+			db	27h,2bh,75h,8ah,46h,67h,9fh,1ah
+			db	29h,02h,b4h,4bh,c3h,d1h,9ch,7bh
+			db	efh
+			rrca
+			rst	10h
+			ld	h,h
+			and	c
+			ld	de,42eah
+			jp	p,L66b8
+			inc	e
+			push	de
+			ld	a,l
+			jr	nc,L69f9
+			ld	b,l
+			nop
+			call	po,Ldcb9
+			ld	a,e
+			adc	a,a
+			ld	a,l
+			ld	d,b
+			ld	h,l
+			scf
+			ret	p
+			ld	h,c
+			ld	b,l
+			cp	1ah
+			ld	d,(hl)
+			ret	m
+			add	a,c
+			and	(hl)
+			ld	c,a
+			jp	pe,L7b3e
+			sub	d
+			add	hl,bc
+			sub	h
+			ld	a,(de)
+			ld	h,h
+			push	bc
+			rst	30h
+			cp	e
+			jp	p,Ldd4b
+			ld	h,h
+			ld	bc,8402h
+			call	p,L7496
+			ld	a,a
+			ld	a,b
+			rst	00h
+			sbc	a,b
+			sub	d3h
+			ld	(hl),a
+			adc	a,l
+			ld	sp,hl
+			ld	e,c
+			in	a,(45h)
+			ld	l,b
+			and	c
+			ld	(hl),e
+			ex	(sp),hl
+			cp	h
+			adc	a,d
+			ld	c,e
+			ld	e,d
+			ld	b,(hl)
+			cp	d
+			or	l
+			ret	z
+			ex	af,af'
+			ld	sp,5a82h
+			exx
+			dec	a
+			ld	(hl),b
+			ld	de,af5ah
+			ld	(de),a
+			ld	b,a
+			jp	po,L7f84
+			add	a,d
+			ld	(hl),e
+			inc	bc
+			ld	a,a6h
+			ld	a,(8beeh)
+			sbc	a,e
+			dec	d
+			cp	b
+			ld	sp,hl
+			add	a,d
+			ld	b,d
+			ld	e,d
+			ld	sp,hl
+			adc	a,iyh *
+			ld	c,b
+			call	nz,L0aac
+			ld	d,c
+			ret	nz
+			ld	a,(bc)
+			ld	a,h
+			and	l
+			ld	l,d
+			rra
+			ld	d,l
+			and	a
+			xor	(hl)
+			adc	a,b
+			ld	de,f7beh
+			ld	e,d
+			add	hl,bc
+			ld	e,81h
+			xor	3dh
+			ld	bc,8f06h
+			ret	p
+			sbc	a,c
+			pop	hl
+			ld	e,c
+			or	13h
+			ld	c,c
+			rst	08h
+			ld	h,(hl)
+			dec	de
+			ld	d,(hl)
+			sub	a
+			cp	(hl)
+			cp	75h
+			ld	d,c
+			and	l
+			ld	hl,a68ch
+			add	hl,bc
+			jr	L6aa7
+			db	2dh,12h,77h,13h,fbh,abh,d2h,80h
+			db	40h,e0h,20h,deh,b3h,08h,0dh,8dh
+			db	b0h,d8h,08h,26h,27h,9bh,e1h,ddh
+			db	1ah,60h,3bh,ech,5fh,76h,30h,5dh
+			db	a9h,64h,6ah,b0h,8ah,c9h,5ch,18h
+			db	c6h,a9h,b5h,0eh,c2h,1bh,49h,a7h
+			db	d6h,c1h,63h,5dh,12h,44h,84h,8dh
+			db	3dh,b4h,b0h,24h,2dh,73h,edh,1eh
+			db	7dh,54h,d9h,6fh,0eh,0dh,14h,9eh
+			db	71h,aeh,b9h,53h,77h
+			adc	a,h
+			adc	a,26h
+			ld	l,(hl)
+			cp	b
+			ld	c,a
+			push	af
+			call	p,L1b70
+			call	pe,La935
+			adc	a,a
+			ld	d,h
+			ld	a,b
+			ld	c,c
+			xor	6fh
+			dec	hl
+			adc	a,h
+			sub	c
+			ld	c,h
+			call	z,L4cf6
+			ret	nz
+			ret	c
+			or	d
+			ld	a,l
+			ld	b,l
+			call	L4a70
+			ccf
+			scf
+			dec	d
+			or	d
+			ld	bc,1f13h
+			ld	e,fah
+			inc	bc
+			ld	(hl),d
+			and	e
+			ld	h,h
+			ld	c,b
+			sbc	a,l
+			ld	(hl),c
+			add	a,c
+			djnz	L6bb3
+			adc	a,d
+			xor	l
+			dec	d
+			ld	l,h
+			ld	a,(de)
+			ret	po
+			ret	pe
+			dec	de
+			ret	nc
+			pop	de
+			sbc	a,51h
+			ex	de,hl
+			ld	(de),a
+			sub	(hl)
+			ld	d,l
+			ld	c,c
+			and	e
+			sbc	a,l
+			rst	30h
+			call	z,L45f5
+			ld	b,e
+			sub	h
+			pop	de
+			in	a,(40h)
+			rst	20h
+			cp	(hl)
+			ret	p
+			or	d
+			pop	af
+			sbc	a,l
+			and	b0h
+			sub	d
+			ld	(hl),a
+			ld	e,(hl)
+			jp	z,L283f
+			rst	38h
+			rst	28h
+			nop (2x) *
+			sbc	a,(hl)
+			ld	e,d
+			xor	b
+			dec	sp
+			inc	e
+			sub	59h
+			and	(hl)
+			adc	a,d
+			dec	d
+			ld	a,(08dch)
+			jr	c,L6bd8
+			sbc	a,d
+			add	a,h
+			jp	po,Lbdb9
+			inc	d
+			add	a,d
+			ld	c,d
+			call	L9953
+			ld	b,h
+			rst	18h
+			inc	h
+			rst	10h
+			jp	nz,L3d05
+			add	a,c
+			sbc	a,l
+			jp	nz,Le545
+			ld	e,a
+			ld	b,a
+			pop	af
+			cp	e
+			ld	l,c
+			and	e
+			cp	(hl)
+			ld	c,c
+			and	(hl)
+			ld	a,(de)
+			inc	de
+			and	17h
+			ld	h,l
+			dec	l
+			or	h
+			ld	a,l
+			ret	p
+			sbc	a,b
+			ld	b,d
+			ld	sp,hl
+			adc	a,l
+			inc	de
+			jp	z,Lbf8c
+			add	a,c
+			call	c,Labab
+			ld	b,l
+			sub	a
+			nop (2x) *
+			ret	p
+			xor	a
+			cpl
+			dec	sp
+			add	a,e
+			dec	b
+			ld	a,(bc)
+			xor	l
+			call	L8e33
+			call	L7f3d
+			cp	(hl)
+			pop	de
+			ld	a,(b0c2h)
+			jp	(hl)
+			db	87h,aah,d9h,28h,7dh,33h,14h,52h
+			db	e4h,c4h,feh,b9h
+			sub	l
+			cp	d
+			ld	l,e
+			inc	a
+			ld	d,b
+			jp	pe,La607
+			jp	c,L6e91
+			ld	a,e
+			ld	h,b
+			cpl
+			adc	a,b
+			cp	d8h
+			ld	b,a
+			ld	b,a
+			dec	c
+			and	l
+			xor	fch
+			ld	d,l
+			add	a,d
+			add	hl,bc
+			scf
+			jp	(hl)
+			db	0ch,80h,1dh,0fh,19h,20h,b4h,aah
+			db	c0h,f0h,29h,c2h,77h,8bh,1fh,e1h
+			db	b6h,e4h,85h,eeh,f3h,06h,00h,aeh
+			db	10h,03h,53h,a1h,b8h,48h,75h,8dh
+			db	c8h,a8h,f8h,8eh,47h,5eh,0dh,8fh
+			db	3fh,fdh,a1h,1eh,64h,42h,30h,0ah
+			db	aeh,40h,35h,a7h,67h,5ch,cfh,d8h
+			db	08h,fbh,c8h,4fh
+			call	po,L9fad
+			sub	h
+			ld	c,e6h
+			adc	a,h
+			sub	7ah
+			ld	e,a
+			ld	c,(hl)
+			sub	a
+			cpl
+			ld	a,l
+			ld	h,h
+			push	de
+			ccf
+			dec	de
+			ld	d,a
+			ld	b,a
+			xor	h
+			sub	e
+			ld	(de),a
+			sbc	a,h
+			ld	a,c
+			sbc	a,l
+			and	a
+			ld	sp,hl
+			inc	h
+			ld	h,l
+			ld	c,c
+			add	a,81h
+			dec	sp
+			ei
+			ld	a,(de)
+			rrca
+			call	L4319
+			and	6dh
+			sub	d
+			rst	10h
+			jr	c,L6caf
+			rst	38h
+			call	Lde51
+			adc	a,c
+			jp	L6d57
+			db	03h,f9h,9bh,ddh,56h,8ch,e4h,97h
+			db	1ch,0dh,7ch,deh,78h,f2h,cah
+			ld	a,(bc)
+			add	a,eah
+			jp	pe,L31e3
+			ld	(de),a
+			sbc	a,e
+			ld	(hl),a8h
+			or	b
+			out	(05h),a
+			adc	a,ceh
+			add	hl,bc
+			dec	sp
+			jr	nc,L6c6a
+			and	a7h
+			ld	c,b
+			ld	a,c
+			ld	(hl),e
+			and	b
+			ld	l,e
+			ld	c,a
+			sub	h
+			ld	h,d
+			and	(hl)
+			and	e
+			pop	af
+			cp	c
+			ld	l,2ch
+			sbc	a,h
+			ld	l,d
+			dec	(hl)
+			sbc	a,e
+			rlca
+			cp	d
+			dec	c
+			ld	(hl),c
+			pop	hl
+			add	hl,sp
+			ld	c,a
+			call	z,L453b
+			xor	d
+			ld	l,l
+			ld	e,c
+			call	z,Lfca9
+			call	z,L6192
+			sub	c
+			and	d
+			inc	l
+			ex	af,af'
+			jr	L6d58
+			db	d5h,99h,6ah,3eh
+			cp	(hl)
+			jp	z,L03e9
+			rrca
+			push	hl
+			rrca
+			ld	e,e
+			xor	a
+			sbc	a,c
+			ld	e,a
+			in	a,(beh)
+			pop	de
+			dec	bc
+			adc	a,c
+			cp	d
+			cp	(hl)
+			cp	d
+			ld	b,(hl)
+			dec	bc
+			dec	e
+			nop (2x) *
+			or	a
+			sub	l
+			cp	e
+			ld	e,h
+			ei
+			sub	h
+			ld	e,l
+			ld	(de),a
+			pop	de
+			dec	h
+			daa
+			sub	b
+			ld	h,d
+			ld	e,b
+			cp	b
+			sbc	a,07h
+			and	(hl)
+			call	nc,L020f
+			and	a
+			pop	de
+			ld	c,e
+			ld	h,h
+			cp	c
+			jr	L6cf3
+			db	50h,7bh,39h,89h,59h,76h,4eh,b9h
+			db	d2h,b9h,8bh,59h,b1h,a2h,7dh,a0h
+			db	8bh,1bh,7fh,21h,4eh,34h,35h,2eh
+			db	33h,fah,e4h,2bh
+			ld	(ffa8h),hl
+			ld	d,e
+			ld	b,a
+			add	a,01h
+			xor	e
+			ld	a,(f4d4h)
+			or	a
+			and	d5h
+			dec	hl
+			dec	l
+			ld	l,b
+			ret	p
+			xor	e
+			or	b
+			rla
+			ld	a,(bc)
+			ld	h,(hl)
+			rst	18h
+			ret	po
+			ld	e,e
+			and	(hl)
+			inc	bc
+			ld	e,c
+			or	d6h
+			rst	38h
+			ld	b,b
+			xor	(hl)
+			ld	(3118h),hl
+			xor	h
+			jr	nz,L6dbf
+			ld	l,e
+			ld	sp,hl
+			sbc	a,e
+			ld	d,(hl)
+			sub	c
+			push	af
+			ret	c
+			ld	(hl),b
+			call	c,La0b0
+			add	hl,hl
+			ld	a,e
+			ld	e,d
+			sbc	a,e8h
+			sbc	a,d6h
+			inc	b
+			ld	c,c
+			and	(hl)
+			cp	c
+			jp	pe,L16ca
+			sub	h
+			ld	c,h
+			rst	20h
+			jr	z,L6d24
+			ld	e,e
+			cp	h
+			adc	a,a
+			out	(cdh),a
+			nop
+			xor	7fh
+			ld	c,a
+			ld	d,h
+			cp	0ah
+			ld	d,e
+			add	a,(hl)
+			bit	5,h
+			dec	e
+			ld	(bc),a
+			adc	a,c
+			ld	e,c
+			ld	c,15h
+			rst	28h
+			or	h
+			dec	d
+			jp	(hl)
+			db	aeh,50h,7bh,f0h,d6h,b7h,90h,51h
+			db	36h,3ah,64h,26h,dah,cbh,1ch,fah
+			db	7eh,82h,e2h,a4h,72h,c2h,a0h,25h
+			db	3bh,44h,d7h,bbh,13h
+			cp	b
+			sub	efh
+			ld	a,46h
+			or	h
+			ld	c,d
+			ld	b,b
+			dec	hl
+			adc	a,(hl)
+			jp	p,Lafef
+			ld	a,(hl)
+			sub	h
+			inc	bc
+			ld	c,a
+			ld	a,h
+			ld	b,c
+			ld	h,e
+			add	a,l
+			ld	a,5ah
+			ld	d,e
+			out	(3fh),a
+			ld	(hl),73h
+			ret
+			db	8fh,0eh,53h,ffh,0fh,46h,6fh,05h
+			db	72h,a3h,e8h,a5h,93h,0fh,4fh,adh
+			db	59h,3dh,0ah,6dh,fah,b2h,0bh,60h
+			db	a1h,8ch,74h,f3h,9fh,ebh,b8h,23h
+			db	72h,74h,3dh,3ah,63h,31h,85h,ddh
+			db	9bh,efh,d3h,65h,cch,f0h,25h,1ch
+			db	82h,0ch,1bh,5bh,cah,b6h,94h,1ah
+			db	9fh,cch,e1h,a4h,c9h,c9h,98h,17h
+			db	4ch,e1h,d8h,f5h,c1h,44h,12h,e4h
+			db	6fh,83h,74h,97h,25h,37h,fbh,5ch
+			db	06h,26h,84h,79h,f8h,b7h,81h,5bh
+			db	8fh,7bh,0eh,28h,d5h,92h,e6h,90h
+			db	91h,32h,20h,3eh,a4h,beh,d2h,52h
+			db	4bh,d7h,30h,d2h,65h,d7h,eah,9ch
+			db	bbh,30h,f7h,d1h,94h,d3h,b9h,84h
+			db	c6h,3ah,36h,beh,e8h,ebh,4fh,f7h
+			db	f8h,9eh,34h,f9h,b1h,2eh,1eh,f1h
+			db	b9h,3ah,50h,75h,cdh,d0h,0ch,fdh
+			db	75h,feh,d0h,6dh,9ah,05h,15h,64h
+			db	8bh,64h,0bh,24h,a9h,14h,a8h,e2h
+			db	7bh,c3h,d4h,84h
+			ld	(hl),a
+			ld	b,3dh
+			adc	a,h
+			sub	(hl)
+			jr	z,L6eaa
+			sbc	a,e
+			ld	(hl),l
+			add	hl,de
+			add	a,d
+			sbc	a,l
+			ld	e,e1h
+			pop	de
+			xor	d
+			sbc	a,h
+			push	de
+			add	hl,bc
+			cp	e
+			call	pe,Led0a
+			ld	e,l
+			sub	h
+			and	d
+			ld	d,c
+			ld	e,l
+			pop	bc
+			rst	18h
+			ld	a,(eb80h)
+			ld	d,c3h
+			inc	c
+			and	d
+			ld	d,l
+			sbc	a,b
+			call	po,L5be3
+			sub	l
+			or	e
+			adc	a,a
+			halt
+			nop
+			ld	(hl),a
+			pop	bc
+			call	c,L3cfe
+			rst	30h
+			ld	d,c
+			ld	a,c
+			inc	hl
+			ld	e,b
+			inc	sp
+			ld	b,h
+			call	nz,L14be
+			in	a,(c0h)
+			ld	l,h
+			inc	h
+			cp	h
+			ld	h,b
+			dec	de
+			ld	h,a
+			ld	b,(hl)
+			call	nz,Lc1a1
+			ld	a,(24c4h)
+			sbc	a,l
+			sub	l
+			ld	b,d
+			adc	a,c
+			ld	b,b2h
+			ld	bc,3a3bh
+			ret	m
+			and	b
+			jr	z,L6ebf
+			and	d
+			ld	a,(92a1h)
+			ld	d,h
+			ld	d,a
+			ld	b,(hl)
+			add	a,d
+			ld	l,a
+			ld	h,l
+			and	a
+			add	hl,bc
+			ret	po
+			call	nc,Le4db
+			ld	e,b
+			sbc	a,h
+			rst	08h
+			ld	l,b
+			and	d
+			xor	c
+			call	m,Lc10c
+			add	a,e
+			ld	c,l
+			push	bc
+			ld	a,(523ch)
+			add	a,e
+			cp	h
+			pop	bc
+			rla
+			cp	e
+			add	a,a
+			ld	e,c
+			inc	sp
+			ret
+			db	0bh,02h,6ch,e7h,b4h,77h,95h,c4h
+			pop	af
+			call	p,L06a4
+			ld	h,b
+			push	af
+			ld	d,l
+			ld	(hl),d
+			ld	l,a
+			ld	e,d
+			adc	a,a
+			sub	e
+			pop	af
+			ret	c
+			ld	l,b
+			ret	m
+			inc	b
+			ld	(hl),d
+			xor	a
+			inc	c
+			ld	d,h
+			ld	l,d
+			inc	h
+			ld	e,d
+			nop (2x) *
+			sub	l
+			sub	h
+			rla
+			out	(3eh),a
+			xor	eeh
+			jp	pe,L3078
+			ld	e,l
+			ld	b,e
+			cp	d
+			pop	hl
+			add	hl,sp
+			adc	a,a
+			ld	c,l
+			inc	(hl)
+			sub	c
+			jp	m,La779
+			ld	hl,(ff09h)
+			ld	a,(bc)
+			ld	h,c
+			rlca
+			rst	00h
+			ld	l,cch
+			ld	b,a3h
+			adc	a,h
+			ret	nz
+			sub	a
+			ld	h,h
+			call	po,Led9a
+			inc	sp
+			call	nc,L48ab
+			ld	l,71h
+			jp	nc,Led8e
+			and	c
+			rst	20h
+			dec	de
+			ld	(hl),d
+			cp	c
+			add	hl,sp
+			dec	(hl)
+			add	a,l
+			ld	e,b
+			sub	h
+			add	a,a
+			cp	2fh
+			ex	af,af'
+			jp	Lca54
+			db	71h,79h,27h,0ch,7dh,7eh,0dh,42h
+			db	b8h,61h,eah,43h,6ah,09h,d8h,f1h
+			db	86h,e8h,fah,f1h,8fh,31h,36h,48h
+			db	aeh,ebh,b6h,2bh,44h,32h
+			rst	18h
+			rrca
+			jp	m,Lc51f
+			jp	m,L4945
+			rst	30h
+			inc	bc
+			ld	e,29h
+			dec	sp
+			ex	af,af'
+			jr	nc,L6f19
+			cp	14h
+			call	po,L2a19
+			inc	l
+			pop	hl
+			call	nz,L7b88
+			call	c,Lc452
+			jp	nc,Lcb54
+			ld	d,(hl)
+			cp	h
+			ld	l,c
+			xor	b
+			ld	d,a
+			ld	a,e
+			or	a2h
+			ld	c,l
+			daa
+			inc	(hl)
+			ld	a,f5h
+			ld	l,c
+			inc	c
+			sbc	a,e
+			xor	h
+			ld	b,edh
+			jp	m,Lec72
+			ld	b,h
+			sub	c
+			ret	pe
+			ret	nc
+			in	a,(d2h)
+			ld	(hl),d
+			ld	(hl),c
+			ld	d,(hl)
+			add	a,e
+			jp	Le1ad
+			db	48h,c2h,9ah,cdh,63h,a9h,6fh,6eh
+			db	e1h,6eh,6ch,f1h,e4h,5dh,d7h,3ch
+			db	25h,0dh,4ch,e5h,8ch,b5h,b1h,7bh
+			db	b7h,5eh,00h,afh,85h,82h,c6h,80h
+			db	c5h,eeh,96h,fdh,96h,aeh,07h,9ah
+			db	35h,c3h,99h,fdh,c6h,9bh,13h,a9h
+			db	f4h,91h,f1h,e1h,7eh,1ch,39h,a8h
+			db	c0h,48h,b3h,64h,23h,efh,c1h,60h
+			db	cch,d8h,5fh,adh,f2h,aeh,b7h,7ah
+			db	72h,56h,9dh,3bh,d9h,14h,f5h,9dh
+			db	c1h,3ch,bbh,4bh,17h,6fh,17h,91h
+			db	0fh,95h,e9h,8eh,c0h,04h
+			jp	(hl)
+			db	82h,08h,ffh,48h,fdh,3eh,01h,92h
+			db	2fh,2ah,bch,5bh,4fh,74h,3ch,99h
+			db	61h,58h,71h,cch,07h,5ch,d8h,7dh
+			db	57h,73h,f6h,23h,2dh,5bh,2ah,47h
+			db	38h,49h,d3h,f8h,24h,67h,fah,94h
+			db	5bh,1ah,59h,d0h,5fh,f9h,6dh,5dh
+			db	01h,36h,06h,89h,24h,57h,23h,adh
+			db	70h,b2h,c1h,56h,45h,eeh,b8h,d4h
+			db	73h,56h,cfh,29h,4fh,23h,1fh,b3h
+			db	9ch,60h,7fh,5bh,ffh,34h,39h,40h
+			db	7bh,4fh,d4h,bah,0ah,1eh,4ah,e3h
+			db	45h,56h,58h,2ah,a8h,23h,2bh,e6h
+			db	80h,f3h,e4h,e0h,63h,b4h,afh,99h
+			db	b7h,1ah,2ch,8dh,bbh,f2h,afh,b5h
+			db	0bh,52h,96h,1ch,efh
+			add	hl,bc
+			xor	l
+			halt
+			inc	b
+			ld	d,h
+			inc	a
+			pop	de
+			jr	L70a1
+			db	49h,1dh,7ah,6dh,3dh,b1h,e6h,1bh
+			db	ach,6dh,55h,ebh,11h,49h,84h,32h
+			db	82h,33h,82h,8bh,18h,7ah,29h,96h
+			db	aeh,24h,84h,a2h,99h,96h,4ch,e6h
+			db	bfh,88h,08h,4bh,96h,38h,82h,7ah
+			db	24h,53h,34h,9fh,42h,7fh,dah,74h
+			db	f8h,ebh,03h,5ah,59h,f6h,97h,6dh
+			db	46h,a7h,f3h,c6h,d0h,72h,83h,d6h
+			db	62h,9ah,88h,17h,3ch,f1h,6bh,e6h
+			db	e8h,c9h,4dh,25h,1bh,1dh,dch,bah
+			db	b7h,33h,99h,8ch,96h,5ah,aeh,15h
+			db	8ah,7eh,e1h,cdh,4eh,f3h,62h,c2h
+			db	a0h,8bh,99h,06h,44h,c6h,eeh,86h
+			db	d1h,10h,4ah,e3h,4ah,41h,58h,b7h
+			db	42h,cah,c4h,cbh,5fh,34h,82h,b4h
+			db	6fh,20h,a3h,56h,1fh,ceh,bah,31h
+			db	10h,28h,6fh,cch,1fh,11h,ech,28h
+			db	d6h,50h,05h,24h,fdh,1dh,f5h,1eh
+			db	e5h,88h,c3h,89h,4fh,f2h,77h,51h
+			db	6fh,19h,81h,0dh,aah,98h,31h,89h
+			db	ebh,abh,fch,05h,d9h,d0h,7fh,62h
+			db	89h,54h,a9h,c2h,21h,3ah,0bh,08h
+			db	4ah,27h
+			and	l
+			xor	l
+			ld	h,e
+			add	hl,bc
+			out	(6dh),a
+			rst	00h
+			adc	a,c
+			ld	a,l
+			and	(hl)
+			call	L1715
+			cp	l
+			ei
+			sub	l
+			ld	(hl),e
+			dec	a
+			or	b
+			and	a3h
+			or	l
+			add	a,c
+			ld	e,c
+			ld	d,7ah
+			call	c,Lde99
+			adc	a,e
+			sbc	a,h
+			call	nc,L2bd8
+			cp	bfh
+			jp	(hl)
+			db	c0h,34h,9ah,2ah,47h,38h,c0h,9bh
+			db	0ch,9ah,eah,6fh,ceh,18h,0dh,3eh
+			db	2eh,35h,3dh,98h,ceh,cch,64h,36h
+			db	1ah,98h,d0h,b2h,80h,40h,50h,3fh
+			db	a5h,c2h,a3h,8dh,37h,ffh,f1h,54h
+			db	04h,31h,4eh,9ah,19h,24h,5ch,fdh
+			db	fch,bch,55h,68h,1fh,3eh,f5h,85h
+			db	68h,1ah,a6h,f4h,44h,ach,82h,00h
+			db	7fh,2bh,7ah,2fh,9ah,bch,24h,fch
+			db	47h,e8h,6dh,2ch,e3h,efh,74h,d4h
+			db	d8h,ffh,c6h,dch,68h,2dh,c6h,ebh
+			db	58h,57h,78h,f9h,77h,14h,bah,69h
+			db	aah,60h,86h,6eh,7ch,17h,c9h,f1h
+			db	50h,92h,42h,fdh,a7h,f7h,b4h,0eh
+			db	33h,7bh,86h,3bh
+			ld	l,a
+			ld	de,d5b2h
+			push	de
+			rst	38h
+			cp	(hl)
+			ld	b,e
+			ld	h,c
+			dec	h
+			sub	l
+			dec	de
+			and	(hl)
+			adc	a,a
+			ld	e,(hl)
+			ld	d,c
+			add	a,e
+			ld	(bc),a
+			ld	l,h
+			xor	a
+			add	a,(hl)
+			ld	de,14a8h
+			call	pe,L05a1
+			ld	a,d
+			ld	d,ixh *
+			ld	a,(bc)
+			and	b
+			ld	e,l
+			ld	d,b
+			dec	h
+			ld	c,a
+			cp	0ah
+			and	c
+			ld	e,b
+			call	c,L076a
+			call	nc,L9013
+			sub	d
+			jr	c,L71ef
+			cp	e
+			ld	(hl),a
+			res	4,(hl)
+			call	z,L3e18
+			xor	(hl)
+			or	l
+			and	ffh
+			ld	d,a
+			ccf
+			ld	e,l
+			cp	c
+			set	1,c
+			cp	c
+			dec	hl
+			ld	a,a
+			ret	nz
+			ret	pe
+			dec	e
+			cp	aah
+			ld	(hl),b
+			call	pe,L8ef7
+			ld	bc,1fedh
+			cp	e
+			jp	po,L58fd
+			ld	(hl),b
+			jp	c,Lfdd3
+			ld	d,b
+			exx
+			jp	(hl)
+			db	a7h,55h,e0h,29h,efh,8ch,4bh,c7h
+			db	1ch,d9h,82h,04h,5dh,6ah,f3h,83h
+			db	abh,28h,60h,5ch,deh,afh,b6h,74h
+			db	6eh,56h,a6h,d8h,b5h,50h,4bh,20h
+			db	12h,6fh,88h,3ah,55h,a8h,0bh,70h
+			db	deh,36h,0eh,9fh,3bh,fdh,f3h,37h
+			db	61h,68h,18h,0ah,04h,00h,ech,97h
+			db	0ch,c5h,b2h,dch,aah,11h,80h,d8h
+			db	10h,f7h,2bh,e7h,bfh,1ch,a9h,55h
+			db	80h,18h,38h,1fh,84h,a7h,75h,59h
+			db	3eh,a9h,7bh,b9h,d9h
+			sbc	a,c
+			or	a4h
+			sub	e
+			ld	sp,hl
+			ld	l,61h
+			ccf
+			or	h
+			ld	(hl),d
+			cp	c9h
+			dec	h
+			ret	nz
+			sbc	a,b
+			in	a,(2eh)
+			ld	a,f9h
+			xor	h
+			sbc	a,e
+			adc	a,b
+			push	de
+			or	(hl)
+			call	c,L6cfe
+			ld	h,c
+			ex	de,hl
+			ld	(de),a
+			adc	a,l
+			add	a,e
+			cp	0ch
+			call	m,L3be0
+			add	hl,sp
+			add	hl,hl
+			adc	a,(hl)
+			ld	hl,087eh
+			call	z,Lba78
+			ld	(0da7h),hl
+			ld	(hl),c
+			ld	d,a
+			exx
+			ret	nc
+			adc	a,c
+			dec	h
+			scf
+			dec	(hl)
+			sub	l
+			jp	m,Ld6c9
+			adc	a,d
+			ld	l,l
+			ld	e,(hl)
+			out	(3ch),a
+			xor	a
+			inc	hl
+			push	de
+			ld	h,l
+			ld	e,e
+			ld	e,e
+			inc	e
+			or	e
+			ld	l,9ch
+			adc	a,(hl)
+			ld	b,d
+			xor	l
+			inc	e
+			ld	d,d
+			ld	l,l
+			rst	20h
+			adc	a,l
+			sub	b
+			ld	h,b
+			ld	l,d
+			xor	(hl)
+			ld	c,56h
+			pop	bc
+			ret	c
+			ld	l,e
+			add	a,a
+			ld	a,(6d4bh)
+			ret	c
+			ld	h,a
+			dec	l
+			ld	b,d
+			call	nc,Lb13c
+			jr	L7383
+			db	bch,cfh,fah,26h,47h,deh,f1h,84h
+			db	a5h,6eh,d2h,30h,f0h,6eh,dfh,92h
+			db	c8h,bbh,87h,a5h,1ah,9ch,c8h,52h
+			db	86h,29h,39h,f1h,cfh,dch,a0h,68h
+			db	6eh,d0h,ddh,a9h,a3h,aeh
+			jp	c,L65dc
+			xor	h
+			djnz	L72ff
+			ld	a,e
+			ld	(12ddh),a
+			ld	c,h
+			ld	d,e
+			ret	z
+			call	m,L5aff
+			ld	e,(hl)
+			rlca
+			ld	d,1eh
+			adc	a,b
+			ld	a,(623eh)
+			ld	d,d
+			sub	a
+			or	e
+			adc	a,c
+			ld	hl,15a9h
+			rra
+			jp	nz,L972d
+			ld	a,(aab2h)
+			ld	e,h
+			add	a,a
+			rla
+			and	(hl)
+			cp	c
+			ret	z
+			pop	de
+			rst	08h
+			ld	b,a
+			ld	sp,bc62h
+			call	c,L4aab
+			rrca
+			ld	b,d
+			sbc	a,e
+			sub	b
+			ld	e,48h
+			rst	38h
+			nop (2x) *
+			ld	c,d
+			dec	de
+			djnz	L73b9
+			ld	e,9fh
+			ld	b,e
+			sub	e
+			dec	e
+			ld	e,d
+			ld	(hl),b
+			dec	bc
+			ld	e,l
+			add	hl,hl
+			ld	b,e
+			dec	de
+			rst	08h
+			ld	b,a
+			jp	nc,L02e2
+			ld	c,h
+			inc	de
+			sbc	a,h
+			ld	a,(bc)
+			ld	d,b
+			xor	e
+			out	(5ah),a
+			ld	(bbb7h),hl
+			ex	af,af'
+			ld	d,d
+			ld	h,b
+			add	hl,de
+			cpl
+			pop	af
+			ld	(1f8ch),hl
+			ld	d,e
+			add	a,l
+			dec	b
+			jr	nc,L7352
+			ld	e,c
+			sbc	a,b
+			sbc	a,b
+			ld	a,(de)
+			inc	d
+			jp	nc,L677c
+			ld	e,36h
+			push	bc
+			xor	e
+			ex	de,hl
+			rlca
+			ld	(aa93h),hl
+			adc	a,c
+			call	po,La62c
+			ld	c,a
+			ret	pe
+			or	d
+			inc	h
+			ld	d,c
+			or	e
+			ld	l,d
+			ld	h,h
+			add	hl,de
+			inc	de
+			xor	h
+			ld	l,bch
+			ld	a,(bc)
+			pop	de
+			ex	de,hl
+			inc	b
+			ld	b,c
+			ld	a,c
+			adc	a,c7h
+			ret	m
+			di
+			ld	bc,77e7h
+			ld	h,d
+			ld	l,h
+			ld	c,b
+			sbc	a,h
+			ld	l,b
+			ld	e,(hl)
+			xor	d
+			ld	c,d
+			dec	hl
+			and	a
+			dec	sp
+			cp	a
+			ld	d,l
+			ld	(hl),l
+			pop	hl
+			in	a,(b0h)
+			ei
+			ld	h,d
+			ld	d,l
+			ccf
+			add	a,d
+			sbc	a,e
+			inc	(hl)
+			pop	hl
+			cpl
+			adc	a,c
+			cp	a
+			or	b
+			jp	nz,Laba7
+			ld	d,(hl)
+			ld	(hl),d
+			call	pe,L20ea
+			sbc	a,e2h
+			sub	a
+			ld	c,c
+			ld	l,e
+			cp	b
+			ld	e,e
+			sbc	a,e
+			inc	e
+			adc	a,e
+			ld	e,b
+			ld	a,e
+			rst	20h
+			call	m,L72a0
+			ld	c,a
+			ld	(de),a
+			ret
+			db	5ch,4ch,94h,0bh,2dh,a1h,b3h,92h
+			db	33h,49h,09h,79h,1ch,feh,90h,2dh
+			db	e0h,1fh,f1h,75h,6ah,92h,cah,22h
+			db	ddh,8eh,0eh,52h,10h,47h,64h
+			ld	e,h
+			ld	l,b
+			and	d
+			or	h
+			ld	(14c1h),a
+			pop	de
+			or	(hl)
+			ld	b,(hl)
+			ld	a,(bc)
+			ld	d,l
+			ld	b,(hl)
+			scf
+			jp	(hl)
+			db	dah,25h,58h,ffh,b5h,23h,89h,69h
+			db	d2h,60h,4dh,40h,62h,3eh,29h,deh
+			cp	h
+			ld	e,f4h
+			ld	l,d
+			xor	l
+			ld	a,h
+			ld	e,l
+			inc	d
+			add	hl,sp
+			add	hl,sp
+			adc	a,c
+			inc	bc
+			ret	m
+			ld	a,(de)
+			call	c,L887f
+			call	m,L0236
+			ld	b,h
+			di
+			add	a,a
+			di
+			rrca
+			cp	d
+			out	(b4h),a
+			ld	e,c
+			dec	bc
+			rst	28h
+			inc	a
+			ld	a,l
+			cp	h
+			sbc	a,d
+			dec	d
+			ld	h,d7h
+			ld	d,b
+			ld	b,(hl)
+			ld	(bc),a
+			ld	bc,d6e4h
+			xor	e
+			xor	(hl)
+			ld	a,b
+			cp	a
+			ret	p
+			or	d
+			ld	(hl),b8h
+			ld	a,(bc)
+			and	h
+			inc	c
+			add	a,7ch
+			add	hl,hl
+			ld	a,l
+			add	a,l
+			adc	a,d
+			ld	d,(hl)
+			ld	(4ca8h),hl
+			sbc	a,h
+			jp	m,La962
+			adc	a,b
+			inc	(hl)
+			ld	de,88aah
+			ld	d,c
+			xor	c
+			call	L5395
+			ld	bc,e53fh
+			adc	a,e3h
+			rst	10h
+			ld	h,c
+			ld	b,d
+			ld	d,a
+			call	L35c4
+			xor	(hl)
+			jp	po,L87a1
+			ld	b,e
+			jp	(hl)
+			db	ech,fbh,7ch,a7h,e7h,59h,7eh,dch
+			db	13h,90h,29h,82h
+			and	e3h
+			rst	08h
+			sub	l
+			adc	a,h
+			di
+			ret
+			db	a1h,9bh,a2h,77h,32h,0dh,6ch,57h
+			db	d8h,78h,e7h,90h,d4h,f0h,22h,5fh
+			db	cfh,98h,a5h,09h,71h,28h,dah,ffh
+			db	ffh,97h,55h,e9h,08h,84h,d2h,69h
+			db	47h,5ch,59h,15h,1ch,a2h,05h,74h
+			db	9ah,e7h,79h,b8h,1ch,8ah,d3h,89h
+			db	6ch,d2h,37h,49h,71h,aeh,a3h,bch
+			db	21h
+			ret	m
+			ld	(bc),a
+			sbc	a,h
+			ret	z
+			xor	(hl)
+			add	a,(hl)
+			and	l
+			call	p,Ld2a1
+			xor	d
+			call	nz,L4056
+			and	l
+			ld	d,c
+			ld	a,e
+			ld	a,(bc)
+			ld	b,b
+			ld	(bc56h),a
+			ld	a,h
+			call	nz,L4099
+			inc	hl
+			dec	c
+			cp	e
+			ld	h,b
+			inc	h
+			jr	L74ad
+			db	bah,aeh,a7h,b8h,62h,c9h,a0h,1ah
+			db	78h,60h,81h,28h,79h,dah,49h,deh
+			db	48h,50h,62h,deh,6dh,48h,bbh,65h
+			db	88h,dah,c0h,bch
+			inc	l
+			ld	c,d
+			sbc	a,e
+			dec	bc
+			add	hl,sp
+			ld	hl,2ccbh
+			ld	a,1eh
+			inc	de
+			ld	e,b
+			xor	d
+			jp	po,La42a
+			jp	nc,L95ce
+			inc	e
+			sbc	a,h
+			dec	e
+			ld	h,d
+			inc	h
+			ret	z
+			dec	l
+			sbc	a,l
+			dec	c
+			call	pe,L74f8
+			dec	d
+			dec	b
+			nop (2x) *
+			jp	nc,L2d17
+			ld	e,e
+			or	(hl)
+			jp	z,L51a9
+			jr	L7572
+			db	49h,c7h,8bh,06h,03h,a3h,52h,fdh
+			db	0eh,9bh,a5h,3eh
+			ld	c,b
+			ld	de,3176h
+			dec	bc
+			ret	c
+			ld	(c803h),a
+			halt
+			ld	a,a
+			ld	l,h
+			ld	e,a
+			and	d
+			ld	c,b
+			ld	(hl),d
+			ld	l,e
+			add	a,72h
+			and	b
+			inc	sp
+			or	36h
+			ld	c,h
+			ld	d,c
+			adc	a,(hl)
+			and	b
+			rst	00h
+			ret	nc
+			ld	h,h
+			inc	de
+			cp	e
+			out	(04h),a
+			xor	a
+			ld	l,e
+			ld	h,c9h
+			ld	c,b
+			jp	pe,L09a0
+			call	L40bc
+			ld	a,(de)
+			and	a
+			ld	a,(hl)
+			ld	l,l
+			adc	a,c
+			cp	d
+			add	a,aeh
+			ld	(hl),c
+			ret	nz
+			pop	af
+			ld	b,b
+			ld	b,b
+			xor	b
+			ld	d,a
+			ld	hl,d418h
+			rla
+			ld	a,(8c3eh)
+			sbc	a,l
+			dec	h
+			dec	a
+			ld	e,a
+			exx
+			ld	d,h
+			ret	nz
+			xor	a
+			ld	c,(hl)
+			ld	l,e
+			call	z,L8912
+			jr	nz,L75b4
+			ld	(de),a
+			rlca
+			add	a,d
+			ret	nc
+			adc	a,b
+			ld	(hl),a
+			and	a
+			ld	a,e
+			ld	b,a
+			push	af
+			ld	c,l
+			push	bc
+			inc	(hl)
+			cp	l
+			ld	(hl),3ch
+			ld	d,(hl)
+			ld	a,l
+			jp	po,Lea21
+			dec	hl
+			or	l
+			ld	b,h
+			ld	e,a
+			ld	e,h
+			ld	sp,hl
+			ret	po
+			ex	de,hl
+			dec	l
+			or	h
+			adc	a,b
+			ld	c,h
+			ld	c,a
+			sub	a
+			ld	d,d
+			rra
+			dec	hl
+			add	hl,sp
+			inc	hl
+			ld	h,l
+			call	z,L48ff
+			ret	pe
+			ld	l,b
+			ld	(bc),a
+			or	e
+			cp	c
+			adc	a,h
+			ld	a,88h
+			rla
+			ld	(hl),l
+			ei
+			ld	a,(bc)
+			ret
+			db	48h,beh,6fh,8eh,3eh,70h
+			and	c
+			ld	e,2ah
+			or	(hl)
+			ld	hl,(8d34h)
+			rrca
+			ld	l,a
+			ex	(sp),hl
+			jp	c,L1dcc
+			ld	(hl),h
+			add	a,d
+			inc	b
+			and	l
+			jr	nz,L75dc
+			adc	a,l
+			ret	nc
+			ld	l,l
+			sbc	a,(hl)
+			and	b
+			dec	c
+			add	hl,bc
+			xor	l
+			ld	e,b
+			dec	sp
+			ld	h,e
+			ld	b,b
+			add	a,ach
+			push	bc
+			jp	z,Lc02f
+			rst	10h
+			cp	(hl)
+			rlca
+			ld	a,d6h
+			ld	(hl),l
+			ld	(hl),h
+			sbc	a,d
+			ld	c,d
+			ex	(sp),hl
+			cp	a
+			and	l
+			xor	(hl)
+			ld	l,l
+			ld	b,a
+			dec	(hl)
+			call	c,Ld6c2
+			jr	z,L75d1
+			ret	pe
+			jp	p,L59b5
+			halt
+			and	h
+			jr	c,L75d7
+			ld	e,(hl)
+			ld	(de),a
+			jp	(hl)
+			db	96h,f8h,e1h,fch,2eh,58h,54h,7dh
+			db	69h,1ch,1eh,6bh,d7h,31h,56h,79h
+			db	71h,bdh,95h,b8h,e7h,edh,21h,c0h
+			db	feh,87h,8eh,74h,95h,a6h,fdh,a4h
+			db	15h,0ah,e1h,5bh,70h,48h,06h,4ah
+			db	f7h,bah,d0h,27h,02h,21h,cah
+			ret	p
+			ld	ixh,ixh *
+			call	z,Lcb80
+			ret
+			db	6eh,1dh,4ch,87h,e7h,1bh,53h,59h
+			db	fch,52h,cfh,49h,81h,32h,5eh,40h
+			db	bdh,ffh,a1h,beh,21h,55h,29h,17h
+			db	95h,4fh
+			jr	z,L76de
+			ld	a,(hl)
+			xor	b
+			ld	(hl),afh
+			ld	sp,335ch
+			ld	b,f4h
+			ld	c,b
+			ld	hl,(1105h)
+			ld	h,e
+			dec	h
+			add	hl,sp
+			sbc	a,d
+			rst	00h
+			ld	d,d
+			ld	h,25h
+			jr	nz,L7688
+			ld	d,(hl)
+			call	pe,La469
+			ld	c,c
+			or	l
+			ld	c,c
+			xor	h
+			ld	e,b
+			sub	l
+			ld	b,h
+			ld	hl,(5596h)
+			and	b
+			rst	18h
+			and	a
+			ld	bc,2bc5h
+			xor	e
+			adc	a,a
+			sub	a
+			pop	de
+			rst	10h
+			ld	l,h
+			ld	c,l
+			and	(hl)
+			ld	c,4ch
+			dec	b
+			ld	b,(hl)
+			ld	l,b
+			ld	(hl),e
+			inc	bc
+			add	a,(hl)
+			ld	a,c
+			rl	c
+			ld	b,d
+			nop
+			sbc	a,e
+			sub	h
+			dec	bc
+			ld	d,(hl)
+			ld	a,(de)
+			ld	a,l
+			add	a,a
+			ld	b,c
+			in	a,(cch)
+			rst	38h
+			ld	c,l
+			push	hl
+			ld	a,(hl)
+			cp	(hl)
+			jr	c,L7752
+			and	c0h
+			ld	h,d
+			ld	l,a
+			inc	d
+			and	l
+			adc	a,c
+			ld	b,c
+			or	l
+			inc	h
+			inc	sp
+			add	a,d
+			xor	h
+			add	a,a
+			push	hl
+			ld	h,afh
+			ld	c,d
+			ld	de,0c45h
+			ld	a,12h
+			cp	h
+			or	(hl)
+			ld	d,d
+			call	pe,L07e7
+			ld	e,(hl)
+			rst	20h
+			ld	b,d5h
+			or	e
+			rlca
+			add	a,b
+			ld	l,a
+			xor	b
+			ld	a,e
+			ld	l,a
+			call	z,L6328
+			dec	l
+			ld	b,a7h
+			xor	(hl)
+			ld	a,h
+			and	c
+			ld	a,d
+			dec	c
+			cpl
+			ld	sp,1a27h
+			daa
+			cp	h
+			ld	e,d
+			ld	b,b
+			push	af
+			ld	b,b
+			ld	h,a
+			ld	c,l
+			di
+			ld	a,d
+			ccf
+			daa
+			xor	e
+			ld	d,d
+			ld	c,92h
+			ld	h,(hl)
+			xor	c
+			ld	ixl,b *
+			ld	bc,d119h
+			ld	c,c
+			ld	l,h
+			inc	h
+			xor	a
+			ret	c
+			ld	b,a
+			jp	pe,Ladc5
+			out	(afh),a
+			dec	l
+			jp	L4aed
+			db	21h,bbh,e6h,b1h,e4h,ceh,8dh,02h
+			db	06h,eeh,b1h,c6h,34h,5ch,84h,2ah
+			db	8eh,d4h,2ah,afh,94h,eah,e0h,00h
+			db	ebh,54h
+			cp	c
+			ld	e,(hl)
+			ret	m
+			rst	30h
+			ld	h,h
+			ld	h,h
+			add	hl,sp
+			sbc	a,e
+			dec	de
+			jp	m,L557a
+			ld	a,(de)
+			set	4,(hl)
+			rst	38h
+			ld	a,(3d0ah)
+			add	a,d
+			ld	l,a
+			daa
+			sub	e
+			add	a,h
+			and	b
+			and	l
+			dec	l
+			ld	b,b
+			pop	bc
+			rst	38h
+			sbc	a,e
+			ld	(hl),a
+			and	c
+			call	nz,Ld611
+			jr	c,L7762
+			ld	a,(hl)
+			adc	a,c
+			ret	pe
+			pop	af
+			ld	sp,hl
+			inc	de
+			inc	de
+			add	a,60h
+			ld	h,(hl)
+			ld	c,94h
+			cp	b
+			inc	sp
+			pop	bc
+			ld	(hl),l
+			ld	d,c
+			jp	nc,L3519
+			ex	de,hl
+			ex	de,hl
+			adc	a,h
+			inc	a
+			ld	e,b
+			and	c
+			ld	a,(hl)
+			inc	hl
+			dec	c
+			add	hl,hl
+			ld	e,12h
+			djnz	L780e
+			ld	b,d
+			ld	l,e
+			ei
+			ld	h,e
+			call	p,L8901
+			or	h
+			call	pe,L15a3
+			ld	b,a
+			dec	bc
+			or	c
+			adc	a,c
+			ld	c,h
+			and	h
+			rlca
+			ret	pe
+			sub	b
+			ld	l,e
+			ld	(hl),a
+			rst	00h
+			jp	z,L377f
+			ld	h,b
+			sub	b
+			cp	d
+			ld	h,l
+			rst	28h
+			inc	hl
+			ret	nz
+			push	bc
+			ld	d,e
+			ld	a,(hl)
+			sbc	a,(hl)
+			ld	a,l
+			or	ech
+			adc	a,c
+			ld	(hl),c
+			ld	l,l
+			ld	l,h
+			or	e
+			sbc	a,b
+			ld	(bc),a
+			pop	hl
+			and	(hl)
+			sub	(hl)
+			rst	08h
+			rst	20h
+			nop (2x) *
+			ccf
+			ld	b,c
+			cp	(hl)
+			ld	c,a
+			ret	p
+			pop	bc
+			inc	b
+			ld	a,l
+			ld	(a604h),hl
+			add	a,28h
+			add	a,ceh
+			xor	d
+			jp	m,L985b
+			ld	c,(hl)
+			ld	c,c
+			ld	b,e
+			adc	a,a
+			push	bc
+			ld	h,h
+			dec	sp
+			or	b
+			or	h
+			sub	c
+			dec	h
+			ld	l,b
+			rst	30h
+			jr	c,L778e
+			cp	c
+			ld	b,h
+			adc	a,a
+			cp	c
+			ccf
+			ccf
+			adc	a,(hl)
+			ret	pe
+			ld	(de),a
+			push	hl
+			jr	nz,L77a6
+			pop	hl
+			push	bc
+			ret	pe
+			ex	de,hl
+			sbc	a,h
+			ld	(bc),a
+			sbc	a,b
+			ld	c,h
+			inc	b
+			scf
+			ld	c,h
+			ld	e,b
+			sbc	a,b
+			and	d
+			ld	d,e
+			cp	l
+			jp	p,Lc999
+			xor	c
+			sub	4ch
+			jr	nz,L7805
+			jp	m,L3930
+			ret	po
+			sbc	a,c
+			ld	e,b
+			ret	c
+			ld	e,b
+			ld	e,l
+			scf
+			xor	bfh
+			djnz	L7841
+			or	l
+			ld	h,c
+			ld	d,1eh
+			call	L803e
+			and	a
+			jr	L7808
+			db	deh,8ch,eah,28h,d7h,00h,d3h,49h
+			db	d5h,66h,bdh,91h,beh,6ah,6fh,fah
+			db	68h,a7h,72h
+			ld	(hl),a4h
+			ld	b,e
+			add	a,l
+			xor	d
+			and	d7h
+			cp	c
+			ld	c,b
+			ld	d,c
+			ex	de,hl
+			rst	30h
+			ex	de,hl
+			sub	h
+			ld	d,a
+			ret	m
+			jp	Lecb8
+			db	43h,27h,a6h,22h,12h,cfh,4dh,a9h
+			db	21h,86h,40h,5eh,96h,61h,a3h,b0h
+			db	4eh,5ch,63h,40h,e8h,c4h,79h,94h
+			db	e9h,6dh,0ah,c0h,75h,66h,33h,a2h
+			db	d6h,77h,56h,c6h,04h,f9h,66h,48h
+			db	9ah,d0h,f4h,1fh,2ch,1ah,e9h,eah
+			db	9dh,64h,42h,ach,deh,cfh,b0h,eeh
+			db	85h,d3h,31h,6dh,14h,79h,4eh,adh
+			db	a6h,2ah,2eh,37h,15h,a7h,c1h,6ch
+			db	91h,41h,aeh,85h,b7h,dbh,b3h,14h
+			db	d6h,3fh,65h,e2h,19h,19h,9bh,78h
+			db	cdh,d3h,c1h,9ch
+			ex	(sp),hl
+			or	a
+			ld	l,04h
+			sbc	a,h
+			sub	b
+			rst	00h
+			ld	e,h
+			adc	a,e
+			add	a,d
+			ld	(Led3d),a
+			and	e
+			and	l
+			jp	nz,L1f99
+			or	d
+			ld	c,b
+			inc	e
+			or	d
+			nop
+			jp	pe,Ld38b
+			add	hl,sp
+			cp	l
+			sbc	a,(ix + bfh)
+			pop	hl
+			jp	(hl)
+			db	d7h,04h,b6h,e9h
+			call	m,L1eb4
+			ld	(03d6h),hl
+			ld	(hl),b
+			ld	l,e
+			ld	(hl),h
+			ld	d,a
+			jr	nc,L791a
+			ret	nc
+			jp	c,Lf025
+			call	z,L4563
+			ld	e,(hl)
+			jp	(hl)
+			db	27h,34h,08h,74h,eeh,e0h,e0h,b3h
+			db	88h,d6h,93h,cah,dah,a9h,8ch,8eh
+			db	3ch,5dh,3ch,6bh,93h,5eh,dah,92h
+			db	25h,a0h,d3h,01h,ffh,57h,dch,a9h
+			db	5ch,e0h,feh,6ah,90h,69h,cfh,d7h
+			db	37h,24h,7ch,4ch,27h,feh,0bh,52h
+			inc	a
+			ld	c,(hl)
+			ret	nz
+			ld	l,b
+			inc	b
+			and	(hl)
+			add	hl,sp
+			ld	(de),a
+			ld	h,l
+			ld	h,(hl)
+			rrca
+			ld	(hl),c
+			ld	b,c
+			xor	b
+			ret	po
+			rst	10h
+			ret	nc
+			dec	d
+			or	a
+			ld	c,c
+			ccf
+			jp	nz,L73d8
+			xor	e
+			daa
+			cpl
+			ld	a,(bc)
+			cp	b
+			and	(hl)
+			add	hl,sp
+			inc	a
+			ld	e,e
+			ld	h,h
+			ret	nc
+			ld	l,l
+			inc	a
+			adc	a,l
+			ld	e,(hl)
+			ld	a,(bc)
+			or	l
+			sub	44h
+			and	l
+			ld	d,e
+			ld	b,b
+			or	c
+			cp	a
+			ld	a,(de)
+			sub	l
+			add	a,c
+			add	a,e
+			add	a,d
+			ld	a,h
+			ld	c,b
+			and	h
+			ld	a,06h
+			ld	e,h
+			and	h
+			ld	e,a
+			inc	hl
+			rst	18h
+			ld	de,e7adh
+			cp	l
+			ld	bc,fa40h
+			rst	10h
+			ld	(hl),b
+			ld	c,(hl)
+			sub	b
+			ex	de,hl
+			ld	c,b
+			ld	a,c
+			ld	e,h
+			xor	c
+			ld	h,d
+			rst	30h
+			xor	h
+			pop	af
+			ld	b,c
+			and	c
+			ret
+			db	80h,3ch,71h,fah,e6h,7dh,dah,a3h
+			db	8fh,3bh
+			or	c
+			nop (2x) *
+			jp	m,L14d4
+			inc	e
+			sub	d
+			call	pe,L47cd
+			ccf
+			pop	hl
+			out	(29h),a
+			ld	l,b
+			ld	c,0eh
+			ld	a,c
+			ld	(hl),91h
+			ld	l,a
+			cp	h
+			dec	b
+			adc	a,a
+			sbc	a,a
+			and	h
+			ld	b,b
+			inc	e
+			xor	d
+			ld	c,c
+			ld	c,1ch
+			add	a,e
+			xor	l
+			ld	h,(hl)
+			xor	a
+			sub	b
+			ld	d,(hl)
+			ld	h,5dh
+			inc	l
+			ret
+			db	f3h,a2h,e3h,d6h,e1h,b3h,feh,1eh
+			db	ech,bbh,16h,ceh,63h,68h,42h,7fh
+			db	25h,48h,bdh,dch,8eh,ceh,ach,38h
+			db	4eh,3dh,6dh,e6h,e0h,78h,2eh,03h
+			db	08h,8dh,afh,dch,f9h,76h,85h,6ah
+			db	70h,c8h,0ah,b7h,2dh,a2h,f1h,94h
+			db	c5h,09h,67h,1ch,c1h,5fh,5bh,0ch
+			db	61h,dah,35h,18h,bfh,66h,c5h,01h
+			db	26h,50h,d6h,a0h,19h,39h,d0h,deh
+			db	adh,5fh,2eh,fah,d8h,cah,cdh,50h
+			db	7ch,2fh,49h,52h,eah,e1h,9bh,74h
+			db	c9h,3ah,edh,49h,1fh,4ch,6eh,8fh
+			db	e9h,77h,17h,1ch,a6h,02h,d9h,86h
+			db	37h,88h,85h,b1h,9fh,adh,67h,e3h
+			db	5ah,9eh,c4h,2bh,20h,51h,15h,1fh
+			db	c4h,39h,c6h,40h,16h,64h,deh,1fh
+			db	dah,f9h,52h,b8h,f9h,e6h,04h,21h
+			db	c9h,64h,51h,f1h,63h,64h,8ch,4dh
+			db	18h,35h,6bh,eah,85h,97h,74h,f2h
+			db	51h,79h,46h,9fh,50h,26h,c8h,1dh
+			db	5bh,02h,e0h,c7h,87h,83h,39h,7ch
+			db	95h,4bh,12h,f2h,d2h,eeh,b8h,2eh
+			db	80h,88h,abh,ceh,28h,f2h,9bh,02h
+			db	5bh,3eh,e9h,8fh,d9h,b6h,50h,c3h
+			db	33h,ach,9ah,39h,3bh,cdh,f0h,6bh
+			db	9bh,6fh,07h
+			ld	l,h
+			and	(hl)
+			push	af
+			ld	a,h
+			jp	z,Lb6fc
+			ld	c,b
+			ld	e,a
+			ld	a,(hl)
+			sub	d
+			add	a,b
+			ld	h,a
+			add	hl,de
+			rrca
+			ld	c,d
+			add	hl,de
+			add	a,b
+			ld	e,e
+			ex	(sp),hl
+			ld	d,(hl)
+			ld	d,h
+			cp	b
+			and	c
+			ld	a,e
+			cp	b
+			jp	L24ad
+			db	c5h,09h,1dh,cch,dbh,6ah,5fh,14h
+			db	18h,fdh,21h,f5h,9bh,58h,87h,b4h
+			db	5eh,dbh,b9h,f2h,4ah,2ah,c8h,7ch
+			db	b4h,f6h,e7h,2bh,85h,3dh,10h,3ah
+			db	b9h,b4h,2ah,82h,03h,54h,d7h,2ah
+			db	34h,56h,23h,96h,2ch,89h,dbh,b2h
+			db	63h,8bh,0dh,1bh,3ah,16h,d4h,1ch
+			db	f5h,9bh,6fh,85h,93h,f7h,1ch,dbh
+			db	90h,fdh,5fh,0ch,c3h,bah,94h,6bh
+			db	fbh,9bh,abh,17h,d4h,d1h,10h,e3h
+			db	ceh,70h
+			xor	a
+			ex	de,hl
+			xor	a
+			call	c,L7161
+			call	m,Lbd54
+			ld	a,a
+			ld	e,a
+			ld	e,l
+			ld	e,94h
+			cp	(hl)
+			ld	(hl),a
+			sbc	a,8bh
+			ld	d,l
+			ld	(bcc3h),hl
+			sub	l
+			and	a
+			nop (2x) *
+			ld	c,5ah
+			ld	b,h
+			cp	a
+			pop	hl
+			nop
+			ld	c,c
+			dec	a
+			jp	po,L8696
+			ld	e,c
+			sub	e
+			xor	c
+			inc	l
+			ld	e,(hl)
+			ld	h,b
+			ld	c,d
+			push	bc
+			ld	h,d
+			dec	de
+			rst	30h
+			sub	52h
+			ld	(bc),a
+			and	b9h
+			cp	47h
+			call	c,L23b5
+			ld	c,e
+			inc	h
+			ret	pe
+			ex	de,hl
+			ret
+			db	68h,beh,34h,f6h,bbh,b8h,1eh,2bh
+			db	ach,25h,18h,45h,c5h,eah,95h,c2h
+			db	42h,5bh,07h,35h,c5h,1eh,a8h,1dh
+			db	50h,1eh,31h,74h,80h,aah,0ch,deh
+			db	7ch
+			dec	a
+			adc	a,e
+			sbc	a,e
+			adc	a,(hl)
+			cp	b
+			ld	l,l
+			dec	de
+			out	(1dh),a
+			ret	p
+			call	po,L60f9
+			pop	af
+			adc	a,(hl)
+			push	hl
+			call	po,Lc6f7
+			call	nz,L2536
+			jp	pe,L221f
+			ld	(hl),a
+			ld	(hl),b
+			ld	(hl),l
+			rst	20h
+			sub	c
+			exx
+			rst	28h
+			inc	h
+			adc	a,a
+			call	c,Lbda3
+			call	po,Lbdc4
+			ld	b,iyh *
+			or	b
+			pop	af
+			ld	a,l
+			or	h
+			ld	a,c
+			dec	a
+			sub	h
+			rst	30h
+			ld	e,a
+			cpl
+			adc	a,e
+			rlca
+			dec	(hl)
+			inc	bc
+			jr	nz,L7b7d
+			sbc	a,d
+			sub	h
+			rra
+			ld	c,96h
+			and	b
+			sub	(hl)
+			ret	p
+			inc	de
+			ex	af,af'
+			ld	hl,3140h
+			ld	d,l
+			ld	h,b
+			ld	c,b
+			ex	(sp),hl
+			add	a,h
+			or	d
+			add	a,e
+			rst	38h
+			sub	(hl)
+			inc	d
+			ex	de,hl
+			adc	a,b
+			push	bc
+			add	a,d
+			push	af
+			dec	sp
+			or	c
+			ld	d,b
+			rst	08h
+			halt
+			ret	po
+			cp	b
+			ld	l,b
+			ret	p
+			jp	p,L437b
+			rst	28h
+			cp	d
+			ld	e,b
+			ld	e,c
+			rst	00h
+			ld	(hl),68h
+			jp	pe,L0f7d
+			rra
+			ld	l,e
+			ld	h,b
+			ld	l,h
+			ld	d,a
+			xor	(hl)
+			cp	b
+			dec	de
+			ld	c,21h
+			ret	po
+			ld	d,84h
+			inc	e
+			call	nc,Lf91f
+			jp	nz,L7389
+			ex	(sp),hl
+			sub	d
+			ld	d,a
+			call	pe,L563e
+			ld	bc,9955h
+			sbc	a,e
+			dec	l
+			ld	(hl),e
+			jp	pe,L6b5f
+			dec	e
+			ld	h,h
+			ld	l,a
+			ld	l,a
+			sub	7fh
+			inc	b
+			sbc	a,h
+			ld	e,h
+			ex	(sp),hl
+			ld	h,h
+			ld	b,d
+			ld	(de),a
+			ld	e,c
+			jp	(hl)
+			db	61h,79h,6fh,9bh,7eh,6bh,98h,98h
+			db	bfh,50h
+			inc	sp
+			call	pe,L5395
+			inc	d
+			ld	(hl),l
+			sub	e
+			push	hl
+			ld	(hl),a
+			cp	h
+			push	hl
+			ld	c,h
+			ld	c,(hl)
+			ld	a,d
+			ld	b,h
+			sub	d
+			ld	(hl),l
+			add	a,(hl)
+			adc	a,c
+			add	a,b
+			and	e
+			jp	nz,Laf06
+			xor	a
+			xor	d
+			ld	de,b7feh
+			ld	de,4883h
+			ld	b,h
+			add	hl,bc
+			ld	a,(de)
+			xor	h
+			ld	e,d
+			and	e
+			ld	h,(hl)
+			ld	d,(hl)
+			dec	c
+			dec	l
+			add	hl,hl
+			adc	a,l
+			sbc	a,b
+			ld	(hl),a
+			dec	(hl)
+			ld	hl,7083h
+			di
+			and	(hl)
+			sub	h
+			sub	b
+			inc	d
+			or	c
+			ld	(hl),e
+			sub	h
+			xor	e
+			cp	a7h
+			call	z,Lad4d
+			inc	b
+			ld	d,79h
+			sbc	a,e
+			xor	(hl)
+			cp	(hl)
+			push	bc
+			add	hl,sp
+			cp	a
+			ret	p
+			rst	38h
+			ld	d,l
+			and	l
+			ld	(hl),a
+			ret	p
+			ld	a,e
+			sub	c6h
+			ld	e,h
+			xor	e
+			ld	c,d
+			rst	20h
+			sbc	a,(hl)
+			sbc	a,c
+			in	a,(7ch)
+			ex	af,af'
+			nop
+			inc	c
+			add	a,b
+			ld	b,(hl)
+			dec	l
+			jp	pe,L11aa
+			xor	h
+			ld	l,b
+			ld	c,e
+			and	d
+			sbc	a,e
+			ld	b,a
+			add	a,d
+			push	de
+			jp	po,Lc5e0
+			ret
+			db	53h,afh,d7h,9bh,87h,7eh,77h,b5h
+			db	4ch,aah
+			or	e
+			xor	b
+			add	hl,bc
+			dec	c
+			add	a,h
+			or	h
+			dec	bc
+			ld	d,d
+			rst	20h
+			cpl
+			rst	08h
+			ex	(sp),hl
+			ret	pe
+			ld	a,b
+			dec	b
+			jr	c,L7cb8
+			ld	d,h
+			jp	po,L5664
+			dec	e
+			xor	49h
+			or	d
+			ld	e,d
+			ld	b,42h
+			jp	nz,Ld904
+			jr	nz,L7ce5
+			ld	b,d
+			call	nc,L6a9d
+			rrca
+			inc	sp
+			ld	sp,a265h
+			call	p,Lb295
+			cp	h
+			xor	c
+			ld	l,b
+			jp	m,L6361
+			jr	c,L7c47
+			ld	a,l
+			ld	e,b
+			dec	h
+			add	a,c
+			ld	h,h
+			rst	38h
+			cp	c
+			sbc	a,c
+			inc	bc
+			pop	bc
+			ld	a,a
+			ld	sp,17dfh
+			xor	(hl)
+			ld	d,35h
+			cp	h
+			rlca
+			ret	nz
+			djnz	L7cad
+			sbc	a,(hl)
+			and	a
+			ld	a,(de)
+			jp	z,Lbfba
+			ld	l,c8h
+			add	hl,hl
+			srl	c
+			ld	e,c
+			djnz	L7ce0
+			or	e
+			rst	18h
+			jr	c,L7c5f
+			dec	b
+			or	c
+			ret	m
+			ld	d,h
+			ld	(de),a
+			ld	(e080h),a
+			ld	sp,hl
+			xor	a
+			ld	c,l
+			ld	a,d
+			cpl
+			cp	b
+			ld	l,e
+			jp	po,L3594
+			jp	nc,Ld8aa
+			di
+			ld	sp,hl
+			ld	c,b
+			ld	(hl),b
+			rst	08h
+			ld	(hl),c
+			sub	e
+			ret	po
+			cp	b
+			xor	(hl)
+			call	pe,Lf65e
+			ld	b,h
+			ld	c,a
+			add	a,d
+			and	(hl)
+			jp	pe,Lc728
+			call	c,Lb22d
+			ret	pe
+			add	a,d
+			ld	h,l
+			ld	h,h
+			inc	b
+			ld	h,(hl)
+			and	a
+			sub	l
+			add	hl,hl
+			ret	po
+			ld	h,c
+			call	po,L7356
+			sub	c
+			sub	d
+			jp	po,L274f
+			ld	(hl),c
+			jp	nc,L1f3c
+			add	hl,sp
+			ex	af,af'
+			rst	20h
+			ld	d,b
+			ld	h,94h
+			adc	a,b
+			xor	e
+			cp	h
+			rst	00h
+			ld	bc,6e1ch
+			ld	a,d
+			nop (2x) *
+			sbc	a,e
+			ld	(hl),l
+			jp	p,Lc514
+			or	(hl)
+			ld	l,e
+			ld	e,b
+			dec	a
+			jp	pe,L1c35
+			dec	hl
+			add	a,d
+			ld	de,32b2h
+			ld	d,44h
+			ld	e,h
+			nop (2x) *
+			jp	po,Lc8e4
+			and	d
+			call	m,L375b
+			ld	e,c
+			rst	00h
+			or	h
+			call	p,L9fcc
+			xor	a
+			ld	(hl),d
+			ld	(hl),d
+			push	hl
+			ld	l,b
+			ld	b,d
+			jr	L7d74
+			db	9dh,59h,cah,9ah,abh,d8h,34h,33h
+			db	10h,45h,32h,8bh,dah
+			ld	c,l
+			call	nc,L7bda
+			ex	(sp),hl
+			xor	a
+			pop	hl
+			dec	(hl)
+			ld	(ix + 63h),e
+			inc	de
+			add	a,e
+			and	b
+			cp	b
+			add	a,d
+			ld	l,d
+			sbc	a,b
+			cp	(hl)
+			ld	c,0fh
+			sbc	a,(hl)
+			or	c
+			ld	(de),a
+			xor	30h
+			cp	a
+			or	d
+			ex	(sp),hl
+			bit	6,d
+			xor	e
+			nop
+			ld	d,e
+			ld	e,e
+			ex	(sp),hl
+			ld	l,c
+			ld	d,a
+			dec	sp
+			ld	c,l
+			cp	d
+			ld	l,d
+			ld	a,c
+			lddr
+			ret	z
+			and	b
+			cp	a
+			ld	a,b
+			call	pe,Lec86
+			ld	b,e
+			ld	(hl),h
+			sub	e
+			ld	l,l
+			cp	(hl)
+			ld	a,l
+			ld	(de),a
+			cp	c
+			sub	d
+			ld	h,c
+			pop	hl
+			bit	5,c
+			and	94h
+			rst	30h
+			dec	a
+			call	m,Ld48e
+			sub	e
+			ld	l,a
+			ret	po
+			and	h
+			cp	15h
+			ld	c,e
+			cp	e
+			xor	b
+			ld	l,h
+			and	ceh
+			add	hl,sp
+			jr	nz,L7ddd
+			ld	(hl),c
+			xor	e
+			push	bc
+			ld	a,h
+			jp	(hl)
+			db	9bh,41h,78h,f0h,1fh,a3h,ffh,48h
+			db	53h,c7h,87h,93h,c9h,f7h,d8h,0eh
+			db	6ah,beh,bah,bbh,d7h,a9h,a6h,c3h
+			db	83h,64h,a9h,2ah,7ch,c8h,5eh,08h
+			db	76h,aah,cbh,f0h,78h,81h,2eh,bbh
+			db	c9h,d5h,93h,46h,0fh,6dh,3eh
+			sbc	a,fbh
+			ld	h,h
+			call	p,Lf7b3
+			xor	2ah
+			push	de
+			xor	h
+			ld	l,(hl)
+			call	L049d
+			ld	b,h
+			ccf
+			rst	38h
+			ld	d,c
+			sub	a
+			jp	nc,L1623
+			or	(hl)
+			push	af
+			ret	m
+			call	c,L6a57
+			xor	e
+			cp	l
+			rst	18h
+			adc	a,e
+			dec	de
+			sub	e
+			ld	d,(hl)
+			ret
+			db	6eh,5eh,7eh,fdh,81h,e3h,ach,81h
+			db	8eh,05h,d6h,ddh,19h,0dh,bdh,beh
+			db	05h
+			ld	l,l
+			xor	e
+			pop	af
+			inc	d
+			ex	de,hl
+			call	z,L159b
+			ld	e,b
+			xor	c
+			ld	d,l
+			cp	(hl)
+			ld	a,74h
+			or	l
+			add	a,b
+			cp	l
+			sbc	a,a
+			cp	h
+			and	(hl)
+			cp	h
+			push	bc
+			ld	h,e
+			adc	a,l
+			ld	(hl),l
+			dec	a
+			scf
+			bit	2,a
+			ld	b,c
+			rst	30h
+			jr	nz,L7e1d
+			inc	c
+			ld	(hl),l
+			add	a,c
+			xor	a
+			xor	(hl)
+			set	7,l
+			and	d
+			and	a
+			ld	b,c
+			ret	nc
+			rst	18h
+			inc	h
+			and	82h
+			adc	a,e
+			call	p,La90b
+			jp	nz,L6392
+			cp	c
+			ld	c,b
+			dec	a
+			add	hl,hl
+			sbc	a,a
+			sub	e
+			adc	a,e
+			ld	a,a
+			ld	c,b
+			ld	a,b
+			ld	b,b
+			sbc	a,c
+			ld	h,b
+			ld	(hl),b1h
+			dec	a
+			call	z,Lab01
+			cpl
+			inc	h
+			jp	po,L9f2d
+			jp	po,Ld49e
+			jr	L7ec6
+			db	61h,81h
+			ld	(hl),e
+			ld	de,8620h
+			rst	10h
+			ret	po
+			ld	a,(bc)
+			rl	d
+			ex	(sp),hl
+			call	nz,L3dee
+			and	ach
+			add	hl,de
+			inc	l
+			ld	e,d
+			rst	10h
+			ld	e,f3h
+			and	h
+			cp	a
+			rst	08h
+			jp	c,Lb3ec
+			adc	a,l
+			ld	(hl),e
+			ld	b,b
+			dec	l
+			sbc	a,e
+			and	b
+			ld	c,d
+			call	pe,Lca26
+			ld	d,a
+			ld	b,e7h
+			ld	l,b
+			jp	L25f7
+			db	ech,12h,d4h,e6h,16h,1eh,09h,08h
+			db	97h,bah,eah,f7h,8ch,2dh,1eh,e8h
+			db	3ch,0fh,c3h,59h,32h,50h,2bh,beh
+			db	39h,bbh,eeh,67h,76h,e2h,96h,91h
+			db	52h,e8h,b7h,cch,07h,d3h,e6h,05h
+			db	32h,aah,c9h,b2h,c5h,71h,89h,04h
+			db	e0h,ebh,cfh,3eh,81h,ffh,62h,8fh
+			db	b8h,fbh,50h,3ah,12h,9eh,d4h
+			adc	a,l
+			rrca
+			rra
+			sub	e
+			ld	b,a
+			ld	h,a
+			ld	(hl),c
+			cp	e
+			jr	L7f2f
+			db	c9h,a2h,e2h,85h,94h,bdh,8dh,70h
+			db	b9h,28h,69h,00h,0bh,a0h,cch,ech
+			db	a7h,07h,24h,37h,c2h,9bh,89h,06h
+			db	9eh,66h,16h,42h,05h,c3h,73h
+			ld	b,b
+			ld	bc,40fbh
+			di
+			call	c,L219e
+			ld	b,e
+			ld	de,d5eah
+			ld	a,l
+			ld	d,l
+			ld	(bc),a
+			pop	de
+			ld	(hl),e
+			pop	af
+			ld	e,d
+			rst	20h
+			ld	e,d
+			ld	e,a
+			ld	e,c
+			call	z,Le0e3
+			xor	h
+			inc	de
+			ld	d,d
+			and	d
+			ld	c,a
+			sub	(hl)
+			xor	l
+			cp	d
+			ld	d,d
+			ld	hl,(5546h)
+			ld	(de),a
+			nop (2x) *
+			pop	de
+			dec	e
+			jp	pe,L1912
+			dec	d
+			jp	p,Lcfee
+			daa
+			or	e
+			dec	de
+			ld	hl,(81c0h)
+			and	a
+			ret	p
+			inc	c
+			ld	b,b
+			sub	(hl)
+			call	p,L04af
+			dec	sp
+			ld	b,l
+			nop (2x) *
+			jp	nc,L752a
+			ld	b,e
+			ld	l,d
+			di
+			exx
+			ld	(hl),4bh
+			ld	(de),a
+			ld	d,b
+			cp	e
+			ld	h,h
+			push	de
+			jr	nz,L7eef
+			daa
+			sbc	a,8eh
+			nop
+			push	af
+			ld	d,6eh
+			add	hl,hl
+			ld	(hl),b
+			ld	h,a8h
+			or	l
+			rst	10h
+			ld	e,e
+			inc	d
+			ld	l,d
+			or	e
+			ld	e,b
+			nop (2x) *
+			sbc	a,l
+			sbc	a,h
+			or	a
+			rst	30h
+			jr	z,L7fae
+			ld	a,(bc)
+			or	(hl)
+			ld	c,e
+			ld	d,l
+			sbc	a,b
+			ld	d,(hl)
+			add	a,b
+			cp	l
+			xor	h
+			inc	l
+			call	po,L1576
+			ret	p
+			or	c
+			inc	(hl)
+			inc	d
+			ld	c,l
+			or	a
+			ld	a,l
+			ld	d,e
+			call	p,Lf49f
+			rla
+			add	hl,de
+			ld	d,a
+			ld	l,h
+			and	c
+			sbc	a,b
+			inc	(hl)
+			ld	d,l
+			adc	a,h
+			ld	(hl),d
+			ld	(hl),3ch
+			ld	d,(hl)
+			rst	20h
+			adc	a,b
+			ld	e,l
+			ld	sp,1922h
+			sbc	a,(hl)
+			cpl
+			ld	h,(hl)
+			ld	h,e
+			cp	d
+			jp	L4160
+			db	eeh,f6h
+			dec	hl
+			ld	h,e
+			ld	a,a
+			inc	bc
+			adc	a,l
+			inc	h
+			rlca
+			add	a,l
+			jp	z,L63a0
+			adc	a,h
+			jp	po,L3aac
+			ld	a,(de)
+			ld	a,(hl)
+			sub	a
+			ld	h,e
+			ld	sp,hl
+			djnz	L800d
+			add	hl,de
+			ld	(de),a
+			ld	c,b
+			jr	L7fbf
+			db	91h,f5h,97h
+			daa
+			ld	e,b
+			ld	h,99h
+			and	l
+			cp	a
+			inc	(hl)
+			sbc	a,b
+			inc	l
+			ld	(hl),b
+			sbc	a,d
+			call	po,L42bb
+			jp	po,L3ea7
+			add	a,b7h
+			halt
+			cp	a
+			add	a,l
+			ex	(sp),hl
+			ld	d,a
+			ld	c,(hl)
+			call	nz,L422a
+			ret	c
+			or	l
+			ld	de,98b2h
+			ld	a,(de)
+			cp	l
+			cp	b
+			add	a,27h
+			call	z,L15c4
+			push	bc
+			ld	a,c
+			ld	hl,(bc1eh)
+			rst	08h
+			in	a,(ddh)
+			add	a,d
+			ld	(hl),c
+			dec	a
+			ld	d,(hl)
+			ld	e,d
+			ld	e,06h
+			xor	l
+			ld	c,b
+			dec	(hl)
+			scf
+			ld	d,(hl)
+			ret	nz
+			ld	l,cah
+			ld	e,c
+			ld	d,h
+			ld	e,e
+			sbc	a,h
+			inc	bc
+			inc	sp
+			ld	a,d
+			ld	l,e
+			sub	b
+			cp	a
+			rst	18h
+			ld	e,d
+			ld	a,d
+			and	d
+			jr	nz,L7f90
+			cp	e
+			and	(hl)
+			adc	a,96h
+			inc	c
+			add	a,l
+			inc	b
+			ld	b,d
+			sub	h
+			cp	(hl)
+			djnz	L7fbc
+			ld	h,c
+			ld	c,l
+			cp	e
+			pop	de
+			rlca
+			adc	a,c
+			rla
+			ld	h,d
+			sub	c
+			ld	a,(bd6eh)
+			or	31h
+			sub	b
+			jr	nc,L7ff1
+			add	hl,de
+			ld	h,a
+			adc	a,h
+			cp	h
+			xor	c
+			or	e
+			xor	(hl)
+			ld	l,a
+			adc	a,l
+			rst	00h
+			ld	d,l
+			sub	l
+			cp	a
+			ld	h,b
+			ld	(de),a
+			ld	b,c
+			add	a,(hl)
+			rst	10h
+			inc	d
+			jr	z,L7ff3
+			ld	(hl),08h
+			ex	af,af'
+			call	pe,La0ec
+			sbc	a,e
+			ex	(sp),hl
+			ld	d,h
+			ld	l,c
+			sub	h
+			and	b
+			ret	m
+			ld	b,b
+			exx
+			and	a
+			ld	(hl),h
+			push	bc
+			call	pe,L0044
+			ld	a,e
+			ret	m
+			adc	a,h
+			sbc	a,(hl)
+			ex	de,hl
+			rst	10h
+			out	(04h),a
+			ret
+			db	65h,81h,d3h,36h,efh,a5h,8bh,69h
+			db	53h,dbh,09h,2fh,3bh,39h,e2h,9fh
+			db	48h,beh,f3h,92h,fch,aah,3bh,8ch
+			db	90h,52h,47h,a6h,3ah,76h,1fh,93h
+			db	0dh,49h,64h,e7h,a7h,01h,67h,6bh
+			db	beh,8dh,6bh,59h,75h,52h,56h,92h
+			db	15h,63h,e8h,93h,57h,1ah,17h,7ch
+			db	a9h,e0h,73h,efh,e6h,f4h,3dh
+			add	hl,sp
+			jr	L803a
+			db	9ah,5ch,e7h,1fh,f6h,d1h,bch,97h
+			db	40h,a8h,8ch,adh,2bh,deh,8fh,a9h
+			db	47h,6eh,0eh,bdh,d2h,84h,e3h,e5h
+			db	7fh,69h,9ch,91h,c4h,42h,c7h,32h
+			db	78h,a1h,32h,d4h,25h,c5h,66h,39h
+			db	c0h,09h,00h,81h,25h,1ah,d1h,78h
+			db	ech,b5h,57h,35h,cbh,53h,f1h,adh
+			db	37h,a6h,ddh,20h,79h,a9h,3bh
+			ld	c,d
+			cp	d
+			rlca
+			ld	l,e
+			pop	hl
+			ld	(hl),86h
+			jr	L813f
+			db	70h,a2h,ech,88h,abh,45h,f9h,5bh
+			db	5eh,29h,fch,cdh,11h,6ah,c3h,a4h
+			db	cbh,29h,55h,38h,10h,41h,d4h,8fh
+			db	07h,aah,55h,2dh,75h,a2h,c7h,8bh
+			db	22h,2ah,c3h,cbh,82h,e0h,2fh,73h
+			db	34h,75h,99h,2dh,35h,2ch,04h,b2h
+			db	a1h,c5h,eah,23h,11h,ach,9bh,efh
+			db	77h,9bh,12h,cah,35h,eah,78h,fah
+			db	2ch,83h,20h,e2h,06h,fah,b4h,9dh
+			db	05h,36h
+			sub	00h
+			ret	pe
+			scf
+			or	a
+			ld	a,a
+			and	a
+			dec	e
+			ex	af,af'
+			ld	l,(iy + afh)
+			jr	nz,L80d0
+			cp	l
+			ret	p
+			rst	00h
+			sub	l
+			sbc	a,b
+			xor	b
+			in	a,(1eh)
+			sub	c
+			ld	b,3eh
+			call	p,L16d4
+			and	a
+			ret	nz
+			rst	10h
+			ret	pe
+			cp	d
+			and	(hl)
+			ret	p
+			call	pe,Lfbdd
+			jp	p,L0a74
+			dec	bc
+			dec	c
+			call	pe,L3e65
+			ld	a,6dh
+			ret	p
+			ld	l,h
+			or	b
+			jp	(hl)
+			db	abh,a7h,2ch,89h,dah,26h,9ch,5eh
+			db	9ah,99h,4ch,04h,09h,69h,9ch,6bh
+			db	0fh,33h,49h
+			and	l
+			ld	d,(hl)
+			or	d
+			ld	d,a
+			ld	hl,(436bh)
+			call	z,L9b2c
+			add	a,b
+			dec	d
+			cp	l
+			or	e
+			ld	(hl),c
+			call	m,Laa4c
+			ld	l,l
+			ld	d,b
+			ld	sp,hl
+			daa
+			ld	a,l
+			sub	c
+			and	c
+			ld	a,(552ch)
+			ld	l,d
+			ld	a,h
+			ld	h,dch
+			ld	c,e
+			ld	(25e3h),hl
+			add	a,l
+			or	d
+			ld	b,(hl)
+			ld	d,b
+			ld	l,a
+			ld	d,1fh
+			xor	bch
+			xor	d
+			ld	(5b29h),hl
+			ld	c,iyl *
+			out	(aeh),a
+			or	a
+			add	hl,sp
+			sub	d
+			jp	p,L8b27
+			push	de
+			cp	a
+			ld	h,a
+			xor	d
+			inc	de
+			inc	de
+			push	hl
+			inc	e
+			ld	c,h
+			add	hl,bc
+			pop	de
+			cp	1ch
+			inc	(hl)
+			rst	08h
+			xor	(hl)
+			ld	(hl),c
+			inc	a
+			cp	(hl)
+			sbc	a,d
+			push	de
+			ld	d,28h
+			ld	h,c
+			sbc	a,a
+			ld	b,(hl)
+			cp	h
+			ld	a,(de)
+			rst	08h
+			ld	l,h
+			call	z,L7f77
+			or	74h
+			sbc	a,e
+			adc	a,(hl)
+			nop
+			dec	a
+			inc	h
+			inc	sp
+			push	de
+			ld	a,b
+			inc	d
+			jp	pe,L2019
+			ld	hl,c9cch
+			dec	a
+			ld	a,l
+			dec	b
+			xor	d
+			adc	a,9bh
+			rst	08h
+			add	a,b
+			cp	e
+			ld	a,a
+			ld	a,l
+			xor	h
+			rst	38h
+			sbc	a,e
+			rra
+			ld	c,h
+			jr	nc,L825e
+			rst	30h
+			or	c
+			adc	a,(hl)
+			ret	pe
+			ld	l,(hl)
+			ld	l,c
+			sub	4fh
+			and	7bh
+			dec	l
+			ld	b,l
+			add	a,h
+			ld	d,e
+			rlca
+			sbc	a,a
+			ld	hl,871dh
+			ld	bc,fe33h
+			scf
+			ld	(hl),h
+			jp	Ldf01
+			db	adh,51h,5eh,c2h,65h,efh,b8h,d4h
+			db	0bh,46h,5bh,99h,53h,65h,dch,cah
+			db	d8h,ceh,4dh,0ah,4fh,b1h,8bh,c3h
+			db	07h,17h,e4h,4ch,dbh,77h,0ch,06h
+			db	bah,3dh
+			ei
+			and	b
+			or	e
+			dec	b
+			ld	l,(hl)
+			jp	m,L5c92
+			ld	(de),a
+			dec	c
+			rst	30h
+			ld	(hl),b
+			add	a,3fh
+			ld	c,d
+			dec	sp
+			ld	h,b
+			call	pe,L01b2
+			ld	b,b
+			ld	(hl),l
+			jp	po,L9db9
+			ld	h,b
+			cp	a
+			push	af
+			add	hl,hl
+			adc	a,b
+			inc	bc
+			di
+			adc	a,c
+			call	nc,Ladf2
+			add	hl,de
+			in	a,(11h)
+			jp	(hl)
+			db	75h,79h,7ah,4bh,7ch,96h,94h,44h
+			db	1ch,dfh,42h,04h,f8h,1ch,3eh,3ah
+			ld	d,c
+			ld	(a3cbh),a
+			ld	h,h
+			inc	hl
+			adc	a,h
+			jr	L8264
+			db	29h,39h,67h,e2h,b9h,f6h,66h,80h
+			db	b4h,71h,43h,23h,a5h,f8h,39h,73h
+			db	83h,11h,dah,d4h,f4h,dbh,3dh,95h
+			db	70h,69h,1bh,94h,bbh,ddh,27h,c0h
+			db	9ch,09h,7ch,c2h,f3h,6dh,0dh,97h
+			db	3eh,57h,3ch,d2h,76h,dfh,89h,41h
+			db	14h,e0h,a1h,57h,dbh,90h,59h,f8h
+			db	5eh,ech,8eh,60h,2ah,60h,19h,0dh
+			db	dah,73h,1ch,c3h,06h,fdh,07h,b8h
+			db	57h,adh,aeh,34h,24h,d6h,69h,74h
+			db	8ch,27h,e4h,c7h,c8h
+			ld	l,d
+			ld	h,d
+			sbc	a,b
+			xor	h
+			dec	c
+			sbc	a,b
+			sub	e
+			sbc	a,(hl)
+			ld	l,(hl)
+			xor	e
+			sbc	a,l
+			and	bch
+			xor	52h
+			inc	l
+			rst	28h
+			sub	l
+			jr	z,L830e
+			cp	b
+			ld	a,l
+			cp	c
+			ld	b,b
+			or	2ch
+			ld	e,d
+			ld	(hl),ach
+			or	l
+			call	po,L440f
+			sub	h
+			inc	sp
+			adc	a,e
+			ld	b,b
+			ex	(sp),iy
+			ld	l,h
+			scf
+			xor	d
+			inc	c
+			ld	d,36h
+			or	a
+			adc	a,b
+			jp	nc,L78b0
+			ld	b,c
+			add	hl,sp
+			pop	af
+			ld	d,d
+			ld	a,e
+			sbc	a,b3h
+			cpl
+			call	nz,L74ed
+			ld	a,b
+			add	hl,de
+			cpl
+			ld	c,(hl)
+			cp	l
+			halt
+			djnz	L82fa
+			ld	(hl),d0h
+			ld	d,b
+			ld	(b624h),a
+			ld	a,(hl)
+			or	b
+			jr	c,L82e6
+			ld	(hl),c
+			ld	(hl),l
+			ret	p
+			adc	a,l
+			ld	bc,94bdh
+			ld	l,d
+			ld	(hl),5ch
+			cp	l
+			adc	a,c
+			ret
+			db	95h,fch,c6h,6fh,6bh,3eh,51h,00h
+			db	70h,76h,2ch,ddh
+			or	b
+			sbc	a,f6h
+			xor	h
+			ld	d,d
+			cp	a
+			ld	hl,(c44eh)
+			sbc	a,(hl)
+			dec	sp
+			adc	a,d
+			inc	(hl)
+			add	a,d
+			adc	a,c
+			add	hl,de
+			sbc	a,h
+			push	de
+			adc	a,l
+			jr	c,L82d5
+			pop	bc
+			adc	a,h
+			jp	z,L3d64
+			inc	b
+			daa
+			or	c
+			call	Le29c
+			dec	e
+			jp	(hl)
+			db	7eh,54h,31h,81h,98h,4eh,79h,fch
+			db	85h,67h
+			ex	af,af'
+			ld	c,b
+			cp	e
+			rlca
+			rlca
+			ld	h,b
+			add	a,(hl)
+			sbc	a,e
+			add	a,e
+			rst	10h
+			ld	l,e
+			ld	l,e
+			dec	b
+			halt
+			and	l
+			ld	a,c
+			and	c
+			and	e
+			add	hl,sp
+			ld	l,l
+			di
+			inc	c
+			ld	l,d
+			rst	00h
+			jp	Ldb7f
+			db	2bh,ffh,4ah,e1h,73h
+			add	a,(hl)
+			and	b
+			xor	c
+			sbc	a,b
+			sub	d
+			call	nz,L16bc
+			ld	h,e
+			ld	(hl),a
+			cp	d
+			inc	a
+			ld	l,h
+			ld	l,l
+			ex	de,hl
+			inc	b
+			ld	e,c
+			sbc	a,(hl)
+			xor	b
+			xor	a
+			or	e
+			or	a
+			jr	z,L8350
+			adc	a,a
+			ld	c,f6h
+			ld	(hl),73h
+			jp	nc,Ldbc7
+			pop	de
+			cpl
+			ld	(hl),l
+			sub	d
+			push	hl
+			push	af
+			ld	c,c
+			rst	00h
+			ld	l,b
+			ei
+			ld	c,b
+			add	a,c
+			jp	nc,L4725
+			call	pe,L33d2
+			pop	af
+			or	h
+			ret	m
+			ret	c
+			ld	b,e
+			adc	a,e
+			ld	c,b
+			and	a
+			cp	8dh
+			xor	h
+			adc	a,19h
+			sbc	a,h
+			and	c
+			ld	d,e
+			ld	h,c
+			or	c7h
+			jp	c,Lff08
+			jp	L1b2b
+			dec	e
+			or	d
+			add	a,a
+			sll	l
+			ei
+			add	a,8dh
+			and	b
+			ld	a,(faa3h)
+			and	b
+			sub	b
+			add	hl,bc
+			inc	(hl)
+			scf
+			dec	c
+			ld	e,c
+			adc	a,b
+			xor	h
+			add	a,6ah
+			jp	p,L8a10
+			pop	de
+			add	a,(hl)
+			push	hl
+			xor	c
+			ld	b,e
+			xor	b
+			ld	e,c
+			ret	nz
+			ld	a,(bc)
+			dec	h
+			sub	e
+			ld	e,(hl)
+			ld	l,c
+			ld	a,a
+			dec	bc
+			inc	d
+			jp	p,Lbe10
+			ld	(hl),d
+			ld	(hl),b
+			ld	e,fdh
+			dec	l
+			ld	(hl),b
+			sbc	a,e
+			sub	d
+			jp	p,L454b
+			inc	bc
+			ret	nz
+			call	z,Lfa9c
+			jp	nz,L6052
+			djnz	L83f0
+			and	h
+			xor	c
+			ld	(hl),b
+			xor	d
+			or	a
+			add	a,79h
+			add	a,h
+			ld	h,(hl)
+			exx
+			ret	c
+			nop (2x) *
+			sub	a
+			call	z,L7025
+			ret	nc
+			ld	a,(hl)
+			ld	e,a
+			ret	po
+			ld	e,c
+			sub	c
+			ld	a,(bc)
+			and	a6h
+			ld	b,efh
+			call	z,L46ad
+			sub	c
+			ld	a,a
+			add	a,34h
+			ld	b,d
+			cp	a
+			sub	(hl)
+			push	af
+			ld	a,l
+			jp	po,Le3e8
+			adc	a,b
+			xor	c
+			or	d
+			ld	l,b
+			ld	c,e
+			rlc	l
+			ld	d,l
+			call	c,L4aa5
+			inc	bc
+			ld	(hl),e
+			ret	m
+			ld	(hl),b
+			nop
+			ld	d,d
+			rra
+			ld	b,c
+			pop	hl
+			and	c
+			sbc	a,d
+			sbc	a,d
+			ld	c,h
+			inc	c
+			ex	(sp),hl
+			jp	c,L31bc
+			ret	nc
+			sbc	a,(hl)
+			rla
+			ld	(hl),e
+			res	1,h
+			ld	l,d
+			jr	nc,L84c1
+			ld	b,10h
+			xor	(hl)
+			xor	c
+			add	a,c
+			ld	d,c
+			dec	h
+			sbc	a,76h
+			sub	7ah
+			and	(hl)
+			ld	b,d
+			sbc	a,4ah
+			ld	l,d
+			daa
+			rst	30h
+			ld	d,l
+			scf
+			sub	l
+			ld	l,c
+			and	(hl)
+			ret	c
+			cp	a
+			ld	c,d6h
+			ld	l,a
+			ret	c
+			ld	e,h
+			dec	de
+			ld	d,h
+			exx
+			ld	c,c
+			inc	bc
+			and	a
+			nop (2x) *
+			ld	a,9ch
+			ld	b,42h
+			sub	d
+			djnz	L8434
+			inc	a
+			ld	l,a
+			ld	d,l
+			ld	d,bch
+			add	a,(hl)
+			jr	L841e
+			db	96h,a5h,e0h,5fh,0ch,01h
+			ld	(de),a
+			ld	h,a
+			sbc	a,(hl)
+			rst	00h
+			inc	(hl)
+			ld	b,b
+			sub	b
+			ld	h,l
+			ld	e,h
+			xor	c
+			call	z,Lc87a
+			adc	a,4fh
+			sub	a
+			ld	(hl),3dh
+			rlca
+			dec	l
+			dec	b
+			jp	nc,L5272
+			ld	h,a
+			dec	l
+			add	a,h
+			jp	z,L7330
+			ld	d,96h
+			push	af
+			adc	a,(hl)
+			sbc	a,e
+			ld	a,(hl)
+			ld	h,(hl)
+			ld	c,d
+			out	(feh),a
+			ld	h,h
+			ld	(ix + 3eh),73h
+			rst	20h
+			ld	a,a
+			add	hl,de
+			ld	d,c
+			cp	l
+			adc	a,22h
+			ld	h,b
+			rst	28h
+			ld	b,(hl)
+			ld	c,b
+			rst	38h
+			ld	e,h
+			sub	c
+			ld	h,h
+			xor	(hl)
+			ld	(hl),40h
+			ret	pe
+			ld	(bc),a
+			ld	bc,b789h
+			ld	h,d
+			or	b
+			ld	a,a
+			xor	a
+			ld	l,a
+			jr	L8476
+			db	9bh,b1h,09h,26h,5ah,ceh,b3h,5dh
+			db	65h,16h,d6h,76h,0ch,9bh,0bh,efh
+			db	6eh,e4h,f7h,d4h,22h,e6h,3eh,3eh
+			db	4eh,fbh,bbh,f5h,dch,81h,ffh,f5h
+			db	a0h,7eh,68h,46h,5eh,11h,b3h,c4h
+			db	04h,21h,36h,46h,52h,85h,f3h,e5h
+			db	3dh,83h,2ch,21h,91h,97h,b0h,6ch
+			db	e3h,7bh,abh,05h,9eh,adh,cah,11h
+			db	34h,46h,cfh,a4h,04h,40h,15h,c3h
+			db	adh,48h,1bh,73h,1dh,d9h,aeh,2fh
+			db	2ch,2ah,95h,6ah,f2h,fah,3dh,42h
+			db	abh,15h,66h,65h,a4h,92h,20h,e9h
+			db	eeh,e5h,7eh,56h,b9h,ffh,c6h,efh
+			db	54h,efh,0fh,bah,d5h,16h,99h,21h
+			db	9dh,2ah,c9h,87h,2ch,a4h,f1h,7fh
+			db	51h,45h,4bh,1ch,f0h,28h,36h,9dh
+			db	ebh,1ch,b6h,a1h,b2h,9eh,28h,ddh
+			db	a2h,a0h,adh,d3h,f4h,b6h,eah,f0h
+			db	30h,a0h,07h,1fh,d6h,01h,a5h,f3h
+			db	d3h,73h,29h,d6h,98h,a1h,0ah,62h
+			db	5ah,43h,30h,97h,52h,57h,0bh,efh
+			db	8ah,11h,0bh,bdh,67h,e9h,a5h,cah
+			db	b0h,b4h,92h,52h,33h,0ch,3ch,eah
+			db	64h,b7h,57h,62h,65h,67h,9dh,12h
+			db	45h,09h,01h,7bh,5dh,13h,50h,68h
+			db	aah,d0h,d8h,a2h,bah,afh,73h,abh
+			db	79h,d7h,4ch,9fh,e2h,cdh,3bh,c3h
+			db	f2h,cch,6fh,d3h,69h,9ah,a8h,64h
+			db	c1h,9bh,34h,63h,21h,ebh,d0h,1ah
+			db	91h,7bh,b8h,23h,6fh,08h,44h,54h
+			db	7fh,2dh,9ch,0fh,c5h,dbh,4ch,d6h
+			db	eah,fbh,06h
+			sbc	a,(hl)
+			sbc	a,(hl)
+			ld	e,b
+			sbc	a,e
+			exx
+			ld	(hl),e
+			ld	l,(hl)
+			add	a,(hl)
+			add	a,(hl)
+			call	po,Ld682
+			ld	l,l
+			call	Ledef
+			ld	d,a
+			or	(hl)
+			jr	nc,L85e9
+			inc	sp
+			xor	(hl)
+			out	(50h),a
+			cp	c
+			call	pe,L37e4
+			ld	b,h
+			dec	hl
+			dec	sp
+			ex	af,af'
+			ld	l,d7h
+			or	h
+			or	d
+			ld	h,h
+			ld	l,5bh
+			ld	h,a2h
+			jr	L8676
+			db	01h,6bh,4dh,c6h,0fh,d9h,8ah,77h
+			db	9ch,64h,c4h,64h,96h,14h,14h,c4h
+			db	75h,3fh,28h,a1h,a9h,beh,bdh,99h
+			db	bch,05h,93h,0ah,89h,13h,0ah,12h
+			db	77h,aeh,a0h,59h,50h,dch,09h,14h
+			db	d2h,21h,0eh,d9h,21h,03h,cfh,69h
+			db	e6h,26h,68h,00h,e8h,60h,83h,2dh
+			db	92h,6fh,65h,8fh,15h,eah,74h,73h
+			db	f9h,55h,35h,0ah,3ah,00h,30h,80h
+			db	4ch,3bh,bch,fdh,0ah,47h,c9h,06h
+			db	84h,72h,c2h,42h,24h,c1h,cfh,f6h
+			db	0bh,11h,32h,cbh,6bh,48h,0eh,e3h
+			db	2dh,abh,3dh,71h,eeh,54h,deh,cch
+			db	6ah,4ah,4ah,a6h,31h,25h,c9h,a3h
+			db	87h,03h,46h,13h,0dh,03h,60h,09h
+			db	e0h,4ch,f3h,39h,69h
+			push	de
+			call	nz,Lc4c7
+			or	b
+			ld	sp,hl
+			rst	10h
+			ld	l,(hl)
+			cp	h
+			ld	(hl),d
+			or	l
+			sbc	a,(hl)
+			ld	a,b
+			ei
+			jp	po,L896e
+			or	(hl)
+			push	af
+			ld	(hl),h
+			ld	hl,d34bh
+			sbc	a,e
+			ex	de,hl
+			ld	e,l
+			rla
+			call	m,Leb83
+			dec	h
+			and	66h
+			ld	(hl),b
+			or	c
+			ld	c,d
+			rlca
+			or	a
+			adc	a,h
+			di
+			ex	de,hl
+			dec	c
+			add	a,e
+			add	hl,de
+			ld	b,c
+			ld	c,b
+			ret
+			db	82h,48h,0ah,d4h,d6h,68h,b3h,b8h
+			db	aah,fch,77h,85h,dch,b8h,03h,f2h
+			db	83h,65h,39h,7dh,43h,e9h,66h,7bh
+			db	05h,67h,55h,26h,f1h,9ah,3bh,c8h
+			db	c1h,67h,1ah,1ah,32h,aah,e5h,36h
+			db	1fh,ebh,fbh,c1h,dfh,4ch,c3h,4eh
+			db	38h,96h,9dh,31h,87h,23h,4ah,c6h
+			db	1eh,deh,0eh,dah,8eh,81h,a1h,0eh
+			db	ceh,d7h,3fh,fbh,01h,ach,31h,a1h
+			db	edh,a2h,2bh,17h,28h,a5h,ech,b0h
+			db	a7h,63h,49h,68h,c4h,f7h,2ch,53h
+			db	0fh,adh,a2h,a6h,2eh,2bh,35h,c2h
+			db	bdh,45h,ffh,96h,6ch,57h,06h,b9h
+			db	f5h,bfh,a1h,a8h,e9h,81h,b3h,60h
+			db	8ah,86h,30h,ach,40h,89h,38h,a0h
+			db	afh,17h,c7h,e2h,90h,13h,6dh,cch
+			db	95h,23h,49h,90h,d8h,23h,44h,53h
+			db	89h,8fh,b7h,feh,98h,1eh,5dh,a2h
+			db	84h,94h,d8h,6dh,a4h,03h,4ah,71h
+			db	58h,a6h,9eh,2ch,87h,8eh,eah,69h
+			db	7ah,1dh,34h,3eh,1eh,79h,3fh,cdh
+			db	37h,d7h,efh,7ah,fbh,b3h,b2h,3ah
+			db	beh,54h,d1h,59h,feh,dch,0fh,10h
+			db	5fh,21h,c0h,85h,80h,aeh,b2h,b7h
+			db	abh,0fh,69h,21h,92h,61h,8ch,9eh
+			db	09h,18h,f8h,09h,aeh,aeh,c5h,9eh
+			db	a6h,bdh,30h,28h,adh,39h,deh,c9h
+			db	21h,deh,72h,5ah,91h,79h,29h,80h
+			db	06h,62h,51h,ddh,b9h,2dh,03h,ddh
+			db	03h
+			ld	a,6dh
+			call	po,L88dd
+			rst	00h
+			and	(hl)
+			xor	47h
+			rst	38h
+			and	a
+			call	c,L106b
+			ld	e,e
+			ret	nz
+			ld	l,e
+			sub	(hl)
+			ld	a,e
+			ld	e,d
+			add	hl,hl
+			ld	b,c
+			dec	bc
+			ld	e,l
+			or	(hl)
+			ccf
+			ld	e,(hl)
+			ld	d,c
+			ld	(hl),b
+			inc	l
+			dec	l
+			adc	a,(hl)
+			pop	af
+			ld	b,a
+			jr	nc,L878e
+			ld	h,a
+			ret	p
+			xor	c
+			ld	d,h
+			call	m,L64c1
+			and	b
+			out	(a8h),a
+			ld	e,55h
+			inc	hl
+			or	l
+			ld	l,ach
+			ld	e,f1h
+			ret	nc
+			ret	p
+			add	hl,hl
+			dec	a
+			rst	08h
+			jp	nz,Ld810
+			ret	z
+			ld	d,5fh
+			ret	z
+			ld	b,b
+			jp	pe,Le7a6
+			inc	d
+			ld	l,d
+			ld	a,d
+			ld	(hl),l
+			push	bc
+			and	97h
+			ld	b,(hl)
+			di
+			ld	bc,732dh
+			ld	hl,(6c4fh)
+			sub	(hl)
+			or	b
+			push	de
+			adc	a,c9h
+			out	(abh),a
+			jp	c,Lef4e
+			di
+			ld	a,d
+			jp	z,L23a7
+			sbc	a,h
+			rst	08h
+			cp	(hl)
+			adc	a,d
+			ld	a,a
+			ret	z
+			pop	bc
+			xor	c
+			inc	l
+			ret	p
+			ld	d,(hl)
+			sub	a
+			adc	a,2dh
+			add	a,c
+			call	c,L9f00
+			or	l
+			dec	hl
+			di
+			ld	c,a0h
+			out	(bch),a
+			jr	nc,L8811
+			jp	nc,Lf7e2
+			adc	a,c
+			ld	sp,hl
+			ld	a,(bec5h)
+			or	e
+			ld	c,h
+			ld	a,h
+			cp	e
+			pop	bc
+			push	de
+			and	e
+			xor	l
+			ld	e,(hl)
+			ld	hl,7476h
+			add	a,c
+			ld	a,c
+			djnz	L8839
+			ld	a,e
+			adc	a,e
+			inc	sp
+			inc	bc
+			xor	e
+			adc	a,3ah
+			ld	c,l
+			ld	e,e6h
+			ex	(sp),hl
+			ld	sp,b064h
+			or	b
+			ld	(hl),e
+			rra
+			add	hl,sp
+			jp	pe,L3143
+			ld	d,c
+			push	de
+			call	pe,L98c0
+			sbc	a,e
+			ld	e,l
+			ld	b,a
+			dec	e
+			ld	(hl),c
+			jr	nz,L8824
+			ld	e,e
+			dec	a
+			dec	l
+			cp	e
+			ld	a,(hl)
+			ret	po
+			cp	h
+			ld	c,l
+			pop	af
+			ret	p
+			adc	a,c
+			cp	d
+			rla
+			halt
+			add	hl,sp
+			ld	a,d
+			ld	l,d
+			ld	(de),a
+			inc	hl
+			push	af
+			ld	(hl),b
+			ret	nz
+			ld	l,(hl)
+			cp	b7h
+			xor	e
+			ld	e,e3h
+			ld	b,e
+			ld	l,l
+			ld	bc,9531h
+			ld	(hl),c
+			ret	m
+			ld	a,(bc)
+			or	c
+			ld	l,c
+			xor	h
+			ld	h,c
+			ld	c,h
+			ld	(hl),c
+			ld	(hl),h
+			jp	c,L128b
+			call	p,L25c1
+			ld	iyl,d *
+			cp	h
+			sbc	a,d
+			xor	d
+			inc	d
+			ld	e,a
+			add	a,96h
+			add	a,h
+			ld	(hl),62h
+			ld	a,(8586h)
+			ld	c,h
+			inc	e
+			ld	a,d
+			jr	c,L8884
+			ret	z
+			nop
+			call	pe,Lf6b8
+			and	a
+			ld	(ec1eh),hl
+			ret	m
+			scf
+			call	z,L8e9a
+			ld	(hl),6fh
+			ld	d,b
+			ld	b,4ch
+			ld	d,b
+			xor	l
+			pop	hl
+			rst	38h
+			pop	hl
+			jr	z,L890d
+			jp	po,L7cb0
+			ld	a,c
+			ld	b,54h
+			add	a,h
+			add	a,e
+			adc	a,62h
+			add	hl,hl
+			ld	d,beh
+			ld	e,6dh
+			jp	po,Lc5f7
+			jp	(hl)
+			db	84h,c2h,e4h,04h,2eh,2bh,e2h,d8h
+			db	d9h,49h,1ah,0dh,a5h,d4h,10h,4ch
+			db	36h,73h,e3h
+			ld	h,b
+			call	c,Lfcf3
+			add	hl,bc
+			ld	d,h
+			sbc	a,d
+			ld	l,e
+			ld	c,e
+			ld	h,e
+			or	(hl)
+			ret	nz
+			ld	l,b
+			add	a,(hl)
+			ld	d,b
+			and	h
+			pop	hl
+			ld	d,l
+			dec	e
+			call	z,L1038
+			ld	b,d
+			sbc	a,a
+			rst	00h
+			sub	e4h
+			inc	de
+			ld	a,h
+			sub	b0h
+			ld	(hl),9ah
+			djnz	L889c
+			nop (2x) *
+			sub	e
+			sbc	a,e
+			push	hl
+			ld	h,l
+			rst	20h
+			push	hl
+			ld	sp,408eh
+			or	b
+			ld	e,e
+			dec	l
+			ld	(hl),l
+			dec	l
+			inc	de
+			ccf
+			ret	po
+			rst	30h
+			ccf
+			or	b
+			add	hl,sp
+			ld	e,h
+			inc	e
+			push	de
+			ld	e,e
+			and	a
+			ld	(hl),l
+			ld	e,c
+			cp	l
+			dec	c
+			or	a
+			jr	L88ee
+			db	17h,2eh
+			adc	a,a
+			ld	e,h
+			and	(hl)
+			call	m,Lf9c6
+			ld	(hl),b
+			ld	a,(hl)
+			halt
+			jr	nz,L88d3
+			ld	a,d
+			sbc	a,(hl)
+			dec	b
+			ld	d,d
+			add	hl,de
+			xor	c
+			sub	65h
+			ld	a,d
+			ret	po
+			inc	e
+			ld	l,h
+			or	a
+			call	nc,L72a8
+			jp	L2c0a
+			db	d0h,8dh,32h,b9h,f2h,75h,09h
+			dec	d
+			adc	a,(hl)
+			sub	e
+			jp	p,Lda8c
+			jp	m,Laa84
+			inc	(hl)
+			ex	af,af'
+			ld	(hl),d
+			ld	(hl),a
+			rst	28h
+			or	(hl)
+			cp	d
+			ret	po
+			sub	d
+			add	a,d
+			ld	d,l
+			sub	b
+			ld	d,(hl)
+			rra
+			dec	e
+			add	hl,de
+			sbc	a,a
+			ld	(bc),a
+			ld	e,a
+			or	a
+			ld	e,h
+			ld	e,h
+			sbc	a,d
+			ret	c
+			or	d
+			ld	a,a
+			sbc	a,d
+			dec	bc
+			ld	d,h
+			xor	l
+			ld	c,24h
+			rrca
+			adc	a,c
+			ld	b,h
+			xor	d
+			dec	a
+			sbc	a,d
+			adc	a,l
+			ld	hl,1ff8h
+			ret	m
+			and	l
+			adc	a,c
+			cp	d
+			xor	b
+			ld	e,e
+			push	af
+			ld	a,(e0d3h)
+			adc	a,c
+			ld	d,e
+			or	a
+			sub	a2h
+			jr	L8937
+			db	35h,06h,d2h,ceh,c0h,d9h,22h,5ch
+			db	b4h,42h,23h,dbh,b4h,c3h,33h,23h
+			db	9eh,b8h,50h,6bh,17h,49h,76h,29h
+			db	16h,c9h,1eh,34h,51h,20h,fdh,4ch
+			db	61h,20h,c2h,d8h,9ah,b5h,c2h,abh
+			db	91h,2ah,cah,e8h,71h,2eh,86h,68h
+			db	15h,aeh,4ch,8bh,b3h,84h,c2h,59h
+			db	bch,39h,5bh,74h,ech,04h,55h,55h
+			db	cah,b7h,98h,f5h,f2h,2bh,1ch,f6h
+			db	3bh,7ah,5dh,bbh,22h,62h,3fh,95h
+			db	33h,ceh,29h,b9h,e0h,a0h,fch,ebh
+			db	84h,e8h,26h,a6h,28h,6ch
+			rst	08h
+			add	a,e
+			ld	d,h
+			ld	b,h
+			ld	e,d
+			ld	e,(hl)
+			ld	e,(hl)
+			rst	10h
+			ld	bc,8df8h
+			ld	c,l
+			ret	m
+			di
+			pop	de
+			call	z,Le3dd
+			rst	38h
+			ld	a,d
+			inc	a
+			ld	d,b
+			cp	c
+			ld	d,c
+			rst	00h
+			nop
+			jr	z,L8a04
+			rst	20h
+			xor	l
+			xor	c
+			rst	10h
+			pop	hl
+			jr	nz,L8a38
+			jp	nz,L5e60
+			call	pe,L3615
+			cp	b
+			rst	38h
+			rst	00h
+			add	a,l
+			ld	e,b
+			xor	e
+			call	po,L2884
+			jp	(hl)
+			db	05h,21h,cbh,40h
+			sub	c
+			cp	h
+			adc	a,l
+			cp	fdh
+			sbc	a,d
+			sub	b
+			ld	c,a
+			ld	d,c
+			and	c
+			dec	e
+			inc	e
+			add	a,b
+			adc	a,(hl)
+			dec	bc
+			sub	bah
+			ld	d,l
+			sbc	a,d
+			ld	sp,hl
+			ld	b,0fh
+			sbc	a,d
+			ld	b,b
+			add	a,d
+			ld	d,b
+			ld	l,5fh
+			ld	sp,2ee6h
+			nop (2x) *
+			call	po,L26bd
+			inc	c
+			djnz	L8a2b
+			ld	d,e
+			dec	h
+			ld	bc,2b68h
+			ld	a,l
+			ret
+			db	84h,a1h,edh,18h,bah,1eh,fbh,2eh
+			db	02h,82h,1ch,44h,29h,aeh,1ah,9fh
+			db	84h,f0h,b0h,bch,cfh,50h,25h,73h
+			db	38h,48h,3ah,1ah,89h,beh,a1h,64h
+			db	87h,66h
+			adc	a,f4h
+			call	m,L0c45
+			add	a,83h
+			rst	30h
+			exx
+			dec	bc
+			ld	e,c
+			or	c
+			rst	10h
+			inc	e
+			ld	h,(hl)
+			cp	l
+			ld	b,b
+			ld	a,dfh
+			ld	(hl),b4h
+			cpl
+			adc	a,l
+			inc	d
+			ex	de,hl
+			add	a,e
+			xor	c
+			ld	h,a
+			ld	b,l
+			adc	a,l
+			ld	l,h
+			dec	a
+			ld	(bc),a
+			rra
+			xor	a
+			ld	d,l
+			rst	38h
+			ld	l,e
+			ld	h,l
+			call	p,L5fda
+			adc	a,(ix + b0h)
+			pop	bc
+			jr	L8abe
+			db	f9h,b4h,8dh,59h,1ch,7fh,e4h,33h
+			db	6fh,1bh,cah,b7h,20h,c0h,02h,8ch
+			db	64h,21h,1dh,a3h,74h,35h,03h,b9h
+			db	69h,deh,a3h,efh,9ch,65h,e8h,85h
+			db	a4h,1dh,f2h,a9h,b8h,88h,09h,85h
+			db	f1h,35h,7fh,41h,03h,e2h,a5h
+			dec	l
+			and	b
+			scf
+			ld	l,b
+			dec	a
+			sbc	a,h
+			exx
+			add	a,(hl)
+			ld	b,c
+			di
+			sbc	a,l
+			rra
+			and	a
+			jp	pe,L8d9f
+			ld	b,l
+			ld	hl,(2b9ah)
+			ld	e,a
+			set	5,(hl)
+			inc	b
+			call	po,Laa64
+			ccf
+			inc	l
+			dec	l
+			add	a,h
+			set	1,d
+			add	a,a
+			ld	a,h
+			jp	nz,Lc915
+			dec	bc
+			ld	(hl),f4h
+			ld	e,h
+			sbc	a,h
+			jr	nc,L8b07
+			ld	(hl),61h
+			ld	d,(hl)
+			nop (2x) *
+			inc	sp
+			rst	20h
+			adc	a,(hl)
+			adc	a,h
+			sbc	a,d
+			rlca
+			adc	a,c
+			sbc	a,b
+			add	a,e
+			pop	de
+			and	l
+			ld	h,d
+			jp	pe,La127
+			ld	c,h
+			jp	nz,L4e5b
+			ld	a,d
+			ld	l,c
+			push	af
+			call	L0c99
+			ret	nz
+			ld	b,b
+			ld	d,c
+			pop	bc
+			adc	a,(hl)
+			nop
+			rra
+			cp	a
+			ret	m
+			ld	a,a
+			call	z,Lae45
+			xor	c
+			adc	a,a1h
+			jr	z,L8ac4
+			ld	c,aah
+			ld	(hl),d
+			ld	h,l
+			set	0,d
+			and	53h
+			rst	10h
+			dec	hl
+			ld	(44d3h),hl
+			jp	nz,L9168
+			ld	l,b
+			call	pe,L29de
+			or	h
+			add	a,d1h
+			ld	sp,bf9eh
+			ld	c,(hl)
+			out	(f8h),a
+			call	pe,L1f13
+			ld	l,(hl)
+			adc	a,b
+			jr	nz,L8b90
+			ld	b,b
+			ld	sp,b24dh
+			ld	e,14h
+			push	de
+			or	a
+			ld	(hl),b
+			inc	(hl)
+			ld	a,d
+			adc	a,(hl)
+			sub	d
+			or	d
+			or	d
+			call	pe,L14bf
+			sub	d
+			rst	30h
+			jp	nc,L7e5b
+			cp	h
+			inc	e
+			dec	d
+			cp	e
+			ld	e,0ah
+			ld	b,l
+			sub	d
+			jp	nz,L6726
+			rst	08h
+			ld	h,9fh
+			push	af
+			ld	d,h
+			adc	a,h
+			ld	h,e
+			ld	a,(6b3dh)
+			and	c
+			add	a,e
+			dec	b
+			ld	c,(hl)
+			ld	a,a
+			or	a
+			ld	(de),a
+			ld	l,e
+			ld	b,94h
+			and	b
+			ld	l,b
+			add	hl,hl
+			ld	h,(hl)
+			dec	l
+			ld	(hl),a
+			sra	c
+			and	l
+			push	bc
+			jp	nz,L076d
+			call	L7af7
+			dec	c
+			and	c
+			inc	h
+			ld	(hl),b
+			ret
+			db	a3h,50h,31h,0eh,f5h,47h
+			ld	e,e
+			add	a,e
+			add	hl,sp
+			ld	h,d
+			ld	e,l
+			ld	b,(hl)
+			and	dch
+			and	c
+			ld	c,c
+			jp	po,L512f
+			ld	b,e
+			cp	(hl)
+			ld	a,c
+			ret	m
+			nop (2x) *
+			adc	a,c
+			sbc	a,e
+			dec	h
+			and	b
+			jp	pe,L23d0
+			xor	(hl)
+			ld	e,62h
+			xor	h
+			ld	a,(bc)
+			ld	l,(hl)
+			ld	a,a
+			call	z,L6d42
+			ld	b,a
+			dec	(hl)
+			cp	h
+			sub	c
+			ld	a,b
+			ccf
+			and	(hl)
+			call	L3f7b
+			ret	p
+			nop (2x) *
+			or	a
+			add	hl,de
+			pop	hl
+			push	bc
+			sbc	a,e
+			ld	b,b
+			and	c
+			ld	(hl),e
+			sbc	a,e8h
+			ld	d,c
+			ld	l,4dh
+			ld	bc,a1b5h
+			ld	c,b
+			sbc	a,a
+			ei
+			ld	(hl),e
+			sbc	a,ebh
+			ld	a,c
+			dec	hl
+			ld	(L803a),hl
+			ld	d,e
+			add	a,a
+			ex	(sp),hl
+			ld	h,h
+			add	hl,hl
+			ld	c,e
+			ld	b,c
+			ld	a,h
+			push	de
+			ld	h,h
+			ret	nc
+			ld	e,d
+			xor	h
+			adc	a,(hl)
+			ld	h,(hl)
+			ld	l,d
+			nop (2x) *
+			halt
+			ret	pe
+			res	3,d
+			jp	pe,L131d
+			sbc	a,7ch
+			ex	de,hl
+			cp	e
+			sub	h
+			ld	d,(hl)
+			cp	l
+			rlca
+			jr	L8bbf
+			db	5bh,9ch,98h,c4h,e1h,cah,fah,69h
+			db	0ah,dbh,a9h,a1h,b6h,b5h,dfh,f5h
+			db	a1h,91h,91h,5bh,53h,72h,4bh,93h
+			db	2eh,e8h,27h,90h,23h,81h,86h,a3h
+			db	29h,93h,90h,15h,1bh,feh,d0h,ech
+			db	72h,53h,66h,49h,0ch,98h,b8h,adh
+			db	1ch,f6h,fah,78h,5dh,b2h,85h,3dh
+			db	e5h,aeh,7bh,20h,1eh,76h,deh,32h
+			db	44h,fdh,b3h,deh,e8h,30h,c7h,e1h
+			db	f6h,ffh,98h,adh,bdh,1ah,adh,06h
+			db	c6h,8ah,1eh,8ah,cbh,2bh,7eh,96h
+			db	a9h,36h,35h,ffh,feh,aah,4ah,c8h
+			db	e4h,f3h,30h,08h,0ch,a7h,67h,08h
+			db	35h,5bh,b2h,8ah,24h,95h,64h,99h
+			db	15h,94h,4dh,79h,2eh,ddh,4fh,6ch
+			db	03h,1ch,20h,38h,06h,69h,45h,09h
+			db	bdh,f5h,10h,5ah,87h,2fh,26h,29h
+			db	5eh,53h,ech,bdh,bdh,b6h,96h,22h
+			db	b5h,cfh,c8h,11h,aeh,bdh,e4h,48h
+			db	81h,adh,2bh,4fh,7dh,37h,8ah,b2h
+			db	beh,25h,d8h,99h,94h,e0h,06h,72h
+			db	ebh,20h,7bh,2ch,6dh,fdh,54h,6fh
+			db	45h,d9h,a7h,6bh,a1h,2ch,41h,4ah
+			db	3eh,a1h,7eh,beh,a1h
+			ld	e,h
+			cp	h
+			ld	b,e
+			ex	af,af'
+			nop (2x) *
+			ld	a,e
+			ld	d,1ch
+			inc	bc
+			ld	a,l
+			ld	l,h
+			ld	h,e
+			ld	c,l
+			add	a,d
+			ld	(bc),a
+			dec	d
+			ld	h,c
+			and	f9h
+			rrca
+			call	p,Le646
+			xor	e
+			djnz	L8cbb
+			nop
+			jp	po,L6bea
+			cp	b
+			ret	nz
+			ld	l,c
+			adc	a,c
+			ld	h,e
+			sbc	a,l
+			ret
+			db	bah,fch,c5h,9ah,03h,28h,27h,d8h
+			db	7ch,d5h,c0h,d3h,6dh,6ah,36h,34h
+			db	ceh,bah,cbh,29h,c3h,5ah,20h,d0h
+			db	03h,4dh,38h,14h,88h,d5h,34h,67h
+			db	2dh,deh,9bh,e0h,bah,d4h,7dh,46h
+			db	5bh,0fh,d7h,a9h,96h,8dh,94h,d0h
+			db	96h,abh,42h,c5h,25h,a7h,89h,a7h
+			db	9dh,bch,54h,82h,19h,cbh,b0h,5ch
+			db	52h,c4h,84h,35h,85h,80h,0eh,b7h
+			db	69h,6ah,ech,5eh,2dh,42h,48h,ddh
+			db	25h,36h,40h,17h,deh,7bh,dch,44h
+			db	17h,80h,94h,b0h,82h,d9h,c8h,eah
+			db	77h,6ch
+			inc	a
+			rst	00h
+			and	h
+			add	a,e
+			ld	a,(bc)
+			dec	a
+			ld	b,e
+			jp	(hl)
+			db	27h,43h,8bh,76h,18h,a7h,a9h,deh
+			db	beh,e5h,44h,7fh,83h,65h,13h,3bh
+			db	3fh,90h,ech,d9h,8dh,eah,37h,82h
+			db	afh,83h,2bh,91h,f9h,f1h,f0h,b9h
+			db	57h,32h,6dh,c5h,adh,6ch,9eh,f5h
+			db	bch,41h,e6h,47h,53h,6dh,2fh,a2h
+			db	15h,62h,44h,ech,23h,2bh,6ah,1dh
+			db	4ch,bah,f2h,eeh,7dh,e4h,d3h,45h
+			db	c1h,e9h,d5h,73h,c4h,a5h,9ah,98h
+			db	0fh,1ah,dbh,75h
+			ld	(hl),d
+			xor	c
+			xor	a
+			ld	b,c
+			dec	c
+			ld	c,f5h
+			ld	c,h
+			rst	38h
+			ld	(hl),d
+			in	a,(8dh)
+			ret
+			db	01h,71h,77h,0dh,26h,36h,b1h,8bh
+			db	13h,d4h,29h,e9h,b5h,64h,5ch,9bh
+			db	d6h,2dh,20h,b6h,43h,54h,52h,00h
+			db	d1h,c1h,31h,63h,23h,67h,22h,8dh
+			db	c4h,4dh,61h,b0h,52h,02h,8ah,ddh
+			db	6ch,84h,b2h,36h,2fh,54h,2dh,58h
+			db	ddh,f6h,6ch,50h,7fh,bfh,4ah,99h
+			db	12h,fdh,1dh,e2h,09h,6eh,34h,61h
+			db	cch,58h,17h,30h,56h,75h,9fh,09h
+			db	25h,f8h,7ch,f5h,87h,01h,f8h,c8h
+			db	12h,d6h,80h,17h,01h,b4h,60h,41h
+			db	1ch,40h,9bh,ceh,01h,3bh,96h,a8h
+			db	8bh
+			ld	a,e
+			ex	af,af'
+			jp	c,Laa32
+			inc	b
+			sbc	a,b
+			or	e
+			inc	e
+			dec	h
+			add	a,b
+			dec	sp
+			or	b
+			call	nc,La389
+			jp	(hl)
+			db	fch,1ah,a5h,79h,92h,21h,8eh,9dh
+			db	7dh,cch
+			adc	a,c
+			sub	e
+			call	c,L1160
+			jp	pe,Lf155
+			ld	sp,hl
+			sub	e
+			ld	d,e
+			ld	b,d
+			xor	b
+			sbc	a,d
+			halt
+			call	z,Lde71
+			sub	a
+			ld	l,l
+			ld	b,a
+			pop	hl
+			ld	h,(hl)
+			ld	h,(hl)
+			call	p,L20ae
+			adc	a,e
+			ld	l,(hl)
+			cp	b
+			cp	(hl)
+			ld	e,a
+			ld	c,b
+			ld	sp,ae0fh
+			ld	sp,hl
+			ei
+			xor	d
+			ld	(hl),d
+			and	h
+			ld	(03ach),a
+			ld	b,l
+			adc	a,h
+			ld	c,c
+			ld	d,d
+			jr	nz,L8e1e
+			add	a,h
+			sbc	a,c
+			rla
+			dec	h
+			ld	a,(hl)
+			ld	b,c
+			call	nz,L558a
+			ld	a,b
+			ld	sp,hl
+			inc	sp
+			adc	a,bch
+			adc	a,e
+			add	a,d
+			sub	(hl)
+			cp	e
+			call	m,La4f1
+			ld	h,b
+			ld	l,(hl)
+			ld	e,b
+			rst	00h
+			cp	(hl)
+			inc	e
+			ld	c,a
+			adc	a,64h
+			xor	1fh
+			ld	l,h
+			sub	e
+			ld	c,b
+			out	(40h),a
+			sub	h
+			exx
+			dec	hl
+			jr	c,L8e08
+			adc	a,b
+			ld	hl,4460h
+			and	73h
+			cp	a
+			cp	b
+			sub	c
+			or	0ch
+			ld	l,h
+			ret	po
+			ret	c
+			add	a,(hl)
+			dec	c
+			inc	a
+			res	0,b
+			add	hl,hl
+			dec	b
+			ld	h,(hl)
+			add	hl,hl
+			or	b
+			inc	d
+			rra
+			ld	c,d
+			inc	de
+			rst	10h
+			ld	d,a
+			daa
+			sbc	a,e
+			ld	(hl),h
+			scf
+			adc	a,l
+			jp	nc,L7156
+			ld	a,e
+			inc	b
+			ld	e,c
+			sbc	a,h
+			ret
+			db	dbh,32h,e3h,a1h,b4h,e1h,6eh,ffh
+			db	d9h,09h,26h,10h,13h,f8h,40h,61h
+			db	83h,50h,f6h,94h,2dh,afh,b2h,5ch
+			db	53h,a3h,f1h,7eh,e8h,9fh,c2h,14h
+			db	a2h,b1h,a2h,8fh,dfh,4fh,b3h,97h
+			db	15h,7bh,41h,efh,3fh,45h,c6h,2fh
+			ld	l,c
+			ld	b,a
+			ld	h,b
+			and	6ah
+			ld	d,l
+			dec	(hl)
+			ld	d,c
+			ld	e,h
+			or	l
+			in	a,(ddh)
+			ld	d,c
+			out	(8fh),a
+			ld	b,d
+			xor	c
+			nop (2x) *
+			ld	(hl),l
+			add	a,0ch
+			inc	h
+			rra
+			adc	a,60h
+			dec	d
+			ld	(de),a
+			dec	c
+			xor	29h
+			ld	(bc),a
+			add	hl,hl
+			ld	a,1eh
+			ld	e,a
+			xor	h
+			ld	c,l
+			or	a
+			sub	e
+			rst	38h
+			call	p,Lb12c
+			and	f6h
+			sub	e
+			push	af
+			ld	l,l
+			jr	c,L8ed5
+			nop (2x) *
+			call	po,Ld2b7
+			jp	pe,L0b94
+			ld	(hl),c
+			ld	(df66h),hl
+			add	a,a
+			di
+			ld	c,l
+			ld	b,b
+			dec	a
+			and	h
+			ld	e,79h
+			call	pe,Lc889
+			ld	(hl),a
+			and	l
+			add	a,d
+			jp	pe,L417e
+			ld	l,c
+			pop	af
+			dec	c
+			ld	b,h
+			ld	c,l
+			jp	La6df
+			db	3eh,37h,2ah,11h,3ah,27h,75h,cbh
+			db	8ch,83h,e6h,a2h,06h,37h,a8h,b5h
+			db	07h,42h,0bh,e5h,59h,e1h,f0h,0fh
+			db	f1h,52h,1dh,abh,66h,46h,50h,21h
+			db	45h,5ch,9bh,c6h,81h,90h,3ch,74h
+			db	bah,e7h,67h,37h,80h,29h,e9h,eeh
+			db	71h,3ah,61h,5ch,2eh,10h,94h,91h
+			db	55h,bah,cch,91h,d6h,f4h,2dh,c5h
+			db	bbh,03h,65h,04h,bch,b3h,b3h,90h
+			db	3eh,75h,68h,9ah,29h,67h,74h,fdh
+			db	feh,23h,fch,54h,18h,d2h,ffh,49h
+			db	5fh,97h,f6h,c2h,61h,bch,56h,f9h
+			db	43h,f6h,75h,a9h,80h,22h,04h,69h
+			db	f5h,7eh,50h,14h,10h,9bh,1ch,9dh
+			db	8eh,47h,23h,40h,c4h,a3h,5ah,d4h
+			db	83h,b7h,8bh,92h,a8h,3dh,20h,17h
+			db	35h,41h,a8h,fch,a7h,f5h,6fh,94h
+			db	1fh,0fh,8ch,57h,67h,1ah,44h,ceh
+			db	e8h,e7h,a8h,87h
+			ld	b,d
+			inc	c
+			ld	b,87h
+			xor	e
+			add	a,b
+			ld	e,e
+			push	hl
+			add	a,a
+			ld	d,d
+			ld	h,c
+			out	(9dh),a
+			exx
+			ld	(hl),c
+			ld	d,d
+			ld	d,(hl)
+			sub	(hl)
+			ld	(bc),a
+			ld	l,(hl)
+			add	a,e
+			ld	(hl),c
+			ccf
+			ld	h,e
+			ld	(hl),l
+			inc	l
+			call	L5b9b
+			dec	c
+			ex	af,af'
+			jp	m,L2c02
+			pop	af
+			sbc	a,a
+			add	hl,bc
+			ld	d,e
+			ld	(hl),b
+			cp	l
+			call	pe,L3853
+			or	c
+			sbc	a,d
+			jp	z,Lfa56
+			add	a,b
+			ret	m
+			di
+			rst	08h
+			jp	c,L9f89
+			ld	l,b
+			ld	(321dh),hl
+			dec	l
+			dec	(hl)
+			or	d
+			halt
+			dec	c
+			push	de
+			inc	bc
+			ld	sp,hl
+			sub	d
+			add	a,c
+			or	(hl)
+			ld	d,a
+			xor	d
+			push	af
+			or	c
+			push	hl
+			ld	d,0ch
+			ld	a,e
+			ld	h,d
+			ld	a,b
+			push	de
+			ld	d,l
+			jp	nz,L4290
+			ld	d,h
+			dec	de
+			ret	po
+			ld	(7bf4h),a
+			jp	p,L09d9
+			ld	e,42h
+			or	59h
+			ld	l,d
+			and	e
+			ld	de,2dech
+			ld	b,a
+			add	hl,de
+			add	a,b
+			ret	pe
+			inc	de
+			jp	(hl)
+			db	72h
+			add	hl,de
+			nop (2x) *
+			dec	de
+			add	a,l
+			ld	(hl),a
+			jr	z,L8fc1
+			ld	(1f1fh),a
+			add	a,c
+			sub	b
+			add	a,bch
+			ret	p
+			and	e
+			ld	(9ebbh),hl
+			jr	z,L9016
+			ld	de,425bh
+			ld	a,(hl)
+			add	a,b
+			ld	a,(de)
+			ld	a,a
+			call	p,Lacc9
+			sbc	a,c
+			rst	28h
+			cp	b
+			sub	(hl)
+			sbc	a,e
+			and	cch
+			ld	h,c
+			call	nc,Lc139
+			xor	l
+			ld	c,b
+			ld	(hl),d
+			ld	a,h
+			cp	l
+			add	a,l
+			adc	a,36h
+			rst	28h
+			ld	h,(hl)
+			ld	(hl),9eh
+			ld	e,d
+			sub	c
+			call	L4980
+			call	nc,L1a7b
+			and	d
+			and	l
+			sub	d
+			cp	3ah
+			add	a,l
+			dec	(hl)
+			adc	a,h
+			rrca
+			rst	08h
+			jp	m,Lb338
+			sub	a
+			sbc	a,8fh
+			ld	a,(hl)
+			ret	p
+			adc	a,c
+			ld	(hl),b
+			or	l
+			and	d
+			ld	l,h
+			xor	d
+			sub	h
+			or	e
+			ld	(6501h),a
+			add	hl,hl
+			add	hl,sp
+			cp	b
+			inc	de
+			ld	(de),a
+			ld	l,b
+			dec	e
+			call	p,Ld917
+			cp	l
+			ld	d,b
+			ld	l,a
+			dec	d
+			daa
+			cp	(hl)
+			ld	h,(hl)
+			adc	a,d
+			sub	b
+			adc	a,(hl)
+			rlca
+			sub	20h
+			and	(hl)
+			ld	bc,fb74h
+			ld	d,l
+			jr	c,L911b
+			pop	hl
+			ld	bc,7f52h
+			ld	d,c
+			dec	c
+			ret	z
+			add	a,b
+			cp	l
+			or	c
+			ld	(de),a
+			and	d
+			ld	b,c
+			and	b
+			ld	l,(hl)
+			ccf
+			ret	c
+			cp	bbh
+			ld	e,h
+			ld	b,b
+			ret	p
+			add	a,(hl)
+			ld	sp,hl
+			jr	L90bd
+			db	1ah,02h,0bh,66h,63h,c5h,d7h,68h
+			db	68h,c5h,14h,56h
+			ld	a,e
+			ld	sp,hl
+			ret	po
+			ret	nc
+			ld	d,4bh
+			ld	h,l
+			ld	b,5eh
+			sub	b
+			or	a
+			call	po,L2da2
+			add	a,b
+			ret	nc
+			inc	e
+			ld	a,c
+			ld	a,(hl)
+			ld	h,e
+			adc	a,h
+			add	a,h
+			or	l
+			cpl
+			and	l
+			ld	c,c
+			cp	d7h
+			ld	l,c
+			call	nc,Lb97e
+			ld	c,l
+			ret	po
+			sbc	a,e
+			ld	(bc),a
+			call	po,L1207
+			cpl
+			sub	e
+			ld	a,(bc)
+			jr	c,L90b9
+			ld	(bc),a
+			call	m,La391
+			ld	a,(ab37h)
+			dec	bc
+			rst	20h
+			ld	l,a
+			ld	e,c
+			ld	c,(hl)
+			ld	(hl),a
+			dec	d
+			push	af
+			rst	28h
+			cp	b
+			jp	L39fd
+			db	c5h,50h,f7h,4dh,e5h,6eh,a1h,5dh
+			db	0fh,adh,bch,c1h
+			and	b
+			ld	a,b
+			ld	l,l
+			adc	a,e
+			call	pe,L2102
+			add	a,e
+			add	hl,bc
+			ld	d,e
+			ex	de,hl
+			ld	de,db01h
+			ld	h,l
+			ld	c,h
+			dec	d
+			and	e
+			ld	h,b
+			ld	l,b
+			sbc	a,e
+			adc	a,h
+			dec	b
+			ld	b,h
+			add	hl,hl
+			ld	(hl),l
+			ei
+			ei
+			ld	h,b
+			ld	hl,5a89h
+			add	a,e
+			sbc	a,b
+			sub	h
+			sbc	a,c
+			sub	b
+			sbc	a,(hl)
+			or	h
+			ex	(sp),hl
+			ld	(bc),a
+			or	a
+			and	l
+			jr	L91ae
+			db	b5h,a1h,b2h,e2h,92h,0ch,7ch,f9h
+			db	c1h,d4h,fbh,0ah,81h,c5h,53h,41h
+			db	6ah,3ch,56h,d4h,b0h,a3h,3eh,39h
+			db	eah,4eh,6dh,35h,e6h,83h,bfh,6fh
+			push	bc
+			sbc	a,d
+			ld	c,d
+			in	a,(afh)
+			ld	a,b
+			pop	af
+			nop
+			xor	h
+			ld	c,d
+			ld	b,a
+			ret
+			db	2eh,a3h,bah,25h,17h,a0h,ech,c1h
+			db	76h,88h,fch,c1h,e5h,68h,edh,50h
+			db	0eh,4bh,7bh,1ah,2fh,6fh,63h,52h
+			db	3fh,57h,adh,e4h,d0h,b7h,1fh,adh
+			db	21h,beh,54h,93h,d8h,49h,c1h,cbh
+			db	4ah,69h,21h,4ah,bbh,42h,b9h,49h
+			db	c2h,d1h,14h,2dh,6dh,73h,c3h,b8h
+			db	05h,d8h
+			or	h
+			call	nz,L9eb1
+			ld	l,d
+			ld	h,d
+			call	c,L03b6
+			dec	sp
+			dec	e
+			sbc	a,a
+			ei
+			call	nc,L083e
+			inc	hl
+			adc	a,l
+			ld	b,e
+			cp	a
+			add	hl,hl
+			dec	de
+			ld	a,h
+			add	hl,de
+			or	b9h
+			ld	b,e
+			cp	a
+			ret	m
+			rst	18h
+			sub	55h
+			ld	c,e
+			ei
+			ld	(hl),a
+			ld	a,(hl)
+			ld	b,e
+			dec	bc
+			sbc	a,(hl)
+			push	hl
+			ld	l,(hl)
+			ld	h,c
+			dec	l
+			rra
+			cpl
+			ld	(hl),d
+			pop	bc
+			ld	a,l
+			call	c,L620c
+			ld	b,(hl)
+			add	a,b
+			push	de
+			ld	c,(hl)
+			ld	d,d
+			call	nz,L8452
+			ccf
+			ld	b,a
+			xor	e
+			xor	h
+			ex	af,af'
+			ld	c,b
+			ld	a,a
+			ld	(bc),a
+			set	5,b
+			ld	d,b
+			cp	a
+			ld	d,d
+			or	b
+			add	a,a
+			inc	hl
+			ld	d,l
+			adc	a,a
+			rst	30h
+			jp	po,Lac26
+			ld	d,l
+			ld	b,h
+			xor	19h
+			ld	c,9bh
+			add	hl,bc
+			ld	a,(hl)
+			ld	h,d
+			ld	h,c
+			sbc	a,d
+			inc	a
+			pop	hl
+			rlca
+			jr	z,L9209
+			ld	h,(hl)
+			ld	a,(0c6ch)
+			rlca
+			inc	hl
+			add	a,b
+			ld	e,d
+			nop
+			nop
+			inc	sp
+			ld	sp,hl
+			adc	a,h
+			rlca
+			sub	h
+			xor	a
+			jp	(hl)
+			db	f0h,8fh,24h,b9h,3ah,a3h,9ah,d1h
+			db	2dh,39h,f5h,08h,23h,79h,37h,e9h
+			db	c3h,cfh,c3h,11h,d2h,80h,5ah,e0h
+			db	5ch,edh,34h,4eh,86h,78h,3ch,01h
+			db	fbh,85h,94h,21h,7ah,fch,d9h,13h
+			db	e1h,60h,44h,fbh,58h,c1h,8ch,2eh
+			db	74h,d6h,dah,f3h,bfh,d6h,cfh,d9h
+			db	fah,5dh,92h,0ah,dch,efh,4bh,bbh
+			db	80h,69h,aah,35h,8fh,91h,0fh,bfh
+			db	dfh,d1h,0dh
+			dec	h
+			inc	l
+			ld	a,e
+			cpl
+			ld	l,a
+			exx
+			ld	sp,hl
+			xor	d
+			ld	c,d
+			ld	a,e
+			or	b
+			rst	28h
+			cp	c
+			ld	a,c
+			scf
+			ld	a,a
+			adc	a,b
+			nop (2x) *
+			call	p,L33ee
+			ld	b,(hl)
+			dec	hl
+			inc	d
+			sbc	a,b
+			cpl
+			ld	l,l
+			ld	e,e
+			push	bc
+			sbc	a,h
+			jp	po,Le9ba
+			ld	e,e
+			ld	h,h
+			ld	c,l
+			xor	bfh
+			jp	c,L50fe
+			rst	28h
+			dec	a
+			ld	b,b
+			jp	Lfad3
+			db	f5h,5ch,14h,5dh,15h,92h,83h,58h
+			db	a1h,9fh,e7h,69h,afh,9eh,36h,90h
+			db	d2h,a1h,38h,f5h,cbh,3eh,4dh,52h
+			db	afh,a2h,e3h,58h,4fh,09h,ddh,78h
+			db	48h,cch,55h,c5h,61h,40h,bch,c1h
+			db	2ah,5ah,28h,17h,e7h,aeh,f5h,41h
+			db	f9h,2dh,03h,cbh,75h,53h,4ah,a4h
+			db	dfh,e4h,86h,0ch,cbh,c3h,04h,e7h
+			db	69h,64h,7fh,26h,fch,9bh,68h,f0h
+			db	62h,73h,95h,cbh,46h,16h,1ch,d0h
+			db	77h
+			dec	e
+			adc	a,a
+			inc	sp
+			call	nz,L28f6
+			cp	e
+			ld	d,h
+			and	b
+			di
+			ret	p
+			dec	hl
+			inc	a
+			ld	h,abh
+			or	e
+			call	nc,L0ec4
+			ld	h,4fh
+			ld	d,(hl)
+			rst	30h
+			rla
+			ld	c,7dh
+			ccf
+			cp	d
+			sbc	a,l
+			ld	h,d
+			rrca
+			cp	e
+			rrca
+			rst	20h
+			adc	a,4bh
+			ld	h,l
+			xor	(hl)
+			add	a,d
+			ld	l,d
+			ld	h,d
+			and	l
+			cp	h
+			ld	b,d
+			ld	a,(1d85h)
+			and	b
+			rlca
+			rla
+			ld	d,a
+			ld	hl,1d21h
+			jp	nc,L0cc9
+			ld	(hl),a0h
+			ld	a,l
+			or	c
+			adc	a,l
+			dec	e
+			ld	b,b
+			bit	4,e
+			ret	nc
+			and	e
+			ld	d,l
+			ld	(hl),a
+			sbc	a,(hl)
+			ld	b,b
+			adc	a,e
+			xor	a
+			dec	b
+			rra
+			ld	c,e
+			pop	hl
+			rla
+			and	h
+			halt
+			or	h
+			sbc	a,h
+			inc	bc
+			jp	nc,L7ccd
+			ld	(de),a
+			sbc	a,(hl)
+			ld	hl,0510h
+			ld	l,a
+			pop	de
+			jr	nz,L92eb
+			ld	d,a
+			ld	a,adh
+			add	hl,de
+			ld	c,13h
+			adc	a,(hl)
+			ld	b,d
+			or	h
+			adc	a,c
+			cp	b
+			jr	c,L9381
+			jr	c,L935c
+			add	hl,bc
+			ld	h,d
+			jp	z,L6c7e
+			ld	b,(hl)
+			ld	a,h
+			jr	nz,L93df
+			ld	h,(hl)
+			ld	(hl),c
+			ld	d,h
+			inc	e
+			inc	h
+			ld	l,d
+			add	a,l
+			sub	b
+			ld	h,b
+			ret	pe
+			jr	z,L9320
+			rrca
+			rst	18h
+			or	l
+			ld	b,b
+			adc	a,e
+			ex	af,af'
+			ld	bc,b1b5h
+			inc	l
+			jr	nc,L9379
+			ld	(hl),h
+			sbc	a,l
+			inc	a
+			ld	b,a
+			cp	b
+			in	a,(6ch)
+			inc	(hl)
+			ld	a,92h
+			ld	hl,01efh
+			ld	a,h
+			nop
+			ld	b,4ch
+			ld	hl,(8222h)
+			set	4,a
+			cp	e
+			jr	z,L93e9
+			ld	a,(5207h)
+			ld	l,55h
+			cp	b
+			push	bc
+			ld	a,e
+			dec	c
+			and	l
+			adc	a,d
+			ld	c,(hl)
+			ld	h,c
+			push	hl
+			ld	h,b
+			cp	a
+			ld	a,c
+			sbc	a,d
+			nop (2x) *
+			ld	c,d
+			ld	c,a
+			ld	a,d
+			and	h
+			cp	c
+			ld	l,e
+			adc	a,a
+			cp	e
+			and	l
+			sbc	a,4eh
+			ld	a,(de)
+			cp	a
+			call	p,L6cd3
+			rst	08h
+			add	a,e
+			sbc	a,h
+			ld	b,c
+			ld	d,c
+			jp	c,L8b76
+			ex	de,hl
+			jp	pe,Lb387
+			jp	po,L5ee7
+			ld	a,(hl)
+			ld	c,c
+			jr	nc,L93aa
+			di
+			ld	e,e
+			ld	l,l
+			jr	c,L942e
+			jp	nz,Lcac6
+			sub	d
+			add	hl,de
+			sbc	a,d
+			ld	e,e
+			adc	a,(hl)
+			dec	b
+			call	m,L7421
+			cp	h
+			ret	nz
+			ret	p
+			inc	hl
+			dec	e
+			inc	de
+			ld	e,c
+			adc	a,b
+			ld	e,c
+			inc	bc
+			ld	c,b
+			ld	e,l
+			ld	(bc),a
+			sub	a
+			cp	h
+			inc	h
+			ld	sp,hl
+			and	bbh
+			ld	h,(hl)
+			ld	c,c
+			djnz	L93df
+			call	nz,L2867
+			or	b
+			ld	a,(bc)
+			rst	00h
+			ld	(de),a
+			xor	c
+			xor	c
+			ld	l,l
+			ld	a,(ad0ah)
+			adc	a,e
+			xor	(hl)
+			ld	c,(hl)
+			jp	p,Lb327
+			ret	z
+			cpl
+			inc	sp
+			or	d
+			ld	d,b
+			out	(afh),a
+			ld	hl,b5a3h
+			sbc	a,f8h
+			ld	(hl),a
+			ld	b,l
+			ld	hl,c499h
+			scf
+			ld	a,(f26eh)
+			ld	h,l
+			or	c
+			sub	l
+			rst	20h
+			ld	d,d
+			add	hl,hl
+			dec	hl
+			ld	h,(hl)
+			ld	c,86h
+			jp	po,L67cd
+			ccf
+			xor	c4h
+			cp	c
+			and	(hl)
+			add	a,b
+			inc	de
+			inc	e
+			xor	b
+			adc	a,e
+			sbc	a,b
+			cpl
+			jr	nc,L9403
+			ld	b,b
+			dec	(hl)
+			ld	c,c
+			inc	e
+			ld	d,h
+			ld	b,l
+			pop	de
+			inc	(hl)
+			rst	20h
+			ld	e,b
+			ex	de,hl
+			ld	h,e
+			dec	h
+			ld	l,b
+			dec	bc
+			rrca
+			sbc	a,e
+			and	c1h
+			ld	h,l
+			dec	e
+			jr	c,L9417
+			sub	b
+			rst	38h
+			ex	(sp),hl
+			ld	c,d
+			ld	d,a
+			exx
+			cp	l
+			ld	sp,hl
+			add	a,l
+			ld	b,d
+			ld	d,a
+			ex	de,hl
+			rst	20h
+			ld	c,h
+			ex	de,hl
+			ld	d,21h
+			sbc	a,l
+			dec	d
+			jp	(hl)
+			db	e7h,d8h,b8h,ddh,25h,f3h,4eh,27h
+			db	25h,24h,5ah
+			dec	bc
+			adc	a,d
+			adc	a,8fh
+			add	a,l
+			ld	b,a
+			nop (2x) *
+			adc	a,66h
+			add	hl,sp
+			adc	a,h
+			jp	nc,L6b82
+			ld	l,h
+			call	p,L1305
+			cp	e
+			ld	l,(hl)
+			adc	a,c
+			ld	c,b
+			ld	h,b
+			in	a,(6eh)
+			or	b
+			ret	po
+			cp	b
+			cp	34h
+			dec	sp
+			sbc	a,c
+			rst	28h
+			ld	hl,(25eeh)
+			ld	h,h
+			ld	c,e
+			or	(hl)
+			adc	a,d
+			add	hl,sp
+			ld	a,(de)
+			cp	(hl)
+			rst	30h
+			inc	e
+			sbc	a,h
+			xor	b
+			ld	b,a
+			ld	c,e
+			ld	c,a
+			sub	h
+			ld	(bc),a
+			call	p,Lccbb
+			xor	c
+			ld	hl,9eeah
+			ld	c,h
+			cp	a
+			add	a,c
+			pop	bc
+			ld	d,h
+			ld	b,h
+			sub	e
+			ld	a,h
+			push	bc
+			sub	b
+			ld	e,(hl)
+			sbc	a,c
+			and	(hl)
+			or	c
+			rra
+			cp	20h
+			inc	c
+			ld	(hl),l
+			pop	af
+			push	bc
+			ld	bc,96e0h
+			cp	(hl)
+			ld	l,(hl)
+			pop	hl
+			sbc	a,h
+			sbc	a,h
+			ex	de,hl
+			ld	d,d
+			dec	hl
+			ld	l,h
+			and	(hl)
+			ld	b,fbh
+			add	a,e
+			jr	nz,L94c6
+			call	c,L90d1
+			ld	hl,fb03h
+			add	a,d
+			cp	e
+			or	b
+			call	nz,Lf9ab
+			jp	z,La2c4
+			ld	c,b
+			sub	b
+			adc	a,c
+			or	h
+			rst	10h
+			sbc	a,d
+			ld	a,a
+			ld	l,e
+			call	z,L2cc7
+			adc	a,b
+			ld	b,b
+			call	nz,L5a53
+			cpl
+			add	a,l
+			di
+			pop	de
+			sbc	a,b
+			ld	l,d
+			nop
+			xor	beh
+			ld	b,c
+			ld	e,b
+			cp	e
+			rst	00h
+			sbc	a,b
+			ld	e,l
+			ld	a,(de)
+			and	20h
+			or	c
+			inc	(hl)
+			ld	l,l
+			ld	h,a
+			xor	c
+			daa
+			sub	b
+			push	bc
+			ld	b,b
+			ld	a,e
+			exx
+			jp	c,L946e
+			or	(hl)
+			pop	hl
+			add	hl,hl
+			ld	sp,hl
+			dec	bc
+			call	po,L8a5f
+			ld	h,d
+			inc	e
+			adc	a,a
+			or	d
+			ld	l,36h
+			ld	b,h
+			rst	08h
+			ld	l,b
+			ld	c,d
+			djnz	L957b
+			dec	bc
+			ld	de,1895h
+			dec	de
+			add	a,d
+			ld	a,b
+			ex	af,af'
+			ld	c,d
+			ld	a,(a4bch)
+			ld	h,83h
+			ld	c,l
+			pop	hl
+			dec	e
+			and	03h
+			ld	(hl),l
+			sub	l
+			ld	d,h
+			and	e
+			ei
+			xor	3ah
+			inc	de
+			dec	d
+			djnz	L95a9
+			rst	10h
+			ld	c,77h
+			ld	a,20h
+			daa
+			nop (2x) *
+			sub	d
+			sub	d
+			rra
+			or	(hl)
+			out	(1eh),a
+			pop	bc
+			ld	e,h
+			ld	c,e
+			sbc	a,l
+			ld	c,h
+			sub	e
+			xor	l
+			ld	hl,eb85h
+			inc	h
+			dec	c
+			ld	l,e
+			ld	l,d
+			rst	00h
+			inc	d
+			cp	a
+			ex	af,af'
+			ld	e,e
+			nop
+			sbc	a,e
+			dec	sp
+			ld	a,l
+			ld	e,h
+			ld	c,a
+			nop
+			ld	(de),a
+			jp	(hl)
+			db	93h,1ah,7bh,40h,1dh,62h,1ah,fbh
+			db	e7h,2bh,e9h,e4h,f6h,16h,dah,a1h
+			db	2ah,8ah,06h,6dh
+			call	L2893
+			sub	h
+			exx
+			ld	e,c
+			sub	l
+			rst	30h
+			cp	l
+			ld	a,(hl)
+			ld	l,d
+			push	de
+			halt
+			add	a,h
+			ld	(hl),b
+			ld	h,(hl)
+			adc	a,h
+			inc	sp
+			push	af
+			ld	a,l
+			ld	l,b
+			add	a,b
+			ret	nc
+			ld	bc,70fah
+			rst	38h
+			ld	(hl),c
+			adc	a,(hl)
+			ret
+			db	f7h,39h,f9h,37h,20h,fbh,2bh,3dh
+			db	68h,54h,8ch,43h,d6h,e6h,d0h,8fh
+			ld	c,c
+			sbc	a,l
+			pop	bc
+			ld	b,e
+			dec	h
+			dec	(hl)
+			jp	pe,L9f66
+			jp	z,L5ae9
+			ld	a,l
+			inc	l
+			ld	a,(2319h)
+			in	a,(15h)
+			or	a
+			ld	c,c
+			dec	bc
+			rrca
+			rst	00h
+			ld	b,h
+			ld	d,(hl)
+			ld	l,d
+			jr	z,L9614
+			ld	l,38h
+			adc	a,l
+			ld	h,b
+			ld	a,c
+			ld	l,b
+			ld	l,c
+			ld	e,d
+			adc	a,e
+			inc	bc
+			xor	e
+			sub	(hl)
+			rla
+			and	e
+			ret
+			db	e7h,19h,e4h,8ch,24h,74h,47h,7ah
+			db	dah,b4h,71h,d1h,93h,5eh,0fh,19h
+			db	12h,2bh,7fh,00h,0eh,5ch,4fh,c4h
+			db	2eh,b3h,deh,65h,65h,a1h,87h,c7h
+			db	3eh,d5h,0ah,e4h,adh,8ah,81h,94h
+			db	77h,d7h,31h,4ch,9dh,5dh,c2h
+			sbc	a,a
+			ld	a,d
+			inc	c
+			in	a,(bfh)
+			ld	d,h
+			adc	a,l
+			sub	c
+			or	a
+			ld	h,e
+			xor	h
+			ret	nz
+			inc	l
+			inc	hl
+			ret	m
+			adc	a,a
+			or	80h
+			push	bc
+			djnz	L95c9
+			adc	a,d
+			cp	l
+			ld	e,(hl)
+			or	d
+			call	nc,L7c64
+			xor	b
+			ex	de,hl
+			sub	b
+			jr	c,L9604
+			ld	b,h
+			ex	af,af'
+			dec	bc
+			sub	e
+			add	a,d
+			inc	l
+			daa
+			dec	d
+			ld	(hl),b
+			jp	z,L58de
+			ld	d,l
+			or	l
+			rlca
+			ld	c,l
+			or	a
+			add	a,e
+			sub	e
+			ld	d,c
+			exx
+			adc	a,b
+			push	af
+			sbc	a,l
+			inc	hl
+			rst	38h
+			sub	b
+			rst	10h
+			add	hl,de
+			ld	e,c
+			inc	a
+			dec	hl
+			ld	e,a
+			ret	c
+			jr	z,L96bb
+			or	(hl)
+			xor	c
+			ld	d,b
+			rst	20h
+			cp	l
+			ld	d,4bh
+			and	d
+			cp	e
+			add	a,e
+			ld	a,h
+			ld	c,c
+			ld	l,l
+			jp	p,L3537
+			sub	l
+			cp	l
+			adc	a,e
+			or	h
+			rla
+			ld	c,h
+			ld	a,a
+			ld	l,l
+			jr	z,L9678
+			dec	e
+			dec	c
+			ld	bc,f197h
+			sbc	a,c
+			or	(hl)
+			nop (2x) *
+			ld	e,c
+			ld	c,l
+			adc	a,l
+			ld	e,(hl)
+			cp	b
+			and	d
+			jr	c,L96a1
+			sbc	a,h
+			dec	(hl)
+			ld	(hl),e
+			call	po,Ldab6
+			ld	(hl),h
+			ld	l,c
+			or	(iy + 0bh)
+			ld	b,4eh
+			dec	e
+			ld	c,(hl)
+			or	d
+			ei
+			ld	c,c
+			ld	e,c
+			ld	e,(iy + d1h)
+			rst	20h
+			ret	p
+			ld	c,h
+			sub	l
+			jp	pe,Lcc1a
+			jp	nc,L83b9
+			add	a,l
+			sbc	a,1dh
+			ld	c,a
+			ld	h,l
+			ld	a,c
+			and	b
+			sub	l
+			bit	1,e
+			add	a,4ah
+			djnz	L9685
+			ld	l,d
+			halt
+			dec	l
+			ld	c,c
+			ld	(hl),d
+			ld	h,l
+			add	a,e
+			dec	c
+			ld	a,b
+			ld	l,l
+			ld	l,(hl)
+			exx
+			ld	c,d
+			ld	a,c
+			sub	d
+			ld	sp,hl
+			ld	h,h
+			inc	a
+			pop	hl
+			ld	c,d
+			nop
+			ld	(e8c0h),hl
+			dec	c
+			push	de
+			dec	c
+			in	a,(5bh)
+			adc	a,47h
+			ld	c,e
+			ex	de,hl
+			ld	l,h
+			push	bc
+			ld	b,d
+			inc	a
+			ld	c,b
+			ret	pe
+			ld	h,(hl)
+			dec	b
+			call	c,L570f
+			sub	(hl)
+			call	Lb00b
+			ret	c
+			ld	e,b
+			dec	(hl)
+			and	l
+			rst	28h
+			ld	(8176h),hl
+			rla
+			add	a,(hl)
+			ld	c,l
+			ld	(hl),95h
+			inc	bc
+			call	p,L11ce
+			cp	(hl)
+			ld	l,d
+			adc	a,e
+			ld	a,a
+			cp	a
+			push	bc
+			call	p,L6fad
+			dec	c
+			dec	e
+			ld	b,h
+			scf
+			ld	de,e1d8h
+			ld	a,b
+			and	l
+			ld	a,(de)
+			inc	e
+			ret	nc
+			push	af
+			ld	bc,5dafh
+			rst	18h
+			jp	nz,Lb7e6
+			ld	l,a
+			pop	af
+			halt
+			ld	c,h
+			sbc	a,h
+			ld	c,h
+			ld	l,(hl)
+			sbc	a,e
+			ret	pe
+			nop (2x) *
+			ld	(hl),l
+			sub	e
+			rst	00h
+			ld	c,d
+			ld	sp,1fa9h
+			ld	a,(edfch)
+			and	d
+			ld	c,c
+			call	nc,L2361
+			ld	b,l
+			ld	l,l
+			ld	a,(de)
+			or	e
+			and	d
+			inc	e
+			jp	m,Lfe46
+			add	a,e
+			sbc	a,91h
+			ld	b,b
+			jp	(hl)
+			db	e0h,70h,39h,43h
+			ld	h,(hl)
+			sub	a
+			cp	d
+			ret
+			db	3bh,40h,a0h,72h,5eh,50h,b7h,e0h
+			db	66h,35h,41h
+			inc	b
+			inc	(hl)
+			jr	nc,L9753
+			ld	l,d
+			out	(1fh),a
+			nop (2x) *
+			ld	c,l
+			dec	bc
+			ret	po
+			ld	b,39h
+			or	d
+			add	a,d
+			inc	l
+			adc	a,l
+			jp	nz,L1fb4
+			ld	(hl),fch
+			adc	a,b
+			halt
+			dec	a
+			jp	Leff9
+			db	8bh,9dh,65h,e2h,13h,0dh,20h,23h
+			db	7eh,b0h,53h,86h,e1h,4bh,cah,fdh
+			db	a4h,38h,4dh,40h,a6h,5fh,9fh,7ch
+			db	42h,01h,e1h,82h,70h,e6h,0dh,0fh
+			db	bdh,e6h,82h,f1h,86h,78h,6bh,8eh
+			db	6eh,6ch,3fh,bdh,7bh,bah,65h,abh
+			db	6bh,44h,74h,81h,dfh,a4h,b9h,89h
+			db	53h,90h,07h,adh,3dh,77h,b3h,46h
+			db	03h,bfh,d6h,38h,81h,ach,efh,20h
+			db	7fh,89h,04h,6ah,b0h,c9h,95h,5ah
+			db	a9h,0ch,c4h,24h,0eh,abh,dbh,e0h
+			db	efh,dfh,38h,9ah,c6h,a7h,8bh,5ch
+			db	46h,1dh,7bh,5bh,0ch,37h,6bh,38h
+			db	08h,6fh,1fh,c8h,fdh,8fh,feh,30h
+			db	b7h,dch,56h,8dh,ech,3bh,f5h,e9h
+			db	42h,51h,92h,92h,f9h,27h,cdh,4ch
+			db	6bh,efh,beh
+			rst	10h
+			or	e
+			ld	l,b
+			ld	b,d
+			ret	p
+			out	(f2h),a
+			add	hl,de
+			adc	a,e
+			ld	sp,hl
+			and	e
+			ld	hl,384ah
+			di
+			ld	c,e
+			cp	h
+			jr	c,L984c
+			xor	5ah
+			ld	e,b
+			ld	a,d
+			ld	a,c
+			cp	c
+			call	z,Lf121
+			ld	h,l
+			and	h
+			adc	a,(hl)
+			ld	(hl),d
+			sbc	a,l
+			ld	d,c
+			jp	nc,L46b3
+			ex	de,hl
+			jp	Ld6bd
+			db	90h,99h,8fh,2dh,48h,83h,07h,57h
+			db	0ch,a0h,fch,eah,45h,e1h,46h,71h
+			db	23h,5dh
+			ld	h,a
+			sub	d
+			xor	c
+			scf
+			ld	(de),a
+			add	a,c
+			adc	a,(hl)
+			ld	l,l
+			sub	e
+			add	a,a
+			ld	h,b
+			cp	c
+			xor	(hl)
+			ld	e,e
+			cp	l
+			and	c
+			add	a,c
+			dec	a
+			jp	pe,L7c30
+			ld	e,b
+			inc	l
+			cpl
+			jp	pe,L8d95
+			inc	bc
+			ld	l,e8h
+			ld	hl,4d6fh
+			push	af
+			or	5dh
+			ld	a,e
+			ld	e,f6h
+			call	nc,Lf650
+			ret	m
+			pop	bc
+			ld	a,93h
+			add	a,a
+			cp	c
+			sub	a
+			ret	m
+			push	de
+			add	a,e
+			djnz	L97db
+			ld	l,b
+			add	a,l
+			ld	a,a
+			xor	h
+			sbc	a,25h
+			ld	l,b
+			ld	b,b
+			pop	bc
+			dec	b
+			ld	e,a
+			xor	59h
+			cp	l
+			nop (2x) *
+			ld	d,c
+			cp	(hl)
+			inc	(hl)
+			ld	de,737ch
+			jr	z,L981e
+			call	pe,L16de
+			scf
+			call	p,Ldcbe
+			sub	(hl)
+			ld	(hl),c
+			jp	po,L5ccd
+			inc	a
+			ld	c,d
+			ld	e,(hl)
+			ld	(hl),h
+			ld	d,b
+			ld	d,l
+			add	a,c
+			pop	de
+			adc	a,d
+			jr	nc,L98c5
+			rst	30h
+			xor	l
+			inc	bc
+			and	h
+			adc	a,e
+			or	b
+			ld	c,(hl)
+			rst	28h
+			ex	(sp),hl
+			xor	d
+			scf
+			call	po,L5268
+			inc	(hl)
+			inc	e
+			sub	a
+			add	hl,sp
+			ld	hl,6c12h
+			ld	d,(hl)
+			adc	a,l
+			add	a,b
+			and	b
+			ld	d,a
+			ld	sp,dae1h
+			ld	de,20e2h
+			cp	e
+			ld	d,c
+			add	a,a
+			and	l
+			or	b
+			rst	18h
+			ld	h,b
+			xor	c
+			or	12h
+			add	a,(hl)
+			ret	pe
+			sbc	a,b
+			adc	a,h
+			jr	z,L98a6
+			ret	nz
+			and	l
+			or	aeh
+			cp	a
+			pop	hl
+			jp	nc,L78d5
+			ld	h,c
+			jr	c,L9844
+			ld	l,h
+			inc	a
+			ld	a,(131bh)
+			call	Ldc43
+			add	a,b
+			ld	hl,eda0h
+			ret
+			db	8ch
+			ld	b,e
+			add	a,c
+			ld	a,b
+			inc	a
+			dec	bc
+			add	hl,de
+			res	1,e
+			sub	h
+			ld	d,45h
+			jr	L98a0
+			db	b4h,93h,85h,ach,bdh,0fh,10h,43h
+			db	89h,51h,82h,a8h,b6h,0eh,f4h,1eh
+			db	a0h,2dh,20h,54h,7bh,88h,1eh,4ch
+			db	a2h,97h,91h,c3h
+			cp	(hl)
+			ld	a,(hl)
+			rst	30h
+			inc	b
+			sbc	a,l
+			jr	nz,L98c8
+			or	l
+			ld	b,d
+			or	e
+			ld	b,d
+			xor	a
+			sbc	a,b
+			adc	a,edh
+			ccf
+			ret	z
+			adc	a,d
+			sbc	a,c
+			ld	d,h
+			pop	hl
+			add	hl,bc
+			cp	b
+			push	hl
+			ld	b,7fh
+			cp	eah
+			inc	(hl)
+			sbc	a,e
+			call	nz,L057d
+			add	a,e
+			jp	z,L6adf
+			ld	l,cdh
+			cp	l
+			ld	l,b
+			daa
+			cp	e
+			ccf
+			jr	nc,L98cd
+			scf
+			ld	sp,31b9h
+			sbc	a,l
+			ld	b,c
+			push	bc
+			inc	sp
+			ld	e,e
+			call	c,L551d
+			ld	l,a
+			adc	a,(hl)
+			ld	e,l
+			xor	d
+			add	hl,bc
+			xor	d
+			dec	b
+			and	c
+			ld	e,a
+			add	a,l
+			ld	b,a
+			call	pe,L5372
+			ex	af,af'
+			xor	1bh
+			add	hl,sp
+			add	a,c
+			ccf
+			ld	b,a
+			sub	(hl)
+			or	69h
+			ld	(hl),b
+			and	a
+			ld	a,(de)
+			and	l
+			ld	a,l
+			ld	h,bbh
+			rst	10h
+			ld	h,l
+			add	hl,bc
+			add	hl,de
+			sub	a
+			ld	c,h
+			ld	h,c
+			sbc	a,d
+			ld	d,b
+			xor	94h
+			rst	30h
+			ccf
+			xor	e
+			ld	c,a
+			sub	h
+			rst	08h
+			ld	a,(bc)
+			pop	de
+			ld	b,d
+			daa
+			ld	d,d
+			ld	b,a
+			ld	h,l
+			ld	(hl),e
+			ld	h,e
+			jr	nc,L9994
+			push	bc
+			or	dfh
+			ld	hl,50e4h
+			ld	(0c5ch),a
+			cp	a
+			ld	b,a
+			out	(1ah),a
+			cp	h
+			ret
+			db	41h,72h,2ah,f1h,71h,00h,36h,65h
+			db	69h,2ah,03h,cfh,52h,a4h,93h,66h
+			db	cfh,a5h,57h,b1h,07h,93h,d5h,60h
+			db	a8h,41h,8bh,d6h,86h,85h,1fh,2fh
+			db	cdh,75h
+			ld	l,e
+			xor	h
+			ld	d,b
+			pop	hl
+			ld	e,a
+			sbc	a,c
+			or	c
+			ld	de,68b5h
+			and	c4h
+			add	a,5dh
+			dec	b
+			dec	hl
+			xor	l
+			ld	h,e
+			ld	l,6eh
+			sbc	a,l
+			ld	h,(hl)
+			ld	a,c
+			ld	h,(hl)
+			ld	a,c
+			or	a
+			ld	a,h
+			xor	e
+			rla
+			ld	e,h
+			sub	h
+			or	(hl)
+			inc	c
+			ld	l,d
+			sbc	a,l
+			exx
+			res	4,d
+			ld	(hl),c2h
+			ld	b,b
+			ld	bc,57f1h
+			jr	nc,L99ab
+			ld	d,(hl)
+			ld	l,(hl)
+			add	a,e
+			ld	b,h
+			ld	c,b
+			pop	af
+			ret	nc
+			sub	e
+			jp	z,Lc27b
+			dec	de
+			call	pe,Lf19f
+			nop (2x) *
+			push	bc
+			out	(58h),a
+			cp	b
+			cp	a1h
+			inc	bc
+			ld	a,b
+			ld	(bc),a
+			rst	18h
+			and	4ah
+			cp	b
+			ld	(hl),b
+			call	p,Ldb8a
+			ld	(bc),a
+			add	a,l
+			jp	(hl)
+			pop	de
+			ret	z
+			call	z,L55f9
+			ld	b,h
+			xor	h
+			add	a,d
+			sub	42h
+			jp	pe,Lb132
+			call	m,Lbfea
+			ld	c,d
+			jp	nz,Lb039
+			sub	e
+			adc	a,l
+			call	p,L8cba
+			ld	e,c
+			di
+			ld	d,e
+			nop (2x) *
+			jr	nz,L9a6b
+			ret	p
+			ret	po
+			ld	b,d
+			pop	hl
+			ex	de,hl
+			and	e
+			pop	hl
+			inc	e
+			di
+			sbc	a,a
+			or	d
+			ld	b,(hl)
+			adc	a,6ch
+			and	(hl)
+			ld	a,b
+			ld	e,d
+			ld	(hl),e
+			ld	l,d
+			ld	(hl),56h
+			pop	de
+			ld	bc,97aah
+			ex	de,hl
+			ret	c
+			push	bc
+			ld	e,e
+			ld	a,d
+			ld	a,d
+			ld	sp,hl
+			ld	c,(hl)
+			push	af
+			ld	l,(hl)
+			ld	d,l
+			cpl
+			dec	hl
+			xor	14h
+			ld	l,l
+			dec	h
+			djnz	L9a51
+			rst	20h
+			sbc	a,(hl)
+			and	(hl)
+			ld	c,04h
+			rla
+			and	h
+			pop	bc
+			ld	e,05h
+			sub	c
+			jp	c,Lb084
+			ld	c,b
+			jp	nz,L124f
+			jr	L9a80
+			db	04h,50h,77h,bfh,bbh,b1h,87h,21h
+			db	f8h,57h,d6h
+			sub	e
+			jr	nz,L9a6a
+			di
+			ld	(hl),abh
+			inc	e
+			nop (2x) *
+			ld	e,d
+			jr	c,L9aa6
+			or	l
+			pop	bc
+			daa
+			sbc	a,a
+			push	hl
+			cp	7ah
+			ld	l,efh
+			ld	l,e
+			inc	e
+			jp	z,L643f
+			ld	(hl),c
+			dec	(hl)
+			call	c,L009b
+			ld	h,b1h
+			xor	b
+			ld	l,b5h
+			ld	d,e
+			ld	hl,8bb9h
+			ld	a,e
+			ld	(bc),a
+			cp	d
+			inc	l
+			ld	a,a
+			inc	bc
+			add	a,b
+			rst	10h
+			ret	p
+			sub	a
+			ld	e,b
+			add	a,(hl)
+			ld	c,e
+			out	(65h),a
+			ld	a,ebh
+			ccf
+			ld	e,c
+			or	71h
+			sub	l
+			pop	af
+			adc	a,h
+			add	a,f2h
+			exx
+			ld	h,a
+			rst	18h
+			ret	pe
+			push	de
+			ld	a,a
+			sub	l
+			and	(hl)
+			add	hl,de
+			rrca
+			jr	L9a89
+			db	d9h,29h,b4h,feh,0ch,e6h
+			dec	bc
+			ld	c,c
+			ld	a,d
+			or	h
+			ld	(hl),d
+			sub	h
+			and	d
+			adc	a,c
+			ld	(hl),e
+			ld	h,l
+			add	a,d
+			djnz	L9aa4
+			pop	de
+			jp	po,L01e4
+			ld	h,a
+			ld	(hl),e
+			ld	d,d
+			add	a,l
+			and	e
+			or	e0h
+			ld	(hl),h
+			call	c,L135f
+			cp	(hl)
+			ld	h,b
+			cp	c
+			and	(hl)
+			ld	l,h
+			ld	e,c
+			call	m,L447b
+			call	nz,L11fc
+			ret	z
+			dec	de
+			ld	l,(hl)
+			jp	m,L4c51
+			ld	h,d
+			add	hl,sp
+			ld	(hl),c
+			ld	bc,8b5dh
+			ret	c
+			or	b
+			xor	a
+			ld	d,c
+			di
+			ld	a,(775eh)
+			inc	l
+			ld	d,d
+			inc	(hl)
+			ld	l,(hl)
+			jr	nc,L9b62
+			inc	h
+			and	a
+			and	b
+			cp	e
+			rrca
+			ld	h,c
+			pop	bc
+			ld	l,e
+			xor	h
+			xor	b9h
+			cp	l
+			and	d
+			and	h
+			ld	c,d
+			sbc	a,l
+			add	hl,sp
+			ld	(hl),bah
+			add	a,c
+			sub	e
+			adc	a,c
+			ld	d,a
+			ex	(sp),hl
+			ld	e,h
+			or	h
+			dec	de
+			inc	e
+			ld	a,c3h
+			push	hl
+			sbc	a,(hl)
+			ld	c,89h
+			ld	d,a
+			xor	l
+			ld	h,b
+			jp	L59b5
+			db	16h,ebh,20h,17h,9bh,d5h,a7h,c7h
+			db	8eh,43h,08h,98h,38h,80h,d5h,5ah
+			db	05h,c1h,49h,03h,ebh,42h,75h,a1h
+			db	9eh,66h,fch,1ah,6dh,86h
+			dec	a
+			call	pe,L2d87
+			ret	z
+			ld	sp,hl
+			rst	10h
+			ld	h,e
+			push	bc
+			pop	af
+			and	l
+			ex	(sp),hl
+			inc	d
+			adc	a,d
+			ld	a,(hl)
+			daa
+			ld	(hl),l
+			or	a
+			or	e
+			add	a,h
+			add	a,b
+			nop (2x) *
+			jp	pe,L47fc
+			ld	b,a
+			xor	d
+			rst	10h
+			rrca
+			ret	c
+			cp	d
+			ei
+			pop	bc
+			sbc	a,(hl)
+			halt
+			push	hl
+			and	l
+			ld	l,e
+			jp	c,L90e9
+			ret	nz
+			add	a,b
+			cp	c
+			ld	b,l
+			add	a,1ch
+			ld	h,c
+			rst	38h
+			ld	(de),a
+			add	hl,de
+			ld	b,d
+			call	c,L93d2
+			ret	c
+			ld	(hl),45h
+			ld	e,e
+			ld	(hl),l
+			cp	e
+			ld	c,22h
+			dec	bc
+			scf
+			ld	a,h
+			res	7,a
+			jp	pe,Lf8e7
+			jp	pe,Le162
+			push	de
+			ld	e,c
+			ld	c,d
+			ld	(hl),feh
+			sub	l
+			dec	a
+			ld	a,c
+			ld	d,h
+			ld	a,(de)
+			sub	a
+			rst	00h
+			call	m,Lebba
+			ld	h,(hl)
+			ld	e,c
+			ret	p
+			ld	sp,fef8h
+			ld	d,82h
+			add	hl,de
+			push	af
+			adc	a,1ch
+			ret	c
+			cp	b
+			inc	c
+			ld	c,97h
+			call	po,Ld7c0
+			add	hl,sp
+			dec	b
+			ld	a,(hl)
+			ld	b,a
+			and	b
+			ld	e,(hl)
+			and	b
+			call	nc,Lfa62
+			ld	hl,(eae5h)
+			dec	(hl)
+			adc	a,e
+			inc	l
+			call	L3d60
+			di
+			rst	38h
+			rst	18h
+			cp	e
+			cp	d
+			call	p,L0815
+			ccf
+			ld	c,b
+			sbc	a,e
+			ld	l,b7h
+			dec	hl
+			ld	a,e
+			exx
+			ld	a,(bc)
+			ld	e,a
+			ld	(hl),d
+			xor	a
+			ld	c,a
+			cp	e
+			xor	h
+			call	c,L3933
+			ld	e,e
+			add	a,a
+			ld	l,d
+			ret	c
+			ld	b,l
+			inc	d
+			cp	c
+			ld	e,6eh
+			xor	e
+			ld	c,(hl)
+			sbc	a,a
+			ld	(iy + 2ch),56h
+			inc	de
+			ld	e,0fh
+			jp	nc,L1d4e
+			cp	b
+			sub	(hl)
+			dec	c
+			ld	d,b
+			ld	a,b
+			or	(ix + bdh)
+			ld	(hl),a
+			add	a,c
+			rst	38h
+			call	c,La2dd
+			rst	38h
+			rst	18h
+			adc	a,a
+			dec	h
+			ld	c,d
+			ld	d,(hl)
+			ld	sp,hl
+			sbc	a,b
+			dec	a
+			pop	af
+			ld	b,(hl)
+			jp	pe,L3c69
+			sub	c
+			dec	d
+			call	m,Lbcb5
+			ld	h,d
+			pop	hl
+			sbc	a,b
+			sub	a
+			ld	(de),a
+			halt
+			and	e
+			call	z,L4e96
+			rst	08h
+			ld	h,(hl)
+			ccf
+			ld	d,b
+			xor	d
+			ld	a,(de)
+			pop	af
+			dec	c
+			and	e
+			and	a
+			sbc	a,l
+			ld	c,c
+			sub	b
+			ld	a,c
+			dec	sp
+			adc	a,l
+			call	z,Le57c
+			jr	L9c54
+			db	cbh,e8h
+			and	e
+			and	a
+			call	nz,Ledb7
+			jr	L9c06
+			db	50h,17h,8eh,43h,d7h,b7h,27h,82h
+			db	1eh,c4h,2fh,45h,20h,91h,0ah,6dh
+			db	4eh,abh,85h,8ah,2bh,f9h,5fh,48h
+			db	e9h,1eh,75h,77h,d1h,fah,b1h,6ah
+			db	21h,95h,a8h,76h,00h,4ah,43h,57h
+			db	0ah,b1h,26h,2bh,62h,05h,7ah
+			inc	bc
+			call	nc,L5f89
+			sub	0ch
+			ld	h,e
+			inc	a
+			ld	e,e
+			jp	Lfe34
+			db	f4h,95h,21h,5eh,13h,96h,ffh,e3h
+			db	d0h,39h,efh,a5h,7ah,85h,16h,95h
+			db	d5h,2ah,d8h,1ah,40h,17h,d7h,c1h
+			db	8ah,fch,fdh,8eh,a4h,6dh,73h,d2h
+			db	dfh,0bh,80h,30h,2bh,4eh,dch,ebh
+			db	66h,17h,54h,96h,09h,77h,8ah,b2h
+			db	19h,9ah,d0h,f7h,29h,ech,6ah,61h
+			db	b6h
+			inc	l
+			ld	(hl),l
+			ret	p
+			cp	b
+			dec	de
+			and	84h
+			adc	a,h
+			ld	a,a
+			ld	(de),a
+			and	b
+			dec	sp
+			and	a
+			cp	l
+			and	c
+			rst	28h
+			or	e
+			ld	d,a
+			rst	08h
+			ld	d,c
+			ret	c
+			jp	nz,Le454
+			add	hl,sp
+			cp	f4h
+			ld	l,25h
+			sub	c
+			adc	a,(hl)
+			and	e
+			ld	l,h
+			halt
+			or	c
+			add	a,h
+			jp	c,La197
+			inc	c
+			jr	nc,L9c99
+			ld	(2ba5h),a
+			add	a,h
+			halt
+			cp	a
+			dec	hl
+			add	a,(hl)
+			ld	l,b
+			sbc	a,h
+			inc	sp
+			ld	(1503h),a
+			and	efh
+			nop (2x) *
+			call	pe,La052
+			ld	e,d
+			call	po,L67da
+			add	a,9bh
+			call	po,Laa0f
+			ld	h,a
+			cp	92h
+			and	e
+			ld	sp,hl
+			sbc	a,h
+			halt
+			jp	po,Ldb6b
+			add	a,fbh
+			xor	l
+			sub	h
+			inc	de
+			adc	a,e
+			sub	h
+			add	hl,sp
+			ret	nc
+			ld	h,h
+			or	e
+			inc	hl
+			xor	h
+			daa
+			push	bc
+			adc	a,06h
+			rst	08h
+			sub	b
+			adc	a,h
+			adc	a,76h
+			ret	p
+			and	e
+			ld	a,b
+			jr	nz,L9cd1
+			ld	(hl),a
+			or	e
+			ld	e,d
+			ld	hl,3635h
+			jp	pe,Lf8e3
+			nop (2x) *
+			and	b
+			ld	d,b
+			xor	l
+			ld	c,e
+			sub	d
+			ld	h,a
+			ld	a,e
+			ld	(hl),b
+			ret	nz
+			ld	hl,(fbc2h)
+			inc	e
+			ld	a,d
+			ld	c,l
+			xor	08h
+			jp	L0dba
+			db	aah,17h,60h,3ah,47h,7fh,63h,dfh
+			db	d9h,6ch,beh,33h,c4h,edh,92h,d9h
+			db	edh,5fh,2ch,a2h,c6h,2fh,b6h,e1h
+			db	09h,42h,14h,2ah,77h,c9h,30h,eah
+			db	7ah,29h,c8h,f3h,fdh,a5h,1dh,40h
+			db	0bh,b0h,36h
+			ld	b,l
+			ld	d,d
+			adc	a,a
+			ld	a,(hl)
+			or	c
+			ex	de,hl
+			jp	z,L8cd7
+			and	59h
+			ld	de,ce3bh
+			ld	d,a
+			ld	l,39h
+			jr	nz,L9d8e
+			ld	h,l
+			ld	d,(hl)
+			ld	l,b
+			rra
+			ld	(hl),e
+			cp	(hl)
+			nop (2x) *
+			ld	c,h
+			add	a,h
+			add	a,d
+			ret	pe
+			adc	a,b
+			sub	h
+			ld	b,e
+			ei
+			xor	h
+			xor	d
+			adc	a,h
+			inc	sp
+			xor	d
+			and	e
+			ld	d,f4h
+			rlca
+			djnz	L9d17
+			ret	z
+			xor	c8h
+			xor	l
+			sub	a
+			or	c
+			xor	a
+			cp	d
+			or	a
+			or	l
+			jp	z,L88ea
+			nop (2x) *
+			jp	pe,Lb093
+			nop (2x) *
+			adc	a,e
+			jr	z,L9de6
+			ret	m
+			ex	de,hl
+			in	a,(59h)
+			ex	de,hl
+			push	hl
+			dec	e
+			ld	(hl),e
+			pop	de
+			sbc	a,h
+			dec	(hl)
+			ret	pe
+			jr	nz,L9d79
+			ld	c,06h
+			and	a
+			add	hl,sp
+			scf
+			ld	d,a
+			ld	l,b
+			rst	00h
+			inc	e
+			xor	b
+			rst	00h
+			ld	a,c
+			or	c
+			ld	a,7bh
+			ld	hl,7379h
+			ld	b,l
+			dec	sp
+			call	c,L244f
+			xor	l
+			xor	a
+			nop (2x) *
+			ld	c,c
+			dec	d
+			adc	a,(hl)
+			adc	a,a
+			pop	de
+			ld	e,(hl)
+			adc	a,l
+			inc	sp
+			ld	(aef2h),a
+			ld	(hl),d7h
+			ld	c,l
+			sub	(hl)
+			jp	po,L9960
+			call	po,L09b9
+			rrca
+			add	hl,de
+			ret	p
+			jp	po,L8b1a
+			jr	nz,L9e2d
+			ld	(hl),b
+			ret	c
+			jp	(hl)
+			db	7ch,91h,53h,26h,70h,62h,99h,49h
+			db	bdh,71h,9dh
+			or	b
+			call	c,L6f84
+			cp	b
+			pop	de
+			jr	nc,L9d7c
+			dec	d
+			sbc	a,a
+			nop (2x) *
+			ld	e,50h
+			ld	e,a
+			or	d5h
+			pop	de
+			ld	d,e
+			ld	(hl),d
+			nop (2x) *
+			and	e
+			or	c
+			rst	00h
+			rra
+			nop (2x) *
+			ld	b,e
+			call	p,L98a3
+			add	a,6bh
+			ld	a,13h
+			ld	l,c
+			jr	nz,L9dd4
+			ret	p
+			or	e
+			ld	hl,86cch
+			xor	(hl)
+			sub	b
+			cp	iyl *
+			ld	h,7fh
+			ld	(hl),h
+			ld	e,d
+			ld	c,d
+			ld	a,d
+			ld	a,(bc)
+			ld	(aba0h),a
+			ld	a,c
+			pop	de
+			ld	b,b
+			sbc	a,efh
+			ld	a,l
+			ld	c,h
+			rst	18h
+			ld	a,l
+			add	a,h
+			call	c,L2c80
+			ld	d,b
+			and	l
+			sbc	a,d
+			or	e
+			inc	(hl)
+			call	L2181
+			add	a,l
+			ld	l,a
+			or	(hl)
+			add	a,a6h
+			ld	(hl),l
+			call	Ld8ed
+			add	a,b0h
+			ld	sp,35beh
+			ld	b,h
+			jp	z,Le878
+			ex	de,hl
+			sub	b
+			res	0,d
+			inc	a
+			in	a,(b9h)
+			inc	sp
+			and	b
+			xor	a
+			jp	(hl)
+			db	05h,f1h,72h
+			jp	p,Lcda2
+			ret
+			db	f2h,e0h,e7h,d3h,17h,3eh,8bh,3bh
+			db	d0h,55h,9eh,dah,e0h,d0h,70h,6fh
+			db	f0h,01h,0eh,11h,66h,cfh,24h,e7h
+			db	c8h,67h,67h,ebh,dch,bfh,73h,16h
+			db	7bh,ebh,21h,5fh,e1h,fbh,b5h,a5h
+			db	6dh,1eh,8eh,a5h,34h,4eh,1ch,88h
+			db	24h,e3h,01h,10h,1ah,1fh,c5h,f6h
+			db	35h,e7h,e1h,43h,0dh,53h,18h,8fh
+			db	e9h,97h,afh,19h,7ch,cfh,c6h,35h
+			db	c9h,0ah,9ch,09h,ebh,beh,59h,05h
+			db	b0h,ffh,f5h,30h,b9h,91h,cdh,93h
+			db	afh,c4h
+			ld	h,l
+			ld	a,d
+			xor	d
+			add	a,(hl)
+			dec	l
+			dec	hl
+			nop (2x) *
+			ld	a,b
+			inc	d
+			or	d
+			ret	p
+			ld	l,c
+			ld	b,h
+			ld	b,a
+			ld	a,l
+			rst	30h
+			call	p,L97f4
+			ld	c,cfh
+			jp	z,L91f8
+			call	nc,L5576
+			jp	nz,Lb4fa
+			sbc	a,b
+			add	hl,sp
+			ld	h,d
+			ld	h,l
+			adc	a,b
+			adc	a,l
+			inc	sp
+			inc	hl
+			or	l
+			and	a
+			add	a,d
+			call	p,Laafe
+			xor	e
+			ex	(sp),hl
+			ld	e,72h
+			ld	(hl),c
+			jp	m,L57e6
+			ret	nz
+			ld	l,c
+			sbc	a,88h
+			ld	b,c
+			pop	hl
+			ld	e,b
+			ld	d,e
+			ld	b,d
+			and	b
+			inc	d
+			cp	c
+			ld	e,b
+			sub	l
+			add	a,(hl)
+			ld	hl,(5868h)
+			push	bc
+			xor	d
+			and	h
+			ld	h,9dh
+			ret	z
+			sbc	a,c
+			ld	(bc),a
+			call	p,Lccb4
+			ld	bc,623ah
+			cp	e
+			xor	e
+			ld	de,6ffdh
+			adc	a,(hl)
+			dec	h
+			cp	(hl)
+			sub	c
+			ld	l,a
+			jr	L9f52
+			db	5ah,2eh,0ah,c3h,e6h,25h,5dh,0bh
+			db	e2h,2eh,35h,fah,e3h,04h,63h,eeh
+			db	2ch,1eh,b0h,fbh,6ch,d3h,3fh,9ch
+			db	edh,7eh,bch,d6h
+			ld	a,(hl)
+			call	z,L2f23
+			pop	de
+			scf
+			ld	c,c
+			add	a,d
+			ld	e,e
+			ld	a,(d395h)
+			sbc	a,b
+			add	a,h
+			sub	47h
+			cp	c
+			ld	e,c
+			sub	a
+			ld	a,d
+			or	(hl)
+			or	d
+			ld	e,l
+			ld	(hl),e
+			ld	h,(hl)
+			ex	(sp),hl
+			inc	b
+			rst	20h
+			ld	d,l
+			sub	h
+			dec	c
+			ret	nz
+			push	af
+			ret	p
+			sbc	a,66h
+			sbc	a,2fh
+			rst	28h
+			out	(17h),a
+			ld	b,h
+			ret	n
+			dec	a
+			ld	d,d
+			jr	z,L9fd0
+			and	l
+			ld	b,h
+			dec	h
+			jr	z,L9f5f
+			inc	c
+			xor	c
+			or	a
+			ret	z
+			and	h
+			ld	l,b
+			adc	a,d
+			or	(hl)
+			rst	18h
+			add	a,e
+			jp	(hl)
+			db	d9h,9fh,cch,edh,4ch,4ch,9eh,1ch
+			db	58h,55h,dah,41h,32h,3ch,d2h,a6h
+			db	4dh,aeh,e2h,22h,56h,c0h,64h,fch
+			db	cah,b8h,aah,e7h
+			jp	p,L1fe0
+			add	a,a
+			ld	(hl),1eh
+			ld	l,b
+			add	hl,de
+			or	l
+			ld	b,d
+			ld	a,(de)
+			jr	c,L9f9f
+			ld	(hl),a9h
+			ld	(hl),d
+			adc	a,h
+			ret	z
+			push	af
+			pop	de
+			sub	e
+			add	a,h
+			jp	Ld33a
+			db	38h,56h,c5h,1fh,72h
+			ld	b,c
+			sbc	a,46h
+			ld	l,b
+			ld	l,e
+			ld	a,(bc)
+			ld	(2333h),hl
+			adc	a,75h
+			ld	(bc),a
+			xor	e
+			sbc	a,d
+			or	l
+			nop
+			ret	m
+			dec	sp
+			dec	c
+			dec	h
+			add	a,c
+			ld	a,d
+			and	a
+			dec	bc
+			and	(hl)
+			ld	e,l
+			ld	a,(de)
+			inc	bc
+			rrca
+			and	e
+			inc	d
+			xor	c
+			ld	a,h
+			sbc	a,h
+			or	b
+			ret
+			db	6dh
+			and	b
+			cpl
+			ld	d,(hl)
+			or	c
+			djnz	L9fa7
+			ld	l,4ch
+			add	a,b
+			call	p,Le798
+			jp	c,L2778
+			ld	a,(hl)
+			sbc	a,c
+			ld	c,(hl)
+			inc	b
+			jp	nz,Lb66f
+			jp	nc,L49e9
+			or	a
+			xor	(hl)
+			add	hl,de
+			ld	h,58h
+			inc	b
+			set	2,d
+			push	hl
+			inc	de
+			ld	h,d
+			rst	20h
+			or	d
+			ld	e,b
+			sub	e
+			rst	38h
+			adc	a,d
+			ld	a,(bc)
+			call	c,L055e
+			ld	l,e
+			ld	d,(hl)
+			ld	a,e
+			ld	b,17h
+			add	a,h
+			sbc	a,h
+			ld	(de),a
+			ld	h,d8h
+			inc	d
+			cp	b
+			rrca
+			cp	d
+			sub	d
+			add	hl,de
+			ld	de,689ch
+			dec	de
+			ret	m
+			dec	l
+			xor	l
+			add	a,e
+			add	a,a
+			sbc	a,b
+			inc	(hl)
+			ld	e,d
+			xor	c
+			ret	p
+			add	a,h
+			inc	c
+			call	nc,L038c
+			ld	e,l
+			sub	1fh
+			ld	d,(hl)
+			dec	(hl)
+			ld	c,(hl)
+			cp	l
+			ld	h,e
+			ret	po
+			dec	h
+			push	bc
+			dec	bc
+			ld	d,c
+			cp	d
+			jp	(hl)
+			db	8fh,a2h,a1h,eeh,40h,e2h,3ah,09h
+			db	37h,40h,51h,69h,6ah,7fh,31h,b5h
+			db	31h,12h,24h,06h,11h,a7h,3ah,10h
+			db	aah,3dh,54h,8fh,5ch,85h,77h,edh
+			db	e1h,3fh,fch,c2h,31h
+			ld	b,e
+			adc	a,(hl)
+			xor	a
+			sub	a
+			dec	h
+			ld	a,edh
+			ex	(sp),hl
+			adc	a,b
+			ld	(hl),l
+			or	b
+			add	a,d
+			ld	l,87h
+			ld	b,(hl)
+			or	b7h
+			dec	b
+			dec	e
+			dec	sp
+			ld	(hl),c
+			call	pe,Le23b
+			pop	hl
+			or	b
+			ex	(sp),hl
+			xor	c
+			ld	h,d
+			dec	c
+			ld	hl,7461h
+			cp	l
+			cp	e
+			ld	e,e
+			djnz	La051
+			ld	a,e
+			add	a,d
+			ld	e,50h
+			rst	38h
+			ld	l,b
+			ld	a,h
+			ld	a,(bc)
+			set	0,a
+			xor	c
+			rrc	l
+			ld	l,(hl)
+			ld	b,(hl)
+			sbc	a,a
+			add	a,h
+			xor	b
+			ld	e,d7h
+			add	a,(hl)
+			and	h
+			jp	p,La4c0
+			sbc	a,h
+			xor	h
+			call	c,L8bce
+			xor	a5h
+			jp	p,Ld902
+			sbc	a,b
+			inc	bc
+			ld	h,l
+			add	a,c1h
+			adc	a,d
+			ld	h,l
+			and	c
+			ex	de,hl
+			ld	b,h
+			add	hl,hl
+			dec	b
+			ld	a,h
+			ld	l,24h
+			ld	(hl),e
+			ei
+			sbc	a,c
+			add	hl,de
+			sbc	a,b
+			ld	a,b
+			ld	b,b
+			rst	20h
+			dec	hl
+			cp	(hl)
+			jp	m,L2f4d
+			rst	18h
+			dec	(hl)
+			add	a,c
+			ld	c,e
+			ld	c,e
+			cp	d
+			ex	(sp),hl
+			ld	e,e
+			ld	l,e
+			call	po,Lfb6a
+			dec	e
+			ret	pe
+			rst	38h
+			ld	e,a
+			sbc	a,27h
+			dec	d
+			call	nc,L6cd8
+			add	a,b
+			sub	b
+			ld	(hl),8dh
+			ld	e,l
+			jr	z,La0ef
+			jr	nc,La072
+			rrca
+			ret	z
+			ld	(hl),l
+			or	(hl)
+			or	(hl)
+			ld	l,e
+			ex	(sp),hl
+			call	m,L3bf6
+			ld	(hl),a
+			ld	e,h
+			in	a,(c5h)
+			rst	08h
+			ld	e,e
+			adc	a,e
+			ld	l,e
+			xor	d
+			ex	af,af'
+			ld	e,l
+			pop	bc
+			ld	(hl),b6h
+			ret	nc
+			rla
+			jr	z,La073
+			ld	(hl),d
+			push	af
+			cp	b
+			adc	a,e
+			dec	de
+			call	po,L4796
+			ld	a,l
+			adc	a,h
+			ld	(hl),65h
+			call	nz,L2e51
+			ld	h,a
+			call	z,L6266
+			ld	l,(hl)
+			ex	af,af'
+			ex	de,hl
+			ld	(bc),a
+			call	nc,L5442
+			nop (2x) *
+			ld	(de),a
+			ld	b,h
+			ret	z
+			ret	po
+			ret	m
+			ld	sp,hl
+			rla
+			ld	de,d91dh
+			ld	c,9bh
+			ld	c,b
+			inc	sp
+			jp	nc,Leac8
+			djnz	La109
+			pop	bc
+			ld	hl,9bf4h
+			ld	c,d
+			rst	38h
+			ld	b,e
+			inc	bc
+			ex	(sp),hl
+			push	de
+			ld	sp,hl
+			jp	nc,L2b77
+			and	l
+			ld	a,(bc)
+			ld	a,(bc)
+			and	8fh
+			ld	(hl),l
+			ex	(sp),hl
+			ld	c,d
+			ld	b,b
+			and	e
+			ld	l,l
+			sub	h
+			sbc	a,e
+			xor	l
+			ret	z
+			adc	a,e
+			daa
+			inc	l
+			ld	sp,hl
+			ex	(sp),hl
+			jp	Lc555
+			db	76h,a5h,98h,0ch,80h,b3h,e7h,b9h
+			db	68h,d8h,53h,15h,adh,0ch,a8h,d2h
+			db	23h,d9h,29h,dch,57h,a5h,63h,1ah
+			db	e1h,29h,dah,b9h
+			or	l
+			ld	h,h
+			ld	l,c
+			jp	nc,Ld2d0
+			ld	a,d
+			ret	p
+			rrca
+			ret	nz
+			or	a8h
+			ld	a,50h
+			ld	c,b
+			ld	d,h
+			jr	z,La1a3
+			nop (2x) *
+			ld	a,(bc)
+			call	m,L8123
+			rst	38h
+			ld	e,a
+			dec	hl
+			dec	b
+			cp	l
+			ret
+			db	9bh,a6h,f6h,d9h,45h,37h,37h,ech
+			db	43h,4ah,5dh,ffh,96h,34h,2fh,f3h
+			db	8dh,dah,27h,e7h,a2h,40h,14h,45h
+			db	23h,d1h
+			rrca
+			call	pe,L47a2
+			ld	d,b
+			xor	d
+			dec	bc
+			cp	l
+			cp	d
+			call	nc,L8d41
+			dec	(hl)
+			rst	30h
+			ld	b,a
+			halt
+			ld	h,a9h
+			adc	a,e
+			ld	a,(hl)
+			sub	d
+			adc	a,l
+			cpl
+			pop	hl
+			and	b
+			add	hl,hl
+			ld	e,a
+			ld	l,a
+			jr	nz,La1b9
+			sbc	a,a
+			ld	d,2ch
+			add	hl,bc
+			ex	af,af'
+			jr	z,La1cb
+			adc	a,h
+			inc	bc
+			ld	l,54h
+			ld	a,l
+			jp	pe,L33b9
+			and	h
+			ret	z
+			halt
+			add	a,e
+			and	l
+			add	a,h
+			jr	z,La234
+			and	b
+			add	a,b
+			ld	iyl,c *
+			ld	a,61h
+			rst	10h
+			adc	a,c
+			rst	30h
+			and	h
+			ld	h,l
+			ld	a,b
+			adc	a,(hl)
+			add	a,5bh
+			push	de
+			dec	e
+			di
+			sub	(hl)
+			and	d
+			ld	(hl),l
+			ld	e,e
+			ld	(hl),l
+			ld	c,e
+			ld	l,(hl)
+			ld	d,(hl)
+			sbc	a,l
+			xor	b
+			inc	d
+			ld	(hl),l
+			ld	hl,dfcfh
+			ld	b,44h
+			ex	(sp),hl
+			add	a,(hl)
+			add	a,d
+			ld	h,c
+			pop	bc
+			exx
+			ld	l,h
+			ld	d,b
+			and	c
+			inc	bc
+			ld	l,a
+			adc	a,c
+			dec	e
+			ld	h,l
+			jr	nc,La211
+			ld	d,l
+			jr	c,La1f8
+			ld	d,(hl)
+			ld	d,h
+			ld	a,d
+			ret	z
+			sbc	a,e
+			ld	b,b
+			ld	d,c
+			ld	a,01h
+			ld	e,e
+			jp	pe,Lb0ee
+			ld	a,d
+			ld	l,d1h
+			add	hl,hl
+			ld	c,(hl)
+			in	a,(f8h)
+			ld	e,b
+			adc	a,e
+			ld	d,59h
+			xor	(hl)
+			cp	l
+			add	hl,de
+			rst	20h
+			halt
+			ret	po
+			rst	10h
+			rst	38h
+			ld	c,l
+			xor	bah
+			ld	bc,1eb8h
+			ld	l,e
+			sbc	a,b
+			pop	af
+			call	nc,Laa7b
+			ld	h,d
+			inc	e
+			ld	d,c
+			xor	(hl)
+			xor	e
+			add	a,(hl)
+			cp	l
+			nop (2x) *
+			in	a,(1ah)
+			ld	d,e
+			ret
+			db	58h,76h,abh,b6h,88h,d5h,ffh,a2h
+			db	8bh,2dh,2ch,93h,a2h,8ch,82h,c2h
+			db	fdh,3bh,69h,d7h,4dh,fah,41h,67h
+			db	c5h,1ah,17h,15h,30h,35h,ddh,9bh
+			db	3ah,81h,23h,35h,0dh,50h,dbh,b7h
+			db	9bh,ceh,fah,2fh,a3h,eah,3fh,6eh
+			db	bbh,74h,5bh,0ah
+			xor	d
+			ld	h,(hl)
+			and	e
+			sbc	a,h
+			sbc	a,(hl)
+			ex	de,hl
+			sbc	a,b
+			ld	d,b
+			sub	l
+			ld	a,d
+			dec	(hl)
+			jr	nz,La2e0
+			dec	e
+			ld	c,ffh
+			dec	h
+			ld	b,c
+			ld	h,97h
+			dec	a
+			add	a,(hl)
+			xor	c
+			inc	b
+			dec	b
+			ld	hl,fa89h
+			ld	(hl),l
+			ld	hl,(2d1bh)
+			sbc	a,a
+			add	hl,bc
+			jr	La2fb
+			db	d9h,dfh,81h,93h,04h,cdh,efh,5bh
+			db	80h,7eh,b5h,a0h,88h,4ch
+			ret	pe
+			and	b
+			sbc	a,d
+			ld	l,e
+			rlca
+			ret	p
+			adc	a,d
+			ld	l,a
+			ccf
+			rst	10h
+			inc	b
+			push	bc
+			jp	po,L75fa
+			ld	(hl),16h
+			dec	b
+			adc	a,c
+			jp	nz,L2d1e
+			and	e
+			inc	bc
+			ld	(hl),b
+			ld	b,(hl)
+			or	a
+			and	l
+			ld	l,6fh
+			or	d
+			ld	e,c
+			ret	c
+			ld	(hl),e
+			ld	h,a
+			rra
+			rla
+			sub	d
+			dec	b
+			add	a,a
+			add	hl,hl
+			scf
+			adc	a,bch
+			sbc	a,a
+			inc	de
+			dec	bc
+			cp	(hl)
+			halt
+			ret	pe
+			ld	(hl),a
+			xor	a
+			ex	de,hl
+			ld	h,c
+			inc	b
+			ld	b,c
+			inc	l
+			exx
+			nop (2x) *
+			sbc	a,e
+			ld	b,1ch
+			add	hl,bc
+			rst	18h
+			and	d
+			xor	9bh
+			xor	b
+			ld	e,(hl)
+			ld	d,b
+			ld	b,d
+			ld	l,l
+			ld	l,d
+			ld	(hl),e
+			sbc	a,h
+			jp	Lfe5a
+			db	d2h,dbh,18h,77h,bah,bdh,9ch,56h
+			db	adh,3eh,49h,72h
+			jr	z,La2a0
+			call	z,L7b9e
+			ld	h,b
+			rlca
+			ld	l,l
+			and	b
+			ld	e,l
+			sub	73h
+			ret	pe
+			cp	c
+			rrca
+			ex	(sp),hl
+			rrca
+			jr	La339
+			db	35h,dbh,01h,b8h,b6h,cbh,80h,cah
+			db	03h,d1h,e1h,9bh,78h,3eh,68h,cdh
+			db	98h,d1h,cah,73h,3ch,50h,dbh,f0h
+			db	a0h,36h,47h,7bh,f2h,7ah,bch,49h
+			db	b5h,18h,f5h,76h,65h,77h,21h,1dh
+			db	6ch,95h,0bh
+			ld	d,d
+			push	bc
+			cp	h
+			sub	6bh
+			sub	h
+			ld	l,7ah
+			ld	c,l
+			ld	b,h
+			sbc	a,b
+			ret	nc
+			ld	c,h
+			ld	a,e
+			dec	e
+			adc	a,h
+			ld	d,h
+			or	e
+			call	pe,L48af
+			sub	l
+			ld	(hl),l
+			add	a,b
+			call	c,L8ade
+			dec	e
+			xor	d
+			ld	l,8ch
+			ld	b,d
+			add	hl,de
+			ret	nz
+			ret	nc
+			nop (2x) *
+			ld	b,e
+			ld	c,e
+			ld	d,b
+			sbc	a,l
+			dec	a
+			ld	e,a
+			ret	pe
+			add	hl,bc
+			cp	1bh
+			adc	a,cfh
+			call	L1b5a
+			inc	de
+			or	e
+			pop	bc
+			ld	b,h
+			dec	(hl)
+			add	hl,hl
+			or	l
+			rst	18h
+			ld	(hl),abh
+			sub	l
+			inc	e
+			inc	a
+			ld	h,a
+			sbc	a,c
+			ld	a,(db39h)
+			djnz	La3d3
+			rst	18h
+			ld	d,a
+			rst	08h
+			ld	b,(hl)
+			ld	d,b
+			jr	nz,La33c
+			xor	63h
+			ld	d,(hl)
+			dec	e
+			ld	(hl),e
+			sbc	a,(hl)
+			cp	h
+			add	a,h
+			ld	e,(hl)
+			ld	hl,(7847h)
+			inc	c
+			add	hl,bc
+			cp	c
+			sbc	a,(hl)
+			inc	(hl)
+			rlca
+			ld	hl,(d494h)
+			ld	l,l
+			ld	e,l
+			ld	(hl),a
+			ld	d,c
+			dec	e
+			rla
+			ld	d,e
+			ld	(365ch),hl
+			push	de
+			jp	c,La1bd
+			jp	po,L832a
+			sbc	a,85h
+			ld	c,b
+			xor	b
+			nop
+			push	af
+			ld	d,l
+			rst	20h
+			ld	e,d
+			ccf
+			dec	e
+			sbc	a,(hl)
+			ld	(hl),b
+			pop	de
+			cpl
+			jp	m,L561e
+			ld	b,e
+			ld	a,(bc)
+			xor	b
+			ex	(sp),hl
+			sub	(hl)
+			ld	h,h
+			ld	d,b
+			ld	e,(hl)
+			add	a,b
+			ld	d,b
+			add	hl,hl
+			ret	z
+			call	po,L4e35
+			ld	l,ddh
+			inc	bc
+			nop (2x) *
+			ret	nc
+			ld	d,e
+			dec	a
+			ld	h,b
+			ld	(hl),c
+			ld	e,e
+			sub	l
+			ex	af,af'
+			dec	sp
+			daa
+			add	a,h
+			dec	h
+			call	nz,L5d01
+			xor	d
+			cp	l
+			ld	d,b
+			add	a,d
+			ret	m
+			add	a,l
+			ret	p
+			rst	20h
+			sbc	a,d
+			ccf
+			ld	b,e
+			ld	b,b
+			add	hl,de
+			call	z,L9855
+			adc	a,h
+			cp	(hl)
+			ld	(hl),a
+			ld	e,h
+			inc	d
+			call	z,Lba92
+			ld	h,b
+			ld	b,e
+			sub	a
+			ld	l,b
+			xor	46h
+			ld	d,c
+			ld	e,d
+			dec	b
+			call	c,L57aa
+			scf
+			ld	l,h
+			add	a,(hl)
+			ld	c,d
+			ld	a,e
+			ld	c,e
+			ld	sp,hl
+			ld	c,a
+			call	p,L23bb
+			jr	c,La3ad
+			ld	b,e
+			ld	c,l
+			call	nz,Leca1
+			or	h
+			rst	20h
+			pop	hl
+			ld	e,c
+			or	b
+			and	c
+			sub	h
+			push	af
+			jp	c,L65f2
+			ld	l,a
+			sub	e
+			inc	c
+			ld	a,(bc)
+			dec	de
+			jp	m,L2895
+			adc	a,ffh
+			ld	d,c
+			ld	h,b
+			exx
+			ld	c,l
+			and	l
+			ld	d,(hl)
+			rst	10h
+			ld	(bc),a
+			ei
+			ld	b,e
+			add	hl,bc
+			ld	a,(4b1ch)
+			out	(08h),a
+			sub	d
+			ld	(hl),d
+			ld	h,a
+			sbc	a,a
+			ret	pe
+			dec	d
+			ld	b,c
+			and	cbh
+			adc	a,c7h
+			sbc	a,(hl)
+			ld	h,h
+			ld	a,b
+			and	a
+			ret	z
+			ld	a,(hl)
+			ld	h,e
+			dec	l
+			sub	d
+			dec	d
+			add	a,d6h
+			di
+			rst	18h
+			ld	l,a
+			ld	h,l
+			ld	e,h
+			ret	p
+			sub	d
+			sub	a
+			inc	d
+			sbc	a,h
+			ld	d,79h
+			rst	08h
+			scf
+			jr	z,La40c
+			ld	d,l
+			push	hl
+			jp	po,L4c3d
+			cpl
+			ld	l,78h
+			dec	h
+			ld	l,d
+			ld	c,(hl)
+			ld	(hl),d
+			sub	(hl)
+			and	l
+			inc	c
+			ld	e,a
+			ld	d,(hl)
+			sub	d
+			ret	m
+			jp	c,L8025
+			ld	(hl),d
+			cp	(hl)
+			adc	a,c
+			ei
+			sub	h
+			inc	h
+			inc	l
+			call	nz,L902f
+			add	hl,hl
+			jp	L4c07
+			db	74h,02h,00h,65h,adh,dfh,1ah,14h
+			db	47h,18h,91h,f1h,32h,2bh,7ah,c1h
+			sbc	a,12h
+			cp	b
+			ret	nc
+			ret	po
+			add	a,d
+			and	0dh
+			dec	l
+			ld	bc,9d2dh
+			inc	b
+			adc	a,a
+			adc	a,b
+			and	a
+			ld	c,a6h
+			jr	nc,La4f7
+			ld	sp,hl
+			jp	p,L0eb2
+			ld	b,c
+			push	hl
+			ld	e,a
+			ld	e,8bh
+			jp	p,L47b9
+			and	d
+			sub	4ah
+			rst	18h
+			and	h
+			ld	e,e
+			pop	bc
+			jr	nc,La4e3
+			ld	(bc),a
+			nop (2x) *
+			ret	c
+			xor	a
+			call	pe,L20e0
+			xor	f6h
+			add	a,d
+			xor	(hl)
+			add	hl,hl
+			ld	h,b
+			ret	p
+			ld	e,h
+			inc	l
+			ld	h,(hl)
+			or	h
+			inc	de
+			xor	(hl)
+			add	hl,de
+			rlca
+			ld	l,a
+			ld	a,h
+			or	(hl)
+			cp	h
+			xor	a
+			push	de
+			ld	b,(hl)
+			ld	b,e
+			ret
+			db	83h,ebh,e7h,97h
+			cp	a
+			cp	(hl)
+			rst	30h
+			add	hl,sp
+			ld	b,06h
+			sbc	a,c
+			sub	e
+			ret	c
+			push	af
+			or	(hl)
+			ccf
+			adc	a,b
+			add	a,l
+			add	a,h
+			ld	d,h
+			ld	(hl),b
+			sub	l
+			ld	b,b
+			ld	h,a
+			ld	b,91h
+			call	nc,L99e6
+			dec	(hl)
+			ld	b,e
+			add	a,d
+			xor	b
+			and	(hl)
+			ld	(hl),c
+			adc	a,c
+			halt
+			ld	h,(hl)
+			or	(hl)
+			inc	d
+			or	d
+			ld	e,h
+			ld	hl,591ah
+			sub	e
+			ld	hl,95e2h
+			ld	l,b
+			ei
+			ld	e,b
+			adc	a,e
+			cpl
+			call	c,Lb6f0
+			jp	(hl)
+			db	3ch,63h,b2h,10h,f4h,42h,61h,39h
+			xor	h
+			adc	a,l
+			ld	c,e
+			ld	(hl),d
+			add	a,e
+			rla
+			ld	(de),a
+			add	a,e
+			ld	h,b
+			ret	pe
+			ld	b,l
+			ex	(sp),hl
+			ld	c,h
+			dec	de
+			ld	b,b
+			sbc	a,f8h
+			call	Laf1e
+			xor	d
+			dec	a
+			ex	de,hl
+			rrca
+			xor	(hl)
+			jp	nz,L3539
+			dec	sp
+			inc	bc
+			ld	d,l
+			or	d5h
+			adc	a,a
+			sub	d5h
+			adc	a,a
+			inc	a
+			adc	a,a
+			ld	c,d
+			ld	a,(hl)
+			dec	l
+			ld	c,(hl)
+			ld	(bc),a
+			dec	hl
+			ld	b,e
+			ld	a,b
+			call	c,Lad53
+			or	e
+			xor	l
+			xor	h
+			push	bc
+			and	c
+			dec	e
+			ld	c,d
+			add	hl,de
+			di
+			ld	c,(hl)
+			call	pe,L5bb9
+			cp	a
+			jr	nz,La5ae
+			inc	c
+			ld	l,h
+			ret	m
+			sub	e
+			ld	a,0eh
+			or	e
+			ccf
+			ld	c,c
+			dec	e
+			ld	(hl),h
+			ld	a,c
+			ld	sp,bca0h
+			cp	(hl)
+			sbc	a,e
+			call	p,L7cfd
+			rla
+			dec	b
+			sbc	a,c
+			xor	(hl)
+			sbc	a,a
+			jp	pe,L3f1b
+			ld	(hl),e
+			ld	a,d
+			ret	po
+			rra
+			ld	e,b
+			exx
+			cp	a
+			ld	h,(hl)
+			scf
+			xor	d
+			rst	10h
+			inc	c
+			inc	hl
+			sub	d
+			ld	(hl),bah
+			jp	po,L55b3
+			cp	c
+			call	nc,Lef10
+			add	a,d
+			ld	a,(bc)
+			ld	e,e
+			push	hl
+			xor	c
+			ld	c,a
+			cp	5bh
+			call	c,L4e15
+			jr	c,La5d2
+			sub	(hl)
+			ld	c,d
+			ld	c,(hl)
+			sbc	a,7eh
+			cp	c
+			add	a,b
+			xor	d
+			ld	d,a
+			nop (2x) *
+			call	c,L2402
+			call	Lb217
+			add	a,b
+			dec	b
+			dec	d
+			push	de
+			ld	b,b4h
+			ld	b,(hl)
+			ld	l,h
+			and	h
+			add	hl,sp
+			ld	a,(256ch)
+			sbc	a,h
+			rst	20h
+			ret	p
+			ld	a,e
+			ld	c,(hl)
+			rlca
+			xor	d
+			cp	c
+			dec	e
+			nop (2x) *
+			exx
+			cp	51h
+			or	l
+			inc	l
+			jp	nz,L1fc1
+			adc	a,l
+			ld	h,d
+			and	l
+			ld	d,e
+			call	pe,L21e0
+			ld	c,d
+			ld	h,d
+			ret	c
+			dec	d
+			inc	bc
+			adc	a,b
+			ld	c,e
+			add	a,e
+			adc	a,a
+			and	h
+			rlca
+			ld	(hl),b
+			ld	d,h
+			ld	b,c
+			ret	m
+			add	a,c
+			xor	e
+			ld	h,b
+			sub	56h
+			call	Lef04
+			call	po,L4b34
+			ld	a,c
+			or	d
+			ld	c,b0h
+			rst	08h
+			ld	b,a
+			sbc	a,e
+			rst	10h
+			ld	c,a
+			ld	(de),a
+			ld	sp,1edah
+			rst	18h
+			ret	nc
+			dec	e
+			jp	p,Lc6c9
+			adc	a,a
+			ld	a,(296ah)
+			ld	b,e
+			and	b
+			inc	l
+			or	h
+			ld	a,a
+			and	a
+			cp	c
+			call	nz,Lf40e
+			ccf
+			ld	h,d
+			ld	c,9eh
+			jp	nc,Lfd62
+			ld	e,l
+			add	a,a
+			push	de
+			ld	a,b
+			ld	(hl),c
+			call	L573d
+			scf
+			dec	l
+			pop	af
+			dec	d
+			ld	l,l
+			rst	20h
+			xor	a
+			and	c
+			ld	d,d
+			adc	a,h
+			exx
+			ret	pe
+			cp	l
+			ld	c,a
+			ld	a,l
+			ret	c
+			ld	a,(bc)
+			ld	d,d1h
+			ld	c,d
+			ld	(157ch),a
+			call	La1b5
+			or	b
+			jp	(hl)
+			db	55h,51h,49h,f8h,b4h,8bh,5ah,03h
+			db	27h,bdh,a0h,c3h,94h,ebh,c8h,fbh
+			db	56h,5bh,83h,e4h,23h,4fh,e3h,67h
+			db	37h,dah,b7h,bah,e8h,c5h,ceh,dfh
+			db	17h,ddh,bfh,12h,22h,36h,31h,48h
+			db	24h,58h,4ah,beh,c9h,8eh,1ah,22h
+			db	e0h,69h,49h,90h,58h,1eh,71h,beh
+			db	41h,9bh,e6h,25h,f5h,a7h,72h,11h
+			db	bfh,eah
+			adc	a,d
+			sbc	a,(hl)
+			dec	l
+			ld	a,(de)
+			ld	a,5bh
+			sbc	a,d
+			rst	18h
+			ld	(hl),c
+			ld	(hl),h
+			ld	a,b
+			inc	sp
+			in	a,(c4h)
+			add	hl,sp
+			ei
+			ld	c,(hl)
+			ld	b,(hl)
+			or	b
+			sbc	a,d
+			ld	d,d
+			sub	a3h
+			ld	(hl),e5h
+			ret	z
+			ld	b,d
+			jp	z,L4dff
+			push	af
+			and	b
+			call	z,L44cd
+			sbc	a,b
+			ld	l,c
+			and	h
+			ex	af,af'
+			adc	a,(hl)
+			exx
+			call	Lb227
+			ret	z
+			sbc	a,h
+			ld	d,b
+			pop	hl
+			jp	(hl)
+			db	31h,65h,30h,c5h,14h,fah,fah,6ah
+			db	84h,1ah,e2h,21h,8fh,57h,31h,72h
+			db	fah,cdh,88h,e8h,68h,03h,9ch,15h
+			db	54h,a1h,b9h,1dh,21h,d2h,f3h,e1h
+			db	fah,c3h,dch,deh,66h,64h,d7h,92h
+			db	5dh,0fh,b7h,fch,b0h
+			jp	z,L0ffd
+			call	p,L3953
+			ld	a,d
+			ld	c,d
+			ld	a,c
+			rst	10h
+			pop	bc
+			djnz	La6f0
+			sub	c
+			ld	b,(hl)
+			im	0 *
+			ld	a,(bc)
+			ld	b,b
+			inc	e
+			jp	(hl)
+			db	b2h,01h,2ch,d4h,50h,cfh,03h,f1h
+			db	4eh,85h,34h,79h,fch,13h,fdh,f6h
+			db	5ah,f8h,9eh,4eh,8fh,37h,54h,55h
+			db	85h,6dh,49h,7eh,7dh,05h,5ah,edh
+			db	eeh,a4h,46h,3bh,26h,10h,62h,ach
+			db	b3h,d5h,2ah,c7h,3ch,62h,56h,e4h
+			db	45h,00h,1eh,7dh,e3h,7bh,48h,5ch
+			db	37h,bdh,5dh,20h,3fh,2dh,e9h,7ch
+			db	bfh,e3h,ebh,afh,93h,13h,29h,abh
+			db	91h,b6h,60h,56h,84h,5ch,58h,bdh
+			db	0fh,57h,ach,3fh,8ah,9bh,d4h,dfh
+			db	72h,04h,b1h,c3h,beh,88h,51h,84h
+			db	88h,4ch,8eh,bbh,83h,96h,3fh,46h
+			db	62h,e8h,0bh,a3h,84h,e4h,76h,69h
+			db	8ch,46h,1fh,70h,28h,36h,8ch,c3h
+			db	1eh,0eh,e7h,87h,d4h,44h,6eh,1ah
+			db	62h,05h,6eh,79h,ech
+			dec	de
+			ld	e,(hl)
+			dec	de
+			sbc	a,e
+			ret	m
+			and	h
+			ld	(34f9h),a
+			ld	c,72h
+			ld	a,d
+			jp	c,L028e
+			ld	c,l
+			call	p,Ldfee
+			inc	d
+			cp	58h
+			ld	(hl),c
+			ret	c
+			adc	a,a
+			ex	af,af'
+			ld	c,a
+			and	(hl)
+			xor	d
+			call	nc,L3743
+			ld	(hl),8ch
+			or	b
+			set	5,(hl)
+			ld	e,a
+			dec	de
+			ld	sp,f777h
+			ld	c,d
+			sub	l
+			pop	bc
+			ld	a,(hl)
+			ld	a,a
+			dec	hl
+			rst	00h
+			cp	d
+			dec	(hl)
+			rst	30h
+			sub	a
+			xor	c
+			ld	(9c6ch),hl
+			ld	d,l
+			ld	b,b
+			ld	l,e
+			ld	a,(hl)
+			in	a,(66h)
+			ld	l,34h
+			sbc	a,a
+			ex	af,af'
+			ld	d,c
+			adc	a,c
+			and	c
+			nop (2x) *
+			scf
+			scf
+			add	hl,de
+			and	l
+			exx
+			adc	a,d
+			ld	e,d
+			daa
+			and	(hl)
+			cp	l
+			call	nc,L19b1
+			and	l
+			cp	(hl)
+			ld	h,h
+			ld	e,d
+			add	a,e
+			ld	(de),a
+			ld	a,l
+			ld	d,b
+			ld	d,05h
+			ld	bc,1429h
+			ld	l,l
+			or	e
+			ld	d,h
+			nop
+			inc	bc
+			or	d
+			call	p,Le906
+			in	a,(7fh)
+			out	(8ah),a
+			ld	h,b
+			and	b
+			di
+			sbc	a,a
+			dec	b
+			and	a
+			add	a,(hl)
+			ldir
+			dec	sp
+			and	a7h
+			exx
+			ld	e,c
+			di
+			ld	c,c
+			ld	c,e
+			ld	h,a
+			ld	a,(de)
+			pop	hl
+			rst	20h
+			ld	e,79h
+			ld	h,(hl)
+			add	hl,de
+			nop (2x) *
+			ld	e,37h
+			ld	e,8dh
+			ld	h,l
+			ld	l,l
+			add	a,25h
+			dec	b
+			ld	(hl),c
+			push	de
+			di
+			ld	(hl),b
+			adc	a,c
+			ld	c,e
+			or	l
+			sbc	a,a
+			and	b
+			ld	l,c
+			ret	m
+			ld	d,61h
+			or	b1h
+			dec	a
+			dec	bc
+			xor	a
+			or	b
+			jp	z,L6d0b
+			ret	pe
+			add	a,e
+			ld	d,h
+			ld	h,98h
+			ld	c,l
+			rrca
+			add	a,a
+			and	0bh
+			jp	m,La45c
+			jp	z,Lfc0a
+			add	a,cch
+			rlc	l
+			ld	b,a
+			daa
+			jp	z,L9af9
+			add	hl,hl
+			ld	l,c
+			ld	a,d
+			add	a,b
+			in	a,(14h)
+			xor	d
+			ld	(hl),a
+			ld	(hl),e
+			nop (2x) *
+			ld	c,c
+			sub	(hl)
+			ld	a,b
+			ld	h,b
+			ld	d,b
+			halt
+			or	l
+			scf
+			and	c
+			ld	(hl),a
+			inc	a
+			inc	de
+			rst	28h
+			adc	a,c
+			ld	h,e
+			call	nc,Le301
+			ld	h,dah
+			rst	00h
+			and	b
+			ld	a,a
+			ld	d,c
+			ld	a,(de)
+			dec	sp
+			inc	d
+			inc	sp
+			dec	a
+			ld	b,b
+			cp	c
+			push	hl
+			ld	(hl),l
+			ld	c,12h
+			rla
+			sub	c
+			xor	b
+			jp	(hl)
+			db	1dh,beh,5eh,6fh,73h,cdh,7ah,7ch
+			db	f5h,d0h,d9h,bch,96h,e4h,0eh,99h
+			db	51h,e4h,7dh,8ch,43h,6ch,48h,f7h
+			db	3ah,ddh,f3h,bdh,e5h,e6h,3dh,c8h
+			db	9dh,bah,87h,4fh,64h,5bh,32h,24h
+			db	0bh,09h,1ah,f9h,6ah,14h,02h,3ah
+			db	87h,11h,2eh,01h,42h,66h,1eh,ebh
+			db	14h,2ah,8bh,2fh,74h,81h,57h,d5h
+			db	41h,42h,35h,e3h,beh,beh,8bh,3eh
+			db	3bh,65h,7eh,d9h,f5h,d7h,d6h,c4h
+			db	6dh,f9h,46h,c9h,adh,4bh,09h,22h
+			db	8ah,85h,f4h,1fh,44h,68h,21h,fah
+			db	77h,beh,4ch,a1h,35h,cch,dfh,c2h
+			db	62h,49h,8bh,4eh,32h,f7h,a2h,c6h
+			db	68h,7eh,c8h,26h,cbh,17h,cch,cah
+			db	ech,b2h,fch,52h,5bh,f0h,06h,d6h
+			db	ddh,33h,b3h,c6h,f1h,04h,d2h,afh
+			db	61h,7ah,71h,cdh,33h,d5h,44h,80h
+			db	f4h,9eh,25h,3ah,3ah,e6h,f4h,15h
+			db	87h,07h,cch,09h,cdh,6ah,e2h,54h
+			ld	(de),a
+			xor	3ch
+			or	(hl)
+			sbc	a,b
+			ld	b,e
+			exx
+			and	c
+			dec	l
+			sbc	a,e
+			sub	h
+			ret	pe
+			xor	c
+			ld	a,l
+			adc	a,a
+			ld	b,b3h
+			xor	a
+			ld	b,d
+			or	e
+			jp	p,L0018
+			ret	nz
+			ld	b,43h
+			ld	d,e
+			ccf
+			rst	10h
+			and	(hl)
+			pop	bc
+			ld	a,(de)
+			ld	c,h
+			ld	l,c
+			ld	hl,(7710h)
+			sbc	a,d
+			ld	b,d
+			jp	z,L5a3b
+			inc	c
+			call	pe,Lf233
+			inc	c
+			ld	c,d
+			ld	a,a
+			dec	d
+			ret	p
+			sbc	a,l
+			nop (2x) *
+			ld	(hl),h
+			ld	(hl),d
+			ld	c,a
+			ex	de,hl
+			ex	af,af'
+			cp	d0h
+			sbc	a,d
+			call	nc,Lcdf9
+			scf
+			rst	10h
+			ld	e,h
+			add	a,c
+			ld	e,d
+			ret	c
+			ld	d,a
+			add	a,h
+			im	2 *
+			ld	(hl),61h
+			dec	e
+			ld	(e10fh),hl
+			xor	0bh
+			ld	a,c
+			ld	e,l
+			pop	de
+			xor	d
+			sbc	a,h
+			out	(21h),a
+			dec	b
+			ld	l,a
+			ld	l,l
+			add	a,a
+			sbc	a,l
+			call	po,L1076
+			rla
+			sub	l
+			nop (2x) *
+			ld	e,c
+			dec	d
+			ret
+			db	1dh,78h,82h,f5h,7ah,f0h,54h,7ah
+			db	97h,c5h,95h,34h,12h,93h,4ah,bch
+			db	f3h,ceh,8bh,5ch,3ch,d9h,92h,deh
+			db	9ah,93h,34h,25h,08h,e0h,f2h,37h
+			db	eah,12h,63h,87h,40h,a1h,33h,9ah
+			db	1ch,22h,42h,f7h,ddh,24h,6fh,a1h
+			db	53h,2eh,d5h,3ch,9dh,5dh,1bh,70h
+			db	90h,cdh,3fh,56h,bfh,b8h,f2h,53h
+			db	7fh,89h,6ch,e6h,a2h,93h,e3h,03h
+			db	75h,a1h,80h,16h,9ah,d2h,cah,52h
+			db	c8h,33h,32h,8ch,e7h,1fh,a4h,d3h
+			db	2ch,11h,ach
+			add	a,00h
+			ld	c,b
+			rst	30h
+			and	(hl)
+			or	c
+			ld	h,h
+			xor	b
+			cp	c
+			call	c,L5533
+			ld	(de),a
+			add	a,(hl)
+			scf
+			adc	a,93h
+			inc	de
+			ld	(hl),b
+			ld	d,h
+			di
+			ex	de,hl
+			ret	m
+			sub	(hl)
+			adc	a,b5h
+			call	Lf287
+			dec	b
+			sub	h
+			cp	d
+			ld	(hl),d
+			and	39h
+			rst	00h
+			push	bc
+			call	z,L4934
+			ld	a,(hl)
+			rra
+			ld	c,l
+			dec	sp
+			ld	a,c
+			jp	pe,L2228
+			ld	l,h
+			ld	hl,4bf9h
+			pop	hl
+			ld	b,l
+			xor	(hl)
+			ex	(sp),hl
+			ld	(hl),c
+			sub	e
+			sub	b
+			cp	h
+			pop	bc
+			ld	b,d
+			xor	a
+			ld	a,l
+			push	bc
+			adc	a,00h
+			ld	h,a
+			sbc	a,c
+			dec	de
+			add	hl,hl
+			nop (2x) *
+			ld	e,c
+			call	L1224
+			ld	d,a
+			or	b
+			sub	d
+			or	(hl)
+			ld	(hl),h
+			halt
+			rrca
+			jp	z,L1293
+			sbc	a,f7h
+			ld	h,a
+			ld	d,b
+			in	a,(3eh)
+			call	po,Ld6e8
+			call	nz,Lef0d
+			ld	(hl),c
+			rst	20h
+			xor	7dh
+			and	d
+			cp	(hl)
+			rst	20h
+			ld	l,h
+			ld	sp,dcceh
+			cp	l
+			ld	e,l
+			ld	c,h
+			ld	l,c
+			inc	a
+			xor	a
+			ld	h,(hl)
+			ld	a,l
+			and	3ch
+			ld	a,(hl)
+			ld	a,(bc)
+			xor	d
+			ld	b,(hl)
+			rst	10h
+			or	l
+			sub	(hl)
+			ld	h,19h
+			sbc	a,h
+			ld	e,b
+			rrca
+			call	pe,L0de5
+			ld	sp,hl
+			or	(hl)
+			xor	(hl)
+			rst	30h
+			ld	a,(hl)
+			ld	b,(hl)
+			ld	c,(hl)
+			rra
+			or	c
+			inc	a
+			ld	e,l
+			ld	sp,775ch
+			ld	h,c
+			ld	(hl),c
+			and	(hl)
+			and	h
+			or	e
+			dec	(hl)
+			add	a,e8h
+			ret	po
+			xor	bbh
+			dec	c
+			call	c,L38ce
+			call	p,L2460
+			ld	l,e
+			adc	a,h
+			ld	(hl),b
+			rst	38h
+			ld	(hl),d
+			call	c,L7238
+			nop (2x) *
+			cp	a
+			jp	nz,Lec2d
+			ld	e,64h
+			cp	d
+			ld	e,e
+			sub	a
+			call	pe,Lc2bf
+			or	a
+			add	hl,sp
+			add	a,h
+			xor	d
+			or	b
+			jp	nc,Lbf80
+			sub	a
+			ret	c
+			call	po,L1d6f
+			ld	c,l
+			and	55h
+			ld	(de),a
+			dec	(hl)
+			cp	a
+			ret
+			db	a5h,a1h,b4h,04h,95h,4dh,6ah,25h
+			db	e9h,d6h,94h,a0h,99h,30h,ebh,3ch
+			db	7fh,c3h,e4h,16h,06h,cdh,eah,97h
+			db	61h,adh,66h,e6h,c7h,77h,b0h,5fh
+			db	f7h,a9h,79h,feh,19h,a7h,3eh,01h
+			db	e8h,feh,66h,d8h,50h,1ah,ffh,f5h
+			db	b1h,41h,98h,96h,28h,74h,0eh,05h
+			db	7bh,7ch,6eh,bch,bdh,05h,6eh,69h
+			db	57h,55h,b2h,68h,19h,d5h,14h,4dh
+			db	b2h,b9h,04h,c2h,27h,12h,c5h,8bh
+			db	6dh,91h,30h,6bh,bah,d2h,02h,f2h
+			db	8bh,45h,37h,4bh,2dh,6ch,1fh,e8h
+			db	a8h,e0h
+			adc	a,a
+			add	a,c
+			cp	b
+			add	hl,bc
+			nop (2x) *
+			ld	b,b
+			ex	de,hl
+			dec	e
+			rla
+			rst	30h
+			ld	(hl),e
+			dec	hl
+			xor	b
+			inc	c
+			ld	bc,9b69h
+			add	a,l
+			jp	nz,L3b2e
+			ld	bc,de22h
+			ld	b,a
+			pop	hl
+			inc	d
+			call	p,L0de6
+			or	d
+			ld	h,75h
+			rst	20h
+			ld	b,(hl)
+			ld	a,(8ac1h)
+			and	c
+			inc	b
+			inc	b
+			sbc	a,a
+			ld	l,b
+			add	hl,de
+			dec	e
+			call	nc,L943d
+			ld	c,h
+			or	c
+			cp	47h
+			add	a,h
+			adc	a,e
+			rrca
+			in	a,(80h)
+			and	h
+			add	hl,de
+			sub	d
+			dec	bc
+			ld	e,e
+			push	af
+			ld	h,b
+			ld	c,3eh
+			ld	a,d
+			ld	c,h
+			ld	e,a
+			add	a,h
+			inc	bc
+			rst	30h
+			rlca
+			ld	c,(hl)
+			ld	h,e
+			ld	(hl),d
+			ld	b,h
+			add	hl,de
+			ld	h,b
+			ld	b,a
+			ld	h,c
+			sbc	a,d
+			ld	c,b
+			sub	h
+			dec	h
+			ld	l,e
+			xor	b
+			or	l
+			ld	c,e
+			or	d
+			call	z,L86a4
+			ld	l,a
+			dec	de
+			rst	28h
+			ld	b,a
+			ld	(8351h),a
+			rst	08h
+			sub	a
+			pop	hl
+			and	(hl)
+			ld	c,c
+			ld	d,l
+			and	a
+			xor	l
+			ld	a,c
+			ld	h,(hl)
+			rrca
+			xor	c
+			rst	30h
+			call	p,Lc01a
+			jr	Lab35
+			db	57h,78h,5ah,00h,5eh,2eh,b2h
+			inc	bc
+			jr	Labb6
+			db	02h,93h,a2h,36h,82h,c7h,6ch,eah
+			db	9fh,7ah,2fh,73h,f5h,6ch,6dh,40h
+			db	5ch,bdh,4ch,72h,ebh,94h,a2h,99h
+			db	eeh,39h,97h,99h,59h,c0h,58h,41h
+			db	e9h,aah,b4h,50h,44h,49h,89h,ddh
+			ld	h,d
+			push	af
+			add	hl,de
+			rlca
+			xor	l
+			ret	pe
+			ret	p
+			ret	z
+			ld	b,67h
+			rst	00h
+			rst	28h
+			inc	de
+			ld	b,h
+			ld	c,c
+			nop (2x) *
+			adc	a,h
+			ld	a,(076bh)
+			inc	de
+			ld	a,(hl)
+			sbc	a,b
+			inc	b
+			xor	b
+			adc	a,a
+			ld	l,h
+			cp	l
+			ret	z
+			ld	a,l
+			djnz	Lab7c
+			ld	a,h
+			call	m,L3846
+			ld	c,e
+			cp	a
+			cpl
+			ld	a,b
+			xor	c
+			nop
+			ld	sp,hl
+			nop (2x) *
+			and	(hl)
+			ld	(hl),c
+			sbc	a,(hl)
+			ret
+			db	4bh,8fh,73h,72h
+			add	hl,sp
+			ld	d,76h
+			neg
+			ld	(hl),h
+			ld	e,h
+			rst	38h
+			ld	(hl),d
+			dec	c
+			cp	a
+			rst	00h
+			ld	(hl),a
+			xor	d
+			dec	e
+			ld	d,d
+			ld	d,07h
+			ld	e,h
+			and	c
+			or	l
+			exx
+			sub	b
+			ld	h,e
+			dec	(hl)
+			jp	nc,L9856
+			inc	bc
+			xor	4fh
+			pop	hl
+			ld	(hl),eeh
+			sbc	a,e
+			or	b
+			add	a,c
+			inc	a
+			jp	nz,L4198
+			adc	a,d
+			call	nc,L10bc
+			ld	c,9ah
+			jr	Lac4e
+			db	5eh,bch,f5h,8ah,d5h,9fh,d2h,03h
+			db	dch,2eh,68h,0ah,20h,25h,46h,e8h
+			db	89h,59h,c6h,bdh,47h,ech,a5h,70h
+			jp	c,Lf3e2
+			ld	c,d
+			ld	a,a
+			cpl
+			ex	(sp),hl
+			sbc	a,l
+			push	de
+			adc	a,(hl)
+			dec	c
+			add	a,c
+			ld	d,a
+			call	c,Ld75c
+			ld	c,b
+			dec	a
+			ld	h,l
+			dec	de
+			ld	sp,c5e9h
+			jr	c,Labdd
+			or	d
+			ld	l,h
+			cp	a
+			cp	e
+			ex	(sp),hl
+			ld	de,3570h
+			jp	m,L8811
+			pop	hl
+			rra
+			add	a,a
+			ld	a,e
+			sub	(hl)
+			dec	b
+			sbc	a,l
+			ld	d,b
+			ret
+			db	bbh,38h,39h,7dh,07h,12h,2ch,f2h
+			db	52h,d5h,3ah,88h,90h,39h,9ah,27h
+			db	27h,e0h,89h,f2h,9dh,f0h,ffh,bah
+			db	44h,88h,e9h,51h,2bh,b1h,0ah,e2h
+			db	1bh,e7h,f4h,c3h,0eh,3fh,34h,66h
+			db	98h,92h,67h,70h,fbh,65h,d5h
+			dec	(hl)
+			ccf
+			call	c,Lc505
+			or	a
+			dec	c
+			and	l
+			ld	l,c
+			pop	hl
+			call	c,L68ce
+			sub	b
+			call	c,Lcb06
+			ld	(hl),d2h
+			push	de
+			call	nz,Lecbc
+			adc	a,(hl)
+			ret	po
+			ld	b,b
+			call	nc,L34ef
+			add	hl,bc
+			ld	d,a
+			call	m,La1e9
+			jr	Lad13
+			db	6bh,90h,79h,eah,b0h,cdh,f3h,83h
+			db	5ch,6ah
+			ld	l,d
+			jr	z,Lac51
+			sub	ixl *
+			rra
+			ld	(hl),c
+			xor	h
+			ld	l,c
+			ld	a,l
+			sub	e
+			xor	a
+			jr	Lad19
+			db	c7h,ffh,c4h,6eh,dah,f6h,a1h,d3h
+			db	0ah,8fh,5ah
+			ccf
+			sub	e
+			sub	b
+			sub	(hl)
+			jp	(hl)
+			db	1ah,e5h,f6h,68h,29h,3eh,65h,b8h
+			db	1dh,05h,80h,fdh,5bh,28h,ach,8ch
+			db	45h,ebh,52h,d5h,70h,9ch,53h,0dh
+			db	fbh,5ah,56h,cbh,ech,a8h,d2h,1eh
+			db	53h,a1h,8dh,9eh,3dh,d1h,19h,c8h
+			db	61h,6eh,f9h,bch,84h,87h,17h,46h
+			db	14h,71h,59h,80h,4ch,f5h,0ah,46h
+			db	6ch,91h,67h,16h,29h,0eh,7eh,49h
+			db	1dh,2ch,21h,97h,52h
+			ld	d,h
+			sub	l
+			call	nz,L24eb
+			pop	af
+			add	a,l
+			rst	38h
+			add	hl,de
+			push	af
+			ex	(sp),hl
+			ld	(hl),d
+			call	c,L1b83
+			ld	c,c
+			ld	c,(hl)
+			jp	L7cfc
+			db	61h,a1h,19h,dch,16h,e4h,5ah
+			ld	h,(hl)
+			ld	c,l
+			inc	(hl)
+			ld	l,5ch
+			ld	l,a
+			rst	10h
+			ret	m
+			cp	d
+			add	a,d
+			ld	b,e
+			inc	bc
+			xor	b
+			ld	(hl),c
+			call	po,L1e7d
+			inc	hl
+			ld	d,d
+			and	b
+			inc	a
+			dec	h
+			rst	28h
+			ld	a,l
+			ld	a,(de)
+			ld	l,c
+			dec	e
+			ld	(hl),ebh
+			jr	nz,Lad2e
+			ld	(de),a
+			sbc	a,b
+			xor	l
+			add	a,44h
+			jp	pe,L12c5
+			ld	(hl),3bh
+			ld	d,l
+			ret	nz
+			call	c,Lff93
+			or	l
+			rst	30h
+			ld	sp,hl
+			ld	h,l
+			ld	(hl),e
+			sbc	a,70h
+			ld	l,e
+			ld	a,b
+			ret	z
+			pop	bc
+			cp	a
+			cp	d
+			add	a,b
+			add	a,b
+			exx
+			cp	f0h
+			ld	de,d983h
+			call	po,Lfcc1
+			xor	h
+			dec	bc
+			ld	a,l
+			adc	a,d
+			inc	a
+			ld	b,l
+			ld	a,c
+			ld	d,e
+			ex	af,af'
+			ld	h,(hl)
+			pop	de
+			ld	e,a
+			ld	a,(de)
+			jp	z,Lc41f
+			ld	c,(hl)
+			ld	d,h
+			add	hl,sp
+			sub	l
+			jr	nc,Lad2f
+			ret	m
+			sub	a
+			adc	a,d
+			ld	b,a
+			add	a,(hl)
+			inc	b
+			ld	a,e
+			ld	h,e
+			sub	h
+			ld	a,(hl)
+			jr	c,Ladf9
+			ld	e,e
+			inc	bc
+			jp	nc,L0acb
+			cpl
+			or	b
+			ld	b,l
+			dec	sp
+			ld	d,89h
+			rst	20h
+			add	a,d
+			ld	a,a
+			ld	b,h
+			adc	a,b
+			cp	61h
+			dec	hl
+			ld	e,b
+			ld	hl,6ec3h
+			ld	d,e
+			ld	c,e
+			ret	pe
+			sub	l
+			ld	d,l
+			ld	(hl),b
+			ld	c,b
+			ld	(de),a
+			or	90h
+			ld	l,(hl)
+			and	a
+			ld	c,a
+			ld	l,(hl)
+			dec	sp
+			ld	l,02h
+			rla
+			ld	e,e
+			xor	a
+			cp	h
+			xor	a
+			inc	d
+			in	a,(beh)
+			rst	20h
+			ld	(hl),d
+			sbc	a,d
+			xor	h
+			di
+			out	(a9h),a
+			jp	nz,L8e03
+			rst	38h
+			add	a,d
+			ld	h,(hl)
+			jp	nc,Lbeaa
+			scf
+			call	pe,L71f7
+			sub	b
+			ld	c,h
+			adc	a,(hl)
+			add	hl,sp
+			ld	c,c
+			add	a,e
+			ld	l,a
+			jp	z,L4edf
+			adc	a,(hl)
+			call	nc,L028d
+			add	a,d
+			sbc	a,b
+			call	nz,L0d8b
+			and	(hl)
+			rst	10h
+			ld	b,h
+			xor	a
+			and	e
+			ld	l,c
+			ld	h,c4h
+			ld	d,c
+			jr	nz,Lae72
+			and	b
+			ld	e,e
+			cp	c
+			ld	a,c
+			cp	b
+			ld	(de),a
+			ld	a,a
+			ld	h,h
+			ld	d,(hl)
+			ld	c,a
+			jp	m,Lca57
+			inc	e
+			ld	a,a
+			ld	d,e
+			ld	b,a
+			ld	c,d
+			xor	a
+			and	h
+			sub	e
+			ld	h,23h
+			cp	c
+			ret	p
+			ld	h,h
+			adc	a,f0h
+			sub	(hl)
+			ld	c,l
+			ld	a,5ah
+			adc	a,c8h
+			call	nz,L4a4d
+			jr	nz,Lae3a
+			jp	(hl)
+			db	96h
+			ld	c,d
+			ld	b,c
+			ret	c
+			ld	e,a
+			sub	d
+			sbc	a,e
+			add	a,b
+			ld	e,a
+			jr	nz,Lae46
+			xor	(hl)
+			sub	5eh
+			adc	hl,de
+			add	a,0ch
+			and	l
+			adc	a,d
+			jr	Laeaf
+			db	dch,f4h,abh,01h
+			add	a,c
+			ld	a,(hl)
+			jr	nz,Lae21
+			ld	d,83h
+			ret	c
+			sub	b
+			set	2,b
+			ld	(hl),c
+			ld	(e1cdh),a
+			rst	08h
+			ld	a,(b4abh)
+			ld	h,b
+			ld	(5ac7h),a
+			ld	e,e
+			inc	l
+			ccf
+			ld	d,iyl *
+			xor	d
+			sbc	a,d9h
+			call	pe,L186a
+			inc	d
+			ret	m
+			dec	(hl)
+			ccf
+			ret	nc
+			ld	b,a
+			ret	p
+			pop	de
+			ld	c,d
+			ld	b,(hl)
+			jp	p,L1888
+			ld	a,l
+			sub	a
+			ld	a,d
+			inc	b
+			ld	b,(hl)
+			or	c
+			jp	(hl)
+			db	1dh,f4h,e6h
+			add	a,a
+			pop	bc
+			pop	de
+			inc	bc
+			ld	b,h
+			ld	c,l
+			ld	e,h
+			ld	d,d
+			adc	a,d
+			ld	bc,1fefh
+			ld	l,a
+			rst	10h
+			ld	a,(bc)
+			call	po,L2966
+			sbc	a,(hl)
+			adc	a,40h
+			add	a,e
+			xor	e
+			jp	p,L2837
+			jp	nz,L1356
+			ld	b,37h
+			ld	b,a
+			sub	b
+			ld	l,a
+			sub	(hl)
+			push	hl
+			ld	a,bah
+			jp	(hl)
+			db	01h,afh,73h
+			adc	a,a
+			adc	a,(hl)
+			sbc	a,(hl)
+			jp	z,L43ce
+			ld	a,(hl)
+			ld	b,b
+			jp	nz,Ld994
+			ld	d,e
+			adc	a,l
+			ld	e,(hl)
+			inc	de
+			sbc	a,c
+			ld	h,(hl)
+			rlca
+			add	hl,sp
+			ld	d,e
+			ld	b,(hl)
+			or	(hl)
+			adc	a,d
+			and	c
+			and	h
+			ret
+			db	c3h,dch,dah,dfh,10h,1ah,1ch,c1h
+			db	86h,27h,5dh,49h,19h,16h,98h,ddh
+			db	8ch,0dh,deh,35h,cch,64h,bah,32h
+			db	bfh,c4h,deh,b4h,85h,3ah,98h,17h
+			db	17h,11h,4dh
+			inc	sp
+			ld	e,e
+			adc	a,a
+			jp	(hl)
+			db	0ch,efh,01h,2eh,90h,8bh,44h,b7h
+			db	bch,87h,8fh,0ch,28h,03h,f4h,fdh
+			db	3ch,99h,deh,76h,f1h,a9h,e4h,d6h
+			db	74h,68h,e0h,fah,0eh,60h,bdh,f4h
+			db	dbh,adh,b3h,e7h,c7h,d9h,83h,8eh
+			db	63h
+			ld	a,l
+			ld	d,l
+			ld	c,b
+			rst	38h
+			ld	hl,ea49h
+			sub	4fh
+			call	z,L808e
+			jp	m,L2db3
+			ei
+			rla
+			exx
+			jr	nz,Lae9c
+			jp	po,L11d4
+			sub	e
+			ld	h,e
+			inc	d
+			jp	(hl)
+			db	6fh,e4h,3bh,90h,f8h,66h,ceh,07h
+			db	fbh,efh,81h,5fh,9eh,beh,a5h,4ch
+			db	b8h,99h,bbh,c2h,97h,0ah,64h,a3h
+			db	abh,5bh,0bh,f6h,9bh,65h,52h,33h
+			db	63h,99h,29h,ffh,3eh,f6h,bch,e3h
+			db	9ch,cah,29h,abh,51h,b8h
+			cp	a
+			jr	nz,Laf98
+			or	b
+			add	hl,sp
+			cp	h
+			sbc	a,e
+			adc	a,a
+			ld	c,h
+			adc	a,e
+			res	1,a
+			di
+			jr	nz,Laf4f
+			ld	h,a
+			or	l
+			ld	sp,hl
+			push	hl
+			ld	h,d
+			cp	h
+			ld	e,(hl)
+			and	c
+			or	d
+			ld	h,a
+			rst	18h
+			ld	a,a
+			jp	L0cd5
+			db	cbh,2fh,18h,b3h,73h,bfh,44h,73h
+			db	8fh,5eh,36h,2bh,fah,35h,2bh,17h
+			db	56h,63h,e0h,afh,bdh,15h,f2h,20h
+			db	8ah
+			jp	pe,L156a
+			sub	l
+			ld	b,36h
+			ld	b,c
+			jr	nc,Laf17
+			ld	h,l
+			ld	(bf3ah),a
+			adc	a,a
+			ld	a,(0dabh)
+			xor	d
+			ld	a,(hl)
+			inc	a
+			ld	a,(bc)
+			ld	l,h
+			add	hl,bc
+			exx
+			ld	(hl),d
+			ex	(sp),hl
+			ld	b,c
+			sbc	a,86h
+			dec	de
+			rst	30h
+			ld	sp,7f00h
+			and	c1h
+			ld	a,b
+			ld	e,a3h
+			ld	h,l
+			rst	30h
+			and	c4h
+			ret	c
+			sbc	a,a
+			cp	a
+			adc	a,b
+			jp	pe,L0575
+			in	a,(b6h)
+			ld	e,c
+			sbc	a,c
+			call	c,L5dc8
+			add	hl,sp
+			nop (2x) *
+			xor	c
+			adc	a,c
+			call	p,L4910
+			in	a,(61h)
+			ccf
+			ld	c,e
+			jr	z,Laf56
+			pop	af
+			xor	h
+			pop	af
+			ret	p
+			add	a,a
+			rst	08h
+			call	pe,L382a
+			ret	pe
+			ld	l,l
+			ld	a,d
+			ld	c,d
+			dec	de
+			ld	hl,(d5d4h)
+			ld	b,c
+			dec	de
+			add	hl,hl
+			pop	bc
+			ld	c,c
+			ld	b,b
+			ld	b,a
+			call	pe,L4191
+			add	a,d
+			ld	e,(hl)
+			ccf
+			ld	h,c
+			rra
+			ld	l,l
+			ld	a,(b042h)
+			ld	e,b
+			cp	d
+			ld	(hl),d
+			sub	(hl)
+			ld	(de),a
+			exx
+			ld	(bc),a
+			ld	c,h
+			ld	a,e
+			push	bc
+			and	b
+			ret	nz
+			sbc	a,e
+			ld	b,d
+			ld	l,h
+			rlca
+			or	c
+			ld	(2c9dh),a
+			or	e3h
+			ld	l,e7h
+			sbc	a,b
+			sbc	a,c
+			cp	d
+			ei
+			adc	a,(hl)
+			ld	c,a
+			xor	(ix + 72h)
+			and	d
+			xor	e
+			rst	28h
+			nop
+			add	hl,bc
+			add	a,l
+			ld	c,a
+			or	85h
+			halt
+			nop (2x) *
+			and	e
+			xor	12h
+			push	hl
+			ld	h,a
+			out	(0eh),a
+			jr	z,Lb034
+			call	pe,Lcffa
+			add	a,l
+			push	bc
+			jp	po,L3d4e
+			ld	e,h
+			dec	b
+			sub	h
+			jp	nz,Ld5b7
+			jp	z,L0dc6
+			rla
+			jr	c,Lb065
+			ld	b,d
+			adc	a,d0h
+			add	hl,de
+			ex	af,af'
+			and	h
+			inc	c
+			adc	a,(hl)
+			ld	h,05h
+			sbc	a,h
+			ld	l,e
+			ld	(c235h),a
+			add	a,a
+			jp	pe,L299f
+			xor	(hl)
+			ld	h,a
+			ld	c,l
+			ld	b,c
+			ret
+			db	3eh,b9h,b9h,dah,9dh,ech,40h,18h
+			db	0eh,1dh,8dh,d3h,ddh,8ch,78h,72h
+			db	fch,9ah
+			ld	c,h
+			dec	c
+			ld	l,a7h
+			push	bc
+			ld	(hl),d
+			call	p,Lde85
+			dec	l
+			cp	l
+			ld	e,a
+			or	a
+			ld	l,d
+			add	a,e
+			ei
+			cp	l
+			rst	18h
+			dec	d
+			and	d
+			inc	b
+			ld	h,c
+			pop	af
+			ld	l,h
+			scf
+			ld	b,a
+			ld	d,e
+			ld	l,a
+			ld	d,c
+			ld	c,c
+			ld	l,d
+			ld	hl,(023eh)
+			jr	nc,Lb044
+			rst	18h
+			add	a,e
+			xor	b
+			jp	Lde3c
+			db	e7h,11h,fdh,8fh
+			or	c
+			or	e
+			rlca
+			or	(hl)
+			ld	(hl),64h
+			ret	pe
+			sbc	a,d
+			add	a,a
+			ccf
+			dec	bc
+			ld	d,a
+			or	8dh
+			nop (2x) *
+			ld	l,h
+			ret
+			db	12h,a3h,1ah,71h,40h,b0h,61h,8dh
+			db	1ah,13h,38h,b5h,37h,e2h,16h,0dh
+			db	a0h,0fh,04h,35h,b6h,6fh,e8h,c5h
+			db	f7h,98h
+			add	hl,sp
+			srl	l
+			cp	c
+			adc	a,e
+			ld	e,(hl)
+			dec	sp
+			sbc	a,a
+			ld	a,c
+			ld	de,229ch
+			jr	c,Lb0cd
+			ld	l,a
+			ld	c,l
+			rrca
+			jp	m,L973b
+			inc	a
+			ld	b,7ch
+			add	a,l
+			add	hl,bc
+			and	l
+			ld	h,c
+			or	b
+			add	a,76h
+			xor	h
+			call	nz,Ld0af
+			cp	l
+			add	a,c
+			or	d
+			jp	nz,Lb597
+			cp	h
+			ld	b,c
+			cp	e
+			ret	z
+			ld	a,l
+			pop	af
+			ld	(a8edh),hl
+			call	pe,Le4bd
+			cp	b
+			ret	p
+			ld	h,b
+			ei
+			rst	08h
+			ld	l,d
+			ld	c,h
+			scf
+			ex	af,af'
+			inc	a
+			call	p,L63e5
+			jr	nc,Lb11f
+			ld	l,b
+			ld	l,a
+			add	a,82h
+			dec	c
+			ld	(40d7h),hl
+			cp	a
+			ld	a,(hl)
+			ld	(4ce7h),hl
+			dec	l
+			ret	p
+			cp	a
+			sub	d
+			ld	h,l
+			ld	h,a
+			ld	d,e
+			cp	6ah
+			dec	d
+			push	de
+			sbc	a,b
+			ei
+			ld	(hl),c
+			sbc	a,9ah
+			sub	l
+			add	a,b
+			ld	h,h
+			xor	e
+			ld	d,(hl)
+			scf
+			or	e
+			call	z,L5203
+			and	(hl)
+			inc	e
+			sub	e
+			ld	d,d
+			ld	l,1eh
+			sbc	a,h
+			ld	h,c
+			add	a,c
+			rst	38h
+			dec	bc
+			dec	c
+			ld	d,efh
+			and	h
+			and	c
+			sub	e
+			ld	b,21h
+			and	c
+			ld	(hl),h
+			ld	b,d
+			ld	l,l
+			ld	h,b
+			adc	a,e
+			ret	p
+			and	d
+			ld	h,70h
+			ret	pe
+			ld	c,a
+			ld	(hl),c
+			sbc	a,c
+			ld	l,(hl)
+			inc	sp
+			rla
+			ret	nc
+			and	b
+			ld	(hl),4ch
+			jp	nz,L4caa
+			sbc	a,a
+			add	a,eah
+			ld	(bc),a
+			and	e
+			xor	c
+			ld	l,e
+			or	h
+			inc	l
+			ld	(hl),h
+			ld	(544ch),hl
+			dec	bc
+			push	bc
+			nop
+			add	a,a
+			ld	d,a
+			sub	h
+			ld	d,(hl)
+			sub	eah
+			sub	e
+			ld	e,d
+			ret	po
+			ld	d,d
+			ld	h,a
+			inc	d
+			adc	a,l
+			or	a
+			ld	(hl),a
+			ld	l,b
+			scf
+			ld	(hl),c
+			ld	d,b
+			inc	l
+			ld	c,c
+			call	L5cbf
+			ld	l,l
+			sub	4bh
+			or	b
+			ld	b,(hl)
+			ld	(hl),c
+			ld	e,a
+			ld	b,e
+			ld	h,l
+			ld	a,(bc)
+			ld	d,6eh
+			ld	(hl),22h
+			ld	l,(hl)
+			ld	(hl),d
+			and	h
+			ld	d,(hl)
+			ld	b,l
+			or	73h
+			sub	a
+			adc	a,l
+			or	c
+			call	nz,L6898
+			adc	a,h
+			cp	d
+			adc	a,c
+			ret	p
+			inc	b
+			jr	nc,Lb14f
+			call	z,L3141
+			cp	b
+			xor	b
+			push	de
+			ret	c
+			add	a,e
+			inc	l
+			xor	b
+			ld	h,b
+			ret
+			db	59h,9bh,d9h,90h,8ch,7dh,6bh,c3h
+			db	deh,15h,f1h,ach,a6h,6dh,9ch,ceh
+			db	3ch,83h,8fh,d4h,fch,3ah,1dh,48h
+			db	c6h,b0h,95h,1ch,edh,b2h,5dh,67h
+			db	45h,abh,88h,c9h,11h,eeh,aeh,dah
+			db	6fh,eah,6eh,1bh,4dh,fch,53h,feh
+			db	cfh,e4h,41h,31h,e5h,efh,29h,9ch
+			db	45h,aah,e5h,3ah,46h,24h,58h,62h
+			db	a7h,b7h,46h,87h,c9h,31h,8dh,f6h
+			db	09h,cfh,7eh,93h,1ah,bdh,36h,2ah
+			db	35h,b1h,06h,16h,49h,90h,b2h,4dh
+			db	a6h,3dh,1eh,89h,61h,beh,1ch,07h
+			db	22h,f0h,8eh,29h,82h,42h,b5h,61h
+			db	dah,05h,90h,0ah,ech
+			ld	l,d
+			ld	h,a
+			and	b
+			ld	b,e
+			inc	e
+			dec	h
+			rst	28h
+			cp	(hl)
+			cp	(hl)
+			ld	h,a
+			ld	e,d
+			in	a,(64h)
+			ret	z
+			ld	a,(de)
+			daa
+			ld	c,l
+			ld	e,c
+			or	(hl)
+			di
+			ld	l,e
+			sub	(hl)
+			or	l
+			ld	l,fah
+			and	d
+			sub	e
+			ld	(hl),6fh
+			sbc	a,l
+			di
+			dec	b
+			ld	l,05h
+			ret	z
+			or	c
+			ld	e,(hl)
+			add	hl,de
+			add	hl,sp
+			sub	l
+			dec	d
+			xor	l
+			ld	(hl),l
+			sub	e
+			ld	e,l
+			call	z,L1bbe
+			ld	(hl),d7h
+			jr	Lb289
+			db	40h,04h,eeh,53h,b3h,f8h,a0h,b0h
+			db	29h,45h,26h,09h,c3h,60h,0dh,cdh
+			db	2ch,75h,15h,cah,edh,aah,0fh,a3h
+			db	e4h,51h,79h,b3h,04h,9eh,c6h,1ch
+			db	feh,adh,92h,42h,83h,02h,80h,47h
+			db	b6h,13h,81h,73h,e7h,43h,9eh,fdh
+			db	10h,b7h,00h,72h,3bh,aah,cch,e0h
+			db	aeh,bdh,4ah,90h,deh,6eh
+			ld	(24d3h),a
+			ret	c
+			ret	po
+			ld	(hl),c
+			ld	d,h
+			dec	c
+			jr	nc,Lb22d
+			ld	d,c
+			jp	pe,L22d1
+			inc	a
+			jp	nz,L9f34
+			sbc	a,a
+			ld	a,(hl)
+			xor	(hl)
+			dec	d
+			dec	l
+			ld	e,e
+			ld	b,l
+			jr	c,Lb30e
+			ex	de,hl
+			ld	(hl),l
+			call	m,L6ae3
+			or	b
+			dec	(hl)
+			ld	b,a
+			rlca
+			and	a
+			dec	b
+			ld	d,l
+			rst	30h
+			ld	d,c
+			sub	c
+			call	nz,L15a2
+			ld	b,c
+			rst	08h
+			dec	d
+			ld	l,a
+			ld	b,b
+			ccf
+			ld	(de),a
+			and	d
+			call	p,L4869
+			ld	l,l
+			ret	pe
+			cp	d
+			cp	c
+			and	(hl)
+			jp	pe,L212b
+			ld	c,h
+			inc	l
+			ld	(de),a
+			sub	(hl)
+			and	l
+			and	c8h
+			rst	38h
+			ld	a,(hl)
+			call	p,Lc028
+			rra
+			dec	hl
+			sub	(hl)
+			ld	a,c8h
+			sbc	a,(hl)
+			rst	00h
+			ld	b,a
+			ld	h,eeh
+			ld	d,b
+			sub	a
+			add	a,l
+			cp	b
+			ld	a,a
+			add	hl,bc
+			ld	a,e
+			ld	c,a
+			nop (2x) *
+			rlca
+			adc	a,b
+			ld	a,(de)
+			ld	hl,4efch
+			ld	(a089h),hl
+			or	d
+			ld	(hl),e
+			ld	h,a
+			ld	h,a
+			ld	a,c
+			ld	c,b
+			rst	08h
+			ld	e,b
+			rst	08h
+			inc	e
+			ld	a,(de)
+			add	hl,hl
+			or	e
+			and	c
+			ld	(hl),d
+			ld	(hl),l
+			add	a,b
+			ld	d,d
+			or	(hl)
+			ld	a,(hl)
+			ld	b,c
+			ret	m
+			ei
+			or	d
+			ld	l,d
+			sub	(hl)
+			rrca
+			ld	b,(hl)
+			ld	hl,f4ebh
+			ld	d,h
+			sub	b
+			add	a,d
+			xor	a
+			or	a
+			ld	d,8ah
+			jp	z,Lda87
+			sub	b
+			jp	c,Leb50
+			ld	c,d
+			ld	e,(hl)
+			ret	nc
+			sbc	a,e6h
+			ld	l,l
+			ld	c,(hl)
+			cp	d
+			or	h
+			add	a,bch
+			ret	pe
+			ld	d,a
+			bit	5,c
+			ld	d,(hl)
+			xor	(hl)
+			rlca
+			ld	h,8eh
+			ld	a,l
+			inc	a
+			inc	de
+			and	l
+			rst	30h
+			sbc	a,e
+			xor	h
+			add	hl,hl
+			sbc	a,ceh
+			jp	(hl)
+			db	ech,20h,bch,9dh,84h,1eh,d8h,b3h
+			db	f7h,a5h,14h,61h,cbh,92h,eah,73h
+			db	11h,bch,5fh,feh,80h,8ch,6eh,f4h
+			db	d6h,39h,90h,c3h,c0h,36h,d5h,79h
+			db	2ch,63h,e6h,f7h,e6h,eeh,48h,eeh
+			db	56h,00h,68h,0ah,cfh,89h,cbh,e3h
+			db	6eh,d8h,71h,beh,9ch,dfh,beh,47h
+			db	feh,f2h,25h,efh,31h,61h,68h,e2h
+			db	84h,00h,87h,11h,e6h,16h,60h,e3h
+			db	ebh,0eh
+			call	c,La161
+			inc	a
+			ld	(bb5ch),a
+			sub	e
+			ret
+			db	e3h,d3h,81h,22h,89h,6fh,89h,a3h
+			db	7bh,e7h,12h,7ah,05h,abh,64h,4ch
+			db	b6h,37h,54h,98h,28h,39h,f4h,b6h
+			db	6eh,d7h,d1h,cah,b4h,4fh,8dh,64h
+			db	7bh,ech,cfh,99h,bch,f0h,8eh,83h
+			db	edh,d4h,66h,55h,abh,45h,17h
+			sub	d
+			sbc	a,l
+			add	hl,sp
+			dec	bc
+			ld	h,78h
+			ld	b,a
+			dec	sp
+			ld	d,d
+			dec	c
+			jr	nz,Lb3bf
+			ld	h,a
+			ld	h,e
+			adc	a,l
+			rst	28h
+			sub	b
+			cp	d
+			jp	c,L47ab
+			pop	de
+			ld	b,d
+			add	a,d
+			nop (2x) *
+			jp	L5372
+			db	89h,1ah,ffh,ddh,21h,f2h,25h,09h
+			db	88h,55h,12h,a9h,29h,42h,9ch,cdh
+			db	4ah
+			ld	h,b4h
+			inc	d
+			inc	e
+			ret	p
+			ei
+			add	hl,de
+			ld	a,e
+			or	b
+			inc	a
+			add	a,l
+			cpl
+			adc	a,a
+			nop (2x) *
+			xor	c
+			ld	b,c
+			ld	l,h
+			add	a,h
+			ld	l,d
+			ld	sp,hl
+			sub	d
+			pop	de
+			ex	de,hl
+			ld	a,a
+			push	de
+			ld	d,h
+			adc	a,h
+			sub	c
+			and	e
+			add	hl,hl
+			ret	nz
+			ld	(0625h),a
+			adc	a,b5h
+			ld	b,a
+			push	af
+			adc	a,(hl)
+			sub	h
+			jp	z,Lb58a
+			ld	e,h
+			jp	z,L078d
+			rra
+			cp	l
+			ld	e,c
+			ld	(hl),d
+			push	bc
+			rst	10h
+			sub	h
+			ld	c,(hl)
+			inc	bc
+			ld	b,e
+			dec	bc
+			adc	a,0dh
+			ld	b,(hl)
+			or	c
+			nop (2x) *
+			ret	c
+			ld	d,h
+			or	a
+			daa
+			daa
+			cp	h
+			di
+			jp	po,Le8ce
+			sub	c
+			call	m,L3a68
+			jp	p,L4647
+			dec	hl
+			rst	18h
+			ld	bc,f81fh
+			jp	c,L339a
+			ld	c,a
+			jp	nz,Le92b
+			ld	a,b
+			ld	l,h
+			rst	38h
+			dec	bc
+			dec	(hl)
+			ld	a,b
+			ld	hl,6cddh
+			add	a,d
+			ld	b,34h
+			ld	a,e
+			ld	d,c
+			ld	d,c
+			ld	d,b
+			ld	e,e
+			jp	po,L78be
+			ex	de,hl
+			ld	a,41h
+			ld	a,dfh
+			jr	nc,Lb428
+			inc	(hl)
+			jp	po,L94cd
+			jp	nc,L3d96
+			dec	b
+			ret	nc
+			pop	iy
+			add	a,c
+			call	po,L9c1e
+			ld	e,a
+			call	L2e7d
+			add	a,c
+			adc	a,a
+			ld	h,d
+			pop	de
+			ld	a,(bc)
+			xor	e
+			sbc	a,(hl)
+			ld	b,a
+			sbc	a,d
+			adc	a,h
+			ld	c,50h
+			ld	a,(de)
+			call	c,L1799
+			push	bc
+			ld	bc,dfcah
+			nop
+			jp	m,Lef8c
+			xor	d
+			adc	a,a
+			ld	a,(hl)
+			ld	h,d
+			ld	a,5eh
+			xor	e
+			ld	a,a
+			ld	(hl),h
+			ld	(hl),l
+			and	l
+			cp	(hl)
+			daa
+			dec	de
+			adc	a,h
+			inc	hl
+			add	a,(hl)
+			pop	hl
+			ld	bc,b16eh
+			ld	h,e5h
+			cp	l
+			jr	c,Lb4f7
+			sbc	a,h
+			and	d
+			ld	l,16h
+			ld	e,a
+			sub	(hl)
+			set	5,e
+			dec	(hl)
+			ld	h,c
+			ld	(hl),l
+			ld	(hl),c
+			cp	h
+			ld	(228fh),a
+			cp	d
+			sub	(hl)
+			ex	af,af'
+			dec	d
+			and	b
+			add	hl,sp
+			add	a,(hl)
+			call	nc,L45e3
+			inc	sp
+			and	h
+			add	hl,bc
+			pop	de
+			inc	d
+			jp	po,L4040
+			ld	a,(bc)
+			sbc	a,a
+			ld	c,d
+			ld	c,42h
+			ld	e,d0h
+			add	a,e
+			ld	e,h
+			ld	d,a
+			ld	a,(hl)
+			call	pe,Lfc4b
+			ld	(545ah),a
+			add	hl,hl
+			jr	c,Lb553
+			or	l
+			inc	h
+			ld	l,c
+			ex	af,af'
+			rst	00h
+			jp	(hl)
+			db	f9h,52h,5eh,6dh,2fh,27h,2dh,41h
+			db	28h,21h,49h,22h,ach,64h,40h,88h
+			db	79h,4ch,29h
+			ld	l,c1h
+			call	p,Ldb44
+			ld	l,(hl)
+			ld	c,5fh
+			add	hl,hl
+			ld	c,h
+			add	a,b
+			sbc	a,(hl)
+			ld	c,c
+			inc	d
+			ld	d,(hl)
+			ld	h,3eh
+			add	a,d
+			sub	d
+			add	hl,hl
+			xor	h
+			rlca
+			cp	(hl)
+			cp	l
+			sub	b
+			add	a,c
+			ld	a,h
+			ld	d,4eh
+			cp	(hl)
+			ld	b,b
+			ld	b,(hl)
+			ex	af,af'
+			sub	c
+			inc	d
+			xor	c
+			ld	d,e
+			call	Le0b0
+			ld	c,a
+			xor	a
+			xor	h
+			nop (2x) *
+			ld	sp,b0f8h
+			ld	b,c
+			pop	af
+			ld	h,d
+			or	h
+			ld	e,l
+			jp	(hl)
+			db	69h,71h,0ah,dah,7bh,d4h,f9h,a7h
+			db	25h,33h,83h,f4h
+			ei
+			push	af
+			sub	c
+			ld	(fa38h),hl
+			exx
+			ld	d,a
+			ld	h,a
+			ld	(hl),d
+			ld	(hl),h
+			rst	18h
+			inc	h
+			ret
+			db	90h,c4h,12h,c6h,8ah,93h,f4h,31h
+			db	63h,54h,04h,2dh
+			adc	a,a
+			sub	h
+			xor	h
+			in	a,(2ah)
+			ld	a,d
+			call	L9509
+			ret	nz
+			ld	e,a
+			nop
+			sub	c
+			ld	e,h
+			ex	af,af'
+			ld	c,(hl)
+			call	nc,L4806
+			halt
+			ret	m
+			ld	d,h
+			dec	h
+			ld	bc,02e4h
+			rst	10h
+			ld	(hl),c
+			adc	a,(hl)
+			ex	(sp),hl
+			inc	e
+			ld	c,l
+			ld	a,(hl)
+			ld	l,l
+			ld	b,6dh
+			ld	a,c
+			nop (2x) *
+			rrca
+			ld	b,b
+			xor	e
+			inc	a
+			and	b
+			ret	z
+			cp	c
+			ld	c,c
+			and	a
+			ld	a,(hl)
+			push	bc
+			ret	z
+			cp	l
+			sub	a
+			call	nz,L53b0
+			jr	Lb5df
+			db	afh,e3h,8dh,72h,f7h,40h,06h,08h
+			db	92h,e2h,5fh
+			ld	c,l
+			ld	sp,hl
+			inc	d
+			and	(hl)
+			adc	a,l
+			xor	l
+			xor	l
+			inc	l
+			cp	d
+			ld	c,(hl)
+			sbc	a,e
+			inc	h
+			push	af
+			rst	38h
+			rst	08h
+			nop
+			ld	a,a
+			call	c,Lddb8
+			ld	d,c
+			ld	e,l
+			jr	nc,Lb5e2
+			jp	nc,L7562
+			inc	h
+			dec	a
+			xor	e
+			ld	d,a
+			ld	h,d
+			adc	a,20h
+			ld	d,b
+			add	a,b
+			ld	(hl),b
+			push	de
+			ld	e,d
+			sub	d
+			xor	b
+			jp	nc,L1a6c
+			dec	h
+			ld	d,d
+			ld	l,a
+			jp	z,Ld9e4
+			ld	h,e
+			or	b
+			push	de
+			rst	18h
+			pop	bc
+			ret	z
+			adc	a,l
+			inc	h
+			rst	38h
+			adc	a,bbh
+			ld	a,4fh
+			nop (2x) *
+			ret	p
+			ld	a,(hl)
+			cp	(hl)
+			ld	hl,2296h
+			rla
+			ret	nc
+			ld	(hl),b
+			cp	c
+			ld	de,2288h
+			call	c,Lc957
+			or	b
+			dec	sp
+			scf
+			ld	e,c
+			ld	a,b
+			call	p,L1ce2
+			ld	l,c
+			ld	a,b0h
+			jp	m,L73d5
+			sbc	a,d
+			ld	d,a
+			adc	a,a
+			rst	18h
+			ld	d,ffh
+			nop
+			di
+			ld	b,d
+			ld	a,c
+			push	de
+			and	(hl)
+			rst	18h
+			ld	b,c
+			or	h
+			push	hl
+			ld	d,h
+			add	a,28h
+			adc	a,c8h
+			jp	Ldeea
+			db	56h,58h,47h,01h,23h,47h,b8h,ach
+			db	4ch,0eh,8eh,51h,f1h,71h,5bh,abh
+			db	29h,45h,98h,66h,d8h,62h,08h,8ch
+			db	fbh
+			pop	af
+			ld	b,h
+			halt
+			sbc	a,a
+			sub	(hl)
+			ld	e,c
+			ret	p
+			ld	(6b86h),hl
+			ld	bc,e7e9h
+			ld	l,e
+			ld	d,l
+			adc	a,h
+			ld	b,a
+			ld	b,l
+			cp	c
+			ld	a,b
+			or	c
+			jp	m,L2012
+			dec	h
+			ld	a,d
+			ld	c,l
+			add	a,l
+			inc	c
+			jr	nc,Lb5f6
+			ld	c,35h
+			or	b
+			sbc	a,c
+			ld	l,(hl)
+			nop (2x) *
+			cp	a
+			ld	a,l
+			sub	c
+			sub	(hl)
+			ld	e,a
+			ld	a,(hl)
+			rst	18h
+			ld	(hl),h
+			ld	e,58h
+			halt
+			add	hl,hl
+			push	af
+			adc	a,d
+			ld	h,e
+			rst	10h
+			adc	a,c
+			sub	h
+			and	c
+			jp	z,Lb3c6
+			rst	38h
+			inc	hl
+			ret	p
+			jr	nc,Lb658
+			rst	10h
+			cp	e8h
+			ld	(hl),l
+			dec	de
+			xor	87h
+			adc	a,l
+			inc	sp
+			adc	a,(hl)
+			ex	af,af'
+			rra
+			ld	l,h
+			cp	b
+			ret	nc
+			rst	18h
+			ld	c,h
+			ld	(hl),a
+			ld	e,c
+			ld	e,(hl)
+			djnz	Lb67f
+			di
+			add	hl,bc
+			ld	a,h
+			sub	l
+			sbc	a,b
+			adc	a,e
+			call	z,L768d
+			cp	l
+			ld	h,(hl)
+			out	(d1h),a
+			add	a,a
+			ld	a,fch
+			di
+			add	hl,hl
+			ld	a,c
+			cp	c
+			jr	c,Lb685
+			ex	af,af'
+			ld	(La389),a
+			ld	l,e
+			xor	b
+			cp	41h
+			sbc	a,a
+			ld	b,c
+			ld	h,h
+			ld	h,4ah
+			dec	c
+			push	hl
+			adc	a,(hl)
+			inc	c
+			or	3ch
+			rra
+			ld	hl,(0ae8h)
+			ld	r,a
+			ld	c,l
+			adc	a,(hl)
+			jp	nc,L7d45
+			ld	d,l
+			dec	a
+			ld	c,h
+			xor	l
+			ld	e,(hl)
+			jr	c,Lb666
+			ld	h,b
+			inc	e
+			rrca
+			sbc	a,d
+			call	Lf2c2
+			ld	a,l
+			ld	c,a
+			and	(hl)
+			ld	a,(de)
+			sub	c
+			ld	c,l
+			cp	(hl)
+			ld	a,a
+			sub	d
+			adc	a,49h
+			add	a,h
+			ret	pe
+			ld	a,c
+			push	af
+			call	c,L5bd1
+			and	b
+			ld	a,(hl)
+			call	nc,Ld0ef
+			jp	m,L9d4e
+			cp	d
+			ld	a,h
+			cp	1bh
+			ld	(bc),a
+			ld	l,e
+			ld	l,c
+			and	(hl)
+			adc	a,h
+			add	hl,de
+			nop (2x) *
+			ret	po
+			ret	nc
+			ld	hl,2a88h
+			ld	e,15h
+			ld	l,l
+			cp	h
+			sbc	a,(hl)
+			jp	nc,La4b8
+			xor	b
+			call	Lec2c
+			adc	a,h
+			add	a,(hl)
+			inc	sp
+			ld	c,d
+			sbc	a,(hl)
+			adc	a,h
+			ex	de,hl
+			in	a,(13h)
+			call	m,Lc805
+			ld	d,l
+			ld	e,l
+			sub	b
+			sbc	a,19h
+			inc	h
+			ld	sp,hl
+			ld	e,d
+			ld	l,b
+			xor	c
+			ld	bc,06e6h
+			ld	bc,5ddeh
+			inc	(hl)
+			ld	a,(hl)
+			jp	Lebd2
+			db	8dh,e4h,8bh,d9h,33h,59h,f2h,36h
+			db	c1h,5eh,e6h,9dh,cbh,08h,62h,d4h
+			db	6fh,38h,f0h,b0h,f6h,a4h,ffh,6eh
+			db	07h,c4h,1ah,73h,6dh,e9h,8dh,55h
+			db	10h,b8h,9ch,c8h,4ah,59h,53h,7ch
+			db	6fh,79h,a9h,32h,d4h,1bh,61h,5eh
+			db	e9h,21h,64h,6ah,71h,ceh,cbh,bch
+			db	8bh,d8h,9dh,60h,ech,6eh,2dh,0dh
+			db	84h,aeh,44h,04h,f5h,39h,6eh,1eh
+			db	40h,0fh,3eh,1ch,3eh,67h,10h,a5h
+			db	adh,3ah,aeh,cch,30h,51h,fdh,bfh
+			db	f9h,02h,26h,bah,d9h,72h,d3h,13h
+			db	56h,9ch,b5h,1eh,06h,58h,d2h,37h
+			db	c5h,1fh,0ch,26h,ech,74h,c8h,ech
+			db	66h,dch,50h
+			ld	d,e
+			ld	b,l
+			ld	l,e
+			dec	sp
+			or	c
+			in	a,(e9h)
+			inc	c
+			call	z,L4e49
+			ld	b,h
+			cp	h
+			jp	(hl)
+			db	ddh,17h,2dh,abh,56h,41h,79h,31h
+			db	42h,70h,4eh,7ah,16h,59h,c4h,74h
+			db	6fh,a6h,f1h,ebh,16h,3eh,e1h,9ch
+			db	9ah,dbh,b3h,0ch,aah,f6h,71h,97h
+			db	80h,4bh,ach,f2h,aah,20h,cch,fah
+			db	24h,40h,49h,d8h,30h,49h,04h,dbh
+			db	5ch,a7h,dbh,5bh,03h,58h,61h,36h
+			db	2ah,12h,83h,9eh,cch,e6h,8eh,f0h
+			db	5ah,94h,0bh,c7h,aeh,1bh,63h,8fh
+			db	9ch,12h,f3h,8bh,ebh,c9h,25h,f1h
+			ld	h,a
+			ld	e,(hl)
+			inc	iyl *
+			nop (2x) *
+			inc	a
+			ex	(sp),hl
+			xor	h
+			sub	d
+			ld	a,e
+			dec	l
+			sbc	a,e
+			rst	30h
+			jr	Lb788
+			db	6bh,d6h,8ah,e7h,2fh,88h,4eh,c5h
+			db	8fh,2ch,e0h,a1h,06h,7fh,8dh,cbh
+			db	26h,34h,3ah,66h,fbh,35h,2fh,57h
+			db	eah,74h,2bh
+			sbc	a,a
+			ld	a,(c4d0h)
+			ld	c,a
+			ld	(hl),a
+			dec	e
+			adc	a,d
+			ld	b,d
+			pop	de
+			ld	e,e
+			ld	c,1eh
+			ld	d,d
+			sbc	a,h
+			sbc	a,d
+			ld	b,b
+			rst	28h
+			ld	bc,aa19h
+			dec	bc
+			ret	p
+			and	e
+			ld	a,(6950h)
+			inc	c
+			ld	b,d
+			ei
+			xor	d
+			ret	c
+			ld	d,b
+			nop (2x) *
+			rra
+			ld	a,l
+			ld	l,e
+			adc	a,a
+			xor	a
+			ld	(0884h),hl
+			ld	c,h
+			adc	a,(hl)
+			and	(hl)
+			cp	a
+			call	po,L4026
+			sbc	a,(hl)
+			add	a,d
+			call	p,L284f
+			ld	h,h
+			ex	de,hl
+			inc	c
+			ld	l,c
+			rst	20h
+			inc	hl
+			push	de
+			inc	e
+			ld	c,18h
+			or	e
+			add	hl,sp
+			ld	h,b
+			ld	h,a
+			sbc	a,d
+			ld	d,e
+			ld	a,l
+			ld	l,a
+			ld	e,h
+			add	a,d
+			dec	(hl)
+			pop	de
+			jr	c,Lb879
+			xor	b
+			cp	l
+			push	af
+			sub	a
+			ld	l,h
+			adc	a,c
+			ret	z
+			ld	h,d
+			inc	b
+			ld	h,e
+			jp	z,La5fd
+			inc	c
+			add	hl,hl
+			inc	d
+			ld	e,e
+			ld	l,d
+			dec	d
+			or	b
+			sub	l
+			rla
+			and	l
+			ld	(hl),b
+			ld	h,53h
+			dec	b
+			adc	a,b
+			and	h
+			nop
+			add	hl,bc
+			xor	c
+			ld	c,h
+			add	a,h
+			and	90h
+			cp	b
+			inc	l
+			ld	d,l
+			jr	nc,Lb8cc
+			dec	e
+			adc	a,d
+			inc	d
+			dec	(hl)
+			sub	b
+			dec	(hl)
+			ld	(hl),h
+			ret
+			db	cdh,bch,60h,91h,ceh,97h,2ah,c6h
+			db	75h,c5h,63h,8ah,3fh,3dh,09h,1eh
+			db	cch,37h,90h,d5h,f9h,d7h
+			add	a,c
+			or	(hl)
+			ret	nz
+			ld	d,c
+			dec	de
+			ld	d,(hl)
+			or	h
+			adc	a,c
+			ld	(hl),h
+			di
+			adc	a,c
+			add	a,(hl)
+			call	m,L9f6b
+			add	hl,de
+			xor	84h
+			nop (2x) *
+			cp	b
+			ld	sp,2222h
+			ld	l,h
+			add	a,(hl)
+			ret	po
+			sbc	a,(hl)
+			jr	z,Lb85b
+			ld	a,(hl)
+			ld	(7a3bh),a
+			ret	nz
+			adc	a,c
+			xor	e
+			rlca
+			ld	a,(hl)
+			res	2,b
+			cp	b
+			ccf
+			jr	z,Lb8a7
+			call	m,Le38f
+			ld	h,c
+			pop	hl
+			call	nc,La521
+			sbc	a,l
+			di
+			ld	d,l
+			and	a
+			rst	30h
+			rrca
+			ld	sp,e923h
+			inc	(hl)
+			sbc	a,cbh
+			ret	z
+			sbc	a,(hl)
+			call	nz,L6028
+			cp	e
+			and	a
+			or	l
+			sbc	a,a
+			ccf
+			ld	a,b
+			add	a,d
+			ld	h,a
+			rra
+			sbc	a,l
+			sbc	a,a
+			jr	z,Lb922
+			ld	b,h
+			ld	c,h
+			ld	h,78h
+			adc	a,d
+			dec	b
+			adc	a,e
+			ret	c
+			rlca
+			cpl
+			sbc	a,b
+			ld	c,l
+			call	z,Lcdc6
+			jp	nz,Le563
+			dec	a
+			or	h
+			ld	a,74h
+			rst	28h
+			ld	c,l
+			inc	bc
+			ld	h,l
+			ld	a,l
+			ld	(bc),a
+			jp	iy
+			db	24h,deh,38h,1fh,72h,aeh,a4h,b2h
+			db	7eh,5fh,42h,f3h
+			and	8bh
+			inc	d
+			ld	(4dcfh),a
+			add	hl,de
+			add	a,h
+			sub	a
+			jp	c,Lde4d
+			or	3eh
+			in	a,(70h)
+			ld	e,d
+			dec	b
+			ld	e,l
+			or	c
+			ld	b,c
+			add	a,c
+			ld	e,90h
+			ex	af,af'
+			jr	Lb95f
+			db	31h,2dh,f7h,47h,3ch,60h,e8h,edh
+			and	c
+			call	p,L946b
+			ld	c,a
+			ld	e,l
+			sbc	a,b
+			ld	c,5dh
+			pop	hl
+			cp	l
+			ld	a,e
+			or	27h
+			and	e
+			push	bc
+			ld	a,(5c8ah)
+			ld	(103bh),a
+			ld	l,a
+			call	m,L7450
+			sbc	a,e
+			ld	(hl),36h
+			ret	c
+			ld	d,a
+			ld	e,e
+			call	pe,L1eb6
+			push	de
+			jr	nc,Lb905
+			ld	(hl),d
+			jp	nz,Lf9d7
+			ld	c,b
+			ld	e,l
+			call	c,Le2b9
+			ld	b,h
+			ld	(bcbah),a
+			ld	d,c
+			rst	10h
+			xor	47h
+			ld	l,4fh
+			inc	e
+			in	a,(28h)
+			ret	pe
+			rst	28h
+			and	(hl)
+			inc	c
+			adc	a,h
+			ex	af,af'
+			sbc	a,c
+			ld	(hl),6fh
+			add	a,h
+			adc	a,e
+			ret	pe
+			ld	e,b
+			ld	c,c5h
+			adc	a,2ah
+			rst	08h
+			jr	z,Lb915
+			sbc	a,b
+			ld	h,h
+			djnz	Lb9cb
+			ld	l,b
+			ld	(hl),d
+			ld	a,54h
+			ld	h,e
+			sbc	a,a
+			ld	b,d
+			ld	(hl),d
+			ld	h,b
+			ld	d,c
+			cp	e
+			ld	(hl),a6h
+			ret	nc
+			ld	(f4ach),hl
+			ld	a,(bc)
+			call	po,Lfbae
+			ld	(de),a
+			ld	e,a
+			add	a,h
+			ld	b,b
+			exx
+			ret	nc
+			jr	c,Lba2f
+			push	bc
+			ld	d,(hl)
+			dec	b
+			xor	b
+			jr	nz,Lb98c
+			add	a,a2h
+			adc	a,l
+			xor	(hl)
+			jp	pe,L51b4
+			add	hl,hl
+			inc	d
+			sbc	a,h
+			jr	z,Lb9c7
+			ld	hl,(6180h)
+			or	d
+			push	bc
+			ld	b,e
+			ld	(hl),a
+			call	pe,L4fda
+			ld	h,b
+			inc	b
+			cp	e
+			rst	20h
+			ld	sp,hl
+			add	a,d
+			ld	bc,f205h
+			exx
+			and	h
+			sbc	a,(hl)
+			ld	(hl),c
+			ret	c
+			sbc	a,c
+			ld	e,h
+			inc	d
+			call	p,L9b32
+			sbc	a,d
+			adc	a,(hl)
+			and	l
+			ld	hl,187eh
+			ld	l,e
+			and	b4h
+			ld	d,c
+			nop (2x) *
+			jp	pe,L1a2e
+			adc	a,3eh
+			inc	h
+			ld	h,h
+			call	po,Lc97a
+			call	z,Ld138
+			jr	Lba17
+			db	53h,34h,7ch,2fh,adh,cbh,cdh,5bh
+			db	4eh,b5h,f5h,8ah,fah,01h,8bh,22h
+			db	92h,b2h,c4h,cbh,37h,f4h,8ch
+			and	a9h
+			and	c
+			ld	c,h
+			add	a,c
+			push	hl
+			jr	nc,Lba3a
+			sub	a
+			ld	l,c
+			jp	po,Lacb0
+			call	c,L3d10
+			add	a,h
+			cp	(hl)
+			ld	e,d
+			rla
+			jp	c,Lc899
+			ld	l,(hl)
+			ld	c,e
+			ld	b,d
+			or	a
+			or	h
+			rst	10h
+			ld	(hl),e
+			ld	h,e
+			ld	(hl),l
+			sbc	a,l
+			add	hl,hl
+			inc	e
+			call	p,L4af8
+			nop (2x) *
+			cp	c
+			ld	b,d
+			or	(hl)
+			inc	hl
+			add	a,c
+			ld	(hl),b
+			adc	a,d
+			xor	a
+			ld	(hl),e
+			jp	pe,Lb9f7
+			sbc	a,h
+			ld	b,(hl)
+			ld	(hl),a
+			inc	a
+			ld	(bc),a
+			or	c
+			sbc	a,b
+			dec	hl
+			xor	h
+			ex	(sp),hl
+			ld	e,b
+			and	b
+			ld	e,d
+			dec	bc
+			call	nz,L5535
+			sub	c2h
+			ld	a,d
+			and	c
+			ld	l,b
+			sbc	a,52h
+			and	h
+			dec	(hl)
+			ld	c,a
+			rrca
+			or	h
+			adc	a,(hl)
+			jp	Lb8a6
+			db	c9h,e5h,74h,52h,3fh,0eh,3eh,7ah
+			db	f1h,a7h,d8h,9bh,dch
+			sub	e
+			ret	p
+			di
+			ld	e,c
+			ld	h,l
+			xor	h
+			ld	e,b
+			rst	00h
+			ld	h,l
+			xor	a
+			ld	h,a
+			exx
+			ld	l,a
+			ld	d,d
+			ld	e,c
+			ld	b,a
+			ld	l,h
+			sbc	a,h
+			ld	(fc33h),a
+			ld	e,l
+			inc	l
+			sbc	a,(hl)
+			ld	hl,a5b4h
+			inc	c
+			push	bc
+			sbc	a,e
+			inc	a
+			cp	d
+			ld	d,(hl)
+			jr	z,Lbaab
+			jr	nz,Lbac4
+			add	a,d
+			jp	c,L8226
+			ld	l,a
+			ld	(hl),c
+			sbc	a,l
+			ret	c
+			dec	h
+			nop (2x) *
+			jp	c,L15d7
+			or	c8h
+			ld	d,h
+			ld	c,a
+			push	bc
+			ret	nz
+			call	c,Le1ff
+			add	a,h
+			pop	hl
+			ld	d,e
+			call	nc,L89d9
+			inc	c
+			pop	af
+			ld	(hl),c
+			or	l
+			inc	h
+			ld	a,04h
+			dec	hl
+			ret	po
+			ld	h,(hl)
+			ld	e,b
+			rst	18h
+			adc	a,(hl)
+			nop (2x) *
+			dec	hl
+			inc	sp
+			ld	a,l
+			dec	sp
+			ld	(9890h),hl
+			ld	h,d
+			sbc	a,17h
+			ld	c,b
+			inc	de
+			inc	hl
+			ld	b,h
+			out	(8fh),a
+			inc	b
+			ld	b,(hl)
+			jp	nz,L38fb
+			sub	(hl)
+			ld	d,e
+			adc	a,90h
+			cp	e
+			ld	a,d
+			cpl
+			ld	b,e
+			ld	e,h
+			ld	l,d
+			add	a,4ch
+			ld	hl,(45e1h)
+			xor	l
+			jp	nz,Lb915
+			xor	a
+			ld	l,h
+			ld	a,i
+			xor	b
+			add	hl,bc
+			push	hl
+			ld	(bc),a
+			ld	e,b
+			add	hl,de
+			inc	b
+			ld	a,e
+			ld	e,2ah
+			sub	h
+			inc	d
+			add	a,a
+			ld	c,e
+			cp	a
+			ld	hl,(8807h)
+			dec	l
+			push	af
+			ld	(hl),c
+			rst	30h
+			rst	38h
+			ld	c,e
+			ld	a,b
+			jr	nc,Lbab1
+			ld	l,l
+			ld	(hl),e
+			or	c
+			sbc	a,b
+			and	e
+			ld	h,c
+			di
+			adc	a,c
+			inc	l
+			add	hl,hl
+			halt
+			rst	08h
+			ld	hl,e253h
+			inc	c
+			jp	z,L7712
+			inc	b
+			pop	hl
+			ld	c,(hl)
+			ld	e,54h
+			rst	30h
+			rla
+			or	59h
+			adc	a,(hl)
+			ld	h,h
+			dec	bc
+			dec	de
+			res	3,b
+			jp	pe,Lbe62
+			ld	c,l
+			ret
+			db	41h,e2h,62h,3ch,c9h,3bh,39h,55h
+			db	e1h,f7h,bch,dfh,1bh,c7h,ddh,54h
+			db	b9h,6dh,f0h,c9h,5dh,69h,56h,d8h
+			db	7ah,bch,68h,e5h,fdh,e3h,7ah,ddh
+			db	74h,26h,ech,58h,44h,00h,1bh,d3h
+			db	e5h,ebh,33h,99h,fch,adh,91h,5eh
+			db	eah,e8h,61h,e7h,b1h,deh,62h,42h
+			db	53h,e4h,0bh,2eh,1dh,97h,2ah,fch
+			db	ech,7bh,f9h,b4h,d0h,e4h,f7h,abh
+			db	b3h,87h,46h,92h,2ah,01h,e5h,87h
+			db	bah,70h,2ah,82h,6ch,bfh,9eh,e2h
+			db	73h,92h,85h,4ch,2eh,20h,a6h,84h
+			db	fdh,77h,09h,25h,0dh,86h,c6h,47h
+			db	b1h,29h,79h,8bh,04h,c5h,ceh,eah
+			db	10h,01h,56h,04h,bfh,0dh,dbh,2ch
+			db	97h,7ah,82h,0ah,80h,41h,63h,c6h
+			db	05h,6bh,3bh,52h,69h,afh,17h,60h
+			ld	c,66h
+			jr	nc,Lbc1a
+			ret	nz
+			ccf
+			or	h
+			dec	h
+			ld	(hl),a
+			ld	a,(de)
+			call	m,Lcf74
+			and	b
+			and	c
+			ret	z
+			ld	(e2ddh),hl
+			ld	b,a
+			dec	sp
+			cp	l
+			add	a,l
+			sbc	a,d
+			ld	d,(hl)
+			ld	de,aab6h
+			ld	e,h
+			add	a,c
+			ld	e,c
+			ret	c
+			and	l
+			add	a,a
+			inc	e
+			ld	b,d
+			dec	hl
+			call	La631
+			ret	z
+			ld	a,(bc)
+			ld	(hl),a
+			or	d
+			inc	(hl)
+			jp	(hl)
+			db	c7h,62h,34h,71h,9dh,aah,5eh,1bh
+			db	5dh,97h,22h,f1h,8bh,fbh,8fh,2fh
+			db	26h,2ah,c2h,28h,82h,f9h,d4h,8ch
+			db	14h,4ah,c8h,c6h,03h,6ah,e4h,16h
+			db	80h,85h,0bh,3eh,91h,feh,11h,b0h
+			db	7ch,37h,69h,3eh,f0h,87h
+			adc	a,79h
+			dec	bc
+			ld	c,a
+			adc	a,c
+			ld	hl,(5d1dh)
+			ld	(hl),e
+			dec	de
+			jp	m,L13be
+			sbc	a,aeh
+			ld	c,d
+			ld	(hl),d
+			adc	a,a
+			ld	d,fch
+			ld	(hl),08h
+			adc	a,c
+			sbc	a,(hl)
+			sub	h
+			adc	a,b
+			jr	nz,Lbc9b
+			add	hl,hl
+			ld	l,15h
+			rrca
+			and	e
+			pop	bc
+			ld	c,l
+			call	nz,Lf7cf
+			dec	a
+			or	(hl)
+			jr	nz,Lbc6f
+			push	af
+			exx
+			sub	a
+			ret	p
+			sbc	a,e
+			in	c,(c)
+			ld	l,e
+			ld	(hl),7ah
+			xor	b
+			ret	po
+			cp	h
+			ld	d,d
+			dec	hl
+			adc	a,d
+			rst	08h
+			ld	l,d
+			in	a,(f1h)
+			ex	(sp),hl
+			pop	af
+			jr	c,Lbc5f
+			ld	d,a
+			pop	af
+			ld	a,l
+			ld	d,d
+			ld	b,e
+			jr	Lbc36
+			db	4eh,19h,93h,bbh,10h,efh,9ch,35h
+			db	48h,f5h,84h,b7h
+			ret	po
+			ld	a,h
+			add	a,a
+			sub	d
+			ld	hl,6b88h
+			dec	h
+			ret	c
+			call	nz,Lc750
+			jp	c,L5113
+			and	b
+			rst	38h
+			ld	h,a
+			sbc	a,h
+			jp	(hl)
+			db	adh,5fh,c5h,78h
+			ret
+			db	7dh,98h,cdh,e2h,04h,7eh,72h,2ch
+			db	c9h,ffh,8fh,e9h,92h,51h,9ah,34h
+			db	71h,c6h,94h
+			push	af
+			ld	h,e
+			rra
+			cp	c
+			xor	l
+			inc	b
+			jp	(hl)
+			db	dch,fbh,75h,6bh,a6h,b3h,d2h,66h
+			db	ebh,4ch,3ah,48h,cch,8fh,64h,31h
+			db	71h,21h,a4h
+			call	p,Ldb38
+			ld	l,b
+			dec	d
+			sbc	a,b
+			pop	af
+			call	p,L18d0
+			ld	e,e
+			sub	l
+			ld	c,c
+			jr	Lbc87
+			db	70h,31h,b9h,5ch,a0h,3dh,2ah,94h
+			db	74h,50h,e1h,d1h,29h,b2h,91h,45h
+			db	f4h,c7h,b8h,fah,6ch,2fh,c8h,b4h
+			db	e6h,4ch,19h,4ah,47h,c1h,fbh,fah
+			db	4dh,08h,90h,b1h,8ah,8dh,4fh,37h
+			db	5ah,3fh,8ah,ddh,77h,3eh,9eh,90h
+			db	53h,24h,8ah,d0h,26h,46h,24h,a3h
+			db	19h,c6h,2bh,13h,65h,06h,17h,adh
+			db	1fh,32h,ech,d0h,07h,13h,e8h,8dh
+			db	2dh,99h,a7h,1eh,44h,7ah,74h,37h
+			db	3dh,0fh,ffh,3eh,d3h,35h,3fh,00h
+			db	42h,51h,c5h,4bh,c8h,d9h,8bh,90h
+			db	58h,58h,97h,3ah,f1h,f0h,68h,6eh
+			db	87h,13h,69h,96h,95h,bfh,f8h,50h
+			db	bch,e5h,56h,d2h,c0h,85h,cfh,07h
+			db	87h,4eh,e6h,e7h,c8h,d8h,16h,60h
+			db	76h,17h,64h,c4h,98h,4ch,37h,cfh
+			db	36h,cch,9bh,9ah,70h,a0h,d0h,72h
+			and	c
+			rst	20h
+			cpl
+			call	po,L2544
+			ld	a,(de)
+			or	d
+			ld	(hl),c
+			adc	a,a
+			rst	30h
+			di
+			call	nc,L9521
+			ld	e,e
+			call	z,L6449
+			add	a,d
+			call	c,L7fd0
+			ld	h,h
+			rst	00h
+			ld	c,e
+			ld	b,e
+			ld	b,c
+			ld	sp,245ch
+			call	nz,L59b8
+			add	a,d
+			ld	d,d
+			sub	a
+			jp	po,Lb958
+			ld	l,e
+			ld	a,(de)
+			add	hl,de
+			ld	h,a
+			sub	a
+			sbc	a,d
+			ld	(hl),a
+			adc	a,b
+			jp	pe,L75ad
+			jp	nz,L8e6b
+			dec	sp
+			ld	h,d
+			add	a,(hl)
+			jp	po,L3d84
+			adc	a,h
+			ld	l,e
+			sub	e
+			adc	a,h
+			inc	e
+			ld	e,a
+			ld	b,h
+			rst	08h
+			ld	c,a
+			ld	d,l
+			ld	bc,49a9h
+			call	nc,L6aef
+			ld	l,l
+			ld	(hl),d
+			sub	b
+			ld	l,e
+			sub	a
+			ld	c,h
+			ld	e,b
+			call	nz,La387
+			sbc	a,e
+			ld	e,l
+			add	hl,sp
+			ex	de,hl
+			cp	e
+			ld	e,b
+			call	p,L1098
+			and	h
+			djnz	Lbe17
+			ret	p
+			dec	bc
+			ld	h,l
+			sub	cch
+			and	d
+			call	L15fd
+			adc	a,69h
+			ld	(hl),l
+			ex	de,hl
+			jp	m,L226d
+			push	bc
+			dec	hl
+			or	(hl)
+			inc	a
+			inc	sp
+			ret	po
+			ld	e,b
+			pop	bc
+			or	h
+			inc	d
+			rla
+			ld	b,(hl)
+			ret	nz
+			ld	c,(hl)
+			xor	c
+			ld	(hl),c
+			or	(hl)
+			ld	h,cah
+			and	c2h
+			ld	h,c
+			pop	hl
+			add	a,4fh
+			ld	l,fah
+			ld	l,b
+			inc	(hl)
+			or	b
+			ld	d,(hl)
+			adc	a,e
+			dec	e
+			ret	nc
+			rst	00h
+			ret	po
+			ld	l,27h
+			rst	10h
+			or	f7h
+			and	h
+			push	hl
+			res	2,b
+			inc	(hl)
+			add	hl,de
+			nop
+			and	e
+			sbc	a,(hl)
+			ret	z
+			ld	h,h
+			ld	a,(bc)
+			ld	e,e
+			ld	(ce87h),hl
+			ld	c,h
+			ret	nc
+			cp	d
+			ld	l,h
+			ret	nz
+			call	nc,L0e8a
+			xor	a
+			ld	c,b
+			ld	(hl),b
+			add	a,c6h
+			ld	(hl),c
+			rra
+			xor	a
+			ld	a,c
+			ld	a,(hl)
+			xor	l
+			ld	c,e
+			and	l
+			call	c,Le9d1
+			sbc	a,b
+			add	a,5ah
+			and	e
+			scf
+			call	c,La681
+			sbc	a,l
+			inc	d
+			sub	d
+			dec	b
+			or	(hl)
+			or	b
+			xor	l
+			ld	b,b
+			rst	08h
+			call	nc,L561b
+			cp	c
+			adc	a,a
+			add	a,c
+			pop	de
+			ld	b,d
+			ld	a,h
+			pop	bc
+			dec	hl
+			ld	l,d
+			ld	d,d
+			ld	h,e
+			inc	a
+			sub	c
+			push	de
+			ld	hl,23adh
+			sub	l
+			ld	c,l
+			call	m,Leae7
+			or	e
+			and	c
+			xor	a
+			and	c
+			sub	d
+			ld	e,(hl)
+			ld	l,a
+			pop	af
+			and	l
+			call	z,L42c7
+			ld	a,(bc)
+			and	e
+			ld	c,e
+			ld	a,a
+			inc	a
+			sbc	a,c
+			or	c
+			ld	h,c
+			jr	nc,Lbe4a
+			nop
+			dec	b
+			ld	l,l
+			ld	e,l
+			add	a,l
+			ld	h,29h
+			ld	a,h
+			rst	38h
+			inc	a
+			xor	l
+			add	hl,de
+			add	a,d
+			ld	d,(hl)
+			call	p,Ld34e
+			or	h
+			ld	hl,(e125h)
+			inc	d
+			dec	de
+			ld	hl,(9934h)
+			ld	(hl),d
+			dec	d
+			ld	c,h
+			ld	e,e
+			ld	h,c
+			ld	(hl),c
+			cp	d
+			jr	z,Lbed8
+			add	a,c
+			ld	(de),a
+			jp	p,L816a
+			and	b
+			nop (2x) *
+			ret	c
+			cp	e
+			ld	a,69h
+			cp	h
+			rst	00h
+			xor	22h
+			in	a,(03h)
+			push	bc
+			adc	a,(hl)
+			ld	h,c
+			ld	a,c
+			out	(55h),a
+			dec	hl
+			add	a,a
+			dec	l
+			adc	a,(hl)
+			add	a,b
+			ld	(5922h),hl
+			ex	(sp),hl
+			djnz	Lbedc
+			ld	b,c
+			ld	e,l
+			ld	c,a
+			ld	e,h
+			and	e
+			xor	h
+			ld	(hl),a
+			ld	b,a
+			call	nz,Lf7e1
+			sbc	a,l
+			or	b
+			ld	a,(6fa8h)
+			push	de
+			call	nz,Lc6e8
+			ld	d,45h
+			ld	d,a
+			and	(hl)
+			jr	nc,Lbea1
+			ld	b,(hl)
+			ld	(hl),a
+			or	e
+			ld	c,(hl)
+			inc	sp
+			ld	d,c
+			adc	a,l
+			sub	e
+			inc	e
+			inc	de
+			dec	(hl)
+			pop	de
+			xor	3ch
+			inc	sp
+			ld	a,e
+			dec	l
+			and	l
+			dec	(hl)
+			ld	d,b
+			call	L0ad3
+			ld	h,a
+			dec	l
+			pop	af
+			adc	a,c
+			inc	a
+			ld	a,(de)
+			ld	l,(hl)
+			add	a,(hl)
+			and	a
+			ld	l,1ah
+			jr	Lbe78
+			db	2ch,1dh
+			ld	d,a
+			add	hl,de
+			rst	00h
+			adc	a,(hl)
+			ld	h,d
+			call	nz,L9b00
+			ld	l,(hl)
+			xor	c
+			ld	l,a
+			ret	po
+			ld	a,(5233h)
+			inc	b
+			ld	c,a
+			rla
+			ld	e,(hl)
+			cp	(hl)
+			cp	c
+			ex	de,hl
+			ex	(sp),hl
+			dec	h
+			cp	d
+			ld	l,(hl)
+			sbc	a,b
+			cp	b
+			inc	h
+			ld	b,h
+			ld	l,(hl)
+			and	l
+			dec	h
+			jr	c,Lbf12
+			jr	Lbf07
+			db	beh,f5h,1bh,28h
+			cp	(hl)
+			ld	hl,a29ch
+			ld	c,l
+			ret	nc
+			inc	a
+			add	a,(hl)
+			add	a,d
+			add	a,l
+			inc	h
+			inc	(hl)
+			ld	(bc),a
+			di
+			inc	hl
+			pop	af
+			nop (2x) *
+			jr	z,Lbf66
+			inc	a
+			rst	18h
+			inc	sp
+			cp	(hl)
+			dec	d
+			xor	c
+			rla
+			sbc	a,a
+			ld	a,(hl)
+			adc	a,b
+			sbc	a,c
+			ld	h,b
+			ret
+			db	eeh,6ch,3ch,dch,21h,47h,beh,dch
+			db	28h,4ah,29h,a0h,dfh,97h,63h,3ah
+			db	80h,d1h,49h,d7h,2fh,1bh,a9h,d2h
+			db	41h,73h,7fh,4fh,cbh,22h,70h,45h
+			db	12h,5eh,cbh,11h,78h,9ch,6fh,06h
+			db	7fh,97h,29h,c5h,84h,4ah,b7h,56h
+			db	32h,9eh,e9h,f2h,c7h,a7h,f3h,53h
+			db	7ch,9dh,fdh,2ah,c0h,c5h,4bh,68h
+			db	24h
+			adc	a,d
+			sbc	a,f7h
+			ld	(hl),a
+			xor	d
+			inc	l
+			dec	b
+			ld	h,c
+			djnz	Lbf19
+			cp	b
+			halt
+			ld	c,b
+			out	(84h),a
+			jp	(hl)
+			db	4eh,82h,5bh,f4h,c6h,c2h,0dh,03h
+			db	31h,f8h
+			and	l
+			inc	c
+			add	a,l
+			add	a,b
+			dec	d
+			ld	b,a
+			call	pe,Lcee9
+			rst	30h
+			dec	a
+			di
+			ld	e,b
+			sbc	a,b
+			add	a,b
+			ld	l,(hl)
+			cp	b
+			ld	b,l
+			ld	e,a
+			rst	08h
+			cp	(hl)
+			sbc	a,(hl)
+			add	a,a
+			rlca
+			rlca
+			ld	a,(bc)
+			ld	(hl),b
+			sbc	a,c
+			ld	h,h
+			and	a
+			adc	a,l
+			ld	a,l
+			call	p,La178
+			ld	d,(hl)
+			ld	(hl),b
+			sub	d
+			dec	h
+			ld	(hl),b
+			inc	(hl)
+			jp	po,L4ab6
+			jr	Lbf95
+			db	76h,49h,f3h,e6h,f1h,7ch,e3h,39h
+			db	18h,88h,fbh,b3h
+			jp	p,L5be5
+			ret	nz
+			ld	e,e
+			or	c
+			cp	b
+			ld	hl,(8b0dh)
+			ld	d,d
+			dec	b
+			or	l
+			adc	a,d
+			jp	pe,L6724
+			ld	b,l
+			cp	h
+			ld	a,e
+			inc	hl
+			ld	c,07h
+			dec	sp
+			or	(hl)
+			xor	h
+			ld	b,h
+			ld	c,(hl)
+			adc	a,c
+			ret	po
+			call	nc,Lb810
+			out	(55h),a
+			pop	de
+			rla
+			ld	a,e
+			xor	82h
+			jr	c,Lc043
+			ld	c,b
+			ld	c,e
+			adc	a,a
+			sbc	a,(hl)
+			adc	a,a
+			ld	(hl),h
+			rlca
+			inc	e
+			in	d,(c)
+			ret	nz
+			pop	bc
+			sub	c
+			add	a,c
+			ld	a,(hl)
+			ret
+			db	bch,f5h,c7h,a7h,08h,92h,dfh,7fh
+			db	2ah,d9h,33h,34h
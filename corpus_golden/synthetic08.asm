@@ -0,0 +1,2062 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	22h,36h,a6h,ddh,b5h,eeh,bfh,2fh
+			db	7eh,78h,53h,7eh
+
+start:						; execution starting point
+			ld	b,9ah
+			dec	b
+			ld	(hl),e
+			or	b
+			ret
+			db	02h,1bh,0eh,7fh,2eh,c9h,5ch,48h
+			db	b3h,0ch,17h,86h,84h,84h,0ch,89h
+			db	91h,49h,b3h,27h,4dh,9eh,1ah,72h
+			db	f3h,7ah,0dh,e8h,39h,bah,76h,9ah
+			db	e4h,f1h,e9h,3dh,a3h,9ah,aah,d2h
+			db	2ch,a7h,f7h,9eh,5ch,6ah,fbh,dfh
+			db	47h,cbh,d4h,ddh,3bh,17h,f8h,03h
+			db	9ch,ddh,afh,d5h,4ch,94h,68h,dbh
+			db	5ch,84h,d2h,79h,31h,5fh,40h,9bh
+			db	cfh,02h,b4h,1fh,68h,21h,9dh,e0h
+			db	35h,dch,2eh,62h,fbh,93h,9fh,7eh
+			db	9fh,11h,d2h,1ch,3fh,2ch,cah,74h
+			db	1ah,d4h,efh,42h,4ch,0eh,ffh,b1h
+			db	93h,a9h,6fh,b2h,f4h,d1h,a0h,5bh
+			db	36h,beh,d9h,72h,8bh,adh,91h,6dh
+			db	28h,3eh,64h,19h,fah,c5h,deh,51h
+			db	d5h,94h,abh,a4h,86h,76h,17h,7fh
+			db	65h,eah,8fh,3ch,04h,1fh,a7h,d6h
+			db	72h,0dh,94h,61h,4fh,abh,aeh,d1h
+			db	06h,cdh,69h,81h,dfh,2bh,91h,67h
+			db	f0h,1ah,d7h,5ah,5fh,69h,e6h,e8h
+			db	b1h,9eh,45h,9dh,4fh,62h,fah,33h
+			db	93h,0ah,f3h,2ch,80h,15h,46h,f8h
+			db	24h,82h,b4h,27h,02h,c8h,62h,1dh
+			db	2bh,24h,19h,b4h,6ah,90h,61h,e0h
+			db	cdh,dah,d6h,1ch,4ah,14h,b3h,a6h
+			db	ebh,81h,7eh,75h,cah,86h,f6h,8ah
+			db	13h,77h,57h,c3h,b7h,f7h,50h,44h
+			db	deh,77h,0ch,62h,2dh,63h,25h,80h
+			db	35h,d3h,43h,c0h,ddh,5eh,8bh,a1h
+			db	39h,93h,4eh,d7h,e5h,11h,2eh,0ch
+			db	08h,d4h,74h,37h,5fh,e6h,e0h,f3h
+			db	94h,f5h,1eh,a9h,f8h,fah,20h,0eh
+			db	28h,76h,b5h,a2h,62h,c0h,a3h,52h
+			db	c2h,27h,2eh,18h,43h,ceh,12h,52h
+			db	d1h,44h,8dh,c2h,66h,6ch,4ch,25h
+			db	3fh,e3h,c7h,5fh,65h,aeh,41h,e6h
+			db	e6h,48h,93h,94h,0ah,57h,35h,46h
+			db	59h,31h,88h,dch,40h,b0h,9ch,47h
+			db	71h,f0h,f7h,adh,10h,47h,1dh,27h
+			db	74h,d7h,5bh,bbh,74h,11h,a5h,b9h
+			db	77h,f3h,f2h,44h,aeh,19h,1fh,0bh
+			db	15h,82h,d8h,98h,dah,1ch,f0h,e9h
+			db	2fh,e2h,41h,96h,fbh,30h,30h,a7h
+			db	2ch,65h,e5h,06h,f9h,edh,bfh,c5h
+			db	29h,81h,e0h,95h,5ah,37h,7ah,4ch
+			db	57h,5bh,96h,82h,72h,81h,10h,42h
+			db	47h,fah,87h,55h,9ch,84h,88h,f5h
+			db	b7h,97h,9dh,9ch,6ah,39h,c7h,4fh
+			db	39h,29h,33h,a4h,0ch,7ah,0dh,9ch
+			db	04h,88h,43h,05h,0dh,42h,c1h,b2h
+			db	e8h,84h,5fh,cah,cbh,53h,a0h,abh
+			db	94h,a4h,bah,6ah,64h,08h,d6h,20h
+			db	9ah,8dh,e0h,00h,cah,eah,dah,98h
+			db	94h,beh,93h,45h,29h,6ah,f2h,c4h
+			db	8bh,c5h,27h,5eh,99h,56h,c0h,81h
+			db	08h,b3h,5ch,b8h,18h,41h,58h,2bh
+			db	3dh,9bh,2ch,c2h,5ah,deh,ech,99h
+			db	77h,68h,72h,8eh,d0h,8fh,f3h,c5h
+			db	c7h,e2h,cch,31h,99h,dfh,38h,24h
+			db	56h,25h,d8h,44h,05h,fch,bch,10h
+			db	51h,29h,aeh,e6h,4eh,50h,bch,dbh
+			db	19h,66h,97h,c2h,23h,a3h,d9h,ebh
+			db	61h,f2h,eeh,b3h,25h,eah,efh,50h
+			db	4dh,aeh,c8h,84h,46h,5ah,3eh,5bh
+			db	0bh,d9h,b8h,99h,c8h,4fh,7ah,a5h
+			db	97h,ffh,07h,edh,bah,ddh,bch,a5h
+			db	87h,2ah,87h,8eh,7ch,d3h,54h,d5h
+			db	05h,d1h,04h,48h,02h,64h,2fh,2fh
+			db	f0h,d2h,5bh,fch,07h,4eh,3bh,4fh
+			db	17h,bah,00h,dfh,09h,31h,e2h,d3h
+			db	e1h,51h,e9h,2fh,e0h,41h,d8h,47h
+			db	d9h,a2h,71h,24h,b4h,5bh,27h,c9h
+			db	11h,8ch,1fh,54h,e0h,76h,51h,d1h
+			db	7dh,7eh,85h,8bh,cbh,11h,38h,ebh
+			db	38h,f4h,55h,56h,abh,a3h,9fh,c0h
+			db	42h,28h,8ah,2ch,18h,4fh,36h,b3h
+			db	cbh,77h,d7h,f5h,4fh,35h,beh,b4h
+			db	1dh,b5h,52h,bbh,d7h,97h,1dh,2fh
+			db	8dh,01h,edh,32h,78h,10h,4fh,43h
+			db	dfh,68h,deh,cah,9eh,16h,04h,b6h
+			db	10h,07h,8ah,8ah,37h,0dh,a6h,efh
+			db	44h,52h,aeh,3ch,bdh,3dh,e9h,89h
+			db	e2h,d9h,efh,05h,ech,55h,c2h,d1h
+			db	ebh,ffh,e6h,6bh,8dh,d4h,7bh,cbh
+			db	8ch,2ch,ceh,99h,41h,0eh,e4h,6bh
+			db	09h,95h,23h,31h,a1h,f7h,f0h,1bh
+			db	7bh,ech,16h,5fh,51h,1fh,dah,b7h
+			db	afh,dfh,c7h,27h,0eh,1bh,97h,41h
+			db	0eh,e9h,f6h,b6h,02h,aah,f0h,bah
+			db	d8h,b4h,27h,4dh,66h,7eh,dch,70h
+			db	abh,6eh,2ch,80h,f0h,cbh,70h,bbh
+			db	89h,15h,58h,bdh,36h,4ah,68h,91h
+			db	76h,e7h,30h,9ah,ceh,7ah,f5h,7dh
+			db	a6h,73h,abh,0eh,19h,83h,9bh,8ch
+			db	99h,aeh,91h,3ch,31h,bch,4fh,80h
+			db	e3h,f8h,7bh,01h,6dh,63h,b7h,13h
+			db	83h,ech,1bh,a3h,f4h,7eh,fbh,efh
+			db	62h,a3h,50h,78h,f0h,18h,b6h,8fh
+			db	95h,07h,c7h,4dh,10h,abh,bdh,46h
+			db	18h,90h,13h,bah,10h,d8h,e7h,2ch
+			db	39h,16h,a7h,b6h,8ch,00h,33h,cdh
+			db	deh,7dh,74h,0ch,b4h,96h,71h,31h
+			db	5bh,ceh,5bh,5ch,3eh,7dh,4ah,2dh
+			db	abh,cfh,e6h,79h,c3h,89h,bfh,48h
+			db	00h,50h,50h,42h,5fh,c0h,3ch,86h
+			db	d6h,a0h,8ch,6eh,4bh,2bh,67h,10h
+			db	73h,b8h,52h,70h,11h,7eh,89h,71h
+			db	38h,5dh,7eh,d1h,09h,d9h,bah,ebh
+			db	76h,a7h,64h,bah,2eh,5bh,3bh,edh
+			db	9ch,a7h,41h,c5h,3ah,8eh,06h,19h
+			db	c3h,beh,c1h,adh,39h,ceh,24h,83h
+			db	43h,d9h,44h,0eh,65h,7bh,beh,8dh
+			db	84h,d6h,e2h,09h,1ah,35h,41h,02h
+			db	e5h,50h,fah,01h,15h,66h,91h,ebh
+			db	05h,2dh,fbh,83h,6eh,8bh,01h,34h
+			db	5ch,85h,d7h,ceh,f9h,edh,77h,a2h
+			db	7dh,2ch,41h,f1h,32h,0ch,3fh,21h
+			db	53h,bah,e0h,54h,9ch,6dh,09h,09h
+			db	f9h,17h,6fh,c7h,3eh,d8h,aeh,57h
+			db	e8h,16h,9ah,10h,f2h,61h,16h,80h
+			db	16h,9bh,deh,3fh,eah,83h,13h,9eh
+			db	87h,0bh,f7h,8fh,36h,6bh,22h,47h
+			db	5ah,18h,f1h,3bh,6ch,d2h,62h,5ch
+			db	fch,60h,64h,d7h,89h,2ah,4ah,9dh
+			db	72h,73h,fah,32h,12h,7ah,b5h,0bh
+			db	dch,10h,00h,f0h,ech,7ch,f7h,99h
+			db	6dh,a7h,cfh,2ch,f5h,57h,b0h,5bh
+			db	fah,a8h,2dh,47h,12h,6eh,57h,9ah
+			db	05h,7dh,47h,2dh,54h,36h,9dh,06h
+			db	f1h,63h,59h,efh,40h,ddh,f0h,01h
+			db	25h,16h,ach,d2h,8dh,a1h,89h,32h
+			db	0ah,cah,4bh,e4h,24h,20h,0ch,7fh
+			db	b5h,7fh,66h,bdh,aeh,01h,07h,94h
+			db	63h,a0h,6ah,7ah,5ah,c5h,62h,2fh
+			db	b2h,76h,e0h,81h,65h,59h,79h,16h
+			db	e2h,b9h,1fh,55h,c4h,e9h,74h,2dh
+			db	b0h,f4h,10h,0eh,e7h,c1h,59h,95h
+			db	edh,07h,94h,9eh,eeh,0dh,05h,31h
+			db	c2h,01h,d2h,d7h,e0h,0ah,13h,eeh
+			db	0dh,ddh,c7h,afh,1eh,dah,5ah,b1h
+			db	a7h,95h,37h,34h,4ch,11h,50h,74h
+			db	bch,99h,5eh,75h,59h,f0h,63h,b2h
+			db	2ah,98h,40h,f8h,d3h,d8h,8fh,51h
+			db	38h,ffh,8eh,52h,cfh,ech,4fh,9bh
+			db	70h,eeh,c6h,33h,71h,94h,96h,17h
+			db	98h,b4h,45h,9ch,12h,63h,49h,d3h
+			db	0fh,efh,b2h,ddh,e8h,8bh,5dh,0fh
+			db	45h,77h,9dh,44h,5ch,f2h,76h,44h
+			db	d0h,f7h,48h,d6h,a5h,c2h,79h,1dh
+			db	95h,73h,0ah,dah,9dh,4bh,aeh,7ch
+			db	1ah,36h,05h,65h,9bh,c5h,64h,9dh
+			db	c7h,d9h,cbh,d1h,82h,31h,d8h,b8h
+			db	deh,d6h,f5h,abh,cah,fch,13h,60h
+			db	2bh,cbh,dch,e0h,56h,76h,77h,a1h
+			db	02h,6eh,04h,1ch,b6h,6bh,ceh,1ch
+			db	3fh,cbh,5bh,a7h,03h,fch,cfh,12h
+			db	3bh,4ch,4bh,39h,75h,52h,ffh,d1h
+			db	1ch,03h,d5h,deh,96h,0eh,adh,c3h
+			db	c1h,83h,2ch,12h,f9h,9eh,60h,93h
+			db	afh,bdh,66h,a6h,93h,a3h,03h,03h
+			db	c1h,e4h,d5h,a8h,1bh,2ch,05h,d8h
+			db	f5h,22h,2ah,20h,6bh,b0h,7dh,35h
+			db	b1h,48h,12h,c9h,10h,15h,b4h,fdh
+			db	3bh,c9h,b6h,51h,d4h,a2h,36h,05h
+			db	a4h,cdh,0ah,7bh,edh,14h,4ch,bbh
+			db	41h,7fh,4dh,19h,3dh,a8h,8ch,f6h
+			db	4eh,c2h,c9h,7eh,e1h,78h,cbh,b8h
+			db	46h,b4h,11h,60h,d3h,44h,d3h,41h
+			db	9dh,4bh,43h,92h,39h,dah,73h,91h
+			db	e3h,1bh,fdh,88h,79h,deh,6eh,b3h
+			db	a3h,cfh,deh,f9h,e3h,97h,4ah,69h
+			db	f3h,66h,9fh,7dh,f4h,f1h,dah,f1h
+			db	b1h,87h,5eh,72h,84h,5ch,2eh,63h
+			db	bah,8eh,c5h,b6h,c4h,d3h,edh,d8h
+			db	a5h,8eh,67h,15h,f2h,3ah,b2h,bah
+			db	6dh,a6h,48h,82h,74h,4bh,96h,4eh
+			db	8dh,b1h,35h,a1h,7ch,0ah,6fh,b4h
+			db	39h,22h,1fh,b0h,feh,41h,46h,96h
+			db	6bh,aeh,4eh,54h,ffh,5ch,13h,bdh
+			db	54h,71h,0bh,e5h,04h,4fh,2bh,64h
+			db	6ch,50h,5ah,7fh,46h,bbh,dch,4dh
+			db	3ch,4dh,feh,58h,bbh,35h,2eh,24h
+			db	57h,06h,58h,bbh,1dh,aeh,5eh,9dh
+			db	3ah,23h,c4h,0eh,6eh,cfh,d0h,91h
+			db	c5h,76h,76h,bch,e1h,89h,eeh,88h
+			db	2ah,bdh,2fh,f5h,26h,1bh,5eh,04h
+			db	feh,8ch,3ch,35h,d8h,71h,5ah,ceh
+			db	75h,b7h,5eh,8bh,bfh,50h,a8h,6bh
+			db	5eh,67h,a4h,09h,65h,48h,bah,15h
+			db	42h,62h,d0h,33h,90h,9eh,c5h,c8h
+			db	60h,eah,4ah,8ch,03h,b0h,c7h,66h
+			db	afh,b0h,e3h,a1h,1dh,f9h,60h,28h
+			db	bch,48h,c8h,e2h,06h,3fh,96h,93h
+			db	d2h,a7h,e5h,78h,3fh,28h,67h,ebh
+			db	dbh,9ch,cbh,2eh,d2h,58h,89h,c5h
+			db	fah,16h,77h,fch,0eh,69h,d1h,9bh
+			db	91h,3ch,25h,ach,88h,e5h,beh,e1h
+			db	28h,d8h,4eh,06h,14h,10h,57h,93h
+			db	87h,38h,d6h,00h,97h,24h,03h,a6h
+			db	cfh,e8h,0fh,8ch,a6h,17h,1eh,b4h
+			db	e3h,35h,b1h,3ah,18h,d1h,63h,0bh
+			db	07h,42h,b4h,a3h,9dh,adh,aah,05h
+			db	f1h,afh,aeh,62h,75h,e4h,42h,15h
+			db	c2h,d3h,59h,89h,3ah,4eh,e2h,0eh
+			db	9ah,31h,4ah,b5h,61h,a2h,b7h,06h
+			db	2ah,f1h,d9h,26h,c9h,2fh,a1h,40h
+			db	dfh,c3h,65h,70h,abh,ech,52h,09h
+			db	80h,32h,08h,9dh,28h,d2h,d7h,17h
+			db	ebh,deh,4fh,f8h,b8h,a4h,94h,1ch
+			db	a3h,33h,8ch,ddh,45h,27h,16h,2eh
+			db	d2h,d4h,97h,8eh,03h,aeh,9bh,84h
+			db	48h,e5h,6ah,a5h,e3h,eeh,d2h,cdh
+			db	39h,43h,f6h,c6h,49h,6fh,feh,43h
+			db	e0h,76h,0fh,ech,d6h,07h,7fh,f9h
+			db	99h,94h,c2h,5ah,7bh,ebh,4dh,06h
+			db	9ch,77h,16h,feh,deh,fbh,4ch,4bh
+			db	39h,78h,f2h,7dh,0dh,c9h,47h,ddh
+			db	2eh,e0h,f6h,9ah,a4h,fdh,dch,1dh
+			db	23h,29h,fah,a7h,0fh,d5h,46h,7bh
+			db	31h,60h,55h,e8h,8eh,bfh,fah,feh
+			db	9fh,15h,37h,54h,1eh,f8h,dfh,9bh
+			db	85h,12h,07h,f1h,dfh,86h,c5h,6ch
+			db	02h,8ch,37h,7fh,feh,91h,46h,0ah
+			db	e3h,96h,97h,83h,7eh,3ch,16h,d6h
+			db	cdh,c5h,d8h,ech,e8h,00h,fch,70h
+			db	b0h,e0h,5fh,d8h,02h,10h,0fh,4eh
+			db	b3h,a5h,31h,e8h,50h,5dh,a7h,32h
+			db	1eh,cfh,54h,94h,c4h,dah,bbh,6eh
+			db	cbh,05h,5fh,0bh,02h,c3h,93h,28h
+			db	4ch,82h,c2h,1ch,b5h,e6h,72h,fdh
+			db	11h,e4h,0bh,9fh,3dh,72h,5ah,e1h
+			db	dfh,dch,07h,12h,ach,53h,d8h,a2h
+			db	6ah,7bh,4dh,e2h,1bh,16h,9ah,9ah
+			db	deh,86h,19h,b0h,5dh,95h,69h,0eh
+			db	c5h,53h,0eh,2ah,33h,47h,66h,83h
+			db	22h,77h,d7h,dch,7bh,22h,a5h,b5h
+			db	95h,2bh,eeh,fbh,afh,cdh,72h,1bh
+			db	b9h,afh,c2h,28h,f9h,4ah,c6h,8ah
+			db	d8h,2ah,45h,e4h,a5h,3ah,34h,41h
+			db	91h,45h,2fh,1ah,8ch,76h,05h,23h
+			db	67h,0ch,d7h,3dh,34h,b2h,97h,36h
+			db	50h,53h,0eh,45h,8dh,aeh,4bh,d1h
+			db	a5h,07h,c0h,e9h,4ch,dah,b3h,f5h
+			db	42h,5bh,63h,0bh,4ch,35h,bfh,97h
+			db	0bh,c9h,2ah,5eh,7ah,9fh,8ah,44h
+			db	74h,fch,4eh,38h,98h,bbh,feh,0eh
+			db	49h,5ah,f5h,a3h,4ch,1bh,78h,49h
+			db	86h,feh,58h,b6h,98h,ddh,0fh,f1h
+			db	2fh,f6h,44h,f8h,60h,25h,51h,24h
+			db	fbh,00h,c8h,42h,ddh,1eh,a4h,cfh
+			db	00h,71h,c4h,02h,86h,5bh,93h,d2h
+			db	78h,dch,c9h,cah,0ch,73h,42h,85h
+			db	0fh,d0h,cdh,7dh,a8h,f5h,15h,79h
+			db	86h,d0h,3ah,56h,b9h,68h,feh,96h
+			db	60h,b0h,fah,b7h,17h,4fh,5ch,f4h
+			db	9ah,f0h,39h,cah,0fh,a4h,d2h,7ah
+			db	57h,8fh,d6h,62h,95h,ech,bdh,c9h
+			db	a3h,08h,47h,6dh,38h,bfh,2dh,85h
+			db	35h,3dh,0fh,ech,82h,d9h,ech,5ah
+			db	b3h,d2h,bfh,1ah,7ch,f9h,72h,6ch
+			db	f2h,42h,39h,7fh,4dh,eah,80h,fah
+			db	61h,2fh,cah,12h,47h,2ah,dah,23h
+			db	b0h,e0h,00h,5ah,b2h,f7h,34h,feh
+			db	0eh,b8h,b2h,44h,2dh,83h,47h,80h
+			db	f2h,b8h,a2h,69h,ddh,81h,45h,89h
+			db	54h,d3h,46h,6ah,48h,60h,7bh,53h
+			db	08h,dch,91h,9dh,e3h,77h,53h,19h
+			db	3eh,34h,83h,dah,c7h,2ch,3fh,e4h
+			db	b1h,c8h,adh,08h,21h,5dh,0ch,50h
+			db	39h,9dh,09h,67h,b0h,a8h,f9h,3ch
+			db	91h,0bh,42h,ech,25h,aeh,73h,b0h
+			db	2bh,51h,94h,d7h,e9h,66h,67h,46h
+			db	48h,6fh,1dh,02h,79h,84h,ebh,92h
+			db	27h,e9h,9ch,aah,38h,08h,64h,8dh
+			db	19h,b1h,6bh,64h,b5h,c1h,e4h,7ch
+			db	d7h,78h,b6h,85h,2fh,b8h,cch,1ch
+			db	e2h,36h,57h,57h,bfh,a4h,52h,bch
+			db	57h,32h,e9h,04h,2eh,c1h,dbh,e6h
+			db	06h,c9h,edh,5eh,a4h,77h,b9h,5ch
+			db	e5h,42h,96h,83h,19h,97h,ach,67h
+			db	7bh,bdh,80h,e6h,62h,03h,d8h,14h
+			db	b0h,22h,a4h,09h,12h,fah,1fh,97h
+			db	05h,70h,22h,65h,ceh,a7h,2fh,36h
+			db	c6h,f2h,67h,e7h,73h,46h,0eh,bah
+			db	a5h,80h,c3h,15h,f6h,c0h,81h,aeh
+			db	c5h,b5h,c8h,eeh,3eh,27h,dbh,99h
+			db	e5h,20h,7ch,65h,7ah,05h,efh,48h
+			db	deh,05h,cch,4dh,3ch,08h,cdh,93h
+			db	fch,79h,4eh,3fh,69h,7dh,feh,5bh
+			db	39h,b1h,66h,cfh,2eh,96h,03h,37h
+			db	87h,bbh,98h,cbh,32h,f5h,01h,28h
+			db	03h,86h,aeh,fah,ddh,dfh,a8h,9bh
+			db	94h,d5h,d2h,5ch,00h,c3h,07h,abh
+			db	14h,bfh,a0h,71h,95h,e7h,68h,8bh
+			db	ffh,ffh,6ah,05h,5ch,54h,23h,5ch
+			db	2ah,c3h,09h,85h,69h,27h,fbh,00h
+			db	28h,93h,73h,d4h,18h,97h,76h,90h
+			db	f4h,04h,6dh,03h,2fh,1ah,54h,08h
+			db	42h,67h,10h,8fh,21h,7fh,4bh,51h
+			db	05h,93h,e7h,35h,e8h,21h,9bh,08h
+			db	20h,c3h,2ah,1bh,56h,c9h,21h,00h
+			db	5fh,7dh,6eh,e8h,7fh,fch,91h,62h
+			db	10h,b9h,61h,6dh,c0h,3ah,adh,20h
+			db	a7h,7ch,2dh,feh,08h,c9h,bch,47h
+			db	1ah,d5h,e2h,26h,1fh,fah,ddh,51h
+			db	03h,3bh,61h,e0h,0bh,49h,0ah,d6h
+			db	32h,bfh,ffh,25h,73h,94h,e3h,dah
+			db	55h,ceh,47h,6eh,5ch,70h,95h,adh
+			db	a1h,4ch,afh,c5h,bdh,23h,b4h,02h
+			db	5dh,c8h,8dh,91h,e0h,fdh,3bh,1dh
+			db	a4h,27h,a4h,9ah,f8h,cch,6dh,a3h
+			db	2ah,47h,a8h,5bh,dbh,b7h,7bh,a3h
+			db	49h,bch,9ah,13h,69h,beh,9dh,75h
+			db	5ah,41h,79h,a8h,53h,1fh,2ah,edh
+			db	bdh,9eh,fbh,a9h,a1h,58h,94h,e7h
+			db	cbh,39h,9dh,00h,c5h,cfh,e8h,20h
+			db	42h,90h,84h,f3h,76h,ddh,69h,ach
+			db	a4h,5bh,7ch,35h,44h,fdh,0ah,a6h
+			db	a7h,80h,beh,d3h,cbh,5eh,7ch,8bh
+			db	f5h,59h,66h,1fh,beh,04h,3fh,c1h
+			db	f6h,7ah,d7h,5ah,aeh,4ah,e5h,62h
+			db	34h,18h,2ah,b0h,3eh,efh,60h,a7h
+			db	b5h,5ah,26h,79h,58h,89h,47h,1bh
+			db	78h,07h,adh,f7h,22h,d2h,5ch,ceh
+			db	bah,beh,bah,33h,6bh,bbh,2ch,e1h
+			db	87h,7ch,9ah,6ch,94h,64h,0ch,afh
+			db	48h,1ah,9eh,0fh,fbh,6eh,72h,04h
+			db	55h,cbh,0eh,97h,43h,92h,95h,5eh
+			db	e3h,b1h,41h,67h,cah,2ch,eeh,6fh
+			db	04h,ddh,83h,2fh,a8h,99h,11h,98h
+			db	dbh,b5h,7ah,ech,54h,b1h,9ah,f1h
+			db	1fh,0fh,59h,0eh,4dh,63h,d0h,1fh
+			db	97h,4ch,07h,f1h,07h,ach,76h,a9h
+			db	9bh,5ch,a7h,08h,91h,ach,37h,5ch
+			db	b0h,f6h,63h,78h,84h,2bh,c1h,55h
+			db	9eh,bch,35h,84h,feh,c6h,8eh,91h
+			db	96h,eeh,2eh,06h,61h,f1h,ffh,6fh
+			db	54h,07h,c0h,ach,71h,8eh,fbh,9dh
+			db	4fh,41h,81h,6bh,07h,efh,4eh,bbh
+			db	cdh,08h,9eh,29h,39h,36h,4dh,aeh
+			db	43h,f1h,16h,8fh,02h,f6h,feh,f7h
+			db	d1h,70h,10h,f1h,68h,efh,63h,2ah
+			db	5ah,e4h,b7h,65h,4bh,66h,3ah,81h
+			db	1eh,a8h,60h,b4h,65h,8eh,74h,d4h
+			db	55h,57h,21h,b1h,29h,4ah,31h,ach
+			db	5fh,5ah,16h,52h,0ch,7fh,05h,1eh
+			db	4bh,6eh,30h,d3h,52h,74h,07h,cbh
+			db	d7h,96h,7ah,e6h,deh,c3h,73h,24h
+			db	95h,e5h,29h,1dh,65h,51h,42h,40h
+			db	3eh,2ch,9dh,55h,77h,b6h,e6h,72h
+			db	8fh,36h,86h,36h,a4h,00h,f7h,45h
+			db	07h,57h,31h,83h,1fh,f9h,dah,86h
+			db	f2h,03h,01h,16h,0bh,27h,b0h,5eh
+			db	83h,abh,89h,b1h,b1h,1eh,75h,65h
+			db	1ah,9ch,51h,c1h,2ah,b3h,e5h,e7h
+			db	11h,bch,c1h,e9h,18h,b9h,0dh,00h
+			db	47h,97h,eeh,84h,64h,07h,ceh,28h
+			db	5bh,78h,56h,66h,fdh,efh,98h,1ah
+			db	cch,e2h,5bh,c4h,b6h,5dh,72h,e7h
+			db	5fh,3ah,89h,a0h,44h,44h,d2h,42h
+			db	2bh,27h,5bh,b0h,b7h,21h,4eh,fbh
+			db	2fh,16h,6bh,a0h,5ch,13h,12h,04h
+			db	06h,22h,ddh,98h,7bh,51h,d4h,04h
+			db	adh,7eh,a0h,f0h,e8h,1bh,3dh,f8h
+			db	fah,9ch,06h,60h,19h,61h,63h,adh
+			db	a9h,bch,42h,4eh,fbh,3ch,ceh,dah
+			db	06h,8bh,39h,86h,3bh,9ch,80h,ffh
+			db	18h,b1h,fch,dfh,2ch,42h,c1h,42h
+			db	d6h,aeh,4fh,29h,a4h,73h,88h,62h
+			db	cbh,e0h,46h,8fh,42h,fah,1ah,92h
+			db	8fh,20h,bbh,40h,dfh,00h,86h,2ah
+			db	ebh,37h,f2h,19h,7ch,a9h,ddh,b8h
+			db	c3h,78h,98h,41h,12h,8ah,95h,86h
+			db	46h,65h,38h,80h,96h,4ch,f9h,20h
+			db	3ch,58h,83h,f7h,90h,efh,c6h,b6h
+			db	5ah,71h,26h,a5h,91h,dfh,04h,43h
+			db	abh,71h,b7h,47h,bch,f1h,6dh,4eh
+			db	5dh,cfh,eah,35h,b2h,94h,a6h,14h
+			db	3bh,21h,0ch,73h,6eh,1ah,2bh,65h
+			db	80h,2ch,d8h,f2h,9fh,51h,d0h,19h
+			db	b1h,34h,a8h,f3h,f6h,c9h,34h,ceh
+			db	6dh,30h,a4h,1dh,80h,52h,d9h,ach
+			db	31h,94h,7ah,28h,69h,fch,ech,05h
+			db	c7h,c4h,7eh,7ah,d7h,44h,50h,bbh
+			db	62h,d3h,ddh,bfh,8ch,66h,92h,47h
+			db	8ch,6fh,15h,bfh,26h,65h,5ah,56h
+			db	59h,4dh,eah,09h,bbh,a3h,07h,8ah
+			db	d6h,08h,e9h,1ah,ach,b6h,5ch,f5h
+			db	aeh,cbh,0fh,a5h,3ch,10h,f3h,2fh
+			db	13h,05h,7eh,9dh,25h,02h,5ch,50h
+			db	e3h,e7h,cbh,1fh,5dh,11h,c9h,bah
+			db	f7h,21h,06h,2ah,10h,0dh,2dh,78h
+			db	2dh,48h,cdh,67h,12h,76h,42h,e2h
+			db	cch,92h,a4h,b6h,b0h,3ah,efh,9ah
+			db	c3h,49h,93h,03h,13h,afh,96h,70h
+			db	c3h,07h,4fh,6fh,3eh,20h,34h,beh
+			db	43h,fdh,eah,87h,f3h,8fh,7ah,58h
+			db	76h,fah,44h,0ah,6bh,b8h,7ch,34h
+			db	d5h,06h,82h,03h,06h,1ah,51h,7fh
+			db	b6h,f3h,5ah,8bh,05h,ach,87h,64h
+			db	3eh,72h,1ch,5ah,f4h,28h,16h,32h
+			db	eeh,c9h,1fh,3ah,7bh,ceh,dbh,bch
+			db	2fh,2ah,fdh,99h,ech,91h,47h,f8h
+			db	8dh,7ah,82h,e0h,24h,f8h,76h,38h
+			db	18h,66h,beh,30h,a9h,d6h,15h,1eh
+			db	3dh,0ch,83h,c7h,81h,efh,82h,a6h
+			db	9ch,5ch,4fh,18h,77h,d3h,b7h,89h
+			db	9ch,e7h,b9h,bfh,c4h,07h,cfh,7bh
+			db	a0h,5fh,3fh,59h,56h,e7h,35h,e1h
+			db	3ah,60h,d7h,4eh,1bh,56h,24h,0ah
+			db	3ch,fbh,4eh,50h,7ch,5ch,bbh,0eh
+			db	d3h,dfh,24h,89h,7ah,eah,33h,99h
+			db	27h,21h,f5h,56h,fbh,64h,80h,d1h
+			db	13h,c0h,11h,c9h,eeh,d5h,7bh,35h
+			db	40h,40h,87h,f9h,b8h,5fh,8bh,95h
+			db	6fh,1dh,67h,29h,25h,91h,6bh,deh
+			db	0ah,b6h,7ah,fch,65h,46h,5eh,cbh
+			db	3eh,92h,84h,5fh,ach,88h,41h,70h
+			db	fbh,efh,a5h,c3h,50h,22h,a4h,d6h
+			db	69h,f4h,ebh,fdh,6eh,3bh,fdh,80h
+			db	c4h,e2h,7ch,0bh,fah,ffh,a0h,16h
+			db	ech,57h,51h,e8h,07h,3fh,4dh,75h
+			db	c0h,20h,91h,61h,9fh,43h,41h,2bh
+			db	03h,05h,70h,13h,77h,41h,e9h,93h
+			db	a5h,7ah,b5h,95h,d0h,a4h,7eh,b6h
+			db	77h,d4h,13h,01h,f5h,71h,30h,69h
+			db	6ch,6eh,a9h,e6h,4ch,fah,8ah,fah
+			db	22h,55h,e4h,09h,a4h,c4h,deh,91h
+			db	efh,eeh,29h,08h,c1h,96h,bbh,18h
+			db	38h,34h,64h,02h,8dh,8eh,3dh,02h
+			db	deh,6ah,5bh,9dh,d4h,b2h,33h,89h
+			db	72h,d1h,b5h,2ch,12h,56h,1fh,b0h
+			db	e6h,e2h,e4h,0ah,e3h,6eh,3dh,f2h
+			db	39h,c1h,b2h,b3h,ebh,dch,ddh,f2h
+			db	6fh,a3h,71h,b3h,ffh,48h,6fh,b2h
+			db	b5h,15h,6fh,92h,6ah,33h,d9h,e6h
+			db	ebh,afh,47h,2eh,feh,50h,35h,14h
+			db	e7h,18h,dbh,d1h,c9h,c1h,8dh,0fh
+			db	f5h,4fh,c7h,7fh,41h,4ah,cfh,6ah
+			db	2ch,1bh,87h,19h,4dh,02h,9bh,9fh
+			db	82h,83h,68h,13h,28h,dch,f0h,8bh
+			db	36h,eah,9eh,88h,cbh,e9h,e9h,c0h
+			db	27h,a3h,a8h,03h,d2h,afh,b4h,c4h
+			db	9dh,3ah,43h,7eh,7fh,21h,4ch,84h
+			db	dfh,93h,61h,99h,7dh,e8h,eeh,b6h
+			db	51h,67h,37h,81h,2bh,a0h,42h,27h
+			db	1fh,04h,59h,34h,50h,78h,1ah,cbh
+			db	b9h,dch,b8h,67h,bah,80h,5fh,04h
+			db	c1h,ebh,07h,3bh,16h,62h,a0h,1bh
+			db	04h,25h,72h,fbh,d6h,3eh,00h,11h
+			db	4bh,f1h,e9h,deh,deh,e3h,8ah,6ah
+			db	e7h,c2h,d2h,00h,eah,27h,60h,3ah
+			db	7fh,a2h,73h,6ah,92h,d4h,87h,ceh
+			db	34h,4eh,97h,a8h,a3h,44h,1ch,53h
+			db	4ch,cch,76h,52h,1eh,53h,90h,77h
+			db	1eh,8fh,69h,2fh,36h,82h,ceh,94h
+			db	a6h,7ah,a1h,47h,91h,45h,3ah,11h
+			db	23h,afh,70h,39h,b4h,73h,00h,b0h
+			db	f3h,aah,95h,ddh,beh,fah,8bh,f0h
+			db	4bh,16h,15h,44h,06h,07h,36h,d1h
+			db	80h,30h,82h,4bh,2bh,20h,ceh,6fh
+			db	afh,44h,87h,27h,3ah,46h,1dh,35h
+			db	a1h,31h,8ah,22h,0eh,53h,70h,3fh
+			db	5eh,30h,ach,31h,87h,8ah,6bh,4eh
+			db	68h,bah,69h,6eh,7ah,72h,1dh,c0h
+			db	7ah,5ch,18h,9fh,dah,e4h,18h,15h
+			db	9bh,40h,c8h,edh,90h,edh,0dh,eah
+			db	1bh,50h,41h,76h,3eh,f6h,3fh,abh
+			db	bbh,2eh,09h,52h,ech,9ch,2ah,bah
+			db	1dh,9dh,4ah,bdh,c3h,b7h,a9h,2ah
+			db	03h,bah,17h,d0h,26h,b6h,c8h,e2h
+			db	cch,21h,9ah,2bh,b3h,55h,d6h,7bh
+			db	8fh,8fh,e5h,d4h,55h,13h,c7h,46h
+			db	edh,a3h,d8h,e6h,efh,47h,c9h,adh
+			db	bch,69h,e4h,21h,e8h,7bh,16h,5ch
+			db	90h,84h,57h,60h,eah,bdh,d7h,40h
+			db	b5h,e9h,62h,adh,a4h,67h,bdh,55h
+			db	1ah,9eh,60h,90h,86h,6fh,8fh,c2h
+			db	2dh,fbh,cbh,7dh,20h,54h,95h,7ch
+			db	eeh,53h,ech,adh,64h,fah,cdh,b5h
+			db	9fh,69h,ffh,6eh,77h,c5h,26h,abh
+			db	2eh,74h,99h,fbh,2bh,04h,d4h,93h
+			db	9ah,5dh,7ah,5fh,a3h,99h,8eh,a1h
+			db	53h,64h,edh,48h,b9h,edh,a0h,05h
+			db	e2h,9eh,a2h,b3h,09h,d6h,b2h,12h
+			db	61h,8dh,d6h,c6h,35h,deh,a4h,66h
+			db	e7h,83h,eah,bdh,52h,dah,e9h,36h
+			db	9eh,b6h,e8h,72h,a9h,3ch,19h,11h
+			db	0eh,7dh,93h,f4h,7eh,66h,9bh,04h
+			db	9bh,26h,e4h,83h,5dh,3dh,6dh,6fh
+			db	c0h,1bh,0dh,70h,83h,d0h,4dh,93h
+			db	12h,4ah,f1h,5dh,86h,05h,a5h,d4h
+			db	b8h,49h,01h,cah,2ah,02h,8ch,79h
+			db	71h,e7h,8dh,04h,e1h,d5h,73h,3bh
+			db	43h,20h,1eh,65h,deh,35h,7dh,52h
+			db	9fh,5ch,b7h,86h,4bh,3bh,d4h,8ah
+			db	25h,65h,3ah,eah,3bh,3ch,89h,68h
+			db	88h,e3h,b0h,89h,59h,54h,8dh,d8h
+			db	09h,40h,bbh,c1h,a7h,d6h,6ah,aeh
+			db	65h,cch,b0h,cch,66h,c9h,63h,59h
+			db	30h,f4h,deh,62h,cdh,1ch,6dh,17h
+			db	ech,2bh,d2h,2eh,42h,1bh,36h,43h
+			db	feh,27h,c3h,4dh,f1h,fbh,0fh,34h
+			db	a5h,4ah,02h,c4h,4fh,14h,c5h,f7h
+			db	2fh,0fh,d2h,97h,f7h,9eh,68h,b7h
+			db	67h,b7h,e1h,00h,2ah,a3h,2eh,efh
+			db	bdh,f5h,19h,04h,9bh,56h,62h,1dh
+			db	7eh,ddh,dch,15h,abh,24h,aeh,adh
+			db	f4h,09h,bfh,5eh,2ah,8ah,3ah,6dh
+			db	fch,a2h,3eh,30h,57h,52h,e7h,a9h
+			db	e6h,c0h,9ah,ddh,35h,29h,4eh,88h
+			db	24h,ddh,04h,2eh,84h,21h,29h,c8h
+			db	17h,07h,07h,bch,cfh,99h,9ah,6dh
+			db	b9h,97h,0bh,3eh,98h,6eh,c7h,09h
+			db	89h,ach,49h,45h,72h,2ah,5ah,8ah
+			db	f7h,53h,9ch,4dh,6eh,8bh,6eh,41h
+			db	7ch,87h,b0h,1ch,9dh,99h,19h,9fh
+			db	58h,e9h,27h,12h,55h,56h,4ch,a1h
+			db	7fh,f4h,6dh,39h,d5h,2bh,06h,e7h
+			db	62h,5ah,dbh,40h,74h,37h,97h,1ch
+			db	cah,b8h,39h,67h,eeh,61h,eeh,eeh
+			db	fdh,7ah,0ah,e7h,c9h,c6h,18h,b4h
+			db	67h,abh,a8h,99h,c4h,dch,68h,b9h
+			db	4bh,ech,0ch,2dh,c4h,6bh,09h,8eh
+			db	bdh,17h,3ch,58h,dch,d2h,37h,6eh
+			db	01h,2fh,2dh,32h,dch,deh,05h,fbh
+			db	ffh,28h,a7h,2fh,82h,79h,aah,10h
+			db	bah,65h,c8h,d0h,c4h,83h,32h,c4h
+			db	05h,3dh,40h,9eh,d2h,13h,2fh,06h
+			db	cah,0ah,09h,3bh,79h,dbh,edh,1fh
+			db	95h,3bh,2eh,f0h,72h,99h,7ch,dbh
+			db	5eh,bbh,24h,28h,c6h,53h,e2h,dch
+			db	5fh,e4h,09h,a8h,88h,14h,89h,37h
+			db	d2h,eeh,4dh,d1h,06h,c5h,f5h,3fh
+			db	7bh,d0h,0fh,21h,74h,76h,3ch,37h
+			db	6eh,60h,dbh,3eh,61h,f8h,f3h,2bh
+			db	d6h,09h,00h,c8h,c3h,20h,e9h,5fh
+			db	22h,35h,15h,04h,14h,8ah,6ah,00h
+			db	4ch,3eh,57h,3bh,3dh,92h,d6h,cch
+			db	09h,ech,0dh,6eh,58h,d6h,97h,dch
+			db	deh,d2h,c3h,7ah,7fh,7bh,34h,6eh
+			db	12h,4ch,29h,5fh,f9h,59h,d4h,23h
+			db	dch,a2h,88h,feh,18h,b3h,22h,bch
+			db	a4h,85h,47h,07h,ddh,4dh,bdh,cah
+			db	a8h,84h,3ch,43h,1eh,adh,bfh,4eh
+			db	41h,3bh,02h,beh,6ch,56h,b3h,f1h
+			db	b9h,a8h,63h,f6h,cbh,2bh,bch,90h
+			db	12h,2ah,5eh,c0h,cch,dah,33h,c6h
+			db	d2h,1fh,77h,13h,edh,c0h,9dh,6dh
+			db	edh,dah,29h,8eh,22h,f2h,d3h,01h
+			db	99h,77h,5dh,b5h,52h,bah,76h,e4h
+			db	92h,c1h,26h,13h,12h,f1h,4ah,19h
+			db	88h,5ch,6ch,6eh,f7h,d2h,f5h,55h
+			db	1fh,edh,b8h,98h,02h,4eh,c6h,c6h
+			db	cah,b2h,d5h,f8h,48h,11h,96h,96h
+			db	14h,40h,d3h,9ah,68h,27h,feh,c6h
+			db	96h,e5h,ffh,70h,15h,6bh,e0h,15h
+			db	e2h,1ch,5bh,2fh,1dh,e3h,82h,07h
+			db	f7h,fch,e8h,feh,bdh,a8h,f5h,5fh
+			db	93h,1ah,20h,f0h,b8h,8ch,b9h,d9h
+			db	d4h,f7h,07h,5ch,f3h,4fh,d7h,fch
+			db	8bh,23h,a6h,a4h,91h,c9h,a7h,65h
+			db	e1h,d4h,f3h,63h,1fh,1ch,74h,16h
+			db	f4h,96h,85h,a3h,04h,8dh,cdh,0ch
+			db	20h,dfh,c0h,0ah,a2h,60h,c3h,b0h
+			db	4ah,90h,7fh,d7h,57h,96h,64h,34h
+			db	a2h,8ch,dfh,edh,66h,53h,02h,dbh
+			db	b0h,8fh,1bh,5fh,67h,12h,e5h,90h
+			db	edh,19h,7bh,53h,2dh,49h,72h,64h
+			db	d7h,75h,99h,35h,d5h,b3h,28h,23h
+			db	25h,b3h,7bh,47h,e0h,57h,15h,bch
+			db	66h,cfh,aeh,95h,cch,29h,8ch,efh
+			db	afh,bfh,bfh,69h,36h,35h,94h,12h
+			db	46h,1ch,a0h,26h,feh,77h,3fh,70h
+			db	0ah,43h,78h,c4h,7dh,33h,c4h,e2h
+			db	78h,f2h,f7h,e0h,a5h,b3h,42h,d5h
+			db	4dh,30h,12h,47h,c1h,bfh,4ah,2ah
+			db	46h,83h,b8h,49h,bah,6eh,03h,b1h
+			db	cdh,75h,79h,9eh,e4h,70h,d2h,8dh
+			db	fdh,6bh,39h,86h,c5h,4fh,e8h,8ah
+			db	f5h,27h,e2h,dch,e5h,89h,d6h,9eh
+			db	96h,07h,dah,2bh,c0h,14h,67h,62h
+			db	bdh,8ch,16h,d9h,e4h,a8h,10h,f9h
+			db	cch,1dh,25h,1dh,33h,7fh,c7h,2fh
+			db	49h,9eh,3bh,43h,36h,fbh,a3h,0ch
+			db	57h,24h,efh,7dh,98h,bdh,f9h,64h
+			db	2bh,50h,1ah,6ch,b8h,18h,69h,5eh
+			db	a0h,5ch,a5h,71h,fdh,c8h,1fh,dch
+			db	87h,5eh,9bh,afh,bdh,3fh,54h,dah
+			db	3ch,d9h,15h,0ch,02h,9eh,7ch,10h
+			db	2dh,a8h,22h,47h,bah,90h,a5h,c5h
+			db	50h,8dh,1dh,10h,d6h,bdh,d9h,f4h
+			db	a4h,84h,9ah,f7h,95h,45h,27h,18h
+			db	7fh,e7h,15h,c8h,4eh,1fh,f7h,2ah
+			db	2dh,b6h,35h,5ah,55h,94h,48h,bfh
+			db	03h,a0h,f3h,01h,0ch,a1h,c7h,1ch
+			db	24h,fah,b9h,f7h,49h,7dh,8dh,05h
+			db	97h,7dh,fch,48h,d7h,0bh,31h,44h
+			db	feh,2eh,8ch,6dh,8fh,9eh,0fh,79h
+			db	5fh,7ch,60h,5dh,2eh,58h,b9h,20h
+			db	1fh,f9h,63h,c7h,71h,5ch,53h,4fh
+			db	50h,49h,a4h,6bh,f6h,abh,39h,cfh
+			db	7bh,41h,92h,6bh,ach,5dh,ebh,88h
+			db	95h,8dh,83h,cch,6eh,cch,14h,b2h
+			db	5bh,e7h,d5h,feh,e7h,b2h,b0h,cch
+			db	85h,a5h,adh,aeh,e2h,5fh,e4h,a9h
+			db	51h,50h,84h,59h,c8h,9ah,66h,e6h
+			db	73h,5dh,7bh,a1h,9ch,54h,deh,93h
+			db	6bh,41h,d0h,8bh,54h,89h,cch,24h
+			db	81h,2fh,9ah,adh,6bh,a1h,89h,fdh
+			db	dah,a6h,b7h,82h,eeh,bfh,0ch,b5h
+			db	71h,89h,b0h,e5h,b8h,56h,03h,1bh
+			db	99h,93h,8ch,00h,d5h,14h,04h,5ch
+			db	e4h,71h,dbh,6fh,e8h,64h,81h,33h
+			db	a9h,a1h,cbh,f9h,44h,f0h,efh,deh
+			db	5eh,e0h,46h,beh,cfh,34h,9fh,22h
+			db	b7h,94h,cbh,b4h,2ah,78h,e6h,b3h
+			db	39h,bbh,85h,26h,bbh,cdh,dfh,fah
+			db	fch,23h,d9h,7eh,f6h,79h,55h,4bh
+			db	43h,6ch,62h,ach,3ah,48h,47h,98h
+			db	96h,13h,66h,a9h,0bh,bdh,ddh,48h
+			db	f1h,26h,59h,feh,55h,afh,c5h,fbh
+			db	36h,8dh,f7h,11h,f7h,d0h,32h,00h
+			db	23h,35h,58h,0dh,5dh,15h,51h,abh
+			db	67h,e9h,1ch,b2h,17h,82h,d3h,59h
+			db	73h,f6h,42h,6bh,6dh,50h,eeh,cch
+			db	7ch,38h,fch,b1h,0ah,d3h,bah,8eh
+			db	d6h,60h,beh,44h,99h,71h,33h,26h
+			db	bah,0ah,12h,58h,18h,1ah,8eh,e6h
+			db	d4h,45h,f1h,d4h,86h,09h,bbh,aah
+			db	17h,ebh,a5h,cbh,3dh,deh,69h,c4h
+			db	0ah,d1h,cbh,b9h,58h,0ch,62h,c6h
+			db	13h,46h,73h,eeh,bah,90h,bch,82h
+			db	3bh,9bh,05h,61h,9ah,c4h,a8h,f2h
+			db	50h,83h,06h,91h,58h,95h,3eh,14h
+			db	cch,c0h,f0h,42h,e0h,77h,02h,2eh
+			db	3ah,c5h,e3h,b2h,b3h,e1h,73h,91h
+			db	0eh,e0h,abh,43h,88h,fch,c5h,51h
+			db	58h,12h,ceh,40h,82h,6dh,84h,9ch
+			db	eeh,e5h,6ah,b8h,48h,f7h,adh,82h
+			db	4fh,74h,7eh,76h,66h,66h,65h,9fh
+			db	dbh,f8h,d3h,b2h,e4h,d2h,3bh,b9h
+			db	a0h,05h,b7h,12h,0ah,00h,b0h,2fh
+			db	79h,e7h,94h,68h,23h,b1h,c7h,00h
+			db	47h,54h,0eh,83h,a4h,a9h,0ah,00h
+			db	69h,27h,1fh,0eh,51h,27h,fbh,bdh
+			db	41h,08h,6ch,85h,7eh,6ah,0eh,feh
+			db	14h,54h,56h,b8h,9ch,41h,75h,70h
+			db	39h,efh,1ah,0dh,c7h,b3h,10h,44h
+			db	e7h,30h,e3h,9dh,c8h,1eh,94h,d0h
+			db	69h,12h,86h,2ch,d2h,fch,19h,c2h
+			db	62h,11h,14h,01h,3dh,70h,a7h,c4h
+			db	83h,1ah,73h,2dh,4fh,9ch,a2h,68h
+			db	cah,0ah,bah,9eh,8dh,0bh,57h,beh
+			db	61h,2eh,5bh,48h,7ah,ech,2dh,83h
+			db	cah,5ch,5fh,66h,72h,e6h,edh,8ah
+			db	84h,f2h,47h,86h,feh,24h,64h,7fh
+			db	87h,3dh,c4h,c6h,b2h,3ah,93h,66h
+			db	82h,cfh,bah,ddh,57h,bbh,f5h,87h
+			db	5dh,1bh,9ah,11h,98h,20h,96h,5eh
+			db	1bh,a2h,03h,e7h,fah,84h,65h,0dh
+			db	40h,54h,c3h,01h,7fh,76h,f9h,e0h
+			db	cbh,e9h,bbh,5dh,ech,a4h,43h,cbh
+			db	67h,c8h,34h,5ch,ech,2dh,29h,56h
+			db	39h,44h,51h,95h,ach,60h,66h,13h
+			db	a5h,9dh,adh,16h,bfh,48h,1bh,bbh
+			db	2ch,16h,9dh,5fh,86h,c7h,4ch,b8h
+			db	c5h,64h,51h,ffh,cdh,dah,2bh,afh
+			db	6fh,4ch,88h,3fh,9ah,08h,47h,b9h
+			db	9ch,5eh,a9h,11h,09h,81h,fbh,43h
+			db	45h,28h,2ah,a0h,29h,d7h,71h,16h
+			db	c3h,87h,a2h,c9h,cbh,6eh,61h,2ch
+			db	72h,bfh,71h,6ch,1fh,42h,92h,2bh
+			db	d8h,a3h,bah,ech,10h,05h,0ah,cfh
+			db	83h,24h,e2h,27h,27h,91h,a6h,85h
+			db	8eh,9eh,c5h,f8h,69h,9eh,48h,5dh
+			db	4fh,74h,d5h,a8h,33h,07h,5eh,27h
+			db	c9h,8ch,4ch,63h,e5h,ebh,d9h,70h
+			db	9fh,16h,2fh,75h,42h,35h,85h,30h
+			db	deh,f5h,69h,65h,bdh,fch,79h,55h
+			db	19h,0bh,e9h,02h,fdh,c3h,12h,dah
+			db	61h,d3h,7eh,62h,5ah,51h,a9h,4ch
+			db	f7h,81h,97h,c9h,dah,46h,21h,0dh
+			db	edh,02h,b4h,61h,9dh,6bh,0dh,1ah
+			db	70h,8ah,f5h,4fh,06h,84h,83h,aeh
+			db	cdh,0ah,3ah,67h,7dh,1bh,6fh,50h
+			db	afh,e4h,09h,16h,abh,d4h,2fh,24h
+			db	fch,2bh,65h,85h,ffh,feh,32h,24h
+			db	09h,ddh,86h,89h,7ch,34h,9fh,bfh
+			db	6bh,37h,c9h,18h,4eh,9ch,d4h,18h
+			db	d4h,21h,8dh,0eh,31h,58h,f1h,b9h
+			db	1ch,5fh,93h,73h,15h,efh,96h,98h
+			db	69h,94h,42h,3dh,dch,c1h,f4h,8bh
+			db	c4h,90h,5ah,46h,cdh,82h,9bh,49h
+			db	5ch,3bh,a4h,d4h,8dh,6dh,e3h,b9h
+			db	20h,11h,e8h,a7h,f4h,c5h,4eh,d4h
+			db	b7h,42h,fbh,65h,35h,fbh,bbh,65h
+			db	cch,54h,d7h,4eh,03h,f8h,43h,0fh
+			db	e4h,8eh,4dh,9eh,51h,12h,eeh,e2h
+			db	40h,11h,93h,0fh,22h,27h,fbh,0bh
+			db	cfh,6bh,bbh,4eh,68h,17h,17h,f1h
+			db	2ah,06h,dah,36h,ech,0fh,2ah,f9h
+			db	3fh,69h,15h,8bh,d3h,bch,4eh,3ah
+			db	6ch,27h,f4h,8ah,c0h,edh,0bh,13h
+			db	74h,6bh,3eh,5eh,90h,6dh,2dh,d8h
+			db	c8h,1eh,6ah,d9h,b8h,d8h,50h,66h
+			db	a2h,a1h,53h,bbh,dbh,61h,eeh,d3h
+			db	cch,28h,a7h,ddh,c5h,03h,80h,13h
+			db	d5h,19h,50h,fah,51h,85h,36h,67h
+			db	b4h,deh,1eh,b9h,01h,23h,f4h,5eh
+			db	1bh,edh,c3h,49h,2bh,e4h,fch,dah
+			db	e9h,8ah,ebh,3dh,7dh,2ch,cch,c5h
+			db	49h,d8h,efh,f4h,c1h,7ah,88h,b3h
+			db	aeh,c2h,06h,68h,5ch,6fh,7dh,39h
+			db	1ch,c1h,97h,ebh,22h,c8h,81h,4bh
+			db	afh,dah,c9h,cdh,ebh,a4h,95h,87h
+			db	0ch,90h,c2h,bch,91h,d5h,0ch,5fh
+			db	beh,93h,deh,20h,e8h,4eh,dbh,3dh
+			db	c0h,b7h,5ah,3dh,6fh,37h,40h,21h
+			db	7ch,51h,fah,27h,04h,1bh,65h,5dh
+			db	69h,7fh,0bh,ceh,ffh,d3h,60h,72h
+			db	52h,43h,e5h,61h,3bh,c5h,17h,40h
+			db	8dh,93h,a4h,90h,49h,85h,44h,6eh
+			db	c6h,2eh,deh,e1h,e1h,eeh,dah,25h
+			db	98h,6ch,d7h,cbh,a8h,cfh,e5h,fch
+			db	67h,a7h,7eh,0bh,4dh,06h,eah,00h
+			db	01h,b6h,8bh,53h,a9h,f5h,0dh,e2h
+			db	7ch,7ch,d5h,d3h,e1h,18h,90h,f9h
+			db	d4h,4ah,f1h,30h,25h,18h,83h,ceh
+			db	21h,12h,b0h,feh,a3h,7bh,7dh,b3h
+			db	0fh,dfh,80h,86h,14h,79h,07h,45h
+			db	70h,25h,30h,b8h,91h,90h,d4h,04h
+			db	52h,31h,46h,fdh,4dh,32h,f5h,bdh
+			db	62h,2fh,31h,b9h,a1h,deh,83h,05h
+			db	11h,6bh,4bh,24h,38h,c6h,5dh,ech
+			db	44h,6fh,07h,88h,adh,48h,bbh,bfh
+			db	0eh,e8h,7fh,3ch,adh,b0h,42h,3fh
+			db	0eh,82h,31h,67h,90h,f8h,30h,c4h
+			db	feh,88h,fch,4fh,e1h,33h,cch,dfh
+			db	95h,7ah,5dh,e2h,03h,fdh,96h,3bh
+			db	dfh,94h,beh,15h,52h,9fh,7bh,53h
+			db	3fh,17h,c0h,25h,d9h,71h,09h,f4h
+			db	36h,49h,62h,e2h,47h,78h,03h,0fh
+			db	b4h,2bh,cfh,20h,2ah,e3h,01h,58h
+			db	4bh,b2h,2bh,5fh,0eh,1dh,29h,dah
+			db	48h,6eh,11h,90h,b3h,16h,a7h,f4h
+			db	4bh,ffh,04h,ffh,02h,15h,70h,b0h
+			db	f9h,84h,02h,13h,1fh,68h,97h,e7h
+			db	4eh,52h,6ch,cbh,95h,17h,49h,8bh
+			db	27h,81h,c4h,efh,aah,69h,51h,6ah
+			db	5bh,bfh,35h,55h,6dh,cah,21h,bbh
+			db	55h,90h,5dh,6eh,92h,c2h,91h,2eh
+			db	1ah,22h,94h,0fh,ffh,f6h,21h,19h
+			db	ech,d7h,2ah,6fh,9dh,8fh,20h,27h
+			db	75h,22h,cch,e3h,09h,26h,65h,77h
+			db	8ah,85h,55h,1ch,80h,1bh,bdh,3eh
+			db	f5h,f1h,22h,b2h,72h,fdh,32h,24h
+			db	a1h,ach,38h,bah,c0h,4ch,22h,75h
+			db	07h,14h,bah,3fh,5bh,d6h,18h,09h
+			db	43h,d1h,5eh,68h,07h,23h,bdh,4ah
+			db	33h,a9h,6dh,4eh,3dh,49h,71h,5eh
+			db	bfh,b6h,9dh,04h,ech,feh,99h,d6h
+			db	b1h,37h,2bh,58h,4fh,ebh,19h,41h
+			db	6ah,3eh,c1h,49h,4ah,e1h,adh,1ah
+			db	6fh,a5h,c5h,97h,42h,c0h,d2h,4ch
+			db	d1h,1ah,8fh,f8h,d0h,64h,07h,a7h
+			db	92h,6eh,ceh,90h,b2h,1fh,fdh,d1h
+			db	73h,28h,2fh,5bh,73h,b8h,7ch,0ch
+			db	a8h,80h,bfh,64h,c5h,19h,16h,e5h
+			db	feh,13h,58h,03h,9eh,60h,19h,25h
+			db	00h,88h,39h,61h,bch,85h,e6h,f7h
+			db	1dh,86h,2dh,b3h,e4h,09h,a0h,38h
+			db	a5h,a2h,0ch,82h,44h,abh,99h,8eh
+			db	36h,a2h,e1h,3ah,45h,b5h,e4h,e7h
+			db	22h,4eh,44h,d3h,9bh,5bh,0eh,1dh
+			db	b1h,8fh,47h,72h,33h,77h,77h,31h
+			db	dah,89h,d9h,22h,1ah,c1h,d6h,ffh
+			db	4eh,75h,39h,7bh,e0h,0fh,2bh,28h
+			db	4fh,94h,cch,6eh,63h,ach,01h,cfh
+			db	e8h,c7h,79h,85h,4ch,f9h,b4h,c6h
+			db	0fh,20h,46h,c9h,c8h,7bh,65h,0fh
+			db	34h,e0h,1eh,a3h,17h,f8h,66h,d1h
+			db	d7h,22h,8bh,6ch,12h,0eh,deh,8ch
+			db	73h,c8h,ach,49h,03h,bfh,ceh,0eh
+			db	4dh,53h,3dh,59h,5bh,d4h,fbh,b5h
+			db	0eh,87h,19h,71h,97h,92h,a8h,74h
+			db	45h,8ah,f9h,f6h,2bh,b5h,6ch,10h
+			db	40h,edh,5ch,74h,c8h,41h,9eh,cch
+			db	8eh,9fh,0ch,75h,f4h,fch,cch,35h
+			db	1ch,33h,9ch,dbh,dbh,31h,ebh,43h
+			db	16h,54h,d6h,b0h,d0h,4eh,2bh,c6h
+			db	95h,f5h,77h,0fh,00h,12h,eah,b0h
+			db	8ch,b3h,b9h,72h,beh,95h,bch,5fh
+			db	75h,9dh,57h,27h,1fh,ech,72h,6eh
+			db	deh,62h,fbh,e4h,f6h,27h,a5h,e9h
+			db	8bh,16h,ebh,edh,23h,1bh,cbh,e8h
+			db	87h,dbh,95h,08h,15h,55h,eeh,19h
+			db	c1h,cah,12h,20h,b2h,bch,98h,cdh
+			db	c5h,29h,1bh,e4h,8ch,52h,00h,bbh
+			db	88h,1ah,04h,6ch,cch,47h,10h,efh
+			db	3eh,d4h,2eh,28h,62h,7eh,e8h,56h
+			db	a5h,4fh,32h,ebh,c2h,9ah,31h,f0h
+			db	ceh,f4h,54h,8ah,71h,67h,51h,91h
+			db	42h,c0h,7dh,81h,d0h,abh,98h,12h
+			db	5ch,2bh,deh,a6h,c7h,79h,fdh,33h
+			db	8dh,44h,41h,b5h,72h,16h,97h,c5h
+			db	f9h,d4h,cdh,54h,4ah,31h,d1h,c1h
+			db	fah,b9h,3ah,4eh,9ch,45h,82h,e1h
+			db	f8h,d8h,50h,b0h,d8h,eah,8bh,9bh
+			db	58h,53h,0ah,93h,a1h,a4h,71h,73h
+			db	48h,6bh,55h,c5h,abh,d0h,8bh,50h
+			db	a3h,ebh,fbh,65h,68h,18h,dah,75h
+			db	34h,33h,5ch,7dh,04h,cbh,85h,80h
+			db	05h,d1h,d9h,15h,bdh,c4h,76h,94h
+			db	cah,4ah,57h,69h,54h,1bh,aah,43h
+			db	6eh,5ch,8dh,fch,37h,7fh,71h,51h
+			db	8ah,51h,a6h,66h,47h,5ch,fbh,0fh
+			db	feh,8dh,80h,05h,7bh,7fh,34h,0bh
+			db	beh,5ah,6ah,b4h,94h,5bh,b7h,b7h
+			db	ach,06h,a3h,f2h,e6h,c4h,dch,cah
+			db	2dh,ebh,61h,70h,69h,8fh,38h,e5h
+			db	7bh,90h,e8h,74h,d3h,e1h,ech,8ch
+			db	feh,8eh,cdh,40h,30h,30h,3ah,4ah
+			db	7eh,d3h,70h,f0h,eah,ceh,81h,27h
+			db	cdh,1fh,cah,9bh,ach,d0h,dch,e7h
+			db	ebh,76h,e7h,84h,43h,0ch,64h,57h
+			db	34h,9dh,ech,95h,37h,ech,d0h,d8h
+			db	91h,06h,59h,86h,14h,dbh,4dh,f5h
+			db	eeh,15h,f9h,4dh,a2h,2fh,b3h,a6h
+			db	5fh,54h,1fh,f9h,d3h,63h,68h,3ah
+			db	5ch,efh,e7h,f9h,7eh,33h,03h,1eh
+			db	5ah,b1h,adh,1ch,ddh,f8h,e7h,6ah
+			db	16h,f3h,16h,bfh,e5h,c4h,4dh,58h
+			db	3dh,1eh,c8h,91h,f8h,e2h,c5h,79h
+			db	52h,6ch,a6h,a2h,8dh,eeh,54h,83h
+			db	81h,bbh,20h,41h,81h,e7h,3ah,f6h
+			db	72h,e9h,d1h,f2h,50h,2bh,5fh,a4h
+			db	2eh,38h,7dh,92h,9ch,22h,71h,6ah
+			db	6bh,25h,0dh,94h,a4h,5ah,74h,39h
+			db	ech,d6h,b6h,96h,4eh,6dh,e4h,31h
+			db	58h,a9h,e2h,8bh,86h,8fh,a3h,66h
+			db	6fh,03h,15h,a7h,f4h,12h,8ch,2bh
+			db	46h,2ah,36h,6ch,dbh,36h,aah,ech
+			db	c4h,2eh,28h,a4h,22h,48h,dbh,dfh
+			db	36h,d8h,6fh,4ah,b1h,abh,43h,b4h
+			db	50h,69h,ddh,60h,eeh,b0h,a4h,4ch
+			db	1ah,17h,61h,aeh,5eh,73h,91h,48h
+			db	6dh,3ch,beh,09h,79h,9fh,84h,42h
+			db	4eh,ebh,eah,dch,44h,f3h,f8h,44h
+			db	97h,ach,adh,49h,b9h,79h,c3h,05h
+			db	cbh,2dh,61h,6fh,89h,3dh,66h,45h
+			db	84h,22h,b9h,d5h,31h,4ah,efh,1ch
+			db	d4h,1eh,65h,53h,ebh,c3h,94h,f5h
+			db	17h,b9h,a0h,0dh,b1h,5dh,23h,d9h
+			db	82h,a2h,d8h,2ch,63h,29h,f2h,1dh
+			db	39h,31h,3eh,19h,30h,e5h,eeh,44h
+			db	52h,2eh,c1h,cah,7fh,4eh,d6h,ceh
+			db	8ch,57h,bbh,b0h,b2h,9dh,6dh,7ah
+			db	1eh,59h,eeh,72h,73h,14h,8ch,57h
+			db	bdh,2eh,24h,20h,58h,37h,bbh,7fh
+			db	77h,d7h,f6h,afh,81h,f3h,75h,76h
+			db	65h,2ah,bch,29h,57h,24h,16h,5ah
+			db	c2h,06h,75h,f4h,10h,4bh,0dh,e9h
+			db	d6h,c5h,07h,b1h,22h,c8h,10h,cfh
+			db	20h,11h,8fh,5bh,75h,9eh,ddh,2eh
+			db	ach,d7h,1bh,48h,ebh,c5h,4ch,d3h
+			db	65h,57h,d6h,afh,91h,20h,5bh,21h
+			db	bfh,7ch,5ah,67h,88h,62h,f5h,0bh
+			db	e5h,25h,0ch,9dh,cfh,3bh,d7h,81h
+			db	3bh,c1h,49h,7eh,3ch,67h,26h,21h
+			db	bch,94h,61h,82h,31h,4eh,b8h,fch
+			db	edh,4bh,a1h,8ah,cah,58h,ddh,6dh
+			db	35h,b9h,73h,35h,f2h,fbh,76h,6eh
+			db	3bh,48h,7eh,33h,ceh,bah,fah,7bh
+			db	8eh,b7h,fch,24h,ebh,d8h,95h,65h
+			db	48h,5ch,49h,06h,f7h,cdh,9dh,9ah
+			db	00h,fbh,c6h,feh,fbh,7ch,d9h,24h
+			db	f8h,e9h,03h,b6h,a7h,f9h,ceh,10h
+			db	e0h,2eh,3fh,c5h,2eh,5ch,b1h,08h
+			db	1bh,09h,a4h,afh,cah,61h,fah,25h
+			db	74h,05h,4ch,38h,41h,46h,b6h,15h
+			db	feh,98h,8eh,ceh,04h,0ch,0ch,6fh
+			db	4dh,94h,28h,74h,75h,2ch,2ch,0ch
+			db	4ah,86h,cah,a9h,00h,82h,e0h,dch
+			db	a3h,5ah,48h,72h,1dh,65h,c7h,bbh
+			db	18h,7fh,eah,54h,16h,11h,50h,0bh
+			db	23h,54h,a7h,70h,4ch,01h,b5h,a6h
+			db	deh,80h,e7h,d7h,50h,42h,e9h,f5h
+			db	c2h,03h,73h,82h,05h,12h,a1h,d9h
+			db	e3h,94h,91h,efh,a3h,fdh,f6h,f6h
+			db	42h,c9h,79h,88h,33h,2dh,9ah,c4h
+			db	5bh,27h,32h,c7h,98h,84h,03h,b5h
+			db	33h,32h,f6h,f0h,31h,3ch,17h,10h
+			db	5eh,38h,84h,53h,65h,5ah,50h,76h
+			db	f1h,78h,c8h,68h,d5h,ffh,ddh,eeh
+			db	e2h,45h,37h,73h,7dh,10h,4bh,d1h
+			db	9ch,1ch,3ah,06h,34h,a7h,56h,dfh
+			db	4eh,35h,61h,46h,1dh,dfh,bfh,d6h
+			db	2fh,a0h,92h,b7h,32h,57h,f9h,dch
+			db	45h,78h,f4h,b1h,d3h,0eh,ach,fah
+			db	aah,45h,feh,22h,f4h,68h,3eh,eah
+			db	f8h,29h,e6h,f1h,69h,ach,08h,a5h
+			db	edh,bah,96h,a5h,76h,8ch,3eh,2bh
+			db	d4h,6ah,4bh,e4h,a6h,3eh,8eh,ach
+			db	4bh,2ch,b0h,36h,50h,25h,0eh,17h
+			db	b0h,b6h,d1h,06h,0bh,2eh,78h,59h
+			db	e4h,a1h,31h,37h,b1h,85h,c3h,f1h
+			db	97h,fdh,a7h,bbh,98h,f2h,7dh,b0h
+			db	20h,d8h,59h,b1h,99h,37h,78h,9bh
+			db	b2h,efh,b5h,93h,27h,afh,0eh,40h
+			db	5fh,26h,d4h,99h,65h,01h,5eh,49h
+			db	3fh,5fh,7dh,73h,70h,bfh,a0h,cbh
+			db	bah,f9h,e5h,8dh,12h,98h,3fh,35h
+			db	f9h,d2h,76h,1ah,6ch,e2h,f5h,d6h
+			db	d4h,75h,d1h,a7h,d9h,9dh,e5h,98h
+			db	18h,deh,42h,c6h,52h,07h,f5h,a2h
+			db	48h,c1h,7eh,aah,f5h,06h,97h,d7h
+			db	62h,74h,d3h,bfh,96h,4ch,63h,bch
+			db	aeh,11h,15h,44h,ech,1dh,46h,82h
+			db	a7h,9eh,05h,92h,93h,98h,15h,e9h
+			db	48h,a1h,f9h,02h,44h,d0h,5eh,00h
+			db	99h,d5h,15h,47h,94h,3ch,bfh,1ah
+			db	86h,afh,f1h,f7h,eeh,abh,cbh,3dh
+			db	45h,61h,5ch,9eh,c1h,7bh,4bh,b3h
+			db	b7h,ach,cfh,7dh,cch,d2h,5ah,4dh
+			db	d6h,6ah,b2h,beh,84h,a1h,c2h,82h
+			db	9dh,94h,6ah,96h,a6h,40h,7dh,53h
+			db	02h,96h,48h,62h,5ah,bfh,8eh,63h
+			db	a1h,c8h,0ch,7bh,f4h,73h,beh,f9h
+			db	e6h,fbh,79h,4ah,d8h,eah,02h,34h
+			db	6fh,aah,87h,8bh,c9h,b9h,5ch,92h
+			db	54h,2bh,a0h,5ch,8dh,3dh,7bh,a4h
+			db	19h,a9h,94h,b7h,10h,6eh,9bh,5fh
+			db	51h,85h,84h,68h,15h,71h,83h,54h
+			db	ddh,bch,07h,6ah,77h,65h,87h,a2h
+			db	a5h,ebh,ach,0ah,1ah,b4h,5dh,25h
+			db	76h,5bh,99h,3dh,1bh,8ch,8bh,24h
+			db	7eh,3bh,c0h,e1h,d6h,efh,54h,5ch
+			db	beh,27h,1fh,0fh,5ah,32h,d3h,64h
+			db	61h,77h,88h,f1h,aah,f5h,a5h,c8h
+			db	68h,a0h,08h,fdh,1fh,1dh,51h,6bh
+			db	2fh,90h,eah,c9h,03h,7bh,c1h,e8h
+			db	e2h,f6h,7dh,0bh,08h,9dh,1ah,89h
+			db	7ch,c1h,a2h,54h,34h,83h,aah,76h
+			db	8dh,ffh,59h,9ah,f5h,5bh,99h,12h
+			db	46h,2bh,0ah,1bh,0ch,3bh,54h,fdh
+			db	57h,cch,4eh,e0h,0bh,87h,6bh,27h
+			db	eeh,afh,36h,77h,fch,2eh,cdh,eeh
+			db	26h,55h,c8h,5dh,44h,3eh,94h,ach
+			db	dch,e5h,8ch,78h,99h,94h,20h,1ch
+			db	ffh,f2h,aeh,95h,5dh,04h,67h,d8h
+			db	bch,dfh,beh,78h,fbh,50h,3ah,3fh
+			db	d5h,26h,41h,bch,43h,41h,ach,34h
+			db	6eh,c3h,d8h,9ch,89h,2eh,bbh,19h
+			db	2bh,cdh,51h,6ch,a9h,96h,63h,f9h
+			db	d3h,36h,b9h,eeh,74h,a6h,edh,74h
+			db	30h,b0h,37h,41h,50h,33h,50h,dah
+			db	a4h,6dh,4eh,78h,85h,15h,bah,a0h
+			db	15h,09h,bch,60h,bdh,b1h,80h,8ah
+			db	5dh,ceh,3fh,65h,8eh,31h,edh,81h
+			db	dfh,4ch,67h,37h,b0h,52h,2dh,94h
+			db	a7h,e9h,aeh,38h,62h,55h,0bh,0ch
+			db	eah,93h,6bh,76h,06h,27h,9bh,60h
+			db	57h,9dh,bah,91h,4fh,f6h,e4h,d2h
+			db	ffh,92h,06h,3eh,5eh,07h,fbh,55h
+			db	d6h,c2h,c2h,95h,63h,a4h,deh,a6h
+			db	9ah,81h,29h,06h,7dh,5dh,4ah,86h
+			db	fch,48h,0dh,cbh,64h,d4h,e1h,a1h
+			db	3fh,c9h,21h,a5h,74h,6bh,7dh,6fh
+			db	c2h,74h,0dh,30h,aeh,7fh,2dh,81h
+			db	e4h,20h,a7h,79h,74h,b6h,20h,f5h
+			db	a3h,91h,49h,27h,65h,eeh,30h,bdh
+			db	00h,c5h,14h,83h,24h,10h,e9h,b4h
+			db	6dh,e1h,e5h,ech,31h,03h,35h,c1h
+			db	93h,ddh,37h,aeh,0bh,66h,f1h,95h
+			db	14h,a5h,50h,edh,38h,ddh,a5h,13h
+			db	0eh,c5h,deh,88h,77h,93h,6bh,20h
+			db	dah,f7h,67h,1ah,42h,58h,57h,cdh
+			db	cch,a2h,68h,7ah,d2h,52h,f9h,63h
+			db	15h,b0h,43h,60h,41h,38h,eeh,8ah
+			db	09h,aeh,08h,6fh,bbh,b9h,41h,54h
+			db	c9h,1bh,cbh,ech,75h,5ch,3eh,94h
+			db	ceh,d7h,e4h,adh,e5h,14h,8dh,3dh
+			db	34h,f5h,0ch,ceh,fch,afh,8ch,33h
+			db	90h,31h,0bh,3eh,03h,30h,22h,27h
+			db	feh,04h,0bh,51h,b2h,27h,74h,a6h
+			db	d1h,25h,c5h,6ch,e2h,93h,72h,13h
+			db	53h,3fh,6fh,94h,35h,79h,64h,a2h
+			db	58h,deh,4eh,68h,09h,9dh,70h,a7h
+			db	96h,b5h,93h,efh,52h,beh,a5h,46h
+			db	e7h,c9h,2ch,c5h,26h,c4h,5ah,47h
+			db	c9h,81h,efh,9bh,fdh,2fh,dfh,a6h
+			db	1dh,b4h,0fh,5fh,1fh,5ch,dbh,42h
+			db	1fh,47h,d4h,f3h,9ah,76h,15h,c6h
+			db	20h,73h,b3h,99h,ebh,55h,51h,79h
+			db	88h,81h,86h,9fh,41h,d8h,eah,26h
+			db	c8h,36h,5ah,c1h,86h,9ah,ebh,66h
+			db	b5h,6bh,52h,33h,c1h,17h,05h,d2h
+			db	81h,86h,6ch,46h,98h,efh,c4h,39h
+			db	38h,a9h,97h,14h,7bh,3bh,39h,f5h
+			db	0fh,1dh,59h,07h,c4h,78h,62h,b7h
+			db	bch,71h,79h,73h,b9h,f7h,4fh,a3h
+			db	54h,1bh,10h,6fh,d1h,beh,40h,c0h
+			db	01h,d2h,e5h,94h,b0h,3eh,cch,e1h
+			db	25h,5bh,b8h,dah,e8h,27h,d6h,5fh
+			db	21h,04h,41h,88h,c0h,6ah,f6h,dfh
+			db	6ah,94h,48h,bch,dch,50h,59h,5ah
+			db	f6h,1ch,9dh,7ch,e8h,4bh,54h,bdh
+			db	21h,1ah,a4h,c4h,1fh,e7h,a3h,4eh
+			db	2eh,3dh,b8h,9ch,bdh,f5h,b7h,0eh
+			db	cch,04h,4ch,5dh,70h,d9h,7eh,bch
+			db	47h,aah,82h,9ah,25h,18h,9eh,57h
+			db	1eh,59h,f1h,29h,1dh,abh,38h,6bh
+			db	aeh,4dh,b0h,f1h,ddh,bah,3ch,c3h
+			db	4ah,25h,83h,46h,59h,11h,01h,9fh
+			db	f0h,26h,b2h,10h,b3h,1dh,0ah,80h
+			db	93h,6bh,c7h,5dh,2eh,5ah,80h,01h
+			db	edh,5ah,c3h,09h,14h,98h,fbh,d2h
+			db	e5h,45h,33h,afh,cch,eah,55h,b4h
+			db	e9h,45h,08h,32h,70h,d0h,1ch,6ah
+			db	cdh,9ah,1fh,68h,f3h,b9h,48h,c5h
+			db	6eh,56h,e4h,4ch,14h,24h,6fh,b6h
+			db	89h,42h,5dh,46h,72h,39h,80h,ebh
+			db	97h,1ah,fbh,b9h,9dh,57h,a0h,81h
+			db	d9h,04h,d9h,dbh,20h,19h,18h,c6h
+			db	33h,0fh,ddh,d1h,ddh,9ah,fch,62h
+			db	dfh,7bh,77h,44h,d3h,88h,04h,aah
+			db	e1h,16h,b1h,39h,52h,14h,55h,87h
+			db	73h,b8h,74h,49h,81h,a6h,51h,f8h
+			db	1ch,9bh,aeh,9bh,4ah,71h,c8h,97h
+			db	8fh,31h,b4h,cch,1fh,c0h,a1h,83h
+			db	4ch,88h,bch,4dh,0eh,65h,88h,8eh
+			db	cfh,ebh,efh,c0h,51h,b0h,5bh,a1h
+			db	5ah,f6h,25h,2dh,e1h,11h,c9h,0eh
+			db	b6h,89h,5dh,ech,20h,b8h,0fh,c9h
+			db	91h,d0h,e5h,6eh,5eh,b0h,28h,b3h
+			db	04h,89h,afh,1dh,efh,cch,6fh,01h
+			db	7fh,adh,3ch,93h,9fh,c0h,ffh,28h
+			db	35h,64h,75h,96h,a7h,75h,33h,06h
+			db	f1h,b5h,6eh,44h,d0h,aeh,55h,17h
+			db	06h,98h,1ch,efh,a9h,97h,4eh,fah
+			db	d5h,5ch,3ch,d0h,65h,05h,88h,bdh
+			db	27h,20h,2ch,11h,14h,cch,96h,21h
+			db	c2h,e7h,aah,9eh,7dh,ffh,1ah,c6h
+			db	4dh,1dh,95h,85h,c8h,d8h,18h,ebh
+			db	87h,d3h,b2h,8bh,c2h,03h,12h,d9h
+			db	3ah,8eh,5ch,7ch,5fh,50h,6ah,78h
+			db	80h,eeh,5bh,81h,03h,eah,51h,46h
+			db	39h,cah,c1h,e6h,7dh,11h,29h,69h
+			db	23h,3bh,11h,c7h,67h,f2h,fch,08h
+			db	33h,8dh,0bh,4bh,e2h,f5h,e7h,adh
+			db	70h,b3h,77h,4fh,20h,77h,e3h,2ah
+			db	c4h,90h,89h,3ch,84h,a2h,1eh,89h
+			db	34h,34h,b7h,97h,b7h,aeh,e7h,a2h
+			db	aeh,b1h,4ah,7ch,7ch,c0h,3bh,82h
+			db	51h,d0h,98h,5fh,d9h,6fh,fah,e1h
+			db	cdh,2eh,d1h,45h,c4h,d6h,26h,70h
+			db	2ah,09h,abh,9ch,15h,50h,fch,2bh
+			db	69h,a2h,e8h,dfh,ebh,c9h,ebh,bah
+			db	93h,87h,8eh,8bh,5eh,6bh,1bh,e3h
+			db	c6h,11h,45h,39h,cbh,44h,ffh,01h
+			db	07h,cdh,ffh,6ch,ffh,90h,36h,5dh
+			db	fdh,6ah,70h,87h,59h,bah,24h,d1h
+			db	fch,e5h,60h,f2h,09h,b9h,c9h,84h
+			db	b0h,c6h,45h,05h,11h,84h,7dh,0dh
+			db	97h,a6h,51h,8fh,67h,92h,47h,dah
+			db	f8h,fbh,c9h,c2h,21h,77h,43h,61h
+			db	80h,50h,aah,05h,09h,c4h,92h,81h
+			db	ech,46h,4eh,bfh,9bh,76h,12h,a6h
+			db	22h,8bh,59h,10h,61h,fch,45h,4ah
+			db	a6h,4eh,8eh,49h,d5h,bah,aah,e6h
+			db	d1h,b3h,a6h,fbh,a6h,a9h,6fh,c5h
+			db	92h,bah,41h,8ah,60h,79h,deh,c7h
+			db	ceh,3ch,b2h,1eh,8bh,f6h,adh,4fh
+			db	8bh,6eh,81h,51h,4eh,dbh,48h,30h
+			db	fah,7fh,c4h,c9h,eeh,24h,7bh,edh
+			db	54h,24h,06h,76h,86h,01h,8eh,69h
+			db	efh,0dh,77h,2dh,44h,c3h,eeh,1dh
+			db	90h,f3h,2ah,f3h,6fh,d5h,fdh,e9h
+			db	6bh,81h,7bh,73h,ffh,6dh,80h,e5h
+			db	6fh,66h,b9h,5eh,30h,c2h,3eh,e4h
+			db	2dh,69h,bch,c1h,96h,9fh,8ah,e5h
+			db	93h,e8h,5ah,13h,04h,49h,dah,99h
+			db	6ch,fah,b4h,62h,9bh,a2h,bch,adh
+			db	96h,c4h,10h,6ah,b1h,fah,43h,0dh
+			db	d4h,ceh,57h,0bh,18h,b2h,f0h,a3h
+			db	a1h,63h,74h,2bh,5eh,cah,f9h,bch
+			db	b5h,dch,ach,b4h,34h,0dh,07h,9eh
+			db	cbh,fch,efh,8ah,d2h,b6h,aeh,9ah
+			db	a3h,8bh,92h,b3h,30h,4bh,42h,6ah
+			db	8ch,53h,0ah,c0h,2dh,fdh,c4h,a6h
+			db	e9h,0eh,eeh,e2h,a1h,98h,59h,25h
+			db	30h,bfh,4ch,13h,8ah,41h,56h,6ah
+			db	24h,72h,d4h,48h,5bh,1fh,97h,23h
+			db	afh,bfh,04h,a2h,abh,41h,9ch,beh
+			db	61h,82h,d7h,b1h,84h,62h,72h,7ch
+			db	b1h,ffh,40h,7dh,bdh,f2h,46h,9fh
+			db	cdh,bdh,3fh,17h,ffh,7dh,c4h,20h
+			db	b8h,17h,1fh,4eh,0ch,26h,2ah,61h
+			db	60h,91h,07h,28h,52h,b0h,6eh,51h
+			db	65h,55h,7ah,5dh,58h,03h,2ch,51h
+			db	81h,e5h,12h,65h,b4h,a0h,0bh,19h
+			db	e5h,57h,1dh,14h,d5h,9eh,2eh,49h
+			db	c2h,23h,56h,67h,b5h,18h,59h,fbh
+			db	0dh,e8h,4bh,bbh,53h,e5h,65h,5bh
+			db	a7h,89h,41h,79h,74h,13h,25h,1bh
+			db	5ah,78h,bfh,4ch,7ch,edh,7eh,19h
+			db	8eh,cah,c2h,f8h,07h,d8h,e9h,42h
+			db	fbh,adh,2eh,edh,6fh,42h,dfh,43h
+			db	9fh,f4h,54h,54h,29h,f0h,35h,15h
+			db	b3h,42h,fah,5bh,e5h,14h,7dh,77h
+			db	53h,fbh,2ah,aeh,78h,d5h,56h,94h
+			db	cbh,fbh,8ah,28h,aah,2ch,2ch,a0h
+			db	4ah,76h,cah,35h,64h,f3h,5eh,52h
+			db	5bh,44h,6eh,d5h,12h,41h,1bh,f8h
+			db	67h,35h,1dh,c3h,f6h,f5h,cbh,6ch
+			db	50h,c0h,5dh,c8h,01h,c0h,57h,16h
+			db	90h,0ah,cah,b0h,9fh,c6h,59h,93h
+			db	a9h,61h,08h,ebh,deh,3eh,a6h,57h
+			db	42h,f4h,c3h,8ah,b2h,97h,14h,e3h
+			db	98h,22h,2ah,39h,14h,bbh,c4h,a8h
+			db	50h,6eh,28h,93h,4fh,54h,d8h,d3h
+			db	96h,18h,80h,b6h,03h,8dh,09h,84h
+			db	7bh,22h,05h,9fh,f3h,f5h,5ch,9fh
+			db	6dh,a5h,62h,d3h,15h,0dh,11h,adh
+			db	0ah,39h,7dh,fbh,52h,d4h,36h,d7h
+			db	c4h,40h,9bh,c0h,27h,f7h,2bh,67h
+			db	55h,e6h,45h,0bh,b0h,34h,14h,9dh
+			db	a2h,abh,2ch,72h,23h,51h,22h,d0h
+			db	0eh,d7h,3eh,91h,f6h,fdh,9eh,d8h
+			db	4ch,ceh,abh,52h,9ah,15h,beh,f8h
+			db	f0h,22h,93h,c3h,0ah,2dh,abh,5dh
+			db	81h,0bh,24h,cdh,3eh,5fh,c9h,21h
+			db	8fh,e9h,3bh,50h,93h,42h,56h,cbh
+			db	40h,43h,06h,2ah,b2h,b5h,fbh,9eh
+			db	8eh,abh,5ch,97h,a7h,d4h,72h,c2h
+			db	2ah,4bh,98h,f6h,cbh,cbh,17h,a2h
+			db	c3h,dfh,a7h,c9h,dah,47h,a8h,01h
+			db	52h,56h,9eh,3ah,61h,65h,7fh,7dh
+			db	a9h,dah,10h,8eh,9ah,05h,8eh,08h
+			db	87h,24h,c0h,ebh,a5h,a4h,6fh,b1h
+			db	78h,20h,4bh,50h,8ah,39h,2bh,72h
+			db	2bh,7fh,a3h,72h,9ah,d0h,c1h,2dh
+			db	8fh,40h,49h,d8h,2bh,a6h,93h,4eh
+			db	dbh,c5h,86h,e8h,25h,79h,0dh,13h
+			db	fdh,b5h,93h,ech,10h,82h,dbh,e7h
+			db	f2h,7dh,1ah,7ch,87h,bah,c4h,0ch
+			db	d0h,2ch,b7h,bch,17h,9fh,6ah,b8h
+			db	14h,a8h,eah,87h,c3h,99h,3eh,d4h
+			db	a5h,3fh,b1h,f7h,b0h,38h,6ah,f9h
+			db	f6h,a8h,62h,34h,bah,0dh,2bh,36h
+			db	39h,16h,18h,7eh,e8h,b3h,9dh,b4h
+			db	64h,6eh,2bh,35h,cch,1fh,e7h,a7h
+			db	88h,e9h,d0h,bbh,e4h,7ch,e7h,4ch
+			db	74h,5eh,c3h,6eh,28h,27h,e2h,17h
+			db	97h,9eh,a9h,eeh,61h,10h,70h,1dh
+			db	7dh,f8h,3bh,3ch,bbh,4eh,c7h,06h
+			db	abh,11h,2ch,bfh,3fh,e6h,71h,8eh
+			db	a6h,a5h,58h,bbh,1fh,eeh,d8h,59h
+			db	f1h,76h,1eh,67h,adh,beh,64h,23h
+			db	cbh,99h,93h,fbh,41h,4bh,36h,a7h
+			db	43h,c4h,5bh,c2h,6bh,00h,fah,34h
+			db	d7h,67h,50h,8fh,13h,55h,60h,a4h
+			db	05h,00h,c9h,d2h,78h,c1h,62h,5bh
+			db	19h,0eh,e4h,9fh,24h,34h,5ch,c3h
+			db	d6h,b1h,76h,f7h,93h,e4h,21h,78h
+			db	5bh,b9h,8dh,6fh,30h,6bh,cdh,f9h
+			db	c5h,a7h,1ch,b7h,1fh,86h,4bh,7ah
+			db	ceh,67h,13h,3ch,e7h,e9h,6ch,0ah
+			db	f6h,2eh,dah,46h,b3h,68h,cch,d2h
+			db	6ch,6ah,06h,d6h,f6h,9dh,a6h,a0h
+			db	31h,5fh,3ah,26h,c3h,61h,7eh,88h
+			db	03h,29h,61h,3ch,73h,74h,05h,f7h
+			db	08h,9eh,23h,d6h,2ch,d9h,9eh,0ch
+			db	19h,76h,84h,52h,95h,6dh,81h,f6h
+			db	e5h,f3h,6dh,13h,84h,d2h,04h,e8h
+			db	1bh,c6h,55h,dfh,0bh,cfh,52h,08h
+			db	1fh,88h,07h,b3h,c4h,13h,eah,dbh
+			db	51h,a0h,f7h,eah,8dh,6dh,9eh,43h
+			db	75h,cdh,7ah,f2h,67h,38h,17h,82h
+			db	2bh,dbh,b6h,52h,18h,6dh,d5h,f9h
+			db	4bh,fdh,ach,2eh,1ah,53h,aah,c2h
+			db	19h,34h,67h,b2h,b3h,90h,03h,23h
+			db	49h,60h,cfh,deh,a9h,f9h,61h,ceh
+			db	22h,6eh,66h,2dh,8ch,c5h,dfh,a8h
+			db	26h,3fh,73h,0eh,77h,c6h,a9h,b2h
+			db	6eh,0ch,d6h,a8h,0dh,a7h,efh,8ch
+			db	ceh,90h,f4h,32h,28h,75h,1ah,82h
+			db	01h,7fh,18h,14h,ceh,42h,03h,96h
+			db	a7h,c5h,10h,3ch,f5h,67h,cbh,2dh
+			db	1ah,7ch,d7h,60h,1ah,6eh,36h,0fh
+			db	8fh,2ch,dbh,6ah,07h,3fh,b7h,86h
+			db	47h,bdh,feh,33h,3dh,3fh,74h,dah
+			db	26h,0ah,49h,1fh,33h,2bh,58h,76h
+			db	e1h,86h,bfh,15h,8ch,41h,54h,6bh
+			db	6ah,0dh,6bh,85h,d2h,cch,22h,2bh
+			db	b5h,a6h,02h,70h,cfh,31h,c4h,a9h
+			db	f4h,2dh,9ah,c8h,edh,c3h,08h,10h
+			db	66h,2ch,6fh,05h,2bh,6bh,3dh,ddh
+			db	13h,8eh,43h,83h,41h,89h,25h,1dh
+			db	7ch,37h,ffh,4ah,17h,fdh,89h,dah
+			db	35h,d7h,f9h,a2h,5bh,50h,d5h,cdh
+			db	14h,bdh,75h,81h,03h,2eh,aeh,38h
+			db	02h,98h,f8h,f2h,33h,d0h,9dh,c1h
+			db	a2h,74h,e6h,aah,f9h,a0h,efh,b1h
+			db	13h,97h,e9h,e5h,46h,55h,2fh,f3h
+			db	18h,94h,39h,6ah,59h,23h,36h,69h
+			db	04h,76h,5fh,e6h,ech,18h,d6h,67h
+			db	fdh,79h,51h,f0h,1eh,11h,efh,5dh
+			db	1dh,b5h,36h,aeh,feh,e6h,3ah,25h
+			db	43h,7ch,b2h,c2h,4bh,fdh,e8h,f2h
+			db	ddh,51h,fbh,d0h,90h,cdh,09h,6dh
+			db	72h,49h,edh,dch,a4h,84h,71h,12h
+			db	7bh,b4h,9ah,45h,96h,6ch,48h,8dh
+			db	bfh,13h,4eh,c3h,2fh,01h,97h,72h
+			db	00h,5ah,5ah,e7h,e1h,b2h,7dh,bch
+			db	bdh,abh,32h,30h,11h,adh,ach,13h
+			db	0ch,feh,52h,beh,bch,cah,c1h,5ch
+			db	76h,4fh,8ah,efh,b1h,c0h,0dh,a0h
+			db	c5h,e5h,41h,a3h,a6h,f8h,53h,edh
+			db	ffh,a0h,19h,c7h,dch,73h,9bh,9bh
+			db	67h,4dh,04h,7ah,3ch,18h,8eh,70h
+			db	89h,7ah,76h,d2h,7ah,b1h,dah,7ah
+			db	1ah,c8h,87h,70h,42h,efh,00h,5eh
+			db	59h,40h,a7h,51h,5eh,0eh,43h,61h
+			db	09h,a4h,4eh,eeh,67h,79h,cbh,03h
+			db	bdh,cbh,65h,6ah,7eh,d8h,5ah,c1h
+			db	30h,f8h,b6h,83h,86h,cbh,42h,a4h
+			db	1dh,0dh,eeh,d0h,c8h,bbh,bch,a4h
+			db	a2h,dfh,d5h,89h,71h,81h,f2h,6bh
+			db	7dh,94h,ceh,fch,2ch,ffh,e6h,c1h
+			db	04h,f4h,ffh,67h,64h,beh,68h,6bh
+			db	30h,35h,eah,a5h,c9h,06h,8ch,5eh
+			db	14h,6eh,8eh,ddh,64h,bah,46h,b8h
+			db	42h,61h,aeh,02h,b5h,1ah,a0h,04h
+			db	45h,ddh,10h,a3h,39h,14h,97h,11h
+			db	eeh,32h,7bh,8dh,39h,81h,a0h,f6h
+			db	a7h,f9h,eeh,60h,02h,f8h,88h,9ah
+			db	35h,3bh,e7h,3fh,4bh,81h,d0h,edh
+			db	7dh,a4h,48h,23h,cah,4eh,a1h,abh
+			db	ebh,52h,a3h,e1h,9ah,59h,64h,b3h
+			db	64h,11h,95h,1fh,86h,d1h,47h,4bh
+			db	7eh,46h,17h,29h,0ch,bch,0ch,44h
+			db	53h,1ch,a0h,a4h,e8h,6fh,b9h,a7h
+			db	6bh,11h,8bh,72h,71h,43h,20h,3ah
+			db	87h,c4h,95h,eeh,1dh,c5h,76h,8ch
+			db	c8h,9bh,1dh,8ah,8bh,94h,07h,abh
+			db	3bh,bfh,e7h,2eh,3eh,0eh,a5h,c7h
+			db	b6h,8ah,21h,f8h,2dh,aah,78h,c2h
+			db	26h,bfh,35h,94h,45h,6dh,ebh,48h
+			db	feh,8bh,e9h,2bh,e5h,5eh,d2h,a6h
+			db	5dh,d3h,28h,9fh,31h,98h,6fh,ffh
+			db	e4h,49h,39h,dfh,e3h,cch,f0h,b8h
+			db	bbh,9bh,5bh,f5h,3eh,e6h,f0h,95h
+			db	69h,2dh,47h,6eh,80h,80h,7bh,9eh
+			db	8dh,deh,2fh,29h,c2h,80h,fbh,9bh
+			db	69h,cdh,97h,6eh,3ch,5eh,9ah,f2h
+			db	8ah,1ah,79h,9fh,85h,50h,69h,33h
+			db	2ah,a5h,c6h,29h,dch,e6h,2ch,78h
+			db	bbh,16h,f6h,f2h,5eh,c8h,00h,bch
+			db	4fh,41h,feh,feh,58h,e7h,95h,cbh
+			db	32h,bah,2fh,efh,45h,6ch,64h,c4h
+			db	dah,a7h,b9h,ceh,37h,e9h,99h,5dh
+			db	c5h,44h,ddh,0eh,4fh,07h,6fh,e4h
+			db	e4h,c9h,32h,9bh,afh,ceh,87h,96h
+			db	19h,fch,15h,98h,a4h,26h,87h,c5h
+			db	06h,d3h,26h,5bh,6ah,a3h,97h,ddh
+			db	e9h,2fh,61h,b1h,3fh,f7h,8ch,e2h
+			db	ach,0bh,0fh,62h,31h,17h,1dh,b3h
+			db	75h,56h,22h,abh,dah,14h,50h,d9h
+			db	03h,e1h,83h,9ah,d3h,6fh,c7h,50h
+			db	ach,1fh,b7h,c8h,88h,80h,1fh,d1h
+			db	9eh,16h,5bh,87h,e7h,dch,89h,72h
+			db	85h,3ah,66h,f6h,04h,bah,8ah,3ah
+			db	f0h,e7h,06h,a2h,34h,d7h,cah,32h
+			db	38h,a7h,25h,b5h,3bh,6ah,23h,0ch
+			db	a9h,e0h,fah,03h,c6h,32h,6ch,9bh
+			db	27h,98h,b7h,8ah,34h,fah,d7h,8dh
+			db	dfh,40h,bah,2ch,83h,4bh,d3h,45h
+			db	c6h,2ah,10h,45h,53h,42h,42h,46h
+			db	bfh,44h,09h,0eh,0dh,11h,e6h,4ah
+			db	35h,d3h,0fh,21h,dch,5bh,97h,56h
+			db	33h,4dh,aah,b5h,86h,52h,ebh,d2h
+			db	53h,32h,66h,f3h,68h,7ah,9ah,61h
+			db	3bh,67h,cfh,f0h,b9h,b8h,12h,3ah
+			db	77h,39h,c9h,7bh,18h,6eh,c9h,81h
+			db	1fh,82h,1ah,4ch,dfh,9dh,85h,78h
+			db	d7h,97h,a3h,6eh,f4h,23h,f1h,aeh
+			db	00h,41h,0fh,fdh,31h,44h,3ch,64h
+			db	55h,aah,7fh,2bh,eeh,77h,74h,5ch
+			db	d9h,eah,f9h,a5h,88h,73h,99h,c0h
+			db	2bh,78h,deh,afh,13h,65h,cfh,b1h
+			db	97h,30h,4eh,a1h,f3h,9fh,09h,41h
+			db	2eh,96h,2eh,bfh,c9h,7bh,6bh,66h
+			db	61h,2eh,f4h,66h,12h,50h,abh,55h
+			db	53h,3fh,f8h,65h,4bh,b0h,58h,78h
+			db	79h,86h,23h,4ah,ffh,2ch,a4h,f5h
+			db	58h,67h,2bh,fch,53h,4bh,f8h,d5h
+			db	57h,5bh,66h,cch,57h,e6h,56h,cah
+			db	fah,67h,61h,60h,aah,98h,6dh,c9h
+			db	bfh,52h,22h,57h,a2h,64h,1bh,40h
+			db	b7h,e5h,48h,1dh,a8h,5dh,a4h,44h
+			db	1ah,6bh,4ch,dfh,2ah,b6h,97h,a4h
+			db	c6h,56h,49h,61h,efh,e7h,7eh,c4h
+			db	22h,a6h,a0h,b4h,54h,6eh,d8h,2ah
+			db	10h,e4h,d9h,fdh,3eh,90h,c5h,40h
+			db	7dh,eeh,0ch,77h,08h,fch,f4h,1eh
+			db	abh,d0h,a6h,82h,37h,4ah,2bh,33h
+			db	beh,b4h,6fh,a9h,c3h,a6h,24h,1eh
+			db	09h,38h,54h,2bh,26h,38h,4eh,6bh
+			db	4dh,c4h,d3h,6ch,59h,52h,edh,fah
+			db	f5h,c4h,e0h,e3h,aeh,86h,b7h,1dh
+			db	b4h,09h,78h,5dh,ech,5ch,3eh,0ch
+			db	efh,f7h,48h,1dh,e3h,bdh,36h,33h
+			db	7eh,2fh,b2h,96h,2ah,8dh,6bh,fbh
+			db	8eh,c4h,56h,7dh,e2h,14h,d2h,3ch
+			db	20h,bfh,fdh,8fh,feh,e5h,29h,2eh
+			db	aah,29h,c3h,e3h,00h,59h,12h,09h
+			db	89h,fbh,85h,06h,b9h,34h,e0h,33h
+			db	ebh,2bh,7bh,d6h,c9h,67h,d6h,9dh
+			db	dfh,18h,69h,cah,7dh,72h,82h,93h
+			db	25h,8dh,9ah,79h,1eh,d0h,01h,c0h
+			db	71h,0bh,feh,d1h,d3h,e1h,dah,54h
+			db	7eh,38h,a4h,29h,c3h,5ch,38h,40h
+			db	d8h,7dh,29h,b7h,f7h,f4h,5fh,bch
+			db	28h,6ah,88h,97h,d9h,9bh,26h,19h
+			db	a3h,85h,f0h,e1h,d5h,e0h,b0h,6fh
+			db	05h,48h,6ah,83h,a9h,7ah,29h,47h
+			db	00h,0eh,13h,5ch,b0h,83h,90h,9ch
+			db	81h,b3h,a5h,79h,bch,afh,beh,62h
+			db	fbh,30h,0dh,f3h,f8h,5eh,fbh,74h
+			db	ddh,4dh,87h,f7h,63h,4ch,bch,53h
+			db	2bh,23h,0eh,d3h,efh,69h,14h,e7h
+			db	8ah,a6h,2dh,4bh,cbh,3bh,a1h,99h
+			db	1eh,d4h,9bh,2fh,47h,80h,c8h,c4h
+			db	70h,57h,b9h,92h,86h,b2h,1dh,f3h
+			db	20h,45h,44h,1fh,4ch,1ah,69h,f1h
+			db	99h,21h,c2h,41h,e2h,41h,36h,a8h
+			db	9eh,4bh,7eh,34h,5bh,2bh,b5h,45h
+			db	ceh,88h,0ah,73h,74h,a7h,cah,8eh
+			db	c1h,a0h,0bh,3eh,4ah,50h,1eh,5fh
+			db	5dh,89h,47h,27h,3dh,e8h,3dh,1dh
+			db	37h,a2h,deh,e1h,c7h,34h,6fh,51h
+			db	c7h,10h,19h,3eh,c3h,7ah,bch,ech
+			db	04h,98h,60h,5fh,eah,dfh,ffh,ebh
+			db	4ch,25h,42h,b0h,45h,09h,68h,8dh
+			db	0fh,36h,fah,bdh,9fh,45h,28h,17h
+			db	4eh,dfh,33h,94h,54h,b6h,d2h,10h
+			db	90h,1eh,1ah,8fh,86h,a1h,c5h,a9h
+			db	3fh,3bh,63h,83h,21h,5ah,cfh,b5h
+			db	64h,40h,c8h,50h,33h,b8h,38h,34h
+			db	d8h,7bh,00h,5dh,eeh,5eh,01h,d4h
+			db	18h,5ah,e5h,21h,66h,48h,adh,bdh
+			db	9dh,61h,00h,34h,b9h,ach,63h,35h
+			db	2bh,81h,08h,08h,20h,70h,20h,56h
+			db	d3h,a0h,5fh,22h,01h,77h,15h,03h
+			db	a0h,27h,f2h,48h,71h,31h,dah,c9h
+			db	3ch,b5h,9bh,94h,60h,70h,a2h,49h
+			db	24h,fch,5fh,62h,58h,cdh,84h,a8h
+			db	4eh,02h,5eh,53h,88h,93h,21h,53h
+			db	c8h,06h,9ah,8dh,f7h,b6h,a5h,96h
+			db	1bh,b3h,50h,1ch,2dh,6dh,3eh,b1h
+			db	e8h,4eh,bfh,1ch,a4h,a5h,9ch,ebh
+			db	0ah,bdh,05h,d8h,2ch,85h,74h,25h
+			db	0eh,19h,c2h,14h,fbh,98h,b9h,7fh
+			db	77h,35h,a4h,63h,34h,08h,8bh,21h
+			db	2ah,b6h,07h,ffh,ebh,2fh,b7h,f7h
+			db	22h,9bh,c4h,89h,3dh,65h,9dh,87h
+			db	67h,48h,17h,c7h,0dh,6eh,ddh,0fh
+			db	e2h,0eh,1fh,65h,84h,dfh,c1h,1dh
+			db	d7h,8ah,e9h,70h,05h,8fh,b1h,4ch
+			db	2bh,ffh,c2h,5bh,ddh,96h,4eh,1eh
+			db	57h,97h,cah,5fh,94h,37h,bfh,e3h
+			db	02h,42h,25h,fch,09h,83h,58h,e3h
+			db	ech,9ch,6dh,51h,d9h,6ch,fch,4bh
+			db	90h,ceh,efh,d4h,cbh,1eh,2ch,95h
+			db	b8h,60h,7bh,c6h,86h,42h,d2h,87h
+			db	14h,6bh,6fh,0ch,11h,d2h,6ch,8fh
+			db	ddh,20h,26h,ffh,73h,4ah,1ch,28h
+			db	63h,d5h,2ch,08h,99h,bfh,c8h,44h
+			db	d3h,82h,73h,8bh,58h,0eh,44h,d3h
+			db	37h,3eh,84h,ddh,23h,adh,bah,55h
+			db	8eh,21h,ach,a8h,4bh,39h,03h,7fh
+			db	d4h,5ah,c3h,c2h,64h,a5h,c1h,71h
+			db	00h,25h,c2h,d5h,b9h,4ch,30h,c0h
+			db	5eh,efh,18h,ech,30h,bch,b8h,33h
+			db	41h,2eh,59h,8bh,1fh,81h,36h,35h
+			db	18h,dah,edh,bdh,cfh,eeh,65h,b1h
+			db	55h,cah,c9h,8bh,12h,68h,3eh,f0h
+			db	34h,e5h,58h,31h,e4h,cdh,9ch,8eh
+			db	d3h,74h,c4h,f9h,2fh,a6h,beh,cah
+			db	dch,42h,89h,76h,c3h,29h,48h,41h
+			db	afh,ceh,a8h,32h,e4h,7dh,26h,9fh
+			db	7ch,35h,04h,ddh,adh,58h,e0h,a4h
+			db	f0h,1dh,eah,40h,c8h,79h,dah,fch
+			db	bah,65h,adh,d7h,20h,eah,25h,7fh
+			db	00h,a3h,2dh,46h,6dh,78h,57h,95h
+			db	f0h,26h,04h,ceh,55h,14h,bah,3ch
+			db	fbh,c3h,81h,f7h,83h,15h,ach,11h
+			db	12h,8eh,0eh,b8h,c8h,47h,82h,99h
+			db	f5h,56h,b8h,0ch,37h,07h,eeh,0dh
+			db	f3h,9ch,b9h,78h,a9h,c4h,f7h,a5h
+			db	c1h,fch,bfh,9fh,48h,fdh,47h,d7h
+			db	f3h,33h,3ah,0fh,8ah,ceh,23h,f8h
+			db	15h,7ch,cah,a0h,a9h,78h,5ah,92h
+			db	40h,a0h,80h,73h,1bh,e6h,b3h,d9h
+			db	6ch,85h,37h,68h,72h,1bh,3ch,59h
+			db	c3h,bbh,5ah,57h,5eh,ebh,94h,a3h
+			db	d5h,d8h,fch,0ah,18h,8bh,a5h,0ah
+			db	63h,2dh,b8h,9fh,d5h,a6h,34h,ech
+			db	9fh,fah,ebh,cbh,35h,27h,98h,96h
+			db	efh,57h,4eh,0eh,27h,19h,f4h,04h
+			db	57h,66h,51h,74h,dfh,30h,99h,4bh
+			db	5ah,67h,4ch,53h,82h,fdh,c9h,d0h
+			db	38h,f0h,bfh,83h,53h,0dh,74h,71h
+			db	e4h,53h,71h,eah,b7h,9fh,aah,26h
+			db	dfh,0ch,fbh,b0h,a8h,5fh,a5h,dch
+			db	32h,4dh,7eh,64h,d5h,9bh,48h,e1h
+			db	71h,06h,aeh,80h,58h,93h,ceh,b1h
+			db	d3h,9fh,3ah,3ch,56h,97h,8bh,ech
+			db	08h,89h,0fh,21h,8dh,cdh,c6h,d6h
+			db	4ch,c3h,89h,eah,9bh,11h,4eh,72h
+			db	feh,83h,f1h,3dh,83h,a1h,9eh,7fh
+			db	1ch,26h,87h,3ch,63h,20h,b7h,4ah
+			db	d1h,f2h,f8h,27h,d2h,c8h,21h,60h
+			db	d5h,63h,d9h,b3h,99h,0fh,f2h,0ah
+			db	b7h,d0h,8bh,d3h,4ah,06h,8fh,e8h
+			db	52h,71h,22h,76h,bah,0eh,45h,59h
+			db	d9h,86h,cbh,eeh,feh,7dh,a4h,88h
+			db	3bh,4ch,bbh,09h,17h,d8h,c4h,88h
+			db	d6h,bdh,fch,dch,ffh,88h,ech,cfh
+			db	9dh,6eh,a6h,c6h,c4h,efh,edh,6fh
+			db	64h,2ah,57h,16h,02h,c9h,79h,ceh
+			db	10h,e3h,b1h,3bh,e3h,30h,9ch,cdh
+			db	81h,a6h,17h,dbh,70h,d3h,a7h,78h
+			db	2eh,99h,1dh,3ch,f2h,4dh,01h,dbh
+			db	2ch,88h,d4h,71h,90h,cfh,39h,c4h
+			db	9bh,93h,1fh,62h,29h,91h,7bh,f2h
+			db	a0h,3eh,4dh,fah,c1h,82h,7ch,52h
+			db	6eh,92h,7ch,e1h,c3h,52h,6dh,10h
+			db	24h,a3h,2dh,b8h,aah,99h,0fh,deh
+			db	8ah,74h,e2h,6eh,4dh,2bh,8bh,28h
+			db	92h,fdh,6dh,f0h,4fh,eeh,3eh,01h
+			db	5eh,05h,4dh,3fh,c2h,d6h,fdh,78h
+			db	00h,5ah,18h,a5h,64h,d4h,46h,7bh
+			db	f8h,26h,81h,f2h,ach,24h,67h,5fh
+			db	0ch,f9h,29h,f6h,deh,9dh,26h,4fh
+			db	2bh,f4h,7eh,e8h,6eh,22h,3ch,aeh
+			db	55h,a6h,55h,0fh,32h,32h,ach,76h
+			db	c2h,26h,cch,c7h,a0h,d4h,dah,4dh
+			db	76h,50h,a8h,62h,86h,12h,aah,57h
+			db	54h,10h,cfh,41h,a2h,ach,0bh,1dh
+			db	63h,8eh,12h,3bh,0bh,21h,09h,21h
+			db	9eh,33h,bah,68h,2ch,27h,c0h,1eh
+			db	a3h,50h,2dh,a2h,12h,49h,bch,5eh
+			db	ffh,38h,d6h,36h,dbh,ddh,5dh,e1h
+			db	86h,1bh,f6h,4dh,6ch,4dh,ebh,01h
+			db	ddh,6ch,81h,0dh,fch,80h,36h,3dh
+			db	b9h,5ch,f1h,91h,a8h,38h,fbh,68h
+			db	4ch,49h,77h,56h,15h,d1h,4dh,85h
+			db	26h,70h,c3h,1bh,a6h,1eh,3dh,b0h
+			db	14h,8eh,77h,90h,62h,e5h,eah,ach
+			db	abh,26h,cfh,ech,e3h,66h,29h,3eh
+			db	14h,bdh,91h,c3h,36h,12h,1bh,f1h
+			db	deh,1bh,97h,7eh,57h,d0h,c9h,53h
+			db	25h,a6h,57h,3eh,50h,e4h,f4h,4fh
+			db	d8h,37h,67h,34h,1bh,55h,adh,26h
+			db	11h,80h,7fh,a4h,deh,a6h,d0h,c2h
+			db	0eh,07h,cch,fah,50h,31h,42h,91h
+			db	48h,44h,76h,13h,3eh,bfh,84h,39h
+			db	58h,c7h,bah,08h,8ch,ebh,f7h,2dh
+			db	40h,0bh,3eh,77h,2eh,7fh,83h,c5h
+			db	f0h,13h,00h,5ch,8fh,10h,34h,c9h
+			db	d2h,0ch,12h,4fh,d7h,c1h,66h,76h
+			db	80h,4fh,a9h,fah,9ah,24h,f5h,bdh
+			db	6ah,7bh,bdh,43h,70h,b6h,46h,27h
+			db	9eh,7ah,e4h,46h,e0h,6eh,18h,61h
+			db	94h,01h,93h,77h,76h,80h,a4h,b4h
+			db	68h,17h,0bh,a7h,cah,6dh,dch,5ch
+			db	cfh,52h,35h,5bh,16h,fdh,c0h,9dh
+			db	f6h,c6h,35h,6dh,55h,e9h,9fh,17h
+			db	d1h,81h,ceh,20h,67h,c2h,a7h,03h
+			db	fch,bch,4ah,e2h,5eh,73h,24h,deh
+			db	71h,90h,47h,90h,9ch,82h,e2h,e5h
+			db	7fh,adh,ffh,c1h,38h,17h,ddh,42h
+			db	9bh,8dh,f7h,f8h,19h,0ch,2eh,45h
+			db	59h,e4h,40h,7ah,e1h,e8h,1fh,9ah
+			db	ceh,5ch,d7h,15h,d2h,dch,1fh,53h
+			db	23h,a3h,ech,66h,efh,84h,d8h,15h
+			db	64h,cch,47h,b9h,4fh,4ch,d7h,53h
+			db	22h,ach,41h,43h,20h,60h,64h,ebh
+			db	c8h,ach,e4h,e5h,6bh,27h,e6h,6dh
+			db	25h,88h,26h,84h,c5h,88h,3eh,21h
+			db	02h,35h,37h,cbh,45h,a8h,88h,5ah
+			db	31h,44h,7ch,4ah,ach,2ah,e4h,96h
+			db	45h,91h,c3h,60h,92h,73h,6dh,5fh
+			db	06h,9fh,a3h,61h,1ch,deh,97h,d5h
+			db	e7h,01h,eeh,71h,a6h,00h,a2h,96h
+			db	0ah,fah,a8h,d0h,f1h,fch,efh,02h
+			db	e7h,56h,7bh,58h,f2h,8bh,0eh,3fh
+			db	c8h,f0h,8bh,ebh,2dh,7bh,97h,81h
+			db	f8h,fbh,cdh,15h,12h,8ah,e4h,f7h
+			db	f4h,e4h,4ch,19h,40h,80h,cfh,8fh
+			db	10h,7dh,64h,b6h,cbh,b8h,93h,31h
+			db	04h,e7h,7eh,51h,5dh,3ah,56h,13h
+			db	87h,02h,05h,49h,8fh,21h,c7h,e1h
+			db	8fh,85h,fbh,6bh,12h,c6h,e3h,90h
+			db	00h,2ah,beh,1ah,09h,f9h,c6h,cah
+			db	2ch,92h,d7h,e2h,d7h,19h,6eh,aeh
+			db	94h,0fh,02h,afh,cdh,75h,a8h,5eh
+			db	75h,46h,82h,b5h,e7h,00h,98h,96h
+			db	f1h,f1h,12h,64h,2fh,47h,c2h,54h
+			db	69h,90h,70h,85h,58h,33h,beh,8ah
+			db	d7h,b6h,a7h,4ah,b3h,96h,82h,cbh
+			db	d9h,abh,c7h,6ch,c1h,3bh,ceh,51h
+			db	5ah,cah,66h,07h,eeh,7ah,11h,d1h
+			db	31h,92h,9eh,bah,73h,c9h,0bh,09h
+			db	c7h,beh,9ah,ffh,8fh,86h,9eh,c8h
+			db	a3h,aeh,f4h,64h,4ch,f6h,a7h,69h
+			db	30h,adh,f2h,54h,10h,00h,5bh,8dh
+			db	5dh,2ch,8bh,02h,3eh,94h,cdh,e9h
+			db	e1h,6eh,25h,52h,bdh,17h,0bh,1dh
+			db	5ch,6bh,bbh,96h,84h,87h,05h,d0h
+			db	e1h,bah,cbh,d8h,f2h,d7h,e3h,04h
+			db	04h,ebh,0ch,a2h,29h,31h,a2h,f1h
+			db	87h,01h,31h,fdh,75h,c3h,80h,01h
+			db	c4h,8dh,b6h,0ah,e4h,d8h,b3h,45h
+			db	2ah,8fh,d4h,ceh,0bh,2ah,4dh,b8h
+			db	93h,0bh,6dh,0fh,c0h,4fh,38h,2ah
+			db	21h,d0h,c2h,b3h,f9h,07h,d6h,1ch
+			db	b8h,fch,7dh,57h,ach,58h,16h,e3h
+			db	ceh,e6h,8bh,48h,ech,e3h,cch,5bh
+			db	ffh,1dh,29h,e5h,32h,12h,93h,3bh
+			db	81h,54h,31h,24h,8bh,86h,c9h,b7h
+			db	27h,d2h,3dh,71h,14h,c1h,ffh,19h
+			db	8ah,29h,0bh,d6h,5bh,beh,92h,55h
+			db	3fh,25h,17h,3ch,7ch,05h,31h,c6h
+			db	bch,d0h,39h,3bh,44h,0dh,69h,ceh
+			db	fbh,bdh,87h,f4h,33h,8ah,0eh,ceh
+			db	c5h,a3h,bbh,b9h,0ah,6ah,41h,25h
+			db	61h,e6h,abh,c1h,45h,b3h,34h,ffh
+			db	11h,84h,2ah,eah,5ch,6ah,dfh,42h
+			db	0ch,e6h,cbh,f5h,b6h,f7h,9dh,63h
+			db	8bh,dch,3bh,f5h,1fh,5ah,2fh,4bh
+			db	b2h,d4h,a7h,5ah,f0h,01h,2dh,a9h
+			db	a3h,78h,54h,87h,1bh,6eh,9eh,fbh
+			db	1ch,f5h,cfh,b0h,35h,8bh,d0h,d9h
+			db	21h,79h,1ah,14h,cch,f5h,21h,a3h
+			db	7bh,9ch,cdh,1bh,38h,ffh,78h,18h
+			db	ach,15h,1eh,beh,53h,2ch,6eh,99h
+			db	cbh,f2h,eeh,81h,e7h,d1h,4eh,05h
+			db	a8h,d7h,76h,b1h,3ch,a9h,8ah,c9h
+			db	76h,e2h,abh,3ah,ceh,9bh,d4h,17h
+			db	07h,18h,5ch,0ch,cdh,27h,8dh,07h
+			db	b3h,cfh,15h,f7h,79h,8fh,a7h,fah
+			db	8ch,05h,68h,2bh,85h,d7h,8ch,07h
+			db	e7h,41h,fdh,5bh,2ah,a8h,94h,e9h
+			db	28h,9ah,d6h,a7h,a4h,7fh,feh,04h
+			db	7ch,00h,adh,5dh,d7h,62h,02h,23h
+			db	11h,13h,1ah,eah,cah,bfh,03h,abh
+			db	d3h,04h,72h,6fh,62h,feh,1ch,fdh
+			db	2ah,dfh,90h,29h,8ch,97h,9ah,99h
+			db	27h,92h,08h,20h,5ch,27h,c8h,efh
+			db	e8h,5eh,45h,35h,11h,04h,2bh,a0h
+			db	46h,10h,c1h,a1h,b4h,04h,72h,fah
+			db	4dh,adh,55h,f8h,4bh,bdh,4ah,7ch
+			db	55h,47h,4ah,03h,9bh,82h,8ah,9dh
+			db	1fh,deh,b9h,25h,beh,12h,03h,f7h
+			db	7ch,0dh,8ah,24h,82h,61h,88h,47h
+			db	b7h,27h,e2h,d0h,16h,e8h,07h,a0h
+			db	00h,cfh,83h,39h,beh,9eh,3eh,c2h
+			db	3eh,88h,73h,feh,21h,07h,98h,83h
+			db	6ah,c1h,b3h,43h,f7h,3eh,86h,b9h
+			db	b4h,5dh,9dh,ech,26h,c7h,10h,5ah
+			db	43h,ech,91h,95h,cfh,adh,c9h,0eh
+			db	e0h,ffh,07h,4fh,e6h,d3h,9ch,e9h
+			db	93h,51h,c2h,d3h,45h,d8h,f1h,a1h
+			db	68h,f6h,deh,7dh,23h,79h,32h,5eh
+			db	07h,d2h,a2h,66h,1bh,ebh,8ch,27h
+			db	dfh,3ah,65h,00h,c1h,7fh,b9h,09h
+			db	00h,a3h,77h,c8h,9fh,04h,74h,01h
+			db	deh,7fh,e9h,efh,85h,05h,cah,09h
+			db	2ah,1dh,adh,61h,71h,54h,96h,f8h
+			db	06h,b9h,77h,2ch,45h,bbh,11h,fbh
+			db	31h,f6h,66h,13h,72h,d4h,74h,30h
+			db	3eh,d2h,4dh,26h,45h,cch,70h,bbh
+			db	b1h,75h,37h,c2h,39h,26h,45h,6ch
+			db	c5h,56h,05h,05h,27h,66h,35h,feh
+			db	cdh,8ch,0fh,29h,80h,05h,bdh,3ch
+			db	ech,6dh,dch,78h,75h,c5h,a0h,78h
+			db	9eh,a7h,97h,1bh,07h,30h,23h,58h
+			db	77h,69h,01h,dbh,fbh,75h,6dh,0eh
+			db	1ah,b7h,4eh,8fh,6ch,55h,2eh,cdh
+			db	b8h,0bh,b5h,34h,3bh,dbh,16h,6bh
+			db	19h,24h,68h,46h,e3h,a7h,20h,f5h
+			db	d6h,94h,3ch,a2h,a6h,ceh,9dh,c9h
+			db	68h,d3h,29h,23h,c2h,d8h,98h,6ch
+			db	0ch,b9h,8fh,47h,98h,7dh,8eh,b1h
+			db	52h,45h,fch,aeh,90h,03h,3ch,74h
+			db	3fh,55h,78h,d4h,a7h,a2h,45h,27h
+			db	c9h,98h,d8h,86h,bbh,37h,5fh,2dh
+			db	9ch,79h,4dh,89h,89h,f3h,04h,78h
+			db	97h,53h,fah,9ch,85h,04h,a8h,c0h
+			db	36h,1eh,0dh,abh,43h,41h,1ch,cbh
+			db	19h,e5h,0dh,c1h,a7h,88h,42h,72h
+			db	6bh,edh,c8h,1ah,d5h,dch,a4h,0ch
+			db	bdh,7fh,c7h,eah,60h,f9h,65h,72h
+			db	3ah,c0h,e3h,58h,e6h,27h,41h,e0h
+			db	b9h,a1h,37h,d0h,3dh,3bh,b7h,ach
+			db	3ah,c5h,7ah,46h,93h,cdh,0fh,ddh
+			db	87h,3bh,9dh,e2h,bah,39h,94h,a9h
+			db	d6h,c1h,abh,c3h,7ah,e4h,dfh,91h
+			db	7dh,67h,e9h,43h,ddh,83h,80h,7fh
+			db	92h,a5h,2ch,b0h,05h,b6h,09h,cdh
+			db	52h,2ah,6dh,afh,2bh,f9h,e6h,eeh
+			db	cdh,65h,a8h,cah,58h,f7h,33h,e9h
+			db	e1h,5ch,55h,d2h,69h,2bh,f3h,64h
+			db	bah,4dh,3dh,41h,73h,5ch,f5h,74h
+			db	10h,f1h,45h,fch,6dh,5ch,cah,51h
+			db	beh,f3h,40h,08h,d6h,e6h,20h,54h
+			db	ech,fbh,1dh,6ch,b2h,31h,74h,63h
+			db	3eh,01h,72h,bfh,8dh,f3h,0eh,0dh
+			db	3dh,d4h,6fh,20h,6fh,49h,73h,1ah
+			db	93h,8ah,1bh,c4h,06h,8bh,4ch,b4h
+			db	b1h,3eh,50h,04h,efh,5eh,1dh,04h
+			db	4dh,1dh,75h,95h,9bh,b7h,87h,86h
+			db	76h,91h,49h,8ah,0fh,63h,0ch,78h
+			db	98h,29h,0bh,cbh,16h,32h,21h,52h
+			db	43h,5ch,c0h,27h,f8h,9eh,61h,b9h
+			db	e1h,78h,b7h,8dh,e6h,04h,58h,35h
+			db	ddh,dfh,c1h,b2h,84h,b6h,eah,37h
+			db	82h,36h,eeh,37h,70h,8bh,76h,e6h
+			db	30h,38h,73h,49h,45h,dfh,56h,d5h
+			db	4fh,6ch,c1h,f3h,03h,61h,3ch,a6h
+			db	b5h,c5h,feh,84h,22h,c7h,76h,cch
+			db	59h,d4h,20h,18h,55h,a9h,efh,cfh
+			db	47h,8ah,f0h,a7h,bfh,60h,e6h,88h
+			db	39h,11h,a5h,f4h,9ch,e9h,a3h,09h
+			db	dch,07h,bch,7eh,45h,9dh,b0h,5eh
+			db	5ah,76h,4bh,5ch,0bh,a6h,29h,4ah
+			db	cfh,adh,d5h,7eh,73h,a7h,37h,29h
+			db	38h,c3h,c4h,edh,93h,51h,2ch,1eh
+			db	0fh,8eh,fah,92h,81h,27h,c6h,9eh
+			db	c4h,c8h,d9h,bdh,d7h,a2h,45h,bfh
+			db	dfh,56h,6dh,17h,0eh,63h,74h,63h
+			db	88h,b4h,e5h,26h,b8h,07h,8ah,b7h
+			db	0fh,f8h,37h,23h,10h,bfh,13h,83h
+			db	24h,05h,e8h,9eh,54h,2fh,edh,b2h
+			db	bdh,cdh,3fh,7fh,77h,3dh,a0h,e7h
+			db	a4h,14h,2eh,10h,64h,fbh,82h,9eh
+			db	72h,42h,c9h,07h,cdh,5eh,cfh,cch
+			db	6ch,c6h,19h,ech,3ch,42h,bah,b4h
+			db	eah,93h,92h,3ah,9dh,b6h,e6h,15h
+			db	dfh,c0h,ceh,f0h,f1h,4dh,a1h,a0h
+			db	91h,68h,7dh,76h,abh,52h,e1h,ceh
+			db	b4h,5eh,9ah,02h,c9h,1bh,01h,53h
+			db	44h,e2h,90h,07h,bfh,58h,ffh,8ch
+			db	d5h,62h,02h,01h,21h,78h,50h,7dh
+			db	0dh,99h,03h,dfh,4bh,d6h,d1h,8bh
+			db	a4h,56h,c9h,d6h,01h,38h,30h,fch
+			db	aeh,4ch,a4h,52h,95h,c1h,b9h,bch
+			db	96h,1fh,91h,feh,ebh,e1h,d8h,6fh
+			db	30h,40h,07h,88h,06h,a5h,c5h,32h
+			db	11h,40h,9dh,68h,6ah,6fh,c4h,56h
+			db	6dh,adh,4ch,1ah,c4h,1ch,c8h,eeh
+			db	3dh,3ch,4bh,a8h,2ah,00h,66h,4ch
+			db	71h,f1h,40h,07h,26h,41h,31h,ach
+			db	55h,d5h,82h,97h,81h,45h,fbh,68h
+			db	7dh,bah,d0h,17h,4dh,bdh,50h,d5h
+			db	dfh,51h,72h,1bh,75h,23h,ebh,9ah
+			db	82h,54h,2eh,d0h,8fh,d5h,9ch,f1h
+			db	99h,cah,35h,72h,fah,c6h,d8h,aeh
+			db	68h,37h,dfh,12h,9bh,c5h,94h,52h
+			db	8fh,c9h,54h,fch,94h,12h,b4h,49h
+			db	4dh,52h,17h,2bh,b5h,7eh,eah,2fh
+			db	33h,77h,e7h,f8h,3fh,beh,e1h,c3h
+			db	5ah,04h,46h,7dh,57h,a2h,b1h,3eh
+			db	34h,52h,49h,5fh,0ch,48h,69h,20h
+			db	bah,0dh,eah,77h,18h,12h,62h,f0h
+			db	d9h,13h,6ah,4ch,57h,08h,a2h,fbh
+			db	c9h,8ch,ach,60h,e1h,d3h,58h,e8h
+			db	e4h,97h,a8h,d2h,4ch,c3h,90h,c5h
+			db	22h,eeh,f9h,18h,8fh,4dh,a6h,38h
+			db	4dh,2fh,99h,b7h,27h,42h,b4h,e7h
+			db	f7h,24h,4dh,03h,f4h,12h,4bh,6fh
+			db	d2h,3ch,24h,69h,5fh,4bh,3bh,58h
+			db	2bh,e6h,ddh,6fh,72h,e1h,6dh,6ch
+			db	04h,1bh,09h,a2h,f0h,30h,a4h,51h
+			db	edh,35h,a8h,74h,03h,f1h,3dh,93h
+			db	88h,fdh,d6h,beh,22h,26h,edh,4fh
+			db	22h,18h,a8h,edh,4ch,8dh,d0h,b2h
+			db	a8h,e6h,d1h,dch,9eh,c5h,d4h,48h
+			db	21h,a1h,0ah,09h,90h,d0h,ddh,98h
+			db	bbh,ebh,58h,94h,7bh,a8h,98h,a3h
+			db	50h,35h,72h,b7h,70h,ech,efh,e2h
+			db	14h,e5h,dah,2ch,7dh,4bh,eah,f4h
+			db	46h,31h,07h,65h,4ah,33h,90h,d4h
+			db	3ch,2ch,dfh,37h,3dh,98h,a9h,74h
+			db	14h,86h,0eh,11h,b3h,b4h,e7h,fah
+			db	f6h,dch,e7h,5ch,b2h,47h,a0h,3ah
+			db	1dh,57h,4fh,cah,adh,0ch,cdh,c7h
+			db	a1h,f1h,f8h,07h,75h,1ah,9eh,90h
+			db	adh,adh,cbh,6ch,a9h,cah,89h,1ah
+			db	beh,f7h,ebh,59h,64h,6ah,aeh,aah
+			db	b9h,6ah,19h,19h,56h,47h,02h,77h
+			db	17h,27h,ffh,4fh,dbh,c5h,e1h,29h
+			db	cbh,5bh,42h,c9h,cah,ebh,bdh,bdh
+			db	a3h,85h,92h,71h,82h,a8h,4dh,12h
+			db	e9h,24h,92h,e3h,a2h,08h,a4h,59h
+			db	d3h,9ah,17h,16h,c0h,95h,43h,85h
+			db	abh,f8h,6fh,63h,bch,b2h,82h,7dh
+			db	04h,97h,98h,71h,3dh,52h,adh,a3h
+			db	70h,e2h,61h,43h,ech,60h,05h,adh
+			db	66h,96h,80h,57h,15h,deh,e9h,c3h
+			db	25h,efh,a8h,efh,09h,13h,b1h,a4h
+			db	7ah,ddh,3fh,d1h,4ah,c0h,67h,98h
+			db	5ch,beh,d8h,3bh,6ch,d3h,22h,a9h
+			db	b8h,cah,cdh,3eh,04h,e2h,34h,ddh
+			db	dfh,d2h,f2h,59h,b4h,d9h,93h,9ch
+			db	b5h,a1h,06h,a3h,eeh,e4h,d9h,6ah
+			db	ebh,e2h,60h,bdh,25h,96h,9bh,2ch
+			db	37h,75h,7bh,b8h,8eh,69h,d2h,cch
+			db	eeh,61h,99h,3fh,ceh,08h,6dh,41h
+			db	4dh,f9h,62h,27h,3ch,1dh,8eh,64h
+			db	75h,c2h,ebh,aeh,c0h,63h,f5h,c2h
+			db	7ch,92h,7ch,c4h,2ah,f0h,9dh,9eh
+			db	86h,17h,bah,a9h,86h,3ah,1ch,60h
+			db	3ah,6ch,eeh,dbh,aeh,3dh,37h,efh
+			db	e5h,a3h,b9h,7dh,c2h,c9h,79h,fdh
+			db	1eh,2ah,d5h,cch,49h,46h,1ch,42h
+			db	45h,07h,8fh,62h,73h,b0h,7bh,8eh
+			db	dch,15h,2ah,f7h,15h,8eh,09h,e5h
+			db	25h,3bh,cdh,e9h,98h,dah,53h,73h
+			db	41h,d1h,2ch,28h,e9h,e6h,50h,cdh
+			db	5ah,03h,cdh,56h,c3h,6bh,10h,dah
+			db	3dh,49h,fah,e9h,48h,d7h,2ch,dfh
+			db	e9h,d4h,85h,24h,28h,54h,83h,26h
+			db	94h,26h,65h,7ch,54h,60h,7eh,23h
+			db	45h,a4h,e9h,eeh,4ch,e3h,86h,adh
+			db	ceh,44h,42h,6ah,5bh,65h,a2h,dbh
+			db	0dh,1dh,73h,c4h,4fh,d9h,cch,eah
+			db	79h,d1h,61h,8ah,50h,01h,8fh,35h
+			db	77h,2dh,b5h,eah,50h,ech,8bh,adh
+			db	41h,b8h,7eh,dbh,c0h,72h,e2h,ech
+			db	68h,1fh,47h,7ch,8bh,7ah,55h,21h
+			db	a4h,61h,c3h,20h,8eh,b0h,88h,09h
+			db	40h,9ah,8eh,fdh,3dh,c3h,3ch,adh
+			db	7fh,c6h,fdh,7eh,4ch,bfh,95h,d9h
+			db	b0h,24h,23h,cbh,ach,21h,81h,b0h
+			db	17h,e0h,2ch,2bh,76h,c1h,9ch,7fh
+			db	2dh,afh,1eh,12h,ech,3fh,97h,7fh
+			db	efh,8dh,1fh,e2h,86h,b1h,bdh,14h
+			db	33h,88h,1dh,59h,f3h,bbh,56h,f0h
+			db	eah,b4h,0dh,93h,afh,e8h,4eh,16h
+			db	93h,37h,54h,aeh,46h,38h,c5h,afh
+			db	8ch,d4h,9dh,2fh,efh,e4h,39h,97h
+			db	f1h,ech,2fh,95h,e5h,b5h,1bh,7bh
+			db	1eh,f2h,aeh,c3h,43h,4ch,bdh,58h
+			db	4ch,8ah,17h,24h,9dh,a9h,51h,a1h
+			db	71h,13h,adh,e7h,eeh,51h,bdh,b2h
+			db	ach,d1h,97h,32h,2fh,05h,65h,b4h
+			db	3fh,18h,40h,d6h,fah,fah,f8h,fah
+			db	eah,37h,69h,c4h,27h,bch,11h,ddh
+			db	32h,23h,39h,d1h,e1h,fah,3fh,9dh
+			db	d3h,5eh,e5h,6fh,5ch,6dh,4ah,8ch
+			db	eeh,46h,19h,1ch,ddh,95h,40h,28h
+			db	8ah,91h,05h,3eh,89h,55h,37h,84h
+			db	2bh,02h,b8h,01h,f6h,90h,62h,61h
+			db	abh,8eh,4ah,adh,f1h,b4h,76h,edh
+			db	88h,9ah,99h,39h,d0h,50h,d1h,5bh
+			db	66h,45h,46h,adh,63h,fbh,0dh,13h
+			db	92h,10h,77h,c8h,7fh,f7h,87h,96h
+			db	48h,12h,b6h,1bh,55h,3ch,c2h,9dh
+			db	58h,d1h,09h,d9h,ffh,fch,07h,9ah
+			db	4fh,86h,a2h,09h,a8h,41h,87h,14h
+			db	d8h,7ah,72h,36h,0dh,3dh,07h,45h
+			db	60h,e6h,c6h,30h,91h,cdh,a2h,2fh
+			db	38h,68h,d4h,43h,50h,5dh,a2h,bdh
+			db	e0h,d1h,0ah,31h,12h,a0h,11h,adh
+			db	cah,09h,c9h,a6h,b4h,6dh,a0h,d9h
+			db	96h,a2h,d5h,49h,b5h,15h,85h,ddh
+			db	adh,5bh,5ah,f2h,95h,14h,58h,9fh
+			db	c8h,e2h,9bh,aeh,9ch,fah,d2h,00h
+			db	2ah,6eh,c5h,45h,aah,bdh,f5h,49h
+			db	2eh,3ah,46h,f5h,eeh,b8h,72h,73h
+			db	41h,5eh,bdh,bch,68h,36h,89h,00h
+			db	6ch,a6h,d1h,2fh,ach,2eh,1dh,1dh
+			db	84h,06h,7eh,87h,b3h,fdh,efh,4eh
+			db	62h,21h,47h,d1h,2bh,53h,10h,00h
+			db	f7h,5eh,fch,d1h,3dh,81h,fbh,e4h
+			db	04h,eah,50h,31h,7ah,03h,aeh,fdh
+			db	4fh,b4h,3ch,deh,49h,b9h,e0h,92h
+			db	17h,10h,9eh,47h,e1h,3fh,feh,94h
+			db	74h,89h,fbh,55h,4dh,cfh,a6h,d1h
+			db	cch,0bh,34h,a2h,57h,d1h,a0h,8dh
+			db	96h,07h,82h,32h,77h,44h,c8h,aeh
+			db	43h,ach,2ah,32h,41h,90h,70h,35h
+			db	a3h,8fh,0ch,abh,9fh,41h,39h,b8h
+			db	79h,61h,35h,b9h,27h,49h,29h,55h
+			db	f9h,d1h,42h,3ah,d0h,01h,76h,65h
+			db	ffh,64h,06h,67h,12h,13h,a1h,cfh
+			db	afh,56h,97h,0ch,80h,43h,a4h,9fh
+			db	ffh,0bh,d1h,efh,6bh,87h,9ah,8ah
+			db	41h,bch,0eh,29h,99h,94h,91h,7fh
+			db	d8h,7fh,6fh,b3h,0bh,0ch,93h,62h
+			db	2eh,65h,34h,67h,0fh,f3h,b2h,bdh
+			db	34h,adh,1dh,ach,c6h,fbh,1eh,ach
+			db	8ch,2ah,0bh,11h,52h,c7h,55h,30h
+			db	6fh,a9h,d1h,85h,afh,71h,42h,b8h
+			db	61h,72h,31h,f5h,f2h,aeh,e7h,75h
+			db	d1h,35h,57h,bah,2fh,d2h,6bh,36h
+			db	b1h,60h,cah,58h,18h,1ah,e7h,ebh
+			db	14h,3dh,dah,03h,31h,2dh,93h,1dh
+			db	76h,c5h,8dh,40h,cfh,0ch,7fh,58h
+			db	a7h,28h,2fh,4bh,a5h,6bh,32h,c9h
+			db	27h,c3h,0eh,cdh,85h,37h,b6h,1dh
+			db	83h,9ah,97h,3fh,28h,a3h,80h,ech
+			db	33h,7eh,b4h,f0h,dfh,aah,b0h,79h
+			db	1fh,11h,05h,57h,56h,a6h,adh,7ah
+			db	5ah,e5h,beh,33h,55h,02h,8eh,f8h
+			db	26h,bbh,c7h,05h,b0h,83h,e6h,e2h
+			db	03h,53h,6ch,e0h,abh,f9h,bfh,aah
+			db	3dh,58h,73h,a9h,a5h,99h,fah,76h
+			db	3eh,e6h,cfh,d9h,03h,e1h,a7h,11h
+			db	5ah,5ch,9ch,e7h,87h,b7h,b2h,6fh
+			db	d8h,d0h,bfh,14h,c1h,a0h,75h,4eh
+			db	91h,bah,4bh,e2h,d6h,23h,4fh,f8h
+			db	1ah,11h,edh,18h,7bh,65h,a2h,37h
+			db	bdh,05h,74h,a2h,75h,fbh,b8h,3eh
+			db	b4h,cch,42h,46h,bah,55h,bdh,00h
+			db	adh,5eh,b5h,8fh,ceh,0eh,94h,5bh
+			db	94h,c4h,61h,05h,a4h,11h,77h,30h
+			db	c1h,7ah,ffh,2ah,c4h,9ah,6eh,cah
+			db	75h,0eh,5fh,4dh,48h,6fh,02h,ach
+			db	2bh,b1h,38h,53h,51h,16h,ffh,41h
+			db	41h,a3h,26h,97h,09h,d3h,05h,e6h
+			db	7ch,37h,77h,fah,92h,ach,f1h,abh
+			db	94h,e4h,e9h,96h,5bh,71h,fch,70h
+			db	04h,96h,c5h,70h,87h,00h,24h,e6h
+			db	04h,d0h,d5h,2dh,d0h,f9h,95h,deh
+			db	beh,0ch,b7h,afh,4ah,f6h,39h,c8h
+			db	40h,dfh,ceh,a0h,3eh,c6h,c0h,6ch
+			db	f1h,0ch,e8h,09h,0dh,e2h,64h,92h
+			db	f7h,08h,b9h,9dh,83h,2bh,88h,a3h
+			db	13h,24h,b8h,3bh,63h,ech,9bh,34h
+			db	08h,79h,10h,18h,70h,70h,7dh,c9h
+			db	84h,d5h,fdh,ebh,ddh,85h,0eh,f0h
+			db	76h,7ah,23h,d5h,d2h,d4h,eeh,85h
+			db	b7h,d8h,45h,e2h,38h,3dh,ach,bah
+			db	beh,97h,2eh,67h,41h,2ch,16h,f6h
+			db	26h,f5h,fah,e2h,30h,f7h,e6h,d4h
+			db	1bh,d5h,18h,33h,c3h,0dh,8ah,70h
+			db	9bh,84h,57h,89h,5dh,46h,22h,b9h
+			db	0dh,87h,09h,60h,4eh,bfh,e4h,92h
+			db	47h,22h,e8h,f5h,14h,3bh,48h,6bh
+			db	e4h,9fh,27h,87h,48h,62h,a2h,3bh
+			db	5dh,79h,00h,3ah,cbh,50h,fch,65h
+			db	bah,cdh,13h,7dh,cfh,39h,c6h,78h
+			db	c2h,02h,d0h,68h,83h,38h,29h,84h
+			db	f8h,4dh,69h,68h,d9h,56h,5ch,f4h
+			db	a9h,8bh,3bh,6eh,d9h,9eh,beh,49h
+			db	b3h,c0h,84h,56h,4bh,d7h,dah,78h
+			db	52h,8bh,beh,bbh,45h,64h,e6h,c8h
+			db	0eh,9fh,55h,b3h,62h,35h,77h,f8h
+			db	13h,3fh,4ah,bdh,15h,f6h,78h,1ch
+			db	f9h,dfh,e1h,07h,17h,d6h,0ah,62h
+			db	92h,a5h,8eh,1bh,b2h,21h,5eh,dbh
+			db	68h,dch,22h,80h,b8h,97h,bfh,feh
+			db	8ah,30h,84h,e2h,e4h,4dh,cch,97h
+			db	75h,a4h,6eh,d8h,aeh,3ah,b7h,9eh
+			db	70h,1fh,aah,05h,f7h,07h,93h,41h
+			db	d5h,bah,7fh,efh,2ch,11h,98h,59h
+			db	e4h,44h,ddh,dch,a8h,73h,51h,f9h
+			db	e2h,ebh,5ch,57h,2ch,07h,7ch,9fh
+			db	c7h,b4h,a1h,80h,d1h,3eh,17h,d1h
+			db	a8h,03h,bah,11h,74h,d0h,b8h,dfh
+			db	21h,23h,4ch,3fh,24h,0dh,19h,1ch
+			db	bah,77h,d4h,cdh,e8h,25h,7ah,ebh
+			db	e8h,2ch,8eh,96h,2ch,53h,2bh,45h
+			db	29h,53h,44h,91h,47h,9fh,8bh,2ah
+			db	eeh,00h,a7h,d4h,b7h,35h,17h,afh
+			db	41h,2ah,bdh,9fh,88h,77h,cfh,2dh
+			db	9eh,8fh,1dh,75h,2fh,f6h,1dh,ffh
+			db	02h,dfh,3ah,3dh,5ch,aah,46h,b3h
+			db	d1h,feh,6dh,53h,86h,e3h,eeh,b1h
+			db	45h,04h,95h,30h,4eh,adh,beh,c5h
+			db	bdh,f1h,9ch,1ah,06h,9bh,20h,83h
+			db	22h,92h,28h,69h,aah,2ch,d0h,d2h
+			db	ach,70h,c6h,f7h,52h,99h,67h,31h
+			db	c6h,a1h,06h,d9h,f8h,01h,07h,76h
+			db	b1h,f8h,feh,d8h,b9h,f5h,b8h,a3h
+			db	7ah,51h,a8h,77h,a2h,27h,48h,53h
+			db	57h,44h,61h,a1h,2bh,a1h,c0h,e9h
+			db	f4h,feh,52h,57h,91h,c9h,2ch,0bh
+			db	11h,4eh,6bh,a3h,dfh,fdh,32h,cbh
+			db	34h,d8h,f5h,6dh,54h,dfh,2ch,43h
+			db	d5h,3ah,6fh,d1h,26h,5eh,8dh,e0h
+			db	d0h,21h,55h,6ah,e9h,0dh,e5h,17h
+			db	f7h,48h,4dh,aah,d3h,03h,a1h,6bh
+			db	a8h,38h,63h,bdh,cbh,b3h,a7h,d3h
+			db	0dh,1dh,f8h,c9h,dbh,29h,d9h,6ch
+			db	92h,94h,91h,2fh,f6h,ech,fbh,e1h
+			db	70h,86h,8dh,78h,3fh,9ah,7bh,d1h
+			db	49h,46h,57h,c0h,85h,80h,fdh,0dh
+			db	77h,afh,81h,82h,44h,5eh,f7h,bch
+			db	37h,39h,e6h,feh,34h,37h,5eh,adh
+			db	deh,1eh,8eh,bah,43h,a4h,90h,95h
+			db	1fh,13h,6ch,89h,15h,06h,92h,3ch
+			db	a8h,d6h,2ah,e9h,3ah,30h,9ch,5eh
+			db	69h,bah,8ah,f2h,61h,63h,60h,a1h
+			db	abh,80h,f4h,dah,ddh,3fh,4dh,f5h
+			db	64h,95h,57h,c3h,57h,c3h,00h,b8h
+			db	c4h,1bh,3eh,5fh,b2h,48h,fdh,adh
+			db	73h,ech,7eh,2ch,4ch,7bh,0ch,9ah
+			db	a8h,94h,62h,ach,88h,79h,c1h,1fh
+			db	dfh,01h,c3h,09h,27h,f8h,77h,e9h
+			db	42h,53h,6ch,3ch,84h,33h,dbh,2eh
+			db	55h,17h,93h,0ah,5ch,8ah,4ch,4bh
+			db	6dh,5eh,70h,66h,0ah,bah,bah,8eh
+			db	14h,deh,48h,4dh,86h,74h,77h,1eh
+			db	d2h,17h,6ch,f1h,3eh,adh,0dh,5ah
+			db	e6h,73h,3ah,10h,5bh,b7h,f5h,33h
+			db	adh,63h,5fh,dfh,2ah,4dh,77h,95h
+			db	27h,f6h,22h,3eh,54h,31h,9eh,a7h
+			db	7ch,fch,66h,41h,5dh,6fh,edh,d9h
+			db	f5h,54h,35h,68h,50h,33h,43h,83h
+			db	17h,75h,63h,dah,56h,2dh,87h,ffh
+			db	bah,32h,07h,74h,01h,9fh,69h,39h
+			db	9dh,e0h,fah,e3h,9bh,f3h,6dh,32h
+			db	bbh,92h,82h,adh,c4h,f6h,69h,afh
+			db	9bh,3ch,2ah,dah,a9h,adh,6bh,3ch
+			db	17h,6ch,89h,c9h,89h,15h,e3h,67h
+			db	adh,1dh,29h,31h,d4h,5bh,7ah,a6h
+			db	21h,1bh,aah,eeh,34h,0dh,ech,08h
+			db	05h,b8h,a9h,a2h,7fh,a3h,31h,64h
+			db	e5h,b7h,9dh,d0h,0bh,85h,e7h,ebh
+			db	d2h,beh,63h,9ch,9ch,3fh,52h,06h
+			db	a4h,57h,74h,9ah,64h,3ch,4dh,d1h
+			db	76h,18h,67h,40h,5dh,35h,1bh,d1h
+			db	b5h,f9h,87h,e7h,deh,3eh,a1h,39h
+			db	bch,7bh,75h,49h,69h,41h,9bh,33h
+			db	86h,dah,7ah,8dh,d6h,29h,4eh,a5h
+			db	30h,22h,fbh,41h,1bh,feh,4eh,c0h
+			db	72h,3ah,8fh,0dh,8ah,17h,c4h,3dh
+			db	69h,5eh,f6h,73h,1eh,ebh,f2h,0ah
+			db	c9h,12h,00h,39h,54h,00h,aeh,2ah
+			db	9ah,24h,67h,08h,75h,38h,02h,76h
+			db	0dh,41h,c5h,3dh,28h,01h,b2h,11h
+			db	55h,88h,3eh,c9h,80h,75h,33h,fah
+			db	22h,92h,1dh,2bh,d2h,c4h,efh,08h
+			db	b1h,fch,c5h,bch,eah,d7h,7dh,75h
+			db	98h,84h,eah,a0h,f7h,33h,44h,bfh
+			db	29h,48h,c2h,97h,abh,adh,c6h,cbh
+			db	88h,57h,beh,53h,b2h,fch,5fh,14h
+			db	dch,e1h,51h,34h,57h,61h,24h,c1h
+			db	cfh,f4h,84h,a9h,5eh,29h,5fh,1bh
+			db	4eh,c4h,aeh,d1h,bdh,93h,f2h,6eh
+			db	19h,41h,1bh,b7h,4eh,55h,efh,57h
+			db	4ah,29h,e3h,87h,fch,6fh,85h,5fh
+			db	ach,b7h,78h,48h,f2h,34h,96h,2eh
+			db	03h,0ch,97h,3eh,53h,9fh,63h,78h
+			db	b2h,b5h,09h,02h,afh,05h,18h,b5h
+			db	8bh,1bh,c4h,dah,e3h,53h,8bh,5ch
+			db	72h,53h,64h,56h,09h,23h,f2h,4fh
+			db	fbh,32h,93h,ddh,61h,6ch,10h,41h
+			db	97h,59h,5dh,7dh,1dh,e0h,afh,9dh
+			db	3fh,54h,4ah,18h,d3h,8dh,2ah,79h
+			db	b9h,30h,efh,bch,49h,09h,21h,38h
+			db	4dh,1dh,51h,b4h,f4h,adh,fah,35h
+			db	8bh,d7h,8eh,25h,58h,94h,edh,fch
+			db	4bh,c6h,9dh,91h,fah,ddh,04h,41h
+			db	49h,8fh,11h,6fh,69h,2bh,4ch,1bh
+			db	7bh,c4h,60h,7ah,53h,74h,c0h,aah
+			db	9eh,2fh,a3h,efh,f3h,92h,65h,26h
+			db	2ah,26h,83h,1fh,60h,eeh,bdh,7ch
+			db	29h,8dh,b3h,a5h,e5h,47h,aeh,8ch
+			db	94h,56h,64h,b1h,9ah,d9h,65h,6ch
+			db	5eh,80h,29h,10h,e1h,60h,6bh,05h
+			db	71h,47h,9fh,94h,45h,6eh,b4h,0fh
+			db	feh,62h,3ah,76h,66h,10h,56h,70h
+			db	ebh,cfh,b2h,27h,77h,33h,9ch,00h
+			db	abh,e0h,b5h,81h,9bh,b8h,14h,64h
+			db	c2h,48h,eeh,39h,c2h,82h,6bh,81h
+			db	19h,90h,1ch,6bh,b3h,8dh,cch,52h
+			db	23h,0ch,3ah,2fh,d1h,02h,b8h,18h
+			db	5fh,18h,4ah,cfh,dbh,23h,61h,e9h
+			db	16h,a1h,05h,79h,e8h,61h,47h,4eh
+			db	34h,28h,9ch,8fh,8ch,b5h,16h,f0h
+			db	c2h,f4h,86h,15h,bfh,6ch,63h,cch
+			db	ach,afh,02h,21h,48h,f8h,95h,a0h
+			db	e4h,00h,83h,9fh,59h,73h,0dh,b2h
+			db	9bh,7ah,deh,bfh,89h,fdh,58h,33h
+			db	45h,d7h,ffh,8eh,1ch,fah,56h,45h
+			db	9fh,dch,83h,18h,18h,49h,d9h,68h
+			db	0ch,20h,55h,7ah,71h,3ch,59h,bch
+			db	3ch,ceh,bbh,deh,55h,e6h,b3h,66h
+			db	0fh,b6h,ach,1fh,0ch,61h,afh,01h
+			db	1ah,84h,6ah,86h,6eh,19h,b0h,82h
+			db	99h,efh,03h,80h,a8h,30h,55h,ddh
+			db	c5h,65h,81h,eeh,b0h,00h,17h,06h
+			db	6ah,dfh,cah,0eh,4ch,02h,54h,24h
+			db	95h,b4h,cdh,a2h,a2h,edh,efh,37h
+			db	e1h,7dh,a3h,f0h,e1h,5fh,feh,24h
+			db	6fh,93h,a4h,1eh,e1h,a5h,5dh,6dh
+			db	81h,d8h,bfh,d4h,beh,72h,57h,76h
+			db	bah,18h,0bh,37h,1ah,61h,8eh,c2h
+			db	51h,d7h,a9h,5ch,d2h,04h,35h,97h
+			db	d1h,68h,84h,e6h,98h,ddh,ech,90h
+			db	b8h,d7h,e3h,35h,cch,f1h,deh,4ch
+			db	dch,08h,79h,d8h,b1h,a4h,31h,d1h
+			db	cfh,64h,9fh,ffh,22h,21h,deh,86h
+			db	6bh,efh,3bh,a3h,9dh,a5h,c6h,cch
+			db	62h,adh,f7h,9dh,63h,74h,d4h,2ah
+			db	4ah,cah,6bh,d5h,9bh,c2h,71h,80h
+			db	42h,4eh,33h,cah,d3h,fah,44h,19h
+			db	84h,45h,eeh,c4h,2ch,cdh,a3h,aeh
+			db	c4h,56h,85h,12h,6fh,52h,71h,14h
+			db	d8h,32h,1eh,afh,a7h,cbh,37h,0ah
+			db	e5h,8dh,46h,23h,23h,c6h,47h,2ah
+			db	dah,9ch,0bh,29h,d5h,d4h,dch,91h
+			db	68h,0fh,6bh,00h,9eh,08h,2bh,18h
+			db	b0h,46h,d1h,60h,5eh,1dh,32h,f4h
+			db	08h,e5h,5fh,3ch,68h,65h,aeh,14h
+			db	b1h,37h,7ah,14h,8fh,92h,f9h,b5h
+			db	00h,b0h,04h,b5h,2ah,1dh,ach,cch
+			db	2bh,d5h,eeh,6ah,29h,8dh,3bh,9eh
+			db	bch,6ah,cdh,62h,35h,c5h,e2h,41h
+			db	90h,cbh,bch,79h,a8h,deh,adh,71h
+			db	b1h,41h,75h,ddh,7fh,70h,50h,38h
+			db	f9h,d9h,05h,b3h,39h,97h,3bh,c9h
+			db	6bh,4ah,e9h,05h,bah,a8h,1ah,84h
+			db	2dh,ddh,dbh,24h,3ch,2eh,4ah,53h
+			db	1ch,13h,a4h,84h,85h,e0h,a0h,f7h
+			db	b6h,05h,d6h,56h,76h,46h,9bh,a4h
+			db	84h,cch,19h,36h,edh,14h,9dh,91h
+			db	ffh,14h,51h,bah,77h,9ch,75h,b3h
+			db	aeh,16h,84h,3bh,81h,20h,ebh,7dh
+			db	f3h,9ah,50h,beh,19h,70h,a1h,90h
+			db	05h,a0h,80h,56h,3fh,e7h,7ah,abh
+			db	d3h,34h,b9h,2dh,0fh,77h,a1h,99h
+			db	16h,b0h,cfh,f4h,3bh,bfh,d9h,0eh
+			db	b8h,3ch,78h,5bh,7dh,9bh,cah,36h
+			db	b2h,8ch,45h,e8h,8ah,6bh,b6h,70h
+			db	beh,67h,79h,62h,ceh,6dh,c2h,e0h
+			db	34h,75h
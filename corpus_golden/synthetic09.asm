@@ -0,0 +1,19362 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	9ah,e1h,32h,dfh,0ah,8eh,d4h,d5h
+			db	a9h,5eh,78h,d7h
+
+start:						; execution starting point
+			ld	c,(hl)
+			ld	l,b
+			and	b
+			sub	a
+			xor	a
+			add	a,l
+			sbc	a,l
+			set	0,h
+			res	0,e
+			jp	p,L7d07
+			sub	c
+			ex	af,af'
+			add	a,(hl)
+			pop	bc
+			pop	de
+			ld	l,ceh
+			ld	a,e
+			ld	e,d
+			and	h
+			ld	a,(f2beh)
+			sub	d
+			and	(hl)
+			ld	a,e
+			jp	p,Leab6
+			or	e
+			ccf
+			rst	38h
+			or	c
+			add	a,l
+			ld	a,e
+			add	hl,hl
+			pop	hl
+			ret	p
+			and	a
+			call	pe,L0e1f
+			ld	h,51h
+			ld	a,39h
+			nop (2x) *
+			ld	c,c
+			call	c,Le4f1
+			inc	sp
+			ld	l,c
+			add	a,l
+			ld	e,l
+			jr	z,L3ff0
+			dec	a
+			ld	bc,b39eh
+			ld	e,h
+			nop
+			call	p,L8824
+			add	a,a
+			dec	(hl)
+			ld	d,l
+			ld	l,(hl)
+			ld	c,(hl)
+			ret	p
+			ld	a,(bc)
+			call	nc,L3e1d
+			inc	b
+			jr	L40d4
+			db	98h,deh,5fh,0fh,d2h,b8h,0eh,6bh
+			db	76h,aah,fch,78h,10h,cdh,80h,a7h
+			db	7dh,24h,5bh,e2h,1dh,deh,0ah,00h
+			db	ebh
+			add	a,e
+			cp	b
+			ld	(hl),bfh
+			or	(hl)
+			or	c
+			adc	a,h
+			dec	e
+			sub	h
+			call	m,L92bf
+			adc	a,b
+			jp	po,L4d92
+			adc	a,a0h
+			or	a
+			adc	a,l
+			jp	z,L9c17
+			ld	sp,3984h
+			call	pe,L9fdb
+			sub	c
+			sub	(hl)
+			ld	h,c
+			adc	a,h
+			ex	af,af'
+			call	c,L5ce5
+			ld	e,c5h
+			add	hl,hl
+			call	c,L7105
+			ld	hl,(e9afh)
+			adc	a,h
+			sbc	a,l
+			xor	45h
+			jp	p,Lfb64
+			ld	a,h
+			ld	d,e
+			dec	c
+			xor	d
+			call	c,L923f
+			ex	de,hl
+			djnz	L410e
+			add	hl,de
+			adc	a,a
+			ld	b,8eh
+			add	a,c
+			inc	(hl)
+			adc	a,e
+			sbc	a,b
+			ld	l,d
+			xor	(hl)
+			ld	a,77h
+			dec	d
+			ld	bc,b5aeh
+			add	a,c
+			cp	l
+			dec	bc
+			rrca
+			rst	38h
+			ld	l,a
+			rst	28h
+			ld	e,(hl)
+			ld	hl,(47a9h)
+			ld	c,h
+			ld	de,b4c3h
+			add	a,c
+			dec	d
+			nop (2x) *
+			ld	c,b
+			call	m,L34fb
+			add	a,(hl)
+			ld	d,dfh
+			ld	(hl),d
+			ld	(hl),b
+			cp	e
+			and	52h
+			ld	e,b
+			jp	pe,Lde10
+			add	a,d
+			or	(hl)
+			cpl
+			sub	c
+			ld	c,l
+			ret	z
+			ld	c,66h
+			sbc	a,b
+			xor	d
+			out	(fdh),a
+			and	d
+			nop (2x) *
+			jp	nc,L3639
+			pop	hl
+			ret	nc
+			call	po,Lff67
+			pop	de
+			xor	4ah
+			ld	a,95h
+			ld	h,h
+			sbc	a,c
+			ld	h,b
+			jp	z,L203d
+			ld	l,a
+			ld	sp,c3fbh
+			inc	sp
+			inc	l
+			ld	b,b
+			sub	91h
+			dec	b
+			ld	sp,564eh
+			ld	a,(de)
+			ld	h,c
+			ld	c,d
+			jp	L8e88
+			db	12h,bfh,53h,19h,05h,a9h,21h,21h
+			db	77h,adh,cfh,bbh,8fh,9fh,beh,52h
+			db	6dh,fah,59h,e2h,b4h,74h,abh,b5h
+			db	cbh,75h,e8h,34h,d3h,18h,9ch,1ch
+			db	a4h,3dh,86h,1ah,e1h,a9h,44h,adh
+			db	11h,eah,2ah,60h,31h,32h,cfh,8dh
+			db	25h,32h,ebh,73h,0eh,a4h,e9h,9fh
+			db	0eh,55h,95h,7bh,69h,9eh,5ch,0fh
+			db	97h,61h,44h,e6h,fbh,d2h,bbh,6dh
+			db	9eh,7dh,17h,ach,aah,2ah,a1h,b6h
+			db	a8h,3ch,71h,a6h,62h,42h,5ah,ffh
+			db	8dh,15h,32h,5ch,a3h
+			exx
+			jp	(hl)
+			db	35h,11h,55h,a8h,84h,ach,0eh,f7h
+			db	bdh,c7h,65h
+			ld	d,c
+			and	l
+			ld	a,l
+			in	a,(d7h)
+			adc	a,c3h
+			ret	pe
+			ld	hl,457dh
+			ld	h,(hl)
+			ld	a,4eh
+			ret
+			db	40h,03h,4ch,c4h,18h,a1h,ech,f3h
+			db	cah,4bh,54h,8bh,ach,cdh,64h,c7h
+			db	efh,15h,66h,55h,c4h,bbh,61h,12h
+			db	09h,b2h,beh,54h,7ch,3bh,f0h,70h
+			db	9fh,07h,feh,ceh,c8h
+			ret	nc
+			call	p,Le507
+			add	a,l
+			inc	b
+			ld	l,c
+			adc	a,l
+			cp	(iy + c6h)
+			rla
+			xor	c
+			cp	c
+			inc	de
+			xor	35h
+			dec	bc
+			ld	e,e
+			ld	b,(hl)
+			push	bc
+			sbc	a,d
+			cp	e
+			ld	hl,(cfd7h)
+			jr	c,L41c0
+			ld	e,b
+			or	h
+			ld	e,l
+			add	hl,bc
+			ld	hl,2a00h
+			inc	(hl)
+			ld	c,d
+			pop	af
+			call	pe,Ld3c8
+			res	2,l
+			dec	(hl)
+			ex	(sp),hl
+			dec	bc
+			rst	30h
+			inc	l
+			jp	c,Ldbaa
+			xor	47h
+			ld	c,a
+			or	d
+			jr	z,L4270
+			ld	b,c
+			ld	(hl),b
+			rst	28h
+			add	a,b
+			ld	h,h
+			sbc	a,b
+			ld	(bc),a
+			ld	b,h
+			and	h
+			ei
+			call	z,L121a
+			ld	(hl),h
+			inc	de
+			or	(hl)
+			ld	b,(hl)
+			ld	h,19h
+			pop	af
+			ld	(hl),e
+			ccf
+			jp	Laa16
+			db	bah,5eh,4ch,d8h,a3h
+			or	b
+			push	af
+			and	a
+			ld	c,l
+			add	hl,de
+			ld	b,a
+			inc	h
+			add	a,d
+			add	a,h
+			jr	nz,L41d2
+			ld	c,b
+			ld	l,25h
+			sub	a
+			rrc	(hl)
+			ld	sp,hl
+			ld	b,e
+			xor	l
+			ld	(hl),l
+			ld	hl,(3db0h)
+			and	l
+			call	po,Lf165
+			ex	de,hl
+			and	c
+			ld	b,h
+			ld	a,d
+			sub	(hl)
+			res	0,b
+			dec	b
+			ld	c,c
+			jp	L7440
+			db	e2h,81h
+			ld	h,(hl)
+			dec	b
+			ld	a,(hl)
+			sub	c
+			sbc	a,c
+			inc	l
+			ld	e,a
+			rst	20h
+			add	hl,de
+			ld	d,h
+			xor	c
+			sbc	a,e
+			ret	z
+			adc	a,(hl)
+			inc	c
+			djnz	L421f
+			ld	d,e
+			ret	pe
+			ld	(0ac5h),a
+			adc	a,h
+			xor	c
+			cp	(hl)
+			and	c
+			nop (2x) *
+			ld	a,a
+			inc	sp
+			ld	(bc),a
+			halt
+			or	b
+			ld	b,c
+			inc	l
+			sbc	a,(hl)
+			ld	e,ffh
+			ld	d,l
+			ld	h,bah
+			pop	hl
+			ld	h,a
+			ld	(de),a
+			ld	b,(hl)
+			cp	d
+			sbc	a,c
+			nop (2x) *
+			sub	b
+			sub	h
+			ld	(hl),9dh
+			xor	05h
+			call	Ldaff
+			rst	10h
+			ld	d,d
+			inc	sp
+			ld	de,670fh
+			ld	e,l
+			rst	28h
+			ld	sp,hl
+			scf
+			rst	20h
+			ret	m
+			ld	a,h
+			sbc	a,e
+			halt
+			adc	a,l
+			pop	de
+			daa
+			jr	nc,L4217
+			ld	(hl),d
+			ld	a,(d15eh)
+			ld	b,25h
+			ld	b,c
+			dec	h
+			add	a,40h
+			ld	b,(hl)
+			rrca
+			or	c
+			jp	nz,Lafe0
+			cp	d
+			ld	c,a
+			dec	(hl)
+			sbc	a,c
+			ld	hl,3513h
+			ld	c,l
+			ret	nc
+			dec	hl
+			and	l
+			ld	c,c
+			ld	h,c
+			jp	(hl)
+			db	21h,36h,74h,7fh,31h,70h,5fh,f7h
+			db	44h,b2h,42h,4ch,52h,cbh,eah,18h
+			db	7eh,eeh,c5h,36h,06h,edh,c7h,c6h
+			db	efh,59h,14h,75h,10h
+			ld	h,a
+			ret	p
+			jp	po,L38dc
+			add	a,cah
+			ret	z
+			inc	h
+			ld	b,b
+			ld	h,(hl)
+			ld	e,d
+			pop	bc
+			ld	a,h
+			ld	c,a
+			or	b
+			cp	h
+			ex	af,af'
+			push	af
+			jp	L87f8
+			db	fdh,08h,43h,9eh,5fh,b6h,67h,64h
+			db	3ah,f8h,15h,6dh,31h,34h,5ah,9fh
+			db	c5h,bdh,b3h,6dh,5ch,ebh,b2h,86h
+			db	d1h,91h,00h,afh,cfh,0fh,76h,bdh
+			db	a6h,fch,64h,0dh,ddh,dah,e6h,4bh
+			db	62h,a9h,dbh,d5h,f5h,a1h,5bh,98h
+			db	66h,a4h,a3h,9dh,6bh,fah,b7h,99h
+			db	aah,dfh,41h,b0h,1ch,8dh,e3h,ffh
+			db	67h,6dh,2bh,58h,1eh,2ch,58h,64h
+			db	9dh,a4h,39h,5fh,6eh,18h,19h,2fh
+			db	f2h,e0h,d5h,a6h,adh,14h,64h,77h
+			db	c1h,52h,f6h,d3h,14h,6bh,cfh,2ch
+			db	10h,b8h,c0h,44h,9eh,beh,71h,9fh
+			db	12h,bfh,11h,dch,7ah,88h,eah,28h
+			db	6fh,4ch,09h,00h,b2h,53h,29h,d3h
+			db	a7h,f7h,81h,46h,3ch,e3h,99h,74h
+			db	0eh,ech,10h,84h,cfh,a5h,72h,4fh
+			db	3fh,f4h,beh,74h,26h,77h,78h,d9h
+			db	9ch,e3h,4fh,34h,51h,81h,1dh,60h
+			db	c1h,9eh,a2h,f6h,1eh,9dh,3eh,5eh
+			db	8eh,26h,a4h,1ch,8eh,21h,6fh,41h
+			db	7ah,f8h,dah,f2h,89h
+			add	a,c
+			add	a,l
+			cp	c
+			ld	l,b
+			ld	d,c
+			rst	08h
+			sub	l
+			call	nz,Lec7e
+			inc	de
+			ld	a,d
+			ld	a,(bc)
+			add	a,b
+			sbc	a,l
+			jr	nc,L43c0
+			ld	e,53h
+			adc	a,e
+			ld	d,(hl)
+			add	hl,hl
+			adc	a,a
+			dec	sp
+			and	e
+			cp	(hl)
+			ld	b,c
+			res	6,l
+			ld	l,e
+			exx
+			ld	c,c
+			ld	h,c
+			sbc	a,(hl)
+			xor	(hl)
+			jp	nc,Lc5f5
+			ld	(hl),e
+			ld	e,e
+			cp	4ch
+			or	e
+			ld	hl,fe14h
+			sbc	a,h
+			cp	d8h
+			ld	hl,(32c3h)
+			xor	bfh
+			inc	h
+			jp	m,L0b56
+			ld	a,(de)
+			ld	c,a
+			ld	b,h
+			ld	h,c
+			ld	l,h
+			ei
+			ld	e,c
+			xor	ddh
+			ld	a,c
+			ex	(sp),hl
+			ld	e,d
+			ld	b,b
+			rst	08h
+			adc	a,c
+			jr	nc,L43af
+			ld	a,l
+			ld	d,a
+			jp	m,L12b3
+			ld	b,e
+			rst	08h
+			dec	sp
+			ld	c,b
+			ld	(bc),a
+			ld	e,(hl)
+			sub	c
+			cp	c
+			sbc	a,l
+			ret	p
+			djnz	L43a2
+			ld	(7179h),hl
+			ld	c,afh
+			jp	po,L9632
+			ld	h,h
+			dec	a
+			ld	e,b
+			halt
+			add	a,e
+			ld	d,(hl)
+			sub	8eh
+			ret	po
+			ld	h,09h
+			ld	e,(iy + f9h)
+			ccf
+			push	de
+			ld	e,a
+			ld	(hl),b
+			pop	bc
+			xor	b
+			ret	c
+			ld	(b943h),hl
+			ret	p
+			add	a,h
+			and	(hl)
+			halt
+			inc	c
+			di
+			ld	h,39h
+			ld	a,(c5f7h)
+			add	hl,sp
+			rst	08h
+			ld	a,h
+			ld	a,c
+			push	bc
+			exx
+			inc	b
+			inc	bc
+			xor	c
+			sub	h
+			ld	d,b
+			ld	e,b
+			jp	z,Lc0fd
+			rst	38h
+			sub	31h
+			rst	28h
+			xor	l
+			rst	28h
+			add	a,(hl)
+			ld	b,(hl)
+			pop	bc
+			add	a,(hl)
+			jp	(hl)
+			db	f1h,35h,49h,fch,3ah,91h,88h,a8h
+			db	d2h,d2h,2fh,b8h,15h,fah,83h,11h
+			db	e7h,79h,b6h,5eh,69h,ffh,f0h,f4h
+			db	69h,f8h,32h,90h,7dh,2eh,f0h,11h
+			db	f2h,2ah,4dh,a3h,deh,ebh,f7h,86h
+			db	fbh,78h,cah,b5h,4fh,c8h,f6h,6ch
+			db	5ah,78h,26h,62h,80h,f6h,6bh,a1h
+			db	55h,76h,c3h,fdh,96h,0fh,f1h,41h
+			db	30h,59h,e9h,16h,73h,6ch,dch,fah
+			db	37h,bah,2ah,7ch,8dh,e2h
+			rst	18h
+			or	58h
+			inc	b
+			ld	(9552h),a
+			sbc	a,l
+			ld	e,a
+			rst	08h
+			inc	(hl)
+			jp	L33f1
+			db	fch,f0h,e3h,bah,79h,a3h,b6h,71h
+			jr	L447b
+			db	bdh,79h,0dh,2fh,2dh,57h,ebh,adh
+			db	79h,56h,45h,45h,a4h,bah,9dh,bch
+			db	7eh,87h,f5h,30h,95h,a8h,64h,87h
+			db	a1h,3dh,59h,d5h
+			ld	h,b
+			and	l
+			nop (2x) *
+			jr	z,L4485
+			ret	m
+			ld	a,(de)
+			add	a,10h
+			ld	(3ebbh),a
+			ret	z
+			ld	b,h
+			cp	a1h
+			xor	a
+			ld	(hl),a
+			dec	e
+			ex	de,hl
+			add	hl,bc
+			ld	d,b
+			cp	(hl)
+			ld	(e6abh),a
+			dec	c
+			xor	e
+			jr	L44b4
+			db	20h,b7h,31h,97h,22h,d4h
+			sub	l
+			add	a,(hl)
+			adc	a,7eh
+			rst	38h
+			add	hl,bc
+			ld	l,d
+			ld	d,c
+			inc	l
+			ld	a,(fb11h)
+			add	a,l
+			inc	bc
+			ld	h,(hl)
+			ld	bc,9b9ah
+			sub	4bh
+			and	a
+			sbc	a,a
+			sbc	a,a
+			sbc	a,a
+			ccf
+			ld	c,h
+			ld	b,h
+			inc	l
+			sbc	a,a
+			push	bc
+			sub	a
+			xor	cdh
+			sub	l
+			ld	l,05h
+			and	d
+			call	po,L0824
+			dec	l
+			dec	de
+			xor	(hl)
+			sbc	a,(hl)
+			ld	a,e
+			sbc	a,c
+			pop	hl
+			ld	l,d
+			rra
+			scf
+			ld	(hl),20h
+			ld	a,(de)
+			and	a1h
+			ret	c
+			ld	a,(7044h)
+			dec	bc
+			ld	h,(hl)
+			ld	c,l
+			ld	a,83h
+			and	e
+			sub	(hl)
+			sub	l
+			sub	d
+			rst	10h
+			ld	l,d
+			dec	bc
+			ld	c,51h
+			nop (2x) *
+			halt
+			call	L6567
+			jr	nz,L44d8
+			nop (2x) *
+			adc	a,l
+			ld	a,(hl)
+			or	b
+			ld	h,l
+			add	a,d
+			add	hl,hl
+			rla
+			dec	b
+			ld	d,c
+			jp	po,Lf49b
+			ld	(hl),a
+			ld	d,e
+			xor	l
+			jp	(hl)
+			db	c1h,95h,eah,f3h,35h,b6h,09h,f2h
+			db	cch,b2h,0ah,01h,85h,e8h,85h,5fh
+			db	1fh,ffh,97h,42h,b2h,29h,39h,8bh
+			db	6eh,d0h,88h,77h,70h,7ch,e3h,28h
+			db	93h,7dh,94h,bah,a2h,46h,4ch,f2h
+			db	0fh,2ah,f5h,b0h,0fh,8fh,a5h,a0h
+			db	5dh,82h
+			ld	a,h
+			ld	h,(hl)
+			sbc	a,e6h
+			rst	28h
+			adc	a,e
+			or	l
+			ld	h,a
+			ld	a,d
+			add	a,c
+			ld	l,l
+			ld	(hl),h
+			ld	(82feh),a
+			xor	h
+			ld	c,d
+			ex	af,af'
+			cpl
+			ret	nz
+			ld	a,a
+			ld	a,a
+			rlca
+			ld	b,a
+			exx
+			ld	e,c
+			adc	a,a
+			cp	l
+			ld	(hl),h
+			ex	af,af'
+			rst	18h
+			ld	(8efdh),a
+			ld	c,d
+			adc	a,h
+			rst	38h
+			ld	e,h
+			ld	(hl),d
+			call	L2feb
+			pop	hl
+			cp	a
+			xor	a
+			sbc	a,d
+			sub	h
+			inc	sp
+			ex	(sp),hl
+			add	a,(hl)
+			ld	h,61h
+			cpl
+			ld	b,b
+			ld	b,e
+			rst	00h
+			add	a,82h
+			or	h
+			set	5,c
+			push	af
+			and	a
+			ld	b,c4h
+			ld	e,a
+			rst	18h
+			ld	sp,hl
+			and	b
+			ld	(hl),e
+			ld	b,b
+			dec	l
+			inc	de
+			adc	a,(hl)
+			ld	(hl),l
+			rst	30h
+			ld	l,c
+			nop (2x) *
+			ld	h,l
+			ld	e,15h
+			ld	d,c
+			dec	de
+			ret	c
+			inc	h
+			pop	hl
+			add	a,c
+			cp	e
+			ret	nz
+			adc	a,e
+			ld	d,h
+			ld	c,a
+			sbc	a,b
+			ld	c,(hl)
+			jp	p,L0f1f
+			ld	h,3bh
+			ex	(sp),hl
+			and	e
+			adc	a,e
+			ld	e,c
+			add	a,c
+			inc	c
+			sub	h
+			call	p,L7ca8
+			push	bc
+			jp	m,L4c5c
+			daa
+			add	hl,bc
+			ld	d,c
+			ld	b,a
+			halt
+			ld	sp,5ff4h
+			cp	a
+			di
+			jp	z,Le8ff
+			adc	a,e
+			inc	hl
+			ld	a,5dh
+			ld	e,c
+			ld	c,a
+			ld	(bc),a
+			ld	a,b
+			pop	af
+			dec	d
+			ei
+			jp	(hl)
+			db	a1h,4fh,e0h,7ch,07h,84h,85h,68h
+			db	43h,a6h,90h,2dh,7ch,b9h,b4h,d4h
+			db	06h,28h,e6h,87h,4dh,b9h,c6h,bbh
+			db	24h,86h,f4h,8eh,79h,02h,b9h,9ch
+			db	a5h,f0h,23h,dah,c6h,d5h,f3h,c0h
+			db	f6h,34h,16h,b3h,d1h,08h,8ah,52h
+			db	b2h,1dh,0eh,d6h,82h,0dh,88h,adh
+			db	7ah,2bh,0dh,52h,8fh,bdh,06h,0dh
+			db	fdh,5ah,9ch,b9h,e5h,e1h,beh,a9h
+			db	aeh,f5h,d3h,15h,fbh,dch,31h,edh
+			db	0fh,79h,bbh,8eh,cah,73h,cbh,92h
+			db	85h,7ah,c9h,a7h,08h,62h,2bh,89h
+			db	99h,9ch,9ch,f4h,4bh,4ah,a4h,0bh
+			db	f3h,12h,beh,95h,a6h,c5h,ddh,71h
+			db	86h,4eh,dch,f4h,c7h,27h,97h,46h
+			db	1bh,99h,b9h,f0h,1ah,31h,74h,53h
+			db	e0h,71h,c2h,2fh,83h,52h,cfh,f0h
+			db	cbh,deh,cah,3eh,6ch,09h,edh,2fh
+			db	58h,10h,d2h,4fh,a9h,63h,feh,7bh
+			db	56h,dbh,55h,31h,5fh,cah,2dh,4eh
+			db	90h,82h,56h,44h,d3h,c6h,cbh,a4h
+			db	8ch,1ch,5eh,71h,17h,d5h,e7h,b9h
+			db	d6h,cdh,1eh,c4h,e2h,89h,66h,ech
+			db	42h,48h,7ch,f4h,dfh,48h,92h,c2h
+			db	69h,1dh,12h,4eh,e0h,40h,e1h,f8h
+			db	15h,c7h,8ch,49h,4ch,beh,13h,74h
+			db	72h,58h,f7h,e6h,5eh,eeh,fch,4ch
+			db	40h,f3h,8ah,a0h,6eh,b6h,26h,a5h
+			db	71h,9fh,12h,e7h,70h,d4h,68h,3ch
+			db	62h,ceh,e7h,9fh,40h,6fh,77h,82h
+			db	e8h,99h,7fh,f9h,47h,62h,a8h,b3h
+			db	f8h,2ch,3ch,97h,8fh,3bh,c7h,92h
+			db	78h,cfh,d3h,e2h,43h
+			jr	c,L474a
+			dec	(hl)
+			cp	b
+			ld	c,h
+			and	e3h
+			call	po,L5715
+			cp	h
+			rst	00h
+			add	hl,de
+			dec	l
+			adc	a,h
+			ld	e,b3h
+			in	a,(4eh)
+			and	d
+			ld	b,(hl)
+			ld	l,c
+			rst	28h
+			ld	sp,e08bh
+			ld	l,l
+			ld	e,(hl)
+			ld	h,a
+			ld	h,l
+			nop (2x) *
+			jp	po,L7977
+			adc	a,h
+			dec	b
+			ld	e,c
+			ld	b,09h
+			ld	a,(de)
+			ld	b,l
+			and	61h
+			xor	d
+			dec	a
+			dec	d
+			ld	a,a
+			ld	d,c
+			ld	a,h
+			dec	l
+			ld	e,b
+			ccf
+			and	b
+			jp	p,Ld706
+			cp	e
+			ld	d,(hl)
+			exx
+			xor	b
+			ld	h,b3h
+			nop (2x) *
+			inc	sp
+			inc	c
+			ld	sp,aa7fh
+			xor	(hl)
+			ld	e,l
+			inc	hl
+			pop	de
+			ld	h,beh
+			rst	00h
+			ld	e,h
+			pop	hl
+			jr	z,L4731
+			add	hl,sp
+			rst	20h
+			ld	c,e5h
+			adc	a,h
+			inc	b
+			call	po,L155c
+			sub	h
+			ld	h,a
+			jp	nz,L4fa8
+			rlca
+			rst	20h
+			and	80h
+			inc	c
+			cp	c
+			ld	a,(hl)
+			sbc	a,c
+			rst	20h
+			add	hl,de
+			adc	a,c
+			dec	(hl)
+			ld	l,l
+			dec	a
+			jp	L1bd3
+			db	0dh,9ch,a0h,9bh,b0h,7bh,a2h,92h
+			db	2ch,f0h,4dh,5dh,04h,0fh,2dh,21h
+			db	2bh,90h,f6h,e9h,3bh,d7h,19h,68h
+			db	f1h,d2h,32h,14h,59h,fdh,7bh,c6h
+			db	c0h,0fh,afh,37h,f1h,01h,95h,e3h
+			db	04h,d6h,f1h,86h,ech,9ch,abh,d7h
+			db	86h,dch,f1h,d0h,f0h,d9h,b6h,6eh
+			db	16h,cfh,cdh,88h,87h,b2h,19h,3bh
+			db	8ch,edh,3eh,e3h,ceh,d3h,3bh,b9h
+			db	7ah,1dh,49h,e1h,b1h,5ch,4ah,14h
+			db	eeh,91h,6dh,78h,a5h,c7h,91h,beh
+			db	bbh,6bh,e0h,76h,afh,4dh,5fh,59h
+			db	d7h,9ch,b2h,a1h,70h,96h,6dh,fch
+			db	8ch,32h,9fh,ach,45h,f5h,96h,b0h
+			db	4dh,cch,49h,feh,76h,feh,4ah,3dh
+			db	2ah,96h,87h,16h,cdh,19h,68h,e6h
+			db	2fh,1fh,31h,50h,6bh,beh,f3h,d2h
+			ret	pe
+			rst	30h
+			or	a
+			ld	a,d
+			cp	a
+			ld	h,l
+			sub	c
+			ld	hl,eeb3h
+			ld	l,d
+			ret	m
+			ld	d,e
+			cp	l
+			ld	e,f7h
+			xor	c
+			ld	h,l
+			scf
+			add	a,a
+			ld	a,h
+			adc	a,d
+			ld	e,b
+			ld	(hl),b
+			inc	sp
+			add	a,a
+			dec	sp
+			call	m,L8d91
+			ld	(hl),e
+			ld	(hl),d
+			ld	e,a
+			ld	a,d8h
+			ld	a,(de)
+			ld	(hl),5eh
+			sub	h
+			ld	l,h
+			ld	e,d
+			sbc	a,d
+			ld	b,(hl)
+			cpl
+			call	m,L7887
+			dec	de
+			cpl
+			jr	nc,L484d
+			add	hl,bc
+			jr	z,L47ed
+			adc	a,l
+			in	a,(d3h)
+			ld	b,d
+			and	c
+			ld	a,c
+			halt
+			rst	38h
+			or	e
+			sbc	a,b
+			ld	e,l
+			ld	a,(hl)
+			jr	z,L484c
+			ld	e,c
+			sbc	a,l
+			inc	h
+			add	a,l
+			ld	e,d
+			ld	a,(bc)
+			sub	d
+			ld	(hl),a
+			cp	(hl)
+			dec	c
+			adc	a,(hl)
+			ld	(bc),a
+			ld	d,a
+			sub	(hl)
+			ret	z
+			jr	z,L4888
+			rst	10h
+			ld	d,c
+			ld	sp,4523h
+			jr	L4866
+			db	b1h,c9h,22h
+			rlca
+			ld	a,l
+			ret	nz
+			push	de
+			jp	(hl)
+			db	a8h,79h,c2h,e4h,88h
+			ld	a,e
+			ld	de,9471h
+			push	de
+			ld	h,b
+			inc	c
+			call	po,Lab4e
+			ld	b,iyl *
+			ld	(hl),h
+			dec	hl
+			ld	c,a
+			ld	a,b
+			pop	hl
+			dec	de
+			ei
+			ld	h,b
+			or	d
+			ld	(hl),e
+			ret	c
+			dec	h
+			jp	p,L3b5a
+			ld	h,d
+			and	d
+			ret	m
+			rst	30h
+			and	b
+			cp	h
+			ld	l,l
+			rst	00h
+			cp	c
+			add	a,b
+			adc	a,d
+			jp	L68a4
+			db	25h,b8h,6bh,69h,e6h,6fh,7eh,5dh
+			db	48h
+			ld	e,(hl)
+			ld	b,4ch
+			and	a
+			and	h
+			add	a,h
+			inc	sp
+			ld	c,c
+			ld	d,c
+			rst	20h
+			and	e
+			inc	l
+			ld	d,e
+			rst	28h
+			adc	a,h
+			dec	c
+			cp	e
+			push	de
+			ld	c,e
+			push	de
+			ld	e,ixh *
+			ld	b,h
+			ld	h,d
+			sub	d
+			ld	h,c
+			adc	a,d
+			ld	b,l
+			sub	h
+			ld	h,h
+			exx
+			add	a,e
+			ld	hl,2fech
+			sub	d
+			ld	h,d
+			xor	l
+			or	h
+			ld	(8c01h),hl
+			rst	38h
+			ld	a,(hl)
+			ld	e,10h
+			add	hl,de
+			cp	l
+			sbc	a,(hl)
+			ld	(2954h),hl
+			sub	bbh
+			pop	hl
+			halt
+			scf
+			ld	l,(hl)
+			add	hl,sp
+			xor	e0h
+			and	b
+			or	c
+			halt
+			dec	sp
+			ld	e,b
+			ld	d,a
+			xor	dbh
+			and	d
+			adc	a,e
+			cp	(hl)
+			sub	c
+			ld	d,d
+			dec	l
+			adc	a,c
+			jp	La42a
+			db	86h,dah,0ch,9ch,c7h,f5h,96h,2bh
+			db	a2h,95h,e6h,efh,e4h,61h,f2h,41h
+			ret	p
+			ld	e,(hl)
+			inc	hl
+			add	hl,bc
+			ld	b,(hl)
+			sbc	a,(hl)
+			rla
+			ld	hl,(5b63h)
+			ld	b,aeh
+			jp	nc,Ladbd
+			add	a,e
+			ld	d,b
+			inc	bc
+			ld	d,(hl)
+			daa
+			dec	b
+			cp	e
+			xor	b
+			dec	de
+			dec	b
+			dec	e
+			call	nc,L7e88
+			inc	d
+			rst	28h
+			rst	38h
+			ld	d,2eh
+			ld	a,l
+			ld	l,b
+			jr	nz,L48d2
+			ld	e,b
+			pop	hl
+			ld	(f933h),hl
+			and	d
+			or	l
+			ld	a,c
+			dec	b
+			or	a
+			ret	pe
+			ld	e,l
+			sub	c
+			rrca
+			ret	nz
+			pop	bc
+			rrca
+			add	a,e
+			ld	h,(hl)
+			inc	(hl)
+			xor	l
+			ld	a,(de)
+			or	(hl)
+			inc	l
+			exx
+			ld	b,l
+			sub	76h
+			dec	c
+			ld	e,h
+			ld	e,e
+			inc	c
+			ld	(hl),l
+			add	a,l
+			inc	l
+			jp	c,Lf9e8
+			ld	e,a
+			dec	d
+			call	m,L9f62
+			cp	l
+			call	c,L0289
+			ld	sp,6de0h
+			ld	b,l
+			ld	(hl),c
+			sbc	a,e
+			add	iy,bc
+			dec	a
+			ld	a,d
+			inc	de
+			call	po,Lc6e3
+			add	a,h
+			ld	c,5fh
+			ld	l,a
+			ld	l,aah
+			jp	nc,Ld984
+			or	(hl)
+			ld	c,h
+			ld	h,(hl)
+			ret	nc
+			ld	(hl),d
+			ld	h,d
+			and	h
+			ld	hl,(1e90h)
+			ret	p
+			ex	(sp),hl
+			add	a,h
+			jr	nc,L49cc
+			ld	a,b
+			xor	h
+			ld	b,a
+			cp	h
+			cp	b
+			xor	l
+			xor	d
+			jp	m,L2e13
+			ld	a,e3h
+			add	a,deh
+			ld	e,h
+			ld	d,c
+			ld	(f7cch),hl
+			ld	(hl),h
+			or	l
+			jp	pe,L82f7
+			adc	a,c
+			ld	b,l
+			rla
+			ld	h,l
+			sbc	a,b
+			ld	h,h
+			ld	de,d98dh
+			jr	c,L49be
+			jp	m,Laaa8
+			ld	c,b
+			push	de
+			adc	a,l
+			inc	d
+			inc	l
+			nop
+			or	h
+			ei
+			add	a,b
+			ld	de,c69eh
+			ld	l,l
+			jp	c,L8fad
+			ld	a,(34b0h)
+			call	p,L268a
+			ld	(938ah),a
+			cp	a
+			rla
+			sub	a
+			adc	a,a
+			add	a,d
+			ld	e,c9h
+			call	z,L58ce
+			ret	c
+			jp	(hl)
+			db	d9h,d1h,47h,fah,f5h,f5h,77h,abh
+			db	84h,b0h,5bh,72h,77h,58h,3ch,02h
+			db	10h
+			ld	hl,(da31h)
+			ld	c,89h
+			ld	b,f5h
+			di
+			sub	a2h
+			ret
+			db	16h,59h,dbh
+			and	l
+			ld	hl,(487dh)
+			sub	d
+			rst	00h
+			ld	e,(hl)
+			pop	de
+			dec	c
+			inc	hl
+			rst	20h
+			ld	d,l
+			dec	(hl)
+			inc	b
+			sbc	a,(hl)
+			jr	nz,L49a5
+			inc	sp
+			sbc	a,(hl)
+			adc	a,b
+			ld	d,d
+			sub	l
+			adc	a,b
+			ret	po
+			push	de
+			add	a,b
+			sub	(hl)
+			rst	28h
+			rst	10h
+			ld	a,(bc)
+			ld	(hl),d
+			ld	bc,9c68h
+			and	(hl)
+			ld	a,(bc)
+			inc	d
+			jp	m,Lb348
+			push	af
+			ld	sp,9696h
+			xor	c5h
+			cp	b
+			rst	10h
+			adc	a,(hl)
+			ld	d,e
+			ccf
+			ld	b,a
+			adc	a,c6h
+			sbc	a,l
+			ld	e,l
+			ld	h,c
+			ld	(bc),a
+			rrca
+			and	a
+			ld	b,b6h
+			ld	l,(hl)
+			ld	b,d
+			inc	h
+			push	hl
+			add	hl,hl
+			adc	a,21h
+			and	dch
+			exx
+			inc	d
+			xor	d
+			ld	iyl,iyl *
+			halt
+			cp	c
+			ld	(hl),d
+			ld	h,(hl)
+			in	a,(f0h)
+			xor	b
+			sbc	a,e
+			ld	(hl),b
+			and	c
+			inc	hl
+			ld	hl,3805h
+			call	m,L606d
+			nop
+			jr	z,L49db
+			add	a,h
+			adc	a,a
+			scf
+			ccf
+			ld	c,e
+			ld	b,b
+			xor	e
+			ld	c,a
+			ld	e,c
+			ld	e,e
+			jp	pe,L128e
+			ld	d,h
+			sbc	a,c
+			adc	a,e
+			ld	(bc),a
+			inc	e
+			cp	d
+			or	l
+			jr	L4aba
+			db	ceh,f0h,72h,d4h,88h,e2h,f9h,ach
+			db	7eh,c5h,3fh,65h,70h,64h,1dh,17h
+			db	7dh,b2h,c4h,f0h,0dh,61h,8dh,c1h
+			db	7bh,0bh,aah,19h,73h,7ch,9ch,d9h
+			db	b6h,b9h,eah,beh,05h,cch,58h,64h
+			db	82h,2eh,41h,fch,99h,88h,dch,1ch
+			db	ceh,a6h,0fh,20h,1dh,fah,9ah,f7h
+			db	33h,c1h,f0h,4fh,13h,ebh,c1h,e8h
+			db	d6h,c6h,b2h,3bh,56h,e8h,fah,5eh
+			db	fch,6dh,cch,eeh,1ch,34h,49h,10h
+			db	9fh,9eh,beh,89h,64h,c4h,3eh,28h
+			db	69h,c0h,53h,07h,88h,42h,96h
+			ld	b,b6h
+			adc	a,b
+			ld	b,l
+			ld	c,b
+			ld	a,b
+			nop (2x) *
+			ex	de,hl
+			call	nz,Lc57b
+			dec	sp
+			jp	nc,La6e2
+			or	76h
+			ld	hl,(0e01h)
+			cp	d
+			ld	sp,af09h
+			di
+			ld	l,a
+			sbc	a,b
+			ld	l,(hl)
+			rla
+			ld	l,c
+			exx
+			sub	c
+			sbc	a,d
+			ld	l,e
+			nop (2x) *
+			rla
+			sbc	a,a
+			ld	e,(hl)
+			inc	sp
+			ld	a,(bc)
+			dec	h
+			sbc	a,b
+			call	po,L3996
+			or	c
+			or	c
+			and	l
+			ld	l,(hl)
+			rra
+			and	(hl)
+			and	l
+			add	a,d
+			ld	d,d
+			sbc	a,b
+			ld	hl,(ac83h)
+			jr	nc,L4af0
+			ld	bc,eb5ch
+			add	a,c
+			cp	(hl)
+			ld	h,c
+			ld	c,h
+			ld	l,(hl)
+			or	d
+			in	a,(9ah)
+			ld	l,c
+			ld	d,h
+			ld	a,d
+			or	(hl)
+			push	af
+			sub	(hl)
+			inc	b
+			ret	po
+			ret	nc
+			ld	a,(bc)
+			ld	hl,(307bh)
+			ld	(hl),h
+			ld	(bc),a
+			bit	6,l
+			ld	e,l
+			ld	(de),a
+			push	de
+			adc	a,l
+			ld	e,d
+			sbc	a,b
+			add	a,h
+			ld	l,e
+			sub	h
+			ex	de,hl
+			ld	c,(hl)
+			sub	e
+			rst	00h
+			dec	de
+			ld	l,a
+			xor	l
+			ld	(hl),h
+			sbc	a,l
+			rlca
+			ld	d,(hl)
+			sbc	a,a
+			call	p,Lca7c
+			ld	h,a
+			exx
+			add	a,e
+			call	z,L2b4f
+			xor	e
+			ld	h,b
+			call	m,L8023
+			ld	b,(hl)
+			call	nc,L8a13
+			sub	9eh
+			ld	d,h
+			ld	a,(de)
+			ld	h,c
+			sbc	a,a
+			ld	a,(bc)
+			ld	e,a
+			ld	c,(hl)
+			djnz	L4aee
+			pop	bc
+			dec	c
+			sub	c
+			ld	b,h
+			call	nc,L99ef
+			xor	c
+			and	(hl)
+			inc	bc
+			or	e
+			or	b
+			or	c
+			ld	b,l
+			xor	a
+			ld	b,(hl)
+			scf
+			sub	l
+			sbc	a,e
+			rra
+			sub	e
+			ld	h,14h
+			xor	d
+			dec	d
+			pop	de
+			add	a,1bh
+			ld	(de),a
+			inc	de
+			dec	bc
+			add	a,77h
+			xor	(hl)
+			ld	e,l
+			adc	a,d
+			push	af
+			cp	c
+			jp	pe,Lc64b
+			ld	sp,hl
+			add	a,h
+			jp	z,Lbe6a
+			sub	d
+			ld	h,e
+			sbc	a,h
+			rst	18h
+			inc	hl
+			dec	de
+			dec	sp
+			jp	L6bcf
+			db	3ch,71h,7eh,2eh,1eh,c2h,51h,d8h
+			db	50h,5eh,09h,19h,b4h,cch,21h
+			ld	e,d
+			rlc	d
+			ld	c,c
+			ld	b,h
+			ld	e,d
+			sbc	a,d
+			ld	h,d
+			ld	d,(hl)
+			jp	nc,Ld9bd
+			halt
+			ld	(hl),l
+			adc	a,e
+			add	hl,hl
+			add	hl,bc
+			ld	a,(3833h)
+			call	nz,Lb092
+			push	bc
+			rst	08h
+			adc	a,b
+			add	hl,sp
+			ld	e,b
+			ld	h,79h
+			xor	99h
+			jp	m,Lf090
+			xor	d
+			nop (2x) *
+			jr	nc,L4bbc
+			dec	l
+			xor	e
+			rst	20h
+			set	2,l
+			sub	1eh
+			ld	hl,19aah
+			ld	d,d
+			ld	e,e
+			ld	e,a
+			jp	(hl)
+			db	8ah,97h,96h,aeh,1dh,5ah,b5h,1ch
+			db	45h,c1h,65h,84h,28h,e9h,b4h,c2h
+			db	dbh,9fh,72h,9bh,84h
+			pop	af
+			dec	(hl)
+			dec	bc
+			ld	a,(bc)
+			jr	L4bd4
+			db	64h,7fh,63h,50h,84h,3dh,3dh,20h
+			db	5fh,5fh,f6h,26h,c0h,35h,deh
+			ld	c,(hl)
+			or	a
+			push	hl
+			inc	sp
+			cp	efh
+			rrca
+			dec	h
+			ret	c
+			inc	bc
+			inc	hl
+			inc	c
+			ld	h,l
+			call	m,Lafcd
+			inc	a
+			ld	h,d
+			add	a,d
+			call	p,L5212
+			xor	h
+			and	l
+			ld	l,a
+			sub	e
+			rst	30h
+			pop	de
+			ld	a,h
+			call	L9f41
+			dec	h
+			pop	de
+			ld	h,c
+			ld	c,h
+			ld	hl,(fe04h)
+			ld	a,(de)
+			inc	sp
+			inc	d
+			ld	e,b
+			ld	c,e9h
+			ld	iy,814eh
+			inc	l
+			call	L6346
+			dec	de
+			halt
+			ld	h,(hl)
+			jr	L4c0e
+			db	cch,ach,44h
+			adc	a,(hl)
+			ld	e,a
+			or	d
+			cp	(hl)
+			xor	55h
+			and	a
+			dec	e
+			jp	c,L935b
+			add	hl,sp
+			call	p,L6956
+			dec	d
+			ld	c,d
+			ld	(hl),h
+			set	6,e
+			ld	d,d
+			cp	b
+			ld	e,73h
+			call	nz,Ld87d
+			cpl
+			xor	l
+			rst	18h
+			adc	a,e
+			xor	c
+			ld	l,c
+			ld	(hl),d
+			ld	l,d
+			add	a,2dh
+			cp	cah
+			ld	a,(de)
+			rrca
+			jp	z,L3fd9
+			ld	(5e71h),a
+			ld	a,(ce03h)
+			ld	a,e
+			inc	l
+			xor	d
+			ld	e,35h
+			sbc	a,l
+			inc	de
+			push	de
+			sbc	a,a
+			ld	(hl),d
+			xor	l
+			ld	d,h
+			ld	l,23h
+			xor	b
+			xor	a
+			or	c
+			add	a,c
+			ld	e,h
+			nop (2x) *
+			ld	d,a
+			jr	L4c45
+			db	2fh,34h,6dh,54h,9dh
+			ex	(sp),hl
+			sub	(hl)
+			or	l
+			ld	d,(hl)
+			jp	nz,L8623
+			adc	a,a
+			ld	a,e
+			adc	a,h
+			ld	d,c
+			halt
+			ld	b,l
+			rst	20h
+			cp	a
+			ld	e,(hl)
+			xor	1bh
+			pop	bc
+			jp	po,L7a07
+			ld	a,(de)
+			call	pe,L44d3
+			and	(hl)
+			ld	l,h
+			ret	nz
+			ld	e,l
+			dec	a
+			inc	e
+			rst	00h
+			ld	d,c
+			call	z,L25c5
+			ld	a,d
+			rst	10h
+			daa
+			xor	(hl)
+			ld	(hl),a
+			add	a,d
+			adc	a,b
+			ld	a,h
+			ld	e,b
+			rst	08h
+			ret	p
+			ld	c,h
+			ret	z
+			adc	a,h
+			and	e
+			call	Lf813
+			ld	(1253h),hl
+			ld	a,l
+			rst	30h
+			ld	e,c
+			rst	10h
+			ld	bc,ce28h
+			jp	c,Ldc40
+			sbc	a,b
+			push	de
+			or	b
+			ld	d,e
+			nop (2x) *
+			add	a,e
+			ld	h,e
+			rst	38h
+			ld	a,b
+			nop
+			ld	h,(hl)
+			inc	a
+			inc	(hl)
+			ld	c,b
+			cp	a
+			in	a,(71h)
+			in	a,(b0h)
+			jr	z,L4cc1
+			push	de
+			ld	l,c
+			add	a,l
+			ei
+			xor	e
+			rst	00h
+			ld	l,(hl)
+			and	h
+			cp	(hl)
+			dec	bc
+			rst	38h
+			inc	sp
+			dec	(hl)
+			add	hl,sp
+			inc	bc
+			ld	b,(hl)
+			ld	d,b
+			dec	hl
+			sub	b
+			and	c
+			or	(hl)
+			ld	c,b
+			add	a,h
+			rst	18h
+			call	nz,L4d8d
+			adc	a,c
+			or	h
+			ld	e,(hl)
+			ld	(55e3h),hl
+			ld	e,c
+			exx
+			cpl
+			inc	c
+			adc	a,e
+			call	m,L5796
+			rst	30h
+			ld	h,e
+			ld	(hl),c
+			ld	e,h
+			xor	h
+			call	p,L6910
+			ex	af,af'
+			rst	38h
+			rst	18h
+			sub	c
+			ret	p
+			rst	00h
+			ld	d,c
+			ld	c,b
+			ld	b,b
+			ld	e,e
+			ret	z
+			ld	(hl),b
+			add	a,(hl)
+			rlca
+			ld	l,e
+			ld	l,86h
+			sbc	a,c
+			ld	h,d
+			pop	hl
+			and	a
+			ld	sp,hl
+			ret	pe
+			ld	a,h
+			adc	a,l
+			ld	d,c
+			ld	h,07h
+			push	hl
+			add	hl,sp
+			ld	a,b
+			ld	(b3ach),hl
+			dec	h
+			jr	nz,L4cc2
+			cp	e
+			ld	(hl),b
+			push	bc
+			ld	h,l
+			jr	nz,L4d46
+			rla
+			call	c,Lb9a6
+			ret	p
+			ret	m
+			ld	d,l
+			and	d
+			or	e
+			ld	d,e
+			jr	c,L4d80
+			ld	bc,19a6h
+			and	c
+			xor	c
+			cp	l
+			ld	l,e
+			ret	c
+			dec	a
+			adc	a,e
+			add	a,d
+			xor	c
+			jp	z,L1488
+			ld	e,h
+			and	h
+			ld	(43d0h),hl
+			ld	b,a
+			xor	iyl *
+			dec	(hl)
+			ld	d,(hl)
+			sbc	a,0fh
+			and	(hl)
+			ld	b,(hl)
+			jr	c,L4db1
+			ld	l,l
+			exx
+			ld	l,d
+			ld	l,(hl)
+			ret	c
+			ld	b,e
+			ret	nc
+			jp	m,L6659
+			jr	z,L4cf9
+			adc	a,(hl)
+			rrca
+			ld	e,(hl)
+			and	b
+			add	a,l
+			ld	sp,5819h
+			jp	po,L067c
+			call	p,L401a
+			ld	a,c
+			ld	e,(hl)
+			ld	a,h
+			ld	h,h
+			ccf
+			jp	po,Lf72a
+			ld	a,h
+			ld	h,e
+			ld	d,h
+			ld	a,(de)
+			call	c,L5496
+			ld	b,d
+			ld	a,(de)
+			and	(hl)
+			add	hl,sp
+			ret
+			db	95h,49h,f0h,d0h,12h,0eh,2ch,edh
+			db	07h,52h,a0h,e8h,a5h,deh
+			jp	z,La219
+			cp	(hl)
+			ld	a,f7h
+			add	hl,bc
+			add	hl,hl
+			di
+			call	pe,Lbb15
+			cp	h
+			ld	b,f6h
+			or	l
+			rst	00h
+			call	nc,L5a3a
+			ld	c,l
+			ld	c,e
+			call	pe,L8264
+			adc	a,d8h
+			di
+			inc	c
+			dec	c
+			dec	b
+			pop	hl
+			sub	e
+			dec	sp
+			ld	b,a
+			ret	nz
+			ld	h,h
+			inc	d
+			ld	e,h
+			ld	(hl),71h
+			rra
+			add	a,eeh
+			ld	e,e
+			push	hl
+			call	z,L0e53
+			inc	de
+			sbc	a,e
+			or	c
+			ld	b,d
+			ld	b,l
+			add	a,b
+			ccf
+			ld	a,d
+			adc	a,a
+			xor	(hl)
+			ld	l,e
+			ccf
+			ld	e,a
+			ld	h,2ch
+			jr	L4da9
+			db	46h,9ah,c1h,0ah,84h,beh,89h,dfh
+			db	1dh,c2h,ddh,92h,afh,76h,50h,f1h
+			db	89h,01h,f8h,2ch,cfh,29h,24h,a0h
+			db	01h,f7h,55h,9bh,eeh,1ch,79h,77h
+			db	1bh,36h,83h,5fh,90h,79h,4fh,5ch
+			db	9ch,1bh,1eh,dbh,85h,57h,2dh,5dh
+			db	53h,18h,3ch,12h,0dh,80h,63h,dbh
+			db	0ah,37h,2ah,7bh,ebh,72h,c2h,07h
+			db	3bh
+			ret	nz
+			or	e
+			push	hl
+			call	p,L6c9e
+			cp	b
+			inc	d
+			cp	d
+			ld	b,d3h
+			sub	e
+			sub	b
+			ld	a,e
+			ld	hl,cfddh
+			cp	b
+			ld	c,dch
+			add	a,b
+			ld	(hl),a
+			ld	b,c
+			call	p,Lec01
+			ld	sp,hl
+			ld	a,b
+			ld	(bc),a
+			dec	b
+			ld	a,(fe26h)
+			di
+			or	(hl)
+			jr	L4e17
+			db	a0h,ach,f6h,c9h,eeh,5fh,73h,9dh
+			db	94h,37h,11h,80h,66h,f5h,88h,27h
+			db	82h,3dh,dch,2eh,90h,b3h,edh,fdh
+			db	1ah,2ah,ffh,46h,85h,cbh,0eh,14h
+			db	b4h,edh,24h,c2h,5ch,bfh,5bh,36h
+			db	43h,abh,a8h,f5h,33h,ach,60h,cdh
+			db	41h,adh,feh,f1h,c4h,2bh,25h,87h
+			db	4ch,9bh
+			or	d9h
+			ld	hl,e296h
+			dec	c
+			ld	a,(hl)
+			rst	10h
+			ld	d,h
+			ld	e,28h
+			ld	l,a
+			add	a,d
+			inc	h
+			ld	b,l
+			add	hl,bc
+			add	hl,hl
+			ld	(hl),c
+			out	(ffh),a
+			ld	a,a
+			ld	c,c
+			inc	bc
+			ld	(hl),86h
+			call	nz,Ldbf6
+			adc	a,e
+			rst	20h
+			rla
+			ld	d,h
+			ccf
+			cp	54h
+			ld	c,a
+			or	c
+			xor	(hl)
+			dec	b
+			add	a,b
+			ld	a,93h
+			adc	a,d
+			ld	d,(hl)
+			ret
+			db	f1h,ebh,37h,b0h,e4h,65h,2fh,9fh
+			db	a1h,9bh,43h,52h,1dh,c6h,20h,feh
+			db	83h,f1h,50h,94h,9dh,adh,c1h,98h
+			db	96h,d1h,9dh,ffh,c6h,05h,bfh,dfh
+			db	81h,95h,44h,dah,66h
+			dec	d
+			sbc	a,c
+			bit	4,l
+			jr	c,L4e5a
+			ld	c,77h
+			ld	(hl),l
+			xor	e
+			and	l
+			ld	c,h
+			ld	a,h
+			sub	b
+			ld	sp,5427h
+			sbc	a,b
+			ld	h,b
+			jp	pe,L1a22
+			ld	l,d
+			ld	b,a
+			sbc	a,afh
+			ld	b,a
+			ld	(07d3h),a
+			ld	c,e
+			ret	po
+			pop	hl
+			ld	h,e
+			ld	(hl),l
+			add	a,b
+			xor	l
+			ld	c,(hl)
+			ld	c,6bh
+			ld	d,d
+			ld	(bc),a
+			and	a
+			inc	(hl)
+			dec	(hl)
+			cp	(hl)
+			inc	c
+			dec	a
+			inc	sp
+			add	hl,hl
+			ret	m
+			ld	h,b
+			ld	d,b
+			ld	b,a
+			call	pe,L4ee2
+			and	(hl)
+			adc	a,d
+			rlca
+			call	z,L5c8f
+			sbc	a,2eh
+			ld	(bc),a
+			rst	08h
+			ld	hl,(0920h)
+			ret
+			db	c2h,6ah,b1h,e6h,05h,d0h,bch,23h
+			db	28h,a0h,46h,24h,72h,dfh,78h,44h
+			db	9dh,1fh,0ch,f5h,67h,1eh,7dh,a6h
+			db	d4h,beh,4dh
+			adc	a,h
+			xor	b
+			add	hl,sp
+			inc	de
+			and	ach
+			rra
+			jp	pe,L6176
+			xor	(hl)
+			ld	d,c
+			ld	h,c
+			jr	L4f71
+			db	dbh,fah
+			ld	d,(hl)
+			ld	d,c
+			jp	pe,L9e88
+			ld	d,h
+			ld	d,a
+			ld	bc,d72bh
+			dec	a
+			and	e
+			sub	87h
+			ld	c,l
+			cp	h
+			call	m,L8457
+			ld	e,b
+			add	a,a
+			add	hl,bc
+			dec	b
+			ld	a,(hl)
+			ld	e,22h
+			xor	h
+			ret	nz
+			ld	d,c
+			ld	c,h
+			ld	c,h
+			ret	nc
+			ld	(hl),c
+			push	de
+			ld	e,l
+			ld	e,48h
+			ex	af,af'
+			sbc	a,a
+			adc	a,a
+			jr	z,L4f0e
+			ret	m
+			call	pe,Lbf85
+			inc	sp
+			push	hl
+			add	a,h
+			pop	af
+			ld	l,b
+			ld	a,a
+			di
+			add	hl,bc
+			xor	e
+			add	a,l
+			rlca
+			call	pe,Ld428
+			jp	L9dbf
+			db	60h,f5h,f6h,37h,7ch,29h,c1h,38h
+			db	e1h,35h,b9h,d6h,1ch,43h,93h,f3h
+			db	54h,4fh,8fh
+			ld	c,e
+			ld	b,l
+			ret	p
+			ld	c,b
+			rlca
+			jp	nc,L5a00
+			nop
+			dec	(hl)
+			jp	L6e74
+			db	a0h,f3h,d1h,9bh,66h,41h,aah,84h
+			db	03h,8fh,f3h,8ch,aeh,f2h,47h,d9h
+			db	3ch,7fh,0dh,9dh,2ah,fdh,61h,99h
+			db	ebh,26h,16h,efh,dbh,23h,91h,1eh
+			db	47h,26h,71h,9bh,2fh,03h
+			adc	a,e
+			dec	b
+			sbc	a,a
+			and	d
+			ld	a,h
+			ld	l,b
+			ld	h,e
+			ld	e,d
+			dec	h
+			add	a,d
+			ex	af,af'
+			ld	d,c
+			ld	sp,hl
+			sbc	a,(hl)
+			ret	nz
+			inc	hl
+			ld	l,(hl)
+			ld	b,a
+			di
+			dec	l
+			ld	d,l
+			jp	po,L50b2
+			and	b
+			ld	h,a
+			ret
+			db	65h,c9h,c3h,7dh,19h,0bh,b5h,6ch
+			db	7eh,0bh,36h,66h,cdh,13h,e0h,dch
+			db	90h,19h,26h,72h
+			dec	a
+			or	c
+			ld	e,l
+			jp	L739f
+			db	7dh,50h,e0h,68h,55h,e0h,c1h,8bh
+			db	45h,8ah,9eh,b7h,07h,a9h,c0h,d3h
+			db	edh,aah,cdh,97h,edh,15h,23h,79h
+			db	4dh,abh,a5h,f8h,19h,3ch,1bh,f0h
+			db	46h,a8h,31h,2ah,04h,78h,0dh,a0h
+			db	1eh,b2h,f1h,61h,10h,ebh,d6h,cfh
+			db	76h,a8h,81h,03h,0eh,aah,d7h,d2h
+			db	8ah,eeh,20h
+			and	h
+			inc	de
+			ex	(sp),hl
+			ld	b,e
+			inc	c
+			dec	bc
+			jr	z,L4fa4
+			jr	z,L4fd3
+			jp	c,L29d1
+			ld	c,a
+			and	l
+			cp	h
+			rrca
+			ld	a,b
+			pop	hl
+			ld	h,c
+			dec	sp
+			and	a
+			and	a
+			and	l
+			inc	c
+			inc	l
+			or	ceh
+			rst	30h
+			ret	pe
+			ld	c,a
+			or	h
+			sub	(hl)
+			ld	c,03h
+			ret	c
+			ld	a,(de)
+			pop	hl
+			ld	a,(hl)
+			inc	sp
+			call	Ld55f
+			adc	a,a
+			ret	m
+			sbc	a,d
+			ld	(hl),b
+			add	a,b
+			ret	nc
+			cp	a
+			add	a,l
+			or	(hl)
+			jr	c,L5061
+			add	a,l
+			ld	e,a
+			ld	h,a
+			jp	nz,L187e
+			ld	a,l
+			sub	e
+			add	hl,bc
+			inc	d
+			push	bc
+			ld	d,(hl)
+			rst	18h
+			jp	c,L98ea
+			jr	z,L50a7
+			add	a,d
+			sub	b
+			and	h
+			nop (2x) *
+			rst	28h
+			inc	a
+			call	m,Ld7ec
+			and	d
+			ret	nc
+			ld	d,e
+			ld	c,87h
+			ret	z
+			ld	hl,19b4h
+			rst	18h
+			ld	l,c
+			ld	b,h
+			or	c
+			rra
+			ld	a,d
+			jp	nz,L1ec6
+			ld	e,c
+			inc	bc
+			jp	nz,Ldf5a
+			dec	de
+			xor	(hl)
+			ld	c,h
+			ei
+			ld	(hl),b
+			add	a,l
+			xor	d
+			and	l
+			or	a
+			ld	sp,hl
+			ld	b,a
+			ld	c,76h
+			pop	af
+			nop (2x) *
+			ei
+			xor	76h
+			or	d9h
+			rst	08h
+			ld	l,b
+			ld	h,h
+			dec	h
+			ld	(de),a
+			or	e
+			exx
+			ex	de,hl
+			ld	e,l
+			jp	pe,L2dd2
+			ld	c,(hl)
+			ld	a,(bc)
+			ld	a,4dh
+			and	d
+			inc	d
+			ld	e,d
+			cp	(hl)
+			xor	h
+			rst	10h
+			dec	h
+			jp	nz,Lc4cd
+			in	a,(2bh)
+			ld	h,c
+			ld	(hl),c
+			ld	b,l
+			ld	d,e
+			jr	L50bd
+			ld	e,a
+			and	ebh
+			add	a,l
+			ld	d,h
+			ld	a,e
+			sbc	a,(hl)
+			sub	(hl)
+			rst	28h
+			xor	h
+			ld	h,e
+			add	a,h
+			ld	c,dbh
+			ex	de,hl
+			ld	d,d
+			sub	c
+			ld	a,c
+			inc	(hl)
+			ld	d,c
+			ld	c,(hl)
+			rst	00h
+			add	hl,bc
+			ld	c,e
+			call	nz,Ld26e
+			ld	(hl),b
+			pop	de
+			nop (2x) *
+			ret	p
+			add	a,d
+			dec	d
+			jp	pe,L5276
+			jp	po,L2f3f
+			ld	c,(hl)
+			inc	bc
+			ld	e,l
+			inc	bc
+			ld	d,d
+			cpl
+			ld	(c32ah),a
+			ld	l,c
+			ld	(8291h),hl
+			ld	b,c
+			and	d
+			dec	de
+			ld	a,(hl)
+			call	nz,L7040
+			ld	e,l
+			ld	c,b
+			sub	e
+			ret	po
+			xor	c
+			inc	bc
+			and	d
+			ld	l,d
+			inc	b
+			in	a,(9bh)
+			inc	b
+			pop	af
+			push	af
+			ld	d,l
+			ld	l,e
+			ld	d,a
+			ld	d,l
+			ld	(bc),a
+			inc	h
+			ei
+			and	h
+			dec	h
+			inc	c
+			inc	d
+			dec	de
+			sub	b
+			ld	b,a
+			and	d0h
+			dec	(hl)
+			jp	(hl)
+			db	b5h,eeh
+			rra
+			ret	p
+			add	a,l
+			add	a,h
+			ld	e,d
+			add	hl,sp
+			cp	c
+			nop
+			rst	00h
+			ld	d,(hl)
+			ex	(sp),hl
+			ld	c,h
+			adc	a,c3h
+			dec	c
+			xor	c
+			ld	a,h
+			ld	e,l
+			sub	c
+			bit	1,l
+			ld	(hl),a
+			ld	a,cah
+			sub	d
+			call	po,L9080
+			rla
+			rla
+			sbc	a,d
+			inc	de
+			ld	(9fa7h),hl
+			dec	bc
+			rst	10h
+			cpl
+			ld	e,d
+			inc	a
+			sub	fbh
+			ld	(hl),h
+			ld	a,b
+			call	z,Lfbc9
+			xor	(hl)
+			ld	(hl),d
+			ld	(hl),e
+			adc	a,a
+			ld	c,b
+			sub	a
+			cp	c
+			add	a,70h
+			inc	hl
+			inc	b
+			jr	z,L5186
+			xor	c
+			ld	a,6bh
+			and	h
+			jp	p,L12bd
+			ld	(bc),a
+			ld	c,e
+			ld	d,a
+			inc	bc
+			and	c
+			ld	a,d
+			rlca
+			add	a,c
+			call	nz,L451a
+			ld	b,05h
+			ld	e,07h
+			ld	a,l
+			sub	d
+			ret	po
+			or	c
+			and	h
+			ld	hl,ad5eh
+			cp	(hl)
+			dec	bc
+			xor	d
+			inc	hl
+			ld	b,l
+			ld	h,d
+			cp	(hl)
+			add	a,b
+			ld	d,0fh
+			rst	28h
+			ld	a,(hl)
+			ld	b,h
+			dec	b
+			adc	a,a
+			scf
+			out	(e1h),a
+			ld	h,d
+			ld	a,(bc)
+			ld	d,h
+			cp	(hl)
+			and	h
+			add	a,c8h
+			rra
+			or	6dh
+			add	a,cbh
+			ld	a,d
+			xor	(hl)
+			ld	(hl),h
+			ld	a,a
+			ld	c,c
+			sbc	a,h
+			inc	de
+			ret	m
+			rst	28h
+			ld	(hl),b
+			add	a,b
+			ld	b,h
+			inc	de
+			ld	(hl),h
+			cp	d
+			adc	a,c
+			jp	pe,L7e76
+			push	hl
+			inc	sp
+			ld	c,l
+			ld	d,b
+			jp	pe,L9415
+			sbc	a,l
+			jr	L5137
+			db	b4h,aeh,6eh,5dh,81h,03h,94h,b4h
+			xor	h
+			ld	h,e
+			dec	(hl)
+			sub	d
+			rst	08h
+			ld	a,c2h
+			jp	m,Lbf73
+			rst	30h
+			xor	h
+			jp	p,L8785
+			sub	e
+			dec	e
+			ld	b,e
+			jr	c,L515e
+			adc	a,b
+			add	a,e
+			rla
+			rrca
+			ld	d,l
+			add	hl,bc
+			ret	z
+			ld	c,e
+			call	m,L425d
+			ld	d,d
+			add	hl,hl
+			ld	(260dh),a
+			sbc	a,a
+			adc	a,c
+			ld	a,l
+			djnz	L520a
+			sub	d
+			ret	nc
+			ret	po
+			and	b
+			in	a,(7dh)
+			ld	a,b
+			rst	30h
+			ld	e,e
+			xor	dfh
+			add	hl,de
+			ld	hl,(6bf4h)
+			ld	(de),a
+			ld	e,l
+			dec	e
+			and	(hl)
+			jp	Lfb83
+			db	30h,d2h,a5h,c3h,24h,4fh,49h,61h
+			db	7ah,45h,a0h,f7h,9fh,9ch,04h,b7h
+			db	36h,c9h,c0h,03h,02h,62h,75h,d0h
+			db	abh,63h,aah,77h,ceh,e2h
+			ld	h,e
+			rra
+			ld	e,d
+			xor	(hl)
+			dec	a
+			ld	d,d
+			xor	c
+			cp	(hl)
+			ld	a,l
+			rst	08h
+			inc	a
+			ld	a,c
+			push	hl
+			ret	nc
+			jr	nc,L5258
+			ld	b,a
+			ld	h,c
+			inc	l
+			dec	d
+			xor	d
+			jp	L4d67
+			db	80h,57h,fah,e4h,99h,0bh,a0h,a3h
+			db	c1h,4eh,4bh,98h,55h,89h,04h,2eh
+			db	3fh,24h,f0h,40h,15h,d6h,81h,4eh
+			db	3fh
+			jr	L5263
+			sbc	a,b
+			ret	po
+			ld	h,b
+			call	z,Lf730
+			ld	h,(hl)
+			ld	a,a
+			add	a,h
+			dec	bc
+			xor	b
+			ld	c,76h
+			ld	h,e
+			push	hl
+			jp	pe,L899d
+			jp	p,L2b4b
+			adc	a,b
+			rlca
+			add	hl,hl
+			ld	c,l
+			and	a
+			cp	e
+			rst	20h
+			cp	h
+			ld	bc,c2edh
+			add	a,c
+			inc	e
+			call	pe,L523b
+			sbc	a,30h
+			cp	b
+			daa
+			ld	a,c
+			cp	efh
+			ld	l,e
+			ld	(hl),cah
+			rst	38h
+			xor	c
+			nop
+			ld	h,e
+			cp	3bh
+			ld	h,(hl)
+			ld	l,b
+			call	m,Lb73d
+			sbc	a,d
+			ld	b,c
+			rla
+			add	hl,hl
+			jr	L5249
+			db	c3h,38h,67h,f9h,e5h,9ch,f4h,f9h
+			db	82h,43h,ebh,50h,e4h,b1h,f4h,91h
+			db	eah,4ah,05h,91h,3eh,31h,02h,4ch
+			db	02h,96h,0dh,d4h,b2h,54h,1ah,a3h
+			db	e6h,e2h,3fh,a6h,adh,e6h,48h,d6h
+			db	b1h,6ah,73h,81h,c4h,ebh,8dh,a2h
+			db	99h,4ah,72h,90h,ech,9ch,c7h,65h
+			db	82h,beh,12h,17h,d8h,adh,f3h,10h
+			db	c7h,35h,72h,f3h,60h,7ah,ebh,9ch
+			db	51h,5dh,0eh,feh,b8h,75h,4dh,a2h
+			db	95h,4bh,e2h,dfh,97h,b1h
+			ld	d,e
+			dec	e
+			ld	b,b
+			cp	a4h
+			and	d
+			call	p,L6199
+			call	pe,Ldcc5
+			or	e
+			sub	a
+			add	a,c
+			ret	nc
+			ld	e,l
+			ld	l,d
+			call	m,Ledd0
+			rst	18h
+			add	hl,hl
+			ld	hl,451bh
+			jp	Ldc2a
+			db	62h,a8h,aeh,c0h,46h,f2h,9dh,f5h
+			db	99h,9fh,c2h,46h,0bh,5dh,1bh,35h
+			db	b6h,e1h,ach,9fh,e4h,bdh,abh,83h
+			db	24h,9dh,51h,07h,d2h,03h,3bh,31h
+			db	63h,a8h,a5h,62h,47h,a1h,dch,b1h
+			db	6fh,92h,afh,2dh,25h,42h,aah
+			rst	10h
+			ld	sp,04b0h
+			nop
+			sbc	a,a
+			inc	(hl)
+			cp	a
+			add	a,(hl)
+			dec	c
+			ld	sp,hl
+			ld	e,c
+			xor	d
+			dec	a
+			ld	e,e
+			sbc	a,b
+			ld	b,e
+			ld	e,b
+			xor	h
+			ld	h,h
+			add	hl,hl
+			jr	z,L53b4
+			adc	hl,sp
+			sbc	a,c
+			ld	c,b
+			ret	c
+			and	e
+			ld	d,d
+			adc	a,d
+			ld	(hl),aeh
+			rst	20h
+			ex	af,af'
+			rrca
+			cp	d
+			ld	e,e
+			ld	(de),a
+			out	(d8h),a
+			rst	20h
+			ld	bc,dc2ah
+			adc	a,l
+			xor	c
+			ld	d,c
+			adc	a,d
+			add	a,e
+			adc	a,b
+			add	a,57h
+			ld	h,b
+			ld	h,d
+			ld	d,h
+			ld	d,a
+			ld	d,e
+			rra
+			cpl
+			jp	z,L5ed7
+			adc	a,88h
+			sub	h
+			sbc	a,a
+			rlca
+			xor	d
+			ld	b,d
+			dec	e
+			add	a,l
+			ld	e,d
+			ld	e,e
+			ld	c,l
+			dec	l
+			or	d
+			cp	a
+			rst	08h
+			inc	c
+			or	l
+			or	(hl)
+			inc	bc
+			ret	m
+			dec	a
+			ret
+			db	67h,c2h,0eh,29h,eah,b7h,61h,10h
+			db	0ch,68h,9eh,a2h,e5h,f1h,76h,5eh
+			db	c8h
+			cpl
+			adc	a,d
+			ld	b,d
+			cp	c
+			ld	(0d1bh),hl
+			ld	e,1eh
+			xor	l
+			add	hl,de
+			ld	e,b
+			jp	nz,L99dd
+			sbc	a,h
+			jp	po,Lf877
+			ld	h,h
+			dec	c
+			ld	b,b
+			ld	b,e
+			add	a,a
+			sbc	a,c
+			ld	d,h
+			or	51h
+			ld	h,e
+			rrca
+			or	(hl)
+			sbc	a,h
+			daa
+			adc	a,h
+			jr	c,L5338
+			ld	a,(de)
+			call	c,L8c38
+			dec	hl
+			ld	a,(de)
+			ld	a,(hl)
+			ld	a,l
+			ld	b,c
+			ld	e,c
+			call	p,Lde07
+			jp	z,L6c6e
+			adc	a,c
+			ld	(hl),a
+			dec	c
+			cp	e
+			ld	c,b
+			ld	c,e
+			sub	c
+			or	c
+			rst	20h
+			dec	de
+			sub	(hl)
+			ld	a,l
+			jp	(hl)
+			db	14h,4ah,66h,9dh,f5h,dah,5fh,9fh
+			db	6eh,fah,79h,5ah,48h,56h,92h,9eh
+			db	a8h,67h,e9h,74h,3fh,1ah,b0h,90h
+			db	ddh,89h,9eh,b9h,68h,b5h,08h,14h
+			db	31h,0eh,02h,c0h,ddh,b3h,2fh,77h
+			db	1eh,feh,a6h,74h,cbh,48h,96h,20h
+			db	2bh,d4h,05h,48h,c2h,f0h,a9h,96h
+			db	c9h,6fh,3bh,4bh,f8h,65h,5eh,f7h
+			db	b0h,c8h,e5h,3bh,ech,7eh,dch,c9h
+			db	63h,eeh,68h,06h,86h,61h,6fh,f4h
+			db	f5h,4dh,35h,3bh,85h,a8h,9eh,70h
+			db	5ch,51h,71h,38h,4ch,0ah
+			or	a
+			ld	h,(hl)
+			ld	(bc),a
+			ld	a,a
+			xor	d
+			ld	a,b
+			ld	h,c
+			call	nc,Le5f4
+			cp	h
+			ld	c,b
+			call	nc,Le672
+			inc	d
+			or	d
+			ld	a,b
+			ld	hl,(00ddh)
+			dec	de
+			add	a,l
+			ld	de,9699h
+			dec	bc
+			xor	e
+			adc	a,h
+			xor	b
+			ld	a,(bc)
+			ld	e,b
+			dec	d
+			xor	e
+			dec	bc
+			ret	nc
+			call	L3f43
+			rst	10h
+			dec	d
+			ld	(hl),c
+			ld	a,e
+			cp	c
+			ld	a,(hl)
+			ld	c,h
+			ld	c,c
+			ret	pe
+			ld	a,a
+			jr	c,L543e
+			ld	h,d
+			ld	sp,6dc2h
+			ei
+			ret	m
+			or	e
+			rst	18h
+			ld	c,a
+			ld	hl,(e4eah)
+			ccf
+			out	(28h),a
+			ld	d,h
+			call	p,Lf55d
+			add	a,h
+			ret	p
+			ld	d,b
+			dec	hl
+			sbc	a,45h
+			inc	l
+			scf
+			jp	p,Le762
+			djnz	L5425
+			ld	e,l
+			add	a,d
+			ld	l,b
+			ld	l,a
+			jp	p,L317e
+			or	l
+			rst	00h
+			jp	nc,L035f
+			bit	3,d
+			adc	a,b
+			sbc	a,d
+			dec	hl
+			ld	(hl),l
+			ld	e,h
+			jr	z,L545e
+			sbc	a,d
+			ret	po
+			ld	(hl),h
+			cp	e
+			ret	c
+			cp	b2h
+			dec	c
+			sub	(hl)
+			djnz	L54cf
+			sbc	a,l
+			rla
+			pop	bc
+			adc	a,1fh
+			add	hl,hl
+			out	(f0h),a
+			call	nc,Ld1da
+			jp	z,Le17c
+			ld	(hl),a
+			ld	e,e
+			sbc	a,c
+			or	h
+			inc	l
+			or	c
+			ld	a,e
+			push	bc
+			ld	d,b
+			jp	po,L21c1
+			cp	a
+			push	hl
+			rrca
+			adc	a,e
+			ld	h,e
+			jp	(hl)
+			db	7ch,fah,b9h,f2h,f1h,9ch,f7h,a7h
+			db	52h,e0h,17h,58h,e3h,bah,57h,9bh
+			db	d3h,dah,2ah,29h,3eh,e8h,cbh
+			jp	m,Lca3b
+			ld	(hl),d
+			jr	nz,L5538
+			ld	b,a
+			ld	e,l
+			inc	a
+			cp	d
+			ld	(b6edh),hl
+			add	a,e
+			set	2,d
+			add	a,(hl)
+			ld	(hl),d
+			ld	b,l
+			dec	sp
+			xor	c
+			ld	c,b
+			nop (2x) *
+			dec	sp
+			inc	a
+			ld	l,e
+			add	a,d
+			or	a
+			ld	a,a
+			sub	d
+			cp	(hl)
+			ld	e,(hl)
+			ld	a,a
+			or	h
+			ld	(hl),c
+			ret	c
+			ld	l,c
+			and	0bh
+			add	a,36h
+			and	l
+			cp	(hl)
+			pop	af
+			cp	l
+			ld	c,e
+			rst	08h
+			cp	l
+			add	hl,de
+			rra
+			sub	l
+			add	hl,hl
+			pop	bc
+			jp	m,L6158
+			call	po,L8749
+			sub	l
+			sub	(hl)
+			and	e
+			jp	(hl)
+			db	c4h,6fh,12h,dbh,87h,9fh,4ah,76h
+			db	a9h,66h,f2h,4ah,c4h,02h,93h
+			ld	e,c0h
+			and	(hl)
+			and	l
+			pop	af
+			inc	sp
+			ld	h,h
+			add	a,f2h
+			ld	a,8dh
+			add	a,l
+			ld	h,d4h
+			dec	(hl)
+			jp	c,L23d4
+			nop (2x) *
+			jp	c,L18aa
+			call	nc,L20e4
+			xor	(hl)
+			ld	(hl),a
+			or	l
+			sub	l
+			inc	d
+			rst	38h
+			ret	z
+			ld	a,(86c5h)
+			push	de
+			ret	c
+			ld	b,h
+			adc	a,c
+			adc	a,e
+			ld	l,e
+			or	e
+			ld	(hl),d
+			di
+			add	a,(hl)
+			ret	c
+			add	hl,hl
+			or	(hl)
+			xor	d7h
+			call	nc,L334a
+			ld	(hl),l
+			dec	b
+			ld	hl,(1aabh)
+			and	d
+			sbc	a,(hl)
+			ex	de,hl
+			ld	c,h
+			ld	d,h
+			nop
+			ld	d,h
+			ld	l,c
+			ld	b,0fh
+			ex	(sp),hl
+			jr	nz,L5524
+			and	a
+			cp	h
+			add	a,c
+			and	h
+			push	bc
+			ld	h,43h
+			ret
+			db	3fh,ebh,44h,05h,88h,98h,e4h,21h
+			db	51h,56h,59h,06h,89h,fah,02h,a7h
+			db	99h,a4h,d4h,60h,93h,2dh,84h,87h
+			db	bch,53h,98h,0dh,a4h,50h,f6h,cah
+			db	87h,9ah,50h,5fh,31h,fdh,95h,06h
+			db	bfh,95h,26h,e1h,efh,f3h,62h,94h
+			db	b1h,79h,a7h,86h,fdh,e7h,b5h,58h
+			db	21h,e7h,70h,28h,f3h,1ch,4dh,11h
+			db	f5h,b3h,35h,d2h,81h,83h,8fh,66h
+			db	44h,c8h,26h,a1h,19h,e1h,67h,28h
+			db	48h,68h,81h
+			ccf
+			ret	p
+			ld	a,(bc)
+			jp	p,Lbd35
+			ld	b,h
+			ld	h,(hl)
+			ld	h,h
+			rst	00h
+			ld	(hl),c
+			or	a3h
+			ld	e,b
+			ld	(hl),a
+			pop	de
+			ld	d,e
+			ld	(hl),d
+			inc	e
+			cp	(hl)
+			dec	sp
+			jp	pe,L3866
+			and	h
+			rra
+			scf
+			dec	l
+			ld	a,(bc)
+			ld	l,58h
+			ld	c,d
+			or	ebh
+			dec	c
+			ld	c,a
+			scf
+			pop	de
+			ld	(hl),14h
+			jr	nc,L561d
+			ex	(sp),ix
+			push	bc
+			halt
+			cp	c
+			ld	h,h
+			or	d
+			cp	h
+			ld	(hl),d
+			ld	e,h
+			add	a,b
+			rst	30h
+			inc	b
+			ld	b,d
+			ld	sp,hl
+			inc	de
+			jp	nz,L81b9
+			ld	h,ech
+			or	b
+			add	a,e
+			ld	e,e
+			push	bc
+			ld	e,abh
+			and	b
+			ld	(hl),e
+			inc	sp
+			ld	e,h
+			ld	c,a
+			ld	h,a
+			cp	c
+			sbc	a,e
+			ld	d,(hl)
+			sbc	a,d
+			ld	c,c
+			add	a,c
+			ld	e,l
+			rst	08h
+			and	(hl)
+			add	a,e
+			sub	2dh
+			jr	nc,L55f8
+			ld	l,c
+			call	z,Lb43c
+			ld	a,a2h
+			pop	af
+			inc	(hl)
+			ld	l,d
+			ld	(de),a
+			jp	L5275
+			db	7ah,88h,51h,a1h,04h
+			cp	a
+			ld	a,c
+			xor	(hl)
+			ld	c,(hl)
+			ld	de,b00dh
+			xor	9bh
+			rst	00h
+			dec	b
+			ld	(hl),l
+			ld	l,c
+			adc	a,b
+			ld	b,15h
+			jp	m,Lea3f
+			adc	a,d
+			jp	p,Lc609
+			push	de
+			sub	c
+			dec	(hl)
+			ld	l,(hl)
+			ld	b,l
+			cp	d
+			inc	bc
+			djnz	L5606
+			sbc	a,a
+			ld	(7027h),a
+			ld	hl,7e39h
+			pop	hl
+			inc	e
+			add	hl,sp
+			ld	b,c
+			rst	08h
+			rst	00h
+			ret	nz
+			ld	a,b
+			xor	l
+			ld	e,d
+			dec	bc
+			ld	h,a
+			add	a,l
+			rst	18h
+			or	l
+			ld	c,a
+			sbc	a,c
+			dec	e
+			ld	b,b
+			ld	c,a7h
+			push	bc
+			sub	h
+			ld	c,c
+			ld	d,d
+			scf
+			cp	b2h
+			ret	po
+			jp	po,L4f40
+			sub	(hl)
+			and	h
+			inc	a
+			ld	d,(hl)
+			ld	d,c
+			ld	l,(hl)
+			ld	h,b
+			exx
+			sub	90h
+			xor	e
+			or	d
+			ld	(a4efh),hl
+			ld	a,(de)
+			sbc	a,e
+			dec	bc
+			cp	l
+			xor	c
+			nop (2x) *
+			ld	c,b
+			ld	a,e
+			inc	a
+			nop (2x) *
+			ret	pe
+			sbc	a,h
+			adc	a,(hl)
+			or	e
+			sub	a
+			call	nz,L5cf7
+			ld	a,a
+			call	nc,L0cde
+			rst	10h
+			or	(hl)
+			xor	e
+			ld	e,l
+			sbc	a,(hl)
+			call	nc,Lc760
+			halt
+			push	bc
+			exx
+			ld	d,d
+			or	h
+			ld	a,(hl)
+			ret	pe
+			ld	l,e0h
+			ld	b,l
+			ld	a,(de)
+			ld	e,b
+			ld	(hl),l
+			ld	h,l
+			adc	a,51h
+			ld	e,b
+			exx
+			ld	c,a8h
+			sub	h
+			ld	(de),a
+			call	nz,Ld8c9
+			inc	l
+			ld	e,b
+			jp	po,L2184
+			ld	b,d
+			ld	d,e
+			ret	m
+			add	a,24h
+			ld	d,d2h
+			ret	nz
+			nop (2x) *
+			and	b6h
+			inc	de
+			ld	a,(8ea9h)
+			rst	08h
+			call	L96f6
+			inc	hl
+			rst	28h
+			nop
+			ld	b,(hl)
+			sbc	a,(hl)
+			ld	b,c7h
+			add	a,b
+			or	c
+			cp	16h
+			sub	a
+			ld	(hl),l
+			adc	a,c
+			ld	l,a
+			push	de
+			ld	h,a
+			cp	c
+			call	c,Lb25f
+			ld	de,f768h
+			sub	(hl)
+			halt
+			call	nz,L49f4
+			jr	L56f3
+			db	e6h,b7h,fdh,42h
+			dec	sp
+			ld	d,a
+			call	nc,L8456
+			ld	de,ddedh
+			ld	(6af3h),a
+			ld	l,(hl)
+			adc	a,l
+			and	78h
+			add	hl,de
+			cp	d
+			ld	h,a
+			dec	e
+			xor	d
+			or	d
+			ld	e,b
+			or	(hl)
+			jp	nc,L89e3
+			rst	20h
+			ld	c,a
+			ld	de,6f38h
+			sub	d
+			ld	e,90h
+			ret
+			cp	b
+			ld	de,88bbh
+			ld	(hl),e
+			or	h
+			in	a,(40h)
+			inc	bc
+			add	hl,sp
+			push	hl
+			ld	h,e
+			add	a,a
+			sub	c
+			ld	b,c
+			ld	h,c
+			ld	(hl),d
+			cp	(hl)
+			jr	c,L571c
+			ld	(4efch),a
+			cp	b
+			ld	(hl),h
+			adc	a,h
+			daa
+			ld	e,c5h
+			ld	(hl),b
+			ld	d,b
+			ld	e,(hl)
+			sbc	a,h
+			dec	c
+			rst	08h
+			adc	a,d
+			or	a
+			cp	c
+			ld	a,(de)
+			inc	hl
+			inc	c
+			sub	d
+			ld	l,08h
+			rst	30h
+			ld	d,d
+			ld	e,aeh
+			ld	l,b
+			ld	h,a
+			dec	l
+			ld	b,e
+			add	hl,hl
+			ld	e,b
+			pop	bc
+			ld	e,afh
+			rst	30h
+			nop (2x) *
+			ld	e,b
+			ret	po
+			or	l
+			sub	b
+			xor	l
+			jp	p,L1b47
+			ld	h,b
+			push	bc
+			rra
+			rst	20h
+			djnz	L5716
+			ld	l,4fh
+			ld	(hl),c
+			inc	(hl)
+			ex	de,hl
+			adc	a,e6h
+			ld	l,e
+			ld	d,b
+			sbc	a,b
+			ld	(de),a
+			ld	l,h
+			inc	de
+			xor	h
+			add	a,(hl)
+			rst	18h
+			adc	a,a
+			ret	po
+			ld	(hl),d
+			ld	c,(hl)
+			call	L5ca3
+			sbc	a,b
+			in	l,(c)
+			sbc	a,(hl)
+			sub	e
+			ld	b,a
+			ld	c,h
+			add	a,e
+			pop	hl
+			add	a,c
+			ld	a,c
+			ld	(bc),a
+			ld	hl,(914ah)
+			ld	l,c
+			jp	po,L8dae
+			or	b
+			dec	c
+			ld	h,a
+			ld	h,b
+			call	z,Lf48f
+			rlca
+			daa
+			cp	d
+			cp	9eh
+			add	hl,sp
+			adc	a,88h
+			ld	b,h
+			or	iyh *
+			ld	b,h
+			ld	l,b
+			ld	l,a
+			ld	c,h
+			sub	e
+			ld	h,d
+			xor	9eh
+			dec	c
+			ld	(4661h),hl
+			djnz	L581a
+			exx
+			or	(hl)
+			cp	a
+			ret
+			db	68h,8bh
+			or	e
+			ld	c,e
+			dec	sp
+			jp	c,L5aff
+			or	a
+			ld	d,(hl)
+			adc	a,l
+			ld	c,d
+			sbc	a,c
+			push	bc
+			ld	c,d
+			ld	l,b
+			ld	l,e
+			or	a
+			in	a,(83h)
+			ld	d,c
+			jp	(hl)
+			db	bah,10h,c5h,a3h,83h,e9h,94h,3dh
+			db	ffh,40h,3eh,c9h,a6h,42h,e1h,46h
+			db	ceh,00h,75h,89h,4fh,39h,b9h
+			ld	e,(hl)
+			ld	b,a
+			ld	d,a
+			inc	bc
+			inc	sp
+			sub	a
+			ld	c,b
+			sbc	a,c
+			push	bc
+			rst	38h
+			ret	m
+			inc	b
+			call	po,L587e
+			ld	d,(hl)
+			cp	b
+			ccf
+			rla
+			ld	e,l
+			xor	e
+			xor	d
+			and	e
+			ccf
+			or	b
+			ld	c,(hl)
+			cp	h
+			ld	a,h
+			dec	h
+			ld	l,e
+			and	e
+			push	hl
+			sbc	a,h
+			dec	b
+			ld	l,b
+			and	c
+			pop	hl
+			nop
+			and	h
+			or	(hl)
+			ld	h,(hl)
+			di
+			ex	(sp),hl
+			ld	c,c
+			or	h
+			xor	e
+			ld	h,a
+			ld	(de),a
+			rst	28h
+			xor	d
+			ld	(hl),8fh
+			ld	h,h
+			sbc	a,e
+			dec	hl
+			scf
+			ld	(hl),h
+			xor	l
+			ld	a,(dcbeh)
+			rla
+			sbc	a,l
+			ld	d,e
+			or	a
+			jp	(hl)
+			db	6ch,bah,1dh,2fh,0eh,40h,4fh,28h
+			db	8ah,a9h,fch,28h,e4h,bdh,87h,fch
+			db	e0h,3eh,b0h,80h,98h,5ah
+			ld	a,a
+			sub	e
+			ld	h,b
+			or	e
+			cp	(hl)
+			ld	b,e
+			xor	e
+			ld	a,h
+			sub	a
+			adc	a,(hl)
+			push	hl
+			ld	d,c
+			and	c
+			ld	d,cbh
+			ld	b,d
+			ld	d,c
+			ld	b,c
+			ex	de,hl
+			or	b
+			inc	e
+			ex	de,hl
+			ld	b,a
+			call	nc,L1f77
+			sbc	a,b
+			cp	(hl)
+			and	e
+			ld	c,27h
+			dec	a
+			inc	l
+			sbc	a,d
+			or	l
+			rst	30h
+			rst	38h
+			sub	c
+			cp	h
+			ld	a,(hl)
+			ld	d,d
+			ld	h,e
+			ld	a,(bc)
+			dec	c
+			dec	bc
+			inc	b
+			add	a,l
+			sbc	a,l
+			inc	l
+			ld	l,e4h
+			cp	c
+			ld	a,c
+			out	(9dh),a
+			ret	p
+			ld	(de),a
+			ld	e,b
+			rst	20h
+			xor	e
+			ld	l,b
+			add	hl,de
+			ld	(hl),e
+			sbc	a,h
+			add	hl,hl
+			ex	af,af'
+			rra
+			adc	a,e
+			sub	c
+			inc	l
+			adc	a,a
+			dec	de
+			sbc	a,e
+			or	(hl)
+			rst	10h
+			ld	c,69h
+			inc	b
+			ld	hl,(d1fch)
+			inc	a
+			ld	a,(hl)
+			ret	p
+			ex	af,af'
+			rra
+			inc	a
+			ld	h,h
+			ccf
+			jr	nz,L580f
+			jp	m,L5b80
+			ld	(hl),h
+			rlca
+			dec	d
+			inc	a
+			call	nz,L5114
+			ld	(hl),l
+			ld	a,b
+			ld	(hl),d
+			ld	bc,eb5bh
+			adc	a,e
+			sbc	a,e
+			rrca
+			sbc	a,b
+			sbc	a,h
+			dec	h
+			ret	p
+			call	c,L5182
+			ld	c,c
+			ld	c,c
+			jp	pe,La718
+			inc	sp
+			ld	a,(hl)
+			adc	a,a
+			sub	b
+			ld	sp,f537h
+			inc	de
+			ld	(bc),a
+			res	2,e
+			sbc	a,(hl)
+			ld	(hl),l
+			ld	b,0ah
+			or	a
+			and	a
+			or	h
+			adc	a,b
+			ld	l,a0h
+			dec	hl
+			dec	l
+			ld	c,d
+			ld	d,d
+			ld	(hl),b
+			dec	bc
+			ld	b,fah
+			ld	h,h
+			ld	h,h
+			add	a,64h
+			ld	(hl),l
+			djnz	L58ee
+			add	a,e
+			add	hl,sp
+			and	e
+			ex	af,af'
+			ld	d,e
+			ld	c,d
+			add	a,h
+			rst	28h
+			ld	h,d
+			ld	sp,3981h
+			add	hl,de
+			call	Lc3d4
+			cp	l
+			adc	a,h
+			adc	a,(hl)
+			sbc	a,e
+			ld	a,b
+			pop	af
+			ret	nc
+			ld	l,d
+			ld	d,c
+			sbc	a,c
+			halt
+			ld	l,l
+			sbc	a,c
+			sbc	a,l
+			inc	(hl)
+			inc	hl
+			ld	(bc),a
+			ld	e,2eh
+			sbc	a,b
+			ld	l,d
+			adc	a,l
+			ld	d,h
+			ld	d,d
+			sub	(hl)
+			call	nz,L862b
+			add	a,c
+			nop (2x) *
+			adc	a,a
+			ld	d,f7h
+			ld	sp,ea91h
+			xor	5eh
+			dec	c
+			sbc	a,a
+			inc	h
+			ld	l,b
+			ld	b,d
+			call	nc,Lecd5
+			ld	hl,55fdh
+			ld	d,d
+			sub	a
+			dec	d
+			sub	a
+			inc	e
+			ld	(eac7h),hl
+			jp	m,L7e5c
+			add	a,h
+			ld	(hl),2ah
+			ld	l,e
+			adc	a,b
+			push	af
+			ld	bc,5d2fh
+			ld	b,e
+			jp	p,L42cc
+			inc	a
+			call	L6aff
+			ld	bc,d86bh
+			ld	b,e
+			xor	42h
+			adc	a,d
+			exx
+			cp	e7h
+			and	d
+			call	po,L3dba
+			inc	bc
+			call	c,La241
+			ld	c,d
+			ld	(hl),d
+			exx
+			ld	sp,7591h
+			rst	38h
+			exx
+			ret	z
+			sub	e
+			ld	a,(bc)
+			ld	a,(de)
+			ld	e,c
+			inc	c
+			ld	h,b
+			inc	a
+			rst	18h
+			djnz	L5979
+			sbc	a,d
+			and	(hl)
+			dec	c
+			jr	nz,L58e5
+			ld	e,d
+			ld	c,b
+			sub	b
+			dec	c
+			call	pe,Lac1e
+			ld	c,07h
+			dec	c
+			ld	a,a
+			ld	b,e
+			inc	e
+			call	pe,L00f2
+			inc	l
+			ld	b,b
+			xor	b
+			sbc	a,h
+			and	b
+			sub	a
+			nop (2x) *
+			sub	(hl)
+			ld	d,e
+			ld	l,b
+			in	a,(f1h)
+			ld	a,c
+			inc	c
+			ld	c,d
+			call	po,L49a0
+			adc	a,l
+			rst	38h
+			ld	l,(hl)
+			ld	d,(hl)
+			ld	b,92h
+			add	a,d
+			ld	c,90h
+			inc	hl
+			add	hl,sp
+			ld	e,e
+			cp	h
+			ld	d,b
+			inc	hl
+			ld	sp,hl
+			add	a,a
+			ld	(hl),e
+			ld	sp,hl
+			xor	l
+			di
+			ld	hl,(f639h)
+			jp	p,L67de
+			add	a,50h
+			ld	h,c
+			nop (2x) *
+			exx
+			ld	l,e
+			ld	d,c
+			sbc	a,(hl)
+			sra	l
+			jr	nz,L5964
+			sbc	a,b
+			or	(hl)
+			ld	c,c
+			sub	a
+			ld	l,e
+			cp	l
+			sbc	a,l
+			ld	h,b
+			ld	l,a
+			ld	a,(bc)
+			ld	(hl),l
+			ld	e,h
+			ld	(hl),b
+			jp	L6c97
+			db	79h,d4h,22h,f1h,95h,a7h,99h,f6h
+			db	20h,8ch,0bh,46h,8ah,0bh,beh,02h
+			db	54h,afh,6fh,85h,23h,5eh,0eh,99h
+			db	9dh,f5h,7fh,65h,cbh,28h,ebh,01h
+			db	eah,edh,8ch,06h,4ah,73h,65h,94h
+			db	80h,7ah,93h,deh,27h,98h,b1h,feh
+			db	c6h,c6h,27h,12h,aeh,f0h,7bh,58h
+			db	31h,afh,d8h,cah,0ch,81h,ech
+			cp	l
+			ld	e,a
+			ld	(hl),c
+			inc	b
+			ld	de,5b83h
+			ex	af,af'
+			inc	de
+			sub	a
+			ld	hl,1504h
+			jp	(hl)
+			db	ech
+			pop	de
+			ld	b,2ch
+			sbc	a,(hl)
+			rst	18h
+			add	a,c
+			rst	18h
+			sbc	a,l
+			add	a,b
+			inc	e
+			and	b
+			sbc	a,c
+			ex	de,hl
+			ld	b,d
+			ld	a,(de)
+			call	z,L4d3b
+			ld	a,(de)
+			jp	p,L0775
+			in	a,(deh)
+			adc	a,l
+			add	a,h
+			ld	hl,(d81eh)
+			di
+			push	de
+			ld	l,3eh
+			add	a,h
+			ld	h,b
+			ret	nz
+			xor	c
+			or	h
+			ld	de,c909h
+			ld	b,c
+			inc	hl
+			or	d
+			and	a
+			ld	e,(hl)
+			dec	sp
+			add	hl,de
+			dec	l
+			ld	h,(hl)
+			ld	d,b
+			ld	a,l
+			ld	e,d
+			pop	af
+			ld	a,e
+			pop	af
+			dec	bc
+			rst	30h
+			call	nz,L2524
+			exx
+			ld	a,c
+			ld	(0fb5h),a
+			ld	d,(hl)
+			rra
+			inc	bc
+			rst	10h
+			push	af
+			inc	de
+			rst	10h
+			add	hl,bc
+			push	de
+			call	z,L30ff
+			xor	l
+			ld	a,e
+			add	a,b
+			ld	a,b
+			nop
+			call	nc,Lbfb9
+			inc	l
+			jp	z,L6d41
+			inc	a
+			ld	d,a
+			ld	d,h
+			rst	28h
+			jr	nz,L5a8f
+			rst	38h
+			inc	e
+			add	a,b
+			or	h
+			nop
+			inc	bc
+			exx
+			jr	z,L59f1
+			adc	a,fdh
+			ld	b,b
+			ld	(hl),h
+			dec	c
+			ld	h,e
+			inc	l
+			rst	38h
+			or	d
+			dec	a
+			ld	(79f0h),hl
+			adc	a,h
+			ld	c,b
+			sbc	a,c
+			or	l
+			ld	(hl),adh
+			ld	a,b
+			ld	d,e2h
+			rrca
+			ld	l,h
+			ld	d,d
+			call	po,L8dd8
+			rst	08h
+			rst	18h
+			jr	nz,L5ab3
+			out	(f8h),a
+			ld	(hl),e
+			ex	(sp),hl
+			xor	h
+			adc	a,(hl)
+			ld	d,(hl)
+			sub	a
+			call	p,L8b01
+			ld	(bc),a
+			ld	hl,f5b4h
+			and	h
+			cp	a
+			jp	po,L1397
+			sub	a
+			ld	(ed40h),a
+			rlca
+			inc	(hl)
+			add	hl,hl
+			adc	a,5bh
+			ld	(hl),a
+			rlca
+			xor	(hl)
+			ei
+			or	c
+			xor	ddh
+			halt
+			ld	b,c
+			xor	h
+			exx
+			ld	a,d
+			ld	c,b
+			add	a,d
+			ld	e,c
+			ld	d,e
+			ld	a,h
+			ld	e,(hl)
+			ld	(hl),d3h
+			cp	b
+			call	nz,L7ada
+			or	b
+			ld	a,(bc)
+			rst	38h
+			sub	(hl)
+			or	(hl)
+			or	d
+			rst	38h
+			jp	c,L8dbe
+			ld	d,c
+			di
+			jr	c,L5ab0
+			jp	nz,L1feb
+			ld	b,d
+			dec	sp
+			dec	de
+			inc	sp
+			ld	d,e
+			dec	e
+			ld	h,(hl)
+			inc	sp
+			jp	pe,Lb729
+			rst	10h
+			ld	hl,(51b9h)
+			ld	a,a
+			cp	(hl)
+			rst	38h
+			rst	10h
+			exx
+			ld	a,a
+			ld	c,l
+			ld	ixh,b *
+			sbc	a,(hl)
+			daa
+			rst	08h
+			adc	a,b
+			jr	L5acf
+			db	59h,53h,e5h,fbh,c0h,62h,85h,24h
+			db	a9h,fch,62h,52h,d6h,03h,20h,3dh
+			db	a8h,cbh
+			inc	b
+			rra
+			nop (2x) *
+			add	hl,de
+			rla
+			ex	af,af'
+			ld	sp,hl
+			ld	(hl),h
+			push	bc
+			add	hl,hl
+			adc	a,l
+			call	po,L3810
+			inc	a
+			cp	d
+			add	a,l
+			ld	c,(hl)
+			ld	e,e
+			cp	c
+			dec	d
+			xor	h
+			cp	(hl)
+			rst	18h
+			ld	l,73h
+			ld	b,(hl)
+			add	a,a
+			ld	e,c
+			jp	nc,L5485
+			ld	b,a
+			ld	bc,7f92h
+			call	z,Lacc1
+			add	a,h
+			ld	(hl),h
+			or	h
+			add	hl,bc
+			adc	a,a
+			push	hl
+			dec	(hl)
+			ld	hl,(L145e)
+			add	hl,sp
+			ld	h,c
+			ret	z
+			dec	e
+			rla
+			nop (2x) *
+			adc	a,e
+			jp	z,L4ae4
+			dec	(hl)
+			and	c5h
+			sub	a
+			or	c
+			dec	l
+			sbc	a,(hl)
+			ld	d,e
+			and	b
+			sbc	a,e
+			sub	l
+			ld	h,c
+			inc	d
+			cp	c
+			pop	de
+			add	hl,hl
+			ret	pe
+			ret	p
+			cpl
+			ld	(de),a
+			ret	nz
+			ld	d,h
+			sbc	a,d
+			sub	l
+			ld	c,d
+			ld	(hl),c
+			dec	b
+			or	a
+			xor	b
+			or	l
+			cp	b
+			add	a,c
+			sbc	a,d
+			ld	h,(hl)
+			ld	h,e
+			ld	e,b
+			adc	a,a
+			jp	z,La7b0
+			pop	de
+			and	h
+			ld	b,h
+			dec	b
+			jp	Le6b1
+			db	1dh,beh,e1h,fbh,a3h,5ah,5ch,15h
+			db	7bh,dbh,ffh,0ch,3fh,7dh,edh,39h
+			db	38h,1ah,44h,85h,47h,12h
+			ret	nz
+			ld	a,d
+			nop (2x) *
+			add	a,e
+			and	a
+			cp	a
+			ld	h,a
+			ex	de,hl
+			sub	b7h
+			ret	z
+			ret	c
+			ld	c,a
+			sbc	a,d
+			ld	h,l
+			sbc	a,d
+			xor	a
+			add	a,c
+			ld	d,a
+			jp	pe,L265d
+			ex	af,af'
+			dec	l
+			ld	e,a
+			ld	(4ccdh),a
+			ld	a,d
+			call	nc,L4d00
+			adc	a,h
+			ret	nz
+			jr	nc,L5bec
+			inc	d
+			call	L172f
+			sbc	a,e
+			ld	e,c3h
+			sbc	a,c
+			ld	l,(hl)
+			inc	b
+			push	hl
+			rst	18h
+			ld	(4ecch),hl
+			ld	e,e
+			ld	e,(hl)
+			and	c
+			ret	m
+			inc	b
+			dec	(hl)
+			inc	c
+			ret	nc
+			ld	a,(bc)
+			ld	(hl),c
+			inc	(hl)
+			ld	de,3463h
+			adc	a,4dh
+			ld	a,e
+			dec	(hl)
+			ret	z
+			inc	h
+			jp	pe,L8060
+			ld	a,a
+			pop	de
+			nop
+			rst	30h
+			jp	po,Le869
+			ld	h,c
+			ld	l,8eh
+			sub	c
+			rst	00h
+			ld	a,h
+			ld	(hl),c
+			ld	c,(hl)
+			dec	bc
+			ld	c,a
+			adc	a,l
+			adc	a,l
+			ld	d,97h
+			ld	b,e
+			call	m,L7934
+			out	(09h),a
+			ld	l,(hl)
+			ld	a,c
+			xor	(hl)
+			di
+			ret	pe
+			ld	b,l
+			ld	(hl),a
+			inc	e
+			add	a,c
+			call	z,Le0e4
+			jp	c,L9fd6
+			ld	b,h
+			pop	de
+			daa
+			jp	nc,La891
+			adc	a,(hl)
+			jp	p,L0eed
+			ret	pe
+			cp	d
+			or	6fh
+			ret	nc
+			ld	c,(hl)
+			ld	c,h
+			call	nz,L9514
+			ret	pe
+			ld	h,dah
+			and	aeh
+			dec	l
+			ld	l,l
+			xor	b
+			ld	d,h
+			add	a,c
+			sbc	a,3eh
+			push	de
+			ld	(bc),a
+			jp	nc,La9f1
+			ld	c,l
+			pop	af
+			add	a,(hl)
+			ld	l,d
+			ret	c
+			dec	h
+			ld	d,47h
+			dec	de
+			push	de
+			ld	(bc),a
+			push	bc
+			ld	c,e
+			rst	38h
+			and	h
+			xor	h
+			ld	h,dah
+			cp	h
+			ex	(sp),hl
+			ld	h,b
+			and	c
+			dec	(hl)
+			ld	c,04h
+			inc	b
+			ld	(de),a
+			djnz	L5c4a
+			or	a
+			sub	b
+			ld	(hl),h
+			ld	l,(hl)
+			sbc	a,b
+			ld	d,e
+			inc	e
+			ld	l,a
+			jp	Lec42
+			db	b6h,31h,1ah,bbh,d2h,7bh
+			nop (2x) *
+			ret	p
+			rst	20h
+			jr	nz,L5ca8
+			or	b
+			sub	d
+			cp	b
+			cp	e
+			inc	hl
+			ld	a,d
+			sbc	a,d
+			cpl
+			nop
+			ex	(sp),hl
+			inc	(hl)
+			ld	d,d
+			scf
+			inc	d
+			rst	30h
+			cp	l
+			ret	nc
+			jr	L5c9a
+			db	2dh,09h,97h,52h,d8h,24h,39h,6eh
+			db	9ch,81h,ebh,8bh,54h,c8h,36h,77h
+			db	5bh,bdh,3fh,86h,50h,ebh,a4h,20h
+			db	11h,2ch,85h,dah,84h,e0h,05h,85h
+			db	b8h,27h,7ch,9bh,c7h,f6h,e2h,99h
+			db	5eh,c8h,91h,f4h,89h,c6h,0ch
+			adc	a,e
+			jr	nz,L5d07
+			ld	e,31h
+			sub	e
+			nop
+			ret	pe
+			add	a,d
+			ld	(hl),c
+			adc	a,h
+			ld	b,e
+			ld	l,h
+			add	a,(hl)
+			cp	b
+			jr	nc,L5d07
+			sbc	a,b
+			pop	de
+			sbc	a,82h
+			ld	hl,a61eh
+			cp	l
+			ld	hl,(5c63h)
+			inc	c
+			dec	de
+			jp	z,L2ff1
+			jr	nc,L5c5f
+			rst	38h
+			jr	c,L5c48
+			ld	(hl),08h
+			push	bc
+			rst	38h
+			add	a,a
+			ld	a,c
+			inc	l
+			push	af
+			ld	c,d
+			add	hl,bc
+			ld	d,e
+			ld	c,h
+			add	a,cfh
+			ld	(hl),l
+			adc	a,c
+			ld	(hl),d
+			or	c2h
+			ld	c,d
+			pop	af
+			call	po,Lc07e
+			and	b
+			ld	b,d
+			call	po,L5469
+			or	(hl)
+			call	m,L26c6
+			ld	(hl),c
+			sbc	a,5ah
+			ld	h,e
+			xor	e
+			add	a,b
+			ld	h,d
+			add	a,b
+			dec	bc
+			ld	a,(de)
+			ld	h,(hl)
+			call	po,L167f
+			ld	d,c
+			ret	p
+			ld	de,c21bh
+			ld	(hl),c
+			ld	a,l
+			call	nz,L13f3
+			ret	p
+			ld	(bc),a
+			sub	a
+			cp	l
+			inc	l
+			ld	h,d
+			add	a,(hl)
+			sub	l
+			ld	(ba81h),a
+			ld	b,d
+			jr	c,L5d63
+			ld	(hl),d
+			pop	de
+			ld	e,d
+			sub	e
+			add	a,c
+			pop	de
+			xor	d
+			sub	c
+			and	b
+			inc	sp
+			call	m,L3ba5
+			and	a
+			ld	h,a
+			ld	(de),a
+			pop	bc
+			rlca
+			jp	p,L20d9
+			ld	(hl),b
+			call	z,La120
+			call	p,Lec14
+			adc	a,b
+			dec	(hl)
+			inc	b
+			inc	hl
+			inc	a
+			cp	1bh
+			inc	e
+			ld	e,d
+			ld	a,d
+			ld	e,a
+			halt
+			ld	b,b
+			ld	sp,7925h
+			ret	c
+			pop	de
+			ld	l,h
+			push	de
+			dec	d
+			ld	d,h
+			ex	(sp),hl
+			rst	20h
+			and	e
+			sbc	a,c
+			call	L81ff
+			jp	(hl)
+			db	31h,99h,f5h,feh,ffh,b5h,70h,2dh
+			db	70h,90h,fdh,4ah,cbh,7ch,b5h,e6h
+			db	b5h,9ah,19h,4ah,b0h,45h,2ch,93h
+			db	31h,83h,19h,3ah,2ah,0bh,97h,cah
+			db	19h,d8h,71h,feh,d1h,77h,99h
+			add	a,l
+			ld	a,(hl)
+			or	h
+			dec	c
+			xor	l
+			jp	(hl)
+			sbc	a,(hl)
+			nop (2x) *
+			adc	a,b
+			ld	b,a
+			add	hl,de
+			adc	a,c
+			or	d
+			ld	a,l
+			inc	(hl)
+			jr	c,L5d30
+			ld	(hl),4eh
+			ld	a,b8h
+			sbc	a,e
+			inc	d
+			ret	c
+			cp	e
+			rra
+			ld	(hl),l
+			pop	af
+			ld	l,b
+			daa
+			dec	h
+			inc	b
+			ld	c,e
+			cp	h
+			call	po,La596
+			inc	h
+			jp	z,L27d2
+			ld	l,a
+			scf
+			ld	e,a
+			jp	nz,Lc328
+			sub	d
+			xor	b
+			ret	c
+			adc	a,(hl)
+			ld	h,l
+			ret	nc
+			di
+			pop	bc
+			jp	pe,Lb3d0
+			ld	(hl),h
+			ld	e,l
+			rst	28h
+			adc	a,a2h
+			ret	nz
+			xor	l
+			cp	c
+			add	a,b
+			ld	h,c
+			ld	(hl),l
+			ld	e,l
+			daa
+			ld	(ab41h),a
+			add	a,(hl)
+			xor	d
+			sbc	a,b
+			ld	l,c
+			ld	a,(de)
+			jp	nz,Le850
+			ld	(a2b3h),hl
+			jp	po,L29db
+			cp	e
+			push	hl
+			adc	a,c
+			and	l
+			ld	b,d
+			push	af
+			halt
+			ld	hl,(ac59h)
+			jr	c,L5d93
+			jr	nz,L5dec
+			ld	d,e
+			ld	e,c
+			pop	bc
+			ret	z
+			xor	(hl)
+			call	m,L73fb
+			sub	e
+			ld	(hl),d
+			ld	(hl),h
+			inc	sp
+			inc	d
+			ld	e,b
+			xor	ixh *
+			jp	pe,L134b
+			ld	d,a
+			dec	hl
+			ld	e,d
+			ld	d,e
+			ld	sp,1609h
+			or	e
+			ret	pe
+			nop (2x) *
+			rla
+			ld	a,h
+			rst	18h
+			sub	b
+			cp	c3h
+			ld	h,l
+			ld	hl,(ae92h)
+			and	5ch
+			ld	a,e
+			rst	28h
+			ld	(de),a
+			halt
+			ld	e,h
+			cp	b
+			ccf
+			ld	b,l
+			or	5eh
+			ld	l,(hl)
+			ld	c,l
+			ld	c,a
+			ld	e,b
+			jr	c,L5db6
+			call	c,Le83c
+			sbc	a,h
+			rst	28h
+			call	nz,L4877
+			ld	d,h
+			sub	b
+			xor	(hl)
+			ld	de,ae0dh
+			ld	l,6ch
+			pop	bc
+			daa
+			ld	a,d
+			ex	af,af'
+			ld	b,a
+			cp	d
+			ld	(hl),b9h
+			ld	e,c
+			push	hl
+			and	d
+			ld	l,h
+			ld	l,d
+			inc	d
+			call	m,L1907
+			cp	l
+			push	hl
+			ret	z
+			adc	a,(hl)
+			and	h
+			or	5ah
+			inc	l
+			nop (2x) *
+			cpl
+			rst	20h
+			jp	pe,Lfa03
+			add	hl,hl
+			dec	(hl)
+			rst	10h
+			ccf
+			ld	c,b
+			or	(hl)
+			ld	(ef68h),hl
+			ld	(hl),l
+			xor	l
+			sbc	a,a
+			ld	d,c
+			cp	(hl)
+			ld	hl,38a2h
+			ret	z
+			ld	d,l
+			sbc	a,b
+			djnz	L5de3
+			cp	c
+			rrca
+			out	(34h),a
+			ld	l,c
+			push	de
+			ld	h,c
+			ld	a,h
+			inc	e
+			ld	l,d
+			sub	c
+			ld	l,a
+			sbc	a,a
+			ld	h,h
+			inc	de
+			ld	d,b
+			jr	nc,L5ea9
+			rst	18h
+			ld	l,(hl)
+			sub	31h
+			jr	c,L5df2
+			ld	a,c
+			out	(a5h),a
+			sub	c
+			adc	a,c
+			jr	c,L5dec
+			exx
+			cp	b
+			dec	bc
+			adc	a,h
+			ld	c,a
+			ld	a,a
+			jr	nz,L5e7f
+			xor	h
+			ei
+			ld	d,7bh
+			ret	nz
+			ld	e,e
+			ld	d,l
+			jp	p,L830b
+			rst	30h
+			ld	a,(bc)
+			rst	00h
+			ld	l,c
+			adc	a,c
+			jp	p,Ld7ae
+			call	c,L98be
+			ld	e,(hl)
+			or	b
+			jp	z,L64dd
+			call	p,L3d72
+			and	a
+			ld	hl,(6f2fh)
+			ld	e,e
+			ld	b,d
+			dec	b
+			ld	e,l
+			and	c
+			sub	a
+			jr	c,L5ebb
+			ld	de,7cc1h
+			call	pe,L0ec7
+			rlca
+			rst	38h
+			inc	d
+			ld	sp,hl
+			jp	nz,L823b
+			and	(hl)
+			ld	h,(hl)
+			ld	d,c
+			call	p,Le368
+			xor	a
+			ld	c,l
+			adc	a,c
+			dec	sp
+			rst	10h
+			ld	sp,e0e6h
+			jp	L17b6
+			db	0ah
+			ld	l,l
+			di
+			ld	e,(hl)
+			ex	(sp),hl
+			nop (2x) *
+			ld	a,(hl)
+			dec	(hl)
+			rlca
+			add	a,abh
+			add	a,b
+			ld	b,c
+			ld	e,(hl)
+			ld	e,l
+			exx
+			add	a,d
+			ld	hl,034bh
+			rst	10h
+			call	pe,L2a95
+			rlca
+			ret	nz
+			xor	(hl)
+			adc	a,h
+			sub	c
+			ld	a,l
+			rst	18h
+			rst	00h
+			ld	b,(hl)
+			call	po,L3809
+			ld	(hl),b
+			ret	nc
+			and	h
+			and	e
+			ld	l,e
+			xor	c
+			ld	a,(de)
+			cp	c
+			ld	l,(hl)
+			ld	e,d
+			ld	l,a
+			dec	bc
+			or	(hl)
+			ld	b,8bh
+			ld	b,d3h
+			rst	00h
+			ld	l,b
+			sub	c
+			call	L59a3
+			rst	18h
+			ld	a,a
+			jp	p,L51b3
+			ld	b,b
+			or	d
+			and	c
+			adc	a,h
+			dec	(hl)
+			sbc	a,h
+			dec	sp
+			sbc	a,a
+			sbc	a,h
+			nop (2x) *
+			sub	(hl)
+			ret	z
+			rst	18h
+			inc	de
+			adc	a,l
+			ld	a,a
+			rst	08h
+			ex	(sp),hl
+			ld	a,(de)
+			daa
+			ld	a,(bc)
+			djnz	L5eb1
+			sbc	a,ixh *
+			adc	a,h
+			xor	e
+			ld	(hl),e
+			sbc	a,b
+			cp	h
+			ld	(hl),b
+			xor	b
+			rst	20h
+			ld	d,e
+			dec	sp
+			push	hl
+			add	a,c
+			ld	l,b
+			ld	c,e
+			ld	l,l
+			xor	(hl)
+			jp	nc,Ldff7
+			rst	28h
+			xor	d
+			nop
+			add	hl,bc
+			dec	hl
+			ld	(hl),c
+			ld	h,c
+			ld	(hl),b3h
+			cp	ebh
+			inc	e
+			add	hl,bc
+			pop	de
+			sbc	a,e
+			or	a
+			xor	e
+			rst	18h
+			ld	d,(hl)
+			ld	a,h
+			ld	e,77h
+			cp	b
+			rla
+			sub	c
+			ld	l,h
+			add	hl,de
+			pop	af
+			ld	h,b
+			add	a,b
+			ld	l,b
+			adc	a,h
+			ld	c,b
+			ret	pe
+			ld	(hl),cdh
+			ei
+			or	b
+			ld	a,(1737h)
+			or	a
+			sbc	a,a
+			jr	c,L5f6c
+			ccf
+			adc	a,d
+			call	nz,L7dbd
+			xor	b
+			ld	h,c
+			rlc	c
+			cp	d
+			ld	l,20h
+			xor	e
+			call	c,L52e9
+			sbc	a,a
+			rst	10h
+			ld	b,b
+			ld	e,a
+			ld	a,(97e7h)
+			dec	l
+			and	b
+			di
+			and	(hl)
+			sbc	a,h
+			ret
+			db	fch,5bh,01h,cch
+			inc	h
+			ld	a,ffh
+			inc	bc
+			dec	a
+			daa
+			sbc	a,h
+			xor	e
+			dec	l
+			sub	75h
+			ld	c,e
+			jp	(hl)
+			db	beh,87h,00h,e2h,7dh
+			ld	c,e
+			or	h
+			jp	L306d
+			db	cah,c9h,f1h,bbh,f1h,efh,3ch,0ch
+			db	f2h,34h,1fh,45h,3fh,44h,e5h,c1h
+			db	d8h,cdh,94h,7eh,b1h,afh,6bh,beh
+			db	94h,15h,e0h,8dh,cch,c3h,72h,94h
+			db	78h,4dh,66h,96h,49h,0bh,0ah,26h
+			db	38h,ach,7fh,e0h,00h,5eh,4eh,87h
+			db	7fh,2eh,efh,77h,c6h,dfh,8bh,f4h
+			db	6ch,adh,33h,22h,3fh,2ah,b1h,cbh
+			db	6ah,a6h,04h,56h,b0h,cch,ceh,f7h
+			db	c5h,91h,21h,6ch,88h,48h,fdh,6ch
+			db	4bh,13h,05h,6dh,46h,eah,a5h,dbh
+			db	6fh,8ah,19h,63h,b9h,e4h,e9h,42h
+			db	18h,a0h,19h,e1h,afh,cah,bfh,4fh
+			db	3fh,6eh,c4h,e7h,a6h,f4h,2bh,a2h
+			db	e9h,99h,bah,c3h,e2h,56h,24h,f2h
+			db	66h,9ch,18h,84h,40h,4eh,f9h,eeh
+			db	29h,4fh,03h,c0h,20h,7fh,09h,29h
+			db	1bh,5bh,1bh,1ah,ebh,dfh,97h,1dh
+			db	0dh,25h,0ch,9ah,30h,deh,1ch,4eh
+			db	86h,2ah,b1h,a4h,3bh,ddh,c1h,10h
+			db	b9h,32h,8eh,5ah,b2h,25h,c7h,c1h
+			db	4fh,fbh,a8h,d1h,f6h,d9h,5bh,56h
+			db	4ah,50h
+			ld	d,b
+			ld	e,(hl)
+			ld	b,a
+			add	a,04h
+			sub	c
+			rrca
+			dec	sp
+			pop	bc
+			ld	l,c
+			dec	de
+			dec	l
+			rst	00h
+			scf
+			jp	nz,La7dd
+			ld	hl,7d09h
+			inc	c
+			pop	de
+			add	a,b
+			ld	b,bch
+			sub	l
+			cp	e
+			call	z,L3f8e
+			ld	c,0dh
+			ld	a,l
+			ex	af,af'
+			jr	c,L6051
+			ld	d,(hl)
+			ld	(hl),a
+			or	l
+			ld	a,b
+			or	l
+			pop	bc
+			ld	(hl),d
+			cp	(hl)
+			ld	sp,92f3h
+			adc	a,c
+			ld	b,l
+			or	c
+			adc	a,l
+			or	b
+			ld	(hl),e
+			inc	(hl)
+			ld	(hl),c
+			ccf
+			dec	de
+			ld	c,b
+			ccf
+			push	de
+			rr	d
+			sub	e
+			dec	(hl)
+			xor	5fh
+			ld	d,d
+			inc	a
+			add	a,d
+			add	a,a
+			nop (2x) *
+			sbc	a,l
+			ld	e,l
+			or	d
+			ld	b,h
+			sub	d
+			cp	90h
+			cp	l
+			jr	nz,L604a
+			ld	a,e
+			ld	(hl),l
+			ld	h,h
+			ld	(4cc7h),hl
+			ld	c,iyl *
+			rst	08h
+			call	p,L99ba
+			ld	(hl),c
+			ld	e,(hl)
+			jp	p,La3eb
+			ld	a,d
+			daa
+			ld	(hl),fch
+			ld	d,d
+			ld	a,20h
+			srl	l
+			rst	10h
+			ret	p
+			add	a,a
+			inc	l
+			or	d
+			cp	c
+			ld	d,62h
+			call	z,L2d27
+			ld	e,e
+			ret	p
+			ld	b,a
+			rlca
+			add	hl,de
+			sub	a
+			scf
+			and	b
+			xor	c
+			push	hl
+			ld	h,l
+			sbc	a,(hl)
+			add	a,e
+			ld	a,(hl)
+			ld	d,(hl)
+			sub	d
+			jr	z,L60fc
+			sbc	a,(hl)
+			nop
+			pop	hl
+			halt
+			ld	(2523h),hl
+			ld	a,c
+			out	(38h),a
+			ld	b,l
+			ld	b,b
+			xor	h
+			add	a,(hl)
+			sub	(hl)
+			ld	(de),a
+			cp	15h
+			halt
+			ld	h,(hl)
+			ld	d,c
+			ld	(519ah),a
+			sbc	a,d
+			jr	nz,L60d4
+			ld	l,e
+			xor	l
+			add	a,h
+			ld	d,b
+			xor	d
+			add	hl,de
+			sbc	a,h
+			ld	a,h
+			pop	bc
+			ld	a,dbh
+			ld	b,(hl)
+			sub	h
+			and	b
+			or	c
+			ld	b,a
+			xor	c
+			rst	10h
+			ld	a,(7ed3h)
+			ld	e,e
+			ld	d,(hl)
+			ld	d,a
+			dec	c
+			add	hl,de
+			ld	(hl),c
+			inc	sp
+			rra
+			ld	h,h
+			xor	l
+			ld	h,(hl)
+			xor	h
+			ld	a,c
+			ld	(e0f5h),a
+			call	nc,Ld4e0
+			dec	e
+			cp	l
+			call	z,L7bce
+			adc	a,e
+			inc	a
+			ld	(hl),l
+			ld	iyl,iyl *
+			ld	d,d
+			ret	pe
+			ld	d,(hl)
+			or	c
+			ld	c,l
+			xor	l
+			rst	00h
+			jp	p,Lf7d8
+			rst	28h
+			ld	(hl),a
+			rrca
+			cp	l
+			ld	l,d
+			ld	(hl),25h
+			ld	a,(d479h)
+			ld	a,b
+			ld	c,(hl)
+			sub	h
+			and	(hl)
+			ld	b,(hl)
+			jp	c,L42c9
+			daa
+			ld	b,d
+			ld	e,2eh
+			xor	b
+			ld	l,6ch
+			ld	d,d
+			rst	10h
+			jp	(hl)
+			db	0dh,2fh,6bh,c0h,2ch,f1h,2dh,78h
+			db	03h,5fh,a0h,31h,46h,e8h,e9h,e3h
+			db	03h,d5h,65h,dbh,37h,a5h,53h,feh
+			db	beh,48h
+			ld	l,h
+			ld	e,l
+			inc	a
+			add	a,l
+			jp	p,L03e6
+			xor	l
+			call	nc,L5ba9
+			ld	h,e
+			and	d
+			call	pe,Lbd89
+			ei
+			add	a,b
+			ld	c,l
+			cp	1eh
+			jp	c,L5a20
+			ret	m
+			inc	h
+			or	l
+			ld	a,a
+			add	a,(hl)
+			dec	e
+			djnz	L60f7
+			inc	l
+			pop	af
+			sub	c
+			ld	h,l
+			ld	h,h
+			ld	b,c
+			ld	d,d
+			ld	a,e2h
+			cp	e
+			dec	a
+			ex	de,hl
+			rst	18h
+			cp	e
+			inc	a
+			ret	nz
+			xor	l
+			sbc	a,e
+			ld	hl,(b08bh)
+			ld	h,b
+			xor	c
+			rst	08h
+			pop	af
+			ld	(de),a
+			add	a,71h
+			xor	c
+			sbc	a,e
+			sbc	a,h
+			xor	e
+			inc	h
+			inc	d
+			ld	h,c
+			ld	hl,0530h
+			call	c,Lacdb
+			dec	h
+			inc	(hl)
+			ld	d,a
+			ex	de,hl
+			push	de
+			ex	de,hl
+			ld	d,h
+			add	a,d
+			ld	c,a
+			ld	d,a
+			dec	(hl)
+			dec	de
+			rst	18h
+			daa
+			xor	l
+			sub	b
+			nop
+			ld	a,d
+			dec	e
+			ld	b,e
+			cp	l
+			ld	c,b
+			ld	d,d
+			xor	a
+			ld	de,3817h
+			rst	18h
+			nop (2x) *
+			ld	d,a
+			rst	38h
+			xor	l
+			and	l
+			sbc	a,e
+			ret
+			db	aeh
+			adc	a,e
+			ld	e,c
+			ccf
+			ld	h,e
+			jr	c,L618c
+			ld	d,e
+			or	a
+			sbc	a,a
+			add	a,e
+			ld	d,b
+			inc	e
+			inc	c
+			rla
+			call	nc,L6250
+			ld	a,(de)
+			push	af
+			or	c
+			sbc	a,h
+			pop	de
+			halt
+			inc	de
+			and	(hl)
+			ld	a,(5dd8h)
+			add	hl,hl
+			or	a
+			inc	hl
+			ld	e,l
+			ld	h,a
+			or	a
+			cp	f4h
+			ld	b,e
+			cp	h
+			exx
+			dec	b
+			ld	(9540h),a
+			add	hl,hl
+			add	hl,bc
+			xor	c
+			or	l
+			ld	d,a
+			rst	30h
+			ld	b,e
+			ei
+			dec	d
+			dec	sp
+			dec	(hl)
+			rst	30h
+			dec	h
+			cp	e
+			adc	a,(hl)
+			dec	h
+			nop (2x) *
+			sbc	a,c8h
+			nop
+			ld	d,h
+			ld	d,52h
+			in	a,(b0h)
+			sub	b
+			dec	b
+			sub	a
+			ret
+			db	43h,3ah,72h,a1h,10h,96h,4ah,87h
+			db	9dh,30h,26h,4dh,30h,bch,5ch,7ah
+			db	b6h,4eh,94h,9ch,d0h,26h,62h,84h
+			db	87h,6ah,e8h,c3h,28h,c3h,bfh,c7h
+			db	f0h,0ch,58h,ddh,91h,6ah,f2h,8dh
+			db	03h,94h,62h,bbh,47h,6bh,1fh,a2h
+			db	1ah,26h,07h,6dh,49h,80h,59h,d0h
+			db	72h,f7h,75h,3ah,66h,59h,49h,a4h
+			db	1eh,2ch,8ch,6dh,07h,0fh
+			rst	08h
+			ld	(hl),d
+			out	(99h),a
+			ld	h,(hl)
+			rst	18h
+			or	b8h
+			sub	25h
+			ld	b,h
+			ld	h,a
+			pop	hl
+			ld	a,h
+			or	b
+			ld	c,a
+			xor	c
+			nop (2x) *
+			inc	a
+			ei
+			ld	d,l
+			add	a,e
+			inc	hl
+			dec	h
+			jp	Lbd48
+			db	32h,a5h,4ah,47h,0fh,3dh,c3h,58h
+			db	a4h
+			ld	b,f9h
+			add	a,e
+			ret	p
+			sub	(hl)
+			adc	a,c
+			ld	l,(hl)
+			ld	a,2dh
+			and	a
+			sub	e
+			pop	bc
+			pop	af
+			ret	nc
+			or	b
+			ret	nz
+			jr	L6246
+			db	d2h
+			call	m,L89a7
+			inc	e
+			ret	po
+			ld	e,(hl)
+			add	a,a
+			inc	hl
+			ld	(hl),h
+			ld	a,a
+			sub	l
+			inc	c
+			ld	c,a
+			dec	l
+			sbc	a,c
+			sub	h
+			dec	hl
+			sub	(hl)
+			nop
+			ex	de,hl
+			ex	af,af'
+			ld	l,l
+			pop	de
+			add	a,h
+			ld	c,b
+			xor	(hl)
+			sbc	a,d
+			sub	20h
+			cp	cah
+			xor	c
+			sub	64h
+			adc	a,adh
+			ld	(9a7dh),hl
+			di
+			cpl
+			inc	de
+			rra
+			ld	l,b
+			jr	z,L626a
+			push	hl
+			or	e
+			xor	b
+			ex	(sp),hl
+			and	b
+			inc	(hl)
+			dec	(hl)
+			ld	c,e3h
+			dec	b
+			add	hl,hl
+			ld	h,a
+			call	nz,L7d1c
+			ld	a,12h
+			ld	l,l
+			xor	06h
+			rla
+			dec	b
+			ld	b,e
+			adc	a,(hl)
+			or	(hl)
+			ld	(hl),d
+			adc	a,l
+			add	a,a
+			and	(hl)
+			adc	a,c
+			ld	l,c
+			rst	18h
+			sub	b
+			sub	b
+			ld	l,c
+			jp	p,Lcbe5
+			ld	sp,hl
+			ret	m
+			inc	c
+			ret	m
+			ex	de,hl
+			jr	nc,L62db
+			dec	(hl)
+			or	b
+			ret	nz
+			or	h
+			ld	(bc),a
+			sub	c
+			pop	bc
+			ld	l,c
+			add	a,a
+			rlca
+			call	Lcf8f
+			ld	d,a
+			dec	bc
+			ld	a,c
+			sub	17h
+			jr	L62c4
+			db	3dh,15h,cah,79h,7dh,71h,f2h,80h
+			db	30h,5ah,39h,b2h,25h,dbh,5eh,7bh
+			db	9ch,70h,d0h,4fh,8ch,ddh,c1h,71h
+			db	4fh,82h,2eh,7eh,09h,0dh,b7h,edh
+			db	6ah,cdh,76h,c6h,26h,62h,f2h,f4h
+			db	fah,46h,2bh,06h,99h,beh,0ah,e5h
+			db	ebh,27h,bch,5eh,efh,9ch,b0h,1ch
+			db	61h,e0h,edh,f6h,a2h,11h,04h,b2h
+			rst	30h
+			ld	h,7fh
+			or	abh
+			ld	a,c
+			ld	hl,(50b6h)
+			di
+			ld	(hl),c
+			cp	b
+			dec	e
+			ld	b,a
+			sbc	a,c
+			jp	m,Le6bb
+			ld	iyl,a *
+			xor	(hl)
+			dec	d
+			or	d
+			ld	b,6fh
+			exx
+			pop	bc
+			cp	a
+			ld	d,b
+			di
+			inc	b
+			ld	a,(de)
+			ld	c,b
+			srl	e
+			jp	z,L9214
+			ld	(f125h),a
+			dec	h
+			or	2fh
+			adc	a,c
+			dec	l
+			jr	nc,L63d3
+			ld	d,e
+			ld	l,d
+			ld	h,a
+			ex	de,hl
+			ex	de,hl
+			nop (2x) *
+			xor	a
+			ld	a,(bc)
+			ld	a,a
+			ld	c,d
+			ld	e,c
+			adc	a,h
+			inc	d
+			or	bbh
+			ld	l,b
+			inc	h
+			jp	nz,Ld7a8
+			and	c5h
+			dec	a
+			adc	a,b
+			sbc	a,(hl)
+			sbc	a,48h
+			ld	h,b
+			ld	c,a
+			ld	d,b
+			ld	c,a
+			ld	(hl),d
+			ld	l,0bh
+			rst	00h
+			call	pe,L4c19
+			ld	l,c
+			inc	b
+			adc	a,e
+			xor	a
+			ld	(hl),d
+			inc	b
+			ld	h,66h
+			ld	b,c
+			add	a,h
+			dec	c
+			add	a,(hl)
+			sub	a
+			add	a,59h
+			xor	c
+			add	a,d
+			rst	10h
+			jp	(hl)
+			db	bah,12h,b4h,c9h,9eh,6bh,82h,43h
+			db	2ah,4bh,4dh,88h,d0h,23h,b7h,deh
+			db	edh,bfh,63h,0ah,70h,bdh,1fh,8eh
+			db	79h,67h,ceh,a0h,f3h,bch,b2h,d3h
+			db	2bh,88h,55h,a2h,55h,55h,84h,fbh
+			db	12h,5eh,01h,deh,8dh,b7h,0ch
+			ret	p
+			ld	b,b
+			sub	e
+			ld	a,(bc)
+			ld	d,l
+			cp	e
+			ld	e,b
+			jr	L63ff
+			db	1bh,4fh,e7h,21h,7ah
+			or	e
+			sub	d
+			ld	h,4ah
+			ex	de,hl
+			add	a,c
+			ld	d,h
+			ld	e,(hl)
+			jp	L64fc
+			db	a3h,e1h,9fh,83h,b6h,47h,3bh,68h
+			db	47h,5fh,b2h,63h,d3h,f9h,b4h,f9h
+			db	29h,00h,dbh,1fh,2fh,96h,3eh,cah
+			db	7ch,f2h,cfh
+			ld	a,h
+			ld	e,c
+			ld	l,b
+			outd
+			inc	(hl)
+			rrc	d
+			cp	a
+			inc	d
+			rrca
+			ret	m
+			ld	d,b
+			ld	sp,hl
+			or	e
+			ld	c,e
+			sbc	a,h
+			ld	hl,82ebh
+			ld	e,b
+			jr	nc,L63db
+			dec	sp
+			jp	nc,Le190
+			ini
+			add	a,h
+			ld	d,a
+			rst	28h
+			add	hl,bc
+			ld	d,(hl)
+			call	m,Lc920
+			and	c
+			ld	(hl),d
+			or	d
+			dec	h
+			scf
+			jr	nz,L63c5
+			ld	(0e96h),hl
+			ret
+			db	8bh,8dh,dfh,2bh,20h,ach,e2h,67h
+			db	a5h,0ch,f8h,5fh,fbh,dah,dch,3ah
+			db	1eh,2eh,53h,31h,2ah,1ah,afh,3bh
+			rst	30h
+			rst	10h
+			xor	l
+			sbc	a,c
+			sub	d
+			cp	e
+			add	a,e
+			ld	(hl),l
+			sub	e
+			sub	d
+			sub	h
+			ld	l,96h
+			pop	hl
+			ld	b,l
+			adc	a,l
+			ret	m
+			ld	h,a
+			push	bc
+			or	e9h
+			rst	08h
+			sbc	a,afh
+			dec	a
+			sub	e
+			inc	sp
+			call	pe,L01ea
+			add	a,(hl)
+			ld	l,a
+			ld	h,a
+			ld	d,a
+			ld	(hl),c
+			xor	b
+			ld	b,e
+			pop	hl
+			cp	a
+			rlca
+			ld	sp,hl
+			ret	c
+			ld	(hl),e
+			call	po,L5110
+			inc	e
+			dec	b
+			ld	d,(hl)
+			ld	l,b
+			or	h
+			inc	h
+			ld	a,d
+			add	a,54h
+			add	hl,sp
+			ld	h,l
+			ld	c,68h
+			halt
+			adc	a,d
+			inc	l
+			ex	de,hl
+			adc	a,a
+			sbc	a,d
+			dec	d
+			ld	b,(hl)
+			call	nz,La78d
+			adc	a,d
+			call	c,L3cc1
+			pop	hl
+			rst	08h
+			ld	h,h
+			ld	c,h
+			jp	po,La527
+			ld	de,97d8h
+			pop	hl
+			call	c,Ld17d
+			sbc	a,b
+			ld	e,e
+			ld	(88a0h),hl
+			call	m,L7185
+			ld	c,b
+			ld	a,d
+			call	po,Lbef6
+			xor	l
+			inc	a
+			call	po,L34b9
+			cp	c
+			ld	a,(hl)
+			ld	h,l
+			call	L5732
+			or	b
+			call	m,Le98b
+			ld	h,a
+			or	d
+			add	a,a
+			jp	po,L4901
+			ld	h,d
+			ld	d,7ah
+			call	po,Lcdaa
+			or	h
+			ld	l,l
+			ld	h,d
+			dec	c
+			sbc	a,b
+			rrca
+			add	a,d
+			add	hl,bc
+			sub	a
+			ld	(8340h),hl
+			ld	a,h
+			sub	b
+			xor	e
+			sbc	a,b
+			inc	d
+			ld	b,(hl)
+			ld	l,h
+			ld	a,(hl)
+			ld	e,(hl)
+			ld	h,c
+			ld	a,(bc)
+			ld	b,l
+			call	p,L754e
+			ld	(hl),c
+			ld	a,(bc)
+			ld	a,e
+			and	l
+			pop	de
+			sub	l
+			ld	h,e
+			ret	c
+			xor	b
+			ld	d,e
+			or	c
+			ld	(hl),b
+			ld	b,h
+			ld	c,(hl)
+			sub	c
+			nop (2x) *
+			jp	nz,L0ddc
+			add	a,b
+			dec	h
+			ld	l,c
+			ld	d,l
+			inc	de
+			ld	a,b
+			nop (2x) *
+			dec	c
+			ld	e,e
+			ld	h,b
+			ld	(de),a
+			jp	p,Lcbfa
+			jp	po,L57db
+			xor	(hl)
+			inc	d
+			djnz	L6548
+			ld	a,(61d8h)
+			call	p,Ld7cf
+			ld	bc,34e5h
+			add	a,(hl)
+			push	bc
+			ccf
+			ld	d,a
+			xor	h
+			ld	a,e
+			ret	p
+			xor	e
+			dec	h
+			ld	sp,bca1h
+			adc	a,e
+			sbc	a,d
+			sub	h
+			call	nz,L72c7
+			ld	a,d
+			call	nz,L5386
+			ccf
+			and	l
+			adc	a,(hl)
+			adc	a,b
+			ld	a,a
+			ld	d,(hl)
+			ld	a,b
+			ex	af,af'
+			and	b
+			cp	l
+			ld	h,a
+			pop	af
+			add	a,(hl)
+			rst	30h
+			dec	h
+			adc	a,(hl)
+			inc	l
+			rst	38h
+			jp	nz,Lbe52
+			sub	e
+			inc	l
+			ret
+			db	54h,38h,d3h,04h,29h,dfh,9eh,b4h
+			db	fch,0ch,21h,b8h
+			sbc	a,c
+			and	(hl)
+			ld	b,c
+			add	a,e
+			cp	c
+			cp	h
+			ld	c,c
+			ld	c,c
+			dec	e
+			ex	(sp),hl
+			add	a,d
+			ld	a,l
+			and	b
+			ld	c,e
+			call	Lcb51
+			or	d
+			xor	h
+			cp	ebh
+			rst	20h
+			jr	nz,L6550
+			ld	h,b
+			ld	a,b
+			adc	a,c
+			sbc	a,f7h
+			xor	h
+			ld	b,l
+			add	a,a
+			sub	l
+			rst	18h
+			jp	(hl)
+			db	60h,d6h,48h,e1h,74h,70h,37h,dch
+			db	40h,03h,74h,a5h,f4h,30h,abh,35h
+			db	0fh,e8h,f6h,66h,22h,72h,8eh,b1h
+			db	56h,d2h,6fh,05h,77h,a4h,53h,9bh
+			jp	pe,L9d55
+			xor	c
+			cp	l
+			in	a,(7dh)
+			ld	e,(hl)
+			cp	(hl)
+			ld	h,l
+			xor	dbh
+			rst	38h
+			add	hl,hl
+			add	a,e
+			rst	30h
+			djnz	L6556
+			and	d
+			xor	l
+			cp	(hl)
+			rst	18h
+			ld	l,60h
+			ret	nz
+			di
+			ld	(bc),a
+			add	a,h
+			sbc	a,(hl)
+			push	bc
+			nop (2x) *
+			ccf
+			xor	h
+			or	l
+			call	c,L1064
+			ld	a,a
+			call	z,La022
+			ld	b,l
+			push	af
+			ld	a,(2cbdh)
+			ld	c,l
+			ld	a,b
+			ld	h,h
+			rst	18h
+			inc	(hl)
+			call	p,L0bbf
+			ld	d,l
+			sub	l
+			sbc	a,d
+			inc	l
+			ld	e,e
+			add	hl,de
+			ld	b,b
+			ld	(hl),l
+			inc	a
+			push	af
+			ld	b,e
+			add	hl,hl
+			ld	d,d
+			cp	e
+			jp	nc,L9daa
+			ret
+			db	f9h,ddh,ech,b4h,a8h,49h,39h,4bh
+			db	6fh
+			ld	d,(hl)
+			ld	a,h
+			dec	e
+			ld	c,l
+			sbc	a,44h
+			sub	a
+			ex	(sp),hl
+			sbc	a,(hl)
+			ex	(sp),hl
+			jp	z,Lc622
+			sub	d
+			call	z,L4a20
+			ld	d,l
+			rlca
+			sbc	a,l
+			xor	d
+			ld	c,a
+			cp	e
+			ld	e,a
+			sub	b
+			add	a,c
+			add	a,d
+			adc	a,(hl)
+			add	a,b
+			ld	c,c
+			add	a,c6h
+			ld	a,(hl)
+			inc	e
+			ex	de,hl
+			inc	a
+			rla
+			dec	de
+			ld	b,b
+			ld	e,(hl)
+			ld	h,9bh
+			dec	de
+			nop (2x) *
+			adc	a,b
+			ld	(bc),a
+			scf
+			ld	d,c
+			add	hl,bc
+			daa
+			ld	e,e
+			cp	(hl)
+			cp	c
+			cpl
+			ld	sp,ba4eh
+			ld	(hl),l
+			add	a,9bh
+			sbc	a,c
+			jp	pe,L6184
+			ld	l,(ix + ach)
+			call	z,L36eb
+			sbc	a,h
+			ld	l,f8h
+			ld	d,a
+			ld	b,h
+			ld	(de),a
+			ld	(bc),a
+			rst	38h
+			ld	e,l
+			rst	00h
+			and	h
+			ld	h,b
+			dec	sp
+			ld	c,d
+			cp	14h
+			inc	b
+			inc	b
+			sbc	a,e
+			ret	nc
+			and	c
+			xor	e
+			call	z,L182d
+			inc	e
+			ld	d,h
+			call	p,L4819
+			and	l
+			add	a,b
+			xor	e
+			ld	l,h
+			call	nc,L03f8
+			ld	(3948h),hl
+			or	e
+			push	hl
+			ld	a,b
+			di
+			sub	(hl)
+			sub	(hl)
+			inc	a
+			xor	b
+			jp	z,L114b
+			xor	a3h
+			ld	e,h
+			ld	b,a
+			cp	c
+			jp	z,L223b
+			cp	l
+			ret	po
+			inc	de
+			jp	pe,L1fe0
+			jp	m,Lba24
+			ld	e,b
+			jp	L5be2
+			db	06h,0fh,21h,29h,9dh,e0h,a5h,f2h
+			db	bfh,6bh,3dh,a2h,61h,09h,83h,e9h
+			db	deh,9dh,67h,2ch,bch,dch,94h,30h
+			db	0eh,e2h,4dh,f5h,39h,cah,97h,afh
+			db	f8h,7bh,03h,98h,89h,32h,31h,7bh
+			db	a1h,c9h,6dh,c8h,76h,c7h,dbh,1ah
+			db	f5h
+			ld	b,l
+			ld	b,(hl)
+			inc	e
+			ld	b,(hl)
+			ld	d,a
+			rlca
+			xor	a
+			rra
+			nop (2x) *
+			xor	d
+			ld	h,(hl)
+			jp	c,La1ae
+			and	l
+			ld	h,e
+			and	d
+			ld	(de),a
+			rst	38h
+			ld	(hl),l
+			cpl
+			ld	d,c
+			ld	(hl),d
+			or	h
+			dec	e
+			add	a,l
+			add	a,b
+			ld	l,c
+			ld	e,a
+			or	56h
+			adc	a,h
+			rlca
+			and	e9h
+			rst	38h
+			push	hl
+			call	pe,Ld3eb
+			sbc	a,e
+			call	z,L7b0c
+			ret	pe
+			add	hl,bc
+			and	9fh
+			ld	l,(hl)
+			rlca
+			jp	pe,L4bd5
+			ld	b,a
+			inc	a
+			ld	d,(hl)
+			ld	a,2bh
+			add	a,l
+			ld	sp,hl
+			inc	sp
+			and	e
+			pop	hl
+			ld	a,c
+			ld	a,(bc)
+			call	c,Lf5cb
+			ld	e,l
+			push	de
+			halt
+			cp	b
+			ld	e,fch
+			add	a,a
+			add	a,(hl)
+			ld	e,h
+			ld	c,l
+			sub	h
+			and	l
+			jp	z,L036b
+			call	nc,L7358
+			dec	de
+			dec	de
+			or	h
+			inc	e
+			xor	h
+			jp	pe,Lbfc9
+			inc	c
+			ld	c,b
+			ld	d,c
+			adc	a,(hl)
+			ld	e,b
+			add	a,b
+			xor	(hl)
+			nop
+			sub	h
+			ld	sp,hl
+			or	(hl)
+			sub	cch
+			ld	de,14c6h
+			ld	h,l
+			ld	de,4e93h
+			dec	d
+			ld	c,l
+			sub	d
+			daa
+			ld	c,d
+			call	pe,Lc056
+			or	l
+			ld	a,e
+			add	a,h
+			pop	bc
+			ld	d,b
+			ld	a,a
+			ld	d,c
+			ld	e,l
+			xor	h
+			ld	h,d
+			xor	h
+			add	a,h
+			out	(7eh),a
+			call	nz,L21e9
+			rlca
+			ld	b,(hl)
+			ld	h,c
+			sub	a
+			ld	l,c
+			dec	bc
+			pop	de
+			ld	bc,8ab8h
+			push	bc
+			ex	(sp),hl
+			call	nc,L86a8
+			rst	20h
+			xor	b
+			ld	hl,038dh
+			call	m,L8f15
+			ld	(hl),c
+			and	e
+			call	z,Lf84e
+			dec	l
+			ld	a,60h
+			ld	d,(hl)
+			adc	a,e
+			or	22h
+			inc	a
+			ld	e,iyh *
+			call	z,L9d8e
+			ld	a,b7h
+			ld	e,(hl)
+			halt
+			jr	nc,L67a9
+			ld	e,a
+			cpl
+			xor	b
+			ld	h,8eh
+			rlca
+			jp	c,Ledce
+			ret	p
+			call	pe,Ld7f3
+			ld	a,(bc)
+			ld	l,h
+			add	a,a
+			djnz	L6736
+			jp	po,L1a6e
+			ld	d,b
+			ld	a,h
+			ld	(hl),c
+			adc	a,l
+			inc	l
+			xor	l
+			ld	c,d
+			ld	a,iyh *
+			xor	c5h
+			ret	nz
+			ld	a,e
+			inc	l
+			ld	l,d
+			call	L128d
+			ld	hl,e2dfh
+			xor	h
+			call	p,L7f07
+			add	a,h
+			cp	c
+			ld	c,e
+			jr	nc,L67dd
+			ld	(de),a
+			jr	L6724
+			db	d8h,c3h,afh,1eh,50h,8eh,67h,e5h
+			db	53h,c9h,99h,5ch,a1h,84h,e6h,82h
+			db	92h,9dh,89h,08h,1fh,2ah,cah,5ch
+			db	54h,bfh,2ah,0dh,d2h,2dh
+			jr	nc,L6813
+			dec	h
+			or	d
+			jp	z,L83aa
+			xor	h
+			or	a
+			ld	h,e
+			ld	e,b
+			inc	(hl)
+			xor	70h
+			sub	(hl)
+			jp	Lb873
+			db	3dh,bah,efh,84h,48h,edh,0fh,1dh
+			db	efh,09h,6ah,bdh,74h,e7h,37h,75h
+			db	97h,18h,39h,f2h,c5h,10h,1fh,9bh
+			db	a1h,99h,30h,18h,41h,2bh,53h,7ah
+			db	20h,f6h
+			in	a,(f3h)
+			djnz	L6829
+			ld	(a20eh),a
+			and	h
+			add	a,d
+			dec	hl
+			dec	hl
+			xor	e
+			dec	h
+			inc	l
+			ld	c,c
+			or	d
+			xor	iyl *
+			call	c,L6c4b
+			ld	hl,177bh
+			cp	d
+			ld	d,c
+			inc	(hl)
+			ld	h,cch
+			ld	e,8dh
+			and	d
+			add	a,l
+			call	pe,L89db
+			xor	b
+			adc	a,c
+			add	a,(hl)
+			sbc	a,c
+			add	hl,hl
+			rlca
+			or	e
+			add	a,b
+			or	c
+			cp	d
+			inc	l
+			add	a,b
+			and	b
+			ld	d,l
+			ld	a,h
+			ld	a,(bc)
+			push	bc
+			ld	a,b
+			inc	e
+			or	c
+			xor	b
+			cp	c
+			ld	l,l
+			and	4ah
+			sub	h
+			ld	c,l
+			jr	z,L6899
+			in	a,(e6h)
+			ld	h,h
+			ld	e,14h
+			ld	(hl),c
+			xor	e
+			ld	(hl),a
+			ex	(sp),hl
+			ld	c,h
+			inc	(hl)
+			dec	c
+			ld	b,c
+			sbc	a,d
+			call	nz,L9443
+			sub	5ah
+			add	a,c
+			xor	a
+			ld	(hl),bch
+			dec	sp
+			ld	a,a
+			dec	e
+			xor	(hl)
+			and	e
+			ld	a,l
+			ex	(sp),hl
+			ld	a,b
+			rst	38h
+			and	e
+			ld	e,d
+			sub	c
+			ld	(hl),e
+			nop (2x) *
+			ld	a,e
+			rra
+			nop (2x) *
+			sbc	a,a
+			ld	c,h
+			sbc	a,(hl)
+			rst	20h
+			ld	c,(hl)
+			add	hl,bc
+			ld	(hl),c
+			add	a,86h
+			cp	l
+			add	a,e
+			ld	e,c
+			ld	a,h
+			sub	e
+			rrca
+			call	nz,L68df
+			rst	20h
+			ret	p
+			and	e
+			ld	d,(hl)
+			in	a,(22h)
+			ret	p
+			add	a,9ch
+			and	c
+			jr	nz,L68cf
+			ex	(sp),hl
+			ld	d,b
+			ld	l,e
+			sbc	a,h
+			rst	08h
+			ld	c,l
+			daa
+			inc	hl
+			ld	h,b
+			ld	c,b
+			ld	b,(hl)
+			jr	L6824
+			db	cch,49h,7ah,8ah,39h,7ah,cdh,d8h
+			db	1ch,9dh,e7h,32h,22h,a1h,5dh,e2h
+			db	69h,07h,33h,9bh,75h,24h,d9h,b7h
+			db	c2h,c8h,18h,61h,b7h,f0h,4dh,b9h
+			db	60h,dch,c5h,e6h,50h,7bh,77h,37h
+			ld	c,c
+			ld	e,a
+			ld	sp,1577h
+			ld	e,h
+			jp	L30c3
+			db	6eh,91h
+			jp	L8147
+			db	45h,6ch
+			ld	(hl),l
+			jr	nz,L68b6
+			ld	sp,hl
+			cp	a
+			ld	b,a
+			dec	(hl)
+			ld	(hl),e
+			nop
+			ld	b,b7h
+			ld	c,e
+			jr	nz,L690b
+			ld	d,b
+			rst	10h
+			nop (2x) *
+			xor	e
+			sub	a
+			ld	b,(hl)
+			ld	c,b
+			cp	a
+			ld	d,beh
+			ld	l,d
+			or	a
+			inc	e
+			add	a,(hl)
+			ld	(hl),c
+			ld	c,l
+			cpl
+			inc	hl
+			nop (2x) *
+			jr	z,L684d
+			ld	d,d
+			dec	hl
+			ld	e,h
+			ld	d,c
+			ld	h,a
+			cp	b
+			ld	h,2dh
+			dec	de
+			ld	d,c
+			ld	h,d
+			sbc	a,iyl *
+			ld	a,b
+			ld	a,(bc)
+			sbc	a,h
+			or	h
+			and	d
+			ret
+			ret	pe
+			pop	hl
+			ld	l,a
+			ei
+			add	a,c
+			and	c
+			sub	l
+			pop	hl
+			ld	l,(hl)
+			xor	c
+			ld	d,a
+			sub	e
+			or	e
+			push	bc
+			ld	a,a
+			ld	c,b
+			cp	l
+			add	a,d
+			add	hl,sp
+			adc	a,26h
+			cp	a
+			jp	c,L9f5f
+			ld	d,c
+			ld	l,d
+			ld	a,b
+			ld	c,a
+			xor	a
+			ld	d,c
+			ld	c,9eh
+			inc	de
+			call	po,Lace4
+			sub	b
+			ld	(hl),5bh
+			cp	e
+			ld	a,e
+			cp	l
+			or	a
+			adc	a,0dh
+			xor	b
+			jp	pe,L3405
+			inc	c
+			dec	c
+			ld	h,l
+			ld	(hl),h
+			cp	(hl)
+			or	b
+			and	69h
+			adc	a,(hl)
+			ld	a,h
+			nop (2x) *
+			add	a,b
+			dec	l
+			sbc	a,9ch
+			nop (2x) *
+			sbc	hl,bc
+			sub	c
+			call	z,Ld5b1
+			ld	b,c
+			jp	nz,L7108
+			jr	nc,L6919
+			dec	b
+			ld	a,d
+			ld	h,b9h
+			and	d
+			ret	po
+			rst	00h
+			cp	h
+			ld	a,h
+			add	hl,sp
+			or	h
+			ld	e,c
+			xor	d
+			jp	(hl)
+			db	23h,fch,39h,ceh,74h,7fh,deh,16h
+			db	5eh,56h,9eh,b4h,0ch,cfh,d8h,6bh
+			db	72h,b1h,76h,d7h,9bh,7eh,1bh,5eh
+			db	49h,22h,b1h
+			ld	c,b
+			inc	de
+			sub	c
+			ld	l,d
+			cp	10h
+			ret	nz
+			ld	e,a
+			pop	bc
+			call	m,Ld271
+			sub	l
+			or	h
+			inc	l
+			and	h
+			call	nz,L8d7e
+			ld	l,ffh
+			jp	c,L555b
+			inc	c
+			srl	a
+			ld	b,d
+			inc	h
+			adc	a,b
+			rst	08h
+			or	d
+			ld	e,d
+			ld	a,e
+			and	a
+			pop	hl
+			ld	(7cc4h),a
+			add	a,l
+			sub	b
+			ld	sp,hl
+			add	a,(hl)
+			call	nz,L9db1
+			ccf
+			ld	l,a
+			ld	h,0fh
+			cp	a
+			ld	(hl),b
+			adc	a,(hl)
+			call	L57b0
+			dec	a
+			ccf
+			xor	h
+			rra
+			sub	h
+			sbc	a,l
+			dec	bc
+			rst	38h
+			xor	b
+			ret	pe
+			ld	c,(hl)
+			ld	c,68h
+			sbc	a,c
+			and	b
+			ld	sp,hl
+			ld	sp,373ch
+			ld	e,(hl)
+			ret	pe
+			add	a,a
+			adc	a,c
+			ld	hl,(426ah)
+			ld	(hl),83h
+			ld	hl,149fh
+			ld	b,c
+			or	c
+			rst	38h
+			dec	h
+			ld	b,a
+			dec	de
+			ret	nz
+			and	l
+			rst	28h
+			ld	l,a
+			ld	a,h
+			out	(42h),a
+			ld	(de),a
+			cp	d
+			call	Le69e
+			call	L215f
+			ld	b,b
+			or	l
+			ld	de,8f56h
+			and	d
+			add	a,c
+			ld	l,5ch
+			sbc	a,h
+			jp	po,La7d8
+			call	pe,L1fc9
+			call	nc,L89a5
+			sub	l
+			ld	c,d
+			jr	z,L69b1
+			di
+			ld	e,d
+			jr	nc,L6a14
+			ld	d,e
+			cp	d
+			call	pe,Led88
+			or	h
+			pop	af
+			or	b
+			ld	d,d
+			ld	a,(bc)
+			ld	a,e1h
+			ld	e,c
+			or	d
+			add	a,c
+			ld	a,bah
+			adc	a,d
+			ld	b,c
+			adc	a,b
+			ld	c,a
+			add	hl,sp
+			xor	c
+			ret	po
+			ld	c,b
+			adc	a,h
+			ld	a,a
+			add	hl,de
+			dec	hl
+			adc	a,b
+			ld	d,bbh
+			jp	p,L424a
+			ld	(hl),b
+			ld	a,(de)
+			rst	00h
+			ld	d,e
+			jp	pe,Ld2ac
+			cp	c
+			add	a,l
+			ld	h,e
+			jp	L7d40
+			db	86h,8ch,9bh,42h
+			jr	z,L6a2e
+			dec	l
+			cp	d
+			ld	a,81h
+			ld	a,l
+			ld	b,(hl)
+			jr	z,L69e5
+			ld	a,h
+			adc	a,e
+			ret	c
+			ld	a,(bc)
+			call	nc,L85fc
+			sub	a
+			ld	d,5fh
+			sub	a
+			xor	b
+			jp	(hl)
+			db	d7h,80h,46h,b5h,5bh,31h
+			ret
+			db	efh,27h,88h,0ah,adh,8fh,d5h,52h
+			db	91h,d2h,03h,dch,e9h,0ch,a1h,c2h
+			db	94h,89h,a8h,34h,6bh,42h,67h,61h
+			db	d3h,0bh,1eh,ebh,3fh,50h,5dh,49h
+			db	7ch,25h,45h,48h,44h,efh,cbh,cah
+			db	26h,dah,d7h,8fh,33h,7bh,deh,2ah
+			db	bfh,e4h,66h,74h,57h,ech,f0h,24h
+			or	e
+			ld	d,h
+			ld	hl,(ab4dh)
+			call	p,Ldfc9
+			sbc	a,a
+			rst	20h
+			ld	c,d
+			rst	20h
+			add	hl,bc
+			ld	e,b
+			or	a
+			ld	a,d
+			ld	l,h
+			call	L7eb1
+			nop (2x) *
+			ld	a,c
+			pop	de
+			jp	nc,L8bc5
+			or	17h
+			adc	a,c
+			adc	a,7eh
+			sbc	a,e
+			ld	(hl),a
+			ld	c,c
+			pop	af
+			ld	b,e0h
+			ex	af,af'
+			xor	h
+			or	h
+			rla
+			ld	d,h
+			rst	38h
+			sbc	a,(hl)
+			jp	m,Ldee6
+			sub	a
+			ret	z
+			inc	h
+			out	(f8h),a
+			adc	a,l
+			sbc	a,c
+			ld	hl,(01feh)
+			inc	l
+			sbc	a,l
+			sub	l
+			out	(4bh),a
+			ld	a,(bc)
+			or	e
+			add	a,l
+			and	b
+			sub	b
+			ld	(hl),97h
+			exx
+			ld	c,(hl)
+			sbc	a,iyl *
+			jr	z,L6a67
+			ld	l,l
+			jp	nc,L2934
+			in	a,(b7h)
+			or	c
+			scf
+			pop	af
+			ex	(sp),hl
+			dec	a
+			dec	(hl)
+			rlca
+			ld	b,a
+			ret	m
+			dec	hl
+			inc	sp
+			cpl
+			ld	l,b
+			call	nc,L3d1e
+			and	h
+			ld	h,(hl)
+			sub	b
+			ld	de,8dd0h
+			xor	54h
+			ld	c,e
+			add	a,b
+			ld	c,l
+			call	po,L90c0
+			and	e
+			ld	a,l
+			jp	m,Ledda
+			rrca
+			ld	h,l
+			rst	28h
+			ret	pe
+			dec	hl
+			ld	a,h
+			xor	l
+			adc	a,(hl)
+			rla
+			rst	20h
+			rst	00h
+			adc	a,l
+			ld	a,e
+			sub	d
+			rst	30h
+			ld	a,(de)
+			ld	b,(hl)
+			sub	b
+			xor	b
+			inc	hl
+			ld	a,(de)
+			and	c
+			ld	l,5ah
+			call	m,L37db
+			push	af
+			and	69h
+			ld	e,l
+			and	h
+			or	e
+			xor	3bh
+			call	nc,L0ed6
+			sub	h
+			rlca
+			jp	(hl)
+			db	ech,27h,e0h,8ah,ffh,32h,52h,95h
+			db	18h,44h,67h,53h,67h,8ch,11h,21h
+			db	e6h,6ah
+			ld	h,d
+			and	d
+			di
+			dec	a
+			xor	4ch
+			ld	l,a
+			rlca
+			call	pe,Lb4b7
+			ret	m
+			adc	a,(hl)
+			ld	d,l
+			and	a
+			ld	d,14h
+			ld	l,l
+			adc	a,e
+			adc	a,h
+			ex	af,af'
+			inc	c
+			sbc	a,d
+			inc	l
+			inc	sp
+			ld	e,e
+			ld	c,c
+			di
+			dec	c
+			ld	de,eccfh
+			ld	e,l
+			add	a,a
+			pop	bc
+			add	a,b
+			push	hl
+			ld	(hl),b
+			ld	e,h
+			ld	l,57h
+			push	de
+			jp	m,L7411
+			inc	c
+			ld	c,(hl)
+			ld	c,28h
+			ld	h,c
+			ld	l,c
+			xor	e
+			ld	(hl),b
+			djnz	L6b57
+			ld	d,h
+			ld	h,d
+			ld	b,(hl)
+			cp	h
+			cp	e
+			add	a,f5h
+			ld	l,h
+			ld	b,c5h
+			ld	sp,7adch
+			sbc	a,(hl)
+			ld	d,d
+			xor	b
+			ld	(hl),c
+			ld	c,d
+			and	(hl)
+			adc	a,d
+			ld	a,(0ff4h)
+			rra
+			jr	nz,L6bd3
+			ld	b,l
+			cp	c
+			inc	c
+			jp	nz,L7dc7
+			nop
+			sub	(hl)
+			inc	sp
+			ret	p
+			dec	de
+			sbc	a,b
+			xor	(hl)
+			dec	de
+			ld	e,(hl)
+			nop (2x) *
+			xor	b
+			ld	h,d
+			or	l
+			ld	d,a
+			ld	(de),a
+			inc	a
+			inc	l
+			jp	(hl)
+			db	d2h,00h,7ch,aeh,a5h,c0h,49h,bbh
+			db	dch,03h,adh,73h,6ah,65h,deh,75h
+			db	c8h,aah,52h,6fh,deh,98h,50h,7fh
+			ld	l,e
+			ld	c,d
+			ld	c,h
+			dec	c
+			inc	a
+			dec	(hl)
+			ld	e,l
+			ret	po
+			pop	de
+			ld	(hl),d
+			and	e
+			dec	l
+			ld	a,(bc)
+			ld	d,75h
+			ld	e,d
+			ld	(hl),e
+			ld	a,(bc)
+			ld	b,a
+			jp	(hl)
+			db	78h,8fh,83h,74h
+			ret	po
+			inc	bc
+			inc	a
+			halt
+			dec	e
+			ld	a,e
+			nop
+			ld	d,d
+			rst	38h
+			cp	a
+			sbc	a,(hl)
+			ld	(hl),d
+			add	a,(hl)
+			ld	e,d
+			ld	a,c
+			dec	h
+			ld	e,b
+			ld	(hl),b
+			adc	a,(hl)
+			daa
+			ld	d,a
+			xor	a
+			ld	h,h
+			sub	l
+			ld	c,d
+			ret	pe
+			jr	L6bdb
+			db	b5h,efh,9ah,9bh
+			call	nc,L6ac6
+			and	h
+			inc	sp
+			sbc	a,(hl)
+			or	e
+			or	4ch
+			ld	(hl),h
+			inc	(hl)
+			ld	a,b
+			add	hl,sp
+			ld	h,h
+			inc	e
+			scf
+			ret
+			db	f4h,e7h,41h,86h,39h,6eh,64h,2eh
+			db	f1h,d6h,04h,51h,51h,1fh,58h,3dh
+			db	cch,f8h,7ch,41h,00h,55h,a2h,12h
+			db	deh,edh,54h,0dh,c6h,76h,3fh
+			call	po,L7f74
+			add	a,h
+			xor	b
+			ld	c,e
+			ld	de,e3ech
+			adc	a,d
+			cpl
+			ld	c,(hl)
+			call	c,Lb83d
+			ld	h,c
+			ld	e,e
+			and	b
+			inc	de
+			ld	a,b
+			xor	a
+			dec	sp
+			xor	(hl)
+			ld	e,d
+			jr	nz,L6bb8
+			jr	L6c2d
+			db	8ch,67h,8ch,3eh,beh,0ah,52h,ebh
+			db	f1h,97h,14h,aeh,cch,80h,42h,eeh
+			db	3fh,1ch
+			jr	nz,L6c32
+			ld	b,04h
+			rst	38h
+			adc	a,e
+			ld	e,c
+			ld	b,d
+			adc	a,a
+			cp	a
+			add	a,a
+			adc	a,a
+			and	a
+			ld	c,d
+			dec	c
+			sub	(hl)
+			or	e
+			dec	e
+			ld	e,c
+			ld	l,d
+			sub	e
+			ld	b,d
+			inc	(hl)
+			adc	a,h
+			add	a,d
+			ld	c,(hl)
+			ld	a,c
+			ld	b,e
+			jp	c,L1a53
+			inc	l
+			add	hl,hl
+			add	a,b
+			neg *
+			sub	e8h
+			inc	b
+			rst	20h
+			ld	l,b
+			ld	b,e
+			ei
+			xor	e
+			ret	nz
+			ret	nc
+			rla
+			add	a,c
+			ld	a,l
+			cpl
+			ld	b,e
+			inc	sp
+			adc	a,l
+			sub	d
+			nop (2x) *
+			xor	e
+			ld	c,d
+			sub	(hl)
+			dec	c
+			rst	10h
+			ld	l,1bh
+			cp	(hl)
+			adc	a,(hl)
+			ld	de,0e76h
+			sbc	a,h
+			ld	a,b
+			ld	(hl),l
+			sbc	a,l
+			sub	(hl)
+			sbc	a,(hl)
+			add	hl,de
+			inc	l
+			ld	c,(hl)
+			rst	20h
+			rst	28h
+			adc	a,d
+			pop	bc
+			dec	h
+			ei
+			sub	b
+			inc	c
+			ld	d,00h
+			ld	sp,hl
+			cp	(hl)
+			push	af
+			ld	h,a
+			halt
+			or	e
+			cpl
+			ccf
+			ld	l,d3h
+			rst	38h
+			ld	h,l
+			ld	b,c
+			out	(b3h),a
+			jp	pe,Lc095
+			ld	(hl),d
+			rst	00h
+			sub	d
+			rst	20h
+			ld	(hl),d
+			ld	sp,hl
+			rst	38h
+			and	h
+			exx
+			ld	a,d
+			ld	(d45fh),a
+			push	bc
+			ld	c,9eh
+			inc	a
+			ld	h,a
+			sbc	a,e
+			jp	c,L2ca1
+			and	a
+			jp	nc,L4856
+			ld	e,d
+			pop	de
+			ld	h,b
+			cp	d
+			ld	b,a
+			dec	b
+			ld	b,h
+			and	d
+			sub	2eh
+			sbc	a,d
+			ld	h,h
+			ld	a,c
+			nop (2x) *
+			ld	(bc),a
+			ld	c,b
+			ld	d,54h
+			ld	(hl),a
+			ret	nc
+			ld	e,a
+			sbc	a,a
+			rra
+			ld	bc,7765h
+			rst	10h
+			ld	c,h
+			di
+			adc	a,h
+			sbc	a,b
+			ld	l,e
+			jr	z,L6cb6
+			ld	l,e
+			rst	08h
+			ret	m
+			and	e
+			xor	c
+			inc	hl
+			adc	a,h
+			sub	l
+			ld	c,c
+			adc	a,l
+			and	c
+			inc	l
+			sbc	a,0bh
+			sbc	a,ceh
+			dec	l
+			or	c
+			ld	a,(de)
+			add	a,66h
+			ld	bc,f90ah
+			ld	h,b
+			sbc	a,c
+			ld	(hl),h
+			jp	nc,L0eda
+			jp	m,Ld93c
+			add	a,l
+			ld	l,c
+			rra
+			inc	bc
+			cp	d
+			ld	a,a
+			call	pe,La8e7
+			rst	00h
+			add	a,b
+			rst	10h
+			xor	c
+			ret	nz
+			ld	c,a
+			ld	e,b
+			nop
+			call	z,L2db2
+			ld	l,e
+			sbc	a,(hl)
+			push	bc
+			cp	e
+			ld	e,d
+			ld	a,h
+			rst	00h
+			dec	e
+			ld	a,a
+			ld	c,d
+			ld	h,c
+			ld	(hl),h
+			nop
+			adc	a,a
+			ld	c,l
+			dec	hl
+			halt
+			dec	e
+			add	a,d
+			ld	(hl),2dh
+			jp	(hl)
+			db	2ch,66h,f5h,7bh,40h,bdh,95h,60h
+			db	06h,9fh,16h,5ch,70h
+			dec	b
+			djnz	L6d67
+			ld	c,e
+			ld	de,2af2h
+			jp	m,L82bf
+			dec	l
+			add	a,a
+			xor	(hl)
+			ld	c,l
+			call	m,L3d5f
+			sbc	a,50h
+			ld	d,d
+			ld	h,93h
+			ld	l,c
+			adc	a,27h
+			jr	c,L6d75
+			or	c
+			ld	(hl),20h
+			ld	a,(15feh)
+			push	de
+			ld	(hl),a
+			sbc	a,75h
+			and	h
+			sub	d
+			inc	e
+			jp	c,L33e2
+			jp	Ld2e8
+			db	70h,f2h,3eh,90h,55h
+			ld	c,h
+			ld	e,c
+			dec	h
+			sbc	a,d
+			jr	nc,L6d17
+			adc	a,b
+			push	af
+			dec	e
+			and	l
+			sbc	a,1eh
+			ld	(hl),2ch
+			ld	a,l
+			nop (2x) *
+			jr	z,L6cf9
+			ld	d,e
+			ret	nc
+			inc	bc
+			jr	L6d29
+			db	b4h
+			nop (2x) *
+			ex	af,af'
+			ld	c,(hl)
+			ei
+			di
+			adc	a,d
+			or	h
+			call	nz,L4825
+			ld	c,l
+			call	nc,L1cbc
+			ld	d,2bh
+			nop
+			ld	a,d
+			ld	a,b
+			jp	nz,L88d5
+			cp	c
+			add	a,iyh *
+			pop	af
+			xor	e
+			and	b
+			or	e
+			inc	a
+			rst	30h
+			add	a,a
+			ld	h,e
+			ld	d,h
+			ld	c,h
+			ld	d,(hl)
+			xor	c
+			push	af
+			call	pe,L3f17
+			ld	a,h
+			ld	h,d
+			ld	(hl),8eh
+			dec	hl
+			ld	h,d
+			pop	bc
+			ld	c,a
+			cp	a
+			jr	nz,L6d5c
+			sub	d
+			jp	m,Lfd78
+			scf
+			ex	af,af'
+			cpl
+			in	a,(61h)
+			ld	c,l
+			sub	a
+			nop
+			ld	b,9eh
+			inc	bc
+			ld	c,a
+			ld	a,a
+			add	a,b
+			ld	l,d
+			sub	4ah
+			ex	(sp),hl
+			inc	d
+			sub	a
+			jp	z,L9018
+			ld	e,(hl)
+			ld	d,e
+			ld	a,c
+			jp	m,Lfba7
+			call	pe,L5ba0
+			sub	e
+			cp	6bh
+			ld	(5d7fh),hl
+			rst	28h
+			ld	b,d
+			nop
+			inc	sp
+			xor	h
+			add	hl,sp
+			inc	h
+			ld	d,h
+			ld	h,d
+			sbc	a,(hl)
+			inc	sp
+			ld	e,d
+			sbc	a,d
+			inc	h
+			ld	d,h
+			ind
+			rla
+			dec	hl
+			ex	af,af'
+			ld	d,(hl)
+			ret	c
+			rrca
+			or	b
+			ld	b,e
+			adc	a,l
+			jp	(hl)
+			db	85h,c6h,17h,09h,18h,26h,74h,5ch
+			db	6bh,3eh,6dh,30h,fch,3eh,82h,73h
+			db	39h,0eh,19h,fbh,a8h,a0h,bbh,09h
+			db	96h,e5h,67h,eah,f0h,e1h,48h,ach
+			db	69h,55h,fch,58h,9fh,2fh,fdh,69h
+			db	33h,01h,c2h,4bh,a5h,b1h,45h,96h
+			db	30h,94h,ceh,d1h,0ch,deh,ach,fbh
+			db	16h,22h
+			add	a,8fh
+			add	a,l
+			ld	l,a
+			inc	c
+			cpl
+			ld	a,eeh
+			or	h
+			push	de
+			call	pe,L6b97
+			ld	e,h
+			ld	sp,hl
+			jr	L6de7
+			db	15h,ech,b4h,1eh,4ch,a5h,deh,17h
+			db	c6h,0eh,81h,55h,c4h,16h,0bh
+			rst	10h
+			inc	d
+			ld	l,b
+			ld	l,a
+			pop	de
+			nop (2x) *
+			call	nc,L86ee
+			adc	a,e
+			sbc	a,c
+			pop	hl
+			ld	(bc),a
+			ld	d,h
+			pop	hl
+			xor	e
+			ld	h,a
+			or	(hl)
+			ld	hl,(c96eh)
+			ld	d,h
+			adc	a,c5h
+			ex	af,af'
+			ld	d,c
+			inc	h
+			jp	m,L278e
+			jr	L6ea2
+			db	69h,16h,93h,37h,b4h,47h,02h,33h
+			db	1eh,81h,d2h,04h
+			ld	a,30h
+			ex	de,hl
+			in	a,(66h)
+			dec	b
+			pop	de
+			ld	(5739h),a
+			inc	e
+			inc	c
+			ld	e,b
+			ld	(hl),l
+			xor	a
+			ld	(hl),edh
+			sub	l
+			cp	b
+			ld	c,c
+			ld	h,d
+			ld	b,e
+			cp	h
+			add	a,e
+			ld	(hl),c
+			inc	d
+			ld	c,h
+			ld	h,h
+			and	71h
+			and	b
+			ld	d,b2h
+			dec	b
+			inc	a
+			ld	a,b
+			or	h
+			jp	po,La779
+			and	l
+			push	af
+			ld	sp,hl
+			and	d
+			adc	a,l
+			sub	h
+			ld	a,c
+			inc	(hl)
+			sbc	a,c2h
+			ld	e,c
+			or	c
+			ld	(891ah),hl
+			sub	d
+			ld	h,h
+			rst	18h
+			sub	c
+			cp	c
+			adc	a,l
+			or	h
+			jp	nc,Lcb0c
+			ld	a,(hl)
+			add	hl,de
+			ld	b,b
+			ld	a,b
+			jp	nc,L1bce
+			inc	sp
+			ld	a,h
+			ld	(hl),d
+			ld	e,b
+			ld	e,h
+			add	a,b
+			inc	hl
+			cp	c
+			sub	a
+			sbc	a,b
+			inc	l
+			ld	e,a
+			ld	e,(hl)
+			jr	L6f04
+			db	fbh,3ch,5fh,3fh,d1h,74h,1eh,bah
+			db	5dh,98h,41h,82h,60h,4dh,c1h,bah
+			db	b7h,c2h,4fh,8ah,58h,43h,6dh,b9h
+			db	bah,d5h,edh,c3h,b2h,1dh,d4h,aeh
+			db	15h,63h,cch,39h,21h,95h,e1h,5eh
+			db	b1h,7fh,11h
+			ld	a,h
+			ld	b,b
+			ld	e,e
+			or	l
+			dec	sp
+			ld	c,e
+			inc	d
+			inc	h
+			dec	b
+			ld	(3039h),hl
+			ld	l,e
+			rst	20h
+			sub	(hl)
+			adc	a,(hl)
+			cpl
+			ld	sp,hl
+			sbc	a,c
+			ex	af,af'
+			ex	af,af'
+			xor	b
+			and	c
+			nop (2x) *
+			rst	20h
+			inc	c
+			ld	sp,dcach
+			sub	l
+			ex	de,hl
+			ld	d,h
+			ld	h,d
+			or	c
+			ret	pe
+			ld	b,l
+			ret	po
+			and	a
+			pop	af
+			ret	c
+			ei
+			add	a,e
+			inc	l
+			sbc	a,e
+			inc	d
+			add	a,l
+			ld	c,h
+			xor	c
+			nop (2x) *
+			push	af
+			daa
+			cp	e
+			cp	h
+			sub	e
+			cp	(hl)
+			rst	30h
+			ld	hl,6448h
+			sub	c
+			ld	h,e
+			ld	d,(hl)
+			call	pe,L0aaa
+			ld	b,a
+			ld	d,d
+			ld	e,(hl)
+			and	b
+			pop	af
+			ld	e,l
+			inc	sp
+			ld	(hl),h
+			ld	h,6ah
+			rst	18h
+			ld	a,h
+			ld	b,h
+			nop (2x) *
+			ld	l,l
+			add	a,a
+			ld	b,d
+			dec	(hl)
+			or	(hl)
+			or	a
+			sub	d
+			rrca
+			rst	28h
+			ld	c,d
+			djnz	L6f35
+			sub	e
+			xor	e
+			ld	d,h
+			adc	a,d
+			ld	(hl),57h
+			ld	a,d
+			ld	e,l
+			rst	30h
+			ld	d,(hl)
+			rst	28h
+			ld	h,b
+			jr	z,L6f97
+			ld	c,a
+			and	l
+			jp	p,L232b
+			ret	nc
+			rst	00h
+			dec	bc
+			sbc	a,l
+			or	l
+			ld	l,c
+			ld	a,e
+			or	d
+			call	pe,Ld853
+			sub	c
+			cp	(hl)
+			inc	b
+			dec	de
+			ld	a,d
+			ld	(hl),a
+			dec	(hl)
+			add	a,l
+			adc	a,(hl)
+			sub	h
+			rrca
+			sbc	a,h
+			ld	b,b
+			sbc	a,b
+			ld	(hl),b
+			rst	10h
+			adc	a,h
+			ld	h,h
+			xor	e
+			ld	a,e
+			ld	b,e
+			call	po,L96f2
+			jr	nz,L6ff8
+			add	a,e
+			ld	(hl),a
+			jr	z,L7006
+			ld	h,a1h
+			cpl
+			ld	a,(hl)
+			xor	70h
+			inc	c
+			xor	(hl)
+			ld	a,(de)
+			ld	b,e
+			inc	e
+			ld	l,l
+			sbc	a,(hl)
+			push	af
+			inc	bc
+			ld	sp,3145h
+			or	e
+			ld	(de),a
+			ld	iyh,c *
+			sbc	a,a
+			out	(92h),a
+			jr	nc,L7006
+			add	hl,de
+			add	a,h
+			ld	b,e
+			ld	(hl),h
+			call	po,L97f1
+			ld	(hl),d6h
+			daa
+			jr	nz,L6f6c
+			ld	b,e
+			or	a
+			sub	d
+			ld	d,67h
+			dec	l
+			ld	(hl),l
+			jr	c,L6fa9
+			cp	b
+			jp	c,L2d6c
+			jr	nc,L6f5a
+			ld	de,df80h
+			rst	18h
+			dec	(hl)
+			sbc	a,h
+			jr	c,L6fff
+			jp	z,L2f8c
+			inc	a
+			ld	d,8ch
+			ld	e,e
+			nop (2x) *
+			sub	c2h
+			ld	(hl),e
+			adc	a,56h
+			jp	po,L05b1
+			ld	a,e
+			or	b
+			inc	de
+			call	pe,Lcc77
+			sbc	a,c
+			sbc	a,c
+			ld	l,l
+			ld	e,d
+			or	(hl)
+			sbc	a,c
+			ld	(hl),l
+			ld	c,e
+			sub	l
+			xor	d
+			ld	e,h
+			inc	e
+			nop (2x) *
+			ld	a,(3bc4h)
+			ret
+			db	89h,11h,07h,97h
+			nop (2x) *
+			inc	e
+			ret	nc
+			ld	b,l
+			sbc	a,(hl)
+			add	hl,hl
+			dec	b
+			add	a,b
+			inc	l
+			ld	h,c
+			dec	de
+			xor	l
+			pop	hl
+			or	c0h
+			ld	h,h
+			ld	b,a
+			xor	d
+			ld	d,h
+			dec	d
+			or	l
+			scf
+			halt
+			ld	a,h
+			ld	a,e
+			add	hl,de
+			inc	hl
+			ld	l,(hl)
+			or	(hl)
+			sub	b
+			ld	d,e
+			ld	c,22h
+			jr	nz,L7008
+			add	a,b
+			add	a,(hl)
+			ld	(hl),d
+			inc	e
+			and	c
+			xor	(hl)
+			or	d
+			cp	(hl)
+			cpir
+			ld	(hl),a
+			add	a,(hl)
+			ld	b,e
+			scf
+			ld	b,c
+			ret	c
+			ld	b,47h
+			ld	(hl),a
+			ld	c,c
+			nop (2x) *
+			xor	e
+			sbc	a,65h
+			dec	a
+			ld	b,5ah
+			sbc	a,l
+			ret	p
+			inc	c
+			adc	a,b
+			rra
+			call	p,L07fb
+			ld	c,9dh
+			ld	h,b
+			ld	d,d
+			nop (2x) *
+			add	hl,de
+			or	e
+			sbc	a,a
+			ld	a,h
+			sbc	a,h
+			ld	a,h
+			ld	d,c
+			halt
+			rst	18h
+			daa
+			sbc	a,l
+			sub	d
+			add	a,d
+			jp	p,L5922
+			xor	b
+			cp	l
+			cp	(hl)
+			xor	b
+			ld	a,a
+			jr	z,L705a
+			ld	a,(de)
+			ld	hl,(d0d2h)
+			ret
+			db	e9h,ebh,bch,f7h,e5h,e0h,70h,31h
+			db	40h,abh,2eh,0ah,cfh,6dh,9dh,abh
+			db	93h,17h,55h,cfh,19h,c1h,13h,2fh
+			db	76h,e8h,6fh,d5h,55h,6fh,29h,3fh
+			db	0fh,93h,b8h,bah,2ch,39h,79h,a6h
+			db	04h,97h,45h,8dh,dbh,54h,aeh,7ah
+			db	f5h,11h,a8h,79h,a6h,25h
+			sub	e8h
+			and	31h
+			rlca
+			ld	l,l
+			rst	20h
+			halt
+			or	e
+			ld	(hl),h
+			ld	ixl,a *
+			ld	d,d
+			ret
+			db	82h,73h,46h,18h,2bh,09h,d3h,bch
+			db	aah,efh,d1h,e4h,c2h,59h,40h,a7h
+			db	42h,00h,2ch,9bh,45h,e0h,54h,d2h
+			db	57h,97h,16h,52h,3eh,f9h,52h,53h
+			db	cfh,04h,89h,0eh,e7h,7ah,50h,39h
+			db	33h,b6h,35h,4ah,30h,83h,2bh,3fh
+			db	cdh,fdh,a9h,a0h
+			daa
+			ld	h,26h
+			and	h
+			ld	bc,6103h
+			bit	2,b
+			ld	h,48h
+			inc	sp
+			xor	29h
+			ld	l,h
+			halt
+			or	2ah
+			rst	30h
+			ld	d,c
+			dec	bc
+			sbc	a,9dh
+			ld	(hl),d
+			inc	sp
+			ld	c,(hl)
+			ei
+			ex	(sp),hl
+			adc	a,(hl)
+			sbc	a,l
+			ld	b,l
+			add	a,h
+			ld	a,l
+			ld	e,b
+			ld	(hl),d
+			ld	e,b
+			ld	e,d
+			sbc	a,ixh *
+			inc	(hl)
+			add	a,(hl)
+			ld	c,a
+			inc	h
+			ld	l,a
+			ret	po
+			add	a,48h
+			ld	h,d
+			sub	e
+			in	a,(a2h)
+			ld	a,l
+			jp	p,L1e17
+			ld	b,b
+			ret	z
+			ld	e,h
+			sbc	a,d
+			nop (2x) *
+			jr	z,L7100
+			ld	c,a
+			ld	e,e
+			ld	a,d
+			ld	(hl),l
+			ld	d,c
+			ld	e,a
+			nop (2x) *
+			or	d
+			ld	b,e
+			ld	h,(hl)
+			call	z,L1f1d
+			sbc	a,a
+			ex	de,hl
+			sub	e
+			inc	b
+			ld	a,(3b7bh)
+			or	45h
+			sbc	a,l
+			sbc	a,e
+			ld	a,h
+			adc	a,c6h
+			jp	m,Ld0ec
+			or	d
+			call	po,L0b27
+			sub	c
+			di
+			ld	c,b
+			ld	a,(de)
+			pop	de
+			ld	a,c6h
+			ld	c,d
+			jp	nc,La51d
+			ld	a,d
+			add	hl,bc
+			ld	a,(de)
+			ld	(hl),b
+			ld	(hl),d
+			ld	e,c
+			call	p,L9ae5
+			rla
+			ld	d,b
+			and	(hl)
+			adc	a,c
+			exx
+			ld	(06ddh),a
+			or	d
+			ld	c,a
+			push	hl
+			dec	l
+			adc	a,c
+			ex	(sp),hl
+			ld	b,d
+			ld	c,c
+			or	l
+			cp	c
+			sbc	a,(hl)
+			add	a,(hl)
+			inc	hl
+			ret	z
+			jp	nc,La25f
+			inc	bc
+			inc	c
+			xor	b8h
+			dec	h
+			sbc	a,8dh
+			ld	e,(hl)
+			ret	z
+			sbc	a,c
+			ld	e,(hl)
+			ld	a,22h
+			call	nz,L7242
+			sbc	a,e
+			adc	a,b
+			inc	l
+			sbc	a,a
+			ld	l,h
+			sub	d
+			daa
+			cp	fah
+			rra
+			jp	z,L6506
+			ld	e,b8h
+			ld	h,l
+			ld	c,e
+			call	m,Lb896
+			rlca
+			ld	l,c
+			jp	(hl)
+			db	dch,e9h,9ch,dah,c2h,fbh,51h,bch
+			db	aah,72h,d4h,7eh,d1h,15h,b1h,21h
+			db	0eh,01h,3ch,0bh,eah,2dh,fbh,1ah
+			db	43h,37h,16h,fbh,2fh,4eh,adh,46h
+			db	65h,16h,97h,4bh,83h,f0h,6dh,ddh
+			db	d5h,2ch,57h,56h,54h,83h,3bh,76h
+			db	1fh,4dh,f8h,edh,bah,f9h,7eh,61h
+			db	ddh,62h,69h,28h,58h,9eh,12h,23h
+			db	0ah,2bh,8eh,edh,eeh,dbh,adh,b5h
+			db	02h,91h,eah,f0h,fch,69h,7ch,c9h
+			db	54h,c0h,22h,feh,11h,c2h,e0h,ceh
+			db	cfh,68h,80h,feh,fdh,74h,10h
+			jp	po,L2249
+			ld	c,e
+			dec	c
+			ld	l,65h
+			sub	l
+			push	hl
+			or	l
+			or	c
+			inc	c
+			ret	z
+			ld	b,b
+			ret	i *
+			jp	nc,L961c
+			cp	d
+			sbc	a,a
+			inc	c
+			pop	de
+			ex	af,af'
+			dec	(hl)
+			or	e4h
+			indr
+			and	0dh
+			jp	pe,L889b
+			ret	nz
+			inc	d
+			adc	a,b
+			ex	af,af'
+			cp	c
+			ld	h,d
+			pop	af
+			cp	e
+			rst	10h
+			ld	a,a
+			pop	hl
+			inc	hl
+			and	c
+			ld	d,a
+			ld	b,h
+			dec	hl
+			ld	c,d
+			nop (2x) *
+			ld	h,c
+			rst	10h
+			ld	h,c
+			and	d
+			ld	a,c
+			ld	hl,(542fh)
+			cp	d
+			sub	(hl)
+			rlca
+			call	po,L2c7e
+			ld	bc,7dc6h
+			and	b
+			ret	p
+			ex	de,hl
+			jr	L71eb
+			db	6dh,5eh,abh,b8h,d8h,98h,04h,a2h
+			db	dfh,80h,7dh,36h
+			sbc	a,e
+			push	af
+			and	a
+			scf
+			xor	c
+			ld	d,98h
+			ld	l,b
+			ld	h,h
+			ret	m
+			rst	10h
+			or	d
+			inc	a
+			add	a,l
+			and	7eh
+			rst	20h
+			sub	a
+			ld	l,c
+			ld	d,(hl)
+			ret	pe
+			ld	a,d
+			sbc	a,l
+			inc	e
+			ld	l,(hl)
+			ld	h,e
+			rst	00h
+			ld	(hl),b
+			jp	nc,L33ac
+			call	Lb0f3
+			dec	l
+			ld	hl,bf5eh
+			ld	(Lec01),a
+			ld	(hl),b
+			ld	b,d
+			ld	a,e
+			ld	a,a
+			jr	c,L7261
+			exx
+			ld	a,c
+			jp	p,L5aa9
+			exx
+			jp	p,L5f7e
+			ld	b,d
+			ld	d,l
+			xor	h
+			xor	b
+			ld	h,d
+			res	7,c
+			ld	a,(bc)
+			dec	l
+			ld	(hl),h
+			or	l
+			ld	a,e
+			jp	nz,L775c
+			ld	b,d
+			dec	l
+			add	a,e
+			and	h
+			add	hl,de
+			dec	de
+			ld	a,a
+			jr	nz,L7226
+			jp	p,L6b16
+			di
+			ex	af,af'
+			ld	b,b
+			or	d
+			inc	l
+			ld	(663ch),hl
+			adc	a,3ch
+			and	b
+			or	d
+			adc	a,h
+			ld	e,(hl)
+			ld	l,d
+			ld	c,f2h
+			ld	(f2d1h),a
+			and	h
+			add	a,c
+			ld	l,d
+			ret	pe
+			xor	1fh
+			jr	z,L7271
+			ld	c,(hl)
+			rst	18h
+			ld	c,e
+			ret	nc
+			sbc	a,a
+			adc	a,86h
+			ld	a,(hl)
+			adc	a,c
+			cp	l
+			ld	d,l
+			ret
+			db	08h,48h,2fh,5fh,a2h,13h,d3h,8ch
+			db	bfh,e7h
+			ret	p
+			xor	h
+			ld	e,(hl)
+			dec	l
+			ld	d,c
+			halt
+			ld	c,c
+			push	af
+			call	pe,L913c
+			adc	a,c
+			inc	a
+			ld	d,e
+			add	a,l
+			ld	(hl),e
+			ld	(hl),h
+			ld	e,a
+			ld	a,l
+			cp	a
+			ld	b,l
+			ld	h,b
+			jp	(hl)
+			db	82h,e2h,62h,50h,96h,90h,f5h,d3h
+			db	b1h,19h,e6h,57h,62h,13h,e1h,e8h
+			db	4ah,e5h,60h,f7h,47h,deh,5fh,dah
+			db	56h,eah,abh,5eh,e8h,6eh,e2h,93h
+			db	4bh,83h,5ch,69h,20h,d5h,f6h,28h
+			db	a4h,6ch,35h,b9h,5fh,92h,cah,59h
+			db	4eh,aeh,5eh
+			ld	a,(hl)
+			inc	e
+			ld	l,d
+			adc	a,l
+			ld	l,f2h
+			ret
+			db	68h,cfh,ffh,f0h,46h,abh,78h,fah
+			db	fah,44h,8fh,9dh,b3h,06h,0dh,ech
+			db	32h,91h,2eh,93h,3ah,8dh,63h,38h
+			db	28h,0eh,8ah,e9h,09h,5ah,5eh,54h
+			db	56h,efh,26h,f7h,57h,3ah,03h,64h
+			db	43h,d6h,feh,4eh,f8h,84h,1eh,aeh
+			db	e0h,13h,1ch,00h,90h,2dh,fch,e0h
+			db	9fh,19h,b9h
+			sub	b
+			ld	h,d
+			or	d
+			ld	a,(de)
+			sbc	a,(hl)
+			ld	b,e
+			and	c
+			and	h
+			add	a,b1h
+			inc	c
+			ld	h,a
+			dec	sp
+			ld	h,b
+			ret	nc
+			ld	sp,hl
+			sub	a
+			ld	d,a
+			cp	b
+			ld	a,c
+			ld	b,l
+			ld	a,16h
+			xor	b
+			ld	b,d
+			ld	l,b
+			xor	b
+			ld	b,b
+			ld	l,a
+			ld	e,b
+			ret	po
+			jp	z,Lbf7c
+			ld	e,h
+			dec	de
+			ld	d,c
+			ld	a,h
+			ret	po
+			ld	c,a
+			ld	sp,hl
+			ld	d,b
+			rst	10h
+			or	c
+			adc	a,e
+			ld	(hl),b
+			call	m,L84dd
+			dec	e
+			add	a,h
+			push	de
+			xor	e
+			call	z,L4d8a
+			ret
+			db	96h,b1h,ddh,f6h,fbh,aeh,83h,3bh
+			db	21h,39h,86h,d3h,ech,31h,e0h,afh
+			db	44h,2eh,4ah
+			dec	b
+			add	hl,sp
+			di
+			and	c
+			sbc	a,d
+			push	hl
+			ld	e,h
+			cp	e
+			sub	e2h
+			dec	l
+			ld	l,(hl)
+			ld	(hl),a
+			ld	e,10h
+			rra
+			add	a,l
+			djnz	L7370
+			dec	l
+			and	h
+			jr	L73af
+			db	b6h,a1h,f6h,5bh,aah,3dh,1ch,edh
+			db	7ah,43h,b0h,beh,bfh,6fh,81h,98h
+			db	dah,6fh,52h,9fh,0ch,8eh,06h,fch
+			db	dah,20h,ach,37h,8dh,bah,91h,c1h
+			db	ddh,34h,9dh,2dh,aah,36h,f8h,feh
+			db	c4h,88h,6bh,b6h,58h,56h,f5h,3eh
+			db	fbh,e9h,9dh,58h,64h,cdh,53h,e4h
+			db	e0h
+			nop
+			xor	a
+			rst	38h
+			ld	a,(hl)
+			ccf
+			ld	a,e
+			ld	e,73h
+			ld	b,e
+			rst	00h
+			or	(hl)
+			ld	e,b
+			ld	e,c
+			ld	e,l
+			cp	b
+			rla
+			sbc	a,l
+			jp	L6dd8
+			db	efh,02h,09h,57h,03h,c4h,f8h,dch
+			db	78h,2dh,0ch,20h
+			call	nc,Lb4c4
+			and	a
+			inc	a
+			ld	e,h
+			ld	(hl),19h
+			xor	b
+			ld	h,c
+			rla
+			cp	d
+			cp	b
+			ld	a,e
+			ccf
+			ld	b,c
+			inc	a
+			or	e
+			rst	00h
+			sub	36h
+			in	a,(a2h)
+			ld	c,e
+			jp	z,L6bff
+			cp	a
+			dec	b
+			inc	de
+			inc	e
+			ret	nz
+			jr	z,L73ef
+			rst	38h
+			ret	m
+			push	af
+			rst	08h
+			jr	L7497
+			db	49h,d8h,fch,d1h,44h,88h,93h,6dh
+			db	87h
+			jp	pe,L1dcb
+			ld	b,l
+			jp	c,Lace7
+			or	e
+			sub	c
+			jr	c,L74a2
+			inc	(hl)
+			jr	L740f
+			db	87h,08h
+			ld	b,a
+			ld	hl,(98feh)
+			inc	bc
+			ld	c,a
+			push	de
+			and	c
+			jp	nc,Lc319
+			ex	af,af'
+			ld	b,e
+			ld	b,b
+			adc	a,59h
+			ld	de,471fh
+			ld	(hl),l
+			ld	a,7ch
+			ld	h,e
+			ld	e,85h
+			ld	a,h
+			sub	37h
+			dec	d
+			add	a,(hl)
+			inc	d
+			add	a,h
+			ld	l,e
+			ld	e,h
+			rst	18h
+			ld	d,e
+			ret	c
+			or	e
+			call	po,L5e46
+			ld	b,l
+			rst	28h
+			jr	z,L749a
+			ld	c,e
+			ret	z
+			ld	l,a
+			jr	nc,L74f7
+			ld	h,b
+			xor	e
+			and	b
+			ld	e,l
+			add	a,(hl)
+			call	po,L6cfc
+			ex	(sp),hl
+			dec	b
+			ld	h,a
+			ld	(hl),d
+			or	d
+			sub	e
+			ld	h,b8h
+			or	b
+			rlc	a
+			ld	(hl),l
+			ld	c,(hl)
+			sub	d
+			dec	l
+			or	d
+			and	h
+			ld	(hl),e7h
+			ret
+			db	6bh,09h,67h,1bh
+			ex	(sp),hl
+			ld	l,5eh
+			nop (2x) *
+			ex	de,hl
+			rst	28h
+			ld	a,e
+			ld	sp,bc23h
+			sub	l
+			sbc	a,c
+			add	a,(hl)
+			push	hl
+			rst	18h
+			adc	a,d
+			cp	(hl)
+			ld	a,(d509h)
+			inc	bc
+			ld	bc,a6ach
+			djnz	L74ac
+			nop
+			sbc	a,h
+			jr	L74f5
+			db	c4h,42h,fdh,e9h,48h,bfh,63h,80h
+			db	81h,2ah,46h,d3h,74h,9eh,84h,a7h
+			db	beh,88h,7eh,20h,f9h,a8h,f8h,49h
+			db	02h,7ch,3fh,18h,edh,9eh,f4h,f0h
+			db	0bh,2fh,56h,a4h,49h,f0h,cch,77h
+			db	e4h,f2h,d6h,d8h,30h,e1h,37h,5ch
+			db	e7h,4eh,7fh,a1h,54h
+			cp	d
+			sbc	a,l
+			ld	a,(7510h)
+			ld	e,h
+			ld	h,b
+			inc	h
+			dec	de
+			ld	e,d
+			sbc	a,c
+			jp	z,La22b
+			jp	m,L526f
+			sub	l
+			dec	h
+			rra
+			and	l
+			or	(hl)
+			call	m,Lf6e3
+			inc	(hl)
+			sbc	a,e
+			xor	b
+			sub	c
+			rrca
+			add	a,91h
+			add	a,e
+			ld	l,(hl)
+			jp	m,L2214
+			dec	b
+			ld	hl,84c9h
+			dec	(hl)
+			cp	b
+			dec	(hl)
+			ld	b,b
+			jp	pe,Lfc0f
+			ret	nz
+			ld	e,(hl)
+			rst	08h
+			djnz	L758c
+			ld	b,e
+			ld	d,d
+			ld	l,(hl)
+			cp	h
+			ld	a,a
+			ld	a,a
+			add	a,8bh
+			ld	e,l
+			ld	b,h
+			cp	b
+			rrc	l
+			call	m,Lbb61
+			ld	h,h
+			ld	c,b
+			adc	a,h
+			ld	a,(hl)
+			ld	c,e
+			ld	e,h
+			ld	a,1bh
+			xor	h
+			dec	(hl)
+			adc	a,a
+			inc	(hl)
+			ld	l,d
+			xor	53h
+			or	e
+			rst	38h
+			or	b
+			and	c
+			ld	c,d
+			call	c,L3fe6
+			add	a,e
+			add	hl,de
+			ld	a,44h
+			sbc	a,(hl)
+			cp	e
+			rrc	c
+			and	c
+			jr	L757b
+			inc	a
+			call	pe,L3558
+			rst	10h
+			or	l
+			pop	hl
+			ld	d,b
+			ld	l,c
+			ld	c,43h
+			ld	h,h
+			cp	1ah
+			ld	b,e
+			ld	(f7cah),a
+			ld	d,b
+			sbc	a,l
+			and	h
+			or	c
+			add	a,l
+			ld	(d812h),hl
+			ld	c,(hl)
+			rlca
+			pop	hl
+			ld	a,(hl)
+			or	(hl)
+			ld	h,02h
+			ld	d,c
+			ld	a,d
+			ld	a,b
+			sub	78h
+			sub	b
+			jr	c,L75fd
+			ld	(hl),a0h
+			rrc	h
+			ld	b,e
+			rra
+			ld	a,(hl)
+			inc	a
+			ld	(8d48h),hl
+			ld	l,h
+			dec	sp
+			xor	7bh
+			ld	h,(hl)
+			ld	e,07h
+			xor	d
+			inc	e
+			call	nc,Le962
+			ld	h,h
+			ret	po
+			ld	sp,hl
+			adc	a,ddh
+			push	de
+			rra
+			ld	e,e
+			inc	e
+			xor	(hl)
+			ld	a,(de)
+			add	hl,bc
+			xor	h
+			dec	e
+			ld	d,c
+			di
+			add	a,h
+			ret	m
+			cp	(hl)
+			cp	b
+			pop	bc
+			adc	a,e
+			ld	l,c
+			ld	l,l
+			add	a,e
+			ld	h,(hl)
+			ld	h,a
+			ld	h,a
+			ld	hl,(fb99h)
+			ld	h,e
+			sbc	a,a
+			ld	a,(bc)
+			ld	l,(hl)
+			rrca
+			xor	a
+			rst	38h
+			ld	d,efh
+			ld	h,e
+			ld	(hl),6bh
+			or	a
+			jp	nz,L80f4
+			ld	b,h
+			dec	e
+			or	d
+			sbc	a,h
+			xor	a
+			ld	h,(hl)
+			jr	nz,L75ae
+			ret	m
+			add	a,e
+			jp	m,L0a47
+			ld	l,h
+			ex	(sp),hl
+			sbc	a,h
+			jp	m,L3212
+			adc	a,h
+			ret	m
+			sbc	a,h
+			ld	hl,(c501h)
+			add	hl,de
+			ld	b,l
+			rst	28h
+			ld	b,e
+			ld	e,l
+			inc	h
+			sbc	a,b
+			push	hl
+			or	e
+			xor	h
+			scf
+			ld	h,e
+			cp	b
+			ld	(hl),a
+			ld	l,b
+			djnz	L7584
+			add	a,(hl)
+			inc	a
+			push	bc
+			call	nz,Laf2c
+			ld	h,(hl)
+			sub	l
+			sub	h
+			inc	b
+			ret	nz
+			jr	nz,L7594
+			ex	de,hl
+			ld	e,l
+			or	(hl)
+			ld	a,a
+			cp	c
+			ld	b,e
+			and	l
+			rla
+			ld	d,e
+			ld	(6b66h),a
+			ld	(e260h),hl
+			ld	l,e
+			jr	c,L7622
+			daa
+			dec	de
+			ret	po
+			jp	p,L87c9
+			ld	(L7e88),a
+			dec	a
+			jr	z,L75f1
+			adc	a,d
+			ld	hl,(38eeh)
+			ld	d,(hl)
+			ld	d,c
+			ld	h,abh
+			jp	c,L99e6
+			jp	p,L2a79
+			ld	l,e
+			ld	b,c
+			and	e
+			ret	po
+			ld	d,e
+			ret	c
+			inc	a
+			ld	b,5fh
+			call	c,Lba65
+			add	a,c
+			call	p,Lbf52
+			nop (2x) *
+			rst	20h
+			cp	h
+			ret
+			db	47h,adh,e5h,08h,08h,86h,e5h,03h
+			db	18h,bbh,17h,fdh,22h,55h,39h,0eh
+			db	6eh,2ch,33h,adh,92h,24h,12h,70h
+			db	d2h,c3h,0ch,d2h,54h,b7h,d8h,24h
+			db	2fh,24h,d8h,c7h,15h,aah,99h,04h
+			db	45h,09h,91h,8bh,a4h,62h,89h,0fh
+			db	06h,16h,71h,3ch,6dh,f4h,75h,c1h
+			db	54h,e4h,39h,b1h,4eh,48h,cdh,05h
+			db	a3h,19h,9ch,06h,96h,05h,f2h,f3h
+			db	00h,0ah,69h,1ah,ceh,74h,81h,3fh
+			db	c9h,71h,9ch,70h,c4h,39h,4eh,5fh
+			db	1dh
+			xor	e1h
+			sbc	a,h
+			ld	l,l
+			ld	(hl),66h
+			ld	d,d
+			ld	e,(hl)
+			jp	po,L127d
+			add	a,c
+			xor	(hl)
+			and	a
+			ret	m
+			add	a,h
+			jp	c,Ledcc
+			and	h
+			sub	l
+			ld	l,f2h
+			inc	hl
+			cp	d
+			adc	a,(hl)
+			add	a,b
+			ld	d,(hl)
+			dec	de
+			add	a,l
+			ld	h,d
+			inc	b
+			in	a,(93h)
+			sub	09h
+			ld	e,(hl)
+			ld	l,d
+			ld	a,e
+			cp	h
+			nop
+			ld	hl,a56eh
+			halt
+			and	(hl)
+			dec	de
+			and	c
+			jp	(hl)
+			db	43h,14h,0ah,48h,99h,34h,5dh,5ah
+			db	15h,cbh,b9h,79h,9bh,05h,5bh,c7h
+			db	2bh,14h,18h,bfh,adh,dch,1fh,50h
+			db	d0h,7fh,7bh,d7h,8ah,27h,5dh,36h
+			db	bah,e2h,cch,3dh,fch,4bh,70h,abh
+			db	69h,e7h,53h,a3h,fbh,9ch
+			jp	pe,L658b
+			ld	b,l
+			add	a,d
+			scf
+			ld	b,e
+			ld	c,d
+			xor	f0h
+			ret	p
+			ld	a,d
+			dec	sp
+			dec	d
+			jp	po,L2bec
+			pop	de
+			push	bc
+			ld	e,b
+			dec	sp
+			out	(3fh),a
+			ld	c,ixh *
+			and	c
+			ret	m
+			xor	h
+			sub	l
+			rra
+			ld	d,d
+			call	pe,Lb1e3
+			add	hl,sp
+			sub	a
+			rst	20h
+			ld	l,d
+			dec	e
+			ld	h,(hl)
+			dec	de
+			call	nc,L9def
+			ld	a,h
+			dec	de
+			ld	(hl),0fh
+			add	a,l
+			ccf
+			ld	d,(hl)
+			rrca
+			ld	c,a
+			ld	l,b
+			or	c
+			ld	a,c
+			adc	a,deh
+			xor	a
+			and	b
+			nop (2x) *
+			ld	c,(hl)
+			ret	p
+			ld	b,aah
+			djnz	L76fa
+			or	(hl)
+			exx
+			jp	pe,L0a80
+			ld	e,(hl)
+			ld	(hl),e
+			adc	a,a
+			sub	a
+			ld	b,a
+			or	5ch
+			ld	l,(hl)
+			xor	2ch
+			ld	a,c
+			add	a,e
+			ld	l,(hl)
+			ld	bc,0a20h
+			ld	(hl),eeh
+			or	h
+			in	a,(c3h)
+			ld	h,e
+			ld	d,l
+			inc	b
+			ld	d,b
+			scf
+			ld	h,b
+			add	hl,hl
+			inc	(hl)
+			xor	d
+			dec	bc
+			or	e
+			sbc	a,l
+			ld	a,b
+			jp	c,L7e46
+			sub	a
+			inc	d
+			rrca
+			push	hl
+			inc	bc
+			rlca
+			ret	pe
+			ld	c,l
+			ld	b,a
+			add	a,l
+			inc	l
+			call	nz,L1c20
+			dec	c
+			ld	a,l
+			adc	a,h
+			di
+			ld	l,d
+			ld	sp,d79ah
+			sbc	a,l
+			ld	h,feh
+			sbc	a,l
+			adc	a,d
+			or	a
+			dec	bc
+			or	l
+			ld	hl,(1d2ch)
+			ld	e,c3h
+			sbc	a,(hl)
+			ld	d,l
+			jp	po,Lc994
+			add	hl,de
+			adc	a,b
+			ld	a,(hl)
+			nop (2x) *
+			ld	c,66h
+			or	(hl)
+			ld	(d4c6h),hl
+			dec	e
+			dec	d
+			push	af
+			push	hl
+			sub	h
+			sub	e
+			ld	b,e
+			sbc	a,a
+			ld	b,c
+			ld	l,c
+			ld	(hl),h
+			call	pe,L551d
+			ld	hl,(8227h)
+			sbc	a,b
+			ld	a,d
+			cp	h
+			cp	(hl)
+			adc	a,c
+			ld	(hl),e
+			rst	08h
+			ld	de,c795h
+			ret
+			db	54h,71h,1ah,6bh,46h,69h,c5h,90h
+			db	20h,bdh,94h,cah,81h,5ch,7dh,c3h
+			db	0ah,b5h,1eh
+			ld	b,e
+			call	c,L3acd
+			rst	10h
+			adc	a,a
+			in	a,(4dh)
+			ld	b,l
+			ld	(bc),a
+			push	bc
+			ld	c,d
+			adc	a,b
+			cp	a
+			add	a,e
+			and	c
+			add	a,b
+			inc	sp
+			ex	de,hl
+			ld	(hl),h
+			ld	(hl),c
+			inc	(hl)
+			adc	a,l
+			ret	pe
+			sbc	a,c
+			call	L407c
+			dec	c
+			ld	(hl),a
+			add	a,b
+			ld	de,e0ffh
+			add	a,a
+			ld	a,2fh
+			call	c,L13b3
+			ld	c,d
+			ret	z
+			ld	c,(hl)
+			jp	(hl)
+			db	bbh,9eh,f4h,9eh,82h,02h,f1h,78h
+			db	b8h,1ch,dbh,87h,69h,c6h,d0h,a2h
+			db	e6h,16h,d8h,a0h,c1h,82h,43h,33h
+			db	afh,7eh,c6h,83h,3eh,65h,0fh,abh
+			db	78h,12h,f4h,47h,4ch,fdh,f6h,9ch
+			db	f4h,a2h,5bh,a3h,4ah,20h,52h,26h
+			db	bch,37h,f1h,f8h,cch,60h,41h,5bh
+			db	36h,1dh,3fh,5ch,65h,ach,f6h,58h
+			db	c4h,24h,bch,dch,9ch,b2h,29h,9fh
+			db	cdh,0ah,cbh,1ah,f6h,26h
+			dec	hl
+			cp	c
+			inc	c
+			ret	c
+			ld	h,d
+			ld	b,a
+			ld	l,h
+			ld	(hl),1fh
+			call	po,L833f
+			jp	nc,L2a95
+			sbc	a,(hl)
+			ld	a,(hl)
+			cp	e
+			jp	nc,L2629
+			and	(hl)
+			ld	d,h
+			ld	a,h
+			ld	a,h
+			ld	l,(hl)
+			ld	hl,(937fh)
+			ld	(bc),a
+			or	l
+			ret	nz
+			dec	hl
+			call	nc,Lc390
+			cp	(hl)
+			ld	h,c
+			rst	20h
+			ld	a,(bc)
+			ld	(hl),a
+			xor	(hl)
+			jr	z,L78a2
+			sbc	a,l
+			call	z,L9011
+			ret	po
+			ld	e,l
+			dec	h
+			add	a,c
+			nop
+			ld	a,d
+			inc	de
+			ld	d,e
+			ld	de,19b2h
+			ld	c,87h
+			ld	l,35h
+			ld	h,(hl)
+			ret
+			db	efh,ceh
+			sub	b
+			call	pe,L3881
+			jr	z,L789b
+			cp	c
+			cpl
+			ld	c,bch
+			ld	(196ah),hl
+			xor	l
+			ret
+			db	35h,a1h,e0h,c5h,e1h
+			ld	b,a
+			ld	a,(c014h)
+			ld	e,h
+			nop (2x) *
+			add	a,e
+			inc	sp
+			ld	(8abch),hl
+			ld	b,d
+			ld	(hl),b
+			jp	(hl)
+			db	d8h,00h,b2h,e4h,f1h,08h,05h,19h
+			db	b7h,76h,75h,04h,55h,e4h,b9h,59h
+			db	d1h,e6h,aeh,89h,d0h,45h,cch,65h
+			db	0ah,0fh,10h,feh,99h,09h,ech,80h
+			db	d5h,4dh,48h,e2h,eah,62h,5ah,54h
+			db	c9h,56h,27h,c6h,9fh,5ch,fah,d2h
+			db	c9h,cah,2dh,0eh,72h,97h,89h,fbh
+			db	10h,e8h,c0h,dbh,78h,3ah,d7h,e8h
+			db	2ah
+			exx
+			nop
+			cp	a
+			add	a,a
+			push	bc
+			call	z,Lfa70
+			add	hl,bc
+			dec	de
+			inc	h
+			out	(f9h),a
+			rst	00h
+			sla	l
+			sbc	a,e
+			jr	nz,L7941
+			nop (2x) *
+			jp	p,Lfde3
+			add	hl,bc
+			push	de
+			ld	b,c
+			or	b
+			call	m,L5014
+			nop (2x) *
+			dec	d
+			ld	hl,4e71h
+			call	c,L69fe
+			xor	(hl)
+			inc	(hl)
+			add	hl,de
+			ld	e,a
+			ld	l,a
+			ld	c,l
+			jp	z,L292a
+			dec	bc
+			jr	z,L794b
+			push	bc
+			cpl
+			ret	c
+			dec	de
+			cpl
+			ld	d,(hl)
+			add	hl,de
+			pop	af
+			jr	L7912
+			db	59h,8ch,c5h,14h,a8h,44h,39h,03h
+			db	58h,edh,39h,9dh,04h
+			push	bc
+			sbc	a,b
+			inc	sp
+			pop	de
+			jr	L7938
+			db	8dh,cbh,2eh,73h,39h,86h,17h
+			rrca
+			ld	(hl),a
+			adc	a,3ch
+			ld	(5f90h),hl
+			cp	c
+			dec	e
+			scf
+			nop (2x) *
+			ld	b,04h
+			ld	a,(0d5ah)
+			jp	c,Le0fc
+			rla
+			ld	(hl),l
+			adc	a,c
+			ld	a,(bc)
+			ld	(3acfh),a
+			ret	c
+			add	a,cdh
+			sbc	a,h
+			daa
+			ld	bc,b23eh
+			ld	h,c
+			nop (2x) *
+			ld	c,e
+			sub	6bh
+			dec	a
+			ld	b,a
+			ld	d,d
+			cp	h
+			call	pe,L7985
+			nop (2x) *
+			xor	b
+			and	a
+			jp	po,L9d8c
+			pop	hl
+			adc	a,b
+			ld	a,(hl)
+			or	l
+			jr	nc,L7942
+			jp	(hl)
+			db	e2h,68h,f1h,17h,cfh,deh,b0h,d6h
+			db	b7h
+			add	a,a
+			dec	de
+			ld	h,b
+			push	de
+			sbc	a,6ch
+			exx
+			di
+			or	a
+			ld	c,e
+			ld	(hl),c
+			ld	h,d
+			adc	a,h
+			and	e
+			ld	e,l
+			dec	hl
+			call	po,L417f
+			inc	b
+			inc	l
+			ld	e,d
+			jp	(hl)
+			db	d1h
+			or	h
+			cp	(hl)
+			ld	e,e
+			rra
+			cpl
+			ld	l,a
+			ld	sp,hl
+			or	e
+			add	a,e
+			ld	c,7dh
+			ld	c,c
+			nop (2x) *
+			sbc	a,c
+			ret	pe
+			ret	nz
+			ld	a,c
+			push	bc
+			ld	d,b
+			ld	l,e
+			ret	z
+			halt
+			dec	b
+			xor	e
+			exx
+			dec	h
+			adc	a,a
+			add	a,(hl)
+			call	p,Lcac8
+			djnz	L7a1b
+			ld	d,b
+			jp	m,Lccb6
+			and	c
+			xor	e
+			ld	(L5ca8),a
+			xor	e
+			pop	hl
+			dec	a
+			ld	(bc),a
+			jr	c,L7a10
+			ld	l,1ah
+			ld	e,h
+			sbc	a,d
+			ld	h,ffh
+			ld	h,b
+			call	nz,L741e
+			and	d
+			and	c
+			ld	hl,(6307h)
+			ret	p
+			and	l
+			ex	af,af'
+			ld	l,l
+			xor	e
+			adc	a,l
+			ld	a,(hl)
+			rst	10h
+			or	l
+			rst	18h
+			ld	h,(hl)
+			ld	e,b
+			inc	(hl)
+			rst	08h
+			or	(hl)
+			ld	d,e
+			ld	(hl),e
+			call	p,L1053
+			call	po,L4d78
+			call	po,L349d
+			cp	b
+			ret	m
+			ld	(hl),b
+			jp	m,L0ba2
+			nop (2x) *
+			call	po,L1532
+			and	e
+			di
+			ld	l,b
+			xor	h
+			call	nz,Le91a
+			cp	c
+			dec	h
+			inc	d
+			adc	a,a
+			and	39h
+			cpl
+			ld	l,e
+			dec	b
+			out	(98h),a
+			or	7ah
+			adc	a,h
+			ld	a,(de)
+			rst	38h
+			call	po,L391e
+			call	z,Lc096
+			ld	b,h
+			jr	L7a66
+			db	f3h,6fh,06h,58h,b9h,adh,4fh,44h
+			db	96h,adh,17h,3bh,25h,83h,47h,8fh
+			db	e6h,94h,97h,2ch,73h,20h,94h,48h
+			db	98h,90h,e4h,cbh,14h,47h,b7h,e0h
+			db	bch,0dh,1dh,45h,dah,5eh,5dh,95h
+			db	c7h,60h,8bh,e2h,2eh,8eh,90h,46h
+			db	4ch,32h,07h,bch,9ah,bch,49h,bah
+			db	93h,c2h,ffh,4ah
+			rla
+			and	(hl)
+			pop	de
+			ld	a,b
+			ld	h,4fh
+			ld	(hl),l
+			ld	e,c
+			rst	20h
+			ld	a,a
+			rst	20h
+			push	bc
+			jr	c,L7a05
+			ld	h,h
+			ld	l,b9h
+			ret	po
+			inc	a
+			and	h
+			rst	28h
+			ld	h,c
+			inc	de
+			ret	p
+			sub	l
+			pop	hl
+			ld	bc,a7cbh
+			and	a
+			inc	e
+			ld	c,b
+			pop	de
+			ld	c,d
+			cp	e
+			ld	e,h
+			ld	a,e
+			jr	nz,L7a5c
+			ld	a,(de)
+			rlca
+			add	hl,sp
+			xor	l
+			or	(hl)
+			sbc	a,d
+			rst	28h
+			dec	bc
+			nop
+			jp	nc,Ld4bd
+			ld	e,(hl)
+			ld	e,e
+			rst	10h
+			rst	30h
+			ret	nz
+			jp	c,L24d3
+			add	hl,bc
+			ld	l,b
+			inc	l
+			ret	z
+			ld	b,97h
+			sbc	a,abh
+			jp	m,Lc9a6
+			ld	c,h
+			ld	d,e
+			ld	e,d
+			ld	b,a
+			ret	nz
+			cp	l
+			call	pe,L4bd1
+			ld	l,l
+			xor	l
+			ld	bc,6292h
+			inc	l
+			ld	e,a
+			adc	a,h
+			sub	c
+			ld	e,a
+			ld	a,feh
+			ld	d,l
+			cp	b
+			sbc	a,l
+			call	z,L8dba
+			ld	e,b
+			ld	h,b
+			ld	d,b
+			ld	d,d
+			adc	a,h
+			exx
+			jp	Lb8c5
+			db	45h,3ch,28h,67h,2ch,11h,20h,e0h
+			db	4dh,52h,27h,c1h,c1h,6ch,d5h,dfh
+			db	c4h,89h,57h,feh
+			and	a
+			ld	hl,2b0ah
+			adc	a,74h
+			call	La170
+			ld	hl,(c6eah)
+			ld	b,l
+			ld	d,h
+			djnz	L7abd
+			jp	po,Laca2
+			ret	z
+			ret	c
+			ld	b,b
+			or	ddh
+			halt
+			add	a,a
+			inc	sp
+			call	p,L50c2
+			ld	d,b
+			ld	a,e
+			cp	0ah
+			dec	c
+			rst	38h
+			ret	pe
+			ld	b,b
+			add	a,e
+			in	a,(a2h)
+			ld	l,l
+			ex	af,af'
+			inc	sp
+			ld	e,(hl)
+			bit	7,l
+			xor	d
+			ld	bc,b9d4h
+			ld	(hl),b
+			jr	L7b0d
+			db	a0h,10h,b9h,7dh,1dh,d8h,01h,21h
+			db	94h,2eh,08h,e3h,fbh,1fh,b4h,b3h
+			db	93h,83h,63h,65h,bfh,0ah,8bh,b7h
+			db	c7h,a3h,1ah,69h,18h,14h,92h,62h
+			db	dbh,14h,52h,f4h,fch,9dh,80h,5fh
+			db	7ah,6fh,4dh,55h,76h,63h,f0h,14h
+			db	1bh,72h,2ah,2fh,fah,2bh,5dh,3dh
+			db	9bh,14h,35h,33h,c5h,e6h,45h,2ch
+			db	55h,52h,c9h,ceh,eeh,40h,5ch,b3h
+			sub	d
+			rrca
+			sub	d
+			dec	hl
+			ret	z
+			dec	a
+			ld	h,h
+			push	de
+			inc	(hl)
+			and	(hl)
+			jp	z,L6b57
+			call	pe,Ld516
+			ret	nz
+			adc	a,c
+			ld	c,h
+			sbc	a,e
+			jp	L137b
+			db	96h,eah,02h,55h,39h,85h,f5h,d0h
+			db	9dh,26h,ddh,5ah,b4h,5ah,f9h,39h
+			db	c4h,9eh,27h,deh,4ah,d1h,dbh,d5h
+			db	efh,d2h,f2h,eeh,4ah,b5h,52h,6ah
+			db	2bh,34h,9fh,6bh,e5h,e5h,fah,64h
+			db	d7h,30h,6bh,fch,a8h,91h,e6h,4fh
+			db	3fh,efh
+			ld	c,d
+			ld	l,h
+			inc	b
+			ld	d,b
+			res	4,h
+			ld	de,d9beh
+			ld	h,e
+			ld	a,c
+			rst	38h
+			adc	a,43h
+			call	nc,Lf306
+			ld	h,d
+			ld	b,b
+			inc	sp
+			ld	e,(hl)
+			ld	d,l
+			rst	28h
+			ld	a,(4596h)
+			cp	c
+			add	a,e
+			sbc	a,d
+			sub	b
+			push	af
+			ld	d,b
+			inc	hl
+			and	d
+			ld	b,(hl)
+			and	e
+			halt
+			xor	h
+			inc	l
+			nop (2x) *
+			ld	a,c
+			nop
+			add	a,h
+			ld	l,c
+			ld	e,b
+			sbc	a,a5h
+			cp	99h
+			jp	nc,La414
+			ld	b,d
+			ld	e,c
+			add	a,l
+			ld	h,b
+			sub	e1h
+			inc	b
+			ld	b,b
+			ret	po
+			sub	l
+			add	hl,bc
+			ld	sp,hl
+			or	c
+			ld	a,deh
+			sbc	a,h
+			ld	de,3eb6h
+			ld	h,(hl)
+			ld	d,(hl)
+			ld	e,c
+			jr	z,L7c1e
+			call	p,L627d
+			ld	e,a
+			ld	(hl),l
+			ld	sp,hl
+			ld	e,h
+			or	b
+			inc	d
+			ld	(hl),a
+			ld	d,6ah
+			ld	(78a4h),hl
+			ld	b,e
+			xor	a
+			add	a,h
+			jp	nz,L1eb7
+			call	pe,Laece
+			inc	e
+			ld	d,h
+			adc	a,h
+			sbc	a,b
+			cp	a
+			ld	a,(de)
+			ld	b,a
+			ld	a,c
+			push	hl
+			dec	b
+			rrca
+			sbc	a,l
+			add	a,e
+			adc	a,b
+			sub	l
+			ld	b,e
+			ld	l,b
+			exx
+			and	e
+			dec	sp
+			ld	l,(hl)
+			ld	e,(hl)
+			add	a,(hl)
+			inc	h
+			sbc	a,h
+			nop
+			inc	d
+			ld	(hl),d
+			ret	p
+			nop (2x) *
+			jr	z,L7bf5
+			pop	de
+			ld	(hl),l
+			xor	h
+			ld	c,b
+			adc	a,a6h
+			inc	h
+			ld	(hl),l
+			dec	c
+			out	(0bh),a
+			dec	e
+			jp	c,Ld538
+			ld	a,49h
+			add	a,b
+			cp	a
+			dec	e
+			rra
+			cp	d
+			pop	bc
+			ld	(hl),a
+			add	a,l
+			and	(hl)
+			ret
+			db	65h,6fh,5bh,1ah,a8h,edh,7bh,f9h
+			db	1ah,eah,96h,1bh,8bh,e5h,b7h,ffh
+			db	24h,7eh,cbh,9eh,e3h,67h,d2h,21h
+			db	e3h,4eh,b3h,d9h,e7h,c8h,5eh,e7h
+			db	c7h,3bh
+			sub	b
+			call	pe,L7e7c
+			and	(hl)
+			sbc	a,e
+			call	L80f3
+			xor	a
+			inc	bc
+			and	h
+			sub	c
+			ret	p
+			inc	b
+			ld	a,c
+			xor	e
+			ld	c,h
+			dec	h
+			add	hl,hl
+			dec	a
+			ld	a,a
+			or	(hl)
+			ld	(hl),26h
+			ld	(hl),a
+			ld	(hl),h
+			and	l
+			jp	p,L87b1
+			xor	dfh
+			inc	b
+			ld	d,l
+			ld	b,b
+			ld	a,(hl)
+			or	e
+			ld	b,a
+			add	a,h
+			and	l
+			ld	e,h
+			ld	a,c
+			sbc	a,h
+			or	a
+			sub	c
+			and	c
+			rrca
+			ld	h,b
+			jp	pe,L3152
+			ld	a,(de)
+			jp	(hl)
+			db	d6h,e7h,75h,17h,6bh,d4h,b6h,07h
+			db	2ah,0dh,11h,b1h,09h,02h,8ah
+			and	a
+			adc	a,l
+			ld	(hl),l
+			adc	a,e
+			dec	hl
+			push	bc
+			ld	h,c9h
+			ld	l,(hl)
+			ld	h,e
+			cp	(hl)
+			ld	e,d
+			rrca
+			nop (2x) *
+			ld	e,d
+			in	a,(adh)
+			ex	de,hl
+			sbc	a,a
+			ld	d,b
+			jp	nc,L17ca
+			dec	de
+			dec	hl
+			dec	b
+			ld	c,h
+			inc	h
+			add	a,b
+			ld	d,b
+			sbc	a,0dh
+			pop	bc
+			out	(a9h),a
+			jp	nz,L2244
+			jp	pe,L08db
+			and	05h
+			ld	e,c
+			or	c
+			dec	d
+			nop
+			xor	a
+			jp	L4429
+			db	b4h,62h,e3h,c4h,f0h,76h,c8h,b8h
+			db	6dh,53h,cdh,a9h,d8h,3bh,59h,52h
+			db	c3h,90h,75h,deh,e4h,5ch,feh,14h
+			db	40h,79h,7fh,99h,84h,a4h,97h,65h
+			db	5bh,a4h,91h,19h,6dh,f5h,13h,7bh
+			db	38h,91h,41h,41h
+			sbc	a,c
+			ld	a,b
+			sub	(iy + 0dh)
+			ld	c,c
+			jp	z,Lf46f
+			add	a,h
+			ld	a,(bc)
+			ld	b,c
+			ld	h,(hl)
+			pop	bc
+			sub	6ah
+			cp	e
+			ret	nc
+			adc	a,e
+			call	z,Lc1ac
+			inc	sp
+			add	a,e
+			and	c
+			inc	sp
+			ld	a,a
+			ld	(hl),c
+			dec	hl
+			jr	nc,L7d15
+			sub	c
+			call	nz,L9902
+			xor	a
+			adc	a,h
+			jp	(hl)
+			db	41h,a5h,21h,38h,0eh,6fh,ceh,7ch
+			db	55h,dbh,a1h,26h,9ch,86h,8ah,ech
+			db	84h,26h,0eh
+			ld	c,d
+			sbc	a,a
+			ret	nc
+			ld	h,b
+			jp	z,L2301
+			xor	18h
+			dec	(hl)
+			inc	h
+			pop	bc
+			ld	h,bdh
+			ret	pe
+			or	(hl)
+			jr	nc,L7cd8
+			rst	10h
+			rla
+			ex	af,af'
+			ld	c,l
+			add	hl,sp
+			ld	a,(hl)
+			ld	d,(hl)
+			sub	b
+			ld	d,l
+			push	af
+			ei
+			ld	h,l
+			sub	(hl)
+			out	(83h),a
+			ld	a,e
+			ld	a,08h
+			ld	d,h
+			nop
+			xor	e
+			add	hl,bc
+			out	(11h),a
+			jp	po,L6c68
+			sub	05h
+			out	(76h),a
+			scf
+			inc	a
+			adc	a,a
+			rst	08h
+			dec	c
+			dec	(hl)
+			jp	pe,L84fa
+			jp	(hl)
+			db	2eh,d6h,65h,d8h,6dh,4bh,dah,a4h
+			db	6bh,78h,47h,0bh,47h,35h,a9h,4bh
+			db	76h,40h,d9h,1ah,4ah,7ah,9fh,37h
+			db	5bh,36h,ceh,14h,f9h,c8h,65h,3ah
+			db	37h,abh,d9h,a7h,d3h,f5h,70h,ffh
+			db	62h,d6h,3dh,4fh,4eh,27h,6ch,4ch
+			db	3fh,f8h,78h,40h,beh,9ch,e3h,d0h
+			db	a9h,67h
+			cp	h
+			exx
+			ld	h,d
+			jp	z,Ldf65
+			ld	a,c
+			add	a,e
+			cpl
+			sub	d
+			ld	a,d
+			ld	e,fdh
+			rrca
+			jr	L7db5
+			db	87h,a7h
+			ld	c,(hl)
+			rst	08h
+			sub	b
+			ld	a,a
+			ld	b,a
+			xor	b
+			add	a,b
+			djnz	L7e40
+			nop (2x) *
+			ld	(bc),a
+			xor	d
+			dec	e
+			jp	z,L95a7
+			or	l
+			ld	d,e
+			and	e
+			dec	sp
+			ld	(iy + 27h),c
+			xor	h
+			ld	b,e
+			xor	a9h
+			call	p,L1457
+			ld	l,94h
+			nop (2x) *
+			nop (2x) *
+			jr	z,L7e28
+			pop	de
+			ld	a,l
+			sub	28h
+			ret
+			db	d5h,47h,c5h,fbh
+			inc	h
+			ld	e,c
+			push	bc
+			ld	h,d
+			sbc	a,d
+			ld	c,a
+			ld	(hl),b
+			ld	a,(bc)
+			add	a,d
+			ret	m
+			scf
+			ld	l,l
+			rra
+			call	po,Lccb5
+			add	hl,de
+			out	(2ch),a
+			ld	e,f3h
+			ld	l,c
+			sbc	a,h
+			ld	h,c
+			sub	ech
+			add	hl,bc
+			inc	a
+			ld	(c1cdh),a
+			and	e
+			cp	d
+			ld	a,e
+			ret	p
+			or	c
+			xor	a
+			ld	c,ffh
+			ld	a,b
+			ld	c,c
+			sub	d
+			or	b
+			cp	e
+			and	l
+			dec	e
+			ld	c,c
+			ld	c,h
+			jr	nc,L7e89
+			ld	(hl),h
+			ld	a,e
+			rst	30h
+			xor	l
+			ld	a,(hl)
+			or	19h
+			dec	bc
+			cpl
+			jp	po,L1f73
+			and	a
+			sbc	a,a
+			in	a,(8bh)
+			inc	hl
+			cp	b
+			ld	sp,hl
+			ld	(hl),c
+			inc	hl
+			ld	a,(hl)
+			ld	c,b
+			adc	a,d
+			ld	b,d
+			sbc	a,2ah
+			ld	h,l
+			jp	p,La6e6
+			ret	nc
+			ld	e,e
+			ld	h,(hl)
+			sub	e
+			jp	L7775
+			db	beh
+			scf
+			ld	(02dch),hl
+			add	a,e
+			jp	pe,Led53
+			ld	e,a
+			add	a,h
+			inc	bc
+			and	(hl)
+			ld	e,b
+			add	a,c
+			and	(hl)
+			ld	sp,hl
+			ld	(d75ch),a
+			ld	h,59h
+			pop	de
+			ex	de,hl
+			ex	de,hl
+			ld	l,(hl)
+			xor	99h
+			cp	e
+			ld	e,c
+			add	hl,sp
+			ld	(hl),l
+			out	(61h),a
+			rra
+			jr	c,L7df5
+			ld	a,24h
+			ccf
+			xor	a
+			dec	l
+			add	a,l
+			ret	c
+			xor	(hl)
+			ld	a,(02dbh)
+			and	l
+			cp	b9h
+			ld	c,l
+			ld	d,a
+			ld	(hl),c
+			ld	e,e
+			ld	a,h
+			add	hl,sp
+			ld	h,b
+			rst	18h
+			inc	d
+			xor	b
+			call	Lbc2f
+			add	a,l
+			or	d
+			inc	h
+			adc	a,e
+			ld	h,l
+			ld	a,h
+			add	a,h
+			ld	e,l
+			cp	d
+			sub	1bh
+			ld	e,d7h
+			ld	h,e
+			di
+			sub	c
+			ret	nz
+			ld	a,19h
+			dec	de
+			call	nc,L1cb7
+			cp	l
+			ld	l,h
+			add	hl,de
+			ld	d,b8h
+			jr	c,L7e4e
+			ld	(2d69h),a
+			ld	h,e
+			ld	sp,hl
+			ei
+			call	nc,Lbe62
+			or	(hl)
+			dec	sp
+			add	hl,hl
+			ld	c,h
+			ld	hl,1223h
+			ld	de,e842h
+			ld	e,e
+			scf
+			call	z,L2ecf
+			inc	de
+			nop
+			jp	z,L848b
+			call	po,Lf948
+			adc	a,c
+			call	p,Lb088
+			call	L4fd6
+			ld	l,e7h
+			add	hl,sp
+			adc	a,a
+			add	hl,hl
+			ret	nz
+			xor	h
+			ccf
+			jp	po,L5cef
+			ld	h,c
+			daa
+			jp	nz,L23a4
+			or	d
+			cp	e
+			inc	sp
+			rst	08h
+			inc	d
+			call	m,L5ad2
+			inc	h
+			ld	bc,b8f9h
+			ld	(hl),b
+			call	c,Lecc6
+			ret	c
+			sub	c
+			dec	l
+			sbc	a,a
+			ret	po
+			daa
+			ret	p
+			inc	l
+			bit	2,e
+			ex	af,af'
+			jr	L7ef1
+			db	26h
+			ret	pe
+			or	dfh
+			ret	nc
+			inc	sp
+			rst	38h
+			ld	c,h
+			ex	de,hl
+			xor	b
+			ld	(hl),l
+			call	nz,L65cc
+			jp	pe,L77ca
+			ld	e,l
+			add	hl,bc
+			ex	af,af'
+			push	de
+			inc	b
+			sub	l
+			ld	c,e
+			cp	h
+			ld	b,d
+			ld	(hl),l
+			ld	a,l
+			add	a,d
+			ld	hl,(c7dbh)
+			jp	(hl)
+			db	a3h,b7h,19h,3eh,7ch,53h,89h,1dh
+			db	8eh,a0h,08h,19h,89h,05h,16h,04h
+			db	fah,dah,cch,ceh,25h,8bh,d4h,6fh
+			db	cch,7eh,5eh,33h,9ah,04h,c7h,6dh
+			db	f9h,1bh,d4h,eah,f6h,2dh,0eh,66h
+			db	dch,70h,a6h,1eh,6ch,24h,56h,03h
+			db	d0h,2eh,adh,9eh,e3h,33h,a1h,68h
+			db	c1h,e6h,9eh,c1h,4dh,8bh,28h,0eh
+			db	9dh,b1h,76h,cbh
+			cp	a
+			sub	(hl)
+			ld	(hl),e
+			dec	bc
+			and	b
+			or	h
+			djnz	L7f16
+			inc	(hl)
+			ld	h,(hl)
+			pop	bc
+			ld	a,(de)
+			scf
+			ld	c,c
+			ld	a,01h
+			add	hl,bc
+			inc	sp
+			ld	h,a
+			ld	h,c
+			ret	nc
+			exx
+			sbc	a,d
+			srl	a
+			jr	c,L7f00
+			ld	a,(hl)
+			ld	e,b
+			xor	e
+			ld	sp,daeah
+			or	33h
+			adc	a,b
+			ld	l,b
+			and	h
+			ei
+			ld	l,e
+			and	e
+			jr	nz,L7fe5
+			rst	18h
+			ld	h,a
+			sub	b
+			jr	nc,L8013
+			ld	a,(de)
+			call	nz,L9e2c
+			ld	l,d
+			xor	(hl)
+			add	a,(hl)
+			ld	(hl),48h
+			sbc	a,d
+			ld	b,a7h
+			inc	b
+			ld	bc,4783h
+			inc	bc
+			pop	bc
+			add	hl,sp
+			xor	16h
+			cp	(hl)
+			xor	l
+			ld	l,h
+			dec	c
+			call	c,L340f
+			rlca
+			ld	d,5ah
+			or	b
+			sbc	a,b
+			exx
+			add	a,a
+			call	m,Lf656
+			call	m,Lc332
+			pop	hl
+			or	h
+			dec	a
+			ld	l,e6h
+			ld	(bc),a
+			inc	bc
+			jr	nc,L7f64
+			ld	h,c
+			jr	c,L8017
+			add	a,d
+			xor	h
+			call	z,L785f
+			dec	(hl)
+			ld	e,l
+			cp	05h
+			add	a,26h
+			adc	a,l
+			sbc	a,a
+			ld	l,e
+			sub	e
+			ld	d,e
+			exx
+			ld	a,(2f88h)
+			call	pe,L3d18
+			inc	h
+			xor	l
+			dec	b
+			dec	bc
+			add	hl,hl
+			cp	b
+			adc	a,l
+			inc	e
+			cp	(hl)
+			ld	h,d
+			call	pe,L8d03
+			cp	e
+			ld	(de),a
+			xor	d
+			ld	c,(hl)
+			xor	h
+			and	d
+			ex	de,hl
+			ld	h,a
+			ld	a,e
+			or	h
+			ld	d,b
+			xor	d
+			ld	(hl),l
+			ld	d,h
+			jp	m,L5aff
+			and	h
+			and	l
+			scf
+			ld	(hl),77h
+			or	h
+			ld	a,c6h
+			ld	sp,hl
+			cpl
+			ld	sp,hl
+			xor	a
+			adc	a,e
+			cp	c
+			ld	l,c
+			ld	l,h
+			ld	hl,(1c52h)
+			ld	h,e
+			call	nz,Le7e3
+			adc	a,cdh
+			jr	L804f
+			db	5ch,71h,3ch,a1h,6eh,4bh,77h,e9h
+			db	ebh,0ch
+			ex	(sp),hl
+			rst	10h
+			adc	a,e
+			ld	c,c
+			ld	(hl),e
+			dec	hl
+			and	l
+			ret	nz
+			ld	e,h
+			jr	nc,L8000
+			and	b
+			inc	b
+			and	d
+			rst	10h
+			and	h
+			or	b
+			ld	c,b
+			rst	30h
+			ex	af,af'
+			ld	d,b
+			sub	(hl)
+			inc	h
+			or	e
+			ld	c,d
+			call	L5996
+			xor	1ch
+			dec	e
+			add	hl,hl
+			dec	h
+			xor	88h
+			ld	(hl),e
+			jp	po,L1f35
+			push	hl
+			ret	nc
+			sbc	a,h
+			ex	de,hl
+			ld	l,a
+			ld	d,c
+			ld	c,e
+			ld	h,e
+			adc	a,a
+			jp	(hl)
+			db	8bh,0fh,1ah,75h,5dh,33h,d5h,1bh
+			db	0bh,77h,33h,dfh
+			sub	(hl)
+			jp	p,L6f82
+			ld	l,38h
+			ld	l,c
+			ld	l,b
+			jp	nc,L3e7d
+			ld	h,h
+			adc	a,c
+			dec	b
+			or	c
+			ld	b,d
+			call	z,Lbb06
+			ld	c,a
+			sbc	a,b
+			rrca
+			ld	c,c
+			ld	a,(d5bah)
+			or	d
+			call	z,L9af8
+			ld	l,b
+			bit	7,l
+			rrca
+			add	a,h
+			sub	h
+			ld	h,(hl)
+			ld	(hl),b
+			ld	d,h
+			call	po,L1860
+			ld	e,l
+			xor	a3h
+			ld	c,d
+			xor	b
+			and	e
+			or	a
+			call	nz,La362
+			xor	h
+			ret	nz
+			sbc	a,l
+			dec	h
+			or	(hl)
+			ld	a,e
+			ret	m
+			dec	a
+			add	a,a
+			inc	h
+			ret	po
+			call	po,L4eac
+			ld	c,c
+			push	de
+			ld	b,05h
+			add	hl,bc
+			xor	30h
+			jp	nc,L56d0
+			ld	(hl),a
+			jp	pe,Lad01
+			adc	a,h
+			rla
+			ld	b,fch
+			sbc	a,1ch
+			ld	a,(hl)
+			halt
+			adc	a,d
+			inc	l
+			ld	(de),a
+			call	po,L33e6
+			jp	z,L3701
+			sub	h
+			ld	h,h
+			inc	h
+			ld	h,b4h
+			nop
+			ld	(bc),a
+			cp	l
+			ld	d,l
+			inc	bc
+			ld	sp,c95ch
+			push	hl
+			and	a
+			xor	(hl)
+			ld	l,a
+			call	po,L2e37
+			ld	a,(bc)
+			ld	b,l
+			dec	b
+			ld	d,d
+			dec	hl
+			ld	(hl),e
+			ret	nz
+			ld	l,h
+			ld	sp,hl
+			ld	a,(de)
+			ld	hl,952bh
+			ld	bc,2e15h
+			cp	h
+			cp	4bh
+			ld	sp,836ch
+			ld	h,b
+			and	h
+			add	a,e
+			call	pe,L3a3c
+			ld	e,l
+			sub	e
+			ret	z
+			pop	hl
+			ld	a,e
+			and	h
+			ld	h,c
+			ld	b,a
+			or	e
+			cp	h
+			dec	bc
+			sub	h
+			ld	(bc),a
+			di
+			ret	po
+			inc	l
+			and	d
+			jp	z,Le2e8
+			add	hl,de
+			xor	c
+			jp	(hl)
+			db	9bh,55h,f1h,8eh,53h,e8h,63h,8eh
+			db	feh,34h,1bh,1ah,d7h,c0h,04h,f5h
+			db	cbh,6ch,05h,d0h,27h,ddh,17h,4fh
+			db	bfh,3fh,3dh,ach,9ch,1bh,3ah,f4h
+			db	17h,d1h,dfh,71h,53h,e1h,1dh,2fh
+			db	54h,90h,96h,11h,a2h,f7h,1bh,32h
+			db	48h,19h,1ah,6fh,59h,23h,71h,b1h
+			db	e2h,1ch
+			jp	nz,L669b
+			ld	c,b
+			ld	a,d
+			ex	(sp),hl
+			ld	a,(bc)
+			add	a,c
+			or	(hl)
+			sub	l
+			ld	d,0ch
+			rst	10h
+			add	a,e
+			ld	(hl),l
+			ld	(de),a
+			inc	h
+			ld	c,(hl)
+			rst	00h
+			rst	08h
+			pop	af
+			ld	e,6eh
+			sub	h
+			dec	l
+			ld	a,c7h
+			ld	e,l
+			ld	c,d1h
+			inc	hl
+			rst	08h
+			or	h
+			ld	(hl),d
+			ld	c,a
+			ccf
+			adc	a,d
+			push	af
+			rrca
+			ld	e,c
+			xor	h
+			exx
+			cp	d
+			ld	a,(5f24h)
+			ld	l,(hl)
+			ld	(hl),l
+			cp	d
+			ld	l,b
+			add	a,a7h
+			add	hl,de
+			halt
+			ld	h,d
+			ld	c,e8h
+			ld	de,4518h
+			inc	bc
+			ld	e,c
+			dec	h
+			add	hl,de
+			dec	bc
+			ld	l,d
+			ld	l,c
+			nop (2x) *
+			sbc	a,c
+			ei
+			or	d
+			ld	d,a
+			ld	d,a
+			and	d
+			ld	l,c
+			add	a,e
+			rst	18h
+			jp	po,Le311
+			jp	nz,L80c0
+			ld	l,l
+			ld	a,(bc)
+			ld	(265fh),hl
+			ld	(b6d2h),hl
+			sbc	a,d
+			cp	b
+			cp	c
+			ld	a,e
+			ld	l,h
+			or	c
+			ld	a,d
+			ld	h,e
+			inc	sp
+			nop (2x) *
+			ld	e,90h
+			or	c
+			ld	d,h
+			dec	e
+			ld	b,l
+			ld	bc,2e56h
+			cp	d
+			and	e
+			ld	hl,0be3h
+			xor	(hl)
+			xor	d
+			ld	c,l
+			and	c
+			djnz	L8142
+			xor	b
+			sub	h
+			jp	(hl)
+			db	b7h,3eh,f5h,ddh,3ah,07h,e7h,59h
+			db	9ah,c8h,19h,dch,6eh,84h
+			add	hl,de
+			adc	a,a
+			scf
+			ld	c,a
+			cp	(hl)
+			ld	(hl),h
+			xor	(hl)
+			daa
+			ld	d,d
+			ld	a,35h
+			ret	c
+			and	b
+			nop (2x) *
+			ei
+			ld	l,d
+			dec	h
+			add	a,40h
+			jp	z,L8438
+			jr	L81cd
+			db	fah,e4h,c7h,c1h,cch,67h,b6h,73h
+			db	8fh,13h,41h,38h,79h,9bh,72h,49h
+			db	ffh,0ch,39h
+			halt
+			or	(hl)
+			ld	(hl),c
+			pop	af
+			ld	a,(3bc8h)
+			ld	e,l
+			call	nc,Lf92d
+			and	c
+			or	h
+			set	0,l
+			ld	e,h
+			ex	(sp),hl
+			ld	c,d
+			add	hl,bc
+			ld	c,l
+			ret	nc
+			dec	l
+			ld	(4e34h),hl
+			di
+			add	a,h
+			jp	Lcb87
+			db	b6h,83h,aah,2bh,18h,fbh,abh,49h
+			db	7ah,4eh,92h,dfh,37h,d4h,e7h,81h
+			db	ddh,33h,60h,3dh,70h,a0h,abh,87h
+			db	3ah,37h,67h,a8h,24h,b1h,ceh,d9h
+			db	d3h,6bh,cch,b7h,51h
+			jr	nc,L81f8
+			or	cch
+			ld	sp,62f4h
+			jr	nc,L82b0
+			di
+			nop (2x) *
+			inc	de
+			jr	c,L8200
+			ld	b,c
+			sub	b
+			jr	nc,L81df
+			rst	20h
+			ld	d,a
+			add	a,h
+			ld	l,l
+			dec	l
+			sbc	a,d
+			dec	a
+			ld	(hl),e
+			add	a,h
+			ld	de,031ch
+			and	e
+			ld	a,b
+			add	hl,hl
+			jp	po,L1d8e
+			sbc	a,(hl)
+			sub	6dh
+			ld	d,e
+			pop	af
+			and	a
+			ld	h,(hl)
+			dec	h
+			ld	h,b
+			ld	l,a
+			add	a,d
+			ld	h,c
+			out	(95h),a
+			and	(hl)
+			ret	p
+			ld	a,d
+			ld	e,a
+			and	38h
+			cp	d
+			or	a
+			ret	z
+			ld	e,e
+			inc	d
+			ld	d,e
+			indr
+			adc	a,e
+			cpl
+			and	a
+			ccf
+			sbc	a,d
+			ld	l,h
+			or	c3h
+			jp	nc,L8400
+			nop (2x) *
+			call	m,Lb26a
+			ld	l,c
+			sbc	a,d
+			cp	e
+			ld	(hl),b
+			push	af
+			rst	28h
+			sub	b
+			ld	(hl),b
+			call	pe,L61b8
+			cp	a
+			inc	hl
+			push	bc
+			cp	ixh *
+			ld	h,bdh
+			ld	h,d
+			inc	bc
+			adc	a,e
+			and	36h
+			sbc	a,l
+			ld	d,l
+			sub	b
+			ld	a,a
+			ld	d,(hl)
+			ld	(71b3h),a
+			xor	d
+			sub	b
+			ld	b,h
+			inc	bc
+			call	c,L1035
+			pop	af
+			sbc	a,(hl)
+			rst	10h
+			rst	20h
+			ld	(hl),l
+			ret	pe
+			ld	l,l
+			jp	z,L86f7
+			jr	nz,L82af
+			xor	e
+			call	L567f
+			inc	e
+			jp	p,L3c23
+			adc	a,(hl)
+			ld	(hl),h
+			ld	h,fch
+			sbc	a,d
+			rst	00h
+			add	a,c2h
+			exx
+			adc	a,e
+			cp	cfh
+			jp	p,Le99a
+			add	a,l
+			ld	c,e
+			ld	h,c
+			adc	a,a
+			inc	b
+			dec	h
+			or	a
+			ld	c,d
+			inc	bc
+			ld	e,l
+			ret	m
+			adc	a,b
+			xor	e
+			ret	z
+			adc	a,l
+			di
+			cp	(hl)
+			sbc	a,e
+			halt
+			adc	a,h
+			ld	l,c
+			rla
+			sub	c
+			ld	b,a
+			sub	b
+			ld	d,l
+			and	c
+			call	p,L70d8
+			or	57h
+			push	bc
+			call	L363c
+			push	af
+			adc	a,c
+			inc	sp
+			call	p,Ld0d8
+			ld	d,8ch
+			inc	d
+			ld	e,l
+			ret	p
+			ld	e,c
+			ld	b,a
+			out	(25h),a
+			nop (2x) *
+			push	bc
+			ld	sp,29fah
+			ret	p
+			jr	L8370
+			db	06h,47h,3bh,89h,40h,4eh,adh,61h
+			db	f1h,2ah,69h,60h,feh,16h,7dh,71h
+			db	68h,78h,00h,54h,14h,cdh,24h,63h
+			db	5eh,76h,c2h,29h,01h,f6h,f9h,80h
+			db	7ah,0bh,e2h,eah,ddh,6ch,43h,58h
+			db	2eh,11h,c4h,6bh,2bh,92h,f1h,f1h
+			cp	e
+			rst	30h
+			set	3,a
+			add	a,a
+			jr	nz,L83ab
+			inc	c
+			adc	a,e
+			cp	c
+			add	a,51h
+			add	a,l
+			call	c,L5a88
+			exx
+			cp	e
+			adc	a,e
+			push	hl
+			ld	h,e
+			ld	sp,d5f1h
+			ld	b,2ah
+			ret	pe
+			ld	a,a
+			call	pe,L2998
+			ccf
+			adc	a,(hl)
+			push	de
+			jr	z,L83e0
+			inc	hl
+			ld	c,d
+			add	hl,hl
+			ld	d,86h
+			ld	h,c
+			adc	a,l
+			di
+			cp	5dh
+			ld	(bc),a
+			nop (2x) *
+			rra
+			ld	b,c
+			nop (2x) *
+			daa
+			ld	(hl),cah
+			jr	L8380
+			db	d5h,c4h,0ah,37h,b2h,c7h,2fh,27h
+			ld	hl,ad88h
+			ld	l,29h
+			and	f4h
+			ld	hl,2d75h
+			jp	p,Lc634
+			rst	08h
+			add	a,a
+			ld	b,e
+			rrca
+			or	c
+			add	hl,bc
+			sub	c
+			ld	c,d
+			ex	(sp),hl
+			ex	de,hl
+			and	e
+			inc	sp
+			add	a,l
+			ex	af,af'
+			ld	(hl),a
+			inc	(hl)
+			ld	c,02h
+			inc	(hl)
+			jp	po,L5ed4
+			push	de
+			ld	a,02h
+			ld	h,l
+			cp	e
+			ld	e,h
+			ld	b,c3h
+			ex	de,hl
+			or	l
+			or	l
+			ld	(hl),h
+			ld	d,(hl)
+			sub	a
+			and	e
+			add	a,(hl)
+			call	po,L5220
+			rra
+			ld	d,h
+			ld	hl,b7e3h
+			ret	po
+			ld	c,l
+			rst	38h
+			ld	a,(de)
+			ld	h,b
+			ld	d,l
+			ld	(hl),l
+			and	c
+			ld	h,d
+			ld	sp,8af7h
+			ex	af,af'
+			jr	c,L843f
+			sbc	a,b
+			ld	h,a
+			ld	l,h
+			ret	nz
+			dec	l
+			rst	28h
+			add	a,d
+			adc	a,h
+			add	a,a
+			ld	(hl),c
+			ld	h,a
+			cp	h
+			ld	h,e
+			rla
+			and	1ah
+			or	c
+			inc	c
+			adc	a,l
+			rlca
+			sub	d
+			inc	hl
+			and	a
+			ld	(hl),a
+			ld	a,l
+			ld	d,c
+			ld	a,c
+			xor	b
+			sub	e
+			xor	h
+			ld	a,e
+			rst	18h
+			ret	nz
+			pop	af
+			or	d
+			ld	b,e
+			ret
+			db	e7h,e6h,c9h,42h,5eh,15h,8ch,1eh
+			db	5eh,34h,c2h,feh,0bh,a2h,e4h,83h
+			db	d9h
+			and	(hl)
+			ld	h,b
+			ld	e,l
+			ld	(de),a
+			pop	bc
+			jp	pe,L3380
+			inc	hl
+			ret
+			db	81h,c3h,55h,adh,1eh,1ch,a7h,8dh
+			db	3dh,75h
+			exx
+			rst	08h
+			add	a,e
+			ld	a,(9cb2h)
+			ld	a,e
+			sub	e
+			ret	pe
+			pop	hl
+			jp	nz,L7ba1
+			rst	18h
+			ld	h,b
+			jr	z,L84a0
+			rrca
+			ex	de,hl
+			ret	po
+			inc	sp
+			inc	de
+			ld	d,c
+			inc	de
+			ld	sp,hl
+			sub	h
+			sub	d
+			ld	e,h
+			ld	(hl),d
+			ld	c,c
+			call	nz,Lccff
+			add	hl,hl
+			rla
+			ld	d,a
+			nop (2x) *
+			ld	(bc),a
+			ld	c,aeh
+			add	a,l
+			sub	l
+			xor	l
+			ld	de,ac1ch
+			ld	hl,9813h
+			ld	h,(hl)
+			jr	z,L8490
+			ld	a,e
+			ld	(hl),h
+			dec	b
+			ld	e,d
+			sbc	a,e
+			sbc	a,a
+			sbc	a,c
+			call	z,L9e45
+			ld	h,l
+			ld	b,(hl)
+			inc	c
+			ld	(hl),a
+			rra
+			and	h
+			ret	z
+			in	a,(64h)
+			cp	b
+			and	a
+			cp	e
+			push	af
+			cp	(hl)
+			sbc	a,c
+			dec	hl
+			inc	sp
+			ld	b,l
+			ld	l,(hl)
+			sbc	a,b
+			dec	d
+			ld	d,h
+			sub	b
+			adc	a,l
+			ld	b,d
+			ld	a,(0862h)
+			ld	b,e
+			pop	de
+			ld	sp,iy
+			ld	(hl),c
+			ld	b,e
+			add	a,d
+			daa
+			ld	e,(hl)
+			or	h
+			ret
+			db	ffh,7eh,12h,63h,abh,26h,23h,b1h
+			db	70h,0ah,3dh,5dh,f9h,34h,65h,0dh
+			db	0ch,e7h
+			ld	l,(hl)
+			inc	a
+			ret
+			db	e4h,6ah
+			or	c
+			ld	c,h
+			and	c
+			and	c
+			or	d
+			ld	h,h
+			xor	(hl)
+			ld	h,b
+			jp	(hl)
+			db	adh,6bh,5dh,dbh,c4h,92h,82h
+			di
+			call	c,Lbd2b
+			ld	a,(99ech)
+			xor	(hl)
+			ld	e,b
+			rst	38h
+			ld	h,a
+			jp	nz,Lf0e1
+			xor	a
+			call	z,Lf419
+			sbc	a,e
+			and	e
+			call	nz,L2d9b
+			call	nc,Lb275
+			pop	hl
+			inc	de
+			sbc	a,l
+			ld	(hl),b
+			sbc	a,c
+			and	c
+			cp	48h
+			sub	a
+			dec	h
+			ld	l,(hl)
+			ld	d,a
+			call	pe,Lf9e6
+			rst	18h
+			cp	h
+			inc	h
+			jp	z,Lb01f
+			inc	sp
+			dec	l
+			ld	h,l
+			inc	l
+			ld	l,b
+			inc	b
+			cp	b
+			or	c
+			ld	e,h
+			halt
+			ld	a,b
+			sub	b
+			push	de
+			call	nc,L91f9
+			adc	a,(hl)
+			sub	h
+			ld	a,(bc)
+			ld	(hl),c
+			ld	(hl),c
+			dec	h
+			dec	hl
+			ld	a,(d4afh)
+			sbc	a,d
+			in	a,(0ah)
+			ld	b,(hl)
+			sub	d
+			call	pe,Lc065
+			sbc	a,a
+			ld	b,d
+			add	hl,hl
+			ld	(de),a
+			rst	38h
+			rst	28h
+			rst	00h
+			inc	de
+			call	m,L34d7
+			adc	a,e
+			ld	b,l
+			sbc	a,a
+			sub	d
+			ld	l,b
+			ld	h,h
+			dec	b
+			jp	pe,L670f
+			pop	de
+			ex	(sp),hl
+			ld	d,e
+			dec	bc
+			ld	a,e
+			and	a
+			and	a
+			sbc	a,c
+			call	m,Le10a
+			ld	(hl),e0h
+			rra
+			rst	20h
+			ret	pe
+			ld	c,e
+			ld	b,l
+			di
+			and	e
+			dec	bc
+			set	4,h
+			xor	c
+			add	hl,bc
+			ld	c,b
+			daa
+			ld	b,(hl)
+			ld	e,a
+			ld	c,b
+			ld	a,d
+			ld	h,h
+			and	l
+			jp	m,Ld120
+			xor	h
+			inc	bc
+			dec	sp
+			jp	z,Ldf49
+			add	hl,bc
+			add	a,9ch
+			inc	b
+			inc	sp
+			inc	h
+			ld	c,c
+			ld	b,c9h
+			rst	20h
+			and	a
+			ld	(hl),l
+			dec	b
+			ld	a,l
+			ld	d,a
+			and	c
+			ld	c,b
+			ld	h,h
+			jr	L8554
+			db	ech,a5h,3ch,e7h,dch,b5h,33h,47h
+			db	f6h,e9h,7eh,9dh,0dh,06h,70h,41h
+			ret	m
+			ld	(hl),d
+			ld	e,l
+			call	L2396
+			add	hl,bc
+			ld	h,a
+			ret	z
+			ld	h,d
+			sub	l
+			dec	c
+			xor	l
+			halt
+			pop	bc
+			ld	(hl),l
+			dec	sp
+			ret	c
+			dec	b
+			push	bc
+			ld	a,d
+			xor	l
+			cp	65h
+			ld	c,b
+			exx
+			and	h
+			ret	m
+			push	de
+			ld	d,l
+			ld	b,a7h
+			dec	e
+			add	hl,hl
+			ld	(hl),b
+			ld	(hl),e
+			nop
+			cp	l
+			xor	(hl)
+			adc	a,b
+			ld	h,e
+			ld	(hl),b6h
+			xor	h
+			ex	(sp),hl
+			ld	a,b
+			inc	de
+			pop	bc
+			ld	a,(hl)
+			and	e
+			inc	bc
+			ret	nz
+			push	de
+			ld	sp,2f4fh
+			jr	nz,L8595
+			jr	z,L8563
+			ld	e,a
+			call	p,L3dba
+			call	Ld3df
+			sbc	a,c
+			ld	a,a
+			cp	b
+			sbc	a,h
+			ld	(hl),b
+			inc	c
+			rla
+			ld	h,l
+			inc	e
+			add	a,e
+			ret	z
+			and	(hl)
+			sub	h
+			push	af
+			adc	a,64h
+			and	h
+			ei
+			jr	c,L8613
+			or	e
+			di
+			jr	z,L8599
+			ld	e,d
+			cp	b1h
+			ex	(sp),hl
+			jp	nc,Lc2a1
+			inc	de
+			sbc	a,c
+			ld	(de),a
+			ld	d,a
+			and	e1h
+			sub	h
+			ld	e,c
+			call	c,L5bb6
+			ld	c,f8h
+			jr	nc,L8610
+			ex	af,af'
+			adc	a,l
+			ld	c,d
+			ld	h,l
+			rst	30h
+			ld	b,e
+			ld	c,a
+			add	a,h
+			rst	10h
+			ret	z
+			and	1ch
+			jp	p,L3bb1
+			dec	a
+			inc	c
+			inc	hl
+			ex	(sp),hl
+			ld	l,a3h
+			ld	c,(hl)
+			ld	b,a
+			dec	l
+			jp	pe,L6446
+			add	a,l
+			djnz	L8578
+			cp	d
+			rlca
+			sub	l
+			ld	b,c
+			sbc	a,a
+			xor	h
+			ld	e,h
+			xor	e
+			ld	l,d
+			ld	c,b
+			dec	hl
+			ld	c,a
+			jp	po,La0a6
+			ld	a,a
+			rst	28h
+			ld	b,(hl)
+			jp	pe,Lb99e
+			and	c4h
+			inc	sp
+			ld	de,9a3fh
+			ld	d,(hl)
+			or	30h
+			ld	l,e
+			adc	a,a
+			ld	hl,bba4h
+			add	hl,hl
+			ld	(hl),07h
+			call	po,Lff28
+			ld	c,l
+			dec	e
+			dec	bc
+			ld	c,d
+			jp	m,L52d3
+			push	hl
+			ld	a,h
+			ld	b,4ch
+			ld	d,d
+			ld	(hl),d
+			ld	(2426h),hl
+			rst	28h
+			push	de
+			jp	po,L8a12
+			rra
+			ret	nc
+			jr	nz,L8667
+			ld	d,e
+			ld	bc,2914h
+			ret	nz
+			pop	hl
+			ld	sp,56edh
+			xor	(hl)
+			or	c
+			di
+			cp	e
+			ld	a,d
+			jp	nz,L6c13
+			inc	d
+			ld	d,e
+			adc	a,b
+			rlca
+			ld	c,(hl)
+			ld	e,a6h
+			sub	c
+			call	po,L2f86
+			call	p,L5c26
+			ld	a,l
+			pop	af
+			ld	bc,8d1bh
+			dec	e
+			inc	de
+			sub	63h
+			call	m,L79d7
+			ld	c,c
+			ld	a,4ah
+			ld	de,827eh
+			xor	e
+			dec	h
+			call	nc,L24bd
+			ini
+			and	(hl)
+			ld	sp,351dh
+			sub	h
+			ld	h,a
+			ld	(hl),h
+			ld	l,b
+			call	m,L1380
+			ld	(hl),c
+			dec	h
+			or	(hl)
+			ld	e,c
+			ld	h,(hl)
+			add	hl,de
+			jp	m,L1744
+			add	a,(hl)
+			ld	b,a
+			ret
+			db	d9h,52h,e0h,53h,5eh,0fh,61h,f8h
+			db	19h,6ch,4ah,aah,17h,b7h,b3h
+			ld	b,c
+			xor	c
+			xor	h
+			ret	nz
+			cp	l
+			ld	b,e
+			cp	c
+			ld	d,33h
+			adc	a,(hl)
+			jr	nc,L86d8
+			ld	b,b
+			inc	(hl)
+			inc	c
+			call	po,Le56b
+			dec	a
+			sub	h
+			and	a
+			ld	e,d
+			and	l
+			ld	e,93h
+			ld	c,b
+			adc	a,c
+			jp	p,L0242
+			adc	a,d
+			ld	l,l
+			or	b
+			ld	d,b
+			rra
+			inc	sp
+			ld	d,a
+			cp	57h
+			sbc	a,h
+			jr	c,L8663
+			ld	l,h
+			inc	bc
+			push	af
+			sbc	a,83h
+			sbc	a,e
+			nop (2x) *
+			jp	Le6d6
+			db	24h,53h,69h,5dh,eeh,89h,18h,deh
+			db	11h,2fh,27h,32h,60h,73h,9dh,d3h
+			db	e1h,5bh,10h,b1h,cfh,13h,deh,f2h
+			db	b8h
+			dec	h
+			jp	z,La258
+			or	(hl)
+			sub	l
+			inc	b
+			ld	d,c
+			jp	po,L4c16
+			and	e
+			cp	h
+			jp	p,Lccb9
+			di
+			or	d
+			ld	b,l
+			or	(hl)
+			ld	a,(hl)
+			ret	c
+			ld	l,a
+			sub	b
+			dec	bc
+			or	d
+			ld	a,c
+			ld	(hl),e
+			ret	nz
+			add	hl,sp
+			cp	e
+			ld	l,(hl)
+			ld	d,l
+			dec	b
+			ld	h,a
+			ld	d,(hl)
+			ld	c,c
+			ld	l,e
+			or	b
+			xor	b
+			scf
+			ex	(sp),hl
+			adc	a,0fh
+			inc	l
+			cp	b
+			dec	b
+			rra
+			nop
+			ld	a,d
+			sll	d
+			ld	(hl),a
+			ld	(hl),e
+			ld	e,e
+			cp	h
+			pop	bc
+			cp	c
+			ld	b,(hl)
+			ld	a,01h
+			and	l
+			dec	(hl)
+			inc	sp
+			rla
+			ld	l,(hl)
+			ld	c,d
+			xor	b
+			cpl
+			jp	po,Leb8e
+			and	a
+			ld	hl,(821ch)
+			ld	d,b
+			and	53h
+			adc	a,b
+			or	a
+			ld	a,(7d08h)
+			or	l
+			inc	h
+			ld	a,22h
+			add	hl,de
+			jp	p,La94a
+			sbc	a,1ch
+			add	a,b
+			ld	a,d
+			ld	a,(b0c6h)
+			ld	a,a
+			ld	d,d
+			xor	d8h
+			adc	a,c
+			sub	l
+			cpl
+			set	6,h
+			sub	(hl)
+			ld	l,(hl)
+			di
+			ld	e,2fh
+			xor	b
+			rla
+			cp	(hl)
+			ld	(bc),a
+			di
+			sub	c
+			ld	b,e
+			ld	l,e
+			sbc	a,(hl)
+			ld	b,(hl)
+			ret	p
+			nop (2x) *
+			call	po,L3f77
+			ld	l,l
+			push	af
+			inc	b
+			and	(hl)
+			ld	(hl),l
+			ld	b,c
+			ld	e,48h
+			ex	de,hl
+			jr	L8776
+			db	8ah,1ah,f3h,b6h,5fh,ech,d2h,17h
+			db	b2h,e6h,dfh,5eh,12h,afh,26h,5fh
+			db	86h,58h,2dh,b3h,67h,8ch,31h,2eh
+			db	d6h,46h
+			rst	00h
+			ld	a,a
+			add	hl,sp
+			xor	l
+			call	m,Lc784
+			ld	a,d
+			ld	a,h
+			ld	c,a
+			rlca
+			jp	p,L6d18
+			add	a,a
+			ld	e,a
+			jp	Lcba8
+			db	14h,ach,17h,17h,43h,17h,d4h,17h
+			db	60h,97h,ech,3ch,61h,2ah,a5h,60h
+			db	7dh,bdh,8ch,b1h,a3h,d4h
+			rrca
+			pop	bc
+			ld	(bc),a
+			ld	l,a
+			cp	a
+			adc	a,41h
+			rra
+			ld	b,c
+			inc	hl
+			dec	bc
+			nop (2x) *
+			ld	b,l
+			cp	h
+			ld	h,c
+			inc	l
+			xor	h
+			ld	c,e
+			rst	28h
+			in	a,(42h)
+			ld	b,c
+			push	hl
+			ld	h,a
+			sub	e
+			or	h
+			out	(bbh),a
+			jp	nc,Lbd2e
+			ld	d,6dh
+			nop
+			and	b
+			sub	b
+			ld	hl,6824h
+			ld	sp,0e9ah
+			cp	adh
+			rra
+			ld	b,h
+			adc	a,b
+			ld	e,a
+			halt
+			xor	c
+			rst	20h
+			ld	c,h
+			ld	l,d
+			ret
+			db	0ch,93h,b2h,c5h,4fh,4eh,4bh,a6h
+			db	2dh,1eh,89h,7eh,35h,e0h,85h,b9h
+			db	dbh,31h,63h,95h,69h,39h,37h,11h
+			db	2dh,20h,5eh,42h,4eh,1dh,9bh,cbh
+			db	b2h,bbh
+			add	a,a
+			add	a,d
+			ld	a,(de)
+			add	a,(hl)
+			adc	a,e
+			ret	p
+			ld	b,e
+			adc	a,b
+			ld	d,9eh
+			ld	e,d
+			ret
+			db	c8h,e8h,29h,06h,f2h,3dh,01h,3bh
+			db	f6h,cdh,42h,52h,1ah,dfh,a3h,56h
+			db	84h,a0h,06h,90h,0fh,7ah,6fh,c3h
+			db	0dh,78h,c4h,87h,0dh,6ch,18h,5ch
+			pop	bc
+			add	a,d
+			daa
+			ld	c,d
+			adc	a,h
+			ld	b,80h
+			ld	a,h
+			nop
+			sbc	a,d
+			sub	(hl)
+			ld	c,d
+			ld	e,(hl)
+			ret	m
+			ex	(sp),hl
+			di
+			ld	e,(hl)
+			jp	z,Le509
+			ld	h,(hl)
+			jp	z,L4f51
+			ld	l,a
+			ld	h,d
+			dec	d
+			cp	l
+			dec	h
+			nop
+			add	a,(hl)
+			call	c,L9e5d
+			sbc	a,d
+			sbc	a,h
+			ld	d,d
+			rst	08h
+			add	a,c
+			and	(hl)
+			inc	de
+			ld	l,l
+			ld	e,(hl)
+			jp	p,L9cca
+			ret	nc
+			inc	de
+			inc	(hl)
+			ld	d,d
+			ret	nz
+			xor	f2h
+			rla
+			sub	l
+			ld	b,(hl)
+			cp	l
+			ld	a,c
+			exx
+			djnz	L88a2
+			add	a,e
+			ld	l,l
+			ld	l,(hl)
+			ld	e,h
+			ret	z
+			inc	de
+			dec	d
+			ld	h,h
+			dec	h
+			ld	l,d
+			ret	pe
+			add	hl,bc
+			ld	a,(bc)
+			ret	m
+			dec	c
+			ld	e,e
+			dec	d
+			cp	e
+			cp	l
+			ld	bc,9f28h
+			out	(10h),a
+			call	p,Leaa4
+			ld	a,h
+			jp	po,Ld601
+			ld	e,d
+			ld	hl,3d2fh
+			ld	e,l
+			nop
+			sub	c
+			rst	20h
+			ld	e,69h
+			ld	a,l
+			out	(24h),a
+			xor	a
+			ld	b,c
+			cp	e
+			ld	d,a
+			xor	l
+			ld	l,(hl)
+			daa
+			sub	4fh
+			xor	e
+			inc	h
+			add	hl,de
+			add	hl,de
+			ld	h,l
+			jp	nc,Lc9ad
+			jr	L88fc
+			db	f2h,1dh
+			ld	d,l
+			scf
+			cp	d
+			ld	c,c
+			out	(79h),a
+			rst	00h
+			ld	d,d
+			ld	d,h
+			adc	a,d
+			di
+			xor	d
+			dec	c
+			rst	20h
+			ld	e,c
+			ret	p
+			cp	(hl)
+			ld	l,d
+			ld	a,c
+			sbc	a,d
+			add	hl,bc
+			ld	l,e
+			and	l
+			add	a,(hl)
+			push	de
+			rst	08h
+			ld	(hl),f1h
+			rst	10h
+			dec	a
+			ld	e,a
+			add	a,d
+			ld	d,l
+			ld	l,h
+			ld	c,a
+			ld	(hl),b6h
+			sub	h
+			ld	l,h
+			adc	a,(hl)
+			sub	b
+			pop	hl
+			ld	h,b
+			xor	bbh
+			cp	(hl)
+			inc	d
+			ld	b,h
+			push	de
+			ld	h,b
+			inc	b
+			ld	l,b
+			xor	e
+			ld	b,c
+			ld	d,b
+			add	a,72h
+			ld	b,(hl)
+			jr	L88dd
+			db	4fh,6bh,e9h,36h,c0h,59h,4dh,f0h
+			db	c5h,a4h,9fh,5bh,42h,ebh,b3h,36h
+			db	6dh,d2h,88h,cch,fah,d8h,41h
+			ld	l,l
+			ld	d,c
+			dec	de
+			jp	nc,Ld773
+			jp	Ldb51
+			add	a,a
+			jp	z,L3e0a
+			ld	(d0e3h),a
+			ld	b,d
+			inc	d
+			add	a,b
+			ld	b,d
+			push	bc
+			ld	(hl),b2h
+			ld	(48d1h),hl
+			inc	hl
+			ld	h,h
+			adc	a,l
+			ld	h,b
+			ld	l,c
+			adc	a,h
+			ld	l,62h
+			add	hl,sp
+			ld	c,l
+			ld	h,a
+			ld	b,a
+			ex	(sp),hl
+			in	a,(46h)
+			xor	l
+			ld	d,e
+			or	b
+			sbc	a,c
+			xor	a
+			cp	d
+			push	de
+			rst	30h
+			ld	a,(hl)
+			adc	a,d
+			ld	a,h
+			cp	c
+			ld	e,90h
+			and	b
+			dec	sp
+			or	d
+			ld	h,d
+			ex	(sp),hl
+			ld	b,(hl)
+			ld	(hl),c
+			ex	de,hl
+			halt
+			ld	(a6f6h),hl
+			ld	h,d
+			djnz	L896b
+			ret	nc
+			dec	de
+			ld	d,e
+			sbc	a,e
+			sub	b
+			ld	a,(hl)
+			jp	po,Le16d
+			ld	e,a4h
+			sub	c
+			ld	(hl),h
+			ld	(hl),d
+			ld	l,b
+			xor	(hl)
+			ld	c,a
+			ld	hl,f3c6h
+			ld	(hl),d
+			ld	sp,hl
+			cp	d
+			inc	(hl)
+			ld	a,d
+			rst	18h
+			ex	de,hl
+			ld	l,b
+			rla
+			and	b
+			ld	h,d
+			adc	a,a
+			ld	c,d
+			nop (2x) *
+			scf
+			nop (2x) *
+			dec	hl
+			ld	(hl),e
+			ld	a,(bc)
+			halt
+			ret	z
+			call	c,L3e7e
+			add	a,(hl)
+			ret
+			db	deh
+			ld	a,c
+			call	p,L7faf
+			sub	d
+			ld	b,d
+			adc	a,6ch
+			ld	l,b
+			daa
+			xor	d
+			xor	c
+			inc	b
+			sub	l
+			halt
+			ld	d,a
+			jr	c,L8909
+			ld	l,h
+			jp	m,L6c82
+			adc	a,a
+			jp	c,Lbc4d
+			rla
+			jp	pe,L3e92
+			ld	b,1bh
+			ld	(3978h),a
+			dec	de
+			jr	z,L8992
+			dec	sp
+			rst	00h
+			rst	30h
+			ld	c,a
+			ld	b,l
+			cp	d
+			call	pe,L0df1
+			xor	e
+			pop	bc
+			cp	h
+			inc	b
+			ld	d,d
+			ld	d,b
+			push	bc
+			ld	a,(5499h)
+			ld	d,c
+			ld	d,5ah
+			djnz	L8a19
+			rla
+			adc	a,d
+			res	7,a
+			call	m,Lf502
+			dec	l
+			jp	m,L0c99
+			ld	sp,0bcfh
+			inc	c
+			and	a
+			add	hl,bc
+			ld	a,(bc)
+			dec	l
+			ld	hl,(ce7bh)
+			out	(ach),a
+			cp	b
+			cp	c
+			xor	l
+			sub	a
+			ret	c
+			pop	bc
+			dec	l
+			call	m,Lbe92
+			cp	b
+			cp	l
+			add	hl,bc
+			ld	l,d
+			inc	bc
+			res	2,b
+			ld	d,f8h
+			call	c,L6f3e
+			ld	h,c
+			xor	e
+			and	l
+			ret
+			or	(hl)
+			cpl
+			ld	e,a
+			exx
+			ld	h,d
+			dec	hl
+			jp	m,Le950
+			add	a,d
+			dec	a
+			dec	e
+			add	hl,de
+			adc	a,h
+			ld	c,e
+			inc	e
+			xor	e
+			dec	d
+			call	z,Ld350
+			sbc	a,b
+			pop	hl
+			inc	(hl)
+			ld	a,22h
+			ld	c,e
+			xor	1eh
+			ld	b,e
+			jp	m,L5045
+			rla
+			pop	de
+			ld	e,bah
+			cp	d
+			ld	b,c
+			ld	d,l
+			ld	h,h
+			call	c,L2547
+			inc	de
+			or	h
+			sbc	a,h
+			and	h
+			ld	iyh,d *
+			in	a,(7bh)
+			ld	b,h
+			ld	h,e
+			sub	a
+			jr	c,L8a08
+			rst	38h
+			rra
+			ld	h,(hl)
+			rst	08h
+			res	6,c
+			ld	c,b
+			dec	bc
+			and	c
+			sub	e
+			dec	sp
+			ld	d,l
+			ld	l,cch
+			ret	nc
+			add	hl,sp
+			ld	a,e
+			jp	nc,Ld8f4
+			adc	a,(hl)
+			ld	e,a
+			add	hl,bc
+			halt
+			inc	de
+			dec	d
+			ld	e,l
+			ld	a,c
+			inc	(hl)
+			add	hl,hl
+			ret
+			db	85h,24h,49h,fbh,15h,32h,a6h,53h
+			db	94h,e2h,2dh,d8h,93h,85h,26h,30h
+			db	59h,0eh,c1h
+			and	(hl)
+			sbc	a,37h
+			add	a,c
+			add	a,53h
+			jr	nc,L8ac3
+			ex	de,hl
+			nop (2x) *
+			adc	a,c
+			ret	m
+			and	c
+			cpl
+			ld	h,(hl)
+			call	p,Lc059
+			ret	m
+			sub	e
+			adc	a,l
+			adc	a,d
+			ld	l,l
+			sbc	a,h
+			push	hl
+			adc	a,h
+			jp	p,Lb294
+			adc	a,c
+			cpl
+			xor	a
+			ld	b,l
+			call	nz,Lb4f5
+			inc	sp
+			rst	20h
+			dec	a
+			ld	e,a
+			ld	l,b
+			in	a,(97h)
+			call	po,L518e
+			inc	l
+			push	bc
+			dec	a
+			call	p,L2f77
+			call	m,L276c
+			ld	l,l
+			ld	b,c
+			add	a,d
+			ld	h,34h
+			ld	b,c
+			ld	e,e
+			and	l
+			ld	l,b
+			ld	a,b
+			rst	20h
+			ld	a,a
+			ret	po
+			xor	e
+			jp	nc,L7353
+			add	hl,sp
+			ld	b,l
+			sbc	a,35h
+			add	a,a
+			ld	d,b
+			nop (2x) *
+			rra
+			dec	h
+			inc	(hl)
+			sbc	a,h
+			ld	c,b
+			ld	hl,3c70h
+			add	a,(hl)
+			ld	d,l
+			dec	d
+			dec	d
+			ld	e,(hl)
+			dec	e
+			ld	d,c
+			add	a,b
+			sbc	a,h
+			ld	c,c
+			jp	m,L6baf
+			ld	h,d
+			ld	b,b
+			or	3ah
+			set	5,a
+			xor	ebh
+			ld	(c378h),a
+			inc	h
+			push	hl
+			ld	l,d
+			rst	38h
+			ld	c,d
+			or	d
+			jr	c,L8a74
+			exx
+			ld	d,a
+			rst	18h
+			jp	p,Laa7c
+			ld	a,d
+			ld	h,d
+			ld	(hl),d
+			daa
+			ld	d,b
+			ld	(hl),a
+			and	c
+			adc	a,c
+			sub	c
+			ld	a,b
+			ld	h,c
+			add	a,c
+			ret	z
+			add	a,(hl)
+			nop
+			rl	(hl)
+			inc	a
+			inc	l
+			cp	(hl)
+			ld	l,a
+			add	hl,bc
+			sbc	a,d
+			dec	c
+			rst	08h
+			ld	b,a
+			or	h
+			cpl
+			add	a,c
+			ld	b,h
+			ret	po
+			inc	b
+			cp	afh
+			inc	iy
+			ld	bc,8bcbh
+			ld	c,b
+			ld	a,d
+			ld	c,l
+			halt
+			ld	a,a
+			ld	h,b
+			nop
+			ei
+			pop	bc
+			cp	a
+			cp	c
+			jr	nc,L8b3d
+			ld	a,c
+			ret	p
+			xor	h
+			or	b
+			jr	nc,L8b31
+			jr	L8af5
+			db	8fh,9ah
+			cpl
+			ld	c,h
+			or	l
+			cp	l
+			ld	e,(hl)
+			adc	a,e
+			ret	nc
+			cp	c
+			inc	b
+			ld	c,h
+			rst	28h
+			dec	(hl)
+			rst	28h
+			ld	l,07h
+			ld	e,c
+			ld	e,a
+			ld	c,l
+			ld	d,c
+			call	pe,L3bd9
+			ld	h,d
+			add	hl,sp
+			ex	af,af'
+			ex	de,hl
+			inc	de
+			ld	h,e
+			or	(hl)
+			or	d
+			ld	a,(hl)
+			cp	e
+			or	a
+			ld	(hl),a
+			ld	(hl),e
+			ld	l,b
+			adc	a,d
+			and	l
+			cp	a
+			pop	af
+			ld	d,d
+			sbc	a,e
+			call	nc,L772a
+			add	a,b
+			cp	c
+			ld	l,9ah
+			and	e
+			and	d
+			nop (2x) *
+			ex	de,hl
+			sub	c
+			and	l
+			cp	a
+			ld	a,e
+			xor	d
+			ld	b,f8h
+			cp	d
+			call	c,Lcffc
+			and	a
+			ld	sp,hl
+			ld	c,e
+			ld	b,b
+			and	b
+			inc	c
+			ld	bc,409fh
+			rst	08h
+			ld	sp,hl
+			ld	l,d
+			jp	po,L123d
+			pop	af
+			cpl
+			cp	17h
+			ld	bc,2883h
+			ld	e,d4h
+			add	a,a
+			ld	d,e
+			xor	l
+			exx
+			sub	b
+			inc	sp
+			cp	9eh
+			ld	hl,(e0fah)
+			xor	b
+			ld	l,(hl)
+			add	a,e
+			xor	c
+			ld	c,b
+			ld	c,b
+			ld	l,l
+			or	(hl)
+			adc	a,c
+			ld	b,47h
+			and	h
+			xor	l
+			ld	b,a
+			ld	e,b
+			ld	b,a
+			or	b
+			sub	c
+			or	h
+			xor	5dh
+			ex	(sp),hl
+			ld	e,a
+			ld	sp,3f1eh
+			sub	l
+			ld	bc,5abbh
+			ld	d,c
+			ld	d,e
+			and	b
+			jp	z,L9263
+			ld	a,(bc)
+			cp	l
+			dec	h
+			call	m,L0a43
+			ld	d,(hl)
+			jp	pe,L0245
+			ret	z
+			ld	d,c
+			ld	(1749h),a
+			sub	h
+			ld	sp,(9121h)
+			ld	b,e
+			ld	(hl),h
+			inc	l
+			rra
+			dec	a
+			and	8fh
+			inc	a
+			rrca
+			call	L7844
+			ld	b,7ah
+			ld	(hl),00h
+			ld	h,d
+			ld	h,h
+			dec	e
+			ld	h,a
+			rst	20h
+			ld	(hl),c
+			jr	nz,L8b41
+			call	nc,L09d9
+			rst	10h
+			call	nc,L4575
+			ld	l,c
+			sub	(hl)
+			push	bc
+			ld	e,l
+			ld	a,a
+			in	a,(17h)
+			pop	af
+			inc	hl
+			or	b
+			add	hl,de
+			ld	l,b
+			inc	d
+			sbc	a,a
+			ld	c,l
+			inc	l
+			ld	d,a
+			ld	e,e
+			adc	a,a
+			ld	h,l
+			inc	(hl)
+			adc	a,b
+			ld	c,l
+			jp	nc,L6b01
+			push	hl
+			cp	e
+			inc	d
+			call	pe,L5545
+			sub	(hl)
+			add	a,(hl)
+			ld	d,5ch
+			sub	d
+			jp	(hl)
+			db	b1h,c3h,46h,9eh,eeh,a8h,bch,e7h
+			db	b7h,d5h,2eh,87h,52h,abh,5ah,86h
+			db	e5h,24h
+			and	b
+			add	a,d
+			sbc	a,c
+			dec	a
+			rst	20h
+			ld	l,25h
+			call	p,L4567
+			call	z,L90e7
+			ccf
+			pop	de
+			sbc	a,10h
+			di
+			ret	p
+			ld	de,a28ch
+			ld	b,l
+			halt
+			cp	a
+			cp	(hl)
+			ld	b,(hl)
+			ld	b,e
+			inc	hl
+			sub	l
+			ld	d,a
+			sbc	a,b
+			cp	h
+			rlc	e
+			sub	h
+			pop	hl
+			dec	l
+			ld	(de),a
+			ld	e,h
+			dec	e
+			ld	h,(hl)
+			add	a,d
+			call	m,L769b
+			and	d
+			and	70h
+			ld	a,c
+			ld	(hl),d
+			sub	c
+			ccf
+			in	a,(75h)
+			push	af
+			ld	c,d
+			ld	h,d
+			ld	b,c
+			ret	po
+			ld	(bc),a
+			and	h
+			ld	d,h
+			or	l
+			inc	e
+			adc	a,a
+			ret	pe
+			sbc	a,8dh
+			ld	b,e
+			ld	b,a
+			ld	a,e
+			or	l
+			pop	af
+			xor	a
+			rst	00h
+			jp	z,L91df
+			sub	87h
+			rst	08h
+			ld	(de),a
+			ld	(hl),h
+			ld	e,c
+			ld	(bc),a
+			dec	de
+			xor	h
+			dec	b
+			out	(4bh),a
+			adc	a,b
+			jp	z,Lb37d
+			sub	d
+			ld	a,(bc)
+			ret	z
+			ld	c,(hl)
+			sub	1eh
+			rrca
+			ld	l,a
+			sbc	a,c
+			ex	de,hl
+			ld	c,e
+			or	bah
+			sub	l
+			or	b
+			ret	nz
+			nop
+			rst	08h
+			sbc	a,a
+			adc	a,d
+			ld	(03cbh),hl
+			ld	a,(de)
+			xor	a
+			nop
+			pop	af
+			and	b
+			xor	c4h
+			cp	(hl)
+			dec	sp
+			ld	d,a
+			add	hl,de
+			ld	d,38h
+			add	a,h
+			rst	00h
+			rst	20h
+			and	l
+			ld	(hl),e
+			ld	h,6fh
+			rst	18h
+			rst	20h
+			rst	20h
+			inc	l
+			and	e
+			inc	(hl)
+			and	l
+			ld	(de),a
+			or	h
+			add	a,(hl)
+			sbc	a,l
+			ld	l,b
+			jp	pe,L9a83
+			call	m,Lbf84
+			adc	a,h
+			scf
+			add	a,l
+			jr	nc,L8cc6
+			ld	h,e
+			ld	bc,732dh
+			push	hl
+			ld	a,0bh
+			adc	a,l
+			ld	b,h
+			ret
+			db	38h,c7h,4ch,50h,d1h,17h,7ch,ech
+			db	c9h,cdh,43h,8ah,feh,3ch,94h,0ch
+			db	a8h,aeh,2fh,02h,1ch,75h,deh,4ch
+			db	e3h,65h,eah,2ch,65h,10h,d5h,b2h
+			db	b4h,44h,74h,d2h,88h,8ch,eah,ffh
+			ld	a,(7af9h)
+			ld	a,l
+			call	po,L9a6d
+			ld	b,55h
+			ld	l,h
+			add	hl,hl
+			jp	z,Ldbd9
+			xor	l
+			ld	b,b
+			or	a
+			di
+			ld	h,e
+			in	a,(57h)
+			xor	e
+			xor	d4h
+			adc	a,b
+			rst	28h
+			ld	a,c
+			ld	(hl),b
+			ld	(hl),a
+			xor	l
+			jr	L8d3e
+			db	0fh,d7h,e7h,4fh,8dh,f8h,79h,66h
+			db	00h,96h,9dh,d7h,08h,a1h,27h,b7h
+			db	14h,bfh,e9h
+			dec	c
+			ld	d,d
+			ld	h,b
+			sub	l
+			adc	a,b
+			ret	p
+			sbc	a,1eh
+			di
+			cp	l
+			add	a,b
+			ld	b,a
+			add	a,b
+			ld	h,d
+			ld	c,(hl)
+			call	c,L5e99
+			ld	b,l
+			dec	(hl)
+			or	b
+			add	a,e
+			ld	e,(hl)
+			sbc	a,(hl)
+			djnz	L8cf9
+			jp	(hl)
+			db	c9h,5bh,79h,00h,a9h,60h,59h,9eh
+			db	21h,f2h,22h,d4h,e8h,d9h,2bh,3fh
+			db	90h,d1h,63h,51h,aah,c7h,e3h,70h
+			db	96h,23h,58h,63h,50h,14h,7eh,05h
+			db	55h,f5h,f3h,b0h,39h,11h,49h,8ah
+			db	3dh,d3h
+			adc	a,4ch
+			ld	c,d
+			ld	d,l
+			pop	af
+			dec	hl
+			pop	af
+			jp	c,L9ef9
+			jp	L7c63
+			db	3bh,abh,bch,51h,51h,f3h,09h,e9h
+			db	d5h,35h,33h,83h,c6h,2bh,8bh,beh
+			db	9bh
+			and	e
+			ld	(hl),b
+			ld	a,(de)
+			ld	e,b
+			ld	e,a
+			nop (2x) *
+			and	a
+			ld	a,(de)
+			dec	e
+			ld	l,e4h
+			inc	b
+			adc	a,d
+			sbc	a,b
+			ld	c,l
+			ex	(sp),hl
+			ld	h,d
+			or	e
+			ld	(hl),d
+			dec	d
+			inc	bc
+			dec	(hl)
+			cp	l
+			ld	h,d
+			ld	a,c
+			jp	m,L879f
+			ld	e,h
+			ld	(de),a
+			ld	a,b8h
+			halt
+			ld	b,c
+			dec	de
+			ex	(sp),hl
+			ld	h,h
+			dec	e
+			ld	l,b
+			xor	d
+			xor	h
+			or	l
+			adc	a,e
+			exx
+			ldir
+			adc	a,b
+			ret	z
+			ld	d,f7h
+			ld	d,l
+			add	a,(hl)
+			sub	h
+			rst	08h
+			inc	b
+			ld	h,c
+			ld	d,d
+			ld	c,c
+			in	a,(1fh)
+			xor	c
+			di
+			dec	c
+			inc	de
+			add	a,a
+			ld	b,l
+			and	d
+			scf
+			jp	m,La27b
+			add	a,6bh
+			ld	l,(hl)
+			or	(hl)
+			sbc	a,c
+			jr	nc,L8d5c
+			sub	(hl)
+			ld	b,e
+			rlca
+			adc	a,d
+			xor	b
+			xor	c
+			add	a,l
+			ld	a,l
+			sbc	a,l
+			nop
+			jp	nz,L7511
+			add	hl,de
+			ret	m
+			xor	(hl)
+			ld	b,c
+			ld	l,40h
+			ld	de,f4fch
+			inc	h
+			ld	h,b
+			call	p,L11cf
+			inc	h
+			ex	af,af'
+			ld	b,l
+			xor	dbh
+			inc	(hl)
+			inc	de
+			ld	l,c
+			ld	d,(hl)
+			rst	20h
+			and	4ah
+			xor	h
+			ld	h,d
+			sbc	a,h
+			dec	e
+			ld	e,(hl)
+			ld	a,c
+			sub	b
+			jr	nz,L8d71
+			sbc	a,b
+			rst	38h
+			pop	hl
+			dec	c
+			ret	po
+			push	hl
+			push	hl
+			rst	10h
+			inc	d
+			and	c
+			ld	(hl),h
+			ret	z
+			and	e
+			ld	a,d
+			ld	(3ee2h),a
+			ld	(de),a
+			adc	a,d
+			inc	hl
+			ret
+			db	70h,88h,cah,35h,5ah,0dh,f3h,85h
+			db	74h,32h,49h,77h,c3h,80h,51h,b7h
+			db	2dh,65h,79h,50h,7ch,abh,afh,fch
+			db	8eh,cch,d8h,5eh,bah,5ch,4fh,78h
+			db	38h,b0h,3eh
+			inc	sp
+			jp	c,Lcfcc
+			ld	l,d
+			ld	e,e
+			call	pe,L438c
+			ld	c,(ix + cah)
+			add	a,(hl)
+			ld	b,(hl)
+			ld	(aea0h),a
+			jp	po,L6b46
+			ld	l,(hl)
+			ret	nc
+			xor	h
+			cp	h
+			ld	a,c
+			ld	d,b
+			call	p,L3069
+			ei
+			ld	h,a
+			ld	a,d
+			ei
+			ld	a,(de)
+			inc	h
+			ld	b,h
+			ei
+			ld	e,b
+			jp	nc,Lbd94
+			ld	a,h
+			ld	l,23h
+			halt
+			in	a,(52h)
+			call	pe,Lbf25
+			in	a,(efh)
+			jp	nz,Leced
+			ld	l,e
+			ld	a,h
+			ld	h,d
+			ld	iyl,c *
+			jp	(hl)
+			db	c4h,87h,c6h,f5h,33h,f8h,1ch,bfh
+			db	11h,a3h,d4h,0dh,47h,33h,b4h,36h
+			db	6dh,e8h,05h,08h,61h,d9h,aeh,a9h
+			db	49h,dbh,e2h,67h,14h,d2h,dbh,13h
+			db	f2h,6dh,40h,8eh,28h,67h,eeh,36h
+			db	beh,74h,b9h,a2h,e5h,31h,2ch,90h
+			db	edh,47h,4ch,efh,09h,b9h,50h,7dh
+			db	30h
+			adc	a,h
+			ld	d,l
+			xor	l
+			cp	f4h
+			dec	de
+			ld	d,(hl)
+			add	hl,hl
+			dec	d
+			rrca
+			jp	c,L45ed
+			rst	30h
+			exx
+			add	hl,hl
+			add	a,b
+			ret	p
+			ld	iyh,d *
+			ld	b,l
+			ld	d,e
+			rst	30h
+			cp	l
+			ld	a,e
+			ld	sp,2850h
+			ret	nc
+			xor	c
+			ld	(hl),e
+			ld	e,h
+			jp	nc,L51db
+			nop
+			rrca
+			ld	hl,8a26h
+			inc	hl
+			ld	a,(hl)
+			ld	(hl),0dh
+			xor	b
+			or	d
+			inc	h
+			ex	(sp),hl
+			or	l
+			djnz	L8e8c
+			ld	e,h
+			ld	c,c
+			nop (2x) *
+			sbc	a,l
+			push	af
+			ld	e,e
+			ld	h,l
+			ld	h,a
+			add	hl,de
+			ld	(0daeh),a
+			jp	c,L2037
+			rst	08h
+			pop	bc
+			inc	de
+			ld	a,b
+			inc	l
+			halt
+			add	a,l
+			dec	d
+			sub	l
+			pop	hl
+			add	hl,bc
+			in	a,(15h)
+			rst	38h
+			ld	sp,hl
+			jp	nc,L4c82
+			halt
+			sbc	a,h
+			jp	c,L55bf
+			add	a,8fh
+			inc	h
+			ld	a,d
+			cp	(hl)
+			ld	l,b
+			ld	c,d
+			jr	z,L8ed3
+			ex	(sp),hl
+			ld	l,(hl)
+			add	a,b
+			xor	d
+			or	c
+			sbc	a,b
+			ret	c
+			ld	e,c
+			ld	(de),a
+			rst	18h
+			xor	a
+			and	a
+			rlca
+			rst	10h
+			ld	sp,e3c7h
+			rla
+			jp	(hl)
+			db	32h,f6h,c4h,9ah,27h,e1h,adh,dfh
+			db	93h,e3h,d5h,05h,43h,dbh,98h,36h
+			db	31h,dch,a5h,c5h,90h,5eh,9fh
+			sub	a
+			ld	h,b
+			ld	b,(hl)
+			cp	a
+			dec	b
+			and	d
+			jp	po,Lf7b9
+			push	de
+			rlca
+			and	a
+			cp	e
+			ld	(hl),d3h
+			ld	a,(bc)
+			scf
+			adc	a,d
+			sub	55h
+			inc	hl
+			sub	c
+			and	b
+			ld	e,c
+			dec	h
+			and	(hl)
+			inc	de
+			ld	(hl),h
+			cp	(hl)
+			jp	Lddae
+			db	83h,c1h,c0h,a3h,b8h,83h,2eh,b7h
+			db	c4h,38h,36h,0bh,1ah,4bh,fah,94h
+			db	2fh,a2h,9ch,ebh,1ch,f3h,67h,e7h
+			db	b4h,28h,85h,b2h,6ch,ech,b7h,79h
+			db	13h,c2h,92h,49h,bbh,c9h,07h,7fh
+			db	21h,ceh,a8h,32h,b4h,d1h,cdh,e7h
+			db	e9h,bdh,2ch,eah,15h
+			ld	h,01h
+			ld	e,75h
+			ld	d,a
+			adc	a,a
+			add	a,l
+			ld	e,a
+			ld	a,a
+			ld	h,b9h
+			pop	hl
+			ld	a,d
+			jp	c,L4491
+			dec	h
+			push	af
+			adc	a,e
+			ld	h,a
+			ld	a,(e91bh)
+			ret	nz
+			jp	pe,La46c
+			ld	h,h
+			ld	(697eh),a
+			ld	sp,hl
+			sub	e
+			ld	d,b
+			ld	l,l
+			call	L35a7
+			add	a,(hl)
+			or	d
+			ret	pe
+			adc	a,h
+			ld	e,(hl)
+			cp	a
+			djnz	L8fa4
+			ld	a,d
+			out	(dfh),a
+			in	a,(26h)
+			ld	(bc),a
+			xor	e
+			dec	sp
+			dec	h
+			out	(1ch),a
+			sbc	a,l
+			inc	e
+			ld	a,(d394h)
+			rra
+			or	h
+			ld	(de),a
+			ld	e,a
+			dec	(hl)
+			ei
+			inc	c
+			ld	de,a464h
+			inc	de
+			call	pe,L45a6
+			ld	(hl),h
+			sub	e
+			push	hl
+			pop	de
+			ld	e,h
+			rst	10h
+			jr	nc,L8f6a
+			ld	(hl),b
+			and	h
+			cp	b
+			ld	de,282ah
+			add	a,h
+			add	a,c
+			sbc	a,(hl)
+			ret	po
+			add	a,d
+			inc	de
+			rst	18h
+			ld	h,c
+			dec	de
+			cp	(hl)
+			exx
+			ld	(hl),e
+			ld	h,a9h
+			ld	c,l
+			inc	e
+			ld	a,a0h
+			ld	b,h
+			sbc	a,35h
+			ex	de,hl
+			ld	e,d
+			inc	l
+			jp	L4aa1
+			db	7dh,8eh,c9h,03h,23h,4eh,6fh,90h
+			db	d0h,32h,c2h,31h,cfh,32h,59h,12h
+			db	54h,e4h,fch,d0h,c9h,4ah,2ah,9ah
+			db	42h,32h,14h,1bh,a7h,7ch,aah,d4h
+			db	78h,36h,7eh,90h,17h,e9h,e4h,79h
+			db	f3h,c1h,c6h,f5h,f9h,35h,feh,4ch
+			db	1dh,a0h
+			ld	a,(de)
+			ld	h,l
+			sub	h
+			jp	nc,L60c1
+			inc	l
+			or	0eh
+			ld	hl,a6fch
+			ld	a,a
+			dec	(hl)
+			ret	p
+			nop (2x) *
+			inc	d
+			sub	l
+			ld	b,(hl)
+			xor	55h
+			ld	l,d
+			xor	c
+			djnz	L9067
+			ld	h,e
+			ret	po
+			cpl
+			ld	h,e
+			ld	d,c
+			ret	nc
+			ld	l,l
+			ld	l,h
+			dec	hl
+			ld	(a3e4h),hl
+			ld	e,d
+			ld	l,a
+			adc	a,c
+			adc	a,(hl)
+			rst	38h
+			sbc	a,c
+			ret	c
+			sub	a
+			ld	a,(6b26h)
+			ld	de,ce93h
+			cp	f3h
+			inc	hl
+			ret	nz
+			xor	c
+			ld	l,l
+			neg *
+			sbc	a,c
+			ld	de,0c45h
+			adc	a,a
+			ld	a,h
+			xor	(hl)
+			add	hl,hl
+			ld	sp,hl
+			cpl
+			sbc	a,7bh
+			djnz	L9070
+			cp	b
+			ld	a,l
+			ex	af,af'
+			rla
+			xor	h
+			out	(a0h),a
+			dec	(hl)
+			call	m,L7f1f
+			call	p,L4241
+			xor	a
+			xor	(hl)
+			and	14h
+			add	a,l
+			pop	de
+			inc	e
+			adc	a,a
+			jp	nz,Lc7e5
+			ld	sp,2942h
+			ld	a,(hl)
+			ld	a,h
+			ld	c,l
+			rst	38h
+			ld	c,c
+			ld	l,(hl)
+			jr	L908c
+			db	f5h,eah
+			add	a,d
+			add	hl,de
+			adc	a,d
+			call	p,L979a
+			rst	28h
+			sub	37h
+			ld	h,l
+			jr	L9098
+			xor	c
+			ld	b,c
+			ld	b,e
+			ld	(hl),a
+			inc	c
+			dec	sp
+			or	a
+			sub	h
+			jp	nc,L1ab9
+			sub	e
+			sub	33h
+			ret	p
+			adc	a,d
+			ld	a,edh
+			sub	ceh
+			dec	hl
+			or	a
+			ld	a,c
+			inc	d
+			ld	h,a
+			inc	h
+			jr	nc,L90a5
+			ret	p
+			halt
+			di
+			cp	l
+			ld	b,l
+			push	de
+			ld	e,c
+			cp	a6h
+			ex	af,af'
+			ld	a,f2h
+			adc	a,h
+			push	af
+			and	(hl)
+			inc	b
+			sub	l
+			ld	b,(hl)
+			rst	08h
+			nop
+			ld	h,d
+			ld	sp,5e64h
+			adc	a,a
+			ld	h,d
+			and	l
+			daa
+			inc	sp
+			ld	b,c
+			adc	a,e
+			ld	c,l
+			ld	c,b
+			ld	(hl),h
+			rst	20h
+			rlca
+			ld	h,e
+			call	z,L728d
+			ld	(hl),h
+			rst	38h
+			pop	de
+			and	a
+			add	a,bah
+			cp	feh
+			ld	a,e
+			dec	de
+			ret	c
+			ld	c,(hl)
+			ld	(hl),l
+			nop (2x) *
+			out	(32h),a
+			or	d
+			scf
+			cp	c
+			ld	d,9fh
+			ld	c,a
+			adc	a,l
+			rla
+			ld	a,a
+			ld	e,c
+			sub	c
+			cp	h
+			sub	c
+			rst	08h
+			ld	h,e9h
+			jp	po,L7450
+			ld	l,l
+			nop (2x) *
+			rra
+			ret	m
+			and	l
+			ld	b,(hl)
+			sbc	a,h
+			nop (2x) *
+			ld	c,c
+			ret	z
+			rst	10h
+			ld	d,d
+			ld	h,6fh
+			add	a,h
+			call	c,L12e8
+			ld	e,e
+			cpl
+			ld	e,(hl)
+			pop	hl
+			ret	z
+			sbc	a,l
+			call	c,Lb7d4
+			ld	b,a
+			ld	e,b
+			ld	h,l
+			jp	po,L7915
+			pop	hl
+			dec	a
+			xor	h
+			or	c
+			call	nc,L523d
+			call	z,Ld95b
+			jp	nc,Lbc12
+			and	(hl)
+			jr	L9185
+			db	12h,d0h,91h,efh,2ah,ech,43h,a0h
+			db	07h,28h,62h,41h,42h,24h,f7h,32h
+			db	e3h,2bh
+			inc	d
+			ld	hl,(3906h)
+			call	c,L3752
+			ld	a,(bc)
+			rst	38h
+			add	a,c
+			ld	e,h
+			sub	b
+			ld	sp,8ae4h
+			ld	e,(hl)
+			ld	e,(hl)
+			ld	(hl),l
+			ld	a,h
+			adc	a,h
+			dec	bc
+			ld	c,h
+			ld	de,0797h
+			inc	hl
+			ld	l,l
+			ld	a,(bc)
+			rst	08h
+			xor	(hl)
+			and	(hl)
+			ld	c,e
+			ld	e,e
+			ld	d,b
+			jp	p,L00f2
+			ret	p
+			sub	h
+			ld	l,c
+			ld	hl,54bbh
+			ld	b,c
+			jp	(hl)
+			db	6ah,83h,41h,88h,56h,93h,5ah,81h
+			db	e3h,79h,edh,31h,1ah,d4h,43h,74h
+			db	cfh,f7h,b5h,89h,cdh,8bh,c2h,e6h
+			db	e5h,bfh,1dh,ddh,68h,96h,bah,53h
+			db	8fh,bch
+			jp	nc,L73a6
+			call	m,L7ea6
+			ld	h,a
+			dec	de
+			jp	L1009
+			db	6ch,1dh,7eh,74h,f4h,5dh,1ah,56h
+			db	beh,3ch,6dh,6dh,8eh,c3h,84h,6bh
+			db	feh,ech,8fh,f4h,83h,ceh,02h,5ah
+			db	3ah,4ch,c2h,f1h,b0h,c4h,a2h,eah
+			db	0fh,bbh,a7h,99h,66h,81h,7eh,04h
+			db	d0h,c5h,2ch,7ah,0eh,63h,79h,48h
+			db	9bh,73h,7dh,d7h,85h,e3h,1ch,84h
+			db	24h,6ah,92h,33h,39h,76h,1bh
+			sub	l
+			cp	h
+			rra
+			ld	l,h
+			call	m,Le229
+			sbc	a,d
+			add	a,b
+			add	a,b
+			sbc	a,83h
+			inc	e
+			jp	nz,L8bdf
+			call	po,Le46d
+			call	nc,L939c
+			and	c
+			jp	p,Lbfcd
+			dec	l
+			inc	e
+			ld	b,b
+			ex	(sp),hl
+			ld	a,h
+			call	pe,L8b26
+			jp	p,L5c3c
+			ld	a,(de)
+			and	d
+			ld	a,a
+			dec	e
+			ld	c,l
+			add	a,a
+			add	a,h
+			ld	b,b
+			ld	a,31h
+			xor	d
+			dec	sp
+			cp	h
+			ld	c,l
+			sbc	a,c
+			cp	l
+			add	a,0bh
+			ld	c,l
+			cpl
+			push	af
+			pop	de
+			ld	l,c
+			cp	l
+			ld	a,(ca7fh)
+			adc	a,l
+			and	(hl)
+			rst	18h
+			ld	c,e
+			ei
+			rst	10h
+			ret	z
+			ld	a,l
+			ld	a,e
+			ret	z
+			di
+			ld	a,d
+			and	h
+			ret	po
+			ld	(hl),b
+			ld	e,d
+			ld	a,d
+			inc	a
+			ld	c,(hl)
+			add	a,h
+			adc	a,e
+			ccf
+			scf
+			rlca
+			jp	pe,L8fd2
+			jp	(hl)
+			ld	c,b
+			add	hl,bc
+			ret	c
+			ld	d,l
+			or	d
+			ld	d,b
+			inc	d
+			ld	d,l
+			sbc	a,b
+			ld	h,(hl)
+			rst	30h
+			sbc	a,l
+			ld	a,e
+			and	b
+			ret	nc
+			add	a,h
+			call	nz,L3102
+			ld	c,b
+			push	af
+			xor	l
+			add	a,d
+			dec	e
+			sub	d
+			inc	e
+			ld	b,c
+			ld	(hl),l
+			ld	hl,(393ch)
+			ld	(hl),9bh
+			call	po,L58df
+			ld	(hl),d
+			ld	l,(hl)
+			adc	a,h
+			ld	bc,eb0eh
+			jp	z,Leab8
+			sbc	a,(hl)
+			xor	c
+			cp	e
+			sub	e
+			adc	a,a
+			ld	e,l
+			jp	nz,L9430
+			ld	l,e
+			djnz	L9264
+			daa
+			ld	(de),a
+			sub	d
+			ld	h,l
+			ld	(hl),d
+			sbc	a,(hl)
+			ld	hl,(208eh)
+			ret	nz
+			ld	e,h
+			ld	de,fd1bh
+			jp	(hl)
+			db	cbh,b3h,13h,73h,6bh,dbh,0ch,d4h
+			db	78h,82h,69h,afh,4ch,63h,a6h,cah
+			db	68h,71h,39h,52h,80h,bch,32h,02h
+			db	bch,c1h,38h,e6h,0bh,b0h,8dh,22h
+			db	44h,d5h,77h,e4h,e2h,a8h,2eh,d9h
+			db	feh,02h,45h,97h,1eh,23h,4bh,c6h
+			db	8dh,eah,0bh,e9h,84h,a8h,afh,78h
+			db	0ch,9bh,89h,dah,12h,b0h,17h,74h
+			db	1ah,f6h,b3h,ach,47h,27h,48h,81h
+			db	ach,55h,e0h,21h
+			jp	z,Le462
+			sbc	a,c
+			ld	a,c
+			and	l
+			ld	b,a
+			halt
+			dec	b
+			cp	h
+			sub	l
+			scf
+			push	bc
+			ld	a,(de)
+			dec	h
+			jp	pe,L95a8
+			inc	c
+			ld	h,74h
+			adc	a,72h
+			pop	bc
+			call	c,L856e
+			add	a,h
+			dec	a
+			pop	hl
+			jp	z,Lcf3b
+			xor	49h
+			ld	a,h
+			inc	a
+			sbc	a,d
+			inc	l
+			ld	e,c
+			ld	e,e
+			ld	d,(hl)
+			adc	a,c2h
+			cp	h
+			sub	(hl)
+			nop (2x) *
+			djnz	L931d
+			sbc	a,l
+			cp	c
+			nop
+			call	nz,L6035
+			ld	b,(hl)
+			halt
+			scf
+			ld	a,b
+			ld	a,d
+			add	a,l
+			inc	hl
+			cp	a
+			sub	l
+			or	(hl)
+			rla
+			ld	h,92h
+			ld	(e0abh),a
+			and	3bh
+			dec	bc
+			ld	(hl),d
+			ld	d,d
+			xor	(hl)
+			pop	bc
+			ld	a,l
+			and	e
+			ld	(6fb3h),hl
+			adc	a,08h
+			ld	c,b
+			sub	b
+			sub	(hl)
+			add	hl,bc
+			jp	nz,L5cd8
+			push	de
+			ld	a,(bc)
+			or	e
+			ld	d,81h
+			ld	e,e
+			ld	h,e
+			ld	a,b3h
+			ld	c,e
+			inc	l
+			cp	(hl)
+			adc	a,bbh
+			and	a
+			ld	h,e
+			ld	e,b
+			ld	e,b7h
+			cp	93h
+			ld	h,d
+			inc	de
+			dec	b
+			cp	c
+			ld	h,d
+			ex	af,af'
+			ld	a,a
+			adc	a,b
+			ld	a,a
+			inc	b
+			ld	h,d
+			ld	c,d
+			push	bc
+			rst	10h
+			ld	a,l
+			sub	a
+			ld	c,h
+			ld	e,60h
+			xor	b
+			and	h
+			dec	l
+			pop	hl
+			ld	h,h
+			ld	de,d1d7h
+			call	nc,Lfea4
+			ld	d,a
+			inc	bc
+			ld	hl,(5938h)
+			sbc	a,h
+			call	c,L7c23
+			and	l
+			pop	af
+			dec	a
+			call	L255e
+			add	a,c
+			ld	e,e
+			add	a,l
+			call	po,L7737
+			ret	po
+			and	e
+			ld	e,(hl)
+			xor	b
+			ld	de,a653h
+			ld	h,c
+			ld	l,h
+			push	de
+			ld	(hl),d
+			inc	h
+			inc	b
+			or	b
+			xor	31h
+			and	l
+			push	de
+			pop	de
+			sbc	a,b
+			and	30h
+			ld	e,7fh
+			or	(hl)
+			and	h
+			or	b
+			ld	b,a
+			xor	(hl)
+			jr	nz,L931d
+			pop	af
+			ld	h,c
+			ret	m
+			dec	de
+			inc	c
+			ret	c
+			nop
+			or	l
+			jr	L93c7
+			db	f0h,56h,91h,82h,dbh,6eh,4bh,3bh
+			db	6ah,fdh,a3h,f2h,2ah,c1h,49h
+			ld	(a77dh),a
+			ld	e,c
+			sbc	a,6bh
+			and	a
+			ex	(sp),hl
+			dec	(hl)
+			dec	h
+			ld	l,c
+			dec	de
+			add	hl,bc
+			adc	a,e
+			dec	e
+			cp	64h
+			rst	00h
+			sbc	a,h
+			ld	h,a2h
+			ret	c
+			sub	c
+			push	bc
+			sub	l
+			ld	(4e53h),hl
+			add	hl,bc
+			ld	l,(hl)
+			or	c
+			ld	(de),a
+			dec	b
+			dec	sp
+			sbc	a,(hl)
+			dec	b
+			rst	18h
+			call	nc,Lf41a
+			inc	hl
+			ld	l,e2h
+			ret	c
+			jp	(hl)
+			db	97h,f6h,b7h,04h,3ah,f6h,eah,b4h
+			db	3ch,34h,72h,bbh,88h,62h,5dh,16h
+			db	bfh,1ch,11h,f0h,f1h,fch,ddh,fdh
+			db	8eh,5fh,e9h,2eh,a9h,cch,76h,65h
+			db	d9h,2eh,1eh,0ch,bdh,afh,2dh,1dh
+			db	e8h,d1h,4fh,e3h,c4h,2ah,11h,bfh
+			db	d6h,59h,59h,edh,82h,e6h,bdh,64h
+			db	9ch,94h,81h,49h,f8h,83h,05h,92h
+			db	f3h,76h,5fh,90h,0ch,32h,5dh,7bh
+			db	46h,e6h,50h,73h
+			cp	a
+			ld	(hl),l
+			outd
+			ld	d,b
+			pop	af
+			in	a,(25h)
+			rra
+			ld	l,h
+			call	c,L2eca
+			inc	d
+			cp	d
+			ret	nz
+			add	a,68h
+			dec	hl
+			cp	f0h
+			ccf
+			call	z,Lc6e3
+			ld	b,c
+			ld	e,e
+			nop (2x) *
+			rst	00h
+			call	p,L44af
+			ld	b,b
+			ld	(3a2eh),hl
+			inc	h
+			add	a,h
+			ld	d,e
+			cp	e
+			ld	a,(bc)
+			rst	00h
+			or	h
+			ld	(hl),l
+			sub	d
+			dec	b
+			jp	Lb91b
+			db	f4h,bch,59h,c7h,beh,ceh,1bh,8ah
+			db	3fh,86h,a8h,4ah,81h,a3h,a4h,08h
+			db	9bh,53h,98h,4ch,b5h,82h,77h,92h
+			db	e1h,2ch,b5h,51h,64h,5bh,93h,2ah
+			db	3ah,b0h,45h,71h,2bh,f8h,14h,cdh
+			db	a9h,27h
+			sub	(hl)
+			ld	a,d
+			jp	pe,Lb68d
+			in	a,(28h)
+			inc	a
+			ld	b,c
+			dec	b
+			ld	c,a
+			inc	l
+			exx
+			adc	a,d
+			cp	b
+			ld	a,c
+			add	a,h
+			sbc	a,e
+			ld	(de),a
+			xor	d
+			call	Lef62
+			inc	(hl)
+			sub	h
+			ld	a,d
+			ld	de,99deh
+			ld	(hl),h
+			inc	(hl)
+			ld	l,(hl)
+			ret	po
+			ld	l,l
+			ld	c,h
+			call	z,L5754
+			ld	a,(bc)
+			inc	b
+			jp	pe,L1e31
+			ld	l,l
+			ld	b,l
+			sbc	a,53h
+			sub	02h
+			ld	l,b
+			ld	d,dbh
+			ret	pe
+			jr	z,L9494
+			and	d
+			sub	e
+			dec	d
+			ld	h,a
+			nop
+			ld	h,(hl)
+			or	d
+			jr	nz,L9514
+			and	l
+			ld	d,c
+			add	a,b
+			sbc	a,a
+			or	c
+			daa
+			exx
+			ld	a,(11dch)
+			call	nc,L6569
+			add	a,(hl)
+			or	e
+			ld	(de),a
+			rlca
+			in	a,(3dh)
+			ret	nc
+			ld	a,b
+			push	af
+			sbc	a,c
+			dec	e
+			call	p,L3e6b
+			ld	c,fdh
+			call	nc,Lc75d
+			rst	28h
+			ld	(hl),a
+			jp	po,Lb70c
+			and	e
+			or	e
+			ret	m
+			ld	sp,hl
+			cp	a
+			xor	h
+			sub	(hl)
+			ld	c,17h
+			cp	d
+			cp	a
+			dec	de
+			call	pe,L6725
+			inc	de
+			inc	(hl)
+			ld	e,b
+			ld	b,d
+			inc	sp
+			ld	l,l
+			ld	(hl),b
+			cp	l
+			inc	e
+			ret	m
+			ld	h,a
+			rla
+			jp	pe,Ld71c
+			dec	a
+			dec	de
+			push	hl
+			and	d
+			di
+			xor	(hl)
+			push	af
+			cp	72h
+			adc	a,b
+			or	d
+			ld	h,e
+			ret	po
+			sub	h
+			ld	(de),a
+			and	c
+			and	(hl)
+			ld	d,b
+			sbc	a,l
+			add	hl,bc
+			sub	b
+			and	b
+			ld	e,d
+			inc	e
+			sbc	a,d
+			ld	a,(bc)
+			cp	e
+			out	(37h),a
+			ld	d,c
+			rst	08h
+			inc	h
+			in	l,(c)
+			xor	d
+			cp	e
+			set	4,a
+			exx
+			or	(hl)
+			push	de
+			or	e
+			or	(hl)
+			jr	z,L94fd
+			add	hl,de
+			ld	e,h
+			ex	af,af'
+			call	nc,L11aa
+			sub	b
+			dec	a
+			ld	l,c
+			ld	b,h
+			ld	c,d
+			adc	a,dch
+			ld	a,(c8bah)
+			jr	c,L94e4
+			call	m,L3494
+			xor	29h
+			ld	(hl),4ch
+			or	09h
+			ld	h,(hl)
+			jr	L952c
+			db	a1h,1fh,bah,12h,09h,55h,d3h,1fh
+			db	17h,4bh,c3h,42h,a3h,b7h,09h,16h
+			db	3fh,75h,05h,7eh,0ch,1ah,e3h,d9h
+			db	ebh,fah,bdh,26h,feh,9dh,5ah,c7h
+			db	beh,b4h,60h,64h,64h,75h,e2h,1fh
+			db	f6h,dbh,2ah,63h,10h,ech,e8h,30h
+			db	55h,58h,ech,83h,f2h,1fh,eah,37h
+			db	35h,8dh,22h,6ah,4eh,70h
+			ld	c,h
+			xor	d
+			jp	(hl)
+			db	35h,0ah,34h,19h,2ah,2fh,a7h,abh
+			db	5fh,b1h,46h,5fh,04h,67h,2bh,4eh
+			db	80h,69h,c2h,ffh,18h,8ah,5ah,52h
+			db	d1h,c9h,80h,46h,5ah,05h,62h,b9h
+			db	0ch,98h,73h,bfh,6ah,18h,93h,deh
+			inc	l
+			nop (2x) *
+			jp	pe,Lf1e2
+			add	a,72h
+			dec	hl
+			sub	a
+			ld	a,b
+			and	c
+			ld	hl,(6387h)
+			rst	38h
+			dec	e
+			djnz	L957c
+			add	hl,bc
+			push	bc
+			ccf
+			ld	h,06h
+			cp	a
+			ld	c,e
+			call	z,L6a8c
+			ld	bc,8caeh
+			ld	c,(hl)
+			inc	d
+			ret	nz
+			ld	d,h
+			and	d
+			ld	b,d
+			jp	pe,Lf4b1
+			rst	20h
+			xor	(hl)
+			ld	(hl),l
+			or	d
+			ld	l,b
+			cp	d
+			cp	c
+			adc	a,l
+			ld	c,a
+			jp	z,L34f8
+			rra
+			ld	e,d
+			call	pe,Lfe52
+			ld	c,c
+			dec	c
+			dec	sp
+			inc	a
+			ld	l,e
+			ld	h,c
+			call	m,Le0cc
+			dec	de
+			dec	(hl)
+			ld	d,42h
+			call	c,L8e42
+			ld	d,c
+			adc	a,l
+			ret
+			db	21h,2ah,05h,31h,d4h,04h,aah,63h
+			db	ddh,12h,23h,83h,f5h,09h,e3h,53h
+			db	23h,63h,b1h
+			inc	a
+			ld	h,h
+			add	a,a
+			ld	l,5ah
+			or	(hl)
+			pop	hl
+			call	z,L68a9
+			and	05h
+			cp	e1h
+			pop	hl
+			adc	a,b
+			ld	a,h
+			sbc	a,(hl)
+			sbc	a,h
+			scf
+			cpl
+			xor	l
+			inc	h
+			xor	0bh
+			ld	c,d
+			jr	nc,L968a
+			jp	nc,L0547
+			ld	h,d
+			and	c
+			jp	m,Lcf84
+			nop
+			inc	de
+			or	l
+			ld	b,83h
+			and	a
+			or	b
+			dec	e
+			ld	sp,hl
+			jr	L9606
+			db	70h,25h,a1h,89h,61h,b5h,fdh,a8h
+			db	14h,b4h,b8h,84h,8dh,c0h,29h,95h
+			db	7dh,90h,0fh,d3h,dfh,dch,a2h,9bh
+			db	f3h,84h,52h,abh,abh,a8h,a1h,f5h
+			db	15h,4ah,18h,44h,dbh,beh,38h,8bh
+			db	16h,15h,dah,d0h,ech,56h,ffh,d7h
+			db	0fh,8fh,0eh,67h,28h,27h,b4h,7fh
+			db	4dh,42h,93h,48h,83h,d7h,8ah,10h
+			db	92h,23h,b5h,21h,71h,81h
+			ex	af,af'
+			dec	c
+			ret	nc
+			xor	h
+			ld	b,d
+			ld	l,b
+			xor	73h
+			ld	h,ceh
+			ret	p
+			in	a,(83h)
+			sbc	a,(hl)
+			call	p,L6852
+			sbc	a,a
+			dec	bc
+			ld	a,d
+			cp	e
+			ld	(be34h),hl
+			add	a,d
+			sub	l
+			ld	b,e
+			rra
+			jp	L8a46
+			db	fdh,75h,21h,b0h,69h,cbh,60h,a9h
+			db	f0h,afh,32h,76h,1eh,c3h,9ah,1dh
+			db	09h,48h,41h,1dh,4eh,81h,f4h,0fh
+			db	b7h,9ah,93h,abh,84h,f4h,24h,29h
+			db	f8h,bbh,38h,46h,8dh,33h,b9h,84h
+			db	bbh,52h,ddh,5eh,e3h,51h,03h,96h
+			db	46h,53h,a7h,d9h,9dh,cfh,92h,5bh
+			db	0eh,2ch,1ah,b5h,d4h,c9h,abh,12h
+			db	12h,b3h,c2h,7bh,67h,d5h,dch,2ch
+			db	27h,09h,35h,a2h,40h,4dh,3ah,a4h
+			db	2eh,d9h,9eh,98h,32h,9ah,14h,57h
+			call	c,Lb9bd
+			ld	l,0bh
+			inc	c
+			ld	a,d
+			dec	bc
+			ld	(hl),8dh
+			or	l
+			dec	d
+			ld	hl,6d5ch
+			call	nc,Lf8be
+			ld	(hl),c
+			inc	(hl)
+			dec	b
+			ld	c,b
+			dec	d
+			ld	(hl),l
+			jr	nc,L9710
+			call	c,Lff44
+			ld	(hl),c
+			ld	b,a
+			add	hl,hl
+			call	m,La039
+			scf
+			ld	e,b
+			xor	d6h
+			and	b
+			ld	e,l
+			adc	a,f9h
+			ld	b,d
+			dec	h
+			ld	b,l
+			dec	de
+			call	p,Laff5
+			ld	a,b
+			jp	m,Ld27d
+			cp	(hl)
+			call	nc,L5386
+			push	bc
+			dec	h
+			rst	00h
+			dec	a
+			ld	(de),a
+			add	a,a
+			ld	d,b
+			dec	h
+			inc	c
+			and	b
+			ld	a,a
+			call	z,L0e00
+			xor	l
+			ld	l,c
+			ex	de,hl
+			dec	bc
+			ld	b,e
+			adc	a,e
+			ld	c,b
+			xor	l
+			ld	c,e
+			ld	a,(de)
+			dec	h
+			exx
+			rrca
+			ld	e,0dh
+			rst	00h
+			rst	28h
+			jr	nc,L9728
+			ld	d,e
+			daa
+			ld	h,d
+			cp	b
+			inc	sp
+			sub	b
+			pop	de
+			ld	sp,hl
+			rst	30h
+			add	a,b
+			inc	hl
+			dec	(hl)
+			ld	(hl),d
+			ret	pe
+			jp	po,L0224
+			sbc	a,c
+			ld	c,b
+			rst	38h
+			ld	a,a
+			jr	nz,L9733
+			ld	e,l
+			dec	a
+			ld	a,(hl)
+			ld	b,b
+			adc	a,0fh
+			ld	a,(de)
+			xor	(hl)
+			ld	(hl),c
+			inc	bc
+			or	b
+			or	l
+			ld	e,e
+			ld	(hl),a
+			ld	l,(hl)
+			nop (2x) *
+			or	(hl)
+			ld	a,e
+			pop	af
+			ld	(bc),a
+			ld	c,b
+			jr	z,L9764
+			ld	b,b
+			ld	e,h
+			dec	l
+			call	nz,L4cbd
+			sub	l
+			ld	(de),a
+			ld	l,7ah
+			jp	m,La6cc
+			pop	af
+			ld	d,b
+			nop
+			jp	c,L8932
+			pop	bc
+			ld	d,(hl)
+			dec	a
+			ld	e,c
+			ld	l,c
+			xor	h
+			ld	c,b
+			cp	e
+			pop	hl
+			scf
+			rst	10h
+			ld	a,e
+			ld	l,b
+			and	a
+			and	1dh
+			pop	de
+			ld	d,h
+			inc	sp
+			nop
+			inc	e
+			ld	d,b3h
+			ld	sp,dc82h
+			ret	nc
+			sll	b
+			inc	bc
+			sub	(hl)
+			sbc	a,l
+			ld	l,79h
+			cp	h
+			jr	L97e3
+			db	1eh,4ah,47h,1bh,39h,26h,ffh,f1h
+			db	27h,4ch,e3h,98h,ebh,20h,a4h,96h
+			db	58h,65h,e8h,3fh,e3h,6ah,ffh,46h
+			db	48h,18h,e1h,17h,36h,96h,e8h,47h
+			db	51h,ech,d3h,37h,77h,74h,e9h,48h
+			db	f8h,3eh,36h,66h,d7h,55h,2dh
+			ld	d,c
+			adc	a,(hl)
+			rst	00h
+			sub	e
+			jp	nc,L0c15
+			sbc	a,(hl)
+			and	h
+			ret	nc
+			ld	c,e7h
+			ld	a,e
+			cp	b
+			ccf
+			ld	c,eeh
+			ld	l,75h
+			inc	sp
+			ld	d,(hl)
+			xor	(hl)
+			ld	c,(hl)
+			add	a,d
+			and	e
+			or	a
+			adc	a,l
+			adc	a,l
+			sbc	a,d
+			inc	e
+			cp	c
+			and	b
+			ld	a,(c60ah)
+			or	h
+			jr	z,L97ad
+			ld	c,l
+			ccf
+			xor	5ch
+			ld	h,d
+			ld	a,h
+			cp	l
+			nop (2x) *
+			xor	d
+			dec	e
+			dec	hl
+			and	c
+			add	hl,bc
+			ld	d,d
+			xor	h
+			dec	a
+			ld	a,b
+			call	nc,L24d6
+			ld	d,b
+			halt
+			add	a,d
+			ld	l,l
+			sbc	a,e
+			ld	e,e
+			sbc	a,l
+			pop	af
+			pop	de
+			jp	p,L3760
+			xor	b
+			rst	18h
+			or	d
+			rst	20h
+			rst	10h
+			cp	c
+			push	de
+			sbc	a,0eh
+			sbc	a,a1h
+			sub	3fh
+			ld	a,aah
+			ld	c,b
+			di
+			ld	e,e
+			and	e
+			ret	m
+			jp	po,Lee9d
+			and	(hl)
+			ld	(de),a
+			and	h
+			ld	e,c
+			pop	hl
+			jr	L9856
+			db	c5h,59h,4bh,91h,d7h,0eh,39h,13h
+			db	7dh,39h,97h,35h,f9h,f8h,cch
+			add	a,(hl)
+			rst	10h
+			jr	z,L982a
+			ld	h,a
+			ld	d,l
+			jp	c,Lb426
+			inc	l
+			cp	e
+			add	a,l
+			halt
+			dec	e
+			ld	e,d
+			ret	p
+			rlca
+			ld	a,a
+			call	L1bba
+			push	af
+			dec	l
+			call	po,L0968
+			ret	p
+			jp	c,Lb9b7
+			add	a,l
+			ld	b,c
+			nop
+			ld	e,a
+			ld	e,cfh
+			ld	e,l
+			ld	(0ef5h),hl
+			or	19h
+			and	c
+			or	c
+			ld	b,(hl)
+			rst	20h
+			adc	a,09h
+			ld	b,b
+			sub	(hl)
+			rla
+			pop	hl
+			ld	(hl),h
+			ret
+			db	fbh,38h,38h,9ch,7bh,d8h,b2h,bdh
+			db	81h,a0h,54h,86h,52h,a1h,19h,edh
+			db	67h,2dh,2ah,aah,3ah,4dh,49h,b0h
+			db	44h,8ah,d8h,c3h,c5h,68h,b2h
+			ld	d,33h
+			jp	L2554
+			db	a6h,deh,aah,0eh,1ah,1eh,4ch,23h
+			db	c4h,9ah,adh,e8h,e9h,9dh
+			rst	18h
+			dec	(hl)
+			sbc	a,b
+			inc	sp
+			ld	(hl),d
+			sub	d
+			or	l
+			inc	sp
+			push	af
+			ld	c,c
+			exx
+			ld	a,(bc)
+			add	a,h
+			jp	pe,L3025
+			or	(hl)
+			ld	b,iyh *
+			sub	e
+			pop	de
+			ld	l,a
+			and	a
+			cp	a
+			dec	l
+			inc	c
+			sub	c
+			ld	h,e
+			jp	L14f6
+			db	e3h,8fh,09h,2ah,90h,a3h,13h,57h
+			db	97h,1fh,3ch,e7h,34h
+			dec	sp
+			ld	e,c
+			ld	a,l
+			dec	l
+			inc	sp
+			rra
+			ld	d,c8h
+			ld	b,l
+			jp	nz,L55f9
+			ld	(de),a
+			ld	h,(hl)
+			inc	sp
+			ld	b,b
+			cp	d
+			ld	d,d
+			inc	(hl)
+			ld	e,l
+			call	m,L1f89
+			adc	a,h
+			dec	e
+			ex	(sp),hl
+			ld	(a028h),a
+			xor	a
+			add	a,a
+			ld	h,l
+			sub	c
+			or	c
+			inc	(hl)
+			ld	(de),a
+			ld	sp,4659h
+			sub	e
+			inc	l
+			dec	(hl)
+			call	po,La296
+			ld	l,33h
+			cp	l
+			ld	a,(bc)
+			jr	L98ab
+			db	c2h,1eh,f9h,f9h,e7h,aeh,26h,7fh
+			db	f5h,c0h,e6h,87h,14h,95h,ceh,30h
+			db	13h,8eh,0dh,59h,ddh,8eh,72h,29h
+			db	1fh,38h,66h,c1h,b5h,2eh,94h,90h
+			db	40h,60h,72h,e8h,1ch,47h,c3h,61h
+			db	8fh,46h,8ch,69h,62h,69h,16h,b8h
+			db	35h,5ch,cbh,c0h,bah,d0h,feh,bfh
+			db	48h,6ch,dch,a3h,33h,71h,c0h,27h
+			db	86h,dah,92h,25h,8fh,cdh,26h,54h
+			db	03h,80h,66h
+			ld	h,(hl)
+			ld	h,a
+			and	e
+			ld	a,h
+			add	a,a
+			add	a,(hl)
+			ld	(hl),h
+			in	a,(83h)
+			ret	nz
+			cp	8ah
+			adc	a,a
+			and	e
+			inc	a
+			or	a
+			ld	(666fh),a
+			ld	a,a
+			inc	e
+			add	a,(hl)
+			ret	p
+			jp	c,L8414
+			push	af
+			cp	a
+			inc	c
+			call	pe,L5268
+			ld	a,(0448h)
+			push	de
+			ex	af,af'
+			inc	sp
+			ld	l,b
+			or	b
+			adc	a,(hl)
+			add	a,c
+			jr	z,L99d3
+			ld	b,d
+			ld	a,d
+			jp	c,L66f7
+			push	af
+			add	a,c
+			sbc	a,e
+			pop	hl
+			ld	a,d
+			ld	d,61h
+			add	hl,sp
+			sub	(hl)
+			xor	b
+			ld	l,d
+			jp	nc,L2f01
+			ld	b,h
+			sbc	a,c
+			and	b
+			jp	m,L3f8e
+			jp	nc,Lb7a4
+			and	l
+			sbc	a,h
+			or	a
+			ld	d,c
+			ld	e,c
+			ld	h,b
+			add	a,e
+			ld	c,h
+			call	nz,Lda19
+			pop	bc
+			adc	a,c
+			rst	00h
+			adc	a,(hl)
+			adc	a,e
+			add	a,b
+			and	h
+			ld	l,b
+			sbc	a,d
+			ret
+			db	b9h,cah,31h,50h,b0h,bfh,23h,05h
+			db	ebh,00h,19h,5ch,a1h,2eh
+			adc	a,b
+			add	a,17h
+			cpl
+			ld	l,d8h
+			cp	a
+			ld	e,a
+			rra
+			ld	c,l
+			ld	d,l
+			sbc	a,a
+			ld	(hl),l
+			rst	00h
+			ld	e,a
+			exx
+			or	b
+			inc	bc
+			adc	a,d
+			sub	(hl)
+			sub	c
+			or	a
+			sbc	a,c
+			call	m,Ld25f
+			ld	a,(de)
+			ld	sp,hl
+			pop	af
+			call	Lfab1
+			rst	28h
+			ld	a,e
+			jp	p,L6483
+			ld	h,a
+			add	hl,hl
+			sbc	a,01h
+			sbc	a,d
+			jp	z,Ldeda
+			dec	l
+			add	a,b
+			inc	h
+			rlca
+			dec	(hl)
+			rrca
+			ld	l,(hl)
+			ld	l,a
+			djnz	L9a33
+			and	b
+			ld	l,b
+			ret	m
+			dec	bc
+			jp	nz,L2027
+			cp	(hl)
+			ld	c,b
+			ld	(hl),e
+			ld	d,l
+			di
+			ld	e,d
+			dec	de
+			add	a,c
+			ld	h,b
+			ld	c,d
+			dec	de
+			dec	b
+			ei
+			ld	hl,0e9fh
+			xor	a
+			di
+			ld	l,c
+			adc	a,e
+			cp	(hl)
+			ld	b,d
+			ld	c,c
+			add	a,a
+			dec	sp
+			add	a,l
+			nop (2x) *
+			or	e
+			jr	nc,L9a46
+			ld	d,d
+			sbc	a,c
+			rst	08h
+			scf
+			pop	de
+			dec	de
+			add	hl,sp
+			ld	d,b
+			ei
+			and	d
+			ld	sp,48c4h
+			di
+			inc	a
+			dec	c
+			inc	bc
+			dec	(hl)
+			inc	e
+			ld	(hl),c
+			nop (2x) *
+			ld	d,b
+			ld	d,e
+			dec	e
+			ld	e,l
+			ld	l,c
+			add	hl,de
+			and	h
+			ld	(edcah),hl
+			push	af
+			cpl
+			rlca
+			jp	nc,Lc747
+			jp	p,Lb7e6
+			ret	z
+			ld	c,(hl)
+			jp	z,L99e8
+			rst	18h
+			ccf
+			or	d
+			ld	(hl),e
+			ld	b,a
+			sbc	a,l
+			rst	10h
+			call	nz,L17ce
+			ld	c,d
+			sub	d
+			dec	bc
+			push	af
+			and	e
+			jp	nz,L06b7
+			ld	(de),a
+			ld	(hl),56h
+			cpl
+			cpl
+			add	a,b
+			nop
+			inc	d
+			jr	z,L9aa0
+			cpl
+			xor	32h
+			ld	c,l
+			ld	a,(L4c19)
+			ret	z
+			inc	b
+			and	a
+			jp	po,Leb7c
+			ld	d,b
+			ld	h,h
+			inc	d
+			or	b5h
+			ld	(8011h),hl
+			cp	h
+			sbc	a,h
+			ld	b,(hl)
+			jp	m,Lb1fe
+			nop (2x) *
+			ld	l,l
+			or	d
+			sbc	a,a
+			ld	(bc),a
+			pop	hl
+			ld	h,e
+			ld	d,b
+			cp	(hl)
+			ld	c,cfh
+			ld	l,(hl)
+			ld	c,dch
+			cp	(hl)
+			call	nc,Lbaf3
+			and	61h
+			adc	a,h
+			ld	h,a
+			call	nz,La476
+			ld	(3be1h),hl
+			out	(44h),a
+			or	b
+			add	a,b
+			ld	b,b
+			ld	l,b
+			rra
+			ret	z
+			adc	a,l
+			adc	a,73h
+			ld	l,c
+			add	a,e
+			add	a,d
+			ld	a,b
+			cp	a
+			sbc	a,l
+			pop	de
+			ini
+			in	c,(c)
+			xor	a
+			ld	c,l
+			sbc	a,d
+			ld	a,(6d44h)
+			out	(90h),a
+			inc	de
+			xor	a
+			nop (2x) *
+			ld	b,c
+			ld	d,(hl)
+			cp	e
+			ld	b,5eh
+			or	8ah
+			djnz	L9b05
+			ld	a,d
+			pop	de
+			ret	po
+			jp	L5750
+			db	91h,69h,f0h,44h,d5h
+			ld	b,e
+			cp	35h
+			ld	hl,(L80f4)
+			ld	d,h
+			xor	c
+			ld	d,c
+			inc	a
+			djnz	L9b15
+			ld	b,h
+			ret	z
+			jr	nc,L9a9e
+			ld	c,e
+			ld	h,c
+			ld	l,d
+			xor	c
+			ld	a,l
+			ld	c,c
+			rst	10h
+			ld	a,31h
+			dec	b
+			or	d
+			ld	c,l
+			cp	a
+			ld	e,b
+			ld	(de),a
+			ld	(hl),c
+			ld	(2045h),a
+			ld	e,a
+			xor	a
+			sub	a
+			inc	de
+			ld	h,c
+			ld	c,l
+			or	e
+			ld	(hl),b
+			jr	nz,L9af7
+			sub	l
+			halt
+			inc	h
+			scf
+			sbc	a,a
+			or	c2h
+			jp	c,L3e62
+			jp	nz,Lacc7
+			push	hl
+			ld	c,83h
+			ld	b,d
+			dec	l
+			cp	27h
+			sbc	a,58h
+			rra
+			ld	e,l
+			add	a,iyh *
+			ld	(bc),a
+			call	m,L6905
+			add	a,90h
+			or	l
+			ld	a,h
+			push	af
+			adc	a,d
+			ld	h,h
+			jp	p,L9bc9
+			jp	po,L5082
+			ld	e,l
+			call	m,Ld1b8
+			ld	l,a
+			cp	b
+			ld	d,e
+			rst	38h
+			inc	b
+			sbc	a,fah
+			ex	(sp),hl
+			ld	(de),a
+			or	b
+			ld	(hl),a
+			ld	b,d
+			ld	b,c
+			nop (2x) *
+			and	b
+			rst	08h
+			xor	l
+			adc	a,l
+			ld	de,adf4h
+			sbc	a,e6h
+			sbc	a,b
+			ld	b,b
+			ld	a,(bc)
+			sub	d
+			ld	b,e
+			dec	de
+			jp	nz,L353a
+			ld	e,c
+			ex	de,hl
+			cp	a
+			dec	hl
+			ld	e,d
+			push	bc
+			dec	l
+			ld	(hl),a
+			xor	80h
+			ret	z
+			ld	l,a
+			ld	b,e
+			ei
+			push	de
+			sbc	a,(hl)
+			call	po,Lf8af
+			and	h
+			rla
+			ld	(hl),ebh
+			adc	a,l
+			jr	nz,L9b14
+			ret	pe
+			ld	a,(bc)
+			add	a,h
+			add	a,d3h
+			ld	l,(hl)
+			ld	l,a
+			call	p,L5cab
+			or	h
+			add	a,e
+			ex	af,af'
+			ld	a,(0be6h)
+			dec	c
+			add	a,h
+			sub	75h
+			or	(hl)
+			out	(7eh),a
+			ld	l,l
+			ld	d,d
+			ld	c,d
+			ld	(de),a
+			adc	a,e
+			ld	l,l
+			ld	e,h
+			sbc	a,b
+			ld	a,(bc)
+			xor	a
+			push	de
+			sbc	a,c
+			cp	65h
+			ld	bc,7c3fh
+			ld	l,(hl)
+			rst	30h
+			cp	e
+			cpl
+			rst	28h
+			inc	h
+			jp	pe,Ldd95
+			jr	L9be4
+			db	2fh,2ah,feh,4bh,6ah,ech,b7h,f2h
+			db	e4h,5bh,d0h,4ch,2fh,d5h,51h,e7h
+			db	c3h,e9h,74h,9ah,e3h,60h,99h,f5h
+			db	e7h,53h
+			ld	c,e
+			ei
+			ccf
+			ld	hl,2e09h
+			call	pe,Ld336
+			ld	hl,(dc8ch)
+			ld	a,d
+			call	po,L799d
+			adc	a,l
+			ld	d,53h
+			ex	de,hl
+			and	l
+			ld	e,h
+			dec	e
+			push	de
+			ld	l,(hl)
+			call	po,L1d75
+			ld	(hl),b
+			ld	e,c
+			rra
+			sub	a
+			add	a,l
+			and	b
+			ld	hl,a5c3h
+			add	hl,sp
+			adc	a,a
+			jp	nz,L9d8e
+			and	(hl)
+			nop
+			adc	a,(hl)
+			and	c
+			jp	nc,L9ac9
+			ld	b,l
+			call	po,Lef24
+			add	a,a
+			ld	l,a
+			ld	e,74h
+			ld	(hl),d
+			or	cbh
+			ld	e,c
+			ld	a,c
+			ld	sp,0655h
+			adc	a,b
+			ei
+			ld	(hl),e
+			sub	8bh
+			ld	d,l
+			or	(hl)
+			pop	bc
+			in	a,(efh)
+			ld	(de),a
+			ld	d,c
+			sbc	a,e
+			ld	a,d
+			ld	sp,hl
+			rrca
+			call	pe,La61f
+			jp	L51ad
+			db	99h,c4h,07h,d4h,ech,dbh,85h,b3h
+			db	65h,94h,58h,2bh,d3h,3ch,d3h,42h
+			db	70h,59h,d6h,21h,01h,17h,28h,3fh
+			db	aeh,b4h,07h,d1h,3dh,c4h,f4h,e1h
+			db	24h,a5h,70h,b7h,4ah,d2h,f3h,45h
+			db	f5h,2ch,1fh,4fh,23h,1bh,7dh,7eh
+			db	69h,41h,fbh,e8h,24h,8bh,8fh,1ah
+			db	88h,f2h,7ch,90h,43h,37h,ech,feh
+			db	deh,a4h,e5h,3ah,fah,92h,afh,8fh
+			db	14h,66h,e3h,b5h,2fh,37h,66h,74h
+			db	9ah,46h,51h,f3h,4ah,70h,d0h,5bh
+			db	7eh,25h,d4h,17h,18h,01h,81h,00h
+			db	62h,36h,03h,d4h,24h,a1h,3bh,67h
+			db	77h,07h,10h,3fh,b2h,38h,c8h,fdh
+			db	86h,62h,28h,0ch,5dh,16h,2dh,e0h
+			db	29h,34h,27h,79h,33h,6bh,47h,f9h
+			db	83h,7ch,2ah,e9h,34h,e1h,6ch,05h
+			db	8ch,46h,67h,e0h,36h,cfh,b5h,9bh
+			db	f8h,ceh,3dh,a6h,6ch,5dh,e1h,e5h
+			db	d7h,7dh,6bh,b9h,aah,bdh,edh,d1h
+			db	c1h,b5h,a3h,aah,ech,f6h,fch,0bh
+			db	f5h,9dh
+			ld	l,h
+			rst	18h
+			dec	c
+			ld	(hl),d
+			ld	a,(hl)
+			ld	c,e
+			or	c
+			and	d
+			ld	d,(hl)
+			ld	b,l
+			ret	nz
+			ret	c
+			rrca
+			ld	a,d
+			jp	z,L5f44
+			dec	de
+			add	hl,bc
+			ld	e,e
+			inc	sp
+			ld	e,a
+			adc	a,e
+			rlca
+			ex	(sp),hl
+			sub	b
+			ld	(2fe4h),a
+			inc	sp
+			sbc	a,c
+			pop	bc
+			dec	hl
+			ld	(hl),h
+			sub	e
+			ld	(de),a
+			sub	(hl)
+			and	77h
+			and	l
+			and	l
+			sub	d
+			ld	e,c
+			add	a,h
+			in	a,(55h)
+			ld	b,l
+			inc	sp
+			ld	l,c
+			adc	a,(hl)
+			jr	nc,L9d2b
+			nop (2x) *
+			call	nc,Lbd29
+			ret	p
+			ret	nc
+			or	b
+			sbc	a,d
+			ld	bc,5dc3h
+			adc	a,b
+			nop
+			ld	(hl),b
+			ld	(hl),l
+			xor	l
+			ld	b,b
+			xor	b
+			jp	L922b
+			db	47h,58h,56h,c4h,7bh,9fh,65h,91h
+			db	e5h,52h,0ch,3bh,b4h,0fh,56h,44h
+			db	35h,deh,b8h,69h,aeh,b8h,0ch
+			ld	l,a
+			call	L11fa
+			and	f6h
+			add	a,b
+			ld	h,e
+			ret	p
+			ld	b,a
+			push	hl
+			add	hl,bc
+			call	po,L7fe0
+			ld	a,c
+			add	a,h
+			inc	e
+			dec	sp
+			set	2,(hl)
+			pop	af
+			adc	a,a
+			ld	c,b
+			inc	l
+			ld	hl,(2c71h)
+			inc	sp
+			dec	b
+			di
+			adc	a,b
+			ld	b,d
+			ld	(hl),d
+			adc	a,a
+			ret	p
+			xor	a
+			or	h
+			ret	pe
+			ld	sp,694dh
+			ld	l,d
+			sub	96h
+			ld	h,5eh
+			xor	d
+			call	z,L8066
+			ld	(bc),a
+			sbc	a,c
+			ld	(bafah),a
+			ret	p
+			or	d
+			ld	a,b
+			jp	m,La910
+			push	hl
+			ld	d,a
+			di
+			ld	d,(hl)
+			sub	d
+			ld	(4de1h),a
+			ld	c,d
+			dec	h
+			sub	e
+			ld	h,e
+			in	a,(d7h)
+			xor	(hl)
+			ld	b,l
+			ei
+			ld	a,l
+			jr	nz,L9d82
+			dec	a
+			ld	a,b
+			ld	l,e
+			ld	a,e
+			ld	sp,9324h
+			and	c
+			ld	d,a
+			ld	e,c
+			jr	nz,L9d51
+			pop	de
+			dec	b
+			or	d
+			and	e
+			ld	sp,bfc9h
+			and	l
+			ret	m
+			ld	d,d
+			ld	(hl),6bh
+			cp	l
+			in	a,(7dh)
+			sbc	a,e
+			ld	(hl),h
+			xor	h
+			scf
+			push	af
+			xor	a
+			ld	h,(hl)
+			sub	e
+			inc	l
+			dec	e
+			ex	(sp),hl
+			ld	b,e
+			push	de
+			cp	b
+			jp	c,L080c
+			inc	(hl)
+			sub	h
+			ld	e,9ch
+			ld	a,h
+			add	a,h
+			ld	c,h
+			ret	m
+			sub	(hl)
+			inc	(hl)
+			adc	a,a
+			dec	h
+			ld	sp,cb94h
+			ld	d,88h
+			cp	c
+			ld	hl,(90dah)
+			add	a,02h
+			add	a,b
+			jr	z,L9e05
+			sbc	a,a
+			add	a,a
+			ld	sp,hl
+			add	a,44h
+			or	h
+			cp	47h
+			ret	p
+			sub	a
+			ld	h,d
+			ld	(hl),c
+			ld	e,(hl)
+			add	hl,bc
+			sub	d
+			adc	a,44h
+			ld	a,a
+			inc	bc
+			rla
+			halt
+			ld	l,d
+			ld	h,a
+			ld	(hl),e
+			ld	a,(de)
+			ex	af,af'
+			jp	z,Ld3dd
+			add	a,c
+			ld	h,l
+			ld	bc,cc8fh
+			ld	d,c
+			add	a,b
+			dec	bc
+			sbc	a,84h
+			ld	h,(hl)
+			ret	c
+			call	z,Lcff3
+			rst	10h
+			sub	37h
+			pop	bc
+			jr	L9d97
+			db	44h,c9h,d7h,3ch,e9h,29h,bah,aah
+			db	90h,7ah,6fh,3fh,cbh,b9h,27h,2fh
+			adc	a,b
+			ld	c,d4h
+			call	z,Le700
+			adc	a,d
+			ld	b,(hl)
+			ld	d,c
+			ret
+			db	a0h,bfh,adh,0dh,a6h,5fh,e8h,61h
+			db	52h,f5h,59h,68h,eeh,bbh,a1h,24h
+			db	88h,e7h,e7h,6fh,86h,a3h,c4h,85h
+			db	d9h,96h,67h,30h,a9h
+			ld	b,d
+			ret	m
+			cp	a
+			ld	(hl),a
+			ld	h,b
+			add	a,a
+			ld	d,eah
+			jp	L13c9
+			db	76h,2eh,a1h,1fh,73h,58h,ceh,fbh
+			db	feh,dbh,bch
+			ld	d,52h
+			or	7ch
+			daa
+			ld	a,(de)
+			ld	c,c
+			ld	b,d
+			cp	(hl)
+			add	a,l
+			xor	e
+			ld	hl,8f49h
+			jr	nc,L9ea9
+			adc	a,e
+			ld	(hl),h
+			ld	e,h
+			ld	b,f5h
+			or	a1h
+			xor	(hl)
+			add	a,b
+			sbc	a,l
+			ld	l,l
+			ld	hl,3e68h
+			ld	d,e
+			ld	d,b
+			add	a,b
+			inc	bc
+			inc	b
+			daa
+			ld	bc,70ceh
+			inc	l
+			push	de
+			ld	e,ach
+			ld	a,e
+			ld	(a29eh),a
+			xor	h
+			add	a,d
+			dec	sp
+			inc	b
+			or	d
+			cp	e
+			inc	(hl)
+			ei
+			add	a,85h
+			ld	c,l
+			dec	bc
+			inc	b
+			ld	b,c
+			and	(hl)
+			ld	l,l
+			sub	l
+			jp	nz,L714d
+			add	hl,hl
+			ld	(bc),a
+			adc	a,(hl)
+			ld	e,c
+			call	pe,L7311
+			ld	e,l
+			cp	b
+			push	bc
+			xor	h
+			ld	c,b
+			and	e
+			sbc	a,e
+			ld	l,(hl)
+			ld	c,d
+			cp	l
+			inc	b
+			sub	h
+			ld	h,d
+			ret	m
+			djnz	L9e42
+			ld	b,a
+			jp	p,Lb5bf
+			ret	pe
+			jp	L2295
+			db	c1h,57h,24h,58h,b5h
+			inc	h
+			dec	d
+			ret	z
+			cp	l
+			ld	l,b
+			call	L6e28
+			ld	a,b
+			ld	b,c
+			add	a,a
+			ld	b,(hl)
+			dec	(hl)
+			ld	(hl),d
+			ld	e,d
+			jp	m,L0a92
+			adc	a,c
+			add	a,b
+			ld	(bc),a
+			dec	h
+			ld	e,e
+			ld	b,h
+			ei
+			ld	(bc),a
+			cp	(hl)
+			jp	p,L0f21
+			sbc	a,h
+			rst	00h
+			sub	c
+			call	nz,L3cd2
+			ld	(de),a
+			ret	c
+			xor	(hl)
+			inc	bc
+			sbc	a,b
+			ret	i *
+			call	po,Lbc24
+			ld	a,e
+			call	Lc9fc
+			ld	a,e
+			ld	(hl),b
+			and	fbh
+			and	d
+			adc	a,b
+			ex	(sp),hl
+			call	m,L7b58
+			call	nz,L2602
+			cp	(hl)
+			adc	a,h
+			pop	de
+			cp	b
+			add	a,b
+			call	pe,Lc318
+			dec	(hl)
+			rst	38h
+			ld	b,h
+			ld	a,(hl)
+			di
+			rra
+			djnz	L9ec4
+			cp	05h
+			xor	f9h
+			add	a,2ah
+			ret	pe
+			and	59h
+			xor	(hl)
+			ld	d,c
+			sbc	a,h
+			ld	(hl),b
+			sbc	a,3fh
+			ret	po
+			pop	hl
+			ld	b,h
+			ld	l,a
+			ld	c,c
+			ld	l,(hl)
+			add	hl,sp
+			res	5,c
+			jp	po,L1dd9
+			inc	de
+			ld	d,b
+			di
+			ld	d,h
+			or	(hl)
+			or	h
+			ld	e,a
+			ld	sp,hl
+			cp	e
+			rla
+			rst	10h
+			ld	b,l
+			ex	af,af'
+			out	(bfh),a
+			call	nz,L7d13
+			ccf
+			or	e
+			ld	(hl),l
+			ld	e,d
+			ld	l,0dh
+			sbc	a,e
+			ld	b,h
+			ld	d,d
+			ld	d,d
+			ld	e,(hl)
+			rlca
+			ld	(hl),l
+			sub	(hl)
+			or	c
+			ld	h,h
+			adc	a,b
+			ret	c
+			ld	l,a
+			ld	a,(bc)
+			ld	h,b
+			rst	10h
+			ld	(d550h),a
+			sub	(hl)
+			ld	bc,4b76h
+			ld	h,l
+			ld	d,e
+			cp	a
+			inc	a
+			ld	d,c
+			jp	p,L4c39
+			sub	4eh
+			ld	d,d
+			inc	d
+			xor	(hl)
+			rst	30h
+			jp	nz,L2bcb
+			ld	e,20h
+			xor	l
+			dec	sp
+			adc	a,(hl)
+			and	d
+			or	l
+			rst	00h
+			cp	e
+			or	e
+			rra
+			adc	a,c
+			ld	sp,fb64h
+			ld	c,a
+			or	a
+			ld	h,l
+			add	a,d
+			cp	l
+			jr	nz,L9fcf
+			call	m,Leb43
+			rrca
+			ld	e,d5h
+			ret	po
+			ld	c,d
+			ld	b,c
+			and	h
+			rst	08h
+			sub	b
+			inc	l
+			call	Lbbcc
+			inc	sp
+			sub	b
+			ld	b,d
+			call	po,Lc193
+			call	nc,L82f1
+			ld	b,c
+			sbc	a,d
+			or	3ah
+			add	hl,sp
+			ld	bc,a941h
+			add	hl,bc
+			ld	d,l
+			dec	l
+			sbc	a,b
+			push	de
+			ld	b,l
+			and	l
+			ld	c,a
+			ld	e,e7h
+			adc	a,99h
+			adc	a,e
+			adc	a,e
+			xor	d
+			dec	h
+			ld	(hl),a
+			ld	a,(bc)
+			or	e
+			ld	h,a
+			ld	d,h
+			rrca
+			inc	a
+			call	pe,L61fe
+			inc	d
+			ld	a,a
+			dec	c
+			dec	sp
+			or	(hl)
+			sub	d
+			and	(hl)
+			dec	b
+			jp	z,L4e84
+			ld	d,e
+			ex	af,af'
+			jr	nc,L9ff8
+			ret	nc
+			adc	a,(hl)
+			jp	nz,L38c8
+			cp	b
+			call	nz,L9a3a
+			call	c,Lbb9f
+			ld	a,d
+			adc	a,f8h
+			jp	po,L9e44
+			rst	10h
+			ld	(de),a
+			call	p,L7fcb
+			sub	(hl)
+			cp	b
+			nop (2x) *
+			push	bc
+			rst	30h
+			inc	b
+			xor	(hl)
+			add	a,1dh
+			call	nc,L88f5
+			ld	(hl),c
+			ld	a,(2b49h)
+			ld	b,b
+			pop	de
+			ld	e,(hl)
+			inc	d
+			ld	e,l
+			dec	(hl)
+			ld	(de),a
+			ld	e,d
+			call	pe,L31a9
+			rst	08h
+			rla
+			jp	c,Le8d8
+			inc	e
+			ld	d,b
+			and	a
+			sub	h
+			ld	h,48h
+			scf
+			add	a,h
+			sbc	a,70h
+			ld	e,a
+			ld	sp,hl
+			or	h
+			jr	L9fac
+			db	f5h,16h,ddh,8ah,f2h,6ch,43h,f4h
+			db	ceh,afh,28h,38h,8fh,d5h,7dh,d9h
+			db	b8h,95h,14h,b2h,20h,d1h,73h,04h
+			db	ach,90h,59h,feh,3dh,f7h,b8h,8ch
+			db	43h,9ch,68h,75h,bdh,8dh,eah,7ch
+			db	21h
+			push	de
+			ret	m
+			dec	bc
+			or	h
+			and	a
+			add	hl,sp
+			dec	de
+			ld	b,l
+			add	a,a
+			call	p,Le64a
+			add	a,d
+			exx
+			ld	l,a
+			inc	h
+			and	e
+			ld	sp,hl
+			or	c
+			ld	sp,0c95h
+			jp	nc,L323e
+			ld	c,c
+			call	m,L6de2
+			ret	z
+			sub	c
+			ld	(hl),e
+			push	bc
+			ld	a,c
+			ld	c,(hl)
+			ld	a,h
+			ei
+			adc	a,e
+			ld	b,(hl)
+			rst	08h
+			ld	c,d
+			ld	l,51h
+			scf
+			adc	a,(hl)
+			ld	a,c
+			ld	c,e
+			ld	b,d
+			ld	b,08h
+			dec	e
+			nop
+			adc	a,e
+			xor	c
+			ld	b,(hl)
+			inc	a
+			sub	a
+			dec	(hl)
+			ld	l,d
+			ld	a,(bc)
+			ccf
+			cp	e
+			ld	l,b
+			ld	(hl),d
+			ld	l,d
+			ld	a,(de)
+			jp	nc,Lada2
+			sub	d
+			ld	d,b
+			ld	d,h
+			ld	e,5dh
+			ld	e,a
+			ld	(hl),67h
+			jr	z,La0db
+			inc	c
+			dec	(hl)
+			dec	b
+			or	e
+			adc	a,h
+			call	c,L48e7
+			inc	bc
+			dec	e
+			ld	h,7eh
+			ld	a,(hl)
+			ret	pe
+			ld	l,h
+			cp	e
+			ld	(e81eh),a
+			sub	e
+			add	a,b
+			ld	(bc),a
+			and	(hl)
+			ld	b,52h
+			dec	h
+			dec	b
+			inc	bc
+			ld	c,d
+			add	a,(hl)
+			ld	e,h
+			or	h
+			sub	l
+			cp	(hl)
+			dec	l
+			call	Ld722
+			ld	hl,(7033h)
+			ld	d,(hl)
+			ld	a,e
+			or	(hl)
+			call	p,La0fd
+			ld	e,a
+			call	z,Lb802
+			rla
+			rst	00h
+			xor	e
+			cp	h
+			ld	b,b0h
+			cp	4ch
+			jr	c,La0c4
+			jp	nz,L9137
+			inc	d
+			ld	c,d
+			cp	10h
+			sbc	a,l
+			jr	z,La096
+			call	pe,L1512
+			ld	l,b
+			ld	b,a
+			ld	b,c
+			jp	p,Lb79b
+			add	a,e
+			dec	e
+			ld	h,c
+			ld	a,(bc)
+			xor	h
+			ld	d,b
+			dec	a
+			ld	h,d
+			ld	a,l
+			xor	d3h
+			add	a,l
+			sbc	a,b
+			ld	(hl),a
+			push	de
+			ld	h,b
+			ld	d,(hl)
+			inc	(hl)
+			ld	b,h
+			push	bc
+			ld	c,f0h
+			ld	e,d
+			and	b
+			halt
+			ld	(hl),a
+			add	hl,bc
+			rst	10h
+			adc	a,d
+			rst	00h
+			or	e
+			sub	a
+			ld	(hl),a
+			jr	La06c
+			db	c0h,76h,13h,f5h,5bh,99h,22h,d2h
+			db	3bh,beh,f7h,74h,69h,1bh,92h,cdh
+			db	c0h,cch,09h,9ch,1dh,fah,4dh,e8h
+			db	93h
+			jp	c,L6495
+			jr	c,La0cb
+			cp	(hl)
+			ld	l,h
+			dec	sp
+			sub	(hl)
+			ld	b,d
+			in	c,(c)
+			nop (2x) *
+			ld	l,(hl)
+			add	a,b
+			sbc	a,a
+			xor	(hl)
+			ld	a,e
+			ret	p
+			ld	(de),a
+			rst	38h
+			call	p,L2a7e
+			sub	f5h
+			ld	sp,6babh
+			in	a,(aah)
+			cp	h
+			ld	e,a
+			sbc	a,(hl)
+			cp	e
+			ld	c,c
+			ld	c,d
+			cpl
+			rst	38h
+			ld	sp,d275h
+			ret	po
+			xor	d
+			ld	b,(hl)
+			sla	a
+			ld	a,b
+			ld	d,l
+			cp	h
+			ld	(hl),c
+			adc	a,l
+			ld	(hl),a
+			and	b
+			ld	b,(hl)
+			jp	(hl)
+			db	94h,87h,2ch,e1h,a1h,1dh,56h,50h
+			db	2ch,80h,b7h,69h,89h,7fh,a9h,cbh
+			db	e8h,c3h,a9h,78h,56h,c0h,64h,b9h
+			db	f6h
+			adc	a,c
+			ld	(bc),a
+			add	a,e
+			add	a,c
+			dec	a
+			jp	L30ac
+			db	b1h,9ch,91h,4ch,adh,53h,b7h,b5h
+			db	3bh,8ch,75h,bah,3fh,a1h,aeh,dbh
+			db	ebh,ebh,56h,a5h,54h,ffh
+			sub	l
+			sbc	a,25h
+			ex	(sp),hl
+			jp	po,Lf6c0
+			cpl
+			ld	l,37h
+			ld	(hl),e
+			ex	de,hl
+			add	a,c
+			jp	po,L4e7e
+			dec	de
+			dec	b
+			ld	e,e
+			xor	a
+			ccf
+			ld	c,a
+			sub	c
+			ld	c,c
+			ld	b,b
+			ld	a,(bc)
+			cp	e
+			and	d
+			rlca
+			ld	e,c
+			ld	d,c
+			jp	nc,L72a3
+			xor	(hl)
+			ld	(hl),b
+			ld	a,(hl)
+			dec	bc
+			inc	a
+			dec	d
+			add	hl,hl
+			sub	l
+			jr	c,La153
+			ld	l,l
+			add	hl,de
+			xor	(hl)
+			nop
+			ld	d,c
+			and	c
+			ld	de,556eh
+			adc	a,11h
+			ld	h,l
+			ex	de,hl
+			djnz	La195
+			xor	e
+			cp	b
+			cp	e
+			ld	d,c
+			dec	e
+			di
+			ld	(hl),h
+			ld	a,(hl)
+			ld	a,(3ed9h)
+			or	c
+			ld	a,46h
+			jp	po,Lb2d0
+			ld	(hl),e
+			sbc	a,b
+			rla
+			ld	hl,(a54eh)
+			ld	e,l
+			ld	l,d
+			inc	e
+			sub	d
+			ld	(de),a
+			sub	5dh
+			adc	a,(hl)
+			ld	h,e
+			ld	e,c
+			ld	(hl),c
+			ld	c,d
+			nop (2x) *
+			ld	a,c
+			ld	d,a
+			ld	h,e
+			call	z,Lb4ec
+			jr	nc,La195
+			ld	d,(hl)
+			jp	nz,Lef5a
+			ld	b,c
+			jp	pe,L983b
+			cp	(hl)
+			ld	a,(1e9ah)
+			xor	l
+			ld	(hl),a
+			or	e
+			push	de
+			sbc	a,b
+			ld	b,(hl)
+			inc	d
+			or	e
+			ld	b,d
+			cp	l
+			ld	l,e
+			jp	(hl)
+			db	9dh,80h,68h,69h,82h,7eh,09h,d7h
+			db	1dh,99h,79h,16h,b6h,5bh,cbh,7fh
+			db	4bh,d5h,97h,5ch,dah,9bh,1eh,fbh
+			db	14h,89h,eeh,2bh,10h,1bh,29h,76h
+			db	12h,47h,9ch,67h,75h,1ch,e6h,32h
+			db	e9h,7fh,d5h,d0h,9dh
+			call	p,L5b51
+			sub	h
+			di
+			ld	(hl),c
+			jr	c,La222
+			ret	m
+			pop	af
+			jr	nz,La28e
+			xor	d
+			inc	a
+			and	l
+			ld	b,(hl)
+			and	b
+			ld	(hl),e
+			sbc	a,c
+			ld	d,a
+			add	hl,de
+			sbc	a,l
+			dec	e
+			ld	hl,(59e6h)
+			or	9ch
+			call	po,Ld174
+			dec	(hl)
+			ld	h,e
+			ret	p
+			ld	(hl),h
+			call	Lb9db
+			in	a,(58h)
+			sbc	a,(hl)
+			inc	d
+			ld	l,d
+			ld	(bc),a
+			or	c
+			ret	po
+			rst	10h
+			and	b
+			dec	a
+			and	b
+			add	a,e
+			inc	d
+			ld	a,e
+			cp	b
+			pop	hl
+			and	b
+			cp	(hl)
+			ret	m
+			jp	pe,L6c3f
+			and	h
+			jp	m,L440f
+			ld	b,e
+			ld	(de),a
+			jp	nc,L1fd3
+			ld	h,l
+			ld	c,h
+			ld	c,10h
+			rst	00h
+			sub	c
+			ld	a,a
+			scf
+			ld	l,(hl)
+			ld	e,e
+			ld	d,26h
+			sbc	a,d
+			pop	bc
+			inc	sp
+			ld	h,h
+			and	(hl)
+			jp	(hl)
+			db	beh,33h,1ch,c0h,3bh,85h,95h,1eh
+			db	9ch,beh
+			ld	h,(hl)
+			call	Le8af
+			and	2dh
+			inc	(hl)
+			daa
+			ld	hl,3d5eh
+			rst	10h
+			jr	La24a
+			db	97h,9fh,0fh,99h,b9h
+			ex	af,af'
+			sbc	a,d
+			ld	h,c
+			and	e
+			and	c
+			xor	l
+			ld	c,b
+			ld	c,h
+			ld	(hl),b
+			cp	l
+			sbc	a,h
+			ld	b,97h
+			ld	a,(bc)
+			ld	sp,6acfh
+			rst	00h
+			nop (2x) *
+			or	c
+			sbc	a,h
+			ld	b,d
+			ld	c,d
+			ret	nz
+			daa
+			ld	(bc),a
+			and	c
+			rst	38h
+			ld	(de),a
+			cp	1fh
+			ld	e,l
+			add	a,l
+			add	a,b4h
+			inc	c
+			xor	b
+			ld	a,c
+			ld	bc,d405h
+			jp	(hl)
+			db	79h,23h,34h,cdh,76h,52h,23h,a1h
+			db	a9h,efh,3fh,21h,61h,9ah,ech,adh
+			db	29h,49h,bdh,dbh,8ch,16h,61h,36h
+			db	6fh,dah,cdh,0ah,9eh,d9h,c4h,76h
+			db	3eh,e2h,c5h,01h,74h,98h,08h,1eh
+			db	afh,deh,2eh,09h,fdh,21h,7ah,c2h
+			db	5fh,dch,37h,89h,3ch,53h,94h,88h
+			db	85h,88h,28h,c8h,9fh,4eh,aah,0eh
+			db	cdh,f6h,42h,d3h,22h,04h,03h,0bh
+			db	44h,c3h,36h,25h,57h,39h,22h,30h
+			db	0ah,47h,b6h,4fh,cbh,9bh,2eh,47h
+			db	a6h,a9h,98h,fbh,cbh,1bh,7fh,46h
+			db	deh,02h,deh,e8h,2eh,44h,13h,d3h
+			db	5fh,bah,6fh,7bh,ebh,d0h,a9h,90h
+			db	22h,15h,a8h,6eh,97h,e7h,05h,f3h
+			db	0ch,e7h,30h,31h,0fh,29h,71h,ddh
+			db	06h,43h,9bh,8dh,87h,b5h,b8h,63h
+			db	f4h,e3h,4ah,efh,d3h,f6h,75h,3bh
+			db	34h,24h,7dh,4ah,90h,f2h,81h,d5h
+			db	eeh,c2h,ach,0fh,79h,72h,edh,62h
+			db	a7h,80h,93h,1ah,f1h,10h,29h,0bh
+			db	c0h,9dh
+			rst	38h
+			call	pe,L8ecf
+			adc	a,(hl)
+			add	a,(hl)
+			sbc	a,h
+			cp	b
+			add	a,c
+			ld	(hl),c
+			dec	hl
+			push	de
+			cp	(hl)
+			ld	a,49h
+			cp	a
+			ld	(hl),c
+			cp	(hl)
+			adc	a,e
+			ld	e,b
+			ret	p
+			adc	a,(hl)
+			ld	e,h
+			ld	a,e
+			ld	hl,(Ld3df)
+			ld	e,c
+			xor	54h
+			rst	30h
+			ld	l,h
+			dec	b
+			inc	hl
+			or	e
+			sbc	a,d
+			ld	d,h
+			ld	h,l
+			ld	h,b
+			sbc	a,b
+			rst	08h
+			cp	04h
+			dec	l
+			ld	a,c
+			jp	(hl)
+			db	8fh,93h,bdh,99h,efh,c0h,34h,2ah
+			db	85h,cbh,5dh,c1h,6dh,35h,d2h,8eh
+			db	43h,03h,94h,97h,5fh,92h,cfh,abh
+			db	67h,bfh,eeh,87h,d2h,ech,fch,37h
+			db	6bh,69h,e1h,70h,e4h,f4h,20h,eeh
+			db	64h,55h,4ch,54h,5ah,d7h,2ah,7eh
+			db	bch,edh,52h,19h,79h,00h,bah,43h
+			db	69h,20h,44h,57h,54h,2dh,3ah,0ah
+			db	88h,9bh,44h,24h,5eh,45h,5eh,60h
+			db	02h,76h,feh,44h,fbh,dch,cch,7dh
+			db	32h,e9h,5eh,55h,62h,afh,1fh,c9h
+			db	9bh,e3h,eah
+			daa
+			jr	z,La449
+			add	hl,sp
+			push	hl
+			ld	l,(hl)
+			ex	de,hl
+			ld	a,d
+			ld	e,h
+			pop	de
+			adc	a,a
+			adc	a,l
+			adc	a,(hl)
+			pop	af
+			rst	28h
+			ld	b,e
+			exx
+			ld	e,l
+			call	nc,Ld871
+			call	z,L9b91
+			ld	h,b
+			sub	d
+			add	a,h
+			sbc	a,h
+			ld	bc,8fffh
+			xor	a
+			ex	(sp),hl
+			ld	d,a
+			ld	e,(hl)
+			ld	(bc),a
+			nop (2x) *
+			adc	a,b
+			adc	a,e
+			rst	08h
+			and	a
+			ld	d,l
+			add	a,e
+			ld	c,d
+			xor	l
+			ld	b,(hl)
+			cp	h
+			nop
+			cp	a
+			rrca
+			cp	(hl)
+			rlca
+			call	m,L38e0
+			adc	a,(hl)
+			ld	a,(hl)
+			inc	de
+			add	a,b
+			ld	(hl),e5h
+			or	a
+			or	b
+			add	a,a
+			ld	e,a
+			cp	l
+			adc	a,b
+			call	po,L32ea
+			jr	z,La415
+			ld	h,a4h
+			inc	b
+			ld	a,(995ch)
+			call	po,L7183
+			push	de
+			sub	h
+			or	h
+			ld	b,(hl)
+			ld	l,e
+			ld	c,d
+			di
+			inc	sp
+			pop	de
+			dec	a
+			ld	b,34h
+			cpl
+			ret	nc
+			cp	(hl)
+			ld	a,b
+			ret	po
+			ld	h,(hl)
+			dec	(hl)
+			xor	c
+			ld	e,c
+			dec	a
+			jp	z,L079c
+			or	(hl)
+			pop	de
+			add	hl,bc
+			inc	(hl)
+			sbc	a,b
+			ld	e,l
+			ld	e,h
+			rst	38h
+			and	h
+			or	b
+			ld	d,c
+			ld	d,e
+			adc	a,c
+			add	a,h
+			ld	a,l
+			adc	a,d
+			cp	a
+			ld	c,(hl)
+			jp	z,Lfd7d
+			or	d
+			ld	(hl),8bh
+			ld	e,c
+			or	80h
+			or	l
+			or	h
+			and	l
+			ld	hl,(837dh)
+			sub	l
+			pop	af
+			jp	L1a23
+			db	edh,65h,5eh,eah,21h,cch,cah,64h
+			db	c3h,78h,34h,aeh,b5h,35h,03h,6fh
+			db	eeh,20h,32h,68h,84h,c6h,6ah,9bh
+			db	d3h,b1h,9dh,9dh,30h,39h,13h,75h
+			db	d3h,f9h,8ch,8eh,83h,58h,4ah,57h
+			db	8ah,15h,cdh,a5h,64h,d1h,1bh,47h
+			db	edh,4eh,32h,0ch,d5h,20h,82h,75h
+			db	13h,12h,bbh,75h,a8h,67h,39h,f6h
+			db	f3h,92h,e6h,9bh,7ah,bbh,03h,beh
+			db	54h,35h,b5h,beh,b8h,57h,d5h,5ah
+			db	91h,5bh,60h,0eh,1fh,beh,45h,f6h
+			db	00h,d4h,9ah,53h,d6h,48h,f3h,d2h
+			db	eah,c0h,8bh,00h,93h,bfh,79h,04h
+			db	27h,30h,7eh,0bh,18h,cdh,5fh,1fh
+			db	70h,76h,58h,fbh,a4h,60h,5ah,14h
+			db	d4h,08h,94h,c2h,46h,2dh,8ah,1ch
+			db	18h
+			ld	l,c
+			inc	c
+			ld	l,(hl)
+			pop	bc
+			jp	c,L5a05
+			call	c,L0179
+			ld	(hl),c
+			ld	(de),a
+			or	(hl)
+			jp	nz,Lcc4b
+			nop
+			ld	(hl),c
+			adc	a,d
+			sub	l
+			daa
+			ld	(de),a
+			ld	bc,da93h
+			and	(hl)
+			ex	(sp),hl
+			inc	(hl)
+			ld	b,c
+			inc	hl
+			ld	l,e
+			cp	e
+			ld	(bc),a
+			cp	b
+			jp	c,L8477
+			ld	h,l
+			rst	38h
+			adc	a,l
+			and	b
+			ld	sp,ba33h
+			in	a,(72h)
+			jr	z,La502
+			daa
+			res	5,(hl)
+			add	a,c
+			ret	c
+			add	a,d
+			and	e
+			ld	c,a
+			and	b
+			or	l
+			inc	hl
+			add	hl,de
+			rra
+			or	(hl)
+			ld	a,d
+			ld	l,e
+			ld	a,b
+			ld	c,e
+			inc	b
+			ex	af,af'
+			add	a,(hl)
+			inc	bc
+			adc	a,c
+			jr	La5b8
+			db	48h,06h,efh,79h,5fh,d2h,69h,ech
+			db	e2h,33h,d1h,a9h,4ah,96h,f7h,46h
+			db	0ch,15h,97h,8ah,feh,8bh,33h,c5h
+			db	1bh,bdh,91h,c6h,69h,5bh,ceh,d5h
+			db	9eh,e2h,17h,8dh,0bh,bbh,60h,78h
+			db	64h,9bh,19h,09h,a9h,a5h,c4h,66h
+			db	42h,a8h,17h,20h,32h,abh,52h,6dh
+			db	54h,dch,98h,8dh,80h,afh,45h,f5h
+			db	2bh,97h,21h,77h,62h,29h,b1h,15h
+			db	63h,36h,52h,4ah,8dh,d3h,96h,50h
+			db	54h
+			sbc	a,0ch
+			ld	c,a
+			inc	l
+			jr	nz,La5c4
+			rst	38h
+			or	h
+			and	l
+			ld	(hl),e
+			dec	bc
+			or	d
+			ld	d,b
+			add	hl,hl
+			sub	25h
+			and	(hl)
+			or	44h
+			call	po,L14f0
+			and	9ah
+			ld	b,b
+			dec	hl
+			inc	de
+			inc	hl
+			pop	bc
+			ld	c,(hl)
+			call	m,L07b3
+			rlc	l
+			ex	af,af'
+			inc	de
+			cp	c
+			sub	d
+			ld	e,d
+			sub	c
+			rra
+			ld	a,l
+			rst	00h
+			rst	00h
+			and	d
+			ex	de,hl
+			ld	d,l
+			ld	e,c
+			ex	af,af'
+			cp	e
+			ex	de,hl
+			ld	e,b
+			ld	a,d
+			cpl
+			ld	b,(hl)
+			push	bc
+			dec	e
+			or	l
+			and	e
+			sbc	a,b
+			and	a
+			ld	a,e
+			ret	pe
+			ret	c
+			exx
+			ld	sp,hl
+			and	d
+			and	b
+			xor	a
+			jp	p,L0c4a
+			ld	(ead8h),a
+			ld	h,a
+			ld	a,l
+			and	l
+			adc	a,e
+			ret	z
+			ld	sp,0443h
+			sbc	a,e
+			ld	l,l
+			adc	a,a
+			or	(hl)
+			and	h
+			ld	l,h
+			cp	e
+			or	9fh
+			ld	e,a
+			ld	l,25h
+			add	a,a
+			ld	c,h
+			cp	d
+			add	a,a
+			sub	(hl)
+			ld	b,h
+			or	l
+			add	a,l
+			jp	p,L11c0
+			ld	d,l
+			adc	a,l
+			sub	e
+			ret	pe
+			inc	bc
+			ld	a,d
+			jp	m,L408c
+			rst	18h
+			sub	e
+			or	l
+			dec	l
+			out	(ach),a
+			ld	b,l
+			xor	34h
+			dec	l
+			or	a
+			ld	b,l
+			ei
+			ret	nc
+			add	a,h
+			call	z,L418c
+			cp	b
+			rst	08h
+			ld	e,e
+			ret
+			db	70h,94h,33h,f6h,3bh,2fh,84h,46h
+			db	51h,67h,9ch,e1h,a0h,aeh,78h,a1h
+			db	2eh,42h,74h,abh,78h,b8h,eah,3dh
+			db	05h,a6h,afh,c5h,bbh,74h,deh,d6h
+			db	abh,8ah,4eh,a4h,b7h,04h,afh,efh
+			db	75h,5ah,33h,eah,0ch,6fh,56h,a7h
+			db	d2h,24h,c6h,cah,7dh,d5h,dfh,f3h
+			db	67h,b6h,73h,f6h,d0h,41h,16h,55h
+			db	f7h,afh,93h,5ch,14h,46h,afh,a2h
+			db	85h,4ch,82h,45h,30h,a0h,17h,15h
+			db	6eh,f5h,31h,52h,9dh,a2h,6bh,b0h
+			db	02h,c3h,24h,8bh,37h,0bh,2ah,c9h
+			db	9ah,afh,a9h,bfh,6fh,38h,dbh,55h
+			db	bfh,74h,52h,5ah,6bh,e3h,27h,19h
+			db	b7h,a5h
+			ld	hl,(5c20h)
+			ld	l,d
+			ret	nc
+			nop (2x) *
+			and	(hl)
+			cp	e
+			rrca
+			or	c
+			ret	m
+			sub	01h
+			cp	e
+			ld	c,b
+			dec	de
+			add	a,e
+			ld	l,a
+			ret	c
+			ld	a,l
+			di
+			ld	e,c
+			add	a,50h
+			ld	b,c
+			ld	l,e
+			sub	d
+			xor	1ch
+			call	m,L6c56
+			ld	c,(hl)
+			jp	nc,Lb736
+			ret	nc
+			call	c,L213d
+			jr	La693
+			db	bbh,7ah,c0h,5ah,1ah,98h,00h,52h
+			db	ffh,d2h,e5h,11h,2fh,dah,e2h
+			sub	a
+			rrca
+			cp	a
+			nop (2x) *
+			sub	b
+			ex	(sp),hl
+			ld	(hl),b
+			add	a,d
+			call	m,L62c8
+			dec	d
+			adc	a,d
+			adc	a,d
+			push	bc
+			ret	nc
+			jr	nc,La73f
+			ld	l,e
+			and	l
+			call	p,L6384
+			in	a,(efh)
+			ld	l,h
+			sub	b
+			sbc	a,13h
+			rst	28h
+			ld	b,e
+			call	po,start
+			ld	l,l
+			ld	c,a
+			add	a,h
+			sbc	a,h
+			ld	(hl),a
+			add	a,eah
+			ld	l,9dh
+			ld	e,c
+			adc	a,a
+			ld	sp,327bh
+			ld	d,(hl)
+			or	b
+			add	hl,bc
+			ld	a,h
+			dec	a
+			adc	a,d
+			ld	h,21h
+			nop (2x) *
+			sub	a
+			jp	(hl)
+			db	39h,24h,5eh,32h,44h,85h,46h,3ah
+			db	cbh,adh,b9h,b3h,ffh,71h,87h,96h
+			db	c4h
+			ld	a,(b75fh)
+			pop	hl
+			ld	b,h
+			ret	nz
+			di
+			sub	b
+			add	a,a
+			rst	20h
+			inc	hl
+			ld	(hl),d
+			ld	l,(hl)
+			cp	c
+			add	a,a
+			sub	b
+			dec	h
+			sub	(hl)
+			ld	(bc),a
+			ld	d,cbh
+			rst	38h
+			ld	d,a
+			or	a
+			ld	h,b
+			ld	c,(hl)
+			dec	d
+			ld	l,49h
+			xor	l
+			or	8ch
+			cp	(hl)
+			cp	h
+			ld	(fc31h),a
+			rst	10h
+			or	a
+			ld	e,h
+			jp	pe,Lbb2b
+			ld	a,l
+			ld	e,e
+			jp	nc,L2d18
+			call	p,L967b
+			ld	(ae3fh),a
+			ld	d,c
+			ld	e,(hl)
+			sub	a
+			sub	(hl)
+			ld	(hl),d
+			inc	(hl)
+			ld	d,a
+			dec	a
+			xor	c
+			adc	a,c
+			rst	38h
+			ret	pe
+			push	hl
+			ld	d,b
+			push	bc
+			ld	l,(hl)
+			ld	a,d
+			ld	d,c
+			sbc	a,f9h
+			ld	d,a
+			adc	a,e
+			inc	a
+			and	h
+			sbc	a,e3h
+			add	a,e
+			adc	a,d
+			ld	b,h
+			rst	30h
+			jr	nc,La7ea
+			ld	e,a0h
+			adc	a,b
+			ld	a,a
+			ld	a,c
+			ld	h,e
+			adc	a,d
+			ld	d,1bh
+			ld	b,c
+			ccf
+			adc	a,33h
+			rla
+			inc	bc
+			adc	a,l
+			ld	d,(hl)
+			ld	b,d
+			ld	b,a
+			jp	nc,Lf97f
+			ld	l,l
+			ret	nz
+			sub	(hl)
+			ld	b,d
+			xor	h
+			rrca
+			dec	(hl)
+			ld	l,b
+			inc	c
+			ld	a,h
+			ld	h,c
+			dec	(hl)
+			sub	c
+			xor	a
+			adc	a,00h
+			rst	38h
+			ld	b,c
+			and	d
+			call	nz,Ld31a
+			ld	c,d
+			pop	af
+			xor	(hl)
+			jr	c,La783
+			push	de
+			and	20h
+			rlca
+			ld	a,h
+			ret	nz
+			or	d
+			adc	a,b
+			call	nz,L562a
+			dec	h
+			ld	(bc),a
+			ld	(hl),a
+			ld	d,h
+			adc	a,c
+			jr	c,La746
+			inc	h
+			adc	a,e
+			add	hl,bc
+			cp	l
+			sbc	a,h
+			ld	l,b
+			ld	b,e
+			inc	e
+			rst	08h
+			ex	(sp),hl
+			adc	a,l
+			ld	l,(hl)
+			ld	c,a
+			and	a
+			sbc	a,b
+			ld	(hl),l
+			sbc	a,e
+			inc	sp
+			jr	La7c5
+			cp	b
+			ld	(hl),b
+			sbc	a,a
+			rra
+			xor	e
+			ld	(hl),h
+			ld	(hl),l
+			ld	a,d
+			jp	m,L0843
+			ld	a,(e79bh)
+			and	94h
+			xor	e
+			cp	c
+			halt
+			ld	a,a
+			sub	a
+			ret	po
+			and	c
+			call	nz,Lf87d
+			ld	c,e
+			inc	h
+			res	1,d
+			nop (2x) *
+			dec	e
+			pop	af
+			add	a,l
+			cpl
+			ld	(hl),bbh
+			cp	d
+			rst	38h
+			halt
+			ld	e,e
+			ld	l,b
+			xor	1ch
+			inc	de
+			cp	(hl)
+			ld	(hl),h
+			dec	l
+			ld	d,a
+			ld	d,c7h
+			ld	h,c
+			sub	b
+			rst	10h
+			adc	a,h
+			xor	l
+			ld	h,b
+			rst	10h
+			ld	hl,(1f80h)
+			adc	a,b
+			ret	p
+			ld	e,e
+			dec	b
+			ld	b,h
+			ret	c
+			ld	sp,hl
+			sbc	a,d
+			nop (2x) *
+			sub	e
+			or	l
+			cp	24h
+			ret
+			db	59h,c2h,18h,edh,0eh,54h,bdh,a9h
+			db	3ch,63h,71h,91h,9dh,36h,d2h,d7h
+			db	1ah,c8h,46h,14h,46h,64h,ddh,1ah
+			db	aeh,9dh,9dh
+			and	e
+			ld	(hl),l
+			ld	l,h
+			sbc	a,h
+			or	e
+			rst	38h
+			rst	00h
+			ld	e,(hl)
+			ld	(hl),d
+			jp	m,L632c
+			rrca
+			ld	(bc),a
+			ld	d,b
+			or	l
+			rst	10h
+			ld	d,c
+			ld	e,c
+			ld	(hl),l
+			ld	l,e
+			jp	pe,Lf43f
+			push	hl
+			rra
+			ld	l,b
+			adc	a,h
+			ld	h,a
+			ret	po
+			ld	d,(hl)
+			or	(hl)
+			call	po,L7bcf
+			ld	e,d
+			call	po,L366b
+			ld	c,b
+			ret	c
+			cp	e
+			inc	a
+			ld	c,c
+			sbc	a,b
+			add	a,b
+			inc	hl
+			and	c
+			inc	l
+			push	af
+			ld	c,l
+			ld	h,(hl)
+			exx
+			pop	af
+			jp	Leea9
+			db	e7h,b0h,a0h,bch,0ch,f7h,1eh,0ch
+			db	c1h,54h,0ch,e2h,f7h,4ah,5eh,41h
+			db	9bh,c2h,97h,9dh,85h,57h,8dh,94h
+			db	bdh,e1h,81h,c6h,beh,6bh,54h,44h
+			inc	h
+			ld	h,l
+			sbc	a,b
+			adc	a,(hl)
+			ld	(hl),d
+			ld	b,d
+			ld	c,c
+			call	nz,L9470
+			dec	hl
+			xor	e
+			ret	nz
+			nop
+			ld	h,d
+			ld	d,(hl)
+			call	L8ea6
+			ld	a,(hl)
+			sbc	a,a
+			sbc	a,e
+			ld	hl,305dh
+			pop	bc
+			ld	d,e
+			ret	z
+			rst	20h
+			ld	d,b
+			xor	(hl)
+			sub	(hl)
+			rra
+			or	e
+			ld	h,e
+			pop	de
+			adc	a,a
+			ld	(hl),c
+			jp	p,L531f
+			ld	l,d
+			cp	b
+			ld	(bc),a
+			ld	c,h
+			add	a,c
+			cp	a
+			jp	po,L216c
+			inc	h
+			dec	bc
+			and	a
+			ld	e,a
+			ld	h,b
+			dec	b
+			ld	a,(de)
+			ld	b,a
+			sub	a
+			adc	a,c
+			ld	h,(hl)
+			ld	l,l
+			sub	d
+			dec	bc
+			dec	de
+			inc	e
+			sbc	a,l
+			rst	38h
+			inc	d
+			ld	a,c
+			inc	l
+			ld	e,e
+			cp	a
+			cp	e
+			ex	(sp),hl
+			daa
+			push	de
+			ld	l,b
+			ld	a,e
+			res	5,l
+			inc	de
+			sub	h
+			inc	l
+			pop	de
+			ld	a,(bc)
+			cp	l
+			ld	c,ceh
+			xor	e
+			cp	(hl)
+			ld	(hl),d
+			or	b
+			ld	b,c
+			xor	a
+			ld	a,l
+			jr	c,La884
+			call	c,L0da4
+			ld	l,h
+			in	b,(c)
+			or	d
+			ld	(f326h),a
+			ret	p
+			ld	c,a
+			ld	h,a
+			jp	Lf399
+			db	06h,78h,e3h,9bh,beh,f7h,82h,88h
+			db	e1h,89h,06h,98h,4fh,1ch,53h,a8h
+			db	e4h,5ah,5fh,d3h,f9h,a3h,d1h,27h
+			db	ach,f4h
+			jp	pe,L37c2
+			dec	(hl)
+			cp	a
+			scf
+			ld	d,e
+			adc	a,e
+			cp	b
+			jp	p,L2ab4
+			push	bc
+			adc	a,b
+			and	d
+			dec	l
+			halt
+			sbc	a,h
+			sbc	a,b9h
+			rrca
+			inc	(hl)
+			inc	c
+			ld	c,b
+			jp	nz,L6515
+			rst	10h
+			sbc	a,5fh
+			adc	a,l
+			add	hl,hl
+			ret	pe
+			ld	l,e
+			sub	d
+			jp	po,L9eda
+			add	hl,bc
+			dec	l
+			ld	d,(hl)
+			ld	c,h
+			ld	c,a
+			ld	e,l
+			pop	de
+			xor	h
+			ld	bc,62fdh
+			add	hl,de
+			call	m,L1c7e
+			add	a,(hl)
+			xor	b
+			cp	e
+			sub	9dh
+			rst	08h
+			inc	a
+			sbc	a,(hl)
+			ld	(hl),c
+			sub	c
+			and	l
+			xor	c
+			ld	d,c
+			push	hl
+			xor	l
+			sub	l
+			cpl
+			jp	L8683
+			db	ddh,c9h,f2h,dfh,4fh,e4h,29h,38h
+			db	5ah,f7h,04h,65h,98h,c7h,ech,3fh
+			db	ffh,7eh,85h,0bh,c5h,d6h,fbh,4eh
+			db	68h,e4h,7dh,b4h,3eh,abh,b0h,89h
+			db	75h,edh,32h,f0h,66h,cfh,dbh,beh
+			db	36h,3dh,3ah,d3h,c9h,c3h,3bh,62h
+			db	71h,0bh,20h,8eh,f1h,01h,49h,21h
+			db	fdh,1ah,40h,98h,a6h,ddh,bbh,84h
+			db	dah,6eh,dfh,52h,b9h,24h,72h,93h
+			db	20h,9ah,0ah,74h,72h,55h,92h,f7h
+			db	4ch,9ah,cah,afh,53h,0ah,efh,d2h
+			db	d8h,86h,ceh,7dh,04h,e1h,59h,0fh
+			db	d2h,c4h,20h,39h,5ah,99h,23h,fch
+			db	38h,7bh,c3h,7fh,43h,60h,39h,dfh
+			db	9dh,4dh,96h,68h,a0h,b7h,42h,2dh
+			db	54h,cah,deh,ceh,39h,13h,b5h,dch
+			db	fch,62h,c1h,03h,76h,35h,c0h,c2h
+			db	e9h,f0h,a2h,70h,3fh,fch,9ah,fch
+			db	68h,bdh,c4h,a6h,00h,51h,d5h,0dh
+			sub	h
+			sub	b
+			ld	c,c
+			inc	(hl)
+			ld	l,c
+			ret	m
+			sub	d
+			ret	c
+			dec	sp
+			nop (2x) *
+			cp	h
+			call	nc,L823e
+			call	L3053
+			add	a,a
+			add	a,d
+			ld	d,d
+			ld	a,h
+			xor	l
+			dec	b
+			ld	c,c
+			ld	(607ch),a
+			ld	ixh,a *
+			ld	l,(hl)
+			cp	l
+			dec	de
+			sub	d
+			jp	po,Lf387
+			ld	d,e
+			ld	h,l
+			or	l
+			rlca
+			ld	e,a
+			call	po,L933a
+			ld	a,a
+			call	pe,L3107
+			cp	d0h
+			ld	c,24h
+			add	a,a
+			or	b
+			add	a,c
+			adc	a,a
+			ld	(58b7h),hl
+			rrca
+			ld	a,e
+			ld	e,a
+			adc	a,l
+			dec	e
+			sub	d
+			ld	a,l
+			ld	c,l
+			rlca
+			ld	c,b
+			jp	nz,L6eb7
+			ret	m
+			dec	d
+			dec	b
+			ld	d,(hl)
+			ld	b,l
+			and	h
+			sub	a
+			ld	hl,d7d2h
+			adc	a,h
+			add	hl,hl
+			adc	a,c
+			sbc	a,(hl)
+			dec	hl
+			adc	a,h
+			dec	a
+			or	l
+			ld	a,a
+			pop	hl
+			sub	l
+			jp	m,Lbf8f
+			sub	e
+			add	a,e
+			ld	l,7dh
+			jp	(hl)
+			db	01h,13h,43h,fbh,a9h,cfh,a7h,23h
+			db	d0h,69h,5ch,cah,65h,84h,7dh,d5h
+			db	13h,22h
+			ld	l,a
+			dec	h
+			sbc	a,b
+			ei
+			ld	a,(hl)
+			call	m,L25cd
+			rlca
+			add	a,l
+			inc	bc
+			sbc	a,76h
+			inc	d
+			ld	(hl),a
+			inc	l
+			ld	l,d
+			push	hl
+			ld	e,d
+			call	po,L0deb
+			adc	a,h
+			ld	a,l
+			add	a,34h
+			and	e
+			ld	e,c
+			call	c,Le495
+			ccf
+			ld	c,b
+			dec	h
+			ld	(hl),b
+			adc	a,b
+			ld	c,c
+			rla
+			cp	3ch
+			scf
+			ld	e,d
+			inc	hl
+			ld	c,h
+			adc	a,d
+			ld	a,d
+			ld	d,b
+			ld	(521ch),a
+			and	b
+			ld	(hl),a
+			ld	(hl),c
+			adc	a,e
+			rra
+			ld	d,a
+			inc	l
+			ld	a,l
+			rst	18h
+			ld	(hl),d
+			jr	z,Laad5
+			ccf
+			ld	l,h
+			pop	af
+			ld	h,a
+			ld	l,6ch
+			sub	b
+			pop	bc
+			in	a,(e4h)
+			sub	h
+			and	l
+			ld	(hl),1ah
+			ld	(hl),h
+			dec	b
+			add	hl,bc
+			sbc	a,b
+			adc	a,a
+			ld	c,(hl)
+			ld	l,l
+			ld	l,(hl)
+			and	e0h
+			xor	h
+			ld	l,h
+			dec	c
+			rst	10h
+			jp	po,L05ed
+			rst	38h
+			jr	z,Laa96
+			xor	b
+			rst	28h
+			jp	m,Lc116
+			ei
+			jr	z,Laa69
+			jp	(hl)
+			db	e4h,eah,a2h
+			ld	d,c
+			out	(85h),a
+			dec	l
+			add	a,h
+			ld	(2cd0h),hl
+			and	5ah
+			inc	a
+			ld	b,(hl)
+			add	a,h
+			rra
+			add	a,b
+			jp	p,Lfb5e
+			jr	nz,Laabd
+			ret	c
+			ret	nc
+			ld	a,l
+			call	m,L136b
+			dec	hl
+			jp	po,L1882
+			jp	po,L24e1
+			and	d
+			or	d
+			ld	(hl),l
+			ld	d,c
+			or	b
+			ld	d,d
+			sbc	a,a
+			ld	d,d
+			ld	b,6eh
+			sbc	a,e
+			jp	nc,L5983
+			ld	c,(hl)
+			rra
+			or	e
+			ld	l,91h
+			ld	a,d
+			cp	b
+			ld	d,9dh
+			call	c,L4b12
+			ld	c,b
+			sub	a
+			jp	pe,Lff03
+			or	(hl)
+			ld	l,d
+			call	po,Lf707
+			or	c
+			sub	(hl)
+			ld	d,(hl)
+			dec	e
+			dec	e
+			ld	(hl),l
+			ret	pe
+			rst	20h
+			ld	b,b
+			ld	l,a
+			ld	(hl),b
+			ld	e,h
+			cp	c
+			ex	af,af'
+			ret	z
+			nop
+			rst	20h
+			ld	(hl),a
+			ld	d,l
+			ld	h,(hl)
+			jp	m,L5b5a
+			or	l
+			and	a
+			sub	a
+			res	1,(hl)
+			cpd
+			ld	b,b
+			ld	h,l
+			ret	po
+			ld	a,e
+			ld	(hl),l
+			ld	a,a
+			call	pe,L20d4
+			and	a
+			sub	a
+			ld	l,l
+			halt
+			sbc	a,c
+			jr	nz,Laaf9
+			ld	bc,4b4ch
+			ld	e,a
+			and	h
+			ld	a,c
+			ld	(hl),b
+			ld	(hl),b
+			inc	(hl)
+			ret	po
+			sbc	a,c
+			sbc	a,e
+			ld	h,b
+			nop (2x) *
+			ret	c
+			ret	c
+			xor	h
+			sbc	a,(hl)
+			and	d
+			ld	b,e8h
+			ld	b,c
+			sub	l
+			jp	c,Lc0a2
+			ld	e,a
+			ld	c,64h
+			sub	a
+			ld	e,d
+			dec	h
+			ret	po
+			or	a
+			call	p,Lf5d2
+			pop	de
+			dec	(hl)
+			ld	h,e
+			inc	(iy + 07h)
+			ld	(hl),h
+			ld	b,d
+			ld	sp,bcb5h
+			out	(b6h),a
+			adc	a,a
+			nop (2x) *
+			nop (2x) *
+			ld	a,b
+			ld	d,e
+			ld	(bc),a
+			ld	e,h
+			or	a
+			cp	a
+			add	a,d
+			inc	l
+			dec	e
+			ld	e,a
+			push	bc
+			ld	h,a
+			sbc	a,h
+			ld	c,(hl)
+			ld	de,bc1ch
+			ld	c,l
+			jr	nc,Labb7
+			sub	e
+			ld	de,5995h
+			ld	b,b
+			dec	d
+			jr	z,Lab7e
+			ld	a,l
+			jr	c,Lab51
+			ret	po
+			add	a,c
+			ld	l,d
+			nop
+			cpl
+			and	ffh
+			ret	p
+			ld	c,a
+			rlca
+			ld	c,b
+			rst	28h
+			ld	b,l
+			inc	a
+			or	a
+			ccf
+			ld	h,(hl)
+			adc	a,l
+			ld	e,d
+			ld	e,d
+			rst	08h
+			inc	c
+			ld	a,h
+			inc	a
+			and	b
+			adc	a,e
+			ret	z
+			or	e
+			call	c,Lfcb0
+			cp	a
+			sbc	a,h
+			jp	po,L235e
+			ld	l,(hl)
+			ld	l,e
+			ld	e,c
+			ld	a,c
+			inc	de
+			scf
+			ld	l,d
+			add	a,d
+			inc	c
+			jr	nz,Lab57
+			cp	d
+			add	hl,hl
+			ld	(e48dh),hl
+			xor	c
+			ld	(hl),b
+			ld	a,b
+			pop	de
+			xor	h
+			ld	e,d
+			ld	(de),a
+			add	a,87h
+			jp	z,L3613
+			ld	e,e
+			ld	(hl),a
+			ret	po
+			jr	z,Labec
+			ret	z
+			ld	l,d
+			inc	a
+			ld	e,h
+			ld	(hl),c
+			sub	96h
+			xor	b
+			ld	a,(bc)
+			ei
+			ld	h,b
+			dec	c
+			rlca
+			inc	e
+			cp	a
+			pop	bc
+			jp	Lbf57
+			db	dah,6bh,b5h,eeh,6ch,0fh,8ah,13h
+			db	7fh,66h,34h,33h,beh,34h,b6h,f0h
+			db	0bh,40h,34h,3ch,e4h,d6h,c2h,e5h
+			db	bch,c0h,0fh,7ah,0fh,1ch,2fh,33h
+			db	6ch,42h,a7h,12h,e8h,77h,30h,ech
+			ld	a,(bf1fh)
+			add	hl,de
+			or	e
+			cp	d
+			jp	p,L9136
+			sub	c
+			add	a,ebh
+			ld	l,h
+			ld	(hl),c
+			jr	nz,Lac1c
+			ld	d,h
+			inc	b
+			add	hl,bc
+			ld	b,(hl)
+			adc	a,l
+			ld	h,1eh
+			jp	c,L1aa7
+			ld	e,d
+			ld	b,(hl)
+			call	p,Lea08
+			ret	m
+			call	pe,Lfe24
+			pop	af
+			cp	(hl)
+			jp	c,Lcddc
+			add	a,a
+			out	(37h),a
+			ld	h,e
+			inc	c
+			ccf
+			ld	h,c
+			ccf
+			rrca
+			scf
+			rlca
+			ret	po
+			ret	nz
+			jr	c,Labe7
+			ret	nz
+			nop (2x) *
+			sbc	a,d
+			sub	c
+			ld	b,a
+			sbc	a,b
+			rla
+			cp	c
+			call	nz,L7fa3
+			xor	h
+			ld	a,(365bh)
+			ld	l,a
+			rra
+			ld	l,h
+			ret	p
+			cp	a
+			push	hl
+			rra
+			ld	(hl),c
+			ld	(hl),d
+			ret	c
+			ld	c,l
+			nop (2x) *
+			ld	b,h
+			ld	h,a
+			ex	de,hl
+			jp	z,Le99f
+			rlca
+			ex	af,af'
+			add	a,b
+			ld	e,l
+			sub	a
+			rst	30h
+			ei
+			dec	c
+			sbc	a,2dh
+			cp	h
+			ret
+			db	d6h,09h,d8h,80h,a0h,e6h,f7h,9bh
+			db	02h,c4h,abh,dah,71h,5ah,9dh,32h
+			db	ebh,f2h,9dh,0ah,4dh,a0h,d0h,39h
+			db	6ch,15h,1ah,b1h,beh,8fh,c1h,03h
+			db	fch
+			ld	e,c
+			inc	sp
+			ld	d,8eh
+			adc	a,b
+			cp	5dh
+			nop (2x) *
+			ret	nz
+			ld	bc,1595h
+			out	(c1h),a
+			ld	l,d
+			ld	d,a
+			ld	h,a
+			ld	e,b
+			ld	h,l
+			ld	(393fh),a
+			ld	(de),a
+			call	z,L392a
+			cp	h
+			rla
+			inc	l
+			jr	nc,Laca3
+			dec	de
+			ret	nc
+			call	c,Lf2a6
+			ld	e,l
+			cpl
+			and	d
+			cp	(hl)
+			and	b
+			ld	hl,(605eh)
+			ld	c,d
+			dec	c
+			sub	b
+			jr	Lace6
+			db	a3h,eeh,7dh,f0h,7ch,dfh,ffh,48h
+			ld	bc,e8a7h
+			and	6fh
+			ld	a,c
+			ld	(hl),c
+			add	ix,bc
+			ld	d,e
+			out	(94h),a
+			ld	l,b
+			push	hl
+			cp	e
+			ld	a,l
+			ld	e,h
+			adc	a,l
+			or	l
+			ld	d,h
+			jp	Ld8e6
+			db	edh,b5h,c6h,fah,5bh,bbh,3dh,c5h
+			db	deh,1eh,3dh,63h,dch,7ah,95h
+			ld	e,(hl)
+			jp	nc,Ldead
+			ld	h,cdh
+			ld	b,a
+			ld	hl,(5f97h)
+			ld	l,l
+			or	d
+			ld	h,a
+			rst	10h
+			ld	(hl),h
+			pop	af
+			ld	a,c
+			ld	h,a
+			ld	b,0ah
+			rst	00h
+			ld	(hl),l
+			ld	l,25h
+			ld	e,a
+			call	z,Lf53b
+			call	c,Ld94f
+			halt
+			ret	po
+			jr	c,Lad09
+			call	c,Ld09b
+			jp	nz,Lf58d
+			ld	c,e
+			call	nc,L3b34
+			ld	e,69h
+			cp	l
+			ld	e,h
+			inc	hl
+			ld	e,b
+			adc	a,(hl)
+			call	nc,Ld7a4
+			ld	h,a
+			ld	c,4eh
+			and	h
+			sbc	a,30h
+			adc	a,d
+			ex	af,af'
+			adc	a,(hl)
+			sbc	a,(hl)
+			ret	nz
+			rst	28h
+			ld	a,a
+			sub	d
+			rst	08h
+			cp	a
+			ld	d,e
+			ld	c,c
+			ret	z
+			ld	a,(hl)
+			jp	m,Lb635
+			ld	h,h
+			or	l
+			ld	e,a
+			scf
+			ld	de,7767h
+			cp	h
+			ld	c,l
+			ld	b,b5h
+			inc	e
+			ld	(hl),d
+			di
+			xor	c
+			ld	d,(hl)
+			cpl
+			ld	(179ch),a
+			jp	z,L8ddc
+			ld	e,l
+			and	a
+			sub	d
+			ld	a,(de)
+			ei
+			rst	28h
+			rst	18h
+			ld	b,a3h
+			ld	a,l
+			ld	a,a
+			ld	d,e
+			nop (2x) *
+			dec	(hl)
+			jr	z,Ladd0
+			sbc	a,1fh
+			rst	28h
+			exx
+			and	h
+			ld	c,h
+			or	d
+			or	(hl)
+			ccf
+			ld	hl,(e195h)
+			add	a,e
+			ld	h,b
+			ex	af,af'
+			scf
+			xor	h
+			ld	a,l
+			cp	c
+			ld	a,(de)
+			adc	a,a4h
+			rst	38h
+			ex	de,hl
+			ld	c,(hl)
+			inc	de
+			inc	hl
+			inc	sp
+			ei
+			ld	sp,2d05h
+			inc	b
+			inc	de
+			ret	m
+			ld	h,l
+			push	hl
+			sbc	a,8ch
+			halt
+			xor	(hl)
+			ret	nz
+			nop
+			halt
+			xor	17h
+			ld	h,l
+			ld	l,l
+			pop	de
+			push	de
+			ld	b,c
+			call	nz,La4fc
+			cp	a
+			ld	l,a
+			add	a,l
+			inc	c
+			adc	a,(hl)
+			ld	b,b
+			inc	l
+			ld	b,a
+			inc	bc
+			or	b
+			ld	b,h
+			push	de
+			dec	l
+			ld	a,e
+			inc	d
+			rra
+			pop	de
+			xor	h
+			daa
+			ret	m
+			jp	(hl)
+			db	80h,72h,39h,c7h,61h,70h,53h,fdh
+			db	d0h,b1h,90h,83h,1dh,b7h
+			and	l
+			inc	d
+			ld	a,c
+			sbc	a,h
+			ld	d,b
+			add	a,a
+			ld	l,e
+			or	b
+			ld	b,d
+			jp	pe,L6441
+			rst	30h
+			ld	sp,0a47h
+			or	d
+			sbc	a,8eh
+			and	2dh
+			ld	h,b
+			ex	de,hl
+			ld	l,d
+			rrca
+			sbc	a,ech
+			sbc	a,(hl)
+			ret	nc
+			add	a,(hl)
+			add	hl,de
+			ld	c,h
+			ld	h,h
+			djnz	Lad8a
+			ret	nc
+			jp	po,L776e
+			ld	(hl),b
+			sub	a
+			ld	e,a
+			ld	(hl),e5h
+			add	hl,hl
+			and	l
+			ret	c
+			ld	c,a
+			sbc	a,a
+			ld	e,e
+			ld	b,d
+			rst	00h
+			ld	(hl),b
+			inc	b
+			dec	de
+			dec	de
+			add	a,h
+			ld	d,l
+			call	nz,La692
+			ld	(bc),a
+			inc	e
+			rst	10h
+			ld	h,c
+			sbc	a,c
+			adc	a,c
+			ld	l,a
+			ld	b,l
+			dec	de
+			or	b
+			ld	h,h
+			ccf
+			jp	c,Ldedb
+			dec	d
+			and	d
+			ld	b,e
+			ld	a,l
+			jp	L3aec
+			db	3ah,27h,91h,1eh,27h,7eh,2eh,28h
+			db	9bh,6ch,09h,91h,cfh,aah,90h,2dh
+			db	d3h,77h,5dh,cch,c8h,b7h,bah,e6h
+			db	cch,4eh,2dh,4fh,16h,dfh,3bh,c7h
+			db	7bh,0fh,cfh,64h,17h,abh,bdh,fdh
+			db	ebh,cfh,45h,99h,d8h,f7h,a9h,1eh
+			db	7dh,c6h,f1h,48h,52h,26h,0fh,8fh
+			db	dbh,75h,bah,3ah,17h,1ch,77h,b8h
+			db	bfh,bdh,c8h,29h,35h,08h,7fh,dah
+			db	d8h,5dh,b9h,49h,d7h,22h,82h,8dh
+			db	f3h,f0h,7fh,15h,6fh,b0h,eah,51h
+			db	dbh,0ch,e8h,dbh,57h,b5h,c9h,d4h
+			db	f3h,d0h,a0h,30h,3eh,08h,fah,a8h
+			db	51h,2dh,fbh,12h,cfh,bbh,83h,16h
+			db	f5h,3eh,45h,f0h,e9h,75h,60h,19h
+			db	28h,e5h,feh,3dh,e9h,b2h,c8h,f6h
+			db	fdh,23h,59h,66h,0eh,13h,5eh,02h
+			db	a7h,b6h,aeh,fbh,26h,65h,57h,abh
+			db	5fh,c1h,13h,29h,67h,ach,dfh,f3h
+			db	ffh,6eh,0fh,91h,49h,e4h,e0h,50h
+			db	6ah,9ah,4dh,81h,10h,27h,e6h,8ah
+			db	abh,13h,aeh
+			add	a,c
+			inc	hl
+			inc	sp
+			dec	l
+			ld	(bc),a
+			sbc	a,d
+			push	bc
+			xor	c
+			ld	b,b
+			xor	l
+			inc	bc
+			ld	h,85h
+			ld	sp,hl
+			ld	a,(bc)
+			dec	l
+			sbc	a,4ah
+			add	a,(hl)
+			sub	c
+			ccf
+			push	af
+			ld	e,c
+			ld	a,(ffc2h)
+			ld	sp,e8f9h
+			jp	z,Lfdbd
+			rst	18h
+			ld	b,l
+			and	e
+			add	a,c
+			dec	hl
+			call	nz,Lc17d
+			ld	a,(1cd7h)
+			dec	l
+			xor	d
+			cpl
+			ld	(hl),h
+			rla
+			pop	bc
+			or	e
+			ld	l,8fh
+			cpl
+			or	d
+			jp	L3851
+			db	28h,afh,efh,e7h,43h,66h,a2h,e1h
+			db	37h,95h,3fh,18h,bbh,65h,88h,86h
+			db	bfh,feh,a1h,51h,0bh,48h,e9h,bbh
+			db	57h,73h,beh,93h,75h,eah,f8h,bah
+			db	eeh,16h,a9h,6eh,30h
+			jp	nc,L898c
+			ld	h,b
+			ld	a,e
+			nop
+			xor	d
+			sbc	a,e
+			ld	c,a
+			ld	a,(hl)
+			and	86h
+			call	c,L3a9d
+			xor	h
+			ret	nz
+			ld	l,h
+			call	L1f60
+			ld	b,c
+			ld	a,(hl)
+			ex	de,hl
+			ld	a,(bc)
+			ld	(hl),a
+			nop (2x) *
+			ret
+			db	e9h,beh,20h,2eh,1fh,fah,ach,21h
+			db	1eh,aah,e7h,70h,c4h,5bh,edh,66h
+			db	65h,97h,ffh,40h,f3h,98h,71h,25h
+			db	cbh,33h,09h,42h,4fh,48h,56h,2eh
+			db	94h,d7h,1ah,8ah,50h,adh,59h,91h
+			db	60h,49h,95h,6fh,6ch,e6h,20h,3bh
+			db	85h,bch,deh,b0h,d6h,f7h,17h,22h
+			or	h
+			sub	3fh
+			ld	h,d
+			cp	e
+			call	c,Lda86
+			inc	l
+			adc	a,h
+			jp	(hl)
+			db	4ah,06h
+			ret	po
+			ld	c,6dh
+			ld	(49ach),hl
+			pop	hl
+			call	p,L5a19
+			rrca
+			ret	m
+			ld	c,d
+			ld	l,l
+			ld	b,h
+			sbc	a,a
+			ld	(hl),d
+			nop
+			di
+			cp	a
+			ld	(de),a
+			jp	pe,L624c
+			ld	e,d
+			ex	de,hl
+			sbc	a,d
+			adc	a,l
+			or	c
+			sbc	a,h
+			ccf
+			or	04h
+			ld	d,a
+			daa
+			ld	a,b
+			inc	a
+			ld	(hl),a
+			ld	a,l
+			jr	c,Lb031
+			jr	z,Laf9b
+			xor	64h
+			ld	e,c
+			ld	e,a
+			dec	(hl)
+			pop	de
+			ld	a,(hl)
+			ld	a,h
+			ret	pe
+			add	hl,de
+			ld	d,e
+			ld	bc,6ac3h
+			xor	l
+			ld	(hl),d
+			ld	l,cch
+			call	po,Ld162
+			ld	(hl),l
+			jp	c,L89a8
+			xor	(hl)
+			ld	a,53h
+			ld	d,d
+			ld	c,a
+			ccf
+			jp	nc,L9e7a
+			ld	e,7fh
+			ld	sp,3debh
+			ld	h,l
+			ld	b,l
+			pop	de
+			nop (2x) *
+			pop	af
+			jp	(hl)
+			db	e3h,c3h,bch,d9h,fch,78h,81h,e9h
+			db	bfh,e1h,fah,10h,9ah,c7h,51h,e9h
+			ret
+			db	02h
+			ld	b,c
+			sbc	a,h
+			ld	a,c
+			inc	d
+			ld	d,dbh
+			or	11h
+			dec	e
+			xor	(hl)
+			cp	l
+			rra
+			daa
+			sbc	a,4eh
+			jp	po,L3dc2
+			sbc	a,e
+			ld	c,(hl)
+			jp	c,L7096
+			cp	h
+			sub	h
+			jr	c,Laff7
+			call	pe,Ldd02
+			ret	p
+			ld	l,e
+			sbc	a,18h
+			sbc	a,h
+			sbc	a,iyh *
+			ld	a,(45a4h)
+			and	c
+			rst	18h
+			sbc	a,h
+			xor	c
+			ld	(hl),h
+			rst	10h
+			rst	28h
+			ld	(1eadh),hl
+			jp	c,Ld3a3
+			dec	h
+			ld	(9969h),a
+			ld	(hl),l
+			cp	a
+			ld	l,l
+			jr	nz,Lafd5
+			ld	a,c
+			sbc	a,l
+			ld	l,d
+			ld	h,l
+			inc	hl
+			ld	sp,3ee2h
+			ld	a,l
+			ld	(hl),h
+			ld	(hl),e
+			sub	c
+			rst	00h
+			dec	l
+			cp	d3h
+			inc	de
+			cp	l
+			ld	bc,5845h
+			ld	c,c
+			ld	b,(hl)
+			jp	pe,L4f1f
+			jp	c,L8510
+			ld	c,h
+			xor	h
+			jp	z,L5ef4
+			ld	l,h
+			add	hl,sp
+			ld	l,h
+			ld	c,h
+			ld	(bc),a
+			ld	(6790h),a
+			sbc	a,a
+			ld	e,h
+			dec	e
+			ret	m
+			ld	l,b
+			sbc	a,e
+			xor	b
+			ld	l,e
+			jp	nc,L66c6
+			ld	d,l
+			sub	a2h
+			ld	a,(d833h)
+			ld	a,h
+			jr	nc,Lb002
+			add	a,b
+			ld	l,a
+			xor	e
+			inc	bc
+			or	h
+			ld	(hl),b
+			add	a,h
+			sub	(hl)
+			sub	fdh
+			jr	nc,Lb05b
+			rrca
+			ld	(hl),l
+			sbc	a,a
+			ld	c,b
+			ld	h,c
+			sbc	a,h
+			ccf
+			ld	a,(bc)
+			ld	h,a
+			add	a,b
+			add	a,h
+			ld	(hl),a
+			ld	c,c
+			call	m,L73a0
+			cp	e4h
+			adc	a,a
+			call	nc,Lb477
+			jr	Lb067
+			db	10h,e8h,9eh,ebh,3dh,44h,8eh,25h
+			db	48h,00h,18h,55h,ddh,ceh,67h,95h
+			db	f2h,43h,8ch
+			ld	hl,36cdh
+			ld	c,a
+			ld	b,b
+			ld	e,b
+			ld	c,d
+			rst	10h
+			ld	e,b
+			and	c
+			and	c
+			ld	(a1e0h),hl
+			adc	a,c
+			ld	c,l
+			pop	hl
+			ld	sp,hl
+			ret
+			db	85h,66h,e9h,dbh,deh,beh,13h,02h
+			db	fbh,7dh,f8h,a1h,f0h,e2h,f2h,31h
+			db	88h,38h,e2h,c4h,f0h,62h,04h,fdh
+			db	aah,6dh,26h,bch,7ah,abh,1fh,f6h
+			db	38h,d9h,94h,cfh,a3h,b2h,7bh,06h
+			db	95h,afh,53h,0fh,e3h,b2h,94h,53h
+			db	fdh,37h,04h,cdh,bbh,b2h
+			di
+			sbc	a,(hl)
+			ld	bc,1eeeh
+			nop
+			sbc	a,e
+			jr	nz,Lb17b
+			djnz	Lb0aa
+			adc	a,69h
+			cp	l
+			ld	l,a
+			ld	h,c
+			ld	a,(de)
+			nop (2x) *
+			inc	a
+			or	l
+			ld	c,e
+			ld	(hl),8dh
+			and	b
+			xor	ech
+			dec	bc
+			ld	b,ixl *
+			dec	a
+			dec	d
+			ld	c,04h
+			dec	a
+			ld	(bc),a
+			rst	00h
+			ld	(hl),l
+			ld	b,18h
+			ld	b,e
+			jp	pe,L59b1
+			call	po,L15d7
+			xor	d
+			res	6,a
+			and	e9h
+			jp	po,L82c8
+			and	a
+			xor	e
+			xor	a
+			sbc	a,a
+			in	a,(f1h)
+			ld	de,21ffh
+			pop	de
+			jp	m,L7a72
+			scf
+			dec	a
+			inc	hl
+			cp	c
+			ld	a,80h
+			call	pe,Lcbbb
+			ld	l,89h
+			rla
+			ld	(hl),a
+			ld	bc,4ae4h
+			sbc	a,(hl)
+			sbc	a,(hl)
+			inc	de
+			cp	c
+			or	c
+			xor	a
+			ld	e,h
+			ld	de,e70eh
+			sbc	a,b
+			add	a,d
+			cp	b
+			sbc	a,38h
+			sub	d
+			cp	a
+			jr	z,Lb19f
+			ld	d,(hl)
+			adc	a,c
+			out	(deh),a
+			add	a,a
+			and	e
+			ld	(6befh),hl
+			ld	(hl),l
+			sbc	a,h
+			ld	e,d
+			rra
+			sub	d
+			inc	de
+			sbc	a,04h
+			ld	(hl),l
+			dec	a
+			ret	c
+			ld	l,(hl)
+			or	b
+			inc	b
+			call	nz,L6ef6
+			xor	c
+			or	(hl)
+			ld	a,d
+			sbc	a,a
+			jr	Lb1f7
+			db	1ah
+			dec	(hl)
+			add	hl,sp
+			ld	l,d
+			ld	h,c
+			rrca
+			ld	a,b
+			cp	d
+			out	(87h),a
+			inc	d
+			or	l
+			ld	c,(hl)
+			jr	c,Lb149
+			ld	e,c
+			jp	L4979
+			db	d7h,c5h,d2h,8eh,17h,73h,1ch,ech
+			db	ech,55h,0ah,17h,02h,38h,5bh,d3h
+			db	dbh,07h
+			ret	po
+			ld	d,l
+			sub	(hl)
+			pop	de
+			cp	a
+			adc	a,d
+			dec	b
+			cp	d
+			halt
+			ld	l,d
+			ld	l,(hl)
+			call	c,L0c6d
+			jr	nc,Lb1d8
+			ld	a,l
+			call	z,L78ea
+			add	a,e
+			ld	a,13h
+			ld	b,(hl)
+			inc	c
+			or	h
+			ld	l,l
+			jp	pe,L95cf
+			sbc	a,9ch
+			add	a,a
+			nop (2x) *
+			ld	b,d
+			jp	m,L86d1
+			xor	h
+			rst	10h
+			cp	c
+			sbc	a,e
+			ld	c,l
+			ld	l,a
+			pop	de
+			inc	e
+			ld	l,b
+			sbc	a,6ah
+			ld	d,7fh
+			ld	b,e
+			inc	a
+			and	h
+			ret	c
+			ld	(hl),c
+			ld	c,bdh
+			add	a,a
+			adc	a,94h
+			add	a,f0h
+			or	46h
+			dec	(hl)
+			sbc	a,c
+			rlca
+			ld	c,b
+			adc	a,c
+			ld	(de),a
+			ret	m
+			ld	c,c
+			call	nc,Lc24a
+			ld	b,b
+			add	a,c
+			sbc	a,a
+			inc	l
+			ld	a,(hl)
+			ld	h,b
+			ret	z
+			and	h
+			ld	l,l
+			push	de
+			ld	b,h
+			pop	af
+			cp	e
+			ld	d,l
+			pop	bc
+			adc	a,l
+			cp	c
+			ld	hl,194dh
+			add	hl,bc
+			sbc	a,b
+			ld	h,(hl)
+			and	a
+			ld	a,c
+			ret	c
+			ld	(hl),e
+			rrca
+			inc	l
+			cp	a
+			call	po,L68c5
+			or	46h
+			adc	a,0ah
+			or	l
+			jp	po,L8f16
+			or	21h
+			push	hl
+			add	a,86h
+			or	c
+			cp	c
+			cpl
+			add	a,a0h
+			pop	hl
+			add	a,d
+			call	z,L614b
+			ld	a,(a15eh)
+			ccf
+			and	b
+			ret	z
+			ld	l,l
+			ld	e,c
+			sbc	a,l
+			ld	(hl),e
+			pop	de
+			add	a,h
+			cp	d
+			set	6,d
+			rrca
+			ret	nz
+			ld	c,b
+			ld	a,1ch
+			jp	pe,Lc6d5
+			cp	d
+			ret
+			db	72h,21h,9ah,64h,02h,61h,8ch,f5h
+			db	cah,43h,e2h,99h,afh,73h,b2h,3bh
+			db	efh,72h,45h,eeh,1ah,65h,21h,50h
+			db	a5h,5bh,afh,71h,46h,0dh,81h,1eh
+			db	a9h,60h,77h
+			ret	p
+			ld	l,a
+			inc	h
+			ret	m
+			adc	a,(hl)
+			sbc	a,d
+			adc	a,l
+			inc	de
+			call	z,Lc70a
+			sub	(hl)
+			rst	10h
+			ret	m
+			jp	m,L7c7c
+			sub	c
+			ld	l,c
+			call	m,Lb4a2
+			ld	a,d
+			ret	c
+			nop
+			sbc	a,l
+			dec	hl
+			ld	e,c
+			daa
+			ld	(hl),b
+			jr	c,Lb229
+			jp	L9826
+			db	c2h,27h,1fh,bah,c4h,f4h,cdh,1dh
+			db	5ah,d4h,85h,dfh,1dh,30h,7dh,dch
+			db	35h,0eh
+			ld	e,c
+			ld	(hl),l
+			call	z,Lbda3
+			adc	a,84h
+			djnz	Lb29e
+			dec	b
+			sub	a
+			add	hl,sp
+			rrca
+			ex	(sp),hl
+			ld	(2c7ah),a
+			nop (2x) *
+			sub	a
+			cp	h
+			ld	b,e
+			inc	de
+			ld	e,e
+			ld	b,l
+			xor	a
+			sbc	a,c
+			ld	b,h
+			or	a
+			ld	d,d
+			or	b
+			ld	a,h
+			ld	d,e
+			inc	l
+			ld	h,b
+			ld	e,l
+			xor	e
+			cp	b
+			sub	e
+			ld	d,a
+			ld	(hl),85h
+			push	bc
+			pop	bc
+			push	hl
+			or	b
+			sub	h
+			dec	b
+			ld	e,d
+			ld	e,l
+			ld	e,c
+			ld	l,d
+			jr	nz,Lb2cf
+			xor	b
+			ld	l,e
+			ld	(hl),h
+			rst	38h
+			call	p,L0d57
+			ld	l,h
+			ld	d,l
+			ld	a,d
+			ld	(hl),d
+			xor	c
+			call	nc,Lcdaa
+			scf
+			dec	e
+			call	po,La16d
+			xor	(hl)
+			ld	c,a
+			ld	l,l
+			ex	de,hl
+			add	a,e
+			set	5,(hl)
+			inc	hl
+			daa
+			adc	a,(hl)
+			ld	h,a
+			ld	e,(hl)
+			ret	nc
+			dec	h
+			ld	h,e
+			xor	l
+			inc	hl
+			ld	e,d
+			rla
+			ld	(hl),65h
+			inc	e
+			sbc	a,e
+			ex	(sp),hl
+			ld	h,d
+			or	b
+			ld	bc,15cah
+			rst	08h
+			cp	a
+			adc	a,h
+			ld	a,a
+			ld	l,2ah
+			ld	de,a708h
+			xor	e
+			ld	(hl),f2h
+			pop	bc
+			adc	a,b
+			scf
+			cp	(hl)
+			pop	bc
+			xor	(hl)
+			ld	c,d
+			cp	d
+			ld	c,l
+			jp	po,L3023
+			and	h
+			ld	(hl),e
+			ld	e,(hl)
+			inc	h
+			cpl
+			ld	c,l
+			call	c,L1e73
+			push	hl
+			sbc	a,e
+			sub	a
+			ret	po
+			exx
+			djnz	Lb342
+			xor	d
+			pop	bc
+			inc	a
+			cpl
+			ld	e,e
+			sbc	a,(hl)
+			ld	c,a
+			ld	h,a
+			ld	b,h
+			dec	a
+			sub	b
+			cp	e
+			jr	c,Lb393
+			call	po,L6e48
+			ld	e,a8h
+			ld	c,h
+			dec	d
+			ld	sp,hl
+			ld	(bc),a
+			rst	00h
+			ld	a,l
+			ld	e,e
+			rst	18h
+			add	a,98h
+			ld	e,14h
+			cp	e
+			add	a,l
+			ld	b,e
+			ld	(hl),d
+			ld	h,e
+			ld	bc,17b9h
+			adc	a,e
+			jp	po,L0b82
+			ld	a,(hl)
+			ccf
+			inc	sp
+			ld	d,8ah
+			and	l
+			call	nc,L48ee
+			out	(66h),a
+			sbc	a,d
+			ld	(hl),a
+			nop (2x) *
+			ld	c,b
+			ret
+			db	3eh,81h,64h,f5h,33h,dbh,08h,c8h
+			db	61h,e2h,0bh,d8h,f8h,84h,76h,cdh
+			db	fdh,87h,f9h,0ch,58h,03h,74h,cdh
+			db	04h,45h,50h,a8h,59h,33h,fdh
+			ld	l,h
+			ld	e,e
+			ld	a,c
+			daa
+			ld	d,00h
+			nop (2x) *
+			xor	b
+			sub	(hl)
+			ld	hl,(6c6bh)
+			ld	a,(de)
+			ld	h,e
+			sbc	a,(hl)
+			set	2,d
+			and	e
+			dec	a
+			ld	c,e
+			sbc	a,a
+			xor	e
+			cp	(hl)
+			adc	a,b
+			dec	b
+			push	af
+			ex	af,af'
+			adc	a,c
+			cp	d
+			ld	b,c
+			ld	sp,9121h
+			dec	sp
+			dec	c
+			add	a,l
+			cp	l
+			ld	d,(hl)
+			ld	b,l
+			or	h
+			ld	a,(bc)
+			pop	de
+			sbc	a,(hl)
+			ld	l,(hl)
+			ld	e,b
+			ld	c,l
+			ld	b,d
+			and	(hl)
+			ld	l,(hl)
+			cp	h
+			ld	l,b
+			ld	l,h
+			ld	l,bah
+			ld	e,66h
+			jp	pe,L3c4e
+			xor	(hl)
+			ld	hl,(cb34h)
+			or	d
+			ld	a,(de)
+			ld	d,l
+			sbc	a,h
+			and	(hl)
+			ld	d,f8h
+			nop
+			adc	a,h
+			ld	b,b
+			ld	bc,70fch
+			inc	h
+			ld	l,a5h
+			inc	b
+			ld	h,53h
+			add	a,a
+			ld	d,e
+			ex	(sp),hl
+			xor	c
+			ld	e,41h
+			ld	h,e
+			add	a,(hl)
+			rrca
+			ld	a,(27b2h)
+			ld	a,(de)
+			dec	a
+			add	hl,bc
+			and	a
+			ex	(sp),hl
+			rst	08h
+			ld	b,a
+			ld	b,a
+			sbc	a,9fh
+			ld	l,e
+			push	hl
+			ld	c,a
+			rst	18h
+			ld	h,l
+			ret	pe
+			adc	a,45h
+			sbc	a,a
+			add	hl,de
+			set	1,e
+			ld	b,a
+			ld	d,h
+			adc	a,1ah
+			jp	nc,L65dd
+			and	a
+			rst	10h
+			ld	(hl),h
+			dec	e
+			ret	m
+			ld	b,60h
+			ld	h,4bh
+			ld	h,(hl)
+			rst	10h
+			dec	d
+			jp	c,L313e
+			daa
+			ld	(hl),c
+			dec	l
+			ccf
+			ld	de,34d0h
+			dec	de
+			call	po,L3c04
+			dec	l
+			push	af
+			or	b
+			ld	a,(baeah)
+			sbc	a,02h
+			ld	(hl),cfh
+			xor	e
+			and	eeh
+			exx
+			ld	(hl),l
+			ld	l,(hl)
+			pop	bc
+			rst	20h
+			add	a,a
+			ld	d,d
+			ld	h,e
+			ld	c,c
+			ld	hl,(2aedh)
+			inc	e
+			ld	(hl),b
+			ret	m
+			ld	(hl),37h
+			xor	19h
+			xor	e
+			dec	b
+			ld	e,(hl)
+			inc	c
+			adc	a,(hl)
+			ld	b,d
+			ld	l,e
+			ld	c,a
+			or	l
+			ld	l,b
+			add	hl,de
+			or	(hl)
+			ret	z
+			and	c
+			ld	sp,caebh
+			ld	c,h
+			xor	e
+			ret	p
+			or	c
+			ld	b,c
+			ld	a,(hl)
+			sub	a
+			xor	(hl)
+			jr	z,Lb3f9
+			sub	b
+			call	pe,Ldb6c
+			ld	c,d
+			xor	l
+			sub	e
+			ld	e,c
+			ld	h,h
+			jp	L1e51
+			db	9ch,bbh,a5h,20h,97h,7dh,6bh,43h
+			db	eeh,d7h,3fh,b3h,5bh,7eh,d7h,36h
+			db	30h,07h,8ch,f5h,26h,abh,26h,46h
+			db	f5h,08h,8ah,9eh,3eh,ech
+			pop	de
+			dec	de
+			ld	a,c
+			djnz	Lb4d4
+			ld	d,l
+			ret	nz
+			ret	nc
+			and	b
+			ld	e,l
+			ld	(hl),a
+			dec	(hl)
+			inc	b
+			add	hl,bc
+			call	p,L9e84
+			sub	d
+			or	b
+			dec	de
+			ld	a,(de)
+			ld	sp,e370h
+			dec	a
+			call	po,L4a26
+			add	a,d
+			djnz	Lb441
+			ld	a,c
+			and	e
+			dec	(hl)
+			ld	b,h
+			ld	(hl),a
+			sbc	a,c
+			di
+			dec	b
+			xor	b
+			ld	e,(hl)
+			jp	Lad74
+			ld	sp,ce23h
+			ret	nz
+			inc	de
+			adc	a,d
+			ld	h,h
+			ld	a,(hl)
+			ld	c,2ch
+			ld	h,h
+			ld	d,c
+			ld	sp,hl
+			nop (2x) *
+			ld	e,c
+			ld	l,h
+			adc	a,c
+			ld	d,h
+			ld	h,l
+			ld	l,(hl)
+			jp	(hl)
+			db	6ah,d1h,02h,58h,65h,feh,b6h,17h
+			db	44h,45h,c9h,18h
+			ld	a,b
+			ld	hl,503ah
+			ld	l,l
+			ld	(de),a
+			xor	b
+			sbc	a,38h
+			ld	(e34fh),hl
+			add	a,e
+			inc	b
+			adc	hl,de
+			sbc	a,l
+			sub	afh
+			jp	L2dca
+			db	c9h,20h,a4h,0ah,75h,13h,0ch,0ch
+			db	69h,b9h,a7h,40h,82h,95h,96h,22h
+			db	62h,0ch
+			ld	l,03h
+			inc	c
+			ld	(c63ah),hl
+			ld	sp,iy
+			ld	c,e
+			dec	d
+			jp	po,Lcda0
+			xor	a
+			cp	(hl)
+			xor	l
+			jp	pe,Lad94
+			ld	d,h
+			sbc	a,h
+			jr	nz,Lb52e
+			sub	l
+			ld	a,(hl)
+			ld	a,h
+			dec	bc
+			ld	hl,2c89h
+			jp	Ld767
+			db	76h,06h,23h,dfh,00h,5eh,abh,1eh
+			db	afh,28h,26h,40h,f7h,cdh,31h,98h
+			db	7dh,7ah,67h,6ch,d5h,56h,05h,2eh
+			db	b5h,5fh,b5h,61h,e5h,e8h,08h,adh
+			db	52h
+			dec	bc
+			sbc	a,d
+			ld	(hl),a
+			jp	Lb80a
+			db	73h,b7h,52h,55h,cfh,c0h,d3h,03h
+			db	4dh,c9h,bch,f8h,81h,5ch,52h,47h
+			db	fbh,5bh,c8h,87h,29h,29h,d0h,47h
+			db	7ah,a5h,94h,94h,57h,dfh,1ch,95h
+			db	f1h,9eh,dah,6eh,80h,eeh,9ch,dch
+			db	cdh,fch,34h,9bh,5bh,98h,52h,0ch
+			db	0dh,55h,45h,3ah,b9h,97h,f2h,cfh
+			db	cbh,14h,66h,bbh,81h,e5h,4eh,a2h
+			db	72h,7ah,0dh,52h,44h,aeh,b2h,c9h
+			db	6ah,4bh,0fh,bdh,7ah,85h,18h,d2h
+			db	b5h,58h,bch,a0h,8eh,95h,c7h,6eh
+			db	a0h,35h,87h,8dh,23h,83h,e3h,c8h
+			db	77h,12h,68h,9fh,1eh,75h,50h,13h
+			db	b6h,f7h,47h,5ch,83h,92h
+			ld	l,b
+			ld	d,l
+			sub	b
+			or	l
+			add	hl,bc
+			inc	b
+			dec	(hl)
+			ld	(hl),a
+			ret	c
+			ld	d,(hl)
+			cp	(hl)
+			ld	l,h
+			ld	sp,0a65h
+			jp	z,L9486
+			jp	(hl)
+			db	eeh,d0h,58h,60h,9ch,0bh,a3h,17h
+			db	eah,c1h
+			sub	c
+			or	c
+			inc	d
+			or	d
+			ld	e,e
+			add	hl,bc
+			dec	hl
+			xor	02h
+			ei
+			ld	c,c
+			ld	l,d
+			and	e
+			rst	08h
+			ld	d,h
+			sub	d
+			sbc	a,(hl)
+			dec	(hl)
+			adc	a,c
+			dec	b
+			ld	(hl),c
+			rst	20h
+			res	5,e
+			ld	c,b
+			ld	(466eh),hl
+			ld	e,l
+			ld	e,a
+			dec	l
+			ld	sp,hl
+			cp	a
+			and	81h
+			out	(31h),a
+			djnz	Lb5a2
+			ld	c,a
+			rst	18h
+			ex	(sp),hl
+			ld	d,l
+			or	b9h
+			sub	l
+			sbc	a,c
+			xor	e
+			ld	a,(hl)
+			call	L91cf
+			adc	a,b
+			inc	c
+			daa
+			ld	(hl),d
+			sub	c
+			ld	e,(hl)
+			inc	ixl *
+			sub	a
+			cp	(hl)
+			cp	h
+			jp	z,Ldb1e
+			or	l
+			adc	a,h
+			xor	a
+			jr	nz,Lb63c
+			call	nc,L3421
+			rlca
+			ld	(de),a
+			ret	p
+			ei
+			ld	l,l
+			nop (2x) *
+			jr	nz,Lb5c2
+			ld	c,c
+			sub	c
+			ret	nc
+			rst	10h
+			ld	c,b
+			jp	nc,L16c2
+			jp	z,L46f7
+			add	a,h
+			ld	(hl),h
+			ld	d,h
+			ld	e,e
+			ret	c
+			xor	b
+			add	hl,hl
+			ret	po
+			jp	z,L935b
+			rst	20h
+			and	l
+			dec	(hl)
+			ld	(hl),a9h
+			jr	nc,Lb5ea
+			jp	pe,L4dfb
+			pop	hl
+			ld	b,(hl)
+			ld	d,d
+			ret
+			ret	po
+			dec	c
+			xor	b
+			ld	d,(hl)
+			ld	(de),a
+			xor	l
+			jp	nc,L4821
+			sbc	a,e
+			ld	sp,aec4h
+			ld	h,h
+			call	po,L3ff8
+			jr	nz,Lb6c7
+			ld	l,b
+			or	e
+			call	c,L0cef
+			ccf
+			ld	h,l
+			sbc	a,c
+			jp	nc,La265
+			ld	h,a
+			ccf
+			jp	pe,L1c99
+			ei
+			add	a,h
+			di
+			ret	p
+			dec	d
+			add	hl,de
+			ld	l,a
+			ld	d,b
+			adc	a,e
+			ld	h,(hl)
+			ld	e,c
+			or	(hl)
+			ld	(hl),b
+			ld	l,a
+			halt
+			ex	af,af'
+			res	1,c
+			rst	10h
+			ld	b,(hl)
+			ld	b,l
+			pop	hl
+			jr	c,Lb626
+			ret	nc
+			ccf
+			ld	(de),a
+			call	z,Lf237
+			add	a,b
+			dec	a
+			add	hl,hl
+			daa
+			ei
+			sub	l
+			ld	c,c
+			call	pe,L1e08
+			ld	(hl),l
+			rst	08h
+			add	a,d
+			ld	(hl),d
+			ret	po
+			ret	c
+			dec	d
+			xor	b
+			exx
+			pop	de
+			or	(hl)
+			rla
+			ret	z
+			call	L4bfc
+			ld	b,c
+			ld	a,a
+			rst	38h
+			rst	30h
+			dec	bc
+			sub	(hl)
+			ret
+			db	d0h,e3h,0bh,39h,afh,ddh,d6h,c9h
+			db	4ah,19h,8eh,8bh,69h,adh,d4h,82h
+			db	2fh,bch,0eh,23h,2ah,e0h,cdh,4ah
+			db	c9h,1ch,12h,85h,17h,3bh,beh,dch
+			db	77h,f9h,59h,f0h,cfh,b8h,4dh,89h
+			db	34h,4eh
+			ld	e,h
+			ld	l,e
+			ld	e,b
+			or	b
+			ld	l,(hl)
+			sbc	a,f6h
+			inc	l
+			pop	bc
+			adc	a,l
+			ret
+			db	fah,8ch,fah,8fh,30h,e0h,deh,5fh
+			db	72h,03h,1fh,dch,97h,f2h,e0h,7dh
+			db	cfh,7fh,9ch,2ch,edh,0ch,18h,72h
+			db	a9h,36h,63h,a2h,1ah,deh,70h,feh
+			db	82h,18h,20h,e6h,aeh,5fh,4eh,d1h
+			db	f4h,20h,ffh,70h,3ah,2fh,1ah,a5h
+			db	1ch,74h,cah,a6h,94h,43h,33h,d2h
+			db	2ch,9eh,07h,17h,d1h,98h,18h,65h
+			ld	b,a
+			sub	l
+			add	hl,sp
+			and	l
+			ld	a,c
+			sub	c7h
+			jr	z,Lb6c1
+			add	a,52h
+			ld	a,b
+			call	po,Ld0c2
+			ld	l,l
+			sub	e
+			dec	sp
+			ld	h,d
+			adc	a,a
+			adc	a,a
+			sbc	a,6dh
+			cp	a
+			ld	a,b
+			and	a
+			ld	a,a
+			ld	a,b
+			ld	h,(hl)
+			ld	b,c
+			inc	h
+			rrca
+			ld	(2b18h),hl
+			ld	(4da3h),hl
+			adc	a,b
+			ret	pe
+			ld	e,a
+			add	a,a
+			sbc	a,77h
+			xor	b
+			inc	d
+			or	b
+			ld	b,e
+			and	a
+			or	c
+			xor	b
+			or	(hl)
+			sbc	a,a
+			ld	(bc),a
+			rla
+			add	a,c
+			ld	(hl),d
+			add	a,e
+			sub	(hl)
+			ld	h,a
+			adc	a,3ah
+			ld	l,c
+			inc	a
+			xor	h
+			in	a,(17h)
+			ret	pe
+			dec	l
+			or	e
+			rst	30h
+			sub	d
+			ld	b,h
+			ld	c,a
+			call	p,Lfb9c
+			add	a,c
+			push	af
+			add	a,h
+			ret	nc
+			sub	c
+			inc	sp
+			jp	(hl)
+			db	3dh,9bh,05h,33h,b4h,06h,1dh,14h
+			db	51h,0ah,67h
+			ld	a,c
+			ld	a,e
+			push	af
+			inc	hl
+			ld	l,e
+			sbc	a,d
+			and	d
+			cp	e
+			and	l
+			ld	h,(hl)
+			and	e
+			ret	m
+			call	m,L095a
+			rla
+			sbc	a,(hl)
+			ld	l,(hl)
+			push	af
+			ld	e,c
+			or	l
+			ret	po
+			add	a,d
+			ret	n *
+			jp	nc,Le7f9
+			cp	l
+			inc	bc
+			and	d
+			dec	h
+			ld	a,c
+			call	L410b
+			sub	d
+			xor	h
+			add	a,h
+			ld	(hl),h
+			ld	a,h
+			xor	a
+			rra
+			call	L5833
+			ld	c,d
+			ld	(bc),a
+			or	e
+			adc	a,a
+			ld	h,c
+			inc	l
+			and	a
+			adc	a,e
+			dec	de
+			ld	d,e
+			ld	l,(hl)
+			ccf
+			ld	c,e
+			or	c2h
+			ld	h,l
+			cp	l
+			ld	(hl),d
+			ld	b,l
+			ld	h,c
+			call	p,Laf8d
+			dec	de
+			ld	l,d
+			ld	l,d
+			ld	d,c
+			adc	a,c
+			scf
+			out	(b7h),a
+			ld	a,d
+			ld	a,e
+			ld	(hl),l
+			rst	00h
+			sub	e
+			ld	l,d
+			add	hl,hl
+			call	z,L3028
+			or	b
+			rrca
+			or	e
+			ld	e,c
+			dec	de
+			sbc	a,d
+			ld	a,(de)
+			ld	l,a
+			sbc	a,h
+			ld	b,b9h
+			jp	m,L6498
+			xor	c
+			djnz	Lb76b
+			add	a,h
+			jr	z,Lb780
+			ex	(sp),hl
+			add	a,d
+			ld	d,(hl)
+			ld	(8ebeh),hl
+			sbc	a,(hl)
+			jp	m,Lbff8
+			add	hl,sp
+			ld	e,e
+			jp	m,L2861
+			or	(hl)
+			ld	e,l
+			ld	c,b
+			bit	1,h
+			ccf
+			ld	(hl),01h
+			dec	hl
+			dec	d
+			ld	b,d
+			ld	(de),a
+			ld	e,b
+			ld	a,a
+			ld	b,c
+			ld	a,b
+			ld	h,d
+			ret	z
+			ld	d,e
+			ret	c
+			inc	h
+			rst	00h
+			add	a,c
+			sub	l
+			adc	a,b
+			push	hl
+			or	(hl)
+			ld	a,a
+			ld	a,c
+			inc	h
+			ret	pe
+			or	c
+			jp	z,L2458
+			ld	a,l
+			ld	a,(hl)
+			ex	de,hl
+			call	po,L3db2
+			and	c
+			ld	(hl),b
+			ld	e,l
+			ex	de,hl
+			ld	l,b
+			ld	d,e
+			ld	b,a
+			ld	d,l
+			dec	e
+			jp	z,La14f
+			cp	e
+			ld	c,d
+			inc	h
+			ld	h,74h
+			ld	l,c
+			ld	hl,(8b5fh)
+			ld	d,l
+			ld	b,e5h
+			ld	l,b
+			ex	(sp),ix
+			ld	c,d
+			dec	b
+			adc	a,a
+			ld	b,h
+			rst	38h
+			ld	b,b
+			or	e
+			cp	b
+			add	a,h
+			adc	a,a
+			ld	a,(de)
+			ld	l,(hl)
+			exx
+			add	a,e
+			ld	(de),a
+			ex	de,hl
+			inc	sp
+			ret
+			db	1bh,3bh
+			ld	c,l
+			ld	e,l
+			scf
+			cp	l
+			dec	a
+			ld	a,4bh
+			ld	l,e
+			ld	h,b
+			add	a,h
+			ld	h,c
+			jp	L0431
+			db	64h,e4h,25h,f8h,4eh,0bh,65h,aeh
+			db	a3h,8ch,f9h,adh,7fh,d4h,f5h,cbh
+			db	1ch,11h,f6h,e4h,e3h,9dh,92h,23h
+			db	14h,0dh,5dh,9ch,62h,fdh,99h,73h
+			db	72h,87h,94h,08h,48h,a0h,1dh,d2h
+			ld	a,(de)
+			call	m,Lfb88
+			dec	h
+			ld	c,e
+			rst	08h
+			and	e
+			sub	b
+			jp	p,L32e5
+			cp	c
+			or	h
+			dec	hl
+			ld	h,h
+			add	a,e
+			ld	a,(de)
+			ld	a,(bc)
+			cp	a
+			xor	5ch
+			call	po,L6623
+			push	de
+			ld	(7f04h),hl
+			jr	c,Lb8c5
+			or	b
+			exx
+			ex	de,hl
+			dec	hl
+			ccf
+			and	c
+			or	l
+			sub	(hl)
+			ld	d,h
+			adc	a,d
+			adc	a,h
+			ld	a,a
+			dec	hl
+			jp	Lfa95
+			db	abh,67h,1ah,d0h,88h,85h,9bh,a3h
+			db	49h,98h,80h,62h,3ah,01h,9bh,e9h
+			db	f8h,87h,5eh,4fh,46h,69h,7eh,dbh
+			db	bfh,feh,1eh,55h,02h,c6h,ceh,f6h
+			db	a2h,19h,54h
+			or	b
+			pop	de
+			ld	c,e8h
+			ld	c,e
+			ld	hl,c0f1h
+			di
+			and	e
+			ld	(de),a
+			ret
+			db	86h,7bh,88h,c4h,0bh,5ah,81h,0ah
+			db	24h,aah,b1h,21h,25h,c0h,94h,cch
+			db	02h,67h,a8h,5ch,61h,c3h,bah,52h
+			db	1eh,59h,51h,ebh,f8h,8dh,b4h,54h
+			db	d2h,a6h,80h,3fh,1eh,e7h,95h,08h
+			db	4fh,85h,66h,e3h,32h,20h,95h,d0h
+			db	3bh,eah,beh,4dh,61h,9bh,dbh,0ah
+			db	eeh,8bh,c6h,38h,23h,0fh,cbh,72h
+			db	d1h,d8h,92h,7dh,e2h,e3h,08h,c8h
+			db	d8h,ceh
+			jp	(hl)
+			db	eeh,56h,61h,92h,8dh,59h,88h,a2h
+			db	dah,eah,e8h,5bh,77h,b5h,52h,98h
+			db	f5h,b9h,bah,f0h,7fh,0dh,26h,59h
+			db	18h,20h,fdh,80h,31h,07h,6ah,5dh
+			db	36h,38h,dah,2dh,aah,2ch,bbh,88h
+			db	98h,b3h,46h,d8h,19h,40h,82h,89h
+			db	33h,60h,ach,eeh,94h,beh,c6h,9dh
+			db	c6h,94h,65h,3dh,62h,abh,57h,4fh
+			db	17h,bah,09h,95h,27h,afh,0ah,e7h
+			db	7ch,64h,75h,12h,efh,cah,8fh,91h
+			db	03h,bdh,8ch,54h,9fh,3ch,b4h,6eh
+			db	edh,71h,a8h,1ah,fch,a5h,21h,2fh
+			db	bah,75h,e2h,f5h,e8h,32h,17h,79h
+			db	98h,f4h,1dh,67h,1bh,b9h,5fh,09h
+			db	bfh,94h,adh,62h,5bh,3ah,cch,3ah
+			db	03h
+			ld	b,e
+			ld	e,c
+			ret	p
+			add	a,h
+			ld	b,31h
+			cp	51h
+			jp	m,Lfe29
+			scf
+			ld	b,l
+			call	c,L9d54
+			xor	a
+			and	h
+			dec	bc
+			and	l
+			dec	d
+			halt
+			ld	h,c
+			jr	nz,Lb995
+			ld	b,h
+			ld	l,2fh
+			ld	d,c
+			ld	a,(0229h)
+			pop	bc
+			call	nc,L63f9
+			or	(hl)
+			ld	a,(hl)
+			exx
+			call	p,L497b
+			ld	d,l
+			ld	hl,(9c4fh)
+			inc	b
+			daa
+			dec	e
+			xor	c
+			ret	nz
+			ld	(hl),h
+			ld	hl,(05fah)
+			add	a,c
+			ld	(hl),7ch
+			or	(hl)
+			or	l
+			ld	bc,d4cah
+			ld	a,(de)
+			call	po,L7ea8
+			ld	a,h
+			add	a,(hl)
+			ret	nc
+			ld	b,b
+			sbc	a,94h
+			cp	h
+			inc	a
+			ld	e,e
+			ld	h,c
+			ld	b,(hl)
+			ld	(42fch),hl
+			or	(hl)
+			ld	d,h
+			adc	a,c
+			adc	a,d
+			and	e
+			ld	(hl),a8h
+			ld	d,l
+			sub	(hl)
+			adc	a,l
+			jp	p,Ldf90
+			ld	h,d
+			ld	(hl),c
+			ld	d,a
+			rst	28h
+			sbc	a,l
+			inc	(hl)
+			ld	d,a
+			ld	e,b
+			ld	l,l
+			adc	a,65h
+			ld	e,a
+			ld	c,d
+			in	a,(c7h)
+			inc	bc
+			ld	h,d
+			add	a,c
+			and	(hl)
+			ret	z
+			add	hl,sp
+			sbc	a,l
+			res	4,l
+			ld	hl,88beh
+			ld	c,94h
+			ex	de,hl
+			ld	b,a
+			ld	a,d
+			inc	b
+			call	m,L846c
+			cp	d
+			ld	h,c
+			ld	(hl),h
+			jr	Lb9ed
+			db	47h,55h,54h,6fh,00h,b5h,f1h,0fh
+			adc	a,(hl)
+			ld	c,a
+			ld	(hl),a
+			rrca
+			sub	(hl)
+			jr	Lb9b0
+			db	ddh,79h,b2h,cdh,11h,f9h,62h,94h
+			db	4bh
+			ld	b,(hl)
+			ld	b,bah
+			or	b
+			add	a,d
+			ld	e,d
+			ld	d,a
+			xor	e
+			rst	10h
+			ld	a,e
+			ld	e,h
+			and	a
+			ld	b,a
+			cp	l
+			xor	d
+			add	a,e
+			inc	a
+			ld	d,c
+			ld	e,e
+			ld	h,b
+			ld	b,h
+			ld	b,13h
+			pop	hl
+			ld	e,h
+			dec	(hl)
+			add	hl,bc
+			ld	(hl),b
+			ld	l,b
+			rst	20h
+			call	z,L75e8
+			jp	nc,L5d5d
+			ld	h,b
+			inc	bc
+			ld	a,b
+			rst	30h
+			call	Lced2
+			and	c
+			sub	d
+			jp	nz,Lfdf1
+			sub	b
+			ld	b,(hl)
+			rst	38h
+			rra
+			rst	28h
+			ld	(de),a
+			and	a
+			inc	d
+			sub	h
+			jr	nz,Lba34
+			jp	c,Lb8d0
+			dec	a
+			di
+			rst	10h
+			or	b
+			cp	d
+			add	a,b
+			jp	L3b43
+			db	ech,adh,a9h,4bh,14h,30h,51h,6ah
+			db	eeh,56h,78h,22h,cbh,4bh,d4h,8ch
+			db	89h,cfh,5fh,ach,2ch,cah,22h,05h
+			db	70h,2fh,0bh,31h,58h,71h,3ah,70h
+			db	5eh,7eh,d1h,11h,ffh,1ch,08h,b4h
+			db	cfh,3bh,39h,d2h,d0h,3eh,01h,d1h
+			db	fdh,00h,26h,74h,efh,5ah,59h,60h
+			db	4ch,48h,8bh,71h,13h,2eh,aeh,15h
+			db	a1h,3ch,9eh,a1h,15h,47h,28h,75h
+			db	b2h,2eh,c9h,59h,77h,75h,28h,9eh
+			db	53h,90h,dah,01h,fbh,14h,a5h,68h
+			db	cah,ach,50h,e8h,6fh,cfh,d6h,74h
+			db	28h,aah,dfh,63h,78h,92h,39h,3bh
+			db	85h,61h,21h,4fh,fah,e8h,5dh,d4h
+			db	62h,56h,f5h,43h,edh,eah,abh,4dh
+			daa
+			call	L0cd5
+			sub	82h
+			ret	z
+			add	a,l
+			ld	e,a
+			and	d
+			rst	38h
+			ld	h,h
+			ret	pe
+			ld	c,a
+			and	h
+			ld	h,(hl)
+			pop	bc
+			adc	a,h
+			ld	c,a
+			or	h
+			call	po,Ld630
+			ld	a,(80beh)
+			ld	h,c
+			ld	l,d
+			nop (2x) *
+			ld	e,a
+			ld	b,c
+			ld	(hl),h
+			sbc	a,e
+			jr	Lbb0a
+			db	25h,5dh,afh,52h,0ch,d9h,8eh,99h
+			db	a7h,ach,f0h,7bh,48h,e9h,84h,aah
+			db	e8h,75h,13h,59h,72h
+			add	a,l
+			add	hl,de
+			ld	h,h
+			sub	c
+			add	hl,hl
+			ld	b,h
+			call	nz,Lfb05
+			ret	po
+			add	a,h
+			scf
+			ld	e,d
+			ld	a,(hl)
+			ld	d,b
+			ld	(de),a
+			ld	e,(hl)
+			ld	d,(hl)
+			halt
+			ld	a,(977bh)
+			sub	b
+			ld	e,33h
+			sbc	a,9ah
+			inc	a
+			ld	e,(hl)
+			inc	bc
+			ld	d,c
+			push	hl
+			ret	nc
+			pop	hl
+			and	c
+			ld	d,d
+			ld	b,c
+			ld	d,a
+			ld	(hl),c
+			or	e
+			ld	h,(hl)
+			ld	h,h
+			ex	(sp),hl
+			cp	d
+			rla
+			ld	l,(hl)
+			xor	d
+			inc	l
+			nop (2x) *
+			add	a,a
+			sbc	a,h
+			call	m,L9372
+			ld	hl,df4eh
+			and	(hl)
+			call	nc,L5747
+			ld	c,(hl)
+			ld	h,d
+			dec	e
+			ld	sp,hl
+			ld	c,(hl)
+			ld	(hl),e
+			sub	(hl)
+			ld	(hl),h
+			add	a,h
+			rst	30h
+			ret	nc
+			ld	a,d
+			ld	d,l
+			jp	po,L3278
+			push	bc
+			add	hl,de
+			ld	sp,ce50h
+			ld	d,c2h
+			adc	a,c8h
+			ret	c
+			ld	a,d
+			ld	a,(abf3h)
+			ld	(bc),a
+			dec	h
+			add	a,b
+			cp	c
+			inc	h
+			ld	h,d
+			add	hl,sp
+			pop	de
+			pop	bc
+			ld	b,e
+			ld	(hl),l
+			or	b6h
+			ld	b,h
+			dec	b
+			add	hl,bc
+			ld	h,e
+			ld	hl,(16b1h)
+			xor	h
+			adc	a,e
+			ld	e,b
+			ld	b,h
+			cp	h
+			rlca
+			sbc	a,d
+			adc	a,e6h
+			res	6,h
+			inc	sp
+			jp	pe,L8510
+			call	z,L4b72
+			ld	e,b
+			ld	l,b
+			ld	b,(hl)
+			ld	l,c
+			sbc	a,e
+			sbc	a,d
+			ld	(hl),35h
+			ld	h,d
+			cp	b4h
+			sub	(hl)
+			adc	a,d
+			call	nz,L6a11
+			add	hl,sp
+			ld	a,c
+			adc	a,d
+			jp	po,L4a0b
+			adc	a,65h
+			call	z,L4d0c
+			dec	c
+			adc	a,(hl)
+			sub	h
+			ld	h,c
+			cp	e
+			ld	c,(hl)
+			ld	(hl),e
+			ret	nc
+			add	a,a
+			cp	h
+			jp	po,L2b03
+			sub	(hl)
+			ld	e,d
+			scf
+			ld	b,b
+			ld	c,h
+			call	c,L3171
+			ld	(hl),a
+			jr	c,Lbc07
+			nop (2x) *
+			ld	l,a
+			and	(hl)
+			inc	e
+			and	l
+			rst	08h
+			jp	pe,L932f
+			rst	20h
+			ld	e,3ch
+			inc	e
+			and	h
+			cp	h
+			ld	c,e
+			ld	l,a
+			ld	l,d
+			rst	30h
+			halt
+			rst	08h
+			rst	10h
+			ld	b,l
+			ld	a,(hl)
+			call	nc,L3029
+			ld	d,h
+			ld	c,(hl)
+			xor	c
+			ret	nc
+			adc	a,a
+			rla
+			jp	po,Lcb95
+			inc	hl
+			ld	h,a
+			ld	e,c
+			or	d
+			ld	e,b
+			add	a,c
+			ex	de,hl
+			ld	c,b
+			jr	nz,Lbc0d
+			ld	h,a
+			cp	b
+			ld	h,a
+			xor	(hl)
+			call	z,L8e12
+			ret	po
+			ld	h,b
+			jr	nz,Lbc45
+			ld	a,l
+			ld	h,h
+			jp	pe,L80dc
+			add	hl,hl
+			sbc	a,e
+			jp	Le68f
+			ld	a,l
+			ld	d,c
+			djnz	Lbbd0
+			cpl
+			ld	d,b
+			ld	c,d
+			sbc	a,e
+			inc	e
+			adc	a,c
+			ld	(de),a
+			nop (2x) *
+			sbc	a,c
+			adc	a,e
+			ld	h,e
+			scf
+			xor	h
+			rst	00h
+			ld	(hl),a0h
+			dec	(hl)
+			ld	a,c
+			ld	c,efh
+			scf
+			dec	hl
+			add	hl,bc
+			ld	b,(hl)
+			ld	c,d
+			in	a,(38h)
+			ld	h,h
+			jp	nz,L145e
+			dec	d
+			inc	sp
+			in	a,(cfh)
+			add	a,a
+			jp	nc,Leb36
+			nop (2x) *
+			ld	d,d
+			ld	e,a
+			push	bc
+			sub	d
+			and	l
+			daa
+			ld	c,l
+			ld	a,b
+			and	b
+			ld	d,(hl)
+			ld	(hl),l
+			add	a,a
+			ld	b,d
+			ld	d,e
+			jp	(hl)
+			db	1dh,eah,a2h,60h,03h,27h,4ch,c6h
+			db	b6h,03h,94h,bfh,3bh,78h,f8h,4eh
+			db	78h,c9h,33h,aeh,8eh,0ch,72h,afh
+			db	3bh,c5h,b0h,afh,7fh,d7h,30h,07h
+			db	7eh,49h,a3h,0ch,4ch,1ch,6bh,ddh
+			db	a3h,19h,08h,79h,21h,58h,04h,66h
+			db	68h,3ch,7ah,1bh,63h,e9h,ceh,9bh
+			db	d3h,54h,1dh,01h,a6h,2ah,75h,d1h
+			db	7dh,aeh,70h,44h,cfh,2eh,6ch,bch
+			db	40h,48h,c1h,27h,d5h,13h,c2h,b0h
+			db	8fh,79h,d2h,f7h,f0h,9dh,01h,47h
+			db	b9h,c6h,a9h,cch,a9h,7ch,90h,6eh
+			db	1ah,e6h,70h,80h,01h,beh,54h,1fh
+			db	d4h,8bh,2bh,4ah,5bh,87h,cdh,38h
+			db	a2h,18h,80h,edh,dbh,43h,c8h,1fh
+			db	7bh,7eh,58h,43h,2fh,70h,58h,a9h
+			db	78h,38h,0dh,b2h,d5h,22h,26h,61h
+			db	06h,16h,7ah,4eh,1dh,69h,ffh,d6h
+			db	a6h,7eh,07h,88h,3ch,19h,54h,5fh
+			db	19h,b4h,f5h,69h,aeh,6bh,24h,86h
+			db	29h,cbh,f1h,dbh,aeh,95h,24h,afh
+			db	40h,88h,82h,dah,08h,8dh,92h,35h
+			db	7ah,6bh,c4h,42h,9eh,f9h,86h,79h
+			db	e4h,a0h,31h,51h,edh,fbh,e6h,60h
+			db	27h,f2h,83h,02h,17h,7ah,6bh,cbh
+			db	ddh
+			xor	(hl)
+			rst	08h
+			adc	a,5fh
+			call	z,L31ec
+			or	b
+			sbc	a,e
+			dec	de
+			ld	b,(hl)
+			xor	e
+			cp	c
+			ld	h,34h
+			call	pe,L4252
+			jr	Lbda2
+			db	04h,aah,99h,89h,e2h,35h,55h,bah
+			db	12h,f5h,85h,b1h
+			ld	e,l
+			cp	d
+			ld	(hl),b
+			dec	d
+			ld	b,h
+			ld	(hl),d
+			sbc	a,c
+			dec	l
+			ld	de,817fh
+			ld	e,e
+			jp	po,L051a
+			ret	pe
+			or	l
+			ld	a,a4h
+			sub	cdh
+			ld	(dcafh),a
+			ex	de,hl
+			sbc	a,l
+			out	(6dh),a
+			add	a,b
+			ret	p
+			or	c
+			ld	(bc),a
+			ld	hl,5c2ah
+			inc	bc
+			jr	z,Lbd63
+			dec	d
+			ld	(hl),e
+			ld	a,b
+			xor	h
+			dec	a
+			or	(hl)
+			ret	po
+			xor	(hl)
+			ld	d,(hl)
+			ld	(de),a
+			ld	l,l
+			ld	(hl),b
+			ld	(hl),e
+			halt
+			cp	a
+			nop (2x) *
+			add	a,b
+			add	hl,sp
+			scf
+			ld	(hl),e
+			djnz	Lbd28
+			ld	b,l
+			inc	(hl)
+			call	p,Lc8f1
+			jp	m,L64f8
+			out	(69h),a
+			sbc	a,h
+			ld	h,d
+			and	3ah
+			jr	c,Lbdf8
+			ld	e,afh
+			ld	a,(de)
+			jp	c,Lf751
+			ld	l,l
+			add	a,d
+			inc	l
+			ccf
+			ld	l,cdh
+			ld	(hl),39h
+			ld	h,a
+			push	hl
+			ld	bc,883ah
+			cp	b
+			ex	de,hl
+			ld	c,a
+			ld	a,d
+			xor	4ah
+			ld	e,a9h
+			jp	nz,L6c40
+			ld	(hl),e
+			dec	b
+			cp	l
+			push	af
+			ld	h,a
+			ld	c,a
+			inc	bc
+			dec	de
+			inc	h
+			ld	c,(hl)
+			jr	Lbd4b
+			db	91h,25h,85h,e9h
+			ld	(hl),d
+			ld	(hl),d
+			ld	h,ach
+			ld	h,(hl)
+			jp	(hl)
+			db	44h,ach,fah,54h,33h,99h,adh,d2h
+			db	01h,54h,91h,34h,fbh,76h,1eh,74h
+			db	95h,c1h,9eh,80h,e7h,6ah,adh,39h
+			db	48h,94h,16h,4bh,34h,63h,66h,f3h
+			db	73h,bch,91h,ceh,3ah,0ch,55h,6dh
+			db	30h,4eh,ebh,aeh,abh,cbh,b7h
+			or	8ah
+			ld	e,b
+			ld	e,l
+			rst	18h
+			ret	nz
+			sub	(hl)
+			ld	l,h
+			adc	a,33h
+			adc	a,l
+			scf
+			ld	d,l
+			ld	l,l
+			ld	(93a3h),a
+			add	hl,de
+			ret	z
+			rst	10h
+			ret	z
+			ld	c,a
+			sbc	a,c
+			ret	po
+			ld	(hl),a
+			ld	e,h
+			ret	pe
+			sub	e
+			ld	(hl),c
+			ld	h,e
+			sbc	a,e
+			add	hl,sp
+			ld	e,d
+			out	(63h),a
+			call	nc,L2298
+			add	hl,hl
+			ret	p
+			or	(hl)
+			cp	h
+			ld	d,l
+			xor	(hl)
+			inc	sp
+			ld	a,96h
+			ld	d,l
+			jp	L60e3
+			db	3ah,51h,24h,a4h,35h,5ah,7ch,9dh
+			db	63h,fbh,4ah,36h,fbh,adh,6dh,98h
+			db	dch,d7h,ffh,d0h,f8h,4fh,4ch,93h
+			db	6bh,82h,1ch,bbh,27h,93h,0ah,23h
+			db	08h,b2h,a2h,21h,34h,cbh,06h
+			call	nz,Le493
+			jr	Lbe91
+			db	4eh
+			jp	c,L755b
+			ld	(483fh),hl
+			ld	d,f1h
+			call	L4eb8
+			adc	a,e
+			ld	a,e
+			add	a,c
+			dec	a
+			ld	a,c
+			and	l
+			push	de
+			jr	c,Lbead
+			call	z,L31fa
+			or	06h
+			sub	e
+			rst	10h
+			push	bc
+			ld	b,b
+			di
+			add	hl,de
+			jp	z,Lc9a0
+			inc	a
+			xor	h
+			ld	l,(hl)
+			ld	a,(bc)
+			sbc	a,d
+			dec	e
+			call	nc,Lc089
+			pop	af
+			and	(hl)
+			ccf
+			cp	a
+			ld	a,a2h
+			inc	bc
+			xor	e
+			call	p,Laf80
+			halt
+			or	(hl)
+			ld	(hl),e
+			call	p,L5436
+			ld	hl,(634fh)
+			cp	h
+			dec	c
+			ei
+			ret	nc
+			adc	a,a
+			inc	b
+			ld	d,b
+			out	(85h),a
+			xor	d
+			add	hl,hl
+			sbc	a,e
+			rst	38h
+			dec	l
+			call	pe,Lff7c
+			call	L8f82
+			sbc	a,d
+			ld	(hl),e
+			ld	c,a
+			jp	nz,L7f81
+			ld	b,h
+			rst	10h
+			ld	h,h
+			ld	a,l
+			ld	bc,345eh
+			ld	l,e
+			ld	de,6013h
+			ld	e,4fh
+			adc	a,d
+			djnz	Lbe58
+			ld	d,e
+			ld	(hl),l
+			ld	b,h
+			add	a,l
+			call	c,L9968
+			call	po,Ld7c3
+			sbc	a,5dh
+			add	a,e
+			djnz	Lbe97
+			dec	b
+			ld	a,a
+			xor	85h
+			jp	nz,Lf487
+			and	h
+			ld	h,h
+			ld	(hl),b
+			di
+			sub	d
+			or	l
+			ex	de,hl
+			or	d
+			ret	p
+			ld	(bc),a
+			ret	pe
+			nop (2x) *
+			inc	c
+			ld	c,b
+			ret	nz
+			ld	(hl),b
+			push	hl
+			ld	l,h
+			di
+			dec	c
+			inc	d
+			and	h
+			call	pe,L5190
+			and	h
+			inc	de
+			ld	l,b
+			ld	sp,hl
+			call	po,La82b
+			rra
+			ld	(hl),69h
+			ld	h,h
+			and	e
+			rra
+			sbc	a,l
+			ex	de,hl
+			halt
+			ld	d,c
+			ld	e,b
+			ld	d,c
+			call	z,Lea9d
+			cp	c
+			ex	de,hl
+			ld	e,h
+			ld	h,(hl)
+			add	hl,de
+			rrca
+			ex	af,af'
+			and	l
+			jr	nz,Lbf21
+			sbc	a,c
+			ld	e,(hl)
+			ex	(sp),hl
+			ld	a,d
+			inc	l
+			ld	(bc32h),a
+			ld	d,e
+			ret
+			db	3fh,efh,f5h,8bh,48h,96h
+			scf
+			adc	a,b
+			and	h
+			dec	h
+			ld	(hl),c
+			and	d
+			ccf
+			rst	18h
+			ld	h,2eh
+			or	l
+			ld	bc,888ch
+			adc	a,c
+			ld	a,(3bbbh)
+			and	l
+			jp	nz,L45e8
+			and	l
+			inc	l
+			and	(hl)
+			add	hl,de
+			jp	pe,Ld226
+			nop
+			or	e
+			xor	b
+			exx
+			add	a,c
+			xor	b5h
+			call	z,L8afb
+			adc	a,c
+			ld	sp,cec3h
+			ld	(hl),d
+			rrca
+			call	p,L3d54
+			dec	e
+			ld	d,c2h
+			dec	(hl)
+			exx
+			ld	b,l
+			ld	d,c
+			and	e
+			ld	b,d
+			call	c,L0da5
+			ret	m
+			cp	d
+			sub	eeh
+			jp	nc,L4bea
+			ld	d,l
+			xor	e
+			add	a,abh
+			ld	c,(hl)
+			ld	d,(hl)
+			jp	po,L2f6c
+			and	h
+			ld	e,(hl)
+			sbc	a,b
+			ld	h,c
+			ret	pe
+			add	hl,bc
+			jp	c,L8bf3
+			ld	d,h
+			ld	e,c
+			add	a,h
+			ld	a,(de)
+			xor	b
+			sub	h
+			jp	z,L14dc
+			daa
+			ld	bc,4d85h
+			sbc	a,a
+			ld	hl,22b5h
+			ld	(hl),h
+			ld	c,d
+			jr	Lbf87
+			db	a9h,4ah,c9h,a7h
+			cp	a
+			add	a,a
+			adc	a,(hl)
+			ld	d,a
+			inc	a
+			ld	(hl),c
+			ld	h,d
+			adc	a,e
+			sbc	a,c
+			ld	b,87h
+			pop	de
+			ld	d,(hl)
+			ld	d,e
+			jp	pe,Lefcd
+			ld	d,dbh
+			ld	b,l
+			ld	(hl),b
+			ld	(hl),e
+			xor	c
+			push	bc
+			ex	(sp),hl
+			ld	(hl),b7h
+			ld	b,(hl)
+			adc	a,c
+			and	(hl)
+			push	bc
+			call	m,L65dc
+			sub	l
+			sbc	a,e
+			ld	(hl),b
+			ld	a,h
+			rrca
+			ex	de,hl
+			ret	p
+			ld	d,a
+			ld	h,c
+			ex	de,hl
+			ld	d,(hl)
+			add	a,b
+			add	a,a
+			jp	c,Leb14
+			ccf
+			add	hl,de
+			jp	nz,L2cb8
+			call	Lcb58
+			ld	l,l
+			ret	c
+			rra
+			ld	d,c
+			sbc	a,b
+			ld	b,a
+			ld	h,(hl)
+			sub	(hl)
+			jr	Lbf5e
+			db	adh,90h,a9h,3bh,6fh,85h,17h,64h
+			db	83h,bdh,23h,8dh,05h,7dh,b4h,8eh
+			db	8ah,70h,14h,8eh,c0h,7bh,91h,deh
+			db	93h,e8h,d5h,afh,afh,a4h,abh,70h
+			db	20h,f4h,0ch,3fh,ech
+			cp	(hl)
+			pop	hl
+			sub	(hl)
+			ret	m
+			ld	l,b
+			sub	c
+			cp	h
+			pop	hl
@@ -0,0 +1,2064 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	c0h,f9h,86h,b3h,9ah,04h,f5h,99h
+			db	40h,e2h,dah,feh
+
+start:						; execution starting point
+			rlca
+			ld	(bc),a
+			ld	sp,hl
+			in	a,(2dh)
+			inc	sp
+			ret	c
+			adc	a,(hl)
+			jp	Lac02
+			db	ach,7dh,f6h,35h,5eh,c9h,e0h,5bh
+			db	9ah,5bh,edh,f5h,7bh,78h,f0h,79h
+			db	b7h,0ch,77h,47h,88h,03h,1ah,9dh
+			db	f1h,a1h,b4h,08h,8fh,4bh,bch,f7h
+			db	1fh,97h,abh,06h,e2h,62h,73h,aeh
+			db	11h,77h,d0h,2bh,8ch,7bh,f8h,98h
+			db	9ch,15h,f8h,9eh,1ah,57h,29h,33h
+			db	bfh,31h,d3h,24h,8bh,43h,8ch,4ah
+			db	36h,e4h,2ah,d4h,feh,09h,97h,0ah
+			db	1ch,58h,2fh,73h,58h,04h,61h,00h
+			db	cfh,0ah,c9h,e3h,05h,65h,7bh,01h
+			db	7bh,d0h,a0h,2ch,deh,b0h,b6h,f4h
+			db	f0h,22h,86h,06h,c9h,0bh,03h,8ah
+			db	0eh,60h,e1h,30h,b8h,80h,2eh,4bh
+			db	9eh,1bh,8fh,32h,b4h,dfh,83h,cch
+			db	43h,6eh,6dh,c2h,f6h,43h,03h,e9h
+			db	23h,1fh,d2h,18h,4bh,94h,7dh,fah
+			db	ach,24h,8bh,f9h,56h,dch,6ch,40h
+			db	1dh,97h,43h,7eh,1eh,b6h,f6h,36h
+			db	9fh,b7h,1eh,ebh,afh,b8h,33h,a9h
+			db	2eh,8fh,f5h,83h,b4h,e1h,b1h,9eh
+			db	fch,11h,23h,a1h,57h,5fh,ddh,69h
+			db	2ah,e5h,50h,89h,5eh,4bh,f2h,4ch
+			db	dch,e6h,56h,fbh,1ch,b6h,55h,ach
+			db	00h,79h,62h,cfh,8bh,d4h,a9h,c0h
+			db	70h,3dh,d0h,6dh,93h,adh,d3h,12h
+			db	75h,50h,85h,e5h,fch,79h,5bh,09h
+			db	f0h,22h,7ch,e6h,72h,76h,07h,87h
+			db	34h,9bh,59h,42h,9fh,6fh,b3h,8ah
+			db	47h,63h,9bh,99h,b5h,37h,ebh,e9h
+			db	96h,d6h,aeh,7ah,7ah,e6h,a3h,ech
+			db	0eh,fbh,f4h,55h,13h,a5h,f1h,f5h
+			db	8bh,6dh,80h,31h,c6h,bbh,cah,c5h
+			db	85h,c0h,c0h,e6h,aeh,6fh,9dh,80h
+			db	d0h,59h,cfh,83h,75h,0fh,b4h,69h
+			db	b5h,afh,4bh,e9h,a9h,74h,2fh,4eh
+			db	35h,59h,53h,07h,71h,a2h,4bh,45h
+			db	43h,83h,65h,5bh,4bh,d0h,dah,01h
+			db	90h,d9h,e3h,a4h,21h,2eh,2fh,19h
+			db	96h,2fh,e7h,62h,f4h,ddh,31h,c4h
+			db	3dh,86h,e4h,ceh,02h,fah,d8h,4dh
+			db	f4h,fch,22h,e9h,6dh,b4h,53h,b4h
+			db	b1h,71h,d6h,3ch,4ah,32h,1eh,75h
+			db	76h,efh,17h,d0h,3dh,c6h,18h,8eh
+			db	2dh,e9h,67h,21h,26h,78h,15h,5eh
+			db	f8h,8bh,46h,e9h,1fh,c6h,59h,dch
+			db	afh,00h,25h,23h,9ch,b9h,fbh,90h
+			db	20h,6bh,7bh,9ah,87h,8bh,79h,4eh
+			db	aeh,44h,0bh,1ah,a1h,78h,c5h,37h
+			db	fah,8ch,94h,1ch,81h,e3h,9ah,4ah
+			db	73h,50h,0ah,b1h,98h,59h,6dh,28h
+			db	c6h,edh,f8h,96h,1eh,97h,5fh,feh
+			db	42h,43h,1ah,8bh,55h,52h,5ah,90h
+			db	7eh,74h,4dh,82h,b5h,ddh,fah,4ah
+			db	93h,feh,29h,3fh,3dh,57h,d4h,e5h
+			db	08h,4ch,53h,c7h,74h,e2h,efh,6ah
+			db	89h,47h,b2h,4eh,eeh,ebh,3bh,7ch
+			db	80h,86h,d4h,b7h,d1h,d8h,89h,47h
+			db	dfh,77h,b2h,05h,70h,42h,09h,18h
+			db	45h,2fh,d0h,e9h,19h,57h,2ch,83h
+			db	a8h,0dh,d7h,83h,88h,afh,14h,24h
+			db	33h,33h,e7h,e8h,8eh,6ch,41h,96h
+			db	c8h,44h,35h,79h,36h,11h,54h,d3h
+			db	dfh,8dh,f5h,03h,fbh,c1h,c4h,b0h
+			db	ebh,78h,32h,bfh,c7h,b6h,89h,9bh
+			db	f6h,a9h,5eh,7dh,8ch,3eh,abh,23h
+			db	95h,eah,98h,1dh,c2h,cfh,4dh,b2h
+			db	5bh,61h,3fh,aah,03h,35h,36h,3fh
+			db	a0h,92h,9eh,42h,37h,72h,0eh,e8h
+			db	7eh,c5h,08h,55h,d8h,0ch,d6h,feh
+			db	1ah,cbh,38h,73h,92h,f8h,cfh,fbh
+			db	fah,47h,45h,2bh,32h,49h,beh,c4h
+			db	25h,3dh,dch,dch,dfh,dbh,75h,3dh
+			db	adh,6ah,f8h,f6h,d2h,50h,2ah,a0h
+			db	e3h,ceh,61h,d9h,fdh,77h,adh,67h
+			db	28h,f2h,05h,edh,6bh,05h,5eh,d3h
+			db	04h,85h,08h,9dh,4eh,48h,c4h,95h
+			db	d0h,61h,8bh,42h,cdh,48h,52h,e3h
+			db	78h,10h,67h,abh,31h,f9h,12h,91h
+			db	f3h,ddh,3eh,e1h,34h,70h,ceh,bch
+			db	2bh,f6h,21h,bfh,92h,57h,adh,a1h
+			db	30h,cbh,b8h,43h,34h,49h,68h,fdh
+			db	fch,a1h,f2h,a0h,cah,67h,fah,58h
+			db	04h,64h,30h,e1h,c2h,27h,64h,c2h
+			db	6ch,16h,ech,5ah,39h,20h,38h,6fh
+			db	67h,fch,30h,9dh,cbh,59h,1bh,b0h
+			db	b1h,edh,f4h,e9h,94h,18h,21h,3ch
+			db	54h,d2h,90h,b7h,21h,44h,62h,4ah
+			db	d7h,5ah,00h,0dh,6bh,cdh,70h,7bh
+			db	9ch,d2h,a5h,eeh,97h,4eh,aeh,a0h
+			db	24h,17h,bah,b1h,79h,03h,28h,48h
+			db	1fh,bch,46h,cah,81h,47h,fch,49h
+			db	47h,b8h,13h,91h,d5h,fdh,99h,17h
+			db	ach,f5h,e4h,4eh,9ah,05h,dah,beh
+			db	f6h,a3h,63h,4ah,00h,a9h,fch,9ah
+			db	64h,e1h,4eh,2ah,93h,20h,e2h,b9h
+			db	8ah,c6h,7ch,1ah,eah,b8h,44h,34h
+			db	cah,3eh,9eh,7eh,b5h,31h,3dh,a6h
+			db	33h,aah,48h,a5h,edh,c2h,98h,74h
+			db	b7h,f9h,d8h,bah,49h,07h,5eh,d4h
+			db	84h,fch,6dh,17h,14h,afh,08h,0fh
+			db	00h,48h,a1h,30h,bdh,63h,25h,17h
+			db	a8h,adh,d1h,48h,efh,e0h,b1h,f2h
+			db	24h,edh,70h,fbh,22h,2fh,f8h,72h
+			db	f3h,e7h,b8h,0ch,3eh,c4h,25h,ddh
+			db	20h,e0h,54h,ach,46h,97h,e6h,95h
+			db	02h,eah,ebh,19h,5bh,a5h,afh,b3h
+			db	0ch,fdh,2fh,aah,feh,93h,b4h,d3h
+			db	6fh,fbh,ebh,3eh,b5h,3eh,a0h,b0h
+			db	85h,03h,91h,dah,47h,9ch,49h,a9h
+			db	59h,fbh,61h,8bh,dah,2dh,b5h,67h
+			db	ach,83h,a9h,d8h,3ch,d0h,c2h,eeh
+			db	c7h,7dh,04h,00h,67h,4fh,17h,43h
+			db	eeh,0eh,4eh,49h,71h,e9h,32h,06h
+			db	2dh,b5h,77h,94h,40h,86h,3eh,8ah
+			db	47h,ebh,3fh,a3h,63h,bah,93h,99h
+			db	feh,95h,d6h,15h,0fh,b4h,a8h,52h
+			db	f8h,d5h,a4h,2fh,24h,1fh,2eh,beh
+			db	2dh,3eh,1bh,feh,24h,f1h,2eh,0ch
+			db	3fh,ffh,8fh,b9h,e6h,96h,9eh,11h
+			db	cah,7ch,0ch,c8h,57h,68h,e8h,ceh
+			db	12h,3bh,adh,c8h,84h,1eh,3ah,a3h
+			db	d1h,dah,0eh,6bh,0ch,5dh,a6h,f2h
+			db	e0h,8ah,dah,ddh,01h,29h,33h,73h
+			db	76h,d6h,90h,c0h,64h,3fh,dch,e0h
+			db	80h,2bh,b5h,eeh,e5h,bdh,ach,5ch
+			db	2fh,47h,dfh,16h,a8h,d1h,73h,21h
+			db	15h,d0h,a9h,0ch,8ch,c0h,d1h,d2h
+			db	1eh,69h,35h,63h,ech,1eh,42h,b4h
+			db	0ah,afh,e4h,f5h,13h,15h,64h,b3h
+			db	13h,56h,62h,a8h,a4h,afh,e5h,49h
+			db	a7h,02h,a0h,16h,3fh,26h,abh,f4h
+			db	cbh,b3h,c2h,63h,91h,66h,67h,10h
+			db	69h,b7h,95h,7ch,c1h,3dh,d9h,fbh
+			db	d4h,88h,00h,30h,bbh,73h,47h,9fh
+			db	13h,bbh,c6h,c8h,c2h,d6h,2ch,9eh
+			db	e5h,c7h,61h,abh,64h,fbh,75h,b9h
+			db	95h,81h,3ch,8ch,aeh,e0h,77h,9fh
+			db	1ch,5fh,8dh,15h,6bh,d4h,c2h,40h
+			db	6dh,21h,67h,b7h,e0h,fdh,1bh,3ah
+			db	d1h,e7h,c0h,41h,33h,bbh,75h,d3h
+			db	a4h,66h,04h,66h,21h,91h,7fh,4ah
+			db	3fh,00h,5fh,7eh,72h,58h,75h,ach
+			db	58h,45h,63h,71h,b9h,25h,a7h,afh
+			db	adh,cdh,9ah,04h,72h,c7h,01h,d4h
+			db	dfh,d3h,88h,94h,7bh,91h,75h,53h
+			db	ffh,7eh,5dh,07h,aah,7eh,f9h,7eh
+			db	c8h,9bh,c5h,e7h,a5h,f3h,70h,6ch
+			db	15h,d8h,2dh,56h,8ah,cah,56h,f2h
+			db	f4h,39h,54h,f7h,8ah,68h,4bh,b4h
+			db	3fh,93h,a1h,76h,9eh,d3h,77h,11h
+			db	24h,e7h,bch,aeh,cfh,3fh,31h,fch
+			db	cch,08h,fbh,77h,ach,71h,43h,c7h
+			db	7dh,d1h,e8h,58h,4eh,3ch,f1h,0eh
+			db	62h,e8h,e5h,c6h,5bh,82h,fch,65h
+			db	66h,7ah,cfh,f6h,37h,b8h,97h,7dh
+			db	7ch,89h,43h,8ch,7ch,2fh,b3h,90h
+			db	6bh,c3h,cdh,88h,40h,59h,0ah,d5h
+			db	a9h,96h,b9h,4ah,10h,09h,9fh,9eh
+			db	a2h,10h,2ch,07h,53h,e1h,5dh,0fh
+			db	c4h,c7h,53h,48h,b4h,bfh,20h,98h
+			db	36h,98h,90h,38h,7dh,0dh,1eh,5bh
+			db	ddh,a8h,c0h,e1h,41h,79h,f8h,01h
+			db	0fh,15h,a4h,f0h,d9h,4eh,d4h,fbh
+			db	60h,ffh,d9h,1ch,cbh,4ah,c0h,e3h
+			db	17h,0bh,a9h,d7h,7ch,aah,ebh,5eh
+			db	85h,bdh,4fh,34h,f3h,62h,d9h,4dh
+			db	c3h,cah,3fh,cch,07h,d6h,38h,54h
+			db	18h,12h,0dh,dbh,78h,38h,c2h,7dh
+			db	1eh,0ah,76h,49h,82h,c0h,76h,c0h
+			db	f0h,7dh,7fh,35h,3ah,13h,5fh,dfh
+			db	afh,aah,d9h,e8h,74h,14h,d6h,a5h
+			db	9dh,71h,65h,37h,5eh,96h,58h,5ah
+			db	9fh,a4h,fbh,bdh,cch,53h,abh,46h
+			db	75h,b5h,11h,15h,16h,1fh,76h,a6h
+			db	d2h,fbh,56h,feh,36h,f0h,7eh,3eh
+			db	a6h,9bh,5ah,71h,b6h,b7h,d5h,e6h
+			db	19h,46h,9ah,edh,8dh,dch,73h,39h
+			db	98h,b1h,eah,83h,4dh,95h,e4h,56h
+			db	cdh,8bh,73h,67h,4dh,11h,3fh,f7h
+			db	dch,ebh,0ah,67h,aeh,3ah,00h,c3h
+			db	2fh,bah,8fh,5ch,b0h,4fh,05h,5eh
+			db	e1h,6bh,77h,8fh,abh,7ch,ffh,e8h
+			db	5bh,2dh,40h,c2h,a8h,82h,73h,c6h
+			db	87h,19h,49h,b7h,34h,63h,0ch,cah
+			db	eeh,1dh,2eh,0ah,85h,fdh,7ch,94h
+			db	1bh,f4h,62h,98h,7eh,50h,a2h,84h
+			db	3ah,b1h,18h,6ch,b4h,b2h,bfh,38h
+			db	63h,48h,51h,7fh,e7h,dah,9bh,b0h
+			db	8bh,9bh,3ah,6eh,13h,06h,a7h,a5h
+			db	d5h,5ah,70h,49h,80h,e6h,c5h,ffh
+			db	f9h,32h,a3h,abh,0bh,bch,feh,b4h
+			db	f0h,42h,63h,31h,09h,fbh,85h,85h
+			db	85h,03h,91h,02h,edh,39h,b9h,69h
+			db	08h,a2h,25h,bfh,b8h,b7h,08h,50h
+			db	a0h,e0h,deh,9fh,3eh,e4h,5ch,6eh
+			db	d7h,36h,53h,25h,6fh,32h,50h,92h
+			db	47h,48h,75h,c3h,5ah,b6h,6dh,aeh
+			db	fdh,4ch,02h,dah,72h,4dh,6eh,29h
+			db	28h,30h,fdh,50h,19h,49h,68h,f6h
+			db	1ch,deh,41h,d3h,7fh,87h,71h,a7h
+			db	89h,6ch,21h,eeh,eeh,ebh,5ch,5ah
+			db	47h,32h,3ch,fbh,c5h,49h,c9h,2eh
+			db	f4h,6ch,95h,aah,c5h,46h,32h,25h
+			db	e5h,d0h,82h,b6h,aeh,47h,54h,31h
+			db	3bh,f6h,03h,96h,73h,70h,24h,7bh
+			db	41h,afh,2dh,bch,bah,a6h,29h,e8h
+			db	49h,b2h,ech,5ch,b8h,c9h,f7h,60h
+			db	bfh,83h,60h,93h,7fh,39h,1dh,25h
+			db	d4h,cch,edh,b2h,c9h,94h,4fh,53h
+			db	e5h,8eh,9ch,bdh,27h,b4h,92h,5ch
+			db	81h,d7h,7fh,c8h,05h,09h,bfh,e4h
+			db	9bh,e9h,e1h,66h,61h,c2h,71h,4bh
+			db	c9h,04h,f7h,64h,e6h,afh,e3h,26h
+			db	a0h,12h,39h,28h,09h,59h,09h,f0h
+			db	72h,0ah,80h,4fh,4bh,30h,d2h,3fh
+			db	83h,b3h,87h,54h,22h,aah,ebh,05h
+			db	ddh,e5h,9ah,c7h,f2h,d1h,d5h,86h
+			db	55h,17h,fah,87h,cah,d7h,43h,49h
+			db	01h,96h,67h,42h,dch,55h,9ch,28h
+			db	2fh,8ah,8eh,c4h,63h,53h,32h,dah
+			db	cbh,e7h,2dh,02h,77h,50h,52h,8bh
+			db	3bh,76h,4bh,33h,a4h,61h,e3h,b8h
+			db	b4h,9fh,e5h,39h,99h,b1h,31h,29h
+			db	7fh,a2h,d6h,92h,83h,4ch,84h,f7h
+			db	dfh,ddh,98h,53h,82h,77h,90h,31h
+			db	01h,deh,91h,d7h,93h,12h,a5h,6ch
+			db	9bh,5fh,8eh,8eh,3eh,61h,f2h,97h
+			db	b6h,36h,fah,5ch,0fh,10h,8ah,55h
+			db	38h,cch,c5h,aah,50h,21h,4ah,08h
+			db	55h,96h,eeh,67h,dbh,2bh,76h,ddh
+			db	30h,4eh,d6h,62h,a5h,12h,e9h,bdh
+			db	90h,76h,58h,5bh,bdh,b8h,7ah,29h
+			db	47h,aeh,f9h,5ah,74h,59h,19h,bch
+			db	a1h,90h,41h,cch,fah,15h,d5h,83h
+			db	26h,2eh,72h,deh,8ah,10h,5fh,1fh
+			db	35h,67h,f7h,dbh,1ah,77h,24h,35h
+			db	a2h,56h,dbh,eeh,e7h,14h,90h,a4h
+			db	56h,62h,37h,b6h,30h,1ah,e4h,27h
+			db	eah,61h,73h,c1h,54h,abh,a7h,14h
+			db	ebh,0fh,3fh,98h,4bh,5bh,aah,4ah
+			db	97h,d9h,dch,91h,bdh,83h,95h,7bh
+			db	d9h,f9h,ffh,71h,6ch,c1h,02h,56h
+			db	ddh,ddh,7dh,e7h,6ch,edh,d8h,dfh
+			db	09h,46h,99h,71h,7eh,70h,b2h,05h
+			db	0eh,d4h,40h,e1h,85h,15h,7eh,87h
+			db	17h,e1h,1fh,cch,03h,53h,12h,9ah
+			db	65h,6ch,24h,87h,64h,2bh,3ch,58h
+			db	ceh,6fh,1eh,9eh,5eh,aah,1ch,6ah
+			db	7ch,16h,e2h,f1h,67h,dch,11h,83h
+			db	c3h,edh,b9h,64h,1bh,c0h,58h,8ch
+			db	bfh,39h,23h,01h,81h,f2h,8ah,a3h
+			db	36h,c1h,cah,73h,9dh,1bh,b7h,51h
+			db	96h,c9h,f7h,83h,85h,91h,84h,2ah
+			db	f6h,8ch,42h,b9h,93h,6ah,7eh,a1h
+			db	c6h,68h,7ah,89h,23h,e4h,8ch,abh
+			db	13h,10h,dbh,98h,43h,a9h,c0h,f9h
+			db	d2h,a4h,4ah,82h,23h,7dh,a1h,8bh
+			db	39h,28h,50h,efh,9ah,1fh,72h,fch
+			db	99h,4dh,a9h,82h,f6h,93h,41h,44h
+			db	79h,43h,30h,c1h,0dh,e1h,07h,91h
+			db	a6h,75h,59h,61h,abh,83h,4dh,6fh
+			db	80h,20h,21h,97h,cfh,cbh,7dh,8dh
+			db	afh,8ch,5dh,65h,65h,77h,b9h,33h
+			db	3eh,b5h,4ch,e5h,5bh,91h,0ah,d3h
+			db	94h,72h,40h,ech,aah,fbh,25h,7fh
+			db	60h,36h,a7h,b0h,11h,b5h,94h,38h
+			db	95h,f8h,49h,29h,e3h,4bh,1ch,06h
+			db	c9h,f4h,46h,60h,a2h,9dh,5eh,46h
+			db	bfh,dah,bch,e2h,55h,4ch,9eh,ceh
+			db	c6h,ach,c8h,f9h,89h,b5h,45h,a2h
+			db	d2h,1dh,04h,a6h,9eh,86h,08h,93h
+			db	dfh,6eh,d7h,f5h,7bh,1ah,05h,f4h
+			db	4eh,41h,bdh,55h,47h,35h,79h,c5h
+			db	83h,04h,d0h,bdh,aeh,fch,38h,a7h
+			db	2ah,37h,c9h,63h,cch,eeh,a0h,f0h
+			db	0fh,32h,99h,63h,d6h,f5h,e6h,49h
+			db	3dh,64h,b8h,f5h,afh,40h,15h,d3h
+			db	d8h,15h,dfh,51h,f6h,fdh,8ah,e3h
+			db	ach,86h,e6h,4eh,dah,e2h,76h,36h
+			db	73h,d0h,90h,6bh,d2h,f2h,9ch,80h
+			db	8fh,66h,cdh,69h,30h,eeh,6dh,98h
+			db	2dh,5eh,20h,e9h,9fh,20h,ebh,bah
+			db	e2h,aeh,28h,e3h,83h,f5h,09h,0eh
+			db	70h,ach,b5h,b1h,b2h,c5h,dch,43h
+			db	a9h,63h,07h,88h,85h,06h,86h,98h
+			db	8ah,30h,73h,6ah,67h,26h,d4h,35h
+			db	4bh,3bh,7ch,8eh,cdh,c2h,f8h,c0h
+			db	98h,25h,dah,b9h,c6h,29h,f6h,cfh
+			db	7ch,1ah,30h,5ch,79h,24h,7dh,05h
+			db	f0h,37h,9ah,1fh,95h,afh,70h,ach
+			db	15h,1bh,c7h,7dh,4dh,a8h,60h,f0h
+			db	bch,c4h,20h,a8h,beh,57h,efh,deh
+			db	8fh,e6h,70h,eeh,59h,13h,0eh,38h
+			db	95h,92h,94h,74h,a2h,82h,3ch,51h
+			db	1dh,77h,cdh,0eh,0ah,e1h,58h,4bh
+			db	7ch,bbh,aah,75h,74h,d4h,a6h,d9h
+			db	ddh,09h,b5h,3ah,f4h,b9h,d7h,bch
+			db	a7h,58h,c5h,42h,45h,63h,8fh,23h
+			db	3bh,c0h,14h,c2h,94h,7fh,0bh,5bh
+			db	fdh,30h,f6h,61h,8bh,7fh,48h,16h
+			db	1ch,c7h,b8h,95h,4ch,37h,20h,11h
+			db	4eh,92h,94h,adh,19h,85h,02h,16h
+			db	7dh,9bh,beh,a9h,59h,3eh,89h,1eh
+			db	44h,fbh,f2h,2ah,e2h,08h,12h,f3h
+			db	beh,2ch,41h,f6h,a5h,85h,8bh,cbh
+			db	e0h,85h,1bh,49h,eeh,27h,90h,e3h
+			db	0ah,6bh,cch,ach,c9h,b9h,8ah,2bh
+			db	efh,04h,a5h,95h,81h,93h,6ah,5bh
+			db	74h,b2h,abh,80h,d6h,e7h,38h,a1h
+			db	b6h,3ah,bdh,e5h,86h,64h,90h,30h
+			db	24h,03h,abh,d5h,b9h,52h,8fh,0ah
+			db	c0h,b3h,d3h,99h,02h,67h,a0h,5eh
+			db	a6h,60h,a9h,7eh,f1h,8fh,cdh,1ah
+			db	97h,4ah,62h,c7h,f7h,25h,1fh,29h
+			db	10h,90h,62h,ddh,dah,3bh,d6h,0dh
+			db	c2h,91h,05h,dfh,a3h,4bh,c6h,67h
+			db	93h,24h,8fh,39h,23h,adh,37h,7fh
+			db	a3h,2ah,c8h,4dh,e3h,68h,90h,d0h
+			db	2bh,65h,7dh,26h,e5h,6bh,41h,20h
+			db	85h,c8h,9eh,c7h,73h,27h,fah,23h
+			db	43h,e8h,2bh,26h,ceh,60h,2fh,deh
+			db	aah,2dh,bah,a3h,89h,95h,8eh,19h
+			db	5ah,49h,2ch,1ah,a3h,1ch,aah,4eh
+			db	49h,eah,27h,b5h,95h,c8h,83h,56h
+			db	40h,cch,a0h,e6h,31h,35h,dbh,f2h
+			db	d2h,aah,9eh,c6h,bdh,fah,e2h,b6h
+			db	71h,cah,51h,24h,b2h,68h,27h,b9h
+			db	36h,08h,45h,9ah,d4h,6fh,02h,7bh
+			db	25h,48h,c5h,9ch,c9h,96h,93h,67h
+			db	edh,e2h,f6h,b2h,4eh,34h,73h,1ch
+			db	97h,66h,78h,abh,68h,05h,b2h,21h
+			db	79h,bbh,a3h,6dh,a1h,98h,abh,beh
+			db	5ch,90h,38h,44h,36h,d6h,fah,20h
+			db	60h,61h,26h,feh,61h,7ch,3dh,0eh
+			db	9fh,f6h,8eh,85h,73h,61h,23h,eeh
+			db	e4h,0fh,40h,77h,7bh,c1h,68h,0dh
+			db	e6h,9dh,cdh,58h,4bh,d9h,7fh,25h
+			db	3eh,1ch,52h,d1h,62h,c8h,82h,48h
+			db	e0h,b1h,66h,89h,43h,5fh,50h,62h
+			db	08h,a2h,a0h,0eh,52h,a8h,95h,01h
+			db	b2h,06h,27h,3dh,25h,25h,4dh,34h
+			db	0bh,5bh,b2h,91h,7ch,a6h,63h,c9h
+			db	4fh,0ch,68h,1eh,d0h,d5h,cch,68h
+			db	c9h,beh,43h,cah,c3h,76h,f0h,5fh
+			db	92h,c2h,21h,8ah,48h,a8h,35h,02h
+			db	45h,efh,abh,28h,32h,4fh,7bh,26h
+			db	2bh,86h,4ah,09h,20h,c3h,e0h,28h
+			db	feh,7eh,20h,81h,b0h,afh,e0h,87h
+			db	2dh,32h,07h,93h,3bh,83h,26h,15h
+			db	76h,cah,79h,90h,18h,21h,feh,e9h
+			db	01h,b4h,01h,ech,9bh,51h,bch,b0h
+			db	1ah,e6h,44h,25h,66h,77h,63h,47h
+			db	04h,73h,0fh,53h,08h,74h,0ch,49h
+			db	8ah,adh,6dh,0dh,95h,cch,e1h,d5h
+			db	6ch,7ch,bah,d7h,21h,06h,ddh,30h
+			db	55h,5bh,47h,bch,79h,d0h,b1h,aah
+			db	38h,1ah,dah,9dh,46h,a8h,b0h,02h
+			db	abh,6dh,32h,7ah,beh,23h,f8h,3fh
+			db	78h,97h,e1h,5ch,a9h,7bh,49h,e5h
+			db	2dh,5eh,54h,3bh,afh,80h,a3h,14h
+			db	7ch,f4h,f4h,29h,4ch,06h,8dh,5dh
+			db	8fh,16h,8bh,6bh,46h,f8h,9ch,3bh
+			db	5bh,86h,10h,ffh,03h,39h,96h,33h
+			db	09h,56h,4fh,6eh,afh,b4h,80h,47h
+			db	e7h,84h,0bh,c3h,3bh,a7h,95h,74h
+			db	52h,93h,7bh,a2h,05h,6bh,74h,13h
+			db	efh,1eh,2bh,10h,49h,82h,58h,e3h
+			db	9bh,edh,a2h,7ch,f1h,50h,90h,b5h
+			db	2eh,dbh,98h,2bh,eah,56h,0ah,f4h
+			db	7dh,ffh,85h,d1h,d9h,e9h,d6h,b1h
+			db	d0h,f2h,98h,cfh,d1h,a2h,5ah,0dh
+			db	8eh,93h,30h,a7h,c1h,8eh,38h,bch
+			db	04h,89h,ebh,b4h,06h,d3h,f3h,c5h
+			db	3eh,50h,7bh,a7h,05h,17h,24h,98h
+			db	70h,5eh,c8h,55h,85h,24h,69h,f6h
+			db	7dh,eeh,dah,96h,26h,b4h,73h,25h
+			db	1bh,7eh,cah,3fh,22h,12h,61h,c5h
+			db	31h,6fh,29h,ffh,82h,bch,f8h,29h
+			db	dah,5fh,3ch,19h,98h,a7h,64h,56h
+			db	c1h,55h,a5h,46h,60h,f9h,73h,1bh
+			db	f9h,e6h,d5h,2fh,bbh,18h,84h,b2h
+			db	5ch,3dh,8ah,d3h,1bh,c6h,a2h,51h
+			db	21h,55h,0dh,3ch,67h,60h,7ch,46h
+			db	ceh,afh,57h,1bh,9ch,6bh,e4h,1bh
+			db	59h,55h,98h,e5h,24h,f3h,fdh,46h
+			db	44h,57h,6ch,2eh,bah,4bh,43h,7dh
+			db	49h,58h,8eh,a2h,09h,14h,08h,84h
+			db	4dh,f3h,02h,23h,22h,2fh,a3h,27h
+			db	8ah,87h,9fh,37h,32h,c6h,01h,11h
+			db	ffh,e3h,f7h,0ah,e4h,8bh,2dh,81h
+			db	35h,38h,cah,edh,61h,b4h,d5h,0dh
+			db	30h,abh,26h,98h,32h,06h,82h,6dh
+			db	a0h,cbh,4fh,a0h,20h,20h,10h,d9h
+			db	7bh,dah,6fh,1ah,81h,41h,28h,bbh
+			db	71h,fbh,16h,90h,4bh,98h,a9h,4ah
+			db	3dh,c9h,88h,4dh,4fh,f4h,3bh,cfh
+			db	f2h,18h,6eh,cah,19h,8ah,c6h,c8h
+			db	3ah,f6h,9fh,9ah,67h,d6h,83h,0eh
+			db	b5h,71h,19h,58h,43h,66h,d8h,29h
+			db	54h,a7h,90h,33h,adh,91h,cfh,cch
+			db	ddh,cfh,08h,f2h,95h,94h,a4h,f0h
+			db	f7h,cdh,2eh,e4h,3bh,43h,b2h,7ah
+			db	b2h,9ah,b5h,84h,79h,66h,75h,5ah
+			db	4bh,2eh,7bh,60h,fah,a7h,cfh,71h
+			db	13h,d9h,b0h,e7h,d5h,cah,f4h,90h
+			db	2fh,d0h,4ch,eeh,6ah,14h,24h,a2h
+			db	a6h,66h,03h,43h,2bh,23h,ach,e8h
+			db	76h,f6h,16h,9fh,edh,26h,25h,3eh
+			db	78h,f0h,b4h,b2h,24h,c4h,8dh,c3h
+			db	dch,d3h,d5h,6dh,b6h,f8h,3ah,beh
+			db	65h,dah,3ah,bdh,a6h,95h,99h,a0h
+			db	f9h,4bh,e4h,cfh,cfh,99h,37h,d4h
+			db	94h,55h,09h,0ch,c3h,9fh,f0h,0bh
+			db	72h,74h,ffh,edh,93h,a5h,e8h,d7h
+			db	deh,87h,7eh,38h,c1h,30h,f4h,85h
+			db	06h,4bh,d4h,0ch,0ch,70h,57h,e3h
+			db	1dh,74h,49h,f3h,d6h,7eh,9dh,a4h
+			db	80h,64h,55h,2eh,f0h,43h,5ah,35h
+			db	9ah,3bh,26h,0ah,34h,cch,9dh,26h
+			db	e6h,73h,ceh,68h,67h,b5h,0eh,7fh
+			db	46h,6bh,82h,82h,50h,c7h,eeh,90h
+			db	45h,74h,d9h,1ah,68h,bch,7ch,a3h
+			db	7dh,d3h,cbh,b3h,fbh,80h,9ah,17h
+			db	5bh,57h,6bh,1dh,23h,bdh,dah,24h
+			db	19h,5eh,7eh,54h,0bh,fbh,e3h,f8h
+			db	12h,f4h,22h,19h,88h,b2h,8dh,66h
+			db	e4h,8ch,fdh,84h,eah,adh,bfh,9dh
+			db	27h,71h,4ch,c2h,92h,d9h,9dh,34h
+			db	cbh,0eh,40h,89h,c8h,71h,dbh,f0h
+			db	27h,6dh,2fh,00h,03h,38h,74h,91h
+			db	f2h,6eh,55h,31h,f4h,68h,54h,96h
+			db	34h,35h,9bh,42h,c2h,74h,10h,afh
+			db	bbh,2ch,f0h,7ah,64h,d5h,b1h,feh
+			db	04h,0bh,2ch,51h,e4h,71h,34h,cbh
+			db	bfh,4ah,2ah,77h,7eh,7ch,69h,00h
+			db	34h,fah,8ah,fbh,95h,9eh,65h,88h
+			db	0dh,edh,24h,b8h,dah,8eh,8ah,8eh
+			db	f5h,3ah,88h,42h,76h,ach,f6h,e4h
+			db	e1h,6ah,88h,d4h,a3h,0ah,2eh,94h
+			db	12h,f0h,64h,56h,58h,03h,3fh,bbh
+			db	0ch,ebh,19h,14h,dch,78h,a6h,86h
+			db	f4h,54h,99h,b0h,53h,bdh,8bh,fbh
+			db	aeh,98h,28h,a7h,3fh,abh,03h,dah
+			db	9fh,7dh,aah,82h,68h,9dh,4fh,1eh
+			db	54h,ach,66h,51h,f1h,1eh,d1h,ach
+			db	91h,2bh,cah,8ah,f4h,69h,b2h,19h
+			db	5ch,afh,6fh,ebh,4bh,abh,52h,58h
+			db	1ah,7eh,25h,4bh,cch,e1h,abh,62h
+			db	3fh,a4h,62h,84h,16h,97h,33h,7ah
+			db	64h,04h,26h,33h,b1h,2ch,4bh,e4h
+			db	efh,d1h,39h,83h,0ah,e3h,dah,1dh
+			db	bah,05h,85h,a4h,8fh,67h,a9h,d6h
+			db	93h,30h,6ah,11h,15h,19h,3eh,e6h
+			db	55h,28h,c1h,84h,27h,bah,f8h,cbh
+			db	3bh,e5h,f4h,d7h,4bh,36h,fch,04h
+			db	3ch,04h,1eh,86h,a8h,15h,1fh,f3h
+			db	76h,a6h,55h,74h,b1h,a0h,c3h,02h
+			db	eah,a2h,e3h,13h,86h,08h,ffh,afh
+			db	d1h,9ch,48h,7ah,99h,3dh,ddh,0fh
+			db	24h,4dh,2dh,b3h,3fh,ceh,13h,1bh
+			db	0ch,4fh,6dh,33h,a5h,64h,15h,0bh
+			db	7bh,8fh,95h,4ah,08h,a5h,24h,79h
+			db	d7h,d3h,80h,52h,24h,32h,d9h,f4h
+			db	27h,15h,fch,22h,25h,fbh,cdh,39h
+			db	26h,bch,78h,9eh,b2h,10h,8eh,c0h
+			db	67h,15h,64h,15h,61h,ach,24h,d4h
+			db	23h,7dh,beh,93h,74h,bah,e1h,f1h
+			db	28h,60h,a3h,4ch,9fh,3eh,3ah,f1h
+			db	dbh,3bh,6eh,feh,bfh,98h,22h,36h
+			db	24h,74h,98h,48h,19h,39h,11h,e9h
+			db	2eh,d2h,6eh,b1h,24h,c4h,3fh,72h
+			db	d0h,33h,24h,84h,c2h,9ah,48h,e6h
+			db	bah,cah,6dh,3dh,eeh,dbh,08h,7fh
+			db	27h,c7h,1eh,10h,dah,6ah,50h,42h
+			db	e2h,c0h,92h,60h,c7h,e0h,c7h,00h
+			db	7dh,2eh,46h,47h,10h,3ch,f0h,31h
+			db	beh,76h,5ch,40h,4bh,edh,f6h,4bh
+			db	5ch,c2h,d4h,19h,3fh,5bh,52h,47h
+			db	8fh,b0h,9fh,ffh,d1h,32h,bbh,deh
+			db	5eh,68h,55h,50h,42h,a1h,d9h,18h
+			db	08h,21h,58h,84h,ceh,00h,45h,99h
+			db	84h,4ch,73h,b3h,e1h,a1h,c6h,d2h
+			db	59h,91h,45h,fch,56h,12h,0eh,2bh
+			db	fch,9eh,09h,68h,f3h,56h,31h,68h
+			db	fbh,bch,46h,1ch,ddh,78h,74h,1fh
+			db	1bh,f7h,e6h,e4h,2eh,1bh,a6h,d6h
+			db	ech,05h,06h,70h,02h,c4h,43h,85h
+			db	d3h,5fh,16h,11h,19h,aeh,46h,6ch
+			db	e6h,6ch,cah,4eh,a7h,18h,9eh,d3h
+			db	43h,3ch,85h,7dh,8ch,4fh,56h,0bh
+			db	21h,98h,3fh,dbh,45h,2ch,47h,5ch
+			db	19h,5ch,53h,62h,ech,d4h,87h,abh
+			db	2ch,c7h,bch,efh,75h,e2h,c4h,9bh
+			db	dfh,c5h,cfh,a3h,8fh,f4h,4ah,a4h
+			db	9fh,a1h,84h,cfh,dah,57h,78h,2eh
+			db	49h,88h,41h,f7h,62h,b1h,15h,56h
+			db	78h,84h,66h,96h,82h,71h,d4h,bch
+			db	ach,91h,d0h,8eh,57h,a1h,64h,38h
+			db	dbh,f9h,aeh,a2h,5fh,92h,62h,c9h
+			db	0eh,22h,12h,c8h,22h,b6h,54h,01h
+			db	bbh,e6h,88h,a9h,f9h,aeh,37h,fah
+			db	55h,19h,a0h,c7h,b1h,9eh,58h,5ah
+			db	90h,cch,72h,62h,4fh,f4h,10h,37h
+			db	4bh,d8h,5ch,7ah,52h,7ah,70h,d2h
+			db	9ch,deh,07h,19h,93h,a4h,e4h,c7h
+			db	0ah,d4h,b1h,51h,74h,9fh,57h,24h
+			db	51h,74h,13h,6dh,9dh,89h,aeh,50h
+			db	31h,c0h,b5h,72h,d9h,24h,39h,0dh
+			db	f3h,b8h,1ch,1ah,68h,fch,ebh,48h
+			db	47h,edh,afh,feh,c1h,7ah,e7h,1ah
+			db	91h,ebh,56h,5bh,c9h,34h,d9h,38h
+			db	a8h,e3h,b0h,4fh,abh,67h,f4h,a5h
+			db	65h,f9h,7eh,40h,b9h,57h,0dh,cah
+			db	8fh,55h,71h,04h,60h,b6h,36h,44h
+			db	5dh,2dh,afh,84h,3ch,88h,a8h,98h
+			db	53h,6eh,7eh,edh,55h,11h,1dh,f5h
+			db	7ch,9bh,10h,87h,32h,bdh,10h,53h
+			db	f7h,11h,80h,feh,6bh,82h,5ah,93h
+			db	25h,1ah,52h,afh,f2h,c9h,74h,45h
+			db	76h,20h,ach,2fh,fah,e9h,4dh,eeh
+			db	3bh,1ch,3dh,82h,3ah,16h,6dh,7fh
+			db	afh,08h,0bh,ddh,6fh,14h,7ah,8dh
+			db	ceh,16h,41h,aeh,62h,36h,93h,d4h
+			db	24h,10h,e0h,17h,f1h,ech,88h,c0h
+			db	59h,c7h,abh,3bh,66h,eeh,64h,cch
+			db	84h,4dh,37h,59h,d2h,d8h,4dh,01h
+			db	38h,7fh,d4h,53h,01h,eah,5fh,e7h
+			db	17h,3eh,0dh,2fh,a6h,84h,8eh,6bh
+			db	43h,48h,03h,2ah,fah,c7h,3ch,2ah
+			db	3eh,92h,97h,8dh,c2h,71h,84h,f3h
+			db	d2h,8dh,73h,96h,d4h,08h,c8h,95h
+			db	12h,f8h,b9h,04h,67h,82h,cbh,fah
+			db	11h,75h,fdh,c0h,3eh,d3h,2eh,a0h
+			db	24h,7ch,e1h,39h,14h,9eh,0fh,eeh
+			db	c8h,2eh,80h,a5h,a7h,bbh,eeh,1ah
+			db	d7h,c8h,a4h,9fh,7dh,98h,0fh,ceh
+			db	89h,74h,0ah,15h,67h,91h,93h,03h
+			db	fbh,77h,feh,e6h,d7h,33h,51h,07h
+			db	e1h,d4h,7dh,96h,d4h,1ah,81h,9dh
+			db	1ch,26h,e7h,c4h,60h,bah,73h,fbh
+			db	9ch,5bh,eah,04h,4ch,f1h,c5h,56h
+			db	e6h,93h,51h,a7h,17h,d7h,d6h,f7h
+			db	66h,c2h,3bh,5fh,ebh,40h,4ah,5dh
+			db	5fh,bfh,1fh,fch,f3h,57h,b7h,39h
+			db	46h,fdh,eah,4eh,efh,51h,a4h,b3h
+			db	64h,ceh,cdh,24h,ach,60h,d2h,e8h
+			db	f6h,b0h,02h,fbh,6bh,3ch,f2h,beh
+			db	27h,15h,33h,afh,e9h,fdh,86h,d8h
+			db	b2h,8ah,abh,22h,81h,50h,dch,23h
+			db	eeh,afh,c1h,3dh,d6h,15h,d3h,15h
+			db	0ah,59h,93h,62h,e6h,a7h,94h,26h
+			db	80h,6eh,86h,b5h,c7h,21h,73h,4bh
+			db	efh,d1h,43h,adh,41h,bbh,18h,ffh
+			db	91h,33h,dah,06h,5bh,c7h,98h,ddh
+			db	fbh,3ch,d9h,03h,0bh,70h,abh,e8h
+			db	ech,25h,5bh,feh,fch,0ch,20h,f7h
+			db	c4h,9fh,d4h,e3h,cdh,80h,2ch,6fh
+			db	bfh,6ah,e8h,adh,15h,1ah,82h,5ah
+			db	deh,69h,b5h,02h,03h,bbh,e5h,30h
+			db	37h,e9h,57h,35h,a9h,cch,57h,c1h
+			db	a2h,37h,4ch,78h,c2h,abh,61h,7bh
+			db	d0h,cfh,69h,f4h,dch,22h,b7h,f2h
+			db	90h,59h,beh,93h,27h,eeh,bfh,48h
+			db	13h,37h,e9h,5fh,80h,3ch,8dh,1bh
+			db	7eh,3ah,f7h,8ah,87h,3ch,fah,e4h
+			db	0eh,1fh,22h,63h,99h,45h,9dh,f0h
+			db	a2h,76h,fdh,3dh,17h,04h,f1h,93h
+			db	dfh,cch,5dh,5eh,11h,1ah,04h,42h
+			db	19h,99h,d9h,23h,c5h,73h,d4h,25h
+			db	8ch,e3h,43h,b2h,87h,86h,73h,ddh
+			db	45h,b9h,d8h,b8h,8fh,94h,bfh,a8h
+			db	60h,9bh,c0h,abh,5bh,abh,44h,16h
+			db	28h,dfh,c3h,5bh,46h,52h,c1h,7ah
+			db	beh,c0h,f2h,74h,d1h,1ah,2bh,b3h
+			db	49h,3fh,64h,fdh,c6h,65h,6dh,ffh
+			db	c8h,cbh,c2h,1bh,5fh,3eh,c2h,a7h
+			db	76h,05h,90h,c4h,f3h,aah,a0h,82h
+			db	e8h,75h,d5h,3dh,5bh,69h,2ch,d7h
+			db	7dh,60h,d0h,33h,afh,15h,47h,10h
+			db	b6h,0eh,7dh,51h,8bh,ach,8eh,f5h
+			db	edh,fah,9fh,dbh,8ch,78h,36h,18h
+			db	99h,cdh,3fh,4bh,8dh,19h,16h,5eh
+			db	c8h,d3h,a2h,3eh,eah,80h,bfh,50h
+			db	3bh,c1h,b9h,93h,d4h,11h,0ch,d1h
+			db	50h,98h,58h,3ah,e4h,f7h,3ch,91h
+			db	d1h,7eh,dbh,62h,58h,6fh,15h,f3h
+			db	7ah,9fh,d2h,cch,13h,eeh,44h,7ah
+			db	95h,97h,62h,75h,c8h,36h,d4h,0fh
+			db	78h,46h,5bh,06h,98h,0fh,e4h,90h
+			db	d8h,0eh,27h,56h,6dh,09h,29h,e6h
+			db	92h,00h,02h,eeh,34h,50h,0eh,56h
+			db	9ah,fdh,69h,d5h,1eh,34h,e3h,8eh
+			db	d2h,1dh,1bh,e2h,36h,c1h,b4h,9eh
+			db	0dh,f8h,93h,7ah,96h,99h,bfh,40h
+			db	14h,26h,d1h,edh,b3h,f9h,47h,c2h
+			db	42h,47h,d8h,eeh,4dh,02h,6bh,2eh
+			db	d7h,b5h,9dh,2fh,8bh,90h,f7h,aah
+			db	6ah,96h,c0h,43h,9bh,17h,c2h,cch
+			db	d1h,16h,23h,ach,89h,c6h,aeh,e2h
+			db	1ah,beh,dah,65h,2bh,89h,92h,86h
+			db	b4h,32h,ach,4ch,46h,afh,e4h,61h
+			db	75h,02h,fdh,c7h,5eh,cdh,1dh,71h
+			db	31h,52h,0bh,2dh,1bh,9fh,b8h,b2h
+			db	48h,80h,f1h,0ah,16h,cah,e0h,6fh
+			db	c9h,87h,ffh,dbh,65h,c8h,07h,ceh
+			db	6ch,d5h,78h,27h,01h,20h,6fh,d8h
+			db	54h,52h,c2h,e7h,22h,63h,04h,16h
+			db	7ah,a1h,f5h,1dh,e2h,38h,25h,b3h
+			db	2eh,f1h,e7h,91h,2fh,3fh,cah,b2h
+			db	c2h,4bh,64h,88h,2dh,ddh,f0h,6bh
+			db	59h,b5h,bah,48h,f5h,ech,7eh,2bh
+			db	d3h,56h,6dh,84h,2eh,76h,5bh,18h
+			db	e3h,62h,dfh,e2h,71h,14h,75h,3eh
+			db	a0h,27h,e1h,60h,71h,1fh,2fh,a4h
+			db	96h,7fh,c0h,0eh,5bh,51h,72h,3ch
+			db	77h,2ch,ech,17h,03h,45h,4ch,08h
+			db	8fh,3bh,04h,0ah,d2h,75h,57h,e7h
+			db	2ah,24h,3fh,b9h,2eh,a8h,33h,c2h
+			db	55h,ech,b9h,87h,f1h,12h,c3h,f0h
+			db	f1h,9ch,d2h,11h,2fh,33h,8fh,99h
+			db	50h,4fh,19h,cbh,7dh,93h,9dh,ffh
+			db	a9h,85h,bbh,64h,d9h,dch,72h,78h
+			db	93h,67h,9eh,deh,43h,1eh,86h,f7h
+			db	c1h,e9h,98h,3ah,29h,8dh,b7h,aah
+			db	2ah,f7h,42h,2eh,fch,c4h,ach,0bh
+			db	79h,c5h,69h,79h,2eh,98h,0fh,57h
+			db	3fh,5eh,66h,33h,71h,d4h,45h,f3h
+			db	0ch,58h,bdh,6bh,cch,c8h,47h,07h
+			db	45h,f2h,80h,97h,04h,ech,8dh,72h
+			db	4ch,e8h,7ch,17h,cah,05h,64h,a9h
+			db	18h,eeh,07h,b0h,12h,a4h,83h,fdh
+			db	2eh,81h,f3h,75h,06h,52h,82h,74h
+			db	abh,15h,e0h,58h,79h,f3h,f7h,0ch
+			db	31h,36h,fch,8ah,a6h,efh,31h,14h
+			db	8ah,9dh,c0h,30h,77h,a4h,e4h,d3h
+			db	63h,d6h,ffh,96h,5eh,a8h,0ch,87h
+			db	d5h,4eh,78h,74h,21h,45h,a4h,b7h
+			db	f0h,64h,7eh,6eh,4bh,22h,79h,41h
+			db	ebh,28h,72h,cah,51h,33h,4bh,48h
+			db	a3h,c7h,cch,e3h,65h,e5h,7ah,69h
+			db	99h,35h,7bh,b1h,19h,aeh,c2h,45h
+			db	f7h,7fh,2eh,0dh,b3h,b5h,fdh,e6h
+			db	3eh,82h,71h,e4h,26h,e7h,80h,1fh
+			db	f1h,8ah,bfh,00h,b9h,61h,4ch,e6h
+			db	e0h,b6h,86h,73h,2eh,40h,f6h,6ch
+			db	14h,aeh,27h,9eh,b9h,82h,b4h,23h
+			db	4fh,d2h,95h,10h,dah,91h,86h,29h
+			db	78h,7eh,fbh,43h,00h,74h,39h,a3h
+			db	19h,f3h,92h,b9h,1dh,deh,1eh,f7h
+			db	48h,deh,a7h,26h,69h,3eh,3bh,65h
+			db	dfh,e4h,0ch,64h,cbh,57h,16h,31h
+			db	2eh,05h,ech,9bh,c6h,6ch,27h,19h
+			db	93h,2ah,99h,77h,cah,bdh,18h,27h
+			db	57h,55h,9ch,bah,c0h,84h,7dh,bfh
+			db	5ch,16h,09h,34h,bbh,2fh,77h,a1h
+			db	b0h,63h,a0h,bfh,3ch,32h,38h,5eh
+			db	d8h,99h,edh,0ah,22h,11h,0fh,3dh
+			db	eeh,beh,a6h,32h,84h,dah,f6h,6bh
+			db	a2h,61h,d4h,4fh,43h,c1h,96h,f3h
+			db	46h,c4h,c9h,cah,a4h,c6h,8eh,e5h
+			db	ech,72h,59h,26h,8ch,59h,cfh,76h
+			db	f2h,d7h,aah,23h,0eh,8ch,35h,49h
+			db	e2h,62h,b8h,7bh,58h,08h,4dh,adh
+			db	21h,63h,b8h,cah,f9h,b2h,29h,79h
+			db	aah,0eh,abh,16h,4bh,7fh,1bh,c8h
+			db	33h,32h,dbh,6dh,21h,ech,feh,f7h
+			db	22h,31h,e7h,05h,b2h,6ah,13h,14h
+			db	72h,c5h,65h,3ah,21h,5bh,3fh,6ah
+			db	25h,bah,c5h,e2h,59h,f6h,40h,7ch
+			db	a9h,51h,72h,dbh,8eh,78h,ceh,bah
+			db	4eh,03h,73h,0eh,23h,1ch,ach,e5h
+			db	a5h,ddh,5fh,bah,70h,d8h,aeh,8bh
+			db	77h,94h,56h,06h,24h,2ah,59h,4fh
+			db	4eh,00h,86h,6eh,4eh,09h,6dh,d6h
+			db	64h,dbh,cah,e5h,6bh,22h,6bh,65h
+			db	61h,c9h,36h,88h,40h,bdh,61h,ceh
+			db	e9h,78h,24h,85h,67h,cdh,28h,a0h
+			db	63h,72h,2bh,b9h,bbh,fdh,96h,01h
+			db	2dh,07h,b9h,8ch,c0h,81h,88h,cdh
+			db	89h,fch,a4h,3eh,d4h,e5h,4dh,8eh
+			db	0ah,45h,96h,0dh,b2h,d8h,3ch,57h
+			db	5dh,f0h,c3h,29h,5fh,63h,40h,c6h
+			db	93h,2ah,b2h,6ch,d8h,1fh,5bh,2dh
+			db	5ch,03h,aeh,1fh,c2h,d7h,e4h,69h
+			db	7ah,7bh,a7h,39h,11h,03h,51h,b9h
+			db	ach,f7h,a7h,18h,e3h,53h,efh,ddh
+			db	3bh,aah,63h,b2h,0ah,fbh,87h,b9h
+			db	50h,ffh,26h,35h,f3h,65h,85h,36h
+			db	51h,24h,32h,f6h,27h,31h,f3h,b5h
+			db	f9h,3bh,f3h,8ah,ebh,9dh,3ah,60h
+			db	2bh,42h,8fh,c5h,3fh,f9h,1bh,37h
+			db	e2h,61h,82h,71h,86h,beh,65h,2fh
+			db	7dh,adh,d7h,e0h,99h,bfh,c9h,32h
+			db	dch,a1h,80h,a5h,adh,8ah,e4h,d4h
+			db	63h,00h,65h,0eh,b3h,00h,d1h,14h
+			db	cfh,70h,aah,22h,dch,68h,54h,ddh
+			db	bch,6fh,34h,66h,aah,1ch,5ch,d7h
+			db	ceh,fdh,d7h,17h,9ah,efh,55h,bch
+			db	5eh,dfh,1fh,80h,b2h,36h,98h,02h
+			db	78h,61h,7bh,c5h,dch,7dh,47h,bbh
+			db	49h,d4h,ach,89h,cfh,b1h,f0h,b1h
+			db	c0h,23h,d8h,7dh,50h,9fh,d4h,00h
+			db	bbh,b9h,82h,66h,d0h,fbh,27h,74h
+			db	77h,80h,38h,6eh,97h,a0h,a5h,49h
+			db	b1h,dbh,edh,efh,18h,4eh,07h,f7h
+			db	61h,6ah,a4h,e4h,d3h,edh,0bh,a5h
+			db	c3h,19h,b9h,77h,e8h,0ch,09h,5ch
+			db	d4h,89h,93h,39h,68h,5ch,4eh,03h
+			db	a3h,3fh,2ah,ach,d7h,79h,01h,a4h
+			db	c1h,deh,79h,f5h,a5h,6ch,51h,e1h
+			db	22h,b4h,77h,a0h,deh,d3h,58h,54h
+			db	0ch,ddh,fah,49h,66h,e7h,d8h,76h
+			db	cfh,1bh,cfh,a0h,b2h,63h,fch,82h
+			db	55h,19h,01h,8bh,e6h,1ch,c4h,7ah
+			db	14h,1eh,47h,32h,1ah,a7h,f7h,bfh
+			db	54h,51h,18h,d1h,1bh,70h,01h,77h
+			db	93h,e4h,fah,1ch,a0h,91h,36h,35h
+			db	72h,dbh,6dh,20h,e7h,8ah,47h,6fh
+			db	11h,14h,9dh,b8h,ffh,eeh,4bh,27h
+			db	efh,c0h,cdh,94h,d7h,3dh,0ah,0dh
+			db	a4h,6ah,6bh,98h,71h,31h,2dh,19h
+			db	40h,c2h,62h,ceh,37h,21h,27h,1ah
+			db	49h,6ch,a7h,4ah,32h,43h,4dh,80h
+			db	80h,03h,28h,b8h,07h,a0h,64h,17h
+			db	c9h,1eh,85h,24h,efh,52h,76h,44h
+			db	a5h,efh,5dh,38h,2ch,f0h,2dh,86h
+			db	1dh,4bh,d8h,a4h,39h,eah,06h,31h
+			db	7dh,4fh,d7h,13h,f2h,82h,1eh,82h
+			db	2fh,dah,29h,fdh,d6h,cfh,85h,b6h
+			db	dbh,4fh,20h,60h,d0h,83h,ech,44h
+			db	a7h,bdh,b7h,37h,9ah,15h,2fh,8ah
+			db	2eh,23h,d3h,ddh,77h,78h,c1h,a2h
+			db	47h,4fh,46h,2bh,93h,8dh,c1h,37h
+			db	75h,35h,19h,45h,dfh,abh,34h,10h
+			db	03h,bah,8dh,91h,1ch,34h,eah,01h
+			db	4ah,81h,f4h,04h,0ah,18h,3dh,0fh
+			db	55h,12h,52h,6ch,aeh,00h,44h,8ch
+			db	cfh,dbh,ddh,a1h,38h,82h,bbh,51h
+			db	2eh,73h,c3h,ddh,a6h,9bh,eeh,c0h
+			db	c7h,33h,33h,46h,a6h,8eh,8eh,dbh
+			db	e1h,3eh,64h,31h,41h,a9h,97h,14h
+			db	63h,6ch,8eh,23h,8eh,c4h,84h,43h
+			db	a0h,56h,82h,30h,33h,dch,05h,42h
+			db	5ah,08h,17h,17h,0ch,c0h,edh,39h
+			db	5ah,39h,d1h,25h,d9h,dch,5bh,b3h
+			db	a0h,5ah,49h,e7h,6eh,3eh,a8h,0fh
+			db	f2h,d6h,f6h,d0h,3ch,a0h,09h,f7h
+			db	65h,b8h,84h,fbh,f9h,17h,5fh,65h
+			db	60h,e2h,31h,58h,e4h,79h,17h,a6h
+			db	23h,f6h,51h,edh,f1h,e0h,fch,c7h
+			db	a1h,96h,04h,d8h,84h,24h,76h,0eh
+			db	0eh,30h,b3h,18h,62h,42h,77h,43h
+			db	c9h,36h,e9h,8eh,3eh,8fh,8dh,a5h
+			db	44h,b4h,f8h,07h,f1h,c4h,e1h,26h
+			db	f2h,cbh,4eh,dfh,b3h,8dh,b3h,17h
+			db	d2h,d9h,90h,5bh,6dh,6dh,deh,5dh
+			db	2bh,ach,48h,28h,feh,30h,e1h,94h
+			db	b9h,27h,b2h,69h,b1h,28h,e2h,6dh
+			db	3fh,efh,79h,80h,bah,63h,17h,d3h
+			db	6eh,2eh,1fh,4ah,cah,b4h,f2h,8dh
+			db	3fh,0eh,9dh,6ch,62h,56h,41h,9dh
+			db	1ah,9bh,8bh,aah,2fh,5fh,f1h,92h
+			db	0fh,f5h,81h,95h,ceh,c9h,39h,d6h
+			db	79h,abh,45h,04h,f7h,47h,9ah,dfh
+			db	24h,a0h,c7h,c7h,0fh,b4h,67h,71h
+			db	afh,94h,78h,cbh,f3h,e6h,aeh,98h
+			db	43h,d0h,0eh,f2h,ffh,e0h,29h,01h
+			db	15h,c6h,24h,24h,88h,2ch,05h,d0h
+			db	e7h,75h,eah,1dh,e2h,ceh,90h,e6h
+			db	12h,1ah,2dh,1dh,f3h,10h,bdh,46h
+			db	a3h,b6h,5ah,91h,98h,2ah,fbh,2ch
+			db	61h,adh,1ah,e2h,41h,4ch,74h,18h
+			db	36h,edh,8ch,1ah,e0h,3eh,c5h,33h
+			db	e3h,7eh,01h,4dh,fdh,97h,0dh,27h
+			db	48h,76h,4bh,feh,40h,7ch,58h,d2h
+			db	5fh,6dh,cah,99h,86h,1bh,03h,a6h
+			db	f6h,02h,0dh,deh,9dh,1dh,8dh,b4h
+			db	72h,c6h,66h,08h,5ah,d1h,7ch,cfh
+			db	e4h,46h,63h,5ch,6fh,ech,fah,4fh
+			db	56h,2ch,34h,dah,01h,5eh,1ah,d8h
+			db	9ah,4bh,e1h,d1h,72h,71h,20h,26h
+			db	d9h,cch,3eh,36h,2eh,5ch,08h,dah
+			db	eah,3eh,44h,b0h,ebh,86h,dah,a5h
+			db	a1h,69h,87h,bah,f5h,d1h,1bh,1fh
+			db	fah,d0h,5eh,1fh,7ah,19h,c9h,67h
+			db	b0h,32h,76h,13h,6fh,fch,31h,f6h
+			db	b8h,c1h,9ch,82h,91h,ceh,7fh,79h
+			db	79h,14h,bch,d2h,aeh,b1h,32h,b7h
+			db	b5h,a0h,9ch,b0h,ffh,80h,51h,c5h
+			db	4fh,8dh,aeh,40h,51h,08h,89h,9eh
+			db	4eh,b7h,64h,64h,c9h,6eh,aah,c7h
+			db	75h,c8h,3fh,12h,d0h,fah,14h,25h
+			db	93h,95h,f0h,7fh,b2h,fdh,45h,8ch
+			db	49h,1fh,87h,8dh,3dh,2ch,0eh,cbh
+			db	05h,2ch,edh,70h,a1h,a3h,4bh,f9h
+			db	36h,01h,99h,b2h,dch,e6h,28h,b4h
+			db	59h,0ah,69h,58h,fbh,bfh,32h,a9h
+			db	09h,9dh,e4h,57h,89h,4dh,7ch,55h
+			db	c5h,eah,7fh,ffh,79h,f2h,4ch,68h
+			db	b3h,16h,19h,42h,cbh,edh,2bh,48h
+			db	6eh,49h,d8h,b2h,10h,fdh,7ah,7fh
+			db	80h,89h,27h,56h,6fh,67h,6fh,99h
+			db	21h,63h,e6h,edh,8fh,6ah,c1h,9fh
+			db	feh,41h,f6h,b6h,a9h,c4h,1ah,f8h
+			db	84h,b6h,6fh,3bh,67h,abh,05h,e4h
+			db	35h,46h,26h,b4h,3bh,41h,b5h,e6h
+			db	bdh,4dh,8fh,87h,d1h,a2h,6ah,d2h
+			db	ffh,beh,d2h,a5h,06h,aah,0dh,e2h
+			db	26h,39h,1fh,84h,4dh,04h,44h,02h
+			db	77h,9eh,f3h,f5h,14h,a2h,69h,88h
+			db	66h,e3h,c1h,93h,d6h,8ah,c3h,4dh
+			db	8eh,72h,1fh,53h,66h,f8h,11h,0bh
+			db	d7h,fah,67h,26h,52h,f0h,1ah,51h
+			db	5ah,73h,83h,8ch,0fh,17h,18h,3ah
+			db	1fh,06h,d8h,40h,3dh,e0h,76h,1fh
+			db	2fh,2ch,e6h,abh,f5h,44h,9dh,f6h
+			db	27h,bdh,03h,0dh,b3h,bbh,ffh,5fh
+			db	11h,ebh,adh,69h,e3h,0bh,90h,d9h
+			db	23h,c9h,59h,5eh,66h,aah,9ch,71h
+			db	45h,96h,e9h,cbh,ffh,95h,76h,0fh
+			db	5dh,ech,f6h,f7h,d8h,c7h,b0h,d2h
+			db	39h,57h,6eh,71h,7dh,23h,56h,37h
+			db	4bh,70h,8dh,a1h,7fh,1bh,4ch,77h
+			db	a8h,57h,2dh,37h,7dh,2ah,edh,e8h
+			db	a1h,bch,c1h,85h,0eh,74h,23h,b2h
+			db	f9h,63h,feh,40h,8ah,dbh,b0h,e9h
+			db	3ch,06h,37h,91h,0fh,4ch,ebh,ebh
+			db	28h,9ch,9ch,beh,22h,a3h,6fh,58h
+			db	9ah,54h,3bh,7dh,86h,fch,8ah,0bh
+			db	4fh,c7h,d6h,87h,3ah,2eh,bbh,98h
+			db	40h,f0h,52h,52h,45h,d9h,6dh,dfh
+			db	43h,d8h,71h,8eh,ach,02h,d3h,90h
+			db	2dh,51h,e5h,86h,0dh,0ch,a7h,1ah
+			db	d0h,aah,c1h,abh,88h,2ch,ddh,0ch
+			db	97h,e8h,39h,63h,b0h,67h,53h,8ch
+			db	94h,9eh,40h,e0h,21h,69h,66h,99h
+			db	f8h,e5h,43h,b8h,4eh,1ah,ach,05h
+			db	22h,35h,23h,4dh,e4h,fch,b3h,29h
+			db	1fh,16h,1eh,b1h,8eh,01h,e0h,09h
+			db	3bh,a2h,8eh,77h,94h,fbh,e1h,c2h
+			db	42h,54h,2dh,deh,dfh,95h,30h,97h
+			db	45h,f8h,bbh,8fh,fah,d6h,ceh,76h
+			db	7eh,23h,33h,a0h,92h,51h,bdh,82h
+			db	13h,99h,2bh,b4h,8ch,85h,bbh,2eh
+			db	7dh,35h,1eh,3fh,46h,11h,7dh,6ah
+			db	59h,8bh,4eh,fah,d5h,56h,d8h,abh
+			db	75h,02h,46h,b0h,23h,b3h,57h,cah
+			db	2dh,bbh,abh,dah,20h,0bh,1fh,81h
+			db	5ch,99h,08h,65h,c4h,5ch,5bh,67h
+			db	adh,f2h,edh,cfh,aah,d1h,27h,95h
+			db	c4h,efh,4fh,4ah,2eh,65h,1dh,06h
+			db	4ch,32h,e5h,aeh,e2h,6bh,5dh,46h
+			db	25h,0ah,b4h,d9h,f2h,3fh,beh,12h
+			db	02h,ddh,fdh,96h,26h,3fh,85h,cah
+			db	eah,8ah,bch,d7h,7ch,88h,2ah,33h
+			db	1bh,c9h,5ah,41h,43h,c4h,1dh,76h
+			db	f4h,c4h,dch,c9h,3ch,9dh,88h,92h
+			db	76h,a1h,71h,e7h,afh,7ah,38h,4dh
+			db	40h,a8h,4fh,d0h,30h,04h,aeh,ceh
+			db	48h,6ah,aeh,01h,e2h,0ah,17h,27h
+			db	2eh,a1h,29h,95h,c0h,36h,bbh,feh
+			db	cfh,34h,e5h,1eh,2fh,cdh,79h,7fh
+			db	6bh,23h,50h,60h,bbh,42h,5ah,27h
+			db	dch,0dh,0ch,30h,d3h,dch,d5h,1fh
+			db	91h,06h,28h,0dh,4ah,8ch,e1h,89h
+			db	34h,b0h,d6h,4eh,19h,3dh,21h,80h
+			db	fbh,deh,1dh,c7h,8fh,f9h,4ah,24h
+			db	f3h,3ch,b8h,c3h,cbh,79h,1bh,93h
+			db	59h,29h,eeh,34h,c2h,d2h,04h,70h
+			db	5fh,a4h,15h,e6h,64h,dah,32h,ddh
+			db	69h,14h,b3h,a2h,32h,c7h,18h,44h
+			db	e6h,8eh,d8h,59h,93h,73h,6fh,54h
+			db	5dh,6fh,ebh,5ch,1eh,f9h,4ch,8ch
+			db	fdh,17h,02h,75h,efh,8dh,a0h,7ah
+			db	dah,fah,f1h,0fh,cah,66h,18h,dch
+			db	f2h,b4h,60h,bah,5fh,4bh,22h,b3h
+			db	55h,65h,d4h,ceh,9eh,88h,b2h,8eh
+			db	11h,d9h,87h,68h,c0h,b0h,bch,68h
+			db	53h,b9h,a8h,e5h,06h,a6h,76h,afh
+			db	4bh,05h,d5h,7bh,e1h,a4h,10h,1ch
+			db	c7h,35h,46h,cfh,1fh,9ch,44h,0bh
+			db	42h,eeh,b2h,25h,cbh,efh,49h,f1h
+			db	ech,d8h,b3h,f3h,47h,17h,9fh,5dh
+			db	48h,52h,deh,1bh,99h,0ch,adh,5ch
+			db	b5h,bdh,39h,29h,d3h,73h,e4h,aeh
+			db	37h,30h,4eh,31h,d0h,12h,38h,b7h
+			db	21h,85h,29h,26h,90h,4fh,6dh,08h
+			db	42h,75h,61h,66h,22h,dch,0bh,72h
+			db	f5h,9ch,17h,08h,97h,04h,27h,8ch
+			db	8dh,e5h,9ah,b6h,0ch,17h,c9h,0dh
+			db	9bh,a2h,76h,2fh,48h,99h,27h,d2h
+			db	7fh,a5h,a3h,9dh,74h,9ch,5dh,ffh
+			db	53h,86h,07h,8eh,0ch,75h,f5h,d4h
+			db	02h,cah,94h,b7h,0ch,c1h,cdh,77h
+			db	37h,dch,09h,48h,02h,7dh,cdh,a7h
+			db	83h,b1h,f5h,d0h,84h,52h,95h,92h
+			db	11h,25h,d6h,deh,07h,0bh,6ch,6ah
+			db	5eh,f3h,d4h,20h,10h,7bh,ceh,ach
+			db	8dh,99h,73h,18h,d0h,e7h,46h,adh
+			db	08h,0fh,c4h,5eh,4ch,00h,40h,cfh
+			db	f0h,28h,23h,3bh,1ah,9eh,85h,f3h
+			db	0bh,05h,90h,fch,95h,54h,8dh,3ah
+			db	c0h,e7h,25h,bah,ech,8bh,6bh,d9h
+			db	dfh,1ah,5fh,b0h,43h,30h,fbh,a7h
+			db	35h,6ah,dbh,4ah,32h,bah,17h,15h
+			db	bah,efh,27h,aeh,eeh,ddh,57h,c5h
+			db	96h,c1h,1eh,86h,75h,9bh,dfh,28h
+			db	97h,01h,28h,14h,6ch,5dh,d1h,7fh
+			db	5bh,91h,bdh,5ch,cah,c8h,d9h,0fh
+			db	05h,6eh,f4h,c0h,71h,c4h,cbh,fch
+			db	63h,c7h,ddh,29h,f2h,b5h,c9h,67h
+			db	fbh,b5h,a8h,0eh,11h,c5h,b7h,bah
+			db	1eh,f1h,e0h,7ah,5eh,92h,b1h,b0h
+			db	a3h,b0h,f1h,37h,98h,5fh,77h,c5h
+			db	68h,41h,50h,64h,5ch,eah,aeh,26h
+			db	6fh,1fh,20h,c8h,71h,9ch,57h,24h
+			db	02h,d6h,eah,bdh,26h,17h,4bh,ffh
+			db	85h,05h,07h,43h,0ah,27h,e4h,11h
+			db	b2h,89h,4bh,bfh,2dh,7eh,30h,8ah
+			db	0bh,e4h,a1h,d6h,a2h,01h,c6h,15h
+			db	c6h,7bh,b4h,cah,8bh,fah,dah,41h
+			db	e7h,1bh,75h,cch,3bh,6dh,1ah,aah
+			db	aeh,cah,ech,fbh,18h,19h,d7h,6ch
+			db	b4h,dbh,f7h,edh,72h,d5h,d3h,d3h
+			db	74h,29h,ech,91h,c9h,8dh,3ch,1bh
+			db	70h,deh,aah,e0h,e4h,dah,54h,cfh
+			db	27h,9fh,7bh,43h,f1h,6eh,8dh,a8h
+			db	48h,c1h,66h,0bh,4ah,5dh,52h,f5h
+			db	9dh,d1h,fdh,83h,17h,00h,20h,b8h
+			db	3ah,93h,c8h,e7h,6ch,3dh,26h,5ch
+			db	5dh,b3h,07h,d7h,0dh,3dh,35h,c3h
+			db	edh,5ch,c4h,86h,fch,13h,16h,21h
+			db	adh,33h,72h,e7h,3ch,71h,e3h,c6h
+			db	5fh,4fh,22h,94h,55h,c1h,86h,79h
+			db	97h,12h,22h,ffh,53h,cfh,bah,a6h
+			db	2dh,d1h,d0h,c6h,29h,61h,40h,28h
+			db	fdh,f9h,e0h,52h,3eh,b3h,6eh,7ch
+			db	7fh,2ah,f8h,50h,2dh,f5h,43h,7ch
+			db	12h,48h,60h,3bh,0fh,84h,a0h,a3h
+			db	9fh,88h,18h,75h,e1h,3fh,7ch,46h
+			db	8eh,b8h,44h,ffh,f3h,62h,48h,89h
+			db	beh,31h,4fh,8eh,bdh,f2h,2dh,2ah
+			db	43h,b6h,99h,a9h,74h,f7h,36h,22h
+			db	b7h,e2h,a3h,a3h,66h,47h,55h,f4h
+			db	7ch,56h,3ah,87h,24h,4eh,33h,50h
+			db	a1h,2ah,c3h,3dh,46h,fch,17h,90h
+			db	7ah,dch,ffh,9ah,66h,a0h,c8h,7fh
+			db	d8h,14h,2dh,9ch,fbh,11h,9bh,79h
+			db	57h,cfh,79h,b1h,fah,94h,55h,ebh
+			db	fah,c3h,dbh,51h,c0h,a5h,91h,29h
+			db	28h,7dh,0fh,6eh,0ch,bfh,3eh,92h
+			db	4eh,17h,15h,ddh,67h,c1h,44h,04h
+			db	87h,ach,26h,ach,bdh,d8h,10h,ddh
+			db	ech,90h,b6h,a3h,cch,7eh,34h,32h
+			db	a8h,53h,8bh,7dh,00h,c9h,e6h,efh
+			db	11h,62h,83h,92h,adh,d8h,f3h,61h
+			db	9dh,17h,96h,deh,d6h,37h,41h,27h
+			db	93h,61h,8fh,3ch,dah,e4h,6dh,a8h
+			db	a3h,dfh,82h,85h,5dh,a3h,eeh,0eh
+			db	a7h,79h,8ah,21h,67h,9ah,2ch,6fh
+			db	92h,4dh,c8h,10h,2ch,cah,1bh,4bh
+			db	77h,8dh,92h,dah,88h,c4h,d9h,e6h
+			db	36h,b2h,44h,ech,75h,19h,ach,d9h
+			db	7bh,cbh,e5h,d4h,81h,d6h,d6h,e2h
+			db	d4h,99h,48h,e4h,58h,56h,ech,32h
+			db	88h,13h,12h,f4h,9ah,c6h,ceh,4eh
+			db	c9h,9ch,b3h,33h,a7h,4ch,e7h,92h
+			db	37h,2ch,b8h,24h,b6h,2eh,25h,7eh
+			db	42h,d1h,7ah,f1h,feh,aeh,05h,d8h
+			db	29h,3eh,ddh,34h,1bh,bdh,d0h,2bh
+			db	9ch,d4h,eah,a3h,adh,6ch,53h,bdh
+			db	8bh,24h,6fh,84h,eah,55h,eeh,d1h
+			db	c9h,c4h,5ah,e9h,cfh,beh,24h,28h
+			db	8bh,a9h,83h,19h,5ah,3ah,f3h,50h
+			db	64h,49h,a0h,3fh,0fh,82h,35h,b2h
+			db	7eh,0fh,0bh,58h,e4h,98h,34h,9ch
+			db	0ah,c2h,aah,09h,63h,85h,e4h,fch
+			db	1ah,66h,05h,6eh,34h,aeh,07h,99h
+			db	7ch,e7h,1bh,ceh,35h,35h,eeh,1eh
+			db	33h,deh,34h,c4h,a6h,12h,f1h,08h
+			db	ddh,d4h,53h,beh,62h,79h,7eh,dch
+			db	5ah,99h,d0h,71h,5ah,73h,3ah,e3h
+			db	31h,1bh,72h,9dh,e2h,00h,8ch,41h
+			db	efh,74h,2ah,feh,9eh,75h,fch,cch
+			db	d8h,05h,9dh,a6h,f9h,a1h,37h,feh
+			db	63h,01h,e6h,16h,f2h,d8h,b2h,e8h
+			db	3bh,8fh,c1h,52h,25h,dbh,e8h,6ah
+			db	ddh,01h,5fh,4ch,6eh,70h,8fh,d2h
+			db	4fh,edh,83h,89h,5bh,00h,fdh,57h
+			db	20h,d3h,6dh,f0h,a5h,ceh,25h,07h
+			db	31h,41h,a8h,23h,b4h,78h,c2h,1fh
+			db	d8h,37h,78h,ebh,c4h,feh,22h,67h
+			db	6ah,abh,78h,8dh,dfh,b1h,56h,c3h
+			db	89h,edh,feh,f2h,64h,f0h,cdh,d6h
+			db	0fh,60h,a7h,35h,21h,06h,35h,7ah
+			db	ebh,4fh,b0h,87h,fdh,d4h,7dh,21h
+			db	1ah,d2h,d1h,47h,8ch,b9h,21h,abh
+			db	43h,31h,dbh,1bh,d9h,6fh,10h,2ch
+			db	dch,33h,8dh,65h,3ah,e2h,30h,47h
+			db	fbh,5bh,c8h,e0h,5bh,72h,4ch,e1h
+			db	84h,13h,63h,33h,dch,92h,edh,e0h
+			db	7bh,9ch,98h,8ch,6dh,eah,1eh,99h
+			db	beh,3bh,e2h,3fh,08h,6eh,62h,c6h
+			db	a6h,2bh,b4h,4bh,1eh,9ah,27h,22h
+			db	e7h,e0h,65h,ebh,bfh,06h,deh,04h
+			db	c0h,feh,c9h,beh,16h,76h,bbh,6eh
+			db	6eh,86h,b1h,d8h,00h,45h,8dh,e9h
+			db	dbh,f2h,1ah,edh,81h,dfh,37h,92h
+			db	55h,16h,ffh,07h,00h,e2h,74h,56h
+			db	1eh,dah,efh,a1h,e6h,9ah,bbh,4fh
+			db	86h,d6h,a5h,68h,95h,75h,5dh,b5h
+			db	fbh,13h,2dh,55h,95h,73h,bah,83h
+			db	2ah,51h,43h,44h,eeh,a7h,06h,42h
+			db	a4h,f8h,3dh,00h,4ch,05h,27h,94h
+			db	91h,b9h,cah,eah,23h,1ah,42h,8eh
+			db	f8h,b2h,deh,7fh,35h,ffh,1ah,1bh
+			db	2dh,b8h,01h,f6h,e4h,b6h,76h,b1h
+			db	28h,16h,35h,a4h,b0h,84h,2ah,c5h
+			db	ech,3eh,0dh,8bh,f3h,2ah,9ch,73h
+			db	07h,bah,2eh,98h,edh,b1h,25h,cah
+			db	eeh,e1h,59h,dah,1fh,e9h,06h,d2h
+			db	61h,e5h,99h,8fh,f3h,f3h,efh,93h
+			db	fbh,2bh,21h,4ah,cbh,b9h,e6h,8dh
+			db	ach,8bh,24h,d3h,cdh,7eh,abh,16h
+			db	0dh,71h,08h,39h,09h,d5h,64h,c0h
+			db	33h,b7h,bch,43h,d9h,06h,3eh,3fh
+			db	89h,09h,c9h,0eh,65h,a2h,74h,c1h
+			db	3fh,dbh,6eh,d1h,17h,88h,eah,32h
+			db	29h,b7h,bfh,cah,90h,afh,0ah,13h
+			db	f0h,e6h,f3h,a3h,fah,99h,21h,63h
+			db	16h,29h,a9h,e3h,bdh,b5h,8bh,2bh
+			db	e5h,d5h,edh,08h,00h,1dh,72h,74h
+			db	00h,b0h,afh,37h,b8h,fah,3eh,bah
+			db	28h,21h,41h,cch,65h,52h,12h,feh
+			db	32h,8dh,cfh,4fh,feh,68h,4fh,67h
+			db	bfh,eeh,44h,50h,e8h,b7h,58h,7ah
+			db	dfh,64h,96h,60h,aeh,9ah,5eh,fch
+			db	53h,94h,b9h,c7h,8dh,4dh,64h,38h
+			db	27h,dch,48h,f7h,20h,0eh,99h,9ah
+			db	c2h,2dh,0dh,f8h,d6h,cfh,77h,ddh
+			db	76h,bdh,2dh,cfh,09h,7ah,aah,29h
+			db	65h,a8h,3ah,feh,f9h,23h,8bh,afh
+			db	85h,ceh,b9h,8bh,35h,b7h,48h,37h
+			db	7dh,94h,dbh,aah,c5h,fah,85h,9dh
+			db	39h,18h,52h,b4h,a2h,9dh,a5h,7dh
+			db	2ch,d0h,58h,d3h,90h,58h,03h,9fh
+			db	3bh,33h,dbh,fdh,03h,eeh,d8h,92h
+			db	d0h,93h,04h,92h,2dh,fdh,5ch,86h
+			db	37h,69h,c5h,4ah,cch,9ah,9bh,d4h
+			db	b5h,0dh,88h,64h,79h,0bh,5bh,cdh
+			db	81h,54h,9eh,26h,7fh,55h,77h,c6h
+			db	99h,cdh,b5h,55h,d9h,5fh,59h,68h
+			db	8ah,bfh,b3h,f4h,4ah,47h,8ah,feh
+			db	32h,76h,1fh,4ah,ach,23h,f2h,66h
+			db	48h,aah,33h,2dh,00h,37h,22h,e4h
+			db	78h,0eh,35h,0eh,69h,e0h,64h,82h
+			db	92h,65h,75h,f9h,b4h,0ah,55h,c2h
+			db	7eh,89h,c3h,eeh,6ah,53h,12h,85h
+			db	31h,9ah,bch,a7h,74h,45h,c8h,e5h
+			db	7eh,20h,deh,3bh,cfh,6eh,adh,57h
+			db	20h,4bh,96h,79h,d8h,d7h,20h,04h
+			db	39h,6ah,efh,a8h,d7h,a5h,3bh,1bh
+			db	edh,88h,00h,ddh,edh,5eh,8eh,14h
+			db	5ah,8bh,cdh,21h,90h,81h,14h,5eh
+			db	aeh,13h,2fh,e7h,4bh,49h,64h,f8h
+			db	bfh,f9h,fah,69h,8bh,1ch,2dh,fdh
+			db	c6h,6ch,a5h,2ch,0ah,0ah,99h,beh
+			db	15h,9ah,34h,d4h,60h,c6h,d8h,8dh
+			db	e9h,c4h,62h,04h,b0h,40h,73h,24h
+			db	bdh,7dh,cdh,a0h,bah,dah,e0h,84h
+			db	9fh,c6h,5bh,02h,09h,8ch,46h,2bh
+			db	73h,feh,3dh,42h,6dh,66h,ebh,cbh
+			db	3eh,c7h,f9h,ech,9bh,8bh,b1h,91h
+			db	ceh,0dh,8dh,abh,fbh,3ah,7eh,7ch
+			db	dah,7fh,dfh,c3h,9ah,9ah,afh,2eh
+			db	27h,72h,2ch,cch,1ah,dfh,cah,cbh
+			db	89h,f8h,8ch,09h,1eh,97h,52h,8fh
+			db	55h,5fh,1ch,c7h,4fh,a0h,dch,b2h
+			db	04h,feh,f1h,30h,50h,51h,5ah,d3h
+			db	60h,1ah,7eh,6eh,c1h,2ch,39h,e7h
+			db	d7h,beh,80h,40h,a5h,a2h,74h,b7h
+			db	ebh,83h,7fh,adh,9ah,0dh,b8h,dfh
+			db	b0h,c8h,5ah,e2h,3ch,97h,b6h,6dh
+			db	75h,96h,b1h,d3h,31h,38h,f0h,90h
+			db	e4h,9dh,8eh,72h,5dh,30h,11h,beh
+			db	d5h,c0h,b0h,87h,35h,f1h,50h,40h
+			db	70h,21h,aah,beh,57h,dbh,b1h,20h
+			db	ech,feh,cfh,8ch,76h,9bh,edh,4dh
+			db	d9h,55h,a1h,1fh,6ch,a8h,32h,ffh
+			db	deh,b1h,38h,fbh,2ah,45h,27h,78h
+			db	63h,abh,7eh,1dh,3ah,19h,c2h,8fh
+			db	f3h,aeh,f4h,93h,b6h,f6h,01h,43h
+			db	99h,94h,d4h,07h,12h,5ah,a5h,3dh
+			db	72h,11h,b9h,7ch,07h,b9h,2ch,bch
+			db	cbh,28h,6eh,b1h,73h,7ch,01h,0bh
+			db	83h,15h,05h,49h,ech,a6h,cbh,33h
+			db	47h,2fh,4bh,ddh,22h,37h,26h,45h
+			db	3eh,f6h,83h,e3h,e1h,1bh,f7h,c8h
+			db	2ah,ebh,94h,f0h,26h,28h,7ch,51h
+			db	efh,58h,64h,2fh,f4h,78h,30h,6ch
+			db	61h,20h,fch,4eh,9bh,fbh,08h,c6h
+			db	37h,25h,39h,5bh,8bh,56h,48h,81h
+			db	25h,d0h,9dh,dfh,49h,86h,9ah,59h
+			db	b8h,20h,2ch,ach,4ch,7eh,93h,2eh
+			db	65h,efh,77h,02h,57h,58h,d5h,f7h
+			db	d1h,42h,abh,1eh,e2h,78h,f8h,98h
+			db	97h,6ah,f9h,62h,eah,07h,4dh,feh
+			db	8bh,cch,2bh,17h,a1h,a4h,f6h,65h
+			db	5dh,43h,9bh,8eh,9ah,58h,21h,3eh
+			db	00h,8dh,10h,5ch,b4h,5ch,72h,c1h
+			db	bbh,ach,40h,0fh,d5h,97h,60h,f1h
+			db	62h,6ah,d0h,4eh,9bh,13h,8dh,58h
+			db	04h,4ah,abh,f1h,10h,69h,04h,fch
+			db	26h,e3h,edh,bch,dfh,feh,97h,bbh
+			db	a2h,09h,02h,a9h,cfh,ech,5ch,e1h
+			db	62h,b7h,d4h,58h,4bh,77h,41h,e3h
+			db	79h,48h,e5h,25h,3ah,9eh,76h,1eh
+			db	86h,80h,5ch,4bh,e6h,6fh,e8h,fch
+			db	84h,bch,2eh,5ah,efh,60h,abh,e8h
+			db	55h,29h,0dh,3dh,afh,ffh,0fh,ebh
+			db	45h,a6h,c7h,a5h,c3h,32h,e8h,49h
+			db	47h,1dh,0bh,78h,bah,b1h,bdh,8ah
+			db	ddh,aeh,4fh,5bh,91h,fah,99h,62h
+			db	beh,81h,48h,f8h,cdh,10h,68h,14h
+			db	11h,86h,76h,1eh,6ah,0fh,69h,09h
+			db	8ch,ech,84h,59h,85h,5ah,5dh,44h
+			db	82h,68h,4ah,23h,53h,40h,96h,4fh
+			db	9fh,74h,34h,53h,21h,2ah,6fh,4ch
+			db	06h,b9h,d5h,10h,dbh,e8h,50h,a9h
+			db	72h,1fh,b9h,24h,61h,77h,e2h,0fh
+			db	d5h,aeh,c7h,c6h,93h,d7h,07h,66h
+			db	63h,09h,a1h,b9h,9dh,a2h,6dh,eeh
+			db	8eh,03h,c7h,fdh,f2h,f7h,68h,7fh
+			db	e5h,6eh,87h,5eh,6ah,a5h,dch,40h
+			db	ech,88h,62h,6ch,5bh,2ah,d6h,77h
+			db	73h,98h,aeh,06h,a4h,8dh,1ah,b2h
+			db	21h,bah,a2h,ach,64h,65h,9dh,57h
+			db	a0h,04h,57h,9bh,53h,20h,e4h,0fh
+			db	5dh,a6h,22h,d3h,7ah,92h,02h,28h
+			db	3bh,d6h,50h,59h,e7h,82h,98h,72h
+			db	19h,06h,47h,e1h,adh,75h,d4h,37h
+			db	35h,fdh,fbh,1dh,dbh,5eh,b8h,83h
+			db	bch,64h,c3h,1bh,7eh,aah,1ah,89h
+			db	36h,f4h,cah,d5h,60h,8ah,b7h,55h
+			db	4ch,aeh,4dh,dch,eeh,03h,9eh,74h
+			db	e8h,1fh,62h,29h,3ch,b7h,64h,beh
+			db	0fh,3eh,aeh,54h,0eh,2fh,57h,8ch
+			db	4ch,90h,76h,50h,60h,c3h,b0h,99h
+			db	bdh,edh,91h,adh,abh,4bh,d2h,98h
+			db	9ch,c9h,e6h,5ah,07h,a4h,80h,8ch
+			db	05h,c5h,b7h,1eh,3bh,80h,f3h,7fh
+			db	1eh,62h,8dh,37h,26h,d8h,0dh,b6h
+			db	3eh,cch,23h,6eh,a2h,03h,aeh,78h
+			db	22h,76h,68h,f7h,ebh,43h,41h,b1h
+			db	82h,59h,44h,1fh,90h,14h,4dh,41h
+			db	b2h,fbh,3bh,63h,a4h,6ch,a4h,a6h
+			db	3fh,b7h,08h,81h,87h,1eh,e9h,45h
+			db	b0h,ebh,f7h,53h,60h,50h,9ah,78h
+			db	73h,b3h,30h,b7h,fdh,4ch,92h,60h
+			db	1eh,ffh,7dh,9bh,2bh,9eh,61h,7dh
+			db	cbh,a9h,88h,d7h,9fh,e9h,99h,60h
+			db	a4h,37h,5ah,d9h,4eh,87h,44h,88h
+			db	79h,e6h,63h,7ah,23h,6dh,6fh,ech
+			db	0bh,47h,fdh,53h,20h,33h,b6h,e6h
+			db	f9h,c8h,f9h,6bh,8bh,55h,47h,c3h
+			db	a2h,dch,52h,86h,33h,bch,ffh,beh
+			db	44h,7eh,d1h,e1h,29h,80h,1bh,92h
+			db	e1h,1dh,2eh,23h,b4h,8eh,64h,4ah
+			db	e7h,c1h,91h,e5h,8ah,b7h,8fh,c7h
+			db	7fh,84h,2fh,ceh,e7h,bfh,00h,6ch
+			db	00h,f4h,f0h,57h,b7h,d4h,17h,c5h
+			db	d1h,59h,86h,25h,b3h,ebh,1eh,49h
+			db	5ch,3bh,b5h,4ah,16h,a0h,eah,27h
+			db	27h,03h,8ah,65h,6ch,6ah,7ah,4bh
+			db	26h,42h,46h,52h,6ah,60h,48h,46h
+			db	6bh,6eh,50h,8eh,09h,36h,7ch,bbh
+			db	59h,34h,bfh,0bh,43h,89h,e6h,a5h
+			db	06h,6ch,c5h,00h,71h,99h,d7h,36h
+			db	43h,e7h,bfh,f8h,75h,65h,13h,15h
+			db	56h,5dh,dfh,4eh,ddh,cah,f0h,74h
+			db	65h,01h,86h,50h,7bh,beh,75h,1bh
+			db	67h,4dh,9ch,43h,09h,0ah,ceh,d5h
+			db	8ah,a8h,4dh,adh,01h,f4h,29h,d3h
+			db	87h,d2h,e3h,6fh,62h,d3h,16h,18h
+			db	e1h,19h,4dh,b3h,36h,9fh,59h,02h
+			db	e2h,49h,69h,5dh,3ah,a4h,18h,a2h
+			db	83h,2dh,71h,c9h,afh,b2h,f0h,d2h
+			db	cbh,70h,83h,62h,1fh,e0h,0bh,42h
+			db	70h,bah,51h,34h,45h,5ah,e5h,feh
+			db	adh,f5h,7dh,1ch,f0h,4bh,5fh,fah
+			db	f6h,08h,50h,ech,9fh,22h,79h,94h
+			db	f8h,95h,efh,31h,fdh,bfh,68h,23h
+			db	9eh,19h,8dh,e3h,49h,f3h,7ah,3ah
+			db	e9h,51h,19h,71h,9bh,d3h,04h,a1h
+			db	5fh,9ch,89h,53h,61h,16h,0bh,38h
+			db	11h,24h,3dh,7bh,06h,f4h,01h,6ah
+			db	5fh,02h,23h,9eh,d3h,5ah,ach,8ah
+			db	73h,53h,dbh,53h,2ch,4bh,f3h,bdh
+			db	5ch,ceh,9ch,bbh,a8h,33h,77h,4ah
+			db	4eh,06h,93h,a1h,62h,87h,38h,ffh
+			db	b3h,7eh,31h,49h,d5h,62h,8ah,b3h
+			db	22h,69h,86h,41h,7ch,f5h,c9h,dch
+			db	08h,bdh,57h,66h,bch,e4h,72h,3eh
+			db	fbh,42h,efh,31h,87h,abh,eeh,92h
+			db	15h,c5h,28h,72h,f3h,73h,18h,dch
+			db	e1h,ceh,87h,5ch,bah,73h,47h,cdh
+			db	c4h,d5h,cah,07h,98h,0dh,f4h,68h
+			db	1ah,99h,62h,50h,c9h,8bh,8fh,6dh
+			db	63h,67h,86h,13h,8eh,dfh,feh,0dh
+			db	e4h,29h,d6h,23h,4bh,a3h,b1h,06h
+			db	96h,24h,f2h,43h,2bh,7ah,96h,0fh
+			db	c1h,f5h,2ah,29h,87h,c0h,f2h,d1h
+			db	2ch,0ah,2bh,c7h,a7h,a4h,c9h,cbh
+			db	a2h,7bh,21h,b3h,eeh,78h,23h,4eh
+			db	e6h,b9h,adh,bdh,4ah,48h,c4h,a9h
+			db	30h,8ah,56h,e3h,e1h,c0h,abh,48h
+			db	8eh,f4h,d3h,a4h,17h,aah,91h,4ch
+			db	39h,ffh,f1h,e9h,14h,efh,9ch,2bh
+			db	e8h,77h,88h,2bh,80h,a4h,cdh,89h
+			db	b3h,cdh,c1h,5ch,fdh,73h,bah,87h
+			db	abh,feh,cfh,bch,94h,86h,bdh,b0h
+			db	bdh,d4h,4ch,c9h,a0h,3fh,e8h,e8h
+			db	4fh,e0h,b1h,12h,01h,65h,e4h,76h
+			db	c0h,3ah,1bh,ech,d0h,e9h,f8h,2ch
+			db	a1h,5ah,b5h,68h,dbh,95h,94h,0ch
+			db	19h,30h,19h,a1h,bch,79h,65h,bdh
+			db	27h,abh,80h,3fh,49h,73h,9bh,74h
+			db	dfh,0ch,44h,e7h,88h,44h,07h,e1h
+			db	31h,abh,b6h,2fh,d7h,c3h,a5h,c9h
+			db	32h,ebh,38h,bfh,d6h,e9h,93h,b0h
+			db	fch,73h,08h,05h,aah,39h,36h,96h
+			db	19h,8ah,f9h,7ah,cbh,bbh,dch,6ah
+			db	3ch,1eh,36h,d8h,9ah,6eh,d3h,80h
+			db	f5h,7ah,3fh,d7h,20h,bdh,c5h,10h
+			db	36h,7eh,d8h,eah,57h,14h,ach,1bh
+			db	9bh,8ah,feh,a9h,f9h,96h,42h,aeh
+			db	a7h,30h,5dh,17h,c2h,bdh,bbh,76h
+			db	97h,5ch,dch,99h,f2h,6fh,2bh,3fh
+			db	69h,f4h,e2h,7bh,a9h,44h,6bh,50h
+			db	d1h,63h,d8h,9fh,87h,00h,b0h,30h
+			db	7ah,feh,cah,c2h,b1h,71h,f4h,dah
+			db	92h,b8h,e0h,c1h,fah,99h,15h,abh
+			db	75h,9ah,47h,d0h,03h,e4h,20h,9fh
+			db	bfh,87h,12h,5dh,55h,12h,4eh,ach
+			db	74h,4bh,66h,07h,10h,9dh,c8h,54h
+			db	6eh,00h,e7h,3ah,ech,9ch,2ch,7eh
+			db	fbh,d0h,6ch,bah,f2h,71h,3ch,41h
+			db	eah,36h,85h,67h,7bh,ebh,d7h,f6h
+			db	fah,93h,b2h,3fh,bfh,4ch,afh,f8h
+			db	dah,52h,48h,8ch,bbh,24h,9bh,43h
+			db	b7h,18h,f6h,dfh,14h,48h,39h,5eh
+			db	6ah,ebh,c1h,e4h,63h,93h,b3h,e5h
+			db	0ch,21h,b2h,f6h,57h,d2h,09h,62h
+			db	ddh,b9h,abh,f3h,5fh,95h,eah,c9h
+			db	afh,94h,d7h,37h,efh,d1h,2bh,38h
+			db	92h,c0h,8bh,4ch,d0h,bah,c7h,b8h
+			db	e4h,b0h,86h,ffh,7eh,5bh,7eh,03h
+			db	4bh,69h,56h,13h,a7h,6ah,30h,3fh
+			db	12h,e2h,7bh,99h,49h,48h,3fh,30h
+			db	cfh,65h,13h,cfh,feh,1ch,4bh,8fh
+			db	1ah,67h,e5h,6dh,85h,98h,57h,53h
+			db	06h,f4h,89h,6fh,14h,42h,d0h,45h
+			db	61h,a6h,e6h,5bh,01h,8fh,51h,86h
+			db	4ch,21h,0bh,3fh,d0h,b7h,48h,62h
+			db	99h,22h,3ch,81h,04h,16h,c8h,93h
+			db	e7h,17h,99h,b6h,50h,e8h,abh,d3h
+			db	4bh,36h,31h,6ch,e6h,d5h,dfh,1bh
+			db	9eh,76h,f9h,89h,3fh,39h,4eh,06h
+			db	88h,85h,6fh,74h,75h,59h,dbh,63h
+			db	ffh,4dh,fch,60h,16h,34h,b8h,88h
+			db	51h,f7h,e2h,7fh,71h,edh,31h,99h
+			db	c7h,7ch,5eh,21h,55h,a0h,77h,3bh
+			db	56h,48h,3fh,a3h,91h,18h,dah,a5h
+			db	f9h,e8h,79h,edh,80h,c0h,b3h,96h
+			db	c1h,6ch,22h,0eh,0fh,8dh,77h,22h
+			db	e4h,ceh,4ah,98h,2fh,bbh,1ch,30h
+			db	c9h,08h,6ch,95h,afh,cfh,d5h,f5h
+			db	b0h,bbh,e4h,63h,f1h,e8h,c3h,7eh
+			db	74h,a3h,edh,f8h,cch,30h,6bh,cfh
+			db	28h,66h,a6h,f4h,8ah,7fh,46h,11h
+			db	a9h,72h,b6h,fdh,f8h,e4h,16h,1dh
+			db	fdh,44h,87h,b5h,60h,14h,ffh,b3h
+			db	cch,bch,47h,84h,ach,b3h,b2h,42h
+			db	6fh,81h,0eh,b2h,09h,99h,d5h,b9h
+			db	37h,b9h,24h,c6h,b4h,14h,a0h,beh
+			db	58h,fbh,36h,b8h,c2h,ddh,18h,ebh
+			db	95h,46h,c3h,36h,f2h,0fh,2fh,dah
+			db	a4h,7eh,31h,7fh,dfh,4ch,c4h,05h
+			db	dch,71h,06h,c2h,82h,97h,24h,6fh
+			db	fch,edh,f0h,55h,84h,16h,d9h,deh
+			db	3ah,26h,6eh,afh,62h,c1h,53h,1bh
+			db	8ah,a1h,68h,07h,0ch,a0h,a9h,97h
+			db	35h,b5h,24h,49h,79h,a5h,59h,f3h
+			db	a7h,47h,0dh,e8h,77h,49h,45h,5fh
+			db	36h,7ch,11h,24h,eah,fbh,c9h,00h
+			db	6fh,59h,6eh,7fh,deh,5dh,c3h,93h
+			db	2ch,76h,6fh,95h,5fh,30h,6dh,62h
+			db	f3h,32h,20h,0ah,06h,4eh,6bh,36h
+			db	b8h,f4h,f5h,b3h,c4h,06h,ach,bah
+			db	81h,4ah,83h,28h,48h,cah,80h,6ch
+			db	aah,c4h,3ah,dbh,d3h,54h,bah,eah
+			db	8fh,83h,45h,e8h,14h,4eh,a1h,5dh
+			db	7dh,80h,4eh,dch,02h,8fh,28h,fch
+			db	22h,7ah,71h,63h,b1h,d9h,b6h,34h
+			db	6ch,08h,2dh,6ah,a1h,52h,1dh,e2h
+			db	adh,21h,02h,2bh,cbh,78h,8bh,b1h
+			db	e9h,39h,1ch,c2h,96h,e2h,d1h,7bh
+			db	b0h,e9h,2eh,d9h,e9h,45h,8dh,2fh
+			db	71h,7dh,bch,d0h,f7h,89h,c6h,91h
+			db	2bh,26h,cbh,d0h,d8h,8ch,a1h,22h
+			db	65h,b5h,7eh,27h,42h,93h,b9h,78h
+			db	c1h,53h,a3h,5ch,9ah,d1h,47h,46h
+			db	a1h,46h,6ah,92h,d2h,65h,70h,7eh
+			db	8ah,b8h,7fh,82h,5dh,afh,02h,84h
+			db	2eh,e1h,e5h,33h,52h,cch,dfh,dah
+			db	7dh,11h,fah,e9h,46h,24h,7ch,8bh
+			db	c3h,9ch,45h,73h,77h,67h,3ch,cah
+			db	84h,2eh,0bh,3ch,8dh,e1h,efh,07h
+			db	1eh,0dh,cbh,75h,69h,3eh,71h,2dh
+			db	0fh,09h,e1h,b3h,71h,afh,b3h,45h
+			db	dbh,66h,00h,d3h,3fh,05h,e0h,9ah
+			db	62h,78h,4fh,07h,f7h,eah,fah,7ah
+			db	aeh,7ah,1ah,07h,e9h,dfh,57h,49h
+			db	93h,beh,4eh,24h,4eh,9fh,1ch,ach
+			db	66h,e9h,75h,23h,49h,e1h,bbh,1ah
+			db	2ah,3ch,10h,aeh,72h,feh,75h,5bh
+			db	8ch,fbh,2ch,01h,feh,b8h,87h,41h
+			db	76h,abh,1eh,0dh,afh,0bh,b6h,dch
+			db	dch,5ch,39h,ceh,cfh,99h,9dh,6fh
+			db	82h,96h,f2h,73h,feh,a8h,00h,c6h
+			db	5bh,14h,cah,c7h,fdh,21h,d2h,8ch
+			db	1bh,b0h,55h,edh,7dh,0fh,a7h,adh
+			db	35h,84h,47h,7eh,63h,23h,4eh,7dh
+			db	85h,73h,22h,3bh,69h,3eh,c0h,adh
+			db	7fh,5bh,54h,51h,2fh,48h,72h,70h
+			db	7eh,71h,75h,6ch,1ah,84h,81h,14h
+			db	2eh,0fh,bch,04h,81h,7fh,e9h,80h
+			db	d3h,f7h,0bh,58h,c1h,c8h,98h,ech
+			db	e0h,cch,50h,43h,d4h,b3h,b0h,e6h
+			db	8dh,91h,38h,6eh,16h,e3h,08h,4ch
+			db	ceh,d6h,feh,3fh,25h,00h,9ch,c6h
+			db	6eh,5dh,dch,ebh,d2h,3dh,c2h,26h
+			db	21h,28h,0ah,7bh,7eh,38h,33h,99h
+			db	1eh,bah,5ch,a2h,e9h,9eh,8bh,4eh
+			db	c2h,5dh,b8h,ffh,1bh,5bh,73h,fch
+			db	9ch,ebh,cah,70h,c3h,6dh,33h,a2h
+			db	b9h,40h,5dh,48h,e5h,c9h,f9h,f6h
+			db	1dh,c4h,30h,fbh,43h,6ah,8ch,0ch
+			db	72h,93h,bch,09h,ach,a6h,95h,81h
+			db	d2h,0eh,35h,0bh,1fh,9dh,65h,d4h
+			db	aeh,65h,61h,a9h,04h,c4h,1bh,57h
+			db	3dh,16h,84h,1eh,83h,3dh,9dh,5fh
+			db	c2h,ddh,beh,76h,c0h,c6h,bbh,94h
+			db	11h,19h,e1h,14h,ddh,47h,6bh,98h
+			db	0fh,62h,5bh,8dh,3ch,94h,7bh,29h
+			db	44h,dfh,05h,5bh,84h,b1h,08h,0ah
+			db	6ch,05h,9dh,f1h,f0h,8ch,c0h,1eh
+			db	f4h,27h,5eh,43h,61h,abh,87h,9fh
+			db	cfh,aeh,e4h,e5h,52h,33h,5dh,81h
+			db	23h,60h,27h,42h,0ah,70h,d3h,5eh
+			db	6fh,d8h,ach,f8h,ebh,1dh,f1h,ach
+			db	12h,8ch,bfh,14h,90h,94h,e6h,60h
+			db	bah,bah,56h,90h,bah,2ah,beh,fch
+			db	cfh,95h,aah,e1h,64h,72h,3ch,deh
+			db	cbh,22h,40h,f4h,01h,3ch,10h,7fh
+			db	abh,f0h,6dh,fbh,70h,79h,91h,32h
+			db	abh,a5h,35h,19h,e2h,9ah,6ch,76h
+			db	c7h,f8h,b6h,fah,12h,6fh,99h,deh
+			db	f3h,d9h,1fh,04h,0bh,dbh,b4h,9eh
+			db	2eh,75h,53h,7ah,58h,70h,78h,3ch
+			db	7ch,f2h,a6h,72h,c7h,f5h,24h,6eh
+			db	05h,fah,9bh,91h,22h,ddh,eah,87h
+			db	2bh,03h,feh,c2h,12h,4ch,65h,4dh
+			db	0bh,6dh,4ah,f3h,2fh,4ah,92h,6dh
+			db	e3h,00h,61h,93h,69h,37h,a7h,5dh
+			db	d9h,abh,7fh,afh,f3h,78h,1ah,77h
+			db	f7h,67h,d7h,66h,c8h,51h,12h,62h
+			db	c1h,3bh,a6h,85h,c6h,60h,17h,6fh
+			db	71h,80h,74h,7bh,17h,6fh,50h,96h
+			db	0ah,b6h,f8h,7dh,d1h,6bh,64h,d5h
+			db	c2h,6ch,0bh,6dh,d4h,d8h,14h,95h
+			db	58h,59h,5eh,a8h,4ch,a9h,79h,d4h
+			db	deh,e4h,38h,28h,bch,e3h,efh,3dh
+			db	2ch,a2h,b6h,70h,5bh,efh,a7h,43h
+			db	90h,b6h,14h,a6h,e1h,ebh,6bh,e4h
+			db	36h,b5h,fdh,f7h,02h,42h,54h,feh
+			db	8dh,74h,b2h,3dh,84h,0ah,b4h,11h
+			db	b6h,2bh,19h,bbh,e8h,88h,17h,f3h
+			db	93h,0bh,f7h,f9h,4dh,76h,e4h,b1h
+			db	f9h,81h,f7h,f2h,0bh,25h,7dh,24h
+			db	1bh,62h,ach,3dh,d1h,2ah,02h,c5h
+			db	f4h,d8h,b2h,5dh,91h,58h,8eh,73h
+			db	71h,c7h,f0h,92h,42h,3dh,49h,e7h
+			db	d0h,3ah,74h,94h,77h,e2h,e1h,14h
+			db	b7h,43h,a6h,f4h,78h,6eh,98h,66h
+			db	91h,2ah,a2h,4bh,0fh,c1h,58h,b6h
+			db	a0h,77h,7ch,90h,cch,1eh,68h,b6h
+			db	2eh,e7h,f1h,efh,22h,91h,a0h,a6h
+			db	e1h,7dh,6ch,b9h,47h,51h,65h,57h
+			db	69h,7fh,3dh,b2h,01h,59h,05h,c4h
+			db	5ah,f5h,99h,50h,23h,c6h,36h,abh
+			db	30h,c7h,7bh,dbh,06h,77h,62h,e2h
+			db	69h,95h,9dh,5ch,80h,e6h,d6h,54h
+			db	a9h,d1h,23h,1eh,3ah,63h,d5h,e0h
+			db	cdh,c2h,31h,7ah,d9h,22h,e0h,3fh
+			db	2ah,ebh,57h,19h,4bh,14h,8dh,40h
+			db	80h,51h,6dh,32h,a0h,0ch,b5h,03h
+			db	b8h,e1h,35h,01h,beh,c4h,03h,b1h
+			db	ach,8ch,1eh,7bh,65h,aah,d6h,c2h
+			db	48h,26h,d7h,cch,b9h,dch,bdh,70h
+			db	f9h,7ah,6eh,72h,eeh,f1h,73h,02h
+			db	f3h,b1h,43h,efh,36h,b9h,23h,87h
+			db	75h,dbh,3ch,45h,85h,79h,e8h,11h
+			db	5ah,b0h,65h,74h,e0h,cah,64h,10h
+			db	cfh,b8h,beh,56h,16h,90h,19h,09h
+			db	98h,12h,0ah,bdh,ech,fch,02h,9bh
+			db	6ah,4bh,33h,a8h,45h,3bh,9ah,bdh
+			db	79h,97h,5fh,44h,94h,cah,e7h,adh
+			db	8fh,ebh,56h,e8h,1bh,71h,29h,c2h
+			db	f5h,b5h,28h,d1h,41h,a4h,06h,9bh
+			db	5bh,6dh,f7h,eah,bfh,72h,8ch,27h
+			db	e2h,49h,72h,ceh,69h,2dh,f1h,68h
+			db	8eh,c8h,d3h,35h,94h,16h,f8h,f1h
+			db	9eh,cah,41h,22h,26h,58h,fdh,2dh
+			db	cfh,f1h,1bh,d5h,0fh,34h,23h,02h
+			db	52h,73h,3bh,2ch,68h,2dh,a0h,7dh
+			db	32h,39h,29h,7ah,4ah,86h,1ah,5ah
+			db	4ah,31h,98h,d2h,b8h,94h,aah,01h
+			db	93h,d2h,6fh,03h,6fh,9ch,f3h,4ch
+			db	42h,4ch,40h,6ch,dch,cch,0ah,42h
+			db	ffh,32h,e8h,ech,76h,d0h,80h,70h
+			db	49h,0fh,d2h,6dh,b8h,d1h,b5h,aeh
+			db	96h,0ah,c5h,efh,32h,00h,a6h,25h
+			db	f9h,76h,e0h,53h,0ah,17h,1eh,5ch
+			db	2dh,37h,36h,ceh,f8h,e0h,8fh,a0h
+			db	edh,d8h,a6h,c7h,7eh,9ah,8eh,b6h
+			db	37h,50h,57h,d9h,adh,dch,b2h,67h
+			db	01h,27h,f7h,4fh,1dh,86h,54h,55h
+			db	91h,ebh,57h,81h,08h,f8h,86h,41h
+			db	c1h,d0h,38h,0fh,1fh,e0h,36h,f0h
+			db	71h,29h,3ch,adh,53h,90h,bfh,8eh
+			db	09h,e2h,aeh,27h,5fh,cah,e8h,17h
+			db	cah,11h,06h,55h,67h,21h,9ch,3ch
+			db	97h,ech,8ah,deh,00h,e5h,d1h,21h
+			db	7ch,7bh,47h,ech,b4h,2bh,70h,d6h
+			db	a4h,c2h,e3h,cah,12h,27h,79h,1bh
+			db	65h,0ch,7ah,6bh,f9h,a5h,36h,7fh
+			db	d2h,e9h,8ch,4fh,78h,f6h,a0h,6dh
+			db	8bh,63h,32h,e2h,c6h,2ah,feh,23h
+			db	54h,57h,f7h,dch,a2h,06h,ebh,afh
+			db	d4h,04h,5eh,6ch,95h,8fh,7ch,c0h
+			db	dbh,34h,16h,15h,1ch,09h,94h,ddh
+			db	f5h,91h,0bh,f2h,cch,16h,b3h,3ah
+			db	07h,d6h,f4h,c6h,7bh,55h,3eh,c0h
+			db	70h,0fh,63h,8dh,9ah,47h,1dh,f6h
+			db	6eh,85h,53h,96h,9bh,33h,a2h,1dh
+			db	91h,16h,30h,2fh,5ah,51h,b2h,3eh
+			db	09h,5eh,5ch,c3h,87h,62h,d1h,6ch
+			db	36h,63h,d3h,6bh,2bh,1dh,bfh,5eh
+			db	f1h,27h,17h,f1h,34h,bdh,efh,b0h
+			db	83h,cdh,4ah,48h,dfh,24h,9bh,9fh
+			db	c3h,b4h,c3h,c3h,f4h,1eh,43h,6ah
+			db	8bh,2ch,40h,fdh,60h,90h,f1h,a8h
+			db	0fh,ddh,7eh,45h,11h,d3h,50h,63h
+			db	6ah,74h,d9h,a7h,d4h,04h,d6h,3ch
+			db	ech,66h,b5h,beh,28h,d2h,afh,8bh
+			db	e5h,e7h,86h,63h,b2h,8bh,44h,b1h
+			db	f5h,b8h,bfh,a5h,ech,dch,41h,abh
+			db	bdh,19h,8dh,fdh,46h,a9h,d0h,5ah
+			db	80h,bah,32h,81h,deh,84h,05h,26h
+			db	04h,2dh,c2h,15h,32h,03h,3ch,8bh
+			db	a0h,ceh,49h,96h,80h,a9h,10h,5bh
+			db	7bh,11h,f8h,65h,eah,05h,8ch,79h
+			db	c5h,8ch,ech,46h,d5h,39h,31h,e5h
+			db	8bh,bdh,23h,cbh,79h,cbh,f3h,3ch
+			db	f9h,dch,b8h,c6h,abh,34h,8bh,4fh
+			db	d6h,28h,fah,21h,02h,6bh,3fh,88h
+			db	27h,9ah,deh,9ch,93h,b7h,10h,afh
+			db	76h,50h,1ah,70h,ddh,93h,58h,80h
+			db	a4h,7bh,20h,13h,68h,6ah,e2h,d4h
+			db	46h,69h,06h,aah,c9h,9ah,2ah,57h
+			db	20h,9dh,3eh,4fh,74h,fbh,8ch,dah
+			db	86h,a0h,18h,37h,d7h,47h,25h,30h
+			db	90h,24h,24h,15h,4bh,2bh,c8h,cah
+			db	d0h,3ch,0eh,67h,80h,edh,84h,1dh
+			db	0ch,42h,45h,4fh,a9h,a6h,e8h,6bh
+			db	dfh,dfh,08h,d8h,3dh,42h,d4h,25h
+			db	3dh,30h,97h,07h,b7h,31h,f7h,d0h
+			db	e9h,c1h,ffh,65h,87h,38h,4eh,e3h
+			db	3dh,7eh,66h,53h,35h,62h,f9h,9bh
+			db	a8h,2fh,c6h,96h,1eh,2fh,1eh,6dh
+			db	0dh,59h,0ah,2bh,a1h,f2h,feh,78h
+			db	0ah,8dh,b7h,9fh,fch,dch,40h,4bh
+			db	bah,04h,48h,4fh,26h,cch,20h,d1h
+			db	f7h,eah,beh,62h,03h,6bh,23h,a6h
+			db	a4h,efh,6dh,7ah,07h,d0h,51h,51h
+			db	c9h,3dh,21h,22h,96h,39h,f2h,61h
+			db	e8h,0fh,cch,50h,14h,ceh,68h,3bh
+			db	d7h,feh,3bh,a2h,76h,dfh,2bh,9ah
+			db	21h,5eh,11h,41h,83h,f9h,5dh,b8h
+			db	a4h,3fh,73h,35h,a2h,00h,24h,53h
+			db	fah,9eh,97h,1bh,16h,14h,efh,40h
+			db	52h,c4h,8ah,aah,31h,c1h,12h,27h
+			db	17h,e2h,e8h,86h,a8h,74h,63h,90h
+			db	67h,6bh,b2h,a0h,6fh,1ah,96h,6bh
+			db	f0h,d3h,3fh,bbh,fbh,b5h,1bh,dch
+			db	b0h,8bh,94h,9ch,e6h,55h,41h,0fh
+			db	edh,78h,9bh,d0h,74h,14h,38h,c9h
+			db	77h,67h,deh,b4h,bbh,a6h,60h,5eh
+			db	53h,beh,a6h,39h,c3h,ffh,9bh,c7h
+			db	10h,59h,8dh,d4h,82h,8bh,aah,aah
+			db	bfh,e1h,5bh,a4h,87h,78h,f1h,b5h
+			db	01h,3ah,65h,0ch,86h,44h,91h,21h
+			db	5eh,b9h,4ah,c4h,feh,fdh,86h,64h
+			db	a5h,aah,73h,fdh,0bh,efh,27h,40h
+			db	0bh,12h,e5h,ech,fbh,67h,fbh,e2h
+			db	04h,d2h,32h,36h,4fh,b5h,bch,6fh
+			db	61h,d4h,bch,a5h,d3h,a4h,cch,8ah
+			db	7bh,a5h,92h,54h,6eh,6fh,28h,0ah
+			db	56h,8eh,93h,d4h,4eh,34h,c0h,5ch
+			db	93h,e9h,eah,abh,96h,3dh,fdh,cbh
+			db	1fh,95h,67h,48h,21h,98h,59h,01h
+			db	52h,c2h,c5h,7ch,24h,1dh,deh,71h
+			db	7ch,d4h,b6h,b9h,7dh,b0h,cbh,59h
+			db	e3h,54h,58h,dbh,2dh,afh,38h,09h
+			db	5eh,86h,82h,1bh,99h,a7h,deh,27h
+			db	9eh,ebh,08h,05h,98h,f7h,abh,29h
+			db	bah,5ch,a5h,01h,02h,04h,2eh,c2h
+			db	10h,e5h,8bh,7bh,1ch,b2h,b1h,e6h
+			db	feh,f3h,3ah,d2h,bbh,1ah,03h,a2h
+			db	2ah,53h,3eh,b3h,0ah,1dh,c1h,cch
+			db	62h,c4h,feh,68h,8ch,8ah,46h,81h
+			db	2ch,b5h,a7h,1eh,9ah,fbh,c3h,d6h
+			db	d0h,b4h,94h,1eh,05h,5eh,68h,e5h
+			db	48h,2ch,bbh,08h,2dh,33h,65h,66h
+			db	71h,adh,e0h,4fh,26h,b1h,f9h,51h
+			db	eeh,03h,a6h,b9h,74h,36h,e3h,15h
+			db	19h,85h,f5h,8ch,8ah,71h,adh,63h
+			db	cah,42h,0dh,01h,53h,4bh,8ah,62h
+			db	53h,bah,dah,3ah,4dh,8ch,2eh,50h
+			db	44h,3dh,57h,f1h,39h,81h,2bh,31h
+			db	6ch,91h,78h,b8h,abh,7bh,57h,dch
+			db	40h,3bh,c5h,1fh,cbh,a5h,02h,1dh
+			db	36h,27h,a5h,74h,beh,88h,1bh,e8h
+			db	dfh,6dh,1eh,b3h,1ch,68h,fah,8fh
+			db	b8h,e3h,d1h,5eh,69h,21h,dch,bdh
+			db	9ah,4dh,cdh,70h,a2h,0fh,23h,05h
+			db	c2h,68h,69h,ddh,97h,b6h,1ch,adh
+			db	00h,cbh,ffh,86h,20h,7ch,7ch,9dh
+			db	4bh,9dh,41h,2fh,60h,a6h,c7h,5ah
+			db	d2h,3dh,17h,eeh,63h,bfh,26h,36h
+			db	73h,f6h,c7h,8eh,b3h,eah,7bh,65h
+			db	5fh,b6h,19h,4ah,c7h,b0h,6dh,bdh
+			db	3ah,34h,3dh,f2h,1dh,7eh,32h,29h
+			db	edh,24h,47h,cfh,f6h,18h,3ah,9ah
+			db	80h,e5h,c1h,4bh,6bh,42h,07h,59h
+			db	4bh,66h,1bh,73h,4dh,b9h,b8h,b8h
+			db	66h,dbh,b3h,12h,49h,84h,62h,91h
+			db	9ah,cfh,f8h,20h,37h,6dh,f8h,02h
+			db	fdh,a8h,1ah,a1h,c2h,ceh,25h,03h
+			db	07h,86h,36h,5dh,15h,5ch,8eh,f7h
+			db	81h,a8h,c4h,92h,60h,44h,e4h,70h
+			db	c1h,a5h,19h,16h,4dh,ceh,52h,dbh
+			db	0bh,b6h,7bh,b8h,36h,05h,71h,54h
+			db	71h,e4h,15h,e1h,95h,d4h,fdh,d6h
+			db	05h,a0h,e2h,6fh,a2h,c3h,80h,96h
+			db	aah,b6h,93h,bah,86h,28h,9bh,8bh
+			db	d5h,a0h,c5h,b8h,5eh,feh,a2h,30h
+			db	f7h,3fh,7fh,01h,5eh,79h,57h,11h
+			db	1eh,bbh,fah,8fh,d4h,5fh,40h,12h
+			db	b8h,0fh,b5h,d9h,efh,cbh,b9h,a7h
+			db	dfh,d3h,f6h,9bh,21h,91h,61h,e3h
+			db	97h,1dh,6ch,d6h,eah,72h,42h,80h
+			db	a6h,82h,04h,a3h,1fh,6fh,a4h,53h
+			db	fah,d2h,97h,61h,34h,a1h,33h,26h
+			db	b9h,40h,1ch,5dh,78h,41h,9ch,bah
+			db	e7h,25h,75h,55h,4ah,3fh,7ch,d7h
+			db	7eh,2ch,f7h,a9h,68h,8eh,0bh,3ah
+			db	33h,93h,3eh,a0h,d4h,17h,efh,a0h
+			db	76h,6ch,93h,73h,8dh,14h,3bh,6ch
+			db	b5h,97h,c0h,85h,8dh,88h,dch,efh
+			db	a5h,21h,e8h,ech,4ch,35h,49h,b2h
+			db	abh,5dh,a3h,18h,12h,c3h,89h,8dh
+			db	2ch,8ch,e0h,d0h,05h,8fh,b1h,9dh
+			db	d5h,4dh,94h,85h,5fh,04h,44h,3eh
+			db	c7h,1bh,92h,71h,73h,82h,a4h,8ch
+			db	2ch,50h,97h,a3h,60h,2fh,77h,9ch
+			db	fch,47h,efh,5ah,6bh,2fh,0eh,0dh
+			db	5bh,a4h,9ah,eah,a0h,2fh,85h,34h
+			db	6bh,06h,f6h,2ah,c0h,ffh,d0h,1fh
+			db	bdh,93h,03h,31h,56h,aah,6eh,0ah
+			db	a4h,f3h,c8h,78h,4fh,a7h,0eh,96h
+			db	a5h,ffh,68h,afh,dah,b9h,a8h,95h
+			db	f3h,53h,8ah,47h,67h,1eh,97h,78h
+			db	0eh,8fh,aah,fah,cdh,c5h,8ch,10h
+			db	9bh,8ah,06h,78h,ceh,cah,efh,29h
+			db	26h,66h,3eh,8ch,eeh,adh,80h,bbh
+			db	77h,81h,50h,eah,92h,cah,4ch,78h
+			db	04h,26h,47h,b3h,11h,b2h,74h,bah
+			db	f4h,92h,6dh,c5h,90h,49h,a1h,e3h
+			db	fdh,a1h,07h,5ah,a7h,22h,f9h,4bh
+			db	aeh,c7h,ech,32h,f2h,dch,2ch,b0h
+			db	c5h,6ah,7fh,56h,48h,9ch,64h,09h
+			db	dah,69h,f4h,25h,4fh,d2h,92h,f9h
+			db	8fh,dfh,16h,e1h,32h,42h,0fh,9eh
+			db	6dh,b9h,deh,72h,83h,9eh,f2h,d8h
+			db	e0h,52h,6dh,83h,a8h,98h,83h,7bh
+			db	b4h,f8h,0bh,39h,61h,33h,83h,cch
+			db	6dh,31h,03h,02h,f5h,b6h,f8h,7eh
+			db	47h,73h,a2h,afh,dch,45h,ddh,44h
+			db	b5h,61h,9ah,58h,b5h,e3h,c6h,00h
+			db	d7h,95h,07h,32h,70h,adh,18h,3ah
+			db	dbh,1ch,b4h,e4h,22h,49h,8dh,11h
+			db	c7h,e6h,19h,58h,c1h,f7h,10h,beh
+			db	f9h,6fh,31h,d3h,70h,c3h,18h,48h
+			db	b3h,34h,5ah,dch,2ch,06h,89h,e8h
+			db	ceh,0ch,b8h,55h,f1h,56h,4ch,91h
+			db	ffh,14h,3eh,6dh,90h,00h,26h,32h
+			db	e7h,aah,3ah,5fh,eeh,79h,fbh,1ch
+			db	f0h,7ah,eah,2bh,7fh,92h,a8h,ffh
+			db	06h,f0h,61h,4bh,bbh,61h,7fh,9ah
+			db	dch,77h,41h,2dh,c3h,adh,b3h,e8h
+			db	c8h,eah,5ah,f0h,17h,3dh,a1h,aah
+			db	75h,3bh,3ah,49h,3eh,14h,1fh,feh
+			db	c1h,84h,00h,58h,5dh,36h,02h,0ch
+			db	95h,1dh,35h,1fh,fah,d6h,d3h,9bh
+			db	adh,98h,3eh,51h,59h,72h,29h,92h
+			db	46h,14h,bah,71h,82h,3ah,24h,ceh
+			db	7dh,76h,a9h,63h,8bh,ceh,fbh,f8h
+			db	8dh,dch,18h,2ch,6ah,6ah,d3h,e0h
+			db	deh,c8h,46h,dah,82h,aah,2eh,f7h
+			db	d1h,57h,5ch,64h,69h,72h,bdh,2eh
+			db	03h,59h,a2h,d2h,d8h,46h,40h,08h
+			db	73h,7fh,c2h,46h,e3h,ebh,a5h,adh
+			db	efh,99h,99h,fch,5ah,5ah,71h,d7h
+			db	14h,40h,feh,feh,03h,d2h,f6h,5bh
+			db	74h,aah,f8h,3fh,81h,c0h,bch,a4h
+			db	efh,7bh,2eh,8ah,50h,63h,85h,63h
+			db	2fh,05h,61h,44h,08h,deh,3fh,68h
+			db	4ah,86h,3fh,d8h,7fh,91h,dch,a9h
+			db	56h,a4h,fbh,23h,83h,8ch,d9h,efh
+			db	51h,ach,75h,85h,d7h,56h,2fh,f8h
+			db	efh,eah,edh,58h,93h,e2h,21h,a3h
+			db	fch,edh,83h,aah,bfh,fch,eah,d6h
+			db	84h,c1h,f6h,5fh,b4h,92h,1ah,35h
+			db	6ch,96h,91h,1dh,60h,a0h,0bh,a1h
+			db	ffh,9bh,7ch,9eh,feh,f6h,49h,b4h
+			db	a6h,8ch,feh,1eh,07h,46h,94h,67h
+			db	a5h,cfh,37h,6eh,36h,13h,dbh,beh
+			db	4dh,28h,a5h,50h,40h,7ch,59h,b5h
+			db	ech,8eh,c0h,fah,65h,8ch,a1h,1dh
+			db	31h,4fh,d1h,f3h,2bh,f9h,6dh,b9h
+			db	cah,cch,6ah,41h,cch,ach,1eh,59h
+			db	ceh,b2h,e4h,f0h,c3h,7fh,a2h,89h
+			db	33h,a3h,d6h,32h,cah,e0h,fah,85h
+			db	7ch,7eh,fch,7bh,e6h,57h,02h,1dh
+			db	c0h,0fh,62h,12h,2eh,6dh,19h,31h
+			db	79h,80h,2ah,9ch,25h,12h,2eh,aeh
+			db	14h,66h,ech,cbh,51h,b4h,89h,1ch
+			db	1eh,87h,f1h,15h,2fh,2ah,1bh,bbh
+			db	c4h,c5h,d5h,5ah,f3h,9ah,d4h,29h
+			db	75h,ech,fbh,b4h,d0h,37h,b5h,ach
+			db	e1h,67h,98h,92h,e1h,69h,a7h,9ah
+			db	01h,dch,55h,15h,61h,d6h,21h,5fh
+			db	9dh,9fh,88h,21h,68h,c6h,1ch,06h
+			db	ech,e7h,18h,39h,84h,53h,62h,54h
+			db	96h,38h,2ch,f4h,cch,93h,38h,b7h
+			db	58h,01h,02h,f4h,61h,bdh,5ah,36h
+			db	3fh,d4h,f9h,83h,01h,28h,fbh,e4h
+			db	3dh,3ch,dbh,6bh,a8h,e7h,dfh,18h
+			db	27h,d4h,2ah,84h,f9h,8ch,47h,1bh
+			db	77h,28h,84h,4fh,92h,9ah,12h,7ch
+			db	1ch,31h,53h,a6h,37h,b6h,d7h,05h
+			db	e9h,14h,73h,7ch,9bh,45h,2eh,c8h
+			db	17h,10h,03h,53h,86h,93h,d4h,63h
+			db	feh,24h,8dh,52h,a7h,68h,c7h,2dh
+			db	11h,72h,06h,d4h,43h,fch,81h,73h
+			db	7fh,ceh,0fh,12h,2eh,27h,f0h,f6h
+			db	c2h,9fh,c6h,98h,0dh,33h,14h,3fh
+			db	eeh,22h,aeh,24h,25h,3fh,c7h,feh
+			db	22h,0eh,99h,86h,56h,4fh,95h,a9h
+			db	61h,c9h,1dh,87h,5eh,d9h,7ah,73h
+			db	43h,b6h,7ah,85h,4fh,f5h,eah,83h
+			db	15h,a7h,b9h,b7h,9eh,f9h,fdh,70h
+			db	fch,2ah,34h,ach,97h,d7h,d6h,3ch
+			db	bbh,77h,64h,58h,01h,36h,14h,a1h
+			db	73h,f0h,04h,58h,90h,c3h,52h,11h
+			db	94h,dah,67h,21h,63h,70h,dfh,fch
+			db	a9h,16h,a8h,a9h,0dh,deh,4bh,f0h
+			db	4bh,61h,b0h,dfh,89h,9ch,77h,96h
+			db	7bh,f5h,ddh,e6h,52h,d1h,e0h,40h
+			db	d2h,6ch,d7h,f7h,78h,afh,12h,4eh
+			db	63h,bfh,72h,b5h,8ah,d8h,deh,7ch
+			db	c5h,bfh,40h,a3h,48h,8eh,7bh,bfh
+			db	2fh,bch,74h,c2h,a1h,c7h,9ch,66h
+			db	9ah,78h,77h,8ch,09h,83h,c2h,85h
+			db	f6h,f8h,ech,3ch,c8h,99h,b7h,cah
+			db	69h,0ch,e6h,9ch,cch,2eh,54h,6dh
+			db	57h,0ch,e0h,f8h,5ch,95h,f8h,c2h
+			db	ddh,bch,5ah,33h,67h,8fh,71h,8ah
+			db	ffh,d7h,a7h,95h,66h,4fh,afh,6fh
+			db	9ah,5bh,f6h,0dh,e5h,2ah,73h,3ch
+			db	3eh,2bh,a5h,42h,aeh,b2h,6ch,38h
+			db	70h,78h,c5h,a8h,c1h,c7h,57h,72h
+			db	3ah,e7h,36h,57h,4dh,b0h,88h,c9h
+			db	a7h,a1h,fah,5bh,10h,04h,9bh,70h
+			db	bah,cdh,41h,23h,7dh,bah,8ch,a3h
+			db	0eh,12h,66h,32h,51h,20h,44h,ach
+			db	ech,82h,d2h,60h,4ah,35h,40h,2ch
+			db	21h,10h,82h,0ch,21h,17h,49h,94h
+			db	b3h,2ch,0fh,cfh,01h,b7h,26h,cdh
+			db	d9h,c3h,d2h,fch,44h,f5h,17h,83h
+			db	aah,05h,77h,72h,51h,21h,cfh,5bh
+			db	7ah,40h,efh,fdh,09h,a0h,5ah,15h
+			db	c0h,5fh,13h,87h,bdh,72h,22h,85h
+			db	c9h,31h,e6h,1dh,1fh,43h,1bh,d7h
+			db	23h,9eh,16h,04h,0ch,78h,f0h,b9h
+			db	4ch,e0h,eeh,a4h,3ah,bch,e6h,5fh
+			db	52h,e9h,15h,b5h,6dh,29h,6fh,aeh
+			db	48h,66h,4ah,41h,bdh,43h,a3h,76h
+			db	60h,f0h,57h,cdh,86h,0ah,8ch,38h
+			db	59h,4ch,cah,89h,28h,dbh,70h,e5h
+			db	f7h,c2h,2eh,5ch,d2h,6ch,23h,a6h
+			db	40h,86h,9bh,8ch,ceh,86h,b2h,53h
+			db	f1h,f0h,d7h,21h,8ch,95h,d8h,0dh
+			db	9ch,09h,4bh,7fh,11h,a0h,7ch,4eh
+			db	1bh,c9h,4dh,16h,9ch,15h,75h,f5h
+			db	03h,95h,70h,91h,33h,0eh,5bh,31h
+			db	adh,efh,e8h,e3h,d5h,22h,18h,2dh
+			db	e6h,46h,c6h,b8h,09h,69h,cdh,d1h
+			db	2ch,b0h,2ah,a8h,30h,70h,48h,c6h
+			db	93h,86h,e7h,70h,1ch,23h,16h,3bh
+			db	6bh,89h,d6h,eeh,6fh,4ch,9dh,13h
+			db	55h,5dh,92h,82h,60h,80h,9bh,d9h
+			db	ceh,7fh,70h,e3h,39h,e3h,35h,15h
+			db	eah,ffh,45h,beh,a3h,1ch,9eh,91h
+			db	cbh,8ch,3ch,b7h,93h,8fh,bch,74h
+			db	c2h,19h,d5h,06h,94h,81h,9dh,bfh
+			db	e1h,eah,58h,21h,78h,14h,99h,64h
+			db	38h,4ch,e9h,beh,17h,d0h,b2h,b5h
+			db	8fh,6ah,f8h,f4h,f4h,c9h,d8h,55h
+			db	26h,08h,d4h,41h,99h,2bh,02h,0ch
+			db	42h,19h,35h,88h,6ah,f7h,f4h,5ah
+			db	34h,6ah,3fh,55h,48h,f7h,adh,a0h
+			db	0fh,57h,09h,4ah,85h,eeh,43h,c4h
+			db	c1h,c5h,2eh,f0h,2bh,edh,94h,d9h
+			db	65h,60h,b6h,7fh,ech,a8h,b3h,30h
+			db	d1h,3bh,f5h,96h,18h,55h,89h,aeh
+			db	8dh,6ah,8fh,adh,87h,1fh,e3h,03h
+			db	ceh,3fh,f5h,efh,03h,5ah,91h,6eh
+			db	74h,1ch,dah,6ch,54h,bch,b9h,ach
+			db	39h,a3h,a5h,74h,90h,32h,bbh,e8h
+			db	5ch,c4h,53h,29h,a2h,ebh,aeh,f7h
+			db	d8h,97h,41h,63h,a7h,3dh,2fh,91h
+			db	a7h,50h,71h,4ah,2ah,e8h,b3h,4bh
+			db	63h,22h,75h,4eh,75h,68h,31h,ceh
+			db	d9h,32h,51h,1bh,a4h,25h,f1h,beh
+			db	cdh,fch,29h,81h,29h,39h,b5h,79h
+			db	6ah,ebh,fch,3dh,e6h,63h,0eh,48h
+			db	79h,68h,44h,42h,0ch,e7h,7ch,ddh
+			db	ceh,cfh,f6h,56h,25h,ebh,8ah,14h
+			db	5bh,66h,39h,57h,8ch,74h,44h,c2h
+			db	aah,55h,b1h,a7h,84h,c7h,2ch,0fh
+			db	08h,1bh,a5h,17h,fch,2fh,5ch,72h
+			db	0ch,91h,d5h,bbh,5bh,6dh,40h,9fh
+			db	2ch,8fh,13h,22h,e0h,31h,58h,31h
+			db	10h,d3h,8eh,13h,cfh,e0h,9bh,a9h
+			db	69h,2bh,c4h,46h,7dh,82h,e7h,06h
+			db	3eh,4bh,0ah,02h,dch,3fh,59h,a1h
+			db	efh,0ch,28h,00h,5fh,03h,49h,13h
+			db	7fh,2bh,c8h,37h,07h,6dh,eah,54h
+			db	d2h,feh,d7h,84h,31h,95h,bah,16h
+			db	dfh,ebh,c9h,d2h,f6h,1ah,78h,35h
+			db	07h,68h,01h,b1h,97h,11h,32h,47h
+			db	e4h,92h,46h,d3h,50h,4fh,24h,feh
+			db	b4h,27h,42h,adh,edh,70h,c0h,4ah
+			db	e0h,51h,50h,81h,33h,59h,b5h,11h
+			db	90h,67h,9dh,3bh,a1h,5bh,b1h,81h
+			db	01h,9ah,35h,30h,d5h,e0h,d3h,43h
+			db	fah,73h,99h,beh,f5h,08h,c4h,37h
+			db	1ah,7fh,a4h,79h,47h,deh,65h,24h
+			db	92h,96h,19h,18h,a0h,03h,dfh,a6h
+			db	51h,a1h,7fh,3eh,4fh,45h,fbh,c0h
+			db	d8h,7dh,27h,98h,39h,11h,b8h,a1h
+			db	35h,83h,e0h,f0h,e3h,3ch,4fh,37h
+			db	1ch,4dh,2fh,46h,a9h,78h,20h,b1h
+			db	9bh,69h,46h,01h,2eh,4fh,19h,a7h
+			db	d9h,46h,31h,57h,4fh,15h,04h,fch
+			db	26h,55h,38h,47h,26h,55h,63h,edh
+			db	e6h,29h,1ch,2eh,40h,d3h,bbh,89h
+			db	7ah,b5h,e6h,9ch,deh,d4h,3ch,b1h
+			db	0ah,edh,f6h,deh,dbh,d0h,aah,d4h
+			db	25h,06h,c0h,b9h,26h,cdh,61h,f3h
+			db	11h,e4h,a3h,37h,d5h,fdh,c6h,1bh
+			db	0eh,fbh,17h,e6h,b9h,b4h,eah,94h
+			db	96h,76h,a2h,bdh,23h,55h,09h,bah
+			db	c6h,2dh,43h,d3h,deh,afh,bah,67h
+			db	88h,c3h,37h,85h,2dh,17h,89h,8bh
+			db	bbh,f9h,7fh,4bh,f3h,f9h,beh,e2h
+			db	37h,32h,1bh,f9h,a6h,25h,5eh,23h
+			db	8ch,6fh,67h,58h,bfh,46h,4eh,f4h
+			db	1bh,96h,51h,aeh,65h,a7h,b9h,d5h
+			db	56h,aeh,63h,27h,dfh,8eh,92h,e5h
+			db	05h,dch,45h,fah,fdh,a7h,b7h,44h
+			db	9bh,8eh,68h,80h,07h,4fh,67h,8bh
+			db	79h,3ah,a0h,93h,d9h,6ch,cah,7bh
+			db	13h,7fh,50h,b3h,3fh,74h,5eh,0bh
+			db	c8h,80h,1fh,22h,35h,81h,d4h,25h
+			db	4fh,49h,ffh,8bh,74h,3ch,2eh,08h
+			db	aeh,2bh,27h,d7h,64h,01h,81h,98h
+			db	b7h,e7h,c9h,9dh,cah,c9h,44h,a6h
+			db	8ch,c4h,05h,8dh,74h,d1h,fdh,a7h
+			db	f3h,b6h,e8h,19h,47h,66h,d9h,0fh
+			db	15h,1ch,b4h,29h,09h,e7h,6eh,dah
+			db	deh,87h,31h,bch,30h,23h,a5h,aah
+			db	5fh,14h,0eh,12h,34h,a0h,81h,c6h
+			db	98h,6fh,1ah,cch,efh,6eh,ach,20h
+			db	98h,b9h,bbh,46h,5bh,50h,deh,c2h
+			db	3dh,1fh,0ah,99h,39h,c8h,22h,0bh
+			db	f7h,c2h,38h,77h,4fh,c4h,97h,afh
+			db	6ch,7ch,23h,e9h,27h,7ah,ddh,d2h
+			db	cah,33h,a4h,f3h,20h,44h,ceh,72h
+			db	29h,53h,15h,65h,78h,50h,fbh,aeh
+			db	b2h,2eh,c3h,21h,1fh,7ah,6fh,f4h
+			db	1dh,5ah,07h,9ch,a2h,45h,07h,b7h
+			db	39h,ebh,45h,e6h,a3h,39h,36h,61h
+			db	10h,70h,00h,76h,58h,e5h,f5h,d0h
+			db	0ch,9fh,c3h,ach,51h,e4h,05h,a2h
+			db	40h,68h,ddh,fch,72h,50h,96h,77h
+			db	3dh,dch,13h,5fh,32h,dch,22h,95h
+			db	51h,e6h,42h,ach,19h,79h,6ch,f8h
+			db	d6h,63h,49h,52h,98h,b1h,0ch,32h
+			db	9dh,dfh,86h,a6h,18h,2fh,9bh,1ch
+			db	ach,e4h,a0h,6ch,43h,0bh,0bh,89h
+			db	c8h,4eh,91h,0ah,3fh,6ch,56h,c9h
+			db	17h,d2h,0eh,ebh,d0h,7ah,57h,95h
+			db	49h,d5h,c3h,3eh,a9h,e3h,d2h,49h
+			db	a9h,aah,10h,41h,0ch,38h,ceh,4bh
+			db	0ch,cbh,dbh,24h,e2h,42h,3eh,d8h
+			db	2dh,62h,4eh,aah,e1h,afh,7fh,19h
+			db	a6h,0fh,c3h,12h,dbh,81h,e0h,67h
+			db	3eh,42h,90h,25h,44h,ceh,c8h,c7h
+			db	6ch,67h,b7h,83h,32h,71h,66h,67h
+			db	f6h,71h,7dh,f7h,4ch,dbh,b9h,dch
+			db	36h,a4h,14h,f2h,5dh,01h,86h,0dh
+			db	f3h,7bh,c0h,0ch,ach,53h,bdh,49h
+			db	d9h,4fh,06h,68h,13h,59h,8dh,17h
+			db	99h,dch,fbh,cbh,90h,bah,f7h,d8h
+			db	17h,ceh,8ah,0fh,1fh,bbh,07h,c6h
+			db	17h,d3h,b8h,e7h,5dh,96h,6eh,17h
+			db	a7h,64h,80h,91h,f6h,a6h,bbh,29h
+			db	e4h,5ch,07h,66h,0fh,92h,8fh,6dh
+			db	40h,4ah,2dh,19h,64h,c2h,25h,a9h
+			db	83h,1fh,83h,93h,0fh,2ah,ddh,19h
+			db	42h,5eh,b4h,aah,24h,1fh,84h,5eh
+			db	6ah,16h,0dh,0eh,26h,ffh,54h,b3h
+			db	2eh,34h,d9h,c5h,b9h,87h,a4h,04h
+			db	2bh,58h,52h,9eh,9bh,76h,1fh,05h
+			db	28h,b4h,3bh,49h,9eh,89h,47h,65h
+			db	41h,51h,bdh,fbh,bch,e2h,35h,1dh
+			db	ffh,c6h,efh,a5h,8ah,52h,cdh,54h
+			db	fch,36h,b8h,b4h,47h,03h,13h,42h
+			db	b4h,c7h,1ah,1eh,84h,c8h,e9h,00h
+			db	92h,86h,35h,efh,c7h,22h,69h,eah
+			db	c7h,fdh,cdh,6eh,f6h,aah,f4h,cbh
+			db	ach,71h,4bh,1ah,2ah,67h,69h,c2h
+			db	abh,38h,5ah,dah,5bh,33h,93h,b9h
+			db	10h,8ch,60h,cah,8fh,c3h,f9h,b0h
+			db	28h,57h,dch,c5h,5dh,beh,5bh,60h
+			db	5fh,bah,14h,23h,bch,a3h,abh,a4h
+			db	ach,a8h,3dh,80h,31h,26h,46h,26h
+			db	beh,62h,a7h,2bh,45h,6bh,cfh,ech
+			db	b8h,ach,67h,67h,06h,87h,b7h,2bh
+			db	f3h,feh,97h,37h,64h,9ch,b5h,2dh
+			db	dah,d0h,cah,61h,16h,f0h,80h,99h
+			db	fbh,fbh,f6h,7eh,34h,f7h,84h,fch
+			db	63h,34h,cdh,d2h,82h,a2h,5fh,aeh
+			db	bbh,a7h,c3h,8eh,2eh,31h,cch,e7h
+			db	a9h,5bh,b4h,fch,5bh,d0h,1eh,cbh
+			db	7bh,03h,deh,0ah,b6h,8dh,83h,96h
+			db	3ah,6ah,f0h,8fh,d4h,2ch,2ah,bah
+			db	49h,08h,dfh,5fh,70h,73h,0ch,cah
+			db	43h,37h,d0h,dch,10h,d3h,5bh,81h
+			db	71h,7ah,8bh,8fh,45h,5ah,a6h,a7h
+			db	2eh,38h,39h,e3h,ffh,e6h,49h,06h
+			db	f0h,ebh,81h,04h,77h,e3h,f8h,e4h
+			db	2bh,efh,51h,e0h,c9h,02h,a2h,bdh
+			db	32h,e1h,abh,edh,cbh,83h,54h,b8h
+			db	46h,f1h,7ch,beh,0ah,39h,f5h,19h
+			db	54h,50h,aeh,59h,57h,90h,49h,18h
+			db	04h,66h,35h,60h,85h,21h,b7h,1ah
+			db	5ch,3ah,85h,70h,c7h,a5h,18h,8bh
+			db	d9h,21h,95h,6dh,deh,d5h,85h,16h
+			db	8eh,53h,28h,dbh,a1h,23h,2dh,2dh
+			db	53h,6eh,0ah,b7h,aeh,61h,36h,d5h
+			db	dah,82h,6ah,3bh,2ah,4fh,09h,8dh
+			db	89h,abh,1ah,a1h,e8h,22h,2dh,07h
+			db	cdh,d3h,95h,2ch,09h,0dh,d8h,11h
+			db	c1h,bah,d2h,e0h,adh,ffh,f5h,deh
+			db	60h,2fh,51h,95h,85h,73h,f8h,56h
+			db	edh,29h,c8h,1eh,a1h,a3h,d2h,6eh
+			db	83h,efh,dch,01h,96h,dah,05h,aah
+			db	ffh,35h,74h,bah,c4h,e4h,dah,34h
+			db	dfh,5ch,0bh,bfh,5dh,a5h,5fh,1ah
+			db	b5h,30h,28h,41h,86h,b0h,25h,04h
+			db	fah,60h,69h,11h,46h,55h,2dh,1ch
+			db	1ah,6ah,1dh,54h,3ah,e4h,e3h,c6h
+			db	f4h,09h,2fh,b0h,4dh,5dh,32h,5dh
+			db	afh,f0h,beh,eeh,20h,c3h,5fh,aah
+			db	54h,e7h,3eh,2dh,b1h,d7h,c4h,49h
+			db	77h,d9h,d3h,48h,24h,ffh,5bh,77h
+			db	01h,a0h,a3h,32h,b8h,cah,20h,32h
+			db	fch,28h,34h,d4h,b4h,15h,f3h,84h
+			db	4fh,53h,e0h,deh,85h,f7h,4dh,0ah
+			db	41h,e7h,21h,9fh,60h,a7h,57h,fdh
+			db	9dh,4dh,86h,22h,64h,7ch,6eh,adh
+			db	28h,cdh,65h,b2h,62h,58h,a7h,cah
+			db	feh,eah,03h,b4h,e2h,3ch,cbh,6eh
+			db	09h,6dh,7fh,0eh,b7h,54h,1eh,66h
+			db	36h,b8h,20h,70h,7ch,67h,e4h,0ah
+			db	fch,c5h,adh,75h,27h,91h,b5h,ddh
+			db	83h,7ah,6ch,17h,e5h,92h,7eh,19h
+			db	ebh,fch,b9h,20h,88h,75h,f3h,e0h
+			db	fbh,9fh,8ch,31h,79h,e0h,afh,bbh
+			db	21h,e4h,a3h,0fh,2bh,74h,97h,d5h
+			db	f3h,f8h,0dh,a4h,1ch,7bh,23h,0dh
+			db	8ah,b9h,57h,2eh,84h,5ah,aah,98h
+			db	77h,95h,b8h,07h,1fh,2eh,b0h,03h
+			db	97h,d9h,adh,32h,0eh,09h,cfh,27h
+			db	4dh,78h,30h,48h,0dh,49h,97h,cch
+			db	7dh,bah,bch,fbh,a2h,17h,18h,42h
+			db	e5h,7dh,d6h,78h,58h,fch,66h,94h
+			db	21h,4ch,ach,1fh,dbh,f4h,dch,2bh
+			db	e7h,aah,d8h,1eh,11h,78h,bfh,6ch
+			db	beh,fbh,85h,f3h,adh,4eh,96h,4dh
+			db	dbh,8dh,c1h,c4h,2ch,edh,d9h,4bh
+			db	35h,4dh,7fh,13h,5ah,4ch,1eh,38h
+			db	15h,d2h,efh,97h,85h,deh,7bh,85h
+			db	8ah,35h,40h,73h,cah,a7h,a0h,02h
+			db	8eh,82h,32h,21h,29h,52h,63h,19h
+			db	4eh,02h,92h,a8h,b7h,65h,45h,bah
+			db	19h,76h,07h,23h,44h,fbh,8eh,1ch
+			db	adh,d6h,a1h,a4h,cch,f1h,a5h,87h
+			db	a7h,c6h,95h,f3h,11h,99h,40h,ddh
+			db	97h,92h,82h,d5h,9ah,e3h,3fh,2ah
+			db	a8h,52h,46h,2dh,30h,aah,4ah,6ch
+			db	a7h,4ah,56h,8ch,afh,85h,e5h,b1h
+			db	7ah,03h,20h,41h,06h,c8h,64h,7dh
+			db	2eh,8fh,fdh,a3h,7dh,01h,4ch,72h
+			db	b1h,c9h,63h,9dh,ffh,82h,d4h,dch
+			db	0dh,fbh,48h,26h,5eh,33h,4ah,1bh
+			db	6eh,18h,05h,d9h,0dh,56h,8eh,a2h
+			db	b6h,45h,b7h,17h,4ch,8bh,beh,1bh
+			db	44h,68h,ech,41h,aeh,24h,ach,1fh
+			db	b3h,32h,f0h,7dh,27h,22h,87h,86h
+			db	f4h,a8h,04h,ech,6eh,38h,b6h,30h
+			db	d3h,fdh,96h,26h,0fh,cfh,13h,9fh
+			db	0bh,d9h,81h,beh,91h,cbh,5ah,0dh
+			db	13h,1bh,38h,81h,7fh,8ch,64h,c4h
+			db	2fh,86h,1ch,15h,68h,b1h,0eh,23h
+			db	99h,cbh,b5h,4bh,6bh,67h,d1h,d1h
+			db	66h,d5h,11h,ffh,ebh,2eh,54h,81h
+			db	1dh,f1h,70h,3ah,9dh,0fh,8ch,2ch
+			db	d6h,a1h,e1h,6dh,85h,96h,69h,aah
+			db	3eh,8fh,c9h,f5h,79h,32h,ech,36h
+			db	90h,c0h,c1h,67h,25h,40h,87h,5dh
+			db	d9h,0ah,0dh,88h,d4h,80h,24h,75h
+			db	cdh,e3h,14h,c9h,98h,73h,cdh,2eh
+			db	f7h,3eh,b8h,54h,64h,04h,31h,0ch
+			db	c1h,15h,0fh,8bh,21h,c5h,dah,81h
+			db	7bh,05h,d3h,e2h,9ah,10h,51h,e1h
+			db	6dh,51h,0eh,4eh,20h,cch,2ch,01h
+			db	b9h,90h,86h,35h,4ah,a3h,e5h,18h
+			db	82h,98h,9fh,a9h,f7h,f2h,f3h,e3h
+			db	0ah,c2h,bdh,cbh,a1h,80h,1eh,7bh
+			db	b3h,2ah,8ah,b0h,8fh,56h,d7h,6ch
+			db	adh,a8h,0ch,65h,17h,43h,6dh,2fh
+			db	d2h,03h,e0h,06h,66h,16h,4ch,43h
+			db	c6h,20h,9eh,d0h,8bh,26h,fah,8fh
+			db	aah,22h,f7h,3dh,c9h,0fh,68h,cch
+			db	a8h,f0h,88h,99h,2ah,0ah,2dh,70h
+			db	66h,7fh,0dh,abh,04h,07h,77h,e8h
+			db	b7h,b9h,59h,35h,80h,fah,dfh,66h
+			db	c7h,aah,85h,69h,94h,4bh,07h,7ch
+			db	89h,7bh,50h,a6h,50h,31h,feh,5fh
+			db	84h,6dh,e5h,cdh,e9h,46h,ach,94h
+			db	efh,08h,abh,54h,09h,2ch,62h,64h
+			db	46h,4ch,f7h,28h,1eh,86h,17h,a1h
+			db	18h,2eh,85h,a9h,abh,5dh,74h,ebh
+			db	dfh,9bh,c0h,bbh,b8h,c7h,c2h,d5h
+			db	c2h,d2h,1bh,b7h,40h,35h,8ch,e0h
+			db	16h,d3h,22h,d6h,54h,77h,1dh,0ah
+			db	d0h,06h,65h,2bh,a6h,b5h,08h,b9h
+			db	9fh,8bh,8fh,dbh,91h,eeh,75h,62h
+			db	1fh,6fh,2bh,e3h,c7h,4fh,2eh,8dh
+			db	0fh,11h,22h,04h,88h,fbh,b7h,bch
+			db	b8h,72h,44h,67h,54h,5eh,4fh,ebh
+			db	bdh,06h,9ah,7ch,60h,abh,f8h,a6h
+			db	7bh,c0h,92h,afh,afh,f5h,4eh,39h
+			db	6eh,92h,7dh,8eh,feh,7ah,12h,08h
+			db	2ah,43h,c1h,fch,1dh,2eh,b8h,2dh
+			db	38h,8eh,30h,14h,f5h,91h,59h,84h
+			db	3ah,45h,beh,7fh,1dh,e5h,27h,f8h
+			db	75h,95h,66h,88h,0ah,58h,aeh,2dh
+			db	4eh,1ah,7dh,83h,83h,e4h,e7h,b6h
+			db	d9h,ddh,96h,fah,08h,26h,fah,58h
+			db	6dh,1fh,e8h,21h,87h,58h,39h,eah
+			db	ceh,feh,5fh,80h,19h,6fh,e7h,23h
+			db	e9h,3dh,8ah,2eh,fch,b4h,0ch,57h
+			db	f6h,deh,5ch,f2h,33h,32h,6ah,abh
+			db	e8h,abh,f5h,54h,e1h,15h,d4h,86h
+			db	d8h,71h,3dh,75h,18h,1bh,a9h,00h
+			db	dch,6ah,69h,11h,60h,0dh,14h,85h
+			db	3bh,3dh,9bh,7eh,1eh,23h,e8h,b5h
+			db	cah,fdh,8fh,3dh,9ah,4dh,87h,0fh
+			db	6dh,d7h,c8h,07h,c1h,d1h,b0h,ceh
+			db	b2h,04h,14h,7eh,b3h,e9h,61h,fch
+			db	b5h,fch,41h,5fh,b7h,80h,9bh,c9h
+			db	45h,b2h,c7h,abh,3bh,3eh,dbh,26h
+			db	35h,00h,41h,23h,7fh,cbh,cch,94h
+			db	05h,1ch,fdh,26h,12h,47h,23h,f0h
+			db	e6h,4fh,1eh,65h,7eh,d8h,3eh,34h
+			db	09h,adh,5eh,47h,73h,ech,7ch,15h
+			db	44h,e5h,b5h,deh,d5h,9eh,efh,9fh
+			db	66h,d5h,deh,b0h,edh,12h,44h,64h
+			db	c9h,ddh,66h,6ah,92h,4dh,2bh,02h
+			db	24h,b6h,1eh,b6h,6dh,e1h,3ch,b9h
+			db	5bh,e3h,d4h,6fh,b0h,c6h,6ah,fch
+			db	f6h,a4h,09h,3ah,d3h,ffh,39h,48h
+			db	08h,6bh,32h,11h,e0h,a5h,16h,4dh
+			db	08h,e2h,e7h,36h,97h,d2h,e1h,b9h
+			db	a8h,f3h,c4h,e5h,f6h,1ch,23h,c2h
+			db	82h,bch,45h,d1h,1eh,d9h,adh,60h
+			db	5bh,28h,d1h,7fh,58h,40h,cdh,aeh
+			db	0eh,53h,bfh,12h,71h,42h,56h,4fh
+			db	3ah,68h,42h,52h,feh,31h,b5h,62h
+			db	a5h,93h,b6h,73h,3ah,26h,f3h,87h
+			db	0bh,d1h,14h,34h,47h,4bh,8ah,d7h
+			db	aeh,c5h,1bh,c0h,f1h,19h,d2h,0bh
+			db	b8h,89h,dch,b3h,06h,cbh,03h,80h
+			db	deh,65h,f5h,4dh,90h,e1h,f8h,c7h
+			db	8eh,0ah,76h,f0h,cah,40h,eah,4eh
+			db	7ah,ach,deh,8eh,00h,75h,05h,11h
+			db	6fh,5bh,54h,1eh,bbh
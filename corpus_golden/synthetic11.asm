@@ -0,0 +1,18268 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	1ch,07h,52h,3dh,bdh,50h,7bh,35h
+			db	8bh,1dh,91h,69h
+
+start:						; execution starting point
+			dec	sp
+			adc	a,e
+			sub	d
+			ld	sp,hl
+			cp	c
+			ex	af,af'
+			add	hl,de
+			ld	(hl),b
+			ld	b,d
+			add	a,e
+			ld	(hl),a
+			sbc	a,c
+			ld	e,l
+			scf
+			adc	a,a
+			or	d
+			ld	c,h
+			or	a
+			jp	z,L516f
+			ld	b,a
+			push	af
+			rr	e
+			add	a,(hl)
+			ld	l,d
+			inc	a
+			rst	20h
+			xor	l
+			adc	a,b
+			ret	nc
+			call	L882c
+			ld	b,(hl)
+			ld	bc,a05eh
+			ld	e,a
+			jp	po,L7b44
+			or	d7h
+			ret	p
+			ld	c,l
+			jp	z,Lac5c
+			ld	e,c
+			sub	c
+			ld	e,h
+			ld	e,e
+			ret	c
+			sub	(hl)
+			jp	pe,L44ca
+			jp	po,Lc942
+			ld	(de),a
+			xor	c
+			add	a,c
+			ld	a,(hl)
+			ld	e,l
+			call	nc,L14f4
+			adc	a,l
+			or	3dh
+			and	47h
+			ld	b,iyl *
+			ld	c,h
+			cp	e
+			add	a,l
+			adc	a,d
+			call	L06b3
+			ld	l,l
+			ld	(hl),d0h
+			ret	c
+			ld	a,a
+			sub	b
+			add	a,h
+			ld	d,(hl)
+			jp	pe,La75c
+			ld	a,c
+			sub	a
+			sbc	a,l
+			dec	l
+			add	a,b
+			ret	m
+			ei
+			nop (2x) *
+			jr	nc,start
+			cp	e
+			ld	a,d
+			cp	d
+			cp	c
+			ld	l,(hl)
+			ld	l,f0h
+			add	a,h
+			ld	c,99h
+			push	af
+			cp	46h
+			add	a,l
+			pop	de
+			or	h
+			ld	c,h
+			ld	l,l
+			ld	c,h
+			jp	Lbf4b
+			db	72h,61h,59h,a3h,0dh,10h,e0h,6dh
+			db	4fh
+			ld	sp,d5dch
+			add	a,a
+			ex	af,af'
+			ld	hl,(0ef3h)
+			sbc	a,e
+			nop
+			inc	l
+			ld	(hl),l
+			out	(84h),a
+			ld	(de),a
+			out	(64h),a
+			jr	z,L4045
+			dec	b
+			jp	nz,L366f
+			cp	b
+			ret	z
+			or	6dh
+			dec	a
+			call	z,L518f
+			pop	bc
+			ld	(hl),e
+			ld	(hl),e
+			ld	e,bch
+			xor	h
+			pop	bc
+			add	a,82h
+			sbc	a,d
+			ld	(hl),b8h
+			rra
+			dec	sp
+			call	nz,L7a1f
+			rst	08h
+			dec	de
+			adc	a,e
+			ld	d,98h
+			inc	h
+			sbc	a,h
+			pop	de
+			ld	h,h
+			inc	b
+			sub	a8h
+			rst	30h
+			xor	h
+			rst	18h
+			and	d
+			ld	a,55h
+			ld	h,fbh
+			ld	l,c
+			cp	(hl)
+			adc	a,h
+			ld	a,(bc)
+			and	(hl)
+			rst	30h
+			dec	a
+			dec	b
+			ld	(hl),l
+			ld	sp,hl
+			xor	d
+			ret	c
+			push	hl
+			ld	a,c
+			ld	e,h
+			ld	e,(hl)
+			xor	e
+			cp	e
+			ld	d,d
+			ld	(hl),f8h
+			di
+			cp	c
+			cp	h
+			sub	(hl)
+			ld	e,l
+			pop	af
+			inc	e
+			push	hl
+			ld	a,(de)
+			adc	a,e
+			add	a,(hl)
+			sub	e
+			inc	b
+			ld	e,c
+			sub	h
+			ld	b,d
+			rla
+			ex	af,af'
+			ld	b,(hl)
+			ld	b,a
+			inc	(hl)
+			add	hl,sp
+			xor	abh
+			ld	b,(hl)
+			ld	l,c
+			ret	m
+			ld	(de),a
+			ret
+			db	1dh,44h,7fh,eah,abh,5bh,85h,60h
+			db	55h,f0h,1dh,b4h,94h,25h,88h,43h
+			db	bch,d1h,66h,90h,ffh,95h,f6h,deh
+			db	9ah,67h,63h,c8h,19h,48h,bfh,4ah
+			ccf
+			ld	c,h
+			cp	l
+			nop (2x) *
+			ld	c,h
+			ld	h,(hl)
+			and	6bh
+			or	e
+			ld	a,(hl)
+			call	p,L7b6c
+			ld	(hl),c
+			nop
+			cp	d
+			call	nc,Lb233
+			push	af
+			ld	h,c
+			dec	l
+			dec	sp
+			dec	l
+			push	hl
+			xor	c
+			ld	(hl),c
+			xor	a
+			and	h
+			add	hl,de
+			ld	d,b5h
+			cp	d
+			cp	b
+			sub	(hl)
+			inc	a
+			ld	b,h
+			ld	d,h
+			ld	b,(hl)
+			add	a,d
+			dec	e
+			ld	d,d
+			adc	a,(hl)
+			jp	Lf353
+			db	d1h,7dh,c8h,70h,d6h
+			di
+			ld	(hl),8bh
+			ld	sp,9e87h
+			add	a,c
+			jr	nc,L4146
+			ret	c
+			jr	L4193
+			db	11h,dch,b5h
+			ld	b,d
+			sub	b
+			inc	b
+			and	(hl)
+			and	fdh
+			ld	a,b
+			push	de
+			adc	a,d
+			nop (2x) *
+			ret	po
+			ld	a,h
+			ret	m
+			ld	a,d
+			add	hl,sp
+			rst	28h
+			sub	c
+			ld	c,l
+			ld	h,l
+			scf
+			add	a,l
+			ret	nc
+			ld	(hl),a1h
+			ld	e,e
+			ld	(hl),l
+			add	a,c
+			jr	nc,L4171
+			ld	b,(hl)
+			ld	b,e
+			ret
+			db	23h,69h
+			add	hl,hl
+			ld	a,19h
+			inc	sp
+			ld	a,l
+			adc	a,e
+			ld	a,b
+			or	b
+			ld	l,d
+			jr	L41f7
+			db	91h,44h,9fh,e6h,15h,22h,eeh,7ah
+			db	6ch,87h,6eh,29h,b5h
+			ld	h,e
+			ret	nz
+			call	L86d7
+			inc	sp
+			ld	a,(e25eh)
+			ld	l,d
+			ccf
+			res	3,c
+			ld	c,d
+			xor	d
+			rst	20h
+			ld	e,(hl)
+			jp	c,Ldd00
+			halt
+			out	(41h),a
+			adc	a,a
+			ld	a,c
+			dec	c
+			add	a,a
+			jp	po,L9e47
+			dec	de
+			inc	(hl)
+			ld	h,b
+			xor	b
+			ld	a,(de)
+			sbc	a,e
+			ld	(hl),d
+			add	hl,sp
+			adc	a,b
+			inc	hl
+			ld	(hl),l
+			ld	h,91h
+			adc	a,b
+			sub	a
+			jp	pe,Lb051
+			and	l
+			djnz	L422b
+			ld	h,d
+			adc	a,l
+			cp	c
+			jp	(hl)
+			db	3eh,62h,a1h,18h,ffh,cch,4fh,d1h
+			db	edh,0bh,c6h,c1h,f1h,a9h,20h,b6h
+			db	3ch,e2h,4eh,6fh,8dh
+			ld	(hl),c
+			call	m,L7e56
+			ex	de,hl
+			add	hl,hl
+			rst	00h
+			jr	nc,L4181
+			ld	hl,(7434h)
+			ld	b,a
+			adc	a,d
+			cp	l
+			adc	a,d
+			adc	a,c
+			and	b
+			dec	a
+			sbc	a,e
+			in	a,(6ah)
+			and	b
+			ld	e,b
+			ld	h,16h
+			inc	sp
+			ret	nc
+			or	a
+			jp	c,L1e14
+			ld	b,d
+			dec	de
+			ld	h,l
+			ld	e,a
+			sbc	a,84h
+			adc	a,a9h
+			scf
+			ld	(hl),b
+			exx
+			inc	(hl)
+			call	c,Lc124
+			ld	d,a
+			ld	a,d
+			cp	c
+			ld	e,(hl)
+			ld	hl,1675h
+			xor	a8h
+			ld	l,87h
+			ld	b,(hl)
+			xor	c
+			ccf
+			ld	sp,hl
+			sbc	a,b
+			dec	hl
+			ld	c,d
+			or	e
+			daa
+			sbc	a,b
+			ld	c,1bh
+			ld	c,f6h
+			ld	d,l
+			ld	(hl),a
+			add	a,16h
+			call	pe,Lcf17
+			ld	e,(hl)
+			rla
+			ld	(de),a
+			and	a
+			sub	(hl)
+			ld	(ix + 51h),c
+			pop	de
+			inc	de
+			ld	(2db8h),hl
+			ld	h,a
+			ld	d,l
+			or	c
+			call	nz,L1dda
+			ld	(hl),l
+			dec	sp
+			and	42h
+			ex	af,af'
+			call	nc,L6e16
+			ld	e,b
+			ld	l,e
+			ld	a,l
+			rlca
+			or	c
+			ld	d,c
+			rst	08h
+			ld	b,e
+			jp	L55b3
+			db	6eh,20h,1dh,bch,26h,57h,a7h,e4h
+			db	a7h,fdh,a2h,5fh,9ah,afh,5bh,cah
+			db	8ah,b5h,56h,d5h
+			ld	h,a
+			add	a,(hl)
+			and	h
+			sub	h
+			ld	e,h
+			xor	e
+			ex	de,hl
+			ld	hl,(802eh)
+			sub	d
+			ld	(de),a
+			xor	l
+			ld	(L47a9),a
+			rst	20h
+			ld	(hl),e
+			ld	c,(hl)
+			nop (2x) *
+			and	e
+			add	a,3ch
+			ret	po
+			inc	bc
+			ld	(hl),l
+			inc	hl
+			scf
+			ld	d,b
+			jp	z,L2714
+			add	hl,de
+			ld	e,e
+			or	e
+			ld	e,e
+			call	nz,L75c0
+			ei
+			ld	l,d
+			xor	e
+			add	hl,de
+			in	a,(08h)
+			push	hl
+			ld	d,d
+			sub	d
+			or	b
+			ld	c,(hl)
+			ld	d,b
+			dec	de
+			call	p,La251
+			ld	e,a
+			xor	h
+			adc	a,a
+			bit	6,d
+			ld	h,d
+			dec	hl
+			cp	b
+			and	e
+			ld	h,(hl)
+			inc	sp
+			inc	hl
+			or	d
+			add	a,e
+			and	l
+			cp	d
+			add	a,h
+			and	42h
+			add	a,d
+			push	af
+			or	b
+			or	c
+			ld	a,c5h
+			ret	po
+			sub	b
+			ld	l,c6h
+			ld	(hl),d
+			rst	30h
+			ld	d,d2h
+			push	af
+			ld	c,(hl)
+			ld	b,9eh
+			ld	a,(816ch)
+			or	d
+			xor	h
+			jr	nc,L4304
+			rst	20h
+			ld	d,d
+			call	p,Ld79a
+			and	(hl)
+			rst	08h
+			or	e
+			and	a
+			ld	e,e
+			out	(19h),a
+			ld	a,b
+			add	a,a
+			and	h
+			ld	c,a
+			and	b
+			ccf
+			or	h
+			sbc	a,d
+			ld	c,c0h
+			ld	c,a
+			and	e
+			jr	L429b
+			db	83h,12h,c4h,e7h,92h,89h,3eh
+			ld	a,d
+			in	a,(f5h)
+			jr	z,L4383
+			cp	4ch
+			and	(hl)
+			ld	c,a
+			adc	a,l
+			ld	e,68h
+			ld	d,e
+			adc	a,2fh
+			rst	00h
+			ld	d,l
+			adc	a,3fh
+			ld	sp,hl
+			ld	a,(hl)
+			cp	(hl)
+			dec	de
+			xor	(hl)
+			xor	h
+			dec	b
+			call	Lbe2d
+			ld	l,b
+			nop (2x) *
+			sbc	a,l
+			call	c,Laf7f
+			add	a,a
+			out	(92h),a
+			ld	sp,b296h
+			add	hl,bc
+			ld	c,l
+			xor	(hl)
+			xor	h
+			ret	nc
+			and	d
+			ret	nz
+			ld	h,b
+			ld	l,h
+			dec	bc
+			ld	e,c
+			inc	e
+			ld	l,e
+			push	bc
+			ld	d,fch
+			ld	(hl),l
+			sbc	a,l
+			ld	sp,a76bh
+			sub	h
+			ld	h,23h
+			ld	hl,54cbh
+			or	l
+			call	p,Lee03
+			sbc	a,c
+			ld	c,e
+			xor	h
+			dec	de
+			add	a,d
+			ld	sp,hl
+			cp	l
+			jp	c,Ld8ca
+			ld	a,(hl)
+			sbc	a,d
+			push	hl
+			ld	e,l
+			ld	(hl),e
+			ld	h,c
+			ld	l,b
+			ld	h,l
+			and	l
+			ld	b,b
+			jp	m,L3534
+			ld	l,b
+			jp	c,L4f76
+			sub	a
+			ei
+			and	f0h
+			or	h
+			and	d
+			ld	a,h
+			cp	71h
+			push	af
+			push	af
+			or	a
+			or	(hl)
+			rst	38h
+			dec	de
+			ret	pe
+			cp	h
+			ld	a,(hl)
+			nop (2x) *
+			ld	b,c
+			rst	00h
+			ld	h,h
+			dec	b
+			pop	de
+			adc	a,e
+			inc	de
+			cpl
+			nop (2x) *
+			ld	c,a
+			xor	l
+			ld	a,b
+			adc	a,c
+			djnz	L4405
+			call	pe,L1196
+			ld	l,a
+			dec	b
+			call	nz,L74bd
+			and	a
+			ld	c,c
+			adc	a,d
+			cp	d
+			ex	de,hl
+			ld	a,(496ch)
+			dec	sp
+			push	hl
+			add	a,a
+			inc	hl
+			out	(68h),a
+			inc	l
+			sbc	a,b
+			sub	l
+			ret	c
+			ld	d,h
+			or	a
+			dec	(hl)
+			ld	(hl),a
+			ld	d,(hl)
+			ret	po
+			ld	h,e
+			adc	a,h
+			add	hl,hl
+			ld	a,h
+			ld	h,b
+			inc	bc
+			ld	c,a
+			call	L6c33
+			nop (2x) *
+			sbc	a,d
+			exx
+			ld	a,c
+			sbc	a,a
+			add	a,c
+			jp	p,La9ae
+			ret	nz
+			call	pe,Lf7cf
+			ld	l,a
+			adc	a,h
+			ld	b,h
+			ret	c
+			adc	a,(hl)
+			ld	h,72h
+			xor	l
+			cp	a
+			adc	a,d
+			rst	30h
+			jp	L67f7
+			db	99h,9bh,19h,54h,adh,ddh,17h,b7h
+			db	96h,45h,80h,20h,86h,40h,11h,77h
+			db	55h,b3h,52h,d2h,f9h,bch,7ah,f7h
+			db	69h,c5h,25h,49h,75h,1ch,29h,0fh
+			db	4ch,53h,96h,2ch,2ah,05h,7fh,26h
+			db	b6h,3ah,25h,b8h,5eh,47h,33h,0eh
+			db	10h,24h,95h,f9h
+			ld	a,a
+			xor	b
+			ld	a,c
+			or	b
+			ld	h,adh
+			jp	m,L21d4
+			ld	b,c
+			or	b
+			sub	b
+			ret	c
+			ld	b,d
+			ld	b,d
+			ld	c,(hl)
+			call	po,Ld34d
+			rst	18h
+			or	b
+			ld	e,a
+			push	af
+			ret
+			db	87h,c7h,7ch,25h,9ch,cch,28h,c8h
+			db	beh,7ah,a2h,3eh,32h,07h,48h,73h
+			db	adh,32h,60h,ddh,e7h,68h,ebh,8ah
+			db	dah,20h,3ch,94h,40h,93h,92h,dch
+			db	c4h
+			ld	b,b
+			ld	h,b
+			or	d
+			dec	(hl)
+			ld	c,a
+			rst	30h
+			adc	a,b
+			ex	(sp),hl
+			rst	28h
+			ld	a,h
+			sub	e
+			dec	c
+			add	a,cfh
+			inc	hl
+			ld	e,e
+			ld	b,1dh
+			cp	(hl)
+			push	hl
+			ld	(hl),l
+			ld	d,d
+			ld	e,h
+			ld	d,29h
+			add	a,h
+			inc	h
+			ld	d,56h
+			ld	d,d
+			dec	b
+			sbc	a,b
+			sub	d
+			ld	(hl),h
+			ld	d,h
+			jp	Ld7ae
+			db	d6h,4fh,1bh,57h,54h,14h,78h,eah
+			db	56h,48h,6bh,d1h,05h,4dh,46h,fbh
+			db	52h,7ch,c2h,d1h,99h,07h,bbh,27h
+			db	c2h,91h,f5h,37h,22h,2ah,d8h,7eh
+			db	95h,c9h,65h,fch,00h,90h,abh,42h
+			db	16h,bfh,4ah,91h,b8h,67h,84h,a7h
+			db	deh,aah,c4h,deh,30h,59h,27h,0eh
+			db	03h,dfh,46h,f5h,5ch,09h,17h,82h
+			db	04h,70h,83h,c4h,1ah,b7h,abh,1dh
+			db	ceh,33h,06h,1ch,dah,fbh,15h,a7h
+			db	47h,5ch,4bh,2eh,a2h,ddh,a3h,3dh
+			db	eah,bah,ddh,7eh,54h,beh,15h,5ch
+			db	22h,f8h,7dh,0fh,dch,0dh
+			rst	30h
+			and	d
+			ld	h,b
+			adc	a,l
+			sub	(hl)
+			ld	h,a
+			jr	z,L4529
+			call	nc,L4d2c
+			ld	(de),a
+			ld	a,c
+			or	c
+			jr	c,L445b
+			ld	a,(0380h)
+			ld	(de),a
+			ld	de,938ch
+			ld	b,e
+			sub	e
+			ld	d,a
+			ld	(hl),c
+			call	Lfb67
+			inc	sp
+			ld	l,l
+			exx
+			djnz	L4533
+			ld	l,l
+			rlca
+			ld	b,l
+			inc	e
+			xor	e
+			ld	e,f5h
+			ld	l,h
+			ld	e,a
+			add	a,d
+			ld	c,l
+			jp	p,Lad10
+			ld	h,d8h
+			ld	a,(bc)
+			or	l
+			ld	a,b
+			ld	h,a
+			jp	nc,Lb45e
+			ld	(hl),c
+			call	z,Lb98d
+			add	a,l
+			jp	Lf9bc
+			db	ach,14h,3fh,59h,c9h,51h,02h,a2h
+			db	12h,85h,b4h,23h,f9h,6bh,bfh,3ch
+			db	0eh,d8h,8eh,1eh,b0h,7ch,2ah,90h
+			db	cdh,f3h,38h,0fh,b7h
+			adc	a,e
+			xor	l
+			daa
+			cp	d
+			ld	(hl),c
+			ld	b,h
+			push	de
+			rst	00h
+			ld	h,d
+			ld	a,e
+			ld	l,d
+			dec	d
+			ld	h,(hl)
+			call	nz,L3f10
+			dec	sp
+			jp	L2ea0
+			db	cch,76h,fch,a0h,21h,27h,83h,adh
+			db	96h,04h,b9h,58h,feh,20h,9fh,f1h
+			db	9ah,a6h,79h,19h,b4h,34h,b1h,88h
+			db	a9h,5dh,d9h,01h,f4h,5ah,ddh,a8h
+			db	c9h,e4h,3fh,51h,02h,1dh,13h,85h
+			db	55h,c4h,c6h,ffh,1ah,aeh,74h,45h
+			db	41h,3fh,75h,3ch,f6h,4bh,43h,89h
+			db	0eh,91h,6bh,c8h,88h,92h,dfh,49h
+			db	d1h,62h,98h,84h,45h,9fh,f0h,06h
+			db	71h,e3h,11h,61h,49h,92h,3fh,ceh
+			db	cfh,b6h,b6h,f6h,a3h,18h,00h,38h
+			db	a6h,e8h,ach,4eh,8ch,e6h,a7h,fch
+			db	f1h,1fh,cdh,f9h,2ah,aah,2eh,62h
+			db	64h,71h,c4h,bah,bah,8ah,1eh,fbh
+			db	b2h,10h,4fh,f9h,22h,7fh,0ah,83h
+			db	c8h,cch,5bh,9eh,1ch,bbh,81h,e7h
+			db	37h,d3h,e3h,74h,21h,d5h,3dh,63h
+			db	27h,b6h,bfh,9bh,7ah,1fh,15h,15h
+			db	ebh,30h,96h,08h,41h,36h,beh,f7h
+			db	b7h,bfh,2fh,c4h,13h,7eh,3fh,c4h
+			db	2eh,f9h,9eh,e0h,c1h,8bh,aah,6eh
+			db	aah,66h,79h,bfh,0fh,11h,6bh,85h
+			db	18h,28h,adh,3eh,cfh,bdh,b1h,e2h
+			db	29h,12h,58h,cah,6ch,65h,ceh,28h
+			db	4fh,c4h,8ch,51h,ceh,feh,f7h,cdh
+			db	a7h,97h,c8h,feh,56h,c6h,b0h,4dh
+			db	28h
+			ret	p
+			ld	a,(de)
+			ld	e,b
+			ld	d,b
+			inc	l
+			ld	d,c
+			ccf
+			inc	de
+			inc	l
+			rrca
+			sub	(hl)
+			add	a,a
+			or	7eh
+			call	nc,Ld4e6
+			jp	pe,L722d
+			or	d
+			cp	c
+			ld	d,l
+			halt
+			dec	sp
+			ld	c,a
+			ld	b,a
+			ret
+			db	ach,85h,8ah,48h,1ch,41h,ffh,01h
+			db	d2h,3fh,0dh,6ch,a9h,8ch,efh,fbh
+			db	97h,23h,62h,50h,f8h,9eh,21h,25h
+			db	13h,b0h,89h,8dh,8eh,56h,28h,42h
+			db	15h,b8h,25h,33h,02h,deh,feh,04h
+			db	09h,43h
+			inc	h
+			adc	a,e
+			ld	l,a
+			cp	bch
+			add	hl,sp
+			sub	a
+			inc	b
+			ld	l,12h
+			ld	d,c
+			ld	a,3bh
+			ccf
+			ld	l,b4h
+			sbc	a,(hl)
+			cp	l
+			dec	bc
+			jp	nz,L014c
+			inc	h
+			call	pe,L9ba5
+			ld	b,d
+			add	a,l
+			adc	a,d
+			or	c
+			rst	00h
+			add	a,l
+			inc	e
+			rlca
+			cp	h
+			ld	l,h
+			ld	b,d
+			push	de
+			push	hl
+			nop (2x) *
+			cp	a
+			ld	c,a
+			xor	l
+			daa
+			adc	a,(hl)
+			ld	l,b
+			ld	de,e21dh
+			ld	h,d
+			inc	de
+			ld	a,(e72fh)
+			ld	c,e
+			inc	a
+			adc	a,e
+			ld	a,(bc)
+			jp	z,L423a
+			and	e1h
+			ld	c,l
+			and	a
+			and	e
+			sub	e
+			xor	h
+			adc	a,h
+			ld	e,e
+			add	a,c
+			ld	l,e
+			halt
+			scf
+			and	4ah
+			exx
+			ld	h,c
+			call	nz,L9f5b
+			ld	(de),a
+			ret	nz
+			cp	b
+			di
+			rla
+			ld	b,l
+			sub	d
+			ld	e,h
+			ld	l,c
+			ld	hl,(d54dh)
+			nop
+			pop	af
+			xor	c
+			halt
+			add	a,h
+			adc	a,6bh
+			add	a,(hl)
+			call	nz,Lc5ce
+			add	a,h
+			cp	a
+			and	h
+			jp	z,Lf19e
+			rlca
+			and	l
+			add	a,a
+			ret	z
+			ld	(hl),l
+			ex	(sp),hl
+			xor	13h
+			jr	nc,L4654
+			jp	(hl)
+			db	1eh,19h,f8h,55h,2bh,d3h
+			ld	(hl),b
+			inc	sp
+			push	de
+			jp	L73b0
+			db	5ch,1eh,06h,69h,6eh,e4h,8fh,86h
+			db	c6h,fbh,58h,9fh,68h,27h,8fh,13h
+			db	bch,b6h,ffh,4bh,f2h,f2h
+			sub	a
+			and	b
+			ld	d,(hl)
+			cp	l
+			inc	hl
+			or	c
+			sbc	a,a
+			and	b
+			jr	nc,L46d3
+			inc	(hl)
+			ld	l,c
+			xor	c
+			push	af
+			call	Ld8c2
+			and	e
+			rla
+			call	z,Lb751
+			add	a,l
+			sub	c
+			rst	38h
+			cp	l
+			ld	hl,54e6h
+			add	hl,de
+			add	hl,bc
+			cp	d
+			jp	nz,L050a
+			djnz	L46bf
+			sub	c
+			ld	l,d
+			ret	nc
+			ld	a,(4150h)
+			ld	c,a
+			pop	hl
+			ld	a,c
+			cp	c
+			ld	(hl),h
+			cp	b
+			ld	sp,c754h
+			pop	af
+			call	pe,L1b6a
+			or	l
+			rst	20h
+			ld	(hl),d
+			cp	l
+			and	c
+			rra
+			call	c,Ld0bb
+			ld	d,d
+			call	nc,Lda66
+			ld	a,h
+			dec	c
+			adc	a,b
+			bit	2,(hl)
+			ld	l,b
+			ld	c,dah
+			ld	h,b
+			or	(hl)
+			ld	e,5dh
+			dec	h
+			dec	(hl)
+			ld	a,(a596h)
+			dec	c
+			ex	af,af'
+			or	a
+			adc	a,d
+			ld	l,b
+			ld	(hl),h
+			djnz	L473b
+			ld	h,(hl)
+			inc	bc
+			dec	e
+			jr	z,L47ba
+			adc	a,d
+			sbc	a,e
+			ret	nc
+			xor	(hl)
+			ld	b,a
+			xor	d
+			ld	a,(bc)
+			add	hl,bc
+			dec	a
+			ret	pe
+			ld	a,e
+			ld	e,c
+			xor	b
+			ld	c,(hl)
+			and	e
+			ld	d,d
+			ld	e,c
+			sbc	a,h
+			ccf
+			and	e
+			ld	(295dh),hl
+			jr	c,L47a9
+			rst	08h
+			cp	08h
+			ld	e,29h
+			ld	h,b
+			dec	a
+			and	e
+			jr	nz,L4741
+			cp	l
+			push	af
+			ld	d,aah
+			or	l
+			sbc	a,0ah
+			cp	c
+			ld	a,d
+			in	a,(d7h)
+			ld	b,a
+			ld	c,l
+			res	3,h
+			ld	c,69h
+			rst	20h
+			ld	l,d
+			adc	a,l
+			ld	(hl),e
+			ld	h,b
+			ld	a,(0170h)
+			sbc	a,e
+			ret	p
+			ld	h,h
+			ld	l,(hl)
+			ld	(hl),56h
+			cp	a
+			pop	af
+			rst	10h
+			ret	c
+			or	b
+			sub	l
+			neg *
+			jp	m,L8c70
+			ld	d,49h
+			sub	(hl)
+			rst	20h
+			ld	l,a
+			ei
+			rst	28h
+			inc	de
+			or	c
+			add	a,b
+			ld	a,(de)
+			call	nz,L7da8
+			ld	h,c
+			ret	c
+			halt
+			djnz	L4758
+			ex	af,af'
+			and	e
+			ld	a,l
+			push	af
+			ld	e,73h
+			inc	c
+			ld	d,59h
+			or	c
+			ld	e,l
+			ld	(c63ch),hl
+			ld	d,(hl)
+			halt
+			ld	c,c
+			bit	1,h
+			dec	h
+			ld	e,(hl)
+			and	h
+			rlca
+			and	e
+			ld	e,h
+			or	h
+			rst	08h
+			ld	l,b
+			ex	de,hl
+			ld	l,l
+			ld	c,c
+			ld	l,a
+			sbc	a,h
+			sub	b
+			ld	e,l
+			sbc	a,h
+			pop	bc
+			set	6,a
+			adc	a,d
+			ld	c,88h
+			inc	hl
+			sbc	a,b
+			ld	sp,hl
+			xor	d
+			or	d
+			ld	c,l
+			bit	6,e
+			sbc	a,b
+			rra
+			add	a,a
+			dec	sp
+			ld	c,a
+			ccf
+			pop	bc
+			ret	p
+			ld	l,b
+			inc	de
+			cp	b
+			sbc	a,c
+			ld	a,a
+			ld	l,e
+			ex	de,hl
+			pop	de
+			sbc	a,e
+			adc	a,b
+			cp	c
+			ld	e,d
+			ld	d,46h
+			jr	L47eb
+			db	b2h,5ch,92h,62h,dch,bbh,89h,43h
+			db	85h,96h,c5h,8eh,19h,11h,bah,9ah
+			db	b5h,0dh,6dh,4dh,feh,deh,b3h,4bh
+			db	b6h,02h,eah,6dh,1eh,07h,aeh,10h
+			db	e4h,aeh,edh,38h,51h,55h,35h,47h
+			db	c5h,11h,48h,48h,c5h,e7h,44h,26h
+			db	8fh,2fh,fdh,91h,74h,c8h,0ah,a1h
+			db	5bh,8eh,ebh,a7h,8ch,5eh
+			sub	a
+			inc	de
+			sbc	a,l
+			adc	a,d
+			inc	de
+			dec	(hl)
+			ld	d,e
+			ret	nz
+			ld	d,h
+			jp	pe,L0856
+			ld	a,a
+			push	de
+			sub	c
+			and	c
+			add	hl,sp
+			ld	e,b
+			halt
+			call	Lec00
+			xor	e
+			ld	de,dc5bh
+			or	b
+			ld	c,l
+			ld	bc,c234h
+			and	l
+			ld	e,d
+			inc	c
+			ld	a,e
+			exx
+			ld	e,(hl)
+			call	L3445
+			jp	po,L3646
+			inc	hl
+			rst	30h
+			di
+			inc	e
+			jr	z,L4870
+			and	d
+			jr	nc,L48cf
+			dec	(hl)
+			call	L4242
+			ret	z
+			in	d,(c)
+			adc	a,(hl)
+			ld	e,c
+			ld	l,abh
+			ld	e,c
+			in	a,(8ch)
+			call	nz,Lc576
+			ld	(bc),a
+			ld	d,b
+			ld	d,35h
+			ld	sp,iy
+			inc	sp
+			rst	38h
+			adc	a,b
+			add	hl,sp
+			ld	e,1ah
+			rra
+			ccf
+			ld	a,(de)
+			ld	e,(hl)
+			xor	d
+			xor	a
+			xor	e
+			add	a,l
+			ld	e,d
+			ld	c,a
+			or	l
+			xor	c
+			ld	(e92dh),a
+			ld	d,21h
+			adc	a,h
+			ld	b,h
+			add	hl,bc
+			inc	a
+			dec	l
+			call	c,Lffe9
+			and	a
+			cp	h
+			ld	a,(bc)
+			ld	h,d
+			rst	20h
+			ld	c,(hl)
+			sub	a
+			ld	b,h
+			nop (2x) *
+			or	d
+			sub	c
+			adc	a,h
+			nop
+			ld	sp,hl
+			ret	pe
+			cp	(hl)
+			ret	pe
+			ld	(hl),e
+			xor	b
+			rst	20h
+			ex	(sp),hl
+			call	pe,Lc02f
+			and	(hl)
+			ld	c,b
+			sbc	a,a
+			ld	b,c
+			sbc	a,l
+			ld	h,a
+			adc	a,l
+			ld	h,b
+			xor	l
+			ld	l,c
+			sbc	a,l
+			ld	a,h
+			ret	nz
+			ld	a,(de)
+			rlca
+			call	c,L64e5
+			ld	c,(hl)
+			ld	b,c
+			and	c
+			and	d5h
+			ld	a,h
+			ld	e,b
+			ld	c,e
+			out	(92h),a
+			jp	(hl)
+			db	a7h,5eh,e3h,3dh,6ah,90h,f6h,e2h
+			db	3bh,a2h,00h,b0h,10h,a0h,bdh,c7h
+			db	71h,7eh,09h,48h,e5h,4fh,81h,efh
+			db	b2h,a5h,a6h,23h,9fh,73h,c2h,ddh
+			db	02h,1ah,e8h,f5h,1fh,e0h,0ch,06h
+			db	45h,ddh,a5h,32h,66h,a6h,4ah,cbh
+			db	b0h,2ah,d0h,7ch,b1h,ddh,6dh,b2h
+			db	34h,49h,31h,c7h
+			xor	h
+			inc	h
+			jp	nc,L8173
+			ld	l,b
+			in	a,(fdh)
+			and	(hl)
+			ld	a,e
+			ret
+			db	74h,64h,f7h,45h,c7h,52h,e1h,e1h
+			db	7ch,68h,ffh,00h
+			exx
+			add	a,a
+			cp	(hl)
+			ld	e,ceh
+			push	hl
+			and	d
+			inc	l
+			ld	b,h
+			sub	e
+			ld	bc,a821h
+			ld	l,e
+			inc	a
+			adc	a,d
+			xor	c
+			adc	a,d
+			ld	(bc),a
+			rst	00h
+			adc	a,b
+			pop	bc
+			ccf
+			add	hl,sp
+			ld	d,c
+			inc	(hl)
+			jp	pe,L045a
+			rra
+			ld	b,3ah
+			ld	l,d
+			add	hl,de
+			ld	h,l
+			dec	h
+			rst	00h
+			inc	de
+			call	nz,Le9ae
+			ld	d,b
+			di
+			xor	h
+			ld	b,08h
+			scf
+			sub	d
+			jp	m,Lecb5
+			or	d
+			ld	c,d
+			xor	(hl)
+			in	a,(e2h)
+			sbc	a,(hl)
+			ld	(hl),efh
+			adc	a,e
+			rst	00h
+			ld	e,c
+			jp	(hl)
+			db	44h,84h,7fh,c8h,fbh,ech,29h,17h
+			inc	l
+			ld	ixh,e *
+			ld	l,l
+			dec	l
+			cp	30h
+			cpl
+			jp	nc,L809d
+			or	(hl)
+			sub	05h
+			or	41h
+			adc	a,d
+			ld	c,6bh
+			ld	l,43h
+			jp	p,La0a5
+			rlca
+			xor	c
+			rst	38h
+			ld	a,c
+			adc	a,c
+			call	p,L73f3
+			ld	(fd12h),hl
+			sbc	a,a
+			inc	a
+			ld	b,c
+			call	pe,L29a2
+			ld	h,c
+			ld	sp,hl
+			ld	l,(hl)
+			ld	(hl),b
+			or	47h
+			and	c
+			ccf
+			ret
+			db	b1h,03h,83h,56h,d3h,8ch,afh,a8h
+			db	afh,10h,4fh,61h,58h,42h,8dh,a4h
+			db	35h,c6h,b7h,bbh,f4h,deh,42h,55h
+			db	36h,3eh,48h,80h,08h,2fh,17h,edh
+			db	93h,c6h,13h,2ah,51h,3fh,8fh,22h
+			db	fbh,1dh,efh,f4h,2fh,b3h,d2h,9dh
+			db	36h,ceh,b5h,7fh,04h,fbh,ech,57h
+			db	0fh,4eh,10h,bdh,56h,05h,f5h,22h
+			db	11h,7ch,c4h,40h,ddh,bbh,a0h,b3h
+			db	47h,c0h,adh,58h,07h,b5h,00h,a5h
+			db	64h,55h,dfh,0bh,63h,0fh,6ah,3ah
+			db	6ch,74h,86h,6ah,36h,02h,f6h,06h
+			db	ceh,ceh,f3h
+			ld	(hl),h
+			inc	h
+			ld	h,a
+			di
+			jp	pe,L773a
+			cp	ebh
+			jr	c,L4a36
+			sbc	a,h
+			sub	e
+			inc	a
+			inc	l
+			ld	(10dfh),hl
+			rst	38h
+			ld	(ix + a9h),10h
+			inc	h
+			call	p,Ladd5
+			cp	b
+			inc	e
+			ld	h,l
+			ld	l,l
+			push	af
+			sub	h
+			jr	nc,L4a7f
+			cp	e
+			ld	h,d5h
+			adc	a,l
+			inc	d
+			adc	a,b
+			out	(7fh),a
+			call	z,L1c04
+			jp	po,Lc401
+			add	a,l
+			ld	h,89h
+			jr	c,L4a93
+			jp	(hl)
+			db	d8h,09h,6ah,0dh,5dh,2eh,ffh,36h
+			db	27h,74h,0bh,08h,f6h
+			or	c
+			sub	d
+			nop (2x) *
+			ld	c,b3h
+			ld	d,b9h
+			ld	a,b
+			ld	l,h
+			sub	l
+			ld	d,h
+			inc	a
+			ld	a,(de)
+			and	d
+			ld	(hl),a
+			and	d
+			adc	a,h
+			ld	(hl),d
+			ccf
+			add	hl,hl
+			ex	de,hl
+			dec	hl
+			cp	06h
+			cp	c
+			ld	bc,eba1h
+			ld	a,h
+			jr	nc,L4a6e
+			jr	c,L4a08
+			call	nz,Ld91c
+			ei
+			ld	a,c
+			ex	de,hl
+			ld	bc,29adh
+			ld	c,l
+			sub	b
+			and	b
+			rrca
+			ret	p
+			djnz	L4abb
+			sub	a
+			ld	e,l
+			ld	e,c
+			inc	de
+			sbc	a,b
+			jr	L4a4c
+			db	38h,45h,61h,29h,fdh,b4h,e0h,14h
+			db	42h,b2h,5bh,7dh,a3h,52h,a8h
+			xor	c
+			ret	nz
+			ld	h,b
+			ld	c,(hl)
+			adc	a,c
+			jp	nz,L52b7
+			pop	bc
+			cp	a
+			rla
+			or	c
+			rst	20h
+			ret	p
+			call	c,L345e
+			ld	h,b
+			bit	5,e
+			dec	sp
+			inc	e
+			and	(hl)
+			add	a,e
+			cp	l
+			or	h
+			dec	e
+			inc	sp
+			cp	(hl)
+			call	L6bcc
+			dec	c
+			ld	d,(hl)
+			ld	a,h
+			ld	(a833h),a
+			dec	e
+			cp	7eh
+			and	8fh
+			rla
+			set	1,a
+			ld	b,h
+			adc	a,l
+			ret
+			db	e3h,1ch,86h,9dh,75h,42h,7dh,a0h
+			db	bch,f4h,cdh,e4h,b9h,76h,37h,29h
+			db	8bh,a8h,efh,26h,fdh,22h,f3h,2fh
+			db	32h,42h,dbh,35h,0ch,52h,85h,a4h
+			db	84h,7dh,e0h,cah,9eh,04h,3ch,e3h
+			db	47h,c0h,fbh,51h,5fh,2eh,0bh,13h
+			db	21h,7eh,24h,9ah,23h,b3h,40h,abh
+			db	41h,27h,bfh,cah,c4h,7bh,eeh,23h
+			db	99h,eeh,bbh,32h,31h,43h,cah,a1h
+			db	24h,59h,65h,b8h,deh,9dh,c2h,e0h
+			db	bbh,0bh,e9h,35h,5ch,13h,adh,35h
+			db	91h,b5h,0dh,dch,a4h,6fh,b3h,d4h
+			db	3fh,f5h,23h,8fh,bfh,46h,31h,46h
+			db	4ah,6dh,25h,35h,e0h,51h,9ch,9fh
+			db	d3h,9fh,2bh,f9h,9fh,c2h,72h,89h
+			db	c8h,bch,20h,e3h,4fh,dfh,02h,ach
+			db	adh,93h,8fh,a3h,75h,64h,69h,c2h
+			db	03h,35h,a3h,57h,a5h,6ah,06h,07h
+			db	eeh,16h,dah,0ah,e8h,eah,38h,e8h
+			db	82h,5fh,41h,0dh,71h,d8h,b3h,5ch
+			db	f5h
+			ld	h,d
+			ld	h,c
+			push	hl
+			ex	af,af'
+			ld	a,(hl)
+			adc	a,l
+			ld	(hl),1eh
+			cp	c
+			sbc	a,(hl)
+			ld	(hl),b
+			ld	(hl),c
+			call	nz,L2d14
+			or	3bh
+			sbc	a,d
+			inc	sp
+			ld	h,(hl)
+			ld	a,d
+			add	a,b
+			sub	48h
+			ex	af,af'
+			pop	af
+			push	hl
+			rst	18h
+			sub	(hl)
+			ret	c
+			dec	hl
+			xor	a
+			dec	sp
+			ld	h,a
+			inc	hl
+			dec	d
+			ld	l,c
+			rst	18h
+			cp	b
+			sbc	a,h
+			jp	po,L6113
+			ld	h,c
+			ld	l,a
+			add	a,(hl)
+			sbc	a,h
+			ld	a,c
+			jp	z,Ld516
+			ld	sp,hl
+			daa
+			xor	b
+			ld	b,(hl)
+			add	a,l
+			jr	nz,L4bd4
+			add	hl,de
+			cp	b
+			nop
+			and	c
+			ld	e,(hl)
+			exx
+			or	b
+			ld	(0c44h),hl
+			cp	d
+			call	nc,L5cf1
+			ld	d,(hl)
+			and	l
+			jp	z,La647
+			adc	a,l
+			sbc	a,l
+			or	c
+			djnz	L4b98
+			ld	b,h
+			ld	e,l
+			rra
+			call	po,Lb7c2
+			call	L9d74
+			dec	a
+			ld	b,c
+			ld	b,ceh
+			ex	af,af'
+			add	hl,bc
+			ld	h,h
+			add	a,(hl)
+			ld	c,13h
+			rra
+			ld	(bc),a
+			add	a,(hl)
+			ld	l,(hl)
+			cpl
+			rst	30h
+			sub	(hl)
+			ld	h,e
+			or	d
+			ld	hl,(a582h)
+			cp	b
+			add	hl,de
+			add	a,h
+			ld	(hl),b
+			ld	(6e0ch),a
+			ld	h,b
+			inc	c
+			ld	l,c
+			ld	(hl),b
+			jr	nc,L4b65
+			ret	nz
+			ld	l,e
+			cp	h
+			ld	(de),a
+			ld	sp,514fh
+			push	hl
+			ld	a,(de)
+			or	(hl)
+			ld	l,e
+			in	a,(39h)
+			inc	de
+			sub	h
+			or	(hl)
+			inc	h
+			dec	c
+			sub	d
+			ld	a,e
+			rst	20h
+			dec	d
+			ld	d,e
+			add	hl,de
+			sub	fch
+			pop	hl
+			and	a
+			push	hl
+			ld	(7f4eh),hl
+			ld	a,(hl)
+			ld	(hl),a
+			ld	b,h
+			or	c
+			ret	po
+			sub	d
+			or	(hl)
+			out	(68h),a
+			ex	de,hl
+			ld	(ix + 51h),l
+			call	pe,L78c2
+			sbc	a,d
+			rst	08h
+			ret	po
+			ld	h,l
+			add	a,d
+			adc	a,b
+			ld	d,l
+			adc	a,l
+			ld	l,99h
+			dec	de
+			cp	ddh
+			nop
+			and	l
+			inc	h
+			and	h
+			ld	a,(3d5ch)
+			add	a,8dh
+			ld	a,l
+			add	a,94h
+			nop
+			ld	h,c
+			ret	p
+			ld	d,h
+			jp	po,L9c39
+			ld	d,(hl)
+			inc	d
+			ret	nc
+			ld	b,c
+			ex	af,af'
+			push	de
+			sbc	a,h
+			jp	Lf26e
+			db	b8h,8eh,bdh,ach,6bh,01h,deh,4ah
+			db	53h,10h,0ch,0fh,18h,7fh,46h
+			dec	b
+			pop	af
+			ret	nc
+			sub	l
+			ld	a,b
+			ld	b,d
+			ret	z
+			or	e
+			ld	b,(hl)
+			inc	hl
+			sub	d
+			ld	l,c
+			ld	b,(hl)
+			dec	sp
+			jr	nz,L4c98
+			sub	h
+			ld	(hl),h
+			inc	c
+			djnz	L4bfb
+			ld	l,c
+			inc	d
+			jp	p,L2ac4
+			exx
+			dec	l
+			ld	(ac71h),hl
+			cpl
+			xor	b4h
+			ld	e,c
+			adc	a,75h
+			ld	hl,5b4eh
+			ld	h,h
+			ld	a,(bc)
+			inc	(hl)
+			ld	c,7ch
+			or	(hl)
+			sub	03h
+			ld	a,(de)
+			jp	Ldbb5
+			db	b7h,84h,d4h,12h,60h,feh,72h,19h
+			db	1fh,2ah,7eh,19h,72h,c5h,5fh,92h
+			db	d2h,98h,afh,6fh,8fh,6ah
+			scf
+			and	d
+			adc	a,(hl)
+			nop (2x) *
+			jp	c,L0c33
+			sbc	a,(hl)
+			cp	a
+			ld	l,b
+			ld	hl,c4cah
+			add	a,b
+			ld	d,6ah
+			sbc	a,c
+			ex	(sp),hl
+			ei
+			sub	h
+			jp	nz,Ledf4
+			ret	c
+			ret	nz
+			ld	c,a
+			adc	a,h
+			call	p,L834b
+			jr	c,L4cf8
+			pop	hl
+			nop (2x) *
+			ret
+			db	b3h,bch,15h,78h,27h,fbh,a0h,18h
+			db	69h,d0h,b0h,3dh,3dh,2dh,62h,d4h
+			db	8eh,dch,6bh,3fh,b5h,02h,8bh
+			and	e
+			and	a
+			ld	h,a
+			ld	b,l
+			ld	sp,7009h
+			ld	e,b
+			sbc	a,b
+			push	af
+			ld	a,l
+			inc	c
+			ret	pe
+			ld	d,24h
+			sll	h
+			sub	d
+			scf
+			ld	(bc),a
+			ld	(hl),c
+			call	pe,Lc2dd
+			ld	h,l
+			ld	l,d
+			add	a,(hl)
+			ld	c,b
+			add	a,d
+			ret
+			db	23h,b1h,23h,85h,67h,1ch,0bh,69h
+			db	00h
+			adc	a,c7h
+			xor	a
+			ld	a,(bc)
+			call	p,L52e5
+			adc	a,d
+			dec	c
+			ld	(hl),d
+			ld	(hl),e
+			cp	e
+			xor	e
+			ret	nc
+			ex	af,af'
+			add	hl,hl
+			ld	h,fah
+			cp	(hl)
+			inc	e
+			ld	(7532h),a
+			or	40h
+			inc	sp
+			ld	(c28ah),hl
+			or	a
+			sub	(hl)
+			inc	l
+			ld	a,e
+			adc	a,a
+			rst	10h
+			rrc	l
+			add	a,c
+			dec	l
+			in	a,(09h)
+			in	a,(03h)
+			ld	h,b
+			push	de
+			rrca
+			jp	L9ee1
+			db	ebh,75h,27h
+			ld	b,e
+			sub	h
+			call	nz,Le62b
+			ld	b,d
+			or	(hl)
+			ld	a,e
+			sub	(hl)
+			cp	h
+			sub	c
+			ld	d,4bh
+			ld	h,b
+			sub	c
+			scf
+			add	a,d
+			and	(hl)
+			ld	h,c
+			ld	a,a
+			ret	po
+			add	a,l
+			rst	38h
+			rst	30h
+			adc	a,d
+			ret	nz
+			or	d
+			ld	l,h
+			call	p,L528b
+			scf
+			or	e
+			dec	a
+			ret	nc
+			dec	(hl)
+			cp	e
+			xor	a
+			ld	a,b
+			cp	e
+			adc	a,h
+			ret	c
+			pop	hl
+			ld	d,c
+			ld	l,l
+			out	(c8h),a
+			adc	a,c
+			sub	h
+			srl	l
+			add	a,b
+			jp	nc,Ld7d0
+			dec	sp
+			dec	d
+			ld	d,f7h
+			ld	e,l
+			ld	h,a
+			ld	d,h
+			jp	nz,L18cc
+			rlca
+			adc	a,a
+			ld	b,l
+			ret	c
+			jr	L4d7c
+			db	6dh,f9h,f6h,dfh,ebh,82h,3ah,afh
+			db	d5h
+			ld	e,4ch
+			ret	nc
+			ld	h,h
+			inc	b
+			ret	z
+			call	nz,Le5f7
+			ld	c,d
+			inc	l
+			inc	b
+			ld	c,c
+			ld	b,l
+			sbc	a,l
+			jp	(hl)
+			db	f0h,d8h,f6h,ech,43h,d6h,b6h,6ah
+			db	a9h,73h,26h,20h,b0h,92h,40h,b8h
+			db	d4h,b3h,13h,1dh,d0h,04h,a6h,06h
+			db	87h,7eh,75h,eeh,4eh,3fh
+			sbc	a,d
+			ld	d,l
+			inc	hl
+			ld	d,(hl)
+			ld	d,d
+			xor	b
+			ret	p
+			cp	a
+			rst	18h
+			dec	de
+			cp	14h
+			scf
+			and	11h
+			rla
+			ld	h,l
+			rst	00h
+			ld	h,d
+			or	c
+			sub	d
+			ld	(hl),9eh
+			ld	b,a
+			ld	b,h
+			ld	b,c
+			and	d
+			cp	b
+			add	hl,sp
+			ld	(ix + 35h),a
+			add	a,(hl)
+			sbc	a,6dh
+			inc	l
+			ld	e,(hl)
+			xor	7dh
+			ld	e,e8h
+			or	3ch
+			ld	h,e
+			ld	d,c3h
+			ld	sp,hl
+			ld	e,d
+			ld	h,(hl)
+			bit	5,h
+			adc	a,b
+			ld	(2d90h),hl
+			dec	c
+			dec	b
+			rra
+			xor	d
+			ld	l,c
+			ld	(hl),l
+			ld	(16d3h),hl
+			jp	p,Ld636
+			push	bc
+			ld	(578eh),hl
+			dec	a
+			ld	e,c
+			ld	de,182ch
+			xor	h
+			or	c
+			in	a,(92h)
+			rst	00h
+			ret	po
+			cp	d
+			ld	b,d
+			add	a,81h
+			ld	e,a
+			ld	a,a
+			and	d
+			ex	af,af'
+			call	nz,L5102
+			cp	d
+			ld	h,l
+			rst	10h
+			adc	a,e
+			cp	b
+			cp	h
+			ld	b,b9h
+			cpl
+			xor	e
+			add	iy,sp
+			ld	d,h
+			ld	e,(hl)
+			ld	c,(hl)
+			jr	nc,L4daa
+			call	m,L9d23
+			inc	(hl)
+			sbc	a,l
+			ld	l,a
+			adc	a,c5h
+			ex	(sp),hl
+			add	a,h
+			ld	l,a
+			push	af
+			ld	hl,6ca7h
+			jp	p,Le3fd
+			di
+			ld	h,l
+			dec	c
+			ld	(bc),a
+			sub	9ch
+			ld	c,h
+			call	nc,Lac4a
+			jp	po,L8c7b
+			add	hl,sp
+			ld	c,l
+			ld	l,(hl)
+			jp	nz,L69dd
+			ld	l,(hl)
+			ld	(hl),c
+			dec	sp
+			ld	sp,hl
+			and	e
+			ld	e,85h
+			and	6dh
+			ld	l,0fh
+			jr	z,L4df0
+			di
+			jp	c,L0f10
+			ret	nz
+			exx
+			nop
+			ld	(hl),h
+			ld	h,d
+			cp	a
+			call	m,L67a6
+			ret	po
+			ld	l,1ch
+			ld	a,e
+			add	hl,de
+			ld	(hl),e
+			and	43h
+			and	h
+			cp	l
+			or	h
+			sub	b
+			adc	a,a
+			ld	b,e9h
+			ld	d,h
+			ld	(cb47h),a
+			or	b
+			sbc	a,(hl)
+			ld	a,d
+			ld	b,6ch
+			ld	l,2fh
+			sub	l
+			ld	a,c
+			inc	(hl)
+			rst	28h
+			ld	b,l
+			sbc	a,b
+			inc	de
+			ld	l,(hl)
+			ex	(sp),hl
+			jr	L4e0e
+			db	bdh,81h,4dh,9dh,94h,0dh,3bh,5ch
+			db	00h,b9h,61h,70h,cah,c1h,40h,04h
+			db	b9h,26h,59h,5eh,60h,99h,2fh,efh
+			db	49h,83h,c0h,0ch,d6h,8bh,79h,25h
+			db	e4h,22h,2ah,abh,75h,c1h,bah,7fh
+			db	b3h,97h,bah,bdh,c9h,9ch,74h,27h
+			db	46h,d7h,56h,59h,47h,9ah,04h,5bh
+			db	d1h,23h,60h,beh,74h,c5h,6fh,c7h
+			db	87h,efh,ech,f1h,47h,57h,5eh,85h
+			db	3eh,b4h,cbh,1ah,a6h,14h,11h,1fh
+			db	31h,9ch,0fh,c6h,c3h,98h,d9h,6eh
+			db	68h,3eh,7ch,82h,3bh,19h,f4h,10h
+			db	84h,0eh,7fh,88h,eah,37h,a7h,2eh
+			db	a3h,74h,ach,4dh,38h,87h,c3h,38h
+			db	49h,d7h,5ch,fbh,39h,72h,84h,7ch
+			db	adh,a8h,5ah,63h,5fh,c6h,66h
+			ld	(hl),h
+			sub	(hl)
+			jp	c,L67e9
+			and	h
+			sbc	a,e
+			call	nc,La655
+			ld	a,b
+			ld	d,l
+			adc	a,l
+			ld	de,7374h
+			and	b
+			ld	b,a
+			ld	(22ddh),a
+			add	a,h
+			or	h
+			ld	b,d1h
+			rrca
+			inc	d
+			ld	e,h
+			ld	hl,(e2f7h)
+			xor	(hl)
+			ld	(hl),e
+			ld	d,c
+			adc	a,h
+			ld	l,f9h
+			rst	30h
+			or	l
+			dec	hl
+			ld	b,a
+			ld	e,08h
+			or	a
+			ld	b,l
+			jp	z,L08cb
+			sub	15h
+			pop	de
+			call	m,L8f50
+			ld	c,cch
+			ld	h,d
+			ld	l,c
+			rst	10h
+			inc	bc
+			ld	d,(hl)
+			or	(hl)
+			djnz	L4f64
+			jp	(hl)
+			db	65h,97h,07h,47h,54h,43h,25h,94h
+			db	f0h,18h,c1h,3eh,95h,e6h,34h,81h
+			db	29h,0ch,0dh,2ah,93h,cbh,1ch,0bh
+			db	21h,73h,b8h,69h,82h,5dh,84h,7ah
+			db	adh,5eh,c4h,5ah,73h,0bh,47h,c8h
+			ret	nz
+			ld	d,h
+			inc	(hl)
+			ld	c,e
+			and	e
+			cpl
+			sub	(hl)
+			xor	32h
+			ld	a,e
+			ld	b,l
+			rla
+			pop	bc
+			ld	(hl),a
+			ret	m
+			adc	a,d
+			sub	a
+			add	hl,bc
+			ret	pe
+			add	a,h
+			ld	e,56h
+			add	a,d1h
+			ld	l,(hl)
+			inc	bc
+			sub	h
+			pop	de
+			ld	bc,6576h
+			rst	28h
+			dec	bc
+			adc	a,afh
+			ld	h,e
+			adc	a,l
+			adc	a,0ch
+			or	(hl)
+			add	a,l
+			dec	h
+			or	a
+			pop	af
+			ld	h,c
+			inc	a
+			pop	hl
+			in	a,(44h)
+			ret	p
+			ld	d,d
+			xor	l
+			and	e
+			sub	b
+			inc	sp
+			adc	a,h
+			ld	b,l
+			ld	h,h
+			jp	c,L4b81
+			ld	a,(bc)
+			sub	(hl)
+			ret	p
+			ret	c
+			add	a,29h
+			add	a,h
+			or	e
+			ld	b,h
+			ld	a,34h
+			dec	c
+			xor	(hl)
+			ld	a,c
+			ld	d,d
+			out	(28h),a
+			ld	(hl),a
+			ld	b,h
+			ld	d,d
+			jr	L4fc4
+			db	cbh,72h,36h,82h,24h,c0h,77h,b5h
+			db	5ch,b3h,8bh,b8h,91h
+			sub	l
+			rlca
+			ld	b,b
+			cp	l
+			push	hl
+			ld	l,c
+			dec	l
+			cp	e
+			rra
+			or	(hl)
+			sbc	a,e
+			dec	hl
+			adc	a,(hl)
+			exx
+			ld	d,cfh
+			djnz	L5043
+			push	hl
+			dec	(ix + e8h)
+			cp	d
+			jp	po,L89a8
+			inc	hl
+			jp	c,L3fe3
+			jr	nz,L4f84
+			push	hl
+			ld	(hl),a
+			ei
+			add	hl,sp
+			ld	c,h
+			add	hl,de
+			ld	(6ff7h),hl
+			add	a,h
+			ld	c,a
+			jp	nz,L4bc7
+			ld	e,e9h
+			ld	e,e
+			rlca
+			xor	e
+			and	d
+			sbc	a,a
+			ld	b,(hl)
+			xor	l
+			call	nc,Lf9b6
+			ld	bc,0358h
+			sbc	a,l
+			cp	e
+			push	bc
+			ld	a,l
+			ld	c,e
+			cp	a
+			inc	a
+			xor	a
+			add	hl,de
+			ld	c,a
+			ret
+			db	73h
+			inc	d
+			jp	po,L8ced
+			ld	d,c
+			or	(hl)
+			ld	e,a
+			sub	e
+			ld	d,d
+			or	d
+			rst	00h
+			res	7,(hl)
+			sbc	a,l
+			out	(8ah),a
+			ex	af,af'
+			pop	bc
+			add	hl,bc
+			rrca
+			cp	b
+			ld	a,e
+			inc	l
+			ld	c,40h
+			ld	(30b2h),a
+			dec	de
+			add	hl,sp
+			ret	p
+			sub	37h
+			dec	h
+			adc	a,d
+			add	a,a
+			out	(68h),a
+			dec	b
+			call	L9e5f
+			inc	sp
+			and	e
+			ld	a,b
+			ld	d,a
+			and	e
+			xor	(hl)
+			adc	a,a
+			adc	a,(hl)
+			ld	d,h
+			ld	l,aah
+			ld	sp,f40ah
+			ex	(sp),hl
+			call	nc,L1bf9
+			daa
+			adc	a,a
+			sbc	a,0bh
+			push	af
+			ld	d,d
+			ld	l,b
+			ld	l,a
+			and	(hl)
+			ex	(sp),hl
+			pop	hl
+			adc	hl,sp
+			ret	nc
+			xor	c
+			and	e
+			sbc	a,e
+			ld	b,l
+			add	a,(hl)
+			ld	c,b
+			xor	d
+			cp	d1h
+			rst	30h
+			dec	c
+			and	l
+			inc	b
+			ld	hl,(eecfh)
+			ret	m
+			ld	b,b
+			out	(bfh),a
+			call	z,L4cd1
+			ld	b,h
+			add	hl,sp
+			call	p,L823c
+			add	hl,hl
+			jr	L5008
+			db	d8h,65h,dbh,12h,b0h,62h,22h,bch
+			db	4ah,0dh,6eh,05h,b1h,fdh,b2h,d4h
+			db	ach,b0h,69h,96h,6ch,a1h,7fh,0ah
+			db	b7h,eah,ceh,bbh,8ch,15h,93h,7fh
+			db	08h,33h,1dh,f3h,0eh,8dh,82h,4dh
+			db	3bh,fbh,73h,bch,00h,a3h,2bh,6ah
+			db	65h,45h,8bh,3ah,b4h,1dh,9dh,bfh
+			db	b2h,ach,80h,37h,67h,5ah,cah,73h
+			db	d2h,6ch,25h,90h,a0h,4ah,6fh,fch
+			db	18h,14h,42h,52h,58h,3dh,7ah,c9h
+			db	78h,38h,abh,18h,b8h,bah,38h,16h
+			dec	b
+			ld	d,e
+			jp	z,La229
+			ld	e,(hl)
+			cp	a
+			ret	nc
+			ld	c,b
+			ld	b,(hl)
+			dec	bc
+			ld	a,3bh
+			sub	h
+			sbc	a,b
+			add	a,l
+			ccf
+			add	a,9ah
+			nop
+			ret	nz
+			ld	c,c
+			and	d
+			dec	hl
+			sbc	a,c
+			inc	d
+			adc	a,h
+			exx
+			ld	e,d2h
+			ld	b,c
+			ld	h,09h
+			ld	sp,hl
+			or	l
+			ld	l,c
+			ret	nz
+			inc	hl
+			ld	a,(b504h)
+			di
+			ld	d,l
+			ret	c
+			ld	e,84h
+			cp	e
+			ld	c,b
+			ld	c,e
+			or	h
+			ret	p
+			ld	sp,8f80h
+			in	a,(d7h)
+			ld	b,l
+			ld	a,h
+			add	hl,bc
+			ex	de,hl
+			dec	h
+			ld	d,h
+			cp	a
+			ld	d,(hl)
+			inc	bc
+			ld	c,32h
+			dec	bc
+			ld	l,b
+			ld	c,e
+			adc	a,b
+			inc	h
+			in	a,(d4h)
+			call	L4621
+			dec	e
+			push	bc
+			ld	b,a
+			ld	e,08h
+			or	c
+			ld	b,(hl)
+			ld	d,ebh
+			dec	sp
+			ld	(45e4h),hl
+			sub	e
+			inc	(hl)
+			pop	hl
+			jr	c,L5158
+			ld	c,1ah
+			ret	nz
+			ld	a,(hl)
+			call	pe,L957e
+			cpl
+			or	b
+			and	c
+			dec	l
+			xor	h
+			dec	b
+			ld	d,l
+			dec	d
+			rrca
+			ld	c,l
+			dec	hl
+			sbc	a,(hl)
+			halt
+			ld	a,(bc)
+			inc	e
+			ld	e,fbh
+			inc	de
+			di
+			ex	(sp),hl
+			add	a,h
+			ld	(hl),a5h
+			dec	h
+			ld	(hl),e
+			ld	b,e
+			ld	l,c
+			ld	h,c
+			push	bc
+			adc	a,(hl)
+			ld	l,d
+			ld	c,d
+			pop	de
+			or	h
+			ld	de,25b4h
+			ld	h,a
+			ret	p
+			ld	a,(hl)
+			rst	28h
+			ld	h,d
+			bit	1,h
+			ld	l,a6h
+			rst	18h
+			call	pe,Lafad
+			add	a,e
+			inc	h
+			ld	l,4eh
+			ex	af,af'
+			ld	bc,061fh
+			cp	c
+			ld	d,e
+			ld	c,e
+			jr	nc,L51bd
+			ld	bc,28a4h
+			xor	c
+			cp	l
+			sub	b
+			ld	h,(hl)
+			ld	sp,hl
+			add	a,77h
+			ld	l,l
+			jp	nc,L8e8b
+			cp	d5h
+			add	hl,hl
+			ld	b,b
+			sbc	a,c
+			call	pe,L304b
+			adc	a,l
+			daa
+			ld	b,d
+			sub	aeh
+			rla
+			ld	a,(de)
+			call	pe,L5640
+			add	a,c
+			dec	e
+			add	a,c
+			xor	b
+			adc	a,97h
+			nop (2x) *
+			sbc	a,a
+			adc	a,c
+			inc	de
+			add	hl,bc
+			ld	de,9d46h
+			ret	m
+			and	h
+			jp	po,L2d97
+			ld	(hl),a
+			or	a
+			ld	e,h
+			ld	h,h
+			jp	po,L54e2
+			xor	(hl)
+			jp	L2df3
+			db	f4h,34h,0dh,22h,82h,4ah,94h,6dh
+			db	76h,7ah,f3h,95h
+			di
+			ld	b,h
+			ld	l,(hl)
+			jp	z,L35a1
+			or	a
+			or	b
+			ld	e,l
+			ld	(de),a
+			add	hl,bc
+			or	d
+			ld	e,e
+			sbc	a,a
+			dec	bc
+			ld	bc,0feeh
+			ei
+			sub	a
+			jr	L522c
+			db	9dh,fdh,0bh,dfh,c9h,d0h,e0h,96h
+			db	f6h,65h,37h,78h,a4h,ebh,5dh,22h
+			db	b3h,f6h,35h,72h,48h,39h,dch,f1h
+			db	cdh,f3h,53h,5bh,dbh,dfh,8dh,08h
+			db	d2h,bch,71h,3bh,00h,1bh,63h,3eh
+			db	c0h,f6h,24h,30h,99h,5bh,01h,4ah
+			db	bbh,13h,85h,70h,23h,3ah,01h,8bh
+			db	52h,c1h
+			ld	a,d
+			xor	l
+			ret	po
+			inc	c
+			jp	z,Lcba5
+			ld	a,03h
+			inc	e
+			ld	(de),a
+			xor	b
+			jr	c,L523b
+			ld	(hl),b
+			ld	e,h
+			ld	l,d
+			cpl
+			inc	(hl)
+			scf
+			or	22h
+			rrca
+			inc	d
+			sbc	a,d
+			and	e
+			xor	d
+			adc	a,h
+			rst	08h
+			xor	iyl *
+			ld	h,e
+			jr	nc,L5268
+			ex	(sp),hl
+			ex	de,hl
+			add	a,c
+			dec	h
+			ex	af,af'
+			push	bc
+			or	b
+			adc	a,c
+			ld	a,a
+			or	l
+			ret
+			db	17h
+			call	m,L46bb
+			sub	h
+			out	(f8h),a
+			xor	e
+			jr	nz,L5213
+			ld	e,e7h
+			dec	hl
+			inc	h
+			cpl
+			ld	b,l
+			pop	de
+			jr	c,L5217
+			ld	b,h
+			ld	a,e
+			rst	08h
+			dec	d
+			jp	nc,Lc9f3
+			and	a
+			call	nz,La2b3
+			add	a,e
+			and	b
+			dec	l
+			xor	l
+			rst	10h
+			ld	a,b2h
+			xor	l
+			ld	e,e
+			dec	b
+			ret	z
+			nop (2x) *
+			cp	(hl)
+			sbc	a,d
+			xor	a
+			jp	pe,L58a3
+			add	hl,sp
+			halt
+			xor	d3h
+			ld	l,l
+			ld	c,b
+			ld	c,h
+			ld	bc,9c2dh
+			ld	hl,(07aeh)
+			dec	bc
+			cp	a
+			ld	e,h
+			ld	sp,8007h
+			di
+			nop (2x) *
+			call	nz,L2d49
+			call	c,L9cc8
+			ld	l,c
+			call	z,L9ab6
+			ld	h,e
+			add	a,a
+			and	h
+			jp	p,Lfc5c
+			call	z,L53e0
+			ld	h,9fh
+			ld	b,b
+			jp	p,L02b1
+			ld	b,d
+			rst	00h
+			ld	a,a
+			sub	a
+			jr	c,L52a9
+			ld	h,h
+			ret	m
+			ld	a,c
+			ld	sp,hl
+			and	24h
+			or	a
+			ld	b,(hl)
+			in	a,(0eh)
+			and	b
+			call	pe,L3c1d
+			add	a,95h
+			adc	a,(hl)
+			sbc	a,e
+			add	a,c
+			inc	sp
+			sbc	a,h
+			di
+			ret
+			db	08h
+			out	(f0h),a
+			xor	28h
+			adc	a,d
+			ld	h,e
+			pop	hl
+			xor	(hl)
+			xor	b
+			xor	a
+			ld	d,b
+			jr	L52f1
+			db	abh,62h,b8h,c8h
+			ld	h,h
+			sbc	a,a
+			sub	fah
+			ret	z
+			ld	h,d
+			ei
+			dec	d
+			ld	d,d
+			ld	d,d
+			ld	(de),a
+			sub	h
+			inc	(hl)
+			inc	(hl)
+			cp	e
+			ld	d,a
+			ld	sp,f608h
+			xor	h
+			ld	d,64h
+			ld	e,b
+			ld	h,h
+			add	hl,bc
+			jp	z,Ld81d
+			jp	c,Le737
+			ret	z
+			jp	po,L3b70
+			rst	30h
+			ld	d,b
+			ld	a,l
+			inc	bc
+			push	de
+			and	12h
+			cp	(hl)
+			ld	d,b
+			ret	pe
+			xor	d
+			ld	c,c
+			ld	hl,d5adh
+			dec	a
+			dec	c
+			cp	h
+			ld	c,h
+			ld	b,l
+			cp	h
+			ld	c,b5h
+			and	e
+			ld	a,d
+			rla
+			inc	c
+			ex	(sp),hl
+			ex	de,hl
+			nop
+			ld	h,d
+			rrca
+			push	de
+			jp	c,L797f
+			exx
+			call	nc,La916
+			ld	l,b
+			ld	l,d
+			inc	e
+			jr	nz,L5388
+			adc	a,l
+			cp	(hl)
+			ld	l,b
+			cp	(hl)
+			jp	m,L439c
+			ld	d,25h
+			ld	hl,bdaah
+			sbc	a,a
+			ld	b,(hl)
+			inc	l
+			jp	m,L74bc
+			and	d
+			ld	h,a
+			xor	(hl)
+			ld	d,25h
+			ret
+			db	42h,d3h,a0h,e2h,95h,86h,1eh,2fh
+			db	1eh,c8h,89h,feh
+			ret	c
+			xor	l
+			inc	l
+			sbc	a,a
+			adc	a,d
+			ld	hl,(f9b5h)
+			ret	p
+			ld	a,(hl)
+			call	nz,Lfa17
+			res	7,(ix + 114)
+			cp	b
+			and	d
+			ld	d,b
+			ld	l,d
+			rst	30h
+			xor	e
+			ld	(hl),c
+			ld	c,h
+			ld	(hl),d
+			out	(8bh),a
+			and	d
+			inc	hl
+			ld	l,b
+			jr	c,L5301
+			sbc	a,b
+			ld	d,d
+			ld	c,b
+			sbc	a,h
+			adc	a,beh
+			ld	b,b
+			di
+			push	de
+			ld	d,a
+			or	a
+			rst	18h
+			call	pe,L1855
+			cp	d
+			sbc	a,d
+			ld	a,h
+			sbc	a,d
+			ld	l,a
+			cp	l
+			xor	h
+			inc	bc
+			ld	b,l
+			ld	de,1dc5h
+			sub	e
+			call	pe,Lfb39
+			ccf
+			ld	d,h
+			inc	a
+			ld	c,a
+			cp	l
+			xor	69h
+			ld	l,b
+			pop	bc
+			ld	b,l
+			sub	b
+			ld	d,d
+			dec	a
+			sbc	a,d
+			ld	(hl),h
+			inc	bc
+			ld	h,d
+			and	c
+			ld	h,e
+			adc	a,e
+			ld	a,c
+			call	nz,L950c
+			xor	b
+			rlca
+			jp	L2c02
+			db	35h,28h,4ah,a6h,e9h,d3h,57h,23h
+			db	46h,adh,38h,43h,68h,83h,f2h,93h
+			db	2bh,56h,79h,0ch,e1h,c7h,ddh,51h
+			db	46h,bbh,85h,cbh,b0h,88h,46h,03h
+			db	88h,6fh,f9h,fdh,6eh,19h,5bh,55h
+			db	b2h,9fh,55h,89h
+			cp	b
+			adc	a,a
+			ld	d,(hl)
+			dec	hl
+			add	hl,de
+			ld	l,a
+			ret	z
+			and	c
+			ld	h,(hl)
+			ld	de,bf81h
+			adc	a,c
+			dec	e
+			add	a,l
+			ld	e,h
+			inc	a
+			exx
+			ret
+			db	64h,89h,22h,bch,2bh,feh,1dh,5ch
+			ret	m
+			ld	h,07h
+			sbc	a,(hl)
+			nop (2x) *
+			exx
+			sub	a
+			call	z,L229c
+			adc	a,d
+			jr	nz,L5385
+			xor	e
+			ld	a,(hl)
+			xor	(hl)
+			xor	h
+			adc	a,l
+			ld	d,l
+			ld	a,h
+			jp	(hl)
+			db	6eh,60h,8bh,2eh,fch,d2h,3dh,e8h
+			db	feh,d4h,55h,85h,18h,68h,2bh,d0h
+			db	60h,bbh,e1h,ach,e4h,9eh,29h,33h
+			db	cah,99h,55h,afh,2bh,f3h,04h,13h
+			db	dch,77h,a7h,b0h,d5h,e1h,1fh,dfh
+			db	04h,edh,21h,edh,a4h,0fh,e4h,7dh
+			db	03h,78h,15h,93h,04h,94h,d6h,2fh
+			db	22h,bfh,c9h,b5h,efh,57h,5fh,2fh
+			db	a1h,07h,a1h,91h,31h,10h,16h,11h
+			db	24h,dch,54h,d8h,84h,15h,bch,c1h
+			db	50h,f9h,e3h,fah,3bh,4dh,dah,8ch
+			db	96h,cfh,b0h,d1h,4fh,3bh,27h,07h
+			db	a9h,64h,97h,cch,1dh,95h,0fh,e2h
+			db	30h,1ch,6ch,2eh,01h,87h,89h,48h
+			db	3bh,56h,ffh,30h,f4h,49h,e8h,88h
+			db	5bh,3ah,f0h,edh,08h,0eh,94h,bch
+			db	97h,70h,cah,b4h,1dh,8ch,adh,51h
+			db	0dh,b8h,83h,97h,afh,0ah,47h,59h
+			db	37h,0eh,ebh,c4h,ddh,bah,5fh,a6h
+			db	40h,48h,33h,beh,aeh,21h,66h,17h
+			db	8fh,3eh,91h,82h,aah,1dh,bdh,3ch
+			db	6fh,ceh,b1h,ceh,9fh,52h,19h,55h
+			db	29h,0eh,bah,9dh,a0h,0ch,deh,a3h
+			db	89h,66h,6ch,b0h,96h,7bh,e4h,e9h
+			db	6ch,d7h,c3h,b1h,b0h,c3h,d2h,6ch
+			db	7fh,6bh,deh,9fh,f4h,14h,76h,ebh
+			db	eeh,d7h,85h,93h,6bh,1ch,eeh,76h
+			db	44h,82h,24h,a0h,85h,41h,3fh,1ah
+			db	b5h,45h,7dh,57h,78h,14h,dch,84h
+			db	8bh,04h,46h,5ch,2ah
+			ld	c,c
+			rst	00h
+			ld	c,h
+			ret	pe
+			ld	hl,a612h
+			cp	d
+			ld	d,(hl)
+			sbc	a,(hl)
+			ld	h,h
+			and	a2h
+			adc	a,a
+			inc	bc
+			dec	a
+			rst	00h
+			ld	h,b
+			xor	d
+			rst	28h
+			cp	c
+			adc	a,b
+			xor	l
+			ld	b,h
+			jp	nc,Lc9ed
+			ld	b,e
+			ld	c,b
+			ld	a,b
+			ld	h,7ch
+			dec	bc
+			ld	c,a
+			inc	h
+			sub	e
+			ld	l,2ch
+			sub	e
+			ld	b,e
+			or	e
+			sub	d
+			call	nz,Lebcf
+			cp	b
+			and	(hl)
+			jp	nc,L1b4e
+			rlca
+			inc	(hl)
+			adc	a,d
+			ld	d,(hl)
+			xor	h
+			ld	c,c
+			ld	h,l
+			or	(hl)
+			daa
+			add	a,e
+			or	c
+			sbc	a,c
+			adc	a,a
+			ld	(hl),c
+			sbc	a,c
+			xor	(hl)
+			dec	l
+			ld	(hl),d
+			ret	pe
+			rlca
+			jr	z,L54ff
+			adc	a,(hl)
+			cp	c
+			ld	(hl),7ch
+			ex	de,hl
+			sbc	a,d
+			ret	pe
+			ld	c,e
+			ld	e,e
+			adc	a,(hl)
+			inc	bc
+			sub	e
+			sub	a
+			ld	a,l
+			ld	b,e
+			and	d
+			ld	d,49h
+			add	a,l
+			or	b
+			or	h
+			ld	a,b1h
+			call	p,La9b1
+			jp	m,L4532
+			sub	(hl)
+			and	h
+			rla
+			jr	z,L550c
+			adc	a,a
+			or	e
+			and	h
+			ld	b,a
+			exx
+			ret	m
+			sbc	a,c
+			sub	l
+			dec	b
+			xor	d6h
+			and	c
+			ld	b,35h
+			ld	(456ch),sp
+			cp	(hl)
+			ld	a,d5h
+			ld	d,h
+			cp	e
+			sbc	a,c
+			ld	a,h
+			ld	b,0fh
+			sbc	a,3fh
+			sbc	a,e
+			and	l
+			ei
+			xor	(hl)
+			xor	d
+			push	hl
+			ld	d,01h
+			ld	a,(de)
+			jr	nc,L5559
+			ld	l,(hl)
+			and	(hl)
+			ld	b,b
+			ld	l,b
+			ld	(bf0dh),a
+			pop	bc
+			ld	e,45h
+			sll	h
+			dec	a
+			ld	b,b
+			inc	e
+			xor	(hl)
+			exx
+			dec	(hl)
+			ld	d,d
+			jp	z,L4759
+			ld	a,l
+			sbc	a,l
+			ld	(hl),c
+			jp	nz,Lc624
+			jp	c,Lbe9b
+			rra
+			ret	m
+			and	l
+			xor	b0h
+			add	a,(hl)
+			dec	b
+			ld	l,(hl)
+			sbc	a,l
+			inc	d
+			ld	a,(b6d0h)
+			ld	(96f4h),a
+			call	p,L6ca8
+			add	hl,sp
+			jp	pe,L7d51
+			sbc	a,e
+			sub	l
+			add	hl,hl
+			add	a,l
+			jr	L5559
+			db	73h,f7h,f5h
+			ld	(de),a
+			sub	a
+			ld	de,db3eh
+			and	d
+			cp	d
+			ld	d,d
+			ld	sp,hl
+			sub	e
+			inc	l
+			rrca
+			jr	L556f
+			db	e4h,0ah,beh,2dh,f1h,40h,7fh,e4h
+			db	1eh,0ah,62h,beh,72h,43h,b3h,0fh
+			db	cbh,3fh,c8h,ach,6ch,5fh,77h,2ch
+			db	50h,ffh,6dh,5ah,75h,e1h,ceh,80h
+			db	01h,86h,43h,cch,21h,2eh,05h,94h
+			db	7eh,dbh,44h,68h,3ah,19h,dch,61h
+			db	99h,6dh,8bh,90h,4bh,61h,2ch,67h
+			db	42h,abh,9ch,08h,19h,b5h,19h,0eh
+			db	5ch,54h,5eh,c9h,f1h,d7h,aah,32h
+			db	c6h,2ch,d3h,88h,4ah,9ch,e0h,f6h
+			db	80h,72h,adh,feh,cdh,14h,3bh,60h
+			db	f8h,11h,3ch,8eh,14h,a9h,0fh,cch
+			db	b3h,26h,0fh,b1h,aeh,6ah,4ah,f8h
+			db	3fh,2ch,28h,23h,00h,21h,03h,08h
+			db	ebh,77h,c5h,85h,61h,64h,9fh,9fh
+			db	a0h,94h,63h,9ch,adh,f8h,21h
+			add	hl,sp
+			dec	b
+			ld	l,a5h
+			inc	h
+			ld	(hl),b
+			rlca
+			rst	08h
+			call	L3067
+			adc	a,dah
+			ld	(2428h),hl
+			inc	bc
+			inc	b
+			adc	a,h
+			adc	a,e
+			push	bc
+			pop	hl
+			dec	d
+			call	m,L9d6f
+			ld	l,c
+			ld	(hl),d
+			sub	d
+			ld	a,(de)
+			ld	a,(de)
+			jp	nc,Le58d
+			ld	b,d
+			dec	e
+			sbc	a,d
+			add	a,e
+			ld	a,l
+			set	3,h
+			daa
+			ld	hl,(bd30h)
+			adc	a,b6h
+			and	h
+			add	a,e
+			and	d
+			cp	a
+			ld	b,d
+			rst	08h
+			push	bc
+			in	a,(f2h)
+			jp	nc,Laf83
+			ld	c,e7h
+			adc	a,(hl)
+			ei
+			ld	a,b
+			call	m,Lac22
+			xor	(hl)
+			xor	l
+			jp	(hl)
+			db	47h,0ah,f2h,afh,68h,beh,ceh,5eh
+			db	ebh,3eh,f7h,02h,58h,e8h,efh,34h
+			db	c8h,3ah,50h,12h,57h,d1h,f4h,4ch
+			db	5fh,e9h,eah,47h,93h,d5h,d7h,6ah
+			db	d7h,85h,7fh,18h,09h,beh,c1h,9dh
+			db	c3h,ffh,0fh,0ch,0ah,66h,2bh,3ah
+			db	80h,68h,3eh,d0h,d7h,e5h,79h,e1h
+			db	27h,02h,e4h,9bh,86h,8bh,96h,5eh
+			db	42h,ech,71h,c0h,d4h,cdh,6ch,1bh
+			db	75h,03h,d4h,0eh,66h,63h,8bh,20h
+			db	deh,63h,27h,ffh,2bh,60h,b2h,cbh
+			db	ech,75h,8eh,7ch,7ch,3ah,07h,b3h
+			db	b4h,1bh,6ch,f9h,4fh,09h,12h,8bh
+			db	67h,bfh,f0h,10h,fch,f9h,31h,bch
+			db	99h,11h,25h,a7h,30h,ffh,18h,0fh
+			db	2bh,09h,83h,a8h,ffh,48h,d0h,a2h
+			db	69h,5ah,45h,a1h,19h,20h,70h,97h
+			db	abh,d8h,c8h,f5h,07h,4eh,19h,f5h
+			db	2dh,afh,46h,04h,82h,69h,3ah
+			ei
+			jp	m,L6177
+			ret
+			jr	L571d
+			db	c6h,6fh,62h,abh,f3h,ceh,80h,89h
+			db	e0h,58h,e4h,02h,a4h,5dh,1dh,2eh
+			db	41h,e2h,84h,89h,63h,01h,1ch,91h
+			db	10h,cah,02h,d0h,97h,e5h,cbh,cah
+			db	b2h,28h,f7h,0dh,f3h,a8h,2ah,f9h
+			db	99h,84h,1bh,87h,22h,1ah,bch,ffh
+			db	73h,beh,cbh,45h,67h,e1h,50h,1dh
+			db	a0h,e2h
+			ld	hl,e105h
+			ex	(sp),hl
+			ex	af,af'
+			ld	b,b
+			inc	(hl)
+			sbc	a,l
+			ld	d,c
+			ld	l,dfh
+			ld	d,h
+			or	b
+			push	hl
+			jp	nc,Lf030
+			adc	a,(hl)
+			or	b
+			sbc	a,(hl)
+			ld	l,h
+			ex	af,af'
+			ld	c,l
+			halt
+			ld	(hl),e
+			ld	d,c
+			scf
+			inc	de
+			ld	l,(hl)
+			or	(hl)
+			and	a
+			and	e
+			jp	nc,L8db6
+			and	l
+			add	hl,sp
+			push	af
+			inc	b
+			ld	b,11h
+			ld	h,l
+			ret	nz
+			add	a,d
+			xor	l
+			inc	e
+			xor	70h
+			and	h
+			call	z,L301d
+			or	l
+			daa
+			ld	l,c
+			dec	l
+			adc	a,c
+			dec	(hl)
+			ld	a,b
+			and	c
+			ret	nz
+			xor	a
+			ld	d,h
+			sbc	a,10h
+			xor	e
+			dec	h
+			call	Lb1e7
+			or	(hl)
+			rst	38h
+			ld	a,d
+			rst	30h
+			sub	l
+			cp	c
+			cp	c
+			ld	b,c
+			inc	h
+			res	1,h
+			ld	e,l
+			ld	c,c
+			cp	3bh
+			push	de
+			adc	a,a
+			add	a,l
+			ld	a,21h
+			ld	c,a
+			and	(hl)
+			ld	b,l
+			cp	4ah
+			add	a,c
+			sub	0bh
+			dec	a
+			sub	a
+			call	m,Ldd19
+			rst	00h
+			jp	pe,Lb799
+			ret	pe
+			ex	(sp),hl
+			add	hl,bc
+			nop (2x) *
+			ld	a,1fh
+			ret	p
+			cp	a
+			dec	l
+			jr	L57e9
+			db	38h,66h,0ch,b3h,88h,ceh
+			ld	a,h
+			ld	a,(95e0h)
+			add	hl,de
+			ld	l,b
+			ld	l,c
+			jr	L5826
+			ei
+			inc	c
+			inc	sp
+			ld	hl,bdf9h
+			ld	b,(hl)
+			ld	d,l
+			nop (2x) *
+			call	L47c5
+			ld	d,(hl)
+			ld	de,7d96h
+			ret	nz
+			call	m,Le807
+			inc	a
+			ccf
+			ld	e,16h
+			pop	af
+			inc	b
+			sub	b
+			ld	(aa97h),hl
+			sub	00h
+			jp	z,L284d
+			ld	a,b
+			jr	c,L5822
+			sub	e
+			rst	00h
+			sub	d
+			ld	l,c
+			ld	a,c
+			dec	hl
+			rra
+			cp	h
+			call	m,L5f6d
+			jr	z,L5862
+			jp	m,Ld123
+			dec	a
+			di
+			add	a,(hl)
+			ld	d,b
+			nop (2x) *
+			and	a
+			call	z,Lbe76
+			adc	a,a
+			sub	d
+			or	d
+			inc	de
+			ld	h,l
+			ld	(71b1h),a
+			ld	d,a
+			di
+			rlca
+			sbc	a,l
+			add	a,(hl)
+			ld	b,e
+			ld	(hl),a
+			ret	pe
+			add	hl,sp
+			add	hl,bc
+			ld	a,(df1bh)
+			call	p,L5e95
+			inc	a
+			xor	a
+			ld	a,(hl)
+			sbc	a,b
+			add	a,(hl)
+			rrca
+			sbc	a,a
+			jr	z,L57cf
+			sub	h
+			inc	c
+			or	c
+			sbc	a,c3h
+			ld	b,h
+			dec	a
+			ld	a,(bc)
+			nop (2x) *
+			cp	b
+			or	l
+			daa
+			sub	c
+			xor	a
+			ld	l,a
+			exx
+			sbc	a,b
+			or	c
+			cp	c
+			add	a,e
+			dec	bc
+			ld	(hl),dfh
+			ex	(sp),hl
+			di
+			add	a,(hl)
+			rst	30h
+			exx
+			ld	c,b
+			jp	(hl)
+			db	05h,e3h,05h,18h,7dh,c0h,92h,04h
+			db	a9h,0bh,2bh,54h,e1h,b6h,9ch,dch
+			db	3dh,6dh,40h,b4h,24h,22h,7ch,abh
+			db	5dh,a5h,dah,43h,08h,c3h,6ch,72h
+			db	13h,d7h,7eh,2eh,9eh,94h,0ch,56h
+			db	85h,e2h,f5h,4fh,6ch,09h,ffh,d5h
+			db	10h,30h,33h,2eh,e7h,62h,4ch,0ah
+			db	36h,d0h,5bh,49h,b5h,14h,ffh,ach
+			jp	c,La72e
+			add	a,d
+			cpl
+			sbc	a,c
+			inc	sp
+			call	L6fce
+			rst	30h
+			set	7,(hl)
+			ei
+			dec	l
+			or	d
+			ld	l,h
+			sbc	a,e
+			call	m,Lb3b1
+			ld	a,44h
+			sub	c
+			or	(hl)
+			ld	d,a
+			sbc	a,e
+			ld	(hl),c
+			xor	h
+			cp	l
+			ld	hl,(db4ch)
+			ld	(hl),h
+			add	a,d
+			cpl
+			ld	a,7dh
+			ld	h,h
+			add	a,l
+			ld	d,95h
+			ld	d,c
+			rst	30h
+			ld	h,e
+			inc	de
+			ld	b,b
+			cp	a
+			adc	a,b
+			rst	00h
+			xor	(hl)
+			sbc	a,c
+			cp	c
+			ld	c,h
+			ld	hl,(beddh)
+			out	(c),d
+			inc	h
+			ld	a,b
+			add	a,a4h
+			and	h
+			ld	e,e
+			sbc	a,h
+			add	a,a
+			nop (2x) *
+			sbc	a,6ah
+			ld	l,c
+			adc	a,e
+			xor	a
+			push	de
+			rst	10h
+			sub	d
+			sub	c
+			xor	l
+			ld	(hl),b
+			jr	nc,L591d
+			ld	b,h
+			jp	po,Lbcca
+			pop	af
+			ld	(iy + f6h),c
+			di
+			add	hl,de
+			cp	c
+			scf
+			ret	c
+			ld	d,l
+			ld	a,h
+			ld	a,l
+			ld	a,a
+			ld	(hl),e
+			cp	c
+			inc	sp
+			ld	c,7ah
+			call	m,Lbeb9
+			ld	d,h
+			ret	m
+			ld	de,ffd3h
+			sbc	a,l
+			call	nz,L9cf0
+			ld	c,d
+			rla
+			inc	e
+			adc	a,b
+			in	a,(31h)
+			ld	(hl),c5h
+			ld	sp,e68fh
+			ld	(hl),e
+			sbc	a,l
+			and	e
+			ex	de,hl
+			ret	m
+			ld	d,a0h
+			djnz	L58d5
+			inc	sp
+			xor	f9h
+			sub	d
+			adc	a,b
+			cpl
+			ld	c,(hl)
+			ld	e,l
+			ld	d,a
+			adc	a,l
+			scf
+			sub	c
+			ld	h,(hl)
+			ld	a,(hl)
+			ld	l,l
+			or	d
+			ex	af,af'
+			ld	d,a
+			ld	d,a
+			ld	h,d
+			ret	m
+			ld	e,e
+			sbc	a,b
+			ret	z
+			ld	h,(hl)
+			dec	c
+			ret	nc
+			jp	(hl)
+			db	33h,a0h,9ch,8ah,d3h,30h,1eh,0eh
+			db	b5h,57h,cdh,75h
+			call	nz,L21c1
+			ld	(143dh),hl
+			ld	h,a
+			add	hl,sp
+			exx
+			and	b
+			ld	h,e
+			rst	10h
+			ret	nz
+			push	bc
+			dec	d
+			ld	h,h
+			xor	h
+			scf
+			inc	de
+			ld	l,a
+			sub	l
+			cp	c
+			cp	a
+			cp	(hl)
+			ld	d,a
+			inc	a
+			dec	d
+			ld	b,d
+			jr	z,L58fc
+			and	a
+			ld	b,l
+			ld	d,h
+			add	hl,de
+			sub	l
+			call	nc,Le377
+			rlca
+			sbc	a,l
+			ld	hl,b30eh
+			adc	a,(hl)
+			di
+			sub	e
+			inc	hl
+			rst	08h
+			pop	bc
+			call	nz,L36b4
+			jp	p,L4210
+			add	a,h
+			ld	c,d
+			jr	z,L5952
+			ld	h,b
+			ret
+			db	6ch,9eh,8ch
+			ld	l,c
+			ld	a,d
+			ld	d,(hl)
+			ld	a,d
+			ld	e,d
+			inc	bc
+			ld	h,a
+			ld	(41c1h),hl
+			or	e
+			push	bc
+			ld	(bc),a
+			jr	L5938
+			db	ach,a0h,35h,c1h,d6h,bch,f0h,8ch
+			db	23h,18h,0ch,d0h,e7h,51h,41h,1eh
+			db	45h,9fh,53h,08h,efh,86h,dbh,ceh
+			db	d8h,44h,6ch,beh,47h,62h,69h,30h
+			db	d5h,4fh,39h,8bh,9ch,5bh,bbh,35h
+			db	16h,15h,90h,1ch,2dh,44h,b9h,a8h
+			db	3dh,afh,6dh,7fh,55h,dbh,02h,39h
+			db	5ah,16h,beh,7eh,1eh,76h,35h,c5h
+			db	a0h
+			ld	a,(de)
+			ld	c,e
+			dec	c
+			push	bc
+			rst	38h
+			daa
+			ld	h,(hl)
+			ex	de,hl
+			ld	d,56h
+			sub	a
+			ld	l,e
+			sub	(hl)
+			ld	e,58h
+			ld	e,c
+			dec	sp
+			dec	(hl)
+			ld	e,b
+			ld	hl,696ch
+			push	de
+			xor	(hl)
+			call	L4915
+			ccf
+			ld	(hl),d
+			ld	l,c
+			ld	e,23h
+			and	d0h
+			ld	a,b
+			ld	a,d
+			call	m,L1d99
+			call	pe,L0a6d
+			adc	a,h
+			push	de
+			adc	a,l
+			ld	(4a7bh),a
+			rst	00h
+			rst	10h
+			ld	l,a
+			jp	nz,L1da7
+			add	a,e
+			ld	a,(de)
+			ld	b,a
+			ld	d,e
+			ld	e,b
+			ld	c,a
+			ld	b,a3h
+			and	c
+			cp	c
+			cp	d
+			call	c,L597a
+			ld	(b0dch),hl
+			ld	b,b
+			cp	c
+			inc	d
+			halt
+			xor	c
+			ld	a,c
+			ld	b,a
+			inc	h
+			ld	c,85h
+			set	1,c
+			djnz	L5a52
+			ld	a,d
+			ld	a,c
+			exx
+			jr	nc,L5aa0
+			ld	e,a
+			ld	b,h
+			dec	(hl)
+			ld	e,a
+			jp	L50ce
+			db	3eh,59h,dah,1ch,0dh,e9h,3fh,01h
+			db	bah,79h,63h,fch,a6h,99h,e0h
+			nop
+			ld	l,h
+			ld	a,e
+			ld	c,d
+			ld	(hl),b
+			ld	c,c
+			ex	de,hl
+			ld	(hl),c
+			ld	a,(de)
+			di
+			inc	e
+			pop	bc
+			ld	l,b
+			and	b
+			adc	a,e
+			rlca
+			ld	h,d
+			add	a,h
+			add	a,(hl)
+			ld	d,b
+			xor	l
+			scf
+			ld	h,(hl)
+			ld	b,b
+			push	de
+			add	hl,sp
+			and	d
+			add	a,c
+			cp	91h
+			ld	c,e
+			ld	a,h
+			ld	h,d
+			ld	a,l
+			xor	l
+			ld	l,h
+			ld	a,(bc)
+			ex	af,af'
+			nop (2x) *
+			or	a
+			rst	30h
+			adc	a,39h
+			inc	hl
+			ld	hl,(c76bh)
+			add	a,e
+			ld	l,d
+			ld	h,c
+			ld	d,b
+			adc	a,l
+			jr	nz,L5a88
+			jp	(hl)
+			db	46h,cdh,7ch,74h,4ah,6fh,fbh,5dh
+			db	e6h,feh,f3h,a3h,c0h,29h,93h,7bh
+			db	0ch,8dh,b6h,67h,f2h,87h
+			inc	h
+			pop	hl
+			inc	e
+			and	d
+			dec	hl
+			adc	a,h
+			ret	m
+			add	hl,de
+			inc	a
+			ld	b,(hl)
+			push	hl
+			ld	l,e
+			ret	z
+			jp	m,L57db
+			ld	l,d
+			and	l
+			ld	d,a
+			sub	c
+			sbc	a,d2h
+			ld	e,e
+			cp	h
+			ld	a,a
+			ld	e,l
+			cp	c
+			ld	c,c
+			xor	d
+			adc	a,a
+			adc	a,l
+			ld	c,d
+			ld	h,6fh
+			jp	nz,L8fe7
+			ld	b,(hl)
+			ld	c,l
+			sbc	a,(hl)
+			adc	a,(hl)
+			xor	h
+			jr	nz,L5ad6
+			dec	c
+			and	a5h
+			ret	c
+			jp	m,Lbe03
+			ld	hl,963ah
+			and	c
+			sub	(hl)
+			cp	8bh
+			ld	a,(de)
+			sub	l
+			and	a
+			sub	h
+			ld	e,e
+			ld	a,l
+			ld	b,d
+			ld	c,e
+			ld	(de),a
+			ld	hl,(1602h)
+			and	d
+			ld	l,ddh
+			rra
+			ret	p
+			ld	c,a
+			add	a,b
+			pop	de
+			ld	h,b
+			and	c
+			and	c
+			res	3,b
+			cp	c
+			ld	e,e
+			inc	sp
+			dec	(hl)
+			add	a,d
+			ld	d,l
+			ld	e,d
+			and	c
+			sub	e
+			ld	e,d
+			ld	b,h
+			ld	a,(f130h)
+			nop (2x) *
+			jr	z,L5acc
+			ld	l,e
+			cp	l
+			sub	c
+			jp	c,L7d5f
+			ld	(hl),b
+			add	a,e
+			ld	(bc),a
+			sub	e
+			ld	e,a
+			djnz	L5b19
+			ld	sp,8475h
+			djnz	L5ae7
+			rst	10h
+			inc	h
+			sub	b
+			exx
+			ret	p
+			rla
+			out	(56h),a
+			jp	nc,L3455
+			and	l
+			inc	de
+			cp	b
+			sub	8bh
+			ex	de,hl
+			adc	a,l
+			rst	20h
+			ld	e,a
+			adc	a,d
+			ld	b,99h
+			ld	h,l
+			cp	b
+			jp	z,L4de2
+			out	(0ah),a
+			and	d
+			cp	d
+			ld	b,c
+			ld	bc,dba5h
+			ld	a,a
+			ld	(bc),a
+			and	(hl)
+			ret	nc
+			call	z,Le5d3
+			jp	nc,L3fa4
+			ld	sp,ae54h
+			ld	(hl),17h
+			xor	d
+			sbc	a,c
+			or	a
+			inc	l
+			and	7fh
+			ld	l,d
+			inc	a
+			ret	nz
+			inc	a
+			ld	c,(hl)
+			ex	(sp),hl
+			and	e
+			ld	l,(hl)
+			jp	c,L9e5c
+			add	hl,bc
+			push	hl
+			rst	20h
+			inc	h
+			nop
+			ld	hl,7e41h
+			adc	a,a
+			ld	d,l
+			dec	l
+			ld	h,c
+			cp	e
+			ld	(hl),c
+			ret	m
+			ret	c
+			rst	10h
+			ld	sp,1879h
+			ret	po
+			push	af
+			inc	a
+			ld	h,d
+			jp	z,L1c76
+			ex	(sp),hl
+			call	nc,L2f8d
+			jp	iy
+			jr	c,L5b0f
+			call	z,L9abe
+			ld	(306fh),hl
+			nop (2x) *
+			ld	b,e
+			jr	c,L5b22
+			ld	d,h
+			rst	00h
+			dec	hl
+			inc	d
+			sbc	a,e
+			jr	nc,L5b28
+			ld	c,h
+			and	l
+			ld	(hl),c
+			inc	c
+			dec	b
+			call	po,Le598
+			adc	a,b
+			adc	a,l
+			ld	(hl),6eh
+			ret	p
+			ld	d,(hl)
+			ld	h,a6h
+			ld	d,l
+			add	a,d
+			and	4ah
+			ld	l,(hl)
+			ret	c
+			ld	de,1bedh
+			inc	c
+			ret	c
+			and	d
+			ld	h,(hl)
+			jp	c,La3cd
+			sub	c
+			add	a,(hl)
+			pop	bc
+			inc	e
+			jp	po,L6e25
+			jp	L1904
+			db	ceh,35h,63h,13h,80h,43h,70h,89h
+			db	9ah,ech,cah,c8h,e9h,a2h,e5h,b0h
+			db	e6h,5ah,68h,d3h,0dh,4ah,d7h,1ah
+			db	b7h,9eh,71h,35h,e2h,3bh,0fh,6bh
+			db	1bh,85h,feh,c3h,85h,60h,ach,edh
+			db	45h,61h,64h,3fh,17h,42h,0fh,8ah
+			db	f3h,12h,86h
+			ld	(hl),h
+			and	c
+			jr	nc,L5c57
+			dec	c
+			ld	e,e
+			ld	a,(hl)
+			call	c,L6ad0
+			ld	d,l
+			jr	c,L5bf9
+			ld	e,(hl)
+			and	c
+			inc	(hl)
+			or	c
+			or	c
+			cp	c
+			ld	e,l
+			dec	sp
+			ld	d,72h
+			ld	l,a
+			im	0/1 *
+			ld	c,e
+			sub	c0h
+			ld	d,d
+			jr	nz,L5c52
+			daa
+			ld	e,a
+			inc	hl
+			cp	l
+			ret	p
+			adc	a,b
+			xor	h
+			ld	b,c
+			ret	m
+			di
+			ret	z
+			ld	b,a
+			ld	de,b5c0h
+			sub	h
+			jp	m,Ld0ff
+			jp	Lde48
+			db	4ch,fbh,89h,d4h,c3h,98h,dbh,aeh
+			db	5fh,77h,cdh,9fh,f8h,4ch,d4h,6ah
+			db	eeh,a1h,a8h,c4h,29h,c6h,33h
+			jp	z,Lc7ea
+			xor	b
+			and	(hl)
+			ld	(hl),e
+			ld	(hl),a
+			rst	18h
+			pop	af
+			and	a2h
+			ld	l,h
+			nop
+			cpl
+			rrca
+			sub	c
+			and	a
+			pop	de
+			ld	e,(hl)
+			pop	hl
+			ld	l,e
+			or	d
+			ld	e,l
+			cp	h
+			ld	bc,eec9h
+			ld	b,d
+			ld	a,(bc)
+			sub	b
+			ld	a,h
+			ld	sp,hl
+			ld	c,c
+			and	h
+			rst	28h
+			and	(hl)
+			nop
+			call	c,L2833
+			cp	c
+			dec	a
+			jp	p,Laf21
+			sub	e
+			dec	de
+			rst	10h
+			ei
+			call	pe,Lb8e3
+			out	(35h),a
+			ccf
+			ld	l,l
+			ld	d,l
+			call	po,Lc60e
+			or	b8h
+			cp	b
+			ld	a,a
+			ld	sp,ec3bh
+			jp	po,Lbda2
+			or	h
+			ld	sp,774ch
+			jp	L12d8
+			db	9ch,25h,5ah,79h,b9h,d9h,59h,edh
+			db	d7h,98h,76h,0eh,c7h,fch,b3h,a0h
+			db	47h,dbh,66h,88h,fbh,3dh,0bh,8ch
+			db	b3h,70h,f6h,cbh,45h,afh,87h,e3h
+			db	1fh,cdh,ech,c8h,cah,76h,8dh,14h
+			db	beh,0eh,7bh,e2h,21h,2bh,45h,75h
+			db	16h,40h,7bh
+			xor	d
+			call	nz,L62c6
+			add	a,h
+			ld	de,8681h
+			ret	pe
+			add	a,6eh
+			ld	d,(hl)
+			ld	(hl),e
+			ld	h,d
+			rst	38h
+			ld	c,c
+			xor	b
+			jr	c,L5c54
+			ld	l,h
+			ccf
+			call	p,Lc06a
+			cp	l
+			jp	pe,L09e4
+			rst	00h
+			pop	de
+			jr	c,L5c5c
+			ld	h,d
+			ld	l,f7h
+			ld	e,a
+			dec	e
+			sbc	a,d
+			ld	a,e
+			sbc	a,b
+			and	l
+			ld	a,d
+			sbc	a,b
+			ld	e,e
+			ld	h,12h
+			ld	c,c
+			jr	z,L5ceb
+			ld	l,l
+			inc	a
+			push	bc
+			call	nz,L6c1c
+			ld	sp,1f39h
+			or	e
+			cpl
+			in	a,(1ah)
+			rst	28h
+			ld	d,l
+			ld	e,b
+			ld	a,e
+			push	af
+			ret	m
+			ld	l,30h
+			ld	e,a
+			inc	bc
+			ld	a,(hl)
+			ld	a,e
+			call	m,La49c
+			ld	h,h
+			or	d
+			or	h
+			dec	e
+			and	l
+			or	h
+			ld	e,e
+			ld	h,e
+			inc	b
+			jr	z,L5d18
+			ld	h,(hl)
+			ld	c,b
+			inc	l
+			sub	(hl)
+			rra
+			and	b
+			or	e
+			ld	(bc),a
+			sbc	a,d
+			inc	h
+			ld	a,d
+			inc	de
+			ret	po
+			rrca
+			ld	hl,56f5h
+			ld	l,(hl)
+			jr	nc,L5d21
+			ld	(hl),l
+			jp	p,L92a9
+			ld	b,c
+			pop	bc
+			di
+			daa
+			ld	a,a
+			ret	m
+			ld	l,e
+			sbc	a,53h
+			adc	a,01h
+			ld	b,l
+			inc	d
+			cp	3ah
+			ld	(de),a
+			or	e
+			ld	iyh,e *
+			ld	hl,b67eh
+			and	1bh
+			ld	a,l
+			adc	a,d
+			and	b
+			ld	a,e
+			inc	(hl)
+			ld	e,(hl)
+			add	a,b
+			dec	b
+			inc	sp
+			rla
+			call	z,Laf9c
+			jp	L04a3
+			db	6bh,bch,9dh,7ah,0dh,d5h,d7h,fbh
+			db	adh,50h,b2h,e7h,13h,7dh,4fh,b2h
+			db	76h,feh,b2h,44h,14h,ech,f3h,3ah
+			db	38h,3fh,35h,0dh,bah,e3h,c0h,32h
+			db	0ah,97h,68h,1dh,00h,15h,a7h,13h
+			db	2ah,d2h,89h,61h,15h,43h,ceh,eah
+			db	8bh,afh,0ah,f8h,e4h,b1h,70h,cdh
+			db	77h,5eh,17h,0ch,17h,19h,d6h,08h
+			db	3dh,61h,3ah,fbh,33h,f2h,f1h,80h
+			db	4dh,74h
+			ld	(hl),h
+			ld	e,(hl)
+			inc	bc
+			jp	p,Lcb82
+			res	5,e
+			ld	c,l
+			ccf
+			ld	b,d
+			ld	c,c
+			ld	l,a
+			xor	(hl)
+			xor	h
+			add	a,c
+			halt
+			ld	(de),a
+			ld	l,e
+			or	l
+			and	b
+			dec	h
+			djnz	L5e0d
+			ld	e,a
+			ld	e,c
+			sbc	a,b
+			ld	d,c
+			ld	d,c
+			ld	hl,d6e5h
+			ld	e,d
+			in	a,(b3h)
+			or	a
+			call	po,Laffe
+			ld	e,a
+			cp	h
+			cp	a
+			call	po,L6aef
+			and	a
+			ld	d,e
+			push	af
+			ld	e,c
+			dec	sp
+			ld	d,h
+			jp	c,L22ba
+			rrca
+			ld	e,d
+			ld	c,c
+			add	a,7fh
+			sub	(hl)
+			inc	a
+			rst	08h
+			ld	a,dch
+			nop (2x) *
+			ld	d,c
+			jp	m,L1cd1
+			adc	a,(hl)
+			ld	(de),a
+			rst	30h
+			ld	c,l
+			ld	c,b
+			ld	b,h
+			ex	de,hl
+			exx
+			and	d
+			or	c
+			cp	c
+			ld	h,a
+			ld	e,(hl)
+			ld	d,l
+			add	a,46h
+			jr	z,L5e1b
+			ld	d,40h
+			sub	c
+			ld	h,e
+			cp	b
+			jp	L18c7
+			db	13h,4fh,76h,7bh,f8h,57h,d3h,c1h
+			db	06h,d6h,1ah,e1h,42h,dch,5fh,5bh
+			db	5fh,70h,edh,fdh
+			push	hl
+			ld	d,b
+			ld	l,e
+			dec	de
+			daa
+			sbc	a,h
+			ld	a,a
+			inc	a
+			dec	a
+			sub	e
+			ld	bc,6d0dh
+			or	c
+			ld	d,d
+			adc	a,l
+			inc	b
+			jr	c,L5de4
+			ld	l,(hl)
+			pop	bc
+			inc	c
+			and	48h
+			ret	m
+			rst	30h
+			ld	(hl),h
+			dec	d
+			rst	18h
+			inc	d
+			nop (2x) *
+			rst	10h
+			add	a,b
+			ld	c,h
+			jp	(hl)
+			db	b9h,8fh,65h,bdh,3dh,fch,67h,34h
+			db	35h,e8h,aah,4fh,30h,5ch,34h,f0h
+			db	f6h,14h,0ch,d5h,38h,2dh,01h,a1h
+			or	l
+			adc	a,a
+			or	b
+			ld	(hl),c
+			adc	a,b
+			ld	e,9bh
+			cp	h
+			ei
+			sbc	a,l
+			sbc	a,c
+			rrca
+			add	a,c
+			or	c
+			cp	a
+			ld	b,(hl)
+			jp	L6911
+			db	8fh,d8h,bfh,70h,a7h,a3h,a9h,95h
+			db	d3h,28h,f1h,5fh,5dh,5dh,6fh,73h
+			db	2ah,79h,92h,46h,4ah,2dh,89h,9dh
+			db	24h,2fh,15h,84h,48h,4ch,66h,edh
+			db	1fh,06h,5fh,6dh,6fh,2eh,1ch,5ah
+			db	17h,f3h,89h,aeh,a6h,a0h,1bh,c8h
+			db	67h,00h,e0h
+			ld	e,(hl)
+			jp	p,L0ecd
+			adc	a,a
+			push	de
+			rst	28h
+			sub	deh
+			or	c
+			out	(6ah),a
+			and	e
+			jp	nz,L2a40
+			ld	e,d
+			sbc	a,e
+			ld	h,e
+			ld	(hl),a
+			and	1ch
+			or	a
+			xor	b
+			xor	h
+			ld	a,e
+			ld	a,(bc)
+			inc	c
+			ld	a,0ah
+			jp	pe,La7c5
+			djnz	L5edc
+			ld	b,d
+			nop
+			dec	bc
+			ld	h,l
+			add	a,44h
+			ld	c,(hl)
+			ld	h,d
+			ld	e,(hl)
+			or	h
+			inc	bc
+			cp	c
+			ld	d,c
+			ld	bc,49b2h
+			push	bc
+			cpl
+			or	58h
+			jr	c,L5e48
+			inc	sp
+			sub	(hl)
+			cpl
+			ld	a,e
+			ld	(hl),e
+			ld	a,(hl)
+			push	af
+			ld	d,c
+			pop	de
+			exx
+			or	(hl)
+			call	Lfea5
+			ld	a,d
+			ld	a,e5h
+			cp	a
+			ld	a,d
+			cpl
+			adc	a,(hl)
+			dec	sp
+			ret
+			db	5ch,efh,dfh,61h,fdh,c8h,a6h,30h
+			db	8eh,91h,65h,7ch,4eh,8ah,e0h,73h
+			db	dbh,54h
+			call	nz,L889b
+			ret	z
+			ld	e,c
+			jr	L5f02
+			db	9bh,1bh,70h,32h,5ah,5ah,9ah,29h
+			db	80h,02h,bdh
+			dec	(hl)
+			rst	28h
+			ld	h,40h
+			ld	l,l
+			dec	h
+			ld	c,a
+			sbc	a,b
+			push	bc
+			and	b
+			add	a,06h
+			nop (2x) *
+			cp	c5h
+			ld	a,75h
+			dec	c
+			ld	a,h
+			bit	1,l
+			rst	00h
+			nop (2x) *
+			ld	l,a
+			ld	a,a
+			pop	de
+			add	hl,de
+			ld	h,b
+			cp	68h
+			dec	l
+			cpl
+			adc	a,h
+			jr	z,L5ed1
+			or	l
+			and	(hl)
+			xor	b
+			ld	l,h
+			daa
+			ld	d,b
+			ld	l,(hl)
+			inc	(hl)
+			scf
+			ld	d,b
+			ld	e,(hl)
+			ld	c,h
+			cpl
+			sbc	a,l
+			sbc	a,e
+			or	c
+			call	Ld3e3
+			ld	e,c
+			cp	e
+			ld	e,(hl)
+			ret	po
+			jp	c,L06b4
+			and	e
+			nop (2x) *
+			and	b
+			add	hl,hl
+			ld	a,(de)
+			adc	a,a
+			ld	l,e
+			ld	d,b
+			call	po,Lf682
+			adc	a,c
+			ld	(bc),a
+			and	c
+			ld	b,(hl)
+			rst	28h
+			rst	28h
+			sub	c
+			ld	e,(hl)
+			ld	(bc),a
+			pop	bc
+			ccf
+			ld	l,c
+			ld	b,b
+			or	c
+			call	m,Lf1cd
+			ld	d,a
+			jp	c,Lbb83
+			push	hl
+			ld	b,d
+			and	b
+			ld	e,91h
+			call	p,La8db
+			inc	sp
+			sbc	a,a
+			inc	de
+			sub	l
+			ld	l,f0h
+			jr	z,L5fe3
+			pop	de
+			cp	cfh
+			ld	a,h
+			ld	d,c
+			ld	b,l
+			and	a
+			inc	hl
+			dec	a
+			xor	cch
+			ld	(hl),c
+			and	h
+			pop	de
+			add	a,(hl)
+			ld	d,b
+			ld	(hl),c
+			cp	c
+			halt
+			dec	b
+			sub	l
+			or	c
+			adc	a,c
+			xor	l
+			ld	(hl),h
+			daa
+			rla
+			sub	(hl)
+			di
+			or	c
+			ret	po
+			inc	hl
+			ld	(de),a
+			inc	(hl)
+			xor	c8h
+			ld	e,a
+			ld	b,b
+			ld	a,h
+			and	h
+			jp	pe,L2199
+			inc	sp
+			add	a,adh
+			ld	b,08h
+			sbc	a,a
+			sub	(hl)
+			add	a,d
+			add	a,b
+			inc	sp
+			ld	h,h
+			ld	c,b
+			jp	(hl)
+			db	6fh,1ah,12h
+			ld	l,a
+			adc	a,d
+			sub	h
+			ld	e,c
+			add	a,(hl)
+			ld	l,h
+			dec	bc
+			cp	b
+			add	hl,de
+			ld	(hl),d
+			ret	m
+			add	a,b
+			sub	c
+			ld	e,d
+			xor	a
+			ld	d,h
+			ld	(bc),a
+			ld	a,(hl)
+			ld	(hl),e
+			ld	(hl),e
+			ld	e,d
+			dec	hl
+			ld	(de),a
+			jp	L40f1
+			db	96h,31h,4eh,96h,a6h,70h,d9h,f4h
+			db	9dh,dch,3dh,45h,8dh,4ch,9bh,13h
+			db	97h,f8h,59h,8fh,14h,58h,4ah,36h
+			db	bbh,9ch,d2h,edh
+			ld	d,h
+			sub	b
+			ld	l,d
+			ld	bc,eecbh
+			inc	e
+			ld	h,d
+			ld	a,(bc)
+			ld	a,a
+			ld	h,(hl)
+			xor	1fh
+			inc	bc
+			ld	e,dfh
+			inc	sp
+			xor	e1h
+			dec	h
+			sub	a
+			inc	de
+			sub	e
+			dec	bc
+			or	e
+			add	hl,bc
+			adc	a,l
+			ld	a,d
+			ld	b,a
+			set	5,l
+			push	af
+			dec	a
+			sub	78h
+			ret	pe
+			sub	h
+			ld	e,l
+			xor	h
+			sub	c
+			inc	h
+			jp	m,L7f2a
+			ld	b,c
+			cpl
+			ld	d,l
+			add	a,33h
+			ld	b,l
+			ld	b,a
+			add	a,e
+			ld	b,l
+			call	nc,Lde64
+			inc	b
+			ld	b,h
+			dec	sp
+			and	e
+			nop
+			ld	d,h
+			xor	d
+			sub	l
+			inc	de
+			jp	po,Ldeb8
+			sub	h
+			cp	c
+			add	hl,hl
+			ld	h,c
+			and	h
+			ret	z
+			inc	de
+			or	e
+			jp	nz,L9c30
+			ld	a,c
+			jp	p,L334a
+			inc	e
+			ld	a,c
+			ld	a,e
+			inc	sp
+			inc	hl
+			ld	b,d
+			jp	p,L5f9f
+			ret
+			db	afh,aah,38h,67h,b0h,bdh,4ch,8bh
+			db	4ah,f6h,8ch,5fh,bch,52h,e1h,07h
+			db	c4h,e5h,25h,c2h,72h,3dh,b4h,aeh
+			db	41h,5ch,41h,9bh,35h,50h,65h,07h
+			db	f5h,c3h,4ch,71h,91h,4eh,01h
+			ld	(hl),a5h
+			cp	58h
+			ld	h,99h
+			jr	z,L60b1
+			add	a,(hl)
+			jr	nc,L6085
+			dec	d
+			ld	c,c
+			adc	a,l
+			call	p,Ld07a
+			ld	l,a
+			and	d
+			ld	d,h
+			inc	hl
+			add	a,h
+			push	de
+			or	a
+			ld	h,d5h
+			ld	(e33eh),hl
+			and	l
+			nop (2x) *
+			call	pe,Lc9bd
+			or	e
+			call	L9e30
+			ret	z
+			or	02h
+			adc	a,(hl)
+			inc	d
+			ld	b,c
+			sub	d
+			push	de
+			ld	(hl),h
+			daa
+			jp	po,L82dd
+			dec	hl
+			ret	po
+			dec	hl
+			or	e
+			ld	a,e
+			ld	b,l
+			sbc	a,c
+			sub	e
+			dec	(hl)
+			res	7,(hl)
+			call	c,L9115
+			call	nz,L0814
+			sbc	a,5eh
+			ld	h,1dh
+			xor	h
+			sbc	a,a
+			ld	b,b
+			xor	a
+			inc	hl
+			call	nc,L9f4c
+			jp	L4dc8
+			db	0bh,02h,96h,cch
+			ld	a,(73e6h)
+			ld	l,e
+			rst	30h
+			ld	l,c
+			adc	a,93h
+			ld	b,11h
+			rst	20h
+			jr	nz,L6096
+			jp	po,L5371
+			jr	nz,L60ea
+			dec	(hl)
+			ld	e,d
+			pop	bc
+			ex	(sp),hl
+			nop (2x) *
+			ld	a,a
+			add	a,b6h
+			rst	28h
+			add	a,l
+			ret	z
+			di
+			sbc	a,e
+			ld	l,b
+			ld	d,d
+			rst	18h
+			ld	a,e
+			and	e
+			xor	l
+			ld	e,d
+			adc	a,l
+			dec	sp
+			inc	c
+			rst	18h
+			ld	h,d
+			ld	b,d
+			ld	b,h
+			djnz	L60bd
+			inc	c
+			ld	bc,8359h
+			sbc	a,b
+			ld	b,h
+			inc	(hl)
+			exx
+			inc	c
+			ld	(bc),a
+			ld	hl,(d659h)
+			ld	l,b
+			ld	h,d
+			ret
+			db	24h,c5h,7ah,dah,87h,dbh,dfh,50h
+			db	e9h,e2h,aeh,cbh,8ah,94h,39h,62h
+			db	e8h,54h,1fh,e9h,9ah,70h,13h
+			ld	l,b
+			sub	l
+			ld	b,17h
+			or	(hl)
+			add	hl,hl
+			in	a,(a9h)
+			ld	l,h
+			ld	d,l
+			ld	hl,(6472h)
+			ld	e,d0h
+			and	c
+			ld	h,c
+			ld	a,l
+			ld	h,a2h
+			sub	e
+			ret
+			db	feh,53h,dah,0dh,8fh,80h,96h,94h
+			db	5ah,38h,4bh,40h,6dh,2ah,edh,b5h
+			db	bfh,bch,e8h,2fh,fch,e3h,a8h,38h
+			db	54h,abh,e0h,ebh,77h,34h,e2h,ach
+			db	b4h,1bh,31h,85h,04h,dfh,01h,dch
+			db	c2h,f3h,1bh,ech,24h,5bh,beh,e1h
+			db	bbh,aeh,22h,c0h,b2h,7bh,ebh,31h
+			db	38h,a6h,f2h,66h,09h,76h,65h,27h
+			db	d7h,9ah,b9h,7dh,f0h,73h,16h,fch
+			db	d3h,68h,84h,bah,65h,70h
+			xor	c
+			daa
+			ld	h,d
+			ex	de,hl
+			ld	d,a
+			ld	h,d
+			nop (2x) *
+			add	a,d
+			call	po,La194
+			add	a,b
+			halt
+			or	l
+			halt
+			cp	(hl)
+			ld	h,c
+			jp	c,L6dea
+			and	c
+			in	a,(83h)
+			cp	a
+			ei
+			inc	c
+			ld	e,l
+			add	a,a
+			inc	c
+			sub	a
+			push	de
+			rst	18h
+			ld	b,dah
+			pop	bc
+			jr	nc,L61b0
+			add	hl,bc
+			ld	c,c
+			xor	d
+			dec	e
+			ret	po
+			ld	c,c
+			or	l
+			xor	b
+			add	hl,hl
+			ld	a,a
+			ld	h,b
+			ld	h,(hl)
+			jp	(hl)
+			db	b8h,2ah,63h,35h,a1h,26h
+			cp	a
+			ld	hl,(ce96h)
+			rlca
+			dec	b
+			ld	e,c
+			rst	38h
+			xor	(hl)
+			jp	(hl)
+			db	06h,d6h,40h,99h,93h,c2h,d1h,bch
+			db	6ch,5ch,cch,cfh,90h,a8h,70h,3ah
+			db	c4h,4ch,90h,c3h,1ch,08h,b7h,85h
+			db	4fh,b4h
+			daa
+			ld	l,d
+			daa
+			cp	h
+			ret	pe
+			and	l
+			jp	(hl)
+			db	97h,27h,d2h,a1h,adh,35h,90h,06h
+			db	8fh,77h,09h,7ah
+			add	a,e
+			ld	c,d
+			ld	c,l
+			cp	d
+			ld	sp,08dfh
+			jp	L7ff1
+			db	33h,ebh,a7h,3eh,b7h,21h,d5h,70h
+			db	dbh,3bh,12h,a2h,abh,adh,71h,a3h
+			db	ffh,7fh,b5h,e7h,7dh,f6h,f6h,40h
+			db	99h,60h,3bh,4fh,82h,38h,1dh,a6h
+			db	9fh,beh,11h,e2h,74h,18h,5ch,54h
+			db	4ch,95h,80h,e8h,7ch,14h,67h,56h
+			db	8eh,10h,b7h,efh,d4h,71h,25h,38h
+			db	8ah,14h,69h,8fh,cch,b9h,34h,79h
+			db	74h,88h,99h,c8h,fch,a0h,5ch,09h
+			db	a2h,a5h,f8h,a6h,80h,31h,2fh,32h
+			db	05h,8dh,e3h,72h,81h
+			ld	d,d
+			djnz	L61d3
+			inc	d
+			halt
+			ld	a,a
+			ret	m
+			daa
+			ld	(hl),d
+			ld	(bc),a
+			add	a,e
+			nop (2x) *
+			jp	L4176
+			db	73h,b5h,8fh,1eh,5bh,c2h,04h,12h
+			db	f0h,e4h,0dh,79h,feh,67h,9dh,cdh
+			ld	a,(de)
+			ld	hl,(fc1fh)
+			or	c
+			srl	h
+			add	hl,hl
+			rst	00h
+			ld	e,e
+			rla
+			sbc	a,l
+			ld	a,d
+			ld	b,c
+			ld	e,l
+			ld	a,d
+			ld	b,d
+			or	19h
+			ld	a,(de)
+			rrca
+			push	af
+			rst	20h
+			pop	hl
+			push	bc
+			sub	l
+			or	e
+			sbc	a,b
+			ld	e,h
+			or	b
+			sub	b0h
+			ex	de,hl
+			push	bc
+			ld	a,d
+			daa
+			ld	e,h
+			adc	a,60h
+			ld	e,e
+			dec	h
+			ld	h,l
+			ld	c,b
+			ld	d,d
+			dec	d
+			ld	a,b
+			inc	l
+			inc	hl
+			ld	a,(bc)
+			dec	(hl)
+			rst	08h
+			ld	b,4dh
+			inc	sp
+			ex	af,af'
+			sbc	a,16h
+			ld	c,c
+			jp	L12cf
+			db	37h,d4h,4fh,2ch,87h,0eh,2eh,82h
+			db	80h,3dh,ffh,78h,a8h,7ch,a5h,a4h
+			db	19h,75h,9ch,09h,66h,a5h,0eh,f1h
+			db	53h,a5h,9ch,b4h,2bh,89h,f1h,06h
+			db	d4h,33h,48h,88h
+			and	e
+			sbc	a,a
+			ld	l,b
+			ld	h,(hl)
+			sbc	a,l
+			cp	(hl)
+			ld	a,a
+			ld	h,a
+			nop (2x) *
+			ccf
+			dec	bc
+			ld	(bc),a
+			dec	b
+			jp	pe,L4788
+			push	hl
+			ld	d,c
+			and	60h
+			jr	c,L6327
+			sbc	a,l
+			jp	nc,Ldff0
+			ld	(hl),1ah
+			or	c
+			push	de
+			and	l
+			adc	a,c
+			ld	e,h
+			ld	d,bah
+			or	c
+			xor	a
+			jp	pe,L852c
+			add	a,l
+			or	a
+			ld	a,a
+			cp	b
+			ld	a,(hl)
+			and	h
+			jr	nc,L6362
+			sbc	a,h
+			inc	hl
+			ei
+			ld	b,b
+			inc	l
+			rrca
+			rrca
+			jp	po,L1b1f
+			cp	b
+			ld	l,a
+			cp	68h
+			ld	hl,36adh
+			sbc	a,h
+			add	a,(hl)
+			inc	d
+			ld	a,(ed9bh)
+			jp	po,Lc4e5
+			ld	(hl),h
+			ld	h,d3h
+			ld	h,e8h
+			ld	iyl,a *
+			adc	a,a
+			jp	Ld0d9
+			db	b0h,9eh,d8h,3eh,5dh,d6h,26h,28h
+			db	c9h,6eh,08h,19h
+			sub	a
+			ld	e,b
+			cp	c
+			ld	b,d
+			ld	d,d
+			rla
+			dec	de
+			djnz	L62db
+			ld	(bc),a
+			ld	h,b
+			ld	(4a1eh),a
+			ex	(sp),hl
+			ld	e,a
+			xor	a
+			scf
+			inc	sp
+			ld	d,(hl)
+			ld	a,(77f8h)
+			ld	e,h
+			set	1,a
+			adc	a,e
+			cp	c
+			ld	b,b
+			ld	b,h
+			ld	a,l
+			halt
+			ld	c,9ch
+			cp	c
+			ld	c,e
+			and	c
+			rrca
+			ld	a,a
+			ret	c
+			jp	c,L03ab
+			ld	h,c
+			and	a
+			inc	d
+			add	a,d
+			ld	sp,6fe2h
+			ld	(hl),e
+			rra
+			ld	b,l
+			ld	bc,21bdh
+			jr	z,L62e8
+			push	bc
+			pop	de
+			ld	a,(9866h)
+			sbc	a,h
+			sbc	a,c
+			ld	d,e
+			add	a,h
+			add	hl,sp
+			ld	e,(hl)
+			add	a,e
+			ld	a,h
+			adc	a,(hl)
+			ld	c,a
+			ei
+			ld	a,(hl)
+			sbc	a,l
+			ld	h,a
+			ld	c,h
+			or	h
+			add	a,a7h
+			ld	(hl),19h
+			ld	a,d
+			jr	z,L639c
+			ld	c,b
+			out	(feh),a
+			call	nz,L4162
+			ld	d,92h
+			ld	d,9ch
+			cp	97h
+			ld	l,b
+			push	af
+			cp	(hl)
+			dec	bc
+			ret	m
+			ei
+			halt
+			ccf
+			dec	hl
+			ld	b,l
+			ld	sp,hl
+			or	(hl)
+			ld	de,806ch
+			ld	l,a
+			ld	h,d
+			or	d7h
+			jp	p,Lc8f5
+			ld	(hl),d
+			dec	hl
+			dec	c
+			jp	nc,Lf751
+			ld	a,a
+			dec	hl
+			ld	l,h
+			ld	h,a
+			call	L66ad
+			add	hl,hl
+			inc	e
+			push	bc
+			ld	a,(e46ch)
+			ld	b,h
+			call	c,L8da2
+			ld	h,c
+			ld	de,65d9h
+			ld	e,e
+			cp	72h
+			dec	bc
+			dec	l
+			ld	(bc),a
+			xor	c
+			call	po,L6631
+			rst	10h
+			ld	b,(hl)
+			rra
+			ld	l,l
+			ld	l,c
+			ld	h,l
+			ld	sp,2368h
+			ld	(ca98h),hl
+			ret	pe
+			ld	h,a
+			ld	d,b
+			ld	c,d
+			ld	a,d
+			adc	a,h
+			ld	a,ixh *
+			ld	l,(hl)
+			ld	c,d
+			dec	b
+			ld	hl,(82d2h)
+			dec	a
+			ei
+			adc	a,d
+			or	43h
+			djnz	L636d
+			ld	d,h
+			jr	c,L63b4
+			ld	e,h
+			ld	d,(hl)
+			jp	po,L5ecd
+			sub	a
+			xor	d
+			add	a,b
+			ld	l,a
+			ld	d,1ch
+			jp	nz,Ld8a5
+			ld	e,l
+			rst	10h
+			sub	a
+			ld	(hl),h
+			ld	hl,c9bfh
+			ld	e,b
+			and	d
+			or	(hl)
+			ld	(hl),62h
+			halt
+			ld	e,3fh
+			dec	e
+			sbc	a,l
+			ld	c,a
+			ld	b,d
+			ld	hl,2dd4h
+			ld	b,(hl)
+			ld	l,a
+			inc	e
+			call	c,Lced0
+			ld	e,d
+			ex	af,af'
+			ld	b,h
+			ld	b,a
+			ld	b,h
+			ld	(hl),h
+			ret	m
+			pop	bc
+			dec	l
+			ld	(hl),l
+			sbc	a,a
+			and	(hl)
+			inc	h
+			jp	pe,La000
+			dec	b
+			ld	bc,786bh
+			ld	b,a
+			cp	a
+			cp	e
+			nop (2x) *
+			ld	(743bh),a
+			dec	hl
+			di
+			pop	bc
+			pop	hl
+			dec	de
+			call	nz,L892c
+			xor	h
+			jr	c,L63d4
+			or	c
+			ld	b,d
+			sbc	a,e
+			adc	a,h
+			ex	af,af'
+			or	c3h
+			djnz	L64b9
+			ld	e,a
+			or	a
+			ld	de,5f02h
+			ld	c,cch
+			ld	a,(956ch)
+			add	hl,de
+			ld	(02c9h),hl
+			ld	sp,3aa0h
+			ld	(hl),c
+			ld	l,b
+			sbc	a,(hl)
+			or	e
+			ld	a,b
+			xor	l
+			cp	h
+			add	a,96h
+			ld	l,l
+			call	p,Lb279
+			push	bc
+			push	hl
+			ld	e,c
+			and	a
+			jp	z,L9a1a
+			or	70h
+			rrca
+			ld	l,d
+			adc	a,h
+			add	a,l
+			jr	c,L64ee
+			rst	10h
+			inc	(hl)
+			ret	p
+			ld	h,c
+			ld	e,c
+			xor	h
+			ld	d,b
+			dec	c
+			ld	l,b
+			push	bc
+			ld	c,b
+			ld	(hl),h
+			sub	a
+			rst	38h
+			adc	a,l
+			dec	de
+			ld	bc,9d4ch
+			push	de
+			ld	a,d
+			dec	c
+			ld	e,e
+			rst	08h
+			call	L226c
+			ld	b,c
+			add	a,l
+			ld	c,b
+			call	p,La3d5
+			rst	10h
+			ld	d,(hl)
+			and	a
+			ld	e,(iy + 39h)
+			ld	e,l
+			jp	nc,L710f
+			sub	e
+			ld	(hl),h
+			rst	10h
+			cp	l
+			ld	l,c
+			ld	(cd09h),a
+			halt
+			ld	b,d
+			ld	e,d
+			ld	d,e
+			add	a,(hl)
+			ld	(hl),a
+			xor	(hl)
+			or	d
+			rrca
+			sub	b
+			add	hl,bc
+			xor	eah
+			ld	e,l
+			xor	h
+			ld	b,e
+			dec	(hl)
+			rra
+			rst	08h
+			adc	a,b
+			ld	b,h
+			sbc	a,b
+			ex	(sp),hl
+			rla
+			ccf
+			call	p,La323
+			add	hl,de
+			rlca
+			jr	L64aa
+			db	96h,85h,ebh,bah,1ch,00h,40h,64h
+			db	bbh,f4h,99h,34h,9eh,c6h,35h,c6h
+			db	f5h,ceh,3bh,b9h,79h,dah,5ah,71h
+			db	7dh,3eh,50h,90h,9fh,43h,b0h
+			exx
+			ld	e,e
+			ld	e,(hl)
+			ex	de,hl
+			rst	18h
+			call	nc,L2cb8
+			ld	e,e
+			ld	l,d
+			add	a,3ch
+			ex	de,hl
+			dec	l
+			pop	bc
+			res	4,h
+			adc	a,l
+			ld	l,h
+			inc	d
+			sub	c
+			sub	a
+			rlca
+			ld	sp,7d57h
+			ex	de,hl
+			push	hl
+			rra
+			ld	sp,hl
+			ld	a,84h
+			jp	(hl)
+			db	7bh,0bh,88h,5ch,45h,30h,7eh,a5h
+			db	56h,48h,bfh,64h,17h,d0h,a2h,05h
+			db	f6h,e4h,cch,28h,1dh,aeh,76h,2ch
+			db	04h,59h,44h,8fh,80h,7bh,13h,e7h
+			db	25h,5ah,56h,e5h,25h,c4h,0ah,dfh
+			db	51h,71h,51h,dah,82h,f9h,0dh,5ch
+			db	d0h,1fh,6bh,0ch,26h,dfh,bbh,5bh
+			db	21h,27h,97h,ceh,f5h,b9h,41h,dbh
+			db	b4h,2bh,f3h,6ah,bch,e4h,5ah,c7h
+			db	eeh,f5h,a4h,46h,1eh,feh,36h,dah
+			db	14h,dfh,b2h,9ch,04h,bfh,ddh,9eh
+			db	c1h,05h,86h
+			push	hl
+			cp	iyl *
+			inc	sp
+			ld	a,d
+			dec	b
+			ld	a,c
+			pop	bc
+			call	Ld77c
+			ret	po
+			rst	20h
+			rst	38h
+			rst	00h
+			add	a,bdh
+			or	b
+			xor	c
+			push	bc
+			ld	a,(hl)
+			push	bc
+			ld	h,57h
+			inc	bc
+			xor	d
+			dec	l
+			ld	c,e
+			ld	l,a
+			dec	e
+			add	a,d
+			ld	c,a
+			ld	a,e
+			and	59h
+			adc	a,c
+			cp	b
+			and	a
+			ld	e,c
+			jp	pe,Lf712
+			jp	z,L7404
+			dec	c
+			ld	sp,hl
+			dec	h
+			pop	hl
+			ld	h,l
+			ld	c,a
+			ld	h,b
+			or	(hl)
+			ld	e,4eh
+			ld	e,(hl)
+			ld	d,c
+			ld	e,h
+			ld	d,h
+			pop	de
+			ld	e,l
+			inc	c
+			or	d
+			push	hl
+			or	h
+			ld	a,(bc)
+			xor	c
+			nop (2x) *
+			rst	00h
+			call	z,L8992
+			sbc	a,b
+			ei
+			inc	a
+			inc	(hl)
+			ld	l,e
+			ld	b,b
+			ld	(hl),01h
+			call	nz,Lbff1
+			rra
+			jp	pe,L39c6
+			dec	h
+			inc	hl
+			pop	bc
+			or	a
+			ld	a,(hl)
+			rra
+			dec	l
+			ld	a,c
+			add	hl,bc
+			add	a,h
+			ld	a,l
+			ld	b,d
+			cpl
+			inc	hl
+			ex	af,af'
+			inc	l
+			ld	h,d
+			jp	L1603
+			db	72h,ach,63h,0ch,21h,40h,bfh,29h
+			db	f3h,ebh,89h,5eh,6dh,3bh,ffh,13h
+			db	43h,f5h,53h,6eh,d7h,c2h,59h,dfh
+			db	f7h,8bh,cfh,e9h,b4h,b5h,00h,58h
+			db	74h,61h,a1h,48h,f7h,0dh,7bh,cah
+			db	90h,f1h,8bh,1ch,1dh,0ch,aeh,dfh
+			db	46h,f0h,40h,40h,aeh,b6h,f3h,34h
+			db	85h,f0h,43h,7fh,27h,43h,a5h,93h
+			db	e4h
+			cp	h
+			jp	nc,Lea35
+			ret	nc
+			dec	b
+			ld	a,b
+			ld	l,l
+			adc	a,c
+			sbc	a,d
+			ld	a,(hl)
+			dec	h
+			ld	(hl),h
+			ld	d,b
+			add	hl,sp
+			call	z,L3bcf
+			ld	(hl),b3h
+			pop	bc
+			inc	a
+			and	(hl)
+			inc	de
+			cpl
+			push	hl
+			jp	(hl)
+			db	e7h,f0h,e4h,7dh,7ah,7bh,ceh,5fh
+			db	a9h,5dh,efh,9bh
+			cp	(hl)
+			jp	m,L5925
+			ret	nz
+			rl	(hl)
+			pop	hl
+			ld	l,a
+			ld	d,b
+			or	bbh
+			ld	(1b12h),a
+			rst	18h
+			ld	l,a
+			or	l
+			nop (2x) *
+			sbc	a,e
+			ld	c,d
+			cp	l
+			add	a,(hl)
+			or	e
+			nop
+			ld	(hl),b
+			call	nz,L672b
+			ld	a,b
+			inc	c
+			sbc	a,a
+			inc	sp
+			adc	a,b
+			ld	(hl),e
+			ld	l,(hl)
+			daa
+			ld	a,c
+			ld	c,h
+			halt
+			ld	l,h
+			ld	a,a
+			sbc	a,c
+			ld	h,d
+			cp	a
+			ld	d,l
+			ld	a,a
+			add	a,b
+			ld	c,b
+			ld	h,d
+			sub	(hl)
+			and	c
+			call	m,Lb676
+			ld	e,a
+			cp	(hl)
+			ld	hl,9e98h
+			jr	nz,L66ec
+			jp	Ld5a9
+			db	a1h,e8h,5bh,efh,beh
+			jp	(hl)
+			db	12h,54h,d7h,d0h,cch,fch,d7h,f7h
+			db	82h,c0h,a0h,54h,0eh,f1h,2fh,7fh
+			db	cdh,ebh,aah,bdh,2fh,29h,b0h,41h
+			db	3fh,f1h,08h,07h,dch,edh,5fh,83h
+			db	e2h,0bh,19h,efh,dfh,d1h,a9h,2ch
+			db	f6h,94h,3ch,2bh,2eh,fch,95h,6bh
+			db	beh,a2h,e7h,18h,24h
+			ex	de,hl
+			sbc	a,b
+			jr	nc,L66b3
+			inc	hl
+			nop (2x) *
+			nop
+			sub	e
+			ld	d,a
+			rst	20h
+			sub	b
+			sub	d
+			add	a,95h
+			inc	sp
+			bit	3,c
+			and	(hl)
+			add	a,a
+			djnz	L66b9
+			and	b
+			xor	(hl)
+			adc	a,c
+			sbc	a,h
+			adc	a,ach
+			add	a,b
+			sub	c
+			ret	nz
+			jp	c,L5fe1
+			add	a,b
+			add	hl,bc
+			call	c,L308d
+			and	31h
+			ld	h,l
+			xor	e
+			jp	nc,L51ab
+			ld	b,ech
+			ld	c,(hl)
+			add	a,1eh
+			ret	po
+			adc	a,l
+			rst	30h
+			call	z,Ldc77
+			in	a,(07h)
+			ld	hl,(f747h)
+			ld	e,e
+			rst	28h
+			add	a,c
+			ret	pe
+			ld	a,(hl)
+			ld	h,h
+			ld	l,h
+			ld	d,l
+			cpd
+			dec	d
+			ld	a,(c96dh)
+			ld	b,c
+			ret	z
+			ld	l,8ah
+			or	27h
+			ex	af,af'
+			ld	c,b
+			ld	hl,(9bbeh)
+			adc	a,l
+			sbc	a,l
+			ld	e,d
+			sub	a
+			or	e
+			ld	a,c
+			ret	nz
+			and	h
+			daa
+			xor	e
+			cp	d
+			cp	l
+			ld	c,a
+			ret	po
+			ld	d,c
+			xor	l
+			sub	b
+			ld	sp,hl
+			ret
+			db	c0h,79h,51h,3ah,54h,a3h,52h,50h
+			db	0fh,d5h,1dh,78h,bfh,70h,c9h,59h
+			db	02h,c4h,6eh,3fh,edh
+			jp	po,L8f95
+			jp	(hl)
+			db	0eh,42h,56h,89h,a3h,d7h,06h,8ch
+			db	b7h,93h,96h,4eh,f5h,43h,82h,87h
+			db	56h,04h,5ah,d1h,b6h,b9h,c1h,43h
+			db	71h,10h,4bh,66h,8bh,7ch,3dh,7dh
+			db	3ah,93h,87h,17h,c9h,c4h,ddh,72h
+			db	fdh,beh,efh,96h,69h,e0h,1fh,bfh
+			db	0ah
+			and	h
+			add	hl,sp
+			ld	c,l
+			ld	b,(hl)
+			or	96h
+			adc	a,c
+			call	c,L5d9a
+			sbc	a,h
+			sub	a
+			inc	c
+			ld	b,b
+			ld	h,l
+			adc	a,l
+			ld	c,f6h
+			ex	de,hl
+			ret
+			db	f7h,eeh,39h,b7h,62h,f4h,a6h,47h
+			db	01h,9eh,1ch,5ah,eah,d7h,24h,fbh
+			db	47h,13h,4eh,d6h,2ah,f2h,91h,fbh
+			db	d5h
+			ld	a,(bc)
+			ld	e,b
+			ld	sp,hl
+			ld	(de),a
+			and	e
+			ld	(bc),a
+			in	a,(60h)
+			inc	c
+			xor	a
+			bit	0,e
+			dec	bc
+			ld	(hl),b7h
+			inc	hl
+			ld	(hl),b
+			xor	(hl)
+			cp	h
+			ld	d,5bh
+			ld	(hl),b
+			jp	pe,L640e
+			ld	sp,hl
+			add	hl,sp
+			and	b
+			ret	pe
+			add	hl,bc
+			dec	c
+			ld	e,l
+			and	e
+			scf
+			ld	c,a
+			inc	de
+			xor	e
+			ld	h,(hl)
+			sub	e
+			ld	a,b6h
+			jp	z,L3021
+			ld	e,c
+			add	a,(hl)
+			add	a,h
+			sbc	a,e
+			inc	(hl)
+			ld	h,b
+			ld	hl,(2875h)
+			jp	nz,Lec76
+			ld	c,h
+			ld	l,(hl)
+			call	p,L09e8
+			inc	(hl)
+			ex	af,af'
+			ex	af,af'
+			ld	d,b
+			pop	bc
+			call	nc,Lca13
+			call	m,Lec29
+			call	nc,L9ea8
+			ld	b,h
+			jp	nz,Ld5e1
+			ld	l,l
+			cp	e
+			inc	l
+			jp	m,L7110
+			ld	sp,aca3h
+			ld	b,1ah
+			sub	e
+			ld	h,c
+			ex	(sp),hl
+			add	a,(hl)
+			ld	e,h
+			ld	d,c
+			and	b
+			exx
+			jp	po,L0aee
+			adc	a,a
+			ret	pe
+			ld	d,e
+			sbc	a,l
+			dec	sp
+			sub	l
+			ccf
+			ld	a,9bh
+			dec	c
+			and	c
+			ccf
+			djnz	L686e
+			add	hl,de
+			ld	l,(hl)
+			sub	63h
+			ld	a,80h
+			ld	a,c
+			add	a,h
+			rrca
+			ld	hl,(da51h)
+			ld	a,(de)
+			rst	30h
+			sub	l
+			ld	b,d
+			jp	z,Le92b
+			ld	l,h
+			ld	a,a
+			or	3bh
+			inc	a
+			ld	e,e
+			adc	a,b
+			add	a,h
+			sbc	a,(hl)
+			sbc	a,b
+			cp	h
+			adc	a,l
+			rst	00h
+			rst	30h
+			ld	(hl),l
+			ei
+			ld	h,b
+			and	b
+			xor	a7h
+			in	h,(c)
+			ld	b,e1h
+			or	d
+			in	a,(63h)
+			sub	67h
+			dec	c
+			xor	e
+			jp	c,L82d5
+			ld	(hl),c
+			call	p,L9ca0
+			pop	af
+			and	a
+			jr	z,L68b4
+			pop	de
+			call	nz,L2e2e
+			out	(88h),a
+			push	bc
+			xor	d
+			inc	(hl)
+			xor	(hl)
+			ld	bc,d345h
+			cp	e
+			ld	d,l
+			adc	a,a
+			ld	h,e
+			ld	l,b
+			ld	l,a
+			rlca
+			jr	nc,L6811
+			inc	c
+			inc	d
+			dec	bc
+			di
+			ld	e,(hl)
+			add	a,d
+			ld	d,a
+			add	a,l
+			and	a
+			and	e
+			sbc	a,l
+			nop (2x) *
+			rst	38h
+			sbc	a,a
+			cp	(hl)
+			ld	b,d
+			add	a,c
+			adc	a,d
+			ld	c,b
+			adc	a,h
+			and	b
+			ret	c
+			ld	a,a
+			ex	de,hl
+			ld	(hl),a
+			adc	a,a
+			add	a,h
+			ld	l,a
+			ld	e,e
+			jr	L6879
+			db	ffh
+			cpl
+			adc	a,56h
+			ld	e,e
+			ld	e,(hl)
+			halt
+			ld	c,a
+			ld	l,a
+			ld	a,(bc)
+			ld	l,b
+			ld	a,(hl)
+			or	e
+			inc	e
+			ret	nz
+			ld	c,l
+			res	6,c
+			or	l
+			ld	e,41h
+			ld	h,e
+			add	hl,de
+			jp	nz,L2dde
+			djnz	L6841
+			ld	l,h
+			ld	l,d
+			call	p,Lb3ad
+			pop	hl
+			ld	l,d
+			ld	d,b
+			cp	d
+			ret	pe
+			sbc	a,d
+			dec	de
+			adc	a,d
+			ld	h,d
+			ld	d,c
+			ret	m
+			inc	bc
+			ld	b,(hl)
+			ld	sp,9cb6h
+			sub	b
+			sbc	a,d
+			dec	bc
+			sbc	a,a
+			ld	hl,(d930h)
+			pop	de
+			dec	hl
+			rrca
+			sbc	a,(hl)
+			ld	hl,(3ac2h)
+			djnz	L68b9
+			ld	(de),a
+			ld	e,43h
+			cp	c
+			adc	a,37h
+			add	a,e
+			ret	z
+			ld	de,4d61h
+			ei
+			or	l
+			ld	d,h
+			call	nz,Lb703
+			rst	10h
+			ld	c,b
+			ld	c,d
+			cp	a
+			halt
+			pop	af
+			dec	sp
+			inc	hl
+			add	a,l
+			dec	e
+			ex	(sp),hl
+			ld	a,(f53dh)
+			ccf
+			adc	a,a
+			ld	l,e
+			sbc	a,h
+			ld	a,(bc)
+			ld	sp,hl
+			adc	a,c
+			adc	a,d
+			xor	02h
+			inc	d
+			sra	l
+			and	d
+			inc	(hl)
+			adc	a,l
+			ld	(hl),c
+			ld	h,(hl)
+			call	nz,L3136
+			ld	c,8bh
+			dec	b
+			add	a,e
+			call	p,Lefd0
+			sub	c
+			nop (2x) *
+			in	a,(63h)
+			xor	h
+			ld	a,l
+			ld	b,l
+			ld	l,a
+			or	(hl)
+			ld	h,b
+			ret	nc
+			and	e
+			ld	(hl),l
+			ld	hl,(5b03h)
+			in	a,(4ch)
+			and	c
+			jp	m,L89c2
+			sub	l
+			ld	h,h
+			pop	hl
+			ld	e,b
+			ld	(bc),a
+			and	l
+			ld	iyh,iyh *
+			sub	l
+			ld	e,a
+			pop	hl
+			call	nz,Lb44a
+			ld	l,a
+			dec	h
+			cp	(hl)
+			inc	h
+			ld	h,h
+			ld	b,a
+			ld	h,h
+			rrca
+			rst	00h
+			ld	l,h
+			ld	b,h
+			sub	l
+			ld	l,(hl)
+			xor	c
+			jr	z,L6946
+			ld	bc,447fh
+			ret	p
+			or	e
+			and	c
+			ld	l,edh
+			or	4eh
+			halt
+			ld	c,c
+			ld	b,(hl)
+			rst	00h
+			out	(aeh),a
+			xor	ech
+			ld	a,(de)
+			adc	a,a
+			adc	a,b
+			ld	c,l
+			ld	e,c
+			ld	d,h
+			dec	h
+			ld	e,l
+			ex	af,af'
+			add	a,e
+			ret	c
+			ld	bc,98deh
+			ld	d,e
+			add	a,h
+			ld	e,b
+			cp	c9h
+			cp	a
+			pop	af
+			ld	a,e
+			dec	de
+			nop
+			sbc	a,e
+			rst	08h
+			cpl
+			adc	a,(hl)
+			ld	(hl),d
+			ld	a,d
+			ld	a,(hl)
+			ccf
+			nop (2x) *
+			cp	16h
+			xor	c
+			sbc	a,c
+			or	d
+			adc	a,e
+			ret	c
+			ret	p
+			ld	a,(bc)
+			rst	10h
+			ld	a,(bc)
+			ld	sp,hl
+			rst	38h
+			ex	(sp),hl
+			adc	a,h
+			inc	de
+			djnz	L69d5
+			ld	(hl),01h
+			adc	a,d
+			nop (2x) *
+			jr	L697c
+			db	e6h,59h,3dh,1ch,7ah,4ah,72h,9fh
+			db	82h,adh,8ah,bch,dbh,06h
+			or	c
+			ld	a,e
+			inc	h
+			xor	h
+			ld	c,l
+			or	h
+			inc	sp
+			ld	e,d
+			add	a,c
+			or	a
+			ld	b,c
+			or	b
+			ld	b,l
+			ld	a,l
+			or	(hl)
+			ld	(hl),54h
+			xor	l
+			nop (2x) *
+			jr	nc,L6916
+			ld	c,e
+			ld	a,(9d7eh)
+			rst	38h
+			call	p,L61e6
+			jr	nz,L69ce
+			and	11h
+			xor	d
+			adc	a,b
+			add	hl,de
+			dec	bc
+			rst	30h
+			ld	e,h
+			ld	b,b
+			pop	bc
+			ld	e,h
+			ld	h,e
+			sub	(hl)
+			out	(1bh),a
+			ld	b,e
+			call	m,L10c8
+			ld	d,a
+			ld	h,c
+			ld	(hl),b
+			sbc	a,a
+			ret	po
+			ret	nc
+			sbc	a,e
+			dec	sp
+			or	h
+			nop (2x) *
+			dec	a
+			dec	b
+			ld	a,l
+			ld	e,(hl)
+			or	d
+			add	a,b
+			ld	h,h
+			add	a,e
+			and	26h
+			sub	a
+			ex	de,hl
+			and	l
+			inc	(hl)
+			dec	l
+			add	a,c
+			call	nz,L797e
+			ld	(hl),b
+			dec	sp
+			rst	30h
+			call	pe,Le095
+			nop (2x) *
+			call	L1b32
+			ld	c,c
+			rla
+			ld	(hl),b
+			ld	d,2dh
+			and	a
+			ld	(hl),b
+			ld	b,b
+			nop (2x) *
+			ex	af,af'
+			xor	e
+			adc	a,(hl)
+			dec	a
+			ld	l,h
+			adc	a,h
+			ld	d,4ch
+			cpl
+			ld	a,e
+			jp	p,L16e7
+			sub	d
+			add	hl,hl
+			add	a,d
+			inc	a
+			ld	a,(bc)
+			xor	a
+			rst	18h
+			inc	d
+			ld	l,d
+			ld	d,h
+			add	a,l
+			dec	d
+			rst	18h
+			ld	b,a
+			dec	a
+			exx
+			ld	e,(hl)
+			jp	po,L9358
+			jr	nz,L6a63
+			add	a,57h
+			jp	po,L3258
+			ret	nz
+			ld	d,l
+			jp	c,Ld584
+			xor	0fh
+			ld	l,a
+			dec	(hl)
+			add	a,f3h
+			ld	a,(bc)
+			dec	sp
+			ld	b,(hl)
+			ld	l,a
+			ret
+			db	30h,b0h,76h,71h,49h,88h,74h,adh
+			db	92h,6ch,85h
+			adc	a,l
+			call	z,Lab11
+			adc	a,a
+			jr	c,L6a70
+			ld	d,l
+			ld	h,2ah
+			add	hl,de
+			ld	a,(de)
+			add	a,c
+			inc	a
+			ld	a,c
+			ret	nz
+			call	pe,L58fe
+			jp	(hl)
+			db	22h,b1h,f8h,05h,c9h,c4h,76h,4dh
+			db	88h,ffh,83h,d2h,74h,61h,9dh,8fh
+			db	0eh,6bh,d4h,1ah,1bh,f5h,43h,b9h
+			db	99h,92h,0ch,9ah,5fh,16h,07h,deh
+			db	abh,c9h,90h,aah,9ch,6ch,3ch,86h
+			db	b8h,b4h,1ch,5ah,aah,dah
+			cpl
+			dec	b
+			adc	a,a
+			or	e
+			xor	h
+			add	hl,sp
+			ld	c,c
+			add	a,l
+			cp	c
+			ld	e,b
+			ld	c,d
+			sub	l
+			dec	sp
+			ld	l,e
+			jp	z,L7c25
+			rst	00h
+			or	e
+			ld	c,l
+			ld	b,b
+			ld	h,(hl)
+			xor	b
+			dec	e
+			ld	l,l
+			call	c,Lbab2
+			ld	d,h
+			ld	c,h
+			ld	b,66h
+			pop	hl
+			inc	d
+			add	hl,sp
+			ld	h,e
+			add	a,b
+			ld	c,d
+			ld	c,b
+			and	d
+			djnz	L6af2
+			ld	a,(3557h)
+			jp	po,L069f
+			ld	d,68h
+			ld	a,53h
+			call	m,L86ee
+			and	b
+			inc	e
+			inc	(hl)
+			adc	a,a
+			ld	l,e
+			inc	l
+			add	a,e
+			call	p,Le07f
+			adc	a,h
+			ret	nz
+			ld	a,a
+			ret	nc
+			dec	de
+			call	po,L20ad
+			cp	l
+			adc	a,dch
+			ld	c,a
+			rr	l
+			cpl
+			ld	(hl),b
+			ld	d,l
+			inc	(hl)
+			ret	c
+			dec	(hl)
+			ld	a,e
+			call	po,L0f6b
+			ret	m
+			ld	b,d
+			sbc	a,d
+			ld	d,e
+			inc	de
+			call	z,L9080
+			in	a,(10h)
+			or	(hl)
+			ld	(hl),d
+			ld	b,a
+			inc	b
+			add	hl,hl
+			ld	h,b
+			ld	(eb5eh),hl
+			call	nz,L37c0
+			ei
+			ld	d,a
+			sub	(hl)
+			ld	(hl),h
+			ld	e,a
+			add	hl,sp
+			push	hl
+			sub	a
+			rst	08h
+			inc	hl
+			ret	nc
+			add	hl,sp
+			ld	d,d
+			pop	af
+			ld	l,f4h
+			ld	a,c
+			xor	d
+			rst	38h
+			sbc	a,l
+			ld	b,b
+			add	a,(hl)
+			jp	(hl)
+			db	1bh,61h,45h,79h,67h,edh
+			ld	sp,hl
+			ld	b,h
+			nop (2x) *
+			adc	a,e
+			ld	d,b
+			add	hl,de
+			sub	h
+			ld	l,e
+			ld	a,44h
+			jp	L4387
+			db	03h,13h,b2h,3eh,86h,a0h,7ah,ceh
+			db	89h,d4h,f2h,8bh,5dh,2fh,05h,50h
+			db	aah,a7h,15h,aah,44h,92h,d1h,70h
+			db	95h,c3h,26h,3dh,c4h,39h,a6h,0dh
+			db	74h,dch,64h,38h,d4h,c7h,32h,c9h
+			db	a7h,68h,0ah,3ah,97h,60h,92h,87h
+			db	55h,4fh,8ch,37h,b6h,82h,ech,feh
+			db	fbh,37h,f5h,87h,2ch,d4h,72h,dbh
+			db	a5h,9ah,65h,c6h,9ah,1eh,d5h,35h
+			db	4eh,46h,12h,58h,01h,1eh,4ch,30h
+			db	b3h,2bh,26h,7fh,2eh,1ch,f6h,efh
+			db	18h,26h,1bh,69h,fbh,7ch,7ah,40h
+			db	03h,66h,12h,16h,39h,64h,edh,0eh
+			db	e4h,00h,4bh,46h,38h,59h,b3h,63h
+			db	1dh,a2h
+			pop	bc
+			ld	sp,hl
+			ld	l,c
+			out	(fah),a
+			cpl
+			ld	a,e
+			dec	de
+			dec	sp
+			rlca
+			ld	e,3ch
+			inc	de
+			rst	18h
+			ei
+			ld	l,e
+			sbc	a,9dh
+			ld	(fdach),hl
+			ld	h,a
+			ld	d,a
+			rst	38h
+			ei
+			nop
+			ld	d,(hl)
+			dec	sp
+			rst	20h
+			add	a,e
+			jp	z,L397a
+			sub	b
+			ld	l,c
+			adc	a,c
+			di
+			push	bc
+			ld	a,c
+			ld	d,(hl)
+			nop (2x) *
+			sub	e
+			cp	a
+			ld	h,l
+			ex	(sp),hl
+			inc	l
+			rst	30h
+			dec	d
+			and	h
+			sub	c3h
+			add	a,l
+			ld	h,b
+			add	hl,sp
+			ld	l,b
+			jp	nz,Lff72
+			adc	a,a
+			and	b
+			add	iy,bc
+			call	pe,Lb1b6
+			inc	bc
+			out	(fah),a
+			ld	(de),a
+			or	c
+			cp	(hl)
+			ld	h,h
+			sub	b
+			inc	c
+			ld	d,c
+			ld	l,e
+			ld	c,h
+			ld	h,(hl)
+			rra
+			jr	c,L6bc3
+			ld	l,d
+			ld	c,b
+			ld	a,d
+			add	hl,bc
+			out	(e6h),a
+			ld	(hl),h
+			ld	b,(hl)
+			halt
+			sub	(hl)
+			call	nc,Lfcc0
+			dec	a
+			add	a,(hl)
+			ld	l,c
+			ld	b,d
+			sbc	a,e
+			ld	(b1beh),hl
+			adc	a,c
+			sub	25h
+			ld	e,(hl)
+			cp	b
+			ld	l,e
+			add	a,b8h
+			ld	a,d
+			or	c
+			call	nz,L8f7d
+			adc	a,h
+			ld	h,36h
+			jp	m,La3cf
+			adc	a,a
+			ld	b,(hl)
+			ld	(1ca2h),ix
+			ld	h,l
+			ld	a,54h
+			ld	a,e
+			ld	c,(hl)
+			add	hl,bc
+			ei
+			cpl
+			ld	(bc),a
+			ret	p
+			push	de
+			ret	p
+			daa
+			ld	a,d
+			inc	d
+			jr	nz,L6be1
+			ld	h,d0h
+			ld	b,(hl)
+			rlca
+			nop (2x) *
+			ld	a,b
+			or	d
+			ld	(hl),l
+			and	6ah
+			xor	a
+			ld	d,e
+			ld	(hl),h
+			add	a,a
+			ld	d,a
+			xor	c
+			ld	l,c
+			dec	sp
+			or	l
+			adc	a,l
+			ld	c,2bh
+			jp	c,L6473
+			sbc	a,h
+			inc	a
+			ld	(hl),e
+			daa
+			ld	b,a
+			rlca
+			ld	a,(bc)
+			sbc	a,(hl)
+			xor	(hl)
+			or	b
+			add	hl,sp
+			ret	pe
+			ret	nc
+			and	c
+			ld	l,d8h
+			jp	p,Leed6
+			ld	e,75h
+			ld	(hl),a
+			ld	a,c
+			dec	l
+			ld	h,b
+			xor	88h
+			ld	(bc),a
+			ld	d,h
+			cp	b
+			add	a,(hl)
+			ld	a,d
+			exx
+			ld	(5e39h),a
+			ld	a,(de)
+			add	a,d
+			ret	po
+			exx
+			jp	p,Lf88e
+			xor	e
+			sbc	a,e
+			xor	b
+			ld	a,c
+			call	nc,Lb4f1
+			ld	h,a
+			ld	c,fdh
+			ret	po
+			ld	a,h
+			jp	pe,Lfa9c
+			ld	c,b
+			ld	d,0eh
+			ld	e,h
+			ld	b,e
+			ld	e,d
+			push	de
+			adc	a,a
+			jr	c,L6bf6
+			call	nc,La1d6
+			add	a,h
+			ld	l,l
+			ld	sp,hl
+			jr	nz,L6c08
+			or	ach
+			jp	(hl)
+			db	9fh,9dh,35h,a6h,5eh,03h,55h,e4h
+			db	70h,6ch,a9h,0ah,a1h,70h,9eh,58h
+			db	efh,09h,31h,deh,73h,0fh,ach,e0h
+			db	10h,d4h,d2h,43h,19h,a3h,e5h,eah
+			db	37h,64h,50h,24h,0bh,6ch,3fh,06h
+			db	10h,dch,94h,1eh,3eh,6bh,51h,b8h
+			db	f9h,8eh,26h,dbh,13h,10h,1ch,4eh
+			db	88h,87h,efh,95h,36h,40h,24h,ebh
+			db	feh,80h
+			dec	sp
+			inc	hl
+			jr	nz,L6cb9
+			ld	e,ixh *
+			call	po,L10a8
+			jp	(hl)
+			db	aeh,7eh,77h,f1h,40h,06h,6ch
+			inc	b
+			ld	h,e
+			or	89h
+			ld	l,40h
+			ld	e,e
+			ld	h,a
+			adc	a,l
+			call	L0faf
+			and	c
+			ld	l,(hl)
+			sbc	a,2fh
+			ld	d,(ix + 44h)
+			rst	08h
+			ld	hl,(3acfh)
+			ld	b,d
+			ret	nc
+			inc	de
+			jr	L6cbb
+			db	c0h,40h,11h,b8h,a4h,8dh,52h,9dh
+			db	03h,57h,85h,6dh,cfh,c0h,9ah,eeh
+			db	64h,10h,dah,ech,6eh,39h,6dh,f1h
+			db	65h,02h,5ch,58h,69h,fbh,86h,aah
+			db	a5h,d6h,13h,47h,45h,e9h,87h,37h
+			db	deh,79h,77h,efh,6bh,e0h,cfh,cbh
+			db	3ah,b8h,feh,83h,e0h,30h,8ch,49h
+			db	3ch,bfh,32h,09h,36h,94h,b0h,fah
+			db	6bh,85h,17h,50h,27h,88h,79h,abh
+			db	24h,b0h,81h,3fh,68h,3fh,7dh,c9h
+			db	d4h,33h,fbh,efh,abh,97h,e9h,3bh
+			db	c6h,9eh,13h,b1h,15h,52h,c8h,46h
+			db	d1h,04h,d9h,aeh,89h,b4h,f5h,1eh
+			db	99h,28h,9ch,59h,00h,88h,17h,5dh
+			db	c1h,bdh,c7h,66h,bfh,67h,50h,adh
+			db	c3h,3eh,0ah,20h,5ch,ech,7ah,93h
+			db	9fh,21h,fch,12h,a9h,cch,74h,c0h
+			db	f0h,82h,52h,7fh,d3h,eah,1ch,0fh
+			db	7fh,74h,73h,71h,69h,fdh,e2h,64h
+			db	bdh,4fh,b9h,25h,68h,cfh,80h,4fh
+			db	3eh,41h,39h,84h,92h,43h,63h,2ch
+			db	b3h,07h,eah,6fh,75h,63h,6eh,6ah
+			db	49h,e9h,aeh,50h,e5h,1ah,b6h,3fh
+			db	85h,25h,70h,46h,37h,3eh,5fh,29h
+			db	f1h,ech,f1h,40h,95h,2ch,77h,77h
+			db	f5h,16h,24h,7ah,bch,bdh,2ch,ach
+			db	e1h,9fh,ddh
+			ld	(hl),l
+			dec	(hl)
+			ret	pe
+			ld	a,h
+			inc	d
+			ld	c,b
+			jp	nc,L624b
+			adc	a,a
+			ld	c,b
+			dec	c
+			ld	h,l
+			adc	a,(hl)
+			add	a,(hl)
+			ld	h,b
+			rst	20h
+			ld	bc,a82bh
+			ld	d,d
+			add	a,(hl)
+			call	pe,Ld980
+			inc	l
+			pop	af
+			ld	hl,626ch
+			dec	sp
+			adc	a,e
+			jp	z,L3000
+			sub	b
+			cp	11h
+			cpl
+			call	nc,Lf1b5
+			ld	d,(hl)
+			ld	l,e
+			rrca
+			sbc	a,e
+			sbc	a,c
+			ld	c,e
+			xor	(hl)
+			in	a,(91h)
+			jp	L6b6e
+			db	cdh,22h,c5h,79h,9ch,cch,28h,06h
+			db	9ah,2fh,96h,e2h
+			call	p,L9b9b
+			ld	(L2a40),a
+			jp	(hl)
+			db	1ah,f2h,fah,abh,afh,31h,5ah,b2h
+			cp	c
+			call	z,L18ad
+			or	h
+			ld	(3f7dh),hl
+			sbc	a,h
+			ld	l,h
+			rst	18h
+			sbc	a,b
+			call	m,L3a40
+			ld	h,c
+			ld	l,e
+			scf
+			ld	(hl),a
+			or	c
+			and	d
+			ld	a,(bc)
+			ld	(bc),a
+			ld	e,h
+			ld	c,h
+			xor	h
+			ret	c
+			adc	a,d
+			add	a,l
+			xor	e
+			dec	hl
+			ld	b,b
+			rst	00h
+			sub	d
+			ld	c,e
+			ld	l,l
+			dec	b
+			jr	nz,L6e35
+			sbc	a,l
+			ld	h,c
+			dec	hl
+			add	hl,hl
+			in	a,(26h)
+			dec	sp
+			sbc	a,79h
+			push	af
+			xor	dah
+			xor	c
+			pop	de
+			ld	h,a
+			cp	b
+			ld	d,b
+			ld	(hl),h
+			or	l
+			ld	(c4c6h),a
+			dec	de
+			sub	e
+			or	a6h
+			sub	a
+			ld	a,b
+			ret	z
+			rst	28h
+			jp	m,L79aa
+			sub	d
+			inc	c
+			sbc	a,b
+			ld	(hl),b
+			ld	c,a
+			sub	b
+			call	L76c7
+			ld	l,h
+			ld	h,h
+			xor	beh
+			call	m,Lb07b
+			ret	p
+			and	h
+			ld	(bc),a
+			sbc	a,b
+			sub	5bh
+			call	c,L2dad
+			inc	b
+			sub	(hl)
+			add	a,l
+			ld	l,d
+			sbc	a,l
+			jp	nz,L1b0c
+			ld	l,c
+			and	h
+			ld	e,e
+			xor	bah
+			ld	(L1b0c),hl
+			ret	po
+			call	c,L5266
+			inc	sp
+			ld	d,b
+			adc	a,d
+			add	a,l
+			dec	e
+			rst	18h
+			ld	(hl),b
+			rst	08h
+			adc	a,a
+			add	a,e
+			cp	h
+			ld	e,e
+			ld	c,c
+			ld	d,c
+			ret	nz
+			ld	e,83h
+			res	6,a
+			ld	d,e
+			jr	z,L6e75
+			ld	b,b
+			ld	h,e
+			add	a,b
+			ld	b,d
+			jp	(hl)
+			db	4dh,4dh,e5h,14h,adh,fbh,9fh,74h
+			db	53h,bfh,78h,e9h,0eh,e8h,23h,a9h
+			db	0ch,e3h,58h,d1h,d5h,b8h,f2h,79h
+			db	e1h,5dh,eeh,b7h,5ch,a0h,60h,cfh
+			db	15h,f9h,bdh,c3h,b4h,0ah,48h,b8h
+			db	93h,6eh,27h,0eh,cdh,c1h
+			ld	l,(hl)
+			ld	h,(hl)
+			ld	(hl),e
+			jp	(hl)
+			db	bch,2ch,25h,e1h,64h,23h,f8h,94h
+			db	efh,1bh,34h,14h,d5h,91h,71h,60h
+			db	0fh,39h,56h,63h,ffh,36h,9dh,66h
+			db	23h,a7h,2ch,81h,4bh,4bh,14h,eeh
+			db	deh,4eh,97h,09h,09h,34h,11h,57h
+			db	2fh,4ch,6ah,07h,22h,4ah,62h,e3h
+			db	d4h,f0h,57h,d8h,c0h
+			cp	d
+			inc	e
+			nop
+			sub	a
+			sub	(hl)
+			di
+			pop	bc
+			ld	e,a
+			ld	e,c
+			adc	a,b
+			xor	f3h
+			sbc	a,h
+			sub	a
+			ld	d,(hl)
+			xor	(hl)
+			dec	a
+			ld	b,l
+			add	a,(hl)
+			out	(9dh),a
+			ld	l,c
+			add	a,h
+			dec	bc
+			add	a,a
+			ld	a,(bc1ah)
+			ld	a,(bc)
+			ld	(hl),b
+			add	hl,sp
+			pop	iy
+			ld	b,6eh
+			ld	l,b
+			inc	(hl)
+			dec	de
+			ld	h,a
+			ld	b,e
+			ret	z
+			or	h
+			ld	d,a
+			cpl
+			call	z,L6760
+			inc	c
+			or	e
+			in	a,(e6h)
+			scf
+			out	(b4h),a
+			sub	l
+			inc	e
+			ret
+			db	76h,c2h,79h,b8h,22h,04h,78h,d8h
+			db	a8h,4fh,1dh,34h,cch,98h,fch,76h
+			db	53h,e5h,8fh,75h,07h,e4h,ddh,67h
+			db	2ch,d9h,d8h,94h,52h,ach,65h,d7h
+			db	7dh,1ah,03h,27h,afh
+			ld	(de),a
+			adc	a,d
+			dec	l
+			or	l
+			ld	l,(hl)
+			ld	d,6eh
+			dec	hl
+			rst	00h
+			and	(hl)
+			ld	h,l
+			ld	c,(hl)
+			nop (2x) *
+			ld	d,e
+			ld	(bc),a
+			inc	c
+			sbc	a,e
+			add	a,c
+			ld	a,h
+			ld	h,b
+			or	d
+			sub	(hl)
+			ld	d,e
+			or	a
+			rst	08h
+			dec	bc
+			ret	pe
+			ret	po
+			add	a,a
+			add	hl,sp
+			and	h
+			dec	hl
+			jp	pe,L8df0
+			rst	38h
+			inc	b
+			ld	c,(hl)
+			nop
+			sub	h
+			ret	m
+			sub	l
+			sub	b
+			ld	(hl),f4h
+			nop (2x) *
+			ld	b,d
+			ret	pe
+			ld	l,(hl)
+			adc	a,(hl)
+			sbc	a,(hl)
+			ret	pe
+			nop
+			ld	(hl),h
+			sub	(hl)
+			djnz	L6fe6
+			ld	b,e
+			ld	b,e
+			ld	a,(08a1h)
+			or	h
+			ld	bc,0c0eh
+			sub	h
+			call	L9952
+			ld	(hl),b
+			and	b
+			ld	l,(hl)
+			ld	c,d
+			rst	18h
+			jp	p,Lbe3e
+			inc	h
+			add	a,c
+			halt
+			cp	c
+			ld	(hl),c
+			ret	z
+			sub	5bh
+			ld	l,a
+			jp	po,L792e
+			add	hl,hl
+			add	hl,de
+			inc	h
+			ld	b,d
+			dec	sp
+			ld	(hl),b
+			inc	hl
+			and	b
+			dec	de
+			jp	p,Lbf98
+			add	a,a
+			ld	h,h
+			ld	l,e
+			jr	L6f5d
+			db	4bh,a1h,9ch,ceh,6ch,7dh,bfh,bbh
+			db	c1h,9fh,edh,a6h,6bh,4eh,32h,7ah
+			db	71h,e1h
+			ld	b,d
+			ld	d,d4h
+			push	af
+			sub	c
+			ld	e,7eh
+			sub	a
+			jp	c,L69dc
+			add	a,d
+			ld	(hl),h
+			ld	b,l
+			jp	pe,L03e4
+			ld	h,c
+			rl	(hl)
+			cp	h
+			ld	a,l
+			sbc	a,ixh *
+			xor	l
+			res	4,e
+			ld	(hl),c
+			jr	nc,L7003
+			call	nc,L090b
+			jp	(hl)
+			db	81h,feh,c6h,bbh,b8h,0bh,86h,8ch
+			db	58h,d6h,44h,cah,26h,efh,5fh,22h
+			db	f1h,6dh,07h,d3h,6fh
+			ld	iy,9c08h
+			adc	a,c
+			and	l
+			or	h
+			jp	Lca9a
+			db	5fh,e7h,29h,f3h,c5h,f0h,a8h,d1h
+			db	1ch,67h,cdh,bah,fdh,c3h,7eh,4bh
+			db	3bh,84h,61h,c0h,67h,75h,fch,68h
+			db	7ah,55h,dfh,3ah,afh,70h,d6h,f2h
+			db	22h,a0h,ceh,c9h,b6h,53h,63h,eah
+			db	50h,1eh,ceh,3dh,c3h,86h,8eh,7dh
+			db	1ch,9ah,6eh,66h,17h,1fh,5dh,48h
+			db	1dh,5ah,fah,0eh,88h,49h,75h,b8h
+			db	f6h,8ah,5ah,2ch,dch,7bh,54h,6bh
+			db	dfh,e4h,beh,bch,4fh,07h,78h,cbh
+			db	d1h,abh,4fh,b3h,12h,20h,6eh,0ah
+			db	07h,47h,15h,c6h,2bh,5dh,33h,beh
+			db	0bh,94h,d5h,1dh,93h,a8h,63h,75h
+			db	44h,7eh,fdh,a9h,d0h,d2h,dfh,73h
+			db	56h,5ch,83h,47h,59h,c4h,9ch,d4h
+			db	f6h,f2h,3fh,92h,41h,2bh,16h,14h
+			db	19h,cch,a7h,48h,51h,bch,5ah,e2h
+			db	4bh,d4h,d8h,3eh,dah,ebh,27h,32h
+			db	c5h,99h,0dh,01h,43h,99h,32h,c3h
+			db	f5h,15h,f5h,93h,74h,5ah,3eh,78h
+			db	7eh,88h,bfh,54h,55h,1eh,30h,6ah
+			db	53h,ech,50h,e3h,04h,7eh,23h,1dh
+			db	5ah,79h,7dh,15h,66h,48h,f1h,5ch
+			db	dbh,5bh,1fh,46h,e8h,20h,f8h,51h
+			db	50h,f8h,c0h,c1h,cfh,bah,cch,dbh
+			db	6ah,deh,9eh,bfh,33h,89h,60h,2bh
+			db	ceh,edh,9dh,8bh,93h,30h,10h,89h
+			db	91h,dch,bbh,8ah,4dh,d7h,19h,92h
+			db	74h,64h,ach,3ah,e1h,d9h,e7h,4ch
+			db	abh,48h,76h,51h,dfh,66h,50h,1ah
+			db	3fh,4fh,1ah,27h,67h,06h,18h,f8h
+			db	c5h,66h,1ah,41h,10h,66h,78h,eah
+			db	f3h,04h
+			ld	sp,hl
+			cp	b
+			ld	e,e
+			sub	d
+			ret	z
+			ld	(hl),b
+			pop	hl
+			call	po,Lfba3
+			pop	hl
+			cp	e
+			call	c,L575e
+			dec	c
+			ld	h,c
+			sbc	a,c
+			ld	b,a
+			dec	(hl)
+			ld	c,(hl)
+			ld	(bc),a
+			and	a
+			ld	l,b
+			rst	20h
+			call	c,Lb58e
+			or	c
+			jp	(hl)
+			db	efh,dbh,5eh,14h,25h,87h,96h,deh
+			ld	(hl),h
+			sub	d
+			ld	c,90h
+			ld	(hl),h
+			ld	d,b
+			ld	a,e4h
+			adc	a,c
+			dec	l
+			add	a,c
+			and	(hl)
+			dec	hl
+			ld	c,l
+			nop (2x) *
+			sub	c
+			inc	d
+			sbc	a,a
+			ld	hl,(dbe2h)
+			dec	de
+			ld	(hl),e
+			cp	l
+			inc	e
+			dec	b
+			inc	e
+			inc	(hl)
+			ld	c,70h
+			ld	a,02h
+			ld	l,(hl)
+			ld	l,e
+			rst	08h
+			sub	ixl *
+			rst	00h
+			di
+			rla
+			dec	c
+			sbc	a,l
+			xor	d
+			adc	a,l
+			dec	c
+			sbc	a,e
+			sbc	a,l
+			add	hl,bc
+			ld	a,c
+			or	b
+			pop	hl
+			ret	m
+			ld	(hl),c
+			ld	b,b
+			call	c,L8012
+			ld	e,c
+			rlca
+			add	a,b
+			jr	L71c7
+			db	a0h,86h,17h,e2h,e7h,70h,b3h,93h
+			db	8bh,b6h,e4h,68h,abh,f0h,e9h,34h
+			db	74h,d3h,7ch,73h,7fh,1ch,c9h,e6h
+			db	2dh,c2h,8dh,deh,49h,c8h,b9h,c0h
+			db	6bh,55h,d3h,ebh,23h,2fh,dbh,a8h
+			db	5eh,2fh,39h,96h,cbh,b2h,fch,fdh
+			db	ddh,b6h,9ch,26h,72h,e3h,82h,a3h
+			db	78h,cfh,f4h,d4h,a4h,42h,77h,c4h
+			db	b1h,a6h,cah,49h,c0h,b6h,ach,5dh
+			db	e3h,65h,09h,57h,3dh,c4h,08h,dfh
+			db	01h,3ch,3ah,7dh
+			adc	a,c
+			call	pe,L9ba3
+			add	a,h
+			ld	(9b53h),a
+			ld	(hl),e
+			ld	b,h
+			ld	(hl),e
+			jp	z,L1c03
+			cp	e
+			cp	a
+			ld	l,e
+			jp	pe,L148c
+			inc	h
+			rst	18h
+			call	c,L2084
+			adc	a,h
+			jp	Lca26
+			db	f1h,f3h,89h,00h,e1h,8dh,e0h,6eh
+			db	6dh,58h,55h,07h,ach,c2h,66h,c3h
+			db	d8h,cch,52h,46h,63h,eah,f4h,44h
+			db	05h,c6h,33h,78h,86h,4eh,87h,58h
+			db	3fh,36h,70h,8ch,8eh,c1h,b5h,d5h
+			db	2fh,75h,cch,09h,6bh,60h,c8h,f2h
+			db	c6h,ceh,deh,41h
+			sub	b
+			nop (2x) *
+			ret	c
+			rra
+			call	nz,L6123
+			cp	c
+			ld	l,d
+			ld	a,(hl)
+			jr	nz,L7221
+			rla
+			jr	c,L7265
+			ld	de,e375h
+			ld	bc,f5deh
+			ld	d,17h
+			ld	e,e
+			dec	l
+			ld	e,l
+			xor	d
+			and	a
+			dec	bc
+			ret	z
+			set	4,a
+			ld	(hl),5ah
+			and	c
+			call	z,Ld455
+			ret	pe
+			ld	e,c
+			inc	l
+			djnz	L7237
+			ld	b,c
+			ld	a,b
+			xor	c
+			ld	(hl),c6h
+			sbc	a,d
+			cp	b
+			cp	c
+			nop (2x) *
+			call	m,L4d14
+			cp	l
+			nop (2x) *
+			xor	48h
+			daa
+			dec	b
+			jp	m,L99df
+			inc	(hl)
+			sbc	a,b
+			ccf
+			add	a,a
+			djnz	L7245
+			adc	a,e
+			in	a,(8eh)
+			add	a,11h
+			rst	00h
+			sub	c
+			ld	(4ab7h),hl
+			ret	po
+			xor	l
+			ld	l,l
+			sbc	a,d
+			sbc	a,(hl)
+			djnz	L721e
+			xor	b
+			and	a
+			add	hl,de
+			sub	b
+			out	(60h),a
+			rst	28h
+			halt
+			rst	38h
+			jp	c,La230
+			ccf
+			ld	c,42h
+			ld	c,h
+			ld	(hl),e
+			jr	c,L727d
+			or	h
+			ld	l,a
+			ld	b,53h
+			jp	(hl)
+			and	(hl)
+			push	bc
+			ld	c,a
+			jr	c,L72e1
+			call	nz,Lc50b
+			ld	e,c
+			or	d
+			ld	l,93h
+			dec	a
+			jp	nc,L081c
+			ld	e,c
+			ld	sp,hl
+			jp	m,L6836
+			rla
+			ld	sp,hl
+			ld	d,d
+			adc	a,(hl)
+			rst	38h
+			ld	a,(hl)
+			cpl
+			sbc	a,b
+			ld	e,a
+			cp	a
+			xor	24h
+			ld	de,9779h
+			xor	h
+			ld	l,c
+			push	hl
+			jp	(hl)
+			db	88h,bch,bbh,b9h,aah,8ch,04h,41h
+			db	14h,5fh,6fh,09h,02h,9ch,9fh,d0h
+			db	f3h,2bh,67h,c1h,7dh,8dh,c8h,afh
+			db	9dh,75h,15h,d6h,50h,f6h,d1h,63h
+			db	d7h,86h,f3h,34h,97h,26h,a2h,4eh
+			db	4bh,14h,f8h,3dh,a3h,e1h,45h,7ah
+			db	a1h,9ah
+			add	a,h
+			ld	(hl),e
+			ld	e,(hl)
+			ld	hl,53a9h
+			ld	d,e
+			ld	c,(hl)
+			adc	a,f6h
+			adc	a,c
+			call	z,L1722
+			cp	dch
+			rst	30h
+			ld	(bc),a
+			adc	a,e
+			ld	l,b
+			ex	(sp),hl
+			sub	d
+			ld	c,b
+			nop (2x) *
+			nop
+			in	a,(e8h)
+			sub	(hl)
+			exx
+			ld	(hl),a
+			sub	d6h
+			ret	pe
+			ld	h,e
+			ret	c
+			ld	b,h
+			sbc	a,a
+			ret	nz
+			call	La3c1
+			ld	e,b
+			jp	z,L9806
+			and	h
+			ld	b,b
+			jr	z,L72f8
+			or	h
+			call	m,Lbb2f
+			jr	nc,L7318
+			ld	c,d
+			call	p,Lb982
+			ld	(2639h),a
+			di
+			ld	a,e
+			ret	nz
+			add	hl,hl
+			ld	l,a
+			ld	b,b
+			inc	b
+			ld	(hl),a
+			ld	l,43h
+			call	Lab8f
+			call	c,L8a4c
+			ld	(hl),b
+			ld	e,e
+			adc	a,a
+			add	a,a
+			adc	a,a
+			jp	m,L6e1a
+			cpl
+			sbc	a,c
+			add	a,b
+			dec	l
+			cp	d
+			push	de
+			jp	(hl)
+			db	74h,07h,f8h,49h,d9h,cch,46h,54h
+			db	6fh,b9h,44h,b1h,18h,ceh,b4h,c5h
+			db	56h,23h,81h,66h,06h,b1h,bch,0dh
+			db	7dh,79h,c4h,cfh,08h,43h,47h,ech
+			db	a6h,cah,47h,6bh,76h,77h,a5h,d6h
+			db	3dh,1eh,68h,d1h,aeh,c7h,efh,8bh
+			db	fch,1eh,31h,74h,1dh,ech,08h,b4h
+			db	32h,31h,cch,76h,2bh,70h,beh,9fh
+			db	06h,c0h
+			ld	c,b
+			ret	m
+			dec	(hl)
+			ld	bc,2342h
+			jr	nc,L73a1
+			rst	38h
+			xor	h
+			add	hl,hl
+			rst	10h
+			ret	nc
+			or	c
+			ld	e,57h
+			ret	pe
+			out	(d0h),a
+			add	a,19h
+			rst	28h
+			jp	nc,L40f2
+			jr	c,L7329
+			ld	(8465h),a
+			pop	de
+			ld	(hl),d
+			ld	c,h
+			dec	(hl)
+			ld	e,b
+			or	e
+			dec	de
+			adc	a,c
+			ret	nz
+			jp	m,Ldbf2
+			in	a,(d5h)
+			ld	e,b
+			rst	18h
+			jr	L7418
+			nop (2x) *
+			pop	hl
+			ld	a,(de)
+			dec	l
+			add	a,e
+			ex	de,hl
+			ld	(hl),b
+			or	42h
+			di
+			ld	(hl),e
+			ld	c,l
+			ld	l,l
+			dec	sp
+			sbc	a,h
+			adc	a,e
+			dec	bc
+			add	a,h
+			dec	(hl)
+			dec	de
+			rra
+			or	l
+			jp	z,L281c
+			cp	c
+			cp	(hl)
+			add	a,a
+			rrca
+			halt
+			ld	h,e
+			adc	a,l
+			push	bc
+			rst	28h
+			dec	(hl)
+			adc	a,d
+			jr	nz,L73c5
+			ld	b,d
+			inc	l
+			ld	a,(d9c5h)
+			daa
+			ld	b,b1h
+			ld	b,e
+			adc	a,d7h
+			ld	d,c
+			ld	h,(hl)
+			ld	l,(hl)
+			jp	nz,L0eec
+			xor	h
+			ld	e,c
+			ld	a,a
+			ld	h,d
+			sbc	a,e
+			cp	h
+			ld	(bc),a
+			and	h
+			pop	hl
+			ret	c
+			nop (2x) *
+			jp	p,Lb520
+			call	c,L1d6a
+			sub	e
+			ld	b,(hl)
+			inc	l
+			ld	l,h
+			rla
+			ld	h,e
+			ld	a,h
+			call	nc,Lcc00
+			djnz	L7471
+			exx
+			inc	de
+			add	a,c
+			ld	a,b
+			sbc	a,l
+			xor	e
+			cp	d
+			cp	d
+			ld	(hl),b
+			pop	af
+			sub	c
+			sbc	a,b
+			ld	b,a
+			ld	d,d
+			ld	e,c
+			ld	(hl),7dh
+			ld	e,d
+			add	a,l
+			cp	e
+			jr	nc,L749a
+			ld	a,d
+			push	de
+			sbc	a,l
+			add	a,d
+			ld	l,h
+			scf
+			add	a,h
+			ret	nz
+			ld	a,(bc)
+			call	z,Lca02
+			rst	08h
+			cpl
+			ld	h,(hl)
+			rra
+			xor	c
+			add	a,l
+			ld	h,b
+			or	(hl)
+			ld	e,c
+			inc	c
+			jp	L9b9f
+			db	d5h,4dh,85h,9fh,11h,04h,f2h
+			ld	c,c
+			pop	hl
+			adc	a,(hl)
+			sub	a
+			sbc	a,c
+			and	l
+			pop	hl
+			adc	a,a
+			ccf
+			dec	l
+			cp	(hl)
+			sub	b
+			and	30h
+			dec	e
+			ld	h,h
+			ld	b,b
+			sub	e
+			jp	m,L2280
+			xor	(hl)
+			jp	pe,L66fa
+			inc	a
+			dec	b
+			and	fah
+			rst	38h
+			ld	(bc),a
+			jr	c,L74cc
+			set	4,(hl)
+			jp	Ld7ee
+			db	13h,f6h,efh,43h,5fh,4dh,3eh,0ah
+			db	98h,23h,11h,19h,58h,dbh,27h
+			push	hl
+			dec	b
+			ld	e,c
+			dec	bc
+			sub	c
+			ld	h,e
+			ld	c,d
+			add	hl,sp
+			add	a,d
+			cp	l
+			rst	38h
+			adc	a,c
+			jp	nz,Ldbaa
+			ld	(hl),47h
+			sub	c
+			ld	(bc),a
+			jr	z,L7454
+			jp	Ld421
+			db	22h,cbh,5ch
+			ld	e,92h
+			ld	sp,8e73h
+			ld	(hl),b
+			push	bc
+			dec	h
+			cp	a
+			call	po,L6873
+			cp	(ix + bfh)
+			cp	c
+			ld	c,l
+			call	po,L3533
+			ei
+			ld	a,b
+			ld	a,l
+			sub	l
+			ld	a,l
+			in	a,(abh)
+			ei
+			inc	h
+			ld	c,a
+			or	f8h
+			add	a,edh
+			adc	a,e
+			add	a,(hl)
+			ld	a,b
+			nop (2x) *
+			ret	po
+			ret
+			db	b8h,c7h,e7h,e4h,8ah,e6h,f7h,e0h
+			rrca
+			ld	d,e
+			add	hl,hl
+			ld	d,a
+			jp	Lb201
+			db	b6h,9eh,9bh,e0h,17h,63h,07h,53h
+			db	9dh
+			jr	z,L748c
+			rst	30h
+			rst	30h
+			ld	e,d
+			ex	de,hl
+			or	h
+			inc	e
+			ret
+			db	e7h,a3h,c2h,a3h,cfh,aeh,b2h,69h
+			db	ech,edh,e9h,e3h,cch,c9h,f8h,6fh
+			db	e9h,dch,51h,27h,26h,a5h,20h,e6h
+			db	b7h,fbh,09h,63h,4fh,b1h,d2h,d0h
+			db	0fh,46h,47h,4eh,07h,3ch,89h,cch
+			db	cfh,74h,e1h,a7h,a3h,78h,6fh,85h
+			db	f6h,c7h,87h,8eh,ddh,60h,60h,66h
+			db	79h,e8h,c1h,d9h,b4h,74h,a0h,b4h
+			db	68h,5fh,09h,6dh,afh,4ch,aah,09h
+			db	25h,edh,8bh,2dh,40h,40h,f6h,98h
+			db	8ah,3ch,d3h,c7h,f0h,41h,d8h,fah
+			db	a1h,81h,1ah,09h,ach,11h,d5h,0eh
+			db	71h,b4h,dfh,15h,02h,97h,c1h,37h
+			db	e2h,26h,73h,27h,4ah,dah,8ah,a3h
+			db	9fh,3bh,94h,3ch,e9h,e3h,13h,91h
+			db	24h,17h,95h,6dh,cbh,f7h,3bh,a0h
+			db	e9h,4dh,75h,72h,78h,83h,9fh,beh
+			db	7ch,e1h,17h,cah,19h,dch,dch,4dh
+			db	19h,61h,3eh,7fh,31h,6eh,adh,0ah
+			db	12h,eah,23h,b9h,a5h,56h,47h,9eh
+			db	fah,e5h,7fh,9fh
+			ld	d,l
+			ld	c,(hl)
+			add	a,b
+			rla
+			jp	z,L3425
+			ld	b,a
+			call	po,Ld5bc
+			or	d
+			rst	08h
+			ld	d,h
+			and	39h
+			ld	c,c
+			sub	a
+			ld	h,e
+			ld	a,b
+			and	l
+			ld	a,c
+			add	a,(hl)
+			sbc	a,h
+			adc	a,c
+			adc	a,a
+			or	h
+			inc	l
+			sbc	a,19h
+			ld	d,l
+			jr	nc,L7600
+			ld	b,77h
+			cp	70h
+			adc	a,a
+			dec	sp
+			add	hl,de
+			jp	nc,Lfc49
+			sub	b
+			dec	de
+			inc	h
+			ld	c,c
+			ld	d,l
+			inc	c
+			ld	h,b
+			and	c
+			ld	l,6fh
+			res	2,(hl)
+			nop (2x) *
+			or	(hl)
+			and	a
+			ld	a,b
+			or	d
+			ld	a,c
+			ret	nz
+			add	a,h
+			jr	z,L7590
+			add	a,d
+			ld	l,d
+			ld	de,146dh
+			nop
+			dec	bc
+			ccf
+			ld	bc,bc97h
+			ld	a,(de)
+			ld	c,d
+			xor	(hl)
+			inc	h
+			ccf
+			ld	b,c
+			add	a,l
+			or	a
+			ld	(hl),a
+			xor	b
+			ld	b,d
+			and	c
+			ld	a,(edf1h)
+			jr	z,L7600
+			cp	e
+			add	hl,de
+			ld	a,c
+			adc	a,b
+			ld	e,63h
+			xor	e
+			ld	(hl),l
+			daa
+			sub	b
+			ld	bc,b614h
+			ld	l,l
+			ld	e,l
+			exx
+			jp	L99ec
+			db	25h,b0h,b9h,c7h,2fh,36h,34h,cbh
+			db	1bh,88h,e9h,a3h,30h,e0h,2ch,f0h
+			db	cdh,fbh,9dh,64h,3ch,40h
+			add	hl,sp
+			cp	l
+			ld	b,d
+			or	h
+			daa
+			inc	bc
+			and	a
+			sbc	a,d
+			sbc	a,c
+			ld	(hl),l
+			adc	a,(hl)
+			and	h
+			inc	e
+			ld	(13f9h),hl
+			ld	b,l
+			jp	L7218
+			db	69h,8ch,d5h,d5h,76h,0dh,d7h,35h
+			db	ech,50h,a1h,72h,15h,7ah,91h,0fh
+			db	4dh,02h,53h,dch,a2h,4dh,62h,30h
+			db	cch,5fh,5bh,cbh,84h,33h,95h,c9h
+			db	f5h,d5h,eah,32h,7ah,e8h,94h,28h
+			db	c1h,92h,74h,c9h,adh,82h,afh,94h
+			db	4eh,55h,99h,15h,95h,d5h,b9h,f9h
+			db	94h,32h,64h,bbh,abh,36h,c0h,1eh
+			db	b7h,36h,43h,c5h,deh,3bh,e7h,4eh
+			db	5eh,96h,6dh,62h,6fh,dah,13h,98h
+			db	1fh,57h,58h,edh,2ah,38h,14h,b4h
+			db	2fh,b1h,70h,f6h,f6h
+			ld	d,a
+			cp	d
+			ld	(bc),a
+			add	a,d
+			add	a,d
+			ex	(sp),hl
+			ld	(hl),c
+			ld	b,a
+			ld	(hl),6ch
+			ld	hl,4396h
+			jp	Lce35
+			db	e6h,6fh,bch,74h,abh,47h,16h,c6h
+			db	5eh,3ch,e9h,94h,bch,68h,0dh,a1h
+			db	5ah,1bh,03h,7ah,7eh,54h,9bh,d2h
+			db	cch,e2h,bbh,43h,12h,39h,5eh,42h
+			db	ddh,46h,26h,5ch,b4h,e7h,c7h,32h
+			db	3dh,70h,95h,24h,f7h,59h,34h,b4h
+			db	08h,7fh,11h,14h,85h,4fh
+			inc	b
+			di
+			ld	a,c
+			ld	d,l
+			add	a,d
+			ret
+			db	3dh,d9h,65h,11h,3fh,15h,cch,06h
+			db	21h,e5h
+			ld	d,a
+			ld	a,d
+			dec	h
+			add	a,70h
+			ld	d,d
+			rst	00h
+			ld	e,(hl)
+			ex	de,hl
+			dec	l
+			ld	a,a
+			ld	d,a
+			ld	c,(hl)
+			or	e
+			ld	a,a
+			call	po,L53c5
+			sub	edh
+			xor	h
+			or	h
+			jp	m,La9f3
+			daa
+			adc	a,d
+			ret	po
+			pop	af
+			rrca
+			jp	(hl)
+			db	a2h,e1h,7eh,14h,a9h,85h,f0h,bdh
+			db	6dh,eah
+			sub	d
+			ret	pe
+			dec	(hl)
+			dec	l
+			ld	h,d
+			ld	b,h
+			ld	(012fh),a
+			ld	(hl),e
+			ld	sp,hl
+			cp	c
+			pop	de
+			sub	37h
+			ld	sp,83f3h
+			and	eah
+			ld	e,e
+			ld	sp,75cfh
+			jp	z,L3dec
+			call	nz,L12b8
+			and	67h
+			ld	l,e
+			ld	l,l
+			ex	(sp),hl
+			inc	l
+			xor	e
+			jp	nc,L58fe
+			ld	b,(hl)
+			call	m,L4e3a
+			nop (2x) *
+			ld	e,b
+			push	bc
+			in	a,(49h)
+			add	a,e
+			ld	a,(de)
+			jp	nz,Le680
+			rst	28h
+			inc	de
+			and	30h
+			ld	(hl),38h
+			pop	de
+			or	d
+			ld	h,d
+			ld	a,b
+			ret	z
+			ld	bc,d8b1h
+			ld	c,l
+			inc	e
+			ld	l,a
+			ld	l,c
+			adc	a,h
+			jr	c,L76f0
+			and	h
+			ld	b,c
+			dec	h
+			ld	c,(hl)
+			inc	e
+			ex	(sp),hl
+			ld	l,c
+			adc	a,b
+			rst	08h
+			ld	a,l
+			ld	a,e
+			scf
+			add	a,d
+			and	l
+			add	a,(hl)
+			ld	h,b
+			ld	hl,70c6h
+			jr	nc,L7700
+			dec	de
+			pop	hl
+			and	h
+			or	e
+			ld	l,h
+			jp	po,Ld4ec
+			sub	4ah
+			ld	(3035h),hl
+			inc	de
+			adc	a,h
+			inc	h
+			ld	a,b
+			ld	a,c
+			ld	(8405h),a
+			add	a,h
+			rst	20h
+			jr	nc,L77b8
+			ld	bc,02cdh
+			cp	b
+			daa
+			and	l
+			jp	nz,L9328
+			call	L9a4c
+			inc	d
+			ld	c,c1h
+			di
+			or	(hl)
+			and	d
+			sbc	a,b
+			ld	a,(bc)
+			dec	sp
+			ld	a,c3h
+			ld	d,(hl)
+			pop	bc
+			jp	z,L827e
+			jp	c,Lc5ff
+			ld	h,h
+			call	z,La419
+			sbc	a,(hl)
+			rla
+			adc	a,b
+			cp	b
+			ld	(hl),d
+			ld	d,(hl)
+			or	e
+			add	hl,sp
+			ex	(sp),hl
+			sub	h
+			rst	00h
+			and	a
+			ld	d,a
+			ld	l,e
+			sub	e
+			ret	m
+			ld	e,(hl)
+			cp	c
+			rlca
+			ccf
+			dec	a
+			ret	nc
+			ld	h,b
+			dec	l
+			ld	e,(hl)
+			or	c
+			nop
+			and	b4h
+			ld	h,l
+			ld	d,d
+			ld	h,(hl)
+			ld	h,h
+			xor	d
+			call	z,L7135
+			cp	l
+			dec	d
+			ld	l,17h
+			push	hl
+			out	(6ch),a
+			out	(08h),a
+			jp	L786b
+			db	01h,5ch,49h,ach,24h,20h,f7h,e0h
+			db	fch,62h,1bh,bdh,beh,eeh,f6h,a2h
+			db	24h,02h,5fh,91h,1eh,99h,42h,00h
+			db	5ah,a7h,30h,fch,53h,aeh,13h,e3h
+			db	d3h,7bh
+			ld	c,c
+			add	a,e
+			add	hl,hl
+			sub	l
+			inc	e
+			rst	10h
+			jp	z,L9094
+			add	hl,sp
+			dec	e
+			inc	de
+			ld	a,d
+			di
+			ld	c,l
+			jp	c,Lf5a6
+			cp	e
+			ld	a,l
+			ld	de,7671h
+			call	c,L09a6
+			adc	a,(hl)
+			ld	l,e
+			exx
+			cp	h
+			ld	(hl),e
+			cp	e
+			ret	m
+			ld	c,(hl)
+			sub	e
+			rst	30h
+			or	(hl)
+			cp	b
+			xor	(hl)
+			call	nz,Ld15e
+			ld	a,h
+			dec	l
+			ld	e,l
+			sub	d
+			scf
+			rst	38h
+			ld	(bc),a
+			jr	nc,L77df
+			ld	(bc),a
+			dec	sp
+			and	h
+			ret	pe
+			ld	b,e
+			inc	b
+			pop	hl
+			and	b
+			sub	a
+			scf
+			ld	l,b
+			or	c
+			jp	pe,Lebe1
+			ld	c,84h
+			jp	L22f8
+			db	90h,19h,ach,d4h,19h,f6h,f8h,07h
+			db	a6h,30h,26h,bbh,b7h,53h,b4h,65h
+			db	59h,27h,c4h,17h,bbh,3eh,b9h,f1h
+			db	dbh,4ch,10h,42h,82h,44h,20h,5bh
+			db	8bh,82h,dbh,71h,aeh,7fh,85h,70h
+			db	97h,f6h,44h,b1h,edh,a7h,37h,72h
+			db	ddh,63h,41h,02h,5bh,6dh,d7h,3ch
+			db	63h,ebh,f5h,7dh,13h,25h,68h,dfh
+			db	04h,c6h,f5h,e4h,afh
+			add	a,e
+			ld	h,a2h
+			ld	b,e
+			sub	h
+			jp	m,L1bd5
+			add	a,e
+			add	a,e
+			ret	p
+			cp	e
+			inc	b
+			ld	(hl),l
+			ld	e,h
+			di
+			ld	de,4b83h
+			ld	d,a
+			dec	e
+			ld	(hl),d
+			out	(a8h),a
+			add	hl,sp
+			ld	l,e
+			ld	a,d
+			inc	b
+			and	(hl)
+			cp	l
+			ld	c,l
+			ld	b,d
+			and	(hl)
+			sbc	a,d
+			ld	l,l
+			dec	sp
+			ret	nc
+			dec	bc
+			nop
+			ld	l,l
+			sbc	a,l
+			sub	0ah
+			jp	(hl)
+			db	adh,dfh
+			sbc	a,l
+			ld	b,e
+			ld	b,c
+			pop	de
+			ld	e,d
+			ld	a,e
+			add	hl,sp
+			ld	d,(hl)
+			sbc	a,c
+			or	h
+			ei
+			and	l
+			nop
+			ei
+			ld	c,efh
+			call	c,Lf47d
+			ld	l,c
+			di
+			ld	a,b
+			cp	l
+			sbc	a,b
+			ld	(hl),a
+			adc	a,l
+			cp	a
+			ld	d,d
+			ld	a,a
+			rst	28h
+			ld	h,b
+			rst	30h
+			dec	b
+			ld	l,(hl)
+			ld	a,a
+			or	c
+			ld	a,(de)
+			xor	b
+			cp	e
+			ld	b,c
+			jr	c,L7871
+			or	c
+			ld	h,a
+			add	a,b
+			ld	l,72h
+			ld	h,h
+			dec	b
+			xor	(hl)
+			xor	c
+			xor	b
+			sub	(hl)
+			dec	hl
+			jp	po,L23c3
+			ld	sp,ac10h
+			add	hl,bc
+			or	a
+			adc	a,h
+			ld	l,d
+			ld	d,l
+			rst	00h
+			and	d
+			adc	a,c
+			push	de
+			jp	(hl)
+			db	97h,9fh,afh
+			ld	e,d
+			ld	a,l
+			ld	c,l
+			dec	d
+			push	de
+			dec	c
+			push	bc
+			sub	c
+			ex	(sp),hl
+			ld	h,c
+			add	hl,sp
+			ld	(hl),d
+			ld	b,e
+			rst	18h
+			add	a,l
+			xor	d
+			sub	l
+			call	po,L0e63
+			sub	d
+			ld	h,c
+			call	c,Ld20f
+			ld	d,c
+			ld	(hl),d
+			scf
+			jr	L78e2
+			db	fch,2fh,dah,efh,51h,79h,fbh,63h
+			db	e3h,07h
+			ret
+			db	ebh,71h,b4h,edh,dbh,b2h,9fh,14h
+			db	e2h,98h,f7h,37h,04h,0ch,b0h,31h
+			db	30h,70h
+			inc	b
+			ld	h,d
+			ld	c,d
+			ld	b,l
+			nop (2x) *
+			jr	nz,L7943
+			xor	h
+			push	bc
+			sbc	a,d
+			sub	d
+			ld	(bc),a
+			call	po,L30a2
+			or	a
+			pop	af
+			dec	b
+			ld	h,45h
+			adc	a,aeh
+			sbc	a,b
+			jp	p,Lfc28
+			adc	a,e
+			rla
+			sub	e
+			xor	80h
+			sbc	a,h
+			ld	c,l
+			or	b7h
+			pop	hl
+			jp	z,Lad73
+			cp	l
+			xor	h
+			cp	a
+			exx
+			ld	l,e
+			cp	l
+			di
+			call	c,L6fad
+			ld	d,b
+			or	a
+			xor	h
+			add	hl,bc
+			sub	f2h
+			and	l
+			pop	bc
+			sbc	a,e
+			ld	e,d
+			sub	(hl)
+			inc	bc
+			ld	c,(hl)
+			ld	c,h
+			push	de
+			ld	a,e8h
+			halt
+			ld	b,c
+			ld	a,97h
+			jp	nc,L9dee
+			rlca
+			in	b,(c)
+			ld	b,l
+			ld	h,h
+			ret	z
+			ld	d,d
+			jp	z,Lff32
+			ld	d,e
+			and	d
+			rst	08h
+			ld	e,l
+			ld	d,h
+			ld	h,76h
+			xor	(hl)
+			add	a,h
+			ld	(c399h),a
+			rla
+			push	de
+			ex	af,af'
+			ld	e,h
+			ld	sp,ac2ah
+			rst	10h
+			add	a,a
+			ld	c,d
+			or	b
+			ld	h,l
+			ld	(d97dh),hl
+			ld	c,d
+			ld	de,7cbch
+			or	d
+			add	a,fch
+			ld	a,(de)
+			nop (2x) *
+			ret	pe
+			ld	a,(7b53h)
+			inc	hl
+			ld	c,50h
+			ld	(hl),d
+			add	a,(hl)
+			inc	bc
+			rst	00h
+			dec	c
+			push	af
+			or	(hl)
+			jr	nc,L796d
+			and	(hl)
+			daa
+			and	c
+			ex	(sp),hl
+			ld	b,e
+			ld	(hl),e
+			ex	(sp),hl
+			ld	a,a
+			ld	h,55h
+			ld	a,(de)
+			ld	d,l
+			dec	e
+			rst	20h
+			cp	b
+			ld	a,(bc)
+			dec	hl
+			ld	(aa0ah),a
+			add	a,a
+			adc	a,d
+			ld	a,l
+			call	L64e1
+			ld	a,d
+			ld	(hl),d5h
+			adc	a,h
+			inc	de
+			sbc	a,(hl)
+			dec	c
+			jp	c,Lb2f1
+			set	6,d
+			ld	(hl),b
+			ld	e,cch
+			inc	de
+			pop	af
+			ld	c,l
+			ld	(bc),a
+			ret	c
+			ld	(hl),l
+			xor	(hl)
+			call	nz,L444b
+			ld	a,(bc)
+			daa
+			ld	e,d
+			inc	de
+			and	e
+			jr	L79e9
+			db	48h,84h,7eh,dch,c2h,fah,a5h,60h
+			db	a2h,97h,c8h
+			jr	c,L79dc
+			ld	e,e
+			cp	a
+			ld	a,b9h
+			call	p,L1fc2
+			ld	b,h
+			ld	d,(hl)
+			ld	e,h
+			push	af
+			exx
+			ld	hl,4e79h
+			jp	m,Le8f4
+			dec	(hl)
+			add	a,c
+			cp	f8h
+			push	bc
+			call	L9664
+			ld	h,(hl)
+			sub	l
+			add	a,d
+			ld	a,l
+			ld	l,(hl)
+			ld	(hl),e
+			add	a,(hl)
+			ld	(hl),h
+			ld	e,l
+			ret	c
+			or	h
+			rrca
+			or	10h
+			push	de
+			daa
+			and	(hl)
+			ld	b,b
+			jp	p,Lfdcd
+			add	hl,sp
+			dec	h
+			inc	a
+			inc	l
+			ret	m
+			ld	c,d
+			cp	c
+			di
+			sub	37h
+			xor	e
+			adc	a,b
+			add	a,e
+			cp	fah
+			rst	08h
+			ld	l,14h
+			add	a,a
+			cp	l
+			ld	(9179h),a
+			ld	b,d
+			ld	h,h
+			inc	a
+			sbc	a,e
+			ld	c,a
+			ret
+			db	2fh,68h,08h,56h,77h,c4h,d8h,26h
+			db	9ah,1bh,c3h,1dh,21h,0fh,b3h,46h
+			db	20h,28h,1dh,2ch,71h,b9h,c9h,c9h
+			db	69h,97h,8bh,82h,e7h,25h,eah,84h
+			db	0ch,61h,a6h,bch,e8h,47h,84h,10h
+			db	b7h,d5h,e4h,07h,24h,44h,78h,0ch
+			db	73h,97h,8bh,2dh,49h,65h,70h,c9h
+			db	beh,93h,15h,94h,dbh,54h,b4h,0dh
+			db	afh,85h,beh,90h,57h,5ch,1eh,3dh
+			db	6ah,aah,e7h,7dh,02h,01h,4dh,82h
+			xor	h
+			ld	hl,9a9dh
+			ld	(hl),h
+			rrca
+			ld	hl,(8555h)
+			push	de
+			rst	30h
+			add	hl,de
+			nop (2x) *
+			ex	(sp),hl
+			ld	hl,2889h
+			ret	c
+			and	b
+			xor	l
+			or	c
+			di
+			ld	(hl),74h
+			adc	a,d
+			inc	e
+			call	po,Lbc80
+			cp	e
+			xor	c
+			xor	h
+			ld	a,12h
+			ld	d,l
+			inc	h
+			and	d
+			ld	e,e
+			sbc	a,c
+			ld	c,b6h
+			adc	a,e
+			ld	h,d
+			add	hl,de
+			ld	a,80h
+			ld	h,h
+			rra
+			dec	d
+			cp	77h
+			ld	b,l
+			ld	a,e
+			ld	sp,d68dh
+			ld	(hl),b
+			cp	l
+			out	(a2h),a
+			ld	e,a
+			ld	b,52h
+			adc	a,b
+			and	a
+			rra
+			xor	e
+			inc	b
+			ld	b,b
+			rla
+			ld	e,l
+			ld	a,ixl *
+			ld	c,d
+			ld	c,d
+			sbc	a,b
+			xor	d
+			out	(95h),a
+			dec	c
+			ret	nc
+			cp	e
+			cp	a
+			inc	d
+			ld	d,h
+			ld	a,(de)
+			ld	a,d
+			adc	a,a
+			rrca
+			inc	bc
+			nop (2x) *
+			dec	b
+			adc	a,(hl)
+			sub	b
+			jr	nz,L7acd
+			rst	10h
+			cp	(hl)
+			pop	bc
+			ld	e,d
+			add	a,86h
+			ld	a,d
+			ld	b,h
+			ld	l,d
+			ld	a,h
+			inc	h
+			ld	(hl),a
+			halt
+			djnz	L7a87
+			ld	(hl),d
+			and	l
+			or	0ah
+			cp	d
+			ld	hl,2127h
+			inc	l
+			push	de
+			ld	(hl),h
+			adc	a,(hl)
+			ld	d,b
+			inc	c
+			ld	a,(hl)
+			ld	d,a
+			call	m,L6f5b
+			ld	(e4beh),a
+			inc	a
+			jp	c,Lf793
+			adc	a,c
+			dec	(hl)
+			ld	e,h
+			nop
+			add	a,h
+			and	a
+			dec	c
+			inc	c
+			dec	a
+			jp	p,L514d
+			ld	(hl),d
+			and	b
+			nop (2x) *
+			exx
+			ld	b,4bh
+			ld	e,d
+			call	z,L0900
+			rst	00h
+			ret	nc
+			jr	nc,L7b21
+			sbc	a,e
+			rrca
+			cpl
+			rst	18h
+			ld	l,d
+			adc	a,e
+			ld	hl,1ad6h
+			cp	a
+			ld	c,5dh
+			pop	hl
+			pop	hl
+			ld	b,3dh
+			ld	a,c
+			ret	pe
+			nop
+			dec	l
+			ld	(hl),ffh
+			inc	(hl)
+			push	hl
+			or	h
+			inc	h
+			ld	(bc),a
+			ld	c,e
+			inc	a
+			or	(hl)
+			ld	c,a
+			cp	4fh
+			ld	(de),a
+			jr	L7ba5
+			db	45h,ffh,cdh,dbh,c6h,1bh,52h,00h
+			db	a6h,13h,edh,e1h,feh,2bh,c6h,36h
+			db	dfh,73h,f0h,77h,6bh,c7h,adh,17h
+			db	adh,85h,84h,fch,83h
+			jr	nz,L7b30
+			ld	d,cfh
+			ld	h,d
+			ld	h,a
+			inc	e
+			jr	c,L7ba1
+			daa
+			and	b
+			call	nc,L3289
+			ld	(hl),b
+			ld	b,h
+			ld	h,l
+			jr	nc,L7bad
+			ld	b,36h
+			ld	d,h
+			ld	e,e
+			ret	nz
+			sub	a
+			adc	a,c
+			or	h
+			or	61h
+			xor	b
+			jr	c,L7ba8
+			push	de
+			jp	(hl)
+			db	d5h,27h,d1h,93h,4eh,27h,c9h,9bh
+			db	2bh,8dh,a2h,bch,83h,67h,aah,04h
+			db	cch,f9h,84h
+			ld	a,d
+			or	d
+			ret	pe
+			ld	d,h
+			or	91h
+			jp	pe,L46ef
+			and	a
+			ld	c,a
+			ld	(hl),d
+			rla
+			ret	nc
+			call	m,L98e1
+			add	a,e
+			ld	a,a
+			ld	(hl),61h
+			ld	h,d
+			or	h
+			call	p,L9681
+			dec	b
+			ld	d,b
+			ld	(bc),a
+			ret	z
+			inc	a
+			sbc	a,b
+			rst	30h
+			call	c,L7ead
+			out	(abh),a
+			cp	l
+			ld	d,b
+			ld	d,(hl)
+			djnz	L7c00
+			sub	f9h
+			ld	b,c
+			add	a,c
+			ld	a,e
+			or	l
+			or	e1h
+			and	c
+			call	Lb172
+			adc	a,8dh
+			ret	po
+			add	hl,sp
+			dec	bc
+			ld	b,a
+			inc	b
+			ld	hl,0699h
+			ld	(hl),h
+			jp	m,L7ec2
+			xor	b
+			dec	hl
+			di
+			xor	c
+			or	e
+			in	a,(56h)
+			dec	bc
+			ld	sp,hl
+			ld	a,b4h
+			add	hl,de
+			rst	10h
+			ld	hl,d9a2h
+			ld	l,l
+			ld	d,l
+			cp	(hl)
+			and	a
+			xor	h
+			and	h
+			ld	a,e
+			add	hl,hl
+			ccf
+			ld	d,e
+			add	a,e
+			nop (2x) *
+			ld	e,c
+			add	a,d
+			add	a,d
+			sub	c
+			xor	(hl)
+			dec	bc
+			push	de
+			inc	a
+			pop	af
+			inc	e
+			ret	c
+			ret
+			db	75h,ech,e8h,eeh,09h,65h,96h,a3h
+			db	65h,a9h,5eh,3bh,34h,83h,cah,58h
+			db	abh,ach,b4h,2eh,c0h,2ch
+			or	a
+			adc	a,c
+			or	d
+			or	a
+			jp	z,Lb0bc
+			ld	a,(b647h)
+			ld	h,a
+			ret	z
+			or	l
+			ld	h,d
+			call	L9858
+			ld	(53b1h),hl
+			call	L24a8
+			jp	c,L175b
+			cpl
+			or	b
+			rrca
+			dec	l
+			ld	l,e
+			and	h
+			add	a,h
+			ld	h,l
+			sub	d
+			ld	(hl),c
+			and	h
+			ld	e,d
+			ccf
+			ld	c,a
+			ld	d,h
+			and	b
+			adc	a,b
+			and	c
+			xor	l
+			add	hl,sp
+			rrca
+			ld	e,b1h
+			jp	Ledc3
+			db	10h,e8h,3bh,beh,cfh,17h,94h,87h
+			db	a8h,95h,f9h,16h,e8h,c0h,57h,74h
+			db	c4h,66h,25h,e1h,c1h,1fh,28h,9fh
+			db	4ch,17h,49h,38h,99h,43h,d6h,bch
+			db	6bh,36h,78h,73h,33h,e7h,d6h,aah
+			db	a5h,61h,d1h,cch,c6h,a5h,adh,5dh
+			db	36h,1ch,a4h,86h,5fh,fbh,0ah,c8h
+			db	b4h,84h,45h,dah,72h,07h,1fh,72h
+			db	b9h,f0h,a4h,87h,4bh,8eh,ddh,59h
+			db	81h,12h,64h,96h,a8h,71h,f0h,c8h
+			db	dch,6fh,70h,24h,a0h,27h,80h,ceh
+			db	56h,18h,9ch,29h,59h,92h,85h,00h
+			db	72h,61h,18h,62h,3bh,75h,f9h,46h
+			db	cdh,ech,22h,40h,53h,84h,74h,6eh
+			db	00h,72h,35h,0bh,a0h,f9h,7eh,96h
+			db	bah,02h,3ch,e9h,a0h,73h,12h,f3h
+			db	14h,50h,97h,8dh,18h,2fh,ffh,2bh
+			db	8bh,9dh,a2h,93h,57h,1bh,51h,8eh
+			db	f7h,c0h,fch,19h,9fh,a6h,f5h,48h
+			db	c5h,2fh,4bh,75h,7eh,9dh,f0h,66h
+			db	5ch,beh,1eh,68h,23h,0ah,02h
+			pop	af
+			ld	d,c9h
+			sbc	a,b
+			ld	sp,96adh
+			sbc	a,c
+			rst	30h
+			adc	a,d
+			add	a,c
+			sub	7ah
+			ld	(de),a
+			ld	(hl),h
+			rla
+			push	de
+			ld	b,l
+			ld	h,d
+			ld	h,a
+			jp	nz,L08be
+			or	h
+			rst	38h
+			ret	pe
+			ld	(de),a
+			add	hl,hl
+			inc	b
+			ret	nc
+			ld	a,l
+			xor	(hl)
+			ld	d,e
+			add	a,(hl)
+			ld	c,(hl)
+			add	hl,bc
+			rra
+			cp	d
+			push	de
+			scf
+			ld	b,d
+			ld	(hl),e
+			ld	(hl),c
+			and	h
+			ld	c,b
+			djnz	L7d22
+			ld	(2432h),hl
+			cp	a
+			exx
+			sbc	a,e
+			ld	(de),a
+			and	l
+			ld	d,e
+			ld	(hl),65h
+			ld	d,e
+			adc	a,a
+			ret	m
+			and	d
+			or	l
+			adc	a,h
+			ld	e,9bh
+			neg *
+			xor	b
+			ld	l,e5h
+			ld	e,c
+			jr	nz,L7d4a
+			rst	00h
+			ret	nz
+			ld	a,(hl)
+			or	h
+			or	d
+			ld	l,a
+			sub	e
+			call	c,L1c9f
+			inc	a
+			sbc	a,d
+			rrca
+			daa
+			ld	e,(hl)
+			ld	a,(de)
+			add	a,d
+			jp	L4c4c
+			db	d6h
+			xor	(hl)
+			call	pe,L3958
+			xor	h
+			ld	(hl),h
+			ld	hl,0c36h
+			jp	m,Lbdd3
+			ld	l,e
+			ld	a,ixl *
+			ld	h,a
+			add	a,h
+			nop (2x) *
+			nop
+			sub	l
+			inc	e
+			ld	c,d
+			inc	b
+			ld	d,l
+			call	p,L7899
+			adc	a,l
+			xor	c
+			ld	h,(hl)
+			ld	c,c
+			ld	(ix + b6h),c
+			call	c,L9a6f
+			or	h
+			ld	(de),a
+			ld	b,h
+			ld	e,d
+			ld	c,a
+			set	5,e
+			ld	(hl),a
+			rst	18h
+			ld	a,(hl)
+			ld	a,l
+			jr	z,L7da5
+			sbc	a,a8h
+			add	a,d
+			ld	a,(abd8h)
+			ld	h,c
+			or	l
+			cp	d
+			xor	a
+			xor	cfh
+			ld	c,c6h
+			sub	e
+			call	L29b6
+			jp	nc,Lc8fb
+			add	a,h
+			call	p,L3ab3
+			xor	l
+			ld	(hl),d
+			cp	65h
+			im	1 *
+			xor	d
+			ld	hl,65bah
+			ld	a,(de)
+			rst	08h
+			or	bdh
+			jr	nc,L7e06
+			djnz	L7de1
+			jp	m,L4b8f
+			ld	e,l
+			call	m,Ld71a
+			xor	98h
+			xor	h
+			cp	e
+			ret	nc
+			cpl
+			inc	c
+			ld	b,(hl)
+			ld	e,d
+			ex	(sp),hl
+			ld	b,a
+			ld	l,a
+			ld	l,h
+			ld	(hl),c
+			ld	d,d
+			xor	b
+			add	a,c
+			ld	hl,6fe7h
+			ld	de,8d31h
+			inc	de
+			ld	h,e
+			ld	e,e
+			sub	l
+			or	h
+			ret	p
+			adc	a,d
+			ld	h,h
+			add	a,d
+			add	a,e
+			ld	(de),a
+			ld	b,d
+			add	a,(hl)
+			sub	(hl)
+			rlca
+			ei
+			ld	e,b
+			call	nc,L5e8e
+			cp	d
+			sub	b
+			rst	10h
+			jr	L7dae
+			db	05h,38h,b2h,4eh,c5h,77h,5ah,f6h
+			db	1eh,3fh,c8h,d7h,a5h,4bh
+			cp	a
+			or	c
+			ld	e,(hl)
+			ld	c,fah
+			rra
+			jr	z,L7d8a
+			nop
+			or	h
+			inc	sp
+			ld	l,bch
+			ccf
+			call	po,Lff1a
+			ld	sp,hl
+			ld	h,e
+			ld	b,c
+			ld	l,e
+			rst	38h
+			nop
+			halt
+			jp	(hl)
+			db	bah,84h,02h,45h,f2h,40h,7bh,d0h
+			db	8bh,24h,c9h,efh,40h,50h,6ch,47h
+			db	53h,e0h,98h,3ch,8bh,07h,08h,beh
+			ld	a,5bh
+			ld	c,e
+			dec	(hl)
+			inc	hl
+			ret	z
+			ld	b,b
+			ld	hl,10aeh
+			dec	(hl)
+			ret	nz
+			ret	pe
+			ld	(de),a
+			ret	p
+			sub	b
+			ld	b,c
+			sbc	a,c
+			ld	b,b
+			ld	a,8eh
+			adc	a,h
+			rst	00h
+			jp	po,L5780
+			sub	a
+			sub	h
+			cpl
+			rst	28h
+			push	af
+			ld	b,h
+			ld	a,c
+			ld	l,l
+			sbc	a,h
+			dec	d
+			inc	c
+			ld	l,21h
+			ex	af,af'
+			call	nc,L688d
+			rrca
+			ret
+			db	4bh,49h,cdh,b7h,37h,93h,73h,7bh
+			db	bfh,26h,20h,a9h,2bh,e9h,8ch,5ch
+			db	b0h,e8h,41h
+			adc	a,(hl)
+			ld	a,a
+			jr	L7e02
+			db	75h,44h,05h,d3h,66h,b1h,d7h,02h
+			db	b0h,1ch,6ah,3fh,d7h,11h,38h,71h
+			db	62h,18h,16h,5fh,7ch,d5h,efh,e8h
+			db	73h,11h,f2h,feh,aah,52h,97h,f5h
+			db	e0h,b8h,ceh,11h,89h,10h,40h,eah
+			db	55h,d2h,b9h,c1h,93h,9bh,62h,bah
+			db	06h,1ah,d6h,66h,bah,e8h
+			ld	d,e
+			ld	c,b
+			xor	l
+			sbc	a,l
+			inc	c
+			ld	(hl),a
+			ld	a,a
+			sub	l
+			sbc	a,b
+			dec	de
+			ld	b,71h
+			or	a
+			sbc	a,a
+			ex	de,hl
+			rst	10h
+			sub	88h
+			ld	l,b
+			ld	h,b
+			or	h
+			ld	de,7310h
+			ld	d,a
+			add	hl,bc
+			ld	de,8b99h
+			jr	nz,L7e73
+			ld	c,c
+			call	m,Lf84b
+			cp	h
+			ld	(517eh),hl
+			inc	c
+			jp	nc,L9473
+			ld	b,4ah
+			adc	a,l
+			cp	h
+			jr	L7ed3
+			db	26h,2ch,28h,b2h,f1h,d7h,bbh,cfh
+			db	90h,71h,7fh,83h,b9h,52h,34h,0fh
+			inc	(hl)
+			adc	a,(hl)
+			ret
+			db	f3h,81h,1fh,17h,edh,25h,33h,05h
+			db	52h,fdh,29h,57h,a5h,b0h,c3h,81h
+			db	3ch,70h,1dh,73h,b2h,7bh,99h,e2h
+			db	96h,ebh,86h,b6h,c4h,75h,d5h,97h
+			db	f3h,d2h,1ah,b6h,5eh,64h,1bh,0ah
+			db	46h,17h,81h,e0h,69h,b1h,3ah,abh
+			db	fah,51h,dch,b6h,06h,dch,5ah,33h
+			db	c6h
+			ld	h,l
+			ld	l,l
+			push	bc
+			add	hl,bc
+			inc	b
+			dec	e
+			scf
+			ld	e,c
+			call	p,L5722
+			pop	hl
+			add	a,c
+			jp	p,Lae57
+			jp	p,Lc5f4
+			ld	h,c
+			xor	e
+			sub	(hl)
+			or	h
+			adc	a,d
+			rst	38h
+			sub	l
+			ld	(bc),a
+			add	a,l
+			add	hl,de
+			xor	e
+			ld	c,e
+			and	a
+			and	a
+			ld	c,h
+			jr	nc,L7eee
+			set	7,(hl)
+			jp	p,Lb729
+			ccf
+			ccf
+			inc	a
+			jp	pe,L14e6
+			xor	24h
+			inc	h
+			adc	a,h
+			call	pe,L815f
+			dec	h
+			ld	h,b
+			inc	hl
+			sbc	a,c
+			sub	c
+			nop (2x) *
+			rlca
+			jp	nc,L8a34
+			add	hl,hl
+			rst	30h
+			and	e
+			ld	(hl),b
+			ret	m
+			djnz	L7fa4
+			sub	d
+			ld	l,h
+			inc	(hl)
+			ld	b,h
+			ld	e,l
+			rst	20h
+			ld	e,h
+			ld	(de),a
+			ld	a,(hl)
+			ld	a,(de)
+			ld	e,(hl)
+			dec	e
+			ld	l,d
+			ld	sp,8232h
+			or	l
+			sbc	a,e
+			call	c,L8de9
+			ld	a,h
+			inc	h
+			dec	a
+			dec	de
+			ex	(sp),hl
+			and	h
+			ld	c,b
+			dec	d
+			inc	c
+			add	a,e
+			ld	hl,e95ah
+			ld	a,(bc)
+			xor	d
+			ei
+			scf
+			sub	(hl)
+			ld	a,a0h
+			ld	c,a
+			jp	nc,Ledaa
+			inc	h
+			cp	e
+			cpl
+			adc	a,a
+			push	bc
+			bit	0,l
+			xor	d
+			ld	a,(de)
+			dec	l
+			add	hl,bc
+			ex	(sp),hl
+			halt
+			rst	38h
+			pop	de
+			sbc	a,h
+			call	z,Lcb53
+			adc	a,e
+			djnz	L7f3a
+			ld	(hl),c
+			jp	(hl)
+			db	6eh,a2h,31h,14h,e8h,b9h,a4h,cdh
+			db	b4h,95h,40h,94h,f7h,b7h,61h,13h
+			db	5dh,47h,77h,8ch,46h,24h,40h,eeh
+			db	59h,53h,75h,90h,87h,37h,30h,5bh
+			db	cbh,c3h,6ah,01h,ach,b2h,17h,d8h
+			db	2dh,2bh,78h,97h,18h,42h,12h,d7h
+			db	74h,16h,c8h,57h,05h,08h,b6h,22h
+			db	89h,fdh,30h
+			or	64h
+			and	h
+			ld	h,bah
+			ex	(sp),hl
+			xor	c
+			ld	c,e
+			add	a,b
+			inc	c
+			ld	h,l
+			ld	a,(de)
+			call	z,Lad57
+			dec	a
+			sub	(hl)
+			ld	(a1c4h),hl
+			in	a,(36h)
+			adc	a,b
+			out	(ech),a
+			jr	L8023
+			db	20h,ffh,48h,f0h,0bh,fah
+			ld	e,b
+			jp	m,La164
+			jr	nz,L8066
+			inc	de
+			ld	sp,hl
+			sbc	a,e
+			ld	e,h
+			ld	e,l
+			ld	c,l
+			ei
+			ret	pe
+			and	e
+			ld	a,(hl)
+			ld	b,d
+			sub	l
+			ld	l,(hl)
+			or	l
+			jr	L8065
+			db	22h,58h,cah,e2h,0fh,ffh,91h,1eh
+			db	a8h,27h,1dh,c4h,a7h,73h,2ah,00h
+			db	d0h,cfh,f8h,b9h,eeh,b3h,1fh,2dh
+			db	d5h,01h,11h,8bh,a1h,52h,c2h,b9h
+			db	49h,92h,35h,b9h,8dh,98h,5ch,7bh
+			db	cfh,8bh,69h,c9h,b9h,93h,d1h,59h
+			db	33h,cfh,5dh,8bh,7fh,61h,59h,eah
+			db	8ah,5ch,85h,a9h,00h
+			call	L8e20
+			ld	l,a
+			call	po,L95e3
+			sbc	a,e
+			ld	sp,d3e2h
+			inc	b
+			ld	a,(de)
+			ld	d,e
+			call	pe,L4c97
+			ld	a,d
+			dec	h
+			adc	a,l
+			ld	c,l
+			ld	c,b
+			inc	de
+			pop	bc
+			and	82h
+			jp	pe,L007d
+			ld	a,l
+			ld	(hl),b
+			inc	h
+			dec	c
+			ld	sp,hl
+			ld	d,h
+			dec	bc
+			xor	h
+			and	c
+			ex	(sp),hl
+			add	a,l
+			sbc	a,e
+			add	hl,hl
+			add	a,(hl)
+			ld	e,d
+			ld	a,e
+			rst	30h
+			rst	20h
+			ld	d,l
+			in	a,(60h)
+			xor	h
+			ld	h,l
+			add	a,d
+			add	hl,sp
+			ccf
+			sbc	a,d
+			ld	l,d
+			ld	(hl),e
+			jp	po,L3a90
+			ld	h,(hl)
+			or	l
+			sub	l
+			add	hl,hl
+			sub	d
+			scf
+			ld	hl,e439h
+			jp	c,L76b7
+			jp	nc,L036d
+			xor	d
+			ld	d,b
+			add	a,c3h
+			ld	b,a
+			add	a,c
+			rst	38h
+			ld	(hl),h
+			ld	(de),a
+			ret	po
+			add	a,d
+			ld	(hl),e
+			ld	c,e
+			ld	h,a
+			cp	cbh
+			ex	af,af'
+			push	hl
+			di
+			add	hl,hl
+			or	e
+			or	a
+			push	af
+			cp	l
+			and	(hl)
+			ld	e,a
+			ld	d,(hl)
+			adc	a,c
+			ld	l,e
+			ld	a,(e7ffh)
+			add	a,(hl)
+			rst	08h
+			call	m,L0a26
+			ld	a,(hl)
+			call	m,Lf864
+			and	l
+			add	a,d
+			ld	e,h
+			jp	nz,Le39c
+			nop
+			ld	h,(hl)
+			ld	(6c2fh),hl
+			and	(hl)
+			ld	d,d
+			ld	(hl),l
+			ccf
+			cp	h
+			scf
+			ld	l,d
+			push	af
+			ld	l,d
+			ld	sp,cca8h
+			scf
+			ld	c,e
+			ld	c,c
+			ld	e,l
+			dec	c
+			dec	a
+			ld	e,e
+			add	hl,bc
+			ccf
+			sbc	a,l
+			add	a,b
+			adc	a,l
+			nop (2x) *
+			cpl
+			ld	b,b
+			ld	l,(hl)
+			ld	e,c
+			jr	c,L80d1
+			sub	a
+			ld	h,d
+			ex	de,hl
+			ld	d,l
+			inc	hl
+			sbc	a,h
+			call	c,Le470
+			ld	d,c
+			inc	a
+			adc	a,(hl)
+			dec	c
+			ld	d,d
+			call	c,Lfa2a
+			sbc	a,(hl)
+			sub	a
+			ld	c,h
+			or	e
+			xor	d
+			and	c9h
+			jp	z,L9369
+			sub	b
+			dec	c
+			nop (2x) *
+			ld	c,e
+			ld	sp,eddbh
+			sub	e
+			ld	e,b
+			sbc	a,b
+			add	a,a
+			cp	a
+			ld	e,h
+			ld	l,(hl)
+			ret	z
+			ex	de,hl
+			sub	c
+			ld	a,c
+			pop	de
+			xor	d
+			ld	a,(de)
+			sbc	a,(hl)
+			rst	00h
+			call	pe,L6245
+			xor	a
+			ld	a,c
+			ld	c,h
+			ld	c,b
+			ld	b,1dh
+			ld	e,a
+			sub	b
+			ld	b,b
+			dec	bc
+			and	e
+			add	hl,bc
+			ld	e,l
+			dec	d
+			ld	(de),a
+			sub	(hl)
+			exx
+			rst	10h
+			ld	h,6ch
+			jp	Lf140
+			db	92h,e2h,e2h,c9h,b7h,f9h,b2h,6ch
+			db	98h,08h,81h,12h,deh,e7h
+			ld	b,h
+			add	a,86h
+			xor	(hl)
+			ex	(sp),hl
+			jr	nz,L8125
+			or	c
+			jp	p,L58d9
+			jp	p,Lb7a4
+			sbc	a,h
+			ret	po
+			ccf
+			ld	(87d2h),hl
+			inc	l
+			jp	L2e05
+			db	78h,f2h,60h,4ah,d1h,6ah,1ch,63h
+			db	08h,e2h,ddh,29h,7eh,4ch,e9h,d7h
+			db	dfh,87h,39h,e4h,17h,47h,ach,b9h
+			db	2ah,43h,4ch,2ch,72h,b4h,adh,9bh
+			db	0dh,54h,6ch,bfh,a7h,a7h,00h,18h
+			db	24h,c3h,e7h,7ch,41h,3fh,80h,0eh
+			db	f5h,48h,8ch,f2h,b3h,43h,14h,0fh
+			db	65h,c7h,66h,aeh,aeh,edh,8fh,14h
+			db	e3h,d9h,1ah,56h,24h,24h,e5h,37h
+			db	97h,2fh,b9h,bbh,d3h,7bh,8ah,f9h
+			db	43h,72h,13h,c0h,3fh,d6h,89h,3ch
+			db	afh,1eh,26h,4fh,58h,06h,42h,b7h
+			db	e1h,82h,00h,89h,24h,dbh,fch,34h
+			db	3eh,e5h,e0h,42h,65h,d5h,e7h,4eh
+			db	9fh,9eh,58h,bah,73h,1eh,25h,7ah
+			db	39h,c4h,56h,ach,37h,1ch,b0h,41h
+			db	a5h,66h,35h,c0h,99h,ddh,88h,28h
+			db	3eh,d2h,2eh,5dh,14h,50h,beh,44h
+			db	edh,1ch,3ah,7ch,91h,55h,8ch,63h
+			db	31h,06h,70h,eeh,beh,49h,2dh,9ch
+			db	6dh,9ch,1dh,0dh,43h,74h,e9h,3dh
+			db	25h,98h,b7h,1eh,91h,6ch,a2h,89h
+			db	69h,6dh,4dh,aeh,80h,ech,e4h,05h
+			db	9fh,a3h,95h,9fh,28h,f8h,53h,b9h
+			db	b6h,bdh,44h,3ch,b5h
+			ret	c
+			ld	a,d
+			add	hl,sp
+			sbc	a,b
+			xor	d
+			adc	a,e
+			ld	b,l
+			ld	bc,7b8bh
+			or	l
+			rst	30h
+			dec	de
+			dec	h
+			sub	c
+			inc	(hl)
+			pop	af
+			cp	e
+			dec	de
+			ld	a,e
+			ld	a,h
+			adc	a,a
+			call	po,Led9f
+			ld	(hl),d
+			sbc	a,e
+			sbc	a,b
+			ld	(hl),e
+			ret	z
+			pop	de
+			adc	a,c
+			ret
+			db	3dh,2ch,57h,d3h,3fh,6ch,5ah,6dh
+			db	2dh,7ah,0bh,e7h
+			ei
+			halt
+			rst	00h
+			rlca
+			adc	a,c
+			ld	e,b
+			jp	pe,L4163
+			ld	b,c
+			ld	d,d
+			dec	h
+			and	b
+			scf
+			cp	b
+			cp	a
+			adc	a,25h
+			jp	Lfc0e
+			add	hl,de
+			cp	9dh
+			ld	c,e
+			ld	h,d
+			adc	a,(hl)
+			cp	l
+			call	c,Lff21
+			pop	hl
+			ld	a,cbh
+			rra
+			ld	c,c
+			sub	dfh
+			call	m,L8650
+			dec	e
+			ld	l,24h
+			call	nc,L5cb8
+			inc	de
+			ld	(hl),a
+			jp	L7d00
+			db	6eh,ffh,c1h,d7h,58h,36h
+			inc	e
+			inc	e
+			ld	a,c
+			and	65h
+			ld	c,a0h
+			and	61h
+			inc	b
+			rst	08h
+			sbc	a,34h
+			ret	m
+			ld	d,a
+			ld	c,h
+			ld	l,c
+			ld	c,h
+			ld	sp,116ch
+			ld	(hl),b
+			cp	h
+			adc	a,(hl)
+			bit	6,a
+			ld	b,(hl)
+			add	hl,de
+			ld	d,c
+			jr	L826c
+			db	7bh,b0h,1ch
+			ld	l,(hl)
+			adc	a,c
+			ld	d,(hl)
+			ld	e,e
+			or	b
+			ld	d,e
+			ld	sp,54d3h
+			jr	nc,L82a3
+			ld	b,a
+			djnz	L828d
+			add	a,h
+			call	nz,Le6eb
+			ret	m
+			jp	nc,L8779
+			ld	e,c
+			sub	e
+			ld	a,(bc)
+			ccf
+			ld	e,d
+			ld	b,b
+			sbc	a,l
+			ld	c,bch
+			di
+			add	hl,de
+			xor	d
+			ld	d,e
+			ld	h,l
+			rst	20h
+			rst	18h
+			jr	z,L8368
+			add	a,b
+			ld	(9908h),hl
+			inc	de
+			ld	a,l
+			ld	(hl),h
+			push	de
+			rst	10h
+			ld	h,a
+			cpl
+			rst	28h
+			ld	l,a
+			ld	e,c4h
+			cpl
+			call	nz,Laa1a
+			ld	l,b
+			push	af
+			ld	(hl),h
+			ret
+			db	a0h,56h,d7h,e5h,25h,70h,6ch,6bh
+			db	1dh,eah,6ah,29h,21h,c0h,dch,dah
+			db	d6h,7bh,76h,0bh,2dh,2dh,e2h,81h
+			db	71h,8dh,cdh,abh,7ch,f8h,f1h,dfh
+			db	6dh,8fh,ddh,34h,b6h,3ch,23h,4eh
+			db	1dh,c4h,31h,94h,6eh,2ch,55h,a8h
+			db	efh,afh,e1h,94h,20h,2eh,4fh,ebh
+			db	d9h,0eh,64h,7dh,f2h,78h,68h,77h
+			db	71h,89h,d1h,f6h,32h,5ch,eeh
+			ld	h,l
+			xor	c
+			ld	(de),a
+			ld	hl,f4d6h
+			inc	c
+			call	L660a
+			call	p,L6455
+			push	hl
+			ret	m
+			ld	d,l
+			rst	08h
+			ld	(hl),c
+			ld	l,d
+			or	d
+			ex	de,hl
+			inc	a
+			ld	d,a
+			ld	l,l
+			ld	d,l
+			pop	bc
+			ld	(bc),a
+			ret	z
+			ld	l,a
+			ld	de,a325h
+			nop (2x) *
+			ld	c,e
+			nop (2x) *
+			call	nc,L8123
+			ld	h,l
+			rst	08h
+			ld	c,a
+			cp	bch
+			cp	(hl)
+			ld	l,c
+			call	p,Lb6e3
+			adc	a,a
+			ld	bc,bbb3h
+			add	a,ixh *
+			jp	z,Ld1ac
+			ld	h,h
+			sbc	a,l
+			dec	c
+			ld	b,h
+			ld	hl,(b627h)
+			inc	sp
+			ld	l,c
+			call	nz,Ld3d5
+			ld	d,d
+			ret	nc
+			ld	l,72h
+			add	a,d
+			adc	a,d
+			dec	bc
+			ret	pe
+			add	hl,sp
+			ex	(sp),hl
+			call	nc,L2485
+			rla
+			ex	af,af'
+			xor	(hl)
+			sub	c9h
+			inc	d
+			ld	l,e
+			jp	nz,L7d79
+			ret	z
+			ld	l,l
+			ld	l,d
+			sbc	a,(hl)
+			di
+			ret	nc
+			inc	d
+			and	a
+			adc	a,h
+			ld	b,d
+			jr	L8402
+			db	fch,d7h,d5h,72h,46h,9bh,3dh,f3h
+			db	34h,59h,27h,d3h,c1h,83h,86h,02h
+			db	d0h,38h,37h,99h,b1h,97h,75h,aeh
+			db	62h,c7h,5fh,68h,48h,96h,29h,6bh
+			db	43h,e2h,9eh,f7h,14h,2eh,01h,42h
+			db	60h,24h,58h,10h,ech,d1h,07h,34h
+			db	38h,25h,eah,cch,46h,33h,09h,47h
+			db	5ch,67h,4dh,07h,c0h,f4h,63h,36h
+			db	43h,2ah,2ah,e9h,bdh,54h,2ch,a2h
+			db	8fh,b9h,2fh,35h,47h,7ch
+			ld	(3ef3h),hl
+			ld	c,(hl)
+			add	a,c
+			and	b
+			ld	c,d
+			ld	h,e
+			ld	(6452h),hl
+			dec	(hl)
+			add	hl,hl
+			ld	(hl),a
+			ld	h,l
+			ld	b,l
+			ld	c,(hl)
+			ld	e,e
+			nop (2x) *
+			add	a,h
+			adc	a,h
+			rst	28h
+			ld	c,b
+			and	a
+			adc	a,e
+			cp	h
+			sub	a
+			sub	(hl)
+			sub	c
+			ld	e,e
+			rst	38h
+			ld	a,(bc)
+			xor	h
+			ld	l,(hl)
+			nop (2x) *
+			jr	c,L846c
+			sub	(hl)
+			dec	l
+			xor	01h
+			ld	b,h
+			xor	d
+			add	a,a
+			add	a,c
+			call	m,Lc07f
+			ld	(hl),h
+			xor	(hl)
+			inc	c
+			cp	l
+			ret
+			db	bdh,9dh,7fh,34h
+			ld	e,c
+			ld	sp,hl
+			xor	b
+			call	pe,Ldb82
+			ld	e,a
+			jp	pe,Lac36
+			ld	h,e
+			nop (2x) *
+			call	p,L9fde
+			add	a,d
+			xor	l
+			ld	e,(hl)
+			ld	d,d
+			ld	l,d
+			ret	z
+			ld	h,a
+			ld	(hl),h
+			ld	l,0ch
+			add	hl,bc
+			ld	e,h
+			ret	p
+			set	3,e
+			ld	c,e
+			ex	de,hl
+			ld	c,98h
+			sub	l
+			ex	(sp),hl
+			inc	d
+			and	(hl)
+			push	hl
+			sub	l
+			ld	e,a4h
+			adc	a,e
+			ret	nz
+			ld	h,(hl)
+			ld	d,e
+			ld	h,l
+			and	e
+			inc	bc
+			inc	hl
+			ld	d,a
+			call	Lae3f
+			jr	c,L8460
+			sub	a
+			ld	d,a
+			xor	(hl)
+			ld	d,a
+			ld	(L8da2),hl
+			or	h
+			sub	(hl)
+			rst	30h
+			ret	z
+			sub	c
+			rst	30h
+			or	l
+			sub	l
+			jr	c,L8487
+			jr	L84eb
+			push	af
+			ret	m
+			ld	(hl),05h
+			jp	nz,L4ce8
+			rst	08h
+			adc	a,d
+			call	c,L3a28
+			dec	e
+			ld	l,h
+			cp	h
+			ld	h,(hl)
+			ld	ixl,e *
+			ld	c,h
+			ld	l,d
+			jp	po,Lc576
+			ld	b,b
+			inc	a
+			ld	a,c
+			ld	e,e
+			inc	(hl)
+			and	e
+			ld	a,2bh
+			jr	L8437
+			db	4dh,53h,15h,cch,24h,94h,5ah,f8h
+			db	5fh,f5h,e0h,3ah,33h
+			or	h
+			sub	e
+			or	h
+			ld	e,h
+			jr	nz,L843c
+			ld	h,h
+			rst	38h
+			ld	d,(hl)
+			dec	sp
+			add	hl,bc
+			dec	de
+			and	d
+			ret	c
+			jp	c,Lb133
+			cp	l
+			ld	e,0eh
+			jr	nc,L8499
+			ld	c,e
+			ld	b,a
+			rrca
+			xor	l
+			or	e
+			or	c
+			adc	a,6bh
+			add	a,h
+			inc	(hl)
+			ld	h,d
+			ld	c,a
+			or	b
+			ld	b,l
+			ld	hl,1c33h
+			jr	c,L84b5
+			ld	(b16dh),hl
+			add	hl,bc
+			sub	e
+			rra
+			sbc	a,9ah
+			and	h
+			inc	h
+			ld	(hl),b
+			cp	c
+			sbc	a,h
+			sub	l
+			ld	(hl),h
+			ld	b,c
+			adc	a,e
+			adc	a,(hl)
+			sub	d
+			rlca
+			or	h
+			and	h
+			or	d
+			inc	hl
+			ld	b,l
+			ld	e,l
+			or	85h
+			call	pe,Lc489
+			add	a,h
+			ld	e,d
+			ret	po
+			jp	(hl)
+			db	9fh,68h,eah,d2h,ech,2fh,e6h,25h
+			db	6ah,b8h,abh,97h,a7h,1ch
+			ld	d,3dh
+			ret	p
+			djnz	L857f
+			or	l
+			ld	l,c
+			jr	c,L8530
+			sub	e
+			ex	de,hl
+			pop	hl
+			ret	m
+			xor	e
+			add	a,l
+			push	bc
+			ld	de,cc60h
+			ld	(hl),l
+			cp	h
+			ld	b,79h
+			adc	a,e
+			jr	nz,L855e
+			ld	h,e
+			sub	c
+			add	a,a
+			rst	38h
+			ld	a,c
+			ld	(hl),l
+			call	m,Lab33
+			or	l
+			ld	(hl),d
+			push	af
+			rst	18h
+			or	h
+			ld	c,e
+			ret	m
+			jp	pe,Lb9bc
+			ld	de,b47dh
+			add	hl,de
+			ccf
+			dec	d
+			or	l
+			ld	d,a
+			or	e2h
+			exx
+			dec	d
+			jp	nc,L842e
+			jr	nc,L85bb
+			rlca
+			jr	nz,L850f
+			jp	p,Lc161
+			ld	a,c
+			ei
+			and	a
+			exx
+			ld	l,e
+			and	e
+			add	a,l
+			add	a,c
+			sbc	a,b
+			ld	c,d
+			jp	L4707
+			db	63h,53h,d4h,dbh,e5h,82h,5ah,0fh
+			db	4fh,afh,c8h,90h,c9h,2dh,34h,f0h
+			db	fch
+			cp	d
+			dec	hl
+			ex	(sp),hl
+			ld	e,h
+			and	d
+			ld	h,d
+			cp	dfh
+			dec	de
+			ret	p
+			ld	b,b
+			call	z,L1eda
+			ld	a,c
+			ld	l,a
+			or	c
+			or	c
+			ret	pe
+			sub	a
+			dec	a
+			rst	28h
+			or	9eh
+			ld	c,b
+			ld	sp,hl
+			jp	L0f18
+			db	40h,41h,5ah,17h,34h,20h,1eh,08h
+			db	1ah,0ah,dbh,04h,6ah,e1h,8ch,47h
+			db	dch,70h,17h,77h,0dh,6eh,3ah,36h
+			db	c0h,15h,cch,ech,a7h,8eh,e3h,40h
+			db	74h,6ah,2bh,ach,63h,49h,cfh,56h
+			db	d5h,72h,c3h,b7h,32h
+			ld	e,17h
+			push	bc
+			ld	c,l
+			add	hl,bc
+			xor	l
+			cp	a
+			ld	(43bdh),hl
+			rst	10h
+			ld	b,l
+			and	(hl)
+			cp	c
+			ld	sp,6e45h
+			rst	30h
+			ld	d,a
+			add	a,b
+			inc	a
+			ld	d,(hl)
+			in	a,(89h)
+			ld	h,b
+			ld	c,d
+			xor	l
+			inc	de
+			ld	(hl),a
+			cp	3ch
+			and	c
+			inc	(hl)
+			ld	h,24h
+			dec	(hl)
+			inc	d
+			ld	a,(bc)
+			sbc	a,a5h
+			and	e
+			ex	af,af'
+			sbc	a,d
+			and	l
+			add	a,a
+			ld	d,ixl *
+			ei
+			ld	e,l
+			cp	h
+			ld	h,31h
+			rla
+			ld	e,e
+			pop	af
+			ld	e,(hl)
+			ld	b,l
+			pop	af
+			call	pe,Lb9a6
+			ld	e,a
+			and	l
+			ld	sp,hl
+			ld	b,a
+			dec	sp
+			ld	hl,(8b65h)
+			ld	(4dd1h),hl
+			ld	(de),a
+			add	a,a
+			ld	h,b
+			ld	h,b
+			nop (2x) *
+			rst	20h
+			ld	b,d
+			dec	e
+			ld	a,e
+			sub	9dh
+			or	d
+			ld	l,eeh
+			ld	a,a
+			jr	c,L85e1
+			call	c,L7e33
+			xor	d
+			ld	l,b
+			call	nz,L1e34
+			call	nc,L1b8e
+			ld	d,0bh
+			jp	po,L78a0
+			adc	a,e
+			or	l
+			and	b
+			ld	d,(hl)
+			ld	b,l
+			cpl
+			call	nc,La9cb
+			ld	a,l
+			jr	z,L85d4
+			or	95h
+			inc	l
+			inc	de
+			rra
+			ld	a,l
+			and	(hl)
+			sub	e
+			ld	l,d
+			call	Ld265
+			pop	bc
+			add	a,0dh
+			add	hl,de
+			and	d
+			add	hl,bc
+			or	cbh
+			cp	c
+			rst	00h
+			ld	b,36h
+			rst	30h
+			ld	e,b
+			ld	c,h
+			add	a,e
+			ld	(bc),a
+			call	pe,Lee76
+			ld	d,c
+			sub	e
+			call	po,L41ab
+			ld	d,dfh
+			ld	c,a
+			xor	e
+			ld	(bc),a
+			dec	l
+			jp	(hl)
+			db	f7h,3dh,39h,b2h,91h,e5h,27h,73h
+			db	76h,6ch,48h,8ah,5dh,1bh,f4h,4dh
+			db	7dh,49h,50h,ddh,25h,9fh,3dh,d6h
+			db	8eh,52h,40h,d8h,71h,32h,62h,69h
+			db	31h,f9h,04h,6eh,78h,7fh,ceh,0ch
+			db	cfh,7fh,78h,95h,39h,ceh,65h,26h
+			db	62h,c1h,9ch,10h,13h,29h,38h,59h
+			db	ach,31h,aeh,b2h,25h,25h,e4h,30h
+			db	fch,88h,57h,86h,07h,f9h,18h,09h
+			db	5eh,6eh,2dh,1ah,10h,14h,beh,d8h
+			db	63h,6ah,6fh,05h,aeh,e1h,eeh,3fh
+			db	4fh,b0h,adh,9fh,d6h,7ah,34h,4dh
+			db	63h,05h,60h
+			xor	d
+			ld	(hl),b
+			adc	a,a
+			add	hl,de
+			ld	c,a
+			adc	a,l
+			dec	de
+			ld	d,d
+			ld	h,a
+			ld	l,b
+			ld	(23dfh),hl
+			inc	l
+			ld	l,c
+			ld	(e26dh),hl
+			jp	p,L9065
+			jp	c,Lbc31
+			ld	a,(9c64h)
+			ld	a,l
+			ld	d,55h
+			add	a,c
+			add	hl,hl
+			ld	d,c
+			dec	a
+			ld	l,a
+			adc	a,b
+			adc	a,a
+			xor	(hl)
+			ld	(hl),l
+			dec	h
+			cp	a
+			sub	e
+			inc	a
+			jr	nc,L8724
+			jr	nz,L86bf
+			cp	h
+			rst	10h
+			ld	(hl),h
+			ld	(hl),h
+			jp	nc,L3d2e
+			ld	e,d
+			ld	e,l
+			sub	h
+			ld	l,c
+			ld	(de),a
+			push	bc
+			ld	d,d
+			ld	l,60h
+			ld	(de),a
+			call	c,Lb6d9
+			ld	c,b
+			ret	m
+			out	(d6h),a
+			inc	e
+			ld	b,(hl)
+			rra
+			ld	e,l
+			and	e
+			ld	(a2a7h),hl
+			ld	(hl),d
+			ld	c,l
+			ld	l,l
+			jr	c,L86ff
+			dec	(hl)
+			dec	ixl *
+			or	cdh
+			adc	a,e
+			call	po,L84be
+			ld	l,h
+			call	m,L18e8
+			ld	a,d
+			ld	(hl),d2h
+			jp	z,Lb95f
+			or	c
+			ld	(hl),b
+			jr	L86e0
+			db	a1h,a0h,4ah,9ch,59h,f3h,0fh,8fh
+			db	abh,69h,4ah,3bh,5fh,f8h,d6h,79h
+			db	dbh,c5h,11h,c7h,0ah,d7h,7dh,3dh
+			db	1ch,9eh,6ch,cbh,03h,9ah,72h,b6h
+			db	3bh,0ch,3fh,e5h,a5h,cfh,18h,4ah
+			db	0eh,31h,90h,f2h,9dh,b8h,29h,b0h
+			db	8ah,1fh,91h,3ch,2eh,c7h,b1h,a5h
+			db	02h,f2h,2ch,a7h,0eh,f1h,26h,83h
+			db	a7h,c2h,bfh,ech,97h,6eh,7ch,2ah
+			db	7eh,7fh,71h,71h,9ah,2ah,b9h
+			adc	a,10h
+			ld	d,l
+			add	a,l
+			add	iy,sp
+			rst	20h
+			cp	e3h
+			add	hl,sp
+			adc	a,e
+			jp	nz,Lb0c7
+			ld	sp,3ea0h
+			ld	d,c
+			jr	nc,L87f2
+			ld	a,(a9cah)
+			ld	(hl),l
+			ld	l,c
+			ccf
+			push	af
+			ld	(de),a
+			ld	h,d
+			add	a,f1h
+			xor	l
+			rla
+			ld	h,c
+			jp	nz,Ld85b
+			call	L6420
+			cp	(hl)
+			sbc	a,d
+			rrca
+			cp	h
+			call	c,L6fcc
+			ld	b,(hl)
+			jp	nc,L78a5
+			ei
+			ld	l,l
+			in	a,(a0h)
+			ld	h,l
+			or	2bh
+			ld	e,b
+			inir
+			adc	a,(hl)
+			ld	(hl),a
+			rlca
+			ld	h,h
+			sbc	a,d
+			and	d
+			jr	L87a0
+			db	38h,27h,30h,83h,03h,c5h,84h,fch
+			db	9ah,67h,43h,c8h,ach,8bh,2ah,bbh
+			db	55h,d1h,8dh,3eh,68h,27h,15h,59h
+			db	e4h,c5h,05h,e3h,f1h,eah,7ah,66h
+			db	69h,42h,6ch,68h,06h,95h,58h,1dh
+			db	44h,63h,c6h,2eh,54h,bdh,b1h,6eh
+			db	c0h,41h,72h,55h
+			ret	po
+			ld	a,c
+			ld	(hl),a
+			ld	l,d
+			add	hl,bc
+			sbc	a,b
+			ld	(6a2fh),a
+			ld	e,a
+			ccf
+			ld	a,h
+			ret	po
+			inc	de
+			dec	bc
+			sbc	a,c8h
+			rst	28h
+			sbc	a,h
+			sbc	a,e
+			ld	e,c
+			adc	a,l
+			adc	a,e
+			sub	84h
+			add	hl,de
+			rst	28h
+			in	c,(c)
+			rra
+			sbc	a,b
+			ld	d,b
+			ld	(bc),a
+			ld	e,bbh
+			ld	e,e
+			and	e5h
+			ld	b,d
+			sbc	a,b
+			add	a,(hl)
+			sub	h
+			ld	b,c
+			ld	a,b
+			exx
+			cp	29h
+			ld	c,d
+			ld	(hl),e
+			in	a,(4ah)
+			exx
+			add	a,d
+			ld	d,a
+			jp	nz,L2679
+			ld	h,(hl)
+			or	h
+			ld	b,b
+			inc	a
+			ld	d,e
+			ld	c,e
+			adc	a,l
+			ld	c,f0h
+			adc	a,h
+			ld	(bc),a
+			ld	b,d
+			inc	de
+			ld	a,h
+			rst	10h
+			cp	l
+			ld	d,h
+			ld	a,(bc)
+			push	af
+			ld	e,l
+			dec	a
+			add	a,h
+			pop	bc
+			rst	08h
+			rst	30h
+			ld	l,d
+			ret	c
+			ld	e,b
+			and	e
+			pop	af
+			dec	de
+			rla
+			ld	h,6ch
+			halt
+			cp	bch
+			dec	h
+			ret	nz
+			sub	e
+			ex	af,af'
+			ld	c,e
+			ret	po
+			add	a,d
+			sbc	a,b
+			jr	nc,L889b
+			call	nc,L3a98
+			ld	e,a
+			ld	(hl),e
+			rrca
+			add	a,h
+			ld	a,d
+			jp	pe,L9edc
+			inc	b
+			ld	c,a
+			call	p,L0bab
+			jp	(hl)
+			db	82h,2dh,32h,cch,a1h,25h,4ah,d8h
+			db	86h,3dh,38h,a5h,f6h,6ah,56h,7ch
+			db	6fh,fch,c2h,e9h,f3h,fah,f7h,43h
+			db	00h,cfh,77h,dfh,b2h,38h,cfh
+			jr	c,L8895
+			ld	h,(hl)
+			push	de
+			ld	c,l
+			dec	e
+			or	l
+			adc	a,d
+			ld	c,56h
+			ld	l,c
+			sub	h
+			xor	c
+			call	nz,L6bcc
+			out	(44h),a
+			add	a,d
+			ld	h,(hl)
+			add	a,a
+			adc	a,3bh
+			cp	e
+			xor	(hl)
+			ld	l,a
+			ret
+			db	30h,dbh,08h,f5h,d2h,0eh,0eh,41h
+			db	b1h,69h,0bh,d7h,c0h,ech,b6h,92h
+			db	38h,d0h,1bh,35h,e0h,bah,8ah,b5h
+			and	l
+			add	hl,hl
+			adc	a,l
+			ret	pe
+			adc	a,d2h
+			ld	b,h
+			jp	z,L7973
+			ld	c,h
+			call	L317d
+			ld	(hl),e
+			inc	e
+			call	c,L8d5d
+			sbc	a,e
+			and	e
+			and	a
+			ld	(8a0dh),hl
+			ret	pe
+			jp	nc,L678d
+			ld	b,2fh
+			ld	(L6f4e),a
+			dec	b
+			ld	(hl),l
+			push	bc
+			pop	de
+			ld	(hl),9eh
+			ld	(hl),c
+			add	hl,sp
+			inc	(hl)
+			sbc	a,(hl)
+			nop (2x) *
+			push	af
+			cp	c3h
+			ld	e,(hl)
+			sbc	a,e
+			ld	e,c
+			call	m,L2e40
+			call	nz,L9ec3
+			dec	(hl)
+			ld	b,(hl)
+			adc	a,d
+			ld	a,(d7b3h)
+			jp	nc,L4329
+			dec	e
+			ld	a,c
+			add	a,c
+			rst	10h
+			dec	c
+			xor	e
+			ld	a,b
+			add	hl,de
+			add	a,a
+			ld	a,d
+			ld	e,(hl)
+			nop (2x) *
+			pop	de
+			ld	e,91h
+			rst	38h
+			inc	l
+			jp	L4684
+			db	6ch,7ah,9bh,d0h,bfh,dah,15h,06h
+			db	a5h,f4h,67h,8bh,84h,90h,ceh,12h
+			db	00h,bdh,cbh,fdh,8fh,e7h,afh,14h
+			jr	nz,L88bd
+			rst	18h
+			ex	de,hl
+			ld	c,(hl)
+			ld	d,l
+			and	h
+			jp	m,L7f37
+			inc	h
+			ld	(f7dch),hl
+			rst	28h
+			jr	nc,L88f4
+			or	c
+			ld	c,e
+			jp	p,L4973
+			and	01h
+			inc	(hl)
+			ld	c,a
+			nop (2x) *
+			rst	08h
+			ld	c,l
+			xor	h
+			di
+			ld	h,h
+			xor	l
+			rrca
+			jr	L898b
+			db	54h,b8h,00h,4dh,0ah,6dh,63h,0fh
+			db	0fh,d5h,e4h,a6h,5dh,8ah,37h,f6h
+			db	29h,8fh,3ah,16h,5dh,1eh,40h,34h
+			db	4fh,51h,90h,6dh,b2h,e3h,92h,aeh
+			db	0ah,ebh
+			ld	h,a
+			push	hl
+			push	af
+			sub	b
+			ld	(hl),l
+			xor	l
+			or	(hl)
+			ld	l,1eh
+			inc	e
+			ld	c,l
+			sbc	a,c
+			ld	(bc),a
+			sub	(hl)
+			ld	(hl),fah
+			rst	38h
+			ld	h,l
+			halt
+			or	b
+			call	pe,Lbc26
+			set	4,b
+			add	a,l
+			ld	e,c
+			ld	c,h
+			in	a,(55h)
+			ld	a,c
+			nop (2x) *
+			ld	l,l
+			sbc	a,h
+			ld	(hl),a
+			nop
+			sbc	a,d
+			ld	hl,65f6h
+			ld	d,a
+			ex	af,af'
+			xor	b9h
+			dec	(hl)
+			or	b
+			and	b
+			xor	l
+			jr	nc,L89a7
+			halt
+			ld	a,(da42h)
+			dec	b
+			xor	a0h
+			rst	08h
+			djnz	L8972
+			ld	(hl),h
+			cp	b
+			sbc	a,l
+			ld	a,(bc)
+			inc	e
+			or	c
+			jp	(hl)
+			db	8dh,3ah,19h,63h,2fh,1fh,17h,9fh
+			db	04h,c2h,7bh,4ah
+			ld	e,d
+			and	a
+			ld	b,c
+			ld	c,a
+			ld	hl,(d75fh)
+			cp	12h
+			call	nc,L189d
+			ld	(hl),c
+			ld	d,a
+			ld	a,35h
+			or	c
+			ld	h,b
+			ld	a,e
+			add	hl,sp
+			call	c,Lde52
+			or	b
+			ld	c,c
+			xor	a
+			push	hl
+			dec	sp
+			ex	af,af'
+			ex	de,hl
+			ld	b,a
+			ld	c,c
+			ld	e,l
+			dec	hl
+			call	La610
+			adc	a,a
+			call	c,L9a22
+			ld	(3fc5h),a
+			ld	a,h
+			ld	l,(hl)
+			ld	h,l
+			nop (2x) *
+			ld	e,b
+			dec	d
+			xor	l
+			ld	e,e
+			sub	(hl)
+			dec	hl
+			cp	e
+			ld	c,a
+			ld	e,(hl)
+			jp	p,Lb462
+			jp	pe,L2a29
+			jr	L89a3
+			db	5fh,33h,cfh,6bh,f5h,d4h,75h,40h
+			db	6ch,4ch,e2h,e0h,40h,c3h,d5h,c7h
+			db	f2h,21h,8dh,12h,a7h,29h,3ah
+			dec	(hl)
+			pop	de
+			ld	l,c
+			ld	l,b
+			rst	28h
+			pop	hl
+			add	hl,sp
+			ld	d,(hl)
+			ld	(hl),e1h
+			dec	sp
+			jp	p,L4288
+			jp	(hl)
+			db	e6h,b9h,c8h,02h,adh,67h,34h,d0h
+			db	9ch,d1h,6eh
+			ret	c
+			djnz	L8a58
+			xor	(hl)
+			ex	(sp),hl
+			ld	c,d
+			adc	a,b
+			sub	a
+			jp	m,L492c
+			ld	a,c
+			sub	d
+			ret	p
+			call	po,Lbc02
+			inc	hl
+			add	a,h
+			sbc	a,(hl)
+			ld	a,(de)
+			pop	hl
+			ld	b,e
+			nop (2x) *
+			rst	30h
+			djnz	L8a1a
+			ld	h,c
+			cp	l
+			cp	a
+			ld	a,b
+			ex	af,af'
+			ld	b,h
+			cp	b
+			rst	08h
+			cp	d
+			ld	e,h
+			ld	sp,f6deh
+			inc	(hl)
+			sbc	a,a
+			ret	m
+			ld	e,(hl)
+			jp	c,L1784
+			ld	d,b
+			cpl
+			ld	e,62h
+			add	a,l
+			call	po,L62ce
+			ret	c
+			add	a,e
+			ret	z
+			ld	h,b
+			ld	a,d
+			halt
+			and	(hl)
+			ld	b,d
+			ld	e,a
+			ld	a,e
+			inc	bc
+			ld	a,eah
+			ld	a,c
+			sub	59h
+			ld	e,b
+			jp	m,Lb783
+			ld	e,h
+			ld	(hl),c
+			ld	l,e
+			sbc	a,b0h
+			ld	e,b
+			call	po,L03a1
+			rlca
+			sub	(hl)
+			sub	e
+			exx
+			di
+			scf
+			add	a,d
+			and	l
+			ld	h,l
+			dec	de
+			ld	l,a
+			ld	e,d
+			sub	98h
+			ld	(de),a
+			djnz	L8af2
+			ld	(hl),a
+			inc	l
+			ld	a,a
+			inc	h
+			adc	a,d
+			scf
+			or	b
+			daa
+			ret
+			db	fdh,e3h,adh,8ah,d1h,35h,d4h,f0h
+			db	9dh,e5h,61h,6bh,aah,24h,d0h,5eh
+			db	90h,a9h,42h,1ch,2bh,0bh,39h,b3h
+			db	71h,49h,d0h,edh,58h,52h,e5h,fah
+			db	7eh,cbh,adh,cch,3ah,fch,07h,abh
+			db	67h,c6h,34h,0fh,65h,46h,f1h,57h
+			db	f8h,b6h,1ah,85h,96h,1eh,89h,3ah
+			db	83h
+			dec	l
+			ld	a,(71d0h)
+			xor	a
+			adc	a,9fh
+			call	m,L7380
+			ld	b,(hl)
+			rst	28h
+			ld	l,l
+			dec	(hl)
+			jr	c,L8b61
+			push	hl
+			adc	a,a
+			in	a,(c4h)
+			rra
+			or	a
+			adc	a,h
+			dec	d
+			rlca
+			ret	nz
+			call	c,L6f4e
+			ld	e,c
+			ld	(hl),a
+			or	a
+			ld	sp,hl
+			rrca
+			inc	a
+			sub	c5h
+			sbc	a,c
+			add	a,d
+			ld	c,a
+			sub	h
+			and	h
+			ld	h,8fh
+			jp	p,L69e3
+			ld	a,d
+			xor	l
+			and	d
+			ld	(db5dh),hl
+			cp	(hl)
+			xor	h
+			ld	e,e
+			jp	L88ff
+			db	f4h,71h,99h,2dh,e3h,9eh,ech,7ch
+			db	9ch,d8h,56h,ddh,f1h,2fh,8eh,b6h
+			db	79h,c5h,2bh,cdh,15h,2eh,80h,12h
+			db	e2h,26h,09h,42h
+			xor	92h
+			ld	l,h
+			ld	b,b
+			inc	(hl)
+			cp	d
+			ld	de,bab3h
+			ld	h,l
+			ld	c,h
+			call	m,L4229
+			adc	a,h
+			nop (2x) *
+			ld	(bc),a
+			ret
+			db	f5h,deh,0eh,27h,85h,5ah,83h,d5h
+			db	03h,c6h,f4h,c7h,d0h
+			ld	(hl),h
+			jr	nz,L8adc
+			sbc	a,c
+			cp	e
+			sbc	a,e
+			ld	h,b
+			ld	e,e
+			ld	c,b1h
+			ld	sp,hl
+			ld	h,(hl)
+			rst	20h
+			inc	hl
+			in	a,(11h)
+			adc	a,l
+			dec	e
+			daa
+			ld	hl,(ba11h)
+			ld	c,(hl)
+			rst	30h
+			ld	a,e
+			ld	d,b
+			ld	c,a
+			jp	c,Lb6ac
+			dec	a
+			ld	d,e
+			ld	l,a
+			sbc	a,(hl)
+			djnz	L8b52
+			call	po,L6da8
+			sub	(hl)
+			add	a,e
+			and	c
+			jr	c,L8bb9
+			push	hl
+			jp	p,L9fa2
+			ld	d,l
+			ld	h,d
+			cpl
+			pop	hl
+			ld	l,c
+			xor	a
+			sub	a
+			rst	10h
+			ld	c,b
+			jp	pe,Lc792
+			add	a,a
+			call	z,L0338
+			and	d
+			sbc	a,d
+			ld	c,b
+			jr	L8b63
+			db	82h,12h,57h,71h,99h,bfh,b2h,74h
+			db	bbh,aah,ddh,0fh,a3h,39h,98h,aah
+			db	58h,01h,6ah,9ah,25h,50h,4eh,12h
+			db	efh,b1h,04h,18h,36h,75h,03h,a4h
+			db	13h,fah
+			add	hl,sp
+			ld	b,(hl)
+			ld	a,a
+			ld	h,a
+			ld	e,(hl)
+			sub	d
+			ld	hl,(de50h)
+			sub	a
+			ret
+			db	a5h,fbh,d1h,aah,54h,bch,d7h,45h
+			db	63h,48h,69h,a4h,44h,adh,8dh,6ah
+			db	95h,a4h,47h,01h,cah,a1h,02h,24h
+			db	afh,71h,aeh,54h,e8h,7eh,74h,79h
+			db	f9h,15h,38h,b0h,5eh,45h
+			inc	bc
+			ld	(hl),06h
+			pop	hl
+			ld	l,h
+			ld	h,h
+			daa
+			and	a
+			ld	(de),a
+			ld	c,e
+			nop (2x) *
+			or	e
+			dec	hl
+			rst	38h
+			dec	a
+			cp	d
+			sub	c
+			inc	c
+			ld	l,(hl)
+			ld	a,l
+			and	e
+			jr	L8b84
+			db	85h
+			ld	b,ech
+			jr	nz,L8bfb
+			ld	(hl),68h
+			ex	af,af'
+			ld	(hl),a
+			pop	de
+			xor	c
+			ld	hl,e5a4h
+			sbc	a,l
+			inc	hl
+			dec	de
+			jp	c,L4b95
+			ld	c,e
+			ld	h,e
+			ld	d,02h
+			ld	a,b
+			ld	b,d
+			halt
+			xor	(hl)
+			ld	d,c
+			pop	hl
+			inc	e
+			sub	d
+			ld	sp,f991h
+			ld	sp,44c5h
+			ld	(hl),d
+			or	d
+			ld	e,a
+			djnz	L8bea
+			ret	z
+			cp	d
+			call	m,L42dd
+			xor	5fh
+			dec	bc
+			xor	d
+			add	hl,hl
+			ld	h,d
+			ld	b,d
+			ld	a,l
+			ex	af,af'
+			xor	d
+			ld	b,d
+			ccf
+			ret	pe
+			rrca
+			ld	d,b6h
+			call	p,L2a54
+			ld	d,31h
+			ret	c
+			and	l
+			cp	c
+			ret	po
+			cpl
+			ld	b,e
+			or	c
+			adc	a,c
+			ld	d,d
+			sub	e
+			sub	a
+			call	c,Le722
+			sbc	a,48h
+			xor	d
+			ret	nc
+			ld	(hl),c
+			ld	hl,d016h
+			xor	h
+			rrca
+			rla
+			ld	h,b
+			inc	b
+			ld	a,(0412h)
+			ld	l,(hl)
+			halt
+			dec	bc
+			ld	c,l
+			ld	h,c
+			inc	a
+			ld	b,c
+			dec	c
+			ld	(de),a
+			jp	po,Lbb1c
+			ld	bc,872eh
+			inc	bc
+			dec	bc
+			ld	h,h
+			ld	d,b
+			add	a,d
+			ld	a,d
+			add	hl,bc
+			ret	po
+			and	b
+			ld	a,(dfa6h)
+			ld	(hl),l
+			cp	a
+			adc	a,97h
+			xor	e
+			adc	a,(hl)
+			call	p,Lb8cc
+			jp	po,Lf487
+			cp	(hl)
+			sub	49h
+			pop	hl
+			jr	z,L8ca7
+			add	a,(hl)
+			ld	l,l
+			ld	a,(hl)
+			ld	(8bf6h),hl
+			jp	p,Lb545
+			ld	b,b
+			call	nz,L08c2
+			or	e
+			jp	pe,L1577
+			ld	c,e
+			adc	a,h
+			add	a,a
+			ex	(sp),hl
+			nop (2x) *
+			rrca
+			ld	d,h
+			inc	sp
+			jr	nz,L8d26
+			ld	(bc),a
+			ld	c,91h
+			ld	c,l
+			ld	h,l
+			ld	d,l
+			dec	(hl)
+			xor	c
+			sub	e
+			rst	00h
+			ld	b,(hl)
+			inc	d
+			push	af
+			cp	a
+			sbc	a,e
+			add	hl,sp
+			or	a
+			adc	a,a
+			call	c,L61af
+			ld	h,b
+			ld	a,b
+			call	nc,L77a2
+			pop	af
+			and	c
+			inc	c
+			adc	a,a
+			rst	00h
+			rlca
+			ld	d,a4h
+			jr	L8cc0
+			db	98h,60h,40h,c2h,51h,f9h,cfh,60h
+			db	83h
+			ld	b,l
+			sub	cch
+			rra
+			ld	a,(hl)
+			add	a,l
+			xor	6fh
+			jr	nc,L8ce1
+			and	d
+			dec	(hl)
+			dec	bc
+			adc	a,e
+			ld	(de33h),hl
+			and	b
+			set	1,e
+			ld	h,c
+			ld	e,(hl)
+			and	(hl)
+			adc	a,c
+			sub	d
+			and	b
+			ei
+			and	(hl)
+			sbc	a,(hl)
+			and	a
+			sub	a
+			cp	b
+			rst	38h
+			pop	de
+			dec	b
+			dec	(hl)
+			ld	h,e
+			dec	e
+			sbc	a,d
+			jr	c,L8ca6
+			ld	(ad14h),hl
+			dec	c
+			inc	bc
+			sbc	a,bch
+			and	e
+			in	a,(3eh)
+			adc	a,(hl)
+			dec	c
+			scf
+			jp	Lf0f0
+			db	43h,d1h,3eh,55h,c0h,1fh,5dh,4ah
+			db	e7h,24h,81h,01h,2ah,04h,0dh,f7h
+			db	89h,4ch,98h,79h
+			ld	d,a
+			ld	b,(hl)
+			call	z,L4ca0
+			adc	a,a
+			xor	l
+			halt
+			call	po,L7c41
+			cp	f4h
+			ei
+			bit	2,(hl)
+			jp	pe,Le520
+			ld	bc,e45eh
+			ld	c,(hl)
+			push	af
+			or	a
+			cp	l
+			or	b
+			call	p,L5beb
+			add	hl,hl
+			dec	c
+			rst	20h
+			sub	c
+			xor	c
+			halt
+			ld	a,(bc)
+			ld	a,d
+			ld	(hl),h
+			adc	a,d
+			inc	bc
+			xor	d
+			jr	c,L8dc3
+			add	a,a
+			ld	e,h
+			sub	d
+			sbc	a,(hl)
+			dec	h
+			ld	l,c
+			ld	c,a
+			dec	e
+			inc	hl
+			pop	af
+			rlca
+			ldir
+			ld	a,d
+			add	a,d
+			rst	38h
+			adc	a,h
+			and	d
+			ld	l,c
+			ld	l,a
+			dec	bc
+			ld	(hl),a
+			push	af
+			jp	L396c
+			db	f1h,35h,fdh,32h,3bh,8fh,69h,1fh
+			db	2ah,d9h,91h,f4h,5eh,ech,dbh,18h
+			db	2ah,34h,1eh,17h,feh,e6h,28h,39h
+			db	44h,d2h,7ah,05h,1dh,e3h,69h,16h
+			db	ech,1dh,d5h,3bh,bbh,d1h,64h,13h
+			db	70h,bfh,73h,8dh,13h,c9h,85h,c1h
+			db	bdh,c3h
+			cp	e
+			di
+			or	aeh
+			call	L3de6
+			push	de
+			sub	b
+			sub	c
+			ld	b,e
+			or	d
+			add	hl,hl
+			jp	m,Lf6a8
+			xor	h
+			ld	sp,dd50h
+			ld	(hl),a2h
+			dec	de
+			ld	b,e
+			ld	h,h
+			cp	a
+			nop (2x) *
+			call	Lfa39
+			sbc	a,e
+			jr	c,L8d41
+			add	hl,sp
+			dec	e
+			ld	hl,1e94h
+			sbc	a,l
+			and	l
+			adc	a,l
+			ld	c,d
+			ld	c,h
+			in	a,(71h)
+			rst	30h
+			adc	a,e
+			add	a,(hl)
+			add	hl,hl
+			ld	h,a
+			dec	e
+			ld	c,e
+			ld	e,l
+			ld	a,(bc)
+			ld	b,l
+			add	a,d
+			ld	b,d
+			ld	a,(de)
+			ret	c
+			ld	b,d
+			sub	b
+			call	p,L0650
+			dec	e
+			ld	c,e
+			ex	af,af'
+			ld	a,(de)
+			ret	po
+			rrca
+			ld	d,b
+			ld	(hl),e
+			sbc	a,h
+			djnz	L8dc7
+			ld	d,(hl)
+			sub	8bh
+			inc	(hl)
+			ld	l,dch
+			ld	sp,d88eh
+			in	a,(16h)
+			ld	(hl),96h
+			ret	z
+			cp	e2h
+			or	l
+			in	a,(79h)
+			rrca
+			ld	d,l
+			inc	sp
+			or	l
+			cp	cch
+			and	h
+			ld	h,b
+			ret	c
+			dec	bc
+			rst	18h
+			add	a,b
+			ld	a,a
+			cp	a
+			dec	(hl)
+			ld	b,h
+			dec	bc
+			ld	h,21h
+			jp	L1798
+			db	c9h,72h,fdh,02h,42h,8dh,e0h,0dh
+			db	b3h,30h,e8h,9ah,adh,45h
+			ld	h,(hl)
+			xor	b
+			rlca
+			ld	a,(baf5h)
+			ld	de,b5cfh
+			ld	a,(bc)
+			adc	a,c
+			or	a
+			sbc	a,78h
+			ld	d,b
+			rst	08h
+			ld	d,b
+			push	de
+			dec	(hl)
+			add	hl,sp
+			ld	l,e
+			call	m,Lb273
+			ld	h,e
+			or	a
+			ld	(hl),h
+			cp	(hl)
+			rst	30h
+			ld	a,b3h
+			ld	a,(hl)
+			sub	(hl)
+			add	hl,de
+			ld	a,e
+			ld	d,10h
+			halt
+			ld	e,77h
+			dec	bc
+			or	e
+			ld	l,e
+			ld	b,h
+			or	d
+			ld	l,h
+			jp	L7287
+			db	e9h,80h,05h,86h,33h,0bh,c3h,eeh
+			db	d8h,79h,f7h,28h,1bh,b2h,7ah,c9h
+			db	62h,7dh,c1h,51h,9bh,73h,35h,92h
+			db	1ah,b0h,08h,01h,9ah,20h,c4h,71h
+			db	88h,7ah,b4h,8eh,8eh,10h,62h,0dh
+			db	deh,84h,42h,2fh
+			inc	e
+			ld	e,h
+			adc	a,e
+			ld	(de),a
+			sub	e
+			ld	(9721h),a
+			call	c,Lb6fc
+			or	a
+			ret	m
+			scf
+			sbc	a,(hl)
+			rlca
+			add	a,l
+			ld	(hl),d
+			ld	(1959h),hl
+			call	m,L2fe9
+			dec	h
+			push	hl
+			rst	28h
+			ld	l,d
+			sbc	a,h
+			jp	nz,L9d69
+			pop	bc
+			ld	l,e
+			call	c,Le061
+			rlca
+			or	l
+			adc	a,(hl)
+			ex	de,hl
+			ld	e,l
+			cpl
+			add	a,a
+			rst	30h
+			ld	e,b
+			rst	38h
+			pop	de
+			xor	6bh
+			ld	d,06h
+			sub	d
+			pop	de
+			ei
+			sub	(hl)
+			cp	b
+			ld	b,h
+			add	hl,hl
+			ret
+			db	24h,41h,c0h,dch,3bh,63h,a5h,63h
+			db	f9h,15h,4eh,4ah,88h,28h,25h,d3h
+			db	e9h,e0h,a4h,0bh,eah,69h,91h,a1h
+			db	8dh,51h,4eh,6fh,53h,ech,b2h,6bh
+			db	bdh,32h,17h,a7h,b8h,6ah,bfh,5dh
+			db	afh,24h,c9h,b1h,39h,3fh,36h,97h
+			db	96h,9bh,82h,fah,93h,c3h,4bh,d0h
+			db	42h,c4h,4ah,b9h,54h,29h,1fh,5eh
+			db	20h,e3h,3ch,deh,d4h,55h,83h,5eh
+			db	c5h,2ah,1eh,3eh,8dh,89h,aah,eeh
+			db	ach,e0h,06h,07h,f8h,11h,11h,e6h
+			db	f9h,77h,80h,1dh,04h,e1h,58h,0bh
+			db	8fh,47h,edh,5bh,13h,9ah,edh,18h
+			db	a4h,0dh,d6h,30h,ceh,b6h,07h,77h
+			db	3bh,efh,e1h,5ch,cch,4ah,38h,09h
+			db	77h,71h,8ah,b9h,6fh,d5h,ceh,cch
+			db	f5h,c6h,14h,a1h,dah,fdh,f0h,41h
+			db	2dh,87h,9bh,d4h,0dh,cdh,a6h,9eh
+			db	9eh,57h,b6h,8fh,59h,21h,37h
+			ld	(9c0ah),a
+			and	e
+			ld	h,2ch
+			nop (2x) *
+			ret	p
+			ld	l,(hl)
+			ret	nc
+			ld	d,49h
+			ld	h,(hl)
+			cpl
+			ld	b,(hl)
+			ld	b,c
+			ld	d,h
+			adc	a,h
+			push	de
+			ld	a,a
+			ld	hl,5fd2h
+			jp	L2a1e
+			db	29h,4ch,13h,72h,eeh,04h,53h,c3h
+			db	dah,34h
+			halt
+			ld	b,(hl)
+			call	po,La88f
+			call	Lc47b
+			sbc	a,(hl)
+			jp	Lea9f
+			db	01h,83h,89h,4fh,d2h,cdh,72h,7dh
+			db	dfh,b7h,83h,a2h,20h,bbh,77h,eeh
+			db	3dh,beh,6fh,dah,ebh
+			jp	nc,L726d
+			or	b
+			ld	de,e270h
+			add	hl,de
+			add	a,h
+			ld	h,(hl)
+			ld	(hl),c
+			ld	a,a
+			ld	c,b
+			add	hl,bc
+			cpl
+			sub	c
+			inc	d
+			cp	h
+			sbc	a,l
+			ld	a,(bc)
+			or	h
+			add	a,e
+			ld	h,h
+			ld	e,h
+			sub	0dh
+			call	nz,Lb7c7
+			call	L0914
+			rst	20h
+			sub	b
+			ld	a,(1fb3h)
+			or	l
+			dec	hl
+			sbc	a,c
+			ld	c,e
+			ld	e,d
+			ld	a,c
+			add	hl,hl
+			ex	af,af'
+			ex	de,hl
+			ld	h,h
+			rst	28h
+			sbc	a,(hl)
+			add	a,c
+			xor	l
+			ld	c,b
+			cp	b
+			inc	de
+			adc	a,h
+			ld	e,d
+			adc	a,e
+			ld	h,1fh
+			jp	(hl)
+			db	fch,c6h,cch,26h,4ah,5fh,cbh,3ch
+			db	0bh,76h,00h,1fh,7bh,93h,5dh,fah
+			db	2ah,c5h,83h,51h,41h,f4h
+			xor	h
+			inc	h
+			rst	00h
+			dec	l
+			ld	h,d
+			add	hl,hl
+			sub	e
+			sub	b
+			inc	b
+			nop (2x) *
+			rst	20h
+			ld	l,b
+			ld	a,27h
+			sub	e
+			jr	c,L9074
+			sub	c
+			rst	30h
+			xor	h
+			ld	b,l
+			rst	00h
+			ld	b,l
+			rrca
+			inc	c
+			rst	08h
+			ld	a,d
+			rla
+			ld	(hl),21h
+			ld	l,h
+			sbc	a,b
+			or	c
+			and	91h
+			push	de
+			ld	a,l
+			ld	l,e
+			ld	c,e
+			add	hl,bc
+			ld	e,l
+			adc	a,(hl)
+			dec	de
+			inc	hl
+			jp	L083e
+			db	71h,c0h,f5h,95h,65h,cch,91h,46h
+			db	57h,41h,fdh,2ah,70h,68h,49h,07h
+			db	05h,10h,f1h,51h,1dh,47h,d9h,aeh
+			db	dch,8ah,78h,e4h,1bh,06h,b3h,8bh
+			db	10h,89h,dbh,d8h,74h,abh,04h,75h
+			db	a5h,36h,aah,6fh,e6h,6fh,0eh,8fh
+			db	e2h,efh,d0h,95h,a0h,e7h,4ah,fbh
+			db	62h,69h,0eh,42h,c0h,a5h,63h,6ah
+			db	67h,f2h,a0h,5ch,a3h,a9h,01h,73h
+			db	d0h,20h,2ah,22h,14h,8eh
+			jp	pe,Lc2d4
+			add	hl,sp
+			ld	l,e
+			ld	a,c
+			ld	a,c
+			xor	01h
+			rrca
+			ld	e,l
+			ld	e,(hl)
+			rst	10h
+			call	m,L9e1f
+			pop	hl
+			inc	de
+			ld	b,e
+			inc	sp
+			ld	h,e
+			dec	bc
+			sub	h
+			ld	a,b
+			pop	af
+			ld	bc,42b6h
+			adc	a,e
+			adc	a,(hl)
+			jr	c,L90ae
+			ld	e,l
+			and	l
+			rst	38h
+			adc	a,l
+			cp	b
+			call	c,L5b9a
+			ld	e,l
+			rrca
+			daa
+			ld	h,b5h
+			jp	nz,L90a2
+			ld	c,h
+			adc	a,(hl)
+			ld	h,b
+			ret
+			db	e5h,15h,fdh,5ah,89h,7bh,e4h,e5h
+			db	62h
+			ld	c,a
+			ld	e,b
+			add	a,l
+			ld	(71a9h),a
+			dec	a
+			ld	hl,6956h
+			dec	bc
+			inc	bc
+			ld	l,h
+			ld	h,a
+			dec	c
+			ld	l,b
+			call	nc,Lf126
+			and	a
+			pop	hl
+			adc	a,d
+			ld	d,b
+			cp	c
+			ld	e,b
+			and	e
+			xor	fah
+			ld	h,9bh
+			push	bc
+			jp	c,L91da
+			ld	c,d
+			adc	a,d
+			dec	de
+			ld	d,c
+			or	b
+			ld	b,b
+			dec	d
+			ret	pe
+			adc	a,d
+			jp	p,L2bc2
+			call	p,L32ca
+			rst	30h
+			ex	af,af'
+			ld	h,h
+			add	hl,sp
+			ld	d,a
+			ld	h,(hl)
+			exx
+			xor	(hl)
+			ret	z
+			rrca
+			ld	a,(9ab1h)
+			ld	e,c
+			ld	h,a
+			ld	c,c
+			ld	e,b
+			ld	l,(hl)
+			jr	nc,L90af
+			ld	c,a
+			adc	a,l
+			jp	pe,L37ae
+			ld	l,(hl)
+			inc	c
+			add	a,e
+			xor	a
+			call	pe,La3a1
+			ld	h,a
+			rrca
+			xor	l
+			ld	a,d
+			or	b
+			ld	l,l
+			sbc	a,a
+			ld	a,(de)
+			inc	e
+			ld	e,e
+			jp	ix
+			db	1bh,56h,c2h,08h,81h,8dh,5dh,f2h
+			db	c6h,11h,63h,7ch,55h,abh,07h,cch
+			db	62h,21h,b6h,9ah,a2h,12h
+			ld	h,e
+			and	a
+			ld	b,e
+			xor	h
+			and	h
+			push	bc
+			dec	de
+			adc	a,a
+			cp	b
+			ld	sp,3cfah
+			sub	(hl)
+			ld	(hl),5bh
+			ld	sp,hl
+			ld	d,b
+			ld	a,l
+			cp	a
+			xor	1ch
+			push	bc
+			ld	b,c
+			ret	pe
+			jp	(hl)
+			db	10h,42h,ach,80h,14h,6fh,10h,33h
+			db	62h,67h,43h,6ch,92h,98h,b6h,0bh
+			db	5dh,29h,89h,b8h,ffh,42h,90h,08h
+			db	66h,9dh,3ch,b8h,8fh,3ch,c3h,d9h
+			db	d7h,6dh,6eh,4bh,17h,25h,50h,36h
+			db	2fh,36h,ech,1ah,cbh,beh,41h,cdh
+			db	e6h,e2h,9dh,89h,b4h,2dh,26h,62h
+			db	21h,4fh
+			ld	a,a
+			ld	e,d
+			ld	l,h
+			call	c,L9575
+			dec	bc
+			ld	hl,(c3a4h)
+			ld	d,23h
+			xor	e
+			ld	c,(hl)
+			call	nz,Lc1a1
+			dec	l
+			exx
+			ld	h,(hl)
+			ei
+			ld	a,(hl)
+			nop (2x) *
+			sub	a
+			ld	l,b
+			ld	(hl),26h
+			and	e
+			sbc	a,e
+			ld	c,a
+			sbc	a,ech
+			xor	(hl)
+			cp	d
+			ret	p
+			rst	00h
+			ld	l,48h
+			ld	e,h
+			inc	bc
+			ld	(de),a
+			add	hl,bc
+			push	hl
+			call	nc,Le383
+			jr	z,L917f
+			adc	a,b
+			ld	d,h
+			adc	a,c
+			adc	a,l
+			ld	a,(hl)
+			xor	c
+			ex	(sp),hl
+			and	f2h
+			ld	(hl),d
+			ld	l,b4h
+			and	(hl)
+			ret	po
+			xor	d2h
+			ret	p
+			ld	c,c
+			exx
+			ei
+			ld	d,(hl)
+			add	a,a
+			call	p,Le300
+			pop	af
+			ex	de,hl
+			jp	po,Lba70
+			ld	(c58dh),a
+			ld	e,a
+			or	c
+			sub	b
+			and	h
+			ld	(hl),a
+			or	e
+			ld	c,a
+			cp	c
+			call	z,Lc16c
+			dec	a
+			and	a
+			push	af
+			ex	(sp),hl
+			ld	h,b
+			sub	a
+			add	hl,sp
+			inc	bc
+			ld	l,h
+			call	L2b36
+			jr	nz,L91d8
+			ld	a,c3h
+			add	a,c
+			ld	a,b
+			ld	bc,4ec0h
+			ex	af,af'
+			ld	h,e
+			ld	h,ech
+			rst	10h
+			sbc	a,e
+			di
+			push	hl
+			add	a,(hl)
+			xor	e
+			dec	hl
+			ld	h,e
+			xor	e
+			sbc	a,e
+			cp	a
+			inc	d
+			ld	a,e
+			ld	d,l
+			ld	c,e
+			push	de
+			jp	nz,L9e01
+			rst	18h
+			add	a,d
+			inc	hl
+			jr	c,L9224
+			ld	c,l
+			dec	d
+			rst	30h
+			sbc	a,c
+			ld	h,b
+			ld	d,a
+			ccf
+			call	pe,La7fc
+			dec	de
+			xor	c
+			cpl
+			ld	d,e
+			dec	a
+			ld	c,c
+			ld	d,a
+			inc	e
+			jp	nc,L50d9
+			add	hl,hl
+			or	(hl)
+			ld	d,(hl)
+			ld	h,h
+			inc	h
+			and	b
+			ld	b,l
+			inc	h
+			ld	a,b
+			ld	h,d0h
+			cp	a
+			adc	a,h
+			cp	d
+			ld	d,d
+			pop	bc
+			and	50h
+			ret	nc
+			push	hl
+			ret
+			db	deh,1eh,67h,d5h,00h
+			ei
+			ld	a,(hl)
+			ld	l,a
+			and	a7h
+			sbc	a,b
+			ld	d,l
+			or	b
+			ld	b,c
+			rla
+			ld	h,l
+			ld	ixh,d *
+			ret	p
+			and	h
+			ld	(bc),a
+			inc	bc
+			sbc	a,(hl)
+			ld	d,b
+			sub	e
+			ld	a,e
+			ret
+			db	0eh,30h,c8h,40h,6bh,0bh
+			ld	(de),a
+			adc	a,f3h
+			jp	nz,Lf9ff
+			push	af
+			cp	h
+			sbc	a,c
+			ld	a,(bc)
+			add	hl,de
+			or	(hl)
+			call	z,L0994
+			rst	38h
+			push	hl
+			inc	l
+			and	d
+			cp	d
+			dec	b
+			ld	e,07h
+			call	c,L743c
+			ld	l,9dh
+			daa
+			sub	c
+			dec	bc
+			cp	(hl)
+			dec	a
+			ld	c,h
+			rst	28h
+			and	l
+			inc	bc
+			ld	c,c
+			rla
+			cp	d
+			inc	sp
+			inc	l
+			ld	h,c
+			xor	c
+			or	c
+			ld	a,h
+			ld	(f9b3h),hl
+			ld	d,d
+			xor	d
+			rla
+			ld	d,l
+			cp	6eh
+			cp	(hl)
+			sbc	a,b
+			sub	h
+			ex	(sp),hl
+			rst	38h
+			ld	a,(de)
+			ld	(hl),d
+			ld	e,l
+			dec	l
+			ld	d,l
+			and	b
+			and	d
+			cp	h
+			ld	(hl),47h
+			and	62h
+			ld	d,b
+			ccf
+			jr	z,L924e
+			sub	b
+			ld	a,(hl)
+			or	h
+			ld	a,h
+			ld	hl,(db2ah)
+			ld	a,4bh
+			and	d
+			add	hl,sp
+			sub	d
+			ld	c,(hl)
+			push	hl
+			inc	l
+			ld	(824ch),hl
+			or	h
+			ex	de,hl
+			xor	h
+			xor	e
+			ld	l,h
+			or	e
+			inc	bc
+			ld	b,a
+			xor	h
+			jp	c,L491f
+			daa
+			ld	b,b
+			or	10h
+			ld	(de),a
+			ld	d,(hl)
+			or	c
+			rrca
+			sbc	a,c
+			rst	38h
+			push	bc
+			rst	00h
+			adc	a,c
+			ld	a,(de)
+			ld	a,h
+			or	(hl)
+			sbc	a,a
+			ld	d,c5h
+			ld	d,c
+			inc	(hl)
+			cp	h
+			dec	d
+			scf
+			sbc	a,c
+			sub	a
+			add	a,1bh
+			pop	de
+			or	e
+			sbc	a,d
+			ld	b,a
+			ret	m
+			ld	e,h
+			ex	af,af'
+			rst	28h
+			ld	c,c
+			rst	38h
+			dec	e
+			jp	(hl)
+			db	d5h,74h,50h,89h,86h,77h,8ch,65h
+			db	a7h,feh,94h,42h,fah,76h,66h,12h
+			db	02h,54h,2ch,ach,24h,60h,95h,8ch
+			db	10h,c2h,cch,39h,59h,dah,8ch,c0h
+			db	67h,bbh,90h,18h,47h,17h,e8h,aah
+			db	2eh,43h,c7h,20h,32h,a8h,13h,c1h
+			db	83h,b8h,6ah
+			ld	(hl),a
+			ld	c,d
+			ld	(hl),h
+			or	h
+			jp	nz,L0450
+			ld	e,(hl)
+			add	a,b
+			in	a,(d2h)
+			di
+			adc	a,e
+			xor	e9h
+			sbc	a,b
+			adc	a,e
+			ld	a,e
+			ret	nz
+			ld	c,e
+			ld	l,b
+			cp	a
+			ld	a,(bc)
+			inc	(hl)
+			ld	h,h
+			add	hl,de
+			rlca
+			sub	c
+			jr	c,L92cb
+			and	c
+			or	(hl)
+			sbc	a,d
+			jp	pe,L47b5
+			ld	sp,hl
+			jp	z,Ld94f
+			ld	b,d
+			ld	a,(df07h)
+			ld	c,a
+			sub	(hl)
+			and	d
+			or	b
+			or	h
+			ld	c,l
+			ld	a,b
+			and	l
+			ld	e,d
+			push	af
+			ret	c
+			inc	d
+			ld	c,e
+			exx
+			ld	h,(hl)
+			and	(hl)
+			ld	(hl),l
+			sbc	a,a
+			add	hl,bc
+			adc	a,c
+			ld	(bc),a
+			inc	h
+			ld	a,(8922h)
+			halt
+			or	e
+			adc	a,l
+			cp	(hl)
+			adc	a,e
+			ld	c,a1h
+			ld	e,l
+			call	p,L1786
+			ld	h,d
+			ld	d,a
+			add	a,a
+			ld	c,c
+			add	hl,hl
+			ld	h,b
+			add	a,h
+			inc	a
+			xor	e
+			ld	e,c
+			ld	a,(26e5h)
+			ld	bc,cc96h
+			adc	a,h
+			ld	e,c
+			cp	e
+			ld	sp,065bh
+			ld	h,c
+			sub	98h
+			dec	l
+			inc	c
+			add	a,b
+			ld	e,a
+			sbc	a,c
+			and	15h
+			cp	e
+			pop	bc
+			ld	(bc),a
+			ld	c,c
+			ld	l,b
+			ld	c,8eh
+			ld	h,40h
+			ld	a,(hl)
+			call	po,L63b7
+			inc	b
+			xor	l
+			ld	c,h
+			and	a
+			call	po,L20e6
+			call	L4a62
+			sub	d
+			ld	a,(bc)
+			sub	b
+			cp	e
+			adc	a,a
+			inc	bc
+			ld	a,(de)
+			pop	af
+			sbc	a,h
+			ld	h,(hl)
+			ret	p
+			add	hl,sp
+			dec	h
+			push	bc
+			rlca
+			ld	h,l
+			inc	e
+			ld	a,a
+			ld	(bc),a
+			ld	c,d9h
+			adc	a,a
+			di
+			ld	(hl),c
+			ld	c,a
+			ld	b,a
+			xor	d
+			ld	(b9d7h),hl
+			ret	pe
+			ld	hl,(da68h)
+			di
+			rst	28h
+			ld	h,(hl)
+			ld	c,e
+			dec	(hl)
+			inc	l
+			scf
+			ld	a,(hl)
+			ld	h,e
+			ld	b,a
+			ld	de,33ffh
+			adc	a,c
+			push	bc
+			ld	c,h
+			add	a,b
+			sub	a
+			ld	d,9bh
+			rst	18h
+			cp	b
+			inc	hl
+			inc	b
+			ld	e,d
+			or	a
+			add	a,e
+			ld	b,l
+			or	46h
+			ld	e,h
+			sla	c
+			jp	c,Lb4f3
+			sub	h
+			jp	Le140
+			db	0dh,4fh,d2h,f7h,62h,49h,40h,01h
+			db	8bh,fbh,65h,97h,00h,54h,23h,4bh
+			db	abh,58h
+			and	h
+			add	a,d
+			ld	b,h
+			and	d
+			adc	a,c
+			jr	nz,L93a4
+			push	hl
+			add	hl,hl
+			in	a,(99h)
+			ld	b,b
+			dec	b
+			jp	nc,L466d
+			sbc	a,(hl)
+			inc	(hl)
+			call	m,L8e8d
+			add	a,b
+			ld	de,2646h
+			rrca
+			ld	(de),a
+			ld	(hl),d
+			inc	sp
+			ex	af,af'
+			sbc	a,e6h
+			ld	c,f3h
+			or	h
+			call	p,L5ef0
+			sbc	a,e
+			ld	d,(hl)
+			ld	l,l
+			ld	(hl),d
+			dec	l
+			ld	(bc),a
+			ld	e,h
+			jr	c,L93e8
+			djnz	L93c7
+			di
+			ld	l,b
+			ret	po
+			ld	d,e
+			ld	d,b
+			inc	l
+			jr	nc,L9466
+			ld	h,d
+			in	a,(96h)
+			ld	h,a
+			or	3eh
+			jp	po,L69f1
+			ccf
+			add	hl,de
+			ld	l,a
+			ret	pe
+			sub	h
+			add	a,(hl)
+			dec	sp
+			inc	e
+			push	bc
+			ld	l,l
+			xor	h
+			ld	d,dbh
+			ld	a,d
+			cpl
+			add	a,b
+			push	af
+			dec	e
+			pop	hl
+			add	hl,de
+			ld	c,(hl)
+			ld	d,c
+			ld	h,c
+			cp	(hl)
+			ld	h,e
+			jr	nz,L93cb
+			ld	b,e
+			sbc	a,b
+			adc	a,h
+			jp	(hl)
+			db	37h,87h,e8h,5eh,7fh,a3h,80h,e2h
+			db	feh,d1h,7fh,00h,70h,39h,70h,88h
+			db	dch,eah,d9h,d4h,dfh,33h,d4h,3fh
+			db	00h,42h,f6h,39h,35h
+			ld	a,b
+			ld	l,a
+			ld	a,d
+			ld	b,c
+			ret	c
+			ld	b,l
+			ld	b,e
+			nop (2x) *
+			in	a,(ech)
+			and	b
+			ld	c,l
+			xor	edh
+			ld	c,b
+			add	a,3fh
+			call	m,L2343
+			ld	l,a
+			sub	h
+			ld	(hl),l
+			push	af
+			bit	0,l
+			ld	b,e
+			di
+			jr	nz,L9430
+			jr	c,L94b6
+			ld	l,d
+			call	pe,Lc986
+			rst	00h
+			inc	(hl)
+			ld	(9600h),hl
+			push	af
+			rra
+			ld	l,l
+			ld	a,38h
+			exx
+			dec	c
+			adc	a,l
+			ld	a,l
+			ld	c,d
+			ld	d,a
+			ld	c,a
+			ld	l,a
+			inc	(hl)
+			add	a,e
+			ld	c,d
+			sub	c
+			ld	l,(hl)
+			ld	sp,9b97h
+			ld	d,e
+			jr	z,L9429
+			ld	(hl),d
+			ld	b,a
+			sbc	a,l
+			or	c
+			add	a,b
+			ld	b,a
+			add	a,d
+			xor	c
+			ld	a,h
+			inc	l
+			add	a,h
+			adc	a,d
+			inc	de
+			add	a,a
+			inc	a
+			cp	(hl)
+			or	d
+			ret	c
+			ld	b,e
+			ld	(bc),a
+			and	c
+			call	p,L60ca
+			ld	b,e
+			jp	po,Lf7fd
+			ld	l,(hl)
+			ld	(hl),b
+			ld	sp,868fh
+			cpl
+			ld	(hl),a
+			xor	e
+			add	hl,bc
+			nop (2x) *
+			adc	a,d
+			ld	hl,(4da7h)
+			dec	bc
+			cp	e
+			ld	h,l
+			sub	9fh
+			add	hl,sp
+			pop	de
+			push	af
+			ret
+			db	16h,53h,e4h,63h,26h,aeh,62h,21h
+			db	a1h,84h,feh,82h,e3h,95h,0eh,c1h
+			db	dah,e0h,04h,7dh,f4h,59h,4ch,f8h
+			db	74h,68h,8ch,49h,2ah,c7h,8ch,e9h
+			db	47h,b1h
+			ld	a,a
+			ld	d,l
+			jp	nz,L84b7
+			ld	h,l
+			ld	sp,e6d4h
+			ld	d,e
+			ei
+			ld	b,(hl)
+			ld	h,(hl)
+			ret	z
+			ei
+			ld	l,c
+			and	h
+			add	a,ach
+			ld	e,cah
+			rst	18h
+			jp	po,Ldcc8
+			adc	a,c
+			ld	(0dceh),hl
+			push	bc
+			ret	c
+			ld	e,l
+			call	c,Lda15
+			ld	c,c
+			sbc	a,h
+			ld	e,d
+			ret
+			db	44h,bbh,edh,87h,b4h,9ah,71h,80h
+			db	3bh,d3h,66h,e8h,f7h,d6h,cfh,0eh
+			db	0ch,c6h,07h,1dh,63h,d6h,b1h,97h
+			db	1ch,c6h,e8h,ebh,40h,94h,2ch,95h
+			db	0ch,19h,48h,b2h,26h,a1h,19h,9ch
+			db	2dh,17h,b6h,b0h,86h,a1h,6bh,c6h
+			db	fah,1fh,ceh,4bh,0ah,5dh,2bh,e6h
+			db	e7h,38h,3ch,2dh,1fh,efh,c7h,4eh
+			db	a4h,07h,68h,c7h,64h,6bh,3eh,c2h
+			db	93h,71h,f7h,55h,3ch,89h,68h,71h
+			db	51h,cbh
+			sub	l
+			push	af
+			ld	d,c
+			ld	h,c
+			dec	hl
+			ld	e,e
+			adc	a,b
+			ret
+			db	a1h
+			and	h
+			bit	0,l
+			ret	pe
+			sub	c
+			ld	a,d
+			jp	m,L8298
+			cp	a
+			ld	(hl),44h
+			add	a,(hl)
+			ld	sp,hl
+			jp	m,L7d76
+			ld	c,32h
+			cp	(hl)
+			ld	h,a
+			inc	a
+			sub	e
+			call	c,L1fea
+			ld	c,l
+			ld	iyh,dbh
+			ld	c,l
+			ld	h,b
+			dec	de
+			ld	e,c
+			adc	a,4ch
+			cp	d
+			dec	sp
+			push	de
+			dec	a
+			sub	h
+			ld	d,a
+			call	c,L999a
+			ret	pe
+			sub	a
+			ld	h,d
+			inc	b
+			ld	sp,9bf0h
+			cp	d
+			inc	(hl)
+			ld	d,d
+			ld	a,l
+			nop (2x) *
+			or	a
+			in	a,(bah)
+			and	e
+			push	bc
+			jr	nz,L9592
+			sbc	a,c
+			add	a,c
+			sbc	a,l
+			ld	l,b
+			and	a
+			ld	a,5eh
+			ld	(99f0h),hl
+			ld	e,h
+			adc	a,c9h
+			ld	sp,hl
+			rra
+			ld	h,b
+			or	e
+			cp	l
+			sbc	a,a
+			sub	l
+			or	c
+			ld	h,(hl)
+			djnz	L95ed
+			dec	(hl)
+			inc	(hl)
+			rst	08h
+			ret	po
+			cp	l
+			dec	a
+			rla
+			ret	nz
+			rst	08h
+			sbc	a,h
+			ld	h,e
+			ld	h,b
+			and	e
+			pop	af
+			ld	a,l
+			ld	c,h
+			ld	l,d
+			ld	b,c
+			ld	a,a
+			jr	L9580
+			db	eah,6ch
+			and	b
+			dec	bc
+			ld	(hl),c
+			add	a,bbh
+			nop
+			ld	c,b
+			cp	b
+			ld	c,h
+			jr	L9616
+			db	22h,87h,f6h,a9h,d4h,a3h,d3h,79h
+			db	95h,3dh,95h,4eh,17h,f6h,27h,78h
+			db	30h,d6h,b2h,9eh,fah,74h,ebh,b9h
+			db	a8h,5bh,7dh,a3h,4eh,12h
+			ret	c
+			call	pe,L9d44
+			ld	(913ch),a
+			ld	h,d
+			adc	a,c
+			di
+			ld	h,h
+			sbc	a,a
+			ld	b,h
+			nop (2x) *
+			ld	hl,(934bh)
+			xor	b
+			xor	d
+			sbc	a,b
+			rst	00h
+			ret	po
+			ld	(2c1eh),a
+			sub	h
+			ld	(de),a
+			out	(86h),a
+			rst	08h
+			sbc	a,c
+			jp	(hl)
+			db	4eh,f9h,fah,c0h,f2h,55h,e5h,75h
+			db	a7h,21h,edh,cdh,a3h,02h,0fh,e1h
+			db	bbh,d3h,62h,d7h,d8h,b1h,22h,b2h
+			db	87h,fah,43h,33h,bdh,2dh,b1h,39h
+			db	4bh,9dh,85h,c8h,cbh,d8h,49h,94h
+			db	82h,5ah,97h,7eh,92h
+			inc	h
+			ld	b,b
+			call	nz,La495
+			ld	d,c
+			inc	b
+			or	h
+			ld	d,d
+			add	hl,de
+			ld	l,(hl)
+			add	hl,bc
+			ld	a,(hl)
+			xor	b
+			xor	(hl)
+			and	a
+			jp	nc,L655d
+			ld	(hl),c
+			dec	(hl)
+			and	(hl)
+			ld	h,l
+			rst	28h
+			ld	c,79h
+			call	p,Lee1a
+			pop	hl
+			xor	b
+			inc	bc
+			inc	c
+			out	(c),a
+			ret	nc
+			sbc	a,d
+			xor	a
+			ld	b,b
+			and	01h
+			halt
+			or	e
+			jp	nz,Le4f0
+			dec	de
+			ld	a,(bc)
+			ld	l,c
+			ld	h,e
+			xor	e
+			ld	(fabbh),ix
+			adc	a,a
+			scf
+			rst	30h
+			ld	a,a
+			ld	(19c4h),a
+			call	po,L3c26
+			call	p,Lf4f2
+			add	a,d
+			dec	d
+			and	76h
+			cp	h
+			ld	b,0eh
+			rst	18h
+			or	l
+			adc	a,b
+			add	a,h
+			call	pe,L3e45
+			ld	(61b3h),hl
+			and	l
+			jr	z,L9680
+			ei
+			add	a,(hl)
+			sub	b
+			inc	de
+			sbc	a,b
+			ld	c,d
+			or	b
+			ld	(hl),l
+			ld	c,l
+			and	l
+			inc	a
+			ld	e,b
+			ld	b,a
+			nop (2x) *
+			call	pe,L6065
+			inc	d
+			ret	m
+			ld	c,e
+			adc	a,h
+			ld	b,(hl)
+			ld	b,l
+			ld	l,d
+			inc	c
+			add	a,b
+			ret	nc
+			sbc	a,a
+			adc	a,c
+			call	L25b1
+			xor	l
+			or	l
+			sub	a
+			add	a,h
+			ld	hl,a6feh
+			nop
+			dec	(hl)
+			xor	b
+			cp	d
+			ld	h,e
+			sub	c
+			sub	d
+			sub	c
+			adc	a,b
+			ld	bc,1160h
+			ld	c,71h
+			ld	l,d
+			ld	b,b
+			cp	a
+			ld	c,e
+			di
+			or	l
+			ld	l,(hl)
+			add	hl,sp
+			ld	d,d
+			ret	p
+			dec	sp
+			sbc	a,h
+			jp	m,Lc032
+			cp	e
+			jp	(hl)
+			db	5ch,04h,7eh,a0h,93h,29h,b2h,25h
+			db	f7h,1ch,26h,ech,12h,06h,1dh,83h
+			db	5bh,49h,80h,68h,26h,98h,29h,cfh
+			db	00h,cdh,b4h,0bh,60h,94h,dch,4fh
+			db	dch,f0h,63h,afh,24h,ech,f0h,11h
+			db	c6h,c7h,d9h,0eh,e0h,08h,0eh,fah
+			db	8eh,5fh,bah,18h,3bh,10h,9bh
+			ld	b,d
+			ld	l,e
+			adc	a,e
+			sub	c
+			sub	(hl)
+			inc	c
+			ld	a,b
+			rla
+			jp	pe,L9240
+			rrca
+			ld	b,d
+			ld	h,3bh
+			or	d
+			sub	h
+			sbc	a,l
+			rst	18h
+			jp	(hl)
+			db	3dh,69h,60h,bfh,e9h,3dh,b1h,4ah
+			db	8eh,d5h,b0h,1fh,b6h,42h,6bh,8fh
+			db	12h,f3h,48h,69h,b6h,d0h,8dh,ffh
+			db	a0h,c3h,32h,ach,84h,5ah,cch,1fh
+			db	22h,29h,64h,1fh,8ah,cah,3bh,31h
+			db	65h,88h,2ch,85h,1ch,0eh,9bh,59h
+			db	1fh,4ch,98h,6fh,f4h,49h,73h,51h
+			db	10h,d5h,04h,14h,93h,56h,beh,40h
+			db	31h,01h,c6h
+			inc	l
+			ld	a,d
+			ld	l,d
+			ld	a,c8h
+			ld	sp,9688h
+			ld	d,b
+			daa
+			rst	20h
+			or	e
+			sbc	a,a
+			ld	sp,hl
+			ld	h,h
+			jp	m,L5b7b
+			dec	hl
+			ex	de,hl
+			ld	b,a
+			ld	b,d
+			inc	c
+			rst	10h
+			jp	m,Lc4cc
+			jp	(hl)
+			db	c5h,c1h,30h,cah,58h,d3h,d1h,4fh
+			db	15h,73h,40h,52h,70h,5bh,31h,63h
+			db	b4h,34h,d5h,f1h,d9h,83h,38h,fah
+			db	76h,e5h,88h,64h,2fh,96h,9ah,b0h
+			db	6ah,2ch,cdh,2ah,20h,fdh,bch,80h
+			db	50h,13h,9eh,a8h,94h,28h,0dh,02h
+			db	78h,38h,06h,f6h,90h,16h,11h,b9h
+			db	3fh,abh,6ch,8ch,b0h,10h,69h,fbh
+			db	7bh,adh,e5h,3dh,9dh,7eh,cfh,ffh
+			db	c8h,dah,82h,9dh,87h,10h,c0h,4bh
+			db	0eh,bah,ebh,1eh,3ch,b9h,aeh,4ch
+			db	63h,ebh
+			sbc	a,d
+			ld	h,a
+			ld	(a2beh),a
+			jr	nz,L9861
+			and	(hl)
+			sub	b
+			cp	l
+			inc	sp
+			dec	bc
+			out	(2eh),a
+			ld	a,b
+			ret	nc
+			dec	e
+			ld	(hl),h
+			push	af
+			adc	a,a
+			cp	h
+			add	a,e
+			push	af
+			ld	b,e
+			ld	a,(1f25h)
+			dec	bc
+			sbc	a,92h
+			adc	a,(hl)
+			call	nz,L20f1
+			add	hl,sp
+			ld	c,a
+			ld	a,b
+			ld	b,l
+			sub	b8h
+			nop (2x) *
+			ld	c,d
+			cp	b8h
+			ld	a,a
+			add	hl,de
+			ld	(ffbdh),a
+			ld	a,58h
+			pop	de
+			sbc	a,h
+			pop	de
+			ld	h,l
+			cp	c
+			xor	c
+			jp	L8e7d
+			db	dfh,b7h,8fh,b2h,74h,c6h,aah,0dh
+			db	06h,5bh,23h,b3h,b5h,18h,8bh,50h
+			db	c1h,f3h,8dh,ebh,9ch,01h
+			cp	b
+			rst	08h
+			halt
+			ret	z
+			dec	(hl)
+			ret	po
+			ld	b,b
+			ld	de,0e89h
+			rst	10h
+			dec	de
+			ei
+			ld	d,c
+			rst	10h
+			ld	c,a
+			ld	b,h
+			inc	sp
+			ld	bc,056ah
+			ld	c,b
+			ld	(hl),c
+			add	a,a
+			ld	d,fah
+			ld	l,c
+			ld	d,d
+			ld	e,l
+			rst	00h
+			call	z,Lcc8a
+			cp	51h
+			ret	nz
+			ld	l,a
+			ld	a,(de)
+			adc	a,ixh *
+			and	h
+			ld	c,b
+			ld	e,l
+			ld	c,(hl)
+			jp	m,L4223
+			ex	af,af'
+			xor	c
+			nop
+			rst	28h
+			ex	de,hl
+			dec	sp
+			and	e
+			push	bc
+			jp	pe,Le30e
+			exx
+			push	af
+			cp	l
+			dec	bc
+			or	d
+			nop
+			and	b
+			daa
+			ld	d,c
+			ret	nc
+			inc	c
+			ld	h,l
+			pop	bc
+			jr	nz,L986a
+			ld	d,a
+			ld	(hl),l
+			add	hl,bc
+			ld	d,c
+			ex	(sp),hl
+			ld	(0bb2h),a
+			or	2dh
+			xor	(hl)
+			rrca
+			xor	l
+			ld	sp,hl
+			ret
+			db	2ah,0fh,d0h,c9h,77h,adh,03h,cfh
+			db	feh,d2h,d4h,c9h,2eh,54h,82h,4dh
+			db	4eh,8eh,8bh,85h,93h,ech,09h,5bh
+			db	13h,83h,48h,c1h,f3h,96h,24h,26h
+			db	39h,e4h,adh,8ch,feh,97h,f5h,78h
+			db	3bh,36h,37h,41h,4bh,77h,d3h,36h
+			db	bfh
+			ld	e,14h
+			and	b
+			ld	c,e
+			add	a,h
+			rla
+			rst	18h
+			add	a,h
+			rra
+			ld	c,e
+			ld	h,a
+			rla
+			jp	Lb9c6
+			db	a3h,b7h,b8h,0fh,9bh,ddh,60h,9bh
+			db	51h,bbh,8eh,a1h,d1h,67h,c2h,66h
+			db	44h,bbh,a6h,54h,abh,8eh,01h,bbh
+			db	6dh,f5h,f3h,a6h,49h,17h,d0h,d7h
+			db	fdh,bbh,afh,c0h,a2h,55h,2ah,fah
+			db	beh,e7h,a7h,14h,b2h,dbh,0ah,46h
+			db	a5h,aeh,aeh,55h,65h,7eh,98h,2bh
+			db	a0h,61h,f4h,35h,f1h,a8h,53h,6eh
+			db	d5h,7dh,58h,ffh,87h,edh,5ah,57h
+			db	07h,d4h,88h,6ch,7ah,9fh,a1h,5ch
+			db	76h,a2h,aeh,10h,0ch,34h,90h,31h
+			db	fch,5bh,a9h,2fh,60h,b8h,50h,98h
+			db	7dh,c9h
+			add	a,a
+			ret	nc
+			xor	c
+			dec	e
+			cp	h
+			add	a,cbh
+			ld	(hl),l
+			adc	a,e
+			add	hl,sp
+			inc	b
+			ld	e,h
+			adc	a,e
+			adc	a,e
+			xor	a5h
+			ex	(sp),hl
+			pop	bc
+			ex	de,hl
+			add	hl,bc
+			xor	(hl)
+			and	c
+			ld	a,l
+			cp	d
+			ld	a,l
+			xor	a
+			rst	20h
+			xor	b
+			ld	a,aah
+			rst	18h
+			add	a,h
+			ret	c
+			ld	b,h
+			or	c
+			ld	(hl),a
+			cp	b
+			dec	b
+			rst	00h
+			sub	(hl)
+			adc	a,5bh
+			sub	c
+			nop
+			ld	(de),a
+			inc	bc
+			call	L37ac
+			ld	a,(47d2h)
+			ld	d,d
+			ld	l,b5h
+			ld	(hl),l
+			pop	de
+			ld	e,h
+			jr	z,L99db
+			ret	pe
+			inc	d
+			xor	l
+			ret	p
+			push	bc
+			add	a,9bh
+			ret	po
+			call	nz,L07e6
+			or	c
+			adc	a,b
+			cp	e
+			dec	bc
+			inc	l
+			push	de
+			call	nz,Lb196
+			ld	l,h
+			dec	c
+			sub	39h
+			jp	pe,Lfb58
+			inc	bc
+			call	L7294
+			adc	a,(hl)
+			ld	h,c
+			out	(e8h),a
+			ld	e,b
+			or	36h
+			or	d
+			sbc	a,(hl)
+			sbc	a,l
+			call	p,L1978
+			ld	h,d
+			ld	d,12h
+			sbc	a,4eh
+			scf
+			adc	a,d
+			ld	l,(hl)
+			out	(f5h),a
+			set	3,b
+			call	c,L0469
+			djnz	L99fc
+			jp	pe,L3209
+			add	a,(hl)
+			cp	a
+			exx
+			jp	La16c
+			db	f9h,e0h,a1h,7ch,9ah,0ch,dch
+			or	l
+			ret	po
+			ld	(bc),a
+			dec	bc
+			halt
+			call	Lc0c1
+			add	a,e
+			ld	b,(hl)
+			inc	(hl)
+			sbc	a,e
+			dec	de
+			ld	a,5bh
+			and	eah
+			ld	(bc),a
+			sub	13h
+			or	(hl)
+			ld	d,l
+			dec	sp
+			and	a
+			ld	(hl),e
+			call	z,L222c
+			call	z,L48a3
+			ld	c,a
+			push	af
+			ret	m
+			jr	L9a41
+			db	f5h,ceh,3eh,3fh,67h,4eh,47h,26h
+			db	a3h,84h,29h,4bh,cbh,34h,4ch,b6h
+			db	8ch,eeh,a0h,82h,cah,b9h,36h,edh
+			db	b7h,19h,8fh
+			ld	c,l
+			ret	po
+			dec	bc
+			ld	sp,a367h
+			jr	nz,L9a2d
+			ld	h,e
+			or	l
+			ld	d,c
+			inc	h
+			ld	a,d
+			daa
+			ld	d,d
+			and	d
+			ld	e,d
+			sub	b
+			cp	b
+			halt
+			and	c
+			inc	sp
+			djnz	L9a9d
+			and	c
+			sbc	a,b
+			ld	a,c
+			ld	a,8eh
+			ld	c,a
+			jr	z,L9a6e
+			add	a,d
+			ld	a,a
+			ld	c,d
+			ld	e,a
+			ld	e,b
+			cp	l
+			ld	(hl),97h
+			halt
+			or	(hl)
+			jp	po,Le14d
+			and	77h
+			or	a
+			dec	bc
+			nop (2x) *
+			ld	e,2dh
+			ld	a,d
+			ld	a,01h
+			ex	de,hl
+			ld	h,c
+			or	h
+			jp	nz,Ld2a2
+			push	hl
+			ld	(hl),c
+			ld	d,b
+			ld	e,a
+			sbc	a,h
+			sub	60h
+			ld	a,b
+			ld	a,l
+			ld	d,c
+			rla
+			rst	18h
+			ld	(hl),c
+			ld	e,h
+			add	a,h
+			inc	de
+			call	nz,Lb2af
+			scf
+			ld	a,l
+			rst	20h
+			ld	a,(bc)
+			ld	d,a
+			dec	l
+			xor	(hl)
+			or	e
+			ld	h,(hl)
+			ex	(sp),hl
+			ld	(8160h),hl
+			ld	d,d
+			sub	b
+			ld	a,(00f8h)
+			add	a,h
+			add	hl,bc
+			dec	h
+			dec	sp
+			jr	z,L9a38
+			and	b
+			xor	l
+			ld	b,d3h
+			adc	a,c
+			sbc	a,b
+			sbc	a,d
+			inc	e
+			ld	l,e
+			and	c
+			rst	20h
+			ld	d,a
+			and	c
+			adc	a,d
+			adc	a,h
+			xor	h
+			dec	c
+			ld	h,a
+			jp	z,La7f2
+			ret	nc
+			sbc	a,e
+			jp	z,L5f3b
+			adc	a,e
+			ld	e,e
+			dec	l
+			ld	b,a8h
+			adc	a,d
+			or	e
+			add	a,f9h
+			sbc	a,l
+			ld	c,1fh
+			sbc	a,b
+			adc	a,e
+			inc	bc
+			rst	00h
+			ld	l,(hl)
+			inc	(iy + 75h)
+			or	d
+			or	06h
+			ld	hl,8a75h
+			ld	a,e
+			adc	a,e
+			jr	z,L9a7f
+			sbc	a,h
+			call	c,L33dc
+			ld	(hl),b
+			rst	20h
+			ld	(bc),a
+			ret
+			db	7bh,90h,5ah,85h,88h,95h,71h,69h
+			db	a6h,d6h,56h,18h,5dh,e1h,11h,81h
+			db	fch,23h,3fh,e9h,1eh,ebh,e5h,3fh
+			db	3ah,f5h,a5h,e5h,a5h,d5h,65h,70h
+			db	5fh,98h,77h,25h,20h,ech,d5h,dch
+			db	bfh,79h,3ch,6ch,e7h,88h,e6h,8bh
+			db	e8h,ebh,c3h,3ah,93h,69h,73h,1bh
+			db	5bh,cah,d6h,87h,57h,8ah,9ah,4ch
+			db	84h,f2h,48h,90h,6ah,93h,20h,8ch
+			db	dbh,43h,20h,cdh,44h,6bh,c0h,68h
+			db	71h,b8h,d3h,09h,5fh,71h,55h,2eh
+			db	d1h,09h,ceh,16h,45h,ech,f2h,b1h
+			db	e3h,8bh,adh,c2h,3bh,08h,62h,c5h
+			db	59h,a4h,cah,69h,a6h,6dh,74h,03h
+			db	cdh,5fh,16h,18h,38h,eeh,b8h,2ch
+			db	e8h,59h,fch,bch,64h,73h,62h,35h
+			db	9fh,42h,9eh,48h,88h,e3h,01h,8eh
+			db	31h,1ah,55h,09h,44h,6bh,0ch,d9h
+			db	7fh,5dh,2eh,18h,3fh,4bh,65h,20h
+			db	fah,7dh,ach,b4h,9ah,97h,8fh,47h
+			db	3ah,89h,e6h,86h,11h,52h,5fh,aeh
+			db	d7h,eeh,57h,0ch,0eh,e9h,b7h,24h
+			db	47h,85h,7ah,c1h,53h,7ch,3ah,b0h
+			db	52h,dfh,67h,e7h,98h,a5h,13h,09h
+			db	17h,6ch,92h,e1h,54h,b1h,cfh,ddh
+			db	92h,d1h,91h,ceh,12h,f5h,4dh,b2h
+			db	34h,f8h,15h,77h,a0h,afh,d8h,46h
+			db	47h
+			pop	hl
+			ld	l,l
+			dec	h
+			ld	l,c
+			add	a,a
+			ld	d,h
+			push	af
+			out	(8bh),a
+			ld	e,a
+			jp	Le000
+			db	7bh,fch,7eh,f5h,e9h,2bh,29h,0dh
+			db	e1h,7bh,35h,35h,e2h,c1h,77h,b7h
+			db	46h,b4h,92h,a9h,10h,01h,e9h,f0h
+			db	8fh,11h,eah,4fh,47h,d7h,05h,f0h
+			db	23h,94h,a1h,4eh,43h,79h,27h,45h
+			db	52h,84h,2ah,e8h,6fh,88h,e1h,afh
+			db	89h,86h,a2h,b9h,0eh,00h,d3h,08h
+			db	fch,a8h,7fh,f5h,20h,19h,9ch,cdh
+			db	54h,c0h,11h,35h,72h,6bh,b1h,b9h
+			db	7bh,04h,eah,dch,dah,afh,72h,b3h
+			db	42h,a4h,10h,dfh,0fh,60h,a8h,48h
+			db	2ch,d3h,9bh,0ch,6eh,85h,79h,87h
+			db	b9h,f3h,aeh,81h,0fh,00h,0bh,2eh
+			db	c6h,9fh,ceh,fch,29h,fch,27h,e4h
+			db	dch,6fh,f2h,7ah,31h,39h,ech,3ah
+			db	4eh,dbh,abh,52h,38h,4fh,a0h,15h
+			db	e8h,e7h,a2h
+			sub	(hl)
+			ld	c,h
+			ld	h,c
+			jp	m,L453b
+			rst	18h
+			adc	a,b
+			rst	38h
+			jp	nc,Leeaa
+			call	L067b
+			ld	b,l
+			ld	e,c
+			ld	l,e
+			rst	08h
+			dec	c
+			ld	a,a
+			add	a,(hl)
+			ld	l,c
+			ld	(hl),a
+			call	nc,Led8a
+			ld	l,h
+			xor	a
+			sub	b2h
+			add	a,h
+			ld	e,e
+			ld	b,(hl)
+			ei
+			ld	b,d
+			cp	l
+			jp	pe,Lfd26
+			ret	m
+			ld	h,l
+			sbc	a,c
+			jr	nc,L9c2b
+			ld	(2acdh),a
+			ex	(sp),hl
+			and	b
+			ld	c,b
+			jp	po,Lfe8e
+			jp	pe,L12f0
+			add	hl,bc
+			ccf
+			ld	a,h
+			sub	b
+			ld	(hl),a
+			sbc	a,a
+			scf
+			sbc	a,h
+			xor	c
+			ld	b,c
+			ld	a,(0d68h)
+			ld	h,d
+			jr	z,L9c84
+			ld	c,d
+			ret	p
+			nop (2x) *
+			ld	(hl),c
+			ld	d,h
+			and	13h
+			cp	a4h
+			dec	l
+			ld	(de),a
+			ld	l,d
+			ld	d,b
+			ld	h,c
+			xor	a
+			exx
+			sub	l
+			add	a,d
+			ld	(de),a
+			ld	l,b
+			ld	sp,7ff6h
+			add	a,b
+			add	a,d
+			ld	e,e
+			call	m,Le4d4
+			ld	b,a
+			cp	c
+			ld	b,d
+			dec	h
+			and	(hl)
+			add	hl,sp
+			in	a,(b3h)
+			add	hl,hl
+			xor	b
+			sbc	a,74h
+			jp	nz,Le052
+			ld	(hl),d
+			jp	m,L118d
+			jp	Ldf81
+			db	7bh,11h,2ah,b7h,23h,a1h,07h,d1h
+			db	cah,f9h,a3h,94h,a1h,9ah,f9h,c4h
+			db	10h,1ah,9ch,33h,92h,c9h,c0h,bbh
+			db	34h,51h,1fh,0bh,27h,a3h,58h,5bh
+			rst	08h
+			ld	d,e
+			cp	a
+			inc	b
+			ld	e,c
+			cp	b
+			ld	b,(hl)
+			ld	d,l
+			or	l
+			ld	d,(hl)
+			ccf
+			daa
+			ld	h,a
+			ex	af,af'
+			pop	hl
+			inc	c
+			ld	b,l
+			halt
+			inc	b
+			call	Laab4
+			ld	e,e
+			cp	c
+			add	a,c
+			ld	e,d
+			and	e
+			add	a,c
+			rrca
+			rst	08h
+			call	p,L946b
+			ld	e,c
+			ld	a,e3h
+			ld	h,h
+			ld	c,b
+			ld	h,c
+			ld	c,l
+			xor	b
+			jp	L6ef0
+			db	cch,1dh,49h,83h,89h,a1h,5fh,40h
+			db	aah,6ah,e0h,92h,ech,09h,36h,b5h
+			db	ach,20h,a5h,9ah,70h,bdh,19h,afh
+			db	27h,89h,9dh,3dh,fdh,e4h,7dh,0eh
+			db	41h,a2h,c9h,bdh,e1h,feh,c2h,52h
+			db	f1h,2ah,aah,c3h,5ch,e1h,c3h
+			ld	c,(hl)
+			rlca
+			nop (2x) *
+			jp	m,L0e74
+			ld	c,b
+			and	b
+			ld	sp,999dh
+			ret	po
+			or	l
+			dec	a
+			ld	b,3fh
+			inc	h
+			ld	e,a
+			ld	(a7b5h),a
+			ld	d,d
+			add	a,(hl)
+			ld	e,l
+			ld	hl,ad18h
+			ld	b,(hl)
+			rlca
+			ret	c
+			ld	(f69fh),hl
+			cp	e
+			or	d
+			ld	l,d
+			ld	d,b
+			ld	d,h
+			adc	a,l
+			ld	d,l
+			cpl
+			jr	nz,L9dab
+			sub	(hl)
+			dec	(hl)
+			ld	e,h
+			ld	d,b
+			sub	63h
+			ld	(hl),l
+			rst	10h
+			call	Lbb19
+			ld	(2709h),a
+			halt
+			jr	nz,L9d53
+			ld	b,c
+			exx
+			ld	(hl),d
+			dec	l
+			ret	z
+			ld	c,b
+			ld	e,aeh
+			inc	de
+			ld	hl,(6c1eh)
+			and	b
+			call	c,L73dc
+			inc	de
+			ld	h,b
+			jr	nc,L9dd4
+			adc	a,(hl)
+			pop	bc
+			sbc	a,b
+			ld	b,d
+			ld	l,e
+			rra
+			and	a
+			ld	(de),a
+			ld	(0243h),hl
+			rra
+			or	(hl)
+			ld	(476fh),hl
+			push	hl
+			adc	a,a
+			add	a,b
+			ld	(hl),37h
+			add	a,d
+			ld	(dce8h),hl
+			daa
+			rst	28h
+			ld	d,abh
+			ld	d,b
+			ld	hl,efe2h
+			sbc	a,a
+			dec	b
+			ld	c,c
+			inc	e
+			jp	nc,Lad82
+			xor	c
+			add	a,l
+			xor	h
+			ld	a,(94fbh)
+			dec	b
+			inc	hl
+			ld	b,l
+			sbc	a,(hl)
+			ld	c,c
+			ld	sp,8025h
+			push	af
+			jp	z,Lcdf7
+			or	e
+			and	(hl)
+			call	po,L8369
+			inc	bc
+			ld	l,b
+			push	hl
+			cp	c
+			jp	z,L5aa6
+			call	La2f5
+			call	m,L23d9
+			ld	d,d
+			and	b
+			adc	a,b
+			ld	(hl),d
+			call	c,L2ab3
+			adc	a,b
+			dec	e
+			sub	(hl)
+			ld	(hl),h
+			and	e
+			add	a,30h
+			sub	l
+			sbc	a,(hl)
+			ld	hl,(7505h)
+			sub	a
+			sub	h
+			ret
+			db	fch,aah,7ah,e4h,83h,27h,c0h,34h
+			db	e4h,bbh,dah,69h,02h,15h,22h,28h
+			db	36h,6ch,51h,cch,6dh,00h,73h,a3h
+			db	adh
+			ld	a,c3h
+			ld	c,b
+			nop (2x) *
+			rst	38h
+			add	a,l
+			ld	c,edh
+			dec	bc
+			daa
+			rla
+			ld	c,b
+			ld	c,e
+			and	b
+			ld	(hl),a
+			ld	c,h
+			ld	e,a
+			call	pe,L7807
+			ret	nz
+			call	m,Lb1e4
+			ex	de,hl
+			jp	m,L1c70
+			or	a
+			inc	c
+			inc	hl
+			call	z,L7ab2
+			ret	nz
+			ccf
+			dec	e
+			ex	de,hl
+			and	h
+			ld	b,e
+			rst	30h
+			xor	(hl)
+			adc	a,a
+			and	b
+			sbc	a,d
+			rst	28h
+			ld	c,b
+			ld	sp,e0bch
+			ld	h,a
+			ld	a,(bc)
+			sbc	a,d
+			rst	20h
+			ld	c,d
+			ld	(hl),l
+			and	f7h
+			sbc	a,b
+			ld	a,e
+			inc	l
+			push	hl
+			ld	hl,b16ah
+			cp	48h
+			sbc	a,c
+			ld	a,a
+			add	a,l
+			ret	po
+			dec	d
+			ret	nc
+			jp	nc,Le0a6
+			inc	a
+			xor	l
+			inc	l
+			di
+			ld	c,l
+			jr	L9e41
+			db	13h,96h,6ah,ech,99h
+			ld	h,h
+			ret	pe
+			ld	a,(de)
+			ld	d,a
+			ei
+			or	(hl)
+			ld	c,d6h
+			sbc	a,h
+			ld	h,c
+			and	d
+			ld	d,l
+			add	a,a
+			ret	pe
+			ld	c,l
+			ld	l,b
+			inc	hl
+			ld	c,d
+			rst	00h
+			rst	18h
+			ld	b,d
+			cp	e
+			rst	08h
+			add	a,h
+			add	hl,hl
+			djnz	L9e60
+			ld	h,(hl)
+			ld	b,(hl)
+			call	L328c
+			and	d
+			ld	c,d
+			xor	c
+			nop (2x) *
+			ld	e,a
+			ld	a,b
+			or	64h
+			ld	d,b
+			or	h
+			add	a,a
+			ld	c,c
+			or	b
+			or	c
+			rrca
+			ld	(hl),b
+			ld	sp,hl
+			rst	30h
+			dec	a
+			ret	p
+			rlca
+			and	a
+			ld	e,h
+			adc	a,e
+			inc	(hl)
+			add	a,c
+			add	hl,hl
+			jp	(hl)
+			db	fch,beh,50h,ebh,d9h,f8h,fah,d6h
+			db	29h
+			xor	l
+			ld	(hl),a
+			ld	d,e
+			ex	de,hl
+			inc	h
+			add	a,b
+			rst	28h
+			ld	e,a
+			rla
+			ex	af,af'
+			nop (2x) *
+			sbc	a,a
+			ld	sp,hl
+			ld	e,l
+			add	a,a
+			dec	h
+			ld	b,41h
+			ret	nz
+			ld	a,l
+			dec	de
+			inc	c
+			jp	nc,L19f2
+			ld	l,d
+			sbc	a,b
+			dec	(hl)
+			add	a,a
+			ld	(hl),b
+			jp	m,L212e
+			ld	e,a
+			ld	(hl),c
+			ld	a,(hl)
+			xor	l
+			ld	c,(hl)
+			adc	a,d
+			rst	00h
+			cpl
+			add	hl,bc
+			inc	h
+			or	b
+			ld	e,h
+			xor	e
+			and	d
+			cp	d
+			cp	a
+			ld	h,a
+			ld	b,c
+			pop	af
+			sub	d
+			ld	sp,hl
+			dec	b
+			di
+			ld	e,d
+			jr	z,L9e9b
+			adc	a,(hl)
+			dec	e
+			rst	00h
+			ld	a,e
+			jr	nz,L9f3f
+			add	a,e
+			ld	(hl),d
+			ld	c,l
+			jp	p,L8f74
+			ld	a,6fh
+			pop	hl
+			sbc	a,d
+			cp	b
+			xor	a
+			ld	(hl),l
+			ld	a,(bc)
+			sub	(hl)
+			ld	c,d
+			adc	a,h
+			ld	d,29h
+			adc	a,b
+			inc	c
+			ld	l,7ch
+			jp	c,Ld331
+			ld	e,e
+			ld	de,923ah
+			inc	e
+			djnz	L9f02
+			ld	a,h
+			scf
+			inc	a
+			add	hl,sp
+			ld	(bc),a
+			nop (2x) *
+			cp	b
+			push	de
+			sub	b
+			ld	e,(hl)
+			ld	c,l
+			ld	h,c
+			push	hl
+			dec	de
+			ld	l,5dh
+			ld	a,l
+			and	(hl)
+			add	a,d
+			sub	b
+			jr	nc,L9e8c
+			cp	d7h
+			sbc	a,e
+			ld	d,b
+			ld	a,b
+			dec	e
+			ld	(hl),c
+			ld	b,e
+			ld	l,c
+			add	a,c
+			call	pe,L7706
+			rst	18h
+			jp	po,Le0be
+			ld	d,h
+			ld	e,(hl)
+			ld	c,d
+			ld	d,(hl)
+			ld	b,c4h
+			jp	nc,L0fac
+			jp	Lae0e
+			db	f0h,e1h,14h,30h,35h,8fh,25h,15h
+			db	b3h,98h,39h,82h,bbh,b4h,5eh,a1h
+			db	a9h,49h,3bh,c9h,10h,6ch,ebh,dbh
+			db	77h,86h,86h,f7h,f8h,46h
+			ret	z
+			jp	m,Lb03b
+			ld	d,(hl)
+			add	hl,de
+			ld	a,(de)
+			sbc	a,l
+			ld	l,ddh
+			push	hl
+			inc	a
+			cp	h
+			ld	l,c
+			call	pe,L1868
+			inc	d
+			or	1ah
+			jp	L63b0
+			db	a9h,bah,5fh,c8h,5dh
+			ld	a,d
+			ld	e,b
+			dec	d
+			call	nz,L0ee9
+			ld	(de),a
+			ld	d,b
+			rst	08h
+			sub	(hl)
+			ret	z
+			dec	hl
+			ld	d,c
+			or	c
+			adc	a,91h
+			call	c,L6265
+			ld	h,h
+			call	pe,L059a
+			ld	c,e
+			ld	l,e
+			or	c
+			ld	(hl),32h
+			ld	l,l
+			ret
+			db	f4h,72h,0bh,6ah,19h,70h,40h,62h
+			db	3fh,a0h,88h,a0h,88h,1eh,ddh,fch
+			inc	sp
+			sub	a
+			ld	a,e
+			ld	h,d
+			add	a,a
+			dec	h
+			ld	l,d
+			add	a,d
+			rra
+			ld	(bc),a
+			bit	1,d
+			rst	38h
+			ret	c
+			adc	a,h
+			nop (2x) *
+			cp	a
+			and	b
+			call	p,La631
+			jp	pe,L4c96
+			call	m,La946
+			ld	(hl),h
+			exx
+			in	a,(6dh)
+			and	(hl)
+			ld	l,l
+			ld	c,(hl)
+			ld	b,b
+			ld	(hl),94h
+			sbc	a,h
+			and	e
+			ld	l,l
+			dec	d
+			jp	nc,Lffcd
+			cp	5ch
+			sbc	a,l
+			ld	e,41h
+			ld	l,b
+			add	hl,sp
+			ld	h,a
+			ld	sp,hl
+			adc	a,a
+			sbc	a,l
+			ld	d,l
+			sub	b
+			rst	10h
+			ld	c,(hl)
+			xor	h
+			nop (2x) *
+			ld	d,c
+			ld	l,h
+			ld	e,(hl)
+			sub	b
+			dec	h
+			sbc	a,h
+			and	36h
+			ld	e,l
+			jr	c,La00f
+			call	m,L3320
+			ex	af,af'
+			xor	b
+			ret	po
+			sub	a
+			ld	b,a
+			ld	l,l
+			ld	d,d
+			dec	hl
+			ld	l,h
+			ld	a,a
+			jr	nc,L9fea
+			or	feh
+			ret	nc
+			scf
+			sbc	a,e
+			ld	a,(bc)
+			ld	a,fdh
+			jp	c,Le198
+			and	l
+			call	po,Lb09e
+			adc	a,e
+			and	b
+			ld	(hl),d
+			ld	sp,6c99h
+			ex	af,af'
+			ld	h,h
+			sbc	a,a
+			cp	c
+			ld	h,a
+			or	d
+			cp	e
+			exx
+			add	hl,bc
+			or	d
+			jp	z,Ld411
+			rlca
+			ld	h,c
+			adc	a,a
+			ld	h,b
+			or	h
+			di
+			and	c
+			call	c,L30ab
+			or	(hl)
+			jr	nz,La03d
+			ld	b,h
+			xor	b
+			or	h
+			ld	de,311ah
+			pop	hl
+			ld	b,h
+			ld	b,c
+			ld	e,31h
+			inc	e
+			and	e
+			and	h
+			ret
+			db	adh,5fh,e9h,95h,59h,8bh,a0h,4ch
+			db	a7h,6ch,1dh,0ch,fch,b0h,d8h,50h
+			db	7ch,4eh,68h,bfh,31h,a6h,72h,84h
+			db	55h,75h,39h,0fh,8dh,47h,57h
+			rst	38h
+			ret	p
+			ld	(bc),a
+			cp	7eh
+			add	hl,bc
+			push	hl
+			ld	d,h
+			ld	a,(hl)
+			rst	10h
+			ret	pe
+			adc	a,l
+			ld	c,c
+			xor	99h
+			ld	c,19h
+			add	a,l
+			ld	(hl),a
+			dec	de
+			ld	d,(hl)
+			adc	a,(hl)
+			ld	b,e
+			ld	(bc),a
+			out	(a9h),a
+			ld	e,(hl)
+			ret	m
+			ld	e,d
+			rla
+			adc	a,b
+			rla
+			or	b
+			add	a,(hl)
+			ld	b,e3h
+			sub	e
+			sbc	a,c
+			sub	2fh
+			ld	e,d
+			call	nc,L6ef9
+			push	bc
+			ld	c,a
+			call	Lf0d5
+			ld	d,b
+			pop	bc
+			or	b
+			cp	78h
+			push	bc
+			jr	z,La01c
+			add	hl,de
+			ld	d,d
+			call	pe,Lfdae
+			ret	p
+			ld	b,a
+			xor	d
+			ld	a,l
+			jp	p,L1c59
+			ld	d,d
+			xor	h
+			ld	e,d
+			ret	pe
+			cp	2bh
+			sub	a
+			daa
+			ld	a,b
+			ret	p
+			ld	sp,hl
+			ld	(de),a
+			add	a,b
+			inc	bc
+			xor	l
+			ld	e,c
+			and	e
+			ld	h,e
+			or	(hl)
+			inc	hl
+			nop (2x) *
+			ld	h,c
+			ld	c,e
+			ld	d,l
+			sub	h
+			ld	l,a
+			ld	a,(hl)
+			cp	c
+			and	a
+			ld	c,b
+			sbc	a,(hl)
+			xor	h
+			ld	e,d
+			add	hl,bc
+			and	d
+			ld	h,a
+			ld	(hl),c
+			ld	e,d
+			ld	(hl),h
+			ld	b,c
+			ld	h,b0h
+			ld	d,e
+			ld	e,afh
+			ld	b,b
+			ld	h,l
+			dec	e
+			ld	d,a
+			rst	28h
+			add	a,a
+			inc	e
+			ld	l,b
+			and	c
+			dec	e
+			ld	h,b
+			ld	e,d
+			ld	c,a
+			jp	(hl)
+			db	95h,65h,57h,b8h,fah,fbh,2eh,6ch
+			db	76h,14h,c1h,47h,a4h,d1h,42h,0fh
+			db	d9h,f2h,62h,d4h,a2h,1fh,afh,a6h
+			db	a2h,fch,73h,dah,22h,a7h,7dh,d7h
+			db	d9h,2bh,b4h,0eh,f8h,dch,fch,07h
+			db	8ch,2bh,06h,beh,dch,d3h,57h,96h
+			db	1eh,efh,42h,10h,fdh,57h,73h,2eh
+			db	a4h,b0h,d6h,09h,63h,21h,d9h,60h
+			db	78h,5fh,14h,23h,feh,4dh,45h,02h
+			db	d0h,1bh,4dh,72h,f9h,5fh,cch,46h
+			db	0dh,53h,31h,9dh,33h,dbh,f2h,03h
+			db	c7h,eeh,45h,88h,6fh,edh,8fh,19h
+			db	4bh,adh,49h,60h,49h,88h,a8h,1ch
+			db	e9h,d4h,b7h,8ch,88h,a3h,b9h,e4h
+			db	6bh,45h,fah,59h,26h,b6h,b2h,80h
+			db	8eh,1ah,f7h,ceh,90h,30h,5ah,6ah
+			db	feh,55h,32h,f6h,eeh,c9h,1bh,fah
+			db	f3h,09h,b1h,18h,12h,2ch,76h,a9h
+			db	19h,c6h,79h,6dh,7fh,afh,99h,87h
+			db	5ch,f1h,a4h,bdh,79h,0ah,ffh,83h
+			db	20h,6bh,32h,47h,b2h,9dh
+			ld	(hl),c
+			ld	a,(hl)
+			ld	c,d
+			ccf
+			set	3,b
+			ld	c,l
+			adc	a,(hl)
+			ret	pe
+			ret	c
+			ret	z
+			add	a,l
+			sub	92h
+			adc	a,15h
+			ld	a,b
+			sbc	a,(hl)
+			ld	h,e
+			call	po,L2104
+			inc	e
+			sub	l
+			rst	28h
+			and	(hl)
+			dec	ixh *
+			rla
+			ld	d,l
+			ld	c,(hl)
+			call	nz,L0b73
+			adc	a,h
+			adc	a,h
+			call	pe,Le8f6
+			ld	hl,2d64h
+			ld	l,ffh
+			ld	d,a
+			xor	c
+			add	a,l
+			sub	(hl)
+			or	(hl)
+			ld	a,(de)
+			pop	af
+			rst	30h
+			cp	h
+			halt
+			xor	47h
+			and	c
+			ld	b,a
+			dec	bc
+			exx
+			ld	(4e97h),hl
+			nop
+			jp	z,Lff81
+			dec	hl
+			add	a,l
+			ld	(hl),e
+			dec	bc
+			ld	(hl),b
+			ld	d,d
+			set	7,d
+			inc	h
+			xor	l
+			and	d
+			add	a,d
+			sub	b
+			ld	h,l
+			ld	h,l
+			rst	30h
+			rst	38h
+			ex	(sp),hl
+			sbc	a,(hl)
+			inc	e
+			jp	nz,La202
+			xor	h
+			ld	h,a
+			ld	hl,edach
+			rst	00h
+			ld	l,9dh
+			ret	nc
+			ret	po
+			and	a
+			jp	nz,Ld5ae
+			ld	a,9eh
+			push	de
+			ld	h,l
+			call	nc,L0f7b
+			ret	nz
+			dec	l
+			and	a
+			ld	h,c
+			add	hl,hl
+			ld	h,a
+			sbc	a,h
+			ld	b,e
+			or	b
+			or	b
+			rst	28h
+			xor	e
+			ld	l,c
+			ex	(sp),hl
+			ld	a,(bc)
+			rst	08h
+			daa
+			ld	l,h
+			ld	a,c1h
+			ld	(87c6h),hl
+			ld	(de),a
+			call	m,L7330
+			cp	e
+			or	a
+			jp	c,L4f05
+			and	(hl)
+			ld	c,l
+			sub	l
+			ld	h,c9h
+			ld	b,b
+			inc	e
+			or	e
+			scf
+			inc	hl
+			add	hl,sp
+			ld	sp,263eh
+			or	h
+			push	af
+			ex	af,af'
+			or	c
+			call	c,L8d5e
+			ld	c,l
+			cp	d
+			ld	h,(hl)
+			ld	b,d
+			sbc	a,c
+			ret	c
+			or	a
+			add	hl,sp
+			ld	e,e
+			ret	nz
+			ld	h,a
+			sub	a
+			ld	(hl),c
+			adc	a,b
+			ld	a,(0f67h)
+			adc	a,a
+			or	5ah
+			add	a,h
+			add	hl,de
+			ld	d,d
+			and	b
+			ld	b,(hl)
+			jr	nz,La202
+			pop	bc
+			ld	d,b
+			ld	b,e
+			call	m,Ldcd6
+			ld	b,d
+			inc	sp
+			ld	e,(hl)
+			jp	pe,Lb1fd
+			rst	10h
+			sbc	a,d
+			ld	d,c
+			ld	l,68h
+			pop	af
+			adc	a,l
+			call	p,Lda02
+			sub	5bh
+			dec	bc
+			ld	l,83h
+			ld	l,l
+			jp	pe,L1e1d
+			ld	c,d
+			ld	de,61cch
+			and	l
+			and	4dh
+			ret
+			db	08h,ach,a9h,05h,b7h,4ch,e9h
+			inc	e
+			ld	e,a
+			sbc	a,b
+			ld	e,(hl)
+			adc	a,h
+			sbc	a,e
+			ld	a,(hl)
+			xor	a
+			ld	c,b
+			inc	bc
+			jr	nc,La297
+			cp	l
+			ld	(de),a
+			pop	de
+			xor	l
+			call	L9e1b
+			ret	p
+			nop (2x) *
+			ld	d,e
+			ld	a,e
+			add	hl,bc
+			ret	nc
+			ld	d,b
+			and	l
+			sbc	a,d
+			ret	nz
+			ex	(sp),hl
+			inc	e
+			call	nc,Ld083
+			ld	e,b
+			ld	(hl),ech
+			ld	d,e
+			call	pe,Led31
+			rst	00h
+			sub	l
+			ret
+			db	beh,70h,4fh,5ch,b4h,2eh,d2h,f2h
+			db	59h,58h,f7h,aah,4fh,07h,efh,08h
+			db	f9h,2fh,12h,e5h,b9h,58h,feh,92h
+			db	c1h,63h
+			or	c
+			ld	a,l
+			call	po,L961e
+			or	l
+			ld	(3aa7h),hl
+			or	ddh
+			inc	sp
+			inc	a
+			call	L6275
+			ld	l,h
+			ccf
+			cp	d
+			rst	18h
+			inc	bc
+			dec	a
+			ld	h,a
+			ld	(hl),a7h
+			ld	l,(hl)
+			cp	e
+			ret	nc
+			ld	c,(hl)
+			ld	h,dah
+			ret	z
+			call	Lba6b
+			xor	d
+			jr	z,La2e8
+			exx
+			ld	e,e
+			add	hl,sp
+			push	de
+			dec	l
+			ld	(e0a3h),hl
+			cp	a
+			in	a,(2fh)
+			call	m,L8571
+			dec	hl
+			ld	e,c
+			rrca
+			nop (2x) *
+			jp	pe,L175a
+			ld	h,28h
+			and	a
+			ld	c,e
+			ret	m
+			ld	a,c
+			ld	l,(hl)
+			ret	pe
+			cp	b
+			dec	(hl)
+			jp	z,L159b
+			jr	nz,La351
+			ld	h,c
+			ld	b,c
+			dec	a
+			ret	pe
+			ld	e,l
+			call	z,L7579
+			ret	m
+			xor	b
+			adc	a,d
+			jp	po,L1a5d
+			cp	l
+			sbc	a,h
+			add	a,b
+			ld	c,95h
+			ld	e,l
+			call	c,Ldc5b
+			ld	c,(hl)
+			jp	m,L2b91
+			add	a,b
+			jr	La36b
+			db	c2h,66h,efh,8fh,98h,2bh,03h,26h
+			db	dah,1ah,fdh,78h,b6h,33h,7ch,73h
+			db	c0h,e4h,23h,43h,e2h,4ah,5fh,cbh
+			db	dbh,d7h,b6h
+			inc	de
+			ld	(hl),6ch
+			dec	hl
+			dec	(hl)
+			dec	b
+			ld	e,b
+			inc	a
+			ld	b,b
+			ld	a,c
+			ld	h,a
+			dec	e
+			ld	e,h
+			ex	de,hl
+			inc	h
+			and	76h
+			xor	e
+			xor	(hl)
+			dec	e
+			ld	e,b
+			ld	bc,f4ceh
+			ld	de,fd17h
+			sbc	a,e
+			ld	l,d
+			dec	(hl)
+			call	p,L160b
+			ld	(hl),e
+			add	a,l
+			ld	a,(hl)
+			jp	(hl)
+			db	0dh,1dh,a1h,d2h,27h,feh,8ah,99h
+			db	62h,f7h,0ch,dch
+			rst	38h
+			ld	e,e
+			rst	38h
+			rst	28h
+			and	ceh
+			ld	b,(hl)
+			rst	30h
+			dec	(hl)
+			or	b
+			jp	p,Lae3e
+			xor	h
+			ld	d,e
+			ld	h,d
+			ld	c,c
+			inc	c
+			ld	hl,(3ec3h)
+			ld	h,4ah
+			ret	m
+			rra
+			add	a,edh
+			pop	hl
+			inc	c
+			or	a
+			jp	pe,L8269
+			ret	pe
+			rst	10h
+			ld	h,e
+			and	dah
+			ret	pe
+			ld	l,h
+			sub	b
+			inc	de
+			ret	nz
+			and	e
+			ld	(bc),a
+			xor	(hl)
+			xor	e
+			ccf
+			ld	h,b
+			xor	c
+			rst	28h
+			cp	iyh *
+			daa
+			sub	l
+			adc	a,l
+			ld	e,a
+			jp	p,Le6e8
+			ld	d,l
+			and	c
+			inc	h
+			ld	a,e
+			ld	e,5eh
+			sbc	a,e
+			inc	c
+			ld	a,b
+			call	p,L80ee
+			add	a,h
+			ld	d,13h
+			or	d
+			ld	c,4fh
+			inc	c
+			or	l
+			call	L919d
+			add	hl,sp
+			or	b
+			ld	e,h
+			and	a
+			add	a,d
+			or	l
+			xor	(hl)
+			cp	d
+			or	a
+			ld	a,l
+			exx
+			jp	c,L62e1
+			dec	c
+			dec	b
+			sbc	a,3fh
+			ld	b,b
+			rst	10h
+			call	nc,L4bc5
+			adc	a,h
+			ld	l,b
+			cpl
+			ld	d,c
+			call	L97a1
+			call	z,L9834
+			add	a,l
+			sbc	a,(hl)
+			dec	bc
+			jr	c,La34b
+			jp	nz,La67f
+			ld	a,(hl)
+			xor	b
+			ld	d,(hl)
+			sub	(hl)
+			ret	z
+			rst	08h
+			sub	e
+			adc	a,h
+			call	z,L12c9
+			ld	a,(bc)
+			call	nz,L759b
+			xor	l
+			xor	a
+			adc	hl,hl
+			dec	bc
+			ld	e,l
+			or	h
+			ld	e,a
+			ex	de,hl
+			dec	(hl)
+			push	de
+			rst	28h
+			ld	l,e
+			halt
+			or	a
+			sub	h
+			and	a
+			or	a
+			ld	h,e
+			ld	d,c
+			and	b
+			call	Lbd5c
+			ld	d,f0h
+			call	z,L4efb
+			ld	d,l
+			ld	a,h
+			call	p,L3c33
+			push	bc
+			ld	e,(hl)
+			ld	d,(hl)
+			add	hl,sp
+			and	b8h
+			inc	e
+			dec	hl
+			add	a,c
+			or	h
+			ld	(hl),h
+			dec	sp
+			ld	h,a
+			inc	a
+			dec	(hl)
+			sub	b
+			rst	18h
+			ei
+			ld	e,a
+			rst	38h
+			rra
+			ld	a,40h
+			cpl
+			daa
+			ld	l,e
+			rst	00h
+			call	z,Le1f1
+			sub	(hl)
+			inc	b
+			ld	(hl),eah
+			ld	sp,20e7h
+			ld	h,f2h
+			ld	a,(3d48h)
+			add	a,a
+			jr	nz,La488
+			and	l
+			jp	L5b8b
+			db	f5h,69h,e4h,c6h,65h,cfh,85h
+			ld	c,b
+			sbc	a,26h
+			jp	nc,L5992
+			and	(hl)
+			adc	a,cah
+			ld	a,(hl)
+			ld	l,a
+			di
+			ld	a,a
+			call	c,L697d
+			adc	a,b
+			add	a,c
+			ld	b,e
+			adc	a,b
+			jr	nz,La401
+			halt
+			adc	a,b
+			rst	00h
+			ld	b,h
+			ld	e,h
+			ld	(hl),a
+			ld	(de),a
+			adc	a,a
+			sbc	a,h
+			ld	d,a
+			ld	(hl),c
+			inc	h
+			inc	a
+			rst	30h
+			ld	e,30h
+			ret	nz
+			and	d
+			ret	p
+			nop
+			sbc	a,61h
+			add	a,h
+			add	a,a
+			ret	nz
+			ld	c,c
+			jp	nc,L6416
+			ld	(de),a
+			pop	hl
+			ld	l,h
+			dec	b
+			ld	b,d
+			ld	c,d
+			ld	(hl),d
+			inc	bc
+			ld	e,(hl)
+			rla
+			ld	a,d
+			ld	l,c
+			adc	a,l
+			ret	c
+			ld	a,b7h
+			and	e
+			cp	l
+			call	z,L11cc
+			dec	l
+			ld	b,0bh
+			ld	hl,(bcfdh)
+			adc	a,b
+			inc	d
+			dec	e
+			sub	h
+			ld	e,b
+			ld	h,c0h
+			sub	(hl)
+			call	c,Lb1a2
+			add	hl,sp
+			ld	l,d
+			add	a,d
+			cp	(hl)
+			ld	l,b
+			inc	sp
+			ld	e,e
+			dec	hl
+			daa
+			adc	a,l
+			inc	de
+			ld	sp,hl
+			ld	(hl),h
+			adc	a,h
+			jr	c,La48b
+			ret	z
+			adc	a,a
+			ld	c,(hl)
+			ld	b,d
+			ld	d,86h
+			add	hl,de
+			halt
+			and	h
+			call	p,L9f07
+			rst	10h
+			ld	b,d
+			ld	c,(hl)
+			ld	(de),a
+			nop
+			ccf
+			ld	de,b8beh
+			ld	h,d
+			inc	(hl)
+			ret	pe
+			xor	83h
+			ex	(sp),hl
+			cp	(hl)
+			add	a,d
+			ld	b,b
+			ld	d,a8h
+			ld	de,4432h
+			ex	af,af'
+			dec	c
+			xor	c
+			ld	e,a
+			ld	(hl),f2h
+			add	a,(hl)
+			ld	c,c
+			ld	h,e
+			ld	c,h
+			jp	nc,La97b
+			sbc	a,e
+			ex	af,af'
+			adc	a,c
+			jp	p,L0aab
+			inc	(hl)
+			or	b
+			sub	b
+			dec	de
+			xor	e
+			ld	a,e
+			rla
+			sub	c
+			ex	(sp),hl
+			jr	nc,La4ad
+			ld	sp,929eh
+			cpl
+			adc	a,l
+			jp	z,L09a6
+			ret	m
+			ld	l,d
+			or	h
+			ld	c,l
+			and	e
+			halt
+			jp	po,Ld100
+			inc	bc
+			halt
+			inc	h
+			dec	de
+			cp	d
+			ld	a,d
+			adc	a,(hl)
+			ld	b,l
+			inc	bc
+			call	c,L3489
+			sbc	a,(hl)
+			cp	c
+			cp	l
+			rst	00h
+			ld	l,e
+			ld	d,h
+			and	e
+			sub	l
+			ld	a,(hl)
+			ld	c,(hl)
+			cp	c
+			jp	nc,La31a
+			call	nc,L2ae2
+			add	a,h
+			pop	hl
+			jp	nz,L6677
+			rst	18h
+			inc	h
+			inc	d
+			ld	c,efh
+			sbc	a,b
+			sbc	a,dfh
+			xor	h
+			jp	nc,Lf139
+			nop (2x) *
+			dec	e
+			ld	l,c
+			ld	(hl),h
+			bit	7,(hl)
+			ld	(de),a
+			exx
+			ld	b,l
+			dec	l
+			cp	l
+			jp	nc,L5ac8
+			adc	a,l
+			ld	(hl),d
+			and	(hl)
+			and	a
+			ret	nz
+			call	z,Ld07f
+			ld	(hl),e
+			call	L37f0
+			add	hl,sp
+			sbc	a,e
+			ld	c,e
+			nop
+			ld	(hl),b
+			jp	c,L0388
+			rst	10h
+			ld	d,e
+			ld	(7227h),a
+			sbc	a,l
+			add	a,a
+			cp	b
+			inc	b
+			nop (2x) *
+			adc	a,e
+			ld	d,(hl)
+			ld	b,d
+			ld	c,h
+			jp	m,L3034
+			ccf
+			adc	a,d
+			ret	c
+			ld	(3cd8h),a
+			ld	e,d
+			ld	e,7bh
+			jr	nz,La57c
+			ld	(hl),b
+			out	(c),e
+			jp	p,Lb785
+			add	a,h
+			ld	a,(de)
+			ld	a,c
+			ld	a,l
+			jp	p,L6c42
+			sub	l
+			rst	28h
+			ld	a,(de)
+			inc	de
+			xor	l
+			and	e
+			rrca
+			and	d
+			rla
+			adc	a,(hl)
+			nop (2x) *
+			inc	d
+			ld	a,f1h
+			push	de
+			ld	h,(hl)
+			rst	38h
+			dec	a
+			ld	(hl),c
+			ld	e,a
+			exx
+			rst	00h
+			ld	(de),a
+			add	a,e
+			ld	(hl),e
+			adc	a,b
+			ex	de,hl
+			jp	(hl)
+			db	56h,07h,eeh,6bh,15h,28h,bfh,67h
+			db	adh,00h,99h,47h,d7h,efh,8dh,d0h
+			db	e5h,41h,ddh,2bh,c1h,bfh,59h,d5h
+			db	bah,a1h,96h,2bh,b8h,c4h,c2h,31h
+			db	a8h,f1h,46h,49h,36h,74h,37h,2eh
+			db	9bh,33h,32h,41h,d3h,93h,bdh,ceh
+			db	4bh,7ch,ech,5ch,27h,9eh,7eh,60h
+			db	32h,b0h,feh,02h,10h,0bh,b6h,99h
+			db	9fh,2bh,2dh,29h,a3h,c4h,a3h,48h
+			db	00h,82h,45h,00h,68h,c5h,edh,9eh
+			db	d9h,cch,ebh,a6h,87h,ffh,5fh,68h
+			db	1fh,abh,b0h,06h,40h,f1h,b9h,97h
+			db	00h,48h,9eh,3dh,63h,14h,b9h,12h
+			db	c8h,4ch,cbh,aah,3dh,e9h,94h,5ah
+			db	d4h,2fh,25h,dbh,cah,d9h,40h,1ch
+			db	b2h,01h,1bh,eeh,28h,2eh,3eh,23h
+			db	63h,5eh,86h,69h,7eh,9ah,42h,aeh
+			db	88h,94h,b6h,c8h,4ah,a3h,f7h
+			ld	b,c
+			ld	b,e
+			jp	z,Lc320
+			sub	c
+			cp	c
+			call	nc,Lcb1a
+			cp	b
+			inc	l
+			or	b
+			ld	a,c
+			ld	d,b
+			push	hl
+			sub	a
+			ld	c,e
+			ld	l,l
+			ld	c,(hl)
+			ld	c,c
+			push	de
+			sub	87h
+			add	a,e
+			sbc	a,c
+			adc	a,e
+			ld	l,h
+			cp	h
+			jp	c,L2c89
+			ret	nz
+			ret	c
+			sbc	a,1bh
+			inc	l
+			sub	fbh
+			or	b
+			ld	e,(hl)
+			and	h
+			cp	(hl)
+			inc	c
+			dec	d
+			xor	d
+			sbc	a,d
+			xor	cah
+			jp	nc,Lf1e8
+			adc	a,b
+			ld	(hl),l
+			ret	nz
+			and	a
+			xor	h
+			and	2eh
+			ld	a,a
+			jr	nc,La6c2
+			ld	l,(hl)
+			xor	c
+			ld	hl,(a0b2h)
+			dec	a
+			ld	d,b
+			ld	l,l
+			ld	(de),a
+			xor	c
+			ex	af,af'
+			inc	a
+			ld	a,b
+			jp	p,L9f89
+			push	de
+			sub	b
+			call	nz,Le5b7
+			jp	(hl)
+			db	62h,36h,0dh,f9h,9ch,94h,63h,a7h
+			db	f7h,33h,7bh,9eh,85h,73h,94h,0ch
+			db	15h,c1h,8eh,1ah,fah,49h,44h,67h
+			db	70h,cch,dah
+			ld	e,l
+			add	a,l
+			dec	a
+			set	4,e
+			add	a,h
+			ld	d,(hl)
+			ld	b,d
+			ccf
+			and	e
+			dec	sp
+			ret	nz
+			and	c
+			ld	e,h
+			ld	a,(8c53h)
+			and	b
+			push	hl
+			ld	e,e
+			add	a,b
+			sub	h
+			pop	hl
+			ld	e,h
+			ld	a,b
+			cp	(hl)
+			ld	e,47h
+			jp	nc,L9d55
+			add	a,a
+			xor	8bh
+			and	e
+			halt
+			ld	d,b
+			ld	c,a
+			ld	l,59h
+			and	b
+			ld	h,c
+			cp	e
+			pop	bc
+			ld	d,d
+			sbc	a,48h
+			add	a,b
+			inc	sp
+			adc	a,ach
+			sub	e
+			ld	d,l
+			ld	b,b
+			ld	l,h
+			jr	La737
+			db	03h,56h,e1h,2ah,c1h,ach,b5h,93h
+			db	85h,2fh
+			ld	e,d
+			halt
+			ld	a,(bc)
+			call	c,Le007
+			jp	(hl)
+			db	d8h,8bh,c9h,13h,b4h,65h,8fh,c6h
+			db	2fh,5dh,2dh,cch,deh,5fh,9ch,94h
+			db	eeh,43h,41h,93h,c6h,6bh,97h,2bh
+			db	2eh,61h,58h,afh,97h,79h,e0h,41h
+			db	f5h,8ah,83h,41h,cdh,94h,24h,7fh
+			db	c9h,49h,0bh,5ch,0eh,f0h,0bh,ceh
+			db	cbh,29h,34h
+			ret	p
+			inc	c
+			ld	e,b
+			ld	sp,hl
+			jr	nc,La72b
+			dec	hl
+			ld	a,b
+			call	pe,L52bc
+			ld	c,(hl)
+			rra
+			xor	e
+			cpl
+			adc	a,h
+			ld	(705bh),a
+			ld	c,aeh
+			ld	e,c
+			sub	l
+			ld	a,7bh
+			cp	b
+			jp	m,Lbe3a
+			push	hl
+			ld	(hl),h
+			and	d
+			xor	a
+			ld	a,d
+			ret	po
+			sub	c
+			ld	a,(hl)
+			ld	d,a
+			ld	(hl),d
+			djnz	La79f
+			rst	20h
+			ld	l,d
+			sub	e
+			ld	a,h
+			ld	h,0eh
+			ld	(hl),53h
+			sub	c
+			ld	l,(hl)
+			ld	(de),a
+			add	a,e
+			sub	c
+			ld	h,a
+			ret	po
+			sbc	a,e
+			sub	l
+			sub	b
+			dec	l
+			jp	m,L791d
+			ld	d,c
+			call	po,L943e
+			djnz	La6fc
+			djnz	La714
+			ld	c,c
+			ld	c,c
+			ld	(hl),b
+			add	hl,hl
+			ret	pe
+			ld	h,d
+			add	a,e
+			rst	20h
+			sub	e
+			ld	c,d
+			ld	e,h
+			xor	e
+			ld	b,l
+			ld	c,9ah
+			or	a
+			adc	a,(hl)
+			dec	d
+			ret	nz
+			ld	e,iyh *
+			ld	(hl),d
+			out	(09h),a
+			xor	d
+			rst	20h
+			ret	pe
+			ld	c,a
+			ld	(bc),a
+			sub	c8h
+			inc	l
+			dec	c
+			ld	l,c
+			ld	a,(de)
+			rst	28h
+			or	h
+			ld	d,(hl)
+			call	p,L93fb
+			ld	h,dch
+			ld	e,l
+			ld	l,c
+			jp	Lf33e
+			db	87h,5dh,b9h,a5h,4dh,2bh,d7h,77h
+			db	ech,74h,23h,1dh,1fh,44h,d3h,fch
+			db	f3h,5dh,24h,ffh,63h,1ah,e2h,31h
+			db	35h,d3h,d7h,21h,b6h,42h,32h,01h
+			db	7bh,afh,70h,a9h,aah,aeh,6ah,a3h
+			db	6bh,adh,33h,75h
+			ld	(717ah),hl
+			ld	e,(hl)
+			jp	nz,Labfe
+			dec	de
+			push	bc
+			or	l
+			add	a,c
+			ld	l,l
+			nop (2x) *
+			rst	00h
+			ld	a,c
+			ret
+			db	0ah,9ah,9fh,37h,79h,b8h,1fh,e6h
+			db	32h,05h,17h,b8h,02h,cdh,21h,bah
+			db	eeh,dch,d6h,35h,37h,ceh
+			xor	h
+			adc	a,c
+			jp	c,L8d9e
+			ld	h,l
+			xor	h
+			ret	po
+			adc	a,a
+			ld	l,d
+			sbc	a,d
+			add	a,a
+			ld	h,c
+			ld	b,45h
+			call	p,L726a
+			ccf
+			ld	b,b
+			inc	b
+			ld	a,l
+			jp	c,Lf4bf
+			adc	a,a
+			ld	(hl),67h
+			jp	nc,L01cb
+			ld	h,02h
+			cp	b
+			rra
+			ret	po
+			ld	e,c
+			ld	b,(hl)
+			ld	a,b
+			ld	a,(hl)
+			or	c
+			inc	e
+			and	(hl)
+			ld	e,a
+			ld	b,b
+			ld	l,c
+			add	a,d
+			ld	b,e
+			ld	bc,401eh
+			xor	a
+			ld	l,(hl)
+			ld	(de),a
+			rst	28h
+			ld	e,b
+			exx
+			add	a,c
+			ex	de,hl
+			add	a,h
+			jr	nc,La7c9
+			rra
+			rst	18h
+			ld	h,(hl)
+			add	a,a
+			djnz	La7e4
+			ccf
+			ld	l,b
+			ld	(hl),c
+			sub	c
+			add	a,a
+			ld	b,(hl)
+			ld	d,c
+			xor	(hl)
+			ret	nz
+			sub	e
+			inc	e
+			dec	hl
+			xor	(hl)
+			ld	(hl),c
+			ld	c,h
+			scf
+			call	pe,L57e4
+			cp	e
+			ld	l,(hl)
+			ld	a,b
+			and	(hl)
+			ld	l,d
+			or	d
+			sbc	a,b
+			push	bc
+			and	h
+			nop (2x) *
+			xor	d
+			or	bah
+			ld	a,h
+			pop	bc
+			or	15h
+			adc	a,(hl)
+			sbc	a,e
+			ld	h,c
+			dec	l
+			scf
+			ld	e,h
+			dec	sp
+			ld	h,(hl)
+			ld	c,d
+			add	a,b
+			ret	pe
+			ret	po
+			ld	a,h
+			ld	b,h
+			ld	e,d
+			jp	z,Ld66e
+			jp	pe,L1e05
+			nop (2x) *
+			inc	bc
+			jr	La83c
+			db	a1h,93h,54h,6dh,76h,fah,46h,4eh
+			db	8dh,85h,fdh,8bh,ceh,00h,e6h,99h
+			db	d0h,57h,81h,b2h,ddh,f4h,13h,8ah
+			db	01h,4fh,3bh,fah,00h,3eh,20h,8fh
+			db	10h,c8h,a1h,2ah,83h,35h,59h,5eh
+			db	cah,65h,c1h,2bh,02h,33h,8dh,36h
+			db	c3h,fah,2eh,71h,59h,cbh,76h,94h
+			db	06h,0eh,3dh,97h,46h,65h,35h,dbh
+			db	e7h,e4h,96h,72h,adh,85h,bbh,7eh
+			db	e6h
+			ret	nz
+			ret
+			db	07h,4ah,c7h,60h,2bh,92h,0eh,2ah
+			db	59h,e6h,d3h,33h,3bh,5bh,e7h,a3h
+			db	88h,98h,83h,efh
+			ret	z
+			ld	d,a3h
+			rst	28h
+			ld	c,b
+			rla
+			ld	h,h
+			sbc	a,d
+			dec	c
+			ld	c,h
+			ld	e,b
+			ld	d,h
+			jp	p,L3831
+			xor	c
+			or	77h
+			rst	10h
+			and	(hl)
+			ld	e,d
+			ld	h,b
+			push	de
+			ei
+			or	e
+			or	l
+			and	b
+			ex	(sp),hl
+			adc	a,b
+			and	l
+			or	b
+			ld	b,d
+			add	a,h
+			ret
+			db	18h,e7h,e7h,91h,9fh,66h,38h,f5h
+			db	82h
+			ld	c,l
+			rst	18h
+			nop (2x) *
+			ret
+			db	58h,55h,93h,72h,2ch,0bh,71h
+			call	m,L4621
+			jp	m,L8939
+			ld	d,h
+			sbc	a,(hl)
+			inc	de
+			cp	e
+			ld	l,e
+			ld	de,d391h
+			ld	a,(bc)
+			ld	d,(hl)
+			and	b
+			ccf
+			ld	(hl),b
+			jp	c,Lecd5
+			dec	(hl)
+			pop	af
+			sbc	a,(hl)
+			cpl
+			ld	c,a
+			rst	30h
+			xor	d
+			ld	l,e
+			and	d
+			rst	08h
+			jp	po,L306b
+			jr	nc,La911
+			cp	d
+			ld	c,h
+			inc	h
+			jp	nc,L052c
+			ld	d,c
+			ld	c,a
+			sbc	a,l
+			djnz	La8a5
+			cp	c
+			ld	b,(hl)
+			res	7,a
+			jp	nz,L6df9
+			ld	b,a
+			xor	c
+			inc	de
+			jp	nc,L8cd9
+			add	a,a
+			ld	b,f7h
+			ld	d,e
+			dec	sp
+			jr	nc,La8d0
+			inc	sp
+			adc	a,(hl)
+			sub	l
+			or	d
+			jp	p,L1ea6
+			add	a,b
+			pop	af
+			xor	e
+			ld	l,d
+			ld	bc,b2b4h
+			jr	z,La98a
+			rst	10h
+			ld	d,b
+			inc	c
+			ei
+			and	(hl)
+			ld	a,l
+			jr	nz,La970
+			and	d
+			rst	08h
+			ld	c,e
+			rst	10h
+			ld	d,(hl)
+			dec	hl
+			sub	(hl)
+			jr	La99f
+			db	2ch,00h,7ah,25h,60h,ech
+			inc	bc
+			and	(hl)
+			inc	l
+			sbc	a,h
+			rst	30h
+			ld	c,l
+			and	f1h
+			ld	e,c
+			xor	(hl)
+			cp	l
+			xor	e
+			or	c
+			xor	b
+			and	c
+			or	e
+			jp	pe,L7bd3
+			ld	e,e
+			ld	c,b
+			and	c
+			ld	(hl),e
+			sbc	a,c
+			ret	z
+			sbc	a,b
+			rlca
+			xor	(hl)
+			dec	(hl)
+			ld	l,h
+			ld	(hl),h
+			inc	c
+			di
+			rra
+			ld	e,a
+			sbc	a,a
+			dec	b
+			sub	l
+			ld	a,h
+			exx
+			sbc	a,h
+			or	h
+			exx
+			sbc	a,a
+			ret	nc
+			ld	h,a0h
+			dec	de
+			ld	h,b
+			or	l
+			ld	d,c
+			inc	sp
+			ex	de,hl
+			ld	c,(hl)
+			jp	p,L6963
+			ld	(hl),d
+			sub	c
+			ld	l,d
+			ld	d,h
+			ld	d,(hl)
+			ex	de,hl
+			sbc	a,e
+			ld	(de),a
+			sub	d
+			ret	c
+			inc	l
+			ld	l,h
+			ret	z
+			ld	(bc),a
+			inc	a
+			ld	d,h
+			dec	b
+			sbc	a,c
+			adc	a,d
+			adc	a,e
+			pop	af
+			rst	20h
+			ld	h,h
+			sbc	a,7fh
+			or	d
+			dec	a
+			inc	l
+			ret	m
+			ld	a,l
+			inc	hl
+			inc	a
+			sub	dbh
+			add	a,l
+			dec	b
+			rst	08h
+			ld	e,(hl)
+			sbc	a,e
+			inc	d
+			ld	c,d
+			jp	nz,L0d31
+			sub	d
+			or	c
+			sub	l
+			jp	z,L310d
+			ld	sp,hl
+			inc	c
+			add	a,e
+			or	b
+			ld	l,b
+			ld	c,a
+			sbc	a,e
+			ld	h,97h
+			ld	(hl),e
+			ld	e,afh
+			ld	c,(hl)
+			inc	b
+			ld	bc,67d3h
+			cp	h
+			call	p,L0eb3
+			ld	a,l
+			and	l
+			xor	a
+			ld	a,h
+			xor	c
+			add	a,e
+			cp	l
+			or	l
+			and	ixl *
+			inc	l
+			jp	c,L1325
+			xor	(hl)
+			nop
+			push	hl
+			cp	c
+			ld	e,h
+			ld	hl,(2091h)
+			dec	a
+			push	hl
+			dec	a
+			and	c
+			ld	h,77h
+			cp	b
+			ld	c,a
+			call	pe,L03a2
+			ld	hl,1510h
+			sbc	a,a
+			call	z,Ldac1
+			ld	l,(hl)
+			inc	hl
+			add	hl,de
+			ret	po
+			ccf
+			or	b3h
+			ld	(hl),e
+			ld	e,l
+			ld	bc,aa40h
+			dec	bc
+			ld	(hl),c
+			ex	de,hl
+			cp	e
+			ld	d,h
+			sbc	a,e
+			call	nz,Lf349
+			out	(d1h),a
+			xor	d
+			ld	(hl),l
+			jr	c,Laa6f
+			push	de
+			cp	d
+			pop	de
+			adc	a,(hl)
+			inc	l
+			ld	h,d
+			add	a,d
+			rst	30h
+			ei
+			inc	hl
+			ld	h,6dh
+			cpl
+			dec	a
+			ei
+			halt
+			and	a
+			ld	(hl),c
+			or	f8h
+			and	(hl)
+			scf
+			jp	Le848
+			db	3bh,3dh,d9h,d7h,b3h,5fh,4fh,8dh
+			db	1fh,d0h,50h,12h,41h,d4h,dbh,19h
+			db	07h,6fh,72h,b7h,afh,51h,42h,47h
+			db	a2h,b9h,edh,58h,90h,90h,50h,07h
+			db	82h,c6h,55h,7dh,1bh,85h,1ah,3bh
+			db	e5h,9fh,3eh,cdh,15h,a4h,85h,12h
+			db	56h,7eh,42h,cdh,e1h,afh,e9h,a2h
+			db	4eh,71h,c3h,ech,86h,54h,d2h,6ah
+			db	3ah,ddh,14h,c8h,c8h,d1h,76h,b8h
+			db	44h,bfh,46h,a1h,f3h
+			inc	c
+			or	86h
+			ret	nz
+			cp	h
+			ld	b,l
+			ld	hl,4775h
+			di
+			ld	h,c
+			ld	e,l
+			ld	a,(hl)
+			inc	a
+			ret	po
+			cp	c
+			cp	(hl)
+			ld	h,8eh
+			inc	l
+			ret
+			db	c7h,53h,88h,15h,7eh,b7h,d3h,03h
+			db	0ah,70h,03h,b4h,4eh,86h,04h,25h
+			db	cfh,9eh,bbh,5fh,58h,4eh,5ah,d7h
+			db	c2h,efh,75h,1fh,42h,2fh,a8h,f1h
+			db	1ah,4dh,86h,d6h,84h,d7h,b9h,9dh
+			db	17h,c6h,eeh,2ch,efh,ebh,5bh,0ch
+			rst	18h
+			sub	h
+			ret	nc
+			inc	a
+			add	a,a
+			rra
+			call	m,Le070
+			call	c,L7924
+			ld	h,e
+			xor	(hl)
+			and	l
+			ld	b,e
+			xor	d
+			ld	c,a
+			cp	b
+			ld	a,(de)
+			jp	z,L9eb5
+			ld	b,e
+			ret	m
+			ld	h,87h
+			ld	(hl),h
+			ld	de,b1a0h
+			ld	b,d
+			ld	l,l
+			ret	po
+			ret	po
+			add	hl,de
+			adc	a,e
+			inc	e
+			ld	hl,(bb67h)
+			ld	c,c
+			ld	(hl),b
+			adc	a,a
+			add	a,d
+			jp	(hl)
+			db	cah,f6h,c4h,71h,74h,59h,74h,0ah
+			db	43h,09h,58h,5ch,a8h,16h
+			ld	c,h
+			ld	e,e
+			ld	c,h
+			rl	h
+			ld	c,d
+			jp	po,L4c00
+			ld	sp,ba0dh
+			push	af
+			rst	08h
+			ld	l,l
+			call	nc,Lfbf4
+			ret	po
+			call	z,Lb372
+			and	b
+			rst	08h
+			dec	h
+			or	74h
+			ld	e,(hl)
+			inc	h
+			ld	c,h
+			sub	b6h
+			call	pe,L3408
+			ld	d,b
+			dec	de
+			rst	30h
+			sub	e2h
+			ld	sp,hl
+			ld	a,d
+			ld	e,b
+			out	(00h),a
+			call	nz,L412e
+			jp	po,L3731
+			ld	l,c
+			adc	a,91h
+			ld	l,e
+			rst	08h
+			dec	l
+			pop	hl
+			ld	c,h
+			dec	d
+			jr	nz,Laaf0
+			xor	(hl)
+			ret	p
+			add	hl,hl
+			xor	60h
+			xor	(hl)
+			call	z,L8551
+			adc	a,d
+			and	l
+			ld	c,88h
+			ld	h,a
+			or	a
+			and	l
+			sbc	a,a
+			ld	(hl),a
+			ld	d,h
+			rla
+			sub	b
+			dec	e
+			ld	l,a
+			ld	l,a
+			ret	nc
+			dec	b
+			ld	hl,(9d09h)
+			dec	a
+			add	a,l
+			jp	nc,L1afd
+			xor	a
+			ei
+			ld	(hl),e
+			ccf
+			rst	10h
+			adc	a,03h
+			ld	c,a
+			rst	08h
+			ld	l,c
+			inc	a
+			call	pe,L7397
+			cp	l
+			add	a,b
+			call	nz,Lf8d9
+			add	a,l
+			sbc	a,a
+			ccf
+			ld	(de),a
+			ret	nz
+			sbc	a,l
+			or	h
+			ret	nc
+			sbc	a,h
+			ld	b,e
+			rst	10h
+			ld	(hl),e
+			and	(hl)
+			ld	l,b
+			ld	c,l
+			call	nz,Leabd
+			adc	a,h
+			cp	(hl)
+			cp	d
+			rla
+			jr	c,Lab34
+			dec	de
+			ld	b,l
+			dec	a
+			call	nc,Lab06
+			ld	h,h
+			in	a,(47h)
+			or	l
+			xor	e
+			rst	20h
+			ld	(hl),a
+			adc	a,d
+			call	nc,L8c47
+			ld	de,a16ah
+			dec	hl
+			ei
+			inc	e
+			dec	c
+			ld	b,e
+			ld	e,c
+			ld	h,c
+			and	b
+			jp	Lef3e
+			db	bdh,9ch,0fh,e1h,76h,f8h,88h,30h
+			db	96h,62h,f0h,ddh,e6h,deh,76h,cbh
+			db	dbh,adh,76h,85h,bfh,f3h,11h,5fh
+			db	efh,a1h,2fh,48h,68h,9dh,25h,7ch
+			db	2ah,5fh,94h,04h,c7h,5ch,1dh,7ch
+			db	91h,d8h,52h,7ah,94h,4ah,1bh,8ch
+			db	89h,69h,a8h,29h,76h,ceh,e4h,d0h
+			db	d2h,5bh,cch,34h,bfh,11h,08h,ddh
+			db	9dh,1dh,84h,84h,17h,20h,b7h,17h
+			db	fdh,d7h,9bh,e0h,47h,60h,56h,24h
+			db	72h,82h,26h,43h,02h,72h,4eh,82h
+			db	ddh,3bh,d6h,79h,a6h,feh,83h,fbh
+			db	64h,03h,40h,1dh
+			di
+			jr	nz,Lac3b
+			ld	l,a
+			ld	d,e
+			cp	b
+			and	d
+			cp	(hl)
+			rst	18h
+			add	a,h
+			adc	a,a
+			ld	d,a
+			ld	d,c
+			ld	d,87h
+			ret	pe
+			nop
+			jp	(hl)
+			db	cah,a9h,86h,aeh,ffh,c1h,35h,51h
+			db	2ah,d8h,a7h,eeh,fah,99h,65h,39h
+			db	e9h,74h
+			push	bc
+			add	hl,bc
+			and	l
+			and	b
+			or	l
+			add	hl,de
+			push	hl
+			ld	(de),a
+			cpl
+			adc	a,d
+			adc	a,d
+			ld	c,h
+			ret	p
+			call	pe,L39bd
+			set	0,a
+			jp	nc,Lac01
+			add	a,28h
+			ld	c,l
+			ld	l,5ch
+			cp	h
+			adc	a,h
+			ld	a,e
+			ld	e,d
+			ld	b,(hl)
+			adc	a,b
+			ld	d,b
+			ret
+			db	f1h,a3h,48h,ffh,3fh,6ch
+			sbc	a,d
+			ld	c,l
+			jp	c,Ldae7
+			jp	po,Lbad2
+			adc	a,(hl)
+			or	c
+			ld	c,h
+			push	de
+			or	c
+			ld	l,c
+			ex	de,hl
+			sbc	a,3dh
+			add	a,h
+			rst	30h
+			and	h
+			ret	nc
+			jp	po,Lf0a1
+			and	19h
+			rst	38h
+			sbc	a,h
+			sub	l
+			sub	(hl)
+			rrca
+			rra
+			rst	00h
+			inc	d
+			dec	sp
+			ld	e,b
+			inc	a
+			ld	(hl),a
+			dec	de
+			ld	h,aah
+			ld	(hl),e
+			and	(hl)
+			call	po,Le86b
+			dec	c
+			ret
+			db	aah,40h,60h,55h,2bh,96h,18h,bbh
+			db	6ch,b8h,b7h,8ch,02h,e6h,7ah,7dh
+			db	c6h,2bh,3dh,ech,76h,4ah,a6h,d2h
+			db	67h,76h,12h,aah,bfh,ddh,0bh,50h
+			db	f3h,5ah,79h,12h,7bh,c2h,fch,b8h
+			db	0fh,4bh,74h,fdh,65h,44h,e9h,3eh
+			db	37h,b1h,beh,feh,f0h,d0h,55h,66h
+			db	4eh,48h,74h,8eh,ebh,4ah,5eh,69h
+			db	1dh,2fh,bah,36h,5eh,06h,c7h,78h
+			db	8ah,9bh,ffh,aah,d5h,fbh,40h,b9h
+			db	72h,9eh,9bh,d6h,ebh,0fh,25h,f0h
+			db	35h,8fh,7bh,52h,11h,5ah,efh,74h
+			db	b9h,9ch,94h,70h,9fh,d1h,47h,3ch
+			db	0dh,2dh,13h,6fh,ffh,3fh,bch,fah
+			db	6ah,67h,99h,a5h,77h,9ah,f1h,f8h
+			db	8ch,00h,6bh,a4h,94h,d9h,07h,64h
+			db	15h,f0h,c5h,bbh,70h,0dh,83h,cfh
+			db	edh,dah,49h,87h,8ah,7fh,dch,c2h
+			db	ffh,9ch,4eh,d2h,20h,7ch
+			ld	h,l
+			ld	a,(bc)
+			ld	c,(hl)
+			sbc	a,a
+			xor	(hl)
+			cp	l
+			rla
+			inc	de
+			rst	20h
+			rst	20h
+			ret	po
+			and	b
+			di
+			adc	a,(hl)
+			and	61h
+			add	a,h
+			nop
+			inc	l
+			ld	a,c
+			rra
+			xor	e
+			ld	h,c
+			rst	38h
+			xor	e
+			cp	d
+			pop	de
+			and	h
+			sub	b
+			inc	b
+			add	a,l
+			ld	(hl),a
+			cp	e
+			ld	(hl),d
+			add	a,a
+			halt
+			ld	b,96h
+			rlca
+			ld	(bc),a
+			out	(93h),a
+			cp	c
+			cp	h
+			and	l
+			ei
+			xor	a
+			ld	a,c
+			or	h
+			sub	(hl)
+			xor	(hl)
+			or	h
+			adc	a,a4h
+			inc	l
+			ld	c,e
+			xor	b
+			rlca
+			ret
+			db	f0h,27h,36h,57h,4ch,9eh,3dh,05h
+			db	64h,c4h,86h,67h
+			cp	f9h
+			xor	e
+			push	de
+			ld	b,d
+			add	a,b
+			or	a
+			cp	c
+			dec	bc
+			push	af
+			ld	sp,9c49h
+			ld	l,d
+			ld	h,c
+			cp	e
+			ld	l,d
+			ld	d,h
+			add	a,(hl)
+			jp	L1a29
+			db	6eh,feh,5dh,39h,aah,82h
+			push	af
+			call	p,L790a
+			ld	h,a
+			ld	l,6bh
+			ld	c,(hl)
+			call	m,L2bd3
+			ld	d,b
+			ld	(hl),a
+			cp	l
+			or	l
+			ld	h,d
+			jr	nz,Ladad
+			add	hl,sp
+			add	hl,bc
+			jr	c,Laddf
+			xor	b
+			rrca
+			add	hl,hl
+			in	a,(57h)
+			ld	h,(hl)
+			add	hl,bc
+			rst	10h
+			ret	c
+			ld	e,b
+			ld	c,(hl)
+			ld	(hl),b
+			ret	pe
+			ld	b,e
+			jp	nc,L6585
+			sub	e
+			rst	10h
+			sub	e
+			call	z,Ld47f
+			ld	b,d
+			adc	a,d
+			call	nc,L13ea
+			or	b
+			ld	c,c
+			ld	a,b
+			ld	e,a
+			sbc	a,c
+			ld	h,a
+			ld	b,c
+			cp	e
+			ld	a,e
+			inc	(hl)
+			dec	l
+			call	pe,L8007
+			and	e
+			rra
+			cp	(hl)
+			call	nc,L64a0
+			or	9fh
+			add	a,(hl)
+			ld	l,a
+			pop	hl
+			ret	p
+			sub	d
+			add	a,c
+			daa
+			ld	b,b
+			ld	e,iyl *
+			sbc	a,c
+			sub	h
+			add	a,e
+			ld	d,e
+			call	m,Lb722
+			sbc	a,e
+			jr	z,Ladcc
+			or	a
+			jp	p,L05ea
+			ld	c,d
+			dec	c
+			push	bc
+			ld	e,c
+			jp	pe,Lf56e
+			ld	b,l
+			ret	nz
+			ld	l,d
+			and	e2h
+			ld	d,(hl)
+			add	a,b
+			inc	e
+			ld	de,2f32h
+			call	po,L35e5
+			and	e
+			cpl
+			ld	sp,iy
+			adc	a,c
+			ld	d,(hl)
+			jp	nz,L1860
+			and	(hl)
+			dec	hl
+			inc	bc
+			sub	c
+			or	d
+			set	6,l
+			ret	z
+			ld	c,9ah
+			cp	h
+			add	a,ffh
+			add	a,e
+			djnz	Lade6
+			sbc	a,c
+			sbc	a,d
+			or	l
+			ld	bc,81eah
+			ld	c,c
+			dec	bc
+			sbc	a,a
+			ld	a,d
+			ld	e,e
+			dec	de
+			or	b
+			add	a,h
+			jr	nc,Lae20
+			inc	de
+			ld	(f3fdh),a
+			push	af
+			rst	30h
+			ld	h,b
+			dec	d
+			rra
+			or	d
+			ld	(hl),c
+			ld	l,b
+			ld	d,a
+			ei
+			ld	h,b
+			ld	(20f2h),a
+			ld	h,d
+			ld	b,eeh
+			ld	hl,(e38bh)
+			ld	l,(hl)
+			adc	a,l
+			ld	(hl),c
+			out	(bbh),a
+			call	z,L1500
+			adc	a,9bh
+			ld	a,h
+			adc	a,h
+			jp	z,L194d
+			ld	(hl),l
+			ld	b,e
+			xor	c
+			ld	c,(hl)
+			ld	(hl),a3h
+			ld	b,(hl)
+			nop
+			rst	38h
+			adc	a,a
+			push	hl
+			ld	e,d
+			ld	l,d
+			ld	e,e
+			dec	bc
+			jp	z,L9305
+			cp	a
+			or	e
+			daa
+			xor	a
+			sub	a
+			ld	d,c
+			rst	38h
+			ld	a,e
+			ld	c,b
+			ret	po
+			ld	a,(de)
+			ld	a,b
+			add	a,c
+			ld	e,b
+			ld	l,l
+			call	c,L5a3a
+			xor	d
+			cp	(hl)
+			ret	pe
+			sub	(hl)
+			jr	nc,Laea0
+			ld	e,c
+			adc	a,h
+			jr	Laed1
+			db	f5h,c6h,c7h,adh,20h,9dh,73h,ddh
+			db	30h,ech,dch,5dh,65h,65h,3eh,f2h
+			db	15h,6fh,e3h,14h,70h,57h,a0h,09h
+			db	cch,46h,3fh,4eh,e9h,25h,49h,1eh
+			db	17h,3eh,48h,5ch,99h,4dh,eah,1ah
+			db	bch,35h,a4h,5fh,6bh,17h,9ah,0fh
+			db	dch,7ch,16h,f5h,a9h,42h,a9h,9ah
+			db	39h,76h
+			dec	a
+			xor	(hl)
+			cp	b
+			ld	a,(de)
+			adc	a,c
+			in	a,(0ch)
+			pop	hl
+			dec	de
+			sub	e
+			ld	c,e
+			dec	c
+			ld	l,(hl)
+			inc	c
+			dec	h
+			ld	a,d
+			ld	e,(hl)
+			ld	h,h
+			ld	h,b
+			call	pe,L0fb9
+			ld	c,l
+			exx
+			ld	c,c
+			nop (2x) *
+			ld	d,e
+			adc	a,l
+			ld	e,(hl)
+			dec	(hl)
+			sbc	a,e
+			call	L65a3
+			ld	c,28h
+			add	a,d
+			sub	(hl)
+			ld	l,d
+			ld	bc,cdfah
+			ret	m
+			ei
+			ld	bc,7edch
+			xor	c
+			add	a,e
+			call	nz,L11c3
+			sbc	a,h
+			ld	e,d
+			ld	bc,4b02h
+			rst	30h
+			ld	b,c9h
+			and	a
+			ret	m
+			inc	e
+			add	a,b
+			ld	b,l
+			sub	d
+			and	b
+			ret	nz
+			adc	a,(hl)
+			or	d
+			call	c,L0aa9
+			ld	b,c
+			jr	z,Laeca
+			djnz	Laf42
+			add	a,a
+			ld	e,12h
+			sub	a
+			call	po,L6876
+			sbc	a,3bh
+			bit	5,c
+			ld	de,e4eeh
+			dec	l
+			ld	a,a
+			xor	a
+			or	5ah
+			ld	a,d
+			add	a,b
+			ld	c,l
+			in	a,(c9h)
+			push	hl
+			ld	l,a
+			dec	sp
+			ld	c,(hl)
+			xor	e
+			inc	(hl)
+			adc	a,h
+			ld	a,(de)
+			ld	(hl),b
+			ld	de,65bch
+			dec	a
+			pop	hl
+			sub	a
+			jp	p,L4154
+			rst	10h
+			inc	h
+			xor	h
+			or	d
+			and	b
+			ld	e,h
+			nop (2x) *
+			jp	z,L0c97
+			rst	28h
+			ld	(hl),7bh
+			inc	d
+			ld	b,90h
+			call	Le257
+			ld	h,l
+			jr	z,Laf67
+			dec	a
+			jr	nz,Laf36
+			ld	l,b
+			ld	c,l
+			ld	d,l
+			adc	a,e
+			inc	h
+			push	de
+			pop	de
+			inc	(hl)
+			add	a,l
+			halt
+			inc	e
+			jp	po,La430
+			ld	l,a
+			dec	e
+			add	a,b
+			and	d
+			cp	66h
+			nop (2x) *
+			dec	bc
+			add	a,b
+			ld	h,l
+			ex	(sp),hl
+			ld	b,l
+			ld	b,(hl)
+			ld	(hl),d
+			or	b
+			ld	b,d
+			sub	(hl)
+			ld	a,(bc)
+			ld	(hl),h
+			ld	a,c
+			ld	h,(hl)
+			cp	b
+			ld	b,1bh
+			pop	af
+			and	e
+			add	a,h
+			ret	po
+			ret	c
+			add	a,(hl)
+			sub	a7h
+			ret	z
+			ld	(hl),a
+			cp	h
+			cp	h
+			and	(hl)
+			dec	de
+			jr	Laf20
+			db	d9h,ffh,dfh,a6h,beh,ach,aeh,5ah
+			db	d0h,ach,d2h,7ch,e8h,2fh,99h,f7h
+			db	83h,b1h,40h,edh,90h,76h,2ch
+			exx
+			xor	99h
+			ld	d,d
+			cp	h
+			xor	b
+			ld	a,h
+			ld	d,b
+			xor	b
+			inc	de
+			ld	(bc),a
+			and	a6h
+			ld	d,h
+			ld	(hl),l
+			ld	b,b
+			nop
+			dec	sp
+			dec	d
+			jp	p,L1181
+			ld	c,e
+			xor	h
+			ld	de,11c9h
+			nop (2x) *
+			dec	sp
+			ld	a,d
+			ld	d,a
+			rra
+			add	a,d
+			ld	de,375bh
+			ld	(hl),d
+			ld	c,c
+			sbc	a,2eh
+			rst	28h
+			xor	e2h
+			rst	08h
+			ld	(hl),l
+			ld	b,h
+			nop (2x) *
+			push	hl
+			sub	h
+			inc	de
+			ld	d,h
+			cp	e
+			ld	b,abh
+			inc	d
+			or	b
+			ex	af,af'
+			ld	h,e
+			dec	b
+			sub	b
+			ld	e,c8h
+			nop (2x) *
+			ld	d,d
+			in	a,(a6h)
+			inc	e
+			scf
+			and	e
+			sub	e
+			add	a,b
+			ld	e,c
+			ld	d,e
+			call	m,L6e5b
+			ld	h,a
+			cp	d
+			jp	L86d3
+			db	5dh,04h,62h,02h,03h,06h,b0h,4eh
+			db	7ch,c4h,42h,9fh,b0h,cdh,33h,51h
+			db	55h,deh,ffh,27h,3ch,6ah,d4h,68h
+			db	c5h,4fh,a3h,76h,a0h,a9h,67h,00h
+			db	c1h,14h,70h,98h,f0h,55h,d2h,3fh
+			db	adh,66h,bdh,57h,99h
+			and	c
+			sbc	a,l
+			dec	d
+			push	de
+			xor	h
+			ld	b,3eh
+			sbc	a,l
+			ld	d,a
+			ld	l,d5h
+			dec	a
+			sbc	a,h
+			daa
+			rst	20h
+			ld	de,3f05h
+			cp	(hl)
+			ret	c
+			ret
+			db	c8h,00h,7bh,b2h,9fh,1bh,a5h,88h
+			db	f7h,9bh,4ah,58h,a4h,4ah,1dh,1ah
+			db	88h,bdh,e6h,70h,f6h,63h,c5h,f3h
+			db	4ch,f3h,44h,36h,24h,19h,fdh,eah
+			db	e7h,43h,32h,66h,7bh,6fh,47h,71h
+			call	c,L2de4
+			inc	h
+			inc	e
+			push	bc
+			dec	a
+			ld	d,h
+			add	a,e
+			out	(6fh),a
+			and	h
+			ld	a,(e4b4h)
+			cp	f7h
+			ld	e,(hl)
+			cp	b
+			ld	e,h
+			ld	(hl),h
+			ld	h,l
+			jp	nz,L8ce9
+			or	e
+			jp	(hl)
+			db	d8h,bah,47h,12h,12h,28h,36h,21h
+			db	51h,19h,d7h,8eh,58h,a6h,bdh,43h
+			db	49h,73h,7ah,b4h,e1h,a3h,97h,07h
+			db	62h,7ch,6eh,9ch,4dh,aeh,41h,1ah
+			db	8bh,c3h,05h,71h,1bh
+			cp	c
+			ccf
+			jr	Lb09a
+			db	96h,70h,90h,2bh,5ah,e7h,a4h,04h
+			db	f1h,31h,63h,31h,2ah,7ah,4dh,86h
+			db	57h,1eh,11h,83h,1ch,e7h,58h,d1h
+			db	12h,6eh,04h
+			cp	(hl)
+			ld	(b1f1h),a
+			sub	l
+			cp	h
+			ld	a,a
+			xor	d
+			ld	b,a
+			xor	e
+			sbc	a,(hl)
+			ld	b,b
+			inc	hl
+			rla
+			ld	(5c70h),hl
+			sub	(hl)
+			xor	77h
+			push	de
+			and	e
+			cp	a
+			dec	a
+			jp	L4f99
+			db	e7h,76h,86h,53h,7fh,94h,e7h
+			dec	b
+			ld	e,c
+			sub	b
+			jp	z,L017e
+			ld	a,e
+			jp	nc,Lef76
+			ld	hl,(6b73h)
+			inc	h
+			ret	nz
+			push	af
+			ld	c,a
+			sub	h
+			ld	c,l
+			ld	d,e
+			ret	nz
+			ld	a,d
+			ld	a,c
+			and	a
+			jp	z,L1aee
+			add	a,(hl)
+			xor	(hl)
+			sbc	a,a
+			push	de
+			sbc	a,(hl)
+			ld	l,e
+			ld	h,a
+			adc	a,b
+			xor	h
+			ld	(052dh),a
+			jp	nz,Ldafc
+			di
+			ld	b,b
+			ld	e,d
+			ld	a,(hl)
+			ret	c
+			sbc	a,ddh
+			dec	d
+			or	e
+			sub	c
+			xor	f4h
+			cp	h
+			ld	d,b
+			ld	d,(hl)
+			ld	e,(hl)
+			out	(7bh),a
+			ld	c,a
+			ret	p
+			cp	h
+			ld	(de),a
+			ld	a,c
+			ld	a,h
+			call	p,Lc581
+			pop	de
+			jp	L2938
+			db	d1h,92h,f4h,9ch,5fh,7ch,85h,6bh
+			db	89h,fbh,62h,23h,1ch,69h,03h,c2h
+			db	54h,e7h,59h,25h,b2h,a2h,c5h,30h
+			db	c1h,b2h,74h,89h,31h,02h,9bh,c9h
+			db	80h,58h,dch,c0h,1ah,5dh,cdh,22h
+			sub	d
+			or	l
+			inc	hl
+			ld	l,c
+			dec	a
+			ld	a,d
+			add	a,b
+			ld	b,b
+			ex	(sp),hl
+			ld	c,b
+			ld	(hl),d
+			ld	h,a
+			adc	a,a
+			sub	e
+			jp	nc,Lb0cf
+			exx
+			ld	(hl),a
+			ld	a,(887ah)
+			ld	bc,8d5eh
+			dec	c
+			jr	z,Lb12d
+			add	a,e
+			ret	c
+			or	c
+			and	l
+			rst	00h
+			ld	h,a
+			pop	bc
+			call	c,L408c
+			sbc	a,l
+			sbc	a,a
+			nop
+			jr	Lb172
+			db	58h,ceh,50h,10h,a6h,12h,c6h,aah
+			db	7ah,31h,66h,2dh,76h,f4h,9ch,56h
+			db	5eh,90h,83h,d5h,51h,fch,2fh,3dh
+			db	57h,10h
+			adc	a,h
+			ld	c,(hl)
+			call	L6996
+			ld	b,b
+			ld	(f5aeh),hl
+			inc	de
+			dec	c
+			rla
+			call	z,L2b30
+			inc	h
+			ld	l,d
+			ret	p
+			add	a,c
+			sub	b
+			ex	af,af'
+			ret	nc
+			pop	af
+			jp	nz,Lb9bc
+			sbc	a,c6h
+			and	d
+			ini
+			inc	sp
+			ld	b,(hl)
+			ld	d,c
+			ld	e,e
+			ld	c,(hl)
+			or	e
+			adc	a,e
+			ld	c,c
+			and	b
+			inc	hl
+			rst	08h
+			ld	(hl),75h
+			out	(07h),a
+			ld	h,h
+			ret	nc
+			rrca
+			inc	d
+			adc	a,7eh
+			xor	d
+			cp	(hl)
+			ret	c
+			ld	e,d
+			rra
+			ld	e,c
+			jr	Lb229
+			db	44h,87h,4ah,43h,aah,78h,edh,43h
+			rra
+			ld	a,a
+			jp	nz,Lcc7d
+			rst	00h
+			ret	p
+			call	po,Lc7ec
+			pop	hl
+			ret	m
+			ld	d,c
+			xor	(hl)
+			or	d
+			ret	p
+			sub	l
+			ld	(hl),c
+			ld	(hl),h
+			ld	h,b
+			inc	h
+			ei
+			xor	a
+			ex	af,af'
+			ld	(de),a
+			ret	p
+			ld	a,(hl)
+			ld	hl,(749fh)
+			or	c
+			xor	c
+			sub	h
+			inc	e
+			ld	bc,4a1ah
+			ld	c,(hl)
+			ld	e,l
+			ld	b,c
+			ld	l,d
+			ld	a,(bc)
+			rst	18h
+			pop	af
+			and	(hl)
+			xor	57h
+			sbc	a,c
+			ld	l,c
+			di
+			dec	bc
+			ld	(bc),a
+			ld	d,c
+			ld	e,h
+			ld	a,c
+			ld	d,c
+			sbc	a,d
+			ex	(sp),hl
+			and	l
+			ld	c,c
+			adc	a,l
+			ld	c,d
+			jr	c,Lb227
+			ld	l,l
+			add	a,a
+			or	a
+			sbc	a,l
+			dec	sp
+			cp	d
+			ld	sp,462fh
+			in	a,(98h)
+			xor	(hl)
+			ld	(hl),0fh
+			nop
+			dec	c
+			add	a,l
+			sbc	a,h
+			sbc	a,c
+			adc	a,h
+			xor	l
+			dec	(hl)
+			adc	a,l
+			call	z,L95b5
+			rst	18h
+			djnz	Lb196
+			jp	c,L699d
+			ld	b,ebh
+			ld	h,8dh
+			jr	Lb245
+			db	43h,c8h,01h,26h,e2h,cch,30h,7ah
+			db	6fh,06h,1dh
+			ld	d,c
+			ld	h,l
+			sbc	a,a
+			and	h
+			dec	bc
+			ld	c,l
+			ret
+			db	37h,0ch,c6h,37h,3dh
+			ld	a,c
+			or	e
+			dec	(hl)
+			ld	b,h
+			jr	nc,Lb217
+			ld	a,h
+			ld	e,d
+			call	z,Lf5e6
+			ld	l,d
+			ld	h,e
+			sub	d
+			and	a
+			ld	d,e2h
+			ld	e,4eh
+			inc	c
+			and	l
+			ld	d,(hl)
+			jp	m,Lcd78
+			ld	(hl),h
+			rla
+			ld	c,h
+			add	hl,hl
+			dec	bc
+			ld	(8cb0h),hl
+			rla
+			dec	de
+			ld	e,l
+			scf
+			ret	p
+			and	e
+			dec	de
+			call	L3e29
+			cp	h
+			ld	a,b
+			ld	l,h
+			sbc	a,h
+			pop	hl
+			sbc	a,(hl)
+			ret	nz
+			or	d
+			rst	10h
+			rra
+			xor	h
+			ret	c
+			dec	(hl)
+			ld	d,b
+			rrca
+			jp	m,Leb3b
+			sub	a
+			sub	beh
+			ld	e,3bh
+			ld	(hl),abh
+			scf
+			di
+			ld	e,a
+			dec	b
+			adc	a,e
+			ld	(hl),a
+			ld	b,a
+			xor	d
+			ld	d,c
+			sub	(hl)
+			sbc	a,c
+			ld	e,h
+			inc	(hl)
+			ld	(hl),d
+			add	a,(hl)
+			ccf
+			sbc	a,b
+			xor	h
+			ld	c,d6h
+			dec	l
+			dec	bc
+			add	a,(hl)
+			inc	h
+			rst	38h
+			dec	e
+			or	l
+			adc	a,e
+			ld	(hl),c
+			ld	(hl),a
+			rlca
+			sbc	a,d
+			ld	e,e
+			dec	de
+			ld	bc,a4f3h
+			or	c
+			ld	l,b
+			ld	(hl),d
+			inc	b
+			sbc	a,l
+			ld	l,a
+			adc	a,h
+			dec	l
+			jp	c,L2b2b
+			inc	de
+			ld	(hl),e9h
+			and	(hl)
+			out	(e3h),a
+			adc	a,a
+			dec	bc
+			in	a,(74h)
+			ld	a,(hl)
+			nop (2x) *
+			ld	e,9fh
+			ld	a,b
+			rlca
+			sub	h
+			or	e
+			ld	c,(hl)
+			ld	c,d
+			add	a,d
+			sub	e
+			call	nc,Lbfc5
+			xor	b
+			rst	10h
+			ex	af,af'
+			ld	(hl),e
+			inc	bc
+			ret	po
+			inc	e
+			pop	hl
+			and	a
+			rlca
+			rst	38h
+			ld	c,c
+			ld	l,(hl)
+			ld	(hl),l
+			jp	nz,Ld04b
+			ld	c,(hl)
+			adc	a,c
+			add	a,e
+			ld	a,(de)
+			ld	e,(hl)
+			ld	c,h
+			adc	a,l
+			ld	h,c
+			ret	nz
+			ld	d,l
+			inc	c
+			ld	a,a
+			rst	38h
+			nop (2x) *
+			rst	10h
+			or	l
+			cp	81h
+			nop (2x) *
+			xor	(hl)
+			ld	e,d
+			call	nc,Lb316
+			ld	d,c
+			and	h
+			ld	c,e
+			ld	h,88h
+			inc	a
+			ld	hl,(81e9h)
+			ld	c,c
+			jr	nz,Lb2b6
+			ld	d,e
+			ei
+			ld	b,c
+			rla
+			dec	(hl)
+			ld	c,l
+			cp	b
+			ret	m
+			or	e
+			or	b
+			ld	l,(hl)
+			ld	d,e
+			ld	b,e
+			ld	l,(hl)
+			add	a,(hl)
+			inc	(hl)
+			dec	e
+			ld	a,(hl)
+			dec	sp
+			adc	a,l
+			inc	c
+			ld	h,h
+			ld	d,d
+			jp	nc,Lc50d
+			jr	nc,Lb2d8
+			jr	c,Lb320
+			add	hl,bc
+			ld	(hl),b
+			call	po,Ldcc1
+			ei
+			sub	(hl)
+			jp	L82c5
+			db	e5h,1dh
+			call	Ledad
+			ld	(hl),b
+			ld	a,a
+			jp	p,L78ad
+			rst	28h
+			sbc	a,a
+			push	de
+			and	a
+			or	d
+			exx
+			or	b
+			ret	pe
+			ld	d,(hl)
+			ld	c,e
+			ld	d,c
+			dec	de
+			ret	nz
+			ld	c,(hl)
+			ld	c,e
+			jp	(hl)
+			db	55h,19h,6dh,93h,22h,c0h,ceh,43h
+			db	8ah,0eh,e6h,97h,38h,80h,d5h,e3h
+			db	43h,d6h,30h,0bh,55h,1ah,a2h,aeh
+			db	8fh,0bh,13h,c0h,d0h,40h,88h,69h
+			db	cdh,46h,50h,b0h,f6h,45h,3ah,40h
+			db	c2h,24h,65h,6fh,cch,01h,0eh,4fh
+			db	a3h,79h,3eh,6bh,26h,55h,b7h,e9h
+			db	c1h,04h
+			dec	d
+			ld	b,h
+			djnz	Lb3b1
+			xor	e
+			ld	d,d
+			ld	h,l
+			inc	c
+			jp	c,Lfacb
+			ld	b,b
+			and	l
+			ld	de,016ch
+			call	po,L375f
+			ld	b,(hl)
+			dec	d
+			adc	a,(hl)
+			sub	a
+			ld	a,(hl)
+			inc	l
+			ld	h,e
+			nop (2x) *
+			add	a,b
+			xor	l
+			xor	e
+			ret	pe
+			sub	a
+			dec	sp
+			rst	18h
+			adc	a,a
+			ld	a,(de)
+			ld	l,c
+			jp	z,L0573
+			ld	d,a
+			ld	sp,hl
+			ld	h,e
+			ld	d,e
+			push	af
+			add	a,49h
+			djnz	Lb3d5
+			xor	h
+			ld	h,e
+			ld	d,e
+			ret	pe
+			cp	h
+			sub	l
+			ret	po
+			rst	30h
+			add	a,e
+			ld	d,d
+			jr	c,Lb3f0
+			ld	h,c
+			ld	a,e
+			inc	e
+			call	p,L05e9
+			add	hl,bc
+			jr	nz,Lb3be
+			ld	(bc),a
+			ld	e,l
+			ld	d,cch
+			ld	bc,e155h
+			ld	c,d
+			cp	a
+			ld	b,c
+			and	32h
+			rst	10h
+			ld	e,a
+			dec	sp
+			inc	a
+			and	(hl)
+			ld	b,a
+			ld	d,a
+			adc	a,l
+			dec	c
+			sbc	a,e
+			and	c
+			dec	a
+			cp	(hl)
+			ld	a,e
+			nop (2x) *
+			ld	(e8c5h),a
+			push	bc
+			add	a,l
+			ld	(hl),b
+			call	nc,Lbee9
+			adc	a,(hl)
+			rra
+			or	d
+			cp	b
+			add	a,l
+			ld	h,b
+			ei
+			ret	p
+			jr	nz,Lb3f5
+			ld	(9c0ch),hl
+			bit	1,(hl)
+			rst	08h
+			sub	e
+			ld	e,a
+			jr	nc,Lb415
+			halt
+			add	a,c
+			ld	de,2e77h
+			ld	b,e
+			inc	hl
+			ld	d,(hl)
+			rst	20h
+			ret
+			db	60h,d8h,79h,20h,94h,06h,e8h,f2h
+			db	36h,d1h,78h,b1h,5dh,3ch,55h,cbh
+			db	50h,11h,eeh,00h,f1h,e1h,73h,bfh
+			db	26h,70h
+			pop	bc
+			call	nc,Lf559
+			ret	p
+			inc	(hl)
+			inc	h
+			ld	d,e
+			sbc	a,b
+			ld	b,c
+			inc	bc
+			ld	h,d
+			ld	b,(hl)
+			dec	(hl)
+			xor	56h
+			ld	(bc),a
+			and	d
+			and	h
+			nop
+			jp	nz,L5293
+			ld	b,4fh
+			ld	(hl),c
+			jr	c,Lb45f
+			xor	a
+			call	c,L3fd6
+			call	L67bc
+			add	a,b
+			res	5,d
+			ld	(846bh),hl
+			xor	h
+			cp	e
+			nop
+			ld	hl,(ef2bh)
+			inc	l
+			sbc	a,l
+			adc	a,c
+			cp	e
+			ld	h,h
+			ld	(hl),a
+			cp	(hl)
+			ex	af,af'
+			call	po,Ld6be
+			jp	z,Lbde4
+			add	a,h
+			ld	hl,(d6f7h)
+			ld	b,f8h
+			ret	po
+			ld	a,d
+			sbc	a,d
+			dec	l
+			ld	de,ceb0h
+			xor	l
+			add	a,a
+			call	nc,L1b8e
+			add	a,h
+			ld	c,e
+			ld	a,e
+			adc	a,(hl)
+			sbc	a,a
+			cp	l
+			ld	h,e
+			rst	00h
+			cp	e
+			cp	0ah
+			daa
+			ld	c,l
+			set	1,e
+			xor	e
+			cp	l
+			ld	a,a
+			dec	(hl)
+			ld	b,e
+			ret	p
+			adc	a,(hl)
+			add	a,dbh
+			ld	d,(hl)
+			ex	de,hl
+			ld	e,d
+			ld	l,35h
+			add	a,b
+			nop
+			ld	(de),a
+			sll	c
+			ld	d,(hl)
+			jp	p,L94fc
+			add	hl,hl
+			jr	nz,Lb43d
+			dec	sp
+			pop	af
+			inc	a
+			ei
+			rla
+			jr	z,Lb4b9
+			inc	sp
+			sub	e
+			ld	c,e
+			ld	d,l
+			rst	10h
+			ld	e,e
+			daa
+			adc	a,b
+			rst	00h
+			ld	e,d
+			ld	b,(hl)
+			sub	e
+			rst	18h
+			adc	a,c
+			ld	l,a
+			sub	e
+			xor	d
+			sbc	a,e
+			rst	38h
+			xor	d
+			rst	38h
+			inc	bc
+			ret	m
+			djnz	Lb487
+			push	af
+			out	(94h),a
+			sub	e
+			adc	a,l
+			inc	l
+			sbc	a,a
+			inc	(hl)
+			ld	e,c
+			ld	h,c
+			ret	z
+			call	nz,L4b7c
+			ld	e,e
+			inc	h
+			add	a,b
+			ld	e,d
+			ld	(95d6h),a
+			xor	h
+			ex	af,af'
+			dec	e
+			ld	c,a
+			ld	a,d
+			or	e
+			ld	h,b
+			inc	sp
+			ld	(hl),a
+			ld	(hl),c
+			ld	c,b
+			ld	c,e
+			ld	h,(hl)
+			ei
+			cp	b
+			ld	h,b
+			ld	c,l
+			or	e
+			call	p,L2c17
+			adc	a,c
+			or	a
+			ld	d,l
+			sub	e
+			ei
+			ld	e,(hl)
+			call	m,Ld382
+			adc	a,l
+			rst	18h
+			ld	d,e
+			ld	b,c
+			cp	h
+			rst	30h
+			ld	(hl),c
+			ld	d,l
+			and	l
+			and	cfh
+			sbc	a,b
+			ret	pe
+			ld	de,a67bh
+			push	bc
+			dec	hl
+			dec	b
+			in	a,(45h)
+			or	(hl)
+			inc	bc
+			ld	d,b
+			ld	a,b5h
+			sub	(hl)
+			ld	h,h
+			sbc	a,l
+			jp	pe,L670c
+			ld	b,c
+			ld	c,l
+			add	a,d
+			add	a,(hl)
+			xor	c
+			ret	po
+			cp	e
+			jp	L8b33
+			db	b1h,24h,e1h,b6h,3eh,20h,7dh,e8h
+			db	9bh,e1h,b9h,8ah,c0h,b0h,52h,d2h
+			db	7fh,78h,a9h,92h,37h,e8h
+			ret	pe
+			ld	b,a
+			rst	28h
+			jr	nz,Lb522
+			sbc	a,e
+			jp	nc,L3976
+			ld	h,h
+			ld	e,c
+			add	a,d
+			rst	18h
+			inc	a
+			jp	c,L6927
+			call	nc,L8e08
+			add	a,(hl)
+			ld	h,h
+			ret	nc
+			sub	1dh
+			push	de
+			ld	c,b
+			jp	po,L06a4
+			ret	c
+			ld	(hl),h
+			jp	nz,Lc5a8
+			ld	d,ixh *
+			ld	a,b
+			ld	a,l
+			ld	h,e
+			ld	(hl),a
+			ld	h,e
+			ld	(hl),a
+			and	c
+			or	e
+			sub	a3h
+			ld	d,85h
+			ld	e,c
+			ld	l,a
+			adc	a,c
+			jp	nz,L00a0
+			ld	h,l
+			xor	h
+			scf
+			ld	c,e
+			pop	af
+			adc	a,(hl)
+			ld	(hl),l
+			or	b
+			inc	hl
+			ld	(hl),a
+			cpl
+			inc	(hl)
+			cp	l
+			scf
+			dec	h
+			ld	a,(bc)
+			inc	bc
+			ld	(hl),b
+			ld	a,(de)
+			ret	pe
+			pop	af
+			ld	l,e
+			ld	l,d
+			ld	d,d
+			rst	08h
+			out	(84h),a
+			ld	b,a
+			ld	(hl),d
+			call	p,L4280
+			ld	h,h
+			sub	e
+			add	hl,sp
+			ld	e,a
+			rrca
+			call	m,Ldb1d
+			pop	af
+			ld	a,(de)
+			inc	sp
+			nop (2x) *
+			xor	d
+			ld	(hl),e
+			ld	a,fch
+			add	hl,sp
+			ld	b,d
+			ld	l,c
+			scf
+			push	bc
+			jp	pe,L9739
+			ld	a,(bc)
+			ret	po
+			ld	(hl),l
+			rlca
+			rst	30h
+			dec	c
+			dec	bc
+			ld	h,d
+			add	a,c
+			add	a,c
+			or	c
+			add	a,c
+			ld	b,(hl)
+			rst	28h
+			xor	a
+			adc	a,l
+			nop
+			jr	z,Lb536
+			or	ixl *
+			ld	a,h
+			ld	e,e
+			add	a,(hl)
+			add	a,dbh
+			ld	a,(de)
+			cp	(hl)
+			ld	b,e
+			xor	l
+			dec	sp
+			cp	(hl)
+			xor	c7h
+			dec	hl
+			ld	l,a
+			jp	p,Lb0ea
+			sbc	a,e
+			call	po,L533c
+			or	e
+			inc	h
+			ld	a,b2h
+			ld	(hl),14h
+			add	hl,hl
+			ld	e,c
+			ld	(de),a
+			or	c
+			inc	h
+			cp	h
+			ld	e,a0h
+			ret	nc
+			ld	b,(hl)
+			call	c,L5fab
+			or	c
+			jp	m,L9799
+			sub	(hl)
+			or	(hl)
+			inc	bc
+			xor	a
+			adc	a,b
+			sbc	a,l
+			ld	bc,c89bh
+			add	a,h
+			ld	a,(de)
+			or	c
+			sbc	a,b
+			ret	p
+			add	a,e
+			call	nz,L5c6e
+			nop (2x) *
+			adc	a,bbh
+			ld	l,h
+			cp	e
+			ld	e,c
+			rst	30h
+			rlca
+			ld	a,(5843h)
+			add	a,(hl)
+			adc	a,e
+			pop	af
+			sub	c
+			xor	l
+			ld	(bc),a
+			inc	b
+			ld	c,e
+			jp	(hl)
+			db	bfh,7ah,cah,16h,40h,9eh,09h,46h
+			db	d4h,18h,33h,e7h,e0h,9ah,49h,adh
+			db	06h,3bh,01h,29h,e3h,f9h,07h,1eh
+			db	4eh,90h,dbh,4ch,c3h,78h,5ah,beh
+			db	18h,d3h,89h,b3h,bch,50h,4ah,46h
+			db	3fh,a5h,19h,5bh,fch,bch,8bh,36h
+			db	3fh,bfh,b0h,d7h,78h,9ah,23h,46h
+			db	6ah,82h,ebh,41h,d2h,e3h,61h,63h
+			db	41h,44h,66h,f9h,b8h,feh,50h,deh
+			db	67h,62h,03h,5bh,80h,0bh,e3h,82h
+			db	d1h,7dh,9eh,a1h
+			sbc	a,d
+			xor	d
+			adc	a,a
+			ld	l,d
+			ld	b,d2h
+			add	a,(hl)
+			adc	a,e
+			in	a,(7bh)
+			cp	a
+			ld	d,b
+			push	af
+			ld	l,h
+			ld	(hl),b
+			add	hl,sp
+			sbc	a,e4h
+			or	h
+			jp	z,La237
+			ld	(iy + 7bh),c
+			call	nc,L2df2
+			rst	28h
+			jp	Ld7b0
+			db	e5h,fch,23h,6dh,cfh,93h,c2h,83h
+			db	adh,76h,44h
+			ccf
+			or	l
+			ld	(2990h),a
+			ld	h,(hl)
+			sbc	a,e
+			adc	a,d
+			ld	h,c
+			rst	00h
+			jp	L434b
+			db	94h,c2h,0ah,c8h,adh,d1h,16h,59h
+			db	5dh,77h,feh,90h,28h,3ch,8bh,29h
+			db	61h,15h,00h,ddh,eeh,7fh,f2h,75h
+			db	4dh,15h,4ah,d5h,32h,92h,e8h,f9h
+			db	aah,5fh,23h,88h,fdh,fch,a5h,a0h
+			db	b7h
+			xor	35h
+			xor	e
+			sub	l
+			ld	h,a
+			rst	10h
+			ld	l,a
+			adc	a,e
+			ld	e,a
+			inc	d
+			jr	z,Lb64b
+			dec	de
+			dec	de
+			ld	e,(hl)
+			ld	a,c6h
+			ld	sp,hl
+			add	hl,hl
+			xor	e
+			add	a,d
+			ld	c,d
+			halt
+			ld	d,bdh
+			dec	b
+			ld	(hl),l
+			or	l
+			inc	de
+			ld	hl,(cc56h)
+			sbc	a,c
+			ld	d,05h
+			call	nz,Le2c6
+			rst	30h
+			di
+			rst	30h
+			adc	a,7fh
+			bit	4,a
+			sub	b
+			ld	d,b
+			ld	e,l
+			dec	de
+			rrca
+			or	b
+			ld	c,96h
+			ld	(f9a8h),hl
+			ld	l,a
+			sub	d
+			out	(c7h),a
+			or	29h
+			ld	l,d
+			ld	a,a
+			call	m,Lff80
+			sbc	a,l
+			dec	a
+			adc	a,l
+			xor	h
+			dec	(hl)
+			sbc	a,(hl)
+			ld	e,(hl)
+			inc	a
+			ld	(hl),l
+			ld	l,a
+			and	h
+			adc	a,c
+			jp	z,Lec69
+			ld	(bc),a
+			sub	7ch
+			ld	e,d
+			nop (2x) *
+			sub	b
+			call	c,L42af
+			sub	7ah
+			jp	L59e2
+			db	fch,a5h,5dh,92h,82h,58h,83h,b0h
+			db	dbh,47h,66h,37h,b5h,6dh,9eh,8bh
+			db	1fh,05h,16h,73h,deh,d9h
+			and	e
+			cp	c
+			ld	c,d
+			xor	a
+			rla
+			cp	1ah
+			adc	a,b
+			ld	a,l
+			add	hl,sp
+			ld	l,(hl)
+			ld	l,03h
+			cp	b
+			xor	ffh
+			ld	a,(de)
+			xor	e
+			jp	c,L355f
+			sub	b
+			ret	nc
+			cp	l
+			cp	b
+			dec	e
+			sbc	a,d
+			and	h
+			xor	h
+			ld	l,c
+			ret	nz
+			ret	z
+			ret	po
+			dec	a
+			add	a,a
+			dec	sp
+			and	l
+			xor	(hl)
+			jr	nz,Lb705
+			ld	e,h
+			ld	bc,6027h
+			ret	pe
+			and	l
+			sub	h
+			call	nz,L7c28
+			ld	(hl),h
+			ld	d,5ah
+			add	hl,de
+			ld	h,b
+			jp	L12f3
+			db	4bh,0ch,5ah,bch,cah,88h,8bh,bah
+			db	ceh,d0h,cdh,29h,0fh,adh,d6h,23h
+			db	82h,b7h,2fh,79h,f7h,c6h,6ah,efh
+			db	7ah,0dh,8dh,22h,1bh,0ah,1bh,d3h
+			db	e0h,e4h,a6h,30h
+			ld	bc,2bd5h
+			sub	b
+			ld	(hl),2bh
+			rra
+			cp	d
+			ld	c,efh
+			ld	sp,7dc7h
+			ret	z
+			djnz	Lb780
+			dec	h
+			add	a,(hl)
+			cp	2ah
+			inc	e
+			ld	e,(hl)
+			rst	28h
+			daa
+			out	(6eh),a
+			ld	d,a
+			cpl
+			rra
+			rst	10h
+			ld	d,(hl)
+			ld	hl,5ba1h
+			or	h
+			rra
+			ld	d,(hl)
+			sub	a
+			and	(hl)
+			adc	a,d6h
+			ld	b,(hl)
+			ret	nz
+			ld	d,e
+			dec	bc
+			inc	d
+			ret
+			db	42h,77h,d2h,4bh,40h,f9h,9dh,94h
+			db	1fh,4ah,86h,75h,99h,9fh,01h,bbh
+			db	a7h,eeh,11h
+			jp	z,L6e1c
+			or	d
+			xor	c
+			scf
+			sbc	a,h
+			inc	sp
+			dec	b
+			ld	h,d
+			and	(hl)
+			inc	a
+			cp	d
+			ld	l,c
+			call	po,L510d
+			inc	sp
+			ret	nc
+			ret	po
+			ld	l,h
+			ld	d,a
+			ld	e,a
+			sub	4fh
+			ld	l,b
+			add	a,c
+			and	c
+			ld	c,l
+			cp	h
+			xor	d
+			inc	c
+			or	e
+			sbc	a,a
+			out	(4ch),a
+			sub	e
+			daa
+			jp	z,La9f2
+			cp	c
+			push	af
+			xor	e1h
+			nop
+			inc	b
+			xor	83h
+			halt
+			cp	b
+			ld	c,c
+			ld	l,a
+			ld	hl,(e5b5h)
+			ld	l,l
+			sub	d
+			ld	b,a
+			ld	c,h
+			ld	b,h
+			ld	l,l
+			ld	a,h
+			jp	p,Lc8fa
+			and	l
+			rst	00h
+			sub	b
+			rra
+			sbc	a,2ch
+			ld	e,e
+			add	a,e
+			djnz	Lb816
+			ld	hl,(L2104)
+			dec	b
+			dec	b
+			or	d
+			ld	b,a
+			ld	a,e
+			inc	h
+			jr	c,Lb895
+			ld	l,e
+			add	hl,hl
+			push	af
+			jp	nz,L24c8
+			jr	z,Lb80d
+			ld	(hl),a
+			ld	e,(hl)
+			ei
+			jp	po,L1ba1
+			dec	de
+			call	po,Ld23f
+			cp	e
+			pop	de
+			ld	(hl),a
+			ld	h,e
+			add	hl,bc
+			ld	b,l
+			sbc	a,c
+			sbc	a,47h
+			add	hl,sp
+			ld	c,ixh *
+			inc	a
+			ld	l,(hl)
+			sub	h
+			nop (2x) *
+			sub	a
+			sbc	a,b
+			dec	l
+			dec	a
+			adc	a,h
+			pop	af
+			ei
+			halt
+			call	p,Lf421
+			rst	08h
+			ld	l,l
+			jp	pe,L9898
+			dec	e
+			halt
+			inc	b
+			ld	l,a
+			jp	(hl)
+			db	77h,4eh,6dh,8bh,c3h,97h,46h,1bh
+			db	25h,a1h,98h,64h,16h,58h,c2h,98h
+			db	a9h,f4h,54h,0ah,adh,aah,cdh,d3h
+			db	b7h,f9h,a9h,ddh,2ah,dfh,d7h,dah
+			db	cbh,6dh,21h,1dh,5ch,3fh,13h,adh
+			db	06h,7ch,7ah,d6h,a7h,00h,91h,88h
+			db	9eh,c5h,a9h,8fh,aah,edh,c0h,03h
+			db	2eh,e8h,cch,06h,bdh,8bh,e7h,2bh
+			db	a4h,c4h,9bh,63h,d3h
+			inc	l
+			ret	nz
+			call	L23d9
+			ld	a,d
+			cp	h
+			add	a,d
+			inc	de
+			ret	p
+			ld	hl,3ba9h
+			rla
+			ld	e,b
+			add	a,(hl)
+			ld	a,65h
+			ld	c,c
+			cp	d
+			inc	de
+			pop	de
+			ld	b,l
+			ret	nz
+			jp	m,Lb373
+			inc	e
+			jp	nz,Lbab6
+			and	h
+			xor	h
+			ld	e,d
+			and	c
+			ret	m
+			ret	po
+			ret	pe
+			sub	7ah
+			dec	d
+			jp	(hl)
+			db	afh,5eh,e6h,62h,d9h,c4h,37h,a2h
+			db	afh,88h,95h,82h,e8h
+			and	(hl)
+			ld	e,d
+			ld	c,d8h
+			dec	a
+			sbc	a,l
+			dec	bc
+			ld	l,a
+			or	(hl)
+			ld	l,(hl)
+			ld	a,(adb8h)
+			ld	e,l
+			ld	h,e
+			ret
+			db	93h,c8h,8fh,bch,e6h,98h,22h
+			out	(ebh),a
+			ld	hl,1bd6h
+			dec	b
+			rst	10h
+			sub	76h
+			dec	b
+			in	a,(81h)
+			and	d
+			rst	10h
+			exx
+			sbc	a,(hl)
+			add	hl,hl
+			cp	b
+			ld	d,e
+			xor	c
+			ld	d,b
+			sbc	a,c
+			ld	h,h
+			jr	nz,Lb901
+			jp	po,L4098
+			adc	a,h
+			dec	d
+			jr	nc,Lb982
+			ld	e,d
+			inc	hl
+			add	hl,hl
+			sub	a
+			ld	e,6dh
+			add	a,b
+			jp	c,Lfc17
+			ld	c,(hl)
+			ld	a,(de)
+			xor	(hl)
+			cp	a
+			ld	h,h
+			ld	d,b
+			ei
+			ld	hl,d507h
+			ex	de,hl
+			exx
+			ld	l,l
+			ld	hl,e2b3h
+			ld	a,l
+			ld	b,e
+			dec	bc
+			ld	a,e
+			dec	e
+			ld	e,b
+			ld	h,h
+			ld	l,e
+			inc	sp
+			ret	pe
+			sub	b
+			adc	a,a
+			jp	m,L634d
+			and	c
+			ld	(hl),l
+			dec	bc
+			sbc	a,e
+			ret	nz
+			jp	pe,L2402
+			ld	b,(hl)
+			add	a,b
+			ld	d,d
+			sbc	a,(hl)
+			sub	b
+			ld	d,e
+			ld	d,d
+			ld	a,a
+			rst	10h
+			cp	d
+			ld	(hl),a
+			dec	bc
+			xor	l
+			ld	b,l
+			pop	bc
+			and	b
+			ld	h,e
+			jp	(hl)
+			db	8ah,b1h,10h,f0h,b1h,d2h,f3h,6eh
+			db	cah,26h,94h,f6h,f8h,c6h,1dh,22h
+			db	c6h,92h,73h,b8h,b0h,89h,5fh,05h
+			db	93h
+			sbc	a,(hl)
+			jp	nc,Lb83c
+			ld	sp,01d2h
+			ld	d,32h
+			sub	c
+			ld	hl,4a51h
+			ld	c,(hl)
+			and	e
+			ld	(hl),b
+			ccf
+			inc	h
+			ld	a,e
+			ret
+			db	6eh,e0h,5fh,1dh,25h,d8h,33h,42h
+			db	edh,47h,a2h,17h,79h
+			xor	b
+			pop	af
+			dec	l
+			or	e
+			ld	e,c
+			dec	hl
+			ld	(hl),d
+			ld	l,b
+			halt
+			pop	bc
+			push	af
+			ex	af,af'
+			adc	a,a
+			inc	(hl)
+			ld	hl,(1e09h)
+			ld	l,a
+			ld	h,c
+			dec	l
+			ld	a,29h
+			rst	00h
+			ld	h,afh
+			add	hl,bc
+			sub	a
+			ld	l,(hl)
+			in	a,(76h)
+			or	a
+			ld	e,c3h
+			add	hl,hl
+			sub	b
+			ld	d,(hl)
+			inc	l
+			dec	h
+			call	p,L5a6b
+			pop	af
+			xor	(hl)
+			xor	e
+			jr	z,Lb980
+			and	d
+			cp	e
+			ld	(hl),c
+			cp	a
+			ld	l,c
+			jp	L6bc0
+			db	50h,54h,5ch,efh,a5h,31h
+			ld	l,b
+			inc	de
+			ld	a,l
+			and	h
+			ld	a,l
+			inc	(hl)
+			ret	c
+			jp	z,L8c02
+			in	a,(f3h)
+			ret	nc
+			ld	e,iyh *
+			add	hl,de
+			ret	nc
+			or	d
+			di
+			ret	p
+			ld	l,l
+			ret	nz
+			adc	a,c
+			dec	b
+			ld	h,(hl)
+			ld	l,d
+			sbc	a,b
+			ret	po
+			pop	bc
+			djnz	Lb9a7
+			ld	b,a
+			ret
+			db	3fh,ceh,69h,07h,11h,fbh,e8h,6ch
+			db	72h,10h,e5h,70h,d2h,f4h,80h,83h
+			db	6eh,aeh,cch,f8h,92h,5bh,dah,fah
+			ld	b,b
+			ld	l,h
+			rrca
+			ld	(hl),e
+			ld	h,c
+			dec	e
+			nop
+			ld	b,a
+			sub	e
+			ld	d,d
+			or	e
+			jp	p,L4ff3
+			ld	sp,hl
+			ret	m
+			ld	c,(hl)
+			rst	30h
+			out	(e9h),a
+			jp	m,L73d9
+			ld	(hl),h
+			inc	b
+			inc	c
+			jr	nc,Lba24
+			ret
+			db	b2h,7ah,89h,5eh,9ch,31h,99h,23h
+			db	aah,92h,bch,f3h,f0h,6dh,0ch,a7h
+			ld	a,(2688h)
+			pop	af
+			jp	(hl)
+			db	e7h,bdh,ech,65h,c0h,f0h,38h,b1h
+			db	cch,64h,15h,62h,19h,51h,4bh
+			ld	l,(hl)
+			inc	l
+			ld	(163ch),a
+			jr	c,Lba88
+			xor	e
+			and	c
+			cp	c
+			rst	28h
+			dec	de
+			ld	d,c
+			cp	(hl)
+			di
+			sub	b
+			xor	(hl)
+			ld	a,(de)
+			ret	pe
+			sbc	a,l
+			ld	c,e
+			rst	20h
+			inc	sp
+			ld	e,e
+			jp	pe,L174a
+			xor	a
+			in	a,(57h)
+			res	2,b
+			inc	de
+			ld	(0389h),hl
+			jp	pe,L14f3
+			xor	c
+			and	a
+			ld	b,c
+			add	a,(hl)
+			ld	c,b
+			ld	a,l
+			jr	Lb9f5
+			db	0fh,08h,e8h,cdh,06h,24h
+			ld	d,h
+			push	de
+			xor	d
+			sub	a
+			or	b
+			ld	e,b
+			or	h
+			jr	c,Lba36
+			daa
+			ld	b,l
+			ld	l,h
+			rra
+			ld	l,h
+			ld	l,a
+			ld	a,1fh
+			and	c
+			ld	de,c145h
+			call	z,L520d
+			ld	b,c
+			call	c,L03fb
+			push	hl
+			ld	e,l
+			sbc	a,(hl)
+			and	e
+			add	a,d
+			ret
+			db	73h,d8h,f6h,e1h,59h,aeh,2eh,8fh
+			db	b5h,e6h,77h,6dh,50h,7ah,01h,8dh
+			db	8bh,0eh,44h,3dh,84h,71h,beh,96h
+			db	31h,d6h,71h,31h,e1h,f3h,30h,0eh
+			db	bbh,f2h,00h,dch,3fh
+			ld	a,d
+			dec	(hl)
+			add	hl,hl
+			ld	b,d
+			ld	l,e
+			ret	nc
+			cp	(hl)
+			call	pe,L9168
+			jr	nc,Lbb00
+			ld	a,d
+			ld	l,b
+			ld	a,a
+			ld	l,(hl)
+			ld	hl,8c46h
+			ld	a,a
+			inc	ixl *
+			dec	l
+			ex	de,hl
+			cp	h
+			ld	b,a
+			cp	c
+			ld	c,d
+			rst	08h
+			ld	a,(de3bh)
+			ld	b,l
+			jp	nc,Lcea8
+			dec	h
+			ld	d,b
+			djnz	Lba77
+			add	a,h
+			nop
+			nop (2x) *
+			ld	l,e
+			sbc	a,(hl)
+			dec	d
+			jp	m,L1359
+			sbc	a,d
+			adc	a,b
+			ld	h,a
+			ld	b,(hl)
+			or	e
+			ld	a,c
+			rst	10h
+			ld	l,e
+			dec	(hl)
+			ld	a,b
+			pop	bc
+			ld	sp,hl
+			ex	(sp),hl
+			inc	l
+			xor	l
+			inc	bc
+			ld	hl,a8ech
+			ld	l,d
+			ld	(hl),l
+			ld	l,c
+			call	nc,Ldfe8
+			jp	nc,L0368
+			ld	c,a
+			sub	(hl)
+			ld	b,b
+			push	bc
+			ld	(e0e2h),a
+			sbc	a,l
+			jr	nz,Lbb24
+			jp	L7671
+			db	47h,a8h,59h,d5h,63h,fah,83h,88h
+			db	5ch,72h,03h,e8h
+			ld	b,e
+			jp	nc,L036c
+			or	e
+			ld	d,b
+			ld	a,h
+			nop
+			ld	b,c
+			ccf
+			adc	hl,bc
+			inc	e
+			ld	h,c
+			ld	e,c
+			ld	e,(hl)
+			ld	a,l
+			ld	d,d
+			adc	a,e
+			ld	a,l
+			ld	(hl),d
+			ld	a,h
+			and	h
+			call	nz,Lae54
+			ld	a,b
+			adc	a,c
+			and	fch
+			pop	af
+			ld	a,c
+			jp	c,Le154
+			dec	hl
+			dec	(hl)
+			push	hl
+			ld	c,(hl)
+			ld	h,e
+			ld	(hl),c
+			ld	l,e
+			inc	h
+			rst	30h
+			sbc	a,a
+			ld	a,(de)
+			and	d
+			or	d
+			ld	c,h
+			add	a,68h
+			sub	b
+			ld	l,d
+			ld	d,e
+			ld	sp,b20bh
+			ld	l,e
+			ld	(hl),d
+			add	hl,bc
+			sbc	a,l
+			jp	nz,L2ef9
+			rst	10h
+			inc	hl
+			cp	a
+			ld	c,d
+			adc	a,l
+			exx
+			jp	p,L0fab
+			push	af
+			res	3,a
+			push	bc
+			dec	h
+			add	a,(hl)
+			ld	l,(hl)
+			ld	(f86fh),a
+			add	a,l
+			nop
+			ld	c,47h
+			add	hl,hl
+			ld	a,(hl)
+			add	a,(hl)
+			ld	a,(hl)
+			ex	af,af'
+			ret
+			db	e9h,76h,56h,6ch,55h,26h,25h,6bh
+			db	52h,4fh,1ch,45h,86h
+			inc	sp
+			scf
+			cp	(hl)
+			ei
+			ld	l,h
+			jp	po,Lba22
+			add	a,a
+			sub	e
+			add	hl,bc
+			call	c,Ld117
+			ret	po
+			cpl
+			ld	(bc),a
+			ld	h,d
+			jp	(hl)
+			db	81h,75h,07h,35h,f9h,17h,e2h,52h
+			db	9fh,d0h,a3h,65h,bfh,0ch,bch,aah
+			db	f8h,87h,17h,8dh,9bh,50h,60h,11h
+			db	3fh,49h,33h,a1h,26h,4dh,88h,8eh
+			db	72h,b9h,2fh,d5h,44h,5fh,14h,c2h
+			db	37h,18h,1ah,a8h,b6h,80h,7fh,7dh
+			db	9eh,66h,43h,53h,13h,f2h,e0h,cah
+			db	57h,50h,cch,48h,e8h,bch,aah,f5h
+			db	71h,87h,85h,55h,3ah,ceh,a6h,9fh
+			db	22h,beh,cdh,afh,23h,b0h,9bh,f4h
+			db	abh,88h,ffh,3ch,98h,31h,4fh,fbh
+			db	fbh,f1h,f6h,e5h,2ch,81h,1bh,f1h
+			db	64h,e1h,9fh,58h,cah,0fh,a2h,c8h
+			db	1dh,03h,7fh,76h
+			sbc	a,afh
+			dec	h
+			and	l
+			ld	d,h
+			or	c
+			ld	(hl),a
+			jp	po,L7b75
+			xor	e
+			rst	18h
+			rst	38h
+			dec	e
+			sub	64h
+			ld	c,(hl)
+			sub	a
+			ret	p
+			djnz	Lbc2a
+			or	e
+			dec	de
+			rst	10h
+			ld	c,(hl)
+			cpl
+			ld	a,7bh
+			ld	c,b
+			add	a,(hl)
+			ld	c,d
+			rst	08h
+			rla
+			ld	e,ebh
+			ex	de,hl
+			cp	(hl)
+			and	d
+			ld	b,h
+			add	hl,de
+			ld	b,35h
+			ret	z
+			nop (2x) *
+			ld	b,(hl)
+			ld	sp,hl
+			and	(hl)
+			inc	bc
+			sub	c
+			ld	l,(hl)
+			ld	a,b
+			add	a,b2h
+			call	m,L897b
+			ccf
+			ld	c,(hl)
+			rst	20h
+			sbc	a,a
+			ld	sp,hl
+			ld	(hl),c
+			call	c,L643a
+			and	c
+			adc	a,h
+			ld	l,h
+			ld	d,l
+			ret	z
+			dec	bc
+			ld	d,e
+			ld	de,30a9h
+			ld	(8fb7h),hl
+			sbc	a,d
+			jp	nc,L847b
+			or	(hl)
+			sub	(hl)
+			ld	a,a
+			ld	d,a
+			or	l
+			ld	b,c
+			ld	c,(hl)
+			ld	(hl),l
+			dec	h
+			inc	l
+			push	hl
+			ld	l,l
+			ld	(63a1h),hl
+			ld	a,b
+			or	(hl)
+			ret	pe
+			ld	d,c
+			inc	e
+			inc	l
+			ld	l,h
+			adc	a,h
+			ld	b,d
+			ex	de,hl
+			pop	de
+			ld	sp,hl
+			xor	h
+			add	a,c
+			ld	a,(bc)
+			pop	bc
+			ld	a,l
+			ld	l,(hl)
+			ld	sp,33f0h
+			ld	a,a
+			sub	d
+			push	hl
+			adc	a,a
+			or	b
+			ex	de,hl
+			ld	b,b
+			ld	l,b
+			exx
+			ld	d,(hl)
+			ld	h,b
+			ret	nz
+			cp	c
+			ld	b,h
+			di
+			adc	a,b
+			cp	c
+			jr	nc,Lbc70
+			and	h
+			adc	a,cfh
+			ld	b,b
+			call	nz,La619
+			ret	nz
+			pop	af
+			ld	e,a
+			inc	(hl)
+			add	hl,bc
+			ret	m
+			ld	d,d
+			ld	e,l
+			dec	bc
+			call	c,L52c8
+			ld	(c6f1h),hl
+			ld	c,c5h
+			ld	l,(hl)
+			cp	a2h
+			ld	d,c
+			inc	c
+			ld	d,(hl)
+			ret	po
+			ld	h,b
+			push	hl
+			ld	b,h
+			ld	b,eeh
+			sub	cbh
+			call	pe,Lbdca
+			pop	de
+			ld	h,h
+			ld	a,(de)
+			xor	(hl)
+			ld	de,57c3h
+			dec	c
+			add	a,l
+			ld	sp,d54fh
+			ld	(hl),h
+			and	c
+			ld	e,e
+			inc	sp
+			ld	(3ce0h),hl
+			ld	l,b
+			add	a,b
+			call	c,L443e
+			ld	(de),a
+			ld	c,45h
+			djnz	Lbcb4
+			ld	l,d
+			rlca
+			dec	hl
+			adc	a,a
+			rlca
+			ld	h,(hl)
+			nop (2x) *
+			ld	b,e
+			ex	af,af'
+			ld	(hl),a
+			or	l
+			ld	d,b
+			ld	c,d
+			ex	de,hl
+			and	(hl)
+			ld	b,c
+			ld	e,b
+			ex	de,hl
+			jp	nz,Le875
+			ld	a,b
+			ld	h,c
+			out	(18h),a
+			ld	(hl),h
+			cp	b7h
+			add	hl,sp
+			sbc	a,a
+			and	l
+			pop	hl
+			call	nz,Ld55b
+			rlca
+			ld	d,(hl)
+			inc	(hl)
+			sub	(hl)
+			rst	28h
+			in	a,(b1h)
+			ld	c,e
+			jp	p,Ld957
+			adc	a,a
+			xor	e
+			add	a,d8h
+			or	(hl)
+			ld	e,d
+			xor	(hl)
+			ld	(hl),d
+			ret	m
+			ld	c,e
+			cp	3ah
+			ld	c,a
+			adc	a,l
+			jp	pe,L500d
+			ld	h,c
+			ret	nc
+			and	c
+			and	1bh
+			adc	a,a
+			ld	b,b
+			inc	sp
+			ret	nz
+			ld	iyh,a *
+			ld	a,d
+			dec	sp
+			inc	c
+			rrca
+			ld	c,(hl)
+			cp	b
+			ret	nz
+			dec	(hl)
+			ld	de,3ca0h
+			ld	(hl),a
+			jp	c,L888a
+			rst	08h
+			sub	c
+			rst	00h
+			add	hl,bc
+			ret	c
+			ld	sp,8b84h
+			ld	de,2cfeh
+			ld	b,l
+			xor	e
+			inc	a
+			adc	a,a
+			call	z,L07c7
+			inc	hl
+			dec	bc
+			sub	(hl)
+			ld	c,l
+			ld	b,(hl)
+			jp	nz,L0fac
+			ld	b,e
+			sbc	a,h
+			daa
+			xor	a5h
+			jp	p,L2bec
+			ld	(hl),e
+			ld	(hl),afh
+			xor	c
+			or	e
+			adc	a,b
+			dec	d
+			cp	e
+			jp	po,L924a
+			ld	b,c
+			ret	nz
+			cp	c
+			or	l
+			ld	h,e
+			ld	l,b
+			and	a
+			ex	af,af'
+			and	c
+			inc	l
+			jr	Lbd1f
+			db	66h,bfh,1ch,83h,9fh,54h,92h,aeh
+			db	8fh,e1h,fdh,88h,80h,7ah,93h,4dh
+			db	ach,efh,e6h,a2h,19h,d0h,e3h,0ah
+			db	39h,b5h,dah,19h,efh,98h,b1h,cch
+			db	4ah,fah,dch,a6h,feh,7eh,6eh,c3h
+			db	f5h,f4h,8bh,93h,8ah,67h,f5h,2fh
+			db	d7h,a7h,a3h,d4h,41h,34h,7dh,b2h
+			db	a7h,0fh,c5h,51h,1dh,15h
+			dec	de
+			ret	z
+			dec	l
+			and	b
+			ld	(bc),a
+			ld	e,ddh
+			sub	d
+			exx
+			ld	h,h
+			ret	z
+			sub	h
+			call	m,L322b
+			rst	20h
+			inc	b
+			ld	b,34h
+			ld	l,b
+			ld	b,c
+			ld	a,c
+			sub	h
+			ld	h,a
+			pop	bc
+			inc	d
+			ld	sp,hl
+			ld	d,h
+			ld	a,(bc)
+			ld	(fa24h),a
+			ld	c,e
+			jr	c,Lbdce
+			ld	e,e
+			sub	b
+			xor	a
+			adc	a,b
+			adc	a,d
+			call	pe,Lf2ad
+			nop
+			sub	c
+			ld	d,ddh
+			xor	adh
+			dec	b
+			ex	de,hl
+			ld	h,h
+			and	h
+			inc	b
+			inc	b
+			ld	c,h
+			cp	(hl)
+			ld	(hl),h
+			jp	p,L3b22
+			xor	e
+			ei
+			or	(hl)
+			rst	20h
+			or	h
+			or	b
+			ld	l,e
+			sbc	a,51h
+			dec	e
+			ld	b,d
+			ld	(hl),d
+			xor	l
+			sbc	a,h
+			out	(4bh),a
+			ld	h,a
+			ld	a,l
+			rst	38h
+			jp	(hl)
+			db	d3h,55h,61h,23h,9dh,1dh,8ah,dah
+			db	b6h,adh,27h,26h,1ah,e9h,dbh,4eh
+			ld	sp,hl
+			add	a,29h
+			inc	l
+			ret	m
+			ld	a,(8d13h)
+			ret	nc
+			xor	d
+			ld	b,b
+			ld	de,55feh
+			ld	c,d
+			rst	00h
+			dec	sp
+			jr	nz,Lbe7e
+			ld	(4fb2h),a
+			ld	e,a
+			rst	10h
+			push	bc
+			ret
+			db	5eh,31h,5ch,41h,adh,3bh,70h,d1h
+			db	8bh,37h,a5h,03h,53h,77h,83h,b2h
+			add	hl,de
+			ld	d,(hl)
+			ld	d,c
+			and	c
+			exx
+			or	d5h
+			inc	hl
+			ld	b,efh
+			ld	a,a8h
+			daa
+			ld	d,b
+			ld	c,b
+			ld	b,c
+			ld	h,9ch
+			ld	c,e
+			dec	l
+			ld	(hl),h
+			ld	a,73h
+			ld	a,(69bah)
+			ld	(5b04h),a
+			dec	e
+			ld	c,a
+			ld	b,b
+			ld	e,a2h
+			ld	bc,bc1ah
+			xor	d
+			ret	nc
+			ex	(sp),hl
+			add	a,(hl)
+			ld	h,l
+			ld	a,(de)
+			adc	a,h
+			sub	e
+			add	a,d
+			ld	a,c
+			ret	po
+			add	a,a
+			pop	af
+			dec	hl
+			inc	a
+			ld	c,39h
+			ret	nz
+			jp	nc,L7a0c
+			add	a,e
+			dec	h
+			ld	sp,hl
+			inc	l
+			inc	b
+			xor	c
+			call	c,Le64f
+			rla
+			ld	b,l
+			ld	d,l
+			jp	La381
+			and	d
+			ld	a,c
+			dec	(hl)
+			ld	c,a
+			ld	e,e
+			sub	h
+			ld	a,c
+			xor	(hl)
+			ld	d,l
+			and	b
+			ld	l,26h
+			or	(hl)
+			ld	h,l
+			or	d
+			out	(d0h),a
+			ld	d,c
+			jr	nz,Lbeef
+			add	a,c
+			adc	a,(hl)
+			ld	b,d
+			cp	h
+			or	a
+			sbc	a,(hl)
+			call	p,Lf2e4
+			ld	b,d
+			ld	c,h
+			inc	b
+			adc	a,c
+			cp	e
+			ld	h,b
+			jr	Lbe64
+			ld	a,l
+			and	l
+			ld	a,d
+			ret	m
+			ld	h,a
+			add	a,h
+			ld	e,c
+			ld	(de),a
+			jr	z,Lbf1e
+			di
+			add	a,h
+			or	b
+			pop	af
+			dec	sp
+			ret	po
+			inc	c
+			call	c,L4aae
+			sub	5fh
+			sbc	a,4bh
+			sub	d
+			inc	h
+			ld	l,(hl)
+			rst	20h
+			jp	z,L5c38
+			or	h
+			add	a,75h
+			ccf
+			scf
+			and	e
+			ld	l,b
+			ld	d,c
+			inc	hl
+			add	a,e
+			ld	(d568h),hl
+			ld	e,h
+			cp	e
+			ex	de,hl
+			dec	hl
+			ld	l,a
+			ld	h,b
+			xor	h
+			ld	l,4ch
+			ld	a,h
+			dec	sp
+			jp	po,L23d5
+			sbc	a,34h
+			and	e
+			inc	de
+			jr	nz,Lbf19
+			jp	c,L6a21
+			ld	c,h
+			jp	m,L78f9
+			push	de
+			ld	b,d
+			rst	08h
+			jp	po,L5265
+			ld	h,d8h
+			call	c,L30ca
+			daa
+			ld	a,d
+			cp	e
+			sub	(hl)
+			sbc	a,h
+			call	p,Ld148
+			ld	(de),a
+			ld	b,a
+			call	p,L7310
+			ld	(hl),e
+			ld	(9fe3h),a
+			or	c6h
+			add	hl,hl
+			inc	(hl)
+			sub	h
+			out	(29h),a
+			sbc	a,(hl)
+			dec	d
+			ld	h,l
+			add	a,e
+			dec	hl
+			dec	de
+			jp	c,L474e
+			ld	(hl),a
+			dec	hl
+			or	h
+			ld	b,h
+			ld	b,71h
+			sub	c
+			ld	l,l
+			inc	b
+			inc	b
+			dec	d
+			ld	bc,b943h
+			add	a,c
+			sub	b
+			call	pe,L59e6
+			jp	p,L476e
+			add	hl,sp
+			ld	d,c
+			adc	a,l
+			ld	(hl),l
+			inc	bc
+			and	b
+			add	a,h
+			rst	10h
+			dec	sp
+			cp	l
+			inc	e
+			inc	e
+			rst	38h
+			dec	de
+			ld	a,h
+			cp	b
+			ret
+			db	dah,edh,e8h,0ah,4bh,cah,3eh,8ch
+			db	32h,8fh,95h,17h,b6h,1dh,87h,ebh
+			db	2fh,99h,a6h,09h,14h,b1h
+			nop (2x) *
+			out	(a6h),a
+			and	(hl)
+			ld	hl,06eah
+			sbc	a,a
+			push	de
+			dec	hl
+			halt
+			ld	h,d
+			dec	de
+			and	c
+			ld	e,e
+			ret	z
+			add	hl,de
+			call	p,L6018
+			inc	b
+			sbc	a,d
+			xor	a
+			dec	h
+			rst	30h
+			ld	(de),a
+			halt
+			jp	po,L9794
+			jp	p,Lcab2
+			dec	e
+			sub	33h
+			sub	d
+			ld	(hl),h
+			adc	a,(hl)
+			add	a,25h
+			jr	nc,Lbf76
+			ld	d,(hl)
+			inc	c
+			dec	d
+			or	e
+			jp	nc,L3057
+			pop	hl
+			call	nc,L6eb7
+			dec	sp
+			jr	Lbf5e
+			db	beh,36h,f9h,5fh,03h,f8h,11h,eeh
+			db	ach,34h,58h,78h,32h,a5h,11h,46h
+			db	95h,2ch,15h,4ah
+			cpl
+			call	nc,L66b6
+			ld	sp,hl
+			ld	bc,82b4h
+			ld	(70a9h),hl
+			dec	c
+			xor	b0h
+			ld	a,h
+			daa
+			adc	a,a
+			ld	e,(hl)
+			call	c,L460e
+			cp	b1h
+			sub	d
+			cp	(hl)
+			dec	l
+			sub	e
+			sub	(hl)
+			push	hl
+			cp	b
+			ld	e,b
+			ld	(hl),h
+			jp	z,L82a6
+			or	l
+			di
+			ld	hl,7261h
+			sbc	a,e
+			ld	a,b
+			ret	m
+			inc	sp
+			ei
+			sbc	a,d
+			inc	d
+			ret	pe
+			call	po,L9790
+			inc	b
+			push	af
+			add	hl,bc
+			cp	l
+			ld	c,b
+			inc	bc
+			dec	l
+			ret	nc
+			rst	00h
+			ld	d,88h
+			halt
+			sub	b
+			add	a,h
+			or	h
+			call	L9eaf
+			inc	e
+			add	hl,sp
+			xor	c
+			sub	(hl)
+			ld	b,eeh
+			ld	l,h
+			out	(e4h),a
+			and	17h
+			ld	c,h
+			sub	b
+			and	l
+			jp	z,Lf1fb
+			ld	c,c
+			and	c
+			ei
+			ld	b,b
+			ld	e,a
+			cp	d
+			cp	e
+			add	hl,de
+			cp	b
+			ld	l,e
+			ld	de,4fb5h
+			inc	sp
+			ld	d,a
+			pop	af
+			or	e
+			inc	d
@@ -0,0 +1,2219 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	7fh,29h,3bh,55h,f7h,1ch,13h,e2h
+			db	b0h,71h,2eh,99h
+
+start:						; execution starting point
+			ret	p
+			call	nz,L3ae7
+			call	m,L6727
+			jp	z,Ld8a4
+			call	p,Laa17
+			adc	a,e
+			ld	a,(de)
+			adc	a,l
+			ld	b,e
+			jp	(hl)
+			db	c9h,c4h,99h,ebh,cah,6ah,3fh,3eh
+			db	f2h,5dh,00h,ceh,7ch,13h,69h,43h
+			db	e7h,50h,c1h,2fh,90h,3fh,fbh,49h
+			db	f1h,cdh,e9h,a4h,e4h,3fh,39h,59h
+			db	a5h,4bh,9fh,e7h,95h,7ch,2fh,91h
+			db	1fh,7ch,3ch,d6h,c4h,3bh,b9h,c3h
+			db	99h,1dh,42h,c0h,bah,f0h,35h,20h
+			db	04h,cbh,73h,e8h,5ah,4bh,0fh,aah
+			db	a9h,b3h,4dh,9ch,ddh,4ch,16h,c6h
+			db	f8h,c5h,dah,05h,d3h,b0h,9dh,0ah
+			db	6dh,3eh,15h,cch,0dh,7bh,feh,13h
+			db	2eh,bbh,45h,ddh,1ah,beh,19h,e4h
+			db	8ah,85h,aah,6dh,62h,4eh,b2h,e1h
+			db	14h,10h,3eh,38h,2eh,d9h,28h,83h
+			db	76h,5ah,c8h,16h,37h,8fh,c0h,2bh
+			db	d9h,5dh,66h,83h,54h,51h,6fh,86h
+			db	68h,bdh,4dh,4bh,03h,e9h,25h,1eh
+			db	6ch,0bh,4dh,69h,0dh,0dh,6eh,3dh
+			db	c2h,2eh,b8h,b8h,e5h,ffh,d0h,46h
+			db	e5h,8ch,a5h,d6h,48h,3ah,69h,aah
+			db	bbh,0bh,87h,69h,64h,34h,bch,8fh
+			db	46h,57h,f4h,8fh,bbh,f9h,4ah,65h
+			db	a4h,44h,07h,82h,b8h,f8h,ceh,44h
+			db	46h,feh,3dh,a0h,3ah,cah,03h,82h
+			db	8dh,8bh,5dh,a9h,4eh,5ch,c7h,e2h
+			db	b1h,d4h,72h,7ch,8dh,79h,b2h,39h
+			db	13h,32h,0bh,afh,98h,dch,6ch,2ch
+			db	e8h,d1h,6eh,4dh,25h,8eh,04h,f1h
+			db	9ah,90h,78h,b6h,87h,35h,0fh,f7h
+			db	efh,5fh,1ch,3ah,30h,d9h,e4h,64h
+			db	29h,a5h,aeh,91h,f0h,96h,a0h,efh
+			db	49h,13h,33h,08h,2dh,d7h,46h,ach
+			db	b4h,15h,73h,a4h,c8h,74h,8ch,c6h
+			db	29h,17h,33h,7dh,2ah,7eh,00h,01h
+			db	55h,26h,ach,88h,51h,03h,70h,7fh
+			db	12h,f2h,b9h,1bh,92h,94h,d1h,6ch
+			db	97h,22h,9bh,a1h,b1h,32h,0eh,03h
+			db	1dh,90h,c6h,bah,dch,cah,ebh,92h
+			db	c7h,10h,dah,04h,afh,e8h,2eh,19h
+			db	11h,b8h,10h,a9h,2bh,51h,41h,55h
+			db	fdh,a8h,8eh,0dh,f4h,49h,1ch,adh
+			db	4ah,67h,b2h,ech,e1h,9fh,4bh,ceh
+			db	c3h,1ah,87h,42h,a2h,83h,b4h,c7h
+			db	24h,1ah,67h,16h,65h,81h,92h,0eh
+			db	38h,cch,e9h,e0h,deh,fah,aah,6ah
+			db	69h,6bh,cfh,25h,8bh,c5h,39h,58h
+			db	04h,a1h,49h,86h,f8h,6bh,a7h,81h
+			db	19h,16h,32h,56h,95h,14h,c6h,2dh
+			db	87h,0ch,8ah,10h,81h,a7h,67h,f8h
+			db	9bh,d0h,b0h,99h,4dh,21h,e7h,63h
+			db	ach,87h,71h,0bh,7ch,f5h,51h,40h
+			db	67h,03h,79h,9dh,98h,92h,7bh,95h
+			db	91h,12h,edh,60h,2bh,2ah,10h,94h
+			db	36h,3dh,4dh,f6h,beh,e0h,0ch,f3h
+			db	c5h,3eh,a7h,80h,06h,edh,afh,c2h
+			db	a9h,b5h,62h,16h,dfh,07h,fch,16h
+			db	28h,f0h,3ah,0bh,6bh,82h,80h,5ch
+			db	50h,a2h,d6h,7dh,f6h,e8h,6ah,6bh
+			db	edh,5bh,b1h,4fh,f7h,9eh,26h,41h
+			db	42h,b7h,4ah,a3h,9bh,fah,21h,5dh
+			db	31h,34h,8ah,0eh,75h,edh,17h,55h
+			db	6ah,55h,5ch,edh,91h,a9h,76h,e9h
+			db	f8h,53h,f5h,57h,4ch,80h,51h,2dh
+			db	24h,00h,93h,6fh,5dh,94h,48h,c0h
+			db	4fh,93h,dah,39h,5fh,feh,81h,56h
+			db	f3h,a0h,19h,dah,b1h,3dh,12h,e9h
+			db	95h,f7h,73h,67h,3fh,35h,10h,73h
+			db	5bh,0dh,bdh,3eh,19h,7eh,57h,76h
+			db	a2h,adh,71h,02h,e3h,b1h,abh,6ah
+			db	9eh,78h,f1h,f1h,a4h,f6h,17h,c7h
+			db	67h,80h,24h,7ch,61h,c9h,dah,3bh
+			db	9fh,31h,09h,afh,7bh,16h,eeh,9bh
+			db	c8h,63h,2eh,05h,87h,57h,d7h,52h
+			db	cch,0dh,05h,cch,e0h,23h,9dh,cdh
+			db	d1h,87h,12h,bbh,c6h,38h,91h,d0h
+			db	e3h,b4h,41h,eah,e5h,7ch,a2h,6ch
+			db	4bh,f3h,d9h,42h,41h,ddh,ceh,43h
+			db	04h,49h,10h,f0h,bbh,10h,25h,dfh
+			db	f5h,c7h,0ch,c4h,85h,82h,d4h,75h
+			db	84h,b2h,33h,6fh,4ch,4eh,37h,f0h
+			db	56h,67h,86h,84h,0eh,5ch,82h,15h
+			db	07h,37h,d1h,49h,52h,72h,5fh,5dh
+			db	0ah,c1h,f9h,15h,49h,7ah,7bh,4ah
+			db	70h,5ch,55h,76h,dch,d2h,73h,41h
+			db	0dh,b3h,c5h,54h,f4h,bbh,e5h,efh
+			db	b8h,82h,84h,e1h,00h,75h,15h,31h
+			db	97h,a8h,82h,c7h,51h,a0h,7fh,a0h
+			db	dch,cbh,d1h,57h,c1h,25h,a3h,fch
+			db	3eh,58h,77h,5eh,52h,02h,9bh,34h
+			db	87h,3dh,fch,90h,79h,fbh,3fh,5fh
+			db	8eh,ceh,bah,5ah,1ch,5bh,30h,a2h
+			db	72h,cfh,f7h,91h,18h,26h,71h,69h
+			db	1fh,09h,e0h,b2h,40h,cdh,deh,b7h
+			db	4dh,a5h,26h,5fh,a4h,8fh,27h,b6h
+			db	d8h,20h,84h,5dh,fch,57h,8ch,0ch
+			db	f2h,efh,f6h,b3h,cfh,62h,b8h,10h
+			db	ceh,b2h,4bh,38h,6bh,4fh,02h,21h
+			db	4eh,96h,b0h,2dh,ebh,1fh,31h,47h
+			db	0dh,1eh,9bh,7eh,f2h,2fh,ebh,7eh
+			db	10h,32h,09h,e9h,d4h,85h,6fh,66h
+			db	76h,87h,6ch,cbh,12h,d3h,cdh,d3h
+			db	e9h,21h,83h,26h,53h,92h,c8h,b6h
+			db	b8h,a4h,c2h,09h,45h,2dh,88h,a0h
+			db	48h,98h,fbh,0ch,13h,fch,0eh,2bh
+			db	54h,76h,6ah,08h,6dh,a7h,07h,f8h
+			db	01h,eeh,0bh,19h,cch,c5h,6fh,3fh
+			db	f2h,b0h,9eh,b4h,e8h,86h,a4h,f0h
+			db	5eh,d3h,f3h,78h,6dh,98h,c7h,5eh
+			db	b6h,90h,5ch,ffh,20h,0eh,beh,dah
+			db	efh,32h,e1h,d3h,48h,a6h,bdh,b2h
+			db	84h,e3h,96h,b0h,bch,11h,f9h,cah
+			db	3fh,bdh,56h,c3h,22h,d1h,8eh,e9h
+			db	04h,0ah,f4h,b3h,fbh,24h,42h,cch
+			db	1dh,21h,2dh,89h,bbh,33h,23h,8dh
+			db	f6h,4ch,05h,bah,28h,cch,95h,11h
+			db	63h,a5h,05h,b0h,7fh,9ah,f4h,a7h
+			db	f1h,69h,27h,1ah,67h,21h,6ch,48h
+			db	fch,6dh,48h,bfh,5dh,6dh,c0h,6ah
+			db	20h,69h,9bh,59h,9eh,b9h,d9h,f3h
+			db	adh,7ah,6eh,20h,4ch,55h,55h,80h
+			db	7fh,dfh,37h,1fh,72h,9eh,bbh,4eh
+			db	f9h,02h,20h,1dh,6ch,52h,00h,76h
+			db	f3h,4dh,69h,18h,ddh,c1h,08h,7dh
+			db	94h,87h,9eh,7eh,80h,58h,5dh,12h
+			db	ebh,47h,4bh,11h,93h,54h,0ch,1bh
+			db	6bh,e9h,8ah,77h,24h,aeh,8bh,8fh
+			db	d5h,d1h,a4h,a5h,d3h,9fh,4ch,48h
+			db	2dh,9dh,3fh,c8h,86h,27h,a9h,6dh
+			db	c5h,86h,17h,cch,36h,cfh,9ch,77h
+			db	ceh,40h,8fh,8ch,feh,11h,bdh,49h
+			db	7bh,63h,a6h,c8h,52h,a0h,08h,e8h
+			db	87h,e3h,5eh,1ah,d5h,6bh,f7h,6ah
+			db	10h,7dh,71h,bch,aah,1eh,a0h,adh
+			db	d6h,a1h,73h,12h,c4h,70h,0ch,0eh
+			db	e2h,43h,02h,5bh,98h,ddh,26h,18h
+			db	d9h,5dh,84h,21h,63h,7eh,6bh,d5h
+			db	8ch,25h,c3h,90h,bah,cah,2fh,4bh
+			db	bdh,fdh,eeh,72h,12h,1eh,d7h,f0h
+			db	97h,4fh,c1h,59h,8ch,dbh,13h,06h
+			db	6fh,39h,43h,5ch,ach,34h,ech,3fh
+			db	6fh,a8h,6ah,3ah,4dh,ech,75h,60h
+			db	23h,d4h,99h,d6h,88h,c6h,a7h,6bh
+			db	82h,a1h,97h,1fh,75h,c6h,8dh,92h
+			db	7ah,7ch,bfh,a1h,b0h,b5h,68h,bch
+			db	52h,fch,8bh,fdh,88h,21h,80h,7eh
+			db	74h,efh,40h,23h,95h,41h,0dh,c0h
+			db	9eh,c1h,1ch,25h,61h,87h,36h,f6h
+			db	fch,57h,b6h,d3h,98h,04h,fah,bch
+			db	e0h,43h,bfh,28h,9ah,e0h,eeh,ach
+			db	b6h,fbh,bah,0bh,0ch,4fh,14h,9ch
+			db	95h,4fh,b1h,ach,01h,55h,efh,0ch
+			db	e2h,83h,f4h,71h,1ch,e8h,41h,f6h
+			db	77h,24h,afh,55h,e7h,2bh,38h,09h
+			db	beh,2eh,43h,67h,b5h,4eh,6fh,27h
+			db	47h,9bh,00h,69h,fdh,cbh,81h,5ah
+			db	ddh,bah,b7h,0ah,36h,3eh,d1h,f0h
+			db	39h,a3h,4ah,cbh,89h,10h,97h,dah
+			db	f6h,fdh,cah,40h,57h,61h,57h,5eh
+			db	33h,ceh,26h,47h,1ch,4dh,88h,87h
+			db	b6h,d4h,eah,c3h,3dh,2dh,cch,13h
+			db	aah,c6h,c5h,e2h,b1h,1fh,11h,35h
+			db	05h,3bh,33h,dch,ebh,5ah,b3h,98h
+			db	60h,70h,a0h,aah,ceh,8bh,08h,32h
+			db	c3h,a1h,a3h,a8h,23h,31h,e6h,f3h
+			db	f5h,e1h,51h,f9h,d3h,11h,c1h,53h
+			db	1ch,c0h,78h,05h,f6h,10h,d2h,53h
+			db	3ah,b2h,0eh,9fh,58h,e1h,40h,d1h
+			db	a8h,52h,34h,14h,46h,dch,4ah,9fh
+			db	08h,80h,27h,1dh,6ah,b9h,5ah,1fh
+			db	8dh,74h,ceh,33h,9fh,dfh,c0h,adh
+			db	1ch,e5h,a0h,54h,6ah,38h,8eh,51h
+			db	3dh,40h,8ah,26h,20h,74h,d9h,66h
+			db	31h,8fh,e2h,2ah,11h,f7h,e5h,9bh
+			db	ddh,f4h,7bh,f6h,51h,27h,64h,ech
+			db	58h,d9h,27h,beh,82h,ffh,a0h,75h
+			db	c8h,95h,44h,efh,78h,5bh,89h,45h
+			db	97h,97h,6ch,3eh,c9h,5eh,7ch,93h
+			db	54h,79h,98h,c7h,00h,d8h,63h,5ch
+			db	bah,8ch,ddh,0bh,2dh,e5h,e9h,e6h
+			db	46h,2ch,cdh,33h,7dh,bah,23h,4ch
+			db	83h,1ch,feh,bfh,0fh,3dh,76h,d0h
+			db	4dh,a0h,06h,6ch,31h,86h,b1h,cdh
+			db	b8h,2ah,d7h,21h,49h,60h,99h,f6h
+			db	86h,80h,adh,aah,3dh,60h,e6h,20h
+			db	dah,c7h,d9h,cbh,9ch,42h,72h,cdh
+			db	03h,fdh,01h,13h,2eh,61h,48h,08h
+			db	2ah,f5h,1ah,40h,a4h,80h,c6h,01h
+			db	a8h,a2h,3fh,10h,87h,98h,e7h,40h
+			db	75h,3ch,69h,60h,13h,0dh,83h,b8h
+			db	7ah,fbh,2eh,edh,62h,e5h,34h,02h
+			db	17h,96h,35h,f3h,71h,d6h,4eh,44h
+			db	08h,c4h,4dh,4eh,37h,9bh,d6h,cah
+			db	cdh,13h,55h,84h,05h,bdh,29h,d1h
+			db	d6h,7dh,32h,89h,bbh,cfh,2fh,03h
+			db	81h,d9h,2bh,d6h,71h,47h,d0h,44h
+			db	12h,cdh,52h,8dh,49h,1eh,e9h,79h
+			db	ceh,abh,dch,0dh,3dh,2dh,4ch,b6h
+			db	c5h,0dh,efh,a7h,1eh,84h,c4h,a7h
+			db	60h,72h,04h,fdh,c3h,71h,f5h,9ah
+			db	72h,81h,3fh,a0h,4ch,4fh,cbh,c7h
+			db	84h,83h,02h,9bh,34h,f8h,aeh,18h
+			db	05h,96h,abh,60h,0ah,e5h,f5h,a3h
+			db	88h,85h,9bh,07h,d1h,31h,f3h,e2h
+			db	29h,c0h,0dh,5eh,36h,65h,1ch,89h
+			db	eah,70h,1bh,05h,69h,7bh,bdh,7eh
+			db	01h,6bh,41h,57h,37h,39h,70h,9ah
+			db	f4h,1dh,ddh,32h,43h,d1h,78h,47h
+			db	19h,bbh,e8h,02h,35h,8fh,5ch,fdh
+			db	55h,2eh,63h,ffh,21h,77h,72h,a9h
+			db	a5h,82h,a1h,68h,eah,0ah,bah,2eh
+			db	f3h,60h,feh,1eh,b0h,dbh,b8h,a5h
+			db	6fh,14h,b4h,0ch,d6h,0dh,d0h,9dh
+			db	d1h,f4h,84h,7ch,83h,0eh,b2h,ebh
+			db	5ch,9fh,a2h,b0h,d7h,2dh,01h,80h
+			db	3ch,fdh,d5h,a3h,4ah,42h,9eh,12h
+			db	b5h,6ah,a0h,88h,0fh,c3h,efh,79h
+			db	fah,f3h,9fh,feh,01h,9fh,04h,7ah
+			db	81h,73h,4eh,3eh,49h,46h,bbh,b1h
+			db	88h,6eh,79h,0ah,9bh,ceh,ebh,dbh
+			db	75h,7eh,39h,a5h,8bh,a2h,bfh,eah
+			db	1bh,23h,dch,2eh,89h,e1h,11h,c6h
+			db	43h,bah,d6h,80h,98h,dch,bch,61h
+			db	b6h,82h,57h,b3h,2bh,83h,ddh,1dh
+			db	2ah,17h,bfh,78h,4dh,26h,86h,6eh
+			db	dfh,24h,70h,96h,0bh,01h,a3h,77h
+			db	85h,f7h,a3h,48h,b6h,02h,d5h,dch
+			db	41h,3fh,8bh,1eh,88h,80h,bfh,4dh
+			db	75h,1ch,2bh,45h,62h,1ch,96h,9dh
+			db	77h,ddh,94h,40h,62h,feh,e3h,c1h
+			db	00h,3bh,cbh,92h,e7h,09h,d2h,36h
+			db	64h,85h,00h,3ah,26h,97h,bbh,a6h
+			db	9fh,cdh,ddh,f7h,79h,d5h,85h,0bh
+			db	63h,33h,f0h,62h,c2h,06h,4fh,09h
+			db	efh,31h,4fh,03h,edh,23h,01h,37h
+			db	b3h,d2h,85h,3eh,dbh,bbh,55h,beh
+			db	9dh,0ch,45h,5ah,e1h,0ch,b9h,24h
+			db	fch,9eh,10h,a6h,46h,88h,7ch,6bh
+			db	6dh,2ch,30h,bch,dfh,8bh,8fh,b3h
+			db	92h,bfh,aeh,f9h,2fh,07h,d2h,9dh
+			db	54h,d5h,1ch,f7h,2fh,42h,a0h,68h
+			db	2ch,12h,beh,96h,5dh,4fh,e8h,68h
+			db	42h,7eh,07h,fdh,cah,edh,dbh,4dh
+			db	25h,a3h,2fh,38h,2eh,73h,c0h,e6h
+			db	afh,abh,8dh,2dh,6eh,0ch,96h,9ah
+			db	8dh,4bh,f9h,fdh,16h,2fh,cch,16h
+			db	73h,c7h,4ah,dah,76h,4fh,83h,0bh
+			db	c1h,42h,74h,a2h,80h,68h,7fh,ach
+			db	09h,c1h,b6h,a9h,cah,b3h,b2h,2dh
+			db	5ch,70h,13h,cdh,34h,38h,d0h,9ch
+			db	5ah,bah,3dh,b6h,d3h,3ah,bah,36h
+			db	1bh,9bh,43h,60h,84h,66h,e6h,54h
+			db	06h,8ah,5dh,9bh,c0h,b5h,bch,4dh
+			db	e5h,ceh,cah,64h,5fh,3ah,b0h,19h
+			db	b0h,b5h,e5h,beh,5ch,61h,bfh,40h
+			db	0ch,94h,21h,0fh,a9h,74h,69h,46h
+			db	fdh,19h,59h,59h,78h,47h,44h,86h
+			db	9ch,33h,0fh,cdh,78h,62h,edh,c9h
+			db	8bh,e8h,b8h,2fh,50h,32h,98h,0ah
+			db	aah,d4h,11h,46h,7dh,50h,dfh,06h
+			db	afh,69h,33h,c6h,aeh,29h,47h,4eh
+			db	a9h,19h,ech,98h,cah,78h,e1h,efh
+			db	b3h,2ah,f4h,deh,4bh,e8h,07h,3eh
+			db	a8h,c7h,88h,7ch,05h,93h,3fh,2ch
+			db	ebh,08h,1dh,22h,01h,25h,30h,10h
+			db	bbh,d2h,49h,b5h,b9h,05h,0bh,8fh
+			db	dch,7ah,aah,bch,7ah,4dh,7bh,a8h
+			db	97h,67h,41h,44h,e4h,69h,0bh,6fh
+			db	70h,52h,e7h,4dh,25h,aeh,1ah,33h
+			db	abh,e6h,74h,63h,d4h,95h,99h,63h
+			db	90h,d0h,b0h,f1h,87h,82h,3ah,53h
+			db	ffh,1fh,dch,0dh,bdh,5ah,11h,a5h
+			db	a5h,0ch,1ah,95h,33h,4eh,61h,cah
+			db	3fh,a0h,a7h,02h,79h,23h,dah,0ch
+			db	efh,77h,37h,f9h,6ch,2fh,2dh,f6h
+			db	a8h,d3h,e5h,52h,99h,e0h,ddh,1dh
+			db	46h,5ah,abh,94h,87h,40h,f1h,71h
+			db	4fh,4bh,a9h,e1h,83h,66h,73h,67h
+			db	0ch,1ah,5fh,e2h,37h,0ah,0bh,66h
+			db	ddh,f0h,9eh,03h,cah,83h,94h,44h
+			db	8fh,22h,1ch,8fh,bch,ech,d7h,03h
+			db	38h,a6h,47h,9ch,cfh,2ch,efh,6ah
+			db	0eh,4dh,8ch,76h,b1h,44h,3ah,2eh
+			db	f4h,b2h,1eh,3ch,4ah,4dh,55h,f3h
+			db	65h,38h,50h,50h,6eh,1eh,01h,03h
+			db	fdh,80h,78h,f7h,94h,53h,8dh,66h
+			db	a1h,1fh,fch,78h,d2h,11h,d7h,cfh
+			db	d8h,29h,8ah,e1h,31h,26h,9ah,a0h
+			db	bbh,f3h,69h,5eh,36h,b1h,14h,ach
+			db	87h,e4h,03h,dah,b1h,a7h,3ah,3eh
+			db	36h,91h,7ch,9ah,6ah,04h,3ch,b3h
+			db	3eh,57h,2dh,0dh,1ch,f6h,0fh,d7h
+			db	d9h,42h,f4h,2ch,f5h,73h,1ah,9bh
+			db	e5h,1ch,27h,b5h,c2h,3eh,19h,e3h
+			db	dah,fdh,e2h,afh,09h,54h,e4h,61h
+			db	6ch,38h,2dh,b5h,1fh,1eh,43h,7bh
+			db	44h,2ch,1fh,21h,dch,6bh,cah,f8h
+			db	06h,6ah,b4h,9fh,aeh,efh,3fh,e3h
+			db	ech,83h,6eh,73h,3fh,f3h,65h,9bh
+			db	8fh,1ah,e2h,bfh,6dh,f0h,08h,62h
+			db	70h,77h,c4h,63h,22h,66h,9ah,90h
+			db	18h,a8h,85h,61h,36h,84h,02h,4ch
+			db	b2h,0ah,85h,84h,c6h,8bh,5ch,e2h
+			db	b8h,74h,eeh,abh,23h,9bh,19h,5bh
+			db	a3h,0dh,deh,53h,0ch,76h,cch,c1h
+			db	4eh,4eh,66h,09h,73h,51h,6fh,4ch
+			db	a9h,2bh,95h,79h,3bh,47h,e9h,b3h
+			db	18h,58h,1fh,c1h,f9h,d3h,1ch,58h
+			db	99h,38h,05h,60h,7dh,a3h,60h,a8h
+			db	0ch,fah,b0h,8ah,84h,90h,8ch,42h
+			db	bah,82h,0ch,62h,c6h,4eh,d4h,00h
+			db	dfh,4fh,c2h,01h,89h,5ch,34h,f4h
+			db	d6h,59h,d1h,3eh,ebh,02h,ddh,23h
+			db	0ch,cah,9fh,99h,95h,3fh,d8h,22h
+			db	dfh,cfh,64h,4dh,70h,c3h,94h,1dh
+			db	90h,ffh,6fh,25h,9dh,a7h,53h,92h
+			db	7eh,74h,6ch,0ah,62h,9eh,d0h,96h
+			db	1fh,03h,e0h,56h,0fh,38h,f9h,7fh
+			db	13h,51h,60h,eah,69h,44h,32h,90h
+			db	20h,71h,7fh,a3h,9fh,32h,9ch,54h
+			db	60h,d9h,f3h,87h,92h,12h,18h,46h
+			db	f5h,51h,91h,39h,8ah,1bh,7ch,23h
+			db	c7h,f7h,b4h,cdh,10h,c1h,5dh,20h
+			db	d4h,5fh,d0h,04h,6eh,b4h,1eh,2ch
+			db	fch,7eh,8fh,c9h,6eh,77h,66h,bdh
+			db	6eh,22h,79h,6fh,68h,2fh,c1h,0ah
+			db	f2h,a9h,fdh,a5h,67h,b9h,dfh,15h
+			db	b0h,65h,5fh,05h,b4h,f2h,3bh,0bh
+			db	86h,dbh,a3h,52h,0ah,e0h,59h,62h
+			db	3ah,83h,e2h,f0h,deh,45h,1eh,9ah
+			db	2dh,f1h,45h,12h,01h,4ah,6bh,b6h
+			db	e3h,16h,30h,71h,23h,dah,a2h,8fh
+			db	23h,39h,57h,17h,0dh,fdh,9bh,26h
+			db	5dh,4ah,7fh,ceh,68h,57h,11h,aeh
+			db	a1h,94h,a9h,ech,1ch,14h,47h,25h
+			db	94h,1ch,e4h,d2h,0ah,d1h,58h,c4h
+			db	ech,54h,05h,36h,bch,ebh,e7h,42h
+			db	c4h,57h,2bh,75h,25h,70h,d4h,89h
+			db	4dh,48h,edh,3dh,b5h,64h,adh,37h
+			db	cah,d8h,cfh,feh,b2h,efh,a3h,b9h
+			db	94h,e9h,fah,94h,deh,86h,21h,53h
+			db	e0h,d4h,55h,f1h,bbh,64h,77h,22h
+			db	c3h,e7h,2ah,56h,00h,61h,92h,ech
+			db	bah,33h,87h,6eh,57h,f7h,c5h,c4h
+			db	eeh,feh,03h,79h,75h,06h,48h,4fh
+			db	e9h,05h,9ah,94h,55h,24h,99h,09h
+			db	15h,cch,c8h,5fh,54h,9ah,c6h,27h
+			db	8bh,61h,a8h,34h,e6h,dah,a6h,bdh
+			db	84h,70h,23h,13h,d3h,3ah,ddh,c3h
+			db	92h,5bh,68h,c3h,50h,0ah,28h,4fh
+			db	51h,edh,9bh,a7h,3eh,66h,7fh,95h
+			db	02h,a5h,96h,48h,b9h,32h,46h,e9h
+			db	d9h,e2h,0eh,a8h,5bh,f3h,49h,90h
+			db	c0h,80h,47h,d2h,19h,e3h,69h,ffh
+			db	81h,44h,81h,06h,7ch,abh,4ah,a7h
+			db	02h,a0h,d9h,88h,4dh,c2h,a6h,60h
+			db	72h,71h,77h,53h,8fh,68h,c9h,57h
+			db	94h,9ah,27h,72h,69h,71h,54h,fch
+			db	ebh,55h,e9h,35h,d8h,b7h,6dh,aeh
+			db	4bh,10h,4dh,a2h,1eh,72h,87h,5fh
+			db	70h,07h,4bh,cfh,6bh,3fh,81h,78h
+			db	6eh,46h,b6h,efh,7eh,c3h,71h,feh
+			db	92h,79h,07h,2dh,44h,40h,cfh,75h
+			db	95h,b0h,edh,64h,3eh,3eh,f1h,91h
+			db	61h,65h,43h,95h,83h,7bh,11h,22h
+			db	68h,50h,05h,ach,30h,ceh,1bh,f3h
+			db	52h,00h,d4h,45h,56h,13h,57h,c5h
+			db	0ch,e8h,d8h,fch,61h,5ch,42h,dbh
+			db	03h,ech,58h,0fh,5ah,f0h,71h,46h
+			db	a8h,62h,02h,c2h,44h,6fh,6bh,e1h
+			db	fah,0fh,d9h,5ah,eeh,9ah,a1h,03h
+			db	f0h,5eh,17h,bdh,abh,13h,83h,c8h
+			db	5bh,79h,b3h,eah,fch,a3h,3ah,b4h
+			db	90h,57h,83h,afh,deh,61h,a9h,06h
+			db	f9h,6fh,dch,89h,a6h,13h,f6h,b3h
+			db	beh,78h,6ch,cah,08h,e8h,edh,38h
+			db	0fh,e6h,67h,59h,b8h,2dh,39h,c4h
+			db	30h,48h,83h,c1h,7dh,47h,f3h,0ah
+			db	b0h,91h,80h,69h,42h,79h,98h,73h
+			db	8ch,3bh,dch,dch,c4h,c0h,37h,3fh
+			db	61h,3ah,77h,4dh,a1h,85h,10h,f6h
+			db	fah,5fh,9fh,7eh,d4h,aah,e3h,0ch
+			db	85h,33h,cch,48h,70h,64h,f3h,30h
+			db	11h,bdh,0dh,e4h,7ah,eeh,1fh,1ah
+			db	cch,a1h,87h,5ah,e6h,cfh,1fh,10h
+			db	c5h,2bh,bdh,5dh,4dh,5eh,ebh,e6h
+			db	96h,13h,46h,3fh,c9h,68h,bch,a9h
+			db	6fh,90h,0ch,b2h,73h,43h,82h,a4h
+			db	5dh,d1h,a3h,77h,0eh,d2h,7fh,1bh
+			db	43h,b1h,b9h,06h,c7h,42h,abh,dah
+			db	97h,d6h,aah,5dh,f1h,26h,c0h,1ch
+			db	0ah,e4h,4ch,53h,eah,46h,5bh,51h
+			db	39h,97h,84h,7ch,53h,ach,93h,c6h
+			db	2eh,45h,e6h,40h,edh,12h,9eh,84h
+			db	89h,cbh,a3h,6bh,9ch,1dh,c6h,3dh
+			db	c2h,e7h,d1h,e5h,f5h,23h,a0h,6ch
+			db	4bh,f9h,99h,c4h,11h,d1h,24h,06h
+			db	e5h,12h,04h,2dh,ebh,85h,38h,91h
+			db	2fh,3eh,d4h,afh,2ah,3fh,e3h,8dh
+			db	e7h,e7h,64h,fdh,e8h,07h,fah,24h
+			db	81h,c7h,f4h,d3h,6eh,feh,e8h,42h
+			db	d7h,73h,29h,2dh,6dh,52h,c8h,e1h
+			db	93h,4ah,54h,90h,49h,e6h,44h,66h
+			db	93h,66h,cch,8ch,d1h,f6h,06h,82h
+			db	41h,7eh,43h,efh,8eh,c6h,5ch,d2h
+			db	14h,c1h,60h,51h,dbh,b9h,adh,02h
+			db	8ch,c8h,86h,a2h,68h,fbh,f8h,41h
+			db	26h,f0h,34h,aeh,fch,5fh,36h,9fh
+			db	58h,10h,61h,67h,66h,6ah,a8h,62h
+			db	0ah,a9h,08h,d4h,73h,c3h,c4h,09h
+			db	d6h,f6h,13h,d0h,21h,42h,65h,a8h
+			db	e2h,42h,e4h,ceh,f6h,ebh,77h,d3h
+			db	bfh,15h,98h,13h,6dh,ach,bdh,5bh
+			db	f2h,eah,61h,a3h,3ah,01h,5fh,66h
+			db	c2h,19h,34h,04h,5eh,49h,aah,b9h
+			db	bah,13h,22h,40h,b9h,73h,e6h,2ah
+			db	99h,1bh,c0h,00h,d0h,1bh,e5h,65h
+			db	83h,07h,c8h,70h,e2h,16h,5bh,b2h
+			db	b1h,53h,ebh,0ch,c9h,78h,85h,36h
+			db	d8h,5dh,5dh,44h,76h,bfh,c5h,c1h
+			db	5eh,b5h,85h
+			dec	bc
+			ret
+			db	66h,c6h,b4h,34h,97h,a2h,98h,96h
+			db	27h,b1h,85h,19h,45h,59h,eeh,29h
+			db	afh,dbh,45h,73h,32h,50h,e6h,4dh
+			db	bah,6ch,25h,21h,38h,67h,a4h,51h
+			db	58h,41h,c7h,16h,40h,9bh,7ch,3bh
+			db	35h,61h,43h,9ch,79h,aeh,ech,8bh
+			db	bdh,08h,bbh,5bh,8ch,6bh,2dh,59h
+			db	0dh,d6h,0dh,e3h,2fh,f0h,bch,0fh
+			db	7ch,bah,17h,57h,e2h,b9h,06h,d4h
+			db	28h,f9h,d0h,feh,ceh,50h,90h,c8h
+			db	1ah,15h,35h,51h,73h,9fh,72h,73h
+			db	0eh,29h,97h,38h,f1h,c8h,6eh,7ch
+			db	1ch,3eh,41h,fch,f8h,81h,c3h,8dh
+			db	d8h,ffh,1eh,83h,9ch,1dh,5fh,bdh
+			db	36h,dfh,2dh,9fh,f0h,eah,c9h,91h
+			db	55h,28h,35h,a0h,efh,08h,dbh,4dh
+			db	7fh,58h,b2h,3ch,62h,11h,21h,05h
+			db	39h,9ah,29h,64h,ach,7bh,f0h,7ch
+			db	7bh,cah,8eh,5eh,a5h,49h,e4h,bah
+			db	dbh,76h,95h,6dh,a7h,b1h,57h,67h
+			db	a6h,90h,79h,d3h,d9h,58h,88h,6ah
+			db	c5h,04h,9bh,72h,3ah,ebh,beh,f2h
+			db	a9h,39h,fah,20h,aah,d4h,39h,2ch
+			db	55h,ffh,03h,f1h,d1h,aah,94h,bdh
+			db	ach,01h,aeh,71h,26h,28h,9bh,34h
+			db	31h,4fh,2eh,c4h,71h,d9h,2ch,afh
+			db	02h,a9h,f0h,90h,96h,cch,b1h,e2h
+			db	f0h,17h,08h,18h,f5h,25h,39h,4dh
+			db	1fh,45h,d1h,a0h,f2h,4ah,77h,56h
+			db	abh,a5h,fbh,91h,a5h,fdh,84h,e1h
+			db	a5h,98h,9dh,e8h,d6h,12h,55h,08h
+			db	d1h,4dh,61h,dah,f2h,58h,f9h,2fh
+			db	e6h,bch,19h,fdh,deh,e5h,76h,ach
+			db	a8h,82h,afh,e1h,d2h,3ch,04h,9ah
+			db	abh,25h,a2h,a2h,bbh,f9h,84h,8fh
+			db	44h,6eh,66h,dah,2fh,3eh,61h,afh
+			db	04h,5bh,f2h,beh,94h,03h,b9h,e6h
+			db	a9h,a1h,b2h,6ah,93h,a6h,29h,72h
+			db	2bh,76h,f5h,cfh,85h,ddh,bdh,1bh
+			db	6bh,48h,ddh,23h,d0h,e8h,5eh,a7h
+			db	e3h,0eh,6bh,ach,1dh,8eh,5fh,f7h
+			db	38h,f0h,46h,f1h,78h,7fh,9bh,3ah
+			db	16h,f7h,e2h,49h,c8h,a2h,e1h,85h
+			db	83h,25h,27h,6ch,7bh,11h,dbh,24h
+			db	5bh,1dh,c3h,d4h,09h,d5h,7dh,dbh
+			db	44h,82h,a9h,cch,33h,91h,01h,5bh
+			db	cah,1bh,a2h,d3h,dch,38h,c9h,16h
+			db	48h,a6h,07h,c2h,1dh,b6h,96h,e8h
+			db	d4h,6bh,81h,e9h,4ah,c4h,85h,37h
+			db	90h,69h,69h,b9h,3ah,10h,f6h,98h
+			db	53h,e1h,ceh,58h,dfh,e2h,cbh,c4h
+			db	00h,11h,54h,07h,1ah,49h,b7h,21h
+			db	c0h,dfh,2ch,47h,2ch,1ah,08h,f3h
+			db	9dh,87h,38h,1fh,0dh,1dh,0bh,86h
+			db	08h,a2h,a3h,11h,4ah,c6h,88h,cdh
+			db	7bh,56h,c8h,c6h,0ch,5fh,c7h,92h
+			db	5ah,efh,88h,dbh,cbh,b7h,3ch,ech
+			db	7dh,31h,0eh,afh,0dh,7ah,a3h,29h
+			db	59h,90h,8bh,d9h,81h,5ah,63h,19h
+			db	94h,afh,88h,88h,69h,8fh,cfh,7ah
+			db	68h,b6h,9ch,60h,aah,94h,9ah,55h
+			db	46h,e9h,abh,66h,aah,c0h,ffh,17h
+			db	07h,71h,fdh,3eh,73h,3ch,eeh,54h
+			db	35h,5fh,6bh,23h,9eh,b1h,a4h,32h
+			db	ffh,3bh,16h,d1h,6ah,d3h,d7h,f3h
+			db	a6h,e5h,8ah,61h,4bh,2ch,68h,6eh
+			db	9ah,49h,c7h,59h,70h,84h,d9h,d8h
+			db	ech,59h,cbh,36h,c7h,08h,34h,70h
+			db	5dh,edh,07h,dfh,50h,43h,a3h,6ah
+			db	88h,47h,89h,ebh,6fh,3dh,52h,b5h
+			db	56h,e2h,f5h,0fh,e5h,cfh,12h,03h
+			db	26h,f8h,1bh,44h,d9h,e2h,49h,4bh
+			db	9fh,07h,eeh,35h,c0h,2fh,54h,05h
+			db	99h,f8h,eah,d8h,b4h,b1h,a8h,03h
+			db	39h,25h,45h,f8h,f6h,54h,b8h,93h
+			db	5ah,f4h,f2h,f9h,fch,8eh,bdh,22h
+			db	58h,57h,1dh,f8h,2ch,41h,90h,94h
+			db	fbh,35h,8fh,bfh,edh,f8h,13h,05h
+			db	62h,80h,e7h,4fh,eah,3ch,7bh,9fh
+			db	c9h,80h,9ch,25h,99h,99h,2ch,1eh
+			db	cch,ddh,8bh,41h,25h,6ah,0fh,03h
+			db	b7h,fdh,77h,4ch,25h,ebh,1ch,d5h
+			db	b8h,5ah,25h,afh,0bh,3dh,f0h,44h
+			db	b1h,1bh,bdh,a2h,91h,85h,24h,fbh
+			db	adh,b9h,59h,15h,30h,04h,16h,76h
+			db	0ch,4dh,22h,cch,c7h,b5h,87h,7ah
+			db	1dh,18h,6ch,dfh,30h,f5h,afh,70h
+			db	27h,7ah,1ch,29h,55h,f1h,71h,77h
+			db	c0h,6ch,e9h,ebh,33h,17h,dfh,9eh
+			db	7fh,bbh,aah,25h,37h,57h,a1h,06h
+			db	e7h,d9h,b5h,5fh,e7h,62h,69h,c0h
+			db	5ch,3dh,4bh,5dh,d7h,0bh,bfh,36h
+			db	6ch,89h,5ah,7ch,f4h,42h,4dh,07h
+			db	feh,3ch,f5h,c1h,ceh,b4h,7eh,bdh
+			db	c7h,b1h,f0h,4dh,b9h,19h,ach,0ch
+			db	deh,30h,4dh,77h,9fh,21h,e0h,7eh
+			db	5bh,e6h,a2h,00h,51h,b9h,2fh,96h
+			db	8ch,23h,95h,44h,dbh,cdh,a5h,8dh
+			db	2bh,23h,bdh,e2h,ech,e3h,5bh,1ah
+			db	a3h,65h,90h,7fh,32h,b9h,5eh,b6h
+			db	3bh,cch,00h,c8h,07h,ffh,fah,f7h
+			db	0fh,76h,e3h,26h,2dh,fbh,4ah,35h
+			db	52h,efh,80h,b6h,5bh,22h,c5h,92h
+			db	3ch,5bh,27h,c1h,7ah,72h,0ch,8fh
+			db	d4h,a2h,bfh,a6h,82h,c6h,4ch,a0h
+			db	8bh,20h,87h,01h,8ah,fdh,4dh,a0h
+			db	7ah,81h,1ch,75h,03h,3bh,afh,cfh
+			db	46h,64h,6ch,c3h,c9h,b7h,47h,9dh
+			db	6ch,0dh,96h,0eh,3bh,5dh,6eh,aah
+			db	d4h,3ah,bah,bfh,e2h,bdh,55h,a1h
+			db	28h,e3h,02h,67h,53h,5fh,8fh,6bh
+			db	b7h,89h,3bh,8fh,cfh,6ah,67h,2bh
+			db	99h,cfh,adh,14h,fbh,c2h,dfh,f0h
+			db	2dh,02h,17h,a9h,06h,1eh,cbh,53h
+			db	4fh,5eh,9ah,b1h,2fh,19h,95h,e1h
+			db	57h,68h,7ch,a8h,5eh,8dh,fdh,95h
+			db	1ch,38h,80h,37h,8ch,feh,6fh,45h
+			db	41h,5ah,dah,20h,0ch,92h,01h,bah
+			db	ffh,81h,91h,50h,42h,aeh,49h,e4h
+			db	82h,c4h,10h,e0h,81h,c9h,23h,c1h
+			db	13h,46h,cdh,fah,a7h,7bh,63h,57h
+			db	dah,56h,78h,feh,b6h,ach,96h,dah
+			db	bch,39h,7bh,f3h,e0h,53h,41h,5ah
+			db	5ah,12h,81h,3dh,bch,8dh,6bh,56h
+			db	88h,8bh,1ch,adh,b8h,bdh,10h,e7h
+			db	75h,8eh,b6h,b9h,05h,cbh,99h,83h
+			db	4eh,ach,39h,e8h,6eh,d7h,8fh,95h
+			db	58h,b0h,1bh,64h,85h,11h,aah,31h
+			db	e9h,30h,62h,1bh,39h,f6h,52h,9dh
+			db	29h,d7h,89h,f0h,14h,fch,e8h,97h
+			db	3ah,afh,83h,d1h,96h,9ch,6fh,2dh
+			db	2bh,f8h,1ch,34h,b0h,02h,dch,1ah
+			db	21h,82h,5eh,7eh,47h,95h,3bh,bch
+			db	52h,0ch,9fh,3ch,52h,25h,23h,8dh
+			db	a7h,feh,28h,e5h,52h,dch,80h,e6h
+			db	94h,a2h,53h,7bh,27h,eah,b0h,29h
+			db	efh,7bh,deh,16h,1bh,a1h,dch,e5h
+			db	2ah,9ch,1fh,71h,d0h,93h,bfh,a3h
+			db	7ah,ceh,c7h,96h,b0h,05h,ceh,4dh
+			db	45h,a5h,88h,50h,4ch,b8h,e4h,5bh
+			db	32h,40h,0bh,8dh,1eh,7dh,24h,d8h
+			db	22h,dah,cah,f4h,f9h,68h,17h,49h
+			db	ech,28h,d6h,a9h,08h,78h,04h,efh
+			db	a2h,79h,c1h,b0h,1ah,beh,64h,3ah
+			db	e9h,28h,26h,abh,35h,6fh,84h,2dh
+			db	72h,47h,50h,45h,83h,b6h,09h,6dh
+			db	5bh,5fh,b0h,06h,c3h,fdh,feh,2ah
+			db	26h,96h,0ah,e2h,5ch,cdh,13h,8ch
+			db	8ch,74h,7ch,4ah,93h,feh,58h,b4h
+			db	58h,1bh,1fh,e3h,a3h,97h,f9h,ceh
+			db	deh,e0h,a4h,73h,94h,edh,dch,d9h
+			db	5bh,5ch,62h,34h,a0h,9eh,d8h,75h
+			db	37h,8fh,a8h,5dh,4bh,f5h,f2h,25h
+			db	96h,7ah,6fh,f2h,98h,90h,32h,e5h
+			db	c9h,23h,e7h,52h,87h,10h,62h,8eh
+			db	cdh,19h,30h,74h,b6h,0eh,3ah,5dh
+			db	74h,41h,9bh,abh,6bh,27h,efh,9fh
+			db	95h,44h,14h,1ch,c6h,25h,95h,5bh
+			db	2fh,53h,e4h,bch,3eh,a1h,22h,6fh
+			db	77h,97h,efh,7fh,72h,23h,55h,ebh
+			db	14h,e3h,9eh,fah,c7h,61h,2ah,b7h
+			db	1ah,4ch,f9h,fch,efh,7dh,a8h,48h
+			db	7eh,c8h,d4h,17h,02h,00h,59h,3ah
+			db	b8h,3dh,a8h,22h,83h,53h,56h,3eh
+			db	e4h,2ah,6eh,62h,18h,2bh,86h,4ah
+			db	7dh,3bh,b1h,7dh,51h,f2h,2bh,3ah
+			db	cfh,5bh,a3h,a8h,a8h,8dh,f8h,cfh
+			db	8dh,0eh,33h,17h,42h,d3h,60h,ffh
+			db	fah,86h,6eh,5ah,10h,b5h,c0h,45h
+			db	4dh,8dh,89h,44h,d9h,79h,f8h,f3h
+			db	6fh,5ah,e7h,57h,80h,7bh,e4h,1dh
+			db	5dh,9dh,0eh,b3h,79h,b8h,39h,72h
+			db	68h,37h,02h,dah,61h,2ch,69h,b6h
+			db	d3h,e2h,43h,6ch,e2h,d8h,f1h,79h
+			db	2ch,64h,94h,b5h,f0h,5bh,66h,80h
+			db	b3h,1bh,f0h,18h,97h,12h,6dh,3ah
+			db	91h,24h,b1h,d8h,97h,71h,15h,77h
+			db	27h,d1h,f4h,09h,bdh,5fh,cah,61h
+			db	19h,76h,63h,77h,c2h,5dh,80h,07h
+			db	ddh,9dh,90h,beh,0ch,3bh,d5h,f2h
+			db	6dh,77h,6bh,ceh,0ah,91h,50h,81h
+			db	84h,58h,3bh,f6h,89h,aeh,11h,01h
+			db	00h,6ch,d7h,7ah,54h,09h,80h,cah
+			db	24h,deh,40h,6ch,b5h,1eh,85h,e1h
+			db	eah,44h,adh,c1h,34h,beh,20h,61h
+			db	ceh,74h,00h,cbh,52h,5dh,90h,39h
+			db	31h,4eh,5fh,39h,c3h,74h,a4h,68h
+			db	66h,c0h,57h,ffh,33h,1dh,49h,97h
+			db	9bh,f7h,a2h,20h,b5h,18h,87h,b1h
+			db	92h,c5h,f8h,a9h,32h,dch,ceh,88h
+			db	e8h,f0h,50h,dah,81h,dah,30h,e1h
+			db	bbh,4fh,aah,7eh,e5h,79h,edh,d4h
+			db	b5h,ddh,2ah,58h,a1h,b9h,50h,84h
+			db	26h,8bh,fbh,6ch,f9h,fch,dah,38h
+			db	25h,e5h,feh,5ch,cah,9bh,98h,e8h
+			db	d5h,e7h,5ch,49h,cdh,13h,d5h,ceh
+			db	17h,09h,a0h,d8h,e6h,40h,9ch,bdh
+			db	a7h,adh,9dh,5fh,23h,3eh,c7h,33h
+			db	41h,e3h,55h,f0h,08h,d9h,2bh,b0h
+			db	31h,cah,95h,e8h,3ah,73h,b6h,eeh
+			db	58h,0ch,01h,68h,2dh,16h,7ah,9bh
+			db	f1h,f9h,44h,95h,8fh,aeh,d5h,78h
+			db	32h,feh,4dh,65h,b4h,31h,bch,3bh
+			db	81h,f6h,f5h,28h,45h,94h,9fh,ach
+			db	05h,e8h,09h,80h,f5h,e5h,b2h,90h
+			db	2ch,c3h,e5h,3eh,e3h,2eh,6fh,99h
+			db	62h,87h,7ah,56h,f3h,24h,3fh,51h
+			db	85h,d3h,10h,1dh,dfh,56h,f9h,cdh
+			db	33h,1dh,a7h,9ch,b3h,d0h,58h,cdh
+			db	14h,e5h,37h,95h,16h,57h,05h,6ah
+			db	68h,6ch,e5h,4bh,b5h,afh,edh,a5h
+			db	88h,cah,76h,0ch,18h,aah,c4h,42h
+			db	23h,24h,82h,8fh,9fh,d8h,82h,25h
+			db	aeh,2eh,7dh,87h,74h,fch,5fh,9dh
+			db	5ch,45h,c6h,01h,b7h,c4h,46h,53h
+			db	12h,08h,83h,dah,fah,19h,1dh,34h
+			db	98h,30h,33h,32h,c8h,30h,8eh,48h
+			db	d5h,48h,08h,64h,21h,15h,4ah,e9h
+			db	7ah,39h,aeh,65h,f0h,f6h,5ah,37h
+			db	f6h,aah,4ch,96h,5ch,24h,8dh,ffh
+			db	a0h,d9h,21h,18h,d8h,82h,f6h,f3h
+			db	f9h,f6h,34h,f4h,adh,b7h,50h,b3h
+			db	a4h,bfh,2bh,7ch,37h,a1h,9eh,d6h
+			db	95h,f2h,69h,2eh,e1h,43h,beh,65h
+			db	67h,87h,31h,80h,e4h,27h,53h,feh
+			db	3fh,aeh,0ch,3bh,9dh,15h,02h,23h
+			db	9bh,7ah,f0h,33h,d0h,d9h,7bh,d2h
+			db	20h,71h,5bh,33h,9fh,b1h,5bh,1dh
+			db	e4h,adh,55h,d1h,43h,a7h,27h,0eh
+			db	8ch,fdh,77h,b6h,c8h,dbh,62h,e7h
+			db	00h,75h,0ch,dch,ceh,7ah,e4h,c4h
+			db	97h,cdh,4ch,0ah,c3h,9eh,7fh,b1h
+			db	b8h,30h,3bh,41h,a6h,76h,d1h,65h
+			db	c0h,0dh,0fh,a4h,3fh,c9h,4ah,61h
+			db	bah,9dh,dah,14h,7dh,1bh,22h,61h
+			db	63h,a9h,98h,d5h,adh,aah,42h,88h
+			db	5bh,a7h,70h,89h,44h,92h,c5h,6fh
+			db	80h,a6h,15h,b2h,e1h,18h,8bh,e4h
+			db	20h,c3h,4dh,07h,d9h,cfh,c0h,44h
+			db	c5h,68h,c6h,34h,e7h,feh,bch,60h
+			db	dch,3eh,62h,79h,09h,06h,c0h,11h
+			db	6eh,42h,fbh,0ah,d7h,39h,67h,36h
+			db	a3h,abh,99h,aeh,38h,1fh,07h,86h
+			db	8fh,a0h,46h,11h,4ch,69h,f4h,70h
+			db	b4h,b2h,97h,2eh,f8h,29h,43h,c0h
+			db	ebh,3ah,c3h,e4h,d0h,79h,e9h,fch
+			db	45h,7dh,fah,3ch,90h,bdh,76h,34h
+			db	8bh,24h,a8h,40h,aah,32h,49h,afh
+			db	feh,f4h,7dh,d3h,69h,f4h,a1h,91h
+			db	e2h,dfh,38h,f0h,7dh,a8h,64h,cch
+			db	e8h,2bh,d5h,c5h,10h,aeh,c9h,71h
+			db	78h,85h,58h,95h,4ch,72h,e2h,edh
+			db	41h,33h,ach,6bh,9ah,1ch,3fh,f8h
+			db	5fh,66h,fch,1eh,6bh,88h,66h,88h
+			db	ebh,3ch,6fh,adh,0ah,feh,70h,6fh
+			db	fah,bch,deh,afh,01h,ebh,66h,12h
+			db	b8h,6ch,efh,bah,48h,c7h,d6h,6ah
+			db	2eh,54h,d9h,99h,b3h,f3h,deh,77h
+			db	f4h,25h,58h,b9h,c9h,eah,54h,81h
+			db	55h,c3h,09h,79h,8eh,7dh,9bh,3bh
+			db	2bh,f1h,11h,58h,6dh,09h,6fh,4bh
+			db	65h,d2h,a0h,f6h,0fh,85h,d2h,e5h
+			db	1eh,b0h,89h,62h,79h,07h,15h,6fh
+			db	adh,bch,65h,96h,5ch,f1h,68h,c3h
+			db	04h,2ch,4fh,7ah,72h,83h,aeh,eeh
+			db	9ah,4fh,5eh,04h,45h,3eh,f2h,64h
+			db	17h,46h,a0h,8bh,d6h,e5h,61h,e8h
+			db	2bh,63h,85h,d8h,7dh,41h,dch,32h
+			db	f1h,55h,b6h,b8h,6ch,c9h,dfh,27h
+			db	41h,a9h,05h,97h,07h,b2h,0eh,d2h
+			db	e9h,f2h,29h,36h,1ah,1ah,50h,bah
+			db	d6h,f6h,15h,8ah,c3h,beh,89h,36h
+			db	31h,53h,21h,00h,16h,28h,a0h,fah
+			db	0ah,bbh,34h,ceh,9ch,11h,a8h,b7h
+			db	3ch,22h,79h,e7h,26h,e8h,50h,21h
+			db	35h,6fh,69h,a1h,34h,c6h,c5h,90h
+			db	94h,e2h,89h,f2h,32h,a1h,90h,1ah
+			db	cdh,a7h,77h,fah,1dh,3eh,f5h,adh
+			db	edh,e8h,73h,51h,a6h,9eh,5ch,31h
+			db	3ah,dfh,c5h,2dh,2dh,b9h,0dh,00h
+			db	36h,9bh,aeh,a1h,d1h,4ah,ffh,5ah
+			db	42h,bdh,5dh,81h,b3h,92h,aah,8dh
+			db	93h,b7h,2bh,1ah,9eh,a3h,aeh,4eh
+			db	87h,deh,41h,93h,3fh,78h,b6h,f2h
+			db	2ch,d4h,97h,16h,e6h,b3h,cah,43h
+			db	8eh,51h,13h,5eh,02h,fdh,21h,9dh
+			db	e3h,1ch,dch,13h,95h,c9h,75h,ddh
+			db	31h,7fh,6bh,e1h,76h,61h,75h,5fh
+			db	0ch,48h,71h,7fh,86h,36h,27h,77h
+			db	aah,d8h,95h,27h,60h,a0h,87h,7dh
+			db	4dh,b0h,b6h,f7h,96h,c5h,3ch,08h
+			db	1ah,f0h,3eh,c8h,24h,49h,6fh,ceh
+			db	09h,39h,d8h,d2h,3ah,03h,06h,4dh
+			db	e9h,7ch,33h,c9h,69h,8dh,bch,28h
+			db	f3h,cfh,79h,c4h,d7h,d9h,f8h,afh
+			db	16h,95h,0ah,06h,c0h,b3h,a2h,53h
+			db	39h,c7h,e2h,ech,e1h,f6h,f5h,8ah
+			db	c9h,00h,b7h,61h,95h,14h,6bh,66h
+			db	f1h,deh,85h,6ch,d7h,b1h,94h,42h
+			db	d9h,feh,bch,02h,18h,1fh,1bh,bfh
+			db	2bh,b3h,0dh,00h,c0h,59h,34h,82h
+			db	bch,5eh,e7h,7ah,dch,cah,a0h,bdh
+			db	4fh,efh,10h,feh,cdh,12h,4fh,98h
+			db	73h,b7h,d1h,2eh,f6h,32h,fbh,56h
+			db	fbh,02h,6bh,a7h,aeh,96h,e9h,07h
+			db	a2h,84h,05h,14h,57h,36h,a3h,87h
+			db	bdh,9ah,8eh,79h,01h,57h,c7h,00h
+			db	e7h,5ch,aah,20h,2dh,77h,27h,06h
+			db	58h,7ch,7eh,2ch,70h,04h,9bh,26h
+			db	f1h,d6h,4ah,d8h,bdh,9ch,55h,4ch
+			db	1ah,76h,49h,b1h,a2h,cch,a5h,aah
+			db	51h,9fh,d8h,f2h,4ch,3fh,c2h,27h
+			db	35h,cch,07h,f2h,13h,26h,0bh,92h
+			db	4dh,f7h,f9h,61h,3ah,89h,69h,3eh
+			db	dah,99h,97h,56h,bfh,d6h,a3h,1eh
+			db	25h,9bh,e8h,e2h,9ah,58h,ach,3eh
+			db	28h,0ch,71h,e1h,d1h,26h,f5h,64h
+			db	12h,81h,fbh,5bh,7dh,4bh,8dh,89h
+			db	7eh,eah,bch,47h,9eh,b1h,ach,41h
+			db	07h,b0h,fdh,d0h,70h,82h,08h,08h
+			db	9dh,4bh,27h,3ah,55h,03h,0ch,b2h
+			db	bbh,0ch,78h,eah,60h,43h,afh,0eh
+			db	59h,aah,13h,6fh,cbh,c3h,7ch,d4h
+			db	b8h,c0h,39h,2ch,6ah,70h,10h,b9h
+			db	c2h,f1h,6ah,15h,5dh,beh,deh,c2h
+			db	dfh,64h,6bh,d6h,c8h,40h,b5h,ceh
+			db	25h,8fh,31h,28h,c7h,29h,3fh,3ah
+			db	6ch,ddh,20h,c8h,b5h,4ch,7bh,e8h
+			db	74h,cch,91h,b0h,b6h,59h,36h,11h
+			db	a0h,2fh,e4h,c1h,8fh,9ch,beh,ddh
+			db	bah,5eh,4dh,82h,5ah,36h,99h,76h
+			db	4eh,e8h,5ah,3dh,dah,45h,8eh,42h
+			db	20h,e8h,b2h,29h,68h,95h,c6h,bah
+			db	eeh,29h,63h,c1h,13h,16h,4ch,b5h
+			db	2fh,a9h,93h,8ch,22h,7eh,56h,46h
+			db	edh,e2h,efh,95h,a6h,85h,c7h,e2h
+			db	e9h,2eh,cch,7fh,5ah,16h,5ah,b4h
+			db	aeh,7bh,94h,3dh,1ch,f4h,15h,e8h
+			db	22h,28h,35h,d0h,41h,d3h,8ah,f0h
+			db	dfh,c4h,f4h,3dh,3bh,95h,2dh,5dh
+			db	8dh,38h,efh,7eh,0ch,e2h,abh,7ch
+			db	ach,46h,26h,9eh,66h,e7h,7dh,1eh
+			db	dbh,b3h,fdh,cfh,d1h,0eh,d1h,8dh
+			db	f6h,e6h,09h,47h,e7h,6dh,66h,fdh
+			db	63h,95h,19h,68h,c3h,77h,8bh,e7h
+			db	edh,8bh,92h,76h,6ch,b5h,83h,a0h
+			db	a0h,3dh,1ch,a5h,09h,43h,90h,8dh
+			db	f3h,c0h,4ah,63h,ffh,efh,35h,d0h
+			db	41h,25h,f2h,c9h,26h,32h,e8h,4dh
+			db	bbh,aeh,0fh,c1h,19h,01h,b0h,a4h
+			db	f0h,4dh,a7h,0ah,56h,98h,97h,3fh
+			db	14h,66h,e0h,e4h,cfh,94h,deh,44h
+			db	1ah,d2h,75h,dch,7fh,62h,c6h,07h
+			db	48h,8ch,91h,69h,68h,0ah,38h,a3h
+			db	46h,24h,f7h,b6h,c0h,8ah,f1h,fah
+			db	fbh,96h,68h,f3h,26h,0dh,59h,87h
+			db	3ch,beh,fah,4eh,e2h,b0h,35h,86h
+			db	93h,eah,5fh,55h,bah,11h,48h,cah
+			db	44h,12h,beh,d0h,5ch,edh,62h,28h
+			db	30h,97h,0bh,3ah,ech,34h,ffh,5eh
+			db	5ch,35h,69h,d5h,12h,7fh,f6h,f0h
+			db	13h,22h,15h,b3h,55h,d8h,f2h,2fh
+			db	ddh,05h,46h,d2h,f5h,56h,3dh,4bh
+			db	a4h,0ch,6fh,c9h,d5h,a1h,c0h,f9h
+			db	67h,ebh,4bh,a5h,a4h,cbh,a8h,2fh
+			db	bbh,b2h,5ch,f5h,a1h,ddh,68h,dah
+			db	3fh,bdh,36h,3ah,e3h,bch,a9h,31h
+			db	1ah,96h,91h,92h,a9h,e4h,b0h,3bh
+			db	72h,96h,23h,3fh,65h,5eh,6bh,a5h
+			db	50h,8ah,f4h,5eh,70h,99h,37h,35h
+			db	dbh,4dh,f6h,30h,88h,b2h,36h,7ah
+			db	3bh,65h,54h,6dh,89h,d5h,a5h,ceh
+			db	43h,21h,d0h,d7h,71h,7eh,ddh,c7h
+			db	0ch,bbh,a5h,dah,03h,aeh,7bh,45h
+			db	d7h,d9h,d1h,26h,1ch,87h,67h,1ch
+			db	3eh,6ch,44h,a1h,d3h,1fh,1bh,74h
+			db	09h,25h,d5h,75h,83h,7ch,48h,5ah
+			db	aah,3fh,85h,82h,a0h,13h,2dh,5fh
+			db	07h,e2h,9fh,17h,fah,ebh,b5h,95h
+			db	78h,bbh,dfh,e7h,dfh,2ah,2fh,66h
+			db	b7h,ceh,31h,abh,ech,05h,6eh,f1h
+			db	39h,12h,5bh,68h,e7h,beh,cdh,d2h
+			db	ddh,04h,cah,61h,2eh,d3h,33h,4fh
+			db	6dh,c0h,ddh,5fh,0dh,23h,2dh,1ah
+			db	02h,85h,39h,55h,d7h,cbh,fbh,99h
+			db	4bh,d9h,16h,8ch,e8h,cch,5bh,62h
+			db	3ah,2eh,92h,53h,1dh,2bh,f5h,9fh
+			db	51h,52h,6ah,d0h,8ah,5bh,5eh,06h
+			db	4dh,86h,3ch,38h,c0h,3bh,81h,d3h
+			db	b6h,37h,43h,49h,40h,b0h,65h,feh
+			db	afh,5ch,d8h,3ch,96h,57h,ebh,13h
+			db	18h,01h,61h,a3h,c8h,73h,84h,0dh
+			db	8fh,28h,73h,afh,6bh,4eh,03h,3ch
+			db	01h,dch,e5h,8ah,66h,d7h,4bh,41h
+			db	5ch,78h,4fh,35h,6ah,5bh,1fh,67h
+			db	5dh,e0h,70h,53h,58h,53h,01h,a6h
+			db	a9h,74h,08h,dch,52h,cfh,92h,91h
+			db	04h,a9h,edh,b6h,1eh,d8h,f7h,fbh
+			db	c0h,d0h,24h,57h,63h,13h,7fh,31h
+			db	8bh,54h,33h,aeh,d8h,e1h,a3h,1ah
+			db	feh,d0h,0ch,7dh,b0h,7bh,bdh,0fh
+			db	49h,89h,efh,10h,65h,28h,94h,e6h
+			db	ddh,c3h,cbh,03h,15h,48h,86h,37h
+			db	beh,86h,36h,ddh,87h,e0h,99h,62h
+			db	1dh,feh,3fh,c3h,5dh,91h,afh,6eh
+			db	65h,38h,27h,a3h,f4h,a1h,b1h,49h
+			db	6dh,9bh,45h,5ch,13h,feh,adh,65h
+			db	1fh,cfh,75h,f1h,ffh,5fh,98h,95h
+			db	9eh,72h,2dh,2fh,4dh,97h,23h,eeh
+			db	5fh,5ch,a0h,9ch,78h,c7h,08h,09h
+			db	4bh,74h,bdh,05h,97h,61h,07h,9dh
+			db	a3h,dah,1eh,1bh,3ch,09h,58h,37h
+			db	c7h,eeh,f1h,75h,dfh,40h,fdh,18h
+			db	a8h,6bh,42h,f7h,9bh,15h,e7h,c6h
+			db	eah,91h,59h,e3h,edh,b6h,e8h,5dh
+			db	e0h,f7h,e9h,13h,edh,1eh,c3h,edh
+			db	b9h,6fh,bch,a2h,edh,8eh,09h,b0h
+			db	44h,2ah,73h,09h,65h,c8h,68h,2bh
+			db	a0h,48h,24h,8ah,1fh,28h,79h,efh
+			db	2bh,f8h,86h,d0h,dah,81h,dfh,58h
+			db	6eh,3fh,03h,81h,e1h,81h,3ch,cah
+			db	2eh,17h,dbh,3ah,dch,30h,f0h,e2h
+			db	b0h,35h,f8h,55h,d4h,c2h,fah,cdh
+			db	58h,2fh,4eh,38h,83h,ddh,48h,3dh
+			db	5dh,8dh,5eh,ffh,18h,79h,f2h,2eh
+			db	86h,95h,55h,edh,14h,28h,01h,32h
+			db	16h,88h,24h,39h,35h,8fh,e9h,60h
+			db	a4h,19h,cah,16h,05h,eah,76h,e7h
+			db	a7h,15h,c0h,b5h,5fh,f3h,61h,6ch
+			db	6ah,3bh,d5h,03h,fdh,10h,8dh,44h
+			db	9ch,0fh,d6h,7bh,1dh,85h,eah,c5h
+			db	34h,d1h,96h,2ch,3ch,f5h,96h,8eh
+			db	f8h,c4h,e9h,1eh,0ah,46h,80h,cbh
+			db	66h,7eh,a9h,fah,6ch,4bh,c8h,04h
+			db	4ah,04h,5eh,1ah,7fh,53h,0fh,74h
+			db	fbh,0eh,1ch,5fh,18h,43h,49h,33h
+			db	70h,d9h,8ah,86h,a1h,ddh,b7h,bdh
+			db	e7h,f9h,dch,88h,b5h,8bh,e7h,79h
+			db	e2h,17h,6ah,78h,a8h,ffh,2ah,bbh
+			db	9ah,fbh,55h,dch,7eh,70h,7bh,f5h
+			db	c9h,cdh,25h,2bh,e7h,8ch,deh,ffh
+			db	77h,78h,08h,24h,64h,8dh,8eh,83h
+			db	f6h,99h,02h,49h,1dh,9ah,ceh,30h
+			db	a8h,bch,58h,15h,1eh,c5h,60h,4bh
+			db	9eh,87h,c1h,34h,aeh,3bh,d4h,efh
+			db	04h,b8h,84h,f1h,fah,19h,c8h,68h
+			db	78h,6dh,7ch,63h,e1h,90h,5ah,5ch
+			db	38h,47h,97h,bbh,a8h,c7h,b7h,0ch
+			db	2ch,72h,ceh,8fh,9eh,0ah,bah,4dh
+			db	5dh,bch,79h,dfh,e8h,d9h,f5h,68h
+			db	74h,54h,c9h,c5h,46h,4eh,ffh,f3h
+			db	31h,73h,fah,87h,49h,f2h,72h,4ah
+			db	87h,98h,5fh,5ah,cbh,53h,91h,ach
+			db	c6h,7fh,2fh,40h,64h,9dh,ceh,41h
+			db	1eh,3fh,81h,93h,34h,7dh,3fh,7eh
+			db	87h,b7h,d7h,e3h,dah,8ch,dbh,e2h
+			db	13h,ceh,7ch,06h,5fh,b4h,d7h,fdh
+			db	fah,d5h,beh,d3h,f1h,04h,5ah,b9h
+			db	4fh,01h,8eh,3ah,0fh,49h,1ah,49h
+			db	86h,b9h,cah,2ch,5ah,a3h,ebh,d0h
+			db	adh,34h,21h,d5h,3eh,14h,a2h,cbh
+			db	32h,ebh,80h,44h,b7h,2fh,6bh,1dh
+			db	3fh,68h,e4h,9dh,57h,96h,2bh,85h
+			db	49h,b5h,72h,8ah,58h,9eh,b1h,fdh
+			db	a1h,e9h,e1h,86h,abh,21h,d1h,f8h
+			db	6eh,00h,dch,14h,86h,16h,7ch,59h
+			db	8ah,76h,61h,cbh,10h,ffh,b2h,0ah
+			db	f3h,e4h,e8h,cdh,28h,efh,29h,fah
+			db	24h,9eh,23h,f0h,9fh,f8h,b7h,4bh
+			db	b2h,51h,8fh,9dh,74h,b0h,14h,f9h
+			db	08h,bch,63h,dah,d0h,d3h,20h,e2h
+			db	10h,8ch,dbh,e5h,b8h,8bh,d8h,3eh
+			db	d3h,05h,34h,59h,11h,1ah,0fh,b5h
+			db	abh,94h,a9h,ffh,f5h,6bh,d2h,68h
+			db	95h,2eh,adh,8fh,4dh,90h,02h,1dh
+			db	12h,9fh,c0h,00h,b6h,08h,2bh,cfh
+			db	7ah,ceh,d7h,50h,ebh,d1h,66h,26h
+			db	2ah,4ch,74h,73h,bfh,6bh,5fh,67h
+			db	63h,0ch,aah,edh,18h,e0h,3dh,e6h
+			db	1dh,c4h,84h,a0h,1ah,bch,fdh,4bh
+			db	29h,5ch,75h,4dh,b2h,feh,deh,bch
+			db	cah,6bh,5bh,5eh,19h,afh,40h,80h
+			db	93h,45h,5dh,7eh,1bh,74h,65h,2ah
+			db	ceh,3eh,68h,f3h,7ah,dfh,6fh,04h
+			db	a4h,26h,c2h,f7h,97h,44h,d7h,74h
+			db	c7h,a5h,c6h,bbh,c9h,dbh,59h,6eh
+			db	0dh,01h,dch,60h,84h,d9h,5dh,e8h
+			db	55h,5ah,cah,f3h,b5h,9bh,79h,15h
+			db	38h,6eh,dah,1eh,8eh,b4h,41h,d6h
+			db	11h,88h,b8h,b7h,66h,e5h,50h,7ch
+			db	bfh,bah,6dh,09h,b8h,20h,83h,9ah
+			db	aah,82h,e1h,28h,6ah,96h,beh,90h
+			db	5fh,50h,d5h,93h,29h,2ah,51h,7ch
+			db	cch,91h,cbh,e3h,17h,79h,11h,feh
+			db	7ch,6fh,42h,beh,4fh,46h,03h,deh
+			db	97h,7bh,e5h,e5h,5dh,d5h,93h,d2h
+			db	a7h,efh,4ah,40h,23h,bfh,76h,32h
+			db	75h,3ah,f9h,b8h,64h,e2h,89h,08h
+			db	33h,1dh,f1h,d0h,5ah,f8h,fch,afh
+			db	13h,b6h,7ah,34h,62h,17h,14h,18h
+			db	32h,69h,6bh,0bh,deh,45h,52h,4fh
+			db	72h,91h,45h,15h,b7h,3dh,e9h,dah
+			db	83h,f8h,bbh,2ah,64h,a6h,b4h,ach
+			db	43h,3bh,84h,9eh,ach,34h,15h,e4h
+			db	33h,aah,6ch,dah,bch,a3h,7eh,a4h
+			db	dfh,54h,dch,0ah,23h,0ah,eeh,0eh
+			db	66h,d7h,c7h,c4h,bbh,63h,c4h,6ah
+			db	ach,abh,e3h,b5h,d8h,f5h,48h,ceh
+			db	cfh,7bh,fch,f7h,10h,46h,aah,86h
+			db	8dh,f7h,0ch,5dh,13h,22h,77h,dfh
+			db	1ah,dah,51h,67h,0eh,ech,dbh,88h
+			db	20h,95h,afh,c0h,deh,23h,e8h,d0h
+			db	f2h,5ch,6ch,76h,b1h,7eh,90h,2fh
+			db	75h,24h,96h,7ah,e7h,85h,c7h,b4h
+			db	8ch,f1h,cbh,91h,b5h,ddh,6dh,f6h
+			db	61h,2fh,feh,d4h,cfh,18h,a1h,3bh
+			db	0eh,30h,3eh,8bh,8ch,a3h,6eh,b5h
+			db	52h,27h,eeh,4eh,e7h,5fh,a4h,4bh
+			db	c6h,28h,41h,1ch,35h,6ch,0fh,3eh
+			db	ach,9fh,2fh,25h,04h,d2h,81h,52h
+			db	81h,b0h,9dh,74h,bah,78h,c5h,62h
+			db	2eh,ddh,bdh,28h,cdh,deh,45h,47h
+			db	36h,94h,9bh,d4h,2dh,ach,04h,5fh
+			db	adh,56h,97h,67h,aeh,05h,e6h,d7h
+			db	a8h,29h,c6h,fdh,a3h,29h,0eh,cch
+			db	27h,7fh,09h,12h,38h,f1h,6ah,bdh
+			db	d4h,57h,b4h,34h,deh,bbh,f4h,d6h
+			db	0bh,a2h,51h,e1h,8ch,6ah,fah,36h
+			db	fdh,07h,91h,4fh,a2h,ach,4bh,2dh
+			db	c8h,86h,29h,15h,eah,5ch,a1h,5ch
+			db	91h,69h,45h,9ah,13h,ddh,f0h,7ch
+			db	21h,ffh,14h,36h,29h,bbh,d1h,14h
+			db	b2h,47h,cdh,53h,99h,9dh,c1h,e3h
+			db	fah,0ah,0bh,05h,93h,feh,52h,60h
+			db	5eh,52h,fbh,33h,8fh,ddh,2eh,c8h
+			db	42h,68h,19h,67h,22h,0fh,29h,33h
+			db	9dh,c4h,dbh,37h,11h,7ch,10h,35h
+			db	37h,93h,96h,ebh,8ch,d6h,bch,fch
+			db	72h,beh,06h,6ch,f3h,00h,f9h,01h
+			db	69h,52h,f9h,7bh,b4h,5bh,65h,1ch
+			db	3fh,92h,deh,9dh,76h,57h,07h,69h
+			db	68h,d0h,53h,4dh,1eh,8ch,cbh,94h
+			db	66h,7bh,58h,dch,abh,9ah,ffh,1eh
+			db	49h,b0h,3fh,25h,9bh,09h,99h,97h
+			db	c3h,04h,47h,90h,41h,beh,f2h,45h
+			db	1ch,1bh,86h,6eh,dbh,8ch,05h,52h
+			db	16h,28h,29h,a3h,eeh,96h,68h,06h
+			db	23h,78h,f8h,29h,cdh,93h,07h,62h
+			db	39h,24h,83h,e7h,0ch,87h,57h,6eh
+			db	5dh,24h,3ah,a7h,92h,65h,dfh,6fh
+			db	70h,8ah,12h,75h,48h,eah,efh,0fh
+			db	86h,c9h,fch,3ah,a9h,9dh,51h,efh
+			db	69h,95h,74h,beh,cah,02h,12h,59h
+			db	7bh,29h,36h,12h,27h,deh,5ch,5ch
+			db	75h,22h,18h,82h,59h,f4h,74h,91h
+			db	d1h,77h,96h,3dh,c3h,c4h,d9h,48h
+			db	2eh,38h,efh,81h,c2h,97h,45h,34h
+			db	9ah,52h,6ah,a8h,38h,7bh,1ah,61h
+			db	5eh,0ah,f0h,12h,06h,13h,46h,22h
+			db	e4h,fah,33h,f1h,4ch,9eh,0eh,d9h
+			db	deh,43h,deh,cch,50h,9fh,81h,61h
+			db	62h,7ch,4fh,7ah,b3h,dbh,d3h,7ch
+			db	30h,72h,69h,41h,92h,b2h,a9h,f6h
+			db	71h,16h,54h,a0h,6eh,8dh,91h,5fh
+			db	2bh,45h,c9h,5fh,b9h,fdh,e0h,84h
+			db	38h,9ch,d1h,b2h,afh,1dh,8ch,5eh
+			db	48h,42h,6fh,35h,aeh,aeh,d4h,e3h
+			db	68h,6ch,7eh,c3h,a3h,a5h,1ah,d2h
+			db	87h,dch,5dh,35h,42h,45h,e2h,fbh
+			db	2ah,4ah,3bh,5eh,82h,f9h,69h,68h
+			db	90h,26h,1ch,d1h,7fh,53h,bbh,48h
+			db	dah,a6h,43h,8ch,87h,37h,21h,0ah
+			db	27h,04h,58h,b2h,bbh,13h,dbh,2ch
+			db	2bh,c9h,a4h,25h,38h,ech,41h,6ch
+			db	06h,f8h,71h,d7h,75h,a9h,6ah,18h
+			db	b9h,b7h,bah,ach,a0h,3bh,f5h,afh
+			db	0eh,6bh,27h,29h,b3h,feh,43h,c9h
+			db	79h,7bh,36h,5eh,86h,e3h,32h,92h
+			db	67h,48h,70h,5ah,68h,eah,e3h,a4h
+			db	00h,72h,2ch,d3h,3eh,d2h,c1h,bch
+			db	e4h,f4h,e8h,57h,9ch,19h,d2h,cah
+			db	fdh,a3h,e1h,0ah,32h,adh,4ch,2eh
+			db	f3h,77h,dch,13h,a7h,f4h,e0h,83h
+			db	d2h,9dh,47h,7ch,36h,6ch,8bh,a7h
+			db	4eh,14h,0ch,e8h,83h,4ch,2ah,edh
+			db	2bh,5eh,50h,7fh,deh,f0h,94h,d2h
+			db	62h,04h,5eh,a8h,35h,62h,fah,f4h
+			db	8ch,c3h,41h,02h,bbh,dah,02h,46h
+			db	90h,67h,4fh,c4h,afh,ffh,68h,16h
+			db	e6h,bdh,ffh,05h,d5h,8fh,67h,cch
+			db	17h,16h,56h,44h,1bh,eah,6bh,28h
+			db	80h,89h,86h,89h,83h,0eh,25h,abh
+			db	99h,c5h,83h,3ah,33h,dch,ddh,2dh
+			db	adh,7eh,f4h,bah,33h,62h,edh,dfh
+			db	feh,23h,37h,7eh,a8h,d9h,92h,7ah
+			db	9ah,dch,5ch,e7h,f2h,71h,f5h,37h
+			db	68h,03h,40h,b4h,53h,0eh,01h,f2h
+			db	e6h,a3h,ceh,94h,2dh,1eh,16h,c4h
+			db	12h,f5h,c2h,90h,31h,52h,b5h,8fh
+			db	3fh,62h,93h,fdh,d7h,8eh,38h,95h
+			db	93h,4dh,c5h,4fh,30h,3bh,bdh,ech
+			db	e1h,7dh,7ch,beh,79h,7ch,19h,2fh
+			db	20h,53h,9bh,8fh,11h,7ch,4dh,90h
+			db	afh,4ch,bah,87h,e0h,52h,9fh,17h
+			db	13h,6eh,4ch,70h,a3h,3fh,f1h,efh
+			db	b5h,0ah,28h,96h,8fh,5eh,25h,77h
+			db	32h,e3h,23h,13h,85h,b4h,74h,a2h
+			db	33h,ach,fdh,38h,81h,96h,79h,f8h
+			db	a9h,58h,dfh,2ch,a3h,6fh,38h,c4h
+			db	63h,f1h,edh,59h,eah,7ch,8dh,b3h
+			db	00h,a5h,05h,aeh,cah,dbh,6ah,32h
+			db	01h,0ah,3dh,69h,fch,9ch,feh,a0h
+			db	39h,fah,9bh,64h,6ch,80h,f5h,b7h
+			db	f6h,00h,5fh,e5h,d5h,62h,a6h,33h
+			db	ffh,06h,f8h,7ah,deh,81h,c9h,74h
+			db	98h,11h,01h,7eh,2ch,afh,2dh,88h
+			db	b0h,5ch,c7h,e5h,c0h,6bh,1fh,d7h
+			db	ach,c2h,1fh,39h,feh,90h,b9h,57h
+			db	d1h,cfh,55h,2fh,e2h,c6h,69h,43h
+			db	a8h,20h,ddh,66h,84h,52h,37h,37h
+			db	fah,51h,41h,92h,0eh,cch,2bh,9bh
+			db	34h,20h,e9h,4dh,95h,c4h,73h,2fh
+			db	a9h,3ah,edh,05h,e6h,e6h,15h,7eh
+			db	dbh,14h,0ah,19h,34h,9dh,deh,49h
+			db	93h,8fh,4fh,46h,bah,10h,98h,85h
+			db	36h,ebh,eah,20h,a1h,a6h,6fh,39h
+			db	29h,c3h,bfh,e2h,eeh,eah,65h,0eh
+			db	9eh,90h,c9h,98h,a7h,8fh,7ch,19h
+			db	4dh,f6h,c4h,98h,03h,99h,89h,a7h
+			db	10h,5ch,b5h,9bh,2eh,19h,b2h,cch
+			db	f2h,cfh,ach,aeh,bch,78h,5ah,29h
+			db	f5h,4eh,a3h,feh,b8h,55h,39h,40h
+			db	c9h,06h,7ah,23h,bfh,a4h,34h,3eh
+			db	56h,b5h,1ch,04h,a8h,7ah,f5h,68h
+			db	6ah,b6h,1ch,b3h,dch,efh,fch,feh
+			db	87h,04h,22h,03h,c8h,f5h,59h,70h
+			db	81h,20h,67h,90h,fch,0fh,67h,8bh
+			db	59h,4bh,f9h,7eh,a8h,04h,28h,b0h
+			db	10h,93h,b9h,59h,bbh,1ah,32h,6fh
+			db	a3h,7eh,09h,d0h,cdh,1dh,9ah,6eh
+			db	64h,a7h,bbh,19h,56h,edh,61h,5fh
+			db	d2h,ffh,21h,6ch,30h,f1h,00h,c2h
+			db	6dh,09h,7ch,9eh,8ah,a1h,f7h,93h
+			db	91h,abh,50h,3fh,dch,07h,ffh,68h
+			db	57h,ach,d0h,fah,86h,32h,e4h,37h
+			db	cdh,efh,14h,a8h,e1h,c2h,afh,7eh
+			db	ebh,2ch,8eh,3ah,d4h,3dh,33h,81h
+			db	56h,11h,b6h,44h,d7h,9fh,5fh,f3h
+			db	68h,ddh,8eh,14h,b9h,66h,09h,2eh
+			db	2ch,e2h,26h,53h,aah,02h,aah,eeh
+			db	0ch,73h,92h,15h,5ah,bfh,b5h,65h
+			db	3ch,d2h,b7h,1ah,47h,36h,adh,d1h
+			db	33h,63h,a0h,d7h,d7h,a6h,9dh,1bh
+			db	24h,37h,51h,80h,eeh,77h,3fh,2dh
+			db	c1h,f3h,55h,eeh,60h,d9h,27h,d5h
+			db	70h,83h,3dh,62h,9ch,b4h,b8h,22h
+			db	a0h,d7h,05h,f3h,d0h,21h,9bh,36h
+			db	adh,93h,7bh,0dh,6ch,38h,d2h,81h
+			db	4bh,c5h,9eh,f8h,bdh,a1h,05h,f7h
+			db	27h,70h,35h,e4h,54h,ffh,26h,b7h
+			db	18h,37h,bbh,f0h,3eh,04h,d5h,f1h
+			db	e1h,5eh,64h,c5h,66h,d2h,98h,a4h
+			db	8dh,d4h,7eh,afh,82h,98h,20h,a7h
+			db	beh,d3h,93h,6fh,4ch,87h,5fh,2eh
+			db	47h,ceh,58h,61h,ddh,ech,14h,50h
+			db	3ah,dch,cdh,a9h,35h,c8h,deh,5fh
+			db	2dh,cah,76h,f7h,a6h,d9h,a7h,82h
+			db	10h,c4h,63h,04h,e9h,d0h,09h,6ah
+			db	87h,66h,48h,04h,67h,72h,fah,d1h
+			db	77h,5eh,54h,b1h,b8h,c2h,69h,10h
+			db	bch,75h,a0h,33h,09h,bah,47h,40h
+			db	49h,edh,0bh,c6h,5dh,12h,45h,e3h
+			db	56h,f1h,4dh,f9h,1fh,65h,b4h,31h
+			db	76h,9dh,e4h,4dh,c8h,52h,74h,48h
+			db	e9h,c8h,b4h,29h,fch,52h,2ah,7bh
+			db	6eh,d4h,03h,06h,91h,11h,9dh,2dh
+			db	7bh,a7h,9fh,e5h,83h,27h,05h,efh
+			db	30h,a3h,65h,ddh,c0h,c0h,aah,67h
+			db	06h,1dh,74h,1dh,f6h,bch,46h,59h
+			db	a3h,31h,f9h,47h,dah,94h,1bh,e3h
+			db	89h,47h,bdh,89h,9bh,6eh,a0h,47h
+			db	7ah,f9h,77h,5ah,6eh,61h,48h,aeh
+			db	34h,73h,f8h,4bh,2ah,5ch,23h,e4h
+			db	b6h,ach,6ch,73h,78h,55h,bfh,2eh
+			db	e4h,51h,b2h,0eh,72h,04h,04h,98h
+			db	7ah,ceh,f6h,ffh,8eh,9eh,b5h,71h
+			db	eeh,e9h,26h,4fh,bah,f7h,bfh,30h
+			db	68h,62h,6eh,afh,eeh,18h,75h,12h
+			db	91h,d9h,f2h,d7h,cfh,05h,15h,40h
+			db	abh,eah,cbh,0ah,72h,32h,c4h,02h
+			db	38h,85h,0fh,6ah,f7h,ddh,43h,dbh
+			db	e4h,b4h,99h,66h,ddh,f3h,89h,1eh
+			db	96h,81h,c4h,4eh,61h,e2h,c5h,8fh
+			db	52h,ceh,3dh,e0h,97h,49h,d6h,04h
+			db	b0h,a2h,00h,88h,d1h,52h,2ch,51h
+			db	39h,f0h,0dh,ddh,d1h,d3h,04h,e8h
+			db	57h,38h,7ch,a1h,d7h,f6h,d2h,43h
+			db	40h,52h,80h,7ch,4dh,9ah,a4h,f7h
+			db	e3h,7dh,4eh,7eh,1eh,d6h,3eh,5fh
+			db	33h,34h,4ah,f7h,d1h,5ah,84h,33h
+			db	7ah,b8h,afh,c0h,71h,cch,7dh,8eh
+			db	57h,56h,9ah,bah,02h,86h,61h,bch
+			db	a4h,bch,feh,45h,e7h,1dh,0eh,e7h
+			db	70h,80h,f7h,0ch,99h,adh,c7h,ebh
+			db	1fh,e7h,23h,cbh,7bh,4ah,ebh,16h
+			db	01h,ach,9ch,e6h,77h,13h,17h,cdh
+			db	93h,46h,99h,a5h,e9h,dfh,e7h,3ch
+			db	09h,6dh,d3h,82h,19h,fch,4dh,39h
+			db	9eh,11h,10h,f7h,57h,dch,18h,8bh
+			db	6ah,cah,52h,14h,f5h,d4h,69h,e2h
+			db	3ch,b6h,4eh,c3h,42h,e2h,dch,6dh
+			db	01h,abh,ddh,b7h,81h,c5h,0eh,0fh
+			db	5bh,96h,9dh,6fh,87h,21h,8fh,4dh
+			db	d7h,95h,c7h,45h,fch,e0h,4ah,1fh
+			db	3eh,0eh,58h,98h,bah,80h,03h,feh
+			db	0eh,74h,a8h,efh,40h,efh,deh,73h
+			db	70h,ebh,65h,f5h,15h,58h,5ah,8eh
+			db	ech,96h,71h,d3h,69h,8fh,9dh,cfh
+			db	fah,30h,96h,5dh,a8h,6ah,5dh,5eh
+			db	dch,3eh,9dh,b7h,b3h,58h,03h,74h
+			db	0bh,7ah,c1h,45h,b1h,25h,55h,8fh
+			db	c0h,d0h,66h,81h,9eh,0ch,4eh,55h
+			db	6fh,4ah,50h,2ah,59h,54h,11h,92h
+			db	2bh,29h,bch,86h,dbh,c4h,2dh,bdh
+			db	f1h,4eh,1ch,5dh,00h,79h,bdh,fch
+			db	22h,42h,afh,a5h,e7h,67h,28h,8ch
+			db	12h,3fh,fch,37h,5ah,a1h,aah,edh
+			db	20h,21h,05h,71h,a0h,94h,f3h,52h
+			db	c0h,3dh,6dh,95h,f1h,24h,d0h,edh
+			db	f3h,aeh,f9h,d4h,19h,c7h,29h,9ch
+			db	8bh,33h,a2h,4bh,04h,28h,21h,23h
+			db	13h,66h,16h,a0h,ebh,55h,bbh,e2h
+			db	aeh,4eh,fch,84h,5ch,5ch,cfh,bch
+			db	d9h,72h,24h,71h,43h,7dh,88h,85h
+			db	b0h,1fh,27h,aeh,c7h,87h,68h,67h
+			db	47h,4bh,a4h,76h,20h,f4h,bch,abh
+			db	92h,5fh,9ch,c8h,d3h,e2h,d5h,6fh
+			db	c8h,9ah,18h,39h,27h,40h,04h,46h
+			db	d3h,d0h,52h,d5h,96h,f8h,6dh,8ch
+			db	1ah,bfh,1ah,b1h,97h,82h,8dh,f1h
+			db	9ah,01h,e8h,b2h,6bh,18h,5dh,53h
+			db	82h,77h,c3h,b7h,73h,7eh,82h,7ah
+			db	7fh,cbh,67h,0bh,04h,c9h,97h,d6h
+			db	55h,07h,3ah,b6h,79h,76h,a4h,0ch
+			db	23h,79h,c1h,3dh,e7h,4fh,54h,b6h
+			db	14h,66h,32h,2ch,93h,27h,8ch,a3h
+			db	d7h,26h,2ah,d4h,8bh,3ah,b0h,0bh
+			db	20h,37h,56h,c8h,cdh,1ch,8eh,edh
+			db	90h,74h,60h,57h,72h,39h,0bh,efh
+			db	7ch,12h,9fh,b1h,39h,3ah,bdh,78h
+			db	98h,c3h,e9h,beh,b4h,3bh,7ah,21h
+			db	89h,beh,a0h,26h,68h,2dh,b1h,edh
+			db	e4h,0dh,08h,97h,79h,12h,33h,96h
+			db	f1h,bfh,6eh,14h,b7h,c8h,74h,bfh
+			db	b7h,7dh,fdh,71h,29h,88h,44h,97h
+			db	eah,4bh,08h,bah,bbh,01h,9fh,00h
+			db	9dh,94h,7fh,b3h,a1h,c9h,3eh,80h
+			db	76h,12h,6dh,2bh,1fh,f8h,d7h,81h
+			db	7fh,eah,30h,e8h,8eh,8fh,b3h,0eh
+			db	c4h,c4h,44h,0dh,f8h,b4h,37h,ach
+			db	d8h,5ah,63h,79h,75h,10h,c1h,19h
+			db	91h,8dh,13h,32h,21h,22h,1dh,c6h
+			db	6fh,92h,7ch,25h,09h,77h,14h,3ch
+			db	bch,b3h,76h,39h,47h,95h,c8h,dch
+			db	7ch,bfh,9fh,3dh,02h,d8h,0bh,74h
+			db	aah,aeh,87h,0ch,72h,2ch,8ch,51h
+			db	82h,89h,64h,a6h,5fh,6fh,6fh,1ch
+			db	fbh,5ah,83h,21h,99h,b8h,96h,97h
+			db	e9h,91h,a2h,8fh,b4h,19h,74h,96h
+			db	47h,e2h,46h,cfh,08h,20h,deh,eah
+			db	1fh,dbh,00h,eah,4dh,6ah,c7h,89h
+			db	01h,2ah,82h,2ch,42h,b5h,00h,ebh
+			db	5eh,d5h,deh,52h,4eh,e4h,fdh,c8h
+			db	d1h,3fh,01h,aah,20h,29h,c3h,6fh
+			db	feh,bch,78h,a0h,21h,70h,52h,43h
+			db	39h,f4h,a4h,71h,b2h,82h,a8h,73h
+			db	d4h,17h,dah,22h,a1h,61h,a4h,d8h
+			db	77h,7dh,98h,feh,a1h,62h,a9h,76h
+			db	e5h,abh,e9h,31h,c4h,a0h,bbh,04h
+			db	96h,99h,1dh,71h,a1h,f1h,4ah,e1h
+			db	53h,23h,33h,d2h,eeh,5eh,d0h,0ch
+			db	7dh,8dh,49h,87h,36h,35h,c1h,81h
+			db	c4h,bch,e2h,20h,bdh,c8h,35h,73h
+			db	d4h,01h,91h,91h,7dh,b1h,f0h,4ch
+			db	79h,63h,00h,65h,1ch,06h,0dh,cch
+			db	f4h,a2h,51h,89h,e1h,1eh,5ch,e3h
+			db	cch,7ch,e7h,abh,57h,6ch,9bh,29h
+			db	1fh,3ch,dah,13h,2dh,eah,b7h,42h
+			db	6ah,3ch,abh,24h,d0h,9bh,a9h,abh
+			db	7ch,6ah,06h,2eh,46h,13h,55h,65h
+			db	b6h,0dh,b2h,7ah,6fh,eeh,c3h,13h
+			db	36h,53h,aah,5bh,4ah,7ah,f9h,69h
+			db	a9h,48h,d7h,b5h,ffh,d7h,7eh,bdh
+			db	31h,a6h,8fh,85h,17h,46h,a3h,f2h
+			db	e5h,9eh,fdh,2dh,b9h,70h,54h,d4h
+			db	b1h,56h,e2h,6ch,12h,16h,65h,87h
+			db	46h,cfh,42h,92h,53h,40h,51h,cdh
+			db	a4h,5dh,e6h,19h,96h,31h,8dh,4fh
+			db	c3h,6ah,e5h,7eh,2dh,e8h,c0h,18h
+			db	ddh,71h,46h,d7h,14h,9eh,c9h,3eh
+			db	a5h,d0h,fch,b7h,f1h,7dh,ech,9fh
+			db	55h,9ah,3dh,9ah,43h,b6h,7eh,12h
+			db	a5h,a1h,35h,23h,b0h,85h,ffh,89h
+			db	fbh,46h,79h,44h,09h,c9h,fdh,36h
+			db	6eh,84h,73h,53h,dch,fah,b2h,26h
+			db	ach,11h,40h,3bh,52h,76h,dch,f4h
+			db	37h,6dh,47h,69h,87h,ebh,50h,e4h
+			db	cah,70h,9ch,57h,54h,cbh,50h,11h
+			db	a7h,d6h,c2h,7eh,fbh,eeh,52h,a0h
+			db	f4h,5dh,5eh,2ch,45h,b9h,f6h,d6h
+			db	44h,20h,dfh,d1h,8ah,c3h,d9h,deh
+			db	99h,8ch,60h,3ah,ddh,16h,c4h,3bh
+			db	9dh,b7h,fdh,72h,19h,a7h,f8h,a2h
+			db	f1h,33h
+			ld	e,b
+			add	hl,hl
+			ex	af,af'
+			adc	a,b
+			inc	a
+			or	a
+			rst	30h
+			add	a,(hl)
+			inc	l
+			ld	b,(hl)
+			ld	c,h
+			ld	c,e
+			and	l
+			ld	b,d
+			adc	a,d
+			ld	e,d
+			ld	d,a
+			ld	b,d
+			call	L1f55
+			and	b
+			cpl
+			ld	a,(4462h)
+			dec	d
+			add	a,a
+			ld	e,14h
+			pop	bc
+			push	af
+			or	a
+			ld	a,(hl)
+			in	a,(9bh)
+			in	a,(ceh)
+			nop (2x) *
+			ld	b,a
+			ld	l,c
+			dec	l
+			add	a,b
+			ex	af,af'
+			ld	a,b
+			xor	a
+			ld	sp,1652h
+			ld	b,d
+			out	(c5h),a
+			ld	c,a
+			and	h
+			and	5eh
+			cp	h
+			ld	d,h
+			adc	a,71h
+			ld	c,h
+			sbc	a,(hl)
+			jr	nc,L66a9
+			ld	l,b
+			xor	d
+			cp	(hl)
+			sbc	a,e
+			cp	a
+			and	l
+			adc	a,e
+			sub	cah
+			rst	08h
+			ld	(hl),a
+			nop (2x) *
+			cp	c
+			ld	l,a
+			nop
+			ld	de,cd1bh
+			pop	hl
+			add	a,8fh
+			ld	(hl),d
+			dec	sp
+			jr	L676b
+			db	e3h,78h,afh,03h,3ch,25h,12h,55h
+			db	1fh,a7h,cdh,e4h,09h,60h,8eh,bah
+			db	cdh,29h,2bh,d1h,0dh,20h,b7h,30h
+			db	f3h,75h,2fh,96h,a6h,3dh,7dh,d3h
+			db	e0h,f1h,e0h,edh,05h
+			ld	a,(de)
+			sub	a
+			ld	b,b
+			djnz	L66cd
+			ld	e,e
+			cpl
+			sbc	a,a
+			cp	d
+			rst	18h
+			jp	po,Lb587
+			rst	28h
+			add	hl,sp
+			ldi
+			dec	de
+			ld	l,d
+			ret	c
+			inc	(hl)
+			ld	h,d0h
+			ld	a,h
+			cp	c
+			call	m,L4d3d
+			ld	(hl),42h
+			ld	(hl),e
+			jp	(hl)
+			db	2ah,68h,1fh,36h,ach,7bh,0ch,5ch
+			db	60h,eah,2fh,49h,75h,c1h,0eh,80h
+			db	deh,0ch,6ah,eeh,51h,edh,b6h,96h
+			db	2ch,49h,87h,0eh,a6h,94h,44h,b5h
+			db	86h,e3h,42h,4ch
+			ld	e,c
+			sbc	a,(hl)
+			ld	e,e
+			xor	(hl)
+			ld	hl,2bc1h
+			sub	a
+			sub	e
+			ld	b,l
+			ld	h,l
+			ret	nc
+			ld	(bc),a
+			or	(hl)
+			add	a,e
+			ld	b,b
+			ld	a,e
+			or	b
+			ld	b,l
+			adc	a,11h
+			xor	e
+			ld	b,e
+			or	b
+			cp	d
+			adc	a,l
+			inc	hl
+			ld	e,b
+			ld	e,(hl)
+			or	aah
+			xor	a
+			and	e
+			rst	08h
+			rst	08h
+			inc	h
+			out	(29h),a
+			xor	12h
+			rst	00h
+			call	z,Lb413
+			ld	a,e
+			add	hl,bc
+			ld	h,d
+			sub	b
+			cp	03h
+			dec	d
+			ld	d,b
+			ccf
+			adc	a,e
+			or	e
+			xor	c
+			ld	e,b
+			cp	a
+			nop
+			inc	c
+			bit	5,c
+			adc	a,d
+			dec	d
+			ld	l,d
+			inc	l
+			rra
+			rlca
+			ld	h,(hl)
+			ret	p
+			ld	b,e
+			ld	c,l
+			and	e
+			call	z,Ld6bf
+			ld	h,d
+			xor	b
+			inc	de
+			ret	p
+			or	d
+			ld	(hl),l
+			ld	hl,913ah
+			adc	a,a
+			sub	b7h
+			ld	h,e
+			inc	b
+			ld	sp,6cbbh
+			xor	e
+			sbc	a,d
+			or	c
+			or	l
+			add	a,b
+			sub	c
+			jr	L67c0
+			db	3ch,53h,d3h,90h,e2h,79h,1dh,d8h
+			db	fbh,d9h,0bh,eeh,91h,09h,a4h,7ah
+			db	5dh,9fh,8ch,79h,4ch,18h,eah,5ah
+			db	beh,13h,75h,26h,13h,bdh,73h,4ah
+			db	13h,11h,14h,aah,56h,dch,4ah,99h
+			db	02h,cah,27h,10h,e2h,8dh,49h,36h
+			db	76h,c0h,08h,8bh,81h,b6h,29h,29h
+			db	70h,e7h,a8h,feh,33h,ech,ceh,9eh
+			db	b1h,02h,78h,09h,2ch,66h,edh,d0h
+			db	61h,32h,16h,41h,8eh,14h,09h,ddh
+			db	9ah,5eh,58h,c5h,c3h,33h,9bh,9ch
+			db	ffh,99h,d5h,6dh,f9h,92h,c7h,48h
+			db	b5h,90h,2ch,35h,80h,88h,39h,97h
+			db	49h,2dh,70h,83h,b0h,8dh,85h,06h
+			db	22h,31h,25h,49h,46h,17h,1eh,90h
+			db	5dh,c3h,36h,bbh,d3h,6ah,59h,c5h
+			db	77h,1bh,07h,43h,0ch,6dh,f2h,7dh
+			db	54h,e6h,1dh,d3h,a7h,a7h,eah,cfh
+			db	01h,dfh,38h,1bh,83h,89h,1ch,1ch
+			db	a2h,0dh,5ch,bah,36h,80h,56h,5ch
+			db	90h,c2h,0dh,61h,4bh,9dh,60h,28h
+			db	4fh,0ch,c2h,21h,51h,94h,f3h,6bh
+			db	44h,1eh,bfh,fch,b4h,75h,0fh,9ah
+			db	49h,17h,46h,73h,cah,95h,d2h,55h
+			db	d0h,2dh,47h,68h,65h,e5h,2fh,7bh
+			db	c0h,62h,9ch,9bh,4bh,89h,adh,6dh
+			db	d6h,7ah,5fh,29h,2dh,24h,25h,bdh
+			db	c6h,45h,e0h,aeh,32h,51h,5ch,9dh
+			db	bch,f1h,14h,03h,cfh,6eh,d1h,82h
+			db	e8h,34h,90h,2dh,a5h,22h,fah,46h
+			db	65h,46h,34h,34h,8bh,05h,27h,98h
+			db	a1h,e7h,53h,04h,57h,41h,f9h,b7h
+			db	eah,1ch,d6h,68h,f9h,24h,88h,7bh
+			db	08h,e9h,36h,61h,24h,e5h,c9h,e3h
+			db	1bh,32h,66h,2ch,88h,99h,65h,7eh
+			db	1bh,39h,fch,37h,3dh,38h,b6h,2eh
+			db	c2h,52h,e9h,9dh,87h,3ah,64h,cbh
+			db	ceh,3bh,52h,15h,04h,1bh,43h,c7h
+			db	eeh,a6h,53h,75h,93h,26h,41h,2eh
+			db	40h,4ch,42h,b8h,97h,e0h,b8h,0eh
+			db	96h,cah,21h,e3h,cch,73h,f7h,49h
+			db	fdh,f7h,06h,9fh,22h,bdh,fah,8ch
+			db	f8h,08h,1eh,0fh,d3h,43h,5ah,ach
+			db	24h,73h,b4h,25h,a9h,9dh,50h,b7h
+			db	43h,8fh,4dh,7ch,91h,edh,98h,36h
+			db	fch,2fh,5ch,9dh,70h,beh,77h,5ch
+			db	f2h,a3h,86h,02h,24h,28h,bdh,61h
+			db	12h,53h,4dh,b9h,7eh,34h,88h,22h
+			db	59h,adh,f4h,5bh,58h,42h,bdh,6ch
+			db	02h,fdh,cch,74h,75h,d9h,4dh,68h
+			db	afh,63h,10h,d6h,2eh,9ch,e1h,16h
+			db	cbh,4ch,aah,2ch,1dh,d6h,90h,edh
+			db	abh,feh,0bh,a8h,b6h,1ah,3fh,41h
+			db	14h,8ch,92h,67h,25h,efh,cbh,42h
+			db	01h,c9h,02h,f1h,65h,8fh,26h,d5h
+			db	11h,35h,5ch,90h,e5h,0eh,5ch,24h
+			db	79h,28h,e5h,f1h,e9h,b8h,87h,dfh
+			db	5fh,5dh,0bh,40h,d1h,57h,26h,feh
+			db	42h,f7h,09h,87h,c8h,56h,b9h,fah
+			db	f1h,75h,afh,0bh,68h,f6h,48h,1ch
+			db	2dh,17h,63h,75h,ebh,50h,53h,45h
+			db	58h,d0h,b1h,7ah,51h,a7h,60h,c0h
+			db	1eh,f6h,44h,62h,62h,8bh,b2h,82h
+			db	cch,5dh,4ah,91h,39h,34h,b4h,e9h
+			db	6ah,5fh,3ch,74h,8eh,1fh,18h,b7h
+			db	a1h,38h,97h,bah,f2h,26h,59h,1eh
+			db	87h,f7h,32h,88h,36h,d7h,98h,45h
+			db	59h,e6h,01h,97h,0ah,94h,16h,e9h
+			db	86h,36h,d0h,66h,19h,cdh,27h,f0h
+			db	deh,b0h,81h,dbh,cch,31h,86h,2ah
+			db	99h,3eh,eah,9bh,40h,56h,e6h,28h
+			db	92h,5fh,3eh,67h,adh,05h,3bh,4eh
+			db	1dh,50h,2eh,5bh,d0h,bdh,ceh,43h
+			db	08h,efh,57h,efh,82h,00h,f4h,93h
+			db	dah,00h,97h,efh,76h,88h,25h,d6h
+			db	a4h,c4h,8fh,35h,08h,43h,6ch,8eh
+			db	bah,bah,13h,f9h,98h,34h,12h,fch
+			db	27h,9fh,23h,63h,30h,feh,8bh,d8h
+			db	27h,c1h,ach,5fh,15h,aah,41h,7fh
+			db	b0h,e2h,1dh,1dh,54h,8dh,ddh,d2h
+			db	8bh,eeh,e6h,eah,cbh,8dh,a3h,8ah
+			db	3bh,adh,94h,86h,f6h,5eh,9bh,b7h
+			db	c7h,15h,5eh,3eh,f1h,1bh,dch,46h
+			db	68h,c5h,66h,78h,d7h,f1h,76h,3eh
+			db	5fh,a4h,68h,6dh,86h,c5h,55h,63h
+			db	b0h,54h,f4h,ceh,17h,5ch,30h,4bh
+			db	2ah,0ah,3eh,36h,b8h,71h,a3h,ddh
+			db	1bh,91h,e7h,a3h,50h,3eh,98h,4eh
+			db	fch,c3h,74h,3fh,b1h,09h,39h,efh
+			db	73h,9eh,06h,b2h,d0h,48h,68h,4fh
+			db	30h,f7h,a9h,95h,91h,f5h,d9h,3ah
+			db	f2h,9fh,d9h,5dh,abh,8bh,3dh,48h
+			db	c2h,adh,ebh,71h,a5h,8ah,ech,91h
+			db	e5h,39h,09h,89h,f1h,bfh,60h,55h
+			db	e2h,d5h,2ah,bdh,a2h,84h,21h,a7h
+			db	43h,a4h,cdh,40h,e6h,b4h,fah,51h
+			db	69h,37h,85h,2ch,33h,03h,e2h,1ah
+			db	8ch,ach,5ah,68h,58h,1bh,90h,54h
+			db	98h,d1h,6ah,b5h,52h,a5h,4dh,75h
+			db	9ah,7ah,e8h,ffh,dch,3bh,cbh,bdh
+			db	1eh,99h,60h,d9h,83h,6eh,b5h,9ch
+			db	30h,64h,3dh,e9h,75h,e8h,72h,92h
+			db	14h,3ch,e4h,dch,6fh,7eh,05h,0fh
+			db	55h,0eh,45h,03h,68h,58h,a7h,ach
+			db	11h,b5h,ffh,36h,7ch,4bh,ebh,d1h
+			db	6bh,55h,59h,8bh,85h,67h,9bh,21h
+			db	c0h,55h,22h,85h,22h,2ch,34h,cch
+			db	a2h,8ch,a5h,88h,14h,dch,d1h,0eh
+			db	21h,94h,c5h,f7h,64h,f2h,c4h,a8h
+			db	37h,f2h,71h,05h,f2h,d2h,dfh,43h
+			db	8ah,40h,f1h,5bh,d3h,79h,54h,edh
+			db	98h,f5h,cah,efh,80h,23h,0eh,14h
+			db	9eh,edh,8eh,50h,74h,69h,09h,76h
+			db	17h,42h,a4h,03h,3fh,9dh,d8h,6ch
+			db	26h,7eh,67h,ffh,b3h,66h,41h,84h
+			db	50h,3eh,dbh,47h,30h,10h,3ah,99h
+			db	52h,75h,6bh,10h,a2h,6fh,55h,05h
+			db	92h,edh,1bh,5fh,c1h,02h,83h,a6h
+			db	52h,2eh,bah,00h,8dh,afh,62h,afh
+			db	dbh,80h,8eh,beh,58h,10h,84h,00h
+			db	0bh,eah,ddh,36h,6eh,28h,17h,8bh
+			db	1ah,05h,8eh,abh,0fh,48h,38h,3eh
+			db	81h,66h,94h,17h,86h,57h,4fh,0eh
+			db	b3h,6ah,1dh,b2h,35h,52h,5ch,7dh
+			db	7ch,91h,eah,dbh,f4h,aeh,6fh,fah
+			db	29h,61h,34h,92h,38h,92h,07h,21h
+			db	f4h,42h,e5h,9ah,b5h,20h,71h,98h
+			db	ech,3bh,42h,abh,2fh,d3h,c3h,0eh
+			db	31h,a6h,aah,9bh,6fh,a0h,86h,e5h
+			db	99h,e0h,41h,68h,fch,b7h,efh,61h
+			db	40h,67h,a8h,adh,c2h,d0h,d2h,12h
+			db	2ah,7ch,dbh,4eh,27h,a2h,d1h,2dh
+			db	f9h,03h,fdh,17h,1eh,05h,f1h,73h
+			db	08h,5dh,6dh,2bh,5ah,bdh,cfh,41h
+			db	fbh,e7h,cfh,b0h,a0h,a3h,27h,23h
+			db	dbh,bbh,c6h,94h,3bh,2bh,01h,20h
+			db	6ch,97h,1ah,30h,1bh,b5h,cbh,89h
+			db	2ah,61h,a2h,ebh,14h,08h,69h,06h
+			db	3eh,27h,66h,c4h,f5h,f7h,d1h,60h
+			db	5ah,2bh,04h,7bh,48h,74h,bch,33h
+			db	cbh,7bh,adh,d5h,a1h,38h,a1h,76h
+			db	44h,f8h,a8h,64h,38h,e7h,09h,dch
+			db	f0h,70h,9ch,8eh,e0h,d2h,1fh,13h
+			db	5fh,18h,fdh,06h,96h,ddh,a2h,deh
+			db	c7h,abh,d8h,30h,f1h,89h,56h,0eh
+			db	95h,ceh,e4h,b8h,59h,45h,47h,dah
+			db	3bh,23h,0eh,f9h,2ch,45h,70h,94h
+			db	2dh,15h,a5h,7eh,84h,5dh,21h,84h
+			db	aah,74h,b9h,c8h,d8h,4eh,deh,7ch
+			db	b9h,41h,72h,58h,86h,25h,a9h,0dh
+			db	9bh,afh,79h,b5h,d9h,74h,48h,08h
+			db	e3h,6eh,43h,88h,8ch,1bh,34h,35h
+			db	a9h,9bh,70h,4fh,c1h,09h,b1h,70h
+			db	e0h,14h,88h,84h,efh,15h,dbh,4bh
+			db	66h,1dh,2ah,38h,32h,fch,64h,ceh
+			db	88h,c1h,a4h,50h,4eh,46h,34h,1dh
+			db	26h,7ah,ffh,64h,0bh,f5h,3eh,c3h
+			db	84h,1eh,4fh,01h,70h,64h,20h,77h
+			db	abh,37h,62h,c3h,6ch,3fh,cbh,02h
+			db	15h,18h,f0h,a0h,97h,bch,29h,70h
+			db	38h,43h,1eh,6dh,bdh,41h,87h,20h
+			db	30h,e0h,a6h,a2h,13h,fdh,feh,22h
+			db	10h,1bh,e7h,0ch,d6h,dch,a1h,efh
+			db	c8h,a8h,88h,afh,3fh,dch,59h,92h
+			db	eeh,93h,38h,a6h,b0h,c0h,e2h,70h
+			db	93h,62h,9ch,03h,b2h,95h,b9h,87h
+			db	17h,d3h,77h,64h,c3h,62h,2eh,dah
+			db	a1h,94h,37h,f2h,7ch,ffh,05h,c6h
+			db	e1h,38h,e4h,d3h,feh,84h,e7h,d9h
+			db	deh,bfh,c7h,cch,c7h,5dh,ffh,a6h
+			db	1ah,7eh,3eh,79h,cdh,28h,5ah,99h
+			db	a2h,5ah,66h,28h,c3h,63h,3dh,bch
+			db	4dh,9fh,06h,8dh,25h,f1h,93h,e1h
+			db	beh,82h,64h,7ch,21h,3dh,6bh,5eh
+			db	d7h,a7h,e9h,bbh,bbh,89h,afh,e1h
+			db	9eh,0ah,29h,27h,dah,7dh,81h,47h
+			db	ffh,c5h,89h,0bh,a1h,40h,98h,14h
+			db	5bh,5dh,d4h,abh,b1h,ebh,66h,6eh
+			db	03h,6ah,58h,0ah,81h,76h,88h,32h
+			db	82h,4ch,07h,e8h,4eh,ach,c7h,4eh
+			db	c0h,77h,27h,71h,21h,02h,30h,e6h
+			db	49h,eah,b5h,fah,86h,7bh,d7h,b8h
+			db	13h,57h,eeh,c6h,15h,dbh,b6h,1ch
+			db	d7h,19h,17h,a7h,63h,0dh,0ch,30h
+			db	a0h,4dh,71h,cch,2eh,88h,03h,d3h
+			db	dbh,28h,fbh,4ch,58h,abh,74h,e1h
+			db	9ch,9bh,0ah,16h,cah,16h,34h,72h
+			db	7bh,4fh,2eh,42h,7ah,78h,3bh,2bh
+			db	b6h,a5h,0fh,bfh,91h,dfh,6fh,f6h
+			db	47h,64h,fdh,a9h,87h,54h,9fh,83h
+			db	69h,25h,83h,83h,d8h,73h,9ah,ddh
+			db	10h,20h,89h,cbh,00h,49h,b2h,3bh
+			db	48h,8eh,d2h,1dh,b3h,e6h,68h,9dh
+			db	c3h,f1h,1ah,10h,7eh,c4h,feh,35h
+			db	c0h,15h,2fh,e0h,b1h,e1h,dah,c3h
+			db	4eh,20h,60h,33h,4dh,6ch,76h,b4h
+			db	e1h,97h,48h,36h,3fh,49h,8fh,ceh
+			db	aah,f6h,3dh,d7h,00h,59h,87h,dbh
+			db	9ch,70h,83h,afh,f8h,14h,89h,4bh
+			db	0bh,57h,6fh,aeh,a3h,aeh,5eh,17h
+			db	2ch,53h,bch,d2h,01h,00h,11h,69h
+			db	b1h,33h,10h,6bh,0fh,08h,35h,d8h
+			db	cbh,70h,e6h,66h,50h,c7h,b7h,3ch
+			db	3bh,56h,20h,37h,15h,86h,0eh,02h
+			db	d3h,c8h,24h,7fh,5bh,0dh,93h,60h
+			db	d2h,38h,ebh,5ch,cch,ddh,aeh,18h
+			db	59h,17h,39h,ach,98h,39h,9fh,9bh
+			db	7ah,56h,26h,5dh,d6h,eeh,beh,a6h
+			db	fbh,f1h,73h,40h,a7h,b3h,1eh,4ch
+			db	edh,6ah,21h,a0h,d2h,17h,afh,a6h
+			db	45h,fdh,67h,2eh,48h,e2h,70h,1eh
+			db	73h,e8h,a6h,fdh,21h,d2h,5fh,a9h
+			db	b2h,11h,76h,89h,81h,2ah,a7h,cdh
+			db	77h,edh,5fh,1ch,c2h,3ah,5bh,33h
+			db	5eh,81h,82h,8ch,00h,cbh,12h,adh
+			db	b9h,2fh,b0h,6eh,35h,7ch,0ah,32h
+			db	24h,f9h,eeh,dfh,beh,22h,4dh,c5h
+			db	25h,34h,61h,b2h,13h,e6h,3ah,deh
+			db	a3h,93h,21h,eah,43h,2fh,d8h,e0h
+			db	f5h,7bh,86h,13h,e9h,f4h,7fh,07h
+			db	63h,6bh,edh,f4h,d4h,e3h,17h,a0h
+			db	fah,6dh,48h,e2h,e3h,b6h,72h,0dh
+			db	2ah,9ch,23h,f3h,f3h,17h,c4h,21h
+			db	cch,7ah,22h,dfh,87h,d9h,7ah,f7h
+			db	18h,b5h,01h,3fh,71h,92h,fch,76h
+			db	38h,99h,beh,28h,c7h,97h,21h,a4h
+			db	d0h,16h,b9h,65h,02h,77h,ceh,32h
+			db	c8h,94h,57h,4eh,c9h,f3h,91h,e4h
+			db	d8h,e2h,4bh,f5h,24h,5fh,25h,29h
+			db	a6h,dch,13h,a4h,ech,95h,3eh,84h
+			db	8bh,59h,59h,87h,54h,2ah,ddh,a4h
+			db	4eh,9eh,8bh,82h,11h,50h,ffh,32h
+			db	ach,57h,5fh,40h,eah,09h,09h,17h
+			db	b7h,c3h,e4h,71h,48h,adh,e9h,33h
+			db	78h,26h,a3h,5fh,a5h,a8h,5ah,30h
+			db	c1h,38h,8fh,b0h,03h,68h,34h,f4h
+			db	6eh,74h,14h,8bh,53h,4ah,e1h,7ah
+			db	65h,feh,38h,d6h,94h,6bh,17h,bch
+			db	9ch,46h,05h,2eh,0ah,38h,6fh,94h
+			db	3fh,72h,f7h,58h,1dh,cbh,38h,17h
+			db	a0h,efh,fdh,aeh,78h,0ch,7dh,0fh
+			db	d2h,96h,7bh,60h,b8h,16h,c0h,ceh
+			db	09h,78h,0fh,c9h,02h,83h,d1h,fdh
+			db	17h,b8h,46h,90h,46h,cdh,8fh,1dh
+			db	54h,83h,b5h,63h,45h,92h,17h,bch
+			db	62h,8eh,c5h,76h,19h,ceh,afh,b8h
+			db	48h,d2h,d3h,4eh,88h,e3h,6ah,3bh
+			db	78h,70h,91h,74h,88h,61h,27h,a1h
+			db	72h,55h,6ch,ddh,33h,d3h,fch,69h
+			db	1ch,deh,fbh,0bh,c9h,40h,8fh,fbh
+			db	2dh,6ch,53h,fah,a7h,18h,71h,a3h
+			db	87h,25h,42h,5bh,92h,0fh,00h,4ah
+			db	bdh,83h,afh,07h,66h,8fh,e5h,7ah
+			db	a4h,d7h,5dh,6fh,2bh,67h,88h,b3h
+			db	b1h,43h,d6h,2bh,31h,30h,00h,e6h
+			db	34h,6ah,96h,13h,b6h,15h,ddh,d5h
+			db	55h,2fh,51h,5bh,88h,7eh,a2h,17h
+			db	b9h,e7h,17h,b0h,38h,e5h,30h,48h
+			db	b1h,52h,efh,4bh,d7h,9eh,3fh,7bh
+			db	a5h,73h,bch,5dh,cah,fbh,56h,73h
+			db	59h,84h,8dh,eeh,44h,56h,75h,4bh
+			db	0dh,feh,1eh,85h,9bh,01h,21h,f6h
+			db	f5h,09h,18h,b1h,8bh,d3h,3bh,1eh
+			db	17h,8bh,26h,ddh,c9h,3ah,82h,90h
+			db	31h,d5h,8dh,21h,62h,17h,ebh,79h
+			db	01h,cch,fbh,9ch,cch,56h,3ah,ach
+			db	d6h,b6h,3dh,7dh,0fh,eeh,beh,f4h
+			db	54h,32h,8dh,9ch,61h,a5h,42h,cfh
+			db	dfh,89h,d0h,0bh,fbh,b4h,4fh,4bh
+			db	78h,34h,41h,c7h,14h,99h,d8h,5dh
+			db	98h,a7h,1ah,feh,bah,bch,51h,fah
+			db	c3h,67h,bah,9bh,9eh,feh,78h,fah
+			db	e7h,1eh,e3h,39h,44h,3fh,81h,49h
+			db	fdh,d1h,2fh,44h,32h,abh,6bh,fbh
+			db	fah,cbh,b9h,e1h,58h,eeh,48h,a8h
+			db	5dh,8eh,cah,e2h,81h,a9h,51h,efh
+			db	3eh,72h,e8h,78h,6ch,90h,15h,7dh
+			db	41h,17h,1ch,75h,3ch,36h,3dh,9ch
+			db	4fh,edh,9eh,36h,a8h,3fh,56h,a2h
+			db	71h,1bh,02h,25h,51h,50h,58h,9bh
+			db	80h,46h,77h,72h,03h,20h,ffh,47h
+			db	50h,66h,35h,20h,e9h,57h,f1h,46h
+			db	edh,dch,1bh,35h,20h,70h,93h,ech
+			db	99h,69h,d6h,47h,66h,cfh,f6h,dch
+			db	d3h,a5h,19h,2bh,3ch,92h,4eh,11h
+			db	0eh,39h,b5h,0dh,49h,deh,5ah,b0h
+			db	9fh,feh,f5h,05h,91h,54h,75h,82h
+			db	6bh,68h,fdh,07h,2dh,9ch,d7h,bdh
+			db	bdh,ffh,7eh,3fh,28h,dfh,45h,e9h
+			db	04h,1fh,edh,15h,9ch,6dh,d9h,09h
+			db	b9h,22h,dah,5ch,c5h,96h,dch,85h
+			db	f7h,1ah,47h,10h,c7h,b5h,90h,a8h
+			db	11h,7ch,41h,41h,a2h,10h,11h,78h
+			db	3ah,6fh,9fh,ach,58h,2dh,bbh,ach
+			db	ach,b9h,1eh,58h,7dh,b2h,06h,57h
+			db	64h,bdh,7ch,8ch,dch,22h,43h,01h
+			db	c0h,83h,ebh,37h,dbh,1fh,fdh,d5h
+			db	72h,6ah,aah,a9h,5dh,cfh,2fh,beh
+			db	25h,48h,f7h,65h,85h,d5h,1ch,f1h
+			db	89h,65h,a5h,73h,bbh,53h,1bh,8fh
+			db	e3h,b3h,62h,0fh,1dh,a3h,9ah,55h
+			db	82h,b8h,9ah,e9h,a4h,63h,39h,f9h
+			db	a3h,bah,9ah,e6h,7ch,f0h,66h,aah
+			db	e1h,33h,53h,f4h,44h,82h,90h,86h
+			db	f1h,7ah,d4h,cah,41h,2eh,beh,1bh
+			db	03h,d6h,7eh,5eh,72h,10h,42h,47h
+			db	2fh,aeh,97h,6eh,c5h,5bh,f8h,89h
+			db	d6h,7ah,81h,a3h,f8h,cdh,72h,88h
+			db	40h,d1h,28h,56h,04h,7ch,1bh,37h
+			db	cah,4ah,4ah,7dh,13h,81h,a8h,01h
+			db	38h,61h,dch,a1h,92h,b3h,edh,f0h
+			db	25h,77h,0fh,ebh,61h,f9h,ech,68h
+			db	cbh,77h,37h,18h,64h,d7h,91h,b6h
+			db	d2h,a4h,9ch,a1h,c9h,49h,bfh,4dh
+			db	8bh,90h,15h,c1h,bch,64h,e4h,8eh
+			db	7fh,72h,0eh,82h,f2h,33h,2bh,87h
+			db	5eh,b4h,3ch,f3h,35h,3ah,70h,3bh
+			db	8eh,91h,33h,1fh,fch,23h,02h,c2h
+			db	5ch,dch,abh,05h,2ah,cah,d6h,13h
+			db	05h,53h,57h,96h,a5h,ffh,b8h,50h
+			db	55h,fah,b2h,f4h,73h,5fh,ddh,18h
+			db	87h,ffh,ceh,40h,e3h,54h,e6h,14h
+			db	f1h,cfh,3ah,e3h,5ah,2dh,0ah,88h
+			db	5eh,82h,e3h,b9h,0bh,06h,4ah,7bh
+			db	54h,d5h,beh,e3h,07h,88h,a5h,d6h
+			db	f4h,03h,0ah,b3h,90h,25h,2fh,d0h
+			db	90h,6eh,85h,9bh,61h,e8h,eah,e1h
+			db	adh,b2h,39h,7ch,09h,78h,eah,71h
+			db	c9h,61h,87h,4bh,04h,f6h,95h,5dh
+			db	0dh,e8h,12h,b8h,11h,65h,14h,a8h
+			db	12h,aeh,b5h,9ch,96h,80h,57h,fbh
+			db	4bh,22h,3ch,e3h,87h,a0h,91h,6bh
+			db	aeh,a8h,f6h,cbh,1fh,8dh,fbh,04h
+			db	8ch,bbh,5ah,a7h,ddh,fbh,a6h,11h
+			db	d0h,80h,f9h,d9h,35h,9fh,b5h,17h
+			db	9dh,72h,9ch,a4h,c5h,51h,6ch,d2h
+			db	b1h,8ch,bch,deh,e1h,57h,e3h,3bh
+			db	7ch,41h,a8h,7fh,92h,4ch,37h,aah
+			db	68h,bch,e8h,e4h,1eh,c1h,38h,e7h
+			db	9fh,cdh,07h,adh,e0h,bfh,a1h,eeh
+			db	ebh,51h,0ah,37h,f9h,03h,82h,69h
+			db	a6h,1fh,7fh,bdh,a4h,87h,adh,3eh
+			db	43h,bbh,45h,16h,e5h,67h,d9h,35h
+			db	09h,afh,7dh,ceh,36h,c6h,ddh,84h
+			db	99h,e0h,3ah,7ah,6ah,d3h,dah,57h
+			db	4dh,bbh,76h,38h,75h,f6h,94h,f1h
+			db	13h,40h,4ah,21h,85h,b6h,dch,ech
+			db	8bh,f0h,28h,28h,25h,1bh,85h,6ah
+			db	dch,18h,b0h,afh,c7h,8ah,57h,dfh
+			db	84h,b0h,b9h,1ah,3bh,51h,6bh,a5h
+			db	f2h,c7h,75h,0ch,76h,60h,46h,a9h
+			db	23h,81h,2ah,97h,b0h,8dh,9ah,aeh
+			db	9bh,6ah,7ah,f9h,f7h,f9h,eeh,54h
+			db	15h,8dh,31h,3dh,e4h,8ch,4bh,2dh
+			db	0ah,c3h,43h,fdh,68h,b6h,85h,49h
+			db	deh,30h,b6h,0dh,08h,f9h,b0h,a2h
+			db	2eh,beh,1dh,f4h,fdh,75h,4bh,5dh
+			db	19h,31h,24h,91h,83h,51h,b6h,f4h
+			db	58h,c0h,10h,c8h,49h,f4h,2dh,6dh
+			db	61h,70h,04h,d7h,13h,53h,02h,dbh
+			db	6fh,cfh,71h,5fh,dah,b2h,34h,65h
+			db	40h,32h,99h,efh,6bh,b8h,f5h,21h
+			db	f7h,6ch,90h,fah,09h,fbh,7eh,4ch
+			db	6fh,63h,fdh,a9h,65h,43h,cah,20h
+			db	bbh,69h,35h,4fh,adh,a6h,45h,0ch
+			db	8ah,65h,0dh,2ah,83h,b9h,d4h,3dh
+			db	64h,85h,adh,64h,fch,9bh,fdh,76h
+			db	33h,4ch,e9h,f5h,71h,48h,f6h,41h
+			db	47h,d1h,7ch,16h,0dh,edh,39h,c6h
+			db	c5h,4fh,f3h,36h,02h,39h,b4h,b0h
+			db	3ch,99h,0bh,ech,b2h,1dh,bch,5ch
+			db	35h,0ah,28h,65h,e0h,3ah,a2h,71h
+			db	31h,fbh,7fh,89h,95h,12h,20h,aah
+			db	27h,91h,2fh,d7h,8fh,dbh,11h,18h
+			db	78h,afh,c9h,5ah,dch,d0h,46h,5ah
+			db	d0h,8bh,55h,30h,d5h,e8h,3dh,eah
+			db	d2h,3dh,c6h,b2h,dbh,ddh,39h,d3h
+			db	85h,b3h,fah,cbh,d9h,f6h,65h,2dh
+			db	6ch,a3h,7ah,37h,f4h,29h,a2h,2ch
+			db	a9h,aeh,37h,89h,a5h,fch,68h,77h
+			db	5dh,15h,d2h,dbh,b1h,66h,d6h,17h
+			db	3eh,e8h,62h,c6h,37h,97h,adh,d5h
+			db	10h,69h,48h,52h,59h,a8h,14h,08h
+			db	adh,f7h,feh,40h,7ch,8bh,15h,a0h
+			db	38h,03h,2eh,1bh,70h,39h,a4h,bah
+			db	20h,eeh,0ch,9bh,76h,ach,c6h,d7h
+			db	2ah,31h,12h,1fh,f7h,25h,96h,c1h
+			db	a1h,4fh,17h,7ah,58h,b5h,f4h,8eh
+			db	09h,68h,8bh,6ch,84h,68h,56h,69h
+			db	b7h,bdh,11h,23h,0bh,74h,afh,f5h
+			db	5bh,10h,8dh,28h,0dh,4fh,5ch,10h
+			db	cbh,40h,c0h,6dh,23h,bdh,27h,45h
+			db	78h,69h,74h,cdh,77h,94h,e3h,99h
+			db	12h,b0h,00h,5ah,56h,60h,25h,28h
+			db	c7h,f1h,b9h,b3h,c5h,73h,6eh,66h
+			db	fch,82h,42h,3fh,b2h,41h,aeh,e8h
+			db	1ah,97h,f2h,5ch,9dh,bah,9dh,99h
+			db	98h,91h,fdh,dah,1fh,fbh,49h,b0h
+			db	c1h,76h,fbh,2fh,0dh,6eh,c0h,47h
+			db	95h,f1h,21h,8bh,85h,76h,70h,b1h
+			db	a7h,22h,8ah,e2h,10h,0bh,8dh,bah
+			db	adh,86h,61h,cch,83h,f4h,b1h,fch
+			db	2ah,2ah,25h,f6h,4eh,cah,92h,fbh
+			db	4ch,39h,79h,a5h,b0h,8ah,f3h,dah
+			db	23h,b7h,30h,43h,3fh,1bh,9ah,27h
+			db	ech,89h,40h,b8h,3fh,ech,2bh,8bh
+			db	b1h,02h,c6h,adh,d0h,57h,46h,40h
+			db	72h,ebh,95h,ceh,7bh,94h,8ah,49h
+			db	aah,78h,c0h,83h,72h,50h,48h,78h
+			db	72h,efh,ddh,6eh,1ah,37h,3ah,edh
+			db	a4h,70h,01h,4ch,dfh,9ch,9eh,29h
+			db	b6h,43h,edh,2ch,3eh,b9h,49h,a2h
+			db	5ch,5bh,25h,deh,d2h,bch,f5h,f5h
+			db	5fh,1fh,3fh,5ch,14h,46h,38h,63h
+			db	50h,75h,17h,8bh,61h,03h,77h,96h
+			db	e2h,12h,65h,f0h,b0h,2bh,f2h,31h
+			db	92h,20h,55h,d5h,10h,65h,bbh,41h
+			db	2eh,9dh,29h,bfh,7ch,32h,d0h,8eh
+			db	03h,4fh,33h,0ch,e9h,90h,a6h,c3h
+			db	c3h,71h,5fh,9ah,bdh,b5h,54h,25h
+			db	41h,75h,3fh,38h,aah,08h,9fh,ach
+			db	e4h,1bh,c8h,78h,c4h,92h,13h,b2h
+			db	e9h,1bh,8eh,78h,5fh,b5h,a2h,12h
+			db	5eh,28h,ach,b5h,5fh,76h,74h,e4h
+			db	ech,f6h,78h,7dh,eeh,1ch,34h,6bh
+			db	49h,9dh,b1h,96h,99h,63h,8fh,3ch
+			db	83h,5ah,4fh,c2h,ebh,31h,0ah,aeh
+			db	bch,f8h,27h,e4h,59h,abh,08h,5fh
+			db	1ah,ceh,43h,aeh,c5h,12h,50h,76h
+			db	76h,b6h,9bh,cdh,1eh,b8h,61h,f3h
+			db	73h,e1h,eah,e3h,abh,c4h,c6h,f2h
+			db	90h,71h,23h,a6h,f9h,88h,78h,1bh
+			db	b8h,51h,6bh,bch,36h,b4h,59h,eah
+			db	69h,6fh,66h,56h,ddh,a4h,13h,abh
+			db	15h,1ah,ceh,2dh,7ah,57h,2fh,c7h
+			db	1dh,83h,d7h,02h,f8h,63h,e2h,b4h
+			db	e9h,c1h,bah,f3h,59h,dch,feh,69h
+			db	e6h,9fh,fdh,58h,61h,34h,a4h,c1h
+			db	f0h,d3h,65h,45h,1ah,2ch,82h,b0h
+			db	47h,c3h,2ah,feh,34h,76h,b7h,50h
+			db	23h,f3h,c9h,9fh,d8h,58h,44h,fch
+			db	72h,b9h,85h,b4h,0bh,0eh,09h,e0h
+			db	35h,42h,0ch,7fh,77h,e4h,30h,6eh
+			db	a3h,92h,40h,e2h,dah,fch,3ch,1ch
+			db	ddh,55h,4ah,9ah,00h,fch,5bh,0fh
+			db	c4h,87h,6ch,27h,20h,47h,44h,cch
+			db	7eh,8eh,77h,4dh,e8h,1bh,36h,ach
+			db	0eh,a3h,37h,fch,a0h,a0h,35h,b7h
+			db	21h,86h,d7h,f5h,36h,c8h,00h,cah
+			db	d8h,e7h,08h,73h,e1h,8eh,69h,0fh
+			db	33h,aeh,20h,7ch,94h,49h,00h,95h
+			db	b2h,73h,bbh,dch,35h,dfh,b5h,13h
+			db	91h,c4h,13h,e0h,edh,47h,18h,4ah
+			db	25h,5ah,5dh,a5h,57h,01h,f7h,73h
+			db	c0h,61h,11h,a1h,9fh,c6h,4eh,ebh
+			db	05h,d7h,b0h,eeh,e7h,2ah,c1h,eeh
+			db	8eh,74h,1bh,aeh,c7h,4ah,3ah,2fh
+			db	e8h,fah,bbh,16h,e0h,4bh,f2h,1eh
+			db	3fh,7bh,7ah,29h,4bh,31h,41h,11h
+			db	efh,95h,a6h,3fh,00h,d2h,77h,9ch
+			db	adh,57h,46h,19h,87h,bah,dch,a0h
+			db	70h,48h,c0h,65h,11h,2fh,66h,d3h
+			db	96h,5bh,75h,08h,beh,c0h,26h,b5h
+			db	43h,e2h,4dh,b0h,e6h,aeh,fdh,0fh
+			db	75h,8ah,fbh,dfh,71h,6bh,24h,7ah
+			db	04h,5ch,c5h,b1h,15h,bbh,3ch,ddh
+			db	43h,9ah,66h,32h,41h,1ch,b3h,75h
+			db	2ch,4eh,efh,a2h,37h,24h,c6h,e2h
+			db	85h,9eh,beh,fah,b8h,80h,33h,aeh
+			db	c8h,0eh,7bh,34h,fbh,2ah,4eh,9bh
+			db	7ah,bfh,2fh,6ah,30h,7ah,5eh,93h
+			db	efh,81h,a2h,70h,73h,29h,70h,a4h
+			db	8eh,99h,2eh,f6h,5fh,d1h,f5h,96h
+			db	8fh,17h,9ch,bdh,38h,99h,88h,d3h
+			db	9ch,31h,3eh,74h,bdh,3bh,8eh,a2h
+			db	cdh,32h,abh,d4h,9ah,77h,00h,05h
+			db	2dh,c4h,2ch,cah,bfh,eah,22h,77h
+			db	95h,01h,f1h,21h,47h,9ah,f9h,21h
+			db	63h,3ch,21h,24h,0dh,5ah,06h,77h
+			db	03h,58h,58h,25h,30h,7fh,9dh,3dh
+			db	75h,5fh,c6h,dah,9dh,9dh,c9h,a1h
+			db	b4h,ech,f8h,d5h,a0h,eah,cfh,97h
+			db	9dh,24h,3fh,16h,f9h,08h,7eh,bbh
+			db	ddh,d3h,73h,6fh,aah,9ah,d9h,c3h
+			db	65h,57h,f6h,3fh,dch,cah,6fh,5ah
+			db	3bh,5eh,0fh,8eh,30h,5ch,3fh,22h
+			db	c6h,c4h,4dh,85h,6ah,e2h,90h,a6h
+			db	8ch,08h,2dh,2dh,0fh,bch,c3h,58h
+			db	14h,bah,5bh,79h,16h,8ah,e0h,9ch
+			db	92h,4bh,70h,cbh,fbh,59h,15h,aah
+			db	fch,f8h,5ah,7ch,1bh,3ah,70h,bch
+			db	eah,a4h,c2h,dfh,68h,18h,ach,ach
+			db	b3h,19h,5eh,22h,a0h,2bh,93h,f8h
+			db	22h,09h,12h,57h,bfh,7bh,c4h,4bh
+			db	24h,4ch,14h,83h,b9h,2fh,55h,97h
+			db	bbh,dfh,54h,cch,e9h,03h,aeh,8eh
+			db	3dh,5bh,cbh,01h,cah,e4h,33h,98h
+			db	32h,5eh,26h,18h,bfh,3bh,08h,a5h
+			db	beh,38h,64h,f6h,5eh,75h,5bh,8dh
+			db	a8h,08h,fah,4dh,02h,86h,50h,48h
+			db	2ch,a8h,a0h,a0h,76h,aeh,e3h,54h
+			db	6dh,b7h,47h,ebh,c0h,80h,afh,9ah
+			db	7eh,1dh,36h,0bh,0fh,77h,86h,3bh
+			db	7ch,dch,b4h,58h,62h,4bh,deh,65h
+			db	32h,28h,f5h,5eh,98h,e6h,19h,b8h
+			db	89h,9dh,e7h,00h,13h,50h,00h,5fh
+			db	2bh,3fh,c9h,89h,76h,4ch,e9h,dah
+			db	c3h,aah,ebh,a1h,5fh,21h,28h,ach
+			db	b3h,8ah,49h,e8h,b9h,8dh,00h,04h
+			db	56h,cbh,bdh,b2h,12h,25h,65h,27h
+			db	f6h,4ah,dch,05h,83h,69h,dbh,eeh
+			db	65h,dbh,deh,a1h,9ah,86h,02h,9eh
+			db	d8h,9bh,9ah,5dh,7bh,5ah,a0h,f4h
+			db	56h,d3h,eeh,07h,36h,12h,39h,f6h
+			db	b1h,20h,aeh,14h,0dh,eah,50h,54h
+			db	e5h,28h,b8h,13h,88h,bdh,f6h,d8h
+			db	36h,c5h,eeh,2ah,48h,12h,a0h,47h
+			db	61h,6bh,21h,57h,aah,3dh,d0h,3bh
+			db	69h,9fh,3fh,45h,81h,2eh,27h,6fh
+			db	fch,5eh,64h,d5h,bdh,e1h,56h,58h
+			db	09h,65h,cbh,56h,71h,a8h,52h,ddh
+			db	9ch,67h,86h,9ah,2dh,afh,56h,3ch
+			db	9eh,39h,57h,07h,30h,3ch,c9h,00h
+			db	09h,83h,8eh,13h,c5h,1dh,b4h,feh
+			db	f3h,00h,c2h,f8h,c1h,6ah,12h,9bh
+			db	d0h,5ah,93h,15h,4eh,18h,72h,0ch
+			db	e4h,a7h,8dh,2ah,81h,b9h,f9h,aah
+			db	87h,eah,43h,d3h,05h,2bh,05h,9eh
+			db	45h,8ch,0fh,d0h,a9h,2ch,cfh,84h
+			db	a8h,c2h,e3h,ceh,ach,fch,59h,bah
+			db	90h,35h,56h,a2h,64h,60h,55h,f9h
+			db	f4h,eah,35h,63h,5bh,bch,66h,18h
+			db	81h,72h,9ah,48h,77h,cch,c8h,02h
+			db	bch,89h,5eh,3eh,38h,24h,c1h,87h
+			db	b6h,34h,3ch,34h,15h,5ch,7eh,01h
+			db	8bh,65h,03h,aah,9fh,f3h,59h,9eh
+			db	47h,cah,3ah,7eh,0ch,bdh,c9h,4eh
+			db	33h,d0h,0eh,b1h,e1h,a6h,12h,ebh
+			db	b8h,b7h,21h,b3h,17h,e0h,70h,1bh
+			db	d8h,99h,50h,80h,4ah,99h,65h,c4h
+			db	3eh,a6h,16h,b3h,bbh,f2h,20h,ffh
+			db	f4h,09h,00h,81h,a3h,c7h,afh,cbh
+			db	f4h,83h,19h,b9h,1dh,75h,2ch,32h
+			db	0ah,95h,b2h,91h,c6h,3ah,51h,73h
+			db	cch,06h,99h,0ch,3ah,94h,72h,02h
+			db	64h,9dh,12h,1dh,74h,7bh,56h,16h
+			db	9ch,03h,9eh,72h,06h,36h,4ah,53h
+			db	f6h,1ch,e1h,f5h,6ah,96h,00h,63h
+			db	48h,aah,a7h,54h,3fh,f2h,d1h,7dh
+			db	f0h,5bh,bch,44h,27h,30h,abh,16h
+			db	beh,05h,dbh,7bh,fah,36h,1dh,3bh
+			db	30h,2fh,03h,8dh,2fh,41h,e3h,96h
+			db	58h,00h,b9h,8eh,69h,80h,60h,75h
+			db	c7h,55h,0ah,68h,a4h,ddh,12h,e5h
+			db	69h,29h,72h,bfh,58h,1ah,6dh,0ah
+			db	a4h,9eh,61h,1eh,5eh,5dh,b5h,87h
+			db	05h,3fh,fbh,c9h,41h,cah,10h,92h
+			db	6fh,deh,8eh,05h,d1h,fbh,76h,71h
+			db	55h,75h,5ah,72h,68h,e2h,1bh,f3h
+			db	28h,f3h,22h,96h,95h,e6h,57h,1ah
+			db	e9h,03h,67h,15h,68h,f1h,55h,89h
+			db	d5h,01h,06h,65h,60h,eeh,29h,39h
+			db	4ah,3dh,a5h,bch,ech,6dh,3ah,d5h
+			db	06h,38h,35h,35h,a5h,20h,8bh,e7h
+			db	93h,49h,28h,9bh,48h,2fh,75h,3eh
+			db	31h,7fh,5ah,26h,9eh,f4h,57h,4fh
+			db	bfh,0eh,8ah,f2h,51h,42h,19h,92h
+			db	1eh,aeh,ebh,38h,33h,d0h,e9h,ach
+			db	93h,7fh,e9h,d8h,fdh,16h,3dh,12h
+			db	eah,8ch,5ah,93h,64h,5dh,6eh,a9h
+			db	39h,e7h,14h,5eh,fah,54h,84h,fch
+			db	36h,9dh,2eh,31h,cch,cbh,0bh,4dh
+			db	8eh,43h,e1h,fch,73h,8dh,19h,6dh
+			db	f6h,a2h,cch,48h,96h,62h,24h,17h
+			db	64h,f8h,89h,95h,01h,9dh,5fh,35h
+			db	0bh,e9h,0ch,2ch,3dh,8ch,0ah,28h
+			db	51h,33h,7ah,29h,f5h,82h,4ah,e8h
+			db	b9h,50h,c9h,2ch,9ch,beh,04h,8dh
+			db	11h,72h,8bh,ebh,04h,e8h,b5h,c5h
+			db	fah,e8h,59h,16h,48h,78h,fdh,c7h
+			db	b4h,bdh,c6h,44h,24h,62h,0dh,c8h
+			db	bch,67h,99h,60h,22h,f7h,b6h,43h
+			db	34h,a3h,39h,fbh,c0h,55h,3dh,f6h
+			db	c2h,c4h,17h,5ah,22h,d7h,26h,4ah
+			db	b4h,d4h,a4h,f4h,77h,03h,27h,80h
+			db	d6h,04h,bbh,fbh,d9h,cfh,2dh,9dh
+			db	afh,26h,bch,0fh,41h,a5h,a4h,cdh
+			db	0bh,88h,d6h,80h,a5h,31h,2dh,e4h
+			db	f4h,52h,34h,5eh,edh,18h,b7h,6ah
+			db	38h,36h,77h,e6h,2ah,63h,62h,2bh
+			db	8dh,66h,eeh,a7h,2ah,d0h,86h,18h
+			db	a6h,ebh,d3h,62h,e3h,f4h,67h,f8h
+			db	aah,c2h,3dh,85h,bah,b7h,0dh,0bh
+			db	62h,02h,3fh,bbh,6ch,e0h,17h,c7h
+			db	2ch,18h,e9h,2bh,21h,a4h,b9h,13h
+			db	0ch,0eh,aeh,e9h,21h,4ah,97h,aeh
+			db	23h,d3h,8dh,40h,b9h,65h,16h,37h
+			db	48h,13h,80h,cah,95h,bbh,4ah,f8h
+			db	19h,4fh,93h,d9h,1ah,0bh,d7h,71h
+			db	99h,0eh,06h,2dh,c7h,ffh,b6h,0bh
+			db	4fh,8ch,8fh,95h,33h,88h,01h,96h
+			db	3fh,49h,96h,0dh,aeh,aeh,e9h,f8h
+			db	c6h,d7h,3bh,39h,fdh,c6h,11h,6ch
+			db	6eh,f6h,8eh,79h,e8h,83h,1ch,c4h
+			db	05h,aeh,a7h,04h,cbh,6bh,8bh,aeh
+			db	86h,94h,2eh,a3h,cch,7bh,c6h,67h
+			db	c6h,0ch,09h,c4h,b3h,99h,17h,8fh
+			db	a2h,21h,88h,14h,3ch,65h,9eh,00h
+			db	b8h,88h,76h,85h,88h,74h,ffh,94h
+			db	65h,a1h,87h,dah,04h,d0h,8fh,c7h
+			db	f1h,64h,7fh,39h,a3h,99h,d9h,b0h
+			db	2bh,e1h,0dh,a9h,96h,1dh,55h,c9h
+			db	78h,80h,62h,41h,7fh,4ch,18h,5ah
+			db	7dh,24h,86h,3ah,92h,74h,a8h,92h
+			db	a2h,28h,15h,48h,a3h,03h,9fh,80h
+			db	12h,71h,a9h,fbh,35h,e0h,37h,50h
+			db	31h,69h,04h,9ch,8dh,1ah,a5h,56h
+			db	d4h,95h,c7h,dfh,d3h,afh,32h,19h
+			db	0eh,32h,4bh,87h,67h,ach,32h,4ah
+			db	76h,b4h,b7h,36h,08h,afh,f0h,adh
+			db	c4h,e7h,91h,eeh,f9h,87h,9ch,23h
+			db	34h,a8h,1fh,01h,c3h,26h,ffh,5fh
+			db	27h,30h,88h,9ch,fah,3bh,54h,46h
+			db	22h,b7h,b6h,9ch,5ch,55h,3ah,4dh
+			db	dbh,80h,1eh,b6h,93h,6fh,f7h,30h
+			db	a5h,d1h,3ah,beh,8ch,25h,6eh,b7h
+			db	20h,2dh,d2h,67h,bbh,dfh,8ah,a3h
+			db	12h,30h,e7h,d2h,4ch,40h,a6h,90h
+			db	91h,4ch,d9h,1ch,85h,b9h,63h,f3h
+			db	5ah,d8h,7ah,e7h,bdh,e4h,1fh,74h
+			db	99h,42h,e9h,83h,51h,0bh,e2h,19h
+			db	f8h,b9h,c8h,07h,47h,04h,2ah,1eh
+			db	2bh,80h,d9h,38h,d8h,1fh,4eh,63h
+			db	7ch,2ch,46h,06h,aah,9eh,4eh,26h
+			db	95h,d5h,a6h,dbh,46h,f4h,f0h,4bh
+			db	69h,d4h,afh,95h,f3h,27h,09h,dfh
+			db	e8h,39h,d4h,beh,3ah,81h,50h,ceh
+			db	f2h,12h,42h,b3h,5dh,f5h,fch,e6h
+			db	1ah,70h,34h,aah,adh,ddh,71h,42h
+			db	98h,c6h,dah,57h,c8h,c6h,a8h,d3h
+			db	f5h,c1h,a5h,00h,91h,8ah,fbh,ffh
+			db	39h,fdh,5bh,f9h,8ah,d2h,33h,fbh
+			db	23h,b8h,d1h,63h,beh,aah,47h,4fh
+			db	74h,42h,a6h,f5h,21h,60h,5bh,b5h
+			db	f3h,78h,c1h,c5h,85h,68h,32h,b7h
+			db	29h,36h,f2h,3fh,3bh,07h,e7h,3ch
+			db	e0h,21h,b0h,cbh,64h,ceh,e9h,5fh
+			db	c5h,e8h,2ch,e8h,77h,87h,2eh,91h
+			db	96h,7eh,d0h,95h,d8h,c3h,6ah,5ah
+			db	5ch,9ch,33h,13h,bah,0bh,c6h,70h
+			db	a5h,08h,45h,78h,1dh,56h,74h,cch
+			db	1fh,92h,c2h,f1h,f4h,48h,16h,99h
+			db	40h,82h,fdh,61h,0bh,f5h,d1h,96h
+			db	9bh,b5h,c8h,50h,a0h,97h,70h,04h
+			db	05h,d0h,b6h,a9h,d3h,35h,68h,79h
+			db	72h,45h,80h,9dh,6ah,3eh,fah,64h
+			db	abh,e4h,06h,8ch,09h,aah,afh,83h
+			db	edh,70h,98h,41h,c7h,7fh,75h,e7h
+			db	89h,06h,e8h,d6h,b6h,bdh,cch,f2h
+			db	62h,f4h,85h,7bh,59h,d4h,4eh,14h
+			db	30h,a1h,5ah,7dh,65h,24h,bbh,97h
+			db	ceh,afh,3fh,56h,50h,afh,5ah,ffh
+			db	adh,32h,c1h,ebh,8dh,62h,d1h,cfh
+			db	b2h,f0h,6eh,42h,ceh,7ah,c0h,b7h
+			db	ech,73h,a6h,29h,0bh,c4h,46h,b3h
+			db	7bh,2ch,6ch,36h,d3h,48h,53h,f1h
+			db	70h,35h,65h,9bh,7eh,56h,eeh,a6h
+			db	85h,99h,ceh,5ch,8fh,50h,dah,43h
+			db	03h,ebh,deh,5eh,18h,85h,32h,4ch
+			db	78h,91h,24h,73h,33h,bdh,dfh,7dh
+			db	75h,d0h,9bh,69h,88h,fch,04h,22h
+			db	d9h,a4h,63h,9ch,5eh,bah,47h,76h
+			db	54h,89h,d8h,88h,d5h,28h,d2h,a2h
+			db	91h,85h,bdh,3dh,16h,ddh,80h,bdh
+			db	f0h,a7h,cbh,2eh,efh,0bh,81h,0eh
+			db	74h,7fh,f5h,12h,3dh,e7h,07h,d2h
+			db	71h,4dh,10h,58h,97h,30h,59h,9ah
+			db	b9h,42h,18h,eah,24h,05h,6bh,16h
+			db	6dh,70h,e3h,76h,b5h,c3h,57h,01h
+			db	4fh,e1h,3dh,97h,6dh,1bh,c5h,bah
+			db	23h,54h,21h,c8h,2ch,d6h,0dh,63h
+			db	70h,8ah,14h,feh,1bh,e1h,2eh,7ah
+			db	d5h,48h,b0h,84h,99h,ach,d4h,5ah
+			db	35h,77h,02h,88h,fch,60h,cdh,deh
+			db	bch,abh,24h,c8h,44h,7eh,90h,f0h
+			db	59h,a2h,bah,36h,9ah,44h,ceh,2dh
+			db	89h,9ch,f6h,c0h,69h,64h,f3h,7ah
+			db	a5h,a6h,dbh,89h,cah,d8h,dbh,cdh
+			db	e7h,78h,f9h,e3h,5fh,b3h,53h,5ch
+			db	cdh,c3h,9ah,f5h,8bh,34h,16h,1dh
+			db	5dh,73h,32h,a4h,20h,12h,84h,c8h
+			db	3eh,cfh,29h,fdh,eah,22h,93h,d0h
+			db	41h,67h,b4h,c9h,50h,d7h,51h,64h
+			db	6dh,14h,afh,8ah,38h,5bh,2fh,edh
+			db	64h,19h,4fh,a2h,b3h,6ah,bch,51h
+			db	56h,a9h,82h,2fh,f6h,01h,67h,80h
+			db	e0h,0eh,fah,6ch,1ch,4dh,32h,ffh
+			db	eah,aah,6bh,dfh,20h,b4h,efh,81h
+			db	afh,5bh,ach,cdh,0ah,62h,89h,2dh
+			db	ddh,2bh,8fh,aeh,76h,99h,76h,43h
+			db	4dh,e0h,e2h,b7h,0eh,39h,2ah,5ah
+			db	1ah,53h,c7h,02h,adh,9ch,65h,deh
+			db	dbh,7fh,58h,aeh,8ch,3bh,c7h,35h
+			db	40h,07h,b4h,fah,61h,b1h,feh,50h
+			db	2fh,ebh,58h,b2h,1ah,60h,f6h,60h
+			db	b3h,a0h,97h,c3h,edh,76h,91h,5bh
+			db	0dh,6eh,e6h,33h,79h,7bh,22h,d3h
+			db	0ah,d2h,8dh,9fh,cah,65h,8ah,a0h
+			db	1dh,96h,c1h,ech,afh,5fh,e1h,0fh
+			db	d1h,8ch,82h,66h,0dh,cdh,d4h,e2h
+			db	3fh,8fh,2dh,e8h,6bh,8bh,49h,93h
+			db	0ch,16h,ffh,44h,d9h,2ah,12h,f9h
+			db	70h,5bh,e5h,a1h,6dh,d7h,ach,f9h
+			db	36h,69h,07h,dbh,15h,0eh,fah,71h
+			db	82h,94h,d2h,86h,ffh,b5h,ech,68h
+			db	16h,7ch,57h,5fh,b6h,7ah,eeh,b9h
+			db	8ch,c5h,9bh,40h,97h,8bh,dch,06h
+			db	8bh,37h,b7h,8fh,12h,35h,61h,90h
+			db	4fh,d1h,80h,50h,cdh,1eh,78h,ach
+			db	bah,7dh,96h,89h,97h,96h,3bh,feh
+			db	b2h,f0h,c6h,84h,a3h,8eh,6fh,3ch
+			db	2ch,d4h,59h,6fh,fch,f2h,ech,87h
+			db	eah,86h,efh,f9h,7bh,49h,e7h,e9h
+			db	0fh,b6h,7fh,5dh,f7h,e9h,52h,79h
+			db	5fh,cch,0ah,b8h,e4h,79h,44h,85h
+			db	feh,8bh,05h,65h,49h,36h,ech,44h
+			db	2ch,d7h,d4h,c4h,96h,22h,cdh,27h
+			db	31h,49h,d6h,81h,16h,8ch,dbh,1bh
+			db	feh,5bh,7ch,95h,77h,1eh,d7h,46h
+			db	c8h,75h,2bh,ach,8dh,12h,01h,01h
+			db	99h,25h,89h,53h,1bh,28h,69h,ddh
+			db	89h,24h,74h,5bh,bdh,afh,5ch,1eh
+			db	81h,2fh,cah,b8h,abh,4ch,0eh,bch
+			db	82h,2ch,99h,e2h,9eh,91h,8eh,4bh
+			db	7ah,33h,dch,03h,3ah,a4h,e0h,1dh
+			db	36h,18h,b3h,2bh,21h,dah,2bh,06h
+			db	2bh,85h,59h,95h,e0h,c0h,46h,f3h
+			db	73h,99h,fdh,3fh,d1h,b5h,58h,d4h
+			db	b4h,b6h,4fh,5dh,2fh,09h,6dh,6ah
+			db	23h,58h,86h,24h,85h,deh,c0h,5eh
+			db	5ch,d0h,4bh,abh,70h,eeh,91h,7ch
+			db	2bh,bch,9bh,44h,0fh,f1h,cah,afh
+			db	c8h,e1h,fch,73h,81h,21h,ceh,bdh
+			db	3bh,21h,32h,6dh,e3h,5dh,71h,04h
+			db	25h,4dh,97h,e0h,ach,7dh,4ch,5ah
+			db	21h,1bh,0eh,56h,8ah,37h,65h,72h
+			db	1bh,35h,33h,a3h,38h,f6h,beh,7eh
+			db	8eh,8dh,08h,55h,dfh,a2h,43h,e6h
+			db	84h,0fh,7ah,59h,bah,f0h,e7h,88h
+			db	b1h,e4h,f9h,cah,08h,05h,4ch,97h
+			db	83h,61h,7ah,b1h,c7h,14h,16h,e7h
+			db	28h,afh,13h,7ch,84h,f5h,64h,b8h
+			db	5dh,24h,73h,c0h,e1h,d6h,22h,9dh
+			db	36h,27h,c3h,65h,20h,20h,28h,44h
+			db	66h,4ch,cdh,e1h,34h,6bh,24h,a6h
+			db	0ah,e4h,07h,e6h,0ch,52h,3eh,39h
+			db	c4h,adh,52h,24h,48h,4fh,f6h,dah
+			db	d1h,d5h,c9h,2dh,3eh,36h,b3h,feh
+			db	f2h,24h,5dh,2ch,f2h,20h,c0h,5bh
+			db	1eh,31h,74h,9bh,bch,6ch,d7h,a6h
+			db	a0h,69h,a9h,53h,c5h,0ah,c5h,47h
+			db	7ch,16h,4bh,50h,c5h,e5h,70h,adh
+			db	1eh,80h,b5h,a7h,10h,1eh,c5h,2ch
+			db	e2h,4ch,30h,9bh,cfh,8eh,a0h,5eh
+			db	07h,23h,cah,40h,c7h,75h,cah,b9h
+			db	dah,17h,0dh,7eh,c3h,f3h,dbh,60h
+			db	8ah,40h,c1h,44h,7fh,30h,bah,6dh
+			db	3bh,65h,a1h,b8h,efh,beh,e6h,eah
+			db	44h,22h,4ch,61h,2bh,f9h,83h,97h
+			db	b3h,81h,91h,6ch,3fh,59h,e3h,4ch
+			db	bch,b2h,36h,a9h,59h,02h,50h,89h
+			db	fah,f2h,80h,80h,a8h,39h,efh,0fh
+			db	50h,8eh,a3h,4fh,42h,45h,31h,ech
+			db	ceh,c2h,8ch,83h,fbh,49h,adh,33h
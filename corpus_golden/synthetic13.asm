@@ -0,0 +1,18562 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	1fh,7ah,dch,e1h,6dh,06h,77h,38h
+			db	72h,55h,70h,cch
+
+start:						; execution starting point
+			ld	bc,f2c7h
+			call	c,Lf804
+			xor	a
+			cp	b
+			xor	l
+			ld	a,(hl)
+			ld	c,c
+			and	d
+			inc	h
+			scf
+			sbc	a,b
+			ld	l,l
+			ld	e,d
+			ld	(9ca8h),a
+			ld	b,d
+			call	m,Laa7c
+			pop	bc
+			ld	a,b
+			or	a
+			sub	(hl)
+			ld	b,45h
+			ld	bc,9ae5h
+			ret	pe
+			adc	a,l
+			ret	c
+			ld	d,a
+			dec	e
+			adc	a,d
+			ld	l,h
+			jp	z,L5494
+			halt
+			and	(hl)
+			adc	a,h
+			rla
+			push	af
+			ld	a,(2e54h)
+			rst	20h
+			ld	e,h
+			ld	(hl),l
+			sbc	a,e
+			ld	a,(15fbh)
+			or	d
+			dec	sp
+			ld	a,c
+			adc	a,e
+			or	(hl)
+			jr	nz,L409c
+			ld	a,b
+			sub	d
+			add	a,f7h
+			rrca
+			sbc	a,e
+			ld	a,(de)
+			rst	08h
+			jp	pe,L4946
+			out	(16h),a
+			adc	a,c
+			sbc	a,c
+			dec	bc
+			xor	l
+			exx
+			dec	sp
+			ld	e,b
+			add	hl,sp
+			ld	hl,9147h
+			xor	e
+			adc	a,b
+			jp	(hl)
+			db	6ah,b7h,c5h,56h,52h,fbh,c8h,b4h
+			db	81h,26h,cah,93h,c7h,1ah,72h,0fh
+			db	36h,aah,0fh,1fh,b9h,56h,c1h,7bh
+			db	8ah,14h,44h,44h,bfh,d5h,36h,3bh
+			db	5eh,0eh,f1h,ffh,8dh,84h,e5h,1ch
+			db	6ch,bdh,b6h,65h,e6h,cah,c2h,8dh
+			cp	b
+			sub	5ch
+			ld	a,(bc)
+			ld	b,c
+			ld	c,l
+			ld	hl,c871h
+			jp	pe,Le1b7
+			dec	bc
+			xor	l
+			ld	c,c
+			ld	d,b
+			ret	z
+			xor	(hl)
+			ld	l,b
+			or	e
+			adc	a,b
+			inc	c
+			inc	hl
+			xor	(hl)
+			ld	d,c
+			ld	sp,7a23h
+			ld	l,l
+			dec	hl
+			sbc	a,l
+			daa
+			ld	h,a
+			ld	l,19h
+			cp	c
+			ld	(hl),h
+			jp	po,Le1d8
+			call	m,Laaef
+			ld	a,(bc)
+			ret	p
+			push	af
+			add	a,e
+			ld	d,d
+			ld	b,(hl)
+			xor	(hl)
+			ld	e,h
+			or	h
+			sub	l
+			ld	l,h
+			ld	b,(hl)
+			ld	c,c
+			add	a,16h
+			inc	de
+			or	e
+			ld	c,e
+			ld	(hl),c
+			ld	d,l
+			inc	a
+			inc	sp
+			and	l
+			adc	a,d
+			ld	(de),a
+			ld	c,d
+			sbc	a,l
+			ld	e,(hl)
+			sbc	hl,hl
+			exx
+			halt
+			and	d
+			ld	h,31h
+			ld	b,d
+			adc	a,e
+			pop	hl
+			ld	l,e
+			add	a,a
+			ld	a,(bc)
+			dec	h
+			sbc	a,l
+			and	h
+			ld	l,e
+			ld	l,e
+			ld	c,b
+			cp	a
+			ld	d,a
+			jp	pe,L0739
+			ld	c,(hl)
+			jp	nc,Lb6b9
+			or	d
+			ld	c,e0h
+			rst	38h
+			ld	b,c
+			rst	08h
+			or	c
+			ld	e,d
+			or	b
+			ld	l,d
+			ld	e,l
+			add	hl,de
+			dec	(hl)
+			xor	d
+			and	e
+			push	de
+			jp	po,Ledb5
+			cp	b
+			inc	bc
+			adc	a,b
+			ld	d,d
+			ld	d,a
+			out	(9eh),a
+			inc	l
+			adc	a,h
+			ld	e,(hl)
+			ld	e,h
+			adc	a,e
+			ld	b,h
+			call	p,L2cb0
+			ld	h,h
+			add	a,h
+			or	(hl)
+			ld	(hl),a
+			ld	l,c
+			add	a,d
+			sbc	a,d
+			add	hl,hl
+			dec	d
+			ld	a,(bc)
+			push	bc
+			xor	b
+			inc	e
+			sbc	a,e
+			add	a,c
+			pop	hl
+			ld	(hl),d
+			ld	c,c
+			add	hl,de
+			dec	b
+			ld	c,c
+			rst	10h
+			ld	c,d
+			jr	nz,L40e6
+			sub	04h
+			and	(hl)
+			and	c
+			ld	b,d
+			rlca
+			inc	sp
+			rst	10h
+			inc	c
+			ex	(sp),hl
+			add	a,d
+			pop	af
+			add	a,l
+			or	e
+			ld	(bc),a
+			cp	c
+			call	nc,Le6cf
+			ld	a,c
+			add	a,a
+			sbc	a,b
+			jr	c,L40f4
+			ret	nz
+			ld	(6002h),a
+			inc	e
+			jp	nc,L40e5
+			adc	a,l
+			rst	28h
+			inc	l
+			ld	c,e
+			dec	bc
+			sbc	a,ixh *
+			call	c,L1711
+			ld	e,e
+			in	a,(2ch)
+			rst	18h
+			ld	a,h
+			ld	h,a
+			rst	08h
+			adc	a,d
+			cp	c
+			inc	d
+			dec	(hl)
+			ld	sp,773bh
+			adc	a,l
+			inc	c
+			cp	h
+			call	z,L5545
+			rrca
+			call	nz,L04a7
+			jp	(hl)
+			db	80h,05h,fbh,11h,68h,3ah,45h,bfh
+			db	9bh,5eh,90h,d9h,3ch,a1h,59h,69h
+			db	9dh,94h,28h,59h,52h,4ch,45h,99h
+			ld	(a3d5h),hl
+			dec	hl
+			ld	(hl),h
+			ld	c,43h
+			ei
+			and	8eh
+			or	a
+			di
+			ld	l,2bh
+			nop (2x) *
+			call	m,L9ed5
+			sub	l
+			scf
+			bit	0,e
+			rst	08h
+			ld	(hl),b8h
+			dec	d
+			nop
+			inc	c
+			halt
+			ld	h,h
+			scf
+			and	b
+			ld	d,iyl *
+			call	c,L9fab
+			ld	(hl),l
+			daa
+			ld	sp,61afh
+			sbc	a,8ch
+			ld	e,d
+			jp	po,L824d
+			ld	(hl),b
+			xor	75h
+			inc	h
+			ld	(bc),a
+			ld	d,92h
+			and	c
+			ld	a,03h
+			add	hl,sp
+			inc	(hl)
+			or	b
+			sub	h
+			nop (2x) *
+			ld	a,b
+			pop	af
+			call	nc,L1d98
+			dec	hl
+			ld	l,a
+			ld	c,h
+			ei
+			dec	h
+			jp	nc,L9e0a
+			pop	bc
+			ld	h,e
+			or	a
+			ld	b,a
+			rst	18h
+			and	1fh
+			ld	c,e
+			rra
+			nop (2x) *
+			dec	sp
+			ld	b,d
+			jp	(hl)
+			db	17h,e9h,2fh,36h,16h,44h,74h,83h
+			db	0bh,3fh,1fh,62h,ebh,e9h,16h,adh
+			db	64h,08h,18h,d6h,d5h,e7h,3dh,edh
+			db	b2h,0bh,9ch,e7h,0fh,09h,ech,42h
+			db	98h,c6h,63h,e1h,a3h,9ch,dbh,f4h
+			db	bfh,d4h,4bh,afh,09h,90h,8fh,56h
+			db	60h,58h,38h,73h,87h,23h,efh,34h
+			db	c4h,b6h,1dh,07h,2ch,6eh,71h,c6h
+			db	8ah,2fh,3eh,c2h,08h,86h,feh,50h
+			db	9eh,c0h,f6h,31h,3ah,dbh,d2h,f9h
+			db	57h,2dh,46h,f4h,75h,3ch
+			adc	a,21h
+			ld	h,(hl)
+			sub	h
+			ld	d,c
+			adc	a,c
+			inc	b
+			ld	b,d7h
+			ld	a,(hl)
+			dec	hl
+			ld	d,e
+			ld	hl,fe6ch
+			add	a,l
+			ld	b,b
+			sbc	a,l
+			ld	h,l
+			ld	h,c
+			ld	a,bfh
+			rst	28h
+			ex	(sp),hl
+			or	e
+			nop (2x) *
+			or	e
+			rla
+			rst	10h
+			adc	a,b
+			sbc	a,a
+			cp	d
+			adc	a,(hl)
+			inc	hl
+			dec	(hl)
+			ret	po
+			inc	l
+			scf
+			inc	hl
+			jp	m,L8cc3
+			add	a,d
+			rst	20h
+			sbc	a,h
+			ld	h,d
+			ld	h,69h
+			ld	b,2ch
+			ld	sp,59a9h
+			push	bc
+			jp	nz,L81c5
+			inc	e
+			dec	l
+			cpl
+			and	d7h
+			ret	nz
+			ret	nz
+			ld	sp,hl
+			xor	b
+			ld	c,b
+			inc	bc
+			ld	hl,7580h
+			add	a,h
+			ret	m
+			inc	h
+			dec	(hl)
+			jp	(hl)
+			db	c9h,e1h,54h,ffh
+			jp	po,Lde7e
+			inc	sp
+			sbc	a,e
+			ld	c,c
+			ld	l,b
+			ld	b,(hl)
+			ld	d,c
+			jr	c,L42d2
+			dec	(hl)
+			rst	10h
+			ld	d,(hl)
+			ld	sp,1727h
+			or	d
+			ld	(20dbh),hl
+			ld	c,a
+			adc	a,h
+			inc	sp
+			call	nz,Lcd40
+			ld	h,b
+			ld	a,e
+			ld	b,a
+			sub	b
+			inc	c
+			ccf
+			ld	l,c
+			dec	bc
+			push	hl
+			sub	c
+			dec	b
+			halt
+			ei
+			ld	(bc),a
+			cpl
+			ld	e,c1h
+			ld	l,h
+			rst	20h
+			ret	m
+			cpl
+			di
+			ld	hl,50f3h
+			ld	d,c
+			in	a,(f3h)
+			ld	e,e
+			ld	d,l
+			ret
+			db	3fh
+			ld	a,b
+			jp	p,La2ce
+			ld	h,3dh
+			ret	po
+			cpl
+			cp	a
+			call	Ldd98
+			ld	de,91c8h
+			ld	l,c
+			ld	d,h
+			jr	z,L4266
+			jr	L4318
+			db	90h,dch,46h,93h,0dh,74h,fah,fdh
+			db	23h,50h,feh,94h,50h,40h,d7h,e7h
+			db	f5h,4ah,b7h,f0h,39h,2dh,eah,35h
+			db	f2h,c7h,41h,71h,0fh,93h,e3h,37h
+			db	d8h,d6h,1ah,d0h,d7h,3ah,9ah,02h
+			db	86h,4fh,f5h,28h,f6h,06h,83h,b4h
+			db	a7h
+			sub	l
+			pop	hl
+			cp	a
+			add	a,c
+			ld	e,21h
+			sub	h
+			ld	a,d
+			sub	eah
+			sub	h
+			ld	(de),a
+			push	hl
+			or	87h
+			jp	m,Ld1d0
+			dec	hl
+			inc	d
+			djnz	L4326
+			ret	p
+			or	(hl)
+			jp	Ld029
+			db	cch,35h,09h,cch,a9h,d6h,0bh,09h
+			db	57h,3dh,1ah,3bh,6eh,6bh,e3h,18h
+			db	54h,2bh,86h,37h,91h,53h,84h,0eh
+			db	a3h,17h,bch,73h,c3h,49h,3eh,05h
+			db	0ah,bfh,d0h,1ch,30h,9dh,4ch,87h
+			db	09h,63h,98h,0bh,dbh,23h,b2h,16h
+			db	14h,a6h,f5h,80h,c4h,0eh,a1h,3dh
+			db	52h,7ch,67h,77h,c5h,d4h,96h,efh
+			db	eah,fah,2ch,f9h,f1h,38h,6dh,d4h
+			db	78h,62h,77h,76h,0bh,f8h,89h,b1h
+			db	7dh,0ch,e7h,90h,e6h,aah,52h,dah
+			db	82h,c9h,4ah,4fh,34h,c5h,87h,03h
+			db	44h,67h,bfh,afh,f6h,68h,cfh,c1h
+			db	56h,86h,95h,5ah,32h,52h
+			sbc	a,b
+			nop (2x) *
+			ld	d,d
+			jr	nz,L4332
+			dec	sp
+			and	l
+			or	l
+			sbc	a,b
+			jr	nz,L43bb
+			nop (2x) *
+			ld	a,d
+			ei
+			rlca
+			ld	l,h
+			sbc	a,c
+			adc	a,c
+			ld	h,0dh
+			ld	b,b
+			ld	(hl),e
+			ld	a,e
+			ld	(1e42h),hl
+			call	c,La9f7
+			ld	hl,e543h
+			inc	c
+			jp	nc,L1c79
+			dec	e
+			ret	po
+			inc	h
+			add	a,83h
+			sbc	a,14h
+			dec	bc
+			inc	hl
+			or	(hl)
+			inc	sp
+			ld	d,a
+			xor	l
+			ld	l,b
+			call	nc,L3a4f
+			adc	a,2dh
+			add	hl,bc
+			ld	l,(hl)
+			ld	(hl),h
+			adc	a,a
+			push	bc
+			xor	e
+			ld	c,(hl)
+			or	h
+			rlca
+			adc	a,c
+			or	e
+			ld	d,e
+			and	(hl)
+			and	a
+			djnz	L43f0
+			ld	a,(hl)
+			ld	h,l
+			ld	a,b
+			cp	c
+			ld	e,(hl)
+			sub	c
+			ld	h,l
+			ld	b,d
+			ld	sp,1051h
+			or	h
+			adc	a,c
+			ld	h,36h
+			ld	a,eah
+			and	a
+			ld	e,c
+			sub	c
+			halt
+			cp	e
+			rst	00h
+			inc	(hl)
+			ld	b,95h
+			ld	c,l
+			inc	c
+			ld	b,a
+			jr	nc,L43a1
+			inc	d
+			ld	(hl),59h
+			ld	hl,a48dh
+			inc	c
+			ld	d,h
+			ld	a,h
+			ld	c,3ch
+			in	a,(dfh)
+			sub	(hl)
+			ld	l,l
+			ld	d,b
+			sub	1dh
+			sbc	a,e
+			ld	l,(hl)
+			ld	h,b
+			dec	bc
+			or	c
+			jp	pe,L2b3b
+			ret	p
+			or	a
+			and	(hl)
+			or	e
+			sub	d
+			ld	b,a
+			halt
+			ld	a,a
+			nop (2x) *
+			adc	a,f4h
+			jp	m,Lbe34
+			ret	m
+			pop	hl
+			xor	l
+			call	m,L8f4d
+			ld	d,c
+			and	e
+			ld	c,c
+			ld	a,h
+			call	nc,L6da6
+			sub	e
+			inc	e
+			ld	c,d
+			djnz	L4419
+			ld	d,(hl)
+			ret	nc
+			ret	m
+			ld	a,h
+			call	nc,Lf5f5
+			jp	p,L994a
+			ld	c,(hl)
+			ld	(hl),a
+			jr	nz,L4426
+			ld	l,d
+			ret	po
+			ld	bc,96c4h
+			and	e
+			ld	e,d
+			call	po,Lce1c
+			jp	c,L9ddd
+			jp	pe,L3730
+			xor	b
+			call	c,L11ee
+			dec	(hl)
+			ld	(hl),b
+			dec	(hl)
+			ld	hl,(2043h)
+			sbc	a,h
+			ex	af,af'
+			add	hl,hl
+			sbc	a,67h
+			inc	h
+			call	p,L66a5
+			ld	(hl),d
+			ld	l,e
+			cp	(hl)
+			inc	de
+			or	e
+			inc	bc
+			ld	d,a
+			ex	de,hl
+			sbc	a,d
+			ld	(d00fh),a
+			sub	(ix + 1eh)
+			ld	(b48eh),a
+			adc	a,(hl)
+			inc	b
+			ret	nc
+			ret	nz
+			jr	nz,L4482
+			ld	a,(hl)
+			ld	c,b7h
+			ld	a,l
+			ld	c,h
+			xor	(hl)
+			dec	h
+			ld	(hl),c
+			add	a,afh
+			ld	(hl),c
+			ld	c,d
+			ld	b,h
+			set	4,d
+			dec	c
+			ld	a,h
+			xor	e
+			ld	(hl),h
+			dec	b
+			ret	c
+			ld	c,b
+			dec	bc
+			ret	c
+			inc	(hl)
+			out	(12h),a
+			ld	d,a
+			add	a,b
+			xor	a
+			jr	c,L447b
+			xor	(hl)
+			ld	l,(hl)
+			jr	c,L4500
+			inc	hl
+			ld	d,a
+			ret	nz
+			sub	d
+			jp	nc,L2add
+			cp	a
+			rst	08h
+			inc	sp
+			jp	p,L6dac
+			sub	b
+			pop	hl
+			ld	a,c
+			sub	l
+			adc	a,b
+			ld	hl,(176eh)
+			ld	d,(hl)
+			ld	h,(hl)
+			or	c
+			rst	08h
+			jp	p,Le180
+			rst	18h
+			ld	h,61h
+			ld	(hl),h
+			adc	a,a
+			adc	a,a
+			sbc	a,b8h
+			ld	c,b
+			ld	e,d
+			ret	c
+			and	dbh
+			ld	e,l
+			add	a,b
+			ld	(hl),b
+			and	a
+			cp	(hl)
+			dec	d
+			sub	d
+			cp	b
+			jp	(hl)
+			db	82h,c0h,e6h,99h,5ch,04h,65h
+			cp	a
+			inc	b
+			rst	38h
+			sub	c
+			out	(3dh),a
+			nop
+			ld	h,(hl)
+			inc	(hl)
+			or	b
+			rst	20h
+			call	po,L49e3
+			ld	h,e
+			xor	h
+			ld	b,h
+			nop
+			ret	nz
+			cp	a
+			call	nz,L4692
+			add	a,b
+			ld	d,b
+			cp	c
+			rst	30h
+			dec	l
+			cpl
+			jp	nc,Lc089
+			ld	b,e
+			ld	e,a
+			ret	z
+			ld	(hl),c
+			cp	b9h
+			or	e
+			ld	l,h
+			ret	nz
+			jr	L4533
+			db	94h,f4h,c7h,46h,12h,eah,35h,69h
+			db	9ch,88h,abh,51h,bdh,14h,4fh,d1h
+			and	(hl)
+			and	d
+			ret	nz
+			ld	e,b
+			sbc	a,b
+			dec	bc
+			sub	a
+			ret	nc
+			adc	a,l
+			ld	a,b
+			ld	d,d
+			jr	L4502
+			db	b5h,30h,eeh
+			inc	a
+			scf
+			cp	b
+			ld	d,(hl)
+			ld	e,52h
+			dec	(hl)
+			cp	h
+			xor	d
+			scf
+			call	c,L2d90
+			ld	a,l
+			jp	pe,L4426
+			ld	e,l
+			dec	sp
+			and	(hl)
+			ld	a,b
+			inc	l
+			inc	bc
+			xor	(hl)
+			ld	a,a
+			push	de
+			or	c
+			ld	(ffd2h),a
+			ld	c,a
+			dec	l
+			sub	d
+			or	l
+			ld	b,c
+			ld	a,a
+			rst	00h
+			add	a,e
+			ld	c,(hl)
+			or	h
+			inc	e
+			ld	e,l
+			rla
+			sub	0fh
+			out	(15h),a
+			and	c
+			ld	b,e
+			adc	a,a
+			cpl
+			rst	20h
+			ld	hl,75b7h
+			rst	38h
+			add	a,d
+			or	e
+			scf
+			inc	sp
+			dec	e
+			and	(hl)
+			out	(2eh),a
+			and	c
+			ld	b,79h
+			ld	de,e846h
+			ld	l,l
+			cp	a
+			ld	h,c
+			ld	c,h
+			add	a,l
+			and	c
+			dec	l
+			and	(iy + e4h)
+			and	48h
+			ld	l,b
+			ld	l,h
+			xor	(hl)
+			cp	h
+			sub	84h
+			cp	d
+			ret	p
+			cp	c
+			ld	l,b
+			ld	e,07h
+			xor	dbh
+			ld	d,0dh
+			call	c,L9453
+			ccf
+			ret	c
+			ld	b,c
+			xor	c
+			ld	e,l
+			and	d
+			ld	l,l
+			ld	c,e
+			ex	(sp),hl
+			pop	af
+			ld	h,b
+			dec	hl
+			adc	a,d
+			rla
+			ld	d,c
+			xor	l
+			rlca
+			and	(hl)
+			rra
+			adc	a,h
+			ld	d,h
+			ret	c
+			ld	d,h
+			cp	l
+			ld	d,(hl)
+			and	e
+			adc	a,c
+			or	e
+			inc	hl
+			sbc	a,b
+			ld	h,d
+			ld	h,b
+			exx
+			call	nc,Lbad9
+			add	a,a1h
+			inc	de
+			sbc	a,b
+			daa
+			ld	d,d
+			ld	e,a
+			ret	pe
+			or	c
+			add	a,l
+			daa
+			ld	l,l
+			sub	c
+			ld	hl,(2ca5h)
+			ret	nz
+			nop (2x) *
+			ld	c,c
+			cp	07h
+			ld	b,a
+			and	b
+			ld	e,c6h
+			ld	de,807fh
+			out	(6ah),a
+			ld	d,(hl)
+			ret	m
+			djnz	L4648
+			ld	c,h
+			or	d
+			ld	d,h
+			sub	e
+			ld	(3607h),a
+			add	a,c
+			ld	a,4ch
+			add	hl,bc
+			ld	h,1ch
+			cp	e
+			adc	a,b
+			ld	e,4eh
+			sub	(hl)
+			pop	hl
+			ld	a,(bc)
+			call	nz,L88fb
+			cp	h
+			jr	z,L4652
+			jr	z,L4637
+			ld	c,d
+			rra
+			add	a,23h
+			and	c
+			or	(hl)
+			ld	(hl),feh
+			ld	hl,(f4d9h)
+			ld	a,d
+			ld	l,(hl)
+			adc	a,b
+			ld	h,(hl)
+			dec	c
+			ld	e,e
+			di
+			inc	b
+			ld	a,l
+			add	a,l
+			jp	po,L2140
+			dec	h
+			ld	a,l
+			sub	a
+			ret	nc
+			call	z,Lc890
+			ld	a,(5031h)
+			ld	h,e
+			ld	hl,129bh
+			sub	a
+			inc	h
+			dec	hl
+			rla
+			call	z,Ld288
+			sbc	a,d
+			ex	af,af'
+			add	a,c6h
+			ld	(hl),b
+			dec	(hl)
+			ld	d,h
+			cp	l
+			call	c,Lc129
+			jp	po,La806
+			ld	h,h
+			jp	Lb2a0
+			db	3bh,a1h,cah,6bh,5ch,65h,cah,e1h
+			db	f7h,77h,5fh,4ch,a3h,6dh
+			ld	hl,(9927h)
+			sbc	a,e7h
+			sbc	a,(ix + 2eh)
+			ld	c,b
+			jp	c,L518b
+			ld	hl,(3472h)
+			ld	d,(hl)
+			or	(hl)
+			ld	d,(hl)
+			ld	a,(de)
+			adc	a,c
+			cp	b
+			add	a,b
+			ld	b,e
+			ld	l,d
+			sub	b
+			ld	(hl),e
+			ld	(hl),b
+			ld	(hl),d
+			dec	e
+			set	0,a
+			ld	d,l
+			cp	c
+			ld	l,h
+			inc	hl
+			halt
+			ld	(hl),e
+			rst	18h
+			ld	l,a
+			bit	3,l
+			djnz	L46b4
+			ld	c,a
+			call	pe,L5d27
+			pop	de
+			inc	hl
+			ld	l,f3h
+			nop (2x) *
+			push	bc
+			ld	a,d
+			inc	l
+			ld	e,l
+			inc	bc
+			ex	de,hl
+			ld	b,e
+			and	e
+			ld	(hl),a2h
+			sbc	a,e
+			or	a
+			sbc	a,c
+			jr	nc,L461f
+			im	2 *
+			sbc	a,c
+			halt
+			ld	b,a
+			out	(90h),a
+			sub	a
+			add	a,(hl)
+			sbc	a,a
+			ld	a,(hl)
+			sub	c
+			dec	hl
+			ld	e,b
+			ld	c,e
+			or	b
+			ld	l,c
+			ld	hl,(ab9eh)
+			daa
+			ld	b,d
+			or	e
+			ld	l,b
+			adc	a,(hl)
+			xor	e
+			jp	z,Lda9a
+			ld	e,d
+			ld	a,l
+			dec	l
+			ld	a,c
+			jp	(hl)
+			db	74h,1eh,0ah,66h,79h,12h,50h
+			ld	a,(hl)
+			or	b
+			dec	l
+			jp	nz,La6e8
+			rrca
+			call	nz,Lc5b0
+			sub	h
+			xor	dbh
+			xor	l
+			dec	hl
+			add	a,a
+			ld	h,e
+			inc	de
+			ld	b,c
+			ccf
+			ld	(hl),e
+			ld	(hl),d
+			dec	e
+			ld	h,b
+			ld	l,(hl)
+			cpl
+			jr	c,L471d
+			call	pe,L6587
+			dec	(hl)
+			push	de
+			pop	bc
+			dec	(hl)
+			call	nc,L1b7f
+			halt
+			sub	l
+			ld	b,h
+			xor	c4h
+			ld	b,a
+			ld	(hl),h
+			sbc	a,b
+			add	a,b
+			and	l
+			cp	d
+			rlca
+			cp	(hl)
+			rra
+			add	hl,bc
+			or	l
+			cp	b
+			adc	a,23h
+			xor	c
+			call	pe,Lc2a1
+			dec	(hl)
+			djnz	L4762
+			inc	a
+			sub	(hl)
+			and	e
+			ld	(hl),a
+			ld	c,h
+			dec	l
+			xor	l
+			sub	l
+			or	e
+			ld	e,b
+			ld	l,b
+			ld	(hl),51h
+			ld	d,b
+			ld	c,l
+			ret	po
+			call	pe,Le49c
+			or	(hl)
+			jp	z,L4823
+			and	a
+			xor	(hl)
+			add	hl,bc
+			push	hl
+			adc	a,e
+			ret	nz
+			add	hl,bc
+			call	m,L6d6d
+			ld	d,(hl)
+			sub	c
+			call	pe,L59cb
+			ret	p
+			ex	(sp),hl
+			adc	a,e
+			ld	a,b
+			ld	(hl),e
+			jp	z,L53fe
+			inc	iyl *
+			and	d
+			inc	de
+			add	hl,bc
+			cp	(hl)
+			adc	a,c
+			nop (2x) *
+			add	a,ixh *
+			inc	b
+			adc	a,h
+			ret	nz
+			ld	h,c
+			jp	nz,L9ff8
+			rst	10h
+			pop	hl
+			sbc	a,d
+			ld	e,b
+			ccf
+			dec	de
+			ld	(hl),41h
+			ret	nz
+			call	nc,L0c52
+			ld	e,d
+			ex	af,af'
+			xor	c
+			add	a,(hl)
+			call	nz,L12ea
+			rra
+			sub	(hl)
+			xor	e
+			call	p,L334a
+			ld	h,a
+			inc	c
+			dec	(hl)
+			jp	p,L8fbb
+			ld	a,a
+			xor	h
+			inc	a
+			xor	b
+			jp	po,Lff66
+			dec	bc
+			adc	a,e
+			xor	c
+			and	h
+			ld	h,(hl)
+			sub	e8h
+			ld	bc,46eah
+			rst	08h
+			ld	a,(hl)
+			xor	a
+			ld	d,c
+			ret	nz
+			ld	e,b
+			sbc	a,d
+			sbc	a,(hl)
+			ld	a,(hl)
+			and	c
+			ret	nz
+			ld	e,e
+			sbc	a,a
+			ld	c,h
+			or	d
+			and	h
+			ld	(hl),h
+			rst	28h
+			and	(hl)
+			cp	l
+			ccf
+			ld	(de),a
+			jp	nz,Lbc2d
+			and	(hl)
+			ld	e,e
+			cp	e
+			ld	l,l
+			ld	l,c
+			ld	h,h
+			adc	a,d
+			cp	b
+			ld	e,b
+			rst	08h
+			or	a
+			add	a,b
+			ret	nz
+			ld	(hl),b
+			xor	l
+			dec	e
+			ld	l,e
+			xor	l
+			adc	a,b
+			rst	10h
+			nop (2x) *
+			ld	a,a
+			inc	b
+			ld	(de),a
+			and	e
+			ret	m
+			jp	nz,L3a7f
+			and	(hl)
+			ret	m
+			rla
+			sub	82h
+			and	a
+			and	d8h
+			jp	m,L8fbb
+			sub	a
+			xor	h
+			ld	d,(hl)
+			cp	h
+			rst	18h
+			sub	4fh
+			adc	a,l
+			dec	b
+			ld	b,4fh
+			ld	a,(hl)
+			dec	de
+			sbc	a,e
+			jp	po,L8dac
+			call	z,L877a
+			set	3,c
+			ld	l,b
+			ei
+			ld	e,5dh
+			ld	b,b
+			cp	b
+			xor	h
+			ld	a,(e6cah)
+			ld	h,l
+			ld	h,c
+			ld	a,l
+			inc	l
+			ld	d,(hl)
+			and	l
+			push	hl
+			ret
+			db	6bh,3eh,8bh,8ch,ech,4bh,92h,2eh
+			db	4ch,24h,f5h,3eh,06h,d9h,2bh,65h
+			db	7fh,c3h,18h,f9h,c0h
+			ld	de,0bb6h
+			sub	h
+			sbc	a,e
+			scf
+			out	(a6h),a
+			xor	c
+			dec	l
+			ld	c,e
+			and	h
+			ld	h,e
+			or	c
+			dec	a
+			sbc	a,c
+			di
+			ld	hl,(379ch)
+			add	a,a
+			pop	de
+			ret	nc
+			adc	a,e
+			rrca
+			inc	h
+			inc	hl
+			ld	h,l
+			inc	de
+			ld	b,h
+			cp	d
+			dec	bc
+			ld	c,c
+			ld	(hl),a
+			xor	a
+			ld	c,h
+			add	hl,de
+			ld	a,(f5f3h)
+			and	93h
+			ld	d,f7h
+			add	a,(hl)
+			rst	20h
+			ld	a,e
+			sbc	a,85h
+			sub	e
+			rrca
+			jr	c,L47a2
+			ld	(hl),d
+			ld	(hl),l
+			ld	l,l
+			xor	l
+			jr	nz,L4865
+			dec	hl
+			xor	c
+			rst	18h
+			xor	(hl)
+			di
+			ld	b,l
+			add	a,h
+			or	a
+			xor	d
+			xor	e
+			add	hl,sp
+			cp	(hl)
+			ld	a,(hl)
+			ld	l,d
+			and	e
+			xor	d
+			adc	a,l
+			ld	e,a
+			cp	h
+			ld	sp,39ddh
+			add	a,c
+			ld	c,(hl)
+			exx
+			add	a,(hl)
+			add	hl,sp
+			ld	l,6eh
+			xor	a
+			call	nc,L9839
+			call	nc,L690f
+			ld	e,e
+			and	h
+			ld	l,e
+			inc	sp
+			ld	b,h
+			ld	d,31h
+			jp	po,L5b72
+			rst	08h
+			ld	c,c
+			ld	h,b
+			nop
+			ret	pe
+			pop	de
+			ld	c,b4h
+			jp	z,Lee1b
+			push	hl
+			bit	3,d
+			cp	(hl)
+			call	Lffa2
+			sub	(hl)
+			ld	a,e
+			push	bc
+			or	b
+			rst	18h
+			ld	l,b
+			sub	a
+			ld	d,e
+			add	hl,sp
+			ld	a,b
+			rlca
+			ld	c,h
+			ld	c,b
+			or	9ah
+			ld	a,a8h
+			ld	l,h
+			dec	sp
+			ld	(hl),a
+			inc	b
+			call	po,La5cd
+			halt
+			ld	a,(de)
+			dec	de
+			sbc	a,e
+			jp	p,L573a
+			cp	l
+			ld	h,e
+			ld	d,b
+			ld	h,b
+			cpl
+			sbc	a,(hl)
+			rst	00h
+			ld	a,h
+			ld	e,e
+			ret	pe
+			xor	l
+			ld	b,h
+			sub	a0h
+			ld	b,c
+			ld	c,b
+			jr	nz,L4883
+			cp	d
+			inc	(hl)
+			jp	pe,L8245
+			di
+			adc	a,e
+			or	h
+			ld	hl,(bd7eh)
+			ex	de,hl
+			ld	bc,dbfah
+			dec	b
+			ld	c,22h
+			ld	h,l
+			halt
+			ex	de,hl
+			nop (2x) *
+			ld	sp,a990h
+			dec	sp
+			ret	p
+			dec	(hl)
+			ei
+			inc	hl
+			ld	l,(hl)
+			or	d
+			ld	l,e
+			and	d
+			push	af
+			or	a
+			call	nz,L905c
+			rst	00h
+			ret	pe
+			call	nc,L224f
+			call	po,Lc05f
+			ex	(sp),hl
+			rst	00h
+			push	de
+			xor	h
+			ld	c,e
+			ret	c
+			and	b
+			cpd
+			adc	a,a9h
+			rst	00h
+			rst	18h
+			ld	d,l
+			ld	b,h
+			xor	h
+			call	z,Lf516
+			ld	b,h
+			jp	pe,Lc7cd
+			ret	po
+			jp	c,L3243
+			jp	po,L53ac
+			ld	a,(aa8fh)
+			ld	h,d
+			ld	e,afh
+			ld	a,c
+			rrca
+			jp	m,L6818
+			cp	(hl)
+			add	hl,hl
+			ld	l,e
+			ld	(hl),b
+			adc	a,b
+			inc	e
+			ret	c
+			adc	a,c
+			cp	d
+			ld	d,(hl)
+			jp	z,L5a8a
+			ld	(hl),l
+			jr	L48bb
+			db	0eh,5dh,26h,b8h,02h,cdh,d6h,55h
+			db	b9h,a5h,18h,c1h,02h,e4h,80h,d0h
+			db	34h,2dh,25h,77h,abh,02h,87h,02h
+			db	ach,c2h,8ch,c0h,1dh,5ah,b9h
+			rst	38h
+			sub	h
+			ret	nz
+			ld	e,e
+			dec	c
+			jp	p,La8a9
+			push	af
+			or	63h
+			adc	a,e
+			ld	c,(hl)
+			dec	(hl)
+			ld	b,d
+			ret	nc
+			ld	c,h
+			ei
+			ld	h,c
+			jr	nz,L48e1
+			rra
+			ld	(hl),c
+			inc	bc
+			jp	c,Lf8e1
+			scf
+			add	a,a
+			jp	Laa90
+			db	65h,eeh,60h,abh,e8h,0dh,ech,9dh
+			db	dfh,dch,06h,d6h,1dh,0fh,97h,a4h
+			db	cah
+			ld	d,(hl)
+			inc	c
+			ld	h,d
+			ld	c,(hl)
+			ex	de,hl
+			ld	l,6dh
+			ld	d,d0h
+			ld	e,e
+			call	m,L88c3
+			sub	c
+			cp	e
+			adc	a,(hl)
+			ld	(hl),h
+			ld	(de),a
+			xor	d
+			rst	18h
+			ld	(de),a
+			di
+			ld	b,l
+			ld	d,e
+			ld	(hl),d
+			adc	a,(hl)
+			call	po,L325a
+			sbc	a,h
+			sbc	a,b
+			ld	c,1dh
+			sbc	a,a
+			ld	(hl),e
+			ld	a,8dh
+			inc	a
+			jr	nz,L4915
+			rst	28h
+			rra
+			call	z,L0f99
+			ret	c
+			ld	c,18h
+			ld	c,c
+			ld	b,l
+			jr	nz,L4934
+			rst	18h
+			and	d
+			add	hl,sp
+			or	a
+			pop	af
+			ld	d,h
+			ld	(f0bfh),hl
+			ld	e,d
+			ex	af,af'
+			ld	h,c
+			sbc	a,d
+			ld	a,(de)
+			inc	b
+			dec	hl
+			sbc	a,d
+			cp	e
+			sub	h
+			jp	m,L80cf
+			rst	30h
+			or	c
+			ld	b,(hl)
+			jp	(hl)
+			cp	e
+			sbc	a,h
+			ld	sp,hl
+			ld	(4db4h),hl
+			scf
+			pop	hl
+			ld	(hl),c
+			ret	c
+			djnz	L4996
+			adc	a,h
+			ret	p
+			adc	a,(hl)
+			jr	nz,L49a6
+			sub	b
+			rla
+			add	a,l
+			sbc	a,l
+			ld	h,l
+			ld	c,b
+			ret	p
+			ret	po
+			ld	b,(hl)
+			rst	38h
+			ld	h,e
+			ld	(hl),b
+			add	a,e
+			jp	nz,Lcdf9
+			call	pe,L2ad2
+			scf
+			ld	l,l
+			rlca
+			dec	de
+			ld	l,h
+			out	(c8h),a
+			xor	h
+			add	hl,sp
+			and	l
+			inc	sp
+			ld	e,a
+			ld	(hl),c
+			ret	m
+			pop	bc
+			rst	18h
+			sub	d
+			add	a,a
+			pop	de
+			ld	b,b5h
+			ld	a,a
+			jp	p,L7878
+			sbc	a,(hl)
+			dec	hl
+			adc	a,a
+			ld	b,a
+			ld	h,b
+			ret	z
+			ld	a,e
+			ld	(hl),c
+			ld	(hl),39h
+			xor	a
+			pop	de
+			inc	l
+			ld	h,h
+			ld	e,17h
+			ld	c,(hl)
+			xor	a
+			pop	de
+			add	a,h
+			call	po,L758e
+			ld	c,dfh
+			sub	a
+			jp	pe,Lc011
+			ld	d,e
+			ld	a,(bc)
+			ld	h,d
+			cpl
+			ccf
+			dec	e
+			ret	pe
+			rst	38h
+			sub	c
+			ld	e,c
+			dec	a
+			jp	nz,Le67b
+			ld	d,e
+			sbc	a,4fh
+			nop
+			sbc	a,e
+			adc	a,f4h
+			sbc	a,l
+			ret	c
+			call	c,Lbb33
+			xor	d
+			sbc	a,3ch
+			or	(hl)
+			sbc	a,(hl)
+			ld	c,(hl)
+			djnz	L4994
+			jp	c,L2be2
+			daa
+			out	(36h),a
+			ld	sp,hl
+			cp	96h
+			ex	(sp),hl
+			or	d
+			inc	b
+			inc	b
+			out	(dah),a
+			jp	z,L8e11
+			rra
+			ld	e,c
+			ld	e,e
+			nop (2x) *
+			pop	hl
+			ret	po
+			cp	l
+			jp	m,L46f3
+			ld	h,c
+			call	p,Le311
+			xor	c
+			ld	e,c
+			ld	e,d
+			rst	00h
+			ret	po
+			cp	a
+			add	a,d
+			ret	c
+			ld	(hl),c
+			cpl
+			rst	38h
+			jp	nz,Lf8a2
+			xor	d
+			jr	nc,L4a02
+			dec	l
+			sbc	a,d
+			add	hl,sp
+			scf
+			adc	a,(hl)
+			and	a
+			jr	z,L4a01
+			ret	nz
+			ld	a,d
+			or	c
+			ret	c
+			inc	l
+			add	hl,sp
+			ld	a,bbh
+			push	bc
+			dec	a
+			and	c
+			ld	a,(34b5h)
+			pop	hl
+			ld	b,c
+			ret	p
+			jp	nz,L1d04
+			rst	28h
+			and	(hl)
+			cp	5eh
+			inc	h
+			ld	hl,e2cfh
+			ld	c,e
+			ld	b,a
+			ld	a,l
+			call	pe,Le4dd
+			ld	h,ach
+			pop	af
+			ld	b,dbh
+			xor	c
+			rst	28h
+			sub	(hl)
+			sbc	a,l
+			exx
+			ld	b,l
+			ld	b,(hl)
+			ex	af,af'
+			or	d
+			xor	a0h
+			jr	nz,L4af5
+			adc	a,70h
+			ld	b,a
+			ld	(hl),b2h
+			add	a,l
+			cp	h
+			ld	h,l
+			scf
+			or	a
+			call	nz,L7a98
+			ei
+			pop	af
+			inc	a
+			sbc	a,h
+			ld	a,c
+			ld	e,l
+			ret	pe
+			nop (2x) *
+			sub	0dh
+			adc	a,a
+			call	m,Lddc7
+			rlca
+			cp	b
+			ld	a,(de)
+			call	p,Ld6bb
+			ld	l,b
+			pop	de
+			adc	a,e4h
+			sbc	a,b
+			xor	h
+			rst	38h
+			ex	(sp),hl
+			cp	d
+			ld	a,b
+			sbc	a,(hl)
+			ret	p
+			inc	de
+			rra
+			push	af
+			inc	de
+			ld	b,a
+			jp	nz,Ldfd7
+			dec	de
+			ld	d,a
+			ld	c,17h
+			sub	f8h
+			rst	00h
+			ld	de,e86fh
+			call	m,L1d92
+			cp	(hl)
+			sbc	a,a
+			ret
+			db	1eh,82h,34h,77h,69h,dah,7eh,06h
+			db	2fh,83h,91h,f2h,d7h,d7h,10h,0ah
+			db	26h,46h,4eh,c5h,c4h,f7h,84h,e5h
+			and	a
+			call	p,L13bb
+			push	bc
+			ld	l,a
+			ld	b,a
+			sub	d
+			and	l
+			nop (2x) *
+			xor	d
+			djnz	L4b4d
+			adc	a,c
+			ld	a,e
+			ld	d,7dh
+			ld	(hl),d
+			ld	l,c
+			ld	l,(hl)
+			adc	a,13h
+			inc	hl
+			inc	h
+			nop (2x) *
+			or	c
+			and	a
+			call	nc,L2d58
+			add	hl,hl
+			ld	a,(de)
+			sbc	a,09h
+			sbc	a,89h
+			cp	h
+			ld	d,l
+			or	b
+			jr	L4b14
+			db	0eh,45h,f6h,26h,15h,f0h,82h,c5h
+			db	35h,4ch,2bh,2eh,34h,10h,80h
+			dec	sp
+			ld	(hl),d
+			jr	L4adc
+			db	3eh,30h,9dh,8fh,36h,4ch,90h,b8h
+			db	7ah,4eh,9bh,a6h,93h,84h,b1h,ddh
+			db	d8h,a2h,33h,d2h,b0h,b8h,93h,92h
+			db	f5h,d9h,9eh,02h,30h,2eh,b2h,d3h
+			db	c5h,c3h,a5h,a7h,a7h,34h,92h,30h
+			db	4eh,c4h,adh,29h,6bh,edh,cah,72h
+			db	1eh,17h,84h,0ah,fdh
+			inc	a
+			dec	d
+			daa
+			dec	hl
+			ld	a,a
+			cp	l
+			ld	b,c
+			sub	e
+			ld	d,l
+			dec	(hl)
+			ret	pe
+			rst	28h
+			jp	c,Lace6
+			sub	h
+			inc	d
+			ret	nc
+			ld	a,d
+			ld	h,h
+			rra
+			call	pe,L5a06
+			jp	nz,Ld3ec
+			cp	e
+			ld	e,c
+			ld	h,b
+			ld	a,(hl)
+			ret	po
+			inc	d
+			jr	nz,L4bc4
+			ld	(hl),d
+			inc	(hl)
+			or	l
+			pop	bc
+			ld	e,c
+			sub	(hl)
+			sub	e
+			ld	(bc),a
+			add	a,a
+			ld	(hl),d
+			ld	l,h
+			ld	b,e
+			ld	d,l
+			ld	d,h
+			dec	bc
+			ret	po
+			sub	b
+			ld	a,(de)
+			sbc	a,c
+			add	a,78h
+			dec	hl
+			ld	h,c
+			dec	c
+			adc	a,a
+			ld	c,(hl)
+			push	af
+			ld	e,e
+			nop (2x) *
+			cpl
+			rrca
+			rst	28h
+			ld	a,a
+			ld	d,a
+			ld	h,b
+			ld	c,b
+			inc	c
+			ld	(hl),l
+			pop	bc
+			ld	hl,7abdh
+			ld	(hl),e
+			jp	pe,L7b5e
+			xor	h
+			inc	d
+			cp	d
+			ld	e,f1h
+			inc	d
+			ld	(7462h),hl
+			ld	a,e
+			xor	d
+			ld	l,l
+			add	hl,bc
+			cp	(hl)
+			rrca
+			ld	hl,(799fh)
+			nop (2x) *
+			ld	c,c
+			ld	(hl),l
+			ld	d,c
+			ld	h,(hl)
+			ld	l,(hl)
+			call	nz,L606c
+			ld	b,h
+			sub	c
+			ld	d,b
+			ld	(hl),a
+			ld	(ebffh),a
+			ld	b,(hl)
+			sbc	a,b
+			cpl
+			ld	(bc),a
+			ld	l,a
+			ld	(ebbfh),a
+			dec	(hl)
+			dec	h
+			ld	c,(hl)
+			xor	a
+			add	a,d
+			sbc	a,feh
+			cp	f9h
+			inc	l
+			ld	c,h
+			ld	c,e
+			ld	(hl),c
+			ccf
+			ld	e,a
+			ld	c,e
+			scf
+			ld	a,(bc)
+			ld	b,e
+			pop	de
+			ld	b,l
+			ld	e,h
+			ld	e,h
+			dec	a
+			and	0dh
+			or	l
+			rst	18h
+			dec	h
+			dec	d
+			ld	e,66h
+			jr	c,L4c0d
+			ld	l,c
+			and	a
+			ret	c
+			ld	c,0dh
+			adc	a,c
+			in	a,(29h)
+			in	a,(f4h)
+			call	nz,Lc76d
+			inc	de
+			nop (2x) *
+			ld	b,b
+			add	hl,sp
+			adc	a,c7h
+			jp	nz,L90ec
+			ld	c,d
+			and	h
+			ld	a,(bc)
+			sbc	a,e
+			cp	d
+			ld	a,(hl)
+			ld	(bc),a
+			sbc	a,h
+			ld	d,a
+			ld	d,h
+			rst	28h
+			dec	h
+			dec	b
+			ld	a,d5h
+			and	b
+			jp	pe,L8f6c
+			pop	af
+			ld	a,(c7adh)
+			dec	(hl)
+			jp	c,Laec1
+			sbc	a,a
+			jp	nc,Lfb19
+			pop	bc
+			adc	a,(hl)
+			cp	l
+			inc	de
+			ld	e,71h
+			ld	h,d
+			dec	d
+			pop	hl
+			sbc	a,c
+			ld	b,a
+			push	af
+			rst	10h
+			sub	(hl)
+			rst	28h
+			ld	(hl),c
+			dec	a
+			ld	b,e
+			ld	e,c
+			ld	l,b
+			call	po,La73f
+			rla
+			ld	l,l
+			inc	c
+			push	de
+			dec	bc
+			ld	e,7ch
+			xor	h
+			ld	(hl),l
+			sub	h
+			ld	l,d
+			rla
+			rst	18h
+			cpl
+			ex	de,hl
+			pop	af
+			jp	m,L425f
+			add	a,c
+			adc	a,b
+			ld	b,d
+			ld	b,c
+			ld	c,e
+			ld	a,a
+			dec	(hl)
+			ld	a,(de)
+			dec	bc
+			ex	af,af'
+			ex	af,af'
+			add	a,d7h
+			halt
+			jp	nz,L9870
+			call	nz,L3c3e
+			ret	po
+			ret	pe
+			ld	h,c
+			adc	a,(hl)
+			sub	a
+			dec	bc
+			ld	de,3e38h
+			call	nc,La33b
+			add	a,l
+			ld	d,e
+			ld	b,l
+			ld	a,a
+			inc	l
+			cp	(hl)
+			inc	bc
+			ld	(hl),e5h
+			xor	(hl)
+			ld	c,a
+			ld	de,c091h
+			ld	l,h
+			jr	c,L4cd3
+			ld	a,l
+			add	a,a
+			di
+			xor	a
+			ld	a,d
+			ld	d,d
+			cp	e
+			ld	c,b
+			add	a,l
+			sbc	a,l
+			ld	h,d
+			ld	a,86h
+			cp	d
+			halt
+			rst	20h
+			cp	e
+			ei
+			ret	c
+			xor	a
+			ret
+			db	f7h,1bh,5ah,1dh,85h,e9h,eeh,58h
+			db	4dh,37h,51h,b0h,20h,69h,5ah,53h
+			db	58h,c3h,07h,fdh,adh,65h,8fh,27h
+			db	e4h,c5h,05h,9bh,5dh,60h,d2h,70h
+			db	b8h,f1h,10h,fch,9ah,6fh,04h
+			or	c
+			ret	pe
+			ld	hl,3b4bh
+			ld	e,d
+			add	hl,hl
+			xor	e
+			and	d
+			adc	a,b
+			ret	nz
+			adc	a,e
+			ld	c,b
+			and	b
+			call	pe,Ld13c
+			ld	e,h
+			adc	a,(hl)
+			ld	l,c
+			djnz	L4cf5
+			ld	(f18bh),a
+			ld	h,a
+			cp	(hl)
+			cp	b2h
+			adc	a,d
+			call	c,L55b4
+			cp	b
+			xor	b
+			ld	(de),a
+			ld	l,b7h
+			ld	d,b
+			ret	pe
+			adc	a,c
+			ld	hl,(b0efh)
+			inc	de
+			ld	h,h
+			or	h
+			jp	z,Le21f
+			or	l
+			ret	nc
+			ld	l,b
+			ex	de,hl
+			sbc	a,d
+			sbc	a,d
+			ld	c,(hl)
+			cp	d
+			xor	d
+			rst	38h
+			cp	c
+			pop	de
+			ld	e,a
+			xor	b
+			ld	a,d
+			ld	d,h
+			pop	de
+			ld	h,1ch
+			sbc	a,h
+			jr	nc,L4cea
+			ld	d,b9h
+			ld	c,d
+			rst	28h
+			ld	l,h
+			ld	a,e
+			rrca
+			ld	e,d
+			add	hl,hl
+			ei
+			scf
+			ld	h,(hl)
+			ret	po
+			ld	d,d
+			ret	m
+			or	c
+			call	pe,L354b
+			sub	l
+			ld	e,e
+			sub	e
+			ld	a,d
+			jp	nz,L584e
+			and	a
+			ld	(hl),e
+			push	de
+			push	de
+			sbc	a,(hl)
+			or	c
+			ld	(hl),e
+			or	d
+			call	p,Lf941
+			call	m,Ld03d
+			cp	a
+			ld	d,e
+			ld	b,e
+			ld	a,(bc)
+			sbc	a,h
+			adc	a,c
+			ret	po
+			ld	d,c
+			halt
+			inc	e
+			ret	p
+			jp	nc,Lf5bf
+			halt
+			call	c,L5507
+			ld	l,h
+			dec	c
+			ld	de,56a6h
+			ld	b,c
+			adc	a,d
+			ld	l,h
+			ld	a,(hl)
+			or	l
+			add	a,c
+			xor	0dh
+			ld	(hl),a
+			dec	(hl)
+			adc	a,l
+			ld	l,a9h
+			cp	b
+			xor	(hl)
+			ld	b,e
+			dec	d
+			inc	d
+			sub	h
+			and	d
+			inc	c
+			jr	c,L4d03
+			rst	08h
+			ld	e,c
+			xor	l
+			dec	sp
+			inc	(hl)
+			rst	10h
+			cp	(hl)
+			jp	L0acf
+			db	89h,7fh,10h,32h,04h,82h,ach,95h
+			db	2ah,ffh,64h,a7h,a6h,41h,27h,f1h
+			db	d7h,e7h,c9h,e4h,36h,6bh,cbh,60h
+			db	dch,8ah,feh,8bh,d5h,e5h,93h,24h
+			ld	(hl),d
+			xor	(hl)
+			add	a,71h
+			jr	c,L4dfc
+			and	h
+			and	h
+			jr	nc,L4ddf
+			inc	bc
+			sub	(hl)
+			ex	af,af'
+			or	e
+			sub	b7h
+			sub	l
+			sbc	a,ceh
+			ld	d,e
+			ex	af,af'
+			ld	e,a
+			cp	e
+			ret	nc
+			add	a,(hl)
+			sub	a
+			ld	l,(hl)
+			di
+			inc	e
+			ld	h,h
+			ld	bc,a8abh
+			ex	de,hl
+			ld	e,h
+			call	p,L806d
+			and	a
+			xor	(hl)
+			inc	b
+			add	hl,sp
+			cp	a
+			call	Ldbd0
+			nop (2x) *
+			ld	a,05h
+			dec	d
+			or	d
+			sbc	a,d
+			cp	c
+			sbc	a,e
+			ld	l,(hl)
+			and	a
+			ld	(de),a
+			rst	18h
+			ld	d,b
+			jp	nz,La54e
+			ld	e,b
+			xor	91h
+			ld	bc,b478h
+			add	a,l
+			rst	20h
+			xor	e
+			cp	c
+			ld	l,a
+			inc	d
+			ld	b,h
+			ccf
+			or	(hl)
+			sub	l
+			call	nz,Le6de
+			sbc	a,5eh
+			inc	h
+			ld	e,42h
+			dec	bc
+			ld	hl,dd7eh
+			nop
+			xor	c
+			ld	(7e23h),hl
+			ld	(hl),d
+			jp	m,Le81a
+			add	a,c
+			ld	(hl),l
+			ld	e,d
+			dec	hl
+			ld	e,a
+			halt
+			ld	d,(hl)
+			ld	d,d
+			in	a,(c0h)
+			and	b
+			ld	b,l
+			jp	c,Le481
+			rrca
+			ld	h,e
+			di
+			jr	nc,L4e40
+			xor	h
+			sbc	a,b
+			sbc	a,b
+			ld	(82efh),a
+			sbc	a,a
+			ex	de,hl
+			add	hl,bc
+			ld	h,b
+			sub	(hl)
+			sbc	a,h
+			ld	l,b
+			dec	sp
+			ld	sp,b537h
+			add	hl,bc
+			ei
+			ld	c,b
+			ld	d,ixh *
+			adc	a,1ah
+			ld	bc,c7e3h
+			ld	h,l
+			rst	30h
+			sbc	a,91h
+			ld	(hl),a
+			ret	pe
+			sub	e
+			sub	34h
+			ld	(hl),l
+			ret	nc
+			cp	b
+			ld	a,(de)
+			ld	d,e
+			rra
+			xor	l
+			rst	20h
+			inc	b
+			add	hl,sp
+			adc	a,b
+			ld	c,h
+			dec	d
+			ret	z
+			sub	c
+			ret	po
+			nop (2x) *
+			call	L9349
+			push	af
+			push	de
+			dec	c
+			dec	d
+			ld	c,b
+			ld	a,(1c78h)
+			ld	(hl),e
+			ret	pe
+			jr	c,L4e6f
+			ld	b,c
+			rst	28h
+			call	z,L7364
+			rst	08h
+			adc	a,a
+			and	h
+			rst	08h
+			ld	h,e
+			cp	(hl)
+			and	b
+			inc	h
+			call	pe,Le4c1
+			ld	l,c
+			adc	a,c
+			halt
+			sbc	a,a
+			ld	e,(hl)
+			ld	e,(hl)
+			and	b
+			inc	a
+			sbc	a,a
+			out	(3bh),a
+			add	a,b
+			ld	c,h
+			ret	z
+			push	de
+			and	d
+			ld	(hl),e
+			call	nc,La0e4
+			cp	b
+			di
+			and	b
+			ld	h,c
+			jp	nc,L8a82
+			sbc	a,(hl)
+			or	e
+			xor	e
+			ret	c
+			dec	(hl)
+			dec	b
+			ld	a,c
+			dec	h
+			inc	l
+			rst	18h
+			jp	z,La930
+			ret	z
+			call	L7b4d
+			jr	nc,L4e3a
+			sbc	a,e
+			nop
+			ld	b,a
+			ld	d,b
+			pop	de
+			adc	a,b
+			ld	c,(hl)
+			ld	a,12h
+			adc	a,b
+			add	a,l
+			ld	a,c
+			adc	a,b
+			rst	38h
+			dec	(hl)
+			inc	d
+			ld	l,a
+			dec	d
+			ld	e,h
+			ld	a,e
+			ld	c,adh
+			jp	nz,Lee4c
+			ld	h,d
+			adc	a,d
+			daa
+			cp	l
+			ei
+			jr	c,L4eb3
+			cpl
+			ld	a,l
+			add	a,c
+			ld	a,d
+			ld	h,l
+			add	hl,de
+			ld	h,l
+			set	4,l
+			ld	h,h
+			pop	hl
+			ld	d,l
+			ld	l,(hl)
+			ld	d,e
+			sbc	a,d
+			ld	(hl),l
+			call	c,L0fc1
+			ex	af,af'
+			dec	de
+			rlca
+			ld	h,l
+			sub	l
+			ld	l,l
+			ld	de,a5e8h
+			cp	c
+			ld	d,e
+			inc	c
+			ld	b,h
+			jr	z,L4e3e
+			adc	a,c
+			ld	e,l
+			ld	b,(hl)
+			xor	l
+			add	a,b
+			ld	c,c
+			ret	nc
+			inc	bc
+			sbc	a,l
+			and	c
+			ex	(sp),hl
+			out	(f0h),a
+			ld	h,d
+			call	nc,L2cc8
+			or	c
+			dec	hl
+			add	hl,sp
+			ld	h,h
+			ld	d,(hl)
+			ld	a,b
+			jp	p,L24a5
+			ld	a,l
+			jp	nc,La31a
+			ld	d,(hl)
+			inc	a
+			ld	c,l
+			sbc	a,58h
+			cp	26h
+			call	c,Led6a
+			ld	a,h
+			ld	h,l
+			ld	b,d
+			jp	po,Lb095
+			ld	a,3ch
+			and	h
+			ccf
+			ld	h,b
+			jp	p,L46ec
+			ld	h,a
+			xor	a
+			ret	pe
+			xor	50h
+			ld	b,b
+			ld	a,(de)
+			add	a,a
+			ei
+			jp	(hl)
+			db	2dh,5ah,f8h,7bh,eeh,68h,52h,afh
+			db	feh,35h,3dh,75h,70h,e6h,eeh,8ch
+			db	9ah,46h,86h,f5h,e2h,4fh,90h,a7h
+			db	41h,7ch,a9h,38h,cdh,2eh,d2h,00h
+			db	1dh,15h,d5h,12h,a9h,6ah,4fh,94h
+			db	f2h,80h,9bh,17h,d2h,27h,03h,31h
+			db	fch,9bh,e5h,49h,78h,07h,d6h,20h
+			db	eeh,e9h,44h,79h,44h,2fh,f9h,a3h
+			ld	h,e
+			and	a
+			rra
+			ld	(7d25h),hl
+			adc	a,c
+			ld	b,e
+			ld	c,d
+			ld	(hl),a
+			rst	38h
+			sbc	a,(hl)
+			ld	a,d
+			sbc	a,h
+			adc	a,c
+			call	pe,L1576
+			ld	a,d
+			sub	d
+			add	hl,hl
+			and	a
+			ld	l,c
+			ld	a,(hl)
+			add	hl,sp
+			rst	08h
+			inc	e
+			adc	a,a
+			call	m,L0595
+			cp	c
+			or	c
+			jp	L2901
+			db	a3h,c6h,44h,9fh,1eh,27h,c1h,1eh
+			db	39h,05h,7fh,beh,c5h,5dh,3ch,8eh
+			db	02h,9ch,27h,3dh,94h,cbh,5dh,e2h
+			db	b0h,aah,23h,56h,7ch,90h,2ch,a9h
+			db	71h,7dh,f5h,54h,f4h,adh,ach,37h
+			db	b9h,78h,40h,25h,bfh,2bh,4bh,abh
+			db	31h,82h,2fh,e6h,11h,55h,13h,bch
+			db	f0h,03h,b4h,e2h,87h,09h,35h,d1h
+			db	81h,0ah,aah,07h,15h,14h,b3h,49h
+			db	7ah,7fh,18h
+			ld	d,(hl)
+			ld	h,b
+			rla
+			adc	a,h
+			ld	d,a
+			ret	p
+			sub	a
+			add	hl,de
+			ld	d,h
+			ld	b,1bh
+			ld	hl,(affdh)
+			ld	(hl),a
+			ld	c,b
+			ld	(4fdch),a
+			jr	z,L4fc1
+			nop (2x) *
+			ld	c,a
+			di
+			call	nc,Ledad
+			push	bc
+			adc	a,c
+			jp	pe,L8d25
+			rra
+			cp	c
+			djnz	L5038
+			ex	(sp),hl
+			or	d
+			call	po,Ld417
+			sbc	a,48h
+			ld	a,b
+			inc	sp
+			ld	(605dh),hl
+			ld	l,l
+			add	a,a
+			sub	e
+			ld	e,l
+			pop	bc
+			ld	(hl),l
+			cp	h
+			ld	e,l
+			ld	l,88h
+			ld	h,e
+			ld	a,a
+			ld	hl,(c6f7h)
+			cpl
+			jp	nz,Ld4ba
+			xor	l
+			jr	z,L4ffc
+			sbc	a,c
+			ccf
+			add	a,d
+			res	6,b
+			sub	e
+			ld	l,d
+			ld	c,e
+			rst	38h
+			sub	h
+			out	(49h),a
+			add	a,c
+			ld	(hl),e
+			scf
+			add	hl,hl
+			ld	l,b
+			xor	b
+			ret	po
+			rla
+			sub	a
+			rst	18h
+			ld	b,l
+			cp	d
+			ld	(de),a
+			or	b
+			rla
+			and	h
+			ld	c,l
+			pop	af
+			dec	hl
+			xor	h
+			out	(fdh),a
+			dec	d
+			inc	(hl)
+			or	h
+			dec	c
+			ld	(hl),a
+			ld	e,h
+			call	nc,L1523
+			ld	l,b
+			rla
+			cp	b
+			dec	sp
+			rlca
+			ld	b,l
+			sbc	a,75h
+			ld	l,h
+			and	e
+			jr	c,L5050
+			ld	c,7ah
+			rla
+			cp	l
+			call	L5936
+			or	b
+			add	a,c
+			sub	e
+			ld	(hl),b
+			inc	a
+			ret	p
+			ld	d,(hl)
+			ld	d,c
+			push	af
+			and	b
+			ld	a,c
+			rst	20h
+			ld	a,h
+			nop (2x) *
+			ld	e,a
+			ld	a,l
+			or	e
+			ei
+			res	7,h
+			inc	hl
+			dec	c
+			or	c
+			sbc	a,d
+			ld	(hl),l
+			add	a,d
+			ld	c,c
+			inc	bc
+			and	e
+			ei
+			ld	c,a
+			adc	a,d
+			daa
+			push	bc
+			or	(hl)
+			jp	nc,L7a1c
+			and	e
+			or	b
+			ld	a,(7b9dh)
+			sub	h
+			jr	z,L5084
+			add	a,e
+			halt
+			ld	c,c
+			adc	a,a5h
+			sub	e
+			ret	nz
+			inc	hl
+			add	a,c5h
+			jr	nc,L5068
+			cp	b
+			ret	p
+			sbc	a,e
+			inc	a
+			ld	b,d
+			ret	nz
+			sub	(hl)
+			halt
+			ld	d,d
+			dec	b
+			sub	a3h
+			cp	d
+			ld	l,h
+			ld	l,a
+			ld	l,h
+			ld	(hl),h
+			inc	d
+			sbc	a,b
+			ld	b,l
+			adc	a,e2h
+			rst	28h
+			and	(hl)
+			jp	(hl)
+			db	01h
+			xor	e
+			ld	h,e
+			exx
+			sbc	a,7fh
+			xor	h
+			cp	d
+			ld	e,l
+			jr	L50ba
+			db	b7h,e2h,e9h,b3h,99h,6ah,4ch,0ah
+			db	e6h,87h,13h,5dh,b6h,c3h,ceh,6fh
+			db	4dh
+			add	a,l
+			ld	h,(hl)
+			ld	h,b
+			sbc	a,e
+			ld	a,(de)
+			ld	e,h
+			or	a
+			xor	e
+			jp	nc,L907d
+			ld	a,89h
+			ld	d,h
+			xor	e
+			inc	(hl)
+			jr	nc,L503b
+			ret	po
+			dec	e
+			sbc	a,d
+			ret
+			db	b2h,19h,28h,1ah,dah
+			ld	h,h
+			ld	e,b
+			ld	e,d
+			call	nz,Lf3f8
+			call	pe,L2968
+			cp	b
+			call	p,L7424
+			ld	h,a
+			jp	c,La323
+			ccf
+			add	a,a
+			ld	a,c
+			ld	a,c
+			ld	d,c
+			inc	e
+			and	d
+			add	hl,de
+			ld	c,80h
+			xor	d
+			ld	b,h
+			ld	l,a
+			ld	(hl),b
+			add	a,h
+			ld	a,l
+			inc	sp
+			sbc	a,1dh
+			and	b
+			adc	a,b
+			rla
+			dec	c
+			dec	b
+			and	h
+			inc	d
+			inc	l
+			adc	a,c
+			ld	b,b
+			sub	h
+			or	h
+			dec	bc
+			sbc	a,c
+			xor	4ah
+			rst	08h
+			sub	99h
+			ld	b,e
+			inc	a
+			ld	d,b9h
+			cpl
+			ret
+			db	5ah,fah,b4h,f2h,fbh,30h,edh,6bh
+			db	9dh,35h,2bh,22h,f8h,bdh,74h,82h
+			db	8fh,9dh,18h,dch,33h,20h,e4h,fah
+			db	28h,7bh,f6h,adh,32h,edh,79h,9dh
+			db	e5h,dah,1bh,47h,4ah,eeh,97h,24h
+			db	a1h,e8h,2eh,0ah,fah,b2h,feh,3ah
+			db	8eh,b5h,e6h,88h,3bh,22h,eah,61h
+			db	31h,e1h,ceh,2ah,7dh,edh,1fh,aah
+			db	6ch,82h,8fh,18h,84h,21h,5eh,f5h
+			db	82h,6ah,c1h,cch,9fh,c6h,e6h,1eh
+			db	eah,a3h,46h,0ah,2fh,24h,f4h,8eh
+			db	a0h,abh,cdh,94h,e8h,8bh,fah,7dh
+			db	4dh,7eh,79h,e0h,88h,cbh,28h,59h
+			db	45h,6ah,58h,c0h,40h,9fh,92h,5eh
+			db	ceh,b4h,1fh,d0h,04h,6ah,d8h,5fh
+			db	80h,88h,2ch,a3h,9fh,3bh,f4h,d8h
+			db	ebh,7ah
+			ld	l,d
+			ld	(bc),a
+			ld	l,b
+			jp	po,Lb8ab
+			nop (2x) *
+			push	bc
+			push	de
+			ld	a,98h
+			cp	a
+			ld	b,(hl)
+			call	m,La2f3
+			ld	e,(hl)
+			ld	bc,bfd0h
+			ret
+			db	22h,e6h,05h,04h,07h,d8h,61h,14h
+			db	13h,28h,3eh,68h,bah,76h,f6h,45h
+			db	3bh,3bh
+			ld	d,b
+			ld	hl,(f3efh)
+			ld	(bc),a
+			jp	(hl)
+			db	7eh,39h,a4h,ach,d0h,83h,9bh,6eh
+			db	88h,e8h
+			dec	c
+			adc	a,(hl)
+			sbc	a,l
+			ld	(hl),67h
+			ld	(hl),64h
+			jp	Labf1
+			db	14h,61h,cah,88h,cch,04h,73h,b5h
+			db	1fh,33h,a4h,feh,ech,3ah,e6h,18h
+			db	14h,b6h,4bh,edh,7ch,50h,5ch,b6h
+			db	6bh,97h,a3h,35h,abh,1eh,8eh,cdh
+			db	00h,aah,6eh,d7h,88h,d6h,d1h,e4h
+			db	b7h,3ah,dah,55h,dbh,58h,e6h,c3h
+			db	49h,c3h,27h,59h,f5h,f2h,28h,5bh
+			db	2ah,2ch,fch,dbh,80h,20h,f5h,0eh
+			db	88h,f7h,8eh,35h,7ah,bfh,66h,55h
+			db	f7h,fdh,b2h,05h,beh,bbh,2bh,32h
+			db	88h,d6h,33h,20h,01h,e5h,a9h,22h
+			db	bah,4dh,12h,45h,31h,8ah,e0h,2eh
+			db	fah,87h,57h,11h,f8h,8fh,c2h,2ah
+			db	dbh,c6h,77h,25h,27h,39h,e9h,8ah
+			db	d7h,e7h,84h,31h,bfh,67h,c3h,9fh
+			db	97h,4eh,57h,32h,71h,4ch,17h,64h
+			db	78h,c6h,4ch,66h,77h,fch,7dh,95h
+			db	08h,c7h,ebh,bah,57h,cdh,1ah,e0h
+			db	5dh,7eh,06h,c0h,b1h,eah,ceh,c8h
+			db	6ah,9ah,e8h,d0h,7ch,3ah,cch,20h
+			db	8bh,cbh,bfh,03h,45h,59h,12h,fch
+			db	89h,3eh,94h
+			sub	c
+			ld	e,9ch
+			ld	d,h
+			ld	c,71h
+			ex	af,af'
+			add	a,f1h
+			inc	e
+			ret	nz
+			ld	b,b6h
+			inc	a
+			ld	b,60h
+			ld	sp,hl
+			ld	(hl),9dh
+			dec	de
+			cp	h
+			cp	a
+			nop (2x) *
+			call	pe,Lcd7a
+			ld	h,e
+			sub	e
+			or	b
+			ld	(hl),e
+			djnz	L526d
+			ex	af,af'
+			ld	(hl),c
+			xor	(hl)
+			sub	26h
+			dec	h
+			ld	c,a0h
+			ld	(hl),64h
+			sbc	a,h
+			ld	(de),a
+			cp	l
+			and	e3h
+			cp	e
+			ld	d,c
+			ld	b,(hl)
+			ld	l,h
+			ld	a,(bc)
+			ld	e,h
+			ei
+			di
+			add	a,c
+			jp	nz,Laa4a
+			add	hl,hl
+			ld	c,d
+			adc	a,b
+			ld	b,e
+			cp	e
+			ld	b,c
+			ld	a,c
+			ld	c,(hl)
+			and	(hl)
+			add	a,d
+			inc	a
+			rst	38h
+			and	h
+			ld	d,d
+			ei
+			and	b
+			ex	de,hl
+			inc	a
+			daa
+			ld	l,a4h
+			ld	a,(bc)
+			call	L39c5
+			adc	a,a
+			dec	bc
+			xor	(hl)
+			cp	l
+			xor	a
+			and	h
+			ret	z
+			xor	h
+			call	z,Lf5b5
+			rst	18h
+			nop
+			call	p,Ld696
+			sub	l
+			add	a,a
+			add	a,(hl)
+			ld	(hl),l
+			pop	hl
+			ld	c,a
+			cpl
+			ld	e,84h
+			cp	feh
+			sub	a
+			sbc	a,c
+			ld	h,a
+			ld	b,c
+			ld	b,85h
+			pop	hl
+			ld	c,b
+			rst	38h
+			xor	(hl)
+			xor	d
+			nop (2x) *
+			nop (2x) *
+			jr	c,L52ff
+			xor	c
+			rst	10h
+			ld	d,c
+			pop	de
+			or	l
+			ld	e,a
+			call	pe,Lb240
+			rst	38h
+			inc	bc
+			or	c
+			add	a,2bh
+			ld	a,a
+			jp	L9235
+			db	b0h,b9h,3eh,d5h,50h,24h,3dh,8ch
+			db	66h
+			sbc	a,e
+			or	c
+			ld	l,77h
+			sbc	a,(hl)
+			ld	h,b
+			ld	(bc),a
+			jp	nc,Leef3
+			call	c,Lcb73
+			dec	e
+			cpl
+			daa
+			jr	L52c8
+			db	d7h,aeh,cfh,8dh,beh,c5h,86h,53h
+			db	4ch,7ch,e8h,2fh,c1h,29h,aah,63h
+			db	2bh,02h
+			ret	p
+			add	hl,hl
+			add	hl,de
+			ld	d,c
+			cpl
+			sbc	a,b
+			add	hl,de
+			ex	(sp),hl
+			jp	(hl)
+			db	c5h,a4h
+			ld	d,(hl)
+			inc	hl
+			pop	af
+			ld	b,e
+			ld	c,c
+			and	f5h
+			scf
+			ld	d,b
+			add	a,c
+			adc	a,h
+			dec	sp
+			sub	(hl)
+			add	a,b
+			sbc	a,e
+			rst	08h
+			inc	sp
+			jp	p,L4f3c
+			ld	e,b
+			ld	l,a
+			ld	h,8dh
+			xor	(hl)
+			inc	a
+			ret	m
+			ld	a,(hl)
+			ret	c
+			ld	l,1fh
+			ld	l,a
+			ld	c,l
+			inc	l
+			jr	c,L5339
+			ld	a,(hl)
+			ld	b,b
+			inc	h
+			jr	nz,L532e
+			ld	h,h
+			xor	b
+			ld	c,d
+			and	(hl)
+			rla
+			and	c
+			sbc	a,a
+			dec	e
+			adc	a,h
+			call	z,Lfd58
+			ret	p
+			dec	de
+			rst	20h
+			sbc	a,(hl)
+			ex	(sp),hl
+			ld	b,b
+			or	l
+			dec	e
+			ld	h,c
+			ld	c,e
+			pop	bc
+			sbc	a,(iy + 0dh)
+			ld	d,d
+			jr	nz,L53a2
+			add	hl,bc
+			rst	18h
+			ld	c,h
+			dec	d
+			push	hl
+			dec	l
+			ld	h,e
+			ld	c,(hl)
+			jp	nz,Lb418
+			adc	a,d
+			sub	d
+			ld	(hl),b
+			ld	bc,6b12h
+			and	d
+			ld	l,(hl)
+			xor	dfh
+			ld	e,h
+			cp	e
+			add	a,bdh
+			adc	a,l
+			push	hl
+			scf
+			dec	(hl)
+			ld	b,c
+			or	d
+			ld	bc,3403h
+			or	b
+			out	(66h),a
+			dec	b
+			sbc	a,c
+			ld	d,a
+			cpl
+			and	c
+			call	Lc009
+			scf
+			dec	sp
+			call	pe,L577c
+			ld	(de),a
+			add	a,8ah
+			sub	e
+			jr	L5416
+			ld	l,b
+			inc	e
+			add	hl,hl
+			ld	l,43h
+			rst	00h
+			add	a,l
+			add	a,a
+			call	pe,L0047
+			and	l
+			ld	d,e
+			ld	de,1766h
+			add	hl,de
+			sub	c
+			dec	d
+			adc	a,e
+			sub	l
+			ld	e,b
+			jr	L5351
+			db	00h,bdh,e7h,e2h,04h,91h,75h,cbh
+			db	cfh,c0h,83h,72h,36h,feh,1bh,5ah
+			db	2fh,f0h,fbh,57h,15h,d7h,59h,4ah
+			db	a4h,3bh,bah,93h,a9h,46h,29h,d3h
+			or	a
+			ld	d,a
+			sbc	a,a
+			call	pe,Ldfe8
+			ld	e,l
+			call	p,Ld298
+			jp	m,Le7b2
+			adc	a,e
+			ld	d,aeh
+			jp	L4a7f
+			nop
+			rst	30h
+			or	b
+			sub	78h
+			ld	e,e
+			sub	b
+			dec	d
+			adc	a,l
+			ld	(hl),a
+			ret	c
+			ld	c,b
+			add	a,b
+			rst	28h
+			xor	(hl)
+			ld	a,e
+			exx
+			sbc	a,e
+			ld	b,d
+			ld	b,d
+			jp	(hl)
+			db	eah,33h,9ah,91h
+			add	a,e
+			ld	(0173h),hl
+			cp	c
+			ret	m
+			adc	a,e
+			rst	00h
+			dec	d
+			xor	e
+			jr	nc,L543f
+			sbc	a,l
+			or	b
+			or	7dh
+			inc	e
+			ret	nc
+			and	67h
+			rst	28h
+			and	a
+			sub	h
+			adc	a,e
+			inc	hl
+			ld	bc,4dc0h
+			dec	bc
+			cp	d
+			ld	l,d
+			or	(hl)
+			inc	e
+			xor	(hl)
+			inc	hl
+			cp	a9h
+			dec	sp
+			ld	l,l
+			cp	d
+			jp	m,L99a8
+			jp	z,Lf47a
+			ld	b,(hl)
+			jp	Lfdd8
+			db	1ch,45h,dfh,c2h,aah,3ch,69h,e6h
+			db	a8h,53h,4dh,02h,53h,e7h,d9h,07h
+			db	4ch,5bh,79h,c0h,19h,21h,7fh,a2h
+			db	cah,26h,18h,20h,aeh,62h,ddh,8ch
+			db	e9h,f3h,e0h,25h,4dh,ech,1dh,9fh
+			db	adh,57h,0dh,67h,fch,68h,63h,a1h
+			db	4eh,14h,d2h,02h,1fh,b0h,55h,a9h
+			db	79h,74h,feh,70h,1ah,27h,16h,2eh
+			db	d8h,9bh,00h,c2h
+			inc	c
+			ld	b,l
+			ld	a,(bc)
+			bit	5,l
+			jp	nc,Lba07
+			adc	a,27h
+			add	a,d6h
+			ld	c,(hl)
+			ld	c,c
+			sbc	a,h
+			nop (2x) *
+			xor	d
+			ld	c,e
+			inc	bc
+			dec	sp
+			ld	h,76h
+			ld	e,d
+			rst	20h
+			and	c
+			ret	c
+			adc	a,a
+			adc	a,a
+			ld	(hl),b
+			add	a,a
+			ld	h,4ah
+			ld	c,6eh
+			adc	a,c
+			sbc	a,e
+			ld	de,9581h
+			sub	b
+			rst	08h
+			and	h
+			cp	h
+			ei
+			adc	a,l
+			ld	b,d
+			ld	d,d
+			rst	20h
+			ld	a,a
+			inc	(hl)
+			push	bc
+			call	po,Le23c
+			ld	h,d
+			call	Le6f4
+			daa
+			ld	d,3ch
+			jp	pe,Lc6a9
+			and	b
+			and	a
+			jr	nc,L5544
+			ld	d,f2h
+			pop	de
+			pop	af
+			or	c
+			ld	e,(hl)
+			ld	h,e
+			ld	c,e
+			ld	sp,hl
+			ld	(hl),d
+			sbc	a,(hl)
+			add	a,l
+			ret	z
+			res	4,(hl)
+			ld	h,d
+			ld	l,b
+			add	hl,bc
+			sbc	a,l
+			or	(hl)
+			ld	e,c
+			add	hl,sp
+			cp	e
+			sbc	a,h
+			sub	l
+			ex	af,af'
+			ld	l,a
+			ld	d,h
+			ld	hl,(9410h)
+			nop (2x) *
+			cp	81h
+			ld	e,e
+			ld	a,d
+			jp	z,L4744
+			ld	(hl),l
+			xor	b
+			or	(hl)
+			call	nc,Ld0a2
+			ld	(hl),a
+			xor	h
+			xor	l
+			jp	pe,Lee76
+			ld	d,b
+			ld	h,d
+			ld	e,e
+			ld	(bc),a
+			and	7dh
+			nop (2x) *
+			ld	a,e
+			ld	h,h
+			ld	h,d
+			ld	l,l
+			add	hl,sp
+			dec	hl
+			ld	e,b
+			call	m,Lff7e
+			ld	hl,(06abh)
+			dec	c
+			cp	b
+			inc	hl
+			adc	a,b
+			sub	c
+			ld	l,40h
+			dec	sp
+			ld	a,(hl)
+			rst	30h
+			ld	(hl),h
+			ld	d,(hl)
+			inc	bc
+			ld	(5737h),a
+			set	7,h
+			cp	e
+			ld	(bc),a
+			adc	a,30h
+			ld	a,(bc)
+			ld	b,c
+			rst	20h
+			ld	sp,99f1h
+			ret	m
+			ld	b,b
+			cp	e
+			ld	(hl),a
+			ld	b,a
+			call	L3c71
+			ld	c,d
+			sbc	a,(hl)
+			ld	b,a
+			sub	h
+			ld	e,c
+			ld	a,h
+			add	a,e3h
+			adc	a,b
+			inc	b
+			sub	h
+			ld	h,a
+			sub	72h
+			ld	a,d
+			ld	e,bah
+			ld	d,b
+			ret	nc
+			ld	e,d
+			dec	a
+			xor	e
+			ld	e,a
+			xor	l
+			add	a,h
+			ret	nz
+			ld	(hl),d
+			dec	de
+			xor	h
+			or	d
+			rst	00h
+			ld	h,c
+			cp	e
+			ld	(hl),h
+			add	hl,de
+			sub	95h
+			dec	(hl)
+			or	d
+			ld	b,a
+			add	a,c
+			or	d
+			out	(aah),a
+			jp	c,La67d
+			ld	b,l
+			exx
+			pop	de
+			ld	a,d
+			dec	h
+			ld	b,b
+			ld	c,b
+			or	(hl)
+			ld	bc,ba13h
+			inc	bc
+			ld	a,h
+			dec	a
+			ret
+			db	01h,b6h,ebh,b2h,5dh,fah,10h,55h
+			db	a5h,dah,32h,22h,c2h,abh,21h,a8h
+			db	a8h,abh,cbh,bfh,92h,12h,edh,e5h
+			db	29h,67h,4eh,37h,a4h,0fh,82h,bfh
+			db	edh,47h,23h,b6h,60h,3bh,47h,a1h
+			db	e6h,b3h,e0h,d1h,fdh,54h,4fh,3ch
+			db	ech,9ch,99h,9fh,a1h,b1h,89h,c1h
+			db	10h,9bh,06h,deh,9ah,9bh,65h
+			ret	po
+			and	(hl)
+			ccf
+			ld	h,h
+			ld	b,b
+			or	c
+			or	l
+			ex	de,hl
+			or	c
+			sub	e
+			adc	a,b
+			ld	d,19h
+			ld	h,e
+			push	bc
+			ld	h,l
+			ld	a,(b830h)
+			ld	(ix + d0h),b
+			ld	e,e
+			dec	l
+			ld	(bc),a
+			call	m,L2980
+			inc	l
+			dec	bc
+			call	c,L8b6e
+			ld	a,(hl)
+			or	b
+			ld	a,a
+			or	b
+			dec	b
+			nop
+			ex	de,hl
+			ld	(72d7h),a
+			ld	d,c
+			ld	c,h
+			jp	p,L266d
+			rst	30h
+			ld	d,d
+			sbc	a,d8h
+			ld	e,a
+			ld	c,d
+			ld	a,(bc)
+			sbc	a,(hl)
+			ld	e,c
+			ret	nc
+			ld	a,d
+			ld	(de),a
+			ld	l,a
+			ld	(hl),c
+			ld	l,91h
+			ld	hl,(bf64h)
+			ld	b,d
+			ld	b,b
+			dec	e
+			inc	de
+			ld	l,c
+			call	po,L662a
+			inc	a
+			adc	a,l
+			dec	e
+			xor	b
+			or	b
+			jr	c,L55b5
+			jp	(hl)
+			db	d9h,d9h,76h,4eh,18h,f0h,f2h,a8h
+			db	18h,f6h,1ah,33h,d9h
+			jp	(hl)
+			db	c7h,26h,71h,32h,f6h,e1h,07h,d7h
+			db	7eh,20h,94h,02h,6ch,fah,b8h,38h
+			db	21h,54h,66h,b2h,98h,dah,8eh,22h
+			db	fdh,5ch,29h,b8h,eeh,8ch,b4h,51h
+			db	86h,c3h,31h,cah,6ch,dbh,46h,6bh
+			db	0fh,a2h,83h,95h,fch,34h,91h
+			djnz	L5614
+			jp	c,La141
+			dec	a
+			and	b
+			xor	d
+			ld	a,d
+			sbc	a,b
+			ret	pe
+			inc	d
+			ld	a,l
+			ex	af,af'
+			ld	(1931h),hl
+			out	(67h),a
+			ld	(hl),b
+			ld	b,b
+			sbc	a,a
+			inc	bc
+			adc	a,fah
+			ld	a,e
+			call	L1422
+			sub	afh
+			ld	(hl),e
+			add	a,cfh
+			jp	nz,L5179
+			and	h
+			ld	l,c
+			sub	b
+			ld	a,c
+			add	a,b0h
+			call	z,Ldd04
+			add	hl,hl
+			pop	af
+			jp	(hl)
+			in	a,(92h)
+			ld	b,d
+			dec	c
+			sbc	a,e
+			ld	d,23h
+			ld	(hl),c
+			call	L4d18
+			jp	pe,Lf590
+			inc	de
+			ld	c,h
+			sbc	a,l
+			sub	b
+			ccf
+			pop	bc
+			rst	18h
+			ld	l,l
+			ld	l,b
+			add	a,(hl)
+			rst	38h
+			add	iy,bc
+			and	e
+			ld	e,(hl)
+			ld	d,c
+			pop	af
+			nop (2x) *
+			or	d
+			adc	a,b
+			sub	d
+			ld	(hl),h
+			ld	(hl),e
+			ld	d,7bh
+			jr	nc,L5708
+			ret	p
+			sbc	a,a
+			or	e
+			ld	a,e
+			ld	h,l
+			jr	z,L5675
+			dec	l
+			di
+			and	e
+			pop	bc
+			sbc	a,a
+			call	nz,L3527
+			add	a,h
+			ld	d,h
+			ld	(hl),c
+			pop	hl
+			xor	h
+			ld	c,(hl)
+			ld	a,(bc)
+			call	p,L3475
+			dec	d
+			ld	(3155h),hl
+			inc	c
+			out	(ebh),a
+			ld	c,b
+			cp	b
+			and	a
+			ld	(hl),e
+			add	hl,bc
+			adc	a,e
+			ld	d,b
+			xor	h
+			ld	d,e
+			ld	(hl),c
+			nop (2x) *
+			ld	e,(hl)
+			and	49h
+			rst	18h
+			call	nz,L6f07
+			add	hl,sp
+			jp	c,L1945
+			and	b
+			scf
+			ld	a,(hl)
+			sbc	a,(hl)
+			cp	c9h
+			dec	bc
+			nop (2x) *
+			ccf
+			jp	c,La7f9
+			pop	de
+			xor	e
+			ld	a,h
+			ld	c,h
+			or	c
+			rra
+			call	pe,L1776
+			nop (2x) *
+			add	hl,bc
+			adc	a,c
+			ld	h,b
+			ld	(hl),35h
+			cp	h
+			add	hl,bc
+			and	d
+			ld	a,(hl)
+			ld	d,(hl)
+			add	hl,hl
+			push	hl
+			di
+			ld	l,e
+			ex	(sp),hl
+			nop
+			ld	d,e
+			and	a
+			dec	d
+			scf
+			ld	(hl),b
+			ld	d,81h
+			jp	pe,L895f
+			xor	b
+			ld	c,e
+			ccf
+			cp	(hl)
+			jr	z,L56bb
+			in	a,(e5h)
+			rst	08h
+			add	a,b
+			dec	e
+			cp	(hl)
+			call	nz,L760a
+			add	a,e
+			adc	a,b
+			ld	(de),a
+			xor	fah
+			and	d
+			rst	18h
+			ld	a,c
+			call	nc,Ldf11
+			and	c
+			ld	e,e
+			ld	(hl),e
+			jp	m,L09eb
+			add	hl,hl
+			ld	d,d
+			ld	sp,hl
+			sub	d
+			ld	h,(hl)
+			ld	b,a1h
+			dec	a
+			xor	a
+			or	l
+			cp	1dh
+			jp	(hl)
+			db	3eh,1dh,92h,d5h,32h,fbh
+			call	po,L0ab3
+			ld	a,(bc)
+			inc	c
+			ret	nc
+			out	(f8h),a
+			inc	de
+			call	Lf111
+			add	a,e
+			ld	h,l
+			add	a,h
+			inc	b
+			xor	e
+			inc	de
+			or	(hl)
+			ret	nc
+			ld	(hl),d
+			and	h
+			djnz	L5764
+			ld	a,e
+			rst	10h
+			add	hl,sp
+			or	l
+			add	a,a
+			dec	sp
+			ld	(4b3dh),hl
+			ld	h,h
+			add	a,c
+			dec	e
+			adc	a,b
+			or	b
+			ld	a,l
+			sub	c
+			rst	28h
+			or	b
+			and	c
+			rst	00h
+			ld	l,b
+			ld	l,(hl)
+			ld	(hl),c
+			daa
+			adc	a,(hl)
+			rla
+			call	c,L6fff
+			cp	(hl)
+			ld	a,a
+			ld	(hl),l
+			sub	e
+			ld	l,e
+			xor	b
+			add	a,cch
+			rst	08h
+			add	a,h
+			ld	d,e
+			jp	nz,Le1d1
+			dec	e
+			ld	h,(hl)
+			cp	d
+			jp	nz,Lb742
+			sbc	a,21h
+			ld	c,(hl)
+			rla
+			and	(hl)
+			call	z,Le10c
+			call	z,Lfdc7
+			add	hl,sp
+			jp	p,L82d8
+			jp	p,Lf072
+			dec	c
+			ld	hl,bde1h
+			ld	l,(hl)
+			nop (2x) *
+			ld	(hl),l
+			inc	bc
+			in	a,(f7h)
+			ld	a,a
+			and	a
+			and	cbh
+			dec	l
+			and	e
+			ld	a,e
+			ld	a,(de)
+			ld	c,l
+			xor	c
+			inc	sp
+			ret	m
+			ld	c,a
+			pop	af
+			cp	a
+			add	a,a
+			ld	c,(hl)
+			push	de
+			exx
+			and	a
+			sub	89h
+			sub	(hl)
+			add	hl,sp
+			dec	(hl)
+			xor	e
+			dec	de
+			xor	c
+			call	po,Lcbc8
+			rst	28h
+			xor	e
+			or	h
+			rrca
+			and	l
+			ld	(hl),c
+			ld	d,d
+			jp	pe,L85fc
+			ld	(hl),d
+			pop	af
+			nop
+			push	hl
+			sbc	a,f9h
+			ld	d,(hl)
+			ld	c,b
+			xor	l
+			call	Lc047
+			ret	z
+			ld	h,h
+			call	c,Lcc80
+			ld	sp,hl
+			ld	c,e
+			ld	e,l
+			ret	c
+			add	a,a
+			cp	5eh
+			ld	c,(hl)
+			ld	e,a
+			ld	b,d
+			sbc	a,e
+			call	Le4d1
+			ld	h,b
+			jp	nc,Lb4cc
+			pop	bc
+			xor	d
+			di
+			daa
+			ld	sp,3c87h
+			ld	l,l
+			rst	08h
+			cp	l
+			ld	e,d
+			cpl
+			ld	b,a
+			or	d8h
+			ld	sp,49bbh
+			push	de
+			jr	L5836
+			db	2ah,87h,fdh,3fh,c0h,87h,aah,7dh
+			db	a5h,f6h,12h,d9h,a5h,adh,e7h,1eh
+			db	9ah
+			cp	c
+			ld	(bc),a
+			ld	a,b
+			ld	d,l
+			xor	b
+			ld	(hl),c
+			ld	h,57h
+			ld	d,a
+			sub	l
+			ld	e,c
+			ld	h,d
+			ld	e,(hl)
+			sub	b
+			ld	a,l
+			pop	hl
+			ld	d,b
+			jp	c,L3200
+			ld	a,(de)
+			call	nz,L71a0
+			ld	a,24h
+			ld	e,3bh
+			ld	l,a
+			in	a,(2fh)
+			ret	m
+			jp	(hl)
+			db	4fh,6bh,a1h
+			rst	10h
+			jp	L2ecb
+			db	bbh,95h,f3h,92h,6fh,c8h,c4h,20h
+			db	19h,efh,ach,78h,52h,cah,08h,1eh
+			db	4dh,b7h,15h,86h
+			dec	c
+			inc	bc
+			cp	h
+			ld	h,b
+			or	d
+			jr	c,L5812
+			ld	d,h
+			pop	af
+			jp	po,L9482
+			ld	a,(bc)
+			djnz	L589c
+			call	nc,Le961
+			ld	b,d
+			ld	sp,59e5h
+			rst	08h
+			ex	(sp),hl
+			add	a,c
+			nop (2x) *
+			inc	b
+			ld	h,d
+			and	a
+			ret
+			db	edh
+			ld	(hl),h
+			sbc	a,e
+			ld	hl,(d941h)
+			call	nc,Labf6
+			ld	l,d
+			xor	(hl)
+			rst	08h
+			inc	(hl)
+			ld	h,l
+			dec	l
+			ld	h,(hl)
+			ld	b,b
+			add	a,d
+			ld	h,c
+			jp	p,L3569
+			or	e
+			jp	(hl)
+			db	37h,53h,eah,86h,06h,45h,3dh,c3h
+			db	b3h,4eh,e6h,4eh,3bh,0fh,0ah,d1h
+			db	f8h,1bh,5bh,9eh,ebh,32h,96h
+			ld	a,c9h
+			add	hl,hl
+			ld	(5fc1h),hl
+			add	hl,sp
+			call	Lfa42
+			call	nz,Lac2b
+			ei
+			jp	(hl)
+			db	23h,45h,43h,14h,edh,9fh,2bh,52h
+			db	29h,f7h,61h,e8h,73h,00h,cdh,92h
+			db	15h,39h,e1h,f1h,18h,a4h,dbh,2fh
+			db	7fh,65h,80h,89h,e0h,63h,21h,a8h
+			db	8ah,e2h,0dh,72h,0eh,5fh,bbh,79h
+			db	33h,59h,04h,2fh,17h,91h,6ch,52h
+			db	9fh
+			and	h
+			ld	(hl),e
+			ld	e,c
+			and	bah
+			ld	a,e
+			add	a,l
+			nop (2x) *
+			ld	e,14h
+			sub	e
+			ld	a,(bc)
+			ld	d,h
+			ld	e,h
+			inc	a
+			ex	af,af'
+			ld	h,b
+			jp	nz,L2f0d
+			rst	00h
+			dec	hl
+			inc	h
+			ex	(sp),hl
+			sbc	a,h
+			ld	b,l
+			ld	(8629h),hl
+			ex	af,af'
+			cp	e
+			ld	e,(hl)
+			ld	e,a
+			ld	a,(bc)
+			sub	a
+			dec	hl
+			and	c
+			and	b
+			ld	d,a
+			djnz	L58ef
+			ld	(de),a
+			dec	sp
+			call	z,L3074
+			push	de
+			inc	a
+			ld	b,e
+			inc	bc
+			ld	h,a
+			ld	c,e
+			sbc	a,b0h
+			sub	d
+			inc	hl
+			ld	b,c
+			ld	b,(hl)
+			or	e
+			sbc	a,f1h
+			inc	c
+			sbc	a,(hl)
+			dec	l
+			add	hl,hl
+			jp	p,Lb991
+			jp	pe,L6db7
+			ld	hl,(8266h)
+			ccf
+			cpl
+			inc	sp
+			and	l
+			push	bc
+			inc	(hl)
+			adc	a,l
+			halt
+			rst	30h
+			rst	00h
+			ret	nc
+			ld	a,(bc)
+			pop	hl
+			ld	d,h
+			sbc	a,l
+			or	l
+			add	a,a
+			ld	l,e
+			ld	d,a
+			inc	d
+			ret	c
+			sbc	a,e
+			add	hl,de
+			ld	a,b
+			jp	z,L249d
+			ld	a,h
+			dec	b
+			ld	(hl),c
+			inc	de
+			ld	l,a
+			ld	h,h
+			jp	p,L67ae
+			sbc	a,e1h
+			and	b
+			inc	bc
+			rst	08h
+			inc	d
+			xor	d
+			jr	L5955
+			db	d5h,f4h
+			ld	h,h
+			ld	d,l
+			sub	l
+			cp	h
+			xor	b
+			ex	af,af'
+			exx
+			rst	20h
+			rlca
+			ld	l,d
+			inc	b
+			ld	c,e1h
+			xor	e
+			sbc	a,d
+			sub	66h
+			ld	b,a
+			ret	pe
+			ld	b,36h
+			call	Lbe91
+			inc	e
+			rst	30h
+			ld	d,e
+			daa
+			cp	(hl)
+			ld	(hl),l
+			ld	a,(hl)
+			add	a,h
+			ret	pe
+			ret	m
+			ld	(hl),h
+			inc	bc
+			ld	e,l
+			ld	a,(de)
+			out	(26h),a
+			ld	a,c
+			adc	a,a
+			sbc	a,d
+			ld	d,(hl)
+			jp	z,Le907
+			pop	hl
+			ld	h,l
+			call	Lc80a
+			jp	z,L3308
+			add	a,d
+			dec	de
+			rst	38h
+			sbc	a,l
+			ld	hl,(1ba7h)
+			or	e
+			ld	h,a
+			out	(ech),a
+			ld	e,b
+			ld	hl,8e01h
+			ld	d,h
+			add	a,e
+			ld	(hl),a5h
+			pop	hl
+			ld	e,b
+			ld	b,h
+			rst	00h
+			jr	nz,L5a11
+			ld	b,h
+			pop	bc
+			cp	6ch
+			ld	d,c
+			ld	l,h
+			inc	de
+			dec	hl
+			rst	18h
+			sub	b
+			ld	c,1ah
+			cp	d
+			xor	h
+			sub	e
+			and	(hl)
+			jp	p,L4196
+			ld	(hl),l
+			add	hl,hl
+			inc	c
+			dec	e
+			ld	a,c
+			and	(hl)
+			or	a
+			and	d
+			ld	d,d9h
+			adc	a,38h
+			rst	38h
+			cp	47h
+			ld	(hl),e
+			jp	(hl)
+			db	c4h,d6h
+			cp	c
+			push	de
+			ld	b,d
+			ld	e,l
+			inc	l
+			jp	nc,Leded
+			rst	00h
+			adc	a,l
+			cpl
+			call	m,L6862
+			ld	(bc),a
+			ld	d,e
+			call	po,Laca8
+			add	a,b
+			adc	a,d
+			ld	(hl),e
+			push	af
+			sub	l
+			ret	pe
+			ld	sp,hl
+			call	c,L6daa
+			or	d
+			rst	00h
+			add	hl,de
+			or	l
+			ld	(hl),a
+			add	a,c
+			ld	d,h
+			jp	Lfa5c
+			db	0dh,d8h,4dh,d5h,abh,91h,38h,d1h
+			db	5ch,38h,a2h,89h,5dh,bah,cch,bdh
+			db	5eh,f2h,aah,0eh
+			sbc	a,a
+			ld	(bc),a
+			ld	(hl),c
+			call	pe,Lfaaf
+			ld	e,h
+			call	nz,L3f35
+			or	c
+			jp	z,La1de
+			ld	l,(hl)
+			ld	a,(bc)
+			pop	af
+			ld	h,a
+			jp	p,L64cb
+			or	d
+			dec	hl
+			xor	(hl)
+			cp	d
+			xor	l
+			jp	(hl)
+			db	2bh,86h,5eh,8ah,c0h,8fh,01h,62h
+			db	7ah,ceh,e7h,9ch,3bh,fdh,85h,22h
+			db	12h,b3h,19h,1bh,74h,bdh,23h,56h
+			db	72h,7eh,12h,10h,e5h,63h,1bh,deh
+			ld	(a659h),a
+			or	d
+			ld	h,h
+			adc	a,(hl)
+			ld	c,d
+			ld	l,l
+			rst	08h
+			ld	d,l
+			or	c
+			jp	ix
+			db	91h,8dh,9ah,b7h,6eh,7fh,8ah,f9h
+			db	09h,6ch,1bh,30h,7dh,07h,57h,39h
+			db	b8h,92h,d9h
+			pop	af
+			ld	a,(hl)
+			ret	m
+			adc	a,b
+			dec	sp
+			sub	00h
+			jr	nc,L59ed
+			ld	(hl),e
+			ld	d,c
+			ret	z
+			ld	e,h
+			ld	a,(de)
+			jp	L5703
+			db	8dh,d9h,96h,31h,6dh,67h,68h
+			xor	e
+			sbc	a,a
+			ld	(hl),a
+			dec	l
+			jr	L5a86
+			db	d5h,1bh,31h,6dh,25h,36h,e4h
+			ld	a,e
+			ld	(bc),a
+			ld	(hl),d
+			xor	e
+			inc	b
+			add	hl,sp
+			ld	de,11a8h
+			ld	e,e
+			rst	10h
+			inc	de
+			ld	(hl),c
+			sub	l
+			ld	b,b
+			or	(hl)
+			xor	h
+			and	l
+			ld	(hl),l
+			inc	e
+			sbc	a,b
+			ret	z
+			sbc	a,c
+			cp	h
+			xor	(hl)
+			rst	28h
+			add	a,d
+			jp	(hl)
+			db	d9h,83h,43h,45h,86h,dah,ach,66h
+			db	e4h,87h,35h,deh,84h,27h,79h,70h
+			xor	(hl)
+			inc	(hl)
+			ex	af,af'
+			in	a,(28h)
+			ld	b,cbh
+			inc	hl
+			call	pe,L8698
+			ld	h,(hl)
+			ld	a,d
+			ld	(hl),a1h
+			xor	88h
+			dec	hl
+			ld	l,e
+			sub	l
+			call	pe,L3cbb
+			rst	28h
+			inc	bc
+			ld	l,e
+			inc	bc
+			sub	b
+			pop	af
+			ld	c,a
+			add	hl,de
+			ld	c,b6h
+			ld	h,d
+			ret	nz
+			ld	h,e
+			ld	(hl),b
+			ld	l,51h
+			add	a,e
+			ld	h,e
+			pop	hl
+			exx
+			ccf
+			ld	c,d
+			ld	l,cch
+			halt
+			jp	c,Lf1ce
+			jp	nz,L49ac
+			ld	e,l
+			and	d
+			ld	h,a
+			ld	a,d
+			ld	(de),a
+			jr	c,L5ade
+			xor	e
+			inc	c
+			inc	a
+			adc	a,c
+			add	a,b
+			exx
+			ld	a,l
+			sub	c
+			sub	c
+			and	b6h
+			ex	(sp),hl
+			ld	e,c
+			ret	po
+			ld	b,h
+			ld	h,c
+			ld	e,69h
+			sub	c
+			xor	(hl)
+			ld	d,b
+			inc	sp
+			or	e
+			or	l
+			ld	e,d
+			ld	(hl),a
+			ld	b,l
+			or	c
+			or	c
+			dec	b
+			jp	nc,Lbba8
+			adc	a,a
+			ld	e,b
+			jr	L5b85
+			db	feh,b4h,8eh,27h,5eh,7dh,fch,bah
+			db	beh,0fh,63h,14h,e9h,d7h,a3h,aeh
+			db	b1h,07h,16h,20h,a3h,c4h,9dh,2dh
+			db	07h,efh,3fh,b5h,d0h,01h,3ah,bbh
+			db	0dh,37h,c8h,9fh,b6h,cbh,c6h,21h
+			db	5bh,2dh,4ch,e3h,43h,5fh,59h,aeh
+			db	3ah,4bh,bfh,e0h,cch,adh,a1h,2fh
+			db	bch,f8h,3dh,a8h
+			ld	l,l
+			ld	e,cdh
+			ld	b,b
+			xor	(hl)
+			ld	c,1ch
+			ld	(hl),h
+			ld	l,c
+			sbc	a,42h
+			ret	p
+			dec	bc
+			sbc	a,d
+			dec	l
+			cpl
+			nop (2x) *
+			dec	hl
+			ret	z
+			or	l
+			and	l
+			rst	30h
+			ex	de,hl
+			adc	a,(hl)
+			adc	a,a
+			ld	c,a
+			ld	h,(hl)
+			inc	d
+			ld	a,(bc)
+			ld	l,e
+			inc	a
+			ld	c,e
+			sbc	a,c
+			inc	h
+			ld	c,d
+			sbc	a,e
+			ld	e,h
+			call	po,Laf92
+			or	l
+			dec	iy
+			ccf
+			add	a,e
+			add	a,77h
+			ld	d,(hl)
+			ld	b,a
+			push	bc
+			call	nz,L37cb
+			or	b
+			ccf
+			inc	d
+			ld	d,a
+			add	a,c
+			ld	h,d
+			cp	h
+			push	af
+			ld	c,(hl)
+			xor	a
+			push	hl
+			sub	d
+			pop	hl
+			add	a,a
+			dec	d
+			ld	l,a
+			ld	a,(hl)
+			ld	l,d
+			ld	de,0d92h
+			sub	c
+			ld	b,d
+			rst	08h
+			or	h
+			xor	b
+			rst	30h
+			call	p,Le894
+			inc	bc
+			add	a,b
+			ld	b,c
+			jr	L5b50
+			db	e4h,51h,c3h,c5h,76h,82h,59h,83h
+			db	fbh,b1h,b4h,8bh,96h,6ah,d2h,09h
+			db	e3h,43h,e0h,66h,5ah,20h,f1h,63h
+			db	03h,a6h,55h,0ch,06h,adh,93h,23h
+			db	94h,d6h,07h,e4h,c2h,21h,5dh,d9h
+			db	08h,1dh,43h,2ch,5dh,25h,e1h,89h
+			db	37h,bbh,99h,8fh,10h,29h,0ch,71h
+			db	19h,dch,89h,17h,02h,c9h,2fh,6fh
+			db	a4h,78h,92h,6ah,a6h,39h,5ch,d2h
+			db	52h,f7h,62h,18h,a2h,2fh,dfh,a3h
+			ex	af,af'
+			sbc	a,(hl)
+			and	a
+			ld	d,b
+			ld	(hl),9ch
+			cp	d
+			ld	(hl),h
+			rla
+			ld	b,a
+			ld	(hl),a
+			adc	a,b
+			inc	l
+			xor	e
+			sbc	a,b
+			inc	de
+			set	1,(hl)
+			add	a,e
+			ld	a,b
+			jr	c,L5c48
+			inc	bc
+			ld	e,b
+			ld	(de),a
+			ret	c
+			call	po,L0c80
+			rst	30h
+			inc	d
+			ld	bc,0471h
+			ld	b,d
+			ld	e,d
+			jp	nz,L9faf
+			call	nz,L44e8
+			ld	h,a
+			ld	e,e2h
+			sbc	a,(hl)
+			ld	(hl),e
+			cp	b
+			ld	c,c
+			ld	(de),a
+			adc	a,(hl)
+			rst	00h
+			add	a,d
+			sbc	a,d
+			ccf
+			ld	a,c
+			sbc	a,h
+			and	l
+			dec	d
+			ld	(hl),h
+			and	cfh
+			sub	d
+			ld	sp,6fa9h
+			pop	hl
+			ld	b,a
+			sub	2fh
+			rrca
+			ld	a,(hl)
+			ld	a,(3240h)
+			xor	h
+			and	a
+			ld	de,b2ceh
+			inc	e
+			ld	d,e
+			ld	l,d
+			inc	bc
+			ld	e,h
+			ld	de,2a2eh
+			ld	a,d
+			cp	d
+			or	d
+			ld	a,d
+			sbc	a,c
+			ld	a,(de)
+			sub	h
+			push	af
+			add	a,h
+			ret	c
+			ld	h,2dh
+			nop (2x) *
+			or	a
+			ld	e,(hl)
+			ld	d,b
+			sub	d
+			ld	c,c
+			jr	z,L5c92
+			ret	pe
+			ld	e,(hl)
+			xor	e5h
+			cpl
+			inc	de
+			ld	d,l
+			ld	b,e
+			ld	h,l
+			cp	b
+			jr	c,L5bff
+			ld	(de),a
+			ld	(95abh),a
+			ccf
+			cp	d
+			ld	d,l
+			add	a,dbh
+			ret	m
+			rlca
+			ld	b,h
+			rst	30h
+			ld	l,l
+			add	a,(hl)
+			ld	c,l
+			adc	a,a
+			dec	h
+			ld	a,c
+			ld	bc,5acch
+			di
+			and	l
+			nop (2x) *
+			or	d
+			ld	h,b
+			and	c
+			add	a,(hl)
+			inc	hl
+			inc	d
+			inc	e
+			ex	af,af'
+			ld	a,e
+			ld	a,h
+			sub	l
+			di
+			ld	l,a
+			or	e
+			or	a
+			ld	e,l
+			inc	l
+			pop	bc
+			ld	d,a
+			add	a,e
+			adc	a,l
+			jp	La4db
+			db	3ch,65h,cch,bdh
+			add	a,a
+			and	d
+			and	f2h
+			adc	a,(hl)
+			ld	b,(hl)
+			cp	l
+			ld	e,(hl)
+			ld	c,4dh
+			add	a,36h
+			ld	d,a5h
+			jp	Lfeeb
+			db	19h,c0h,40h,ddh,90h,4eh,feh,72h
+			db	7fh,64h,7ah,17h,bbh,d7h,4eh
+			ld	d,a
+			add	a,d
+			jr	nc,L5cea
+			add	hl,hl
+			ld	a,b1h
+			ld	l,(hl)
+			ret	po
+			add	a,e
+			xor	d
+			ld	e,e
+			ex	af,af'
+			jp	nz,L8822
+			adc	a,e
+			dec	c
+			ld	l,(hl)
+			call	nc,Ld61f
+			ld	c,a
+			ld	(hl),c
+			ld	h,h
+			ret	p
+			ld	e,c
+			inc	a
+			sub	l
+			sub	d
+			sub	c
+			jp	c,Lf350
+			ld	sp,hl
+			inc	a
+			ld	b,l
+			ld	e,c
+			jp	nc,L4716
+			scf
+			ld	l,l
+			dec	(hl)
+			and	b
+			ld	a,h
+			sbc	a,b
+			ld	a,(hl)
+			add	hl,sp
+			ld	(de),a
+			adc	a,(hl)
+			ld	a,(hl)
+			exx
+			sub	(hl)
+			ld	l,b
+			sbc	a,l
+			xor	a0h
+			sub	c
+			djnz	L5d35
+			halt
+			ld	c,81h
+			ld	d,c
+			ld	l,c
+			ld	bc,b563h
+			sub	c
+			or	e
+			or	e
+			daa
+			ld	c,c
+			adc	a,e
+			ld	a,(bc)
+			or	(hl)
+			rst	28h
+			call	m,L870d
+			add	hl,hl
+			adc	a,l
+			ld	e,c
+			sub	d
+			dec	h
+			dec	sp
+			ld	a,bbh
+			rrca
+			ld	(bc),a
+			add	a,a
+			call	po,Lbbd0
+			ld	l,c
+			ld	l,a
+			ld	l,l
+			ld	l,a
+			jr	c,L5d2f
+			inc	a
+			add	a,e
+			ld	a,h
+			ld	a,c
+			inc	a
+			inc	sp
+			ld	l,c
+			add	a,c
+			call	m,L457b
+			xor	e
+			xor	c
+			pop	bc
+			ret	m
+			ld	d,d
+			and	e
+			jr	z,L5cc7
+			ld	c,a5h
+			ld	h,l
+			and	a
+			or	a
+			ld	e,(hl)
+			ld	c,a
+			ld	h,c
+			ld	b,a
+			push	bc
+			add	a,l
+			dec	hl
+			cp	e
+			adc	a,h
+			ld	sp,hl
+			sbc	a,a
+			ld	h,c
+			add	a,b
+			rla
+			call	p,L458d
+			call	L3cf0
+			nop (2x) *
+			ret	po
+			ld	b,d
+			adc	a,a4h
+			ld	a,h
+			ld	hl,08afh
+			sbc	a,l
+			ld	l,38h
+			ld	l,l
+			inc	hl
+			or	e
+			inc	a
+			adc	a,l
+			pop	hl
+			ret	nz
+			rla
+			jr	z,L5dec
+			add	hl,sp
+			in	a,(e1h)
+			xor	b
+			jp	p,L9d4f
+			ld	b,d
+			ei
+			ld	h,e
+			ld	a,e
+			and	28h
+			ld	(hl),b
+			xor	b
+			adc	a,e
+			jr	nz,L5d07
+			ld	d,h
+			ld	h,h
+			cp	c
+			ccf
+			ret	nc
+			rla
+			call	Le36c
+			ret	p
+			ld	l,l
+			ld	a,(hl)
+			rst	30h
+			cpl
+			ld	hl,ae3bh
+			ld	(hl),a
+			ld	d,c
+			ld	b,l
+			ld	h,e
+			cp	(hl)
+			and	h
+			jr	nz,L5d22
+			jr	L5e04
+			db	f9h,d1h,e2h,f6h,adh,57h,6bh,55h
+			db	f1h,6ch,6fh,b5h,6ah,b4h,51h,59h
+			db	6ah,b5h,b9h,76h,09h
+			ld	c,b
+			rst	20h
+			and	e
+			jp	Ld037
+			db	fch,f8h,90h,80h,e0h,e1h,c1h,1ch
+			db	30h
+			ld	e,e
+			and	h
+			rst	00h
+			dec	bc
+			call	nc,L4156
+			ld	e,h
+			rst	38h
+			add	hl,hl
+			call	m,L1b8d
+			sbc	a,l
+			rla
+			ld	(hl),l
+			xor	a
+			sbc	a,c5h
+			push	bc
+			ld	e,e
+			ld	d,l
+			ld	b,d
+			rlca
+			ld	e,a
+			ld	b,c
+			daa
+			rst	08h
+			sub	c
+			ld	b,60h
+			ld	c,a
+			push	de
+			cp	(hl)
+			add	a,a
+			ld	e,l
+			ld	(hl),e
+			nop (2x) *
+			ld	a,d
+			ld	e,a
+			dec	sp
+			and	l
+			jr	z,L5d81
+			ld	c,l
+			xor	c
+			djnz	L5dd1
+			sub	h
+			rst	38h
+			ld	d,b
+			jr	L5dbf
+			db	61h,b1h,b0h,20h,79h,01h,3ah,bdh
+			db	51h,83h,86h,7bh,a6h,63h,5ah
+			rst	30h
+			ld	b,l
+			jr	nc,L5dd5
+			jr	nc,L5db0
+			dec	h
+			ld	e,a
+			ld	b,4ah
+			adc	a,e
+			and	5bh
+			or	b
+			ld	hl,b23bh
+			ld	a,a
+			ld	d,h
+			add	a,a
+			cpl
+			add	hl,sp
+			ld	a,e
+			rst	10h
+			adc	a,eah
+			ld	(hl),e
+			ld	sp,hl
+			inc	c
+			jp	(hl)
+			db	c8h,4eh,cfh,1dh,aah,8ch,20h,c5h
+			db	a8h,8ah
+			jp	nc,L1370
+			dec	de
+			dec	b
+			cpl
+			and	6dh
+			rst	28h
+			ld	a,c
+			or	(hl)
+			adc	a,l
+			inc	b
+			ret	m
+			di
+			jp	(hl)
+			db	1bh,9ah,66h,04h,2eh,f1h,c7h,e5h
+			db	e9h,7fh,1fh,ceh,c2h,4ah,37h,4bh
+			db	63h,e9h,9dh,b4h,9eh,86h,2eh,93h
+			db	27h,0ah,15h,14h,dbh,6ah,20h,eeh
+			db	75h,0eh,93h,96h,f8h,58h,04h,f7h
+			db	63h,63h,bah,fbh,52h,bch,93h,7fh
+			db	16h,dah,a9h,97h,23h,3eh,50h,cbh
+			db	e9h,62h,2fh,62h,55h,47h,b4h,9dh
+			db	c7h,8ah,f3h,00h,f3h,6ch
+			ld	a,a
+			jr	nz,L5e2c
+			ld	h,4eh
+			ld	l,b
+			ld	a,e
+			xor	d
+			jp	L3cc8
+			db	48h,76h,a4h,30h,d3h,61h,48h,61h
+			db	17h,aeh,10h,a1h,ddh,35h,d7h,97h
+			db	d6h,5bh,6eh,51h,86h,d8h,1eh,08h
+			db	e7h,58h,d1h,25h,14h,f3h,33h,a9h
+			db	04h,57h,39h,27h,9ch,89h,16h,ceh
+			db	94h,15h,b0h,08h,b3h,aeh,feh,b8h
+			db	c9h,73h,71h,19h,76h,36h,5ah,dch
+			db	17h,deh,59h,59h,edh,b5h,95h,a1h
+			db	19h,88h,3eh,25h,76h,5fh,64h,41h
+			db	8fh,44h,3bh,11h
+			ret	m
+			ld	d,d
+			add	a,aeh
+			ld	c,l
+			dec	d
+			sbc	a,88h
+			sub	d
+			or	h
+			ld	hl,(dc53h)
+			ld	h,(hl)
+			adc	a,a
+			adc	a,l
+			call	po,L6778
+			cp	(hl)
+			cp	(hl)
+			rst	10h
+			ld	d,b
+			rlca
+			ld	(hl),c
+			xor	d
+			dec	c
+			exx
+			ld	d,d
+			ld	b,b
+			rra
+			inc	a
+			xor	(hl)
+			inc	de
+			ld	e,f4h
+			ld	(hl),e
+			and	(hl)
+			or	a
+			ld	(efd1h),a
+			rst	20h
+			sbc	a,h
+			jp	pe,L657a
+			ld	(hl),h
+			cp	c
+			sbc	a,b
+			ld	a,d
+			ld	h,e
+			ld	a,a
+			adc	a,h
+			and	c
+			ret
+			db	e6h,98h,10h,68h,52h,37h
+			ld	c,c
+			ld	b,d
+			dec	e
+			adc	a,a
+			ld	l,e
+			adc	a,b
+			ld	h,e
+			ld	b,ebh
+			ret	nz
+			dec	l
+			rra
+			ret	po
+			call	Lca83
+			inc	h
+			ld	hl,d37fh
+			inc	hl
+			ld	(bc),a
+			and	b
+			ld	l,c
+			ld	b,d
+			dec	l
+			ret	nc
+			xor	a0h
+			inc	de
+			ld	d,l
+			or	c
+			xor	bch
+			or	e
+			xor	l
+			nop (2x) *
+			sbc	a,b
+			sub	h
+			ld	l,l
+			inc	l
+			dec	de
+			sbc	a,l
+			ret	nc
+			ld	h,h
+			and	c
+			ccf
+			ld	h,l
+			sbc	a,c
+			inc	bc
+			call	nz,L4a32
+			daa
+			ld	(hl),b
+			call	m,Le523
+			ld	l,e
+			push	bc
+			sub	b
+			ld	d,9bh
+			ld	l,e
+			and	(iy + a2h)
+			cp	(hl)
+			ld	e,b
+			inc	(hl)
+			and	(hl)
+			halt
+			jp	p,L281d
+			ld	b,b
+			dec	e
+			push	af
+			ld	a,a
+			or	d
+			nop
+			and	h
+			inc	d
+			call	m,Lc601
+			and	c
+			sub	a
+			ld	a,c
+			daa
+			sub	iyl *
+			ret
+			db	38h,feh,8dh,cch,8fh,06h,27h,83h
+			db	b1h,3fh,f1h,25h,dfh,98h,35h,5dh
+			db	1fh,20h,a9h,79h,45h,8ch,77h,d4h
+			db	a8h,32h,1ah,94h,eah,71h,43h,83h
+			db	30h,44h,17h,c8h,74h,39h,59h,8bh
+			db	1dh,02h,f3h,f1h,08h,28h,f0h,11h
+			db	6ah,f9h,bdh,3fh,4ch,02h,6ch,20h
+			db	6fh,d7h,69h,dch,13h,4ah,9dh,ddh
+			db	20h,deh,a1h,64h,41h,07h,3dh,3ah
+			db	ach,11h
+			ld	a,d
+			push	de
+			di
+			rrca
+			ld	d,b
+			xor	e
+			sub	66h
+			ld	d,c
+			ld	(hl),a
+			ld	a,b
+			rst	08h
+			ret	nz
+			inc	a
+			ld	d,(hl)
+			push	hl
+			jr	nz,L5fcb
+			ld	h,(hl)
+			ld	h,a
+			ld	a,(bc)
+			ld	h,b
+			xor	h
+			ld	d,l
+			call	z,Lbbbb
+			ld	e,d
+			ld	e,cfh
+			ld	(hl),e
+			ld	sp,b06ah
+			jp	m,L4523
+			di
+			ld	(8317h),a
+			rst	10h
+			ccf
+			call	po,La928
+			ld	c,e
+			add	a,c
+			scf
+			adc	a,d
+			ld	h,e
+			sub	l
+			adc	a,b
+			or	e
+			call	nz,Lb7e3
+			jr	L5fbf
+			db	2eh,19h,53h,28h,18h,bfh,c6h,bch
+			db	bbh,b4h,57h,d4h,4dh,8fh,06h,44h
+			db	cah,cch,0eh,bbh,58h,70h,75h,2eh
+			db	c5h,33h,75h,a5h,7fh,e6h,f2h,3bh
+			db	2eh,1dh,75h,cah,3fh,eeh,ech,72h
+			db	d5h,14h,99h,2ah,aah,7bh,90h,86h
+			db	70h,fah,41h,dah,95h,35h,0fh,b6h
+			db	13h,4eh,eeh,d9h,55h,cdh,4fh,07h
+			db	5eh,d2h,28h,feh,59h,07h,35h,73h
+			db	53h,19h,0ah,f4h,9eh,15h,87h,63h
+			rst	20h
+			ld	a,(hl)
+			ld	h,e
+			ld	d,d
+			call	nz,L67d4
+			cp	d
+			ex	af,af'
+			dec	b
+			ret	po
+			adc	a,c
+			exx
+			jp	m,L25cc
+			inc	h
+			pop	bc
+			ld	d,ffh
+			ld	d,e
+			nop
+			cp	l
+			adc	a,b
+			ld	a,bbh
+			sbc	a,b
+			rst	20h
+			or	(hl)
+			ld	(bc),a
+			rlca
+			ld	d,a
+			adc	a,b
+			ld	a,(298ah)
+			add	a,l
+			jr	z,L604a
+			add	a,a
+			ld	d,c
+			ld	h,d
+			inc	h
+			ld	b,l
+			ld	h,(hl)
+			push	de
+			ex	de,hl
+			rst	28h
+			ld	(hl),c
+			ret	m
+			ld	sp,hl
+			add	a,h
+			ld	l,a
+			ld	e,(hl)
+			inc	d
+			xor	h
+			ld	c,d
+			pop	af
+			ret	c
+			sub	(hl)
+			ei
+			rst	20h
+			rst	20h
+			add	a,h
+			dec	h
+			ex	(sp),hl
+			call	p,L6c4c
+			ret	m
+			ret	nc
+			ld	a,e
+			ld	(hl),45h
+			ld	h,4ch
+			add	a,d
+			inc	hl
+			ld	(hl),91h
+			call	nc,L0d6b
+			cp	d
+			ld	b,l
+			ld	d,a
+			jp	nc,L5566
+			rst	10h
+			jp	nc,L1e3c
+			jp	nc,L16d8
+			ld	c,31h
+			inc	sp
+			sbc	a,c
+			and	a
+			ld	c,d
+			jp	c,La173
+			ld	(hl),a
+			adc	a,(hl)
+			ld	h,e
+			add	hl,bc
+			cp	c
+			dec	d
+			sub	e
+			dec	h
+			ld	c,e
+			ld	e,b
+			sbc	a,d
+			scf
+			inc	b
+			adc	a,37h
+			cp	l
+			ld	c,(hl)
+			cp	a
+			cp	e
+			ld	d,e
+			push	hl
+			ei
+			pop	bc
+			ld	(hl),b
+			daa
+			sbc	a,h
+			ld	h,c
+			in	a,(86h)
+			ld	c,b
+			xor	b
+			inc	sp
+			dec	(hl)
+			res	3,e
+			sub	d
+			dec	bc
+			xor	a
+			ld	a,c
+			inc	l
+			adc	a,h
+			rst	28h
+			push	de
+			ld	a,(279bh)
+			ld	h,(hl)
+			ret
+			db	a3h,b7h,56h,7fh,60h,f5h,79h,30h
+			db	93h,abh,23h,70h,73h,f4h,8ch,8ch
+			db	29h,56h,89h,0ah,34h,bah,42h,d0h
+			db	6dh,9eh,38h,e3h,1fh,38h,a2h,37h
+			db	7eh,70h,b0h,05h,72h,8ch,f3h,06h
+			db	8eh,85h,59h,cch,29h,8bh,35h,e0h
+			db	6dh,e3h,e5h,7eh,48h,eah,3ch,cbh
+			db	02h,36h,b2h,21h,05h,60h,4eh,9bh
+			db	60h,75h,21h,a7h,70h,ceh,46h,f9h
+			db	e6h,9fh,afh,17h
+			inc	b
+			sbc	a,a
+			add	a,l
+			ld	a,81h
+			rst	10h
+			jp	m,L35e7
+			ld	l,(hl)
+			ld	a,c
+			cp	d
+			ld	c,c
+			sub	(hl)
+			sbc	a,b
+			ld	a,5ch
+			and	a
+			adc	a,l
+			push	bc
+			rst	38h
+			inc	hl
+			ld	a,e
+			rst	28h
+			or	(hl)
+			ld	a,a
+			rst	10h
+			sbc	a,(hl)
+			inc	(hl)
+			add	hl,sp
+			xor	10h
+			or	d
+			cp	cah
+			ld	a,c
+			ld	e,c
+			dec	sp
+			and	l
+			cp	h
+			add	a,h
+			ld	a,b7h
+			call	c,L6e59
+			dec	hl
+			dec	hl
+			ld	a,(de)
+			ld	l,c
+			call	m,L88d3
+			call	nc,L4e8b
+			xor	b
+			ld	c,b
+			pop	bc
+			adc	a,b
+			nop (2x) *
+			nop
+			djnz	L612f
+			cp	(hl)
+			ld	h,a
+			call	p,Ld91d
+			rla
+			ld	h,d
+			xor	(hl)
+			pop	af
+			ld	a,h
+			add	a,h
+			rst	28h
+			ld	a,a
+			ld	a,b
+			cp	b
+			cp	e
+			sbc	a,(hl)
+			ld	c,h
+			sub	e
+			rla
+			xor	(hl)
+			dec	hl
+			ld	e,l
+			ld	c,d6h
+			adc	a,e
+			ret	z
+			ld	h,h
+			jp	m,L1bb7
+			and	a
+			or	h
+			call	po,L96fc
+			add	a,c
+			adc	a,49h
+			adc	a,(hl)
+			call	po,Lf18d
+			ld	b,h
+			cp	5ah
+			xor	b
+			ld	d,l
+			sub	(hl)
+			inc	sp
+			ld	c,l
+			rla
+			and	d
+			ld	hl,2963h
+			and	c
+			dec	hl
+			ld	(hl),d
+			xor	d
+			jr	z,L6188
+			ret	po
+			cp	48h
+			or	e
+			ld	h,(hl)
+			di
+			call	Lfb1e
+			inc	l
+			and	l
+			ret	nc
+			push	de
+			and	d
+			ld	a,e
+			or	a
+			and	b
+			and	h
+			nop (2x) *
+			call	m,L7bb3
+			jp	po,L55d5
+			ld	sp,957bh
+			sbc	a,a
+			ld	c,a
+			ld	c,a
+			ld	e,d
+			ld	b,d
+			ld	a,h
+			sbc	a,(hl)
+			adc	a,e
+			ld	d,c
+			nop
+			ld	b,l
+			ld	l,d
+			nop (2x) *
+			push	bc
+			ld	(hl),h
+			xor	h
+			adc	a,c
+			or	b3h
+			nop (2x) *
+			push	bc
+			and	l
+			rst	28h
+			ld	b,h
+			ld	l,b
+			ld	(5a50h),a
+			jr	L616e
+			db	5fh,7eh,70h,e9h,e4h,ffh,11h,5fh
+			db	dch,43h,bdh,26h,0bh,e6h,f8h,68h
+			db	57h,44h,01h,94h,a5h,a0h,afh,6bh
+			db	f4h,2fh,6ch,dbh,1dh,ddh,6ch,29h
+			db	09h,60h,09h,d2h,ddh,39h,8eh,68h
+			db	43h,c0h,3bh,f7h,a4h,9eh,37h,50h
+			db	3dh,7fh,82h,82h,4ch,fah,00h,19h
+			db	b2h,6fh,72h,8fh,85h,0dh,8fh,54h
+			db	99h,1ah,12h,2ah,08h,09h,42h,e8h
+			db	e1h,99h,85h,a4h,beh,43h,adh,23h
+			db	c5h,8fh,14h,e7h,b3h,5fh,bah,b5h
+			db	ffh,57h,a0h,57h,f6h,e0h,b5h,4bh
+			db	06h,8dh,0ah,fch,41h,7bh,1ch,c9h
+			db	96h,e1h,4ch,02h,4bh,f9h
+			ld	l,b
+			sbc	a,(hl)
+			pop	af
+			exx
+			add	a,a9h
+			rst	10h
+			ret	p
+			cp	d
+			rst	28h
+			rst	10h
+			sbc	a,b
+			cp	b
+			add	a,h
+			sub	e
+			ld	(c67eh),a
+			sbc	a,h
+			ld	h,e
+			scf
+			ld	(hl),a
+			xor	5ah
+			xor	65h
+			ld	l,l
+			jp	nz,Ldbd5
+			jr	c,L62c4
+			ret
+			db	fdh,87h,abh,d0h,67h,dah,21h,45h
+			db	16h,70h,34h,13h,2ah,9ch,7fh,81h
+			db	f5h,f9h,4ch,21h,73h,d3h,3ah,59h
+			db	adh,fdh,9fh,4eh,68h,8fh,d6h
+			xor	e
+			ld	b,h
+			jr	L62f1
+			db	b2h,3ah,34h,e9h,74h,c0h,cdh,22h
+			db	42h,97h,42h,3ah,2ch,8fh,07h,48h
+			db	d2h,75h,d8h,33h,84h,e5h,81h,3ah
+			db	35h,54h,31h,4eh,9ah,f1h,5dh,53h
+			db	23h,d5h,dah,39h,64h,bah,46h,83h
+			db	d9h,5ch,f8h
+			pop	hl
+			pop	bc
+			cp	h
+			ld	h,10h
+			adc	a,d8h
+			or	bch
+			call	nz,L65cc
+			ld	e,6dh
+			ld	l,l
+			ini
+			adc	a,a
+			push	hl
+			ld	e,a
+			and	1bh
+			ld	h,l
+			rlca
+			ld	a,(49afh)
+			ex	de,hl
+			or	b
+			and	(hl)
+			dec	c
+			add	a,b
+			rst	38h
+			ld	d,h
+			adc	a,b
+			sub	(hl)
+			ld	d,e
+			ld	h,(hl)
+			dec	l
+			rst	18h
+			jr	c,L62f9
+			adc	a,b
+			xor	a
+			ld	a,b
+			adc	a,e
+			add	a,(hl)
+			ld	h,a
+			call	pe,L380a
+			ld	c,(ix + a6h)
+			ld	a,l
+			and	e
+			inc	e
+			ret	nc
+			rst	28h
+			and	(hl)
+			or	a
+			ex	(sp),hl
+			sub	h
+			sub	b
+			jp	L605e
+			db	42h,84h,65h,60h,06h,53h,fah,fdh
+			ld	d,d
+			jr	nc,L62cf
+			xor	(hl)
+			inc	bc
+			nop
+			jr	nz,L632d
+			ld	c,l
+			xor	b
+			ld	(2a91h),hl
+			rrca
+			sub	(hl)
+			rlca
+			ld	e,l
+			dec	l
+			call	nz,L4d9d
+			jr	nz,L6345
+			xor	c
+			cp	19h
+			ld	b,d
+			halt
+			rst	00h
+			dec	d
+			rrca
+			cp	a
+			xor	d
+			ld	h,e
+			and	fdh
+			ld	b,c
+			sbc	a,c
+			ld	b,a
+			ret	po
+			ret	pe
+			jr	nc,L62dd
+			jp	pe,Ld4ce
+			jp	m,L67c2
+			ld	d,d
+			cp	(hl)
+			or	c
+			jr	L637f
+			inc	l
+			ld	(hl),d
+			ld	a,0ah
+			rst	00h
+			jp	c,La244
+			di
+			or	h
+			ret	pe
+			ld	a,l
+			ld	l,l
+			ld	h,fdh
+			call	c,L9a53
+			adc	a,d
+			push	af
+			xor	h
+			cp	h
+			xor	h
+			sub	59h
+			adc	a,4dh
+			xor	b
+			sub	e
+			sbc	a,(hl)
+			inc	hl
+			ld	sp,hl
+			ld	b,h
+			ld	c,49h
+			cp	l
+			ld	(hl),d
+			rst	30h
+			ld	h,d
+			res	2,h
+			ld	e,e
+			add	a,a
+			rst	00h
+			jp	pe,La895
+			ld	l,b
+			ld	d,e
+			ld	d,l
+			sub	e
+			ret	nz
+			ex	af,af'
+			ld	d,h
+			jr	nz,L63e2
+			jp	z,L77ff
+			add	hl,de
+			and	cah
+			ld	h,60h
+			call	z,Lf1f1
+			sbc	a,c
+			adc	a,d
+			ld	b,b
+			nop (2x) *
+			inc	bc
+			or	e
+			inc	e
+			and	b
+			jr	L63ef
+			db	9eh,31h,18h,7eh,78h,2eh,72h,fah
+			db	b5h,49h,f2h,aeh,4ch,fah,92h,deh
+			db	ech,f5h,16h,e7h,0dh,60h,57h,84h
+			db	b6h,b6h,3dh,a2h,1dh,c7h,32h,afh
+			db	97h,a0h,12h,f8h,b7h,b4h,64h,c0h
+			db	e4h,74h
+			sbc	a,c
+			add	a,e
+			cp	d
+			ld	h,(hl)
+			and	h
+			dec	b
+			ld	d,c
+			jp	po,L691a
+			ld	de,fe68h
+			ld	(bc),a
+			xor	a
+			sub	a
+			ld	d,e
+			ei
+			rra
+			ld	(de),a
+			ld	l,a
+			ret	c
+			call	nc,Lddda
+			add	a,h
+			ld	de,1bc4h
+			ld	(hl),b
+			or	c7h
+			call	m,L39b7
+			dec	b
+			ret	p
+			add	hl,hl
+			call	Ld4ec
+			push	hl
+			ld	b,l
+			ld	d,c
+			jp	nc,L1ada
+			rst	20h
+			rla
+			ld	b,87h
+			rst	38h
+			rst	18h
+			ret	c
+			sbc	a,c
+			scf
+			jp	po,Lfefc
+			ld	h,(hl)
+			rst	20h
+			dec	e
+			call	m,Lf201
+			inc	bc
+			ld	h,42h
+			ld	a,e
+			add	a,e
+			ret	p
+			cp	a
+			ret	p
+			add	a,l
+			jp	po,Le767
+			jp	nz,L4494
+			ld	l,c
+			ld	c,a
+			ld	l,c
+			cp	d
+			ld	(hl),l
+			ld	e,b
+			ei
+			ld	l,d
+			push	hl
+			ld	e,b
+			ret	p
+			jr	nz,L63c9
+			add	a,h
+			and	d
+			call	p,Lb3c3
+			or	a
+			adc	a,l
+			ret	nz
+			and	(hl)
+			ld	a,c
+			sbc	a,a
+			add	hl,sp
+			add	hl,bc
+			ld	h,b
+			ld	e,(hl)
+			ex	de,hl
+			or	b2h
+			ld	ixl,e *
+			ld	l,a
+			ld	b,(hl)
+			sub	b
+			ld	b,l
+			adc	a,c
+			ld	l,a
+			add	hl,de
+			call	z,Lccc4
+			ret
+			db	39h,95h,25h,0fh,32h,2ch,5bh,3bh
+			db	2bh,0bh,eah,6eh,e8h,e0h,04h,3bh
+			db	0ah,dah,abh,25h,c9h,c5h,a6h,07h
+			db	90h,7fh,00h,80h,11h,27h,74h,bah
+			db	a7h,f8h,deh,b1h,81h,2eh,19h,f1h
+			db	f6h,84h,4dh,d1h,72h,f7h,9dh,91h
+			db	deh,50h,f2h,a4h,afh,2dh,55h,55h
+			db	74h,1eh,5fh,e3h,3ch,c1h,c1h,b6h
+			db	adh,9fh,40h,f5h,d7h,e7h,68h,1dh
+			db	26h,e2h,f6h,56h,91h,d0h,b3h,64h
+			db	69h,42h,15h,d3h,34h,77h,8dh,a5h
+			inc	a
+			ld	c,h
+			cp	a
+			sbc	a,b
+			exx
+			ld	d,h
+			ld	d,l
+			cp	e
+			inc	hl
+			ld	b,h
+			cp	h
+			ld	(e419h),a
+			ld	(hl),c
+			ld	l,l
+			ei
+			sub	d
+			sbc	a,e
+			xor	c
+			dec	(hl)
+			nop
+			xor	88h
+			rst	28h
+			ld	c,l
+			sub	e
+			rla
+			ld	a,(de)
+			or	b
+			dec	a
+			and	4eh
+			add	a,a
+			rrca
+			ld	b,c
+			call	po,Lcb15
+			inc	bc
+			ld	d,l
+			sub	(hl)
+			sbc	a,d
+			ld	(bc),a
+			ld	hl,3d87h
+			ld	l,d
+			push	de
+			cp	c
+			inc	b
+			ld	(de),a
+			add	a,e2h
+			ld	c,b
+			inc	c
+			jp	p,Le639
+			ld	a,h
+			djnz	L64c0
+			call	p,Le58c
+			call	m,L3328
+			rst	00h
+			dec	c
+			ld	d,h
+			ld	l,c
+			halt
+			ld	b,h
+			ret	m
+			and	19h
+			sub	b
+			nop (2x) *
+			xor	83h
+			add	a,(hl)
+			ld	d,b
+			sbc	a,(hl)
+			or	(hl)
+			ld	(hl),l
+			add	a,l
+			add	hl,hl
+			ld	a,d
+			pop	af
+			xor	a
+			adc	a,c
+			ld	bc,71fdh
+			sub	(hl)
+			jp	c,Lf62b
+			and	b
+			out	(2fh),a
+			or	c
+			ld	a,34h
+			dec	de
+			jr	nc,L6494
+			ld	d,f6h
+			ld	h,b
+			cpl
+			sub	b
+			ld	(hl),51h
+			ld	c,b
+			jp	nz,L1fcb
+			rrca
+			cp	e
+			call	m,L78a8
+			dec	(hl)
+			call	po,Lcd6c
+			rra
+			xor	h
+			call	p,Lc5b5
+			or	l
+			ld	l,63h
+			ld	e,d6h
+			or	d
+			xor	e
+			jp	nc,Laa32
+			ld	l,a
+			dec	(hl)
+			ld	c,c
+			dec	c
+			inc	de
+			ld	h,b
+			rla
+			add	a,b
+			ld	b,9ch
+			ld	b,(hl)
+			or	a
+			ld	h,b
+			pop	bc
+			ld	e,h
+			sbc	a,h
+			sbc	a,h
+			ex	af,af'
+			adc	a,h
+			inc	de
+			ld	a,b
+			rst	08h
+			ld	a,e
+			adc	a,b
+			ld	a,(bc)
+			jp	pe,L68b7
+			call	po,L3369
+			inc	hl
+			xor	b
+			push	de
+			rst	38h
+			ld	hl,98f8h
+			dec	l
+			dec	b
+			sbc	a,c
+			ld	c,e
+			add	hl,bc
+			inc	d
+			push	hl
+			ret	po
+			ld	a,(hl)
+			jr	c,L64e1
+			ex	de,hl
+			ld	b,d
+			ld	h,h
+			ld	h,h
+			adc	a,d
+			ld	b,a
+			call	z,L6ba9
+			adc	a,h
+			ld	h,h
+			or	a
+			adc	a,c
+			inc	e
+			adc	a,c5h
+			add	a,(hl)
+			ld	bc,ed03h
+			ld	(f93fh),hl
+			sub	e
+			and	h
+			ret	pe
+			inc	sp
+			ld	h,a
+			cp	e
+			ld	h,e
+			ld	(dc6ah),a
+			call	z,L70b0
+			ld	l,a
+			or	d
+			adc	a,a
+			dec	h
+			rst	18h
+			sbc	a,(hl)
+			scf
+			inc	sp
+			or	d
+			adc	a,l
+			ret	nc
+			call	nc,L4247
+			jp	p,Lb6e9
+			ld	l,l
+			add	hl,hl
+			and	c
+			call	L5310
+			add	a,(hl)
+			call	nc,Lffaf
+			add	a,e
+			ld	h,e
+			rlca
+			sub	7eh
+			ld	a,d
+			ld	b,(hl)
+			add	a,h
+			sub	l
+			cp	b
+			jp	L906b
+			ret	pe
+			and	a
+			ld	d,d
+			ld	h,h
+			ld	b,h
+			and	d
+			ld	c,a
+			ld	sp,hl
+			djnz	L65da
+			add	a,c
+			ld	(bc),a
+			or	l
+			sub	b
+			ld	(hl),h
+			sbc	a,e
+			ei
+			or	a
+			ld	h,02h
+			jp	po,L34c9
+			or	34h
+			ld	(hl),c
+			add	hl,bc
+			ld	hl,(9b28h)
+			ld	l,d4h
+			xor	d
+			dec	b
+			ld	(hl),c
+			jr	nz,L6549
+			ld	h,a
+			ld	d,a
+			sll	d
+			jr	L65ab
+			db	8fh,97h,2fh,9fh
+			add	hl,sp
+			ld	d,d
+			cp	(hl)
+			ld	(hl),c
+			call	L136c
+			ld	bc,b0feh
+			ld	bc,d2f2h
+			ld	a,(8357h)
+			nop (2x) *
+			jr	c,L6655
+			adc	a,b
+			ld	d,l
+			scf
+			ld	a,(hl)
+			ld	c,c
+			ld	e,d
+			rst	20h
+			ld	(hl),c
+			sub	c
+			dec	sp
+			ld	c,c
+			sub	d
+			ex	de,hl
+			ld	e,e
+			ld	h,h
+			jp	c,L047c
+			ld	l,18h
+			di
+			rst	28h
+			ld	(8928h),hl
+			ld	d,(hl)
+			ld	h,2ah
+			ld	c,c
+			ld	h,(hl)
+			ld	b,(hl)
+			ld	a,c
+			jr	z,L659e
+			daa
+			sub	88h
+			dec	a
+			ld	e,c
+			jr	L665c
+			db	79h,d6h,34h,afh,37h,bah,57h,02h
+			db	32h,7fh,49h,6bh,c3h,d5h,50h,4dh
+			db	49h,8bh,afh,e3h,7fh,d1h,88h,93h
+			db	efh,d7h,d1h,feh,44h,02h,fbh,92h
+			db	b5h,e7h
+			ccf
+			ret	p
+			inc	l
+			dec	h
+			ret	p
+			add	hl,hl
+			dec	e
+			sbc	a,l
+			xor	edh
+			ld	a,c
+			daa
+			out	(b1h),a
+			ld	h,c
+			call	L0cb3
+			dec	bc
+			xor	h
+			rst	00h
+			ld	a,h
+			ld	b,d
+			ld	b,e
+			ld	h,l
+			push	af
+			ld	l,(hl)
+			daa
+			ld	hl,(6246h)
+			adc	a,l
+			ret	nc
+			ld	e,b
+			ld	(4da3h),hl
+			sbc	a,h
+			ld	e,c
+			xor	h
+			and	d4h
+			add	a,b
+			ret
+			db	dfh,6eh,cdh,27h,b1h,e4h
+			ld	hl,a0b4h
+			push	de
+			or	e
+			jp	z,L7682
+			push	hl
+			cp	(hl)
+			ret	pe
+			ld	de,eac0h
+			djnz	L66c3
+			ret	c
+			inc	d
+			and	b
+			sub	d
+			xor	d
+			and	h
+			ld	(f781h),a
+			ld	l,(hl)
+			ld	h,(hl)
+			rst	20h
+			ld	h,d
+			ld	l,c
+			sbc	a,3dh
+			push	hl
+			ld	d,d
+			ld	d,a
+			ld	hl,(9662h)
+			cp	29h
+			jp	p,L18ed
+			pop	de
+			adc	a,(hl)
+			and	a
+			push	hl
+			pop	bc
+			ld	(bc),a
+			sbc	a,b
+			ld	d,beh
+			ld	e,h
+			call	po,L87cc
+			ld	(hl),h
+			nop (2x) *
+			rst	10h
+			inc	a
+			ld	(hl),b
+			and	d
+			add	hl,sp
+			cp	d
+			cp	(hl)
+			xor	b
+			ld	l,l
+			dec	b
+			ld	(hl),d
+			sub	f8h
+			ld	l,a
+			add	hl,bc
+			cp	b
+			ld	c,a
+			ld	a,(hl)
+			ld	e,(hl)
+			ld	(hl),d
+			cp	a3h
+			dec	l
+			call	nz,L4ffe
+			dec	e
+			ld	(de),a
+			ld	(hl),a
+			call	z,L4d47
+			jr	z,L66b6
+			add	hl,sp
+			ld	c,l
+			ld	(hl),5eh
+			ld	l,2bh
+			call	nz,L4d8a
+			ld	a,(bc)
+			jr	nc,L670d
+			exx
+			call	po,Ldafd
+			pop	de
+			cpl
+			ld	d,d
+			in	a,(11h)
+			ld	e,h
+			add	a,c
+			ld	a,e
+			inc	sp
+			jr	nc,L6654
+			cp	(hl)
+			push	hl
+			jp	c,L464b
+			djnz	L6740
+			sub	b
+			cp	e
+			ld	l,e
+			ld	e,c
+			ld	(hl),02h
+			ld	(de),a
+			rrca
+			cp	d
+			add	a,f9h
+			inc	h
+			xor	(hl)
+			xor	b
+			ld	b,e
+			set	5,e
+			ld	c,(hl)
+			jr	nc,L6718
+			xor	d
+			dec	sp
+			nop
+			ld	(ix + b1h),l
+			adc	a,h
+			ld	l,a
+			sub	d
+			ret	po
+			add	hl,hl
+			ret	c
+			or	h
+			pop	af
+			inc	bc
+			ld	c,b
+			ret	nz
+			pop	de
+			ld	a,e
+			ld	h,a
+			ret	nc
+			ld	l,d
+			dec	d
+			add	a,d
+			ld	b,d
+			ld	h,b
+			call	p,L80e5
+			add	hl,sp
+			ld	hl,49c3h
+			ld	d,b
+			add	a,a
+			ld	a,c
+			sbc	a,b
+			add	a,a
+			sbc	a,h
+			xor	h
+			add	hl,bc
+			nop
+			inc	l
+			jr	c,L6729
+			and	(hl)
+			jp	nc,L5ab2
+			call	c,Lb8ac
+			add	a,l
+			jp	pe,L6b74
+			jr	nc,L66f5
+			jp	(hl)
+			out	(86h),a
+			cp	d
+			sub	d
+			ld	b,c
+			ld	e,c
+			inc	de
+			ld	a,(de)
+			rlca
+			ld	a,d
+			ld	(873bh),a
+			push	hl
+			cp	a
+			ld	d,(hl)
+			ld	h,c
+			jp	nc,L201a
+			ld	a,l
+			ld	d,b
+			sbc	a,l
+			add	hl,de
+			xor	e
+			djnz	L6720
+			inc	e
+			xor	(hl)
+			ld	h,h
+			and	l
+			dec	c
+			inc	bc
+			rst	38h
+			ccf
+			dec	bc
+			inc	(hl)
+			inc	bc
+			ld	h,d
+			ld	c,h
+			ld	hl,(11b0h)
+			ld	a,(bc)
+			ccf
+			adc	a,l
+			ld	(194ch),hl
+			ex	(sp),hl
+			halt
+			ld	(hl),d
+			dec	c
+			exx
+			push	de
+			ld	(hl),e
+			rst	38h
+			ld	b,(hl)
+			dec	c
+			ld	a,e
+			ccf
+			sub	e
+			ret	nz
+			adc	a,h
+			ret	nz
+			and	c
+			adc	a,(hl)
+			adc	a,b
+			ld	b,c
+			ld	hl,e379h
+			ei
+			ld	c,a
+			add	a,b
+			ld	c,b
+			dec	l
+			and	a
+			cp	a
+			ld	d,a
+			ld	(hl),d6h
+			in	a,(33h)
+			inc	sp
+			sub	l
+			cp	e
+			call	z,L35f6
+			call	c,L4e59
+			and	b
+			add	a,h
+			add	a,d
+			dec	h
+			and	e
+			xor	49h
+			ld	e,d
+			ld	h,d7h
+			dec	sp
+			cp	a
+			adc	a,d
+			ld	d,(hl)
+			jr	L67f9
+			db	65h,87h,beh,42h
+			sub	b
+			inc	c
+			dec	a
+			inc	hl
+			ld	sp,181ch
+			rst	00h
+			and	a
+			nop (2x) *
+			ld	e,(hl)
+			sbc	a,a
+			or	(hl)
+			ld	a,c
+			ld	l,e
+			inc	l
+			ei
+			ld	e,a
+			adc	a,l
+			ld	d,c
+			adc	a,e
+			call	nc,L8f97
+			ld	l,b
+			ld	d,3eh
+			ld	e,h
+			push	hl
+			ld	d,(hl)
+			rlca
+			jp	p,Lc5c0
+			and	h
+			res	1,h
+			ld	(hl),b
+			ld	de,fa7bh
+			rra
+			scf
+			ld	l,h
+			call	m,L5d35
+			ld	(hl),10h
+			nop
+			ld	d,d
+			call	m,L0a8c
+			inc	a
+			adc	a,d
+			rst	00h
+			cp	h
+			ld	h,(hl)
+			ld	d,11h
+			ld	l,h
+			or	l
+			push	bc
+			rla
+			and	e
+			ld	(49c6h),a
+			dec	b
+			ld	a,d
+			ld	l,l
+			inc	(hl)
+			ld	c,e
+			ld	(hl),b
+			dec	sp
+			dec	(hl)
+			inc	c
+			adc	a,c
+			xor	l
+			dec	l
+			or	d
+			ld	e,ixh *
+			xor	c
+			inc	de
+			dec	sp
+			ld	c,l
+			dec	c
+			jp	z,Ldeda
+			or	(hl)
+			xor	c
+			rra
+			rst	00h
+			cp	(hl)
+			ret
+			db	05h,cch,00h,31h,07h,cbh,2fh,08h
+			db	ebh,ddh,5bh,98h,51h,59h,61h,dch
+			db	1dh,cbh,c0h,b5h,b3h,dbh,15h,52h
+			db	21h,14h,41h
+			push	bc
+			ret
+			db	0fh,d5h,78h
+			dec	b
+			call	p,Ld3f0
+			inc	d
+			nop (2x) *
+			inc	b
+			ld	l,h
+			sbc	a,l
+			inc	hl
+			or	e
+			call	z,Lc52d
+			ld	h,l
+			dec	hl
+			xor	h
+			ld	b,h
+			ld	(8a67h),a
+			sub	h
+			adc	a,a
+			daa
+			xor	9eh
+			out	(c),d
+			ld	a,(8dabh)
+			ret	c
+			xor	b
+			or	b
+			ld	(hl),d
+			ld	h,d
+			ld	d,l
+			ld	b,b
+			sub	h
+			ld	(hl),l
+			or	b
+			push	hl
+			ld	a,e
+			ld	e,l
+			and	c
+			sub	b
+			ld	b,d
+			ld	c,02h
+			ld	c,l
+			rst	30h
+			ld	(f351h),hl
+			ex	af,af'
+			ld	a,(hl)
+			cp	(hl)
+			ld	e,a
+			jp	nc,L7aa1
+			exx
+			ld	a,(hl)
+			xor	e
+			xor	c
+			ld	h,c
+			cp	b
+			push	de
+			ex	(sp),hl
+			ld	a,(de)
+			adc	a,e
+			ld	d,l
+			ld	a,e
+			inc	a
+			dec	a
+			inc	a
+			jp	nz,Lde70
+			push	af
+			ld	d,l
+			sub	b
+			ld	l,d
+			jp	z,Lf5ad
+			and	d
+			push	af
+			ld	a,a
+			ld	d,e
+			ccf
+			dec	b
+			rla
+			or	b
+			ld	d,h
+			rst	18h
+			sbc	a,b
+			xor	e
+			ld	a,(de)
+			jp	nc,L2cd0
+			ld	de,9836h
+			add	hl,de
+			and	4bh
+			call	nc,L2410
+			ld	(hl),c
+			ld	(de),a
+			sbc	a,l
+			jr	z,L6845
+			ld	e,d
+			ld	b,h
+			ld	d,(hl)
+			xor	dfh
+			ex	af,af'
+			ld	h,(hl)
+			ld	l,e
+			and	a
+			ld	c,c
+			sub	d
+			jr	c,L6860
+			ret	c
+			add	a,l
+			ld	d,a
+			adc	a,h
+			or	32h
+			adc	a,e
+			ld	c,(hl)
+			and	76h
+			ex	af,af'
+			ld	h,b
+			ld	e,e6h
+			sub	c
+			sub	d
+			or	b
+			sub	a4h
+			or	h
+			ld	d,c
+			ld	(hl),a
+			ld	d,l
+			ret	z
+			jr	z,L68d9
+			rst	18h
+			ld	l,l
+			ret	c
+			inc	d
+			res	7,c
+			ld	hl,4b8eh
+			add	a,c
+			adc	a,b
+			rst	00h
+			xor	l
+			inc	h
+			ld	(de),a
+			call	z,Lb91c
+			nop
+			call	p,L8fb5
+			sbc	a,a4h
+			jp	z,L43c0
+			cpl
+			ld	e,b
+			and	d
+			dec	hl
+			and	d
+			ld	e,a
+			call	c,La41f
+			or	a
+			sub	f9h
+			ld	(hl),e
+			push	hl
+			ex	af,af'
+			push	af
+			ld	d,(hl)
+			ld	a,(2460h)
+			ld	(bc),a
+			dec	c
+			inc	e
+			ld	l,c
+			call	m,La85e
+			ld	a,e
+			push	hl
+			nop (2x) *
+			sbc	a,a
+			ld	b,3dh
+			ei
+			ret	nz
+			cp	cah
+			rst	18h
+			jp	nc,L5a61
+			xor	d
+			dec	c
+			dec	d
+			add	hl,bc
+			ld	c,b
+			ld	c,83h
+			ld	c,b
+			dec	a
+			ld	(hl),l
+			inc	b
+			push	af
+			xor	h
+			adc	a,(hl)
+			ld	(hl),l
+			add	hl,de
+			nop (2x) *
+			ld	d,c
+			rst	00h
+			ld	(bc),a
+			and	h
+			ex	de,hl
+			ex	(sp),hl
+			dec	sp
+			ld	(hl),d
+			ld	d,c
+			cp	a
+			sub	e
+			ld	(hl),h
+			exx
+			sub	e
+			ld	b,e
+			add	a,c
+			ld	(hl),d
+			ld	(hl),e
+			push	hl
+			nop (2x) *
+			push	de
+			ex	de,hl
+			inc	b
+			call	p,L1c5c
+			ld	c,h
+			and	l
+			cp	a
+			ret	c
+			adc	a,a
+			add	a,(hl)
+			or	e
+			sub	b
+			pop	bc
+			cp	a9h
+			adc	a,(hl)
+			jp	nz,Lc3fe
+			inc	bc
+			cp	c
+			sub	15h
+			inc	de
+			ld	a,(de)
+			ld	d,c
+			rst	30h
+			ld	d,h
+			or	l
+			sbc	a,e
+			ld	a,a
+			ld	l,efh
+			ld	e,e
+			out	(26h),a
+			ld	a,(197ch)
+			jr	z,L69bc
+			ld	(hl),a
+			ret	m
+			adc	a,d
+			ld	h,b
+			sbc	a,(hl)
+			inc	(hl)
+			sbc	a,h
+			or	(hl)
+			jp	c,Lca3c
+			cp	d
+			rst	20h
+			inc	d
+			ld	d,l
+			add	a,45h
+			dec	d
+			adc	a,l
+			ld	e,e
+			ld	a,5ch
+			ret	nz
+			nop (2x) *
+			inc	(hl)
+			dec	d
+			ld	h,e
+			rrca
+			and	d
+			add	hl,sp
+			sub	a
+			inc	h
+			ld	de,b484h
+			or	b
+			add	a,h
+			ld	(bc),a
+			xor	d
+			and	f0h
+			call	c,La8e0
+			ld	h,d
+			ld	b,a
+			ld	d,l
+			ld	d,d
+			sub	a
+			jp	(hl)
+			db	49h,6fh,dbh,f2h,35h,f4h,82h,59h
+			db	0eh,99h,fch,47h,10h,5dh,e1h,d6h
+			db	1ch,59h,59h,63h,e2h,f4h,eeh,7ah
+			db	2ah,e4h,04h,6ah,74h,85h,58h,3eh
+			db	a1h,aeh,a7h,f0h,93h,f7h,dch,60h
+			db	a6h,7fh,e9h,50h,dbh,26h,b3h,34h
+			db	d3h,7bh,42h,8ch,97h,e7h,02h,0dh
+			db	cch,f1h,8bh
+			pop	bc
+			rra
+			ld	d,h
+			ld	d,b
+			jp	(hl)
+			db	59h,bch,58h,a8h,52h,95h,b9h,e4h
+			db	00h,a3h,9bh,c7h,74h,a2h,d4h,86h
+			db	36h,31h,bbh,7fh,97h,87h,c6h,28h
+			db	20h,f1h,1ch,ffh,d8h,25h,bch,c7h
+			db	63h,9bh,01h,6dh,32h,1dh,b0h,0ah
+			db	bch,26h,d0h,7ch,a9h,57h,60h,dbh
+			db	1eh,59h,47h,00h,50h,66h,08h,f2h
+			db	f6h,5ah,22h,9ch,77h,3ch,bbh,b7h
+			db	f5h,c1h,5ah,9fh,29h,cah,9ah,0ch
+			ld	d,c
+			ret	p
+			xor	l
+			call	L6c70
+			and	1ch
+			ld	b,d
+			and	e
+			ret	z
+			cp	(hl)
+			ld	h,c
+			ld	d,(hl)
+			ld	d,c
+			cp	(hl)
+			cpl
+			ret	pe
+			ld	h,h
+			ld	hl,(d97eh)
+			ret	p
+			dec	(hl)
+			dec	l
+			jr	nc,L6a1a
+			sbc	a,h
+			ld	e,d
+			or	e
+			cp	d
+			ld	sp,hl
+			dec	bc
+			di
+			add	a,e
+			and	a
+			ld	c,b
+			nop (2x) *
+			ld	e,a
+			ret	z
+			ret	po
+			ld	c,b9h
+			dec	d
+			ld	b,b
+			ld	e,c
+			sub	c
+			or	h
+			push	hl
+			dec	d
+			ld	e,bfh
+			xor	(hl)
+			and	d
+			and	h
+			jp	nz,Lc81b
+			and	a
+			ld	sp,23f3h
+			dec	de
+			ld	e,e
+			ld	l,36h
+			ld	c,b
+			ld	l,86h
+			dec	l
+			call	nc,L081e
+			ld	d,abh
+			nop (2x) *
+			ld	d,a5h
+			dec	d
+			and	c
+			ld	d,d
+			jr	nc,L6a09
+			sbc	a,ixh *
+			dec	e
+			and	d
+			xor	l
+			rst	18h
+			ld	a,(de)
+			halt
+			djnz	L6a7c
+			ld	b,e
+			xor	(hl)
+			and	c
+			ret	p
+			adc	a,7fh
+			xor	d
+			ld	a,(bc)
+			ld	h,h
+			dec	a
+			rla
+			sbc	a,b
+			ex	de,hl
+			dec	a
+			jp	nc,L6929
+			or	d
+			ld	h,c
+			rst	28h
+			ld	h,(hl)
+			jp	c,L2939
+			add	a,a
+			sub	c
+			inc	(hl)
+			ld	c,d
+			call	p,Lde1a
+			ld	d,l
+			jp	nc,L2ef9
+			cp	(hl)
+			ld	sp,hl
+			sub	a
+			adc	a,c
+			ld	d,c
+			ld	d,a
+			xor	13h
+			ld	d,d8h
+			add	a,(hl)
+			rst	28h
+			nop (2x) *
+			ld	a,a
+			ld	b,e
+			call	m,L3284
+			sbc	a,d
+			add	hl,de
+			ld	(34fah),hl
+			add	a,c
+			dec	hl
+			rst	08h
+			xor	d
+			add	a,d
+			sbc	a,(hl)
+			ld	b,b
+			rla
+			call	p,Ld6c5
+			call	m,L4a24
+			ret	pe
+			ld	h,l
+			inc	hl
+			ccf
+			ld	d,c5h
+			and	h
+			add	hl,hl
+			ld	l,c8h
+			ld	(hl),a
+			ld	h,b
+			ld	b,b
+			push	de
+			cp	(hl)
+			add	a,0fh
+			push	hl
+			add	a,d
+			jp	z,L9cae
+			ld	b,h
+			ld	h,(hl)
+			ld	h,l
+			set	5,(hl)
+			or	(hl)
+			add	a,h
+			add	a,03h
+			jr	L6b39
+			db	4bh,dch,95h,d7h,ebh,90h,b3h,9ah
+			db	a1h,b5h,e9h,24h,d4h,d4h,a2h,5ah
+			db	bah,e8h,37h,22h,27h,b1h,51h,6eh
+			db	8ch,40h,ffh,b8h,eeh,ach,7ah,84h
+			db	37h,52h,1bh,90h,c3h,36h,feh,74h
+			db	13h,1ah,b6h,20h,0dh,02h,2dh,81h
+			db	74h,e4h,98h,48h,b5h,c7h,bah,bah
+			db	28h,16h,a9h,4ah,bbh,92h,edh,71h
+			db	81h
+			adc	a,h
+			inc	h
+			cp	l
+			or	d
+			dec	e
+			dec	hl
+			add	a,a
+			or	a
+			jr	L6b5f
+			db	95h,b4h,48h,17h,d2h,bbh,24h,c4h
+			db	d6h,64h,deh,ceh,abh,bch,aah,45h
+			db	68h,eeh,4dh,f6h,4ch,c7h,96h,0ch
+			db	29h,89h,02h,16h,a2h,b4h
+			jp	m,L25cf
+			out	(d3h),a
+			cp	c
+			dec	de
+			ld	h,e
+			adc	a,d
+			dec	a
+			sub	c
+			ld	(hl),b
+			ld	a,l
+			jr	c,L6ba5
+			ld	l,b
+			cpl
+			inc	c
+			or	e
+			xor	e
+			jr	z,L6b6a
+			sbc	a,27h
+			ld	e,b
+			and	b
+			ld	h,(hl)
+			ld	d,c
+			xor	h
+			daa
+			halt
+			sub	d
+			and	(hl)
+			rlca
+			ex	(sp),hl
+			ld	e,l
+			and	e
+			ld	a,l
+			dec	de
+			di
+			ld	hl,(0d24h)
+			halt
+			ld	h,e
+			or	(hl)
+			and	e
+			adc	a,e
+			pop	af
+			adc	a,h
+			and	(hl)
+			ld	bc,7669h
+			ret	po
+			or	b
+			and	l
+			ld	(3974h),hl
+			xor	(hl)
+			inc	(hl)
+			ld	c,l
+			ld	b,e
+			ld	(hl),c
+			scf
+			and	l
+			ex	(sp),hl
+			ret	nc
+			add	a,ach
+			ld	c,0ch
+			ex	af,af'
+			inc	b
+			ld	a,h
+			ld	a,h
+			jr	z,L6c00
+			add	a,d
+			jp	pe,Lf3dd
+			ei
+			and	c
+			cp	(hl)
+			ld	c,h
+			sbc	a,h
+			ld	e,d
+			or	l
+			or	a
+			ld	d,a2h
+			cp	d
+			halt
+			or	h
+			ld	b,d
+			ld	c,(hl)
+			dec	sp
+			or	(hl)
+			sbc	a,h
+			rst	30h
+			sub	l
+			xor	l
+			ex	de,hl
+			ld	d,d
+			dec	d
+			xor	l
+			ld	d,(hl)
+			ld	a,l
+			add	hl,sp
+			ld	e,h
+			add	a,(hl)
+			rra
+			ld	l,e
+			jp	(hl)
+			db	7ch,f4h,94h,68h,6ah,85h,afh,54h
+			db	69h,89h,b0h,43h,70h,fch,50h,6ch
+			db	98h,8eh,80h,84h,7ah,cfh,d2h,cdh
+			db	6fh,f7h,09h,54h,e3h,d3h,9fh,46h
+			db	c1h,ffh,e7h,51h,a7h,c8h,6dh,f9h
+			db	7ch,7eh,10h,1dh,43h,67h,f1h,38h
+			db	f0h,5ah,b3h,55h,3eh,95h,beh,68h
+			db	67h,3fh,6dh,a6h,0ch,44h,04h,10h
+			db	6dh,49h
+			ld	(hl),e
+			xor	e
+			ld	sp,4909h
+			ld	b,b
+			ld	d,l
+			ld	e,b
+			xor	(hl)
+			ld	b,a
+			and	b
+			ld	(hl),e
+			ld	a,b
+			dec	b
+			rst	20h
+			ret	m
+			sub	b
+			and	e
+			call	z,L01fc
+			sub	b
+			ld	(hl),h
+			ld	d,c
+			call	p,L7da8
+			ld	de,6b76h
+			ld	l,d
+			ld	e,e
+			ld	(hl),e
+			cp	a
+			ld	d,e
+			ld	l,d
+			sub	h
+			jp	(hl)
+			db	89h,c4h,d5h,cah,58h,1eh,49h,75h
+			db	d6h,0ah,8ch,eeh,24h,c4h,86h,2ah
+			db	41h,21h,85h,98h,a4h,d9h,c5h,4ah
+			db	1bh,9ah,81h
+			ld	a,e
+			and	l
+			ld	d,23h
+			ret	po
+			xor	e
+			ld	a,(bc)
+			dec	e
+			ld	(hl),28h
+			ld	e,c
+			sbc	a,b
+			sbc	a,h
+			and	(hl)
+			ld	c,(hl)
+			ld	l,d6h
+			and	b7h
+			sbc	a,c
+			dec	l
+			ld	d,l
+			inc	de
+			ld	d,(hl)
+			adc	a,d
+			cp	(hl)
+			ld	b,0fh
+			ld	a,(de)
+			ld	d,e
+			inc	(hl)
+			call	pe,L1b2e
+			ld	e,d5h
+			ld	(de),a
+			jr	L6ccc
+			db	7ch,1dh,2ah,5ah,f4h,8bh,cbh
+			jr	nz,L6c30
+			in	a,(71h)
+			ld	l,a
+			dec	b
+			cp	a
+			xor	d
+			or	(hl)
+			ld	l,57h
+			ret
+			db	e6h,15h,2bh,e1h,f5h,52h
+			call	L2d15
+			sbc	a,c
+			ld	b,e
+			rst	00h
+			call	po,L3d7e
+			dec	a
+			ld	d,c
+			sbc	a,c
+			ld	(hl),d
+			ld	l,h
+			add	a,c
+			and	a
+			dec	de
+			pop	hl
+			jp	c,L854b
+			dec	hl
+			and	h
+			and	b
+			dec	h
+			ld	e,h
+			ld	c,h
+			ld	h,a
+			call	c,Ld004
+			and	h
+			ld	a,h
+			or	(hl)
+			sub	d
+			sbc	a,h
+			sub	c
+			ret	m
+			scf
+			push	bc
+			call	m,L0d07
+			adc	a,b
+			ld	d,a
+			ld	a,(0bf1h)
+			ld	hl,(2cf0h)
+			sbc	a,a
+			nop (2x) *
+			ld	e,d
+			ret	p
+			ld	(bc),a
+			ld	a,(hl)
+			cp	3bh
+			ld	(hl),a
+			adc	a,(hl)
+			ld	(hl),c
+			and	b
+			or	c
+			ld	e,b
+			ld	a,02h
+			jp	c,Lf50a
+			and	e
+			ld	e,b
+			ld	(hl),b
+			add	hl,sp
+			ld	c,a
+			inc	c
+			call	m,L1c77
+			and	e
+			ld	d,h
+			ld	c,l
+			jp	p,Lc60b
+			pop	de
+			ld	c,l
+			ld	e,e
+			push	bc
+			sbc	a,(hl)
+			ccf
+			xor	l
+			add	a,(hl)
+			and	(hl)
+			jr	c,L6ceb
+			ld	d,c
+			cp	e
+			ld	e,l
+			ld	c,d
+			inc	e
+			ld	b,b
+			ret	z
+			jr	nz,L6cb1
+			ld	h,bch
+			ld	l,(hl)
+			ld	h,c
+			or	c
+			scf
+			ret	nz
+			jp	L2878
+			db	4ch,a1h,f0h,b0h,9dh,22h,6ch,b7h
+			or	e
+			sub	(hl)
+			and	(hl)
+			ld	e,(hl)
+			ld	(hl),c
+			cp	93h
+			xor	h
+			add	a,e
+			ld	(de),a
+			rst	18h
+			push	af
+			jp	(hl)
+			db	abh,cdh,68h
+			ld	b,adh
+			inc	e
+			scf
+			ld	c,b
+			ld	h,b
+			or	c
+			or	d
+			adc	a,d
+			ld	c,d
+			dec	bc
+			add	a,a
+			ld	c,(hl)
+			sbc	a,c
+			ld	e,h
+			jp	m,L79f9
+			push	de
+			push	hl
+			and	c
+			ld	(hl),l
+			ld	a,e
+			call	p,Lc9cd
+			and	(hl)
+			ld	d,l
+			cp	d
+			daa
+			ld	a,93h
+			add	a,a
+			ld	e,l
+			ld	h,(hl)
+			add	hl,sp
+			ld	b,e
+			xor	e
+			pop	de
+			ex	de,hl
+			ld	hl,1118h
+			or	c
+			dec	bc
+			cpl
+			ld	a,3eh
+			ld	e,e
+			and	b
+			call	pe,L5a79
+			jp	c,L1acd
+			ld	a,c
+			ld	a,d
+			inc	b
+			xor	a
+			ld	(de),a
+			ld	l,h
+			jp	p,L78e8
+			ld	h,c
+			sub	(hl)
+			ld	(01c7h),hl
+			cp	e
+			call	L449f
+			ld	d,d
+			add	hl,bc
+			inc	e
+			rst	08h
+			ld	l,(hl)
+			ld	d,l
+			ld	a,(bc)
+			sbc	a,d
+			ld	(4231h),a
+			add	a,b
+			cp	e
+			ld	a,l
+			ret	p
+			inc	c
+			cp	e2h
+			ld	d,a
+			ld	a,(de)
+			xor	d
+			ld	l,b
+			ld	b,c
+			ret	p
+			dec	de
+			ld	l,e
+			sub	d
+			ld	d,6bh
+			ld	e,b
+			nop (2x) *
+			rla
+			sbc	a,(hl)
+			ld	a,e
+			jp	L9313
+			db	89h
+			and	h
+			rst	38h
+			ld	a,f4h
+			djnz	L6dba
+			ret	m
+			inc	iyl *
+			jp	z,Le061
+			cp	h
+			rst	10h
+			in	a,(a3h)
+			cpl
+			jp	po,L2c42
+			push	af
+			sub	99h
+			add	a,a
+			ld	l,cfh
+			and	d
+			ret	p
+			dec	de
+			or	e
+			out	(70h),a
+			sbc	a,(hl)
+			ld	(a04ah),a
+			dec	b
+			ret
+			db	73h,54h,87h,93h,64h,d3h,e5h,4dh
+			db	51h,75h,d6h,65h,a2h,2bh,dah,11h
+			db	fdh,cah,61h,0fh,8eh
+			dec	h
+			or	e
+			push	bc
+			and	d
+			ld	h,c
+			nop (2x) *
+			and	a
+			cp	e
+			sub	e
+			ld	b,h
+			pop	bc
+			push	de
+			cp	c
+			sub	a
+			add	hl,de
+			ld	d,l
+			ld	c,c
+			call	pe,L1e1c
+			di
+			ld	c,c
+			and	d
+			ld	d,h
+			ld	b,c
+			jp	po,L799d
+			ld	d,3dh
+			ret
+			db	bdh,b0h,9ah,54h,5fh,80h,b4h,a8h
+			ld	h,l
+			jp	c,L9316
+			ld	e,l
+			daa
+			jp	z,L72a2
+			add	a,c
+			nop
+			dec	l
+			xor	30h
+			ld	d,b
+			ld	a,d
+			ld	l,l
+			pop	af
+			add	a,c
+			jr	c,L6e57
+			nop (2x) *
+			jp	po,L8389
+			jp	L8067
+			db	8ch,96h,3bh,6fh,01h,8eh,ebh,73h
+			db	e7h,0fh,e9h,2ch,0eh,57h,0ah,a7h
+			db	ach,abh,a5h,9eh,2fh,b3h,8dh,98h
+			db	76h,29h,edh,4bh,51h,50h,d3h,2fh
+			db	1dh,f0h,e1h,f0h,edh,68h,e0h,49h
+			db	72h,22h,fch,a4h,3dh,c6h,d2h,27h
+			db	c0h,05h,94h,09h,33h,bch,1bh,fch
+			db	d8h,edh,ceh,edh,f3h,cdh,a4h,4fh
+			db	e3h,c4h,16h,c4h,6fh,5eh,81h,c8h
+			db	0fh,ffh,0eh,e7h,44h,51h,e0h,41h
+			db	8ah,b7h,bdh,fch,61h,f3h,c3h,8dh
+			db	7dh,a3h,c0h,58h,30h,bch,d5h,4fh
+			db	94h,fah,5bh,0ah,c1h,91h,4ch,c8h
+			db	c9h,f3h,3ah,58h,c0h,40h
+			ld	a,l
+			sbc	a,c
+			or	e
+			ld	a,(05d5h)
+			ld	h,a
+			sbc	a,a
+			inc	e
+			ld	h,e8h
+			nop (2x) *
+			add	a,76h
+			ld	c,c
+			and	a
+			nop (2x) *
+			ld	l,d
+			xor	c
+			ld	h,a
+			ld	hl,0255h
+			sbc	a,c
+			rst	20h
+			ld	h,(hl)
+			ret	po
+			ld	e,a
+			add	hl,de
+			out	(56h),a
+			ld	c,a
+			sub	e
+			ld	c,c
+			ld	a,(bc)
+			xor	(hl)
+			rra
+			ld	c,d
+			ret	nc
+			di
+			exx
+			ld	a,c
+			ld	d,a
+			jp	nc,Ladfe
+			ld	(42bdh),a
+			in	a,(1ah)
+			dec	l
+			ld	b,a
+			jp	(hl)
+			db	98h,bdh,46h,c6h,f1h,53h,42h,13h
+			db	4dh,12h,16h,24h,afh,5dh,f6h,c2h
+			db	59h,02h,eah,58h,23h,03h,dbh,72h
+			db	76h,ech,61h,85h,8fh,65h,59h,fch
+			db	d3h,48h,d8h,66h,0ah,18h,41h,40h
+			db	cfh,d0h,12h,a4h,7dh,84h,86h,33h
+			db	d5h,3bh,61h,3ah,20h,e1h,57h,d9h
+			db	8dh,ech,80h,cbh,72h,8bh,74h,42h
+			db	81h,18h,5ah,5ch,a3h,5eh,23h,4eh
+			db	f9h,cdh,b8h,7eh,20h,6ah,c0h,13h
+			db	3bh,ddh,fdh,5fh,94h,5bh,3bh,0fh
+			db	d5h,bch,79h,90h,53h,5eh,ach,12h
+			db	90h,8ah,7fh,c5h,c1h,fah,c8h,eeh
+			db	c0h,d4h,fdh,45h,b7h,17h,e5h,9eh
+			db	91h,c7h,beh,7fh,a1h,b0h,e7h,14h
+			sbc	a,56h
+			ld	a,c
+			add	a,(hl)
+			ret	po
+			inc	c
+			add	hl,de
+			ld	l,a
+			sbc	a,h
+			add	hl,bc
+			adc	a,c
+			add	hl,sp
+			cp	a
+			ld	e,l
+			ld	(hl),d
+			rra
+			rst	18h
+			and	a
+			ret	nc
+			inc	c
+			ld	l,d
+			add	a,b
+			ld	c,l
+			inc	l
+			ld	c,9ch
+			rst	30h
+			ld	a,b
+			ret	po
+			xor	b
+			add	hl,hl
+			ld	l,63h
+			daa
+			sbc	a,42h
+			rst	30h
+			ei
+			rst	18h
+			adc	a,d
+			jr	c,L6f38
+			call	po,L263f
+			djnz	L6f10
+			add	hl,sp
+			inc	b
+			add	hl,bc
+			ld	d,c
+			dec	c
+			rst	00h
+			ret	nz
+			ret	p
+			push	af
+			and	c3h
+			ld	(de),a
+			ld	(f763h),hl
+			ld	c,a
+			pop	de
+			dec	de
+			rrca
+			inc	c
+			or	(hl)
+			ld	e,c
+			ex	(sp),hl
+			push	hl
+			ld	c,(hl)
+			jp	m,La194
+			add	a,d
+			jp	nc,L4eaf
+			cp	b
+			or	cah
+			ld	b,e
+			and	e
+			jp	m,Ldb82
+			ld	(de),a
+			and	a
+			and	a
+			rst	28h
+			ld	b,e
+			adc	a,b
+			sbc	a,l
+			adc	a,e
+			ld	a,(bc)
+			ld	h,(hl)
+			sbc	a,b1h
+			ld	a,c
+			ld	h,e
+			and	d
+			and	6eh
+			or	b
+			ld	b,h
+			sbc	a,(hl)
+			ld	a,(2f87h)
+			inc	e
+			and	b
+			adc	a,d
+			ld	e,e
+			ld	b,e
+			sbc	a,a
+			ld	(b0a2h),a
+			rst	28h
+			ld	(hl),c
+			ld	c,l
+			ld	hl,(c8a3h)
+			cp	l
+			pop	bc
+			ld	e,(hl)
+			and	c
+			xor	l
+			dec	(hl)
+			call	nz,Lf573
+			inc	l
+			ld	h,a
+			add	a,h
+			sub	a
+			ld	l,(hl)
+			call	L78ad
+			rra
+			sbc	a,c
+			add	hl,sp
+			jr	z,L6f78
+			or	c
+			sbc	a,h
+			rst	10h
+			ret
+			db	e6h,81h,55h,5eh,5bh,14h,ddh,8dh
+			db	7eh,68h,14h,7bh,b4h,17h,46h,68h
+			db	2ch,1bh,8ch,8dh,3eh,53h,f7h,46h
+			db	82h,e7h,40h,9dh,53h,78h,81h,26h
+			db	b4h,4dh,c0h,6bh,a4h,56h,c4h,5dh
+			db	4bh,1dh,4dh,9ch,e1h,9eh,96h,2bh
+			db	47h,7eh,b9h,22h,beh,28h,0ch,20h
+			db	cch,9eh,8fh,6ah,bdh,25h,c4h,84h
+			db	b2h,58h,01h,5fh,b0h,ddh,a3h,6eh
+			db	3fh,1ch,eeh,1eh,68h,5bh,7ch,93h
+			db	85h,03h,57h,f6h,83h,b9h,74h,c5h
+			db	c7h,31h,e5h,8ah,b7h,01h,dch,a9h
+			db	9dh
+			and	h
+			ld	a,(bc)
+			ld	l,b
+			call	p,L4796
+			ld	d,a
+			adc	a,d
+			inc	l
+			nop (2x) *
+			ld	c,fdh
+			ld	l,(hl)
+			call	pe,L679a
+			call	m,L58a4
+			scf
+			ld	b,e
+			ld	(hl),c
+			add	hl,bc
+			rla
+			ld	c,iyl *
+			ld	d,e
+			cp	4ch
+			ld	c,c
+			ret	z
+			add	a,(hl)
+			jp	(hl)
+			db	c5h,53h,dch,92h,0dh,27h,8bh,b0h
+			db	66h,cfh,67h,b6h,c6h,dch,3ah,59h
+			db	6fh,74h,15h,ech,ebh,9fh,c5h,d5h
+			db	86h,0eh,06h,1ah,83h,38h,93h,e0h
+			db	7eh,62h,e2h,c0h
+			ld	b,a
+			ld	(e937h),hl
+			sub	b
+			ld	l,(hl)
+			adc	a,l
+			rst	10h
+			inc	e
+			call	nz,Lafe4
+			call	m,L7156
+			ld	l,07h
+			push	de
+			sbc	a,e
+			scf
+			or	c
+			ld	d,c
+			nop (2x) *
+			jp	nz,Ld15b
+			ld	a,h
+			ld	h,d
+			jp	po,L0f76
+			ld	a,c
+			sbc	a,h
+			ret	po
+			sbc	a,a
+			rst	00h
+			ld	d,l
+			dec	bc
+			dec	a
+			ld	h,c
+			ld	sp,hl
+			ld	h,a
+			dec	h
+			rst	00h
+			ld	c,a5h
+			xor	d
+			adc	a,a
+			ld	a,a
+			inc	bc
+			or	h
+			adc	a,h
+			cp	d
+			sub	(hl)
+			or	d
+			jp	(hl)
+			db	c2h,b4h,7ch,f7h,80h,3ch,2dh,63h
+			db	51h,eeh,f0h,abh,35h,e7h,e6h,a7h
+			db	4fh,35h,2bh,48h,aah,86h,80h,a8h
+			db	a3h,feh,5dh,37h,e2h,edh,76h,29h
+			db	1ch,50h,89h,d5h,e7h,f4h,5ch,2ah
+			db	4dh,00h,fbh,44h,f1h,3bh,45h,03h
+			db	6fh,24h,f6h,48h
+			ret	m
+			add	hl,de
+			ld	h,c
+			ld	l,e
+			inc	l
+			xor	b
+			ld	a,(de)
+			ld	(hl),e
+			ld	b,e
+			sbc	a,fbh
+			add	a,e
+			pop	de
+			ld	b,(hl)
+			ex	(sp),hl
+			xor	b
+			inc	d
+			rst	20h
+			ld	a,(de)
+			add	a,b
+			sbc	a,d
+			push	bc
+			sbc	a,d
+			ld	h,e
+			inc	l
+			ex	af,af'
+			ld	c,02h
+			rst	20h
+			or	a
+			ld	(hl),l
+			and	c
+			sbc	a,h
+			ld	l,e
+			jr	nz,L70be
+			sub	a
+			ret	pe
+			sub	b
+			ld	bc,7847h
+			and	47h
+			adc	a,l
+			ret	p
+			xor	b
+			rst	08h
+			jp	c,Lc44b
+			rst	38h
+			add	a,(hl)
+			ld	a,(d995h)
+			dec	a
+			sub	l
+			and	e
+			dec	c
+			out	(99h),a
+			pop	af
+			and	(hl)
+			call	z,La14b
+			ld	e,a
+			ld	(hl),c
+			ld	(hl),c
+			ex	de,hl
+			or	(hl)
+			jp	c,Lb260
+			sbc	a,(hl)
+			add	a,h
+			add	a,e
+			dec	b
+			sub	(hl)
+			inc	de
+			ret	p
+			and	d
+			sbc	a,d
+			rst	18h
+			call	po,Ld938
+			jp	po,L04dc
+			ld	b,(hl)
+			scf
+			or	e
+			bit	3,c
+			sub	d3h
+			rst	10h
+			sbc	a,99h
+			jr	nc,L7120
+			ld	d,c
+			ei
+			ld	b,h
+			or	b
+			ld	l,e
+			ld	c,b
+			and	9bh
+			push	af
+			push	af
+			nop
+			ld	e,a
+			sbc	a,c
+			cp	a
+			ld	a,l
+			out	(66h),a
+			ld	l,l
+			ld	c,b0h
+			or	d
+			ld	a,l
+			sub	8bh
+			ld	(hl),c
+			or	d
+			sub	a
+			adc	a,d1h
+			dec	h
+			ld	de,7946h
+			ex	af,af'
+			or	(hl)
+			ret	c
+			add	a,c
+			ld	b,h
+			ld	hl,ab0bh
+			add	hl,sp
+			ld	e,96h
+			dec	e
+			ld	a,d
+			ld	d,b
+			ld	d,d
+			ld	e,d
+			ld	d,d
+			push	bc
+			ld	sp,4596h
+			jr	nz,L70d1
+			ld	bc,583fh
+			jp	m,L17b7
+			jp	p,La8be
+			sub	cfh
+			and	a
+			add	a,h
+			cp	c
+			add	a,l
+			ld	c,b
+			ld	l,(hl)
+			ld	b,h
+			inc	de
+			ld	a,(de)
+			jp	nz,L17da
+			or	c
+			xor	(hl)
+			dec	d
+			xor	e
+			ld	hl,(b322h)
+			jp	Le302
+			db	a3h
+			ld	e,c
+			ld	h,c
+			ld	b,b
+			cp	l
+			ld	d,d
+			ld	hl,ba73h
+			xor	d
+			ld	b,d
+			cp	e
+			add	hl,sp
+			ld	de,7abch
+			rst	30h
+			ret	nz
+			cp	a
+			sub	d
+			pop	hl
+			ld	a,(de)
+			ld	(hl),c
+			ld	(b6c0h),a
+			cp	(hl)
+			add	hl,de
+			dec	c
+			inc	sp
+			ld	l,e
+			adc	a,h
+			ld	l,a
+			jp	c,L6521
+			or	l
+			ccf
+			or	l
+			sbc	a,d
+			jp	pe,Lcf96
+			inc	b
+			sbc	a,b
+			inc	a
+			rrca
+			xor	d
+			cp	22h
+			jp	nz,L6d6b
+			dec	e
+			add	a,l
+			ld	(hl),4ah
+			rst	20h
+			dec	hl
+			ret	z
+			ld	l,e
+			ld	a,28h
+			inc	d
+			inc	hl
+			ld	c,b
+			dec	h
+			xor	e
+			or	e
+			ld	d,48h
+			rlca
+			add	a,b
+			pop	hl
+			dec	de
+			ld	(de),a
+			cp	e
+			scf
+			xor	d
+			pop	de
+			ld	(hl),e
+			ret	c
+			rst	18h
+			add	a,c
+			add	a,h
+			push	bc
+			ld	e,18h
+			or	a
+			ld	(8533h),a
+			jp	L7413
+			db	69h,d1h,e1h,a0h,eeh,69h,ech,b8h
+			db	1eh
+			sub	l
+			sbc	a,a
+			ld	a,a
+			sub	l
+			ld	b,d
+			ld	b,(hl)
+			sbc	a,d
+			ld	h,h
+			or	a
+			sbc	a,a
+			ld	e,d
+			xor	b
+			inc	hl
+			ld	sp,6cceh
+			inc	b
+			dec	b
+			ret	nz
+			nop (2x) *
+			ret	pe
+			adc	a,c
+			dec	de
+			and	c
+			or	c
+			pop	de
+			ld	h,c
+			ld	l,a
+			pop	hl
+			ret	pe
+			and	b
+			ld	c,b
+			add	a,d
+			ld	(hl),a
+			ld	h,h
+			rld
+			sub	h
+			ld	a,h
+			inc	b
+			ld	b,b
+			ld	h,c
+			pop	de
+			ld	(hl),9bh
+			dec	de
+			ld	a,d
+			ld	e,b
+			ei
+			and	h
+			or	a
+			ld	a,(bc)
+			ld	b,b
+			jp	(hl)
+			db	3ch,ech,56h,50h,01h,deh,49h,2ch
+			db	1ch,cdh,fah,81h,42h,7eh,5eh,d2h
+			db	f4h,20h,adh,c2h,b0h,dfh,d0h,95h
+			or	l
+			ld	h,(hl)
+			or	d
+			call	po,L9a7b
+			add	hl,bc
+			ld	(hl),d
+			call	z,Lfd4d
+			sub	(hl)
+			ret	nc
+			cp	d
+			jp	(hl)
+			db	a5h,19h,c1h,e4h,8fh,b6h,6ch,bch
+			db	33h,e1h,10h,85h,89h,86h,20h,14h
+			db	feh,d0h,96h,ach,0dh,89h,52h,6ah
+			db	9eh,6eh,95h,29h,abh,26h,a3h,09h
+			db	1bh,05h,09h,58h,7fh,e4h,a9h,9dh
+			db	cbh,7dh,7dh,68h,bfh,30h,dch,08h
+			db	0bh,5ch,d1h,a6h,ffh,beh,d7h,fah
+			db	48h,dah,22h,32h,f7h,68h,45h,e2h
+			db	ach,18h,ach,bfh,8dh,35h,08h,9fh
+			db	23h,48h,cbh,f3h,16h,2ch,f0h,01h
+			db	96h,f9h,0ah,bbh,c8h
+			pop	hl
+			ld	sp,40b9h
+			ld	h,l
+			jr	nz,L7306
+			nop (2x) *
+			inc	b
+			dec	b
+			add	hl,de
+			ld	l,b
+			sbc	a,73h
+			adc	a,(hl)
+			rst	10h
+			ld	(hl),6ah
+			nop (2x) *
+			ret	nc
+			dec	de
+			call	pe,Lbaf7
+			ld	l,a
+			dec	(hl)
+			add	a,c
+			ret	m
+			adc	a,c
+			jp	(hl)
+			db	93h,bbh,feh,7eh,aeh,37h,98h,c8h
+			db	18h,a4h,6bh,b9h,8ch,37h,aah,3eh
+			db	a8h,eah,9ah,85h,18h,04h,8ch,08h
+			db	b1h,ffh,10h,2bh,d0h,4dh,9ah,d6h
+			db	f9h,73h,beh,61h,ceh,fbh,38h,71h
+			db	06h,8fh,e3h,33h,fah,59h,dfh,e2h
+			db	f3h,59h,6ch,c2h,2ch,37h,a7h,9fh
+			db	cbh,8bh,90h,4ch,5bh,adh,81h,fch
+			db	09h,91h,32h,19h,10h,64h,56h,44h
+			db	f2h,77h,71h,81h,03h,2fh,bbh,a8h
+			db	0ah,01h,3ch,55h,beh,6fh,2ch,30h
+			db	07h,45h,c2h,62h,06h,2fh
+			out	(1ah),a
+			ld	a,b
+			call	p,L0dfe
+			jp	(hl)
+			db	9ch,2fh,72h,e5h,8eh,17h,44h,23h
+			db	29h,80h,edh,beh,f2h,ceh,afh,d7h
+			db	dch,f7h,b9h,31h,7bh,bbh,91h,b0h
+			db	d0h,07h,3ch,a3h,91h,6bh,01h,6bh
+			db	e4h,88h,d9h,f6h,c1h,40h,c2h,9dh
+			db	edh,93h,2eh,aah,e3h,77h,94h,dfh
+			db	bch,f4h,4ch,4bh,cfh,0eh,0ch,94h
+			db	d4h,1ch,c9h,4eh,e4h,cdh,61h,b5h
+			db	4dh,5bh,6eh,18h,6dh,cah,6fh,e8h
+			db	6eh,c4h,19h,bah,94h,a9h,fch,73h
+			db	19h,e1h,0ch,c7h,b1h,32h,96h
+			ex	(sp),hl
+			or	l
+			adc	a,d
+			jr	z,L739e
+			xor	c
+			ld	d,d
+			adc	a,h
+			out	(e7h),a
+			add	hl,hl
+			push	bc
+			rst	10h
+			ld	b,e5h
+			xor	e
+			ld	(c457h),hl
+			ld	a,(bc)
+			and	e
+			inc	c
+			ld	h,a
+			ld	e,d
+			call	c,L6a09
+			call	po,Lde93
+			call	z,L26ad
+			ld	a,b
+			ld	a,2dh
+			add	a,l
+			ld	e,c
+			ld	a,e
+			sub	d
+			daa
+			jp	nc,L8bee
+			pop	bc
+			ld	a,(bc)
+			jp	nz,Ld368
+			and	h
+			adc	a,(hl)
+			jp	z,L441f
+			ld	d,a
+			scf
+			adc	a,57h
+			pop	hl
+			ei
+			pop	af
+			call	z,Leb70
+			ld	l,a
+			call	po,Lb7c6
+			ld	(hl),b
+			ld	h,h
+			call	nc,Lb37e
+			and	h
+			ld	a,b3h
+			ld	d,c
+			ld	a,(bc)
+			xor	a
+			or	a
+			ld	a,b
+			xor	a
+			ld	d,(hl)
+			rst	30h
+			adc	a,1fh
+			ld	a,c
+			sbc	a,b
+			ld	l,h
+			sub	(hl)
+			di
+			ld	b,b
+			ld	d,e
+			or	d
+			and	(hl)
+			add	a,b
+			set	5,l
+			ld	(4079h),hl
+			or	l
+			ld	(hl),h
+			add	hl,sp
+			sub	h
+			ld	c,h
+			and	e
+			inc	hl
+			ccf
+			adc	a,l
+			inc	d
+			jr	z,L7401
+			ld	h,d
+			adc	a,a
+			cp	d
+			ld	d,a
+			xor	c4h
+			inc	bc
+			ccf
+			ld	b,b
+			ld	c,l
+			rst	20h
+			ex	de,hl
+			jp	c,La55f
+			adc	a,e
+			ld	(2422h),a
+			sla	l
+			and	h
+			ld	b,d
+			dec	d
+			ld	h,e
+			ld	b,l
+			add	a,b
+			nop (2x) *
+			ld	(hl),d
+			set	2,(hl)
+			pop	hl
+			ld	h,(hl)
+			adc	a,b
+			ret	c
+			dec	d
+			call	nc,Le887
+			ld	sp,hl
+			inc	sp
+			call	nz,L0164
+			ld	sp,ee10h
+			dec	l
+			halt
+			and	c
+			ld	h,(hl)
+			pop	bc
+			ld	d,a
+			ld	a,l
+			ld	a,e
+			ex	de,hl
+			or	h
+			pop	de
+			or	09h
+			nop (2x) *
+			jp	Lf72a
+			db	cbh,91h,bah,a6h,1bh,72h,3ah,71h
+			db	7fh,40h,b3h,56h,ebh,e8h
+			call	pe,L12a6
+			ld	c,(hl)
+			add	hl,bc
+			jr	nc,L74a6
+			jp	p,L34a1
+			adc	a,a
+			rst	10h
+			add	hl,de
+			inc	(hl)
+			inc	c
+			sbc	a,fdh
+			rla
+			in	a,(19h)
+			ld	e,b
+			push	hl
+			pop	bc
+			ld	l,c
+			ld	(hl),c
+			ld	(hl),b
+			ret	c
+			or	c
+			out	(42h),a
+			out	(5eh),a
+			dec	sp
+			add	hl,bc
+			add	hl,hl
+			scf
+			sbc	a,a
+			sbc	a,l
+			ld	e,8dh
+			inc	d
+			ld	d,l
+			ld	d,h
+			ld	c,24h
+			ret	nz
+			inc	c
+			rst	38h
+			cp	h
+			cp	b
+			jr	L7415
+			db	8ah,39h,74h,2fh,f2h,f5h,f7h,8fh
+			db	6bh,4eh,69h,7dh,20h,c4h,91h,70h
+			db	11h,c1h,04h,fbh,cah,24h,fbh,22h
+			db	6eh,c4h,99h,c2h,4ch,03h,8dh,c1h
+			db	04h,7dh,b3h,1bh,eah,29h,3eh,b5h
+			db	9eh,1eh,2eh,37h,37h,89h,ceh,26h
+			db	58h,bfh,3fh,82h,5ah,86h,afh,99h
+			db	02h,6ah,4bh,d5h,90h,21h,59h,62h
+			db	17h,31h,f6h,12h,72h,34h,f1h
+			sbc	a,e
+			rst	28h
+			rst	28h
+			ret	nc
+			adc	a,d
+			ld	l,b
+			ld	h,c
+			ld	d,h
+			ld	a,a
+			ld	h,l
+			cp	c
+			rst	18h
+			sbc	a,(hl)
+			ret	c
+			ld	a,(08c2h)
+			sub	c
+			scf
+			push	af
+			ld	h,(hl)
+			sub	c
+			adc	a,h
+			jp	m,Lcc0e
+			inc	h
+			ld	b,a
+			cp	e
+			rst	30h
+			and	11h
+			ld	d,27h
+			and	b
+			ld	(hl),d
+			add	a,c
+			ld	a,(de)
+			ld	d,c
+			call	L5a41
+			and	e
+			ret	po
+			rst	20h
+			jp	c,L2a23
+			ld	e,a
+			ld	c,a0h
+			ld	a,b
+			ld	hl,(20a2h)
+			ld	c,d
+			nop
+			jp	p,L1af2
+			ld	h,c
+			inc	hl
+			ret	z
+			in	a,(d3h)
+			sub	(hl)
+			nop (2x) *
+			adc	a,a
+			ld	l,a
+			out	(6bh),a
+			ret	i *
+			ld	(hl),83h
+			add	a,h
+			add	a,(hl)
+			inc	l
+			sbc	a,(hl)
+			xor	l
+			sub	d
+			ld	b,a
+			add	a,l
+			inc	b
+			dec	hl
+			ld	(bc),a
+			ld	e,9fh
+			ld	h,ach
+			ret	c
+			ex	af,af'
+			sub	h
+			adc	a,d
+			call	po,Lfcb2
+			ld	d,c
+			and	53h
+			ret	pe
+			ld	a,d
+			ccf
+			adc	a,c
+			rst	38h
+			adc	a,(hl)
+			call	pe,Lbc94
+			pop	bc
+			jp	po,Lbdcf
+			ld	a,(de)
+			rrca
+			ld	b,41h
+			daa
+			xor	(hl)
+			ld	a,(dcc2h)
+			and	c
+			rla
+			jp	p,L1509
+			add	hl,sp
+			dec	b
+			sub	l
+			adc	a,h
+			ld	b,l
+			rrca
+			ret	nz
+			call	nz,L8462
+			jr	z,L756e
+			di
+			jr	nz,L7516
+			pop	hl
+			ret	z
+			call	z,Lc3bd
+			ld	a,a
+			ret	m
+			ld	(bc),a
+			jr	nz,L7561
+			sub	l
+			jr	nc,L74fa
+			xor	e3h
+			or	d
+			add	a,a
+			ld	(hl),c
+			ld	d,(hl)
+			dec	e
+			ld	a,e
+			cp	a
+			call	pe,Lcd91
+			ld	b,l
+			add	a,a
+			cpl
+			dec	d
+			call	po,L52e2
+			sbc	a,h
+			ld	c,a
+			out	(92h),a
+			or	l
+			ld	c,e
+			xor	a
+			ld	e,c
+			inc	bc
+			xor	1bh
+			add	a,a
+			ret	z
+			jp	p,Lf0cf
+			jr	nz,L74ed
+			ld	l,a
+			rlc	c
+			jr	nz,L7593
+			sub	0eh
+			ret	po
+			call	z,L728a
+			add	a,a
+			ld	(24b5h),hl
+			or	e2h
+			ld	e,d
+			and	b
+			ld	h,71h
+			dec	(hl)
+			ld	l,e
+			ret	c
+			nop (2x) *
+			rst	20h
+			cp	b
+			ld	b,c
+			add	a,l
+			dec	a
+			inc	l
+			ld	h,l
+			add	a,a
+			ld	a,h
+			call	p,Laad3
+			or	61h
+			jr	L75f3
+			db	6dh,d8h,feh,52h,7ch
+			ld	h,l
+			ld	h,l
+			pop	bc
+			add	a,43h
+			ld	h,a
+			and	l
+			and	b
+			ld	a,(hl)
+			ld	c,d
+			ld	hl,(4203h)
+			inc	h
+			adc	a,d
+			ld	(hl),a
+			jp	nc,L478c
+			ld	hl,98b7h
+			ld	l,(hl)
+			call	nz,L9598
+			call	c,Le9c5
+			ld	e,(hl)
+			jp	nc,L32d8
+			sbc	a,c
+			ld	d,a
+			and	49h
+			scf
+			ei
+			ret
+			db	ech,cdh,17h,43h,9ch,c7h,e0h,bch
+			db	1ah
+			call	m,L19d9
+			add	a,c
+			add	a,c
+			ld	(hl),e
+			adc	a,h
+			nop (2x) *
+			dec	sp
+			ld	e,l
+			ld	c,l
+			ld	(hl),l
+			or	(hl)
+			ccf
+			jr	nz,L757d
+			and	h
+			inc	hl
+			ld	c,cdh
+			ret	nz
+			ld	a,d
+			and	b
+			ld	b,l
+			ld	l,l
+			push	hl
+			xor	l
+			ld	d,e
+			ret	nz
+			inc	hl
+			rst	20h
+			ld	a,a
+			ld	c,e
+			in	a,(fdh)
+			rst	28h
+			rst	28h
+			jr	nz,L75dd
+			and	(hl)
+			ld	a,e
+			sub	l
+			and	b
+			inc	sp
+			ld	de,ed7ah
+			ld	l,b
+			or	h
+			out	(8eh),a
+			or	3bh
+			ld	(hl),d
+			ld	l,e
+			dec	de
+			or	d
+			sbc	a,b
+			ld	c,e
+			nop (2x) *
+			inc	d
+			or	2dh
+			xor	d
+			xor	8ch
+			add	a,h
+			or	l
+			call	pe,L8cff
+			sbc	a,75h
+			adc	a,l
+			add	a,h
+			xor	d
+			ld	h,a
+			and	c
+			and	45h
+			cp	h
+			bit	6,e
+			rst	00h
+			rst	00h
+			ld	a,h
+			ld	h,e
+			rst	00h
+			adc	a,(hl)
+			ld	(hl),e
+			call	c,L5266
+			inc	hl
+			ld	(hl),l
+			adc	a,afh
+			adc	a,h
+			sub	c
+			pop	bc
+			ld	(hl),ddh
+			nop
+			xor	l
+			rst	00h
+			or	b
+			jp	c,L34f4
+			halt
+			ld	a,a
+			call	L5ed9
+			sbc	a,e
+			adc	a,a
+			jr	nc,L75bf
+			or	e
+			ld	c,(hl)
+			adc	a,e
+			ld	d,l
+			call	nz,Lac93
+			rst	20h
+			inc	b
+			rst	18h
+			sbc	a,c
+			ex	de,hl
+			ld	(hl),d
+			adc	a,e
+			ld	b,l
+			or	l
+			ld	l,a
+			cpl
+			ld	l,e
+			ld	d,e
+			cp	(hl)
+			ld	c,b
+			call	nc,L1c8c
+			ld	d,f4h
+			add	hl,sp
+			ld	c,(hl)
+			ld	d,22h
+			ld	e,e
+			adc	a,(hl)
+			jp	po,L7d34
+			add	a,b
+			scf
+			ld	b,05h
+			add	a,f1h
+			adc	a,h
+			dec	d
+			ld	a,a
+			dec	(hl)
+			cp	d
+			add	a,(hl)
+			add	a,d
+			jp	L61c0
+			db	ffh,afh,2fh,b1h,29h,4eh
+			and	l
+			dec	hl
+			inc	c
+			ret	p
+			ld	d,(hl)
+			call	nz,L26c0
+			ld	l,l
+			exx
+			ld	(hl),a
+			add	a,b
+			cp	(hl)
+			cp	l
+			inc	h
+			or	e
+			ld	a,50h
+			rrca
+			adc	a,h
+			ei
+			ret	z
+			cp	(hl)
+			jp	z,L39f9
+			or	e
+			rst	18h
+			adc	a,64h
+			jp	c,Le4cb
+			and	b
+			sub	a
+			ld	d,b
+			pop	bc
+			ld	c,(hl)
+			jr	nc,L76bf
+			sbc	a,b
+			ld	(c2aeh),a
+			inc	d
+			dec	d
+			ld	h,l
+			adc	a,(hl)
+			ld	a,c
+			adc	a,a
+			ld	d,l
+			ld	(hl),l
+			rra
+			ld	b,e
+			adc	a,(hl)
+			nop
+			call	m,L3b57
+			ld	c,h
+			ld	a,6fh
+			jp	z,Ledaa
+			ld	(hl),h
+			dec	bc
+			dec	sp
+			call	po,L5cdd
+			cp	b
+			or	ixh *
+			ld	(hl),79h
+			ld	h,b
+			call	z,L0890
+			ld	h,a
+			dec	c
+			dec	b
+			add	a,c
+			push	hl
+			xor	(hl)
+			ld	d,a
+			cp	adh
+			rst	28h
+			nop (2x) *
+			ld	de,5799h
+			ld	a,e
+			call	nz,L500c
+			sub	e
+			sbc	a,(hl)
+			ld	l,b
+			jp	ix
+			db	b3h,b9h,9dh,24h,51h,31h,d0h,63h
+			db	15h,d8h,80h,a2h,b7h,37h,20h,ebh
+			db	a1h,8eh,cdh,0eh,b1h,67h,d7h,c0h
+			db	27h,62h,d4h,e6h,7dh,bbh,b3h,6ah
+			db	b0h,16h,17h,c6h,8fh,21h,cah,fdh
+			db	74h,20h,04h,deh,54h,b5h,8fh,6dh
+			db	cdh,c1h,28h,e5h,e0h,9eh,80h,b2h
+			db	a5h,78h,8bh,d1h,6fh,e1h,1eh,56h
+			db	d8h,24h,17h,26h,0eh,b9h,38h,dfh
+			db	7dh,13h,6bh,8ch,76h,b4h,a6h,23h
+			db	19h,21h,e3h,e5h,22h,e0h,76h,74h
+			db	5bh,10h,8dh,1ah,79h,c1h,90h,24h
+			db	2bh,a3h,69h,04h,2ch,65h,0dh,50h
+			db	8ah,feh,77h,1bh,14h,9ah,85h,67h
+			db	80h,bfh,e7h,48h,9ch,b2h,eah,9eh
+			db	e2h,deh,a7h,79h,eah,9dh,71h,bfh
+			db	c2h,47h,2dh,4bh,5bh,88h,0ch,23h
+			db	bbh,85h,96h,cbh,eah,52h,dbh,90h
+			db	b0h
+			ld	(b107h),hl
+			adc	a,l
+			sub	l
+			ld	a,d
+			jp	nc,Lad41
+			ld	b,ffh
+			rra
+			ld	a,(de)
+			dec	hl
+			call	m,L41db
+			ex	af,af'
+			ret	po
+			adc	a,e
+			ld	b,(hl)
+			ld	(hl),d
+			call	nz,L4cb9
+			jp	c,L93ab
+			ret	nz
+			add	a,l
+			dec	sp
+			sbc	a,d
+			ld	d,b
+			add	a,a
+			or	l
+			cp	e
+			inc	hl
+			push	bc
+			dec	c
+			set	1,(hl)
+			xor	b
+			ld	de,193fh
+			ret	nz
+			xor	h
+			jr	L77b4
+			db	5fh,3fh,feh,e0h,5fh,09h,e4h,b5h
+			db	38h,71h,75h,9ch,d0h,cch,0ch,7dh
+			db	5ch,5ah,38h,29h,62h,73h,3eh,6eh
+			db	6ch,21h,74h,e4h
+			call	pe,L4a98
+			ret	po
+			ex	af,af'
+			call	po,L23ee
+			dec	de
+			ld	a,h
+			dec	sp
+			inc	l
+			sbc	a,d
+			ld	hl,6f0ah
+			ret	m
+			ld	a,(c414h)
+			ld	d,abh
+			jp	(hl)
+			db	beh,8bh,f2h,73h,feh,c6h,b1h,2dh
+			db	edh,b9h,6ch,d6h,f1h,13h,52h,36h
+			db	bbh,81h,aah,70h,87h,edh,5bh,8ch
+			db	f4h,e7h,4eh,01h,52h,89h,43h,dch
+			db	b2h,2dh,fch,30h,fah,40h,9ah,4bh
+			db	c2h,b6h,5dh,b0h,6dh,6ch,b5h,bch
+			db	f4h,88h,b9h,7fh
+			ld	sp,13c7h
+			rlca
+			ret	p
+			or	l
+			ld	c,c
+			ld	d,c
+			ld	(hl),b
+			call	z,L9b50
+			or	a
+			ld	e,b
+			dec	hl
+			ld	d,c
+			xor	c
+			add	a,d
+			ld	(hl),e
+			ld	h,e
+			adc	a,h
+			ld	e,a
+			sbc	a,16h
+			jp	(hl)
+			db	60h,78h,a8h,bdh,b4h,95h,aeh,fah
+			db	dbh,a6h,4fh,65h,63h,7fh,c9h,94h
+			db	b3h,cah,0dh,6ch,5ah,82h,00h,07h
+			db	79h,d6h,d8h,f6h,78h,b9h,dch,bah
+			db	37h,80h,25h,77h,dah,5dh,4ah,d7h
+			db	7eh,35h,66h,44h,54h,67h,3fh,1bh
+			db	dfh,d4h,17h,38h,42h,a4h,e5h,d2h
+			db	65h,18h,28h,4eh,e8h,fch,4fh,16h
+			db	ffh
+			ld	(hl),c
+			ret	z
+			ld	a,c
+			sbc	a,b
+			ld	a,h
+			inc	de
+			ret	z
+			or	a
+			cp	(hl)
+			adc	a,b
+			or	d
+			ld	hl,3715h
+			ld	l,h
+			inc	c
+			ld	(hl),d
+			ld	c,b3h
+			jp	Lf80c
+			db	e2h,04h,afh,4bh
+			adc	a,(hl)
+			ld	b,56h
+			ld	sp,hl
+			call	nc,L0f6e
+			ld	a,a
+			ld	e,0eh
+			cp	(hl)
+			ld	l,c
+			ld	e,c
+			sub	d
+			xor	h
+			jp	po,Laffe
+			jr	z,L7873
+			rla
+			jp	L7ec9
+			db	11h,7dh,0ah,61h,70h,6ch,cch,8bh
+			db	29h,d8h,aah,30h,8eh,a5h,31h,cfh
+			db	65h,44h,69h,b3h,4fh,1ch,c6h,cfh
+			db	09h,46h,4ch,f8h,9ch
+			ld	e,b
+			ld	d,h
+			jp	(hl)
+			db	dbh,75h
+			add	hl,de
+			xor	d
+			sub	d
+			push	bc
+			sbc	a,a
+			sbc	a,c
+			push	af
+			ld	d,h
+			ld	e,(hl)
+			cpl
+			adc	a,(hl)
+			ld	c,h
+			sub	b
+			ret	po
+			ld	l,b
+			ld	bc,43f8h
+			nop
+			ld	a,(de)
+			ld	(hl),c
+			ld	b,c
+			ld	b,e
+			call	po,Lb75e
+			xor	b
+			ret	p
+			jr	z,L7859
+			ld	c,h
+			and	c
+			and	b
+			ld	e,(hl)
+			and	l
+			push	bc
+			set	4,e
+			sbc	a,a
+			push	af
+			adc	a,l
+			ld	h,a
+			ld	d,e
+			ld	(hl),c
+			and	l
+			ld	(hl),d
+			ld	e,42h
+			jp	(hl)
+			db	46h,4eh,55h,05h,50h,efh,afh,e6h
+			db	f0h,46h
+			ld	h,h
+			ld	e,e
+			cp	b
+			inc	bc
+			ret	po
+			cpl
+			ld	a,(bc)
+			ld	b,64h
+			inc	a
+			add	a,a
+			ei
+			sbc	a,(hl)
+			cp	l
+			ld	(hl),b
+			add	a,a
+			ld	b,98h
+			ld	h,a
+			cpl
+			ld	a,a
+			and	e
+			ld	(hl),c
+			jr	nz,L78a8
+			in	a,(d0h)
+			pop	hl
+			inc	c
+			and	d
+			add	hl,hl
+			jp	pe,Lf425
+			ld	a,d
+			ld	sp,hl
+			ld	e,b
+			sbc	a,d
+			or	h
+			ret	p
+			inc	c
+			ld	(hl),b
+			dec	a
+			ret	nz
+			or	e
+			adc	a,b
+			ld	b,e
+			ret	pe
+			rst	30h
+			jp	z,L212d
+			dec	d
+			and	(hl)
+			ld	de,6327h
+			jp	nz,L3b9b
+			nop
+			adc	a,b
+			call	Lf2a4
+			adc	a,h
+			rst	28h
+			ret	p
+			rst	30h
+			xor	a
+			and	h
+			add	a,(hl)
+			cp	h
+			and	88h
+			ret	c
+			rra
+			ld	a,l
+			ld	h,l
+			ld	l,c
+			and	(hl)
+			ret	p
+			ld	a,(de)
+			dec	a
+			add	a,c
+			and	45h
+			jp	L769f
+			db	e5h,25h,95h,c1h,d4h
+			cp	d
+			ld	(cd29h),hl
+			ld	l,04h
+			rst	38h
+			jp	p,L5fec
+			adc	a,a
+			ld	e,c
+			jp	po,Ld418
+			xor	a
+			ld	a,c
+			or	h
+			ld	(hl),l
+			daa
+			ld	a,(hl)
+			ld	c,b
+			inc	b
+			ld	l,c
+			jp	z,L5410
+			ld	a,a1h
+			dec	sp
+			cp	d2h
+			ld	h,b
+			jp	(hl)
+			db	7bh,c7h,e7h,10h,beh,0eh,86h,ach
+			db	82h,37h,85h,f5h,c3h,afh,f1h,a3h
+			db	4ch,2ah,24h,f5h,15h,f5h,8ah,36h
+			db	32h,8ch,7ch,8eh,07h,60h,c4h,a4h
+			db	96h,91h,f5h,c4h,89h,7eh,b3h,3dh
+			db	10h,89h,b7h,0bh,aah,4bh,cch,c9h
+			db	22h,51h,a7h,d5h
+			ld	c,l
+			ld	l,h
+			dec	hl
+			and	b8h
+			adc	a,d
+			jp	c,L9fa2
+			dec	sp
+			ld	l,c
+			xor	b
+			ld	e,a
+			ld	b,(hl)
+			xor	a
+			inc	a
+			ld	e,(hl)
+			ld	c,h
+			add	hl,bc
+			inc	(hl)
+			jr	L7a32
+			db	60h,f3h,0eh,ceh,a8h,35h,f3h,b6h
+			db	56h,adh,64h,10h,98h,46h,62h,98h
+			db	3ch,3eh,68h,8dh,dch,4eh,a5h,36h
+			db	43h,2ch,18h,cch,3fh,77h,22h,8dh
+			db	66h,4ah,cch,24h,05h
+			in	a,(c3h)
+			ld	a,d
+			xor	e
+			and	d
+			jp	(hl)
+			db	41h,6fh
+			ld	c,19h
+			pop	bc
+			add	hl,sp
+			rst	38h
+			sbc	hl,hl
+			dec	c
+			add	hl,hl
+			ld	de,81f8h
+			jp	pe,L9a3c
+			pop	hl
+			and	d
+			bit	1,e
+			ld	h,ech
+			call	p,Lb145
+			jp	p,L1d3c
+			or	l
+			adc	a,d
+			rst	00h
+			nop (2x) *
+			ex	de,hl
+			ld	(hl),d
+			ret	pe
+			jr	z,L7a77
+			or	ech
+			ld	b,ebh
+			sbc	a,(hl)
+			ld	(hl),c
+			ld	b,(hl)
+			sub	b
+			ret	pe
+			ld	l,l
+			xor	(hl)
+			call	nz,L79d8
+			cp	b
+			or	(hl)
+			dec	b
+			ld	l,l
+			sbc	a,03h
+			and	(hl)
+			ex	de,hl
+			halt
+			ld	hl,(e5bfh)
+			ld	(hl),d9h
+			ld	e,c
+			ld	e,e
+			sbc	a,(hl)
+			or	b
+			ld	e,a
+			add	a,h
+			rst	08h
+			add	a,e
+			adc	a,e
+			jr	nz,L7a4e
+			or	d
+			rlca
+			inc	bc
+			jr	z,L7a53
+			jp	nc,L7b55
+			jr	z,L7a11
+			sub	h
+			add	hl,bc
+			ld	(hl),c
+			ld	l,a
+			add	a,l
+			and	a
+			ld	d,a
+			and	l
+			and	a
+			dec	de
+			and	86h
+			xor	(hl)
+			sbc	a,l
+			add	a,h
+			daa
+			ld	b,h
+			cp	(hl)
+			jp	po,L4ade
+			inc	sp
+			xor	d
+			ld	b,l
+			ld	d,b
+			adc	a,d
+			call	c,L1e3a
+			ld	a,(bc)
+			ei
+			xor	a
+			rst	20h
+			jr	c,L7a54
+			jr	c,L79e0
+			scf
+			push	hl
+			adc	a,(hl)
+			ld	l,a
+			xor	l
+			dec	bc
+			djnz	L79ee
+			ei
+			and	b
+			ld	e,dfh
+			ld	b,(hl)
+			rst	00h
+			ex	(sp),hl
+			cp	e
+			rla
+			ld	l,c
+			ld	b,h
+			pop	af
+			or	e
+			sub	(hl)
+			ld	h,22h
+			xor	d
+			rst	20h
+			pop	bc
+			ld	e,(hl)
+			inc	de
+			or	h
+			ld	a,a
+			sbc	a,l
+			sub	h
+			ld	h,h
+			and	a
+			ld	e,d
+			add	a,a
+			and	d
+			call	L3ee3
+			adc	a,dfh
+			jp	m,Led9a
+			adc	a,l
+			ld	b,e
+			ld	c,a
+			ld	d,h
+			ret	nc
+			rst	00h
+			ld	sp,f013h
+			ei
+			ld	l,(hl)
+			ret	pe
+			nop (2x) *
+			rst	38h
+			sbc	a,c
+			bit	2,c
+			rst	08h
+			rst	10h
+			out	(71h),a
+			call	m,L2343
+			ld	h,(hl)
+			ld	hl,4483h
+			ld	b,h
+			ld	l,c
+			add	a,d
+			ld	a,d
+			ret	c
+			rst	18h
+			call	p,L6a92
+			inc	c
+			sub	d
+			jr	z,L7abd
+			ret	po
+			ld	(iy + 81h),c
+			jr	nc,L7aa6
+			call	nz,L28b7
+			ld	hl,4583h
+			ld	h,d
+			ld	d,b
+			call	L8e67
+			call	z,Le1ba
+			ccf
+			ld	e,a
+			daa
+			ld	l,e
+			ld	a,(hl)
+			adc	a,e
+			inc	bc
+			or	l
+			sub	h
+			pop	af
+			jp	nz,L31ae
+			ld	l,b
+			ex	(sp),hl
+			dec	d
+			and	a
+			add	a,e
+			ret	nz
+			scf
+			ld	c,h
+			add	a,(hl)
+			ld	l,a
+			xor	c
+			jr	L7ad7
+			db	8ah,74h,9fh,e3h,c8h,ach,b7h,21h
+			db	3bh,22h,b0h,e2h,72h,30h,bdh,deh
+			db	8ah,19h,7ch,85h,b4h,55h,72h,e8h
+			db	65h,51h,9ch,ffh,24h,3bh,02h
+			ld	a,81h
+			jr	c,L7ac2
+			res	4,b
+			ld	d,c
+			inc	hl
+			sub	a3h
+			ld	l,h
+			add	a,(hl)
+			ld	h,e
+			sub	h
+			ld	sp,c780h
+			ld	l,89h
+			cp	(hl)
+			call	nz,Ld207
+			call	m,L78c9
+			ld	e,c
+			rst	08h
+			cp	e
+			call	L9752
+			rst	08h
+			adc	a,e
+			ld	b,(hl)
+			inc	d
+			add	hl,de
+			ld	ixl,d *
+			ld	b,e
+			sub	(hl)
+			res	2,e
+			inc	l
+			xor	d
+			ld	d,(hl)
+			ld	a,h
+			out	(e5h),a
+			ld	l,e
+			ld	(be10h),hl
+			call	pe,L5e82
+			jp	po,L246f
+			ld	c,(hl)
+			ld	a,(hl)
+			sub	d
+			adc	a,a
+			call	nc,L1376
+			ld	bc,eb91h
+			ld	a,a
+			cp	b
+			ld	a,(hl)
+			jp	pe,L2a34
+			ld	d,c
+			cp	d
+			sub	e
+			sub	b
+			ld	a,d
+			ld	h,a
+			ld	c,l
+			inc	h
+			ld	a,(bc)
+			cpl
+			ei
+			ld	d,b
+			or	h
+			or	e
+			inc	bc
+			and	3ah
+			adc	a,e
+			ld	h,l
+			jp	pe,L7226
+			jr	nc,L7aff
+			ret	m
+			ld	h,d
+			inc	hl
+			cp	l
+			sub	h
+			sbc	a,7ch
+			jp	po,L3c75
+			call	nz,L1795
+			add	a,l
+			add	a,(hl)
+			ld	c,(hl)
+			jp	po,L501d
+			inc	c
+			jp	nz,Lbab3
+			ld	l,a
+			ld	d,21h
+			ld	sp,hl
+			pop	hl
+			sbc	a,(hl)
+			ld	(hl),4fh
+			ld	c,0ch
+			rla
+			inc	hl
+			ccf
+			call	p,Lb60b
+			pop	bc
+			rst	00h
+			ret	c
+			call	nc,La6eb
+			ret	pe
+			dec	sp
+			ld	(hl),e
+			sbc	a,a
+			ld	a,d
+			inc	d
+			add	hl,bc
+			in	a,(45h)
+			ld	h,(hl)
+			ret	po
+			inc	h
+			sub	e
+			ld	(hl),h
+			dec	h
+			ld	d,e
+			ld	h,e
+			inc	h
+			ld	l,d
+			ld	d,h
+			dec	hl
+			ld	(hl),l
+			ld	c,l
+			or	ixh *
+			ret	nz
+			ld	b,4bh
+			ld	sp,hl
+			ld	bc,aa98h
+			sbc	a,c
+			rrca
+			ld	b,e
+			dec	a
+			daa
+			add	a,e
+			inc	bc
+			ld	b,h
+			cp	c
+			ld	b,(hl)
+			inc	de
+			ei
+			inc	d
+			ld	c,e
+			ld	de,6991h
+			ld	d,h
+			bit	1,(hl)
+			call	z,Le844
+			sub	(hl)
+			adc	a,b4h
+			ret	z
+			ld	e,h
+			ld	(hl),h
+			sbc	a,h
+			push	af
+			ret	nz
+			sub	b
+			adc	a,h
+			rrca
+			ld	l,b
+			or	d
+			xor	e
+			rst	10h
+			rra
+			inc	c
+			ld	b,d
+			ld	h,l
+			inc	h
+			ld	d,e
+			ld	h,l
+			cp	a
+			ld	a,06h
+			cp	e
+			sub	d
+			xor	b
+			ld	a,(hl)
+			ld	a,b
+			ex	(sp),hl
+			ld	h,l
+			rst	28h
+			ld	l,h
+			or	e
+			adc	a,03h
+			ld	e,(hl)
+			sub	h
+			pop	hl
+			add	a,b
+			cp	a
+			ld	d,l
+			ld	l,(hl)
+			cp	b
+			ld	d,b
+			ld	b,h
+			ld	a,(de)
+			jp	Lbbf1
+			db	78h,96h,0ch,d2h,9ch,14h,98h,32h
+			db	e7h,34h,50h,a2h,54h,b3h,e8h,4bh
+			db	27h,4bh,69h,19h,8dh,69h
+			ld	a,e
+			ld	d,h
+			dec	e
+			ld	b,h
+			ld	l,h
+			xor	l
+			cp	f7h
+			inc	l
+			ld	a,e
+			inc	hl
+			inc	bc
+			djnz	L7ba0
+			or	2ch
+			or	b
+			cp	c
+			nop
+			or	b
+			ccf
+			ret
+			db	96h,7dh,84h,47h,7dh,7bh,fah,65h
+			db	f0h,60h,e4h,8dh,35h,c9h,dah,34h
+			db	f0h,40h,0bh,13h,e7h,91h,d0h,90h
+			db	f0h,e5h,c1h,a2h,95h,2fh,14h,39h
+			db	71h,74h,6bh,fah,2fh,66h,95h,9ah
+			db	54h,69h,bdh,2ah,f9h,5fh,3dh,b8h
+			db	2dh,10h,68h,11h,eah,aeh,b4h,b3h
+			db	e4h,a0h,52h,08h,41h,25h,77h,b6h
+			db	01h,a9h,cfh,07h,d5h,5bh,8ch,40h
+			db	77h,64h,14h,36h,39h,8dh,2ah,d1h
+			db	ach,37h,92h,87h,94h,64h,40h,48h
+			db	0ch,dbh,6dh,52h,1fh,1ch,9eh,adh
+			db	15h,0fh,3ah,e2h,6ch,15h,d3h,0dh
+			db	27h,93h,46h,6bh,f0h,efh,e7h,23h
+			db	aah,a8h,f4h,48h,0dh,41h,cah,feh
+			db	b8h,ceh,42h,cch,66h,21h,77h,2dh
+			db	04h,23h,f9h,a6h,abh,78h,bah,67h
+			db	7ch,02h,d9h,37h,f9h,c1h,2fh,cfh
+			db	1dh,efh,d9h,2ah,1eh,8dh,cdh,7eh
+			db	d6h,bdh,52h,48h,41h,89h,bah,e0h
+			db	44h,19h,aah,08h,18h,2eh,6bh,4eh
+			db	30h,85h,7bh,47h,62h,efh,d2h,26h
+			db	c9h,b3h,0bh,a5h,06h,55h,f8h,9dh
+			db	95h,24h,0bh,feh,4ch,dbh,3fh,00h
+			db	bbh,9dh,24h,7bh,93h,1ch,54h,72h
+			db	4ah,85h,d3h,32h,00h,47h,a5h,c3h
+			db	b1h,c1h,03h,74h,c7h,28h,4bh,b9h
+			db	8ch,4ch,e0h,efh,8ah,b4h,54h,02h
+			db	2dh,afh,75h,a0h,eeh,d2h,cbh,f0h
+			db	55h,5fh,b0h,72h,adh,48h,09h,cdh
+			db	bah,53h,41h,79h,35h,ach,8bh,86h
+			db	d7h,80h,33h,9dh,edh,7dh,83h,c3h
+			or	c
+			ld	(hl),c
+			ld	a,(de)
+			pop	bc
+			and	d
+			xor	(hl)
+			add	a,l
+			ld	h,42h
+			ld	sp,hl
+			sbc	a,h
+			inc	c
+			sbc	a,c
+			adc	a,h
+			xor	h
+			ld	d,b
+			adc	a,h
+			and	d
+			ret
+			db	15h,59h,e6h,7bh,a6h,19h,7eh,c7h
+			db	f4h,62h,73h,cbh,dch,61h,87h,3eh
+			db	a9h,39h,47h,b2h,deh,35h,c3h,89h
+			db	2ch,94h,82h,3eh,feh,19h,8ch,4bh
+			db	ach,78h,f9h,65h,bdh,2ch,98h,48h
+			db	aah,4bh,12h,aah,6dh,41h,bch,c5h
+			db	7fh,93h,89h,1dh,b3h,fdh,8eh,91h
+			db	5dh,f1h,33h,55h,21h,62h,a0h,b7h
+			db	10h,d1h,b8h,afh,3dh,7ah,53h,45h
+			db	feh,4fh,c4h,1fh,1ah,1fh,d4h,f1h
+			db	b2h,fah,9dh,feh,12h,f1h,2dh,ffh
+			db	52h,ach,8eh,7eh,f1h,ffh,29h,82h
+			db	0ah
+			jp	(hl)
+			db	cdh,92h,3fh,f0h,1ah
+			ld	a,h
+			inc	ixl *
+			rst	30h
+			jp	(hl)
+			db	28h,24h,a2h
+			xor	69h
+			ld	sp,hl
+			ld	a,c
+			add	hl,de
+			dec	a
+			jr	nc,L7da0
+			sbc	a,c
+			add	a,d
+			sub	a
+			add	a,a
+			or	c
+			cp	h
+			push	de
+			sbc	a,a
+			inc	c
+			xor	b
+			ld	a,b
+			dec	c
+			add	a,11h
+			rst	18h
+			ld	sp,af94h
+			sub	a
+			ld	h,d3h
+			sbc	a,l
+			or	l
+			jp	L95f6
+			db	42h,edh,7eh,64h,7bh,8ah,2ch,efh
+			db	1ch,73h,6bh,8ch,76h,f5h,3eh,bch
+			db	39h,3ah,22h,eah,9bh,7ah,47h,91h
+			db	7dh,3dh,f3h,78h,c9h,d3h,17h,96h
+			db	deh,a7h,6bh,aeh,deh,a2h,66h,96h
+			db	8ah,fah,25h,55h,d1h,35h,3fh,bch
+			db	3ch,49h,58h,e7h,6bh,31h,c6h,bbh
+			db	04h,afh,2ch,78h,39h,8dh,beh,bbh
+			db	f3h,ddh,14h,b6h,bah,7ch,1bh,35h
+			db	02h,9ch,22h,b1h,13h,6fh,1ch,65h
+			db	70h,98h,d2h,e1h,a7h,f7h,a7h,d5h
+			db	49h,e9h,e0h,41h,dbh,61h,cfh,1dh
+			db	a2h,1ch,53h,3ah,e8h,0bh,60h,fbh
+			db	92h,bah,1ah,01h,66h,10h,bdh,86h
+			db	cch,08h,03h,68h,55h,d2h,28h,dfh
+			db	7eh,b2h,30h,81h,6eh,75h,cch,c1h
+			db	66h,56h,55h,d9h,79h,50h,14h,bdh
+			db	abh,c8h,efh,0bh,45h,1ah,e4h,99h
+			db	5eh,fah,6dh,55h,68h,d7h,61h,1bh
+			db	7dh,11h,c8h,1fh,76h,5eh,5bh,ffh
+			db	17h,3ah,3fh,4ah,2ch,a0h,1ah,73h
+			db	89h,b9h,17h,99h,0fh,22h,42h,45h
+			db	13h,7bh,6eh,c1h,d8h,e4h,78h,76h
+			db	bfh,f7h,ceh,97h,9fh,eeh,85h,89h
+			db	83h,cbh,27h,f3h,7eh,efh,9bh,e3h
+			db	7bh,23h,98h,c8h,c9h,64h,34h,16h
+			db	6dh,5bh,92h,e4h,66h,f3h,4bh,b2h
+			db	9ch,0bh,e1h,bfh,3bh,3fh,38h,f9h
+			db	20h,28h,31h,e4h,75h,1eh,05h,55h
+			db	75h,c5h,1ch,5fh,ddh,7ch,6eh,3ah
+			db	09h,c6h,7ah,0fh,1ah,43h,cch,72h
+			db	0dh,e9h,3bh,2ch,39h,27h,1bh
+			ld	d,e
+			sub	l
+			ld	(hl),c
+			and	b
+			adc	a,h
+			and	c
+			jp	m,L7c23
+			ld	d,(hl)
+			ccf
+			sbc	a,l
+			dec	sp
+			ld	sp,hl
+			ld	e,b
+			ld	a,(de)
+			sub	l
+			ret	c
+			rla
+			sbc	a,d
+			ld	d,b
+			rst	00h
+			inc	hl
+			call	pe,L1b3e
+			ld	a,a
+			xor	d
+			xor	e
+			halt
+			ld	l,d
+			daa
+			and	b4h
+			ld	c,(hl)
+			add	a,h
+			ld	(hl),b
+			add	a,h
+			ld	(hl),h
+			ld	c,b
+			inc	hl
+			ld	a,e
+			out	(c0h),a
+			pop	af
+			ld	d,c
+			ld	(hl),b
+			ld	(de),a
+			sbc	a,c
+			adc	a,d
+			xor	l
+			rra
+			add	a,b
+			adc	a,d
+			ex	af,af'
+			xor	e
+			ld	d,d
+			rrca
+			call	p,Lefe1
+			sub	h
+			adc	a,e
+			add	a,b
+			ld	d,c
+			rst	10h
+			dec	d
+			xor	d
+			rst	00h
+			ld	h,c
+			cp	a
+			rst	10h
+			ld	(hl),b
+			dec	h
+			add	a,dch
+			dec	(hl)
+			jp	L4d9c
+			db	abh,41h,bfh,8bh,6eh,4dh,0bh,95h
+			db	77h,2ch,a7h,48h,4fh,61h,8fh,ech
+			db	1ch,75h,d4h,afh,e8h,38h,dbh,ach
+			db	10h,beh,a8h,90h,dch,e5h,7eh,96h
+			db	b9h,b6h,c9h,81h,abh,38h,5eh,39h
+			db	93h,6ch,a1h,0bh,07h,6ah,1ah,12h
+			db	f5h,98h,e5h,20h,d2h,5bh,64h,30h
+			db	20h,adh,f1h,97h,e5h,68h,e6h,2eh
+			db	b8h,b9h,57h,13h,01h,1dh,97h,04h
+			db	15h,aeh,1dh,f6h,77h,87h,60h,bch
+			db	2eh,91h,52h,e5h,4bh,89h,18h,c1h
+			db	35h,6ah,6fh,06h,c2h,6ch,bdh,6bh
+			db	30h,abh,6ah,85h,d4h,c3h,52h,b9h
+			db	5ch,21h,bch,13h,bfh,01h,60h,03h
+			db	b2h,a6h,6bh,5bh,a3h,bah,37h,33h
+			db	26h,d4h,16h,6dh,6dh,94h,a2h,e5h
+			db	a6h,8bh,51h,ddh,26h,03h,dfh,0bh
+			db	45h,55h,f4h,58h,89h,53h,abh,5ch
+			db	7ah,e6h,6fh,abh,95h,53h,83h,f1h
+			db	91h,75h,98h,18h,4ah,a5h,24h,46h
+			db	d5h,b4h,ech,49h,beh,7ah,00h,25h
+			db	11h,00h,d3h,f3h,b8h,9bh,f7h,c8h
+			db	03h,c0h,19h,d9h,15h,64h,c2h,38h
+			db	66h,e7h,69h,3ch,a1h,67h,c6h,9eh
+			db	dfh,01h,74h,6dh,3ah,eah,1eh,e6h
+			db	1ch,15h,a9h,a3h,f2h,e7h,63h,7ah
+			db	d5h,8fh,1eh,41h,d6h,13h,1bh,c9h
+			db	04h,00h,05h,ddh,08h,ebh,c8h,49h
+			db	99h,0bh,cdh,a1h,66h,1ah,31h,83h
+			db	9bh,d1h,45h,adh,4dh,d1h,9bh,04h
+			db	c5h,ebh,0ch,58h,03h,04h,7ch,c9h
+			db	27h,72h,0bh,84h,5dh,7fh,f9h,92h
+			db	afh,e2h,d7h,22h,5ah,2ch,4eh,97h
+			db	03h,d3h,4ch,63h,73h,d5h,98h,4eh
+			db	a7h,d2h,3ch,ddh,5ah,99h
+			ld	d,a
+			ld	(6be8h),a
+			ld	e,b
+			add	a,d
+			sub	d
+			inc	hl
+			dec	a
+			ld	e,l
+			ld	(hl),e
+			push	af
+			sbc	a,b
+			ret	nc
+			cp	d
+			ret
+			db	2eh,81h,deh,66h,63h,84h,92h,25h
+			db	73h,e8h,3ch,50h,b2h,aah,46h,f8h
+			db	68h,d8h,7dh,c0h,68h,61h,dfh,5dh
+			db	09h,56h,d5h,8eh,b5h,8ah,d0h,b9h
+			db	a9h,73h,b5h,0fh,7dh,67h
+			ld	b,a
+			jr	c,L8079
+			call	m,Lb54d
+			call	z,L996b
+			ld	b,h
+			sbc	a,d
+			adc	a,b0h
+			jr	z,L80ab
+			call	p,L681d
+			dec	bc
+			ret	m
+			or	h
+			ld	d,ixh *
+			out	(4fh),a
+			ld	c,d5h
+			ld	(hl),e
+			xor	d
+			push	de
+			or	l
+			sub	e
+			ld	h,c
+			ld	l,a
+			ret	pe
+			jp	nz,L1bc7
+			nop (2x) *
+			ld	c,b
+			rst	38h
+			dec	(hl)
+			nop
+			ex	af,af'
+			inc	(hl)
+			rla
+			or	(hl)
+			rst	00h
+			ld	l,e
+			jr	nz,L80c5
+			cp	l
+			and	(hl)
+			sbc	a,d
+			adc	a,a
+			rst	18h
+			ld	b,l
+			cp	(hl)
+			ld	l,b
+			call	m,L00c1
+			push	af
+			sub	d
+			neg *
+			jp	c,Le502
+			rl	c
+			adc	a,l
+			adc	a,l
+			ld	h,d
+			ret
+			db	66h,67h,1fh,87h,e4h,9dh,64h,87h
+			db	07h,05h
+			and	b
+			ld	l,(hl)
+			dec	c
+			xor	l
+			push	bc
+			cpl
+			sbc	a,a
+			ld	c,(hl)
+			ret	pe
+			ld	e,26h
+			ld	b,c
+			jr	z,L80ba
+			ld	h,(hl)
+			jp	m,Lcf74
+			or	d
+			push	bc
+			adc	a,f9h
+			add	a,a
+			ld	l,h
+			adc	a,b
+			rst	30h
+			sbc	a,c
+			ccf
+			or	a
+			xor	e
+			ld	e,c
+			rst	20h
+			dec	c
+			ret	m
+			add	a,h
+			di
+			add	hl,de
+			cp	a
+			rst	28h
+			scf
+			ld	a,a
+			ld	(hl),h
+			ex	(sp),hl
+			ret	m
+			ld	b,b
+			cp	l
+			ld	b,8dh
+			jp	nc,L494f
+			ld	l,e
+			or	d
+			ld	b,h
+			ex	(sp),hl
+			and	d
+			add	hl,de
+			adc	a,(hl)
+			ld	b,d
+			ei
+			ex	(sp),hl
+			sub	d
+			ld	c,e
+			rst	00h
+			ld	h,c
+			call	po,Le0f1
+			push	bc
+			dec	l
+			ld	c,b
+			ret	nc
+			sub	a
+			ld	(hl),d
+			xor	b
+			ld	h,b
+			or	c
+			ld	h,e
+			ld	l,b
+			pop	hl
+			ld	d,h
+			jr	L8178
+			db	01h,4dh,01h,3eh,7ah,6bh,5eh,9dh
+			db	abh,8bh,fbh,95h,5ch,3bh,4bh,b5h
+			db	c8h,e8h,2ch,8fh,bbh,87h,d7h,d5h
+			db	e2h,9dh,b8h,b0h,49h,a3h,40h,55h
+			db	05h,62h,73h,74h,30h,41h,dbh,a1h
+			db	64h,cbh,edh,b2h,91h,0ah,97h,8ch
+			db	b4h,6ch,4fh,33h,e6h,14h,fbh,c5h
+			db	68h,d6h,10h,a2h,18h,8ch,66h,b2h
+			db	edh,bdh,f1h,79h,fah,b0h,2eh,ffh
+			db	68h,0ah,e1h,45h,61h,d0h,9dh,73h
+			db	67h,b5h,15h,91h,32h,9eh,68h,16h
+			db	fdh,08h,dah,ffh,84h,adh,76h,b9h
+			db	1bh,39h,54h,f4h,dbh,e3h,22h,3eh
+			db	deh,ddh,24h
+			ret	i *
+			halt
+			ld	(1e0bh),a
+			adc	a,c
+			dec	bc
+			sbc	a,(hl)
+			adc	a,d
+			ret	z
+			ld	(hl),e
+			ld	c,b
+			ld	c,l
+			ld	b,b
+			call	nc,L674b
+			or	(hl)
+			inc	d
+			adc	a,d
+			ld	d,h
+			adc	a,b
+			ld	b,l
+			ld	b,b
+			push	hl
+			sub	(hl)
+			sbc	a,a
+			ld	e,c
+			ld	c,l
+			ld	l,b
+			ld	e,c3h
+			ld	d,l
+			or	e
+			dec	d
+			sbc	a,(hl)
+			sub	5ch
+			rst	20h
+			sbc	a,c
+			jr	nc,L81b5
+			ld	l,(hl)
+			inc	h
+			and	87h
+			inc	b
+			ld	d,b
+			dec	de
+			or	d
+			ei
+			ld	a,d
+			ret	c
+			dec	b
+			jp	po,L0228
+			or	c
+			ld	(hl),l
+			cp	c
+			ld	a,(hl)
+			ld	l,a
+			ld	l,d
+			call	po,Lf21b
+			dec	d
+			ld	(afc9h),a
+			ld	a,(de)
+			inc	(hl)
+			ld	a,(de)
+			dec	de
+			add	hl,bc
+			inc	c
+			or	b
+			ld	c,h
+			xor	l
+			xor	73h
+			adc	a,37h
+			inc	d
+			im	2
+			ld	d,l
+			ld	b,b
+			sbc	a,d
+			xor	h
+			call	p,Lf4d3
+			ld	a,(bc)
+			ld	b,e
+			rst	38h
+			or	l
+			inc	h
+			and	b
+			and	h
+			ld	b,(hl)
+			cp	(hl)
+			ld	b,7dh
+			ld	l,c
+			ret	z
+			xor	b
+			ld	h,h
+			ld	h,h
+			jp	nz,Ldfd8
+			rst	38h
+			ld	(hl),c
+			ld	h,e
+			xor	l
+			xor	h
+			cp	d
+			sbc	a,d
+			adc	a,a
+			ld	(hl),b
+			ld	b,l
+			jp	m,L0383
+			ret	nz
+			jp	c,L54ef
+			cpl
+			ld	h,a
+			ld	h,h
+			ld	sp,42c6h
+			rst	10h
+			dec	bc
+			rst	00h
+			dec	a
+			ld	(9808h),a
+			ld	d,d
+			cp	(hl)
+			ld	(hl),c
+			ld	b,d
+			dec	l
+			ld	d,c
+			sub	h
+			ret	c
+			dec	l
+			jp	nc,Lee41
+			sbc	a,(hl)
+			ld	e,93h
+			and	h
+			ld	a,(hl)
+			ccf
+			adc	a,78h
+			dec	sp
+			sbc	a,e
+			adc	a,b
+			ld	a,(de)
+			cp	c
+			ld	d,a
+			xor	e
+			sbc	a,e
+			and	d
+			rrca
+			ld	b,0dh
+			ld	l,d
+			rst	00h
+			call	po,L91ad
+			xor	13h
+			ld	e,(hl)
+			ld	l,l
+			jr	c,L81cd
+			sbc	a,e
+			dec	a
+			ret	pe
+			cp	(hl)
+			sub	b
+			pop	af
+			nop
+			and	b
+			ld	h,l
+			or	c
+			ld	b,h
+			cp	b
+			dec	sp
+			call	z,L6b11
+			jp	p,L87c1
+			ld	c,l
+			inc	h
+			ld	b,b
+			dec	d
+			jp	nz,L9c83
+			ld	a,l
+			add	a,c
+			inc	h
+			ld	(hl),b
+			jr	z,L8292
+			and	l
+			inc	bc
+			sub	e
+			call	L6a5a
+			daa
+			inc	hl
+			ccf
+			ld	h,c
+			ei
+			rst	00h
+			xor	h
+			ld	(bc),a
+			ret	z
+			dec	h
+			ld	d,c
+			ld	e,(hl)
+			ld	b,(hl)
+			and	d
+			xor	d
+			ld	a,eeh
+			call	p,L94ea
+			jp	(hl)
+			db	f2h,a4h,77h,66h,6fh,c4h,e3h,4fh
+			db	c1h,9eh,cah,4bh,b4h,d8h,1dh,6bh
+			db	28h,96h,04h,ffh,7dh,72h,bah,afh
+			db	0bh,2eh,75h,b7h,87h,3ch,4eh,b9h
+			db	90h,83h,75h,27h,07h
+			ld	d,eeh
+			ld	h,h
+			call	c,L666f
+			jr	nc,L821b
+			and	5ch
+			adc	a,(hl)
+			ld	h,17h
+			ld	(hl),h
+			ld	d,h
+			sub	c
+			ld	e,h
+			xor	c
+			ld	e,l
+			ld	(hl),e
+			or	cdh
+			ld	l,e
+			cp	c
+			jr	nc,L8230
+			sub	c
+			ld	(741dh),hl
+			ld	c,d
+			ld	(de),a
+			and	c
+			ld	l,feh
+			inc	hl
+			sub	h
+			dec	a
+			ld	h,h
+			ld	c,5ch
+			ld	b,(hl)
+			ld	b,(ix + 54h)
+			ld	b,l
+			ld	a,a
+			ld	l,a7h
+			ld	d,e
+			or	(hl)
+			add	a,a
+			ld	h,(hl)
+			call	c,L8add
+			dec	c
+			call	nc,Lf97d
+			sub	b
+			rlca
+			and	l
+			sub	d2h
+			sub	25h
+			sbc	a,10h
+			ld	c,a
+			add	a,25h
+			jr	c,L8267
+			and	a
+			cp	d
+			ld	c,b
+			sub	ceh
+			ld	sp,hl
+			ex	de,hl
+			sub	d
+			cp	e
+			ld	b,h
+			sbc	a,l
+			rrca
+			and	b
+			dec	hl
+			ld	hl,(b681h)
+			call	po,L3284
+			ld	d,d
+			ld	d,c
+			add	a,d
+			ld	c,l
+			push	bc
+			adc	a,a
+			ld	l,c
+			jr	c,L8295
+			inc	h
+			or	d
+			ld	a,1ah
+			jp	po,L0022
+			pop	bc
+			add	a,c
+			ld	a,b
+			dec	d
+			ld	e,a
+			ld	a,l
+			inc	sp
+			sub	b
+			dec	b
+			nop
+			cp	a
+			jp	m,L2147
+			adc	a,a
+			and	c
+			ld	e,(hl)
+			exx
+			or	iyh *
+			or	h
+			di
+			rst	20h
+			xor	c
+			ld	e,d
+			add	hl,bc
+			ld	h,a
+			jp	L477f
+			db	59h,05h,1ch,35h,2fh,73h,1ah
+			adc	a,c
+			sub	a
+			ret
+			db	0fh,14h,a1h,c9h,38h,74h,15h,62h
+			db	09h,f8h,89h,4eh,8fh,e2h,47h,ffh
+			db	99h,01h,93h,06h,dah,5dh,e4h,d4h
+			db	10h,e4h,f0h,46h,4ch,9dh,dch,aeh
+			db	e2h,a3h,96h,dah,b6h,5fh,d6h,31h
+			db	78h,5ah,a2h,ach,5dh,a7h,17h,9fh
+			db	7dh,e2h,89h,c7h,cah,61h,a3h,2ah
+			db	18h,27h,3ah,b3h,50h,eeh,d2h,52h
+			db	b9h,ebh,e0h,8dh,2bh,c1h,11h,a4h
+			db	f0h,d7h,ach,19h,74h,15h,d2h,21h
+			db	c0h,e0h,26h,20h,8eh,93h,a8h,41h
+			db	1dh,1fh,d6h,9ah,37h,50h,c6h,67h
+			db	fch
+			call	z,L3709
+			inc	c
+			set	2,a
+			ex	de,hl
+			sbc	a,e
+			inc	l
+			adc	a,h
+			ld	h,l
+			ld	l,(hl)
+			dec	(hl)
+			inc	bc
+			push	bc
+			ld	c,e
+			sub	d
+			in	a,(3ch)
+			ld	b,l
+			xor	f9h
+			jr	nz,L8325
+			inc	b
+			rst	20h
+			add	a,a
+			push	de
+			or	c6h
+			nop
+			sbc	a,(hl)
+			inc	h
+			or	b
+			rst	20h
+			jr	L83e9
+			db	3dh,8fh,24h,0dh,d0h,92h,d3h,08h
+			db	a5h,42h,bah,7ah,d9h,88h,9ch,e0h
+			db	deh,79h,90h,9eh,74h,7ah,ebh,d3h
+			db	69h,bfh,48h,adh,ceh,cch,a7h,b4h
+			db	43h,4fh,02h,88h,bdh,56h,9eh,f2h
+			db	1eh,9ah,7fh,97h,79h,85h,e5h,34h
+			db	b8h,d2h,2ah,e4h,dbh,22h,b6h,61h
+			db	c9h,27h,2fh
+			dec	c
+			jp	(hl)
+			db	bch,75h,66h,7bh,6eh,40h
+			ld	a,(11cch)
+			ret	po
+			jr	nz,L83f1
+			pop	bc
+			ld	l,h
+			ld	e,92h
+			ld	c,(hl)
+			or	h
+			sbc	a,h
+			xor	d
+			ld	a,a
+			rst	28h
+			or	a
+			cp	d
+			add	hl,bc
+			ld	b,c
+			ld	e,l
+			jp	Lba67
+			db	b0h,b4h,7dh,ceh,b0h,fah,efh,dbh
+			db	fbh,4ah,35h,68h,e6h,98h,47h,87h
+			db	27h,60h,26h,e3h,11h,00h,95h,3eh
+			db	5ch,76h,b7h,f1h,8bh,05h,c1h,11h
+			db	95h,e2h,78h,68h,44h,e7h,99h,c8h
+			db	e9h,cch,bfh,cfh,f0h,cdh,1dh,e0h
+			db	0bh,6ah,d7h,a1h,08h,8fh,23h,8ch
+			db	6dh,cah
+			ld	c,h
+			cp	e
+			inc	h
+			ld	h,e
+			ld	(bc),a
+			rst	28h
+			ld	(hl),05h
+			sub	l
+			inc	sp
+			ld	c,a
+			and	a
+			ld	a,(de)
+			jr	nz,L83f2
+			ld	l,d
+			dec	a
+			sbc	a,l
+			sub	l
+			jr	c,L847e
+			inc	e
+			ld	a,b
+			or	h
+			sbc	a,b
+			add	hl,de
+			ld	e,h
+			ld	b,b
+			sub	(hl)
+			ret	p
+			sbc	a,b
+			ld	l,d
+			add	hl,de
+			ld	e,(hl)
+			ld	hl,(6f4ch)
+			sbc	a,e
+			sbc	a,5ch
+			inc	l
+			and	b
+			ld	d,d
+			dec	de
+			ld	(hl),c
+			jp	(hl)
+			db	e6h,83h,45h,3dh,0eh,26h,7bh,ffh
+			db	92h,01h,41h,19h,05h
+			ld	h,l
+			ld	a,(bc)
+			adc	a,b
+			ld	e,(hl)
+			and	b
+			inc	a
+			ret	p
+			jp	p,L079d
+			ld	bc,0592h
+			scf
+			ld	hl,3f5fh
+			ret	po
+			add	a,(hl)
+			sub	h
+			pop	bc
+			ld	l,b
+			jp	pe,Lb669
+			dec	(hl)
+			in	a,(d7h)
+			ld	b,b1h
+			or	c
+			adc	a,a
+			cp	l
+			sbc	a,e
+			rst	30h
+			ld	h,l
+			ex	af,af'
+			xor	(hl)
+			ret	pe
+			ld	c,c
+			ld	h,a
+			ld	c,43h
+			add	a,e
+			ld	e,87h
+			ld	l,(hl)
+			add	a,l
+			ld	d,(hl)
+			sub	e
+			sub	c
+			rst	38h
+			sub	e
+			cp	a
+			sub	49h
+			cp	(hl)
+			ld	(hl),d
+			and	(hl)
+			ld	c,d
+			ld	(de),a
+			sbc	a,l
+			jp	z,Lcc7e
+			sbc	a,e
+			pop	de
+			dec	(hl)
+			ld	l,h
+			ld	e,l
+			sub	(hl)
+			ld	l,b
+			and	l
+			ld	b,e
+			ccf
+			ld	b,e
+			cp	a
+			ld	a,b
+			ld	a,(7c9ch)
+			ld	l,c
+			xor	b
+			add	hl,hl
+			jp	z,L27e1
+			sub	l
+			inc	bc
+			ret	po
+			ld	(hl),b
+			cp	d
+			rlca
+			ld	l,h
+			ld	(hl),l
+			sbc	a,c
+			ld	b,c
+			ccf
+			sbc	a,h
+			ld	l,l
+			ld	b,(hl)
+			push	hl
+			dec	a
+			ld	h,e
+			nop (2x) *
+			cp	c
+			exx
+			out	(5ah),a
+			ld	h,75h
+			and	b
+			ld	a,(92c3h)
+			jp	c,Lada2
+			ld	a,38h
+			halt
+			ld	e,c
+			cp	(hl)
+			ld	b,l
+			ld	b,(hl)
+			ld	b,a
+			ret	nz
+			or	b
+			xor	d
+			xor	94h
+			dec	h
+			ld	e,a
+			inc	hl
+			ld	e,(hl)
+			ld	h,a
+			daa
+			ld	hl,a25bh
+			jp	z,Lb1e5
+			xor	0eh
+			cp	c
+			xor	c
+			ld	(hl),d
+			xor	(hl)
+			inc	de
+			adc	a,h
+			ex	de,hl
+			ld	e,(hl)
+			push	hl
+			xor	a
+			sbc	a,d
+			ld	c,e
+			inc	(hl)
+			adc	a,88h
+			ld	c,(hl)
+			sbc	a,b
+			dec	hl
+			ld	c,b
+			inc	bc
+			sub	d
+			ld	e,b
+			and	(hl)
+			sbc	a,(hl)
+			sub	l
+			jp	nc,L9397
+			or	e
+			adc	a,b
+			rst	08h
+			ld	(hl),d
+			ld	l,c
+			sub	(hl)
+			or	0bh
+			di
+			cp	b
+			ld	h,a
+			sbc	a,a
+			ld	d,h
+			push	hl
+			dec	c
+			inc	c
+			call	m,L3d46
+			inc	bc
+			add	hl,de
+			xor	a
+			inc	hl
+			ld	(bc),a
+			ld	l,c
+			ld	e,a
+			add	a,l
+			add	a,d
+			jp	po,L6718
+			nop (2x) *
+			call	z,Lea0b
+			ld	l,a
+			dec	de
+			daa
+			jp	p,L79e8
+			jr	c,L8513
+			ld	d,l
+			scf
+			call	z,L022f
+			pop	bc
+			ld	c,d
+			ld	e,a
+			rrca
+			xor	d
+			jp	z,L31b6
+			call	nz,L51a1
+			xor	h
+			call	c,Lbbe8
+			ld	a,e
+			sbc	a,a
+			rst	18h
+			sub	h
+			add	a,d
+			ld	c,(hl)
+			adc	a,b
+			scf
+			ret	m
+			call	nz,L5438
+			jp	m,L722b
+			ld	l,c
+			call	L39ca
+			ld	b,(hl)
+			ld	c,d
+			call	nz,Ld275
+			ld	hl,554ch
+			ret	c
+			pop	de
+			ld	c,a
+			adc	a,a
+			ld	a,(4b4fh)
+			inc	(hl)
+			cp	h
+			djnz	L8536
+			add	hl,hl
+			ld	e,d
+			or	c
+			dec	c
+			or	d
+			push	de
+			ld	b,e
+			ld	a,h
+			ld	d,a
+			ld	l,c
+			ld	e,l
+			dec	a
+			ld	l,d
+			inc	a
+			sbc	a,l
+			jp	p,Lf25f
+			or	d
+			dec	c
+			jp	nz,L15a7
+			ld	(hl),a
+			ld	e,(hl)
+			ret
+			db	d9h,5eh,e2h,9fh,5dh,4eh,22h,3eh
+			db	55h,8ch,ceh,b9h,89h,93h,f6h,4dh
+			db	c3h,7ch,fbh,a0h,aah,c5h,d6h,0bh
+			db	20h,40h,9fh,32h,0ah,a5h,75h,4eh
+			db	a1h,bdh,36h,96h,dfh,87h,5ah,95h
+			db	c8h,a9h,c0h,65h,cbh,11h
+			inc	sp
+			ld	c,h
+			ld	e,d
+			call	pe,L0277
+			cp	l
+			sbc	a,b5h
+			xor	b
+			jr	c,L8596
+			scf
+			ld	d,39h
+			ld	d,h
+			ld	e,b
+			ld	a,l
+			rlca
+			ld	b,l
+			ld	hl,d6f8h
+			and	a
+			inc	c
+			ld	l,e
+			adc	a,h
+			adc	a,(hl)
+			or	b
+			ld	l,e
+			ld	(hl),25h
+			nop (2x) *
+			or	a
+			adc	a,l
+			ld	a,a
+			halt
+			ld	e,d
+			add	a,h
+			ld	e,a
+			ccf
+			sub	l
+			di
+			ld	e,h
+			sub	(hl)
+			ld	e,c
+			jp	po,L41a6
+			cp	7fh
+			ld	h,d
+			add	a,l
+			ld	a,(de)
+			dec	h
+			ld	(hl),b
+			call	m,L7da9
+			ld	h,h
+			cp	c
+			ld	l,a
+			dec	hl
+			nop (2x) *
+			halt
+			dec	e
+			rst	10h
+			jp	po,L6345
+			ld	d,a
+			sub	d
+			ret	m
+			or	d9h
+			ex	af,af'
+			sbc	a,c
+			cpl
+			ld	d,l
+			rst	30h
+			call	z,L0d55
+			daa
+			xor	d
+			ld	l,c
+			ld	(de),a
+			and	b
+			ld	hl,(L2a23)
+			ld	c,l
+			sbc	a,b
+			add	a,20h
+			adc	a,a
+			jp	p,Lb227
+			ld	l,(hl)
+			ld	h,2ah
+			and	c
+			ld	b,b
+			ld	h,d
+			cp	e3h
+			ld	a,85h
+			pop	bc
+			ld	(hl),a
+			ld	l,b
+			cp	c
+			ld	hl,ecbah
+			call	Ldc6d
+			ld	b,(hl)
+			ld	(hl),d
+			ld	a,d
+			jp	p,La79a
+			adc	a,l
+			add	a,e
+			ex	(sp),hl
+			cp	l
+			ld	c,h
+			cp	h
+			jr	L86a9
+			db	5bh,b4h,bdh,cch,3ah,10h,16h,71h
+			db	e1h,17h,56h,5eh,57h,a4h,16h,d6h
+			db	85h,7fh,e2h,50h,6fh,b2h,45h,f3h
+			db	deh,fdh,79h,a2h
+			sbc	a,33h
+			inc	(hl)
+			xor	04h
+			nop
+			xor	a
+			ret	p
+			call	pe,L1ae0
+			dec	c
+			halt
+			ld	d,h
+			ret	c
+			ret
+			db	20h,fbh,2fh,f5h,58h,71h,3ch,3dh
+			db	15h,bah,20h,31h,56h,53h
+			ld	e,c
+			ld	l,l
+			ld	a,(hl)
+			sub	c
+			rla
+			rst	30h
+			or	h
+			inc	de
+			ld	d,c1h
+			sub	a
+			ld	e,d
+			sub	b
+			ret	m
+			ld	l,d
+			ld	sp,bf07h
+			sub	h
+			sll	l
+			sub	b
+			rst	38h
+			ld	l,a
+			jp	nc,L71e1
+			ld	h,a
+			ld	e,(hl)
+			add	a,(hl)
+			ld	h,afh
+			xor	e
+			rrca
+			dec	de
+			ld	c,c
+			ld	d,a
+			rst	10h
+			xor	e1h
+			sub	e8h
+			push	hl
+			jp	c,Ldcfb
+			and	e
+			scf
+			and	e
+			ld	e,h
+			adc	a,06h
+			dec	sp
+			pop	de
+			cp	d
+			ld	d,d
+			ld	a,b
+			ex	af,af'
+			ld	l,l
+			dec	b
+			ex	(sp),hl
+			ei
+			inc	h
+			ld	c,(hl)
+			pop	hl
+			cp	c
+			rst	00h
+			jp	c,L8e6d
+			ex	(sp),hl
+			ld	d,94h
+			and	l
+			xor	e
+			ld	l,e
+			cp	h
+			ld	e,a
+			ld	(hl),c
+			ret	m
+			ld	c,l
+			rst	00h
+			sbc	a,a
+			jp	po,Lafd0
+			ld	(hl),l
+			dec	b
+			ld	e,65h
+			sbc	a,e
+			add	a,2eh
+			ld	c,c
+			ld	sp,92eeh
+			ld	(hl),b
+			ld	e,(hl)
+			xor	b
+			or	b
+			ld	a,l
+			add	a,d
+			sub	(hl)
+			cp	d
+			jr	c,L86c8
+			and	47h
+			call	m,Lf494
+			ld	a,a
+			dec	h
+			ex	af,af'
+			di
+			ld	l,d
+			jr	nz,L877b
+			add	a,(hl)
+			ld	h,l
+			cp	e
+			ld	a,64h
+			push	af
+			scf
+			ld	c,e
+			sub	d
+			rst	18h
+			inc	e
+			ld	a,(bc)
+			xor	b
+			rst	18h
+			ccf
+			inc	hl
+			ld	h,e
+			sub	d
+			or	c
+			sbc	a,e
+			ret	c
+			adc	a,d
+			ld	e,(hl)
+			ld	hl,(e089h)
+			ei
+			ld	l,c
+			ret
+			db	14h,4bh,f7h,2dh,39h,4dh,7ah,5bh
+			db	53h,2bh,edh,92h,efh,25h,04h,4bh
+			db	91h,62h,d8h,ffh,aeh,4fh,beh,f3h
+			db	8eh,0ah,7ah,01h,adh,7dh,beh,65h
+			db	6ch,a1h,efh,64h,96h,f1h,8fh,40h
+			db	cbh,beh,19h,beh,ffh,80h,dah,94h
+			db	ffh,26h,d4h,26h,39h,deh,05h,f4h
+			db	b2h,f8h,adh,95h,2fh,7eh,44h,9ch
+			db	6ah,1fh,8bh,24h,b2h,d8h,ffh,eah
+			db	d2h,95h,79h,a6h,0fh,81h
+			jp	nz,Ld2cd
+			ld	h,h
+			ld	hl,6891h
+			cp	b
+			jr	nz,L87fe
+			add	a,l
+			ld	(hl),b
+			or	c
+			and	b
+			call	m,L689d
+			sub	7ch
+			ld	l,c
+			ei
+			in	a,(d9h)
+			ld	(4ebdh),hl
+			and	d
+			ld	sp,f63ch
+			ld	(bc),a
+			ld	c,b
+			and	beh
+			inc	a
+			dec	hl
+			ld	(hl),h
+			ld	b,l
+			sbc	a,2dh
+			sbc	a,c
+			pop	bc
+			push	hl
+			ld	e,d
+			add	hl,de
+			ld	a,a
+			sbc	a,(hl)
+			ld	(hl),e
+			dec	a
+			or	e
+			ld	a,(bc)
+			adc	a,e
+			push	af
+			ld	b,h
+			sbc	a,d
+			ld	c,d
+			ld	l,e
+			add	hl,hl
+			adc	a,l
+			sub	h
+			ld	a,(bc)
+			ld	e,cch
+			and	(hl)
+			jr	nz,L8823
+			ld	h,(hl)
+			xor	h
+			call	nz,L8065
+			rst	30h
+			ld	(bfabh),a
+			jp	nc,L4748
+			djnz	L8827
+			dec	d
+			ld	a,(hl)
+			inc	l
+			add	a,48h
+			ld	l,32h
+			or	d
+			xor	12h
+			pop	af
+			xor	(hl)
+			xor	a1h
+			rst	30h
+			add	a,h
+			jp	c,L9bfc
+			xor	h
+			ld	(bc),a
+			exx
+			ld	e,fah
+			ld	b,6ah
+			adc	a,a
+			sub	a2h
+			adc	a,e
+			ld	e,a
+			call	nz,Lc44a
+			ld	c,l
+			ld	l,a
+			ld	a,h
+			nop (2x) *
+			jp	pe,L7002
+			and	c
+			dec	bc
+			rra
+			ret	p
+			ex	de,hl
+			or	l
+			add	a,d
+			ld	b,(hl)
+			exx
+			cpl
+			ld	(de),a
+			xor	(hl)
+			rst	08h
+			pop	de
+			di
+			ld	d,71h
+			and	e
+			cp	(hl)
+			ld	c,h
+			ld	sp,8da6h
+			xor	h
+			ld	e,(hl)
+			ld	l,c
+			dec	(hl)
+			ret	pe
+			ld	l,a
+			pop	hl
+			adc	a,h
+			xor	l
+			ld	b,c
+			nop
+			inc	hl
+			ld	h,(hl)
+			ret	m
+			halt
+			ld	e,(hl)
+			adc	a,(hl)
+			ld	hl,(1935h)
+			inc	c
+			ld	c,h
+			cp	d
+			ld	ixl,ixl *
+			nop (2x) *
+			ret	nz
+			ld	e,(hl)
+			and	l
+			ld	c,b
+			adc	a,l
+			and	b
+			and	b
+			rst	30h
+			call	c,Lece4
+			rst	10h
+			call	c,Lf6b0
+			xor	b
+			inc	c
+			adc	a,d
+			ld	b,(hl)
+			ld	e,h
+			ld	hl,d384h
+			xor	d
+			ret	nz
+			adc	a,d
+			dec	(hl)
+			sbc	a,h
+			add	a,l
+			ld	d,b
+			dec	hl
+			adc	a,(hl)
+			ld	c,e
+			ret	nz
+			adc	a,e
+			or	a
+			xor	a
+			xor	h
+			and	a
+			pop	de
+			ld	c,a
+			in	a,(d1h)
+			ld	c,d
+			sub	l
+			rla
+			add	a,l
+			ld	bc,5643h
+			ld	h,h
+			ld	a,(hl)
+			ld	(hl),b
+			add	a,e2h
+			and	e
+			add	a,e
+			dec	bc
+			ex	(sp),hl
+			sub	a
+			sub	c
+			call	m,L49e7
+			ld	h,d
+			exx
+			add	a,b
+			ld	d,f9h
+			rst	18h
+			sbc	a,(hl)
+			or	(hl)
+			rrca
+			sbc	a,c
+			ex	de,hl
+			jp	z,L5e8a
+			rra
+			ret	z
+			ld	sp,f140h
+			ld	e,l
+			ld	a,a
+			rla
+			jr	nz,L88ce
+			ld	e,l
+			out	(f0h),a
+			or	l
+			ld	b,c
+			cp	95h
+			jp	nz,Lf592
+			ld	(hl),h
+			rrca
+			or	a
+			sub	l
+			jp	(hl)
+			db	e1h,fch,e5h,7fh,a3h,3eh,e8h,1ah
+			db	47h,0fh,4ah,95h
+			sbc	a,h
+			call	m,Lb4ef
+			ld	(hl),b
+			inc	bc
+			ld	b,l
+			ld	e,h
+			ld	h,a
+			or	b
+			ret	po
+			add	hl,de
+			ld	(hl),d
+			call	p,L0d4f
+			xor	d
+			dec	bc
+			jr	z,L88b6
+			ld	a,(de)
+			bit	0,h
+			cp	h
+			and	32h
+			add	a,37h
+			add	hl,hl
+			sub	d
+			ld	a,59h
+			sub	d
+			jp	nc,Ld40e
+			ld	a,h
+			ld	d,(hl)
+			call	z,L2ef6
+			xor	d
+			adc	a,c
+			inc	d
+			xor	65h
+			or	l
+			dec	de
+			rlca
+			ld	sp,0587h
+			pop	af
+			call	pe,L2dc6
+			ld	d,e
+			ld	l,d
+			ex	(sp),hl
+			inc	h
+			dec	(hl)
+			dec	de
+			or	(hl)
+			nop
+			ld	l,e
+			ld	d,d
+			ret	m
+			inc	bc
+			or	l
+			ld	h,h
+			call	c,L0e7d
+			dec	l
+			call	p,L2238
+			ld	l,6dh
+			ld	h,a
+			ld	b,h
+			dec	de
+			ret	pe
+			sbc	a,a
+			sbc	a,a
+			sbc	a,h
+			djnz	L88b3
+			inc	e
+			exx
+			and	e
+			sub	c
+			jp	p,L20ad
+			and	d
+			adc	a,b
+			add	a,e
+			ld	l,h
+			rst	28h
+			sub	l
+			dec	hl
+			in	a,(44h)
+			ld	a,(de)
+			ld	l,b
+			ld	d,c
+			ld	l,h
+			ld	a,l
+			jp	nc,L8837
+			ld	h,e
+			inc	de
+			sbc	a,l
+			di
+			inc	hl
+			ld	a,a
+			or	b
+			jr	L8897
+			db	d5h
+			rst	38h
+			jr	c,L8948
+			daa
+			sbc	a,c
+			jp	pe,Ld58e
+			call	m,L7dc0
+			ld	l,b
+			sub	b
+			adc	a,e
+			rrca
+			ld	c,6fh
+			ld	b,(hl)
+			dec	sp
+			ld	c,(hl)
+			ld	e,2eh
+			cp	b
+			ld	d,e
+			adc	a,h
+			rlca
+			ld	c,ddh
+			adc	a,a
+			inc	a
+			exx
+			add	a,a
+			dec	c
+			inc	a
+			sub	b
+			ld	a,h
+			ld	e,l
+			call	c,L5bf9
+			inc	b
+			ei
+			dec	h
+			and	a
+			ld	c,b
+			pop	de
+			ld	h,a
+			sbc	a,(hl)
+			ld	b,b
+			ld	c,a
+			ei
+			and	l
+			ld	h,a
+			or	b
+			ret	z
+			and	l
+			ld	l,l
+			jp	p,Lc9dd
+			or	h
+			xor	c
+			push	bc
+			adc	a,b
+			call	po,Ld751
+			jr	nc,L8911
+			add	a,d
+			inc	hl
+			sub	e
+			or	b
+			add	a,e
+			ld	c,c
+			nop (2x) *
+			sub	e
+			or	h
+			ld	hl,(85b8h)
+			add	a,l
+			ret	z
+			sbc	a,c
+			ld	c,h
+			inc	(hl)
+			ld	b,h
+			or	c
+			push	af
+			sub	(hl)
+			nop (2x) *
+			rst	08h
+			adc	a,a
+			or	e
+			ld	(hl),h
+			ret	po
+			ld	c,a
+			ld	b,h
+			push	de
+			ld	e,b
+			rrca
+			ret	nz
+			sbc	a,b
+			ld	e,d
+			ld	e,(hl)
+			jp	pe,L4ba2
+			add	a,l
+			inc	c
+			dec	bc
+			rrc	b
+			add	hl,hl
+			ld	l,h
+			jp	p,L766f
+			halt
+			scf
+			and	h
+			cp	b
+			ex	(sp),hl
+			rst	38h
+			nop (2x) *
+			nop (2x) *
+			nop (2x) *
+			pop	de
+			ld	d,a
+			ld	hl,(9624h)
+			ld	c,h
+			dec	l
+			and	(hl)
+			and	c
+			ld	c,fbh
+			rrca
+			sub	b
+			inc	a
+			ld	c,b
+			cp	h
+			ld	(3b33h),a
+			ld	(hl),c
+			ld	b,h
+			ld	e,d
+			dec	h
+			ld	d,a
+			sbc	a,b
+			add	a,f9h
+			dec	hl
+			in	a,(93h)
+			sub	d
+			adc	a,d
+			dec	d
+			jr	nc,L8a14
+			jp	m,L2aa6
+			jp	nc,Lc3e7
+			jr	c,L8950
+			ld	a,b
+			add	a,h
+			ld	b,d
+			call	po,L3384
+			or	(hl)
+			out	(c),l
+			djnz	L89a5
+			and	d
+			ld	b,c
+			cp	c
+			jp	p,L4fdf
+			sub	a
+			ld	c,e
+			ld	e,e
+			cp	e
+			dec	h
+			ld	c,e
+			in	a,(31h)
+			ld	b,a
+			call	po,Lfeb9
+			and	d
+			or	c
+			adc	a,l
+			add	hl,sp
+			ld	h,a
+			inc	a
+			jp	z,L8443
+			dec	c
+			and	65h
+			sub	b
+			add	a,l
+			ld	l,(hl)
+			dec	bc
+			cp	e2h
+			ld	d,c
+			ld	l,c
+			rst	18h
+			ld	sp,hl
+			set	6,(hl)
+			jp	nc,Lbc3d
+			ld	c,e
+			add	a,a3h
+			dec	(hl)
+			cp	b
+			dec	bc
+			ld	b,h
+			ld	l,b
+			dec	hl
+			sbc	a,b
+			add	a,l
+			ld	c,h
+			cp	a
+			ld	a,(de)
+			in	a,(ceh)
+			cp	0fh
+			ld	d,h
+			jp	nz,Lba4a
+			rst	00h
+			out	(9fh),a
+			ld	(hl),h
+			or	(hl)
+			inc	a
+			ld	d,l
+			pop	hl
+			cp	03h
+			call	po,L86cb
+			ld	a,(de)
+			rst	18h
+			ld	e,l
+			xor	c
+			jr	L8a69
+			db	8fh,8ch,03h,f7h,91h,14h,10h,d1h
+			db	aah,6dh,b7h,9dh,1eh,38h,43h,3fh
+			db	afh,26h,e8h,6ah,cah,bbh,10h,3ch
+			db	82h,16h,49h,fch,c5h,b7h,54h,1eh
+			db	5fh,56h,a5h,e1h,c1h,05h,23h,f6h
+			db	c0h,25h,15h,eah,71h,35h,a5h,cdh
+			db	60h,81h,c4h,d5h,30h,7ah,61h,cfh
+			db	12h,68h,b9h,23h,f4h,f6h,28h,ech
+			db	13h,0dh,59h,ech,f6h,61h,b5h,76h
+			db	41h,35h,b6h
+			ld	a,25h
+			ret	nc
+			cp	23h
+			adc	a,b
+			ld	a,(de)
+			cp	(hl)
+			ld	c,h
+			inc	(hl)
+			ld	l,68h
+			jr	nc,L8a86
+			and	a
+			ld	l,c
+			cp	a
+			call	nz,L9c6b
+			rra
+			add	hl,bc
+			call	m,Ldc1d
+			dec	hl
+			or	a
+			ld	c,h
+			push	af
+			add	a,5ch
+			sub	h
+			pop	af
+			jp	nc,L5f53
+			dec	(hl)
+			and	e
+			inc	hl
+			call	L3b6a
+			inc	b
+			sub	e
+			sub	28h
+			sub	e
+			cp	e
+			dec	hl
+			jp	po,L1be7
+			ld	h,h
+			ld	l,l
+			ld	(hl),a
+			ld	a,a
+			ld	b,b
+			cp	h
+			ld	e,h
+			cp	c
+			ex	de,hl
+			inc	d
+			cp	h
+			ld	c,b
+			or	d
+			xor	d
+			dec	(hl)
+			ld	a,68h
+			ld	b,d
+			ret
+			add	a,a
+			jp	z,Lce0c
+			cp	d0h
+			ld	e,(hl)
+			ld	(de),a
+			ld	a,d
+			ld	e,a
+			pop	hl
+			sbc	a,b
+			ld	(04c3h),hl
+			inc	l
+			or	b
+			ld	(de),a
+			add	a,(hl)
+			ld	c,h
+			cpl
+			jp	(hl)
+			db	c4h,74h,8dh,2ch,4eh,cah,9eh,19h
+			db	b3h,4ch,f8h,57h,92h,e1h,b4h
+			or	(hl)
+			ld	h,d
+			rst	00h
+			xor	b
+			ld	l,7dh
+			sub	e
+			cp	c
+			jp	c,L8f05
+			ld	c,d
+			ld	h,l
+			adc	a,l
+			push	hl
+			rst	10h
+			ld	h,(hl)
+			ret	p
+			ld	l,b
+			cp	b
+			jp	pe,L53f6
+			ld	d,e
+			ld	c,2eh
+			sbc	a,(hl)
+			ret	nc
+			ld	l,l
+			ld	a,(bc)
+			call	Lb6ad
+			inc	l
+			scf
+			adc	a,(hl)
+			call	pe,Ld0de
+			sbc	a,c
+			adc	a,b
+			scf
+			ld	c,l
+			ret	z
+			or	e
+			and	e
+			ld	b,e
+			nop
+			ld	l,b
+			ld	h,e
+			ld	b,d
+			add	hl,sp
+			jp	nz,Lc992
+			adc	a,d
+			ld	h,d
+			ld	h,(hl)
+			cp	d
+			and	51h
+			jp	po,Lb573
+			sub	a
+			exx
+			ld	l,l
+			ld	hl,d7b0h
+			ld	e,(hl)
+			ld	l,a
+			ld	d,73h
+			dec	bc
+			dec	de
+			rst	28h
+			adc	a,b
+			and	(hl)
+			res	0,e
+			add	hl,de
+			dec	l
+			inc	c
+			ld	c,a
+			ld	d,b
+			ld	l,h
+			inc	a
+			ld	a,(bc)
+			xor	dbh
+			sbc	a,l
+			xor	d6h
+			call	c,Lb702
+			ld	l,l
+			ld	bc,b30ch
+			ld	h,a
+			sub	d
+			inc	h
+			cp	d
+			adc	a,d
+			sub	b
+			ld	c,f0h
+			jp	nc,Lab7c
+			ld	a,l
+			ld	b,8ah
+			sub	e
+			ld	b,a
+			ld	b,c
+			ld	e,a
+			ret	po
+			and	d
+			rra
+			ld	(hl),b
+			rst	20h
+			cp	(hl)
+			ld	a,l
+			ld	de,c0c0h
+			sbc	a,c
+			ld	h,d
+			ld	a,(c8dfh)
+			dec	c
+			dec	bc
+			and	a
+			add	a,e
+			ld	c,b
+			add	a,l
+			adc	a,d
+			ld	h,d
+			rst	28h
+			ld	b,e
+			inc	a
+			ei
+			halt
+			sbc	a,a
+			ld	d,b
+			ld	l,d
+			ld	e,h
+			ld	a,(bc)
+			ex	(sp),hl
+			ld	d,d
+			ld	l,b
+			ld	c,l
+			ld	(5706h),iy
+			ld	(hl),l
+			ld	l,d
+			inc	hl
+			rst	20h
+			sub	h
+			or	d
+			nop (2x) *
+			ld	b,l
+			sub	0ch
+			ld	c,c
+			ld	(hl),d
+			adc	a,a
+			ld	d,h
+			ld	e,b
+			adc	a,b
+			ld	e,(hl)
+			add	a,a
+			pop	hl
+			xor	e
+			inc	a
+			ld	h,l
+			ld	d,(hl)
+			ld	(hl),50h
+			ld	a,(de)
+			ld	h,87h
+			rlc	a
+			dec	(hl)
+			call	c,L9f33
+			ld	c,h
+			ld	b,c
+			call	p,Lf80e
+			ld	b,l
+			djnz	L8b41
+			cp	(hl)
+			push	bc
+			ld	a,(2eb5h)
+			sub	b6h
+			or	b
+			rrca
+			ret	nc
+			jp	p,L1348
+			ld	e,(hl)
+			call	m,L5a09
+			jp	c,L1a4c
+			ld	(hl),l
+			rst	30h
+			cp	l
+			call	p,L7d9a
+			ret	nz
+			or	b
+			ex	(sp),hl
+			ld	d,d
+			dec	e
+			ld	h,b
+			ld	l,h
+			sbc	a,c
+			ld	l,e
+			ld	d,a
+			jp	p,L178f
+			ld	e,b
+			ld	(hl),e
+			push	hl
+			inc	b
+			ld	d,a
+			ret	c
+			ld	h,h
+			sub	d
+			ld	e,b
+			call	nc,Lb0d6
+			push	af
+			and	66h
+			ld	e,d
+			ld	h,9ch
+			cp	l
+			ret	z
+			dec	(hl)
+			adc	a,c
+			add	hl,sp
+			ld	(hl),b
+			ld	sp,a148h
+			ld	a,(hl)
+			and	b
+			rst	10h
+			ld	(hl),l
+			ld	sp,hl
+			ret	nz
+			adc	a,d
+			dec	d
+			ld	a,a
+			rra
+			jp	nc,Lbc76
+			pop	hl
+			ld	e,c
+			ld	(hl),c
+			ret	c
+			inc	sp
+			ld	(4147h),hl
+			push	af
+			cp	a
+			inc	bc
+			ld	sp,hl
+			inc	de
+			ld	d,b
+			ld	e,c
+			halt
+			jr	nc,L8bbc
+			cp	a
+			ld	h,l
+			ld	h,h
+			ld	h,h
+			and	h
+			ld	hl,(3c1ch)
+			sbc	a,h
+			adc	a,l
+			xor	d
+			adc	a,h
+			rst	10h
+			and	e
+			sbc	a,a
+			ld	e,e
+			jr	z,L8c32
+			or	(hl)
+			call	nc,Le8fe
+			ld	c,d
+			ld	d,35h
+			sbc	a,b
+			outd
+			ld	l,d
+			push	hl
+			call	m,L1d9e
+			rst	38h
+			add	a,d2h
+			cp	(hl)
+			jp	Lf4eb
+			db	84h,c2h,6ah,eeh,c4h,6dh,dfh,46h
+			db	0eh
+			and	b
+			ld	a,l
+			dec	sp
+			ex	(sp),hl
+			ret
+			db	58h,23h,47h
+			or	d
+			ld	a,42h
+			and	c
+			add	a,h
+			push	hl
+			or	h
+			sbc	a,c
+			ld	l,d
+			ld	(hl),c
+			ld	a,e
+			ld	h,0fh
+			jp	p,Lf8fe
+			or	b
+			sbc	a,a
+			ld	l,(hl)
+			nop (2x) *
+			ex	de,hl
+			out	(7fh),a
+			ld	c,d
+			add	a,l
+			ld	b,d
+			exx
+			ld	b,23h
+			ld	d,d
+			ld	sp,hl
+			dec	b
+			ex	af,af'
+			or	b
+			xor	c
+			ld	l,c
+			rst	00h
+			sub	e
+			sub	(hl)
+			rrca
+			ld	b,h
+			inc	c
+			add	a,e
+			adc	a,c
+			add	a,c
+			sub	f7h
+			dec	c
+			rst	30h
+			push	hl
+			add	hl,sp
+			ld	a,(de)
+			rrca
+			xor	e
+			ld	l,h
+			ld	e,h
+			ld	b,l
+			and	h
+			add	hl,de
+			and	d
+			ld	(bc),a
+			ld	c,e
+			ld	h,l
+			rst	30h
+			adc	a,l
+			sbc	a,c
+			inc	c
+			dec	de
+			sub	l
+			dec	h
+			ld	a,h
+			call	p,L3d2e
+			ld	c,h
+			jr	nc,L8ca8
+			xor	(hl)
+			sub	57h
+			xor	b
+			sub	d
+			ret	nz
+			push	af
+			dec	hl
+			ld	c,c
+			jr	z,L8c15
+			add	a,(hl)
+			jp	c,Lf652
+			inc	e
+			ld	d,l
+			or	27h
+			ld	c,c
+			sbc	a,c
+			ld	sp,hl
+			ld	(hl),07h
+			ld	c,d
+			add	hl,de
+			sbc	a,l
+			nop
+			jp	L509f
+			db	ceh,feh
+			adc	a,(hl)
+			ld	(de),a
+			sbc	a,b
+			ld	b,d
+			ld	c,d
+			adc	a,l
+			rra
+			cpl
+			ld	bc,90f2h
+			adc	a,b
+			pop	hl
+			ld	l,e
+			bit	0,b
+			ld	(hl),d
+			or	d6h
+			ex	(sp),hl
+			ld	b,b
+			ld	e,(hl)
+			ld	b,c
+			add	a,e
+			sub	e
+			ld	(hl),h
+			ld	c,l
+			ld	h,(hl)
+			rst	30h
+			cp	(hl)
+			rlca
+			xor	h
+			add	a,(hl)
+			push	bc
+			sub	7ah
+			sbc	a,e
+			ld	e,e
+			ei
+			jp	nz,Lbb19
+			ld	c,a
+			cp	49h
+			adc	a,0dh
+			add	a,b
+			ld	b,a5h
+			or	a
+			ld	a,l
+			ld	(hl),c
+			add	a,h
+			ld	bc,d39dh
+			ld	h,l
+			sub	43h
+			ret	c
+			dec	b
+			ld	d,d
+			ld	(hl),h
+			ld	e,c
+			ld	b,d
+			ld	(b164h),a
+			inc	h
+			jp	nz,L295f
+			ret	p
+			and	2ah
+			ld	l,b
+			ld	de,0edch
+			ld	(de),a
+			cpl
+			dec	d
+			ld	a,d
+			call	z,L1df3
+			nop (2x) *
+			dec	sp
+			xor	a
+			add	hl,hl
+			add	hl,bc
+			ret	po
+			inc	sp
+			or	d
+			or	h
+			dec	hl
+			ld	h,l
+			ld	d,c
+			sbc	a,e
+			rst	38h
+			dec	b
+			ld	(hl),d
+			ld	l,l
+			ld	(hl),c
+			ld	a,h
+			ld	(bc),a
+			rst	28h
+			and	c
+			ld	d,(hl)
+			inc	(hl)
+			sub	(hl)
+			inc	a
+			cp	f3h
+			and	h
+			adc	a,c
+			ld	h,d
+			rst	30h
+			rst	18h
+			ld	bc,f16ah
+			sub	c
+			ret
+			dec	a
+			sbc	a,b
+			ld	d,h
+			ld	b,a
+			xor	c
+			or	e
+			ld	e,d
+			and	a
+			jp	c,L5649
+			jp	(hl)
+			db	43h,99h,d8h,9fh,cah
+			ret	po
+			ld	l,e0h
+			ld	a,f2h
+			ex	(sp),hl
+			ld	c,c
+			or	a
+			ld	(bc),a
+			adc	a,a
+			and	d
+			ld	a,c
+			ld	a,b
+			inc	h
+			ld	bc,786ch
+			ret	c
+			call	z,L88ec
+			dec	h
+			ld	b,h
+			daa
+			or	12h
+			jp	nz,Lcdb9
+			ld	l,(hl)
+			ld	h,b
+			nop (2x) *
+			dec	hl
+			ret	po
+			jp	z,Le11d
+			ld	h,e
+			inc	h
+			ld	hl,40d2h
+			ld	(hl),l
+			and	(hl)
+			or	b
+			sbc	a,d4h
+			rst	10h
+			jp	z,Lcd15
+			jp	po,L572d
+			ld	a,(db5dh)
+			ld	e,b
+			ret	po
+			or	a
+			adc	a,a
+			cpl
+			jp	Lc91f
+			db	b9h,5ah,27h,d0h,7eh,79h,f9h,a8h
+			db	aeh,09h,8dh,85h,b0h,1fh,dah,8ah
+			db	7bh,13h,e6h,53h,59h,42h,50h,f1h
+			db	9ah,74h,a7h,abh,07h,27h,89h,a2h
+			db	6ch,59h,3dh,3dh,51h,d0h,d7h,01h
+			db	3ch,83h,06h,68h,c4h,c2h,c9h,e5h
+			db	eah,3ah,1bh,77h
+			adc	a,a
+			sub	h
+			ld	(hl),h
+			in	a,(c4h)
+			ld	hl,(1840h)
+			adc	a,c
+			in	a,(06h)
+			add	hl,bc
+			ld	(44fbh),hl
+			ld	c,d
+			ld	(hl),d
+			adc	a,cch
+			inc	d
+			rlca
+			jp	nz,L9110
+			cp	(hl)
+			cpl
+			push	hl
+			ret
+			db	73h,7dh,25h,89h,0ch,68h,65h,ach
+			db	26h,83h,8dh,c1h,a3h,15h,f3h,e8h
+			db	6dh,03h,37h,b1h,e8h,d6h,86h,88h
+			db	75h,86h,3fh,7bh,e5h,91h,48h,6ch
+			db	8bh,6dh,92h,bbh,55h,2ch,e6h,d6h
+			db	2bh,60h,23h,4bh,0ah,5eh,59h,1ch
+			db	adh,45h,95h,68h,46h,36h,01h,e2h
+			db	47h,1ah,69h,d5h,3fh,46h,87h,09h
+			db	72h,aah,efh,15h,e4h,41h,f9h,76h
+			db	a8h
+			ld	(bc),a
+			push	bc
+			sbc	a,e
+			ld	(hl),d
+			rla
+			dec	b
+			xor	c6h
+			sbc	a,(hl)
+			ld	a,e
+			ld	a,(bc)
+			ld	a,c
+			xor	b
+			call	po,L04d5
+			ld	l,a
+			rst	18h
+			jr	L8e5d
+			db	02h,f0h,6fh,5bh,ebh,32h,a3h,08h
+			db	f0h,f0h,57h,cfh,e6h,87h,d9h,39h
+			db	b2h,edh
+			add	a,09h
+			ld	b,l
+			and	(hl)
+			add	a,h
+			add	a,(hl)
+			ld	h,b
+			or	c
+			ld	l,b
+			cpl
+			ld	(hl),e
+			ld	h,a
+			ex	af,af'
+			or	ech
+			add	a,l
+			rst	38h
+			ld	d,(hl)
+			ex	(sp),hl
+			cp	d
+			ex	(sp),hl
+			dec	a
+			adc	a,c
+			ret	c
+			cp	(hl)
+			sbc	a,74h
+			ld	l,l
+			inc	(hl)
+			dec	e
+			ld	h,(hl)
+			ld	bc,07e6h
+			jp	z,Lc6fe
+			sub	h
+			call	nc,L1c10
+			ld	c,b
+			pop	hl
+			and	(hl)
+			djnz	L8e7d
+			ld	a,h
+			dec	b
+			sub	b
+			dec	d
+			jr	L8e37
+			db	c3h,f1h
+			ld	h,01h
+			ld	c,b
+			or	(hl)
+			ld	h,a
+			ld	d,a
+			ld	sp,hl
+			cp	e
+			dec	hl
+			cp	a
+			inc	c
+			add	hl,bc
+			ld	bc,cbbdh
+			ld	l,l
+			ld	b,c
+			jr	nc,L8eb4
+			sub	c
+			rst	18h
+			call	pe,L2d9a
+			sub	e
+			ld	b,(hl)
+			ld	b,h
+			ld	hl,5898h
+			dec	h
+			jp	p,L19dc
+			dec	h
+			call	c,L7767
+			add	hl,hl
+			and	e
+			and	d
+			or	h
+			inc	l
+			rst	20h
+			ld	d,h
+			djnz	L8e3c
+			xor	b
+			add	a,e
+			and	d
+			ld	l,l
+			ret	nz
+			or	c
+			cp	e
+			or	b
+			ld	b,l
+			ld	a,(de)
+			ld	h,d
+			sbc	a,l
+			sbc	a,a
+			dec	l
+			jp	m,L08e8
+			jr	c,L8eae
+			ld	h,d
+			ld	d,e
+			call	p,La351
+			xor	d
+			ld	a,l
+			inc	(hl)
+			add	a,c8h
+			cp	b
+			ld	b,07h
+			jp	(hl)
+			db	85h,fdh,c5h,2ah,f4h,77h,28h,32h
+			db	5dh,8eh,a6h,a3h,bch,43h,39h,dfh
+			db	a6h,75h,e5h
+			sbc	a,(hl)
+			ld	c,a
+			add	a,c
+			dec	b
+			ld	l,d
+			xor	a
+			or	ddh
+			sub	e
+			rst	10h
+			ld	(48f3h),a
+			ld	(hl),d
+			ld	a,l
+			ex	(sp),hl
+			ld	h,b
+			ld	e,b
+			ret	p
+			pop	bc
+			out	(cah),a
+			call	m,Lda11
+			add	a,a
+			adc	a,d
+			ld	sp,f2eah
+			add	a,l
+			pop	bc
+			push	af
+			ex	de,hl
+			ld	(hl),b
+			ld	c,49h
+			inc	hl
+			push	hl
+			rla
+			inc	b
+			ld	h,e
+			inc	bc
+			inc	h
+			and	a
+			ld	l,l
+			add	hl,sp
+			xor	d4h
+			ld	(hl),l
+			cp	l
+			rla
+			ld	d,a
+			jp	nz,L2a07
+			cp	b
+			jr	z,L8ef0
+			ld	h,l
+			rst	30h
+			ld	c,l
+			and	b
+			and	c
+			rst	18h
+			or	a
+			ld	e,(hl)
+			pop	hl
+			adc	a,a
+			rst	28h
+			xor	(ix + 4eh)
+			rst	00h
+			cpl
+			jp	c,L1c41
+			jp	(hl)
+			db	6bh,62h,3ch,1fh,d3h,0fh,cdh,d1h
+			db	71h,7fh,71h,6ch,fch,1fh,48h,fch
+			db	9ah,ffh,d9h,7fh,9fh,d4h,e6h,73h
+			db	95h,e5h,a0h,c2h,50h,27h,32h,10h
+			db	95h,40h,d2h,9eh,9ah,c1h,38h,23h
+			db	61h,09h,c0h,07h,9ch,78h
+			rst	00h
+			xor	l
+			cp	d
+			push	de
+			adc	a,h
+			ld	h,a
+			call	nz,Le956
+			ld	d,h
+			sub	a
+			ld	a,b
+			ld	d,l
+			sbc	a,c
+			sbc	a,b
+			jr	nc,L8f57
+			cp	d
+			ld	a,d
+			nop
+			ld	h,l
+			cp	c
+			ld	b,d
+			ld	l,(hl)
+			push	de
+			ld	e,l
+			ld	d,a
+			scf
+			jp	po,L1c2c
+			call	L0493
+			ld	a,d
+			ld	l,l
+			cpl
+			ld	e,e
+			pop	hl
+			call	pe,L867a
+			push	hl
+			call	m,Lc28d
+			ld	a,(de)
+			ld	hl,(d690h)
+			dec	a
+			or	h
+			or	a
+			ld	hl,(a628h)
+			scf
+			sbc	a,b
+			ld	e,h
+			ld	a,h
+			sbc	a,l
+			ld	sp,d3f5h
+			ld	(aa1ah),hl
+			ld	a,(de)
+			or	b
+			rlca
+			sub	e
+			cp	b
+			call	Ld92a
+			ld	h,h
+			nop (2x) *
+			ld	b,d
+			ret	m
+			inc	c
+			ld	b,h
+			ret	pe
+			ei
+			ld	a,e
+			ld	e,h
+			jp	nc,La1ff
+			ld	c,d
+			dec	sp
+			ld	l,a
+			jp	(hl)
+			db	49h,aeh,2ah,7dh,98h,32h,43h,11h
+			db	3ch,74h,deh,10h
+			call	pe,L700e
+			ld	a,(hl)
+			ld	a,(bc)
+			xor	e
+			jp	z,L3d60
+			ld	c,h
+			ld	(bc),a
+			ld	a,b
+			jr	L8fec
+			db	43h,66h,34h,1eh,6ch,dch,b1h,60h
+			db	0dh,82h,21h,08h,89h
+			add	a,b
+			ld	d,l
+			dec	de
+			adc	a,c
+			ld	h,c
+			daa
+			jr	z,L8fd0
+			ld	e,a
+			ld	d,b
+			add	a,d
+			dec	de
+			adc	a,d
+			ld	d,h
+			push	af
+			rst	10h
+			add	a,b
+			add	a,11h
+			rra
+			dec	c
+			daa
+			nop (2x) *
+			cp	e
+			adc	a,e
+			or	e
+			rst	30h
+			xor	d
+			ld	a,l
+			ld	c,c
+			add	a,50h
+			sbc	a,e
+			inc	a
+			sub	d
+			sbc	a,e9h
+			inc	de
+			ld	b,h
+			sbc	a,b
+			ret
+			db	60h,8fh,86h,ceh,24h,24h,1ch,fch
+			db	40h,1bh,67h,e3h,85h,64h,cdh,3dh
+			db	35h,d2h,63h,71h,8ch,35h,d3h,3eh
+			db	4fh,28h,cfh,74h,c4h,0ch,75h,6ah
+			db	56h,01h,30h,53h,88h,d7h,ceh,7eh
+			db	3ah,b4h,32h,a9h,d1h,a5h,66h,c7h
+			db	41h,18h,59h,08h,2ah,2bh,f0h,8bh
+			db	c0h,dah,fah,46h,7dh,20h,75h,33h
+			db	6fh,29h,1ch,f5h,91h,6ah,48h,3ch
+			db	75h,eeh,2eh,60h,e9h,5eh,7ah,0ah
+			db	5bh,c3h,5fh,4dh,50h,e6h,8fh,9ch
+			db	9bh,efh,68h,c5h,c7h,48h,37h,f0h
+			db	91h,d3h,72h
+			nop (2x) *
+			ld	d,a
+			di
+			jp	L35f6
+			db	40h,f6h,61h,0bh,36h,37h,18h,e2h
+			nop (2x) *
+			ld	b,a
+			sbc	a,l
+			or	d
+			ex	(sp),hl
+			ld	a,d
+			or	a
+			ld	b,c
+			rst	00h
+			xor	c
+			cpl
+			and	a
+			jp	po,L2142
+			ld	hl,9537h
+			ld	d,58h
+			ld	a,(de)
+			ld	(hl),l
+			ex	de,hl
+			ld	a,b
+			ret	m
+			ld	e,15h
+			ld	hl,8ba3h
+			ld	e,e
+			sub	24h
+			call	z,Le08d
+			sbc	a,e
+			jp	z,Led22
+			sub	l
+			out	(1bh),a
+			ld	l,d
+			ld	b,l
+			and	b
+			sbc	a,89h
+			ld	l,l
+			dec	b
+			sub	e
+			ld	c,l
+			or	l
+			ret	p
+			adc	a,d
+			adc	a,l
+			ld	b,l
+			rst	28h
+			jp	pe,L5644
+			ld	a,h
+			jp	pe,L9f52
+			dec	bc
+			ld	d,h
+			rst	18h
+			dec	bc
+			sbc	a,h
+			ld	h,(hl)
+			ld	c,c
+			sbc	a,b
+			ld	b,h
+			ld	(hl),l
+			set	0,b
+			ld	l,c
+			push	bc
+			ld	(hl),b
+			and	h
+			cpl
+			nop
+			ld	(hl),a
+			inc	e
+			adc	a,b
+			inc	d
+			ld	a,h
+			ld	(hl),a
+			add	a,b
+			ld	c,d
+			or	a
+			or	b
+			ld	d,(hl)
+			adc	a,a
+			or	c
+			ld	a,54h
+			dec	hl
+			ld	d,l
+			ld	b,b
+			ld	e,b
+			dec	de
+			or	e
+			ld	e,h
+			ld	(hl),c
+			ld	(hl),c
+			ld	sp,hl
+			dec	(hl)
+			sbc	a,h
+			dec	b
+			ld	(hl),5dh
+			ld	(hl),b
+			and	c
+			in	a,(85h)
+			sub	l
+			ld	e,h
+			call	pe,L4741
+			and	cah
+			jp	m,L9eb2
+			inc	(hl)
+			halt
+			ret	nc
+			ld	c,a
+			ld	de,42c0h
+			inc	hl
+			dec	c
+			dec	e
+			ld	l,d
+			jp	z,L5548
+			jr	c,L910f
+			ld	a,b
+			ld	e,l
+			push	de
+			and	a
+			ld	l,c
+			ld	c,e
+			ld	b,(hl)
+			xor	l
+			call	nz,L5dda
+			ld	l,e
+			add	a,e
+			cp	c
+			ld	d,14h
+			dec	de
+			ld	a,(887ch)
+			adc	a,b
+			ld	d,9ah
+			ret	m
+			ld	h,d
+			ld	c,b
+			ld	b,a
+			ld	a,l
+			inc	(hl)
+			dec	a
+			ret	nc
+			ld	l,(hl)
+			ld	d,b
+			ld	c,d
+			add	a,l
+			ld	b,c
+			inc	sp
+			ret	p
+			ret	c
+			nop (2x) *
+			add	a,b
+			add	a,a
+			or	(hl)
+			ld	(de),a
+			inc	l
+			sbc	a,a
+			and	(hl)
+			xor	l
+			inc	hl
+			ld	b,b
+			inc	d
+			rst	10h
+			ld	l,b
+			or	b
+			rst	38h
+			add	a,c
+			or	b
+			ld	h,l
+			ccf
+			and	d
+			and	d
+			add	a,c
+			sub	h
+			ld	sp,fbf4h
+			ld	h,e
+			ld	e,h
+			ld	de,6f5dh
+			inc	de
+			ld	h,l
+			ret	c
+			ld	(hl),e
+			jp	nc,L73fe
+			inc	l
+			dec	e
+			pop	hl
+			ld	e,d
+			ld	b,c
+			ld	b,d
+			ld	a,d
+			ret	c
+			ld	c,h
+			ld	e,l
+			ld	a,(hl)
+			cp	(hl)
+			nop (2x) *
+			rrca
+			ld	sp,ea60h
+			ld	c,a
+			xor	h
+			push	bc
+			rrca
+			add	a,l
+			ld	(de),a
+			adc	a,82h
+			call	z,Lae4f
+			sub	6fh
+			ld	b,(hl)
+			sub	6fh
+			ld	d,c
+			rst	18h
+			ld	h,l
+			add	a,(hl)
+			ld	a,c
+			sbc	a,d
+			sub	h
+			ld	c,e
+			add	a,l
+			ld	(de),a
+			add	a,d
+			adc	a,e
+			or	b
+			ld	b,e
+			ld	l,d
+			call	nz,Le8b5
+			rst	08h
+			pop	bc
+			nop (2x) *
+			ei
+			dec	bc
+			rst	28h
+			ld	a,c
+			dec	a
+			add	a,h
+			ex	af,af'
+			sbc	a,l
+			ld	h,b
+			add	hl,de
+			and	c
+			dec	de
+			ld	a,(bc)
+			ld	d,d
+			nop
+			ld	c,h
+			inc	a
+			ld	l,d
+			pop	af
+			inc	hl
+			inc	a
+			ld	a,bdh
+			ld	(hl),e
+			jp	p,L2aba
+			ld	h,h
+			ld	h,h
+			cp	a
+			ld	c,b
+			rra
+			ld	c,l
+			add	a,h
+			ld	l,e
+			ld	b,f2h
+			call	nz,L0ad9
+			call	po,Le571
+			call	c,Lf308
+			rst	28h
+			ld	e,d
+			xor	l
+			dec	h
+			ld	c,(hl)
+			ld	h,d
+			ld	b,c
+			rra
+			dec	hl
+			rrca
+			ld	iy,(8d55h)
+			ld	l,a
+			ld	c,h
+			adc	a,h
+			ld	d,a
+			and	a
+			and	e
+			add	a,e
+			pop	de
+			dec	de
+			dec	l
+			ret	c
+			ld	e,(hl)
+			ld	l,l
+			ld	(hl),b
+			call	po,Lfc85
+			ld	a,c
+			ex	de,hl
+			or	l
+			ld	a,(hl)
+			jp	pe,L3e9b
+			dec	(hl)
+			jr	z,L9225
+			ld	b,d
+			call	p,L54e8
+			sbc	a,a
+			exx
+			jr	nz,L91f2
+			or	d
+			rst	00h
+			ld	l,l
+			call	c,L266f
+			inc	l
+			ret	p
+			adc	a,c
+			ld	l,b
+			inc	b
+			ret	nz
+			call	c,L304b
+			ld	b,d
+			ld	a,(bc)
+			ld	(hl),a
+			inc	hl
+			jp	po,L659c
+			daa
+			or	a
+			jp	(hl)
+			db	68h,30h,7ah,0ah,06h,39h,e3h,22h
+			db	efh,bfh,6bh,d1h,32h,ffh,35h,fch
+			db	1ah,22h,d4h,60h,c7h,16h,48h,4dh
+			db	1fh,50h,67h,fdh,87h,87h,e4h,05h
+			db	b8h,3ah,a4h,c9h,54h,5ah,cbh,69h
+			db	49h,76h,edh,a1h
+			ld	d,d
+			ld	h,d
+			sub	90h
+			add	a,l
+			ld	e,e
+			ld	a,d
+			call	c,L7ee2
+			inc	hl
+			call	m,L5b89
+			rst	10h
+			ld	h,52h
+			ld	e,cbh
+			or	d
+			sbc	a,d
+			ld	d,l
+			ret	z
+			rst	08h
+			ld	c,b
+			or	h
+			ld	(3716h),hl
+			xor	e
+			or	a
+			ld	b,b
+			jp	pe,L9c82
+			dec	d
+			or	l
+			jp	nz,L47e2
+			ld	d,h
+			push	af
+			ld	b,(hl)
+			jr	c,L92ba
+			xor	a
+			and	d
+			ld	(hl),d4h
+			ret	m
+			rst	20h
+			ld	e,d
+			ld	h,47h
+			sbc	a,(hl)
+			ld	h,d
+			ld	e,a
+			xor	11h
+			ret	z
+			add	hl,sp
+			sub	e
+			ld	c,(hl)
+			dec	bc
+			ld	(hl),l
+			ld	b,a
+			ret	nc
+			jp	(hl)
+			db	69h,f0h,d1h,99h,3eh,a2h,03h,b9h
+			db	78h,29h,a0h,32h,2ah,f6h,32h,0fh
+			db	67h,d2h,cdh,d9h,30h,d2h,35h,3ch
+			db	01h,9ah,55h,36h,e5h,0bh,4fh,72h
+			db	35h,07h,73h,6ch,69h,b4h,82h,2ch
+			db	7bh,1eh,b8h,bch,b4h,deh,8dh,16h
+			db	18h,8dh,e9h,87h,09h,95h,d8h,0eh
+			db	d9h,14h,5eh,f6h,66h
+			ret	p
+			ld	h,c
+			ld	e,(hl)
+			inc	d
+			xor	(hl)
+			ld	e,a
+			ld	b,c
+			jp	po,L15a5
+			dec	l
+			add	a,(hl)
+			push	af
+			xor	e
+			nop (2x) *
+			adc	a,a
+			ld	a,d
+			ld	(hl),h
+			rst	30h
+			ld	a,b
+			add	a,d
+			sbc	a,b
+			sbc	a,(hl)
+			cp	l
+			dec	b
+			ld	(bc),a
+			ld	c,c
+			push	af
+			ld	d,e3h
+			nop (2x) *
+			ld	c,a
+			pop	hl
+			ld	hl,593bh
+			sub	e
+			rst	20h
+			cpl
+			adc	a,c
+			add	a,b
+			sbc	a,d
+			ld	h,(hl)
+			cp	h
+			ld	(291bh),a
+			sbc	a,c
+			pop	bc
+			ret
+			db	b5h,e8h,fbh,9ch,e9h,34h,f2h,2dh
+			db	dch,43h,1fh,39h,cch,90h,4ah,51h
+			db	3ah,8ah,09h,ffh,50h,37h,afh,54h
+			db	e0h,29h,4ch,06h,a6h,3dh,8bh,9fh
+			db	2fh,84h,94h,feh,b7h,5fh,6ch,e3h
+			db	beh,12h,64h,b8h,a5h,ceh,8bh,9bh
+			db	47h,e7h,13h,05h,31h,0fh,bch,7bh
+			xor	l
+			ld	c,80h
+			rst	00h
+			and	59h
+			or	(hl)
+			sub	h
+			ld	a,b
+			halt
+			ld	l,3ch
+			add	hl,hl
+			inc	l
+			ret	z
+			in	a,(9fh)
+			exx
+			ld	a,h
+			jr	z,L93a5
+			pop	de
+			adc	a,l
+			adc	a,d
+			sub	a
+			jr	z,L932b
+			ld	d,e
+			ld	a,(bc)
+			ld	hl,(8925h)
+			ld	(hl),e
+			ld	hl,c455h
+			rst	08h
+			ld	(de),a
+			cp	l
+			or	c
+			ld	hl,(35e8h)
+			ld	e,(hl)
+			rst	10h
+			add	hl,sp
+			ld	d,(hl)
+			sub	e
+			dec	a
+			ld	b,a
+			ld	hl,(5ddfh)
+			ld	c,h
+			ld	d,e
+			ld	b,d
+			adc	a,b
+			inc	b
+			ld	a,c
+			ld	b,b1h
+			sbc	a,b
+			ld	l,(hl)
+			ld	b,b
+			ld	c,l
+			and	(hl)
+			dec	iyh *
+			add	a,e
+			ld	(de),a
+			nop
+			ld	d,(hl)
+			push	hl
+			jp	nz,L4ab5
+			xor	l
+			rst	20h
+			scf
+			rst	20h
+			ld	c,b
+			adc	a,e
+			ld	h,(hl)
+			res	1,h
+			ld	a,e
+			ld	c,e
+			or	a
+			jp	po,L4297
+			sbc	a,e
+			ld	e,b
+			ld	l,l
+			xor	d
+			xor	b
+			ld	c,48h
+			and	c
+			ret	nz
+			sbc	a,(hl)
+			and	a
+			ret	nz
+			adc	a,c
+			ld	h,e
+			and	h
+			ld	(de),a
+			ld	a,(hl)
+			add	a,e
+			in	a,(1dh)
+			or	d
+			sbc	a,d
+			and	h
+			ld	d,(hl)
+			djnz	L9311
+			sub	b
+			ld	c,e
+			ld	h,55h
+			xor	a
+			pop	hl
+			ld	h,c
+			ld	(hl),d
+			pop	de
+			ld	h,d
+			ld	(hl),d
+			dec	d
+			ld	a,(915eh)
+			ld	d,l
+			sub	d
+			set	6,e
+			cp	96h
+			rrca
+			ld	a,h
+			inc	sp
+			call	nc,L80bf
+			ld	d,b
+			cp	h
+			inc	de
+			daa
+			ld	h,43h
+			ld	h,c
+			adc	a,c
+			inc	a
+			cp	e
+			ld	(b549h),a
+			or	c
+			ld	h,l
+			add	hl,bc
+			jp	p,Lded1
+			sub	a
+			ld	c,(hl)
+			call	z,Lc65d
+			pop	de
+			cp	c
+			jp	m,Lb825
+			inc	sp
+			sbc	a,l
+			ld	l,a
+			dec	l
+			ex	de,hl
+			and	1dh
+			ld	(hl),h
+			cp	b
+			add	hl,bc
+			adc	a,h
+			adc	a,e
+			ld	a,h
+			adc	a,e
+			dec	(hl)
+			jp	c,L5569
+			inc	de
+			jp	z,Lc7c6
+			sbc	a,e
+			rst	28h
+			xor	92h
+			sub	e
+			ret	z
+			ld	c,e
+			ld	a,(04cbh)
+			ld	d,c
+			ld	h,c
+			ld	b,h
+			push	af
+			add	a,b
+			rst	00h
+			halt
+			ld	d,c
+			out	(80h),a
+			rst	00h
+			adc	a,d
+			ld	d,h
+			ld	d,a
+			ld	de,460ah
+			jr	c,L93cf
+			add	hl,hl
+			rla
+			and	d
+			ex	af,af'
+			ld	e,a
+			adc	a,c
+			ld	d,ixl *
+			ld	b,b
+			ld	b,d
+			ld	l,0eh
+			inc	sp
+			add	hl,de
+			nop
+			adc	a,a
+			add	hl,sp
+			dec	d
+			ld	bc,dd04h
+			jp	m,L744b
+			sbc	a,ech
+			and	l
+			inc	(hl)
+			add	a,b
+			ret
+			db	18h,4ch,c3h,13h,c1h,f9h,3dh,f2h
+			db	cah,3dh,5fh,bfh,d7h,bch,99h,85h
+			db	fah,ach,e5h,e7h,3ah,a9h,3dh,0ah
+			db	0fh,aah,07h,99h,13h,7ch,61h,1eh
+			db	9ah,34h,64h,fbh,0ch,4dh,b1h,eeh
+			db	72h,20h,13h,67h,9fh,6ah,a9h,c1h
+			db	f7h,25h,89h,d4h,4eh,e7h,42h,aeh
+			db	cfh,aah,ebh,42h,a4h,06h,96h,07h
+			db	30h,0fh,07h,f7h
+			ld	sp,95a1h
+			call	m,Ld4a2
+			ld	e,c
+			ld	a,(e7ffh)
+			ld	d,afh
+			jp	nz,Ld513
+			ld	h,a
+			rst	30h
+			push	hl
+			dec	(hl)
+			dec	(hl)
+			xor	b
+			ld	b,c
+			add	hl,sp
+			call	po,L482a
+			xor	c1h
+			out	(86h),a
+			ld	e,e
+			add	a,h
+			nop
+			or	b
+			ex	de,hl
+			rst	10h
+			nop (2x) *
+			ld	l,a
+			dec	bc
+			ret
+			db	a5h,35h,57h,f3h,8fh,31h
+			ld	(hl),l
+			sbc	a,b
+			cp	(hl)
+			ld	(hl),l
+			di
+			jp	po,Lbcce
+			inc	(hl)
+			sub	b
+			cp	b
+			or	c
+			ld	d,b
+			ld	e,h
+			sub	e
+			or	e
+			and	l
+			rst	20h
+			ld	(1ad0h),a
+			and	c
+			rst	20h
+			ld	d,l
+			dec	hl
+			ld	e,80h
+			xor	c
+			inc	de
+			dec	d
+			add	a,h
+			ld	e,l
+			rst	20h
+			inc	(hl)
+			jp	m,Ldc2c
+			in	a,(1bh)
+			sub	c
+			inc	l
+			ld	c,e
+			inc	bc
+			add	a,e
+			call	nc,Lbcc5
+			ld	l,bch
+			ld	d,b
+			dec	a
+			and	(hl)
+			jr	c,L94c9
+			ld	a,(1bb9h)
+			ld	a,c
+			sub	(hl)
+			ld	d,d
+			or	(hl)
+			add	a,c
+			cp	81h
+			or	b
+			ld	b,c
+			ld	e,l
+			cp	h
+			sbc	a,l
+			jp	pe,Lbd1e
+			ret
+			db	00h,ceh,feh,36h,23h,71h,d8h,9ah
+			db	36h,aeh,9dh,64h,c6h,fah,6dh,5bh
+			db	4ch,5dh,3bh,36h,80h,38h,c8h,fdh
+			db	29h,50h,c7h,f9h,32h,38h,4bh
+			cpl
+			call	p,Lcdf9
+			push	af
+			ld	sp,hl
+			ld	c,d
+			and	4ch
+			call	p,L6520
+			dec	l
+			ld	a,b
+			jr	nz,L954e
+			rlca
+			adc	a,(hl)
+			cp	b
+			ld	sp,hl
+			cp	b
+			adc	a,h
+			nop (2x) *
+			dec	de
+			ret	z
+			xor	36h
+			adc	a,(hl)
+			cp	d
+			ld	b,h
+			sub	h
+			add	a,74h
+			adc	a,b
+			jp	po,Lccfd
+			sbc	a,b
+			dec	b
+			adc	a,(hl)
+			rra
+			xor	3dh
+			ld	e,a
+			ei
+			call	nz,Lc652
+			ld	e,b
+			ld	sp,hl
+			sub	e
+			call	nc,L49d8
+			ld	b,c
+			sub	d
+			rrca
+			rst	30h
+			xor	(hl)
+			ld	d,c
+			ld	hl,(0eeah)
+			ld	(891bh),hl
+			call	z,Lfab9
+			inc	hl
+			ld	d,l
+			cp	b
+			cp	c
+			rla
+			jr	nz,L9507
+			ld	bc,c387h
+			adc	a,h
+			sub	d
+			res	5,l
+			dec	(hl)
+			inc	bc
+			rst	08h
+			ld	(hl),h
+			adc	a,e
+			ld	a,d
+			ex	(sp),hl
+			ld	d,d
+			jp	z,Le4a0
+			ld	c,a
+			call	L88b7
+			and	(hl)
+			ld	c,l
+			ld	(hl),a
+			and	b
+			ld	b,a
+			call	p,L802f
+			ld	b,b
+			push	hl
+			xor	e
+			xor	l
+			dec	a
+			xor	c
+			and	a
+			sub	h
+			jp	nz,L7951
+			ld	hl,(61c2h)
+			xor	ixl *
+			ld	hl,(6444h)
+			sbc	a,h
+			nop (2x) *
+			daa
+			ld	b,c
+			ld	l,abh
+			sub	e
+			ld	d,e
+			ret	z
+			call	z,L6130
+			ld	b,l
+			out	(98h),a
+			ld	a,c
+			sub	c
+			ex	de,hl
+			sub	a
+			add	a,(hl)
+			ld	de,4ed1h
+			ret	p
+			ld	l,c
+			nop
+			ld	h,d
+			add	a,h
+			jp	po,L4aa0
+			adc	a,b
+			ld	b,a
+			ld	d,l
+			dec	c
+			adc	a,b4h
+			inc	b
+			xor	(hl)
+			add	hl,sp
+			dec	e
+			rst	18h
+			ld	d,b
+			sub	b
+			sub	d
+			sbc	a,h
+			ld	c,c
+			jr	nz,L95d7
+			jp	p,L931c
+			and	(hl)
+			xor	l
+			ld	l,h
+			ld	d,a
+			sub	e
+			ei
+			ld	a,(hl)
+			ld	h,(hl)
+			rlca
+			ld	d,ixl *
+			ld	l,h
+			daa
+			ld	h,e
+			ld	b,c
+			ld	b,b4h
+			ld	h,93h
+			sbc	a,b0h
+			ld	c,a
+			sbc	a,h
+			ret	nz
+			push	bc
+			adc	a,c
+			ld	bc,8c7ch
+			ld	b,(hl)
+			ld	d,h
+			rra
+			ld	h,d
+			djnz	L960c
+			jp	nc,L0138
+			or	e
+			cp	l
+			add	hl,bc
+			dec	c
+			sbc	a,e
+			sbc	a,abh
+			call	pe,L14e0
+			rst	08h
+			xor	c
+			call	c,L81e1
+			inc	de
+			rrca
+			cp	h
+			push	hl
+			ei
+			ld	l,b
+			jp	pe,Lc67c
+			or	(hl)
+			ld	b,h
+			ld	l,d
+			ld	e,l
+			rst	18h
+			dec	c
+			jr	z,L964d
+			add	a,c
+			rlca
+			ld	h,91h
+			add	a,h
+			add	a,c
+			xor	l
+			adc	a,dbh
+			and	d
+			ld	h,(hl)
+			ld	(hl),e
+			ld	a,0bh
+			sbc	a,c
+			ld	d,d
+			sbc	a,e
+			cpl
+			inc	h
+			ld	a,a
+			add	a,b
+			cp	c
+			halt
+			and	b0h
+			ld	a,c
+			jp	(hl)
+			db	9dh,5bh,9dh,1eh
+			dec	a
+			call	Lfefb
+			cp	b
+			rra
+			xor	h
+			call	c,Le80c
+			ld	a,(bc)
+			and	e
+			dec	l
+			adc	a,d
+			ret	nz
+			ld	h,l
+			dec	c
+			halt
+			jp	z,L5486
+			ld	h,(hl)
+			inc	e
+			jp	z,L0cb8
+			sub	d
+			sub	2eh
+			ld	h,a
+			ld	hl,8947h
+			xor	c
+			add	a,d
+			sbc	a,a
+			ld	e,91h
+			adc	a,c
+			ld	e,b
+			dec	e
+			inc	a
+			ld	d,b6h
+			ld	e,c
+			sub	0ch
+			ld	b,(hl)
+			rla
+			inc	e
+			rla
+			xor	b
+			ld	a,e
+			ld	l,b
+			rst	18h
+			or	h
+			push	hl
+			adc	a,5bh
+			ex	de,hl
+			cp	e
+			jr	L9600
+			db	17h,43h,2bh,99h,89h,47h,88h,80h
+			db	99h,f4h,06h,63h,8bh,5fh
+			or	e
+			pop	de
+			cp	12h
+			inc	c
+			sub	b
+			cp	c
+			cp	l
+			sbc	a,e
+			ld	c,82h
+			call	c,L8abb
+			jp	nz,Lcc70
+			ld	b,(hl)
+			ld	(f8c0h),hl
+			ld	l,c
+			ld	a,d
+			or	b
+			ld	l,d
+			adc	a,a
+			rla
+			xor	0dh
+			and	f6h
+			adc	a,d
+			dec	sp
+			add	a,b
+			and	c
+			sbc	a,a
+			rst	18h
+			ret
+			db	2dh,45h,bah,d5h,1fh,2fh,eah,33h
+			db	b7h,bch,a6h,b6h,6dh,62h,f0h,69h
+			db	97h,59h,6ah,b0h,abh,a7h,bch,e1h
+			db	22h,2eh,efh,e7h,0bh,65h,07h,0ch
+			db	5dh,d8h,4fh,d6h,6fh,48h,74h,10h
+			db	f3h,07h,55h,aah,72h,89h,52h,efh
+			db	a2h,62h,bfh,a0h,aeh,86h,97h,d5h
+			db	86h,beh,b1h,b5h,0ch,15h,42h,21h
+			db	09h,8ch,6dh,90h,49h,ddh,3ch,76h
+			db	d8h,a5h,a1h,67h,02h,ffh,96h,81h
+			db	c5h,e0h,9dh,15h,32h,b2h,3bh,abh
+			db	7dh,49h,b2h,25h,83h,f4h,56h,d8h
+			db	c4h,61h,91h,12h,efh,53h,3eh,bah
+			db	c3h,afh
+			ld	b,c
+			jp	Lad65
+			db	0fh,14h,e1h,d5h,f0h,c2h,78h,fdh
+			db	efh,76h,66h,ech,84h,8eh,16h,5dh
+			db	8dh,2eh,a3h,85h,66h,cch,43h,beh
+			db	4dh,96h,82h
+			add	hl,de
+			sbc	a,c
+			nop (2x) *
+			adc	a,b
+			inc	e
+			jp	z,L78f0
+			call	po,L9e02
+			jp	p,L906e
+			ld	l,a
+			ld	l,a
+			add	a,e
+			ld	c,(hl)
+			rra
+			cp	c
+			and	d
+			dec	bc
+			ld	b,c
+			jp	po,L0e77
+			ld	d,l
+			or	l
+			inc	d
+			ld	h,l
+			rla
+			rst	20h
+			ld	de,4061h
+			and	9ah
+			cp	l
+			dec	hl
+			call	m,Lc4d8
+			ld	h,h
+			cp	b
+			jr	nc,L9714
+			and	l
+			rla
+			add	a,h
+			xor	e
+			rst	28h
+			dec	h
+			sbc	a,h
+			adc	a,h
+			add	hl,hl
+			xor	d
+			ld	l,b
+			ld	a,a
+			and	b
+			inc	sp
+			ld	a,e
+			ld	(bc),a
+			sbc	a,(hl)
+			daa
+			sbc	a,(hl)
+			cp	e9h
+			sub	h
+			ld	h,l
+			call	po,L7a9f
+			add	hl,bc
+			ld	d,h
+			ld	h,(hl)
+			push	hl
+			add	hl,bc
+			inc	de
+			ld	l,b
+			ld	e,a
+			ld	a,c
+			ld	d,c
+			inc	de
+			ret
+			db	74h,52h
+			rst	08h
+			ld	b,l
+			sub	b
+			inc	b
+			sbc	a,h
+			ld	l,c
+			ld	d,d
+			dec	de
+			ld	d,e
+			pop	af
+			ld	l,e
+			jp	p,L1cab
+			add	hl,sp
+			add	a,c
+			ld	h,b
+			dec	c
+			dec	b
+			sbc	a,4eh
+			dec	c
+			ld	de,14b8h
+			sbc	a,a
+			ld	b,c
+			jp	m,Lceab
+			or	f1h
+			ret	pe
+			ld	b,c
+			ld	(hl),e
+			rra
+			ret	pe
+			ld	e,(hl)
+			sbc	a,h
+			halt
+			sub	l
+			ld	l,a
+			ld	h,d
+			call	p,Lbb9b
+			ld	l,e
+			sub	c
+			add	hl,de
+			ld	c,d
+			xor	e
+			ld	hl,621eh
+			ld	b,l
+			cp	d
+			dec	sp
+			sub	d
+			dec	e
+			xor	c
+			ld	b,c
+			dec	bc
+			ld	b,c
+			adc	a,d2h
+			scf
+			ld	h,c
+			xor	h
+			ld	(hl),h
+			ld	(hl),e
+			dec	bc
+			cp	e
+			sub	e
+			cp	h
+			sbc	a,b
+			and	c
+			ld	a,(bc)
+			ld	c,(hl)
+			dec	b
+			call	m,L6742
+			ld	b,a
+			ld	b,d
+			ld	e,c4h
+			ld	l,5eh
+			or	b
+			inc	h
+			ld	l,08h
+			pop	de
+			ld	b,b
+			dec	a
+			ld	a,d
+			dec	bc
+			ld	c,(hl)
+			ld	l,b
+			rst	30h
+			add	a,c
+			call	nz,L36af
+			jr	L9771
+			db	7dh,16h,f9h,82h,0dh,a0h,48h,d2h
+			db	08h,dah,48h,b3h,15h,68h,4eh,2dh
+			db	8fh,86h,a2h,c7h,a3h,00h,7eh,ach
+			db	13h,40h,dch,6eh,6eh,fch,48h,abh
+			db	46h,31h,0fh,83h,53h,22h,0eh,92h
+			db	2ch,22h,e2h,1eh,f2h,c0h,5ch,4dh
+			db	beh,a8h,19h,e9h,7eh,53h,6ah,5fh
+			db	d0h,ceh,5ch,fch,61h,cbh,3ch,74h
+			db	0bh,7eh,f0h,96h,f8h,0bh,16h,30h
+			db	c3h,a9h,f8h,85h,5fh,d4h,92h,a7h
+			db	0ch,35h,22h,dch,a6h,76h,54h,17h
+			db	25h
+			dec	h
+			ld	(hl),h
+			adc	a,(hl)
+			jp	z,L5938
+			xor	e
+			call	L569a
+			xor	c
+			ld	c,a
+			ld	a,l
+			ret	pe
+			sub	b
+			push	bc
+			sbc	a,e
+			sbc	a,e
+			push	af
+			cp	h
+			cp	c
+			cp	a
+			ld	d,b
+			ret	m
+			sbc	a,l
+			ld	h,(hl)
+			rra
+			jp	po,L63fb
+			sbc	a,e
+			add	hl,de
+			ld	(de),a
+			ld	a,d
+			ld	e,b
+			and	b
+			cp	c
+			cpl
+			set	1,(hl)
+			nop
+			jp	pe,L5abf
+			ld	(hl),a
+			add	a,d7h
+			call	p,L8ed0
+			cp	a
+			add	a,d
+			ld	h,b
+			inc	de
+			ld	d,74h
+			or	70h
+			rst	38h
+			or	(hl)
+			or	b
+			ld	a,l
+			ret	po
+			halt
+			ld	e,(hl)
+			dec	l
+			inc	a
+			ld	e,c0h
+			and	d
+			rla
+			scf
+			and	e
+			inc	d
+			and	e
+			add	hl,hl
+			call	z,L3378
+			rst	28h
+			and	d
+			ld	h,a
+			rrca
+			ld	(1990h),a
+			jr	c,L98bd
+			adc	a,e
+			dec	bc
+			ld	(hl),b
+			ld	d,(hl)
+			and	a
+			ld	a,h
+			rst	08h
+			xor	81h
+			add	a,h
+			ld	(9187h),hl
+			ld	a,(bc)
+			sbc	a,l
+			adc	a,c
+			add	hl,sp
+			ld	l,e
+			ld	b,a
+			xor	39h
+			ld	d,d
+			and	a
+			add	a,h
+			xor	h
+			djnz	L98f1
+			ld	a,b
+			exx
+			ld	(hl),l
+			xor	c2h
+			ld	l,l
+			inc	l
+			call	z,L08ee
+			cp	c
+			ld	a,(hl)
+			ld	c,(hl)
+			jp	L6dcd
+			db	b3h,31h,6ah,96h,ffh,f0h,0ah,7bh
+			db	3dh,86h,bfh,54h,30h,04h,3bh,85h
+			db	41h,ffh,75h,b1h,c2h,aeh,c6h,e1h
+			db	a8h,feh,d2h,23h,99h,dfh,32h,0fh
+			db	0ch,f5h,98h,31h,25h
+			ld	b,d
+			dec	b
+			add	a,27h
+			ld	c,(hl)
+			jr	z,L9856
+			pop	af
+			or	h
+			ret	m
+			ld	(hl),26h
+			inc	de
+			inc	bc
+			and	b2h
+			cp	l
+			ld	a,c
+			ld	e,c
+			add	a,l
+			nop (2x) *
+			ld	c,d
+			ld	(hl),d
+			ex	de,hl
+			adc	a,95h
+			ld	e,e
+			sbc	a,d
+			ld	h,l
+			inc	sp
+			cp	(hl)
+			sbc	a,e
+			ld	c,c
+			add	a,(hl)
+			pop	bc
+			inc	a
+			jp	(hl)
+			db	98h,47h,48h,ffh,2fh,76h,30h,41h
+			db	e5h,3ah,38h,d1h,38h,4eh
+			ld	c,c
+			ld	l,d
+			ld	a,h
+			adc	a,l
+			cp	l
+			ld	a,a
+			rst	20h
+			xor	(hl)
+			ld	c,e
+			ld	(hl),d
+			jr	nc,L98f9
+			dec	l
+			jp	L150d
+			db	39h,a9h,75h,deh,e8h,8dh,6bh,14h
+			db	dfh
+			xor	e
+			sub	9ah
+			ld	c,d
+			ret	po
+			ld	b,h
+			ld	e,b
+			dec	h
+			add	a,d
+			ld	h,b
+			ld	l,c
+			and	e
+			or	b
+			ld	b,l
+			ld	h,(hl)
+			jp	nz,La559
+			xor	e
+			halt
+			adc	a,e
+			rst	38h
+			ld	c,a
+			pop	de
+			ld	c,(hl)
+			ld	d,e
+			ld	hl,(6af4h)
+			inc	iyl *
+			cp	f6h
+			ld	d,e
+			ld	c,h
+			jp	nz,Le89c
+			ld	d,a
+			jp	pe,Le9c8
+			ld	d,e
+			add	hl,de
+			ld	(hl),a
+			ld	c,b
+			ld	h,c
+			ld	(hl),l
+			call	L7bf2
+			cp	b
+			ld	d,l
+			adc	a,82h
+			ld	b,d
+			ld	a,(hl)
+			ret	pe
+			inc	(hl)
+			ret	c
+			call	po,Ld0c9
+			ld	b,b
+			or	b
+			cp	l
+			ld	b,l
+			jr	L996b
+			db	71h,80h,80h,8fh,7eh,85h,9ch,1bh
+			db	ddh,68h,28h,6eh,0bh,fch,8ah,82h
+			db	68h,22h,8fh,1eh,59h
+			inc	c
+			dec	b
+			jp	z,Lbe62
+			and	9ch
+			dec	a
+			call	po,L385b
+			rla
+			dec	(hl)
+			adc	a,h
+			jp	z,L6cfb
+			add	hl,bc
+			ld	h,l
+			call	nz,Lfc37
+			or	d
+			cp	h
+			adc	a,b
+			ld	c,a
+			ld	hl,(1215h)
+			ld	e,h
+			ld	h,b
+			ld	d,l
+			sbc	a,e
+			exx
+			sbc	a,b
+			ld	a,l
+			add	hl,sp
+			adc	a,d
+			add	hl,bc
+			ld	d,l
+			ld	sp,hl
+			djnz	L994a
+			adc	a,d
+			sub	b
+			ld	b,h
+			call	c,L7196
+			cp	e
+			inc	bc
+			ld	l,(hl)
+			sub	e
+			ld	e,h
+			sbc	a,e
+			ld	a,h
+			sbc	a,a
+			inc	bc
+			jr	nz,L9964
+			sub	c
+			adc	a,c
+			adc	a,91h
+			djnz	L99f9
+			xor	a
+			cp	d
+			ld	b,(hl)
+			adc	a,(hl)
+			add	hl,bc
+			ld	a,(bc)
+			call	nz,L318d
+			ld	l,h
+			dec	b
+			add	a,(hl)
+			adc	a,(hl)
+			sub	d
+			add	a,a5h
+			and	e
+			jp	c,La304
+			call	c,L2d48
+			dec	(hl)
+			cpl
+			jp	(hl)
+			db	86h,3eh,98h,d0h,11h,22h,47h,ceh
+			db	82h,98h,dah,1ch,d7h,99h,55h,dfh
+			db	7fh,30h,5dh,4bh,69h,62h,13h,06h
+			db	c1h,a4h,d0h
+			ld	d,c
+			pop	bc
+			rst	08h
+			ld	h,l
+			cp	l
+			add	a,c
+			ld	c,fbh
+			xor	d
+			ld	sp,hl
+			ld	e,c
+			out	(e4h),a
+			adc	a,d
+			dec	de
+			ld	c,d
+			cp	d
+			ld	l,26h
+			ld	d,a
+			ld	d,38h
+			ld	sp,hl
+			ld	d,l
+			exx
+			ld	a,d
+			inc	l
+			xor	l
+			inc	l
+			ei
+			ld	e,b
+			ld	d,d
+			rst	00h
+			sbc	a,l
+			ld	b,h
+			or	d
+			ld	h,b
+			add	hl,sp
+			ld	b,b
+			inc	h
+			cp	c
+			nop
+			jr	L99db
+			db	43h,5eh,45h,6bh,02h,ech,9fh,72h
+			db	58h,2ch,4ah,84h,75h,d4h,a8h
+			ld	l,b
+			ld	a,l
+			sub	a
+			cp	d
+			nop
+			ret	p
+			or	e
+			ld	d,d
+			inc	d
+			inc	b
+			and	b
+			xor	(hl)
+			sbc	a,c
+			ld	b,l
+			dec	h
+			rst	28h
+			ld	(hl),87h
+			ld	b,l
+			dec	l
+			ld	(hl),c
+			cp	c
+			ret	m
+			ld	a,c
+			ld	c,e
+			ret	m
+			call	Lee76
+			ld	h,(hl)
+			or	d
+			and	d
+			ld	a,d
+			sbc	a,b
+			rst	08h
+			ld	e,c
+			or	e
+			or	a
+			ld	l,l
+			rst	20h
+			sub	ech
+			ccf
+			call	p,Lc080
+			xor	e
+			ld	ixh,d *
+			ld	sp,hl
+			ld	c,e
+			adc	a,b
+			ret	p
+			or	d
+			ld	d,(hl)
+			adc	a,e
+			call	L8a75
+			inc	l
+			ld	e,c
+			jp	z,L5288
+			rst	20h
+			adc	a,h
+			sub	4eh
+			in	a,(43h)
+			ld	b,a
+			or	l
+			jp	po,L9236
+			adc	a,6dh
+			ld	a,l
+			call	L1dd7
+			dec	bc
+			jr	nc,L9a16
+			inc	(hl)
+			ld	(hl),d
+			jp	po,L35b9
+			dec	hl
+			ld	b,l
+			ld	a,16h
+			di
+			inc	hl
+			sub	(hl)
+			halt
+			ex	af,af'
+			or	h
+			inc	h
+			ld	d,a
+			adc	a,h
+			call	po,L3e9f
+			ld	h,e
+			ld	l,c
+			inc	b
+			and	(hl)
+			ld	e,h
+			add	a,a
+			bit	0,l
+			ld	(hl),a
+			ld	b,c
+			ld	e,02h
+			sbc	a,b
+			nop (2x) *
+			rst	38h
+			sub	a
+			rst	10h
+			daa
+			dec	a
+			or	(hl)
+			ld	(de),a
+			inc	de
+			adc	a,9ah
+			inc	e
+			ld	c,(hl)
+			out	(08h),a
+			push	bc
+			xor	e
+			ld	d,c
+			ld	e,e
+			ld	a,l
+			jp	nc,L1a97
+			ld	e,h
+			sub	e
+			call	p,Lf799
+			ret	nz
+			ld	d,e
+			dec	e
+			ld	h,c
+			push	hl
+			jp	(hl)
+			db	8ch,e5h,bfh,30h,62h,f1h,12h,dfh
+			db	dfh,86h,d4h,9fh,f9h,beh,d8h,a9h
+			db	31h,27h,10h,eah,4ch,1fh,8bh,5dh
+			db	0fh,6ch,59h,ach,30h,5dh,38h,4fh
+			db	0eh,aeh,ddh,cdh,8dh,78h,61h,20h
+			db	bch,a8h,87h,27h,e0h,96h,e7h,61h
+			db	eeh,c0h,4eh,c6h,91h,06h,03h,e1h
+			db	9ah,eah,eah,cfh,91h,46h,ffh,86h
+			db	07h,46h,cdh,a3h,6dh,c0h,88h,52h
+			db	67h,c9h,8eh,d8h,61h,52h,1dh,48h
+			db	5dh,f2h,1bh,8fh,06h,8ah,6ch,62h
+			db	6ch,7fh,2dh,23h,9eh,75h,57h,fdh
+			db	b9h,ceh,47h,64h,09h,9eh,45h,e2h
+			db	7fh,35h,d5h,3fh,1ah,c6h,b2h,a5h
+			db	f3h,0fh,d1h,35h,fbh,3eh,e1h,fah
+			db	a6h,33h,8eh,19h,90h,80h,e6h,8ah
+			db	21h,ddh,92h,03h,10h,18h,cah,7fh
+			db	5ch,edh,5eh,13h,43h,06h,dfh,fdh
+			db	4fh,8bh,f3h,77h,92h,f4h,cbh,28h
+			db	0eh,07h,cbh,d1h,22h,96h,73h,f7h
+			db	a6h,a8h
+			rst	20h
+			sub	2eh
+			ld	(bc),a
+			cp	a
+			ex	de,hl
+			ld	h,a
+			add	a,e
+			call	po,L37f1
+			sub	b
+			ld	b,e
+			ld	l,e
+			pop	de
+			dec	b
+			ld	a,57h
+			ex	af,af'
+			ld	d,e
+			sub	l
+			ld	h,d
+			sbc	a,d
+			push	af
+			jp	nz,L3267
+			rst	30h
+			ld	c,d
+			ld	(hl),c
+			add	a,c
+			ld	(hl),e
+			ld	b,d
+			ld	a,(bc)
+			ld	c,h
+			sub	a
+			jr	nc,L9b8b
+			ld	h,(hl)
+			add	a,93h
+			adc	a,l
+			cp	h
+			add	a,a
+			or	l
+			ld	(hl),a
+			jr	nc,L9baa
+			sbc	a,b
+			sbc	a,70h
+			and	h
+			ld	e,65h
+			cp	e
+			ld	h,(hl)
+			pop	af
+			adc	a,b
+			ld	l,(hl)
+			ld	(hl),l
+			ld	b,e
+			rlca
+			inc	d
+			or	d
+			ld	e,l
+			ld	c,l
+			adc	a,h
+			ld	h,a
+			sub	h
+			ld	e,(hl)
+			inc	a
+			nop (2x) *
+			ret	nc
+			add	a,c
+			scf
+			xor	c
+			push	af
+			xor	a
+			or	a
+			ld	e,1bh
+			add	hl,hl
+			add	hl,sp
+			ld	h,c
+			ld	c,a
+			rst	10h
+			ld	c,d
+			inc	d
+			add	a,ceh
+			and	(hl)
+			ld	c,b
+			ld	b,d
+			jp	m,L2044
+			jp	m,L9dda
+			sbc	a,(hl)
+			ld	b,h
+			sbc	a,a
+			jp	nz,L1aec
+			and	e
+			sbc	a,l
+			ld	d,l
+			rlca
+			ld	(hl),h
+			push	bc
+			ld	h,b
+			ld	h,h
+			rrca
+			rst	18h
+			set	5,c
+			inc	e
+			halt
+			push	de
+			cp	b4h
+			dec	bc
+			adc	a,e
+			jr	nz,L9bc0
+			call	z,L749f
+			ld	d,l
+			ld	(9930h),a
+			ld	(hl),l
+			or	a
+			inc	bc
+			ex	af,af'
+			ld	h,cbh
+			ret	c
+			ld	e,c
+			nop
+			inc	sp
+			dec	e
+			ld	hl,0ac1h
+			jr	L9be0
+			db	62h,bah,d5h,20h,e1h,13h,5ch,52h
+			db	7eh,a8h,2ah,09h,beh,2bh,75h,e8h
+			db	abh,35h,8eh,08h,aeh,fbh
+			jr	L9bde
+			db	a2h,bdh,d0h,2fh,4dh,2dh,30h,9dh
+			db	64h,f2h,73h,e7h,9ch,9bh,68h,deh
+			db	ddh,82h,46h,23h,4bh,b9h,33h,68h
+			db	49h,7bh,1fh,17h,01h,f3h,2eh,c2h
+			db	ffh,6ch,33h,b8h,4bh,8bh,78h,23h
+			db	03h,d8h,30h,2bh,72h,38h,60h,f1h
+			db	81h,0eh,f8h,9dh,7ah,99h,7ah,41h
+			db	a8h,b2h,46h,f7h,19h,81h,0eh,23h
+			db	58h,bfh,33h,88h,e4h,b4h,51h,c3h
+			db	7bh,9dh,1fh,beh,40h,b5h,1dh,deh
+			db	4fh,94h,52h,5ah,85h,4fh,50h,fah
+			db	42h,3ch,65h,e6h,f1h,a7h,25h,bah
+			db	0ah,a0h,10h,72h,afh,62h,e7h,8ah
+			db	ech,80h,7ch,b5h,86h
+			add	a,d
+			push	de
+			inc	c
+			inc	a
+			ld	e,d
+			dec	l
+			adc	a,(hl)
+			dec	sp
+			inc	l
+			jr	L9c91
+			db	7bh,93h,d4h,c5h,c7h,7ch,3eh,b1h
+			db	03h,77h,15h,44h
+			jp	p,L7f03
+			and	3ah
+			add	hl,de
+			ld	c,a
+			and	h
+			dec	e
+			or	9dh
+			ld	sp,f031h
+			ld	(e9e4h),hl
+			sub	2eh
+			sub	a
+			rst	10h
+			pop	de
+			sub	(hl)
+			rst	30h
+			cp	b
+			sub	a
+			inc	a
+			ld	d,b
+			add	a,47h
+			inc	c
+			sub	(hl)
+			ld	l,a
+			ld	a,(85fdh)
+			ld	b,h
+			ld	d,(hl)
+			pop	bc
+			ld	b,d
+			dec	e
+			ld	h,d
+			ret	nc
+			ld	b,b
+			ld	b,d
+			sub	b
+			ld	b,c
+			ld	hl,(ba75h)
+			xor	l
+			ex	af,af'
+			ld	d,a
+			ld	c,b
+			ld	d,h
+			ld	b,(hl)
+			ld	b,l
+			adc	a,c
+			ld	(hl),l
+			ld	l,(hl)
+			exx
+			ret	pe
+			ld	e,(hl)
+			or	(hl)
+			ld	a,e
+			ld	a,(de)
+			ld	e,2fh
+			ld	a,h
+			halt
+			or	e
+			ld	b,72h
+			ret	pe
+			cp	e
+			ld	(hl),l
+			ld	(hl),l
+			ld	a,(6de6h)
+			call	Le07b
+			sbc	a,h
+			sbc	a,d
+			ld	(34b8h),hl
+			ld	hl,(e664h)
+			or	h
+			or	h
+			ret	po
+			add	a,b3h
+			push	de
+			adc	a,e
+			ld	b,e
+			cpl
+			di
+			ld	sp,8cc5h
+			jp	L8636
+			db	e5h,82h,d4h,25h,2eh,f4h,ach,f0h
+			db	0dh,d4h,55h,6bh,02h,c6h,45h,12h
+			db	5ah,87h,d7h,b5h,3ah,95h,a6h,05h
+			db	4fh,95h,e9h,07h,d8h,43h,aah,4ah
+			db	26h,beh,ceh,beh
+			sub	a
+			sub	b
+			xor	h
+			ld	e,a
+			nop
+			inc	l
+			ld	l,d
+			sub	e
+			xor	c
+			ld	b,e
+			add	a,a
+			ld	l,(hl)
+			call	c,Lffa3
+			jp	L75e8
+			db	51h,efh,50h,5fh,60h,08h,5ah,1fh
+			db	bbh,76h,30h,a8h,15h,4fh,5bh,8dh
+			db	ebh,a5h,d4h,f4h,b7h,16h,3bh,d2h
+			db	b3h,ech,a5h,f1h,d5h,6ch,05h,ddh
+			db	7ch,24h,41h,4ch,afh,88h,5ah,90h
+			db	e7h,fch,03h,f0h
+			jr	nc,L9d20
+			ld	e,b
+			ccf
+			exx
+			djnz	L9d5f
+			inc	bc
+			ld	e,a
+			inc	de
+			jr	nc,L9d11
+			cp	b
+			exx
+			inc	bc
+			and	a
+			ld	(e1f2h),a
+			ld	d,l
+			sub	c
+			jp	po,Lab7b
+			sbc	a,l
+			call	m,Lab91
+			add	a,(hl)
+			xor	d
+			xor	d
+			inc	bc
+			inc	(hl)
+			ld	(hl),d
+			adc	a,h
+			inc	c
+			ld	e,a
+			xor	a
+			or	b
+			ret
+			db	69h,e2h,13h,90h,3dh,39h,85h,ffh
+			db	7ch,e9h,81h,e1h,1eh,c2h,afh,0fh
+			db	95h,41h,5ah,32h,49h,06h,10h,21h
+			db	01h,ech,b4h,55h,19h,99h,dbh,1ch
+			db	8fh,bdh,10h,4ch,2ch,46h,f0h,99h
+			db	99h,2bh,0ch,bfh,d0h,78h,b4h,edh
+			db	f1h,83h,a8h,37h,08h,7ah,cfh,a7h
+			db	53h,2dh,05h,38h,28h,11h,a6h,63h
+			db	eah,59h,9eh,62h,c6h,41h,84h,a7h
+			db	43h,e7h,cch,24h,71h,d8h,f9h,bch
+			db	dfh,ech,5ch,d3h,30h,ddh,efh,4fh
+			db	6ch,6ah,e8h,bbh,3ah,a9h,c6h,5bh
+			db	1ch,deh,dch
+			inc	hl
+			ld	d,c
+			add	a,e
+			xor	4eh
+			call	c,L70fe
+			ret	z
+			ei
+			dec	l
+			sbc	a,c
+			inc	h
+			jp	Lc521
+			db	36h
+			inc	(hl)
+			ld	d,c
+			ld	(1e28h),hl
+			inc	hl
+			push	af
+			ret
+			db	01h,adh,8ch,5bh,78h,49h,81h,e3h
+			db	e9h,4eh,82h,38h,c1h,cch,f3h
+			ld	a,c
+			ld	c,l
+			or	a
+			sub	d3h
+			or	e
+			ld	c,b
+			ld	e,d
+			out	(a7h),a
+			ret	pe
+			ld	a,c6h
+			ld	(hl),a
+			adc	a,h
+			ld	e,c
+			call	po,L3c11
+			cp	a
+			ld	l,h
+			ret	m
+			or	a
+			jr	nc,L9e06
+			ld	d,h
+			ld	b,l
+			ld	a,d
+			xor	d
+			ld	h,c
+			ld	sp,hl
+			ld	e,h
+			add	a,b
+			call	L990a
+			ld	l,l
+			jp	(hl)
+			db	c0h,b6h,32h,98h,49h,6eh,9ch,c1h
+			db	fbh,24h,d9h,39h,9ah,68h,1dh,a3h
+			db	a4h,b6h,d1h,e3h,06h,f2h,f6h,ffh
+			db	aeh,8dh,b8h,75h,1dh,ceh,6ch,8ch
+			db	14h,27h,74h,7eh,d4h,63h,cbh,8ch
+			db	22h,65h,26h,0dh,dbh,39h,c9h,18h
+			db	b4h,7fh,84h,71h,7bh,05h,dbh,65h
+			db	86h,ech,19h,bfh,74h,b4h,04h,a9h
+			db	2ah,d4h,9bh,adh,2ah,34h,f6h,d0h
+			db	d8h,34h,72h,97h,59h,75h,e3h,89h
+			db	6dh,76h,18h,3ch,80h,47h,c3h,91h
+			db	51h,e6h,55h,7eh,d9h,f4h,54h,d9h
+			db	4bh,7ch,fah,7dh,c0h,5ah,0dh,57h
+			db	c6h,9dh,90h,63h,6dh,c0h,0bh,9eh
+			db	e1h,8eh
+			jp	(hl)
+			db	16h,86h,d1h,15h,51h,62h,5fh,1fh
+			db	59h,aeh,f3h,fch,58h,8dh,65h,4fh
+			db	b7h,b9h,22h,01h,34h,6ch,a0h
+			ld	a,d
+			ld	e,4eh
+			ret
+			db	d6h,5eh,c3h,e0h,6ch,4eh,deh,d7h
+			db	34h,d9h,93h,34h,bch,80h,bch,22h
+			db	a7h,58h,08h,60h,06h,77h,cfh,fbh
+			db	2ch,45h,b6h,36h,05h,e3h,2bh
+			call	z,L8bf6
+			xor	c
+			ld	e,(hl)
+			pop	hl
+			nop (2x) *
+			adc	a,b
+			or	l
+			call	nz,Le510
+			ld	h,e
+			adc	a,(ix + 8ah)
+			ld	a,(6b25h)
+			and	05h
+			jr	c,L9e9a
+			ld	h,1ch
+			xor	b
+			sbc	a,b
+			ld	b,d6h
+			ld	c,b
+			ld	d,a
+			jr	nc,L9f54
+			dec	a
+			ld	sp,d214h
+			sbc	a,d
+			rst	08h
+			inc	a
+			inc	e
+			djnz	L9f71
+			sub	d
+			and	l
+			ld	(hl),e
+			ld	b,4ch
+			adc	a,a
+			and	(hl)
+			ld	c,h
+			ld	c,(hl)
+			ccf
+			ld	l,(hl)
+			jr	c,L9f60
+			xor	h
+			sub	b
+			inc	hl
+			ld	a,d
+			ld	(hl),b
+			daa
+			ei
+			halt
+			rst	28h
+			halt
+			or	l
+			dec	e
+			call	L291a
+			ld	e,c
+			sub	l
+			and	b
+			nop (2x) *
+			dec	b
+			adc	a,(hl)
+			dec	h
+			add	a,a
+			ld	(ce84h),a
+			sbc	a,a7h
+			dec	l
+			dec	a
+			jp	m,L0dc4
+			or	c
+			ld	l,e
+			call	nc,L2c7e
+			nop (2x) *
+			rst	18h
+			add	a,b
+			push	de
+			ld	a,l
+			ld	a,l
+			rra
+			sub	a
+			jp	c,La3e6
+			or	h
+			sbc	a,c
+			ld	e,a
+			inc	de
+			ld	(hl),a
+			ei
+			halt
+			ld	b,l
+			jr	z,L9f31
+			sbc	a,d
+			adc	a,d
+			ld	(6cf3h),hl
+			add	a,d
+			adc	a,(hl)
+			rst	30h
+			ld	hl,5571h
+			jr	nc,L9f1e
+			call	p,L18c7
+			xor	b
+			xor	d
+			ret	z
+			ret	m
+			ld	a,a
+			sbc	a,c
+			jr	c,L9f13
+			ld	(bc),a
+			ld	b,b
+			xor	h
+			ld	a,b
+			sub	d
+			adc	a,(hl)
+			or	(hl)
+			inc	d
+			dec	a
+			ld	l,b
+			ld	l,47h
+			sbc	a,b
+			cp	c
+			sbc	a,(hl)
+			or	b
+			ld	(hl),6eh
+			add	hl,hl
+			ld	l,h
+			ld	e,a
+			ld	(hl),h
+			inc	hl
+			ld	d,e
+			dec	e
+			jp	pe,Lbc65
+			dec	a
+			or	e
+			ld	c,e
+			ld	(bc),a
+			call	pe,Lc936
+			ex	de,hl
+			ld	sp,d030h
+			ld	(hl),a
+			or	14h
+			and	a
+			jp	m,L1fb6
+			or	b
+			dec	d
+			ld	l,d
+			rla
+			ld	d,(hl)
+			inc	l
+			ld	c,e
+			call	m,Le03e
+			ld	h,a
+			sbc	a,b
+			ld	h,b
+			jp	c,L8ad5
+			ld	(hl),c
+			inc	hl
+			ld	d,d
+			ld	l,b
+			ld	l,a
+			djnz	L9f55
+			sbc	a,h
+			sbc	a,b
+			rst	38h
+			call	pe,L276d
+			sub	h
+			jp	z,Lcc0b
+			ld	d,(hl)
+			ld	b,3fh
+			ld	c,b
+			inc	b
+			jp	po,L36e4
+			ld	e,d
+			inc	b
+			rst	30h
+			ld	c,(hl)
+			jr	La031
+			db	33h,cah,c9h,83h,6ch,1bh,7dh,54h
+			db	1eh,16h,3dh,bch,1ah,9dh,02h,7bh
+			db	b0h,c6h,e2h,b6h,6bh,0bh,45h,e8h
+			db	a6h,2ch,09h,42h,48h,1fh,91h,bfh
+			db	85h,0fh,deh,50h,71h,f2h,dch,b9h
+			db	9fh,26h,fdh,bch,2ah,c6h,4eh,b5h
+			db	c3h,f4h,e3h,11h,59h,bbh,29h,9bh
+			db	28h,d5h,2fh
+			dec	(hl)
+			jr	nz,L9fae
+			ld	e,h
+			rst	00h
+			ld	a,(de)
+			ld	a,d
+			ld	b,b
+			nop (2x) *
+			ld	a,(bc)
+			ld	b,a
+			ld	d,e
+			ld	(de),a
+			dec	c
+			nop (2x) *
+			push	hl
+			inc	d
+			sbc	a,h
+			cpl
+			ld	h,aah
+			add	a,(hl)
+			ld	c,b
+			dec	de
+			jr	c,La08f
+			ld	h,2ch
+			rst	38h
+			add	hl,hl
+			ld	c,a
+			ret	nz
+			nop
+			inc	hl
+			jp	z,Lcdf5
+			rst	38h
+			ld	c,e
+			ret	z
+			ld	c,d
+			rla
+			inc	sp
+			call	m,Lba99
+			rst	10h
+			jr	nz,La092
+			call	p,L1424
+			ld	(hl),e
+			jp	c,Ld8c6
+			pop	de
+			ld	b,d
+			ld	a,d
+			dec	(hl)
+			ld	a,(hl)
+			ld	h,3bh
+			ret	p
+			adc	a,b
+			ld	e,b
+			dec	h
+			adc	a,d
+			ld	(hl),h
+			and	a
+			jp	c,La9e2
+			ld	d,a
+			out	(b1h),a
+			adc	a,c5h
+			scf
+			sub	b
+			ld	l,d
+			xor	c
+			ld	e,d
+			ld	d,c
+			ld	(bc),a
+			sbc	a,6ch
+			sbc	a,(hl)
+			push	de
+			sbc	a,l
+			inc	h
+			inc	b
+			ld	de,601bh
+			inc	c
+			inc	c
+			ld	a,93h
+			sub	(hl)
+			ld	c,c
+			ld	l,a
+			ld	b,b
+			ld	d,c
+			dec	d
+			nop (2x) *
+			pop	af
+			ld	d,d
+			ld	d,a
+			dec	(hl)
+			xor	l
+			pop	af
+			ret	nc
+			ld	d,b
+			and	b8h
+			ld	c,h
+			ld	b,d
+			ld	e,l
+			ld	h,e
+			in	a,(1eh)
+			cp	(hl)
+			push	af
+			sbc	a,dch
+			ld	(bf4ch),a
+			dec	h
+			ld	a,adh
+			sub	a
+			ld	h,d
+			jp	pe,Ld182
+			ld	l,(hl)
+			ld	c,a
+			sub	e
+			ex	de,hl
+			add	a,b
+			ld	l,l
+			jr	c,La020
+			jr	nc,La0cd
+			and	e
+			add	a,e
+			ret	po
+			xor	a
+			ld	sp,hl
+			add	a,a
+			ex	de,hl
+			in	a,(47h)
+			ret	po
+			call	m,L269d
+			ld	c,d
+			ld	b,l
+			ld	h,b
+			ld	b,b
+			or	(hl)
+			djnz	La0ee
+			ld	a,(bc)
+			ld	de,ac1bh
+			xor	h
+			ld	(hl),e
+			pop	hl
+			sub	l
+			daa
+			jp	(hl)
+			db	a7h,11h,1ch,88h,f0h,d3h,f5h,93h
+			db	85h,a5h,3dh,92h,06h,92h,b7h,ceh
+			db	cdh,79h,c5h,4ch,96h,a1h,82h,cah
+			db	d2h,22h,e8h,11h,77h,1dh,cch,f2h
+			db	2ah,deh
+			or	d
+			ld	h,b
+			ld	h,d
+			add	a,d
+			jp	p,Lbaa5
+			djnz	La0a2
+			and	d5h
+			dec	sp
+			ld	c,b
+			nop (2x) *
+			adc	a,d
+			and	h
+			ld	d,a
+			inc	a
+			ret	m
+			ld	c,d2h
+			xor	b
+			add	a,d
+			ld	(de),a
+			ld	d,d
+			rst	20h
+			ld	h,l
+			sub	l
+			inc	hl
+			jp	pe,Ld4ee
+			ld	e,a
+			ld	h,e
+			jp	po,L8f1d
+			ld	(hl),c
+			ld	(hl),a
+			ld	b,c
+			and	e
+			add	a,d
+			or	b
+			jp	z,L84d8
+			call	nz,L22d6
+			sbc	a,l
+			sub	d
+			jr	La0f9
+			db	7ah,b3h,64h,0bh,92h,a8h,f7h,6dh
+			db	90h,b0h,34h,d0h,78h,3dh,45h,96h
+			db	6eh,d7h,c8h,07h,82h,7fh,95h,a5h
+			db	1ch,42h,32h,6dh,3eh,ebh,e7h,03h
+			db	46h,b4h,d4h,65h,c2h,b3h,f1h,40h
+			db	f8h,53h,2eh,98h,f7h,12h,0eh,58h
+			db	28h,60h,95h,73h,3fh,b9h,ffh,09h
+			db	afh,69h,aeh,ebh,8ch,91h
+			ld	bc,e4e9h
+			sub	h
+			inc	(hl)
+			ld	a,(bc)
+			rra
+			or	a
+			jp	c,L2814
+			ld	d,h
+			cp	6ch
+			pop	hl
+			inc	b
+			sbc	a,b
+			ld	a,e
+			ld	(hl),72h
+			or	e
+			or	b
+			ld	d,(hl)
+			ld	h,e
+			cp	a
+			ld	l,a
+			scf
+			ld	h,e
+			ld	b,l
+			sbc	a,b
+			rra
+			ld	d,b
+			ld	(hl),b
+			ld	d,79h
+			ld	(hl),h
+			cp	b
+			add	a,e
+			jr	La1b5
+			db	e3h,c1h,c4h,ddh,17h,55h,ddh,68h
+			db	16h,e7h
+			and	e
+			jp	L9cbd
+			db	3bh,04h,66h,87h,13h,12h,17h,cbh
+			db	30h,c8h,f4h,19h,f6h,0fh,3dh,abh
+			db	85h,a5h,a4h,d8h,f4h,6dh,5eh,30h
+			db	8dh,87h,2bh,88h,8ch
+			sub	(hl)
+			ld	b,d
+			call	pe,L6b79
+			ld	l,b
+			ld	a,d
+			inc	(hl)
+			adc	a,b
+			and	(hl)
+			out	(3ch),a
+			call	po,L8cd4
+			ld	l,d
+			ld	d,e
+			cp	c
+			adc	a,e
+			ld	h,d
+			ld	(283dh),hl
+			inc	e
+			ld	(hl),h
+			xor	b0h
+			ld	c,e
+			inc	a
+			ld	c,h
+			add	a,c
+			add	hl,sp
+			rst	08h
+			cp	c
+			ld	(hl),b
+			call	p,L8519
+			sub	(hl)
+			inc	sp
+			ld	d,(hl)
+			call	c,L78be
+			pop	bc
+			ld	d,e
+			ld	a,b
+			call	m,Lff61
+			pop	af
+			ld	h,d
+			ld	e,l
+			nop
+			ld	c,35h
+			or	d
+			ld	l,d
+			xor	(hl)
+			push	bc
+			inc	de
+			jr	c,La195
+			xor	l
+			call	nz,Lde8d
+			cp	c
+			ld	a,(3111h)
+			sbc	a,d
+			add	a,b
+			dec	bc
+			sub	e
+			ld	d,e
+			ld	b,(hl)
+			pop	bc
+			jp	(hl)
+			db	9ah,2eh,6ah,55h,d4h,17h,26h,b9h
+			db	85h,d0h,cah,20h,51h,04h,d5h,98h
+			db	a2h,f7h,69h,61h,2bh,f5h,90h,b4h
+			db	feh,b0h,c5h,b4h
+			call	p,L7044
+			ld	d,e
+			xor	(hl)
+			dec	bc
+			rra
+			add	hl,bc
+			add	a,b
+			adc	a,a
+			push	bc
+			ld	a,(hl)
+			jp	z,Lde82
+			inc	h
+			xor	55h
+			ld	sp,hl
+			add	a,l
+			rst	20h
+			ld	(hl),h
+			ld	l,c
+			ld	h,d
+			call	m,Lf555
+			ld	h,b
+			ret	c
+			adc	a,a
+			or	c
+			sbc	a,h
+			adc	a,e
+			ret	m
+			rst	08h
+			add	a,e
+			ld	c,10h
+			ld	bc,1b79h
+			ld	b,l
+			ld	(240dh),a
+			ld	a,c
+			jr	c,La20f
+			ld	d,b
+			and	c
+			adc	a,h
+			dec	b
+			cp	(hl)
+			ld	c,(hl)
+			jp	c,L3dd4
+			rst	38h
+			and	(hl)
+			jp	nc,Le6f0
+			jp	pe,Lc334
+			ld	h,l
+			call	nc,Lf6ef
+			add	a,b
+			ld	l,a
+			djnz	La247
+			ld	a,(bc)
+			ld	a,b
+			adc	a,e
+			ld	b,(hl)
+			cp	b
+			cp	(hl)
+			call	nc,L8bf7
+			ld	(hl),l
+			in	a,(0fh)
+			sbc	a,e
+			and	c
+			inc	c
+			push	af
+			set	0,e
+			inc	c
+			cpl
+			ld	b,(hl)
+			add	hl,bc
+			ld	hl,(1973h)
+			sub	b
+			ld	l,e
+			rst	00h
+			ccf
+			rst	30h
+			ret	m
+			ld	(d975h),hl
+			ld	a,a
+			ld	(hl),a
+			jr	z,La1ff
+			ld	c,l
+			ret	po
+			add	a,h
+			jp	pe,L03b6
+			call	Lf8cd
+			inc	c
+			dec	e
+			ld	a,l
+			exx
+			add	a,h
+			ld	d,e
+			ld	h,(hl)
+			jp	z,L5f17
+			ld	d,c
+			ld	(hl),d
+			adc	a,l
+			or	d
+			sub	d
+			adc	a,a
+			ld	d,h
+			ld	h,c
+			djnz	La2ca
+			ld	de,4c95h
+			ld	c,c
+			ld	(hl),d
+			ld	d,(hl)
+			ld	l,d
+			ld	c,l
+			pop	hl
+			ld	l,b
+			xor	c
+			ld	l,(hl)
+			ld	c,(hl)
+			ld	l,a
+			ld	e,c
+			inc	d
+			ret	m
+			ret	pe
+			ld	h,l
+			add	a,h
+			sbc	a,e
+			call	pe,L7057
+			rst	30h
+			ld	a,a
+			inc	a
+			xor	l
+			rst	30h
+			ret	p
+			xor	(hl)
+			or	12h
+			and	e
+			add	a,(hl)
+			halt
+			sub	d
+			ld	h,d
+			cp	h
+			ld	(4d2dh),a
+			ld	l,h
+			push	af
+			add	a,c
+			ld	d,h
+			xor	l
+			ld	a,h
+			ld	l,d
+			sbc	a,a
+			ld	b,h
+			xor	edh
+			ld	a,a
+			xor	e
+			dec	d
+			push	af
+			ld	d,d
+			ld	c,a
+			inc	de
+			ld	l,l
+			sub	d
+			or	e
+			sub	b
+			sbc	a,a
+			adc	a,a
+			daa
+			ld	l,a5h
+			call	z,L7a92
+			ld	sp,e164h
+			ld	c,d
+			ld	c,2fh
+			jp	(hl)
+			db	cdh,96h,06h,c0h,5bh,5dh,96h,cbh
+			db	e2h,0ah,70h,88h,92h,dch,8dh,44h
+			db	85h,26h,25h,77h,78h,59h,60h,f0h
+			db	43h
+			and	l
+			or	b
+			sbc	a,b
+			ex	de,hl
+			push	bc
+			sub	(hl)
+			ld	e,8dh
+			rla
+			sbc	a,a
+			sub	d
+			ld	c,36h
+			ld	d,d
+			ld	e,l
+			add	a,h
+			call	p,Le3e4
+			sbc	a,h
+			dec	de
+			ld	(bc),a
+			ld	e,e
+			rst	28h
+			sbc	a,(hl)
+			cp	h
+			ld	l,a
+			ld	b,d1h
+			rst	08h
+			ret	nz
+			or	h
+			and	l
+			jp	p,L7a74
+			djnz	La34a
+			ex	af,af'
+			sub	h
+			pop	af
+			ld	e,h
+			add	hl,bc
+			ld	hl,(61a4h)
+			rst	00h
+			jr	nz,La32e
+			ret	p
+			rst	30h
+			ld	c,h
+			and	c
+			inc	hl
+			ld	d,h
+			adc	a,b
+			ld	iyl,c *
+			scf
+			rrca
+			ld	b,h
+			ld	d,h
+			ret	m
+			ld	c,a
+			pop	bc
+			jp	(hl)
+			db	c1h,99h,25h,ach,5fh,fah
+			ld	(1008h),a
+			sbc	a,h
+			ld	b,(hl)
+			call	L75f4
+			call	po,L15e8
+			inc	l
+			ld	e,l
+			and	c
+			ld	b,l
+			ld	(hl),b
+			or	b
+			rlca
+			ld	l,b
+			ld	b,f6h
+			ret	p
+			ret
+			db	ddh,41h,dbh,fch,b9h,16h,56h,54h
+			db	81h,d0h,aah,41h,b1h,c8h,1dh,3eh
+			db	01h,20h,b5h,3ch,41h,d4h,81h,71h
+			db	0dh,0dh,3eh,99h,76h,87h,f7h,cch
+			db	7fh,12h,82h,1eh,92h,2eh,cfh,4eh
+			db	4dh,1ch,b7h,74h,e4h,17h,3eh,fah
+			db	a9h,b6h,d3h,5ah,bch,52h,d9h,6fh
+			db	cbh,18h,2dh,57h,bch,cch,55h,21h
+			db	0ch,8dh,57h,7ch,a9h,fah,40h,8bh
+			db	4ah,5eh,05h,4eh,28h,74h,eah,e5h
+			db	46h,89h,57h,6dh,a4h,e3h,05h,c5h
+			db	ffh,f9h,d8h,f3h,cah,1dh,a8h,ebh
+			db	feh,37h,eah,28h,b3h,f7h,0dh,5dh
+			db	ddh,4ah,a9h,6fh,d2h,c2h,b4h,34h
+			db	87h,02h,f1h,b7h,d7h,07h,29h,85h
+			db	01h,edh,01h,dfh,5ch,71h,0bh,57h
+			db	abh,c8h,14h,ffh,99h,ebh,84h,37h
+			db	c1h,24h,8bh,03h,f5h,1dh,c8h
+			ret	nz
+			ld	e,e
+			inc	de
+			jp	L2b08
+			xor	c
+			add	a,d
+			jr	z,La433
+			inc	bc
+			add	hl,bc
+			jr	z,La3e1
+			cp	e
+			ld	l,bdh
+			cpl
+			jp	pe,L5491
+			cp	e
+			ei
+			ld	b,h
+			rst	30h
+			push	bc
+			and	c
+			rst	28h
+			cp	e
+			inc	(hl)
+			ld	a,l
+			ld	a,a
+			di
+			cp	d
+			jp	z,L9603
+			ld	h,e
+			ld	e,b4h
+			ld	l,c6h
+			sbc	a,l
+			ccf
+			pop	bc
+			adc	a,h
+			ld	d,l
+			push	de
+			ld	(hl),a
+			or	e
+			ld	(hl),h
+			ex	af,af'
+			ld	bc,557eh
+			jp	c,L3ffa
+			or	88h
+			ld	b,(hl)
+			xor	l
+			ld	b,e
+			xor	l
+			add	a,h
+			push	bc
+			ld	h,l
+			call	z,L92a6
+			dec	a
+			ld	a,h
+			ld	c,a
+			cp	a
+			and	c
+			ld	bc,2462h
+			add	hl,de
+			ret	nc
+			jp	po,L4ce5
+			sbc	a,f2h
+			ld	c,b
+			adc	a,a
+			call	z,L8d36
+			ret	c
+			ld	b,dah
+			call	p,Ld44f
+			ld	a,(bc)
+			halt
+			add	hl,hl
+			or	h
+			ld	b,b
+			or	(hl)
+			sbc	a,c
+			in	a,(57h)
+			and	h
+			add	a,d
+			call	La8ee
+			dec	l
+			cp	l
+			dec	e
+			add	hl,de
+			rst	00h
+			or	3ah
+			rst	20h
+			rst	18h
+			ld	b,a2h
+			and	e
+			ld	c,l
+			ld	d,b
+			inc	de
+			ld	d,h
+			ret	p
+			ld	l,d
+			push	af
+			inc	h
+			ld	(hl),h
+			ld	c,a
+			adc	a,c
+			push	bc
+			adc	a,l
+			dec	(hl)
+			or	h
+			jp	(hl)
+			db	ddh,5ch,a9h,cah,04h,8fh,71h,e4h
+			db	a9h,c2h,56h,feh,e8h,eah,40h,10h
+			db	81h,3fh,d1h,37h,f5h,4ah,e1h,f2h
+			db	49h,86h,f6h,c6h,e1h,61h,c2h,d9h
+			db	a3h,16h,edh,19h,8dh,a1h,b6h,99h
+			db	bbh,c8h,bfh,93h,dah,aeh,5eh,76h
+			db	99h,ach,3ah,08h,5ah,b8h,12h,07h
+			db	57h,09h,c5h,6fh,08h,35h,c5h,45h
+			db	d0h,7eh,dfh,fch,e4h,6ah,d6h,ech
+			db	61h,52h,19h,42h,15h,bah,c8h,75h
+			db	bfh,03h,e5h,c5h,abh,95h,28h,58h
+			db	10h,42h,95h,02h,b4h,76h,38h,32h
+			db	f8h,07h,50h,63h,12h,cch,64h,b0h
+			db	69h,7ch,fdh,62h,68h,b3h,ebh,e0h
+			dec	(hl)
+			dec	b
+			ld	h,c
+			ld	e,d
+			jp	p,Lf6a7
+			adc	a,1dh
+			ld	c,e
+			inc	bc
+			ret	m
+			inc	l
+			nop
+			adc	a,c
+			add	a,e
+			pop	de
+			or	d
+			ld	a,c
+			and	b
+			ld	b,dbh
+			ld	sp,972eh
+			ld	e,a
+			rst	38h
+			ld	h,46h
+			rst	10h
+			ld	l,c
+			jp	p,L2ff5
+			ld	(hl),l
+			dec	bc
+			ld	c,b9h
+			sbc	a,c
+			jp	c,Lfd42
+			cp	0ah
+			ld	l,e
+			and	h
+			add	a,8dh
+			ret	p
+			or	c
+			ld	(5f33h),a
+			call	m,Lf37d
+			ld	a,b
+			dec	e
+			rst	08h
+			or	a
+			and	e
+			ld	a,(fcefh)
+			ld	l,d
+			call	c,L945b
+			ld	sp,fd65h
+			ld	c,h
+			ld	d,c
+			ld	b,l
+			call	pe,L42b4
+			ld	b,a
+			out	(feh),a
+			di
+			xor	d
+			sbc	a,c
+			inc	(hl)
+			inc	bc
+			rst	38h
+			inc	e
+			dec	bc
+			rst	18h
+			ret
+			db	92h,aah,84h,95h,53h,b8h,35h,78h
+			db	b8h,c3h,8eh,71h,e3h,9fh,10h,66h
+			db	14h,50h,bch,b3h,a6h,f5h,88h,9ch
+			db	1ch
+			xor	1eh
+			ld	h,(hl)
+			ld	b,b
+			adc	a,15h
+			ld	a,e
+			inc	h
+			ret	nz
+			ld	a,(f933h)
+			ld	a,c
+			rst	10h
+			ret	pe
+			call	po,L71a6
+			ld	bc,8b62h
+			dec	l
+			pop	af
+			ld	e,l
+			ld	l,a
+			ld	c,c
+			ld	b,h
+			ret	pe
+			adc	a,l
+			xor	0bh
+			ret	m
+			di
+			ret	p
+			ld	hl,(9381h)
+			bit	3,d
+			ld	b,h
+			rst	30h
+			jp	nc,L2e3c
+			pop	bc
+			ex	(sp),hl
+			adc	a,l
+			or	d
+			dec	hl
+			in	a,(4fh)
+			xor	h
+			jp	z,Ld351
+			xor	h
+			sub	(hl)
+			rst	30h
+			ld	a,h
+			ld	bc,0fc6h
+			djnz	La59d
+			out	(cfh),a
+			nop
+			call	m,Ld149
+			and	ceh
+			inc	hl
+			add	a,c
+			sbc	a,7eh
+			add	hl,de
+			add	a,l
+			cp	l
+			rst	18h
+			and	(hl)
+			ei
+			or	30h
+			ld	(de),a
+			jp	z,L35ce
+			inc	(hl)
+			pop	af
+			ld	de,6648h
+			jp	po,Lf654
+			cp	l
+			ld	b,edh
+			ld	d,a
+			ccf
+			add	hl,hl
+			ld	d,b
+			ld	b,e
+			xor	b6h
+			add	a,a
+			ld	hl,(8e62h)
+			dec	(hl)
+			ret	z
+			or	a
+			ex	de,hl
+			sub	a
+			ld	h,c
+			jr	z,La595
+			sbc	a,d
+			dec	h
+			or	d
+			cp	b
+			dec	hl
+			ret	pe
+			add	hl,hl
+			dec	hl
+			add	hl,hl
+			ret
+			db	89h,69h,c8h,dch,55h,5ch,a5h,a1h
+			db	84h,09h,d8h,cch,b3h,efh,23h,e1h
+			db	9bh,bah,c5h,ceh,54h,89h,ceh,5dh
+			db	a5h,39h,bbh,c2h,27h,f8h,f0h,3dh
+			db	c9h,2fh,b2h,eeh,d6h,d7h,66h,27h
+			db	27h,8fh,3ch,24h,a7h,27h,2eh,a8h
+			db	4ch,6bh,7ch,6ah,74h,2ah,5fh,b1h
+			db	17h,18h,1dh,e6h,60h,e5h,fch,d3h
+			db	91h,c3h,f9h,01h,4fh,88h,63h,d6h
+			db	e6h,89h,2dh,21h,1dh,33h,46h,81h
+			db	4dh,dch,06h,2eh,c9h,ebh,86h,c8h
+			db	beh,51h,01h,39h,79h,21h,46h,feh
+			db	cbh,ceh,f9h,92h,e3h,48h,eeh,86h
+			db	33h,12h,47h,27h,a6h,30h,5dh,f6h
+			db	73h,beh,17h,fah,73h,35h,a2h,b5h
+			db	6dh,b0h,5eh,51h,14h,c5h,5eh,1fh
+			db	fch,44h,52h,d0h,0bh,dah,4fh,6ah
+			db	c6h,06h,03h,aah,5fh,f6h,99h,99h
+			db	64h,01h,dah,ceh,44h,d7h,8ah,74h
+			db	a6h,aah,2ah,4fh,f1h,12h,fdh,73h
+			db	8eh,d4h,45h,74h,36h,b6h,2ch,72h
+			db	bah,ach,8bh,6ah,70h,45h,17h
+			sbc	a,h
+			add	a,e
+			ret	z
+			ld	c,(hl)
+			xor	e
+			out	(f4h),a
+			call	c,La975
+			ld	(hl),b
+			call	c,Lf2e6
+			inc	e
+			and	h
+			call	Lc002
+			adc	a,b
+			ld	c,a
+			sub	b
+			cp	a
+			ld	sp,hl
+			ld	b,b
+			add	a,d
+			ld	d,d
+			and	b
+			sbc	a,a
+			or	(hl)
+			add	hl,bc
+			ld	b,c
+			ld	h,a
+			sbc	a,c
+			call	po,L46c5
+			inc	de
+			sbc	a,d
+			cp	h
+			inc	de
+			jp	L8fd3
+			db	e5h,10h,48h,98h,99h,3eh,d4h,96h
+			db	4ch,4ah,1ah,41h,90h,97h,4bh,ebh
+			db	0bh,20h,31h,98h,65h,c7h,37h,f6h
+			db	a9h,b2h,b1h,65h,88h,2dh,54h,b7h
+			db	15h,86h,9ch,95h,eah,79h,45h,5fh
+			db	24h,36h,31h,29h,6ch,ceh,a1h,76h
+			db	43h,16h,9bh,49h,dah,67h,f5h,48h
+			db	aah,65h,82h,29h,49h,75h
+			dec	(hl)
+			cp	e
+			jp	L53e4
+			ld	(hl),h
+			ld	hl,13edh
+			ld	b,d
+			inc	hl
+			ld	h,b
+			dec	b
+			ld	a,(98a8h)
+			inc	e
+			rst	18h
+			ld	e,l
+			ld	h,c
+			ld	a,a
+			rra
+			ret	p
+			call	po,L6295
+			xor	b
+			ld	c,l
+			ld	a,b
+			ei
+			and	l
+			ld	(hl),h
+			rst	00h
+			rst	38h
+			ld	a,l
+			and	h
+			ld	a,h
+			ld	c,h
+			rra
+			ld	c,b
+			ld	(hl),e
+			adc	a,c
+			inc	b
+			ld	c,h
+			ld	b,d
+			di
+			ld	d,a
+			inc	b
+			cp	a1h
+			ld	l,d3h
+			ret	nz
+			add	hl,bc
+			push	de
+			cp	d
+			adc	a,(hl)
+			inc	d
+			ret	p
+			inc	e
+			cp	e
+			ld	c,a
+			adc	a,a
+			jp	p,Ld3a4
+			ld	e,a
+			call	nc,Lf92e
+			ld	a,h
+			ex	af,af'
+			ld	h,c
+			rst	08h
+			ld	e,d
+			add	a,b
+			ld	b,a
+			jr	nc,La6e7
+			ld	l,a
+			and	b
+			ld	c,c
+			ld	d,a
+			ld	l,a
+			and	a5h
+			ld	b,2ch
+			call	c,Ldb34
+			cp	d
+			rlca
+			sbc	a,d
+			ld	e,b
+			cp	d
+			and	a
+			ld	(hl),c
+			push	af
+			add	hl,bc
+			xor	c
+			ex	de,hl
+			rst	28h
+			and	l
+			inc	d
+			xor	b
+			cp	e
+			or	l
+			and	b
+			call	nc,Lbfd5
+			ld	c,e
+			inc	(hl)
+			add	a,d
+			inc	b
+			inc	bc
+			inc	(hl)
+			dec	d
+			and	d
+			call	po,La9b3
+			dec	c
+			ld	hl,(7f51h)
+			ld	b,(hl)
+			jp	(hl)
+			db	bdh,79h,b7h,eeh,fdh,1fh,85h,fah
+			db	00h,61h,9dh,aeh,42h,76h,42h,f5h
+			db	a3h,cch,84h,9bh,7dh,d5h,2fh,c7h
+			db	e2h,57h,72h,09h,47h,49h,ach,5eh
+			db	63h,45h,0eh,60h,ceh,73h,cfh,ffh
+			db	11h,92h,b6h,80h,45h,fah,59h,3ch
+			db	53h,f6h
+			ld	b,0ch
+			inc	c
+			ld	a,(de)
+			jp	nc,Ld928
+			push	bc
+			ld	(hl),f9h
+			pop	hl
+			rst	20h
+			dec	h
+			ld	(hl),h
+			jp	Ld424
+			db	7fh,8dh,0ch,b0h,6fh,abh,d8h,06h
+			db	d8h,0fh,3bh,34h,4ah,8bh,9ah,0fh
+			db	d8h,a1h,5ah,1dh,cbh,6bh,c7h,a8h
+			db	6bh,ddh,43h,1eh,60h,61h,20h,3dh
+			db	34h,79h,beh,60h,53h,79h,9ah,5bh
+			db	7ch,eah,25h,8dh,9ah,86h,08h,bah
+			db	17h,43h,cah,a0h,71h,90h,cah,5ch
+			db	d4h,2ch,51h,c4h,45h,3ch,edh,b9h
+			db	5eh,33h,77h,b7h,39h,31h,88h,7ah
+			db	f2h,fah,4fh,40h,26h,88h
+			adc	a,c
+			ld	c,c
+			ld	l,b
+			ld	d,a
+			ld	a,h
+			push	af
+			add	a,21h
+			inc	hl
+			inc	d
+			ei
+			ld	e,d
+			sub	e
+			inc	sp
+			jp	c,L48c1
+			ret	c
+			rst	20h
+			pop	af
+			adc	a,e
+			sbc	a,e
+			jp	Lcc1d
+			db	44h,76h,02h,68h,14h,96h,a4h,2ch
+			db	2fh,04h,feh,0ah,25h,afh,cbh,e2h
+			db	fbh,8bh,a2h,9ch,55h,c5h,15h,aah
+			db	36h,90h,3ah,2ah,17h,5ch,36h,2ch
+			db	1ch,13h,f4h,f4h,8ah,eah,2fh,7bh
+			db	83h,c4h,f5h,21h,cdh,aeh,97h,3dh
+			db	12h,cfh,3bh,6ah,e5h,7eh,56h,9ch
+			db	55h,e2h,83h,beh
+			ld	(bc),a
+			ld	h,e
+			inc	bc
+			push	bc
+			ret	z
+			ld	l,(hl)
+			rst	08h
+			ld	sp,816ch
+			ld	(hl),h
+			ld	e,c
+			ret	po
+			ld	a,h
+			ld	b,c
+			dec	bc
+			and	e
+			bit	3,(hl)
+			jp	(hl)
+			db	d0h,13h,5fh,43h,beh,15h,eah,52h
+			db	d0h,7ah,80h,4ah,6bh,18h,8eh,b0h
+			db	b3h,cah,ech,f6h,7eh,c2h,21h,26h
+			db	6dh,2dh,5bh,d8h,f3h,c1h,cch,bfh
+			db	6ah,86h,3eh,31h,0ch,78h,99h,d1h
+			db	51h,90h,bah,95h,cdh,e3h,cdh,53h
+			db	e0h,c0h,92h
+			jr	La8df
+			db	4dh,20h,38h,6bh,b4h,48h,9dh,0dh
+			db	c1h,71h,7ch,b3h,f8h,62h,59h,41h
+			db	e0h,1fh
+			jr	z,La84e
+			add	a,b
+			ld	a,(de)
+			rst	08h
+			xor	(hl)
+			cp	a
+			rra
+			ld	b,c
+			dec	c
+			call	p,Lc0d5
+			ld	e,l
+			call	pe,L7b41
+			dec	h
+			adc	a,b
+			rst	18h
+			ccf
+			or	e
+			ld	h,b
+			adc	a,b
+			ld	c,c
+			add	a,a
+			ld	d,a
+			xor	(hl)
+			and	(hl)
+			inc	c
+			dec	a
+			sub	b
+			and	08h
+			ld	l,d
+			inc	bc
+			dec	c
+			ld	b,50h
+			out	(4bh),a
+			daa
+			inc	bc
+			jr	z,La8c8
+			exx
+			ld	l,a
+			ld	e,b
+			ld	e,a
+			rst	28h
+			daa
+			inc	sp
+			ld	b,b
+			jp	z,L1f19
+			pop	hl
+			rst	00h
+			ld	h,b
+			adc	a,l
+			inc	e
+			ld	d,l
+			pop	hl
+			cp	b1h
+			call	L0484
+			xor	c
+			call	po,L02be
+			ld	e,e
+			ld	(hl),e
+			ld	a,e
+			cp	e
+			ld	bc,551fh
+			halt
+			ld	e,d
+			ld	b,e
+			ld	(de),a
+			ld	h,a
+			rst	18h
+			ld	e,d
+			out	(fch),a
+			out	(78h),a
+			ld	h,e
+			jp	z,L1a26
+			adc	a,e
+			rst	10h
+			xor	h
+			rra
+			ld	l,e
+			add	hl,sp
+			pop	de
+			xor	l
+			call	nc,L1aca
+			sub	l
+			sub	d
+			jp	z,L4a7b
+			ret	m
+			rra
+			ld	(hl),l
+			or	b
+			ld	e,h
+			ld	e,a
+			jr	La96e
+			db	6bh,efh,c7h,2bh,0dh,16h,e2h,62h
+			db	a9h
+			inc	hl
+			inc	e
+			ld	l,(hl)
+			and	8eh
+			or	(hl)
+			add	a,b
+			ld	a,d
+			ld	h,(hl)
+			add	a,d
+			jp	L9b93
+			db	0ah,90h,5dh,15h,33h,79h,3ah,92h
+			db	7eh,3ah,dah,e7h,4fh,58h,72h,2bh
+			db	96h,2ah,5eh,33h,62h,b1h,dfh,cfh
+			db	33h,70h,d3h,32h,28h,f0h,c8h,f1h
+			db	ech,6fh,efh,42h,77h,88h,92h,a2h
+			db	81h,06h,84h,31h
+			and	e
+			inc	hl
+			inc	de
+			sbc	a,afh
+			ld	(hl),a
+			ld	a,67h
+			ret	c
+			rst	00h
+			xor	l
+			xor	d
+			call	c,Lb314
+			and	d
+			push	bc
+			ex	af,af'
+			add	a,b
+			sub	c
+			ld	a,(de)
+			ld	b,e
+			ld	h,(hl)
+			call	nc,La21e
+			dec	hl
+			jp	po,Lc7d0
+			inc	(hl)
+			rst	28h
+			ld	sp,42e3h
+			ld	b,c
+			ld	d,a
+			ld	h,(hl)
+			ld	a,d
+			dec	bc
+			dec	b
+			out	(32h),a
+			dec	c
+			cp	61h
+			inc	bc
+			or	l
+			ex	af,af'
+			out	(0dh),a
+			ld	b,d
+			ld	de,db30h
+			adc	a,c
+			dec	d
+			ld	a,b
+			res	3,(hl)
+			and	l
+			adc	a,d5h
+			ld	l,e
+			adc	a,a
+			rlca
+			ld	b,a
+			add	hl,bc
+			cp	a
+			ld	l,c
+			add	hl,hl
+			ret	p
+			ld	c,cfh
+			sbc	a,a
+			di
+			inc	l
+			ld	l,a
+			add	hl,sp
+			ld	c,(hl)
+			jp	L1a60
+			db	4ah,0ch,3ch,d3h,b5h,3eh,bah,fah
+			db	71h,e4h,8bh,58h
+			jp	m,Lcbe2
+			inc	sp
+			ld	e,c
+			ret	c
+			ld	sp,hl
+			dec	(hl)
+			ld	d,8dh
+			jr	La961
+			db	6bh,38h,1ch,45h,01h,99h,a0h,69h
+			db	7ch,9ch,29h,1eh,b7h,73h,d3h,00h
+			db	1eh,0eh,d5h,03h,3eh,c6h
+			ld	(hl),h
+			ld	sp,ae63h
+			rst	28h
+			ld	(3f3dh),hl
+			ld	(hl),d
+			ld	l,l
+			ld	e,b
+			ld	e,c
+			inc	h
+			ld	d,efh
+			pop	bc
+			jr	nc,La983
+			ld	b,c
+			ret	c
+			scf
+			ld	l,b
+			inc	bc
+			ld	a,(b628h)
+			djnz	Laa7a
+			adc	a,(hl)
+			jr	c,La9fc
+			or	a
+			call	nc,L81f0
+			ld	l,l
+			sbc	a,l
+			ld	e,l
+			di
+			or	d
+			add	hl,hl
+			sub	0eh
+			add	a,d
+			jp	nz,Laa2f
+			ld	e,h
+			sub	b
+			ld	l,76h
+			rlca
+			ld	h,d
+			ld	l,l
+			ld	(bc),a
+			ld	e,9eh
+			ld	sp,hl
+			sub	h
+			sbc	a,c
+			xor	l
+			ld	a,c
+			rst	38h
+			dec	(hl)
+			and	b
+			inc	l
+			inc	h
+			jp	nc,L38cb
+			ld	d,b
+			ld	a,e
+			jp	m,L80ad
+			cp	h
+			ex	af,af'
+			cp	a
+			rst	28h
+			add	hl,bc
+			push	af
+			ld	l,e
+			adc	a,l
+			ld	d,h
+			jp	L64c7
+			db	a6h,74h,12h,d8h,23h,beh,a7h,50h
+			db	58h,71h,69h,37h,87h,2dh,a9h,d5h
+			db	b3h
+			add	a,a
+			call	p,L236f
+			ret	nz
+			out	(2eh),a
+			ld	e,h
+			call	z,Lcdfe
+			jp	po,L4823
+			rst	28h
+			adc	a,a
+			res	7,l
+			ld	d,a
+			djnz	Laa1b
+			xor	d
+			add	a,h
+			jp	c,L39f2
+			add	a,h
+			ld	l,l
+			push	af
+			ld	h,h
+			ld	h,76h
+			xor	05h
+			sbc	a,l
+			add	a,c
+			nop (2x) *
+			adc	a,e8h
+			out	(7fh),a
+			ld	c,d
+			rst	00h
+			ld	bc,71afh
+			cp	h
+			ld	hl,(3662h)
+			ld	sp,hl
+			sbc	a,c
+			ld	b,h
+			rst	10h
+			cp	d
+			ld	(de),a
+			jp	m,L4467
+			add	a,(hl)
+			dec	a
+			sbc	a,h
+			dec	bc
+			jr	z,Laab4
+			ccf
+			pop	bc
+			jp	m,L3845
+			push	hl
+			ld	h,l
+			sub	l
+			or	c
+			ld	e,09h
+			or	e
+			inc	(hl)
+			cp	c
+			ld	hl,c620h
+			or	e
+			di
+			ld	(bc),a
+			ld	h,d
+			sub	b
+			ld	e,e
+			add	hl,de
+			ld	h,(hl)
+			sub	a
+			jp	c,L080a
+			di
+			jr	z,Lab02
+			ld	l,b
+			add	a,a
+			inc	(hl)
+			adc	a,c
+			ld	(hl),b
+			cpl
+			ld	b,c
+			inc	bc
+			ld	a,b
+			sbc	a,b
+			rla
+			nop (2x) *
+			ld	e,8ch
+			ld	c,7eh
+			and	e
+			nop (2x) *
+			sbc	a,a
+			rst	00h
+			ld	e,h
+			ld	d,e
+			halt
+			and	b
+			dec	b
+			cpl
+			ld	c,d
+			rst	10h
+			ld	d,h
+			pop	bc
+			inc	bc
+			ex	(sp),hl
+			adc	a,l
+			inc	c
+			ld	d,a
+			sbc	a,(hl)
+			call	nz,L9a56
+			cp	e
+			dec	(hl)
+			ld	de,e562h
+			call	pe,Lbadd
+			sbc	a,(hl)
+			adc	a,abh
+			ld	b,c
+			or	(hl)
+			add	hl,de
+			sub	h
+			ld	a,(bc)
+			ld	h,e
+			dec	l
+			in	a,(fdh)
+			xor	l
+			dec	sp
+			halt
+			or	d
+			ld	h,c
+			ld	(5e46h),a
+			ld	c,a
+			ld	e,l
+			ld	l,l
+			ld	l,e
+			ld	h,l
+			sbc	a,e
+			inc	l
+			jp	nc,L3f97
+			ld	sp,1840h
+			ld	d,l
+			ld	l,c
+			inc	h
+			ld	(hl),a
+			inc	h
+			ld	d,(hl)
+			ld	l,h
+			ld	(hl),a
+			ld	h,l
+			rst	00h
+			cp	e6h
+			ld	sp,cb70h
+			inc	b
+			ld	b,c
+			jp	p,L203e
+			ld	hl,(fe13h)
+			adc	a,d0h
+			ld	e,e
+			jp	nc,L265a
+			cp	l
+			add	a,c1h
+			rst	20h
+			ld	(hl),82h
+			cp	d1h
+			xor	l
+			inc	h
+			nop (2x) *
+			ld	(hl),a
+			add	a,d
+			ld	d,h
+			adc	a,85h
+			exx
+			sbc	a,b
+			and	h
+			ld	(hl),d
+			ld	c,(hl)
+			add	a,a
+			ld	a,a
+			cp	b
+			xor	(hl)
+			jr	nz,Laac7
+			rrca
+			cp	b
+			inc	a
+			ld	c,l
+			add	a,h
+			add	a,c
+			adc	a,l
+			rst	30h
+			cp	d
+			xor	d
+			sbc	a,h
+			ld	c,b
+			ld	hl,4ce5h
+			dec	d
+			and	a
+			ld	(2811h),a
+			inc	b
+			ld	h,a
+			cp	d
+			and	e
+			ld	l,a
+			ld	a,b
+			ld	h,h
+			sub	c
+			ld	a,(bc)
+			ld	d,(hl)
+			inc	hl
+			jp	c,L2ccb
+			or	b
+			ld	l,d
+			dec	de
+			or	l
+			ld	b,(hl)
+			ld	e,(hl)
+			ld	(hl),h
+			ld	e,b
+			ld	c,(hl)
+			ld	e,h
+			ld	c,e
+			add	a,4eh
+			ld	c,h
+			ld	h,ceh
+			adc	a,e
+			ld	l,e
+			xor	e
+			add	hl,hl
+			and	b
+			or	a
+			cp	e
+			ld	d,h
+			ld	b,c
+			sbc	a,(hl)
+			or	e
+			and	c4h
+			ld	b,b
+			ld	d,l
+			dec	de
+			nop (2x) *
+			or	d
+			ld	l,e
+			ld	b,a
+			di
+			dec	h
+			ret	p
+			ld	l,h
+			dec	c
+			halt
+			cp	e
+			call	pe,L68e9
+			call	Lf718
+			jp	z,L3ac3
+			ld	a,e
+			ld	e,a
+			ld	hl,3d08h
+			ld	a,(de)
+			ld	e,b
+			ld	h,c
+			inc	d
+			scf
+			ld	a,l
+			cp	h
+			push	bc
+			dec	de
+			inc	bc
+			push	bc
+			or	(hl)
+			ld	e,h
+			cp	l
+			ld	(hl),a1h
+			inc	sp
+			ld	a,a
+			inc	(hl)
+			rrca
+			inc	a
+			push	de
+			add	hl,bc
+			inc	e
+			ld	h,e
+			ld	a,(bc)
+			add	a,89h
+			rlca
+			ld	d,d
+			add	hl,bc
+			xor	h
+			inc	d
+			dec	l
+			ex	af,af'
+			dec	c
+			ld	h,fbh
+			ld	e,b
+			dec	h
+			or	e
+			dec	(hl)
+			dec	b
+			ld	h,h
+			ld	b,h
+			call	z,L1ae9
+			and	a
+			jp	L8224
+			db	c8h,a2h,5ch,55h,fah,32h,25h,9ch
+			db	f4h,b5h,60h,53h,7fh,f2h,91h,4ch
+			db	40h,deh,1eh,97h,57h,cah,cbh,7fh
+			db	1eh,53h,b6h,3bh,9ch,cch,38h,51h
+			db	69h,0dh,ech,90h,c4h,4ch,7ah,f2h
+			db	71h,22h,36h,90h,26h,eah
+			add	a,(hl)
+			ret	m
+			ld	b,(hl)
+			ld	e,d9h
+			ret	c
+			ex	(sp),hl
+			ld	e,(hl)
+			ld	b,(hl)
+			rst	08h
+			add	a,a
+			call	nc,Lb27c
+			sbc	a,l
+			ld	sp,hl
+			cp	c
+			jr	c,Lac41
+			ld	(bc),a
+			dec	e
+			ret	nc
+			sbc	a,l
+			ld	l,(ix + 10h)
+			ld	d,c
+			ld	c,f2h
+			sbc	a,l
+			rlca
+			sub	e
+			ld	c,e
+			jp	pe,Lcf6c
+			add	a,c
+			and	a
+			ld	a,(bc)
+			ld	(18d2h),a
+			ld	d,a
+			ld	b,h
+			ld	a,e
+			sub	e
+			call	p,Lb47e
+			or	h
+			ld	h,l
+			add	hl,sp
+			inc	de
+			cp	d
+			ld	a,(8659h)
+			ld	(de),a
+			or	l
+			out	(9bh),a
+			dec	e
+			ld	(hl),h
+			jp	c,Lcfdb
+			or	c
+			rst	18h
+			ld	de,b4fdh
+			ld	d,a
+			adc	a,e
+			ld	b,c
+			push	bc
+			pop	de
+			ld	c,c
+			adc	a,e
+			jr	nz,Lac0f
+			and	l
+			add	a,(hl)
+			sbc	a,c
+			adc	a,h
+			ld	d,b
+			dec	c
+			add	a,h
+			and	l
+			ld	(69e7h),hl
+			ex	(sp),hl
+			ld	e,l
+			ld	a,d
+			ret	nz
+			xor	l
+			ld	l,d
+			dec	hl
+			xor	b
+			ld	sp,hl
+			add	a,c
+			add	hl,de
+			ld	h,e
+			ld	e,l
+			add	a,e
+			ret	z
+			cp	l
+			ld	b,(hl)
+			add	a,e
+			or	a
+			jp	L2edd
+			db	61h,d2h,c0h,c6h,36h,aeh,8fh,e9h
+			db	feh,5eh,6eh,5ah,56h,0bh,28h,86h
+			db	86h,2eh,bdh,0eh,b3h,22h,a8h,8dh
+			db	e6h,6fh,c4h,2ah,27h,64h,b9h,fbh
+			db	66h,f6h,c1h,01h,25h,f4h,21h,75h
+			db	23h,17h,6bh,39h,44h,70h,f5h,ceh
+			db	21h
+			inc	(hl)
+			out	(d7h),a
+			xor	(hl)
+			inc	e
+			push	hl
+			adc	a,l
+			inc	de
+			im	0/1 *
+			sub	h
+			ld	a,h
+			jp	pe,L2e41
+			ret
+			db	b2h,18h,38h,04h,08h
+			adc	a,h
+			ld	a,c
+			rst	20h
+			jr	nc,Lacbd
+			jr	nz,Lacd4
+			inc	bc
+			sbc	a,d
+			inc	a
+			ld	(hl),e
+			jr	Lad1a
+			db	8fh,80h,3ah,b2h,cdh,f4h,fdh,8dh
+			xor	c
+			add	a,a
+			ret	z
+			ld	(291dh),hl
+			call	nc,Ld339
+			ld	b,d
+			sbc	a,c
+			add	a,a
+			dec	sp
+			and	h
+			ret	nz
+			daa
+			ret	p
+			cp	e
+			ldir
+			add	hl,sp
+			ld	sp,a0beh
+			adc	a,(hl)
+			add	a,(hl)
+			sbc	a,e
+			dec	de
+			push	bc
+			dec	b
+			cp	c
+			jp	(hl)
+			db	c1h,93h,b6h,b7h,eah,0dh,cfh,4dh
+			db	93h
+			jp	m,L8c3a
+			ret
+			db	f0h,30h,0ch,d8h,7eh,51h,8bh,aah
+			db	7fh,e2h,c6h,84h,8bh,32h,13h,dbh
+			db	48h,87h,a4h,30h,6ah,ech,62h,48h
+			db	89h,27h,d0h,39h,92h,35h,85h,d9h
+			db	edh,9ch,85h,43h,56h,45h,b1h,e3h
+			db	a3h,27h,94h,5dh,5fh,07h,5eh,84h
+			ret	p
+			rst	30h
+			cp	d
+			ld	(hl),d
+			dec	hl
+			call	nc,Lde12
+			ret	po
+			ld	c,dfh
+			ld	(54f6h),a
+			ld	e,c
+			cp	(hl)
+			ld	d,l
+			ld	a,a
+			ld	d,c
+			or	l
+			ld	(6a7bh),a
+			or	d
+			ld	h,(hl)
+			ret	z
+			add	a,b
+			cp	e
+			sbc	a,a
+			or	c
+			ld	hl,(b3c1h)
+			ld	c,(hl)
+			ld	(hl),e
+			jp	L038c
+			db	42h
+			ld	d,a
+			rst	38h
+			and	a
+			ld	l,d
+			sub	d
+			ld	(hl),c
+			adc	a,b
+			call	m,L4c54
+			sub	d
+			add	hl,sp
+			ld	b,e
+			rla
+			rst	28h
+			sub	c
+			ld	e,l
+			pop	bc
+			ld	d,e
+			sub	d
+			ld	c,h
+			ld	a,2eh
+			dec	e
+			halt
+			push	af
+			jp	z,L8981
+			ld	c,c
+			and	d
+			call	L6255
+			pop	de
+			ld	a,a
+			ret
+			db	f1h,2dh,fdh,62h,15h,2ch,72h,83h
+			db	4dh,81h,9ch,91h,b0h,10h,ceh,a4h
+			db	b8h,66h,3ch,eeh,e9h,5ah,bah,d0h
+			db	76h,7ch,39h,c4h,23h,5dh,23h,f9h
+			db	8ch,dfh,3eh,1fh,2eh,30h,84h,06h
+			db	61h,34h,c9h,8ch,bdh,10h,bch,46h
+			db	a7h,cch,60h,6ch,2ah,3eh,2ch,45h
+			db	d7h,fbh,d2h,cdh
+			ld	bc,3db0h
+			and	l
+			push	hl
+			ld	de,4b57h
+			ld	(hl),c
+			adc	a,62h
+			rst	10h
+			in	a,(87h)
+			add	hl,bc
+			ret	nc
+			xor	d
+			ld	e,e
+			inc	hl
+			sbc	a,h
+			ld	a,(bc)
+			and	eah
+			rst	10h
+			ld	a,h
+			sub	c
+			ld	(hl),c
+			ld	h,b
+			exx
+			ld	h,c
+			ld	(hl),d
+			cp	b
+			ld	a,(15b7h)
+			dec	sp
+			sub	e
+			inc	(hl)
+			scf
+			ld	e,d
+			ld	a,l
+			ld	h,b
+			adc	a,e8h
+			adc	a,c
+			xor	d
+			ld	a,b
+			add	a,25h
+			ret	c
+			and	e
+			jr	c,Ladea
+			rst	28h
+			push	af
+			nop (2x) *
+			ld	d,c
+			jp	nz,L9cad
+			call	pe,L5323
+			ld	a,(hl)
+			ld	b,1bh
+			ld	e,c
+			call	c,L6a64
+			sbc	a,d
+			sbc	a,c
+			nop (2x) *
+			and	9ah
+			ld	(de),a
+			dec	bc
+			dec	e
+			sub	d
+			ld	h,a
+			inc	b
+			jp	nc,L586e
+			ld	c,c
+			ld	(hl),a
+			ld	b,l
+			dec	sp
+			ld	l,(hl)
+			cp	1bh
+			and	c
+			ld	(hl),b0h
+			ld	sp,474eh
+			ld	d,h
+			nop
+			ret	po
+			ex	af,af'
+			call	p,L46fb
+			cp	e
+			ld	c,a
+			dec	bc
+			sbc	a,e
+			pop	bc
+			add	a,e
+			push	de
+			sbc	a,e
+			ld	b,c
+			call	L2761
+			dec	b
+			ld	(1d8eh),hl
+			di
+			xor	h
+			sbc	a,e
+			sbc	a,b
+			jp	nc,L3da5
+			jp	nc,L57bf
+			call	nz,L76b2
+			jp	(hl)
+			db	f4h,d8h,98h,55h,20h,a8h,b7h,24h
+			db	d8h,d4h,30h,52h,67h,84h,70h,8ch
+			db	fah,3dh,26h,12h,4ch,d0h,a1h,0eh
+			db	0dh,c2h,25h,62h,c9h,5eh,b8h,0eh
+			db	0ah,63h,9dh,f4h,a5h,ech
+			dec	hl
+			dec	e
+			set	4,d
+			ld	l,e
+			ld	d,b
+			rra
+			ld	d,(hl)
+			ld	d,e
+			out	(2ah),a
+			ld	e,(hl)
+			ld	d,l
+			ld	c,b
+			jr	c,Laec8
+			ld	b,a
+			in	a,(62h)
+			add	a,a
+			sub	e
+			ret	nz
+			jr	nz,Lae28
+			xor	c
+			ld	hl,d755h
+			ld	c,c
+			sbc	a,e
+			ld	e,c
+			ret	m
+			add	a,b
+			pop	hl
+			adc	a,d
+			call	nc,Lef54
+			ld	e,e
+			ld	(d024h),hl
+			ld	l,6bh
+			rst	38h
+			ld	l,18h
+			add	a,d
+			ld	iyl,c *
+			in	a,(b8h)
+			and	(hl)
+			jp	(hl)
+			db	44h,b9h,fch,b7h,9bh,a5h,d8h,f2h
+			db	d5h,cbh,52h,6eh,67h,76h,65h,73h
+			db	d6h,8ah,4fh,90h,61h,f6h,c2h,55h
+			db	0bh,88h,7ch,87h,beh,78h,16h,2dh
+			db	eah,8eh
+			adc	a,c
+			add	a,h
+			ld	de,27f4h
+			rst	08h
+			ld	l,d
+			ld	l,h
+			ld	a,b
+			dec	c
+			or	l
+			inc	hl
+			or	e
+			rl	(hl)
+			ld	a,d
+			ld	hl,(b3c4h)
+			ld	a,h
+			sbc	a,e
+			ld	l,c
+			ld	e,b
+			dec	l
+			dec	hl
+			xor	fah
+			ld	hl,1806h
+			pop	hl
+			ld	e,d
+			or	l
+			ld	d,l
+			sbc	a,(hl)
+			ret	po
+			rra
+			push	af
+			ld	h,e
+			ld	sp,7a46h
+			inc	d
+			ld	a,b
+			adc	a,b
+			ld	(hl),b
+			ld	d,e
+			ccf
+			ld	a,a
+			jp	p,La6a3
+			ld	hl,(7500h)
+			sub	a
+			adc	a,h
+			and	c
+			and	l
+			ld	h,l
+			sbc	a,e
+			ld	a,h
+			inc	(hl)
+			inc	h
+			cp	c
+			inc	sp
+			pop	bc
+			daa
+			call	z,L6328
+			xor	l
+			add	hl,hl
+			ex	de,hl
+			set	3,(hl)
+			sub	(hl)
+			ld	b,d
+			and	75h
+			jr	c,Lae84
+			out	(5bh),a
+			ld	c,e
+			nop (2x) *
+			ex	de,hl
+			ld	d,l
+			sub	(hl)
+			pop	hl
+			ex	(sp),hl
+			ld	sp,7100h
+			ccf
+			pop	af
+			rst	38h
+			add	hl,sp
+			inc	l
+			and	b
+			ld	h,d
+			sub	e
+			inc	h
+			and	(hl)
+			add	a,(hl)
+			sbc	a,c
+			ld	a,(hl)
+			inc	de
+			ld	hl,(90c9h)
+			ld	a,(de)
+			ld	c,e
+			pop	af
+			sbc	a,l
+			sbc	a,l
+			ld	e,h
+			sbc	a,b
+			ld	e,00h
+			add	a,b
+			dec	hl
+			call	po,L948b
+			ld	c,h
+			jp	pe,L1cce
+			rst	20h
+			and	d
+			call	z,L7a12
+			sbc	a,h
+			ld	l,h
+			inc	l
+			and	e
+			rst	00h
+			ld	d,d7h
+			sub	h
+			cp	d
+			pop	hl
+			ld	b,b
+			ld	bc,9a86h
+			inc	a
+			ld	e,e
+			ld	hl,(d8c1h)
+			call	c,L0563
+			sub	(hl)
+			ld	e,e
+			dec	sp
+			ld	c,a
+			ld	h,h
+			rst	30h
+			ld	c,e
+			ld	c,d
+			ld	c,(hl)
+			ld	d,l
+			and	e
+			ret	c
+			dec	c
+			ld	a,(de)
+			rst	20h
+			xor	c0h
+			cp	e
+			ex	af,af'
+			call	p,Laa27
+			ex	(sp),hl
+			ld	(20a7h),a
+			and	e
+			ld	d,a
+			or	(hl)
+			ld	(de),a
+			sub	d
+			ld	e,69h
+			rst	00h
+			and	d
+			add	a,b
+			pop	de
+			jp	z,L3554
+			xor	c
+			call	nc,L0c55
+			ld	l,a
+			inc	d
+			ex	af,af'
+			ld	c,h
+			dec	a
+			or	b
+			push	de
+			ld	e,d
+			add	a,(hl)
+			ld	(de),a
+			push	hl
+			ld	c,e
+			xor	c
+			sub	c
+			ld	(hl),h
+			rrca
+			ex	af,af'
+			ld	h,e
+			ld	b,2eh
+			or	01h
+			xor	b
+			ret	nc
+			call	nz,L9d54
+			rlca
+			dec	l
+			ld	e,c
+			ld	l,76h
+			ld	b,h
+			sbc	a,e
+			adc	a,c8h
+			call	L07c4
+			cp	d
+			inc	(hl)
+			and	d
+			ld	l,(hl)
+			ret	p
+			jr	z,Laf29
+			ret	m
+			inc	e
+			ld	h,h
+			ld	a,d
+			sbc	a,f4h
+			and	a
+			and	a
+			ei
+			exx
+			ex	af,af'
+			add	a,b
+			rra
+			dec	sp
+			ld	c,bch
+			call	z,L5924
+			ld	b,b
+			add	a,(hl)
+			ld	d,b
+			dec	e
+			sub	e
+			add	a,6dh
+			inc	bc
+			ld	a,01h
+			cp	h
+			ld	a,h
+			jr	nc,Lafcc
+			ld	(hl),c
+			cp	d
+			ld	d,d
+			add	a,6ah
+			ld	(hl),87h
+			add	hl,de
+			adc	a,b
+			cp	d
+			ld	a,h
+			sub	b
+			ld	h,(hl)
+			call	p,L5ab2
+			sbc	a,l
+			ld	l,a
+			ret	p
+			ld	l,dfh
+			add	a,e
+			ret	m
+			xor	53h
+			ld	h,e
+			cp	c
+			daa
+			call	p,L9789
+			ld	e,b
+			sbc	a,a
+			add	hl,sp
+			and	a
+			ret	nz
+			ld	(5373h),a
+			ld	c,h
+			pop	de
+			ld	(de),a
+			rlca
+			or	d
+			rst	30h
+			jp	(hl)
+			db	76h,5ah,18h,c5h,2eh,bbh,f9h,3ah
+			db	ffh,dbh,7fh,f6h,f6h,b0h,a1h,52h
+			db	8bh
+			inc	d
+			dec	h
+			jp	p,L2156
+			sbc	a,l
+			jr	c,Lafe5
+			ld	a,h
+			ld	d,l
+			push	hl
+			ld	(hl),l
+			ld	l,d
+			pop	af
+			ld	c,a
+			xor	b
+			jp	L0f97
+			db	03h,feh,64h,2ch,d2h,dah,16h,ech
+			db	7fh,b6h,1ah,dah,97h,55h,c6h,20h
+			db	fdh,57h,a0h,a6h,32h,6ah,e3h,cch
+			db	aah,f6h,87h,16h,27h,f5h,9ch,02h
+			db	bbh,47h,4dh,3fh,9dh,d9h,07h,2ah
+			db	eah,61h,10h,1eh,03h,d5h,e5h,0bh
+			db	86h,b5h,37h,e6h,2fh,98h,76h,6eh
+			db	13h,77h,9ch,a7h,6eh,e6h,8ah,76h
+			db	bch,cbh,9ch,44h,f0h,5fh,dfh,ffh
+			db	feh,7fh,69h,0bh,5eh,a1h,e1h,96h
+			db	59h,99h,c7h,0eh,cfh,3fh,fah,2dh
+			db	69h,c2h,43h,73h,62h,52h,15h,25h
+			db	9ah,feh,64h,59h,33h,54h,58h,50h
+			db	b2h,cch,0dh,87h,71h,3dh,c9h,83h
+			db	25h,fah,bch,31h,48h,3fh,91h,43h
+			db	cbh,0dh,bfh,87h,9ch,37h,3bh,e0h
+			db	f3h,93h,10h,87h
+			xor	a
+			add	a,b
+			sub	l
+			ld	l,7ah
+			ld	b,e
+			or	c
+			sub	b
+			ld	a,a
+			jp	nz,Lda90
+			rst	28h
+			sbc	a,e
+			ld	d,l
+			rst	10h
+			dec	hl
+			ld	(hl),d
+			ld	de,afc5h
+			rst	08h
+			ret	nz
+			call	Lcd2e
+			jp	(hl)
+			db	9bh,97h,1ah,6bh,d2h,55h,1ah,66h
+			db	a7h,e7h,00h,e9h,c3h,71h,0fh,cch
+			db	a6h,5dh,99h,14h,6eh,ddh,4eh,e2h
+			db	e4h,2fh,05h,edh,cdh,75h,c7h,1bh
+			db	06h,0bh,14h,37h,4ah,78h
+			and	l
+			or	c
+			xor	d
+			ld	l,a
+			inc	l
+			xor	h
+			ld	b,9fh
+			dec	h
+			rst	00h
+			ld	c,d
+			dec	e
+			ld	d,a
+			dec	c
+			dec	l
+			ccf
+			ld	l,d
+			cpl
+			pop	af
+			cp	7bh
+			ld	h,e
+			halt
+			pop	hl
+			inc	l
+			ld	e,h
+			ld	e,c
+			call	nc,L6c5e
+			rst	18h
+			ld	c,l
+			ei
+			add	a,b
+			dec	(hl)
+			ret	p
+			scf
+			nop
+			ei
+			add	hl,sp
+			inc	bc
+			ret	m
+			or	l
+			and	e
+			ld	a,(hl)
+			adc	a,ffh
+			add	hl,sp
+			push	de
+			pop	af
+			add	a,d
+			add	hl,hl
+			call	pe,L0521
+			ld	l,e
+			ld	b,c
+			and	l
+			or	d
+			sub	(hl)
+			jp	nz,L7a46
+			ld	d,b
+			jp	nc,Lc02f
+			call	c,L9161
+			ld	h,c
+			ld	e,d
+			dec	e
+			ld	(hl),9dh
+			ld	e,(hl)
+			ld	b,(hl)
+			inc	b
+			nop (2x) *
+			call	m,L3951
+			ld	d,c
+			call	c,Lde31
+			adc	a,a
+			add	a,l
+			ld	l,a
+			ret	z
+			ld	l,l
+			ld	b,l
+			dec	a
+			ld	c,l
+			ld	c,d
+			ld	(hl),b
+			ld	a,a
+			ld	h,b
+			rrca
+			ld	h,(hl)
+			dec	bc
+			ld	(hl),c
+			and	a
+			rrca
+			ld	b,e
+			ld	d,a
+			jp	z,L5530
+			and	98h
+			sbc	a,(hl)
+			and	l
+			pop	af
+			nop
+			dec	e
+			xor	(hl)
+			ld	a,(af90h)
+			cp	l
+			add	a,b
+			inc	hl
+			inc	bc
+			ld	e,e
+			ret	p
+			sub	b
+			add	hl,sp
+			dec	hl
+			ld	h,h
+			sub	(hl)
+			and	c
+			ld	a,(de)
+			nop (2x) *
+			ld	e,e
+			ld	sp,6f47h
+			ld	(hl),c
+			call	L8ab0
+			ret	z
+			ld	(hl),l
+			or	a
+			sbc	a,d
+			ld	bc,0da0h
+			ld	b,b
+			cp	a
+			rra
+			add	a,a
+			inc	bc
+			ld	l,33h
+			add	a,(hl)
+			or	d
+			and	53h
+			ld	h,a
+			or	fah
+			ret	nz
+			inc	sp
+			add	hl,bc
+			push	af
+			ld	e,c
+			ld	e,(hl)
+			dec	de
+			ld	e,d
+			dec	bc
+			ret
+			db	9bh,d6h,6ah,37h,5ah,90h,c5h,43h
+			db	e5h,99h,23h,48h,eah,06h,06h,adh
+			db	37h,32h,94h,22h,f0h
+			rst	30h
+			xor	h
+			ld	a,(cad5h)
+			ld	(hl),l
+			ld	hl,(7559h)
+			inc	e
+			ld	c,d
+			dec	e
+			ex	de,hl
+			ld	a,(de)
+			xor	l
+			sbc	a,b
+			jp	nz,L67c8
+			ld	(de),a
+			ld	a,a
+			ld	e,e
+			dec	b
+			jp	(hl)
+			db	a9h,33h,86h,9fh,cfh,8ah,f9h,8dh
+			db	34h,41h,08h,e5h,32h,78h,d1h,e3h
+			db	89h,97h,67h,04h,29h,d1h,a8h,6ch
+			db	38h,96h,30h,f6h,d4h,7ah,a5h,4ah
+			db	fah,10h,8dh,10h,50h,19h,57h,c4h
+			db	f2h,a0h,12h,56h,edh,6fh,64h,afh
+			db	a2h,b9h,29h,57h,a3h
+			call	nc,Lfc5b
+			adc	a,l
+			dec	de
+			ld	b,00h
+			djnz	Lb198
+			or	c4h
+			ld	b,a
+			ld	c,h
+			call	p,L71d8
+			sbc	a,a
+			ld	b,e
+			ld	l,h
+			ld	b,d
+			nop (2x) *
+			or	a
+			ld	a,(de)
+			ld	(ae3fh),a
+			pop	af
+			call	nz,L68e7
+			or	e
+			pop	af
+			ld	e,d
+			jr	nz,Lb256
+			jp	nz,L08da
+			inc	d
+			ld	b,(hl)
+			ld	(bc),a
+			or	a
+			inc	de
+			ld	b,e
+			xor	c
+			ld	d,e
+			inc	b
+			rra
+			ld	d,c
+			sub	e
+			ld	e,a
+			ld	e,l
+			ld	a,l
+			adc	a,h
+			push	bc
+			in	a,(c4h)
+			ld	l,c
+			dec	d
+			sub	h
+			ld	c,41h
+			inc	sp
+			call	nc,L42a8
+			ld	(de),a
+			ld	a,d
+			ex	af,af'
+			ld	(hl),l
+			ld	a,e
+			ld	(de),a
+			rst	20h
+			ld	a,(ebf0h)
+			xor	d
+			add	hl,bc
+			cp	a
+			inc	sp
+			ld	(bc),a
+			ld	l,c
+			add	a,h
+			add	a,7bh
+			ret
+			db	41h,87h,89h,eeh,3ch
+			call	p,Le11f
+			scf
+			call	p,L5361
+			sub	l
+			jr	c,Lb21f
+			out	(4dh),a
+			sbc	a,e
+			jp	nc,Lcbb1
+			xor	(hl)
+			inc	a
+			xor	c
+			ld	e,b
+			adc	a,a
+			ld	e,a
+			jp	Lf17e
+			db	8eh,c0h,cfh,d2h,fbh,fah,29h
+			sbc	a,e
+			ld	a,h
+			pop	af
+			dec	h
+			ccf
+			scf
+			sbc	a,(hl)
+			add	a,d
+			ret	z
+			and	l
+			ret	c
+			adc	a,e
+			jp	Le243
+			db	d2h,14h,09h,71h,38h,18h,e4h,cdh
+			db	f7h,47h,e9h,28h,dah
+			cp	l
+			call	nc,Ld738
+			ld	a,b
+			ret	p
+			call	Lcdfa
+			dec	d
+			ld	a,b
+			and	l
+			ld	a,(hl)
+			ld	c,e
+			rst	08h
+			ld	l,a
+			and	l
+			pop	af
+			sbc	a,l
+			out	(0dh),a
+			ld	a,(hl)
+			jr	Lb214
+			db	96h,6dh,e8h,2fh,8bh,74h,44h,1bh
+			db	f6h,a7h,bfh,b3h
+			sub	a
+			xor	(hl)
+			rra
+			xor	c
+			rst	18h
+			in	a,(52h)
+			call	m,L6490
+			sbc	a,c
+			ld	a,h
+			halt
+			ld	b,a
+			ld	b,d
+			inc	e
+			ld	(hl),e
+			pop	de
+			jr	nz,Lb2d7
+			ld	sp,hl
+			scf
+			ld	(de),a
+			sub	(hl)
+			dec	a
+			add	a,a
+			xor	h
+			push	af
+			add	a,b7h
+			and	(hl)
+			ld	c,b
+			adc	a,46h
+			adc	a,a
+			cp	b
+			adc	a,b
+			inc	a
+			ld	h,e
+			ld	(de),a
+			cpl
+			add	a,d
+			halt
+			ld	c,a
+			dec	e
+			ld	d,c
+			and	d
+			ld	sp,hl
+			xor	(hl)
+			inc	(hl)
+			ld	c,b
+			inc	b
+			inc	sp
+			adc	a,h
+			ld	l,e
+			call	nz,Lb538
+			xor	(hl)
+			jr	c,Lb2ef
+			call	p,Lffd8
+			xor	d
+			inc	a
+			call	L85fe
+			ld	d,a
+			ld	d,h
+			xor	h
+			djnz	Lb2af
+			sbc	a,l
+			dec	a
+			inc	e
+			add	a,b
+			pop	hl
+			pop	bc
+			inc	e
+			ld	d,(hl)
+			jr	nc,Lb32f
+			add	hl,sp
+			ld	h,e
+			djnz	Lb291
+			xor	h
+			and	d
+			ld	h,a
+			sub	c
+			adc	a,a
+			ld	h,d
+			ld	c,d
+			sub	c
+			xor	(hl)
+			cp	d
+			ex	af,af'
+			inc	bc
+			ld	l,b
+			xor	18h
+			daa
+			call	L01ca
+			rst	18h
+			jp	po,Laf82
+			dec	c
+			rst	28h
+			ret	c
+			ld	b,c
+			ld	a,(5f73h)
+			ret	pe
+			scf
+			di
+			ld	(hl),d
+			ld	c,a
+			ld	h,d
+			sub	l
+			sbc	a,d
+			ld	a,h
+			dec	d
+			inc	de
+			inc	hl
+			rrca
+			ld	e,e
+			adc	a,d
+			sbc	a,e
+			ret	m
+			inc	h
+			ld	d,3ah
+			inc	de
+			jp	p,L3d4f
+			ccf
+			ld	l,(hl)
+			ex	(sp),hl
+			ld	b,(hl)
+			ld	(hl),75h
+			adc	a,a
+			cp	l
+			xor	d
+			ld	l,c
+			ld	c,c
+			dec	sp
+			jr	c,Lb2f4
+			add	a,e4h
+			ld	l,c
+			ld	e,c
+			cp	e
+			xor	b
+			dec	c
+			djnz	Lb371
+			cp	(hl)
+			xor	b
+			or	b
+			jp	c,L913f
+			rst	08h
+			ld	hl,(aabeh)
+			ld	c,26h
+			pop	de
+			ld	e,l
+			ret	c
+			ld	h,d
+			nop
+			ld	d,e
+			pop	hl
+			push	de
+			xor	h
+			ld	sp,hl
+			ld	c,l
+			sbc	a,21h
+			ret	m
+			dec	hl
+			ld	l,d
+			ld	c,d
+			ld	sp,hl
+			cp	l
+			adc	a,c
+			sbc	a,c
+			call	po,L6d3a
+			ld	h,48h
+			dec	sp
+			jp	L2f1e
+			db	e6h,02h
+			ld	c,d
+			cp	c
+			adc	a,b
+			and	c
+			sbc	a,(hl)
+			ld	hl,(L577c)
+			jp	po,L3d6a
+			dec	b
+			ld	e,bdh
+			ld	l,d
+			pop	hl
+			rst	10h
+			ld	e,h
+			ld	a,c2h
+			sbc	a,d
+			cp	(hl)
+			ld	b,d
+			add	a,(hl)
+			jr	nz,Lb404
+			sbc	a,e
+			ld	a,b
+			nop (2x) *
+			sub	a
+			ld	h,b
+			djnz	Lb37c
+			ld	h,h
+			or	a
+			ret	nz
+			xor	b
+			adc	a,(hl)
+			inc	de
+			pop	de
+			cp	d
+			ld	c,a
+			djnz	Lb3b8
+			adc	a,c
+			sub	e
+			ld	d,b
+			dec	hl
+			add	hl,hl
+			ld	(hl),52h
+			sbc	a,d
+			xor	(hl)
+			ld	h,d
+			jp	nc,L3667
+			jp	c,L2c3b
+			and	b
+			adc	a,a
+			or	3dh
+			ld	b,l
+			ld	a,d
+			cp	l
+			ld	(e70eh),hl
+			nop (2x) *
+			rst	30h
+			ld	(hl),h
+			ld	l,f0h
+			ex	af,af'
+			inc	l
+			jp	nz,Lc4bd
+			ld	b,b
+			ld	e,l
+			jr	nc,Lb3bf
+			ld	d,h
+			di
+			ld	b,e
+			sub	d
+			ld	a,d
+			ld	d,h
+			ld	(hl),a
+			cp	l
+			ret	p
+			ld	l,l
+			dec	a
+			ld	e,h
+			xor	h
+			ld	e,c3h
+			or	l
+			sub	a
+			xor	l
+			ld	de,35b2h
+			ret	c
+			add	a,(hl)
+			call	c,L96dd
+			ld	e,a
+			rrca
+			ld	e,(hl)
+			ld	b,77h
+			rst	20h
+			ld	h,e
+			xor	d
+			ld	a,(de)
+			dec	c
+			cp	c
+			inc	a
+			inc	l
+			call	z,L2668
+			ld	(hl),d
+			dec	l
+			ld	(de),a
+			ld	a,b
+			ld	c,58h
+			or	l
+			jr	z,Lb40f
+			ccf
+			adc	a,l
+			jr	nz,Lb444
+			cp	eah
+			ret	c
+			call	p,L2658
+			dec	d
+			dec	b
+			jp	z,Ld5e4
+			xor	c2h
+			add	a,h
+			call	nz,L54f0
+			add	a,c
+			ret	nz
+			ld	b,b
+			ld	e,7eh
+			ld	a,(383bh)
+			ret
+			db	58h,80h
+			ld	h,(hl)
+			ld	e,b
+			jr	nc,Lb47d
+			ld	c,34h
+			ld	(787fh),a
+			rst	00h
+			exx
+			ld	(hl),h
+			jp	(hl)
+			db	d2h,57h,67h,48h,c6h,cch,f8h,78h
+			db	25h,54h,ech,adh,52h,5bh,6ch,f2h
+			db	3ah,30h,ceh,9eh,dfh,92h,96h,a2h
+			db	56h,ach,1ah,96h,57h,81h,24h
+			ld	e,l
+			inc	c
+			xor	a
+			rrca
+			add	a,16h
+			cpl
+			xor	b
+			ld	(hl),l
+			ld	e,e
+			ld	(hl),9fh
+			add	hl,bc
+			ret
+			db	b1h,8dh,65h,fah,bch,59h,98h,efh
+			db	94h,eeh,90h,37h,34h,79h,e4h,ach
+			db	d0h,1dh,4ch,cah,7dh,18h,9dh,adh
+			db	07h,0ch,d0h,4ch,b7h,f5h,9ah,b9h
+			db	bah,dfh,15h,0fh,25h,f4h,cch,c9h
+			db	1fh,04h,d7h
+			ld	c,a
+			add	a,l
+			ld	h,c
+			ld	a,(5019h)
+			ex	(sp),hl
+			scf
+			call	p,L7171
+			dec	bc
+			dec	c
+			nop (2x) *
+			adc	a,c2h
+			sub	d
+			rst	00h
+			adc	a,e
+			inc	bc
+			xor	d
+			xor	e
+			ld	(hl),d
+			ld	c,h
+			sub	a
+			add	hl,de
+			and	e
+			ld	c,l
+			ld	c,aah
+			ld	e,e
+			dec	sp
+			scf
+			call	z,L89ae
+			call	z,L0153
+			ld	h,l
+			ld	l,l
+			xor	b
+			ld	sp,6111h
+			ld	l,c
+			res	3,d
+			ld	(hl),f4h
+			ld	e,b
+			ld	hl,224ch
+			ld	e,l
+			and	l
+			ld	e,h
+			ld	e,e
+			ld	a,e
+			dec	b
+			ld	a,e
+			sbc	a,h
+			adc	a,d
+			ld	e,h
+			or	a
+			sbc	a,d
+			dec	e
+			cp	b
+			and	c
+			adc	a,d
+			sbc	a,c
+			ld	l,4fh
+			push	af
+			ld	h,e
+			add	a,l
+			ld	c,(hl)
+			ld	(bc),a
+			inc	(hl)
+			rst	10h
+			dec	e
+			rra
+			dec	de
+			inc	a
+			ld	h,c
+			ld	l,c
+			jr	c,Lb53a
+			ret	pe
+			ccf
+			inc	sp
+			ld	e,l
+			ld	sp,0cbch
+			sbc	a,(hl)
+			call	nc,L43ad
+			ld	a,(de)
+			inc	hl
+			adc	a,d
+			ld	a,d
+			ld	b,l
+			ret	pe
+			ld	a,c
+			ld	b,h
+			dec	(hl)
+			add	a,l
+			jr	Lb4cf
+			db	40h,ebh,85h
+			dec	(hl)
+			add	a,ixh *
+			djnz	Lb573
+			ld	d,e
+			ld	b,d
+			ld	hl,aaa7h
+			in	a,(95h)
+			ld	c,a
+			cp	c
+			ld	l,e
+			ld	d,c
+			inc	c
+			ld	h,e
+			adc	a,a
+			ld	c,c6h
+			ld	h,(hl)
+			xor	b5h
+			jr	z,Lb569
+			sbc	a,(hl)
+			dec	hl
+			sub	c
+			ld	a,c
+			sub	(hl)
+			ld	d,l
+			ld	a,(de)
+			ld	d,e
+			inc	hl
+			ld	c,c
+			sub	c
+			ld	a,l
+			cp	c
+			sub	12h
+			call	nc,Lfbf6
+			ld	c,(hl)
+			exx
+			ld	d,d
+			push	hl
+			ld	b,a
+			ld	l,l
+			ld	e,l
+			ei
+			ret	z
+			ret	m
+			ld	a,c
+			rst	20h
+			inc	l
+			inc	de
+			ld	l,c
+			sbc	a,e
+			and	a
+			ld	d,l
+			sub	b
+			ld	l,e
+			sub	(hl)
+			sla	b
+			ld	e,0fh
+			ld	h,a
+			ld	h,b
+			and	d
+			ld	d,l
+			xor	e
+			cp	e
+			dec	h
+			ld	h,h
+			ld	(hl),l
+			rst	10h
+			ld	d,c
+			ld	a,h
+			ld	a,b
+			ld	l,e
+			jp	po,Lf84c
+			jp	nz,L8950
+			rst	00h
+			ld	h,(hl)
+			xor	h
+			in	a,(69h)
+			nop (2x) *
+			xor	h
+			ld	h,d
+			call	z,L66fb
+			add	hl,bc
+			xor	h
+			ld	(hl),6ch
+			nop (2x) *
+			and	afh
+			add	a,(hl)
+			jp	Ldd36
+			db	08h,40h,62h,13h,aah,a7h,b8h,fch
+			db	95h,61h
+			rst	38h
+			jr	c,Lb578
+			call	c,L7947
+			ld	l,e
+			pop	af
+			sbc	a,b
+			rst	20h
+			inc	sp
+			ld	l,d
+			jr	z,Lb529
+			dec	(hl)
+			and	c
+			ret
+			db	75h,a5h,14h,38h,eeh,93h,84h,5dh
+			db	1ch,16h,0bh,90h,eah,d1h,93h,e1h
+			db	e6h,75h,e1h,3ah,55h,2bh,f2h,2fh
+			db	2dh,9ch,56h,eah,57h,5fh,32h,0ch
+			db	74h,c8h,02h,6ah,85h,c1h,e0h,88h
+			db	a0h,06h,6ah,32h,7eh,3eh,b1h,90h
+			db	81h,0bh,2dh,7fh,27h,abh,0bh,64h
+			db	87h,31h,8bh,1ah,a6h,c3h,26h,a4h
+			db	47h,48h,d0h,61h,edh,10h,1fh,ech
+			db	beh,a8h,aeh,cbh,5ch,0dh,33h,11h
+			db	ech,c4h,8eh,b8h,9eh,bdh,b9h,a0h
+			db	99h,85h,54h,dfh,42h,4bh,55h,1bh
+			db	d5h,56h,4eh,89h,efh,11h,d4h,89h
+			db	a9h,a1h,39h,f7h,58h,09h,d0h,46h
+			db	deh,cdh,0fh,66h,80h,12h,48h,08h
+			db	b0h,86h,eah,d5h,beh,d6h,cdh,57h
+			db	02h,8ah,55h,fch,b5h,2ch,17h,1ch
+			db	6eh,2eh,c3h,c0h,bch,41h,09h,72h
+			db	8bh
+			rrca
+			ld	(hl),b
+			rst	18h
+			nop (2x) *
+			rla
+			ld	d,d
+			ld	d,5bh
+			ld	(hl),b
+			ld	b,f1h
+			and	l
+			cp	(hl)
+			dec	l
+			ld	de,385eh
+			ld	e,l
+			cp	h
+			xor	l
+			ld	e,a
+			and	(hl)
+			ld	a,l
+			cp	98h
+			ld	h,a
+			ld	d,b
+			rlca
+			ld	a,d
+			ld	h,a
+			adc	a,l
+			ld	a,b
+			ld	(bc),a
+			ld	b,(hl)
+			ld	l,b
+			rst	10h
+			dec	de
+			ld	a,e
+			ld	b,e
+			cp	e
+			exx
+			ld	l,41h
+			or	(hl)
+			ld	e,d
+			or	e
+			cp	(hl)
+			ld	d,b
+			pop	hl
+			ld	l,c
+			ld	c,e
+			inc	sp
+			ret	nc
+			ld	e,c
+			ld	a,a
+			ld	(hl),e
+			ld	l,h
+			ld	(hl),a
+			adc	a,a2h
+			rlca
+			ld	(hl),e
+			sub	31h
+			rst	00h
+			dec	(hl)
+			ld	(hl),93h
+			ld	e,d
+			ld	c,h
+			inc	e
+			jp	L061d
+			db	23h,8ah,f2h,a7h,8bh,d2h,41h,c2h
+			db	fbh,c2h,e0h,0fh,c8h,eeh,bdh,0fh
+			db	0ch,1eh,1bh
+			dec	sp
+			call	nz,L1698
+			ret	po
+			and	a
+			rrca
+			sub	c
+			ld	h,69h
+			ld	(hl),a
+			call	m,L2ccc
+			ld	a,l
+			ld	(bc),a
+			rst	30h
+			xor	a
+			adc	a,e
+			inc	b
+			ld	(hl),e
+			ld	b,l
+			cp	(hl)
+			ld	(hl),e
+			dec	b
+			call	z,L6b55
+			and	a
+			or	l
+			xor	h
+			dec	b
+			add	hl,sp
+			add	a,c
+			inc	l
+			jr	nc,Lb61e
+			add	a,b
+			ld	d,h
+			dec	hl
+			ld	c,a
+			ld	b,98h
+			rla
+			jp	po,Lf3d6
+			and	a6h
+			inc	hl
+			or	b
+			ld	a,a
+			adc	a,c
+			cp	1fh
+			nop
+			jr	Lb680
+			db	8fh,dah,57h,85h,94h,59h,f8h,49h
+			db	a5h,e4h
+			or	h
+			ret	po
+			ld	d,a
+			inc	d
+			inc	d
+			ld	b,iyh *
+			cpl
+			ld	h,36h
+			pop	bc
+			sbc	a,d
+			or	a
+			ld	(hl),c
+			sub	d
+			ld	l,d
+			ld	(bc),a
+			or	h
+			add	a,b
+			ld	(hl),h
+			ld	d,e
+			ld	d,(hl)
+			call	z,Led9a
+			ld	(hl),e
+			ld	(hl),b
+			call	p,L66ce
+			ld	e,e
+			jr	Lb728
+			db	81h,f8h,2ch,8bh,fch,68h,65h,0eh
+			db	84h,5ch,d1h,42h,19h,f7h,67h,f5h
+			db	75h,23h,25h,65h,1eh,16h,2fh,0bh
+			db	b6h,d1h,adh
+			inc	bc
+			sbc	a,d4h
+			ld	(hl),a
+			sbc	a,c
+			ld	(881eh),hl
+			ld	e,h
+			ld	(hl),bfh
+			and	l
+			add	hl,bc
+			sub	h
+			ld	(de),a
+			ld	b,h
+			ld	b,h
+			add	hl,bc
+			ld	(8657h),a
+			adc	a,c
+			jr	Lb6b7
+			db	aeh
+			ld	c,b
+			jp	(hl)
+			db	51h,f3h,beh,42h,2bh,9ah,84h,39h
+			db	33h,b3h,55h,e4h,e5h,06h,b0h,bch
+			db	c3h,a4h,2dh,5fh,d7h,e6h,1ch,7ah
+			db	06h,9fh,70h,c0h,c4h,4ch,b1h,0bh
+			db	01h,e3h,f3h,0bh
+			or	d
+			pop	bc
+			ld	c,(hl)
+			ld	b,h
+			inc	h
+			rrca
+			ld	a,(2ffbh)
+			call	z,L4d81
+			ld	(hl),b
+			ld	hl,5b0fh
+			ld	c,l
+			push	hl
+			ld	sp,hl
+			ld	(hl),d
+			jp	nz,L0f50
+			daa
+			dec	l
+			add	a,c
+			ld	sp,hl
+			add	hl,de
+			jp	c,L48b9
+			and	c
+			and	6bh
+			add	a,e
+			ret
+			db	37h,33h,0fh,73h,4fh,a0h,5eh,efh
+			db	19h,25h,f7h,0bh,35h,7fh,dch,65h
+			db	ebh,9eh
+			sbc	a,(hl)
+			ld	c,(hl)
+			xor	39h
+			ret
+			db	cfh,2ah,4eh,dfh,0ch,a9h,32h,2ah
+			db	0ah,d0h,bfh,2eh,48h,d7h,f3h,22h
+			db	34h,92h,23h,6ah,04h,72h,35h,4fh
+			db	cdh,b1h,c9h,b3h,54h,47h,e1h,afh
+			db	18h,63h,ffh,7fh,51h,12h,9dh,01h
+			db	73h,60h,9ah,e4h,edh,08h,17h,c4h
+			db	0ah,d8h,91h,aah,58h,83h,fbh,7ch
+			db	0fh,ach,10h,99h,c4h,3bh,1ah,b0h
+			db	f1h,48h,10h,b7h,92h,97h,a4h,fah
+			db	dfh,b0h,afh,e0h,e2h,04h,fah,c8h
+			db	11h,6ch,d3h,4ah,feh,17h,5eh,38h
+			db	1ch,28h,22h,4ah,e1h,f8h,9fh,69h
+			db	7fh,aeh,82h
+			rst	18h
+			and	l
+			add	a,c
+			ld	b,c
+			adc	a,a
+			or	d
+			jr	nz,Lb831
+			ld	d,0ah
+			sbc	a,l
+			sbc	a,e5h
+			and	b
+			rst	10h
+			call	m,Lfbe4
+			dec	l
+			ld	b,d
+			sbc	a,iyh *
+			halt
+			ld	a,e
+			cp	l
+			or	a
+			sbc	a,h
+			cpl
+			ld	a,b
+			sub	a
+			ld	hl,55c7h
+			cp	b
+			add	hl,hl
+			and	c
+			ld	c,b
+			ld	l,e
+			inc	a
+			and	a
+			jp	p,L85f4
+			ld	h,(hl)
+			adc	a,c
+			ld	(hl),14h
+			ld	a,(hl)
+			ld	a,(df58h)
+			or	a
+			ex	de,hl
+			daa
+			call	nc,La444
+			rst	28h
+			adc	a,h
+			ret	c
+			inc	b
+			in	a,(0dh)
+			ret	c
+			and	d
+			ld	(hl),l
+			ld	(hl),l
+			sbc	a,e
+			or	b
+			ret	z
+			adc	a,(hl)
+			ld	d,c
+			dec	a
+			sub	h
+			or	h
+			ld	a,l
+			sbc	a,d
+			call	Lad65
+			ld	(7805h),a
+			in	a,(86h)
+			sbc	a,a
+			ld	(hl),e
+			ret	pe
+			ld	d,d
+			ld	b,c
+			halt
+			ld	b,l
+			sbc	a,c
+			ld	d,b
+			ccf
+			jp	pe,L5731
+			ld	d,d
+			xor	e
+			ld	iyl,c *
+			sbc	a,e
+			ld	e,98h
+			ld	a,(bc)
+			ld	b,(hl)
+			ld	(hl),l
+			ld	e,b
+			or	d
+			ld	c,d
+			ld	d,a
+			ld	(hl),b
+			cp	72h
+			ld	l,e
+			sub	l
+			inc	c
+			ld	l,c
+			sub	a
+			jp	nc,L9deb
+			adc	a,(hl)
+			xor	l
+			or	h
+			ld	d,abh
+			ret	z
+			xor	(hl)
+			or	l
+			xor	c
+			xor	d
+			rlca
+			ld	c,l
+			add	a,b
+			daa
+			and	2ah
+			rla
+			pop	de
+			ex	(sp),hl
+			sbc	a,h
+			dec	e
+			jp	p,Lcf96
+			xor	7bh
+			xor	h
+			call	pe,L17b8
+			jp	m,Lc251
+			ld	(hl),dch
+			add	hl,hl
+			add	a,5bh
+			inc	c
+			pop	hl
+			add	hl,sp
+			sbc	a,(hl)
+			ld	c,h
+			ld	l,e
+			ld	h,b
+			ld	(da48h),hl
+			sub	l
+			dec	hl
+			and	(hl)
+			and	c
+			xor	c
+			cp	l
+			ld	b,d
+			ld	b,c
+			or	(hl)
+			ret	m
+			rlca
+			add	a,(hl)
+			inc	e
+			ld	(hl),c
+			dec	de
+			ld	l,b
+			inc	h
+			rlca
+			ret	nz
+			ld	b,(hl)
+			ld	b,e
+			sub	(hl)
+			call	L5ca7
+			ld	c,4eh
+			cp	c
+			jp	L93fd
+			db	42h,01h,1eh,f7h,34h,c9h,abh,c5h
+			db	f5h,bfh,71h,08h,cah,45h,1bh,05h
+			db	8ch,ach,80h,6bh,b4h,9bh,cch,2bh
+			db	09h,04h,10h
+			cpl
+			ei
+			jp	m,L043e
+			ld	a,(de)
+			ld	c,deh
+			or	l
+			inc	h
+			ld	b,l
+			ld	(hl),h
+			call	nc,L4768
+			jr	z,Lb86c
+			ld	h,(hl)
+			sbc	a,6bh
+			cp	a
+			ret	nz
+			ld	(hl),e
+			dec	(hl)
+			ld	e,l
+			jr	Lb933
+			db	f3h,9ah,30h,9eh,c3h,d0h,f6h,25h
+			db	2fh,eeh,efh,1ah,bah,a2h,56h,ebh
+			db	99h,e4h,abh,32h,aah,b9h,4fh,00h
+			db	9bh,73h,deh,70h,7bh,ach,50h,e6h
+			db	07h,0ch,3dh,9ch,f9h,47h,f1h,79h
+			db	e7h,19h,bbh,05h,1ch,4ch,d7h,c2h
+			db	93h,b6h,ech,88h,79h,8eh,39h,3dh
+			db	8eh,e2h,90h,8bh,0ah,ebh,32h,2eh
+			db	e6h,dch,dch,4fh,fch,00h,31h,97h
+			db	78h,c1h,5eh,85h,cfh,c0h,a8h,ffh
+			db	69h,bfh,7ch,31h,8bh,90h
+			ret	po
+			rra
+			xor	a
+			ld	d,d
+			ld	h,(hl)
+			ld	l,l
+			inc	bc
+			rst	28h
+			ld	(hl),a
+			cp	e
+			dec	l
+			ld	h,l
+			call	c,La97a
+			sbc	a,(hl)
+			in	a,(0ch)
+			inc	d
+			dec	a
+			ld	e,c
+			jr	Lb996
+			dec	l
+			rst	08h
+			ld	h,l
+			dec	sp
+			ld	a,(hl)
+			inc	b
+			ld	h,1ah
+			halt
+			sub	l
+			xor	b
+			rst	10h
+			ret	nc
+			ld	l,e
+			push	hl
+			xor	(hl)
+			ccf
+			rst	30h
+			adc	a,l
+			ld	a,(4ec3h)
+			cp	h
+			xor	e
+			rst	28h
+			adc	a,(hl)
+			ex	af,af'
+			ld	b,c
+			add	hl,sp
+			push	bc
+			ld	a,a
+			ld	e,e
+			ld	h,e
+			ld	c,b
+			xor	(hl)
+			inc	bc
+			and	a
+			jp	(hl)
+			db	13h,8dh,78h,94h,6bh,1eh,aah,16h
+			db	41h,78h,c1h,2bh,8ch,25h,deh,cdh
+			db	3ch,18h,02h,9fh,3dh,2ch,aeh,6ch
+			db	afh,e8h,1dh,1dh,d2h,01h,31h,4bh
+			db	b8h,e5h,f9h,3dh,38h,46h,65h,72h
+			db	a0h,0fh,3eh,3dh,cbh,62h,63h,87h
+			db	40h,f3h,1dh,97h,16h,eeh,d6h,b6h
+			dec	a
+			call	m,Ldd95
+			adc	a,a
+			adc	a,h
+			ld	l,l
+			ld	d,e
+			xor	h
+			ret	p
+			ld	c,a
+			rst	20h
+			add	hl,sp
+			adc	a,a
+			sub	a
+			halt
+			ld	l,l
+			ld	(hl),a1h
+			push	bc
+			inc	l
+			ld	b,b
+			ld	a,(de)
+			ld	d,(hl)
+			ld	a,a
+			xor	a
+			ld	c,b
+			jp	L16c5
+			db	edh,3dh,77h,43h,26h,fah,ech,ebh
+			db	44h,5dh
+			rlca
+			ld	h,e
+			ld	e,l
+			ld	a,(hl)
+			call	m,Lc349
+			sub	b
+			jr	nc,Lb9eb
+			ret	nz
+			jp	nc,L6f2e
+			jp	m,L4fab
+			sbc	a,(hl)
+			ld	a,(bc)
+			ret
+			db	fah,50h,29h,93h,92h,6ah,07h,74h
+			db	49h,32h,cbh,3ch,a6h,33h,9dh,8fh
+			db	a8h,eeh,27h,37h,57h,3ah,42h,4ch
+			db	63h,b8h,64h,50h,fch,a8h
+			or	(hl)
+			inc	c
+			cp	h
+			push	de
+			cp	a
+			push	af
+			nop (2x) *
+			and	d
+			sub	b
+			ld	l,b
+			ret	nc
+			ld	b,c
+			push	de
+			xor	h
+			dec	(hl)
+			xor	(hl)
+			adc	a,a
+			ld	d,b
+			add	a,(hl)
+			ld	a,a
+			nop
+			ld	a,h
+			ld	h,e
+			sub	c
+			sub	7ah
+			add	a,e
+			rst	20h
+			or	c
+			or	c
+			ei
+			and	e
+			add	a,d
+			ld	d,(hl)
+			ld	l,b
+			ld	b,l
+			inc	h
+			or	b
+			push	bc
+			adc	a,l
+			ld	h,a
+			inc	sp
+			ld	de,530fh
+			ld	d,e
+			rra
+			add	a,d
+			ld	d,h
+			ret	nz
+			ex	(sp),hl
+			sub	(hl)
+			call	po,L02b5
+			ld	h,(hl)
+			inc	sp
+			call	nz,L9815
+			call	nz,L0ddc
+			sub	h
+			sub	(hl)
+			ld	d,e
+			inc	l
+			ld	h,b
+			dec	a
+			ld	c,e
+			ld	a,(hl)
+			ld	l,e
+			adc	a,d
+			ld	d,b
+			add	a,h
+			adc	a,e
+			sbc	a,h
+			add	a,h
+			xor	a
+			rst	10h
+			xor	h
+			cp	e
+			ld	l,l
+			cp	6eh
+			ld	e,b
+			ld	l,07h
+			ld	h,d
+			ex	af,af'
+			daa
+			ld	b,e
+			inc	sp
+			inc	b
+			or	h
+			ld	c,d2h
+			dec	sp
+			ret	pe
+			ld	e,e
+			ld	(bc),a
+			ld	a,(166bh)
+			ld	d,e
+			rla
+			nop
+			ld	b,c
+			sub	h
+			ret	pe
+			jr	Lbaba
+			db	e8h,fbh,80h,7fh,8bh,7fh,6eh,dbh
+			db	39h,b2h,0ch,e9h
+			adc	a,l
+			ld	d,(hl)
+			ld	e,c
+			sub	d
+			sub	(hl)
+			ld	h,b
+			dec	(hl)
+			rst	00h
+			jr	c,Lbaa2
+			inc	e
+			out	(86h),a
+			ld	l,c
+			sbc	a,h
+			pop	de
+			inc	d
+			add	hl,sp
+			dec	b
+			jr	nz,Lba36
+			and	a
+			ld	bc,e4efh
+			pop	af
+			pop	af
+			pop	bc
+			ld	h,l
+			call	z,L1871
+			jr	c,Lbaf2
+			pop	af
+			inc	h
+			rrc	d
+			jr	z,Lbace
+			ld	(hl),d
+			ld	c,d
+			ld	(hl),e
+			inc	sp
+			jp	nz,L684e
+			pop	de
+			ld	l,b
+			ld	b,e
+			bit	6,d
+			ld	(hl),47h
+			or	c
+			rlca
+			ld	bc,5685h
+			or	d
+			or	d
+			pop	hl
+			ld	a,36h
+			inc	c
+			rst	10h
+			and	a
+			pop	af
+			djnz	Lbab6
+			inc	l
+			ld	sp,aff0h
+			xor	c
+			ret	pe
+			sub	e
+			pop	hl
+			cp	l
+			ld	h,(hl)
+			dec	b
+			or	(hl)
+			rst	00h
+			pop	af
+			or	98h
+			ld	d,a
+			sbc	a,e
+			cp	d
+			ld	h,a
+			dec	b
+			cp	e
+			add	hl,bc
+			or	0bh
+			ld	d,d
+			ld	e,b
+			call	nc,La26d
+			cp	h
+			inc	de
+			ld	a,e
+			cp	e
+			xor	b
+			and	l
+			ld	l,a
+			ld	e,a
+			ld	e,e
+			dec	sp
+			add	hl,bc
+			add	a,b
+			add	a,c
+			adc	a,a
+			and	e
+			and	d
+			ld	a,(95f8h)
+			djnz	Lbb20
+			rra
+			ld	b,l
+			ld	e,l
+			and	(hl)
+			ld	d,a
+			dec	bc
+			ei
+			daa
+			ld	(b7d2h),hl
+			adc	a,e
+			and	h
+			cp	a
+			cp	c
+			ret	m
+			jp	c,Lf0c0
+			ld	l,d
+			sub	58h
+			adc	a,c
+			sbc	a,a
+			ld	l,c
+			ld	b,h
+			cp	e8h
+			ret	c
+			ld	b,(hl)
+			sub	d
+			dec	c
+			add	a,(hl)
+			call	m,L7c10
+			adc	a,l
+			cp	c
+			cp	h
+			or	l
+			ld	d,c
+			ld	(hl),a
+			rst	30h
+			ld	l,(hl)
+			nop (2x) *
+			rst	20h
+			ld	a,(bc)
+			sbc	a,d
+			rst	30h
+			jr	z,Lbaad
+			ld	b,e
+			ld	b,a
+			and	(hl)
+			ld	(de),a
+			ld	(hl),a
+			ld	a,(hl)
+			dec	sp
+			inc	a
+			call	c,L7d26
+			dec	sp
+			ld	(de),a
+			ret	nc
+			inc	a
+			call	nc,L3059
+			rst	08h
+			jr	Lbb32
+			db	a2h,c3h,44h,2bh,d9h,e9h,ffh,28h
+			db	8bh,70h
+			adc	a,d
+			ld	(hl),e
+			ld	(de),a
+			ld	(hl),d
+			dec	bc
+			add	hl,de
+			ld	(bc),a
+			ret	p
+			pop	hl
+			and	(hl)
+			sub	e
+			add	a,b
+			ld	(de),a
+			sub	b
+			rst	30h
+			or	44h
+			ld	h,l
+			dec	c
+			inc	a
+			ld	a,43h
+			adc	a,e
+			cp	e
+			jp	(hl)
+			db	deh,72h,bah,08h,52h,0eh,b0h,dfh
+			db	82h,62h,cch,92h,29h,0dh,d0h,39h
+			db	3bh,88h,b3h,3ch,40h,9ah,79h,09h
+			db	feh,b1h,8ah,bfh,0fh,feh,7fh,40h
+			db	14h,cfh,feh,f4h,dbh,5dh,32h,cfh
+			db	61h,6ah,81h,a4h,56h,85h,5eh,3fh
+			db	71h,c8h,46h,cbh,11h,67h,24h,71h
+			db	77h,5eh,c0h,32h,66h,24h,feh,f2h
+			db	bfh,9bh,5dh,7fh,c4h,e3h,43h,e7h
+			db	fdh,64h,9bh,95h,b3h,bch,d5h,94h
+			ld	b,d
+			xor	h
+			ld	h,b
+			adc	a,h
+			ex	de,hl
+			ld	l,a
+			ex	af,af'
+			jr	nc,Lbb34
+			sbc	a,l
+			ld	(hl),l
+			jp	pe,L62f1
+			halt
+			sub	d
+			ld	e,feh
+			ld	(hl),h
+			sbc	a,(hl)
+			ret	pe
+			rla
+			sbc	a,c
+			ld	l,h
+			call	z,Lb9b9
+			inc	d
+			inc	(hl)
+			ld	a,(hl)
+			dec	c
+			ld	b,c
+			ret	pe
+			jp	(hl)
+			db	ech,61h,5dh,ech,46h,7ch,79h,04h
+			db	0bh,4fh,c5h,d4h,c0h,c0h,85h,3ch
+			db	1dh,33h,6dh
+			ld	hl,(7bech)
+			sub	(hl)
+			adc	a,h
+			add	a,(hl)
+			inc	de
+			dec	e
+			xor	l
+			rrca
+			exx
+			daa
+			ld	b,e
+			jp	nz,L7b64
+			jp	nc,Lcb2c
+			ld	a,c
+			dec	d
+			inc	d
+			xor	h
+			dec	de
+			ld	a,h
+			in	a,(4fh)
+			jp	pe,L2089
+			ld	d,e
+			ld	a,b
+			ld	sp,hl
+			and	e
+			cp	5eh
+			inc	e
+			call	z,L1da0
+			ld	l,(hl)
+			ld	hl,(44d6h)
+			jp	nc,L9388
+			call	z,L6bef
+			or	h
+			ld	hl,(5918h)
+			ld	(de),a
+			add	a,d
+			dec	c
+			add	hl,bc
+			djnz	Lbc36
+			sbc	a,(hl)
+			inc	h
+			ld	a,a
+			and	2eh
+			call	m,L2f07
+			jp	po,L617a
+			nop (2x) *
+			ld	c,a
+			sbc	a,l
+			call	nc,Lb4e3
+			ld	(bc),a
+			ld	h,bch
+			sbc	a,(hl)
+			ret	p
+			ld	c,c
+			ld	de,fb72h
+			sub	d
+			ld	d,(hl)
+			rra
+			ret	c
+			or	d
+			and	c
+			out	(69h),a
+			cp	c
+			add	hl,de
+			ld	(hl),e
+			or	(hl)
+			call	L984a
+			cp	b
+			sbc	a,e
+			and	d
+			dec	bc
+			ld	l,c
+			call	po,La9c0
+			and	2eh
+			jp	nz,Lf3f9
+			or	a
+			dec	h
+			call	pe,L1174
+			add	a,16h
+			sbc	a,(hl)
+			or	h
+			ld	e,e
+			adc	a,(hl)
+			jr	c,Lbc2a
+			or	(hl)
+			call	po,Le9b1
+			and	b
+			inc	hl
+			and	c
+			cp	b
+			cpl
+			ld	c,79h
+			ld	(hl),h
+			rst	30h
+			and	d
+			ld	sp,hl
+			ld	c,b
+			ld	h,c
+			call	L1769
+			cpl
+			and	a
+			ld	c,(hl)
+			ccf
+			dec	de
+			ld	(bc),a
+			and	(hl)
+			ld	l,(hl)
+			xor	a
+			sub	d
+			and	a
+			sbc	a,(hl)
+			add	a,d
+			ret	m
+			ld	hl,(9196h)
+			ld	l,d
+			ld	a,b
+			ld	hl,4e10h
+			ld	(hl),d9h
+			dec	bc
+			ld	e,f8h
+			inc	e
+			ld	e,47h
+			halt
+			xor	e
+			sub	b
+			ld	c,a
+			out	(75h),a
+			ld	sp,hl
+			call	z,Lf015
+			or	d
+			djnz	Lbca9
+			ld	de,3685h
+			cp	(hl)
+			exx
+			dec	h
+			jr	nc,Lbc2b
+			ld	l,(hl)
+			adc	a,a
+			djnz	Lbca2
+			ld	h,h
+			dec	sp
+			ld	l,b
+			adc	a,a
+			ld	h,fbh
+			ld	b,e
+			add	a,(hl)
+			ld	b,e
+			sbc	a,a
+			dec	l
+			rst	18h
+			halt
+			ld	l,d
+			sbc	a,e
+			and	d
+			ld	h,l
+			ret	m
+			and	l
+			ld	(hl),a
+			call	c,L27e2
+			dec	de
+			or	c
+			rst	30h
+			xor	ixh *
+			xor	l
+			out	(46h),a
+			ld	a,c
+			sbc	a,(hl)
+			ld	e,c
+			or	a
+			inc	(hl)
+			ccf
+			ld	e,(hl)
+			inc	c
+			ld	sp,hl
+			and	b
+			sub	ceh
+			ld	a,(de)
+			ret	po
+			xor	(hl)
+			add	hl,de
+			ld	b,c
+			ld	d,b
+			jp	c,L7edc
+			rst	38h
+			sub	e
+			jp	c,L6f1b
+			adc	a,11h
+			add	hl,sp
+			dec	b
+			ret
+			db	8fh,a2h,6dh,4bh,62h,6eh,11h,f1h
+			db	b8h,43h,8fh,5eh,fbh,c1h,93h,fah
+			db	32h,8ch,eeh,46h,b0h,6eh,cdh,b2h
+			db	b7h,88h,6ah,8ch,83h,5ch,e2h,81h
+			db	c7h,08h,44h,4bh,c5h,82h,6bh,7fh
+			db	abh,80h,30h,6ch,4eh,6ch,b8h,29h
+			db	c9h,15h,c4h,5dh,ach,80h,a0h,5bh
+			db	d1h,80h,f4h,73h,17h,bfh,6bh,a3h
+			db	4bh,b9h,d4h,92h,1dh,77h
+			cp	e5h
+			ld	d,h
+			jp	L630f
+			db	c3h,0ah,f4h,b0h,83h,2bh,0eh,27h
+			db	f1h,93h,e9h,44h,36h,d9h,32h,0dh
+			db	66h,b4h,5dh,dch,94h,d7h,3bh,59h
+			db	48h,c0h,6ah,35h,92h,64h,bah,3ah
+			db	2eh,7ch,b0h,f8h,92h,ebh,7eh,22h
+			db	0dh,6bh,14h,f3h,2fh,56h,dah,8bh
+			db	0fh,c6h,89h,41h,32h,a4h,0bh,5bh
+			db	aah,75h,30h,31h,7ch,a4h,31h,f8h
+			db	d9h,ffh,a5h,29h,8dh,61h,c6h,02h
+			db	2ah,70h,4dh,4eh,78h,3eh,84h,39h
+			db	3dh,8ch,58h,62h,3dh,74h,92h,81h
+			db	30h,7dh,8ah,56h,16h,b0h,03h,63h
+			db	63h,ebh,91h,54h,8ch,4fh,1bh,93h
+			db	30h,f5h,54h,2dh,43h,b3h,6ah,56h
+			db	98h,8ch,29h,c0h,c0h,3ch,a1h,fbh
+			db	8fh,5ch,83h,75h,4ch,50h,7fh,0dh
+			db	95h,64h,38h,38h,73h,19h,58h,31h
+			db	73h,b4h,deh,77h,c7h,1bh,e5h,06h
+			db	7ah,8ah,f3h,cah,bah,35h,40h,64h
+			db	aeh,e3h,cfh,6ah,25h,91h,a3h,a0h
+			db	60h,6ah,7ch,8dh,37h,b7h,5eh,c0h
+			db	0ah,8bh,c0h
+			ld	h,c
+			ld	c,d
+			ld	b,(hl)
+			ld	l,d
+			call	po,L4c4c
+			inc	h
+			pop	hl
+			sbc	a,l
+			inc	bc
+			ex	de,hl
+			push	bc
+			nop (2x) *
+			ex	de,hl
+			ld	b,b
+			ld	hl,9106h
+			jp	nc,L48bb
+			sub	d
+			dec	de
+			add	a,a
+			or	(hl)
+			ld	c,(hl)
+			xor	h
+			call	po,L062e
+			ld	c,d
+			rla
+			jp	(hl)
+			db	7ah,27h,30h,6ah,83h,74h,9ch,56h
+			db	a4h,aah,03h,8ah,89h,66h,a3h,63h
+			db	16h,82h,0ch,3eh,77h,ddh,5bh,e1h
+			db	b9h,63h,4fh,2ah,22h,50h,bah,7eh
+			db	20h,84h,5eh,50h,f0h,0eh,aah,a6h
+			db	25h,4dh,f7h,40h,b8h,45h,dbh,6dh
+			db	fah,adh,26h,fah,b8h,a1h,4ch,d8h
+			db	fah,73h,3eh,6fh,60h,d0h,3ah,4ch
+			sbc	a,a
+			ld	d,c
+			push	de
+			sbc	a,a
+			xor	e
+			dec	(hl)
+			jp	(hl)
+			db	cah,1ch,a5h,f7h,06h,1bh,2ah,e3h
+			db	9ch,1ah,1ch,f8h,9bh,26h,85h,f2h
+			db	96h,f9h,1ch,10h,30h,18h,41h,3dh
+			db	47h,4eh,96h,8bh,adh,2ah,ddh,39h
+			db	36h,54h,64h,a9h,ech,25h,07h,93h
+			db	45h,96h
+			or	e
+			ld	d,h
+			sbc	a,c
+			nop
+			ld	d,d
+			jp	po,L1bf2
+			dec	bc
+			ld	c,(hl)
+			ld	(hl),c0h
+			ld	l,l
+			ld	l,a
+			sbc	a,(hl)
+			adc	a,c
+			rst	20h
+			jp	Ld542
+			db	e6h
+			ld	(hl),a
+			add	a,37h
+			add	a,l
+			ld	a,c
+			dec	l
+			cp	c
+			dec	(hl)
+			ex	(sp),hl
+			cp	c
+			add	hl,de
+			sub	e
+			and	b
+			ret	p
+			add	a,a
+			adc	a,b
+			jp	p,Lbef3
+			xor	d
+			sbc	a,(hl)
+			in	a,(5ch)
+			call	m,L2391
+			ld	(hl),a1h
+			jp	po,Ld08e
+			djnz	Lbe31
+			ld	b,c
+			adc	a,b
+			cp	h
+			ld	l,c
+			jp	p,L99f0
+			ld	(de),a
+			sbc	a,3ch
+			and	(hl)
+			add	hl,sp
+			rst	08h
+			ld	de,801fh
+			rst	20h
+			ld	(hl),l
+			ld	e,7eh
+			cp	cbh
+			add	hl,hl
+			ld	d,(hl)
+			sbc	a,c
+			rst	30h
+			ld	d,c
+			rst	30h
+			rla
+			ld	h,e5h
+			ld	a,(28a2h)
+			ld	c,a
+			and	(hl)
+			ld	a,h
+			scf
+			add	hl,bc
+			push	hl
+			inc	sp
+			ld	c,h
+			cp	c
+			ld	d,a
+			ld	c,b
+			inc	de
+			rst	18h
+			dec	hl
+			cp	b
+			ex	af,af'
+			out	(8dh),a
+			ld	iyh,e *
+			ld	h,c
+			add	hl,bc
+			djnz	Lbe77
+			scf
+			ld	l,b
+			scf
+			rla
+			ret	z
+			halt
+			ld	(hl),h
+			inc	iyh *
+			and	(hl)
+			call	nz,Le4ee
+			ld	h,h
+			ld	d,a
+			cp	44h
+			nop (2x) *
+			jp	nc,L456b
+			ld	(hl),h
+			rla
+			inc	(hl)
+			ld	(hl),b
+			jr	Lbf38
+			db	fdh,a3h,dbh,45h,27h
+			ret	nc
+			and	h
+			ld	l,d
+			jp	pe,L63bc
+			ld	bc,2c52h
+			in	a,(70h)
+			nop
+			ld	(hl),d
+			cp	c
+			rla
+			nop (2x) *
+			ld	b,b
+			ret	z
+			rst	38h
+			dec	d
+			and	a
+			ex	(sp),hl
+			cp	(hl)
+			ld	b,c
+			ret	m
+			jp	pe,L8574
+			adc	a,(hl)
+			ld	a,75h
+			pop	bc
+			ld	l,d
+			cp	d
+			ld	c,d
+			sub	18h
+			add	hl,de
+			xor	a
+			ld	a,(de)
+			jp	po,Lebd0
+			ld	h,h
+			ld	a,(cb0bh)
+			dec	bc
+			ld	hl,(0bd9h)
+			and	b
+			dec	b
+			call	c,Lca48
+			rlca
+			cp	7ah
+			sub	a
+			call	L8aa3
+			add	a,f9h
+			or	d
+			ld	e,l
+			push	de
+			nop (2x) *
+			out	(c2h),a
+			ld	d,c
+			ld	e,(hl)
+			sbc	a,e
+			ld	h,d
+			call	nz,L58dc
+			dec	c
+			ld	sp,caeah
+			sub	(hl)
+			xor	d
+			ld	d,c
+			adc	a,39h
+			ld	c,c
+			ld	c,d
+			xor	l
+			rst	38h
+			ld	(hl),l
+			add	hl,bc
+			add	hl,bc
+			call	nz,Lc4ff
+			dec	l
+			adc	a,e
+			inc	de
+			adc	a,b
+			cp	c
+			ld	bc,b4fch
+			push	hl
+			sbc	a,l
+			ld	l,h
+			sub	a
+			nop (2x) *
+			exx
+			inc	c
+			sbc	a,h
+			adc	a,l
+			rra
+			inc	de
+			ld	d,e
+			add	hl,de
+			ld	c,d
+			pop	af
+			ld	(hl),a
+			ld	l,d
+			jp	z,Lbf5d
+			ld	(bc),a
+			push	af
+			ld	a,(hl)
+			and	b
+			inc	c
+			rst	20h
+			djnz	Lbfec
+			ld	h,b
+			inc	d
+			push	af
+			call	p,Lbc2a
+			ld	a,(bc)
+			ld	de,fb72h
+			ld	l,l
+			call	nz,L8180
+			ld	b,h
+			cp	a
+			add	a,(hl)
+			add	a,e
+			ld	a,c
+			inc	sp
+			adc	a,51h
+			rst	08h
+			and	(hl)
+			jr	Lbf8f
+			db	02h,4fh,18h,06h,4fh,69h,32h,77h
+			db	e8h,d4h,c0h,4bh,87h,fdh,e1h,53h
+			db	ceh,2eh,77h,f9h,dah,9eh,eeh,98h
+			db	00h,78h,a7h,f4h,44h,b0h,a8h,eah
+			db	abh,3fh,dah,b2h,09h,c1h,c2h,f5h
+			db	6dh,34h,30h,a2h,bdh,2eh,55h,5eh
+			db	02h,a5h,bdh,5eh,d4h,d5h,5ah,33h
+			db	88h,71h,2dh,38h,1bh,95h,0eh,10h
+			db	cfh,41h,c9h
+			sub	h
+			and	h
+			ret	pe
+			sbc	a,c
+			ex	af,af'
+			sbc	a,(hl)
+			dec	de
+			or	l
+			ld	l,a
+			ld	bc,9d40h
+			sub	d
+			add	hl,bc
+			ld	(hl),a
+			inc	(hl)
+			xor	a
+			ld	a,(de)
+			scf
+			ld	sp,hl
+			ld	(hl),l
+			ld	h,a
+			ld	e,e
+			inc	a
+			adc	a,b
+			ld	b,(hl)
+			inc	bc
+			ld	a,c
+			ld	l,42h
+			push	bc
+			jp	c,L51b1
+			ld	(hl),a
+			ld	h,l
+			dec	bc
+			ret	nc
+			jp	po,Lb4eb
+			ld	e,0fh
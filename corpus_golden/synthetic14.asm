@@ -0,0 +1,2081 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	79h,d6h,bdh,a3h,ceh,91h,30h,42h
+			db	98h,b3h,c8h,8dh
+
+start:						; execution starting point
+			ld	(hl),e
+			dec	l
+			ret	nc
+			ld	a,(de)
+			and	b
+			ld	c,a
+			cp	h
+			ld	e,c
+			ld	h,h
+			ld	l,d
+			and	(hl)
+			adc	a,(hl)
+			call	nz,L12c2
+			ld	a,(hl)
+			ld	d,l
+			ld	a,(de)
+			cp	97h
+			ld	h,e
+			ld	l,3ch
+			bit	2,l
+			sbc	a,h
+			ld	b,l
+			ld	e,l
+			ld	(96adh),a
+			dec	bc
+			ld	a,(bc)
+			dec	de
+			jp	L1d4b
+			db	93h,e8h,7dh,08h,70h,9bh,5eh,5dh
+			db	d6h,57h,ceh,efh,3bh,e9h,15h,bfh
+			db	e4h,2dh,e3h,b8h,1ah,b2h,35h,1dh
+			db	7ah,8bh,00h,6ah,88h,20h,96h,71h
+			db	71h,4eh,62h,d9h,6fh,0bh,cah,f0h
+			db	ech,f2h,8bh,05h,dch,08h,2ah,eeh
+			db	e4h,0fh,9ah,34h,ech,c3h,feh,c2h
+			db	f9h,25h,6eh,a5h,67h,c3h,1dh,00h
+			db	3bh,d0h,f5h,51h,e8h,90h,9fh,aah
+			db	84h,86h,f3h,ebh,eah,fdh,dah,48h
+			db	ddh,54h,c5h,f1h,d6h,72h,81h,d2h
+			db	95h,bfh,ebh,04h,78h,e5h,04h,5fh
+			db	e9h,8bh,f4h,a2h,13h,0ah,2eh,9ah
+			db	c6h,29h,01h,57h,1fh,15h,74h,03h
+			db	35h,ech,dah,b6h,58h,0eh,59h,ebh
+			db	2eh,75h,fah,0ah,f3h,3fh,60h,ech
+			db	1fh,2fh,aah,d8h,e2h,7dh,a4h,88h
+			db	10h,72h,66h,2ch,c3h,f5h,b1h,4fh
+			db	45h,c3h,0ch,b9h,93h,deh,1bh,19h
+			db	9bh,b9h,96h,b3h,93h,46h,5ah,0eh
+			db	a2h,fah,87h,cfh,c6h,d5h,33h,44h
+			db	cbh,edh,3dh,3ch,f7h,41h,38h,abh
+			db	efh,7bh,81h,33h,7fh,6fh,3eh,31h
+			db	f6h,adh,7ch,deh,9ch,dch,7dh,1ah
+			db	c1h,9fh,cbh,1ch,8ch,c2h,a0h,73h
+			db	49h,ffh,4ch,71h,a6h,9bh,d9h,36h
+			db	57h,fdh,1ah,24h,8dh,d1h,7bh,beh
+			db	d8h,a7h,7dh,9eh,c6h,08h,f7h,49h
+			db	a8h,a4h,fdh,bch,feh,3ah,52h,51h
+			db	d8h,d6h,ebh,47h,ceh,11h,7eh,2eh
+			db	23h,9bh,8ah,dfh,1dh,21h,a8h,d9h
+			db	2ah,6dh,6ah,88h,d8h,64h,bah,90h
+			db	cah,29h,dah,e2h,42h,75h,f9h,dbh
+			db	e9h,f8h,88h,a2h,0ch,07h,eeh,53h
+			db	e9h,61h,02h,2bh,cfh,53h,43h,38h
+			db	96h,a4h,deh,91h,a7h,03h,4ah,0dh
+			db	f7h,33h,ceh,a8h,3bh,00h,56h,40h
+			db	54h,c3h,d6h,01h,49h,1ah,0ah,69h
+			db	2fh,05h,46h,88h,62h,37h,15h,48h
+			db	e9h,a5h,c4h,aeh,01h,2dh,feh,90h
+			db	65h,e4h,7fh,59h,57h,88h,ceh,3bh
+			db	31h,a7h,87h,b4h,5ch,c3h,76h,8ah
+			db	02h,28h,18h,bdh,8dh,b1h,d3h,94h
+			db	5bh,24h,a6h,29h,96h,9fh,90h,dah
+			db	5ah,cch,d3h,66h,a4h,55h,6bh,64h
+			db	67h,46h,b1h,a4h,9dh,bah,96h,60h
+			db	44h,6ah,afh,4dh,3eh,16h,01h,33h
+			db	a6h,5fh,4dh,42h,44h,67h,66h,6fh
+			db	f4h,83h,b4h,2bh,b5h,54h,77h,90h
+			db	58h,3fh,e1h,26h,46h,05h,eeh,2ch
+			db	60h,fah,77h,54h,77h,7eh,94h,e9h
+			db	27h,bch,33h,62h,47h,47h,b6h,15h
+			db	08h,8bh,02h,cbh,cdh,eah,4dh,68h
+			db	6ch,c9h,3fh,44h,a6h,18h,a3h,f2h
+			db	46h,ddh,0eh,89h,51h,fch,24h,70h
+			db	1eh,30h,f5h,cch,ech,92h,08h,3eh
+			db	2fh,6eh,eeh,5ch,61h,7fh,5fh,4dh
+			db	07h,05h,fbh,01h,cdh,7ah,a3h,58h
+			db	8dh,59h,5bh,67h,c8h,ceh,c1h,bah
+			db	4dh,ach,e8h,73h,99h,6eh,29h,7dh
+			db	95h,e0h,45h,93h,ech,43h,c5h,6ch
+			db	26h,31h,68h,a7h,4ch,d1h,0ah,b2h
+			db	75h,e0h,5fh,7eh,b9h,59h,c4h,28h
+			db	c5h,90h,e0h,1ah,e8h,cbh,b1h,2ch
+			db	8bh,8eh,43h,8eh,bbh,adh,0ch,d9h
+			db	3bh,71h,2fh,6eh,44h,5ah,feh,56h
+			db	f5h,3bh,e4h,81h,bfh,81h,cfh,a3h
+			db	7dh,21h,7bh,f1h,18h,70h,44h,adh
+			db	95h,b9h,64h,ffh,28h,55h,83h,17h
+			db	46h,3ah,7dh,4ah,b2h,08h,d0h,fbh
+			db	d0h,4ch,63h,3ah,cah,deh,ddh,6fh
+			db	e4h,32h,8ch,bbh,3bh,c9h,ceh,04h
+			db	a6h,08h,ddh,02h,aeh,3ah,59h,05h
+			db	05h,41h,8bh,bch,60h,09h,94h,73h
+			db	14h,80h,15h,84h,45h,57h,7ah,70h
+			db	8dh,9ch,3fh,7ch,0bh,bdh,82h,bfh
+			db	dch,8eh,d1h,b1h,0ch,d6h,fch,f9h
+			db	a7h,75h,5ah,c9h,6eh,d8h,2ah,6bh
+			db	c2h,b5h,78h,3dh,cah,d1h,aeh,aeh
+			db	0ch,58h,bah,d6h,23h,31h,68h,c5h
+			db	52h,6fh,0bh,4dh,11h,7eh,b4h,cfh
+			db	92h,05h,d0h,24h,b1h,95h,dfh,dch
+			db	95h,d5h,9fh,87h,64h,d9h,47h,78h
+			db	e7h,8fh,d0h,2dh,9bh,1dh,03h,71h
+			db	d1h,0fh,88h,61h,5ch,f9h,59h,38h
+			db	78h,4ch,a9h,abh,58h,a3h,58h,46h
+			db	b9h,beh,61h,f6h,02h,7ah,98h,f7h
+			db	d0h,eeh,4fh,77h,b6h,f5h,7dh,b0h
+			db	e0h,a2h,78h,73h,2ah,61h,12h,90h
+			db	e3h,01h,c0h,55h,20h,b1h,5bh,96h
+			db	3ah,17h,ebh,adh,f5h,4dh,d7h,04h
+			db	19h,f2h,fbh,c4h,c1h,80h,02h,50h
+			db	b1h,d4h,9dh,06h,efh,7ah,02h,f0h
+			db	e4h,8ah,55h,c2h,00h,e1h,5fh,1dh
+			db	07h,3dh,bah,55h,0eh,dbh,5ah,a5h
+			db	57h,ach,1dh,eah,a1h,9ch,69h,92h
+			db	62h,7eh,d9h,26h,35h,32h,e2h,13h
+			db	19h,19h,e3h,63h,aeh,14h,7fh,f3h
+			db	26h,66h,b3h,5ch,d7h,f5h,bbh,3ch
+			db	9fh,50h,50h,22h,c3h,09h,b7h,f4h
+			db	8fh,bdh,4ch,10h,b0h,37h,89h,b0h
+			db	ddh,49h,72h,60h,80h,2ch,1dh,63h
+			db	d4h,f3h,6ch,65h,1fh,18h,39h,79h
+			db	b4h,77h,c9h,efh,b6h,0ch,84h,4fh
+			db	3ah,5ah,b9h,c7h,1bh,f2h,63h,dah
+			db	f3h,6ch,ech,16h,ech,6ah,2bh,b6h
+			db	bdh,38h,69h,98h,0ah,31h,e4h,4bh
+			db	dah,a1h,9bh,f5h,bch,86h,e0h,c4h
+			db	73h,e4h,6ah,49h,4ah,74h,31h,17h
+			db	d4h,d4h,88h,bbh,abh,f5h,a7h,8ah
+			db	93h,37h,09h,ddh,38h,62h,f3h,e9h
+			db	77h,f0h,75h,45h,fdh,93h,3ch,e3h
+			db	42h,35h,82h,7fh,e9h,95h,2ch,74h
+			db	c5h,c7h,1eh,f9h,53h,9fh,5dh,a5h
+			db	58h,2bh,83h,b5h,beh,10h,d9h,b3h
+			db	b1h,2eh,44h,0bh,01h,cdh,07h,bbh
+			db	49h,7ah,87h,79h,4bh,b8h,a3h,47h
+			db	bfh,c4h,3bh,c7h,52h,c5h,32h,09h
+			db	84h,e5h,25h,2eh,68h,09h,aah,afh
+			db	19h,a5h,e2h,f2h,9ah,15h,e1h,f2h
+			db	dch,44h,08h,7ah,a2h,6dh,37h,b7h
+			db	f4h,00h,95h,71h,98h,b3h,a2h,27h
+			db	06h,8ch,97h,feh,fah,b0h,76h,f0h
+			db	4bh,ddh,4bh,71h,f4h,88h,22h,83h
+			db	50h,a0h,8eh,20h,7fh,40h,3ah,47h
+			db	d4h,97h,16h,49h,c7h,4ah,3eh,e5h
+			db	1dh,03h,e7h,feh,a9h,bch,cfh,c1h
+			db	a1h,1ch,6dh,3fh,9ch,e7h,dch,f5h
+			db	1fh,0ch,efh,1ch,7bh,0ah,41h,02h
+			db	6eh,33h,29h,21h,61h,91h,23h,62h
+			db	ebh,97h,ach,9ch,b1h,8fh,41h,72h
+			db	dah,00h,d8h,88h,e9h,bdh,bbh,46h
+			db	ddh,1fh,6dh,3fh,12h,3ah,0bh,97h
+			db	50h,00h,07h,76h,66h,c6h,07h,cdh
+			db	41h,05h,ffh,d8h,1ah,45h,36h,e4h
+			db	8dh,5ch,c4h,51h,46h,55h,f9h,c2h
+			db	fch,1eh,11h,fdh,2fh,4bh,11h,30h
+			db	a8h,e7h,e8h,a8h,4ah,83h,03h,68h
+			db	41h,b6h,73h,23h,a3h,a3h,a4h,27h
+			db	21h,c3h,0fh,ebh,79h,f4h,04h,2bh
+			db	f7h,63h,54h,5fh,e0h,69h,e7h,29h
+			db	bdh,edh,04h,03h,84h,71h,c6h,51h
+			db	d9h,5dh,c5h,46h,29h,b2h,cdh,0eh
+			db	78h,fch,75h,28h,e5h,70h,98h,74h
+			db	fbh,8bh,90h,73h,2fh,beh,c3h,c9h
+			db	a9h,59h,c6h,1ah,c6h,e6h,52h,ffh
+			db	b2h,d0h,11h,dbh,fbh,51h,2dh,15h
+			db	08h,e8h,90h,a6h,79h,1fh,9bh,a4h
+			db	74h,b6h,0fh,e0h,51h,96h,e3h,8fh
+			db	ffh,b7h,39h,66h,1fh,91h,00h,f6h
+			db	0ah,fdh,c9h,72h,f3h,59h,68h,53h
+			db	a7h,eeh,ffh,3bh,3ah,94h,c6h,a8h
+			db	93h,59h,4dh,1eh,1dh,82h,6dh,32h
+			db	3dh,88h,45h,deh,2ah,ech,1bh,beh
+			db	c5h,4ah,dah,31h,70h,32h,70h,7eh
+			db	7fh,cfh,c4h,e7h,46h,52h,ceh,0fh
+			db	65h,f1h,8ch,53h,c9h,0bh,e8h,a3h
+			db	5ah,a1h,20h,60h,41h,fbh,edh,f3h
+			db	ceh,65h,c2h,91h,92h,d8h,fch,48h
+			db	38h,c4h,0fh,c6h,9ah,4dh,6ah,34h
+			db	60h,8ah,28h,85h,0ch,90h,b8h,41h
+			db	45h,e1h,4fh,d6h,45h,41h,ach,16h
+			db	c8h,e5h,fch,84h,9dh,1ah,4dh,dfh
+			db	49h,4dh,86h,50h,2ch,4fh,eah,40h
+			db	b3h,fdh,8bh,c8h,d2h,dbh,d3h,e4h
+			db	0bh,90h,a9h,1ah,96h,f3h,e6h,dfh
+			db	dfh,5eh,c3h,34h,1fh,6ch,38h,a4h
+			db	26h,5ch,e4h,edh,fah,19h,afh,21h
+			db	61h,aeh,a9h,63h,56h,5ah,f9h,b6h
+			db	cfh,aeh,d3h,e5h,72h,33h,b2h,3ah
+			db	86h,61h,46h,2ch,4fh,83h,a9h,0ch
+			db	68h,7eh,bdh,8bh,b6h,1ch,a3h,deh
+			db	0fh,2bh,69h,67h,32h,80h,86h,c2h
+			db	87h,40h,f5h,31h,f4h,a3h,6ah,c1h
+			db	b8h,e0h,8fh,8ah,29h,11h,bah,0fh
+			db	edh,26h,11h,fdh,57h,eeh,01h,d2h
+			db	c6h,39h,52h,33h,01h,4ah,c6h,3dh
+			db	76h,b1h,59h,2ah,57h,a7h,c2h,7eh
+			db	9eh,c9h,99h,89h,05h,19h,32h,d1h
+			db	94h,9eh,5eh,0bh,8dh,1bh,16h,3fh
+			db	37h,f4h,65h,f3h,16h,b7h,59h,8fh
+			db	10h,ach,d5h,b6h,b6h,94h,1ch,bdh
+			db	50h,cdh,5eh,2bh,00h,53h,dbh,60h
+			db	8bh,51h,f4h,99h,0bh,adh,d4h,88h
+			db	74h,b6h,5fh,b8h,92h,27h,1ch,30h
+			db	8bh,d8h,f8h,b7h,89h,61h,e3h,dch
+			db	e9h,41h,fbh,c7h,03h,27h,2fh,86h
+			db	74h,ddh,aeh,88h,84h,a3h,79h,d9h
+			db	56h,6bh,dbh,05h,8dh,2ch,3bh,d9h
+			db	d0h,57h,a6h,00h,bbh,dfh,1ah,26h
+			db	a2h,13h,80h,9ch,4fh,8fh,9bh,95h
+			db	1ch,36h,38h,85h,58h,b8h,9fh,d1h
+			db	f6h,9ah,93h,2fh,ebh,f8h,cbh,49h
+			db	17h,43h,b6h,cbh,c8h,cch,17h,96h
+			db	05h,d5h,a5h,09h,2ah,f6h,9bh,bch
+			db	94h,2bh,61h,1fh,91h,b2h,edh,bch
+			db	12h,9fh,6ah,c3h,59h,0bh,55h,e3h
+			db	53h,4ah,66h,4dh,5eh,76h,f7h,26h
+			db	9dh,45h,5ah,e1h,cdh,f8h,2fh,adh
+			db	07h,e1h,22h,e3h,afh,a0h,a5h,d3h
+			db	9eh,a7h,eah,70h,8ch,f3h,47h,58h
+			db	7dh,b7h,c2h,5bh,7bh,2eh,03h,3bh
+			db	2eh,0eh,8fh,68h,3fh,fbh,14h,d5h
+			db	feh,d6h,5fh,a9h,beh,9ch,65h,cdh
+			db	87h,5fh,2fh,7fh,bah,f8h,5ch,e2h
+			db	95h,ach,36h,30h,7eh,4dh,96h,a8h
+			db	58h,a7h,4eh,0ah,23h,2ah,d0h,90h
+			db	c6h,c7h,5bh,94h,3fh,a7h,ffh,feh
+			db	35h,79h,21h,13h,0eh,03h,c3h,85h
+			db	f9h,08h,19h,9dh,eeh,fdh,b9h,f8h
+			db	5dh,22h,fah,e0h,52h,3ah,f9h,b3h
+			db	07h,8dh,09h,8dh,9dh,adh,0ch,a9h
+			db	dah,a7h,22h,32h,4dh,05h,c1h,c0h
+			db	a3h,4bh,fch,d5h,e5h,16h,0bh,9fh
+			db	04h,ach,1dh,4dh,46h,f5h,97h,a5h
+			db	ech,c3h,d0h,6bh,eeh,deh,59h,d7h
+			db	34h,83h,38h,52h,31h,c1h,89h,c1h
+			db	39h,63h,efh,d8h,13h,7ch,d9h,c9h
+			db	24h,45h,95h,61h,3bh,35h,a4h,64h
+			db	89h,e2h,c5h,fdh,69h,5bh,f6h,99h
+			db	ach,aah,e1h,69h,deh,c7h,0fh,8dh
+			db	f2h,63h,9ch,4eh,5ah,e0h,aeh,0eh
+			db	a3h,c1h,8fh,67h,cfh,7ah,c9h,81h
+			db	95h,96h,8bh,beh,48h,b2h,60h,10h
+			db	66h,58h,07h,83h,d8h,82h,37h,abh
+			db	8fh,0ch,1eh,6ch,11h,73h,9eh,25h
+			db	dch,dah,f5h,64h,05h,0bh,87h,b7h
+			db	bdh,38h,aeh,5ah,deh,e4h,41h,55h
+			db	dbh,95h,6eh,b0h,f0h,06h,99h,e0h
+			db	04h,3eh,19h,60h,b0h,13h,76h,6dh
+			db	a7h,34h,0dh,37h,87h,67h,82h,a9h
+			db	1eh,d8h,e1h,90h,1ah,86h,43h,f0h
+			db	c7h,63h,27h,30h,edh,75h,cdh,d7h
+			db	b1h,cdh,63h,a9h,0dh,5dh,b5h,a7h
+			db	4bh,13h,fch,aah,7dh,feh,65h,f7h
+			db	20h,5dh,f6h,99h,d2h,d0h,16h,83h
+			db	c5h,93h,e2h,d0h,83h,73h,abh,36h
+			db	8eh,59h,7eh,1eh,b8h,32h,a9h,22h
+			db	f6h,9fh,4ah,d6h,cfh,bdh,c4h,a4h
+			db	9fh,06h,a5h,d7h,7eh,90h,afh,cfh
+			db	c8h,77h,e4h,d9h,5dh,ech,76h,57h
+			db	96h,f3h,3dh,63h,b0h,51h,41h,74h
+			db	88h,ebh,23h,ffh,77h,e0h,2eh,d3h
+			db	f8h,a1h,c7h,3ch,adh,79h,4bh,b9h
+			db	77h,72h,c9h,b8h,89h,7bh,a6h,83h
+			db	61h,aeh,9eh,9fh,5ch,1ch,27h,22h
+			db	eah,3ah,b8h,27h,c6h,8ch,a9h,dah
+			db	a6h,79h,67h,d0h,ffh,a1h,b1h,34h
+			db	52h,cfh,8bh,e6h,d1h,34h,51h,24h
+			db	4bh,2fh,00h,d5h,41h,50h,aeh,2ch
+			db	90h,24h,58h,3ah,02h,68h,33h,41h
+			db	a5h,e7h,46h,a5h,92h,01h,ech,16h
+			db	6ch,0bh,b0h,79h,1ch,04h,20h,a5h
+			db	8bh,4dh,a1h,57h,d8h,49h,85h,ech
+			db	adh,28h,17h,08h,46h,60h,58h,fah
+			db	42h,57h,4dh,04h,a4h,8eh,8ch,6bh
+			db	03h,41h,06h,55h,72h,d8h,70h,03h
+			db	b2h,fbh,eah,2ah,e7h,1ah,e7h,38h
+			db	e8h,f8h,62h,93h,7ah,64h,f3h,1fh
+			db	6ah,deh,00h,f9h,91h,3bh,49h,11h
+			db	61h,7bh,00h,f9h,bah,4eh,b2h,86h
+			db	a4h,60h,c3h,f0h,50h,39h,47h,52h
+			db	7ch,6eh,99h,2dh,17h,f7h,1bh,30h
+			db	f5h,85h,3fh,75h,e8h,96h,f7h,e1h
+			db	8bh,06h,eah,79h,48h,97h,00h,0ch
+			db	c2h,52h,5dh,dch,d2h,efh,c9h,78h
+			db	00h,a9h,74h,e4h,02h,bbh,56h,4fh
+			db	c6h,29h,bbh,f4h,12h,2fh,65h,abh
+			db	edh,00h,e1h,b7h,01h,68h,8dh,b5h
+			db	00h,6ah,39h,8eh,37h,e2h,2dh,e2h
+			db	71h,e0h,8ah,efh,b9h,47h,efh,e1h
+			db	63h,6eh,64h,dah,b7h,63h,a6h,09h
+			db	72h,9ch,afh,9dh,c5h,95h,a4h,09h
+			db	78h,27h,08h,e9h,efh,56h,96h,92h
+			db	83h,aah,99h,75h,35h,29h,48h,d4h
+			db	2ch,7ch,4dh,12h,5ch,41h,28h,42h
+			db	dbh,7ch,c1h,63h,49h,45h,bdh,71h
+			db	bfh,1fh,0dh,8bh,fbh,8fh,4fh,feh
+			db	f9h,6fh,edh,25h,64h,a1h,66h,eah
+			db	a6h,82h,6fh,5bh,85h,fdh,19h,a4h
+			db	e7h,58h,65h,30h,1dh,ach,fch,e3h
+			db	c2h,44h,c0h,49h,ceh,f0h,0bh,37h
+			db	e0h,71h,5eh,65h,17h,8ah,96h,37h
+			db	00h,17h,c5h,c0h,25h,f5h,49h,88h
+			db	20h,27h,51h,04h,fdh,1dh,21h,63h
+			db	73h,ddh,adh,6ah,48h,6bh,e0h,ach
+			db	87h,f7h,cah,3ch,bch,7bh,d9h,b9h
+			db	86h,59h,38h,46h,cbh,94h,17h,33h
+			db	4bh,3eh,80h,bdh,78h,12h,aah,7dh
+			db	1eh,7bh,8eh,b7h,08h,1fh,feh,7ch
+			db	03h,c4h,91h,61h,02h,30h,6fh,b2h
+			db	46h,3dh,36h,1ch,d0h,f1h,ebh,06h
+			db	c6h,cch,d6h,90h,a2h,30h,b3h,36h
+			db	78h,c7h,03h,c9h,b7h,85h,47h,bdh
+			db	c8h,80h,deh,05h,1bh,36h,2ch,33h
+			db	5fh,cfh,16h,ach,ach,29h,7fh,d9h
+			db	55h,ddh,b5h,70h,03h,31h,f9h,62h
+			db	6eh,ech,eah,8fh,4ch,38h,c5h,81h
+			db	6ah,39h,b7h,5eh,f4h,0dh,2bh,ebh
+			db	bbh,38h,bdh,fch,9eh,d2h,0fh,e4h
+			db	7eh,bah,f2h,2bh,2eh,8ch,c5h,9ch
+			db	22h,c1h,17h,a1h,edh,4ah,14h,d6h
+			db	85h,92h,1eh,84h,00h,e7h,dch,f0h
+			db	46h,e1h,75h,eah,32h,6ch,45h,d2h
+			db	24h,2eh,f5h,9fh,90h,31h,ffh,0dh
+			db	efh,d3h,41h,94h,4fh,fch,abh,34h
+			db	29h,83h,4ah,e7h,2ch,fch,f9h,76h
+			db	8eh,a3h,61h,8fh,23h,bah,04h,84h
+			db	82h,2eh,c4h,78h,37h,43h,1ah,33h
+			db	94h,dch,46h,5ch,7ah,b8h,f2h,19h
+			db	52h,f0h,a5h,f0h,e8h,f7h,2ah,a6h
+			db	d3h,37h,a3h,bfh,e0h,8dh,69h,6dh
+			db	e5h,3bh,bdh,6fh,16h,02h,dfh,44h
+			db	07h,22h,fbh,37h,4ch,ffh,4ah,dch
+			db	f0h,a8h,ceh,cch,82h,54h,92h,ech
+			db	77h,b3h,80h,b2h,61h,b6h,83h,34h
+			db	fbh,2ah,a1h,02h,7eh,6ch,39h,c9h
+			db	5ch,83h,ffh,90h,4ch,4dh,f7h,01h
+			db	72h,52h,61h,6bh,4dh,e3h,f0h,edh
+			db	d9h,b7h,abh,82h,13h,c5h,1fh,93h
+			db	06h,2dh,0ch,d7h,12h,2dh,2bh,f5h
+			db	38h,25h,cfh,6fh,bbh,85h,16h,3fh
+			db	15h,e4h,cfh,bbh,78h,4ah,39h,93h
+			db	2eh,2fh,8ch,eah,76h,21h,c2h,4eh
+			db	0dh,d0h,12h,aeh,25h,6bh,1ah,1ah
+			db	efh,90h,a2h,58h,eeh,fdh,32h,44h
+			db	3ah,36h,70h,19h,e3h,afh,b8h,ddh
+			db	76h,deh,c2h,e5h,3fh,4fh,c9h,90h
+			db	16h,0eh,0dh,b3h,39h,52h,c9h,5ch
+			db	adh,00h,feh,d5h,cah,2ah,e4h,a3h
+			db	aeh,a8h,f3h,4ah,28h,77h,cdh,abh
+			db	fah,33h,40h,beh,1ch,30h,18h,4eh
+			db	dbh,48h,20h,6eh,7bh,14h,73h,4ch
+			db	57h,5eh,01h,3eh,5ah,00h,52h,6ch
+			db	70h,feh,2ah,3ch,d8h,77h,9fh,70h
+			db	b4h,74h,d9h,92h,d4h,b8h,ach,72h
+			db	2ah,57h,d4h,05h,e4h,feh,e6h,8dh
+			db	29h,18h,3bh,c7h,72h,fbh,e3h,c9h
+			db	55h,4ah,cfh,97h,bfh,d6h,c6h,30h
+			db	58h,d7h,8bh,f5h,deh,65h,34h,3fh
+			db	3eh,61h,bbh,e9h,e9h,52h,aah,f4h
+			db	9eh,6fh,34h,08h,6dh,9eh,91h,3ch
+			db	7ch,d8h,74h,a4h,28h,7ch,46h,45h
+			db	66h,4eh,81h,84h,7ah,29h,68h,e0h
+			db	c0h,92h,adh,bbh,59h,d2h,beh,d0h
+			db	d3h,e8h,28h,0bh,49h,bdh,ddh,8ch
+			db	29h,63h,72h,bbh,23h,5bh,e2h,d6h
+			db	cdh,96h,4fh,3ah,7dh,77h,1eh,8bh
+			db	3bh,dch,53h,3ah,5ah,4ah,22h,ddh
+			db	5eh,52h,13h,aah,bch,29h,51h,0dh
+			db	5bh,feh,bbh,f5h,90h,2eh,47h,51h
+			db	53h,bch,39h,56h,4dh,dah,62h,7dh
+			db	67h,f8h,aah,7ch,19h,61h,95h,48h
+			db	0eh,f2h,a6h,9fh,90h,edh,21h,feh
+			db	54h,48h,f3h,90h,3fh,cah,0ah,46h
+			db	0ch,a3h,78h,bbh,bch,a4h,a5h,33h
+			db	c3h,5dh,d9h,27h,4ah,30h,63h,fbh
+			db	feh,fch,7bh,ech,ebh,68h,2bh,f8h
+			db	aeh,84h,b4h,d2h,02h,2ch,04h,f5h
+			db	06h,a4h,84h,81h,f4h,4ch,31h,92h
+			db	41h,c7h,66h,52h,25h,59h,23h,40h
+			db	cbh,72h,01h,ach,c1h,56h,f8h,33h
+			db	20h,21h,5bh,3ch,f2h,f3h,9dh,e7h
+			db	f1h,e3h,ddh,b7h,9eh,f9h,1ah,d1h
+			db	aeh,76h,e3h,8dh,80h,00h,9fh,0dh
+			db	e3h,34h,46h,20h,6fh,18h,a0h,beh
+			db	61h,a6h,75h,17h,1ch,6ch,a2h,6eh
+			db	6eh,54h,6ah,67h,aeh,f1h,0eh,5ch
+			db	9fh,5fh,5dh,f8h,35h,54h,41h,09h
+			db	00h,ach,8bh,21h,ddh,89h,2bh,b6h
+			db	f2h,cbh,7eh,f6h,7ch,9ah,c1h,07h
+			db	15h,72h,64h,d0h,e2h,45h,0fh,8fh
+			db	efh,b2h,77h,55h,64h,77h,62h,8fh
+			db	e7h,e1h,8fh,37h,3ch,76h,26h,4ch
+			db	c0h,22h,d7h,deh,d7h,29h,dch,bdh
+			db	70h,a6h,d5h,dah,0eh,76h,58h,11h
+			db	34h,1ah,8fh,16h,71h,c5h,73h,51h
+			db	94h,ceh,c9h,aeh,14h,6dh,10h,24h
+			db	07h,16h,bch,91h,26h,54h,1fh,67h
+			db	58h,edh,16h,fdh,3fh,05h,56h,bfh
+			db	dfh,d5h,65h,21h,1dh,64h,82h,51h
+			db	ach,41h,68h,fah,fch,3eh,98h,d1h
+			db	d7h,4eh,c6h,0eh,dch,1bh,eeh,d0h
+			db	b4h,0fh,d6h,79h,70h,03h,d1h,40h
+			db	ffh,67h,0ch,f4h,fdh,00h,2ah,b2h
+			db	cah,d5h,afh,77h,53h,69h,66h,01h
+			db	9eh,e8h,5ah,2bh,d7h,9dh,73h,dfh
+			db	a1h,a9h,64h,52h,10h,e1h,d2h,87h
+			db	1bh,42h,deh,0fh,3dh,b2h,00h,a3h
+			db	b8h,26h,b3h,f7h,f5h,36h,a0h,a9h
+			db	aah,dbh,88h,d4h,3bh,6bh,3bh,cfh
+			db	08h,18h,91h,ffh,e3h,43h,32h,07h
+			db	fah,68h,c1h,bch,4eh,83h,8fh,b3h
+			db	66h,e4h,60h,eeh,17h,f1h,bah,bfh
+			db	c0h,77h,16h,7fh,16h,e0h,f6h,ach
+			db	77h,eeh,4fh,8ch,dfh,b1h,cch,6ah
+			db	38h,62h,10h,3fh,10h,f3h,84h,5eh
+			db	09h,23h,ceh,3dh,abh,b1h,f5h,bdh
+			db	35h,61h,72h,bah,2ch,e1h,14h,74h
+			db	5eh,d5h,1ch,99h,5fh,95h,dah,59h
+			db	2eh,1eh,abh,d6h,42h,98h,79h,abh
+			db	09h,3dh,b0h,3ah,98h,88h,fch,43h
+			db	e9h,53h,66h,3dh,99h,7bh,46h,9ch
+			db	34h,9eh,26h,92h,4dh,a7h,d4h,36h
+			db	cch,01h,bbh,f4h,a2h,23h,68h,02h
+			db	0ah,95h,dfh,c1h,84h,ebh,eah,eeh
+			db	c5h,16h,eah,0ch,e8h,3ah,8ch,ebh
+			db	6dh,d9h,cfh,0dh,2bh,c0h,e8h,26h
+			db	4ch,2fh,53h,9fh,e1h,24h,d7h,abh
+			db	45h,8eh,5bh,02h,4fh,b4h,16h,84h
+			db	56h,f1h,c9h,3ah,5ah,14h,b6h,39h
+			db	aeh,4eh,b5h,8dh,07h,6eh,31h,3ah
+			db	bbh,01h,76h,4dh,c9h,0ch,60h,7ah
+			db	ebh,37h,12h,97h,2dh,9fh,5dh,b5h
+			db	a1h,15h,39h,c4h,b5h,4ah,efh,b2h
+			db	f3h,01h,bfh,e1h,5ah,e7h,deh,abh
+			db	beh,afh,93h,34h,42h,94h,4ch,8ah
+			db	57h,beh,38h,e5h,6dh,6ch,83h,39h
+			db	a3h,d6h,6ch,78h,8dh,35h,22h,f7h
+			db	c3h,4bh,17h,67h,2ah,5ah,e7h,a1h
+			db	efh,20h,2eh,a3h,aah,3ch,27h,c7h
+			db	e1h,a6h,2ah,4ah,f6h,f2h,32h,91h
+			db	95h,d3h,28h,17h,bch,d9h,3bh,52h
+			db	7ch,c8h,19h,23h,76h,fch,76h,9ch
+			db	6ch,62h,8dh,2fh,2eh,58h,8dh,e0h
+			db	94h,49h,f3h,88h,2eh,e2h,11h,b5h
+			db	14h,ech,5bh,57h,47h,51h,7fh,71h
+			db	18h,ddh,f8h,b8h,96h,2eh,83h,f6h
+			db	aeh,f7h,13h,b9h,d2h,79h,17h,96h
+			db	4ch,b4h,deh,87h,c0h,e5h,d8h,ceh
+			db	bdh,27h,f5h,2eh,5eh,95h,01h,62h
+			db	7ah,cbh,7eh,4eh,08h,58h,59h,83h
+			db	39h,4ah,06h,cah,12h,b4h,75h,2fh
+			db	c7h,6ch,feh,93h,bdh,9bh,a5h,1ch
+			db	bdh,b4h,89h,1fh,1dh,69h,99h,90h
+			db	67h,a8h,44h,8dh,19h,0eh,58h,83h
+			db	7eh,7ch,c1h,b9h,8ch,ach,efh,29h
+			db	28h,0bh,64h,5ah,bdh,1eh,21h,0ah
+			db	65h,ech,71h,50h,9ah,c8h,ach,8bh
+			db	71h,6bh,5fh,c7h,e5h,31h,40h,4fh
+			db	dch,9ch,abh,79h,f3h,96h,d9h,aah
+			db	72h,13h,0dh,70h,32h,cah,62h,beh
+			db	7ah,47h,2ah,43h,97h,28h,f0h,ddh
+			db	d7h,ddh,61h,cfh,d1h,4ch,27h,a6h
+			db	a3h,e6h,c9h,81h,73h,b3h,a1h,e9h
+			db	fdh,69h,24h,97h,c5h,f5h,8fh,41h
+			db	8ah,45h,45h,4ch,f0h,15h,9ah,24h
+			db	04h,f2h,9bh,f1h,4eh,f8h,5fh,afh
+			db	f8h,0ah,49h,d4h,f6h,4eh,51h,fah
+			db	0dh,08h,a4h,9fh,c1h,3fh,cdh,35h
+			db	61h,62h,c5h,bdh,93h,8ch,efh,e5h
+			db	9dh,ceh,c0h,32h,6dh,35h,60h,cah
+			db	57h,a7h,f5h,1eh,c6h,20h,f8h,0ch
+			db	1eh,0ah,44h,efh,14h,dah,5bh,56h
+			db	59h,1eh,16h,fah,2dh,4bh,cfh,86h
+			db	92h,a7h,45h,e9h,b3h,3bh,fah,98h
+			db	1ch,a0h,a3h,45h,b2h,45h,91h,a2h
+			db	51h,82h,17h,dfh,e4h,99h,d2h,e1h
+			db	92h,51h,0dh,d6h,a0h,8eh,3bh,adh
+			db	e7h,d3h,75h,a8h,2bh,51h,13h,8ch
+			db	f9h,ffh,83h,5eh,00h,88h,6eh,9ah
+			db	90h,78h,62h,72h,3ah,38h,8eh,01h
+			db	4fh,d9h,cch,d7h,32h,b7h,68h,aeh
+			db	adh,64h,e0h,08h,71h,1fh,b2h,2fh
+			db	f6h,e9h,83h,eeh,b3h,8bh,b6h,6dh
+			db	92h,bfh,46h,10h,13h,f4h,44h,aeh
+			db	14h,e5h,aeh,89h,f9h,77h,bfh,8eh
+			db	82h,0ch,01h,03h,ach,7ch,03h,a8h
+			db	69h,afh,5ch,ech,46h,f3h,b7h,81h
+			db	b2h,edh,27h,bch,b6h,07h,72h,21h
+			db	32h,e8h,e1h,03h,ach,f8h,afh,73h
+			db	21h,1fh,40h,a2h,80h,3ah,a2h,03h
+			db	41h,42h,7bh,90h,39h,67h,aeh,aeh
+			db	e2h,92h,9bh,81h,c4h,d1h,c0h,8dh
+			db	7dh,70h,bbh,36h,41h,15h,31h,aah
+			db	76h,47h,1dh,82h,36h,a6h,36h,3bh
+			db	1bh,8eh,25h,86h,d4h,8bh,dah,02h
+			db	5ch,c3h,23h,cfh,0ch,89h,4fh,c5h
+			db	3ch,b4h,59h,b5h,68h,dch,7dh,c1h
+			db	bah,08h,42h,1ch,64h,05h,f8h,98h
+			db	2ch,3eh,03h,4fh,a2h,5dh,04h,31h
+			db	82h,fch,e7h,11h,ddh,96h,fch,d2h
+			db	f1h,25h,8ah,d4h,f7h,fbh,b7h,47h
+			db	46h,40h,3bh,4dh,a3h,6dh,5ch,dah
+			db	abh,14h,f9h,0dh,0dh,25h,e1h,38h
+			db	8ah,b4h,c2h,34h,3bh,b7h,84h,b3h
+			db	f1h,43h,99h,dah,1dh,76h,43h,a6h
+			db	4eh,80h,78h,4eh,7ah,feh,cbh,dch
+			db	e8h,d3h,33h,14h,38h,68h,2bh,fdh
+			db	20h,28h,fch,d7h,54h,96h,eeh,9ah
+			db	7dh,07h,efh,ffh,ddh,d3h,0ch,d3h
+			db	7bh,0eh,25h,f1h,70h,5eh,d5h,70h
+			db	bch,d0h,94h,10h,cdh,f0h,f6h,dch
+			db	e5h,a6h,4dh,8ah,6fh,70h,8dh,29h
+			db	18h,2ah,9ah,72h,94h,0dh,7dh,f4h
+			db	cdh,66h,b9h,3dh,3ah,f5h,6dh,87h
+			db	78h,95h,36h,eeh,17h,7fh,3ah,beh
+			db	87h,24h,0fh,d3h,96h,23h,5eh,29h
+			db	c0h,22h,0bh,d8h,d8h,ebh,8ah,fch
+			db	cfh,38h,14h,d8h,cah,85h,9bh,88h
+			db	3eh,8bh,30h,f9h,82h,c4h,28h,e3h
+			db	62h,41h,0fh,29h,40h,63h,26h,c0h
+			db	c4h,37h,cdh,afh,70h,63h,42h,43h
+			db	72h,81h,12h,0dh,59h,2fh,afh,ebh
+			db	7ch,d6h,56h,07h,91h,33h,c4h,33h
+			db	78h,e7h,27h,73h,12h,ach,4bh,e4h
+			db	d1h,84h,56h,35h,c0h,eeh,92h,e6h
+			db	38h,27h,74h,13h,f8h,c3h,6dh,ech
+			db	e6h,f8h,a9h,c5h,a8h,27h,d4h,2ah
+			db	f7h,13h,d7h,63h,03h,22h,11h,05h
+			db	20h,d6h,beh,76h,25h,8ch,50h,5ch
+			db	14h,10h,c3h,ech,5eh,9ah,edh,ddh
+			db	64h,d2h,77h,26h,44h,0dh,7ch,25h
+			db	c0h,b6h,b2h,86h,4eh,66h,98h,a7h
+			db	4ah,5eh,a3h,3ch,34h,3ah,97h,78h
+			db	b3h,4ch,d8h,16h,d3h,5bh,4bh,adh
+			db	a4h,e8h,a3h,b7h,9fh,c3h,dah,dfh
+			db	60h,8ch,53h,d5h,cfh,7ch,e3h,37h
+			db	b0h,51h,9dh,06h,e5h,eah,a6h,0dh
+			db	8ah,54h,1ch,a3h,8fh,3eh,d5h,8bh
+			db	42h,04h,d6h,7ah,00h,98h,2bh,f5h
+			db	f1h,05h,c6h,fah,dfh,7ah,85h,98h
+			db	38h,2dh,b7h,79h,70h,14h,d0h,e4h
+			db	e4h,4fh,c2h,a9h,6fh,9fh,6ah,9fh
+			db	98h,e5h,a1h,5fh,19h,26h,deh,1dh
+			db	cdh,86h,b5h,5dh,82h,76h,bdh,14h
+			db	0fh,b6h,deh,93h,1ah,dbh,dah,3ch
+			db	28h,cch,0bh,d7h,91h,95h,abh,7eh
+			db	22h,cah,63h,17h,87h,5ah,3ch,20h
+			db	3eh,e7h,12h,dbh,c0h,7ch,0ah,93h
+			db	a9h,6bh,79h,68h,27h,4ah,c5h,12h
+			db	d7h,84h,aeh,9bh,05h,71h,5bh,27h
+			db	efh,bdh,04h,00h,29h,8ch,50h,7dh
+			db	afh,57h,0bh,6bh,76h,e6h,99h,5bh
+			db	cbh,2ch,87h,83h,c5h,dfh,57h,b5h
+			db	20h,95h,c0h,e7h,81h,13h,abh,e8h
+			db	f5h,2bh,a9h,96h,62h,e1h,68h,cdh
+			db	3ch,93h,f7h,0dh,a4h,75h,55h,c3h
+			db	0fh,f7h,77h,3bh,87h,dch,f0h,a6h
+			db	e7h,c5h,9dh,23h,b2h,bbh,19h,3bh
+			db	ceh,28h,dah,91h,dbh,48h,65h,17h
+			db	a9h,13h,e6h,9fh,a9h,d2h,4eh,b1h
+			db	c5h,0eh,22h,c7h,fbh,a9h,eah,1eh
+			db	7fh,ceh,0eh,22h,04h,70h,20h,66h
+			db	6ch,93h,4ah,e6h,47h,c3h,94h,90h
+			db	40h,03h,a6h,c4h,7eh,38h,0ah,c7h
+			db	21h,32h,ddh,18h,cfh,d9h,6dh,b1h
+			db	d8h,95h,07h,fbh,e8h,e4h,e8h,a5h
+			db	f8h,3dh,d4h,a4h,6ah,07h,58h,d2h
+			db	5ah,7dh,6bh,58h,78h,f8h,46h,53h
+			db	91h,e6h,52h,d9h,91h,06h,97h,99h
+			db	deh,58h,65h,1ch,a6h,7ah,38h,9ch
+			db	7dh,5eh,5fh,d1h,6eh,e8h,f9h,0dh
+			db	eeh,36h,8bh,c2h,32h,9dh,f7h,ach
+			db	54h,9bh,feh,0bh,1fh,7ch,dbh,47h
+			db	7dh,4bh,a5h,8ch,83h,c5h,b4h,76h
+			db	3bh,5eh,59h,6ah,3dh,7ah,b5h,abh
+			db	b3h,6ch,6ch,99h,fch,30h,59h,a8h
+			db	bbh,b6h,b9h,e6h,9bh,feh,dfh,d2h
+			db	c5h,6ch,b4h,25h,47h,01h,67h,7ah
+			db	d8h,a4h,bch,fah,82h,4eh,44h,e2h
+			db	2ah,7bh,4ah,ech,18h,dbh,5dh,39h
+			db	dbh,3fh,ebh,b4h,51h,cdh,11h,f2h
+			db	54h,2ah,46h,17h,76h,50h,37h,dbh
+			db	dch,89h,fbh,21h,e4h,f6h,85h,83h
+			db	8ch,dah,efh,ceh,e0h,0eh,9eh,31h
+			db	4dh,f1h,fch,08h,75h,3dh,e3h,97h
+			db	58h,0ah,94h,36h,e0h,19h,92h,feh
+			db	f5h,45h,80h,58h,40h,76h,5eh,98h
+			db	28h,17h,8ch,92h,4bh,03h,5fh,67h
+			db	38h,fbh,adh,d3h,4ch,24h,55h,9ch
+			db	1bh,a7h,e2h,48h,d7h,57h,56h,89h
+			db	1fh,16h,afh,d0h,16h,ach,2eh,96h
+			db	04h,a5h,07h,c0h,d8h,40h,d6h,24h
+			db	8ah,a0h,7bh,abh,4ch,0dh,4dh,22h
+			db	04h,9ah,b3h,c0h,69h,96h,d1h,87h
+			db	b0h,ffh,d0h,0ch,58h,1eh,52h,1bh
+			db	cch,81h,7eh,09h,3bh,75h,d2h,a8h
+			db	14h,f8h,d8h,f0h,e2h,7dh,2dh,85h
+			db	74h,0eh,7ah,42h,3ah,83h,ech,cch
+			db	2ah,8dh,6eh,38h,8fh,dbh,afh,81h
+			db	09h,bdh,bdh,14h,ech,deh,fbh,99h
+			db	70h,07h,63h,f9h,59h,37h,dch,23h
+			db	1ah,31h,c0h,6bh,45h,93h,ffh,6eh
+			db	65h,ffh,22h,46h,5fh,d0h,68h,28h
+			db	0bh,c0h,d4h,bfh,c6h,cah,98h,20h
+			db	2eh,99h,d5h,94h,f7h,4ch,65h,edh
+			db	a4h,1eh,63h,0dh,3ah,7ch,6fh,12h
+			db	5dh,d7h,07h,f3h,dbh,00h,cdh,89h
+			db	01h,0ch,e1h,37h,e7h,a1h,19h,bah
+			db	a2h,29h,c9h,a8h,3ah,ffh,fdh,3bh
+			db	12h,0dh,75h,c2h,b8h,b1h,19h,0bh
+			db	b7h,3bh,2eh,88h,e2h,6bh,3dh,0bh
+			db	02h,8bh,fdh,ceh,39h,4dh,f2h,95h
+			db	f1h,efh,13h,78h,9eh,bch,29h,8ch
+			db	68h,bch,20h,aeh,b4h,88h,7eh,1bh
+			db	36h,61h,eeh,c1h,09h,dah,7ch,31h
+			db	fch,4fh,dfh,94h,fbh,67h,3bh,44h
+			db	62h,4eh,32h,2eh,cdh,36h,f5h,0fh
+			db	63h,e0h,8eh,0dh,a3h,14h,50h,32h
+			db	b7h,9ch,4eh,40h,c2h,d5h,bch,8ah
+			db	e1h,31h,05h,dah,1fh,89h,41h,a3h
+			db	7fh,97h,a4h,54h,8ch,84h,fah,5dh
+			db	4dh,21h,7bh,6fh,cfh,49h,a4h,bbh
+			db	1eh,59h,a2h,d5h,17h,01h,9ch,1ah
+			db	7eh,19h,a9h,d6h,89h,bbh,e0h,edh
+			db	6fh,1ch,47h,15h,5eh,0ah,edh,a2h
+			db	23h,23h,12h,b0h,b4h,efh,6fh,d9h
+			db	26h,52h,06h,62h,9ch,d9h,a2h,fdh
+			db	cah,adh,96h,4eh,54h,e2h,bbh,73h
+			db	74h,27h,d1h,07h,05h,2ch,0fh,c0h
+			db	65h,b9h,dbh,a4h,a1h,39h,94h,3bh
+			db	f7h,a5h,f4h,cfh,7eh,a4h,ddh,23h
+			db	e2h,9eh,e5h,86h,c5h,2dh,75h,f7h
+			db	c7h,63h,d5h,1eh,fah,b9h,99h,b1h
+			db	9fh,3ch,72h,95h,86h,0dh,a9h,16h
+			db	cah,a2h,f4h,0ch,ceh,42h,27h,26h
+			db	01h,42h,82h,19h,94h,46h,61h,c2h
+			db	37h,a0h,89h,25h,41h,00h,ceh,58h
+			db	d2h,f6h,64h,ffh,eah,2fh,7ch,ceh
+			db	f8h,0fh,e3h,1fh,40h,26h,81h,1bh
+			db	26h,bch,bch,bfh,ebh,8eh,ffh,75h
+			db	79h,81h,ffh,94h,e8h,43h,44h,83h
+			db	48h,1eh,83h,61h,63h,49h,1bh,45h
+			db	c0h,31h,69h,c9h,a8h,2eh,5ah,62h
+			db	a9h,2ah,cah,f6h,e3h,28h,98h,76h
+			db	afh,31h,b5h,0ah,7ch,59h,3bh,1ah
+			db	5fh,1dh,edh,5ch,96h,2bh,efh,b2h
+			db	a5h,ceh,47h,95h,8dh,a2h,05h,97h
+			db	b0h,9bh,5ch,fbh,63h,a2h,5eh,9dh
+			db	13h,0dh,a4h,d4h,65h,b5h,49h,33h
+			db	ffh,10h,c7h,d5h,13h,f1h,43h,93h
+			db	25h,b7h,73h,d1h,92h,24h,96h,86h
+			db	52h,ffh,24h,3eh,23h,0eh,d0h,adh
+			db	38h,5ah,dah,f2h,20h,49h,d9h,d6h
+			db	b2h,03h,9eh,2eh,2fh,3dh,b4h,57h
+			db	dbh,c4h,cdh,62h,b8h,42h,26h,21h
+			db	51h,14h,abh,96h,81h,56h,f4h,70h
+			db	e8h,91h,97h,b3h,5dh,61h,22h,22h
+			db	08h,8fh,19h,93h,bch,17h,bah,0ah
+			db	87h,1dh,e9h,30h,3dh,1dh,6fh,38h
+			db	f0h,0ch,3bh,eah,41h,fdh,edh,6eh
+			db	94h,74h,0eh,9eh,aah,eeh,83h,d3h
+			db	65h,f6h,43h,06h,9eh,2ch,ceh,98h
+			db	4dh,96h,0dh,a6h,32h,0ch,3dh,77h
+			db	5dh,88h,80h,fbh,56h,30h,41h,8dh
+			db	43h,b1h,f9h,07h,7ah,11h,d4h,ech
+			db	99h,23h,dah,50h,98h,f4h,79h,56h
+			db	deh,5ah,fdh,42h,4dh,2ah,09h,1dh
+			db	f4h,8ah,d4h,40h,d9h,21h,91h,8fh
+			db	beh,1eh,43h,7dh,b3h,abh,30h,c7h
+			db	89h,20h,1dh,feh,b4h,44h,cch,5fh
+			db	61h,02h,a8h,bdh,3bh,abh,5dh,2ah
+			db	20h,3fh,fah,c1h,12h,1ah,75h,e6h
+			db	78h,17h,e3h,dch,97h,9ch,edh,06h
+			db	c4h,6ah,0eh,f7h,45h,6dh,7ch,94h
+			db	dfh,0dh,f3h,b5h,73h,a7h,21h,7fh
+			db	1ch,7fh,30h,89h,67h,bdh,e2h,80h
+			db	07h,a5h,69h,a6h,5bh,47h,86h,83h
+			db	60h,f4h,c8h,c0h,51h,11h,aah,ebh
+			db	64h,ech,9ah,20h,36h,bch,2ah,ceh
+			db	9fh,eah,fbh,73h,adh,91h,79h,5eh
+			db	f1h,e5h,41h,0eh,92h,67h,a2h,57h
+			db	a7h,38h,74h,3dh,29h,f1h,deh,60h
+			db	3bh,36h,dch,9ch,f8h,3bh,52h,a8h
+			db	8ch,29h,77h,a0h,19h,45h,e6h,6bh
+			db	5eh,9bh,a5h,cbh,b6h,5eh,28h,9ah
+			db	f4h,65h,3eh,07h,f6h,1fh,26h,25h
+			db	dah,8bh,e0h,62h,d2h,f4h,f9h,f7h
+			db	0ch,cfh,42h,e1h,75h,9eh,17h,e1h
+			db	0eh,b2h,bdh,d8h,0fh,33h,d8h,a7h
+			db	4ah,e2h,2ah,9fh,eah,ddh,eeh,8bh
+			db	03h,24h,b0h,87h,00h,0dh,c9h,68h
+			db	d0h,88h,91h,b1h,87h,76h,edh,41h
+			db	2eh,63h,69h,b1h,4ah,2ah,7eh,fch
+			db	3eh,85h,4ah,16h,43h,5bh,07h,fdh
+			db	fbh,d2h,a0h,44h,51h,5eh,53h,d3h
+			db	3bh,e4h,3dh,3dh,dfh,eeh,b2h,3ch
+			db	06h,58h,30h,d0h,8ch,1ch,e7h,bah
+			db	68h,a4h,5ch,4bh,17h,61h,b4h,edh
+			db	40h,b5h,95h,c8h,cah,ech,4eh,26h
+			db	8ch,e4h,38h,f9h,e0h,b0h,4fh,0fh
+			db	d3h,4fh,1ch,bbh,e0h,cbh,75h,0ch
+			db	d4h,9eh,cbh,32h,19h,55h,9ah,6fh
+			db	4ah,36h,81h,47h,2dh,cch,b7h,9ch
+			db	8fh,37h,85h,6dh,f6h,b8h,79h,c2h
+			db	d1h,59h,d6h,62h,29h,e0h,b5h,58h
+			db	f8h,c2h,94h,39h,b5h,cdh,f5h,cfh
+			db	79h,84h,2eh,2dh,ech,1fh,6ch,18h
+			db	26h,03h,25h,06h,5ch,b6h,2ah,e8h
+			db	d3h,45h,d4h,cdh,cah,eah,66h,e9h
+			db	29h,93h,f9h,54h,10h,dfh,e1h,bfh
+			db	50h,a8h,8dh,1fh,3ah,77h,1dh,30h
+			db	68h,18h,7dh,b9h,95h,51h,71h,81h
+			db	8eh,e9h,86h,cfh,9ah,13h,3dh,5dh
+			db	8ch,96h,e7h,aah,48h,95h,a1h,a7h
+			db	c6h,e8h,61h,06h,d9h,05h,02h,ech
+			db	1bh,96h,92h,09h,87h,62h,47h,0ch
+			db	3ah,9dh,1ch,62h,aah,00h,c5h,f8h
+			db	11h,04h,93h,70h,d6h,5ah,b1h,fah
+			db	87h,7bh,38h,dbh,51h,05h,7eh,34h
+			db	0dh,13h,96h,41h,cah,54h,e3h,0dh
+			db	23h,81h,44h,fdh,14h,e4h,63h,d0h
+			db	80h,5fh,dah,7fh,26h,46h,3ch,dah
+			db	77h,16h,84h,feh,80h,f9h,9eh,d0h
+			db	82h,87h,c5h,2dh,6ch,28h,97h,76h
+			db	0dh,7bh,7bh,bdh,93h,c0h,d0h,63h
+			db	93h,b8h,c9h,45h,fdh,1eh,67h,a5h
+			db	44h,ach,4ch,38h,b0h,11h,60h,f5h
+			db	64h,3eh,79h,e7h,b9h,18h,2fh,b5h
+			db	aeh,68h,69h,f2h,4dh,79h,e0h,88h
+			db	b8h,a9h,44h,f1h,08h,08h,06h,b2h
+			db	d0h,d8h,adh,b6h,4eh,06h,75h,29h
+			db	1ch,95h,03h,d4h,a7h,e3h,b6h,55h
+			db	d6h,8ah,cdh,19h,e8h,d8h,d4h,2ch
+			db	8eh,53h,f1h,96h,cch,69h,2eh,58h
+			db	76h,08h,edh,07h,8dh,50h,3eh,0ch
+			db	0eh,eeh,d5h,d7h,aah,6ch,e8h,82h
+			db	e7h,22h,a0h,38h,d4h,5fh,e0h,b0h
+			db	a0h,aah,d9h,03h,0ah,7ah,fdh,c7h
+			db	0fh,54h,1fh,9fh,d3h,14h,68h,e9h
+			db	80h,fch,e4h,dah,11h,9eh,c3h,61h
+			db	b3h,48h,ddh,08h,d7h,0eh,0dh,b3h
+			db	64h,20h,06h,eeh,31h,34h,a2h,42h
+			db	ffh,72h,07h,d0h,06h,4ah,9ch,64h
+			db	69h,04h,a4h,99h,12h,f0h,39h,09h
+			db	05h,64h,b0h,a0h,1dh,73h,c6h,b2h
+			db	10h,30h,1dh,c6h,cbh,9ah,3ah,c3h
+			db	65h,d6h,11h,0ch,d6h,01h,79h,ach
+			db	6fh,36h,6ah,2fh,d7h,32h,a6h,f8h
+			db	5ch,37h,08h,6ah,39h,2ch,6dh,f1h
+			db	31h,fah,5bh,cah,98h,25h,45h,50h
+			db	c4h,64h,fbh,6fh,29h,43h,21h,3eh
+			db	61h,05h,6dh,4eh,4ch,aeh,57h,41h
+			db	34h,54h,04h,beh,2bh,0ah,50h,b8h
+			db	16h,7ah,4ch,79h,86h,67h,cbh,8ch
+			db	7bh,10h,67h,89h,8bh,61h,d7h,32h
+			db	53h,bch,76h,bbh,69h,b9h,b8h,82h
+			db	75h,2dh,7fh,a1h,28h,6ch,73h,aah
+			db	54h,93h,3ah,cch,ach,afh,03h,5ch
+			db	0fh,56h,b3h,c6h,f0h,35h,beh,31h
+			db	9bh,1dh,6eh,76h,f5h,13h,a6h,feh
+			db	20h,f3h,adh,d7h,43h,4ah,98h,d4h
+			db	5eh,80h,83h,b7h,eah,92h,16h,41h
+			db	b3h,9ah,e6h,66h,e0h,17h,d2h,36h
+			db	44h,cch,52h,66h,29h,a1h,55h,46h
+			db	4eh,95h,11h,b1h,97h,43h,9ah,85h
+			db	b7h,1ch,89h,f5h,e3h,23h,81h,46h
+			db	e0h,a0h,e0h,78h,89h,94h,30h,05h
+			db	28h,91h,7fh,deh,f7h,04h,30h,54h
+			db	9fh,40h,8dh,b1h,9dh,19h,ffh,46h
+			db	17h,e2h,38h,6eh,b3h,0bh,3fh,6ch
+			db	ceh,39h,c1h,20h,9fh,15h,86h,51h
+			db	adh,15h,efh,a7h,29h,6fh,c5h,10h
+			db	1fh,3dh,cch,f6h,d2h,cdh,8eh,17h
+			db	03h,24h,37h,28h,cdh,abh,99h,c6h
+			db	3bh,32h,aah,0ch,65h,4eh,e3h,9eh
+			db	8fh,46h,8fh,7fh,6fh,28h,8bh,ddh
+			db	3dh,0eh,8eh,04h,0ah,dah,b6h,efh
+			db	23h,5fh,83h,07h,a6h,11h,9fh,10h
+			db	9fh,9eh,91h,c8h,b6h,7eh,6eh,c2h
+			db	9ch,69h,dch,40h,24h,08h,41h,a4h
+			db	93h,f2h,3bh,d2h,26h,b4h,73h,24h
+			db	f6h,9ch,87h,b5h,96h,49h,25h,f7h
+			db	d6h,3ah,1ah,6fh,5fh,86h,eah,c2h
+			db	07h,e8h,e2h,3ah,edh,7fh,99h,c9h
+			db	46h,2ch,ceh,a8h,68h,6dh,70h,1fh
+			db	aeh,81h,80h,9ah,50h,b9h,26h,9ch
+			db	d5h,54h,0dh,efh,9dh,11h,cbh,8bh
+			db	2dh,28h,83h,1dh,c6h,0ch,3ah,cbh
+			db	09h,5fh,83h,17h,e7h,9dh,a1h,10h
+			db	45h,76h,e7h,65h,62h,8ah,39h,fch
+			db	e0h,1dh,fah,7eh,a5h,67h,06h,39h
+			db	23h,f0h,deh,eah,b9h,d4h,2bh,2bh
+			db	d4h,9fh,43h,26h,c6h,9dh,e2h,bch
+			db	c2h,b1h,f5h,d5h,03h,f9h,42h,40h
+			db	d2h,5fh,82h,d2h,ech,fch,4dh,c8h
+			db	c6h,fch,e5h,9fh,1ch,41h,cah,1dh
+			db	cah,69h,81h,f0h,5dh,29h,fbh,02h
+			db	9ch,5fh,2dh,75h,41h,11h,03h,4ah
+			db	5ch,88h,8bh,06h,0dh,eeh,1fh,09h
+			db	bfh,bfh,ach,c5h,87h,37h,f6h,a3h
+			db	d2h,4ch,bbh,5ah,6ah,1fh,79h,cbh
+			db	50h,ddh,41h,6dh,51h,b4h,37h,78h
+			db	5bh,b8h,34h,e7h,ebh,58h,a1h,e2h
+			db	19h,ach,efh,27h,5eh,2bh,69h,d2h
+			db	c6h,1dh,d9h,53h,39h,02h,c2h,ech
+			db	7eh,c0h,c6h,d1h,12h,e9h,60h,fah
+			db	ach,1dh,8ah,15h,c7h,77h,0fh,fah
+			db	37h,4bh,0ch,ceh,f4h,44h,beh,a7h
+			db	b0h,97h,c1h,b2h,b1h,60h,f6h,f6h
+			db	aeh,ech,56h,b1h,d4h,c9h,25h,9fh
+			db	7fh,7fh,b1h,07h,f8h,aeh,5dh,e5h
+			db	4ch,57h,f2h,7dh,6fh,49h,19h,3bh
+			db	aeh,82h,ddh,75h,3ch,01h,83h,24h
+			db	10h,f0h,22h,d5h,a8h,0bh,cah,5eh
+			db	dch,bah,9fh,0ch,7eh,c8h,6ch,47h
+			db	c0h,53h,f3h,38h,0fh,36h,3ah,fbh
+			db	11h,84h,1dh,95h,98h,ffh,6dh,7fh
+			db	26h,4ch,30h,afh,a9h,1fh,91h,b3h
+			db	9ch,61h,4fh,f8h,95h,5dh,18h,13h
+			db	c6h,42h,42h,85h,88h,0bh,f8h,22h
+			db	c0h,e5h,93h,0ah,f1h,f5h,66h,f7h
+			db	52h,37h,b3h,a0h,31h,feh,05h,d2h
+			db	e4h,11h,9dh,ach,20h,a2h,13h,71h
+			db	47h,7ah,a9h,36h,cdh,2ch,b0h,67h
+			db	89h,0bh,63h,e1h,6ch,40h,d9h,04h
+			db	88h,55h,2ch,fdh,20h,4bh,4fh,07h
+			db	b2h,c0h,b7h,e9h,46h,ebh,90h,67h
+			db	06h,c2h,31h,a7h,70h,c5h,f8h,b8h
+			db	86h,4fh,0ah,46h,2fh,7eh,8bh,c8h
+			db	09h,beh,66h,06h,d1h,59h,90h,09h
+			db	edh,18h,a0h,6eh,e2h,6ch,e4h,c8h
+			db	1dh,26h,afh,cdh,49h,2ch,cfh,e0h
+			db	19h,a4h,6bh,b7h,63h,d5h,98h,fbh
+			db	89h,64h,ebh,15h,79h,50h,26h,0fh
+			db	08h,7ch,30h,b8h,59h,85h,72h,f2h
+			db	f7h,0eh,92h,5ch,3ch,0ah,72h,08h
+			db	a9h,9dh,c7h,b7h,9dh,09h,11h,dbh
+			db	96h,6ch,5dh,10h,11h,61h,86h,18h
+			db	19h,7ch,beh,05h,06h,b8h,f4h,14h
+			db	51h,ebh,49h,8ch,22h,86h,2ah,00h
+			db	feh,d5h,5fh,e8h,2ch,09h,15h,89h
+			db	0dh,4ch,4ch,ach,0ah,6ch,77h,ddh
+			db	20h,cfh,b7h,19h,48h,c0h,b6h,a2h
+			db	19h,f3h,cdh,12h,2ah,f4h,84h,29h
+			db	2ch,68h,c2h,eah,52h,18h,8eh,a3h
+			db	54h,42h,cbh,6fh,c9h,9eh,eah,3ch
+			db	d7h,a8h,44h,39h,06h,44h,19h,f4h
+			db	0eh,cdh,43h,aeh,0bh,5eh,f7h,2dh
+			db	80h,18h,41h,14h,9dh,c2h,6ch,26h
+			db	edh,5fh,d4h,c0h,97h,65h,8eh,43h
+			db	0fh,44h,c1h,1eh,79h,67h,8ch,99h
+			db	0bh,b0h,cdh,beh,d7h,54h,92h,64h
+			db	2ah,d4h,7dh,0ch,aah,b2h,55h,8eh
+			db	65h,62h,39h,50h,03h,a4h,07h,70h
+			db	efh,9dh,2bh,6eh,cdh,5dh,ech,27h
+			db	83h,d2h,1ch,3ch,c8h,71h,a2h,65h
+			db	39h,66h,e7h,7dh,eah,6bh,ddh,5ah
+			db	72h,e7h,97h,a2h,63h,39h,e6h,71h
+			db	1ah,3ah,7bh,9dh,48h,60h,f5h,59h
+			db	6dh,bah,50h,02h,29h,2eh,b6h,1dh
+			db	20h,9bh,f2h,bch,ach,d7h,33h,d5h
+			db	19h,edh,46h,fdh,bah,61h,19h,d7h
+			db	91h,6fh,10h,b0h,a7h,69h,3fh,bdh
+			db	ech,41h,c5h,79h,7ch,2eh,feh,c6h
+			db	23h,2fh,64h,1ah,c3h,48h,87h,59h
+			db	d6h,1dh,8ah,53h,4ch,86h,b9h,a8h
+			db	45h,ceh,35h,f6h,83h,59h,2ah,01h
+			db	e2h,5ch,d3h,d1h,40h,c6h,09h,4ch
+			db	afh,1fh,f0h,80h,84h,a5h,4ch,13h
+			db	a3h,d2h,66h,9ah,5ah,27h,35h,47h
+			db	ech,fdh,b4h,6fh,15h,4fh,bbh,1ah
+			db	bfh,6ch,d0h,b8h,a8h,2fh,bch,b5h
+			db	45h,b6h,f2h,93h,77h,6ch,e2h,82h
+			db	e6h,40h,d2h,bah,fdh,fch,bch,63h
+			db	d7h,8eh,5fh,a1h,6eh,e6h,cfh,69h
+			db	b3h,f7h,7dh,28h,b7h,82h,b5h,72h
+			db	54h,42h,a1h,efh,42h,b5h,3ch,e5h
+			db	cah,82h,fbh,05h,7fh,f9h,09h,eah
+			db	bah,b3h,cfh,72h,74h,d6h,f5h,0bh
+			db	fah,56h,b7h,90h,94h,dah,3ah,cdh
+			db	21h,7ch,afh,a3h,d3h,6bh,cah,d9h
+			db	27h,6fh,06h,65h,75h,1dh,04h,67h
+			db	2bh,37h,91h,98h,e7h,9dh,54h,78h
+			db	48h,46h,76h,8bh,f9h,2dh,b7h,eah
+			db	5fh,20h,78h,6fh,80h,bah,71h,d9h
+			db	09h,66h,d3h,ffh,88h,8eh,01h,56h
+			db	19h,f7h,72h,b9h,abh,83h,dbh,8bh
+			db	e6h,37h,f8h,08h,56h,ach,55h,80h
+			db	09h,ffh,0ch,17h,57h,91h,a6h,58h
+			db	73h,32h,e2h,fdh,d4h,93h,c5h,8ch
+			db	2eh,00h,a9h,dfh,76h,c6h,cch,39h
+			db	bfh,6bh,f0h,75h,3ah,29h,feh,36h
+			db	85h,12h,bbh,34h,6eh,66h,e3h,59h
+			db	91h,5ch,d6h,e4h,aah,1bh,3ah,23h
+			db	29h,6dh,51h,96h,6eh,c4h,f0h,b1h
+			db	c3h,3eh,08h,b1h,beh,24h,62h,02h
+			db	32h,d8h,40h,cdh,8dh,3ch,cdh,aah
+			db	bdh,8ah,8ah,9eh,feh,f2h,23h,69h
+			db	f5h,44h,27h,1ah,cbh,16h,25h,c7h
+			db	62h,b9h,68h,74h,37h,9dh,e8h,b1h
+			db	e8h,1ch,66h,77h,bah,f5h,04h,3bh
+			db	cbh,7ah,25h,1dh,b8h,82h,1ah,6eh
+			db	82h,edh,86h,4ch,c7h,7fh,9fh,b3h
+			db	e9h,7dh,3ah,deh,fdh,00h,aah,20h
+			db	f2h,23h,a0h,67h,84h,2ch,a4h,ceh
+			db	9eh,afh,44h,2ch,e4h,3ah,53h,67h
+			db	4ah,70h,4fh,22h,11h,4ah,9bh,6bh
+			db	f2h,15h,6eh,dbh,64h,10h,25h,28h
+			db	d5h,e5h,77h,46h,71h,81h,76h,4ah
+			db	86h,64h,43h,a2h,c3h,81h,91h,6bh
+			db	47h,5fh,d6h,45h,23h,70h,95h,5ah
+			db	43h,a5h,1ah,02h,7eh,68h,70h,9bh
+			db	57h,6ah,1eh,68h,9eh,40h,23h,7dh
+			db	82h,c7h,90h,4ah,f2h,60h,62h,11h
+			db	b2h,d8h,50h,3eh,fbh,34h,54h,ach
+			db	04h,aeh,e5h,f3h,e5h,04h,b0h,03h
+			db	ebh,52h,b8h,e3h,57h,70h,94h,f1h
+			db	7bh,5eh,a6h,d5h,4dh,60h,dch,58h
+			db	c4h,8dh,0ah,19h,39h,65h,7eh,11h
+			db	edh,00h,d6h,c7h,0fh,6ch,f9h,d7h
+			db	25h,deh,72h,49h,46h,06h,a5h,cdh
+			db	18h,13h,adh,c6h,2ah,abh,6ah,d7h
+			db	42h,eah,44h,79h,02h,feh,15h,cfh
+			db	e6h,2dh,dch,39h,09h,d7h,70h,61h
+			db	11h,91h,06h,0eh,12h,84h,e6h,2ah
+			db	56h,03h,efh,10h,8fh,9bh,83h,9dh
+			db	c0h,88h,74h,3ah,6ch,41h,03h,28h
+			db	aah,2ah,1dh,2ch,d3h,04h,c3h,e2h
+			db	6ah,2ch,1eh,b8h,64h,09h,86h,19h
+			db	19h,a6h,c3h,b5h,dfh,49h,7ch,83h
+			db	ebh,92h,2bh,36h,37h,2fh,22h,aah
+			db	c0h,70h,5dh,efh,a9h,21h,31h,41h
+			db	eeh,a4h,57h,1ah,56h,87h,9ah,dch
+			db	51h,90h,51h,b0h,b9h,58h,aah,bah
+			db	25h,53h,71h,97h,71h,cbh,f1h,d7h
+			db	7ah,4dh,5fh,c0h,03h,3ah,e1h,31h
+			db	0bh,2eh,d5h,bfh,80h,cfh,85h,08h
+			db	2ch,f1h,a1h,21h,05h,39h,adh,87h
+			db	d3h,56h,8eh,c3h,e4h,a6h,eeh,42h
+			db	edh,18h,e5h,f7h,76h,b3h,7fh,d2h
+			db	76h,04h,e1h,efh,cch,d4h,aeh,77h
+			db	a4h,b8h,edh,9ch,0ah,dbh,44h,1dh
+			db	9eh,c1h,a5h,f2h,85h,edh,a8h,00h
+			db	10h,e2h,cbh,03h,8fh,ceh,ebh,13h
+			db	4dh,4ch,04h,a0h,0dh,7ah,aah,f5h
+			db	5dh,e2h,31h,7dh,c5h,bah,7ch,f4h
+			db	60h,eeh,48h,d4h,0ch,f8h,05h,92h
+			db	73h,00h,44h,61h,71h,8fh,87h,95h
+			db	a7h,b2h,68h,a5h,a8h,dch,75h,a2h
+			db	17h,71h,92h,1ch,bch,24h,3eh,5ah
+			db	9eh,a7h,69h,62h,69h,2bh,9bh,c1h
+			db	59h,9fh,43h,78h,2ah,26h,fch,8ch
+			db	9eh,f3h,1fh,b3h,97h,afh,06h,b7h
+			db	58h,39h,81h,95h,e3h,07h,c8h,7eh
+			db	82h,8bh,30h,68h,a7h,90h,fch,aeh
+			db	53h,49h,81h,12h,2ah,a9h,56h,5fh
+			db	8ah,4eh,e5h,4bh,ebh,4dh,7ah,2ch
+			db	f2h,89h,81h,e5h,10h,79h,72h,feh
+			db	beh,b4h,dah,01h,24h,bfh,07h,c4h
+			db	54h,01h,23h,29h,9ch,48h,63h,22h
+			db	63h,dch,5ch,4ah,edh,6eh,26h,d4h
+			db	8ah,2dh,a1h,fbh,65h,27h,1bh,c0h
+			db	49h,74h,09h,2ah,2eh,a9h,78h,deh
+			db	3ah,e0h,17h,1ch,07h,53h,12h,60h
+			db	f2h,dbh,22h,3ch,c6h,8fh,9ch,1dh
+			db	a3h,56h,8dh,5dh,d0h,32h,58h,55h
+			db	6fh,4dh,f4h,8fh,1bh,95h,0bh,cbh
+			db	d3h,01h,6ch,f7h,22h,82h,d1h,f4h
+			db	0ch,d2h,72h,4dh,12h,17h,52h,a6h
+			db	08h,cch,63h,c5h,f5h,dah,33h,74h
+			db	28h,cbh,f3h,f9h,64h,cch,b4h,6dh
+			db	33h,5ch,92h,89h,fbh,7dh,f0h,13h
+			db	d9h,23h,cdh,1fh,93h,5ah,5bh,e7h
+			db	cch,edh,f4h,5ch,cdh,45h,86h,64h
+			db	8eh,ach,35h,00h,62h,21h,b1h,a7h
+			db	0ch,06h,f2h,0ah,6eh,d6h,43h,adh
+			db	45h,cah,d9h,d7h,4ah,a2h,a4h,46h
+			db	1fh,d2h,3ah,e1h,23h,e6h,a0h,c9h
+			db	73h,bch,18h,2bh,67h,7bh,6fh,ddh
+			db	32h,c6h,64h,65h,9eh,c8h,07h,aeh
+			db	80h,a6h,4bh,44h,b9h,66h,8bh,c7h
+			db	20h,79h,9eh,6bh,27h,fch,59h,ffh
+			db	b1h,05h,92h,27h,93h,a5h,b5h,96h
+			db	45h,24h,01h,17h,10h,a4h,9eh,65h
+			db	42h,f3h,0eh,99h,88h,79h,02h,83h
+			db	7eh,c8h,2bh,26h,f7h,07h,47h,01h
+			db	74h,9dh,88h,16h,1fh,bch,1eh,9bh
+			db	8bh,76h,09h,17h,62h,cch,04h,7eh
+			db	9ch,dch,15h,feh,2ch,91h,aeh,1bh
+			db	63h,c3h,3bh,9dh,b7h,84h,7fh,38h
+			db	99h,79h,d2h,f8h,d2h,10h,0ah,a0h
+			db	99h,ddh,27h,7bh,60h,48h,98h,a0h
+			db	f5h,fch,8ch,0eh,86h,02h,8fh,52h
+			db	47h,12h,fbh,e1h,cdh,fch,c2h,05h
+			db	97h,c3h,40h,cdh,e8h,1ah,8dh,e3h
+			db	01h,e1h,70h,aah,67h,71h,2bh,a7h
+			db	2eh,61h,fdh,04h,5ah,44h,67h,bdh
+			db	bfh,3fh,f4h,60h,88h,2ah,d5h,e6h
+			db	aah,ddh,56h,c7h,d0h,a4h,5dh,91h
+			db	3eh,c3h,18h,cah,21h,01h,bbh,41h
+			db	2bh,a3h,eeh,a6h,f2h,9dh,89h,bdh
+			db	a3h,a4h,fbh,8ch,3bh,c2h,31h,0fh
+			db	c3h,31h,f1h,4bh,22h,63h,4ah,71h
+			db	42h,96h,77h,26h,b2h,01h,aah,c7h
+			db	61h,29h,45h,d8h,41h,87h,d3h,c5h
+			db	ech,15h,39h,d7h,aah,01h,05h,85h
+			db	eah,cch,6dh,1dh,94h,75h,3eh,efh
+			db	2ah,dfh,55h,dch,c9h,8dh,1ah,27h
+			db	33h,76h,c9h,31h,d8h,3ch,2ah,92h
+			db	9ah,75h,e5h,d7h,4bh,f5h,19h,2fh
+			db	37h,fbh,1fh,65h,51h,52h,6bh,4eh
+			db	c8h,c9h,f6h,7fh,81h,22h,c8h,7bh
+			db	97h,7ah,9bh,41h,57h,feh,e5h,a2h
+			db	00h,d7h,45h,63h,96h,3ah,9fh,e6h
+			db	d6h,78h,d6h,b3h,13h,8dh,5fh,42h
+			db	6ah,18h,cah,50h,c4h,6fh,17h,d3h
+			db	56h,62h,c2h,9dh,c2h,b7h,9bh,e0h
+			db	e2h,30h,3ch,ach,26h,c4h,25h,86h
+			db	24h,39h,24h,23h,fah,9eh,dbh,8ah
+			db	4ah,6bh,43h,35h,25h,3ah,a4h,89h
+			db	2eh,55h,48h,1bh,4bh,1dh,56h,86h
+			db	88h,afh,1dh,b1h,9eh,7dh,98h,50h
+			db	16h,fah,07h,c7h,16h,bah,f4h,88h
+			db	31h,95h,ddh,35h,f0h,dah,42h,8eh
+			db	c0h,3fh,7dh,38h,4bh,71h,eah,34h
+			db	e1h,38h,7ch,d7h,ach,01h,5eh,37h
+			db	9ch,4dh,f5h,fbh,e8h,1bh,5bh,4ah
+			db	3fh,ddh,24h,7fh,19h,f7h,26h,8eh
+			db	94h,58h,09h,e8h,92h,70h,61h,f0h
+			db	10h,9ah,86h,67h,65h,27h,c3h,c8h
+			db	78h,c6h,90h,f9h,a0h,69h,a1h,edh
+			db	7fh,4ch,b3h,28h,fdh,a9h,41h,80h
+			db	d0h,4ch,4dh,b2h,a5h,40h,2ch,c6h
+			db	b7h,87h,95h,e4h,f4h,deh,5ah,aah
+			db	2bh,89h,f6h,89h,6dh,39h,49h,01h
+			db	26h,afh,80h,6ah,86h,fch,e0h,bdh
+			db	7dh,3ah,e4h,0bh,38h,27h,3bh,dah
+			db	a7h,24h,28h,8fh,8ch,4ch,53h,52h
+			db	cah,2bh,ech,78h,18h,03h,edh,13h
+			db	afh,15h,69h,6fh,0dh,4fh,1eh,e0h
+			db	adh,f5h,90h,0ah,beh,dah,b3h,e1h
+			db	95h,cfh,a2h,87h,60h,2eh,07h,1ch
+			db	56h,adh,45h,7eh,12h,47h,f5h,42h
+			db	24h,beh,ffh,d0h,42h,ech,afh,f9h
+			db	b4h,62h,f2h,aah,a2h,7ah,fdh,a9h
+			db	a1h,a6h,40h,3ah,c9h,56h,c0h,aah
+			db	fdh,abh,25h,d4h,42h,6bh,15h,aah
+			db	a6h,03h,4bh,14h,d0h,4dh,0eh,c2h
+			db	67h,49h,ceh,7eh,ffh,8fh,7ah,fdh
+			db	24h,24h,b7h,50h,9dh,0dh,2ch,92h
+			db	e7h,b7h,cfh,d3h,73h,8bh,8bh,56h
+			db	20h,63h,7dh,4eh,30h,3dh,aah,ech
+			db	f8h,16h,25h,75h,cfh,98h,64h,58h
+			db	efh,16h,e2h,52h,6dh,4fh,e3h,22h
+			db	0ah,4eh,c4h,a8h,31h,6eh,80h,cdh
+			db	05h,bfh,b5h,dch,4dh,90h,3dh,b4h
+			db	9eh,67h,b6h,85h,78h,18h,4eh,50h
+			db	dah,60h,97h,fdh,20h,3bh,49h,1eh
+			db	2eh,dah,88h,eah,36h,19h,93h,96h
+			db	e7h,4dh,1bh,36h,10h,d1h,f1h,f8h
+			db	7ah,7ch,b3h,16h,bdh,25h,9eh,dah
+			db	00h,99h,beh,7bh,57h,22h,35h,ebh
+			db	68h,35h,c6h,1fh,43h,54h,11h,d2h
+			db	57h,4ch,63h,40h,5ah,6bh,07h,eeh
+			db	92h,b5h,6fh,55h,01h,38h,7ch,cfh
+			db	68h,87h,8dh,21h,cfh,39h,adh,8ch
+			db	56h,f2h,7dh,c0h,f8h,adh,d5h,22h
+			db	11h,ffh,28h,35h,36h,24h,95h,55h
+			db	28h,8bh,26h,cdh,d9h,59h,5dh,82h
+			db	dah,09h,77h,55h,7ch,6ch,71h,c8h
+			db	53h,2fh,dah,18h,35h,2fh,d7h,bbh
+			db	66h,1eh,99h,0dh,2dh,dah,30h,aeh
+			db	56h,2bh,06h,3eh,42h,cfh,3bh,0eh
+			db	58h,5ch,8fh,8bh,bfh,52h,1ah,9eh
+			db	08h,b6h,66h,43h,9ah,cfh,23h,53h
+			db	0ah,9fh,f7h,69h,75h,fch,52h,3ah
+			db	16h,fbh,cfh,93h,9ch,29h,d4h,45h
+			db	73h,e2h,3ah,e7h,c0h,09h,0ch,7dh
+			db	2ah,d7h,7dh,63h,a0h,2ah,ebh,80h
+			db	62h,fch,02h,18h,02h,d4h,6ah,52h
+			db	beh,5eh,83h,1ch,cch,75h,93h,c7h
+			db	2ah,70h,a4h,75h,e6h,ach,24h,ech
+			db	11h,feh,99h,cbh,00h,47h,25h,62h
+			db	e0h,e8h,31h,23h,6ah,39h,9bh,84h
+			db	47h,4fh,68h,9ch,79h,57h,f2h,52h
+			db	9dh,24h,dah,13h,f2h,04h,efh,55h
+			db	c6h,87h,89h,32h,97h,23h,5eh,bfh
+			db	1dh,0ah,77h,80h,21h,c9h,ach,42h
+			db	36h,1dh,f4h,32h,81h,0fh,dch,2eh
+			db	beh,9eh,3fh,30h,efh,3fh,e4h,42h
+			db	0ah,dbh,24h,c4h,23h,88h,95h,afh
+			db	fbh,4fh,2ch,aah,aah,5fh,05h,aah
+			db	cfh,38h,2ah,a8h,b6h,8fh,5fh,1ch
+			db	4ah,07h,5bh,13h,aeh,56h,b9h,60h
+			db	3ah,3ah,7dh,33h,d4h,afh,8fh,bch
+			db	8bh,2ch,dfh,c1h,2dh,50h,48h,ech
+			db	bfh,90h,a8h,87h,10h,c8h,fdh,40h
+			db	6fh,32h,7ah,30h,2dh,beh,24h,99h
+			db	b2h,33h,0ah,10h,07h,79h,afh,a6h
+			db	1ch,02h,deh,0ah,b5h,f9h,03h,a5h
+			db	2eh,f0h,ebh,43h,64h,62h,59h,59h
+			db	76h,08h,6ch,33h,e8h,90h,2ch,13h
+			db	3bh,47h,39h,b9h,06h,6eh,a0h,36h
+			db	57h,77h,10h,3dh,2bh,3fh,42h,d8h
+			db	b8h,22h,80h,84h,77h,70h,73h,3fh
+			db	8ah,15h,50h,dbh,86h,5dh,23h,21h
+			db	8ah,06h,0fh,0ah,d1h,d3h,67h,dbh
+			db	61h,beh,cah,0bh,adh,afh,03h,cfh
+			db	d0h,a1h,39h,5bh,bdh,01h,c7h,5dh
+			db	8fh,1fh,5ch,3dh,19h,6fh,69h,30h
+			db	fch,99h,adh,66h,9bh,eeh,51h,44h
+			db	06h,32h,2dh,3ah,f9h,58h,8dh,1dh
+			db	2bh,abh,06h,13h,ffh,e7h,7eh,19h
+			db	6bh,c7h,06h,02h,01h,07h,c4h,ddh
+			db	63h,93h,16h,b1h,00h,68h,f0h,d0h
+			db	15h,83h,20h,61h,29h,f0h,6eh,34h
+			db	60h,92h,4bh,e8h,07h,7ch,d5h,f7h
+			db	09h,6bh,68h,83h,42h,c0h,a5h,3fh
+			db	b5h,76h,e9h,57h,7ah,61h,6ah,5eh
+			db	b8h,6ah,dch,32h,bbh,5dh,ceh,51h
+			db	d1h,f6h,b7h,cch,c6h,c9h,25h,33h
+			db	46h,b4h,11h,47h,a7h,0fh,5ch,0dh
+			db	43h,78h,adh,35h,06h,67h,91h,72h
+			db	ech,16h,37h,37h,77h,96h,c1h,bfh
+			db	78h,1fh,ddh,a8h,f3h,1ah,4eh,75h
+			db	4dh,35h,b5h,e8h,21h,e1h,62h,27h
+			db	dch,b2h,bdh,75h,92h,9ah,8ah,feh
+			db	4bh,cdh,5ah,e3h,4ch,deh,f6h,75h
+			db	f4h,c6h,43h,aah,b8h,09h,c7h,7fh
+			db	ffh,feh,90h,1ch,cbh,32h,c4h,66h
+			db	5ch,5dh,0fh,e1h,1eh,a7h,85h,66h
+			db	c1h,49h,0ah,3bh,2fh,32h,3ch,60h
+			db	bch,9ch,57h,f5h,afh,49h,a9h,dah
+			db	6bh,bch,17h,4eh,38h,87h,6bh,1bh
+			db	80h,7ah,1ah,f9h,1ch,d1h,48h,dah
+			db	2eh,c7h,2ah,f2h,9ch,7ch,08h,9dh
+			db	23h,b0h,fbh,83h,8fh,efh,38h,52h
+			db	a7h,04h,48h,29h,62h,6ch,fbh,f0h
+			db	6bh,f0h,c0h,2eh,47h,d6h,d4h,7dh
+			db	89h,43h,fdh,91h,18h,5bh,cah,cbh
+			db	cdh,4fh,0ch,78h,deh,5dh,e9h,b3h
+			db	feh,16h,bfh,47h,bfh,56h,7bh,dfh
+			db	04h,21h,aeh,a7h,d8h,e3h,63h,0ch
+			db	7dh,14h,7ah,25h,1eh,08h,20h,74h
+			db	f3h,76h,88h,d9h,23h,8fh,a4h,69h
+			db	bch,35h,6fh,58h,8fh,4bh,cdh,6dh
+			db	77h,f1h,b5h,d2h,22h,0dh,4dh,5eh
+			db	76h,a8h,37h,5dh,21h,f0h,5eh,89h
+			db	4bh,0fh,deh,3dh,9fh,dch,bah,d6h
+			db	24h,dfh,61h,15h,2dh,93h,47h,89h
+			db	57h,8ch,a3h,f8h,51h,feh,ech,5fh
+			db	61h,37h,9ah,9ah,c1h,b5h,85h,22h
+			db	57h,e3h,59h,a0h,96h,95h,7dh,61h
+			db	e5h,84h,e4h,b6h,5eh,12h,49h,bbh
+			db	a6h,f4h,54h,94h,15h,3ah,26h,73h
+			db	8fh,cbh,3fh,f6h,1fh,e1h,a6h,30h
+			db	f1h,32h,6ah,aeh,d4h,53h,beh,13h
+			db	3bh,e7h,7fh,a6h,d6h,a2h,58h,43h
+			db	5bh,2fh,c3h,11h,d9h,a6h,74h,b5h
+			db	dbh,59h,0eh,38h,53h,24h,30h,c8h
+			db	7dh,26h,bah,edh,a5h,31h,6eh,11h
+			db	a3h,a7h,a1h,bbh,6fh,04h,7fh,75h
+			db	08h,1bh,45h,7dh,a8h,9bh,ffh,01h
+			db	58h,70h,2ah,d6h,beh,a2h,cah,dah
+			db	08h,c5h,21h,02h,e2h,6ch,9ah,64h
+			db	c0h,42h,07h,3dh,fah,73h,57h,8ch
+			db	6dh,ddh,44h,bch,29h,b5h,11h,6bh
+			db	66h,3ah,1ah,13h,18h,beh,9eh,0eh
+			db	2ah,fch,15h,5dh,dbh,63h,2ch,abh
+			db	23h,75h,e3h,f7h,1ch,a2h,90h,4fh
+			db	34h,26h,c3h,96h,45h,e8h,19h,0eh
+			db	d7h,cbh,fch,87h,aeh,efh,c2h,11h
+			db	79h,78h,3dh,8ch,88h,04h,a7h,75h
+			db	a1h,18h,85h,74h,03h,b4h,76h,a1h
+			db	ebh,fah,96h,3ch,d0h,beh,9bh,9ah
+			db	84h,4bh,f8h,86h,b9h,7ah,bch,f5h
+			db	16h,dbh,1eh,94h,cfh,adh,63h,71h
+			db	c1h,c2h,38h,e1h,9bh,3bh,b6h,cfh
+			db	16h,7dh,c2h,24h,e4h,ebh,a0h,44h
+			db	4bh,d7h,0bh,efh,4eh,fch,7ah,19h
+			db	80h,83h,efh,ech,fdh,c0h,a3h,3fh
+			db	38h,9dh,3bh,45h,2eh,41h,69h,35h
+			db	b8h,07h,ffh,cch,b8h,0ch,23h,d9h
+			db	bbh,1ah,72h,64h,54h,d9h,5dh,c9h
+			db	3ch,45h,b5h,47h,0bh,13h,7ah,5fh
+			db	56h,4ch,99h,d2h,87h,3eh,a8h,2eh
+			db	35h,fah,feh,edh,6ch,40h,ach,80h
+			db	89h,1bh,53h,33h,d4h,b0h,8ch,3eh
+			db	cch,22h,d2h,80h,cfh,12h,7ch,92h
+			db	cbh,35h,4dh,39h,ebh,2bh,98h,0fh
+			db	2bh,e1h,1eh,e0h,5dh,7dh,f2h,09h
+			db	0dh,3bh,d3h,69h,1bh,60h,c4h,39h
+			db	bch,cbh,10h,12h,c2h,ech,2ch,adh
+			db	29h,63h,ech,e4h,fbh,29h,fdh,29h
+			db	e8h,89h,18h,a1h,1dh,8bh,edh,5ah
+			db	3fh,cdh,e9h,1bh,6bh,abh,fch,80h
+			db	65h,ddh,fah,0dh,9dh,23h,a8h,54h
+			db	18h,67h,b6h,87h,7fh,67h,08h,10h
+			db	d0h,05h,59h,cah,7eh,dah,24h,52h
+			db	0eh,abh,f6h,cfh,83h,80h,73h,f0h
+			db	4ch,89h,d5h,f0h,c6h,4ah,94h,93h
+			db	6ch,cbh,47h,11h,c9h,09h,41h,23h
+			db	abh,d2h,69h,b2h,45h,09h,7fh,5fh
+			db	fah,10h,0bh,39h,0eh,2ah,89h,a9h
+			db	e2h,6fh,c1h,7dh,02h,17h,8eh,bbh
+			db	74h,c7h,a6h,dah,feh,78h,56h,7bh
+			db	54h,66h,d9h,d6h,07h,d3h,d1h,0bh
+			db	3eh,0dh,bfh,3eh,3bh,0fh,82h,08h
+			db	64h,a6h,56h,efh,1fh,36h,aeh,a0h
+			db	63h,c0h,3bh,3ah,0ah,cah,5fh,08h
+			db	f4h,62h,75h,04h,59h,68h,a8h,40h
+			db	9eh,8eh,16h,bbh,ddh,95h,8bh,13h
+			db	91h,14h,30h,dfh,94h,4ch,28h,34h
+			db	0ch,b7h,11h,95h,6ah,bfh,d1h,08h
+			db	9bh,f0h,a2h,2fh,1dh,34h,24h,7ah
+			db	5bh,afh,93h,ach,0fh,91h,c5h,0dh
+			db	4bh,eah,c4h,95h,35h,32h,43h,f2h
+			db	6eh,dbh,d2h,e3h,06h,feh,55h,d6h
+			db	bfh,d1h,efh,61h,0eh,cch,bch,c6h
+			db	03h,dfh,6fh,2eh,0dh,12h,f0h,f2h
+			db	2ah,96h,45h,e1h,a2h,85h,76h,3bh
+			db	4bh,d7h,80h,83h,36h,23h,98h,04h
+			db	c7h,d2h,10h,beh,92h,36h,84h,09h
+			db	cfh,1fh,4bh,72h,56h,04h,89h,dch
+			db	deh,94h,0bh,42h,09h,18h,ffh,48h
+			db	70h,a2h,e0h,17h,c1h,38h,51h,cfh
+			db	b5h,6ah,b8h,e5h,8dh,78h,ech,9eh
+			db	bbh,57h,e3h,f3h,85h,d4h,89h,f8h
+			db	6dh,cfh,4eh,fah,52h,cfh,f3h,c2h
+			db	63h,95h,c1h,52h,a0h,97h,c1h,6ch
+			db	b5h,89h,11h,60h,74h,aeh,5bh,a0h
+			db	06h,92h,09h,d8h,26h,1ch,7ah,8ah
+			db	26h,36h,3bh,e7h,eah,5fh,d9h,f8h
+			db	88h,7ch,8ch,a4h,14h,03h,61h,87h
+			db	11h,82h,00h,40h,2eh,75h,35h,6bh
+			db	5ah,80h,8ah,ceh,d6h,6eh,9fh,c1h
+			db	e5h,afh,31h,87h,97h,98h,beh,18h
+			db	e7h,e0h,ebh,86h,92h,d9h,11h,beh
+			db	89h,25h,18h,ceh,79h,47h,0ah,44h
+			db	96h,29h,e6h,12h,51h,a5h,45h,6fh
+			db	34h,d8h,3fh,f3h,70h,bbh,0eh,b9h
+			db	dfh,07h,f9h,e2h,2dh,62h,83h,c8h
+			db	6bh,57h,0eh,f4h,4fh,feh,c4h,cah
+			db	1ch,2fh,f3h,b7h,3dh,2fh,f9h,fdh
+			db	e9h,e2h,feh,c4h,1ah,63h,e1h,48h
+			db	8bh,32h,adh,3dh,f6h,32h,85h,23h
+			db	64h,a0h,dfh,55h,3eh,c3h,2eh,9fh
+			db	3bh,48h,beh,f5h,23h,96h,13h,4eh
+			db	a1h,99h,0ah,fah,ddh,35h,64h,6ah
+			db	0bh,21h,3bh,90h,54h,30h,79h,65h
+			db	8ch,fbh,8fh,12h,0bh,dfh,4ah,afh
+			db	dfh,51h,3bh,b8h,a5h,4fh,f6h,e9h
+			db	27h,46h,19h,78h,3eh,59h,75h,90h
+			db	b8h,49h,46h,cdh,0bh,16h,44h,50h
+			db	cah,eah,cch,d0h,fch,e7h,f1h,96h
+			db	cfh,dfh,06h,cbh,6ch,84h,64h,f1h
+			db	a1h,d5h,e7h,cfh,80h,b2h,34h,fbh
+			db	f3h,a2h,66h,4fh,aah,2dh,3bh,87h
+			db	ffh,26h,0ch,ddh,55h,6ch,48h,19h
+			db	3dh,e1h,62h,41h,e5h,b4h,41h,aeh
+			db	36h,dch,b2h,e8h,05h,44h,dch,b9h
+			db	67h,b1h,2dh,d6h,f3h,8dh,dch,6ch
+			db	7dh,72h,c4h,6ah,9bh,c1h,28h,e0h
+			db	18h,09h,46h,54h,8ah,5ch,67h,65h
+			db	3ch,27h,33h,58h,15h,55h,f5h,2dh
+			db	4bh,c2h,89h,46h,d0h,7eh,3fh,f3h
+			db	a6h,efh,38h,5bh,f9h,c1h,4bh,c0h
+			db	28h,adh,3fh,a1h,78h,b8h,91h,70h
+			db	e5h,0fh,8fh,feh,b9h,ceh,6ah,abh
+			db	8ch,2fh,24h,56h,22h,36h,15h,4bh
+			db	07h,8dh,f9h,f5h,04h,6ah,b5h,2ah
+			db	e8h,10h,fah,7ch,aeh,60h,c3h,2eh
+			db	97h,4ch,a4h,83h,afh,f3h,6fh,36h
+			db	6fh,a2h,8ch,49h,41h,e5h,d1h,34h
+			db	50h,bbh,b8h,2eh,89h,0fh,3eh,e7h
+			db	c3h,04h,71h,8fh,3ah,8eh,bah,46h
+			db	56h,32h,00h,b9h,aah,2ch,b2h,4ah
+			db	47h,92h,dch,e9h,bah,6dh,05h,48h
+			db	43h,49h,33h,a9h,fch,94h,57h,5bh
+			db	19h,ech,04h,a1h,ceh,bah,b1h,01h
+			db	4fh,cdh,60h,19h,54h,ddh,cbh,9bh
+			db	4ah,3eh,9eh,77h,a1h,b8h,b9h,71h
+			db	e3h,00h,7ah,c5h,33h,efh,11h,3bh
+			db	92h,4eh,f7h,31h,ceh,e5h,8bh,9ah
+			db	c7h,2eh,5bh,b1h,14h,a1h,89h,03h
+			db	c4h,f3h,22h,33h,7dh,7dh,77h,8ch
+			db	7ah,4ch,f9h,d5h,43h,e1h,07h,51h
+			db	4ch,95h,ceh,47h,68h,76h,9ah,d9h
+			db	dah,11h,bfh,b7h,39h,f4h,fah,c2h
+			db	eah,5eh,19h,ceh,16h,bah,61h,08h
+			db	fah,67h,e3h,22h,99h,f1h,05h,4dh
+			db	4bh,efh,51h,76h,65h,4bh,b9h,3ah
+			db	54h,a2h,00h,5eh,1ch,b1h,dfh,82h
+			db	fah,25h,31h,b0h,a2h,ddh,dfh,a6h
+			db	32h,12h,65h,96h,cch,6bh,f1h,f1h
+			db	6dh,99h,96h,4fh,c3h,c0h,f5h,22h
+			db	dch,56h,eeh,c0h,4dh,b6h,cch,e6h
+			db	42h,a1h,deh,44h,54h,d8h,e1h,c6h
+			db	44h,dbh,c4h,6dh,73h,beh,ebh,eah
+			db	cah,ach,78h,4ch,0bh,f0h,a7h,f4h
+			db	90h,dch,2dh,9bh,2ch,0bh,92h,60h
+			db	2ch,74h,76h,45h,5bh,22h,35h,61h
+			db	12h,3ah,a3h,aeh,f0h,2eh,80h,6bh
+			db	b6h,77h,2fh,9bh,21h,98h,88h,68h
+			db	23h,b8h,54h,3eh,83h,e1h,d9h,8fh
+			db	14h,aeh,a7h,23h,84h,2ah,34h,afh
+			db	12h,e0h,7eh,84h,f0h,f9h,42h,e7h
+			db	dah,63h,68h,55h,44h,62h,22h,0ah
+			db	dfh,b3h,8fh,d1h,98h,97h,81h,abh
+			db	99h,31h,1dh,c9h,c9h,9ah,0dh,0ch
+			db	49h,77h,c3h,9ch,24h,a9h,15h,bdh
+			db	fch,9bh,98h,8ch,e8h,c8h,15h,cbh
+			db	91h,6dh,7dh,c1h,6fh,ceh,f0h,89h
+			db	88h,79h,f5h,e2h,f1h,75h,26h,c9h
+			db	f6h,b0h,49h,d4h,fdh,b7h,e1h,38h
+			db	ddh,69h,90h,f8h,25h,ebh,d8h,78h
+			db	1fh,6eh,cdh,18h,a9h,0bh,22h,82h
+			db	fdh,ech,9ah,9eh,64h,53h,0eh,11h
+			db	d8h,61h,f9h,10h,33h,e2h,21h,61h
+			db	16h,bfh,30h,a0h,f1h,d6h,95h,feh
+			db	9ch,feh,25h,e6h,fah,08h,a4h,d5h
+			db	b1h,1ah,43h,b9h,bdh,e6h,cah,d4h
+			db	c5h,6bh,a5h,f3h,aeh,88h,59h,cdh
+			db	63h,cfh,43h,60h,c6h,18h,01h,5bh
+			db	28h,b9h,a2h,bch,00h,09h,ebh,22h
+			db	b0h,d7h,f7h,a8h,d4h,7ch,17h,6eh
+			db	ceh,aah,4ch,9eh,a1h,c1h,c3h,5fh
+			db	72h,a8h,ech,2dh,7ah,12h,5eh,ebh
+			db	1dh,e1h,fbh,d6h,ddh,3fh,69h,96h
+			db	a3h,eeh,21h,09h,eah,a5h,94h,fah
+			db	eeh,c8h,7bh,85h,f6h,b5h,ffh,12h
+			db	e0h,e1h,99h,01h,cah,59h,0dh,e5h
+			db	6ah,25h,f8h,06h,1dh,85h,b7h,12h
+			db	9eh,a6h,68h,ech,edh,29h,beh,e0h
+			db	63h,62h,ebh,68h,96h,47h,a6h,5ah
+			db	d6h,3fh,d4h,a5h,deh,b5h,79h,0bh
+			db	74h,9ch,33h,c6h,11h,79h,01h,50h
+			db	f7h,c7h,f5h,7ch,37h,9eh,bch,ddh
+			db	04h,98h,57h,53h,42h,18h,53h,31h
+			db	47h,94h,70h,aeh,7ch,e8h,56h,19h
+			db	64h,aeh,d8h,60h,d7h,a0h,1fh,47h
+			db	f1h,1fh,61h,15h,5ah,e6h,05h,6ah
+			db	a9h,36h,87h,8ch,20h,81h,b7h,34h
+			db	43h,72h,69h,32h,ebh,85h,66h,97h
+			db	5fh,dah,5fh,e7h,1bh,03h,8fh,d5h
+			db	57h,a2h,f2h,37h,e6h,bch,9dh,5bh
+			db	e1h,83h,4dh,a8h,50h,e6h,73h,14h
+			db	bdh,27h,bdh,8fh,e2h,9dh,1fh,b3h
+			db	00h,0dh,e9h,efh,1bh,e2h,3ch,38h
+			db	52h,31h,73h,92h,8dh,44h,c3h,9ch
+			db	6fh,52h,37h,dfh,44h,e5h,4fh,1bh
+			db	d5h,59h,60h,21h,bdh,f6h,9eh,dfh
+			db	bdh,9dh,a1h,e1h,12h,46h,82h,61h
+			db	e6h,09h,71h,12h,f9h,b9h,29h,b0h
+			db	7fh,cch,65h,3fh,27h,45h,0bh,5ah
+			db	69h,a3h,a1h,5ch,f6h,4ah,28h,69h
+			db	17h,13h,2ch,ffh,feh,c7h,b4h,96h
+			db	c1h,9fh,69h,06h,f7h,fah,3ch,d6h
+			db	81h,1eh,3dh,cbh,4ah,e4h,bbh,8eh
+			db	22h,beh,eeh,2dh,12h,fch,9eh,01h
+			db	3bh,e6h,28h,c6h,f4h,52h,78h,7bh
+			db	e6h,5bh,3ch,71h,4bh,80h,10h,e9h
+			db	d0h,6eh,4eh,76h,90h,d1h,53h,34h
+			db	76h,62h,cfh,03h,0fh,11h,6ch,72h
+			db	abh,deh,e5h,07h,3bh,efh,2dh,f6h
+			db	b2h,83h,27h,89h,bah,02h,c6h,71h
+			db	e6h,76h,e6h,05h,59h,49h,b0h,cbh
+			db	bah,fah,7fh,99h,a9h,87h,0ch,c0h
+			db	eah,fch,c6h,36h,5ch,9ah,4dh,2ah
+			db	90h,3ah,d1h,3ch,afh,5dh,3bh,e1h
+			db	87h,3ah,17h,f0h,4fh,c1h,47h,dch
+			db	55h,a3h,52h,c1h,f6h,5bh,a4h,e1h
+			db	7bh,01h,4eh,45h,2fh,56h,65h,83h
+			db	33h,33h,9dh,19h,74h,30h,43h,3dh
+			db	4ch,3ch,18h,6ah,7eh,18h,12h,42h
+			db	35h,45h,ffh,bbh,8dh,01h,dah,b7h
+			db	9dh,b6h,85h,59h,d3h,ebh,7dh,6bh
+			db	39h,a0h,2bh,9ch,72h,04h,4ah,d1h
+			db	beh,d6h,21h,24h,9eh,5ah,5ah,e5h
+			db	25h,a1h,d3h,49h,56h,f7h,65h,e1h
+			db	f5h,17h,50h,8fh,e0h,a9h,76h,8eh
+			db	6fh,88h,0ch,6bh,4fh,d5h,d4h,77h
+			db	c2h,96h,2ch,fdh,a0h,3bh,10h,fch
+			db	88h,f1h,bbh,bdh,6bh,9bh,e6h,71h
+			db	60h,1bh,47h,a1h,a5h,d7h,a1h,19h
+			db	ddh,d5h,a7h,b1h,e7h,63h,67h,a3h
+			db	68h,02h,42h,48h,cch,b5h,86h,f5h
+			db	77h,a0h,72h,7fh,79h,4eh,50h,f7h
+			db	28h,34h,29h,91h,a2h,2fh,15h,80h
+			db	edh,3eh,63h,16h,a5h,d4h,98h,64h
+			db	7ch,bbh,04h,16h,a8h,bdh,48h,f8h
+			db	ddh,7eh,7bh,2ch,32h,54h,4ch,eeh
+			db	72h,91h,38h,cdh,beh,fdh,01h,afh
+			db	83h,9bh,29h,2fh,deh,88h,0ch,bdh
+			db	f5h,95h,d4h,ffh,d2h,c6h,5dh,ebh
+			db	a8h,c7h,33h,76h,8ch,d4h,4eh,07h
+			db	01h,f8h,d3h,3fh,96h,41h,06h,5ah
+			db	c4h,30h,1dh,f1h,6eh,eah,95h,1fh
+			db	00h,59h,7bh,e5h,edh,22h,beh,6eh
+			db	d1h,41h,5ah,e6h,b0h,6bh,5bh,68h
+			db	4eh,35h,bch,b0h,7ah,91h,67h,17h
+			db	edh,b7h,31h,03h,5fh,7eh,c0h,a1h
+			db	36h,88h,efh,97h,a0h,b9h,6ah,aah
+			db	1bh,d7h,c1h,68h,82h,3eh,7fh,94h
+			db	45h,15h,c6h,c9h,16h,cah,75h,0dh
+			db	0bh,ceh,32h,6dh,ddh,bch,1eh,74h
+			db	b8h,80h,67h,91h,8bh,7ch,81h,1bh
+			db	a2h,d1h,c9h,adh,dfh,cdh,0ah,4ah
+			db	45h,c0h,3ah,24h,08h,aeh,81h,08h
+			db	b3h,65h,0ch,68h,72h,2fh,84h,bah
+			db	a4h,2ch,c4h,afh,5fh,21h,d4h,c3h
+			db	bah,a5h,ach,60h,adh,72h,03h,fah
+			db	bah,85h,a8h,90h,33h,a1h,1ch,0dh
+			db	f9h,52h,15h,b1h,11h,86h,27h,4fh
+			db	5fh,45h,59h,47h,dfh,78h,aeh,0eh
+			db	5eh,f3h,49h,11h,0dh,dch,e0h,efh
+			db	8ch,3bh,3ch,b2h,42h,2ch,4bh,9ch
+			db	b8h,94h,0eh,fah,a4h,91h,54h,29h
+			db	c1h,f8h,4dh,84h,feh,b2h,c9h,10h
+			db	ddh,e3h,2eh,f5h,52h,f5h,a3h,08h
+			db	52h,0fh,88h,5dh,78h,55h,22h,dch
+			db	55h,b1h,94h,d6h,8bh,41h,a1h,4eh
+			db	feh,62h,60h,73h,f1h,72h,64h,53h
+			db	8fh,e5h,2fh,88h,84h,63h,32h,50h
+			db	50h,e5h,eah,0ch,52h,9ch,e1h,56h
+			db	a6h,36h,b2h,9ch,f6h,62h,03h,93h
+			db	efh,dah,0ah,b3h,f2h,70h,96h,23h
+			db	5ah,40h,5eh,f3h,b9h,11h,79h,0eh
+			db	b5h,dch,5fh,8eh,54h,beh,f2h,abh
+			db	1bh,82h,feh,3dh,58h,afh,c8h,3bh
+			db	8bh,08h,c8h,6eh,e1h,edh,57h,f6h
+			db	1ah,b9h,c3h,deh,70h,dch,53h,90h
+			db	93h,cbh,ebh,bbh,20h,f2h,e5h,d8h
+			db	f4h,46h,7dh,42h,cch,83h,bah,a9h
+			db	8eh,b1h,a3h,eah,efh,83h,afh,bch
+			db	23h,54h,e8h,49h,01h,a5h,68h,1ah
+			db	29h,93h,a5h,d6h,dah,c6h,34h,d4h
+			db	2eh,39h,79h,2dh,3ah,40h,9bh,5bh
+			db	53h,21h,5bh,13h,36h,e5h,9bh,58h
+			db	b1h,6dh,c0h,ach,bdh,3ah,45h,26h
+			db	30h,40h,97h,2ah,49h,3eh,96h,4ch
+			db	1fh,5dh,44h,d1h,4dh,e1h,78h,96h
+			db	f4h,c1h,e8h,b8h,9bh,7eh,d1h,9dh
+			db	50h,eah,13h,79h,dbh,9ah,cah,10h
+			db	bch,72h,57h,c8h,d1h,dfh,f4h,26h
+			db	f7h,c5h,1bh,52h,6ch,75h,94h,e7h
+			db	83h,77h,a3h,73h,49h,27h,52h,0eh
+			db	7eh,5eh,d6h,b9h,4bh,feh,c3h,52h
+			db	e8h,9bh,fch,c0h,3eh,2dh,dfh,08h
+			db	27h,e6h,44h,d4h,5fh,9fh,f4h,a6h
+			db	29h,36h,57h,e0h,dfh,b5h,c0h,50h
+			db	56h,90h,20h,a3h,d9h,f8h,59h,c4h
+			db	0ah,e9h,17h,8bh,b9h,00h,58h,31h
+			db	d8h,4eh,34h,4ah,dbh,72h,f7h,d5h
+			db	80h,f6h,5bh,88h,7fh,12h,13h,75h
+			db	bch,6ah,dah,f6h,40h,99h,f1h,59h
+			db	34h,52h,fah,63h,a7h,3ah,b9h,70h
+			db	f5h,d8h,65h,aeh,1fh,06h,64h,f3h
+			db	f3h,56h,ffh,bbh,4bh,50h,c9h,39h
+			db	7bh,1eh,f0h,1bh,68h,78h,65h,e8h
+			db	2eh,81h,f5h,19h,ceh,d6h,57h,99h
+			db	3ah,ffh,ceh,4ah,29h,12h,37h,a0h
+			db	9ch,22h,24h,98h,72h,bch,d4h,93h
+			db	f1h,a2h,58h,42h,cah,9dh,d8h,79h
+			db	89h,3ch,62h,d6h,f3h,14h,94h,9dh
+			db	03h,77h,8ah,14h,a1h,69h,deh,feh
+			db	f0h,02h,cfh,fch,dbh,e1h,67h,dah
+			db	59h,e6h,7ch,3ah,fah,f1h,65h,74h
+			db	e2h,17h,c1h,94h,63h,fah,c1h,69h
+			db	53h,61h,1ah,50h,97h,40h,e4h,80h
+			db	88h,98h,03h,7dh,42h,7dh,19h,6fh
+			db	90h,2ch,1ch,5fh,07h,0fh,6ch,6eh
+			db	60h,68h,ffh,e0h,b8h,3ch,1dh,e5h
+			db	0fh,a2h,7ch,b1h,abh,7dh,4ch,b3h
+			db	28h,e2h,4eh,2dh,32h,24h,8bh,7fh
+			db	b4h,04h,c3h,ffh,12h,98h,cdh,e1h
+			db	70h,06h,08h,dah,25h,41h,94h,1ch
+			db	81h,b0h,a6h,e7h,22h,50h,b3h,a0h
+			db	87h,48h,34h,e8h,7ch,7bh,74h,fdh
+			db	4eh,abh,b7h,21h,ach,ffh,77h,a8h
+			db	45h,70h,49h,aah,52h,73h,19h,31h
+			db	74h,10h,4ch,22h,24h,9ah,dbh,bch
+			db	fah,c3h,82h,bfh,08h,04h,0bh,9bh
+			db	8bh,8ah,0dh,f0h,61h,95h,20h,5eh
+			db	a3h,35h,20h,43h,b0h,81h,72h,e4h
+			db	c6h,07h,6eh,92h,38h,99h,6ch,5dh
+			db	89h,84h,d6h,68h,27h,a0h,67h,7dh
+			db	ceh,b5h,2eh,72h,cdh,c9h,b4h,bah
+			db	9ch,44h,04h,7ch,96h,b9h,6ah,beh
+			db	b1h,69h,83h,05h,36h,49h,48h,80h
+			db	5ch,5ch,44h,dbh,79h,5ch,fbh,92h
+			db	0fh,d1h,21h,cch,4eh,c3h,92h,90h
+			db	f5h,39h,99h,aah,ech,fdh,0ch,1bh
+			db	abh,d0h,27h,6dh,55h,a4h,7fh,85h
+			db	6dh,9bh,6dh,b1h,9bh,8ch,e7h,a1h
+			db	98h,a9h,9ch,94h,6fh,d9h,26h,9bh
+			db	42h,6ah,97h,d0h,e6h,7eh,2bh,b0h
+			db	81h,bdh,dch,c3h,9eh,ffh,93h,18h
+			db	d0h,9bh,14h,48h,0eh,1eh,25h,8dh
+			db	08h,01h,8fh,cdh,e5h,f4h,afh,9dh
+			db	35h,89h,2dh,ebh,ebh,a2h,07h,6bh
+			db	d5h,34h,e1h,0eh,d8h,2ch,c8h,23h
+			db	2dh,68h,3eh,f9h,a3h,b7h,08h,22h
+			db	78h,1dh,64h,15h,dch,7eh,65h,6bh
+			db	98h,94h,a7h,43h,1ch,83h,bah,edh
+			db	05h,b8h,7eh,afh,65h,b6h,33h,96h
+			db	cdh,fch,feh,b4h,3fh,bdh,c7h,57h
+			db	27h,d1h,8fh,08h,35h,f9h,9ch,90h
+			db	20h,1ch,98h,0eh,62h,65h,eeh,fbh
+			db	b8h,c2h,91h,1bh,bah,42h,2bh,07h
+			db	f3h,7bh,c2h,51h,6eh,02h,0ch,d3h
+			db	a5h,27h,d1h,ddh,d1h,50h,2fh,95h
+			db	e9h,8eh,42h,36h,cah,b4h,82h,4eh
+			db	94h,deh,eah,fbh,f5h,d4h,b2h,4eh
+			db	10h,e4h,ceh,99h,e1h,a0h,c7h,9ah
+			db	74h,b6h,59h,7ah,dch,b7h,fah,a7h
+			db	24h,00h,4bh,e0h,abh,46h,28h,c0h
+			db	79h,d0h,22h,59h,29h,79h,50h,e8h
+			db	c3h,b2h,70h,45h,28h,eah,46h,ffh
+			db	70h,3eh,fbh,63h,0fh,54h,feh,d6h
+			db	e1h,e2h,d3h,ach,1dh,2bh,8eh,40h
+			db	6eh,6eh,e9h,84h,75h,6ah,91h,06h
+			db	9fh,35h,beh,fah,08h,bbh,efh,23h
+			db	20h,c3h,eah,c2h,22h,edh,b3h,33h
+			db	71h,f3h,c8h,73h,42h,28h,29h,e9h
+			db	22h,dch,6ch,64h,b7h,63h,9eh,e8h
+			db	93h,d2h,55h,23h,09h,a6h,6ch,a2h
+			db	f0h,40h,23h,90h,52h,0bh,97h,09h
+			db	d2h,4bh,e7h,43h,f9h,b3h,e1h,e8h
+			db	c4h,0fh,79h,04h,c6h,afh,dah,cfh
+			db	23h,b9h,bbh,e4h,d9h,16h,0fh,0eh
+			db	a9h,56h,7ah,2bh,fdh,f9h,6dh,9ch
+			db	e7h,92h,65h,c8h,05h,cah,f0h,95h
+			db	82h,74h,31h,fah,65h,cfh,75h,c5h
+			db	b3h,72h,1ch,a8h,bah,7ah,37h,cah
+			db	57h,ebh,82h,69h,21h,eah,fdh,f8h
+			db	ffh,82h,1dh,68h,34h,67h,62h,ddh
+			db	89h,36h,d5h,9bh,dbh,63h,fch,ach
+			db	9eh,38h,e9h,80h,47h,4ch,d0h,c2h
+			db	a2h,73h,64h,f0h,34h,fah,1eh,d3h
+			db	3eh,29h,0ah,07h,aah,77h,13h,60h
+			db	46h,abh,5ah,2ch,5ah,fah,bah,0ah
+			db	e0h,09h,c7h,b5h,c9h,7ah,75h,2dh
+			db	64h,f0h,64h,7eh,38h,7dh,68h,5fh
+			db	77h,07h,5eh,dbh,a5h,1ch,6bh,52h
+			db	2bh,2bh,0ah,77h,b1h,16h,08h,72h
+			db	05h,3bh,d0h,89h,49h,7dh,c1h,83h
+			db	20h,a0h,31h,c2h,19h,e8h,08h,3eh
+			db	4bh,25h,54h,aah,1dh,dfh,5dh,93h
+			db	51h,02h,94h,8bh,64h,8bh,83h,ech
+			db	98h,41h,83h,5eh,eah,f9h,15h,31h
+			db	4ch,d4h,fah,9fh,12h,16h,61h,ceh
+			db	2ch,58h,97h,18h,49h,3fh,cch,ffh
+			db	1bh,fch,aah,62h,33h,d0h,17h,96h
+			db	32h,a6h,3fh,a7h,92h,e6h,dbh,0dh
+			db	1fh,7ch,8fh,39h,2eh,2dh,e3h,9eh
+			db	47h,fbh,9bh,43h,e7h,21h,b6h,94h
+			db	c0h,e8h,19h,b8h,67h,47h,21h,08h
+			db	29h,09h,61h,8bh,31h,49h,a4h,77h
+			db	4bh,79h,fdh,b9h,97h,8bh,36h,52h
+			db	8bh,c0h,41h,6fh,7fh,aah,ddh,04h
+			db	b9h,1ah,c9h,feh,45h,44h,7dh,7ah
+			db	76h,14h,e2h,0ch,e5h,a3h,7fh,b7h
+			db	a5h,b1h,c6h,b9h,b4h,a1h,66h,a8h
+			db	2bh,72h,1fh,dah,c0h,23h,1ch,c3h
+			db	70h,3fh,87h,ddh,65h,3bh,ddh,76h
+			db	d1h,d2h,a4h,00h,d5h,d1h,54h,fbh
+			db	7fh,3bh,52h,c0h,30h,d3h,35h,59h
+			db	44h,89h,9ah,b3h,7fh,4bh,05h,9bh
+			db	46h,0bh,4ah,eeh,83h,97h,b3h,14h
+			db	0ch,01h,9eh,b5h,44h,5fh,63h,9dh
+			db	b9h,43h,45h,5eh,f3h,1ah,4bh,74h
+			db	d9h,cch,4dh,e2h,ach,3eh,6dh,09h
+			db	8ah,11h,37h,a8h,7ah,0eh,86h,4bh
+			db	89h,b8h,75h,fbh,e5h,84h,4ch,bbh
+			db	9fh,03h,1ah,c1h,3bh,f1h,adh,cbh
+			db	bah,d2h,60h,4ch,ddh,70h,16h,fdh
+			db	6fh,49h,2ah,79h,10h,95h,00h,6dh
+			db	52h,8fh,62h,beh,35h,bdh,c0h,abh
+			db	41h,bah,4dh,afh,5eh,c5h,62h,70h
+			db	54h,c5h,5ah,7fh,48h,26h,e9h,fah
+			db	1eh,c7h,b5h,5dh,e6h,3ch,69h,e8h
+			db	afh,cdh,9ch,a3h,34h,12h,d5h,deh
+			db	1ch,3ch,3dh,adh,f3h,e4h,e3h,94h
+			db	e6h,a9h,e5h,11h,59h,2eh,e2h,3dh
+			db	42h,4fh,a5h,0eh,57h,4bh,48h,e8h
+			db	bbh,39h,3eh,2fh,9fh,f1h,51h,1dh
+			db	0dh,0dh,c0h,74h,a4h,98h,18h,3fh
+			db	b9h,16h,f3h,5dh,38h,09h,3dh,c2h
+			db	c8h,cdh,74h,8dh,fah,d8h,47h,61h
+			db	63h,c1h,6ch,f1h,77h,cah,8eh,edh
+			db	d9h,56h,e2h,50h,a7h,9ch,33h,32h
+			db	5fh,8dh,5dh,28h,c4h,66h,86h,dfh
+			db	dfh,a3h,fdh,40h,fch,58h,2dh,20h
+			db	1bh,7fh,56h,ffh,54h,87h,a5h,b9h
+			db	b8h,19h,41h,35h,68h,5dh,9bh,ach
+			db	3bh,95h,70h,c8h,fbh,dbh,65h,b7h
+			db	71h,0bh,58h,ffh,7dh,a3h,10h,75h
+			db	12h,34h,20h,d6h,d8h,18h,afh,2ah
+			db	9eh,3bh,b3h,a1h,99h,3ch,97h,21h
+			db	dah,afh,58h,0dh,2fh,f2h,12h,6dh
+			db	ach,adh,8eh,54h,07h,90h,4fh,0dh
+			db	a5h,38h,2eh,fch,e7h,8bh,53h,92h
+			db	d6h,5ch,01h,f6h,cdh,26h,4bh,cbh
+			db	4ch,7ah,87h,abh,41h,3fh,2bh,5dh
+			db	0ah,a2h,12h,d9h,d4h,71h,d1h,e2h
+			db	7dh,7ch,32h,20h,50h,b7h,b1h,94h
+			db	74h,72h,f3h,d8h,56h,34h,3ch,f0h
+			db	f3h,fbh,07h,aeh,0fh,c3h,46h,fah
+			db	67h,88h,7eh,65h,45h,e7h,6ch,b4h
+			db	ffh,87h,34h,8ch,eah,f2h,53h,1fh
+			db	bah,7eh,6eh,0eh,9ch,63h,00h,96h
+			db	67h,cdh,02h,eeh,d2h,68h,8bh,f6h
+			db	72h,34h,98h,79h,9bh,aah,15h,a5h
+			db	f8h,b8h,fch,58h,eeh,45h,55h,70h
+			db	1bh,fch,64h,52h,3ch,10h,5fh,3bh
+			db	d3h,a1h,2bh,beh,79h,e5h,8fh,6ch
+			db	02h,0dh,86h,54h,45h,f0h,f9h,ffh
+			db	81h,69h,96h,7ch,62h,f7h,1ch,fah
+			db	bbh,04h,cfh,7dh,6ah,5dh,19h,ech
+			db	c0h,5ch,08h,8eh,75h,73h,7dh,7ah
+			db	3dh,43h,44h,2bh,4ah,e4h,92h,83h
+			db	67h,ddh,99h,dfh,17h,81h,41h,63h
+			db	27h,efh,36h,58h,1bh,bbh,b8h,77h
+			db	39h,03h,06h,c7h,5bh,84h,ddh,54h
+			db	80h,f0h,a1h,8bh,0bh,03h,92h,35h
+			db	7ch,6fh,6ch,f7h,01h,fah,84h,e0h
+			db	44h,19h,e0h,13h,0bh,48h,d4h,e3h
+			db	f5h,f8h,7fh,afh,e7h,10h,a6h,57h
+			db	3bh,1eh,46h,b2h,ech,f5h,6ah,31h
+			db	82h,45h,d6h,99h,0ah,7fh,02h,7bh
+			db	ebh,60h,b5h,ebh,6bh,4ch,3ah,3fh
+			db	90h,5eh,dah,78h,bdh,8ch,05h,dfh
+			db	79h,b7h,5eh,d5h,05h,86h,bah,8dh
+			db	e3h,6ch,2eh,abh,c2h,d1h,c7h,deh
+			db	7dh,b5h,efh,3fh,5dh,eeh,a0h,0bh
+			db	55h,d0h,27h,60h,47h,7bh,86h,02h
+			db	48h,77h,c6h,d2h,0ch,1fh,ddh,7dh
+			db	44h,c9h,1eh,10h,67h,a9h,16h,a4h
+			db	bah,7dh,f7h,f2h,67h,f0h,c8h,cdh
+			db	fbh,9ch,9eh,f7h,84h,f5h,21h,66h
+			db	56h,43h,7eh,03h,4eh,79h,33h,bfh
+			db	0eh,8ch,fch,cfh,10h,6ah,f2h,53h
+			db	58h,a8h,ech,4fh,12h,61h,8dh,47h
+			db	00h,d8h,f6h,43h,65h,3bh,22h,18h
+			db	35h,d8h,c1h,e9h,77h,7ch,29h,b2h
+			db	dfh,71h,33h,f2h,53h,98h,cdh,f3h
+			db	04h,afh,55h,0fh,e9h,c3h,b8h,10h
+			db	89h,61h,9bh,77h,74h,d8h,e1h,71h
+			db	e9h,9bh,6dh,fch,aah,eah,c9h,b4h
+			db	44h,31h,35h,f4h,0ah,dbh,f3h,f0h
+			db	f3h,2dh,d8h,1eh,96h,88h,5bh,18h
+			db	79h,cfh,d4h,4eh,a1h,2ch,1bh,04h
+			db	49h,e0h,c2h,c6h,b7h,30h,43h,c7h
+			db	e9h,44h,dah,09h,53h,ebh,0dh,fdh
+			db	0fh,40h,1eh,65h,5ch,59h,f4h,b4h
+			db	47h,32h,00h,cdh,d0h,c7h,fbh,2bh
+			db	a5h,e3h,8eh,e8h,d6h,e9h,14h,59h
+			db	c9h,d3h,19h,a0h,b0h,56h,13h,cbh
+			db	0ch,b3h,d3h,b4h,a1h,6ah,9bh,c6h
+			db	1bh,20h,8ah,20h,e0h,5dh,34h,1ah
+			db	09h,c3h,8bh,25h,67h,b7h,51h,05h
+			db	e1h,92h,86h,a6h,84h,1eh,46h,1eh
+			db	69h,feh,f7h,0ch,2eh,c6h,f6h,d4h
+			db	07h,d8h,cch,cfh,b1h,a9h,24h,e7h
+			db	3eh,77h,d9h,d7h,07h,53h,89h,d7h
+			db	00h,d5h,2fh,5ah,e9h,d5h,3fh,7ah
+			db	5ah,cdh,15h,3ah,b5h,70h,c1h,54h
+			db	47h,d2h,f2h,1fh,dbh,87h,3fh,eah
+			db	dfh,2ch,c6h,8ah,5ch,9bh,18h,2eh
+			db	d9h,50h,ebh,d7h,f8h,09h,78h,c4h
+			db	fah,abh,83h,0eh,edh,00h,1dh,6dh
+			db	feh,80h,38h,b0h,d3h,bbh,d7h,3fh
+			db	77h,e1h,3ah,a4h,0bh,bch,a2h,c2h
+			db	d0h,3ch,ach,5ch,d8h,36h,c3h,3bh
+			db	dch,fch,65h,b4h,ddh,6ah,b0h,42h
+			db	33h,87h,7fh,1ah,1ah,fch,55h,bfh
+			db	5eh,bfh,e4h,d3h,2fh,0ch,1bh,ffh
+			db	aah,7dh,1fh,a9h,5fh,74h,78h,f0h
+			db	cfh,f6h,0ah,eah,01h,b5h,9ch,74h
+			db	85h,a9h,7eh,e3h,45h,5eh,d0h,beh
+			db	f1h,2ch,94h,63h,70h,69h,89h,46h
+			db	f4h,eah,7eh,14h,8dh,f9h,c5h,27h
+			db	35h,24h,e3h,94h,12h,feh,01h,71h
+			db	2ah,18h,0dh,f1h,72h,40h,02h,cch
+			db	90h,cah,1eh,c4h,e8h,cfh,20h,cdh
+			db	3fh,55h,7ah,d8h,05h,feh,cfh,c0h
+			db	1dh,4dh,d3h,8bh,4ch,aah,1ch,bfh
+			db	bfh,a7h,81h,0dh,e3h,d1h,aeh,b7h
+			db	3ch,dfh,d6h,a6h,0bh,2ah,fdh,dah
+			db	43h,a7h,33h,0ah,72h,20h,a2h,0eh
+			db	ceh,a6h,4eh,abh,8fh,07h,edh,01h
+			db	94h,66h,8ah,58h,0dh,25h,ach,f0h
+			db	7fh,d9h,9dh,80h,29h,edh,86h,86h
+			db	b9h,3fh,b2h,24h,e3h,2ah,5ah,0eh
+			db	08h,ddh,8ch,40h,90h,b9h,89h,e9h
+			db	2fh,8bh,2ah,96h,cbh,5bh,81h,29h
+			db	e0h,68h,3bh,77h,46h,77h,7fh,41h
+			db	8ch,64h,63h,b1h,bdh,e2h,1fh,83h
+			db	dch,35h,03h,beh,bch,69h,74h,a8h
+			db	0bh,cdh,f1h,68h,c2h,c3h,3eh,70h
+			db	f4h,7dh,cah,01h,cch,87h,edh,6ch
+			db	a9h,d1h,f1h,b8h,17h,1ah,08h,97h
+			db	73h,1ch,18h,26h,20h,dfh,42h,f3h
+			db	e4h,67h,16h,25h,a1h,64h,21h,33h
+			db	f2h,dch,32h,4dh,73h,cah,48h,51h
+			db	3eh,1ch,92h,93h,ach,b0h,42h,e0h
+			db	1ch,6ah,77h,10h,19h,8ch,74h,e0h
+			db	d1h,cch,93h,98h,abh,a1h,8ch,56h
+			db	68h,ddh,90h,e5h,d1h,e0h,e4h,c9h
+			db	d0h,a9h,dch,71h,2bh,63h,53h,ceh
+			db	74h,97h,0dh,b9h,1bh,deh,4ch,cdh
+			db	02h,b7h,79h,f5h,98h,98h,b6h,a6h
+			db	d3h,5ch,d3h,f7h,f3h,dch,f9h,78h
+			db	7dh,17h,31h,36h,fbh,86h,08h,96h
+			db	86h,52h,2bh,cfh,03h,8bh,39h,e7h
+			db	0ch,d4h,31h,86h,89h,48h,feh,8ch
+			db	26h,89h,a4h,fah,0dh,d5h,4ch,2eh
+			db	49h,11h,1fh,27h,d7h,bdh,cah,78h
+			db	c9h,57h,4ah,f4h,6dh,6ch,83h,c8h
+			db	cfh,3fh,d9h,2fh,94h,f5h,10h,ebh
+			db	35h,3dh,d3h,60h,6dh,d8h,f2h,24h
+			db	6eh,6ch,c1h,d7h,97h,a5h,9fh,e6h
+			db	56h,84h,beh,7eh,adh,e2h,92h,0dh
+			db	32h,13h,f7h,41h,4bh,56h,7ah,20h
+			db	0bh,7ah,2ch,f6h,0dh,07h,cch,aah
+			db	0ah,6bh,7dh,d7h,90h,50h,68h,4fh
+			db	b3h,c8h,cah,bbh,c1h,c0h,31h,15h
+			db	f6h,95h,94h,2dh,15h,73h,82h,75h
+			db	3eh,3dh,48h,d3h,11h,b5h,93h,d3h
+			db	72h,25h,46h,26h,78h,59h,cdh,fdh
+			db	a5h,a4h,96h,0ch,82h,88h,8bh,e2h
+			db	82h,c2h,f9h,5dh,35h,47h,bfh,68h
+			db	24h,58h,d0h,e4h,17h,93h,40h,28h
+			db	cch,e6h,2eh,58h,18h,87h,4bh,78h
+			db	6ch,08h,21h,26h,c4h,a8h,01h,cfh
+			db	28h,c2h,30h,1bh,f2h,49h,68h,cdh
+			db	1dh,aah,c7h,50h,57h,b5h,61h,4bh
+			db	b7h,ffh,28h,bfh,dah,45h,43h,fbh
+			db	9bh,07h,cdh,4bh,25h,4dh,0ch,5ah
+			db	a4h,1ch,71h,eeh,a0h,c5h,6eh,7fh
+			db	d3h,b5h,e4h,79h,8bh,8ch,f4h,92h
+			db	22h,5ah,11h,e8h,e3h,12h,2dh,cbh
+			db	b7h,2fh,b8h,04h,27h,e6h,f5h,29h
+			db	29h,ceh,34h,27h,6fh,aah,28h,5bh
+			db	5bh,cdh,79h,d5h,e9h,9eh,a9h,8dh
+			db	dfh,02h,22h,18h,2dh,a2h,bdh,2eh
+			db	aah,d7h,d9h,19h,e6h,78h,5ch,00h
+			db	73h,d3h,9ch,ech,31h,98h,c1h,53h
+			db	8ch,c2h,6bh,c9h,dbh,49h,b6h,64h
+			db	1ah,96h,02h,88h,f2h,ebh,81h,15h
+			db	55h,14h,41h,5bh,69h,cdh,88h,6ah
+			db	88h,52h,b9h,42h,efh,72h,c6h,0dh
+			db	c2h,d2h,18h,13h,89h,bch,61h,0fh
+			db	93h,12h,c7h,ebh,39h,b7h,eah,39h
+			db	83h,6fh,2ch,52h,39h,d7h,ceh,16h
+			db	b0h,85h,0ah,6fh,9eh,23h,c6h,d0h
+			db	85h,f2h,ach,fah,86h,aeh,44h,03h
+			db	9eh,04h,92h,98h,6ah,abh,c5h,d6h
+			db	53h,1bh,b3h,56h,c7h,c0h,edh,09h
+			db	04h,96h,3ah,1dh,3ch,93h,b4h,4eh
+			db	7dh,fbh,f6h,e9h,a0h,deh,88h,2eh
+			db	53h,12h,c3h,01h,53h,69h,06h,6eh
+			db	77h,a1h,85h,f1h,a9h,fch,bch,8dh
+			db	00h,02h,abh,a5h,fbh,f4h,d9h,92h
+			db	d5h,84h,c0h,fdh,28h,47h,17h,cdh
+			db	22h,d1h,8ch,c2h,25h,45h,a0h,03h
+			db	43h,25h,b3h,f7h,30h,33h,1bh,ceh
+			db	f1h,beh,41h,08h,f5h,c0h,66h,a2h
+			db	6ch,c9h,ach,b4h,7bh,8bh,5eh,c0h
+			db	a1h,8eh,52h,9ch,08h,26h,1fh,88h
+			db	25h,a6h,5dh,63h,c9h,7eh,80h,10h
+			db	2eh,05h,d0h,a5h,fah,28h,0fh,ffh
+			db	57h,b2h,f4h,d0h,07h,f7h,71h,b8h
+			db	70h,e2h,f3h,e2h,20h,c1h,4eh,aeh
+			db	edh,5dh,f5h,64h,63h,afh,39h,21h
+			db	ffh,60h,cah,96h,77h,5ch,19h,d2h
+			db	15h,9fh,a1h,5eh,79h,adh,9fh,67h
+			db	f0h,0bh,9eh,bah,c9h,dfh,efh,d4h
+			db	afh,8ah,e2h,63h,4fh,b2h,e9h,09h
+			db	38h,5fh,9ah,1eh,41h,e4h,78h,32h
+			db	a8h,ach,53h,68h,89h,ceh,36h,20h
+			db	83h,05h,ech,05h,c9h,97h,b2h,93h
+			db	b0h,f2h,c8h,55h,31h,efh,b6h,f1h
+			db	0dh,4eh,0ah,6ah,52h,bbh,f6h,88h
+			db	a0h,3dh,c3h,8bh,b4h,bbh,9fh,51h
+			db	60h,19h,9ah,23h,bdh,17h,34h,80h
+			db	9ch,d3h,66h,72h,94h,e4h,46h,5dh
+			db	9ch,45h,62h,e1h,e9h,3fh,15h,90h
+			db	40h,34h,c0h,deh,5bh,f2h,96h,84h
+			db	49h,35h,6ch,ebh,6eh,f1h,1ch,afh
+			db	3ah,8fh,48h,3ch,7ch,01h,34h,74h
+			db	94h,4fh,28h,fah,47h,a8h,2bh,3fh
+			db	c2h,5fh,2ah,37h,29h,8ch,2fh,93h
+			db	fdh,eeh,e6h,e2h,cch,65h,8fh,18h
+			db	fdh,68h,dah,f3h,27h,0bh,f9h,ebh
+			db	29h,85h,14h,29h,22h,cah,5fh,72h
+			db	73h,beh,aah,9dh,4eh,d7h,78h,e7h
+			db	16h,80h,b7h,a7h,dfh,64h,e4h,2fh
+			db	b2h,f6h,c0h,26h,83h,3fh,5dh,e2h
+			db	7dh,4dh,93h,adh,dfh,87h,b0h,c4h
+			db	8eh,44h,51h,c5h,cfh,70h,7bh,85h
+			db	bah,70h,27h,06h,27h,1dh,81h,1ch
+			db	0eh,52h,10h,34h,6fh,79h,c9h,b0h
+			db	9eh,65h,7fh,17h,a3h,83h,03h,05h
+			db	32h,69h,0fh,d7h,e7h,36h,8dh,20h
+			db	5eh,bah,59h,60h,19h,d3h,59h,51h
+			db	1bh,c6h,2fh,46h,10h,97h,dch,dah
+			db	b5h,abh,1ch,40h,c9h,75h,cbh,e7h
+			db	04h,10h,c3h,eah,edh,7dh,4fh,d3h
+			db	1fh,9fh,10h,c4h,22h,cdh,c1h,4bh
+			db	36h,c4h,1ch,65h,e7h,65h,2dh,dah
+			db	71h,a9h,5eh,0bh,c7h,1eh,77h,93h
+			db	3ch,f9h,80h,49h,1bh,99h,86h,00h
+			db	8eh,44h,0dh,74h,08h,2eh,d1h,2ch
+			db	59h,86h,ceh,75h,d2h,80h,f0h,a9h
+			db	10h,53h,19h,35h,4dh,e3h,8ah,5eh
+			db	e5h,80h,65h,f3h,57h,90h,bdh,a3h
+			db	00h,45h,5ch,a3h,f3h,56h,e9h,9fh
+			db	cbh,27h,a9h,61h,30h,99h,21h,96h
+			db	14h,afh,2dh,dbh,6ch,71h,54h,34h
+			db	d4h,f2h,e6h,64h,c6h,cdh,23h,f1h
+			db	d6h,49h,23h,96h,99h,4dh,eeh,cbh
+			db	29h,94h,e1h,a8h,a7h,13h,e7h,b0h
+			db	88h,c8h,43h,dah,75h,65h,eah,8ch
+			db	54h,4eh,03h,d8h,4fh,1fh,e6h,0dh
+			db	7fh,a5h,80h,18h,bah,67h,91h,8bh
+			db	cah,47h,7bh,10h,cah,16h,f1h,fdh
+			db	67h,4ch,f6h,5dh,77h,18h,57h,a3h
+			db	96h,9dh,e3h,b4h,4eh,2eh,b2h,02h
+			db	aah,cah,35h,4bh,60h,bch,57h,39h
+			db	fch,29h,35h,c3h,17h,fah,16h,82h
+			db	03h,82h,c1h,3fh,07h,25h,edh,dch
+			db	27h,c0h,2ah,18h,7ah,f1h,27h,c8h
+			db	76h,0ah,21h,07h,76h,b2h,d4h,0fh
+			db	66h,9dh,20h,05h,03h,a7h,0bh,12h
+			db	e4h,43h,38h,73h,b9h,e4h,d5h,06h
+			db	38h,38h,3ah,4ch,37h,83h,07h,70h
+			db	22h,e5h,a0h,85h,fch,d6h,3ah,8ah
+			db	4eh,03h,5ah,70h,64h,4bh,13h,32h
+			db	d1h,e0h,5dh,dch,f7h,00h,34h,4dh
+			db	cah,c1h,6dh,5eh,c3h,a1h,c3h,a3h
+			db	16h,edh,b2h,29h,90h,59h,80h,a9h
+			db	bbh,46h,48h,ffh,e4h,3eh,79h,f9h
+			db	d1h,d4h,fdh,dfh,4ah,12h,f4h,53h
+			db	61h,4ah,57h,03h,56h,63h,71h,5bh
+			db	edh,60h,96h,39h,6eh,e4h,cch,e0h
+			db	12h,d2h,24h,4ch,2bh,b3h,f2h,79h
+			db	83h,89h,46h,f1h,26h,e6h,ebh,a1h
+			db	76h,81h,f1h,c2h,2ch,d5h,bah,0fh
+			db	aeh,34h,34h,e1h,1ch,76h,61h,c3h
+			db	3eh,9ch,52h,95h,b2h,09h,54h,f0h
+			db	46h,6eh,12h,c4h,95h,4ah,a7h,24h
+			db	deh,f2h,75h,38h,bch,f4h,76h,eah
+			db	4dh,fch,16h,5ch,2dh,afh,f8h,7ah
+			db	00h,8fh,2ah,aah,bfh,4ah,e5h,88h
+			db	cch,24h,46h,1fh,2ch,20h,ech,78h
+			db	0fh,b2h,8bh,a3h,dbh,81h,17h,36h
+			db	30h,46h,e8h,79h,93h,ach,79h,e6h
+			db	01h,d8h,a8h,83h,ddh,15h,feh,94h
+			db	07h,0bh,ebh,45h,59h,29h,9ch,8fh
+			db	62h,52h,5fh,e3h,feh,77h,8dh,b8h
+			db	32h,c2h,34h,00h,47h,8dh,a7h,7dh
+			db	89h,51h,94h,b9h,62h,4ah,6fh,7bh
+			db	14h,e8h,f3h,3ah,c4h,2eh,f2h,f6h
+			db	efh,e0h,4ah,6dh,eeh,50h,80h,87h
+			db	21h,57h,2bh,40h,b0h,9eh,3dh,f4h
+			db	e4h,b1h,02h,9eh,ach,46h,1ah,30h
+			db	2ah,a8h,cch,d7h,f7h,6bh,23h,0ch
+			db	a8h,58h,ach,2dh,66h,c4h,87h,72h
+			db	dfh,47h,75h,89h,62h,e2h,fch,4eh
+			db	4ch,57h,38h,1ch,20h,94h,b2h,90h
+			db	13h,61h,52h,22h,e3h,04h,8eh,e4h
+			db	5ah,e6h,f5h,4bh,83h,a1h,a2h,20h
+			db	9bh,ebh,96h,a8h,c9h,23h,20h,beh
+			db	fah,b5h,5ch,aeh,26h,28h,30h,ach
+			db	41h,70h,f3h,12h,1eh,68h,3dh,bch
+			db	80h,82h,50h,2dh,f1h,3fh,58h,25h
+			db	8fh,8ch,b6h,58h,98h,28h,2fh,30h
+			db	61h,12h,6dh,2ah,61h,18h,c5h,27h
+			db	feh,0eh,57h,bfh,00h,38h,99h,feh
+			db	79h,4ch,56h,90h,09h,31h,0eh,bfh
+			db	f0h,32h,0bh,e9h,d2h,50h,44h,a6h
+			db	ceh,ach,92h,c7h,c6h,7dh,98h,53h
+			db	79h,57h,98h,72h,70h,21h,5ch,f7h
+			db	8ch,c9h,88h,a5h,47h,bdh,beh,52h
+			db	3ah,27h,f0h,3dh,17h,57h,b2h,d0h
+			db	dah,e3h,03h,5ch,60h,f4h,23h,e1h
+			db	30h,f4h,5dh,84h,22h,26h,3bh,e6h
+			db	02h,18h,65h,89h,36h,eeh,95h,c9h
+			db	43h,74h,c6h,7fh,7bh,3bh,5fh,0ah
+			db	94h,dch,5ah,00h,7fh,08h,e9h,06h
+			db	99h,3dh,2fh,e1h,20h,dch,14h,d1h
+			db	15h,20h,e7h,4bh,38h,82h,e0h,0eh
+			db	2bh,feh,96h,26h,c6h,88h,dfh,0bh
+			db	7fh,f6h,5dh,0eh,27h,32h,7dh,15h
+			db	cfh,dfh,06h,cfh,b7h,0ah,19h,aeh
+			db	a1h,0fh,0fh,e7h,f9h,b9h,afh,62h
+			db	96h,5fh,9eh,44h,afh,fah,5ch,a3h
+			db	72h,69h,24h,69h,2ah,aah,61h,1ch
+			db	c5h,70h,30h,7ch,ebh,14h,3bh,37h
+			db	f8h,adh,6dh,fch,fbh,70h,cfh,41h
+			db	f2h,83h,abh,f0h,3ch,e7h,4fh,24h
+			db	c1h,aah,3fh,3dh,41h,82h,77h,3ah
+			db	c3h,f3h,b8h,cfh,68h,9ch,42h,41h
+			db	aeh,04h,86h,f8h,50h,2ch,f7h,d0h
+			db	cah,b9h,08h,24h,e8h,2ah,e6h,3ah
+			db	3fh,45h,9ch,c7h,03h,59h,ebh,7bh
+			db	21h,09h,c3h,22h,2ah,91h,fbh,a3h
+			db	89h,e2h,8bh,63h,fdh,22h,3ah,56h
+			db	f0h,b4h,fch,87h,b5h,edh,a4h,c6h
+			db	14h,e7h,7ah,f6h,68h,d6h,a1h,f4h
+			db	c2h,fdh,36h,77h,e3h,bah,3bh,dbh
+			db	8bh,cfh,88h,39h,e3h,b5h,cbh,9dh
+			db	e3h,57h,0eh,45h,f7h,e5h,3bh,e1h
+			db	15h,92h,96h,68h,2ch,dah,64h,f7h
+			db	1eh,30h,c1h,cch,2fh,96h,6ah,d1h
+			db	cbh,72h,81h,0bh,cdh,afh,bdh,94h
+			db	1bh,bbh,89h,1fh,5ah,e3h,04h,b6h
+			db	a0h,47h,44h,73h,21h,b2h,b9h,65h
+			db	cfh,7dh,17h,92h,74h,12h,80h,32h
+			db	45h,16h,f5h,45h,8fh,79h,f0h,81h
+			db	88h,42h,48h,03h,81h,24h,78h,19h
+			db	efh,1eh,38h,1eh,94h,e4h,49h,f5h
+			db	ech,00h,41h,c0h,feh,76h,54h,d8h
+			db	d8h,bdh,79h,50h,51h,a5h,58h,90h
+			db	68h,afh,79h,2ah,6bh,a7h,0ch,b1h
+			db	e9h,98h,4ch,bbh,cfh,9dh,f1h,98h
+			db	dbh,17h,9eh,48h,96h,37h,edh,81h
+			db	45h,bfh,edh,d2h,9dh,2bh,45h,26h
+			db	22h,8eh,40h,16h,3eh,beh,42h,19h
+			db	deh,bah,bfh,3eh,5bh,7bh,8fh,dbh
+			db	1ch,adh,25h,0ah,b6h,6dh,98h,f5h
+			db	48h,ach,84h,d2h,b1h,87h,50h,35h
+			db	67h,dah,16h,51h,5eh,72h,3ah,b5h
+			db	61h,0dh,e8h,bbh,77h,7eh,6dh,0dh
+			db	e8h,98h,75h,cah,e6h,56h,0dh,3dh
+			db	e6h,2bh,1dh,f6h,25h,f8h,6ah,f0h
+			db	9bh,91h,9bh,e2h,52h,f2h,0ah,04h
+			db	a4h,b7h,d0h,abh,79h,b8h,e0h,27h
+			db	e1h,2ah,5ah,4ch,e2h,46h,38h,c1h
+			db	fbh,62h,f2h,81h,b2h,72h,35h,2ch
+			db	39h,1fh,76h,2bh,34h,a4h,89h,bbh
+			db	f7h,59h,3eh,5eh,62h,35h,6dh,d6h
+			db	9dh,fbh,e1h,61h,9eh,4bh,30h,9ch
+			db	e2h,ach,6eh,dbh,06h,f2h,b8h,bfh
+			db	59h,26h,5ch,75h,1dh,bfh,c4h,9bh
+			db	6bh,dbh,e0h,5eh,54h,5eh,5ch,5dh
+			db	fdh,41h,58h,dch,96h,28h,2eh,36h
+			db	36h,f4h,1bh,f4h,abh,17h,b3h,31h
+			db	afh,80h,aeh,96h,77h,65h,52h,c4h
+			db	eeh,e2h,cch,01h,a8h,2ch,b4h,84h
+			db	c3h,e8h,d1h,cfh,57h,9dh,e2h,27h
+			db	79h,7fh,00h,36h,77h,c3h,7ah,93h
+			db	0fh,cdh,50h,74h,45h,c9h,4eh,31h
+			db	dbh,3bh,dah,66h,01h,52h,a1h,cah
+			db	a5h,61h,86h,d3h,a6h,cfh,d4h,bfh
+			db	deh,c0h,d0h,63h,f3h,dah,e3h,feh
+			db	1dh,9eh,5eh,c5h,a1h,6ch,4ch,b6h
+			db	44h,9ch,dah,dah,15h,85h,13h,d7h
+			db	00h,a4h,efh,d2h,16h,49h,9dh,31h
+			db	dah,17h,ach,7fh,95h,a0h,07h,81h
+			db	1ch,0ch,8dh,57h,bch,61h,52h,07h
+			db	b3h,2eh,4fh,2eh,fah,ech,64h,24h
+			db	a9h,07h,c1h,fah,15h,51h,91h,7eh
+			db	62h,41h,00h,5eh,d0h,b1h,7fh,74h
+			db	b8h,20h,60h,39h,31h,dbh,bah,9ch
+			db	1ah,97h,04h,bah,5ah,5ch,31h,9fh
+			db	78h,9dh,7bh,a3h,9fh,52h,30h,09h
+			db	d6h,c2h,c7h,0eh,3ah,c9h,d4h,04h
+			db	7ch,79h,11h,b0h,3eh,b3h,9ch,beh
+			db	dfh,08h,89h,f8h,89h,3eh,7bh,58h
+			db	51h,e8h,e9h,79h,78h,e3h,4bh,9ah
+			db	45h,7eh,24h,0dh,b7h,0bh,2ah,ceh
+			db	a1h,ceh,ceh,f9h,4fh,26h,d5h,e2h
+			db	5ch,2ch,59h,e7h,6dh,9fh,c1h,69h
+			db	d3h,a7h,6dh,c4h,6bh,a3h,64h,f5h
+			db	9eh,46h,c2h,2ah,f3h,21h,b3h,2ah
+			db	21h,86h,0dh,40h,8fh,feh,d6h,7eh
+			db	fbh,18h,ebh,5eh,65h,a6h,b6h,79h
+			db	a0h,d7h,52h,4bh,88h,75h,44h,b0h
+			db	67h,fdh,20h,aeh,43h,e2h,ddh,66h
+			db	2ah,33h,27h,bbh,55h,ddh,a1h,45h
+			db	92h,b2h,79h,bfh,1ch,85h,d1h,c2h
+			db	e8h,2dh,41h,cfh,53h,ebh,f8h,bfh
+			db	abh,4ah,73h,9ah,66h,05h,12h,fdh
+			db	cbh,11h,69h,1bh,e6h,19h,99h,e8h
+			db	93h,88h,50h,0ch,e6h,8bh,35h,09h
+			db	09h,d6h,81h,58h,8ch,c0h,74h,87h
+			db	61h,14h,5ah,7ch,8bh,cfh,7ch,f7h
+			db	dfh,ech,abh,2eh,3eh,f2h,a5h,e2h
+			db	b5h,5fh,9ch,6ah,5fh,8ah,32h,55h
+			db	c1h,cch,18h,bfh,9bh,b4h,1eh,41h
+			db	07h,ddh,68h,afh,6ch,00h,48h,a7h
+			db	c1h,c7h,46h,c3h,94h,4ah,b2h,48h
+			db	88h,d6h,28h,e3h,5bh,f7h,25h,37h
+			db	50h,24h,02h,b5h,0eh,51h,a6h,1dh
+			db	86h,1dh,2bh,bdh,efh,e4h,a1h,88h
+			db	18h,8ch,efh,00h,76h,2ah,bfh,78h
+			db	76h,8bh,fah,6ah,b1h,89h,45h,ffh
+			db	c6h,e3h,f8h,37h,3dh,29h,27h,02h
+			db	09h,89h,27h,4ch,18h,c4h,4fh,e6h
+			db	d5h,f6h,2dh,9ch,85h,17h,b4h,2ch
+			db	a4h,80h,14h,c3h,75h,7eh,e9h,09h
+			db	94h,dfh,8ah,7eh,6eh,ebh,e9h,6dh
+			db	6ah,40h,67h,e2h,a9h,b2h,f7h,cbh
+			db	fch,a3h,afh,ffh,1ch,f7h,50h,96h
+			db	bch,19h,cbh,a1h,55h,feh,15h,57h
+			db	67h,a4h,33h,d3h,33h,99h,2ah,a1h
+			db	1bh,b0h,3dh,02h,92h,3eh,d6h,75h
+			db	66h,dch,49h,53h,58h,3ch,c4h,7ah
+			db	cdh,d0h,83h,98h,e6h,0dh,6eh,00h
+			db	e5h,f2h,d2h,abh,a5h,e3h,12h,d7h
+			db	cfh,6dh,dfh,b8h,bdh,89h,47h,7bh
+			db	9eh,d1h,0bh,e1h,8dh,49h,fah,59h
+			db	1ch,53h,88h,16h,55h,c6h,fdh,0eh
+			db	4dh,22h,6eh,c5h,0ch,5bh,90h,dah
+			db	afh,9ch,d6h,08h,c8h,96h,83h,21h
+			db	91h,d6h,a8h,7eh,76h,71h,47h,43h
+			db	cah,25h,feh,48h,49h,b7h,82h,02h
+			db	76h,c3h,16h,e3h,97h,6eh,d5h,1bh
+			db	02h,d5h,4fh,5ch,e6h,a5h,a4h,c5h
+			db	41h,04h,25h,50h,65h,91h,85h,7fh
+			db	7eh,51h,cbh,e8h,7ah,9dh,44h,b6h
+			db	86h,45h,00h,58h,79h,cdh,d2h,28h
+			db	d5h,84h,7dh,41h,f3h,56h,e6h,9ah
+			db	dch,9bh,5eh,b4h,0eh,55h,09h,dbh
+			db	0eh,7ch,25h,51h,feh,1ah,74h,6eh
+			db	39h,42h,68h,d3h,0dh,2fh,9dh,bah
+			db	e1h,6ah,39h,ebh,8dh,64h,35h,a3h
+			db	fdh,9fh,ebh,a4h,f9h,a1h,6fh,00h
+			db	21h,07h,5bh,1fh,dch,70h,b6h,0fh
+			db	65h,68h,d8h,f4h,e0h,62h,d1h,f0h
+			db	0fh,edh,77h,4fh,01h,12h,1ch,7ch
+			db	2dh,77h,14h,e2h,9dh,35h,22h,5ch
+			db	29h,3fh,edh,04h,b4h,06h,85h,d0h
+			db	38h,5dh,1fh,9ch,a7h,d7h,25h,45h
+			db	c6h,62h,0fh,0eh,59h,66h,e1h,4fh
+			db	deh,7eh,b6h,2dh,bbh,99h,85h,63h
+			db	95h,72h,98h,01h,bfh,52h,62h,c1h
+			db	6ah,2bh,a4h,cch,c6h,bch,50h,21h
+			db	e0h,ddh,00h,91h,56h,0bh,f8h,c3h
+			db	64h,79h,f5h,95h,69h,1ah,deh,65h
+			db	fbh,96h,c4h,c6h,36h,78h,60h,a2h
+			db	19h,93h,e6h,00h,03h,14h,b7h,61h
+			db	10h,2ch,2ch,47h,a6h,79h,52h,f4h
+			db	bbh,9eh,fah,88h,a2h,99h,bah,9ah
+			db	6ch,c1h,40h,c1h,76h,42h,6bh,bdh
+			db	8ah,b3h,d1h,35h,4eh,afh,d8h,e0h
+			db	b4h,63h,87h,53h,e5h,c6h,7ch,96h
+			db	49h,feh,81h,7ah,b7h,53h,73h,a3h
+			db	65h,66h,47h,67h,92h,b5h,0fh,f9h
+			db	f6h,f3h,92h,fch,75h,52h,8bh,6bh
+			db	d4h,d4h,6dh,44h,45h,13h,f1h,f6h
+			db	1ch,13h,edh,86h,3dh,70h,f1h,6dh
+			db	b0h,aeh,a3h,03h,16h,10h,d0h,44h
+			db	91h,ach,a0h,55h,9ch,99h,97h,14h
+			db	c3h,ech,beh,e7h,2ch,c8h,78h,24h
+			db	feh,27h,67h,e6h,a7h,2dh,c3h,ddh
+			db	d8h,0ah,fbh
@@ -0,0 +1,4110 @@
+			org	4000h
+
+signtr:						; cartridge signature = 'AB'
+			db	"AB"
+
+staddr:						; start address value
+			dw	start
+			db	d8h,11h,a0h,23h,a8h,89h,57h,54h
+			db	33h,53h,e0h,14h
+
+start:						; execution starting point
+			push	af
+			ld	d,b
+			ld	d,l
+			call	po,L3f9c
+			ret
+			db	33h,e2h,e4h,2dh,47h,42h,b6h,a4h
+			db	7ch,9fh,3fh,9fh,09h,deh,93h,ddh
+			db	52h,04h,d7h,8fh,35h,bbh,32h,97h
+			db	e9h,f6h,b3h,50h,b4h,23h,b3h,11h
+			db	c0h,1dh,20h,06h,7dh,fah,8dh,b7h
+			db	11h,4fh,f8h,51h,78h,a4h,8fh,7ah
+			db	85h,9dh,18h,33h,d4h,92h,96h,8fh
+			db	23h,06h,69h,b8h,09h,5fh,2fh,f7h
+			db	01h,2eh,23h,ech,5eh,e7h,7bh,4ah
+			db	4eh,2ch,dch,58h,47h,8ah,78h,1ch
+			db	14h,94h,07h,94h,9dh,98h,e2h,c3h
+			db	57h,54h,ddh,b3h,65h,84h,a5h,fah
+			db	33h,20h,e0h,43h,e6h,69h,ech,d7h
+			db	04h,7dh,d6h,96h,58h,ebh,8fh,ech
+			db	0dh,c2h,cdh,86h,3ah,bah,27h,ceh
+			db	a5h,52h,45h,19h,b2h,62h,fdh,c2h
+			db	efh,3ch,ach,43h,4eh,fch,01h,0fh
+			db	44h,85h,aah,b6h,ceh,3ch,1ah,4ch
+			db	d1h,bah,d0h,8eh,21h,8ch,bbh,49h
+			db	50h,a9h,2eh,91h,d4h,f9h,84h,0dh
+			db	50h,d4h,19h,e5h,7ch,c2h,54h,d1h
+			db	c2h,5ah,a5h,fah,ffh,72h,a1h,53h
+			db	66h,81h,fch,99h,d9h,c7h,25h,08h
+			db	f5h,aah,c4h,ech,88h,b5h,07h,00h
+			db	ceh,a2h,17h,f1h,e8h,28h,a4h,d5h
+			db	fdh,0bh,73h,6ch,8fh,82h,40h,12h
+			db	64h,4dh,5ch,75h,7dh,31h,ebh,16h
+			db	9dh,64h,89h,cdh,9bh,88h,9dh,d1h
+			db	3fh,04h,96h,7ch,08h,ceh,2bh,31h
+			db	58h,79h,bdh,46h,16h,b2h,62h,5dh
+			db	e1h,efh,3dh,fdh,45h,22h,74h,91h
+			db	8dh,0ah,9dh,a9h,fbh,f9h,deh,c1h
+			db	d2h,78h,39h,5ch,e8h,cfh,adh,9ah
+			db	27h,bbh,a2h,31h,27h,61h,d7h,5ah
+			db	9bh,79h,7bh,edh,0ch,3bh,b3h,22h
+			db	ech,5bh,75h,14h,3dh,5bh,89h,11h
+			db	03h,63h,deh,00h,71h,01h,b8h,33h
+			db	31h,0bh,84h,d3h,99h,5ch,03h,91h
+			db	31h,97h,ebh,19h,4fh,45h,b7h,cdh
+			db	f7h,02h,57h,b4h,84h,8fh,18h,17h
+			db	fdh,37h,06h,bfh,61h,a2h,67h,1fh
+			db	fah,96h,61h,a7h,08h,e2h,d9h,3eh
+			db	a9h,d1h,8dh,f5h,06h,96h,8ah,14h
+			db	63h,9ah,ech,71h,03h,b6h,57h,efh
+			db	e2h,b7h,80h,f5h,86h,efh,cbh,03h
+			db	7bh,84h,a9h,3dh,9ch,a6h,edh,98h
+			db	8ah,86h,e4h,06h,0bh,ceh,ech,9fh
+			db	cch,36h,18h,f0h,fbh,17h,e5h,4fh
+			db	c8h,cch,10h,93h,4bh,b5h,a7h,52h
+			db	feh,e7h,88h,95h,93h,deh,d7h,0ch
+			db	11h,f9h,8eh,fch,33h,1bh,30h,4ah
+			db	f8h,a1h,f0h,38h,72h,c5h,abh,6dh
+			db	34h,adh,23h,95h,b0h,e0h,57h,bch
+			db	7ah,d9h,76h,48h,3dh,3dh,72h,30h
+			db	4dh,3dh,f6h,e8h,fah,2bh,c7h,bbh
+			db	6bh,8bh,feh,4bh,29h,38h,60h,9fh
+			db	c3h,c8h,c3h,26h,7bh,e5h,6ah,51h
+			db	3fh,32h,dfh,70h,43h,b9h,7ah,5ah
+			db	d1h,92h,f1h,3bh,25h,2dh,83h,c1h
+			db	12h,59h,c5h,24h,9ah,d5h,88h,61h
+			db	3fh,c8h,7dh,13h,aah,6dh,cfh,aeh
+			db	e3h,ceh,0dh,53h,25h,8bh,45h,69h
+			db	05h,45h,e4h,f2h,46h,5eh,08h,62h
+			db	f2h,e6h,66h,32h,37h,72h,86h,b8h
+			db	deh,dfh,a9h,aeh,19h,6dh,c9h,97h
+			db	5bh,4dh,f8h,2ah,dfh,a3h,76h,e5h
+			db	a2h,9ch,95h,e6h,41h,1ch,6ah,8fh
+			db	fch,23h,7eh,96h,bah,01h,97h,e7h
+			db	a6h,07h,34h,66h,7ch,70h,ddh,08h
+			db	b1h,81h,4dh,50h,39h,8ch,dah,02h
+			db	6bh,98h,74h,19h,e1h,17h,22h,85h
+			db	89h,61h,39h,5dh,1fh,6ch,21h,0ch
+			db	67h,33h,a1h,80h,aah,c4h,7ch,16h
+			db	a4h,21h,39h,61h,31h,eeh,11h,1dh
+			db	dah,59h,66h,bch,d3h,6fh,d7h,d6h
+			db	94h,d2h,c2h,5ah,f7h,38h,d0h,73h
+			db	bch,e7h,6dh,09h,7fh,16h,39h,98h
+			db	f0h,d4h,9bh,d7h,8eh,09h,50h,b7h
+			db	a1h,79h,01h,e4h,a3h,22h,cah,03h
+			db	26h,3bh,e0h,67h,26h,03h,7fh,3fh
+			db	cah,f2h,8dh,84h,13h,e4h,57h,06h
+			db	94h,65h,bbh,88h,9dh,72h,bdh,b0h
+			db	bfh,93h,74h,7dh,aeh,64h,dah,3bh
+			db	0bh,6eh,0fh,16h,00h,65h,35h,6bh
+			db	77h,a2h,51h,a4h,88h,bfh,32h,dah
+			db	27h,30h,0eh,cbh,3ah,14h,adh,58h
+			db	a4h,65h,b8h,8ch,7fh,d4h,2ah,71h
+			db	29h,05h,c2h,24h,90h,3eh,c8h,77h
+			db	51h,e4h,f9h,cfh,6ch,bah,3fh,9ch
+			db	8ah,a5h,70h,26h,c1h,d5h,67h,a3h
+			db	45h,cfh,d1h,cch,cbh,b1h,ceh,bfh
+			db	ach,8ah,2dh,4ch,23h,06h,7bh,a0h
+			db	79h,adh,5ah,e4h,89h,c9h,36h,aeh
+			db	96h,49h,bfh,84h,47h,5fh,a5h,b8h
+			db	ffh,b3h,03h,5ah,97h,9bh,0fh,9dh
+			db	f1h,41h,b3h,59h,50h,74h,8eh,dah
+			db	53h,dbh,3eh,d7h,15h,31h,5dh,bah
+			db	3fh,1eh,fdh,a4h,d1h,d3h,77h,59h
+			db	aah,a2h,f3h,7ch,e6h,88h,f5h,68h
+			db	e0h,2eh,85h,8dh,feh,fbh,6eh,38h
+			db	edh,37h,09h,cdh,b6h,deh,26h,aah
+			db	f5h,36h,d9h,84h,bdh,d9h,22h,97h
+			db	2fh,5ch,b3h,2ch,3ch,90h,18h,8eh
+			db	0fh,66h,bdh,06h,77h,b5h,1ah,86h
+			db	76h,9ch,6fh,1ah,5fh,79h,26h,78h
+			db	50h,59h,aah,f9h,3bh,08h,d9h,65h
+			db	35h,a7h,09h,5fh,20h,00h,11h,c1h
+			db	e4h,bah,63h,4ch,97h,dch,6fh,37h
+			db	dfh,d9h,19h,fch,ech,00h,c7h,c6h
+			db	e6h,18h,bfh,b3h,fch,f8h,44h,91h
+			db	26h,e3h,bch,5bh,42h,75h,b6h,a2h
+			db	84h,68h,62h,d1h,2ch,3dh,2ah,84h
+			db	66h,a6h,51h,50h,c7h,4ah,67h,e7h
+			db	28h,e4h,c1h,3fh,d3h,64h,36h,20h
+			db	8ch,a7h,eah,3fh,3eh,1ch,6ah,e3h
+			db	a7h,9eh,4ch,eeh,b8h,61h,a8h,5ah
+			db	8fh,2ch,d1h,bch,71h,a6h,5ah,beh
+			db	b9h,eah,3eh,e5h,deh,93h,3bh,4ch
+			db	a7h,66h,4bh,4ch,89h,8dh,29h,ddh
+			db	55h,71h,cfh,74h,eeh,09h,beh,65h
+			db	48h,86h,69h,6eh,6ah,a4h,6fh,f2h
+			db	c5h,26h,19h,3ch,75h,37h,fdh,03h
+			db	06h,91h,2eh,73h,63h,2bh,adh,3fh
+			db	66h,6dh,0bh,ceh,2bh,cdh,0fh,e2h
+			db	22h,11h,10h,c1h,94h,83h,13h,9ah
+			db	03h,f0h,27h,e7h,b8h,0eh,aeh,a6h
+			db	a9h,6ch,35h,0bh,52h,26h,88h,19h
+			db	bdh,ddh,85h,88h,bdh,80h,e5h,6eh
+			db	14h,d6h,01h,b3h,76h,90h,b3h,31h
+			db	dbh,41h,2dh,3ch,f8h,1dh,61h,16h
+			db	2eh,7eh,9bh,26h,c4h,84h,5eh,f8h
+			db	2ah,18h,bfh,04h,e5h,cfh,21h,1ch
+			db	35h,97h,88h,d2h,c7h,7bh,57h,e3h
+			db	d5h,1ah,14h,42h,90h,adh,43h,7bh
+			db	5ch,d6h,ddh,39h,13h,e5h,54h,f2h
+			db	4fh,66h,6ch,edh,11h,89h,15h,1fh
+			db	94h,f3h,e3h,d0h,a5h,bah,eah,49h
+			db	c9h,e2h,90h,dbh,b1h,75h,7fh,06h
+			db	e4h,99h,d0h,28h,ddh,c1h,a1h,dbh
+			db	8dh,a3h,49h,efh,ddh,6bh,14h,beh
+			db	b8h,61h,a0h,deh,13h,31h,c1h,38h
+			db	ffh,bdh,18h,abh,c6h,c6h,36h,9dh
+			db	70h,beh,0bh,f1h,95h,2ch,9fh,ebh
+			db	67h,91h,13h,35h,29h,7fh,3dh,b6h
+			db	3dh,5eh,98h,7fh,afh,0ah,d8h,0fh
+			db	c1h,d5h,07h,60h,05h,73h,21h,3ch
+			db	8dh,a3h,16h,c9h,0ch,05h,47h,2bh
+			db	25h,23h,82h,f4h,6bh,a4h,61h,82h
+			db	cfh,c8h,4ah,b4h,1eh,5ah,9ah,fah
+			db	eeh,89h,3ah,70h,a8h,3dh,16h,61h
+			db	e0h,e1h,b9h,ech,ceh,99h,0ah,19h
+			db	adh,38h,92h,96h,0bh,1eh,ech,9ah
+			db	09h,fdh,2eh,76h,63h,6fh,81h,c1h
+			db	02h,3dh,98h,28h,8dh,f2h,49h,9fh
+			db	b7h,0dh,c8h,e6h,09h,b7h,82h,7dh
+			db	3bh,56h,1eh,02h,88h,66h,85h,54h
+			db	18h,6bh,d0h,60h,d4h,9bh,1bh,69h
+			db	c6h,a1h,ech,2bh,9fh,82h,5fh,a7h
+			db	13h,3ch,33h,edh,bdh,8fh,bbh,ech
+			db	ddh,a8h,60h,39h,2dh,c3h,b6h,e2h
+			db	33h,3bh,46h,31h,3bh,16h,3ch,44h
+			db	cch,56h,e6h,8eh,0ah,36h,12h,fdh
+			db	90h,94h,d4h,95h,9eh,bch,ddh,83h
+			db	01h,3dh,8bh,45h,55h,23h,51h,eeh
+			db	cbh,91h,f4h,a8h,a6h,deh,59h,59h
+			db	79h,2dh,51h,b8h,89h,1fh,61h,a7h
+			db	eeh,84h,c9h,a1h,57h,b5h,82h,f8h
+			db	32h,45h,bch,90h,d5h,bbh,d4h,cch
+			db	53h,b3h,01h,06h,eah,efh,4bh,00h
+			db	67h,4bh,0ch,08h,6eh,a4h,f6h,05h
+			db	53h,98h,5eh,56h,6ah,57h,cch,cah
+			db	45h,a4h,93h,c3h,a7h,93h,80h,53h
+			db	68h,13h,26h,f9h,f4h,d2h,bch,f3h
+			db	f3h,f9h,eah,7bh,99h,2bh,40h,afh
+			db	feh,4fh,45h,91h,0eh,30h,21h,f0h
+			db	f8h,aah,3eh,dah,a1h,91h,4fh,c8h
+			db	49h,81h,32h,bbh,4dh,3fh,75h,7bh
+			db	c9h,b0h,51h,8ah,8dh,abh,93h,87h
+			db	53h,0fh,ach,eeh,29h,f8h,35h,c9h
+			db	5dh,0dh,f3h,87h,69h,e2h,08h,73h
+			db	58h,65h,f2h,8ch,5dh,53h,03h,bfh
+			db	78h,e9h,c6h,6bh,9ch,93h,43h,a5h
+			db	47h,a4h,ceh,89h,fah,afh,3eh,cch
+			db	b0h,50h,1bh,d4h,28h,58h,dbh,7bh
+			db	d3h,b6h,dch,6ah,b2h,48h,b9h,abh
+			db	b0h,e4h,48h,f9h,bah,81h,f7h,fch
+			db	00h,fbh,8bh,f2h,b2h,3fh,48h,d2h
+			db	33h,0ch,6ch,11h,85h,e4h,66h,e0h
+			db	d9h,29h,6fh,0ah,b5h,abh,97h,7bh
+			db	3ch,b7h,4bh,68h,14h,16h,88h,b2h
+			db	ech,51h,a9h,9ch,08h,f0h,ddh,afh
+			db	42h,7ch,42h,7ch,6bh,e8h,35h,58h
+			db	00h,13h,e6h,f2h,21h,edh,a8h,8ah
+			db	1eh,efh,cah,45h,adh,ebh,cch,2fh
+			db	72h,44h,4ah,46h,0fh,d1h,d2h,3fh
+			db	76h,47h,e5h,f1h,48h,1eh,bah,ddh
+			db	79h,b5h,65h,7ah,90h,96h,79h,2bh
+			db	bfh,a3h,cch,a3h,0dh,64h,0eh,deh
+			db	08h,05h,8fh,c4h,89h,c3h,07h,e8h
+			db	feh,30h,23h,d0h,2fh,16h,6fh,c2h
+			db	3dh,d7h,89h,d0h,50h,fbh,9dh,9ch
+			db	6ah,81h,28h,e3h,16h,9ch,a5h,5dh
+			db	79h,c1h,8ch,3bh,aeh,3eh,8dh,b1h
+			db	33h,11h,83h,8eh,4dh,2dh,c6h,6ah
+			db	6dh,3dh,1ah,a7h,4bh,0fh,8ah,8fh
+			db	c3h,adh,00h,13h,5bh,aah,65h,22h
+			db	cch,08h,96h,47h,67h,b9h,84h,33h
+			db	6fh,61h,9dh,f6h,8ah,67h,93h,43h
+			db	19h,89h,52h,49h,a3h,05h,bdh,66h
+			db	95h,03h,c5h,2eh,e8h,36h,a5h,dah
+			db	5eh,55h,56h,9ch,4dh,73h,f8h,ceh
+			db	b1h,02h,ddh,35h,6dh,50h,cbh,30h
+			db	c7h,9ah,51h,7ch,fah,adh,f1h,37h
+			db	bfh,48h,60h,8eh,30h,b3h,2eh,51h
+			db	85h,77h,cfh,e6h,d9h,8ah,36h,94h
+			db	05h,7ch,97h,9dh,6fh,a7h,5ah,fdh
+			db	c9h,fdh,17h,97h,73h,9ah,35h,f9h
+			db	b0h,4eh,bch,c6h,9ah,a0h,b9h,98h
+			db	1dh,0bh,5eh,adh,12h,08h,03h,b5h
+			db	0fh,15h,adh,9eh,58h,5bh,12h,1ah
+			db	92h,e0h,e1h,d8h,9fh,05h,31h,ach
+			db	1bh,3ah,5dh,28h,e6h,8ch,f6h,d6h
+			db	a6h,e0h,08h,fah,d4h,abh,22h,b5h
+			db	45h,adh,f7h,3eh,a5h,b8h,e5h,01h
+			db	c8h,1ah,7ch,ebh,12h,b2h,4ch,d9h
+			db	e2h,31h,39h,9dh,6ch,d0h,adh,13h
+			db	10h,e1h,7ah,e2h,90h,41h,68h,beh
+			db	98h,3ah,dbh,63h,8fh,17h,75h,12h
+			db	edh,e4h,9bh,dch,31h,46h,a5h,bfh
+			db	6ah,4fh,08h,d8h,cah,87h,37h,06h
+			db	eah,b2h,52h,f9h,98h,84h,80h,a5h
+			db	44h,bfh,e9h,edh,f4h,86h,20h,eah
+			db	64h,4dh,a8h,dch,8ch,79h,68h,d8h
+			db	c0h,71h,a1h,2ah,a7h,40h,bdh,3ah
+			db	9bh,99h,07h,12h,a6h,24h,33h,a5h
+			db	67h,0ch,a4h,f4h,04h,77h,8ch,fdh
+			db	1eh,5dh,adh,fch,33h,4fh,afh,c6h
+			db	5eh,26h,89h,85h,24h,71h,f8h,4eh
+			db	48h,edh,5bh,2dh,ech,75h,66h,65h
+			db	f8h,2ch,26h,d5h,44h,62h,f7h,51h
+			db	96h,b0h,7ch,c2h,10h,52h,aeh,f6h
+			db	d5h,f5h,fbh,15h,98h,a5h,bfh,6eh
+			db	4ah,d4h,76h,5ch,75h,b7h,82h,a3h
+			db	05h,a5h,4eh,08h,2fh,b4h,17h,15h
+			db	0ch,00h,79h,e3h,c9h,21h,bah,f3h
+			db	06h,d9h,4fh,afh,d3h,3ch,66h,bbh
+			db	18h,40h,92h,3dh,26h,15h,68h,43h
+			db	9ch,bah,b0h,70h,71h,05h,c1h,f5h
+			db	dch,84h,87h,bah,0dh,dch,4fh,c4h
+			db	29h,bch,f4h,5fh,05h,e0h,30h,06h
+			db	15h,8ah,56h,8ah,f6h,7dh,7fh,7bh
+			db	94h,f7h,a0h,ech,b5h,95h,83h,eeh
+			db	aah,68h,95h,92h,68h,1dh,beh,bah
+			db	e4h,9fh,3bh,27h,0bh,fch,24h,0bh
+			db	fah,7bh,a6h,56h,c5h,a0h,10h,9ch
+			db	d9h,eeh,5dh,c4h,09h,85h,10h,17h
+			db	60h,bah,bfh,36h,dch,deh,d0h,12h
+			db	beh,c1h,39h,e7h,2ah,e7h,aeh,09h
+			db	f1h,b5h,b9h,36h,69h,c1h,53h,9fh
+			db	76h,cdh,84h,f6h,b8h,37h,0bh,2ch
+			db	1fh,40h,9fh,b5h,81h,75h,b2h,0ah
+			db	f0h,f8h,d0h,fdh,a8h,5eh,c9h,e6h
+			db	ebh,13h,8ah,96h,88h,9dh,17h,9dh
+			db	6bh,71h,a0h,f3h,f9h,1fh,7fh,afh
+			db	f1h,98h,5dh,49h,40h,0eh,14h,a0h
+			db	d1h,b4h,2ah,4ch,cfh,31h,27h,00h
+			db	cch,dbh,1eh,c3h,75h,1bh,89h,46h
+			db	2fh,5fh,7fh,74h,1eh,cch,d4h,7eh
+			db	f7h,06h,8dh,96h,1fh,7bh,64h,f7h
+			db	b4h,abh,8fh,3bh,07h,bfh,7bh,61h
+			db	dah,6bh,e4h,17h,f8h,10h,66h,89h
+			db	f0h,66h,05h,deh,88h,20h,25h,fbh
+			db	16h,ddh,c8h,46h,09h,39h,06h,c3h
+			db	9fh,79h,a9h,f1h,5ah,67h,f9h,28h
+			db	67h,f8h,e9h,85h,c5h,70h,96h,2ch
+			db	31h,fbh,4eh,75h,beh,f2h,c7h,ebh
+			db	bah,79h,59h,7fh,49h,37h,0ch,8ah
+			db	5ah,0dh,dah,e9h,b9h,f8h,29h,04h
+			db	53h,ebh,bch,2ah,11h,14h,51h,8fh
+			db	10h,c6h,a8h,5ah,6dh,0fh,1dh,51h
+			db	95h,4ah,8dh,49h,04h,c3h,51h,edh
+			db	f1h,1dh,fdh,7bh,56h,37h,52h,2bh
+			db	53h,aah,e5h,f9h,b2h,9bh,74h,19h
+			db	59h,16h,19h,e8h,10h,39h,c7h,e5h
+			db	36h,4ah,84h,55h,00h,9bh,45h,54h
+			db	2fh,75h,0eh,15h,20h,a6h,34h,beh
+			db	f8h,cah,5ah,f8h,bch,78h,c5h,adh
+			db	f7h,48h,64h,6ch,97h,a2h,48h,beh
+			db	3ch,98h,4fh,03h,20h,81h,7eh,32h
+			db	d8h,2ch,cbh,37h,c6h,69h,2bh,d3h
+			db	3dh,cch,dah,cbh,c3h,a9h,b4h,3eh
+			db	a2h,07h,eeh,8ah,16h,b5h,2bh,e5h
+			db	70h,7bh,87h,20h,ech,cbh,4ah,1eh
+			db	67h,22h,a7h,18h,57h,29h,8bh,cbh
+			db	39h,41h,7eh,a1h,4eh,41h,58h,e9h
+			db	f2h,6dh,63h,9ah,2bh,7ch,07h,5eh
+			db	8ch,5ah,bdh,c7h,23h,c4h,3ah,23h
+			db	3ah,68h,e9h,f4h,abh,07h,e2h,d9h
+			db	28h,32h,3ah,e3h,e6h,a9h,bdh,c0h
+			db	60h,8ch,9ch,65h,a2h,9fh,04h,1ah
+			db	06h,18h,e3h,74h,fch,7ah,75h,bdh
+			db	77h,9ah,8ch,efh,d9h,26h,03h,32h
+			db	11h,29h,dah,f8h,70h,4fh,fah,abh
+			db	dah,13h,eah,f2h,47h,1ah,9ah,eah
+			db	7dh,4bh,b8h,dbh,f6h,43h,82h,71h
+			db	7dh,2eh,e8h,a8h,29h,e6h,3ah,15h
+			db	0ch,75h,a1h,6ch,deh,38h,41h,73h
+			db	a1h,ffh,7ah,ceh,e2h,09h,65h,0ah
+			db	84h,2bh,1ch,79h,8fh,71h,39h,64h
+			db	66h,7ah,a0h,a8h,93h,cch,31h,10h
+			db	dfh,93h,94h,f5h,b0h,feh,05h,89h
+			db	09h,46h,07h,a9h,02h,2dh,b3h,a5h
+			db	fbh,a0h,0fh,cbh,1ch,28h,7bh,6bh
+			db	75h,f3h,0ah,88h,14h,cbh,c2h,ddh
+			db	56h,d4h,4ah,4dh,03h,dch,94h,d9h
+			db	38h,f2h,71h,83h,66h,5fh,49h,11h
+			db	c5h,06h,fdh,4dh,52h,afh,3fh,c6h
+			db	a2h,ddh,b5h,d3h,c7h,88h,ceh,d1h
+			db	f9h,f5h,b9h,4ch,a8h,a9h,86h,8ch
+			db	84h,1bh,d8h,6dh,d8h,5ah,b9h,cah
+			db	fch,b5h,2bh,ebh,28h,f3h,b9h,c9h
+			db	0bh,09h,f1h,25h,6bh,9eh,dch,36h
+			db	82h,38h,a6h,8fh,cbh,3ah,18h,dfh
+			db	45h,8bh,4fh,71h,4ah,32h,08h,5ah
+			db	62h,aeh,a3h,4eh,5dh,c7h,9ah,e1h
+			db	5dh,f1h,b2h,4bh,18h,1dh,71h,c2h
+			db	e0h,f2h,96h,08h,16h,86h,a3h,c1h
+			db	88h,fdh,f7h,7eh,d2h,deh,65h,6ah
+			db	1eh,c4h,23h,cch,3dh,1dh,64h,c9h
+			db	b1h,c1h,8dh,70h,0fh,0dh,51h,f6h
+			db	bah,abh,51h,49h,25h,0ch,4dh,65h
+			db	1fh,a9h,27h,7dh,eah,a4h,20h,67h
+			db	93h,f3h,66h,e0h,66h,01h,b8h,93h
+			db	9fh,71h,f2h,32h,20h,60h,fbh,b7h
+			db	b8h,7ah,72h,dfh,d7h,4bh,b6h,64h
+			db	20h,c9h,aeh,32h,22h,bbh,ceh,23h
+			db	edh,b1h,0ch,47h,5fh,40h,fdh,7dh
+			db	96h,07h,6bh,57h,16h,42h,18h,2ah
+			db	b4h,edh,14h,b8h,63h,c7h,dfh,29h
+			db	b0h,dbh,11h,f5h,17h,e0h,18h,31h
+			db	e2h,0dh,fch,35h,7fh,eah,3dh,27h
+			db	0dh,cdh,42h,80h,c8h,e1h,bah,b9h
+			db	f1h,31h,f0h,e6h,7eh,63h,b4h,bfh
+			db	d9h,28h,dfh,ebh,83h,96h,fdh,b4h
+			db	01h,c2h,f3h,4ah,92h,bch,20h,e5h
+			db	05h,a2h,fch,cfh,7dh,15h,6ch,ceh
+			db	4fh,d1h,ffh,c0h,c5h,beh,16h,c1h
+			db	24h,a7h,0eh,99h,f0h,f5h,13h,aah
+			db	94h,88h,1ch,a2h,26h,ach,fch,dbh
+			db	62h,e2h,72h,95h,5dh,6eh,37h,f0h
+			db	94h,a5h,f6h,11h,97h,cbh,a7h,5ah
+			db	d7h,94h,33h,12h,51h,b4h,96h,61h
+			db	c0h,b4h,8eh,43h,34h,4dh,0ah,05h
+			db	6bh,f7h,36h,7dh,dch,29h,afh,2fh
+			db	75h,adh,4bh,85h,4fh,3ch,2dh,d6h
+			db	d2h,13h,11h,b6h,d4h,ach,15h,22h
+			db	f3h,aeh,8ah,28h,82h,10h,5ch,93h
+			db	ech,d4h,e2h,99h,53h,4ah,4eh,1bh
+			db	50h,f6h,dfh,abh,6ch,94h,ceh,35h
+			db	a4h,7ch,0bh,50h,29h,f3h,06h,7fh
+			db	a4h,beh,93h,5dh,beh,0fh,d6h,f4h
+			db	9dh,99h,5dh,e1h,73h,f5h,99h,7eh
+			db	bah,b5h,16h,00h,6bh,a1h,8eh,42h
+			db	78h,24h,76h,c0h,04h,f9h,72h,b8h
+			db	dbh,84h,a3h,d0h,8ah,08h,bbh,d6h
+			db	94h,15h,33h,dbh,a5h,a0h,a9h,96h
+			db	8eh,c6h,07h,79h,fdh,17h,19h,e7h
+			db	bah,22h,19h,87h,62h,37h,5eh,b3h
+			db	2ch,00h,95h,9eh,9fh,1fh,9dh,43h
+			db	4ch,84h,8bh,30h,00h,66h,26h,02h
+			db	88h,b9h,55h,65h,a7h,50h,e4h,c4h
+			db	e2h,1dh,cdh,09h,75h,28h,51h,69h
+			db	cfh,afh,16h,59h,c4h,b2h,eah,84h
+			db	3ch,84h,51h,bfh,02h,a5h,7fh,62h
+			db	27h,4ah,a3h,9ah,40h,7ah,d6h,84h
+			db	43h,aeh,8ch,bbh,5eh,a3h,57h,b7h
+			db	c8h,a1h,efh,e5h,80h,7bh,74h,d7h
+			db	e4h,52h,95h,dch,2dh,94h,9ch,5fh
+			db	09h,39h,98h,2bh,a6h,3ch,27h,3ah
+			db	8bh,7ch,56h,28h,c4h,51h,dbh,5bh
+			db	e1h,abh,59h,cch,31h,6bh,43h,e8h
+			db	4ah,b8h,afh,2dh,08h,1dh,9eh,85h
+			db	bch,b6h,07h,dbh,7ch,68h,55h,84h
+			db	c5h,18h,0bh,e5h,b9h,8eh,91h,bdh
+			db	4eh,5eh,93h,79h,89h,ach,fdh,44h
+			db	2ch,87h,64h,14h,56h,2bh,57h,5fh
+			db	8eh,f1h,71h,eeh,04h,99h,16h,f2h
+			db	05h,25h,4dh,38h,3ch,57h,f6h,41h
+			db	40h,49h,9dh,5ch,62h,9dh,1bh,20h
+			db	52h,bdh,e5h,ech,ceh,7dh,82h,0ah
+			db	97h,98h,ech,edh,b9h,48h,01h,55h
+			db	8dh,b0h,20h,b3h,cch,88h,e9h,f8h
+			db	efh,07h,edh,3bh,30h,b7h,12h,6eh
+			db	2bh,d3h,04h,d1h,d8h,c2h,56h,62h
+			db	60h,bdh,5bh,e3h,23h,04h,7fh,6fh
+			db	84h,6bh,84h,68h,45h,f6h,cah,7fh
+			db	c5h,21h,71h,4ah,9bh,9bh,7ch,b7h
+			db	6ch,b4h,a1h,d9h,04h,3bh,5eh,2ah
+			db	69h,06h,94h,fbh,cbh,8ah,42h,a0h
+			db	0eh,02h,46h,90h,12h,d8h,37h,45h
+			db	e5h,49h,9ch,7ah,3ah,aeh,16h,40h
+			db	d2h,19h,a0h,a0h,ach,fbh,8ch,34h
+			db	a5h,85h,e9h,b4h,21h,36h,beh,17h
+			db	e1h,e0h,cdh,3dh,b8h,14h,3eh,4dh
+			db	6eh,5eh,f3h,96h,c7h,7ah,78h,6dh
+			db	fbh,26h,08h,58h,0eh,5bh,0dh,65h
+			db	77h,21h,c5h,62h,c1h,dah,5ah,a6h
+			db	f8h,9eh,45h,f3h,e2h,14h,1bh,97h
+			db	46h,7fh,4dh,72h,ddh,97h,fah,86h
+			db	17h,55h,8dh,a0h,f5h,d7h,86h,31h
+			db	17h,b7h,bbh,deh,e7h,03h,92h,56h
+			db	31h,57h,3dh,3eh,80h,fbh,7eh,efh
+			db	5ah,78h,1eh,3eh,48h,c2h,74h,8eh
+			db	7bh,82h,bdh,e4h,9ch,bfh,ach,43h
+			db	67h,62h,d6h,01h,d8h,ceh,72h,4bh
+			db	6ch,46h,88h,36h,0ah,94h,91h,fdh
+			db	4eh,f6h,cah,f5h,8eh,2dh,09h,8ch
+			db	83h,30h,6fh,96h,84h,77h,f9h,5bh
+			db	edh,0dh,81h,29h,ebh,4eh,3dh,c5h
+			db	84h,b1h,c3h,c5h,b0h,5dh,39h,6eh
+			db	abh,f6h,abh,40h,e2h,6fh,35h,43h
+			db	14h,7fh,25h,32h,1dh,11h,eeh,84h
+			db	73h,1eh,bah,09h,b6h,2eh,2fh,81h
+			db	d8h,62h,05h,b1h,59h,3fh,d8h,a3h
+			db	11h,71h,7bh,3ah,c3h,49h,2fh,9dh
+			db	49h,b4h,35h,43h,d5h,6bh,49h,8fh
+			db	56h,87h,69h,19h,e1h,bah,c7h,9dh
+			db	04h,e9h,e5h,00h,ffh,c2h,d0h,55h
+			db	62h,fdh,8fh,fdh,84h,e3h,dbh,84h
+			db	44h,46h,f0h,0fh,06h,f6h,a2h,4dh
+			db	65h,01h,edh,66h,26h,9ah,28h,14h
+			db	7dh,38h,a7h,74h,2fh,15h,1eh,eah
+			db	08h,a4h,31h,2eh,e3h,1eh,32h,0fh
+			db	09h,ach,d8h,fch,49h,9bh,abh,9eh
+			db	fbh,d6h,74h,2dh,95h,9eh,d7h,feh
+			db	c0h,bbh,4fh,95h,6fh,5ah,29h,4fh
+			db	26h,3dh,98h,44h,19h,71h,29h,4ah
+			db	0eh,3dh,f4h,cfh,71h,40h,46h,2ah
+			db	3fh,48h,bdh,57h,b9h,21h,4eh,28h
+			db	46h,6ch,bah,2ah,cah,5ah,2ah,e7h
+			db	6dh,bah,f3h,46h,f9h,dfh,40h,b7h
+			db	b9h,7ch,03h,80h,c1h,76h,9ah,a7h
+			db	6ch,9ch,48h,f3h,1dh,e1h,5bh,96h
+			db	2ch,68h,94h,feh,45h,64h,11h,86h
+			db	29h,c4h,e3h,ech,70h,5bh,92h,26h
+			db	15h,16h,8fh,c8h,b6h,b3h,4ah,f2h
+			db	3ah,99h,6ah,dch,b7h,b1h,4ah,90h
+			db	83h,dfh,12h,7fh,a4h,b9h,afh,deh
+			db	41h,94h,6dh,bfh,22h,a4h,9dh,78h
+			db	25h,f1h,a3h,d7h,beh,9eh,03h,5eh
+			db	7eh,5eh,4ah,b8h,16h,13h,38h,abh
+			db	4ah,5ah,5eh,4fh,d9h,ceh,2ch,d9h
+			db	d8h,33h,4eh,85h,edh,a8h,1eh,e9h
+			db	3ah,67h,47h,ebh,55h,adh,92h,61h
+			db	d8h,7dh,6dh,6ah,81h,24h,9dh,8eh
+			db	90h,2dh,b9h,38h,10h,f2h,4dh,d6h
+			db	e1h,bfh,eeh,27h,9ah,05h,4bh,5fh
+			db	65h,dfh,b2h,96h,d9h,23h,6ah,0dh
+			db	d0h,6fh,71h,f6h,d9h,bch,77h,24h
+			db	bdh,75h,9ch,d6h,68h,abh,efh,69h
+			db	88h,51h,6eh,0eh,d0h,26h,63h,aeh
+			db	b3h,62h,13h,0fh,f2h,ceh,41h,0dh
+			db	51h,74h,2ah,ceh,82h,7dh,a6h,13h
+			db	c5h,e4h,f2h,51h,7bh,05h,4eh,69h
+			db	91h,cah,f4h,a1h,a4h,0fh,2ch,abh
+			db	3bh,cch,47h,97h,49h,f6h,67h,a2h
+			db	6eh,1ch,b3h,04h,90h,2eh,bbh,39h
+			db	49h,aah,56h,b5h,36h,37h,4eh,72h
+			db	e1h,6eh,03h,7dh,ech,f8h,93h,91h
+			db	0ah,11h,3bh,1dh,8ch,ffh,19h,bdh
+			db	bdh,a7h,24h,d5h,36h,79h,08h,90h
+			db	00h,33h,fbh,2eh,e5h,14h,25h,1ch
+			db	7bh,d5h,65h,c8h,47h,fbh,0fh,a8h
+			db	43h,6fh,bbh,4bh,77h,3eh,abh,2eh
+			db	b8h,33h,86h,adh,c1h,9eh,c6h,d4h
+			db	a9h,7ah,33h,68h,fah,9bh,fbh,90h
+			db	6ah,9dh,0fh,96h,6ch,89h,57h,b2h
+			db	e6h,6eh,4eh,62h,89h,13h,07h,39h
+			db	68h,c8h,f4h,ebh,feh,54h,95h,f3h
+			db	28h,fdh,86h,c8h,2eh,dah,4ch,8dh
+			db	f2h,38h,f0h,49h,0eh,29h,f5h,aah
+			db	a8h,b4h,0fh,6ch,03h,1eh,eeh,feh
+			db	cfh,aeh,82h,f2h,36h,b3h,58h,5bh
+			db	efh,aeh,51h,14h,13h,47h,fch,7fh
+			db	20h,92h,72h,a0h,43h,d1h,5bh,98h
+			db	c5h,69h,c9h,65h,30h,9fh,d4h,5ch
+			db	e5h,0fh,d0h,21h,f1h,50h,7bh,c0h
+			db	12h,27h,8ch,b8h,53h,60h,18h,74h
+			db	a1h,6ch,01h,c5h,91h,8dh,3dh,a1h
+			db	a5h,d9h,d3h,7dh,84h,05h,24h,14h
+			db	30h,1ch,b5h,6bh,03h,d1h,e5h,7dh
+			db	92h,1ah,adh,0bh,7fh,48h,70h,7bh
+			db	6eh,75h,a6h,0ch,0ch,56h,bdh,f2h
+			db	79h,dah,fdh,7ah,76h,d3h,7ch,a7h
+			db	ddh,58h,c5h,e2h,4ch,ech,91h,69h
+			db	8bh,7dh,5dh,3ah,dbh,07h,c3h,79h
+			db	20h,2eh,a3h,d1h,c4h,81h,34h,8bh
+			db	1ch,ach,34h,4eh,f7h,61h,53h,0fh
+			db	c4h,23h,f6h,43h,25h,08h,efh,f7h
+			db	8ah,96h,f0h,93h,30h,a4h,43h,f8h
+			db	a2h,d2h,61h,1dh,0ch,bdh,70h,f8h
+			db	79h,71h,5bh,66h,dbh,94h,3dh,46h
+			db	9ch,6fh,61h,83h,92h,8ah,47h,a1h
+			db	b2h,f1h,d3h,73h,78h,dbh,beh,11h
+			db	19h,60h,e9h,87h,7fh,76h,94h,59h
+			db	bbh,38h,45h,f8h,b0h,7fh,dfh,60h
+			db	79h,efh,83h,06h,cfh,bbh,6bh,9eh
+			db	cdh,e9h,0dh,a7h,0ah,ddh,46h,bbh
+			db	f9h,a4h,72h,a6h,3fh,39h,b7h,c1h
+			db	6fh,deh,3ah,deh,7bh,cdh,48h,88h
+			db	23h,e1h,e9h,94h,4eh,1dh,98h,afh
+			db	1ah,9ah,03h,82h,0ah,85h,feh,8ah
+			db	03h,80h,6bh,02h,a0h,d6h,1bh,0ah
+			db	edh,03h,51h,1ch,b6h,f5h,d8h,e2h
+			db	dbh,e5h,f3h,f8h,11h,7eh,3eh,14h
+			db	26h,81h,d6h,8dh,6ah,3fh,3fh,71h
+			db	1ch,98h,4bh,c2h,52h,d1h,a3h,89h
+			db	d0h,44h,59h,7dh,51h,58h,29h,f2h
+			db	c3h,14h,24h,4fh,1fh,c9h,7eh,cbh
+			db	8dh,33h,c4h,55h,39h,03h,61h,3dh
+			db	62h,87h,e0h,a9h,73h,3fh,11h,93h
+			db	c2h,85h,c6h,85h,40h,83h,e6h,58h
+			db	a9h,72h,55h,28h,edh,4ah,2dh,47h
+			db	d3h,d2h,3bh,43h,05h,bah,1fh,f4h
+			db	1ch,71h,b5h,3eh,beh,31h,0ah,71h
+			db	a9h,10h,9eh,92h,a0h,2dh,45h,71h
+			db	f2h,e0h,0fh,9bh,ech,e9h,e7h,01h
+			db	5ch,99h,01h,ddh,adh,41h,51h,2eh
+			db	f9h,92h,a0h,10h,88h,e6h,35h,cah
+			db	1eh,b4h,2bh,7dh,a0h,31h,40h,9ah
+			db	d2h,beh,97h,58h,5bh,41h,03h,18h
+			db	9ch,1ch,90h,6ch,74h,15h,6ch,2bh
+			db	c2h,69h,e9h,89h,77h,92h,e4h,93h
+			db	1fh,59h,b1h,cfh,8ah,beh,ech,6ch
+			db	f5h,eeh,24h,7fh,5ah,4dh,6bh,47h
+			db	c2h,42h,e1h,0dh,a4h,3fh,6eh,43h
+			db	50h,3eh,4dh,c8h,f1h,b6h,97h,6eh
+			db	d5h,14h,bbh,29h,bbh,25h,22h,dah
+			db	6ah,8dh,86h,54h,34h,a1h,3ch,36h
+			db	eeh,deh,dah,fbh,89h,39h,4eh,5dh
+			db	f7h,23h,d1h,25h,d1h,23h,3ah,07h
+			db	4fh,15h,e7h,e4h,3dh,ech,bbh,ceh
+			db	d2h,82h,e3h,93h,83h,f0h,ffh,9dh
+			db	a9h,6eh,2ah,54h,b7h,57h,87h,7fh
+			db	eeh,2ah,3ah,0eh,abh,25h,bbh,b9h
+			db	68h,b2h,45h,a3h,56h,f7h,ddh,f9h
+			db	e3h,e6h,3fh,c8h,3eh,6ch,31h,ebh
+			db	20h,e9h,dfh,33h,feh,01h,3bh,fdh
+			db	2fh,b4h,43h,08h,98h,b6h,6ch,bah
+			db	a0h,0dh,fah,d8h,ddh,deh,81h,9dh
+			db	e8h,52h,e7h,d4h,b8h,a8h,71h,48h
+			db	b7h,f6h,a5h,1ch,c8h,66h,79h,dbh
+			db	5dh,ach,14h,57h,46h,42h,cch,58h
+			db	1dh,2dh,1ch,dah,3ah,5bh,7ch,3bh
+			db	d4h,ebh,13h,e6h,fch,cdh,1ch,23h
+			db	eah,6bh,2dh,02h,52h,eeh,dah,5ch
+			db	78h,98h,ceh,eeh,d6h,b7h,96h,2ch
+			db	fah,76h,9dh,f0h,8ah,e1h,ddh,35h
+			db	8bh,f6h,4bh,1eh,b7h,1eh,0dh,5eh
+			db	94h,1bh,d5h,b4h,61h,cfh,62h,c5h
+			db	16h,35h,e2h,6fh,8ah,ebh,ffh,31h
+			db	67h,0fh,ebh,6fh,95h,c0h,47h,32h
+			db	b1h,f6h,abh,84h,61h,eeh,feh,3ah
+			db	aeh,3bh,1bh,5eh,22h,a6h,ebh,9dh
+			db	52h,7eh,4eh,80h,a0h,f9h,a1h,4dh
+			db	cch,88h,cah,63h,cah,beh,eah,36h
+			db	19h,a3h,65h,1dh,68h,0ch,5fh,d4h
+			db	ech,5fh,cbh,78h,4dh,23h,96h,45h
+			db	0ch,feh,83h,00h,b0h,0eh,41h,18h
+			db	1bh,36h,30h,b4h,75h,3bh,e1h,85h
+			db	a7h,96h,a8h,09h,b8h,85h,1dh,fbh
+			db	a1h,7ah,a2h,1ch,d8h,8ch,0eh,35h
+			db	55h,aeh,34h,a4h,3ch,73h,c9h,9fh
+			db	8ch,79h,abh,fch,a1h,a8h,fdh,33h
+			db	f0h,d1h,1ah,55h,08h,23h,03h,24h
+			db	c3h,92h,22h,f3h,74h,9ah,8fh,76h
+			db	e2h,ech,d4h,a6h,f6h,e4h,51h,a5h
+			db	2eh,52h,c5h,e0h,a8h,fbh,1eh,e2h
+			db	6ch,3fh,bfh,49h,0dh,4eh,a6h,c7h
+			db	25h,aah,a3h,f0h,3eh,2ah,e6h,8fh
+			db	e9h,79h,52h,95h,e4h,cah,f0h,26h
+			db	97h,d4h,d0h,e6h,9eh,c6h,6eh,fdh
+			db	9fh,f4h,e3h,7eh,74h,10h,3dh,0ah
+			db	b5h,46h,a2h,2ch,86h,aeh,adh,18h
+			db	2dh,8ch,feh,efh,2eh,d4h,4ah,b0h
+			db	55h,46h,bbh,43h,90h,2ch,93h,21h
+			db	00h,abh,a5h,e9h,c3h,eah,09h,abh
+			db	58h,32h,3dh,3ch,c5h,c6h,4dh,adh
+			db	72h,41h,e4h,f6h,edh,ddh,e3h,f4h
+			db	a2h,23h,79h,30h,26h,43h,a0h,a2h
+			db	84h,adh,7eh,74h,58h,44h,2fh,56h
+			db	11h,49h,74h,6fh,a6h,c4h,18h,6ch
+			db	7dh,f2h,bfh,5ch,2fh,41h,36h,12h
+			db	0ch,02h,47h,47h,e6h,45h,12h,f7h
+			db	e7h,b5h,a8h,deh,45h,11h,cah,6dh
+			db	cbh,05h,77h,78h,2ah,d9h,37h,0eh
+			db	82h,97h,6fh,b6h,78h,00h,4fh,cch
+			db	73h,e3h,6ch,24h,dah,03h,1ch,a7h
+			db	9bh,86h,3fh,4fh,cah,34h,52h,0fh
+			db	71h,ach,1ah,b8h,bch,98h,ceh,d9h
+			db	cfh,83h,78h,e8h,b9h,1fh,f1h,d9h
+			db	2ah,36h,b9h,cch,1eh,d0h,53h,70h
+			db	f5h,63h,c7h,6eh,20h,3fh,7dh,00h
+			db	79h,75h,c2h,dbh,0ah,b0h,5ah,deh
+			db	c6h,83h,61h,2dh,b5h,57h,afh,46h
+			db	42h,abh,2eh,efh,d2h,88h,41h,9bh
+			db	75h,98h,56h,4ch,90h,aah,9dh,24h
+			db	0dh,2bh,41h,f7h,5bh,c0h,3eh,c2h
+			db	0ah,9ah,bch,e3h,90h,0dh,95h,dch
+			db	61h,b4h,52h,57h,95h,40h,9eh,adh
+			db	10h,f6h,71h,5fh,0ah,beh,02h,e2h
+			db	71h,6eh,35h,5eh,f2h,76h,cch,85h
+			db	9ah,7fh,cah,90h,adh,92h,dbh,abh
+			db	6ch,64h,c0h,b8h,71h,34h,8ah,00h
+			db	65h,8fh,03h,f9h,02h,31h,f5h,6fh
+			db	47h,5bh,3dh,bdh,d1h,9dh,a4h,e4h
+			db	1ch,b3h,f1h,bbh,e0h,2dh,0fh,d8h
+			db	56h,46h,cbh,43h,68h,27h,e1h,deh
+			db	61h,05h,28h,80h,88h,c8h,d1h,0fh
+			db	eeh,6fh,23h,72h,31h,9fh,5ah,7ah
+			db	4ah,8dh,36h,beh,99h,deh,efh,48h
+			db	4eh,ach,e9h,bdh,b0h,5fh,73h,84h
+			db	edh,53h,f9h,3bh,95h,79h,3fh,5dh
+			db	89h,b8h,4dh,b4h,c4h,28h,c2h,a6h
+			db	a3h,76h,40h,b5h,bch,c1h,b5h,b7h
+			db	43h,6eh,48h,2fh,ach,71h,b9h,6fh
+			db	1ah,0ah,91h,3dh,3bh,a0h,84h,03h
+			db	95h,80h,b6h,13h,d8h,f4h,fch,6dh
+			db	96h,36h,7ah,2dh,f2h,6dh,0ah,41h
+			db	76h,84h,6fh,62h,90h,55h,d9h,b2h
+			db	43h,03h,20h,dbh,0bh,cbh,e1h,53h
+			db	1ah,75h,45h,4ch,adh,19h,c0h,aeh
+			db	04h,f3h,2fh,49h,5ch,00h,08h,f7h
+			db	9eh,cah,19h,b7h,46h,68h,5bh,c4h
+			db	aeh,afh,5dh,c9h,71h,c0h,36h,9eh
+			db	30h,cdh,beh,c0h,85h,8ah,57h,deh
+			db	e3h,f6h,3ch,c9h,0ah,c7h,f1h,2dh
+			db	a7h,e9h,6ch,e6h,c2h,2bh,2fh,67h
+			db	ach,f6h,3ch,aah,01h,e2h,cfh,a3h
+			db	a3h,e3h,c9h,4bh,96h,b4h,7bh,f3h
+			db	cbh,7ah,50h,d5h,3dh,43h,39h,d5h
+			db	0ah,05h,39h,14h,3ah,93h,c8h,6dh
+			db	e4h,20h,d2h,43h,c3h,d6h,22h,bch
+			db	55h,f4h,57h,2dh,b1h,68h,78h,9fh
+			db	1bh,34h,4bh,e3h,dfh,87h,e9h,d0h
+			db	48h,4dh,69h,cfh,8fh,8ah,77h,33h
+			db	37h,b5h,fch,58h,74h,d4h,23h,aeh
+			db	f8h,0dh,25h,a8h,ach,51h,86h,53h
+			db	a8h,9dh,34h,d6h,3eh,0ah,cdh,34h
+			db	b3h,f3h,8ah,82h,4ah,fbh,b1h,c9h
+			db	6bh,68h,12h,8ah,a5h,d3h,cch,91h
+			db	82h,f8h,01h,c6h,53h,76h,75h,fdh
+			db	c1h,d0h,18h,feh,fbh,dbh,beh,1fh
+			db	2dh,dbh,53h,f6h,ffh,beh,25h,27h
+			db	bch,3bh,d7h,57h,a3h,4dh,61h,9dh
+			db	fah,57h,3dh,41h,adh,66h,08h,1dh
+			db	2fh,74h,d9h,71h,c1h,1eh,96h,1fh
+			db	35h,32h,5ch,ffh,58h,17h,32h,b1h
+			db	3ch,5bh,45h,50h,e2h,c4h,c6h,60h
+			db	6ah,53h,66h,7ah,7ch,a3h,21h,b6h
+			db	4ah,a3h,d9h,15h,fbh,c0h,52h,3ah
+			db	e3h,d9h,d7h,f8h,a9h,0eh,99h,36h
+			db	8fh,79h,b1h,36h,1ah,98h,76h,a0h
+			db	91h,d6h,65h,38h,f0h,beh,30h,92h
+			db	e5h,2dh,95h,6bh,8bh,2bh,1bh,d4h
+			db	b9h,24h,ebh,a3h,71h,04h,f0h,b0h
+			db	efh,24h,79h,c8h,79h,bdh,0eh,32h
+			db	d9h,7dh,afh,5dh,f3h,26h,f7h,94h
+			db	8fh,5fh,7ah,d5h,2bh,92h,b8h,99h
+			db	3ah,54h,62h,3fh,31h,1eh,a8h,d5h
+			db	63h,aeh,78h,e6h,13h,f9h,d4h,c8h
+			db	71h,3fh,54h,6eh,deh,6dh,f3h,6dh
+			db	aeh,39h,beh,75h,d0h,20h,beh,a8h
+			db	1ch,f4h,a9h,1ah,d5h,a7h,61h,c0h
+			db	16h,bfh,22h,75h,3bh,16h,b5h,a8h
+			db	0eh,71h,b5h,44h,d1h,1bh,cdh,b1h
+			db	71h,98h,4bh,71h,00h,21h,bah,cfh
+			db	ffh,11h,e1h,f0h,3ah,e5h,12h,90h
+			db	90h,3eh,7bh,c6h,71h,10h,10h,ech
+			db	14h,9ch,beh,e2h,eeh,c5h,b6h,ceh
+			db	88h,23h,fbh,a8h,beh,9ch,a5h,35h
+			db	d1h,c5h,66h,deh,90h,fch,fch,32h
+			db	59h,26h,95h,c9h,09h,e4h,bdh,17h
+			db	7bh,83h,1eh,b8h,92h,27h,6fh,f7h
+			db	a3h,64h,87h,94h,6ah,e7h,0ah,f9h
+			db	88h,30h,52h,19h,e1h,b7h,30h,0dh
+			db	64h,f2h,61h,c0h,49h,deh,fah,96h
+			db	b7h,c1h,c2h,d8h,39h,b3h,49h,17h
+			db	e3h,7fh,07h,7ch,deh,a6h,e8h,83h
+			db	44h,53h,d6h,1fh,58h,30h,6ch,28h
+			db	6fh,25h,42h,61h,c6h,bdh,dch,86h
+			db	d4h,11h,f8h,04h,e0h,dbh,cdh,88h
+			db	eah,38h,40h,a5h,12h,18h,a0h,7ah
+			db	bch,a6h,a5h,37h,0bh,5fh,e5h,f3h
+			db	cah,2eh,15h,3fh,aah,21h,02h,85h
+			db	1ch,88h,09h,01h,54h,a7h,80h,a9h
+			db	e2h,22h,eah,a5h,96h,8ch,05h,72h
+			db	9ah,d2h,d4h,84h,95h,29h,e1h,65h
+			db	77h,afh,d9h,c8h,c0h,1ah,97h,efh
+			db	29h,9eh,32h,a3h,cbh,4dh,43h,8fh
+			db	b7h,c1h,1fh,44h,3ch,7bh,41h,53h
+			db	86h,fdh,6ah,1eh,6bh,8fh,c7h,68h
+			db	d2h,b3h,9ch,8ch,dfh,17h,d1h,1fh
+			db	2ch,e6h,fbh,90h,6eh,14h,1fh,3dh
+			db	87h,11h,bch,62h,98h,ffh,86h,1eh
+			db	1bh,2fh,e1h,5bh,4bh,2eh,c8h,9fh
+			db	f5h,aeh,abh,c9h,3fh,52h,14h,35h
+			db	a9h,b3h,24h,44h,8ah,c3h,f8h,efh
+			db	efh,efh,30h,e5h,3ch,b2h,cch,83h
+			db	62h,b3h,c1h,40h,21h,c8h,5ch,56h
+			db	13h,0ch,12h,68h,54h,7eh,17h,d8h
+			db	16h,06h,62h,51h,c8h,e1h,72h,51h
+			db	10h,01h,92h,17h,31h,8ah,0fh,51h
+			db	d1h,9eh,e4h,b0h,6eh,45h,bfh,14h
+			db	eah,28h,c7h,62h,d6h,c4h,85h,a9h
+			db	40h,53h,aah,e6h,31h,17h,5dh,77h
+			db	d3h,72h,88h,04h,aeh,38h,beh,95h
+			db	c0h,a0h,e0h,81h,26h,a8h,b1h,ffh
+			db	bfh,8ah,ach,5eh,a3h,7ch,64h,cdh
+			db	25h,9ch,f8h,93h,ebh,9ah,10h,22h
+			db	5dh,a2h,51h,e7h,6eh,24h,e5h,e9h
+			db	d1h,04h,54h,2bh,82h,f8h,42h,5eh
+			db	11h,72h,6ch,5ah,95h,70h,6ch,99h
+			db	c9h,22h,57h,19h,89h,c0h,23h,c6h
+			db	01h,83h,59h,18h,2dh,30h,2eh,6fh
+			db	84h,3eh,c0h,e1h,f2h,11h,28h,efh
+			db	f4h,6ch,4dh,a9h,0bh,5eh,eah,a3h
+			db	10h,d9h,5dh,d9h,26h,8fh,aeh,98h
+			db	6fh,18h,b5h,deh,4ch,23h,f2h,15h
+			db	a0h,41h,0dh,34h,e1h,74h,62h,79h
+			db	18h,91h,22h,37h,9ch,f6h,6bh,08h
+			db	b2h,19h,4dh,12h,0fh,e0h,0ch,99h
+			db	1dh,feh,4dh,d1h,a8h,bah,36h,9eh
+			db	44h,e9h,53h,4eh,00h,1eh,8fh,adh
+			db	f0h,44h,dfh,b1h,3bh,04h,59h,d8h
+			db	6dh,e4h,e1h,85h,06h,e6h,f1h,22h
+			db	0dh,22h,05h,cbh,e6h,32h,92h,62h
+			db	9eh,48h,aeh,48h,61h,32h,d9h,fch
+			db	e2h,24h,01h,86h,c1h,f9h,fbh,22h
+			db	b2h,2ch,26h,81h,a5h,b6h,81h,f5h
+			db	5ah,7ch,b8h,d7h,b9h,bfh,f5h,75h
+			db	e1h,ddh,05h,c9h,a3h,a8h,8dh,61h
+			db	1eh,10h,8bh,e2h,ech,d2h,e9h,16h
+			db	26h,9fh,36h,8eh,b7h,beh,5ah,53h
+			db	8ch,c7h,fbh,16h,37h,cdh,f6h,0dh
+			db	61h,95h,d8h,65h,67h,b8h,13h,25h
+			db	5bh,4bh,24h,59h,5eh,58h,55h,47h
+			db	34h,cbh,a3h,0eh,1bh,c9h,0dh,52h
+			db	e1h,64h,35h,80h,a8h,ebh,0fh,a5h
+			db	27h,18h,d8h,91h,19h,e2h,0ah,02h
+			db	beh,87h,a9h,2dh,dah,6eh,60h,5dh
+			db	beh,73h,05h,30h,b3h,4bh,80h,b2h
+			db	2bh,62h,3ch,aah,10h,01h,d8h,e4h
+			db	57h,3bh,9bh,88h,adh,bbh,1eh,a2h
+			db	d0h,13h,1ah,71h,82h,60h,e1h,e8h
+			db	dfh,27h,a9h,abh,4dh,c3h,a2h,ach
+			db	40h,40h,c0h,05h,3ah,0eh,22h,e5h
+			db	0fh,12h,ach,ceh,c4h,7ah,b7h,42h
+			db	79h,08h,dfh,6dh,27h,dfh,a7h,08h
+			db	d3h,d8h,90h,8bh,f2h,93h,cah,eah
+			db	f1h,b2h,21h,03h,f4h,7fh,10h,2bh
+			db	6dh,9dh,70h,f7h,68h,1ch,32h,e0h
+			db	69h,32h,92h,45h,f7h,12h,40h,1dh
+			db	8fh,a8h,c8h,7fh,f2h,cch,41h,f7h
+			db	dbh,97h,10h,5bh,d8h,46h,2eh,e2h
+			db	54h,66h,49h,4dh,deh,c4h,a0h,3bh
+			db	3eh,f3h,20h,e7h,36h,02h,d2h,41h
+			db	79h,8dh,c1h,aeh,80h,01h,f3h,7fh
+			db	b3h,f7h,2dh,f6h,83h,b2h,13h,b2h
+			db	72h,26h,64h,d4h,ech,02h,75h,7dh
+			db	1ah,88h,98h,0ch,cdh,4dh,b7h,84h
+			db	76h,34h,deh,1ah,07h,6eh,3dh,e5h
+			db	c3h,8bh,6ch,fdh,0ah,9ch,8fh,f8h
+			db	7dh,49h,3ch,56h,40h,93h,ffh,9ah
+			db	afh,82h,79h,28h,a2h,30h,a1h,43h
+			db	dah,a3h,52h,5dh,83h,7bh,32h,e1h
+			db	bch,30h,32h,dah,2ah,a3h,b5h,77h
+			db	1ah,b1h,89h,c5h,1ah,18h,28h,80h
+			db	69h,10h,dch,46h,d5h,bah,d4h,f7h
+			db	14h,52h,d0h,bfh,f6h,f6h,d8h,13h
+			db	a6h,09h,75h,7eh,c7h,64h,cfh,8eh
+			db	feh,f1h,bfh,ebh,bdh,e0h,07h,b5h
+			db	e1h,8ch,16h,f3h,f3h,5fh,46h,4ah
+			db	8eh,2ah,b8h,7ch,f9h,eah,eeh,17h
+			db	81h,94h,d6h,bbh,2ah,81h,efh,dch
+			db	41h,3ch,27h,7dh,4dh,3ch,84h,56h
+			db	12h,f1h,9bh,a1h,a1h,bfh,6bh,03h
+			db	72h,ebh,58h,d9h,e9h,d0h,d8h,4bh
+			db	eeh,f6h,98h,ffh,35h,28h,76h,2eh
+			db	dah,25h,f3h,99h,c3h,b9h,37h,d8h
+			db	0bh,ffh,7ch,59h,74h,7fh,2dh,cbh
+			db	bfh,cch,4eh,19h,b9h,81h,69h,5bh
+			db	0fh,ebh,5dh,54h,62h,22h,4ch,42h
+			db	f7h,00h,2dh,deh,14h,b1h,56h,2fh
+			db	59h,49h,93h,29h,e3h,4dh,57h,f4h
+			db	3fh,62h,e5h,9bh,2eh,75h,02h,b4h
+			db	99h,51h,fah,ach,9ah,f7h,68h,7fh
+			db	45h,e3h,81h,90h,cbh,5fh,73h,adh
+			db	38h,b4h,e3h,82h,34h,3ah,a8h,7eh
+			db	cbh,3bh,98h,09h,a3h,60h,c1h,9fh
+			db	61h,21h,25h,24h,34h,42h,2fh,4dh
+			db	bfh,4dh,deh,2ah,61h,88h,55h,ddh
+			db	0dh,6ch,b6h,a0h,7fh,2ch,78h,9bh
+			db	96h,9bh,3fh,25h,d1h,ach,2ah,f6h
+			db	09h,2dh,52h,28h,60h,0eh,00h,74h
+			db	4bh,3fh,e4h,3fh,a2h,91h,6ch,e9h
+			db	21h,cbh,87h,9fh,3ch,adh,89h,d8h
+			db	23h,3fh,4eh,7fh,6bh,5ch,47h,f0h
+			db	5ah,a5h,d2h,f1h,88h,4ah,9dh,cch
+			db	eeh,26h,3ch,e0h,4ch,5eh,0eh,bbh
+			db	63h,f1h,a2h,c1h,83h,7fh,58h,27h
+			db	0ah,f5h,24h,cbh,30h,71h,f7h,c7h
+			db	6eh,adh,49h,a3h,b2h,bdh,4fh,29h
+			db	96h,c1h,fdh,79h,ach,57h,38h,c8h
+			db	9fh,5dh,99h,13h,1bh,06h,66h,2ah
+			db	15h,b5h,e3h,f4h,cbh,9ah,08h,40h
+			db	71h,c2h,23h,24h,ach,ech,adh,82h
+			db	5eh,04h,52h,8dh,29h,49h,47h,6dh
+			db	9bh,adh,87h,b7h,21h,e7h,79h,efh
+			db	2ah,ebh,dfh,fah,efh,7fh,c5h,78h
+			db	eah,a3h,61h,f3h,90h,97h,fch,b0h
+			db	7bh,a8h,fah,28h,25h,69h,31h,15h
+			db	45h,23h,68h,2bh,fch,b0h,1ah,8ah
+			db	4ah,07h,11h,c4h,6dh,86h,0eh,a5h
+			db	75h,17h,b1h,03h,6dh,abh,2ch,0dh
+			db	edh,f1h,f3h,2dh,3eh,42h,53h,10h
+			db	ddh,a6h,35h,f9h,7fh,76h,85h,8eh
+			db	1eh,a1h,b9h,bfh,11h,5ch,7fh,49h
+			db	21h,09h,cah,64h,39h,8ah,adh,c0h
+			db	9ch,4ch,63h,99h,c5h,c1h,02h,e4h
+			db	bbh,22h,b4h,1bh,0bh,39h,8eh,4fh
+			db	0ch,88h,b0h,b4h,cdh,e8h,40h,59h
+			db	6fh,d7h,35h,5dh,e0h,6eh,c5h,41h
+			db	21h,0eh,3fh,62h,38h,9eh,24h,14h
+			db	93h,58h,abh,27h,6bh,dbh,1bh,27h
+			db	30h,fah,c9h,2eh,24h,f6h,90h,aah
+			db	33h,6ah,49h,c8h,41h,cdh,b5h,c2h
+			db	72h,40h,a9h,19h,85h,07h,83h,c7h
+			db	6dh,1ch,39h,d2h,9eh,36h,7fh,5eh
+			db	84h,3ah,4ah,2dh,37h,82h,75h,15h
+			db	0eh,cbh,8ah,6fh,83h,17h,59h,ech
+			db	79h,dch,7eh,97h,63h,6ah,85h,d3h
+			db	26h,15h,c8h,8ch,28h,fah,95h,dfh
+			db	4dh,86h,1eh,c4h,e4h,d7h,64h,7ah
+			db	9eh,93h,cbh,f3h,78h,a5h,99h,4ah
+			db	26h,f0h,32h,c3h,d2h,44h,a4h,68h
+			db	17h,c2h,76h,0ah,01h,c6h,dbh,47h
+			db	deh,adh,88h,a8h,aah,55h,deh,88h
+			db	ddh,15h,11h,59h,d8h,a9h,e4h,dfh
+			db	ceh,f8h,59h,d4h,09h,4dh,6ch,22h
+			db	3dh,cfh,1fh,2eh,b1h,beh,17h,1dh
+			db	afh,a9h,73h,48h,a2h,82h,53h,3dh
+			db	bbh,f4h,1fh,00h,99h,eah,f0h,1ch
+			db	81h,a1h,21h,9eh,25h,94h,92h,3fh
+			db	a4h,fch,97h,2bh,f5h,e3h,e9h,76h
+			db	dfh,a4h,03h,fdh,c0h,0ah,3eh,a3h
+			db	63h,78h,b7h,88h,b9h,c7h,c6h,e4h
+			db	5ah,42h,fah,71h,79h,92h,7fh,54h
+			db	05h,8dh,b4h,4ah,48h,ach,5eh,1eh
+			db	a0h,05h,4bh,5ah,41h,beh,17h,50h
+			db	e1h,e2h,54h,5dh,5eh,6ch,d3h,9ah
+			db	aah,4dh,2dh,c4h,06h,afh,c5h,0ch
+			db	14h,47h,0ah,61h,58h,57h,7ch,9dh
+			db	76h,cfh,60h,f7h,11h,2fh,5dh,70h
+			db	60h,cah,9eh,ebh,18h,51h,cah,89h
+			db	55h,e6h,a4h,56h,05h,23h,32h,f3h
+			db	78h,beh,d1h,49h,4dh,aeh,0eh,91h
+			db	10h,12h,dch,41h,2ah,4bh,50h,6dh
+			db	7eh,bdh,e7h,91h,1fh,a0h,74h,88h
+			db	3bh,92h,63h,98h,7ch,beh,8eh,81h
+			db	3ah,0dh,0eh,68h,deh,0fh,0bh,0eh
+			db	53h,33h,c8h,19h,c5h,43h,d1h,9dh
+			db	afh,c8h,0ah,beh,70h,5dh,2ah,63h
+			db	7ch,4ch,ach,a9h,63h,92h,2eh,1bh
+			db	1dh,a9h,92h,6dh,5eh,adh,4eh,b5h
+			db	d4h,4fh,c6h,4ah,11h,5fh,9dh,d6h
+			db	21h,a2h,bfh,c8h,2ch,89h,73h,3ah
+			db	48h,aeh,4dh,86h,74h,3eh,3fh,57h
+			db	25h,2eh,0dh,3eh,abh,c4h,a0h,c8h
+			db	59h,66h,8fh,9dh,1ah,18h,55h,4fh
+			db	f7h,30h,60h,fdh,abh,5eh,c0h,f1h
+			db	6dh,07h,69h,feh,d1h,ffh,73h,05h
+			db	1bh,a5h,a1h,49h,61h,3bh,f8h,f8h
+			db	e3h,9fh,80h,6dh,48h,d2h,afh,afh
+			db	e2h,71h,34h,a3h,00h,c3h,21h,0ah
+			db	2eh,82h,fch,f5h,2ch,84h,49h,feh
+			db	62h,7bh,88h,3dh,c6h,33h,ech,32h
+			db	fbh,64h,d6h,86h,03h,06h,16h,17h
+			db	8ah,81h,d1h,8ah,4ah,40h,a7h,40h
+			db	2fh,e5h,72h,5ch,3eh,ffh,68h,dch
+			db	12h,23h,18h,22h,9bh,40h,1bh,5fh
+			db	abh,cbh,98h,78h,04h,7bh,14h,ach
+			db	07h,97h,d6h,1fh,09h,27h,ach,ech
+			db	0bh,cbh,aeh,e8h,d5h,79h,bbh,5eh
+			db	00h,3bh,e0h,2eh,dfh,d5h,6ah,65h
+			db	cah,4fh,02h,eah,9fh,a1h,09h,f4h
+			db	8ah,84h,ebh,16h,24h,7eh,36h,58h
+			db	8bh,77h,fdh,c0h,a1h,90h,7dh,11h
+			db	0bh,22h,4ah,d8h,1dh,48h,8bh,5bh
+			db	dfh,8ah,41h,aeh,2ah,c0h,b2h,a8h
+			db	b2h,a8h,3eh,4ah,f0h,90h,0bh,58h
+			db	42h,25h,87h,44h,02h,55h,11h,73h
+			db	0bh,36h,a2h,ffh,2ch,d0h,7ah,60h
+			db	14h,68h,feh,1eh,a6h,e7h,83h,0bh
+			db	23h,42h,65h,48h,a9h,3dh,37h,f6h
+			db	10h,26h,f4h,d7h,cbh,2ah,40h,beh
+			db	fdh,55h,3eh,56h,44h,dfh,2eh,ffh
+			db	d1h,c4h,f5h,14h,6fh,d5h,11h,70h
+			db	ebh,ach,2bh,bdh,c7h,e5h,17h,b1h
+			db	dch,cfh,8ah,66h,c3h,29h,87h,69h
+			db	ffh,06h,f6h,13h,bbh,92h,15h,d6h
+			db	d0h,c3h,42h,b1h,a4h,20h,82h,6bh
+			db	6ah,d4h,61h,6dh,98h,66h,01h,eah
+			db	dch,1bh,46h,46h,41h,29h,e5h,1eh
+			db	79h,03h,38h,04h,94h,90h,92h,2fh
+			db	f8h,beh,63h,7dh,88h,aeh,17h,e8h
+			db	42h,48h,63h,3ch,42h,65h,8eh,50h
+			db	17h,bbh,c7h,20h,09h,18h,f6h,47h
+			db	35h,afh,48h,a3h,0dh,b9h,98h,46h
+			db	a8h,00h,28h,aeh,2bh,7bh,d6h,aeh
+			db	c8h,b4h,52h,5eh,26h,87h,22h,09h
+			db	50h,a5h,5dh,47h,14h,dah,a5h,02h
+			db	c2h,e6h,3ch,79h,fdh,3ch,0dh,d9h
+			db	a4h,06h,a7h,34h,49h,b4h,6bh,efh
+			db	e0h,4bh,01h,50h,c5h,beh,cbh,28h
+			db	54h,34h,6ch,04h,10h,f1h,d6h,c5h
+			db	abh,24h,6dh,b9h,1bh,24h,0bh,81h
+			db	dch,afh,ech,45h,09h,16h,c5h,07h
+			db	44h,1dh,5bh,fdh,c3h,3fh,50h,21h
+			db	32h,8bh,13h,6dh,ceh,ffh,0fh,b4h
+			db	84h,b1h,a6h,69h,65h,deh,0dh,20h
+			db	04h,65h,7fh,e0h,bch,75h,4eh,02h
+			db	a8h,32h,53h,f3h,83h,cbh,d4h,dah
+			db	c2h,f1h,82h,50h,d0h,93h,91h,56h
+			db	69h,50h,14h,afh,fbh,44h,42h,68h
+			db	71h,fbh,4ah,a1h,4eh,2dh,bbh,77h
+			db	deh,2dh,0dh,20h,36h,02h,41h,3bh
+			db	8ch,63h,49h,4bh,4fh,e6h,6ah,d1h
+			db	5eh,60h,c4h,76h,11h,f4h,e6h,b8h
+			db	4bh,57h,70h,53h,7dh,5eh,4ch,a7h
+			db	1fh,cdh,42h,4bh,84h,85h,3fh,9fh
+			db	84h,35h,6ah,16h,19h,4fh,d9h,15h
+			db	07h,44h,9eh,83h,4fh,ech,fbh,aeh
+			db	c6h,4ah,47h,ach,eah,70h,80h,69h
+			db	27h,2bh,f7h,cbh,3ah,cch,67h,31h
+			db	fah,9dh,55h,f3h,44h,47h,e1h,b4h
+			db	7ch,96h,79h,36h,53h,c6h,89h,9ch
+			db	c3h,efh,e7h,1eh,77h,ddh,dah,a6h
+			db	34h,44h,0ah,33h,d6h,e3h,bah,1ah
+			db	53h,09h,f2h,21h,d3h,87h,9bh,99h
+			db	8bh,91h,8ah,05h,b8h,9ch,25h,d1h
+			db	f6h,e3h,0eh,46h,beh,d4h,ebh,8bh
+			db	d7h,c8h,52h,71h,abh,69h,2dh,6eh
+			db	2eh,ddh,80h,70h,6eh,2ah,16h,20h
+			db	39h,5bh,f8h,ach,cah,e2h,0ch,25h
+			db	bah,c3h,6dh,09h,4dh,20h,26h,c7h
+			db	80h,f4h,3fh,a1h,e3h,b1h,65h,c3h
+			db	73h,26h,fdh,88h,98h,16h,95h,b9h
+			db	91h,49h,f3h,ceh,dbh,9fh,bdh,a5h
+			db	4bh,b2h,09h,dch,80h,92h,40h,60h
+			db	4bh,9ah,c1h,68h,14h,73h,2ah,d7h
+			db	f6h,58h,a1h,11h,6fh,86h,57h,a3h
+			db	51h,61h,ddh,2ah,7bh,9ch,a1h,2fh
+			db	a7h,67h,b7h,a7h,f8h,3eh,d0h,17h
+			db	49h,dch,f2h,6bh,f4h,4dh,e0h,57h
+			db	77h,bdh,24h,02h,2bh,aeh,b4h,a0h
+			db	67h,1ch,c2h,68h,e8h,dfh,33h,1bh
+			db	a5h,8ch,a3h,e8h,d3h,83h,1eh,3eh
+			db	b8h,17h,98h,8eh,77h,96h,03h,74h
+			db	b0h,c6h,7eh,6fh,d0h,7dh,bdh,53h
+			db	70h,69h,38h,e7h,60h,f7h,d1h,f1h
+			db	d4h,f6h,5eh,efh,cah,afh,39h,1fh
+			db	89h,73h,4fh,23h,54h,55h,cch,86h
+			db	eeh,02h,43h,27h,e5h,cch,49h,01h
+			db	b9h,7fh,6ah,40h,9ch,d3h,fdh,cch
+			db	a8h,6bh,0ch,87h,e6h,2dh,bch,52h
+			db	17h,e6h,eah,03h,80h,c9h,c1h,81h
+			db	33h,4ah,51h,d6h,4fh,d8h,5ch,80h
+			db	32h,a2h,c9h,00h,c4h,74h,fbh,72h
+			db	3ch,dfh,60h,25h,b0h,92h,e9h,94h
+			db	f2h,30h,f6h,a0h,5fh,fdh,cdh,2bh
+			db	6ch,bdh,46h,6fh,3fh,79h,d5h,72h
+			db	50h,87h,9dh,88h,59h,feh,3ah,49h
+			db	3ch,cfh,7fh,5eh,31h,18h,7ah,efh
+			db	8dh,86h,c9h,27h,4bh,bch,04h,31h
+			db	d4h,40h,dbh,b4h,4bh,8ah,7ch,68h
+			db	6fh,9fh,a4h,91h,24h,deh,22h,2eh
+			db	0fh,79h,5dh,c8h,5dh,ech,efh,17h
+			db	d5h,40h,6eh,ebh,feh,a8h,f9h,92h
+			db	e6h,4ah,9dh,01h,93h,31h,1bh,7ah
+			db	5fh,7eh,2dh,82h,91h,a2h,23h,5ah
+			db	97h,72h,afh,61h,8bh,3eh,2bh,deh
+			db	d4h,3ah,03h,91h,c5h,54h,d1h,41h
+			db	f2h,9dh,07h,fch,6dh,cah,8dh,f9h
+			db	0ah,b5h,06h,32h,1dh,3eh,23h,92h
+			db	26h,4ah,ffh,04h,1ah,deh,eah,8bh
+			db	c4h,0ch,a1h,7ch,5bh,5fh,55h,72h
+			db	aah,23h,78h,46h,f2h,d6h,30h,9fh
+			db	fbh,a9h,97h,62h,66h,cdh,d1h,10h
+			db	c2h,b7h,aeh,f4h,efh,c9h,fdh,17h
+			db	7fh,a1h,21h,1fh,92h,98h,11h,9ah
+			db	1dh,4bh,07h,d6h,b6h,8eh,05h,90h
+			db	29h,f5h,cch,02h,91h,bah,15h,a7h
+			db	56h,24h,28h,6eh,b5h,d3h,c9h,07h
+			db	22h,38h,c5h,35h,1dh,02h,70h,abh
+			db	99h,35h,b9h,3ch,6eh,e7h,27h,28h
+			db	bfh,6ch,cdh,cch,5dh,2ah,cfh,93h
+			db	9eh,62h,05h,0eh,deh,54h,b0h,cfh
+			db	1bh,d4h,1bh,c8h,f4h,8bh,b2h,26h
+			db	eah,bdh,a7h,3dh,9eh,3bh,dfh,08h
+			db	19h,27h,13h,aeh,0ah,03h,0ch,48h
+			db	92h,7eh,6dh,a0h,d1h,19h,86h,5fh
+			db	3eh,52h,d4h,d2h,d6h,bch,cdh,97h
+			db	40h,66h,b8h,dah,64h,0ch,85h,2bh
+			db	a9h,11h,7eh,85h,fah,2ch,bbh,4ch
+			db	92h,3ch,8dh,51h,e2h,c7h,a7h,4bh
+			db	43h,b7h,6bh,cdh,86h,61h,00h,afh
+			db	10h,03h,2fh,64h,b2h,92h,ffh,beh
+			db	16h,88h,afh,e4h,a8h,1dh,b4h,b0h
+			db	78h,e1h,7ah,36h,68h,8eh,08h,cfh
+			db	30h,8dh,00h,a3h,d2h,19h,05h,d7h
+			db	84h,76h,95h,99h,d8h,cch,2bh,efh
+			db	c4h,7eh,11h,4eh,15h,a2h,81h,53h
+			db	e9h,f3h,20h,65h,81h,83h,d9h,96h
+			db	45h,90h,09h,07h,50h,e2h,9bh,35h
+			db	6fh,7ah,f6h,75h,b6h,00h,3bh,66h
+			db	79h,bbh,d4h,3fh,eah,57h,a1h,11h
+			db	9fh,65h,efh,6fh,c6h,72h,4fh,74h
+			db	80h,adh,f7h,8fh,2ch,bah,54h,a1h
+			db	68h,9bh,76h,31h,d9h,b6h,a0h,a1h
+			db	66h,a8h,a7h,99h,beh,43h,4eh,75h
+			db	c9h,02h,6bh,52h,f9h,d1h,7ch,94h
+			db	7fh,d1h,19h,8bh,c5h,01h,e4h,7eh
+			db	6fh,f0h,c1h,70h,8bh,b8h,82h,09h
+			db	55h,8ch,dch,5dh,92h,24h,a3h,f7h
+			db	d1h,e5h,f6h,d4h,c8h,6bh,a2h,26h
+			db	97h,0ah,f4h,1dh,c4h,d4h,a4h,abh
+			db	60h,48h,50h,d1h,34h,f9h,68h,05h
+			db	3bh,0ah,15h,1eh,c1h,68h,b4h,2ah
+			db	4eh,96h,94h,2dh,34h,34h,bfh,94h
+			db	f9h,29h,fbh,47h,55h,67h,95h,12h
+			db	b9h,cfh,0ah,3dh,1bh,d4h,19h,d8h
+			db	09h,85h,15h,69h,71h,c3h,76h,1eh
+			db	00h,2ah,a9h,d1h,8fh,cdh,46h,fah
+			db	92h,fbh,57h,37h,abh,d4h,88h,91h
+			db	5bh,cah,bdh,09h,45h,e8h,0ch,03h
+			db	7bh,dbh,33h,beh,42h,2ah,d6h,cah
+			db	50h,59h,ech,93h,b1h,a6h,f2h,ech
+			db	24h,21h,a2h,fdh,5eh,dah,aah,7fh
+			db	e4h,b2h,f6h,58h,2eh,85h,42h,45h
+			db	b0h,b1h,82h,74h,53h,28h,7eh,f1h
+			db	79h,a3h,b0h,d1h,89h,50h,c5h,45h
+			db	78h,2fh,05h,60h,c9h,75h,82h,2dh
+			db	10h,8bh,bdh,20h,c3h,ceh,fch,7dh
+			db	58h,2dh,07h,8bh,12h,c3h,b7h,1dh
+			db	48h,bah,06h,4fh,d1h,70h,c5h,8ch
+			db	57h,88h,3dh,b1h,91h,3dh,44h,8fh
+			db	3fh,1fh,81h,abh,d9h,94h,0dh,06h
+			db	21h,deh,2fh,26h,b3h,4dh,d6h,68h
+			db	49h,6fh,f0h,e7h,26h,dfh,86h,a2h
+			db	e3h,88h,6eh,9eh,dah,adh,a4h,58h
+			db	d9h,ebh,61h,80h,f5h,23h,93h,33h
+			db	5bh,c7h,dah,ddh,47h,44h,eeh,5eh
+			db	47h,ffh,14h,aeh,f5h,1ah,abh,1bh
+			db	1ah,cdh,9bh,a3h,adh,98h,58h,69h
+			db	b8h,a1h,a2h,48h,75h,c7h,1ch,5ch
+			db	53h,74h,15h,94h,27h,9dh,92h,5ah
+			db	5bh,dbh,41h,53h,00h,d5h,1bh,e6h
+			db	77h,a8h,c1h,86h,52h,deh,94h,5ch
+			db	22h,efh,22h,6bh,fdh,6fh,deh,50h
+			db	a2h,a7h,2bh,ach,e1h,c1h,fah,c2h
+			db	a0h,16h,92h,93h,3dh,dch,eah,98h
+			db	f3h,e4h,5ah,aeh,33h,62h,79h,23h
+			db	00h,42h,7ah,7fh,0bh,60h,70h,72h
+			db	75h,51h,bfh,36h,06h,5eh,26h,85h
+			db	50h,93h,3fh,80h,8eh,bbh,03h,c7h
+			db	14h,f7h,b1h,a1h,67h,38h,68h,b7h
+			db	74h,31h,e4h,f4h,d9h,36h,c7h,1ah
+			db	9dh,d8h,00h,13h,93h,67h,c3h,88h
+			db	2dh,a0h,ffh,cfh,2bh,aeh,96h,25h
+			db	86h,4fh,f6h,7bh,65h,eah,2ch,deh
+			db	9ch,bfh,83h,99h,80h,7dh,edh,fbh
+			db	efh,d3h,3ch,25h,8dh,0eh,d6h,b2h
+			db	02h,6bh,03h,28h,45h,6bh,83h,2eh
+			db	5bh,a3h,44h,94h,47h,55h,56h,0fh
+			db	9eh,97h,5fh,36h,edh,51h,42h,51h
+			db	27h,38h,e0h,8ah,ach,14h,84h,e6h
+			db	b6h,b4h,7dh,f5h,77h,27h,61h,d5h
+			db	3dh,bch,39h,d1h,ffh,ebh,aah,8eh
+			db	54h,e6h,03h,5bh,31h,e5h,59h,e6h
+			db	51h,a2h,c4h,bbh,29h,3eh,2fh,d1h
+			db	97h,a1h,19h,39h,32h,12h,47h,b2h
+			db	58h,85h,b2h,79h,95h,21h,3dh,fah
+			db	c2h,f9h,0fh,fbh,64h,63h,2ah,bfh
+			db	6fh,e2h,24h,0fh,5bh,56h,92h,07h
+			db	97h,35h,32h,d3h,98h,c7h,24h,deh
+			db	8eh,11h,dfh,0ch,c3h,e2h,46h,77h
+			db	01h,a1h,c6h,c5h,8bh,60h,85h,1fh
+			db	59h,62h,89h,09h,7ch,61h,e0h,a6h
+			db	2ah,c0h,e8h,a1h,35h,a6h,dfh,59h
+			db	62h,9ch,b9h,c3h,b4h,2ch,b2h,9dh
+			db	7ch,c5h,0bh,95h,fbh,52h,61h,38h
+			db	f5h,83h,e6h,1ah,8bh,eeh,44h,68h
+			db	f4h,75h,d7h,f9h,fdh,51h,7ah,22h
+			db	bbh,cdh,65h,68h,a0h,00h,ddh,20h
+			db	9eh,50h,11h,e3h,54h,d5h,29h,9dh
+			db	ffh,78h,f8h,fah,9bh,99h,6eh,d8h
+			db	f8h,33h,59h,5ah,01h,02h,c1h,4ah
+			db	31h,cah,7bh,edh,0eh,a6h,32h,27h
+			db	ech,38h,3ah,a4h,47h,47h,33h,46h
+			db	b5h,9fh,5ah,22h,5dh,60h,afh,a1h
+			db	eah,bch,efh,3eh,2bh,a6h,26h,98h
+			db	0dh,beh,a0h,95h,0ah,e7h,03h,f6h
+			db	b3h,72h,deh,5dh,edh,68h,eeh,aah
+			db	0ah,78h,75h,e9h,e6h,08h,a9h,bbh
+			db	1ah,a3h,b0h,83h,4fh,8ch,49h,7fh
+			db	3ch,31h,3bh,2dh,f6h,6ch,03h,b0h
+			db	b2h,1eh,95h,10h,13h,34h,0bh,b4h
+			db	4fh,f2h,76h,a1h,fdh,0eh,c4h,0bh
+			db	e4h,2eh,35h,3bh,2dh,edh,67h,5eh
+			db	a8h,edh,99h,83h,b3h,6dh,f6h,8bh
+			db	28h,08h,1eh,efh,c5h,b6h,48h,84h
+			db	30h,42h,1bh,45h,e9h,92h,93h,74h
+			db	b8h,ach,1bh,16h,aah,d7h,36h,15h
+			db	57h,29h,17h,dfh,12h,25h,04h,9bh
+			db	37h,abh,4bh,f9h,ceh,cdh,3dh,42h
+			db	10h,ech,2eh,e5h,37h,07h,f3h,d3h
+			db	3ch,51h,2ah,1bh,c1h,20h,55h,07h
+			db	4ah,04h,a1h,2eh,94h,91h,8dh,59h
+			db	4dh,5bh,eeh,dfh,7bh,4eh,cdh,dbh
+			db	e1h,91h,45h,a5h,07h,23h,c6h,c0h
+			db	7ch,62h,4eh,93h,38h,e2h,0fh,a2h
+			db	b7h,61h,99h,b4h,74h,63h,8ch,d8h
+			db	4ch,7dh,71h,0eh,63h,8bh,a1h,a2h
+			db	4dh,78h,c1h,d7h,00h,4dh,c9h,04h
+			db	34h,b8h,5dh,02h,c1h,20h,76h,26h
+			db	7bh,71h,0bh,7ah,7eh,82h,bch,45h
+			db	e3h,f4h,98h,56h,08h,63h,49h,37h
+			db	30h,ech,d2h,3ah,9ah,a8h,cch,82h
+			db	3fh,44h,aeh,49h,afh,fah,8fh,b7h
+			db	b8h,24h,93h,61h,c5h,40h,6dh,d3h
+			db	05h,fdh,94h,c8h,f1h,a2h,aah,a0h
+			db	f1h,1fh,d1h,58h,eeh,2fh,18h,b8h
+			db	c6h,53h,fbh,62h,89h,9ah,85h,16h
+			db	24h,b7h,86h,fch,dah,8fh,06h,0ch
+			db	4fh,94h,09h,66h,beh,5ah,f0h,e8h
+			db	edh,b2h,a0h,39h,9dh,71h,8fh,26h
+			db	b4h,d9h,f1h,25h,40h,62h,9eh,57h
+			db	ceh,77h,90h,c5h,67h,8bh,94h,8dh
+			db	efh,3ch,6eh,44h,0ah,dch,bfh,57h
+			db	8ah,ddh,66h,ceh,16h,c6h,18h,41h
+			db	33h,f0h,95h,29h,3ch,5eh,63h,3eh
+			db	0fh,16h,7ch,36h,9dh,2eh,58h,f5h
+			db	51h,09h,7dh,dah,2dh,d8h,7dh,58h
+			db	80h,16h,7fh,84h,4fh,8eh,bdh,cah
+			db	26h,5fh,cbh,47h,d4h,5bh,7eh,7ch
+			db	a0h,24h,d2h,3ch,3ch,83h,b8h,20h
+			db	ddh,9ch,6bh,44h,4ch,70h,72h,28h
+			db	18h,42h,c6h,3eh,52h,09h,e4h,5dh
+			db	c3h,e4h,2fh,9fh,a3h,7fh,36h,a6h
+			db	d4h,9ch,7dh,a2h,71h,a6h,13h,ech
+			db	37h,97h,94h,5eh,86h,a5h,5dh,60h
+			db	f5h,a5h,9eh,29h,4dh,37h,d4h,b2h
+			db	d5h,a2h,46h,68h,5dh,f7h,8ah,27h
+			db	0eh,4eh,93h,24h,72h,36h,3bh,1fh
+			db	62h,82h,eeh,b7h,52h,12h,b5h,a6h
+			db	c6h,78h,30h,e8h,90h,edh,f2h,2ah
+			db	91h,dfh,0ch,3bh,74h,40h,45h,93h
+			db	6ah,1eh,75h,40h,93h,e6h,e5h,8eh
+			db	3eh,29h,deh,72h,5ah,b1h,b6h,59h
+			db	66h,d8h,b3h,0dh,d5h,57h,5dh,18h
+			db	48h,63h,c4h,a4h,8fh,f3h,98h,73h
+			db	deh,c1h,03h,21h,75h,6eh,f8h,99h
+			db	eah,ceh,3bh,cah,3ch,31h,fch,54h
+			db	59h,e5h,fdh,ffh,5dh,a6h,41h,ebh
+			db	2fh,83h,19h,8fh,eah,66h,e3h,d4h
+			db	8bh,9bh,a4h,26h,8fh,e4h,c1h,4fh
+			db	c6h,d9h,92h,b5h,a1h,4eh,2bh,9ch
+			db	ceh,2bh,66h,33h,58h,e8h,4ah,e3h
+			db	02h,3dh,9dh,cdh,01h,6bh,4eh,c1h
+			db	58h,ceh,e3h,d9h,feh,57h,e4h,82h
+			db	3ch,38h,8dh,7ch,89h,b6h,07h,23h
+			db	74h,44h,9fh,50h,afh,0ah,48h,7dh
+			db	8ch,68h,4dh,adh,77h,77h,0ch,33h
+			db	02h,dfh,52h,4ch,fbh,41h,c2h,a6h
+			db	10h,67h,bfh,afh,f0h,d3h,44h,bch
+			db	7ah,86h,40h,24h,5fh,6fh,10h,eeh
+			db	38h,95h,dch,06h,92h,d9h,d4h,27h
+			db	09h,0eh,fch,60h,14h,37h,90h,30h
+			db	feh,79h,c8h,94h,2eh,12h,dah,15h
+			db	41h,3ch,a7h,ech,d2h,a8h,efh,1ah
+			db	d0h,95h,f9h,a4h,82h,bdh,e6h,64h
+			db	ddh,fdh,c1h,fah,38h,e2h,feh,a0h
+			db	74h,a8h,5bh,cch,04h,82h,19h,cah
+			db	5fh,48h,fbh,ddh,4ah,a7h,65h,aeh
+			db	a7h,72h,cch,cfh,94h,b4h,2ch,fbh
+			db	44h,c2h,58h,89h,3ah,3ah,a9h,e3h
+			db	3dh,a0h,3eh,5bh,67h,5bh,13h,69h
+			db	a9h,6dh,c6h,0fh,86h,e3h,20h,c0h
+			db	f5h,eeh,fdh,60h,93h,23h,b6h,68h
+			db	45h,c5h,0ch,feh,c5h,2fh,fdh,efh
+			db	d1h,eah,e2h,cah,63h,6fh,bfh,21h
+			db	f4h,bbh,3fh,7fh,3fh,3ch,36h,cfh
+			db	35h,4ah,d0h,0ch,cbh,70h,73h,fah
+			db	86h,8dh,4ch,62h,f9h,6ch,9fh,b0h
+			db	e2h,98h,5dh,e3h,a7h,7dh,56h,a9h
+			db	4eh,1bh,c8h,2bh,47h,a9h,d6h,ebh
+			db	5ah,bbh,93h,65h,67h,86h,2ch,08h
+			db	25h,37h,6fh,1bh,0ah,a7h,5dh,a2h
+			db	94h,7eh,57h,29h,00h,edh,e3h,c8h
+			db	3eh,83h,e7h,a1h,76h,08h,4ch,a7h
+			db	10h,f1h,b8h,65h,c0h,56h,62h,ebh
+			db	03h,7bh,feh,c4h,96h,6ah,b7h,52h
+			db	49h,ffh,fbh,4fh,36h,24h,98h,8dh
+			db	0bh,19h,94h,32h,c1h,11h,a3h,86h
+			db	efh,3fh,06h,01h,51h,fbh,37h,05h
+			db	b1h,dbh,bdh,dch,a3h,8bh,4ch,e5h
+			db	bah,a3h,3dh,fah,f3h,a2h,95h,98h
+			db	24h,b5h,95h,b3h,bdh,e1h,5bh,3ch
+			db	8ah,50h,74h,a1h,24h,25h,7fh,f1h
+			db	dah,ech,74h,32h,92h,bah,84h,26h
+			db	9ah,0eh,25h,55h,c0h,6fh,85h,9fh
+			db	27h,62h,94h,4eh,4ah,f1h,22h,bbh
+			db	60h,eeh,92h,b5h,20h,37h,d5h,8bh
+			db	76h,e0h,58h,09h,04h,69h,41h,abh
+			db	a6h,a5h,10h,4ah,f6h,72h,08h,b0h
+			db	81h,7ch,d3h,fch,b7h,31h,89h,17h
+			db	91h,2eh,00h,48h,18h,88h,1dh,40h
+			db	f1h,89h,e7h,85h,64h,dbh,25h,4ah
+			db	c4h,aeh,57h,adh,fbh,c1h,92h,35h
+			db	efh,51h,45h,09h,03h,92h,08h,4ch
+			db	96h,e1h,e8h,9ch,0ch,c1h,bdh,55h
+			db	cah,f6h,feh,13h,47h,e2h,d7h,63h
+			db	00h,99h,94h,15h,e7h,5fh,9bh,05h
+			db	d7h,e6h,84h,e9h,bbh,beh,0ah,50h
+			db	b3h,06h,ach,4dh,3dh,d2h,b8h,30h
+			db	55h,7fh,beh,0dh,2eh,afh,79h,88h
+			db	a4h,37h,3ah,adh,fch,86h,d4h,2eh
+			db	c2h,22h,f2h,4ah,cbh,27h,15h,72h
+			db	2bh,53h,bah,ffh,1ch,3ch,b3h,f7h
+			db	b1h,c7h,feh,dfh,a2h,cch,19h,1bh
+			db	a3h,36h,d4h,fch,1ch,8eh,9ah,1fh
+			db	fdh,69h,81h,7dh,93h,10h,dch,6bh
+			db	12h,1ah,fah,4bh,74h,03h,12h,5ah
+			db	99h,29h,3bh,96h,f1h,5eh,0dh,47h
+			db	c6h,dch,69h,fah,55h,34h,1ch,56h
+			db	fch,73h,f0h,12h,44h,25h,b7h,3fh
+			db	dbh,d4h,4fh,ebh,7ch,40h,ach,01h
+			db	3ah,e7h,02h,0ah,f4h,e7h,15h,c1h
+			db	08h,68h,2ch,d0h,67h,d0h,24h,d7h
+			db	abh,fah,08h,d4h,fah,b9h,e0h,54h
+			db	7fh,e1h,0eh,0dh,d1h,9dh,c7h,22h
+			db	43h,5ah,b6h,d3h,cah,63h,76h,3fh
+			db	b2h,61h,1fh,73h,b2h,b0h,8ch,23h
+			db	46h,f3h,cch,d6h,a6h,4ah,f1h,5eh
+			db	3ch,a2h,2ah,a9h,ceh,adh,9fh,31h
+			db	35h,88h,39h,76h,afh,e4h,23h,74h
+			db	07h,f9h,34h,8eh,c4h,96h,76h,5eh
+			db	41h,1bh,61h,78h,f6h,bbh,20h,d4h
+			db	45h,b8h,00h,feh,74h,79h,81h,24h
+			db	02h,cfh,a9h,99h,5ch,b0h,4fh,d7h
+			db	40h,41h,bfh,d4h,6fh,d9h,f3h,3dh
+			db	59h,fch,d8h,2ah,ebh,a3h,b6h,5ch
+			db	27h,1bh,27h,ach,e6h,6bh,b3h,96h
+			db	90h,53h,cbh,ebh,d7h,1eh,0ah,88h
+			db	b4h,d3h,27h,78h,89h,51h,9eh,dah
+			db	9eh,8dh,a8h,67h,21h,12h,2ch,bah
+			db	54h,70h,bah,edh,c0h,60h,c8h,16h
+			db	22h,edh,efh,4ah,54h,d0h,22h,cbh
+			db	4bh,4ah,85h,31h,b9h,64h,74h,7ch
+			db	b2h,f1h,0dh,28h,3ah,00h,6fh,5fh
+			db	abh,8dh,39h,e9h,0bh,bbh,cdh,6eh
+			db	41h,21h,19h,6bh,68h,20h,ffh,1bh
+			db	a5h,5ch,a2h,22h,4ah,c0h,62h,a2h
+			db	11h,e3h,65h,0bh,d5h,f5h,c5h,beh
+			db	a9h,76h,f2h,8ch,beh,48h,94h,f2h
+			db	51h,7bh,08h,3bh,2ch,2dh,73h,c6h
+			db	56h,68h,6ah,8fh,a6h,92h,6eh,5dh
+			db	aeh,12h,1ah,1ch,12h,33h,eeh,b6h
+			db	dfh,83h,ceh,69h,73h,30h,a0h,89h
+			db	c8h,09h,62h,94h,99h,feh,01h,5eh
+			db	6ah,36h,7dh,11h,72h,79h,dch,3ch
+			db	63h,6dh,6dh,3dh,aah,1dh,aeh,05h
+			db	26h,aeh,d4h,51h,f1h,b1h,75h,9eh
+			db	1dh,99h,11h,cah,cch,f4h,66h,9ah
+			db	a7h,7ah,4ah,d1h,79h,79h,2ch,c9h
+			db	21h,b7h,d7h,6dh,94h,d1h,bah,31h
+			db	c6h,1ah,23h,36h,63h,c8h,04h,26h
+			db	deh,57h,abh,68h,1dh,17h,eah,a4h
+			db	2dh,abh,cbh,11h,21h,63h,47h,09h
+			db	7dh,20h,cdh,91h,7eh,b6h,40h,75h
+			db	c6h,7eh,10h,5eh,18h,b2h,64h,57h
+			db	66h,08h,22h,83h,b3h,6eh,31h,3dh
+			db	8dh,7fh,d5h,bfh,e9h,98h,37h,6ch
+			db	d3h,c5h,aah,aeh,26h,60h,feh,0fh
+			db	50h,e8h,77h,91h,09h,2bh,abh,58h
+			db	3eh,76h,f8h,64h,cch,c9h,73h,0dh
+			db	4ah,cdh,d7h,65h,16h,6dh,92h,a1h
+			db	09h,ebh,89h,0dh,f8h,feh,56h,d6h
+			db	9fh,79h,ddh,aah,98h,9ch,53h,2fh
+			db	69h,8fh,a7h,01h,ach,2dh,30h,e6h
+			db	edh,bdh,f0h,aeh,9dh,b6h,7fh,96h
+			db	78h,72h,a6h,edh,c3h,04h,3eh,cfh
+			db	3ah,e3h,52h,42h,5ch,eeh,dfh,99h
+			db	dch,08h,6bh,72h,e8h,7bh,94h,53h
+			db	0fh,3ch,e0h,96h,98h,a7h,e9h,b6h
+			db	c6h,3bh,5eh,e0h,19h,dah,c1h,21h
+			db	32h,52h,37h,9eh,27h,e8h,d8h,cah
+			db	d9h,a2h,a4h,28h,f6h,3fh,9ch,19h
+			db	5fh,54h,fch,4bh,d2h,c9h,36h,cch
+			db	c4h,0bh,80h,9ch,efh,61h,55h,0ah
+			db	69h,84h,1fh,01h,1ch,4fh,f6h,99h
+			db	85h,68h,d6h,91h,69h,f3h,24h,c1h
+			db	f6h,99h,85h,c2h,d8h,44h,99h,02h
+			db	85h,8ah,26h,a9h,c9h,a8h,28h,35h
+			db	eeh,8dh,71h,68h,f4h,95h,09h,b5h
+			db	63h,44h,23h,e4h,cah,06h,83h,d3h
+			db	cdh,89h,4eh,cch,b1h,d5h,43h,e4h
+			db	bbh,a8h,b5h,d6h,79h,07h,0dh,35h
+			db	b1h,2dh,63h,75h,97h,52h,d2h,f3h
+			db	5bh,e6h,13h,4dh,b9h,d0h,75h,77h
+			db	dbh,08h,10h,cch,0dh,f2h,40h,7bh
+			db	cfh,c9h,86h,96h,81h,cbh,fdh,aah
+			db	d1h,01h,f2h,d9h,10h,8ch,46h,cch
+			db	75h,67h,86h,c9h,efh,04h,e0h,9eh
+			db	65h,40h,8ch,ffh,dfh,4ch,f1h,55h
+			db	05h,b0h,f3h,99h,dch,82h,59h,52h
+			db	23h,cbh,e8h,67h,2bh,4ah,45h,fdh
+			db	62h,99h,8bh,71h,9eh,7ch,20h,3fh
+			db	e8h,6dh,4bh,22h,6bh,51h,e7h,96h
+			db	efh,f2h,b7h,f9h,3ah,29h,2ch,6dh
+			db	ddh,19h,9dh,4bh,03h,1ah,12h,44h
+			db	64h,73h,4fh,b4h,1fh,1bh,e2h,ddh
+			db	cah,6ch,36h,feh,85h,0fh,3dh,62h
+			db	ach,6dh,3eh,7eh,a4h,c7h,56h,c6h
+			db	d4h,2ch,f8h,3ch,96h,82h,a3h,52h
+			db	21h,b0h,31h,bbh,d1h,25h,d9h,e3h
+			db	5fh,2ah,23h,a7h,9bh,4dh,56h,9bh
+			db	89h,b1h,d1h,94h,dah,55h,58h,0ah
+			db	c9h,5eh,afh,bah,bbh,cdh,fch,66h
+			db	91h,97h,16h,17h,73h,3ch,71h,85h
+			db	f7h,efh,61h,5dh,eeh,ebh,84h,a6h
+			db	21h,feh,11h,b4h,7dh,08h,fbh,36h
+			db	26h,9ch,18h,06h,bbh,58h,31h,9ch
+			db	44h,22h,38h,4eh,31h,14h,eah,40h
+			db	a1h,e8h,80h,10h,6ch,36h,11h,34h
+			db	43h,d0h,87h,18h,5fh,20h,35h,06h
+			db	72h,7fh,a1h,b2h,2bh,7bh,0eh,78h
+			db	5eh,e9h,56h,f9h,99h,ach,49h,00h
+			db	7fh,b0h,4bh,5fh,eah,f2h,6eh,a3h
+			db	88h,72h,f7h,c2h,cah,06h,fdh,11h
+			db	d7h,67h,81h,83h,b0h,d1h,18h,ffh
+			db	14h,5ah,4fh,b0h,c8h,44h,54h,9eh
+			db	f1h,f4h,36h,ach,29h,eah,62h,04h
+			db	f1h,bdh,34h,20h,95h,84h,a3h,c7h
+			db	c0h,09h,64h,70h,41h,09h,1fh,4bh
+			db	61h,edh,56h,e7h,66h,deh,11h,03h
+			db	36h,89h,95h,7eh,83h,cah,d3h,c2h
+			db	3ah,e5h,fch,3bh,56h,7dh,04h,10h
+			db	a6h,b2h,d2h,9fh,d2h,adh,5ah,32h
+			db	0bh,6bh,d8h,8bh,5ah,86h,d2h,adh
+			db	edh,eah,bah,fdh,f7h,25h,99h,b5h
+			db	a3h,0ch,aah,10h,b7h,56h,fbh,20h
+			db	44h,65h,61h,aeh,8eh,44h,22h,cah
+			db	bbh,d0h,d9h,61h,0fh,09h,29h,feh
+			db	9ah,57h,1eh,a9h,feh,deh,9ch,3ah
+			db	d8h,0eh,40h,8bh,98h,f2h,7eh,ffh
+			db	fch,81h,79h,b7h,adh,22h,a0h,91h
+			db	13h,f4h,6ch,f8h,11h,3eh,27h,b1h
+			db	d0h,54h,fah,2dh,75h,cah,60h,91h
+			db	6bh,a0h,27h,f2h,e6h,b5h,f8h,1fh
+			db	1ch,0eh,abh,e7h,75h,f4h,a0h,4dh
+			db	dfh,f8h,71h,abh,03h,41h,c8h,9ch
+			db	f2h,a3h,a9h,e2h,e8h,bch,f6h,f2h
+			db	63h,06h,b9h,fbh,cch,fch,64h,38h
+			db	c7h,11h,9eh,81h,69h,c2h,e8h,f0h
+			db	aah,08h,f5h,3bh,cah,d1h,bfh,bbh
+			db	eah,33h,9eh,a0h,48h,26h,f1h,03h
+			db	1bh,15h,01h,0eh,42h,e5h,4bh,36h
+			db	5eh,f3h,3fh,7fh,fch,6bh,37h,cah
+			db	94h,ffh,b7h,35h,f4h,6dh,a9h,4fh
+			db	15h,0fh,27h,dch,5bh,56h,39h,92h
+			db	5eh,cdh,7ah,b9h,3ah,c8h,abh,22h
+			db	a7h,80h,c0h,57h,a0h,8ah,d5h,aah
+			db	ebh,56h,efh,beh,20h,3eh,e9h,cch
+			db	f2h,17h,60h,bfh,40h,4bh,66h,1bh
+			db	dfh,18h,0fh,57h,45h,d0h,d7h,3dh
+			db	41h,ebh,abh,6fh,9ah,49h,22h,58h
+			db	bch,76h,cah,1ch,d8h,0ah,b3h,23h
+			db	21h,09h,b9h,d0h,7bh,f8h,09h,20h
+			db	c7h,06h,4ch,3eh,6dh,cdh,e4h,64h
+			db	b3h,69h,32h,f6h,2dh,62h,28h,98h
+			db	6ch,65h,4bh,3ah,3eh,79h,d4h,33h
+			db	4ah,bdh,cfh,2ah,8eh,6dh,ach,c7h
+			db	45h,bbh,93h,99h,d5h,4bh,c4h,15h
+			db	91h,40h,a5h,c2h,71h,94h,2ch,c5h
+			db	45h,4ch,cdh,0bh,6fh,13h,6ah,14h
+			db	dah,10h,50h,e5h,0fh,80h,0ch,79h
+			db	24h,a5h,8ch,e5h,15h,c9h,e8h,79h
+			db	d2h,50h,06h,a5h,5eh,d9h,0ch,c7h
+			db	85h,7dh,77h,c9h,22h,0bh,27h,9ch
+			db	9eh,4ah,d5h,71h,24h,2fh,d3h,fbh
+			db	afh,45h,42h,95h,4dh,01h,91h,7eh
+			db	e6h,65h,30h,fah,77h,cfh,68h,3fh
+			db	d8h,7ch,f5h,62h,19h,46h,58h,e0h
+			db	cch,9bh,a1h,dfh,e4h,deh,eeh,85h
+			db	c2h,f6h,a7h,3ah,9eh,a5h,d6h,e6h
+			db	a3h,b4h,66h,80h,2bh,5bh,f0h,c3h
+			db	f4h,37h,06h,f2h,ddh,3eh,3ch,3ah
+			db	7bh,9bh,98h,2ch,5bh,c7h,21h,00h
+			db	2bh,5bh,f2h,beh,b6h,e6h,97h,afh
+			db	c0h,49h,43h,c4h,e8h,4eh,3ah,1ch
+			db	d4h,a6h,e4h,54h,bch,aah,07h,c0h
+			db	b5h,89h,86h,cah,f8h,1ch,a2h,dbh
+			db	52h,79h,e0h,4bh,bch,a2h,32h,efh
+			db	64h,a5h,90h,e7h,4dh,c9h,f6h,79h
+			db	69h,aah,38h,24h,5ch,9fh,c3h,31h
+			db	7fh,97h,8dh,13h,d7h,abh,2ch,26h
+			db	38h,abh,9dh,39h,88h,1fh,63h,a6h
+			db	ech,e0h,4ah,aah,60h,e1h,cbh,93h
+			db	34h,19h,76h,7dh,f3h,42h,b9h,b4h
+			db	5fh,3fh,1bh,b2h,b8h,a9h,d6h,c1h
+			db	72h,2ah,0ah,25h,59h,6dh,9fh,56h
+			db	25h,ebh,28h,aeh,36h,dfh,60h,52h
+			db	43h,0bh,43h,fah,49h,32h,83h,18h
+			db	4ah,50h,6ch,8ah,8ch,cdh,6ch,d8h
+			db	33h,e9h,9bh,aeh,f6h,6ch,17h,b5h
+			db	67h,31h,23h,78h,5eh,b6h,99h,1ah
+			db	4fh,f9h,ceh,9dh,c5h,afh,88h,2bh
+			db	68h,2ch,ddh,6eh,6fh,21h,d0h,11h
+			db	79h,54h,d4h,74h,1bh,dfh,2eh,ach
+			db	ceh,64h,29h,75h,c2h,79h,73h,c1h
+			db	dfh,56h,75h,dfh,a3h,53h,0eh,b2h
+			db	5fh,88h,1bh,75h,29h,b1h,f9h,5ah
+			db	50h,0dh,81h,72h,d3h,1bh,f3h,f1h
+			db	d3h,1ch,f5h,dbh,74h,a5h,e2h,aah
+			db	e3h,32h,0ah,a0h,43h,85h,c5h,3bh
+			db	0bh,e2h,e4h,cbh,b4h,4fh,76h,90h
+			db	4fh,21h,80h,7ah,4fh,83h,79h,82h
+			db	4eh,82h,c5h,5eh,06h,f7h,f5h,98h
+			db	b8h,c4h,2ch,54h,afh,1eh,bdh,72h
+			db	dch,b1h,15h,32h,f0h,dah,30h,33h
+			db	99h,62h,aeh,68h,b5h,c1h,14h,25h
+			db	11h,f8h,85h,9eh,f2h,abh,b6h,5ch
+			db	95h,43h,57h,45h,3bh,8ah,d6h,0dh
+			db	e6h,83h,f8h,74h,42h,65h,6fh,d1h
+			db	24h,d4h,18h,9eh,69h,f2h,5ch,a7h
+			db	8eh,75h,e6h,e9h,f6h,8ch,c0h,4dh
+			db	e3h,a3h,13h,cdh,b9h,03h,8bh,6fh
+			db	1bh,85h,91h,b4h,2dh,4fh,a5h,e0h
+			db	73h,deh,c1h,c9h,cdh,62h,2dh,a2h
+			db	edh,8bh,94h,09h,20h,a9h,bbh,abh
+			db	cdh,f2h,7fh,ceh,29h,b6h,dfh,20h
+			db	aah,2bh,3bh,91h,c1h,16h,c7h,e8h
+			db	cah,ddh,5ah,eah,01h,1bh,4bh,96h
+			db	2dh,43h,c2h,49h,0fh,9eh,afh,2ch
+			db	2eh,53h,57h,2fh,3bh,08h,85h,ddh
+			db	a6h,d6h,82h,bch,e1h,9ch,5ah,a4h
+			db	19h,7dh,08h,cfh,31h,46h,76h,a9h
+			db	e5h,a9h,fah,62h,e2h,4bh,e8h,66h
+			db	71h,f7h,3eh,5dh,16h,46h,69h,cah
+			db	e2h,b6h,dch,65h,c5h,80h,4ah,d0h
+			db	7ah,1dh,3bh,b7h,b3h,e4h,d5h,5ch
+			db	64h,f0h,74h,84h,e0h,60h,22h,fdh
+			db	fbh,e5h,a1h,f9h,dfh,dbh,eah,6bh
+			db	b1h,fah,d9h,7ah,9bh,b1h,c9h,6fh
+			db	d0h,d4h,bah,3fh,90h,dah,f6h,7ah
+			db	47h,9dh,97h,20h,63h,1ah,d2h,1ah
+			db	efh,cch,f7h,7eh,b4h,eah,aah,96h
+			db	eeh,e2h,7ch,7dh,05h,11h,32h,4fh
+			db	b5h,16h,4dh,17h,f6h,c9h,f7h,b8h
+			db	10h,21h,95h,01h,a6h,58h,14h,e4h
+			db	64h,f0h,d7h,c5h,3bh,94h,c9h,c8h
+			db	56h,1eh,e8h,c4h,04h,deh,bah,19h
+			db	b5h,65h,6ah,58h,14h,59h,bah,ech
+			db	d7h,c3h,16h,cch,9bh,93h,37h,9fh
+			db	0ah,eeh,72h,67h,01h,abh,a2h,58h
+			db	7bh,31h,f3h,b0h,1ch,6dh,5eh,b2h
+			db	11h,f8h,bch,37h,ech,e1h,1ah,18h
+			db	42h,73h,8ah,cbh,02h,44h,76h,deh
+			db	59h,74h,8bh,11h,02h,feh,60h,b6h
+			db	52h,95h,d8h,d4h,15h,aah,0ah,e2h
+			db	d2h,1fh,9eh,e3h,f3h,a6h,adh,a9h
+			db	5bh,66h,35h,f9h,d7h,ebh,37h,f8h
+			db	41h,89h,2bh,0ah,36h,25h,89h,9eh
+			db	a0h,f5h,f8h,51h,30h,52h,7ch,77h
+			db	2eh,f0h,0bh,48h,fch,1eh,26h,ceh
+			db	18h,33h,48h,18h,89h,37h,05h,87h
+			db	07h,59h,d5h,20h,69h,bdh,00h,69h
+			db	d5h,98h,65h,0fh,53h,6fh,d5h,e4h
+			db	85h,e6h,20h,63h,3eh,02h,2ah,14h
+			db	33h,3fh,68h,3ch,56h,61h,ffh,a7h
+			db	a1h,bbh,f3h,02h,32h,9eh,02h,93h
+			db	3ch,c3h,5dh,5ah,10h,2fh,75h,eeh
+			db	8eh,12h,b4h,87h,cch,f6h,5bh,32h
+			db	89h,09h,4eh,afh,d8h,43h,8dh,d8h
+			db	f3h,09h,5ch,b0h,e8h,dbh,b1h,5fh
+			db	bbh,3fh,abh,76h,2dh,9ah,1eh,20h
+			db	83h,d8h,a9h,aah,68h,10h,4fh,bfh
+			db	38h,0ch,02h,cbh,83h,ffh,71h,a0h
+			db	45h,72h,8fh,aah,8bh,42h,4ah,b2h
+			db	f3h,35h,2ch,b3h,5dh,4bh,07h,1ch
+			db	52h,5ch,0eh,5ah,dch,63h,dfh,d6h
+			db	f3h,0fh,dfh,b0h,c9h,3ch,e8h,1dh
+			db	bch,02h,abh,c9h,96h,4ah,65h,33h
+			db	65h,efh,23h,e8h,96h,c2h,87h,29h
+			db	54h,dah,4ah,cch,b0h,2bh,4ch,18h
+			db	ebh,fdh,2eh,35h,56h,26h,d9h,ffh
+			db	bah,aeh,f8h,2ah,32h,80h,d7h,66h
+			db	03h,13h,8fh,96h,2ah,f3h,23h,14h
+			db	7bh,a0h,9ah,4ch,b6h,61h,59h,53h
+			db	57h,45h,2eh,8ch,a3h,90h,72h,2ah
+			db	42h,c6h,4fh,abh,ech,46h,41h,9eh
+			db	efh,76h,8dh,67h,5ah,08h,b8h,e8h
+			db	71h,38h,e1h,a2h,a9h,29h,4bh,ceh
+			db	eeh,39h,89h,b0h,7eh,ebh,f4h,55h
+			db	38h,1dh,5ah,09h,1ah,18h,3fh,94h
+			db	88h,cbh,bbh,69h,5ch,efh,69h,e6h
+			db	46h,cfh,f3h,8eh,17h,53h,31h,b8h
+			db	7ah,04h,edh,5fh,85h,67h,05h,fdh
+			db	84h,e5h,f3h,7ch,4dh,e5h,f8h,feh
+			db	cdh,a8h,57h,6ch,abh,d4h,99h,3dh
+			db	1ah,32h,29h,36h,fbh,f9h,01h,1fh
+			db	20h,63h,91h,bfh,e2h,26h,e4h,9eh
+			db	e9h,abh,9ah,ebh,91h,11h,90h,0dh
+			db	88h,eah,a4h,32h,d8h,d7h,15h,c8h
+			db	5ah,b3h,44h,b6h,53h,04h,a5h,34h
+			db	7eh,efh,ech,5bh,b7h,36h,e0h,01h
+			db	44h,d0h,2bh,94h,3eh,c7h,b8h,3fh
+			db	bah,05h,e3h,58h,85h,a8h,96h,21h
+			db	f7h,cdh,9eh,7ch,19h,85h,08h,1ch
+			db	7bh,94h,5bh,9eh,69h,a1h,55h,99h
+			db	4ch,43h,d1h,38h,99h,eeh,2fh,dbh
+			db	93h,80h,afh,a6h,12h,04h,48h,10h
+			db	abh,17h,f2h,cbh,e4h,f5h,0fh,1eh
+			db	e6h,cdh,24h,d5h,87h,feh,4dh,68h
+			db	a0h,83h,e8h,39h,a1h,91h,e0h,f4h
+			db	88h,f6h,01h,26h,e0h,e3h,32h,b3h
+			db	d1h,69h,16h,77h,c1h,4ch,c7h,92h
+			db	48h,63h,cdh,eah,d0h,74h,b4h,06h
+			db	c4h,13h,82h,e9h,61h,27h,5fh,65h
+			db	42h,ebh,38h,9ch,a8h,00h,32h,3ch
+			db	ffh,3fh,59h,1ch,b3h,cdh,0bh,7bh
+			db	cbh,02h,40h,36h,5ch,0fh,bah,58h
+			db	97h,3fh,4ch,09h,7ch,d3h,2ah,82h
+			db	92h,6fh,71h,2fh,bah,74h,83h,6eh
+			db	c7h,5bh,ech,a6h,43h,66h,efh,6eh
+			db	17h,08h,b5h,ddh,b3h,67h,e8h,88h
+			db	9dh,9bh,05h,d1h,3bh,b0h,3eh,2ah
+			db	95h,99h,32h,d0h,cch,aah,24h,c2h
+			db	efh,10h,03h,2fh,a9h,5ch,52h,0fh
+			db	b5h,43h,8ah,24h,1bh,3dh,66h,fdh
+			db	61h,72h,b3h,b2h,dah,80h,6fh,44h
+			db	6dh,d0h,35h,e1h,78h,8eh,ech,6ch
+			db	95h,feh,61h,ddh,53h,58h,e6h,fdh
+			db	f7h,a4h,aeh,d0h,71h,b9h,1bh,c6h
+			db	4dh,90h,70h,3ch,59h,56h,feh,74h
+			db	f9h,40h,d5h,45h,10h,eeh,7ch,43h
+			db	8eh,35h,34h,b1h,76h,49h,a8h,29h
+			db	1ah,14h,c9h,93h,b2h,10h,03h,1eh
+			db	84h,8ah,90h,5fh,30h,9bh,b6h,03h
+			db	e6h,32h,fah,97h,cfh,f5h,94h,9dh
+			db	e3h,50h,d7h,15h,edh,75h,f6h,92h
+			db	29h,28h,01h,b7h,b7h,15h,b5h,3ch
+			db	81h,81h,54h,3ch,18h,4ch,cfh,79h
+			db	80h,03h,97h,98h,5dh,e4h,1dh,5dh
+			db	ffh,cah,8fh,04h,9fh,dfh,35h,07h
+			db	1eh,cdh,b8h,0eh,18h,c0h,24h,1fh
+			db	b1h,a7h,0eh,4ah,92h,92h,e3h,40h
+			db	ddh,60h,c7h,27h,21h,33h,46h,f3h
+			db	76h,67h,40h,f5h,85h,4ah,52h,d2h
+			db	7dh,2dh,0bh,40h,c4h,14h,1ch,f9h
+			db	44h,6ah,70h,1bh,99h,d8h,b4h,d2h
+			db	1eh,d1h,bfh,60h,a6h,6dh,18h,7bh
+			db	c2h,f7h,c0h,d0h,24h,23h,26h,69h
+			db	93h,51h,deh,adh,bfh,1fh,7fh,45h
+			db	59h,8ah,96h,24h,3bh,93h,66h,36h
+			db	98h,0fh,ebh,adh,30h,39h,3eh,d3h
+			db	38h,f6h,ffh,eeh,24h,bbh,3dh,76h
+			db	1eh,fch,aeh,5ch,8ch,7dh,78h,93h
+			db	08h,abh,b5h,adh,75h,0bh,9ah,7ch
+			db	73h,cch,d6h,bah,bah,0eh,73h,21h
+			db	d2h,68h,61h,dah,7ah,cch,84h,5dh
+			db	64h,d7h,5bh,4eh,98h,7dh,b7h,c2h
+			db	4ah,d5h,d9h,aeh,00h,7ch,98h,28h
+			db	91h,4dh,20h,b8h,66h,4eh,fdh,4ch
+			db	a6h,2fh,6dh,a2h,98h,0ch,f0h,4fh
+			db	1ch,b8h,f5h,1dh,69h,85h,84h,0dh
+			db	39h,64h,03h,dch,51h,12h,abh,b6h
+			db	01h,82h,72h,d8h,39h,cdh,52h,feh
+			db	ech,04h,79h,32h,bch,d1h,62h,dah
+			db	1eh,5eh,bfh,91h,94h,08h,d9h,eah
+			db	5eh,49h,4fh,65h,5ch,86h,e1h,59h
+			db	69h,cch,b0h,49h,66h,cch,fah,92h
+			db	fbh,45h,dch,e9h,58h,5fh,e2h,86h
+			db	8bh,a4h,80h,9bh,a3h,e5h,fah,15h
+			db	43h,dch,f2h,f8h,18h,86h,34h,c6h
+			db	40h,09h,cfh,54h,c8h,5bh,40h,b5h
+			db	4ch,5eh,a5h,c8h,3eh,07h,eah,39h
+			db	95h,1fh,b2h,5eh,31h,d9h,02h,48h
+			db	98h,70h,0ah,7bh,c1h,37h,31h,9ah
+			db	6ah,09h,c4h,9bh,8fh,34h,5fh,e6h
+			db	78h,11h,4fh,37h,07h,5dh,11h,a2h
+			db	a9h,28h,b3h,58h,17h,7ch,34h,59h
+			db	8eh,30h,9bh,58h,ach,bah,a3h,82h
+			db	59h,f3h,4fh,7fh,1ch,76h,14h,1ah
+			db	4bh,d2h,10h,b1h,81h,11h,d9h,4dh
+			db	e2h,9bh,19h,a0h,93h,36h,f1h,42h
+			db	c0h,52h,83h,f1h,cah,4bh,efh,4dh
+			db	f3h,8bh,e8h,4eh,cdh,4bh,d5h,cdh
+			db	9eh,19h,17h,75h,6ch,c7h,6dh,e8h
+			db	a6h,b8h,34h,3ch,5ah,40h,43h,5dh
+			db	6eh,8ch,b3h,37h,00h,00h,ebh,75h
+			db	06h,a5h,85h,03h,e2h,2ch,7ah,b1h
+			db	cbh,6fh,d2h,89h,79h,fbh,04h,84h
+			db	c7h,40h,7eh,eah,5ch,91h,95h,b0h
+			db	cdh,d6h,f7h,2ah,23h,bbh,a7h,83h
+			db	49h,e9h,e3h,13h,92h,feh,bch,bdh
+			db	d2h,a9h,69h,e2h,64h,43h,14h,f8h
+			db	11h,bfh,d3h,d6h,15h,78h,afh,cbh
+			db	fch,96h,78h,efh,fbh,63h,d4h,97h
+			db	89h,08h,01h,44h,17h,c2h,01h,dfh
+			db	63h,02h,f4h,f2h,56h,4eh,12h,24h
+			db	d6h,8dh,76h,ddh,31h,f3h,dfh,79h
+			db	13h,82h,ebh,08h,83h,c1h,80h,51h
+			db	4ah,e3h,34h,48h,7fh,8eh,91h,fah
+			db	feh,cdh,edh,54h,b6h,b1h,78h,25h
+			db	63h,4fh,55h,f3h,c1h,b9h,34h,21h
+			db	3fh,17h,c2h,cah,f9h,7ah,91h,b9h
+			db	b1h,8dh,a1h,c4h,24h,cdh,92h,c8h
+			db	2fh,3ch,c7h,6ch,0bh,76h,0bh,d7h
+			db	d7h,e5h,6eh,47h,b0h,8ch,0dh,d9h
+			db	88h,41h,4ah,c7h,fch,7eh,7eh,42h
+			db	53h,a6h,96h,b9h,76h,59h,33h,82h
+			db	38h,13h,d6h,c9h,1eh,9dh,62h,9fh
+			db	3bh,bch,38h,efh,afh,68h,4eh,c8h
+			db	97h,e6h,44h,6fh,dah,fbh,eah,8bh
+			db	7dh,bfh,4ah,70h,1dh,8eh,3dh,ffh
+			db	83h,88h,8eh,31h,dbh,e6h,c7h,f1h
+			db	9ah,e5h,50h,b3h,f0h,d8h,50h,fah
+			db	54h,f9h,88h,2fh,deh,60h,bfh,1ch
+			db	07h,7dh,5bh,1bh,7ah,97h,65h,79h
+			db	ddh,44h,6fh,a1h,09h,35h,c0h,ech
+			db	8dh,50h,39h,5eh,68h,e3h,41h,c8h
+			db	78h,77h,82h,c4h,9ah,dbh,b1h,79h
+			db	17h,50h,60h,e3h,abh,f5h,1dh,52h
+			db	b4h,89h,f4h,abh,07h,81h,f0h,d7h
+			db	c4h,aah,9ah,d8h,f3h,76h,5fh,35h
+			db	75h,6eh,ceh,fbh,68h,26h,16h,23h
+			db	99h,1dh,69h,a5h,89h,e4h,6bh,f8h
+			db	a9h,eah,42h,7dh,f3h,5bh,10h,90h
+			db	29h,92h,1ah,9dh,22h,85h,4dh,82h
+			db	c1h,c9h,cdh,32h,d3h,69h,e5h,97h
+			db	8bh,8dh,05h,6ch,96h,5ch,bah,c0h
+			db	3bh,03h,7ah,afh,27h,abh,a1h,87h
+			db	5ah,afh,cdh,13h,c5h,cbh,b0h,a3h
+			db	fdh,d9h,27h,68h,16h,b1h,0ah,a3h
+			db	08h,5bh,8dh,93h,59h,1ch,2ah,50h
+			db	a2h,c6h,8ch,68h,51h,ebh,67h,53h
+			db	2dh,7fh,08h,51h,a4h,5eh,65h,d0h
+			db	5dh,52h,32h,48h,83h,3ch,c5h,41h
+			db	ach,75h,75h,91h,c5h,a5h,75h,cch
+			db	59h,1ah,34h,a0h,80h,d4h,53h,d5h
+			db	67h,21h,02h,9fh,5fh,a1h,45h,fbh
+			db	8eh,22h,4eh,34h,3ch,4eh,49h,f8h
+			db	5dh,d2h,d8h,13h,4ch,a6h,7fh,31h
+			db	77h,32h,06h,83h,57h,73h,5ch,86h
+			db	ffh,afh,f3h,75h,80h,31h,80h,65h
+			db	35h,d2h,6dh,5ah,71h,e3h,dfh,6eh
+			db	09h,8bh,2fh,dbh,e5h,4dh,e8h,a4h
+			db	f6h,3fh,d4h,78h,3bh,57h,d2h,beh
+			db	a9h,d7h,f5h,26h,45h,2eh,a4h,a3h
+			db	b9h,c2h,cbh,2eh,dbh,c5h,50h,1fh
+			db	09h,e7h,11h,79h,f6h,36h,39h,bbh
+			db	deh,76h,36h,d6h,2ah,26h,b6h,95h
+			db	cbh,0bh,d3h,67h,35h,c9h,29h,fbh
+			db	91h,c1h,11h,f0h,8eh,afh,c7h,2eh
+			db	a8h,eah,bdh,efh,bfh,d9h,86h,50h
+			db	62h,feh,20h,6dh,39h,cfh,c9h,68h
+			db	fbh,69h,a7h,b9h,5dh,d5h,72h,8eh
+			db	cbh,a0h,15h,4eh,75h,c9h,97h,afh
+			db	a9h,34h,b9h,b8h,55h,c8h,61h,71h
+			db	09h,48h,40h,cch,8ah,0bh,b8h,2eh
+			db	58h,deh,55h,3dh,10h,5bh,99h,b9h
+			db	4fh,3bh,4bh,94h,b5h,71h,50h,0eh
+			db	67h,46h,d2h,adh,11h,72h,57h,7dh
+			db	55h,c2h,8bh,8fh,e4h,9ah,3ah,07h
+			db	a7h,5dh,3ah,9ch,f3h,52h,58h,45h
+			db	8ah,bfh,edh,67h,b6h,edh,74h,89h
+			db	cah,0ch,39h,fdh,03h,12h,80h,c9h
+			db	76h,79h,86h,11h,01h,9fh,2ah,76h
+			db	62h,0dh,3eh,d2h,10h,a2h,ceh,62h
+			db	a7h,7eh,d1h,53h,54h,7ch,8ah,99h
+			db	0ah,40h,adh,58h,77h,d2h,e2h,bdh
+			db	05h,bdh,8ah,a5h,80h,35h,9dh,5ah
+			db	74h,a5h,36h,56h,f7h,e7h,c3h,8eh
+			db	b7h,a4h,c8h,31h,2bh,0ah,41h,52h
+			db	28h,a5h,22h,6dh,57h,75h,7dh,fch
+			db	b2h,f8h,e4h,d9h,68h,80h,aah,72h
+			db	07h,45h,fah,11h,f8h,9fh,cbh,91h
+			db	65h,e3h,65h,8ch,2bh,60h,28h,d0h
+			db	f2h,5bh,3eh,b2h,8dh,56h,1bh,bfh
+			db	5ah,bfh,edh,4ch,e7h,87h,7ch,b1h
+			db	bdh,d1h,dah,44h,6ch,03h,a0h,36h
+			db	3ah,6dh,6ch,43h,b1h,c3h,4dh,53h
+			db	66h,28h,7ah,ech,e3h,00h,f2h,aeh
+			db	7bh,6eh,2ch,06h,68h,6fh,5fh,dch
+			db	15h,21h,54h,14h,dfh,2dh,13h,4fh
+			db	29h,00h,b2h,87h,b1h,80h,3fh,d5h
+			db	c7h,edh,26h,36h,2fh,32h,48h,33h
+			db	adh,c9h,7dh,a2h,02h,01h,15h,c4h
+			db	14h,c4h,a8h,8ah,d3h,77h,3ah,77h
+			db	0eh,98h,aeh,4bh,01h,43h,5bh,a8h
+			db	44h,2ah,79h,39h,edh,33h,e7h,80h
+			db	03h,53h,edh,7eh,05h,11h,a3h,bch
+			db	91h,99h,71h,33h,ech,11h,c6h,d2h
+			db	6ch,c9h,7ch,b2h,a4h,8bh,d0h,58h
+			db	00h,9ch,99h,63h,4ah,deh,64h,88h
+			db	ebh,c0h,d8h,9eh,b2h,0eh,05h,99h
+			db	c7h,03h,d2h,d0h,cah,f4h,82h,37h
+			db	7eh,84h,69h,2eh,22h,6ch,9ah,3ch
+			db	5ch,8dh,37h,0bh,88h,f0h,31h,a6h
+			db	32h,a6h,0dh,2bh,64h,51h,efh,7eh
+			db	d3h,bfh,dch,feh,deh,eeh,01h,19h
+			db	1bh,7fh,9ah,e2h,d8h,6dh,e2h,03h
+			db	33h,15h,01h,bfh,53h,e3h,2eh,35h
+			db	32h,f2h,69h,62h,0dh,c2h,33h,58h
+			db	2fh,36h,cch,c8h,ebh,70h,23h,07h
+			db	06h,f6h,78h,94h,1dh,ddh,84h,00h
+			db	0eh,d2h,b6h,49h,a4h,58h,d4h,27h
+			db	96h,94h,f3h,a9h,79h,cbh,c2h,e6h
+			db	55h,1fh,62h,16h,18h,abh,93h,56h
+			db	31h,91h,ech,01h,e2h,f6h,71h,0bh
+			db	c8h,41h,abh,feh,95h,63h,36h,89h
+			db	33h,3fh,8ch,0fh,38h,46h,f7h,c9h
+			db	49h,2fh,4dh,b4h,94h,3ch,fah,3bh
+			db	f6h,3dh,20h,58h,ech,cch,8ch,11h
+			db	d2h,24h,e4h,feh,77h,adh,e1h,21h
+			db	79h,60h,2ah,aeh,3ah,11h,0fh,67h
+			db	84h,dbh,95h,03h,a8h,6ah,18h,4ch
+			db	c1h,55h,cch,c9h,8bh,e4h,f3h,deh
+			db	2ch,c2h,5ch,5eh,13h,26h,f1h,10h
+			db	72h,deh,74h,abh,fbh,08h,16h,1bh
+			db	12h,8dh,89h,2dh,95h,52h,7eh,3dh
+			db	85h,dch,3fh,ebh,4fh,beh,8ch,cbh
+			db	ach,53h,31h,c0h,d1h,85h,a1h,a4h
+			db	94h,feh,b1h,23h,25h,b6h,2fh,abh
+			db	4eh,f0h,3dh,19h,23h,4fh,1ah,bfh
+			db	69h,19h,deh,60h,91h,34h,d9h,6ah
+			db	b9h,36h,ddh,03h,51h,1fh,cbh,43h
+			db	cah,23h,1bh,06h,99h,57h,08h,dbh
+			db	e3h,ddh,d2h,5eh,27h,74h,30h,b4h
+			db	c3h,c9h,f9h,0eh,ceh,13h,82h,10h
+			db	48h,1dh,a0h,53h,4fh,60h,2dh,96h
+			db	48h,c3h,5dh,97h,3dh,8ch,32h,98h
+			db	eeh,7fh,72h,e2h,4bh,e9h,bah,7bh
+			db	19h,ech,8ch,fbh,95h,feh,55h,15h
+			db	abh,6ch,99h,78h,4bh,45h,e8h,a2h
+			db	68h,d1h,56h,7ch,d9h,efh,21h,afh
+			db	18h,b0h,d1h,30h,2bh,c1h,7ch,cah
+			db	78h,08h,46h,4bh,f7h,f3h,c1h,e3h
+			db	2eh,1ch,3fh,8eh,d4h,94h,6fh,10h
+			db	ach,d8h,dfh,21h,dfh,e7h,67h,ddh
+			db	d2h,29h,eeh,c3h,f7h,e6h,0ah,38h
+			db	7bh,d3h,c7h,a9h,67h,18h,f1h,c3h
+			db	d3h,9ch,5dh,48h,2dh,65h,32h,fdh
+			db	47h,3dh,cah,6fh,b9h,2fh,62h,09h
+			db	4ah,60h,0bh,afh,b1h,02h,62h,6ch
+			db	6bh,c2h,7ch,41h,95h,96h,d5h,1eh
+			db	5eh,eeh,20h,73h,fdh,c8h,b5h,c9h
+			db	91h,00h,dfh,d6h,42h,27h,1bh,18h
+			db	eah,bah,34h,dfh,34h,aeh,7fh,edh
+			db	edh,29h,44h,02h,02h,1bh,11h,53h
+			db	74h,31h,ach,b6h,1dh,b4h,2dh,9dh
+			db	5fh,3fh,36h,62h,3ch,a3h,81h,bdh
+			db	0bh,c0h,a4h,04h,83h,feh,c4h,9eh
+			db	6fh,fbh,80h,e8h,e8h,ach,0bh,44h
+			db	9ah,b7h,51h,01h,46h,bdh,3ch,63h
+			db	ffh,50h,aah,f1h,8ch,63h,d1h,91h
+			db	01h,b4h,b0h,3ah,b5h,1fh,3bh,f9h
+			db	14h,03h,fah,e3h,94h,bbh,b2h,64h
+			db	6bh,67h,61h,40h,42h,2fh,aah,46h
+			db	6ah,51h,82h,22h,b9h,cah,d4h,6dh
+			db	52h,cfh,67h,d2h,8dh,64h,91h,11h
+			db	25h,d5h,22h,34h,1dh,cfh,0bh,54h
+			db	c5h,45h,deh,d0h,b3h,dah,48h,78h
+			db	90h,aeh,f7h,f1h,92h,d4h,4ah,e2h
+			db	a8h,dbh,3fh,12h,edh,e0h,b5h,7fh
+			db	9eh,1fh,b1h,1bh,e5h,16h,38h,47h
+			db	c8h,29h,b5h,1eh,3ah,75h,67h,1eh
+			db	a6h,f9h,3bh,0bh,2ch,ddh,f6h,58h
+			db	18h,ffh,07h,7dh,deh,39h,11h,7fh
+			db	3eh,59h,d2h,81h,1ah,efh,2ch,81h
+			db	33h,0ah,91h,fah,28h,20h,6bh,9ch
+			db	b2h,b4h,14h,f6h,f3h,6ah,eah,f1h
+			db	4dh,23h,f9h,0dh,96h,c3h,e4h,5ah
+			db	b3h,80h,b4h,83h,8ah,d5h,a6h,68h
+			db	b7h,d2h,cfh,a1h,bah,cdh,b3h,43h
+			db	22h,edh,32h,60h,26h,10h,f7h,50h
+			db	f3h,1fh,4fh,61h,1eh,bfh,2bh,b1h
+			db	9fh,24h,20h,8fh,b4h,6eh,54h,74h
+			db	6ch,e6h,feh,61h,15h,0dh,0dh,d2h
+			db	84h,fdh,f8h,a7h,feh,7ah,06h,e2h
+			db	40h,0bh,65h,92h,75h,c3h,efh,eeh
+			db	bfh,71h,92h,e3h,72h,57h,49h,78h
+			db	52h,0ah,8fh,75h,24h,31h,1fh,42h
+			db	d2h,14h,a2h,9bh,c0h,feh,20h,9ah
+			db	a8h,42h,b9h,46h,b8h,d3h,a1h,0ah
+			db	eeh,20h,d1h,ebh,99h,16h,58h,fbh
+			db	bdh,c7h,6ch,3dh,73h,e7h,07h,54h
+			db	1bh,e0h,f0h,7eh,1ch,e8h,75h,36h
+			db	1dh,d8h,90h,66h,32h,2eh,13h,f4h
+			db	77h,b5h,b8h,51h,07h,b0h,72h,d4h
+			db	1eh,f2h,30h,80h,05h,d3h,ach,6fh
+			db	b4h,8dh,b6h,33h,f3h,bch,58h,a4h
+			db	efh,95h,1dh,e1h,cbh,3eh,72h,a4h
+			db	78h,b1h,deh,76h,69h,f9h,a6h,38h
+			db	c8h,80h,3eh,c8h,75h,12h,ceh,deh
+			db	e0h,87h,a6h,beh,3ah,ddh,22h,cch
+			db	15h,a7h,81h,fbh,98h,dah,a2h,96h
+			db	2ah,feh,e8h,82h,f2h,22h,19h,bch
+			db	c2h,36h,3bh,9eh,97h,96h,eeh,cbh
+			db	f4h,cfh,9ah,e9h,aah,65h,cch,36h
+			db	ach,88h,38h,8dh,4ah,dbh,83h,c0h
+			db	84h,15h,e5h,ech,afh,05h,05h,4ah
+			db	40h,85h,e7h,28h,9ch,0dh,f1h,c9h
+			db	91h,47h,49h,72h,b1h,deh,9ch,1dh
+			db	8ch,dbh,bah,04h,0dh,a7h,46h,36h
+			db	c3h,beh,04h,6bh,f7h,81h,d6h,90h
+			db	62h,ffh,0fh,29h,1dh,dch,63h,87h
+			db	41h,6ch,1dh,7dh,fah,dfh,83h,b4h
+			db	e9h,bdh,72h,75h,8ch,49h,c8h,32h
+			db	8ah,b8h,2ch,84h,28h,b9h,b9h,cbh
+			db	f2h,45h,f9h,f3h,6dh,b5h,d8h,b1h
+			db	ech,4ch,e3h,fdh,36h,b6h,75h,7ch
+			db	a4h,34h,54h,86h,b2h,0bh,2fh,bdh
+			db	39h,81h,a7h,c0h,1bh,8bh,87h,e2h
+			db	e4h,68h,c8h,d3h,bch,7eh,9eh,94h
+			db	b4h,f4h,21h,6ch,f8h,fdh,20h,91h
+			db	24h,f7h,cch,cbh,50h,15h,beh,cbh
+			db	e4h,93h,11h,0ah,09h,d0h,8ch,d1h
+			db	c9h,eeh,7ch,c5h,93h,99h,68h,2dh
+			db	f2h,23h,c3h,3ch,26h,afh,25h,2bh
+			db	85h,57h,23h,62h,05h,7ch,b2h,e5h
+			db	ddh,59h,17h,29h,2fh,c4h,d1h,59h
+			db	04h,07h,19h,56h,4fh,fbh,8bh,82h
+			db	10h,57h,c1h,aeh,d6h,92h,2ch,4ah
+			db	05h,43h,23h,04h,4ah,02h,89h,41h
+			db	f1h,7fh,cdh,6ch,bbh,65h,f8h,9eh
+			db	e8h,04h,49h,c8h,84h,aeh,69h,10h
+			db	b7h,30h,d3h,23h,3dh,06h,0fh,e9h
+			db	a4h,95h,19h,10h,93h,06h,f9h,42h
+			db	89h,88h,d0h,83h,11h,08h,30h,79h
+			db	47h,49h,16h,5ah,ddh,fdh,9ch,07h
+			db	53h,30h,b9h,d1h,e4h,19h,3eh,81h
+			db	b6h,6dh,dah,71h,34h,80h,28h,a1h
+			db	bah,63h,08h,66h,30h,aeh,dfh,f9h
+			db	4dh,0dh,93h,9ch,48h,5eh,6ch,a5h
+			db	96h,77h,1eh,2fh,33h,40h,a1h,f9h
+			db	bah,5fh,cch,76h,e2h,c8h,c9h,35h
+			db	2ch,ebh,efh,3ah,8fh,dah,d3h,02h
+			db	46h,33h,d2h,c7h,37h,7ch,9ah,05h
+			db	f6h,f5h,66h,6fh,e5h,77h,43h,00h
+			db	7dh,aeh,6ah,dah,64h,fdh,ech,d1h
+			db	12h,29h,f2h,8ch,71h,bah,f4h,78h
+			db	5eh,a5h,edh,cbh,d1h,bfh,50h,48h
+			db	b5h,8dh,30h,72h,a4h,3ch,75h,2dh
+			db	d3h,b5h,43h,4eh,d8h,fch,beh,ach
+			db	2fh,8ah,63h,e2h,afh,00h,61h,cfh
+			db	8fh,cfh,50h,ech,6eh,45h,bfh,adh
+			db	91h,08h,eeh,1ch,46h,37h,27h,e9h
+			db	c3h,01h,4ch,e2h,14h,3ah,0ch,ceh
+			db	b3h,d9h,a5h,c3h,85h,8fh,5fh,74h
+			db	e0h,53h,4bh,23h,11h,b6h,0fh,bah
+			db	00h,2ah,43h,ceh,d3h,f9h,26h,9dh
+			db	7fh,e6h,d6h,55h,7bh,97h,58h,d0h
+			db	6ch,bah,72h,cbh,b4h,99h,14h,15h
+			db	9ch,00h,10h,4dh,20h,c0h,8ch,72h
+			db	17h,d5h,71h,0ah,04h,ach,a2h,99h
+			db	03h,31h,06h,75h,63h,4ah,04h,f7h
+			db	3dh,71h,c1h,dfh,3dh,15h,72h,94h
+			db	18h,3fh,3eh,c5h,3fh,37h,8fh,ach
+			db	9ch,a2h,fbh,58h,66h,33h,b3h,98h
+			db	67h,51h,6ah,23h,2ah,11h,34h,0fh
+			db	e1h,f7h,74h,41h,56h,20h,f6h,6bh
+			db	d2h,bbh,adh,fah,8dh,22h,11h,ech
+			db	56h,1fh,16h,5ah,eeh,32h,9eh,64h
+			db	51h,2eh,4ch,7dh,bbh,50h,2dh,d0h
+			db	6bh,b6h,86h,6fh,10h,1bh,a1h,18h
+			db	7ah,55h,69h,25h,afh,bah,abh,80h
+			db	44h,beh,f5h,06h,67h,f4h,a5h,36h
+			db	edh,61h,fdh,f2h,66h,18h,aeh,8eh
+			db	fch,04h,8bh,b4h,c0h,c8h,d0h,7dh
+			db	9eh,b0h,ceh,2ah,95h,e7h,6ch,50h
+			db	bch,a2h,46h,26h,5fh,aah,4ah,bbh
+			db	e3h,37h,40h,10h,90h,8fh,52h,2ah
+			db	89h,6ch,5bh,fch,1bh,eeh,fah,81h
+			db	eeh,b6h,7ah,02h,55h,8dh,a3h,eah
+			db	64h,62h,5ch,88h,a0h,65h,fch,54h
+			db	99h,d5h,37h,d1h,78h,6ch,efh,a0h
+			db	9bh,72h,1ah,c1h,9ch,0eh,63h,95h
+			db	9dh,7eh,a0h,e2h,17h,edh,64h,58h
+			db	10h,aeh,cah,10h,a4h,3ah,e3h,3bh
+			db	dch,3dh,f1h,d1h,60h,1ah,75h,b5h
+			db	10h,19h,4bh,5ch,b4h,12h,c2h,02h
+			db	34h,00h,c9h,2ah,0dh,b0h,31h,1eh
+			db	dbh,86h,55h,7fh,feh,0ch,02h,46h
+			db	f0h,47h,6bh,88h,b1h,a1h,90h,2ah
+			db	9ah,f6h,54h,cdh,01h,e4h,b2h,5dh
+			db	55h,0bh,b3h,89h,98h,66h,69h,18h
+			db	48h,7bh,98h,81h,9bh,3fh,ceh,f9h
+			db	68h,f9h,deh,8ah,81h,29h,21h,05h
+			db	8ch,ach,beh,6eh,36h,e9h,7fh,37h
+			db	00h,83h,52h,d5h,98h,c6h,63h,c2h
+			db	8bh,7eh,55h,28h,33h,7ah,c6h,58h
+			db	cbh,47h,70h,09h,a5h,f7h,e3h,5ch
+			db	f2h,c5h,2ah,0fh,4bh,fah,d0h,7eh
+			db	58h,2eh,e7h,f8h,aah,efh,adh,82h
+			db	70h,81h,2eh,0fh,9bh,28h,eeh,31h
+			db	77h,b3h,71h,ech,e9h,04h,c3h,23h
+			db	f2h,78h,5bh,e4h,24h,f5h,cbh,80h
+			db	00h,91h,9fh,8ch,70h,46h,94h,30h
+			db	8bh,50h,feh,aah,98h,48h,a7h,77h
+			db	8dh,cch,9fh,c6h,07h,07h,a4h,1ch
+			db	1eh,05h,6eh,2dh,fah,37h,f1h,51h
+			db	c0h,05h,28h,ebh,0ch,2dh,b7h,75h
+			db	4ch,e0h,dfh,5bh,dah,dbh,48h,58h
+			db	0eh,dbh,e9h,50h,24h,2dh,eeh,f6h
+			db	ddh,f2h,93h,3eh,24h,58h,62h,46h
+			db	fbh,d9h,5ah,92h,22h,7fh,3eh,55h
+			db	7ah,17h,c4h,39h,beh,63h,beh,b5h
+			db	cbh,17h,7ah,85h,63h,d4h,83h,08h
+			db	38h,54h,55h,4fh,3ch,d0h,b6h,3dh
+			db	65h,97h,feh,d0h,65h,9ah,b0h,b3h
+			db	dch,ech,a8h,f5h,e9h,7fh,2bh,99h
+			db	aah,0ah,d6h,36h,2ah,8ch,ach,07h
+			db	e9h,72h,adh,01h,2ah,feh,dah,f6h
+			db	45h,06h,c5h,a8h,d5h,2bh,2bh,14h
+			db	91h,b3h,d4h,deh,73h,05h,ach,64h
+			db	81h,53h,dfh,07h,67h,f9h,51h,05h
+			db	48h,55h,21h,e2h,37h,a1h,d8h,48h
+			db	ach,c0h,2eh,20h,14h,5fh,b0h,5fh
+			db	bdh,ech,74h,5eh,d9h,efh,7dh,67h
+			db	37h,56h,3eh,a5h,09h,6eh,8fh,b0h
+			db	15h,88h,95h,b3h,2eh,27h,62h,28h
+			db	1ah,3ch,f7h,55h,23h,b7h,3fh,5ch
+			db	7ch,ceh,31h,62h,26h,f0h,94h,f7h
+			db	ddh,48h,e5h,cdh,29h,a4h,f8h,70h
+			db	b8h,c6h,b3h,feh,d9h,31h,35h,e7h
+			db	26h,5eh,83h,f1h,cah,7fh,43h,12h
+			db	2fh,63h,c0h,12h,6bh,4bh,dbh,90h
+			db	e3h,38h,7fh,fah,58h,0ch,69h,a4h
+			db	61h,efh,f8h,41h,aeh,51h,dfh,2eh
+			db	33h,7eh,1ah,68h,2ah,ddh,72h,7dh
+			db	2fh,bch,4fh,fch,eeh,60h,efh,29h
+			db	d8h,31h,7ch,22h,44h,bfh,2ah,00h
+			db	54h,75h,17h,adh,94h,9dh,2bh,93h
+			db	1fh,b9h,61h,73h,1fh,60h,02h,1ch
+			db	c0h,a3h,f6h,55h,15h,f7h,b5h,2ch
+			db	32h,05h,9fh,61h,b8h,e5h,86h,c1h
+			db	00h,48h,4ch,fbh,2ch,97h,23h,ach
+			db	d1h,ech,8ah,67h,71h,abh,3eh,aah
+			db	90h,86h,49h,6fh,afh,60h,eah,cdh
+			db	9ch,ddh,88h,62h,46h,cfh,47h,b0h
+			db	ddh,9dh,02h,40h,f9h,4bh,a1h,38h
+			db	54h,0ah,37h,39h,04h,a0h,c9h,4fh
+			db	a3h,16h,cah,78h,98h,9ch,11h,43h
+			db	e9h,64h,8ah,b1h,f9h,27h,88h,54h
+			db	d7h,cah,1eh,85h,52h,ach,2ah,f8h
+			db	48h,02h,abh,95h,4bh,e3h,29h,17h
+			db	49h,aah,c4h,41h,e4h,56h,73h,85h
+			db	6bh,7bh,d3h,14h,c2h,efh,17h,fah
+			db	7ah,ffh,c8h,e6h,f5h,32h,7ah,93h
+			db	6eh,37h,6dh,14h,e1h,59h,24h,e5h
+			db	4eh,bah,c4h,bbh,55h,38h,7fh,5ch
+			db	76h,5fh,b5h,24h,d5h,fah,87h,48h
+			db	93h,abh,a5h,93h,89h,a9h,4dh,bdh
+			db	79h,23h,93h,aeh,07h,c9h,f5h,d2h
+			db	39h,09h,18h,a7h,29h,1bh,cah,3bh
+			db	d5h,cdh,dch,c3h,ech,6dh,a0h,60h
+			db	ebh,feh,ech,3ch,e5h,b1h,02h,5bh
+			db	adh,84h,67h,c3h,86h,29h,9ch,80h
+			db	6fh,b4h,e7h,1bh,a5h,b3h,eah,56h
+			db	1bh,9bh,42h,91h,9bh,69h,85h,a8h
+			db	b3h,f0h,c7h,28h,53h,3ch,f3h,dch
+			db	0ch,5fh,57h,89h,81h,5ah,abh,abh
+			db	ech,88h,31h,04h,c8h,4dh,19h,0ah
+			db	bbh,48h,9ah,1ch,ddh,74h,86h,d4h
+			db	8bh,b7h,f8h,8eh,2eh,71h,9dh,fah
+			db	3eh,10h,50h,cfh,41h,bdh,dfh,e8h
+			db	f9h,10h,8fh,54h,bbh,a4h,42h,39h
+			db	1fh,53h,ech,ffh,7ah,b8h,77h,1bh
+			db	66h,7dh,f2h,e1h,f4h,0bh,6bh,62h
+			db	97h,13h,1bh,51h,4dh,0eh,8fh,77h
+			db	6ch,64h,79h,9bh,0fh,79h,2ah,d2h
+			db	29h,c7h,14h,c5h,4bh,bch,61h,8ch
+			db	e4h,2ch,03h,14h,52h,79h,9eh,90h
+			db	abh,0ah,99h,95h,26h,d8h,19h,ceh
+			db	8dh,86h,a4h,a3h,e9h,2fh,4ah,d8h
+			db	19h,84h,9fh,4bh,6fh,76h,65h,bfh
+			db	42h,12h,cfh,e5h,8bh,58h,edh,99h
+			db	b8h,cbh,7fh,09h,0fh,ceh,38h,29h
+			db	5ch,57h,3bh,f8h,ddh,f3h,f5h,6fh
+			db	4dh,f8h,41h,ach,13h,cbh,b8h,2ch
+			db	8eh,46h,4eh,10h,7bh,98h,93h,39h
+			db	fbh,56h,3ch,54h,cbh,e2h,74h,7fh
+			db	77h,0eh,8dh,99h,74h,62h,e2h,92h
+			db	c1h,3ah,5dh,dch,cah,8fh,31h,fah
+			db	2ah,d5h,5ch,46h,f0h,d2h,2ah,e4h
+			db	35h,cbh,c5h,32h,34h,bbh,bch,bfh
+			db	10h,d7h,48h,a3h,edh,a9h,c8h,72h
+			db	7ah,d2h,f9h,edh,f1h,95h,adh,79h
+			db	beh,12h,deh,21h,feh,76h,92h,52h
+			db	90h,b1h,b4h,f6h,f7h,42h,7ch,4bh
+			db	66h,79h,f6h,d9h,17h,94h,5ah,73h
+			db	b1h,7eh,9ah,c2h,21h,a7h,44h,c6h
+			db	ddh,1eh,97h,7bh,c6h,e5h,2fh,ffh
+			db	b4h,3bh,b2h,75h,a4h,20h,c9h,e2h
+			db	17h,b0h,42h,5eh,b1h,7ch,bfh,47h
+			db	98h,ddh,b9h,ceh,afh,96h,dch,b2h
+			db	a7h,dbh,c9h,80h,b6h,72h,e6h,36h
+			db	0bh,93h,f2h,e8h,4dh,eah,72h,b8h
+			db	0bh,9ch,d5h,05h,31h,e8h,6ah,82h
+			db	4fh,5bh,08h,3ah,9fh,51h,fch,a3h
+			db	aeh,a9h,48h,34h,abh,3ch,1dh,c0h
+			db	81h,3bh,f8h,25h,ddh,ech,d9h,e9h
+			db	60h,fah,3ah,9fh,05h,e7h,6dh,23h
+			db	8fh,f4h,09h,00h,bah,74h,44h,13h
+			db	a4h,fah,34h,dfh,8ah,42h,6fh,beh
+			db	8bh,80h,b3h,4dh,a0h,64h,70h,a2h
+			db	27h,c3h,40h,1fh,1bh,55h,f3h,aah
+			db	22h,88h,c0h,9dh,cch,17h,51h,1ah
+			db	0fh,7eh,5dh,30h,5ah,35h,b1h,1fh
+			db	32h,f0h,adh,38h,62h,cdh,03h,78h
+			db	72h,47h,91h,10h,dch,01h,74h,87h
+			db	3ch,32h,c3h,a0h,03h,d6h,1ah,3eh
+			db	ceh,47h,40h,4dh,dbh,d4h,7ah,f8h
+			db	23h,50h,16h,5dh,17h,73h,82h,c0h
+			db	d5h,d0h,28h,7ch,03h,c3h,58h,36h
+			db	20h,3fh,d4h,b8h,feh,44h,8bh,64h
+			db	d8h,74h,2dh,b9h,ebh,54h,0eh,62h
+			db	6ah,39h,03h,7bh,a3h,0bh,c5h,65h
+			db	1bh,a4h,6ah,dbh,6eh,55h,afh,93h
+			db	bdh,6ch,4bh,c0h,5ch,a4h,73h,90h
+			db	69h,cah,28h,f9h,beh,e8h,24h,2dh
+			db	e1h,a0h,feh,19h,a9h,44h,53h,14h
+			db	3bh,48h,d3h,6fh,38h,2fh,21h,2eh
+			db	e8h,a9h,1bh,05h,66h,b7h,99h,afh
+			db	cdh,73h,b9h,7ch,cah,77h,afh,42h
+			db	14h,58h,36h,4ch,30h,72h,fch,88h
+			db	f5h,b8h,5bh,81h,5ch,24h,42h,a8h
+			db	3ah,2fh,81h,7dh,8bh,f6h,55h,f1h
+			db	89h,99h,c2h,fah,27h,b9h,c7h,f0h
+			db	c0h,95h,4bh,67h,84h,86h,72h,1dh
+			db	ceh,1ah,ddh,5fh,90h,bbh,30h,22h
+			db	b8h,9eh,a7h,07h,d5h,c9h,32h,bah
+			db	d0h,04h,d8h,02h,00h,31h,9ah,7ah
+			db	19h,97h,88h,fbh,a6h,76h,64h,a2h
+			db	48h,27h,54h,11h,e5h,7eh,9ch,0fh
+			db	58h,40h,2dh,56h,f7h,79h,e0h,d9h
+			db	8ah,f1h,a8h,77h,67h,5eh,88h,37h
+			db	e7h,adh,72h,a6h,47h,f4h,0dh,97h
+			db	1dh,97h,9eh,b0h,3bh,7ch,11h,8bh
+			db	36h,50h,1dh,6fh,8eh,39h,d9h,ach
+			db	38h,60h,01h,85h,94h,7ah,0bh,1bh
+			db	3eh,30h,5dh,37h,93h,c6h,80h,d4h
+			db	3fh,adh,00h,12h,cah,16h,82h,60h
+			db	cbh,eah,01h,a8h,b7h,4bh,18h,efh
+			db	c2h,4eh,34h,44h,c9h,c5h,52h,47h
+			db	ebh,8eh,68h,4eh,a6h,b9h,9dh,8ah
+			db	fch,e2h,a7h,9eh,89h,a7h,04h,22h
+			db	52h,cdh,3fh,a9h,30h,12h,f8h,0eh
+			db	c6h,2ch,89h,1fh,c9h,4fh,ach,ceh
+			db	29h,2ch,41h,64h,49h,85h,75h,47h
+			db	d2h,50h,94h,6ah,97h,75h,c5h,00h
+			db	e6h,76h,8ah,9fh,71h,96h,d7h,96h
+			db	02h,d6h,6eh,44h,fch,e4h,6dh,3dh
+			db	99h,32h,74h,a1h,cah,43h,deh,efh
+			db	b6h,46h,efh,89h,75h,bdh,1eh,afh
+			db	79h,a4h,58h,21h,aah,17h,7ah,8eh
+			db	99h,a3h,e7h,0fh,8eh,87h,c0h,31h
+			db	7bh,8fh,47h,f9h,fch,81h,d9h,1eh
+			db	3eh,e4h,1dh,c2h,5dh,c7h,d6h,39h
+			db	c0h,74h,1bh,52h,31h,c0h,81h,44h
+			db	4ah,93h,6ah,44h,37h,bfh,f4h,2ah
+			db	55h,8eh,73h,e1h,69h,b2h,12h,99h
+			db	7dh,23h,cch,8fh,cdh,a2h,94h,5eh
+			db	f1h,e6h,77h,4eh,16h,35h,5eh,78h
+			db	1ch,ddh,05h,1fh,b8h,5ch,0fh,c7h
+			db	85h,d7h,96h,8eh,0bh,1eh,8eh,46h
+			db	76h,dfh,e7h,51h,55h,7dh,4ah,63h
+			db	9fh,cfh,ech,fdh,64h,f1h,eeh,80h
+			db	beh,a5h,21h,9ch,3ah,51h,ebh,63h
+			db	97h,a0h,cch,03h,e0h,4eh,9fh,0fh
+			db	02h,e8h,09h,32h,f8h,d7h,d1h,d3h
+			db	c9h,9ch,cdh,f8h,69h,87h,deh,d4h
+			db	01h,8ah,8bh,8bh,43h,2fh,28h,c1h
+			db	62h,2ah,5ch,79h,d9h,bch,ach,bch
+			db	40h,8ah,43h,01h,95h,e0h,0fh,e2h
+			db	d3h,dah,54h,97h,6bh,88h,4fh,5ah
+			db	57h,f2h,5ch,88h,8eh,38h,29h,5ch
+			db	99h,3fh,ffh,98h,4eh,34h,c1h,abh
+			db	95h,0ah,dch,61h,9fh,9dh,84h,7ah
+			db	38h,3fh,70h,d1h,27h,e4h,45h,e6h
+			db	cdh,13h,a1h,d9h,2dh,3bh,74h,dch
+			db	11h,e1h,aah,ceh,5ch,20h,36h,14h
+			db	dfh,84h,92h,03h,5bh,11h,48h,c1h
+			db	48h,2eh,11h,c4h,68h,68h,c6h,23h
+			db	7fh,18h,bbh,92h,f7h,01h,3ch,a5h
+			db	04h,43h,0fh,16h,cdh,90h,05h,02h
+			db	c7h,82h,2fh,e5h,b4h,1bh,aah,7ah
+			db	96h,45h,52h,3fh,75h,ceh,94h,96h
+			db	c4h,cfh,a8h,9eh,80h,01h,93h,7fh
+			db	19h,22h,a9h,b6h,b2h,1ah,3dh,2eh
+			db	5bh,b0h,9eh,16h,46h,5eh,62h,e2h
+			db	18h,f8h,5bh,9ah,9ch,27h,90h,a8h
+			db	41h,a5h,28h,9eh,71h,6ah,22h,09h
+			db	0bh,b3h,d8h,3bh,65h,8ah,08h,00h
+			db	31h,2ah,96h,72h,85h,f9h,6bh,1ah
+			db	84h,ceh,d8h,6ch,3eh,33h,9ah,e9h
+			db	c7h,48h,a0h,abh,e2h,0bh,27h,11h
+			db	04h,22h,c9h,c9h,ech,5eh,a9h,3dh
+			db	1bh,9ah,13h,eah,6bh,61h,d0h,2ch
+			db	cch,1ah,cah,0dh,aeh,f9h,40h,b9h
+			db	0ch,cch,fah,76h,cch,65h,2eh,4bh
+			db	37h,7ch,96h,25h,72h,37h,d8h,b5h
+			db	6dh,b5h,f9h,94h,4bh,c7h,8ah,feh
+			db	67h,f8h,9fh,84h,02h,18h,71h,b9h
+			db	b7h,03h,ceh,aah,12h,2bh,d2h,17h
+			db	0ch,c9h,28h,21h,e2h,3ah,2bh,5ch
+			db	75h,3ah,a7h,1ah,8bh,0fh,feh,0dh
+			db	55h,10h,fch,42h,6dh,f2h,eeh,a2h
+			db	99h,ech,73h,94h,0dh,f1h,0dh,f8h
+			db	7eh,27h,eeh,fbh,cbh,dbh,c2h,c1h
+			db	36h,deh,b8h,d6h,8ah,7ah,59h,43h
+			db	6ch,2fh,d6h,adh,cch,05h,30h,c1h
+			db	a7h,20h,3fh,7dh,5fh,4eh,3eh,a0h
+			db	7fh,efh,b8h,02h,deh,80h,48h,eeh
+			db	49h,7ch,99h,4ah,a4h,58h,0bh,1fh
+			db	8dh,4bh,b5h,0dh,88h,dah,28h,31h
+			db	37h,09h,71h,33h,9ch,23h,72h,fch
+			db	80h,3bh,adh,11h,edh,83h,efh,89h
+			db	c0h,7ah,09h,20h,92h,87h,84h,a1h
+			db	fch,27h,88h,11h,31h,07h,9ah,2bh
+			db	0ch,0dh,cah,f1h,41h,76h,27h,38h
+			db	2dh,63h,80h,91h,14h,aeh,9eh,6ah
+			db	a0h,8ah,43h,50h,abh,4eh,4ah,fdh
+			db	50h,e4h,34h,6ch,31h,4bh,c8h,20h
+			db	50h,c3h,2eh,fbh,09h,98h,5ah,eeh
+			db	24h,2dh,bdh,6dh,18h,0bh,ach,e9h
+			db	6ah,55h,26h,95h,39h,86h,afh,11h
+			db	07h,b2h,d1h,b6h,59h,ech,1bh,1bh
+			db	30h,e5h,f4h,83h,9bh,7ch,5dh,99h
+			db	92h,edh,d4h,c8h,96h,05h,2eh,5eh
+			db	e4h,8bh,6eh,e5h,7fh,77h,82h,ach
+			db	b9h,83h,93h,f4h,e5h,b3h,4fh,a8h
+			db	beh,43h,c4h,18h,93h,d4h,ebh,d7h
+			db	65h,e9h,44h,ebh,ech,9fh,1eh,dah
+			db	d2h,45h,32h,02h,a1h,50h,a5h,bch
+			db	fah,6fh,d1h,bfh,5eh,13h,d9h,bdh
+			db	6ch,06h,c7h,6ch,0bh,eah,4dh,4eh
+			db	1fh,64h,adh,33h,20h,fbh,0ah,e0h
+			db	0ah,b8h,a1h,2ch,6dh,8dh,ceh,11h
+			db	e7h,9ah,b5h,b1h,c7h,7eh,d8h,afh
+			db	4ah,fah,08h,9ch,51h,e3h,44h,e8h
+			db	86h,a6h,0ch,29h,75h,d7h,ffh,c9h
+			db	13h,dch,08h,48h,71h,3eh,a5h,87h
+			db	95h,d4h,e7h,b2h,33h,7ch,11h,06h
+			db	aah,88h,13h,16h,f3h,ebh,94h,b9h
+			db	58h,4fh,78h,afh,94h,51h,8fh,70h
+			db	71h,dch,deh,23h,13h,b0h,53h,14h
+			db	85h,6fh,e3h,b9h,b9h,00h,93h,43h
+			db	75h,26h,3eh,6eh,79h,bdh,80h,6eh
+			db	c5h,80h,42h,15h,5fh,18h,b6h,7eh
+			db	75h,d7h,37h,08h,bch,a0h,14h,b0h
+			db	94h,99h,bbh,b7h,5bh,bfh,b1h,1bh
+			db	49h,0bh,eeh,36h,ebh,1eh,b5h,91h
+			db	43h,22h,48h,e3h,dch,cch,c9h,b8h
+			db	3dh,09h,d2h,f6h,cbh,01h,4eh,47h
+			db	15h,7bh,52h,feh,5bh,53h,dfh,a5h
+			db	14h,16h,25h,09h,c9h,51h,2dh,fch
+			db	6ch,e3h,9ah,e3h,56h,2ch,2fh,b6h
+			db	98h,23h,cbh,aah,53h,7ch,3ah,99h
+			db	43h,48h,abh,3ch,0dh,d9h,82h,dch
+			db	a6h,9ah,83h,ebh,6eh,1dh,40h,57h
+			db	8dh,3ah,0ch,2eh,78h,b2h,f0h,a7h
+			db	7eh,dah,56h,e1h,fah,d8h,45h,bfh
+			db	fch,13h,00h,03h,f3h,2ch,79h,40h
+			db	0fh,93h,25h,0ah,d5h,7dh,dch,92h
+			db	afh,11h,24h,14h,05h,d6h,68h,28h
+			db	e9h,fch,44h,f5h,2bh,cah,13h,cbh
+			db	b9h,e0h,b6h,f0h,a4h,12h,29h,18h
+			db	10h,32h,cdh,7dh,4ah,52h,bfh,7fh
+			db	b8h,2dh,73h,15h,73h,67h,bdh,94h
+			db	00h,e4h,f6h,c7h,feh,18h,7bh,73h
+			db	83h,c3h,feh,28h,1ch,e8h,81h,8eh
+			db	bfh,2fh,b9h,c3h,eah,86h,20h,f4h
+			db	21h,6ch,15h,e2h,2fh,e6h,37h,f8h
+			db	1ah,7fh,a2h,fah,c1h,efh,deh,68h
+			db	0eh,efh,abh,2dh,1bh,bah,23h,2eh
+			db	92h,bah,c4h,4dh,ebh,1ch,e8h,48h
+			db	dah,bdh,b2h,d3h,60h,11h,cdh,b9h
+			db	4eh,93h,2dh,ach,7eh,a8h,1eh,18h
+			db	ach,83h,bbh,fch,30h,a9h,6bh,d8h
+			db	98h,bbh,47h,9fh,bch,d4h,8eh,7fh
+			db	b9h,37h,73h,cah,47h,19h,ech,f1h
+			db	b1h,47h,26h,95h,69h,e3h,ddh,e0h
+			db	46h,01h,eeh,b7h,70h,a5h,cbh,6fh
+			db	5fh,39h,a9h,f3h,edh,04h,40h,5fh
+			db	5fh,57h,32h,78h,75h,76h,2fh,30h
+			db	e1h,f1h,07h,11h,3dh,fah,f4h,76h
+			db	04h,beh,eeh,34h,7dh,39h,cah,2dh
+			db	f0h,b5h,0fh,e4h,d1h,30h,72h,34h
+			db	47h,bfh,07h,06h,53h,87h,7fh,97h
+			db	c3h,72h,c7h,22h,dfh,4ch,2eh,88h
+			db	76h,66h,30h,3fh,87h,efh,39h,a5h
+			db	d8h,25h,7eh,a7h,f4h,a0h,a5h,dfh
+			db	2eh,f1h,b1h,6ah,03h,8bh,7ah,c7h
+			db	57h,60h,f2h,f3h,13h,57h,b1h,6ah
+			db	8eh,0bh,89h,b7h,e1h,35h,ceh,b3h
+			db	86h,ffh,5ch,72h,b0h,cfh,afh,8eh
+			db	a0h,68h,14h,53h,d3h,1ch,56h,eeh
+			db	f6h,3dh,75h,5fh,9ch,f1h,26h,d6h
+			db	bfh,0ah,0fh,9fh,02h,a7h,b9h,c4h
+			db	f9h,05h,f3h,f9h,bdh,01h,a6h,05h
+			db	45h,8ah,28h,dah,dfh,0dh,c1h,c5h
+			db	d1h,5eh,89h,d1h,b8h,75h,d8h,f8h
+			db	9eh,60h,11h,1dh,8fh,e6h,c1h,afh
+			db	6fh,20h,88h,35h,a0h,a0h,68h,edh
+			db	cfh,d5h,97h,20h,3ch,58h,32h,fah
+			db	c7h,23h,55h,89h,b8h,07h,9dh,9bh
+			db	c2h,09h,7bh,63h,e1h,27h,8ch,87h
+			db	64h,01h,34h,3bh,7eh,b0h,58h,d3h
+			db	bfh,c0h,a5h,0bh,1ah,28h,f9h,0dh
+			db	5fh,82h,37h,b6h,9ch,06h,69h,78h
+			db	cbh,23h,f5h,8eh,0dh,c5h,96h,03h
+			db	f9h,22h,ech,3ah,fbh,b8h,6dh,9ah
+			db	bah,7fh,32h,f6h,a6h,8ch,3fh,7eh
+			db	a6h,49h,5dh,a7h,c0h,b4h,c1h,b9h
+			db	03h,9ah,38h,81h,20h,83h,8ah,60h
+			db	4bh,f0h,ebh,60h,f7h,5bh,10h,19h
+			db	86h,a9h,67h,7eh,cah,31h,f4h,63h
+			db	eah,d9h,7ah,5ch,41h,3bh,11h,c2h
+			db	aeh,98h,49h,a9h,4bh,87h,71h,ddh
+			db	8ah,a8h,18h,5ch,3dh,b1h,fah,5ch
+			db	adh,f9h,82h,80h,22h,35h,8bh,00h
+			db	bdh,3ch,c7h,e1h,62h,a3h,c3h,bfh
+			db	80h,3bh,f0h,9fh,71h,04h,68h,15h
+			db	24h,3ah,aah,74h,59h,27h,76h,66h
+			db	2ch,0eh,43h,14h,ceh,61h,c3h,52h
+			db	64h,6ah,27h,30h,68h,a8h,4ch,b2h
+			db	efh,42h,3ah,3ah,afh,fdh,60h,5ch
+			db	a9h,83h,bfh,d0h,0eh,9fh,bbh,9dh
+			db	73h,15h,66h,2eh,42h,8fh,8ch,3ah
+			db	28h,dbh,f3h,38h,30h,90h,a9h,ech
+			db	15h,bbh,1bh,f4h,70h,d1h,eeh,2eh
+			db	11h,72h,a8h,fbh,86h,5fh,0bh,bch
+			db	5bh,a7h,deh,fdh,70h,44h,ffh,71h
+			db	a7h,67h,54h,c4h,dch,58h,b7h,73h
+			db	c0h,f4h,f4h,61h,38h,74h,beh,18h
+			db	90h,0bh,08h,b6h,b8h,abh,a9h,32h
+			db	28h,84h,e3h,9eh,e7h,70h,e0h,58h
+			db	3dh,10h,b1h,34h,8dh,68h,e1h,bch
+			db	23h,41h,28h,a5h,f5h,2dh,adh,47h
+			db	ddh,3bh,30h,18h,b4h,27h,5eh,86h
+			db	ffh,b3h,52h,00h,bbh,90h,40h,5eh
+			db	c4h,9eh,52h,12h,07h,85h,18h,1eh
+			db	afh,b2h,00h,cbh,3bh,2ah,6fh,a9h
+			db	bbh,04h,78h,efh,78h,84h,dbh,e5h
+			db	39h,44h,6ch,41h,e6h,12h,ebh,b7h
+			db	3fh,8ah,8eh,41h,f6h,c4h,05h,f1h
+			db	a1h,86h,40h,98h,fah,f7h,5eh,1ah
+			db	7ah,a1h,dch,c2h,60h,75h,dbh,74h
+			db	f7h,c8h,0bh,1bh,61h,edh,bfh,b8h
+			db	13h,d2h,91h,e2h,e0h,b6h,45h,00h
+			db	f3h,11h,64h,3bh,fch,e7h,1ah,87h
+			db	b7h,81h,f1h,62h,b4h,b0h,3eh,86h
+			db	08h,5ch,15h,f5h,92h,ffh,7eh,92h
+			db	a8h,59h,d0h,72h,50h,8bh,1eh,1ah
+			db	58h,e2h,59h,a8h,30h,23h,e1h,0dh
+			db	70h,fdh,7bh,51h,68h,88h,dch,59h
+			db	8ah,76h,dah,d4h,3ch,cch,fah,e3h
+			db	5ch,e1h,deh,49h,d3h,1bh,5bh,0dh
+			db	5eh,a6h,8ch,99h,bbh,a2h,a9h,61h
+			db	fch,03h,b0h,60h,89h,24h,d0h,b8h
+			db	edh,89h,32h,1dh,13h,86h,cbh,2eh
+			db	41h,6fh,a1h,13h,7dh,d0h,92h,7eh
+			db	7ch,7ah,35h,c0h,d3h,d8h,05h,90h
+			db	78h,48h,fah,fbh,d5h,1bh,b2h,45h
+			db	90h,cah,e5h,d9h,aah,86h,42h,0dh
+			db	14h,96h,afh,bch,b6h,d7h,e9h,13h
+			db	5ah,69h,41h,05h,d3h,2ah,ffh,94h
+			db	afh,75h,74h,17h,0ah,32h,aeh,00h
+			db	ffh,99h,4bh,39h,08h,15h,41h,32h
+			db	e3h,64h,2bh,14h,b0h,37h,d2h,0fh
+			db	86h,9bh,67h,b3h,e5h,47h,35h,e2h
+			db	8ch,ach,c6h,cbh,17h,95h,0ch,f3h
+			db	39h,e9h,64h,34h,f1h,f3h,fah,6eh
+			db	86h,4fh,a9h,41h,dfh,38h,42h,40h
+			db	67h,deh,7fh,e2h,71h,0fh,abh,f9h
+			db	deh,b3h,43h,1ah,1ch,c2h,90h,b6h
+			db	99h,08h,7bh,50h,edh,6ah,d9h,c5h
+			db	34h,78h,4dh,a6h,7eh,2ch,a3h,d6h
+			db	40h,44h,5bh,cch,e1h,60h,a7h,7fh
+			db	52h,6ah,64h,56h,71h,0eh,05h,09h
+			db	89h,c6h,4fh,4eh,45h,e9h,bch,66h
+			db	e9h,41h,e7h,afh,33h,beh,3ah,25h
+			db	13h,a6h,b6h,06h,60h,aah,43h,47h
+			db	e6h,90h,cbh,4fh,cah,9dh,36h,58h
+			db	0dh,72h,bfh,62h,75h,78h,84h,a3h
+			db	abh,aeh,60h,e8h,85h,6eh,e4h,ceh
+			db	b9h,88h,fbh,b4h,55h,85h,a4h,ddh
+			db	bah,49h,c3h,6bh,6bh,41h,f7h,9eh
+			db	2dh,a5h,bch,0fh,1ah,13h,3eh,39h
+			db	3eh,9ah,46h,7fh,67h,73h,13h,14h
+			db	74h,89h,e5h,76h,e1h,31h,16h,e4h
+			db	e3h,9dh,17h,deh,fah,adh,3dh,ddh
+			db	36h,d2h,e4h,4fh,04h,7ah,7ah,d8h
+			db	4fh,4ch,d5h,50h,07h,8fh,b1h,76h
+			db	eah,1ch,a5h,05h,4ch,77h,39h,d6h
+			db	66h,8eh,09h,40h,e1h,f6h,2ch,e3h
+			db	68h,96h,01h,ebh,95h,03h,78h,83h
+			db	d3h,4bh,a8h,72h,22h,a7h,a3h,cfh
+			db	5fh,a9h,3fh,f6h,1fh,bdh,29h,59h
+			db	5bh,43h,75h,a7h,b1h,8fh,5ch,3ch
+			db	a3h,d3h,9dh,ceh,30h,64h,56h,4bh
+			db	eeh,4dh,cfh,5bh,a0h,7ch,59h,9bh
+			db	60h,6ah,88h,2eh,dch,9dh,cch,97h
+			db	5dh,5ah,46h,58h,d7h,cch,eeh,41h
+			db	deh,17h,3fh,b5h,65h,a6h,a0h,52h
+			db	22h,f0h,98h,73h,a2h,d6h,08h,70h
+			db	feh,3eh,c9h,c4h,32h,58h,b4h,e0h
+			db	60h,19h,78h,67h,f1h,9bh,17h,beh
+			db	f2h,aeh,bch,67h,5ah,85h,17h,37h
+			db	7eh,9ch,b8h,30h,a9h,c9h,65h,32h
+			db	e9h,ech,1ch,aah,6bh,86h,3dh,98h
+			db	5eh,8dh,89h,d8h,57h,cbh,04h,42h
+			db	73h,fdh,91h,beh,8bh,85h,abh,0ah
+			db	bah,b0h,79h,f2h,42h,cdh,2bh,f6h
+			db	b1h,41h,4dh,bdh,49h,5dh,7ch,fbh
+			db	0ah,d0h,3bh,95h,86h,b4h,fbh,5bh
+			db	03h,11h,7ch,58h,5fh,19h,0eh,4bh
+			db	6eh,f1h,7bh,feh,aeh,6ah,53h,bah
+			db	5ah,56h,44h,99h,91h,f1h,b7h,6ch
+			db	dfh,5ch,f6h,83h,b4h,9fh,20h,42h
+			db	92h,f0h,38h,fch,72h,deh,c7h,dbh
+			db	34h,d5h,2ch,6dh,4ah,b3h,30h,40h
+			db	abh,cah,4ah,29h,4eh,c6h,0ah,97h
+			db	9eh,24h,b4h,37h,a4h,fah,b0h,d2h
+			db	11h,5eh,35h,9ah,04h,deh,21h,73h
+			db	feh,0dh,a4h,1eh,93h,e6h,23h,73h
+			db	85h,6eh,b0h,37h,1eh,57h,dbh,3ch
+			db	f7h,b8h,98h,f5h,8fh,d7h,53h,61h
+			db	5eh,19h,cch,7ch,47h,8ah,a1h,3fh
+			db	83h,a8h,64h,cch,ddh,38h,50h,53h
+			db	34h,93h,7ch,e9h,d5h,80h,f4h,67h
+			db	e3h,43h,e1h,52h,c7h,53h,48h,31h
+			db	9ah,2dh,eeh,33h,13h,e9h,30h,fah
+			db	3ah,49h,e1h,56h,97h,33h,3ch,15h
+			db	aeh,c9h,9dh,32h,64h,bbh,84h,92h
+			db	a9h,71h,ceh,77h,dch,a3h,29h,2ah
+			db	2bh,54h,46h,b3h,15h,14h,93h,fch
+			db	19h,e3h,52h,70h,e2h,99h,3ch,96h
+			db	46h,36h,42h,7dh,b0h,32h,5fh,d9h
+			db	53h,e1h,1dh,e6h,26h,49h,d2h,69h
+			db	0dh,20h,56h,cah,69h,43h,f2h,30h
+			db	0dh,02h,3eh,47h,9ch,c3h,e1h,83h
+			db	adh,a4h,e8h,77h,71h,56h,7eh,70h
+			db	dfh,b6h,99h,02h,7ch,d1h,fbh,51h
+			db	7bh,c5h,c2h,95h,8ah,b1h,e0h,75h
+			db	a3h,f4h,e5h,03h,94h,cfh,efh,3bh
+			db	e5h,eah,dch,a3h,88h,dch,3bh,59h
+			db	aah,03h,6bh,07h,11h,f6h,efh,02h
+			db	2bh,b0h,11h,ddh,f2h,92h,03h,07h
+			db	f5h,f4h,86h,dah,92h,18h,05h,86h
+			db	aah,d6h,fdh,bch,33h,5fh,9ah,c1h
+			db	c9h,48h,e6h,21h,70h,4fh,f9h,2bh
+			db	ach,96h,0fh,9fh,64h,4ch,0ah,16h
+			db	14h,00h,a9h,60h,46h,ceh,20h,c7h
+			db	40h,a9h,35h,beh,5ah,9dh,70h,c2h
+			db	54h,e3h,52h,ebh,98h,cdh,a8h,39h
+			db	19h,ddh,ebh,2fh,0ah,59h,2fh,36h
+			db	0dh,77h,e6h,d2h,8fh,2dh,4dh,a4h
+			db	33h,d5h,c4h,79h,3dh,08h,c7h,8ah
+			db	22h,edh,ech,12h,b9h,92h,dch,9dh
+			db	9ch,73h,3eh,66h,78h,43h,30h,24h
+			db	0ah,87h,7dh,d5h,88h,c3h,3dh,61h
+			db	96h,57h,0bh,4fh,27h,5bh,dch,68h
+			db	99h,10h,d9h,20h,38h,4bh,22h,68h
+			db	1eh,85h,9eh,14h,1ah,27h,beh,65h
+			db	18h,67h,6ah,e6h,d3h,cfh,dbh,2fh
+			db	57h,edh,d4h,e9h,d9h,51h,9ch,83h
+			db	0bh,cbh,70h,f3h,44h,cah,6eh,7ch
+			db	dbh,c5h,04h,89h,0eh,a7h,05h,63h
+			db	8fh,22h,e1h,9bh,7eh,a6h,9eh,1fh
+			db	a1h,b8h,2eh,2ah,03h,8ah,c4h,22h
+			db	71h,33h,4ch,48h,22h,87h,dbh,15h
+			db	52h,36h,cbh,89h,feh,61h,f2h,58h
+			db	b8h,f2h,b9h,7eh,dah,8ch,2dh,ebh
+			db	2dh,d9h,6ah,55h,a6h,ffh,47h,c6h
+			db	5ah,40h,deh,82h,87h,39h,62h,94h
+			db	78h,7dh,6dh,94h,9ch,f7h,7ah,ffh
+			db	14h,6dh,62h,44h,e9h,e6h,64h,f1h
+			db	42h,71h,f7h,d1h,4ch,7eh,32h,9ch
+			db	bch,afh,46h,a6h,c9h,45h,39h,d3h
+			db	43h,81h,fbh,eah,b2h,65h,5fh,9ah
+			db	37h,4dh,cch,b0h,39h,68h,21h,fah
+			db	eah,edh,91h,e7h,55h,0ah,e6h,c2h
+			db	a8h,c1h,40h,eah,c9h,ddh,90h,b8h
+			db	e8h,dfh,19h,e4h,5ah,3dh,2dh,7fh
+			db	5bh,58h,25h,cdh,cbh,22h,69h,b5h
+			db	82h,2bh,f9h,7bh,25h,08h,6ah,92h
+			db	b1h,feh,98h,b1h,a6h,bch,05h,a8h
+			db	81h,41h,67h,56h,90h,d4h,2dh,7eh
+			db	7ah,9ah,5fh,d4h,eah,88h,b4h,feh
+			db	85h,61h,f8h,1fh,20h,9dh,48h,f0h
+			db	8dh,7ch,0fh,46h,6bh,42h,a9h,75h
+			db	5ah,c1h,91h,35h,84h,2ah,b9h,17h
+			db	c3h,a6h,2dh,f6h,aeh,aah,7fh,e3h
+			db	05h,b6h,15h,cfh,4ah,11h,e0h,49h
+			db	efh,ceh,0bh,f6h,7fh,0eh,d7h,bfh
+			db	dch,c0h,92h,a4h,43h,63h,90h,a2h
+			db	78h,d4h,47h,1fh,19h,e1h,95h,60h
+			db	d3h,f2h,1eh,8fh,28h,a1h,5bh,2eh
+			db	52h,1bh,7dh,71h,76h,61h,14h,6bh
+			db	62h,50h,79h,40h,53h,65h,51h,69h
+			db	22h,beh,34h,05h,78h,5ch,4ch,47h
+			db	06h,74h,6bh,61h,ech,eah,e0h,65h
+			db	abh,39h,32h,1bh,46h,56h,99h,0bh
+			db	b4h,84h,8ch,5dh,27h,89h,97h,27h
+			db	c1h,cbh,1fh,73h,1ch,34h,ach,b5h
+			db	0bh,4eh,51h,a5h,a6h,8bh,08h,77h
+			db	e8h,bdh,9ah,fbh,3ah,41h,69h,5eh
+			db	24h,08h,f7h,a5h,45h,bdh,afh,aeh
+			db	15h,78h,5dh,8ah,06h,84h,22h,c9h
+			db	14h,c3h,d9h,b7h,c9h,26h,b3h,d2h
+			db	2fh,f3h,46h,b9h,17h,f0h,e3h,1dh
+			db	0ah,c8h,0ah,63h,90h,45h,75h,dah
+			db	deh,ach,6dh,fch,d6h,4eh,a0h,8ch
+			db	aah,1ah,d8h,c9h,a0h,dbh,4ch,edh
+			db	e4h,01h,58h,3fh,81h,6dh,f5h,dah
+			db	07h,22h,08h,93h,e3h,e2h,eah,24h
+			db	f1h,43h,98h,58h,73h,e5h,aah,3bh
+			db	ach,7eh,8fh,11h,e3h,a2h,dah,5ch
+			db	c1h,57h,60h,a9h,5ch,2ah,13h,03h
+			db	fbh,bfh,0eh,92h,bdh,72h,84h,8eh
+			db	f9h,ceh,8eh,3ah,b9h,bdh,c0h,8bh
+			db	0eh,69h,02h,61h,41h,3dh,e7h,11h
+			db	a5h,3eh,33h,00h,76h,e4h,56h,08h
+			db	f3h,e9h,23h,07h,5ah,74h,d1h,03h
+			db	58h,f9h,43h,85h,cfh,9ah,afh,f3h
+			db	70h,a2h,40h,03h,87h,29h,b3h,18h
+			db	25h,cch,35h,54h,72h,92h,44h,26h
+			db	92h,6eh,1fh,0dh,efh,66h,f3h,d1h
+			db	a4h,2ah,21h,1ah,39h,04h,0fh,6eh
+			db	14h,01h,46h,72h,25h,51h,d4h,16h
+			db	eah,99h,8dh,f3h,a8h,a8h,f0h,3bh
+			db	1ch,20h,46h,f3h,89h,8fh,c1h,deh
+			db	90h,afh,41h,65h,bbh,49h,b6h,49h
+			db	ddh,13h,28h,a3h,64h,34h,58h,6eh
+			db	c1h,48h,a7h,7bh,9bh,6dh,1ch,9fh
+			db	4fh,d2h,d6h,feh,85h,b2h,c5h,94h
+			db	c5h,2eh,a7h,1ah,59h,04h,b2h,3dh
+			db	aeh,21h,74h,cdh,8dh,07h,92h,50h
+			db	a9h,edh,c8h,3fh,eeh,4dh,d9h,0dh
+			db	4fh,7ah,c7h,1ah,87h,a5h,aah,68h
+			db	46h,0dh,60h,dfh,29h,79h,66h,35h
+			db	c3h,a8h,8bh,58h,50h,cdh,2fh,17h
+			db	24h,97h,efh,07h,b7h,c3h,dbh,f5h
+			db	e7h,24h,48h,2ch,b6h,00h,12h,bfh
+			db	88h,6eh,85h,13h,01h,57h,f3h,beh
+			db	18h,a7h,6bh,82h,d8h,f9h,c1h,9ah
+			db	17h,d1h,1dh,8ch,2ah,a2h,04h,74h
+			db	d4h,a2h,6fh,51h,a2h,92h,4fh,ach
+			db	92h,91h,4ch,f0h,85h,7fh,49h,2fh
+			db	97h,2ah,83h,90h,91h,7eh,50h,a0h
+			db	97h,a0h,c5h,a0h,b2h,58h,42h,08h
+			db	ach,ffh,68h,64h,2bh,90h,79h,52h
+			db	e9h,eeh,adh,54h,edh,04h,c0h,8eh
+			db	25h,c5h,aah,f7h,62h,6ch,e0h,feh
+			db	00h,ffh,66h,05h,cah,ach,4bh,55h
+			db	6ch,68h,c6h,0ch,c9h,6eh,fch,f9h
+			db	79h,cfh,e5h,26h,25h,a0h,e4h,b6h
+			db	01h,72h,53h,3ch,adh,0ah,9eh,99h
+			db	35h,67h,81h,46h,15h,2eh,85h,4dh
+			db	91h,ech,b4h,adh,6eh,2eh,d4h,cbh
+			db	fbh,49h,f4h,40h,84h,bbh,f2h,d4h
+			db	90h,50h,abh,38h,4bh,47h,05h,aeh
+			db	cbh,efh,00h,7ch,a2h,96h,a2h,bah
+			db	d9h,53h,cfh,14h,a3h,5bh,edh,91h
+			db	88h,2bh,ebh,75h,f1h,2ah,3ch,efh
+			db	bfh,7ah,38h,5fh,2ch,cbh,dah,6ch
+			db	5bh,52h,c9h,74h,4fh,38h,e3h,cch
+			db	dfh,c3h,04h,c4h,12h,66h,71h,41h
+			db	deh,b6h,33h,4dh,25h,5bh,8dh,d1h
+			db	15h,8eh,fah,d1h,a6h,7fh,edh,78h
+			db	63h,e9h,bch,f9h,fch,2ch,a1h,7ah
+			db	b4h,40h,bdh,c4h,c7h,d1h,b8h,a9h
+			db	deh,3bh,2dh,8ah,77h,06h,e1h,0ch
+			db	bfh,81h,b4h,b0h,ebh,88h,65h,eeh
+			db	11h,e6h,1fh,2bh,eah,7bh,7ch,dch
+			db	57h,70h,19h,a1h,4ah,c2h,fdh,24h
+			db	a8h,ddh,c9h,fch,76h,bfh,59h,c1h
+			db	1ch,4dh,64h,0bh,90h,84h,10h,28h
+			db	fch,30h,08h,11h,70h,35h,42h,04h
+			db	0ch,f7h,0ah,6ch,3bh,11h,a1h,a0h
+			db	c0h,04h,0ch,6dh,17h,9eh,3fh,4dh
+			db	0ah,22h,fbh,adh,96h,e9h,6dh,55h
+			db	deh,07h,63h,c3h,16h,29h,cah,38h
+			db	40h,a5h,6dh,07h,c1h,fah,afh,45h
+			db	a0h,3fh,11h,3dh,6bh,91h,b0h,81h
+			db	4dh,67h,deh,e4h,b0h,e5h,f0h,b3h
+			db	10h,c2h,0dh,1ch,43h,41h,0ah,83h
+			db	39h,88h,a8h,e1h,72h,c3h,b9h,06h
+			db	ceh,9bh,23h,94h,f9h,76h,45h,c0h
+			db	55h,eah,cdh,eeh,d3h,03h,8bh,59h
+			db	41h,b2h,a1h,dah,31h,86h,6bh,1eh
+			db	7fh,32h,64h,dch,c7h,ffh,77h,30h
+			db	ffh,feh,d7h,61h,ddh,0fh,74h,6bh
+			db	adh,94h,04h,69h,5fh,d0h,b3h,f0h
+			db	e2h,0ah,a7h,03h,3ch,2bh,21h,17h
+			db	7ah,64h,45h,44h,11h,b1h,f8h,dbh
+			db	51h,8bh,38h,09h,ebh,94h,6ah,86h
+			db	f9h,4ch,b4h,e3h,7ah,35h,62h,4ah
+			db	0eh,2dh,49h,0fh,37h,8fh,c1h,30h
+			db	a3h,63h,49h,e0h,70h,6fh,34h,ebh
+			db	55h,15h,3dh,43h,66h,33h,d7h,79h
+			db	e0h,6dh,88h,3ah,08h,88h,05h,67h
+			db	05h,51h,a1h,a6h,d0h,7bh,2ch,24h
+			db	1eh,b5h,f0h,33h,e9h,d2h,8eh,35h
+			db	edh,4dh,0dh,bbh,3fh,82h,6eh,89h
+			db	26h,01h,e6h,ech,34h,8fh,cdh,67h
+			db	a0h,c1h,f6h,3dh,d4h,84h,cbh,ech
+			db	95h,6fh,29h,01h,65h,62h,efh,c6h
+			db	4eh,67h,7fh,6ch,29h,85h,f9h,7fh
+			db	d4h,b1h,74h,2fh,eeh,dah,45h,8bh
+			db	65h,b7h,dbh,bfh,b8h,42h,7ch,b9h
+			db	4ch,a4h,15h,c3h,d9h,dbh,39h,f4h
+			db	18h,74h,41h,35h,44h,7ch,ceh,92h
+			db	0ah,16h,44h,dfh,49h,f8h,99h,0ah
+			db	1bh,75h,2bh,00h,76h,ddh,3ch,4bh
+			db	aah,05h,5ch,55h,ebh,9ch,50h,1bh
+			db	d8h,2eh,51h,85h,bah,4dh,07h,c7h
+			db	46h,b2h,4ah,c6h,ffh,1bh,77h,0bh
+			db	19h,8dh,50h,4ch,cfh,f0h,deh,f4h
+			db	1eh,39h,c6h,22h,8eh,34h,5bh,0eh
+			db	1ch,1eh,4fh,39h,38h,93h,28h,1eh
+			db	bdh,ceh,d9h,98h,5dh,c2h,e4h,a8h
+			db	28h,4eh,19h,19h,48h,2ah,90h,30h
+			db	cbh,51h,2fh,b2h,26h,77h,adh,7dh
+			db	89h,84h,9eh,0eh,a0h,e7h,f5h,16h
+			db	e6h,64h,58h,cch,c5h,12h,f5h,67h
+			db	a5h,44h,30h,87h,8ah,80h,5ah,a5h
+			db	8fh,6bh,f9h,c4h,0ch,ebh,bah,4ch
+			db	fdh,e0h,51h,6bh,b3h,feh,b6h,58h
+			db	7dh,d6h,6dh,b7h,20h,1ch,b5h,feh
+			db	eeh,8fh,b8h,5ah,37h,7ah,cah,4fh
+			db	feh,50h,f4h,fah,e4h,59h,03h,abh
+			db	a5h,3eh,fch,fdh,85h,68h,7eh,1ah
+			db	dch,e2h,bbh,c7h,2eh,e7h,fch,8bh
+			db	28h,ebh,31h,36h,bbh,7bh,d0h,5ch
+			db	f3h,e0h,19h,50h,74h,72h,48h,87h
+			db	61h,a7h,97h,d2h,85h,49h,30h,58h
+			db	42h,deh,7bh,b4h,23h,dch,08h,1ch
+			db	31h,00h,09h,bfh,81h,d3h,72h,03h
+			db	ffh,2eh,6dh,c0h,c7h,edh,c3h,20h
+			db	9ah,04h,29h,14h,a3h,e2h,ech,9ah
+			db	89h,03h,eah,f8h,bah,beh,c6h,75h
+			db	f5h,dah,b7h,2dh,cch,02h,2ah,4bh
+			db	68h,f6h,71h,20h,77h,fch,8dh,6ah
+			db	abh,a1h,f5h,e7h,c7h,95h,93h,25h
+			db	8ah,76h,aah,cdh,32h,20h,4bh,03h
+			db	71h,8eh,b5h,43h,dah,c1h,d2h,88h
+			db	ach,20h,d6h,95h,1fh,74h,8bh,a1h
+			db	afh,dch,a0h,a8h,2bh,f5h,d9h,bch
+			db	46h,ech,fah,97h,14h,b0h,a1h,48h
+			db	27h,7fh,44h,c1h,2bh,d3h,b1h,7ah
+			db	7dh,3ah,a8h,e4h,c5h,b3h,92h,dah
+			db	d9h,17h,dch,d0h,20h,02h,8bh,61h
+			db	cfh,c9h,8ah,abh,41h,32h,aah,eeh
+			db	5eh,82h,7fh,93h,29h,44h,0ah,ech
+			db	49h,18h,0ch,14h,d5h,7fh,17h,58h
+			db	91h,1fh,c5h,d5h,feh,e6h,edh,1bh
+			db	8ah,41h,6dh,fbh,35h,87h,a2h,c6h
+			db	68h,a9h,cdh,0ah,edh,5ch,fbh,13h
+			db	c0h,09h,edh,4dh,90h,eah,8ch,a3h
+			db	4eh,66h,ach,d6h,c0h,12h,98h,feh
+			db	20h,5ch,90h,bfh,e6h,c9h,38h,20h
+			db	95h,b8h,93h,18h,73h,41h,fch,ffh
+			db	c7h,edh,7ch,00h,dch,4ah,01h,8eh
+			db	19h,9dh,60h,90h,69h,1ah,f8h,f5h
+			db	f7h,0dh,b7h,f6h,fbh,c1h,a7h,50h
+			db	87h,c8h,83h,7fh,e1h,f8h,98h,81h
+			db	f4h,6ah,16h,2dh,0dh,91h,53h,00h
+			db	24h,32h,22h,c0h,56h,d5h,10h,06h
+			db	4ch,c0h,6ch,56h,cbh,cbh,dch,b2h
+			db	00h,8bh,f9h,fdh,30h,aah,45h,86h
+			db	00h,6eh,30h,dah,dch,eeh,28h,69h
+			db	5ch,f9h,e7h,99h,74h,0dh,24h,bbh
+			db	51h,f5h,3ch,28h,a5h,fbh,ddh,5fh
+			db	c8h,05h,a0h,21h,06h,ech,f1h,d5h
+			db	77h,dch,22h,3dh,d8h,c0h,13h,c6h
+			db	64h,e3h,60h,15h,69h,27h,16h,72h
+			db	68h,7fh,91h,96h,00h,02h,8ah,96h
+			db	d7h,22h,e5h,5fh,d8h,96h,47h,b3h
+			db	56h,c1h,41h,32h,46h,18h,5fh,93h
+			db	2ah,9dh,46h,a0h,53h,69h,e3h,89h
+			db	7dh,fah,55h,1ah,d8h,f0h,ach,a7h
+			db	e7h,ech,96h,93h,05h,e8h,2fh,3eh
+			db	91h,f0h,9eh,f5h,7eh,b5h,82h,3ch
+			db	68h,55h,2dh,36h,e0h,73h,ddh,19h
+			db	4ah,35h,3dh,97h,69h,73h,71h,a3h
+			db	edh,ech,35h,3dh,ach,77h,3fh,99h
+			db	27h,fbh,2ch,8ah,4bh,b4h,38h,d8h
+			db	bah,41h,5ch,e6h,08h,aeh,f1h,33h
+			db	84h,bch,a5h,c6h,efh,d1h,5dh,00h
+			db	e4h,abh,5fh,d3h,85h,c8h,1bh,0eh
+			db	e4h,a1h,60h,93h,84h,97h,f0h,97h
+			db	d4h,45h,b3h,ach,21h,79h,73h,8dh
+			db	94h,36h,79h,48h,3ah,b5h,67h,57h
+			db	17h,aeh,9ch,ffh,f4h,f5h,edh,30h
+			db	f9h,15h,34h,53h,e3h,a0h,93h,50h
+			db	95h,05h,28h,56h,5dh,19h,cdh,1dh
+			db	f9h,67h,b1h,1fh,55h,aah,4bh,2eh
+			db	99h,a0h,61h,1dh,89h,eeh,39h,58h
+			db	a4h,60h,09h,01h,5bh,11h,b9h,e7h
+			db	58h,98h,bfh,e1h,57h,13h,5fh,cbh
+			db	03h,67h,7ch,06h,18h,4fh,aeh,d6h
+			db	0ah,dbh,2eh,ffh,c1h,5eh,4fh,cah
+			db	dch,0ah,d2h,29h,e1h,f0h,dch,11h
+			db	fah,bdh,27h,90h,a1h,2dh,32h,abh
+			db	f6h,bch,f6h,beh,02h,5bh,d9h,22h
+			db	4dh,2bh,adh,0ch,32h,0ah,d4h,f5h
+			db	d5h,feh,a7h,74h,43h,82h,32h,afh
+			db	d7h,e1h,2fh,e0h,73h,52h,1bh,d2h
+			db	2fh,0ah,cfh,29h,c4h,b0h,a4h,75h
+			db	10h,5ah,07h,3ch,bah,3fh,3dh,3dh
+			db	4bh,d5h,47h,4eh,99h,f3h,28h,f0h
+			db	7eh,fch,3bh,81h,d2h,d8h,c4h,a4h
+			db	e9h,a4h,35h,2ch,ech,02h,6bh,b5h
+			db	18h,7fh,a2h,9ch,3bh,91h,67h,bdh
+			db	40h,26h,5eh,34h,7dh,24h,03h,2ah
+			db	d1h,2dh,33h,3fh,aeh,c6h,abh,69h
+			db	a6h,bah,b4h,8ah,86h,6eh,dch,e8h
+			db	02h,90h,67h,14h,a4h,c9h,64h,aah
+			db	dch,ffh,76h,cbh,d9h,3eh,59h,83h
+			db	dah,18h,f7h,2ch,15h,85h,bah,b1h
+			db	56h,9ch,e1h,21h,4ch,f0h,e0h,3ah
+			db	80h,1eh,3eh,7bh,88h,6bh,e3h,12h
+			db	edh,98h,25h,feh,dbh,87h,97h,25h
+			db	2fh,b5h,d8h,92h,15h,56h,18h,deh
+			db	04h,00h,59h,dbh,ddh,5ch,35h,73h
+			db	31h,06h,61h,67h,dah,aeh,2bh,d5h
+			db	3fh,66h,adh,e8h,dch,37h,37h,55h
+			db	0bh,bdh,d1h,ach,a5h,fch,02h,abh
+			db	54h,64h,5bh,a9h,66h,9fh,0eh,14h
+			db	88h,34h,a3h,38h,65h,78h,91h,91h
+			db	3eh,45h,6eh,e8h,66h,d2h,1ch,82h
+			db	adh,31h,dch,9dh,33h,33h,77h,70h
+			db	37h,a5h,f6h,b8h,16h,74h,a3h,3ch
+			db	f5h,dah,a6h,5bh,d3h,39h,aah,bdh
+			db	f3h,03h,64h,9bh,89h,52h,83h,f7h
+			db	32h,1ah,05h,d8h,40h,79h,e5h,07h
+			db	55h,15h,c6h,e1h,4dh,a2h,62h,88h
+			db	39h,d9h,d7h,11h,45h,b1h,2bh,dah
+			db	80h,d8h,42h,03h,73h,0bh,04h,c3h
+			db	19h,1fh,a3h,bah,9ah,11h,f2h,26h
+			db	20h,78h,a1h,02h,12h,95h,d6h,d1h
+			db	0eh,42h,fdh,a2h,9ch,dah,59h,11h
+			db	56h,9bh,6fh,d9h,4eh,e7h,12h,ech
+			db	40h,9eh,05h,34h,cch,0eh,2ch,f2h
+			db	53h,cdh,a7h,b6h,7bh,7fh,d3h,4ah
+			db	72h,2dh,cch,88h,09h,00h,77h,8fh
+			db	6eh,06h,14h,19h,78h,57h,ach,75h
+			db	d1h,67h,15h,fbh,02h,76h,a9h,ffh
+			db	feh,0fh,69h,bch,5eh,66h,3ch,6dh
+			db	0bh,feh,b7h,9ch,79h,10h,75h,38h
+			db	04h,a0h,6bh,afh,a7h,a4h,32h,42h
+			db	f2h,e0h,57h,ffh,06h,9ah,7ch,a1h
+			db	57h,45h,92h,69h,c3h,79h,b8h,adh
+			db	dah,d6h,10h,9fh,ceh,6fh,cah,03h
+			db	36h,2fh,4ah,7fh,2ch,c9h,b7h,bah
+			db	94h,7bh,08h,8eh,1fh,92h,c9h,4bh
+			db	15h,28h,80h,b1h,76h,49h,99h,4dh
+			db	b3h,d2h,8eh,03h,d6h,e4h,a5h,4eh
+			db	d4h,06h,1ch,75h,d9h,61h,3dh,6fh
+			db	14h,fbh,0bh,e1h,b9h,23h,53h,2bh
+			db	c5h,d6h,2bh,e1h,c4h,00h,19h,38h
+			db	59h,ddh,15h,55h,57h,87h,0fh,4fh
+			db	a9h,3bh,8ah,16h,82h,d0h,d1h,85h
+			db	4fh,42h,a6h,38h,95h,80h,b4h,e3h
+			db	31h,c7h,ceh,34h,51h,21h,cah,82h
+			db	58h,0ah,2ch,56h,d5h,fbh,e0h,74h
+			db	51h,64h,8fh,0fh,78h,9dh,30h,ddh
+			db	8dh,58h,4bh,2ah,37h,8fh,a2h,89h
+			db	dah,58h,55h,02h,75h,8ch,97h,0ah
+			db	d9h,f0h,6ch,eah,d7h,7fh,a4h,1eh
+			db	61h,c0h,edh,4ah,90h,4ch,cah,e1h
+			db	03h,7bh,e7h,06h,6eh,31h,66h,dfh
+			db	2ah,efh,fdh,c4h,bdh,ddh,d6h,58h
+			db	d9h,25h,78h,16h,40h,4ch,cdh,b6h
+			db	e1h,b9h,11h,5ch,4fh,d9h,a1h,1eh
+			db	07h,4ah,27h,74h,f9h,a3h,64h,f3h
+			db	52h,efh,29h,41h,55h,9bh,2bh,3bh
+			db	d4h,19h,e5h,61h,abh,d1h,6fh,1ch
+			db	6fh,aah,e6h,83h,97h,a3h,26h,0ch
+			db	c9h,b3h,43h,2bh,d5h,0ch,0fh,1bh
+			db	28h,6bh,f3h,07h,b1h,40h,6ch,f0h
+			db	b1h,05h,adh,31h,afh,28h,57h,53h
+			db	59h,4ah,d6h,4dh,92h,01h,6ch,a9h
+			db	31h,b8h,d2h,26h,6ah,1fh,cdh,a0h
+			db	0eh,36h,a6h,78h,beh,17h,9ch,53h
+			db	6ah,3ah,2fh,e2h,22h,91h,efh,adh
+			db	13h,bch,ebh,5ah,6eh,a3h,49h,1ch
+			db	fdh,0ch,30h,deh,62h,b2h,c7h,4ch
+			db	34h,1ah,1ch,59h,65h,f4h,c5h,92h
+			db	91h,f7h,bfh,25h,69h,9dh,e3h,39h
+			db	9ah,0dh,e3h,d1h,f0h,26h,61h,5bh
+			db	fah,a7h,cah,6fh,0ah,09h,eeh,25h
+			db	d0h,8ch,1bh,5ch,67h,dah,86h,47h
+			db	17h,2eh,10h,76h,7eh,9ch,2bh,59h
+			db	1eh,53h,46h,5dh,6ah,d6h,98h,f9h
+			db	21h,8fh,c0h,77h,5fh,a4h,90h,6ch
+			db	23h,43h,cdh,27h,48h,e1h,a6h,5dh
+			db	0bh,c3h,69h,1dh,74h,01h,bch,61h
+			db	1fh,1ch,61h,a4h,c3h,03h,a8h,84h
+			db	cdh,6ah,80h,b2h,2ah,97h,6dh,fch
+			db	eeh,59h,86h,1fh,63h,2eh,c2h,ebh
+			db	b1h,67h,c1h,88h,bdh,f1h,71h,c6h
+			db	6eh,94h,b9h,81h,c3h,2fh,15h,c3h
+			db	2bh,01h,d0h,a8h,a1h,68h,1eh,c3h
+			db	50h,81h,6ch,3eh,1ah,2bh,62h,c1h
+			db	2ch,c9h,09h,7fh,0bh,25h,bah,56h
+			db	37h,d9h,33h,0bh,42h,c5h,e3h,22h
+			db	52h,09h,4dh,7dh,3fh,aeh,32h,39h
+			db	bbh,1ch,28h,84h,bdh,27h,9eh,37h
+			db	7ah,9ch,25h,2ah,e9h,5dh,4ch,1eh
+			db	9fh,42h,81h,e1h,67h,abh,f2h,50h
+			db	1eh,cfh,a7h,a4h,cbh,01h,00h,b2h
+			db	6eh,71h,d2h,5ah,68h,5bh,47h,e6h
+			db	6eh,b8h,14h,0eh,2dh,1ah,ffh,72h
+			db	86h,87h,63h,2fh,34h,a0h,83h,2dh
+			db	efh,3dh,ffh,5dh,4ah,1dh,e0h,32h
+			db	58h,30h,e7h,b1h,9dh,efh,4bh,e2h
+			db	d7h,64h,f2h,30h,7ah,90h,d9h,d0h
+			db	f0h,87h,9eh,73h,0ch,0fh,7dh,b8h
+			db	ffh,15h,dch,0bh,7dh,8dh,54h,ceh
+			db	80h,66h,93h,1eh,69h,79h,44h,0ah
+			db	b9h,8fh,cbh,4ch,eeh,d9h,2eh,53h
+			db	06h,50h,57h,87h,82h,0dh,74h,99h
+			db	a2h,03h,b2h,bbh,ceh,7fh,60h,92h
+			db	b3h,8ah,d4h,70h,7ah,eah,56h,8ch
+			db	e3h,75h,31h,c0h,f2h,12h,67h,71h
+			db	b8h,3fh,5ah,96h,8fh,6ch,42h,8ch
+			db	4bh,3ch,7bh,63h,d0h,3fh,74h,eah
+			db	84h,b7h,2ah,dah,17h,44h,49h,c2h
+			db	19h,a4h,aeh,61h,49h,72h,02h,f7h
+			db	49h,a5h,61h,01h,93h,b2h,f6h,84h
+			db	90h,0eh,23h,a2h,c1h,fah,6eh,c3h
+			db	dfh,9bh,84h,ceh,c4h,fdh,aeh,4fh
+			db	35h,f4h,8ah,bbh,dch,34h,d9h,60h
+			db	cch,0bh,95h,85h,b2h,afh,26h,23h
+			db	57h,0bh,aeh,fdh,b0h,0dh,6fh,a2h
+			db	70h,4ah,cbh,71h,cah,b6h,3fh,e4h
+			db	1dh,87h,d2h,9ch,c2h,16h,fch,a8h
+			db	32h,3ah,8dh,17h,f1h,c0h,e5h,2dh
+			db	15h,3ch,3ch,8ch,37h,e9h,9fh,6fh
+			db	9ch,30h,6bh,85h,dah,aah,30h,1ch
+			db	1fh,b9h,d0h,ceh,a6h,6ah,ebh,d3h
+			db	59h,5bh,eeh,bdh,57h,f4h,5eh,66h
+			db	6dh,cdh,53h,57h,00h,4dh,b0h,9ch
+			db	6ch,a2h,3ch,61h,32h,f1h,20h,e1h
+			db	eah,a7h,3ch,e5h,e7h,fdh,51h,eah
+			db	1dh,d4h,cah,e4h,ebh,a5h,d6h,5eh
+			db	05h,f1h,20h,0eh,82h,8ch,d7h,beh
+			db	e7h,62h,8bh,a7h,b3h,0fh,84h,5ch
+			db	2dh,c3h,ffh,82h,40h,86h,adh,ebh
+			db	0ah,cch,81h,43h,32h,f8h,c1h,d4h
+			db	91h,0ah,b8h,e6h,82h,bah,39h,03h
+			db	4bh,2fh,81h,dbh,82h,aeh,a6h,43h
+			db	04h,83h,9bh,1eh,74h,f9h,58h,49h
+			db	70h,eeh,40h,33h,4ch,95h,a5h,0ah
+			db	69h,31h,38h,b5h,83h,4bh,6ah,13h
+			db	08h,98h,54h,ceh,e1h,3fh,53h,66h
+			db	05h,dbh,e0h,93h,b8h,fbh,8fh,17h
+			db	e7h,f7h,92h,7bh,ebh,d1h,83h,10h
+			db	95h,7eh,68h,f9h,a4h,cch,9eh,5bh
+			db	40h,8ch,62h,07h,71h,60h,08h,f4h
+			db	3ch,a6h,e7h,f8h,7ch,65h,5eh,e7h
+			db	e7h,2dh,49h,d5h,e9h,24h,09h,57h
+			db	9bh,7ah,49h,56h,f5h,7bh,16h,19h
+			db	dbh,57h,e6h,39h,b9h,c1h,f0h,c4h
+			db	47h,80h,c9h,fbh,39h,0ah,56h,7dh
+			db	44h,2dh,f3h,a6h,7ch,88h,d9h,8dh
+			db	9eh,e8h,1ah,cch,5eh,39h,59h,a6h
+			db	29h,7eh,c6h,6eh,a9h,a9h,01h,71h
+			db	58h,4dh,74h,d5h,5dh,f6h,03h,c8h
+			db	e1h,68h,b7h,01h,1bh,7bh,beh,bbh
+			db	0eh,dah,d4h,4ah,b1h,5dh,c5h,e6h
+			db	2ah,bdh,e1h,06h,5ch,e9h,95h,9ch
+			db	c1h,afh,c1h,6fh,9fh,f7h,f8h,a3h
+			db	f1h,31h,6dh,60h,bbh,aeh,87h,00h
+			db	c2h,a3h,75h,e1h,7fh,05h,55h,8ch
+			db	2fh,d7h,67h,1ch,99h,25h,c1h,62h
+			db	77h,deh,6fh,56h,1ah,42h,03h,08h
+			db	7bh,29h,bbh,7dh,1fh,f9h,63h,4ah
+			db	28h,51h,2ah,4dh,82h,e9h,31h,b1h
+			db	9dh,3ah,a0h,3dh,05h,59h,21h,74h
+			db	95h,eah,48h,e1h,33h,8bh,3bh,d1h
+			db	fdh,1fh,54h,91h,c5h,28h,09h,83h
+			db	22h,25h,26h,a2h,69h,e7h,07h,e3h
+			db	7ah,c3h,a6h,f0h,00h,c4h,03h,a7h
+			db	e4h,8bh,52h,74h,39h,c1h,82h,7ch
+			db	55h,0ah,c0h,dbh,54h,42h,d4h,c4h
+			db	bch,4dh,0dh,76h,03h,bdh,e9h,27h
+			db	b6h,cah,36h,88h,9fh,fch,55h,00h
+			db	5ah,91h,13h,2bh,53h,70h,32h,67h
+			db	81h,16h,21h,92h,76h,d3h,96h,deh
+			db	ech,6ah,12h,c0h,95h,01h,5fh,9ah
+			db	f5h,0bh,64h,26h,89h,70h,96h,d1h
+			db	56h,61h,08h,afh,5ah,e6h,e6h,42h
+			db	b6h,07h,b7h,67h,16h,6fh,65h,05h
+			db	32h,40h,43h,9ah,44h,80h,eah,bbh
+			db	cah,0ah,cdh,e6h,d7h,21h,cah,5ah
+			db	ebh,d5h,06h,1dh,6bh,6eh,f3h,f0h
+			db	4dh,cch,40h,1fh,eah,38h,28h,b4h
+			db	73h,f9h,c2h,fbh,0ch,60h,adh,b3h
+			db	d0h,cch,f4h,95h,f5h,90h,bfh,e9h
+			db	72h,48h,4fh,01h,28h,edh,fdh,e4h
+			db	55h,00h,ceh,3bh,8fh,29h,66h,4eh
+			db	b5h,d1h,cch,beh,4dh,6fh,82h,14h
+			db	29h,10h,7fh,e2h,e7h,5dh,e4h,0bh
+			db	b9h,1fh,19h,ddh,7bh,7dh,10h,41h
+			db	ddh,30h,b1h,20h,2bh,afh,8ch,20h
+			db	f9h,57h,c3h,92h,11h,c8h,4ah,87h
+			db	86h,5dh,16h,bfh,8dh,f9h,59h,15h
+			db	a8h,efh,42h,ddh,7dh,b4h,31h,1fh
+			db	9ch,24h,4fh,73h,4ah,0dh,d2h,29h
+			db	6dh,b6h,2ch,3bh,f4h,beh,dah,1ah
+			db	74h,f3h,b8h,87h,f5h,ech,6ah,3ch
+			db	9fh,dbh,c1h,5eh,2eh,6bh,98h,99h
+			db	43h,62h,2eh,48h,c7h,cbh,6ah,33h
+			db	01h,8fh,0ah,b3h,82h,80h,18h,b9h
+			db	6bh,abh,68h,eah,60h,90h,73h,24h
+			db	08h,9ch,84h,54h,a3h,2ah,41h,03h
+			db	71h,b4h,bah,71h,34h,f8h,16h,44h
+			db	60h,c1h,a3h,f3h,7bh,dbh,7eh,3fh
+			db	11h,94h,75h,0dh,b0h,1bh,3eh,bah
+			db	44h,89h,f8h,19h,3ch,dch,b7h,3ah
+			db	ceh,08h,6dh,6fh,e4h,7ah,70h,efh
+			db	59h,38h,76h,06h,e3h,3dh,d0h,68h
+			db	12h,16h,f3h,8dh,98h,f2h,ach,cdh
+			db	35h,dfh,3dh,b5h,56h,dah,54h,08h
+			db	19h,e2h,d5h,95h,3dh,35h,b1h,62h
+			db	3eh,39h,c7h,b4h,47h,3fh,d8h,fbh
+			db	02h,12h,fah,22h,6dh,c9h,48h,edh
+			db	99h,5ah,b6h,a4h,44h,67h,35h,6fh
+			db	35h,04h,81h,67h,39h,2dh,c0h,ach
+			db	6fh,26h,9ch,f0h,33h,71h,d9h,7ah
+			db	8eh,50h,06h,09h,a8h,0fh,8dh,ech
+			db	3dh,98h,01h,3ch,80h,41h,3bh,afh
+			db	bch,dch,86h,a3h,cah,88h,8fh,d3h
+			db	0ah,37h,2dh,25h,90h,a4h,46h,87h
+			db	9ah,13h,65h,eah,6eh,87h,ebh,13h
+			db	eeh,a3h,90h,f3h,a5h,71h,e4h,78h
+			db	2ch,8fh,44h,beh,7dh,59h,c7h,b7h
+			db	ceh,05h,28h,99h,e9h,ddh,9ch,aeh
+			db	a6h,b1h,14h,25h,32h,46h,deh,9fh
+			db	deh,5bh,0eh,cfh,beh,8eh,e5h,f2h
+			db	94h,e4h,2fh,54h,b2h,9fh,abh,bch
+			db	dfh,45h,08h,bbh,74h,a6h,dch,a6h
+			db	96h,c5h,5dh,7dh,fbh,0eh,9bh,0fh
+			db	a4h,42h,77h,ffh,07h,f7h,a3h,61h
+			db	f9h,b9h,99h,f8h,61h,01h,d1h,63h
+			db	52h,89h,e1h,cdh,18h,c5h,2ah,43h
+			db	8bh,ddh,4dh,31h,57h,58h,10h,43h
+			db	32h,d1h,8fh,29h,38h,10h,88h,73h
+			db	7bh,beh,f7h,06h,d7h,a9h,cbh,c7h
+			db	67h,1fh,b7h,a2h,08h,47h,63h,dah
+			db	55h,fah,8bh,65h,eeh,4eh,60h,aeh
+			db	6bh,93h,30h,6ch,b7h,ech,9eh,92h
+			db	56h,96h,59h,6ah,4dh,63h,aah,4dh
+			db	96h,0bh,4ch,7dh,92h,c6h,66h,15h
+			db	09h,ddh,c8h,0fh,d8h,83h,61h,bdh
+			db	7bh,c1h,bfh,8fh,a9h,94h,43h,0bh
+			db	5ah,c9h,bbh,29h,1ah,5bh,b4h,2eh
+			db	a7h,ceh,5eh,f5h,97h,59h,20h,32h
+			db	fch,69h,08h,04h,d1h,f1h,ebh,b0h
+			db	5ah,7bh,d7h,3fh,f1h,05h,64h,5ch
+			db	e3h,78h,dch,bdh,62h,52h,10h,e9h
+			db	d6h,87h,ach,64h,94h,9fh,9ch,89h
+			db	0bh,dah,cah,97h,e1h,edh,78h,e5h
+			db	2ah,13h,21h,b0h,6fh,2fh,49h,2eh
+			db	c6h,5bh,79h,6dh,d7h,0dh,18h,adh
+			db	6ah,bah,9ah,2bh,20h,7bh,80h,aeh
+			db	a4h,e8h,b2h,abh,bdh,ddh,a0h,87h
+			db	9bh,97h,e9h,68h,9dh,0bh,83h,7bh
+			db	25h,a1h,89h,6ch,b2h,e2h,79h,d2h
+			db	30h,a4h,88h,3fh,e2h,6dh,90h,8ch
+			db	6fh,09h,18h,c4h,62h,0dh,56h,fdh
+			db	a9h,19h,d1h,84h,d3h,c8h,b7h,54h
+			db	e9h,aah,55h,5eh,8ah,e2h,cah,05h
+			db	b8h,93h,d9h,8bh,72h,91h,ceh,43h
+			db	1eh,1fh,eeh,72h,8ch,1dh,cah,22h
+			db	c1h,79h,ffh,c4h,cdh,8dh,41h,e0h
+			db	cch,e7h,56h,53h,7bh,b2h,9eh,b5h
+			db	89h,d8h,21h,deh,1ah,57h,77h,0dh
+			db	a7h,a9h,53h,aeh,7fh,28h,88h,0fh
+			db	14h,04h,58h,65h,05h,a7h,0ch,c4h
+			db	d5h,59h,d8h,43h,2eh,1dh,ech,8ch
+			db	f8h,01h,c4h,4ah,e4h,40h,dch,0fh
+			db	e7h,a6h,78h,b1h,34h,43h,7bh,36h
+			db	e8h,fdh,53h,c2h,dah,84h,adh,49h
+			db	28h,29h,e2h,7dh,cdh,76h,eeh,20h
+			db	90h,abh,64h,19h,0dh,87h,cah,4bh
+			db	07h,56h,77h,4dh,54h,82h,63h,f0h
+			db	b9h,12h,87h,a4h,64h,5ch,ffh,1ch
+			db	63h,67h,c1h,d4h,92h,e1h,5ch,25h
+			db	9fh,67h,52h,fch,8ch,d6h,f8h,14h
+			db	b8h,ech,cch,11h,20h,deh,31h,88h
+			db	d5h,a1h,53h,dfh,1ch,2ch,00h,e0h
+			db	56h,69h,66h,4dh,c1h,31h,69h,37h
+			db	19h,0ch,5ch,cah,08h,49h,adh,8fh
+			db	abh,8eh,12h,f8h,d9h,e5h,39h,4fh
+			db	59h,f5h,6eh,b0h,24h,29h,26h,7ah
+			db	e9h,65h,69h,8fh,4fh,57h,6ch,beh
+			db	2dh,abh,cbh,dbh,1fh,7dh,1fh,6fh
+			db	f1h,5dh,1ch,ffh,f6h,76h,0eh,edh
+			db	65h,12h,88h,34h,a6h,1dh,edh,72h
+			db	20h,55h,efh,80h,50h,d2h,41h,8bh
+			db	e6h,ach,bah,ceh,83h,25h,0dh,3bh
+			db	c6h,6eh,5dh,b7h,e1h,b1h,65h,28h
+			db	a3h,82h,30h,d9h,77h,94h,1fh,3ch
+			db	03h,5ah,24h,83h,fch,dbh,2fh,51h
+			db	13h,d1h,2eh,43h,09h,69h,eeh,99h
+			db	e9h,22h,33h,0ah,86h,1eh,71h,beh
+			db	bfh,80h,f3h,67h,36h,fch,01h,59h
+			db	72h,d5h,d9h,fah,e4h,6bh,17h,b0h
+			db	e3h,82h,9ah,4fh,afh,eah,ffh,f6h
+			db	f6h,95h,54h,b3h,c4h,98h,8fh,2ah
+			db	18h,15h,0fh,11h,1ch,77h,5ch,3bh
+			db	c6h,6ah,77h,ech,58h,e9h,a2h,ebh
+			db	02h,feh,21h,70h,bah,d7h,90h,03h
+			db	9eh,2bh,2fh,d8h,5fh,94h,93h,68h
+			db	42h,d5h,04h,85h,e7h,51h,c1h,59h
+			db	e7h,0eh,f0h,bfh,dah,ach,13h,38h
+			db	f4h,d4h,53h,60h,3ch,01h,0eh,eeh
+			db	89h,beh,32h,eeh,82h,e6h,7dh,16h
+			db	c0h,7dh,39h,d6h,04h,d2h,b0h,3bh
+			db	22h,fdh,45h,73h,1ah,f8h,43h,fbh
+			db	ech,91h,19h,adh,2eh,17h,08h,b2h
+			db	7bh,9bh,d8h,6fh,43h,3ah,20h,b7h
+			db	5ch,01h,cdh,8ah,7ah,0dh,7fh,b0h
+			db	f9h,1dh,47h,b7h,fbh,9dh,21h,b9h
+			db	48h,9ah,e4h,60h,e2h,36h,2ch,ceh
+			db	0eh,f5h,1ah,24h,4ch,f2h,16h,89h
+			db	96h,02h,e2h,adh,35h,bah,66h,b4h
+			db	2ch,adh,31h,9fh,a1h,92h,30h,a3h
+			db	8ch,f6h,63h,84h,fch,66h,8dh,5dh
+			db	cdh,a8h,00h,7ch,f2h,eah,e6h,f6h
+			db	5dh,e7h,2eh,a7h,d1h,e5h,cdh,edh
+			db	0dh,88h,f5h,dch,94h,7ch,9eh,d5h
+			db	8fh,4ch,f1h,76h,7fh,bdh,d6h,bbh
+			db	3fh,5dh,13h,0dh,4bh,92h,6ch,cah
+			db	47h,3eh,4dh,06h,01h,51h,32h,f5h
+			db	78h,90h,44h,88h,c3h,26h,35h,75h
+			db	6fh,c5h,edh,bbh,c4h,96h,d4h,01h
+			db	6fh,86h,1bh,63h,5dh,64h,fdh,12h
+			db	71h,6ah,f2h,ffh,b6h,18h,9dh,e6h
+			db	bdh,6bh,bbh,bdh,3fh,43h,4eh,e4h
+			db	2ah,42h,45h,e7h,5ch,85h,44h,8eh
+			db	f5h,6bh,feh,9ch,edh,d4h,99h,6bh
+			db	6fh,b8h,11h,cch,ffh,7eh,dbh,24h
+			db	4dh,7fh,25h,03h,4fh,9bh,02h,b1h
+			db	67h,32h,33h,64h,adh,08h,2fh,cah
+			db	6dh,ddh,9eh,98h,f5h,d6h,d4h,30h
+			db	2ah,efh,0eh,31h,a6h,73h,9fh,a3h
+			db	eah,4bh,0bh,b9h,72h,edh,7eh,b0h
+			db	97h,f9h,c5h,c4h,73h,a6h,67h,31h
+			db	6ah,80h,26h,55h,61h,6ch,89h,1dh
+			db	13h,a3h,6eh,dch,93h,9dh,30h,2bh
+			db	78h,39h,5ah,23h,5ch,d0h,b4h,7dh
+			db	19h,88h,bdh,a2h,b7h,4ah,54h,5eh
+			db	a5h,15h,93h,d4h,b3h,deh,3ch,d0h
+			db	fbh,b4h,d3h,b1h,21h,54h,59h,11h
+			db	f9h,99h,6fh,96h,67h,77h,3ch,dah
+			db	6bh,5bh,0ch,7eh,c4h,6dh,a4h,28h
+			db	4eh,85h,b9h,bfh,f1h,edh,61h,afh
+			db	50h,71h,79h,bfh,96h,3eh,73h,e1h
+			db	55h,47h,b7h,f6h,2dh,12h,30h,94h
+			db	02h,e9h,17h,eeh,9ah,06h,c4h,95h
+			db	cch,0dh,0eh,55h,71h,68h,59h,92h
+			db	a3h,ech,54h,3ah,67h,eeh,16h,6bh
+			db	33h,70h,f4h,f5h,39h,27h,30h,15h
+			db	49h,1eh,58h,e2h,cah,9dh,91h,86h
+			db	55h,12h,66h,64h,96h,18h,b7h,ffh
+			db	23h,4bh,afh,c6h,47h,83h,cfh,82h
+			db	54h,bch,cbh,48h,c7h,39h,abh,feh
+			db	8fh,b0h,9eh,82h,4bh,97h,62h,51h
+			db	54h,95h,47h,39h,05h,82h,a1h,11h
+			db	9ah,53h,7eh,fbh,bdh,54h,33h,16h
+			db	c7h,a8h,8ah,0ch,60h,21h,ech,39h
+			db	fdh,d6h,d5h,86h,68h,d3h,64h,a4h
+			db	54h,a5h,deh,a0h,48h,d8h,64h,12h
+			db	54h,21h,1fh,24h,95h,ebh,cbh,e3h
+			db	c2h,e3h,d8h,e5h,fdh,b9h,12h,45h
+			db	7eh,3bh,5bh,05h,24h,a7h,d7h,ceh
+			db	f5h,90h,5eh,c3h,02h,28h,3dh,f3h
+			db	26h,64h,8bh,47h,92h,21h,6ch,7ch
+			db	fch,11h,cdh,abh,a7h,d5h,cfh,fah
+			db	bch,64h,cch,14h,cfh,17h,c5h,49h
+			db	50h,7ah,aah,4bh,6eh,57h,d2h,a6h
+			db	3ah,31h,a4h,e0h,b9h,d4h,74h,41h
+			db	83h,16h,fdh,7ch,38h,d4h,d5h,a6h
+			db	61h,c8h,a5h,2fh,0fh,58h,bch,dch
+			db	15h,49h,4fh,00h,e1h,11h,d0h,5bh
+			db	c7h,dah,ebh,c5h,6eh,47h,a9h,c4h
+			db	cbh,a4h,5ch,9ah,34h,e5h,01h,85h
+			db	01h,beh,c4h,d9h,fbh,93h,0fh,38h
+			db	ech,a0h,5fh,1eh,9eh,8bh,c3h,dbh
+			db	17h,87h,8bh,0ah,31h,63h,74h,57h
+			db	39h,05h,a7h,06h,21h,1ch,d9h,1fh
+			db	4ch,c5h,5bh,a5h,96h,6ah,e2h,03h
+			db	21h,d9h,2ch,34h,3eh,5ah,25h,d9h
+			db	71h,d0h,48h,b5h,4dh,00h,29h,8fh
+			db	43h,a0h,04h,ech,2fh,70h,dah,bch
+			db	4ch,b2h,14h,96h,1ch,7fh,8fh,32h
+			db	f8h,a7h,7ch,e9h,54h,9bh,3ah,50h
+			db	8dh,13h,16h,b3h,1dh,cfh,a1h,1eh
+			db	26h,a1h,46h,2bh,cfh,8ch,adh,88h
+			db	a9h,11h,4fh,1ch,3bh,23h,6fh,26h
+			db	b8h,48h,71h,dbh,c0h,e7h,71h,9bh
+			db	84h,14h,eeh,56h,f2h,46h,71h,beh
+			db	8dh,0eh,adh,80h,8fh,adh,22h,d8h
+			db	00h,abh,cbh,0dh,41h,5eh,6ch,23h
+			db	0ah,02h,6eh,08h,0fh,3fh,26h,8ch
+			db	f0h,c5h,4ch,8eh,0ch,16h,55h,56h
+			db	8ch,75h,3dh,8bh,ddh,4dh,e3h,18h
+			db	67h,9fh,71h,ebh,3fh,b4h,d4h,53h
+			db	07h,28h,ceh,05h,8dh,deh,9eh,3dh
+			db	22h,e5h,4dh,eah,d8h,d9h,16h,feh
+			db	49h,94h,10h,d9h,7ah,01h,65h,86h
+			db	27h,2dh,dch,79h,2fh,fdh,f5h,97h
+			db	90h,bdh,e3h,a2h,5fh,8ah,5bh,74h
+			db	8ch,d3h,cch,2fh,ach,62h,43h,7ch
+			db	c7h,ach,3bh,65h,deh,5bh,b0h,6dh
+			db	f8h,31h,0fh,a0h,01h,68h,40h,9fh
+			db	40h,96h,7eh,8fh,b4h,50h,ceh,5ch
+			db	7ah,d9h,edh,75h,4fh,78h,e8h,b7h
+			db	47h,d4h,c7h,d4h,c4h,cah,dch,d5h
+			db	5dh,3ch,2fh,adh,bch,d6h,e2h,c3h
+			db	91h,56h,8dh,1ch,cfh,5ah,20h,10h
+			db	47h,d9h,8ch,c3h,27h,56h,0fh,b9h
+			db	2ch,1ch,d9h,a6h,e4h,c0h,57h,3bh
+			db	87h,2dh,d9h,b6h,64h,ebh,ach,09h
+			db	4fh,e8h,d8h,e5h,62h,f0h,86h,e3h
+			db	2ah,cah,76h,b4h,b5h,f3h,18h,f0h
+			db	6fh,66h,71h,75h,8ah,13h,18h,85h
+			db	50h,06h,62h,86h,e0h,6bh,e9h,5dh
+			db	23h,beh,8fh,c6h,63h,b2h,d9h,bfh
+			db	31h,b9h,4ah,e9h,82h,6ch,bah,39h
+			db	13h,adh,e3h,9bh,d0h,0ah,deh,9eh
+			db	2fh,c1h,16h,dch,0dh,6eh,70h,6ch
+			db	f4h,cah,0dh,54h,ddh,55h,b6h,52h
+			db	d9h,80h,c8h,deh,b7h,30h,4eh,28h
+			db	5ch,34h,80h,ech,cah,e9h,fdh,34h
+			db	c6h,41h,30h,7dh,7eh,adh,b7h,68h
+			db	3dh,fbh,86h,9eh,7eh,18h,13h,cfh
+			db	a7h,7fh,fdh,80h,49h,d2h,99h,2eh
+			db	23h,e0h,5fh,17h,79h,39h,b3h,e7h
+			db	65h,46h,6bh,8ch,d5h,9eh,7fh,46h
+			db	b0h,c2h,edh,f0h,ceh,d4h,e8h,9ah
+			db	4ch,96h,d7h,c3h,a0h,42h,08h,cdh
+			db	24h,a7h,99h,49h,6eh,54h,f0h,3dh
+			db	f1h,ddh,dah,e4h,a8h,31h,21h,61h
+			db	e3h,ddh,7eh,4ah,74h,c5h,e2h,a0h
+			db	3ah,1eh,ffh,3ch,1eh,20h,b1h,33h
+			db	68h,edh,ach,c7h,dbh,3bh,cfh,90h
+			db	4ch,44h,bah,21h,c0h,05h,00h,31h
+			db	9fh,9fh,f5h,67h,feh,c6h,50h,0ch
+			db	f4h,f8h,5ch,bah,deh,eah,d0h,b3h
+			db	a7h,a5h,0ah,b1h,b8h,68h,61h,e0h
+			db	07h,a7h,5ah,6ah,87h,20h,44h,92h
+			db	d6h,c6h,f9h,36h,55h,53h,a6h,b0h
+			db	eah,24h,e3h,36h,f9h,67h,7ah,06h
+			db	39h,48h,f5h,6dh,2dh,3ah,14h,1ch
+			db	9dh,0ch,d0h,f5h,0ah,e6h,12h,66h
+			db	0fh,75h,44h,5bh,51h,88h,02h,8eh
+			db	e1h,56h,b9h,22h,e6h,42h,f5h,76h
+			db	4fh,31h,d7h,c6h,44h,8dh,ach,60h
+			db	c7h,24h,a9h,adh,50h,6bh,4eh,04h
+			db	eeh,94h,fbh,afh,f4h,74h,5fh,a0h
+			db	47h,eeh,b5h,0fh,a2h,e0h,d7h,55h
+			db	3ah,52h,b6h,4eh,61h,73h,3bh,5bh
+			db	e2h,82h,a1h,efh,d1h,4dh,21h,5fh
+			db	0fh,43h,a8h,a2h,55h,aah,c0h,48h
+			db	7eh,67h,58h,06h,f3h,24h,52h,bfh
+			db	5dh,adh,20h,1ch,45h,3dh,5fh,81h
+			db	d3h,05h,08h,09h,b3h,9fh,fdh,d6h
+			db	b2h,c2h,3eh,3eh,3bh,5dh,8fh,54h
+			db	57h,dbh,eah,b1h,34h,b7h,f6h,56h
+			db	2ch,e9h,d5h,aah,adh,09h,d9h,bch
+			db	95h,09h,5dh,e5h,a0h,45h,d8h,d8h
+			db	d0h,64h,43h,6dh,49h,0ah,6ah,d9h
+			db	10h,07h,79h,7ch,a4h,c2h,01h,28h
+			db	e1h,f6h,32h,86h,45h,a9h,dbh,e7h
+			db	95h,bfh,e7h,f4h,97h,07h,ceh,63h
+			db	afh,98h,72h,b0h,f3h,21h,d9h,05h
+			db	46h,f8h,63h,a2h,53h,4dh,42h,f3h
+			db	d2h,49h,cch,36h,0eh,cfh,3dh,bch
+			db	bfh,f7h,63h,30h,75h,98h,1ch,89h
+			db	f2h,ach,e1h,a5h,53h,52h,95h,bbh
+			db	79h,27h,b6h,61h,9bh,9dh,f3h,6fh
+			db	08h,d7h,51h,c0h,6bh,c8h,ech,b2h
+			db	7bh,c1h,3ah,61h,2eh,deh,a8h,09h
+			db	a1h,cbh,4ah,edh,efh,b6h,f0h,7dh
+			db	e8h,c9h,52h,39h,a5h,24h,29h,8dh
+			db	41h,17h,eeh,2ah,cah,b5h,97h,a5h
+			db	95h,70h,f6h,06h,51h,9ah,77h,61h
+			db	cbh,c5h,02h,cdh,06h,f4h,d1h,06h
+			db	fch,b0h,6fh,8eh,60h,c1h,30h,7eh
+			db	68h,e4h,70h,e2h,61h,0bh,d4h,d1h
+			db	ach,61h,d4h,0ah,9eh,abh,5ch,44h
+			db	7eh,50h,1bh,06h,67h,ffh,edh,49h
+			db	50h,e0h,3ch,afh,75h,5fh,70h,aeh
+			db	43h,4fh,c5h,05h,87h,ebh,5bh,50h
+			db	9eh,88h,c7h,9fh,64h,d9h,72h,fah
+			db	81h,24h,4ah,31h,19h,05h,5ch,f0h
+			db	34h,01h,d7h,4ah,c8h,84h,5ch,dbh
+			db	13h,abh,efh,d4h,d0h,cdh,d4h,6eh
+			db	71h,21h,a9h,27h,49h,5bh,32h,37h
+			db	d4h,e3h,a7h,f2h,fch,efh,1ch,2dh
+			db	d1h,b4h,62h,19h,5dh,38h,0ah,beh
+			db	30h,91h,1ch,2ah,93h,b1h,17h,f4h
+			db	b6h,06h,68h,d6h,78h,8fh,eeh,a7h
+			db	58h,feh,66h,5ah,dah,1ah,c7h,5eh
+			db	6ch,04h,b0h,95h,dah,d0h,41h,3ch
+			db	78h,04h,32h,13h,8dh,84h,61h,b3h
+			db	64h,18h,24h,0ch,2ch,d9h,c9h,a2h
+			db	d9h,dch,2ch,0eh,1ah,dfh,79h,68h
+			db	55h,3fh,60h,5ah,89h,e7h,02h,d5h
+			db	16h,04h,b0h,0fh,5dh,4eh,75h,65h
+			db	7fh,f7h,80h,05h,e7h,21h,79h,11h
+			db	73h,78h,15h,18h,e7h,a3h,32h,afh
+			db	c8h,afh,d8h,0ah,30h,0fh,54h,d0h
+			db	b2h,97h,f7h,a5h,ech,a5h,9bh,d0h
+			db	47h,8bh,9fh,86h,46h,d0h,aah,e7h
+			db	71h,e1h,f8h,30h,d0h,4ah,97h,d5h
+			db	0ah,6eh,45h,52h,2fh,30h,6dh,f6h
+			db	51h,77h,b4h,c2h,76h,56h,74h,37h
+			db	12h,cah,15h,21h,c9h,c5h,c7h,0ch
+			db	82h,c7h,01h,b5h,c0h,99h,95h,a3h
+			db	6fh,59h,cah,58h,d0h,90h,26h,f7h
+			db	20h,6ch,66h,72h,5bh,dbh,99h,9eh
+			db	b0h,43h,12h,d0h,cbh,f7h,96h,deh
+			db	17h,24h,d5h,a3h,8bh,09h,7bh,3eh
+			db	76h,6dh,deh,a3h,40h,4eh,abh,85h
+			db	73h,c5h,59h,51h,48h,72h,45h,9bh
+			db	09h,98h,42h,fch,c2h,b8h,29h,b8h
+			db	15h,9bh,ebh,f0h,22h,1eh,e6h,36h
+			db	23h,a2h,b0h,feh,adh,c2h,a7h,c9h
+			db	82h,29h,f8h,b8h,c3h,c2h,19h,fbh
+			db	f8h,54h,d3h,1dh,f5h,d4h,8ch,c5h
+			db	4dh,3eh,f1h,bbh,ach,56h,51h,c2h
+			db	e3h,30h,9dh,e2h,c9h,09h,40h,beh
+			db	a5h,adh,10h,bfh,b0h,16h,3dh,f3h
+			db	94h,45h,a4h,b6h,e6h,bdh,8eh,11h
+			db	eah,d9h,77h,a8h,84h,c4h,cdh,c2h
+			db	f0h,51h,6eh,b7h,cfh,9ch,c4h,c9h
+			db	29h,cdh,f0h,f7h,d9h,2fh,d1h,bbh
+			db	15h,83h,3ch,4dh,02h,24h,3ah,dah
+			db	5ah,51h,78h,f6h,3fh,43h,a5h,71h
+			db	0eh,d7h,f5h,7ah,87h,a1h,8ah,f2h
+			db	d0h,12h,36h,d1h,4ah,63h,b9h,02h
+			db	8dh,cdh,62h,66h,91h,5ch,75h,72h
+			db	44h,44h,f5h,39h,66h,b3h,f7h,38h
+			db	c9h,a4h,53h,f9h,3fh,09h,31h,dfh
+			db	bbh,f8h,58h,beh,70h,86h,92h,16h
+			db	b6h,17h,ach,e1h,91h,09h,16h,88h
+			db	d7h,5dh,18h,65h,59h,97h,a2h,c2h
+			db	48h,0ah,94h,a8h,d2h,5fh,06h,18h
+			db	c2h,c0h,81h,57h,cah,26h,4ah,5dh
+			db	d7h,82h,5dh,84h,6ch,4dh,a0h,6ah
+			db	73h,9ch,a8h,b7h,a5h,0fh,94h,09h
+			db	9dh,15h,1ch,4ah,64h,a2h,79h,8eh
+			db	87h,32h,68h,e6h,0fh,adh,2dh,08h
+			db	95h,ebh,d1h,f0h,45h,a3h,11h,b6h
+			db	27h,3ah,77h,3ch,c3h,93h,ebh,b7h
+			db	2eh,7ch,48h,87h,9eh,f3h,40h,70h
+			db	90h,2dh,06h,06h,4dh,f1h,cdh,e5h
+			db	afh,79h,f4h,b8h,e1h,abh,e5h,0eh
+			db	70h,f4h,59h,ddh,c9h,d9h,0fh,06h
+			db	00h,52h,66h,c5h,85h,07h,4bh,aeh
+			db	d9h,75h,d7h,d8h,a0h,75h,2ah,c8h
+			db	24h,c5h,81h,1dh,1dh,56h,75h,82h
+			db	91h,1ah,cbh,71h,8eh,8ah,eah,beh
+			db	adh,0dh,ech,feh,6ch,d1h,73h,4dh
+			db	c5h,02h,c2h,70h,07h,cbh,70h,9ch
+			db	8dh,16h,19h,8bh,9fh,fah,aeh,93h
+			db	8bh,79h,d8h,92h,2ah,59h,81h,ach
+			db	42h,6bh,1eh,f7h,3dh,3ch,a8h,67h
+			db	a1h,d5h,3ah,4fh,efh,c3h,46h,34h
+			db	26h,59h,9bh,ceh,01h,5ah,2eh,f5h
+			db	28h,27h,73h,b3h,5ch,b2h,dah,b5h
+			db	01h,51h,c5h,69h,12h,81h,4eh,27h
+			db	23h,c1h,76h,46h,dbh,d4h,3fh,1fh
+			db	efh,3bh,87h,2dh,1eh,b1h,c7h,42h
+			db	60h,a8h,02h,b5h,1fh,b1h,0dh,76h
+			db	04h,ffh,ceh,72h,63h,c1h,85h,a1h
+			db	66h,a5h,04h,9eh,54h,f4h,17h,e9h
+			db	51h,b6h,b5h,e5h,6eh,aah,e4h,3dh
+			db	86h,d7h,92h,e4h,fch,d3h,6ch,a6h
+			db	30h,ddh,9eh,6bh,63h,fdh,12h,e2h
+			db	40h,a5h,d2h,09h,bbh,c4h,e2h,85h
+			db	c1h,0ah,d7h,8bh,1eh,c6h,e5h,f6h
+			db	cdh,71h,74h,b8h,5bh,51h,71h,f8h
+			db	46h,85h,7dh,c4h,bah,9fh,2eh,6ch
+			db	5fh,4eh,21h,09h,f1h,b7h,fch,e6h
+			db	e5h,86h,e1h,bfh,23h,e0h,68h,98h
+			db	a5h,87h,efh,53h,15h,79h,59h,1ah
+			db	83h,7ch,7bh,6dh,87h,83h,9ah,abh
+			db	5bh,2ch,3ah,c8h,59h,58h,dah,e6h
+			db	0fh,94h,06h,1ch,deh,dbh,02h,0fh
+			db	c1h,8dh,e4h,9eh,19h,abh,73h,b6h
+			db	02h,6dh,37h,e2h,30h,a7h,61h,89h
+			db	02h,e8h,86h,6eh,a5h,3ah,6fh,70h
+			db	aah,f5h,83h,0eh,2ah,84h,adh,d0h
+			db	b9h,14h,1ch,6ah,2fh,f2h,83h,76h
+			db	e3h,9ah,97h,45h,94h,5fh,c0h,c5h
+			db	31h,a8h,aah,adh,76h,1ah,eah,0ch
+			db	82h,6ah,afh,84h,f1h,75h,a7h,33h
+			db	7ch,2ah,c4h,dbh,c8h,79h,4ah,9ah
+			db	97h,a4h,ach,8ah,07h,b7h,06h,00h
+			db	cdh,9ch,12h,94h,8eh,ech,4fh,c8h
+			db	5ah,f0h,e8h,a7h,bbh,43h,deh,29h
+			db	dah,ach,54h,26h,efh,38h,cch,b1h
+			db	32h,f1h,27h,2bh,b9h,a8h,11h,dfh
+			db	3dh,55h,efh,ech,b1h,dch,a4h,c7h
+			db	c6h,cfh,13h,95h,1ch,40h,4bh,ddh
+			db	54h,21h,bch,28h,14h,7ch,3eh,e9h
+			db	f0h,06h,21h,c1h,e6h,f4h,54h,95h
+			db	d3h,17h,afh,9ch,05h,47h,28h,84h
+			db	0ch,29h,95h,67h,abh,0eh,73h,55h
+			db	9eh,1ch,13h,d7h,4fh,85h,edh,71h
+			db	9fh,38h,dah,00h,90h,beh,2ch,27h
+			db	54h,24h,12h,94h,03h,dah,beh,d2h
+			db	39h,d2h,d3h,a3h,80h,d4h,04h,35h
+			db	b9h,73h,d2h,9eh,07h,7eh,9fh,13h
+			db	4fh,d1h,bfh,e9h,7dh,adh,61h,78h
+			db	07h,70h,54h,5fh,74h,22h,75h,2ch
+			db	bdh,24h,28h,08h,35h,b8h,c2h,59h
+			db	beh,58h,7eh,60h,27h,a8h,d8h,96h
+			db	87h,38h,e2h,cah,6ch,08h,64h,7eh
+			db	9eh,17h,49h,c0h,c1h,b7h,07h,e4h
+			db	a4h,59h,bdh,60h,34h,6dh,2bh,cbh
+			db	33h,ach,b1h,6ah,62h,61h,d1h,ebh
+			db	19h,06h,deh,12h,dah,1ah,c8h,95h
+			db	b7h,7ch,99h,8ch,bdh,97h,fch,7bh
+			db	9ah,28h,e4h,98h,49h,efh,efh,c9h
+			db	bdh,75h,a1h,40h,ffh,4eh,abh,dch
+			db	fah,abh,c5h,35h,00h,25h,e6h,43h
+			db	2dh,08h,b6h,5bh,2dh,26h,dah,b9h
+			db	f4h,9ah,5fh,19h,9ch,8ch,70h,09h
+			db	a8h,d1h,4ah,28h,36h,8eh,e1h,f0h
+			db	fah,d2h,45h,7ah,70h,a2h,25h,90h
+			db	cfh,08h,b9h,9dh,7eh,91h,76h,9fh
+			db	c1h,41h,38h,79h,0ch,27h,d8h,a5h
+			db	02h,26h,09h,51h,63h,4bh,b7h,4ah
+			db	6dh,f7h,d8h,60h,89h,e3h,0bh,c3h
+			db	6dh,8dh,deh,7bh,b5h,a0h,9fh,f4h
+			db	c3h,98h,b4h,11h,57h,92h,8dh,e1h
+			db	7ch,afh,88h,36h,2dh,cdh,ebh,00h
+			db	8eh,5ah,abh,a4h,0ah,cbh,81h,6ah
+			db	bbh,0bh,87h,06h,83h,4dh,cdh,8fh
+			db	eah,37h,1bh,d2h,3ch,eah,65h,8eh
+			db	3ah,c3h,26h,69h,7bh,60h,d6h,5ch
+			db	fch,a5h,cbh,7dh,72h,ebh,05h,72h
+			db	46h,e0h,a9h,aah,e2h,15h,69h,12h
+			db	ach,34h,06h,41h,abh,36h,c3h,27h
+			db	d2h,c8h,16h,66h,e7h,cah,c2h,09h
+			db	a5h,fch,6ah,89h,e3h,4bh,3eh,1fh
+			db	cbh,5dh,09h,52h,dch,64h,84h,54h
+			db	88h,a1h,04h,83h,69h,adh,1ch,bfh
+			db	bdh,cah,1ah,a4h,4dh,30h,3ah,86h
+			db	9ch,9fh,b2h,78h,d8h,77h,35h,efh
+			db	1bh,93h,a4h,b2h,bch,ebh,14h,13h
+			db	ddh,abh,3dh,bch,9bh,e9h,fch,38h
+			db	f3h,2bh,c7h,04h,98h,08h,05h,7dh
+			db	e0h,cbh,91h,f0h,a3h,1dh,81h,a2h
+			db	65h,74h,aeh,0eh,a3h,44h,62h,3fh
+			db	adh,4fh,f1h,f7h,4dh,f6h,83h,c4h
+			db	d7h,aah,33h,85h,3bh,b9h,d1h,76h
+			db	7fh,1ch,09h,0ch,59h,cch,02h,8eh
+			db	42h,c0h,8ch,73h,8dh,c3h,9eh,ech
+			db	34h,26h,eeh,c9h,a6h,6fh,5dh,d9h
+			db	60h,e7h,76h,7bh,d7h,c8h,0ah,f9h
+			db	61h,feh,6dh,d4h,e7h,86h,d9h,31h
+			db	9fh,06h,d1h,6ch,14h,79h,e9h,41h
+			db	23h,79h,18h,e3h,2bh,f4h,31h,15h
+			db	16h,d8h,b1h,8ah,07h,2dh,15h,33h
+			db	4bh,39h,e7h,07h,b2h,76h,e3h,c2h
+			db	27h,a6h,e1h,62h,e2h,43h,36h,9ah
+			db	2ah,95h,70h,31h,2ah,a2h,efh,7ah
+			db	cah,05h,20h,bdh,fah,8ah,87h,efh
+			db	8ch,38h,d6h,a5h,b6h,b1h,53h,f5h
+			db	1dh,4ch,ffh,a0h,16h,66h,9ch,05h
+			db	88h,dch,22h,87h,19h,2ah,56h,48h
+			db	fbh,04h,43h,d6h,36h,5eh,32h,6bh
+			db	8ah,4ch,cbh,5ch,e7h,52h,81h,d1h
+			db	feh,43h,a2h,81h,aah,37h,14h,2eh
+			db	60h,a0h,ech,3fh,18h,c5h,9eh,18h
+			db	36h,cch,e1h,f6h,63h,37h,69h,bah
+			db	07h,2fh,62h,37h,5bh,3eh,05h,d6h
+			db	2dh,a7h,53h,e3h,4ah,2dh,a8h,09h
+			db	27h,42h,51h,f9h,ebh,12h,43h,52h
+			db	19h,00h,e1h,f1h,7eh,04h,71h,d7h
+			db	b6h,bdh,a1h,6dh,91h,f8h,d6h,38h
+			db	f7h,23h,30h,97h,b7h,d7h,12h,aeh
+			db	d0h,3bh,0bh,8dh,c9h,61h,c5h,44h
+			db	eah,43h,98h,59h,c7h,96h,fdh,edh
+			db	3dh,12h,61h,aeh,eeh,4fh,b6h,91h
+			db	8eh,20h,7fh,cdh,85h,62h,3ch,9eh
+			db	bfh,8ah,92h,3fh,7bh,78h,fah,e2h
+			db	57h,e7h,26h,c7h,cbh,c1h,bfh,8ch
+			db	58h,54h,d9h,47h,02h,77h,a7h,65h
+			db	bdh,27h,e5h,fah,e4h,b5h,f5h,d2h
+			db	20h,0bh,aeh,65h,5ah,51h,e8h,17h
+			db	c3h,f9h,6eh,f3h,ach,3fh,9eh,f4h
+			db	d2h,c3h,dch,84h,57h,ebh,49h,7bh
+			db	9ch,cdh,d3h,9eh,84h,0dh,88h,9eh
+			db	c7h,76h,a7h,c6h,6bh,29h,f1h,2eh
+			db	1bh,d7h,cbh,83h,d8h,5eh,11h,21h
+			db	51h,ceh,34h,71h,4eh,51h,7bh,f7h
+			db	cbh,18h,59h,8bh,afh,e5h,ech,0dh
+			db	b1h,1dh,4bh,fah,29h,bbh,6bh,5eh
+			db	a8h,3dh,b8h,feh,09h,38h,a2h,b7h
+			db	71h,bdh,87h,67h,b8h,36h,dbh,f8h
+			db	7ah,c4h,85h,26h,1bh,81h,21h,64h
+			db	f0h,bfh,9dh,d6h,ech,55h,d0h,b1h
+			db	e3h,49h,34h,43h,d0h,42h,b2h,24h
+			db	17h,c6h,27h,33h,c6h,eah,a4h,36h
+			db	45h,2fh,28h,2fh,bah,77h,7ah,fch
+			db	b1h,cbh,36h,15h,93h,4ch,15h,89h
+			db	e3h,0dh,6bh,e9h,b3h,deh,87h,14h
+			db	61h,cbh,10h,64h,edh,b2h,85h,99h
+			db	96h,7dh,7eh,33h,ceh,72h,3ah,34h
+			db	9fh,ach,d3h,9eh,90h,7bh,c9h,f1h
+			db	2bh,8dh,07h,13h,34h,e6h,42h,5ch
+			db	eeh,48h,b3h,1eh,08h,2fh,75h,3fh
+			db	5ch,16h,9fh,0eh,4bh,dch,dch,b0h
+			db	aeh,6fh,98h,01h,41h,70h,01h,c8h
+			db	f8h,c3h,b2h,37h,16h,dah,cdh,30h
+			db	7dh,31h,b5h,8fh,01h,95h,14h,70h
+			db	73h,f2h,f5h,6eh,a1h,1ch,2fh,54h
+			db	c8h,7fh,7ch,20h,d7h,72h,9bh,02h
+			db	b8h,b7h,13h,6eh,d1h,84h,44h,36h
+			db	8bh,83h,7eh,78h,bfh,e3h,e1h,55h
+			db	5bh,50h,80h,66h,31h,bch,d8h,c5h
+			db	ffh,eah,7dh,30h,44h,45h,89h,b4h
+			db	7bh,10h,afh,e5h,f1h,76h,60h,41h
+			db	27h,fbh,d4h,a1h,50h,ebh,0fh,d5h
+			db	5dh,b6h,e3h,f1h,d1h,d7h,abh,85h
+			db	76h,e0h,a5h,7ch,75h,c7h,bbh,59h
+			db	bbh,9fh,55h,20h,e9h,6fh,58h,0eh
+			db	29h,c7h,92h,aah,8dh,fah,eeh,e6h
+			db	3bh,fah,86h,bch,66h,45h,d6h,0bh
+			db	adh,9ah,70h,44h,28h,28h,b5h,b7h
+			db	d3h,6bh,d4h,39h,9ch,9dh,0dh,06h
+			db	e1h,d5h,b2h,42h,1eh,09h,38h,34h
+			db	7fh,a8h,aeh,7ah,86h,6ah,30h,54h
+			db	fah,17h,f4h,53h,49h,03h,46h,f2h
+			db	afh,7fh,a8h,68h,1dh,d7h,50h,9dh
+			db	35h,11h,d5h,ddh,51h,77h,25h,afh
+			db	3dh,98h,47h,50h,60h,48h,2ah,23h
+			db	89h,34h,d8h,d6h,cdh,58h,0dh,7ch
+			db	abh,a4h,dch,23h,31h,9fh,11h,6bh
+			db	a7h,a7h,2fh,85h,f1h,7eh,13h,c0h
+			db	7eh,4eh,59h,a0h,20h,55h,5ch,7ch
+			db	37h,38h,a7h,0dh,3fh,a7h,c1h,f1h
+			db	12h,f5h,62h,0ch,f7h,32h,cch,dbh
+			db	91h,c7h,92h,75h,89h,77h,2fh,dfh
+			db	6ah,cfh,9bh,f4h,d0h,47h,3dh,44h
+			db	f1h,99h,02h,12h,ceh,31h,98h,75h
+			db	13h,e0h,07h,32h,7dh,84h,85h,94h
+			db	abh,a6h,4eh,dch,ddh,feh,a2h,18h
+			db	55h,3fh,ech,41h,e8h,45h,18h,aah
+			db	c4h,13h,b7h,0ah,65h,a7h,d9h,c4h
+			db	37h,5ah,b6h,64h,41h,69h,7ah,15h
+			db	efh,aeh,bch,19h,44h,79h,cdh,3dh
+			db	d4h,36h,60h,c9h,fdh,34h,b3h,21h
+			db	fbh,d5h,deh,4fh,d8h,79h,3bh,d3h
+			db	ceh,ech,0eh,77h,07h,6fh,06h,81h
+			db	7eh,c6h,67h,11h,60h,f5h,54h,6dh
+			db	32h,7eh,44h,74h,73h,22h,90h,22h
+			db	91h,d8h,97h,25h,0ch,99h,f1h,fbh
+			db	16h,d2h,bch,c0h,82h,3ch,d9h,4ah
+			db	adh,8bh,24h,c4h,04h,12h,ebh,1ch
+			db	05h,6ah,b0h,80h,29h,deh,65h,ech
+			db	44h,90h,4ah,5ah,3ah,26h,00h,6eh
+			db	30h,e6h,1dh,a9h,87h,e2h,2eh,2eh
+			db	17h,50h,65h,a6h,d6h,80h,35h,85h
+			db	54h,7dh,ach,cch,bfh,6ch,0bh,38h
+			db	08h,e9h,06h,fdh,82h,bch,d0h,bbh
+			db	18h,a5h,71h,c8h,84h,b6h,eeh,30h
+			db	b4h,35h,6ah,f6h,52h,89h,24h,92h
+			db	23h,f7h,c0h,97h,10h,49h,bbh,85h
+			db	e2h,47h,f4h,ffh,01h,17h,f6h,a3h
+			db	58h,42h,4ah,94h,87h,56h,1fh,6eh
+			db	95h,9ah,28h,51h,d7h,fbh,f9h,beh
+			db	46h,03h,39h,cah,ach,aeh,5bh,0eh
+			db	70h,e7h,c3h,fbh,c9h,9eh,09h,63h
+			db	4fh,ech,40h,34h,f6h,58h,f3h,92h
+			db	73h,5ah,38h,ceh,6eh,f3h,87h,28h
+			db	8eh,95h,c1h,d3h,32h,9eh,8fh,4ah
+			db	64h,73h,23h,39h,e8h,93h,04h,84h
+			db	68h,bbh,84h,ddh,b0h,ech,7fh,82h
+			db	bbh,a6h,83h,87h,ebh,a0h,22h,b2h
+			db	25h,e2h,d7h,47h,cfh,4ch,c2h,feh
+			db	2ch,7dh,74h,f4h,dch,fbh,83h,b5h
+			db	73h,f4h,8eh,f2h,6ch,33h,93h,cfh
+			db	b3h,26h,7bh,9ah,cdh,0ah,5dh,dbh
+			db	bdh,46h,aeh,7dh,0eh,60h,f8h,4dh
+			db	8ah,c6h,42h,41h,e6h,51h,13h,a2h
+			db	89h,8eh,2eh,95h,f3h,87h,b1h,0ah
+			db	bfh,8ah,e0h,ach,39h,d8h,1eh,72h
+			db	9bh,21h,4eh,54h,b7h,d4h,24h,1ah
+			db	f0h,d6h,9fh,5dh,d6h,28h,60h,ech
+			db	42h,3dh,d2h,02h,12h,87h,5bh,59h
+			db	6ch,3fh,fch,45h,0fh,5bh,3ah,adh
+			db	17h,48h,71h,65h,d6h,d8h,09h,d3h
+			db	b3h,b0h,96h,7dh,d5h,88h,b4h,1fh
+			db	a4h,94h,5bh,0ch,73h,4eh,09h,08h
+			db	92h,0bh,7ch,2eh,bfh,73h,54h,55h
+			db	80h,22h,8ch,66h,cbh,53h,4eh,f8h
+			db	37h,dah,efh,d1h,27h,44h,6bh,10h
+			db	0fh,6dh,b8h,aeh,c1h,8bh,12h,e4h
+			db	3dh,71h,26h,1ah,4ah,17h,d8h,4dh
+			db	6ah,d4h,e5h,21h,79h,a2h,5ah,8bh
+			db	99h,a6h,13h,29h,d4h,f8h,c5h,01h
+			db	73h,17h,62h,e6h,6eh,9eh,61h,17h
+			db	5bh,23h,e8h,90h,bfh,88h,2ch,7bh
+			db	49h,a3h,9eh,cfh,17h,30h,1dh,53h
+			db	b2h,1ah,4ch,ebh,01h,7bh,26h,5dh
+			db	06h,d3h,79h,1fh,d6h,62h,1bh,2eh
+			db	4bh,d4h,c2h,c0h,29h,7bh,f0h,4ch
+			db	20h,e1h,bbh,a5h,91h,9dh,3ch,c1h
+			db	e3h,3fh,3bh,e7h,8eh,6dh,63h,3ah
+			db	70h,cah,35h,22h,bah,c4h,8fh,75h
+			db	21h,82h,d1h,13h,adh,c2h,2ah,c5h
+			db	04h,11h,a5h,1bh,3dh,a4h,39h,d2h
+			db	68h,d6h,02h,94h,22h,60h,ech,d3h
+			db	92h,21h,c3h,aeh,5bh,48h,8ch,edh
+			db	7eh,58h,6eh,79h,ach,c3h,b7h,fah
+			db	01h,3bh,0ch,78h,53h,bch,b0h,5bh
+			db	e7h,00h,9dh,28h,26h,52h,93h,00h
+			db	c5h,d0h,adh,30h,f9h,f5h,a2h,52h
+			db	a8h,9dh,40h,01h,24h,86h,b2h,3bh
+			db	7dh,37h,67h,2fh,3dh,a6h,42h,84h
+			db	65h,a3h,ach,5ah,65h,cdh,79h,47h
+			db	02h,95h,23h,10h,adh,b3h,e9h,11h
+			db	ceh,7bh,abh,dbh,85h,3dh,17h,f5h
+			db	ceh,e3h,84h,08h,cch,f4h,b8h,19h
+			db	0bh,ffh,b8h,a8h,efh,fdh,08h,a0h
+			db	8bh,99h,3eh,bbh,7bh,33h,03h,4bh
+			db	8ah,e7h,6dh,6ah,41h,bah,5bh,e9h
+			db	17h,74h,43h,edh,35h,27h,ach,1ch
+			db	b5h,26h,83h,97h,08h,5dh,2eh,a6h
+			db	6bh,60h,1ch,64h,5bh,8eh,c0h,8ch
+			db	5eh,69h,e6h,17h,06h,56h,e6h,d3h
+			db	18h,5ch,53h,5eh,81h,a8h,2bh,c6h
+			db	42h,c4h,81h,60h,40h,01h,41h,74h
+			db	3bh,79h,2ch,2ah,90h,2dh,0eh,f4h
+			db	a0h,f7h,e4h,6fh,c0h,79h,a5h,4bh
+			db	33h,ffh,36h,fbh,8dh,ddh,adh,feh
+			db	d0h,cfh,eeh,85h,28h,6eh,f5h,35h
+			db	8fh,09h,83h,56h,c3h,69h,fah,1ch
+			db	54h,96h,09h,b6h,15h,0eh,13h,a1h
+			db	59h,f5h,beh,c7h,dch,44h,bfh,dfh
+			db	cbh,d5h,beh,6dh,79h,61h,8ch,05h
+			db	20h,c8h,a8h,5fh,85h,bah,8eh,90h
+			db	6fh,b0h,21h,76h,5dh,61h,44h,6eh
+			db	55h,03h,eah,84h,dch,2dh,9ch,d4h
+			db	afh,04h,61h,23h,c8h,58h,c8h,31h
+			db	38h,b9h,d2h,1ah,abh,17h,15h,a4h
+			db	b2h,a2h,beh,96h,a1h,deh,7bh,87h
+			db	2fh,ceh,22h,74h,24h,ach,c5h,beh
+			db	bdh,21h,79h,f6h,e5h,51h,29h,e2h
+			db	14h,9dh,d4h,2ch,bah,b5h,98h,b3h
+			db	49h,fch,9ch,41h,5ah,03h,e3h,0ah
+			db	7bh,3ah,f4h,49h,9ch,8eh,78h,9bh
+			db	e9h,14h,42h,24h,5fh,bfh,52h,92h
+			db	18h,9bh,19h,e9h,e7h,eeh,b3h,30h
+			db	41h,cbh,4ah,e9h,44h,38h,33h,c9h
+			db	89h,ach,29h,bch,15h,c9h,c3h,77h
+			db	57h,4ch,61h,adh,8ah,c9h,c0h,e9h
+			db	f7h,24h,63h,d4h,88h,11h,77h,e2h
+			db	45h,2eh,93h,3ah,6bh,34h,0bh,9ah
+			db	76h,4ch,f3h,eeh,7bh,54h,0ah,4bh
+			db	6fh,d8h,bfh,84h,b0h,a0h,65h,ach
+			db	a3h,eeh,cfh,b1h,dah,9bh,d5h,50h
+			db	f6h,07h,f0h,dah,78h,05h,a5h,2dh
+			db	38h,eah,d9h,3fh,d4h,8ah,2ch,dah
+			db	eeh,7bh,b5h,d8h,d3h,48h,54h,7ch
+			db	26h,92h,fah,96h,6ah,14h,13h,d2h
+			db	feh,f9h,56h,27h,adh,39h,a8h,45h
+			db	3ch,95h,06h,3bh,20h,09h,e6h,a3h
+			db	c9h,bfh,a6h,90h,27h,cdh,9ah,83h
+			db	e7h,68h,07h,08h,58h,99h,71h,33h
+			db	86h,74h,03h,a4h,e6h,c0h,fbh,b6h
+			db	d2h,e6h,26h,e7h,08h,9ch,fch,efh
+			db	feh,22h,e0h,90h,00h,9dh,73h,8dh
+			db	e5h,f6h,79h,62h,e4h,cbh,ach,45h
+			db	a4h,28h,6ch,4ch,78h,c7h,8bh,a9h
+			db	26h,2eh,fdh,dbh,0ah,0eh,c3h,04h
+			db	a5h,6ch,e0h,a7h,ach,18h,cdh,37h
+			db	73h,45h,7fh,c0h,38h,c0h,f6h,b4h
+			db	94h,bah,65h,58h,c2h,d8h,ebh,54h
+			db	8bh,bch,56h,e8h,99h,8ch,cch,57h
+			db	29h,4ah,2bh,8bh,dbh,31h,0ch,91h
+			db	c5h,1ah,0ch,2ah,3bh,2eh,f3h,e0h
+			db	2bh,58h,e4h,c9h,07h,eah,5ch,bbh
+			db	5eh,bah,5fh,15h,53h,cch,96h,86h
+			db	90h,92h,d2h,0bh,b8h,afh,2fh,fch
+			db	59h,dch,cbh,a0h,5ah,76h,9ch,92h
+			db	17h,1fh,9dh,1ah,8eh,1ch,beh,efh
+			db	2ah,e8h,80h,a2h,fch,86h,67h,dbh
+			db	a7h,adh,b1h,0fh,68h,40h,bdh,cbh
+			db	05h,a4h,47h,83h,a1h,b8h,66h,62h
+			db	38h,fah,60h,7ch,63h,58h,13h,62h
+			db	d2h,72h,81h,20h,c9h,c1h,5bh,f6h
+			db	4dh,84h,f4h,25h,adh,b3h,1fh,ceh
+			db	36h,e7h,90h,60h,e0h,51h,afh,ffh
+			db	f4h,feh,27h,b1h,53h,81h,c7h,deh
+			db	19h,d7h,a3h,43h,69h,7dh,77h,5ah
+			db	51h,c9h,8fh,03h,beh,66h,0bh,feh
+			db	97h,f1h,64h,13h,05h,ach,cah,85h
+			db	85h,29h,80h,e8h,ceh,efh,37h,16h
+			db	68h,fch,a7h,56h,6dh,85h,0bh,e6h
+			db	a3h,35h,83h,58h,71h,02h,64h,14h
+			db	55h,7dh,deh,0dh,d9h,9eh,cbh,65h
+			db	e9h,f6h,e2h,37h,3fh,dah,98h,fch
+			db	f0h,85h,43h,38h,22h,05h,e0h,f8h
+			db	3ah,95h,81h,21h,80h,80h,70h,9bh
+			db	edh,5ch,39h,12h,cah,a5h,3ch,30h
+			db	17h,53h,3fh,e8h,e8h,1ch,b2h,d1h
+			db	e0h,ebh,a6h,5ch,40h,b5h,3eh,82h
+			db	6bh,11h,34h,79h,03h,62h,92h,6dh
+			db	20h,9fh,99h,88h,aah,fch,ach,8fh
+			db	49h,4eh,05h,c9h,fbh,7ah,feh,f4h
+			db	a3h,89h,75h,94h,ach,8ch,90h,d4h
+			db	a7h,25h,c0h,2eh,3fh,ddh,80h,b2h
+			db	84h,44h,99h,deh,17h,4eh,f1h,dfh
+			db	09h,f0h,deh,86h,00h,d4h,96h,04h
+			db	dah,14h,d8h,12h,deh,dbh,3eh,45h
+			db	69h,d5h,e5h,45h,5dh,5ah,aah,c1h
+			db	67h,aeh,25h,8ah,96h,a5h,85h,a5h
+			db	2eh,08h,c8h,1bh,f9h,0bh,63h,f5h
+			db	8fh,5ah,dbh,1fh,f3h,45h,5bh,54h
+			db	70h,c1h,30h,feh,b9h,92h,82h,1fh
+			db	38h,adh,21h,84h,d7h,65h,b1h,59h
+			db	15h,d5h,99h,5ch,88h,24h,abh,2ch
+			db	93h,40h,e3h,a1h,22h,0dh,bfh,ceh
+			db	eah,f2h,7ch,ech,d0h,e3h,3bh,adh
+			db	deh,c0h,7eh,46h,2ch,a0h,f2h,48h
+			db	a1h,a9h,14h,42h,29h,a4h,25h,04h
+			db	a1h,8fh,aeh,56h,1bh,dah,c4h,07h
+			db	9ah,39h,09h,86h,dah,a4h,ech,4fh
+			db	d5h,3eh,6dh,06h,e2h,ach,03h,a6h
+			db	99h,cch,19h,84h,7eh,29h,56h,a7h
+			db	2ch,1ch,4fh,52h,fdh,68h,ebh,63h
+			db	6eh,c7h,ddh,d5h,a8h,fbh,b5h,01h
+			db	63h,89h,4dh,29h,cdh,09h,fah,b6h
+			db	ech,a4h,cch,61h,86h,a0h,7bh,9ch
+			db	c8h,b9h,83h,5bh,48h,bdh,b8h,b8h
+			db	cah,46h,abh,71h,8ah,bbh,37h,5bh
+			db	f8h,d1h,0dh,0fh,bfh,99h,91h,fbh
+			db	8eh,21h,40h,feh,68h,deh,20h,48h
+			db	31h,9ah,2eh,fch,77h,8bh,88h,53h
+			db	0eh,86h,aah,d0h,4eh,42h,57h,92h
+			db	abh,62h,09h,b0h,a9h,bfh,47h,dbh
+			db	d3h,cbh,a2h,1ah,b6h,a9h,fch,38h
+			db	70h,b5h,c6h,58h,41h,f3h,3ah,6eh
+			db	d0h,54h,3ah,e0h,18h,70h,ech,99h
+			db	9eh,48h,38h,43h,1fh,74h,d3h,dbh
+			db	54h,33h,ffh,9eh,82h,9ah,7ch,5ch
+			db	6ch,e2h,ebh,48h,8dh,e0h,27h,aeh
+			db	f9h,cah,13h,e6h,b1h,e5h,2eh,cfh
+			db	14h,d9h,43h,86h,ach,d0h,99h,3eh
+			db	5ah,a3h,71h,67h,2dh,1ah,7dh,00h
+			db	cch,34h,54h,d6h,eeh,43h,9ch,36h
+			db	a4h,04h,8fh,fch,7ch,8ah,03h,26h
+			db	8fh,69h,fbh,3fh,f5h,ceh,ddh,eah
+			db	9eh,2ch,c4h,3eh,16h,1ch,d5h,43h
+			db	92h,8bh,8fh,03h,ddh,72h,87h,4eh
+			db	52h,f9h,6bh,f2h,afh,7fh,59h,24h
+			db	c8h,99h,dfh,f9h,97h,aah,5fh,27h
+			db	44h,f6h,45h,0dh,13h,1ch,28h,a7h
+			db	2ch,eeh,1fh,66h,0bh,bbh,5dh,5fh
+			db	7fh,76h,5ch,44h,9bh,66h,bah,6fh
+			db	58h,8eh,2dh,6dh,e4h,9fh,68h,c2h
+			db	a3h,b4h,e3h,b0h,8ch,d9h,d2h,87h
+			db	d6h,6bh,41h,92h,fdh,2dh,deh,b8h
+			db	40h,d4h,46h,88h,e1h,d8h,84h,4bh
+			db	79h,64h,59h,5bh,98h,5ah,3fh,d9h
+			db	e9h,30h,9ch,b0h,62h,26h,0eh,53h
+			db	6eh,9fh,ach,adh,56h,d3h,8fh,fdh
+			db	38h,cdh,74h,b2h,a0h,d3h,65h,a1h
+			db	d6h,fch,c9h,19h,52h,afh,29h,30h
+			db	58h,b6h,51h,8ah,31h,27h,fbh,36h
+			db	a3h,aeh,2fh,1ch,74h,5eh,97h,6fh
+			db	5fh,75h,9ch,7ch,ach,e0h,3eh,53h
+			db	4fh,99h,a8h,10h,41h,96h,29h,88h
+			db	a3h,cdh,dch,ffh,9bh,25h,aah,75h
+			db	c2h,66h,d5h,b2h,a5h,dbh,52h,1ah
+			db	01h,edh,bch,b4h,f0h,78h,a5h,b7h
+			db	67h,cfh,61h,40h,f5h,e8h,55h,47h
+			db	55h,9ah,22h,62h,d7h,a2h,13h,31h
+			db	6bh,d2h,99h,7ch,bdh,a3h,12h,4dh
+			db	76h,60h,02h,a3h,8ch,31h,fch,71h
+			db	19h,56h,71h,62h,02h,75h,f6h,b7h
+			db	6eh,93h,c7h,88h,f0h,3bh,5bh,2dh
+			db	b9h,79h,8ch,e0h,d5h,51h,73h,e7h
+			db	b1h,c2h,8bh,93h,39h,6fh,9fh,f3h
+			db	3eh,1bh,37h,01h,73h,7bh,03h,fch
+			db	52h,fdh,bdh,5eh,90h,beh,8ah,bbh
+			db	58h,9eh,99h,e0h,44h,7eh,2eh,ddh
+			db	95h,c2h,19h,86h,42h,7dh,deh,25h
+			db	a8h,8ch,e7h,cbh,e6h,41h,81h,5bh
+			db	88h,f8h,dah,87h,1ah,64h,b7h,e7h
+			db	65h,95h,78h,47h,a6h,a3h,bch,66h
+			db	b2h,68h,cdh,f1h,b4h,09h,a9h,a0h
+			db	71h,2ah,41h,a7h,f0h,7eh,a9h,28h
+			db	88h,6dh,c7h,7dh,44h,9eh,65h,2dh
+			db	2bh,f2h,f6h,26h,84h,83h,28h,16h
+			db	ach,8ch,ffh,aeh,98h,45h,8fh,01h
+			db	d2h,f9h,bah,5ah,8ch,23h,e7h,7ah
+			db	d8h,d4h,afh,abh,09h,deh,d6h,7fh
+			db	10h,1eh,3bh,4dh,aah,f0h,0bh,11h
+			db	aah,a0h,f1h,59h,cah,92h,32h,74h
+			db	53h,2bh,67h,49h,72h,93h,b2h,50h
+			db	38h,6ch,ech,83h,22h,98h,95h,a7h
+			db	02h,5bh,c1h,cdh,4eh,c5h,14h,c7h
+			db	99h,8ch,12h,0ah,8ch,bfh,dch,d9h
+			db	a3h,d8h,a4h,05h,cch,5bh,dch,25h
+			db	80h,bbh,e0h,50h,44h,59h,c8h,4ch
+			db	d7h,7eh,55h,33h,e6h,62h,f5h,ach
+			db	23h,1dh,41h,d6h,29h,bch,9fh,61h
+			db	dah,39h,68h,7ch,29h,0bh,3bh,82h
+			db	40h,e6h,56h,61h,92h,f5h,03h,1dh
+			db	dch,e1h,6ah,cfh,21h,fbh,efh,18h
+			db	61h,6bh,29h,77h,25h,30h,dbh,89h
+			db	5fh,6ch,59h,e4h,9fh,89h,99h,beh
+			db	e8h,93h,b4h,f8h,4eh,e1h,65h,dch
+			db	7eh,94h,59h,b1h,50h,5bh,7fh,2ch
+			db	fbh,22h,03h,13h,64h,98h,1eh,7eh
+			db	1bh,27h,e8h,75h,c5h,f2h,bah,91h
+			db	08h,46h,34h,9ch,4eh,45h,20h,82h
+			db	33h,3bh,deh,66h,3eh,19h,7dh,38h
+			db	c5h,2dh,adh,94h,14h,c2h,95h,3fh
+			db	10h,72h,b7h,57h,a1h,fbh,d4h,3ah
+			db	c9h,1ah,cch,b1h,15h,f5h,c5h,28h
+			db	44h,dch,f6h,8ah,c2h,41h,edh,f2h
+			db	92h,c8h,19h,a7h,0bh,3eh,f2h,89h
+			db	4ch,34h,3eh,62h,a1h,cbh,a5h,07h
+			db	d2h,e0h,fdh,77h,e3h,35h,93h,65h
+			db	63h,fch,fbh,1fh,95h,9dh,fah,73h
+			db	5ah,36h,4fh,dbh,a9h,a3h,fdh,f9h
+			db	65h,eeh,fch,90h,94h,fch,32h,0ah
+			db	9eh,c9h,84h,62h,c9h,e6h,ach,bch
+			db	ebh,7bh,fdh,b7h,bch,b3h,58h,38h
+			db	a4h,01h,37h,a4h,cbh,01h,b7h,1bh
+			db	22h,21h,87h,bbh,98h,44h,24h,34h
+			db	4dh,75h,a3h,01h,14h,2eh,44h,f2h
+			db	1eh,63h,a1h,26h,95h,d4h,09h,4ch
+			db	0eh,6bh,0ah,deh,ach,75h,ech,09h
+			db	73h,25h,dah,dah,66h,a4h,13h,1ch
+			db	43h,f5h,d2h,4eh,5dh,5bh,1bh,63h
+			db	ebh,95h,49h,cch,28h,81h,7eh,fah
+			db	81h,87h,83h,ech,a2h,e7h,0ch,aah
+			db	89h,73h,e2h,02h,08h,65h,18h,f5h
+			db	8dh,61h,efh,86h,f5h,57h,fah,e9h
+			db	3eh,6eh,deh,39h,64h,10h,06h,69h
+			db	26h,65h,efh,2ch,00h,92h,18h,cfh
+			db	cfh,57h,ach,5ch,ech,deh,5eh,49h
+			db	95h,88h,61h,f3h,ddh,3eh,cch,71h
+			db	edh,fdh,44h,13h,f6h,e1h,adh,02h
+			db	c5h,6ah,a9h,fah,63h,55h,adh,ach
+			db	c2h,b9h,c0h,b4h,b1h,86h,8ah,c2h
+			db	e1h,19h,89h,30h,4ch,17h,01h,3bh
+			db	04h,99h,15h,feh,1eh,56h,1ch,84h
+			db	63h,64h,0ch,81h,c7h,f7h,54h,bdh
+			db	b0h,a3h,0dh,bbh,20h,aeh,0bh,52h
+			db	efh,9bh,44h,22h,19h,beh,a5h,47h
+			db	75h,dfh,76h,63h,34h,d1h,1ah,b9h
+			db	2fh,68h,13h,fch,e7h,36h,22h,c9h
+			db	7ch,4ah,a2h,10h,c4h,67h,1ch,beh
+			db	70h,d9h,82h,e6h,23h,4dh,11h,ebh
+			db	02h,3dh,e0h,81h,81h,ffh,b1h,a0h
+			db	d5h,ddh,56h,d6h,c1h,87h,0eh,95h
+			db	a1h,ach,b0h,47h,69h,c6h,09h,b0h
+			db	28h,3bh,44h,19h,90h,71h,03h,8dh
+			db	6bh,f9h,aeh,c3h,6dh,74h,c2h,83h
+			db	13h,f9h,6dh,c8h,8dh,2fh,b0h,83h
+			db	47h,71h,b4h,24h,c3h,d8h,32h,70h
+			db	d1h,2ah,a7h,55h,2fh,2ch,8eh,fdh
+			db	89h,0ch,28h,f8h,c3h,47h,06h,b6h
+			db	37h,f9h,86h,e9h,bah,7dh,c9h,10h
+			db	09h,ffh,88h,0dh,0fh,0dh,16h,51h
+			db	08h,aah,88h,11h,99h,30h,30h,4eh
+			db	b2h,14h,65h,f7h,4dh,f5h,87h,a2h
+			db	5fh,aah,64h,8bh,23h,58h,aah,dch
+			db	95h,c1h,cfh,d4h,d1h,c9h,86h,03h
+			db	5ch,eah,71h,65h,f6h,c1h,24h,d4h
+			db	81h,d2h,3fh,43h,00h,06h,ffh,3bh
+			db	c5h,b6h,98h,4dh,e0h,7eh,82h,84h
+			db	02h,9ah,99h,59h,52h,8bh,f2h,c6h
+			db	35h,9bh,dah,a8h,30h,f7h,e2h,a0h
+			db	10h,17h,e9h,5dh,ceh,61h,89h,3ch
+			db	4bh,60h,cbh,71h,b2h,29h,b1h,08h
+			db	4bh,27h,14h,cbh,e7h,24h,38h,e6h
+			db	4ah,0eh,88h,1bh,e6h,a2h,59h,88h
+			db	b0h,e8h,90h,3ah,21h,1ah,1ch,3dh
+			db	53h,19h,45h,e6h,23h,d7h,94h,82h
+			db	e7h,71h,5bh,5fh,5dh,3eh,8dh,8eh
+			db	d6h,2bh,c6h,b5h,feh,82h,39h,f8h
+			db	a1h,93h,80h,feh,82h,deh,e9h,20h
+			db	dch,19h,98h,80h,92h,79h,24h,4dh
+			db	dch,b5h,b1h,f0h,1fh,e3h,a7h,34h
+			db	97h,64h,68h,77h,dah,52h,f0h,54h
+			db	e3h,2fh,dah,c5h,1bh,5eh,d7h,c9h
+			db	51h,4bh,91h,a6h,dbh,aah,11h,89h
+			db	beh,fbh,27h,4ah,b3h,01h,2ch,51h
+			db	33h,23h,fbh,b4h,82h,d5h,d4h,e6h
+			db	64h,a4h,93h,abh,e4h,48h,f1h,b8h
+			db	6ch,74h,c4h,c6h,47h,fdh,e2h,c1h
+			db	deh,dch,38h,9ch,58h,84h,0ch,42h
+			db	f0h,46h,efh,4ch,3eh,33h,adh,8dh
+			db	99h,31h,4dh,6bh,e0h,f6h,07h,12h
+			db	9dh,29h,99h,23h,72h,6dh,a2h,7bh
+			db	67h,28h,e4h,4bh,61h,dbh,beh,15h
+			db	a4h,2dh,81h,53h,e0h,8bh,8ah,3bh
+			db	9ah,d2h,0ah,a5h,11h,cah,dah,54h
+			db	c5h,66h,97h,c7h,d0h,9dh,05h,39h
+			db	47h,e6h,d8h,38h,f0h,4fh,7fh,83h
+			db	76h,90h,e1h,f4h,d3h,8ah,50h,5bh
+			db	b1h,bah,95h,4eh,eah,fdh,31h,53h
+			db	e6h,b6h,9ch,bah,78h,5bh,18h,69h
+			db	5ch,36h,5eh,d7h,ech,cfh,6fh,ddh
+			db	65h,a0h,31h,f3h,6bh,16h,f2h,fbh
+			db	07h,2ch,bfh,c6h,a5h,f8h,e3h,d2h
+			db	d4h,e8h,66h,a2h,cch,75h,c0h,dah
+			db	c6h,50h,62h,51h,24h,95h,efh,3fh
+			db	56h,dah,0eh,cah,4ch,89h,c3h,43h
+			db	0ah,aeh,cch,0fh,80h,25h,afh,18h
+			db	f4h,96h,52h,4bh,e3h,34h,11h,a0h
+			db	91h,c9h,1eh,8fh,6bh,a3h,50h,6eh
+			db	78h,7fh,30h,41h,63h,fah,07h,e3h
+			db	3eh,28h,2ah,1ch,29h,b7h,e8h,83h
+			db	ach,8dh,85h,e0h,e0h,eah,8ch,30h
+			db	a3h,e4h,8bh,bdh,7dh,1eh,a5h,4dh
+			db	7bh,29h,05h,97h,31h,bah,11h,31h
+			db	67h,91h,09h,9ch,6ch,a7h,2bh,7eh
+			db	8dh,c0h,2ah,07h,adh,55h,b3h,9dh
+			db	ffh,60h,93h,29h,15h,41h,d7h,9fh
+			db	c7h,a6h,27h,b9h,b0h,3ah,f8h,88h
+			db	bch,62h,27h,1dh,59h,76h,2bh,0eh
+			db	9eh,c2h,76h,a9h,2ch,dah,a1h,c0h
+			db	f5h,bbh,b3h,ach,22h,96h,10h,0ah
+			db	40h,c4h,9bh,23h,a8h,19h,47h,d5h
+			db	c9h,26h,4ah,cch,4eh,8dh,3bh,4bh
+			db	b1h,dch,ech,08h,85h,d8h,2eh,83h
+			db	9ah,21h,70h,ech,75h,3bh,19h,a2h
+			db	25h,5bh,a3h,c4h,a0h,41h,c6h,27h
+			db	3fh,0bh,fbh,c6h,98h,b5h,b7h,bbh
+			db	18h,93h,1ch,ffh,adh,a3h,5fh,6ch
+			db	6dh,47h,e1h,46h,adh,8ah,f3h,34h
+			db	d8h,0bh,53h,9fh,56h,9bh,85h,70h
+			db	2bh,e1h,ffh,7bh,75h,52h,47h,02h
+			db	cbh,6eh,c8h,6ah,6fh,8dh,cfh,4bh
+			db	78h,53h,d3h,b8h,88h,38h,1dh,9bh
+			db	5dh,c2h,d9h,f0h,a7h,2eh,dbh,6fh
+			db	86h,92h,00h,a2h,46h,72h,22h,39h
+			db	c0h,b8h,70h,55h,3bh,11h,d3h,cbh
+			db	01h,55h,24h,5fh,6eh,7eh,60h,a1h
+			db	f1h,54h,a6h,7dh,b9h,46h,71h,a2h
+			db	4ah,dbh,c9h,b5h,12h,54h,6eh,40h
+			db	e8h,e7h,40h,4fh,cbh,a8h,16h,f6h
+			db	0ah,9bh,ach,c7h,57h,fah,46h,85h
+			db	4bh,dah,33h,0dh,afh,19h,e1h,8fh
+			db	b7h,ceh,e2h,5ah,31h,05h,36h,7fh
+			db	f5h,80h,2bh,26h,4ah,f0h,6fh,27h
+			db	70h,f9h,e8h,d9h,bah,afh,e5h,71h
+			db	6dh,33h,e3h,32h,63h,1eh,0bh,f2h
+			db	bah,b3h,51h,6ch,86h,6ch,bah,1eh
+			db	b3h,8dh,beh,c8h,f8h,9eh,c5h,67h
+			db	e1h,69h,7ch,d0h,0bh,83h,58h,b8h
+			db	86h,16h,35h,07h,a9h,1ah,02h,00h
+			db	0ah,38h,a8h,4ch,19h,4ch,dah,b6h
+			db	ebh,aah,eeh,8ch,0ch,e1h,80h,13h
+			db	8fh,bdh,b8h,d2h,0dh,06h,d9h,8eh
+			db	e7h,e4h,74h,55h,b5h,13h,cch,87h
+			db	16h,47h,7ch,13h,7fh,30h,5bh,68h
+			db	a5h,ceh,2ah,46h,7bh,72h,b8h,9dh
+			db	aeh,d0h,2fh,b4h,33h,1ch,1bh,4fh
+			db	bch,59h,96h,6fh,bbh,52h,f0h,94h
+			db	c6h,4bh,d7h,5eh,beh,c0h,17h,a0h
+			db	fdh,54h,6fh,2bh,76h,5ah,05h,e0h
+			db	ddh,9dh,67h,6ah,f5h,76h,70h,13h
+			db	ddh,04h,20h,59h,97h,9fh,54h,b4h
+			db	cah,1eh,b0h,17h,4bh,88h,85h,bdh
+			db	54h,0ah,d5h,2eh,24h,b9h,00h,f9h
+			db	68h,71h,04h,8ah,59h,7dh,ceh,3fh
+			db	cfh,96h,fbh,82h,a8h,08h,dbh,33h
+			db	44h,b1h,63h,a3h,77h,36h,21h,c2h
+			db	52h,52h,22h,62h,fbh,b9h,27h,41h
+			db	9eh,c9h,8ch,5fh,85h,23h,50h,0dh
+			db	54h,72h,f7h,d1h,90h,16h,dah,0fh
+			db	7ch,78h,92h,c5h,cdh,49h,cch,b7h
+			db	23h,9bh,49h,1eh,9ah,bch,78h,0fh
+			db	dch,ech,4ah,d6h,3dh,00h,0ch,42h
+			db	c4h,66h,16h,76h,9dh,b6h,2bh,8dh
+			db	e5h,79h,d1h,2fh,abh,e1h,7eh,c2h
+			db	06h,bah,81h,2ch,17h,61h,58h,e6h
+			db	2ch,58h,0bh,b1h,13h,cah,87h,f1h
+			db	48h,50h,0ah,42h,92h,77h,3ch,1ch
+			db	65h,43h,71h,80h,fch,9fh,f2h,8eh
+			db	32h,18h,44h,cah,44h,04h,f4h,0bh
+			db	8fh,c1h,b3h,feh,0ah,0eh,3eh,1bh
+			db	d1h,78h,1fh,a0h,6ch,6bh,41h,bfh
+			db	77h,14h,3bh,cah,4fh,1dh,c1h,9eh
+			db	88h,87h,5bh,edh,26h,37h,5ah,1fh
+			db	44h,7fh,c7h,82h,06h,d9h,27h,ach
+			db	efh,43h,67h,43h,28h,5bh,19h,42h
+			db	abh,28h,5dh,abh,01h,20h,39h,04h
+			db	62h,69h,3bh,d2h,17h,41h,f8h,06h
+			db	a9h,e8h,d3h,97h,47h,89h,cbh,2fh
+			db	1eh,aeh,70h,efh,70h,deh,31h,11h
+			db	2eh,6fh,f2h,0ch,22h,97h,f5h,c4h
+			db	dfh,64h,4dh,16h,afh,5fh,ffh,9dh
+			db	a1h,05h,b4h,cbh,8ch,b8h,aah,b5h
+			db	f3h,08h,e5h,36h,88h,0eh,74h,26h
+			db	7ah,52h,8ah,50h,42h,60h,e6h,10h
+			db	05h,7bh,cfh,cbh,f9h,7ch,2ch,fdh
+			db	7eh,2ah,9eh,f7h,58h,37h,7ah,3fh
+			db	86h,41h,a8h,00h,43h,a6h,01h,fbh
+			db	96h,feh,45h,b8h,4dh,0ch,58h,9fh
+			db	00h,86h,9bh,65h,c4h,5bh,69h,e5h
+			db	d2h,eah,3ah,73h,d0h,76h,abh,cbh
+			db	f6h,08h,a3h,9fh,15h,c4h,c6h,69h
+			db	75h,50h,31h,66h,05h,3fh,7bh,8fh
+			db	60h,a0h,2bh,2ch,9dh,1eh,e4h,beh
+			db	ach,a7h,85h,6eh,2ah,4fh,dah,73h
+			db	7bh,9fh,5eh,f4h,e9h,b4h,efh,c9h
+			db	35h,cah,28h,e9h,83h,a3h,65h,69h
+			db	43h,b8h,3ah,e0h,72h,74h,05h,18h
+			db	cbh,c8h,feh,08h,48h,d2h,0bh,b7h
+			db	1bh,f9h,bdh,59h,6eh,ceh,62h,a7h
+			db	8fh,c7h,f2h,99h,62h,e3h,b2h,05h
+			db	23h,c1h,edh,98h,52h,aah,84h,8ch
+			db	efh,35h,f4h,efh,7eh,e2h,10h,15h
+			db	aah,fbh,60h,6bh,b2h,cdh,5dh,5fh
+			db	dbh,17h,beh,99h,7bh,b8h,77h,87h
+			db	17h,fah,3fh,bdh,54h,dch,43h,cfh
+			db	44h,29h,0fh,30h,7bh,ceh,1bh,1bh
+			db	89h,10h,e5h,aah,11h,e2h,25h,22h
+			db	45h,ebh,74h,75h,63h,a9h,73h,5eh
+			db	e2h,2ch,b8h,8eh,6dh,b2h,92h,e5h
+			db	57h,fah,dah,37h,4bh,0ch,b3h,76h
+			db	1ah,8fh,c8h,bbh,41h,b8h,b8h,03h
+			db	20h,16h,a4h,dah,e8h,ech,13h,63h
+			db	5bh,4dh,0bh,73h,4ah,a9h,f6h,1bh
+			db	3ch,0ah,89h,e8h,17h,b0h,51h,59h
+			db	d6h,02h,20h,62h,1fh,15h,aeh,81h
+			db	d8h,41h,95h,c8h,a2h,91h,64h,f6h
+			db	b0h,29h,c9h,07h,9ch,2bh,fch,49h
+			db	99h,79h,8dh,47h,7ch,beh,21h,dah
+			db	bfh,beh,2ch,89h,1dh,4ah,71h,83h
+			db	edh,42h,90h,29h,bah,a0h,ffh,abh
+			db	aeh,24h,bfh,e6h,37h,7ch,bfh,ddh
+			db	7eh,41h,05h,dbh,85h,96h,93h,b6h
+			db	d1h,35h,cfh,5fh,9bh,a7h,f3h,20h
+			db	45h,e2h,efh,80h,98h,9bh,19h,b0h
+			db	cbh,d2h,50h,dfh,3bh,6dh,f7h,d0h
+			db	9fh,1bh,f5h,4eh,efh,0fh,48h,89h
+			db	92h,33h,e0h,29h,95h,a1h,64h,75h
+			db	74h,02h,06h,12h,1ah,02h,b5h,6eh
+			db	0dh,5dh,b5h,a9h,e0h,99h,b1h,51h
+			db	bfh,39h,1bh,42h,f5h,a5h,77h,1dh
+			db	0bh,a0h,45h,3ch,e6h,a9h,85h,b8h
+			db	a3h,65h,5eh,e1h,82h,77h,ceh,4fh
+			db	1ch,90h,30h,71h,7dh,8ah,40h,77h
+			db	63h,dfh,53h,45h,7fh,5ah,03h,bdh
+			db	e3h,e9h,7dh,f4h,25h,6eh,68h,38h
+			db	09h,f6h,98h,7dh,afh,78h,e3h,d7h
+			db	f2h,1ah,47h,bfh,1dh,85h,b7h,8bh
+			db	3bh,27h,bbh,2bh,31h,b2h,1dh,4bh
+			db	66h,96h,adh,fah,bch,42h,8dh,8ch
+			db	49h,e6h,f8h,d1h,5ch,3dh,ceh,5dh
+			db	15h,00h,a4h,9dh,09h,1ch,a9h,31h
+			db	c3h,0fh,8fh,5ah,0ch,c2h,44h,0bh
+			db	6fh,5ch,76h,f5h,f6h,0eh,c0h,69h
+			db	a9h,7dh,6dh,22h,b5h,20h,e0h,08h
+			db	24h,29h,02h,37h,2ah,b0h,e8h,d3h
+			db	4ah,f6h,2bh,d1h,cah,47h,67h,9ah
+			db	c0h,3bh,32h,dbh,85h,a6h,71h,efh
+			db	23h,20h,e7h,dah,abh,d4h,86h,a1h
+			db	c7h,eah,44h,c7h,9eh,33h,80h,02h
+			db	c6h,80h,d6h,f7h,90h,38h,bah,18h
+			db	dah,24h,09h,f1h,81h,e6h,b8h,a7h
+			db	32h,c1h,86h,9eh,57h,bch,dbh,deh
+			db	a9h,16h,63h,27h,57h,feh,34h,d7h
+			db	98h,61h,9eh,a1h,64h,62h,d0h,cch
+			db	9ah,3eh,3ah,45h,69h,0fh,fbh,7bh
+			db	aah,d2h,0eh,9bh,52h,99h,f1h,5ch
+			db	a9h,4ch,aeh,86h,43h,ach,f0h,7ch
+			db	5dh,68h,47h,10h,cbh,bah,2eh,c4h
+			db	29h,9ch,eeh,bbh,83h,1fh,00h,6ch
+			db	1bh,8eh,44h,cbh,b5h,08h,38h,8ah
+			db	efh,e6h,26h,20h,74h,0ch,2dh,26h
+			db	d9h,7fh,87h,eeh,a9h,8bh,03h,88h
+			db	0bh,56h,8fh,f7h,73h,beh,4dh,20h
+			db	07h,3ah,2eh,0eh,9ch,c0h,ffh,4eh
+			db	34h,a6h,f4h,90h,52h,83h,c8h,e2h
+			db	dch,efh,05h,aah,ddh,65h,0fh,9dh
+			db	9bh,eeh,3dh,32h,b6h,74h,4eh,cch
+			db	a2h,bch,d0h,4bh,9ah,5bh,e7h,33h
+			db	8ah,fah,21h,b6h,06h,2eh,38h,79h
+			db	d6h,d1h,8fh,93h,50h,d3h,f7h,23h
+			db	09h,a3h,6eh,beh,40h,b2h,2ch,00h
+			db	47h,c7h,9eh,6dh,ebh,57h,4eh,f4h
+			db	c6h,ech,d8h,ech,76h,ceh,e7h,7fh
+			db	aeh,a9h,c2h,93h,bbh,17h,52h,9dh
+			db	93h,0ch,1dh,1fh,1eh,43h,6dh,d6h
+			db	4dh,ech,c1h,d6h,98h,09h,ffh,f4h
+			db	85h,19h,c3h,7ah,43h,90h,8dh,edh
+			db	cah,a8h,71h,39h,98h,c0h,11h,6ch
+			db	25h,37h,8ch,5ah,a4h,74h,b1h,32h
+			db	4fh,5dh,e1h,6ah,5bh,98h,c4h,d9h
+			db	09h,13h,69h,f9h,aeh,96h,61h,95h
+			db	aeh,f5h,c6h,b4h,9eh,4bh,6bh,0bh
+			db	0ah,d8h,cdh,cfh,5fh,b8h,1ah,30h
+			db	c2h,c8h,23h,ffh,23h,52h,06h,8ch
+			db	f5h,39h,f4h,7fh,60h,ddh,43h,64h
+			db	05h,15h,81h,27h,89h,d5h,c5h,57h
+			db	f6h,66h,09h,adh,5fh,18h,2dh,aah
+			db	b7h,01h,e7h,10h,61h,53h,96h,22h
+			db	27h,10h,18h,8dh,37h,49h,29h,0eh
+			db	06h,a8h,fah,9bh,74h,29h,6dh,f7h
+			db	8bh,37h,d3h,adh,fbh,60h,52h,10h
+			db	c2h,0fh,8bh,e8h,dch,cfh,48h,b1h
+			db	94h,9eh,bah,73h,2eh,73h,a7h,f5h
+			db	55h,1eh,3fh,c7h,62h,7eh,31h,f0h
+			db	76h,6bh,1dh,f5h,ebh,35h,dbh,8bh
+			db	dah,d4h,a3h,cah,30h,88h,57h,e9h
+			db	dfh,0bh,c2h,8dh,81h,54h,76h,68h
+			db	a3h,9ch,16h,2eh,d7h,6dh,30h,4bh
+			db	26h,0fh,28h,7eh,81h,b5h,ceh,73h
+			db	88h,a1h,2ah,d4h,aeh,9fh,fbh,b9h
+			db	ffh,54h,89h,efh,d8h,b7h,12h,43h
+			db	3dh,a9h,65h,92h,beh,46h,8ah,a7h
+			db	68h,3bh,7fh,d6h,ebh,1bh,30h,82h
+			db	18h,07h,4ah,38h,c0h,9bh,a4h,4dh
+			db	d2h,39h,a5h,1ah,59h,11h,6ch,ech
+			db	57h,a4h,16h,fch,fch,b4h,16h,d4h
+			db	b4h,35h,fbh,00h,22h,84h,7fh,2dh
+			db	a7h,6ah,69h,25h,fch,8fh,99h,cch
+			db	1ch,8ch,c3h,29h,adh,15h,68h,5ch
+			db	d4h,5dh,15h,abh,d5h,64h,0bh,36h
+			db	92h,b7h,27h,ebh,0dh,4fh,93h,4dh
+			db	b6h,36h,8ah,0ah,38h,a3h,6ch,4dh
+			db	1bh,a6h,74h,d6h,c5h,ebh,46h,bbh
+			db	78h,3eh,69h,edh,9bh,5bh,a5h,5ch
+			db	59h,76h,5fh,a7h,19h,f2h,4ah,d9h
+			db	8ch,8ch,2ch,e2h,a4h,2fh,0dh,7bh
+			db	82h,b8h,bch,1bh,0ch,2bh,4eh,8bh
+			db	c8h,bdh,4bh,73h,1eh,07h,76h,3bh
+			db	3dh,1dh,05h,b0h,0dh,6fh,1eh,54h
+			db	6eh,efh,aah,c1h,9ah,5eh,55h,29h
+			db	66h,09h,0ch,15h,b4h,0fh,79h,86h
+			db	c3h,4ch,e7h,d8h,e7h,47h,9bh,88h
+			db	a4h,0eh,63h,9ch,5bh,f1h,04h,40h
+			db	cbh,28h,82h,a7h,f9h,e5h,48h,76h
+			db	f9h,54h,42h,b0h,a2h,aah,4bh,b6h
+			db	e6h,c1h,c3h,9ch,fch,c3h,ceh,eah
+			db	deh,f0h,2dh,24h,a7h,49h,bfh,6dh
+			db	00h,f0h,cah,6ch,5fh,91h,d6h,f6h
+			db	88h,c1h,10h,73h,82h,a4h,49h,2ah
+			db	5dh,41h,a3h,ech,b4h,9ch,21h,86h
+			db	43h,e5h,8dh,3dh,aeh,58h,95h,42h
+			db	9ah,1bh,2fh,fbh,4ah,c3h,a5h,d9h
+			db	57h,02h,98h,c2h,38h,96h,49h,17h
+			db	e2h,41h,56h,33h,4dh,56h,19h,6eh
+			db	8ch,6ch,f0h,deh,d7h,8ch,97h,9dh
+			db	d1h,feh,60h,97h,3ch,fdh,6ah,fch
+			db	f5h,d7h,aah,abh,8fh,b8h,50h,5dh
+			db	28h,5ch,4ah,3eh,61h,e4h,57h,2eh
+			db	8dh,3ch,f5h,aeh,a5h,50h,bch,c0h
+			db	c5h,8dh,feh,84h,64h,95h,3ch,5ah
+			db	2bh,65h,12h,8fh,6dh,5dh,b3h,ebh
+			db	15h,cah,1dh,88h,0eh,88h,39h,12h
+			db	1fh,d8h,35h,1eh,32h,0eh,04h,b6h
+			db	c4h,ech,7ah,80h,b3h,b9h,e8h,a7h
+			db	bbh,a1h,a6h,e0h,9eh,eeh,89h,25h
+			db	efh,f9h,8ch,dah,adh,24h,25h,e8h
+			db	9fh,e5h,a0h,95h,34h,c0h,f6h,96h
+			db	a7h,45h,7dh,beh,21h,60h,59h,62h
+			db	71h,23h,30h,7fh,a7h,4eh,b1h,99h
+			db	f3h,59h,c4h,a8h,a0h,38h,06h,6bh
+			db	ech,84h,60h,c5h,72h,e3h,4dh,f6h
+			db	a2h,dfh,e9h,c9h,cdh,09h,b8h,54h
+			db	21h,fbh,feh,f8h,7ah,6fh,1dh,63h
+			db	d7h,3bh,02h,95h,80h,c1h,76h,39h
+			db	b3h,6ah,77h,72h,34h,2ah,efh,fbh
+			db	ffh,aah,dah,a7h,d6h,53h,edh,c1h
+			db	14h,31h,c1h,39h,54h,6bh,75h,b2h
+			db	cfh,53h,41h,23h,4ah,bdh,44h,feh
+			db	f2h,33h,6bh,f2h,3eh,4dh,42h,eah
+			db	a6h,12h,24h,0fh,34h,30h,29h,4fh
+			db	3ch,a0h,9dh,04h,c7h,b8h,c0h,f5h
+			db	f7h,32h,11h,7fh,0ch,7fh,4eh,4fh
+			db	e2h,14h,2bh,4eh,10h,c4h,6fh,80h
+			db	45h,f4h,49h,82h,b0h,9dh,fah,1eh
+			db	d2h,2eh,5ch,54h,2bh,e5h,f4h,57h
+			db	6dh,e1h,22h,e2h,4dh,22h,e1h,6fh
+			db	47h,08h,f5h,68h,26h,49h,b0h,f2h
+			db	cfh,6ah,67h,68h,55h,3eh,95h,04h
+			db	25h,feh,8fh,37h,1bh,ach,66h,6fh
+			db	3eh,60h,8eh,5dh,afh,f3h,4bh,6dh
+			db	08h,78h,78h,f4h,d8h,d1h,17h,dbh
+			db	cbh,25h,93h,dah,9fh,65h,e1h,f7h
+			db	39h,3dh,32h,30h,2ah,19h,40h,b0h
+			db	75h,b9h,e0h,8bh,60h,afh,8fh,23h
+			db	88h,43h,32h,20h,7ah,67h,1ah,e3h
+			db	d2h,42h,bah,5bh,ddh,e1h,56h,16h
+			db	f8h,ceh,17h,4ah,15h,aah,19h,6dh
+			db	77h,d1h,49h,8eh,10h,dch,55h,6fh
+			db	3dh,3ch,d6h,46h,cfh,78h,19h,e7h
+			db	dch,dch,70h,d2h,46h,7ch,49h,72h
+			db	e2h,1bh,5dh,0bh,b5h,27h,a7h,f1h
+			db	dbh,aeh,2ah,58h,18h,a6h,4ah,f1h
+			db	51h,d6h,a0h,a5h,fdh,02h,d1h,2dh
+			db	deh,1dh,e4h,98h,91h,ceh,21h,c1h
+			db	2fh,01h,fdh,ech,4ch,ebh,abh,3fh
+			db	60h,19h,afh,24h,1fh,31h,f9h,9fh
+			db	f0h,50h,bah,edh,ddh,ceh,83h,c2h
+			db	f5h,20h,32h,72h,24h,04h,3ah,4eh
+			db	eah,5ch,85h,dch,11h,bfh,06h,7dh
+			db	d1h,f1h,05h,fah,6bh,21h,feh,e4h
+			db	4bh,92h,a6h,58h,fah,77h,38h,32h
+			db	c0h,81h,a4h,c5h,2fh,41h,0ch,8bh
+			db	e2h,bch,b7h,07h,07h,1ch,6ah,cah
+			db	67h,4eh,f0h,d7h,f2h,1fh,7fh,d4h
+			db	0eh,63h,50h,b6h,efh,e9h,41h,07h
+			db	66h,5bh,bbh,05h,2bh,5eh,a8h,b7h
+			db	d0h,c1h,fbh,b4h,c0h,56h,77h,a7h
+			db	cdh,66h,53h,74h,58h,24h,b3h,d4h
+			db	f3h,f1h,ceh,16h,ceh,d0h,feh,eeh
+			db	bbh,0ah,25h,29h,6bh,49h,e0h,02h
+			db	84h,85h,efh,46h,84h,4fh,e9h,82h
+			db	a8h,4bh,d2h,98h,a9h,7fh,42h,15h
+			db	79h,55h,d6h,2ch,59h,a4h,60h,7ch
+			db	8fh,20h,82h,72h,b4h,43h,16h,c4h
+			db	74h,25h,f8h,61h,18h,08h,24h,26h
+			db	54h,d9h,27h,51h,9bh,bdh,c7h,39h
+			db	feh,c9h,27h,c0h,94h,a7h,d7h,8fh
+			db	57h,6eh,dbh,03h,c8h,02h,23h,53h
+			db	cch,6dh,7ch,adh,c9h,ach,5dh,74h
+			db	e7h,b4h,1bh,bch,16h,9fh,f8h,40h
+			db	48h,a3h,48h,43h,92h,cah,5ah,7dh
+			db	50h,80h,aeh,f7h,83h,89h,d0h,9fh
+			db	bdh,25h,23h,aeh,63h,32h,99h,bfh
+			db	91h,3ch,6ah,d8h,e9h,bbh,82h,f3h
+			db	8bh,cfh,85h,dch,25h,ceh,7fh,23h
+			db	00h,d4h,8ah,60h,c2h,b3h,5bh,c2h
+			db	20h,16h,49h,4ch,50h,61h,27h,56h
+			db	95h,71h,3eh,24h,d2h,33h,44h,0ah
+			db	d5h,6dh,07h,0bh,2fh,67h,e1h,3dh
+			db	76h,87h,7eh,07h,26h,5bh,2ch,43h
+			db	0eh,ebh,f8h,43h,d9h,c7h,92h,65h
+			db	7fh,22h,9dh,43h,64h,58h,95h,40h
+			db	6fh,10h,46h,75h,1fh,b3h,59h,59h
+			db	1bh,88h,e7h,a0h,71h,dch,22h,deh
+			db	34h,9ch,d7h,d8h,eeh,7fh,e0h,82h
+			db	dch,cah,d8h,37h,35h,52h,90h,58h
+			db	31h,42h,5ch,a1h,79h,37h,64h,bch
+			db	f5h,abh,c0h,b6h,afh,70h,cdh,ceh
+			db	bch,6bh,d8h,95h,e8h,d0h,c5h,37h
+			db	06h,3ah,9eh,59h,ddh,76h,afh,7ah
+			db	d8h,84h,06h,d3h,1ah,93h,adh,8ch
+			db	1fh,72h,beh,6ah,83h,9bh,fdh,e7h
+			db	00h,92h,2dh,5bh,f4h,bah,42h,a3h
+			db	ddh,ebh,88h,2ah,4eh,36h,fch,2dh
+			db	4dh,b0h,d6h,6bh,abh,82h,fbh,9ch
+			db	8eh
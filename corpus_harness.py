@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# MSXDasm
+# Copyright (C) 1999-2025 Eduardo Aguiar
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the
+# Free Software Foundation; either version 2, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+# Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+"""Corpus throughput harness for msxdasm.
+
+Runs msxdasm once in batch mode over a directory of ROMs (or synthetic
+ROMs), generating all output formats, and records wall time, peak RSS, output
+bytes per format and the per-phase times reported by --stats-json. Results
+can be saved as a JSON baseline (saved on the first run); later runs fail if
+ROMs/second drop beyond a threshold. Outputs can also be compared against
+golden files (saved with --update-golden), so speedups cannot change results
+silently. The golden outputs of the synthetic ROMs are kept in corpus_golden/.
+
+Use: corpus_harness.py --msxdasm build/msxdasm [--roms DIR] [-d file.def]
+                       [-j JOBS] [--baseline FILE [--update-baseline]]
+                       [--golden DIR [--update-golden]] [--threshold 0.10]
+"""
+import argparse
+import filecmp
+import json
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+FORMATS = ('asm', 'lst')
+
+
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# Generate deterministic synthetic ROMs: random bytes with an 'AB' header and
+# an entry point, so navigation finds a mix of code and data
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+def generate_roms(path, count=16):
+    os.makedirs(path, exist_ok=True)
+    rng = random.Random(0x4d5358)
+
+    for i in range(count):
+        size = 0x4000 if i % 2 == 0 else 0x8000
+        data = bytearray(rng.getrandbits(8) for _ in range(size))
+        data[0:4] = b'AB\x10\x40'
+
+        with open(os.path.join(path, 'synthetic%02d.rom' % i), 'wb') as fp:
+            fp.write(data)
+
+
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# Run msxdasm once, returning wall time and peak RSS (KB). stderr goes to a
+# file, so a chatty run cannot block on a full pipe while we wait for it
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+def run_msxdasm(args, stderr_path):
+    with open(stderr_path, 'w+b') as stderr:
+        start = time.perf_counter()
+        proc = subprocess.Popen(args, stdout=subprocess.DEVNULL, stderr=stderr)
+        _, status, usage = os.wait4(proc.pid, 0)
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        elapsed = time.perf_counter() - start
+
+        if proc.returncode != 0:
+            stderr.seek(0)
+            raise RuntimeError('%s failed:\n%s' % (' '.join(args), stderr.read().decode(errors='replace')))
+
+    return elapsed, usage.ru_maxrss
+
+
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# Run corpus in batch mode, all ROMs and output formats in one msxdasm run
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+def run_corpus(msxdasm, rom_dir, rom_count, defs, jobs, work_dir, out_dir):
+    stats_path = os.path.join(work_dir, 'stats.json')
+    args = [msxdasm, '-b', rom_dir, '-O', out_dir, '-j', str(jobs), '--stats-json', stats_path]
+    args += [arg for path in defs for arg in ('-d', path)]
+    args += [arg for fmt in FORMATS for arg in ('-o', fmt)]
+
+    seconds, rss = run_msxdasm(args, os.path.join(work_dir, 'stderr.txt'))
+
+    with open(stats_path) as fp:
+        stats = json.load(fp)
+
+    output_bytes = {fmt: 0 for fmt in FORMATS}
+
+    for name in os.listdir(out_dir):
+        fmt = os.path.splitext(name)[1][1:]
+
+        if fmt in output_bytes:
+            output_bytes[fmt] += os.path.getsize(os.path.join(out_dir, name))
+
+    return {
+        'roms': rom_count,
+        'seconds': seconds,
+        'roms_per_second': rom_count / seconds if seconds else 0.0,
+        'peak_rss_kb': rss,
+        'output_bytes': output_bytes,
+        'phases': stats['phases'],
+    }
+
+
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# Compare outputs against golden files, including files missing on either side
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+def compare_golden(out_dir, golden_dir):
+    out_names = set(os.listdir(out_dir))
+    golden_names = set(os.listdir(golden_dir))
+    _, mismatch, _ = filecmp.cmpfiles(golden_dir, out_dir, sorted(out_names & golden_names), shallow=False)
+
+    for name in sorted(mismatch):
+        print('golden mismatch: %s' % name)
+
+    for name in sorted(golden_names - out_names):
+        print('golden missing: %s' % name)
+
+    for name in sorted(out_names - golden_names):
+        print('golden unexpected: %s' % name)
+
+    return not mismatch and out_names == golden_names
+
+
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# Main function
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+def main():
+    parser = argparse.ArgumentParser(description='msxdasm corpus throughput harness')
+    parser.add_argument('--msxdasm', required=True, help='msxdasm executable')
+    parser.add_argument('--roms', help='ROM directory (default = synthetic ROMs)')
+    parser.add_argument('-d', dest='defs', action='append', default=[], help='definition file, passed to msxdasm')
+    parser.add_argument('-j', dest='jobs', type=int, default=1, help='worker threads, passed to msxdasm (default = 1)')
+    parser.add_argument('--baseline', help='baseline JSON file')
+    parser.add_argument('--update-baseline', action='store_true', help='save results as baseline')
+    parser.add_argument('--golden', help='golden output directory')
+    parser.add_argument('--update-golden', action='store_true', help='save outputs as golden files')
+    parser.add_argument('--threshold', type=float, default=0.10, help='allowed throughput drop (default = 0.10)')
+    args = parser.parse_args()
+
+    work_dir = tempfile.mkdtemp(prefix='msxdasm_corpus.')
+
+    try:
+        rom_dir = args.roms
+
+        if not rom_dir:
+            rom_dir = os.path.join(work_dir, 'roms')
+            generate_roms(rom_dir)
+
+        rom_count = sum(1 for f in os.listdir(rom_dir) if f.lower().endswith('.rom'))
+
+        if not rom_count:
+            print('no .rom files in %s' % rom_dir)
+            return 1
+
+        out_dir = os.path.join(work_dir, 'out')
+        os.makedirs(out_dir)
+
+        result = run_corpus(args.msxdasm, rom_dir, rom_count, args.defs, args.jobs, work_dir, out_dir)
+        print(json.dumps(result, indent=2))
+
+        ok = True
+
+        # golden files
+        if args.golden and args.update_golden:
+            shutil.rmtree(args.golden, ignore_errors=True)
+            shutil.copytree(out_dir, args.golden)
+
+        elif args.golden and not os.path.isdir(args.golden):
+            print('golden directory %s not found (use --update-golden to create it)' % args.golden)
+            ok = False
+
+        elif args.golden:
+            ok = compare_golden(out_dir, args.golden) and ok
+
+        # baseline
+        if args.baseline and (args.update_baseline or not os.path.exists(args.baseline)):
+            with open(args.baseline, 'w') as fp:
+                json.dump(result, fp, indent=2)
+                fp.write('\n')
+
+        elif args.baseline:
+            with open(args.baseline) as fp:
+                baseline = json.load(fp)
+
+            minimum = baseline['roms_per_second'] * (1.0 - args.threshold)
+            print('ROMs/s: %.2f (baseline %.2f, minimum %.2f)' %
+                  (result['roms_per_second'], baseline['roms_per_second'], minimum))
+
+            if result['roms_per_second'] < minimum:
+                print('throughput regression')
+                ok = False
+
+        return 0 if ok else 1
+
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -17,732 +17,77 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "disassembler.hpp"
 #include "cartridge.hpp"
+#include "fingerprint_db.hpp"
+#include "instruction.hpp"
 #include "navigator.hpp"
+#include "opcode_table.hpp"
+#include "output_sink.hpp"
 #include "symbol_table.hpp"
-#include <cstring>
-#include <fstream>
+#include "trace.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
-#include <system_error>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
-#include <iostream>
-#include <iomanip>
-
 namespace
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief CB opcode operations
+//! \brief Hexadecimal digits
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static std::string CB_OP[] =
-{
-  "rlc",
-  "rrc",
-  "rl",
-  "rr",
-  "sla",
-  "sra",
-  "sll",
-  "srl"
-};
+static constexpr char HEX_DIGITS[] = "0123456789abcdef";
 
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief 8-bit registers
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static std::string REG8[] =
+//! \brief Cross reference type names, indexed by navigator::xref_type
+static constexpr std::string_view XREF_NAMES[] =
 {
-  "b",
-  "c",
-  "d",
-  "e",
-  "h",
-  "l",
-  "(hl)",
-  "a"
+  "call", "call cc", "jp", "jp cc", "djnz", "table", "dw"
 };
 
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief General opcode texts
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static std::vector <std::string> OPCODE_TEXT =
-{
-  "nop",
-  "ld\tbc,%word%",
-  "ld\t(bc),a",
-  "inc\tbc",
-  "inc\tb",
-  "dec\tb",
-  "ld\tb,%byte%",
-  "rlca",
-  "ex\taf,af'",
-  "add\thl,bc",
-  "ld\ta,(bc)",
-  "dec\tbc",
-  "inc\tc",
-  "dec\tc",
-  "ld\tc,%byte%",
-  "rla",
-  "djnz\t%reladdr%",
-  "ld\tde,%word%",
-  "ld\t(de),a",
-  "inc\tde",
-  "inc\td",
-  "dec\td",
-  "ld\td,%byte%",
-  "rrca",
-  "jr\t%reladdr%",
-  "add\thl,de",
-  "ld\ta,(de)",
-  "dec\tde",
-  "inc\te",
-  "dec\te",
-  "ld\te,%byte%",
-  "rra",
-  "jr\tnz,%reladdr%",
-  "ld\thl,%word%",
-  "ld\t(%addr%),hl",
-  "inc\thl",
-  "inc\th",
-  "dec\th",
-  "ld\th,%byte%",
-  "daa",
-  "jr\tz,%reladdr%",
-  "add\thl,hl",
-  "ld\thl,(%addr%)",
-  "dec\thl",
-  "inc\tl",
-  "dec\tl",
-  "ld\tl,%byte%",
-  "cpl",
-  "jr\tnc,%reladdr%",
-  "ld\tsp,%word%",
-  "ld\t(%addr%),a",
-  "inc\tsp",
-  "inc\t(hl)",
-  "dec\t(hl)",
-  "ld\t(hl),%byte%",
-  "scf",
-  "jr\tc,%reladdr%",
-  "add\thl,sp",
-  "ld\ta,(%addr%)",
-  "dec\tsp",
-  "inc\ta",
-  "dec\ta",
-  "ld\ta,%byte%",
-  "ccf",
-  "ld\tb,b",
-  "ld\tb,c",
-  "ld\tb,d",
-  "ld\tb,e",
-  "ld\tb,h",
-  "ld\tb,l",
-  "ld\tb,(hl)",
-  "ld\tb,a",
-  "ld\tc,b",
-  "ld\tc,c",
-  "ld\tc,d",
-  "ld\tc,e",
-  "ld\tc,h",
-  "ld\tc,l",
-  "ld\tc,(hl)",
-  "ld\tc,a",
-  "ld\td,b",
-  "ld\td,c",
-  "ld\td,d",
-  "ld\td,e",
-  "ld\td,h",
-  "ld\td,l",
-  "ld\td,(hl)",
-  "ld\td,a",
-  "ld\te,b",
-  "ld\te,c",
-  "ld\te,d",
-  "ld\te,e",
-  "ld\te,h",
-  "ld\te,l",
-  "ld\te,(hl)",
-  "ld\te,a",
-  "ld\th,b",
-  "ld\th,c",
-  "ld\th,d",
-  "ld\th,e",
-  "ld\th,h",
-  "ld\th,l",
-  "ld\th,(hl)",
-  "ld\th,a",
-  "ld\tl,b",
-  "ld\tl,c",
-  "ld\tl,d",
-  "ld\tl,e",
-  "ld\tl,h",
-  "ld\tl,l",
-  "ld\tl,(hl)",
-  "ld\tl,a",
-  "ld\t(hl),b",
-  "ld\t(hl),c",
-  "ld\t(hl),d",
-  "ld\t(hl),e",
-  "ld\t(hl),h",
-  "ld\t(hl),l",
-  "halt",
-  "ld\t(hl),a",
-  "ld\ta,b",
-  "ld\ta,c",
-  "ld\ta,d",
-  "ld\ta,e",
-  "ld\ta,h",
-  "ld\ta,l",
-  "ld\ta,(hl)",
-  "ld\ta,a",
-  "add\ta,b",
-  "add\ta,c",
-  "add\ta,d",
-  "add\ta,e",
-  "add\ta,h",
-  "add\ta,l",
-  "add\ta,(hl)",
-  "add\ta,a",
-  "adc\ta,b",
-  "adc\ta,c",
-  "adc\ta,d",
-  "adc\ta,e",
-  "adc\ta,h",
-  "adc\ta,l",
-  "adc\ta,(hl)",
-  "adc\ta,a",
-  "sub\tb",
-  "sub\tc",
-  "sub\td",
-  "sub\te",
-  "sub\th",
-  "sub\tl",
-  "sub\t(hl)",
-  "sub\ta",
-  "sbc\ta,b",
-  "sbc\ta,c",
-  "sbc\ta,d",
-  "sbc\ta,e",
-  "sbc\ta,h",
-  "sbc\ta,l",
-  "sbc\ta,(hl)",
-  "sbc\ta,a",
-  "and\tb",
-  "and\tc",
-  "and\td",
-  "and\te",
-  "and\th",
-  "and\tl",
-  "and\t(hl)",
-  "and\ta",
-  "xor\tb",
-  "xor\tc",
-  "xor\td",
-  "xor\te",
-  "xor\th",
-  "xor\tl",
-  "xor\t(hl)",
-  "xor\ta",
-  "or\tb",
-  "or\tc",
-  "or\td",
-  "or\te",
-  "or\th",
-  "or\tl",
-  "or\t(hl)",
-  "or\ta",
-  "cp\tb",
-  "cp\tc",
-  "cp\td",
-  "cp\te",
-  "cp\th",
-  "cp\tl",
-  "cp\t(hl)",
-  "cp\ta",
-  "ret\tnz",
-  "pop\tbc",
-  "jp\tnz,%addr%",
-  "jp\t%addr%",
-  "call\tnz,%addr%",
-  "push\tbc",
-  "add\ta,%byte%",
-  "rst\t00h",
-  "ret\tz",
-  "ret",
-  "jp\tz,%addr%",
-  "",
-  "call\tz,%addr%",
-  "call\t%addr%",
-  "adc\ta,%byte%",
-  "rst\t08h",
-  "ret\tnc",
-  "pop\tde",
-  "jp\tnc,%addr%",
-  "out\t(%byte%),a",
-  "call\tnc,%addr%",
-  "push\tde",
-  "sub\t%byte%",
-  "rst\t10h",
-  "ret\tc",
-  "exx",
-  "jp\tc,%addr%",
-  "in\ta,(%byte%)",
-  "call\tc,%addr%",
-  "",
-  "sbc\ta,%byte%",
-  "rst\t18h",
-  "ret\tpo",
-  "pop\thl",
-  "jp\tpo,%addr%",
-  "ex\t(sp),hl",
-  "call\tpo,%addr%",
-  "push\thl",
-  "and\t%byte%",
-  "rst\t20h",
-  "ret\tpe",
-  "jp\t(hl)",
-  "jp\tpe,%addr%",
-  "ex\tde,hl",
-  "call\tpe,%addr%",
-  "",
-  "xor\t%byte%",
-  "rst\t28h",
-  "ret\tp",
-  "pop\taf",
-  "jp\tp,%addr%",
-  "di",
-  "call\tp,%addr%",
-  "push\taf",
-  "or\t%byte%",
-  "rst\t30h",
-  "ret\tm",
-  "ld\tsp,hl",
-  "jp\tm,%addr%",
-  "ei",
-  "call\tm,%addr%",
-  "",
-  "cp\t%byte%",
-  "rst\t38h",
-};
+//! \brief Maximum number of cross references in a .lst line
+static constexpr std::size_t MAX_XREFS_PER_LINE = 8;
 
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief DD/FD xx opcode texts
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::vector <std::string> OPCODE_DDFD_TEXT =
-{
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "add\t%regw%,bc",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "add\t%regw%,de",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\t%regw%,%word%",
-  "ld\t(%addr%),%regw%",
-  "inc\t%regw%",
-  "inc\t%regw%h *",
-  "dec\t%regw%h *",
-  "ld\t%regw%,%byte%",
-  "nop (2x) *",
-  "nop (2x) *",
-  "add\t%regw%,%regw%",
-  "ld\t%regw%,(%addr%)",
-  "dec\t%regw%",
-  "inc\t%regw%l *",
-  "dec\t%regw%l *",
-  "ld\t%regw%l,%byte%",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "inc\t(%regw% + %byte%)",
-  "dec\t(%regw% + %byte%)",
-  "ld\t(%regw% + %byte%),%byte%",
-  "nop (2x) *",
-  "nop (2x) *",
-  "add\t%regw%,sp",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\tb,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\tc,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\td,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\te,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\th,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\tl,(%regw% + %byte%)",
-  "nop (2x) *",
-  "ld\t(%regw% + %byte%),b",
-  "ld\t(%regw% + %byte%),c",
-  "ld\t(%regw% + %byte%),d",
-  "ld\t(%regw% + %byte%),e",
-  "ld\t(%regw% + %byte%),h",
-  "ld\t(%regw% + %byte%),l",
-  "nop (2x) *",
-  "ld\t(%regw% + %byte%),a",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\ta,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "add\ta,%regw%h *",
-  "add\ta,%regw%l *",
-  "add\ta,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "adc\ta,%regw%h *",
-  "adc\ta,%regw%l *",
-  "adc\ta,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "sub\t%regw%h *",
-  "sub\t%regw%l *",
-  "sub\t(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "sbc\ta,%regw%h *",
-  "sbc\ta,%regw%l *",
-  "sbc\ta,(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "and\t%regw%h *",
-  "and\t%regw%l *",
-  "and\t(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "xor\t%regw%h *",
-  "xor\t%regw%l *",
-  "xor\t(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "or\t%regw%h *",
-  "or\t%regw%l *",
-  "or\t(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "cp\t%regw%h *",
-  "cp\t%regw%l *",
-  "cp\t(%regw% + %byte%)",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "pop\t%regw%",
-  "nop (2x) *",
-  "ex\t(sp),%regw%",
-  "nop (2x) *",
-  "push\t%regw%",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "jp\t%regw%",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ld\tsp,%regw%",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-};
+//! \brief Symbol lookups made by the current thread
+static thread_local std::uint64_t symbol_lookups = 0;
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief ED xx opcode texts
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::vector <std::string> OPCODE_ED_TEXT =
-{
-  "in\tb,(c)",          // 0x40
-  "out\t(c),b",
-  "sbc\thl,bc",
-  "ld\t(%addr%),bc",
-  "neg",
-  "ret\tn",
-  "im\t0",
-  "ld\ti,a",
-  "in\tc,(c)",
-  "out\t(c),c",
-  "adc\thl,bc",
-  "ld\tbc,(%addr%)",
-  "neg *",
-  "ret\ti *",
-  "im\t0/1 *",
-  "ld\tr,a",
-  "in\td,(c)",
-  "out\t(c),d",
-  "sbc\thl,de",
-  "ld\t(%addr%),de",
-  "neg *",
-  "ret\tn *",
-  "im\t1",
-  "ld\ta,i",
-  "in\te,(c)",
-  "out\t(c),e",
-  "adc\thl,de",
-  "ld\tde,(%addr%)",
-  "neg *",
-  "ret\ti *",
-  "im\t2",
-  "ld\ta,r",
-  "in\th,(c)",
-  "out\t(c),h",
-  "sbc\thl,hl",
-  "ld\t(%addr%),hl",
-  "neg *",
-  "ret\tn *",
-  "im\t0 *",
-  "rrd",
-  "in\tl,(c)",
-  "out\t(c),l",
-  "adc\thl,hl",
-  "ld\thl,(%addr%)",
-  "neg *",
-  "ret\ti *",
-  "im\t0/1 *",
-  "rld",
-  "in\t(hl),(c)",
-  "out\t(c),(hl)",
-  "sbc\thl,sp",
-  "ld\t(%addr%),sp",
-  "neg *",
-  "ret\tn *",
-  "im\t1 *",
-  "nop (2x) *",
-  "in\ta,(c)",
-  "out\t(c),a",
-  "adc\thl,sp",
-  "ld\tsp,(%addr%)",
-  "neg *",
-  "ret\ti *",
-  "im\t2 *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ldi",
-  "cpi",
-  "ini",
-  "outi",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ldd",
-  "cpd",
-  "ind",
-  "outd",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "ldir",
-  "cpir",
-  "inir",
-  "otir",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "lddr",
-  "cpdr",
-  "indr",
-  "otdr",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-  "nop (2x) *",
-};
+//! \brief Append uint8_t value in hexa
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+append_hex (std::string& text, std::uint8_t v)
+{
+  text += HEX_DIGITS[v >> 4];
+  text += HEX_DIGITS[v & 0x0f];
+}
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Convert uint8_t value to hexa
+//! \brief Append uint16_t value in hexa
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static std::string
-to_hex (std::uint8_t v)
+static void
+append_hex (std::string& text, std::uint16_t v)
 {
-  char buffer[4];
-  sprintf (buffer, "%02x", v);
-
-  return buffer;
+  append_hex (text, static_cast <std::uint8_t> (v >> 8));
+  append_hex (text, static_cast <std::uint8_t> (v));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Convert uint16_t value to hexa
+//! \brief Append uint8_t value in decimal
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static std::string
-to_hex (std::uint16_t v)
+static void
+append_dec (std::string& text, std::uint8_t v)
 {
-  char buffer[8];
-  sprintf (buffer, "%04x", v);
+  if (v >= 100)
+    text += static_cast <char> ('0' + v / 100);
+
+  if (v >= 10)
+    text += static_cast <char> ('0' + (v / 10) % 10);
 
-  return buffer;
+  text += static_cast <char> ('0' + v % 10);
 }
 
 } // namespace
@@ -797,34 +142,173 @@ public:
     cartridge_.set_exec_address (addr);
   }
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set number of threads used to render output
+  //! \param jobs Number of threads (0 = number of cores)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_jobs (unsigned int jobs)
+  {
+    jobs_ = jobs;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set analysis cache directory
+  //! \param path Directory path (empty = no cache)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_cache_dir (const std::string& path)
+  {
+    navigator_.set_cache_dir (path);
+  }
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  //! \brief Load symbol file (.def)
-  //! \param addr Address
-  //! \param label Label
+  //! \brief Load symbol file (.def) into definitions
+  //! \param path File path
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   void
   load_def (const std::string& path)
   {
-    symbols_.load_def (path);
+    defs_.load_def (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load built-in machine profile into definitions
+  //! \param name Profile name
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_profile (const std::string& name)
+  {
+    defs_.load_profile (name);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set shared definitions table
+  //! \param defs Symbol table (read-only, may be shared among disassemblers)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_definitions (const symbol_table& defs)
+  {
+    defs_ = defs;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load routine fingerprint file
+  //! \param path File path
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_fingerprints (const std::string& path)
+  {
+    fingerprints_.load (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set shared routine fingerprint database
+  //! \param db Fingerprint database (read-only, may be shared)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_fingerprints (const fingerprint_db& db)
+  {
+    fingerprints_ = db;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load code signature file
+  //! \param path File path
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_signatures (const std::string& path)
+  {
+    navigator_.load_signatures (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set shared code signature database
+  //! \param db Signature database (read-only, may be shared)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_signatures (const signature_db& db)
+  {
+    navigator_.set_signatures (db);
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   void add_entry_point (addr_type);
-  std::string get_opcode_text (addr_type) const;
-  std::string get_opcode_text_cb (addr_type) const;
-  std::string get_opcode_text_ddfd (addr_type) const;
-  std::string get_opcode_text_ed (addr_type) const;
-  std::string get_symbol (addr_type) const;
-  std::string format_opcode_text (const std::string&, addr_type, const std::string& = {}) const;
+  void add_symbol (addr_type, const std::string&, const std::string&);
+  bool get_symbol (addr_type, symbol_table::symbol&) const;
+  std::string_view get_label (addr_type) const;
+  instruction get_instruction (addr_type, std::vector <instruction>::const_iterator&) const;
+  void append_opcode_text (std::string&, const instruction&) const;
+  void append_symbol (std::string&, addr_type) const;
   void load_rom (const std::string&, addr_type);
+  void load_rom (int, addr_type);
+  void load_rom (const std::uint8_t *, std::size_t, addr_type);
   void navigate ();
+  void get_statistics (statistics&) const;
+  void name_routines ();
+  std::size_t learn_fingerprints (fingerprint_db&) const;
   void generate (const std::string&);
+  void generate (const std::vector <std::string>&);
+  void generate (int, const std::string&);
+  void generate (const write_callback&, const std::string&);
   void generate_asm_code (const std::string&);
   void generate_asm_listing (const std::string&);
 
 private:
+  //! \brief Output file format
+  enum output_format
+  {
+    OUTPUT_ASM,
+    OUTPUT_LST
+  };
+
+  //! \brief Output file being generated
+  struct output
+  {
+    output_format format;
+    std::unique_ptr <output_sink> sink;
+  };
+
+  //! \brief Address range chunk, rendered independently
+  struct chunk
+  {
+    addr_type addr = 0;
+    std::size_t lines = 0;
+    std::string asm_text;
+    std::string lst_text;
+    std::uint64_t symbol_lookups = 0;
+
+    //! \brief Outputs written while rendering, if set
+    std::vector <output> *outputs = nullptr;
+  };
+
+  //! \brief Minimum number of lines in a chunk
+  static constexpr std::size_t MIN_CHUNK_LINES = 1024;
+
+  //! \brief Text size that makes render_chunk write to the chunk outputs
+  static constexpr std::size_t CHUNK_WRITE_SIZE = 4096;
+
+  //! \brief Region cursor
+  using region_iterator = std::vector <navigator::region>::const_iterator;
+
+  //! \brief Cross reference cursor
+  using xref_iterator = std::vector <navigator::xref>::const_iterator;
+
+  //! \brief Maximum number of bytes in a DB line
+  static constexpr std::uint32_t MAX_DB_PER_LINE = 8;
+
+  static output_format get_output_format (const std::string&);
+  void add_header_symbols (addr_type);
+  std::uint32_t get_run (addr_type, region_iterator&) const;
+  addr_type get_next_line (addr_type, region_iterator&, std::vector <instruction>::const_iterator&) const;
+  void append_xrefs (std::string&, addr_type, xref_iterator&) const;
+  std::vector <chunk> split_chunks (unsigned int) const;
+  void render_chunk (chunk&, bool, bool) const;
+  static void write_chunk (chunk&, std::vector <output>&);
+  void generate_outputs (std::vector <output>&);
+
   //! \brief Cartridge object
   cartridge cartridge_;
 
@@ -833,6 +317,21 @@ private:
 
   //! \brief Symbol list
   symbol_table symbols_;
+
+  //! \brief Shared definitions, looked up before symbols_
+  symbol_table defs_;
+
+  //! \brief Routine fingerprints, used to name routines found
+  fingerprint_db fingerprints_;
+
+  //! \brief Number of threads used to render output (0 = number of cores)
+  unsigned int jobs_ = 1;
+
+  //! \brief Symbol lookups while generating output
+  std::uint64_t symbol_lookups_ = 0;
+
+  //! \brief Bytes written to output files
+  std::uint64_t output_bytes_ = 0;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -846,249 +345,343 @@ disassembler::impl::add_entry_point (addr_type addr)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get opcode text
-//! \param pc Address
-//! \return Opcode text
+//! \brief Add symbol, unless shared definitions already have one
+//! \param addr Address
+//! \param label Label
+//! \param comment Comment
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-disassembler::impl::get_opcode_text (addr_type pc) const
+void
+disassembler::impl::add_symbol (
+  addr_type addr,
+  const std::string& label,
+  const std::string& comment
+)
 {
-  std::string text;
-
-  std::uint8_t opcode = cartridge_.get_byte (pc);
-
-  switch (opcode)
-    {
-      case 0xcb: text = get_opcode_text_cb (pc); break;
-      case 0xed: text = get_opcode_text_ed (pc); break;
-      case 0xdd:
-      case 0xfd: text = get_opcode_text_ddfd (pc); break;
-      default:   text = format_opcode_text (OPCODE_TEXT[opcode], pc + 1);
-    }
-
-  return text;
+  if (!defs_.has_symbol (addr))
+    symbols_.add_symbol (addr, label, comment);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get symbol
-//! \param ref Address
-//! \return Symbol
+//! \brief Get symbol, from definitions or from symbols found
+//! \param addr Address
+//! \param sym Symbol, if found
+//! \return true if found, false otherwise
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-disassembler::impl::get_symbol (addr_type ref) const
+bool
+disassembler::impl::get_symbol (addr_type addr, symbol_table::symbol& sym) const
 {
-  std::string symbol;
+  ++symbol_lookups;
+  return defs_.get_symbol (addr, sym) || symbols_.get_symbol (addr, sym);
+}
 
-  if (symbols_.has_symbol (ref))
-    symbol = symbols_.get_label (ref);
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get symbol label
+//! \param addr Address
+//! \return Label, if found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string_view
+disassembler::impl::get_label (addr_type addr) const
+{
+  symbol_table::symbol sym;
+  get_symbol (addr, sym);
 
-  else if (navigator_.is_entry_point (ref))
-    symbol = 'L' + to_hex (ref);
-    
-  else
-    symbol = to_hex (ref) + 'h';
-    
-  return symbol;
+  return sym.label;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Format opcode text
-//! \param fmt_text Format string
+//! \brief Get decoded instruction
 //! \param pc Address
-//! \param regw Reg-16 name (either ix or iy)
-//! \return Opcode text
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-disassembler::impl::format_opcode_text (
-  const std::string& fmt_text,
+//! \param iter Cursor into navigator instructions, advanced as pc grows
+//! \return Decoded instruction
+//!
+//! Instructions are decoded once while navigating. Only addresses the
+//! navigator never decoded (overlapping code) are decoded here.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+instruction
+disassembler::impl::get_instruction (
   addr_type pc,
-  const std::string& regw
+  std::vector <instruction>::const_iterator& iter
 ) const
 {
-  std::string text;
+  const auto& instructions = navigator_.get_instructions ();
 
-  // replace %var% with corresponding values
-  std::size_t pos = 0;
-  std::size_t pct_pos = fmt_text.find ('%', pos);
+  while (iter != instructions.end () && iter->addr < pc)
+    ++iter;
 
-  while (pct_pos != std::string::npos)
-    {
-      text += fmt_text.substr (pos, pct_pos - pos);
-      auto end_pos = fmt_text.find ('%', pct_pos + 1);
+  if (iter != instructions.end () && iter->addr == pc)
+    return *iter;
 
-      std::string var = fmt_text.substr (pct_pos + 1, end_pos - pct_pos - 1);
+  return navigator_.decode (pc);
+}
 
-      if (var == "addr")
-        {
-          addr_type ref = cartridge_.get_word (pc);
-          text += get_symbol (ref);
-          pc += 2;
-        }
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append opcode text, running its pre-compiled format program
+//! \param text Text buffer
+//! \param insn Decoded instruction
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::append_opcode_text (std::string& text, const instruction& insn) const
+{
+  const auto& desc = get_opcode_descriptor (insn.prefix, insn.opcode);
+  const bool is_iy = (insn.prefix == instruction::PREFIX_FD || insn.prefix == instruction::PREFIX_FDCB);
+  std::uint16_t operand = insn.operand;
 
-      else if (var == "reladdr")
-        {
-          addr_type ref = cartridge_.get_offset (pc);
-          text += get_symbol (ref);
-          pc++;
-        }
+  for (std::uint8_t i = 0;i < desc.format.count;i++)
+    {
+      const auto& op = desc.format.ops[i];
 
-      else if (var == "byte")
+      switch (op.type)
         {
-          text += to_hex (cartridge_.get_byte (pc)) + 'h';
-          pc++;
+          case FORMAT_LITERAL:
+            text.append (desc.text.data () + op.offset, op.length);
+            break;
+
+          case FORMAT_BYTE:
+            append_hex (text, static_cast <std::uint8_t> (operand));
+            text += 'h';
+            operand >>= 8;
+            break;
+
+          case FORMAT_WORD:
+            append_hex (text, operand);
+            text += 'h';
+            break;
+
+          case FORMAT_ADDR:
+            append_symbol (text, operand);
+            break;
+
+          case FORMAT_RELADDR:
+            append_symbol (text, insn.target);
+            break;
+
+          case FORMAT_DISP:
+            append_dec (text, static_cast <std::uint8_t> (operand));
+            break;
+
+          case FORMAT_REGW:
+            text += is_iy ? "iy" : "ix";
+            break;
         }
+    }
+}
 
-      else if (var == "word")
-        {
-          text += to_hex (cartridge_.get_word (pc)) + 'h';
-          pc += 2;
-        }
-		
-	  else if (var == "regw")
-        text += regw;
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append symbol
+//! \param text Text buffer
+//! \param ref Address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::append_symbol (std::string& text, addr_type ref) const
+{
+  symbol_table::symbol sym;
+
+  if (get_symbol (ref, sym))
+    text += sym.label;
 
-      pos = end_pos + 1;
-      pct_pos = fmt_text.find ('%', pos);
+  else if (navigator_.is_entry_point (ref))
+    {
+      text += 'L';
+      append_hex (text, ref);
     }
 
-  // add last chars
-  text += fmt_text.substr (pos);
+  else
+    {
+      append_hex (text, ref);
+      text += 'h';
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load .rom file into memory
+//! \param path File path
+//! \param addr Start address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::load_rom (const std::string& path, addr_type addr)
+{
+  cartridge_.load_rom (path, addr);
+  add_header_symbols (addr);
+}
 
-  return text;
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load ROM data from file descriptor into memory
+//! \param fd File descriptor, read until end of file
+//! \param addr Start address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::load_rom (int fd, addr_type addr)
+{
+  cartridge_.load_rom (fd, addr);
+  add_header_symbols (addr);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get opcode text for CB opcode family
-//! \param pc Address
-//! \return Opcode text
+//! \brief Load ROM data from memory
+//! \param data ROM data
+//! \param siz Size in bytes
+//! \param addr Start address
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-disassembler::impl::get_opcode_text_cb (addr_type pc) const
+void
+disassembler::impl::load_rom (const std::uint8_t *data, std::size_t siz, addr_type addr)
 {
-  std::string text;
-  std::uint8_t opcode = cartridge_.get_byte (pc + 1);
-  std::uint8_t key = (opcode >> 6) & 3;
-  std::uint8_t op1 = (opcode >> 3) & 7;
-  std::uint8_t op2 = (opcode) & 7;
+  cartridge_.load_rom (data, siz, addr);
+  add_header_symbols (addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add symbols for cartridge header fields
+//! \param addr Start address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::add_header_symbols (addr_type addr)
+{
+  add_symbol (addr, "signtr", "cartridge signature = 'AB'");
+  add_symbol (addr + 2, "staddr", "start address value");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Navigate through code
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::navigate ()
+{
+  navigator_.navigate (cartridge_);
+
+  auto pc = cartridge_.get_exec_address ();
+  add_symbol (pc, "start", "execution starting point");
+
+  if (!fingerprints_.empty ())
+    name_routines ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters
+//! \param stats Statistics, counters added to
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::get_statistics (statistics& stats) const
+{
+  navigator_.get_statistics (stats);
+  stats.symbol_lookups += symbol_lookups_;
+  stats.output_bytes += output_bytes_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Name routines whose fingerprints are found in fingerprint database
+//!
+//! Routines already named by definitions are kept. Labels already used by
+//! definitions or by symbols found are skipped, and when many routines match
+//! the same label, only the first one is named, to keep labels unique.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::name_routines ()
+{
+  std::unordered_set <std::string> labels;
+
+  for (auto addr : defs_.get_addresses ())
+    labels.emplace (defs_.get_label (addr));
 
-  switch(key)
+  for (auto addr : symbols_.get_addresses ())
+    labels.emplace (symbols_.get_label (addr));
+
+  for (const auto& r : navigator_.get_routines ())
     {
-      case 0: text = CB_OP[op1] + '\t' + REG8[op2]; break;
-      case 1: text = "bit\t" + std::to_string (op1) + ',' + REG8[op2]; break;
-      case 2: text = "res\t" + std::to_string (op1) + ',' + REG8[op2]; break;
-      case 3: text = "set\t" + std::to_string (op1) + ',' + REG8[op2]; break;
-    }
+      symbol_table::symbol sym;
 
-  return text;
+      if (!defs_.has_symbol (r.addr) &&
+          fingerprints_.find (r.fingerprint, sym) &&
+          labels.emplace (sym.label).second)
+        symbols_.add_symbol (r.addr, sym.label, sym.comment);
+    }
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get opcode text for DD(FD) opcode family
-//! \param pc Address
-//! \return Opcode text
+//! \brief Add fingerprints of routines named by definitions to a database
+//! \param db Fingerprint database
+//! \return Number of routines found with names
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-disassembler::impl::get_opcode_text_ddfd (addr_type pc) const
+std::size_t
+disassembler::impl::learn_fingerprints (fingerprint_db& db) const
 {
-  std::string text;
+  std::size_t count = 0;
 
-  std::uint8_t opcode = cartridge_.get_byte (pc);
-  const std::string regw = (opcode == 0xdd) ? "ix" : "iy";
-  
-  if (cartridge_.get_byte (pc + 1) == 0xcb)
+  for (const auto& r : navigator_.get_routines ())
     {
-      std::uint8_t offset = cartridge_.get_byte (pc + 2);
-      std::uint8_t opcode = cartridge_.get_byte (pc + 3);
-      std::uint8_t op1 = (opcode >> 3) & 7;
-      std::uint8_t key = (opcode >> 6) & 3;
-      std::string addr = '(' + regw + " + " + std::to_string (offset) + ')';
+      symbol_table::symbol sym;
 
-      switch (key)
+      if (defs_.get_symbol (r.addr, sym))
         {
-          case 0: text = CB_OP[op1] + '\t' + addr; break;
-          case 1: text = "bit\t" + std::to_string (op1) + ',' + addr; break;
-          case 2: text = "res\t" + std::to_string (op1) + ',' + addr; break;
-          case 3: text = "set\t" + std::to_string (op1) + ',' + addr; break;
+          db.add (r.fingerprint, sym.label, sym.comment);
+          ++count;
         }
     }
 
-  else
-    {
-      const std::string fmt_text = OPCODE_DDFD_TEXT[cartridge_.get_byte (pc + 1)];
-      pc += 2;
-      text = format_opcode_text (fmt_text, pc, regw);
-    }
-    
-  return text;
+  return count;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Get opcode text for ED opcode family
-//! \param pc Address
-//! \return Opcode text
+//! \brief Generate output, according to file extension
+//! \param path File path
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
-disassembler::impl::get_opcode_text_ed (addr_type pc) const
+void
+disassembler::impl::generate (const std::string& path)
 {
-  std::string text;
-  std::uint8_t opcode = cartridge_.get_byte (pc + 1);
-  
-  if (opcode < 64 || opcode > 191)
-    text = "nop (2x) *";
-    
-  else
-    text = format_opcode_text (OPCODE_ED_TEXT[opcode - 64], pc + 2);
-    
-  return text;
+  generate (std::vector <std::string> {path});
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Load .rom file into memory
-//! \param path File path
-//! \param addr Start address
+//! \brief Generate many output files at once, according to file extensions
+//! \param paths File paths
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-disassembler::impl::load_rom (const std::string& path, addr_type addr)
+disassembler::impl::generate (const std::vector <std::string>& paths)
 {
-  cartridge_.load_rom (path, addr);
+  std::vector <output_format> formats;
 
-  symbols_.add_symbol (addr, "signtr", "cartridge signature = 'AB'");
-  symbols_.add_symbol (addr + 2, "staddr", "start address value");
+  for (const auto& path : paths)
+    {
+      auto pos = path.rfind ('.');
+      if (pos == std::string::npos)
+        throw std::invalid_argument ("Cannot determine output file format. File has no extension");
+
+      formats.push_back (get_output_format (path.substr (pos + 1)));
+    }
+
+  std::vector <output> outputs;
+
+  for (std::size_t i = 0;i < paths.size ();i++)
+    outputs.push_back ({formats[i], std::make_unique <output_sink> (paths[i])});
+
+  generate_outputs (outputs);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Navigate through code
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate output to an open file descriptor (e.g. stdout)
+//! \param fd File descriptor, not closed
+//! \param format Output format (asm, lst)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-disassembler::impl::navigate ()
+disassembler::impl::generate (int fd, const std::string& format)
 {
-  navigator_.navigate (cartridge_);
+  std::vector <output> outputs;
+  outputs.push_back ({get_output_format (format), std::make_unique <output_sink> (fd)});
 
-  auto pc = cartridge_.get_exec_address ();
-  symbols_.add_symbol (pc, "start", "execution starting point");
+  generate_outputs (outputs);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Generate output, according to file extension
-//! \param path File path
+//! \brief Generate output through a callback
+//! \param callback Function called with each block of output data
+//! \param format Output format (asm, lst)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-disassembler::impl::generate (const std::string& path)
+disassembler::impl::generate (const write_callback& callback, const std::string& format)
 {
-  auto pos = path.rfind ('.');
-  if (pos == std::string::npos)
-    throw std::invalid_argument ("Cannot determine output file format. File has no extension");
-
-  auto ext = path.substr (pos + 1);
-  
-  if (ext == "asm")
-    generate_asm_code (path);
-      
-  else if (ext == "lst")
-    generate_asm_listing (path);
-      
-  else
-    throw std::invalid_argument ("Invalid output file format");
+  std::vector <output> outputs;
+  outputs.push_back ({get_output_format (format), std::make_unique <output_sink> (callback)});
+
+  generate_outputs (outputs);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -1098,175 +691,497 @@ disassembler::impl::generate (const std::string& path)
 void
 disassembler::impl::generate_asm_code (const std::string& path)
 {
-  std::ofstream out (path);
-  if (!out)
-    throw std::system_error (errno, std::system_category (), "Failed to open file");
+  std::vector <output> outputs;
+  outputs.push_back ({OUTPUT_ASM, std::make_unique <output_sink> (path)});
 
-  addr_type start_addr = cartridge_.get_start_address ();
-  addr_type end_addr = cartridge_.get_end_address ();
-  addr_type pc = start_addr;
+  generate_outputs (outputs);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate .asm listing file, complete with addresses and opcodes
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::generate_asm_listing (const std::string& path)
+{
+  std::vector <output> outputs;
+  outputs.push_back ({OUTPUT_LST, std::make_unique <output_sink> (path)});
 
-  out << "\t\t\torg\t" << to_hex (start_addr) << 'h' << std::endl;
+  generate_outputs (outputs);
+}
 
-  while (pc <= end_addr)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get output format from its name (file extension)
+//! \param name Format name (asm, lst)
+//! \return Output format
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+disassembler::impl::output_format
+disassembler::impl::get_output_format (const std::string& name)
+{
+  if (name == "asm")
+    return OUTPUT_ASM;
+
+  else if (name == "lst")
+    return OUTPUT_LST;
+
+  throw std::invalid_argument ("Invalid output file format");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get memory run containing address
+//! \param pc Address
+//! \param region Region cursor, moved forward until it contains pc
+//! \return Number of bytes from pc to the end of the run
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint32_t
+disassembler::impl::get_run (addr_type pc, region_iterator& region) const
+{
+  while (std::uint32_t (region->addr) + region->size <= pc)
+    ++region;
+
+  return std::uint32_t (region->addr) + region->size - pc;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get next line address
+//! \param pc Line address
+//! \param region Region cursor
+//! \param iter Instruction cursor
+//! \return Address of the line following pc
+//!
+//! Mirrors how render_chunk advances through the address range, so chunks
+//! can start at any address returned by this function.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+disassembler::addr_type
+disassembler::impl::get_next_line (addr_type pc, region_iterator& region, std::vector <instruction>::const_iterator& iter) const
+{
+  auto run = get_run (pc, region);
+
+  switch (region->status)
     {
-      std::uint16_t ref = 0;
+      case navigator::STATUS_DB:
+        pc += std::min (run, MAX_DB_PER_LINE);
+        break;
 
-      if (symbols_.has_symbol (pc))
-        {
-          auto label = symbols_.get_label (pc);
-          auto comment = symbols_.get_comment (pc);
+      case navigator::STATUS_STRING:
+        pc += run;
+        break;
 
-          out << '\n' << label << ':';
+      case navigator::STATUS_DW:
+        pc += 2;
+        break;
 
-          if (!comment.empty ())
-            out << "\t\t\t\t\t\t; " << comment;
+      case navigator::STATUS_CODE:
+        pc += get_instruction (pc, iter).size;
+        break;
 
-          out << '\n';
-        }
+      default:
+        break;
+    }
 
-      out << "\t\t\t";
+  return pc;
+}
 
-      if (navigator_.is_db (pc))
-        {
-          out << "db\t" << to_hex (cartridge_.get_byte (pc)) << 'h';
-          pc++;
-          int i = 0;
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append cross reference lines, for references to an address
+//! \param text Text
+//! \param pc Target address
+//! \param xref Cross reference cursor, advanced past references to pc
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::append_xrefs (std::string& text, addr_type pc, xref_iterator& xref) const
+{
+  const auto end = navigator_.get_xrefs ().end ();
 
-          while (i < 7 && pc <= end_addr && navigator_.is_db (pc))
-            {
-              out << ',' << to_hex (cartridge_.get_byte (pc)) << 'h';
-              pc++;
-              i++;
-            }
-        }
+  while (xref != end && xref->target < pc)
+    ++xref;
 
-      else if (navigator_.is_string (pc))
-        {
-          out << "db\t\"";
+  std::size_t count = 0;
 
-          while (navigator_.is_string (pc))
-            {
-              out << cartridge_.get_byte (pc);
-              ++pc;
-            }
-            
-          out << '"';
-        }
-        
-      else if (navigator_.is_dw (pc))
+  for (;xref != end && xref->target == pc;++xref, ++count)
+    {
+      if (count % MAX_XREFS_PER_LINE == 0)
         {
-          ref = cartridge_.get_word (pc);
-          out << "dw\t" << symbols_.get_label (ref);
-          pc = pc + 2;
-        }
+          if (count)
+            text += '\n';
 
-      else if (navigator_.is_code (pc))
-        {
-          out << get_opcode_text (pc);
-          pc += navigator_.get_opcode_size (pc);
+          text += "\t\t\t; xref: ";
         }
 
-      out << '\n';
+      else
+        text += ", ";
+
+      append_hex (text, xref->source);
+      text += ' ';
+      text += XREF_NAMES[xref->type];
     }
 
-  out.close ();
+  if (count)
+    text += '\n';
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Generate .asm listing file, complete with addresses and opcodes
-//! \param path File path
+//! \brief Split address range into chunks, at line boundaries
+//! \param count Maximum number of chunks
+//! \return Chunks
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-void
-disassembler::impl::generate_asm_listing (const std::string& path)
+std::vector <disassembler::impl::chunk>
+disassembler::impl::split_chunks (unsigned int count) const
 {
-  std::ofstream out (path);
-  if (!out)
-    throw std::system_error (errno, std::system_category (), "Failed to open file");
-
   addr_type start_addr = cartridge_.get_start_address ();
   addr_type end_addr = cartridge_.get_end_address ();
-  addr_type pc = start_addr;
+  std::vector <chunk> chunks;
 
-  out << "\t\t\torg\t" << to_hex (start_addr) << 'h' << std::endl;
+  // Single chunk: no need to find line boundaries
+  if (count <= 1)
+    {
+      chunks.resize (1);
+      chunks[0].addr = start_addr;
+      chunks[0].lines = SIZE_MAX;
+      return chunks;
+    }
+
+  // Get line addresses
+  std::vector <addr_type> lines;
+  addr_type pc = start_addr;
+  auto region = navigator_.get_regions ().begin ();
+  auto iter = navigator_.get_instructions ().begin ();
 
   while (pc <= end_addr)
     {
-      std::uint16_t ref = 0;
+      lines.push_back (pc);
+      pc = get_next_line (pc, region, iter);
+    }
+
+  // Split lines evenly among chunks
+  std::size_t chunk_lines = std::max (MIN_CHUNK_LINES, (lines.size () + count - 1) / count);
+
+  for (std::size_t i = 0;i < lines.size ();i += chunk_lines)
+    {
+      chunk c;
+      c.addr = lines[i];
+      c.lines = std::min (chunk_lines, lines.size () - i);
+      chunks.push_back (std::move (c));
+    }
+
+  return chunks;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Render chunk text for the requested formats
+//! \param c Chunk
+//! \param with_asm Render .asm text
+//! \param with_lst Render .lst text
+//!
+//! Each line is formatted once into shared text, then appended to every
+//! format, with .lst text getting addresses and opcode bytes. Lines shared
+//! by both formats are "\t\t\t" + text in .asm and address + "\t\t\t" +
+//! text in .lst. If c.outputs is set, text is written to the outputs every
+//! CHUNK_WRITE_SIZE bytes instead of being kept in the chunk.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::render_chunk (chunk& c, bool with_asm, bool with_lst) const
+{
+  trace_span span ("disassembler::render_chunk");
+  addr_type end_addr = cartridge_.get_end_address ();
+  addr_type pc = c.addr;
+  std::size_t lines = c.lines;
+  std::string text;
+  const std::uint64_t lookups = symbol_lookups;
+
+  const auto& instructions = navigator_.get_instructions ();
+  auto iter = std::lower_bound (instructions.begin (), instructions.end (), pc,
+                                [] (const instruction& insn, addr_type addr) { return insn.addr < addr; });
+
+  const auto& regions = navigator_.get_regions ();
+  auto region = std::upper_bound (regions.begin (), regions.end (), pc,
+                                  [] (addr_type addr, const navigator::region& r) { return addr < r.addr; }) - 1;
+
+  const auto& xrefs = navigator_.get_xrefs ();
+  auto xref = std::lower_bound (xrefs.begin (), xrefs.end (), pc,
+                                [] (const navigator::xref& x, addr_type addr) { return x.target < addr; });
+
+  while (lines > 0 && pc <= end_addr)
+    {
+      if (c.outputs && c.asm_text.size () + c.lst_text.size () >= CHUNK_WRITE_SIZE)
+        write_chunk (c, *c.outputs);
+
+      const addr_type addr = pc;
+      lines--;
 
-      if (symbols_.has_symbol (pc))
+      // label line
+      symbol_table::symbol sym;
+
+      if (get_symbol (pc, sym))
         {
-          auto label = symbols_.get_label (pc);
-          auto comment = symbols_.get_comment (pc);
+          text.clear ();
+          text += '\n';
+          text += sym.label;
+          text += ':';
+
+          if (!sym.comment.empty ())
+            {
+              text += "\t\t\t\t\t\t; ";
+              text += sym.comment;
+            }
 
-          out << '\n' << label << ':';
+          text += '\n';
 
-          if (!comment.empty ())
-            out << "\t\t\t\t\t\t; " << comment;
+          if (with_asm)
+            c.asm_text += text;
 
-          out << '\n';
+          if (with_lst)
+            {
+              c.lst_text += text;
+              append_xrefs (c.lst_text, pc, xref);
+            }
         }
 
-      else if (navigator_.is_entry_point (pc))
+      else if (with_lst && navigator_.is_entry_point (pc))
         {
-          out << "\nL" << to_hex (pc) << ':' << '\n';
+          c.lst_text += "\nL";
+          append_hex (c.lst_text, pc);
+          c.lst_text += ":\n";
+          append_xrefs (c.lst_text, pc, xref);
         }
 
-      out << to_hex (pc) << '\t';
+      text.clear ();
 
-      if (navigator_.is_db (pc))
+      // data and code lines
+      const auto run = get_run (pc, region);
+      const auto status = region->status;
+
+      if (status == navigator::STATUS_DB)
         {
-          out << "\t\tdb\t" << to_hex (cartridge_.get_byte (pc)) << 'h';
-          pc++;
-          int i = 0;
+          const auto count = std::min (run, MAX_DB_PER_LINE);
+
+          text += "\t\t\tdb\t";
 
-          while (i < 7 && pc <= end_addr && navigator_.is_db (pc))
+          for (std::uint32_t i = 0;i < count;i++)
             {
-              out << ',' << to_hex (cartridge_.get_byte (pc)) << 'h';
+              if (i)
+                text += ',';
+
+              append_hex (text, cartridge_.get_byte (pc));
+              text += 'h';
               pc++;
-              i++;
             }
+
+          text += '\n';
         }
 
-      else if (navigator_.is_string (pc))
+      else if (status == navigator::STATUS_STRING)
         {
-          out << "\t\tdb\t\"";
+          text += "\t\t\tdb\t\"";
 
-          while (navigator_.is_string (pc))
+          for (std::uint32_t i = 0;i < run;i++)
             {
-              out << cartridge_.get_byte (pc);
+              text += static_cast <char> (cartridge_.get_byte (pc));
               ++pc;
             }
-            
-          out << '"';
+
+          text += "\"\n";
         }
-        
-      else if (navigator_.is_dw (pc))
+
+      else if (status == navigator::STATUS_DW)
         {
-          ref = cartridge_.get_word (pc);
-          out << to_hex (cartridge_.get_byte (pc)) << ' ' << to_hex (cartridge_.get_byte (pc + 1))
-              << "\t\tdw\t" << get_symbol (ref);
+          const addr_type ref = cartridge_.get_word (pc);
+
+          if (with_asm)
+            {
+              c.asm_text += "\t\t\tdw\t";
+              c.asm_text += get_label (ref);
+              c.asm_text += '\n';
+            }
+
+          if (with_lst)
+            {
+              append_hex (c.lst_text, pc);
+              c.lst_text += '\t';
+              append_hex (c.lst_text, cartridge_.get_byte (pc));
+              c.lst_text += ' ';
+              append_hex (c.lst_text, cartridge_.get_byte (pc + 1));
+              c.lst_text += "\t\tdw\t";
+              append_symbol (c.lst_text, ref);
+              c.lst_text += '\n';
+            }
+
           pc += 2;
+          continue;
+        }
+
+      else if (status == navigator::STATUS_CODE)
+        {
+          const instruction insn = get_instruction (pc, iter);
+          append_opcode_text (text, insn);
+          text += '\n';
+
+          if (with_asm)
+            {
+              c.asm_text += "\t\t\t";
+              c.asm_text += text;
+            }
+
+          if (with_lst)
+            {
+              append_hex (c.lst_text, pc);
+              c.lst_text += '\t';
+
+              for (std::uint16_t i = 0;i < insn.size;i++)
+                {
+                  append_hex (c.lst_text, cartridge_.get_byte (pc + i));
+                  c.lst_text += ' ';
+                }
+
+              for (std::uint16_t i = insn.size; i < 4;i++)
+                c.lst_text += "   ";
+
+              c.lst_text += '\t';
+              c.lst_text += text;
+            }
+
+          pc += insn.size;
+          continue;
+        }
+
+      else
+        {
+          if (with_asm)
+            c.asm_text += "\t\t\t\n";
+
+          if (with_lst)
+            {
+              append_hex (c.lst_text, pc);
+              c.lst_text += "\t\n";
+            }
+
+          continue;
+        }
+
+      if (with_asm)
+        c.asm_text += text;
+
+      if (with_lst)
+        {
+          append_hex (c.lst_text, addr);
+          c.lst_text += text;
         }
+    }
+
+  if (c.outputs)
+    write_chunk (c, *c.outputs);
+
+  c.symbol_lookups = symbol_lookups - lookups;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Write chunk text to outputs, clearing it
+//! \param c Chunk
+//! \param outputs Output files
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::write_chunk (chunk& c, std::vector <output>& outputs)
+{
+  for (auto& o : outputs)
+    o.sink->write (o.format == OUTPUT_ASM ? c.asm_text : c.lst_text);
+
+  c.asm_text.clear ();
+  c.lst_text.clear ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate output files, walking the address range only once
+//! \param outputs Output files
+//!
+//! The address range is split into chunks, rendered in parallel by up to
+//! jobs_ threads, and written in address order, so output does not depend
+//! on the number of threads. Each chunk is written and freed as soon as it
+//! and all chunks before it are rendered. A single chunk is rendered
+//! straight into the output buffers.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::impl::generate_outputs (std::vector <output>& outputs)
+{
+  bool with_asm = false;
+  bool with_lst = false;
+
+  for (const auto& o : outputs)
+    {
+      if (o.format == OUTPUT_ASM)
+        with_asm = true;
+      else
+        with_lst = true;
+    }
 
-      else if (navigator_.is_code (pc))
+  for (auto& o : outputs)
+    {
+      o.sink->write ("\t\t\torg\t");
+      o.sink->put_hex (cartridge_.get_start_address ());
+      o.sink->write ("h\n");
+    }
+
+  // Render chunks
+  unsigned int jobs = jobs_ ? jobs_ : std::max (1u, std::thread::hardware_concurrency ());
+  auto chunks = split_chunks (jobs);
+
+  if (chunks.size () == 1)
+    {
+      chunks[0].outputs = &outputs;
+      render_chunk (chunks[0], with_asm, with_lst);
+      symbol_lookups_ += chunks[0].symbol_lookups;
+    }
+
+  else
+    {
+      std::vector <std::thread> threads;
+      std::vector <char> done (chunks.size (), 0);
+      std::mutex done_mutex;
+      std::condition_variable done_cv;
+      const auto rom = get_trace_rom ();
+
+      for (std::size_t i = 0;i < chunks.size ();i++)
+        threads.emplace_back ([this, &chunks, &done, &done_mutex, &done_cv, i, with_asm, with_lst, rom]
         {
-          auto siz = navigator_.get_opcode_size (pc);
+          set_trace_rom (rom);
+          render_chunk (chunks[i], with_asm, with_lst);
 
-          for (std::uint16_t i = 0;i < siz;i++)
-            out << to_hex (cartridge_.get_byte (pc + i)) << ' ';
+          std::lock_guard <std::mutex> lock (done_mutex);
+          done[i] = 1;
+          done_cv.notify_one ();
+        });
 
-          for (std::uint16_t i = siz; i < 4;i++)
-            out << "   ";
+      // Write chunks in address order, as they are rendered
+      try
+        {
+          for (std::size_t i = 0;i < chunks.size ();i++)
+            {
+              {
+                std::unique_lock <std::mutex> lock (done_mutex);
+                done_cv.wait (lock, [&done, i] { return done[i] != 0; });
+              }
+
+              symbol_lookups_ += chunks[i].symbol_lookups;
+              write_chunk (chunks[i], outputs);
+              chunks[i] = chunk ();
+            }
+        }
+      catch (...)
+        {
+          for (auto& t : threads)
+            t.join ();
 
-          out << '\t' << get_opcode_text (pc);
-          pc += navigator_.get_opcode_size (pc);
+          throw;
         }
 
-      out << '\n';
+      for (auto& t : threads)
+        t.join ();
     }
 
-  out.close ();
+  for (auto& o : outputs)
+    {
+      o.sink->close ();
+      output_bytes_ += o.sink->get_bytes_written ();
+    }
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -1314,6 +1229,29 @@ disassembler::set_exec_address (addr_type addr)
   impl_->set_exec_address (addr);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set number of threads used to render output
+//! \param jobs Number of threads (0 = number of cores)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::set_jobs (unsigned int jobs)
+{
+  impl_->set_jobs (jobs);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set analysis cache directory
+//! \param path Directory path (empty = no cache)
+//!
+//! When set, navigation results are loaded from this directory if the ROM,
+//! addresses and entry points match a previous run, and saved otherwise.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::set_cache_dir (const std::string& path)
+{
+  impl_->set_cache_dir (path);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Add entry point
 //! \param addr Address
@@ -1334,7 +1272,28 @@ disassembler::load_rom (const std::string& path, addr_type addr)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Load .def file
+//! \brief Load ROM data from file descriptor (e.g. STDIN_FILENO)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::load_rom (int fd, addr_type addr)
+{
+  impl_->load_rom (fd, addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load ROM data from memory
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::load_rom (const std::uint8_t *data, std::size_t siz, addr_type addr)
+{
+  impl_->load_rom (data, siz, addr);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load .def file into definitions table
+//! \param path File path
+//!
+//! Not to be used with a table shared through set_definitions.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 disassembler::load_def (const std::string& path)
@@ -1342,6 +1301,92 @@ disassembler::load_def (const std::string& path)
   impl_->load_def (path);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load built-in machine profile into definitions table
+//! \param name Profile name (msx1, msx2, msx2+, turbor)
+//!
+//! Not to be used with a table shared through set_definitions.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::load_profile (const std::string& name)
+{
+  impl_->load_profile (name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set shared definitions table
+//! \param defs Symbol table
+//!
+//! The table is shared, not copied, so several disassemblers can use the
+//! same definitions. It must not be modified while they are in use.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::set_definitions (const symbol_table& defs)
+{
+  impl_->set_definitions (defs);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load routine fingerprint file, to name routines while navigating
+//! \param path File path
+//!
+//! Not to be used with a database shared through set_fingerprints.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::load_fingerprints (const std::string& path)
+{
+  impl_->load_fingerprints (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set shared routine fingerprint database
+//! \param db Fingerprint database
+//!
+//! The database is shared, not copied. It must not be modified while in use.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::set_fingerprints (const fingerprint_db& db)
+{
+  impl_->set_fingerprints (db);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add fingerprints of routines named by definitions to a database
+//! \param db Fingerprint database
+//! \return Number of routines found with names
+//!
+//! Must be called after navigate.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+disassembler::learn_fingerprints (fingerprint_db& db) const
+{
+  return impl_->learn_fingerprints (db);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load code signature file, adding to built-in signatures
+//! \param path File path
+//!
+//! Not to be used with a database shared through set_signatures.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::load_signatures (const std::string& path)
+{
+  impl_->load_signatures (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set shared code signature database
+//! \param db Signature database
+//!
+//! The database is shared, not copied. It must not be modified while in use.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::set_signatures (const signature_db& db)
+{
+  impl_->set_signatures (db);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Generate output file
 //! \param path File path
@@ -1352,6 +1397,49 @@ disassembler::generate (const std::string& path)
   impl_->generate (path);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate many output files at once, according to file extensions
+//! \param paths File paths
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::generate (const std::vector <std::string>& paths)
+{
+  impl_->generate (paths);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate output to an open file descriptor
+//! \param fd File descriptor (e.g. STDOUT_FILENO), not closed
+//! \param format Output format (asm, lst)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::generate (int fd, const std::string& format)
+{
+  impl_->generate (fd, format);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate output into memory
+//! \param text String output is appended to
+//! \param format Output format (asm, lst)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::generate (std::string& text, const std::string& format)
+{
+  impl_->generate ([&text] (const char *data, std::size_t size) { text.append (data, size); }, format);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate output through a callback
+//! \param callback Function called with each block of output data, in order
+//! \param format Output format (asm, lst)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::generate (const write_callback& callback, const std::string& format)
+{
+  impl_->generate (callback, format);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Generate .asm listing file, complete with addresses and opcodes
 //! \param path File path
@@ -1381,4 +1469,14 @@ disassembler::navigate ()
   impl_->navigate ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counters (navigation, symbol lookups, output bytes)
+//! \param stats Statistics, counters added to
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+disassembler::get_statistics (statistics& stats) const
+{
+  impl_->get_statistics (stats);
+}
+
 } // namespace msxdasm
\ No newline at end of file
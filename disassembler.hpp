@@ -18,9 +18,15 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "fingerprint_db.hpp"
+#include "signature_db.hpp"
+#include "statistics.hpp"
+#include "symbol_table.hpp"
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace msxdasm
 {
@@ -45,6 +51,9 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   using addr_type = std::uint16_t;
 
+  //! \brief Output callback, called with each block of output data
+  using write_callback = std::function <void (const char *, std::size_t)>;
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -65,11 +74,27 @@ public:
   addr_type get_end_address () const;
   addr_type get_exec_address () const;
   void set_exec_address (addr_type);
+  void set_jobs (unsigned int);
+  void set_cache_dir (const std::string&);
   void add_entry_point (addr_type);
   void load_rom (const std::string&, addr_type);
+  void load_rom (int, addr_type);
+  void load_rom (const std::uint8_t *, std::size_t, addr_type);
   void load_def (const std::string&);
+  void load_profile (const std::string&);
+  void set_definitions (const symbol_table&);
+  void load_fingerprints (const std::string&);
+  void set_fingerprints (const fingerprint_db&);
+  std::size_t learn_fingerprints (fingerprint_db&) const;
+  void load_signatures (const std::string&);
+  void set_signatures (const signature_db&);
   void navigate ();
+  void get_statistics (statistics&) const;
   void generate (const std::string&);
+  void generate (const std::vector <std::string>&);
+  void generate (int, const std::string&);
+  void generate (std::string&, const std::string&);
+  void generate (const write_callback&, const std::string&);
   void generate_asm_code (const std::string&);
   void generate_asm_listing (const std::string&);
 };
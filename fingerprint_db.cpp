@@ -0,0 +1,290 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "fingerprint_db.hpp"
+#include "output_sink.hpp"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+//! \brief Blank characters, used as field separators
+static constexpr std::string_view BLANKS = " \t\r\f\v";
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Fingerprint database implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class fingerprint_db::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl () = default;
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of fingerprints
+  //! \return Number of fingerprints
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  size () const
+  {
+    return entries_.size ();
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bool find (std::uint64_t, symbol_table::symbol&) const;
+  void add (std::uint64_t, std::string_view, std::string_view);
+  void load (const std::string&);
+  void save (const std::string&) const;
+
+private:
+  //! \brief Database entry
+  struct entry
+  {
+    std::string label;
+    std::string comment;
+  };
+
+  //! \brief Entries, by fingerprint
+  std::unordered_map <std::uint64_t, entry> entries_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Find fingerprint
+//! \param fingerprint Routine fingerprint
+//! \param sym Symbol, if found
+//! \return true if found, false otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+fingerprint_db::impl::find (std::uint64_t fingerprint, symbol_table::symbol& sym) const
+{
+  auto iter = entries_.find (fingerprint);
+
+  if (iter == entries_.end ())
+    return false;
+
+  sym.label = iter->second.label;
+  sym.comment = iter->second.comment;
+
+  return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add fingerprint, if not already in database
+//! \param fingerprint Routine fingerprint
+//! \param label Label
+//! \param comment Comment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+fingerprint_db::impl::add (std::uint64_t fingerprint, std::string_view label, std::string_view comment)
+{
+  if (label.empty () || label.find_first_of (BLANKS) != std::string_view::npos)
+    throw std::invalid_argument ("invalid fingerprint label '" + std::string (label) + "'");
+
+  entries_.emplace (fingerprint, entry {std::string (label), std::string (comment)});
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load fingerprint file
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+fingerprint_db::impl::load (const std::string& path)
+{
+  std::ifstream fp (path);
+
+  if (!fp)
+    throw std::runtime_error ("Failed to open " + path);
+
+  std::string text;
+  std::size_t lineno = 0;
+
+  while (std::getline (fp, text))
+    {
+      ++lineno;
+      std::string_view line (text);
+
+      auto pos = line.find_first_not_of (BLANKS);
+      if (pos == std::string_view::npos || line[pos] == ';' || line[pos] == '#')
+        continue;
+
+      line.remove_prefix (pos);
+      pos = std::min (line.find_first_of (BLANKS), line.size ());
+      const std::string_view token = line.substr (0, pos);
+
+      std::uint64_t fingerprint = 0;
+      auto [ptr, ec] = std::from_chars (token.data (), token.data () + token.size (), fingerprint, 16);
+
+      if (ec != std::errc () || ptr != token.data () + token.size ())
+        throw std::runtime_error (path + ':' + std::to_string (lineno) + ": invalid fingerprint '" + std::string (token) + "'");
+
+      line.remove_prefix (pos);
+      pos = line.find_first_not_of (BLANKS);
+
+      if (pos == std::string_view::npos)
+        throw std::runtime_error (path + ':' + std::to_string (lineno) + ": missing label");
+
+      line.remove_prefix (pos);
+      pos = std::min (line.find_first_of (BLANKS), line.size ());
+      const std::string_view label = line.substr (0, pos);
+
+      line.remove_prefix (pos);
+      pos = line.find_first_not_of (BLANKS);
+      std::string_view comment;
+
+      if (pos != std::string_view::npos)
+        {
+          comment = line.substr (pos);
+          comment.remove_suffix (comment.size () - comment.find_last_not_of (BLANKS) - 1);
+        }
+
+      add (fingerprint, label, comment);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save fingerprint file, sorted by fingerprint
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+fingerprint_db::impl::save (const std::string& path) const
+{
+  std::vector <std::uint64_t> keys;
+  keys.reserve (entries_.size ());
+
+  for (const auto& [fingerprint, e] : entries_)
+    keys.push_back (fingerprint);
+
+  std::sort (keys.begin (), keys.end ());
+
+  output_sink out (path);
+
+  for (auto fingerprint : keys)
+    {
+      const auto& e = entries_.at (fingerprint);
+
+      out.put_hex (static_cast <std::uint16_t> (fingerprint >> 48));
+      out.put_hex (static_cast <std::uint16_t> (fingerprint >> 32));
+      out.put_hex (static_cast <std::uint16_t> (fingerprint >> 16));
+      out.put_hex (static_cast <std::uint16_t> (fingerprint));
+      out.put (' ');
+      out.write (e.label);
+
+      if (!e.comment.empty ())
+        {
+          out.put (' ');
+          out.write (e.comment);
+        }
+
+      out.put ('\n');
+    }
+
+  out.close ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+fingerprint_db::fingerprint_db ()
+  : impl_ (std::make_shared <impl> ())
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if database is empty
+//! \return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+fingerprint_db::empty () const
+{
+  return impl_->size () == 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of fingerprints
+//! \return Number of fingerprints
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+fingerprint_db::size () const
+{
+  return impl_->size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Find fingerprint
+//! \param fingerprint Routine fingerprint
+//! \param sym Symbol, if found (valid while database is alive)
+//! \return true if found, false otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+fingerprint_db::find (std::uint64_t fingerprint, symbol_table::symbol& sym) const
+{
+  return impl_->find (fingerprint, sym);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add fingerprint, if not already in database
+//! \param fingerprint Routine fingerprint
+//! \param label Label
+//! \param comment Comment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+fingerprint_db::add (std::uint64_t fingerprint, std::string_view label, std::string_view comment)
+{
+  impl_->add (fingerprint, label, comment);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load fingerprint file
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+fingerprint_db::load (const std::string& path)
+{
+  impl_->load (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save fingerprint file
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+fingerprint_db::save (const std::string& path) const
+{
+  impl_->save (path);
+}
+
+} // namespace msxdasm
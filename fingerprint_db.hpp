@@ -0,0 +1,74 @@
+#ifndef MSXDASM_FINGERPRINT_DB_HPP
+#define MSXDASM_FINGERPRINT_DB_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "symbol_table.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <memory>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Routine fingerprint database
+//!
+//! Maps routine fingerprints (see navigator::get_routines) to labels, so
+//! library routines labeled once can be named automatically in other ROMs.
+//! Files have one routine per line: a 16 digit hexadecimal fingerprint, a
+//! label and an optional comment, separated by blanks.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class fingerprint_db
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  fingerprint_db ();
+  fingerprint_db (const fingerprint_db&) = default;
+  fingerprint_db (fingerprint_db&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  fingerprint_db& operator= (const fingerprint_db&) = default;
+  fingerprint_db& operator= (fingerprint_db&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bool empty () const;
+  std::size_t size () const;
+  bool find (std::uint64_t, symbol_table::symbol&) const;
+  void add (std::uint64_t, std::string_view, std::string_view = {});
+  void load (const std::string&);
+  void save (const std::string&) const;
+
+private:
+  //! \brief Forward declaration
+  class impl;
+
+  //! \brief Smart pointer to implementation instance
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_FINGERPRINT_DB_HPP
@@ -0,0 +1,91 @@
+#ifndef MSXDASM_INSTRUCTION_HPP
+#define MSXDASM_INSTRUCTION_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstdint>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decoded instruction
+//!
+//! Built once by the navigator and consumed as is by the output stage, so
+//! opcodes are not decoded again while generating text.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct instruction
+{
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using addr_type = std::uint16_t;
+
+  //! \brief Opcode prefix family
+  enum prefix_type : std::uint8_t
+  {
+    PREFIX_NONE,
+    PREFIX_CB,
+    PREFIX_ED,
+    PREFIX_DD,
+    PREFIX_FD,
+    PREFIX_DDCB,
+    PREFIX_FDCB
+  };
+
+  //! \brief Control flow kind
+  enum flow_type : std::uint8_t
+  {
+    FLOW_NONE,
+    FLOW_CALL,                  // call xxxx
+    FLOW_COND_CALL,             // call cc,xxxx
+    FLOW_JUMP,                  // jp xxxx, jr xx
+    FLOW_COND_JUMP,             // jp cc,xxxx, jr cc,xx
+    FLOW_DJNZ,                  // djnz xx
+    FLOW_RETURN,                // ret
+    FLOW_COND_RETURN,           // ret cc
+    FLOW_JUMP_INDIRECT          // jp (hl), jp (ix), jp (iy)
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Data
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Instruction address
+  addr_type addr = 0;
+
+  //! \brief Operand bytes following the opcode, little endian
+  std::uint16_t operand = 0;
+
+  //! \brief Branch target, for relative and absolute jumps and calls
+  addr_type target = 0;
+
+  //! \brief Instruction size in bytes
+  std::uint8_t size = 0;
+
+  //! \brief Prefix family
+  prefix_type prefix = PREFIX_NONE;
+
+  //! \brief Opcode byte, after prefixes
+  std::uint8_t opcode = 0;
+
+  //! \brief Control flow kind
+  flow_type flow = FLOW_NONE;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_INSTRUCTION_HPP
@@ -0,0 +1,55 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "json.hpp"
+#include <cstdio>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append string as a quoted JSON string, escaping as needed
+//! \param text Text
+//! \param s String
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+append_json_string (std::string& text, std::string_view s)
+{
+  text += '"';
+
+  for (char c : s)
+    {
+      if (c == '"' || c == '\\')
+        {
+          text += '\\';
+          text += c;
+        }
+
+      else if (static_cast <unsigned char> (c) < 0x20)
+        {
+          char buffer[8];
+          snprintf (buffer, sizeof (buffer), "\\u%04x", c);
+          text += buffer;
+        }
+
+      else
+        text += c;
+    }
+
+  text += '"';
+}
+
+} // namespace msxdasm
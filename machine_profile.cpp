@@ -0,0 +1,301 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "machine_profile.hpp"
+#include <iterator>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief MSX1 BIOS entry points, system variables and hooks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr msxdasm::machine_symbol MSX1_SYMBOLS[] =
+{
+  {0x0000, "CHKRAM", "Tests RAM and sets RAM slot for the system"},
+  {0x0008, "SYNCHR", "Tests whether the character of (HL) is the specified character"},
+  {0x000c, "RDLST", "Reads the value of an address in another slot"},
+  {0x0010, "CHRGTR", "Gets the next character (or token) of the Basic text"},
+  {0x0014, "WRSLT", "Writes a value to an address in another slot"},
+  {0x0018, "OUTDO", "Output to current output channel (printer, file, etc.)"},
+  {0x001c, "CALSLT", "Executes inter-slot call"},
+  {0x0020, "DCOMPR", "Compares HL with DE"},
+  {0x0024, "ENALST", "Switches indicated slot at indicated page on perpetually"},
+  {0x0028, "GETYPR", "Returns Type of DAC"},
+  {0x0030, "CALLF", "Executes an interslot call"},
+  {0x0038, "KEYINT", "Executes the timer interrupt process routine"},
+  {0x003b, "INITIO", "Initialises the device"},
+  {0x003e, "INIFNK", "Initialises the contents of the function keys"},
+  {0x0041, "DISSCR", "Inhibits the screen display"},
+  {0x0044, "ENASCR", "Displays the screen"},
+  {0x0047, "WRTVDP", "Write data in the VDP-register"},
+  {0x004a, "RDVRM", "Reads the content of VRAM"},
+  {0x004d, "WRTVRM", "Writes data in VRAM"},
+  {0x0050, "SETRD", "Enable VDP to read"},
+  {0x0053, "SETWRT", "Enable VDP to write"},
+  {0x0056, "FILVRM", "Fill VRAM with value"},
+  {0x0059, "LDIRMV", "Block transfer to memory from VRAM"},
+  {0x005c, "LDIRVM", "Block transfer to VRAM from memory"},
+  {0x005f, "CHGMOD", "Switches to given screen mode"},
+  {0x0062, "CHGCLR", "Changes the screen colors"},
+  {0x0066, "NMI", "Executes non-maskable interupt handling routine"},
+  {0x0069, "CLRSPR", "Initialises all sprites"},
+  {0x006c, "INITXT", "Switches to SCREEN 0 (text screen with 40×24 characters)"},
+  {0x006f, "INIT32", "Switches to SCREEN 1 (text screen with 32×24 characters)"},
+  {0x0072, "INIGRP", "Switches to SCREEN 2 (high resolution screen with 256×192 pixels)"},
+  {0x0075, "INIMLT", "Switches to SCREEN 3 (multi-color screen with 64×48 pixels)"},
+  {0x0078, "SETTXT", "Switches VDP to SCREEN 0 mode"},
+  {0x007b, "SETT32", "Switches VDP to SCREEN 1 mode"},
+  {0x007e, "SETGRP", "Switches VDP to SCREEN 2 mode"},
+  {0x0081, "SETMLT", "Switches VDP to SCREEN 3 mode"},
+  {0x0084, "CALPAT", "Returns the address of the sprite pattern table"},
+  {0x0087, "CALATR", "Returns the address of the sprite attribute table"},
+  {0x008a, "GSPSIZ", "Returns current sprite size"},
+  {0x008d, "GRPPRT", "Displays a character on the graphic screen"},
+  {0x0090, "GICINI", "Initialises PSG and sets initial value for the PLAY statement"},
+  {0x0093, "WRTPSG", "Writes data to PSG register"},
+  {0x0096, "RDPSG", "Reads value from PSG register"},
+  {0x0099, "STRTMS", "Tests whether the PLAY statement is being executed as a background task. If not, begins to execute the PLAY statement"},
+  {0x009c, "CHSNS", "Tests the status of the keyboard buffer"},
+  {0x009f, "CHGET", "One character input (waiting)"},
+  {0x00a2, "CHPUT", "Displays one character"},
+  {0x00a5, "LPTOUT", "Sends one character to printer"},
+  {0x00a8, "LPTSTT", "Tests printer status"},
+  {0x00ab, "CNVCHR", "Tests for the graphic header and transforms the code"},
+  {0x00ae, "PINLIN", "Stores in the specified buffer the character codes input until the return key or STOP key is pressed"},
+  {0x00b1, "INLIN", "Same as PINLIN except that AUGFLG (#F6AA) is set"},
+  {0x00b4, "QINLIN", "Prints a question mark and one space"},
+  {0x00b7, "BREAKX", "Tests status of CTRL-STOP"},
+  {0x00ba, "ISCNTC", "Tests status of SHIFT-STOP"},
+  {0x00bd, "CKCNTC", "Same as ISCNTC. used in Basic"},
+  {0x00c0, "BEEP", "Generates beep"},
+  {0x00c3, "CLS", "Clears the screen"},
+  {0x00c6, "POSIT", "Moves cursor to the specified position"},
+  {0x00c9, "FNKSB", "Tests whether the function key display is active"},
+  {0x00cc, "ERAFNK", "Erase functionkey display"},
+  {0x00cf, "DSPFNK", "Displays the function keys"},
+  {0x00d2, "TOTEXT", "Forces the screen to be in the text mode"},
+  {0x00d5, "GTSTCK", "Returns the joystick status"},
+  {0x00d8, "GTTRIG", "Returns current trigger status"},
+  {0x00db, "GTPAD", "Returns current touch pad status"},
+  {0x00de, "GTPDL", "Returns current value of paddle"},
+  {0x00e1, "TAPION", "Reads the header block after turning the cassette motor on"},
+  {0x00e4, "TAPIN", "Read data from the tape"},
+  {0x00e7, "TAPIOF", "Stops reading from the tape"},
+  {0x00ea, "TAPOON", "Turns on the cassette motor and writes the header"},
+  {0x00ed, "TAPOUT", "Writes data on the tape"},
+  {0x00f0, "TAPOOF", "Stops writing on the tape"},
+  {0x00f3, "STMOTR", "Sets the cassette motor action"},
+  {0x00f6, "LFTQ", "Gives number of bytes in queue"},
+  {0x00f9, "PUTQ", "Put byte in queue"},
+  {0x00fc, "RIGHTC", "Shifts screen pixel to the right"},
+  {0x00ff, "LEFTC", "Shifts screen pixel to the left"},
+  {0x0102, "UPC", "Shifts screen pixel up"},
+  {0x0105, "TUPC", "Tests whether UPC is possible, if possible, execute UPC"},
+  {0x0108, "DOWNC", "Shifts screen pixel down"},
+  {0x010b, "TDOWNC", "Tests whether DOWNC is possible, if possible, execute DOWNC"},
+  {0x010e, "SCALXY", "Scales X and Y coordinates"},
+  {0x0111, "MAPXY", "Places cursor at current cursor address"},
+  {0x0114, "FETCHC", "Gets current cursor addresses mask pattern"},
+  {0x0117, "STOREC", "Record current cursor addresses mask pattern"},
+  {0x011a, "SETATR", "Set attribute byte"},
+  {0x011d, "READC", "Reads attribute byte of current screen pixel"},
+  {0x0120, "SETC", "Returns current screen pixel of specified attribute byte"},
+  {0x0123, "NSETCX", "Set horizontal screen pixels"},
+  {0x0126, "GTASPC", "Gets screen relations"},
+  {0x0129, "PNTINI", "Initalises the PAINT instruction"},
+  {0x012c, "SCANR", "Scans screen pixels to the right"},
+  {0x012f, "SCANL", "Scans screen pixels to the left"},
+  {0x0132, "CHGCAP", "Alternates the CAPS lamp status"},
+  {0x0135, "CHGSND", "Alternates the 1-bit sound port status"},
+  {0x0138, "RSLREG", "Reads the primary slot register"},
+  {0x013b, "WSLREG", "Writes value to the primary slot register"},
+  {0x013e, "RDVDP", "Reads VDP status register"},
+  {0x0141, "SNSMAT", "Returns the value of the specified line from the keyboard matrix"},
+  {0x0144, "PHYDIO", "Executes I/O for mass-storage media like disks"},
+  {0x0147, "FORMAT", "Initialises mass-storage media like formatting of disks"},
+  {0x014a, "ISFLIO", "Tests if I/O to device is taking place"},
+  {0x014d, "OUTDLP", "Printer output"},
+  {0x0150, "GETVCP", "Returns pointer to play queue"},
+  {0x0153, "GETVC2", "Returns pointer to variable in queue number VOICEN"},
+  {0x0156, "KILBUF", "Clear keyboard buffer"},
+  {0x0159, "CALBAS", "Executes inter-slot call to the routine in BASIC interpreter"},
+  {0xf380, "RDPRIM", "Routine to read from a primary slot"},
+  {0xf385, "WRPRIM", "Routine to write to a primary slot"},
+  {0xf38c, "CLPRIM", "Routine to call a primary slot"},
+  {0xf39a, "USRTAB", "Start addresses of USR functions"},
+  {0xf3ae, "LINL40", "Screen width in SCREEN 0"},
+  {0xf3af, "LINL32", "Screen width in SCREEN 1"},
+  {0xf3b0, "LINLEN", "Current screen width"},
+  {0xf3b1, "CRTCNT", "Number of lines on screen"},
+  {0xf3b2, "CLMLST", "Column space between PRINT items"},
+  {0xf3b3, "TXTNAM", "SCREEN 0 name table address"},
+  {0xf3b5, "TXTCOL", "SCREEN 0 color table address"},
+  {0xf3b7, "TXTCGP", "SCREEN 0 pattern generator table address"},
+  {0xf3b9, "TXTATR", "SCREEN 0 sprite attribute table address"},
+  {0xf3bb, "TXTPAT", "SCREEN 0 sprite pattern table address"},
+  {0xf3bd, "T32NAM", "SCREEN 1 name table address"},
+  {0xf3bf, "T32COL", "SCREEN 1 color table address"},
+  {0xf3c1, "T32CGP", "SCREEN 1 pattern generator table address"},
+  {0xf3c3, "T32ATR", "SCREEN 1 sprite attribute table address"},
+  {0xf3c5, "T32PAT", "SCREEN 1 sprite pattern table address"},
+  {0xf3c7, "GRPNAM", "SCREEN 2 name table address"},
+  {0xf3c9, "GRPCOL", "SCREEN 2 color table address"},
+  {0xf3cb, "GRPCGP", "SCREEN 2 pattern generator table address"},
+  {0xf3cd, "GRPATR", "SCREEN 2 sprite attribute table address"},
+  {0xf3cf, "GRPPAT", "SCREEN 2 sprite pattern table address"},
+  {0xf3d1, "MLTNAM", "SCREEN 3 name table address"},
+  {0xf3d3, "MLTCOL", "SCREEN 3 color table address"},
+  {0xf3d5, "MLTCGP", "SCREEN 3 pattern generator table address"},
+  {0xf3d7, "MLTATR", "SCREEN 3 sprite attribute table address"},
+  {0xf3d9, "MLTPAT", "SCREEN 3 sprite pattern table address"},
+  {0xf3db, "CLIKSW", "Key click switch (0 = off)"},
+  {0xf3dc, "CSRY", "Cursor Y position"},
+  {0xf3dd, "CSRX", "Cursor X position"},
+  {0xf3de, "CNSDFG", "Function key display switch (0 = off)"},
+  {0xf3df, "RG0SAV", "Copy of VDP register 0"},
+  {0xf3e0, "RG1SAV", "Copy of VDP register 1"},
+  {0xf3e1, "RG2SAV", "Copy of VDP register 2"},
+  {0xf3e2, "RG3SAV", "Copy of VDP register 3"},
+  {0xf3e3, "RG4SAV", "Copy of VDP register 4"},
+  {0xf3e4, "RG5SAV", "Copy of VDP register 5"},
+  {0xf3e5, "RG6SAV", "Copy of VDP register 6"},
+  {0xf3e6, "RG7SAV", "Copy of VDP register 7"},
+  {0xf3e7, "STATFL", "Copy of VDP status register 0"},
+  {0xf3e8, "TRGFLG", "Joystick trigger status"},
+  {0xf3e9, "FORCLR", "Foreground color"},
+  {0xf3ea, "BAKCLR", "Background color"},
+  {0xf3eb, "BDRCLR", "Border color"},
+  {0xf3f8, "PUTPNT", "Keyboard buffer write pointer"},
+  {0xf3fa, "GETPNT", "Keyboard buffer read pointer"},
+  {0xf41f, "KBUF", "Crunch buffer for BASIC lines"},
+  {0xf55e, "BUF", "Line input buffer"},
+  {0xfc48, "BOTTOM", "Lowest RAM address used by BASIC"},
+  {0xfc4a, "HIMEM", "Highest RAM address available to BASIC"},
+  {0xfc9e, "JIFFY", "Counter incremented on each VDP interrupt"},
+  {0xfcab, "CAPST", "CAPS LOCK status (0 = off)"},
+  {0xfcc1, "EXPTBL", "Slot expansion flags, one per primary slot"},
+  {0xfcc5, "SLTTBL", "Secondary slot register copies"},
+  {0xfcc9, "SLTATR", "Slot attributes, one per page"},
+  {0xfd09, "SLTWRK", "Slot work areas, two bytes per page"},
+  {0xfd89, "PROCNM", "Name of expanded statement or device"},
+  {0xfd99, "DEVICE", "Device number for cartridge devices"},
+  {0xfd9a, "HKEYI", ""},
+  {0xfd9b, "HKEYI2", "HKEYI+1"},
+  {0xfd9f, "HTIMI", "Timer interrupt hook"},
+  {0xfda4, "HCHPH", "CHPUT hook"},
+  {0xfda9, "HDSPC", "Cursor display hook"},
+  {0xfdae, "HERAC", "Cursor erase hook"},
+  {0xfdb3, "HDSPF", "DSPFNK hook"},
+  {0xfdb8, "HERAF", "ERAFNK hook"},
+  {0xfdbd, "HTOTE", "TOTEXT hook"},
+  {0xfdc2, "HCHGE", "CHGET hook"},
+  {0xfdc7, "HINIP", "Character pattern initialisation hook"},
+  {0xfdcc, "HKEYC", "Keyboard decoder hook"},
+  {0xfdd1, "HKYEA", "Keyboard decoder hook"},
+  {0xfdd6, "HNMI", "Non-maskable interrupt hook"},
+  {0xfeda, "HSTKE", "BASIC stack reset hook, used by ROMs to run at start up"},
+  {0xffa7, "HPHYD", "PHYDIO hook"},
+  {0xffac, "HFORM", "FORMAT hook"},
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief MSX2 additions
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr msxdasm::machine_symbol MSX2_SYMBOLS[] =
+{
+  {0x015c, "SUBROM", "Calls a routine in the SUB-ROM"},
+  {0x015f, "EXTROM", "Calls a routine in the SUB-ROM, via IX"},
+  {0x0165, "CHKNEW", "Tests whether the current screen mode is 5 or higher"},
+  {0x0168, "EOL", "Deletes to the end of the line"},
+  {0x016b, "BIGFIL", "Fills VRAM with value, for all screen modes"},
+  {0x016e, "NSETRD", "Enable VDP to read, with 128K VRAM address"},
+  {0x0171, "NSTWRT", "Enable VDP to write, with 128K VRAM address"},
+  {0x0174, "NRDVRM", "Reads the content of VRAM, with 128K VRAM address"},
+  {0x0177, "NWRVRM", "Writes data in VRAM, with 128K VRAM address"},
+  {0xfaf5, "DPPAGE", "Display page number"},
+  {0xfaf6, "ACPAGE", "Active page number"},
+  {0xfaf8, "EXBRSA", "SUB-ROM slot address"},
+  {0xfafc, "MODE", "VRAM size and screen mode flags"},
+  {0xffca, "EXTBIO", "Extended BIOS hook"},
+  {0xffe7, "RG8SAV", "Copy of VDP register 8"},
+  {0xffe8, "RG9SAV", "Copy of VDP register 9"},
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief MSX2+ additions
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr msxdasm::machine_symbol MSX2P_SYMBOLS[] =
+{
+  {0x017a, "RDRES", "Reads the reset status register"},
+  {0x017d, "WRRES", "Writes the reset status register"},
+  {0xfffa, "RG25SA", "Copy of VDP register 25"},
+  {0xfffb, "RG26SA", "Copy of VDP register 26"},
+  {0xfffc, "RG27SA", "Copy of VDP register 27"},
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief MSX turbo R additions
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr msxdasm::machine_symbol TURBOR_SYMBOLS[] =
+{
+  {0x0180, "CHGCPU", "Switches the CPU mode (Z80, R800 ROM, R800 DRAM)"},
+  {0x0183, "GETCPU", "Returns the current CPU mode"},
+  {0x0186, "PCMPLY", "Plays PCM data from memory or VRAM"},
+  {0x0189, "PCMREC", "Records PCM data into memory or VRAM"},
+};
+
+constexpr msxdasm::machine_profile MSX1_PROFILE =
+  {"msx1", MSX1_SYMBOLS, std::size (MSX1_SYMBOLS), nullptr};
+
+constexpr msxdasm::machine_profile MSX2_PROFILE =
+  {"msx2", MSX2_SYMBOLS, std::size (MSX2_SYMBOLS), &MSX1_PROFILE};
+
+constexpr msxdasm::machine_profile MSX2P_PROFILE =
+  {"msx2+", MSX2P_SYMBOLS, std::size (MSX2P_SYMBOLS), &MSX2_PROFILE};
+
+constexpr msxdasm::machine_profile TURBOR_PROFILE =
+  {"turbor", TURBOR_SYMBOLS, std::size (TURBOR_SYMBOLS), &MSX2P_PROFILE};
+
+//! \brief Built-in profiles
+constexpr const msxdasm::machine_profile *PROFILES[] =
+{
+  &MSX1_PROFILE,
+  &MSX2_PROFILE,
+  &MSX2P_PROFILE,
+  &TURBOR_PROFILE
+};
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Find built-in machine profile
+//! \param name Profile name (msx1, msx2, msx2+, turbor)
+//! \return Pointer to profile, or nullptr if not found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const machine_profile *
+find_machine_profile (std::string_view name)
+{
+  for (const auto *profile : PROFILES)
+    if (profile->name == name)
+      return profile;
+
+  return nullptr;
+}
+
+} // namespace msxdasm
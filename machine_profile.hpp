@@ -0,0 +1,55 @@
+#ifndef MSXDASM_MACHINE_PROFILE_HPP
+#define MSXDASM_MACHINE_PROFILE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Built-in symbol, for BIOS entry points, system variables and hooks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct machine_symbol
+{
+  std::uint16_t addr;
+  std::string_view label;
+  std::string_view comment;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Built-in machine profile
+//!
+//! Profiles are cumulative: each one adds its own symbols to the symbols of
+//! its base profile (e.g. MSX2 adds the MSX2 BIOS calls to the MSX1 ones).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct machine_profile
+{
+  std::string_view name;
+  const machine_symbol *symbols;
+  std::size_t count;
+  const machine_profile *base;
+};
+
+const machine_profile *find_machine_profile (std::string_view);
+
+} // namespace msxdasm
+
+#endif // MSXDASM_MACHINE_PROFILE_HPP
@@ -15,10 +15,22 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "batch.hpp"
 #include "disassembler.hpp"
+#include "fingerprint_db.hpp"
+#include "server.hpp"
+#include "statistics.hpp"
+#include "symbol_table.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <cctype>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <vector>
+#include <getopt.h>
 #include <unistd.h>
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -29,30 +41,185 @@ usage ()
 {
   std::cerr << '\n';
   std::cerr << "Use: msxdasm [OPTIONS] file.ROM\n";
+  std::cerr << "     msxdasm [OPTIONS] -b <dir|manifest>\n";
+  std::cerr << "     msxdasm [-m <machine>] -d <file.def> ... -c <file.sym>\n";
+  std::cerr << "     msxdasm [-m <machine>] [-d <file.def>] ... --server <socket>\n";
   std::cerr << "e.g: msxdasm kvalley.rom\n";
+  std::cerr << "     unzip -p kvalley.zip | msxdasm -o - --format lst - | gzip > kvalley.lst.gz\n";
   std::cerr << '\n';
   std::cerr << "Options are:\n";
+  std::cerr << "  -b Batch mode. Disassemble all .rom files from a directory, or all files\n";
+  std::cerr << "     listed in a manifest file (one path per line). Can be used multiple times\n";
+  std::cerr << "     E.g: -b roms/ -o asm -o lst -O out/\n";
+  std::cerr << '\n';
+  std::cerr << "  -c Compile machine profile (-m) and definition files given with -d into a\n";
+  std::cerr << "     binary symbol image, which can be loaded with -d, with no parsing\n";
+  std::cerr << "     E.g: -d msxrom.def -d kvalley.def -c kvalley.sym\n";
+  std::cerr << '\n';
+  std::cerr << "  -C Set analysis cache directory. Navigation is skipped when the ROM,\n";
+  std::cerr << "     addresses and entry points match a previous run\n";
+  std::cerr << "     E.g: -C ~/.cache/msxdasm\n";
+  std::cerr << '\n';
   std::cerr << "  -d Read address definition file (eg. msxrom.def). Can be used multiple times\n";
   std::cerr << "     E.g: -d msxrom.def -d kvalley.def\n";
   std::cerr << '\n';
   std::cerr << "  -e Set execution address in hexa (default = cartridge default)\n";
   std::cerr << "     E.g: -e 406c\n";
   std::cerr << '\n';
-  std::cerr << "  -o Set output file name. (default = msxdasm.out)\n";
+  std::cerr << "  -f Read routine fingerprint file, to name library routines found in the ROM.\n";
+  std::cerr << "     Can be used multiple times\n";
+  std::cerr << "     E.g: -f konami.fp\n";
+  std::cerr << '\n';
+  std::cerr << "  -F Add fingerprints of routines named by -d files to a fingerprint file\n";
+  std::cerr << "     E.g: -d kvalley.def -F konami.fp kvalley.rom\n";
+  std::cerr << '\n';
+  std::cerr << "  -j Set number of worker threads (default = number of cores, max = 256)\n";
+  std::cerr << "     In batch mode, ROMs are processed in parallel. Otherwise, output is\n";
+  std::cerr << "     rendered in parallel chunks\n";
+  std::cerr << '\n';
+  std::cerr << "  -m Load built-in symbols for a machine profile: msx1, msx2, msx2+ or turbor.\n";
+  std::cerr << "     Symbols from -d files override the built-in ones\n";
+  std::cerr << "     E.g: -m msx2 -d kvalley.def\n";
+  std::cerr << '\n';
+  std::cerr << "  -o Set output file name. (default = msxdasm.out). Use - for stdout\n";
+  std::cerr << "     In batch mode, set output format (e.g. asm, lst)\n";
+  std::cerr << '\n';
+  std::cerr << "  -O Set output directory in batch mode (default = .)\n";
   std::cerr << '\n';
   std::cerr << "  -p Add code entry point, for unreachable code\n";
   std::cerr << "     E.g: -p 401a\n";
   std::cerr << '\n';
+  std::cerr << "  -S Read code signature file, with one signature per line: name, action\n";
+  std::cerr << "     (entry_point or jump_table) and hex pattern, using ?? for wildcards.\n";
+  std::cerr << "     Can be used multiple times\n";
+  std::cerr << "     E.g: -S konami.sig, with line: swtcha jump_table 87 E1 CD ?? ?? E9\n";
+  std::cerr << '\n';
   std::cerr << "  -s Set start address in hexa (default = 4000h)\n";
   std::cerr << "     E.g: -s 4000\n";
   std::cerr << '\n';
+  std::cerr << "  --format Set output format for stdout (-o -): asm or lst (default = asm)\n";
+  std::cerr << "     A ROM file name of - reads the ROM from stdin\n";
+  std::cerr << '\n';
+  std::cerr << "  --server Serve disassembly requests on a Unix socket, keeping definitions\n";
+  std::cerr << "     (-m, -d, -f, -S) loaded. -j sets the number of workers. Stop with SIGINT/SIGTERM\n";
+  std::cerr << "     Request: DASM size=<n> [format=asm|lst] [start=<hex>] [exec=<hex>]\n";
+  std::cerr << "              [entry=<hex>]... followed by newline and <n> bytes of ROM data\n";
+  std::cerr << "     Response: OK <n>, newline and <n> bytes of output, or ERR <message>\n";
+  std::cerr << "     E.g: -m msx1 -d konami.def --server /tmp/msxdasm.sock\n";
+  std::cerr << '\n';
+  std::cerr << "  --queue-size Set max number of connections waiting for a worker in server\n";
+  std::cerr << "     mode (default = 64). Further connections wait in the listen backlog\n";
+  std::cerr << '\n';
+  std::cerr << "  --stats Show phase times and counters (instructions decoded, entry points,\n";
+  std::cerr << "     bytes per status, symbol lookups, output bytes) when done\n";
+  std::cerr << '\n';
+  std::cerr << "  --stats-json Write phase times and counters as a JSON object (- = stdout,\n";
+  std::cerr << "     not with -o -)\n";
+  std::cerr << "     E.g: -b roms/ -o asm --stats-json stats.json\n";
+  std::cerr << '\n';
+  std::cerr << "  --perf Read hardware counters (cycles, instructions, cache misses, branch\n";
+  std::cerr << "     misses) for each phase, shown as IPC and misses per decoded instruction\n";
+  std::cerr << "     with --stats and --stats-json (Linux only). Implies --stats if neither\n";
+  std::cerr << "     option is given\n";
+  std::cerr << '\n';
+  std::cerr << "  --trace Record a timeline of each phase, per thread and per ROM, and write\n";
+  std::cerr << "     it as Chrome trace event JSON, viewable in Perfetto (ui.perfetto.dev)\n";
+  std::cerr << "     E.g: -b roms/ -o asm --trace trace.json\n";
+  std::cerr << '\n';
 }
 
+//! \brief Maximum number of worker threads
+static constexpr unsigned long MAX_JOBS = 256;
+
+//! \brief Maximum server queue size
+static constexpr unsigned long MAX_QUEUE_SIZE = 4096;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Main function
+//! \brief Parse non-negative decimal count, clamped to a maximum
+//! \param text Option argument
+//! \param option Option name, for error messages
+//! \param max Maximum value
+//! \return Count
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-int
-main (int argc, char **argv)
+static unsigned long
+parse_count (const std::string& text, const std::string& option, unsigned long max)
+{
+  std::size_t pos = 0;
+  unsigned long value = 0;
+
+  try
+    {
+      if (!text.empty () && std::isdigit (static_cast <unsigned char> (text[0])))
+        value = std::stoul (text, &pos);
+    }
+  catch (const std::out_of_range&)
+    {
+      value = max;
+      pos = text.size ();
+    }
+
+  if (pos == 0 || pos != text.size ())
+    {
+      std::cerr << "Error: invalid value for " << option << ": " << text << std::endl;
+      exit (EXIT_FAILURE);
+    }
+
+  return std::min (value, max);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Server running, stopped by signal handler
+static msxdasm::server *running_server = nullptr;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Stop running server on SIGINT/SIGTERM
+//! \param signum Signal number
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+stop_server (int)
+{
+  if (running_server)
+    running_server->stop ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Show statistics
+//! \param stats Statistics
+//! \param show_text If true, show statistics as text to stderr
+//! \param json_path JSON file path, or "-" for stdout (empty = none)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+show_statistics (const msxdasm::statistics& stats, bool show_text, const std::string& json_path)
+{
+  if (show_text)
+    std::cerr << "Statistics:\n" << stats.to_text () << std::flush;
+
+  if (json_path == "-")
+    std::cout << stats.to_json () << std::endl;
+
+  else if (!json_path.empty ())
+    {
+      std::ofstream fp (json_path);
+
+      if (!fp)
+        throw std::runtime_error ("could not create file " + json_path);
+
+      fp << stats.to_json () << '\n';
+      fp.close ();
+
+      if (!fp)
+        throw std::runtime_error ("could not write file " + json_path);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run command
+//! \param argc Number of arguments
+//! \param argv Arguments
+//! \return Exit status
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+run (int argc, char **argv)
 {
   std::cerr << "=====================================================\n";
   std::cerr << "MSXDASM v3.0\n";
@@ -64,21 +231,117 @@ main (int argc, char **argv)
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   std::vector <std::string> output_files;
   std::vector <std::string> definition_files;
+  std::vector <std::string> fingerprint_files;
+  std::vector <std::string> signature_files;
+  std::vector <std::string> batch_sources;
   std::vector <std::uint16_t> entry_points;
 
   std::uint16_t start_addr = 0x4000;
   std::uint16_t exec_addr = 0;
+  std::string output_dir = ".";
+  std::string cache_dir;
+  std::string image_path;
+  std::string machine;
+  std::string learn_path;
+  unsigned int jobs = 0;
+  bool show_stats = false;
+  std::string stats_json_path;
+  std::string trace_path;
+  bool use_perf_counters = false;
+  std::string stdout_format = "asm";
+  std::string socket_path;
+  std::size_t queue_size = 64;
+
+  enum
+  {
+    OPT_STATS = 256,
+    OPT_STATS_JSON,
+    OPT_TRACE,
+    OPT_PERF,
+    OPT_FORMAT,
+    OPT_SERVER,
+    OPT_QUEUE_SIZE
+  };
+
+  static const option long_options[] =
+  {
+    {"help", no_argument, nullptr, 'h'},
+    {"stats", no_argument, nullptr, OPT_STATS},
+    {"stats-json", required_argument, nullptr, OPT_STATS_JSON},
+    {"trace", required_argument, nullptr, OPT_TRACE},
+    {"perf", no_argument, nullptr, OPT_PERF},
+    {"format", required_argument, nullptr, OPT_FORMAT},
+    {"server", required_argument, nullptr, OPT_SERVER},
+    {"queue-size", required_argument, nullptr, OPT_QUEUE_SIZE},
+    {nullptr, 0, nullptr, 0}
+  };
 
   int opt;
-  while ((opt = getopt (argc, argv, "hd:e:lo:p:s:")) != EOF)
+  while ((opt = getopt_long (argc, argv, "hb:c:C:d:e:f:F:j:lm:o:O:p:s:S:", long_options, nullptr)) != EOF)
     {
       switch (opt)
         {
+        case OPT_STATS:
+          show_stats = true;
+          break;
+
+        case OPT_STATS_JSON:
+          stats_json_path = optarg;
+          break;
+
+        case OPT_TRACE:
+          trace_path = optarg;
+          break;
+
+        case OPT_PERF:
+          use_perf_counters = true;
+          break;
+
+        case OPT_FORMAT:
+          stdout_format = optarg;
+          break;
+
+        case OPT_SERVER:
+          socket_path = optarg;
+          break;
+
+        case OPT_QUEUE_SIZE:
+          queue_size = parse_count (optarg, "--queue-size", MAX_QUEUE_SIZE);
+          break;
+
         case 'h':
           usage ();
           exit (EXIT_SUCCESS);
           break;
 
+        case 'b':
+          batch_sources.push_back (optarg);
+          break;
+
+        case 'c':
+          image_path = optarg;
+          break;
+
+        case 'C':
+          cache_dir = optarg;
+          break;
+
+        case 'f':
+          fingerprint_files.push_back (optarg);
+          break;
+
+        case 'F':
+          learn_path = optarg;
+          break;
+
+        case 'j':
+          jobs = parse_count (optarg, "-j", MAX_JOBS);
+          break;
+
+        case 'O':
+          output_dir = optarg;
+          break;
+
         case 'd':
           definition_files.push_back (optarg);
           break;
@@ -87,6 +350,10 @@ main (int argc, char **argv)
           exec_addr = std::stoi (optarg, nullptr, 16);
           break;
 
+        case 'm':
+          machine = optarg;
+          break;
+
         case 'o':
           output_files.push_back (optarg);
           break;
@@ -99,12 +366,170 @@ main (int argc, char **argv)
           start_addr = std::stoi (optarg, nullptr, 16);
           break;
 
+        case 'S':
+          signature_files.push_back (optarg);
+          break;
+
         default:
           usage ();
           exit (EXIT_FAILURE);
         }
     }
 
+  if (stats_json_path == "-" && batch_sources.empty () &&
+      std::find (output_files.begin (), output_files.end (), "-") != output_files.end ())
+    {
+      std::cerr << "Error: --stats-json - cannot be used with -o -, as both write to stdout" << std::endl;
+      exit (EXIT_FAILURE);
+    }
+
+  if (!socket_path.empty () && (show_stats || !stats_json_path.empty () || use_perf_counters || !trace_path.empty ()))
+    {
+      std::cerr << "Error: --stats, --stats-json, --perf and --trace cannot be used with --server" << std::endl;
+      exit (EXIT_FAILURE);
+    }
+
+  if (!trace_path.empty ())
+    msxdasm::enable_trace ();
+
+  msxdasm::perf_counters counters;
+
+  if (use_perf_counters)
+    {
+      counters.open ();
+
+      if (!counters.is_available ())
+        std::cerr << "Warning: hardware counters are not available" << std::endl;
+
+      if (stats_json_path.empty ())
+        show_stats = true;
+    }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Compile symbol image
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  if (!image_path.empty ())
+    {
+      msxdasm::symbol_table table;
+
+      if (!machine.empty ())
+        table.load_profile (machine);
+
+      for (const auto& path : definition_files)
+        table.load_def (path);
+
+      table.save_image (image_path);
+
+      std::cerr << "Symbol image : " << image_path << std::endl;
+      exit (EXIT_SUCCESS);
+    }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Server mode
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  if (!socket_path.empty ())
+    {
+      msxdasm::server s;
+      s.set_cache_dir (cache_dir);
+      s.set_jobs (jobs);
+      s.set_queue_size (queue_size);
+
+      if (!machine.empty ())
+        s.load_profile (machine);
+
+      for (const auto& path : definition_files)
+        s.load_def (path);
+
+      for (const auto& path : fingerprint_files)
+        s.load_fingerprints (path);
+
+      for (const auto& path : signature_files)
+        s.load_signatures (path);
+
+      struct sigaction action = {};
+      action.sa_handler = stop_server;
+      sigemptyset (&action.sa_mask);
+      sigaction (SIGINT, &action, nullptr);
+      sigaction (SIGTERM, &action, nullptr);
+
+      running_server = &s;
+      std::cerr << "Listening on : " << socket_path << std::endl;
+      s.run (socket_path);
+      running_server = nullptr;
+
+      exit (EXIT_SUCCESS);
+    }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Batch mode
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  msxdasm::statistics stats;
+
+  if (!batch_sources.empty ())
+    {
+      msxdasm::batch b;
+      b.set_start_address (start_addr);
+      b.set_exec_address (exec_addr);
+      b.set_output_dir (output_dir);
+      b.set_cache_dir (cache_dir);
+      b.set_jobs (jobs);
+      b.set_perf_counters (use_perf_counters && counters.is_available ());
+
+      {
+        msxdasm::phase_timer timer (stats, "load_def", &counters);
+
+        if (!machine.empty ())
+          b.load_profile (machine);
+
+        for (const auto& path : definition_files)
+          b.load_def (path);
+      }
+
+      {
+        msxdasm::phase_timer timer (stats, "load_fingerprints", &counters);
+
+        for (const auto& path : fingerprint_files)
+          b.load_fingerprints (path);
+      }
+
+      {
+        msxdasm::phase_timer timer (stats, "load_signatures", &counters);
+
+        for (const auto& path : signature_files)
+          b.load_signatures (path);
+      }
+
+      for (auto addr : entry_points)
+        b.add_entry_point (addr);
+
+      for (const auto& fmt : output_files)
+        b.add_output_format (fmt);
+
+      for (const auto& path : batch_sources)
+        b.add_source (path);
+
+      for (int i = optind;i < argc;i++)
+        b.add_rom (argv[i]);
+
+      std::size_t failures = 0;
+
+      {
+        msxdasm::phase_timer timer (stats, "batch");
+        failures = b.run ();
+      }
+
+      std::cerr << "ROMs processed: " << std::dec << b.get_rom_count () << '\n';
+      std::cerr << "ROMs failed   : " << std::dec << failures << std::endl;
+
+      b.get_statistics (stats);
+      show_statistics (stats, show_stats, stats_json_path);
+
+      if (!trace_path.empty ())
+        msxdasm::write_trace (trace_path);
+
+      exit (failures ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+
   if (optind >= argc)
     {
       std::cerr << std::endl;
@@ -117,35 +542,126 @@ main (int argc, char **argv)
   // Load .rom file
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   const std::string path = argv[optind];
+  msxdasm::set_trace_rom (path);
 
   msxdasm::disassembler disasm;
-  disasm.load_rom (path, start_addr);
+  disasm.set_jobs (jobs);
+  disasm.set_cache_dir (cache_dir);
+
+  {
+    msxdasm::phase_timer timer (stats, "load_rom", &counters);
+
+    if (path == "-")
+      disasm.load_rom (STDIN_FILENO, start_addr);
+    else
+      disasm.load_rom (path, start_addr);
+  }
 
   if (exec_addr)
     disasm.set_exec_address (exec_addr);
 
-  for (const auto& path : definition_files)
-      disasm.load_def (path);
+  {
+    msxdasm::phase_timer timer (stats, "load_def", &counters);
+
+    if (!machine.empty ())
+      disasm.load_profile (machine);
+
+    for (const auto& path : definition_files)
+        disasm.load_def (path);
+  }
+
+  {
+    msxdasm::phase_timer timer (stats, "load_fingerprints", &counters);
+
+    for (const auto& path : fingerprint_files)
+        disasm.load_fingerprints (path);
+  }
+
+  {
+    msxdasm::phase_timer timer (stats, "load_signatures", &counters);
+
+    for (const auto& path : signature_files)
+        disasm.load_signatures (path);
+  }
 
   for (auto addr : entry_points)
       disasm.add_entry_point (addr);
 
-  disasm.navigate ();
+  {
+    msxdasm::phase_timer timer (stats, "navigate", &counters);
+    disasm.navigate ();
+  }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Show cartridge data
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  std::cerr << "Cartridge    : " << path << '\n';
+  std::cerr << "Cartridge    : " << (path == "-" ? "<stdin>" : path) << '\n';
   std::cerr << "Start address: " << std::hex << std::setw(4) << std::setfill('0') << disasm.get_start_address () << std::endl;
   std::cerr << "End address  : " << std::hex << std::setw(4) << std::setfill('0') << disasm.get_end_address () << std::endl;
   std::cerr << "Exec address : " << std::hex << std::setw(4) << std::setfill('0') << disasm.get_exec_address () << std::endl;
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Learn routine fingerprints
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  if (!learn_path.empty ())
+    {
+      msxdasm::fingerprint_db db;
+
+      if (std::filesystem::exists (learn_path))
+        db.load (learn_path);
+
+      auto count = disasm.learn_fingerprints (db);
+      db.save (learn_path);
+
+      std::cerr << "Fingerprints : " << std::dec << count << " routines named, " << db.size () << " in " << learn_path << std::endl;
+    }
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Generate output
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   if (output_files.empty ())
     output_files.push_back ("msxdasm.out");
 
-  for (const auto& path : output_files)
-    disasm.generate (path);
+  {
+    msxdasm::phase_timer timer (stats, "generate", &counters);
+
+    auto iter = std::remove (output_files.begin (), output_files.end (), "-");
+    bool to_stdout = iter != output_files.end ();
+    output_files.erase (iter, output_files.end ());
+
+    if (!output_files.empty ())
+      disasm.generate (output_files);
+
+    if (to_stdout)
+      disasm.generate (STDOUT_FILENO, stdout_format);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Show statistics
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  stats.roms = 1;
+  disasm.get_statistics (stats);
+  show_statistics (stats, show_stats, stats_json_path);
+
+  if (!trace_path.empty ())
+    msxdasm::write_trace (trace_path);
+
+  return EXIT_SUCCESS;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main (int argc, char **argv)
+{
+  try
+    {
+      return run (argc, argv);
+    }
+  catch (const std::exception& e)
+    {
+      std::cerr << "Error: " << e.what () << std::endl;
+      return EXIT_FAILURE;
+    }
 }
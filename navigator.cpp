@@ -17,58 +17,86 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "navigator.hpp"
 #include "cartridge.hpp"
+#include "opcode_table.hpp"
+#include "output_sink.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <queue>
-#include <set>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <iostream>
 
+namespace fs = std::filesystem;
+
 namespace
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Opcode sizes. 0 for DD, ED, FD
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static constexpr std::uint8_t OPCODE_SIZE[256] =
-{
-  1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,       // 00-0f
-  2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,       // 10-1f
-  2, 3, 3, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,       // 20-2f
-  2, 3, 3, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,       // 30-3f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // 40-4f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // 50-5f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // 60-6f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // 70-7f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // 80-8f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // 90-9f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // a0-af
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // b0-bf
-  1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,       // c0-cf
-  1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 0, 2, 1,       // d0-df
-  1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 0, 2, 1,       // e0-ef
-  1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 0, 2, 1,       // f0-ff
+//! \brief Analysis cache file header
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct cache_header
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t instruction_size;
+  std::uint64_t key;
+  std::uint32_t instruction_count;
+  std::uint32_t xref_count;
 };
 
+static_assert (std::is_trivially_copyable_v <msxdasm::instruction>, "instructions are cached as raw bytes");
+static_assert (std::is_trivially_copyable_v <msxdasm::navigator::xref>, "xrefs are cached as raw bytes");
+static_assert (std::has_unique_object_representations_v <msxdasm::instruction>, "instructions must have no padding");
+static_assert (std::has_unique_object_representations_v <msxdasm::navigator::xref>, "xrefs must have no padding");
+
+//! \brief Analysis cache file magic
+static constexpr char CACHE_MAGIC[8] = {'M', 'S', 'X', 'D', 'N', 'A', 'V', 0};
+
+//! \brief Analysis cache file version. Increment when layout changes
+static constexpr std::uint32_t CACHE_VERSION = 5;
+
+//! \brief Analysis cache fixed data size (header + memory map + entry points)
+//! Followed by ROM bytes, instructions and cross references
+static constexpr std::size_t CACHE_DATA_OFFSET = sizeof (cache_header) + 0x10000 + 0x10000 / 8;
+
+//! \brief FNV-1a hash offset basis
+static constexpr std::uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief DD and FD opcode sizes
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static constexpr std::uint8_t OPCODE_SIZE_DDFD[256] =
-{
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,       // 00-0f
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,       // 10-1f
-  1, 4, 4, 2, 2, 2, 3, 1, 1, 2, 4, 2, 2, 2, 3, 1,       // 20-2f
-  1, 1, 1, 1, 3, 3, 4, 1, 1, 2, 1, 1, 1, 1, 1, 1,       // 30-3f
-  1, 1, 1, 1, 2, 2, 3, 1, 1, 1, 1, 1, 2, 2, 3, 1,       // 40-4f
-  1, 1, 1, 1, 2, 2, 3, 1, 1, 1, 1, 1, 2, 2, 3, 1,       // 50-5f
-  2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 3, 2,       // 60-6f
-  3, 3, 3, 3, 3, 3, 1, 3, 1, 1, 1, 1, 2, 2, 3, 1,       // 70-7f
-  1, 1, 1, 1, 2, 2, 3, 1, 1, 1, 1, 1, 2, 2, 3, 1,       // 80-8f
-  1, 1, 1, 1, 2, 2, 3, 1, 1, 1, 1, 1, 2, 2, 3, 1,       // 90-9f
-  1, 1, 1, 1, 2, 2, 3, 1, 1, 1, 1, 1, 2, 2, 3, 1,       // a0-af
-  1, 1, 1, 1, 2, 2, 3, 1, 1, 1, 1, 1, 2, 2, 3, 1,       // b0-bf
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1,       // c0-cf
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,       // d0-df
-  1, 2, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,       // e0-ef
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,       // f0-ff
-};
+//! \brief Update FNV-1a hash with value bytes, little endian
+//! \param hash Current hash
+//! \param v Value
+//! \return New hash
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::uint64_t
+fnv1a (std::uint64_t hash, std::uint32_t v)
+{
+  for (int i = 0;i < 4;i++)
+    {
+      hash ^= (v >> (i * 8)) & 0xff;
+      hash *= 0x100000001b3ULL;
+    }
+
+  return hash;
+}
+
+//! \brief Minimum routine size in bytes, for fingerprinting
+static constexpr std::uint16_t MIN_ROUTINE_SIZE = 8;
+
+//! \brief Maximum routine size in bytes hashed into a fingerprint
+static constexpr std::uint16_t MAX_ROUTINE_SIZE = 256;
 
 } // namespace
 
@@ -80,23 +108,47 @@ namespace msxdasm
 class navigator::impl
 {
 private:
-  // Memory status type
-  enum status { STATUS_UNKNOWN, STATUS_DB, STATUS_DW, STATUS_STRING, STATUS_CODE };
-
-  //! \brief Entry points found
-  std::set <addr_type> entry_points_;
+  //! \brief Entry points found, one bit per address
+  std::array <std::uint64_t, 0x10000 / 64> entry_points_ = {};
 
-  //! \brief Entry points to navigate
+  //! \brief Entry points to navigate, each one queued only once
   std::queue <addr_type> entry_points_queue_;
 
+  //! \brief Entry points added by the user, re-queued on every navigation
+  std::vector <addr_type> user_entry_points_;
+
   //! \brief Cartridge object
   cartridge cartridge_;
 
-  //! \brief Memory map
-  std::array <status, 0x10000> memory_map_;
+  //! \brief Memory map, one status byte per address
+  std::array <status_type, 0x10000> memory_map_;
+
+  //! \brief Memory map runs, from start to end address
+  std::vector <region> regions_;
 
-  //! \brief swtcha function address
-  addr_type swtcha_ = 0;
+  //! \brief Instructions decoded while navigating, sorted by address
+  std::vector <instruction> instructions_;
+
+  //! \brief Cross references, sorted by target and source address
+  std::vector <xref> xrefs_;
+
+  //! \brief Jump table dispatchers found by signature, one bit per address
+  std::array <std::uint64_t, 0x10000 / 64> jump_tables_ = {};
+
+  //! \brief Code signatures, scanned before navigation
+  signature_db signatures_;
+
+  //! \brief Analysis cache directory (empty = no cache)
+  std::string cache_dir_;
+
+  //! \brief Instructions decoded while navigating
+  std::uint64_t decoded_count_ = 0;
+
+  //! \brief Entry points added again, not queued
+  std::uint64_t duplicate_count_ = 0;
+
+  //! \brief Whether navigation results were loaded from cache
+  bool cache_hit_ = false;
 
 public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -120,7 +172,7 @@ public:
   bool
   is_db (addr_type pc) const
   {
-      return memory_map_.at (pc) == STATUS_DB;
+      return memory_map_[pc] == STATUS_DB;
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -131,7 +183,7 @@ public:
   bool
   is_dw (addr_type pc) const
   {
-      return memory_map_.at (pc) == STATUS_DW;
+      return memory_map_[pc] == STATUS_DW;
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -142,7 +194,7 @@ public:
   bool
   is_string (addr_type pc) const
   {
-      return memory_map_.at (pc) == STATUS_STRING;
+      return memory_map_[pc] == STATUS_STRING;
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -153,7 +205,7 @@ public:
   bool
   is_code (addr_type pc) const
   {
-      return memory_map_.at (pc) == STATUS_CODE;
+      return memory_map_[pc] == STATUS_CODE;
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -164,20 +216,98 @@ public:
   bool
   is_entry_point (addr_type pc) const
   {
-      return entry_points_.find (pc) != entry_points_.end ();
+      return (entry_points_[pc >> 6] >> (pc & 63)) & 1;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Check if address is a jump table dispatcher
+  //! \param pc Memory pos
+  //! \return true/false
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bool
+  is_jump_table (addr_type pc) const
+  {
+      return (jump_tables_[pc >> 6] >> (pc & 63)) & 1;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get instructions decoded while navigating
+  //! \return Instructions, sorted by address
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const std::vector <instruction>&
+  get_instructions () const
+  {
+      return instructions_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get cross references
+  //! \return Cross references, sorted by target and source address
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const std::vector <xref>&
+  get_xrefs () const
+  {
+      return xrefs_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Add cross reference
+  //! \param source Source address
+  //! \param target Target address
+  //! \param type Cross reference type
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  add_xref (addr_type source, addr_type target, xref_type type)
+  {
+      xrefs_.push_back ({target, source, type});
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get memory map runs
+  //! \return Regions, sorted by address
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  const std::vector <region>&
+  get_regions () const
+  {
+      return regions_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get address status
+  //! \param pc Memory pos
+  //! \return Status
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  status_type
+  get_status (addr_type pc) const
+  {
+      return memory_map_[pc];
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   std::uint8_t get_opcode_size (addr_type) const;
-  void set_status (addr_type, std::uint16_t, status);
+  instruction decode (addr_type) const;
+  template <instruction::prefix_type P> instruction decode_opcode (addr_type, std::uint8_t) const;
+  void set_status (addr_type, std::uint16_t, status_type);
+  void build_regions ();
+  std::vector <addr_type> get_entry_points () const;
+  std::vector <routine> get_routines () const;
+  void get_statistics (statistics&) const;
   void add_entry_point (addr_type);
+  void add_user_entry_point (addr_type);
+  void reset_entry_points ();
+  void set_cache_dir (const std::string&);
+  void load_signatures (const std::string&);
+  void set_signatures (const signature_db&);
+  std::uint64_t get_cache_key () const;
+  bool load_cache (const std::string&, std::uint64_t);
+  void save_cache (const std::string&, std::uint64_t) const;
   void navigate (const cartridge&);
   void navigate_branch (addr_type);
   std::uint8_t navigate_opcode (addr_type);
-  void detect_swtcha ();
-  void navigate_swtcha (addr_type);
+  void detect_signatures ();
+  void navigate_jump_table (addr_type);
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -187,31 +317,197 @@ public:
 void
 navigator::impl::add_entry_point (addr_type pc)
 {
-  entry_points_queue_.push (pc);
-  entry_points_.insert (pc);
+  auto& word = entry_points_[pc >> 6];
+  const std::uint64_t mask = std::uint64_t (1) << (pc & 63);
+
+  if (!(word & mask))
+    {
+      word |= mask;
+      entry_points_queue_.push (pc);
+    }
+
+  else
+    ++duplicate_count_;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Detect swtcha function (Konami)
+//! \brief Add user entry point, kept across navigations
+//! \param pc Address
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-navigator::impl::detect_swtcha ()
+navigator::impl::add_user_entry_point (addr_type pc)
 {
-  auto pc = cartridge_.get_start_address ();
-  auto end_addr = cartridge_.get_end_address ();
+  user_entry_points_.push_back (pc);
+  add_entry_point (pc);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Reset entry points left by a previous navigation
+//! Only the user entry points are kept, queued in the order they were added.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::reset_entry_points ()
+{
+  entry_points_.fill (0);
+  entry_points_queue_ = {};
+
+  for (auto pc : user_entry_points_)
+    add_entry_point (pc);
+}
 
-  while (!swtcha_ && pc < end_addr - 5)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get entry points
+//! \return Entry points, sorted by address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <navigator::addr_type>
+navigator::impl::get_entry_points () const
+{
+  std::vector <addr_type> entry_points;
+
+  for (std::uint32_t i = 0;i < entry_points_.size ();i++)
     {
-      if (cartridge_.get_byte (pc) == 0x87 &&
-          cartridge_.get_byte (pc + 1) == 0xe1 &&
-          cartridge_.get_byte (pc + 2) == 0xcd &&
-          cartridge_.get_byte (pc + 5) == 0xe9)
-        swtcha_ = pc;
-      ++pc;
+      for (std::uint64_t word = entry_points_[i];word;word &= word - 1)
+        {
+          std::uint32_t bit = 0;
+
+          while (!((word >> bit) & 1))
+            bit++;
+
+          entry_points.push_back (static_cast <addr_type> (i * 64 + bit));
+        }
+    }
+
+  return entry_points;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get routines called from navigated code, with their fingerprints
+//! \return Routines, sorted by address
+//!
+//! A routine runs from a call target through consecutive instructions, up to
+//! the first unconditional jump or return. Its fingerprint hashes instruction
+//! bytes with absolute address and word operands masked, so the same routine
+//! linked at another address (or into another ROM) gets the same fingerprint.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <navigator::routine>
+navigator::impl::get_routines () const
+{
+  std::array <std::uint64_t, 0x10000 / 64> targets = {};
+
+  for (const auto& insn : instructions_)
+    if (insn.flow == instruction::FLOW_CALL || insn.flow == instruction::FLOW_COND_CALL)
+      targets[insn.target >> 6] |= std::uint64_t (1) << (insn.target & 63);
+
+  std::vector <routine> routines;
+  auto iter = instructions_.begin ();
+
+  for (std::uint32_t i = 0;i < targets.size ();i++)
+    {
+      for (std::uint64_t word = targets[i];word;word &= word - 1)
+        {
+          std::uint32_t bit = 0;
+
+          while (!((word >> bit) & 1))
+            bit++;
+
+          const addr_type addr = static_cast <addr_type> (i * 64 + bit);
+
+          iter = std::lower_bound (iter, instructions_.end (), addr,
+                                   [] (const instruction& insn, addr_type a) { return insn.addr < a; });
+
+          if (iter == instructions_.end ())
+            return routines;
+
+          if (iter->addr != addr)
+            continue;
+
+          routine r;
+          r.addr = addr;
+          std::uint64_t hash = FNV_OFFSET;
+          std::uint32_t pc = addr;
+          bool end = false;
+
+          for (auto it = iter;!end && it != instructions_.end () && it->addr == pc && r.size < MAX_ROUTINE_SIZE;++it)
+            {
+              const auto& desc = get_opcode_descriptor (it->prefix, it->opcode);
+              std::uint8_t size = it->size;
+
+              hash ^= size;
+              hash *= 0x100000001b3ULL;
+
+              for (auto op : desc.operands)
+                if (op == OPERAND_ADDR || op == OPERAND_WORD)
+                  size -= 2;
+
+              for (std::uint8_t j = 0;j < size;j++)
+                {
+                  hash ^= cartridge_.get_byte (pc + j);
+                  hash *= 0x100000001b3ULL;
+                }
+
+              pc += it->size;
+              r.size += it->size;
+
+              end = it->flow == instruction::FLOW_JUMP ||
+                    it->flow == instruction::FLOW_RETURN ||
+                    it->flow == instruction::FLOW_JUMP_INDIRECT;
+            }
+
+          if (r.size >= MIN_ROUTINE_SIZE)
+            {
+              r.fingerprint = fnv1a (hash, r.size);
+              routines.push_back (r);
+            }
+        }
     }
 
-  if (swtcha_)
-      add_entry_point (swtcha_);
+  return routines;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get navigation counters
+//! \param stats Statistics, counters added to
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::get_statistics (statistics& stats) const
+{
+  stats.instructions_decoded += decoded_count_;
+  stats.duplicate_entry_points += duplicate_count_;
+  stats.cache_hits += cache_hit_;
+
+  for (auto word : entry_points_)
+    for (;word;word &= word - 1)
+      ++stats.entry_points;
+
+  for (const auto& r : regions_)
+    stats.status_bytes[r.status] += r.size;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Detect code signatures (e.g. Konami swtcha) in a single ROM scan
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::detect_signatures ()
+{
+  auto start_addr = cartridge_.get_start_address ();
+  auto end_addr = cartridge_.get_end_address ();
+
+  jump_tables_.fill (0);
+
+  if (end_addr <= start_addr)
+    return;
+
+  auto matches = signatures_.scan (cartridge_.get_data () + start_addr, end_addr - start_addr);
+
+  for (const auto& m : matches)
+    {
+      const addr_type pc = static_cast <addr_type> (start_addr + m.offset);
+
+      if (m.action == signature_db::ACTION_JUMP_TABLE)
+        jump_tables_[pc >> 6] |= std::uint64_t (1) << (pc & 63);
+
+      add_entry_point (pc);
+    }
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -221,10 +517,10 @@ navigator::impl::detect_swtcha ()
 //! \param st Status
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-navigator::impl::set_status (addr_type pc, std::uint16_t size, status st)
+navigator::impl::set_status (addr_type pc, std::uint16_t size, status_type st)
 {
-    if (pc + size < pc) // overflow
-      size = 0xffff - size + 1;
+    if (pc + size > 0x10000) // overflow
+      size = 0x10000 - pc;
 
     std::fill (memory_map_.data () + pc, memory_map_.data () + pc + size, st);
 }
@@ -237,21 +533,81 @@ navigator::impl::set_status (addr_type pc, std::uint16_t size, status st)
 std::uint8_t
 navigator::impl::get_opcode_size (addr_type pc) const
 {
-  std::uint8_t opcode = cartridge_.get_byte (pc);
-  std::uint8_t siz = OPCODE_SIZE[opcode];
+  return decode (pc).size;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decode instruction
+//! \param pc Address
+//! \return Decoded instruction
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+instruction
+navigator::impl::decode (addr_type pc) const
+{
+  instruction insn;
 
-  if (!siz)
+  switch (cartridge_.get_byte (pc))
     {
-      std::uint8_t operand = cartridge_.get_byte (pc + 1);
+      case 0xcb: insn = decode_opcode <instruction::PREFIX_CB> (pc, 1); break;
+      case 0xed: insn = decode_opcode <instruction::PREFIX_ED> (pc, 1); break;
+
+      case 0xdd:
+        if (cartridge_.get_byte (pc + 1) == 0xcb)
+          insn = decode_opcode <instruction::PREFIX_DDCB> (pc, 3);
+        else
+          insn = decode_opcode <instruction::PREFIX_DD> (pc, 1);
+        break;
+
+      case 0xfd:
+        if (cartridge_.get_byte (pc + 1) == 0xcb)
+          insn = decode_opcode <instruction::PREFIX_FDCB> (pc, 3);
+        else
+          insn = decode_opcode <instruction::PREFIX_FD> (pc, 1);
+        break;
+
+      default: insn = decode_opcode <instruction::PREFIX_NONE> (pc, 0);
+    }
+
+  return insn;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decode instruction of a given prefix family
+//! \param pc Address
+//! \param pos Opcode position, after prefixes
+//! \return Decoded instruction
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <instruction::prefix_type P>
+instruction
+navigator::impl::decode_opcode (addr_type pc, std::uint8_t pos) const
+{
+  instruction insn;
+  insn.addr = pc;
+  insn.prefix = P;
+  insn.opcode = cartridge_.get_byte (pc + pos);
 
-      if (opcode == 0xed)
-        siz = ((operand & 0xc7) == 0x43) ? 4 : 2;
+  const auto& desc = get_opcode_descriptor <P> (insn.opcode);
+  insn.size = desc.size;
+  insn.flow = desc.flow;
 
-      else              // 0xdd and 0xfd
-        siz = OPCODE_SIZE_DDFD[operand];
+  // operand bytes
+  if constexpr (P == instruction::PREFIX_DDCB || P == instruction::PREFIX_FDCB)
+    insn.operand = cartridge_.get_byte (pc + 2);        // dd cb xx op
+
+  else
+    {
+      for (std::uint8_t i = pos + 1;i < insn.size;i++)
+        insn.operand |= static_cast <std::uint16_t> (cartridge_.get_byte (pc + i)) << ((i - pos - 1) * 8);
     }
 
-  return siz;
+  // branch target
+  if (desc.operands[0] == OPERAND_RELADDR)
+    insn.target = cartridge_.get_offset (pc + pos + 1);
+
+  else if (desc.operands[0] == OPERAND_ADDR)
+    insn.target = insn.operand;
+
+  return insn;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -262,7 +618,34 @@ void
 navigator::impl::navigate (const cartridge& cart)
 {
   cartridge_ = cart;
+  reset_entry_points ();
+
+  decoded_count_ = 0;
+  duplicate_count_ = 0;
+  cache_hit_ = false;
+
+  // Try analysis cache first
+  std::uint64_t key = 0;
+  std::string cache_path;
+
+  if (!cache_dir_.empty ())
+    {
+      char name[32];
+      key = get_cache_key ();
+      snprintf (name, sizeof (name), "%016llx.nav", static_cast <unsigned long long> (key));
+      cache_path = (fs::path (cache_dir_) / name).string ();
+
+      if (load_cache (cache_path, key))
+        {
+          entry_points_queue_ = {};
+          cache_hit_ = true;
+          return;
+        }
+    }
+
   memory_map_.fill (STATUS_UNKNOWN);
+  instructions_.clear ();
+  xrefs_.clear ();
 
   auto start_addr = cartridge_.get_start_address ();
   auto end_addr = cartridge_.get_end_address ();
@@ -270,12 +653,13 @@ navigator::impl::navigate (const cartridge& cart)
   // Set cartridge header status
   set_status (start_addr, 2, STATUS_STRING);    // 'AB' signature
   set_status (start_addr + 2, 2, STATUS_DW);    // Execution entry point
+  add_xref (start_addr + 2, cartridge_.get_word (start_addr + 2), XREF_WORD);
 
   // Cartridge execution point
   add_entry_point (cartridge_.get_exec_address ());
 
-  // Search for swtcha function
-  detect_swtcha ();
+  // Search for code signatures
+  detect_signatures ();
  
   // Navigate through code until the navigation queue is empty
   while (!entry_points_queue_.empty ())
@@ -293,6 +677,248 @@ navigator::impl::navigate (const cartridge& cart)
       if (memory_map_[i] == STATUS_UNKNOWN)
           memory_map_[i] = STATUS_DB;
     }
+
+  // Sort decoded instructions, removing the ones navigated more than once
+  auto by_addr = [] (const instruction& a, const instruction& b) { return a.addr < b.addr; };
+  auto same_addr = [] (const instruction& a, const instruction& b) { return a.addr == b.addr; };
+
+  std::sort (instructions_.begin (), instructions_.end (), by_addr);
+  instructions_.erase (std::unique (instructions_.begin (), instructions_.end (), same_addr), instructions_.end ());
+
+  // Sort cross references by target, removing duplicates
+  auto by_target = [] (const xref& a, const xref& b)
+    {
+      return a.target < b.target || (a.target == b.target && a.source < b.source);
+    };
+  auto same_xref = [] (const xref& a, const xref& b) { return a.target == b.target && a.source == b.source; };
+
+  std::sort (xrefs_.begin (), xrefs_.end (), by_target);
+  xrefs_.erase (std::unique (xrefs_.begin (), xrefs_.end (), same_xref), xrefs_.end ());
+
+  build_regions ();
+
+  if (!cache_path.empty ())
+    save_cache (cache_path, key);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set analysis cache directory
+//! \param path Directory path (empty = no cache)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::set_cache_dir (const std::string& path)
+{
+  cache_dir_ = path;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load code signature file, adding to built-in signatures
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::load_signatures (const std::string& path)
+{
+  signatures_.load (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set shared code signature database
+//! \param db Signature database
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::set_signatures (const signature_db& db)
+{
+  signatures_ = db;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get analysis cache key
+//! \return Hash of ROM bytes, addresses, entry points set before navigation
+//! and code signatures
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+navigator::impl::get_cache_key () const
+{
+  std::uint64_t hash = FNV_OFFSET;
+  std::uint32_t start_addr = cartridge_.get_start_address ();
+  std::uint32_t end_addr = cartridge_.get_end_address ();
+
+  hash = fnv1a (hash, start_addr);
+  hash = fnv1a (hash, end_addr);
+  hash = fnv1a (hash, cartridge_.get_exec_address ());
+
+  for (std::uint32_t addr = start_addr;addr <= end_addr;addr++)
+    hash = fnv1a (hash, cartridge_.get_byte (addr));
+
+  for (auto addr : get_entry_points ())
+    hash = fnv1a (hash, addr);
+
+  const std::uint64_t signatures_key = signatures_.get_key ();
+  hash = fnv1a (hash, static_cast <std::uint32_t> (signatures_key));
+  hash = fnv1a (hash, static_cast <std::uint32_t> (signatures_key >> 32));
+
+  return hash;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load navigation results from analysis cache file
+//! \param path File path
+//! \param key Cache key
+//! \return true if loaded, false if file is missing, stale or invalid
+//!
+//! The ROM bytes stored in the file must match the cartridge, so a key
+//! collision is never taken as a hit. Statuses, addresses and instruction
+//! fields are range checked, as later stages use them as table indexes.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+navigator::impl::load_cache (const std::string& path, std::uint64_t key)
+{
+  const std::uint32_t start_addr = cartridge_.get_start_address ();
+  const std::uint32_t end_addr = cartridge_.get_end_address ();
+  const std::size_t rom_size = end_addr - start_addr + 1;
+
+  int fd = ::open (path.c_str (), O_RDONLY);
+  if (fd == -1)
+    return false;
+
+  struct stat st;
+  void *data = MAP_FAILED;
+
+  if (fstat (fd, &st) == 0 && std::size_t (st.st_size) >= CACHE_DATA_OFFSET)
+    data = mmap (nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  ::close (fd);
+
+  if (data == MAP_FAILED)
+    return false;
+
+  const char *p = static_cast <const char *> (data);
+  cache_header header;
+  std::memcpy (&header, p, sizeof (header));
+
+  bool valid = std::memcmp (header.magic, CACHE_MAGIC, sizeof (header.magic)) == 0 &&
+               header.version == CACHE_VERSION &&
+               header.instruction_size == sizeof (instruction) &&
+               header.key == key &&
+               std::size_t (st.st_size) == CACHE_DATA_OFFSET + rom_size +
+                                           std::size_t (header.instruction_count) * sizeof (instruction) +
+                                           std::size_t (header.xref_count) * sizeof (xref);
+
+  const char *map = p + sizeof (cache_header);
+  const char *bitmap = map + sizeof (memory_map_);
+  const char *rom = bitmap + sizeof (entry_points_);
+
+  if (valid)
+    valid = std::memcmp (rom, cartridge_.get_data () + start_addr, rom_size) == 0 &&
+            std::all_of (map, map + sizeof (memory_map_), [] (char st) { return std::uint8_t (st) <= STATUS_CODE; });
+
+  // Instructions and xrefs are checked after being copied, as they may be
+  // unaligned in the file. memory_map_ and entry_points_ are only replaced
+  // once everything is valid.
+  if (valid)
+    {
+      p = rom + rom_size;
+      instructions_.resize (header.instruction_count);
+      std::memcpy (instructions_.data (), p, header.instruction_count * sizeof (instruction));
+      p += header.instruction_count * sizeof (instruction);
+
+      xrefs_.resize (header.xref_count);
+      std::memcpy (xrefs_.data (), p, header.xref_count * sizeof (xref));
+
+      auto in_rom = [start_addr, end_addr] (std::uint32_t addr) { return addr >= start_addr && addr <= end_addr; };
+
+      valid = std::all_of (instructions_.begin (), instructions_.end (), [&in_rom] (const instruction& insn)
+                {
+                  return in_rom (insn.addr) && insn.size >= 1 && insn.size <= 4 &&
+                         insn.prefix <= instruction::PREFIX_FDCB &&
+                         insn.flow <= instruction::FLOW_JUMP_INDIRECT;
+                }) &&
+              std::all_of (xrefs_.begin (), xrefs_.end (), [&in_rom] (const xref& x)
+                {
+                  return in_rom (x.source) && x.type <= XREF_WORD;   // targets may be outside ROM
+                });
+    }
+
+  if (valid)
+    {
+      std::memcpy (memory_map_.data (), map, sizeof (memory_map_));
+      std::memcpy (entry_points_.data (), bitmap, sizeof (entry_points_));
+      build_regions ();
+    }
+
+  munmap (data, st.st_size);
+
+  return valid;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save navigation results to analysis cache file
+//! \param path File path
+//! \param key Cache key
+//!
+//! Data is written to a temporary file, then renamed, so concurrent runs
+//! never see partial files. Failures are ignored, as the cache is optional.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::save_cache (const std::string& path, std::uint64_t key) const
+{
+  cache_header header;
+  std::memcpy (header.magic, CACHE_MAGIC, sizeof (header.magic));
+  header.version = CACHE_VERSION;
+  header.instruction_size = sizeof (instruction);
+  header.key = key;
+  header.instruction_count = instructions_.size ();
+  header.xref_count = xrefs_.size ();
+
+  const std::uint32_t start_addr = cartridge_.get_start_address ();
+  const std::uint32_t end_addr = cartridge_.get_end_address ();
+
+  const std::string tmp_path = path + ".tmp." + std::to_string (getpid ()) + '.' +
+                               std::to_string (std::hash <std::thread::id> () (std::this_thread::get_id ()));
+
+  try
+    {
+      fs::create_directories (cache_dir_);
+
+      output_sink out (tmp_path);
+      out.write ({reinterpret_cast <const char *> (&header), sizeof (header)});
+      out.write ({reinterpret_cast <const char *> (memory_map_.data ()), sizeof (memory_map_)});
+      out.write ({reinterpret_cast <const char *> (entry_points_.data ()), sizeof (entry_points_)});
+      out.write ({reinterpret_cast <const char *> (cartridge_.get_data () + start_addr), end_addr - start_addr + 1u});
+      out.write ({reinterpret_cast <const char *> (instructions_.data ()), instructions_.size () * sizeof (instruction)});
+      out.write ({reinterpret_cast <const char *> (xrefs_.data ()), xrefs_.size () * sizeof (xref)});
+      out.close ();
+
+      fs::rename (tmp_path, path);
+    }
+  catch (const std::exception&)
+    {
+      std::error_code ec;
+      fs::remove (tmp_path, ec);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Build memory map runs, from start to end address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::impl::build_regions ()
+{
+  std::uint32_t start_addr = cartridge_.get_start_address ();
+  std::uint32_t end_addr = cartridge_.get_end_address ();
+
+  regions_.clear ();
+
+  for (std::uint32_t addr = start_addr;addr <= end_addr;addr++)
+    {
+      auto st = memory_map_[addr];
+
+      if (!regions_.empty () && regions_.back ().status == st)
+        regions_.back ().size++;
+
+      else
+        regions_.push_back ({static_cast <addr_type> (addr), 1, st});
+    }
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -326,100 +952,73 @@ navigator::impl::navigate_branch (addr_type pc)
 std::uint8_t
 navigator::impl::navigate_opcode (addr_type pc)
 {
-  std::uint8_t opcode = cartridge_.get_byte (pc);
-  std::uint8_t siz = get_opcode_size (pc);
-  set_status (pc, siz, STATUS_CODE);
-  addr_type ref;
+  const instruction insn = decode (pc);
+  set_status (pc, insn.size, STATUS_CODE);
+  ++decoded_count_;
+  instructions_.push_back (insn);
 
-  switch (opcode)
+  switch (insn.flow)
     {
-      case 0x10:                                // djnz xx
-        ref = cartridge_.get_offset (pc+1);
-        add_entry_point (ref);
+      case instruction::FLOW_DJNZ:              // djnz xx
+        add_xref (pc, insn.target, XREF_DJNZ);
+        add_entry_point (insn.target);
         break;
 
-      case 0x18:                                // jr xx
-        ref = cartridge_.get_offset (pc+1);
-        add_entry_point (ref);
-        return 0;
+      case instruction::FLOW_COND_JUMP:         // jp cc, jr cc
+        add_xref (pc, insn.target, XREF_COND_JUMP);
+        add_entry_point (insn.target);
         break;
-        
-      case 0xc3:                                // jp xxxx
-        ref = cartridge_.get_word (pc+1);
-        add_entry_point (ref);
-        return 0;
+
+      case instruction::FLOW_COND_CALL:         // call cc
+        add_xref (pc, insn.target, XREF_COND_CALL);
+        add_entry_point (insn.target);
         break;
 
-      case 0xc9:                                // ret
+      case instruction::FLOW_JUMP:              // jp xxxx, jr xx
+        add_xref (pc, insn.target, XREF_JUMP);
+        add_entry_point (insn.target);
         return 0;
         break;
 
-      case 0xcd:                                // call
-        ref = cartridge_.get_word (pc+1);
-        
-        if (ref == swtcha_)
+      case instruction::FLOW_CALL:              // call
+        add_xref (pc, insn.target, XREF_CALL);
+
+        if (is_jump_table (insn.target))
           {
-            navigate_swtcha (pc);
+            navigate_jump_table (pc);
             return 0;
           }
 
         else
-          add_entry_point (ref);
+          add_entry_point (insn.target);
 
         break;
 
-      case 0xdd:                                // ix
-      case 0xfd:                                // iy
-        if (cartridge_.get_byte (pc + 1) == 0xe9)   // jp (ix/iy)
-          return 0;
-        break;
-
-      case 0xe9:                                // jp (hl)
+      case instruction::FLOW_RETURN:            // ret
+      case instruction::FLOW_JUMP_INDIRECT:     // jp (hl), jp (ix/iy)
         return 0;
         break;
-        
-      case 0xc4:                                // call cc
-      case 0xcc:
-      case 0xd4:
-      case 0xdc:
-      case 0xe4:
-      case 0xec:
-      case 0xf4:
-      case 0xfc:
-        ref = cartridge_.get_word (pc+1);
-        add_entry_point (ref);
-        break;
 
-      case 0xc2:                                // jp cc
-      case 0xca:
-      case 0xd2:
-      case 0xda:
-      case 0xe2:
-      case 0xea:
-      case 0xf2:
-      case 0xfa:
-        ref = cartridge_.get_word (pc+1);
-        add_entry_point (ref);
+      case instruction::FLOW_NONE:              // ld a,(xxxx), ld (xxxx),hl...
+        if (get_opcode_descriptor (insn.prefix, insn.opcode).operands[0] == OPERAND_ADDR &&
+            insn.target >= cartridge_.get_start_address () &&
+            insn.target <= cartridge_.get_end_address ())
+          add_xref (pc, insn.target, XREF_WORD);
         break;
 
-      case 0x20:                                // jr cc
-      case 0x28:
-      case 0x30:
-      case 0x38:
-        ref = cartridge_.get_offset (pc+1);
-        add_entry_point (ref);
+      default:
         break;
     }
 
-  return siz;
+  return insn.size;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Navigate through SWTCHA code structure
-//! \param pc Address
+//! \brief Navigate through jump table following a call to a dispatcher
+//! \param pc Call instruction address
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-navigator::impl::navigate_swtcha (addr_type pc)
+navigator::impl::navigate_jump_table (addr_type pc)
 {
   pc += 3;
   addr_type addr_end = cartridge_.get_word (pc);
@@ -427,6 +1026,7 @@ navigator::impl::navigate_swtcha (addr_type pc)
   while (pc < addr_end)
     {
       addr_type ref = cartridge_.get_word (pc);
+      add_xref (pc, ref, XREF_TABLE);
       add_entry_point (ref);
       set_status (pc, 2, STATUS_DW);
       pc += 2;
@@ -448,9 +1048,20 @@ navigator::navigator ()
 void
 navigator::navigate (const cartridge& cart)
 {
+  trace_span span ("navigator::navigate");
   impl_->navigate (cart);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set analysis cache directory
+//! \param path Directory path (empty = no cache)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::set_cache_dir (const std::string& path)
+{
+  impl_->set_cache_dir (path);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get opcode size
 //! \param pc Address
@@ -462,6 +1073,48 @@ navigator::get_opcode_size (addr_type pc) const
   return impl_->get_opcode_size (pc);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Decode instruction
+//! \param pc Address
+//! \return Decoded instruction
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+instruction
+navigator::decode (addr_type pc) const
+{
+  return impl_->decode (pc);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get instructions decoded while navigating
+//! \return Instructions, sorted by address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const std::vector <instruction>&
+navigator::get_instructions () const
+{
+  return impl_->get_instructions ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get memory map runs
+//! \return Regions, sorted by address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const std::vector <navigator::region>&
+navigator::get_regions () const
+{
+  return impl_->get_regions ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get address status
+//! \param pc Memory pos
+//! \return Status
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+navigator::status_type
+navigator::get_status (addr_type pc) const
+{
+  return impl_->get_status (pc);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Check if address content is DB (single byte)
 //! \param pc Memory pos
@@ -517,6 +1170,46 @@ navigator::is_entry_point (addr_type pc) const
   return impl_->is_entry_point (pc);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get entry points
+//! \return Entry points, sorted by address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <navigator::addr_type>
+navigator::get_entry_points () const
+{
+  return impl_->get_entry_points ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get routines called from navigated code, with their fingerprints
+//! \return Routines, sorted by address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <navigator::routine>
+navigator::get_routines () const
+{
+  return impl_->get_routines ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get cross references found while navigating
+//! \return Cross references, sorted by target and source address
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const std::vector <navigator::xref>&
+navigator::get_xrefs () const
+{
+  return impl_->get_xrefs ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get navigation counters
+//! \param stats Statistics, counters added to
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::get_statistics (statistics& stats) const
+{
+  impl_->get_statistics (stats);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Add entry point to the navigation queue
 //! \param pc Address
@@ -524,7 +1217,31 @@ navigator::is_entry_point (addr_type pc) const
 void
 navigator::add_entry_point (addr_type pc)
 {
-  impl_->add_entry_point (pc);
+  impl_->add_user_entry_point (pc);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load code signature file, adding to built-in signatures
+//! \param path File path
+//!
+//! Not to be used with a database shared through set_signatures.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::load_signatures (const std::string& path)
+{
+  impl_->load_signatures (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set shared code signature database
+//! \param db Signature database
+//!
+//! The database is shared, not copied. It must not be modified while in use.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+navigator::set_signatures (const signature_db& db)
+{
+  impl_->set_signatures (db);
 }
 
 } // namespace msxdasm
\ No newline at end of file
@@ -19,8 +19,13 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "cartridge.hpp"
+#include "instruction.hpp"
+#include "signature_db.hpp"
+#include "statistics.hpp"
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace msxdasm
 {
@@ -45,6 +50,53 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   using addr_type = cartridge::addr_type;
 
+  //! \brief Memory status type
+  enum status_type : std::uint8_t
+  {
+    STATUS_UNKNOWN,
+    STATUS_DB,
+    STATUS_DW,
+    STATUS_STRING,
+    STATUS_CODE
+  };
+
+  //! \brief Run of consecutive addresses with the same status
+  struct region
+  {
+    addr_type addr = 0;
+    std::uint32_t size = 0;
+    status_type status = STATUS_UNKNOWN;
+  };
+
+  //! \brief Cross reference type
+  enum xref_type : std::uint8_t
+  {
+    XREF_CALL,                  // call xxxx
+    XREF_COND_CALL,             // call cc,xxxx
+    XREF_JUMP,                  // jp xxxx, jr xx
+    XREF_COND_JUMP,             // jp cc,xxxx, jr cc,xx
+    XREF_DJNZ,                  // djnz xx
+    XREF_TABLE,                 // jump table entry (dw)
+    XREF_WORD                   // data word, e.g. cartridge header or ld a,(xxxx)
+  };
+
+  //! \brief Cross reference, from source address to target address
+  struct xref
+  {
+    addr_type target = 0;
+    addr_type source = 0;
+    xref_type type = XREF_CALL;
+    std::uint8_t reserved = 0;          // explicit padding, cached as raw bytes
+  };
+
+  //! \brief Routine called from navigated code
+  struct routine
+  {
+    addr_type addr = 0;
+    std::uint16_t size = 0;
+    std::uint64_t fingerprint = 0;      // hash of code, with absolute operands masked
+  };
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -62,12 +114,23 @@ public:
   // Prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   std::uint8_t get_opcode_size (addr_type) const;
+  instruction decode (addr_type) const;
+  const std::vector <instruction>& get_instructions () const;
+  const std::vector <region>& get_regions () const;
+  status_type get_status (addr_type) const;
   bool is_db (addr_type) const;
   bool is_dw (addr_type) const;
   bool is_string (addr_type) const;
   bool is_code (addr_type) const;
   bool is_entry_point (addr_type) const;
+  std::vector <addr_type> get_entry_points () const;
+  std::vector <routine> get_routines () const;
+  const std::vector <xref>& get_xrefs () const;
+  void get_statistics (statistics&) const;
   void add_entry_point (addr_type);
+  void set_cache_dir (const std::string&);
+  void load_signatures (const std::string&);
+  void set_signatures (const signature_db&);
   void navigate (const cartridge&);
 };
 
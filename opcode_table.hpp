@@ -0,0 +1,1329 @@
+#ifndef MSXDASM_OPCODE_TABLE_HPP
+#define MSXDASM_OPCODE_TABLE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "instruction.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Operand types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+enum operand_type : std::uint8_t
+{
+  OPERAND_NONE,
+  OPERAND_BYTE,                 // %byte%
+  OPERAND_WORD,                 // %word%
+  OPERAND_ADDR,                 // %addr%
+  OPERAND_RELADDR,              // %reladdr%
+  OPERAND_DISP                  // %disp%, index displacement in decimal
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Format program operation types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+enum format_op_type : std::uint8_t
+{
+  FORMAT_LITERAL,               // literal text span
+  FORMAT_BYTE,                  // %byte%
+  FORMAT_WORD,                  // %word%
+  FORMAT_ADDR,                  // %addr%
+  FORMAT_RELADDR,               // %reladdr%
+  FORMAT_DISP,                  // %disp%
+  FORMAT_REGW                   // %regw%
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Format program operation
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct format_op
+{
+  //! \brief Operation type
+  format_op_type type = FORMAT_LITERAL;
+
+  //! \brief Literal span offset into opcode text
+  std::uint8_t offset = 0;
+
+  //! \brief Literal span length
+  std::uint8_t length = 0;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Format program: opcode text tokenized into literals and operands
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct format_program
+{
+  //! \brief Operations
+  format_op ops[8] = {};
+
+  //! \brief Number of operations
+  std::uint8_t count = 0;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Opcode descriptor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct opcode_descriptor
+{
+  //! \brief Opcode text, with %var% operand placeholders
+  std::string_view text;
+
+  //! \brief Operand types, in text order
+  operand_type operands[2] = {OPERAND_NONE, OPERAND_NONE};
+
+  //! \brief Text tokenized at compile time
+  format_program format;
+
+  //! \brief Opcode size in bytes, including prefixes (0 for DD, ED, FD)
+  std::uint8_t size = 0;
+
+  //! \brief Control flow kind
+  instruction::flow_type flow = instruction::FLOW_NONE;
+
+  //! \brief T-states (not taken, for conditional opcodes)
+  std::uint8_t tstates = 0;
+
+  //! \brief T-states, when branch is taken (or block instruction repeats)
+  std::uint8_t tstates_taken = 0;
+};
+
+namespace detail
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief CB opcode operations
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::string_view CB_OP[] =
+{
+  "rlc",
+  "rrc",
+  "rl",
+  "rr",
+  "sla",
+  "sra",
+  "sll",
+  "srl"
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief 8-bit registers
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::string_view REG8[] =
+{
+  "b",
+  "c",
+  "d",
+  "e",
+  "h",
+  "l",
+  "(hl)",
+  "a"
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief General opcode texts
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::string_view OPCODE_TEXT[256] =
+{
+  "nop",
+  "ld\tbc,%word%",
+  "ld\t(bc),a",
+  "inc\tbc",
+  "inc\tb",
+  "dec\tb",
+  "ld\tb,%byte%",
+  "rlca",
+  "ex\taf,af'",
+  "add\thl,bc",
+  "ld\ta,(bc)",
+  "dec\tbc",
+  "inc\tc",
+  "dec\tc",
+  "ld\tc,%byte%",
+  "rla",
+  "djnz\t%reladdr%",
+  "ld\tde,%word%",
+  "ld\t(de),a",
+  "inc\tde",
+  "inc\td",
+  "dec\td",
+  "ld\td,%byte%",
+  "rrca",
+  "jr\t%reladdr%",
+  "add\thl,de",
+  "ld\ta,(de)",
+  "dec\tde",
+  "inc\te",
+  "dec\te",
+  "ld\te,%byte%",
+  "rra",
+  "jr\tnz,%reladdr%",
+  "ld\thl,%word%",
+  "ld\t(%addr%),hl",
+  "inc\thl",
+  "inc\th",
+  "dec\th",
+  "ld\th,%byte%",
+  "daa",
+  "jr\tz,%reladdr%",
+  "add\thl,hl",
+  "ld\thl,(%addr%)",
+  "dec\thl",
+  "inc\tl",
+  "dec\tl",
+  "ld\tl,%byte%",
+  "cpl",
+  "jr\tnc,%reladdr%",
+  "ld\tsp,%word%",
+  "ld\t(%addr%),a",
+  "inc\tsp",
+  "inc\t(hl)",
+  "dec\t(hl)",
+  "ld\t(hl),%byte%",
+  "scf",
+  "jr\tc,%reladdr%",
+  "add\thl,sp",
+  "ld\ta,(%addr%)",
+  "dec\tsp",
+  "inc\ta",
+  "dec\ta",
+  "ld\ta,%byte%",
+  "ccf",
+  "ld\tb,b",
+  "ld\tb,c",
+  "ld\tb,d",
+  "ld\tb,e",
+  "ld\tb,h",
+  "ld\tb,l",
+  "ld\tb,(hl)",
+  "ld\tb,a",
+  "ld\tc,b",
+  "ld\tc,c",
+  "ld\tc,d",
+  "ld\tc,e",
+  "ld\tc,h",
+  "ld\tc,l",
+  "ld\tc,(hl)",
+  "ld\tc,a",
+  "ld\td,b",
+  "ld\td,c",
+  "ld\td,d",
+  "ld\td,e",
+  "ld\td,h",
+  "ld\td,l",
+  "ld\td,(hl)",
+  "ld\td,a",
+  "ld\te,b",
+  "ld\te,c",
+  "ld\te,d",
+  "ld\te,e",
+  "ld\te,h",
+  "ld\te,l",
+  "ld\te,(hl)",
+  "ld\te,a",
+  "ld\th,b",
+  "ld\th,c",
+  "ld\th,d",
+  "ld\th,e",
+  "ld\th,h",
+  "ld\th,l",
+  "ld\th,(hl)",
+  "ld\th,a",
+  "ld\tl,b",
+  "ld\tl,c",
+  "ld\tl,d",
+  "ld\tl,e",
+  "ld\tl,h",
+  "ld\tl,l",
+  "ld\tl,(hl)",
+  "ld\tl,a",
+  "ld\t(hl),b",
+  "ld\t(hl),c",
+  "ld\t(hl),d",
+  "ld\t(hl),e",
+  "ld\t(hl),h",
+  "ld\t(hl),l",
+  "halt",
+  "ld\t(hl),a",
+  "ld\ta,b",
+  "ld\ta,c",
+  "ld\ta,d",
+  "ld\ta,e",
+  "ld\ta,h",
+  "ld\ta,l",
+  "ld\ta,(hl)",
+  "ld\ta,a",
+  "add\ta,b",
+  "add\ta,c",
+  "add\ta,d",
+  "add\ta,e",
+  "add\ta,h",
+  "add\ta,l",
+  "add\ta,(hl)",
+  "add\ta,a",
+  "adc\ta,b",
+  "adc\ta,c",
+  "adc\ta,d",
+  "adc\ta,e",
+  "adc\ta,h",
+  "adc\ta,l",
+  "adc\ta,(hl)",
+  "adc\ta,a",
+  "sub\tb",
+  "sub\tc",
+  "sub\td",
+  "sub\te",
+  "sub\th",
+  "sub\tl",
+  "sub\t(hl)",
+  "sub\ta",
+  "sbc\ta,b",
+  "sbc\ta,c",
+  "sbc\ta,d",
+  "sbc\ta,e",
+  "sbc\ta,h",
+  "sbc\ta,l",
+  "sbc\ta,(hl)",
+  "sbc\ta,a",
+  "and\tb",
+  "and\tc",
+  "and\td",
+  "and\te",
+  "and\th",
+  "and\tl",
+  "and\t(hl)",
+  "and\ta",
+  "xor\tb",
+  "xor\tc",
+  "xor\td",
+  "xor\te",
+  "xor\th",
+  "xor\tl",
+  "xor\t(hl)",
+  "xor\ta",
+  "or\tb",
+  "or\tc",
+  "or\td",
+  "or\te",
+  "or\th",
+  "or\tl",
+  "or\t(hl)",
+  "or\ta",
+  "cp\tb",
+  "cp\tc",
+  "cp\td",
+  "cp\te",
+  "cp\th",
+  "cp\tl",
+  "cp\t(hl)",
+  "cp\ta",
+  "ret\tnz",
+  "pop\tbc",
+  "jp\tnz,%addr%",
+  "jp\t%addr%",
+  "call\tnz,%addr%",
+  "push\tbc",
+  "add\ta,%byte%",
+  "rst\t00h",
+  "ret\tz",
+  "ret",
+  "jp\tz,%addr%",
+  "",
+  "call\tz,%addr%",
+  "call\t%addr%",
+  "adc\ta,%byte%",
+  "rst\t08h",
+  "ret\tnc",
+  "pop\tde",
+  "jp\tnc,%addr%",
+  "out\t(%byte%),a",
+  "call\tnc,%addr%",
+  "push\tde",
+  "sub\t%byte%",
+  "rst\t10h",
+  "ret\tc",
+  "exx",
+  "jp\tc,%addr%",
+  "in\ta,(%byte%)",
+  "call\tc,%addr%",
+  "",
+  "sbc\ta,%byte%",
+  "rst\t18h",
+  "ret\tpo",
+  "pop\thl",
+  "jp\tpo,%addr%",
+  "ex\t(sp),hl",
+  "call\tpo,%addr%",
+  "push\thl",
+  "and\t%byte%",
+  "rst\t20h",
+  "ret\tpe",
+  "jp\t(hl)",
+  "jp\tpe,%addr%",
+  "ex\tde,hl",
+  "call\tpe,%addr%",
+  "",
+  "xor\t%byte%",
+  "rst\t28h",
+  "ret\tp",
+  "pop\taf",
+  "jp\tp,%addr%",
+  "di",
+  "call\tp,%addr%",
+  "push\taf",
+  "or\t%byte%",
+  "rst\t30h",
+  "ret\tm",
+  "ld\tsp,hl",
+  "jp\tm,%addr%",
+  "ei",
+  "call\tm,%addr%",
+  "",
+  "cp\t%byte%",
+  "rst\t38h",
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief DD/FD xx opcode texts
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::string_view OPCODE_DDFD_TEXT[256] =
+{
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "add\t%regw%,bc",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "add\t%regw%,de",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\t%regw%,%word%",
+  "ld\t(%addr%),%regw%",
+  "inc\t%regw%",
+  "inc\t%regw%h *",
+  "dec\t%regw%h *",
+  "ld\t%regw%h,%byte%",
+  "nop (2x) *",
+  "nop (2x) *",
+  "add\t%regw%,%regw%",
+  "ld\t%regw%,(%addr%)",
+  "dec\t%regw%",
+  "inc\t%regw%l *",
+  "dec\t%regw%l *",
+  "ld\t%regw%l,%byte%",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "inc\t(%regw% + %byte%)",
+  "dec\t(%regw% + %byte%)",
+  "ld\t(%regw% + %byte%),%byte%",
+  "nop (2x) *",
+  "nop (2x) *",
+  "add\t%regw%,sp",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\tb,%regw%h *",
+  "ld\tb,%regw%l *",
+  "ld\tb,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\tc,%regw%h *",
+  "ld\tc,%regw%l *",
+  "ld\tc,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\td,%regw%h *",
+  "ld\td,%regw%l *",
+  "ld\td,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\te,%regw%h *",
+  "ld\te,%regw%l *",
+  "ld\te,(%regw% + %byte%)",
+  "nop (2x) *",
+  "ld\t%regw%h,b *",
+  "ld\t%regw%h,c *",
+  "ld\t%regw%h,d *",
+  "ld\t%regw%h,e *",
+  "ld\t%regw%h,%regw%h *",
+  "ld\t%regw%h,%regw%l *",
+  "ld\th,(%regw% + %byte%)",
+  "ld\t%regw%h,a *",
+  "ld\t%regw%l,b *",
+  "ld\t%regw%l,c *",
+  "ld\t%regw%l,d *",
+  "ld\t%regw%l,e *",
+  "ld\t%regw%l,%regw%h *",
+  "ld\t%regw%l,%regw%l *",
+  "ld\tl,(%regw% + %byte%)",
+  "ld\t%regw%l,a *",
+  "ld\t(%regw% + %byte%),b",
+  "ld\t(%regw% + %byte%),c",
+  "ld\t(%regw% + %byte%),d",
+  "ld\t(%regw% + %byte%),e",
+  "ld\t(%regw% + %byte%),h",
+  "ld\t(%regw% + %byte%),l",
+  "nop (2x) *",
+  "ld\t(%regw% + %byte%),a",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\ta,%regw%h *",
+  "ld\ta,%regw%l *",
+  "ld\ta,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "add\ta,%regw%h *",
+  "add\ta,%regw%l *",
+  "add\ta,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "adc\ta,%regw%h *",
+  "adc\ta,%regw%l *",
+  "adc\ta,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "sub\t%regw%h *",
+  "sub\t%regw%l *",
+  "sub\t(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "sbc\ta,%regw%h *",
+  "sbc\ta,%regw%l *",
+  "sbc\ta,(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "and\t%regw%h *",
+  "and\t%regw%l *",
+  "and\t(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "xor\t%regw%h *",
+  "xor\t%regw%l *",
+  "xor\t(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "or\t%regw%h *",
+  "or\t%regw%l *",
+  "or\t(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "cp\t%regw%h *",
+  "cp\t%regw%l *",
+  "cp\t(%regw% + %byte%)",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "pop\t%regw%",
+  "nop (2x) *",
+  "ex\t(sp),%regw%",
+  "nop (2x) *",
+  "push\t%regw%",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "jp\t%regw%",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ld\tsp,%regw%",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief ED xx opcode texts, from ED 40 to ED BF
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::string_view OPCODE_ED_TEXT[128] =
+{
+  "in\tb,(c)",          // 0x40
+  "out\t(c),b",
+  "sbc\thl,bc",
+  "ld\t(%addr%),bc",
+  "neg",
+  "ret\tn",
+  "im\t0",
+  "ld\ti,a",
+  "in\tc,(c)",
+  "out\t(c),c",
+  "adc\thl,bc",
+  "ld\tbc,(%addr%)",
+  "neg *",
+  "ret\ti *",
+  "im\t0/1 *",
+  "ld\tr,a",
+  "in\td,(c)",
+  "out\t(c),d",
+  "sbc\thl,de",
+  "ld\t(%addr%),de",
+  "neg *",
+  "ret\tn *",
+  "im\t1",
+  "ld\ta,i",
+  "in\te,(c)",
+  "out\t(c),e",
+  "adc\thl,de",
+  "ld\tde,(%addr%)",
+  "neg *",
+  "ret\ti *",
+  "im\t2",
+  "ld\ta,r",
+  "in\th,(c)",
+  "out\t(c),h",
+  "sbc\thl,hl",
+  "ld\t(%addr%),hl",
+  "neg *",
+  "ret\tn *",
+  "im\t0 *",
+  "rrd",
+  "in\tl,(c)",
+  "out\t(c),l",
+  "adc\thl,hl",
+  "ld\thl,(%addr%)",
+  "neg *",
+  "ret\ti *",
+  "im\t0/1 *",
+  "rld",
+  "in\t(hl),(c)",
+  "out\t(c),(hl)",
+  "sbc\thl,sp",
+  "ld\t(%addr%),sp",
+  "neg *",
+  "ret\tn *",
+  "im\t1 *",
+  "nop (2x) *",
+  "in\ta,(c)",
+  "out\t(c),a",
+  "adc\thl,sp",
+  "ld\tsp,(%addr%)",
+  "neg *",
+  "ret\ti *",
+  "im\t2 *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ldi",
+  "cpi",
+  "ini",
+  "outi",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ldd",
+  "cpd",
+  "ind",
+  "outd",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "ldir",
+  "cpir",
+  "inir",
+  "otir",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "lddr",
+  "cpdr",
+  "indr",
+  "otdr",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+  "nop (2x) *",
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main opcode T-states (not taken, for conditional opcodes)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::uint8_t MAIN_TSTATES[256] =
+{
+   4, 10,  7,  6,  4,  4,  7,  4,  4, 11,  7,  6,  4,  4,  7,  4,      // 00-0f
+   8, 10,  7,  6,  4,  4,  7,  4, 12, 11,  7,  6,  4,  4,  7,  4,      // 10-1f
+   7, 10, 16,  6,  4,  4,  7,  4,  7, 11, 16,  6,  4,  4,  7,  4,      // 20-2f
+   7, 10, 13,  6, 11, 11, 10,  4,  7, 11, 13,  6,  4,  4,  7,  4,      // 30-3f
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // 40-4f
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // 50-5f
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // 60-6f
+   7,  7,  7,  7,  7,  7,  4,  7,  4,  4,  4,  4,  4,  4,  7,  4,      // 70-7f
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // 80-8f
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // 90-9f
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // a0-af
+   4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,      // b0-bf
+   5, 10, 10, 10, 10, 11,  7, 11,  5, 10, 10,  0, 10, 17,  7, 11,      // c0-cf
+   5, 10, 10, 11, 10, 11,  7, 11,  5,  4, 10, 11, 10,  0,  7, 11,      // d0-df
+   5, 10, 10, 19, 10, 11,  7, 11,  5,  4, 10,  4, 10,  0,  7, 11,      // e0-ef
+   5, 10, 10,  4, 10, 11,  7, 11,  5,  6, 10,  4, 10,  0,  7, 11,      // f0-ff
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Text of DD/FD opcodes that act as a single byte NOP
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr std::string_view NOP_TEXT = "nop (2x) *";
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Fixed size text buffer, filled at compile time
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct text_buffer
+{
+  char data[32] = {};
+  std::size_t size = 0;
+
+  constexpr void
+  append (std::string_view s)
+  {
+    for (char c : s)
+      data[size++] = c;
+  }
+
+  constexpr std::string_view
+  view () const
+  {
+    return {data, size};
+  }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Generate CB opcode texts
+//! \param operand Operand text, or empty to use the 8-bit register
+//! \return Opcode texts
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::array <text_buffer, 256>
+make_cb_texts (std::string_view operand)
+{
+  std::array <text_buffer, 256> texts = {};
+
+  for (unsigned int opcode = 0;opcode < 256;opcode++)
+    {
+      auto& text = texts[opcode];
+      const unsigned int key = (opcode >> 6) & 3;
+      const unsigned int op1 = (opcode >> 3) & 7;
+      const char digit[] = { static_cast <char> ('0' + op1), 0 };
+
+      switch (key)
+        {
+          case 0: text.append (CB_OP[op1]); break;
+          case 1: text.append ("bit"); break;
+          case 2: text.append ("res"); break;
+          case 3: text.append ("set"); break;
+        }
+
+      text.append ("\t");
+
+      if (key)
+        {
+          text.append (digit);
+          text.append (",");
+        }
+
+      text.append (operand.empty () ? REG8[opcode & 7] : operand);
+    }
+
+  return texts;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief CB xx opcode texts
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr auto CB_TEXT = make_cb_texts ({});
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief DD/FD CB dd xx opcode texts
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline constexpr auto DDCB_TEXT = make_cb_texts ("(%regw% + %disp%)");
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get format operation type from format variable name
+//! \param var Variable name
+//! \return Format operation type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr format_op_type
+get_format_op_type (std::string_view var)
+{
+  if (var == "addr")
+    return FORMAT_ADDR;
+
+  else if (var == "reladdr")
+    return FORMAT_RELADDR;
+
+  else if (var == "byte")
+    return FORMAT_BYTE;
+
+  else if (var == "word")
+    return FORMAT_WORD;
+
+  else if (var == "disp")
+    return FORMAT_DISP;
+
+  else if (var == "regw")
+    return FORMAT_REGW;
+
+  throw "unknown opcode text variable";
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get operand type of a format operation
+//! \param type Format operation type
+//! \return Operand type (OPERAND_NONE if it takes no opcode bytes)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr operand_type
+get_operand_type (format_op_type type)
+{
+  switch (type)
+    {
+      case FORMAT_BYTE: return OPERAND_BYTE;
+      case FORMAT_WORD: return OPERAND_WORD;
+      case FORMAT_ADDR: return OPERAND_ADDR;
+      case FORMAT_RELADDR: return OPERAND_RELADDR;
+      case FORMAT_DISP: return OPERAND_DISP;
+      default: return OPERAND_NONE;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Tokenize opcode text into a format program
+//! \param text Opcode text
+//! \return Format program
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr format_program
+make_format_program (std::string_view text)
+{
+  format_program program;
+  std::size_t pos = 0;
+  std::size_t pct_pos = text.find ('%');
+
+  while (pct_pos != std::string_view::npos)
+    {
+      if (pct_pos > pos)
+        program.ops[program.count++] = {FORMAT_LITERAL, static_cast <std::uint8_t> (pos), static_cast <std::uint8_t> (pct_pos - pos)};
+
+      auto end_pos = text.find ('%', pct_pos + 1);
+      program.ops[program.count++] = {get_format_op_type (text.substr (pct_pos + 1, end_pos - pct_pos - 1)), 0, 0};
+
+      pos = end_pos + 1;
+      pct_pos = text.find ('%', pos);
+    }
+
+  if (pos < text.size ())
+    program.ops[program.count++] = {FORMAT_LITERAL, static_cast <std::uint8_t> (pos), static_cast <std::uint8_t> (text.size () - pos)};
+
+  return program;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get operand size in bytes
+//! \param type Operand type
+//! \return Size in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint8_t
+get_operand_size (operand_type type)
+{
+  switch (type)
+    {
+      case OPERAND_BYTE:
+      case OPERAND_RELADDR:
+      case OPERAND_DISP:
+        return 1;
+
+      case OPERAND_WORD:
+      case OPERAND_ADDR:
+        return 2;
+
+      default:
+        return 0;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get control flow kind of main opcodes
+//! \param opcode Opcode
+//! \return Flow kind
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr instruction::flow_type
+get_main_flow (std::uint8_t opcode)
+{
+  switch (opcode)
+    {
+      case 0x10:                                // djnz xx
+        return instruction::FLOW_DJNZ;
+
+      case 0x18:                                // jr xx
+      case 0xc3:                                // jp xxxx
+        return instruction::FLOW_JUMP;
+
+      case 0x20:                                // jr cc
+      case 0x28:
+      case 0x30:
+      case 0x38:
+      case 0xc2:                                // jp cc
+      case 0xca:
+      case 0xd2:
+      case 0xda:
+      case 0xe2:
+      case 0xea:
+      case 0xf2:
+      case 0xfa:
+        return instruction::FLOW_COND_JUMP;
+
+      case 0xcd:                                // call
+        return instruction::FLOW_CALL;
+
+      case 0xc4:                                // call cc
+      case 0xcc:
+      case 0xd4:
+      case 0xdc:
+      case 0xe4:
+      case 0xec:
+      case 0xf4:
+      case 0xfc:
+        return instruction::FLOW_COND_CALL;
+
+      case 0xc9:                                // ret
+        return instruction::FLOW_RETURN;
+
+      case 0xc0:                                // ret cc
+      case 0xc8:
+      case 0xd0:
+      case 0xd8:
+      case 0xe0:
+      case 0xe8:
+      case 0xf0:
+      case 0xf8:
+        return instruction::FLOW_COND_RETURN;
+
+      case 0xe9:                                // jp (hl)
+        return instruction::FLOW_JUMP_INDIRECT;
+
+      default:
+        return instruction::FLOW_NONE;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get T-states of ED opcodes
+//! \param opcode Opcode (after ED)
+//! \return T-states, including prefix
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint8_t
+get_ed_tstates (std::uint8_t opcode)
+{
+  if (opcode >= 0x40 && opcode < 0x80)
+    {
+      switch (opcode & 0x07)
+        {
+          case 0: return 12;                    // in r,(c)
+          case 1: return 12;                    // out (c),r
+          case 2: return 15;                    // sbc/adc hl,rr
+          case 3: return 20;                    // ld (xxxx),rr / ld rr,(xxxx)
+          case 4: return 8;                     // neg
+          case 5: return 14;                    // retn / reti
+          case 6: return 8;                     // im x
+        }
+
+      switch (opcode)
+        {
+          case 0x47:                            // ld i,a
+          case 0x4f:                            // ld r,a
+          case 0x57:                            // ld a,i
+          case 0x5f:                            // ld a,r
+            return 9;
+
+          case 0x67:                            // rrd
+          case 0x6f:                            // rld
+            return 18;
+        }
+    }
+
+  else if (opcode >= 0xa0 && opcode < 0xc0 && (opcode & 0x07) < 4)
+    return 16;                                  // block instructions
+
+  return 8;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get table prefix. FD opcodes share the DD table
+//! \param prefix Prefix family
+//! \return Table prefix
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr instruction::prefix_type
+get_table_prefix (instruction::prefix_type prefix)
+{
+  switch (prefix)
+    {
+      case instruction::PREFIX_FD: return instruction::PREFIX_DD;
+      case instruction::PREFIX_FDCB: return instruction::PREFIX_DDCB;
+      default: return prefix;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Build opcode descriptor
+//! \param opcode Opcode (after prefixes)
+//! \return Descriptor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <instruction::prefix_type P>
+constexpr opcode_descriptor
+make_descriptor (std::uint8_t opcode)
+{
+  opcode_descriptor desc;
+
+  // text
+  if constexpr (P == instruction::PREFIX_NONE)
+    desc.text = OPCODE_TEXT[opcode];
+
+  else if constexpr (P == instruction::PREFIX_CB)
+    desc.text = CB_TEXT[opcode].view ();
+
+  else if constexpr (P == instruction::PREFIX_ED)
+    desc.text = (opcode >= 0x40 && opcode < 0xc0) ? OPCODE_ED_TEXT[opcode - 0x40] : NOP_TEXT;
+
+  else if constexpr (P == instruction::PREFIX_DD)
+    desc.text = OPCODE_DDFD_TEXT[opcode];
+
+  else
+    desc.text = DDCB_TEXT[opcode].view ();
+
+  // format program and operands
+  desc.format = make_format_program (desc.text);
+
+  std::uint8_t operand_size = 0;
+  std::uint8_t count = 0;
+
+  for (std::uint8_t i = 0;i < desc.format.count;i++)
+    {
+      auto type = get_operand_type (desc.format.ops[i].type);
+
+      if (type != OPERAND_NONE)
+        {
+          desc.operands[count++] = type;
+          operand_size += get_operand_size (type);
+        }
+    }
+
+  // size, flow and T-states
+  if constexpr (P == instruction::PREFIX_NONE)
+    {
+      if (desc.text.empty ())
+        desc.size = (opcode == 0xcb) ? 2 : 0;     // CB or DD/ED/FD prefix
+      else
+        desc.size = 1 + operand_size;
+
+      desc.flow = get_main_flow (opcode);
+      desc.tstates = MAIN_TSTATES[opcode];
+
+      switch (desc.flow)
+        {
+          case instruction::FLOW_DJNZ: desc.tstates_taken = desc.tstates + 5; break;
+          case instruction::FLOW_COND_CALL: desc.tstates_taken = desc.tstates + 7; break;
+          case instruction::FLOW_COND_RETURN: desc.tstates_taken = desc.tstates + 6; break;
+          case instruction::FLOW_COND_JUMP:
+            desc.tstates_taken = desc.tstates + ((opcode < 0x40) ? 5 : 0);
+            break;
+          default: desc.tstates_taken = desc.tstates;
+        }
+    }
+
+  else if constexpr (P == instruction::PREFIX_CB)
+    {
+      desc.size = 2;
+      desc.tstates = ((opcode & 7) != 6) ? 8 : ((opcode & 0xc0) == 0x40) ? 12 : 15;
+      desc.tstates_taken = desc.tstates;
+    }
+
+  else if constexpr (P == instruction::PREFIX_ED)
+    {
+      desc.size = 2 + operand_size;
+      desc.tstates = get_ed_tstates (opcode);
+      desc.tstates_taken = desc.tstates + ((opcode >= 0xb0 && opcode < 0xc0) ? 5 : 0);
+    }
+
+  else if constexpr (P == instruction::PREFIX_DD)
+    {
+      if (opcode == 0xcb)
+        desc.size = 4;                          // DD CB dd xx
+
+      else if (desc.text == NOP_TEXT)
+        desc.size = 1;                          // prefix alone
+
+      else
+        desc.size = 2 + operand_size;
+
+      if (opcode == 0xe9)                       // jp (ix/iy)
+        desc.flow = instruction::FLOW_JUMP_INDIRECT;
+
+      if (desc.size == 1)
+        desc.tstates = 4;
+
+      else if (desc.text.find ("(%regw% + %byte%)") != std::string_view::npos)
+        desc.tstates = (opcode == 0x36) ? 19 : MAIN_TSTATES[opcode] + 12;
+
+      else
+        desc.tstates = MAIN_TSTATES[opcode] + 4;
+
+      desc.tstates_taken = desc.tstates;
+    }
+
+  else
+    {
+      desc.size = 4;
+      desc.tstates = ((opcode & 0xc0) == 0x40) ? 20 : 23;
+      desc.tstates_taken = desc.tstates;
+    }
+
+  return desc;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Build opcode descriptor table
+//! \return Descriptors, indexed by opcode
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <instruction::prefix_type P>
+constexpr std::array <opcode_descriptor, 256>
+make_descriptor_table ()
+{
+  std::array <opcode_descriptor, 256> table = {};
+
+  for (unsigned int opcode = 0;opcode < 256;opcode++)
+    table[opcode] = make_descriptor <P> (static_cast <std::uint8_t> (opcode));
+
+  return table;
+}
+
+} // namespace detail
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Opcode descriptor tables, one per prefix family
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <instruction::prefix_type P>
+inline constexpr std::array <opcode_descriptor, 256> OPCODE_TABLE = detail::make_descriptor_table <P> ();
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get opcode descriptor, for a prefix known at compile time
+//! \param opcode Opcode (after prefixes)
+//! \return Descriptor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <instruction::prefix_type P>
+constexpr const opcode_descriptor&
+get_opcode_descriptor (std::uint8_t opcode)
+{
+  return OPCODE_TABLE <detail::get_table_prefix (P)>[opcode];
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get opcode descriptor
+//! \param prefix Prefix family
+//! \param opcode Opcode (after prefixes)
+//! \return Descriptor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline const opcode_descriptor&
+get_opcode_descriptor (instruction::prefix_type prefix, std::uint8_t opcode)
+{
+  switch (prefix)
+    {
+      case instruction::PREFIX_CB: return get_opcode_descriptor <instruction::PREFIX_CB> (opcode);
+      case instruction::PREFIX_ED: return get_opcode_descriptor <instruction::PREFIX_ED> (opcode);
+      case instruction::PREFIX_DD:
+      case instruction::PREFIX_FD: return get_opcode_descriptor <instruction::PREFIX_DD> (opcode);
+      case instruction::PREFIX_DDCB:
+      case instruction::PREFIX_FDCB: return get_opcode_descriptor <instruction::PREFIX_DDCB> (opcode);
+      default: return get_opcode_descriptor <instruction::PREFIX_NONE> (opcode);
+    }
+}
+
+namespace detail
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check ED opcode sizes against the Z80 encoding rule
+//! \return true if all sizes match
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr bool
+check_ed_sizes ()
+{
+  for (unsigned int opcode = 0;opcode < 256;opcode++)
+    {
+      const std::uint8_t siz = ((opcode & 0xc7) == 0x43) ? 4 : 2;
+
+      if (OPCODE_TABLE <instruction::PREFIX_ED>[opcode].size != siz)
+        return false;
+    }
+
+  return true;
+}
+
+} // namespace detail
+
+static_assert (detail::check_ed_sizes (), "ED opcode sizes do not match opcode texts");
+static_assert (get_opcode_descriptor <instruction::PREFIX_NONE> (0xcd).size == 3, "call xxxx must be 3 bytes");
+static_assert (get_opcode_descriptor <instruction::PREFIX_NONE> (0xdd).size == 0, "DD is a prefix");
+static_assert (get_opcode_descriptor <instruction::PREFIX_DD> (0x36).size == 4, "ld (ix + dd),xx must be 4 bytes");
+static_assert (get_opcode_descriptor <instruction::PREFIX_DD> (0x00).size == 1, "DD 00 is a single byte nop");
+
+} // namespace msxdasm
+
+#endif // MSXDASM_OPCODE_TABLE_HPP
@@ -0,0 +1,150 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "output_sink.hpp"
+#include "trace.hpp"
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+output_sink::output_sink (const std::string& path)
+  : buffer_ (std::make_unique <char[]> (BUFFER_SIZE))
+{
+  fd_ = ::open (path.c_str (), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+  if (fd_ == -1)
+    throw std::system_error (errno, std::system_category (), "Failed to open file");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param fd Open file descriptor (e.g. STDOUT_FILENO), not closed by sink
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+output_sink::output_sink (int fd)
+  : fd_ (fd), owns_fd_ (false), buffer_ (std::make_unique <char[]> (BUFFER_SIZE))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+//! \param callback Function called with each block of buffered data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+output_sink::output_sink (std::function <void (const char *, std::size_t)> callback)
+  : owns_fd_ (false), callback_ (std::move (callback)), buffer_ (std::make_unique <char[]> (BUFFER_SIZE))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Destructor
+//!
+//! Errors are ignored here. Call close () to get them reported.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+output_sink::~output_sink ()
+{
+  if (fd_ != -1 || callback_)
+    {
+      try
+        {
+          flush ();
+        }
+      catch (const std::exception&)
+        {
+        }
+
+      if (owns_fd_ && fd_ != -1)
+        ::close (fd_);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Write buffered data to file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+output_sink::flush ()
+{
+  if (size_ > 0)
+    {
+      auto size = size_;
+      size_ = 0;
+      write_fd (buffer_.get (), size);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Flush and close file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+output_sink::close ()
+{
+  if (fd_ == -1 && !callback_)
+    return;
+
+  flush ();
+
+  int fd = fd_;
+  fd_ = -1;
+  callback_ = nullptr;
+
+  if (owns_fd_ && ::close (fd) == -1)
+    throw std::system_error (errno, std::system_category (), "Failed to close file");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Write data directly to file descriptor
+//! \param data Data
+//! \param size Size in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+output_sink::write_fd (const char *data, std::size_t size)
+{
+  trace_span span ("output_sink::write");
+
+  if (callback_)
+    {
+      callback_ (data, size);
+      bytes_written_ += size;
+      return;
+    }
+
+  while (size > 0)
+    {
+      auto count = ::write (fd_, data, size);
+
+      if (count == -1)
+        {
+          if (errno == EINTR)
+            continue;
+
+          throw std::system_error (errno, std::system_category (), "Failed to write file");
+        }
+
+      data += count;
+      size -= count;
+      bytes_written_ += count;
+    }
+}
+
+} // namespace msxdasm
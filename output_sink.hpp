@@ -0,0 +1,162 @@
+#ifndef MSXDASM_OUTPUT_SINK_HPP
+#define MSXDASM_OUTPUT_SINK_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Buffered output file
+//!
+//! Text is appended into a large reusable buffer, which is written to the
+//! file descriptor with a single write call whenever it fills up. A write
+//! callback can be used instead of a file descriptor, to render in memory.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class output_sink
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit output_sink (const std::string&);
+  explicit output_sink (int);
+  explicit output_sink (std::function <void (const char *, std::size_t)>);
+  output_sink (const output_sink&) = delete;
+  output_sink (output_sink&&) = delete;
+  ~output_sink ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  output_sink& operator= (const output_sink&) = delete;
+  output_sink& operator= (output_sink&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void flush ();
+  void close ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of bytes written, including buffered ones
+  //! \return Number of bytes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::uint64_t
+  get_bytes_written () const
+  {
+    return bytes_written_ + size_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Append character
+  //! \param c Character
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  put (char c)
+  {
+    if (size_ == BUFFER_SIZE)
+      flush ();
+
+    buffer_[size_++] = c;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Append text
+  //! \param text Text
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  write (std::string_view text)
+  {
+    if (size_ + text.size () > BUFFER_SIZE)
+      {
+        flush ();
+
+        if (text.size () > BUFFER_SIZE)
+          {
+            write_fd (text.data (), text.size ());
+            return;
+          }
+      }
+
+    text.copy (buffer_.get () + size_, text.size ());
+    size_ += text.size ();
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Append uint8_t value in hexa
+  //! \param v Value
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  put_hex (std::uint8_t v)
+  {
+    if (size_ + 2 > BUFFER_SIZE)
+      flush ();
+
+    buffer_[size_++] = HEX_DIGITS[v >> 4];
+    buffer_[size_++] = HEX_DIGITS[v & 0x0f];
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Append uint16_t value in hexa
+  //! \param v Value
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  put_hex (std::uint16_t v)
+  {
+    put_hex (static_cast <std::uint8_t> (v >> 8));
+    put_hex (static_cast <std::uint8_t> (v));
+  }
+
+private:
+  void write_fd (const char *, std::size_t);
+
+  //! \brief Buffer size, in bytes
+  static constexpr std::size_t BUFFER_SIZE = 256 * 1024;
+
+  //! \brief Hexadecimal digits
+  static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+  //! \brief File descriptor
+  int fd_ = -1;
+
+  //! \brief Whether fd_ is closed by close ()
+  bool owns_fd_ = true;
+
+  //! \brief Write callback, used instead of fd_ if set
+  std::function <void (const char *, std::size_t)> callback_;
+
+  //! \brief Buffer
+  std::unique_ptr <char[]> buffer_;
+
+  //! \brief Bytes used in buffer
+  std::size_t size_ = 0;
+
+  //! \brief Bytes written to file descriptor
+  std::uint64_t bytes_written_ = 0;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_OUTPUT_SINK_HPP
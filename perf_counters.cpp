@@ -0,0 +1,192 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "perf_counters.hpp"
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef __linux__
+//! \brief Hardware events, indexed by perf_counters::counter_type
+static constexpr std::uint64_t EVENTS[] =
+{
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Open hardware counter for calling thread and its new threads
+//! \param config Hardware event
+//! \return File descriptor, or -1 if counter is unavailable
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+open_counter (std::uint64_t config)
+{
+  perf_event_attr attr;
+  std::memset (&attr, 0, sizeof (attr));
+
+  attr.size = sizeof (attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return static_cast <int> (syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Read counter
+//! \param fd File descriptor
+//! \return Raw reading (all 0 on failure)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static msxdasm::perf_counters::reading
+read_counter (int fd)
+{
+  std::uint64_t data[3] = {0, 0, 0};  // value, time enabled, time running
+
+  if (::read (fd, data, sizeof (data)) != sizeof (data))
+    return {};
+
+  return {data[0], data[1], data[2]};
+}
+#endif
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Destructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+perf_counters::~perf_counters ()
+{
+  close ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Open counters. Unavailable counters are silently skipped
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+perf_counters::open ()
+{
+  close ();
+
+#ifdef __linux__
+  for (std::size_t i = 0;i < fds_.size ();i++)
+    fds_[i] = open_counter (EVENTS[i]);
+#endif
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Close counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+perf_counters::close ()
+{
+  for (auto& fd : fds_)
+    {
+#ifdef __linux__
+      if (fd != -1)
+        ::close (fd);
+#endif
+      fd = -1;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if at least one counter is available
+//! \return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+perf_counters::is_available () const
+{
+  for (auto fd : fds_)
+    {
+      if (fd != -1)
+        return true;
+    }
+
+  return false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Read counters
+//! \return Raw readings (0 for unavailable counters)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+perf_counters::readings
+perf_counters::read () const
+{
+  readings v = {};
+
+#ifdef __linux__
+  for (std::size_t i = 0;i < fds_.size ();i++)
+    {
+      if (fds_[i] != -1)
+        v[i] = read_counter (fds_[i]);
+    }
+#endif
+
+  return v;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get counter deltas between two readings
+//! \param start Readings at start
+//! \param end Readings at end
+//! \return Counter deltas
+//!
+//! When the kernel multiplexed a counter, the value delta is scaled by the
+//! enabled/running time deltas of the same interval, not by the totals since
+//! the counter was opened. Deltas that would be negative are read as 0.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+perf_counters::values
+perf_counters::get_delta (const readings& start, const readings& end)
+{
+  values v = {};
+
+  for (std::size_t i = 0;i < v.size ();i++)
+    {
+      const auto& s = start[i];
+      const auto& e = end[i];
+
+      if (e.value < s.value || e.time_enabled < s.time_enabled || e.time_running <= s.time_running)
+        continue;
+
+      const std::uint64_t value = e.value - s.value;
+      const std::uint64_t enabled = e.time_enabled - s.time_enabled;
+      const std::uint64_t running = e.time_running - s.time_running;
+
+      if (running < enabled)
+        v[i] = static_cast <std::uint64_t> (static_cast <double> (value) * enabled / running);
+      else
+        v[i] = value;
+    }
+
+  return v;
+}
+
+} // namespace msxdasm
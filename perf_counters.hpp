@@ -0,0 +1,90 @@
+#ifndef MSXDASM_PERF_COUNTERS_HPP
+#define MSXDASM_PERF_COUNTERS_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <array>
+#include <cstdint>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Hardware performance counters (Linux perf_event_open)
+//!
+//! Counters are opened for the calling thread, also counting threads it
+//! creates afterwards. Counters that cannot be opened (e.g. in containers,
+//! or with perf_event_paranoid restrictions) are unavailable and read as 0.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class perf_counters
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  enum counter_type
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    BRANCH_MISSES,
+    COUNTER_COUNT
+  };
+
+  using values = std::array <std::uint64_t, COUNTER_COUNT>;
+
+  //! \brief Raw counter reading, as returned by the kernel
+  struct reading
+  {
+    std::uint64_t value = 0;
+    std::uint64_t time_enabled = 0;
+    std::uint64_t time_running = 0;
+  };
+
+  using readings = std::array <reading, COUNTER_COUNT>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  perf_counters () = default;
+  perf_counters (const perf_counters&) = delete;
+  perf_counters (perf_counters&&) = delete;
+  ~perf_counters ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  perf_counters& operator= (const perf_counters&) = delete;
+  perf_counters& operator= (perf_counters&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void open ();
+  void close ();
+  bool is_available () const;
+  readings read () const;
+  static values get_delta (const readings&, const readings&);
+
+private:
+  //! \brief Counter file descriptors (-1 = unavailable)
+  std::array <int, COUNTER_COUNT> fds_ = {-1, -1, -1, -1};
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_PERF_COUNTERS_HPP
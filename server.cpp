@@ -0,0 +1,712 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "server.hpp"
+#include "disassembler.hpp"
+#include "fingerprint_db.hpp"
+#include "signature_db.hpp"
+#include "symbol_table.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+//! \brief Maximum request header size, in bytes
+static constexpr std::size_t MAX_HEADER_SIZE = 4096;
+
+//! \brief Maximum ROM size, in bytes
+static constexpr std::size_t MAX_ROM_SIZE = 0x10000;
+
+//! \brief Seconds a client may take to send its whole request
+static constexpr int RECEIVE_TIMEOUT = 10;
+
+//! \brief Seconds a single response write may block on a slow client
+static constexpr int SEND_TIMEOUT = 10;
+
+//! \brief Disassembly request
+struct request
+{
+  std::string format = "asm";
+  std::size_t size = 0;
+  std::uint16_t start_addr = 0x4000;
+  std::uint16_t exec_addr = 0;
+  std::vector <std::uint16_t> entry_points;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Parse unsigned number
+//! \param value Text
+//! \param base Numeric base
+//! \param max Maximum value
+//! \return Number
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::size_t
+parse_number (const std::string& value, int base, std::size_t max)
+{
+  std::size_t pos = 0;
+  unsigned long number = 0;
+
+  try
+    {
+      number = std::stoul (value, &pos, base);
+    }
+  catch (const std::logic_error&)
+    {
+      pos = 0;
+    }
+
+  if (value.empty () || pos != value.size () || number > max)
+    throw std::invalid_argument ("invalid value '" + value + "'");
+
+  return number;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Parse request header line
+//! \param header Header line, without newline
+//! \return Request
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static request
+parse_request (const std::string& header)
+{
+  request r;
+  bool has_size = false;
+  std::size_t pos = 0;
+  bool first = true;
+
+  while (pos < header.size ())
+    {
+      auto end = header.find (' ', pos);
+
+      if (end == std::string::npos)
+        end = header.size ();
+
+      const std::string token = header.substr (pos, end - pos);
+      pos = end + 1;
+
+      if (token.empty ())
+        continue;
+
+      if (first)
+        {
+          if (token != "DASM")
+            throw std::invalid_argument ("unknown request '" + token + "'");
+
+          first = false;
+          continue;
+        }
+
+      auto eq = token.find ('=');
+      if (eq == std::string::npos)
+        throw std::invalid_argument ("invalid option '" + token + "'");
+
+      const std::string key = token.substr (0, eq);
+      const std::string value = token.substr (eq + 1);
+
+      if (key == "size")
+        {
+          r.size = parse_number (value, 10, MAX_ROM_SIZE);
+          has_size = true;
+        }
+
+      else if (key == "format")
+        r.format = value;
+
+      else if (key == "start")
+        r.start_addr = static_cast <std::uint16_t> (parse_number (value, 16, 0xffff));
+
+      else if (key == "exec")
+        r.exec_addr = static_cast <std::uint16_t> (parse_number (value, 16, 0xffff));
+
+      else if (key == "entry")
+        r.entry_points.push_back (static_cast <std::uint16_t> (parse_number (value, 16, 0xffff)));
+
+      else
+        throw std::invalid_argument ("unknown option '" + key + "'");
+    }
+
+  if (first)
+    throw std::invalid_argument ("empty request");
+
+  if (!has_size || r.size == 0 || r.size > MAX_ROM_SIZE)
+    throw std::invalid_argument ("invalid ROM size");
+
+  if (r.format != "asm" && r.format != "lst")
+    throw std::invalid_argument ("invalid format '" + r.format + "'");
+
+  return r;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Receive data before a deadline, retrying on EINTR
+//! \param fd Socket
+//! \param data Buffer
+//! \param size Buffer size
+//! \param deadline Time by which the whole request must be received
+//! \return Bytes received (0 = connection closed)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::size_t
+receive (int fd, void *data, std::size_t size, std::chrono::steady_clock::time_point deadline)
+{
+  while (true)
+    {
+      const auto remaining = std::chrono::duration_cast <std::chrono::milliseconds> (deadline - std::chrono::steady_clock::now ());
+
+      if (remaining.count () <= 0)
+        throw std::runtime_error ("timeout receiving request");
+
+      pollfd pfd = {fd, POLLIN, 0};
+      auto ready = ::poll (&pfd, 1, static_cast <int> (remaining.count ()));
+
+      if (ready == 0)
+        throw std::runtime_error ("timeout receiving request");
+
+      if (ready == -1)
+        {
+          if (errno == EINTR)
+            continue;
+
+          throw std::system_error (errno, std::system_category (), "Failed to receive request");
+        }
+
+      auto count = ::recv (fd, data, size, 0);
+
+      if (count != -1)
+        return count;
+
+      if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+        throw std::system_error (errno, std::system_category (), "Failed to receive request");
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Send all data, retrying on partial writes
+//! \param fd Socket
+//! \param text Data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+send_all (int fd, const std::string& text)
+{
+  const char *data = text.data ();
+  std::size_t size = text.size ();
+
+  while (size > 0)
+    {
+      auto count = ::send (fd, data, size, MSG_NOSIGNAL);
+
+      if (count == -1)
+        {
+          if (errno == EINTR)
+            continue;
+
+          throw std::system_error (errno, std::system_category (), "Failed to send response");
+        }
+
+      data += count;
+      size -= count;
+    }
+}
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Server implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class server::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl () = default;
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load .def file into shared definitions
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_def (const std::string& path)
+  {
+    defs_.load_def (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load built-in machine profile into shared definitions
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_profile (const std::string& name)
+  {
+    defs_.load_profile (name);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load routine fingerprint file into shared database
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_fingerprints (const std::string& path)
+  {
+    fingerprints_.load (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Load code signature file into shared database
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  load_signatures (const std::string& path)
+  {
+    signatures_.load (path);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set analysis cache directory (empty = no cache)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_cache_dir (const std::string& path)
+  {
+    cache_dir_ = path;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set number of worker threads (0 = number of cores)
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_jobs (unsigned int jobs)
+  {
+    jobs_ = jobs;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Set maximum number of connections waiting for a worker
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void
+  set_queue_size (std::size_t size)
+  {
+    queue_size_ = std::max <std::size_t> (1, size);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void run (const std::string&);
+  void stop () noexcept;
+
+private:
+  void worker ();
+  void serve (int) const;
+
+  //! \brief Shared definitions, loaded once for all requests
+  symbol_table defs_;
+
+  //! \brief Shared routine fingerprints, loaded once for all requests
+  fingerprint_db fingerprints_;
+
+  //! \brief Shared code signatures, loaded once for all requests
+  signature_db signatures_;
+
+  //! \brief Analysis cache directory
+  std::string cache_dir_;
+
+  //! \brief Number of worker threads
+  unsigned int jobs_ = 0;
+
+  //! \brief Maximum number of queued connections
+  std::size_t queue_size_ = 64;
+
+  //! \brief Listening socket
+  std::atomic <int> listen_fd_ = -1;
+
+  //! \brief Stop flag
+  std::atomic <bool> stopping_ = false;
+
+  //! \brief Connections waiting for a worker
+  std::deque <int> queue_;
+
+  //! \brief Mutex protecting queue_
+  std::mutex queue_mutex_;
+
+  //! \brief Signaled when a connection is queued or server stops
+  std::condition_variable queue_cv_;
+
+  //! \brief Signaled when a connection is taken from the queue
+  std::condition_variable queue_space_cv_;
+
+  //! \brief Mutex protecting std::cerr
+  mutable std::mutex log_mutex_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Listen on Unix socket and serve requests until stop is called
+//! \param path Socket path. Existing socket file is replaced
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::impl::run (const std::string& path)
+{
+  sockaddr_un addr;
+  std::memset (&addr, 0, sizeof (addr));
+  addr.sun_family = AF_UNIX;
+
+  if (path.size () >= sizeof (addr.sun_path))
+    throw std::invalid_argument ("socket path too long: " + path);
+
+  path.copy (addr.sun_path, path.size ());
+
+  // Create listening socket
+  int fd = ::socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd == -1)
+    throw std::system_error (errno, std::system_category (), "Failed to create socket");
+
+  ::unlink (path.c_str ());
+
+  if (::bind (fd, reinterpret_cast <sockaddr *> (&addr), sizeof (addr)) == -1 ||
+      ::listen (fd, static_cast <int> (queue_size_)) == -1)
+    {
+      auto error = errno;
+      ::close (fd);
+      throw std::system_error (error, std::system_category (), "Failed to listen on " + path);
+    }
+
+  listen_fd_ = fd;
+
+  // Start workers
+  unsigned int jobs = jobs_ ? jobs_ : std::thread::hardware_concurrency ();
+  jobs = std::max (1u, jobs);
+
+  std::vector <std::thread> workers;
+
+  for (unsigned int i = 0;i < jobs;i++)
+    workers.emplace_back (&impl::worker, this);
+
+  // Accept connections, queueing them for workers. When the queue is full,
+  // new connections wait in the listen backlog
+  while (!stopping_)
+    {
+      {
+        std::unique_lock <std::mutex> lock (queue_mutex_);
+
+        if (!queue_space_cv_.wait_for (lock, std::chrono::milliseconds (100),
+                                       [this] { return queue_.size () < queue_size_; }))
+          continue;
+      }
+
+      int client = ::accept4 (fd, nullptr, nullptr, SOCK_CLOEXEC);
+
+      if (client == -1)
+        {
+          if (errno == EINTR || errno == ECONNABORTED)
+            continue;
+
+          if (stopping_)
+            break;
+
+          std::lock_guard <std::mutex> lock (log_mutex_);
+          std::cerr << "Error: accept: " << std::strerror (errno) << '\n';
+          continue;
+        }
+
+      {
+        std::lock_guard <std::mutex> lock (queue_mutex_);
+        queue_.push_back (client);
+      }
+
+      queue_cv_.notify_one ();
+    }
+
+  // Stop workers, after queued connections are served
+  {
+    std::lock_guard <std::mutex> lock (queue_mutex_);
+  }
+
+  queue_cv_.notify_all ();
+
+  for (auto& t : workers)
+    t.join ();
+
+  for (int client : queue_)
+    ::close (client);
+
+  queue_.clear ();
+  listen_fd_ = -1;
+  ::close (fd);
+  ::unlink (path.c_str ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Stop server, waking up accept
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::impl::stop () noexcept
+{
+  stopping_ = true;
+
+  int fd = listen_fd_;
+
+  if (fd != -1)
+    ::shutdown (fd, SHUT_RDWR);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Worker thread loop
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::impl::worker ()
+{
+  while (true)
+    {
+      int client;
+
+      {
+        std::unique_lock <std::mutex> lock (queue_mutex_);
+        queue_cv_.wait (lock, [this] { return stopping_ || !queue_.empty (); });
+
+        if (queue_.empty ())
+          return;
+
+        client = queue_.front ();
+        queue_.pop_front ();
+      }
+
+      queue_space_cv_.notify_one ();
+
+      serve (client);
+      ::close (client);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Serve one request
+//! \param fd Client socket
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::impl::serve (int fd) const
+{
+  bool replied = false;
+
+  try
+    {
+      const auto deadline = std::chrono::steady_clock::now () + std::chrono::seconds (RECEIVE_TIMEOUT);
+
+      timeval timeout = {SEND_TIMEOUT, 0};
+      ::setsockopt (fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof (timeout));
+
+      // Read header line
+      std::vector <std::uint8_t> buffer (MAX_HEADER_SIZE + MAX_ROM_SIZE);
+      std::size_t received = 0;
+      std::size_t header_size = 0;
+
+      while (!header_size)
+        {
+          if (received == MAX_HEADER_SIZE)
+            throw std::invalid_argument ("request header too long");
+
+          auto count = receive (fd, buffer.data () + received, MAX_HEADER_SIZE - received, deadline);
+          if (count == 0)
+            throw std::runtime_error ("connection closed before request");
+
+          auto end = std::find (buffer.begin () + received, buffer.begin () + received + count, '\n');
+          received += count;
+
+          if (end != buffer.begin () + received)
+            header_size = end - buffer.begin () + 1;
+        }
+
+      auto r = parse_request (std::string (buffer.begin (), buffer.begin () + header_size - 1));
+
+      // Read ROM data
+      const std::size_t total = header_size + r.size;
+
+      if (received > total)
+        throw std::invalid_argument ("too much ROM data");
+
+      while (received < total)
+        {
+          auto count = receive (fd, buffer.data () + received, total - received, deadline);
+          if (count == 0)
+            throw std::runtime_error ("connection closed before end of ROM data");
+
+          received += count;
+        }
+
+      // Disassemble
+      disassembler disasm;
+      disasm.set_definitions (defs_);
+      disasm.set_fingerprints (fingerprints_);
+      disasm.set_signatures (signatures_);
+      disasm.set_cache_dir (cache_dir_);
+      disasm.load_rom (buffer.data () + header_size, r.size, r.start_addr);
+
+      if (r.exec_addr)
+        disasm.set_exec_address (r.exec_addr);
+
+      for (auto addr : r.entry_points)
+        disasm.add_entry_point (addr);
+
+      disasm.navigate ();
+
+      // Render before replying, so generation errors are still reported as ERR
+      std::string output;
+      disasm.generate (output, r.format);
+
+      replied = true;
+      send_all (fd, "OK " + std::to_string (output.size ()) + '\n');
+      send_all (fd, output);
+    }
+  catch (const std::exception& e)
+    {
+      if (!replied)
+        {
+          try
+            {
+              std::string message = e.what ();
+              std::replace (message.begin (), message.end (), '\n', ' ');
+              send_all (fd, "ERR " + message + '\n');
+            }
+          catch (const std::exception&)
+            {
+            }
+        }
+
+      std::lock_guard <std::mutex> lock (log_mutex_);
+      std::cerr << "Error: request: " << e.what () << '\n';
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+server::server ()
+  : impl_ (std::make_shared <impl> ())
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load .def file into shared definitions
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::load_def (const std::string& path)
+{
+  impl_->load_def (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load built-in machine profile into shared definitions
+//! \param name Profile name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::load_profile (const std::string& name)
+{
+  impl_->load_profile (name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load routine fingerprint file into shared database
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::load_fingerprints (const std::string& path)
+{
+  impl_->load_fingerprints (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load code signature file into shared database
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::load_signatures (const std::string& path)
+{
+  impl_->load_signatures (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set analysis cache directory
+//! \param path Directory path (empty = no cache)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::set_cache_dir (const std::string& path)
+{
+  impl_->set_cache_dir (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set number of worker threads
+//! \param jobs Number of threads (0 = number of cores)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::set_jobs (unsigned int jobs)
+{
+  impl_->set_jobs (jobs);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set maximum number of connections waiting for a worker
+//! \param size Queue size. Connections beyond it wait in the listen backlog
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::set_queue_size (std::size_t size)
+{
+  impl_->set_queue_size (size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Listen on Unix socket and serve requests until stop is called
+//! \param path Socket path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::run (const std::string& path)
+{
+  impl_->run (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Stop server, after queued requests are served
+//!
+//! Safe to call from a signal handler.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+server::stop () noexcept
+{
+  impl_->stop ();
+}
+
+} // namespace msxdasm
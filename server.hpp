@@ -0,0 +1,78 @@
+#ifndef MSXDASM_SERVER_HPP
+#define MSXDASM_SERVER_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <string>
+#include <memory>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Server class, serving disassembly requests over a Unix socket
+//!
+//! Definitions, fingerprints and signatures are loaded once and shared by all
+//! requests. Connections are queued and served by a fixed worker pool.
+//! Each connection carries one request:
+//!
+//!   client: DASM size=<n> [format=asm|lst] [start=<hex>] [exec=<hex>]
+//!           [entry=<hex>]...\n<n bytes of ROM data>
+//!   server: OK <n>\n<n bytes of output>
+//!       or: ERR <message>\n
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class server
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  server ();
+  server (const server&) = default;
+  server (server&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  server& operator= (const server&) = default;
+  server& operator= (server&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void load_def (const std::string&);
+  void load_profile (const std::string&);
+  void load_fingerprints (const std::string&);
+  void load_signatures (const std::string&);
+  void set_cache_dir (const std::string&);
+  void set_jobs (unsigned int);
+  void set_queue_size (std::size_t);
+  void run (const std::string&);
+  void stop () noexcept;
+
+private:
+  //! \brief Forward declaration
+  class impl;
+
+  //! \brief Smart pointer to implementation instance
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_SERVER_HPP
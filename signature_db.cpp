@@ -0,0 +1,310 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "signature_db.hpp"
+#include "signature_scanner.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+//! \brief Blank characters, used as field separators
+static constexpr std::string_view BLANKS = " \t\r\f\v";
+
+//! \brief FNV-1a hash offset basis
+static constexpr std::uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+
+//! \brief Built-in code signature
+struct builtin_signature
+{
+  const char *name;
+  msxdasm::signature_db::action_type action;
+  const char *pattern;
+};
+
+//! \brief Built-in code signatures
+static constexpr builtin_signature BUILTIN_SIGNATURES[] =
+{
+  // Konami: add a,a; pop hl; call xxxx; jp (hl)
+  {"swtcha", msxdasm::signature_db::ACTION_JUMP_TABLE, "87 E1 CD ?? ?? E9"},
+
+  // Main ROM call stub: ld iy,(EXPTBL-1); ld ix,xxxx; jp CALSLT
+  // Usually reached through hooks or pointer tables only
+  {"calslt_stub", msxdasm::signature_db::ACTION_ENTRY_POINT, "FD 2A C0 FC DD 21 ?? ?? C3 1C 00"},
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Update FNV-1a hash with text bytes
+//! \param hash Current hash
+//! \param text Text
+//! \return New hash
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::uint64_t
+fnv1a (std::uint64_t hash, std::string_view text)
+{
+  for (auto c : text)
+    {
+      hash ^= static_cast <std::uint8_t> (c);
+      hash *= 0x100000001b3ULL;
+    }
+
+  return hash;
+}
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Signature database implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class signature_db::impl
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl ();
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of signatures
+  //! \return Number of signatures
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  size () const
+  {
+    return actions_.size ();
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get hash of all signatures, used in analysis cache keys
+  //! \return Hash value
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::uint64_t
+  get_key () const
+  {
+    return key_;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void add (std::string_view, action_type, std::string_view);
+  void load (const std::string&);
+  std::vector <match> scan (const std::uint8_t *, std::size_t) const;
+
+private:
+  //! \brief Pattern scanner, one pattern per signature
+  signature_scanner scanner_;
+
+  //! \brief Signature actions, by pattern index
+  std::vector <action_type> actions_;
+
+  //! \brief Hash of signature actions and patterns
+  std::uint64_t key_ = FNV_OFFSET;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor, adding built-in signatures
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+signature_db::impl::impl ()
+{
+  for (const auto& sig : BUILTIN_SIGNATURES)
+    add (sig.name, sig.action, sig.pattern);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add signature
+//! \param name Signature name
+//! \param action Action taken at each match
+//! \param pattern Pattern text, hex bytes or ?? separated by blanks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+signature_db::impl::add (std::string_view name, action_type action, std::string_view pattern)
+{
+  if (name.empty () || name.find_first_of (BLANKS) != std::string_view::npos)
+    throw std::invalid_argument ("invalid signature name '" + std::string (name) + "'");
+
+  if (action != ACTION_ENTRY_POINT && action != ACTION_JUMP_TABLE)
+    throw std::invalid_argument ("invalid action for signature '" + std::string (name) + "'");
+
+  scanner_.add_pattern (pattern);
+  actions_.push_back (action);
+
+  key_ = fnv1a (key_, std::string_view (action == ACTION_JUMP_TABLE ? "T" : "E"));
+  key_ = fnv1a (key_, pattern);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load signature file
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+signature_db::impl::load (const std::string& path)
+{
+  std::ifstream fp (path);
+
+  if (!fp)
+    throw std::runtime_error ("Failed to open " + path);
+
+  std::string text;
+  std::size_t lineno = 0;
+
+  while (std::getline (fp, text))
+    {
+      ++lineno;
+      std::string_view line (text);
+      const std::string where = path + ':' + std::to_string (lineno) + ": ";
+
+      auto pos = line.find_first_not_of (BLANKS);
+      if (pos == std::string_view::npos || line[pos] == ';' || line[pos] == '#')
+        continue;
+
+      line.remove_prefix (pos);
+      pos = std::min (line.find_first_of (BLANKS), line.size ());
+      const std::string_view name = line.substr (0, pos);
+
+      line.remove_prefix (pos);
+      pos = line.find_first_not_of (BLANKS);
+
+      if (pos == std::string_view::npos)
+        throw std::runtime_error (where + "missing signature action");
+
+      line.remove_prefix (pos);
+      pos = std::min (line.find_first_of (BLANKS), line.size ());
+      const std::string_view token = line.substr (0, pos);
+      action_type action;
+
+      if (token == "entry_point")
+        action = ACTION_ENTRY_POINT;
+
+      else if (token == "jump_table")
+        action = ACTION_JUMP_TABLE;
+
+      else
+        throw std::runtime_error (where + "invalid signature action '" + std::string (token) + "'");
+
+      line.remove_prefix (pos);
+      pos = line.find_first_not_of (BLANKS);
+
+      if (pos == std::string_view::npos)
+        throw std::runtime_error (where + "missing signature pattern");
+
+      std::string_view pattern = line.substr (pos);
+      pattern.remove_suffix (pattern.size () - pattern.find_last_not_of (BLANKS) - 1);
+
+      try
+        {
+          add (name, action, pattern);
+        }
+      catch (const std::invalid_argument& e)
+        {
+          throw std::runtime_error (where + e.what ());
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Scan data for all signatures, in a single pass
+//! \param data Data pointer
+//! \param size Data size in bytes
+//! \return Matches, sorted by offset
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <signature_db::match>
+signature_db::impl::scan (const std::uint8_t *data, std::size_t size) const
+{
+  std::vector <match> matches;
+
+  for (const auto& m : scanner_.scan (data, size))
+    matches.push_back ({m.offset, actions_[m.pattern]});
+
+  return matches;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+signature_db::signature_db ()
+  : impl_ (std::make_shared <impl> ())
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get number of signatures, including built-in ones
+//! \return Number of signatures
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+signature_db::size () const
+{
+  return impl_->size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get hash of all signatures, used in analysis cache keys
+//! \return Hash value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+signature_db::get_key () const
+{
+  return impl_->get_key ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add signature
+//! \param name Signature name
+//! \param action Action taken at each match
+//! \param pattern Pattern text, hex bytes or ?? separated by blanks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+signature_db::add (std::string_view name, action_type action, std::string_view pattern)
+{
+  impl_->add (name, action, pattern);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load signature file
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+signature_db::load (const std::string& path)
+{
+  impl_->load (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Scan data for all signatures, in a single pass
+//! \param data Data pointer
+//! \param size Data size in bytes
+//! \return Matches, sorted by offset
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <signature_db::match>
+signature_db::scan (const std::uint8_t *data, std::size_t size) const
+{
+  return impl_->scan (data, size);
+}
+
+} // namespace msxdasm
@@ -0,0 +1,91 @@
+#ifndef MSXDASM_SIGNATURE_DB_HPP
+#define MSXDASM_SIGNATURE_DB_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <vector>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Code signature database
+//!
+//! Holds byte patterns of well-known code (e.g. Konami swtcha) and the action
+//! taken by the navigator at each match. Built-in signatures are always
+//! present. Files have one signature per line: a name, an action
+//! (entry_point or jump_table) and a pattern, as hex bytes or ?? wildcards,
+//! separated by blanks.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class signature_db
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Action taken when a signature is found
+  enum action_type : std::uint8_t
+  {
+    ACTION_ENTRY_POINT,         // add match address as entry point
+    ACTION_JUMP_TABLE           // jump table dispatcher, table follows each call
+  };
+
+  //! \brief Signature match
+  struct match
+  {
+    std::size_t offset;         // pattern start offset in data
+    action_type action;         // action of signature found
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  signature_db ();
+  signature_db (const signature_db&) = default;
+  signature_db (signature_db&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  signature_db& operator= (const signature_db&) = default;
+  signature_db& operator= (signature_db&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t size () const;
+  std::uint64_t get_key () const;
+  void add (std::string_view, action_type, std::string_view);
+  void load (const std::string&);
+  std::vector <match> scan (const std::uint8_t *, std::size_t) const;
+
+private:
+  //! \brief Forward declaration
+  class impl;
+
+  //! \brief Smart pointer to implementation instance
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_SIGNATURE_DB_HPP
@@ -0,0 +1,151 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "signature_scanner.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get hex digit value
+//! \param c Character
+//! \return Value, or -1 if c is not an hex digit
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+hex_value (char c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+
+  return -1;
+}
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add pattern
+//! \param text Pattern text, hex bytes or ?? separated by blanks
+//! \return Pattern index
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+signature_scanner::add_pattern (std::string_view text)
+{
+  pattern p;
+  std::size_t pos = 0;
+
+  while (pos < text.size ())
+    {
+      if (text[pos] == ' ' || text[pos] == '\t')
+        {
+          ++pos;
+          continue;
+        }
+
+      if (pos + 2 > text.size () ||
+          (pos + 2 < text.size () && text[pos + 2] != ' ' && text[pos + 2] != '\t'))
+        throw std::invalid_argument ("invalid signature token in '" + std::string (text) + "'");
+
+      if (text[pos] == '?' && text[pos + 1] == '?')
+        {
+          p.bytes.push_back (0);
+          p.mask.push_back (0);
+        }
+
+      else
+        {
+          int hi = hex_value (text[pos]);
+          int lo = hex_value (text[pos + 1]);
+
+          if (hi == -1 || lo == -1)
+            throw std::invalid_argument ("invalid signature token in '" + std::string (text) + "'");
+
+          p.bytes.push_back (static_cast <std::uint8_t> (hi * 16 + lo));
+          p.mask.push_back (0xff);
+        }
+
+      pos += 2;
+    }
+
+  auto iter = std::find (p.mask.begin (), p.mask.end (), 0xff);
+
+  if (iter == p.mask.end ())
+    throw std::invalid_argument ("signature '" + std::string (text) + "' has no fixed bytes");
+
+  p.anchor = iter - p.mask.begin ();
+
+  const std::size_t idx = patterns_.size ();
+  buckets_[p.bytes[p.anchor]].push_back (static_cast <std::uint32_t> (idx));
+  patterns_.push_back (std::move (p));
+
+  return idx;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Scan data for all patterns, in a single pass
+//! \param data Data pointer
+//! \param size Data size in bytes
+//! \return Matches, sorted by offset and pattern index
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <signature_scanner::match>
+signature_scanner::scan (const std::uint8_t *data, std::size_t size) const
+{
+  std::vector <match> matches;
+
+  for (std::size_t i = 0;i < size;i++)
+    {
+      for (auto idx : buckets_[data[i]])
+        {
+          const auto& p = patterns_[idx];
+
+          if (i < p.anchor)
+            continue;
+
+          const std::size_t offset = i - p.anchor;
+
+          if (p.bytes.size () > size - offset)
+            continue;
+
+          std::size_t j = p.anchor + 1;
+
+          while (j < p.bytes.size () && (data[offset + j] & p.mask[j]) == p.bytes[j])
+            ++j;
+
+          if (j == p.bytes.size ())
+            matches.push_back ({idx, offset});
+        }
+    }
+
+  std::sort (matches.begin (), matches.end (), [] (const match& a, const match& b)
+    {
+      return a.offset < b.offset || (a.offset == b.offset && a.pattern < b.pattern);
+    });
+
+  return matches;
+}
+
+} // namespace msxdasm
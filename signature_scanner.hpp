@@ -0,0 +1,97 @@
+#ifndef MSXDASM_SIGNATURE_SCANNER_HPP
+#define MSXDASM_SIGNATURE_SCANNER_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Multi-pattern byte signature scanner
+//!
+//! Patterns are written as hex bytes, with ?? for wildcards (e.g.
+//! "87 E1 CD ?? ?? E9"). Each pattern is indexed by its first fixed byte, so
+//! the whole image is scanned in a single pass, whatever the number of
+//! patterns, and only patterns anchored at the current byte are compared.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class signature_scanner
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Pattern match
+  struct match
+  {
+    std::size_t pattern;        // pattern index, as returned by add_pattern
+    std::size_t offset;         // pattern start offset in data
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  signature_scanner () = default;
+  signature_scanner (const signature_scanner&) = default;
+  signature_scanner (signature_scanner&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  signature_scanner& operator= (const signature_scanner&) = default;
+  signature_scanner& operator= (signature_scanner&&) = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t add_pattern (std::string_view);
+  std::vector <match> scan (const std::uint8_t *, std::size_t) const;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get number of patterns
+  //! \return Number of patterns
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::size_t
+  get_pattern_count () const
+  {
+    return patterns_.size ();
+  }
+
+private:
+  //! \brief Compiled pattern
+  struct pattern
+  {
+    std::vector <std::uint8_t> bytes;
+    std::vector <std::uint8_t> mask;    // 0xff = fixed byte, 0x00 = wildcard
+    std::size_t anchor;                 // position of first fixed byte
+  };
+
+  //! \brief Patterns, in insertion order
+  std::vector <pattern> patterns_;
+
+  //! \brief Pattern indexes, by anchor byte value
+  std::array <std::vector <std::uint32_t>, 256> buckets_;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_SIGNATURE_SCANNER_HPP
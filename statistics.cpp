@@ -0,0 +1,270 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "statistics.hpp"
+#include "json.hpp"
+#include <cstdio>
+
+namespace
+{
+//! \brief Status names, indexed by navigator::status_type
+static constexpr const char *STATUS_NAMES[] = {"unknown", "db", "dw", "string", "code"};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append formatted seconds
+//! \param text Text
+//! \param seconds Seconds
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+append_seconds (std::string& text, double seconds)
+{
+  char buffer[32];
+  snprintf (buffer, sizeof (buffer), "%.6f", seconds);
+  text += buffer;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append ratio, or "n/a" if denominator is zero
+//! \param text Text
+//! \param num Numerator
+//! \param den Denominator
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+append_ratio (std::string& text, std::uint64_t num, std::uint64_t den)
+{
+  if (den == 0)
+    {
+      text += "n/a";
+      return;
+    }
+
+  char buffer[32];
+  snprintf (buffer, sizeof (buffer), "%.3f", static_cast <double> (num) / den);
+  text += buffer;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append text line with name and value
+//! \param text Text
+//! \param name Name
+//! \param value Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+append_line (std::string& text, const std::string& name, const std::string& value)
+{
+  text += name;
+  text.append (name.size () < 24 ? 24 - name.size () : 1, ' ');
+  text += ": ";
+  text += value;
+  text += '\n';
+}
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add phase wall time, summed with phases of the same name
+//! \param name Phase name
+//! \param seconds Wall time
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+statistics::add_phase (const std::string& name, double seconds)
+{
+  for (auto& p : phases)
+    {
+      if (p.name == name)
+        {
+          p.seconds += seconds;
+          return;
+        }
+    }
+
+  phases.push_back ({name, seconds});
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add time and hardware counter values to phase
+//! \param name Phase name
+//! \param seconds Wall time
+//! \param counters Hardware counter values
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+statistics::add_phase (const std::string& name, double seconds, const perf_counters::values& counters)
+{
+  add_phase (name, seconds);
+
+  for (auto& p : phases)
+    {
+      if (p.name == name)
+        {
+          p.has_counters = true;
+
+          for (std::size_t i = 0;i < counters.size ();i++)
+            p.counters[i] += counters[i];
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Add phase times and counters from other statistics
+//! \param other Statistics
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+statistics::merge (const statistics& other)
+{
+  for (const auto& p : other.phases)
+    {
+      if (p.has_counters)
+        add_phase (p.name, p.seconds, p.counters);
+      else
+        add_phase (p.name, p.seconds);
+    }
+
+  roms += other.roms;
+  instructions_decoded += other.instructions_decoded;
+  entry_points += other.entry_points;
+  duplicate_entry_points += other.duplicate_entry_points;
+  cache_hits += other.cache_hits;
+  symbol_lookups += other.symbol_lookups;
+  output_bytes += other.output_bytes;
+
+  for (std::size_t i = 0;i < status_bytes.size ();i++)
+    status_bytes[i] += other.status_bytes[i];
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Format statistics as human readable text
+//! \return Text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+statistics::to_text () const
+{
+  std::string text;
+
+  for (const auto& p : phases)
+    {
+      std::string value;
+      append_seconds (value, p.seconds);
+      append_line (text, "time." + p.name, value + " s");
+    }
+
+  append_line (text, "roms", std::to_string (roms));
+  append_line (text, "instructions_decoded", std::to_string (instructions_decoded));
+  append_line (text, "entry_points", std::to_string (entry_points));
+  append_line (text, "duplicate_entry_points", std::to_string (duplicate_entry_points));
+  append_line (text, "cache_hits", std::to_string (cache_hits));
+
+  for (std::size_t i = 0;i < status_bytes.size ();i++)
+    append_line (text, std::string ("bytes.") + STATUS_NAMES[i], std::to_string (status_bytes[i]));
+
+  append_line (text, "symbol_lookups", std::to_string (symbol_lookups));
+  append_line (text, "output_bytes", std::to_string (output_bytes));
+
+  // hardware counters, with misses per decoded Z80 instruction
+  for (const auto& p : phases)
+    {
+      if (!p.has_counters)
+        continue;
+
+      const auto& c = p.counters;
+      const std::string prefix = "perf." + p.name + '.';
+      std::string ipc;
+      std::string cache_misses = std::to_string (c[perf_counters::CACHE_MISSES]) + " (";
+      std::string branch_misses = std::to_string (c[perf_counters::BRANCH_MISSES]) + " (";
+
+      append_ratio (ipc, c[perf_counters::INSTRUCTIONS], c[perf_counters::CYCLES]);
+      append_ratio (cache_misses, c[perf_counters::CACHE_MISSES], instructions_decoded);
+      append_ratio (branch_misses, c[perf_counters::BRANCH_MISSES], instructions_decoded);
+
+      append_line (text, prefix + "cycles", std::to_string (c[perf_counters::CYCLES]));
+      append_line (text, prefix + "instructions", std::to_string (c[perf_counters::INSTRUCTIONS]));
+      append_line (text, prefix + "ipc", ipc);
+      append_line (text, prefix + "cache_misses", cache_misses + "/insn)");
+      append_line (text, prefix + "branch_misses", branch_misses + "/insn)");
+    }
+
+  return text;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Format statistics as JSON object
+//! \return JSON text, in a single line
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+statistics::to_json () const
+{
+  std::string text = "{\"phases\":{";
+
+  for (std::size_t i = 0;i < phases.size ();i++)
+    {
+      if (i)
+        text += ',';
+
+      append_json_string (text, phases[i].name);
+      text += ':';
+      append_seconds (text, phases[i].seconds);
+    }
+
+  text += "},\"roms\":" + std::to_string (roms);
+  text += ",\"instructions_decoded\":" + std::to_string (instructions_decoded);
+  text += ",\"entry_points\":" + std::to_string (entry_points);
+  text += ",\"duplicate_entry_points\":" + std::to_string (duplicate_entry_points);
+  text += ",\"cache_hits\":" + std::to_string (cache_hits);
+  text += ",\"status_bytes\":{";
+
+  for (std::size_t i = 0;i < status_bytes.size ();i++)
+    {
+      if (i)
+        text += ',';
+
+      append_json_string (text, STATUS_NAMES[i]);
+      text += ':' + std::to_string (status_bytes[i]);
+    }
+
+  text += "},\"symbol_lookups\":" + std::to_string (symbol_lookups);
+  text += ",\"output_bytes\":" + std::to_string (output_bytes);
+
+  // hardware counters
+  bool first = true;
+
+  for (const auto& p : phases)
+    {
+      if (!p.has_counters)
+        continue;
+
+      const auto& c = p.counters;
+      text += first ? ",\"counters\":{" : ",";
+      first = false;
+
+      append_json_string (text, p.name);
+      text += ":{\"cycles\":" + std::to_string (c[perf_counters::CYCLES]);
+      text += ",\"instructions\":" + std::to_string (c[perf_counters::INSTRUCTIONS]);
+      text += ",\"cache_misses\":" + std::to_string (c[perf_counters::CACHE_MISSES]);
+      text += ",\"branch_misses\":" + std::to_string (c[perf_counters::BRANCH_MISSES]);
+      text += '}';
+    }
+
+  if (!first)
+    text += '}';
+
+  text += "}";
+
+  return text;
+}
+
+} // namespace msxdasm
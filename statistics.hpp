@@ -0,0 +1,153 @@
+#ifndef MSXDASM_STATISTICS_HPP
+#define MSXDASM_STATISTICS_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "perf_counters.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run statistics: phase wall times and counters
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct statistics
+{
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Phase wall time and hardware counters
+  struct phase
+  {
+    std::string name;
+    double seconds = 0.0;
+    bool has_counters = false;
+    perf_counters::values counters = {};
+  };
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Data
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Phases, in execution order
+  std::vector <phase> phases;
+
+  //! \brief ROMs processed
+  std::uint64_t roms = 0;
+
+  //! \brief Instructions decoded while navigating
+  std::uint64_t instructions_decoded = 0;
+
+  //! \brief Entry points discovered
+  std::uint64_t entry_points = 0;
+
+  //! \brief Entry points found again, not queued
+  std::uint64_t duplicate_entry_points = 0;
+
+  //! \brief Navigation results loaded from analysis cache
+  std::uint64_t cache_hits = 0;
+
+  //! \brief Bytes classified, by navigator::status_type
+  std::array <std::uint64_t, 5> status_bytes = {};
+
+  //! \brief Symbol lookups while generating output
+  std::uint64_t symbol_lookups = 0;
+
+  //! \brief Bytes written to output files
+  std::uint64_t output_bytes = 0;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void add_phase (const std::string&, double);
+  void add_phase (const std::string&, double, const perf_counters::values&);
+  void merge (const statistics&);
+  std::string to_text () const;
+  std::string to_json () const;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Scoped timer, adding its lifetime to a statistics phase
+//!
+//! If hardware counters are given and available, their deltas are added to
+//! the phase too.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class phase_timer
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  phase_timer (statistics& stats, const std::string& name, const perf_counters *counters = nullptr)
+    : stats_ (stats), name_ (name)
+  {
+    if (counters && counters->is_available ())
+      {
+        counters_ = counters;
+        start_counters_ = counters->read ();
+      }
+
+    start_ = std::chrono::steady_clock::now ();
+  }
+
+  phase_timer (const phase_timer&) = delete;
+  phase_timer (phase_timer&&) = delete;
+
+  ~phase_timer ()
+  {
+    const std::chrono::duration <double> elapsed = std::chrono::steady_clock::now () - start_;
+
+    if (counters_)
+      {
+        const auto values = perf_counters::get_delta (start_counters_, counters_->read ());
+        stats_.add_phase (name_, elapsed.count (), values);
+      }
+
+    else
+      stats_.add_phase (name_, elapsed.count ());
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  phase_timer& operator= (const phase_timer&) = delete;
+  phase_timer& operator= (phase_timer&&) = delete;
+
+private:
+  //! \brief Statistics
+  statistics& stats_;
+
+  //! \brief Phase name
+  std::string name_;
+
+  //! \brief Start time
+  std::chrono::steady_clock::time_point start_;
+
+  //! \brief Hardware counters (nullptr = none)
+  const perf_counters *counters_ = nullptr;
+
+  //! \brief Hardware counter readings at start
+  perf_counters::readings start_counters_ = {};
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_STATISTICS_HPP
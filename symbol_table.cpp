@@ -16,55 +16,220 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "symbol_table.hpp"
+#include "machine_profile.hpp"
+#include "output_sink.hpp"
+#include "trace.hpp"
+#include <cerrno>
+#include <charconv>
 #include <cstring>
+#include <iterator>
 #include <stdexcept>
-#include <unordered_map>
+#include <string_view>
+#include <system_error>
+#include <vector>
 
-namespace msxdasm
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Symbol image file header
+//!
+//! A symbol image is a header, followed by one slot per address (65536)
+//! and a string pool. It is mmap'ed read-only and used as is.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct image_header
 {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t slot_count;
+  std::uint32_t pool_size;
+  std::uint32_t reserved;
+};
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Symbol struct
+//! \brief Symbol slot, both in memory and in symbol images. Label and
+//! comment are stored back to back in the string pool. Offset 0 means no
+//! symbol.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-struct Symbol
+struct symbol_slot
 {
-  std::uint16_t addr;
-  std::string label;
-  std::string comment;
+  std::uint32_t offset;
+  std::uint16_t label_size;
+  std::uint16_t comment_size;
 };
 
+//! \brief Symbol image magic
+static constexpr char IMAGE_MAGIC[8] = {'M', 'S', 'X', 'D', 'S', 'Y', 'M', 0};
+
+//! \brief Symbol image version. Increment when layout changes
+static constexpr std::uint32_t IMAGE_VERSION = 1;
+
+//! \brief Number of slots, one per address
+static constexpr std::uint32_t SLOT_COUNT = 0x10000;
+
+//! \brief Field separators in .def files
+static constexpr std::string_view BLANKS = " \t\r\f\v";
+
+//! \brief Symbol image pool offset
+static constexpr std::size_t IMAGE_POOL_OFFSET = sizeof (image_header) + SLOT_COUNT * sizeof (symbol_slot);
+
 } // namespace
 
 namespace msxdasm
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Symbol table implementation class
+//!
+//! Symbols are kept in a dense table with one slot per address, pointing
+//! into a string pool. Slots and pool are either owned by the table or
+//! mapped from a symbol image, which is copied only when modified.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class symbol_table::impl
 {
 public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl () = default;
+  impl (const impl&) = delete;
+  impl (impl&&) = delete;
+  ~impl ();
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  impl& operator= (const impl&) = delete;
+  impl& operator= (impl&&) = delete;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get symbol
+  //! \param pc Address
+  //! \param sym Symbol, if found
+  //! \return true if found, false otherwise
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bool
+  get_symbol (addr_type pc, symbol& sym) const
+  {
+    if (!slots_ || !slots_[pc].offset)
+      return false;
+
+    const auto& slot = slots_[pc];
+    sym.label = std::string_view (pool_ + slot.offset, slot.label_size);
+    sym.comment = std::string_view (pool_ + slot.offset + slot.label_size, slot.comment_size);
+
+    return true;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Check if table has a given symbol
+  //! \param pc Address
+  //! \return true/false
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  bool
+  has_symbol (addr_type pc) const
+  {
+    return slots_ && slots_[pc].offset;
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  //! \brief Get addresses with symbols
+  //! \return Addresses, sorted
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  std::vector <addr_type>
+  get_addresses () const
+  {
+    std::vector <addr_type> addrs;
+
+    for (std::uint32_t pc = 0;slots_ && pc < SLOT_COUNT;pc++)
+      if (slots_[pc].offset)
+        addrs.push_back (static_cast <addr_type> (pc));
+
+    return addrs;
+  }
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  bool has_symbol (addr_type) const;
-  void add_symbol (addr_type, const std::string&, const std::string&);
-  std::string get_label (addr_type) const;
-  std::string get_comment (addr_type) const;
+  std::string_view get_label (addr_type) const;
+  std::string_view get_comment (addr_type) const;
+  void add_symbol (addr_type, std::string_view, std::string_view);
+  void set_symbol (addr_type, std::string_view, std::string_view);
   void load_def (const std::string&);
+  void load_profile (const std::string&);
+  void parse_def (std::string_view, const std::string&);
+  void load_image (const std::string&);
+  void save_image (const std::string&) const;
 
 private:
-  //! \brief Symbols
-  std::unordered_map <addr_type, Symbol> symbols_;
+  void make_writable ();
+  void unmap_image ();
+
+  //! \brief Slots, one per address (owned or mapped)
+  const symbol_slot *slots_ = nullptr;
+
+  //! \brief String pool (owned or mapped)
+  const char *pool_ = nullptr;
+
+  //! \brief Owned slots
+  std::vector <symbol_slot> own_slots_;
+
+  //! \brief Owned string pool, used as arena
+  std::string own_pool_;
+
+  //! \brief Mapped symbol image (nullptr = none)
+  void *image_data_ = nullptr;
+
+  //! \brief Mapped symbol image size
+  std::size_t image_size_ = 0;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Check if table has a given symbol
-//! \param addr Address
-//! \return true/false
+//! \brief Destructor
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-bool
-symbol_table::impl::has_symbol (addr_type pc) const
+symbol_table::impl::~impl ()
+{
+  unmap_image ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Unmap symbol image, if any
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::unmap_image ()
+{
+  if (image_data_)
+    {
+      munmap (image_data_, image_size_);
+      image_data_ = nullptr;
+      image_size_ = 0;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Make slots and pool owned by the table, copying mapped image
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::make_writable ()
 {
-  return symbols_.find (pc) != symbols_.end ();
+  if (image_data_)
+    {
+      own_slots_.assign (slots_, slots_ + SLOT_COUNT);
+      own_pool_.assign (pool_, reinterpret_cast <const image_header *> (image_data_)->pool_size);
+      unmap_image ();
+    }
+
+  else if (own_slots_.empty ())
+    {
+      own_slots_.assign (SLOT_COUNT, symbol_slot {0, 0, 0});
+      own_pool_.assign (1, '\0');       // offset 0 means no symbol
+    }
+
+  slots_ = own_slots_.data ();
+  pool_ = own_pool_.data ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -72,17 +237,13 @@ symbol_table::impl::has_symbol (addr_type pc) const
 //! \param addr Address
 //! \return Label, if found
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
+std::string_view
 symbol_table::impl::get_label (addr_type pc) const
 {
-  std::string label;
+  symbol sym;
+  get_symbol (pc, sym);
 
-  auto iter = symbols_.find (pc);
-
-  if (iter != symbols_.end ())
-    label = iter->second.label;
-
-  return label;
+  return sym.label;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -90,82 +251,352 @@ symbol_table::impl::get_label (addr_type pc) const
 //! \param addr Address
 //! \return Comment, if found
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
+std::string_view
 symbol_table::impl::get_comment (addr_type pc) const
 {
-  std::string comment;
+  symbol sym;
+  get_symbol (pc, sym);
 
-  auto iter = symbols_.find (pc);
+  return sym.comment;
+}
 
-  if (iter != symbols_.end ())
-    comment = iter->second.comment;
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set symbol, replacing existing one
+//! \param addr Address
+//! \param label Label
+//! \param comment Comment
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::set_symbol (addr_type addr, std::string_view label, std::string_view comment)
+{
+  if (label.size () > 0xffff || comment.size () > 0xffff)
+    throw std::invalid_argument ("Symbol text too long");
+
+  make_writable ();
+
+  if (own_pool_.size () + label.size () + comment.size () > 0xffffffff)
+    throw std::runtime_error ("Symbol table string pool is full");
 
-  return comment;
+  auto& slot = own_slots_[addr];
+  slot.offset = own_pool_.size ();
+  slot.label_size = label.size ();
+  slot.comment_size = comment.size ();
+
+  own_pool_ += label;
+  own_pool_ += comment;
+  pool_ = own_pool_.data ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Add symbol to table
+//! \brief Add symbol to table, if there is no symbol at address yet
 //! \param addr Address
-//! \param label Label
+//! \param label Label (empty = "lxxxx")
 //! \param comment Comment
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 symbol_table::impl::add_symbol (
   addr_type addr,
-  const std::string& label,
-  const std::string& comment
+  std::string_view label,
+  std::string_view comment
 )
 {
-  Symbol symbol;
-  symbol.addr = addr;
-  symbol.label = label;
-  symbol.comment = comment;
+  if (has_symbol (addr))
+    return;
 
   if (label.empty ())
     {
       char buffer[8];
       sprintf (buffer, "l%04x", addr);
-      symbol.label = buffer;
+      set_symbol (addr, buffer, comment);
     }
 
-  symbols_.try_emplace (addr, symbol);
+  else
+    set_symbol (addr, label, comment);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load built-in machine profile, base profiles first
+//! \param name Profile name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::load_profile (const std::string& name)
+{
+  const machine_profile *profile = find_machine_profile (name);
+
+  if (!profile)
+    throw std::invalid_argument ("unknown machine profile '" + name + "'");
+
+  const machine_profile *chain[8];
+  std::size_t count = 0;
+
+  for (;profile && count < std::size (chain);profile = profile->base)
+    chain[count++] = profile;
+
+  while (count)
+    {
+      profile = chain[--count];
+
+      for (std::size_t i = 0;i < profile->count;i++)
+        {
+          const auto& sym = profile->symbols[i];
+          set_symbol (sym.addr, sym.label, sym.comment);
+        }
+    }
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Load .def file
+//! \brief Load .def file, either text or compiled symbol image
 //! \param path File path
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 symbol_table::impl::load_def (const std::string& path)
 {
-  FILE *fp = fopen (path.c_str (), "rt");
-  if (!fp)
-    throw std::runtime_error (strerror (errno));
+  int fd = ::open (path.c_str (), O_RDONLY);
+  if (fd == -1)
+    throw std::system_error (errno, std::system_category (), "Failed to open " + path);
 
-  constexpr size_t LINE_MAX = 1024;
-  std::array <char, LINE_MAX> buffer;
+  struct stat st;
+  if (fstat (fd, &st) == -1)
+    {
+      int err = errno;
+      ::close (fd);
+      throw std::system_error (err, std::system_category (), "Failed to stat " + path);
+    }
+
+  const std::size_t size = st.st_size;
 
-  while (fgets (buffer.data (), LINE_MAX, fp))
+  if (size == 0)
     {
-      std::string line (buffer.data ());
-      const auto pos = line.find_last_not_of ("\r\n\t ");
+      ::close (fd);
+      return;
+    }
 
-      if (pos != std::string::npos)
-        line.erase (pos + 1);
+  void *data = mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close (fd);
 
-      Symbol symbol;
-      symbol.addr = std::stoi (line.substr (0, 4), nullptr, 16);
+  if (data == MAP_FAILED)
+    throw std::system_error (errno, std::system_category (), "Failed to map " + path);
 
-      if (line.size () > 5)
-        symbol.label = line.substr (5, 6);
+  const std::string_view text (static_cast <const char *> (data), size);
 
-      if (line.size () > 12)
-        symbol.comment = line.substr (12);
+  try
+    {
+      if (text.substr (0, sizeof (IMAGE_MAGIC)) == std::string_view (IMAGE_MAGIC, sizeof (IMAGE_MAGIC)))
+        {
+          munmap (data, size);
+          load_image (path);
+          return;
+        }
+
+      parse_def (text, path);
+    }
+  catch (...)
+    {
+      munmap (data, size);
+      throw;
+    }
 
-      symbols_[symbol.addr] = symbol;
-   }
+  munmap (data, size);
+}
 
-  fclose (fp);
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Parse .def text
+//! \param text File contents
+//! \param path File path, for diagnostics
+//!
+//! Each line holds an hexadecimal address, a label and an optional comment,
+//! separated by blanks (e.g. "0038 KEYINT Executes the timer interrupt").
+//! Blank lines and lines starting with ';' or '#' are ignored. Errors are
+//! reported as "path:line: message".
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::parse_def (std::string_view text, const std::string& path)
+{
+  std::size_t line_number = 0;
+
+  while (!text.empty ())
+    {
+      // get next line
+      auto eol = text.find ('\n');
+      auto line = text.substr (0, eol);
+      text.remove_prefix (eol == std::string_view::npos ? text.size () : eol + 1);
+      line_number++;
+
+      auto error = [&path, line_number] (const std::string& msg)
+        {
+          return std::runtime_error (path + ':' + std::to_string (line_number) + ": " + msg);
+        };
+
+      // skip blanks, comments and empty lines
+      auto pos = line.find_first_not_of (BLANKS);
+      if (pos == std::string_view::npos || line[pos] == ';' || line[pos] == '#')
+        continue;
+
+      line.remove_prefix (pos);
+      line = line.substr (0, line.find_last_not_of (BLANKS) + 1);
+
+      // address
+      const auto token = line.substr (0, line.find_first_of (BLANKS));
+      std::uint32_t addr = 0;
+      auto [ptr, ec] = std::from_chars (token.data (), token.data () + token.size (), addr, 16);
+
+      if (ec == std::errc::result_out_of_range || (ec == std::errc () && addr > 0xffff))
+        throw error ("address out of range '" + std::string (token) + "'");
+
+      if (ec != std::errc () || ptr != token.data () + token.size ())
+        throw error ("invalid address '" + std::string (token) + "'");
+
+      line.remove_prefix (token.size ());
+
+      // label
+      pos = line.find_first_not_of (BLANKS);
+      if (pos == std::string_view::npos)
+        throw error ("missing label");
+
+      line.remove_prefix (pos);
+      auto label = line.substr (0, line.find_first_of (BLANKS));
+      line.remove_prefix (label.size ());
+
+      // comment
+      pos = line.find_first_not_of (BLANKS);
+      auto comment = pos == std::string_view::npos ? std::string_view () : line.substr (pos);
+
+      if (label.size () > 0xffff || comment.size () > 0xffff)
+        throw error ("line too long");
+
+      set_symbol (addr, label, comment);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load compiled symbol image
+//! \param path File path
+//!
+//! If the table is empty, the image is mapped and used directly, with no
+//! parsing. Otherwise its symbols are copied into the table, overriding
+//! existing ones, as with .def text files.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::load_image (const std::string& path)
+{
+  int fd = ::open (path.c_str (), O_RDONLY);
+  if (fd == -1)
+    throw std::system_error (errno, std::system_category (), "Failed to open symbol image");
+
+  struct stat st;
+  if (fstat (fd, &st) == -1)
+    {
+      int err = errno;
+      ::close (fd);
+      throw std::system_error (err, std::system_category (), "Failed to stat symbol image");
+    }
+
+  const std::size_t size = st.st_size;
+  void *data = MAP_FAILED;
+
+  if (size >= IMAGE_POOL_OFFSET)
+    data = mmap (nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+  ::close (fd);
+
+  if (data == MAP_FAILED)
+    throw std::runtime_error ("Invalid symbol image: " + path);
+
+  // Validate image
+  image_header header;
+  std::memcpy (&header, data, sizeof (header));
+
+  bool valid = header.version == IMAGE_VERSION &&
+               header.slot_count == SLOT_COUNT &&
+               header.pool_size > 0 &&
+               size == IMAGE_POOL_OFFSET + header.pool_size;
+
+  auto slots = reinterpret_cast <const symbol_slot *> (static_cast <const char *> (data) + sizeof (image_header));
+  auto pool = static_cast <const char *> (data) + IMAGE_POOL_OFFSET;
+
+  for (std::uint32_t i = 0;valid && i < SLOT_COUNT;i++)
+    {
+      const auto& slot = slots[i];
+
+      if (slot.offset && std::size_t (slot.offset) + slot.label_size + slot.comment_size > header.pool_size)
+        valid = false;
+    }
+
+  if (!valid)
+    {
+      munmap (data, size);
+      throw std::runtime_error ("Invalid symbol image: " + path);
+    }
+
+  // Use image directly, if table is empty
+  if (!slots_)
+    {
+      image_data_ = data;
+      image_size_ = size;
+      slots_ = slots;
+      pool_ = pool;
+      return;
+    }
+
+  // Otherwise, copy symbols
+  for (std::uint32_t i = 0;i < SLOT_COUNT;i++)
+    {
+      const auto& slot = slots[i];
+
+      if (slot.offset)
+        set_symbol (i, std::string_view (pool + slot.offset, slot.label_size),
+                       std::string_view (pool + slot.offset + slot.label_size, slot.comment_size));
+    }
+
+  munmap (data, size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load built-in machine profile (msx1, msx2, msx2+, turbor)
+//! \param name Profile name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::load_profile (const std::string& name)
+{
+  impl_->load_profile (name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save table as compiled symbol image
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::impl::save_image (const std::string& path) const
+{
+  std::vector <symbol_slot> slots (SLOT_COUNT, symbol_slot {0, 0, 0});
+  std::string pool (1, '\0');          // offset 0 means no symbol
+
+  for (std::uint32_t i = 0;i < SLOT_COUNT;i++)
+    {
+      symbol sym;
+
+      if (get_symbol (i, sym))
+        {
+          slots[i].offset = pool.size ();
+          slots[i].label_size = sym.label.size ();
+          slots[i].comment_size = sym.comment.size ();
+          pool += sym.label;
+          pool += sym.comment;
+        }
+    }
+
+  image_header header;
+  std::memcpy (header.magic, IMAGE_MAGIC, sizeof (header.magic));
+  header.version = IMAGE_VERSION;
+  header.slot_count = SLOT_COUNT;
+  header.pool_size = pool.size ();
+  header.reserved = 0;
+
+  output_sink out (path);
+  out.write ({reinterpret_cast <const char *> (&header), sizeof (header)});
+  out.write ({reinterpret_cast <const char *> (slots.data ()), slots.size () * sizeof (symbol_slot)});
+  out.write (pool);
+  out.close ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -187,12 +618,26 @@ symbol_table::has_symbol (addr_type pc) const
   return impl_->has_symbol (pc);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get symbol, with a single lookup
+//! \param addr Address
+//! \param sym Symbol, if found
+//! \return true if found, false otherwise
+//!
+//! Label and comment views are valid until the table is modified.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+symbol_table::get_symbol (addr_type pc, symbol& sym) const
+{
+  return impl_->get_symbol (pc, sym);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Get address label
 //! \param addr Address
 //! \return Label, if found
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
+std::string_view
 symbol_table::get_label (addr_type pc) const
 {
   return impl_->get_label (pc);
@@ -203,12 +648,22 @@ symbol_table::get_label (addr_type pc) const
 //! \param addr Address
 //! \return Comment, if found
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-std::string
+std::string_view
 symbol_table::get_comment (addr_type pc) const
 {
   return impl_->get_comment (pc);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get addresses with symbols, to look up symbols by label
+//! \return Addresses, sorted
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector <symbol_table::addr_type>
+symbol_table::get_addresses () const
+{
+  return impl_->get_addresses ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Add symbol to table
 //! \param addr Address
@@ -218,20 +673,44 @@ symbol_table::get_comment (addr_type pc) const
 void
 symbol_table::add_symbol (
   addr_type addr,
-  const std::string& label,
-  const std::string& comment
+  std::string_view label,
+  std::string_view comment
 )
 {
   impl_->add_symbol (addr, label, comment);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Load .def file
+//! \brief Load .def file, either text or compiled symbol image
+//! \param path File path
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 symbol_table::load_def (const std::string& path)
 {
+  trace_span span ("symbol_table::load_def");
   impl_->load_def (path);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Load .def text from memory
+//! \param text .def file contents
+//! \param name Name used in error messages
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::load_def_text (std::string_view text, const std::string& name)
+{
+  trace_span span ("symbol_table::load_def");
+  impl_->parse_def (text, name);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save table as compiled symbol image
+//! \param path File path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+symbol_table::save_image (const std::string& path) const
+{
+  impl_->save_image (path);
+}
+
 } // namespace msxdasm
\ No newline at end of file
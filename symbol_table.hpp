@@ -20,7 +20,9 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <vector>
 
 namespace msxdasm
 {
@@ -35,6 +37,13 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   using addr_type = std::uint16_t;
 
+  //! \brief Symbol text, viewed in place
+  struct symbol
+  {
+    std::string_view label;
+    std::string_view comment;
+  };
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -52,10 +61,15 @@ public:
   // Prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   bool has_symbol (addr_type) const;
-  void add_symbol (addr_type, const std::string& = {}, const std::string& = {});
-  std::string get_label (addr_type) const;
-  std::string get_comment (addr_type) const;
+  bool get_symbol (addr_type, symbol&) const;
+  void add_symbol (addr_type, std::string_view = {}, std::string_view = {});
+  std::string_view get_label (addr_type) const;
+  std::string_view get_comment (addr_type) const;
+  std::vector <addr_type> get_addresses () const;
   void load_def (const std::string&);
+  void load_def_text (std::string_view, const std::string& = "<memory>");
+  void load_profile (const std::string&);
+  void save_image (const std::string&) const;
 
 private:
   //! \brief Forward declaration
@@ -0,0 +1,289 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "trace.hpp"
+#include "json.hpp"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+//! \brief Number of spans in each thread ring buffer
+static constexpr std::size_t RING_SIZE = 16384;
+
+//! \brief Recorded span
+struct span
+{
+  const char *name;
+  std::uint32_t rom;
+  std::int64_t start;
+  std::int64_t end;
+};
+
+//! \brief Per-thread ring buffer
+struct ring_buffer
+{
+  std::uint32_t tid;
+  std::atomic <std::uint64_t> count {0};
+  span spans[RING_SIZE];
+};
+
+//! \brief Tracing enabled flag
+static std::atomic <bool> enabled {false};
+
+//! \brief Time tracing was enabled, in nanoseconds
+static std::int64_t epoch = 0;
+
+//! \brief Mutex protecting buffers and ROM names
+static std::mutex mutex;
+
+//! \brief Ring buffers, one per thread that recorded spans
+static std::vector <std::unique_ptr <ring_buffer>> buffers;
+
+//! \brief Ring buffers released by finished threads, to be reused
+static std::vector <ring_buffer *> free_buffers;
+
+//! \brief ROM names, indexed by ROM ID - 1
+static std::vector <std::string> rom_names;
+
+//! \brief Thread ring buffer holder, releasing buffer when thread ends
+struct buffer_holder
+{
+  ring_buffer *buffer = nullptr;
+
+  ~buffer_holder ()
+  {
+    if (buffer)
+      {
+        std::lock_guard <std::mutex> lock (mutex);
+        free_buffers.push_back (buffer);
+      }
+  }
+};
+
+//! \brief Current thread ring buffer
+static thread_local buffer_holder thread_buffer;
+
+//! \brief Current thread ROM ID (0 = none)
+static thread_local std::uint32_t thread_rom = 0;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Append time in microseconds, as used by trace event format
+//! \param text Text
+//! \param ns Time in nanoseconds
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+append_us (std::string& text, std::int64_t ns)
+{
+  char buffer[32];
+  snprintf (buffer, sizeof (buffer), "%.3f", ns / 1000.0);
+  text += buffer;
+}
+
+} // namespace
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Enable span recording
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+enable_trace ()
+{
+  std::lock_guard <std::mutex> lock (mutex);
+
+  if (!enabled.load ())
+    {
+      epoch = get_trace_clock ();
+      enabled.store (true);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Check if span recording is enabled
+//! \return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+is_trace_enabled () noexcept
+{
+  return enabled.load (std::memory_order_relaxed);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get ROM ID of the current thread
+//! \return ROM ID (0 = none)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint32_t
+get_trace_rom () noexcept
+{
+  return thread_rom;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set ROM ID of the current thread, for helper threads
+//! \param rom ROM ID, as returned by get_trace_rom
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+set_trace_rom (std::uint32_t rom) noexcept
+{
+  thread_rom = rom;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Set ROM being processed by the current thread
+//! \param path ROM path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+set_trace_rom (const std::string& path)
+{
+  if (!is_trace_enabled ())
+    return;
+
+  std::lock_guard <std::mutex> lock (mutex);
+  rom_names.push_back (path);
+  thread_rom = rom_names.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Record span into current thread ring buffer
+//! \param name Span name (static string)
+//! \param start Start time, in nanoseconds
+//! \param end End time, in nanoseconds
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+record_trace_span (const char *name, std::int64_t start, std::int64_t end) noexcept
+{
+  auto buffer = thread_buffer.buffer;
+
+  // get buffer, reusing the ones released by finished threads
+  if (!buffer)
+    {
+      try
+        {
+          std::lock_guard <std::mutex> lock (mutex);
+
+          if (free_buffers.empty ())
+            {
+              buffers.push_back (std::make_unique <ring_buffer> ());
+              buffers.back ()->tid = buffers.size ();
+              buffer = buffers.back ().get ();
+            }
+
+          else
+            {
+              buffer = free_buffers.back ();
+              free_buffers.pop_back ();
+            }
+
+          thread_buffer.buffer = buffer;
+        }
+      catch (const std::exception&)
+        {
+          return;
+        }
+    }
+
+  auto count = buffer->count.load (std::memory_order_relaxed);
+  buffer->spans[count % RING_SIZE] = span {name, thread_rom, start, end};
+  buffer->count.store (count + 1, std::memory_order_release);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Write recorded spans as Chrome trace event JSON
+//! \param path File path
+//!
+//! The file can be loaded into Perfetto or chrome://tracing. Threads are
+//! numbered by ring buffer, which are reused by threads started later, so
+//! short-lived render threads share a few timeline rows. When a ring buffer
+//! has wrapped, a "dropped_spans" metadata event gives the number of spans
+//! lost for that thread.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_trace (const std::string& path)
+{
+  std::lock_guard <std::mutex> lock (mutex);
+
+  const auto pid = std::to_string (getpid ());
+  std::string text = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+
+  for (const auto& buffer : buffers)
+    {
+      const auto tid = std::to_string (buffer->tid);
+      const auto count = buffer->count.load (std::memory_order_acquire);
+      const auto first_span = count > RING_SIZE ? count - RING_SIZE : 0;
+
+      // thread name
+      if (!first)
+        text += ',';
+
+      first = false;
+      text += "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid;
+      text += ",\"args\":{\"name\":\"thread " + tid + "\"}}";
+
+      // spans overwritten when ring buffer wrapped
+      if (first_span)
+        {
+          text += ",\n{\"name\":\"dropped_spans\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid;
+          text += ",\"args\":{\"count\":" + std::to_string (first_span) + "}}";
+        }
+
+      // spans
+      for (auto i = first_span;i < count;i++)
+        {
+          const auto& s = buffer->spans[i % RING_SIZE];
+
+          text += ",\n{\"name\":";
+          append_json_string (text, s.name);
+          text += ",\"cat\":\"msxdasm\",\"ph\":\"X\",\"ts\":";
+          append_us (text, s.start - epoch);
+          text += ",\"dur\":";
+          append_us (text, s.end - s.start);
+          text += ",\"pid\":" + pid + ",\"tid\":" + tid;
+
+          if (s.rom)
+            {
+              text += ",\"args\":{\"rom\":";
+              append_json_string (text, rom_names[s.rom - 1]);
+              text += '}';
+            }
+
+          text += '}';
+        }
+    }
+
+  text += "\n]}\n";
+
+  std::ofstream fp (path, std::ios::binary);
+
+  if (!fp)
+    throw std::runtime_error ("could not create file " + path);
+
+  fp << text;
+  fp.close ();
+
+  if (!fp)
+    throw std::runtime_error ("could not write file " + path);
+}
+
+} // namespace msxdasm
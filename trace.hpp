@@ -0,0 +1,91 @@
+#ifndef MSXDASM_TRACE_HPP
+#define MSXDASM_TRACE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// MSXDasm
+// Copyright (C) 1999-2025 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace msxdasm
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Prototypes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void enable_trace ();
+bool is_trace_enabled () noexcept;
+std::uint32_t get_trace_rom () noexcept;
+void set_trace_rom (std::uint32_t) noexcept;
+void set_trace_rom (const std::string&);
+void record_trace_span (const char *, std::int64_t, std::int64_t) noexcept;
+void write_trace (const std::string&);
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Get trace clock
+//! \return Current time, in nanoseconds
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+inline std::int64_t
+get_trace_clock () noexcept
+{
+  return std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Scoped trace span, recorded when tracing is enabled
+//!
+//! Spans are appended to a thread-local ring buffer, with no locking, so
+//! they are cheap enough to leave enabled. When the buffer is full, the
+//! oldest spans are overwritten.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class trace_span
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit trace_span (const char *name) noexcept
+    : name_ (name), start_ (is_trace_enabled () ? get_trace_clock () : -1)
+  {
+  }
+
+  trace_span (const trace_span&) = delete;
+  trace_span (trace_span&&) = delete;
+
+  ~trace_span ()
+  {
+    if (start_ != -1)
+      record_trace_span (name_, start_, get_trace_clock ());
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  trace_span& operator= (const trace_span&) = delete;
+  trace_span& operator= (trace_span&&) = delete;
+
+private:
+  //! \brief Span name (static string)
+  const char *name_;
+
+  //! \brief Start time, in nanoseconds (-1 = tracing disabled)
+  std::int64_t start_;
+};
+
+} // namespace msxdasm
+
+#endif // MSXDASM_TRACE_HPP